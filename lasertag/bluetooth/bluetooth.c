@@ -5,11 +5,13 @@
  *      Author: hutch
  */
 
-// DONT COMPILE AND LINK THIS INTO YOUR PROJECT.
-// IT IS ALREADY COMPILED INTO THE LASERTAG LIBRARY.
+// Compiled into lasertag.elf (see lasertag/CMakeLists.txt) in place of the
+// copy in the prebuilt lasertag library, which predates the calls that
+// gameProtocol.c uses.
 
 #include <Xuartlite.h>
 #include <stdio.h>
+#include <string.h>
 
 #include "bluetooth.h"
 #include "xparameters.h"
@@ -18,17 +20,24 @@ static XUartLite bluetooth_uartInstance; // Handle to the bluetooth UART.
 static XUartLite_Config
     bluetooth_uartConfig; // Handle to the bluetooth UART config.
 
-// This implements a dedicated buffer for storing values from the ADC
-// until they are read and processed by detector().
-// adcBuffer_t is similar to a queue.
-#define BLUETOOTH_QUEUE_SIZE 1000
-#define BLUETOOTH_UART_FIFO_SIZE 16
+// The queues are rings whose size is a power of two so that wrapping an index
+// is a mask instead of a divide. indexIn and indexOut run freely (they are
+// only masked when the data is accessed), so the element count is always
+// indexIn - indexOut, even after the indices wrap around.
+//
+// Each queue is shared by the game loop and bluetooth_poll() in the timer
+// ISR: one of them only moves indexIn (after it wrote the data) and the other
+// only moves indexOut (after it read the data). Each side reads the other
+// side's index with an acquire load and moves its own with a release store,
+// so the data is always in place before the index that covers it is seen.
+#define BLUETOOTH_QUEUE_MASK (BLUETOOTH_QUEUE_SIZE - 1)
+#if (BLUETOOTH_QUEUE_SIZE & BLUETOOTH_QUEUE_MASK) != 0
+#error "BLUETOOTH_QUEUE_SIZE must be a power of two."
+#endif
 typedef struct {
   uint16_t indexIn;                   // New values go here.
   uint16_t indexOut;                  // Pull old values from here.
   uint8_t data[BLUETOOTH_QUEUE_SIZE]; // Store values here.
-  uint16_t elementCount; // Number of values contained in adcBuffer_t.
-  uint16_t size;         // queue can hold this many elements.
 } bluetooth_queue_t;
 
 static bluetooth_queue_t
@@ -38,82 +47,101 @@ static bluetooth_queue_t
                              // bluetooth UART go here.
 
 // Init the q.
-void bluetooth_queueInit(bluetooth_queue_t *q, uint16_t size) {
+void bluetooth_queueInit(bluetooth_queue_t *q) {
   q->indexIn = 0;
   q->indexOut = 0;
-  q->elementCount = 0;
-  q->size = size;
-}
-
-// Implemented as a fixed-size circular buffer.
-// indexIn always points to an empty location (by definition).
-// indexOut always points to the oldest element.
-// buffer is empty if indexIn == indexOut. Buffer is full if incremented indexIn
-// == indexOut
-void bluetooth_queuePush(bluetooth_queue_t *q, uint8_t data) {
-  if (q->elementCount <
-      q->size) // Increment the element count unless you are already full.
-    q->elementCount++;
-  q->data[q->indexIn] = data;              // write,
-  q->indexIn = (q->indexIn + 1) % q->size; // then increment.
-  if (q->indexIn ==
-      q->indexOut) { // If you are now pointing at the out pointer,
-    q->indexOut = (q->indexOut + 1) % q->size; // move the out pointer up.
-  }
-}
-
-// Removes a single item from the ADC buffer.
-// Does not signal an error if the ADC buffer is currently
-// empty. Simply returns a default value of 0 if the buffer is currently empty.
-uint8_t bluetooth_queuePop(bluetooth_queue_t *q) {
-  uint8_t returnValue = 0;
-  if (q->indexIn == q->indexOut) // Just return 0 if empty.
-    return 0;
-  else {
-    returnValue =
-        q->data[q->indexOut]; // Not empty, get the return value from buffer.
-    q->indexOut = (q->indexOut + 1) % q->size; // increment the out index.
-    q->elementCount--;                         // One less element.
-  }
-  return returnValue;
-}
-
-// Provides read access to all elements in the ADC buffer.
-// No error messages are provided. In cases of error, a 0 is returned.
-// index = 0 indexes the oldest data in the queue.
-uint32_t bluetooth_queueReadElementAt(bluetooth_queue_t *q, uint32_t index) {
-  // Just return 0 if there if the buffer is empty or not enough elements for
-  // the index.
-  if ((q->indexIn == q->indexOut) || (index + 1 > q->elementCount))
-    return 0;
-  // Otherwise, there are enough elements, just do modulo addressing.
-  return q->data[(q->indexOut + index) % q->size];
 }
 
 // Functional interface to access element count.
 uint16_t bluetooth_queueElementCount(bluetooth_queue_t *q) {
-  return q->elementCount;
+  return (uint16_t)(__atomic_load_n(&q->indexIn, __ATOMIC_ACQUIRE) -
+                    __atomic_load_n(&q->indexOut, __ATOMIC_ACQUIRE));
+}
+
+// Number of elements that can still be pushed.
+uint16_t bluetooth_queueSpace(bluetooth_queue_t *q) {
+  return BLUETOOTH_QUEUE_SIZE - bluetooth_queueElementCount(q);
 }
 
 // Check if the queue is empty.
 bool bluetooth_queueEmpty(bluetooth_queue_t *q) {
-  return (q->indexIn == q->indexOut);
+  return bluetooth_queueElementCount(q) == 0;
 }
 
 // Check if the queue is full.
 bool bluetooth_queueFull(bluetooth_queue_t *q) {
-  return !(q->elementCount < q->size);
+  return bluetooth_queueElementCount(q) == BLUETOOTH_QUEUE_SIZE;
 }
 
-uint16_t bluetooth_queueSize(bluetooth_queue_t *q) { return q->size; }
+// Number of elements that can be read starting at the oldest one without
+// wrapping around the end of the ring.
+static uint16_t bluetooth_queueContiguousCount(bluetooth_queue_t *q) {
+  uint16_t count = bluetooth_queueElementCount(q);
+  uint16_t toEnd = BLUETOOTH_QUEUE_SIZE - (q->indexOut & BLUETOOTH_QUEUE_MASK);
+  return count < toEnd ? count : toEnd;
+}
+
+// Number of elements that can be written at indexIn without wrapping around
+// the end of the ring.
+static uint16_t bluetooth_queueContiguousSpace(bluetooth_queue_t *q) {
+  uint16_t space = bluetooth_queueSpace(q);
+  uint16_t toEnd = BLUETOOTH_QUEUE_SIZE - (q->indexIn & BLUETOOTH_QUEUE_MASK);
+  return space < toEnd ? space : toEnd;
+}
+
+// Publishes count elements written at indexIn.
+static void bluetooth_queuePublishIn(bluetooth_queue_t *q, uint16_t count) {
+  __atomic_store_n(&q->indexIn, (uint16_t)(q->indexIn + count),
+                   __ATOMIC_RELEASE);
+}
+
+// Frees count elements read at indexOut.
+static void bluetooth_queuePublishOut(bluetooth_queue_t *q, uint16_t count) {
+  __atomic_store_n(&q->indexOut, (uint16_t)(q->indexOut + count),
+                   __ATOMIC_RELEASE);
+}
+
+// Copies up to size bytes into the queue, in at most two spans. Returns the
+// number of bytes copied (less than size if the queue fills up).
+static uint16_t bluetooth_queueWrite(bluetooth_queue_t *q, const uint8_t *data,
+                                     uint16_t size) {
+  uint16_t written = 0;
+  while (written < size) {
+    uint16_t span = bluetooth_queueContiguousSpace(q);
+    if (span == 0)
+      break; // Full.
+    if (span > size - written)
+      span = size - written;
+    memcpy(&q->data[q->indexIn & BLUETOOTH_QUEUE_MASK], &data[written], span);
+    bluetooth_queuePublishIn(q, span);
+    written += span;
+  }
+  return written;
+}
+
+// Copies up to maxSize bytes out of the queue, in at most two spans. Returns
+// the number of bytes copied.
+static uint16_t bluetooth_queueRead(bluetooth_queue_t *q, uint8_t *data,
+                                    uint16_t maxSize) {
+  uint16_t read = 0;
+  while (read < maxSize) {
+    uint16_t span = bluetooth_queueContiguousCount(q);
+    if (span == 0)
+      break; // Empty.
+    if (span > maxSize - read)
+      span = maxSize - read;
+    memcpy(&data[read], &q->data[q->indexOut & BLUETOOTH_QUEUE_MASK], span);
+    bluetooth_queuePublishOut(q, span);
+    read += span;
+  }
+  return read;
+}
 
 // Used to initialize any bluetooth data structures.
 // Must be called before accessing any of the bluetooth_ routines.
 int bluetooth_init() {
-  bluetooth_queueInit(&bluetooth_receiveQueue,
-                      BLUETOOTH_QUEUE_SIZE); // init the receive q.
-  bluetooth_queueInit(&bluetooth_transmitQueue,
-                      BLUETOOTH_QUEUE_SIZE); // init the transmit q.
+  bluetooth_queueInit(&bluetooth_receiveQueue);  // init the receive q.
+  bluetooth_queueInit(&bluetooth_transmitQueue); // init the transmit q.
   // Init the bluetooth UART.
   int status =
       XUartLite_CfgInitialize(&bluetooth_uartInstance, &bluetooth_uartConfig,
@@ -146,77 +174,86 @@ uint16_t bluetooth_uartRead(uint8_t *data, uint16_t maxSize) {
 // the queue. Will only read upto maxSize characters. Returns the number of
 // characters read.
 uint16_t bluetooth_receiveQueueRead(uint8_t *data, uint16_t maxSize) {
-  uint16_t bytesRead = 0;
-  // Read the characters unless the receive queue empties.
-  for (uint16_t i = 0;
-       i < maxSize && !bluetooth_queueEmpty(&bluetooth_receiveQueue); i++) {
-    data[i] = bluetooth_queuePop(&bluetooth_receiveQueue);
-    bytesRead++;
-  }
-  return bytesRead; // Let the caller know how many bytes were read.
+  return bluetooth_queueRead(&bluetooth_receiveQueue, data, maxSize);
+}
+
+// Points *data at the oldest received character and returns how many
+// characters can be read from there without wrapping (0 if the queue is
+// empty). The characters stay in the queue until
+// bluetooth_receiveQueueConsume() is called.
+uint16_t bluetooth_receiveQueuePeek(const uint8_t **data) {
+  *data = &bluetooth_receiveQueue
+               .data[bluetooth_receiveQueue.indexOut & BLUETOOTH_QUEUE_MASK];
+  return bluetooth_queueContiguousCount(&bluetooth_receiveQueue);
+}
+
+// Removes count characters from the receive queue, normally after they were
+// parsed in place with bluetooth_receiveQueuePeek().
+void bluetooth_receiveQueueConsume(uint16_t count) {
+  uint16_t elementCount = bluetooth_queueElementCount(&bluetooth_receiveQueue);
+  if (count > elementCount)
+    count = elementCount;
+  bluetooth_queuePublishOut(&bluetooth_receiveQueue, count);
 }
 
 // Writes characters to the bluetooth transmit queue. The characters from the
 // buffer need to be written from the queue to the bluetooth UART. Returns the
 // number of characters written.
 uint16_t bluetooth_transmitQueueWrite(uint8_t *data, uint16_t size) {
-  uint16_t bytesWritten = 0;
-  // Write the characters unless the transmit queue fills up.
-  for (uint16_t i = 0;
-       i < size && !bluetooth_queueFull(&bluetooth_transmitQueue); i++) {
-    bluetooth_queuePush(&bluetooth_transmitQueue, data[i]);
-    bytesWritten++;
-  }
-  return bytesWritten; // Let the caller know how many bytes were written.
+  return bluetooth_queueWrite(&bluetooth_transmitQueue, data, size);
+}
+
+// Returns how many characters bluetooth_transmitQueueWrite() can accept.
+uint16_t bluetooth_transmitQueueSpace() {
+  return bluetooth_queueSpace(&bluetooth_transmitQueue);
 }
 
 // Polls the bluetooth for data.
 // Received data from the bluetooth UART are placed in the receive queue.
-// Data in the transmit queue are sent to the bluetooth UART.
-// bluetooth UART only operates at 9600 BAUD, so don't call this more than about
-// every 5 ms or so. Presumed that this will be called in a timer ISR.
+// Data in the transmit queue are sent to the bluetooth UART, up to
+// BLUETOOTH_UART_FIFO_SIZE characters per call in contiguous spans.
+// bluetooth UART only operates at 9600 BAUD (about 1 byte per ms), so calling
+// this every 1 ms keeps up with the line; the FIFOs overflow if it is called
+// less often than every 16 ms. Presumed that this will be called in a timer
+// ISR.
 void bluetooth_poll() {
-  // Read characters from the bluetooth UART and copy to the receive queue.
-  uint8_t readData[BLUETOOTH_UART_FIFO_SIZE];
-  // How much room is in the receive queue?
-  uint16_t receiveQueueSpace =
-      bluetooth_queueSize(&bluetooth_receiveQueue) -
-      bluetooth_queueElementCount(&bluetooth_receiveQueue);
-  // Requested number of bytes will be either all the chars in the UART FIFO, or
-  // the available space in the recieve queue.
-  uint16_t requestedReadCount = receiveQueueSpace > BLUETOOTH_UART_FIFO_SIZE
-                                    ? BLUETOOTH_UART_FIFO_SIZE
-                                    : receiveQueueSpace;
-  // Transfer whatever you read to the receive queue.
-  uint16_t bytesRead = bluetooth_uartRead(readData, requestedReadCount);
-  //    if (bytesRead != 0)
-  //        printf("received %d bytes.\n", bytesRead);
-  for (uint16_t i = 0; i < bytesRead; i++) {
-    bluetooth_queuePush(&bluetooth_receiveQueue, readData[i]);
+  // Read characters from the bluetooth UART straight into the receive queue,
+  // at most a FIFO's worth per poll. A span stops at the end of the ring, so
+  // there can be a second read for the part that wraps.
+  uint16_t readBudget = BLUETOOTH_UART_FIFO_SIZE;
+  while (readBudget) {
+    uint16_t span = bluetooth_queueContiguousSpace(&bluetooth_receiveQueue);
+    if (span > readBudget)
+      span = readBudget;
+    if (span == 0)
+      break; // Receive queue is full.
+    uint16_t bytesRead = bluetooth_uartRead(
+        &bluetooth_receiveQueue
+             .data[bluetooth_receiveQueue.indexIn & BLUETOOTH_QUEUE_MASK],
+        span);
+    bluetooth_queuePublishIn(&bluetooth_receiveQueue, bytesRead);
+    readBudget -= bytesRead;
+    if (bytesRead < span)
+      break; // UART FIFO is empty.
   }
-  // Read chars from the transmit queue and send them to the bluetooth UART.
-  // Transmit characters one at a time so you won't have to put anything back
-  // into the transmit queue.
-  bool transmitOk =
-      true; // This will be set to false if unable to transmit a byte.
-  uint16_t bytesToTransmit =
-      bluetooth_queueElementCount(&bluetooth_transmitQueue);
-  // Loop will write bytes to the bluetooth UART until the UART is full or all
-  // characters are transmitted.
-  for (uint16_t i = 0; i < bytesToTransmit && transmitOk; i++) {
-    uint8_t transmitData[1]; // Only transmit one byte at a time.
-    transmitData[0] = bluetooth_queueReadElementAt(
-        &bluetooth_transmitQueue, i); // Read the byte to be transmitted.
-    uint8_t bytesWritten =
-        bluetooth_uartWrite(transmitData, 1); // Ask for it to be written.
-    if (bytesWritten == 1) { // Successful if one byte was written.
-      transmitOk = true;
-      bluetooth_queuePop(
-          &bluetooth_transmitQueue); // Successfully written so pop the data off
-                                     // the queue.
-    } else {                         // Not successful, so terminate.
-      transmitOk = false;
-    }
+  // Send contiguous spans of the transmit queue to the UART, up to a FIFO's
+  // worth. XUartLite_Send() returns how many bytes fit in the FIFO, and only
+  // those are removed from the queue, so nothing has to be put back.
+  uint16_t writeBudget = BLUETOOTH_UART_FIFO_SIZE;
+  while (writeBudget) {
+    uint16_t span = bluetooth_queueContiguousCount(&bluetooth_transmitQueue);
+    if (span > writeBudget)
+      span = writeBudget;
+    if (span == 0)
+      break; // Nothing left to send.
+    uint16_t bytesWritten = bluetooth_uartWrite(
+        &bluetooth_transmitQueue
+             .data[bluetooth_transmitQueue.indexOut & BLUETOOTH_QUEUE_MASK],
+        span);
+    bluetooth_queuePublishOut(&bluetooth_transmitQueue, bytesWritten);
+    writeBudget -= bytesWritten;
+    if (bytesWritten < span)
+      break; // UART FIFO is full.
   }
 }
 
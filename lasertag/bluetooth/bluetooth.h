@@ -14,6 +14,9 @@
 #define BLUETOOTH_INIT_STATUS_FAIL 0
 #define BLUETOOTH_INIT_STATUS_OK 1
 
+#define BLUETOOTH_QUEUE_SIZE 1024    // Bytes per queue, must be a power of two.
+#define BLUETOOTH_UART_FIFO_SIZE 16 // Depth of the UART transmit/receive FIFOs.
+
 // Used to initialize any bluetooth data structures.
 // Must be called before accessing any of the bluetooth_ routines.
 int bluetooth_init();
@@ -24,16 +27,32 @@ int bluetooth_init();
 // characters read.
 uint16_t bluetooth_receiveQueueRead(uint8_t *data, uint16_t maxSize);
 
+// Zero-copy alternative to bluetooth_receiveQueueRead(). Points *data at the
+// oldest received character and returns how many characters can be read from
+// there in one span (0 if the queue is empty). The queue may hold more after
+// the span wraps around; call again after consuming. The characters stay in
+// the queue until bluetooth_receiveQueueConsume() is called.
+uint16_t bluetooth_receiveQueuePeek(const uint8_t **data);
+
+// Removes count characters from the receive queue.
+void bluetooth_receiveQueueConsume(uint16_t count);
+
 // Writes characters to the bluetooth transmit queue. The characters from the
 // buffer need to be written from the queue to the bluetooth UART. Returns the
 // number of characters written.
 uint16_t bluetooth_transmitQueueWrite(uint8_t *data, uint16_t size);
 
+// Returns how many characters bluetooth_transmitQueueWrite() can accept.
+uint16_t bluetooth_transmitQueueSpace();
+
 // Polls the bluetooth for data.
 // Received data from the bluetooth UART are placed in the receive queue.
-// Data in the transmit queue are sent to the bluetooth UART.
-// bluetooth UART only operates at 9600 BAUD, so don't call this more than about
-// every 5 ms or so. Presumed that this will be called in a timer ISR.
+// Data in the transmit queue are sent to the bluetooth UART, up to
+// BLUETOOTH_UART_FIFO_SIZE characters per call in contiguous spans.
+// bluetooth UART only operates at 9600 BAUD (about 1 byte per ms), so calling
+// this every 1 ms keeps up with the line; the FIFOs overflow if it is called
+// less often than every 16 ms. Presumed that this will be called in a timer
+// ISR.
 void bluetooth_poll();
 
 // Starts an interactive loop that queries the user for input, transmits that
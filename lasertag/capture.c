@@ -0,0 +1,286 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "capture.h"
+
+// The ring holds 16-bit entries. Samples only use 12 bits, which leaves room
+// for markers and for the resync entry written when recording resumes after
+// the ring was full:
+//   0x0000-0x0fff  sample
+//   0x8tvv         marker of type t with value vv
+//   0xc000         resync, followed by two entries with the low and high half
+//                  of the ISR tick of the next sample
+#define RING_MASK (CAPTURE_RING_SIZE - 1)
+#if (CAPTURE_RING_SIZE & RING_MASK) != 0
+#error "CAPTURE_RING_SIZE must be a power of two."
+#endif
+#define SAMPLE_MASK 0x0fff
+#define MARKER_ENTRY 0x8000
+#define MARKER_TYPE_SHIFT 8
+#define MARKER_TYPE_MASK 0x0f
+#define MARKER_VALUE_MASK 0x00ff
+#define RESYNC_ENTRY 0xc000
+#define ENTRY_KIND_MASK 0xf000
+#define RESYNC_LENGTH 3 // Entries.
+#define HALF_SHIFT 16
+#define HALF_MASK 0xffff
+#define MAILBOX_SIZE 16 // Markers from the main loop. Must be a power of two.
+#define MAILBOX_MASK (MAILBOX_SIZE - 1)
+#define MAGIC "LTCP"
+#define MAGIC_SIZE 4
+
+static capture_sink_t sink;
+static volatile bool running;
+
+// Ring, written by the ISR and read by capture_poll(). The indexes run
+// freely, head - tail is the number of entries.
+static uint16_t ring[CAPTURE_RING_SIZE];
+static volatile uint32_t head;
+static volatile uint32_t tail;
+
+// Markers from the main loop on their way to the ISR.
+static uint16_t mailbox[MAILBOX_SIZE];
+static volatile uint32_t mailboxHead;
+static volatile uint32_t mailboxTail;
+
+// ISR state.
+static uint32_t tick; // Samples seen, recorded or not.
+static bool dropping; // Samples are being dropped, resync before the next.
+static volatile uint32_t droppedSamples;
+static volatile uint32_t droppedMarkers;
+
+// capture_poll() state: the chunk being filled.
+static uint64_t nextIndex; // Sample index of the next sample entry.
+static uint64_t chunkFirstIndex;
+static uint16_t chunkSamples[CAPTURE_CHUNK_SAMPLES];
+static uint16_t chunkSampleCount;
+static uint8_t chunkMarkers[CAPTURE_CHUNK_MARKERS][CAPTURE_MARKER_SIZE];
+static uint16_t chunkMarkerCount;
+static uint8_t chunkBytes[CAPTURE_CHUNK_HEADER_SIZE +
+                          CAPTURE_SAMPLES_BYTES(CAPTURE_CHUNK_SAMPLES)];
+
+static void putLittle16(uint8_t *bytes, uint16_t value) {
+  bytes[0] = value;
+  bytes[1] = value >> 8;
+}
+
+static void putLittle32(uint8_t *bytes, uint32_t value) {
+  putLittle16(bytes, value);
+  putLittle16(bytes + 2, value >> 16);
+}
+
+static void putLittle64(uint8_t *bytes, uint64_t value) {
+  putLittle32(bytes, value);
+  putLittle32(bytes + 4, value >> 32);
+}
+
+// Hands bytes to the sink, stops the capture if it fails.
+static void writeToSink(const uint8_t *data, uint32_t size) {
+  if (running && !sink(data, size)) {
+    printf("capture: the sink failed, capture stopped.\n");
+    running = false;
+  }
+}
+
+// Writes a chunk header and payload with one call to the sink. The payload
+// must already be at chunkBytes + CAPTURE_CHUNK_HEADER_SIZE.
+static void writeChunk(capture_chunkType_t type, uint16_t count,
+                       uint32_t payloadSize) {
+  chunkBytes[0] = type;
+  chunkBytes[1] = 0;
+  putLittle16(chunkBytes + 2, count);
+  putLittle32(chunkBytes + 4, payloadSize);
+  putLittle64(chunkBytes + 8, chunkFirstIndex);
+  writeToSink(chunkBytes, CAPTURE_CHUNK_HEADER_SIZE + payloadSize);
+}
+
+// Writes the samples collected so far, then their markers.
+static void flushChunk() {
+  if (chunkSampleCount) {
+    uint8_t *bytes = chunkBytes + CAPTURE_CHUNK_HEADER_SIZE;
+    // Two samples in three bytes, a lone last sample in two.
+    for (uint16_t i = 0; i < chunkSampleCount; i += 2) {
+      uint16_t s0 = chunkSamples[i];
+      uint16_t s1 = i + 1 < chunkSampleCount ? chunkSamples[i + 1] : 0;
+      *bytes++ = s0;
+      *bytes++ = (s0 >> 8) | (s1 << 4);
+      if (i + 1 < chunkSampleCount)
+        *bytes++ = s1 >> 4;
+    }
+    writeChunk(capture_samplesChunk_e, chunkSampleCount,
+               CAPTURE_SAMPLES_BYTES(chunkSampleCount));
+  }
+  if (chunkMarkerCount) {
+    memcpy(chunkBytes + CAPTURE_CHUNK_HEADER_SIZE, chunkMarkers,
+           chunkMarkerCount * CAPTURE_MARKER_SIZE);
+    writeChunk(capture_markersChunk_e, chunkMarkerCount,
+               chunkMarkerCount * CAPTURE_MARKER_SIZE);
+  }
+  chunkSampleCount = 0;
+  chunkMarkerCount = 0;
+  chunkFirstIndex = nextIndex;
+}
+
+// Writes the file header to the sink and starts recording.
+bool capture_start(capture_sink_t newSink) {
+  uint8_t header[CAPTURE_HEADER_SIZE] = {0};
+  memcpy(header, MAGIC, MAGIC_SIZE);
+  putLittle16(header + 4, CAPTURE_VERSION);
+  putLittle16(header + 6, CAPTURE_HEADER_SIZE);
+  putLittle32(header + 8, CAPTURE_SAMPLE_RATE);
+  header[12] = capture_adcUnipolar_e;
+  header[13] = CAPTURE_ADC_BITS;
+  strncpy((char *)header + 16, CAPTURE_BUILD_ID, CAPTURE_BUILD_SIZE - 1);
+
+  running = false;
+  sink = newSink;
+  head = tail = 0;
+  mailboxHead = mailboxTail = 0;
+  tick = 0;
+  dropping = false;
+  droppedSamples = droppedMarkers = 0;
+  nextIndex = chunkFirstIndex = 0;
+  chunkSampleCount = chunkMarkerCount = 0;
+  if (!sink(header, CAPTURE_HEADER_SIZE)) {
+    printf("capture: unable to write the header.\n");
+    return false;
+  }
+  running = true; // The ISR starts recording after everything is reset.
+  return true;
+}
+
+// Writes what is left in the ring and stops recording.
+void capture_stop() {
+  if (!running)
+    return;
+  capture_poll();
+  flushChunk();
+  running = false;
+}
+
+// True while recording.
+bool capture_running() { return running; }
+
+// Puts a marker entry in the ring if there is room.
+static void isrPutMarker(uint16_t entry) {
+  if (dropping || head - tail >= CAPTURE_RING_SIZE) {
+    droppedMarkers++;
+    return;
+  }
+  ring[head & RING_MASK] = entry;
+  head++;
+}
+
+// Called by isr_function() with every ADC sample.
+void capture_isrSample(uint16_t sample) {
+  if (!running)
+    return;
+  // Markers from the main loop go in front of this sample.
+  while (mailboxTail != mailboxHead) {
+    isrPutMarker(mailbox[mailboxTail & MAILBOX_MASK]);
+    mailboxTail++;
+  }
+  uint32_t space = CAPTURE_RING_SIZE - (head - tail);
+  if (dropping && space > RESYNC_LENGTH) {
+    // Tell capture_poll() which sample comes next, then carry on.
+    ring[head & RING_MASK] = RESYNC_ENTRY;
+    ring[(head + 1) & RING_MASK] = tick & HALF_MASK;
+    ring[(head + 2) & RING_MASK] = tick >> HALF_SHIFT;
+    head += RESYNC_LENGTH; // Publish after the entries are in place.
+    space -= RESYNC_LENGTH;
+    dropping = false;
+  }
+  if (dropping || space == 0) {
+    dropping = true;
+    droppedSamples++;
+  } else {
+    ring[head & RING_MASK] = sample & SAMPLE_MASK;
+    head++;
+  }
+  tick++;
+}
+
+// Adds a marker from a tick function, in front of the next sample.
+void capture_isrMark(capture_markerType_t type, uint8_t value) {
+  if (running)
+    isrPutMarker(MARKER_ENTRY | (type & MARKER_TYPE_MASK) << MARKER_TYPE_SHIFT |
+                 value);
+}
+
+// Adds a marker from the main loop, the ISR moves it into the ring.
+void capture_mark(capture_markerType_t type, uint8_t value) {
+  if (!running)
+    return;
+  if (mailboxHead - mailboxTail >= MAILBOX_SIZE) {
+    droppedMarkers++;
+    return;
+  }
+  mailbox[mailboxHead & MAILBOX_MASK] =
+      MARKER_ENTRY | (type & MARKER_TYPE_MASK) << MARKER_TYPE_SHIFT | value;
+  mailboxHead++;
+}
+
+// Adds a marker to the chunk, at the index of the next sample.
+static void addMarker(uint16_t entry) {
+  if (chunkMarkerCount == CAPTURE_CHUNK_MARKERS)
+    flushChunk();
+  uint8_t *marker = chunkMarkers[chunkMarkerCount++];
+  putLittle64(marker, nextIndex);
+  marker[8] = (entry >> MARKER_TYPE_SHIFT) & MARKER_TYPE_MASK;
+  marker[9] = entry & MARKER_VALUE_MASK;
+  putLittle16(marker + 10, 0);
+}
+
+// The 64-bit index of a 32-bit ISR tick at or after nextIndex.
+static uint64_t extendTick(uint32_t resumeTick) {
+  uint64_t index = (nextIndex & ~(uint64_t)UINT32_MAX) | resumeTick;
+  if (index < nextIndex)
+    index += (uint64_t)UINT32_MAX + 1;
+  return index;
+}
+
+// Moves samples and markers from the ring to the sink.
+void capture_poll() {
+  if (!running)
+    return;
+  uint32_t end = head; // Entries up to here are in place.
+  while (tail != end && running) {
+    uint16_t entry = ring[tail & RING_MASK];
+    switch (entry & ENTRY_KIND_MASK) {
+    case RESYNC_ENTRY: {
+      uint32_t low = ring[(tail + 1) & RING_MASK];
+      uint32_t high = ring[(tail + 2) & RING_MASK];
+      flushChunk(); // The samples chunk cannot have a hole in it.
+      nextIndex = extendTick(low | high << HALF_SHIFT);
+      chunkFirstIndex = nextIndex;
+      tail += RESYNC_LENGTH;
+      continue;
+    }
+    case MARKER_ENTRY:
+      addMarker(entry);
+      break;
+    default:
+      if (chunkSampleCount == CAPTURE_CHUNK_SAMPLES)
+        flushChunk();
+      chunkSamples[chunkSampleCount++] = entry;
+      nextIndex++;
+      break;
+    }
+    tail++; // Frees the entry for the ISR.
+  }
+}
+
+// Samples dropped because the ring was full.
+uint32_t capture_getDroppedSamples() { return droppedSamples; }
+
+// Markers dropped because the ring or the mailbox was full.
+uint32_t capture_getDroppedMarkers() { return droppedMarkers; }
@@ -0,0 +1,125 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef CAPTURE_H_
+#define CAPTURE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Records the raw ADC samples the detector sees, with markers for trigger
+// pulls and hits, so that a field session can be replayed and tuned on a PC.
+//
+// isr_function() hands every sample to capture_isrSample(), which only puts
+// it in a ring. The main loop calls capture_poll(), which packs the ring into
+// chunks and passes them to a sink (a file on the host, SD card or a stream
+// on the board). The ISR never waits for the sink: when the ring is full,
+// samples are dropped and the next chunk starts where recording resumed.
+//
+// Capture file format, all values little-endian:
+//
+// File header, CAPTURE_HEADER_SIZE bytes:
+//   0  char[4]   "LTCP"
+//   4  uint16    version (CAPTURE_VERSION)
+//   6  uint16    header size (CAPTURE_HEADER_SIZE)
+//   8  uint32    sample rate in Hz
+//   12 uint8     ADC mode (capture_adcMode_t)
+//   13 uint8     ADC bits per sample
+//   14 uint16    reserved, 0
+//   16 char[48]  firmware build, NUL-padded
+//
+// Then chunks, each a CAPTURE_CHUNK_HEADER_SIZE-byte header followed by
+// payload bytes:
+//   0  uint8     chunk type (capture_chunkType_t)
+//   1  uint8     reserved, 0
+//   2  uint16    count, samples or markers in the payload
+//   4  uint32    payload size in bytes
+//   8  uint64    index of the first sample (ISR ticks since capture_start())
+//
+// Samples chunk: count 12-bit samples at consecutive indexes, two packed in
+// three bytes (byte 0 = s0 bits 0-7, byte 1 = s0 bits 8-11 | s1 bits 0-3 << 4,
+// byte 2 = s1 bits 4-11). A jump in the index from one samples chunk to the
+// next is where samples were dropped.
+// Markers chunk: count CAPTURE_MARKER_SIZE-byte markers that belong to the
+// samples chunk before it:
+//   0  uint64    sample index, the marker happened just before this sample
+//   8  uint8     marker type (capture_markerType_t)
+//   9  uint8     value (frequency number for trigger pulls and hits)
+//   10 uint16    reserved, 0
+// Readers skip chunk types they do not know.
+
+#define CAPTURE_VERSION 1
+#define CAPTURE_HEADER_SIZE 64
+#define CAPTURE_BUILD_SIZE 48
+#define CAPTURE_CHUNK_HEADER_SIZE 16
+#define CAPTURE_MARKER_SIZE 12
+#define CAPTURE_SAMPLE_RATE 100000
+#define CAPTURE_ADC_BITS 12
+#define CAPTURE_CHUNK_SAMPLES 4096 // Most samples per chunk.
+#define CAPTURE_CHUNK_MARKERS 64   // Most markers per chunk.
+#define CAPTURE_RING_SIZE 16384    // Samples, 164 ms. Must be a power of two.
+// Bytes of a samples chunk payload.
+#define CAPTURE_SAMPLES_BYTES(count) (((count) * 3 + 1) / 2)
+
+// Firmware build written into the header. The build can override it with
+// -DCAPTURE_BUILD_ID=\"...\", e.g. with the git revision.
+#ifndef CAPTURE_BUILD_ID
+#define CAPTURE_BUILD_ID __DATE__ " " __TIME__
+#endif
+
+typedef enum {
+  capture_adcUnipolar_e = 0, // 0 .. 4095, the XADC as configured for the gun.
+} capture_adcMode_t;
+
+typedef enum {
+  capture_samplesChunk_e = 1,
+  capture_markersChunk_e = 2,
+} capture_chunkType_t;
+
+typedef enum {
+  capture_triggerMarker_e = 1, // A shot went out.
+  capture_hitMarker_e = 2,     // The detector reported a hit.
+  capture_userMarker_e = 3,    // Anything else worth finding later.
+} capture_markerType_t;
+
+// Receives the bytes of the capture, in order. Returns false if they could
+// not be stored, which stops the capture.
+typedef bool (*capture_sink_t)(const uint8_t *data, uint32_t size);
+
+// Writes the file header to the sink and starts recording. Returns false if
+// the header could not be written.
+bool capture_start(capture_sink_t sink);
+
+// Writes what is left in the ring and stops recording.
+void capture_stop();
+
+// True between capture_start() and capture_stop() (or a failed write).
+bool capture_running();
+
+// Called by isr_function() with every ADC sample.
+void capture_isrSample(uint16_t sample);
+
+// Adds a marker from a tick function, in front of the next sample.
+void capture_isrMark(capture_markerType_t type, uint8_t value);
+
+// Adds a marker from the main loop. It lands in front of the next sample the
+// ISR records. Markers are dropped if the main loop adds them faster than
+// the ISR takes them.
+void capture_mark(capture_markerType_t type, uint8_t value);
+
+// Moves samples and markers from the ring to the sink. Call it from the main
+// loop often enough that the ring (CAPTURE_RING_SIZE samples) does not fill.
+void capture_poll();
+
+// Samples and markers dropped because the ring or the marker mailbox was
+// full.
+uint32_t capture_getDroppedSamples();
+uint32_t capture_getDroppedMarkers();
+
+#endif /* CAPTURE_H_ */
@@ -12,8 +12,8 @@
 #include "trigger.h"
 #include "runningModes.h"
 
-#define SCALED_ADC_FACTOR 2047.5
-#define SCALED_ADC_RANGE 1
+#define SCALED_ADC_FACTOR DETECTOR_SCALED_ADC_FACTOR
+#define SCALED_ADC_RANGE DETECTOR_SCALED_ADC_RANGE
 #define INPUT_BEFORE_CALCULATION 10
 #define NUM_PLAYERS 10
 #define SET_TO_ZERO 0
@@ -26,135 +26,206 @@
 #define TOTAL_LIVES 1
 #define HITS_PER_LIFE 1
 #define FIVE_SECOND_DELAY 5000
+// CFAR noise floors follow the power with a time constant of 4096 decimated
+// samples (0.4 s, twice the power's window), or four times slower while it is
+// over the threshold.
+#define NOISE_FLOOR_RATE (1.0 / 4096)
+#define NOISE_FLOOR_SIGNAL_RATE (NOISE_FLOOR_RATE / 4)
 
-typedef uint16_t detector_hitCount_t;
-static uint32_t elementCount;
-static uint8_t sampleCnt;
-static bool hitDetected;
-static uint32_t frequencyDetected;
-static double powers[NUM_PLAYERS];
-static double fudgeFactors[FUDGE_FACTOR_ARRAY_SIZE] = {100, 450, 600, 800, 1000};
-static uint32_t fudgeFactorIndex;
-static bool ignoredSignals[NUM_PLAYERS];
-static detector_hitCount_t hitCounts[NUM_PLAYERS];
-static uint32_t invocationCount;
-static uint16_t lives;
-static uint16_t ownFrequency;
-static bool frozen;
-
-void hit_detect();
+static const double fudgeFactors[FUDGE_FACTOR_ARRAY_SIZE] = {100, 450, 600, 800, 1000};
+static detector_ctx_t defaultCtx;
+
+static void hit_detect(detector_ctx_t *ctx);
+static void learnNoiseFloors(detector_ctx_t *ctx);
 void detector_makeSounds();
 
-// Initialize the detector module.
-// By default, all frequencies are considered for hits.
-// Assumes the filter module is initialized previously.
-void detector_init(void) {
-    printf("initializing detector\n");
+/******************************************************
+****************** Context Functions ******************
+******************************************************/
+
+// Resets a context to the state detector_init() leaves the default one in,
+// except that the own frequency is DETECTOR_NO_OWN_FREQUENCY.
+void detector_ctxInit(detector_ctx_t *ctx, filter_ctx_t *filter,
+                      const detector_hooks_t *hooks) {
+    ctx->filter = filter;
+    ctx->hooks = hooks;
+    ctx->user = NULL;
     // Initialize arrays to all 0s
     for (uint16_t i = 0; i < NUM_PLAYERS; i++) {
-        ignoredSignals[i] = false;
-        hitCounts[i] = SET_TO_ZERO;
+        ctx->ignoredSignals[i] = false;
+        ctx->hitCounts[i] = SET_TO_ZERO;
     }
     // Initialize variables to zero
-    invocationCount = SET_TO_ZERO;
-    elementCount = SET_TO_ZERO;
-    sampleCnt = SET_TO_ZERO;
-    hitDetected = false;
-    fudgeFactorIndex = FUDGE_FACTOR;
-    lives = TOTAL_LIVES;
-    frozen = false;
+    ctx->invocationCount = SET_TO_ZERO;
+    ctx->lockoutSamples = SET_TO_ZERO;
+    ctx->sampleCnt = SET_TO_ZERO;
+    ctx->hitDetected = false;
+    ctx->frequencyDetected = SET_TO_ZERO;
+    ctx->fudgeFactorIndex = FUDGE_FACTOR;
+    ctx->fudgeFactor = fudgeFactors[FUDGE_FACTOR];
+    ctx->thresholdFactor = THRESHOLD_FACTOR;
+    ctx->decision = detector_medianDecision_e;
+    ctx->noiseFloorPrimed = false;
+    ctx->earlyDetection = false;
+    ctx->spectrum = NULL;
+    ctx->lives = TOTAL_LIVES;
+    ctx->frozen = false;
+    ctx->freezeOnHit = true;
+    ctx->ownFrequency = DETECTOR_NO_OWN_FREQUENCY;
+}
 
-    bool teamB = (runningModes_getFrequencySetting() % 2);
-    // set transmitter frequency
-    if(teamB) {
-        ownFrequency = 8;
+// True while hits are locked out, from the hook if there is one.
+static bool lockoutRunning(detector_ctx_t *ctx) {
+    if (ctx->hooks && ctx->hooks->lockoutRunning)
+        return ctx->hooks->lockoutRunning(ctx);
+    return ctx->lockoutSamples > 0;
+}
+
+// Feeds one raw ADC sample through the filters. Every tenth sample the power
+// is updated and hit detection runs.
+void detector_ctxAddSample(detector_ctx_t *ctx, uint32_t rawAdcValue) {
+    double scaledAdcValue = (((double)rawAdcValue / SCALED_ADC_FACTOR) - SCALED_ADC_RANGE);
+    // printf("scaled value: %f\n", scaledAdcValue);
+    filter_ctxAddNewInput(ctx->filter, scaledAdcValue);
+    ctx->sampleCnt++;
+    // This is where the decimation happens, every tenth sample
+    if (ctx->sampleCnt == INPUT_BEFORE_CALCULATION) {
+        ctx->sampleCnt = SET_TO_ZERO;           // Reset the sample count.
+        double firOutput = filter_ctxFirFilter(ctx->filter); // Runs the FIR filter, output goes in the y-queue.
+        // Run all the IIR filters and compute power in each of the output
+        // queues, unless the filter's energy gate is closed. Hit detection
+        // still runs to count down the lockout; while the gate is closed the
+        // power values stay at their quiet levels. With an FFT engine, its
+        // band powers replace the IIR filters' after every FFT and stay until
+        // the next one.
+        if (!ctx->spectrum)
+            filter_ctxRunIirBank(ctx->filter);
+        else if (spectrum_ctxAddSample(ctx->spectrum, firOutput))
+            spectrum_ctxSetFilterPowers(ctx->spectrum, ctx->filter);
+        detector_ctxDetectHit(ctx);
     }
-    else {
-        ownFrequency = 4;
+}
+
+// Runs hit detection on the current power values of the context's filter.
+// Called once per decimated sample.
+void detector_ctxDetectHit(detector_ctx_t *ctx) {
+    // The built-in lockout counts down in decimated samples.
+    if (ctx->lockoutSamples > 0)
+        ctx->lockoutSamples--;
+    // This determines if it has been enough time since the last hit we detected
+    if (!lockoutRunning(ctx)) {
+        hit_detect(ctx);
+    }
+    else if (ctx->decision == detector_cfarDecision_e) {
+        learnNoiseFloors(ctx);
     }
 }
 
-// freqArray is indexed by frequency number. If an element is set to true,
-// the frequency will be ignored. Multiple frequencies can be ignored.
-// Your shot frequency (based on the switches) is a good choice to ignore.
-void detector_setIgnoredFrequencies(bool freqArray[]) {
-    // Iterate through the array to see what frequencies are true or false
+// Same as detector() for a context, with the samples passed in.
+void detector_ctxRun(detector_ctx_t *ctx, const uint32_t samples[],
+                     uint32_t sampleCount) {
+    ctx->invocationCount++;
+    for (uint32_t i = 0; i < sampleCount; i++)
+        detector_ctxAddSample(ctx, samples[i]);
+}
+
+// Records a hit that froze or unfroze the player and starts the lockout.
+static void recordHit(detector_ctx_t *ctx, bool frozen) {
+    ctx->hitDetected = true;
+    ctx->frozen = frozen;
+    ctx->lives = frozen ? 0 : TOTAL_LIVES;
+    ctx->hitCounts[ctx->frequencyDetected]++;
+    if (!ctx->hooks || !ctx->hooks->lockoutRunning)
+        ctx->lockoutSamples = DETECTOR_LOCKOUT_SAMPLES;
+    if (ctx->hooks && ctx->hooks->hitHandler)
+        ctx->hooks->hitHandler(ctx);
+}
+
+// CFAR thresholds: every frequency's is fudgeFactor * the larger of its noise
+// floor and the weakest power. The weakest rises with anything that raises
+// every frequency, and unlike a mean or the median it stays down with up to
+// eight sources at once.
+static void cfarThresholds(const detector_ctx_t *ctx,
+                           const double powerValues[], double thresholds[]) {
+    double weakest = powerValues[0];
+    for (uint16_t i = 1; i < NUM_PLAYERS; i++) {
+        if (powerValues[i] < weakest) {
+            weakest = powerValues[i];
+        }
+    }
     for (uint16_t i = 0; i < NUM_PLAYERS; i++) {
-        ignoredSignals[i] = freqArray[i];
+        double floor = ctx->noiseFloorPrimed ? ctx->noiseFloor[i] : 0;
+        double reference = floor > weakest ? floor : weakest;
+        thresholds[i] = reference * ctx->fudgeFactor + ctx->thresholdFactor;
     }
 }
 
-// Runs the entire detector: decimating FIR-filter, IIR-filters,
-// power-computation, hit-detection. If interruptsCurrentlyEnabled = true,
-// interrupts are running. If interruptsCurrentlyEnabled = false you can pop
-// values from the ADC buffer without disabling interrupts. If
-// interruptsCurrentlyEnabled = true, do the following:
-// 1. disable interrupts.
-// 2. pop the value from the ADC buffer.
-// 3. re-enable interrupts.
-// Ignore hits on frequencies specified with detector_setIgnoredFrequencies().
-// Assumption: draining the ADC buffer occurs faster than it can fill.
-void detector(bool interruptsCurrentlyEnabled) {
-    invocationCount++;
-    elementCount = buffer_elements();
-    uint32_t rawAdcValue;
-    // Iterate through each item in the buffer
-    for (uint32_t i = 0; i < elementCount; i++) {
-        // Get the rawAdcValue if interrupts are enabled
-        if (interruptsCurrentlyEnabled) {
-            interrupts_disableArmInts();
-            rawAdcValue = buffer_pop();
-            interrupts_enableArmInts();
-            // printf("raw value: %d\n", rawAdcValue);
-        }
-        // Get adcvalue withoug diabling interrupts
-        else {
-            rawAdcValue = buffer_pop();
-            // printf("raw value: %d\n", rawAdcValue);
+// Moves every CFAR noise floor toward its power, slowly where the power is
+// over its threshold so a shot barely raises it.
+static void updateNoiseFloors(detector_ctx_t *ctx, const double powerValues[],
+                              const double thresholds[]) {
+    for (uint16_t i = 0; i < NUM_PLAYERS; i++) {
+        double rate = powerValues[i] > thresholds[i] ? NOISE_FLOOR_SIGNAL_RATE
+                                                     : NOISE_FLOOR_RATE;
+        double *noiseFloor = &ctx->noiseFloor[i];
+        *noiseFloor = ctx->noiseFloorPrimed
+                          ? *noiseFloor + rate * (powerValues[i] - *noiseFloor)
+                          : powerValues[i];
+    }
+    ctx->noiseFloorPrimed = true;
+}
+
+// The noise floors are updated during the lockout as well, or a steady source
+// over the threshold would hit, lock out and hit again without ever being
+// learned.
+static void learnNoiseFloors(detector_ctx_t *ctx) {
+    double powerValues[NUM_PLAYERS];
+    double thresholds[NUM_PLAYERS];
+    for (uint16_t i = 0; i < NUM_PLAYERS; i++) {
+        powerValues[i] = filter_ctxGetCurrentPowerValue(ctx->filter, i);
+    }
+    cfarThresholds(ctx, powerValues, thresholds);
+    updateNoiseFloors(ctx, powerValues, thresholds);
+}
+
+// CFAR decision: the strongest frequency over its threshold, or the strongest
+// of all if none is. Returns its threshold.
+static double cfarDetect(detector_ctx_t *ctx, const double powerValues[],
+                          uint16_t *detected) {
+    double thresholds[NUM_PLAYERS];
+    cfarThresholds(ctx, powerValues, thresholds);
+    uint16_t strongest = 0;
+    bool found = false;
+    for (uint16_t i = 0; i < NUM_PLAYERS; i++) {
+        if (powerValues[i] > powerValues[strongest]) {
+            strongest = i;
         }
-        double scaledAdcValue = (((double)rawAdcValue / SCALED_ADC_FACTOR) - SCALED_ADC_RANGE);
-        // printf("scaled value: %f\n", scaledAdcValue);
-        filter_addNewInput(scaledAdcValue);
-        sampleCnt++;
-        // This is where the decimation happens, every tenth sample
-        if (sampleCnt == INPUT_BEFORE_CALCULATION) {
-            uint16_t filterNumber;
-            sampleCnt = SET_TO_ZERO;                // Reset the sample count.
-            filter_firFilter();                     // Runs the FIR filter, output goes in the y-queue.
-            // Run all the IIR filters and compute power in each of the output queues.
-            for (filterNumber = 0; filterNumber < FILTER_FREQUENCY_COUNT; filterNumber++) {
-                filter_iirFilter(filterNumber);     // Run each of the IIR filters.
-                // Compute the power for each of the filters, at lowest computational cost.
-                // 1st false means do not compute from scratch.
-                // 2nd false means no debug prints.
-                filter_computePower(filterNumber, false, false);
-            }
-            // This determines if it has been enough time since the last hit we detected
-            if (!lockoutTimer_running()) {
-                hit_detect();
-            }
+        if (powerValues[i] > thresholds[i] &&
+            (!found || powerValues[i] > powerValues[*detected])) {
+            *detected = i;
+            found = true;
         }
     }
+    if (!found) {
+        *detected = strongest;
+    }
+    updateNoiseFloors(ctx, powerValues, thresholds);
+    return thresholds[*detected];
 }
 
-// Helpter function that implements the algorithm to detect a hit
-void hit_detect() {
-    // printf("detecting hit\n");
+// Median rule: returns the median of the power values and the index of the
+// strongest in *strongest.
+static double medianPower(const double powerValues[], uint16_t *strongest) {
     double tempArrayValues[NUM_PLAYERS];            // Create a temporary array of power values
     uint16_t tempArrayIndeces[NUM_PLAYERS];         // Create a temporary array of indeces to keep track of the player with highest power
-    // Initialize the index array with index values
-    for (uint8_t i = 0; i < NUM_PLAYERS; i++) {    
+
+    // Initialize the arrays with the power values and their index values
+    for (uint8_t i = 0; i < NUM_PLAYERS; i++) {
+        tempArrayValues[i] = powerValues[i];
         tempArrayIndeces[i] = i;
     }
 
     uint16_t minIndex = SET_TO_ZERO;
-    uint16_t lowestValue = SET_TO_ZERO;
-
-    // This returns the power values from the array
-    for(uint16_t i = 0; i < NUM_PLAYERS; i++) {
-        tempArrayValues[i] = filter_getCurrentPowerValue(i);
-        // printf("%f\n", tempArrayValues[i]);
-    }
 
     // This is the algorithm to get the array in order from lowest power to highest power
     for (uint16_t i = 0; i < MAX_ARRAY_INDEX; i++) {
@@ -169,108 +240,347 @@ void hit_detect() {
         double temp1 = tempArrayValues[i];
         tempArrayValues[i] = tempArrayValues[minIndex];
         tempArrayValues[minIndex] = temp1;
-        
+
         uint16_t temp2 = tempArrayIndeces[i];
         tempArrayIndeces[i] = tempArrayIndeces[minIndex];
         tempArrayIndeces[minIndex] = temp2;
     }
 
-    // Calculate the median power value and threshold power
-    frequencyDetected = tempArrayIndeces[MAX_ARRAY_INDEX];
-    double median = tempArrayValues[MEDIAN_INDEX];
-    double threshold = median*fudgeFactors[fudgeFactorIndex] + THRESHOLD_FACTOR;
-   
+    *strongest = tempArrayIndeces[MAX_ARRAY_INDEX];
+    return tempArrayValues[MEDIAN_INDEX];
+}
+
+// Early detection: the strongest frequency of a shorter power window, scaled
+// up to the length of the whole window, passes DETECTOR_EARLY_STRICTNESS
+// times the median rule's threshold for that window, and the whole window
+// confirms it: the same frequency is the strongest there and over
+// median * fudgeFactor. Returns true and sets frequencyDetected if a window
+// passes, shortest first.
+static bool earlyDetect(detector_ctx_t *ctx, const double powerValues[]) {
+    uint16_t strongest;
+    double median = medianPower(powerValues, &strongest);
+    if (!(powerValues[strongest] > median * ctx->fudgeFactor)) {
+        return false;
+    }
+    double windowValues[NUM_PLAYERS];
+    for (uint16_t w = 0; w < FILTER_WHOLE_POWER_WINDOW; w++) {
+        filter_ctxGetWindowPowerValues(ctx->filter, w, windowValues);
+        double scale = (double)filter_powerWindowSizes[FILTER_WHOLE_POWER_WINDOW] /
+                       filter_powerWindowSizes[w];
+        uint16_t windowStrongest;
+        double windowMedian = medianPower(windowValues, &windowStrongest);
+        double threshold = (windowMedian * scale * ctx->fudgeFactor + ctx->thresholdFactor) *
+                           DETECTOR_EARLY_STRICTNESS;
+        if (windowStrongest == strongest && windowValues[strongest] * scale > threshold) {
+            ctx->frequencyDetected = strongest;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Helpter function that implements the algorithm to detect a hit
+static void hit_detect(detector_ctx_t *ctx) {
+    // printf("detecting hit\n");
+    double tempArrayValues[NUM_PLAYERS];            // Create a temporary array of power values
+    double maxPower;
+    double threshold;
+
+    // This returns the power values from the array
+    for(uint16_t i = 0; i < NUM_PLAYERS; i++) {
+        tempArrayValues[i] = filter_ctxGetCurrentPowerValue(ctx->filter, i);
+        // printf("%f\n", tempArrayValues[i]);
+    }
+
+    if (ctx->decision == detector_cfarDecision_e) {
+        uint16_t detected;
+        threshold = cfarDetect(ctx, tempArrayValues, &detected);
+        ctx->frequencyDetected = detected;
+        maxPower = tempArrayValues[detected];
+    }
+    else {
+        // Calculate the median power value and threshold power
+        uint16_t strongest;
+        double median = medianPower(tempArrayValues, &strongest);
+        ctx->frequencyDetected = strongest;
+        threshold = median*ctx->fudgeFactor + ctx->thresholdFactor;
+        maxPower = tempArrayValues[strongest];
+    }
+
+    bool overThreshold = maxPower > threshold;
+    if (!overThreshold && ctx->earlyDetection) {
+        overThreshold = earlyDetect(ctx, tempArrayValues);
+    }
 
     // Determine whether a player hit us or not and what player it was
-    if((tempArrayValues[MAX_ARRAY_INDEX] > threshold) && !ignoredSignals[frequencyDetected] && !lockoutTimer_running()) {
-        if(frozen) {
-            if(frequencyDetected == ownFrequency) {
-                lives = TOTAL_LIVES;
-                hitDetected = true;
-                trigger_enable();
-                hitLedTimer_start();
-                lockoutTimer_start();
-                sound_setSound(sound_gameStart_e);
-                sound_startSound();
-                hitCounts[frequencyDetected]++;
-                frozen = false;
+    if(overThreshold && !ctx->ignoredSignals[ctx->frequencyDetected] && !lockoutRunning(ctx)) {
+        // Only your own team can unfreeze you, and only the other team can
+        // freeze you.
+        if(ctx->frozen) {
+            if(ctx->frequencyDetected == ctx->ownFrequency) {
+                recordHit(ctx, false);
             }
         }
         else {
-            if(frequencyDetected != ownFrequency) {
-                lives = 0;
-                hitDetected = true;
-                frozen = true;
-                lockoutTimer_start();
-                hitLedTimer_start();
-                sound_setSound(sound_loseLife_e);
-                sound_startSound();
-                trigger_disable();
-                hitCounts[frequencyDetected]++;
+            if(ctx->frequencyDetected != ctx->ownFrequency) {
+                recordHit(ctx, ctx->freezeOnHit);
             }
         }
         
     }
     //Otherwise hitDetected is false
     else {
-        hitDetected = false;
+        ctx->hitDetected = false;
+    }
+}
+
+// freqArray is indexed by frequency number. If an element is set to true,
+// the frequency will be ignored.
+void detector_ctxSetIgnoredFrequencies(detector_ctx_t *ctx, bool freqArray[]) {
+    // Iterate through the array to see what frequencies are true or false
+    for (uint16_t i = 0; i < NUM_PLAYERS; i++) {
+        ctx->ignoredSignals[i] = freqArray[i];
+    }
+}
+
+// Returns true if a hit was detected.
+bool detector_ctxHitDetected(detector_ctx_t *ctx) {
+    return ctx->hitDetected;
+}
+
+// Returns the frequency number that caused the hit.
+uint16_t detector_ctxGetFrequencyNumberOfLastHit(detector_ctx_t *ctx) {
+    return ctx->frequencyDetected;
+}
+
+// Clear the detected hit once you have accounted for it.
+void detector_ctxClearHit(detector_ctx_t *ctx) {
+    ctx->hitDetected = false;
+}
+
+// Ignore all hits if the flag is true, otherwise respond to hits normally.
+void detector_ctxIgnoreAllHits(detector_ctx_t *ctx, bool flagValue) {
+    // Iterate throufh players to set if they are ignored or not
+    for (uint16_t i = 0; i < NUM_PLAYERS; i++) {
+        ctx->ignoredSignals[i] = flagValue;
+    }
+}
+
+// Copy the current hit counts into the user-provided hitArray.
+void detector_ctxGetHitCounts(detector_ctx_t *ctx, detector_hitCount_t hitArray[]) {
+    // Iterate throughplayers and return hit counts
+    for(uint16_t i = 0; i < NUM_PLAYERS; i++) {
+        hitArray[i] = ctx->hitCounts[i];
+    }
+}
+
+// Selects one of the fudge factors in fudgeFactors[].
+void detector_ctxSetFudgeFactorIndex(detector_ctx_t *ctx, uint32_t factor) {
+    if (factor >= FUDGE_FACTOR_ARRAY_SIZE)
+        return;
+    ctx->fudgeFactorIndex = factor;
+    ctx->fudgeFactor = fudgeFactors[factor];
+}
+
+// Sets the threshold parameters directly.
+void detector_ctxSetThreshold(detector_ctx_t *ctx, double fudgeFactor,
+                              double thresholdFactor) {
+    ctx->fudgeFactor = fudgeFactor;
+    ctx->thresholdFactor = thresholdFactor;
+}
+
+// Selects the median rule or CFAR.
+void detector_ctxSetDecision(detector_ctx_t *ctx, detector_decision_t decision) {
+    ctx->decision = decision;
+    ctx->noiseFloorPrimed = false;
+}
+
+// Turns early detection on or off, with the filter's shorter power windows.
+void detector_ctxSetEarlyDetection(detector_ctx_t *ctx, bool enabled) {
+    ctx->earlyDetection = enabled;
+    filter_ctxSetPowerWindows(ctx->filter, enabled);
+}
+
+// Runs the detector on an FFT engine instead of the IIR filters.
+void detector_ctxSetSpectrum(detector_ctx_t *ctx, spectrum_ctx_t *spectrum) {
+    ctx->spectrum = spectrum;
+}
+
+// Hits freeze the player (the default) or are only counted.
+void detector_ctxSetFreezeOnHit(detector_ctx_t *ctx, bool freezeOnHit) {
+    ctx->freezeOnHit = freezeOnHit;
+}
+
+// Returns the number of detector_ctxRun() (or detector()) calls.
+uint32_t detector_ctxGetInvocationCount(detector_ctx_t *ctx) {
+    return ctx->invocationCount;
+}
+
+uint16_t detector_ctxGetLives(detector_ctx_t *ctx) {
+    return ctx->lives;
+}
+
+void detector_ctxSetOwnFrequency(detector_ctx_t *ctx, uint16_t playerNum) {
+    ctx->ownFrequency = playerNum;
+}
+
+/******************************************************
+*************** Default Context Functions *************
+******************************************************/
+
+// The default context drives the gun itself.
+static bool defaultLockoutRunning(detector_ctx_t *ctx) {
+    (void)ctx; // There is only one lockout timer.
+    return lockoutTimer_running();
+}
+
+// Flashes the hit LED, plays the sound and only lets unfrozen players shoot.
+static void defaultHitHandler(detector_ctx_t *ctx) {
+    if (ctx->frozen) {
+        lockoutTimer_start();
+        hitLedTimer_start();
+        sound_setSound(sound_loseLife_e);
+        sound_startSound();
+        trigger_disable();
+    }
+    else {
+        trigger_enable();
+        hitLedTimer_start();
+        lockoutTimer_start();
+        sound_setSound(sound_gameStart_e);
+        sound_startSound();
+    }
+}
+
+static const detector_hooks_t defaultHooks = {
+    .lockoutRunning = defaultLockoutRunning,
+    .hitHandler = defaultHitHandler,
+};
+
+// Initialize the detector module.
+// By default, all frequencies are considered for hits.
+// Assumes the filter module is initialized previously.
+void detector_init(void) {
+    printf("initializing detector\n");
+    detector_ctxInit(&defaultCtx, filter_getDefaultCtx(), &defaultHooks);
+
+    bool teamB = (runningModes_getFrequencySetting() % 2);
+    // set transmitter frequency
+    if(teamB) {
+        defaultCtx.ownFrequency = 8;
+    }
+    else {
+        defaultCtx.ownFrequency = 4;
+    }
+}
+
+// freqArray is indexed by frequency number. If an element is set to true,
+// the frequency will be ignored. Multiple frequencies can be ignored.
+// Your shot frequency (based on the switches) is a good choice to ignore.
+void detector_setIgnoredFrequencies(bool freqArray[]) {
+    detector_ctxSetIgnoredFrequencies(&defaultCtx, freqArray);
+}
+
+// Runs the entire detector: decimating FIR-filter, IIR-filters,
+// power-computation, hit-detection. If interruptsCurrentlyEnabled = true,
+// interrupts are running. If interruptsCurrentlyEnabled = false you can pop
+// values from the ADC buffer without disabling interrupts. If
+// interruptsCurrentlyEnabled = true, do the following:
+// 1. disable interrupts.
+// 2. pop the value from the ADC buffer.
+// 3. re-enable interrupts.
+// Ignore hits on frequencies specified with detector_setIgnoredFrequencies().
+// Assumption: draining the ADC buffer occurs faster than it can fill.
+void detector(bool interruptsCurrentlyEnabled) {
+    defaultCtx.invocationCount++;
+    uint32_t elementCount = buffer_elements();
+    uint32_t rawAdcValue;
+    // Iterate through each item in the buffer
+    for (uint32_t i = 0; i < elementCount; i++) {
+        // Get the rawAdcValue if interrupts are enabled
+        if (interruptsCurrentlyEnabled) {
+            interrupts_disableArmInts();
+            rawAdcValue = buffer_pop();
+            interrupts_enableArmInts();
+            // printf("raw value: %d\n", rawAdcValue);
+        }
+        // Get adcvalue withoug diabling interrupts
+        else {
+            rawAdcValue = buffer_pop();
+            // printf("raw value: %d\n", rawAdcValue);
+        }
+        detector_ctxAddSample(&defaultCtx, rawAdcValue);
     }
 }
 
 // Returns true if a hit was detected.
 bool detector_hitDetected(void) {
-    return hitDetected;
+    return detector_ctxHitDetected(&defaultCtx);
 }
 
 // Returns the frequency number that caused the hit.
 uint16_t detector_getFrequencyNumberOfLastHit(void) {
-    return frequencyDetected;
+    return detector_ctxGetFrequencyNumberOfLastHit(&defaultCtx);
 }
 
 // Clear the detected hit once you have accounted for it.
 void detector_clearHit(void) {
-    hitDetected = false;
+    detector_ctxClearHit(&defaultCtx);
 }
 
 // Ignore all hits. Used to provide some limited invincibility in some game
 // modes. The detector will ignore all hits if the flag is true, otherwise will
 // respond to hits normally.
 void detector_ignoreAllHits(bool flagValue) {
-    // Iterate throufh players to set if they are ignored or not
-    for (uint16_t i = 0; i < NUM_PLAYERS; i++) {
-        ignoredSignals[i] = flagValue;
-    }
+    detector_ctxIgnoreAllHits(&defaultCtx, flagValue);
 }
 
 // Get the current hit counts.
 // Copy the current hit counts into the user-provided hitArray
 // using a for-loop.
 void detector_getHitCounts(detector_hitCount_t hitArray[]) {
-    // Iterate throughplayers and return hit counts
-    for(uint16_t i = 0; i < NUM_PLAYERS; i++) {
-        hitArray[i] = hitCounts[i];
-    }
+    detector_ctxGetHitCounts(&defaultCtx, hitArray);
 }
 
 // Allows the fudge-factor index to be set externally from the detector.
 // The actual values for fudge-factors is stored in an array found in detector.c
 void detector_setFudgeFactorIndex(uint32_t factor) {
-    fudgeFactorIndex = factor;
+    detector_ctxSetFudgeFactorIndex(&defaultCtx, factor);
+}
+
+// Selects how the threshold is set.
+void detector_setDecision(detector_decision_t decision) {
+    detector_ctxSetDecision(&defaultCtx, decision);
+}
+
+// Turns early detection on or off, see detector_ctxSetEarlyDetection().
+void detector_setEarlyDetection(bool enabled) {
+    detector_ctxSetEarlyDetection(&defaultCtx, enabled);
+}
+
+// Runs the detector on an FFT instead of the IIR filters.
+void detector_setSpectrum(spectrum_ctx_t *spectrum) {
+    detector_ctxSetSpectrum(&defaultCtx, spectrum);
 }
 
 // Returns the detector invocation count.
 // The count is incremented each time detector is called.
 // Used for run-time statistics.
 uint32_t detector_getInvocationCount(void) {
-    return invocationCount;
+    return detector_ctxGetInvocationCount(&defaultCtx);
 }
 
 uint16_t detector_getLives() {
-    return lives;
+    return detector_ctxGetLives(&defaultCtx);
 }
 
 void detector_setOwnFrequency(uint16_t playerNum) {
-    ownFrequency = playerNum;
+    detector_ctxSetOwnFrequency(&defaultCtx, playerNum);
+}
+
+// Returns the default context used by the functions without a context.
+detector_ctx_t *detector_getDefaultCtx(void) {
+    return &defaultCtx;
 }
 
 
@@ -293,7 +603,7 @@ void detector_runTest(void) {
     //     filter_setCurrentPowerValue(i, testData1[i]);
     // }
 
-    // hit_detect();
+    // hit_detect(&defaultCtx);
     // bool result1 = detector_hitDetected();
     // //setting our second test double
     // double testData2[NUM_PLAYERS] = {10, 20, 15, 10, 15, 10, 20, 15, 10, 15};
@@ -302,7 +612,7 @@ void detector_runTest(void) {
     //     filter_setCurrentPowerValue(i, testData2[i]);
     // }
 
-    // hit_detect();
+    // hit_detect(&defaultCtx);
     // bool result2 = detector_hitDetected();
 
     // printf("Result 1: %d\n", result1);
@@ -314,13 +624,13 @@ void detector_runTest(void) {
 void detector_makeSounds()
 {
     // As long as we have not lost a life play the hit sound
-    if((lives % HITS_PER_LIFE)!=0) {
+    if((defaultCtx.lives % HITS_PER_LIFE)!=0) {
         sound_setSound(sound_hit_e);
         sound_startSound();
     }
     else {
         // If we have not lost all of our lives play the lost a life sound when 
-        if(lives != 0) {
+        if(defaultCtx.lives != 0) {
             sound_setSound(sound_loseLife_e);
             sound_startSound();
             trigger_disable();
@@ -328,9 +638,9 @@ void detector_makeSounds()
             bool ignoredSignalsCopy[NUM_PLAYERS];
             //setting what ignored signals are based off input array
             for(uint16_t i = 0; i < NUM_PLAYERS; i++) {
-                ignoredSignalsCopy[i] = ignoredSignals[i];
-                if(ignoredSignals[i] == false) 
-                    ignoredSignals[i] = true;
+                ignoredSignalsCopy[i] = defaultCtx.ignoredSignals[i];
+                if(defaultCtx.ignoredSignals[i] == false) 
+                    defaultCtx.ignoredSignals[i] = true;
             }
             // 5 second delay before you can shoot again
             utils_msDelay(FIVE_SECOND_DELAY);
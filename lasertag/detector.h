@@ -14,8 +14,93 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "filter.h"
+#include "lockoutTimer.h"
+#include "spectrum.h"
+
 typedef uint16_t detector_hitCount_t;
 
+// Raw 12-bit ADC values are scaled to -1.0 .. 1.0 before they are filtered:
+// raw / DETECTOR_SCALED_ADC_FACTOR - DETECTOR_SCALED_ADC_RANGE.
+#define DETECTOR_SCALED_ADC_FACTOR 2047.5
+#define DETECTOR_SCALED_ADC_RANGE 1
+
+// Every frequency shoots you when this is the own frequency.
+#define DETECTOR_NO_OWN_FREQUENCY FILTER_FREQUENCY_COUNT
+
+// Hits are locked out for this many decimated samples by contexts that do not
+// have a lockoutRunning hook (same 1/2 second as the lockoutTimer).
+#define DETECTOR_LOCKOUT_SAMPLES \
+  (LOCKOUT_TIMER_EXPIRE_VALUE / FILTER_FIR_DECIMATION_FACTOR)
+
+// A fudge factor for the CFAR decision (detector_cfarDecision_e): it compares
+// a frequency to its own noise floor rather than to the median of all ten, so
+// it needs a far smaller factor than fudgeFactors[]. From detectorSweep.
+#define DETECTOR_CFAR_FUDGE_FACTOR 5
+
+// Early detection (detector_ctxSetEarlyDetection()) holds the shorter power
+// windows to this many times the threshold, because their power is noisier.
+#define DETECTOR_EARLY_STRICTNESS 4
+
+typedef struct detector_ctx detector_ctx_t;
+
+// How hit detection sets the threshold a frequency's power must pass.
+typedef enum {
+  // fudgeFactor * the median power of the ten frequencies, sorted every
+  // decimated sample.
+  detector_medianDecision_e,
+  // CFAR (constant false-alarm rate): every frequency has its own threshold,
+  // fudgeFactor * the larger of its noise floor, a running average of its
+  // power, and the weakest power of the ten. No sorting, and each floor is
+  // updated in constant time. Power over the threshold moves the floor only
+  // slowly, so a shot barely raises its own threshold while a steady source,
+  // a beacon or a lamp, is learned in a few seconds and then ignored.
+  detector_cfarDecision_e,
+} detector_decision_t;
+
+// Connects a detector context to the rest of the gun. Either function may be
+// NULL.
+typedef struct {
+  // Returns true while hits are locked out. When NULL the context keeps its
+  // own lockout of DETECTOR_LOCKOUT_SAMPLES after every hit.
+  bool (*lockoutRunning)(detector_ctx_t *ctx);
+  // Called after every hit, ctx->frozen says whether it froze or unfroze the
+  // player.
+  void (*hitHandler)(detector_ctx_t *ctx);
+} detector_hooks_t;
+
+// Everything one detector needs between samples. The detector_ctx...
+// functions below only touch the context they are given (and its filter
+// context), so simulators, replay tools and servers can run many independent
+// detectors, each on its own thread if need be. The functions without a
+// context work on a default context that runs on the filter module's default
+// context and drives the lockout timer, hit LED, trigger and sounds.
+struct detector_ctx {
+  filter_ctx_t *filter;
+  const detector_hooks_t *hooks;
+  void *user; // Free for the owner of the context, e.g. for the hooks.
+  uint8_t sampleCnt;
+  bool hitDetected;
+  uint32_t frequencyDetected;
+  uint32_t fudgeFactorIndex;
+  double fudgeFactor;     // The threshold is the reference power (see
+  double thresholdFactor; // detector_decision_t) * fudgeFactor +
+                          // thresholdFactor.
+  detector_decision_t decision;
+  double noiseFloor[FILTER_FREQUENCY_COUNT]; // CFAR, per frequency.
+  bool noiseFloorPrimed; // The floors start at the first power values.
+  bool earlyDetection;
+  spectrum_ctx_t *spectrum; // Instead of the IIR filters, if not NULL.
+  bool ignoredSignals[FILTER_FREQUENCY_COUNT];
+  detector_hitCount_t hitCounts[FILTER_FREQUENCY_COUNT];
+  uint32_t invocationCount;
+  uint32_t lockoutSamples; // Left in the lockout, when there is no hook.
+  uint16_t lives;
+  uint16_t ownFrequency;
+  bool frozen;
+  bool freezeOnHit; // See detector_ctxSetFreezeOnHit().
+};
+
 // Initialize the detector module.
 // By default, all frequencies are considered for hits.
 // Assumes the filter module is initialized previously.
@@ -61,6 +146,16 @@ void detector_getHitCounts(detector_hitCount_t hitArray[]);
 // The actual values for fudge-factors is stored in an array found in detector.c
 void detector_setFudgeFactorIndex(uint32_t factor);
 
+// Selects how the threshold is set, see detector_decision_t.
+void detector_setDecision(detector_decision_t decision);
+
+// Turns early detection on or off, see detector_ctxSetEarlyDetection().
+void detector_setEarlyDetection(bool enabled);
+
+// Runs the detector on an FFT instead of the IIR filters, see
+// detector_ctxSetSpectrum().
+void detector_setSpectrum(spectrum_ctx_t *spectrum);
+
 // Returns the detector invocation count.
 // The count is incremented each time detector is called.
 // Used for run-time statistics.
@@ -80,4 +175,74 @@ uint16_t detector_getLives();
 
 void detector_setOwnFrequency(uint16_t playerNum);
 
+/******************************************************
+****************** Context Functions ******************
+******************************************************/
+
+// Resets a context to the state detector_init() leaves the default one in,
+// except that the own frequency is DETECTOR_NO_OWN_FREQUENCY. filter must
+// have been initialized with filter_ctxInit(). hooks may be NULL.
+void detector_ctxInit(detector_ctx_t *ctx, filter_ctx_t *filter,
+                      const detector_hooks_t *hooks);
+
+// Feeds one raw ADC sample through the filters. Every tenth sample the power
+// is updated and hit detection runs.
+void detector_ctxAddSample(detector_ctx_t *ctx, uint32_t rawAdcValue);
+
+// Runs hit detection on the current power values of the context's filter.
+// detector_ctxAddSample() calls this once per decimated sample. Call it
+// directly when the power values are computed elsewhere and stored with
+// filter_ctxSetCurrentPowerValue().
+void detector_ctxDetectHit(detector_ctx_t *ctx);
+
+// Same as detector() for a context, with the samples passed in instead of
+// popped from the ADC buffer.
+void detector_ctxRun(detector_ctx_t *ctx, const uint32_t samples[],
+                     uint32_t sampleCount);
+
+// Same as the functions without a context, see above.
+void detector_ctxSetIgnoredFrequencies(detector_ctx_t *ctx, bool freqArray[]);
+bool detector_ctxHitDetected(detector_ctx_t *ctx);
+uint16_t detector_ctxGetFrequencyNumberOfLastHit(detector_ctx_t *ctx);
+void detector_ctxClearHit(detector_ctx_t *ctx);
+void detector_ctxIgnoreAllHits(detector_ctx_t *ctx, bool flagValue);
+void detector_ctxGetHitCounts(detector_ctx_t *ctx,
+                              detector_hitCount_t hitArray[]);
+void detector_ctxSetFudgeFactorIndex(detector_ctx_t *ctx, uint32_t factor);
+// Sets the threshold to the reference power * fudgeFactor + thresholdFactor,
+// instead of one of the built-in fudge factors and the default
+// thresholdFactor. For tools that tune the detector.
+void detector_ctxSetThreshold(detector_ctx_t *ctx, double fudgeFactor,
+                              double thresholdFactor);
+// Selects the median rule (the default) or CFAR, see detector_decision_t.
+// CFAR's noise floors start over.
+void detector_ctxSetDecision(detector_ctx_t *ctx, detector_decision_t decision);
+// Early detection: a shot only passes the threshold once enough of it is in
+// the 200 ms power window, tens of ms into a weak one. With early detection
+// on, a frequency that does not pass the threshold still hits when one of the
+// filter's shorter power windows (25, 50 or 100 ms, see
+// filter_ctxSetPowerWindows()), scaled up to 200 ms, passes
+// DETECTOR_EARLY_STRICTNESS times the median rule's threshold in that window,
+// and the whole window confirms it: the frequency is the strongest there too
+// and over median * fudgeFactor. This uses the median rule whatever the
+// decision. The hit LED, sound and freeze message all come that much sooner.
+// Turns the filter's power windows on or off with it.
+void detector_ctxSetEarlyDetection(detector_ctx_t *ctx, bool enabled);
+// Runs the FIR output through an FFT engine (spectrum.h) instead of the IIR
+// filters: the power of its first ten bands becomes the filter's current
+// power after every FFT, and hit detection runs on it as before. spectrum
+// must have been initialized with spectrum_ctxInit(); NULL goes back to the
+// IIR filters. Early detection needs the IIR filters' power windows.
+void detector_ctxSetSpectrum(detector_ctx_t *ctx, spectrum_ctx_t *spectrum);
+// With freezeOnHit false (it is true after detector_ctxInit()) a hit never
+// freezes the player or costs a life, so every shot on another frequency is
+// a hit. For tools and tests that count hits rather than play.
+void detector_ctxSetFreezeOnHit(detector_ctx_t *ctx, bool freezeOnHit);
+uint32_t detector_ctxGetInvocationCount(detector_ctx_t *ctx);
+uint16_t detector_ctxGetLives(detector_ctx_t *ctx);
+void detector_ctxSetOwnFrequency(detector_ctx_t *ctx, uint16_t playerNum);
+
+// Returns the default context used by the functions without a context.
+detector_ctx_t *detector_getDefaultCtx(void);
+
 #endif /* DETECTOR_H_ */
@@ -9,11 +9,29 @@
 #define Z_QUEUE_SIZE 10
 #define OUTPUT_QUEUE_SIZE 2000
 #define INDEX_ONE 1
+// The gate's energy follows the squared first difference with a time constant
+// of 16 FIR outputs (1.6 ms). The quiet level is the plain average of the
+// energy over the first power window, then follows it with a time constant of
+// 4096 outputs (0.4 s) while it is under GATE_MARGIN times the quiet level and
+// of 65536 outputs (6.6 s) while it is over, so that a lasting rise in the
+// noise is learned eventually but a shot barely moves it. The gate opens over
+// GATE_MARGIN times the quiet level and closes after a whole power window
+// under it, plus the 20 ms or so the narrow IIR filters ring for after their
+// input stops, so that the frozen power values come from quiet outputs only.
+#define GATE_ENERGY_RATE (1.0 / 16)
+#define GATE_QUIET_RATE (1.0 / 4096)
+#define GATE_LOUD_RATE (1.0 / 65536)
+#define GATE_MARGIN 4.0
+#define GATE_IIR_SETTLE 500 // 50 ms.
+#define GATE_HOLD (OUTPUT_QUEUE_SIZE + GATE_IIR_SETTLE)
+#define GATE_HISTORY_MASK (FILTER_GATE_HISTORY_SIZE - 1)
+#define GATE_MAX_REPLAY (FILTER_GATE_HISTORY_SIZE - Y_QUEUE_SIZE)
+#define WHOLE_WINDOW FILTER_WHOLE_POWER_WINDOW
+#if FILTER_GATE_HISTORY_SIZE & GATE_HISTORY_MASK
+#error "FILTER_GATE_HISTORY_SIZE must be a power of two."
+#endif
 
-static queue_t xQueue;
-static queue_t yQueue;
-static queue_t zQueues[FILTER_IIR_FILTER_COUNT];
-static queue_t outputQueues[FILTER_IIR_FILTER_COUNT];
+static filter_ctx_t defaultCtx;
 
 // 1. First filter is a decimating FIR filter with a configurable number of taps
 // and decimation factor.
@@ -21,195 +39,433 @@ static queue_t outputQueues[FILTER_IIR_FILTER_COUNT];
 // IIR filters. The characteristics of the IIR filter are fixed.
 
 // Initialize the X-Queue with all zeros
-void initXQueue()
+static void initXQueue(filter_ctx_t *ctx)
 {
-    queue_init(&xQueue, X_QUEUE_SIZE, "xQueue");
+    queue_init(&ctx->xQueue, X_QUEUE_SIZE, "xQueue");
     //check for loop 
     for (uint32_t i = 0; i < X_QUEUE_SIZE; i++)
-        queue_overwritePush(&xQueue, QUEUE_INIT_VALUE);
+        queue_overwritePush(&ctx->xQueue, QUEUE_INIT_VALUE);
 }
 
 // Initialize the Y-Queue with all zeros
-void initYQueue()
+static void initYQueue(filter_ctx_t *ctx)
 {
-    queue_init(&yQueue, Y_QUEUE_SIZE, "yQueue");
+    queue_init(&ctx->yQueue, Y_QUEUE_SIZE, "yQueue");
     //check for loop
     for (uint32_t i = 0; i < Y_QUEUE_SIZE; i++)
-        queue_overwritePush(&yQueue, QUEUE_INIT_VALUE);
+        queue_overwritePush(&ctx->yQueue, QUEUE_INIT_VALUE);
 }
 
 // Initializes the Z-Queue with zeros
-void initZQueues()
+static void initZQueues(filter_ctx_t *ctx)
 {
     // There are 10 values for each filter so we initialize each value with nested for-loops
     for (uint32_t i = 0; i < FILTER_IIR_FILTER_COUNT; i++)
     {
-        queue_init(&(zQueues[i]), Z_QUEUE_SIZE, "zQueue");
+        queue_init(&(ctx->zQueues[i]), Z_QUEUE_SIZE, "zQueue");
         //check for loop
         for (uint32_t j = 0; j < Z_QUEUE_SIZE; j++)
-            queue_overwritePush(&(zQueues[i]), QUEUE_INIT_VALUE);
+            queue_overwritePush(&(ctx->zQueues[i]), QUEUE_INIT_VALUE);
     }
 }
 
 // Initializes the output queues to all zeros
-void initOutputQueues()
+static void initOutputQueues(filter_ctx_t *ctx)
 {
     // There are 2000 values for each of the 10 filters so we use nested for-loops to initialize all values
     for (uint32_t i = 0; i < FILTER_IIR_FILTER_COUNT; i++)
     {
-        queue_init(&(outputQueues[i]), OUTPUT_QUEUE_SIZE, "outputQueue");
+        queue_init(&(ctx->outputQueues[i]), OUTPUT_QUEUE_SIZE, "outputQueue");
         //check for loop
         for (uint32_t j = 0; j < OUTPUT_QUEUE_SIZE; j++)
-            queue_overwritePush(&(outputQueues[i]), QUEUE_INIT_VALUE);
+            queue_overwritePush(&(ctx->outputQueues[i]), QUEUE_INIT_VALUE);
     }
 }
 
 /******************************************************************************
-***** Main Filter Functions
+***** Context Filter Functions
 ******************************************************************************/
-// Must call this prior to using any filteIR coefficients were declared, for example: const static double iir_a_coeffs[FREQUENCY_COUNT][IIR_A_COEFF_COUr functions.
-void filter_init()
+
+// Allocates the queues of the context and fills them with zeros. Call
+// filter_ctxFree() before initializing the same context again.
+void filter_ctxInit(filter_ctx_t *ctx)
 {
-    initXQueue();       // Call queue_init() on xQueue and fill it with zeros.
-    initYQueue();       // Call queue_init() on yQueue and fill it with zeros.
-    initZQueues();      // Call queue_init() on all of the zQueues and fill each z queue with zeros.
-    initOutputQueues(); // Call queue_init() on all of the outputQueues and fill each outputQueue with zeros.
+    initXQueue(ctx);       // Call queue_init() on xQueue and fill it with zeros.
+    initYQueue(ctx);       // Call queue_init() on yQueue and fill it with zeros.
+    initZQueues(ctx);      // Call queue_init() on all of the zQueues and fill each z queue with zeros.
+    initOutputQueues(ctx); // Call queue_init() on all of the outputQueues and fill each outputQueue with zeros.
+    // The queues are all zeros, so is their power.
+    for (uint32_t i = 0; i < FILTER_IIR_FILTER_COUNT; i++)
+    {
+        ctx->prevPower[i] = 0.0;
+        ctx->oldestValue[i] = 0.0;
+        for (uint16_t w = 0; w < WHOLE_WINDOW; w++)
+            ctx->windowPower[w][i] = 0.0;
+    }
+    ctx->powerWindowsEnabled = false;
+    ctx->gateEnabled = false;
+    ctx->gateOpen = true;
+    ctx->gateEnergy = 0.0;
+    ctx->gateQuiet = 0.0;
+    ctx->gateQuietCount = 0;
+    ctx->gateOutputs = 0;
+    ctx->gateSkipped = 0;
+    ctx->gateSkippedTotal = 0;
+    for (uint32_t i = 0; i < FILTER_GATE_HISTORY_SIZE; i++)
+        ctx->gateHistory[i] = QUEUE_INIT_VALUE;
+    ctx->gateHistoryIndex = 0;
+}
+
+// Frees the queues allocated by filter_ctxInit().
+void filter_ctxFree(filter_ctx_t *ctx)
+{
+    queue_garbageCollect(&ctx->xQueue);
+    queue_garbageCollect(&ctx->yQueue);
+    for (uint32_t i = 0; i < FILTER_IIR_FILTER_COUNT; i++)
+    {
+        queue_garbageCollect(&(ctx->zQueues[i]));
+        queue_garbageCollect(&(ctx->outputQueues[i]));
+    }
 }
 
 // Use this to copy an input into the input queue of the FIR-filter (xQueue).
-void filter_addNewInput(double x)
+void filter_ctxAddNewInput(filter_ctx_t *ctx, double x)
 {
-    queue_overwritePush(&xQueue, x);
+    queue_overwritePush(&ctx->xQueue, x);
 }
 
 // Invokes the FIR-filter. Input is contents of xQueue.
 // Output is returned and is also pushed on to yQueue.
-double filter_firFilter()
+double filter_ctxFirFilter(filter_ctx_t *ctx)
 {
     double y = 0.0;
     // For loop to iterate through each element and multiply it by a filter coefficent
     for (uint32_t i = 0; i < FIR_FILTER_TAP_COUNT; i++)
     {
-        y += queue_readElementAt(&xQueue, i) * firCoefficients[FIR_FILTER_TAP_COUNT - i - INDEX_ONE];
+        y += queue_readElementAt(&ctx->xQueue, i) * firCoefficients[FIR_FILTER_TAP_COUNT - i - INDEX_ONE];
     }
-    queue_overwritePush(&yQueue, y);
+    queue_overwritePush(&ctx->yQueue, y);
     return y;
 }
 
 // Use this to invoke a single iir filter. Input comes from yQueue.
 // Output is returned and is also pushed onto zQueue[filterNumber].
-double filter_iirFilter(uint16_t filterNumber)
+double filter_ctxIirFilter(filter_ctx_t *ctx, uint16_t filterNumber)
 {
     double z = 0;
     double yTotal = 0;
     double zTotal = 0;
+    queue_t *zQueue = &(ctx->zQueues[filterNumber]);
     // This is the calculation to populate the zQueue and output queue with updated values and is then pushed to each queue
     for (uint32_t j = 0; j < IIR_B_COEFFICIENT_COUNT; j++)
     {
-        yTotal += iirBCoefficientConstants[filterNumber][j] * queue_readElementAt(&yQueue, IIR_B_COEFFICIENT_COUNT - j - INDEX_ONE);
+        yTotal += iirBCoefficientConstants[filterNumber][j] * queue_readElementAt(&ctx->yQueue, IIR_B_COEFFICIENT_COUNT - j - INDEX_ONE);
         //if the right conditions, add to the power
         if (j != IIR_B_COEFFICIENT_COUNT - INDEX_ONE)
-            zTotal += iirACoefficientConstants[filterNumber][j] * queue_readElementAt(&(zQueues[filterNumber]), IIR_A_COEFFICIENT_COUNT - j - INDEX_ONE);
+            zTotal += iirACoefficientConstants[filterNumber][j] * queue_readElementAt(zQueue, IIR_A_COEFFICIENT_COUNT - j - INDEX_ONE);
     }
     z = yTotal - zTotal;
-    queue_overwritePush(&(zQueues[filterNumber]), z);
-    queue_overwritePush(&(outputQueues[filterNumber]), z);
+    queue_overwritePush(zQueue, z);
+    queue_overwritePush(&(ctx->outputQueues[filterNumber]), z);
     return z;
 }
 
-// Use this to compute the power for values contained in an outputQueue.
-// If force == true, then recompute power by using all values in the
-// outputQueue. This option is necessary so that you can correctly compute power
-// values the first time. After that, you can incrementally compute power values
-// by:
-// 1. Keeping track of the power computed in a previous run, call this
-// prev-power.
-// 2. Keeping track of the oldest outputQueue value used in a previous run, call
-// this oldest-value.
-// 3. Get the newest value from the power queue, call this newest-value.
-// 4. Compute new power as: prev-power - (oldest-value * oldest-value) +
-// (newest-value * newest-value). Note that this function will probably need an
-// array to keep track of these values for each of the 10 output queues.
-double prevPower[FILTER_IIR_FILTER_COUNT];
-double oldestValue[FILTER_IIR_FILTER_COUNT];
+// Runs every IIR filter and computes every power on the newest FIR output.
+static void runIirBank(filter_ctx_t *ctx)
+{
+    for (uint16_t filterNumber = 0; filterNumber < FILTER_IIR_FILTER_COUNT; filterNumber++)
+    {
+        filter_ctxIirFilter(ctx, filterNumber);
+        filter_ctxComputePower(ctx, filterNumber, false, false);
+    }
+}
+
+// FIR output from back outputs ago, 0 being the newest.
+static double gateHistoryAt(filter_ctx_t *ctx, uint32_t back)
+{
+    return ctx->gateHistory[(ctx->gateHistoryIndex - INDEX_ONE - back) & GATE_HISTORY_MASK];
+}
 
-// Return the amount of power in the signal output by the corresponding IIR filter
-double filter_computePower(uint16_t filterNumber, bool forceComputeFromScratch, bool debugPrint)
+// Runs the IIR filters over the FIR outputs the closed gate skipped last,
+// then over the newest one. The y-queue is rewound to the outputs before the
+// first of them and moved forward one output at a time.
+static void replayIirBank(filter_ctx_t *ctx)
+{
+    uint32_t replay = ctx->gateSkipped < GATE_MAX_REPLAY ? ctx->gateSkipped : GATE_MAX_REPLAY;
+    for (uint32_t back = replay + Y_QUEUE_SIZE - INDEX_ONE; back > replay; back--)
+        queue_overwritePush(&ctx->yQueue, gateHistoryAt(ctx, back));
+    for (uint32_t back = replay + INDEX_ONE; back > 0; back--)
+    {
+        queue_overwritePush(&ctx->yQueue, gateHistoryAt(ctx, back - INDEX_ONE));
+        runIirBank(ctx);
+    }
+}
+
+// Updates the gate with the newest FIR output, then runs the IIR filters
+// and the power unless the gate is closed.
+bool filter_ctxRunIirBank(filter_ctx_t *ctx)
+{
+    if (!ctx->gateEnabled)
+    {
+        runIirBank(ctx);
+        return true;
+    }
+    double y = queue_readElementAt(&ctx->yQueue, Y_QUEUE_SIZE - INDEX_ONE);
+    double difference = y - gateHistoryAt(ctx, 0);
+    ctx->gateHistory[ctx->gateHistoryIndex] = y;
+    ctx->gateHistoryIndex = (ctx->gateHistoryIndex + INDEX_ONE) & GATE_HISTORY_MASK;
+    ctx->gateEnergy += GATE_ENERGY_RATE * (difference * difference - ctx->gateEnergy);
+    bool quiet = ctx->gateEnergy <= ctx->gateQuiet * GATE_MARGIN;
+    double rate = quiet ? GATE_QUIET_RATE : GATE_LOUD_RATE;
+    // The first power window is averaged evenly.
+    if (ctx->gateOutputs < OUTPUT_QUEUE_SIZE)
+        rate = 1.0 / ++ctx->gateOutputs;
+    ctx->gateQuiet += rate * (ctx->gateEnergy - ctx->gateQuiet);
+    if (quiet)
+        ctx->gateQuietCount++;
+    else
+        ctx->gateQuietCount = 0;
+
+    if (ctx->gateQuietCount > GATE_HOLD)
+    {
+        ctx->gateOpen = false;
+        ctx->gateSkipped++;
+        ctx->gateSkippedTotal++;
+        return false;
+    }
+    if (!ctx->gateOpen)
+    {
+        replayIirBank(ctx);
+        ctx->gateOpen = true;
+        ctx->gateSkipped = 0;
+    }
+    else
+        runIirBank(ctx);
+    return true;
+}
+
+// Turns the energy gate on or off. Turning it off opens it.
+void filter_ctxSetGate(filter_ctx_t *ctx, bool enabled)
+{
+    ctx->gateEnabled = enabled;
+    ctx->gateQuietCount = 0;
+    if (!enabled && !ctx->gateOpen)
+    {
+        replayIirBank(ctx);
+        ctx->gateOpen = true;
+        ctx->gateSkipped = 0;
+    }
+}
+
+// True unless the gate is on and closed.
+bool filter_ctxGateOpen(filter_ctx_t *ctx)
+{
+    return ctx->gateOpen;
+}
+
+// FIR outputs the IIR filters have skipped since filter_ctxInit().
+uint32_t filter_ctxGetGateSkippedCount(filter_ctx_t *ctx)
+{
+    return ctx->gateSkippedTotal;
+}
+
+// Return the amount of power in the signal output by the corresponding IIR
+// filter. See filter_computePower() in filter.h for how the power is kept up
+// to date incrementally.
+double filter_ctxComputePower(filter_ctx_t *ctx, uint16_t filterNumber, bool forceComputeFromScratch, bool debugPrint)
 {
     double power = 0.0;
+    queue_t *outputQueue = &(ctx->outputQueues[filterNumber]);
     // Computes the power using all values of the output queue starting from scratch
     if (forceComputeFromScratch)
     {
         // Iterates through output queue and sqaures each value before adding it to total
         for (uint32_t i = 0; i < OUTPUT_QUEUE_SIZE; i++)
         {
-            power += queue_readElementAt(&(outputQueues[filterNumber]), i) * queue_readElementAt(&(outputQueues[filterNumber]), i);
+            power += queue_readElementAt(outputQueue, i) * queue_readElementAt(outputQueue, i);
+        }
+        // The shorter windows sum only the newest values.
+        for (uint16_t w = 0; ctx->powerWindowsEnabled && w < WHOLE_WINDOW; w++)
+        {
+            double windowPower = 0.0;
+            for (uint32_t i = OUTPUT_QUEUE_SIZE - filter_powerWindowSizes[w]; i < OUTPUT_QUEUE_SIZE; i++)
+                windowPower += queue_readElementAt(outputQueue, i) * queue_readElementAt(outputQueue, i);
+            ctx->windowPower[w][filterNumber] = windowPower;
         }
     }
     // Calculates the power based on the newest value of the output queue and previous power calculation
     else
     {
-        double newestValue = queue_readElementAt(&(outputQueues[filterNumber]), OUTPUT_QUEUE_SIZE - INDEX_ONE);
-        power = prevPower[filterNumber] - (oldestValue[filterNumber] * oldestValue[filterNumber]) + (newestValue * newestValue);
+        double newestValue = queue_readElementAt(outputQueue, OUTPUT_QUEUE_SIZE - INDEX_ONE);
+        double newestSquared = newestValue * newestValue;
+        power = ctx->prevPower[filterNumber] - (ctx->oldestValue[filterNumber] * ctx->oldestValue[filterNumber]) + newestSquared;
+        // A shorter window loses the value just older than its newest ones.
+        for (uint16_t w = 0; ctx->powerWindowsEnabled && w < WHOLE_WINDOW; w++)
+        {
+            double leaving = queue_readElementAt(outputQueue, OUTPUT_QUEUE_SIZE - INDEX_ONE - filter_powerWindowSizes[w]);
+            ctx->windowPower[w][filterNumber] += newestSquared - leaving * leaving;
+        }
     }
-    prevPower[filterNumber] = power;
-    oldestValue[filterNumber] = queue_readElementAt(&(outputQueues[filterNumber]), 0);
+    ctx->prevPower[filterNumber] = power;
+    ctx->oldestValue[filterNumber] = queue_readElementAt(outputQueue, 0);
     return power;
 }
 
 // Returns the last-computed output power value for the IIR filter
 // [filterNumber].
-double filter_getCurrentPowerValue(uint16_t filterNumber)
+double filter_ctxGetCurrentPowerValue(filter_ctx_t *ctx, uint16_t filterNumber)
 {
-    return prevPower[filterNumber];
+    return ctx->prevPower[filterNumber];
 }
 
 // Sets a current power value for a specific filter number.
-// Useful in testing the detector.
-void filter_setCurrentPowerValue(uint16_t filterNumber, double value)
+void filter_ctxSetCurrentPowerValue(filter_ctx_t *ctx, uint16_t filterNumber, double value)
 {
-    prevPower[filterNumber] = value;
+    ctx->prevPower[filterNumber] = value;
 }
 
-// Get a copy of the current power values.
-// This function copies the already computed values into a previously-declared
-// array so that they can be accessed from outside the filter software by the
-// detector. Remember that when you pass an array into a C function, changes to
-// the array within that function are reflected in the returned array.
-void filter_getCurrentPowerValues(double powerValues[])
+// Copies the already computed power values into powerValues[].
+void filter_ctxGetCurrentPowerValues(filter_ctx_t *ctx, double powerValues[])
 {
     // Iterates through each filter to put power values into new array
     for (uint32_t i = 0; i < FILTER_IIR_FILTER_COUNT; i++)
     {
-        powerValues[i] = prevPower[i];
+        powerValues[i] = ctx->prevPower[i];
     }
 }
 
-// Using the previously-computed power values that are currently stored in
-// currentPowerValue[] array, copy these values into the normalizedArray[]
-// argument and then normalize them by dividing all of the values in
-// normalizedArray by the maximum power value contained in currentPowerValue[].
-// The pointer argument indexOfMaxValue is used to return the index of the
-// maximum value. If the maximum power is zero, make sure to not divide by zero
-// and that *indexOfMaxValue is initialized to a sane value (like zero).
-void filter_getNormalizedPowerValues(double normalizedArray[], uint16_t *indexOfMaxValue)
+// Copies the current power values into normalizedArray[], divided by the
+// largest of them, and returns the index of the largest in *indexOfMaxValue.
+void filter_ctxGetNormalizedPowerValues(filter_ctx_t *ctx, double normalizedArray[], uint16_t *indexOfMaxValue)
 {
     double maxPower = 0;
     // Ensures that we don't divide by zero
     for (uint32_t i = 0; i < FILTER_IIR_FILTER_COUNT; i++)
     {   
         // If previous power is greater than mac power, update max power
-        if (prevPower[i] > maxPower)
+        if (ctx->prevPower[i] > maxPower)
         {
-            maxPower = prevPower[i];
+            maxPower = ctx->prevPower[i];
             *indexOfMaxValue = i;
         }
     }
     // Copies then normalized power values into the normalized array
     for (uint32_t i = 0; i < FILTER_IIR_FILTER_COUNT; i++)
     {
-        normalizedArray[i] = prevPower[i] / prevPower[*indexOfMaxValue];
+        normalizedArray[i] = ctx->prevPower[i] / ctx->prevPower[*indexOfMaxValue];
+    }
+}
+
+// Turns the shorter power windows on or off, computing them from scratch
+// when they are turned on.
+void filter_ctxSetPowerWindows(filter_ctx_t *ctx, bool enabled)
+{
+    if (enabled && !ctx->powerWindowsEnabled)
+    {
+        ctx->powerWindowsEnabled = true;
+        for (uint16_t filterNumber = 0; filterNumber < FILTER_IIR_FILTER_COUNT; filterNumber++)
+            filter_ctxComputePower(ctx, filterNumber, true, false);
     }
+    ctx->powerWindowsEnabled = enabled;
+}
+
+// Copies the power of one window of every filter into powerValues[].
+void filter_ctxGetWindowPowerValues(filter_ctx_t *ctx, uint16_t window, double powerValues[])
+{
+    for (uint32_t i = 0; i < FILTER_IIR_FILTER_COUNT; i++)
+        powerValues[i] = window < WHOLE_WINDOW ? ctx->windowPower[window][i] : ctx->prevPower[i];
+}
+
+/******************************************************************************
+***** Main Filter Functions
+***** These work on the default context.
+******************************************************************************/
+// Must call this prior to using any filter functions.
+void filter_init()
+{
+    filter_ctxInit(&defaultCtx);
+}
+
+// Use this to copy an input into the input queue of the FIR-filter (xQueue).
+void filter_addNewInput(double x)
+{
+    filter_ctxAddNewInput(&defaultCtx, x);
+}
+
+// Invokes the FIR-filter. Input is contents of xQueue.
+// Output is returned and is also pushed on to yQueue.
+double filter_firFilter()
+{
+    return filter_ctxFirFilter(&defaultCtx);
+}
+
+// Use this to invoke a single iir filter. Input comes from yQueue.
+// Output is returned and is also pushed onto zQueue[filterNumber].
+double filter_iirFilter(uint16_t filterNumber)
+{
+    return filter_ctxIirFilter(&defaultCtx, filterNumber);
+}
+
+// Runs the IIR filters and the power unless the energy gate is closed.
+bool filter_runIirBank()
+{
+    return filter_ctxRunIirBank(&defaultCtx);
+}
+
+// Turns the energy gate on or off.
+void filter_setGate(bool enabled)
+{
+    filter_ctxSetGate(&defaultCtx, enabled);
+}
+
+// Return the amount of power in the signal output by the corresponding IIR filter
+double filter_computePower(uint16_t filterNumber, bool forceComputeFromScratch, bool debugPrint)
+{
+    return filter_ctxComputePower(&defaultCtx, filterNumber, forceComputeFromScratch, debugPrint);
+}
+
+// Returns the last-computed output power value for the IIR filter
+// [filterNumber].
+double filter_getCurrentPowerValue(uint16_t filterNumber)
+{
+    return filter_ctxGetCurrentPowerValue(&defaultCtx, filterNumber);
+}
+
+// Sets a current power value for a specific filter number.
+// Useful in testing the detector.
+void filter_setCurrentPowerValue(uint16_t filterNumber, double value)
+{
+    filter_ctxSetCurrentPowerValue(&defaultCtx, filterNumber, value);
+}
+
+// Get a copy of the current power values.
+void filter_getCurrentPowerValues(double powerValues[])
+{
+    filter_ctxGetCurrentPowerValues(&defaultCtx, powerValues);
+}
+
+// Normalized copy of the current power values, see filter.h.
+void filter_getNormalizedPowerValues(double normalizedArray[], uint16_t *indexOfMaxValue)
+{
+    filter_ctxGetNormalizedPowerValues(&defaultCtx, normalizedArray, indexOfMaxValue);
+}
+
+// Turns the shorter power windows on or off.
+void filter_setPowerWindows(bool enabled)
+{
+    filter_ctxSetPowerWindows(&defaultCtx, enabled);
+}
+
+// Copies the power of one window of every filter into powerValues[].
+void filter_getWindowPowerValues(uint16_t window, double powerValues[])
+{
+    filter_ctxGetWindowPowerValues(&defaultCtx, window, powerValues);
+}
+
+// Returns the default context used by the functions above.
+filter_ctx_t *filter_getDefaultCtx()
+{
+    return &defaultCtx;
 }
 
 /******************************************************************************
@@ -257,7 +513,7 @@ uint32_t filter_getIirBCoefficientCount()
 // Returns the size of the yQueue.
 uint32_t filter_getYQueueSize()
 {
-    queue_size(&yQueue);
+    return queue_size(&defaultCtx.yQueue);
 }
 
 // Returns the decimation value.
@@ -269,23 +525,23 @@ uint16_t filter_getDecimationValue()
 // Returns the address of xQueue.
 queue_t *filter_getXQueue()
 {
-    return &xQueue;
+    return &defaultCtx.xQueue;
 }
 
 // Returns the address of yQueue.
 queue_t *filter_getYQueue()
 {
-    return &yQueue;
+    return &defaultCtx.yQueue;
 }
 
 // Returns the address of zQueue for a specific filter number.
 queue_t *filter_getZQueue(uint16_t filterNumber)
 {
-    return &(zQueues[filterNumber]);
+    return &(defaultCtx.zQueues[filterNumber]);
 }
 
 // Returns the address of the IIR output-queue for a specific filter-number.
 queue_t *filter_getIirOutputQueue(uint16_t filterNumber)
 {
-    return &(outputQueues[filterNumber]);
+    return &(defaultCtx.outputQueues[filterNumber]);
 }
\ No newline at end of file
@@ -38,6 +38,46 @@ static const uint16_t filter_frequencyTickTable[FILTER_FREQUENCY_COUNT] = {
 // 2. The output from the decimating FIR filter is passed through a bank of 10
 // IIR filters. The characteristics of the IIR filter are fixed.
 
+// The energy gate keeps this many of the newest FIR outputs, so that it can
+// run the IIR filters over the ones it skipped just before it opened.
+#define FILTER_GATE_HISTORY_SIZE 64
+
+// Besides the whole 200 ms power window, the filter can keep the power of the
+// newest 25, 50 and 100 ms of each output queue (see filter_ctxSetPowerWindows()).
+// Sizes are in FIR outputs, shortest first; the last window is the whole
+// output queue, whose power is the one filter_getCurrentPowerValues() returns.
+#define FILTER_POWER_WINDOW_COUNT 4
+#define FILTER_WHOLE_POWER_WINDOW (FILTER_POWER_WINDOW_COUNT - 1)
+static const uint16_t filter_powerWindowSizes[FILTER_POWER_WINDOW_COUNT] = {
+    250, 500, 1000, 2000};
+
+// Everything one filter chain needs between samples. The filter_ctx...
+// functions below only touch the context they are given, so any number of
+// chains can run side by side, each on its own thread if need be. The
+// filter_... functions without a context work on a default context and are
+// what the gun itself uses.
+typedef struct {
+    queue_t xQueue;                                   // FIR input.
+    queue_t yQueue;                                   // FIR output, IIR input.
+    queue_t zQueues[FILTER_IIR_FILTER_COUNT];         // IIR feedback.
+    queue_t outputQueues[FILTER_IIR_FILTER_COUNT];    // IIR output, power window.
+    double prevPower[FILTER_IIR_FILTER_COUNT];        // Last computed power.
+    double oldestValue[FILTER_IIR_FILTER_COUNT];      // Leaves the window next.
+    bool powerWindowsEnabled; // See filter_ctxSetPowerWindows().
+    double windowPower[FILTER_WHOLE_POWER_WINDOW][FILTER_IIR_FILTER_COUNT];
+    // Energy gate, see filter_ctxSetGate().
+    bool gateEnabled;
+    bool gateOpen;
+    double gateEnergy;     // Of the FIR output's first difference, averaged.
+    double gateQuiet;      // Average of gateEnergy in the quiet.
+    uint32_t gateQuietCount; // FIR outputs in a row in the quiet.
+    uint32_t gateOutputs;  // Seen by the gate, up to a power window.
+    uint32_t gateSkipped;  // FIR outputs skipped since the gate closed.
+    uint32_t gateSkippedTotal;
+    double gateHistory[FILTER_GATE_HISTORY_SIZE]; // Newest FIR outputs.
+    uint16_t gateHistoryIndex; // Where the next FIR output goes.
+} filter_ctx_t;
+
 /******************************************************************************
 ***** Main Filter Functions
 ******************************************************************************/
@@ -56,6 +96,15 @@ double filter_firFilter();
 // Output is returned and is also pushed onto zQueue[filterNumber].
 double filter_iirFilter(uint16_t filterNumber);
 
+// Runs every IIR filter and computes every power, incrementally, on the
+// newest FIR output, unless the energy gate is closed (see
+// filter_ctxSetGate()). Returns false if they were skipped.
+bool filter_runIirBank();
+
+// Turns the energy gate of the default context on or off, see
+// filter_ctxSetGate().
+void filter_setGate(bool enabled);
+
 // Use this to compute the power for values contained in an outputQueue.
 // If force == true, then recompute power by using all values in the
 // outputQueue. This option is necessary so that you can correctly compute power
@@ -97,6 +146,76 @@ void filter_getCurrentPowerValues(double powerValues[]);
 void filter_getNormalizedPowerValues(double normalizedArray[],
                                      uint16_t *indexOfMaxValue);
 
+// Turns the shorter power windows of the default context on or off, see
+// filter_ctxSetPowerWindows().
+void filter_setPowerWindows(bool enabled);
+
+// Copies the power of one window (0 to FILTER_WHOLE_POWER_WINDOW) of every
+// filter into powerValues[].
+void filter_getWindowPowerValues(uint16_t window, double powerValues[]);
+
+// Returns the default context used by the functions above.
+filter_ctx_t *filter_getDefaultCtx();
+
+/******************************************************************************
+***** Context Filter Functions
+***** Same as the main filter functions, on the given context.
+******************************************************************************/
+
+// Allocates the queues of the context and fills them with zeros. Call
+// filter_ctxFree() before initializing the same context again.
+void filter_ctxInit(filter_ctx_t *ctx);
+
+// Frees the queues allocated by filter_ctxInit().
+void filter_ctxFree(filter_ctx_t *ctx);
+
+void filter_ctxAddNewInput(filter_ctx_t *ctx, double x);
+double filter_ctxFirFilter(filter_ctx_t *ctx);
+double filter_ctxIirFilter(filter_ctx_t *ctx, uint16_t filterNumber);
+bool filter_ctxRunIirBank(filter_ctx_t *ctx);
+
+// Energy gate: most of a game nothing shines on the gun, and the ten IIR
+// filters are most of the work of the detector. With the gate on,
+// filter_ctxRunIirBank() tracks the energy of the FIR output's first
+// difference (which removes DC and most of the lamps' flicker) against its
+// average in the quiet. Once it stays under four times that level for a
+// whole power window and 50 ms more, the gate closes: the IIR filters and the
+// power stop, and the power values keep the quiet levels they had. The first
+// FIR output over that level opens it again, and the IIR filters first catch
+// up on the outputs they skipped (up to FILTER_GATE_HISTORY_SIZE - 11 of
+// them), so the start of a shot is not lost. They start from the state they
+// had when the gate closed, and the power window still holds the quiet
+// outputs from before then, so for about a power window after the gate opens
+// the power values are off from those without the gate by about the quiet
+// power level, which is small next to a shot's (see filterGateTest.h). The
+// gate starts open and off.
+void filter_ctxSetGate(filter_ctx_t *ctx, bool enabled);
+
+// True unless the gate is on and closed.
+bool filter_ctxGateOpen(filter_ctx_t *ctx);
+
+// FIR outputs the IIR filters have skipped since filter_ctxInit().
+uint32_t filter_ctxGetGateSkippedCount(filter_ctx_t *ctx);
+double filter_ctxComputePower(filter_ctx_t *ctx, uint16_t filterNumber,
+                              bool forceComputeFromScratch, bool debugPrint);
+double filter_ctxGetCurrentPowerValue(filter_ctx_t *ctx, uint16_t filterNumber);
+void filter_ctxSetCurrentPowerValue(filter_ctx_t *ctx, uint16_t filterNumber,
+                                    double value);
+void filter_ctxGetCurrentPowerValues(filter_ctx_t *ctx, double powerValues[]);
+void filter_ctxGetNormalizedPowerValues(filter_ctx_t *ctx,
+                                        double normalizedArray[],
+                                        uint16_t *indexOfMaxValue);
+
+// With the power windows on, filter_ctxComputePower() also keeps the power of
+// the shorter windows in filter_powerWindowSizes[] up to date. They share the
+// output queue and the newest value's square with the whole window, so each
+// costs one more read and multiply per filter. A short window sees the start
+// of a shot sooner but is noisier. Turning them on computes them from scratch;
+// they start off.
+void filter_ctxSetPowerWindows(filter_ctx_t *ctx, bool enabled);
+void filter_ctxGetWindowPowerValues(filter_ctx_t *ctx, uint16_t window,
+                                    double powerValues[]);
+
 /******************************************************************************
 ***** Verification-Assisting Functions
 ***** External test functions access the internal data structures of filter.c
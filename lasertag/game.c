@@ -13,6 +13,7 @@ The code in runningModes.c can be an example for implementing the game here.
 
 #include <stdio.h>
 
+#include "game.h"
 #include "hitLedTimer.h"
 #include "interrupts.h"
 #include "runningModes.h"
@@ -28,6 +29,9 @@ The code in runningModes.c can be an example for implementing the game here.
 #include "sound.h"
 #include "utils.h"
 #include "bluetooth.h"
+#include "gameProtocol.h"
+#include "gameState.h"
+#include "capture.h"
 #define DEBUG
 #if defined(DEBUG)
 #include <stdio.h>
@@ -50,22 +54,32 @@ The code in runningModes.c can be an example for implementing the game here.
 #define CLIP_SIZE 10
 #define DETERMINE_TEAM 2
 #define ONE_SECOND_DELAY 1000
-#define BLUETOOTH_SERVICE_INTERVAL 500
-#define PLAYER 0
-#define FROZEN_UNFROZEN 1
-#define FROZEN 'f'
-#define UNFROZEN 'u'
-#define DATA_POSITION 0
-#define ONE_READ 1
-#define TWO_READS 2
-#define PLAYER_ONE_FROZEN '1'
-#define PLAYER_TWO_FROZEN '2'
-#define PLAYER_THREE_FROZEN '3'
-#define PLAYER_FOUR_FROZEN '4'
-#define PLAYER_ONE_UNFROZEN 'q'
-#define PLAYER_TWO_UNFROZEN 'w'
-#define PLAYER_THREE_UNFROZEN 'e'
-#define PLAYER_FOUR_UNFROZEN 'r'
+#define SOUND_STOP_TIMEOUT_MS 100 // sound_tick() runs the stop within a tick.
+// The 9600-baud link moves about one byte per ms and the UART FIFOs hold 16
+// bytes, so servicing it every 1 ms (100 ticks of the 100 kHz ISR) keeps up.
+#define BLUETOOTH_SERVICE_INTERVAL 100
+#define ONE_PASS 1
+#define GAME_OVER_PLAYLIST_LENGTH 1
+#define RETURN_TO_BASE_PLAYLIST_LENGTH 2
+
+// Frozen/unfrozen announcements, indexed by player - 1 and then by event
+// type - gameProtocol_frozen_e. Players without clips are not announced.
+#define ANNOUNCED_PLAYER_COUNT 4
+#define ANNOUNCED_EVENT_COUNT 2
+static const sound_sounds_t
+    playerSounds[ANNOUNCED_PLAYER_COUNT][ANNOUNCED_EVENT_COUNT] = {
+        {sound_p1Frozen, sound_p1Unfrozen},
+        {sound_p2Frozen, sound_p2Unfrozen},
+        {sound_p3Frozen, sound_p3Unfrozen},
+        {sound_p4Frozen, sound_p4Unfrozen}};
+
+// Played once when the game ends.
+static const sound_sounds_t gameOverPlaylist[GAME_OVER_PLAYLIST_LENGTH] = {
+    sound_gameOver_e};
+// Then looped until BTN3 is pressed.
+static const sound_sounds_t
+    returnToBasePlaylist[RETURN_TO_BASE_PLAYLIST_LENGTH] = {
+        sound_returnToBase_e, sound_oneSecondSilence_e};
 
 // This game supports two teams, Team-A and Team-B.
 // Each team operates on its own configurable frequency.
@@ -160,28 +174,37 @@ void game_twoTeamTag(void) {
 }
 
 
-   uint8_t rawIncomingData[1];
-   uint8_t incomingData[1];
-   uint8_t outgoingData[1];
    uint8_t playerTag;
-   uint16_t readCounter = 0;
-   bool playerOneFrozen, playerTwoFrozen, playerFourFrozen, playerThreeFrozen, gameOver, myPlayerFrozen;
+   bool myPlayerFrozen;
+static uint8_t playerCount = GAME_DEFAULT_PLAYER_COUNT; // See game_setPlayerCount().
 static uint16_t tickCount = 0;
+// Set by bluetooth_isr_function() when the receive queue has data, cleared
+// by the game loop when it parses it.
+static volatile bool bluetoothDataReady = false;
+
+// Sets the number of players in game_freezeTag().
+bool game_setPlayerCount(uint8_t count) {
+ if (count < 1 || count > GAME_MAX_PLAYER_COUNT) {
+   printf("game_setPlayerCount(): bad player count (%d).\n", count);
+   return false;
+ }
+ playerCount = count;
+ return true;
+}
 
 void game_freezeTag(void) {
- gameOver = false;
  myPlayerFrozen = false;
- playerOneFrozen = false;
- playerTwoFrozen = false;
- playerThreeFrozen = false;
- playerFourFrozen = false;
  uint16_t hitCount = 0;
  runningModes_initAll();
  trigger_enable();                                 // Makes the state machine responsive to the trigger.
- bool silenceFlag = false;
  // Configuration of the two teams
  playerTag = runningModes_getFrequencySetting()+1;
  bool teamB = ((playerTag-1) % DETERMINE_TEAM);
+ gameState_init();
+ for (uint8_t player = 1; player <= playerCount; player++)
+   gameState_addPlayer(player, (player - 1) % DETERMINE_TEAM);
+ // A gun set past the player count still keeps track of itself.
+ gameState_addPlayer(playerTag, teamB);
  bool ignoredFrequencies[FILTER_FREQUENCY_COUNT];
  for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++) {
    ignoredFrequencies[i] = false;
@@ -201,6 +224,7 @@ void game_freezeTag(void) {
                                      // interrupts.
  interrupts_startArmPrivateTimer();  // Start the private ARM timer running.
  bluetooth_init();
+ gameProtocol_init();
 
 
  intervalTimer_reset(ISR_CUMULATIVE_TIMER);        // Used to measure ISR execution time.
@@ -209,61 +233,28 @@ void game_freezeTag(void) {
  intervalTimer_start(TOTAL_RUNTIME_TIMER);         // Start measuring total execution time.
  interrupts_enableArmInts();                       // ARM will now see interrupts after this.
  sound_setVolume(sound_mediumHighVolume_e);        // set volume
- sound_setSound(sound_gameStart_e);                // set & play game start sound
- sound_startSound();
+ sound_enqueue(sound_gameStart_e);                 // play game start sound
  utils_msDelay(ONE_SECOND_DELAY);
  lockoutTimer_start();
  utils_msDelay(ONE_SECOND_DELAY);
  lockoutTimer_start();
 
  // Implement game loop...
- while ((!(buttons_read() & BUTTONS_BTN3_MASK))&&(!gameOver)) { // Run until you detect BTN3 pressed.h
+ while ((!(buttons_read() & BUTTONS_BTN3_MASK))&&(!gameState_isOver())) { // Run until you detect BTN3 pressed.h
     intervalTimer_start(MAIN_CUMULATIVE_TIMER);     // Measure run-time when you are
                                                    // doing something.
    // Run filters, compute power, run hit-detection.
    detector(INTERRUPTS_CURRENTLY_ENABLED);         // Interrupts are currently enabled.
    if (detector_hitDetected()) {                   // Hit detected
      hitCount++;
-     if(!myPlayerFrozen){
-       switch (playerTag) {
-         case 1:
-             outgoingData[PLAYER] = PLAYER_ONE_FROZEN;
-         break;
-         case 2:
-             outgoingData[PLAYER] = PLAYER_TWO_FROZEN;
-         break;
-         case 3:
-             outgoingData[PLAYER] = PLAYER_THREE_FROZEN;
-         break;
-         case 4:
-             outgoingData[PLAYER] = PLAYER_FOUR_FROZEN;
-         break;
-         default:
-             //WE NEED AN ERROR THING TO GO HERE, IF WE ARE HERE SOMETHING IS WRONG
-         break;
-       }
-       bluetooth_transmitQueueWrite(outgoingData, 1);
-     }else {
-       switch (playerTag) {
-         case 1:
-             outgoingData[PLAYER] = PLAYER_ONE_UNFROZEN;
-         break;
-         case 2:
-             outgoingData[PLAYER] = PLAYER_TWO_UNFROZEN;
-         break;
-         case 3:
-             outgoingData[PLAYER] = PLAYER_THREE_UNFROZEN;
-         break;
-         case 4:
-             outgoingData[PLAYER] = PLAYER_FOUR_UNFROZEN;
-         break;
-         default:
-             //WE NEED AN ERROR THING TO GO HERE, IF WE ARE HERE SOMETHING IS WRONG
-         break;
-       }
-       bluetooth_transmitQueueWrite(outgoingData, 1);
-     }
+     capture_mark(capture_hitMarker_e, detector_getFrequencyNumberOfLastHit());
+     // Tell the other players. Events are batched and sent by
+     // gameProtocol_flush() at the end of the loop.
+     gameProtocol_postEvent(myPlayerFrozen ? gameProtocol_unfrozen_e
+                                           : gameProtocol_frozen_e,
+                            playerTag);
      myPlayerFrozen = !myPlayerFrozen;
+     gameState_setFrozen(playerTag, myPlayerFrozen);
      if (detector_getLives() == 0) {
        utils_msDelay(ONE_SECOND_DELAY);
        lockoutTimer_start();
@@ -278,88 +269,49 @@ void game_freezeTag(void) {
     
    }
    interrupts_disableArmInts();
-   if (tickCount < (5)) {
-       readCounter = readCounter + bluetooth_receiveQueueRead(incomingData, 1);
-       if(readCounter == ONE_READ) {
-           switch (incomingData[PLAYER]) {
-               case PLAYER_ONE_FROZEN:
-                   playerOneFrozen = true;
-                   sound_setSound(sound_p1Frozen);
-                   sound_startSound();
-               break;
-               case PLAYER_ONE_UNFROZEN:
-                   playerOneFrozen = false;
-                   sound_setSound(sound_p1Unfrozen);
-                   sound_startSound();
-               break;
-               case PLAYER_TWO_FROZEN:
-                   playerTwoFrozen = true;
-                   sound_setSound(sound_p2Frozen);
-                   sound_startSound();
-               break;
-               case PLAYER_TWO_UNFROZEN:
-                   playerTwoFrozen = false;
-                   sound_setSound(sound_p2Unfrozen);
-                   sound_startSound();
-               break;
-               case PLAYER_THREE_FROZEN:
-                   playerThreeFrozen = true;
-                   sound_setSound(sound_p3Frozen);
-                   sound_startSound();
-               break;
-               case PLAYER_THREE_UNFROZEN:
-                   playerThreeFrozen = false;
-                   sound_setSound(sound_p3Unfrozen);
-                   sound_startSound();
-               break;
-               case PLAYER_FOUR_FROZEN:
-                   playerFourFrozen = true;
-                   sound_setSound(sound_p4Frozen);
-                   sound_startSound();
-               break;
-               case PLAYER_FOUR_UNFROZEN:
-                   playerFourFrozen = false;
-                   sound_setSound(sound_p4Unfrozen);
-                   sound_startSound();
-               break;
-               default:
-                   //WE NEED AN ERROR THING TO GO HERE, IF WE ARE HERE SOMETHING IS WRONG
-               break;
+   if (bluetoothDataReady) {
+       bluetoothDataReady = false;
+       // Parse everything that has arrived, then handle all of the events.
+       gameProtocol_event_t event;
+       gameProtocol_receive();
+       while (gameProtocol_readEvent(&event)) {
+           if (event.type != gameProtocol_frozen_e &&
+               event.type != gameProtocol_unfrozen_e)
+               continue; // Event types from newer versions.
+           if (!gameState_setFrozen(event.player,
+                                    event.type == gameProtocol_frozen_e)) {
+               DPRINTF("game_freezeTag(): event for unknown player %d\n",
+                       event.player);
+               continue;
            }
-           outgoingData[0] = 'R';
-           bluetooth_transmitQueueWrite(outgoingData, 1);
-           readCounter = 0;
-
-
+           if (event.player >= 1 && event.player <= ANNOUNCED_PLAYER_COUNT)
+               sound_enqueue(playerSounds[event.player - 1]
+                                         [event.type - gameProtocol_frozen_e]);
        }
    }
-   if((playerOneFrozen&&playerThreeFrozen)||(playerTwoFrozen&&playerFourFrozen)){gameOver=true;}
+   gameProtocol_flush(); // Send this iteration's events as one frame.
    interrupts_enableArmInts();
+   capture_poll(); // Save the samples if a capture is running.
    intervalTimer_stop(MAIN_CUMULATIVE_TIMER);      // All done with actual processing.
  }
 
 
- // Play the game over sound
+ // Play the game over sound, then keep reminding the player to return to
+ // base (with a second of silence in between) until BTN3 is pressed.
+ // The sound state machine plays the playlists, nothing to poll here.
  trigger_disable();
- sound_setSound(sound_gameOver_e);
- sound_startSound();
- utils_msDelay(ONE_SECOND_DELAY);
-
-
- //sound loop for game over
- while((!(buttons_read() & BUTTONS_BTN3_MASK))){
-   //check for the sound being done
-   if(sound_isSoundComplete()){
-     //check to see if it's time to be silent or not, what part of the loop we're in
-     if(silenceFlag){
-       sound_setSound(sound_oneSecondSilence_e);
-     } else {
-       sound_setSound(sound_returnToBase_e);
-     }
-     sound_startSound();
-     silenceFlag = !silenceFlag;
-   }
- }
+ capture_stop();
+ sound_enqueuePlaylist(gameOverPlaylist, GAME_OVER_PLAYLIST_LENGTH, ONE_PASS,
+                       NULL, NULL);
+ sound_enqueuePlaylist(returnToBasePlaylist, RETURN_TO_BASE_PLAYLIST_LENGTH,
+                       SOUND_PLAYLIST_LOOP_FOREVER, NULL, NULL);
+ while (!(buttons_read() & BUTTONS_BTN3_MASK))
+   ;
+ sound_stopSound();
+ // The stop is only a command: let sound_tick() run it before the ticks end,
+ // or the return-to-base loop would pick up again if they were restarted.
+ for (uint16_t ms = 0; sound_isBusy() && ms < SOUND_STOP_TIMEOUT_MS; ms++)
+   utils_msDelay(1);
 
  interrupts_disableArmInts();                      // Done with game loop, disable the interrupts.
  hitLedTimer_turnLedOff();                         // Save power
@@ -367,11 +319,14 @@ void game_freezeTag(void) {
 }
 
 
+// Services the bluetooth UART every BLUETOOTH_SERVICE_INTERVAL ticks and
+// tells the game loop when there is something to parse.
 void bluetooth_isr_function() {
- tickCount++;
- if (tickCount > BLUETOOTH_SERVICE_INTERVAL) {
-   bluetooth_poll();
-   tickCount = 0;
- }
+ if (++tickCount < BLUETOOTH_SERVICE_INTERVAL)
+   return;
+ tickCount = 0;
  bluetooth_poll();
+ const uint8_t *data;
+ if (bluetooth_receiveQueuePeek(&data))
+   bluetoothDataReady = true;
 }
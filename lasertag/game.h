@@ -10,6 +10,20 @@ Electrical and Computer Engineering, Brigham Young University, Utah, USA.
 #ifndef GAME_H_
 #define GAME_H_
 
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "gameState.h"
+
+#define GAME_DEFAULT_PLAYER_COUNT 4
+#define GAME_MAX_PLAYER_COUNT (GAMESTATE_MAX_PLAYERS - 1) // IDs start at 1.
+
+// Players 1 to count take part in game_freezeTag(), on alternating teams, and
+// count toward game over. Every gun in a game needs the same count. Call it
+// before game_freezeTag(). Returns false if count is not 1 to
+// GAME_MAX_PLAYER_COUNT.
+bool game_setPlayerCount(uint8_t count);
+
 // This game supports two teams, Team-A and Team-B.
 // Each team operates on its own configurable frequency.
 // Each player has a fixed set of lives and once they
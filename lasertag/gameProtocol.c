@@ -0,0 +1,281 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "bluetooth.h"
+#include "gameProtocol.h"
+
+#define EVENT_TYPE_SHIFT 5
+#define EVENT_PLAYER_MASK 0x1F
+
+// Parser states, one per field of the frame.
+typedef enum {
+  gameProtocol_huntSync_st, // Throwing bytes away until a SYNC shows up.
+  gameProtocol_length_st,
+  gameProtocol_type_st,
+  gameProtocol_sequence_st,
+  gameProtocol_payload_st,
+  gameProtocol_crc_st
+} gameProtocol_parserState_t;
+
+// CRC-8 (polynomial 0x07) of every byte value.
+static const uint8_t crcTable[256] = {
+    0x00, 0x07, 0x0E, 0x09, 0x1C, 0x1B, 0x12, 0x15, 0x38, 0x3F, 0x36, 0x31,
+    0x24, 0x23, 0x2A, 0x2D, 0x70, 0x77, 0x7E, 0x79, 0x6C, 0x6B, 0x62, 0x65,
+    0x48, 0x4F, 0x46, 0x41, 0x54, 0x53, 0x5A, 0x5D, 0xE0, 0xE7, 0xEE, 0xE9,
+    0xFC, 0xFB, 0xF2, 0xF5, 0xD8, 0xDF, 0xD6, 0xD1, 0xC4, 0xC3, 0xCA, 0xCD,
+    0x90, 0x97, 0x9E, 0x99, 0x8C, 0x8B, 0x82, 0x85, 0xA8, 0xAF, 0xA6, 0xA1,
+    0xB4, 0xB3, 0xBA, 0xBD, 0xC7, 0xC0, 0xC9, 0xCE, 0xDB, 0xDC, 0xD5, 0xD2,
+    0xFF, 0xF8, 0xF1, 0xF6, 0xE3, 0xE4, 0xED, 0xEA, 0xB7, 0xB0, 0xB9, 0xBE,
+    0xAB, 0xAC, 0xA5, 0xA2, 0x8F, 0x88, 0x81, 0x86, 0x93, 0x94, 0x9D, 0x9A,
+    0x27, 0x20, 0x29, 0x2E, 0x3B, 0x3C, 0x35, 0x32, 0x1F, 0x18, 0x11, 0x16,
+    0x03, 0x04, 0x0D, 0x0A, 0x57, 0x50, 0x59, 0x5E, 0x4B, 0x4C, 0x45, 0x42,
+    0x6F, 0x68, 0x61, 0x66, 0x73, 0x74, 0x7D, 0x7A, 0x89, 0x8E, 0x87, 0x80,
+    0x95, 0x92, 0x9B, 0x9C, 0xB1, 0xB6, 0xBF, 0xB8, 0xAD, 0xAA, 0xA3, 0xA4,
+    0xF9, 0xFE, 0xF7, 0xF0, 0xE5, 0xE2, 0xEB, 0xEC, 0xC1, 0xC6, 0xCF, 0xC8,
+    0xDD, 0xDA, 0xD3, 0xD4, 0x69, 0x6E, 0x67, 0x60, 0x75, 0x72, 0x7B, 0x7C,
+    0x51, 0x56, 0x5F, 0x58, 0x4D, 0x4A, 0x43, 0x44, 0x19, 0x1E, 0x17, 0x10,
+    0x05, 0x02, 0x0B, 0x0C, 0x21, 0x26, 0x2F, 0x28, 0x3D, 0x3A, 0x33, 0x34,
+    0x4E, 0x49, 0x40, 0x47, 0x52, 0x55, 0x5C, 0x5B, 0x76, 0x71, 0x78, 0x7F,
+    0x6A, 0x6D, 0x64, 0x63, 0x3E, 0x39, 0x30, 0x37, 0x22, 0x25, 0x2C, 0x2B,
+    0x06, 0x01, 0x08, 0x0F, 0x1A, 0x1D, 0x14, 0x13, 0xAE, 0xA9, 0xA0, 0xA7,
+    0xB2, 0xB5, 0xBC, 0xBB, 0x96, 0x91, 0x98, 0x9F, 0x8A, 0x8D, 0x84, 0x83,
+    0xDE, 0xD9, 0xD0, 0xD7, 0xC2, 0xC5, 0xCC, 0xCB, 0xE6, 0xE1, 0xE8, 0xEF,
+    0xFA, 0xFD, 0xF4, 0xF3};
+
+static gameProtocol_parser_t parser;          // Parses the receive queue.
+static gameProtocol_stats_t stats;            // Link statistics.
+static uint8_t batch[GAMEPROTOCOL_MAX_PAYLOAD]; // Events not yet sent.
+static uint8_t batchLength;
+static uint8_t transmitSequence;              // Sequence of the next frame.
+// Last events frame received from each player, valid where its bit is set in
+// receivedFromPlayers.
+static uint8_t lastReceivedSequence[GAMEPROTOCOL_MAX_PLAYERS];
+static uint32_t receivedFromPlayers;
+
+// Received events waiting for gameProtocol_readEvent().
+static gameProtocol_event_t events[GAMEPROTOCOL_EVENT_QUEUE_SIZE];
+static uint16_t eventsIn, eventsOut, eventCount;
+
+// Adds byte to a running CRC-8.
+static inline uint8_t crcUpdate(uint8_t crc, uint8_t byte) {
+  return crcTable[crc ^ byte];
+}
+
+// CRC-8, polynomial 0x07, initial value 0.
+uint8_t gameProtocol_crc8(const uint8_t data[], uint16_t size) {
+  uint8_t crc = 0;
+  for (uint16_t i = 0; i < size; i++)
+    crc = crcUpdate(crc, data[i]);
+  return crc;
+}
+
+// Builds a frame in frame[]. Returns the frame size, 0 if length is too big.
+uint16_t gameProtocol_encode(uint8_t type, uint8_t sequence,
+                             const uint8_t payload[], uint8_t length,
+                             uint8_t frame[]) {
+  if (length > GAMEPROTOCOL_MAX_PAYLOAD)
+    return 0;
+  frame[0] = GAMEPROTOCOL_SYNC;
+  frame[1] = length;
+  frame[2] = type;
+  frame[3] = sequence;
+  memcpy(&frame[GAMEPROTOCOL_HEADER_SIZE], payload, length);
+  uint16_t size = GAMEPROTOCOL_HEADER_SIZE + length;
+  frame[size] = gameProtocol_crc8(&frame[1], size - 1); // Everything but SYNC.
+  return size + GAMEPROTOCOL_CRC_SIZE;
+}
+
+// Packs an event into its payload byte.
+uint8_t gameProtocol_packEvent(gameProtocol_eventType_t type, uint8_t player) {
+  return (type << EVENT_TYPE_SHIFT) | (player & EVENT_PLAYER_MASK);
+}
+
+// Unpacks a payload byte.
+gameProtocol_event_t gameProtocol_unpackEvent(uint8_t payloadByte) {
+  gameProtocol_event_t event = {payloadByte >> EVENT_TYPE_SHIFT,
+                                payloadByte & EVENT_PLAYER_MASK};
+  return event;
+}
+
+// Resets the parser to hunt for a SYNC byte.
+void gameProtocol_parserInit(gameProtocol_parser_t *p) {
+  memset(p, 0, sizeof(*p));
+  p->state = gameProtocol_huntSync_st;
+}
+
+// Consumes one byte. Returns true when the byte completes a good frame.
+// A bad LENGTH or CRC drops the frame and goes back to hunting for SYNC.
+bool gameProtocol_parseByte(gameProtocol_parser_t *p, uint8_t byte) {
+  switch (p->state) {
+  case gameProtocol_huntSync_st:
+    if (byte == GAMEPROTOCOL_SYNC) {
+      p->crc = 0;
+      p->state = gameProtocol_length_st;
+    }
+    break;
+  case gameProtocol_length_st:
+    if (byte > GAMEPROTOCOL_MAX_PAYLOAD) {
+      p->lengthErrors++;
+      // The bad LENGTH might itself be the SYNC of the next frame.
+      p->state = byte == GAMEPROTOCOL_SYNC ? gameProtocol_length_st
+                                           : gameProtocol_huntSync_st;
+      break;
+    }
+    p->crc = crcUpdate(p->crc, byte);
+    p->frame.length = byte;
+    p->state = gameProtocol_type_st;
+    break;
+  case gameProtocol_type_st:
+    p->crc = crcUpdate(p->crc, byte);
+    p->frame.type = byte;
+    p->state = gameProtocol_sequence_st;
+    break;
+  case gameProtocol_sequence_st:
+    p->crc = crcUpdate(p->crc, byte);
+    p->frame.sequence = byte;
+    p->received = 0;
+    p->state = p->frame.length ? gameProtocol_payload_st : gameProtocol_crc_st;
+    break;
+  case gameProtocol_payload_st:
+    p->crc = crcUpdate(p->crc, byte);
+    p->frame.payload[p->received++] = byte;
+    if (p->received == p->frame.length)
+      p->state = gameProtocol_crc_st;
+    break;
+  case gameProtocol_crc_st:
+    p->state = gameProtocol_huntSync_st;
+    if (byte == p->crc)
+      return true;
+    p->crcErrors++;
+    break;
+  }
+  return false;
+}
+
+// Resets the batches, the parser and the statistics.
+void gameProtocol_init() {
+  gameProtocol_parserInit(&parser);
+  memset(&stats, 0, sizeof(stats));
+  batchLength = 0;
+  transmitSequence = 0;
+  receivedFromPlayers = 0;
+  eventsIn = eventsOut = eventCount = 0;
+}
+
+// Encodes and queues a frame for the bluetooth UART.
+// Returns false if the transmit queue did not have room for all of it.
+static bool sendFrame(uint8_t type, uint8_t sequence, const uint8_t payload[],
+                      uint8_t length) {
+  uint8_t frame[GAMEPROTOCOL_MAX_FRAME_SIZE];
+  uint16_t size = gameProtocol_encode(type, sequence, payload, length, frame);
+  // Check for room first so that a partial frame is never queued.
+  if (bluetooth_transmitQueueSpace() < size ||
+      bluetooth_transmitQueueWrite(frame, size) != size) {
+    printf("gameProtocol: bluetooth transmit queue is full.\n");
+    return false;
+  }
+  stats.framesSent++;
+  return true;
+}
+
+// Adds an event to the batch going out with the next gameProtocol_flush().
+bool gameProtocol_postEvent(gameProtocol_eventType_t type, uint8_t player) {
+  if (batchLength == GAMEPROTOCOL_MAX_PAYLOAD && !gameProtocol_flush()) {
+    stats.eventsDropped++;
+    return false;
+  }
+  batch[batchLength++] = gameProtocol_packEvent(type, player);
+  return true;
+}
+
+// Sends the batched events (if any) as one frame.
+bool gameProtocol_flush() {
+  if (batchLength == 0)
+    return true;
+  bool sent = sendFrame(gameProtocol_eventsFrame_e, transmitSequence++, batch,
+                        batchLength);
+  if (sent)
+    stats.eventsSent += batchLength;
+  else
+    stats.eventsDropped += batchLength;
+  batchLength = 0;
+  return sent;
+}
+
+// Handles a good frame from the parser.
+static uint16_t handleFrame(const gameProtocol_frame_t *frame) {
+  stats.framesReceived++;
+  if (frame->type != gameProtocol_eventsFrame_e)
+    return 0; // Ignore frame types from newer versions.
+  // Every gun numbers its own frames, and only puts its own events in them,
+  // so the player of the first event says whose sequence this is.
+  if (frame->length) {
+    uint8_t sender = gameProtocol_unpackEvent(frame->payload[0]).player;
+    uint32_t senderBit = (uint32_t)1 << sender;
+    if (receivedFromPlayers & senderBit) {
+      uint8_t step = frame->sequence - lastReceivedSequence[sender];
+      if (step == 0 || step > GAMEPROTOCOL_MAX_SEQUENCE_STEP) {
+        stats.staleFrames++; // Its events are old news.
+        return 0;
+      }
+      stats.sequenceGaps += step - 1;
+    }
+    lastReceivedSequence[sender] = frame->sequence;
+    receivedFromPlayers |= senderBit;
+  }
+  uint16_t newEvents = 0;
+  for (uint8_t i = 0; i < frame->length; i++) {
+    if (eventCount == GAMEPROTOCOL_EVENT_QUEUE_SIZE) {
+      stats.eventsDropped++;
+      continue;
+    }
+    events[eventsIn] = gameProtocol_unpackEvent(frame->payload[i]);
+    eventsIn = (eventsIn + 1) % GAMEPROTOCOL_EVENT_QUEUE_SIZE;
+    eventCount++;
+    newEvents++;
+  }
+  stats.eventsReceived += newEvents;
+  return newEvents;
+}
+
+// Reads everything in the bluetooth receive queue and parses it in place.
+uint16_t gameProtocol_receive() {
+  const uint8_t *data;
+  uint16_t bytesAvailable;
+  uint16_t newEvents = 0;
+  // The queue hands out at most two spans (before and after it wraps).
+  while ((bytesAvailable = bluetooth_receiveQueuePeek(&data))) {
+    for (uint16_t i = 0; i < bytesAvailable; i++) {
+      if (gameProtocol_parseByte(&parser, data[i]))
+        newEvents += handleFrame(&parser.frame);
+    }
+    bluetooth_receiveQueueConsume(bytesAvailable);
+  }
+  return newEvents;
+}
+
+// Pops the oldest received event. Returns false if there are none.
+bool gameProtocol_readEvent(gameProtocol_event_t *event) {
+  if (eventCount == 0)
+    return false;
+  *event = events[eventsOut];
+  eventsOut = (eventsOut + 1) % GAMEPROTOCOL_EVENT_QUEUE_SIZE;
+  eventCount--;
+  return true;
+}
+
+// Copies the link statistics.
+void gameProtocol_getStats(gameProtocol_stats_t *copy) {
+  *copy = stats;
+  copy->crcErrors = parser.crcErrors;
+  copy->lengthErrors = parser.lengthErrors;
+}
@@ -0,0 +1,135 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef GAMEPROTOCOL_H_
+#define GAMEPROTOCOL_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Binary framing for the game messages sent over the 9600-baud bluetooth link.
+// Several game events are coalesced into one frame:
+//
+//   SYNC | LENGTH | TYPE | SEQUENCE | PAYLOAD[LENGTH] | CRC-8
+//
+// LENGTH counts the payload bytes only. The CRC (polynomial 0x07) covers
+// LENGTH through the end of the payload. Each event in an events frame is one
+// byte: the event type in the upper 3 bits and the player (0-31) in the lower
+// 5 bits. A gun only sends events about itself, so the player of the first
+// event is also the sender, and each sender numbers its frames on its own.
+// Frames are not acknowledged or resent: every gun hears every other gun, so
+// an ack per frame would multiply the traffic by the number of guns. Missing
+// frames are only counted (sequenceGaps). A frame up to
+// GAMEPROTOCOL_MAX_SEQUENCE_STEP ahead of the sender's last one is new, any
+// other is a duplicate or arrived late and its events are discarded.
+//
+// The encoder and parser are pure C. gameProtocol_flush() and
+// gameProtocol_receive() move the frames through the bluetooth queues.
+
+#define GAMEPROTOCOL_SYNC 0xA5
+#define GAMEPROTOCOL_HEADER_SIZE 4  // SYNC, LENGTH, TYPE, SEQUENCE.
+#define GAMEPROTOCOL_CRC_SIZE 1
+#define GAMEPROTOCOL_MAX_PAYLOAD 16 // Events per frame.
+#define GAMEPROTOCOL_MAX_FRAME_SIZE                                            \
+  (GAMEPROTOCOL_HEADER_SIZE + GAMEPROTOCOL_MAX_PAYLOAD + GAMEPROTOCOL_CRC_SIZE)
+#define GAMEPROTOCOL_MAX_PLAYERS 32 // Players fit in 5 bits.
+#define GAMEPROTOCOL_EVENT_QUEUE_SIZE 32 // Received events not yet read.
+#define GAMEPROTOCOL_MAX_SEQUENCE_STEP 127 // Half the 8-bit sequence space.
+
+// Frame types.
+typedef enum {
+  gameProtocol_eventsFrame_e = 1 // Payload is a list of events.
+} gameProtocol_frameType_t;
+
+// Event types, 3 bits. There is no game-over event: every gun works out that
+// the game is over from the freeze events (gameState_isOver()).
+typedef enum {
+  gameProtocol_frozen_e = 1,  // Player was frozen.
+  gameProtocol_unfrozen_e = 2 // Player was unfrozen.
+} gameProtocol_eventType_t;
+
+typedef struct {
+  gameProtocol_eventType_t type;
+  uint8_t player;
+} gameProtocol_event_t;
+
+// A decoded frame.
+typedef struct {
+  uint8_t type;     // One of gameProtocol_frameType_t.
+  uint8_t sequence; // Sender's frame number, wraps.
+  uint8_t length;   // Number of payload bytes.
+  uint8_t payload[GAMEPROTOCOL_MAX_PAYLOAD];
+} gameProtocol_frame_t;
+
+// Incremental parser, feed it bytes as they arrive.
+typedef struct {
+  uint8_t state;              // Where in the frame the parser is.
+  uint8_t received;           // Payload bytes received so far.
+  uint8_t crc;                // CRC of the frame so far.
+  gameProtocol_frame_t frame; // Frame being assembled / last good frame.
+  uint32_t crcErrors;         // Frames dropped because of a bad CRC.
+  uint32_t lengthErrors;      // Frames dropped because of a bad LENGTH.
+} gameProtocol_parser_t;
+
+// Link statistics, see gameProtocol_getStats().
+typedef struct {
+  uint32_t framesSent;
+  uint32_t framesReceived;
+  uint32_t eventsSent;
+  uint32_t eventsReceived;
+  uint32_t sequenceGaps;   // Events frames missing, counted per sender.
+  uint32_t staleFrames;    // Duplicate or late events frames, discarded.
+  uint32_t crcErrors;      // Frames dropped because of a bad CRC.
+  uint32_t lengthErrors;   // Frames dropped because of a bad LENGTH.
+  uint32_t eventsDropped;  // Events lost because a queue was full.
+} gameProtocol_stats_t;
+
+// CRC-8, polynomial 0x07, initial value 0.
+uint8_t gameProtocol_crc8(const uint8_t data[], uint16_t size);
+
+// Builds a frame in frame[] (at least GAMEPROTOCOL_MAX_FRAME_SIZE bytes).
+// Returns the frame size, 0 if length is too big.
+uint16_t gameProtocol_encode(uint8_t type, uint8_t sequence,
+                             const uint8_t payload[], uint8_t length,
+                             uint8_t frame[]);
+
+// Packs an event into its payload byte and back.
+uint8_t gameProtocol_packEvent(gameProtocol_eventType_t type, uint8_t player);
+gameProtocol_event_t gameProtocol_unpackEvent(uint8_t payloadByte);
+
+// Resets the parser to hunt for a SYNC byte.
+void gameProtocol_parserInit(gameProtocol_parser_t *parser);
+
+// Consumes one byte. Returns true when the byte completes a frame with a good
+// CRC; the frame is then in parser->frame until the next byte is consumed.
+bool gameProtocol_parseByte(gameProtocol_parser_t *parser, uint8_t byte);
+
+// Resets the batches, the parser and the statistics.
+void gameProtocol_init();
+
+// Adds an event to the batch going out with the next gameProtocol_flush().
+// The batch is flushed early if it fills up. Returns false if the event could
+// not be queued (bluetooth transmit queue full).
+bool gameProtocol_postEvent(gameProtocol_eventType_t type, uint8_t player);
+
+// Sends the batched events (if any) as one frame.
+// Returns false if the bluetooth transmit queue did not have room.
+bool gameProtocol_flush();
+
+// Reads everything in the bluetooth receive queue, parses it, queues the
+// received events. Returns the number of new events.
+uint16_t gameProtocol_receive();
+
+// Pops the oldest received event. Returns false if there are none.
+bool gameProtocol_readEvent(gameProtocol_event_t *event);
+
+// Copies the link statistics.
+void gameProtocol_getStats(gameProtocol_stats_t *stats);
+
+#endif /* GAMEPROTOCOL_H_ */
@@ -0,0 +1,115 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#include "gameState.h"
+
+static gameState_players_t players; // Everyone in the game.
+static gameState_players_t frozen;  // Subset of players.
+static gameState_players_t teamPlayers[GAMESTATE_MAX_TEAMS];
+static uint8_t teamsWithPlayers; // Bit per team, set if the team has players.
+static uint8_t teamsStanding;    // Bit per team, set if anyone is unfrozen.
+
+// Recomputes the standing bit of a team.
+static void updateTeam(uint8_t team) {
+  uint8_t teamBit = 1 << team;
+  if (teamPlayers[team] & ~frozen)
+    teamsStanding |= teamBit;
+  else
+    teamsStanding &= ~teamBit;
+}
+
+// Removes all players, nobody is frozen.
+void gameState_init() {
+  players = 0;
+  frozen = 0;
+  for (uint8_t team = 0; team < GAMESTATE_MAX_TEAMS; team++)
+    teamPlayers[team] = 0;
+  teamsWithPlayers = 0;
+  teamsStanding = 0;
+}
+
+// Adds a player to a team. Returns false if player or team is out of range.
+bool gameState_addPlayer(uint8_t player, uint8_t team) {
+  if (player >= GAMESTATE_MAX_PLAYERS || team >= GAMESTATE_MAX_TEAMS)
+    return false;
+  gameState_players_t bit = GAMESTATE_PLAYER_BIT(player);
+  // A player can only be on one team.
+  if (players & bit) {
+    uint8_t oldTeam = gameState_getTeam(player);
+    teamPlayers[oldTeam] &= ~bit;
+    if (teamPlayers[oldTeam] == 0)
+      teamsWithPlayers &= ~(1 << oldTeam);
+    updateTeam(oldTeam);
+  }
+  players |= bit;
+  teamPlayers[team] |= bit;
+  teamsWithPlayers |= 1 << team;
+  updateTeam(team);
+  return true;
+}
+
+// Records a frozen/unfrozen event. Returns false if the player is not in the
+// game.
+bool gameState_setFrozen(uint8_t player, bool isFrozen) {
+  if (player >= GAMESTATE_MAX_PLAYERS ||
+      !(players & GAMESTATE_PLAYER_BIT(player)))
+    return false;
+  if (isFrozen)
+    frozen |= GAMESTATE_PLAYER_BIT(player);
+  else
+    frozen &= ~GAMESTATE_PLAYER_BIT(player);
+  updateTeam(gameState_getTeam(player));
+  return true;
+}
+
+// True if the player is in the game and frozen.
+bool gameState_isFrozen(uint8_t player) {
+  return player < GAMESTATE_MAX_PLAYERS &&
+         (frozen & GAMESTATE_PLAYER_BIT(player));
+}
+
+// Team of the player, GAMESTATE_MAX_TEAMS if the player is not in the game.
+uint8_t gameState_getTeam(uint8_t player) {
+  if (player >= GAMESTATE_MAX_PLAYERS)
+    return GAMESTATE_MAX_TEAMS;
+  gameState_players_t bit = GAMESTATE_PLAYER_BIT(player);
+  uint8_t remaining = teamsWithPlayers;
+  // Only the teams that have players are looked at.
+  while (remaining) {
+    uint8_t team = __builtin_ctz(remaining);
+    if (teamPlayers[team] & bit)
+      return team;
+    remaining &= remaining - 1;
+  }
+  return GAMESTATE_MAX_TEAMS;
+}
+
+// Bitset of everyone in the game.
+gameState_players_t gameState_getPlayers() { return players; }
+
+// Bitset of the players on a team.
+gameState_players_t gameState_getTeamPlayers(uint8_t team) {
+  return team < GAMESTATE_MAX_TEAMS ? teamPlayers[team] : 0;
+}
+
+// Bitset of the frozen players.
+gameState_players_t gameState_getFrozenPlayers() { return frozen; }
+
+// Number of frozen players on a team.
+uint8_t gameState_getFrozenCount(uint8_t team) {
+  return __builtin_popcount(gameState_getTeamPlayers(team) & frozen);
+}
+
+// Number of teams that still have at least one unfrozen player.
+uint8_t gameState_getTeamsStanding() {
+  return __builtin_popcount(teamsStanding);
+}
+
+// The game is over when at most one team still has an unfrozen player.
+bool gameState_isOver() { return gameState_getTeamsStanding() <= 1; }
@@ -0,0 +1,60 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef GAMESTATE_H_
+#define GAMESTATE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Who is playing, on which team, and who is frozen, for games of up to
+// GAMESTATE_MAX_PLAYERS players. Everything is kept as bitsets indexed by
+// player ID (bit n is player n), so updates and the win condition are a few
+// mask operations no matter how many players there are.
+
+#define GAMESTATE_MAX_PLAYERS 32 // Player IDs are 0-31, same as gameProtocol.
+#define GAMESTATE_MAX_TEAMS 8
+
+// One bit per player ID.
+typedef uint32_t gameState_players_t;
+
+// The bit for a player ID.
+#define GAMESTATE_PLAYER_BIT(player) ((gameState_players_t)1 << (player))
+
+// Removes all players, nobody is frozen.
+void gameState_init();
+
+// Adds a player to a team. Returns false if player or team is out of range.
+bool gameState_addPlayer(uint8_t player, uint8_t team);
+
+// Records a frozen/unfrozen event. Returns false if the player is not in the
+// game.
+bool gameState_setFrozen(uint8_t player, bool frozen);
+
+// True if the player is in the game and frozen.
+bool gameState_isFrozen(uint8_t player);
+
+// Team of the player, GAMESTATE_MAX_TEAMS if the player is not in the game.
+uint8_t gameState_getTeam(uint8_t player);
+
+// Bitsets of the players in the game, on a team and currently frozen.
+gameState_players_t gameState_getPlayers();
+gameState_players_t gameState_getTeamPlayers(uint8_t team);
+gameState_players_t gameState_getFrozenPlayers();
+
+// Number of frozen players on a team.
+uint8_t gameState_getFrozenCount(uint8_t team);
+
+// Number of teams that still have at least one unfrozen player.
+uint8_t gameState_getTeamsStanding();
+
+// The game is over when at most one team still has an unfrozen player.
+bool gameState_isOver();
+
+#endif /* GAMESTATE_H_ */
@@ -5,6 +5,7 @@
 #include "leds.h"
 #include "utils.h"
 #include "buttons.h"
+#include "idle.h"
 #define LED_OUTPUT_PIN 11
 #define LED_HIGH_VALUE 1
 #define LED_LOW_VALUE 0
@@ -149,7 +150,9 @@ void hitLedTimer_runTest() {
     // When button 3 isn't pressed this will run the test
     while(!(buttons_read() & BUTTONS_BTN3_MASK)) {
         hitLedTimer_start();
-        while (hitLedTimer_running()) {}
+        while (hitLedTimer_running()) {
+            idle_run();
+        }
         utils_msDelay(TEST_DELAY);
     }
     do
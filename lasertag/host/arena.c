@@ -0,0 +1,596 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+// Headless arena: N guns (lasertagHost -arena, one process each, running the
+// real transmitter, trigger, detector and game code) on simulated time,
+// advanced in lockstep as fast as the CPU allows.
+//
+// The guns stand at random places on a square field. Every step the arena
+// reads each gun's transmitter pin and hit LED, and builds the ADC samples
+// for the next step: the sum of every transmitter's square wave, scaled by
+// distance (-range is where the signal is down to half) and by whether the
+// shooter is aiming at this gun (-crosstalk otherwise), plus a weaker copy
+// -echoTicks later (-echo, multipath), through the receiver's AC coupling,
+// plus noise. Shots that overlap interfere the way they would in the air.
+// Light takes one step to get from a transmitter to the receivers. The
+// bluetooth bytes each gun sends are collected until the gun stops sending
+// for a step, then the burst reaches every other gun -delay ms later, unless
+// it is lost (-loss).
+//
+// Each gun pulls the trigger (BTN0) at a random time every -shotEvery ms on
+// average, aimed at a random other gun. A hit LED turning on counts as a hit
+// if a shot aimed at that gun was on the air, otherwise it is a false hit.
+//
+//   arena [-players N] [-seconds S] [-step MS] [-shotEvery MS] [-field M]
+//         [-range M] [-amplitude COUNTS] [-crosstalk G] [-echo G]
+//         [-echoTicks N] [-noise COUNTS] [-delay MS] [-loss P] [-seed N]
+//         [-socket PATH] [-host PATH] [-capture PREFIX] [-journal PREFIX]
+//
+// -journal records each gun's inputs to PREFIXn.ltij, so that any one gun's
+// game can be run again on its own with lasertagHost -replay.
+
+#include <fcntl.h>
+#include <limits.h>
+#include <math.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "arenaLink.h"
+#include "buttons.h"
+
+#define MAX_PLAYERS 16
+#define TICKS_PER_MS (1000 / HOSTBOARD_US_PER_TICK)
+#define US_PER_MS 1000
+#define NS_PER_SECOND 1000000000.0
+#define TRANSMITTER_PIN 13 // As in transmitter.c.
+#define HIT_LED_PIN 11     // As in hitLedTimer.c.
+#define ADC_MAX 4095
+#define HISTORY_TICKS 4096 // Transmitter history, a power of 2.
+#define MAX_ECHO_TICKS (HISTORY_TICKS - HOSTBOARD_MAX_STEP_TICKS)
+#define SHOT_GAP_TICKS (10 * TICKS_PER_MS) // Quiet this long ends a shot.
+// The detector's power window is 200 ms, so a hit can register this long
+// after the shot ends (e.g. when a lockout runs out).
+#define HIT_MARGIN_TICKS (250 * TICKS_PER_MS)
+#define MAX_SHOT_TICKS (1000 * TICKS_PER_MS) // Shots are 200 ms.
+#define TRIGGER_HOLD_MS 100  // Longer than the trigger's 50 ms debounce.
+#define FIRST_SHOT_MS 3000   // game_freezeTag() spends about 2 s starting.
+#define TAIL_MS 5000         // Longest wait for the guns to finish.
+#define RECEIVER_CUTOFF_HZ 100.0 // AC coupling of the IR receiver.
+#define MAX_SHOTS 65536
+#define LINK_QUEUE_SIZE 65536 // Bluetooth bytes in flight per gun, power of 2.
+#define BURST_SIZE 256 // Longest burst of bluetooth bytes sent as one.
+#define ACCEPT_TIMEOUT_MS 10000
+#define LATENCY_BUCKET_MS 25
+#define LATENCY_BUCKET_COUNT 12 // The last bucket holds everything longer.
+#define PERCENTILE_COUNT 5
+#define HOST_PROGRAM "lasertagHost"
+#define ARG_SIZE 256
+#define HOST_ARG_COUNT 9
+#define CAPTURE_ARG_COUNT 2 // -capture <file>, when capturing.
+#define JOURNAL_ARG_COUNT 2 // -journal <file>, when recording.
+#define MAX_ARG_COUNT (HOST_ARG_COUNT + CAPTURE_ARG_COUNT + JOURNAL_ARG_COUNT)
+
+typedef struct {
+  int fd;
+  bool connected;
+  pid_t pid;
+  double x, y;          // Position on the field, meters.
+  uint8_t target;       // Gun being aimed at.
+  uint64_t nextShotTick;
+  uint64_t releaseTick; // BTN0 is held until then.
+  uint8_t txHistory[HISTORY_TICKS]; // Transmitter pin by tick.
+  bool txLevel;
+  uint64_t lastToggleTick;
+  int32_t shot;         // Shot on the air, -1 if none.
+  bool ledOn;
+  double receiverIn, receiverOut; // AC-coupling filter state.
+  uint32_t noiseSeed;
+  // Bluetooth bytes on their way to this gun, with the step they arrive in.
+  uint8_t linkData[LINK_QUEUE_SIZE];
+  uint64_t linkStep[LINK_QUEUE_SIZE];
+  uint32_t linkIn, linkOut;
+  uint8_t burst[BURST_SIZE]; // Bytes this gun is sending.
+  uint16_t burstLength;
+  // Statistics.
+  uint32_t shotsFired;
+  uint32_t shotsAimed; // Shots aimed at this gun.
+  uint32_t hits;
+  uint32_t falseHits;
+  uint32_t linkBytesLost;
+} gun_t;
+
+typedef struct {
+  uint8_t shooter;
+  uint8_t target;
+  uint64_t startTick;
+  uint64_t endTick;
+  bool hit;
+} shot_t;
+
+// Settings.
+static uint8_t players = 8;
+static double seconds = 60;
+static uint32_t stepMs = 1;
+static uint32_t shotEveryMs = 3000;
+static double fieldMeters = 20;
+static double rangeMeters = 10;
+static double amplitude = 2000; // Peak to peak at the receiver, close up.
+static double crosstalk = 0.01;
+static double echo = 0.3;
+static uint32_t echoTicks = 3;
+static uint32_t noise = 8;
+static uint32_t delayMs = 20;
+static double lossProbability;
+static char socketPath[sizeof(((struct sockaddr_un *)0)->sun_path)];
+static char hostPath[PATH_MAX];
+static const char *capturePrefix; // Gun n captures to <prefix>n.ltcap.
+static const char *journalPrefix; // Gun n records to <prefix>n.ltij.
+
+static gun_t guns[MAX_PLAYERS + 1]; // Indexed by player, 1-based.
+static double gain[MAX_PLAYERS + 1][MAX_PLAYERS + 1]; // [from][to], aimed.
+static shot_t shots[MAX_SHOTS];
+static uint32_t shotCount;
+static double latenciesMs[MAX_SHOTS];
+static uint32_t latencyCount;
+static uint16_t stepTicks;
+static uint64_t simulatedTicks;
+
+static double randomUnit() { return (double)rand() / ((double)RAND_MAX + 1); }
+
+static double nowSeconds() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / NS_PER_SECOND;
+}
+
+// Places the guns and works out how strongly each one is seen by the others.
+static void placeGuns() {
+  for (uint8_t player = 1; player <= players; player++) {
+    guns[player].x = randomUnit() * fieldMeters;
+    guns[player].y = randomUnit() * fieldMeters;
+    guns[player].shot = -1;
+    guns[player].noiseSeed = player;
+    guns[player].nextShotTick =
+        (FIRST_SHOT_MS + randomUnit() * shotEveryMs) * TICKS_PER_MS;
+  }
+  double rangeSquared = rangeMeters * rangeMeters;
+  for (uint8_t from = 1; from <= players; from++) {
+    for (uint8_t to = 1; to <= players; to++) {
+      double dx = guns[from].x - guns[to].x;
+      double dy = guns[from].y - guns[to].y;
+      gain[from][to] = from == to ? 0
+                                  : amplitude * rangeSquared /
+                                        (rangeSquared + dx * dx + dy * dy);
+    }
+  }
+}
+
+static void startGuns() {
+  char args[MAX_ARG_COUNT][ARG_SIZE];
+  char *argv[MAX_ARG_COUNT + 1];
+  for (uint8_t player = 1; player <= players; player++) {
+    snprintf(args[0], ARG_SIZE, "%s", HOST_PROGRAM);
+    snprintf(args[1], ARG_SIZE, "-arena");
+    snprintf(args[2], ARG_SIZE, "%.*s", ARG_SIZE - 1, socketPath);
+    snprintf(args[3], ARG_SIZE, "-player");
+    snprintf(args[4], ARG_SIZE, "%d", player);
+    snprintf(args[5], ARG_SIZE, "-step");
+    snprintf(args[6], ARG_SIZE, "%d", stepTicks);
+    snprintf(args[7], ARG_SIZE, "-players");
+    snprintf(args[8], ARG_SIZE, "%d", players);
+    uint16_t argCount = HOST_ARG_COUNT;
+    if (capturePrefix) {
+      snprintf(args[argCount++], ARG_SIZE, "-capture");
+      snprintf(args[argCount++], ARG_SIZE, "%.*s%d.ltcap", ARG_SIZE - 16,
+               capturePrefix, player);
+    }
+    if (journalPrefix) {
+      snprintf(args[argCount++], ARG_SIZE, "-journal");
+      snprintf(args[argCount++], ARG_SIZE, "%.*s%d.ltij", ARG_SIZE - 16,
+               journalPrefix, player);
+    }
+    for (uint16_t i = 0; i < argCount; i++)
+      argv[i] = args[i];
+    argv[argCount] = NULL;
+    pid_t pid = fork();
+    if (pid == 0) {
+      execv(hostPath, argv);
+      printf("arena: unable to run %s.\n", hostPath);
+      _exit(1);
+    }
+    guns[player].pid = pid;
+  }
+}
+
+// Waits for all of the guns to connect and say which player they are.
+static bool acceptGuns(int listener) {
+  for (uint8_t connected = 0; connected < players;) {
+    struct pollfd pfd = {.fd = listener, .events = POLLIN};
+    if (poll(&pfd, 1, ACCEPT_TIMEOUT_MS) <= 0) {
+      printf("arena: only %d of %d guns connected.\n", connected, players);
+      return false;
+    }
+    int fd = accept(listener, NULL, NULL);
+    uint8_t player;
+    if (fd < 0 || read(fd, &player, 1) != 1 || player < 1 ||
+        player > players || guns[player].connected) {
+      printf("arena: rejected a connection.\n");
+      if (fd >= 0)
+        close(fd);
+      continue;
+    }
+    guns[player].fd = fd;
+    guns[player].connected = true;
+    connected++;
+  }
+  return true;
+}
+
+// The hit LED of receiver came on at tick.
+static void recordHit(uint8_t receiver, uint64_t tick) {
+  // Shots are in start order, so only the last few can still be on the air.
+  for (int32_t s = shotCount - 1;
+       s >= 0 &&
+       shots[s].startTick + MAX_SHOT_TICKS + HIT_MARGIN_TICKS >= tick;
+       s--) {
+    shot_t *shot = &shots[s];
+    if (shot->target == receiver && !shot->hit &&
+        tick <= shot->endTick + HIT_MARGIN_TICKS) {
+      shot->hit = true;
+      guns[receiver].hits++;
+      latenciesMs[latencyCount++] =
+          (double)(tick - shot->startTick) / TICKS_PER_MS;
+      return;
+    }
+  }
+  guns[receiver].falseHits++;
+}
+
+// Follows the transmitter and the hit LED through the last step's pins.
+static void readTrace(uint8_t player, const arenaLink_result_t *result,
+                      uint64_t firstTick) {
+  gun_t *gun = &guns[player];
+  for (uint16_t k = 0; k < result->tickCount; k++) {
+    uint64_t tick = firstTick + k;
+    bool tx = result->pins[k] >> TRANSMITTER_PIN & 1;
+    bool led = result->pins[k] >> HIT_LED_PIN & 1;
+    gun->txHistory[tick & (HISTORY_TICKS - 1)] = tx;
+    if (tx != gun->txLevel) {
+      gun->txLevel = tx;
+      if (gun->shot < 0 && shotCount < MAX_SHOTS) {
+        gun->shot = shotCount;
+        shots[shotCount++] = (shot_t){.shooter = player,
+                                      .target = gun->target,
+                                      .startTick = tick,
+                                      .endTick = tick};
+        gun->shotsFired++;
+        guns[gun->target].shotsAimed++;
+      }
+      gun->lastToggleTick = tick;
+      if (gun->shot >= 0)
+        shots[gun->shot].endTick = tick;
+    } else if (gun->shot >= 0 && tick - gun->lastToggleTick > SHOT_GAP_TICKS) {
+      gun->shot = -1;
+    }
+    if (led && !gun->ledOn)
+      recordHit(player, tick);
+    gun->ledOn = led;
+  }
+}
+
+// Sends a burst of bytes to every other gun.
+static void broadcast(uint8_t sender, const uint8_t data[], uint16_t length,
+                      uint64_t step) {
+  uint64_t arrivalStep = step + (delayMs + stepMs - 1) / stepMs;
+  for (uint8_t player = 1; player <= players; player++) {
+    gun_t *gun = &guns[player];
+    if (player == sender || !gun->connected)
+      continue;
+    if (randomUnit() < lossProbability) {
+      gun->linkBytesLost += length;
+      continue;
+    }
+    for (uint16_t i = 0; i < length; i++) {
+      if (gun->linkIn - gun->linkOut == LINK_QUEUE_SIZE) {
+        gun->linkBytesLost++;
+        continue;
+      }
+      uint32_t slot = gun->linkIn++ & (LINK_QUEUE_SIZE - 1);
+      gun->linkData[slot] = data[i];
+      gun->linkStep[slot] = arrivalStep;
+    }
+  }
+}
+
+// Collects the bytes a gun sent during the last step. A burst goes out when
+// the gun stops sending, so that bursts from different guns do not mix.
+static void collectBurst(uint8_t sender, const arenaLink_result_t *result,
+                         uint64_t step) {
+  gun_t *gun = &guns[sender];
+  if (result->uartCount == 0 || gun->burstLength == BURST_SIZE) {
+    broadcast(sender, gun->burst, gun->burstLength, step);
+    gun->burstLength = 0;
+  }
+  for (uint8_t i = 0; i < result->uartCount; i++) {
+    if (gun->burstLength == BURST_SIZE) {
+      broadcast(sender, gun->burst, gun->burstLength, step);
+      gun->burstLength = 0;
+    }
+    gun->burst[gun->burstLength++] = result->uart[i];
+  }
+}
+
+// ADC samples for receiver over the next step. What left the transmitters
+// during the last step arrives now.
+static void buildSamples(uint8_t receiver, uint64_t firstTick,
+                         arenaLink_step_t *step) {
+  gun_t *gun = &guns[receiver];
+  double dt = HOSTBOARD_US_PER_TICK / 1e6;
+  double rc = 1 / (2 * M_PI * RECEIVER_CUTOFF_HZ);
+  double alpha = rc / (rc + dt);
+  double gains[MAX_PLAYERS + 1];
+  for (uint8_t from = 1; from <= players; from++)
+    gains[from] = gain[from][receiver] *
+                  (guns[from].target == receiver ? 1 : crosstalk);
+  for (uint16_t k = 0; k < stepTicks; k++) {
+    uint64_t tick = firstTick + k - stepTicks;
+    uint64_t echoTick = tick - echoTicks;
+    double in = 0;
+    for (uint8_t from = 1; from <= players; from++) {
+      const uint8_t *history = guns[from].txHistory;
+      in += gains[from] * (history[tick & (HISTORY_TICKS - 1)] +
+                           echo * history[echoTick & (HISTORY_TICKS - 1)]);
+    }
+    gun->receiverOut = alpha * (gun->receiverOut + in - gun->receiverIn);
+    gun->receiverIn = in;
+    double value = HOSTBOARD_ADC_MIDSCALE + gun->receiverOut;
+    if (noise) {
+      gun->noiseSeed = gun->noiseSeed * 1103515245 + 12345;
+      value += (double)((gun->noiseSeed >> 16) % (noise + 1)) - noise / 2.0;
+    }
+    step->adc[k] = value < 0 ? 0 : value > ADC_MAX ? ADC_MAX : value;
+  }
+  step->tickCount = stepTicks;
+}
+
+// Pulls triggers and, at the end, presses BTN3 on every gun.
+static uint8_t buttons(uint8_t player, uint64_t firstTick, uint64_t endTick) {
+  gun_t *gun = &guns[player];
+  if (firstTick >= endTick)
+    return BUTTONS_BTN3_MASK;
+  if (firstTick >= gun->nextShotTick) {
+    do
+      gun->target = 1 + rand() % players;
+    while (gun->target == player);
+    gun->releaseTick = firstTick + TRIGGER_HOLD_MS * TICKS_PER_MS;
+    gun->nextShotTick +=
+        (uint64_t)((0.5 + randomUnit()) * shotEveryMs * TICKS_PER_MS);
+  }
+  return firstTick < gun->releaseTick ? BUTTONS_BTN0_MASK : 0;
+}
+
+// Steps all of the guns until they have all finished.
+static void run() {
+  static arenaLink_result_t result;
+  static arenaLink_step_t step;
+  uint64_t endTick = (uint64_t)(seconds * 1000) * TICKS_PER_MS;
+  uint64_t lastTick = endTick + (uint64_t)TAIL_MS * TICKS_PER_MS;
+  for (uint64_t s = 0;; s++) {
+    uint64_t firstTick = s * stepTicks;
+    uint8_t connected = 0;
+    for (uint8_t player = 1; player <= players; player++) {
+      gun_t *gun = &guns[player];
+      if (!gun->connected)
+        continue;
+      if (!arenaLink_receiveResult(gun->fd, &result)) {
+        close(gun->fd);
+        gun->connected = false; // The gun's game is over.
+        continue;
+      }
+      connected++;
+      readTrace(player, &result, firstTick - result.tickCount);
+      collectBurst(player, &result, s);
+    }
+    if (connected == 0 || firstTick >= lastTick)
+      break;
+    for (uint8_t player = 1; player <= players; player++) {
+      gun_t *gun = &guns[player];
+      if (!gun->connected)
+        continue;
+      step.buttons = buttons(player, firstTick, endTick);
+      buildSamples(player, firstTick, &step);
+      step.uartCount = 0;
+      while (gun->linkOut != gun->linkIn &&
+             step.uartCount < ARENALINK_MAX_UART_BYTES) {
+        uint32_t slot = gun->linkOut & (LINK_QUEUE_SIZE - 1);
+        if (gun->linkStep[slot] > s)
+          break;
+        step.uart[step.uartCount++] = gun->linkData[slot];
+        gun->linkOut++;
+      }
+      if (!arenaLink_sendStep(gun->fd, &step)) {
+        close(gun->fd);
+        gun->connected = false;
+      }
+    }
+    simulatedTicks = firstTick + stepTicks;
+  }
+}
+
+static int compareDoubles(const void *a, const void *b) {
+  double x = *(const double *)a, y = *(const double *)b;
+  return (x > y) - (x < y);
+}
+
+static void report(double wallSeconds) {
+  double simulatedSeconds = (double)simulatedTicks / TICKS_PER_MS / 1000;
+  printf("\narena: %d guns on %.0f m x %.0f m, %.1f s simulated in %.1f s "
+         "(%.2f simulated seconds per second), %u ms steps\n",
+         players, fieldMeters, fieldMeters, simulatedSeconds, wallSeconds,
+         simulatedSeconds / wallSeconds, stepMs);
+  printf("gun  team  x (m)  y (m)  shots  aimed at  hits  false hits  "
+         "bytes lost\n");
+  uint32_t fired = 0, aimedHits = 0, falseHits = 0;
+  for (uint8_t player = 1; player <= players; player++) {
+    gun_t *gun = &guns[player];
+    printf("%3d  %4d  %5.1f  %5.1f  %5u  %8u  %4u  %10u  %10u\n", player,
+           (player - 1) % 2, gun->x, gun->y, gun->shotsFired, gun->shotsAimed,
+           gun->hits, gun->falseHits, gun->linkBytesLost);
+    fired += gun->shotsFired;
+    aimedHits += gun->hits;
+    falseHits += gun->falseHits;
+  }
+  printf("shots: %u fired, %u registered as hits (%.1f%%)\n", fired,
+         aimedHits, fired ? 100.0 * aimedHits / fired : 0);
+  printf("false hits: %u, %.2f per gun per minute\n", falseHits,
+         simulatedSeconds > 0 ? falseHits / (players * simulatedSeconds / 60)
+                              : 0);
+  if (latencyCount == 0)
+    return;
+
+  // Shot on the air -> hit LED.
+  qsort(latenciesMs, latencyCount, sizeof(double), compareDoubles);
+  static const double percentiles[PERCENTILE_COUNT] = {0, 50, 90, 99, 100};
+  printf("hit latency (ms):");
+  for (uint8_t p = 0; p < PERCENTILE_COUNT; p++)
+    printf("  p%.0f %.1f", percentiles[p],
+           latenciesMs[(uint32_t)((latencyCount - 1) * percentiles[p] / 100)]);
+  printf("\n");
+  uint32_t buckets[LATENCY_BUCKET_COUNT] = {0};
+  for (uint32_t i = 0; i < latencyCount; i++) {
+    uint32_t bucket = latenciesMs[i] / LATENCY_BUCKET_MS;
+    buckets[bucket < LATENCY_BUCKET_COUNT ? bucket
+                                          : LATENCY_BUCKET_COUNT - 1]++;
+  }
+  for (uint8_t b = 0; b < LATENCY_BUCKET_COUNT; b++) {
+    if (b == LATENCY_BUCKET_COUNT - 1)
+      printf("   >= %3d ms  %5u\n", b * LATENCY_BUCKET_MS, buckets[b]);
+    else
+      printf("  %3d-%3d ms  %5u\n", b * LATENCY_BUCKET_MS,
+             (b + 1) * LATENCY_BUCKET_MS, buckets[b]);
+  }
+}
+
+static void usage() {
+  printf("usage: arena [-players N] [-seconds S] [-step MS] [-shotEvery MS] "
+         "[-field M] [-range M] [-amplitude COUNTS] [-crosstalk G] "
+         "[-echo G] [-echoTicks N] [-noise COUNTS] [-delay MS] [-loss P] "
+         "[-seed N] [-socket PATH] [-host PATH] [-capture PREFIX] "
+         "[-journal PREFIX]\n");
+}
+
+// lasertagHost is expected next to this program unless -host says otherwise.
+static void defaultHostPath() {
+  ssize_t length = readlink("/proc/self/exe", hostPath, sizeof(hostPath) - 1);
+  if (length < 0)
+    length = 0;
+  hostPath[length] = '\0';
+  char *slash = strrchr(hostPath, '/');
+  size_t directoryLength = slash ? (size_t)(slash - hostPath + 1) : 0;
+  snprintf(hostPath + directoryLength, sizeof(hostPath) - directoryLength,
+           "%s", HOST_PROGRAM);
+}
+
+int main(int argc, char *argv[]) {
+  unsigned seed = 1;
+  snprintf(socketPath, sizeof(socketPath), "/tmp/lasertagArena.%d",
+           (int)getpid());
+  defaultHostPath();
+  for (int i = 1; i < argc; i++) {
+    bool hasValue = i + 1 < argc;
+    if (!strcmp(argv[i], "-players") && hasValue)
+      players = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-seconds") && hasValue)
+      seconds = atof(argv[++i]);
+    else if (!strcmp(argv[i], "-step") && hasValue)
+      stepMs = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-shotEvery") && hasValue)
+      shotEveryMs = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-field") && hasValue)
+      fieldMeters = atof(argv[++i]);
+    else if (!strcmp(argv[i], "-range") && hasValue)
+      rangeMeters = atof(argv[++i]);
+    else if (!strcmp(argv[i], "-amplitude") && hasValue)
+      amplitude = atof(argv[++i]);
+    else if (!strcmp(argv[i], "-crosstalk") && hasValue)
+      crosstalk = atof(argv[++i]);
+    else if (!strcmp(argv[i], "-echo") && hasValue)
+      echo = atof(argv[++i]);
+    else if (!strcmp(argv[i], "-echoTicks") && hasValue)
+      echoTicks = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-noise") && hasValue)
+      noise = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-delay") && hasValue)
+      delayMs = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-loss") && hasValue)
+      lossProbability = atof(argv[++i]);
+    else if (!strcmp(argv[i], "-seed") && hasValue)
+      seed = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-socket") && hasValue)
+      snprintf(socketPath, sizeof(socketPath), "%s", argv[++i]);
+    else if (!strcmp(argv[i], "-host") && hasValue)
+      snprintf(hostPath, sizeof(hostPath), "%s", argv[++i]);
+    else if (!strcmp(argv[i], "-capture") && hasValue)
+      capturePrefix = argv[++i];
+    else if (!strcmp(argv[i], "-journal") && hasValue)
+      journalPrefix = argv[++i];
+    else {
+      usage();
+      return 1;
+    }
+  }
+  if (players < 2 || players > MAX_PLAYERS || stepMs == 0 ||
+      stepMs * TICKS_PER_MS > HOSTBOARD_MAX_STEP_TICKS || shotEveryMs == 0 ||
+      echoTicks > MAX_ECHO_TICKS || rangeMeters <= 0) {
+    usage();
+    return 1;
+  }
+  stepTicks = stepMs * TICKS_PER_MS;
+  srand(seed);
+  signal(SIGPIPE, SIG_IGN);
+  setvbuf(stdout, NULL, _IOLBF, 0);
+
+  int listener = socket(AF_UNIX, SOCK_STREAM, 0);
+  struct sockaddr_un address = {.sun_family = AF_UNIX};
+  snprintf(address.sun_path, sizeof(address.sun_path), "%s", socketPath);
+  unlink(socketPath);
+  if (listener < 0 ||
+      bind(listener, (struct sockaddr *)&address, sizeof(address)) < 0 ||
+      listen(listener, MAX_PLAYERS) < 0) {
+    printf("arena: unable to listen on %s.\n", socketPath);
+    return 1;
+  }
+  placeGuns();
+  startGuns();
+  bool ok = acceptGuns(listener);
+  double startSeconds = nowSeconds();
+  if (ok)
+    run();
+  double wallSeconds = nowSeconds() - startSeconds;
+  for (uint8_t player = 1; player <= players; player++) {
+    if (guns[player].pid > 0) {
+      kill(guns[player].pid, SIGTERM);
+      waitpid(guns[player].pid, NULL, 0);
+    }
+  }
+  close(listener);
+  unlink(socketPath);
+  if (!ok)
+    return 1;
+  report(wallSeconds);
+  return 0;
+}
@@ -0,0 +1,103 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+// Each message is a 4-byte header (tick count, buttons or 0, UART byte
+// count), the UART bytes and then one 16-bit value per tick. It is written
+// with one write() so that a step costs one system call on each side.
+
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "arenaLink.h"
+
+#define HEADER_SIZE 4
+#define MAX_MESSAGE_SIZE                                                       \
+  (HEADER_SIZE + ARENALINK_MAX_UART_BYTES +                                   \
+   HOSTBOARD_MAX_STEP_TICKS * sizeof(uint16_t))
+#define BYTE_BITS 8
+#define BYTE_MASK 0xFF
+
+static bool writeAll(int fd, const uint8_t *data, size_t size) {
+  while (size) {
+    ssize_t written = write(fd, data, size);
+    if (written < 0 && errno == EINTR)
+      continue;
+    if (written <= 0)
+      return false;
+    data += written;
+    size -= written;
+  }
+  return true;
+}
+
+static bool readAll(int fd, uint8_t *data, size_t size) {
+  while (size) {
+    ssize_t received = read(fd, data, size);
+    if (received < 0 && errno == EINTR)
+      continue;
+    if (received <= 0)
+      return false;
+    data += received;
+    size -= received;
+  }
+  return true;
+}
+
+static bool sendMessage(int fd, uint16_t tickCount, uint8_t buttons,
+                        const uint8_t uart[], uint8_t uartCount,
+                        const uint16_t values[]) {
+  uint8_t message[MAX_MESSAGE_SIZE];
+  if (tickCount > HOSTBOARD_MAX_STEP_TICKS)
+    return false;
+  message[0] = tickCount & BYTE_MASK;
+  message[1] = tickCount >> BYTE_BITS;
+  message[2] = buttons;
+  message[3] = uartCount;
+  memcpy(&message[HEADER_SIZE], uart, uartCount);
+  memcpy(&message[HEADER_SIZE + uartCount], values,
+         tickCount * sizeof(uint16_t));
+  return writeAll(fd, message,
+                  HEADER_SIZE + uartCount + tickCount * sizeof(uint16_t));
+}
+
+static bool receiveMessage(int fd, uint16_t *tickCount, uint8_t *buttons,
+                           uint8_t uart[], uint8_t *uartCount,
+                           uint16_t values[]) {
+  uint8_t header[HEADER_SIZE];
+  if (!readAll(fd, header, HEADER_SIZE))
+    return false;
+  *tickCount = header[0] | header[1] << BYTE_BITS;
+  *buttons = header[2];
+  *uartCount = header[3];
+  return *tickCount <= HOSTBOARD_MAX_STEP_TICKS &&
+         readAll(fd, uart, *uartCount) &&
+         readAll(fd, (uint8_t *)values, *tickCount * sizeof(uint16_t));
+}
+
+bool arenaLink_sendStep(int fd, const arenaLink_step_t *step) {
+  return sendMessage(fd, step->tickCount, step->buttons, step->uart,
+                     step->uartCount, step->adc);
+}
+
+bool arenaLink_receiveStep(int fd, arenaLink_step_t *step) {
+  return receiveMessage(fd, &step->tickCount, &step->buttons, step->uart,
+                        &step->uartCount, step->adc);
+}
+
+bool arenaLink_sendResult(int fd, const arenaLink_result_t *result) {
+  return sendMessage(fd, result->tickCount, 0, result->uart,
+                     result->uartCount, result->pins);
+}
+
+bool arenaLink_receiveResult(int fd, arenaLink_result_t *result) {
+  uint8_t buttons;
+  return receiveMessage(fd, &result->tickCount, &buttons, result->uart,
+                        &result->uartCount, result->pins);
+}
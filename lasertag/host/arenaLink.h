@@ -0,0 +1,49 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef ARENALINK_H_
+#define ARENALINK_H_
+
+// Messages between the arena simulator (arena.c) and a gun running on
+// simulated time (lasertagHost -arena). Every step, the gun sends what it did
+// during the last step and the arena answers with the inputs for the next
+// one. Both ends run on the same machine, so the messages are sent in the
+// machine's byte order.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "hostBoard.h"
+
+#define ARENALINK_MAX_UART_BYTES 255
+
+// Arena to gun: inputs for one step.
+typedef struct {
+  uint16_t tickCount; // Ticks in the step.
+  uint8_t buttons;    // Push buttons for the whole step.
+  uint8_t uartCount;  // Bytes arriving at the bluetooth UART.
+  uint8_t uart[ARENALINK_MAX_UART_BYTES];
+  uint16_t adc[HOSTBOARD_MAX_STEP_TICKS]; // One sample per tick.
+} arenaLink_step_t;
+
+// Gun to arena: what happened during the last step.
+typedef struct {
+  uint16_t tickCount; // 0 before the first step.
+  uint8_t uartCount;  // Bytes that left the bluetooth UART.
+  uint8_t uart[ARENALINK_MAX_UART_BYTES];
+  uint16_t pins[HOSTBOARD_MAX_STEP_TICKS]; // See hostBoard_getPinTrace().
+} arenaLink_result_t;
+
+// Each returns false if the connection is closed or the message is bad.
+bool arenaLink_sendStep(int fd, const arenaLink_step_t *step);
+bool arenaLink_receiveStep(int fd, arenaLink_step_t *step);
+bool arenaLink_sendResult(int fd, const arenaLink_result_t *result);
+bool arenaLink_receiveResult(int fd, arenaLink_result_t *result);
+
+#endif /* ARENALINK_H_ */
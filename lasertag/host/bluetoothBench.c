@@ -0,0 +1,153 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+// Runs the bluetooth driver (bluetooth.c) against the UART model in hal/.
+// The first table shows how much of the 9600-baud line the driver keeps busy
+// in each direction when bluetooth_poll() is called every 1 to 20 ms and
+// there is always more to send and receive. The second measures what
+// bluetooth_poll() costs when there is nothing to do and when it moves a full
+// FIFO each way. The board is much slower than a PC, so treat the times as
+// relative.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "bluetooth.h"
+#include "uartModel.h"
+#include "xparameters.h"
+
+#define BENCH_SECONDS 10 // Line time simulated per poll interval.
+#define US_PER_MS 1000
+#define US_PER_SECOND 1000000
+#define NS_PER_SECOND 1000000000.0
+#define LINE_BYTES_PER_SECOND                                                  \
+  (UARTMODEL_DEFAULT_BAUD / UARTMODEL_BITS_PER_BYTE)
+#define IDLE_POLL_COUNT 10000000
+#define BUSY_POLL_COUNT 1000000
+// Line time for a full FIFO to go out (and for one to come in).
+#define FIFO_TIME_US                                                           \
+  (BLUETOOTH_UART_FIFO_SIZE * UARTMODEL_BITS_PER_BYTE * US_PER_SECOND /        \
+       UARTMODEL_DEFAULT_BAUD +                                                \
+   1)
+
+static uartModel_t uart;
+static uint8_t pattern[BLUETOOTH_QUEUE_SIZE];
+
+static double nowNs() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * NS_PER_SECOND + ts.tv_nsec;
+}
+
+static void resetLink() {
+  uartModel_init(&uart, UARTMODEL_DEFAULT_BAUD);
+  uartModel_attach(&uart, XPAR_BLUETOOTH_UARTLITE_0_BASEADDR);
+  if (bluetooth_init() != BLUETOOTH_INIT_STATUS_OK)
+    printf("bluetoothBench: bluetooth_init() failed.\n");
+}
+
+// Keeps the transmit queue full.
+static void fillTransmitQueue() {
+  bluetooth_transmitQueueWrite(pattern, bluetooth_transmitQueueSpace());
+}
+
+// Empties the receive queue in place. Returns the number of bytes.
+static uint32_t drainReceiveQueue() {
+  const uint8_t *data;
+  uint16_t count;
+  uint32_t total = 0;
+  while ((count = bluetooth_receiveQueuePeek(&data))) {
+    bluetooth_receiveQueueConsume(count);
+    total += count;
+  }
+  return total;
+}
+
+// Keeps the receive line busy.
+static void fillReceiveLine(uint32_t microseconds) {
+  uint32_t bytes = microseconds / (US_PER_SECOND / LINE_BYTES_PER_SECOND) + 1;
+  uartModel_putReceived(&uart, pattern, bytes);
+}
+
+// Polls every intervalMs for BENCH_SECONDS with both directions saturated.
+static void benchInterval(uint32_t intervalMs) {
+  resetLink();
+  uint32_t intervalUs = intervalMs * US_PER_MS;
+  uint32_t received = 0;
+  uint32_t sent = 0;
+  uint8_t sink[UARTMODEL_LINE_SIZE];
+  for (uint32_t t = 0; t < BENCH_SECONDS * US_PER_SECOND; t += intervalUs) {
+    fillTransmitQueue();
+    fillReceiveLine(intervalUs);
+    uartModel_advance(&uart, intervalUs);
+    bluetooth_poll();
+    received += drainReceiveQueue();
+    sent += uartModel_takeSent(&uart, sink, sizeof(sink));
+  }
+  uint32_t polls = BENCH_SECONDS * US_PER_SECOND / intervalUs;
+  double lineBytes = BENCH_SECONDS * LINE_BYTES_PER_SECOND;
+  printf("%8d  %6d  %5.1f   %6d  %5.1f  %8d  %11.2f\n", intervalMs,
+         sent / BENCH_SECONDS, 100.0 * sent / lineBytes,
+         received / BENCH_SECONDS, 100.0 * received / lineBytes,
+         uart.overruns, (double)(uart.sendCalls + uart.recvCalls) / polls);
+}
+
+// Returns the cost of bluetooth_poll() in ns when there is nothing to do.
+static double benchIdlePoll() {
+  resetLink();
+  double start = nowNs();
+  for (uint32_t i = 0; i < IDLE_POLL_COUNT; i++)
+    bluetooth_poll();
+  return (nowNs() - start) / IDLE_POLL_COUNT;
+}
+
+// Returns the cost of bluetooth_poll() in ns when it sends and receives a
+// full FIFO. Only the poll is timed; the overhead of reading the clock is
+// measured and taken out.
+static double benchBusyPoll() {
+  resetLink();
+  double pollNs = 0;
+  double clockNs = 0;
+  for (uint32_t i = 0; i < BUSY_POLL_COUNT; i++) {
+    fillTransmitQueue();
+    uartModel_putReceived(&uart, pattern, BLUETOOTH_UART_FIFO_SIZE);
+    uartModel_advance(&uart, FIFO_TIME_US);
+    double start = nowNs();
+    double afterClock = nowNs();
+    bluetooth_poll();
+    double end = nowNs();
+    clockNs += afterClock - start;
+    pollNs += end - afterClock;
+    drainReceiveQueue();
+  }
+  if (uart.bytesSent < (BUSY_POLL_COUNT - 1) * BLUETOOTH_UART_FIFO_SIZE)
+    printf("bluetoothBench: busy polls did not fill the FIFO.\n");
+  return (pollNs - clockNs) / BUSY_POLL_COUNT;
+}
+
+int main() {
+  for (uint32_t i = 0; i < BLUETOOTH_QUEUE_SIZE; i++)
+    pattern[i] = i;
+  printf("Line is %d baud (%d bytes/s each way), UART FIFOs hold %d bytes.\n",
+         UARTMODEL_DEFAULT_BAUD, LINE_BYTES_PER_SECOND,
+         BLUETOOTH_UART_FIFO_SIZE);
+  printf("poll(ms)  sent/s  line%%  recv/s  line%%  overruns  "
+         "UART calls/poll\n");
+  uint32_t intervals[] = {1, 5, 10, 15, 20};
+  for (uint32_t i = 0; i < sizeof(intervals) / sizeof(intervals[0]); i++)
+    benchInterval(intervals[i]);
+  double idleNs = benchIdlePoll();
+  double busyNs = benchBusyPoll();
+  printf("bluetooth_poll(): %.1f ns idle, %.1f ns moving %d bytes each way "
+         "(%.2f ns/byte).\n",
+         idleNs, busyNs, BLUETOOTH_UART_FIFO_SIZE,
+         busyNs / (2 * BLUETOOTH_UART_FIFO_SIZE));
+  return 0;
+}
@@ -0,0 +1,160 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#include <stdalign.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "detectorBatch.h"
+#include "filter.h"
+
+#define OUTPUT_SIZE FILTER_INPUT_PULSE_WIDTH // Power window, as in filter.c.
+// Raw value that scales to 0.0, fed to lanes without data.
+#define SILENCE (DETECTOR_SCALED_ADC_FACTOR * DETECTOR_SCALED_ADC_RANGE)
+
+// One double per lane.
+typedef double lanes_t
+    __attribute__((vector_size(DETECTORBATCH_LANES * sizeof(double))));
+
+// The rings hold every value twice (at i and i + size), so the window that
+// ends with the newest value is always contiguous: it starts at the index of
+// the oldest value.
+struct detectorBatch {
+  lanes_t x[2 * FIR_FILTER_TAP_COUNT];
+  lanes_t y[2 * IIR_B_COEFFICIENT_COUNT];
+  lanes_t z[FILTER_IIR_FILTER_COUNT][2 * IIR_A_COEFFICIENT_COUNT];
+  lanes_t output[FILTER_IIR_FILTER_COUNT][OUTPUT_SIZE];
+  lanes_t power[FILTER_IIR_FILTER_COUNT];
+  uint32_t xIndex; // Oldest value of each ring.
+  uint32_t yIndex;
+  uint32_t zIndex;
+  uint32_t outputIndex;
+  uint8_t sampleCnt; // Samples since the last decimated step.
+  uint64_t sampleCount;
+  filter_ctx_t filters[DETECTORBATCH_LANES]; // Only the power values.
+  detector_ctx_t detectors[DETECTORBATCH_LANES];
+};
+
+// Replaces the oldest value of a doubled ring. Returns the new oldest index.
+static inline uint32_t ringPush(lanes_t ring[], uint32_t oldest, uint32_t size,
+                                lanes_t value) {
+  ring[oldest] = value;
+  ring[oldest + size] = value;
+  return oldest + 1 == size ? 0 : oldest + 1;
+}
+
+// Allocates a batch and initializes it like detectorBatch_init().
+detectorBatch_t *detectorBatch_create(const detector_hooks_t *hooks) {
+  size_t alignment = alignof(detectorBatch_t);
+  size_t size = (sizeof(detectorBatch_t) + alignment - 1) / alignment *
+                alignment; // aligned_alloc() wants a multiple.
+  detectorBatch_t *batch = aligned_alloc(alignment, size);
+  if (batch)
+    detectorBatch_init(batch, hooks);
+  return batch;
+}
+
+// Frees a batch from detectorBatch_create().
+void detectorBatch_free(detectorBatch_t *batch) { free(batch); }
+
+// Zeros the filters of all lanes and initializes their detector contexts.
+void detectorBatch_init(detectorBatch_t *batch,
+                        const detector_hooks_t *hooks) {
+  memset(batch, 0, sizeof(*batch));
+  for (uint16_t lane = 0; lane < DETECTORBATCH_LANES; lane++)
+    detector_ctxInit(&batch->detectors[lane], &batch->filters[lane], hooks);
+}
+
+// The detector context of a lane.
+detector_ctx_t *detectorBatch_getDetector(detectorBatch_t *batch,
+                                          uint16_t lane) {
+  return &batch->detectors[lane];
+}
+
+// Decimating FIR, the IIR bank and the power of every lane, the same
+// arithmetic in the same order as filter.c.
+static void filterStep(detectorBatch_t *batch) {
+  const lanes_t *x = &batch->x[batch->xIndex]; // Oldest first.
+  lanes_t y = {0};
+  for (uint32_t i = 0; i < FIR_FILTER_TAP_COUNT; i++)
+    y += x[i] * firCoefficients[FIR_FILTER_TAP_COUNT - i - 1];
+  batch->yIndex =
+      ringPush(batch->y, batch->yIndex, IIR_B_COEFFICIENT_COUNT, y);
+
+  const lanes_t *yWindow = &batch->y[batch->yIndex];
+  for (uint16_t filterNumber = 0; filterNumber < FILTER_IIR_FILTER_COUNT;
+       filterNumber++) {
+    const lanes_t *zWindow = &batch->z[filterNumber][batch->zIndex];
+    const double *b = iirBCoefficientConstants[filterNumber];
+    const double *a = iirACoefficientConstants[filterNumber];
+    lanes_t yTotal = {0};
+    lanes_t zTotal = {0};
+    for (uint32_t j = 0; j < IIR_B_COEFFICIENT_COUNT; j++)
+      yTotal += b[j] * yWindow[IIR_B_COEFFICIENT_COUNT - j - 1];
+    for (uint32_t j = 0; j < IIR_A_COEFFICIENT_COUNT; j++)
+      zTotal += a[j] * zWindow[IIR_A_COEFFICIENT_COUNT - j - 1];
+    lanes_t z = yTotal - zTotal;
+    // The oldest z has been used, so it can be replaced now. All filters
+    // share the index, it moves on below.
+    batch->z[filterNumber][batch->zIndex] = z;
+    batch->z[filterNumber][batch->zIndex + IIR_A_COEFFICIENT_COUNT] = z;
+
+    // The value leaving the window takes its power with it.
+    lanes_t oldest = batch->output[filterNumber][batch->outputIndex];
+    batch->output[filterNumber][batch->outputIndex] = z;
+    batch->power[filterNumber] =
+        batch->power[filterNumber] - oldest * oldest + z * z;
+  }
+  batch->zIndex =
+      batch->zIndex + 1 == IIR_A_COEFFICIENT_COUNT ? 0 : batch->zIndex + 1;
+  batch->outputIndex =
+      batch->outputIndex + 1 == OUTPUT_SIZE ? 0 : batch->outputIndex + 1;
+}
+
+// Hands the power values to each lane's detector.
+static void detectStep(detectorBatch_t *batch,
+                       const uint16_t *samples[DETECTORBATCH_LANES]) {
+  for (uint16_t lane = 0; lane < DETECTORBATCH_LANES; lane++) {
+    if (!samples[lane])
+      continue;
+    for (uint16_t filterNumber = 0; filterNumber < FILTER_IIR_FILTER_COUNT;
+         filterNumber++)
+      batch->filters[lane].prevPower[filterNumber] =
+          batch->power[filterNumber][lane];
+    detector_ctxDetectHit(&batch->detectors[lane]);
+  }
+}
+
+// Runs sampleCount raw ADC samples of every lane.
+void detectorBatch_run(detectorBatch_t *batch,
+                       const uint16_t *samples[DETECTORBATCH_LANES],
+                       uint32_t sampleCount) {
+  for (uint16_t lane = 0; lane < DETECTORBATCH_LANES; lane++)
+    if (samples[lane])
+      batch->detectors[lane].invocationCount++;
+  for (uint32_t i = 0; i < sampleCount; i++) {
+    lanes_t raw;
+    for (uint16_t lane = 0; lane < DETECTORBATCH_LANES; lane++)
+      raw[lane] = samples[lane] ? samples[lane][i] : SILENCE;
+    lanes_t scaled = raw / DETECTOR_SCALED_ADC_FACTOR - DETECTOR_SCALED_ADC_RANGE;
+    batch->xIndex =
+        ringPush(batch->x, batch->xIndex, FIR_FILTER_TAP_COUNT, scaled);
+    if (++batch->sampleCnt == FILTER_FIR_DECIMATION_FACTOR) {
+      batch->sampleCnt = 0;
+      filterStep(batch);
+      detectStep(batch, samples);
+    }
+    batch->sampleCount++;
+  }
+}
+
+// Number of samples run so far.
+uint64_t detectorBatch_getSampleCount(detectorBatch_t *batch) {
+  return batch->sampleCount;
+}
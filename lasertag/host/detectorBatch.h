@@ -0,0 +1,61 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef DETECTORBATCH_H_
+#define DETECTORBATCH_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "detector.h"
+
+// Runs DETECTORBATCH_LANES detectors in lockstep, one per vector lane. The
+// FIR, IIR and power arithmetic is the same as filter.c with the coefficient
+// tables from filter.h, but every operation works on a vector holding the
+// same value for all lanes, so one instruction advances the same filter tap
+// for every stream. Hit detection is per lane and is done by the lane's
+// detector context (detector_ctxDetectHit()), so hooks, lockout, frozen
+// state and hit counts behave exactly like a detector on its own.
+
+// Doubles per vector. 4 fills an AVX2 register, 8 an AVX-512 one. The code is
+// written with the compiler's vector extensions, so any value builds on any
+// CPU; it is only fast when it matches the vector unit.
+#ifndef DETECTORBATCH_LANES
+#define DETECTORBATCH_LANES 4
+#endif
+
+typedef struct detectorBatch detectorBatch_t;
+
+// Allocates a batch and initializes it like detectorBatch_init(). Returns
+// NULL if out of memory.
+detectorBatch_t *detectorBatch_create(const detector_hooks_t *hooks);
+
+// Frees a batch from detectorBatch_create().
+void detectorBatch_free(detectorBatch_t *batch);
+
+// Zeros the filters of all lanes and initializes their detector contexts
+// with detector_ctxInit() and the given hooks (may be NULL).
+void detectorBatch_init(detectorBatch_t *batch, const detector_hooks_t *hooks);
+
+// The detector context of a lane, for its settings and results. Its filter
+// context only holds the power values, the queues are never allocated.
+detector_ctx_t *detectorBatch_getDetector(detectorBatch_t *batch,
+                                          uint16_t lane);
+
+// Runs sampleCount raw ADC samples of every lane. samples[lane] may be NULL
+// for a lane that has no data; it is fed silence and skips hit detection.
+void detectorBatch_run(detectorBatch_t *batch,
+                       const uint16_t *samples[DETECTORBATCH_LANES],
+                       uint32_t sampleCount);
+
+// Number of samples run so far. Inside a hook this is the index of the sample
+// that caused the hit.
+uint64_t detectorBatch_getSampleCount(detectorBatch_t *batch);
+
+#endif /* DETECTORBATCH_H_ */
@@ -0,0 +1,275 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+// Replays a capture (see capture.h) through filter.c and detector.c. The file
+// is mapped into memory and its samples chunks are unpacked straight into the
+// detector, as fast as the CPU allows or, with -speed, paced to the capture's
+// sample rate. Prints every hit with its sample index and time next to the
+// trigger and hit markers that were recorded, optionally writes the power of
+// every filter after each decimated sample, and ends with the throughput.
+// The same capture always gives the same hits.
+
+#include <fcntl.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "capture.h"
+#include "detector.h"
+#include "filter.h"
+
+#define MAGIC "LTCP"
+#define MAGIC_SIZE 4
+#define MAX_CHUNK_SAMPLES 65535 // The count is 16 bits.
+#define PACE_SAMPLES 100        // Samples between sleeps with -speed.
+#define NS_PER_SECOND 1000000000.0
+#define MS_PER_SECOND 1000.0
+
+static filter_ctx_t replayFilter;
+static detector_ctx_t replayDetector;
+static uint64_t position; // Index of the sample being run.
+static uint32_t sampleRate;
+static uint32_t hits;
+static bool quiet;
+static FILE *traceFile;
+static uint16_t chunkSamples[MAX_CHUNK_SAMPLES];
+
+static double nowSeconds() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / NS_PER_SECOND;
+}
+
+static uint64_t getLittle(const uint8_t *bytes, uint8_t size) {
+  uint64_t value = 0;
+  for (uint8_t i = size; i > 0; i--)
+    value = value << 8 | bytes[i - 1];
+  return value;
+}
+
+static double toMs(uint64_t index) {
+  return index * MS_PER_SECOND / sampleRate;
+}
+
+// Reports every hit.
+static void hitHandler(detector_ctx_t *ctx) {
+  hits++;
+  if (!quiet)
+    printf("replay:  hit on frequency %u at sample %lu (%.2f ms)\n",
+           (unsigned)ctx->frequencyDetected, (unsigned long)position,
+           toMs(position));
+}
+
+static const detector_hooks_t hooks = {.hitHandler = hitHandler};
+
+// Two samples in three bytes, see capture.h.
+static void unpackSamples(const uint8_t *bytes, uint16_t count) {
+  for (uint32_t i = 0; i + 1 < count; i += 2, bytes += 3) {
+    chunkSamples[i] = bytes[0] | (bytes[1] & 0x0f) << 8;
+    chunkSamples[i + 1] = bytes[1] >> 4 | bytes[2] << 4;
+  }
+  if (count % 2)
+    chunkSamples[count - 1] = bytes[0] | (bytes[1] & 0x0f) << 8;
+}
+
+// One line per decimated sample: its index and the power of every filter.
+static void tracePower() {
+  double power[FILTER_FREQUENCY_COUNT];
+  filter_ctxGetCurrentPowerValues(&replayFilter, power);
+  fprintf(traceFile, "%lu", (unsigned long)position);
+  for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++)
+    fprintf(traceFile, ",%g", power[i]);
+  fprintf(traceFile, "\n");
+}
+
+// Runs count unpacked samples.
+static void runSamples(const uint16_t *samples, uint32_t count) {
+  replayDetector.invocationCount++;
+  if (!traceFile) {
+    for (uint32_t i = 0; i < count; i++, position++)
+      detector_ctxAddSample(&replayDetector, samples[i]);
+    return;
+  }
+  for (uint32_t i = 0; i < count; i++, position++) {
+    detector_ctxAddSample(&replayDetector, samples[i]);
+    if (replayDetector.sampleCnt == 0) // The filters just ran.
+      tracePower();
+  }
+}
+
+// Runs count unpacked samples no faster than speed times the sample rate,
+// counting from start (wall time) at sample 0. Gaps are waited out.
+static void runPaced(uint32_t count, double speed, double start) {
+  for (uint32_t i = 0; i < count; i += PACE_SAMPLES) {
+    double due = start + position / (sampleRate * speed);
+    double wait = due - nowSeconds();
+    if (wait > 0) {
+      struct timespec ts = {(time_t)wait,
+                            (long)((wait - (time_t)wait) * NS_PER_SECOND)};
+      nanosleep(&ts, NULL);
+    }
+    uint32_t piece = count - i < PACE_SAMPLES ? count - i : PACE_SAMPLES;
+    runSamples(chunkSamples + i, piece);
+  }
+}
+
+static void printMarkers(const uint8_t *payload, uint16_t count) {
+  for (uint32_t i = 0; i < count; i++) {
+    const uint8_t *marker = payload + i * CAPTURE_MARKER_SIZE;
+    uint64_t index = getLittle(marker, 8);
+    const char *type = marker[8] == capture_triggerMarker_e ? "trigger"
+                       : marker[8] == capture_hitMarker_e   ? "hit"
+                                                            : "marker";
+    printf("capture: %s on frequency %u at sample %lu (%.2f ms)\n", type,
+           marker[9], (unsigned long)index, toMs(index));
+  }
+}
+
+static void usage() {
+  printf("usage: detectorReplay [-speed X] [-trace FILE] [-quiet] CAPTURE\n"
+         "-speed X paces the replay at X times real time (1 for real time), "
+         "otherwise it runs as fast as possible.\n"
+         "-trace FILE writes the sample index and the power of every filter "
+         "after each decimated sample, as CSV.\n");
+}
+
+int main(int argc, char *argv[]) {
+  double speed = 0;
+  const char *path = NULL;
+  const char *tracePath = NULL;
+  for (int i = 1; i < argc; i++) {
+    bool hasValue = i + 1 < argc;
+    if (!strcmp(argv[i], "-speed") && hasValue)
+      speed = atof(argv[++i]);
+    else if (!strcmp(argv[i], "-trace") && hasValue)
+      tracePath = argv[++i];
+    else if (!strcmp(argv[i], "-quiet"))
+      quiet = true;
+    else if (argv[i][0] != '-' && !path)
+      path = argv[i];
+    else {
+      usage();
+      return 1;
+    }
+  }
+  if (!path || speed < 0) {
+    usage();
+    return 1;
+  }
+
+  int fd = open(path, O_RDONLY);
+  struct stat st;
+  if (fd < 0 || fstat(fd, &st) < 0) {
+    printf("detectorReplay: unable to open %s.\n", path);
+    return 1;
+  }
+  size_t size = st.st_size;
+  const uint8_t *file =
+      size ? mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0) : MAP_FAILED;
+  close(fd);
+  if (file == MAP_FAILED) {
+    printf("detectorReplay: unable to map %s.\n", path);
+    return 1;
+  }
+  madvise((void *)file, size, MADV_SEQUENTIAL);
+  uint32_t headerSize = size >= 8 ? getLittle(file + 6, 2) : 0;
+  if (size < CAPTURE_HEADER_SIZE || memcmp(file, MAGIC, MAGIC_SIZE) ||
+      getLittle(file + 4, 2) != CAPTURE_VERSION || headerSize > size ||
+      file[13] != CAPTURE_ADC_BITS) {
+    printf("detectorReplay: %s is not a version %d capture.\n", path,
+           CAPTURE_VERSION);
+    return 1;
+  }
+  sampleRate = getLittle(file + 8, 4);
+  if (sampleRate == 0) {
+    printf("detectorReplay: %s has no sample rate.\n", path);
+    return 1;
+  }
+  if (sampleRate != CAPTURE_SAMPLE_RATE)
+    printf("detectorReplay: captured at %u Hz, the filters are designed for "
+           "%d Hz.\n",
+           sampleRate, CAPTURE_SAMPLE_RATE);
+  char build[CAPTURE_BUILD_SIZE + 1] = {0};
+  memcpy(build, file + 16, CAPTURE_BUILD_SIZE);
+  printf("%s: %u Hz, build %s\n", path, sampleRate, build);
+
+  if (tracePath && !(traceFile = fopen(tracePath, "w"))) {
+    printf("detectorReplay: unable to open %s.\n", tracePath);
+    return 1;
+  }
+  filter_ctxInit(&replayFilter);
+  detector_ctxInit(&replayDetector, &replayFilter, &hooks);
+  detector_ctxSetFreezeOnHit(&replayDetector, false); // Every hit counts.
+
+  uint64_t sampleCount = 0;
+  uint64_t nextIndex = 0; // Index the next samples chunk should start at.
+  uint64_t dropped = 0;
+  uint32_t gaps = 0;
+  double start = nowSeconds();
+  size_t offset = headerSize;
+  while (offset + CAPTURE_CHUNK_HEADER_SIZE <= size) {
+    const uint8_t *chunk = file + offset;
+    uint32_t count = getLittle(chunk + 2, 2); // 16 bits, kept unsigned.
+    uint32_t payloadSize = getLittle(chunk + 4, 4);
+    uint64_t first = getLittle(chunk + 8, 8);
+    const uint8_t *payload = chunk + CAPTURE_CHUNK_HEADER_SIZE;
+    if (payloadSize > size - offset - CAPTURE_CHUNK_HEADER_SIZE) {
+      printf("detectorReplay: the capture ends in the middle of a chunk.\n");
+      break;
+    }
+    if (chunk[0] == capture_samplesChunk_e &&
+        payloadSize >= CAPTURE_SAMPLES_BYTES(count)) {
+      // The filters carry on across a gap, like the detector on the board
+      // after it falls behind.
+      if (first != nextIndex) {
+        if (!quiet)
+          printf("capture: %lu samples missing at sample %lu (%.2f ms)\n",
+                 (unsigned long)(first - nextIndex), (unsigned long)nextIndex,
+                 toMs(nextIndex));
+        dropped += first - nextIndex;
+        gaps++;
+      }
+      position = first;
+      unpackSamples(payload, count);
+      if (speed > 0)
+        runPaced(count, speed, start);
+      else
+        runSamples(chunkSamples, count);
+      sampleCount += count;
+      nextIndex = first + count;
+    } else if (chunk[0] == capture_markersChunk_e &&
+               payloadSize >= (uint32_t)count * CAPTURE_MARKER_SIZE) {
+      if (!quiet)
+        printMarkers(payload, count);
+    }
+    offset += CAPTURE_CHUNK_HEADER_SIZE + payloadSize;
+  }
+  double seconds = nowSeconds() - start;
+
+  printf("%lu samples (%.2f s of capture) in %.3f s: %.3e samples/s, %.1f "
+         "times real time, %u hits",
+         (unsigned long)sampleCount, (double)sampleCount / sampleRate, seconds,
+         seconds > 0 ? sampleCount / seconds : 0,
+         seconds > 0 ? sampleCount / seconds / sampleRate : 0, hits);
+  if (gaps)
+    printf(", %lu samples missing in %u gaps", (unsigned long)dropped, gaps);
+  printf("\n");
+
+  if (traceFile)
+    fclose(traceFile);
+  filter_ctxFree(&replayFilter);
+  munmap((void *)file, size);
+  return 0;
+}
@@ -0,0 +1,428 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+// Runs the filter/detector pipeline on many ADC streams at once, e.g. one per
+// gun from captures or a simulator. Every stream has its own detector context
+// (see detector.h). Each stream is a task, and a pool of threads works
+// through the tasks a block at a time: each thread has a deque of tasks, runs
+// the newest one itself and, when it runs dry, steals the oldest one from
+// another thread. A task is only ever in one deque, so its blocks run in
+// order. With -batch, a task is DETECTORBATCH_LANES streams running in
+// lockstep in the vector lanes of one detectorBatch (see detectorBatch.h). Prints every hit with its stream and time, then the
+// throughput of each stream.
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "detector.h"
+#include "detectorBatch.h"
+#include "filter.h"
+#include "signalGenerator.h"
+
+#define SAMPLE_RATE 100000 // Samples per second, one per ISR tick.
+#define SAMPLES_PER_MS (SAMPLE_RATE / 1000)
+#define MAX_STREAMS 1024
+#define MAX_THREADS 256
+#define DEFAULT_BLOCK_SAMPLES 10000 // 100 ms.
+#define NS_PER_SECOND 1000000000.0
+#define IDLE_SLEEP_NS 100000 // Between failed steals.
+#define CACHE_LINE_SIZE 64
+// Synthetic streams: one 200 ms shot per second on top of noise.
+#define SYNTH_SHOT_AMPLITUDE 1000
+#define SYNTH_NOISE_SIGMA 12
+#define SYNTH_SHOT_EVERY SAMPLE_RATE
+
+typedef struct {
+  uint32_t id;
+  uint16_t *samples;
+  uint64_t sampleCount;
+  uint64_t position; // Next sample to run.
+  filter_ctx_t filter; // Not used with -batch.
+  detector_ctx_t detector;
+  detectorBatch_t *batch; // With -batch, where the detector is.
+  uint32_t hits;
+  uint32_t blocks;
+  double busySeconds;
+} stream_t;
+
+// What a thread runs a block of: one stream, or a batch of streams.
+typedef struct {
+  stream_t *streams[DETECTORBATCH_LANES];
+  uint16_t laneCount;
+  detectorBatch_t *batch; // NULL for a single stream.
+  uint64_t position;      // Next sample to run.
+  uint64_t sampleCount;   // Of the longest stream.
+} task_t;
+
+// One per thread. The owner pushes and pops at the back, thieves take from
+// the front.
+typedef struct {
+  _Alignas(CACHE_LINE_SIZE) pthread_mutex_t lock;
+  uint32_t *tasks; // Ring of task indexes, one slot per task.
+  uint32_t front;
+  uint32_t count;
+  uint32_t blocks;
+  uint32_t steals;
+  pthread_t thread;
+} worker_t;
+
+static stream_t *streams[MAX_STREAMS];
+static uint32_t streamCount;
+static task_t tasks[MAX_STREAMS];
+static uint32_t taskCount;
+static worker_t workers[MAX_THREADS];
+static uint32_t threadCount;
+static uint32_t blockSamples = DEFAULT_BLOCK_SAMPLES;
+static bool quiet;
+static uint32_t remainingTasks; // Not done yet, updated atomically.
+
+static double nowSeconds() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / NS_PER_SECOND;
+}
+
+// Reports every hit.
+static void hitHandler(detector_ctx_t *ctx) {
+  stream_t *stream = ctx->user;
+  stream->hits++;
+  uint64_t position = stream->batch
+                          ? detectorBatch_getSampleCount(stream->batch)
+                          : stream->position;
+  if (!quiet)
+    printf("stream %u: hit on frequency %u at %.2f ms\n", stream->id,
+           (unsigned)ctx->frequencyDetected, (double)position / SAMPLES_PER_MS);
+}
+
+static const detector_hooks_t hooks = {.hitHandler = hitHandler};
+
+static void pushBack(worker_t *worker, uint32_t task) {
+  pthread_mutex_lock(&worker->lock);
+  worker->tasks[(worker->front + worker->count) % taskCount] = task;
+  worker->count++;
+  pthread_mutex_unlock(&worker->lock);
+}
+
+// Returns false if the deque is empty.
+static bool popBack(worker_t *worker, uint32_t *task) {
+  bool found = false;
+  pthread_mutex_lock(&worker->lock);
+  if (worker->count) {
+    worker->count--;
+    *task = worker->tasks[(worker->front + worker->count) % taskCount];
+    found = true;
+  }
+  pthread_mutex_unlock(&worker->lock);
+  return found;
+}
+
+// Returns false if the deque is empty.
+static bool popFront(worker_t *worker, uint32_t *task) {
+  bool found = false;
+  pthread_mutex_lock(&worker->lock);
+  if (worker->count) {
+    *task = worker->tasks[worker->front];
+    worker->front = (worker->front + 1) % taskCount;
+    worker->count--;
+    found = true;
+  }
+  pthread_mutex_unlock(&worker->lock);
+  return found;
+}
+
+// Runs samples [position, end) of a single stream.
+static void runStream(stream_t *stream, uint64_t end) {
+  stream->detector.invocationCount++;
+  for (; stream->position < end; stream->position++)
+    detector_ctxAddSample(&stream->detector,
+                          stream->samples[stream->position]);
+}
+
+// Runs samples [position, end) of a batch. Lanes whose stream has ended are
+// fed silence.
+static void runBatch(task_t *task, uint64_t end) {
+  while (task->position < end) {
+    const uint16_t *samples[DETECTORBATCH_LANES] = {NULL};
+    uint64_t chunkEnd = end;
+    for (uint16_t lane = 0; lane < task->laneCount; lane++) {
+      stream_t *stream = task->streams[lane];
+      if (task->position >= stream->sampleCount)
+        continue;
+      samples[lane] = stream->samples + task->position;
+      // Stop where a stream ends, it drops out of the next chunk.
+      if (stream->sampleCount < chunkEnd)
+        chunkEnd = stream->sampleCount;
+    }
+    detectorBatch_run(task->batch, samples, chunkEnd - task->position);
+    for (uint16_t lane = 0; lane < task->laneCount; lane++)
+      if (samples[lane])
+        task->streams[lane]->position = chunkEnd;
+    task->position = chunkEnd;
+  }
+}
+
+// Runs the next block of a task. Returns true when the task is done.
+static bool runBlock(task_t *task) {
+  double start = nowSeconds();
+  uint64_t end = task->position + blockSamples;
+  if (end > task->sampleCount)
+    end = task->sampleCount;
+  if (task->batch) {
+    runBatch(task, end);
+  } else {
+    runStream(task->streams[0], end);
+    task->position = end;
+  }
+  // A batch's time is shared by its streams.
+  double seconds = (nowSeconds() - start) / task->laneCount;
+  for (uint16_t lane = 0; lane < task->laneCount; lane++) {
+    task->streams[lane]->busySeconds += seconds;
+    task->streams[lane]->blocks++;
+  }
+  return task->position == task->sampleCount;
+}
+
+static void *workerThread(void *argument) {
+  worker_t *self = argument;
+  uint32_t selfIndex = self - workers;
+  uint32_t task;
+  while (__atomic_load_n(&remainingTasks, __ATOMIC_ACQUIRE)) {
+    bool found = popBack(self, &task);
+    // Steal the oldest task of the next thread that has one.
+    for (uint32_t i = 1; !found && i < threadCount; i++) {
+      found = popFront(&workers[(selfIndex + i) % threadCount], &task);
+      if (found)
+        self->steals++;
+    }
+    if (!found) {
+      struct timespec idle = {0, IDLE_SLEEP_NS};
+      nanosleep(&idle, NULL);
+      continue;
+    }
+    self->blocks++;
+    if (runBlock(&tasks[task]))
+      __atomic_sub_fetch(&remainingTasks, 1, __ATOMIC_RELEASE);
+    else
+      pushBack(self, task);
+  }
+  return NULL;
+}
+
+// Reads a file of raw 16-bit little-endian ADC samples.
+static bool loadFile(stream_t *stream, const char *path) {
+  FILE *file = fopen(path, "rb");
+  if (!file) {
+    printf("detectorServer: unable to open %s.\n", path);
+    return false;
+  }
+  fseek(file, 0, SEEK_END);
+  long bytes = ftell(file);
+  fseek(file, 0, SEEK_SET);
+  stream->sampleCount = bytes > 0 ? bytes / sizeof(uint16_t) : 0;
+  stream->samples = malloc(stream->sampleCount * sizeof(uint16_t) + 1);
+  bool ok = stream->samples &&
+            fread(stream->samples, sizeof(uint16_t), stream->sampleCount,
+                  file) == stream->sampleCount;
+  fclose(file);
+  if (!ok)
+    printf("detectorServer: unable to read %s.\n", path);
+  return ok;
+}
+
+// Noise plus one shot per second, on a different frequency for every stream.
+static bool synthesize(stream_t *stream, double seconds) {
+  stream->sampleCount = seconds * SAMPLE_RATE;
+  stream->samples = malloc(stream->sampleCount * sizeof(uint16_t) + 1);
+  uint32_t maxShots = stream->sampleCount / SYNTH_SHOT_EVERY + 1;
+  signalGenerator_burst_t *shots =
+      malloc(maxShots * sizeof(signalGenerator_burst_t));
+  signalGenerator_t *gen = malloc(sizeof(signalGenerator_t));
+  signalGenerator_config_t config = {.seed = stream->id + 1,
+                                     .noiseSigma = SYNTH_NOISE_SIGMA};
+  uint16_t frequency = stream->id % FILTER_FREQUENCY_COUNT;
+  bool ok = stream->samples && shots && gen &&
+            signalGenerator_init(gen, &config);
+  if (ok) {
+    uint32_t shotCount = signalGenerator_makeShots(
+        shots, maxShots, stream->sampleCount, 0, SYNTH_SHOT_EVERY, &frequency,
+        1, SYNTH_SHOT_AMPLITUDE, 0);
+    ok = signalGenerator_setBursts(gen, shots, shotCount);
+  }
+  if (ok)
+    signalGenerator_generate(gen, stream->samples, stream->sampleCount);
+  free(shots);
+  free(gen);
+  return ok;
+}
+
+static stream_t *newStream() {
+  stream_t *stream = calloc(1, sizeof(stream_t));
+  if (!stream)
+    return NULL;
+  stream->id = streamCount;
+  streams[streamCount++] = stream;
+  return stream;
+}
+
+// Gives every stream its own task and detector.
+static bool makeStreamTasks() {
+  for (uint32_t i = 0; i < streamCount; i++) {
+    stream_t *stream = streams[i];
+    filter_ctxInit(&stream->filter);
+    detector_ctxInit(&stream->detector, &stream->filter, &hooks);
+    detector_ctxSetFreezeOnHit(&stream->detector, false); // Every hit counts.
+    stream->detector.user = stream;
+    tasks[taskCount++] = (task_t){.streams = {stream},
+                                  .laneCount = 1,
+                                  .sampleCount = stream->sampleCount};
+  }
+  return true;
+}
+
+// Puts the streams into batches of DETECTORBATCH_LANES, one task each.
+static bool makeBatchTasks() {
+  for (uint32_t i = 0; i < streamCount; i += DETECTORBATCH_LANES) {
+    task_t *task = &tasks[taskCount++];
+    *task = (task_t){.batch = detectorBatch_create(&hooks)};
+    if (!task->batch)
+      return false;
+    for (uint32_t s = i; s < streamCount && s < i + DETECTORBATCH_LANES;
+         s++) {
+      stream_t *stream = streams[s];
+      stream->batch = task->batch;
+      detector_ctx_t *detector =
+          detectorBatch_getDetector(task->batch, task->laneCount);
+      detector->user = stream;
+      detector_ctxSetFreezeOnHit(detector, false);
+      task->streams[task->laneCount++] = stream;
+      if (stream->sampleCount > task->sampleCount)
+        task->sampleCount = stream->sampleCount;
+    }
+  }
+  return true;
+}
+
+static void report(double wallSeconds) {
+  uint64_t totalSamples = 0;
+  uint32_t totalHits = 0;
+  printf("\nstream   samples  hits  blocks  busy (s)  samples/s\n");
+  for (uint32_t i = 0; i < streamCount; i++) {
+    stream_t *stream = streams[i];
+    printf("%6u  %8lu  %4u  %6u  %8.3f  %9.3e\n", stream->id,
+           (unsigned long)stream->sampleCount, stream->hits, stream->blocks,
+           stream->busySeconds,
+           stream->busySeconds > 0 ? stream->sampleCount / stream->busySeconds
+                                   : 0);
+    totalSamples += stream->sampleCount;
+    totalHits += stream->hits;
+  }
+  uint32_t steals = 0;
+  for (uint32_t t = 0; t < threadCount; t++)
+    steals += workers[t].steals;
+  double rate = wallSeconds > 0 ? totalSamples / wallSeconds : 0;
+  printf("%u streams in %u tasks on %u threads: %lu samples, %u hits in "
+         "%.3f s, %.3e samples/s (%.1f streams in real time), %u steals\n",
+         streamCount, taskCount, threadCount, (unsigned long)totalSamples,
+         totalHits, wallSeconds, rate, rate / SAMPLE_RATE, steals);
+}
+
+static void usage() {
+  printf("usage: detectorServer [-threads N] [-block SAMPLES] [-batch] "
+         "[-quiet] [-synthetic STREAMS] [-seconds S] [FILE...]\n"
+         "Each FILE is a stream of raw 16-bit little-endian ADC samples at "
+         "100 kHz.\n");
+}
+
+int main(int argc, char *argv[]) {
+  uint32_t synthetic = 0;
+  bool batch = false;
+  double seconds = 10;
+  threadCount = sysconf(_SC_NPROCESSORS_ONLN);
+  const char *paths[MAX_STREAMS];
+  uint32_t pathCount = 0;
+  for (int i = 1; i < argc; i++) {
+    bool hasValue = i + 1 < argc;
+    if (!strcmp(argv[i], "-threads") && hasValue)
+      threadCount = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-block") && hasValue)
+      blockSamples = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-synthetic") && hasValue)
+      synthetic = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-seconds") && hasValue)
+      seconds = atof(argv[++i]);
+    else if (!strcmp(argv[i], "-batch"))
+      batch = true;
+    else if (!strcmp(argv[i], "-quiet"))
+      quiet = true;
+    else if (argv[i][0] != '-' && pathCount < MAX_STREAMS)
+      paths[pathCount++] = argv[i];
+    else {
+      usage();
+      return 1;
+    }
+  }
+  if (threadCount == 0 || threadCount > MAX_THREADS || blockSamples == 0 ||
+      synthetic + pathCount == 0 || synthetic + pathCount > MAX_STREAMS ||
+      seconds <= 0) {
+    usage();
+    return 1;
+  }
+
+  for (uint32_t i = 0; i < pathCount; i++) {
+    stream_t *stream = newStream();
+    if (!stream || !loadFile(stream, paths[i]))
+      return 1;
+  }
+  for (uint32_t i = 0; i < synthetic; i++) {
+    stream_t *stream = newStream();
+    if (!stream || !synthesize(stream, seconds)) {
+      printf("detectorServer: out of memory.\n");
+      return 1;
+    }
+  }
+
+  if (!(batch ? makeBatchTasks() : makeStreamTasks())) {
+    printf("detectorServer: out of memory.\n");
+    return 1;
+  }
+
+  // Deal the tasks out round-robin, the threads balance from there.
+  for (uint32_t t = 0; t < threadCount; t++) {
+    pthread_mutex_init(&workers[t].lock, NULL);
+    workers[t].tasks = malloc(taskCount * sizeof(uint32_t));
+  }
+  for (uint32_t i = 0; i < taskCount; i++)
+    pushBack(&workers[i % threadCount], i);
+  remainingTasks = taskCount;
+  double start = nowSeconds();
+  for (uint32_t t = 0; t < threadCount; t++)
+    pthread_create(&workers[t].thread, NULL, workerThread, &workers[t]);
+  for (uint32_t t = 0; t < threadCount; t++)
+    pthread_join(workers[t].thread, NULL);
+  report(nowSeconds() - start);
+
+  for (uint32_t i = 0; i < taskCount; i++)
+    if (tasks[i].batch)
+      detectorBatch_free(tasks[i].batch);
+    else
+      filter_ctxFree(&tasks[i].streams[0]->filter);
+  for (uint32_t i = 0; i < streamCount; i++) {
+    free(streams[i]->samples);
+    free(streams[i]);
+  }
+  for (uint32_t t = 0; t < threadCount; t++)
+    free(workers[t].tasks);
+  return 0;
+}
@@ -0,0 +1,612 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+// Sweeps the detector's threshold over a grid of signal-to-noise ratios and
+// interferer counts and reports, for every threshold, how often a shot is
+// detected on its frequency, how often noise alone makes a hit, and how long
+// detection takes. Tunes fudgeFactors[] and THRESHOLD_FACTOR in detector.c
+// for a venue.
+//
+// A trial is TRIAL_SAMPLES of signal from signalGenerator.h: noise only for
+// NOISE_SAMPLES after the filters have settled, then one 200 ms shot on the
+// trial's frequency, with the interferers (shots on other frequencies,
+// -interfererDb below it, starting up to JITTER_SAMPLES apart) on top.
+// -steady DB adds a source that is on for the whole trial, a beacon or a lamp
+// that hits one of the other frequencies, DB over the noise. The
+// SNR is the shot's amplitude over the noise's sigma. With -venue CAPTURE
+// the noise is the samples of a capture (capture.h) made in the venue with
+// nobody shooting, and the SNR is against their sigma.
+//
+// The filters do not depend on the threshold, so every trial runs them once
+// and runs hit detection for every threshold on the same power values, each
+// with its own detector context. -decision picks the median rule, CFAR or
+// both (detector_decision_t), so the two are compared on the same trials; a
+// bright, noisy venue is -flicker and -impulses, or -venue. -early turns on
+// early detection (detector_ctxSetEarlyDetection()) for every threshold. The trials are
+// spread over a pool of threads. Each trial's signal depends only on the seed
+// and its place in the grid, so a sweep gives the same numbers on any number
+// of threads.
+//
+// Prints one CSV line per SNR, interferer count and threshold (decision,
+// fudge factor and threshold factor), to -csv FILE if given, then the
+// threshold that detects the most shots with no more than -maxFalseAlarms
+// false alarms per minute of noise.
+
+#include <math.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "capture.h"
+#include "detector.h"
+#include "filter.h"
+#include "signalGenerator.h"
+
+#define SAMPLES_PER_MS (SIGNALGENERATOR_SAMPLE_RATE / 1000)
+#define SETTLE_SAMPLES 10000 // 100 ms for the filters, hits are not counted.
+#define NOISE_SAMPLES 50000  // 500 ms of noise before the shot.
+#define SHOT_START (SETTLE_SAMPLES + NOISE_SAMPLES)
+#define SHOT_END (SHOT_START + SIGNALGENERATOR_SHOT_SAMPLES)
+#define LATE_SAMPLES 5000 // A hit this long after the shot still counts.
+#define TRIAL_SAMPLES (SHOT_END + 10000)
+#define SHOT_RAMP 200
+#define JITTER_SAMPLES 5000 // Interferers start this much before or after.
+#define NOISE_SIGMA 20.0    // ADC counts, of the synthetic noise.
+#define MAX_LIST 32
+#define DECISION_COUNT 2
+#define MAX_THRESHOLDS 64
+#define MAX_THREADS 256
+#define DB_PER_DECADE 20.0
+#define SECONDS_PER_MINUTE 60.0
+#define NS_PER_SECOND 1000000000.0
+#define MAGIC "LTCP"
+#define MAGIC_SIZE 4
+#define GOLDEN 0x9e3779b97f4a7c15ull
+#define MIX_1 0xbf58476d1ce4e5b9ull
+#define MIX_2 0x94d049bb133111ebull
+
+typedef struct {
+  double values[MAX_LIST];
+  uint16_t count;
+} list_t;
+
+// Counts for one SNR, interferer count and threshold. Integers only, so the
+// sums do not depend on which thread ran which trial.
+typedef struct {
+  uint64_t trials;
+  uint64_t detected;       // Hit on the shot's frequency, in time.
+  uint64_t wrongFrequency; // First hit during the shot on another frequency.
+  uint64_t falseAlarms;    // Hits on noise alone.
+  uint64_t latencySamples; // From the shot's start, summed over detections.
+} cell_t;
+
+typedef struct worker worker_t;
+
+// One detector's view of the trial being run.
+typedef struct {
+  worker_t *worker;
+  uint16_t target; // Frequency of the shot.
+  uint32_t falseAlarms;
+  bool decided; // The first hit during the shot has been seen.
+  bool detected;
+  bool wrongFrequency;
+  uint32_t latencySamples;
+} trialRecord_t;
+
+struct worker {
+  pthread_t thread;
+  cell_t *cells;
+  uint32_t position; // Sample being run.
+  uint16_t samples[TRIAL_SAMPLES];
+  filter_ctx_t filter;
+  detector_ctx_t detectors[MAX_THRESHOLDS];
+  trialRecord_t records[MAX_THRESHOLDS];
+  signalGenerator_t gen;
+};
+
+static list_t snrs = {{0, 5, 10, 15, 20, 25}, 6};
+static list_t interferers = {{0, 1, 2}, 3};
+static list_t fudgeFactors = {{100, 450, 600, 800, 1000}, 5};
+static list_t thresholdFactors = {{0.01, 0.1, 1}, 3};
+static const char *const decisionNames[DECISION_COUNT] = {"median", "cfar"};
+static detector_decision_t decisions[DECISION_COUNT] = {
+    detector_medianDecision_e};
+static uint16_t decisionCount = 1;
+static uint32_t trialsPerCell = 100;
+static uint32_t thresholdCount;
+static double interfererDb = -6;
+static double steadyDb;
+static bool steady;
+static bool early;
+static double flickerAmplitude;
+static double impulseRate;
+static uint64_t seed = 1;
+static uint16_t *venue; // Background samples with -venue.
+static uint64_t venueCount;
+static double noiseSigma = NOISE_SIGMA;
+static uint32_t jobCount;
+static uint32_t nextJob;
+static pthread_mutex_t jobLock = PTHREAD_MUTEX_INITIALIZER;
+
+static double nowSeconds() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / NS_PER_SECOND;
+}
+
+static uint64_t mix(uint64_t z) {
+  z = (z ^ (z >> 30)) * MIX_1;
+  z = (z ^ (z >> 27)) * MIX_2;
+  return z ^ (z >> 31);
+}
+
+// Counts every hit.
+static void hitHandler(detector_ctx_t *ctx) {
+  trialRecord_t *record = ctx->user;
+  uint32_t position = record->worker->position;
+  if (position < SETTLE_SAMPLES)
+    return;
+  if (position < SHOT_START) {
+    record->falseAlarms++;
+  } else if (!record->decided && position < SHOT_END + LATE_SAMPLES) {
+    record->decided = true;
+    record->detected = ctx->frequencyDetected == record->target;
+    record->wrongFrequency = !record->detected;
+    record->latencySamples = position - SHOT_START;
+  }
+}
+
+static const detector_hooks_t hooks = {.hitHandler = hitHandler};
+
+// Threshold t is every decision with every fudge factor with every threshold
+// factor, the threshold factor changing fastest.
+static detector_decision_t getDecision(uint32_t t) {
+  return decisions[t / thresholdFactors.count / fudgeFactors.count];
+}
+
+static double getFudgeFactor(uint32_t t) {
+  return fudgeFactors.values[t / thresholdFactors.count % fudgeFactors.count];
+}
+
+static double getThresholdFactor(uint32_t t) {
+  return thresholdFactors.values[t % thresholdFactors.count];
+}
+
+// Adds a burst to bursts[], keeping them sorted by start.
+static void addBurst(signalGenerator_burst_t bursts[], uint16_t *burstCount,
+                     signalGenerator_burst_t burst) {
+  uint16_t at = (*burstCount)++;
+  while (at > 0 && bursts[at - 1].start > burst.start) {
+    bursts[at] = bursts[at - 1];
+    at--;
+  }
+  bursts[at] = burst;
+}
+
+// The samples of a trial: the shot on frequency target with its interferers,
+// on synthetic noise or a stretch of the venue.
+static bool makeTrial(worker_t *worker, uint32_t job, double snrDb,
+                      uint16_t interfererCount, uint16_t target) {
+  uint64_t random = mix(seed * GOLDEN + job);
+  double amplitude = noiseSigma * pow(10, snrDb / DB_PER_DECADE);
+  signalGenerator_burst_t bursts[FILTER_FREQUENCY_COUNT + 1];
+  uint16_t burstCount = 0;
+  bursts[burstCount++] = (signalGenerator_burst_t){
+      .start = SHOT_START,
+      .length = SIGNALGENERATOR_SHOT_SAMPLES,
+      .ramp = SHOT_RAMP,
+      .frequencyNumber = target,
+      .amplitude = amplitude};
+  // Interferers on distinct other frequencies, from a shuffle of the others.
+  uint16_t others[FILTER_FREQUENCY_COUNT - 1];
+  for (uint16_t f = 0, n = 0; f < FILTER_FREQUENCY_COUNT; f++)
+    if (f != target)
+      others[n++] = f;
+  for (uint16_t i = 0; i < interfererCount && i < FILTER_FREQUENCY_COUNT - 1;
+       i++) {
+    random = mix(random + GOLDEN);
+    uint16_t pick = i + random % (FILTER_FREQUENCY_COUNT - 1 - i);
+    uint16_t frequency = others[pick];
+    others[pick] = others[i];
+    others[i] = frequency;
+    int32_t jitter = (int32_t)((random >> 32) % (2 * JITTER_SAMPLES + 1)) -
+                     JITTER_SAMPLES;
+    addBurst(bursts, &burstCount,
+             (signalGenerator_burst_t){
+                 .start = SHOT_START + jitter,
+                 .length = SIGNALGENERATOR_SHOT_SAMPLES,
+                 .ramp = SHOT_RAMP,
+                 .frequencyNumber = frequency,
+                 .amplitude =
+                     amplitude * pow(10, interfererDb / DB_PER_DECADE)});
+  }
+  if (steady) {
+    random = mix(random + GOLDEN);
+    uint16_t frequency =
+        (target + 1 + random % (FILTER_FREQUENCY_COUNT - 1)) %
+        FILTER_FREQUENCY_COUNT;
+    addBurst(bursts, &burstCount,
+             (signalGenerator_burst_t){
+                 .start = 0,
+                 .length = TRIAL_SAMPLES,
+                 .ramp = SHOT_RAMP,
+                 .frequencyNumber = frequency,
+                 .amplitude = noiseSigma * pow(10, steadyDb / DB_PER_DECADE)});
+  }
+  signalGenerator_config_t config = {.seed = random,
+                                     .noiseSigma = venue ? 0 : noiseSigma,
+                                     .impulseRate = impulseRate,
+                                     .impulseAmplitude = noiseSigma * 10,
+                                     .mainsHz = 60,
+                                     .flickerAmplitude = flickerAmplitude,
+                                     .flickerHarmonics = 4};
+  if (!signalGenerator_init(&worker->gen, &config) ||
+      !signalGenerator_setBursts(&worker->gen, bursts, burstCount))
+    return false;
+  signalGenerator_generate(&worker->gen, worker->samples, TRIAL_SAMPLES);
+  if (venue) {
+    uint64_t offset = (random >> 16) % venueCount;
+    for (uint32_t i = 0; i < TRIAL_SAMPLES; i++) {
+      int32_t value = venue[(offset + i) % venueCount] +
+                      worker->samples[i] - SIGNALGENERATOR_ADC_MIDSCALE;
+      worker->samples[i] = value < 0                         ? 0
+                           : value > SIGNALGENERATOR_ADC_MAX ? SIGNALGENERATOR_ADC_MAX
+                                                             : value;
+    }
+  }
+  return true;
+}
+
+// Runs a trial through the filters once and every threshold's hit detection.
+static void runTrial(worker_t *worker, uint32_t job) {
+  uint32_t cellsPerSnr = interferers.count;
+  uint32_t trial = job % trialsPerCell;
+  uint32_t cellJob = job / trialsPerCell; // SNR and interferer count.
+  uint16_t snrIndex = cellJob / cellsPerSnr;
+  uint16_t interfererIndex = cellJob % cellsPerSnr;
+  uint16_t target = trial % FILTER_FREQUENCY_COUNT;
+  if (!makeTrial(worker, job, snrs.values[snrIndex],
+                 interferers.values[interfererIndex], target))
+    return;
+
+  filter_ctxInit(&worker->filter);
+  for (uint32_t t = 0; t < thresholdCount; t++) {
+    detector_ctx_t *detector = &worker->detectors[t];
+    detector_ctxInit(detector, &worker->filter, &hooks);
+    detector_ctxSetFreezeOnHit(detector, false); // Every hit counts.
+    detector_ctxSetThreshold(detector, getFudgeFactor(t),
+                             getThresholdFactor(t));
+    detector_ctxSetDecision(detector, getDecision(t));
+    detector_ctxSetEarlyDetection(detector, early);
+    worker->records[t] = (trialRecord_t){.worker = worker, .target = target};
+    detector->user = &worker->records[t];
+  }
+  // The first detector runs the filters, the others only detect hits.
+  detector_ctx_t *first = &worker->detectors[0];
+  for (worker->position = 0; worker->position < TRIAL_SAMPLES;
+       worker->position++) {
+    detector_ctxAddSample(first, worker->samples[worker->position]);
+    if (first->sampleCnt == 0) // The filters just ran.
+      for (uint32_t t = 1; t < thresholdCount; t++)
+        detector_ctxDetectHit(&worker->detectors[t]);
+  }
+  filter_ctxFree(&worker->filter);
+
+  for (uint32_t t = 0; t < thresholdCount; t++) {
+    const trialRecord_t *record = &worker->records[t];
+    cell_t *cell = &worker->cells[cellJob * thresholdCount + t];
+    cell->trials++;
+    cell->detected += record->detected;
+    cell->wrongFrequency += record->wrongFrequency;
+    cell->falseAlarms += record->falseAlarms;
+    if (record->detected)
+      cell->latencySamples += record->latencySamples;
+  }
+}
+
+static void *workerMain(void *arg) {
+  worker_t *worker = arg;
+  while (true) {
+    pthread_mutex_lock(&jobLock);
+    uint32_t job = nextJob++;
+    pthread_mutex_unlock(&jobLock);
+    if (job >= jobCount)
+      return NULL;
+    runTrial(worker, job);
+  }
+}
+
+// Comma-separated numbers.
+static bool parseList(const char *text, list_t *list) {
+  list->count = 0;
+  while (*text && list->count < MAX_LIST) {
+    char *end;
+    list->values[list->count++] = strtod(text, &end);
+    if (end == text || (*end && *end != ','))
+      return false;
+    text = *end ? end + 1 : end;
+  }
+  return list->count > 0 && !*text;
+}
+
+// median, cfar or both.
+static bool parseDecision(const char *text) {
+  bool both = !strcmp(text, "both");
+  decisionCount = 0;
+  if (both || !strcmp(text, decisionNames[detector_medianDecision_e]))
+    decisions[decisionCount++] = detector_medianDecision_e;
+  if (both || !strcmp(text, decisionNames[detector_cfarDecision_e]))
+    decisions[decisionCount++] = detector_cfarDecision_e;
+  return decisionCount > 0;
+}
+
+static uint64_t getLittle(const uint8_t *bytes, uint8_t size) {
+  uint64_t value = 0;
+  for (uint8_t i = size; i > 0; i--)
+    value = value << 8 | bytes[i - 1];
+  return value;
+}
+
+// Reads every sample of a capture, gaps closed up, and measures their sigma.
+static bool loadVenue(const char *path) {
+  FILE *file = fopen(path, "rb");
+  if (!file) {
+    printf("detectorSweep: unable to open %s.\n", path);
+    return false;
+  }
+  fseek(file, 0, SEEK_END);
+  long size = ftell(file);
+  fseek(file, 0, SEEK_SET);
+  uint8_t *data = size > CAPTURE_HEADER_SIZE ? malloc(size) : NULL;
+  bool ok = data && fread(data, 1, size, file) == (size_t)size &&
+            !memcmp(data, MAGIC, MAGIC_SIZE) &&
+            getLittle(data + 4, 2) == CAPTURE_VERSION;
+  fclose(file);
+  // Two bytes of samples need at least one byte of capture.
+  venue = ok ? malloc(size * sizeof(uint16_t)) : NULL;
+  if (!venue) {
+    printf("detectorSweep: %s is not a version %d capture.\n", path,
+           CAPTURE_VERSION);
+    free(data);
+    return false;
+  }
+  size_t offset = getLittle(data + 6, 2);
+  while (offset + CAPTURE_CHUNK_HEADER_SIZE <= (size_t)size) {
+    const uint8_t *chunk = data + offset;
+    uint32_t count = getLittle(chunk + 2, 2); // 16 bits, kept unsigned.
+    uint32_t payloadSize = getLittle(chunk + 4, 4);
+    const uint8_t *bytes = chunk + CAPTURE_CHUNK_HEADER_SIZE;
+    if (payloadSize > size - offset - CAPTURE_CHUNK_HEADER_SIZE)
+      break;
+    if (chunk[0] == capture_samplesChunk_e &&
+        payloadSize >= CAPTURE_SAMPLES_BYTES(count)) {
+      for (uint32_t i = 0; i < count; i++) {
+        const uint8_t *pair = bytes + i / 2 * 3;
+        venue[venueCount++] = i % 2 ? (pair[1] >> 4 | pair[2] << 4)
+                                    : (pair[0] | (pair[1] & 0x0f) << 8);
+      }
+    }
+    offset += CAPTURE_CHUNK_HEADER_SIZE + payloadSize;
+  }
+  free(data);
+  if (venueCount < TRIAL_SAMPLES) {
+    printf("detectorSweep: %s has fewer than %d samples.\n", path,
+           TRIAL_SAMPLES);
+    return false;
+  }
+  double sum = 0, squares = 0;
+  for (uint64_t i = 0; i < venueCount; i++) {
+    sum += venue[i];
+    squares += (double)venue[i] * venue[i];
+  }
+  double mean = sum / venueCount;
+  noiseSigma = sqrt(squares / venueCount - mean * mean);
+  printf("detectorSweep: %s, %lu samples, noise sigma %.1f.\n", path,
+         (unsigned long)venueCount, noiseSigma);
+  return noiseSigma > 0;
+}
+
+static double noiseMinutes(const cell_t *cell) {
+  return cell->trials * (double)(SHOT_START - SETTLE_SAMPLES) /
+         SIGNALGENERATOR_SAMPLE_RATE / SECONDS_PER_MINUTE;
+}
+
+static void printCsv(FILE *out, const cell_t *cells) {
+  fprintf(out, "snrDb,interferers,decision,fudgeFactor,thresholdFactor,"
+               "trials,"
+               "hitProbability,wrongFrequencyRate,falseAlarmsPerMinute,"
+               "meanLatencyMs\n");
+  for (uint32_t c = 0; c < (uint32_t)snrs.count * interferers.count; c++) {
+    for (uint32_t t = 0; t < thresholdCount; t++) {
+      const cell_t *cell = &cells[c * thresholdCount + t];
+      fprintf(out, "%g,%g,%s,%g,%g,%lu,%.4f,%.4f,%.3f,%.2f\n",
+              snrs.values[c / interferers.count],
+              interferers.values[c % interferers.count],
+              decisionNames[getDecision(t)], getFudgeFactor(t),
+              getThresholdFactor(t),
+              (unsigned long)cell->trials,
+              (double)cell->detected / cell->trials,
+              (double)cell->wrongFrequency / cell->trials,
+              cell->falseAlarms / noiseMinutes(cell),
+              cell->detected ? (double)cell->latencySamples / cell->detected /
+                                   SAMPLES_PER_MS
+                             : 0);
+    }
+  }
+}
+
+// The threshold with the highest hit probability over the whole grid among
+// those within the false-alarm limit, with its hit probability per SNR.
+static void printBest(const cell_t *cells, double maxFalseAlarms) {
+  uint32_t cellCount = (uint32_t)snrs.count * interferers.count;
+  int32_t best = -1;
+  double bestHits = 0, bestFalseAlarms = 0;
+  for (uint32_t t = 0; t < thresholdCount; t++) {
+    uint64_t trials = 0, detected = 0, falseAlarms = 0;
+    double minutes = 0;
+    for (uint32_t c = 0; c < cellCount; c++) {
+      const cell_t *cell = &cells[c * thresholdCount + t];
+      trials += cell->trials;
+      detected += cell->detected;
+      falseAlarms += cell->falseAlarms;
+      minutes += noiseMinutes(cell);
+    }
+    double hits = (double)detected / trials;
+    double falseAlarmRate = falseAlarms / minutes;
+    if (falseAlarmRate <= maxFalseAlarms &&
+        (best < 0 || hits > bestHits ||
+         (hits == bestHits && falseAlarmRate < bestFalseAlarms))) {
+      best = t;
+      bestHits = hits;
+      bestFalseAlarms = falseAlarmRate;
+    }
+  }
+  if (best < 0) {
+    printf("No threshold has %g or fewer false alarms per minute.\n",
+           maxFalseAlarms);
+    return;
+  }
+  printf("Best: %s, fudge factor %g, threshold factor %g: hit probability "
+         "%.3f, %.3f false alarms per minute.\n",
+         decisionNames[getDecision(best)], getFudgeFactor(best),
+         getThresholdFactor(best), bestHits, bestFalseAlarms);
+  for (uint16_t s = 0; s < snrs.count; s++) {
+    printf("  SNR %5g dB:", snrs.values[s]);
+    for (uint16_t i = 0; i < interferers.count; i++) {
+      const cell_t *cell =
+          &cells[(s * interferers.count + i) * thresholdCount + best];
+      printf("  %g interferers %.3f", interferers.values[i],
+             (double)cell->detected / cell->trials);
+    }
+    printf("\n");
+  }
+}
+
+static void usage() {
+  printf("usage: detectorSweep [-threads N] [-trials N] [-snr DB,...] "
+         "[-interferers N,...] [-interfererDb DB] [-fudge F,...] "
+         "[-threshold T,...] [-decision median|cfar|both] [-early] [-steady DB] "
+         "[-flicker A] [-impulses RATE] [-venue CAPTURE] "
+         "[-seed N] [-maxFalseAlarms X] [-csv FILE]\n"
+         "-trials is per SNR and interferer count; the thresholds are every "
+         "decision with every fudge factor and every threshold factor (at "
+         "most %d).\n",
+         MAX_THRESHOLDS);
+}
+
+int main(int argc, char *argv[]) {
+  uint32_t threadCount = sysconf(_SC_NPROCESSORS_ONLN);
+  double maxFalseAlarms = 1;
+  const char *csvPath = NULL;
+  const char *venuePath = NULL;
+  bool ok = true;
+  for (int i = 1; i < argc && ok; i++) {
+    bool hasValue = i + 1 < argc;
+    if (!strcmp(argv[i], "-threads") && hasValue)
+      threadCount = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-trials") && hasValue)
+      trialsPerCell = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-snr") && hasValue)
+      ok = parseList(argv[++i], &snrs);
+    else if (!strcmp(argv[i], "-interferers") && hasValue)
+      ok = parseList(argv[++i], &interferers);
+    else if (!strcmp(argv[i], "-interfererDb") && hasValue)
+      interfererDb = atof(argv[++i]);
+    else if (!strcmp(argv[i], "-fudge") && hasValue)
+      ok = parseList(argv[++i], &fudgeFactors);
+    else if (!strcmp(argv[i], "-threshold") && hasValue)
+      ok = parseList(argv[++i], &thresholdFactors);
+    else if (!strcmp(argv[i], "-decision") && hasValue)
+      ok = parseDecision(argv[++i]);
+    else if (!strcmp(argv[i], "-early"))
+      early = true;
+    else if (!strcmp(argv[i], "-steady") && hasValue) {
+      steady = true;
+      steadyDb = atof(argv[++i]);
+    } else if (!strcmp(argv[i], "-flicker") && hasValue)
+      flickerAmplitude = atof(argv[++i]);
+    else if (!strcmp(argv[i], "-impulses") && hasValue)
+      impulseRate = atof(argv[++i]);
+    else if (!strcmp(argv[i], "-venue") && hasValue)
+      venuePath = argv[++i];
+    else if (!strcmp(argv[i], "-seed") && hasValue)
+      seed = strtoull(argv[++i], NULL, 0);
+    else if (!strcmp(argv[i], "-maxFalseAlarms") && hasValue)
+      maxFalseAlarms = atof(argv[++i]);
+    else if (!strcmp(argv[i], "-csv") && hasValue)
+      csvPath = argv[++i];
+    else
+      ok = false;
+  }
+  thresholdCount =
+      (uint32_t)decisionCount * fudgeFactors.count * thresholdFactors.count;
+  if (!ok || threadCount < 1 || threadCount > MAX_THREADS ||
+      trialsPerCell < 1 || thresholdCount > MAX_THRESHOLDS ||
+      impulseRate < 0 || impulseRate > 1) {
+    usage();
+    return 1;
+  }
+  if (venuePath && !loadVenue(venuePath))
+    return 1;
+  FILE *csv = csvPath ? fopen(csvPath, "w") : stdout;
+  if (!csv) {
+    printf("detectorSweep: unable to write %s.\n", csvPath);
+    return 1;
+  }
+
+  uint32_t cellCount = (uint32_t)snrs.count * interferers.count;
+  jobCount = cellCount * trialsPerCell;
+  worker_t *workers = calloc(threadCount, sizeof(worker_t));
+  cell_t *cells = calloc((size_t)cellCount * thresholdCount, sizeof(cell_t));
+  if (!workers || !cells) {
+    printf("detectorSweep: out of memory.\n");
+    return 1;
+  }
+  double start = nowSeconds();
+  for (uint32_t t = 0; t < threadCount; t++) {
+    workers[t].cells = calloc((size_t)cellCount * thresholdCount, sizeof(cell_t));
+    if (!workers[t].cells ||
+        pthread_create(&workers[t].thread, NULL, workerMain, &workers[t])) {
+      printf("detectorSweep: unable to start thread %u.\n", t);
+      return 1;
+    }
+  }
+  for (uint32_t t = 0; t < threadCount; t++) {
+    pthread_join(workers[t].thread, NULL);
+    for (uint32_t c = 0; c < cellCount * thresholdCount; c++) {
+      cells[c].trials += workers[t].cells[c].trials;
+      cells[c].detected += workers[t].cells[c].detected;
+      cells[c].wrongFrequency += workers[t].cells[c].wrongFrequency;
+      cells[c].falseAlarms += workers[t].cells[c].falseAlarms;
+      cells[c].latencySamples += workers[t].cells[c].latencySamples;
+    }
+    free(workers[t].cells);
+  }
+  double seconds = nowSeconds() - start;
+
+  printCsv(csv, cells);
+  if (csvPath)
+    fclose(csv);
+  double signalSeconds =
+      (double)jobCount * TRIAL_SAMPLES / SIGNALGENERATOR_SAMPLE_RATE;
+  printf("%u trials (%.0f s of signal) with %u thresholds each in %.2f s on "
+         "%u threads, %.0f times real time.\n",
+         jobCount, signalSeconds, thresholdCount, seconds, threadCount,
+         signalSeconds / seconds);
+  printBest(cells, maxFalseAlarms);
+  free(cells);
+  free(workers);
+  free(venue);
+  return 0;
+}
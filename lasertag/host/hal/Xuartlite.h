@@ -0,0 +1,43 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef XUARTLITE_H_
+#define XUARTLITE_H_
+
+// Host stand-in for the Xilinx UART Lite driver. Only the polled calls that
+// bluetooth.c uses are provided. Each instance is backed by a uartModel_t
+// (see uartModel.h) that was attached to the same base address.
+
+#include <stdint.h>
+
+#include "xstatus.h"
+
+typedef struct {
+  uint32_t RegBaseAddress;
+} XUartLite_Config;
+
+typedef struct {
+  uint32_t RegBaseAddress;
+  void *Model; // uartModel_t backing this instance.
+} XUartLite;
+
+// Connects the instance to the model attached at effectiveAddr.
+// Returns XST_FAILURE if no model is attached there.
+int XUartLite_CfgInitialize(XUartLite *instancePtr, XUartLite_Config *config,
+                            uint32_t effectiveAddr);
+
+// Copies as many bytes as fit into the transmit FIFO. Returns that number.
+unsigned XUartLite_Send(XUartLite *instancePtr, uint8_t *dataBufferPtr,
+                        unsigned numBytes);
+
+// Copies up to numBytes out of the receive FIFO. Returns that number.
+unsigned XUartLite_Recv(XUartLite *instancePtr, uint8_t *dataBufferPtr,
+                        unsigned numBytes);
+
+#endif /* XUARTLITE_H_ */
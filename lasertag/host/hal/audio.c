@@ -0,0 +1,115 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+// Host stand-ins for the audio hardware that sound.c talks to: the I2C
+// interface of the codec (every call succeeds) and the I2S controller's
+// transmit FIFO. The FIFO drains at 48 kHz stereo, timed by the ISR tick
+// count, so sound_tick() sees "FIFO full" the way it does on the board.
+// The samples themselves are dropped.
+
+#include "hostBoard.h"
+#include "xiicps.h"
+#include "xil_io.h"
+#include "xparameters.h"
+
+// Register offsets and bits used by sound.c.
+#define I2S_RESET_REG 0x00
+#define I2S_CTRL_REG 0x04
+#define I2S_FIFO_STS_REG 0x20
+#define I2S_TX_FIFO_REG 0x2C
+#define I2S_TX_FIFO_RESET 0b010
+#define I2S_TX_ENABLE 0b001
+#define I2S_TX_FIFO_FULL 0b0010
+
+#define I2S_BASEADDR XPAR_AXI_I2S_ADI_1_S_AXI_BASEADDR
+#define TX_FIFO_DEPTH 64 // Words, two per stereo sample.
+// Words the codec takes per 100 kHz tick: 2 * 48000 / 100000 = 24 / 25.
+#define WORDS_PER_TICK_NUMERATOR 24
+#define WORDS_PER_TICK_DENOMINATOR 25
+
+static uint32_t fifoLevel;
+static bool txEnabled;
+static uint64_t drainedTicks; // Tick count the FIFO has been drained to.
+
+// Removes what the codec has taken since the last call.
+static void drainFifo() {
+  uint64_t ticks = hostBoard_isrTicks();
+  uint64_t words = (ticks * WORDS_PER_TICK_NUMERATOR) /
+                       WORDS_PER_TICK_DENOMINATOR -
+                   (drainedTicks * WORDS_PER_TICK_NUMERATOR) /
+                       WORDS_PER_TICK_DENOMINATOR;
+  drainedTicks = ticks;
+  if (!txEnabled)
+    return;
+  fifoLevel = words > fifoLevel ? 0 : fifoLevel - words;
+}
+
+u32 Xil_In32(u32 address) {
+  if (address == I2S_BASEADDR + I2S_FIFO_STS_REG) {
+    drainFifo();
+    return fifoLevel >= TX_FIFO_DEPTH ? I2S_TX_FIFO_FULL : 0;
+  }
+  return 0;
+}
+
+void Xil_Out32(u32 address, u32 value) {
+  drainFifo();
+  switch (address - I2S_BASEADDR) {
+  case I2S_RESET_REG:
+    if (value & I2S_TX_FIFO_RESET)
+      fifoLevel = 0;
+    break;
+  case I2S_CTRL_REG:
+    txEnabled = value & I2S_TX_ENABLE;
+    break;
+  case I2S_TX_FIFO_REG:
+    if (fifoLevel < TX_FIFO_DEPTH)
+      fifoLevel++;
+    break;
+  default:
+    break;
+  }
+}
+
+// Codec I2C interface.
+
+static XIicPs_Config iicConfig;
+
+XIicPs_Config *XIicPs_LookupConfig(u16 deviceId) {
+  iicConfig.DeviceId = deviceId;
+  return &iicConfig;
+}
+
+s32 XIicPs_CfgInitialize(XIicPs *instancePtr, XIicPs_Config *configPtr,
+                         u32 effectiveAddr) {
+  instancePtr->Config = *configPtr;
+  instancePtr->Config.BaseAddress = effectiveAddr;
+  return XST_SUCCESS;
+}
+
+s32 XIicPs_SelfTest(XIicPs *instancePtr) {
+  (void)instancePtr;
+  return XST_SUCCESS;
+}
+
+s32 XIicPs_SetSClk(XIicPs *instancePtr, u32 fsclHz) {
+  (void)instancePtr, (void)fsclHz;
+  return XST_SUCCESS;
+}
+
+s32 XIicPs_MasterSendPolled(XIicPs *instancePtr, u8 *msgPtr, s32 byteCount,
+                            u16 slaveAddr) {
+  (void)instancePtr, (void)msgPtr, (void)byteCount, (void)slaveAddr;
+  return XST_SUCCESS;
+}
+
+s32 XIicPs_BusIsBusy(XIicPs *instancePtr) {
+  (void)instancePtr;
+  return 0;
+}
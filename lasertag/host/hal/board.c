@@ -0,0 +1,173 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+// Host stand-ins for the simple board drivers: buttons, switches, LEDs, MIO
+// pins and the display. The time-keeping ones are in clock.c.
+
+#include <stdio.h>
+
+#include "buttons.h"
+#include "display.h"
+#include "hostBoard.h"
+#include "inputJournal.h"
+#include "leds.h"
+#include "mio.h"
+#include "switches.h"
+#include "xil_printf.h"
+
+#define MIO_PIN_COUNT 64
+#define TRACED_PIN_COUNT 16 // Pins in hostBoard_getPins().
+#define NO_PRESS UINT64_MAX
+// Main loops poll the buttons once per iteration. Sleeping this long there
+// keeps a gun from using a whole CPU (the detector catches up on the next
+// iteration), so that several guns can run on one machine. On simulated time
+// the main loop runs a step of ISR ticks instead.
+#define MAIN_LOOP_SLEEP_US 200
+
+static volatile uint8_t switchesValue;
+static volatile uint8_t buttonsValue;
+static volatile uint8_t pressMask;
+static volatile uint64_t pressTimeUs = NO_PRESS;
+static volatile uint8_t pins[MIO_PIN_COUNT];
+static volatile uint16_t tracedPins; // Bit n is pins[n].
+static uint8_t ledsValue;
+static bool echoDisplay;
+
+void hostBoard_setSwitches(uint8_t switches) {
+  inputJournal_switches(switches);
+  switchesValue = switches;
+}
+
+void hostBoard_setButtons(uint8_t buttons) {
+  inputJournal_buttons(buttons);
+  buttonsValue = buttons;
+}
+
+// The buttons in mask read as pressed from timeUs on.
+void hostBoard_pressButtonsAt(uint8_t mask, uint64_t timeUs) {
+  inputJournal_press(mask, timeUs);
+  pressMask = mask;
+  pressTimeUs = timeUs;
+}
+
+// Pins driven by the board itself (mio_writePin()) are not inputs, so only
+// hostBoard_setPin() goes into the journal.
+static void writePin(uint8_t pinNumber, uint8_t value) {
+  if (pinNumber < MIO_PIN_COUNT)
+    pins[pinNumber] = value;
+  if (pinNumber < TRACED_PIN_COUNT)
+    tracedPins = value ? tracedPins | (1 << pinNumber)
+                       : tracedPins & ~(1 << pinNumber);
+}
+
+void hostBoard_setPin(uint8_t pinNumber, uint8_t value) {
+  inputJournal_pin(pinNumber, value);
+  writePin(pinNumber, value);
+}
+
+uint16_t hostBoard_getPins() { return tracedPins; }
+
+// Copies text printed on the display to stdout.
+void hostBoard_echoDisplay(bool echo) { echoDisplay = echo; }
+
+// Buttons and switches.
+
+int32_t buttons_init() { return BUTTONS_INIT_STATUS_OK; }
+
+uint8_t buttons_read() {
+  uint64_t simulatedUs;
+  if (!hostBoard_inIsr()) {
+    if (hostBoard_getSimulatedTime(&simulatedUs))
+      hostBoard_yield();
+    else
+      hostBoard_sleepUs(MAIN_LOOP_SLEEP_US);
+  }
+  uint8_t value = buttonsValue;
+  if (pressTimeUs != NO_PRESS && hostBoard_microseconds() >= pressTimeUs)
+    value |= pressMask;
+  return value;
+}
+
+int32_t switches_init() { return SWITCHES_INIT_STATUS_OK; }
+
+uint8_t switches_read() { return switchesValue; }
+
+// LEDs and MIO pins.
+
+int32_t leds_init(bool printFailedStatusFlag) {
+  (void)printFailedStatusFlag;
+  return 1;
+}
+
+void leds_write(uint8_t ledValue) { ledsValue = ledValue; }
+
+int32_t mio_init(bool printFailedStatusFlag) {
+  (void)printFailedStatusFlag;
+  return 1;
+}
+
+void mio_setPinAsInput(uint8_t pinNumber) { (void)pinNumber; }
+
+void mio_setPinAsOutput(uint8_t pinNumber) { (void)pinNumber; }
+
+void mio_writePin(uint8_t pinNumber, uint8_t value) {
+  writePin(pinNumber, value);
+}
+
+uint8_t mio_readPin(uint8_t pinNumber) {
+  return pinNumber < MIO_PIN_COUNT ? pins[pinNumber] : 0;
+}
+
+// Display. Only text is echoed, graphics are dropped.
+
+void display_init() {}
+int16_t display_width() { return DISPLAY_WIDTH; }
+int16_t display_height() { return DISPLAY_HEIGHT; }
+void display_setRotation(uint8_t rotation) { (void)rotation; }
+void display_fillScreen(uint16_t color) { (void)color; }
+
+void display_fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                      uint16_t color) {
+  (void)x, (void)y, (void)w, (void)h, (void)color;
+}
+
+void display_drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                      uint16_t color) {
+  (void)x0, (void)y0, (void)x1, (void)y1, (void)color;
+}
+
+void display_drawPixel(int16_t x, int16_t y, uint16_t color) {
+  (void)x, (void)y, (void)color;
+}
+
+void display_setCursor(int16_t x, int16_t y) { (void)x, (void)y; }
+void display_setTextColor(uint16_t color) { (void)color; }
+void display_setTextSize(uint8_t size) { (void)size; }
+
+void display_print(const char *str) {
+  if (echoDisplay)
+    fputs(str, stdout);
+}
+
+void display_println(const char *str) {
+  if (echoDisplay)
+    puts(str);
+}
+
+void display_printChar(char c) {
+  if (echoDisplay)
+    putchar(c);
+}
+
+void display_printDecimalInt(int32_t number) {
+  if (echoDisplay)
+    printf("%d", number);
+}
+
+void outbyte(char c) { putchar(c); }
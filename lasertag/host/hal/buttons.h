@@ -0,0 +1,29 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef BUTTONS_H_
+#define BUTTONS_H_
+
+// Host stand-in for the ZYBO push-button driver. The buttons are set with
+// hostBoard_setButtons() (see hostBoard.h).
+
+#include <stdint.h>
+
+#define BUTTONS_BTN0_MASK 0x1
+#define BUTTONS_BTN1_MASK 0x2
+#define BUTTONS_BTN2_MASK 0x4
+#define BUTTONS_BTN3_MASK 0x8
+
+#define BUTTONS_INIT_STATUS_OK 1
+#define BUTTONS_INIT_STATUS_FAIL 0
+
+int32_t buttons_init();
+uint8_t buttons_read();
+
+#endif /* BUTTONS_H_ */
@@ -0,0 +1,121 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+// Host clock: the stand-ins for everything the gun code uses to tell time or
+// wait (utils_msDelay(), the interval timers, the timer_ps delay), all on
+// hostBoard_microseconds(). The ISR ticks come from the same clock, see
+// interrupts.c. On the wall clock a wait sleeps. On simulated time nothing
+// happens until the gun waits; a wait runs steps of ISR ticks until it is
+// over, so a delay of seconds takes only the time the ticks need.
+
+#include <time.h>
+
+#include "hostBoard.h"
+#include "intervalTimer.h"
+#include "timer_ps.h"
+#include "utils.h"
+#include "xstatus.h"
+
+#define US_PER_SECOND 1000000
+#define NS_PER_US 1000
+#define US_PER_MS 1000
+#define INTERVAL_TIMER_COUNT 3
+
+// Current time.
+uint64_t hostBoard_microseconds() {
+  uint64_t simulatedUs;
+  if (hostBoard_getSimulatedTime(&simulatedUs))
+    return simulatedUs;
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * US_PER_SECOND + ts.tv_nsec / NS_PER_US;
+}
+
+// Interval timers.
+
+static uint64_t timerStartUs[INTERVAL_TIMER_COUNT];
+static uint64_t timerTotalUs[INTERVAL_TIMER_COUNT];
+static bool timerRunning[INTERVAL_TIMER_COUNT];
+
+uint32_t intervalTimer_init(uint32_t timerNumber) {
+  return intervalTimer_reset(timerNumber);
+}
+
+uint32_t intervalTimer_initAll() { return intervalTimer_resetAll(); }
+
+uint32_t intervalTimer_start(uint32_t timerNumber) {
+  if (timerNumber >= INTERVAL_TIMER_COUNT)
+    return INTERVAL_TIMER_STATUS_FAIL;
+  timerStartUs[timerNumber] = hostBoard_microseconds();
+  timerRunning[timerNumber] = true;
+  return INTERVAL_TIMER_STATUS_OK;
+}
+
+uint32_t intervalTimer_stop(uint32_t timerNumber) {
+  if (timerNumber >= INTERVAL_TIMER_COUNT)
+    return INTERVAL_TIMER_STATUS_FAIL;
+  if (timerRunning[timerNumber])
+    timerTotalUs[timerNumber] +=
+        hostBoard_microseconds() - timerStartUs[timerNumber];
+  timerRunning[timerNumber] = false;
+  return INTERVAL_TIMER_STATUS_OK;
+}
+
+uint32_t intervalTimer_reset(uint32_t timerNumber) {
+  if (timerNumber >= INTERVAL_TIMER_COUNT)
+    return INTERVAL_TIMER_STATUS_FAIL;
+  timerTotalUs[timerNumber] = 0;
+  timerRunning[timerNumber] = false;
+  return INTERVAL_TIMER_STATUS_OK;
+}
+
+uint32_t intervalTimer_resetAll() {
+  for (uint32_t i = 0; i < INTERVAL_TIMER_COUNT; i++)
+    intervalTimer_reset(i);
+  return INTERVAL_TIMER_STATUS_OK;
+}
+
+// A running timer counts up to now.
+double intervalTimer_getTotalDurationInSeconds(uint32_t timerNumber) {
+  if (timerNumber >= INTERVAL_TIMER_COUNT)
+    return 0;
+  uint64_t totalUs = timerTotalUs[timerNumber];
+  if (timerRunning[timerNumber])
+    totalUs += hostBoard_microseconds() - timerStartUs[timerNumber];
+  return (double)totalUs / US_PER_SECOND;
+}
+
+// Delays.
+
+// Sleeps on the wall clock. On simulated time, steps of ISR ticks run until
+// the time is up.
+void hostBoard_sleepUs(uint64_t microseconds) {
+  uint64_t simulatedUs;
+  if (hostBoard_getSimulatedTime(&simulatedUs)) {
+    uint64_t endUs = simulatedUs + microseconds;
+    while (hostBoard_getSimulatedTime(&simulatedUs) && simulatedUs < endUs)
+      hostBoard_yield();
+    return;
+  }
+  struct timespec ts = {microseconds / US_PER_SECOND,
+                        (microseconds % US_PER_SECOND) * NS_PER_US};
+  while (nanosleep(&ts, &ts))
+    ;
+}
+
+void utils_msDelay(uint32_t milliseconds) {
+  hostBoard_sleepUs((uint64_t)milliseconds * US_PER_MS);
+}
+
+int TimerInitialize(u16 TimerDeviceId) {
+  (void)TimerDeviceId;
+  return XST_SUCCESS;
+}
+
+void TimerDelay(u32 uSDelay) { hostBoard_sleepUs(uSDelay); }
@@ -0,0 +1,52 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef DISPLAY_H_
+#define DISPLAY_H_
+
+// Host stand-in for the TFT display driver. Nothing is drawn; text that is
+// printed can be echoed to stdout with hostBoard_echoDisplay().
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define DISPLAY_WIDTH 320
+#define DISPLAY_HEIGHT 240
+#define DISPLAY_CHAR_WIDTH 6
+#define DISPLAY_CHAR_HEIGHT 8
+
+// 16-bit 565 colors, as on the board.
+#define DISPLAY_BLACK 0x0000
+#define DISPLAY_BLUE 0x001F
+#define DISPLAY_RED 0xF800
+#define DISPLAY_GREEN 0x07E0
+#define DISPLAY_CYAN 0x07FF
+#define DISPLAY_MAGENTA 0xF81F
+#define DISPLAY_YELLOW 0xFFE0
+#define DISPLAY_WHITE 0xFFFF
+
+void display_init();
+int16_t display_width();
+int16_t display_height();
+void display_setRotation(uint8_t rotation);
+void display_fillScreen(uint16_t color);
+void display_fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                      uint16_t color);
+void display_drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                      uint16_t color);
+void display_drawPixel(int16_t x, int16_t y, uint16_t color);
+void display_setCursor(int16_t x, int16_t y);
+void display_setTextColor(uint16_t color);
+void display_setTextSize(uint8_t size);
+void display_print(const char *str);
+void display_println(const char *str);
+void display_printChar(char c);
+void display_printDecimalInt(int32_t number);
+
+#endif /* DISPLAY_H_ */
@@ -0,0 +1,130 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef HOSTBOARD_H_
+#define HOSTBOARD_H_
+
+// Controls for the host stand-ins in this directory. A host program sets up
+// the "board" with these calls, then runs the lasertag code unchanged.
+// All times are microseconds of CLOCK_MONOTONIC, which every process on the
+// machine shares, so separate processes can agree on when things happen,
+// unless the board runs on simulated time (see hostBoard_simulate()).
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "uartModel.h"
+
+#define HOSTBOARD_MAX_HITS 256     // Hits that can be scheduled.
+#define HOSTBOARD_HIT_DURATION_US 200000 // Same as a transmitter pulse.
+#define HOSTBOARD_ADC_MIDSCALE 2048 // ADC value for 0 V.
+#define HOSTBOARD_DEFAULT_HIT_AMPLITUDE 1000 // ADC counts.
+#define HOSTBOARD_US_PER_TICK 10 // isr_function() runs at 100 kHz.
+#define HOSTBOARD_MAX_STEP_TICKS 1000 // Longest simulated step, 10 ms.
+
+// Called before each simulated step, see hostBoard_simulate().
+typedef void (*hostBoard_stepFunction_t)(void);
+
+// Current time.
+uint64_t hostBoard_microseconds();
+
+// Waits: sleeps on the wall clock, runs simulated steps on simulated time.
+void hostBoard_sleepUs(uint64_t microseconds);
+
+// Switches the board to simulated time, before interrupts_initAll(). Time
+// then only moves in steps of stepTicks ISR ticks: whenever the main loop
+// waits for something (buttons_read(), utils_msDelay()) step() is called and
+// then one step of isr_function() calls runs. The gun looks infinitely fast,
+// and a program can run many guns in lockstep as fast as the CPU allows.
+// step() is where the program exchanges the step's inputs and outputs, see
+// hostBoard_setAdcSamples() and hostBoard_getPinTrace(). step may be NULL
+// when nothing outside the gun takes part (tests, replays): time then just
+// runs ahead whenever the gun waits, including in loops that spin until the
+// ISR is done with something (idle_run()).
+bool hostBoard_simulate(uint16_t stepTicks, hostBoard_stepFunction_t step);
+
+// The simulated time in us. Returns false if the board uses the wall clock.
+bool hostBoard_getSimulatedTime(uint64_t *microseconds);
+
+// Runs one simulated step. Only call from the main loop.
+void hostBoard_yield();
+
+// Ticks per simulated step, 0 on the wall clock.
+uint16_t hostBoard_getStepTicks();
+
+// ADC samples for the next simulated step, one per tick, used in place of
+// mid-scale (noise and scheduled hits are still added). Copied.
+void hostBoard_setAdcSamples(const uint16_t samples[], uint16_t count);
+
+// MIO pins 0-15 after each tick of the last simulated step, bit n is pin n.
+// Returns the number of ticks.
+uint16_t hostBoard_getPinTrace(const uint16_t **trace);
+
+// MIO pins 0-15 now, bit n is pin n.
+uint16_t hostBoard_getPins();
+
+// Slide switches, push buttons and MIO input pins.
+void hostBoard_setSwitches(uint8_t switches);
+void hostBoard_setButtons(uint8_t buttons);
+// The buttons in mask read as pressed from timeUs on.
+void hostBoard_pressButtonsAt(uint8_t mask, uint64_t timeUs);
+void hostBoard_setPin(uint8_t pinNumber, uint8_t value);
+
+// Copies text printed on the display to stdout.
+void hostBoard_echoDisplay(bool echo);
+
+// Number of times isr_function() has run.
+uint64_t hostBoard_isrTicks();
+
+// True when called from isr_function() (or a simulated step).
+bool hostBoard_inIsr();
+
+// Adds a hit: from startUs on, for HOSTBOARD_HIT_DURATION_US, the ADC sees a
+// square wave at frequencyNumber (as if another gun's transmitter were
+// pointed at this one). Returns false if the schedule is full.
+bool hostBoard_addHit(uint64_t startUs, uint16_t frequencyNumber,
+                      uint16_t amplitude);
+
+// Peak-to-peak amplitude of the noise added to every ADC sample.
+void hostBoard_setAdcNoise(uint16_t amplitude);
+
+// The bluetooth UART. Bytes leaving its transmit FIFO are written to fd and
+// bytes read from fd go onto its receive line, once per millisecond. fd must
+// be non-blocking. Pass -1 to disconnect.
+void hostBoard_connectUart(int fd);
+uartModel_t *hostBoard_getUart();
+
+// Puts bytes on the bluetooth UART's receive line. Returns the number
+// accepted.
+uint32_t hostBoard_receiveUart(const uint8_t *data, uint32_t size);
+
+// Input journal (see inputJournal.h for the format). On simulated time every
+// value that reaches the gun from outside comes in through the calls above
+// (switches, buttons, pins, ADC samples, noise, hits, bluetooth bytes), and
+// the main loop and the ISR only take turns in hostBoard_yield(). Recording
+// those calls step by step is enough to run the whole firmware again and have
+// it do exactly the same thing.
+
+// Records the inputs to path from now on. Call it right after
+// hostBoard_simulate(), before the board is set up. Returns false on the wall
+// clock, where the ISR thread and the main loop interleave differently on
+// every run, or if the file cannot be created.
+bool hostBoard_recordInputs(const char *path);
+
+// Runs the board on simulated time from a journal, in place of
+// hostBoard_simulate() and the setup calls. After every step it checks the
+// pins, ISR ticks and bluetooth bytes against the recording. Returns false if
+// the journal cannot be read.
+bool hostBoard_replayInputs(const char *path);
+
+// Finishes recording or replaying. Returns false if the journal could not be
+// written, or if the replay did not match the recording.
+bool hostBoard_closeJournal();
+
+#endif /* HOSTBOARD_H_ */
@@ -0,0 +1,351 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+// Input journal: records every value that reaches the board from outside
+// while it runs on simulated time, and feeds a recording back in through the
+// same hostBoard_ calls. On simulated time the main loop and the ISR take
+// turns at fixed points (hostBoard_yield()), so the same inputs at the same
+// steps make the firmware do exactly the same thing again. See inputJournal.h
+// for the format.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "hostBoard.h"
+#include "inputJournal.h"
+
+#define MAGIC "LTIJ"
+#define MAGIC_SIZE 4
+#define HEADER_SIZE 8
+#define FILE_BUFFER_SIZE 65536
+#define UART_CHUNK_SIZE 256
+#define VARINT_BITS 7
+#define VARINT_MORE 0x80
+#define VARINT_MASK 0x7f
+#define VARINT_MAX_SHIFT 63
+
+typedef enum { idle_st, recording_st, replaying_st } journal_st;
+
+static journal_st state = idle_st;
+static FILE *file;
+static bool writeFailed;
+static uint64_t lastStepTick;
+
+// Replay: the whole journal is read into memory.
+static uint8_t *data;
+static size_t dataSize;
+static size_t readOffset;
+static bool badJournal;
+static uint64_t steps;
+static uint64_t divergedSteps;
+static uint64_t firstDivergedTick;
+
+static void putByte(uint8_t byte) {
+  if (putc(byte, file) == EOF)
+    writeFailed = true;
+}
+
+static void putVarint(uint64_t value) {
+  while (value > VARINT_MASK) {
+    putByte((value & VARINT_MASK) | VARINT_MORE);
+    value >>= VARINT_BITS;
+  }
+  putByte(value);
+}
+
+static void putLittle(uint64_t value, uint8_t size) {
+  for (uint8_t i = 0; i < size; i++)
+    putByte(value >> (8 * i));
+}
+
+// Reading past the end or a malformed varint marks the journal as bad and
+// returns 0, replay stops at the next step.
+static uint8_t getByte() {
+  if (readOffset >= dataSize) {
+    badJournal = true;
+    return 0;
+  }
+  return data[readOffset++];
+}
+
+static uint64_t getVarint() {
+  uint64_t value = 0;
+  for (uint8_t shift = 0; shift <= VARINT_MAX_SHIFT; shift += VARINT_BITS) {
+    uint8_t byte = getByte();
+    value |= (uint64_t)(byte & VARINT_MASK) << shift;
+    if (!(byte & VARINT_MORE))
+      return value;
+  }
+  badJournal = true;
+  return 0;
+}
+
+static uint64_t getLittle(uint8_t size) {
+  uint64_t value = 0;
+  for (uint8_t i = 0; i < size; i++)
+    value |= (uint64_t)getByte() << (8 * i);
+  return value;
+}
+
+static uint32_t zigzag(int32_t value) {
+  return value >= 0 ? (uint32_t)value << 1 : ((uint32_t)-value << 1) - 1;
+}
+
+static int32_t unzigzag(uint32_t value) {
+  return value & 1 ? -(int32_t)(value >> 1) - 1 : (int32_t)(value >> 1);
+}
+
+void inputJournal_switches(uint8_t switches) {
+  if (state != recording_st)
+    return;
+  putByte(inputJournal_switches_e);
+  putByte(switches);
+}
+
+void inputJournal_buttons(uint8_t buttons) {
+  if (state != recording_st)
+    return;
+  putByte(inputJournal_buttons_e);
+  putByte(buttons);
+}
+
+void inputJournal_pin(uint8_t pinNumber, uint8_t value) {
+  if (state != recording_st)
+    return;
+  putByte(inputJournal_pin_e);
+  putByte(pinNumber);
+  putByte(value);
+}
+
+void inputJournal_adc(const uint16_t samples[], uint16_t count) {
+  if (state != recording_st)
+    return;
+  putByte(inputJournal_adc_e);
+  putVarint(count);
+  int32_t previous = HOSTBOARD_ADC_MIDSCALE;
+  for (uint16_t i = 0; i < count; i++) {
+    putVarint(zigzag((int32_t)samples[i] - previous));
+    previous = samples[i];
+  }
+}
+
+void inputJournal_uart(const uint8_t *bytes, uint32_t size) {
+  if (state != recording_st || size == 0)
+    return;
+  putByte(inputJournal_uart_e);
+  putVarint(size);
+  if (fwrite(bytes, 1, size, file) != size)
+    writeFailed = true;
+}
+
+void inputJournal_noise(uint16_t amplitude) {
+  if (state != recording_st)
+    return;
+  putByte(inputJournal_noise_e);
+  putVarint(amplitude);
+}
+
+void inputJournal_hit(uint64_t startUs, uint16_t frequencyNumber,
+                      uint16_t amplitude) {
+  if (state != recording_st)
+    return;
+  putByte(inputJournal_hit_e);
+  putVarint(startUs);
+  putVarint(frequencyNumber);
+  putVarint(amplitude);
+}
+
+void inputJournal_press(uint8_t mask, uint64_t timeUs) {
+  if (state != recording_st)
+    return;
+  putByte(inputJournal_press_e);
+  putByte(mask);
+  putVarint(timeUs);
+}
+
+// Applies the records up to the next step record (or the end), through the
+// same calls that made them. Recording is off, so nothing is recorded again.
+static void applyRecords() {
+  static uint16_t samples[HOSTBOARD_MAX_STEP_TICKS];
+  while (!badJournal && readOffset < dataSize &&
+         data[readOffset] != inputJournal_step_e) {
+    switch (getByte()) {
+    case inputJournal_switches_e:
+      hostBoard_setSwitches(getByte());
+      break;
+    case inputJournal_buttons_e:
+      hostBoard_setButtons(getByte());
+      break;
+    case inputJournal_pin_e: {
+      uint8_t pinNumber = getByte();
+      hostBoard_setPin(pinNumber, getByte());
+      break;
+    }
+    case inputJournal_adc_e: {
+      uint64_t count = getVarint();
+      if (count > HOSTBOARD_MAX_STEP_TICKS) {
+        badJournal = true;
+        break;
+      }
+      int32_t previous = HOSTBOARD_ADC_MIDSCALE;
+      for (uint16_t i = 0; i < count; i++)
+        previous = samples[i] = previous + unzigzag(getVarint());
+      hostBoard_setAdcSamples(samples, count);
+      break;
+    }
+    case inputJournal_uart_e: {
+      uint64_t size = getVarint();
+      if (size > dataSize - readOffset) {
+        badJournal = true;
+        break;
+      }
+      hostBoard_receiveUart(data + readOffset, size);
+      readOffset += size;
+      break;
+    }
+    case inputJournal_noise_e:
+      hostBoard_setAdcNoise(getVarint());
+      break;
+    case inputJournal_hit_e: {
+      uint64_t startUs = getVarint();
+      uint16_t frequencyNumber = getVarint();
+      hostBoard_addHit(startUs, frequencyNumber, getVarint());
+      break;
+    }
+    case inputJournal_press_e: {
+      uint8_t mask = getByte();
+      hostBoard_pressButtonsAt(mask, getVarint());
+      break;
+    }
+    default:
+      badJournal = true;
+      break;
+    }
+  }
+}
+
+void inputJournal_step(uint64_t tick, uint32_t digest) {
+  if (state == recording_st) {
+    putByte(inputJournal_step_e);
+    putVarint(tick - lastStepTick);
+    putLittle(digest, sizeof(uint32_t));
+    lastStepTick = tick;
+    return;
+  }
+  if (state != replaying_st)
+    return;
+  if (badJournal || getByte() != inputJournal_step_e) {
+    // The firmware wants to go on, but the recording stopped here.
+    printf("journal: %s at tick %lu, %lu steps replayed.\n",
+           badJournal ? "bad record" : "no more steps", (unsigned long)tick,
+           (unsigned long)steps);
+    exit(1);
+  }
+  uint64_t recordedTick = lastStepTick + getVarint();
+  uint32_t recordedDigest = getLittle(sizeof(uint32_t));
+  lastStepTick = recordedTick;
+  if (recordedTick != tick || recordedDigest != digest) {
+    if (divergedSteps++ == 0) {
+      firstDivergedTick = tick;
+      printf("journal: the replay diverged at tick %lu (recorded tick %lu).\n",
+             (unsigned long)tick, (unsigned long)recordedTick);
+    }
+  }
+  steps++;
+  applyRecords();
+}
+
+// Bytes the firmware sent on the bluetooth UART go nowhere on replay.
+static void replayStep() {
+  uint8_t sent[UART_CHUNK_SIZE];
+  while (uartModel_takeSent(hostBoard_getUart(), sent, sizeof(sent)))
+    ;
+}
+
+bool hostBoard_recordInputs(const char *path) {
+  uint64_t simulatedUs;
+  if (state != idle_st || !hostBoard_getSimulatedTime(&simulatedUs)) {
+    printf("journal: recording needs simulated time.\n");
+    return false;
+  }
+  file = fopen(path, "wb");
+  if (!file) {
+    printf("journal: unable to open %s.\n", path);
+    return false;
+  }
+  setvbuf(file, NULL, _IOFBF, FILE_BUFFER_SIZE);
+  fwrite(MAGIC, 1, MAGIC_SIZE, file);
+  putLittle(INPUTJOURNAL_VERSION, sizeof(uint16_t));
+  putLittle(hostBoard_getStepTicks(), sizeof(uint16_t));
+  writeFailed = false;
+  lastStepTick = 0;
+  state = recording_st;
+  return true;
+}
+
+bool hostBoard_replayInputs(const char *path) {
+  if (state != idle_st)
+    return false;
+  FILE *in = fopen(path, "rb");
+  if (!in) {
+    printf("journal: unable to open %s.\n", path);
+    return false;
+  }
+  fseek(in, 0, SEEK_END);
+  long size = ftell(in);
+  fseek(in, 0, SEEK_SET);
+  data = size > HEADER_SIZE ? malloc(size) : NULL;
+  bool ok = data && fread(data, 1, size, in) == (size_t)size;
+  fclose(in);
+  if (!ok || memcmp(data, MAGIC, MAGIC_SIZE) ||
+      (data[4] | data[5] << 8) != INPUTJOURNAL_VERSION) {
+    printf("journal: %s is not a version %d journal.\n", path,
+           INPUTJOURNAL_VERSION);
+    free(data);
+    data = NULL;
+    return false;
+  }
+  dataSize = size;
+  readOffset = HEADER_SIZE;
+  uint16_t stepTicks = data[6] | data[7] << 8;
+  if (!hostBoard_simulate(stepTicks, replayStep)) {
+    printf("journal: unable to start simulated time with %u-tick steps.\n",
+           stepTicks);
+    return false;
+  }
+  badJournal = false;
+  steps = divergedSteps = 0;
+  lastStepTick = 0;
+  state = replaying_st;
+  applyRecords(); // How the board was set up.
+  return true;
+}
+
+bool hostBoard_closeJournal() {
+  bool ok = true;
+  if (state == recording_st) {
+    ok = fclose(file) == 0 && !writeFailed;
+    if (!ok)
+      printf("journal: unable to write the journal.\n");
+  } else if (state == replaying_st) {
+    ok = divergedSteps == 0 && !badJournal;
+    if (divergedSteps)
+      printf("journal: %lu of %lu steps diverged, the first at tick %lu.\n",
+             (unsigned long)divergedSteps, (unsigned long)steps,
+             (unsigned long)firstDivergedTick);
+    else
+      printf("journal: %lu steps replayed, all identical.\n",
+             (unsigned long)steps);
+    free(data);
+    data = NULL;
+  }
+  state = idle_st;
+  return ok;
+}
@@ -0,0 +1,69 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef INPUTJOURNAL_H_
+#define INPUTJOURNAL_H_
+
+// Hooks for the stand-ins in this directory. The hostBoard_ calls that feed
+// the board from outside report their values here, and hostBoard_yield()
+// reports each simulated step. Host programs use hostBoard_recordInputs()
+// and hostBoard_replayInputs() in hostBoard.h instead.
+//
+// Journal format, all values little-endian, varints are LEB128:
+//   char[4] "LTIJ", uint16 version (INPUTJOURNAL_VERSION), uint16 ticks per
+//   simulated step
+// then records, each a type byte (inputJournal_record_t) and its fields:
+//   step      varint ticks since the last step, uint32 digest of what the
+//             board put out during the last step (see hostBoard_yield())
+//   switches  uint8
+//   buttons   uint8
+//   pin       uint8 pin number, uint8 value
+//   adc       varint count, then count varints: the zigzag difference of each
+//             sample from the one before (the first from mid-scale)
+//   uart      varint count, then count bytes
+//   noise     varint amplitude
+//   hit       varint start (us), varint frequency number, varint amplitude
+//   press     uint8 mask, varint time (us)
+// Records before the first step were made while setting up the board, the
+// others during the step function of the step before them.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define INPUTJOURNAL_VERSION 1
+
+typedef enum {
+  inputJournal_step_e = 1,
+  inputJournal_switches_e = 2,
+  inputJournal_buttons_e = 3,
+  inputJournal_pin_e = 4,
+  inputJournal_adc_e = 5,
+  inputJournal_uart_e = 6,
+  inputJournal_noise_e = 7,
+  inputJournal_hit_e = 8,
+  inputJournal_press_e = 9,
+} inputJournal_record_t;
+
+// Each records its input while a journal is being recorded.
+void inputJournal_switches(uint8_t switches);
+void inputJournal_buttons(uint8_t buttons);
+void inputJournal_pin(uint8_t pinNumber, uint8_t value);
+void inputJournal_adc(const uint16_t samples[], uint16_t count);
+void inputJournal_uart(const uint8_t *data, uint32_t size);
+void inputJournal_noise(uint16_t amplitude);
+void inputJournal_hit(uint64_t startUs, uint16_t frequencyNumber,
+                      uint16_t amplitude);
+void inputJournal_press(uint8_t mask, uint64_t timeUs);
+
+// Called by hostBoard_yield() before the step function, with the tick the
+// step starts at and the digest of the last step's outputs. Records a step
+// record, or on replay checks it and applies the inputs of the step.
+void inputJournal_step(uint64_t tick, uint32_t digest);
+
+#endif /* INPUTJOURNAL_H_ */
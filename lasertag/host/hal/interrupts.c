@@ -0,0 +1,347 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+// Host stand-in for the lasertag interrupt driver.
+//
+// A thread plays the 100 kHz timer interrupt. Once per millisecond it runs
+// isr_function() as many times as the wall clock says it should have run
+// since the timer was started, then moves the bluetooth UART's bytes to and
+// from its file descriptor. "ARM interrupts disabled" is a mutex that the
+// ISR thread also takes for each batch, so code that disables interrupts on
+// the board is protected the same way here. It is a blocking mutex rather
+// than a spin lock so that several guns can share one CPU.
+//
+// On simulated time (hostBoard_simulate()) there is no wall clock and no
+// thread: hostBoard_yield() runs a step of ticks right in the main loop, as
+// if the interrupts had come in while it was waiting. The main loop waits in
+// buttons_read(), the delays in clock.c and idle_run().
+//
+// interrupts_getAdcData() returns mid-scale plus noise, plus a square wave
+// while a scheduled hit is in progress.
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "filter.h"
+#include "hostBoard.h"
+#include "idle.h"
+#include "inputJournal.h"
+#include "interrupts.h"
+#include "isr.h"
+#include "uartModel.h"
+#include "xparameters.h"
+
+#define US_PER_TICK HOSTBOARD_US_PER_TICK
+#define US_PER_BATCH 1000     // The ISR thread wakes up every ms.
+#define MAX_BATCH_TICKS 10000 // Ticks dropped beyond 100 ms of catch-up.
+#define NS_PER_US 1000
+#define US_PER_SECOND 1000000
+#define UART_CHUNK_SIZE 256
+#define HALF_PERIOD_DIVISOR 2
+#define FNV_OFFSET_BASIS 2166136261u
+#define FNV_PRIME 16777619u
+
+typedef struct {
+  uint64_t startUs;
+  uint16_t frequencyNumber;
+  uint16_t amplitude;
+} hit_t;
+
+// "ARM interrupts disabled" holds it.
+static pthread_mutex_t interruptsMutex = PTHREAD_MUTEX_INITIALIZER;
+static __thread bool inIsrThread; // Also set during hostBoard_yield().
+
+static volatile bool timerGlobalEnabled;
+static volatile bool timerRunning;
+static bool armDisabled;
+static pthread_t isrThread;
+
+static volatile uint64_t isrTicks;   // isr_function() calls.
+static uint64_t timerStartUs;        // Wall time of tick 0.
+static uint64_t droppedTicks;        // Ticks skipped when far behind.
+
+static hit_t hits[HOSTBOARD_MAX_HITS]; // Sorted by start time.
+static uint16_t hitCount;
+static uint16_t nextHit;             // First hit that has not ended.
+static uint16_t noiseAmplitude;
+static uint32_t noiseSeed = 1;
+
+static uartModel_t uart;
+static int uartFd = -1;
+static uint64_t uartUs; // Wall time the UART model has been advanced to.
+static bool initialized;
+
+// Simulated time.
+static bool simulated;
+static uint64_t simulatedUs;
+static uint16_t stepTicks;
+static uint16_t stepTick; // Tick within the current step.
+static hostBoard_stepFunction_t stepFunction;
+static uint16_t adcSamples[HOSTBOARD_MAX_STEP_TICKS];
+static uint16_t adcSampleCount;
+static uint16_t pinTrace[HOSTBOARD_MAX_STEP_TICKS];
+static uint16_t pinTraceCount;
+
+static void lock() { pthread_mutex_lock(&interruptsMutex); }
+
+static void unlock() { pthread_mutex_unlock(&interruptsMutex); }
+
+// True when called from isr_function().
+bool hostBoard_inIsr() { return inIsrThread; }
+
+// Number of times isr_function() has run.
+uint64_t hostBoard_isrTicks() { return isrTicks; }
+
+// Adds a hit, keeping the schedule sorted by start time.
+bool hostBoard_addHit(uint64_t startUs, uint16_t frequencyNumber,
+                      uint16_t amplitude) {
+  if (hitCount == HOSTBOARD_MAX_HITS ||
+      frequencyNumber >= FILTER_FREQUENCY_COUNT)
+    return false;
+  inputJournal_hit(startUs, frequencyNumber, amplitude);
+  uint16_t i = hitCount++;
+  for (; i > 0 && hits[i - 1].startUs > startUs; i--)
+    hits[i] = hits[i - 1];
+  hits[i] = (hit_t){startUs, frequencyNumber, amplitude};
+  return true;
+}
+
+void hostBoard_setAdcNoise(uint16_t amplitude) {
+  inputJournal_noise(amplitude);
+  noiseAmplitude = amplitude;
+}
+
+void hostBoard_connectUart(int fd) { uartFd = fd; }
+
+uartModel_t *hostBoard_getUart() { return &uart; }
+
+uint32_t hostBoard_receiveUart(const uint8_t *data, uint32_t size) {
+  inputJournal_uart(data, size);
+  return uartModel_putReceived(&uart, data, size);
+}
+
+bool hostBoard_getSimulatedTime(uint64_t *microseconds) {
+  if (!simulated)
+    return false;
+  *microseconds = simulatedUs;
+  return true;
+}
+
+uint16_t hostBoard_getStepTicks() { return stepTicks; }
+
+void hostBoard_setAdcSamples(const uint16_t samples[], uint16_t count) {
+  adcSampleCount = count < stepTicks ? count : stepTicks;
+  inputJournal_adc(samples, adcSampleCount);
+  for (uint16_t i = 0; i < adcSampleCount; i++)
+    adcSamples[i] = samples[i];
+}
+
+uint16_t hostBoard_getPinTrace(const uint16_t **trace) {
+  *trace = pinTrace;
+  return pinTraceCount;
+}
+
+// Called from isr_function() once per tick.
+uint32_t interrupts_getAdcData() {
+  uint64_t nowUs =
+      simulated ? simulatedUs : timerStartUs + isrTicks * US_PER_TICK;
+  int32_t value = HOSTBOARD_ADC_MIDSCALE;
+  if (simulated && stepTick < adcSampleCount)
+    value = adcSamples[stepTick];
+  if (noiseAmplitude) {
+    noiseSeed = noiseSeed * 1103515245 + 12345;
+    value += (int32_t)((noiseSeed >> 16) % (noiseAmplitude + 1)) -
+             noiseAmplitude / 2;
+  }
+  while (nextHit < hitCount &&
+         nowUs >= hits[nextHit].startUs + HOSTBOARD_HIT_DURATION_US)
+    nextHit++;
+  if (nextHit < hitCount && nowUs >= hits[nextHit].startUs) {
+    // Same waveform as transmitter.c: high for half the period, then low.
+    const hit_t *hit = &hits[nextHit];
+    uint64_t tick = (nowUs - hit->startUs) / US_PER_TICK;
+    uint16_t period = filter_frequencyTickTable[hit->frequencyNumber];
+    value += (tick % period) < period / HALF_PERIOD_DIVISOR ? hit->amplitude
+                                                             : -hit->amplitude;
+  }
+  return value < 0 ? 0 : value;
+}
+
+// Moves the bluetooth UART's bytes to and from uartFd.
+static void serviceUart(uint64_t nowUs) {
+  uartModel_advance(&uart, nowUs - uartUs);
+  uartUs = nowUs;
+  if (uartFd < 0)
+    return;
+  uint8_t data[UART_CHUNK_SIZE];
+  uint32_t count;
+  while ((count = uartModel_takeSent(&uart, data, sizeof(data)))) {
+    if (write(uartFd, data, count) < 0 && errno != EAGAIN) {
+      printf("interrupts: bluetooth link closed.\n");
+      uartFd = -1;
+      return;
+    }
+  }
+  ssize_t received;
+  while ((received = read(uartFd, data, sizeof(data))) > 0)
+    hostBoard_receiveUart(data, received);
+  if (received == 0) {
+    printf("interrupts: bluetooth link closed.\n");
+    uartFd = -1;
+  }
+}
+
+static void *isrThreadFunction(void *argument) {
+  (void)argument;
+  inIsrThread = true;
+  struct timespec wake;
+  clock_gettime(CLOCK_MONOTONIC, &wake);
+  while (true) {
+    wake.tv_nsec += US_PER_BATCH * NS_PER_US;
+    if (wake.tv_nsec >= US_PER_SECOND * NS_PER_US) {
+      wake.tv_nsec -= US_PER_SECOND * NS_PER_US;
+      wake.tv_sec++;
+    }
+    clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &wake, NULL);
+    lock();
+    uint64_t nowUs = hostBoard_microseconds();
+    if (timerGlobalEnabled && timerRunning) {
+      uint64_t targetTicks = (nowUs - timerStartUs) / US_PER_TICK;
+      if (targetTicks - isrTicks > MAX_BATCH_TICKS) {
+        // Too far behind (the process was stopped?): skip ahead.
+        uint64_t skipped = targetTicks - isrTicks - MAX_BATCH_TICKS;
+        droppedTicks += skipped;
+        timerStartUs += skipped * US_PER_TICK;
+        targetTicks = isrTicks + MAX_BATCH_TICKS;
+      }
+      while (isrTicks < targetTicks) {
+        isr_function();
+        isrTicks++;
+      }
+    }
+    serviceUart(nowUs);
+    unlock();
+  }
+  return NULL;
+}
+
+// Runs one simulated step. Ticks only happen while the timer would be
+// interrupting, but simulated time moves on regardless.
+static void runStep() {
+  for (stepTick = 0; stepTick < stepTicks; stepTick++) {
+    if (timerGlobalEnabled && timerRunning && !armDisabled) {
+      isr_function();
+      isrTicks++;
+    }
+    pinTrace[stepTick] = hostBoard_getPins();
+    simulatedUs += US_PER_TICK;
+  }
+  pinTraceCount = stepTicks;
+  adcSampleCount = 0;
+  serviceUart(simulatedUs);
+}
+
+// What the board put out during the last step: the pins after every tick,
+// the ISR ticks and the bytes sent on the bluetooth UART. Two runs that
+// agree on it step after step did the same thing.
+static uint32_t stepDigest() {
+  uint32_t digest = FNV_OFFSET_BASIS;
+  for (uint16_t i = 0; i < pinTraceCount; i++) {
+    digest = (digest ^ (pinTrace[i] & 0xff)) * FNV_PRIME;
+    digest = (digest ^ (pinTrace[i] >> 8)) * FNV_PRIME;
+  }
+  digest = (digest ^ (uint32_t)isrTicks) * FNV_PRIME;
+  return (digest ^ uart.bytesSent) * FNV_PRIME;
+}
+
+// Runs a step, as the ISR would have while the main loop was waiting.
+void hostBoard_yield() {
+  if (!simulated)
+    return;
+  inIsrThread = true;
+  inputJournal_step(simulatedUs / US_PER_TICK, stepDigest());
+  if (stepFunction)
+    stepFunction();
+  runStep();
+  inIsrThread = false;
+}
+
+// A loop waiting for the ISR, the ISR only runs when time moves on.
+static void idleStep() {
+  if (!inIsrThread)
+    hostBoard_yield();
+}
+
+bool hostBoard_simulate(uint16_t ticks, hostBoard_stepFunction_t step) {
+  if (initialized || ticks == 0 || ticks > HOSTBOARD_MAX_STEP_TICKS)
+    return false;
+  simulated = true;
+  simulatedUs = 0;
+  uartModel_init(&uart, UARTMODEL_DEFAULT_BAUD);
+  uartModel_attach(&uart, XPAR_BLUETOOTH_UARTLITE_0_BASEADDR);
+  uartUs = 0;
+  stepTicks = ticks;
+  stepFunction = step;
+  idle_setFunction(idleStep);
+  return true;
+}
+
+// Starts the ISR thread with the ARM interrupts disabled.
+int32_t interrupts_initAll(bool printFailedStatusFlag) {
+  if (initialized)
+    return 1;
+  if (!simulated) { // hostBoard_simulate() has set up the UART.
+    uartModel_init(&uart, UARTMODEL_DEFAULT_BAUD);
+    uartModel_attach(&uart, XPAR_BLUETOOTH_UARTLITE_0_BASEADDR);
+    uartUs = hostBoard_microseconds();
+  }
+  interrupts_disableArmInts();
+  if (!simulated &&
+      pthread_create(&isrThread, NULL, isrThreadFunction, NULL)) {
+    if (printFailedStatusFlag)
+      printf("interrupts_initAll(): unable to start the ISR thread.\n");
+    return 0;
+  }
+  initialized = true;
+  return 1;
+}
+
+void interrupts_enableTimerGlobalInts() { timerGlobalEnabled = true; }
+
+void interrupts_disableTimerGlobalInts() { timerGlobalEnabled = false; }
+
+// Tick 0 is now.
+void interrupts_startArmPrivateTimer() {
+  timerStartUs = hostBoard_microseconds() - isrTicks * US_PER_TICK;
+  timerRunning = true;
+}
+
+void interrupts_stopArmPrivateTimer() { timerRunning = false; }
+
+void interrupts_enableArmInts() {
+  if (!armDisabled)
+    return;
+  armDisabled = false;
+  unlock();
+}
+
+void interrupts_disableArmInts() {
+  if (armDisabled)
+    return;
+  lock();
+  armDisabled = true;
+}
+
+uint32_t interrupts_isrInvocationCount() { return isrTicks; }
+
+uint32_t interrupts_getAdcInputMode() { return INTERRUPTS_ADC_UNIPOLAR_MODE; }
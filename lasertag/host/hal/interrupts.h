@@ -0,0 +1,35 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef INTERRUPTS_H_
+#define INTERRUPTS_H_
+
+// Host stand-in for the lasertag interrupt driver. A thread plays the role of
+// the 100 kHz timer interrupt and calls isr_function(), catching up with the
+// wall clock once per millisecond. Disabling the ARM interrupts keeps that
+// thread out, like on the board. See interrupts.c.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define INTERRUPTS_ADC_UNIPOLAR_MODE 0
+#define INTERRUPTS_ADC_BIPOLAR_MODE 1
+
+int32_t interrupts_initAll(bool printFailedStatusFlag);
+void interrupts_enableTimerGlobalInts();
+void interrupts_disableTimerGlobalInts();
+void interrupts_startArmPrivateTimer();
+void interrupts_stopArmPrivateTimer();
+void interrupts_enableArmInts();
+void interrupts_disableArmInts();
+uint32_t interrupts_getAdcData();
+uint32_t interrupts_isrInvocationCount();
+uint32_t interrupts_getAdcInputMode();
+
+#endif /* INTERRUPTS_H_ */
@@ -0,0 +1,32 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef INTERVALTIMER_H_
+#define INTERVALTIMER_H_
+
+// Host stand-in for the interval timers, measured with CLOCK_MONOTONIC.
+
+#include <stdint.h>
+
+#define INTERVAL_TIMER_TIMER_0 0
+#define INTERVAL_TIMER_TIMER_1 1
+#define INTERVAL_TIMER_TIMER_2 2
+
+#define INTERVAL_TIMER_STATUS_OK 1
+#define INTERVAL_TIMER_STATUS_FAIL 0
+
+uint32_t intervalTimer_init(uint32_t timerNumber);
+uint32_t intervalTimer_initAll();
+uint32_t intervalTimer_start(uint32_t timerNumber);
+uint32_t intervalTimer_stop(uint32_t timerNumber);
+uint32_t intervalTimer_reset(uint32_t timerNumber);
+uint32_t intervalTimer_resetAll();
+double intervalTimer_getTotalDurationInSeconds(uint32_t timerNumber);
+
+#endif /* INTERVALTIMER_H_ */
@@ -0,0 +1,21 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef LEDS_H_
+#define LEDS_H_
+
+// Host stand-in for the ZYBO LED driver. Writes are remembered, not shown.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+int32_t leds_init(bool printFailedStatusFlag);
+void leds_write(uint8_t ledValue);
+
+#endif /* LEDS_H_ */
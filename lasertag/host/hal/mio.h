@@ -0,0 +1,29 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef MIO_H_
+#define MIO_H_
+
+// Host stand-in for the MIO pin driver (gun trigger, transmitter and hit LED
+// pins). Output writes are remembered; inputs read as 0 unless set with
+// hostBoard_setPin() (see hostBoard.h).
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define MIO_INPUT 1
+#define MIO_OUTPUT 0
+
+int32_t mio_init(bool printFailedStatusFlag);
+void mio_setPinAsInput(uint8_t pinNumber);
+void mio_setPinAsOutput(uint8_t pinNumber);
+void mio_writePin(uint8_t pinNumber, uint8_t value);
+uint8_t mio_readPin(uint8_t pinNumber);
+
+#endif /* MIO_H_ */
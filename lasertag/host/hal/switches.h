@@ -0,0 +1,24 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef SWITCHES_H_
+#define SWITCHES_H_
+
+// Host stand-in for the ZYBO slide-switch driver. The switches are set with
+// hostBoard_setSwitches() (see hostBoard.h).
+
+#include <stdint.h>
+
+#define SWITCHES_INIT_STATUS_OK 1
+#define SWITCHES_INIT_STATUS_FAIL 0
+
+int32_t switches_init();
+uint8_t switches_read();
+
+#endif /* SWITCHES_H_ */
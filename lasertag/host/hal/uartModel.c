@@ -0,0 +1,169 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "Xuartlite.h"
+#include "uartModel.h"
+
+#define US_PER_SECOND 1000000
+#define BYTE_COST ((uint64_t)UARTMODEL_BITS_PER_BYTE * US_PER_SECOND)
+#define MAX_ATTACHMENTS 8
+
+// Which model backs which base address.
+static struct {
+  uint32_t baseAddress;
+  uartModel_t *model;
+} attachments[MAX_ATTACHMENTS];
+static uint32_t attachmentCount;
+
+static void ringInit(uartModel_ring_t *ring, uint8_t *data, uint32_t size) {
+  ring->indexIn = 0;
+  ring->indexOut = 0;
+  ring->size = size;
+  ring->data = data;
+}
+
+static uint32_t ringCount(const uartModel_ring_t *ring) {
+  return ring->indexIn - ring->indexOut;
+}
+
+static bool ringPush(uartModel_ring_t *ring, uint8_t byte) {
+  if (ringCount(ring) == ring->size)
+    return false;
+  ring->data[ring->indexIn++ & (ring->size - 1)] = byte;
+  return true;
+}
+
+static uint8_t ringPop(uartModel_ring_t *ring) {
+  return ring->data[ring->indexOut++ & (ring->size - 1)];
+}
+
+// Resets the model (empty FIFOs and lines, zero statistics).
+void uartModel_init(uartModel_t *model, uint32_t baudRate) {
+  memset(model, 0, sizeof(*model));
+  model->baudRate = baudRate;
+  uint8_t *storage = model->storage;
+  ringInit(&model->transmitFifo, storage, UARTMODEL_FIFO_SIZE);
+  storage += UARTMODEL_FIFO_SIZE;
+  ringInit(&model->receiveFifo, storage, UARTMODEL_FIFO_SIZE);
+  storage += UARTMODEL_FIFO_SIZE;
+  ringInit(&model->transmitLine, storage, UARTMODEL_LINE_SIZE);
+  storage += UARTMODEL_LINE_SIZE;
+  ringInit(&model->receiveLine, storage, UARTMODEL_LINE_SIZE);
+}
+
+// Makes XUartLite_CfgInitialize() at baseAddress use model.
+bool uartModel_attach(uartModel_t *model, uint32_t baseAddress) {
+  for (uint32_t i = 0; i < attachmentCount; i++) {
+    if (attachments[i].baseAddress == baseAddress) {
+      attachments[i].model = model; // Re-attach.
+      return true;
+    }
+  }
+  if (attachmentCount == MAX_ATTACHMENTS) {
+    printf("uartModel_attach(): too many attachments.\n");
+    return false;
+  }
+  attachments[attachmentCount].baseAddress = baseAddress;
+  attachments[attachmentCount].model = model;
+  attachmentCount++;
+  return true;
+}
+
+// Lets microseconds of line time pass. An idle line does not bank time, so a
+// byte queued later still takes a full byte time.
+void uartModel_advance(uartModel_t *model, uint32_t microseconds) {
+  uint64_t elapsed = (uint64_t)microseconds * model->baudRate;
+  model->transmitCredit += elapsed;
+  while (model->transmitCredit >= BYTE_COST &&
+         ringCount(&model->transmitFifo)) {
+    model->transmitCredit -= BYTE_COST;
+    if (!ringPush(&model->transmitLine, ringPop(&model->transmitFifo)))
+      model->lineDrops++;
+    model->bytesSent++;
+  }
+  if (!ringCount(&model->transmitFifo))
+    model->transmitCredit = 0;
+  model->receiveCredit += elapsed;
+  while (model->receiveCredit >= BYTE_COST &&
+         ringCount(&model->receiveLine)) {
+    model->receiveCredit -= BYTE_COST;
+    if (ringPush(&model->receiveFifo, ringPop(&model->receiveLine)))
+      model->bytesReceived++;
+    else
+      model->overruns++;
+  }
+  if (!ringCount(&model->receiveLine))
+    model->receiveCredit = 0;
+}
+
+// Puts bytes on the receive line.
+uint32_t uartModel_putReceived(uartModel_t *model, const uint8_t *data,
+                               uint32_t size) {
+  uint32_t i;
+  for (i = 0; i < size; i++) {
+    if (!ringPush(&model->receiveLine, data[i])) {
+      model->lineDrops += size - i;
+      break;
+    }
+  }
+  return i;
+}
+
+// Takes up to maxSize bytes that were sent on the transmit line.
+uint32_t uartModel_takeSent(uartModel_t *model, uint8_t *data,
+                            uint32_t maxSize) {
+  uint32_t i;
+  for (i = 0; i < maxSize && ringCount(&model->transmitLine); i++)
+    data[i] = ringPop(&model->transmitLine);
+  return i;
+}
+
+// Bytes in the transmit FIFO, not yet on the line.
+uint32_t uartModel_transmitFifoCount(uartModel_t *model) {
+  return ringCount(&model->transmitFifo);
+}
+
+// XUartLite stand-in.
+
+int XUartLite_CfgInitialize(XUartLite *instancePtr, XUartLite_Config *config,
+                            uint32_t effectiveAddr) {
+  for (uint32_t i = 0; i < attachmentCount; i++) {
+    if (attachments[i].baseAddress == effectiveAddr) {
+      config->RegBaseAddress = effectiveAddr;
+      instancePtr->RegBaseAddress = effectiveAddr;
+      instancePtr->Model = attachments[i].model;
+      return XST_SUCCESS;
+    }
+  }
+  return XST_FAILURE;
+}
+
+unsigned XUartLite_Send(XUartLite *instancePtr, uint8_t *dataBufferPtr,
+                        unsigned numBytes) {
+  uartModel_t *model = instancePtr->Model;
+  model->sendCalls++;
+  unsigned i;
+  for (i = 0; i < numBytes; i++)
+    if (!ringPush(&model->transmitFifo, dataBufferPtr[i]))
+      break;
+  return i;
+}
+
+unsigned XUartLite_Recv(XUartLite *instancePtr, uint8_t *dataBufferPtr,
+                        unsigned numBytes) {
+  uartModel_t *model = instancePtr->Model;
+  model->recvCalls++;
+  unsigned i;
+  for (i = 0; i < numBytes && ringCount(&model->receiveFifo); i++)
+    dataBufferPtr[i] = ringPop(&model->receiveFifo);
+  return i;
+}
@@ -0,0 +1,76 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef UARTMODEL_H_
+#define UARTMODEL_H_
+
+// Model of a UART Lite and the serial line behind it, for running the
+// bluetooth driver on a PC. Time only moves when uartModel_advance() is
+// called: the transmit FIFO then drains onto the line and bytes waiting on
+// the line shift into the receive FIFO, one byte per 10 bit times each way.
+// A byte that arrives while the receive FIFO is full is lost (overrun), like
+// on the board.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define UARTMODEL_FIFO_SIZE 16         // UART Lite FIFO depth.
+#define UARTMODEL_DEFAULT_BAUD 9600    // The bluetooth modem's rate.
+#define UARTMODEL_BITS_PER_BYTE 10     // Start, 8 data, stop.
+#define UARTMODEL_LINE_SIZE 4096       // Bytes buffered on each line.
+
+// A byte ring, used for the FIFOs and the lines.
+typedef struct {
+  uint32_t indexIn;
+  uint32_t indexOut;
+  uint32_t size; // Power of two.
+  uint8_t *data;
+} uartModel_ring_t;
+
+typedef struct {
+  uint32_t baudRate;
+  uint64_t transmitCredit; // Elapsed time not yet used, us * baud.
+  uint64_t receiveCredit;
+  uartModel_ring_t transmitFifo;
+  uartModel_ring_t receiveFifo;
+  uartModel_ring_t transmitLine; // Sent bytes, read with uartModel_takeSent().
+  uartModel_ring_t receiveLine;  // Bytes on their way to the receive FIFO.
+  uint8_t storage[2 * UARTMODEL_FIFO_SIZE + 2 * UARTMODEL_LINE_SIZE];
+  // Statistics.
+  uint32_t sendCalls;     // XUartLite_Send() calls.
+  uint32_t recvCalls;     // XUartLite_Recv() calls.
+  uint32_t bytesSent;     // Bytes that left the transmit FIFO.
+  uint32_t bytesReceived; // Bytes that made it into the receive FIFO.
+  uint32_t overruns;      // Bytes lost because the receive FIFO was full.
+  uint32_t lineDrops;     // Bytes lost because a line buffer was full.
+} uartModel_t;
+
+// Resets the model (empty FIFOs and lines, zero statistics).
+void uartModel_init(uartModel_t *model, uint32_t baudRate);
+
+// Makes XUartLite_CfgInitialize() at baseAddress use model.
+// Returns false if there is no room for another attachment.
+bool uartModel_attach(uartModel_t *model, uint32_t baseAddress);
+
+// Lets microseconds of line time pass.
+void uartModel_advance(uartModel_t *model, uint32_t microseconds);
+
+// Puts bytes on the receive line (they reach the FIFO at the baud rate).
+// Returns the number accepted.
+uint32_t uartModel_putReceived(uartModel_t *model, const uint8_t *data,
+                               uint32_t size);
+
+// Takes up to maxSize bytes that were sent on the transmit line.
+uint32_t uartModel_takeSent(uartModel_t *model, uint8_t *data,
+                            uint32_t maxSize);
+
+// Bytes in the transmit FIFO, not yet on the line.
+uint32_t uartModel_transmitFifoCount(uartModel_t *model);
+
+#endif /* UARTMODEL_H_ */
@@ -0,0 +1,20 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef UTILS_H_
+#define UTILS_H_
+
+// Host stand-in for the 330 utilities.
+
+#include <stdint.h>
+
+// Sleeps the calling thread; the ISR keeps running.
+void utils_msDelay(uint32_t milliseconds);
+
+#endif /* UTILS_H_ */
@@ -0,0 +1,39 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef XIICPS_H_
+#define XIICPS_H_
+
+// Host stand-in for the Xilinx PS I2C driver. sound.c uses it to set up the
+// audio codec; every call succeeds and nothing is sent anywhere.
+
+#include "xil_io.h" // The real header pulls it in through xiicps_hw.h.
+#include "xil_types.h"
+#include "xstatus.h"
+
+typedef struct {
+  u16 DeviceId;
+  u32 BaseAddress;
+  u32 InputClockHz;
+} XIicPs_Config;
+
+typedef struct {
+  XIicPs_Config Config;
+} XIicPs;
+
+XIicPs_Config *XIicPs_LookupConfig(u16 deviceId);
+s32 XIicPs_CfgInitialize(XIicPs *instancePtr, XIicPs_Config *configPtr,
+                         u32 effectiveAddr);
+s32 XIicPs_SelfTest(XIicPs *instancePtr);
+s32 XIicPs_SetSClk(XIicPs *instancePtr, u32 fsclHz);
+s32 XIicPs_MasterSendPolled(XIicPs *instancePtr, u8 *msgPtr, s32 byteCount,
+                            u16 slaveAddr);
+s32 XIicPs_BusIsBusy(XIicPs *instancePtr);
+
+#endif /* XIICPS_H_ */
@@ -0,0 +1,21 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef XIL_IO_H_
+#define XIL_IO_H_
+
+// Host stand-in for the Xilinx register access calls. The only registers
+// modeled are the I2S controller's, see audio.c.
+
+#include "xil_types.h"
+
+u32 Xil_In32(u32 address);
+void Xil_Out32(u32 address, u32 value);
+
+#endif /* XIL_IO_H_ */
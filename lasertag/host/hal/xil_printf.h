@@ -0,0 +1,21 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef XIL_PRINTF_H_
+#define XIL_PRINTF_H_
+
+// Host stand-in, both go to stdout.
+
+#include <stdio.h>
+
+#define xil_printf printf
+
+void outbyte(char c);
+
+#endif /* XIL_PRINTF_H_ */
@@ -0,0 +1,23 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef XPARAMETERS_H_
+#define XPARAMETERS_H_
+
+// Host stand-in for the board's generated xparameters.h. Only the addresses
+// used by the code built in lasertag/host are defined.
+
+#define XPAR_BLUETOOTH_UARTLITE_0_BASEADDR 0x42C00000
+#define XPAR_AXI_I2S_ADI_0_BASEADDR 0x43C00000
+#define XPAR_AXI_I2S_ADI_1_S_AXI_BASEADDR 0x43C00000
+#define XPAR_XIICPS_0_DEVICE_ID 0
+#define XPAR_SCUTIMER_DEVICE_ID 0
+#define XPAR_CPU_CORTEXA9_0_CPU_CLK_FREQ_HZ 650000000
+
+#endif /* XPARAMETERS_H_ */
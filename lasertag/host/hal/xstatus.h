@@ -0,0 +1,18 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef XSTATUS_H_
+#define XSTATUS_H_
+
+// Host stand-in for the Xilinx status codes.
+
+#define XST_SUCCESS 0L
+#define XST_FAILURE 1L
+
+#endif /* XSTATUS_H_ */
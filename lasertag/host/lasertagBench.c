@@ -0,0 +1,226 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+// Runs the detector benchmark (support/detectorBench.h) on the PC and
+// compares it to a baseline saved by an earlier run:
+//
+//   lasertagBench [-repeats N] [-mhz X] [-baseline FILE] [-tolerance T]
+//                 [-save FILE] [-fft]
+//
+// -baseline compares every stage to the baseline and fails (exit status 1)
+// if one is slower by more than the tolerance (a fraction, from the baseline
+// file unless -tolerance is given) plus SLACK_NS. The power and hitDetect
+// stages take a few ns per sample, the difference of two passes that each
+// take about a hundred, so on a busy PC they swing by more than their size;
+// the slack keeps them from failing on that while still catching a stage
+// that gets many times slower. -save writes this run as a baseline. The
+// baseline is JSON:
+//
+//   {"corpusSamples": 100000, "tolerance": 0.2,
+//    "nsPerSample": {"fir": 10.5, "iir": 40.1, ...}}
+//
+// -fft also times the FFT engine for every size (support/spectrumBench.h).
+// It is not part of the baseline.
+//
+// Cycles per sample use the CPU clock from -mhz or, on x86, the time stamp
+// counter's rate.
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "detectorBench.h"
+#include "spectrumBench.h"
+
+#define DEFAULT_REPEATS 10
+#define DEFAULT_TOLERANCE 0.2
+#define SLACK_NS 5.0
+#define MAX_BASELINE_SIZE 4096
+#define NS_PER_SECOND 1000000000.0
+#define HZ_PER_MHZ 1e6
+#define PERCENT 100.0
+#define TSC_MEASURE_NS 100000000 // 100 ms.
+
+static double nowSeconds() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / NS_PER_SECOND;
+}
+
+// Ticks per second of the time stamp counter, 0 where there is none.
+static double measureCpuHz() {
+#if defined(__x86_64__) || defined(__i386__)
+  struct timespec wait = {0, TSC_MEASURE_NS};
+  double start = nowSeconds();
+  uint64_t startTicks = __rdtsc();
+  nanosleep(&wait, NULL);
+  uint64_t ticks = __rdtsc() - startTicks;
+  return ticks / (nowSeconds() - start);
+#else
+  return 0;
+#endif
+}
+
+// The number after "key": in text, or false if the key is not there.
+static bool findNumber(const char *text, const char *key, double *value) {
+  char quoted[64];
+  snprintf(quoted, sizeof(quoted), "\"%s\"", key);
+  const char *at = strstr(text, quoted);
+  if (!at || !(at = strchr(at + strlen(quoted), ':')))
+    return false;
+  char *end;
+  *value = strtod(at + 1, &end);
+  return end != at + 1;
+}
+
+// Reads a baseline. The tolerance is left alone if the file has none.
+static bool loadBaseline(const char *path, double nsPerSample[],
+                         double *tolerance) {
+  static char text[MAX_BASELINE_SIZE];
+  FILE *file = fopen(path, "r");
+  if (!file) {
+    printf("lasertagBench: unable to open %s.\n", path);
+    return false;
+  }
+  size_t size = fread(text, 1, sizeof(text) - 1, file);
+  fclose(file);
+  text[size] = '\0';
+  double corpusSamples;
+  if (!findNumber(text, "corpusSamples", &corpusSamples) ||
+      corpusSamples != DETECTORBENCH_CORPUS_SAMPLES) {
+    printf("lasertagBench: %s is not a baseline for this corpus.\n", path);
+    return false;
+  }
+  findNumber(text, "tolerance", tolerance);
+  for (uint16_t s = 0; s < DETECTORBENCH_STAGE_COUNT; s++) {
+    if (!findNumber(text, detectorBench_getStageName(s), &nsPerSample[s])) {
+      printf("lasertagBench: %s has no %s stage.\n", path,
+             detectorBench_getStageName(s));
+      return false;
+    }
+  }
+  return true;
+}
+
+static bool saveBaseline(const char *path,
+                         const detectorBench_results_t *results,
+                         double tolerance) {
+  FILE *file = fopen(path, "w");
+  if (!file) {
+    printf("lasertagBench: unable to write %s.\n", path);
+    return false;
+  }
+  fprintf(file, "{\n  \"corpusSamples\": %d,\n  \"tolerance\": %g,\n",
+          DETECTORBENCH_CORPUS_SAMPLES, tolerance);
+  fprintf(file, "  \"nsPerSample\": {\n");
+  for (uint16_t s = 0; s < DETECTORBENCH_STAGE_COUNT; s++)
+    fprintf(file, "    \"%s\": %.2f%s\n", detectorBench_getStageName(s),
+            results->nsPerSample[s],
+            s + 1 < DETECTORBENCH_STAGE_COUNT ? "," : "");
+  fprintf(file, "  }\n}\n");
+  return fclose(file) == 0;
+}
+
+// Prints every stage next to the baseline, returns false if one is slower
+// than the tolerance allows.
+static bool compare(const detectorBench_results_t *results,
+                    const double baseline[], double tolerance) {
+  bool ok = true;
+  printf("%-11s %10s %10s %9s\n", "stage", "ns/sample", "baseline",
+         "change");
+  for (uint16_t s = 0; s < DETECTORBENCH_STAGE_COUNT; s++) {
+    double ns = results->nsPerSample[s];
+    bool slower = ns > baseline[s] * (1 + tolerance) + SLACK_NS;
+    printf("%-11s %10.1f %10.1f %+8.1f%%%s\n", detectorBench_getStageName(s),
+           ns, baseline[s],
+           baseline[s] > 0 ? (ns / baseline[s] - 1) * PERCENT : 0,
+           slower ? "  slower" : "");
+    ok = ok && !slower;
+  }
+  printf(ok ? "lasertagBench: within %.0f%% of the baseline.\n"
+            : "lasertagBench: slower than the baseline by more than %.0f%%.\n",
+         tolerance * PERCENT);
+  return ok;
+}
+
+static void usage() {
+  printf("usage: lasertagBench [-repeats N] [-mhz X] [-baseline FILE] "
+         "[-tolerance T] [-save FILE] [-fft]\n"
+         "-baseline FILE fails if a stage is slower than in FILE by more than "
+         "the tolerance (a fraction, %.2f unless FILE or -tolerance say "
+         "otherwise).\n"
+         "-save FILE writes this run as a baseline.\n"
+         "-fft also times the FFT for every size.\n",
+         DEFAULT_TOLERANCE);
+}
+
+int main(int argc, char *argv[]) {
+  int repeats = DEFAULT_REPEATS;
+  double mhz = 0;
+  double tolerance = -1;
+  const char *baselinePath = NULL;
+  const char *savePath = NULL;
+  bool fft = false;
+  for (int i = 1; i < argc; i++) {
+    bool hasValue = i + 1 < argc;
+    if (!strcmp(argv[i], "-repeats") && hasValue)
+      repeats = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-mhz") && hasValue)
+      mhz = atof(argv[++i]);
+    else if (!strcmp(argv[i], "-baseline") && hasValue)
+      baselinePath = argv[++i];
+    else if (!strcmp(argv[i], "-tolerance") && hasValue)
+      tolerance = atof(argv[++i]);
+    else if (!strcmp(argv[i], "-save") && hasValue)
+      savePath = argv[++i];
+    else if (!strcmp(argv[i], "-fft"))
+      fft = true;
+    else {
+      usage();
+      return 1;
+    }
+  }
+  if (repeats < 1 || repeats > UINT16_MAX || mhz < 0) {
+    usage();
+    return 1;
+  }
+
+  double baseline[DETECTORBENCH_STAGE_COUNT];
+  double baselineTolerance = DEFAULT_TOLERANCE;
+  if (baselinePath && !loadBaseline(baselinePath, baseline, &baselineTolerance))
+    return 1;
+  if (tolerance < 0)
+    tolerance = baselineTolerance;
+
+  detectorBench_results_t results;
+  if (!detectorBench_run(&results, repeats))
+    return 1;
+  double cpuHz = mhz > 0 ? mhz * HZ_PER_MHZ : measureCpuHz();
+  detectorBench_print(&results, cpuHz);
+
+  bool ok = true;
+  if (baselinePath)
+    ok = compare(&results, baseline, tolerance);
+  if (savePath && !saveBaseline(savePath, &results, tolerance))
+    ok = false;
+  spectrumBench_results_t fftResults;
+  if (fft) {
+    if (spectrumBench_run(&fftResults, repeats))
+      spectrumBench_print(&fftResults, cpuHz);
+    else
+      ok = false;
+  }
+  return ok ? 0 : 1;
+}
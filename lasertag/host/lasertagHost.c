@@ -0,0 +1,286 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+// Runs one gun's game_freezeTag() on a PC, with the stand-ins in hal/ in
+// place of the board. The bluetooth UART is connected to the link emulator
+// (linkEmulator.c) through a Unix socket. Hits are scheduled on the command
+// line; the ADC sees the shooter's transmitter waveform at those times.
+//
+//   lasertagHost -link <socket> -player <1..16> [-start <us>] [-seconds <s>]
+//                [-hit <ms>:<frequency>]... [-noise <counts>] [-display]
+//
+// -start is a CLOCK_MONOTONIC time in us that -hit times (ms) and the game
+// length are counted from, so that several processes can share a schedule.
+// BTN3 is "pressed" -seconds after the start, which ends the game.
+//
+//   lasertagHost -arena <socket> -player <1..16> -step <ticks>
+//
+// runs the gun on simulated time for the arena simulator (arena.c), which
+// supplies the ADC samples, the buttons and the bluetooth bytes each step
+// and gets back the MIO pins and the bytes sent (see arenaLink.h).
+//
+// Either mode takes -capture <file>, which records what the ADC delivered,
+// the trigger pulls and the hits in the format described in capture.h.
+// -journal <file> (arena mode only) records every input the gun gets, and
+//
+//   lasertagHost -replay <file>
+//
+// runs the same game again from such a journal, without the arena, and
+// checks that the gun does exactly what it did the first time.
+//
+// Every mode takes -players <count>, the number of players in the game (see
+// game_setPlayerCount()). The journal does not record it, so a replay needs
+// the count the game ran with.
+//
+// Every mode also takes -pack <file>, a sound pack (see soundPack.h) to play
+// the sounds from instead of the built-in arrays, e.g. build_host/voices.pak
+// with the voice clips. Sounds that are not in the pack keep the built-in
+// data. Sound lengths change the game's timing, so a replay needs the pack
+// the game ran with.
+
+#include <fcntl.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "arenaLink.h"
+#include "buttons.h"
+#include "capture.h"
+#include "display.h"
+#include "game.h"
+#include "gameProtocol.h"
+#include "hostBoard.h"
+#include "leds.h"
+#include "mio.h"
+#include "sound.h"
+#include "switches.h"
+
+#define DEFAULT_SECONDS 30
+#define DEFAULT_NOISE 4 // ADC counts peak to peak.
+#define US_PER_MS 1000
+#define US_PER_SECOND 1000000
+#define MAX_PLAYER 16 // Switch settings 0-15.
+
+static int arenaFd = -1;
+static FILE *captureFile;
+
+static void usage() {
+  printf("usage: lasertagHost -link <socket> -player <1..%d> [-start <us>] "
+         "[-seconds <s>] [-hit <ms>:<frequency>]... [-noise <counts>] "
+         "[-players <count>] [-pack <file>] [-display] [-capture <file>]\n"
+         "       lasertagHost -arena <socket> -player <1..%d> -step <ticks> "
+         "[-players <count>] [-pack <file>] [-display] [-capture <file>] "
+         "[-journal <file>]\n"
+         "       lasertagHost -replay <file> [-players <count>] [-pack <file>] "
+         "[-display] [-capture <file>]\n",
+         MAX_PLAYER, MAX_PLAYER);
+}
+
+// Capture sink, the capture goes to a file.
+static bool writeCapture(const uint8_t *data, uint32_t size) {
+  return fwrite(data, 1, size, captureFile) == size;
+}
+
+// Called between simulated steps: reports the last step to the arena and
+// sets up the next one.
+static void arenaStep() {
+  static arenaLink_result_t result;
+  static arenaLink_step_t step;
+  const uint16_t *trace;
+  uartModel_t *uart = hostBoard_getUart();
+  result.tickCount = hostBoard_getPinTrace(&trace);
+  memcpy(result.pins, trace, result.tickCount * sizeof(uint16_t));
+  result.uartCount =
+      uartModel_takeSent(uart, result.uart, ARENALINK_MAX_UART_BYTES);
+  if (!arenaLink_sendResult(arenaFd, &result) ||
+      !arenaLink_receiveStep(arenaFd, &step)) {
+    printf("lasertagHost: lost the arena.\n");
+    exit(1);
+  }
+  hostBoard_setButtons(step.buttons);
+  hostBoard_setAdcSamples(step.adc, step.tickCount);
+  hostBoard_receiveUart(step.uart, step.uartCount);
+}
+
+// Connects to the link emulator or the arena and says which player this is.
+static int connectLink(const char *path, uint8_t player, bool nonBlocking) {
+  int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+  struct sockaddr_un address = {.sun_family = AF_UNIX};
+  strncpy(address.sun_path, path, sizeof(address.sun_path) - 1);
+  if (fd < 0 ||
+      connect(fd, (struct sockaddr *)&address, sizeof(address)) < 0) {
+    printf("lasertagHost: unable to connect to %s.\n", path);
+    return -1;
+  }
+  if (write(fd, &player, 1) != 1) {
+    printf("lasertagHost: unable to say hello on %s.\n", path);
+    return -1;
+  }
+  if (nonBlocking)
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+  return fd;
+}
+
+// Same start-up as main.c, then the game, then the link statistics.
+static void runGun(int player) {
+  mio_init(false);
+  leds_init(false);
+  buttons_init();
+  switches_init();
+  display_init();
+  game_freezeTag();
+  if (captureFile) {
+    fclose(captureFile);
+    printf("player %d: capture dropped %u samples and %u markers.\n", player,
+           capture_getDroppedSamples(), capture_getDroppedMarkers());
+  }
+
+  gameProtocol_stats_t stats;
+  gameProtocol_getStats(&stats);
+  uartModel_t *uart = hostBoard_getUart();
+  printf("player %d: sent %u events in %u frames, received %u events in %u "
+         "frames, %u gaps, %u stale, %u CRC errors, %u length errors, %u "
+         "dropped, %u UART overruns.\n",
+         player, stats.eventsSent, stats.framesSent, stats.eventsReceived,
+         stats.framesReceived, stats.sequenceGaps, stats.staleFrames,
+         stats.crcErrors, stats.lengthErrors, stats.eventsDropped,
+         uart->overruns);
+}
+
+int main(int argc, char *argv[]) {
+  const char *linkPath = NULL;
+  const char *arenaPath = NULL;
+  const char *capturePath = NULL;
+  const char *journalPath = NULL;
+  const char *replayPath = NULL;
+  const char *packPath = NULL;
+  int player = 0;
+  int playerCount = GAME_DEFAULT_PLAYER_COUNT;
+  int stepTicks = 0;
+  uint64_t startUs = hostBoard_microseconds();
+  double seconds = DEFAULT_SECONDS;
+  uint16_t noise = DEFAULT_NOISE;
+  // Hits are collected first because they are relative to -start.
+  uint32_t hitMs[HOSTBOARD_MAX_HITS];
+  uint16_t hitFrequency[HOSTBOARD_MAX_HITS];
+  uint16_t hitCount = 0;
+  for (int i = 1; i < argc; i++) {
+    bool hasValue = i + 1 < argc;
+    if (!strcmp(argv[i], "-link") && hasValue) {
+      linkPath = argv[++i];
+    } else if (!strcmp(argv[i], "-arena") && hasValue) {
+      arenaPath = argv[++i];
+    } else if (!strcmp(argv[i], "-step") && hasValue) {
+      stepTicks = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "-player") && hasValue) {
+      player = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "-players") && hasValue) {
+      playerCount = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "-start") && hasValue) {
+      startUs = strtoull(argv[++i], NULL, 10);
+    } else if (!strcmp(argv[i], "-seconds") && hasValue) {
+      seconds = atof(argv[++i]);
+    } else if (!strcmp(argv[i], "-noise") && hasValue) {
+      noise = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "-hit") && hasValue &&
+               hitCount < HOSTBOARD_MAX_HITS) {
+      unsigned ms, frequency;
+      if (sscanf(argv[++i], "%u:%u", &ms, &frequency) != 2) {
+        usage();
+        return 1;
+      }
+      hitMs[hitCount] = ms;
+      hitFrequency[hitCount++] = frequency;
+    } else if (!strcmp(argv[i], "-capture") && hasValue) {
+      capturePath = argv[++i];
+    } else if (!strcmp(argv[i], "-journal") && hasValue) {
+      journalPath = argv[++i];
+    } else if (!strcmp(argv[i], "-replay") && hasValue) {
+      replayPath = argv[++i];
+    } else if (!strcmp(argv[i], "-pack") && hasValue) {
+      packPath = argv[++i];
+    } else if (!strcmp(argv[i], "-display")) {
+      hostBoard_echoDisplay(true);
+    } else {
+      usage();
+      return 1;
+    }
+  }
+  bool badOptions =
+      replayPath ? linkPath || arenaPath || journalPath
+                 : (linkPath == NULL) == (arenaPath == NULL) || player < 1 ||
+                       player > MAX_PLAYER || (journalPath && !arenaPath) ||
+                       (arenaPath && (stepTicks < 1 ||
+                                      stepTicks > HOSTBOARD_MAX_STEP_TICKS));
+  if (badOptions || playerCount < 1 || playerCount > GAME_MAX_PLAYER_COUNT) {
+    usage();
+    return 1;
+  }
+  game_setPlayerCount(playerCount);
+  if (packPath) {
+    // The file stays mapped for as long as the sounds play.
+    soundPack_t pack;
+    if (!soundPack_mapFile(&pack, packPath) ||
+        sound_usePack(&pack) != SOUND_STATUS_OK) {
+      printf("lasertagHost: unable to play sounds from %s.\n", packPath);
+      return 1;
+    }
+  }
+  signal(SIGPIPE, SIG_IGN);
+  setvbuf(stdout, NULL, _IOLBF, 0);
+  if (capturePath) {
+    captureFile = fopen(capturePath, "wb");
+    if (!captureFile || !capture_start(writeCapture)) {
+      printf("lasertagHost: unable to capture to %s.\n", capturePath);
+      return 1;
+    }
+  }
+  if (replayPath) {
+    // The journal sets up the board and supplies every step.
+    if (!hostBoard_replayInputs(replayPath))
+      return 1;
+    runGun(switches_read() + 1);
+    return hostBoard_closeJournal() ? 0 : 1;
+  }
+  int fd = connectLink(arenaPath ? arenaPath : linkPath, player, !arenaPath);
+  if (fd < 0)
+    return 1;
+
+  if (arenaPath) {
+    // The arena supplies the noise and the hits, and ends the game.
+    arenaFd = fd;
+    if (!hostBoard_simulate(stepTicks, arenaStep)) {
+      printf("lasertagHost: unable to start simulated time.\n");
+      return 1;
+    }
+    if (journalPath && !hostBoard_recordInputs(journalPath))
+      return 1;
+    hostBoard_setSwitches(player - 1); // game_freezeTag() adds 1.
+    runGun(player);
+    bool journalOk = hostBoard_closeJournal();
+    close(fd);
+    return journalOk ? 0 : 1;
+  }
+  hostBoard_setSwitches(player - 1);
+  hostBoard_setAdcNoise(noise);
+  for (uint16_t i = 0; i < hitCount; i++)
+    if (!hostBoard_addHit(startUs + (uint64_t)hitMs[i] * US_PER_MS,
+                          hitFrequency[i], HOSTBOARD_DEFAULT_HIT_AMPLITUDE))
+      printf("lasertagHost: bad hit %u:%u.\n", hitMs[i], hitFrequency[i]);
+  hostBoard_pressButtonsAt(BUTTONS_BTN3_MASK,
+                           startUs + (uint64_t)(seconds * US_PER_SECOND));
+  hostBoard_connectUart(fd);
+  runGun(player);
+  close(fd);
+  return 0;
+}
@@ -0,0 +1,158 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+// Runs the gun code's self-tests (the *_runTest() routines that main.c can
+// call on the board) on a PC, on simulated time with no step function: time
+// only moves while a test waits, so a test that waits for a timer takes as
+// long as the CPU needs for the ticks, not as long as the timer.
+//
+//   lasertagTests [TEST...]
+//
+// runs the named tests, or all of them. Tests that need a person at the
+// board (button presses, the display, the oscilloscope) are left out.
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "bluetooth.h"
+#include "bufferTest.h"
+#include "captureTest.h"
+#include "detectorCtxTest.h"
+#include "earlyDetectTest.h"
+#include "filterGateTest.h"
+#include "gameProtocolTest.h"
+#include "gameStateTest.h"
+#include "hostBoard.h"
+#include "interrupts.h"
+#include "isr.h"
+#include "lockoutTimer.h"
+#include "queueTest.h"
+#include "signalGeneratorTest.h"
+#include "soundPackTest.h"
+#include "spectrumTest.h"
+
+#define STEP_TICKS 10 // Waits end within 100 us of simulated time.
+#define US_PER_SECOND 1000000.0
+#define NS_PER_SECOND 1000000000.0
+#define LOCKOUT_US (LOCKOUT_TIMER_EXPIRE_VALUE * HOSTBOARD_US_PER_TICK)
+#define LOCKOUT_MARGIN_US (2 * STEP_TICKS * HOSTBOARD_US_PER_TICK)
+
+typedef struct {
+  const char *name;
+  bool (*run)(void);
+  bool needsIsr; // Runs with the timer interrupt enabled.
+} test_t;
+
+static double nowSeconds() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / NS_PER_SECOND;
+}
+
+// buffer_runTest() only prints its errors.
+static bool bufferTest() {
+  buffer_runTest();
+  return true;
+}
+
+// lockoutTimer_runTest() prints how long the lockout lasted, this also
+// checks it.
+static bool lockoutTimerTest() {
+  uint64_t startUs = hostBoard_microseconds();
+  bool passed = lockoutTimer_runTest();
+  uint64_t elapsedUs = hostBoard_microseconds() - startUs;
+  if (elapsedUs + LOCKOUT_MARGIN_US < LOCKOUT_US ||
+      elapsedUs > LOCKOUT_US + LOCKOUT_MARGIN_US) {
+    printf("lockout lasted %lu us, expected %d us.\n",
+           (unsigned long)elapsedUs, LOCKOUT_US);
+    passed = false;
+  }
+  return passed;
+}
+
+// The ones that feed modules directly come first, before the ISR runs.
+static const test_t tests[] = {
+    {"queue", queue_runTest, false},
+    {"buffer", bufferTest, false},
+    {"detectorCtx", detectorCtx_runTest, false},
+    {"filterGate", filterGate_runTest, false},
+    {"earlyDetect", earlyDetect_runTest, false},
+    {"spectrum", spectrum_runTest, false},
+    {"capture", capture_runTest, false},
+    {"signalGenerator", signalGenerator_runTest, false},
+    {"gameProtocol", gameProtocol_runTest, false},
+    {"gameState", gameState_runTest, false},
+    {"soundPack", soundPack_runTest, false},
+    {"lockoutTimer", lockoutTimerTest, true},
+};
+#define TEST_COUNT (sizeof(tests) / sizeof(tests[0]))
+
+// Same start-up as main.c: the ISR's modules, then the timer interrupt. The
+// ISR also services the bluetooth UART, so that is set up too.
+static void startIsr() {
+  isr_init();
+  interrupts_initAll(true);
+  bluetooth_init();
+  interrupts_enableTimerGlobalInts();
+  interrupts_startArmPrivateTimer();
+  interrupts_enableArmInts();
+}
+
+static bool selected(const test_t *test, int argc, char *argv[]) {
+  if (argc < 2)
+    return true;
+  for (int i = 1; i < argc; i++)
+    if (!strcmp(argv[i], test->name))
+      return true;
+  return false;
+}
+
+int main(int argc, char *argv[]) {
+  for (int i = 1; i < argc; i++) {
+    bool known = false;
+    for (uint32_t t = 0; t < TEST_COUNT; t++)
+      known |= !strcmp(argv[i], tests[t].name);
+    if (!known) {
+      printf("usage: lasertagTests [TEST...]\ntests:");
+      for (uint32_t t = 0; t < TEST_COUNT; t++)
+        printf(" %s", tests[t].name);
+      printf("\n");
+      return 1;
+    }
+  }
+  setvbuf(stdout, NULL, _IOLBF, 0);
+  if (!hostBoard_simulate(STEP_TICKS, NULL)) {
+    printf("lasertagTests: unable to start simulated time.\n");
+    return 1;
+  }
+
+  bool isrStarted = false;
+  uint32_t failed = 0, run = 0;
+  double start = nowSeconds();
+  for (uint32_t t = 0; t < TEST_COUNT; t++) {
+    const test_t *test = &tests[t];
+    if (!selected(test, argc, argv))
+      continue;
+    if (test->needsIsr && !isrStarted) {
+      startIsr();
+      isrStarted = true;
+    }
+    run++;
+    if (!test->run()) {
+      printf("lasertagTests: %s failed.\n", test->name);
+      failed++;
+    }
+  }
+  printf("lasertagTests: %u of %u tests passed, %.3f s simulated in %.3f s.\n",
+         run - failed, run, hostBoard_microseconds() / US_PER_SECOND,
+         nowSeconds() - start);
+  return failed ? 1 : 0;
+}
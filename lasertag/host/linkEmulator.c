@@ -0,0 +1,584 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+// Link emulator for freeze-tag games with several guns on one PC.
+//
+// Each gun is a lasertagHost process (game_freezeTag() on the hal/
+// stand-ins) whose bluetooth UART is a Unix socket to this program. The
+// guns' UART models already serialize bytes at 9600 baud in both
+// directions; this program plays the air in between. Bytes from a gun are
+// grouped into packets (PACKET_SIZE bytes, or whatever arrived within
+// -interval ms), and every packet is delivered to every other gun after
+// -delay ms plus up to -jitter ms. A packet can be lost (-loss) or held back
+// long enough that later packets overtake it (-reorder), independently for
+// each receiver.
+//
+// The emulator also schedules the hits: every -hitEvery ms one gun (in turn)
+// is frozen by the other team's frequency and, half a period later,
+// unfrozen by its own team's. game_freezeTag() does not listen for about 2 s
+// after it is hit, so -hitEvery should stay above 4000. It follows the
+// frames on every link with the protocol parser and reports how long each
+// freeze/unfreeze took to reach the other guns, and how much got lost.
+//
+//   linkEmulator [-players N] [-seconds S] [-loss P] [-reorder P]
+//                [-delay MS] [-jitter MS] [-interval MS] [-hitEvery MS]
+//                [-seed N] [-socket PATH] [-host PATH] [-external]
+//
+// -external does not start the guns; it prints their command lines and waits
+// for them to connect, so that they can be run by hand (or in a debugger).
+
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "gameProtocol.h"
+
+#define MAX_PLAYERS 16
+#define PACKET_SIZE 20 // Bytes per air packet (a BLE UART notification).
+#define MAX_DELIVERIES 8192
+#define MAX_SCHEDULED_HITS 256
+#define MAX_HOST_ARGS (16 + 2 * MAX_SCHEDULED_HITS)
+#define ARG_SIZE 32
+#define US_PER_MS 1000
+#define US_PER_SECOND 1000000
+#define NS_PER_US 1000
+#define BYTE_US 1042 // 10 bits at 9600 baud.
+#define STARTUP_US 1000000   // Time for the guns to start and connect.
+#define FIRST_HIT_MS 5000    // game_freezeTag() spends about 2 s starting.
+#define LAST_HIT_MARGIN_MS 2000
+#define TAIL_US 2000000      // Run this long after the guns' game ends.
+#define ACCEPT_TIMEOUT_MS 10000
+#define POLL_TIMEOUT_MS 1
+#define REORDER_INTERVALS 3  // A reordered packet is this many intervals late.
+#define READ_CHUNK_SIZE 256
+#define TEAM_A_FREQUENCY 4   // As in game.c.
+#define TEAM_B_FREQUENCY 8
+#define HOST_PROGRAM "lasertagHost"
+
+typedef struct {
+  int fd;
+  bool connected;
+  uint8_t packet[PACKET_SIZE]; // Air packet being filled.
+  uint8_t packetLength;
+  uint64_t packetOpenUs;
+  gameProtocol_parser_t uplink;   // Frames this gun sends.
+  gameProtocol_parser_t downlink; // Frames delivered to this gun.
+  uint64_t downlinkFreeUs; // When the gun's UART finishes receiving.
+  uint32_t bytesUp;
+  uint32_t bytesDown;
+  uint32_t framesUp;
+  uint32_t framesDown;
+} station_t;
+
+typedef struct {
+  uint64_t timeUs;
+  uint8_t receiver;
+  uint8_t length;
+  uint8_t data[PACKET_SIZE];
+} delivery_t;
+
+typedef struct {
+  uint8_t victim;
+  gameProtocol_eventType_t type;
+  uint16_t frequency;
+  uint64_t timeUs;                       // When the hit starts.
+  uint64_t hubUs;                        // Frame reached the emulator.
+  uint64_t arrivalUs[MAX_PLAYERS + 1];   // Frame reached gun i's UART.
+} scheduledHit_t;
+
+// Settings.
+static uint8_t players = 4;
+static double seconds = 30;
+static double lossProbability;
+static double reorderProbability;
+static uint32_t delayMs = 10;
+static uint32_t jitterMs = 5;
+static uint32_t intervalMs = 8;
+static uint32_t hitEveryMs = 6000;
+static bool external;
+static char socketPath[sizeof(((struct sockaddr_un *)0)->sun_path)];
+static char hostPath[PATH_MAX];
+
+static station_t stations[MAX_PLAYERS + 1]; // Indexed by player, 1-based.
+static delivery_t deliveries[MAX_DELIVERIES]; // Sorted by time.
+static uint32_t deliveryCount;
+static scheduledHit_t hits[MAX_SCHEDULED_HITS];
+static uint16_t hitCount;
+static pid_t children[MAX_PLAYERS + 1];
+static uint64_t startUs;
+
+// Statistics.
+static uint32_t packetsSent;    // Packet copies put in the air.
+static uint32_t packetsLost;
+static uint32_t packetsReordered;
+static uint32_t deliveriesDropped; // No room to schedule a delivery.
+
+// CLOCK_MONOTONIC in us, the same clock the guns use.
+static uint64_t microseconds() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * US_PER_SECOND + ts.tv_nsec / NS_PER_US;
+}
+
+static double randomUnit() { return (double)rand() / ((double)RAND_MAX + 1); }
+
+static uint16_t teamFrequency(uint8_t player) {
+  return (player - 1) % 2 ? TEAM_B_FREQUENCY : TEAM_A_FREQUENCY;
+}
+
+static uint16_t otherTeamFrequency(uint8_t player) {
+  return (player - 1) % 2 ? TEAM_A_FREQUENCY : TEAM_B_FREQUENCY;
+}
+
+// One gun at a time is frozen and then unfrozen, so two teammates are never
+// frozen together and the game does not end early.
+static void scheduleHits() {
+  uint32_t lastMs = seconds * 1000 - LAST_HIT_MARGIN_MS;
+  uint32_t victim = 0;
+  for (uint32_t ms = FIRST_HIT_MS;
+       ms + hitEveryMs <= lastMs && hitCount + 2 <= MAX_SCHEDULED_HITS;
+       ms += hitEveryMs) {
+    uint8_t player = victim++ % players + 1;
+    hits[hitCount++] =
+        (scheduledHit_t){.victim = player,
+                         .type = gameProtocol_frozen_e,
+                         .frequency = otherTeamFrequency(player),
+                         .timeUs = startUs + (uint64_t)ms * US_PER_MS};
+    hits[hitCount++] = (scheduledHit_t){
+        .victim = player,
+        .type = gameProtocol_unfrozen_e,
+        .frequency = teamFrequency(player),
+        .timeUs = startUs + (uint64_t)(ms + hitEveryMs / 2) * US_PER_MS};
+  }
+}
+
+// Builds the lasertagHost command line for player into args[].
+static uint16_t hostArguments(uint8_t player, char args[][ARG_SIZE],
+                              char *argv[]) {
+  uint16_t count = 0;
+  snprintf(args[count++], ARG_SIZE, "%s", HOST_PROGRAM);
+  snprintf(args[count++], ARG_SIZE, "-link");
+  snprintf(args[count++], ARG_SIZE, "%.*s", ARG_SIZE - 1, socketPath);
+  snprintf(args[count++], ARG_SIZE, "-player");
+  snprintf(args[count++], ARG_SIZE, "%d", player);
+  snprintf(args[count++], ARG_SIZE, "-players");
+  snprintf(args[count++], ARG_SIZE, "%d", players);
+  snprintf(args[count++], ARG_SIZE, "-start");
+  snprintf(args[count++], ARG_SIZE, "%llu", (unsigned long long)startUs);
+  snprintf(args[count++], ARG_SIZE, "-seconds");
+  snprintf(args[count++], ARG_SIZE, "%g", seconds);
+  for (uint16_t i = 0; i < hitCount; i++) {
+    if (hits[i].victim != player)
+      continue;
+    snprintf(args[count++], ARG_SIZE, "-hit");
+    snprintf(args[count++], ARG_SIZE, "%llu:%d",
+             (unsigned long long)(hits[i].timeUs - startUs) / US_PER_MS,
+             hits[i].frequency);
+  }
+  for (uint16_t i = 0; i < count; i++)
+    argv[i] = args[i];
+  argv[count] = NULL;
+  return count;
+}
+
+static void startHosts() {
+  static char args[MAX_HOST_ARGS][ARG_SIZE];
+  char *argv[MAX_HOST_ARGS + 1];
+  for (uint8_t player = 1; player <= players; player++) {
+    uint16_t count = hostArguments(player, args, argv);
+    if (external) {
+      printf("%s", hostPath);
+      for (uint16_t i = 1; i < count; i++)
+        printf(" %s", argv[i]);
+      printf("\n");
+      continue;
+    }
+    pid_t pid = fork();
+    if (pid == 0) {
+      execv(hostPath, argv);
+      printf("linkEmulator: unable to run %s.\n", hostPath);
+      _exit(1);
+    }
+    children[player] = pid;
+  }
+}
+
+// Waits for all of the guns to connect and say which player they are.
+static bool acceptStations(int listener) {
+  for (uint8_t connected = 0; connected < players;) {
+    struct pollfd pfd = {.fd = listener, .events = POLLIN};
+    if (poll(&pfd, 1, ACCEPT_TIMEOUT_MS) <= 0) {
+      printf("linkEmulator: only %d of %d guns connected.\n", connected,
+             players);
+      return false;
+    }
+    int fd = accept(listener, NULL, NULL);
+    uint8_t player;
+    if (fd < 0 || read(fd, &player, 1) != 1 || player < 1 ||
+        player > players || stations[player].connected) {
+      printf("linkEmulator: rejected a connection.\n");
+      if (fd >= 0)
+        close(fd);
+      continue;
+    }
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+    stations[player].fd = fd;
+    stations[player].connected = true;
+    connected++;
+  }
+  return true;
+}
+
+// Inserts a delivery, keeping the list sorted by time.
+static void scheduleDelivery(uint8_t receiver, uint64_t timeUs,
+                             const uint8_t *data, uint8_t length) {
+  if (deliveryCount == MAX_DELIVERIES) {
+    deliveriesDropped++;
+    return;
+  }
+  uint32_t i = deliveryCount++;
+  for (; i > 0 && deliveries[i - 1].timeUs > timeUs; i--)
+    deliveries[i] = deliveries[i - 1];
+  deliveries[i].timeUs = timeUs;
+  deliveries[i].receiver = receiver;
+  deliveries[i].length = length;
+  memcpy(deliveries[i].data, data, length);
+}
+
+// Puts sender's packet in the air towards every other gun.
+static void sendPacket(uint8_t sender, uint64_t nowUs) {
+  station_t *station = &stations[sender];
+  for (uint8_t receiver = 1; receiver <= players; receiver++) {
+    if (receiver == sender || !stations[receiver].connected)
+      continue;
+    packetsSent++;
+    if (randomUnit() < lossProbability) {
+      packetsLost++;
+      continue;
+    }
+    uint64_t timeUs = nowUs + (uint64_t)delayMs * US_PER_MS +
+                      (uint64_t)(randomUnit() * jitterMs * US_PER_MS);
+    if (randomUnit() < reorderProbability) {
+      packetsReordered++;
+      timeUs += (uint64_t)REORDER_INTERVALS * intervalMs * US_PER_MS;
+    }
+    scheduleDelivery(receiver, timeUs, station->packet, station->packetLength);
+  }
+  station->packetLength = 0;
+}
+
+// An events frame from victim reached the emulator: match its events with
+// the hits that caused them.
+static void matchUplink(uint8_t sender, const gameProtocol_frame_t *frame,
+                        uint64_t nowUs) {
+  for (uint8_t i = 0; i < frame->length; i++) {
+    gameProtocol_event_t event = gameProtocol_unpackEvent(frame->payload[i]);
+    for (uint16_t h = 0; h < hitCount; h++) {
+      if (hits[h].victim == sender && event.player == sender &&
+          hits[h].type == event.type && !hits[h].hubUs &&
+          hits[h].timeUs <= nowUs) {
+        hits[h].hubUs = nowUs;
+        break;
+      }
+    }
+  }
+}
+
+// An events frame was completely received by receiver's UART.
+static void matchDownlink(uint8_t receiver, const gameProtocol_frame_t *frame,
+                          uint64_t arrivalUs) {
+  for (uint8_t i = 0; i < frame->length; i++) {
+    gameProtocol_event_t event = gameProtocol_unpackEvent(frame->payload[i]);
+    for (uint16_t h = 0; h < hitCount; h++) {
+      if (hits[h].victim == event.player && hits[h].type == event.type &&
+          hits[h].hubUs && !hits[h].arrivalUs[receiver]) {
+        hits[h].arrivalUs[receiver] = arrivalUs;
+        break;
+      }
+    }
+  }
+}
+
+// Reads what a gun sent and packs it into air packets.
+static void readStation(uint8_t player, uint64_t nowUs) {
+  station_t *station = &stations[player];
+  uint8_t data[READ_CHUNK_SIZE];
+  ssize_t count;
+  while ((count = read(station->fd, data, sizeof(data))) > 0) {
+    station->bytesUp += count;
+    for (ssize_t i = 0; i < count; i++) {
+      if (gameProtocol_parseByte(&station->uplink, data[i])) {
+        station->framesUp++;
+        if (station->uplink.frame.type == gameProtocol_eventsFrame_e)
+          matchUplink(player, &station->uplink.frame, nowUs);
+      }
+      if (station->packetLength == 0)
+        station->packetOpenUs = nowUs;
+      station->packet[station->packetLength++] = data[i];
+      if (station->packetLength == PACKET_SIZE)
+        sendPacket(player, nowUs);
+    }
+  }
+  if (count == 0 || (count < 0 && errno != EAGAIN)) {
+    station->connected = false;
+    close(station->fd);
+  }
+}
+
+// Hands the due packets to their guns. The gun's UART model then takes 10 bit
+// times per byte, which is tracked here to time the frames' arrival.
+static void deliverPackets(uint64_t nowUs) {
+  uint32_t due = 0;
+  while (due < deliveryCount && deliveries[due].timeUs <= nowUs) {
+    delivery_t *delivery = &deliveries[due++];
+    station_t *station = &stations[delivery->receiver];
+    if (!station->connected)
+      continue;
+    if (write(station->fd, delivery->data, delivery->length) !=
+        delivery->length) {
+      deliveriesDropped++;
+      continue;
+    }
+    station->bytesDown += delivery->length;
+    for (uint8_t i = 0; i < delivery->length; i++) {
+      if (station->downlinkFreeUs < nowUs)
+        station->downlinkFreeUs = nowUs;
+      station->downlinkFreeUs += BYTE_US;
+      if (gameProtocol_parseByte(&station->downlink, delivery->data[i])) {
+        station->framesDown++;
+        if (station->downlink.frame.type == gameProtocol_eventsFrame_e)
+          matchDownlink(delivery->receiver, &station->downlink.frame,
+                        station->downlinkFreeUs);
+      }
+    }
+  }
+  memmove(deliveries, &deliveries[due],
+          (deliveryCount - due) * sizeof(delivery_t));
+  deliveryCount -= due;
+}
+
+static void run() {
+  uint64_t endUs = startUs + (uint64_t)(seconds * US_PER_SECOND) + TAIL_US;
+  struct pollfd pfds[MAX_PLAYERS];
+  uint64_t nowUs;
+  while ((nowUs = microseconds()) < endUs) {
+    uint8_t count = 0;
+    for (uint8_t player = 1; player <= players; player++) {
+      if (stations[player].connected)
+        pfds[count++] = (struct pollfd){.fd = stations[player].fd,
+                                        .events = POLLIN};
+    }
+    if (count == 0)
+      break; // Every gun has gone.
+    poll(pfds, count, POLL_TIMEOUT_MS);
+    nowUs = microseconds();
+    for (uint8_t player = 1; player <= players; player++) {
+      station_t *station = &stations[player];
+      if (!station->connected)
+        continue;
+      readStation(player, nowUs);
+      if (station->packetLength &&
+          nowUs - station->packetOpenUs >= (uint64_t)intervalMs * US_PER_MS)
+        sendPacket(player, nowUs);
+    }
+    deliverPackets(nowUs);
+  }
+}
+
+static void report() {
+  printf("\nlink: %d guns, %.0f%% loss, %.0f%% reorder, delay %u+%u ms, "
+         "packets every %u ms\n",
+         players, 100 * lossProbability, 100 * reorderProbability, delayMs,
+         jitterMs, intervalMs);
+  printf("gun  bytes up  frames up  bytes down  frames down  CRC errors\n");
+  for (uint8_t player = 1; player <= players; player++) {
+    station_t *station = &stations[player];
+    printf("%3d  %8u  %9u  %10u  %11u  %10u\n", player, station->bytesUp,
+           station->framesUp, station->bytesDown, station->framesDown,
+           station->downlink.crcErrors);
+  }
+  printf("packets: %u sent, %u lost, %u reordered, %u not delivered\n",
+         packetsSent, packetsLost, packetsReordered, deliveriesDropped);
+
+  printf("hit  gun  event     at (s)  left the gun (ms)  reached guns (ms)\n");
+  for (uint16_t h = 0; h < hitCount; h++) {
+    printf("%3d  %3d  %-8s  %6.1f", h, hits[h].victim,
+           hits[h].type == gameProtocol_frozen_e ? "frozen" : "unfrozen",
+           (double)(hits[h].timeUs - startUs) / US_PER_SECOND);
+    if (!hits[h].hubUs) {
+      printf("  not reported\n");
+      continue;
+    }
+    printf("  %17.1f ",
+           (double)(hits[h].hubUs - hits[h].timeUs) / US_PER_MS);
+    for (uint8_t player = 1; player <= players; player++) {
+      if (player == hits[h].victim)
+        continue;
+      if (hits[h].arrivalUs[player])
+        printf(" %.1f",
+               (double)(hits[h].arrivalUs[player] - hits[h].timeUs) /
+                   US_PER_MS);
+      else
+        printf(" lost");
+    }
+    printf("\n");
+  }
+
+  uint32_t detected = 0;
+  uint32_t arrivals = 0;
+  uint32_t expected = 0;
+  double hubSum = 0, arrivalSum = 0;
+  uint64_t hubMax = 0, arrivalMax = 0;
+  uint64_t hubMin = UINT64_MAX, arrivalMin = UINT64_MAX;
+  for (uint16_t h = 0; h < hitCount; h++) {
+    if (!hits[h].hubUs)
+      continue;
+    detected++;
+    uint64_t hubUs = hits[h].hubUs - hits[h].timeUs;
+    hubSum += hubUs;
+    hubMin = hubUs < hubMin ? hubUs : hubMin;
+    hubMax = hubUs > hubMax ? hubUs : hubMax;
+    for (uint8_t player = 1; player <= players; player++) {
+      if (player == hits[h].victim)
+        continue;
+      expected++;
+      if (!hits[h].arrivalUs[player])
+        continue;
+      arrivals++;
+      uint64_t arrivalUs = hits[h].arrivalUs[player] - hits[h].timeUs;
+      arrivalSum += arrivalUs;
+      arrivalMin = arrivalUs < arrivalMin ? arrivalUs : arrivalMin;
+      arrivalMax = arrivalUs > arrivalMax ? arrivalUs : arrivalMax;
+    }
+  }
+  printf("hits: %u scheduled, %u reported by the gun that was hit\n",
+         hitCount, detected);
+  if (detected)
+    printf("hit -> frame leaves the gun:       min %6.1f  mean %6.1f  "
+           "max %6.1f ms\n",
+           (double)hubMin / US_PER_MS, hubSum / detected / US_PER_MS,
+           (double)hubMax / US_PER_MS);
+  if (arrivals)
+    printf("hit -> frame in other guns' UARTs: min %6.1f  mean %6.1f  "
+           "max %6.1f ms (%u of %u arrived)\n",
+           (double)arrivalMin / US_PER_MS, arrivalSum / arrivals / US_PER_MS,
+           (double)arrivalMax / US_PER_MS, arrivals, expected);
+  printf("(add up to 1 ms for bluetooth_poll() and a game loop iteration)\n");
+}
+
+static void usage() {
+  printf("usage: linkEmulator [-players N] [-seconds S] [-loss P] "
+         "[-reorder P] [-delay MS] [-jitter MS] [-interval MS] "
+         "[-hitEvery MS] [-seed N] [-socket PATH] [-host PATH] "
+         "[-external]\n");
+}
+
+// lasertagHost is expected next to this program unless -host says otherwise.
+static void defaultHostPath() {
+  ssize_t length = readlink("/proc/self/exe", hostPath, sizeof(hostPath) - 1);
+  if (length < 0)
+    length = 0;
+  hostPath[length] = '\0';
+  char *slash = strrchr(hostPath, '/');
+  size_t directoryLength = slash ? (size_t)(slash - hostPath + 1) : 0;
+  snprintf(hostPath + directoryLength, sizeof(hostPath) - directoryLength,
+           "%s", HOST_PROGRAM);
+}
+
+int main(int argc, char *argv[]) {
+  unsigned seed = 1;
+  snprintf(socketPath, sizeof(socketPath), "/tmp/lasertagLink.%d",
+           (int)getpid());
+  defaultHostPath();
+  for (int i = 1; i < argc; i++) {
+    bool hasValue = i + 1 < argc;
+    if (!strcmp(argv[i], "-players") && hasValue)
+      players = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-seconds") && hasValue)
+      seconds = atof(argv[++i]);
+    else if (!strcmp(argv[i], "-loss") && hasValue)
+      lossProbability = atof(argv[++i]);
+    else if (!strcmp(argv[i], "-reorder") && hasValue)
+      reorderProbability = atof(argv[++i]);
+    else if (!strcmp(argv[i], "-delay") && hasValue)
+      delayMs = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-jitter") && hasValue)
+      jitterMs = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-interval") && hasValue)
+      intervalMs = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-hitEvery") && hasValue)
+      hitEveryMs = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-seed") && hasValue)
+      seed = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-socket") && hasValue)
+      snprintf(socketPath, sizeof(socketPath), "%s", argv[++i]);
+    else if (!strcmp(argv[i], "-host") && hasValue)
+      snprintf(hostPath, sizeof(hostPath), "%s", argv[++i]);
+    else if (!strcmp(argv[i], "-external"))
+      external = true;
+    else {
+      usage();
+      return 1;
+    }
+  }
+  if (players < 2 || players > MAX_PLAYERS || intervalMs == 0 ||
+      hitEveryMs == 0) {
+    usage();
+    return 1;
+  }
+  srand(seed);
+  signal(SIGPIPE, SIG_IGN);
+  setvbuf(stdout, NULL, _IOLBF, 0);
+
+  int listener = socket(AF_UNIX, SOCK_STREAM, 0);
+  struct sockaddr_un address = {.sun_family = AF_UNIX};
+  snprintf(address.sun_path, sizeof(address.sun_path), "%s", socketPath);
+  unlink(socketPath);
+  if (listener < 0 ||
+      bind(listener, (struct sockaddr *)&address, sizeof(address)) < 0 ||
+      listen(listener, MAX_PLAYERS) < 0) {
+    printf("linkEmulator: unable to listen on %s.\n", socketPath);
+    return 1;
+  }
+  for (uint8_t player = 1; player <= MAX_PLAYERS; player++) {
+    gameProtocol_parserInit(&stations[player].uplink);
+    gameProtocol_parserInit(&stations[player].downlink);
+  }
+
+  // In external mode the guns are started by hand, so give them more time.
+  startUs = microseconds() +
+            (external ? ACCEPT_TIMEOUT_MS * US_PER_MS : STARTUP_US);
+  scheduleHits();
+  startHosts();
+  bool ok = acceptStations(listener);
+  if (ok)
+    run();
+  for (uint8_t player = 1; player <= players; player++) {
+    if (children[player] > 0) {
+      kill(children[player], SIGTERM);
+      waitpid(children[player], NULL, 0);
+    }
+  }
+  close(listener);
+  unlink(socketPath);
+  if (!ok)
+    return 1;
+  report();
+  return 0;
+}
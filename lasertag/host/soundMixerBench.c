@@ -0,0 +1,89 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+// Measures what soundMixer_mix() costs per 48 kHz output sample with 1 to
+// SOUND_MIXER_VOICE_COUNT voices playing. At 48 kHz, sound_tick() has about
+// 20.8 us per sample for everything, so the mix should be a small fraction.
+// Clips stored at 16 kHz (speech, see wav2c -rate) are measured separately
+// because they also go through the interpolator.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "soundMixer.h"
+
+#define SAMPLE_RATE 48000
+#define BENCH_SECONDS 10 // Amount of audio mixed per measurement.
+#define BENCH_SAMPLE_COUNT (SAMPLE_RATE * BENCH_SECONDS)
+#define NS_PER_SECOND 1000000000.0
+#define BUDGET_NS_PER_SAMPLE (NS_PER_SECOND / SAMPLE_RATE)
+#define HALF_VOLUME (SOUND_MIXER_UNITY_GAIN / 2)
+#define SPEECH_SAMPLE_RATE 16000
+
+static double nowNs() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * NS_PER_SECOND + ts.tv_nsec;
+}
+
+// Mixes BENCH_SAMPLE_COUNT samples with voiceCount voices playing clip, which
+// is stored at sampleRate. Returns the cost in ns per output sample.
+static double benchVoices(const uint16_t *clip, uint32_t sampleRate,
+                          uint16_t voiceCount) {
+  uint32_t clipSampleCount =
+      BENCH_SAMPLE_COUNT / (SOUND_MIXER_SAMPLE_RATE / sampleRate);
+  int16_t block[SOUND_MIXER_BLOCK_SIZE];
+  int32_t checksum = 0; // Keeps the compiler from dropping the mix.
+  soundMixer_init();
+  for (uint16_t v = 0; v < voiceCount; v++)
+    // Alternate unity and half gain so both scaling paths are measured.
+    soundMixer_play(v, clip, clipSampleCount, sampleRate, 0,
+                    v % 2 ? HALF_VOLUME : SOUND_MIXER_UNITY_GAIN);
+  double start = nowNs();
+  for (uint32_t i = 0; i < BENCH_SAMPLE_COUNT; i += SOUND_MIXER_BLOCK_SIZE) {
+    soundMixer_mix(block, SOUND_MIXER_BLOCK_SIZE);
+    checksum += block[i % SOUND_MIXER_BLOCK_SIZE];
+  }
+  double elapsed = nowNs() - start;
+  if (soundMixer_activeVoiceCount() != 0)
+    printf("soundMixerBench: voices still active after the clip ended.\n");
+  if (checksum == INT32_MIN)
+    printf("checksum: %d\n", checksum);
+  return elapsed / BENCH_SAMPLE_COUNT;
+}
+
+int main() {
+  uint16_t *clip = malloc(BENCH_SAMPLE_COUNT * sizeof(uint16_t));
+  if (clip == NULL) {
+    printf("soundMixerBench: out of memory.\n");
+    return 1;
+  }
+  // Pseudo-random full-scale samples so that the saturation paths get used.
+  uint32_t seed = 1;
+  for (uint32_t i = 0; i < BENCH_SAMPLE_COUNT; i++) {
+    seed = seed * 1103515245 + 12345;
+    clip[i] = seed >> 16;
+  }
+  printf("Mixing %d s of %d Hz audio, block size %d.\n", BENCH_SECONDS,
+         SAMPLE_RATE, SOUND_MIXER_BLOCK_SIZE);
+  printf("Budget is %.1f us per sample.\n", BUDGET_NS_PER_SAMPLE / 1000.0);
+  printf("voices  48 kHz clips       16 kHz clips\n");
+  printf("        ns/sample  %%      ns/sample  %%\n");
+  for (uint16_t voices = 1; voices <= SOUND_MIXER_VOICE_COUNT; voices++) {
+    double nsPerSample = benchVoices(clip, SOUND_MIXER_SAMPLE_RATE, voices);
+    double speechNsPerSample = benchVoices(clip, SPEECH_SAMPLE_RATE, voices);
+    printf("%6d  %9.2f  %.4f  %9.2f  %.4f\n", voices, nsPerSample,
+           100.0 * nsPerSample / BUDGET_NS_PER_SAMPLE, speechNsPerSample,
+           100.0 * speechNsPerSample / BUDGET_NS_PER_SAMPLE);
+  }
+  free(clip);
+  return 0;
+}
@@ -0,0 +1,23 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#include <stddef.h>
+
+#include "idle.h"
+
+static idle_function_t idleFunction = NULL;
+
+// Called by loops that wait for the ISR.
+void idle_run() {
+  if (idleFunction)
+    idleFunction();
+}
+
+// Sets the function idle_run() calls, NULL for none.
+void idle_setFunction(idle_function_t function) { idleFunction = function; }
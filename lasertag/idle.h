@@ -0,0 +1,28 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef IDLE_H_
+#define IDLE_H_
+
+// Loops that wait for the ISR to change something (a timer to expire, the
+// transmitter to finish) call idle_run() each time around. On the board the
+// timer interrupt runs on its own, so there is nothing to do. A host build on
+// simulated time only moves time on when the gun waits, so it sets an idle
+// function that runs the next ticks (see hostBoard_simulate()).
+
+// Called with nothing to do until the ISR has run.
+typedef void (*idle_function_t)(void);
+
+// Called by loops that wait for the ISR.
+void idle_run();
+
+// Sets the function idle_run() calls, NULL for none (the default).
+void idle_setFunction(idle_function_t function);
+
+#endif /* IDLE_H_ */
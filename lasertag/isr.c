@@ -4,6 +4,7 @@
 #include "hitLedTimer.h"
 #include "lockoutTimer.h"
 #include "buffer.h"
+#include "capture.h"
 #include "interrupts.h"
 #include "sound.h"
 #include "game.h"
@@ -30,7 +31,9 @@ void isr_function()
     trigger_tick();
     hitLedTimer_tick();
     lockoutTimer_tick();
-    buffer_pushover(interrupts_getAdcData());
+    buffer_data_t adcData = interrupts_getAdcData();
+    buffer_pushover(adcData);
+    capture_isrSample(adcData);
     sound_tick();
     bluetooth_isr_function();
 }
\ No newline at end of file
@@ -1,5 +1,6 @@
 
 #include "lockoutTimer.h"
+#include "idle.h"
 #include "intervalTimer.h"
 #include "utils.h"
 #include <stdbool.h>
@@ -106,6 +107,7 @@ bool lockoutTimer_runTest() {
     utils_msDelay(TWENTY_MS_DELAY);
     //keep the test going until we decide to stop it 
     while (lockoutTimer_running()) {
+        idle_run();
     }
     intervalTimer_stop(INTERVAL_TIMER_TIMER_1);
     double duration = intervalTimer_getTotalDurationInSeconds(INTERVAL_TIMER_TIMER_1);
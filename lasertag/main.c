@@ -24,11 +24,18 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 
 #include "bufferTest.h"
 #include "buttons.h"
+#include "captureTest.h"
 #include "detector.h"
+#include "detectorBench.h"
+#include "detectorCtxTest.h"
 #include "display.h"
+#include "earlyDetectTest.h"
 #include "filter.h"
+#include "filterGateTest.h"
 #include "filterTest.h"
 #include "game.h"
+#include "gameProtocolTest.h"
+#include "gameStateTest.h"
 #include "hitLedTimer.h"
 #include "interrupts.h"
 #include "isr.h"
@@ -36,7 +43,11 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 #include "lockoutTimer.h"
 #include "mio.h"
 #include "runningModes.h"
+#include "signalGeneratorTest.h"
 #include "sound.h"
+#include "soundPackTest.h"
+#include "spectrumBench.h"
+#include "spectrumTest.h"
 #include "switches.h"
 #include "transmitter.h"
 #include "trigger.h"
@@ -59,7 +70,18 @@ int main()
   // transmitter_runTest(); // M3 T2
   buffer_runTest(); // M3 T3
   // detector_runTest(); // M3 T3
+  // detectorCtx_runTest();
+  // filterGate_runTest();
+  // earlyDetect_runTest();
+  // spectrum_runTest();
+  // detectorBench_report(); // Detector speed, see detectorBench.h.
+  // spectrumBench_report(); // FFT speed by size, see spectrumBench.h.
+  // capture_runTest();
+  // signalGenerator_runTest();
   // sound_runTest(); // M5
+  // gameProtocol_runTest();
+  // gameState_runTest();
+  // soundPack_runTest();
 #endif
 
 #ifdef RUNNING_MODE_M3_T2
@@ -2,7 +2,7 @@
 
 #include <stdint.h>
 
-uint16_t bcfire01_48k_wav[53638] = {
+const uint16_t bcfire01_48k_wav[53638] = {
 32767,
 32765,
 32766,
@@ -2,7 +2,7 @@
 
 #include <stdint.h>
 
-uint16_t gameBoyStartup_wav[105488] = {
+const uint16_t gameBoyStartup_wav[105488] = {
 32767,
 32767,
 32767,
@@ -2,7 +2,7 @@
 
 #include <stdint.h>
 
-uint16_t gameOver48k_wav[156595] = {
+const uint16_t gameOver48k_wav[156595] = {
 32740,
 32744,
 32790,
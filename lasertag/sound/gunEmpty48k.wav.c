@@ -2,7 +2,7 @@
 
 #include <stdint.h>
 
-uint16_t gunEmpty48k_wav[15456] = {
+const uint16_t gunEmpty48k_wav[15456] = {
 32767,
 32768,
 32764,
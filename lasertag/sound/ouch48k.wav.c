@@ -2,7 +2,7 @@
 
 #include <stdint.h>
 
-uint16_t ouch48k_wav[23467] = {
+const uint16_t ouch48k_wav[23467] = {
 32101,
 32046,
 32061,
@@ -1,5 +1,5 @@
-// This file was generated by executing this statement: wav2c wavFiles/p1FrozenN.wav
-extern uint16_t p1Frozen_wav[];
-#define P1FROZENN_WAV_SAMPLE_RATE 480000
-#define P1FROZENN_WAV_BITS_PER_SAMPLE 16
-#define P1FROZENN_WAV_NUMBER_OF_SAMPLES 105230
+// This file was generated by executing this statement: wav2c -rate 16000 p1Frozen.wav
+extern const uint16_t p1Frozen_wav[];
+#define P1FROZEN_WAV_SAMPLE_RATE 16000
+#define P1FROZEN_WAV_BITS_PER_SAMPLE 16
+#define P1FROZEN_WAV_NUMBER_OF_SAMPLES 35077
@@ -1,8 +1,8 @@
-// This file was generated by executing this statement: wav2c p2Frozen.wav
+// This file was generated by executing this statement: wav2c -rate 16000 p2Frozen.wav
 
 #include <stdint.h>
 
-uint16_t p2Frozen_wav[97742] = {
+const uint16_t p2Frozen_wav[32581] = {
 32767,
 32767,
 32767,
@@ -19,12 +19,6 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
@@ -32,280 +26,47 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32770,
-32762,
-32772,
-32763,
-32770,
-32766,
-32765,
-32771,
-32763,
-32770,
-32765,
-32768,
 32767,
-32768,
-32765,
-32769,
-32764,
-32771,
-32764,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32768,
-32764,
-32771,
-32762,
-32772,
-32763,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
 32767,
-32765,
-32770,
-32765,
-32768,
 32767,
-32765,
-32769,
 32767,
-32766,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32769,
-32764,
-32770,
-32765,
 32767,
-32769,
-32765,
 32767,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32769,
-32766,
-32768,
-32766,
-32769,
-32764,
-32769,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
 32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
 32767,
 32767,
-32766,
-32768,
-32766,
-32769,
-32764,
-32771,
-32762,
-32772,
-32763,
-32770,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
-32765,
-32771,
-32763,
-32770,
-32766,
-32765,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
 32767,
-32769,
-32764,
-32769,
 32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32765,
-32769,
-32765,
-32768,
-32769,
-32763,
-32771,
-32763,
-32770,
-32766,
 32767,
 32767,
 32767,
@@ -316,292 +77,48 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
-32766,
-32769,
-32766,
-32768,
-32765,
-32768,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
 32767,
-32769,
-32763,
-32772,
-32762,
-32771,
-32764,
-32769,
-32766,
-32768,
-32766,
 32767,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32763,
-32771,
-32763,
-32770,
-32765,
-32768,
 32767,
 32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32766,
-32765,
-32771,
-32763,
-32770,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
-32768,
-32765,
-32768,
-32766,
-32769,
-32765,
-32769,
-32764,
-32770,
-32764,
-32771,
-32763,
-32770,
-32765,
 32767,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32766,
-32766,
-32769,
-32764,
-32769,
 32767,
-32766,
-32769,
-32764,
-32769,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
 32767,
 32767,
 32767,
-32765,
-32770,
-32765,
-32769,
-32764,
-32769,
-32766,
-32768,
-32768,
-32764,
-32770,
-32764,
-32770,
-32766,
-32766,
-32769,
-32764,
-32769,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32768,
 32767,
-32768,
-32766,
 32767,
-32766,
-32768,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32772,
-32762,
-32771,
-32764,
-32769,
-32766,
-32768,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
@@ -609,235 +126,56 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32768,
-32766,
-32769,
-32765,
-32769,
-32764,
-32770,
-32764,
-32771,
-32762,
-32772,
-32763,
-32769,
 32767,
-32766,
-32768,
 32767,
-32765,
-32770,
-32765,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
 32767,
-32765,
-32771,
-32763,
-32770,
-32765,
-32768,
-32766,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32770,
-32762,
-32774,
-32760,
-32773,
-32763,
-32768,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32765,
-32769,
 32767,
-32765,
-32770,
-32763,
-32772,
-32762,
-32771,
-32763,
-32770,
 32767,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32764,
-32772,
-32761,
-32772,
-32765,
-32766,
-32770,
-32763,
-32770,
-32766,
 32767,
 32767,
-32768,
-32765,
-32769,
-32766,
-32766,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
-32768,
-32764,
-32771,
-32764,
-32768,
 32767,
 32767,
 32767,
-32768,
-32765,
-32768,
-32766,
-32769,
-32765,
-32768,
 32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
 32767,
-32765,
-32770,
-32764,
-32769,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
 32767,
 32767,
 32767,
-32766,
-32768,
 32767,
 32767,
 32767,
-32768,
-32765,
-32768,
-32768,
-32765,
-32770,
-32763,
-32771,
-32763,
-32772,
-32762,
-32770,
-32766,
-32766,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
@@ -845,23 +183,7 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32768,
-32765,
-32770,
-32764,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
@@ -871,1274 +193,197 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
 32767,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
 32767,
 32767,
 32767,
-32768,
-32766,
-32768,
-32765,
-32769,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32769,
 32767,
-32766,
-32769,
-32764,
-32769,
 32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32771,
-32763,
-32770,
-32765,
-32769,
-32765,
-32769,
-32764,
-32771,
-32763,
-32771,
-32763,
-32769,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32771,
-32763,
-32770,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32764,
-32768,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
 32767,
-32765,
-32770,
-32763,
-32770,
 32767,
-32765,
-32770,
-32764,
-32768,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32768,
-32768,
-32764,
-32770,
-32766,
-32765,
-32771,
-32763,
-32769,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32769,
-32765,
-32770,
-32765,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
 32767,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32765,
-32768,
 32767,
-32765,
-32771,
-32762,
-32772,
-32763,
-32770,
-32765,
 32767,
-32768,
-32766,
-32768,
 32767,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
 32767,
-32765,
-32770,
-32764,
-32770,
-32765,
 32767,
-32768,
-32766,
-32768,
 32767,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
 32767,
-32766,
 32767,
-32768,
-32766,
-32768,
 32767,
-32765,
-32769,
-32766,
-32768,
-32766,
 32767,
 32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
 32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
 32767,
 32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32771,
-32763,
-32771,
-32763,
-32771,
-32763,
-32771,
-32764,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32769,
 32767,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32769,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32771,
-32763,
-32771,
-32763,
-32771,
-32763,
-32771,
-32763,
-32771,
-32763,
-32771,
-32764,
-32769,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32763,
-32772,
-32763,
-32769,
 32767,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32771,
-32763,
-32770,
-32764,
-32770,
-32765,
 32767,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
-32766,
-32769,
-32764,
-32772,
-32761,
-32772,
-32763,
-32770,
-32766,
-32766,
-32769,
-32764,
-32770,
-32766,
-32766,
-32769,
-32765,
-32768,
-32768,
-32764,
-32770,
-32765,
-32768,
-32768,
-32764,
-32771,
-32762,
-32772,
-32764,
-32768,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32770,
-32763,
-32770,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32769,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
 32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
 32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32769,
-32764,
-32770,
-32764,
-32769,
 32767,
-32766,
-32769,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32763,
-32771,
-32764,
-32769,
-32766,
 32767,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32765,
-32770,
-32763,
-32771,
-32764,
-32768,
-32768,
-32765,
-32769,
-32766,
-32766,
-32768,
-32768,
-32765,
-32770,
-32763,
-32770,
-32765,
-32768,
 32767,
 32767,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32762,
-32772,
-32763,
-32769,
 32767,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32763,
-32771,
-32765,
 32767,
-32768,
-32765,
-32770,
-32765,
-32768,
-32766,
 32767,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32771,
-32762,
-32772,
-32762,
-32772,
-32763,
-32769,
 32767,
-32766,
-32769,
-32765,
 32767,
-32769,
-32764,
-32770,
-32765,
 32767,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
 32767,
-32765,
-32771,
-32762,
-32771,
-32765,
 32767,
-32768,
 32767,
-32766,
-32769,
-32764,
-32769,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
 32767,
-32769,
-32763,
-32772,
-32763,
-32770,
-32765,
 32767,
-32769,
-32764,
-32771,
-32762,
-32771,
-32765,
-32768,
 32767,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32769,
-32764,
-32771,
-32763,
-32769,
-32768,
-32764,
-32770,
-32765,
-32768,
 32767,
 32767,
-32766,
-32768,
 32767,
 32767,
 32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32769,
 32767,
-32766,
-32768,
 32767,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32765,
-32769,
-32766,
 32767,
-32769,
-32763,
-32770,
-32765,
-32768,
 32767,
 32767,
-32766,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32765,
-32770,
-32765,
 32767,
-32768,
-32765,
-32769,
 32767,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32771,
-32763,
-32771,
-32764,
 32767,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32765,
-32768,
-32766,
 32767,
-32768,
 32767,
-32765,
-32769,
-32765,
-32770,
-32765,
 32767,
 32767,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
 32767,
-32765,
-32770,
-32765,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32769,
 32767,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32771,
-32762,
-32772,
-32762,
-32771,
-32764,
-32769,
 32767,
-32766,
 32767,
-32768,
-32765,
-32771,
-32763,
-32769,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32769,
-32764,
-32770,
-32766,
 32767,
 32767,
-32766,
-32768,
 32767,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32769,
 32767,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
 32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
 32767,
-32766,
-32769,
-32763,
-32772,
-32763,
-32769,
 32767,
-32765,
-32771,
-32762,
-32771,
-32765,
 32767,
-32768,
 32767,
-32766,
-32769,
-32764,
-32769,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32768,
-32768,
-32766,
-32766,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
@@ -2146,26 +391,7 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32770,
-32763,
-32771,
-32763,
-32771,
-32764,
-32770,
-32763,
-32770,
-32766,
 32767,
-32768,
-32765,
-32768,
 32767,
 32767,
 32767,
@@ -2176,724 +402,134 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32763,
-32771,
-32763,
-32771,
-32763,
-32771,
-32763,
-32770,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
 32767,
 32767,
-32768,
-32766,
-32768,
-32766,
-32766,
-32769,
-32766,
-32768,
 32767,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
 32767,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
 32767,
-32768,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
 32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32765,
-32770,
-32763,
-32771,
-32763,
-32771,
-32764,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32769,
-32768,
-32765,
-32769,
-32765,
-32768,
 32767,
-32768,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
 32767,
 32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
 32767,
-32768,
-32764,
-32771,
-32762,
-32772,
-32764,
-32768,
-32766,
-32768,
 32767,
 32767,
 32767,
-32766,
-32769,
-32766,
 32767,
-32768,
-32764,
-32772,
-32762,
-32771,
-32764,
-32769,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
 32767,
-32769,
-32764,
-32771,
-32762,
-32771,
-32764,
-32769,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
 32767,
-32768,
-32766,
 32767,
 32767,
-32768,
-32766,
 32767,
-32768,
-32764,
-32771,
-32764,
-32768,
-32768,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32766,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32771,
-32764,
-32769,
-32765,
-32768,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32765,
-32770,
-32763,
-32772,
-32762,
-32770,
-32766,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32763,
-32771,
-32765,
 32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32763,
-32772,
-32762,
-32772,
-32762,
-32771,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
 32767,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32766,
 32767,
 32767,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
 32767,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
 32767,
-32768,
-32766,
-32769,
-32764,
-32770,
-32763,
-32771,
-32765,
 32767,
-32769,
-32764,
-32769,
-32766,
 32767,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
-32766,
-32770,
-32763,
-32772,
-32760,
-32774,
-32762,
-32770,
-32765,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32769,
 32767,
-32766,
-32769,
-32764,
-32769,
 32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32769,
 32767,
-32766,
-32769,
-32764,
-32769,
-32766,
-32768,
 32767,
-32766,
 32767,
 32767,
-32768,
 32767,
-32766,
-32768,
-32765,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32769,
 32767,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32766,
 32767,
 32767,
 32767,
@@ -2904,482 +540,97 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32765,
-32770,
-32763,
-32771,
-32765,
 32767,
-32768,
-32765,
-32769,
 32767,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
 32767,
-32766,
 32767,
-32768,
-32766,
-32769,
-32764,
-32769,
-32766,
-32768,
-32766,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
 32767,
 32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32765,
-32770,
-32765,
 32767,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32763,
-32771,
-32765,
 32767,
-32768,
-32766,
 32767,
-32769,
-32764,
-32768,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32769,
-32764,
-32769,
 32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32771,
-32763,
-32770,
-32764,
-32769,
 32767,
-32766,
-32769,
-32763,
-32772,
-32762,
-32772,
-32764,
-32766,
-32771,
-32762,
-32772,
-32764,
 32767,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
-32768,
-32764,
-32770,
-32766,
 32767,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32768,
-32768,
-32764,
-32769,
 32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
 32767,
 32767,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32771,
-32763,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32770,
-32763,
-32771,
-32764,
-32768,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
 32767,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
 32767,
-32766,
-32769,
-32764,
-32771,
-32764,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32768,
-32768,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
 32767,
-32768,
-32765,
-32771,
-32762,
-32772,
-32763,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
 32767,
-32765,
-32770,
-32764,
-32769,
 32767,
-32766,
-32768,
 32767,
-32766,
 32767,
-32768,
 32767,
 32767,
 32767,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
-32768,
-32764,
-32771,
-32763,
-32771,
-32764,
-32769,
-32765,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32763,
-32771,
-32763,
-32771,
-32764,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32768,
 32767,
-32766,
-32769,
-32766,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
 32767,
-32766,
-32768,
-32766,
-32769,
-32766,
 32767,
 32767,
 32767,
@@ -3388,81 +639,16 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
 32767,
-32769,
-32764,
-32769,
 32767,
-32766,
-32768,
 32767,
-32765,
-32770,
-32764,
-32771,
-32763,
-32770,
-32764,
-32770,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
 32767,
-32764,
-32771,
-32764,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
@@ -3471,1114 +657,193 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32765,
 32767,
-32768,
 32767,
-32766,
-32769,
-32763,
-32771,
-32765,
-32768,
 32767,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32763,
-32771,
-32763,
-32771,
-32764,
-32769,
-32765,
-32769,
-32765,
-32770,
-32764,
-32768,
-32769,
-32763,
-32772,
-32762,
-32771,
-32764,
-32770,
-32763,
-32771,
-32765,
 32767,
-32768,
-32765,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
 32767,
-32766,
-32769,
-32763,
-32772,
-32763,
-32770,
-32765,
 32767,
-32768,
 32767,
 32767,
 32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32769,
-32764,
-32771,
-32762,
-32772,
-32764,
-32768,
-32768,
-32764,
-32770,
-32765,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
-32766,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32769,
 32767,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32764,
-32771,
-32762,
-32772,
-32763,
-32769,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
 32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32771,
-32763,
-32770,
-32765,
-32768,
-32768,
-32764,
-32771,
-32762,
-32773,
-32761,
-32772,
-32763,
-32769,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
-32769,
-32764,
-32769,
-32766,
 32767,
-32769,
-32763,
-32772,
-32762,
-32772,
-32762,
-32771,
-32764,
-32770,
-32764,
-32770,
-32765,
 32767,
-32769,
-32763,
-32772,
-32763,
-32769,
 32767,
-32765,
-32771,
-32761,
-32773,
-32762,
-32770,
 32767,
-32764,
-32771,
-32764,
-32768,
-32768,
-32765,
-32770,
-32764,
-32769,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32769,
-32766,
-32768,
 32767,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32765,
-32769,
-32764,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
 32767,
-32769,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32768,
-32768,
-32764,
-32771,
-32763,
-32770,
-32765,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
 32767,
-32765,
-32771,
-32762,
-32771,
-32764,
-32770,
-32765,
-32768,
-32766,
 32767,
-32768,
 32767,
 32767,
-32766,
 32767,
-32769,
-32764,
-32771,
-32762,
-32771,
-32765,
-32768,
 32767,
-32765,
-32770,
-32764,
-32770,
-32765,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32765,
 32767,
-32768,
-32766,
-32769,
-32765,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32771,
-32764,
-32768,
 32767,
 32767,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
 32767,
-32769,
-32764,
-32769,
-32766,
-32768,
 32767,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
 32767,
-32765,
-32770,
-32763,
-32771,
-32764,
-32768,
-32768,
-32765,
-32768,
-32768,
-32764,
-32770,
-32765,
-32768,
 32767,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
 32767,
-32766,
-32770,
-32762,
-32773,
-32762,
-32771,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
 32767,
 32767,
 32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
 32767,
-32765,
-32771,
-32763,
-32769,
-32768,
-32764,
-32770,
-32765,
 32767,
-32769,
-32765,
 32767,
-32769,
-32764,
-32770,
-32766,
-32766,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
 32767,
-32765,
-32771,
-32762,
-32772,
-32764,
-32768,
 32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32771,
-32764,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32766,
 32767,
-32766,
-32768,
-32766,
-32769,
-32766,
-32766,
-32768,
 32767,
 32767,
 32767,
 32767,
 32767,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
-32768,
-32765,
-32769,
 32767,
-32766,
-32768,
-32766,
 32767,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
 32767,
-32766,
 32767,
 32767,
-32768,
-32766,
-32768,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
-32766,
-32769,
-32764,
-32771,
-32764,
-32768,
 32767,
-32766,
-32769,
-32766,
-32766,
-32768,
-32766,
-32768,
 32767,
 32767,
-32765,
-32769,
 32767,
-32766,
-32769,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32764,
-32771,
-32764,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32768,
-32766,
-32770,
-32762,
-32772,
-32763,
-32770,
-32766,
-32766,
-32768,
 32767,
 32767,
-32768,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32769,
-32766,
-32768,
 32767,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32765,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
-32769,
-32764,
-32770,
-32765,
 32767,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
 32767,
-32766,
-32768,
-32768,
-32764,
-32772,
-32760,
-32774,
-32761,
-32772,
-32764,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
 32767,
-32769,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
 32767,
-32769,
-32764,
-32770,
-32764,
-32769,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32771,
-32763,
-32771,
-32764,
-32768,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
 32767,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32769,
-32764,
-32769,
 32767,
-32765,
-32771,
-32762,
-32772,
-32763,
-32770,
-32765,
-32768,
 32767,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32769,
-32763,
-32771,
-32764,
-32769,
-32766,
 32767,
 32767,
 32767,
@@ -4592,305 +857,61 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
-32766,
-32769,
-32764,
-32771,
-32764,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32769,
 32767,
-32765,
-32771,
-32762,
-32771,
-32765,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32766,
-32766,
-32770,
-32762,
-32772,
-32764,
-32768,
-32768,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
 32767,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32769,
 32767,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
 32767,
-32766,
-32769,
-32764,
-32771,
-32764,
-32768,
-32768,
-32764,
-32772,
-32761,
-32773,
-32763,
-32768,
-32769,
-32763,
-32772,
-32762,
-32770,
 32767,
-32765,
-32770,
-32764,
-32768,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32763,
-32771,
-32763,
-32770,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
-32768,
-32764,
-32771,
-32764,
-32769,
-32766,
 32767,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
 32767,
 32767,
-32766,
-32768,
 32767,
 32767,
-32768,
-32764,
-32770,
-32764,
-32771,
-32763,
-32771,
-32762,
-32772,
-32763,
-32771,
-32763,
-32770,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
 32767,
-32769,
-32764,
-32771,
-32762,
-32771,
-32765,
-32768,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32769,
-32764,
-32771,
-32763,
-32769,
-32768,
-32764,
-32770,
-32765,
-32768,
 32767,
 32767,
-32766,
-32768,
 32767,
 32767,
 32767,
@@ -4899,192 +920,40 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32765,
-32771,
-32761,
-32773,
-32762,
-32771,
-32764,
-32769,
-32765,
-32768,
-32768,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
 32767,
-32768,
-32766,
-32769,
-32765,
-32768,
-32765,
-32770,
-32766,
 32767,
-32766,
-32768,
-32766,
-32769,
-32766,
-32766,
-32769,
-32764,
-32770,
-32766,
 32767,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32769,
-32764,
-32770,
-32765,
 32767,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32765,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32769,
-32764,
-32770,
-32764,
-32769,
 32767,
-32766,
-32768,
 32767,
-32765,
-32771,
-32762,
-32772,
-32763,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32765,
 32767,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
 32767,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
 32767,
 32767,
-32766,
-32768,
 32767,
 32767,
 32767,
@@ -5094,707 +963,100 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32765,
 32767,
-32768,
-32766,
 32767,
-32769,
-32764,
-32770,
-32764,
-32769,
-32766,
-32769,
-32764,
-32770,
-32765,
 32767,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
 32767,
 32767,
 32767,
-32766,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
-32768,
-32764,
-32772,
-32762,
-32771,
-32764,
-32769,
-32766,
 32767,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32765,
-32770,
-32763,
-32772,
-32762,
-32770,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32768,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32765,
-32771,
-32764,
-32768,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32766,
-32766,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
 32767,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
-32769,
-32763,
-32772,
-32762,
-32772,
-32763,
-32770,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
-32768,
-32765,
-32770,
-32763,
-32772,
-32762,
-32772,
-32763,
-32769,
 32767,
-32765,
-32770,
-32765,
-32768,
-32766,
 32767,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
 32767,
-32768,
-32765,
-32771,
-32763,
-32769,
-32766,
 32767,
-32768,
-32766,
-32768,
 32767,
-32765,
-32770,
-32763,
-32771,
-32765,
 32767,
 32767,
-32768,
-32764,
-32772,
-32761,
-32773,
-32762,
-32771,
-32764,
-32769,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32765,
-32769,
-32764,
-32771,
-32764,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32763,
-32771,
-32764,
-32770,
-32764,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32768,
-32768,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
 32767,
-32765,
-32769,
-32764,
-32771,
-32764,
-32769,
-32764,
-32770,
-32765,
-32769,
-32764,
-32769,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32769,
-32763,
-32772,
-32763,
-32770,
-32765,
-32768,
-32766,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32768,
-32768,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
 32767,
-32766,
-32768,
 32767,
 32767,
-32766,
-32768,
-32765,
-32770,
-32765,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32765,
-32768,
 32767,
-32765,
-32770,
-32765,
-32768,
 32767,
 32767,
-32765,
-32771,
-32761,
-32774,
-32761,
-32771,
-32764,
-32769,
-32765,
-32769,
-32766,
-32766,
-32770,
-32762,
-32773,
-32762,
-32769,
-32768,
-32764,
-32771,
-32763,
-32770,
-32765,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
 32767,
-32769,
-32764,
-32771,
-32763,
-32769,
 32767,
 32767,
-32766,
-32770,
-32763,
-32770,
-32765,
-32768,
-32768,
-32765,
-32768,
-32766,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32765,
-32770,
-32765,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
@@ -5802,114 +1064,22 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32768,
-32764,
-32772,
-32761,
-32773,
-32762,
-32770,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32768,
 32767,
 32767,
-32768,
-32765,
-32769,
-32764,
-32771,
-32763,
-32771,
-32763,
-32770,
-32764,
-32771,
-32763,
-32770,
-32765,
 32767,
-32769,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
-32765,
-32771,
-32762,
-32772,
-32763,
-32770,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
 32767,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32763,
-32771,
-32763,
-32770,
-32765,
-32769,
-32766,
 32767,
-32766,
-32769,
-32766,
 32767,
 32767,
 32767,
@@ -5918,56 +1088,15 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
-32768,
-32765,
-32770,
-32764,
-32768,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32766,
-32770,
-32763,
-32771,
-32764,
-32768,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
@@ -5982,334 +1111,52 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32768,
-32764,
-32772,
-32761,
-32773,
-32762,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32765,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32771,
-32764,
-32768,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32768,
 32767,
-32766,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
 32767,
-32766,
-32769,
-32765,
-32770,
-32763,
-32770,
-32764,
-32771,
-32764,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32769,
 32767,
 32767,
-32766,
-32768,
-32766,
 32767,
-32769,
-32764,
-32770,
-32765,
 32767,
-32768,
-32765,
-32771,
-32762,
-32772,
-32763,
-32769,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32768,
-32768,
-32764,
-32771,
-32763,
-32770,
-32765,
-32769,
-32765,
-32768,
-32766,
-32768,
 32767,
 32767,
-32765,
-32771,
-32762,
-32771,
-32766,
-32765,
-32771,
-32762,
-32772,
-32763,
-32769,
-32768,
-32764,
-32771,
-32763,
-32770,
-32765,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32766,
-32766,
-32770,
-32763,
-32770,
-32766,
-32766,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32762,
-32773,
-32761,
-32772,
-32762,
-32771,
-32765,
-32768,
-32766,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32770,
-32764,
-32768,
 32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
 32767,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32765,
-32768,
-32766,
 32767,
-32768,
 32767,
 32767,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32769,
-32763,
-32772,
-32762,
-32772,
-32763,
-32770,
-32764,
-32770,
-32765,
-32769,
-32764,
-32770,
-32765,
 32767,
-32770,
-32761,
-32773,
-32762,
-32771,
-32765,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
@@ -6318,469 +1165,88 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
-32766,
-32770,
-32763,
-32771,
-32764,
-32768,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
 32767,
-32768,
-32764,
-32771,
-32763,
-32770,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32768,
 32767,
-32768,
-32765,
-32771,
-32761,
-32773,
-32763,
-32769,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
 32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32770,
-32763,
-32772,
-32762,
-32770,
 32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32769,
-32764,
-32769,
-32765,
-32770,
-32765,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
 32767,
 32767,
-32766,
-32768,
 32767,
-32766,
-32770,
-32762,
-32772,
-32763,
-32770,
-32765,
-32768,
-32766,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
 32767,
-32766,
-32769,
-32764,
-32770,
-32766,
-32765,
-32771,
-32762,
-32772,
-32764,
 32767,
-32768,
-32766,
-32768,
 32767,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32769,
-32763,
-32771,
-32764,
-32769,
-32766,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32768,
-32765,
-32770,
-32763,
-32772,
-32762,
-32772,
-32762,
-32771,
-32764,
-32770,
-32765,
 32767,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
 32767,
 32767,
-32765,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
-32765,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32765,
-32769,
-32764,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
 32767,
-32769,
-32764,
-32770,
-32764,
-32769,
 32767,
-32766,
-32768,
-32766,
 32767,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32766,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
 32767,
-32766,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32770,
-32763,
-32770,
-32765,
-32768,
-32768,
-32764,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32770,
-32763,
-32771,
-32763,
-32771,
-32764,
-32769,
-32766,
 32767,
 32767,
 32767,
@@ -6793,43 +1259,9 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
-32769,
-32764,
-32769,
 32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
@@ -6838,260 +1270,37 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32765,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32770,
-32763,
-32770,
-32765,
-32770,
-32764,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32770,
-32763,
-32772,
-32760,
-32774,
-32762,
-32770,
-32766,
-32766,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32763,
-32770,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32766,
-32766,
-32769,
-32766,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
 32767,
-32769,
-32765,
 32767,
-32768,
-32766,
-32769,
-32765,
-32769,
-32764,
-32771,
-32764,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32768,
-32768,
-32765,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
 32767,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32770,
-32763,
-32770,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32769,
-32764,
-32769,
-32766,
 32767,
-32768,
 32767,
-32765,
-32770,
-32763,
-32771,
-32764,
-32770,
-32765,
 32767,
-32768,
-32766,
-32768,
 32767,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
 32767,
 32767,
@@ -7102,331 +1311,65 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32771,
-32762,
-32772,
-32762,
-32771,
-32764,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
 32767,
-32769,
-32763,
-32772,
-32763,
-32769,
 32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32765,
-32769,
-32764,
-32771,
-32762,
-32773,
-32761,
-32772,
-32763,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32769,
-32764,
-32770,
-32764,
-32769,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
 32767,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
 32767,
-32765,
-32770,
-32764,
-32769,
 32767,
-32766,
 32767,
-32768,
-32765,
-32771,
-32762,
-32771,
-32764,
-32769,
 32767,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
 32767,
-32768,
 32767,
-32766,
-32769,
-32764,
-32769,
 32767,
 32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
 32767,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32763,
-32770,
-32766,
-32766,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
 32767,
-32766,
 32767,
-32768,
 32767,
 32767,
-32766,
 32767,
-32769,
-32765,
-32769,
-32765,
 32767,
-32769,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
-32765,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32769,
 32767,
-32766,
 32767,
 32767,
 32767,
-32768,
-32766,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
 32767,
-32768,
-32764,
-32771,
-32762,
-32772,
-32764,
-32768,
 32767,
 32767,
-32766,
-32768,
 32767,
 32767,
 32767,
 32767,
 32767,
 32767,
-32768,
-32764,
-32771,
-32764,
-32769,
-32766,
 32767,
 32767,
 32767,
@@ -7441,84 +1384,23 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32766,
-32769,
-32766,
 32767,
-32766,
-32769,
-32765,
-32770,
-32764,
-32768,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
 32767,
-32766,
-32770,
-32763,
-32771,
-32764,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
@@ -7531,442 +1413,71 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32766,
-32770,
-32763,
-32772,
-32761,
-32772,
-32764,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
-32768,
-32765,
-32769,
-32766,
-32766,
-32771,
-32762,
-32771,
-32763,
-32771,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
 32767,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
 32767,
 32767,
-32768,
-32765,
-32771,
-32761,
-32773,
-32762,
-32770,
-32766,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
 32767,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
 32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
 32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32765,
-32771,
-32762,
-32771,
-32764,
-32768,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32770,
-32765,
-32768,
 32767,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32769,
-32764,
-32770,
-32763,
-32771,
-32765,
-32768,
 32767,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32765,
 32767,
-32768,
-32765,
-32770,
-32765,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32766,
-32769,
-32766,
-32768,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32765,
 32767,
-32768,
-32765,
-32769,
 32767,
-32765,
-32770,
-32763,
-32771,
-32765,
 32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
 32767,
 32767,
-32768,
-32766,
 32767,
-32768,
-32764,
-32772,
-32762,
-32771,
-32764,
-32769,
-32766,
-32768,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
 32767,
-32768,
-32766,
-32768,
 32767,
-32766,
 32767,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32769,
-32763,
-32772,
-32763,
-32770,
-32765,
-32768,
 32767,
-32766,
-32769,
-32764,
-32771,
-32762,
-32772,
-32763,
-32770,
-32764,
-32769,
-32766,
-32769,
-32764,
-32770,
-32763,
-32772,
-32763,
-32770,
-32764,
-32769,
-32766,
-32769,
-32764,
-32769,
-32766,
-32768,
-32766,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
@@ -7977,95 +1488,23 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
 32767,
-32766,
-32770,
-32764,
-32769,
-32766,
-32766,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32770,
-32763,
-32771,
-32763,
-32770,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32765,
-32770,
-32763,
-32771,
-32765,
 32767,
 32767,
 32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32768,
 32767,
 32767,
 32767,
@@ -8074,667 +1513,148 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32771,
-32762,
-32772,
-32763,
-32769,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
 32767,
-32768,
-32765,
-32770,
-32765,
 32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32769,
 32767,
-32765,
-32770,
-32764,
-32769,
 32767,
-32766,
 32767,
-32768,
-32766,
-32769,
-32764,
-32769,
-32765,
-32770,
-32765,
-32768,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32771,
-32763,
-32771,
-32763,
-32770,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32769,
-32765,
-32770,
-32763,
-32772,
-32762,
-32770,
-32766,
 32767,
-32768,
 32767,
-32765,
-32769,
-32766,
 32767,
-32768,
-32766,
-32766,
-32769,
-32766,
 32767,
-32768,
-32765,
-32768,
 32767,
 32767,
-32768,
-32766,
 32767,
-32766,
-32769,
-32765,
-32770,
-32763,
-32771,
-32763,
-32770,
-32765,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32771,
-32764,
-32769,
-32765,
-32768,
 32767,
-32768,
-32766,
-32766,
-32769,
-32765,
-32770,
-32763,
-32770,
-32766,
-32766,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
 32767,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32770,
-32762,
-32772,
-32763,
-32769,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32765,
-32771,
-32762,
-32772,
-32763,
-32769,
 32767,
-32766,
-32769,
-32765,
 32767,
-32769,
-32764,
-32771,
-32764,
 32767,
-32769,
-32764,
-32771,
-32764,
-32768,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
 32767,
-32768,
-32766,
-32768,
-32765,
-32768,
-32768,
-32765,
-32770,
-32762,
-32773,
-32761,
-32772,
-32764,
-32769,
-32765,
-32768,
 32767,
-32766,
-32770,
-32763,
-32770,
-32765,
-32768,
 32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
 32767,
-32769,
-32765,
-32769,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32765,
 32767,
-32768,
-32766,
-32768,
 32767,
 32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
 32767,
 32767,
-32766,
-32768,
 32767,
-32766,
-32770,
-32762,
-32773,
-32761,
-32772,
-32764,
-32769,
-32766,
 32767,
 32767,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
-32769,
-32765,
-32768,
-32766,
-32768,
 32767,
 32767,
-32766,
-32768,
 32767,
 32767,
 32767,
-32766,
-32768,
 32767,
 32767,
-32766,
-32768,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32770,
-32763,
-32770,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32769,
 32767,
-32765,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
 32767,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32766,
-32766,
-32769,
-32766,
-32766,
-32771,
-32761,
-32772,
-32764,
-32768,
 32767,
-32768,
-32765,
-32770,
-32764,
-32768,
-32768,
-32765,
-32770,
-32765,
 32767,
 32767,
 32767,
-32768,
-32766,
 32767,
 32767,
 32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32768,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
 32767,
-32766,
-32769,
-32764,
-32769,
 32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32766,
 32767,
-32766,
-32769,
-32765,
-32770,
-32763,
-32770,
-32764,
-32771,
-32763,
-32770,
-32765,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
 32767,
 32767,
-32766,
-32768,
 32767,
 32767,
 32767,
-32766,
-32768,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32769,
-32764,
-32771,
-32763,
-32770,
-32766,
 32767,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
@@ -8742,549 +1662,117 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32764,
-32771,
-32762,
-32772,
-32763,
-32769,
 32767,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
 32767,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
 32767,
 32767,
-32768,
-32766,
-32766,
-32769,
-32765,
-32770,
-32765,
 32767,
 32767,
-32768,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32768,
 32767,
 32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32769,
 32767,
-32765,
-32771,
-32762,
-32771,
-32764,
-32770,
-32764,
-32771,
-32762,
-32772,
-32763,
-32769,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32763,
-32772,
-32762,
-32771,
-32765,
 32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
 32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32768,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32765,
-32768,
 32767,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
 32767,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32765,
-32771,
-32761,
-32773,
-32762,
-32771,
-32764,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32764,
-32770,
-32766,
 32767,
 32767,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32769,
 32767,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32766,
-32766,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
-32768,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
 32767,
-32765,
-32770,
-32763,
-32771,
-32764,
-32770,
-32763,
-32770,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
 32767,
 32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32768,
 32767,
 32767,
-32768,
-32766,
 32767,
 32767,
 32767,
-32768,
-32766,
 32767,
 32767,
-32768,
-32766,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
-32765,
-32770,
-32764,
-32770,
-32765,
 32767,
 32767,
-32768,
 32767,
-32766,
 32767,
 32767,
-32768,
 32767,
-32765,
-32770,
-32763,
-32772,
-32762,
-32771,
-32764,
-32769,
-32766,
 32767,
-32768,
-32764,
-32772,
-32762,
-32772,
-32762,
-32770,
 32767,
-32766,
-32768,
-32766,
 32767,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
 32767,
-32766,
-32769,
-32764,
-32770,
-32766,
-32766,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
 32767,
-32765,
-32770,
-32763,
-32771,
-32764,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
 32767,
 32767,
 32767,
-32768,
-32766,
 32767,
 32767,
 32767,
@@ -9300,763 +1788,130 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32768,
-32766,
-32770,
-32763,
-32770,
-32764,
-32769,
 32767,
 32767,
-32766,
-32768,
-32766,
 32767,
-32768,
 32767,
-32765,
-32771,
-32762,
-32771,
-32766,
-32765,
-32770,
-32765,
-32768,
 32767,
 32767,
-32765,
-32771,
-32762,
-32772,
-32763,
-32769,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32769,
-32763,
-32772,
-32763,
-32769,
 32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
 32767,
 32767,
 32767,
-32766,
-32768,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32768,
 32767,
-32768,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32766,
-32769,
-32766,
-32766,
-32768,
 32767,
-32766,
-32770,
-32763,
-32770,
-32765,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32763,
-32772,
-32761,
-32774,
-32760,
-32772,
-32764,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
-32769,
-32765,
 32767,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
 32767,
-32765,
-32770,
-32765,
 32767,
-32769,
-32763,
-32772,
-32763,
-32769,
 32767,
-32766,
-32768,
 32767,
-32765,
-32771,
-32763,
-32770,
-32765,
-32768,
 32767,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32769,
-32764,
-32770,
-32764,
-32771,
-32764,
-32768,
-32768,
-32764,
-32771,
-32764,
-32769,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32763,
-32771,
-32764,
-32769,
-32765,
-32768,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
 32767,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32768,
-32768,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32770,
-32766,
-32766,
-32770,
-32763,
-32771,
-32764,
-32768,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
 32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32769,
 32767,
-32765,
-32770,
-32763,
-32770,
-32766,
-32766,
-32769,
-32765,
 32767,
-32770,
-32762,
-32772,
-32763,
-32769,
 32767,
-32766,
-32769,
-32765,
 32767,
-32768,
-32766,
-32769,
-32765,
-32768,
-32765,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32765,
-32769,
-32764,
-32770,
-32766,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32768,
-32768,
-32766,
-32768,
 32767,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
 32767,
-32765,
-32771,
-32762,
-32773,
-32761,
-32771,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
 32767,
 32767,
-32766,
-32768,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32771,
-32763,
-32770,
-32765,
-32768,
 32767,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
-32766,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
 32767,
 32767,
-32768,
-32766,
 32767,
 32767,
 32767,
-32768,
-32766,
 32767,
 32767,
-32768,
-32765,
-32771,
-32762,
-32771,
-32765,
 32767,
-32768,
 32767,
-32766,
-32769,
-32764,
-32769,
-32766,
-32768,
-32766,
-32769,
-32763,
-32771,
-32764,
-32769,
 32767,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32763,
-32772,
-32762,
-32772,
-32762,
-32772,
-32762,
-32772,
-32762,
-32772,
-32763,
-32769,
 32767,
-32766,
-32768,
 32767,
-32765,
-32771,
-32763,
-32769,
-32768,
-32764,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32764,
-32771,
-32763,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32769,
 32767,
 32767,
-32766,
-32769,
-32763,
-32773,
-32761,
-32771,
-32765,
-32768,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32762,
-32772,
-32763,
-32769,
 32767,
-32766,
-32768,
-32766,
 32767,
 32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
 32767,
 32767,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
 32767,
 32767,
-32766,
-32770,
-32763,
-32770,
-32765,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
-32768,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32770,
-32762,
-32773,
-32762,
-32771,
-32763,
-32770,
-32765,
-32769,
-32766,
-32766,
-32768,
-32766,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32764,
-32771,
-32764,
-32769,
-32765,
-32768,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32765,
-32769,
-32765,
-32770,
-32763,
-32770,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
@@ -10066,79 +1921,18 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32770,
-32764,
-32769,
-32766,
-32766,
-32770,
-32764,
-32768,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32769,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32771,
-32763,
-32771,
-32763,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
-32768,
-32765,
-32769,
-32764,
-32770,
-32766,
 32767,
 32767,
-32766,
-32768,
 32767,
 32767,
 32767,
@@ -10146,114 +1940,21 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32765,
 32767,
-32769,
-32763,
-32771,
-32765,
 32767,
-32769,
-32764,
-32769,
-32766,
 32767,
-32769,
-32764,
-32770,
-32764,
-32769,
 32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
 32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32771,
-32763,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32770,
-32763,
-32771,
-32764,
-32768,
 32767,
-32768,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
@@ -10271,655 +1972,106 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32771,
-32763,
-32770,
-32765,
-32768,
-32768,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32765,
-32770,
-32763,
-32771,
-32763,
-32771,
-32763,
-32770,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32766,
-32766,
-32769,
-32766,
 32767,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
 32767,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32764,
-32771,
-32763,
-32771,
-32763,
-32771,
-32763,
-32770,
-32766,
 32767,
-32768,
-32765,
-32768,
-32768,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
-32766,
-32769,
-32766,
 32767,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32765,
-32770,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
-32768,
-32764,
-32770,
-32764,
-32770,
-32766,
-32766,
-32769,
-32763,
-32772,
-32763,
-32770,
-32765,
 32767,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
 32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32765,
 32767,
-32768,
-32766,
 32767,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32770,
-32762,
-32773,
-32760,
-32774,
-32762,
-32769,
-32768,
-32765,
-32769,
-32766,
-32766,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32766,
-32766,
-32770,
-32763,
-32772,
-32762,
-32771,
-32764,
-32769,
 32767,
-32765,
-32770,
-32764,
-32769,
 32767,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
 32767,
-32768,
 32767,
-32766,
-32768,
-32765,
-32770,
-32764,
-32771,
-32762,
-32771,
-32765,
 32767,
-32769,
-32764,
-32769,
 32767,
-32766,
 32767,
-32768,
-32766,
-32768,
 32767,
-32765,
-32769,
 32767,
-32766,
-32768,
-32766,
 32767,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
 32767,
-32768,
-32766,
-32768,
 32767,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32768,
 32767,
 32767,
 32767,
-32768,
-32764,
-32771,
-32762,
-32773,
-32761,
-32772,
-32763,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32769,
-32764,
-32769,
-32766,
 32767,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
 32767,
-32769,
-32764,
-32770,
-32764,
-32769,
 32767,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32770,
-32763,
-32770,
-32765,
-32768,
-32768,
-32764,
-32771,
-32762,
-32772,
-32764,
-32768,
-32766,
-32769,
-32763,
-32773,
-32760,
-32773,
-32763,
-32769,
-32766,
 32767,
 32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
 32767,
-32769,
-32763,
-32771,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32769,
-32764,
-32769,
-32765,
-32770,
-32764,
-32771,
-32762,
-32771,
-32764,
-32770,
-32764,
-32771,
-32762,
-32772,
-32762,
-32771,
-32765,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32769,
-32763,
-32772,
-32762,
-32771,
-32764,
-32769,
 32767,
-32765,
-32769,
-32765,
-32769,
 32767,
-32766,
 32767,
-32768,
-32765,
-32770,
-32765,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
 32767,
 32767,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32765,
-32771,
-32762,
-32771,
-32764,
-32769,
 32767,
-32766,
 32767,
 32767,
 32767,
-32768,
-32766,
 32767,
 32767,
 32767,
@@ -10933,749 +2085,131 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
 32767,
 32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
 32767,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32769,
-32764,
-32770,
-32764,
-32769,
 32767,
-32766,
-32769,
-32763,
-32772,
-32763,
-32769,
 32767,
-32766,
-32769,
-32765,
-32768,
-32765,
-32770,
-32765,
-32768,
 32767,
-32766,
 32767,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32772,
-32761,
-32772,
-32764,
-32768,
-32768,
-32764,
-32771,
-32764,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
-32768,
-32764,
-32771,
-32764,
-32769,
-32766,
 32767,
 32767,
-32768,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32771,
-32764,
-32769,
-32765,
-32769,
-32765,
-32769,
 32767,
-32766,
 32767,
 32767,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32770,
-32763,
-32772,
-32762,
-32771,
-32765,
-32768,
 32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
 32767,
-32769,
-32764,
-32770,
-32764,
-32769,
 32767,
-32766,
-32769,
-32764,
-32771,
-32762,
-32772,
-32763,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32768,
-32768,
-32766,
-32768,
-32766,
 32767,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32769,
-32766,
 32767,
-32769,
-32765,
 32767,
-32768,
-32765,
-32770,
-32765,
 32767,
-32768,
-32766,
 32767,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
 32767,
-32769,
-32764,
-32769,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32768,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
 32767,
-32768,
-32766,
 32767,
-32768,
-32764,
-32772,
-32762,
-32771,
-32764,
-32768,
 32767,
-32766,
-32770,
-32763,
-32770,
-32765,
-32768,
 32767,
 32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
-32768,
-32764,
-32772,
-32761,
-32772,
-32763,
-32771,
-32764,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
 32767,
-32765,
-32771,
-32761,
-32774,
-32761,
-32771,
-32764,
-32769,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
 32767,
-32769,
-32764,
-32770,
-32765,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
 32767,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32769,
-32764,
-32771,
-32763,
-32770,
-32766,
-32766,
-32770,
-32763,
-32770,
-32765,
-32768,
-32768,
-32764,
-32770,
-32765,
 32767,
-32770,
-32762,
-32771,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
 32767,
-32765,
-32769,
 32767,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
 32767,
-32768,
-32766,
-32769,
-32764,
-32769,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
-32766,
-32770,
-32763,
-32771,
-32764,
-32769,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32763,
-32772,
-32762,
-32771,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32771,
-32763,
-32769,
 32767,
-32765,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
 32767,
-32768,
-32766,
-32768,
 32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32769,
-32764,
-32769,
-32766,
 32767,
-32769,
-32765,
-32768,
-32766,
 32767,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
 32767,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
 32767,
-32768,
 32767,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
-32768,
-32765,
-32768,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32766,
 32767,
 32767,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32765,
 32767,
-32768,
-32765,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
 32767,
-32768,
 32767,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
@@ -11683,1015 +2217,185 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
 32767,
-32768,
-32765,
-32770,
-32765,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32770,
-32763,
-32770,
-32766,
 32767,
-32768,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32766,
 32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32769,
-32766,
-32768,
-32766,
-32769,
-32764,
-32769,
 32767,
-32765,
-32771,
-32763,
-32769,
 32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32766,
-32765,
-32771,
-32762,
-32772,
-32763,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
 32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32771,
-32763,
-32771,
-32763,
-32771,
-32764,
-32768,
-32768,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32769,
-32766,
-32769,
-32765,
-32768,
-32765,
-32769,
 32767,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32765,
-32771,
-32763,
-32770,
-32764,
-32771,
-32762,
-32771,
-32765,
 32767,
-32769,
-32765,
 32767,
-32768,
 32767,
-32766,
-32769,
-32764,
-32769,
 32767,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
 32767,
 32767,
-32766,
-32769,
-32764,
-32771,
-32764,
 32767,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32770,
-32764,
-32768,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32766,
 32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32770,
-32763,
-32770,
-32766,
-32766,
-32770,
-32763,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
 32767,
 32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32770,
-32764,
-32770,
-32763,
-32771,
-32765,
 32767,
-32769,
-32764,
-32769,
 32767,
-32765,
-32770,
-32765,
-32768,
-32766,
-32768,
-32765,
-32770,
-32765,
 32767,
-32769,
-32763,
-32771,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32765,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
-32768,
-32764,
-32771,
-32763,
-32770,
-32766,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
 32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32763,
-32772,
-32762,
-32772,
-32762,
-32771,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32765,
-32770,
-32763,
-32771,
-32765,
-32766,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
 32767,
-32765,
-32769,
-32766,
 32767,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
-32766,
-32770,
-32763,
-32770,
-32766,
-32766,
-32768,
 32767,
-32765,
-32772,
-32760,
-32774,
-32761,
-32771,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
 32767,
-32766,
-32768,
-32766,
-32769,
-32766,
 32767,
-32766,
-32769,
-32766,
 32767,
-32769,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32768,
-32768,
-32764,
-32771,
-32764,
 32767,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32768,
 32767,
 32767,
-32766,
-32769,
-32764,
-32770,
-32766,
-32766,
-32768,
-32766,
-32768,
 32767,
 32767,
 32767,
-32766,
-32768,
 32767,
 32767,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
-32768,
-32764,
-32771,
-32764,
-32769,
-32765,
-32769,
-32764,
-32772,
-32761,
-32772,
-32764,
-32768,
 32767,
-32766,
-32768,
 32767,
 32767,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32768,
-32764,
-32770,
-32765,
-32768,
 32767,
 32767,
 32767,
-32766,
-32768,
 32767,
 32767,
 32767,
-32766,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32765,
-32770,
-32765,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32765,
-32770,
-32764,
-32769,
 32767,
-32765,
-32771,
-32762,
-32771,
-32764,
-32769,
 32767,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
 32767,
 32767,
-32768,
-32766,
 32767,
-32766,
-32770,
-32763,
-32771,
-32763,
-32770,
-32766,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32770,
-32765,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
 32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
 32767,
-32768,
-32766,
-32768,
-32766,
-32766,
-32770,
-32763,
-32772,
-32762,
-32772,
-32762,
-32771,
-32765,
 32767,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32768,
-32764,
-32769,
 32767,
-32766,
-32769,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32766,
-32766,
-32769,
-32765,
-32770,
-32763,
-32771,
-32763,
-32771,
-32763,
-32771,
-32763,
-32770,
-32765,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32769,
 32767,
-32766,
-32768,
 32767,
-32765,
-32770,
-32764,
-32769,
 32767,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32770,
-32763,
-32770,
-32766,
-32766,
-32770,
-32764,
-32768,
 32767,
-32766,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
 32767,
 32767,
-32768,
-32766,
 32767,
 32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
 32767,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
 32767,
 32767,
@@ -12699,238 +2403,37 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32766,
-32768,
 32767,
 32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32768,
-32768,
-32764,
-32770,
-32765,
 32767,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32763,
-32771,
-32763,
-32772,
-32762,
-32770,
-32766,
-32766,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
 32767,
 32767,
-32768,
-32765,
-32770,
-32764,
-32768,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
 32767,
-32768,
-32765,
-32768,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32769,
-32764,
-32770,
-32764,
-32769,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
 32767,
-32766,
 32767,
 32767,
 32767,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
 32767,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32771,
-32763,
-32771,
-32764,
-32768,
-32768,
-32765,
-32770,
-32765,
-32766,
-32770,
-32763,
-32772,
-32763,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
@@ -12945,57 +2448,19 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32766,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32764,
-32771,
-32763,
-32771,
-32763,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
 32767,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
@@ -13008,1256 +2473,230 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
 32767,
-32769,
-32766,
-32766,
-32768,
-32766,
 32767,
-32770,
-32762,
-32772,
-32762,
-32771,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
 32767,
 32767,
 32767,
-32766,
-32769,
-32766,
 32767,
 32767,
-32766,
-32770,
-32764,
-32769,
-32765,
-32768,
-32768,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32765,
-32770,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
-32766,
-32769,
-32766,
 32767,
 32767,
-32766,
-32769,
-32766,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32765,
-32770,
-32763,
-32771,
-32764,
-32768,
-32768,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32768,
-32765,
-32768,
-32766,
-32769,
-32765,
-32769,
-32764,
-32770,
-32766,
-32766,
-32769,
-32764,
-32771,
-32764,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
-32768,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32770,
-32765,
-32768,
 32767,
 32767,
 32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
 32767,
 32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32765,
-32770,
-32765,
 32767,
-32768,
-32764,
-32772,
-32762,
-32771,
-32764,
-32768,
-32768,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32764,
-32771,
-32763,
-32771,
-32763,
-32770,
-32765,
-32768,
 32767,
 32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
 32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32768,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
 32767,
-32769,
-32764,
-32771,
-32763,
-32769,
 32767,
-32765,
-32771,
-32763,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32771,
-32762,
-32772,
-32762,
-32771,
-32765,
 32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
 32767,
-32765,
-32771,
-32762,
-32771,
-32765,
 32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32765,
-32770,
-32763,
-32771,
-32765,
 32767,
-32768,
-32765,
-32769,
 32767,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32769,
-32764,
-32769,
-32765,
-32769,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
 32767,
-32765,
-32769,
-32765,
-32770,
-32765,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32769,
-32764,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32769,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
 32767,
-32768,
 32767,
-32766,
-32769,
-32764,
-32769,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32768,
-32766,
 32767,
-32768,
 32767,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32765,
-32768,
 32767,
 32767,
-32768,
-32764,
-32771,
-32762,
-32773,
-32762,
-32770,
-32766,
-32765,
-32771,
-32763,
-32771,
-32763,
-32770,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32765,
-32771,
-32762,
-32772,
-32762,
-32771,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32769,
-32764,
-32771,
-32763,
-32771,
-32763,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32770,
-32764,
-32768,
-32768,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32770,
-32766,
-32766,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
 32767,
-32769,
-32764,
-32771,
-32763,
-32770,
-32764,
-32771,
-32763,
-32771,
-32763,
-32770,
-32765,
-32769,
-32765,
-32769,
-32764,
-32771,
-32763,
-32771,
-32763,
-32770,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32770,
-32763,
-32770,
-32765,
-32768,
 32767,
 32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32768,
-32768,
-32764,
-32772,
-32762,
-32769,
-32768,
-32765,
-32769,
-32766,
-32766,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
 32767,
-32765,
-32770,
-32764,
-32769,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32763,
-32770,
 32767,
-32764,
-32771,
-32763,
-32770,
-32766,
 32767,
-32766,
-32770,
-32763,
-32771,
-32764,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32765,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32768,
-32769,
-32763,
-32772,
-32762,
-32771,
-32764,
-32769,
 32767,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32765,
-32770,
-32763,
-32770,
-32766,
 32767,
 32767,
-32768,
-32765,
-32769,
-32766,
-32766,
-32769,
-32766,
-32766,
-32770,
-32762,
-32773,
-32762,
-32770,
-32766,
 32767,
 32767,
-32768,
-32764,
-32771,
-32763,
-32771,
-32764,
 32767,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32769,
 32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
 32767,
-32769,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32765,
 32767,
-32770,
-32762,
-32773,
-32761,
-32771,
-32765,
-32768,
 32767,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32765,
-32769,
-32764,
-32771,
-32762,
-32773,
-32762,
-32770,
-32766,
-32766,
-32769,
-32766,
-32766,
-32770,
-32763,
-32770,
-32766,
-32766,
-32768,
 32767,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
 32767,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
 32767,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
@@ -14272,1179 +2711,215 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
 32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
 32767,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
 32767,
-32766,
-32768,
 32767,
-32765,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32766,
-32766,
-32769,
-32764,
-32769,
 32767,
 32767,
 32767,
-32766,
 32767,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
 32767,
-32769,
-32764,
-32770,
-32765,
 32767,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32766,
 32767,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32768,
-32764,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32771,
-32763,
-32770,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32764,
-32771,
-32763,
-32771,
-32763,
-32770,
-32766,
-32766,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32768,
-32765,
-32769,
-32765,
-32770,
-32765,
 32767,
 32767,
 32767,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32770,
-32763,
-32771,
-32764,
-32768,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
 32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
-32768,
-32764,
-32771,
-32764,
-32769,
 32767,
-32765,
-32770,
-32763,
-32772,
-32762,
-32772,
-32763,
-32769,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32771,
-32762,
-32772,
-32762,
-32771,
-32765,
 32767,
-32769,
-32763,
-32772,
-32763,
-32769,
 32767,
-32765,
-32771,
-32763,
-32770,
-32765,
-32768,
-32766,
-32769,
-32765,
-32768,
 32767,
-32765,
-32771,
-32763,
-32769,
 32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
 32767,
 32767,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
 32767,
-32766,
-32768,
-32765,
-32770,
-32765,
-32768,
-32765,
-32770,
-32763,
-32772,
-32762,
-32771,
-32765,
-32766,
-32771,
-32761,
-32773,
-32762,
-32771,
-32764,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
 32767,
 32767,
-32768,
-32766,
 32767,
 32767,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
 32767,
 32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
 32767,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
 32767,
-32766,
-32768,
 32767,
-32765,
-32771,
-32763,
-32770,
-32765,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32765,
-32770,
-32763,
-32772,
-32763,
-32769,
 32767,
-32765,
-32769,
-32766,
 32767,
-32769,
-32764,
-32769,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
 32767,
-32766,
-32768,
 32767,
 32767,
 32767,
-32766,
-32768,
 32767,
 32767,
 32767,
 32767,
 32767,
 32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
 32767,
-32765,
-32769,
-32765,
-32770,
-32765,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
 32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32769,
-32765,
 32767,
-32770,
-32762,
-32772,
-32763,
-32769,
 32767,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32769,
-32764,
-32770,
-32765,
-32768,
-32768,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32763,
-32772,
-32762,
-32772,
-32763,
-32769,
-32766,
 32767,
-32768,
 32767,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32769,
 32767,
-32766,
-32768,
-32766,
 32767,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
 32767,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32769,
-32766,
 32767,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
 32767,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
 32767,
-32768,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32771,
-32764,
-32769,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
 32767,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
-32768,
-32765,
-32768,
-32766,
-32768,
 32767,
 32767,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32765,
-32768,
 32767,
-32765,
-32770,
-32766,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
 32767,
 32767,
-32766,
-32768,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32769,
-32765,
-32770,
-32763,
-32771,
-32765,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32765,
-32768,
 32767,
 32767,
-32768,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32768,
-32765,
-32768,
 32767,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32770,
-32763,
-32770,
-32766,
-32766,
-32770,
-32763,
-32771,
-32763,
-32770,
-32766,
 32767,
 32767,
 32767,
-32766,
-32769,
-32766,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32768,
-32768,
-32765,
-32768,
 32767,
 32767,
 32767,
-32768,
-32765,
-32768,
-32768,
-32765,
-32770,
-32763,
-32770,
-32766,
 32767,
-32768,
-32765,
-32769,
-32765,
-32770,
-32763,
-32771,
-32764,
-32768,
-32768,
-32766,
-32766,
-32769,
-32765,
-32768,
-32769,
-32762,
-32772,
-32763,
-32770,
-32766,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32768,
 32767,
-32768,
-32766,
 32767,
 32767,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
 32767,
 32767,
-32768,
-32764,
-32770,
-32765,
-32769,
-32766,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
 32767,
-32766,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32769,
-32763,
-32772,
-32762,
-32771,
-32765,
-32768,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
 32767,
-32766,
-32768,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
@@ -15453,95 +2928,19 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
 32767,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
 32767,
-32765,
-32771,
-32763,
-32770,
-32765,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
 32767,
-32766,
-32770,
-32762,
-32771,
-32765,
-32768,
 32767,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32766,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
@@ -15549,1328 +2948,234 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
 32767,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32769,
-32766,
-32769,
-32765,
-32768,
-32766,
 32767,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32771,
-32762,
-32772,
-32763,
-32770,
-32766,
-32766,
-32768,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32770,
-32763,
-32772,
-32763,
-32769,
 32767,
-32765,
-32771,
-32762,
-32772,
-32762,
-32771,
-32765,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
 32767,
-32769,
-32765,
-32768,
 32767,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32769,
-32764,
-32771,
-32762,
-32772,
-32763,
-32770,
-32765,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
 32767,
-32765,
-32769,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32766,
-32766,
-32770,
-32764,
-32768,
-32768,
-32765,
-32770,
-32764,
-32768,
 32767,
 32767,
-32768,
-32766,
 32767,
 32767,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32765,
 32767,
-32769,
-32764,
-32769,
 32767,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32766,
-32766,
-32770,
-32764,
-32770,
-32765,
 32767,
-32768,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
 32767,
-32769,
-32765,
-32768,
 32767,
-32765,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32769,
 32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32765,
-32770,
-32765,
-32766,
-32770,
-32764,
-32769,
 32767,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32763,
-32771,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32763,
-32771,
-32765,
 32767,
-32768,
-32765,
-32769,
 32767,
-32766,
-32768,
-32766,
 32767,
-32769,
-32764,
-32771,
-32762,
-32771,
-32765,
 32767,
-32769,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
 32767,
-32765,
-32770,
-32765,
-32768,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32766,
-32766,
-32770,
-32763,
-32770,
-32766,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
 32767,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32764,
-32771,
-32763,
-32771,
-32764,
-32768,
-32768,
-32764,
-32771,
-32763,
-32771,
-32764,
-32768,
-32768,
-32764,
-32771,
-32764,
-32768,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32766,
-32770,
-32764,
-32768,
-32768,
-32764,
-32771,
-32764,
-32768,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32769,
-32763,
-32771,
-32764,
-32768,
-32768,
-32766,
 32767,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
-32768,
-32764,
-32771,
-32763,
-32771,
-32764,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32769,
-32764,
-32770,
-32764,
-32769,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
 32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
 32767,
-32768,
-32765,
-32771,
-32762,
-32771,
-32764,
-32769,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32765,
-32770,
-32765,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32769,
-32764,
-32771,
-32763,
-32770,
-32766,
 32767,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32768,
-32768,
-32766,
 32767,
 32767,
-32766,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
 32767,
-32769,
-32764,
-32770,
-32765,
 32767,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
 32767,
-32766,
-32769,
-32764,
-32771,
-32764,
-32769,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32764,
-32771,
-32763,
-32771,
-32763,
-32770,
-32765,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
 32767,
-32769,
-32763,
-32772,
-32763,
-32770,
-32765,
 32767,
-32768,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32770,
-32764,
-32768,
-32768,
-32766,
-32768,
-32766,
 32767,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
 32767,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32769,
-32764,
-32769,
 32767,
-32765,
-32770,
-32765,
 32767,
-32769,
-32763,
-32771,
-32764,
-32768,
-32768,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32770,
-32765,
-32768,
-32768,
-32765,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
 32767,
-32769,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
 32767,
-32768,
-32765,
-32771,
-32762,
-32772,
-32762,
-32771,
-32765,
-32768,
 32767,
-32765,
-32770,
-32763,
-32772,
-32763,
-32769,
-32765,
-32769,
-32765,
-32770,
-32764,
-32768,
 32767,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32771,
-32762,
-32772,
-32764,
-32768,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32769,
-32764,
-32769,
 32767,
-32765,
-32771,
-32762,
-32771,
-32765,
-32768,
 32767,
-32766,
 32767,
-32768,
 32767,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32769,
-32765,
-32769,
-32764,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32765,
-32768,
 32767,
-32768,
-32765,
-32768,
-32768,
-32765,
-32770,
-32763,
-32770,
-32766,
 32767,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
 32767,
-32766,
-32768,
 32767,
 32767,
 32767,
-32766,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32771,
-32764,
-32768,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
-32766,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
 32767,
-32765,
-32769,
-32766,
 32767,
-32769,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
 32767,
 32767,
-32768,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32764,
-32771,
-32762,
-32772,
-32763,
-32769,
 32767,
-32765,
-32771,
-32762,
-32771,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
 32767,
-32769,
-32765,
-32768,
-32766,
 32767,
-32768,
 32767,
-32766,
-32768,
-32766,
 32767,
-32769,
-32765,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
 32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
-32766,
-32769,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32768,
 32767,
-32766,
-32770,
-32763,
-32770,
-32765,
-32768,
 32767,
 32767,
 32767,
@@ -16878,397 +3183,66 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32768,
-32766,
 32767,
 32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
-32768,
-32765,
-32770,
-32764,
-32768,
-32769,
-32763,
-32773,
-32760,
-32773,
-32763,
-32769,
-32766,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32769,
-32763,
-32772,
-32762,
-32771,
-32765,
-32768,
-32766,
 32767,
 32767,
 32767,
-32769,
-32764,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
-32768,
-32764,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
 32767,
-32770,
-32762,
-32772,
-32763,
-32771,
-32763,
-32770,
-32765,
-32768,
 32767,
-32768,
-32764,
-32771,
-32763,
-32770,
-32766,
 32767,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
 32767,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32771,
-32763,
-32771,
-32763,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32766,
-32768,
 32767,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32765,
-32770,
-32764,
-32770,
-32765,
 32767,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32764,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
 32767,
 32767,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32771,
-32762,
-32772,
-32762,
-32771,
-32765,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32768,
-32765,
-32768,
 32767,
-32766,
-32770,
-32764,
-32769,
-32765,
-32768,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
-32768,
-32765,
-32768,
 32767,
-32766,
-32769,
-32766,
 32767,
 32767,
 32767,
-32766,
-32770,
-32764,
-32769,
-32766,
-32766,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32765,
-32770,
-32763,
-32772,
-32762,
-32770,
 32767,
-32764,
-32772,
-32762,
-32770,
-32766,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32766,
-32766,
-32770,
-32765,
-32766,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
 32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32766,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32763,
-32771,
-32764,
-32768,
 32767,
 32767,
 32767,
@@ -17276,993 +3250,166 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32766,
 32767,
-32766,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
-32766,
-32769,
-32766,
 32767,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
-32766,
-32768,
-32766,
-32770,
-32763,
-32770,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32765,
 32767,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32766,
-32768,
-32768,
-32765,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
 32767,
-32768,
-32764,
-32772,
-32761,
-32772,
-32764,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
-32768,
-32765,
-32770,
-32764,
-32768,
-32769,
-32762,
-32773,
-32762,
-32771,
-32765,
 32767,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
-32768,
-32765,
-32770,
-32764,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32770,
-32762,
-32772,
-32763,
-32770,
-32766,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
 32767,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32764,
-32768,
 32767,
 32767,
 32767,
 32767,
 32767,
-32766,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32769,
-32766,
 32767,
-32769,
-32765,
 32767,
-32768,
-32765,
-32770,
-32765,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32765,
-32770,
-32764,
-32770,
-32765,
 32767,
-32768,
-32766,
-32768,
 32767,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32766,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32763,
-32770,
-32766,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32770,
-32764,
-32768,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32771,
-32762,
-32773,
-32761,
-32772,
-32764,
-32768,
-32766,
-32770,
-32763,
-32771,
-32764,
-32768,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32764,
-32771,
-32764,
-32769,
-32766,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32769,
-32763,
-32772,
-32763,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32765,
 32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32769,
-32766,
-32769,
-32765,
-32769,
-32764,
-32769,
 32767,
 32767,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32769,
-32763,
-32771,
-32764,
-32770,
-32765,
 32767,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32763,
-32772,
-32763,
-32769,
-32766,
 32767,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32765,
-32769,
-32764,
-32771,
-32763,
-32771,
-32764,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
 32767,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32769,
-32764,
-32770,
-32765,
 32767,
-32769,
-32764,
-32770,
-32765,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
 32767,
-32769,
-32763,
-32772,
-32762,
-32770,
 32767,
-32765,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
-32769,
-32764,
-32769,
 32767,
-32765,
-32771,
-32762,
-32771,
-32764,
-32769,
-32766,
-32768,
-32765,
-32770,
-32763,
-32772,
-32762,
-32771,
-32764,
-32769,
 32767,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32764,
-32770,
-32765,
-32769,
-32764,
-32771,
-32762,
-32772,
-32763,
-32770,
-32764,
-32770,
-32764,
-32769,
 32767,
-32765,
-32770,
-32764,
-32768,
-32768,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32765,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
 32767,
 32767,
 32767,
-32766,
-32770,
-32762,
-32772,
-32762,
-32772,
-32762,
-32772,
-32761,
-32773,
-32763,
-32769,
-32766,
 32767,
 32767,
-32769,
-32764,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32770,
-32762,
-32772,
-32763,
-32770,
-32766,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32771,
-32764,
-32768,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
 32767,
-32765,
-32771,
-32762,
-32771,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
 32767,
 32767,
-32766,
 32767,
-32769,
-32766,
 32767,
 32767,
-32765,
-32771,
-32764,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
 32767,
-32769,
-32765,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
@@ -18273,269 +3420,51 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32771,
-32763,
-32770,
-32765,
-32769,
-32766,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
 32767,
-32769,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32765,
 32767,
-32770,
-32761,
-32774,
-32761,
-32771,
-32765,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
 32767,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32770,
-32762,
-32773,
-32762,
-32770,
-32765,
-32768,
-32768,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32765,
-32768,
-32768,
-32766,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32766,
-32770,
-32764,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32770,
-32764,
-32768,
-32768,
-32765,
-32769,
 32767,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
 32767,
-32768,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32768,
-32766,
-32769,
-32766,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32764,
-32771,
-32764,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
@@ -18544,186 +3473,29 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32766,
-32769,
-32764,
-32771,
-32764,
-32769,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32770,
-32766,
-32766,
-32770,
-32762,
-32772,
-32764,
-32768,
-32768,
-32764,
-32771,
-32764,
-32768,
-32768,
-32764,
-32770,
-32766,
-32766,
-32769,
-32765,
-32768,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
-32766,
-32770,
-32764,
-32770,
-32764,
-32768,
-32768,
-32766,
-32769,
-32763,
-32771,
-32764,
-32769,
 32767,
-32766,
 32767,
-32769,
-32763,
-32773,
-32761,
-32771,
-32765,
 32767,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
 32767,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32771,
-32763,
-32771,
-32763,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32763,
-32772,
-32762,
-32772,
-32764,
 32767,
-32769,
-32765,
-32768,
-32768,
-32764,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
@@ -18735,161 +3507,30 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32763,
-32771,
-32764,
-32769,
-32765,
-32768,
 32767,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
 32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
 32767,
-32769,
-32764,
-32770,
-32765,
 32767,
-32768,
 32767,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32765,
 32767,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
 32767,
 32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32769,
-32765,
 32767,
-32768,
 32767,
 32767,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32765,
-32770,
-32764,
-32769,
 32767,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32765,
 32767,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
@@ -18905,490 +3546,98 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32766,
 32767,
 32767,
-32768,
-32765,
-32770,
-32763,
-32770,
-32766,
 32767,
 32767,
 32767,
-32766,
-32768,
 32767,
 32767,
 32767,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
 32767,
-32769,
-32764,
-32771,
-32763,
-32769,
-32766,
-32768,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32771,
-32764,
-32769,
-32765,
-32769,
-32766,
-32769,
-32763,
-32772,
-32761,
-32774,
-32761,
-32770,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
-32766,
-32770,
-32764,
-32770,
-32764,
-32768,
 32767,
 32767,
 32767,
-32768,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
 32767,
-32766,
-32770,
-32763,
-32771,
-32764,
-32768,
-32768,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32768,
-32764,
-32770,
-32765,
-32768,
-32768,
-32765,
-32768,
 32767,
-32766,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
 32767,
-32768,
-32764,
-32771,
-32764,
-32768,
-32768,
-32764,
-32771,
-32764,
-32768,
 32767,
 32767,
 32767,
-32768,
-32764,
-32771,
-32763,
-32771,
-32763,
-32771,
-32762,
-32773,
-32761,
-32773,
-32762,
-32769,
-32768,
-32764,
-32771,
-32764,
-32769,
-32766,
 32767,
 32767,
-32768,
 32767,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
 32767,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32765,
-32770,
-32763,
-32772,
-32763,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
 32767,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32768,
-32768,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32766,
 32767,
-32768,
-32765,
-32768,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32768,
 32767,
 32767,
-32768,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
 32767,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
 32767,
-32766,
-32768,
-32766,
 32767,
-32768,
 32767,
-32766,
-32768,
 32767,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32769,
-32764,
-32771,
-32762,
-32772,
-32763,
-32769,
-32766,
-32768,
-32766,
-32769,
-32764,
-32769,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
 32767,
-32768,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
-32766,
-32769,
-32766,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
 32767,
-32764,
-32771,
-32763,
-32771,
-32764,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
-32768,
-32764,
-32770,
-32765,
-32768,
 32767,
 32767,
 32767,
@@ -19396,739 +3645,138 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32766,
 32767,
 32767,
-32766,
-32769,
 32767,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
 32767,
 32767,
-32768,
 32767,
-32766,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32770,
-32763,
-32771,
-32763,
-32770,
-32765,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
 32767,
-32769,
-32763,
-32772,
-32764,
-32768,
 32767,
-32766,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
 32767,
-32766,
-32770,
-32763,
-32770,
-32765,
-32768,
 32767,
 32767,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32765,
-32771,
-32762,
-32772,
-32763,
-32770,
-32764,
-32770,
-32765,
-32769,
-32764,
-32770,
-32764,
-32771,
-32763,
-32770,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
-32768,
-32764,
-32771,
-32763,
-32770,
-32766,
 32767,
 32767,
 32767,
-32766,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
-32768,
-32764,
-32770,
-32766,
 32767,
-32768,
-32765,
-32769,
-32765,
-32770,
-32763,
-32771,
-32763,
-32771,
-32764,
-32768,
 32767,
 32767,
-32766,
-32770,
-32763,
-32771,
-32764,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
 32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32765,
-32769,
-32765,
-32770,
-32763,
-32771,
-32763,
-32770,
-32766,
 32767,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
 32767,
-32768,
-32766,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
 32767,
-32768,
-32765,
-32771,
-32763,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
 32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32771,
-32763,
-32771,
-32763,
-32770,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
 32767,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32765,
 32767,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
 32767,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32769,
-32765,
-32768,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
-32768,
-32766,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32769,
-32763,
-32772,
-32762,
-32771,
-32765,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
 32767,
 32767,
 32767,
-32769,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32769,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
 32767,
-32766,
-32768,
-32765,
-32769,
 32767,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32765,
-32770,
-32764,
-32769,
 32767,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32771,
-32764,
-32768,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32765,
-32770,
-32763,
-32771,
-32765,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
 32767,
-32765,
-32770,
-32763,
-32773,
-32761,
-32771,
-32765,
 32767,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32766,
-32770,
-32763,
-32771,
-32764,
-32768,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
 32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32766,
 32767,
-32768,
-32765,
-32768,
-32768,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32763,
-32770,
-32765,
-32769,
-32764,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32766,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
 32767,
-32765,
-32771,
-32763,
-32770,
-32765,
-32768,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
@@ -20137,72 +3785,16 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32766,
-32770,
-32763,
-32770,
-32765,
 32767,
-32769,
-32764,
-32769,
-32766,
-32768,
-32765,
-32770,
-32763,
-32772,
-32762,
-32771,
-32764,
-32769,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
-32766,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
@@ -20213,296 +3805,52 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
 32767,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
 32767,
-32765,
-32771,
-32763,
-32769,
-32768,
-32764,
-32771,
-32763,
-32770,
-32765,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32769,
-32764,
-32771,
-32763,
-32771,
-32764,
-32768,
 32767,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32766,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
 32767,
-32766,
-32768,
-32766,
-32768,
-32768,
-32764,
-32771,
-32762,
-32772,
-32764,
-32768,
-32768,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
 32767,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
 32767,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
-32766,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32769,
-32764,
-32769,
 32767,
-32765,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
 32767,
-32768,
-32764,
-32771,
-32764,
-32768,
-32768,
-32763,
-32773,
-32761,
-32772,
-32764,
-32768,
 32767,
 32767,
 32767,
-32768,
-32766,
 32767,
 32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32765,
-32768,
-32768,
-32765,
-32770,
-32764,
-32768,
-32769,
-32764,
-32770,
-32765,
 32767,
-32768,
-32766,
-32769,
-32764,
-32769,
-32766,
 32767,
-32769,
-32764,
-32769,
 32767,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
 32767,
-32765,
-32769,
-32766,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
 32767,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
 32767,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32768,
 32767,
-32765,
-32771,
-32763,
-32770,
-32765,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
 32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
@@ -20510,87 +3858,20 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
 32767,
 32767,
-32768,
-32765,
-32770,
-32764,
-32768,
-32769,
-32762,
-32773,
-32762,
-32770,
-32766,
 32767,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
 32767,
 32767,
 32767,
@@ -20601,1043 +3882,171 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32766,
-32766,
-32770,
-32764,
-32769,
 32767,
-32764,
-32772,
-32761,
-32774,
-32761,
-32771,
-32764,
-32770,
-32764,
-32771,
-32762,
-32772,
-32764,
-32768,
-32768,
-32764,
-32771,
-32764,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
 32767,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32770,
-32763,
-32771,
-32763,
-32770,
-32766,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32770,
-32764,
-32768,
 32767,
-32766,
-32769,
-32765,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32765,
-32771,
-32761,
-32775,
-32759,
-32773,
-32764,
-32768,
 32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32768,
 32767,
 32767,
-32768,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32766,
-32765,
-32771,
-32762,
-32772,
-32763,
-32770,
-32765,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
 32767,
 32767,
-32766,
-32769,
-32766,
-32766,
-32770,
-32763,
-32770,
-32766,
-32766,
-32769,
-32765,
 32767,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32771,
-32763,
-32770,
-32765,
-32769,
-32764,
-32771,
-32763,
-32771,
-32763,
-32771,
-32763,
-32770,
-32765,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32763,
-32770,
-32766,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32770,
-32764,
-32768,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
 32767,
-32768,
 32767,
-32765,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32769,
-32765,
-32770,
-32763,
-32771,
-32764,
-32768,
-32768,
-32764,
-32772,
-32762,
-32771,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32771,
-32762,
-32772,
-32763,
-32769,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
-32768,
-32764,
-32770,
-32765,
-32768,
 32767,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32765,
 32767,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32772,
-32761,
-32773,
-32761,
-32772,
-32763,
-32771,
-32764,
-32768,
-32766,
-32769,
-32765,
-32770,
-32764,
-32768,
-32768,
-32766,
 32767,
-32769,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32765,
-32771,
-32761,
-32773,
-32762,
-32771,
-32765,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32769,
-32764,
-32769,
-32766,
 32767,
-32769,
-32765,
-32768,
-32766,
 32767,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
 32767,
-32769,
-32764,
-32769,
-32766,
-32766,
-32770,
-32763,
-32771,
-32763,
-32770,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32763,
-32772,
-32762,
-32770,
-32766,
-32766,
-32770,
-32763,
-32770,
-32766,
-32766,
-32770,
-32763,
-32770,
-32766,
-32766,
-32770,
-32764,
-32768,
-32768,
-32764,
-32771,
-32764,
-32768,
-32768,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
 32767,
 32767,
 32767,
-32766,
-32768,
 32767,
-32766,
-32770,
-32762,
-32772,
-32763,
-32769,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32769,
-32763,
-32771,
-32764,
-32769,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32765,
-32766,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
 32767,
-32766,
-32769,
-32764,
-32771,
-32764,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32768,
-32768,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
 32767,
 32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
 32767,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32765,
-32768,
-32766,
-32768,
-32765,
-32771,
-32763,
-32770,
-32765,
-32768,
-32766,
-32768,
 32767,
 32767,
 32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
-32765,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
 32767,
-32766,
-32770,
-32762,
-32772,
-32763,
-32770,
-32765,
-32769,
-32764,
-32771,
-32763,
-32770,
-32766,
-32766,
-32770,
-32763,
-32771,
-32763,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
-32766,
 32767,
-32768,
 32767,
-32765,
-32770,
-32764,
-32769,
 32767,
-32766,
 32767,
-32768,
-32765,
-32770,
-32765,
 32767,
 32767,
-32768,
-32765,
-32770,
-32764,
-32768,
-32768,
-32765,
-32770,
-32764,
-32768,
 32767,
 32767,
-32768,
-32766,
-32766,
-32769,
-32766,
 32767,
 32767,
 32767,
-32766,
-32770,
-32763,
-32771,
-32764,
-32768,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
 32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32770,
-32763,
-32771,
-32764,
-32769,
 32767,
-32765,
-32770,
-32763,
-32771,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
 32767,
-32766,
-32768,
 32767,
-32765,
-32771,
-32763,
-32769,
-32766,
-32768,
-32766,
-32769,
-32763,
-32771,
-32764,
-32769,
 32767,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32765,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
-32766,
-32770,
-32762,
-32773,
-32762,
-32770,
-32766,
-32766,
-32769,
-32766,
 32767,
 32767,
-32768,
-32765,
-32770,
-32764,
-32768,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32770,
-32763,
-32770,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32769,
-32764,
-32771,
-32763,
-32771,
-32763,
-32770,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
-32768,
-32764,
-32771,
-32764,
-32769,
-32766,
-32766,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32769,
-32763,
-32771,
-32764,
-32769,
-32766,
 32767,
 32767,
 32767,
@@ -21645,920 +4054,152 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32768,
-32765,
-32770,
-32762,
-32773,
-32761,
-32773,
-32762,
-32771,
-32764,
-32769,
-32766,
 32767,
-32769,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
 32767,
 32767,
-32766,
-32770,
-32763,
-32772,
-32761,
-32772,
-32764,
-32769,
-32766,
-32768,
-32766,
 32767,
 32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32765,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
 32767,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
 32767,
-32765,
-32770,
-32764,
-32771,
-32763,
-32770,
-32764,
-32771,
-32762,
-32773,
-32761,
-32772,
-32763,
-32769,
 32767,
 32767,
 32767,
-32766,
 32767,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32766,
-32766,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32770,
-32763,
-32770,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32771,
-32764,
-32769,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
 32767,
 32767,
-32766,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32770,
-32762,
-32772,
-32763,
-32770,
-32766,
-32766,
-32769,
-32764,
-32771,
-32764,
-32768,
-32768,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32765,
-32771,
-32762,
-32771,
-32765,
 32767,
-32769,
-32765,
 32767,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32768,
-32768,
-32765,
-32769,
-32766,
-32766,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
-32766,
-32770,
-32763,
-32771,
-32763,
-32770,
-32765,
-32769,
-32765,
-32769,
-32764,
-32771,
-32763,
-32771,
-32764,
-32768,
-32768,
-32764,
-32771,
-32764,
-32768,
-32768,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32766,
-32766,
-32770,
-32763,
-32771,
-32764,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32764,
-32770,
-32766,
 32767,
 32767,
 32767,
-32766,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
-32768,
-32764,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32765,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
 32767,
 32767,
 32767,
-32766,
-32770,
-32763,
-32770,
-32765,
-32769,
-32766,
 32767,
 32767,
-32766,
-32770,
-32764,
-32769,
-32766,
 32767,
-32769,
-32763,
-32772,
-32762,
-32772,
-32763,
-32769,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32765,
-32770,
-32764,
-32770,
-32765,
 32767,
-32769,
-32763,
-32772,
-32763,
-32768,
-32769,
-32764,
-32770,
-32765,
 32767,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
 32767,
-32769,
-32764,
-32769,
-32766,
-32768,
 32767,
-32766,
-32768,
-32765,
-32770,
-32765,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
-32766,
-32770,
-32762,
-32772,
-32764,
 32767,
-32770,
-32762,
-32773,
-32761,
-32772,
-32763,
-32770,
-32765,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32768,
-32768,
-32764,
-32770,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32769,
 32767,
-32765,
-32770,
-32764,
-32768,
-32768,
-32766,
-32768,
-32766,
 32767,
 32767,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32769,
-32764,
-32771,
-32762,
-32772,
-32762,
-32771,
-32765,
-32768,
-32766,
 32767,
 32767,
 32767,
-32768,
-32766,
 32767,
 32767,
 32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
 32767,
-32766,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32771,
-32764,
-32769,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32765,
-32770,
-32763,
-32772,
-32762,
-32771,
-32765,
 32767,
-32768,
-32765,
-32770,
-32765,
 32767,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
 32767,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32771,
-32763,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
 32767,
 32767,
-32766,
-32768,
-32766,
-32769,
-32766,
 32767,
-32766,
-32768,
 32767,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
-32768,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32766,
 32767,
-32766,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32766,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32765,
-32770,
-32765,
 32767,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32769,
-32765,
 32767,
-32768,
 32767,
 32767,
-32768,
-32764,
-32770,
-32765,
-32769,
-32766,
 32767,
 32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32771,
-32761,
-32773,
-32762,
-32771,
-32764,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32766,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
@@ -22566,148 +4207,26 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32768,
 32767,
-32768,
-32764,
-32771,
-32762,
-32772,
-32764,
-32768,
 32767,
-32766,
-32769,
-32764,
-32771,
-32762,
-32773,
-32761,
-32771,
-32764,
-32771,
-32762,
-32773,
-32760,
-32773,
-32764,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
 32767,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
 32767,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32766,
-32770,
-32763,
-32772,
-32762,
-32771,
-32764,
-32769,
-32766,
 32767,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
 32767,
-32769,
-32763,
-32772,
-32762,
-32772,
-32763,
-32770,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
 32767,
-32766,
-32768,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32770,
-32763,
-32770,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
 32767,
 32767,
 32767,
@@ -22718,12 +4237,6 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
@@ -22732,15 +4245,7 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32768,
-32766,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
@@ -22759,336 +4264,58 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32764,
-32772,
-32761,
-32774,
-32759,
-32774,
-32762,
-32771,
-32764,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
-32766,
-32769,
-32764,
-32771,
-32764,
-32768,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32769,
 32767,
-32766,
-32769,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32763,
-32772,
-32761,
-32773,
-32763,
-32769,
-32766,
-32766,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32763,
-32771,
-32764,
-32768,
 32767,
-32766,
-32769,
-32766,
-32766,
-32769,
-32764,
-32770,
-32766,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
 32767,
-32769,
-32763,
-32772,
-32762,
-32771,
-32765,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32771,
-32762,
-32771,
-32765,
-32768,
 32767,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
 32767,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
 32767,
-32766,
-32768,
-32765,
-32771,
-32762,
-32773,
-32761,
-32772,
-32763,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32769,
 32767,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32766,
 32767,
 32767,
-32768,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32770,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32771,
-32765,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32765,
 32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
 32767,
 32767,
 32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
 32767,
-32769,
-32764,
-32769,
-32766,
 32767,
-32769,
-32764,
-32769,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32768,
 32767,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
@@ -23096,363 +4323,74 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32768,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
-32766,
-32769,
-32766,
-32768,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32766,
 32767,
-32766,
-32770,
-32764,
-32769,
-32766,
-32766,
-32770,
-32763,
-32771,
-32763,
-32770,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
 32767,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
 32767,
-32765,
-32770,
-32765,
 32767,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32768,
-32768,
-32766,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32769,
-32764,
-32770,
-32765,
 32767,
-32769,
-32764,
-32770,
-32765,
 32767,
-32769,
-32764,
-32769,
-32766,
 32767,
-32769,
-32764,
-32770,
-32764,
-32769,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32763,
-32772,
-32762,
-32772,
-32762,
-32772,
-32763,
-32769,
 32767,
-32765,
-32771,
-32763,
-32770,
-32765,
-32768,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
 32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
 32767,
-32769,
-32763,
-32771,
-32765,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
 32767,
-32765,
-32769,
-32766,
 32767,
-32769,
-32763,
-32771,
-32764,
-32769,
-32766,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32765,
 32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32765,
 32767,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
 32767,
-32770,
-32762,
-32772,
-32763,
-32770,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
-32766,
-32770,
-32763,
-32770,
-32765,
-32768,
 32767,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
 32767,
 32767,
@@ -23466,36 +4404,7 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32768,
-32768,
-32765,
-32770,
-32763,
-32770,
-32766,
 32767,
-32768,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
@@ -23504,685 +4413,100 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32768,
-32766,
-32766,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32765,
-32770,
-32763,
-32770,
-32765,
-32768,
 32767,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32765,
-32770,
-32765,
-32768,
 32767,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
 32767,
 32767,
-32765,
-32770,
-32764,
-32770,
-32766,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32768,
-32764,
-32771,
-32762,
-32772,
-32763,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
 32767,
 32767,
-32768,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32770,
-32766,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32770,
-32763,
-32771,
-32763,
-32770,
-32765,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32766,
-32768,
 32767,
 32767,
-32766,
-32768,
-32766,
-32768,
-32768,
-32764,
-32770,
-32765,
-32768,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32769,
-32764,
-32770,
-32766,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32770,
-32763,
-32770,
-32766,
 32767,
-32768,
-32765,
-32769,
-32765,
-32770,
-32763,
-32771,
-32764,
-32768,
-32768,
-32764,
-32771,
-32763,
-32771,
-32763,
-32770,
-32765,
-32769,
-32766,
-32768,
-32764,
-32770,
-32766,
 32767,
-32768,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
-32768,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32768,
 32767,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32769,
-32766,
 32767,
-32769,
-32765,
 32767,
-32768,
-32765,
-32770,
-32765,
-32768,
-32765,
-32769,
-32766,
-32768,
 32767,
-32766,
 32767,
 32767,
 32767,
-32769,
-32764,
-32770,
-32763,
-32771,
-32765,
 32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32763,
-32772,
-32762,
-32772,
-32763,
-32769,
 32767,
-32766,
-32769,
-32765,
-32769,
-32764,
-32771,
-32763,
-32771,
-32763,
-32770,
-32765,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
 32767,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
 32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32769,
-32764,
-32771,
-32764,
-32769,
-32766,
-32766,
-32770,
-32763,
-32771,
-32763,
-32771,
-32763,
-32771,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32765,
 32767,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32765,
-32771,
-32763,
-32769,
 32767,
-32765,
-32771,
-32763,
-32770,
-32764,
-32770,
-32765,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
-32766,
-32769,
-32764,
-32771,
-32762,
-32772,
-32763,
-32769,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32765,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32770,
-32763,
-32770,
-32765,
-32768,
-32768,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
 32767,
-32766,
-32770,
-32763,
-32771,
-32764,
-32768,
 32767,
-32768,
-32766,
 32767,
 32767,
 32767,
-32768,
-32766,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32766,
 32767,
-32768,
-32765,
-32768,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32766,
-32770,
-32764,
-32769,
-32766,
 32767,
 32767,
 32767,
@@ -24192,70 +4516,20 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32766,
-32766,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
@@ -24263,106 +4537,23 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
 32767,
-32768,
-32766,
-32768,
-32764,
-32772,
-32762,
-32772,
-32763,
-32769,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32769,
-32763,
-32772,
-32763,
-32769,
 32767,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32764,
-32771,
-32764,
-32768,
-32768,
-32763,
-32773,
-32761,
-32772,
-32763,
-32770,
-32765,
-32768,
-32766,
 32767,
-32769,
-32764,
-32770,
-32764,
-32769,
 32767,
-32765,
-32771,
-32762,
-32771,
-32764,
-32769,
 32767,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32768,
 32767,
 32767,
 32767,
@@ -24373,371 +4564,63 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
-32768,
-32764,
-32771,
-32763,
-32771,
-32763,
-32770,
-32765,
-32768,
-32768,
-32764,
-32770,
-32764,
-32770,
-32765,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
 32767,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
-32768,
-32766,
-32766,
-32770,
-32763,
-32771,
-32765,
 32767,
 32767,
 32767,
 32767,
-32768,
 32767,
-32765,
-32769,
-32765,
-32770,
-32765,
 32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
 32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32765,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32769,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32770,
-32762,
-32772,
-32764,
-32768,
 32767,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32766,
-32766,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32769,
 32767,
-32766,
-32769,
-32763,
-32772,
-32762,
-32771,
-32765,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
-32769,
-32764,
-32770,
-32765,
 32767,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32772,
-32761,
-32772,
-32764,
-32768,
-32768,
-32764,
-32771,
-32764,
-32768,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32765,
-32770,
-32763,
-32771,
-32763,
-32770,
-32766,
 32767,
-32766,
-32770,
-32762,
-32773,
-32761,
-32771,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
 32767,
-32766,
 32767,
-32768,
-32766,
-32768,
-32768,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32769,
-32764,
-32771,
-32762,
-32773,
-32761,
-32772,
-32763,
-32770,
-32765,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
 32767,
 32767,
@@ -24751,222 +4634,48 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
 32767,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
 32767,
-32765,
-32770,
-32764,
-32769,
 32767,
-32765,
-32769,
-32766,
-32768,
-32766,
 32767,
 32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32765,
 32767,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32768,
-32764,
-32770,
-32765,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32768,
-32766,
 32767,
 32767,
 32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
 32767,
-32769,
-32763,
-32771,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
 32767,
 32767,
-32766,
-32769,
-32766,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
 32767,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32769,
-32763,
-32772,
-32764,
 32767,
-32770,
-32762,
-32771,
-32765,
 32767,
-32769,
-32765,
-32768,
 32767,
-32766,
-32768,
-32768,
-32764,
-32771,
-32764,
 32767,
-32770,
-32763,
-32770,
-32766,
 32767,
 32767,
 32767,
@@ -24976,281 +4685,55 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32768,
-32765,
-32768,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32770,
-32763,
-32771,
-32763,
-32770,
-32766,
-32766,
-32770,
-32762,
-32772,
-32763,
-32769,
 32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
-32768,
-32764,
-32770,
-32766,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
-32766,
-32769,
-32765,
-32770,
-32763,
-32770,
-32765,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32768,
-32768,
-32763,
-32773,
-32760,
-32775,
-32760,
-32771,
-32765,
 32767,
-32769,
-32766,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32769,
-32764,
-32769,
 32767,
-32766,
-32769,
-32764,
-32770,
-32766,
-32766,
-32769,
-32764,
-32770,
-32766,
-32766,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32769,
-32765,
 32767,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
-32768,
-32764,
-32771,
-32763,
-32771,
-32764,
-32768,
 32767,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32768,
 32767,
-32768,
-32764,
-32771,
-32762,
-32772,
-32764,
-32768,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
 32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32765,
-32771,
-32762,
-32772,
-32763,
-32768,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
-32766,
-32769,
-32766,
 32767,
 32767,
-32766,
-32769,
-32766,
 32767,
 32767,
 32767,
@@ -25260,191 +4743,28 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
 32767,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
 32767,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
 32767,
-32769,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32765,
-32770,
-32765,
-32769,
-32765,
 32767,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32766,
-32766,
-32769,
-32764,
-32770,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32770,
-32763,
-32771,
-32763,
-32770,
-32765,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32771,
-32764,
-32768,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
@@ -25452,1477 +4772,260 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
 32767,
-32768,
 32767,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
 32767,
-32766,
-32768,
-32765,
-32769,
-32766,
-32769,
-32764,
-32769,
 32767,
-32765,
-32770,
-32764,
-32769,
 32767,
-32765,
-32770,
-32763,
-32771,
-32765,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32766,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
 32767,
 32767,
-32768,
-32766,
-32766,
-32769,
-32766,
 32767,
-32768,
-32764,
-32770,
-32766,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
 32767,
-32768,
 32767,
-32766,
-32770,
-32762,
-32772,
-32763,
-32770,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
-32765,
-32770,
-32764,
-32769,
 32767,
-32765,
-32769,
-32766,
-32768,
-32765,
-32770,
-32763,
-32772,
-32763,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32765,
 32767,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
 32767,
-32765,
-32770,
-32765,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32771,
-32762,
-32772,
-32763,
-32770,
-32765,
-32769,
-32764,
-32771,
-32762,
-32773,
-32761,
-32771,
-32765,
-32768,
 32767,
 32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32770,
-32766,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32768,
-32768,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
 32767,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
 32767,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32768,
-32768,
-32764,
-32772,
-32761,
-32771,
-32766,
-32766,
-32770,
-32763,
-32770,
-32765,
-32768,
-32766,
-32769,
-32765,
-32768,
 32767,
-32765,
-32771,
-32762,
-32772,
-32763,
-32770,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
 32767,
-32769,
-32765,
-32768,
 32767,
-32765,
-32771,
-32764,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
 32767,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32763,
-32770,
-32766,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
-32766,
-32769,
-32766,
-32765,
-32771,
-32763,
-32771,
-32763,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32766,
 32767,
 32767,
-32768,
-32765,
-32771,
-32761,
-32773,
-32762,
-32770,
-32766,
 32767,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
 32767,
-32765,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32765,
-32769,
-32764,
-32771,
-32764,
-32769,
-32765,
-32769,
-32764,
-32772,
-32761,
-32772,
-32763,
-32770,
-32765,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32770,
-32763,
-32770,
-32765,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32768,
-32768,
-32763,
-32772,
-32762,
-32772,
-32763,
-32769,
-32766,
-32768,
 32767,
-32766,
 32767,
-32768,
-32766,
-32769,
-32764,
-32769,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
 32767,
-32765,
-32771,
-32763,
-32770,
-32766,
-32766,
-32770,
-32763,
-32771,
-32763,
-32771,
-32763,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
 32767,
-32765,
-32770,
-32763,
-32771,
-32764,
-32770,
-32764,
-32768,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
-32766,
 32767,
-32769,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32765,
-32770,
-32764,
-32770,
-32765,
 32767,
 32767,
-32768,
 32767,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32765,
 32767,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32765,
-32770,
-32765,
 32767,
 32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
 32767,
-32765,
-32770,
-32764,
-32771,
-32763,
-32770,
-32764,
-32770,
-32766,
-32766,
-32769,
-32764,
-32771,
-32764,
-32768,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32766,
 32767,
 32767,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32769,
-32764,
-32771,
-32762,
-32772,
-32763,
-32769,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32765,
-32770,
-32763,
-32771,
-32765,
-32768,
-32765,
-32769,
-32765,
-32769,
 32767,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
-32766,
-32769,
-32765,
-32768,
-32768,
-32764,
-32770,
-32765,
-32769,
-32766,
 32767,
-32766,
-32769,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32770,
-32764,
-32768,
-32768,
-32765,
-32770,
-32764,
-32768,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32768,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32766,
-32766,
-32770,
-32764,
-32769,
-32766,
-32766,
-32769,
-32766,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32768,
 32767,
-32766,
-32769,
-32766,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
 32767,
 32767,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32769,
-32763,
-32772,
-32761,
-32773,
-32762,
-32772,
-32761,
-32773,
-32761,
-32773,
-32762,
-32771,
-32764,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
 32767,
-32768,
 32767,
-32765,
-32771,
-32762,
-32771,
-32765,
 32767,
-32769,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
 32767,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32765,
-32770,
-32764,
-32769,
 32767,
-32765,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32771,
-32763,
-32770,
-32764,
-32769,
-32766,
-32769,
-32764,
-32769,
-32766,
 32767,
-32768,
 32767,
-32766,
-32769,
-32764,
-32769,
 32767,
-32766,
-32769,
-32765,
 32767,
-32768,
-32766,
 32767,
-32769,
-32763,
-32772,
-32763,
-32769,
 32767,
-32766,
-32768,
-32766,
-32769,
-32764,
-32771,
-32763,
-32769,
-32766,
-32768,
-32766,
-32769,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
 32767,
-32765,
-32770,
-32765,
 32767,
-32769,
-32764,
-32769,
 32767,
-32766,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32766,
-32769,
-32766,
 32767,
 32767,
 32767,
-32766,
-32770,
-32763,
-32770,
-32766,
 32767,
 32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
 32767,
-32770,
-32762,
-32772,
-32764,
-32768,
 32767,
 32767,
-32766,
-32770,
-32764,
-32768,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
 32767,
 32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32763,
-32771,
-32763,
-32771,
-32764,
-32769,
-32765,
-32768,
 32767,
 32767,
-32768,
-32765,
-32768,
 32767,
 32767,
 32767,
-32768,
-32764,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32765,
 32767,
-32770,
-32762,
-32773,
-32761,
-32772,
-32763,
-32770,
-32765,
-32768,
 32767,
 32767,
 32767,
-32766,
-32769,
-32764,
-32771,
-32764,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32765,
 32767,
-32768,
 32767,
 32767,
-32766,
-32768,
-32766,
 32767,
-32770,
-32761,
-32773,
-32763,
-32769,
-32766,
-32768,
-32765,
-32770,
-32764,
-32768,
-32769,
-32763,
-32771,
-32763,
-32770,
-32766,
 32767,
 32767,
-32766,
-32769,
-32766,
-32766,
-32769,
-32765,
-32768,
-32768,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
 32767,
-32768,
-32764,
-32771,
-32763,
-32771,
-32764,
-32768,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32764,
-32771,
-32762,
-32772,
-32764,
-32768,
 32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32769,
-32764,
-32769,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32765,
-32770,
-32765,
 32767,
-32769,
-32763,
-32772,
-32763,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32765,
-32770,
-32765,
-32768,
-32768,
-32763,
-32773,
-32761,
-32772,
-32764,
-32768,
-32766,
-32769,
-32764,
-32771,
-32762,
-32772,
-32763,
-32770,
-32765,
-32768,
 32767,
 32767,
 32767,
@@ -26938,295 +5041,46 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32768,
-32769,
-32763,
-32771,
-32764,
-32768,
 32767,
-32768,
-32765,
-32770,
-32763,
-32770,
-32765,
-32769,
-32766,
-32766,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32762,
-32772,
-32763,
-32770,
-32764,
-32770,
-32764,
-32769,
 32767,
-32766,
-32768,
 32767,
-32765,
-32770,
-32765,
-32768,
-32766,
-32769,
-32764,
-32771,
-32763,
-32769,
 32767,
-32766,
-32769,
-32765,
 32767,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
 32767,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
 32767,
-32765,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32769,
-32766,
-32768,
 32767,
 32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
 32767,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32768,
-32768,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32765,
-32770,
-32765,
-32768,
-32766,
 32767,
-32768,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32763,
-32772,
-32762,
-32771,
-32765,
 32767,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
 32767,
 32767,
 32767,
-32766,
-32768,
-32768,
-32764,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32764,
-32771,
-32762,
-32773,
-32762,
-32770,
-32766,
-32766,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32765,
 32767,
-32768,
-32765,
-32770,
-32765,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
 32767,
-32766,
 32767,
-32768,
-32765,
-32770,
-32765,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
@@ -27240,880 +5094,164 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32770,
-32763,
-32772,
-32761,
-32772,
-32764,
-32768,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
-32766,
-32769,
-32766,
 32767,
 32767,
 32767,
-32766,
-32770,
-32762,
-32773,
-32761,
-32772,
-32763,
-32770,
-32766,
-32766,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32765,
-32770,
-32765,
 32767,
-32768,
-32765,
-32770,
-32765,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
 32767,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32768,
-32766,
-32768,
 32767,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
 32767,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32769,
-32764,
-32770,
-32766,
-32765,
-32772,
-32760,
-32774,
-32761,
-32772,
-32763,
-32769,
 32767,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32769,
-32764,
-32770,
-32763,
-32771,
-32765,
-32768,
 32767,
-32765,
-32769,
 32767,
-32765,
-32771,
-32762,
-32772,
-32763,
-32769,
-32766,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32768,
-32768,
-32766,
-32768,
-32766,
 32767,
 32767,
-32769,
-32763,
-32772,
-32762,
-32771,
-32764,
-32769,
-32766,
 32767,
-32769,
-32763,
-32771,
-32764,
-32769,
 32767,
-32765,
-32770,
-32764,
-32769,
 32767,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32763,
-32771,
-32763,
-32771,
-32763,
-32770,
-32766,
-32766,
-32768,
-32766,
-32768,
 32767,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32769,
 32767,
-32766,
-32768,
-32766,
-32766,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
-32768,
-32765,
-32768,
-32768,
-32766,
-32769,
-32764,
-32768,
-32768,
-32766,
-32769,
-32764,
-32769,
-32766,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
 32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
 32767,
-32768,
 32767,
-32766,
-32769,
-32764,
-32769,
 32767,
 32767,
-32766,
-32769,
-32764,
-32771,
-32764,
-32768,
 32767,
-32766,
-32769,
-32766,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32768,
-32764,
-32771,
-32763,
-32771,
-32763,
-32770,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
 32767,
-32769,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32771,
-32762,
-32772,
-32762,
-32771,
-32765,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32765,
-32770,
-32765,
-32768,
-32766,
-32766,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32765,
-32769,
-32765,
-32770,
-32763,
-32770,
-32764,
-32770,
-32765,
-32769,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
 32767,
 32767,
-32769,
-32764,
-32769,
-32765,
-32768,
-32769,
-32764,
-32769,
-32765,
-32769,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32765,
 32767,
-32768,
-32766,
-32768,
 32767,
 32767,
-32765,
-32771,
-32763,
-32771,
-32764,
 32767,
-32770,
-32764,
-32770,
-32763,
-32771,
-32763,
-32772,
-32763,
-32769,
-32766,
 32767,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32765,
-32771,
-32762,
-32772,
-32763,
-32769,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
-32768,
-32764,
-32771,
-32764,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
 32767,
 32767,
 32767,
-32766,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32771,
-32763,
-32770,
-32765,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
 32767,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
-32768,
-32764,
-32770,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
 32767,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
 32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
 32767,
-32765,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32770,
-32763,
-32771,
-32764,
-32769,
 32767,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32772,
-32762,
-32771,
-32764,
-32769,
-32766,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
 32767,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32765,
-32770,
-32765,
-32768,
-32766,
 32767,
-32768,
 32767,
-32766,
-32768,
-32765,
-32770,
-32765,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32766,
 32767,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
 32767,
-32769,
-32764,
-32770,
-32765,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32765,
-32770,
-32763,
-32771,
-32765,
-32768,
-32765,
-32769,
-32765,
-32769,
 32767,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
 32767,
-32766,
-32769,
-32765,
-32768,
-32768,
-32764,
-32770,
-32765,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
 32767,
 32767,
@@ -28122,220 +5260,52 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32768,
-32766,
-32768,
-32765,
-32769,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32768,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
-32768,
-32765,
-32770,
-32763,
-32770,
-32766,
 32767,
-32769,
-32764,
-32769,
-32765,
-32770,
-32763,
-32772,
-32762,
-32771,
-32764,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
-32766,
-32768,
-32768,
-32766,
 32767,
 32767,
-32766,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32768,
-32768,
-32764,
-32770,
-32766,
-32765,
-32771,
-32763,
-32770,
-32766,
 32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32766,
-32768,
-32765,
-32769,
 32767,
-32766,
-32769,
-32764,
-32769,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
 32767,
 32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
 32767,
 32767,
 32767,
-32768,
-32766,
 32767,
 32767,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
@@ -28343,136 +5313,35 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
-32768,
-32765,
-32768,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
-32766,
-32768,
 32767,
 32767,
-32766,
-32768,
-32766,
-32769,
-32766,
-32766,
 32767,
-32768,
-32766,
-32769,
-32764,
-32769,
-32766,
 32767,
-32769,
-32763,
-32771,
-32764,
-32769,
-32766,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32768,
-32766,
 32767,
-32769,
-32764,
-32770,
-32765,
 32767,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
 32767,
 32767,
-32766,
-32770,
-32763,
-32770,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
 32767,
 32767,
-32766,
-32770,
-32763,
-32771,
-32763,
-32771,
-32764,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32771,
-32764,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
@@ -28482,576 +5351,109 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32766,
-32768,
-32768,
-32765,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32766,
-32766,
-32770,
-32762,
-32773,
-32762,
-32770,
-32766,
-32766,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32766,
 32767,
 32767,
 32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32765,
-32770,
-32763,
-32771,
-32764,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32765,
-32770,
-32765,
 32767,
-32769,
-32763,
-32772,
-32763,
-32769,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32766,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
 32767,
-32769,
-32764,
-32770,
-32765,
 32767,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32766,
-32766,
-32768,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
 32767,
-32769,
-32764,
-32771,
-32764,
 32767,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
 32767,
-32766,
 32767,
-32768,
-32765,
-32770,
-32765,
-32766,
-32770,
-32764,
-32770,
-32765,
 32767,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32768,
-32768,
-32765,
-32770,
-32763,
-32771,
-32763,
-32771,
-32764,
-32768,
 32767,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
 32767,
-32766,
 32767,
-32768,
 32767,
-32768,
-32765,
-32768,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32768,
-32768,
-32764,
-32772,
-32762,
-32770,
 32767,
-32765,
-32770,
-32764,
-32769,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
 32767,
-32765,
-32770,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
 32767,
 32767,
-32766,
-32768,
-32766,
-32769,
-32765,
 32767,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
 32767,
-32768,
 32767,
-32766,
-32769,
-32763,
-32771,
-32765,
-32768,
 32767,
-32765,
-32769,
 32767,
-32766,
-32769,
-32764,
-32769,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32763,
-32772,
-32761,
-32774,
-32761,
-32770,
 32767,
-32765,
-32770,
-32764,
-32769,
 32767,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32765,
-32770,
-32764,
-32768,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
 32767,
 32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
 32767,
-32769,
-32764,
-32770,
-32764,
-32769,
 32767,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
-32766,
-32769,
-32764,
-32772,
-32761,
-32773,
-32762,
-32771,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32771,
-32762,
-32771,
-32765,
 32767,
-32769,
-32764,
-32769,
 32767,
-32765,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
 32767,
-32765,
-32770,
-32763,
-32771,
-32764,
-32770,
-32763,
-32770,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
@@ -29060,287 +5462,56 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
-32768,
-32766,
 32767,
 32767,
-32768,
-32765,
-32770,
-32765,
 32767,
-32769,
-32763,
-32771,
-32765,
-32768,
 32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
 32767,
-32769,
-32763,
-32772,
-32763,
-32769,
-32766,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32765,
 32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
 32767,
 32767,
 32767,
-32768,
 32767,
-32765,
-32769,
-32764,
-32771,
-32764,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32770,
-32762,
-32772,
-32764,
-32768,
 32767,
-32766,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
 32767,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32771,
-32762,
-32772,
-32763,
-32769,
 32767,
-32766,
-32769,
-32765,
 32767,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32771,
-32764,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
 32767,
-32768,
-32766,
-32769,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
@@ -29355,127 +5526,23 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32768,
-32764,
-32771,
-32763,
-32771,
-32763,
-32770,
-32764,
-32771,
-32763,
-32769,
 32767,
-32765,
-32770,
-32765,
-32768,
 32767,
-32765,
-32770,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
 32767,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
 32767,
-32769,
-32763,
-32771,
-32764,
-32769,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32765,
-32771,
-32763,
-32769,
-32766,
 32767,
-32768,
 32767,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32769,
-32763,
-32771,
-32764,
-32769,
 32767,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
@@ -29486,25 +5553,6 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32766,
-32770,
-32763,
-32770,
-32765,
-32768,
-32768,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
@@ -29515,365 +5563,71 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32768,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
-32766,
-32769,
-32764,
-32769,
 32767,
-32765,
-32771,
-32762,
-32772,
-32763,
-32770,
-32765,
-32768,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
-32768,
 32767,
-32766,
 32767,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32770,
-32762,
-32773,
-32760,
-32773,
-32763,
-32769,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
 32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32768,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32771,
-32762,
-32772,
-32763,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32769,
 32767,
-32765,
-32769,
-32766,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
-32768,
-32765,
-32770,
-32763,
-32770,
-32766,
 32767,
 32767,
-32768,
-32764,
-32771,
-32763,
-32770,
-32765,
-32769,
-32766,
 32767,
 32767,
-32766,
-32769,
-32766,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32763,
-32770,
-32765,
 32767,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
 32767,
-32766,
-32768,
 32767,
 32767,
 32767,
-32766,
 32767,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32765,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
 32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32768,
 32767,
 32767,
-32768,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
@@ -29883,32 +5637,7 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32768,
-32765,
-32770,
-32763,
-32772,
-32762,
-32772,
-32762,
-32771,
-32765,
-32768,
 32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32771,
-32764,
-32768,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
@@ -29919,337 +5648,70 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32770,
-32765,
-32766,
-32770,
-32762,
-32774,
-32760,
-32773,
-32762,
-32770,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
 32767,
-32769,
-32763,
-32772,
-32762,
-32770,
-32766,
 32767,
 32767,
-32768,
-32765,
-32768,
 32767,
 32767,
-32768,
-32764,
-32771,
-32763,
-32771,
-32764,
-32768,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
 32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32765,
-32770,
-32763,
-32771,
-32763,
-32770,
-32765,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
 32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
-32768,
-32766,
 32767,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32768,
 32767,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32765,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
 32767,
-32766,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
 32767,
-32768,
-32764,
-32771,
-32763,
-32771,
-32763,
-32770,
-32765,
-32768,
-32768,
-32765,
-32768,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32770,
-32763,
-32771,
-32763,
-32771,
-32764,
-32769,
-32766,
 32767,
 32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32771,
-32762,
-32773,
-32762,
-32770,
-32766,
-32766,
-32768,
 32767,
-32766,
-32770,
-32763,
-32769,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
 32767,
 32767,
-32766,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32770,
-32764,
-32768,
 32767,
 32767,
 32767,
@@ -30259,168 +5721,40 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32769,
-32763,
-32772,
-32763,
-32769,
 32767,
-32765,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32771,
-32764,
-32768,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
 32767,
-32769,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
 32767,
 32767,
 32767,
-32768,
 32767,
-32766,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32766,
-32766,
-32769,
-32764,
-32772,
-32762,
-32771,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
 32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
 32767,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
 32767,
-32766,
-32768,
 32767,
 32767,
 32767,
@@ -30430,287 +5764,57 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
 32767,
 32767,
 32767,
-32765,
-32770,
-32766,
 32767,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
 32767,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32765,
-32770,
-32763,
-32771,
-32764,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32768,
-32768,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
 32767,
-32765,
-32769,
-32766,
-32768,
 32767,
-32765,
-32769,
-32766,
-32768,
 32767,
-32765,
-32770,
-32765,
-32768,
-32766,
 32767,
-32768,
 32767,
 32767,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32765,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32763,
-32771,
-32764,
-32769,
-32764,
-32771,
-32763,
-32771,
-32764,
-32768,
-32768,
-32764,
-32771,
-32764,
-32768,
-32768,
-32764,
-32771,
-32764,
-32769,
-32765,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32771,
-32763,
-32770,
-32766,
-32766,
-32770,
-32763,
-32771,
-32764,
-32768,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
-32766,
-32770,
-32763,
-32771,
-32763,
-32770,
-32766,
 32767,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32771,
-32765,
-32766,
-32769,
-32765,
-32768,
 32767,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
 32767,
-32766,
-32768,
 32767,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
 32767,
-32769,
-32763,
-32772,
-32762,
-32771,
-32765,
 32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
 32767,
 32767,
 32767,
@@ -30719,953 +5823,169 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32766,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
 32767,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32765,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
 32767,
-32768,
-32766,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
-32766,
-32768,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
-32766,
-32770,
-32763,
-32771,
-32763,
-32769,
 32767,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
 32767,
-32765,
-32770,
-32765,
-32769,
-32765,
-32768,
-32766,
-32769,
-32764,
-32771,
-32762,
-32772,
-32763,
-32770,
-32765,
-32768,
-32766,
-32769,
-32765,
-32769,
-32765,
 32767,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
 32767,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
 32767,
-32769,
-32765,
-32768,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
 32767,
-32769,
-32765,
-32769,
-32764,
-32769,
 32767,
 32767,
 32767,
-32766,
 32767,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32769,
-32766,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32763,
-32771,
-32765,
 32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32768,
-32766,
 32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32764,
-32770,
-32766,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
 32767,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32765,
 32767,
-32768,
-32766,
 32767,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32769,
 32767,
-32766,
-32769,
-32765,
 32767,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
 32767,
 32767,
 32767,
 32767,
-32765,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
-32766,
 32767,
-32769,
-32764,
-32770,
-32764,
-32769,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
 32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
 32767,
-32765,
-32770,
-32764,
-32769,
 32767,
-32766,
-32768,
 32767,
-32765,
-32770,
-32765,
 32767,
-32769,
-32764,
-32769,
 32767,
-32765,
-32770,
-32764,
-32769,
 32767,
-32765,
-32769,
-32766,
 32767,
-32769,
-32763,
-32771,
-32764,
-32769,
-32766,
-32768,
-32765,
-32770,
-32764,
-32768,
-32769,
-32763,
-32772,
-32762,
-32770,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
 32767,
-32766,
 32767,
-32768,
-32765,
-32771,
-32763,
-32770,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
-32765,
-32770,
-32765,
-32768,
-32766,
 32767,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
 32767,
-32768,
-32765,
-32770,
-32763,
-32770,
-32765,
-32768,
 32767,
 32767,
 32767,
-32766,
-32768,
-32766,
-32769,
-32766,
 32767,
-32766,
-32769,
-32765,
-32770,
-32764,
-32768,
 32767,
-32766,
-32770,
-32764,
-32769,
-32765,
 32767,
-32770,
-32764,
-32770,
-32764,
-32768,
-32768,
 32767,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32765,
 32767,
-32768,
-32766,
-32768,
 32767,
-32765,
-32771,
-32762,
-32771,
-32765,
-32768,
 32767,
 32767,
-32765,
-32770,
-32765,
 32767,
-32769,
-32763,
-32771,
-32765,
 32767,
 32767,
 32767,
-32766,
-32770,
-32764,
-32769,
-32766,
 32767,
 32767,
-32768,
-32766,
-32768,
 32767,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
 32767,
-32769,
-32764,
-32770,
-32765,
 32767,
-32768,
-32766,
-32769,
-32764,
-32771,
-32762,
-32772,
-32764,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32764,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
 32767,
-32768,
-32766,
 32767,
-32769,
-32763,
-32771,
-32764,
-32769,
-32766,
 32767,
 32767,
 32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32771,
-32761,
-32773,
-32763,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
 32767,
-32766,
 32767,
 32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32765,
-32770,
-32763,
-32770,
-32766,
-32766,
-32770,
-32762,
-32772,
-32763,
-32770,
-32765,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32771,
-32763,
-32770,
-32765,
-32768,
 32767,
 32767,
 32767,
-32766,
-32768,
 32767,
 32767,
 32767,
-32766,
 32767,
-32768,
-32766,
-32769,
-32764,
-32769,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32765,
-32770,
-32763,
-32771,
-32763,
-32770,
-32766,
 32767,
 32767,
-32766,
-32769,
-32764,
-32771,
-32764,
-32768,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32768,
 32767,
 32767,
 32767,
@@ -31677,245 +5997,47 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32764,
-32771,
-32764,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
 32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
 32767,
-32768,
-32766,
-32769,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32763,
-32772,
-32762,
-32771,
-32765,
 32767,
-32769,
-32763,
-32772,
-32762,
-32772,
-32763,
-32769,
-32766,
 32767,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32770,
-32763,
-32770,
-32766,
 32767,
-32768,
-32765,
-32768,
 32767,
-32768,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32764,
-32771,
-32764,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32766,
-32768,
-32765,
-32771,
-32762,
-32772,
-32763,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
 32767,
 32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32763,
-32772,
-32762,
-32770,
 32767,
-32764,
-32771,
-32764,
-32768,
 32767,
 32767,
 32767,
@@ -31923,754 +6045,142 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32770,
-32764,
-32769,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
 32767,
-32769,
-32764,
-32769,
-32766,
-32766,
-32770,
-32764,
-32769,
 32767,
-32765,
-32769,
-32766,
-32766,
-32771,
-32762,
-32771,
-32764,
-32769,
-32765,
-32770,
-32764,
-32768,
-32768,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
 32767,
-32768,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32771,
-32763,
-32770,
-32766,
 32767,
 32767,
-32766,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32766,
 32767,
 32767,
 32767,
-32768,
 32767,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32769,
-32763,
-32771,
-32764,
-32768,
-32769,
-32763,
-32771,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32771,
-32763,
-32770,
-32764,
-32770,
-32766,
 32767,
 32767,
-32766,
-32768,
 32767,
-32768,
-32764,
-32770,
-32764,
-32770,
-32765,
-32769,
-32764,
-32771,
-32762,
-32772,
-32763,
-32771,
-32763,
-32771,
-32763,
-32771,
-32763,
-32770,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
 32767,
 32767,
-32766,
-32768,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32765,
-32768,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
 32767,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32768,
-32766,
-32770,
-32763,
-32771,
-32763,
-32769,
-32768,
-32764,
-32771,
-32764,
-32768,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32765,
-32770,
-32765,
-32768,
 32767,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32768,
 32767,
-32768,
-32766,
 32767,
 32767,
 32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
 32767,
 32767,
-32766,
-32769,
-32766,
 32767,
 32767,
 32767,
-32766,
-32770,
-32764,
-32769,
-32766,
-32768,
-32765,
-32770,
-32763,
-32772,
-32763,
-32769,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32769,
-32764,
-32769,
-32766,
 32767,
-32769,
-32764,
-32770,
-32765,
 32767,
-32768,
 32767,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32764,
-32771,
-32764,
-32769,
-32766,
-32766,
-32770,
-32763,
-32771,
-32764,
-32768,
-32769,
-32763,
-32771,
-32764,
-32768,
-32768,
-32766,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32768,
 32767,
 32767,
-32768,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32768,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
 32767,
-32768,
-32765,
-32770,
-32765,
 32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
-32766,
-32769,
-32764,
-32770,
-32766,
 32767,
-32766,
-32768,
-32766,
-32769,
-32766,
-32766,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32769,
 32767,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32769,
 32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32771,
-32762,
-32772,
-32762,
-32771,
-32764,
-32769,
-32766,
 32767,
-32769,
-32763,
-32771,
-32764,
-32769,
-32766,
 32767,
 32767,
 32767,
@@ -32679,476 +6189,82 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32766,
-32769,
-32766,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32764,
-32771,
-32762,
-32772,
-32763,
-32769,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32763,
-32773,
-32760,
-32774,
-32761,
-32771,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32766,
 32767,
 32767,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32765,
-32771,
-32762,
-32772,
-32763,
-32769,
-32766,
-32768,
-32766,
-32769,
-32764,
-32769,
-32766,
-32768,
 32767,
 32767,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32769,
-32764,
-32769,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32766,
-32766,
-32769,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32768,
-32766,
-32769,
-32766,
 32767,
 32767,
-32766,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32768,
 32767,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
-32768,
-32764,
-32771,
-32764,
-32769,
 32767,
-32765,
-32768,
-32768,
-32765,
-32770,
-32763,
-32771,
-32763,
-32771,
-32764,
-32769,
-32765,
-32769,
-32764,
-32772,
-32762,
-32771,
-32764,
-32768,
 32767,
 32767,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32764,
-32770,
-32766,
 32767,
-32766,
-32768,
-32766,
-32769,
-32766,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
-32768,
-32766,
 32767,
-32766,
-32769,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
-32768,
-32766,
 32767,
 32767,
 32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32768,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
 32767,
-32769,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32765,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
@@ -33156,303 +6272,52 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32768,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
 32767,
-32768,
-32765,
-32771,
-32762,
-32771,
-32765,
 32767,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32763,
-32772,
-32762,
-32771,
-32764,
-32768,
-32769,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
 32767,
-32769,
-32763,
-32772,
-32762,
-32771,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
 32767,
-32769,
-32764,
-32770,
-32765,
 32767,
-32769,
-32763,
-32772,
-32762,
-32772,
-32763,
-32769,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32765,
-32770,
-32763,
-32772,
-32762,
-32771,
-32765,
-32766,
-32770,
-32764,
-32769,
 32767,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
 32767,
-32765,
-32771,
-32762,
-32771,
-32764,
-32769,
-32766,
-32768,
-32766,
 32767,
 32767,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32769,
-32763,
-32771,
-32764,
-32769,
 32767,
-32765,
-32768,
 32767,
 32767,
-32768,
-32765,
 32767,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32768,
 32767,
 32767,
-32768,
-32765,
-32768,
-32766,
-32768,
 32767,
 32767,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32765,
 32767,
-32768,
-32765,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
 32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32763,
-32771,
-32765,
 32767,
-32768,
-32766,
 32767,
-32769,
-32763,
-32772,
-32763,
-32769,
 32767,
-32766,
 32767,
-32769,
-32764,
-32769,
 32767,
-32765,
-32770,
-32765,
 32767,
-32769,
-32763,
-32772,
-32763,
-32769,
 32767,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
@@ -33460,215 +6325,44 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
 32767,
-32768,
-32766,
-32768,
 32767,
-32765,
-32770,
-32763,
-32772,
-32762,
-32772,
-32762,
-32772,
-32761,
-32773,
-32762,
-32771,
-32765,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
 32767,
 32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32771,
-32764,
-32768,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
 32767,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
 32767,
-32766,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
 32767,
 32767,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32769,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
 32767,
 32767,
@@ -33681,203 +6375,45 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32766,
-32770,
-32763,
-32770,
-32766,
-32766,
-32769,
-32766,
 32767,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
 32767,
-32769,
-32764,
-32771,
-32764,
 32767,
-32769,
-32765,
-32768,
 32767,
-32766,
-32768,
-32768,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
 32767,
-32765,
-32770,
-32764,
-32770,
-32765,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32766,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32763,
-32772,
-32762,
-32771,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
 32767,
-32768,
 32767,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
 32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32768,
 32767,
 32767,
 32767,
-32768,
-32765,
-32768,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32764,
-32772,
-32762,
-32771,
-32764,
-32768,
 32767,
 32767,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32765,
-32770,
-32765,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
@@ -33886,267 +6422,51 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32766,
-32766,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32762,
-32773,
-32761,
-32772,
-32763,
-32769,
-32768,
-32765,
-32768,
 32767,
-32766,
-32770,
-32762,
-32772,
-32763,
-32770,
-32765,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32765,
-32768,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32764,
-32771,
-32763,
-32771,
-32763,
-32771,
-32763,
-32770,
-32765,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
 32767,
 32767,
-32766,
-32769,
-32764,
-32771,
-32764,
-32768,
 32767,
-32766,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32765,
-32770,
-32765,
 32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
 32767,
 32767,
 32767,
-32768,
-32766,
 32767,
 32767,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32769,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32763,
-32771,
-32764,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32765,
-32770,
-32765,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32769,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32766,
-32766,
-32768,
 32767,
 32767,
 32767,
@@ -34154,63595 +6474,26114 @@ uint16_t p2Frozen_wav[97742] = {
 32767,
 32767,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32770,
-32762,
-32772,
-32763,
-32769,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
 32767,
-32769,
-32764,
-32770,
-32764,
-32771,
-32762,
-32772,
-32763,
-32768,
-32769,
-32763,
-32772,
-32762,
-32772,
-32761,
-32773,
-32762,
-32771,
-32765,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32763,
-32772,
-32762,
-32770,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32769,
 32767,
-32766,
-32769,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32770,
-32766,
-32766,
-32769,
-32765,
-32768,
-32768,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32766,
-32766,
-32769,
-32764,
-32771,
-32764,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32771,
-32764,
-32769,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
-32768,
-32764,
-32771,
-32763,
-32771,
-32763,
-32770,
-32765,
-32768,
 32767,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
-32768,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32771,
-32763,
-32770,
-32766,
 32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32770,
-32764,
-32770,
-32763,
-32771,
-32765,
 32767,
-32768,
-32765,
-32769,
 32767,
-32765,
-32769,
-32766,
-32766,
-32770,
-32764,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32768,
 32767,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
 32767,
-32766,
 32767,
-32768,
-32765,
-32770,
-32765,
-32766,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
 32767,
 32767,
 32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32768,
-32765,
-32769,
-32766,
-32766,
-32770,
-32764,
-32768,
-32768,
-32764,
-32772,
-32762,
-32770,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
 32767,
-32769,
-32764,
-32769,
-32766,
-32766,
-32770,
-32764,
-32768,
 32767,
 32767,
-32768,
-32766,
 32767,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
-32769,
-32763,
-32771,
-32765,
 32767,
-32769,
-32764,
-32769,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
 32767,
-32769,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
 32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32765,
-32770,
-32764,
-32770,
-32765,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32763,
-32772,
-32763,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32771,
-32762,
-32772,
-32763,
-32769,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32769,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32765,
-32768,
-32766,
-32766,
-32770,
-32764,
-32770,
-32764,
-32768,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32770,
-32764,
-32770,
-32764,
-32768,
-32768,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32770,
-32766,
-32766,
-32769,
-32765,
-32768,
-32768,
-32764,
-32770,
-32766,
-32765,
-32772,
-32760,
-32773,
-32763,
-32769,
-32768,
-32765,
-32768,
 32767,
-32766,
-32769,
-32766,
 32767,
 32767,
 32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
 32767,
-32768,
-32765,
-32769,
-32765,
-32770,
-32763,
-32772,
-32761,
-32773,
-32762,
-32771,
-32764,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32769,
 32767,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
-32769,
-32764,
-32769,
-32766,
 32767,
-32768,
 32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
 32767,
-32769,
-32763,
-32771,
-32765,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
 32767,
-32766,
-32769,
-32765,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
 32767,
-32765,
-32770,
-32765,
-32768,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
 32767,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
 32767,
-32765,
-32770,
-32764,
-32770,
-32765,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
 32767,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32765,
-32769,
 32767,
-32766,
-32768,
-32766,
 32767,
-32769,
-32765,
-32768,
 32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
 32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32766,
-32768,
 32767,
-32766,
 32767,
-32768,
-32765,
-32771,
-32762,
-32771,
-32765,
 32767,
-32769,
-32764,
-32769,
 32767,
-32766,
-32769,
-32765,
 32767,
-32768,
-32766,
-32768,
 32767,
-32766,
-32768,
-32766,
-32768,
 32767,
-32766,
-32769,
-32764,
-32770,
-32766,
-32766,
-32769,
-32764,
-32771,
-32762,
-32773,
-32760,
-32773,
-32763,
-32770,
-32765,
-32769,
-32764,
-32770,
-32765,
-32768,
-32768,
-32766,
 32767,
 32767,
 32767,
-32768,
-32766,
 32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
 32767,
 32767,
-32769,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
 32767,
-32768,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32771,
-32764,
-32768,
-32768,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
-32768,
-32766,
 32767,
 32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32766,
-32768,
 32767,
 32767,
-32766,
-32768,
-32765,
-32771,
-32763,
-32770,
-32765,
-32768,
-32766,
-32768,
 32767,
 32767,
 32767,
 32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
 32767,
-32768,
-32766,
 32767,
 32767,
 32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
 32767,
 32767,
-32766,
-32769,
-32764,
-32770,
-32766,
-32766,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
 32767,
 32767,
 32767,
-32766,
-32770,
-32763,
-32770,
-32766,
 32767,
 32767,
-32768,
-32765,
-32769,
-32766,
 32767,
-32768,
-32766,
-32768,
-32766,
 32767,
 32767,
-32768,
-32766,
-32769,
-32764,
-32770,
-33449,
-33546,
-33604,
-33595,
-33586,
-33533,
-33551,
-33542,
-33629,
-33648,
-33731,
-33767,
-33802,
-33826,
-33800,
-33724,
-33596,
-33469,
-33331,
-33268,
-33211,
-33199,
-33160,
-33090,
-33005,
-32909,
-32892,
-32886,
-32935,
-32926,
-32909,
-32816,
-32757,
-32677,
-32643,
-32621,
-32601,
-32563,
-32541,
-32525,
-32513,
-32544,
-32582,
-32644,
-32731,
-32806,
-32877,
-32886,
-32880,
-32805,
-32761,
-32700,
-32642,
-32566,
-32457,
-32362,
-32272,
-32237,
-32279,
-32325,
-32422,
-32479,
-32517,
-32502,
-32420,
-32270,
-32129,
-31959,
-31941,
-31960,
-32089,
-32241,
-32332,
-32414,
-32436,
-32463,
-32497,
-32560,
-32576,
-32588,
-32546,
-32485,
-32480,
-32472,
-32583,
-32656,
 32767,
-32779,
-32754,
-32675,
-32587,
-32544,
-32500,
-32497,
-32419,
-32354,
-32252,
-32275,
-32357,
-32546,
-32732,
-32813,
-32803,
-32688,
-32587,
-32534,
-32542,
-32587,
-32642,
-32694,
-32792,
-32905,
-32997,
-33058,
-33015,
-33007,
-32968,
-33044,
-33104,
-33179,
-33178,
-33170,
-33107,
-33127,
-33089,
-33052,
-32955,
-32814,
-32711,
-32638,
-32626,
-32619,
-32642,
-32706,
-32799,
-32987,
-33103,
-33168,
-33121,
-32998,
-32911,
-32867,
-32848,
-32852,
-32789,
-32761,
-32771,
-32920,
-33111,
-33305,
-33405,
-33360,
-33273,
-33185,
-33170,
-33238,
-33275,
-33197,
-33012,
-32667,
-32349,
-32078,
-31944,
-31894,
-31921,
-31928,
-31971,
-32006,
-32162,
-32297,
-32486,
-32491,
-32408,
-32152,
-31934,
-31812,
-31899,
-32099,
-32320,
-32455,
-32501,
-32553,
-32651,
-32871,
-33005,
-33086,
-32883,
-32691,
-32467,
-32490,
-32629,
-32839,
-32965,
-32943,
-32801,
-32565,
-32284,
-31956,
-31574,
-31270,
-31075,
-31149,
-31440,
-31879,
-32319,
-32634,
-32719,
-32612,
-32290,
-31900,
-31506,
-31278,
-31244,
-31487,
-31877,
-32406,
-32819,
-33117,
-33159,
-33064,
-32798,
-32561,
-32339,
-32233,
-32282,
-32371,
-32592,
-32784,
-33023,
-33215,
-33324,
-33276,
-33026,
-32603,
-32126,
-31783,
-31696,
-31921,
-32346,
 32767,
-33145,
-33283,
-33355,
-33278,
-33125,
-32919,
-32655,
-32484,
-32437,
-32637,
-32918,
-33265,
-33421,
-33460,
-33304,
-33138,
-32940,
-32805,
-32693,
-32619,
-32575,
-32581,
-32608,
-32668,
-32704,
-32707,
-32693,
-32652,
-32649,
-32648,
-32729,
-32804,
-32925,
-32958,
-32924,
-32788,
-32602,
-32474,
-32419,
-32521,
-32627,
-32785,
-32865,
-32925,
-33017,
-33101,
-33202,
-33197,
-33084,
-32879,
-32666,
-32543,
-32565,
-32700,
-32890,
-33079,
-33179,
-33240,
-33143,
-33040,
-32837,
-32696,
-32588,
-32629,
-32784,
-33045,
-33331,
-33580,
-33696,
-33697,
-33519,
-33273,
-32946,
-32683,
-32469,
-32415,
-32466,
-32669,
-32977,
-33313,
-33639,
-33806,
-33794,
-33554,
-33170,
-32752,
-32440,
-32336,
-32448,
-32753,
-33048,
-33335,
-33391,
-33334,
-33144,
-32958,
-32856,
-32853,
-32973,
-33033,
-33045,
-32872,
-32621,
-32391,
-32262,
-32332,
-32501,
-32695,
-32817,
-32838,
-32802,
-32760,
-32742,
-32738,
-32735,
-32730,
-32732,
-32796,
-32886,
-33019,
-33135,
-33153,
-33100,
-32903,
-32654,
-32390,
-32238,
-32248,
-32465,
-32800,
-33129,
-33319,
-33287,
-33093,
-32789,
-32558,
-32432,
-32455,
-32625,
-32874,
-33142,
-33270,
-33192,
-32837,
-32349,
-31913,
-31725,
-31917,
-32344,
-32906,
-33317,
-33605,
-33682,
-33645,
-33514,
-33291,
-32975,
-32707,
-32506,
-32489,
-32627,
-32887,
-33167,
-33455,
-33658,
-33826,
-33847,
-33711,
-33391,
-32994,
-32618,
-32502,
-32616,
-33020,
-33455,
-33750,
-33789,
-33521,
-33115,
-32701,
-32408,
-32316,
-32295,
-32409,
-32535,
-32801,
-33143,
-33548,
-33836,
-33871,
-33562,
-32987,
-32417,
-32062,
-32220,
-32752,
-33568,
-34252,
-34607,
-34505,
-34114,
-33648,
-33375,
-33365,
-33514,
-33695,
-33769,
-33760,
-33814,
-33934,
-34165,
-34264,
-34140,
-33765,
-33366,
-33074,
-33100,
-33187,
-33263,
-33027,
-32646,
-32215,
-32036,
-32118,
-32405,
-32699,
-32882,
-32932,
-32863,
-32782,
-32734,
-32744,
-32897,
-33061,
-33266,
-33224,
-32991,
-32463,
-31983,
-31703,
-31834,
-32316,
-32954,
-33456,
-33713,
-33642,
-33390,
-33085,
-32785,
-32605,
-32485,
-32457,
-32475,
-32540,
-32610,
-32689,
-32693,
-32609,
-32385,
-32059,
-31719,
-31522,
-31567,
-31974,
-32513,
-33085,
-33306,
-33132,
-32558,
-31836,
-31285,
-31063,
-31300,
-31768,
-32344,
-32784,
-33066,
-33212,
-33262,
-33226,
-33025,
-32680,
-32159,
-31744,
-31460,
-31590,
-31926,
-32486,
-32979,
-33415,
-33650,
-33717,
-33500,
-33056,
-32437,
-31861,
-31602,
-31709,
-32239,
-32877,
-33465,
-33736,
-33705,
-33318,
-32788,
-32153,
-31687,
-31500,
-31752,
-32359,
-33146,
-33861,
-34265,
-34342,
-34069,
-33548,
-32891,
-32184,
-31663,
-31445,
-31681,
-32238,
-32901,
-33327,
-33395,
-33068,
-32586,
-32105,
-31750,
-31515,
-31445,
-31500,
-31780,
-32167,
-32585,
-32884,
-32930,
-32835,
-32602,
-32383,
-32132,
-31871,
-31646,
-31562,
-31725,
-32120,
-32525,
-32758,
-32675,
-32317,
-31922,
-31637,
-31522,
-31564,
-31668,
-31818,
-32044,
-32304,
-32507,
-32533,
-32311,
-31916,
-31551,
-31391,
-31591,
-32010,
-32514,
-32843,
-32913,
-32731,
-32364,
-32051,
-31828,
-31840,
-32040,
-32319,
-32651,
-32833,
-32886,
-32732,
-32481,
-32158,
-31962,
-31867,
-32023,
-32284,
-32620,
-32854,
-32927,
-32834,
-32632,
-32447,
-32306,
-32258,
-32236,
-32228,
-32263,
-32396,
-32701,
-33125,
-33570,
-33862,
-33904,
-33684,
-33336,
-32978,
-32752,
-32657,
-32687,
-32815,
-32974,
-33237,
-33482,
-33733,
-33837,
-33736,
-33472,
-33143,
-32939,
-32991,
-33252,
-33570,
-33779,
-33691,
-33404,
-33016,
-32725,
-32596,
-32664,
-32841,
-33089,
-33354,
-33527,
-33660,
-33591,
-33489,
-33356,
-33319,
-33492,
-33748,
-34061,
-34242,
-34244,
-34162,
-34009,
-33972,
-33974,
-34051,
-34047,
-33939,
-33742,
-33547,
-33480,
-33565,
-33734,
-33939,
-34040,
-34037,
-33965,
-33835,
-33711,
-33532,
-33337,
-33090,
-32910,
-32813,
-32895,
-33068,
-33311,
-33471,
-33550,
-33505,
-33427,
-33352,
-33323,
-33309,
-33301,
-33275,
-33262,
-33290,
-33338,
-33368,
-33321,
-33124,
-32817,
-32481,
-32242,
-32207,
-32348,
-32587,
-32770,
-32803,
-32687,
-32478,
-32345,
-32303,
-32376,
-32484,
-32521,
-32491,
-32389,
-32326,
-32334,
-32458,
-32635,
-32833,
-32958,
-32966,
-32900,
-32723,
-32572,
-32458,
-32420,
-32440,
-32436,
-32345,
-32130,
-31851,
-31608,
-31519,
-31687,
-32014,
-32406,
-32618,
-32598,
-32315,
-31970,
-31710,
-31694,
-31876,
-32199,
-32468,
-32633,
-32660,
-32644,
-32581,
-32595,
-32605,
-32673,
-32783,
-32940,
-33097,
-33293,
-33411,
-33516,
-33533,
-33519,
-33460,
-33395,
-33308,
-33244,
-33215,
-33264,
-33442,
-33666,
-33956,
-34141,
-34234,
-34124,
-33909,
-33653,
-33454,
-33382,
-33418,
-33488,
-33545,
-33471,
-33353,
-33170,
-33076,
-33045,
-33138,
-33238,
-33301,
-33282,
-33192,
-33038,
-32925,
-32830,
-32774,
-32707,
-32641,
-32561,
-32544,
-32568,
-32657,
-32742,
-32808,
-32802,
-32799,
-32779,
-32805,
-32844,
-32838,
-32823,
-32788,
-32756,
-32785,
-32756,
-32689,
-32488,
-32280,
-32079,
-32052,
-32123,
-32331,
-32478,
-32542,
-32450,
-32274,
-32037,
-31841,
-31688,
-31609,
-31564,
-31552,
-31534,
-31530,
-31526,
-31540,
-31560,
-31577,
-31549,
-31503,
-31417,
-31375,
-31374,
-31419,
-31493,
-31511,
-31450,
-31330,
-31102,
-30933,
-30737,
-30625,
-30527,
-30478,
-30436,
-30437,
-30483,
-30546,
-30623,
-30643,
-30598,
-30488,
-30332,
-30208,
-30164,
-30204,
-30353,
-30502,
-30692,
-30773,
-30830,
-30740,
-30649,
-30541,
-30567,
-30684,
-30928,
-31164,
-31332,
-31351,
-31258,
-31092,
-30931,
-30815,
-30732,
-30734,
-30751,
-30859,
-30983,
-31128,
-31240,
-31272,
-31275,
-31233,
-31211,
-31196,
-31164,
-31127,
-31080,
-31019,
-31021,
-30993,
-31018,
-30980,
-30970,
-30922,
-30957,
-30997,
-31097,
-31163,
-31164,
-31109,
-30977,
-30857,
-30806,
-30803,
-30949,
-31041,
-31186,
-31170,
-31108,
-30932,
-30807,
-30710,
-30707,
-30768,
-30845,
-30958,
-31089,
-31249,
-31448,
-31597,
-31687,
-31695,
-31645,
-31608,
-31562,
-31573,
-31549,
-31547,
-31546,
-31647,
-31814,
-32073,
-32273,
-32416,
-32399,
-32344,
-32245,
-32222,
-32225,
-32334,
-32393,
-32540,
-32600,
-32717,
-32824,
-32986,
-33176,
-33415,
-33592,
-33770,
-33807,
-33885,
-33921,
-34079,
-34294,
-34560,
-34768,
-34916,
-34938,
-34967,
-35001,
-35142,
-35319,
-35513,
-35646,
-35736,
-35801,
-35948,
-36153,
-36433,
-36657,
-36815,
-36821,
-36811,
-36800,
-36913,
-37031,
-37221,
-37265,
-37347,
-37381,
-37553,
-37809,
-38156,
-38408,
-38555,
-38491,
-38338,
-38184,
-38084,
-38145,
-38240,
-38364,
-38463,
-38518,
-38604,
-38699,
-38791,
-38821,
-38718,
-38524,
-38285,
-38132,
-38096,
-38225,
-38373,
-38532,
-38546,
-38500,
-38389,
-38297,
-38228,
-38190,
-38098,
-37994,
-37822,
-37716,
-37634,
-37631,
-37659,
-37613,
-37521,
-37330,
-37111,
-36917,
-36702,
-36546,
-36349,
-36140,
-35922,
-35693,
-35531,
-35392,
-35314,
-35237,
-35125,
-34969,
-34736,
-34511,
-34252,
-34043,
-33863,
-33706,
-33602,
-33522,
-33489,
-33504,
-33479,
-33458,
-33272,
-33107,
-32855,
-32725,
-32659,
-32700,
-32764,
-32759,
-32701,
-32553,
-32412,
-32329,
-32300,
-32315,
-32305,
-32247,
-32159,
-32113,
-32088,
-32168,
-32176,
-32141,
-31975,
-31767,
-31602,
-31523,
-31601,
-31697,
-31769,
-31768,
-31649,
-31532,
-31413,
-31387,
-31441,
-31536,
-31685,
-31772,
-31861,
-31854,
-31840,
-31729,
-31660,
-31553,
-31544,
-31585,
-31712,
-31848,
-32000,
-32038,
-32040,
-31991,
-31955,
-32016,
-32094,
-32260,
-32344,
-32401,
-32366,
-32271,
-32197,
-32151,
-32109,
-32109,
-32055,
-32010,
-31937,
-31852,
-31766,
-31683,
-31567,
-31446,
-31281,
-31171,
-31071,
-31037,
-31021,
-30938,
-30833,
-30609,
-30350,
-30127,
-29932,
-29823,
-29788,
-29725,
-29686,
-29576,
-29462,
-29313,
-29209,
-29051,
-29004,
-28905,
-28893,
-28850,
-28866,
-28867,
-28946,
-28998,
-29052,
-29016,
-28835,
-28624,
-28374,
-28267,
-28281,
-28436,
-28579,
-28702,
-28690,
-28604,
-28453,
-28253,
-28011,
-27756,
-27512,
-27321,
-27233,
-27200,
-27183,
-27149,
-27057,
-26952,
-26853,
-26748,
-26650,
-26531,
-26403,
-26304,
-26249,
-26274,
-26346,
-26461,
-26529,
-26597,
-26567,
-26579,
-26552,
-26582,
-26653,
-26721,
-26820,
-26848,
-26878,
-26883,
-26948,
-27085,
-27256,
-27457,
-27526,
-27511,
-27347,
-27102,
-26886,
-26710,
-26652,
-26692,
-26763,
-26897,
-26983,
-27040,
-27038,
-26966,
-26905,
-26828,
-26839,
-26901,
-27032,
-27212,
-27368,
-27559,
-27723,
-27928,
-28146,
-28369,
-28556,
-28751,
-28923,
-29226,
-29642,
-30216,
-30874,
-31429,
-31869,
-32053,
-32165,
-32262,
-32526,
-32924,
-33446,
-33923,
-34278,
-34537,
-34724,
-34996,
-35386,
-35841,
-36281,
-36544,
-36640,
-36607,
-36583,
-36714,
-36984,
-37390,
-37764,
-37995,
-38043,
-37907,
-37738,
-37637,
-37685,
-37919,
-38209,
-38532,
-38720,
-38834,
-38817,
-38824,
-38836,
-38966,
-39097,
-39251,
-39315,
-39357,
-39373,
-39504,
-39751,
-40115,
-40514,
-40771,
-40887,
-40760,
-40570,
-40435,
-40450,
-40702,
-40992,
-41250,
-41308,
-41190,
-40939,
-40759,
-40638,
-40621,
-40598,
-40503,
-40277,
-40016,
-39755,
-39558,
-39429,
-39255,
-39082,
-38762,
-38464,
-38097,
-37831,
-37557,
-37357,
-37112,
-36872,
-36556,
-36242,
-35912,
-35667,
-35489,
-35393,
-35330,
-35237,
-35031,
-34760,
-34346,
-33993,
-33660,
-33528,
-33480,
-33563,
-33635,
-33647,
-33527,
-33312,
-33013,
-32727,
-32472,
-32308,
-32237,
-32208,
-32276,
-32281,
-32312,
-32201,
-32069,
-31865,
-31754,
-31694,
-31868,
-32082,
-32373,
-32596,
-32688,
-32713,
-32660,
-32692,
-32782,
-32995,
-33192,
-33426,
-33578,
-33771,
-33982,
-34256,
-34595,
-34869,
-35081,
-35188,
-35278,
-35409,
-35638,
-35895,
-36157,
-36269,
-36280,
-36235,
-36131,
-36205,
-36266,
-36488,
-36615,
-36768,
-36788,
-36824,
-36824,
-36884,
-36932,
-36985,
-36947,
-36861,
-36666,
-36505,
-36318,
-36264,
-36245,
-36346,
-36439,
-36552,
-36580,
-36527,
-36411,
-36267,
-36119,
-36010,
-35907,
-35845,
-35763,
-35697,
-35635,
-35632,
-35652,
-35703,
-35713,
-35655,
-35485,
-35233,
-34924,
-34645,
-34421,
-34280,
-34202,
-34103,
-34004,
-33784,
-33574,
-33289,
-33053,
-32810,
-32566,
-32311,
-32036,
-31781,
-31597,
-31456,
-31380,
-31300,
-31135,
-30913,
-30596,
-30298,
-30038,
-29928,
-29875,
-29891,
-29881,
-29781,
-29646,
-29443,
-29293,
-29223,
-29202,
-29238,
-29203,
-29081,
-28866,
-28589,
-28345,
-28160,
-28103,
-28082,
-28086,
-28058,
-27987,
-27868,
-27743,
-27591,
-27455,
-27331,
-27194,
-27103,
-27002,
-26954,
-26906,
-26890,
-26853,
-26812,
-26751,
-26656,
-26595,
-26540,
-26538,
-26581,
-26630,
-26720,
-26789,
-26885,
-27015,
-27131,
-27261,
-27325,
-27320,
-27317,
-27292,
-27359,
-27438,
-27576,
-27615,
-27626,
-27502,
-27355,
-27222,
-27159,
-27186,
-27252,
-27289,
-27227,
-27046,
-26766,
-26457,
-26218,
-26066,
-25994,
-25935,
-25821,
-25611,
-25304,
-24977,
-24639,
-24425,
-24285,
-24234,
-24292,
-24278,
-24317,
-24189,
-24049,
-23752,
-23463,
-23116,
-22854,
-22659,
-22477,
-22374,
-22162,
-22051,
-22028,
-22306,
-22883,
-23660,
-24401,
-24894,
-25051,
-25003,
-25038,
-25348,
-26039,
-26916,
-27777,
-28343,
-28679,
-28884,
-29269,
-29939,
-30954,
-32030,
-33095,
-33837,
-34449,
-34912,
-35429,
-35923,
-36386,
-36677,
-36831,
-36886,
-36997,
-37180,
-37494,
-37744,
-38010,
-38156,
-38426,
-38813,
-39386,
-40050,
-40588,
-40879,
-40848,
-40614,
-40376,
-40308,
-40543,
-40957,
-41475,
-41923,
-42208,
-42443,
-42614,
-42923,
-43312,
-43804,
-44314,
-44763,
-45129,
-45402,
-45549,
-45655,
-45624,
-45628,
-45553,
-45593,
-45656,
-45775,
-45866,
-45811,
-45609,
-45265,
-44898,
-44583,
-44357,
-44190,
-43931,
-43514,
-42885,
-42149,
-41376,
-40691,
-40082,
-39512,
-38928,
-38359,
-37765,
-37301,
-36878,
-36511,
-36107,
-35634,
-35088,
-34526,
-34051,
-33618,
-33287,
-32906,
-32516,
-32047,
-31606,
-31227,
-30980,
-30823,
-30683,
-30514,
-30202,
-29914,
-29584,
-29433,
-29348,
-29330,
-29210,
-28950,
-28496,
-28000,
-27520,
-27253,
-27121,
-27163,
-27205,
-27205,
-27111,
-26942,
-26746,
-26520,
-26315,
-26106,
-25962,
-25964,
-26149,
-26524,
-26920,
-27247,
-27308,
-27193,
-27015,
-27026,
-27374,
-28066,
-28935,
-29743,
-30347,
-30687,
-30887,
-31122,
-31480,
-32037,
-32662,
-33321,
-33954,
-34585,
-35260,
-35999,
-36715,
-37418,
-37974,
-38526,
-38990,
-39477,
-39894,
-40178,
-40387,
-40546,
-40798,
-41210,
-41711,
-42207,
-42553,
-42712,
-42696,
-42666,
-42635,
-42682,
-42743,
-42746,
-42708,
-42597,
-42484,
-42404,
-42308,
-42212,
-42019,
-41771,
-41438,
-41151,
-40920,
-40806,
-40765,
-40736,
-40634,
-40460,
-40188,
-39860,
-39498,
-39095,
-38681,
-38196,
-37759,
-37332,
-37078,
-36911,
-36848,
-36748,
-36510,
-36124,
-35562,
-34959,
-34374,
-33879,
-33437,
-33035,
-32586,
-32110,
-31611,
-31170,
-30741,
-30399,
-29986,
-29579,
-29090,
-28577,
-28112,
-27692,
-27349,
-27069,
-26787,
-26499,
-26244,
-25973,
-25795,
-25662,
-25584,
-25523,
-25449,
-25312,
-25191,
-25070,
-25059,
-25154,
-25364,
-25611,
-25828,
-25928,
-25908,
-25789,
-25598,
-25461,
-25377,
-25441,
-25595,
-25852,
-26113,
-26321,
-26391,
-26380,
-26262,
-26199,
-26134,
-26151,
-26146,
-26100,
-26004,
-25851,
-25738,
-25689,
-25731,
-25845,
-25955,
-26058,
-26103,
-26110,
-26135,
-26183,
-26326,
-26533,
-26782,
-27068,
-27299,
-27538,
-27709,
-27922,
-28121,
-28368,
-28633,
-28844,
-28969,
-28995,
-28933,
-28892,
-28933,
-29130,
-29499,
-29859,
-30155,
-30142,
-29864,
-29350,
-28761,
-28285,
-27908,
-27694,
-27505,
-27296,
-27077,
-26847,
-26652,
-26479,
-26227,
-25850,
-25292,
-24702,
-24104,
-23710,
-23393,
-23153,
-22805,
-22303,
-21773,
-21282,
-20989,
-20756,
-20519,
-20145,
-19814,
-19792,
-20367,
-21548,
-23059,
-24330,
-24966,
-24878,
-24397,
-24099,
-24326,
-25267,
-26493,
-27699,
-28499,
-28987,
-29425,
-30122,
-31263,
-32612,
-33923,
-34808,
-35285,
-35465,
-35695,
-36081,
-36667,
-37196,
-37525,
-37546,
-37424,
-37343,
-37495,
-37875,
-38374,
-38857,
-39267,
-39711,
-40267,
-40975,
-41722,
-42252,
-42497,
-42362,
-42127,
-41947,
-42099,
-42526,
-43203,
-43906,
-44580,
-45141,
-45670,
-46203,
-46780,
-47401,
-47966,
-48447,
-48763,
-48909,
-48947,
-48892,
-48808,
-48639,
-48419,
-48110,
-47867,
-47685,
-47633,
-47547,
-47315,
-46789,
-46059,
-45308,
-44694,
-44343,
-44022,
-43579,
-42793,
-41714,
-40541,
-39523,
-38769,
-38270,
-37822,
-37320,
-36760,
-36227,
-35919,
-35805,
-35872,
-35831,
-35629,
-35122,
-34578,
-34017,
-33676,
-33432,
-33191,
-32823,
-32352,
-31876,
-31550,
-31446,
-31467,
-31476,
-31337,
-30986,
-30477,
-29966,
-29488,
-29133,
-28798,
-28413,
-27866,
-27182,
-26380,
-25689,
-25151,
-24861,
-24732,
-24567,
-24356,
-24014,
-23704,
-23539,
-23561,
-23712,
-23887,
-23960,
-24012,
-24074,
-24273,
-24597,
-25016,
-25377,
-25751,
-26157,
-26773,
-27720,
-28905,
-30221,
-31369,
-32228,
-32780,
-33198,
-33678,
-34367,
-35218,
-36105,
-36826,
-37312,
-37645,
-37907,
-38328,
-38828,
-39428,
-39966,
-40335,
-40577,
-40684,
-40800,
-40901,
-41050,
-41199,
-41307,
-41495,
-41685,
-41993,
-42295,
-42521,
-42592,
-42480,
-42275,
-42125,
-42159,
-42417,
-42856,
-43310,
-43654,
-43803,
-43763,
-43621,
-43463,
-43353,
-43294,
-43238,
-43136,
-42947,
-42613,
-42171,
-41613,
-41010,
-40453,
-39958,
-39628,
-39323,
-39009,
-38595,
-37977,
-37285,
-36525,
-35883,
-35319,
-34808,
-34219,
-33428,
-32488,
-31465,
-30536,
-29884,
-29454,
-29263,
-29122,
-28965,
-28730,
-28413,
-28067,
-27688,
-27335,
-26945,
-26615,
-26295,
-26081,
-25945,
-25867,
-25836,
-25749,
-25690,
-25574,
-25573,
-25605,
-25747,
-25902,
-25987,
-25993,
-25887,
-25749,
-25631,
-25608,
-25632,
-25711,
-25701,
-25625,
-25426,
-25213,
-25052,
-24994,
-25103,
-25282,
-25540,
-25745,
-25877,
-25909,
-25843,
-25740,
-25629,
-25565,
-25553,
-25620,
-25687,
-25813,
-25899,
-26045,
-26192,
-26402,
-26677,
-26974,
-27296,
-27565,
-27770,
-27905,
-27931,
-27921,
-27857,
-27853,
-27861,
-28018,
-28228,
-28486,
-28706,
-28841,
-28841,
-28807,
-28707,
-28678,
-28678,
-28676,
-28690,
-28622,
-28582,
-28501,
-28437,
-28351,
-28219,
-28073,
-27858,
-27642,
-27408,
-27225,
-27049,
-26934,
-26878,
-26827,
-26799,
-26721,
-26590,
-26413,
-26201,
-25964,
-25659,
-25316,
-24870,
-24433,
-23969,
-23552,
-23155,
-22795,
-22490,
-22232,
-21928,
-21508,
-20795,
-19942,
-19043,
-18624,
-18854,
-19938,
-21476,
-22979,
-23908,
-23997,
-23527,
-22957,
-22883,
-23525,
-24707,
-26031,
-26993,
-27554,
-27884,
-28402,
-29462,
-30958,
-32662,
-34075,
-34965,
-35348,
-35499,
-35696,
-36160,
-36776,
-37456,
-37911,
-38189,
-38224,
-38205,
-38177,
-38182,
-38351,
-38684,
-39386,
-40415,
-41652,
-42799,
-43553,
-43726,
-43491,
-43093,
-42933,
-43102,
-43609,
-44229,
-44763,
-45222,
-45573,
-46056,
-46630,
-47351,
-48064,
-48669,
-49063,
-49253,
-49213,
-49114,
-48906,
-48646,
-48311,
-47851,
-47384,
-46973,
-46699,
-46536,
-46338,
-45901,
-45111,
-44088,
-43028,
-42260,
-41887,
-41796,
-41762,
-41495,
-40865,
-40011,
-39031,
-38205,
-37497,
-36937,
-36422,
-35928,
-35557,
-35388,
-35456,
-35671,
-35901,
-35940,
-35812,
-35487,
-35164,
-34849,
-34535,
-34117,
-33571,
-32888,
-32276,
-31774,
-31521,
-31358,
-31195,
-30835,
-30345,
-29700,
-29088,
-28548,
-28044,
-27559,
-26959,
-26259,
-25514,
-24795,
-24209,
-23779,
-23445,
-23147,
-22842,
-22515,
-22263,
-22113,
-22137,
-22291,
-22580,
-22948,
-23448,
-24087,
-24845,
-25630,
-26297,
-26770,
-26990,
-27138,
-27340,
-27843,
-28744,
-29954,
-31396,
-32801,
-34037,
-35021,
-35750,
-36280,
-36637,
-36935,
-37147,
-37422,
-37692,
-37988,
-38200,
-38290,
-38242,
-38143,
-38174,
-38383,
-38819,
-39261,
-39533,
-39504,
-39218,
-38869,
-38673,
-38711,
-38996,
-39261,
-39496,
-39521,
-39476,
-39474,
-39536,
-39785,
-40036,
-40350,
-40645,
-41025,
-41542,
-42261,
-43068,
-43833,
-44297,
-44394,
-44108,
-43691,
-43332,
-43204,
-43264,
-43342,
-43210,
-42788,
-42100,
-41387,
-40776,
-40441,
-40192,
-39976,
-39506,
-38783,
-37774,
-36643,
-35475,
-34389,
-33417,
-32521,
-31781,
-31048,
-30450,
-29817,
-29298,
-28776,
-28422,
-28233,
-28227,
-28426,
-28631,
-28792,
-28719,
-28512,
-28168,
-27940,
-27864,
-28003,
-28219,
-28400,
-28439,
-28350,
-28278,
-28281,
-28438,
-28701,
-28910,
-29057,
-29056,
-28946,
-28757,
-28474,
-28107,
-27709,
-27333,
-27080,
-26964,
-26932,
-26853,
-26650,
-26369,
-26039,
-25930,
-25999,
-26321,
-26771,
-27168,
-27473,
-27574,
-27520,
-27421,
-27313,
-27385,
-27569,
-27942,
-28342,
-28763,
-29146,
-29450,
-29781,
-30032,
-30312,
-30454,
-30581,
-30627,
-30688,
-30738,
-30706,
-30566,
-30283,
-29888,
-29517,
-29229,
-29097,
-29073,
-29095,
-29068,
-28943,
-28710,
-28391,
-28054,
-27713,
-27457,
-27242,
-27134,
-27095,
-27046,
-27069,
-26977,
-26875,
-26651,
-26418,
-26177,
-26089,
-26113,
-26327,
-26532,
-26659,
-26544,
-26233,
-25817,
-25485,
-25350,
-25421,
-25538,
-25520,
-25268,
-24840,
-24431,
-24213,
-24244,
-24287,
-24151,
-23574,
-22716,
-21783,
-21081,
-20621,
-20251,
-19680,
-18865,
-18088,
-17839,
-18557,
-20196,
-22272,
-23975,
-24677,
-24343,
-23451,
-22878,
-23165,
-24415,
-26091,
-27536,
-28348,
-28577,
-28803,
-29429,
-30769,
-32481,
-34173,
-35469,
-36251,
-36771,
-37278,
-37872,
-38589,
-39086,
-39402,
-39411,
-39342,
-39211,
-39081,
-38818,
-38505,
-38260,
-38441,
-39276,
-40722,
-42391,
-43736,
-44297,
-44076,
-43460,
-42949,
-42975,
-43511,
-44252,
-44828,
-45015,
-44992,
-45046,
-45527,
-46472,
-47628,
-48636,
-49194,
-49249,
-49048,
-48804,
-48687,
-48648,
-48518,
-48160,
-47636,
-47022,
-46538,
-46168,
-45798,
-45220,
-44282,
-43058,
-41774,
-40731,
-40141,
-39943,
-39955,
-39834,
-39427,
-38705,
-37784,
-36881,
-36055,
-35325,
-34635,
-33960,
-33424,
-33151,
-33229,
-33545,
-33972,
-34210,
-34293,
-34177,
-34136,
-34131,
-34148,
-33953,
-33476,
-32701,
-31911,
-31290,
-31045,
-31046,
-31093,
-30955,
-30477,
-29775,
-28982,
-28292,
-27777,
-27329,
-26887,
-26260,
-25612,
-24903,
-24413,
-24092,
-23879,
-23660,
-23232,
-22710,
-22145,
-21830,
-21838,
-22257,
-22915,
-23704,
-24422,
-25117,
-25783,
-26541,
-27344,
-28119,
-28734,
-29094,
-29273,
-29521,
-30009,
-30951,
-32195,
-33550,
-34752,
-35670,
-36331,
-36856,
-37313,
-37685,
-37894,
-37882,
-37734,
-37605,
-37617,
-37807,
-38040,
-38217,
-38224,
-38149,
-38084,
-38144,
-38314,
-38491,
-38519,
-38372,
-38123,
-37983,
-38061,
-38440,
-38935,
-39361,
-39505,
-39340,
-39029,
-38765,
-38751,
-38964,
-39320,
-39614,
-39743,
-39808,
-39884,
-40154,
-40522,
-40877,
-40973,
-40771,
-40330,
-39821,
-39433,
-39175,
-38999,
-38763,
-38460,
-38061,
-37650,
-37225,
-36786,
-36278,
-35751,
-35212,
-34789,
-34438,
-34157,
-33761,
-33211,
-32466,
-31692,
-31064,
-30735,
-30655,
-30719,
-30618,
-30294,
-29697,
-29089,
-28649,
-28606,
-28885,
-29349,
-29782,
-29955,
-29884,
-29604,
-29308,
-29097,
-29082,
-29149,
-29285,
-29263,
-29166,
-28937,
-28790,
-28717,
-28826,
-28969,
-29153,
-29282,
-29381,
-29473,
-29496,
-29455,
-29285,
-29066,
-28909,
-28935,
-29179,
-29555,
-29900,
-30118,
-30199,
-30248,
-30384,
-30618,
-30927,
-31237,
-31531,
-31786,
-32076,
-32363,
-32601,
-32720,
-32676,
-32522,
-32305,
-32166,
-32077,
-32097,
-32072,
-31997,
-31782,
-31482,
-31130,
-30865,
-30641,
-30557,
-30463,
-30358,
-30141,
-29807,
-29374,
-28903,
-28434,
-28048,
-27712,
-27449,
-27210,
-26945,
-26716,
-26487,
-26358,
-26273,
-26268,
-26190,
-26067,
-25873,
-25635,
-25504,
-25439,
-25483,
-25461,
-25312,
-24902,
-24321,
-23717,
-23255,
-23047,
-23038,
-23024,
-22851,
-22377,
-21745,
-21134,
-20778,
-20759,
-20960,
-21103,
-20906,
-20176,
-19017,
-17728,
-16762,
-16339,
-16447,
-16636,
-16602,
-16177,
-15890,
-16287,
-17834,
-20277,
-22816,
-24604,
-25277,
-25197,
-25188,
-25855,
-27309,
-29031,
-30504,
-31421,
-31997,
-32583,
-33458,
-34597,
-35796,
-36879,
-37826,
-38635,
-39397,
-39997,
-40424,
-40621,
-40628,
-40498,
-40210,
-39817,
-39310,
-38781,
-38318,
-37938,
-37757,
-37871,
-38482,
-39749,
-41554,
-43466,
-44948,
-45619,
-45660,
-45557,
-45906,
-46825,
-48005,
-48877,
-49247,
-49255,
-49442,
-50108,
-51143,
-52133,
-52645,
-52611,
-52301,
-51936,
-51637,
-51196,
-50438,
-49370,
-48109,
-46878,
-45672,
-44437,
-43054,
-41555,
-40064,
-38570,
-37157,
-35718,
-34406,
-33444,
-32998,
-33057,
-33301,
-33402,
-33150,
-32723,
-32301,
-32091,
-32019,
-31860,
-31665,
-31439,
-31627,
-32150,
-32960,
-33650,
-33979,
-33990,
-33876,
-33890,
-33999,
-34022,
-33675,
-32872,
-31768,
-30600,
-29610,
-28787,
-28122,
-27353,
-26520,
-25464,
-24400,
-23350,
-22543,
-22020,
-21810,
-21759,
-21778,
-21735,
-21703,
-21786,
-22144,
-22723,
-23451,
-24110,
-24625,
-25044,
-25533,
-26232,
-27215,
-28347,
-29617,
-30812,
-32015,
-33118,
-34170,
-35046,
-35769,
-36263,
-36559,
-36728,
-36745,
-36694,
-36604,
-36536,
-36547,
-36647,
-36790,
-36885,
-36943,
-36878,
-36850,
-36846,
-37003,
-37249,
-37601,
-37966,
-38299,
-38579,
-38812,
-38995,
-39233,
-39464,
-39833,
-40260,
-40761,
-41291,
-41697,
-41997,
-42153,
-42312,
-42544,
-42945,
-43331,
-43515,
-43318,
-42632,
-41712,
-40675,
-39769,
-38940,
-38086,
-37194,
-36225,
-35402,
-34744,
-34316,
-33982,
-33655,
-33353,
-33081,
-33026,
-33156,
-33359,
-33509,
-33422,
-33146,
-32775,
-32526,
-32506,
-32735,
-33111,
-33436,
-33671,
-33723,
-33721,
-33735,
-33779,
-33829,
-33833,
-33659,
-33449,
-33074,
-32735,
-32270,
-31672,
-30859,
-29886,
-28915,
-28154,
-27739,
-27615,
-27611,
-27529,
-27319,
-27110,
-27168,
-27585,
-28363,
-29164,
-29809,
-30018,
-29942,
-29719,
-29616,
-29810,
-30289,
-30994,
-31817,
-32582,
-33247,
-33666,
-33911,
-33949,
-33914,
-33874,
-33928,
-34038,
-34210,
-34234,
-34100,
-33698,
-33133,
-32480,
-31947,
-31602,
-31479,
-31478,
-31454,
-31318,
-31042,
-30688,
-30425,
-30312,
-30427,
-30655,
-30965,
-31196,
-31313,
-31262,
-31065,
-30747,
-30433,
-30143,
-30025,
-30054,
-30206,
-30409,
-30521,
-30528,
-30331,
-30006,
-29528,
-29017,
-28473,
-27992,
-27547,
-27095,
-26604,
-25961,
-25279,
-24579,
-23978,
-23546,
-23174,
-22867,
-22515,
-22127,
-21711,
-21281,
-20859,
-20449,
-20123,
-19945,
-19964,
-20112,
-20243,
-20209,
-19963,
-19594,
-19320,
-19219,
-19394,
-19672,
-19993,
-20199,
-20304,
-20228,
-20093,
-19808,
-19570,
-19319,
-19169,
-19000,
-18701,
-18245,
-17670,
-17413,
-17850,
-19375,
-21958,
-24974,
-27644,
-29134,
-29329,
-28799,
-28500,
-29319,
-31357,
-33983,
-36212,
-37350,
-37369,
-36927,
-36749,
-37336,
-38603,
-40075,
-41374,
-42165,
-42585,
-42729,
-42764,
-42773,
-42749,
-42720,
-42645,
-42480,
-42139,
-41563,
-40810,
-40106,
-39798,
-40193,
-41425,
-43300,
-45418,
-47258,
-48517,
-49093,
-49266,
-49313,
-49562,
-49956,
-50412,
-50658,
-50656,
-50490,
-50378,
-50412,
-50505,
-50396,
-49821,
-48763,
-47454,
-46202,
-45271,
-44529,
-43842,
-42890,
-41681,
-40270,
-38880,
-37537,
-36259,
-34925,
-33584,
-32287,
-31186,
-30348,
-29823,
-29655,
-29792,
-30243,
-30846,
-31440,
-31878,
-32076,
-32147,
-32152,
-32186,
-32161,
-32091,
-31902,
-31817,
-31821,
-31992,
-32092,
-32017,
-31702,
-31239,
-30847,
-30523,
-30194,
-29644,
-28765,
-27696,
-26684,
-25951,
-25564,
-25359,
-25123,
-24717,
-24139,
-23544,
-23069,
-22855,
-22975,
-23412,
-24143,
-25026,
-25935,
-26801,
-27595,
-28433,
-29318,
-30264,
-31099,
-31749,
-32173,
-32513,
-32958,
-33528,
-34241,
-34880,
-35376,
-35732,
-36068,
-36482,
-36950,
-37350,
-37529,
-37425,
-37065,
-36619,
-36191,
-35951,
-35892,
-36098,
-36444,
-36894,
-37264,
-37489,
-37510,
-37508,
-37530,
-37788,
-38222,
-38787,
-39393,
-39910,
-40345,
-40673,
-40892,
-41056,
-41135,
-41202,
-41233,
-41226,
-41143,
-40919,
-40640,
-40305,
-40067,
-39832,
-39606,
-39188,
-38567,
-37774,
-36880,
-36106,
-35381,
-34802,
-34170,
-33483,
-32747,
-32064,
-31546,
-31335,
-31373,
-31664,
-31993,
-32262,
-32370,
-32329,
-32279,
-32300,
-32476,
-32784,
-33046,
-33249,
-33245,
-33223,
-33102,
-33085,
-32998,
-32891,
-32698,
-32450,
-32278,
-32170,
-32137,
-32029,
-31752,
-31261,
-30614,
-30018,
-29597,
-29452,
-29497,
-29622,
-29650,
-29565,
-29363,
-29253,
-29290,
-29601,
-30135,
-30848,
-31623,
-32373,
-33012,
-33486,
-33786,
-33895,
-33934,
-33966,
-34082,
-34340,
-34647,
-34938,
-35112,
-35097,
-34969,
-34735,
-34544,
-34380,
-34279,
-34143,
-33936,
-33623,
-33241,
-32826,
-32462,
-32126,
-31908,
-31705,
-31633,
-31596,
-31681,
-31800,
-31914,
-31944,
-31874,
-31772,
-31701,
-31821,
-32017,
-32278,
-32373,
-32198,
-31794,
-31217,
-30694,
-30231,
-29936,
-29671,
-29418,
-29130,
-28778,
-28425,
-28042,
-27687,
-27265,
-26832,
-26264,
-25619,
-24876,
-24095,
-23336,
-22642,
-22078,
-21615,
-21278,
-21037,
-20852,
-20727,
-20566,
-20418,
-20279,
-20217,
-20262,
-20379,
-20473,
-20419,
-20110,
-19575,
-18918,
-18372,
-18008,
-17980,
-18056,
-18196,
-18168,
-18056,
-17976,
-18072,
-18336,
-18542,
-18427,
-17933,
-17198,
-16657,
-16437,
-16454,
-16347,
-15938,
-15550,
-15921,
-17707,
-20957,
-24897,
-28318,
-30351,
-30958,
-30873,
-31197,
-32537,
-34800,
-37280,
-39151,
-39968,
-39856,
-39298,
-38918,
-39047,
-39772,
-40717,
-41595,
-42063,
-42144,
-42111,
-42175,
-42618,
-43132,
-43623,
-43591,
-43214,
-42521,
-41827,
-41229,
-40775,
-40566,
-40932,
-42209,
-44491,
-47357,
-49963,
-51579,
-52094,
-52014,
-52193,
-53037,
-54319,
-55354,
-55570,
-54867,
-53819,
-52783,
-52142,
-51528,
-50674,
-49372,
-47702,
-45982,
-44380,
-43036,
-41890,
-40990,
-40239,
-39589,
-38830,
-37833,
-36635,
-35394,
-34319,
-33434,
-32600,
-31630,
-30562,
-29637,
-29272,
-29594,
-30561,
-31734,
-32782,
-33516,
-33889,
-34105,
-34108,
-33994,
-33680,
-33263,
-32831,
-32393,
-31855,
-31037,
-29891,
-28449,
-27015,
-25824,
-25009,
-24531,
-24124,
-23685,
-23070,
-22463,
-21971,
-21869,
-22100,
-22722,
-23421,
-24010,
-24378,
-24424,
-24447,
-24504,
-24894,
-25550,
-26441,
-27400,
-28272,
-29096,
-29903,
-30785,
-31798,
-32743,
-33514,
-33851,
-33794,
-33414,
-32969,
-32640,
-32441,
-32342,
-32162,
-31908,
-31654,
-31502,
-31591,
-31826,
-32232,
-32686,
-33277,
-34069,
-35046,
-36153,
-37212,
-38193,
-39031,
-39825,
-40608,
-41308,
-41880,
-42150,
-42250,
-42113,
-42027,
-41908,
-41876,
-41867,
-41852,
-41882,
-41855,
-41804,
-41557,
-41148,
-40522,
-39697,
-38773,
-37723,
-36687,
-35670,
-34819,
-34151,
-33709,
-33451,
-33389,
-33514,
-33920,
-34594,
-35495,
-36437,
-37308,
-37935,
-38422,
-38768,
-39039,
-39177,
-39127,
-38873,
-38414,
-37858,
-37197,
-36438,
-35583,
-34611,
-33719,
-32929,
-32346,
-31830,
-31266,
-30638,
-29938,
-29383,
-28970,
-28680,
-28375,
-27924,
-27396,
-26936,
-26797,
-27094,
-27831,
-28856,
-29964,
-31091,
-32084,
-33096,
-34053,
-35015,
-35900,
-36597,
-37047,
-37246,
-37200,
-37024,
-36720,
-36331,
-35850,
-35218,
-34529,
-33774,
-33081,
-32456,
-31964,
-31600,
-31333,
-31163,
-31084,
-31067,
-31156,
-31280,
-31464,
-31682,
-31923,
-32219,
-32562,
-32982,
-33405,
-33889,
-34327,
-34837,
-35329,
-35897,
-36443,
-36899,
-37129,
-37053,
-36626,
-35977,
-35146,
-34298,
-33382,
-32434,
-31354,
-30189,
-29005,
-27878,
-26922,
-26127,
-25594,
-25228,
-25110,
-25106,
-25200,
-25274,
-25320,
-25315,
-25289,
-25242,
-25128,
-24913,
-24567,
-24139,
-23674,
-23254,
-22836,
-22496,
-22127,
-21843,
-21583,
-21409,
-21254,
-21037,
-20661,
-20101,
-19379,
-18629,
-17888,
-17214,
-16550,
-15863,
-15179,
-14610,
-14342,
-14403,
-14810,
-15305,
-15802,
-16163,
-16518,
-16881,
-17280,
-17521,
-17637,
-17612,
-17652,
-17746,
-17769,
-17382,
-16704,
-16035,
-16350,
-18191,
-21584,
-25691,
-29236,
-31348,
-32009,
-32006,
-32428,
-33884,
-36196,
-38522,
-39952,
-40071,
-39190,
-38033,
-37466,
-37757,
-38830,
-40048,
-40983,
-41433,
-41548,
-41754,
-42235,
-43083,
-44068,
-44950,
-45555,
-45853,
-45852,
-45631,
-45201,
-44828,
-44741,
-45408,
-47030,
-49492,
-52295,
-54665,
-56150,
-56645,
-56642,
-56643,
-56997,
-57485,
-57678,
-57196,
-55968,
-54361,
-52713,
-51234,
-49847,
-48278,
-46498,
-44530,
-42707,
-41208,
-40166,
-39520,
-39117,
-38842,
-38613,
-38369,
-38137,
-37842,
-37518,
-37026,
-36373,
-35501,
-34415,
-33307,
-32298,
-31596,
-31272,
-31288,
-31456,
-31613,
-31516,
-31140,
-30498,
-29697,
-28860,
-28049,
-27238,
-26403,
-25460,
-24429,
-23348,
-22281,
-21357,
-20638,
-20254,
-20177,
-20375,
-20691,
-20950,
-21161,
-21361,
-21873,
-22779,
-24178,
-25741,
-27132,
-28015,
-28273,
-28059,
-27669,
-27353,
-27329,
-27516,
-27850,
-28131,
-28245,
-28236,
-28129,
-28126,
-28339,
-28752,
-29326,
-29797,
-30069,
-30039,
-29904,
-29766,
-29909,
-30370,
-31125,
-32067,
-32993,
-33895,
-34684,
-35489,
-36243,
-37096,
-37976,
-38881,
-39828,
-40732,
-41620,
-42443,
-43127,
-43632,
-43836,
-43778,
-43395,
-42764,
-41967,
-41101,
-40270,
-39597,
-39064,
-38639,
-38227,
-37769,
-37362,
-37110,
-37135,
-37412,
-37778,
-37978,
-37918,
-37597,
-37205,
-36932,
-36808,
-36868,
-36896,
-36905,
-36826,
-36750,
-36713,
-36715,
-36749,
-36730,
-36661,
-36527,
-36395,
-36288,
-36298,
-36318,
-36318,
-36111,
-35606,
-34784,
-33721,
-32615,
-31616,
-30814,
-30213,
-29689,
-29227,
-28799,
-28521,
-28459,
-28654,
-29044,
-29486,
-29882,
-30108,
-30242,
-30338,
-30520,
-30843,
-31314,
-31847,
-32375,
-32798,
-33140,
-33319,
-33536,
-33688,
-34009,
-34402,
-34939,
-35478,
-35973,
-36264,
-36379,
-36340,
-36230,
-36087,
-35909,
-35628,
-35227,
-34714,
-34161,
-33681,
-33322,
-33085,
-33029,
-33065,
-33266,
-33545,
-33888,
-34245,
-34526,
-34763,
-34913,
-35069,
-35224,
-35459,
-35644,
-35876,
-35929,
-35911,
-35690,
-35364,
-34931,
-34480,
-34035,
-33611,
-33219,
-32723,
-32226,
-31536,
-30827,
-30058,
-29315,
-28654,
-27971,
-27330,
-26623,
-26010,
-25511,
-25230,
-25124,
-25110,
-24994,
-24771,
-24428,
-24030,
-23744,
-23420,
-23146,
-22712,
-22183,
-21575,
-20993,
-20472,
-20016,
-19581,
-19141,
-18654,
-18214,
-17738,
-17347,
-16907,
-16507,
-16026,
-15459,
-14829,
-14231,
-13861,
-13832,
-14126,
-14467,
-14601,
-14386,
-14031,
-13875,
-14202,
-14872,
-15519,
-15666,
-15226,
-14498,
-13999,
-14028,
-14473,
-14891,
-14890,
-14688,
-14861,
-16350,
-19473,
-23913,
-28447,
-31981,
-33792,
-34387,
-34691,
-35816,
-37876,
-40351,
-42059,
-42374,
-41449,
-40117,
-39429,
-39734,
-40809,
-41856,
-42359,
-42196,
-41855,
-41851,
-42552,
-43791,
-45233,
-46460,
-47332,
-47927,
-48385,
-48782,
-49050,
-49183,
-49317,
-49849,
-51157,
-53386,
-56201,
-58944,
-60904,
-61705,
-61556,
-60962,
-60516,
-60361,
-60280,
-59696,
-58303,
-56144,
-53638,
-51405,
-49594,
-48204,
-46779,
-45147,
-43338,
-41732,
-40634,
-40164,
-40128,
-40264,
-40424,
-40625,
-40938,
-41329,
-41593,
-41514,
-40914,
-39867,
-38526,
-37122,
-35744,
-34484,
-33283,
-32193,
-31157,
-30254,
-29414,
-28695,
-27938,
-27116,
-26080,
-24902,
-23593,
-22384,
-21374,
-20678,
-20209,
-19863,
-19523,
-19197,
-19031,
-19088,
-19444,
-19979,
-20557,
-21084,
-21624,
-22306,
-23247,
-24479,
-25769,
-26902,
-27611,
-27827,
-27597,
-27079,
-26414,
-25787,
-25202,
-24740,
-24367,
-24063,
-23952,
-23992,
-24357,
-24956,
-25810,
-26744,
-27657,
-28447,
-29115,
-29715,
-30296,
-30948,
-31645,
-32397,
-33181,
-33967,
-34751,
-35440,
-36050,
-36529,
-36894,
-37252,
-37626,
-38121,
-38737,
-39406,
-40098,
-40678,
-41061,
-41226,
-41094,
-40772,
-40270,
-39654,
-38998,
-38336,
-37752,
-37347,
-37171,
-37259,
-37566,
-37965,
-38376,
-38702,
-38914,
-38980,
-38901,
-38585,
-38080,
-37372,
-36591,
-35892,
-35363,
-35055,
-34886,
-34739,
-34608,
-34553,
-34663,
-35160,
-35832,
-36618,
-37121,
-37177,
-36815,
-36219,
-35676,
-35253,
-34865,
-34283,
-33317,
-32089,
-30879,
-30134,
-30010,
-30457,
-31065,
-31467,
-31469,
-31195,
-31021,
-31226,
-31822,
-32550,
-32953,
-32810,
-32119,
-31302,
-30729,
-30768,
-31270,
-32057,
-32690,
-33136,
-33336,
-33634,
-34089,
-34805,
-35508,
-36002,
-36031,
-35624,
-34899,
-34051,
-33335,
-32840,
-32659,
-32844,
-33302,
-33979,
-34716,
-35380,
-35905,
-36296,
-36627,
-36993,
-37383,
-37760,
-38091,
-38255,
-38378,
-38368,
-38361,
-38291,
-38179,
-37985,
-37731,
-37412,
-37081,
-36787,
-36553,
-36441,
-36398,
-36344,
-36146,
-35755,
-35108,
-34332,
-33464,
-32624,
-31779,
-30997,
-30221,
-29592,
-29110,
-28842,
-28724,
-28728,
-28773,
-28906,
-29002,
-29097,
-28932,
-28490,
-27741,
-26773,
-25777,
-24801,
-23882,
-22892,
-21872,
-20816,
-19932,
-19250,
-18841,
-18477,
-18143,
-17677,
-17229,
-16859,
-16652,
-16639,
-16660,
-16618,
-16333,
-15731,
-14843,
-13931,
-13224,
-13039,
-13286,
-13727,
-13911,
-13703,
-13143,
-12790,
-12821,
-13394,
-13911,
-14011,
-13343,
-12263,
-11170,
-10518,
-10244,
-10113,
-9887,
-9811,
-10473,
-12578,
-16245,
-20965,
-25569,
-29066,
-30980,
-31856,
-32564,
-33955,
-35970,
-37962,
-38943,
-38560,
-37148,
-35694,
-35017,
-35352,
-36256,
-37011,
-37239,
-37038,
-37021,
-37602,
-39042,
-40983,
-43088,
-44893,
-46314,
-47339,
-48064,
-48586,
-48898,
-49116,
-49470,
-50225,
-51731,
-53930,
-56630,
-59189,
-61092,
-61966,
-61976,
-61452,
-60971,
-60580,
-60200,
-59341,
-57793,
-55726,
-53552,
-51788,
-50504,
-49417,
-48171,
-46624,
-45050,
-43949,
-43577,
-43874,
-44396,
-44901,
-45326,
-45845,
-46561,
-47159,
-47246,
-46467,
-44821,
-42700,
-40461,
-38372,
-36437,
-34632,
-33013,
-31730,
-30874,
-30343,
-29981,
-29554,
-29098,
-28553,
-28068,
-27487,
-26875,
-26178,
-25599,
-25195,
-24970,
-24696,
-24222,
-23515,
-22796,
-22303,
-22152,
-22163,
-22120,
-21874,
-21631,
-21626,
-22131,
-23026,
-24018,
-24619,
-24702,
-24161,
-23346,
-22421,
-21640,
-21104,
-20888,
-20988,
-21440,
-22154,
-23102,
-24206,
-25451,
-26793,
-28153,
-29438,
-30480,
-31260,
-31716,
-31945,
-32017,
-31930,
-31871,
-31757,
-31832,
-32021,
-32396,
-32819,
-33248,
-33592,
-33963,
-34389,
-34956,
-35657,
-36484,
-37388,
-38312,
-39268,
-40058,
-40650,
-40781,
-40524,
-39896,
-39150,
-38498,
-38063,
-37925,
-38010,
-38259,
-38591,
-38945,
-39250,
-39427,
-39367,
-39064,
-38492,
-37732,
-36879,
-36031,
-35277,
-34635,
-34192,
-33907,
-33902,
-34200,
-34796,
-35677,
-36592,
-37330,
-37699,
-37638,
-37342,
-36975,
-36743,
-36494,
-36133,
-35334,
-34155,
-32781,
-31565,
-30775,
-30381,
-30232,
-29984,
-29561,
-29073,
-28754,
-28864,
-29452,
-30295,
-31098,
-31623,
-31675,
-31436,
-31000,
-30618,
-30362,
-30304,
-30420,
-30773,
-31342,
-32151,
-33054,
-33918,
-34540,
-34805,
-34739,
-34428,
-34004,
-33551,
-33053,
-32497,
-31861,
-31272,
-30851,
-30783,
-31112,
-31817,
-32737,
-33739,
-34720,
-35621,
-36509,
-37298,
-38109,
-38762,
-39365,
-39765,
-39974,
-39909,
-39606,
-39030,
-38422,
-37714,
-37200,
-36689,
-36409,
-36214,
-36300,
-36589,
-37116,
-37685,
-38144,
-38297,
-38111,
-37572,
-36878,
-36089,
-35351,
-34667,
-34094,
-33616,
-33348,
-33279,
-33400,
-33592,
-33744,
-33721,
-33580,
-33355,
-33080,
-32781,
-32240,
-31455,
-30306,
-28944,
-27508,
-26072,
-24707,
-23350,
-22071,
-20933,
-20128,
-19790,
-19873,
-20211,
-20580,
-20777,
-20829,
-20828,
-20940,
-21098,
-21187,
-20845,
-19982,
-18620,
-17067,
-15726,
-14825,
-14413,
-14270,
-14136,
-13853,
-13496,
-13210,
-13132,
-13150,
-13100,
-12665,
-11911,
-10920,
-10092,
-9503,
-9128,
-8716,
-8208,
-7952,
-8601,
-10748,
-14577,
-19457,
-24390,
-28308,
-30769,
-32016,
-32695,
-33516,
-34553,
-35516,
-35759,
-34965,
-33313,
-31426,
-30016,
-29497,
-29726,
-30372,
-30994,
-31551,
-32298,
-33484,
-35383,
-37784,
-40521,
-43185,
-45566,
-47369,
-48527,
-48924,
-48795,
-48545,
-48705,
-49723,
-51696,
-54317,
-57073,
-59297,
-60681,
-61099,
-60796,
-60113,
-59319,
-58568,
-57818,
-56932,
-55847,
-54539,
-53251,
-52070,
-51191,
-50509,
-49946,
-49397,
-48792,
-48310,
-48047,
-48189,
-48714,
-49546,
-50522,
-51473,
-52125,
-52272,
-51642,
-50093,
-47753,
-44803,
-41640,
-38543,
-35651,
-33135,
-31000,
-29476,
-28556,
-28217,
-28215,
-28242,
-28119,
-27854,
-27568,
-27477,
-27594,
-27877,
-28184,
-28400,
-28441,
-28246,
-27756,
-26943,
-25914,
-24740,
-23636,
-22621,
-21694,
-20808,
-19933,
-19229,
-18810,
-18824,
-19143,
-19602,
-19913,
-19941,
-19629,
-19172,
-18666,
-18449,
-18536,
-19131,
-20102,
-21436,
-22926,
-24483,
-26039,
-27515,
-28919,
-30113,
-30973,
-31418,
-31450,
-31203,
-30815,
-30431,
-30056,
-29734,
-29461,
-29356,
-29473,
-29837,
-30386,
-30944,
-31504,
-32012,
-32692,
-33651,
-34997,
-36671,
-38486,
-40239,
-41712,
-42784,
-43366,
-43450,
-43101,
-42392,
-41499,
-40551,
-39718,
-39047,
-38560,
-38190,
-37857,
-37575,
-37311,
-37087,
-36956,
-36796,
-36600,
-36290,
-35900,
-35567,
-35400,
-35523,
-35881,
-36397,
-36861,
-37192,
-37389,
-37494,
-37609,
-37628,
-37496,
-37052,
-36333,
-35502,
-34784,
-34360,
-34230,
-34195,
-33963,
-33391,
-32438,
-31293,
-30153,
-29171,
-28405,
-27758,
-27270,
-26986,
-27033,
-27514,
-28292,
-29180,
-29873,
-30262,
-30375,
-30400,
-30470,
-30578,
-30664,
-30565,
-30316,
-30036,
-29854,
-29881,
-29974,
-30017,
-29821,
-29406,
-28933,
-28611,
-28698,
-29200,
-30044,
-30991,
-31827,
-32459,
-32861,
-33202,
-33561,
-34037,
-34557,
-35051,
-35455,
-35721,
-35956,
-36148,
-36370,
-36585,
-36714,
-36774,
-36717,
-36615,
-36484,
-36387,
-36290,
-36272,
-36266,
-36389,
-36566,
-36876,
-37225,
-37637,
-37979,
-38274,
-38371,
-38377,
-38189,
-38007,
-37862,
-37841,
-37950,
-38075,
-38120,
-38043,
-37759,
-37368,
-36854,
-36240,
-35557,
-34832,
-34108,
-33461,
-32882,
-32330,
-31700,
-30912,
-29929,
-28839,
-27722,
-26756,
-25925,
-25303,
-24781,
-24334,
-23958,
-23625,
-23391,
-23228,
-23045,
-22834,
-22447,
-21894,
-21188,
-20365,
-19534,
-18698,
-17950,
-17217,
-16522,
-15791,
-15055,
-14320,
-13683,
-13119,
-12646,
-12054,
-11310,
-10248,
-9089,
-8017,
-7341,
-7253,
-7547,
-7940,
-7971,
-7575,
-7127,
-7441,
-9248,
-12895,
-17802,
-22891,
-26873,
-29111,
-29742,
-29544,
-29430,
-29787,
-30477,
-30812,
-30426,
-29128,
-27538,
-26250,
-25890,
-26532,
-27916,
-29523,
-30978,
-32174,
-33320,
-34681,
-36518,
-38821,
-41431,
-43991,
-46187,
-47697,
-48444,
-48510,
-48312,
-48341,
-49162,
-50967,
-53692,
-56723,
-59417,
-61091,
-61551,
-60917,
-59724,
-58473,
-57559,
-57012,
-56684,
-56364,
-55877,
-55387,
-54880,
-54672,
-54657,
-54876,
-55149,
-55326,
-55296,
-55063,
-54715,
-54525,
-54656,
-55160,
-55849,
-56268,
-56027,
-54872,
-52861,
-50297,
-47479,
-44686,
-42033,
-39534,
-37320,
-35430,
-34039,
-33100,
-32618,
-32343,
-32143,
-31893,
-31535,
-31186,
-30876,
-30787,
-30847,
-31091,
-31285,
-31322,
-31006,
-30295,
-29216,
-27941,
-26545,
-25158,
-23809,
-22446,
-21119,
-19778,
-18609,
-17636,
-17064,
-16869,
-17043,
-17485,
-17979,
-18440,
-18706,
-18876,
-18956,
-19119,
-19493,
-20105,
-21027,
-22119,
-23353,
-24528,
-25566,
-26326,
-26824,
-27001,
-27027,
-26861,
-26679,
-26423,
-26183,
-25958,
-25854,
-25903,
-26177,
-26670,
-27365,
-28199,
-29135,
-30099,
-31038,
-31970,
-32951,
-34184,
-35747,
-37722,
-39922,
-41970,
-43589,
-44448,
-44606,
-44197,
-43438,
-42495,
-41436,
-40283,
-39106,
-38009,
-37145,
-36620,
-36355,
-36405,
-36520,
-36774,
-36995,
-37241,
-37489,
-37695,
-37972,
-38173,
-38491,
-38788,
-39117,
-39415,
-39578,
-39600,
-39390,
-38970,
-38377,
-37635,
-36794,
-35984,
-35175,
-34570,
-34009,
-33556,
-33051,
-32453,
-31898,
-31388,
-31120,
-30982,
-30789,
-30364,
-29607,
-28734,
-28134,
-28098,
-28833,
-30044,
-31257,
-31996,
-31930,
-31203,
-30122,
-29136,
-28451,
-28051,
-27651,
-27022,
-26049,
-24930,
-23950,
-23397,
-23390,
-23854,
-24568,
-25373,
-26103,
-26783,
-27510,
-28337,
-29434,
-30646,
-31969,
-33132,
-34032,
-34527,
-34697,
-34590,
-34382,
-34144,
-33907,
-33674,
-33393,
-33099,
-32738,
-32435,
-32173,
-32125,
-32243,
-32605,
-33055,
-33541,
-33939,
-34243,
-34556,
-34956,
-35618,
-36504,
-37559,
-38646,
-39562,
-40292,
-40664,
-40843,
-40801,
-40709,
-40612,
-40494,
-40375,
-40105,
-39694,
-39120,
-38478,
-37836,
-37278,
-36774,
-36270,
-35722,
-35149,
-34669,
-34358,
-34336,
-34504,
-34728,
-34832,
-34625,
-34145,
-33417,
-32661,
-31930,
-31319,
-30675,
-30035,
-29234,
-28373,
-27491,
-26608,
-25779,
-24910,
-23950,
-22901,
-21761,
-20660,
-19647,
-18780,
-18034,
-17351,
-16646,
-15960,
-15286,
-14715,
-14204,
-13637,
-12829,
-11686,
-10283,
-8921,
-7886,
-7373,
-7203,
-7045,
-6606,
-5935,
-5497,
-6057,
-8068,
-11560,
-15881,
-19955,
-22941,
-24379,
-24592,
-24307,
-24172,
-24526,
-25106,
-25405,
-25064,
-24048,
-22859,
-21976,
-21930,
-22685,
-23994,
-25471,
-26721,
-27817,
-28803,
-30074,
-31741,
-33935,
-36397,
-38853,
-40906,
-42319,
-42993,
-43206,
-43302,
-43823,
-45135,
-47363,
-50305,
-53376,
-56026,
-57602,
-58025,
-57396,
-56227,
-55069,
-54292,
-54003,
-54059,
-54204,
-54287,
-54324,
-54403,
-54701,
-55174,
-55668,
-56006,
-55939,
-55601,
-55062,
-54695,
-54738,
-55304,
-56325,
-57431,
-58233,
-58309,
-57495,
-55832,
-53662,
-51251,
-48920,
-46664,
-44483,
-42405,
-40409,
-38744,
-37468,
-36597,
-36048,
-35637,
-35322,
-35048,
-34856,
-34756,
-34758,
-34825,
-34909,
-34915,
-34757,
-34240,
-33355,
-32052,
-30503,
-28850,
-27207,
-25626,
-24016,
-22430,
-20862,
-19535,
-18595,
-18206,
-18324,
-18881,
-19636,
-20402,
-20971,
-21265,
-21202,
-20933,
-20529,
-20194,
-20086,
-20242,
-20729,
-21464,
-22393,
-23364,
-24317,
-25074,
-25642,
-25997,
-26156,
-26241,
-26217,
-26185,
-26079,
-26023,
-25964,
-26074,
-26279,
-26691,
-27162,
-27771,
-28471,
-29282,
-30373,
-31662,
-33354,
-35314,
-37559,
-39884,
-42059,
-43824,
-44931,
-45302,
-45001,
-44114,
-42955,
-41557,
-40129,
-38705,
-37427,
-36444,
-35915,
-35909,
-36512,
-37458,
-38665,
-39813,
-40750,
-41486,
-41920,
-42222,
-42339,
-42307,
-42098,
-41700,
-41132,
-40515,
-39833,
-39252,
-38696,
-38197,
-37696,
-37050,
-36325,
-35436,
-34592,
-33756,
-33074,
-32360,
-31606,
-30613,
-29567,
-28504,
-27733,
-27249,
-27127,
-27123,
-27229,
-27473,
-28050,
-29203,
-30967,
-33041,
-34978,
-36072,
-36021,
-34683,
-32432,
-29763,
-27138,
-24812,
-22775,
-20915,
-19145,
-17579,
-16442,
-16006,
-16459,
-17687,
-19522,
-21616,
-23683,
-25565,
-27126,
-28451,
-29498,
-30373,
-31072,
-31617,
-32003,
-32196,
-32157,
-31920,
-31546,
-31166,
-30956,
-30932,
-31110,
-31338,
-31407,
-31296,
-30932,
-30505,
-30175,
-30013,
-30102,
-30331,
-30645,
-31024,
-31517,
-32244,
-33341,
-34766,
-36512,
-38303,
-40054,
-41526,
-42696,
-43509,
-43960,
-44102,
-43863,
-43327,
-42367,
-41126,
-39609,
-38036,
-36573,
-35405,
-34632,
-34310,
-34341,
-34719,
-35322,
-36151,
-37036,
-37949,
-38692,
-39235,
-39476,
-39461,
-39148,
-38623,
-37805,
-36830,
-35655,
-34407,
-33134,
-31825,
-30543,
-29271,
-28080,
-27011,
-26182,
-25499,
-24938,
-24326,
-23540,
-22569,
-21534,
-20584,
-19876,
-19430,
-19078,
-18689,
-18079,
-17245,
-16238,
-15201,
-14155,
-13192,
-12273,
-11449,
-10593,
-9637,
-8476,
-7222,
-6213,
-5927,
-6781,
-8871,
-11781,
-14853,
-17300,
-18796,
-19431,
-19715,
-20236,
-21209,
-22540,
-23655,
-24154,
-23887,
-23134,
-22486,
-22409,
-23073,
-24201,
-25373,
-26163,
-26490,
-26597,
-26869,
-27670,
-29122,
-31078,
-33225,
-35185,
-36717,
-37751,
-38526,
-39269,
-40502,
-42323,
-44917,
-47946,
-51048,
-53664,
-55444,
-56192,
-56131,
-55534,
-54860,
-54340,
-54051,
-53967,
-53931,
-53911,
-53958,
-54089,
-54393,
-54796,
-55102,
-55151,
-54760,
-53990,
-53059,
-52250,
-51949,
-52247,
-53130,
-54327,
-55414,
-56043,
-55958,
-55138,
-53797,
-52174,
-50519,
-48939,
-47374,
-45794,
-44126,
-42479,
-40982,
-39802,
-38905,
-38271,
-37715,
-37114,
-36521,
-35926,
-35541,
-35371,
-35430,
-35590,
-35665,
-35491,
-34944,
-33970,
-32702,
-31167,
-29542,
-27853,
-26168,
-24465,
-22847,
-21352,
-20161,
-19358,
-19074,
-19257,
-19828,
-20544,
-21239,
-21700,
-21903,
-21793,
-21511,
-21099,
-20769,
-20563,
-20653,
-21020,
-21629,
-22352,
-23045,
-23614,
-24075,
-24443,
-24769,
-25128,
-25377,
-25639,
-25728,
-25831,
-25911,
-26116,
-26418,
-26834,
-27321,
-27831,
-28376,
-28978,
-29755,
-30781,
-32159,
-33881,
-35888,
-38070,
-40208,
-42126,
-43638,
-44597,
-45038,
-44903,
-44382,
-43476,
-42413,
-41218,
-40075,
-39099,
-38433,
-38107,
-38249,
-38674,
-39470,
-40313,
-41250,
-41982,
-42533,
-42821,
-42936,
-42931,
-42895,
-42774,
-42564,
-42155,
-41576,
-40859,
-40138,
-39539,
-38992,
-38543,
-37978,
-37304,
-36538,
-35675,
-34935,
-34200,
-33569,
-32851,
-32077,
-31196,
-30286,
-29452,
-28696,
-28094,
-27508,
-27082,
-26734,
-26813,
-27288,
-28343,
-29656,
-30997,
-31835,
-32056,
-31545,
-30609,
-29495,
-28368,
-27228,
-25890,
-24303,
-22481,
-20739,
-19375,
-18670,
-18608,
-19115,
-19895,
-20843,
-21905,
-23120,
-24540,
-26108,
-27646,
-29036,
-30025,
-30715,
-31001,
-31112,
-30992,
-30786,
-30436,
-30076,
-29714,
-29492,
-29422,
-29454,
-29568,
-29714,
-29900,
-30185,
-30586,
-31085,
-31595,
-31987,
-32240,
-32319,
-32461,
-32708,
-33209,
-33932,
-34731,
-35594,
-36395,
-37232,
-38088,
-39042,
-39923,
-40717,
-41182,
-41258,
-40930,
-40218,
-39290,
-38224,
-37255,
-36386,
-35798,
-35427,
-35331,
-35480,
-35847,
-36459,
-37197,
-38033,
-38818,
-39497,
-39918,
-40138,
-40017,
-39658,
-38983,
-38051,
-36899,
-35568,
-34176,
-32772,
-31463,
-30218,
-29132,
-28144,
-27289,
-26596,
-26029,
-25610,
-25295,
-24989,
-24688,
-24274,
-23752,
-23156,
-22441,
-21709,
-20891,
-20093,
-19257,
-18479,
-17680,
-16889,
-16006,
-15016,
-13875,
-12712,
-11505,
-10418,
-9304,
-8246,
-7252,
-6580,
-6545,
-7552,
-9650,
-12748,
-16243,
-19520,
-22086,
-23660,
-24505,
-24863,
-25074,
-25207,
-25056,
-24527,
-23515,
-22391,
-21482,
-21175,
-21532,
-22318,
-23211,
-23905,
-24389,
-24870,
-25664,
-27046,
-28990,
-31398,
-33875,
-36213,
-38142,
-39620,
-40716,
-41560,
-42418,
-43477,
-44949,
-46848,
-49100,
-51393,
-53439,
-54907,
-55681,
-55796,
-55368,
-54653,
-53789,
-52956,
-52210,
-51628,
-51209,
-50926,
-50749,
-50625,
-50508,
-50418,
-50283,
-50233,
-50264,
-50508,
-51043,
-51906,
-53039,
-54258,
-55286,
-55822,
-55617,
-54644,
-52945,
-50864,
-48615,
-46479,
-44529,
-42821,
-41304,
-40023,
-38986,
-38204,
-37722,
-37435,
-37360,
-37429,
-37610,
-37906,
-38170,
-38336,
-38224,
-37756,
-36954,
-35849,
-34620,
-33339,
-32077,
-30879,
-29650,
-28456,
-27241,
-26113,
-25094,
-24237,
-23581,
-23039,
-22653,
-22339,
-22134,
-22010,
-21981,
-22001,
-22065,
-22096,
-22080,
-21978,
-21868,
-21781,
-21848,
-22131,
-22669,
-23445,
-24312,
-25099,
-25639,
-25801,
-25664,
-25258,
-24859,
-24456,
-24227,
-24084,
-24061,
-24185,
-24521,
-25112,
-25999,
-27087,
-28364,
-29673,
-31075,
-32449,
-33938,
-35427,
-37034,
-38598,
-40110,
-41392,
-42332,
-42811,
-42803,
-42353,
-41638,
-40795,
-40057,
-39450,
-39042,
-38777,
-38607,
-38547,
-38591,
-38812,
-39247,
-39848,
-40592,
-41274,
-41868,
-42226,
-42427,
-42509,
-42542,
-42572,
-42540,
-42413,
-42154,
-41773,
-41328,
-40863,
-40407,
-39929,
-39370,
-38717,
-37901,
-36969,
-35889,
-34765,
-33622,
-32604,
-31716,
-30975,
-30326,
-29669,
-29012,
-28359,
-27865,
-27570,
-27559,
-27672,
-27832,
-27855,
-27776,
-27671,
-27715,
-28042,
-28602,
-29217,
-29533,
-29348,
-28503,
-27236,
-25811,
-24627,
-23896,
-23592,
-23595,
-23573,
-23515,
-23265,
-23124,
-23119,
-23443,
-23970,
-24697,
-25394,
-26039,
-26534,
-26910,
-27187,
-27421,
-27653,
-27854,
-28071,
-28205,
-28236,
-28140,
-28004,
-27956,
-28201,
-28760,
-29680,
-30665,
-31509,
-31945,
-31932,
-31590,
-31194,
-30950,
-31032,
-31403,
-31946,
-32585,
-33218,
-33868,
-34544,
-35271,
-35981,
-36654,
-37161,
-37533,
-37722,
-37784,
-37820,
-37825,
-37897,
-37996,
-38127,
-38234,
-38292,
-38269,
-38184,
-38112,
-38113,
-38308,
-38709,
-39308,
-39958,
-40557,
-40911,
-40950,
-40656,
-40070,
-39259,
-38293,
-37238,
-36080,
-34883,
-33640,
-32515,
-31495,
-30804,
-30293,
-30051,
-29837,
-29640,
-29322,
-28965,
-28586,
-28216,
-27872,
-27439,
-26892,
-26132,
-25243,
-24277,
-23329,
-22503,
-21693,
-20958,
-20075,
-19098,
-17915,
-16604,
-15195,
-13767,
-12400,
-11076,
-9884,
-8750,
-7777,
-6981,
-6573,
-6725,
-7644,
-9529,
-12234,
-15610,
-19148,
-22389,
-24875,
-26452,
-27120,
-27182,
-26825,
-26242,
-25421,
-24360,
-23097,
-21791,
-20735,
-20094,
-20021,
-20383,
-21116,
-22055,
-23226,
-24635,
-26388,
-28470,
-30869,
-33409,
-35943,
-38194,
-40038,
-41364,
-42303,
-43078,
-44013,
-45377,
-47224,
-49487,
-51766,
-53796,
-55168,
-55783,
-55675,
-54959,
-53937,
-52806,
-51774,
-50975,
-50472,
-50289,
-50399,
-50699,
-51119,
-51442,
-51660,
-51729,
-51733,
-51849,
-52169,
-52814,
-53732,
-54851,
-55973,
-56932,
-57476,
-57458,
-56679,
-55171,
-53010,
-50497,
-47916,
-45542,
-43508,
-41825,
-40458,
-39321,
-38449,
-37785,
-37382,
-37158,
-37132,
-37156,
-37298,
-37432,
-37614,
-37741,
-37747,
-37507,
-37006,
-36091,
-34974,
-33590,
-32192,
-30755,
-29406,
-27983,
-26591,
-25098,
-23676,
-22370,
-21339,
-20591,
-20170,
-19941,
-19869,
-19910,
-20072,
-20392,
-20885,
-21470,
-22095,
-22617,
-23012,
-23234,
-23421,
-23563,
-23805,
-24080,
-24322,
-24485,
-24391,
-24095,
-23597,
-23034,
-22535,
-22201,
-22086,
-22212,
-22548,
-23060,
-23736,
-24506,
-25434,
-26472,
-27659,
-29011,
-30547,
-32233,
-34067,
-35928,
-37710,
-39354,
-40695,
-41700,
-42342,
-42540,
-42438,
-41992,
-41396,
-40659,
-39978,
-39339,
-38870,
-38509,
-38364,
-38365,
-38609,
-39071,
-39737,
-40619,
-41548,
-42591,
-43541,
-44406,
-45064,
-45419,
-45475,
-45241,
-44802,
-44291,
-43668,
-43039,
-42278,
-41440,
-40495,
-39540,
-38625,
-37744,
-36929,
-36011,
-35099,
-34041,
-33064,
-32119,
-31328,
-30662,
-30070,
-29525,
-29031,
-28544,
-28169,
-27899,
-27692,
-27578,
-27433,
-27284,
-27073,
-26863,
-26552,
-26182,
-25655,
-24991,
-24264,
-23537,
-22973,
-22629,
-22555,
-22690,
-22927,
-23189,
-23368,
-23462,
-23557,
-23649,
-23841,
-24086,
-24368,
-24586,
-24774,
-24838,
-24935,
-24978,
-25083,
-25218,
-25368,
-25531,
-25685,
-25890,
-26160,
-26533,
-27038,
-27564,
-28143,
-28600,
-28997,
-29264,
-29520,
-29825,
-30256,
-30876,
-31701,
-32646,
-33696,
-34698,
-35601,
-36323,
-36800,
-37089,
-37204,
-37257,
-37348,
-37478,
-37733,
-38052,
-38399,
-38823,
-39217,
-39661,
-40070,
-40442,
-40752,
-40953,
-41072,
-41147,
-41227,
-41384,
-41667,
-42052,
-42508,
-42927,
-43189,
-43234,
-42985,
-42544,
-41859,
-41090,
-40199,
-39244,
-38248,
-37262,
-36346,
-35498,
-34752,
-34060,
-33396,
-32790,
-32214,
-31701,
-31259,
-30784,
-30296,
-29692,
-28989,
-28272,
-27525,
-26847,
-26148,
-25448,
-24600,
-23667,
-22554,
-21421,
-20297,
-19269,
-18346,
-17511,
-16711,
-15947,
-15175,
-14386,
-13618,
-12776,
-11909,
-10917,
-9884,
-8777,
-7758,
-6839,
-6207,
-5885,
-6012,
-6608,
-7848,
-9671,
-12170,
-15086,
-18200,
-21143,
-23544,
-25222,
-26026,
-26077,
-25541,
-24612,
-23501,
-22394,
-21374,
-20669,
-20283,
-20386,
-20932,
-21892,
-23203,
-24742,
-26469,
-28401,
-30510,
-32874,
-35408,
-38075,
-40649,
-43019,
-44962,
-46475,
-47493,
-48203,
-48655,
-49156,
-49703,
-50536,
-51548,
-52719,
-53853,
-54742,
-55208,
-55187,
-54681,
-53883,
-52981,
-52185,
-51698,
-51530,
-51768,
-52282,
-53013,
-53803,
-54567,
-55163,
-55603,
-55818,
-55892,
-55847,
-55783,
-55749,
-55796,
-55829,
-55831,
-55493,
-54841,
-53584,
-51917,
-49818,
-47627,
-45456,
-43538,
-41886,
-40495,
-39303,
-38227,
-37294,
-36505,
-35949,
-35611,
-35553,
-35639,
-35873,
-36054,
-36157,
-36076,
-35741,
-35162,
-34286,
-33167,
-31837,
-30339,
-28780,
-27202,
-25711,
-24287,
-22985,
-21713,
-20511,
-19370,
-18350,
-17573,
-17073,
-16960,
-17179,
-17730,
-18498,
-19419,
-20351,
-21235,
-21928,
-22416,
-22680,
-22801,
-22809,
-22794,
-22785,
-22763,
-22741,
-22669,
-22559,
-22414,
-22244,
-22118,
-22049,
-22162,
-22438,
-23009,
-23812,
-24857,
-26031,
-27272,
-28481,
-29658,
-30733,
-31810,
-32863,
-33939,
-35153,
-36420,
-37816,
-39175,
-40383,
-41311,
-41894,
-42142,
-42172,
-42043,
-41852,
-41601,
-41337,
-41074,
-40833,
-40649,
-40513,
-40395,
-40379,
-40422,
-40695,
-41136,
-41759,
-42498,
-43291,
-44098,
-44921,
-45610,
-46160,
-46348,
-46215,
-45664,
-44884,
-43932,
-42939,
-41937,
-40903,
-39814,
-38663,
-37473,
-36344,
-35251,
-34306,
-33420,
-32641,
-31931,
-31334,
-30824,
-30471,
-30153,
-29930,
-29669,
-29427,
-29119,
-28771,
-28332,
-27800,
-27190,
-26582,
-25963,
-25441,
-24909,
-24354,
-23740,
-23060,
-22512,
-22172,
-22185,
-22539,
-23067,
-23591,
-23887,
-23896,
-23693,
-23420,
-23310,
-23426,
-23753,
-24128,
-24355,
-24347,
-24196,
-23985,
-24000,
-24242,
-24717,
-25200,
-25583,
-25705,
-25753,
-25783,
-26078,
-26632,
-27433,
-28298,
-29064,
-29656,
-30112,
-30524,
-31065,
-31733,
-32573,
-33473,
-34364,
-35220,
-35949,
-36589,
-37098,
-37507,
-37816,
-38109,
-38376,
-38698,
-39054,
-39393,
-39802,
-40113,
-40475,
-40772,
-41073,
-41367,
-41627,
-41846,
-41985,
-41985,
-41908,
-41747,
-41640,
-41645,
-41800,
-42102,
-42417,
-42682,
-42826,
-42803,
-42688,
-42463,
-42190,
-41812,
-41244,
-40465,
-39384,
-38115,
-36724,
-35380,
-34213,
-33207,
-32347,
-31479,
-30583,
-29669,
-28904,
-28335,
-28052,
-27876,
-27723,
-27432,
-27025,
-26577,
-26167,
-25744,
-25268,
-24532,
-23541,
-22257,
-20831,
-19401,
-18017,
-16833,
-15781,
-14908,
-14139,
-13411,
-12681,
-11928,
-11119,
-10314,
-9429,
-8537,
-7547,
-6593,
-5696,
-5081,
-4827,
-5147,
-6083,
-7712,
-9983,
-12776,
-15851,
-18918,
-21674,
-23911,
-25537,
-26576,
-27111,
-27250,
-27032,
-26591,
-25951,
-25276,
-24620,
-24112,
-23821,
-23820,
-24174,
-24888,
-26043,
-27577,
-29513,
-31728,
-34222,
-36873,
-39620,
-42340,
-44887,
-47111,
-48873,
-50176,
-51039,
-51669,
-52194,
-52814,
-53469,
-54181,
-54727,
-55058,
-55068,
-54801,
-54324,
-53790,
-53330,
-53079,
-53086,
-53403,
-53916,
-54579,
-55240,
-55790,
-56145,
-56215,
-56027,
-55575,
-55022,
-54468,
-54063,
-53870,
-53813,
-53908,
-53922,
-53896,
-53593,
-53043,
-52078,
-50735,
-49048,
-47193,
-45305,
-43531,
-41854,
-40265,
-38680,
-37144,
-35695,
-34491,
-33594,
-33069,
-32861,
-32861,
-33017,
-33165,
-33298,
-33313,
-33194,
-32957,
-32487,
-31841,
-30895,
-29716,
-28305,
-26748,
-25125,
-23493,
-21896,
-20327,
-18810,
-17454,
-16297,
-15517,
-15071,
-15079,
-15370,
-16001,
-16759,
-17680,
-18601,
-19482,
-20304,
-20994,
-21614,
-22107,
-22524,
-22829,
-23012,
-23099,
-23038,
-22931,
-22723,
-22513,
-22267,
-22044,
-21886,
-21827,
-21975,
-22315,
-22886,
-23589,
-24407,
-25243,
-26152,
-27110,
-28181,
-29446,
-30794,
-32339,
-33847,
-35400,
-36810,
-38060,
-39119,
-39898,
-40457,
-40754,
-40839,
-40793,
-40605,
-40446,
-40237,
-40126,
-40014,
-39950,
-39895,
-39898,
-39960,
-40196,
-40573,
-41141,
-41860,
-42631,
-43415,
-44163,
-44793,
-45344,
-45732,
-45920,
-45897,
-45583,
-45052,
-44317,
-43472,
-42574,
-41646,
-40688,
-39689,
-38624,
-37539,
-36491,
-35513,
-34704,
-33997,
-33434,
-32893,
-32460,
-32026,
-31769,
-31556,
-31497,
-31499,
-31521,
-31469,
-31342,
-31069,
-30662,
-30147,
-29435,
-28617,
-27610,
-26522,
-25356,
-24244,
-23244,
-22493,
-21938,
-21723,
-21679,
-21926,
-22272,
-22785,
-23312,
-23936,
-24575,
-25206,
-25828,
-26294,
-26603,
-26713,
-26635,
-26479,
-26316,
-26224,
-26211,
-26246,
-26239,
-26163,
-26090,
-26003,
-26110,
-26363,
-26807,
-27378,
-27978,
-28622,
-29322,
-30092,
-31004,
-32002,
-33046,
-34098,
-35046,
-35897,
-36669,
-37287,
-37869,
-38302,
-38637,
-38881,
-38990,
-39031,
-38948,
-38772,
-38529,
-38261,
-38088,
-38080,
-38269,
-38665,
-39126,
-39592,
-40022,
-40334,
-40607,
-40802,
-40954,
-41049,
-41078,
-41078,
-41039,
-41021,
-40990,
-40965,
-40875,
-40722,
-40443,
-40029,
-39478,
-38814,
-38085,
-37352,
-36618,
-35944,
-35291,
-34687,
-34074,
-33436,
-32751,
-32000,
-31193,
-30377,
-29538,
-28786,
-28051,
-27481,
-26939,
-26553,
-26185,
-25895,
-25570,
-25231,
-24806,
-24350,
-23807,
-23202,
-22511,
-21646,
-20694,
-19621,
-18591,
-17670,
-16922,
-16301,
-15760,
-15189,
-14583,
-13913,
-13253,
-12618,
-11999,
-11437,
-10851,
-10297,
-9795,
-9404,
-9242,
-9405,
-10017,
-11176,
-12872,
-15095,
-17682,
-20502,
-23356,
-26067,
-28471,
-30389,
-31730,
-32449,
-32607,
-32342,
-31788,
-31125,
-30484,
-29936,
-29538,
-29340,
-29357,
-29620,
-30146,
-30928,
-32012,
-33373,
-35054,
-36985,
-39166,
-41489,
-43844,
-46091,
-48081,
-49739,
-51034,
-51998,
-52720,
-53306,
-53807,
-54223,
-54580,
-54729,
-54687,
-54346,
-53720,
-52847,
-51818,
-50753,
-49864,
-49238,
-48982,
-49075,
-49377,
-49777,
-50086,
-50227,
-50141,
-49878,
-49530,
-49118,
-48779,
-48484,
-48300,
-48231,
-48233,
-48273,
-48238,
-48061,
-47603,
-46895,
-45867,
-44660,
-43257,
-41836,
-40347,
-38963,
-37586,
-36295,
-35028,
-33756,
-32569,
-31450,
-30506,
-29777,
-29297,
-29010,
-28918,
-28949,
-29064,
-29211,
-29346,
-29398,
-29347,
-29175,
-28855,
-28441,
-27838,
-27096,
-26088,
-24897,
-23487,
-22009,
-20522,
-19209,
-18113,
-17350,
-16942,
-16889,
-17168,
-17722,
-18474,
-19328,
-20206,
-21015,
-21729,
-22326,
-22845,
-23290,
-23721,
-24064,
-24378,
-24541,
-24583,
-24471,
-24205,
-23895,
-23555,
-23311,
-23244,
-23307,
-23623,
-24025,
-24586,
-25200,
-25943,
-26765,
-27758,
-28854,
-30056,
-31326,
-32595,
-33932,
-35208,
-36545,
-37732,
-38817,
-39627,
-40173,
-40439,
-40485,
-40425,
-40263,
-40101,
-39875,
-39650,
-39373,
-39123,
-38908,
-38785,
-38765,
-38867,
-39072,
-39413,
-39857,
-40463,
-41128,
-41900,
-42648,
-43391,
-44004,
-44523,
-44814,
-44943,
-44835,
-44548,
-44078,
-43433,
-42632,
-41652,
-40523,
-39295,
-38014,
-36718,
-35500,
-34308,
-33261,
-32285,
-31501,
-30866,
-30443,
-30190,
-30149,
-30204,
-30435,
-30682,
-30974,
-31247,
-31459,
-31604,
-31649,
-31545,
-31227,
-30736,
-29992,
-29173,
-28258,
-27338,
-26473,
-25552,
-24681,
-23754,
-22945,
-22215,
-21738,
-21476,
-21520,
-21865,
-22474,
-23411,
-24556,
-25932,
-27436,
-28924,
-30394,
-31609,
-32673,
-33366,
-33825,
-33941,
-33840,
-33549,
-33146,
-32720,
-32231,
-31765,
-31211,
-30707,
-30223,
-29884,
-29671,
-29634,
-29729,
-30028,
-30554,
-31369,
-32472,
-33775,
-35188,
-36532,
-37814,
-38908,
-39936,
-40773,
-41494,
-41940,
-42171,
-42117,
-41857,
-41452,
-40912,
-40330,
-39641,
-38959,
-38240,
-37596,
-37046,
-36653,
-36459,
-36398,
-36458,
-36568,
-36679,
-36789,
-36918,
-37056,
-37256,
-37499,
-37730,
-38010,
-38223,
-38399,
-38459,
-38332,
-38006,
-37453,
-36777,
-35969,
-35152,
-34295,
-33376,
-32443,
-31411,
-30422,
-29403,
-28435,
-27506,
-26586,
-25755,
-24948,
-24283,
-23710,
-23283,
-22966,
-22824,
-22810,
-22956,
-23197,
-23401,
-23578,
-23551,
-23431,
-23157,
-22844,
-22509,
-22134,
-21716,
-21200,
-20590,
-19962,
-19324,
-18779,
-18275,
-17869,
-17457,
-17104,
-16747,
-16421,
-16083,
-15770,
-15400,
-15034,
-14658,
-14305,
-14025,
-13863,
-13948,
-14432,
-15458,
-17155,
-19529,
-22435,
-25710,
-29024,
-32156,
-34869,
-36991,
-38533,
-39414,
-39851,
-39793,
-39464,
-38833,
-38008,
-37027,
-35964,
-34923,
-33995,
-33282,
-32813,
-32636,
-32697,
-33148,
-33948,
-35277,
-37056,
-39256,
-41625,
-43964,
-46043,
-47757,
-49148,
-50266,
-51217,
-52025,
-52707,
-53174,
-53398,
-53230,
-52653,
-51593,
-50137,
-48382,
-46556,
-44860,
-43494,
-42580,
-42088,
-42004,
-42154,
-42426,
-42650,
-42791,
-42763,
-42633,
-42425,
-42250,
-42158,
-42240,
-42533,
-43020,
-43636,
-44218,
-44604,
-44629,
-44235,
-43398,
-42291,
-40968,
-39611,
-38238,
-36916,
-35625,
-34369,
-33140,
-31936,
-30777,
-29734,
-28874,
-28289,
-27959,
-27886,
-27992,
-28217,
-28520,
-28883,
-29241,
-29584,
-29807,
-29935,
-29924,
-29838,
-29637,
-29321,
-28782,
-28003,
-26944,
-25672,
-24322,
-22994,
-21825,
-20908,
-20272,
-19939,
-19884,
-20030,
-20346,
-20706,
-21109,
-21474,
-21886,
-22322,
-22934,
-23709,
-24673,
-25777,
-26837,
-27821,
-28519,
-28927,
-29077,
-28931,
-28672,
-28249,
-27778,
-27309,
-26876,
-26563,
-26439,
-26507,
-26800,
-27253,
-27882,
-28621,
-29511,
-30517,
-31694,
-32994,
-34462,
-35972,
-37460,
-38829,
-39936,
-40813,
-41362,
-41719,
-41848,
-41834,
-41691,
-41387,
-40940,
-40386,
-39690,
-39046,
-38358,
-37842,
-37437,
-37221,
-37163,
-37235,
-37411,
-37627,
-37949,
-38291,
-38750,
-39259,
-39818,
-40398,
-40912,
-41327,
-41594,
-41686,
-41604,
-41318,
-40844,
-40182,
-39331,
-38332,
-37242,
-36107,
-35073,
-34150,
-33391,
-32737,
-32162,
-31603,
-31081,
-30570,
-30182,
-29902,
-29779,
-29800,
-29919,
-30119,
-30362,
-30599,
-30827,
-30999,
-31079,
-31081,
-30970,
-30797,
-30532,
-30184,
-29748,
-29200,
-28571,
-27874,
-27173,
-26514,
-26007,
-25593,
-25382,
-25293,
-25376,
-25655,
-26153,
-26938,
-27961,
-29192,
-30502,
-31729,
-32795,
-33576,
-34177,
-34581,
-34903,
-35168,
-35297,
-35366,
-35204,
-34972,
-34578,
-34228,
-33843,
-33561,
-33306,
-33072,
-32875,
-32710,
-32643,
-32706,
-32930,
-33366,
-33978,
-34709,
-35561,
-36363,
-37184,
-37928,
-38633,
-39330,
-39977,
-40626,
-41118,
-41481,
-41527,
-41296,
-40737,
-39953,
-38980,
-38020,
-37076,
-36320,
-35696,
-35280,
-34981,
-34852,
-34788,
-34897,
-35033,
-35304,
-35588,
-35902,
-36220,
-36499,
-36800,
-37051,
-37310,
-37416,
-37414,
-37148,
-36643,
-35972,
-35106,
-34267,
-33430,
-32712,
-32081,
-31551,
-31075,
-30642,
-30263,
-29941,
-29685,
-29546,
-29362,
-29227,
-28916,
-28584,
-28136,
-27744,
-27342,
-27048,
-26707,
-26403,
-25987,
-25573,
-25114,
-24718,
-24317,
-24001,
-23684,
-23428,
-23235,
-23064,
-23021,
-22968,
-23006,
-23016,
-23079,
-23127,
-23198,
-23229,
-23189,
-23029,
-22735,
-22342,
-21870,
-21399,
-20867,
-20315,
-19643,
-18882,
-18047,
-17200,
-16446,
-15819,
-15401,
-15236,
-15471,
-16208,
-17672,
-19882,
-22806,
-26225,
-29752,
-33072,
-35866,
-38063,
-39624,
-40685,
-41334,
-41642,
-41622,
-41296,
-40595,
-39669,
-38443,
-37151,
-35752,
-34366,
-33022,
-31714,
-30606,
-29804,
-29495,
-29867,
-30853,
-32485,
-34450,
-36678,
-38885,
-41102,
-43141,
-45122,
-46920,
-48682,
-50313,
-51894,
-53186,
-54072,
-54282,
-53680,
-52315,
-50313,
-48012,
-45693,
-43562,
-41807,
-40413,
-39370,
-38607,
-38046,
-37644,
-37371,
-37206,
-37149,
-37224,
-37401,
-37737,
-38239,
-38944,
-39841,
-40837,
-41798,
-42497,
-42849,
-42699,
-42174,
-41269,
-40224,
-39043,
-37866,
-36626,
-35353,
-33991,
-32576,
-31130,
-29709,
-28435,
-27253,
-26314,
-25515,
-24907,
-24511,
-24269,
-24245,
-24350,
-24522,
-24760,
-24997,
-25333,
-25746,
-26279,
-26848,
-27328,
-27590,
-27541,
-27163,
-26574,
-25811,
-25056,
-24296,
-23645,
-23070,
-22587,
-22197,
-21861,
-21572,
-21320,
-21100,
-20941,
-20946,
-21136,
-21636,
-22387,
-23401,
-24569,
-25792,
-26970,
-28025,
-28891,
-29599,
-30099,
-30500,
-30818,
-31093,
-31367,
-31585,
-31748,
-31825,
-31793,
-31737,
-31657,
-31639,
-31714,
-31880,
-32159,
-32553,
-33075,
-33781,
-34577,
-35506,
-36378,
-37285,
-38055,
-38830,
-39503,
-40171,
-40719,
-41180,
-41471,
-41607,
-41568,
-41383,
-41089,
-40713,
-40341,
-39969,
-39667,
-39378,
-39144,
-38891,
-38715,
-38528,
-38470,
-38431,
-38523,
-38683,
-38872,
-39129,
-39314,
-39496,
-39542,
-39471,
-39238,
-38858,
-38360,
-37766,
-37143,
-36477,
-35816,
-35171,
-34559,
-33990,
-33512,
-33062,
-32712,
-32365,
-32054,
-31728,
-31433,
-31153,
-30927,
-30719,
-30527,
-30314,
-30016,
-29659,
-29210,
-28754,
-28288,
-27908,
-27587,
-27395,
-27278,
-27277,
-27291,
-27351,
-27347,
-27353,
-27339,
-27325,
-27392,
-27442,
-27520,
-27499,
-27439,
-27346,
-27335,
-27503,
-27924,
-28562,
-29348,
-30163,
-30905,
-31571,
-32116,
-32647,
-33122,
-33550,
-33903,
-34106,
-34264,
-34327,
-34420,
-34548,
-34712,
-34880,
-35009,
-35072,
-35078,
-35116,
-35150,
-35375,
-35641,
-36071,
-36539,
-37062,
-37566,
-38058,
-38507,
-38956,
-39373,
-39848,
-40356,
-40893,
-41455,
-41906,
-42245,
-42368,
-42294,
-42058,
-41687,
-41307,
-40869,
-40488,
-40096,
-39811,
-39559,
-39468,
-39418,
-39457,
-39486,
-39506,
-39477,
-39461,
-39444,
-39525,
-39652,
-39848,
-40055,
-40206,
-40253,
-40170,
-39923,
-39543,
-39054,
-38469,
-37819,
-37095,
-36290,
-35393,
-34437,
-33408,
-32432,
-31472,
-30619,
-29869,
-29204,
-28655,
-28163,
-27768,
-27435,
-27146,
-26847,
-26492,
-26045,
-25515,
-24919,
-24318,
-23742,
-23246,
-22780,
-22389,
-21957,
-21580,
-21148,
-20755,
-20386,
-20045,
-19809,
-19633,
-19605,
-19632,
-19778,
-19920,
-20094,
-20214,
-20306,
-20359,
-20340,
-20288,
-20132,
-19934,
-19574,
-19181,
-18607,
-17985,
-17281,
-16567,
-15882,
-15258,
-14714,
-14305,
-14097,
-14188,
-14812,
-16062,
-18079,
-20785,
-24030,
-27475,
-30892,
-34005,
-36750,
-39097,
-41075,
-42655,
-43848,
-44507,
-44662,
-44308,
-43534,
-42444,
-41126,
-39584,
-37844,
-35962,
-34030,
-32298,
-30963,
-30257,
-30260,
-31037,
-32373,
-34246,
-36345,
-38612,
-40863,
-43067,
-45171,
-47260,
-49285,
-51300,
-53163,
-54739,
-55772,
-56117,
-55604,
-54241,
-52167,
-49584,
-46804,
-44167,
-41816,
-39898,
-38423,
-37256,
-36383,
-35667,
-35111,
-34694,
-34418,
-34289,
-34329,
-34598,
-35148,
-35995,
-37112,
-38368,
-39606,
-40583,
-41187,
-41293,
-40967,
-40286,
-39401,
-38442,
-37459,
-36456,
-35385,
-34187,
-32866,
-31433,
-29979,
-28539,
-27235,
-26041,
-25038,
-24213,
-23589,
-23153,
-22858,
-22685,
-22568,
-22609,
-22783,
-23224,
-23910,
-24837,
-25809,
-26769,
-27444,
-27894,
-28007,
-27948,
-27751,
-27596,
-27414,
-27333,
-27207,
-27135,
-26960,
-26711,
-26309,
-25703,
-24932,
-24027,
-23095,
-22355,
-21847,
-21759,
-21999,
-22584,
-23294,
-24101,
-24819,
-25526,
-26220,
-26990,
-27931,
-29031,
-30271,
-31592,
-32887,
-34081,
-35114,
-35937,
-36537,
-36875,
-37005,
-36915,
-36717,
-36413,
-36121,
-35800,
-35531,
-35281,
-35056,
-34949,
-34940,
-35097,
-35418,
-35906,
-36519,
-37249,
-38062,
-38864,
-39689,
-40402,
-41009,
-41522,
-41912,
-42323,
-42697,
-43110,
-43461,
-43686,
-43704,
-43412,
-42830,
-42032,
-41107,
-40239,
-39492,
-38900,
-38452,
-38057,
-37678,
-37260,
-36857,
-36426,
-36081,
-35754,
-35539,
-35388,
-35370,
-35418,
-35608,
-35776,
-35957,
-36031,
-35923,
-35641,
-35145,
-34500,
-33730,
-32889,
-32068,
-31240,
-30499,
-29752,
-29093,
-28451,
-27888,
-27396,
-26992,
-26688,
-26516,
-26441,
-26478,
-26552,
-26583,
-26557,
-26400,
-26207,
-26044,
-25950,
-25963,
-26009,
-26060,
-26048,
-25973,
-25889,
-25859,
-25867,
-26016,
-26155,
-26404,
-26703,
-27175,
-27853,
-28775,
-29870,
-31047,
-32145,
-33125,
-33914,
-34576,
-35214,
-35789,
-36404,
-36960,
-37400,
-37722,
-37863,
-37888,
-37816,
-37695,
-37534,
-37386,
-37252,
-37177,
-37228,
-37469,
-37887,
-38506,
-39174,
-39919,
-40602,
-41300,
-41970,
-42645,
-43326,
-43927,
-44494,
-44935,
-45352,
-45655,
-45941,
-46064,
-46045,
-45797,
-45338,
-44716,
-44030,
-43332,
-42694,
-42125,
-41547,
-40992,
-40346,
-39682,
-38978,
-38321,
-37716,
-37213,
-36804,
-36503,
-36303,
-36231,
-36287,
-36407,
-36599,
-36697,
-36737,
-36619,
-36361,
-35951,
-35354,
-34590,
-33580,
-32415,
-31102,
-29759,
-28489,
-27314,
-26298,
-25382,
-24526,
-23732,
-22943,
-22242,
-21646,
-21216,
-20918,
-20747,
-20617,
-20509,
-20413,
-20287,
-20221,
-20092,
-19993,
-19798,
-19547,
-19287,
-19032,
-18892,
-18854,
-18965,
-19123,
-19320,
-19522,
-19619,
-19739,
-19735,
-19686,
-19572,
-19374,
-19161,
-18936,
-18773,
-18701,
-18743,
-18914,
-19151,
-19480,
-19818,
-20117,
-20370,
-20519,
-20654,
-20764,
-20890,
-21011,
-21052,
-21003,
-20899,
-20913,
-21288,
-22214,
-23784,
-25899,
-28360,
-30833,
-33193,
-35250,
-37119,
-38838,
-40476,
-42020,
-43332,
-44307,
-44832,
-44937,
-44648,
-44091,
-43226,
-42139,
-40709,
-39054,
-37228,
-35505,
-34128,
-33292,
-33119,
-33509,
-34356,
-35485,
-36708,
-37965,
-39202,
-40433,
-41758,
-43259,
-44978,
-46911,
-48902,
-50725,
-52068,
-52767,
-52579,
-51640,
-50039,
-48037,
-45940,
-43908,
-42147,
-40590,
-39264,
-37960,
-36752,
-35521,
-34366,
-33269,
-32282,
-31407,
-30736,
-30351,
-30387,
-30908,
-31880,
-33164,
-34518,
-35748,
-36600,
-37141,
-37276,
-37257,
-37061,
-36855,
-36547,
-36096,
-35385,
-34406,
-33132,
-31751,
-30308,
-28975,
-27785,
-26721,
-25833,
-25044,
-24446,
-23931,
-23586,
-23330,
-23207,
-23256,
-23516,
-24021,
-24789,
-25677,
-26636,
-27493,
-28199,
-28738,
-29133,
-29448,
-29773,
-30111,
-30497,
-30888,
-31279,
-31589,
-31808,
-31838,
-31644,
-31224,
-30538,
-29697,
-28804,
-27997,
-27447,
-27141,
-27127,
-27268,
-27456,
-27651,
-27748,
-27897,
-28105,
-28519,
-29160,
-30051,
-31124,
-32346,
-33584,
-34834,
-35993,
-37046,
-37935,
-38619,
-39105,
-39362,
-39457,
-39448,
-39341,
-39236,
-39052,
-38848,
-38527,
-38150,
-37666,
-37184,
-36668,
-36230,
-35832,
-35504,
-35246,
-35093,
-35011,
-35119,
-35328,
-35754,
-36328,
-37071,
-37919,
-38831,
-39677,
-40379,
-40839,
-41016,
-40946,
-40665,
-40284,
-39863,
-39416,
-38944,
-38375,
-37681,
-36848,
-35894,
-34889,
-33863,
-32924,
-32031,
-31283,
-30632,
-30176,
-29913,
-29875,
-30057,
-30376,
-30748,
-31080,
-31322,
-31490,
-31595,
-31706,
-31853,
-31984,
-32139,
-32203,
-32212,
-32145,
-31969,
-31749,
-31436,
-31123,
-30760,
-30406,
-30010,
-29592,
-29192,
-28784,
-28454,
-28220,
-28064,
-28031,
-28054,
-28169,
-28348,
-28643,
-28999,
-29458,
-29983,
-30552,
-31192,
-31852,
-32580,
-33350,
-34173,
-35041,
-35904,
-36795,
-37579,
-38300,
-38815,
-39212,
-39409,
-39573,
-39657,
-39780,
-39905,
-39961,
-39931,
-39735,
-39382,
-38927,
-38440,
-37993,
-37621,
-37358,
-37167,
-37058,
-37091,
-37210,
-37559,
-37993,
-38620,
-39219,
-39872,
-40355,
-40822,
-41138,
-41445,
-41716,
-41943,
-42134,
-42235,
-42208,
-42031,
-41667,
-41197,
-40587,
-39988,
-39307,
-38668,
-37962,
-37241,
-36514,
-35759,
-35077,
-34435,
-33931,
-33514,
-33233,
-33022,
-32883,
-32743,
-32593,
-32428,
-32256,
-32110,
-32001,
-31888,
-31795,
-31606,
-31367,
-30997,
-30568,
-30084,
-29539,
-28981,
-28362,
-27698,
-27027,
-26317,
-25687,
-25107,
-24666,
-24285,
-23973,
-23644,
-23278,
-22877,
-22479,
-22153,
-21922,
-21826,
-21788,
-21829,
-21885,
-22005,
-22165,
-22394,
-22682,
-23004,
-23301,
-23538,
-23698,
-23723,
-23693,
-23535,
-23332,
-23046,
-22684,
-22264,
-21746,
-21215,
-20671,
-20189,
-19842,
-19636,
-19654,
-19856,
-20255,
-20785,
-21426,
-22092,
-22796,
-23514,
-24279,
-25031,
-25737,
-26253,
-26528,
-26531,
-26286,
-25975,
-25575,
-25219,
-24756,
-24225,
-23587,
-23029,
-22773,
-23054,
-24007,
-25585,
-27550,
-29645,
-31630,
-33416,
-35050,
-36654,
-38254,
-39860,
-41347,
-42554,
-43449,
-43945,
-44136,
-44027,
-43598,
-42809,
-41591,
-39943,
-38015,
-35976,
-34069,
-32553,
-31431,
-30838,
-30613,
-30717,
-31073,
-31611,
-32331,
-33255,
-34446,
-35920,
-37787,
-39885,
-42214,
-44446,
-46437,
-47832,
-48565,
-48541,
-47897,
-46825,
-45557,
-44272,
-42996,
-41732,
-40360,
-38870,
-37190,
-35480,
-33744,
-32178,
-30763,
-29639,
-28819,
-28444,
-28556,
-29264,
-30410,
-31921,
-33477,
-34922,
-36108,
-37067,
-37895,
-38706,
-39544,
-40318,
-40920,
-41215,
-41108,
-40680,
-39927,
-39023,
-37979,
-36891,
-35748,
-34653,
-33624,
-32804,
-32124,
-31658,
-31251,
-30915,
-30611,
-30362,
-30279,
-30369,
-30720,
-31195,
-31797,
-32334,
-32759,
-33030,
-33140,
-33179,
-33219,
-33329,
-33546,
-33831,
-34142,
-34376,
-34480,
-34403,
-34131,
-33687,
-33029,
-32319,
-31520,
-30830,
-30239,
-29818,
-29479,
-29189,
-28751,
-28194,
-27454,
-26662,
-25927,
-25365,
-25032,
-24986,
-25211,
-25708,
-26492,
-27464,
-28609,
-29763,
-30866,
-31849,
-32702,
-33489,
-34196,
-34876,
-35475,
-35934,
-36248,
-36303,
-36158,
-35784,
-35206,
-34506,
-33704,
-32863,
-32057,
-31294,
-30631,
-30097,
-29730,
-29568,
-29663,
-30038,
-30687,
-31624,
-32736,
-34004,
-35339,
-36634,
-37884,
-38968,
-39919,
-40670,
-41284,
-41746,
-42070,
-42211,
-42147,
-41844,
-41302,
-40535,
-39638,
-38637,
-37640,
-36637,
-35736,
-34943,
-34325,
-33965,
-33784,
-33837,
-33976,
-34183,
-34407,
-34648,
-34957,
-35341,
-35807,
-36249,
-36674,
-36941,
-37113,
-37128,
-37069,
-36875,
-36636,
-36288,
-35873,
-35402,
-34872,
-34331,
-33804,
-33240,
-32749,
-32212,
-31765,
-31309,
-30902,
-30551,
-30202,
-29929,
-29714,
-29539,
-29487,
-29450,
-29502,
-29597,
-29753,
-30009,
-30347,
-30798,
-31296,
-31847,
-32386,
-32924,
-33450,
-33998,
-34538,
-35128,
-35693,
-36255,
-36747,
-37134,
-37379,
-37459,
-37380,
-37104,
-36729,
-36193,
-35592,
-34918,
-34198,
-33499,
-32851,
-32318,
-31948,
-31715,
-31689,
-31777,
-32049,
-32454,
-33048,
-33835,
-34779,
-35888,
-37035,
-38207,
-39244,
-40151,
-40789,
-41230,
-41386,
-41343,
-41048,
-40595,
-39933,
-39148,
-38200,
-37130,
-36017,
-34855,
-33791,
-32869,
-32074,
-31537,
-31087,
-30863,
-30728,
-30781,
-30910,
-31149,
-31374,
-31614,
-31796,
-31991,
-32130,
-32303,
-32367,
-32412,
-32331,
-32142,
-31910,
-31518,
-31150,
-30668,
-30211,
-29703,
-29192,
-28670,
-28117,
-27584,
-27006,
-26451,
-25884,
-25335,
-24802,
-24326,
-23931,
-23622,
-23437,
-23331,
-23271,
-23272,
-23214,
-23197,
-23162,
-23127,
-23124,
-23086,
-23073,
-23036,
-23013,
-22933,
-22862,
-22683,
-22480,
-22159,
-21802,
-21381,
-20974,
-20627,
-20351,
-20198,
-20119,
-20124,
-20168,
-20280,
-20439,
-20722,
-21052,
-21480,
-21937,
-22406,
-22885,
-23339,
-23743,
-24091,
-24284,
-24405,
-24368,
-24317,
-24221,
-24070,
-23818,
-23395,
-22823,
-22249,
-21918,
-22056,
-22898,
-24387,
-26340,
-28501,
-30561,
-32475,
-34233,
-35972,
-37768,
-39591,
-41310,
-42729,
-43798,
-44400,
-44729,
-44719,
-44493,
-43878,
-42849,
-41306,
-39391,
-37265,
-35246,
-33553,
-32348,
-31707,
-31546,
-31783,
-32287,
-32934,
-33677,
-34517,
-35553,
-36896,
-38648,
-40798,
-43256,
-45778,
-48101,
-49948,
-51117,
-51572,
-51346,
-50640,
-49652,
-48549,
-47408,
-46220,
-44915,
-43443,
-41799,
-40051,
-38290,
-36619,
-35106,
-33813,
-32754,
-32034,
-31776,
-32051,
-32912,
-34196,
-35741,
-37191,
-38444,
-39352,
-40045,
-40631,
-41202,
-41773,
-42222,
-42399,
-42226,
-41622,
-40686,
-39512,
-38197,
-36836,
-35465,
-34125,
-32947,
-31875,
-31070,
-30353,
-29833,
-29371,
-29027,
-28844,
-28773,
-28940,
-29209,
-29531,
-29903,
-30157,
-30354,
-30403,
-30322,
-30157,
-29950,
-29777,
-29685,
-29674,
-29748,
-29853,
-29919,
-29951,
-29788,
-29527,
-29061,
-28498,
-27946,
-27481,
-27217,
-27164,
-27185,
-27231,
-27106,
-26803,
-26367,
-25846,
-25409,
-25109,
-24957,
-25032,
-25232,
-25687,
-26290,
-27146,
-28100,
-29186,
-30192,
-31205,
-32045,
-32887,
-33656,
-34393,
-35136,
-35754,
-36300,
-36694,
-36930,
-37059,
-36997,
-36843,
-36536,
-36139,
-35685,
-35219,
-34793,
-34404,
-34070,
-33772,
-33592,
-33520,
-33685,
-34040,
-34647,
-35369,
-36229,
-37049,
-37869,
-38605,
-39322,
-39977,
-40639,
-41270,
-41837,
-42350,
-42719,
-42886,
-42899,
-42620,
-42187,
-41515,
-40697,
-39718,
-38612,
-37479,
-36353,
-35353,
-34567,
-33920,
-33456,
-33027,
-32647,
-32361,
-32202,
-32265,
-32503,
-32890,
-33341,
-33842,
-34344,
-34889,
-35372,
-35824,
-36112,
-36301,
-36295,
-36194,
-35951,
-35566,
-35086,
-34452,
-33766,
-33005,
-32220,
-31406,
-30600,
-29844,
-29158,
-28660,
-28299,
-28165,
-28171,
-28350,
-28652,
-29114,
-29725,
-30470,
-31378,
-32295,
-33284,
-34233,
-35100,
-35938,
-36601,
-37167,
-37534,
-37736,
-37780,
-37692,
-37494,
-37188,
-36744,
-36170,
-35475,
-34762,
-34062,
-33454,
-32973,
-32569,
-32277,
-32076,
-31978,
-32028,
-32220,
-32554,
-32973,
-33441,
-33923,
-34428,
-34956,
-35559,
-36184,
-36847,
-37447,
-37964,
-38337,
-38552,
-38618,
-38537,
-38321,
-37987,
-37544,
-36990,
-36369,
-35652,
-34922,
-34158,
-33371,
-32647,
-31896,
-31269,
-30670,
-30186,
-29787,
-29494,
-29310,
-29216,
-29194,
-29228,
-29286,
-29381,
-29485,
-29623,
-29787,
-29904,
-30024,
-30064,
-30138,
-30170,
-30226,
-30205,
-30096,
-29839,
-29458,
-28964,
-28397,
-27779,
-27087,
-26320,
-25493,
-24632,
-23838,
-23113,
-22536,
-22095,
-21747,
-21503,
-21312,
-21219,
-21192,
-21255,
-21386,
-21586,
-21827,
-22135,
-22484,
-22853,
-23216,
-23516,
-23744,
-23884,
-23946,
-23934,
-23796,
-23628,
-23331,
-23088,
-22834,
-22651,
-22502,
-22333,
-22174,
-22025,
-21961,
-22022,
-22220,
-22508,
-22868,
-23258,
-23686,
-24283,
-24965,
-25873,
-26829,
-27829,
-28703,
-29437,
-30001,
-30443,
-30799,
-31095,
-31276,
-31325,
-31194,
-30997,
-30893,
-31122,
-31783,
-32908,
-34256,
-35649,
-36893,
-37949,
-38932,
-39942,
-41055,
-42239,
-43362,
-44344,
-45149,
-45809,
-46354,
-46784,
-46921,
-46703,
-45948,
-44739,
-43218,
-41586,
-40080,
-38762,
-37683,
-36794,
-36112,
-35645,
-35386,
-35352,
-35431,
-35580,
-35768,
-36089,
-36644,
-37585,
-38897,
-40505,
-42167,
-43628,
-44642,
-45171,
-45156,
-44832,
-44217,
-43493,
-42625,
-41614,
-40416,
-39039,
-37510,
-35962,
-34400,
-32940,
-31551,
-30256,
-29054,
-28080,
-27391,
-27186,
-27448,
-28167,
-29176,
-30281,
-31418,
-32416,
-33410,
-34339,
-35269,
-36064,
-36685,
-37043,
-37122,
-37019,
-36753,
-36382,
-35911,
-35228,
-34421,
-33425,
-32448,
-31531,
-30744,
-30084,
-29435,
-28837,
-28261,
-27891,
-27764,
-27943,
-28354,
-28884,
-29415,
-29896,
-30259,
-30573,
-30826,
-31055,
-31254,
-31465,
-31639,
-31804,
-31949,
-32039,
-32130,
-32113,
-32026,
-31771,
-31347,
-30816,
-30209,
-29705,
-29329,
-29119,
-28998,
-28953,
-28857,
-28747,
-28590,
-28425,
-28263,
-28162,
-28087,
-28124,
-28254,
-28526,
-28977,
-29544,
-30278,
-31033,
-31851,
-32611,
-33336,
-33991,
-34593,
-35140,
-35557,
-35852,
-35975,
-36007,
-35977,
-35961,
-35903,
-35765,
-35480,
-35004,
-34438,
-33872,
-33384,
-33043,
-32794,
-32623,
-32518,
-32527,
-32673,
-33023,
-33537,
-34164,
-34848,
-35518,
-36114,
-36648,
-37048,
-37450,
-37792,
-38217,
-38571,
-38940,
-39093,
-39114,
-38955,
-38671,
-38355,
-37966,
-37542,
-36983,
-36376,
-35678,
-35067,
-34575,
-34264,
-34098,
-34008,
-33925,
-33856,
-33786,
-33802,
-33887,
-34083,
-34311,
-34529,
-34746,
-34898,
-35073,
-35248,
-35411,
-35599,
-35688,
-35737,
-35703,
-35612,
-35515,
-35380,
-35218,
-35040,
-34792,
-34549,
-34261,
-33983,
-33669,
-33379,
-33044,
-32772,
-32567,
-32453,
-32483,
-32574,
-32757,
-32925,
-33170,
-33421,
-33803,
-34291,
-34880,
-35510,
-36140,
-36645,
-37067,
-37346,
-37513,
-37598,
-37532,
-37337,
-36972,
-36404,
-35742,
-34968,
-34255,
-33522,
-32881,
-32227,
-31616,
-31076,
-30661,
-30421,
-30342,
-30435,
-30647,
-30983,
-31423,
-31999,
-32636,
-33346,
-34019,
-34647,
-35151,
-35522,
-35751,
-35773,
-35634,
-35302,
-34818,
-34226,
-33500,
-32750,
-31934,
-31162,
-30444,
-29808,
-29278,
-28777,
-28364,
-27993,
-27706,
-27546,
-27483,
-27583,
-27712,
-27950,
-28172,
-28472,
-28767,
-29103,
-29366,
-29544,
-29544,
-29411,
-29160,
-28884,
-28631,
-28426,
-28260,
-28105,
-27982,
-27906,
-27914,
-28022,
-28174,
-28366,
-28492,
-28582,
-28584,
-28587,
-28553,
-28566,
-28572,
-28573,
-28610,
-28616,
-28658,
-28672,
-28647,
-28558,
-28416,
-28206,
-28061,
-27975,
-28038,
-28193,
-28465,
-28741,
-29058,
-29319,
-29577,
-29822,
-29991,
-30182,
-30246,
-30321,
-30308,
-30296,
-30232,
-30192,
-30084,
-29974,
-29811,
-29626,
-29408,
-29177,
-28961,
-28756,
-28642,
-28576,
-28626,
-28768,
-28960,
-29231,
-29498,
-29824,
-30099,
-30386,
-30594,
-30772,
-30858,
-30868,
-30731,
-30494,
-30150,
-29873,
-29850,
-30198,
-30926,
-31978,
-33063,
-34121,
-34980,
-35721,
-36427,
-37111,
-37842,
-38463,
-38976,
-39300,
-39505,
-39625,
-39689,
-39616,
-39308,
-38630,
-37622,
-36343,
-34985,
-33722,
-32636,
-31811,
-31161,
-30787,
-30590,
-30655,
-30884,
-31262,
-31686,
-32145,
-32731,
-33447,
-34527,
-35850,
-37414,
-38966,
-40308,
-41303,
-41906,
-42145,
-42089,
-41790,
-41287,
-40612,
-39825,
-38935,
-38003,
-37000,
-35946,
-34782,
-33588,
-32361,
-31209,
-30161,
-29301,
-28763,
-28595,
-28920,
-29645,
-30682,
-31874,
-33030,
-34170,
-35216,
-36286,
-37269,
-38196,
-38888,
-39410,
-39695,
-39835,
-39833,
-39724,
-39382,
-38867,
-38043,
-37071,
-35956,
-34874,
-33830,
-32906,
-32054,
-31318,
-30753,
-30353,
-30223,
-30298,
-30534,
-30883,
-31249,
-31611,
-31978,
-32293,
-32567,
-32726,
-32787,
-32726,
-32647,
-32548,
-32522,
-32482,
-32437,
-32268,
-31958,
-31491,
-30905,
-30261,
-29617,
-29008,
-28479,
-28040,
-27738,
-27516,
-27369,
-27222,
-27061,
-26904,
-26752,
-26615,
-26507,
-26440,
-26390,
-26496,
-26719,
-27169,
-27781,
-28471,
-29172,
-29798,
-30321,
-30784,
-31215,
-31637,
-32044,
-32404,
-32716,
-32990,
-33237,
-33472,
-33686,
-33770,
-33715,
-33477,
-33110,
-32732,
-32364,
-32115,
-31920,
-31794,
-31735,
-31735,
-31886,
-32097,
-32486,
-32871,
-33384,
-33880,
-34430,
-34991,
-35550,
-36135,
-36712,
-37328,
-37911,
-38454,
-38884,
-39169,
-39315,
-39362,
-39288,
-39207,
-38974,
-38657,
-38200,
-37613,
-36996,
-36358,
-35841,
-35366,
-35019,
-34687,
-34423,
-34233,
-34150,
-34183,
-34320,
-34510,
-34772,
-35064,
-35490,
-35966,
-36575,
-37162,
-37708,
-38131,
-38402,
-38544,
-38562,
-38464,
-38257,
-37928,
-37506,
-37005,
-36442,
-35871,
-35269,
-34683,
-34081,
-33488,
-32927,
-32422,
-32008,
-31747,
-31590,
-31599,
-31699,
-31889,
-32130,
-32386,
-32630,
-32883,
-33171,
-33448,
-33768,
-33990,
-34159,
-34151,
-34100,
-33889,
-33672,
-33368,
-32990,
-32499,
-31912,
-31237,
-30587,
-29976,
-29461,
-29044,
-28662,
-28365,
-28068,
-27915,
-27848,
-27948,
-28144,
-28416,
-28731,
-29087,
-29491,
-29955,
-30435,
-30896,
-31266,
-31563,
-31762,
-31935,
-32060,
-32163,
-32232,
-32251,
-32237,
-32185,
-32131,
-32020,
-31930,
-31805,
-31687,
-31590,
-31468,
-31400,
-31332,
-31320,
-31335,
-31410,
-31486,
-31594,
-31689,
-31839,
-32027,
-32288,
-32572,
-32845,
-33053,
-33229,
-33330,
-33482,
-33625,
-33852,
-34082,
-34344,
-34563,
-34790,
-34934,
-35108,
-35169,
-35277,
-35233,
-35165,
-34953,
-34639,
-34276,
-33858,
-33490,
-33117,
-32798,
-32441,
-32071,
-31631,
-31201,
-30742,
-30363,
-30021,
-29802,
-29676,
-29665,
-29734,
-29892,
-30047,
-30270,
-30476,
-30726,
-30953,
-31178,
-31318,
-31389,
-31340,
-31199,
-30997,
-30765,
-30504,
-30246,
-29900,
-29550,
-29111,
-28652,
-28162,
-27721,
-27273,
-26920,
-26583,
-26335,
-26142,
-26008,
-25948,
-25981,
-26111,
-26346,
-26665,
-27011,
-27322,
-27503,
-27515,
-27383,
-27167,
-27069,
-27180,
-27593,
-28240,
-28973,
-29671,
-30201,
-30615,
-30964,
-31315,
-31728,
-32103,
-32400,
-32577,
-32648,
-32760,
-32929,
-33230,
-33534,
-33722,
-33626,
-33290,
-32688,
-32103,
-31545,
-31157,
-30926,
-30804,
-30797,
-30855,
-30991,
-31187,
-31433,
-31687,
-32044,
-32519,
-33262,
-34236,
-35423,
-36727,
-37983,
-39118,
-40042,
-40742,
-41248,
-41537,
-41676,
-41639,
-41498,
-41253,
-40966,
-40578,
-40118,
-39473,
-38727,
-37844,
-36969,
-36109,
-35367,
-34786,
-34446,
-34409,
-34707,
-35259,
-35979,
-36641,
-37258,
-37744,
-38253,
-38817,
-39456,
-40094,
-40662,
-41045,
-41295,
-41365,
-41339,
-41169,
-40854,
-40392,
-39740,
-39056,
-38231,
-37497,
-36751,
-36133,
-35530,
-35029,
-34468,
-33973,
-33421,
-32981,
-32592,
-32349,
-32218,
-32165,
-32195,
-32203,
-32228,
-32183,
-32084,
-31899,
-31682,
-31423,
-31228,
-30991,
-30792,
-30481,
-30108,
-29666,
-29174,
-28698,
-28236,
-27783,
-27388,
-27012,
-26697,
-26462,
-26238,
-26068,
-25880,
-25736,
-25612,
-25527,
-25471,
-25400,
-25366,
-25381,
-25474,
-25761,
-26107,
-26543,
-26941,
-27268,
-27593,
-27891,
-28300,
-28766,
-29351,
-29969,
-30613,
-31261,
-31863,
-32453,
-32947,
-33321,
-33589,
-33684,
-33768,
-33765,
-33786,
-33828,
-33855,
-33877,
-33912,
-33954,
-34067,
-34200,
-34374,
-34537,
-34719,
-34913,
-35218,
-35596,
-36108,
-36683,
-37260,
-37856,
-38349,
-38829,
-39222,
-39559,
-39860,
-40023,
-40186,
-40145,
-40111,
-39877,
-39584,
-39142,
-38645,
-38077,
-37530,
-36967,
-36445,
-35916,
-35407,
-34975,
-34610,
-34381,
-34234,
-34160,
-34146,
-34198,
-34351,
-34624,
-34969,
-35337,
-35663,
-35896,
-36097,
-36180,
-36278,
-36273,
-36215,
-36039,
-35757,
-35403,
-35012,
-34595,
-34161,
-33664,
-33092,
-32522,
-31904,
-31445,
-31051,
-30820,
-30690,
-30599,
-30602,
-30644,
-30749,
-30958,
-31152,
-31412,
-31641,
-31839,
-32070,
-32223,
-32377,
-32471,
-32427,
-32371,
-32156,
-31942,
-31665,
-31363,
-31068,
-30734,
-30412,
-30100,
-29820,
-29622,
-29486,
-29448,
-29500,
-29623,
-29848,
-30087,
-30404,
-30701,
-30989,
-31311,
-31579,
-31893,
-32150,
-32417,
-32639,
-32886,
-33104,
-33380,
-33583,
-33825,
-33924,
-34034,
-34027,
-34080,
-34102,
-34191,
-34253,
-34365,
-34422,
-34502,
-34529,
-34555,
-34509,
-34458,
-34297,
-34133,
-33886,
-33666,
-33434,
-33269,
-33174,
-33105,
-33093,
-33077,
-33105,
-33138,
-33252,
-33372,
-33595,
-33834,
-34107,
-34375,
-34629,
-34847,
-35011,
-35085,
-35045,
-34859,
-34539,
-34067,
-33517,
-32887,
-32224,
-31539,
-30820,
-30137,
-29445,
-28831,
-28251,
-27760,
-27319,
-26925,
-26658,
-26466,
-26427,
-26523,
-26700,
-26960,
-27197,
-27411,
-27576,
-27658,
-27726,
-27692,
-27637,
-27479,
-27246,
-26911,
-26472,
-25945,
-25334,
-24696,
-24002,
-23355,
-22719,
-22176,
-21714,
-21315,
-21020,
-20742,
-20584,
-20452,
-20485,
-20592,
-20865,
-21230,
-21626,
-22032,
-22375,
-22701,
-23048,
-23514,
-24107,
-24833,
-25597,
-26339,
-27012,
-27617,
-28243,
-28911,
-29658,
-30393,
-31053,
-31567,
-31914,
-32193,
-32422,
-32719,
-33034,
-33310,
-33497,
-33542,
-33494,
-33422,
-33330,
-33304,
-33276,
-33274,
-33326,
-33466,
-33757,
-34277,
-34878,
-35645,
-36384,
-37164,
-38002,
-38976,
-40085,
-41338,
-42552,
-43675,
-44591,
-45322,
-45883,
-46354,
-46645,
-46814,
-46767,
-46508,
-46151,
-45630,
-45076,
-44412,
-43667,
-42820,
-41948,
-41001,
-40124,
-39246,
-38578,
-38075,
-37929,
-38016,
-38349,
-38752,
-39220,
-39661,
-40178,
-40712,
-41307,
-41838,
-42308,
-42620,
-42838,
-42929,
-42892,
-42717,
-42292,
-41670,
-40783,
-39753,
-38623,
-37490,
-36390,
-35351,
-34393,
-33489,
-32673,
-31947,
-31338,
-30888,
-30567,
-30409,
-30364,
-30429,
-30559,
-30767,
-30991,
-31233,
-31398,
-31515,
-31477,
-31400,
-31177,
-30941,
-30585,
-30175,
-29649,
-29047,
-28360,
-27632,
-26849,
-26066,
-25296,
-24582,
-23992,
-23529,
-23238,
-23076,
-23046,
-23128,
-23303,
-23555,
-23890,
-24271,
-24729,
-25220,
-25761,
-26369,
-26982,
-27647,
-28262,
-28867,
-29406,
-29903,
-30364,
-30782,
-31156,
-31518,
-31781,
-32093,
-32330,
-32575,
-32794,
-32971,
-33084,
-33160,
-33194,
-33239,
-33324,
-33441,
-33573,
-33725,
-33879,
-34039,
-34270,
-34567,
-34941,
-35392,
-35889,
-36407,
-36974,
-37503,
-38056,
-38573,
-39031,
-39477,
-39781,
-40067,
-40236,
-40357,
-40376,
-40308,
-40169,
-39914,
-39629,
-39264,
-38876,
-38463,
-37994,
-37582,
-37118,
-36763,
-36404,
-36114,
-35912,
-35731,
-35669,
-35590,
-35606,
-35582,
-35637,
-35691,
-35832,
-35961,
-36081,
-36099,
-36043,
-35874,
-35721,
-35560,
-35449,
-35359,
-35223,
-35035,
-34758,
-34461,
-34138,
-33871,
-33571,
-33272,
-32906,
-32483,
-32077,
-31697,
-31440,
-31251,
-31138,
-31033,
-30925,
-30830,
-30748,
-30739,
-30794,
-30888,
-30986,
-31094,
-31150,
-31293,
-31415,
-31632,
-31779,
-31911,
-31939,
-31923,
-31898,
-31861,
-31861,
-31780,
-31678,
-31458,
-31274,
-31074,
-31000,
-30964,
-31010,
-31081,
-31114,
-31181,
-31207,
-31293,
-31411,
-31605,
-31861,
-32180,
-32501,
-32843,
-33199,
-33573,
-34003,
-34440,
-34887,
-35259,
-35535,
-35722,
-35838,
-35954,
-36067,
-36189,
-36278,
-36301,
-36200,
-36009,
-35743,
-35444,
-35147,
-34811,
-34508,
-34134,
-33824,
-33561,
-33391,
-33344,
-33347,
-33384,
-33433,
-33433,
-33480,
-33459,
-33540,
-33546,
-33592,
-33545,
-33475,
-33352,
-33203,
-33023,
-32798,
-32544,
-32197,
-31851,
-31450,
-31082,
-30725,
-30372,
-30052,
-29662,
-29291,
-28846,
-28419,
-27970,
-27533,
-27137,
-26735,
-26403,
-26014,
-25667,
-25312,
-24973,
-24696,
-24471,
-24312,
-24226,
-24184,
-24203,
-24239,
-24363,
-24440,
-24586,
-24631,
-24680,
-24660,
-24592,
-24522,
-24402,
-24268,
-24079,
-23869,
-23608,
-23368,
-23102,
-22909,
-22703,
-22545,
-22404,
-22274,
-22206,
-22201,
-22265,
-22444,
-22638,
-22920,
-23162,
-23420,
-23669,
-23947,
-24343,
-24909,
-25637,
-26531,
-27442,
-28334,
-29175,
-29928,
-30735,
-31504,
-32275,
-32941,
-33442,
-33782,
-34004,
-34181,
-34406,
-34646,
-34842,
-34968,
-34928,
-34825,
-34664,
-34534,
-34503,
-34504,
-34575,
-34658,
-34801,
-35052,
-35447,
-36013,
-36653,
-37387,
-38061,
-38804,
-39549,
-40394,
-41320,
-42259,
-43130,
-43830,
-44343,
-44669,
-44856,
-44929,
-44881,
-44670,
-44326,
-43824,
-43309,
-42761,
-42279,
-41808,
-41333,
-40811,
-40266,
-39714,
-39182,
-38771,
-38431,
-38291,
-38289,
-38445,
-38697,
-39019,
-39333,
-39699,
-40034,
-40372,
-40642,
-40780,
-40823,
-40711,
-40578,
-40367,
-40137,
-39824,
-39374,
-38800,
-38072,
-37250,
-36429,
-35545,
-34799,
-34035,
-33400,
-32847,
-32357,
-31994,
-31701,
-31534,
-31480,
-31504,
-31594,
-31726,
-31891,
-32104,
-32338,
-32564,
-32699,
-32690,
-32463,
-32127,
-31649,
-31186,
-30688,
-30170,
-29632,
-29061,
-28505,
-28028,
-27588,
-27233,
-26859,
-26532,
-26158,
-25896,
-25676,
-25626,
-25686,
-25870,
-26118,
-26413,
-26685,
-26955,
-27198,
-27446,
-27721,
-28006,
-28327,
-28638,
-28985,
-29316,
-29656,
-30023,
-30328,
-30649,
-30902,
-31120,
-31303,
-31501,
-31680,
-31918,
-32140,
-32395,
-32594,
-32802,
-32960,
-33126,
-33292,
-33465,
-33662,
-33819,
-34015,
-34166,
-34357,
-34546,
-34789,
-35034,
-35279,
-35499,
-35721,
-35922,
-36185,
-36448,
-36735,
-37021,
-37220,
-37398,
-37475,
-37545,
-37536,
-37544,
-37442,
-37370,
-37173,
-37036,
-36780,
-36583,
-36349,
-36111,
-35902,
-35675,
-35491,
-35334,
-35212,
-35117,
-35065,
-35041,
-35032,
-35070,
-35100,
-35188,
-35232,
-35301,
-35293,
-35295,
-35245,
-35202,
-35164,
-35142,
-35071,
-34986,
-34808,
-34632,
-34436,
-34242,
-34068,
-33866,
-33636,
-33403,
-33140,
-32946,
-32775,
-32675,
-32594,
-32526,
-32478,
-32427,
-32407,
-32419,
-32448,
-32548,
-32606,
-32725,
-32781,
-32864,
-32902,
-32976,
-33022,
-33071,
-33085,
-33033,
-33000,
-32899,
-32817,
-32738,
-32583,
-32476,
-32256,
-32083,
-31920,
-31770,
-31739,
-31682,
-31696,
-31709,
-31744,
-31830,
-31928,
-32042,
-32161,
-32246,
-32306,
-32380,
-32421,
-32511,
-32585,
-32680,
-32749,
-32795,
-32812,
-32796,
-32761,
-32686,
-32625,
-32532,
-32472,
-32389,
-32367,
-32304,
-32295,
-32237,
-32198,
-32146,
-32120,
-32074,
-32069,
-32046,
-32040,
-32047,
-32003,
-31963,
-31848,
-31709,
-31520,
-31337,
-31110,
-30941,
-30690,
-30506,
-30268,
-30064,
-29869,
-29731,
-29627,
-29614,
-29617,
-29687,
-29783,
-29961,
-30154,
-30450,
-30707,
-30982,
-31166,
-31275,
-31296,
-31211,
-31080,
-30839,
-30583,
-30258,
-29929,
-29578,
-29198,
-28822,
-28416,
-28032,
-27672,
-27387,
-27165,
-27072,
-27041,
-27122,
-27290,
-27518,
-27841,
-28171,
-28522,
-28853,
-29178,
-29459,
-29722,
-29896,
-30064,
-30095,
-30148,
-30048,
-29933,
-29687,
-29383,
-29000,
-28604,
-28199,
-27862,
-27570,
-27351,
-27203,
-27109,
-27105,
-27186,
-27396,
-27703,
-28104,
-28561,
-29025,
-29492,
-29914,
-30294,
-30610,
-30888,
-31111,
-31333,
-31538,
-31772,
-31970,
-32180,
-32309,
-32429,
-32488,
-32544,
-32600,
-32662,
-32723,
-32769,
-32806,
-32862,
-32999,
-33157,
-33416,
-33574,
-33718,
-33709,
-33664,
-33596,
-33553,
-33551,
-33564,
-33549,
-33550,
-33555,
-33617,
-33743,
-33887,
-34045,
-34202,
-34380,
-34624,
-34964,
-35418,
-35942,
-36502,
-37075,
-37546,
-37974,
-38254,
-38444,
-38493,
-38493,
-38365,
-38260,
-38074,
-37901,
-37699,
-37454,
-37186,
-36894,
-36588,
-36264,
-35965,
-35680,
-35451,
-35367,
-35364,
-35555,
-35813,
-36168,
-36553,
-36971,
-37410,
-37893,
-38340,
-38753,
-39031,
-39184,
-39229,
-39136,
-39000,
-38763,
-38447,
-38034,
-37530,
-36992,
-36427,
-35950,
-35498,
-35165,
-34865,
-34608,
-34386,
-34213,
-34081,
-34057,
-34082,
-34192,
-34302,
-34425,
-34526,
-34579,
-34584,
-34520,
-34411,
-34176,
-33898,
-33478,
-33025,
-32496,
-31940,
-31420,
-30896,
-30462,
-30066,
-29732,
-29470,
-29243,
-29097,
-28996,
-28982,
-29002,
-29102,
-29205,
-29325,
-29467,
-29583,
-29731,
-29826,
-29950,
-30017,
-30102,
-30185,
-30280,
-30384,
-30484,
-30554,
-30614,
-30656,
-30702,
-30791,
-30864,
-31002,
-31093,
-31202,
-31314,
-31430,
-31643,
-31846,
-32129,
-32329,
-32579,
-32760,
-33012,
-33235,
-33487,
-33717,
-33878,
-34043,
-34155,
-34311,
-34428,
-34573,
-34637,
-34708,
-34704,
-34756,
-34762,
-34817,
-34836,
-34833,
-34850,
-34845,
-34918,
-35036,
-35198,
-35383,
-35545,
-35661,
-35741,
-35797,
-35840,
-35912,
-35928,
-35971,
-35952,
-35917,
-35883,
-35833,
-35768,
-35692,
-35572,
-35406,
-35245,
-35036,
-34882,
-34723,
-34612,
-34489,
-34389,
-34286,
-34189,
-34105,
-33993,
-33864,
-33696,
-33517,
-33339,
-33203,
-33080,
-32985,
-32897,
-32798,
-32689,
-32569,
-32419,
-32236,
-32023,
-31807,
-31554,
-31356,
-31123,
-30971,
-30784,
-30641,
-30493,
-30343,
-30210,
-30081,
-29947,
-29814,
-29705,
-29582,
-29526,
-29468,
-29428,
-29422,
-29379,
-29362,
-29346,
-29355,
-29394,
-29454,
-29481,
-29491,
-29483,
-29454,
-29463,
-29474,
-29536,
-29597,
-29668,
-29708,
-29749,
-29802,
-29863,
-29956,
-30060,
-30151,
-30274,
-30365,
-30451,
-30587,
-30726,
-30929,
-31189,
-31439,
-31746,
-32023,
-32334,
-32653,
-33016,
-33404,
-33815,
-34179,
-34524,
-34755,
-35004,
-35137,
-35320,
-35412,
-35482,
-35429,
-35346,
-35184,
-35078,
-34980,
-34932,
-34885,
-34812,
-34761,
-34703,
-34749,
-34804,
-34995,
-35157,
-35376,
-35579,
-35781,
-36007,
-36254,
-36505,
-36750,
-36977,
-37166,
-37314,
-37395,
-37424,
-37365,
-37266,
-37059,
-36856,
-36532,
-36249,
-35870,
-35521,
-35137,
-34737,
-34350,
-33956,
-33585,
-33258,
-32969,
-32721,
-32527,
-32336,
-32221,
-32121,
-32106,
-32121,
-32225,
-32320,
-32450,
-32548,
-32599,
-32626,
-32596,
-32547,
-32478,
-32366,
-32197,
-31962,
-31628,
-31240,
-30798,
-30380,
-29948,
-29593,
-29185,
-28841,
-28474,
-28192,
-27951,
-27841,
-27798,
-27861,
-27991,
-28149,
-28376,
-28606,
-28880,
-29132,
-29383,
-29564,
-29721,
-29781,
-29823,
-29809,
-29779,
-29747,
-29667,
-29595,
-29463,
-29317,
-29163,
-29018,
-28876,
-28773,
-28612,
-28526,
-28424,
-28481,
-28557,
-28830,
-29097,
-29492,
-29819,
-30214,
-30568,
-30953,
-31323,
-31674,
-32023,
-32336,
-32644,
-32949,
-33245,
-33552,
-33855,
-34130,
-34422,
-34621,
-34900,
-35045,
-35296,
-35443,
-35637,
-35774,
-35907,
-36002,
-36085,
-36207,
-36290,
-36440,
-36568,
-36677,
-36800,
-36844,
-36936,
-36964,
-37028,
-37066,
-37078,
-37095,
-37081,
-37076,
-37041,
-37020,
-36948,
-36896,
-36752,
-36615,
-36437,
-36257,
-36056,
-35844,
-35605,
-35329,
-35026,
-34703,
-34351,
-34025,
-33655,
-33288,
-32920,
-32512,
-32184,
-31843,
-31585,
-31348,
-31128,
-30914,
-30685,
-30444,
-30236,
-30032,
-29875,
-29715,
-29571,
-29399,
-29229,
-29003,
-28808,
-28533,
-28298,
-27963,
-27658,
-27322,
-26989,
-26679,
-26389,
-26127,
-25931,
-25773,
-25678,
-25666,
-25685,
-25812,
-25951,
-26202,
-26497,
-26882,
-27311,
-27762,
-28218,
-28652,
-29072,
-29443,
-29800,
-30090,
-30322,
-30527,
-30634,
-30780,
-30861,
-30990,
-31117,
-31223,
-31376,
-31492,
-31697,
-31960,
-32296,
-32724,
-33177,
-33683,
-34174,
-34742,
-35267,
-35864,
-36402,
-36920,
-37370,
-37757,
-38102,
-38399,
-38655,
-38857,
-38969,
-39035,
-38996,
-38948,
-38845,
-38749,
-38613,
-38498,
-38363,
-38263,
-38150,
-38101,
-38033,
-38002,
-37971,
-37944,
-37960,
-38004,
-38104,
-38217,
-38363,
-38447,
-38519,
-38532,
-38497,
-38417,
-38324,
-38161,
-38004,
-37775,
-37520,
-37207,
-36857,
-36466,
-36068,
-35664,
-35203,
-34758,
-34251,
-33777,
-33341,
-32940,
-32616,
-32307,
-32030,
-31765,
-31528,
-31328,
-31168,
-31048,
-30978,
-30897,
-30844,
-30764,
-30669,
-30524,
-30342,
-30111,
-29891,
-29630,
-29388,
-29124,
-28851,
-28568,
-28249,
-28000,
-27727,
-27547,
-27383,
-27275,
-27213,
-27182,
-27201,
-27253,
-27336,
-27449,
-27615,
-27762,
-27971,
-28145,
-28351,
-28552,
-28741,
-28942,
-29091,
-29264,
-29370,
-29514,
-29603,
-29720,
-29826,
-29913,
-30057,
-30175,
-30357,
-30548,
-30738,
-30919,
-31088,
-31256,
-31451,
-31711,
-32002,
-32385,
-32763,
-33216,
-33635,
-34082,
-34489,
-34883,
-35218,
-35572,
-35877,
-36231,
-36557,
-36860,
-37146,
-37335,
-37523,
-37604,
-37706,
-37717,
-37759,
-37736,
-37711,
-37673,
-37617,
-37566,
-37528,
-37495,
-37514,
-37526,
-37588,
-37618,
-37670,
-37696,
-37727,
-37789,
-37841,
-37903,
-37938,
-37912,
-37885,
-37798,
-37701,
-37623,
-37483,
-37411,
-37251,
-37123,
-36913,
-36711,
-36461,
-36195,
-35928,
-35656,
-35394,
-35134,
-34890,
-34610,
-34314,
-33992,
-33649,
-33323,
-33008,
-32712,
-32414,
-32129,
-31857,
-31609,
-31443,
-31274,
-31173,
-31090,
-30993,
-30933,
-30851,
-30802,
-30760,
-30718,
-30642,
-30598,
-30490,
-30398,
-30275,
-30133,
-29943,
-29759,
-29519,
-29298,
-29090,
-28878,
-28720,
-28560,
-28424,
-28329,
-28265,
-28242,
-28340,
-28413,
-28644,
-28819,
-29104,
-29336,
-29614,
-29840,
-30079,
-30252,
-30412,
-30535,
-30637,
-30741,
-30797,
-30884,
-30944,
-31002,
-31076,
-31136,
-31203,
-31306,
-31389,
-31540,
-31693,
-31908,
-32140,
-32406,
-32684,
-32949,
-33200,
-33441,
-33641,
-33869,
-34077,
-34312,
-34537,
-34785,
-34992,
-35235,
-35432,
-35642,
-35830,
-35990,
-36140,
-36238,
-36335,
-36411,
-36511,
-36586,
-36704,
-36760,
-36847,
-36857,
-36872,
-36811,
-36766,
-36652,
-36564,
-36451,
-36295,
-36179,
-35966,
-35806,
-35562,
-35350,
-35115,
-34907,
-34692,
-34504,
-34305,
-34104,
-33929,
-33740,
-33561,
-33382,
-33181,
-32958,
-32727,
-32470,
-32237,
-32014,
-31784,
-31581,
-31361,
-31141,
-30922,
-30665,
-30419,
-30134,
-29862,
-29579,
-29338,
-29080,
-28882,
-28645,
-28446,
-28206,
-28011,
-27792,
-27654,
-27481,
-27405,
-27256,
-27189,
-27099,
-27039,
-27005,
-26974,
-26971,
-26953,
-26963,
-26982,
-27013,
-27092,
-27161,
-27279,
-27408,
-27537,
-27718,
-27853,
-28014,
-28135,
-28274,
-28426,
-28616,
-28850,
-29086,
-29326,
-29563,
-29743,
-29963,
-30117,
-30310,
-30459,
-30613,
-30778,
-30932,
-31155,
-31340,
-31596,
-31806,
-32040,
-32235,
-32464,
-32665,
-32928,
-33131,
-33395,
-33585,
-33816,
-33997,
-34190,
-34364,
-34527,
-34661,
-34791,
-34866,
-34963,
-35010,
-35091,
-35091,
-35134,
-35105,
-35080,
-35033,
-34952,
-34861,
-34752,
-34656,
-34548,
-34458,
-34402,
-34333,
-34329,
-34294,
-34317,
-34322,
-34340,
-34412,
-34434,
-34571,
-34637,
-34793,
-34886,
-34998,
-35031,
-35060,
-34995,
-34944,
-34808,
-34707,
-34547,
-34403,
-34221,
-34024,
-33813,
-33604,
-33368,
-33191,
-32979,
-32838,
-32676,
-32576,
-32492,
-32445,
-32462,
-32478,
-32543,
-32589,
-32636,
-32693,
-32730,
-32792,
-32830,
-32868,
-32877,
-32884,
-32818,
-32774,
-32641,
-32527,
-32356,
-32196,
-32043,
-31876,
-31757,
-31645,
-31551,
-31494,
-31423,
-31405,
-31347,
-31350,
-31308,
-31345,
-31375,
-31444,
-31554,
-31634,
-31776,
-31893,
-32054,
-32196,
-32356,
-32460,
-32556,
-32625,
-32684,
-32744,
-32834,
-32935,
-33068,
-33206,
-33329,
-33427,
-33527,
-33576,
-33654,
-33679,
-33726,
-33742,
-33764,
-33763,
-33803,
-33834,
-33918,
-34050,
-34134,
-34340,
-34429,
-34628,
-34766,
-34959,
-35149,
-35359,
-35558,
-35731,
-35889,
-35995,
-36104,
-36164,
-36238,
-36247,
-36260,
-36194,
-36091,
-35926,
-35745,
-35516,
-35267,
-35022,
-34748,
-34515,
-34276,
-34115,
-33971,
-33890,
-33847,
-33822,
-33851,
-33886,
-33967,
-34087,
-34227,
-34396,
-34563,
-34741,
-34903,
-35039,
-35118,
-35201,
-35197,
-35208,
-35142,
-35008,
-34804,
-34545,
-34226,
-33919,
-33628,
-33313,
-33066,
-32745,
-32475,
-32217,
-32045,
-31938,
-31920,
-31955,
-32047,
-32183,
-32362,
-32593,
-32860,
-33159,
-33444,
-33708,
-33941,
-34080,
-34210,
-34234,
-34227,
-34151,
-34016,
-33832,
-33582,
-33285,
-32985,
-32633,
-32323,
-32008,
-31714,
-31451,
-31200,
-30999,
-30844,
-30742,
-30723,
-30735,
-30835,
-30935,
-31112,
-31279,
-31501,
-31681,
-31892,
-32049,
-32195,
-32297,
-32333,
-32371,
-32333,
-32282,
-32158,
-32012,
-31814,
-31627,
-31406,
-31222,
-31025,
-30874,
-30708,
-30630,
-30546,
-30571,
-30623,
-30758,
-30954,
-31163,
-31466,
-31723,
-32061,
-32348,
-32663,
-32911,
-33160,
-33318,
-33482,
-33574,
-33665,
-33713,
-33746,
-33732,
-33745,
-33694,
-33724,
-33707,
-33754,
-33776,
-33828,
-33889,
-33940,
-34035,
-34110,
-34225,
-34302,
-34399,
-34486,
-34541,
-34594,
-34607,
-34592,
-34543,
-34498,
-34405,
-34365,
-34266,
-34204,
-34115,
-34012,
-33944,
-33853,
-33781,
-33735,
-33646,
-33607,
-33503,
-33430,
-33329,
-33222,
-33133,
-33021,
-32929,
-32824,
-32754,
-32662,
-32572,
-32472,
-32335,
-32217,
-32069,
-31934,
-31784,
-31641,
-31436,
-31284,
-31060,
-30950,
-30793,
-30713,
-30624,
-30554,
-30503,
-30454,
-30435,
-30440,
-30434,
-30466,
-30471,
-30479,
-30504,
-30494,
-30530,
-30515,
-30540,
-30500,
-30500,
-30438,
-30405,
-30341,
-30284,
-30227,
-30201,
-30211,
-30228,
-30309,
-30376,
-30460,
-30577,
-30672,
-30822,
-30957,
-31097,
-31218,
-31326,
-31406,
-31483,
-31548,
-31601,
-31669,
-31659,
-31724,
-31692,
-31753,
-31766,
-31850,
-31909,
-32002,
-32079,
-32176,
-32277,
-32409,
-32556,
-32708,
-32869,
-33006,
-33128,
-33251,
-33323,
-33409,
-33442,
-33502,
-33518,
-33581,
-33616,
-33688,
-33729,
-33763,
-33782,
-33755,
-33762,
-33739,
-33749,
-33772,
-33789,
-33820,
-33861,
-33908,
-33993,
-34097,
-34209,
-34326,
-34429,
-34506,
-34573,
-34611,
-34625,
-34607,
-34577,
-34526,
-34478,
-34410,
-34308,
-34178,
-34021,
-33828,
-33653,
-33451,
-33315,
-33137,
-33013,
-32869,
-32768,
-32697,
-32676,
-32693,
-32748,
-32806,
-32846,
-32880,
-32890,
-32879,
-32848,
-32795,
-32691,
-32602,
-32446,
-32323,
-32139,
-31995,
-31788,
-31617,
-31408,
-31208,
-31046,
-30865,
-30746,
-30614,
-30577,
-30527,
-30554,
-30604,
-30673,
-30765,
-30857,
-30953,
-31054,
-31141,
-31211,
-31277,
-31314,
-31358,
-31381,
-31409,
-31443,
-31425,
-31415,
-31334,
-31273,
-31182,
-31114,
-31056,
-31037,
-31016,
-31047,
-31064,
-31123,
-31181,
-31241,
-31329,
-31386,
-31498,
-31600,
-31736,
-31891,
-32036,
-32206,
-32341,
-32520,
-32659,
-32831,
-32992,
-33152,
-33320,
-33479,
-33625,
-33792,
-33897,
-34019,
-34080,
-34118,
-34144,
-34139,
-34137,
-34110,
-34085,
-34027,
-34008,
-33948,
-33963,
-33955,
-33989,
-33997,
-34051,
-34126,
-34267,
-34444,
-34667,
-34886,
-35127,
-35307,
-35508,
-35666,
-35784,
-35883,
-35918,
-35946,
-35938,
-35917,
-35874,
-35823,
-35708,
-35595,
-35407,
-35222,
-35004,
-34789,
-34557,
-34352,
-34115,
-33958,
-33780,
-33691,
-33593,
-33540,
-33508,
-33476,
-33519,
-33578,
-33661,
-33785,
-33855,
-33963,
-34000,
-34055,
-34057,
-34027,
-33952,
-33813,
-33647,
-33453,
-33235,
-32995,
-32758,
-32484,
-32215,
-31916,
-31641,
-31356,
-31120,
-30899,
-30730,
-30591,
-30483,
-30414,
-30354,
-30318,
-30326,
-30327,
-30405,
-30476,
-30601,
-30721,
-30829,
-30949,
-31005,
-31091,
-31096,
-31142,
-31115,
-31102,
-31050,
-30985,
-30893,
-30798,
-30687,
-30603,
-30538,
-30483,
-30466,
-30463,
-30450,
-30494,
-30520,
-30644,
-30826,
-31057,
-31375,
-31677,
-32036,
-32344,
-32683,
-32981,
-33259,
-33529,
-33736,
-33919,
-34065,
-34147,
-34228,
-34280,
-34312,
-34373,
-34385,
-34429,
-34432,
-34438,
-34451,
-34443,
-34484,
-34524,
-34607,
-34730,
-34858,
-35027,
-35179,
-35355,
-35512,
-35671,
-35821,
-35932,
-36049,
-36083,
-36131,
-36089,
-36078,
-35983,
-35940,
-35842,
-35740,
-35625,
-35471,
-35323,
-35159,
-34983,
-34825,
-34665,
-34542,
-34425,
-34339,
-34259,
-34192,
-34130,
-34076,
-34038,
-34012,
-33977,
-33957,
-33880,
-33829,
-33704,
-33620,
-33484,
-33363,
-33181,
-33005,
-32800,
-32602,
-32405,
-32203,
-32032,
-31850,
-31695,
-31583,
-31465,
-31411,
-31342,
-31289,
-31260,
-31234,
-31227,
-31260,
-31284,
-31329,
-31357,
-31380,
-31369,
-31354,
-31315,
-31252,
-31207,
-31114,
-31055,
-30962,
-30911,
-30815,
-30764,
-30685,
-30629,
-30620,
-30597,
-30608,
-30599,
-30585,
-30584,
-30630,
-30687,
-30823,
-30915,
-31076,
-31135,
-31253,
-31311,
-31428,
-31504,
-31638,
-31691,
-31803,
-31835,
-31901,
-31970,
-32025,
-32133,
-32227,
-32336,
-32471,
-32601,
-32737,
-32868,
-32961,
-33074,
-33107,
-33184,
-33211,
-33247,
-33269,
-33270,
-33240,
-33195,
-33108,
-33022,
-32932,
-32853,
-32824,
-32790,
-32811,
-32855,
-32902,
-32995,
-33087,
-33169,
-33277,
-33354,
-33426,
-33500,
-33526,
-33573,
-33547,
-33538,
-33456,
-33372,
-33232,
-33083,
-32882,
-32711,
-32473,
-32307,
-32078,
-31923,
-31763,
-31634,
-31542,
-31461,
-31434,
-31402,
-31418,
-31431,
-31473,
-31508,
-31548,
-31603,
-31636,
-31664,
-31659,
-31653,
-31603,
-31603,
-31558,
-31559,
-31525,
-31492,
-31440,
-31369,
-31283,
-31236,
-31180,
-31167,
-31180,
-31196,
-31259,
-31322,
-31413,
-31531,
-31635,
-31753,
-31861,
-31937,
-32029,
-32070,
-32125,
-32173,
-32186,
-32262,
-32244,
-32325,
-32314,
-32341,
-32316,
-32282,
-32255,
-32204,
-32190,
-32183,
-32191,
-32229,
-32251,
-32307,
-32357,
-32451,
-32525,
-32661,
-32751,
-32882,
-32971,
-33068,
-33159,
-33251,
-33345,
-33429,
-33511,
-33561,
-33623,
-33654,
-33718,
-33750,
-33824,
-33840,
-33866,
-33863,
-33841,
-33838,
-33814,
-33787,
-33755,
-33697,
-33663,
-33638,
-33634,
-33659,
-33685,
-33719,
-33734,
-33750,
-33768,
-33804,
-33865,
-33945,
-34011,
-34096,
-34142,
-34180,
-34223,
-34234,
-34302,
-34311,
-34329,
-34286,
-34240,
-34171,
-34126,
-34084,
-34062,
-34009,
-33928,
-33848,
-33737,
-33684,
-33604,
-33568,
-33540,
-33487,
-33481,
-33439,
-33456,
-33472,
-33488,
-33531,
-33538,
-33570,
-33597,
-33620,
-33672,
-33677,
-33716,
-33684,
-33664,
-33601,
-33514,
-33443,
-33340,
-33275,
-33168,
-33098,
-32993,
-32899,
-32800,
-32689,
-32587,
-32506,
-32409,
-32351,
-32237,
-32178,
-32073,
-32030,
-31968,
-31937,
-31899,
-31875,
-31847,
-31794,
-31788,
-31718,
-31694,
-31620,
-31532,
-31465,
-31347,
-31284,
-31205,
-31133,
-31083,
-31003,
-30955,
-30890,
-30858,
-30833,
-30825,
-30840,
-30844,
-30854,
-30875,
-30892,
-30930,
-30965,
-31023,
-31071,
-31139,
-31201,
-31283,
-31381,
-31479,
-31618,
-31726,
-31892,
-32023,
-32163,
-32317,
-32446,
-32591,
-32725,
-32821,
-32937,
-33007,
-33109,
-33193,
-33326,
-33426,
-33613,
-33728,
-33928,
-34070,
-34240,
-34396,
-34535,
-34639,
-34750,
-34790,
-34864,
-34905,
-34970,
-35044,
-35106,
-35179,
-35240,
-35270,
-35319,
-35349,
-35389,
-35417,
-35455,
-35499,
-35517,
-35570,
-35561,
-35607,
-35580,
-35596,
-35555,
-35536,
-35471,
-35412,
-35287,
-35198,
-35076,
-34985,
-34908,
-34778,
-34689,
-34566,
-34451,
-34383,
-34297,
-34246,
-34174,
-34102,
-34023,
-33931,
-33879,
-33813,
-33765,
-33719,
-33657,
-33609,
-33538,
-33495,
-33420,
-33375,
-33298,
-33235,
-33140,
-33042,
-32920,
-32814,
-32715,
-32625,
-32548,
-32444,
-32339,
-32209,
-32082,
-31960,
-31866,
-31772,
-31734,
-31659,
-31661,
-31633,
-31688,
-31697,
-31745,
-31739,
-31712,
-31645,
-31583,
-31502,
-31446,
-31387,
-31325,
-31251,
-31172,
-31100,
-31047,
-31019,
-30989,
-30980,
-30960,
-30971,
-30998,
-31063,
-31159,
-31277,
-31387,
-31484,
-31565,
-31613,
-31677,
-31698,
-31724,
-31741,
-31716,
-31726,
-31686,
-31684,
-31662,
-31634,
-31619,
-31586,
-31567,
-31546,
-31542,
-31524,
-31552,
-31565,
-31611,
-31663,
-31719,
-31817,
-31873,
-31985,
-32062,
-32169,
-32265,
-32335,
-32398,
-32420,
-32441,
-32423,
-32432,
-32369,
-32346,
-32262,
-32205,
-32130,
-32064,
-31983,
-31903,
-31827,
-31759,
-31741,
-31714,
-31734,
-31739,
-31760,
-31776,
-31807,
-31842,
-31863,
-31896,
-31901,
-31910,
-31920,
-31881,
-31866,
-31784,
-31701,
-31608,
-31504,
-31426,
-31334,
-31245,
-31159,
-31035,
-30949,
-30817,
-30740,
-30667,
-30646,
-30639,
-30671,
-30706,
-30785,
-30820,
-30931,
-30991,
-31128,
-31228,
-31363,
-31459,
-31555,
-31627,
-31690,
-31744,
-31786,
-31826,
-31821,
-31804,
-31755,
-31677,
-31636,
-31551,
-31536,
-31489,
-31487,
-31473,
-31505,
-31499,
-31573,
-31624,
-31721,
-31869,
-31977,
-32193,
-32355,
-32569,
-32763,
-32931,
-33127,
-33252,
-33443,
-33557,
-33715,
-33834,
-33932,
-34020,
-34078,
-34149,
-34172,
-34236,
-34225,
-34269,
-34255,
-34278,
-34290,
-34321,
-34341,
-34370,
-34397,
-34394,
-34439,
-34463,
-34516,
-34608,
-34667,
-34787,
-34877,
-35000,
-35114,
-35251,
-35348,
-35491,
-35559,
-35678,
-35701,
-35807,
-35839,
-35915,
-35955,
-35985,
-35980,
-35962,
-35885,
-35797,
-35678,
-35522,
-35380,
-35206,
-35069,
-34956,
-34861,
-34820,
-34763,
-34783,
-34753,
-34802,
-34810,
-34880,
-34926,
-35011,
-35069,
-35143,
-35206,
-35223,
-35264,
-35230,
-35207,
-35148,
-35082,
-34959,
-34830,
-34654,
-34457,
-34270,
-34057,
-33893,
-33711,
-33578,
-33437,
-33306,
-33223,
-33114,
-33056,
-32990,
-32944,
-32918,
-32876,
-32865,
-32796,
-32789,
-32740,
-32734,
-32719,
-32718,
-32678,
-32627,
-32539,
-32432,
-32335,
-32197,
-32078,
-31928,
-31799,
-31665,
-31573,
-31483,
-31450,
-31383,
-31356,
-31297,
-31273,
-31241,
-31231,
-31216,
-31219,
-31216,
-31231,
-31242,
-31275,
-31287,
-31337,
-31371,
-31437,
-31489,
-31535,
-31577,
-31617,
-31640,
-31681,
-31704,
-31750,
-31782,
-31836,
-31870,
-31940,
-31983,
-32074,
-32121,
-32198,
-32234,
-32282,
-32337,
-32398,
-32483,
-32590,
-32650,
-32767,
-32794,
-32904,
-32950,
-33056,
-33106,
-33200,
-33240,
-33311,
-33369,
-33426,
-33485,
-33551,
-33569,
-33636,
-33664,
-33708,
-33768,
-33786,
-33835,
-33865,
-33893,
-33924,
-33953,
-33985,
-34020,
-34054,
-34069,
-34107,
-34108,
-34110,
-34123,
-34129,
-34135,
-34149,
-34125,
-34131,
-34089,
-34056,
-34011,
-33946,
-33874,
-33776,
-33692,
-33609,
-33548,
-33502,
-33455,
-33412,
-33383,
-33334,
-33340,
-33320,
-33319,
-33320,
-33308,
-33342,
-33329,
-33375,
-33352,
-33376,
-33331,
-33292,
-33258,
-33189,
-33126,
-33028,
-32915,
-32769,
-32657,
-32511,
-32416,
-32313,
-32238,
-32178,
-32124,
-32102,
-32053,
-32050,
-31977,
-31961,
-31897,
-31884,
-31838,
-31833,
-31788,
-31778,
-31699,
-31662,
-31564,
-31504,
-31424,
-31341,
-31270,
-31195,
-31112,
-31082,
-31050,
-31049,
-31069,
-31076,
-31082,
-31097,
-31063,
-31035,
-31000,
-30931,
-30876,
-30797,
-30711,
-30644,
-30570,
-30480,
-30408,
-30286,
-30204,
-30096,
-30040,
-29990,
-29995,
-30011,
-30020,
-30056,
-30082,
-30111,
-30160,
-30203,
-30270,
-30350,
-30406,
-30483,
-30518,
-30559,
-30583,
-30629,
-30661,
-30716,
-30747,
-30759,
-30766,
-30749,
-30743,
-30732,
-30738,
-30739,
-30747,
-30751,
-30743,
-30747,
-30798,
-30832,
-30931,
-30991,
-31097,
-31142,
-31261,
-31303,
-31417,
-31471,
-31550,
-31607,
-31646,
-31732,
-31768,
-31870,
-31908,
-31958,
-31965,
-31949,
-31936,
-31895,
-31899,
-31887,
-31915,
-31948,
-31993,
-32058,
-32117,
-32225,
-32320,
-32455,
-32577,
-32695,
-32827,
-32910,
-33045,
-33125,
-33253,
-33331,
-33412,
-33451,
-33490,
-33497,
-33503,
-33497,
-33487,
-33481,
-33478,
-33462,
-33473,
-33460,
-33459,
-33448,
-33452,
-33464,
-33511,
-33573,
-33656,
-33727,
-33814,
-33863,
-33911,
-33951,
-33985,
-34017,
-34048,
-34087,
-34108,
-34152,
-34167,
-34203,
-34204,
-34210,
-34208,
-34187,
-34170,
-34110,
-34027,
-33934,
-33816,
-33729,
-33631,
-33609,
-33524,
-33519,
-33446,
-33437,
-33410,
-33427,
-33459,
-33493,
-33579,
-33641,
-33724,
-33844,
-33885,
-33993,
-34029,
-34076,
-34138,
-34153,
-34204,
-34204,
-34202,
-34156,
-34094,
-34015,
-33928,
-33840,
-33762,
-33666,
-33594,
-33527,
-33463,
-33462,
-33457,
-33507,
-33558,
-33649,
-33732,
-33840,
-33974,
-34091,
-34267,
-34394,
-34535,
-34646,
-34718,
-34797,
-34833,
-34851,
-34842,
-34799,
-34733,
-34674,
-34607,
-34525,
-34467,
-34319,
-34227,
-34108,
-33994,
-33960,
-33856,
-33850,
-33791,
-33782,
-33766,
-33791,
-33807,
-33841,
-33841,
-33839,
-33810,
-33775,
-33743,
-33684,
-33653,
-33587,
-33544,
-33470,
-33416,
-33320,
-33247,
-33112,
-33010,
-32859,
-32755,
-32654,
-32595,
-32534,
-32492,
-32461,
-32387,
-32373,
-32300,
-32289,
-32244,
-32190,
-32170,
-32098,
-32102,
-32034,
-32048,
-32003,
-31988,
-31961,
-31957,
-31941,
-31970,
-31956,
-31974,
-31960,
-31955,
-31966,
-31958,
-31979,
-31975,
-31968,
-31962,
-31921,
-31948,
-31935,
-31970,
-31981,
-31990,
-32000,
-32002,
-32000,
-32031,
-32031,
-32076,
-32103,
-32143,
-32205,
-32277,
-32355,
-32460,
-32537,
-32636,
-32716,
-32786,
-32858,
-32935,
-33009,
-33076,
-33163,
-33208,
-33289,
-33329,
-33397,
-33463,
-33517,
-33590,
-33644,
-33731,
-33799,
-33894,
-33975,
-34063,
-34150,
-34209,
-34297,
-34354,
-34449,
-34523,
-34604,
-34679,
-34710,
-34767,
-34745,
-34783,
-34790,
-34810,
-34824,
-34808,
-34784,
-34777,
-34736,
-34736,
-34704,
-34693,
-34655,
-34633,
-34591,
-34585,
-34587,
-34592,
-34621,
-34598,
-34625,
-34572,
-34591,
-34537,
-34507,
-34456,
-34342,
-34241,
-34102,
-33975,
-33848,
-33716,
-33575,
-33434,
-33261,
-33087,
-32918,
-32747,
-32599,
-32417,
-32263,
-32084,
-31938,
-31788,
-31686,
-31578,
-31487,
-31406,
-31316,
-31253,
-31182,
-31145,
-31111,
-31059,
-31036,
-30964,
-30953,
-30882,
-30889,
-30840,
-30836,
-30777,
-30717,
-30637,
-30511,
-30434,
-30274,
-30195,
-30041,
-29945,
-29850,
-29760,
-29734,
-29709,
-29745,
-29781,
-29838,
-29901,
-29957,
-30054,
-30150,
-30281,
-30417,
-30556,
-30704,
-30834,
-30972,
-31083,
-31205,
-31303,
-31388,
-31468,
-31529,
-31576,
-31642,
-31686,
-31751,
-31792,
-31841,
-31857,
-31909,
-31905,
-31949,
-31950,
-31995,
-32020,
-32079,
-32163,
-32225,
-32338,
-32398,
-32501,
-32584,
-32681,
-32756,
-32853,
-32904,
-32958,
-32956,
-32966,
-32947,
-32920,
-32882,
-32807,
-32738,
-32663,
-32577,
-32521,
-32455,
-32372,
-32308,
-32206,
-32118,
-32026,
-31955,
-31906,
-31880,
-31855,
-31858,
-31861,
-31912,
-31945,
-32015,
-32058,
-32110,
-32129,
-32181,
-32187,
-32248,
-32247,
-32297,
-32295,
-32292,
-32272,
-32214,
-32157,
-32067,
-31991,
-31916,
-31849,
-31800,
-31750,
-31716,
-31685,
-31688,
-31694,
-31734,
-31780,
-31851,
-31897,
-31987,
-32026,
-32129,
-32167,
-32263,
-32296,
-32397,
-32466,
-32567,
-32665,
-32742,
-32813,
-32832,
-32870,
-32859,
-32882,
-32895,
-32884,
-32910,
-32879,
-32898,
-32875,
-32896,
-32854,
-32872,
-32804,
-32833,
-32789,
-32841,
-32840,
-32882,
-32919,
-32950,
-33030,
-33087,
-33192,
-33295,
-33399,
-33514,
-33602,
-33682,
-33739,
-33781,
-33805,
-33824,
-33805,
-33803,
-33759,
-33729,
-33693,
-33679,
-33652,
-33642,
-33629,
-33592,
-33584,
-33555,
-33554,
-33590,
-33610,
-33686,
-33750,
-33828,
-33904,
-33979,
-33994,
-34043,
-34039,
-34027,
-34043,
-34006,
-34036,
-34010,
-34000,
-33953,
-33900,
-33818,
-33735,
-33641,
-33563,
-33477,
-33412,
-33331,
-33272,
-33199,
-33143,
-33064,
-32998,
-32944,
-32882,
-32855,
-32843,
-32818,
-32847,
-32827,
-32850,
-32836,
-32837,
-32792,
-32782,
-32715,
-32714,
-32678,
-32667,
-32666,
-32655,
-32634,
-32634,
-32615,
-32621,
-32625,
-32619,
-32622,
-32610,
-32618,
-32611,
-32630,
-32619,
-32653,
-32656,
-32680,
-32721,
-32716,
-32790,
-32796,
-32853,
-32888,
-32934,
-32975,
-33036,
-33067,
-33118,
-33149,
-33217,
-33258,
-33309,
-33366,
-33390,
-33433,
-33456,
-33470,
-33494,
-33510,
-33530,
-33542,
-33566,
-33590,
-33630,
-33675,
-33725,
-33796,
-33833,
-33912,
-33930,
-34015,
-34006,
-34089,
-34064,
-34107,
-34075,
-34081,
-34054,
-34032,
-34001,
-33954,
-33890,
-33815,
-33747,
-33693,
-33652,
-33632,
-33632,
-33645,
-33671,
-33710,
-33722,
-33758,
-33747,
-33759,
-33756,
-33745,
-33768,
-33740,
-33721,
-33675,
-33590,
-33530,
-33405,
-33342,
-33201,
-33127,
-32994,
-32907,
-32816,
-32756,
-32694,
-32655,
-32581,
-32524,
-32476,
-32412,
-32408,
-32392,
-32396,
-32424,
-32423,
-32434,
-32406,
-32385,
-32352,
-32301,
-32264,
-32195,
-32128,
-32087,
-32019,
-31980,
-31941,
-31877,
-31830,
-31740,
-31688,
-31638,
-31586,
-31599,
-31576,
-31602,
-31624,
-31653,
-31672,
-31690,
-31698,
-31696,
-31697,
-31733,
-31773,
-31860,
-31933,
-32047,
-32119,
-32220,
-32292,
-32362,
-32431,
-32481,
-32542,
-32587,
-32650,
-32682,
-32740,
-32736,
-32782,
-32752,
-32760,
-32750,
-32750,
-32755,
-32783,
-32779,
-32826,
-32854,
-32944,
-33041,
-33179,
-33308,
-33450,
-33550,
-33654,
-33748,
-33844,
-33938,
-34026,
-34076,
-34132,
-34149,
-34198,
-34227,
-34252,
-34251,
-34199,
-34148,
-34089,
-34065,
-34054,
-34050,
-34064,
-34010,
-33987,
-33920,
-33860,
-33817,
-33780,
-33756,
-33793,
-33813,
-33883,
-33935,
-33954,
-33951,
-33871,
-33753,
-33604,
-33464,
-33331,
-33240,
-33199,
-33135,
-33096,
-32973,
-32798,
-32578,
-32330,
-32101,
-31908,
-31756,
-31676,
-31637,
-31669,
-31683,
-31722,
-31700,
-31636,
-31510,
-31374,
-31253,
-31179,
-31189,
-31239,
-31320,
-31408,
-31457,
-31483,
-31463,
-31388,
-31301,
-31151,
-31039,
-30896,
-30853,
-30840,
-30897,
-30962,
-31036,
-31042,
-31042,
-30984,
-30932,
-30886,
-30855,
-30908,
-30983,
-31124,
-31268,
-31416,
-31507,
-31575,
-31586,
-31582,
-31588,
-31561,
-31586,
-31592,
-31649,
-31700,
-31762,
-31810,
-31852,
-31882,
-31933,
-31992,
-32067,
-32159,
-32224,
-32321,
-32349,
-32428,
-32435,
-32466,
-32454,
-32449,
-32444,
-32419,
-32435,
-32379,
-32382,
-32309,
-32278,
-32214,
-32176,
-32124,
-32096,
-32081,
-32106,
-32157,
-32241,
-32297,
-32368,
-32389,
-32411,
-32408,
-32413,
-32426,
-32435,
-32456,
-32485,
-32466,
-32451,
-32394,
-32324,
-32244,
-32171,
-32096,
-32067,
-32012,
-31969,
-31946,
-31908,
-31906,
-31912,
-31922,
-31948,
-31986,
-32021,
-32085,
-32158,
-32221,
-32314,
-32342,
-32397,
-32411,
-32433,
-32447,
-32497,
-32516,
-32596,
-32604,
-32661,
-32655,
-32659,
-32610,
-32562,
-32505,
-32460,
-32424,
-32424,
-32424,
-32480,
-32516,
-32588,
-32670,
-32742,
-32840,
-32930,
-33011,
-33144,
-33226,
-33385,
-33488,
-33619,
-33697,
-33788,
-33812,
-33855,
-33869,
-33896,
-33917,
-33956,
-33947,
-33966,
-33948,
-33928,
-33902,
-33864,
-33864,
-33853,
-33884,
-33941,
-33978,
-34078,
-34112,
-34223,
-34250,
-34346,
-34356,
-34436,
-34452,
-34501,
-34536,
-34538,
-34536,
-34503,
-34471,
-34422,
-34362,
-34312,
-34209,
-34154,
-34036,
-33972,
-33892,
-33823,
-33771,
-33702,
-33645,
-33613,
-33558,
-33531,
-33476,
-33451,
-33406,
-33396,
-33361,
-33353,
-33322,
-33286,
-33233,
-33185,
-33118,
-33077,
-33016,
-32943,
-32853,
-32762,
-32655,
-32557,
-32484,
-32403,
-32353,
-32307,
-32253,
-32226,
-32225,
-32206,
-32254,
-32261,
-32299,
-32336,
-32311,
-32358,
-32329,
-32362,
-32359,
-32368,
-32339,
-32345,
-32307,
-32301,
-32299,
-32271,
-32276,
-32252,
-32239,
-32225,
-32231,
-32243,
-32276,
-32315,
-32356,
-32398,
-32437,
-32471,
-32504,
-32537,
-32571,
-32606,
-32638,
-32643,
-32650,
-32638,
-32664,
-32655,
-32667,
-32650,
-32610,
-32591,
-32545,
-32556,
-32573,
-32595,
-32629,
-32648,
-32654,
-32673,
-32698,
-32714,
-32762,
-32777,
-32799,
-32823,
-32819,
-32853,
-32869,
-32897,
-32904,
-32918,
-32908,
-32925,
-32897,
-32913,
-32875,
-32889,
-32863,
-32899,
-32911,
-32973,
-33012,
-33085,
-33137,
-33219,
-33262,
-33359,
-33412,
-33490,
-33556,
-33619,
-33694,
-33755,
-33788,
-33826,
-33795,
-33809,
-33790,
-33797,
-33785,
-33771,
-33774,
-33739,
-33750,
-33747,
-33737,
-33748,
-33744,
-33746,
-33778,
-33792,
-33843,
-33896,
-33929,
-33967,
-33972,
-33984,
-33975,
-33987,
-33973,
-33970,
-33950,
-33935,
-33896,
-33880,
-33810,
-33778,
-33702,
-33643,
-33597,
-33544,
-33535,
-33502,
-33481,
-33434,
-33407,
-33355,
-33333,
-33271,
-33247,
-33184,
-33170,
-33125,
-33110,
-33056,
-33010,
-32940,
-32874,
-32811,
-32759,
-32728,
-32694,
-32659,
-32638,
-32595,
-32583,
-32555,
-32541,
-32548,
-32517,
-32543,
-32505,
-32532,
-32503,
-32498,
-32435,
-32412,
-32324,
-32286,
-32203,
-32144,
-32090,
-32025,
-32009,
-31969,
-31991,
-31990,
-32024,
-32036,
-32021,
-32011,
-31987,
-31966,
-31966,
-31971,
-31980,
-31983,
-31983,
-31947,
-31939,
-31867,
-31835,
-31759,
-31702,
-31627,
-31578,
-31515,
-31501,
-31468,
-31476,
-31473,
-31479,
-31486,
-31478,
-31499,
-31494,
-31533,
-31553,
-31596,
-31617,
-31639,
-31639,
-31634,
-31627,
-31594,
-31575,
-31526,
-31502,
-31459,
-31428,
-31406,
-31362,
-31365,
-31316,
-31307,
-31309,
-31312,
-31367,
-31382,
-31446,
-31457,
-31537,
-31587,
-31686,
-31784,
-31853,
-31946,
-31963,
-32019,
-32029,
-32041,
-32062,
-32051,
-32053,
-32033,
-32022,
-31997,
-32012,
-32019,
-32059,
-32109,
-32158,
-32229,
-32301,
-32408,
-32516,
-32637,
-32768,
-32888,
-32988,
-33084,
-33143,
-33217,
-33248,
-33289,
-33337,
-33342,
-33402,
-33409,
-33415,
-33428,
-33412,
-33426,
-33467,
-33489,
-33574,
-33603,
-33660,
-33694,
-33722,
-33774,
-33807,
-33843,
-33898,
-33911,
-33961,
-33993,
-34026,
-34039,
-34055,
-34014,
-34024,
-33949,
-33937,
-33856,
-33817,
-33752,
-33729,
-33686,
-33719,
-33661,
-33684,
-33606,
-33600,
-33569,
-33546,
-33563,
-33501,
-33490,
-33427,
-33368,
-33340,
-33281,
-33255,
-33197,
-33140,
-33084,
-33021,
-32969,
-32906,
-32846,
-32800,
-32725,
-32688,
-32597,
-32564,
-32495,
-32470,
-32421,
-32403,
-32370,
-32357,
-32311,
-32291,
-32249,
-32226,
-32218,
-32201,
-32210,
-32201,
-32202,
-32198,
-32180,
-32211,
-32165,
-32202,
-32162,
-32160,
-32175,
-32172,
-32236,
-32259,
-32292,
-32335,
-32325,
-32392,
-32378,
-32454,
-32458,
-32499,
-32496,
-32513,
-32523,
-32525,
-32552,
-32563,
-32591,
-32621,
-32652,
-32704,
-32773,
-32817,
-32885,
-32904,
-32921,
-32957,
-32958,
-33011,
-33019,
-33052,
-33045,
-33046,
-33021,
-33007,
-32992,
-32991,
-32976,
-32966,
-32953,
-32932,
-32955,
-32941,
-32984,
-32993,
-33024,
-33026,
-33048,
-33023,
-33027,
-32991,
-32967,
-32942,
-32925,
-32899,
-32892,
-32858,
-32814,
-32780,
-32705,
-32697,
-32647,
-32658,
-32642,
-32644,
-32612,
-32613,
-32559,
-32529,
-32508,
-32439,
-32430,
-32357,
-32331,
-32273,
-32225,
-32198,
-32142,
-32121,
-32073,
-32030,
-32004,
-31955,
-31947,
-31931,
-31939,
-31960,
-31999,
-32050,
-32081,
-32130,
-32154,
-32184,
-32247,
-32268,
-32344,
-32381,
-32409,
-32460,
-32455,
-32506,
-32498,
-32534,
-32527,
-32540,
-32526,
-32517,
-32548,
-32556,
-32656,
-32666,
-32770,
-32800,
-32861,
-32909,
-32968,
-33018,
-33117,
-33172,
-33301,
-33384,
-33516,
-33614,
-33697,
-33787,
-33855,
-33901,
-33973,
-34001,
-34072,
-34110,
-34152,
-34186,
-34200,
-34244,
-34249,
-34294,
-34317,
-34338,
-34365,
-34366,
-34357,
-34365,
-34359,
-34360,
-34362,
-34318,
-34288,
-34203,
-34127,
-34066,
-33944,
-33897,
-33774,
-33686,
-33601,
-33488,
-33430,
-33339,
-33277,
-33216,
-33153,
-33108,
-33071,
-33040,
-33013,
-32982,
-32959,
-32911,
-32875,
-32819,
-32765,
-32693,
-32599,
-32501,
-32392,
-32266,
-32155,
-32007,
-31898,
-31765,
-31647,
-31507,
-31398,
-31297,
-31219,
-31189,
-31141,
-31151,
-31150,
-31159,
-31190,
-31201,
-31238,
-31223,
-31248,
-31215,
-31225,
-31190,
-31190,
-31154,
-31141,
-31077,
-31042,
-30981,
-30922,
-30893,
-30833,
-30809,
-30788,
-30788,
-30821,
-30874,
-30952,
-31022,
-31122,
-31181,
-31279,
-31348,
-31456,
-31565,
-31671,
-31787,
-31867,
-31975,
-32056,
-32137,
-32227,
-32277,
-32346,
-32374,
-32430,
-32454,
-32515,
-32553,
-32610,
-32668,
-32710,
-32793,
-32851,
-32957,
-33057,
-33146,
-33247,
-33318,
-33385,
-33475,
-33523,
-33642,
-33699,
-33805,
-33873,
-33944,
-34008,
-34067,
-34111,
-34151,
-34188,
-34185,
-34209,
-34199,
-34199,
-34228,
-34218,
-34256,
-34244,
-34265,
-34258,
-34274,
-34292,
-34307,
-34328,
-34309,
-34307,
-34260,
-34251,
-34231,
-34223,
-34195,
-34160,
-34110,
-34052,
-34017,
-33973,
-33965,
-33923,
-33880,
-33828,
-33745,
-33723,
-33666,
-33655,
-33629,
-33607,
-33581,
-33550,
-33512,
-33483,
-33453,
-33439,
-33375,
-33342,
-33269,
-33198,
-33141,
-33048,
-33007,
-32904,
-32885,
-32802,
-32778,
-32711,
-32671,
-32641,
-32612,
-32622,
-32605,
-32608,
-32574,
-32568,
-32566,
-32591,
-32628,
-32654,
-32671,
-32661,
-32664,
-32669,
-32651,
-32643,
-32594,
-32558,
-32505,
-32483,
-32441,
-32400,
-32341,
-32268,
-32228,
-32178,
-32182,
-32150,
-32155,
-32137,
-32166,
-32226,
-32312,
-32391,
-32478,
-32522,
-32595,
-32649,
-32752,
-32817,
-32912,
-32963,
-33026,
-33077,
-33113,
-33148,
-33140,
-33134,
-33085,
-33041,
-33013,
-32969,
-32964,
-32955,
-32942,
-32961,
-32945,
-32947,
-32968,
-32973,
-33034,
-33084,
-33166,
-33232,
-33299,
-33350,
-33404,
-33448,
-33515,
-33549,
-33581,
-33594,
-33590,
-33582,
-33590,
-33575,
-33569,
-33519,
-33444,
-33367,
-33280,
-33216,
-33159,
-33094,
-33033,
-32937,
-32848,
-32795,
-32744,
-32726,
-32676,
-32636,
-32580,
-32576,
-32602,
-32638,
-32684,
-32679,
-32686,
-32648,
-32640,
-32606,
-32561,
-32480,
-32395,
-32325,
-32287,
-32280,
-32236,
-32202,
-32085,
-32006,
-31900,
-31846,
-31812,
-31777,
-31765,
-31709,
-31704,
-31677,
-31681,
-31691,
-31699,
-31711,
-31713,
-31753,
-31749,
-31819,
-31812,
-31870,
-31866,
-31897,
-31913,
-31945,
-31994,
-32044,
-32078,
-32125,
-32146,
-32153,
-32154,
-32145,
-32121,
-32143,
-32130,
-32202,
-32230,
-32292,
-32320,
-32363,
-32392,
-32437,
-32463,
-32508,
-32538,
-32585,
-32640,
-32717,
-32812,
-32870,
-32919,
-32919,
-32891,
-32898,
-32880,
-32913,
-32949,
-32990,
-33039,
-33071,
-33067,
-33060,
-33026,
-33045,
-33036,
-33087,
-33084,
-33104,
-33076,
-33058,
-33077,
-33081,
-33140,
-33139,
-33128,
-33111,
-33099,
-33111,
-33155,
-33164,
-33183,
-33152,
-33098,
-33080,
-33034,
-33028,
-32967,
-32927,
-32854,
-32810,
-32772,
-32722,
-32671,
-32593,
-32523,
-32462,
-32403,
-32396,
-32370,
-32412,
-32428,
-32468,
-32476,
-32462,
-32423,
-32374,
-32325,
-32334,
-32325,
-32338,
-32303,
-32276,
-32192,
-32158,
-32080,
-32060,
-31990,
-31954,
-31870,
-31803,
-31731,
-31675,
-31611,
-31592,
-31537,
-31551,
-31515,
-31541,
-31520,
-31521,
-31514,
-31500,
-31508,
-31488,
-31502,
-31493,
-31488,
-31485,
-31467,
-31474,
-31450,
-31439,
-31389,
-31343,
-31313,
-31287,
-31317,
-31320,
-31338,
-31350,
-31362,
-31394,
-31476,
-31540,
-31604,
-31641,
-31640,
-31669,
-31685,
-31753,
-31820,
-31901,
-31946,
-32004,
-32015,
-32052,
-32062,
-32101,
-32133,
-32207,
-32271,
-32338,
-32374,
-32372,
-32389,
-32426,
-32474,
-32570,
-32636,
-32700,
-32737,
-32799,
-32855,
-32912,
-32973,
-32989,
-33036,
-33059,
-33147,
-33220,
-33318,
-33366,
-33418,
-33433,
-33486,
-33518,
-33594,
-33606,
-33648,
-33676,
-33704,
-33789,
-33839,
-33906,
-33941,
-33979,
-33979,
-33996,
-33983,
-33987,
-33998,
-34005,
-34037,
-34059,
-34084,
-34094,
-34084,
-34070,
-34076,
-34069,
-34082,
-34099,
-34115,
-34156,
-34178,
-34205,
-34216,
-34202,
-34205,
-34206,
-34233,
-34241,
-34248,
-34203,
-34177,
-34121,
-34136,
-34126,
-34144,
-34142,
-34142,
-34131,
-34159,
-34179,
-34228,
-34222,
-34261,
-34234,
-34250,
-34228,
-34236,
-34203,
-34197,
-34167,
-34149,
-34160,
-34126,
-34129,
-34081,
-34057,
-34041,
-34000,
-34009,
-33954,
-33971,
-33910,
-33925,
-33854,
-33832,
-33729,
-33679,
-33591,
-33524,
-33495,
-33433,
-33416,
-33379,
-33356,
-33327,
-33284,
-33219,
-33157,
-33108,
-33107,
-33143,
-33171,
-33205,
-33157,
-33134,
-33068,
-33050,
-33029,
-33008,
-32946,
-32885,
-32828,
-32790,
-32774,
-32759,
-32743,
-32718,
-32703,
-32694,
-32691,
-32706,
-32678,
-32688,
-32696,
-32746,
-32755,
-32753,
-32690,
-32613,
-32593,
-32559,
-32608,
-32598,
-32598,
-32587,
-32570,
-32601,
-32641,
-32651,
-32654,
-32623,
-32645,
-32689,
-32763,
-32843,
-32854,
-32887,
-32879,
-32890,
-32912,
-32878,
-32839,
-32766,
-32727,
-32750,
-32779,
-32839,
-32809,
-32797,
-32732,
-32712,
-32722,
-32730,
-32760,
-32753,
-32787,
-32779,
-32846,
-32868,
-32910,
-32911,
-32919,
-32922,
-32940,
-32927,
-32930,
-32916,
-32932,
-32927,
-32910,
-32849,
-32756,
-32699,
-32652,
-32683,
-32691,
-32710,
-32662,
-32623,
-32562,
-32555,
-32529,
-32522,
-32467,
-32448,
-32462,
-32510,
-32589,
-32620,
-32596,
-32514,
-32449,
-32391,
-32401,
-32402,
-32450,
-32435,
-32500,
-32509,
-32552,
-32507,
-32454,
-32373,
-32348,
-32348,
-32403,
-32421,
-32410,
-32355,
-32308,
-32275,
-32257,
-32213,
-32139,
-32068,
-32018,
-32088,
-32163,
-32321,
-32395,
-32424,
-32393,
-32318,
-32293,
-32255,
-32304,
-32352,
-32457,
-32566,
-32670,
-32760,
-32760,
-32738,
-32647,
-32569,
-32516,
-32536,
-32628,
-32754,
-32874,
-32993,
-33009,
-33041,
-32965,
-32948,
-32883,
-32870,
-32872,
-32901,
-32984,
-33068,
-33153,
-33198,
-33169,
-33097,
-32974,
-32908,
-32872,
-32935,
-33011,
-33071,
-33092,
-33041,
-32966,
-32868,
-32788,
-32734,
-32667,
-32653,
-32642,
-32677,
-32732,
-32738,
-32738,
-32636,
-32512,
-32355,
-32233,
-32134,
-32098,
-32072,
-32037,
-31987,
-31882,
-31757,
-31596,
-31404,
-31228,
-31092,
-31019,
-31055,
-31109,
-31145,
-31100,
-30942,
-30776,
-30634,
-30555,
-30547,
-30530,
-30506,
-30451,
-30447,
-30400,
-30430,
-30339,
-30239,
-30139,
-30071,
-30144,
-30238,
-30337,
-30355,
-30310,
-30233,
-30168,
-30143,
-30128,
-30117,
-30101,
-30136,
-30207,
-30316,
-30418,
-30435,
-30437,
-30371,
-30359,
-30352,
-30429,
-30509,
-30658,
-30801,
-30982,
-31107,
-31213,
-31227,
-31235,
-31262,
-31330,
-31457,
-31624,
-31757,
-31905,
-32010,
-32128,
-32206,
-32254,
-32273,
-32316,
-32346,
-32470,
-32531,
-32645,
-32680,
-32753,
-32837,
-32948,
-33071,
-33142,
-33202,
-33256,
-33376,
-33512,
-33666,
-33732,
-33772,
-33793,
-33925,
-34132,
-34387,
-34532,
-34575,
-34469,
-34415,
-34369,
-34433,
-34478,
-34505,
-34507,
-34513,
-34578,
-34634,
-34665,
-34567,
-34481,
-34346,
-34377,
-34437,
-34588,
-34679,
-34754,
-34786,
-34826,
-34820,
-34804,
-34680,
-34548,
-34379,
-34337,
-34374,
-34536,
-34736,
-34849,
-34900,
-34752,
-34544,
-34303,
-34136,
-34102,
-34236,
-34390,
-34587,
-34600,
-34563,
-34406,
-34232,
-34098,
-33904,
-33792,
-33654,
-33654,
-33802,
-34032,
-34234,
-34293,
-34101,
-33808,
-33481,
-33262,
-33181,
-33194,
-33248,
-33360,
-33498,
-33639,
-33685,
-33552,
-33271,
-32959,
-32776,
-32807,
-32972,
-33165,
-33271,
-33288,
-33290,
-33257,
-33198,
-32993,
-32688,
-32380,
-32211,
-32325,
-32583,
-32923,
-33078,
-33105,
-32996,
-32902,
-32809,
-32766,
-32704,
-32721,
-32772,
-32926,
-33119,
-33220,
-33220,
-33097,
-32950,
-32879,
-32903,
-32993,
-33107,
-33211,
-33280,
-33283,
-33233,
-33077,
-32945,
-32837,
-32887,
-32992,
-33125,
-33166,
-33162,
-33127,
-33199,
-33297,
-33409,
-33328,
-33159,
-32918,
-32845,
-32940,
-33166,
-33318,
-33341,
-33194,
-33069,
-32951,
-32957,
-32905,
-32879,
-32855,
-32907,
-33090,
-33214,
-33224,
-33022,
-32676,
-32416,
-32303,
-32381,
-32528,
-32683,
-32799,
-32874,
-32903,
-32851,
-32731,
-32661,
-32816,
-33218,
-33742,
-33976,
-33685,
-32861,
-31846,
-31123,
-30912,
-31184,
-31631,
-32010,
-32329,
-32607,
-32979,
-33187,
-33127,
-32679,
-32084,
-31747,
-31842,
-32437,
-33100,
-33599,
-33614,
-33285,
-32665,
-31978,
-31367,
-31040,
-31213,
-32007,
-33297,
-34701,
-35737,
-36084,
-35704,
-34814,
-33652,
-32520,
-31533,
-31003,
-31064,
-31824,
-33057,
-34299,
-35097,
-35200,
-34730,
-34062,
-33406,
-33028,
-32751,
-32712,
-32943,
-33500,
-34392,
-35182,
-35584,
-35287,
-34466,
-33500,
-32785,
-32621,
-32885,
-33509,
-34185,
-34925,
-35606,
-36159,
-36386,
-36044,
-35100,
-33750,
-32469,
-31810,
-32027,
-33014,
-34286,
-35319,
-35816,
-35857,
-35558,
-35077,
-34327,
-33357,
-32390,
-31941,
-32277,
-33297,
-34347,
-34825,
-34472,
-33700,
-33081,
-32908,
-33018,
-32972,
-32608,
-32254,
-32336,
-33006,
-33833,
-34124,
-33554,
-32388,
-31438,
-31242,
-31795,
-32572,
-32842,
-32474,
-31716,
-31089,
-30966,
-31213,
-31544,
-31644,
-31449,
-31111,
-30791,
-30647,
-30587,
-30610,
-30564,
-30440,
-30256,
-30133,
-30174,
-30448,
-30748,
-30886,
-30521,
-29825,
-29074,
-28837,
-29283,
-30199,
-30909,
-30967,
-30346,
-29622,
-29362,
-29780,
-30392,
-30616,
-30109,
-29180,
-28504,
-28535,
-29218,
-30116,
-30681,
-30876,
-30832,
-30781,
-30737,
-30540,
-30233,
-29998,
-30189,
-30809,
-31537,
-31906,
-31634,
-30966,
-30355,
-30265,
-30617,
-31112,
-31304,
-31139,
-30872,
-30903,
-31392,
-32201,
-32855,
-33040,
-32637,
-31862,
-31146,
-30857,
-31130,
-31911,
-32796,
-33526,
-33727,
-33473,
-32970,
-32484,
-32334,
-32474,
-32800,
-33105,
-33295,
-33399,
-33480,
-33490,
-33397,
-33049,
-32650,
-32340,
-32469,
-32972,
-33703,
-34239,
-34366,
-34166,
-33778,
-33584,
-33505,
-33592,
-33655,
-33724,
-33810,
-33863,
-33878,
-33763,
-33741,
-33950,
-34535,
-35091,
-35157,
-34259,
-32634,
-30983,
-30231,
-30709,
-32203,
-33889,
-35153,
-35703,
-35524,
-34641,
-33066,
-31075,
-29474,
-29315,
-31064,
-34185,
-36990,
-37965,
-36571,
-33832,
-31441,
-30568,
-31116,
-32083,
-32553,
-32437,
-32428,
-33075,
-34297,
-35219,
-35064,
-33713,
-31946,
-30761,
-30721,
-31567,
-32559,
-33027,
-32850,
-32422,
-32291,
-32616,
-33215,
-33472,
-33102,
-32108,
-31036,
-30490,
-30792,
-31766,
-32935,
-33809,
-34207,
-34169,
-33790,
-33111,
-32078,
-30898,
-29940,
-29841,
-30792,
-32593,
-34455,
-35427,
-35053,
-33391,
-31252,
-29608,
-29234,
-30340,
-32348,
-34259,
-35045,
-34222,
-32250,
-30258,
-29540,
-30596,
-32937,
-35201,
-36223,
-35610,
-34083,
-32784,
-32517,
-33221,
-34150,
-34582,
-34213,
-33559,
-33066,
-33150,
-33583,
-33966,
-33990,
-33688,
-33303,
-33020,
-32911,
-32706,
-32405,
-32204,
-32447,
-33491,
-34956,
-35998,
-35731,
-33846,
-31334,
-29611,
-29988,
-32162,
-34831,
-36275,
-35863,
-34371,
-33141,
-32986,
-33532,
-33813,
-33380,
-32665,
-32644,
-33403,
-34329,
-34354,
-33468,
-32622,
-32923,
-34306,
-35397,
-34782,
-32551,
-30440,
-30599,
-33222,
-36482,
-37531,
-35332,
-31275,
-28489,
-28867,
-31970,
-35190,
-36257,
-34732,
-32239,
-30754,
-31087,
-32548,
-33878,
-34372,
-34212,
-33764,
-33278,
-32682,
-32222,
-32379,
-33414,
-34813,
-35366,
-34243,
-31980,
-30196,
-30512,
-32921,
-35669,
-36676,
-35246,
-32667,
-31283,
-32240,
-34755,
-36487,
-35752,
-32749,
-29608,
-28652,
-30744,
-34482,
-37490,
-37773,
-35350,
-31979,
-29947,
-30501,
-33069,
-35725,
-36771,
-35829,
-34032,
-32880,
-32962,
-33593,
-33731,
-33201,
-32836,
-33595,
-35217,
-36199,
-35264,
-32879,
-31086,
-31846,
-34639,
-37036,
-36552,
-33643,
-31295,
-32303,
-36241,
-39181,
-37573,
-31639,
-26283,
-26572,
-33214,
-41148,
-43752,
-38699,
-30177,
-25326,
-28060,
-35651,
-41379,
-40467,
-34176,
-28090,
-27189,
-31420,
-36585,
-38310,
-36003,
-32499,
-31204,
-32536,
-34509,
-34575,
-32704,
-30835,
-30935,
-33143,
-35404,
-35879,
-34299,
-32164,
-31317,
-32085,
-33419,
-33694,
-32439,
-30622,
-29879,
-31109,
-33643,
-35665,
-35574,
-33230,
-30272,
-28829,
-30013,
-32673,
-34488,
-33595,
-30591,
-27962,
-28093,
-31172,
-34567,
-35422,
-32820,
-28986,
-27155,
-28800,
-32290,
-34417,
-33396,
-30239,
-27852,
-27976,
-29979,
-31587,
-31458,
-30401,
-30307,
-31815,
-33479,
-32963,
-29921,
-26485,
-25838,
-28941,
-33615,
-36117,
-34505,
-30296,
-27046,
-27251,
-30152,
-32859,
-32896,
-30546,
-28158,
-27922,
-29869,
-32194,
-33072,
-32264,
-31104,
-30755,
-31243,
-31578,
-31091,
-30285,
-30223,
-31371,
-32736,
-33134,
-32014,
-30570,
-30271,
-31620,
-33424,
-33924,
-32563,
-30594,
-29898,
-31292,
-33492,
-34544,
-33474,
-31354,
-30249,
-31145,
-33225,
-34519,
-34012,
-32479,
-31588,
-32179,
-33361,
-33666,
-32577,
-31414,
-31851,
-34076,
-36353,
-36433,
-33926,
-30861,
-29981,
-32113,
-35356,
-36665,
-34782,
-31358,
-29546,
-31030,
-34560,
-37075,
-36509,
-33522,
-30831,
-30661,
-32782,
-35032,
-35126,
-32946,
-30478,
-30121,
-32695,
-36425,
-38512,
-36984,
-32653,
-28484,
-27580,
-30719,
-35500,
-38184,
-36582,
-32153,
-28771,
-29494,
-33674,
-37297,
-36696,
-31954,
-27374,
-27342,
-32428,
-38083,
-38914,
-33570,
-26388,
-23853,
-28500,
-36717,
-41591,
-39094,
-31517,
-25344,
-25455,
-31185,
-37190,
-38465,
-34555,
-29363,
-27457,
-30031,
-34455,
-36866,
-35636,
-32172,
-29318,
-28854,
-30420,
-32433,
-33624,
-33792,
-33449,
-33038,
-32572,
-31970,
-31307,
-30933,
-30949,
-31251,
-31500,
-31613,
-31905,
-32594,
-33705,
-34619,
-34631,
-33437,
-31441,
-29712,
-29340,
-30684,
-33177,
-35439,
-36214,
-35113,
-32940,
-31155,
-30771,
-31738,
-32913,
-33261,
-32626,
-31884,
-32066,
-33163,
-34225,
-34123,
-32860,
-31615,
-31582,
-32744,
-33709,
-33093,
-31118,
-29683,
-30620,
-33852,
-36946,
-37202,
-34114,
-29993,
-28274,
-30347,
-34545,
-37399,
-36871,
-33891,
-31301,
-31264,
-33247,
-34915,
-34430,
-32128,
-30172,
-30272,
-32295,
-34405,
-35035,
-34090,
-32825,
-32307,
-32408,
-32301,
-31525,
-30870,
-31413,
-33395,
-35469,
-35899,
-34001,
-31019,
-29161,
-29684,
-32040,
-34180,
-34649,
-33367,
-31890,
-31596,
-32743,
-34170,
-34567,
-33431,
-31645,
-30434,
-30632,
-31968,
-33432,
-34136,
-33767,
-32690,
-31723,
-31398,
-31994,
-33175,
-34353,
-34784,
-34183,
-32914,
-31833,
-31920,
-33210,
-34908,
-35657,
-34702,
-32617,
-30861,
-30814,
-32482,
-34647,
-35681,
-35134,
-33770,
-33041,
-33514,
-34507,
-34749,
-33710,
-32224,
-31797,
-33248,
-35740,
-37511,
-37091,
-34717,
-31941,
-30732,
-31644,
-34069,
-36322,
-37253,
-36651,
-35137,
-33658,
-32871,
-32994,
-33890,
-34940,
-35589,
-35301,
-34306,
-33404,
-33535,
-34831,
-36405,
-36742,
-35107,
-32333,
-30464,
-31208,
-34471,
-38131,
-39636,
-37875,
-34017,
-30719,
-29833,
-31501,
-33888,
-35347,
-35177,
-34326,
-33912,
-34395,
-35192,
-35500,
-34841,
-33590,
-32179,
-31098,
-30565,
-31015,
-32705,
-35380,
-37731,
-38141,
-35839,
-32007,
-29058,
-28958,
-31429,
-34213,
-34863,
-33185,
-31076,
-31037,
-33327,
-35822,
-35760,
-32560,
-28648,
-27240,
-29642,
-33704,
-35955,
-34577,
-31107,
-28891,
-30024,
-33292,
-35584,
-34557,
-30984,
-27857,
-27714,
-30595,
-33995,
-35414,
-34179,
-31766,
-30218,
-30365,
-31425,
-32073,
-31765,
-30935,
-30611,
-31099,
-32042,
-32642,
-32546,
-31897,
-31353,
-31138,
-31294,
-31407,
-31347,
-31222,
-31401,
-32077,
-32969,
-33496,
-33063,
-31676,
-30091,
-29283,
-30019,
-31939,
-34004,
-34859,
-34023,
-32044,
-30331,
-30017,
-31330,
-33176,
-34196,
-33538,
-31669,
-30199,
-30381,
-32474,
-34972,
-35914,
-34292,
-30981,
-28368,
-28546,
-31689,
-35761,
-37913,
-36538,
-32489,
-28510,
-27147,
-29125,
-32830,
-35713,
-35998,
-33947,
-31238,
-29908,
-30596,
-32628,
-34293,
-34421,
-33032,
-31263,
-30636,
-31811,
-34107,
-35943,
-35673,
-33111,
-29625,
-27580,
-28720,
-32655,
-36966,
-38621,
-36293,
-31380,
-27312,
-26910,
-30380,
-35013,
-37517,
-36334,
-32947,
-30253,
-30252,
-32355,
-34396,
-34488,
-32827,
-31301,
-31523,
-33597,
-35807,
-36345,
-34852,
-32505,
-31175,
-31750,
-33491,
-34899,
-34730,
-33194,
-31518,
-31147,
-32386,
-34237,
-35247,
-34457,
-32652,
-31375,
-31893,
-33896,
-35601,
-35458,
-33362,
-31077,
-30520,
-32033,
-34092,
-34600,
-33173,
-31358,
-31391,
-33657,
-36349,
-36805,
-34302,
-30734,
-29082,
-30565,
-33657,
-35402,
-34488,
-32142,
-30976,
-32064,
-33938,
-34141,
-31907,
-29263,
-29017,
-32008,
-35834,
-37072,
-34555,
-30542,
-28679,
-30572,
-34043,
-35541,
-33322,
-29522,
-27788,
-30012,
-34199,
-36482,
-34847,
-30882,
-28455,
-29791,
-33537,
-36104,
-35004,
-31342,
-28433,
-28829,
-31935,
-34781,
-34868,
-32388,
-29691,
-29066,
-30601,
-32587,
-33219,
-32471,
-31596,
-31889,
-33132,
-34006,
-33525,
-31931,
-30665,
-30786,
-32100,
-33398,
-33530,
-32484,
-31247,
-30774,
-31329,
-32282,
-32982,
-33173,
-33021,
-32688,
-32112,
-31314,
-30776,
-31232,
-32890,
-34979,
-35868,
-34590,
-31648,
-29130,
-28897,
-31285,
-34414,
-35910,
-34694,
-31898,
-29891,
-30201,
-32386,
-34502,
-34927,
-33575,
-31906,
-31451,
-32468,
-33938,
-34429,
-33468,
-31740,
-30469,
-30534,
-31698,
-33250,
-34302,
-34426,
-33744,
-32562,
-31512,
-31001,
-31421,
-32538,
-33693,
-34091,
-33515,
-32511,
-32172,
-32921,
-34119,
-34411,
-32943,
-30453,
-28877,
-29728,
-32696,
-35618,
-36203,
-34074,
-31174,
-30001,
-31480,
-34077,
-35220,
-33762,
-30966,
-29362,
-30300,
-32882,
-34714,
-34477,
-32779,
-31645,
-32088,
-33374,
-33657,
-32176,
-30173,
-29833,
-32082,
-35555,
-37592,
-36581,
-33332,
-30389,
-29723,
-31371,
-33492,
-34382,
-33683,
-32567,
-32226,
-32842,
-33481,
-33306,
-32363,
-31683,
-32200,
-33831,
-35568,
-36137,
-35129,
-33114,
-31342,
-30676,
-31319,
-32594,
-33786,
-34308,
-34218,
-33788,
-33343,
-32941,
-32528,
-32239,
-32309,
-33147,
-34647,
-36072,
-36498,
-35285,
-32898,
-30623,
-29853,
-30997,
-33400,
-35453,
-36150,
-35230,
-33629,
-32385,
-32068,
-32482,
-32951,
-33107,
-33119,
-33586,
-34836,
-36351,
-37041,
-35836,
-32936,
-29832,
-28517,
-30048,
-33424,
-36296,
-36604,
-34230,
-31256,
-30133,
-31917,
-35196,
-37301,
-36527,
-33286,
-29967,
-28766,
-30308,
-33152,
-35315,
-35551,
-34247,
-32545,
-31532,
-31221,
-31146,
-30841,
-30489,
-30800,
-32144,
-34316,
-36165,
-36630,
-35147,
-32348,
-29584,
-28186,
-28744,
-30682,
-32808,
-33907,
-33666,
-32544,
-31634,
-31648,
-32447,
-33206,
-32928,
-31512,
-29805,
-29237,
-30581,
-33240,
-35564,
-35945,
-34095,
-31290,
-29326,
-29282,
-30726,
-32311,
-32945,
-32580,
-32016,
-31994,
-32530,
-33124,
-33306,
-33241,
-33179,
-33179,
-32735,
-31491,
-29871,
-29063,
-30127,
-32893,
-35801,
-36898,
-35372,
-32204,
-29499,
-28908,
-30563,
-33124,
-35056,
-35647,
-35343,
-35005,
-35012,
-34989,
-34246,
-32661,
-30954,
-30343,
-31572,
-34218,
-36768,
-37601,
-36120,
-33296,
-31023,
-30767,
-32542,
-34802,
-35874,
-35136,
-33523,
-32612,
-33180,
-34639,
-35566,
-35132,
-33708,
-32514,
-32382,
-33108,
-33743,
-33665,
-33247,
-33373,
-34511,
-36049,
-36693,
-35788,
-33621,
-31710,
-31060,
-31928,
-33288,
-34109,
-33883,
-33162,
-32679,
-32970,
-33759,
-34289,
-34090,
-32962,
-31533,
-30483,
-30501,
-31754,
-33819,
-35783,
-36562,
-35583,
-33051,
-30190,
-28375,
-28458,
-30107,
-32131,
-33335,
-33420,
-32858,
-32495,
-32441,
-32315,
-31631,
-30724,
-30466,
-31541,
-33447,
-34671,
-33947,
-31471,
-29085,
-28838,
-31259,
-34625,
-36319,
-34656,
-30563,
-26665,
-25668,
-28232,
-32805,
-36614,
-37756,
-35980,
-32772,
-29976,
-28760,
-29156,
-30342,
-31461,
-32101,
-32358,
-32618,
-32895,
-33039,
-32650,
-31729,
-30715,
-30258,
-30794,
-32139,
-33662,
-34604,
-34662,
-33859,
-32713,
-31546,
-30708,
-30435,
-30777,
-31788,
-32995,
-33981,
-34194,
-33730,
-32878,
-32213,
-32011,
-32099,
-32308,
-32464,
-32820,
-33615,
-34758,
-35721,
-35683,
-34261,
-31713,
-29204,
-27930,
-28747,
-31307,
-34463,
-36634,
-36917,
-35336,
-32966,
-31041,
-30393,
-30920,
-32036,
-33037,
-33675,
-33986,
-34055,
-33758,
-33022,
-31994,
-31211,
-31181,
-31851,
-32680,
-32909,
-32404,
-31743,
-31834,
-33002,
-34670,
-35596,
-34982,
-32955,
-30703,
-29445,
-29800,
-31373,
-33263,
-34529,
-34800,
-34004,
-32618,
-31141,
-30260,
-30376,
-31443,
-32876,
-33883,
-34111,
-33831,
-33721,
-34160,
-34632,
-34222,
-32339,
-29527,
-27501,
-27760,
-30718,
-34864,
-37943,
-38165,
-35551,
-31721,
-28907,
-28360,
-30069,
-32586,
-34661,
-35466,
-35301,
-34692,
-34139,
-33505,
-32526,
-31160,
-29930,
-29647,
-30841,
-33139,
-35478,
-36657,
-36160,
-34594,
-33032,
-32453,
-32904,
-33734,
-34164,
-33877,
-33184,
-32606,
-32481,
-32683,
-32987,
-33191,
-33406,
-33709,
-34123,
-34428,
-34455,
-34250,
-33907,
-33673,
-33532,
-33387,
-33173,
-32921,
-32764,
-32850,
-33072,
-33233,
-33107,
-32711,
-32281,
-32219,
-32719,
-33657,
-34577,
-34916,
-34476,
-33457,
-32549,
-32320,
-33016,
-34161,
-34898,
-34482,
-32767,
-30598,
-29129,
-29411,
-31363,
-33976,
-35697,
-35728,
-34295,
-32703,
-31968,
-32318,
-32840,
-32599,
-31488,
-30431,
-30575,
-32188,
-34191,
-35077,
-33994,
-31636,
-29581,
-29080,
-30270,
-32021,
-33299,
-33649,
-33523,
-33445,
-33447,
-33168,
-32236,
-31066,
-30223,
-30365,
-31194,
-32158,
-32562,
-32402,
-32050,
-31864,
-31897,
-31901,
-31817,
-31874,
-32272,
-32936,
-33307,
-33063,
-32263,
-31747,
-31987,
-32956,
-33628,
-33152,
-31507,
-29760,
-29252,
-30474,
-32664,
-34428,
-34828,
-34068,
-33106,
-32665,
-32740,
-32693,
-32094,
-31311,
-31081,
-31943,
-33607,
-35026,
-35301,
-34235,
-32548,
-31247,
-31043,
-31882,
-33091,
-34025,
-34148,
-33621,
-32762,
-32123,
-31992,
-32486,
-33252,
-33975,
-34352,
-34300,
-34101,
-33890,
-33834,
-33786,
-33596,
-33099,
-32614,
-32255,
-32551,
-33328,
-34369,
-35103,
-35007,
-34128,
-32836,
-31995,
-32117,
-33147,
-34354,
-34793,
-34102,
-32734,
-31826,
-32132,
-33485,
-34769,
-34707,
-33035,
-30683,
-29288,
-29954,
-32441,
-35357,
-37145,
-37095,
-35692,
-34029,
-32970,
-32580,
-32464,
-32083,
-31499,
-31076,
-31372,
-32402,
-33926,
-35047,
-35212,
-34032,
-31953,
-29952,
-29191,
-30380,
-33122,
-36169,
-37756,
-37086,
-34398,
-31355,
-29470,
-29615,
-31117,
-32703,
-33245,
-32629,
-31643,
-31312,
-31950,
-33106,
-33770,
-33302,
-31911,
-30440,
-29964,
-30780,
-32437,
-33790,
-33991,
-32893,
-31236,
-30058,
-29998,
-30931,
-32141,
-33016,
-33222,
-33129,
-32929,
-32801,
-32468,
-31865,
-31081,
-30604,
-30666,
-31321,
-32175,
-32902,
-33305,
-33366,
-32996,
-32197,
-31020,
-30025,
-29870,
-30906,
-32763,
-34378,
-34786,
-33824,
-32222,
-31086,
-31006,
-31714,
-32505,
-32824,
-32812,
-32859,
-33158,
-33362,
-32844,
-31546,
-29942,
-29217,
-29930,
-31973,
-34180,
-35378,
-34963,
-33363,
-31629,
-30731,
-30891,
-31633,
-32221,
-32302,
-32209,
-32507,
-33503,
-34755,
-35339,
-34526,
-32493,
-30188,
-28856,
-29040,
-30290,
-31657,
-32302,
-32348,
-32381,
-33031,
-34190,
-35058,
-34762,
-33123,
-30824,
-29196,
-29104,
-30681,
-33017,
-34905,
-35549,
-34886,
-33522,
-32201,
-31300,
-30759,
-30391,
-30247,
-30636,
-31967,
-34103,
-36308,
-37415,
-36626,
-34009,
-30705,
-28361,
-28040,
-29847,
-32549,
-34662,
-35179,
-34307,
-33093,
-32612,
-33178,
-34082,
-34466,
-33931,
-33070,
-32795,
-33648,
-35083,
-36072,
-35669,
-34019,
-32028,
-30924,
-31155,
-32427,
-33795,
-34588,
-34543,
-34024,
-33433,
-33182,
-33393,
-34056,
-35011,
-35952,
-36507,
-36382,
-35500,
-34144,
-32767,
-31866,
-31690,
-32212,
-33162,
-34097,
-34659,
-34604,
-34031,
-33322,
-32924,
-33242,
-34159,
-35221,
-35819,
-35549,
-34583,
-33475,
-32763,
-32627,
-32826,
-32939,
-32927,
-32954,
-33370,
-34046,
-34563,
-34467,
-33750,
-33074,
-33073,
-33961,
-35180,
-35807,
-35344,
-34076,
-32688,
-31923,
-31752,
-31801,
-31683,
-31439,
-31428,
-31967,
-32929,
-33886,
-34453,
-34549,
-34403,
-34304,
-34251,
-34107,
-33722,
-33115,
-32529,
-32132,
-31986,
-31999,
-32034,
-32090,
-32235,
-32424,
-32612,
-32554,
-32195,
-31685,
-31334,
-31580,
-32503,
-33845,
-34977,
-35215,
-34390,
-32774,
-31248,
-30387,
-30489,
-31098,
-31781,
-32330,
-32931,
-33831,
-34782,
-35223,
-34641,
-33285,
-32086,
-31947,
-32969,
-34226,
-34606,
-33699,
-32208,
-31226,
-31204,
-31661,
-31729,
-31207,
-30880,
-31623,
-33554,
-35397,
-35832,
-34520,
-32636,
-31860,
-32799,
-34466,
-35069,
-33767,
-31377,
-29705,
-30008,
-31807,
-33554,
-33882,
-32878,
-31693,
-31556,
-32566,
-33841,
-34349,
-33845,
-32922,
-32355,
-32397,
-32706,
-32772,
-32399,
-31778,
-31158,
-30675,
-30315,
-30332,
-31027,
-32614,
-34671,
-36227,
-36363,
-34793,
-32403,
-30433,
-30043,
-31134,
-32841,
-33831,
-33428,
-31929,
-30390,
-29878,
-30659,
-32120,
-33229,
-33290,
-32656,
-32160,
-32692,
-34035,
-35302,
-35360,
-34024,
-32142,
-30867,
-30832,
-31474,
-31924,
-31637,
-31075,
-31152,
-32053,
-33316,
-33772,
-33219,
-32207,
-32023,
-33078,
-34792,
-35805,
-35355,
-33808,
-32311,
-31716,
-31953,
-32170,
-31831,
-31091,
-30762,
-31353,
-32659,
-33814,
-34302,
-34107,
-33878,
-34041,
-34405,
-34466,
-33829,
-32769,
-31992,
-31926,
-32549,
-33189,
-33401,
-32983,
-32321,
-31689,
-31256,
-30960,
-30942,
-31481,
-32762,
-34562,
-36017,
-36437,
-35519,
-33870,
-32308,
-31441,
-31124,
-30894,
-30440,
-30016,
-30127,
-31055,
-32414,
-33427,
-33437,
-32493,
-31253,
-30530,
-30742,
-31630,
-32597,
-33100,
-32967,
-32506,
-31977,
-31556,
-31089,
-30380,
-29515,
-28822,
-28864,
-29821,
-31405,
-32837,
-33466,
-33069,
-32216,
-31639,
-31773,
-32466,
-32931,
-32623,
-31447,
-30036,
-29212,
-29437,
-30511,
-31731,
-32421,
-32237,
-31494,
-30665,
-30336,
-30612,
-31419,
-32363,
-33255,
-33924,
-34358,
-34502,
-34129,
-33144,
-31613,
-29970,
-28883,
-28950,
-30199,
-32167,
-33868,
-34550,
-34093,
-33056,
-32324,
-32413,
-33024,
-33449,
-33024,
-31875,
-30797,
-30653,
-31546,
-32889,
-33634,
-33394,
-32523,
-31893,
-32037,
-32699,
-33259,
-33176,
-32770,
-32722,
-33502,
-34811,
-35740,
-35400,
-33771,
-31559,
-29901,
-29450,
-30132,
-31342,
-32452,
-33137,
-33543,
-33841,
-34145,
-34352,
-34307,
-34040,
-33801,
-33853,
-34364,
-34983,
-35255,
-34631,
-33193,
-31404,
-30177,
-30126,
-31325,
-33169,
-34794,
-35527,
-35211,
-34275,
-33197,
-32492,
-32180,
-32234,
-32451,
-32855,
-33382,
-33990,
-34409,
-34301,
-33611,
-32410,
-31319,
-30780,
-31070,
-32109,
-33391,
-34583,
-35310,
-35548,
-35276,
-34564,
-33567,
-32482,
-31665,
-31204,
-31138,
-31170,
-31213,
-31243,
-31581,
-32330,
-33418,
-34304,
-34564,
-34042,
-33106,
-32439,
-32445,
-33117,
-33976,
-34396,
-34135,
-33302,
-32367,
-31740,
-31657,
-31973,
-32511,
-32913,
-33061,
-32881,
-32560,
-32334,
-32484,
-32998,
-33725,
-34308,
-34584,
-34551,
-34461,
-34374,
-34220,
-33666,
-32680,
-31536,
-30899,
-31259,
-32593,
-34289,
-35566,
-35981,
-35699,
-35161,
-34758,
-34419,
-33847,
-32912,
-31889,
-31298,
-31583,
-32556,
-33742,
-34425,
-34454,
-33924,
-33396,
-33183,
-33380,
-33837,
-34296,
-34571,
-34645,
-34462,
-34250,
-34095,
-34279,
-34645,
-35068,
-35018,
-34381,
-33255,
-32207,
-31736,
-32026,
-32785,
-33509,
-33889,
-33992,
-34018,
-34219,
-34352,
-34299,
-33867,
-33297,
-32913,
-32833,
-32980,
-33027,
-32923,
-32830,
-33012,
-33523,
-34042,
-34020,
-33305,
-32035,
-30930,
-30444,
-30856,
-31657,
-32433,
-32624,
-32300,
-31750,
-31403,
-31465,
-31809,
-32181,
-32226,
-31965,
-31492,
-31121,
-30944,
-31003,
-31105,
-31298,
-31550,
-32059,
-32713,
-33289,
-33555,
-33307,
-32757,
-32069,
-31445,
-30907,
-30457,
-30238,
-30497,
-31321,
-32378,
-33101,
-32944,
-31979,
-30860,
-30396,
-30991,
-32288,
-33501,
-34032,
-33871,
-33504,
-33448,
-33791,
-34096,
-33910,
-33041,
-31851,
-30888,
-30590,
-30986,
-31785,
-32614,
-33200,
-33482,
-33612,
-33652,
-33752,
-33865,
-33936,
-33882,
-33607,
-33240,
-32810,
-32635,
-32677,
-32997,
-33302,
-33421,
-33210,
-32836,
-32509,
-32583,
-33091,
-33976,
-34851,
-35428,
-35502,
-35052,
-34305,
-33451,
-32740,
-32313,
-32205,
-32383,
-32713,
-33037,
-33218,
-33192,
-32894,
-32446,
-31938,
-31731,
-32039,
-33059,
-34488,
-35787,
-36292,
-35674,
-34108,
-32358,
-31104,
-30745,
-31135,
-31749,
-32329,
-32724,
-33141,
-33531,
-33693,
-33410,
-32609,
-31762,
-31311,
-31580,
-32391,
-33251,
-33752,
-33789,
-33458,
-32905,
-32153,
-31194,
-30334,
-29972,
-30508,
-31817,
-33270,
-34172,
-34169,
-33556,
-32940,
-32658,
-32675,
-32571,
-32162,
-31632,
-31377,
-31620,
-32085,
-32355,
-32195,
-31780,
-31521,
-31623,
-31929,
-32063,
-31936,
-31782,
-32059,
-32924,
-33941,
-34515,
-34151,
-33105,
-31953,
-31435,
-31703,
-32464,
-33099,
-33245,
-32909,
-32411,
-32131,
-32174,
-32461,
-32716,
-32756,
-32574,
-32290,
-32153,
-32302,
-32787,
-33435,
-34017,
-34234,
-33955,
-33246,
-32295,
-31515,
-31161,
-31459,
-32210,
-33171,
-33801,
-33908,
-33381,
-32568,
-31807,
-31435,
-31512,
-31866,
-32301,
-32670,
-32909,
-33071,
-33060,
-32883,
-32404,
-31776,
-31128,
-30750,
-30818,
-31383,
-32443,
-33640,
-34650,
-34954,
-34363,
-33069,
-31634,
-30855,
-31034,
-31995,
-32966,
-33251,
-32709,
-31753,
-31111,
-31080,
-31524,
-31866,
-31816,
-31477,
-31390,
-31900,
-32975,
-34062,
-34625,
-34398,
-33611,
-32668,
-31951,
-31498,
-31220,
-30998,
-30889,
-31041,
-31522,
-32245,
-32900,
-33238,
-33104,
-32678,
-32273,
-32167,
-32449,
-32870,
-33201,
-33222,
-33008,
-32791,
-32657,
-32647,
-32591,
-32397,
-32187,
-32052,
-32154,
-32361,
-32604,
-32733,
-32888,
-33142,
-33509,
-33855,
-33919,
-33677,
-33260,
-32883,
-32716,
-32643,
-32528,
-32300,
-32096,
-32161,
-32625,
-33320,
-34065,
-34453,
-34565,
-34449,
-34380,
-34409,
-34422,
-34240,
-33754,
-33077,
-32460,
-32221,
-32402,
-32881,
-33287,
-33439,
-33250,
-33000,
-32912,
-33055,
-33355,
-33581,
-33708,
-33888,
-34210,
-34664,
-34977,
-34812,
-34211,
-33387,
-32907,
-32947,
-33427,
-33845,
-33789,
-33199,
-32418,
-31921,
-31989,
-32563,
-33255,
-33756,
-33921,
-33832,
-33721,
-33648,
-33552,
-33319,
-32815,
-32230,
-31771,
-31740,
-32129,
-32751,
-33280,
-33446,
-33255,
-32862,
-32523,
-32277,
-32186,
-32125,
-32106,
-32193,
-32282,
-32417,
-32399,
-32281,
-32098,
-31953,
-31804,
-31606,
-31249,
-30886,
-30709,
-30980,
-31673,
-32541,
-33208,
-33400,
-33190,
-32848,
-32653,
-32680,
-32778,
-32663,
-32265,
-31648,
-31109,
-30925,
-31154,
-31656,
-32153,
-32342,
-32253,
-31954,
-31812,
-31946,
-32416,
-33018,
-33501,
-33699,
-33557,
-33197,
-32779,
-32453,
-32279,
-32216,
-32227,
-32185,
-32110,
-31992,
-31926,
-31945,
-32113,
-32419,
-32857,
-33280,
-33637,
-33732,
-33611,
-33290,
-32915,
-32610,
-32387,
-32256,
-32176,
-32219,
-32393,
-32746,
-33100,
-33272,
-33182,
-32901,
-32748,
-32917,
-33415,
-33988,
-34258,
-34045,
-33451,
-32776,
-32353,
-32181,
-32203,
-32156,
-32062,
-31982,
-32163,
-32602,
-33276,
-33883,
-34256,
-34305,
-34067,
-33729,
-33364,
-33167,
-33155,
-33300,
-33479,
-33449,
-33182,
-32649,
-32109,
-31767,
-31729,
-31952,
-32244,
-32544,
-32809,
-33165,
-33530,
-33902,
-34041,
-33899,
-33586,
-33182,
-32932,
-32783,
-32688,
-32525,
-32331,
-32201,
-32310,
-32710,
-33201,
-33534,
-33441,
-32961,
-32405,
-32190,
-32507,
-33197,
-33762,
-33744,
-33147,
-32254,
-31684,
-31581,
-31909,
-32217,
-32311,
-32207,
-32257,
-32663,
-33335,
-34010,
-34375,
-34413,
-34277,
-34138,
-33973,
-33698,
-33166,
-32568,
-32095,
-32053,
-32361,
-32836,
-33054,
-32944,
-32514,
-32185,
-32194,
-32658,
-33365,
-33939,
-34171,
-34035,
-33798,
-33720,
-33748,
-33805,
-33499,
-32964,
-32328,
-32032,
-32179,
-32652,
-33127,
-33354,
-33366,
-33345,
-33399,
-33505,
-33486,
-33266,
-33012,
-32906,
-33120,
-33455,
-33689,
-33539,
-33121,
-32616,
-32333,
-32333,
-32495,
-32639,
-32725,
-32801,
-33068,
-33527,
-34047,
-34382,
-34282,
-33768,
-33082,
-32521,
-32362,
-32490,
-32704,
-32696,
-32424,
-32096,
-31909,
-32079,
-32409,
-32738,
-32868,
-32892,
-32950,
-33138,
-33363,
-33433,
-33246,
-32908,
-32627,
-32512,
-32557,
-32495,
-32317,
-31987,
-31790,
-31817,
-32048,
-32307,
-32465,
-32467,
-32518,
-32582,
-32769,
-32850,
-32787,
-32589,
-32356,
-32239,
-32216,
-32184,
-32038,
-31755,
-31480,
-31396,
-31573,
-31964,
-32335,
-32509,
-32419,
-32202,
-32035,
-32092,
-32284,
-32451,
-32402,
-32073,
-31631,
-31323,
-31253,
-31462,
-31712,
-31788,
-31699,
-31458,
-31340,
-31453,
-31764,
-32154,
-32411,
-32431,
-32305,
-32042,
-31877,
-31704,
-31605,
-31473,
-31378,
-31387,
-31517,
-31760,
-31914,
-31840,
-31532,
-31105,
-30882,
-31044,
-31653,
-32484,
-33258,
-33638,
-33526,
-33010,
-32261,
-31670,
-31382,
-31579,
-32119,
-32733,
-33193,
-33205,
-32938,
-32522,
-32240,
-32222,
-32353,
-32500,
-32543,
-32571,
-32645,
-32879,
-33120,
-33250,
-33190,
-32956,
-32802,
-32763,
-32917,
-33083,
-33198,
-33259,
-33295,
-33375,
-33379,
-33306,
-33130,
-33012,
-33137,
-33473,
-33934,
-34187,
-34068,
-33636,
-33121,
-32844,
-32985,
-33422,
-33923,
-34219,
-34175,
-33955,
-33694,
-33675,
-33741,
-33860,
-33794,
-33546,
-33349,
-33307,
-33559,
-33859,
-34026,
-33891,
-33590,
-33301,
-33179,
-33183,
-33195,
-33113,
-33072,
-33176,
-33487,
-33828,
-33947,
-33737,
-33332,
-33054,
-33096,
-33448,
-33812,
-34005,
-33853,
-33583,
-33308,
-33212,
-33202,
-33201,
-33151,
-33117,
-33167,
-33351,
-33597,
-33740,
-33788,
-33617,
-33455,
-33285,
-33265,
-33322,
-33446,
-33567,
-33664,
-33737,
-33743,
-33731,
-33609,
-33463,
-33240,
-33058,
-32926,
-33031,
-33251,
-33681,
-33996,
-34154,
-34020,
-33684,
-33376,
-33229,
-33381,
-33695,
-34022,
-34167,
-34110,
-33922,
-33755,
-33751,
-33836,
-33959,
-33939,
-33852,
-33762,
-33847,
-34139,
-34419,
-34520,
-34271,
-33852,
-33564,
-33699,
-34148,
-34614,
-34732,
-34374,
-33907,
-33628,
-33808,
-34194,
-34393,
-34228,
-33699,
-33309,
-33241,
-33596,
-34003,
-34256,
-34163,
-33986,
-33823,
-33842,
-33819,
-33695,
-33332,
-32938,
-32672,
-32672,
-32910,
-33224,
-33415,
-33416,
-33228,
-32938,
-32723,
-32582,
-32638,
-32751,
-32930,
-32981,
-32948,
-32754,
-32482,
-32160,
-31848,
-31549,
-31324,
-31127,
-31047,
-30980,
-31060,
-31135,
-31263,
-31345,
-31303,
-31214,
-31034,
-30958,
-30950,
-31008,
-31032,
-30863,
-30622,
-30259,
-30072,
-29984,
-30088,
-30139,
-30184,
-30100,
-30022,
-29995,
-29971,
-29985,
-29914,
-29859,
-29753,
-29668,
-29507,
-29282,
-28956,
-28680,
-28490,
-28492,
-28550,
-28616,
-28565,
-28469,
-28389,
-28460,
-28627,
-28907,
-29140,
-29321,
-29392,
-29304,
-29048,
-28604,
-28084,
-27661,
-27440,
-27486,
-27601,
-27692,
-27608,
-27418,
-27243,
-27151,
-27161,
-27236,
-27305,
-27452,
-27628,
-27794,
-27871,
-27734,
-27609,
-27662,
-28197,
-29143,
-30202,
-31023,
-31313,
-31166,
-30857,
-30589,
-30487,
-30415,
-30169,
-29786,
-29335,
-29062,
-29053,
-29284,
-29549,
-29752,
-29840,
-29917,
-30103,
-30502,
-31055,
-31650,
-32235,
-32717,
-33274,
-33773,
-34310,
-34588,
-34617,
-34318,
-33895,
-33595,
-33549,
-33760,
-34141,
-34505,
-34864,
-35190,
-35457,
-35637,
-35662,
-35607,
-35588,
-35744,
-36084,
-36433,
-36655,
-36685,
-36697,
-36923,
-37442,
-38125,
-38734,
-39037,
-39067,
-38949,
-38850,
-38901,
-38971,
-39125,
-39268,
-39522,
-39831,
-40156,
-40272,
-40072,
-39575,
-38951,
-38459,
-38298,
-38523,
-38980,
-39546,
-40037,
-40463,
-40826,
-41169,
-41396,
-41408,
-41220,
-40907,
-40727,
-40740,
-40897,
-40899,
-40547,
-39928,
-39303,
-39000,
-39081,
-39228,
-39184,
-38784,
-38256,
-37995,
-38108,
-38486,
-38769,
-38740,
-38545,
-38423,
-38567,
-38853,
-38930,
-38553,
-37800,
-36933,
-36382,
-36160,
-36198,
-36164,
-35941,
-35538,
-35132,
-34826,
-34650,
-34467,
-34214,
-33857,
-33515,
-33292,
-33245,
-33368,
-33497,
-33507,
-33327,
-32937,
-32540,
-32255,
-32273,
-32526,
-32860,
-33042,
-32924,
-32555,
-32130,
-31805,
-31684,
-31594,
-31474,
-31169,
-30819,
-30454,
-30179,
-29901,
-29615,
-29351,
-29306,
-29544,
-30089,
-30588,
-30881,
-30774,
-30544,
-30391,
-30539,
-30847,
-31056,
-31023,
-30714,
-30408,
-30208,
-30217,
-30222,
-30161,
-29959,
-29783,
-29708,
-29762,
-29864,
-29906,
-29870,
-29876,
-29971,
-30248,
-30557,
-30725,
-30728,
-30459,
-30203,
-30005,
-29979,
-30075,
-30151,
-30107,
-30016,
-29892,
-29933,
-30064,
-30207,
-30265,
-30208,
-30195,
-30322,
-30578,
-30833,
-30868,
-30634,
-30243,
-29961,
-29886,
-30028,
-30132,
-30055,
-29768,
-29421,
-29200,
-29140,
-29201,
-29183,
-29096,
-28885,
-28773,
-28797,
-28963,
-29172,
-29234,
-29081,
-28762,
-28359,
-28090,
-27851,
-27711,
-27489,
-27259,
-27086,
-27103,
-27286,
-27545,
-27636,
-27495,
-27122,
-26678,
-26312,
-25997,
-25696,
-25271,
-24802,
-24421,
-24373,
-24815,
-25640,
-26693,
-27656,
-28339,
-28731,
-28884,
-28987,
-29036,
-29052,
-28872,
-28474,
-27882,
-27168,
-26468,
-25829,
-25378,
-25156,
-25338,
-25833,
-26573,
-27254,
-27675,
-27801,
-27773,
-27935,
-28394,
-29199,
-30063,
-30803,
-31226,
-31335,
-31160,
-30767,
-30214,
-29728,
-29431,
-29681,
-30408,
-31582,
-32732,
-33643,
-34035,
-34050,
-33804,
-33568,
-33487,
-33547,
-33804,
-34098,
-34428,
-34700,
-34934,
-35198,
-35537,
-36035,
-36559,
-37122,
-37530,
-37866,
-38166,
-38572,
-39108,
-39740,
-40295,
-40655,
-40771,
-40631,
-40355,
-39922,
-39479,
-38965,
-38605,
-38418,
-38594,
-39039,
-39733,
-40463,
-41103,
-41625,
-41997,
-42334,
-42627,
-42830,
-42872,
-42692,
-42378,
-41977,
-41661,
-41408,
-41152,
-40851,
-40466,
-40108,
-39878,
-39734,
-39667,
-39511,
-39335,
-39213,
-39305,
-39551,
-39872,
-39934,
-39722,
-39223,
-38730,
-38383,
-38254,
-38156,
-37911,
-37457,
-36867,
-36413,
-36241,
-36377,
-36601,
-36675,
-36395,
-35830,
-35219,
-34673,
-34359,
-34003,
-33557,
-32943,
-32293,
-31886,
-31716,
-31754,
-31751,
-31633,
-31485,
-31455,
-31650,
-31940,
-32122,
-31993,
-31596,
-31160,
-30839,
-30763,
-30723,
-30603,
-30268,
-29816,
-29406,
-29175,
-29126,
-29148,
-29160,
-29104,
-29113,
-29295,
-29682,
-30157,
-30490,
-30512,
-30237,
-29857,
-29582,
-29559,
-29659,
-29759,
-29703,
-29587,
-29571,
-29815,
-30304,
-30829,
-31202,
-31262,
-31145,
-31027,
-31062,
-31295,
-31536,
-31617,
-31409,
-31057,
-30746,
-30708,
-30966,
-31405,
-31801,
-32064,
-32228,
-32376,
-32727,
-33096,
-33506,
-33702,
-33760,
-33688,
-33657,
-33663,
-33745,
-33853,
-33985,
-34148,
-34318,
-34438,
-34444,
-34400,
-34352,
-34477,
-34725,
-35034,
-35244,
-35263,
-35206,
-35193,
-35328,
-35564,
-35739,
-35721,
-35466,
-35132,
-34794,
-34586,
-34498,
-34481,
-34522,
-34606,
-34746,
-34903,
-35082,
-35164,
-35226,
-35175,
-35148,
-35033,
-34904,
-34641,
-34302,
-33868,
-33453,
-33121,
-32962,
-32940,
-33037,
-33134,
-33237,
-33286,
-33337,
-33290,
-33137,
-32821,
-32512,
-32308,
-32351,
-32538,
-32625,
-32465,
-31954,
-31318,
-30750,
-30406,
-30163,
-29941,
-29576,
-29314,
-29222,
-29479,
-29852,
-30186,
-30170,
-29934,
-29523,
-29171,
-28820,
-28458,
-27943,
-27435,
-26962,
-26722,
-26597,
-26537,
-26362,
-26139,
-25926,
-25842,
-25854,
-25770,
-25490,
-24872,
-24090,
-23363,
-22811,
-22702,
-22871,
-23391,
-24054,
-24809,
-25569,
-26270,
-26870,
-27254,
-27408,
-27205,
-26774,
-26131,
-25559,
-25136,
-24956,
-24897,
-24788,
-24527,
-24165,
-23847,
-23835,
-24078,
-24568,
-25012,
-25358,
-25614,
-25982,
-26547,
-27404,
-28255,
-29017,
-29407,
-29538,
-29439,
-29290,
-29159,
-29096,
-29104,
-29277,
-29668,
-30359,
-31272,
-32200,
-32977,
-33302,
-33313,
-33021,
-32777,
-32705,
-32895,
-33296,
-33804,
-34405,
-35089,
-35870,
-36743,
-37506,
-38114,
-38414,
-38500,
-38495,
-38574,
-38838,
-39329,
-39993,
-40680,
-41363,
-41851,
-42143,
-42161,
-41889,
-41445,
-40915,
-40558,
-40456,
-40689,
-41138,
-41730,
-42325,
-42960,
-43547,
-44126,
-44521,
-44755,
-44758,
-44722,
-44710,
-44768,
-44768,
-44596,
-44183,
-43691,
-43205,
-42922,
-42704,
-42475,
-42093,
-41550,
-40997,
-40527,
-40208,
-40040,
-39948,
-40010,
-40135,
-40401,
-40573,
-40636,
-40413,
-39990,
-39458,
-38894,
-38364,
-37793,
-37172,
-36509,
-35860,
-35276,
-34748,
-34281,
-33813,
-33378,
-32953,
-32581,
-32174,
-31785,
-31316,
-30966,
-30621,
-30440,
-30209,
-29945,
-29650,
-29363,
-29230,
-29171,
-29132,
-28940,
-28590,
-28208,
-27863,
-27660,
-27456,
-27180,
-26840,
-26535,
-26399,
-26440,
-26354,
-26067,
-25389,
-24687,
-24129,
-23997,
-24132,
-24387,
-24567,
-24778,
-25171,
-25887,
-26779,
-27602,
-28122,
-28279,
-28257,
-28211,
-28242,
-28268,
-28213,
-28063,
-27937,
-27934,
-28115,
-28346,
-28511,
-28499,
-28386,
-28384,
-28654,
-29277,
-30169,
-31020,
-31804,
-32387,
-32970,
-33625,
-34293,
-34850,
-35063,
-35007,
-34825,
-34801,
-34967,
-35230,
-35306,
-35198,
-35017,
-35060,
-35521,
-36221,
-36981,
-37496,
-37816,
-38039,
-38366,
-38748,
-39091,
-39234,
-39186,
-39139,
-39177,
-39444,
-39734,
-40008,
-40137,
-40134,
-40174,
-40210,
-40359,
-40422,
-40490,
-40452,
-40417,
-40380,
-40268,
-40100,
-39755,
-39292,
-38852,
-38501,
-38402,
-38407,
-38471,
-38359,
-38085,
-37743,
-37472,
-37394,
-37476,
-37558,
-37548,
-37331,
-36958,
-36466,
-35847,
-35191,
-34463,
-33755,
-33160,
-32603,
-32132,
-31625,
-31116,
-30725,
-30474,
-30430,
-30434,
-30315,
-30040,
-29563,
-29157,
-28835,
-28639,
-28452,
-28116,
-27587,
-26962,
-26342,
-25907,
-25637,
-25494,
-25340,
-25050,
-24626,
-24041,
-23463,
-22968,
-22705,
-22668,
-22711,
-22767,
-22570,
-22225,
-21758,
-21309,
-20986,
-20713,
-20451,
-20158,
-19813,
-19567,
-19435,
-19466,
-19631,
-19868,
-20210,
-20602,
-21089,
-21550,
-22035,
-22453,
-22891,
-23327,
-23769,
-24095,
-24212,
-23986,
-23525,
-22919,
-22401,
-22146,
-22185,
-22501,
-22986,
-23544,
-24141,
-24734,
-25346,
-25882,
-26372,
-26757,
-27132,
-27574,
-28144,
-28783,
-29444,
-29902,
-30218,
-30357,
-30501,
-30696,
-30993,
-31340,
-31752,
-32246,
-32891,
-33691,
-34535,
-35307,
-35879,
-36247,
-36491,
-36640,
-36751,
-36792,
-36861,
-36971,
-37310,
-37833,
-38540,
-39230,
-39833,
-40246,
-40647,
-41020,
-41499,
-42004,
-42450,
-42823,
-43068,
-43278,
-43455,
-43641,
-43815,
-43931,
-43979,
-43898,
-43724,
-43472,
-43232,
-43071,
-43123,
-43324,
-43752,
-44198,
-44646,
-45011,
-45222,
-45369,
-45382,
-45337,
-45165,
-44933,
-44575,
-44177,
-43724,
-43276,
-42830,
-42415,
-42009,
-41593,
-41227,
-40864,
-40574,
-40339,
-40162,
-39989,
-39806,
-39573,
-39284,
-39016,
-38696,
-38441,
-38156,
-37825,
-37430,
-36895,
-36336,
-35744,
-35219,
-34807,
-34393,
-34029,
-33508,
-32962,
-32356,
-31839,
-31465,
-31267,
-31148,
-31025,
-30764,
-30366,
-29848,
-29322,
-28872,
-28524,
-28330,
-28194,
-28156,
-28125,
-28158,
-28159,
-28140,
-28042,
-27846,
-27620,
-27391,
-27217,
-27077,
-26943,
-26781,
-26557,
-26342,
-26104,
-25928,
-25728,
-25532,
-25325,
-25145,
-25114,
-25293,
-25753,
-26423,
-27187,
-27872,
-28344,
-28622,
-28749,
-28926,
-29225,
-29692,
-30159,
-30450,
-30447,
-30117,
-29721,
-29437,
-29572,
-30103,
-30954,
-31778,
-32388,
-32633,
-32595,
-32498,
-32498,
-32782,
-33265,
-33899,
-34495,
-35009,
-35390,
-35749,
-36116,
-36493,
-36855,
-37093,
-37229,
-37272,
-37413,
-37627,
-38031,
-38382,
-38689,
-38769,
-38782,
-38738,
-38747,
-38821,
-38842,
-38825,
-38747,
-38767,
-38912,
-39317,
-39797,
-40339,
-40714,
-40952,
-40987,
-40936,
-40839,
-40755,
-40688,
-40621,
-40464,
-40196,
-39820,
-39402,
-39084,
-38906,
-38853,
-38843,
-38683,
-38376,
-37872,
-37419,
-37158,
-37204,
-37469,
-37774,
-37794,
-37500,
-36830,
-36140,
-35476,
-35080,
-34727,
-34329,
-33745,
-32990,
-32332,
-31846,
-31676,
-31624,
-31530,
-31194,
-30625,
-29927,
-29298,
-28850,
-28597,
-28405,
-28163,
-27753,
-27237,
-26683,
-26228,
-25953,
-25743,
-25568,
-25247,
-24834,
-24346,
-23968,
-23704,
-23597,
-23514,
-23354,
-23072,
-22681,
-22255,
-21855,
-21482,
-21127,
-20742,
-20355,
-20017,
-19781,
-19719,
-19761,
-19882,
-19917,
-19829,
-19566,
-19205,
-18815,
-18536,
-18388,
-18430,
-18599,
-18835,
-19130,
-19432,
-19898,
-20474,
-21292,
-22202,
-23122,
-23833,
-24229,
-24201,
-23845,
-23259,
-22694,
-22311,
-22255,
-22469,
-22828,
-23144,
-23336,
-23391,
-23524,
-23833,
-24424,
-25213,
-26034,
-26821,
-27539,
-28253,
-28949,
-29639,
-30137,
-30499,
-30670,
-30823,
-30985,
-31126,
-31281,
-31383,
-31625,
-32022,
-32706,
-33500,
-34297,
-34874,
-35240,
-35450,
-35606,
-35838,
-36093,
-36406,
-36753,
-37123,
-37571,
-38040,
-38497,
-38878,
-39210,
-39495,
-39876,
-40346,
-40960,
-41585,
-42149,
-42579,
-42877,
-43090,
-43293,
-43431,
-43524,
-43428,
-43228,
-42911,
-42634,
-42397,
-42256,
-42172,
-42235,
-42501,
-43047,
-43821,
-44627,
-45289,
-45623,
-45725,
-45650,
-45538,
-45365,
-45062,
-44530,
-43853,
-43058,
-42391,
-41837,
-41448,
-41136,
-40847,
-40595,
-40394,
-40283,
-40285,
-40344,
-40428,
-40506,
-40483,
-40405,
-40140,
-39778,
-39261,
-38694,
-38068,
-37487,
-36918,
-36382,
-35894,
-35351,
-34874,
-34415,
-34074,
-33888,
-33805,
-33812,
-33766,
-33633,
-33352,
-32966,
-32511,
-32057,
-31577,
-31143,
-30667,
-30226,
-29849,
-29577,
-29513,
-29616,
-29874,
-30217,
-30512,
-30717,
-30762,
-30639,
-30429,
-30100,
-29807,
-29487,
-29230,
-28949,
-28646,
-28232,
-27759,
-27208,
-26795,
-26573,
-26714,
-27149,
-27778,
-28477,
-29139,
-29778,
-30397,
-30973,
-31422,
-31668,
-31692,
-31617,
-31552,
-31609,
-31717,
-31743,
-31635,
-31329,
-31083,
-31004,
-31287,
-31874,
-32633,
-33395,
-33956,
-34299,
-34427,
-34424,
-34453,
-34494,
-34649,
-34848,
-35017,
-35192,
-35295,
-35443,
-35677,
-36044,
-36522,
-37101,
-37620,
-38081,
-38355,
-38504,
-38513,
-38497,
-38448,
-38430,
-38393,
-38322,
-38193,
-37954,
-37654,
-37345,
-37143,
-37183,
-37482,
-38038,
-38695,
-39292,
-39667,
-39755,
-39639,
-39399,
-39221,
-39100,
-39037,
-38862,
-38549,
-37980,
-37359,
-36778,
-36396,
-36311,
-36407,
-36579,
-36666,
-36599,
-36393,
-36084,
-35793,
-35511,
-35384,
-35271,
-35214,
-35013,
-34618,
-33974,
-33222,
-32515,
-32008,
-31654,
-31322,
-30914,
-30390,
-29958,
-29738,
-29759,
-29896,
-29837,
-29534,
-28967,
-28379,
-27841,
-27365,
-26769,
-26069,
-25261,
-24649,
-24297,
-24246,
-24325,
-24317,
-24174,
-23930,
-23719,
-23638,
-23586,
-23565,
-23371,
-23060,
-22637,
-22199,
-21794,
-21451,
-21105,
-20754,
-20406,
-20078,
-19801,
-19640,
-19535,
-19529,
-19580,
-19679,
-19786,
-19837,
-19749,
-19508,
-19185,
-18890,
-18781,
-18901,
-19143,
-19462,
-19774,
-20138,
-20725,
-21567,
-22644,
-23817,
-24804,
-25515,
-25821,
-25811,
-25560,
-25168,
-24740,
-24307,
-23974,
-23756,
-23721,
-23848,
-24189,
-24677,
-25329,
-26071,
-26903,
-27754,
-28611,
-29432,
-30239,
-30982,
-31675,
-32258,
-32730,
-33065,
-33272,
-33401,
-33482,
-33609,
-33777,
-34039,
-34371,
-34778,
-35227,
-35737,
-36291,
-36859,
-37463,
-37952,
-38385,
-38653,
-38886,
-39130,
-39458,
-39880,
-40280,
-40629,
-40865,
-41078,
-41322,
-41703,
-42175,
-42713,
-43241,
-43796,
-44281,
-44771,
-45022,
-45144,
-44970,
-44754,
-44458,
-44269,
-44030,
-43772,
-43416,
-43095,
-42955,
-43104,
-43527,
-44114,
-44629,
-45028,
-45214,
-45332,
-45383,
-45440,
-45427,
-45311,
-45057,
-44630,
-44098,
-43444,
-42721,
-41912,
-41081,
-40348,
-39801,
-39521,
-39440,
-39427,
-39340,
-39158,
-38906,
-38736,
-38693,
-38676,
-38606,
-38324,
-37841,
-37234,
-36538,
-35818,
-35057,
-34320,
-33686,
-33254,
-33000,
-32834,
-32602,
-32222,
-31777,
-31344,
-31044,
-30837,
-30617,
-30329,
-29926,
-29532,
-29161,
-28862,
-28597,
-28317,
-28050,
-27859,
-27777,
-27856,
-27989,
-28122,
-28214,
-28229,
-28270,
-28283,
-28354,
-28287,
-28138,
-27790,
-27336,
-26892,
-26503,
-26251,
-26063,
-25894,
-25706,
-25552,
-25562,
-25759,
-26270,
-26917,
-27672,
-28376,
-28971,
-29516,
-29955,
-30364,
-30629,
-30746,
-30731,
-30650,
-30652,
-30761,
-31026,
-31226,
-31344,
-31257,
-31090,
-30981,
-31075,
-31391,
-31898,
-32393,
-32864,
-33223,
-33612,
-34029,
-34572,
-35119,
-35564,
-35862,
-35988,
-36071,
-36216,
-36466,
-36841,
-37219,
-37611,
-37909,
-38182,
-38376,
-38510,
-38471,
-38355,
-38117,
-38004,
-38005,
-38202,
-38444,
-38602,
-38516,
-38310,
-38046,
-37998,
-38240,
-38633,
-39123,
-39380,
-39510,
-39488,
-39549,
-39678,
-39831,
-39853,
-39637,
-39273,
-38810,
-38372,
-37938,
-37473,
-36996,
-36631,
-36436,
-36519,
-36681,
-36802,
-36661,
-36366,
-35940,
-35712,
-35563,
-35561,
-35438,
-35168,
-34709,
-34150,
-33632,
-33150,
-32725,
-32275,
-31779,
-31255,
-30767,
-30354,
-30054,
-29817,
-29585,
-29353,
-29103,
-28824,
-28518,
-28052,
-27470,
-26747,
-26095,
-25525,
-25201,
-24928,
-24717,
-24458,
-24225,
-24152,
-24223,
-24419,
-24501,
-24374,
-23975,
-23417,
-22861,
-22424,
-22100,
-21825,
-21496,
-21095,
-20687,
-20347,
-20172,
-20108,
-20147,
-20176,
-20164,
-20131,
-20072,
-20059,
-20025,
-19952,
-19807,
-19612,
-19424,
-19265,
-19171,
-19156,
-19242,
-19519,
-20013,
-20809,
-21814,
-22950,
-24058,
-25001,
-25690,
-26062,
-26071,
-25792,
-25292,
-24730,
-24268,
-23951,
-23833,
-23852,
-24029,
-24369,
-24927,
-25631,
-26478,
-27330,
-28172,
-28943,
-29762,
-30529,
-31274,
-31866,
-32245,
-32472,
-32539,
-32606,
-32654,
-32763,
-32923,
-33239,
-33649,
-34295,
-34963,
-35711,
-36438,
-37147,
-37857,
-38488,
-38925,
-39132,
-39139,
-39065,
-39141,
-39373,
-39760,
-40139,
-40414,
-40600,
-40812,
-41181,
-41694,
-42372,
-42991,
-43638,
-44141,
-44701,
-45201,
-45687,
-46016,
-46182,
-46044,
-45708,
-45164,
-44568,
-44015,
-43648,
-43494,
-43584,
-43819,
-44159,
-44521,
-44979,
-45432,
-45979,
-46391,
-46688,
-46664,
-46419,
-45955,
-45397,
-44821,
-44250,
-43687,
-43070,
-42427,
-41776,
-41176,
-40718,
-40344,
-40125,
-39942,
-39813,
-39690,
-39587,
-39523,
-39459,
-39339,
-39137,
-38759,
-38214,
-37513,
-36702,
-35855,
-35052,
-34361,
-33812,
-33433,
-33146,
-32963,
-32776,
-32596,
-32381,
-32106,
-31787,
-31411,
-31024,
-30646,
-30283,
-29885,
-29444,
-28889,
-28328,
-27841,
-27506,
-27423,
-27464,
-27617,
-27755,
-27935,
-28070,
-28222,
-28223,
-28094,
-27849,
-27598,
-27492,
-27439,
-27430,
-27192,
-26735,
-26173,
-25639,
-25335,
-25204,
-25209,
-25274,
-25444,
-25742,
-26244,
-26762,
-27298,
-27708,
-28156,
-28685,
-29326,
-29888,
-30190,
-30095,
-29768,
-29489,
-29517,
-29927,
-30543,
-31015,
-31240,
-31120,
-30998,
-31062,
-31457,
-32161,
-32875,
-33391,
-33594,
-33570,
-33557,
-33752,
-34241,
-34892,
-35521,
-35923,
-36034,
-36071,
-36083,
-36358,
-36693,
-37091,
-37370,
-37561,
-37826,
-38169,
-38670,
-39064,
-39274,
-39218,
-39082,
-39019,
-39132,
-39257,
-39255,
-38998,
-38614,
-38346,
-38341,
-38585,
-38912,
-39186,
-39349,
-39510,
-39668,
-39825,
-39823,
-39643,
-39327,
-39025,
-38863,
-38744,
-38610,
-38308,
-37885,
-37466,
-37131,
-36950,
-36789,
-36632,
-36355,
-36081,
-35809,
-35574,
-35394,
-35200,
-35065,
-34908,
-34738,
-34398,
-33927,
-33302,
-32687,
-32162,
-31773,
-31370,
-30927,
-30290,
-29681,
-29156,
-28934,
-28904,
-28933,
-28796,
-28373,
-27771,
-27099,
-26596,
-26279,
-26058,
-25832,
-25437,
-24965,
-24467,
-24092,
-23886,
-23749,
-23624,
-23415,
-23208,
-23035,
-22958,
-22900,
-22716,
-22396,
-21908,
-21449,
-21107,
-20926,
-20876,
-20830,
-20777,
-20609,
-20351,
-19939,
-19447,
-18973,
-18715,
-18759,
-19070,
-19388,
-19500,
-19265,
-18858,
-18468,
-18358,
-18567,
-19019,
-19541,
-20157,
-20797,
-21726,
-22809,
-24046,
-25157,
-25955,
-26314,
-26256,
-25893,
-25422,
-24904,
-24491,
-24140,
-23942,
-23847,
-23946,
-24211,
-24651,
-25239,
-25924,
-26686,
-27515,
-28379,
-29261,
-30089,
-30832,
-31420,
-31920,
-32307,
-32657,
-32969,
-33249,
-33511,
-33725,
-33972,
-34283,
-34655,
-35163,
-35679,
-36259,
-36779,
-37314,
-37797,
-38190,
-38512,
-38705,
-38836,
-39015,
-39245,
-39644,
-40027,
-40461,
-40794,
-41196,
-41640,
-42264,
-42943,
-43653,
-44200,
-44615,
-44879,
-45126,
-45395,
-45686,
-45941,
-46073,
-46012,
-45777,
-45383,
-44966,
-44536,
-44218,
-44001,
-43961,
-44097,
-44454,
-44935,
-45506,
-46011,
-46412,
-46606,
-46659,
-46534,
-46310,
-45971,
-45566,
-45069,
-44543,
-43941,
-43265,
-42543,
-41743,
-41058,
-40449,
-40046,
-39801,
-39614,
-39467,
-39323,
-39134,
-38996,
-38833,
-38654,
-38416,
-38093,
-37658,
-37184,
-36608,
-36055,
-35444,
-34854,
-34258,
-33691,
-33156,
-32678,
-32218,
-31857,
-31489,
-31221,
-30951,
-30695,
-30447,
-30109,
-29746,
-29258,
-28719,
-28170,
-27701,
-27378,
-27276,
-27282,
-27415,
-27466,
-27556,
-27571,
-27684,
-27827,
-27964,
-28044,
-27915,
-27661,
-27305,
-26952,
-26723,
-26540,
-26398,
-26200,
-25921,
-25615,
-25356,
-25241,
-25261,
-25438,
-25692,
-26109,
-26604,
-27280,
-27953,
-28549,
-28990,
-29221,
-29480,
-29792,
-30218,
-30622,
-30836,
-30846,
-30732,
-30711,
-30882,
-31253,
-31628,
-31913,
-32073,
-32231,
-32540,
-33066,
-33681,
-34367,
-34863,
-35278,
-35585,
-35835,
-36185,
-36525,
-36996,
-37465,
-37934,
-38310,
-38575,
-38765,
-38922,
-39118,
-39307,
-39457,
-39493,
-39473,
-39495,
-39689,
-40049,
-40459,
-40808,
-40916,
-40892,
-40742,
-40668,
-40594,
-40611,
-40547,
-40554,
-40576,
-40749,
-41030,
-41330,
-41550,
-41579,
-41422,
-41134,
-40777,
-40396,
-40008,
-39615,
-39251,
-38928,
-38679,
-38492,
-38321,
-38121,
-37838,
-37517,
-37209,
-36952,
-36741,
-36504,
-36212,
-35800,
-35443,
-35108,
-34949,
-34805,
-34578,
-34145,
-33488,
-32694,
-31890,
-31167,
-30555,
-30045,
-29569,
-29120,
-28703,
-28344,
-28000,
-27698,
-27361,
-26971,
-26517,
-25946,
-25384,
-24817,
-24391,
-24051,
-23798,
-23547,
-23212,
-22838,
-22467,
-22196,
-22022,
-21908,
-21719,
-21493,
-21183,
-20891,
-20650,
-20383,
-20133,
-19802,
-19527,
-19318,
-19189,
-19088,
-18867,
-18599,
-18259,
-18036,
-17941,
-17934,
-17934,
-17849,
-17733,
-17663,
-17639,
-17607,
-17463,
-17118,
-16729,
-16411,
-16434,
-16860,
-17646,
-18693,
-19848,
-21045,
-22283,
-23499,
-24610,
-25495,
-25961,
-26020,
-25659,
-25128,
-24536,
-24091,
-23758,
-23610,
-23522,
-23621,
-23865,
-24388,
-25121,
-26014,
-26975,
-27880,
-28769,
-29619,
-30501,
-31384,
-32191,
-32881,
-33357,
-33667,
-33878,
-34031,
-34227,
-34456,
-34740,
-35052,
-35470,
-35986,
-36689,
-37508,
-38407,
-39200,
-39769,
-40100,
-40187,
-40261,
-40387,
-40671,
-41063,
-41506,
-41895,
-42291,
-42642,
-43055,
-43450,
-43850,
-44224,
-44634,
-45095,
-45661,
-46241,
-46757,
-47194,
-47465,
-47626,
-47670,
-47545,
-47244,
-46705,
-46030,
-45325,
-44770,
-44450,
-44397,
-44563,
-44844,
-45191,
-45527,
-45814,
-46071,
-46194,
-46221,
-46059,
-45792,
-45415,
-44983,
-44507,
-43930,
-43283,
-42528,
-41718,
-40943,
-40194,
-39556,
-38974,
-38485,
-38123,
-37862,
-37712,
-37615,
-37473,
-37275,
-37040,
-36739,
-36427,
-36031,
-35501,
-34890,
-34185,
-33536,
-32919,
-32373,
-31782,
-31195,
-30587,
-30150,
-29837,
-29760,
-29703,
-29627,
-29394,
-29004,
-28513,
-28012,
-27514,
-27101,
-26678,
-26337,
-25988,
-25759,
-25613,
-25651,
-25764,
-26017,
-26211,
-26438,
-26542,
-26672,
-26776,
-26963,
-27178,
-27371,
-27511,
-27446,
-27309,
-26995,
-26641,
-26245,
-25848,
-25508,
-25262,
-25184,
-25269,
-25546,
-25963,
-26493,
-27151,
-27872,
-28667,
-29414,
-30092,
-30584,
-30939,
-31163,
-31400,
-31666,
-32023,
-32372,
-32677,
-32855,
-32947,
-33044,
-33237,
-33620,
-34096,
-34619,
-34963,
-35177,
-35183,
-35233,
-35390,
-35826,
-36503,
-37333,
-38135,
-38782,
-39182,
-39399,
-39521,
-39679,
-39930,
-40302,
-40668,
-41018,
-41210,
-41338,
-41377,
-41456,
-41502,
-41582,
-41556,
-41480,
-41284,
-41020,
-40663,
-40330,
-39977,
-39782,
-39717,
-39870,
-40181,
-40592,
-41026,
-41346,
-41587,
-41638,
-41635,
-41499,
-41320,
-41017,
-40637,
-40111,
-39509,
-38858,
-38229,
-37679,
-37203,
-36806,
-36461,
-36173,
-35840,
-35580,
-35263,
-35070,
-34944,
-34929,
-34936,
-34921,
-34738,
-34460,
-34046,
-33599,
-33148,
-32641,
-32052,
-31425,
-30730,
-30138,
-29609,
-29200,
-28832,
-28506,
-28191,
-27941,
-27682,
-27389,
-26980,
-26439,
-25854,
-25273,
-24800,
-24408,
-24058,
-23707,
-23413,
-23170,
-23120,
-23186,
-23341,
-23499,
-23588,
-23652,
-23612,
-23575,
-23458,
-23316,
-23106,
-22893,
-22587,
-22273,
-21804,
-21290,
-20708,
-20169,
-19783,
-19581,
-19602,
-19758,
-20017,
-20263,
-20477,
-20641,
-20715,
-20774,
-20716,
-20634,
-20455,
-20205,
-19877,
-19502,
-19098,
-18834,
-18772,
-19102,
-19925,
-21174,
-22802,
-24474,
-26039,
-27232,
-28031,
-28370,
-28396,
-28071,
-27613,
-26949,
-26257,
-25552,
-24961,
-24563,
-24441,
-24622,
-25082,
-25733,
-26480,
-27240,
-28002,
-28796,
-29679,
-30658,
-31710,
-32688,
-33516,
-34055,
-34283,
-34201,
-33899,
-33507,
-33228,
-33150,
-33438,
-33978,
-34758,
-35546,
-36308,
-36935,
-37450,
-37898,
-38232,
-38539,
-38788,
-39095,
-39482,
-39940,
-40431,
-40800,
-41087,
-41200,
-41276,
-41303,
-41293,
-41296,
-41309,
-41442,
-41824,
-42418,
-43216,
-44010,
-44691,
-45184,
-45471,
-45567,
-45437,
-45077,
-44471,
-43713,
-42950,
-42269,
-41860,
-41600,
-41594,
-41724,
-41949,
-42262,
-42518,
-42704,
-42805,
-42801,
-42819,
-42815,
-42811,
-42771,
-42554,
-42262,
-41732,
-41133,
-40326,
-39499,
-38519,
-37612,
-36749,
-36046,
-35545,
-35151,
-34917,
-34768,
-34705,
-34834,
-35005,
-35300,
-35514,
-35591,
-35422,
-35013,
-34404,
-33668,
-32928,
-32124,
-31402,
-30660,
-30048,
-29516,
-29091,
-28741,
-28433,
-28136,
-27941,
-27761,
-27722,
-27581,
-27446,
-27171,
-26896,
-26700,
-26620,
-26630,
-26682,
-26635,
-26564,
-26436,
-26361,
-26353,
-26389,
-26461,
-26618,
-26830,
-27217,
-27654,
-28149,
-28545,
-28809,
-28861,
-28704,
-28299,
-27762,
-27080,
-26467,
-25951,
-25673,
-25597,
-25795,
-26207,
-26894,
-27801,
-28855,
-29895,
-30821,
-31531,
-32086,
-32578,
-33028,
-33494,
-33835,
-34046,
-34076,
-34046,
-34008,
-34093,
-34274,
-34536,
-34834,
-35082,
-35380,
-35652,
-36031,
-36529,
-37149,
-37878,
-38583,
-39176,
-39578,
-39888,
-40183,
-40571,
-40986,
-41338,
-41520,
-41515,
-41536,
-41652,
-42090,
-42615,
-43173,
-43500,
-43632,
-43609,
-43503,
-43333,
-43033,
-42561,
-42011,
-41454,
-41060,
-40838,
-40784,
-40822,
-40929,
-41122,
-41371,
-41621,
-41832,
-41843,
-41763,
-41542,
-41322,
-41086,
-40873,
-40666,
-40459,
-40233,
-39935,
-39508,
-38904,
-38154,
-37338,
-36550,
-35880,
-35323,
-34858,
-34491,
-34217,
-34100,
-34082,
-34120,
-34070,
-33907,
-33603,
-33223,
-32828,
-32376,
-31902,
-31325,
-30724,
-30118,
-29543,
-29031,
-28495,
-27978,
-27433,
-26976,
-26592,
-26337,
-26098,
-25841,
-25492,
-25069,
-24683,
-24366,
-24195,
-24079,
-23931,
-23669,
-23268,
-22824,
-22429,
-22118,
-21889,
-21684,
-21519,
-21426,
-21462,
-21636,
-21856,
-22022,
-22076,
-22030,
-21993,
-21969,
-21952,
-21828,
-21543,
-21137,
-20681,
-20319,
-20050,
-19880,
-19782,
-19780,
-19895,
-20159,
-20513,
-20857,
-21077,
-21151,
-21079,
-20907,
-20708,
-20440,
-20149,
-19809,
-19453,
-19187,
-19085,
-19343,
-20090,
-21366,
-23147,
-25176,
-27124,
-28724,
-29782,
-30340,
-30530,
-30481,
-30284,
-29921,
-29356,
-28623,
-27858,
-27160,
-26737,
-26549,
-26638,
-26886,
-27270,
-27784,
-28436,
-29279,
-30320,
-31531,
-32855,
-34137,
-35255,
-36093,
-36545,
-36682,
-36513,
-36177,
-35825,
-35571,
-35570,
-35896,
-36509,
-37311,
-38101,
-38728,
-39136,
-39396,
-39610,
-39864,
-40168,
-40444,
-40677,
-40874,
-41093,
-41398,
-41735,
-42052,
-42235,
-42273,
-42182,
-42017,
-41878,
-41831,
-41940,
-42323,
-42914,
-43773,
-44633,
-45406,
-45857,
-45945,
-45682,
-45136,
-44383,
-43542,
-42597,
-41758,
-40978,
-40468,
-40161,
-40143,
-40289,
-40591,
-40964,
-41291,
-41630,
-41849,
-42063,
-42217,
-42339,
-42376,
-42270,
-41987,
-41527,
-40921,
-40235,
-39438,
-38573,
-37587,
-36590,
-35618,
-34917,
-34404,
-34226,
-34145,
-34180,
-34219,
-34328,
-34559,
-34917,
-35320,
-35591,
-35593,
-35194,
-34510,
-33648,
-32787,
-32037,
-31361,
-30757,
-30127,
-29569,
-29044,
-28763,
-28595,
-28619,
-28663,
-28676,
-28613,
-28454,
-28231,
-28005,
-27787,
-27643,
-27600,
-27578,
-27604,
-27555,
-27443,
-27271,
-27097,
-27007,
-27046,
-27226,
-27489,
-27768,
-28085,
-28391,
-28802,
-29191,
-29517,
-29605,
-29396,
-28868,
-28190,
-27510,
-26942,
-26553,
-26283,
-26185,
-26285,
-26694,
-27329,
-28227,
-29111,
-29970,
-30740,
-31442,
-32207,
-32890,
-33528,
-33938,
-34147,
-34199,
-34139,
-34084,
-33957,
-33828,
-33613,
-33434,
-33339,
-33436,
-33732,
-34185,
-34702,
-35276,
-35867,
-36587,
-37385,
-38262,
-39017,
-39580,
-39811,
-39838,
-39733,
-39630,
-39555,
-39476,
-39404,
-39357,
-39458,
-39710,
-40150,
-40610,
-41017,
-41227,
-41312,
-41225,
-41070,
-40813,
-40472,
-40058,
-39604,
-39197,
-38875,
-38708,
-38636,
-38670,
-38732,
-38810,
-38874,
-38949,
-38995,
-39085,
-39106,
-39143,
-39044,
-38916,
-38655,
-38367,
-37946,
-37445,
-36788,
-36042,
-35210,
-34443,
-33730,
-33211,
-32794,
-32530,
-32348,
-32262,
-32314,
-32430,
-32593,
-32728,
-32747,
-32649,
-32427,
-32121,
-31719,
-31267,
-30748,
-30224,
-29716,
-29232,
-28751,
-28292,
-27791,
-27367,
-27023,
-26768,
-26643,
-26520,
-26443,
-26305,
-26223,
-26081,
-26032,
-25905,
-25813,
-25665,
-25494,
-25280,
-25005,
-24675,
-24312,
-23992,
-23800,
-23732,
-23824,
-23937,
-24073,
-24173,
-24261,
-24373,
-24455,
-24547,
-24565,
-24518,
-24421,
-24263,
-24078,
-23859,
-23643,
-23423,
-23273,
-23177,
-23149,
-23199,
-23274,
-23455,
-23663,
-23966,
-24221,
-24400,
-24412,
-24214,
-23891,
-23454,
-23009,
-22595,
-22165,
-21801,
-21479,
-21382,
-21622,
-22335,
-23605,
-25232,
-27138,
-28850,
-30343,
-31352,
-32004,
-32340,
-32439,
-32246,
-31759,
-30857,
-29752,
-28540,
-27575,
-26883,
-26576,
-26440,
-26458,
-26530,
-26771,
-27196,
-27944,
-28841,
-29923,
-30958,
-32002,
-32970,
-33883,
-34655,
-35214,
-35469,
-35469,
-35250,
-35085,
-34980,
-35177,
-35458,
-35877,
-36181,
-36449,
-36585,
-36750,
-36866,
-37047,
-37177,
-37345,
-37525,
-37721,
-38000,
-38271,
-38527,
-38696,
-38771,
-38704,
-38614,
-38459,
-38399,
-38464,
-38737,
-39376,
-40255,
-41409,
-42539,
-43451,
-43937,
-43979,
-43664,
-43116,
-42483,
-41675,
-40805,
-39783,
-38845,
-38095,
-37693,
-37629,
-37765,
-38034,
-38304,
-38663,
-39148,
-39785,
-40547,
-41288,
-41941,
-42383,
-42581,
-42540,
-42236,
-41757,
-41109,
-40344,
-39452,
-38496,
-37458,
-36480,
-35628,
-35015,
-34639,
-34511,
-34509,
-34675,
-34981,
-35458,
-36046,
-36591,
-36954,
-36993,
-36732,
-36206,
-35563,
-34819,
-34040,
-33244,
-32489,
-31867,
-31438,
-31210,
-31173,
-31219,
-31380,
-31533,
-31652,
-31681,
-31529,
-31274,
-30938,
-30619,
-30398,
-30175,
-29956,
-29639,
-29269,
-28943,
-28667,
-28613,
-28633,
-28845,
-29134,
-29547,
-30067,
-30642,
-31241,
-31759,
-32144,
-32330,
-32293,
-32019,
-31515,
-30877,
-30132,
-29469,
-28855,
-28404,
-28117,
-28039,
-28230,
-28682,
-29422,
-30272,
-31198,
-32028,
-32811,
-33472,
-34064,
-34531,
-34834,
-35027,
-35086,
-35144,
-35154,
-35151,
-35072,
-34928,
-34770,
-34618,
-34552,
-34514,
-34467,
-34510,
-34626,
-35029,
-35658,
-36447,
-37237,
-37842,
-38210,
-38410,
-38501,
-38624,
-38728,
-38803,
-38791,
-38685,
-38540,
-38491,
-38524,
-38741,
-38979,
-39233,
-39423,
-39489,
-39543,
-39467,
-39410,
-39191,
-38910,
-38515,
-38095,
-37692,
-37348,
-37068,
-36812,
-36616,
-36394,
-36313,
-36261,
-36352,
-36495,
-36672,
-36835,
-36902,
-36878,
-36749,
-36518,
-36248,
-35885,
-35435,
-34830,
-34134,
-33342,
-32652,
-32076,
-31670,
-31378,
-31110,
-30853,
-30640,
-30502,
-30487,
-30481,
-30492,
-30345,
-30186,
-29967,
-29823,
-29675,
-29503,
-29273,
-28952,
-28682,
-28449,
-28284,
-28135,
-27918,
-27637,
-27285,
-26984,
-26723,
-26580,
-26455,
-26367,
-26226,
-26084,
-25940,
-25825,
-25799,
-25796,
-25900,
-26052,
-26231,
-26469,
-26631,
-26751,
-26739,
-26611,
-26389,
-26146,
-25910,
-25766,
-25667,
-25627,
-25585,
-25569,
-25571,
-25644,
-25803,
-26019,
-26277,
-26508,
-26728,
-26891,
-27070,
-27203,
-27300,
-27371,
-27310,
-27292,
-27202,
-27162,
-27099,
-26996,
-26850,
-26686,
-26553,
-26481,
-26488,
-26440,
-26302,
-26027,
-25590,
-25114,
-24604,
-24131,
-23677,
-23267,
-22970,
-22941,
-23337,
-24260,
-25684,
-27419,
-29178,
-30768,
-31953,
-32815,
-33311,
-33536,
-33460,
-33003,
-32242,
-31119,
-29901,
-28705,
-27715,
-27031,
-26569,
-26308,
-26166,
-26130,
-26273,
-26613,
-27210,
-28021,
-29016,
-30122,
-31276,
-32366,
-33319,
-34037,
-34482,
-34709,
-34809,
-34911,
-35110,
-35396,
-35787,
-36115,
-36398,
-36522,
-36483,
-36380,
-36179,
-36049,
-35940,
-35928,
-35929,
-35964,
-36018,
-36069,
-36176,
-36250,
-36288,
-36287,
-36238,
-36256,
-36433,
-36787,
-37386,
-38169,
-39102,
-40191,
-41272,
-42278,
-42970,
-43297,
-43218,
-42877,
-42388,
-41883,
-41269,
-40595,
-39745,
-38912,
-38214,
-37777,
-37648,
-37665,
-37787,
-37893,
-38077,
-38430,
-39004,
-39801,
-40635,
-41368,
-41848,
-42072,
-42072,
-41937,
-41717,
-41447,
-41035,
-40514,
-39839,
-39107,
-38350,
-37639,
-36938,
-36317,
-35754,
-35300,
-35033,
-34945,
-35031,
-35232,
-35383,
-35487,
-35408,
-35222,
-34911,
-34575,
-34168,
-33813,
-33411,
-33072,
-32754,
-32519,
-32425,
-32395,
-32489,
-32519,
-32513,
-32351,
-32097,
-31717,
-31351,
-30952,
-30631,
-30301,
-29999,
-29655,
-29278,
-28882,
-28498,
-28221,
-28116,
-28169,
-28410,
-28707,
-29038,
-29343,
-29698,
-30089,
-30596,
-31082,
-31582,
-31851,
-32024,
-31938,
-31744,
-31430,
-31000,
-30547,
-30037,
-29596,
-29279,
-29148,
-29248,
-29565,
-30017,
-30568,
-31166,
-31770,
-32384,
-32981,
-33551,
-34062,
-34528,
-34932,
-35295,
-35591,
-35830,
-35970,
-35993,
-35999,
-35887,
-35815,
-35669,
-35593,
-35556,
-35714,
-36011,
-36430,
-36834,
-37090,
-37223,
-37303,
-37457,
-37791,
-38190,
-38566,
-38814,
-38880,
-38924,
-38984,
-39167,
-39455,
-39742,
-40002,
-40157,
-40291,
-40326,
-40366,
-40307,
-40178,
-39977,
-39690,
-39400,
-39056,
-38712,
-38318,
-37887,
-37404,
-36920,
-36432,
-36030,
-35682,
-35406,
-35188,
-34977,
-34877,
-34822,
-34931,
-35124,
-35333,
-35506,
-35517,
-35354,
-35116,
-34754,
-34416,
-34019,
-33527,
-32963,
-32258,
-31559,
-30844,
-30242,
-29677,
-29240,
-28800,
-28464,
-28186,
-27999,
-27899,
-27822,
-27812,
-27792,
-27863,
-27944,
-28104,
-28233,
-28313,
-28279,
-28186,
-28038,
-27930,
-27874,
-27818,
-27804,
-27655,
-27507,
-27283,
-27098,
-26958,
-26801,
-26719,
-26540,
-26462,
-26321,
-26327,
-26312,
-26385,
-26438,
-26468,
-26530,
-26561,
-26669,
-26791,
-26949,
-27079,
-27213,
-27297,
-27428,
-27538,
-27682,
-27815,
-27910,
-28001,
-28050,
-28108,
-28159,
-28231,
-28309,
-28420,
-28502,
-28535,
-28460,
-28289,
-28062,
-27876,
-27777,
-27775,
-27761,
-27709,
-27562,
-27444,
-27409,
-27529,
-27687,
-27795,
-27677,
-27340,
-26849,
-26314,
-25874,
-25466,
-25072,
-24605,
-24141,
-23785,
-23762,
-24204,
-25144,
-26491,
-27956,
-29405,
-30611,
-31604,
-32294,
-32806,
-33020,
-32966,
-32572,
-31915,
-31069,
-30296,
-29571,
-29055,
-28607,
-28207,
-27828,
-27491,
-27276,
-27251,
-27407,
-27775,
-28246,
-28904,
-29675,
-30557,
-31413,
-32138,
-32638,
-32969,
-33163,
-33387,
-33657,
-34018,
-34446,
-34907,
-35375,
-35775,
-36107,
-36246,
-36247,
-36080,
-35828,
-35616,
-35459,
-35384,
-35410,
-35446,
-35548,
-35607,
-35678,
-35704,
-35673,
-35630,
-35553,
-35543,
-35692,
-36013,
-36636,
-37454,
-38454,
-39489,
-40467,
-41294,
-41928,
-42336,
-42555,
-42606,
-42491,
-42220,
-41811,
-41242,
-40600,
-39929,
-39321,
-38863,
-38535,
-38351,
-38279,
-38281,
-38433,
-38665,
-38998,
-39371,
-39702,
-39993,
-40219,
-40461,
-40709,
-40989,
-41191,
-41276,
-41249,
-41038,
-40717,
-40244,
-39642,
-38936,
-38183,
-37468,
-36848,
-36392,
-36041,
-35853,
-35759,
-35780,
-35821,
-35839,
-35701,
-35418,
-34952,
-34401,
-33808,
-33288,
-32805,
-32429,
-32094,
-31853,
-31684,
-31621,
-31628,
-31653,
-31701,
-31675,
-31616,
-31475,
-31330,
-31153,
-31086,
-30977,
-30963,
-30806,
-30575,
-30158,
-29664,
-29116,
-28580,
-28130,
-27710,
-27431,
-27216,
-27204,
-27325,
-27634,
-28045,
-28519,
-29025,
-29511,
-29974,
-30380,
-30676,
-30874,
-30993,
-31033,
-31090,
-31099,
-31147,
-31136,
-31184,
-31166,
-31259,
-31297,
-31422,
-31560,
-31736,
-31993,
-32271,
-32600,
-32910,
-33208,
-33515,
-33825,
-34133,
-34418,
-34589,
-34686,
-34695,
-34633,
-34612,
-34620,
-34707,
-34894,
-35175,
-35548,
-35989,
-36376,
-36715,
-36885,
-37010,
-37068,
-37168,
-37306,
-37436,
-37573,
-37646,
-37705,
-37719,
-37739,
-37708,
-37642,
-37546,
-37392,
-37330,
-37275,
-37334,
-37345,
-37348,
-37259,
-37097,
-36948,
-36816,
-36743,
-36629,
-36458,
-36164,
-35820,
-35484,
-35195,
-34990,
-34799,
-34625,
-34435,
-34276,
-34146,
-34040,
-33922,
-33716,
-33507,
-33241,
-32997,
-32769,
-32480,
-32202,
-31862,
-31543,
-31265,
-31022,
-30824,
-30638,
-30452,
-30320,
-30227,
-30214,
-30238,
-30267,
-30273,
-30254,
-30202,
-30167,
-30092,
-30060,
-29991,
-29943,
-29881,
-29821,
-29745,
-29657,
-29541,
-29436,
-29293,
-29191,
-29077,
-29015,
-28932,
-28935,
-28956,
-29089,
-29270,
-29479,
-29626,
-29653,
-29528,
-29341,
-29099,
-28925,
-28767,
-28678,
-28633,
-28641,
-28706,
-28888,
-29039,
-29262,
-29342,
-29443,
-29419,
-29428,
-29387,
-29337,
-29259,
-29114,
-28961,
-28798,
-28621,
-28486,
-28306,
-28187,
-28025,
-27958,
-27843,
-27852,
-27808,
-27887,
-27960,
-28064,
-28173,
-28259,
-28339,
-28423,
-28485,
-28526,
-28498,
-28380,
-28166,
-27901,
-27643,
-27398,
-27199,
-26974,
-26634,
-26228,
-25673,
-25161,
-24643,
-24189,
-23716,
-23160,
-22605,
-22143,
-22062,
-22474,
-23484,
-24867,
-26424,
-27863,
-29079,
-30039,
-30843,
-31459,
-31927,
-32142,
-32125,
-31863,
-31452,
-30958,
-30478,
-30078,
-29782,
-29583,
-29387,
-29153,
-28843,
-28479,
-28270,
-28202,
-28465,
-28869,
-29378,
-29908,
-30370,
-30893,
-31371,
-31913,
-32426,
-32983,
-33607,
-34424,
-35344,
-36417,
-37336,
-38153,
-38689,
-39068,
-39303,
-39431,
-39506,
-39479,
-39424,
-39368,
-39330,
-39310,
-39231,
-39121,
-38907,
-38680,
-38426,
-38195,
-37957,
-37843,
-37848,
-38157,
-38724,
-39589,
-40550,
-41517,
-42334,
-43030,
-43590,
-44156,
-44663,
-45161,
-45518,
-45665,
-45596,
-45299,
-44911,
-44437,
-44004,
-43519,
-43040,
-42474,
-41945,
-41451,
-41102,
-40909,
-40838,
-40853,
-40849,
-40833,
-40781,
-40754,
-40792,
-40883,
-41023,
-41133,
-41183,
-41108,
-40944,
-40633,
-40245,
-39759,
-39182,
-38573,
-37953,
-37385,
-36888,
-36508,
-36161,
-35889,
-35563,
-35219,
-34802,
-34278,
-33735,
-33069,
-32420,
-31743,
-31058,
-30407,
-29727,
-29127,
-28593,
-28172,
-27925,
-27744,
-27648,
-27531,
-27438,
-27381,
-27444,
-27607,
-27828,
-27995,
-28065,
-27955,
-27777,
-27506,
-27235,
-26918,
-26593,
-26265,
-25933,
-25674,
-25433,
-25278,
-25199,
-25240,
-25406,
-25700,
-26037,
-26372,
-26667,
-26925,
-27211,
-27502,
-27837,
-28128,
-28360,
-28538,
-28623,
-28728,
-28788,
-28849,
-28947,
-29076,
-29325,
-29664,
-30106,
-30595,
-31091,
-31578,
-32042,
-32534,
-32972,
-33414,
-33739,
-33965,
-34089,
-34081,
-34070,
-34031,
-34054,
-34125,
-34241,
-34421,
-34636,
-34879,
-35155,
-35488,
-35827,
-36238,
-36608,
-37017,
-37359,
-37689,
-37893,
-38063,
-38090,
-38050,
-37950,
-37750,
-37565,
-37260,
-36966,
-36617,
-36338,
-36212,
-36262,
-36509,
-36858,
-37195,
-37474,
-37677,
-37803,
-37944,
-38037,
-38063,
-37953,
-37646,
-37208,
-36716,
-36239,
-35858,
-35563,
-35270,
-35003,
-34679,
-34420,
-34236,
-34134,
-34100,
-34069,
-34022,
-34019,
-34032,
-34061,
-34025,
-33804,
-33481,
-33054,
-32731,
-32463,
-32260,
-31987,
-31657,
-31305,
-31074,
-31034,
-31108,
-31227,
-31286,
-31264,
-31261,
-31258,
-31270,
-31214,
-31037,
-30770,
-30467,
-30214,
-29952,
-29692,
-29329,
-28974,
-28631,
-28445,
-28381,
-28421,
-28512,
-28642,
-28808,
-29064,
-29304,
-29546,
-29727,
-29798,
-29858,
-29852,
-29824,
-29757,
-29625,
-29445,
-29263,
-29067,
-28875,
-28664,
-28442,
-28274,
-28168,
-28221,
-28339,
-28535,
-28738,
-28882,
-29021,
-29079,
-29125,
-29070,
-28967,
-28739,
-28475,
-28178,
-27870,
-27613,
-27393,
-27248,
-27161,
-27181,
-27303,
-27507,
-27791,
-28078,
-28346,
-28588,
-28766,
-28924,
-28985,
-29001,
-28878,
-28693,
-28453,
-28209,
-27991,
-27820,
-27590,
-27409,
-27136,
-26945,
-26751,
-26592,
-26459,
-26273,
-26054,
-25786,
-25513,
-25262,
-25023,
-24766,
-24478,
-24216,
-24110,
-24320,
-24944,
-25955,
-27183,
-28429,
-29530,
-30472,
-31247,
-31977,
-32592,
-33024,
-33215,
-33099,
-32795,
-32410,
-32048,
-31784,
-31588,
-31421,
-31243,
-30976,
-30686,
-30355,
-30117,
-30011,
-30108,
-30424,
-30881,
-31403,
-31890,
-32296,
-32629,
-32975,
-33353,
-33879,
-34511,
-35269,
-36111,
-36968,
-37846,
-38664,
-39367,
-39874,
-40215,
-40344,
-40450,
-40499,
-40622,
-40721,
-40816,
-40827,
-40826,
-40766,
-40708,
-40573,
-40332,
-39939,
-39477,
-38988,
-38685,
-38559,
-38678,
-39050,
-39544,
-40209,
-40890,
-41565,
-42198,
-42786,
-43381,
-44031,
-44641,
-45189,
-45477,
-45575,
-45431,
-45228,
-44958,
-44679,
-44293,
-43849,
-43311,
-42848,
-42412,
-42036,
-41634,
-41127,
-40555,
-39930,
-39355,
-38893,
-38523,
-38245,
-38045,
-37922,
-37850,
-37821,
-37747,
-37624,
-37426,
-37152,
-36876,
-36552,
-36250,
-36003,
-35822,
-35774,
-35802,
-35826,
-35759,
-35520,
-35073,
-34506,
-33778,
-32987,
-32073,
-31091,
-30055,
-29001,
-28070,
-27205,
-26535,
-25985,
-25603,
-25379,
-25273,
-25272,
-25330,
-25429,
-25585,
-25787,
-26061,
-26301,
-26509,
-26613,
-26618,
-26621,
-26602,
-26638,
-26671,
-26685,
-26610,
-26480,
-26283,
-26093,
-25901,
-25795,
-25647,
-25590,
-25471,
-25377,
-25265,
-25156,
-25062,
-24991,
-24962,
-24975,
-25053,
-25186,
-25384,
-25662,
-26014,
-26451,
-26997,
-27612,
-28317,
-29036,
-29773,
-30482,
-31168,
-31786,
-32348,
-32796,
-33122,
-33321,
-33378,
-33369,
-33319,
-33275,
-33314,
-33316,
-33399,
-33413,
-33426,
-33438,
-33450,
-33529,
-33655,
-33850,
-34095,
-34372,
-34683,
-35002,
-35363,
-35737,
-36147,
-36584,
-37007,
-37458,
-37874,
-38286,
-38632,
-38931,
-39160,
-39314,
-39430,
-39508,
-39542,
-39587,
-39515,
-39426,
-39196,
-38899,
-38516,
-38125,
-37752,
-37426,
-37203,
-36982,
-36814,
-36654,
-36513,
-36442,
-36448,
-36550,
-36661,
-36770,
-36791,
-36717,
-36621,
-36550,
-36505,
-36538,
-36541,
-36502,
-36376,
-36166,
-35943,
-35710,
-35513,
-35294,
-35056,
-34800,
-34517,
-34281,
-34030,
-33767,
-33449,
-33058,
-32647,
-32229,
-31870,
-31508,
-31187,
-30856,
-30594,
-30430,
-30375,
-30394,
-30438,
-30456,
-30503,
-30566,
-30680,
-30761,
-30786,
-30684,
-30556,
-30386,
-30314,
-30238,
-30159,
-29979,
-29737,
-29432,
-29189,
-28983,
-28856,
-28714,
-28581,
-28385,
-28224,
-28089,
-28038,
-28050,
-28095,
-28117,
-28131,
-28143,
-28139,
-28210,
-28199,
-28273,
-28262,
-28305,
-28369,
-28447,
-28559,
-28644,
-28726,
-28838,
-28964,
-29180,
-29377,
-29560,
-29653,
-29682,
-29663,
-29612,
-29489,
-29319,
-29062,
-28840,
-28652,
-28529,
-28465,
-28356,
-28237,
-28156,
-28167,
-28376,
-28661,
-29030,
-29314,
-29530,
-29701,
-29865,
-30079,
-30288,
-30465,
-30575,
-30611,
-30603,
-30577,
-30549,
-30531,
-30527,
-30471,
-30420,
-30272,
-30076,
-29783,
-29439,
-29050,
-28652,
-28278,
-27878,
-27524,
-27102,
-26794,
-26554,
-26588,
-26911,
-27566,
-28466,
-29478,
-30497,
-31397,
-32229,
-32915,
-33573,
-34104,
-34550,
-34822,
-34935,
-34926,
-34856,
-34771,
-34674,
-34506,
-34256,
-33907,
-33516,
-33120,
-32806,
-32519,
-32317,
-32141,
-32122,
-32177,
-32408,
-32611,
-32834,
-33003,
-33195,
-33491,
-33936,
-34527,
-35161,
-35810,
-36428,
-37043,
-37652,
-38199,
-38651,
-38999,
-39334,
-39752,
-40295,
-40920,
-41514,
-41973,
-42245,
-42319,
-42198,
-41887,
-41319,
-40588,
-39700,
-38873,
-38132,
-37600,
-37211,
-36993,
-36928,
-37052,
-37362,
-37804,
-38356,
-38927,
-39534,
-40182,
-40772,
-41365,
-41735,
-42008,
-42060,
-42052,
-41964,
-41842,
-41648,
-41418,
-41160,
-40964,
-40779,
-40618,
-40309,
-39914,
-39331,
-38737,
-38126,
-37569,
-37062,
-36581,
-36144,
-35743,
-35355,
-34915,
-34405,
-33756,
-33109,
-32444,
-31950,
-31544,
-31328,
-31137,
-31121,
-31154,
-31398,
-31691,
-32071,
-32320,
-32419,
-32309,
-31963,
-31513,
-30944,
-30304,
-29628,
-28873,
-28100,
-27323,
-26604,
-25983,
-25440,
-24989,
-24617,
-24284,
-24043,
-23838,
-23693,
-23593,
-23542,
-23518,
-23558,
-23626,
-23725,
-23828,
-23917,
-24065,
-24188,
-24383,
-24540,
-24663,
-24770,
-24865,
-25021,
-25272,
-25563,
-25909,
-26215,
-26523,
-26775,
-27046,
-27251,
-27422,
-27493,
-27492,
-27449,
-27370,
-27331,
-27291,
-27272,
-27295,
-27391,
-27547,
-27832,
-28168,
-28629,
-29166,
-29795,
-30465,
-31188,
-31861,
-32510,
-33128,
-33731,
-34338,
-34959,
-35495,
-36017,
-36377,
-36701,
-36907,
-37066,
-37150,
-37172,
-37133,
-37060,
-36972,
-36876,
-36813,
-36750,
-36759,
-36800,
-36895,
-37031,
-37136,
-37279,
-37339,
-37421,
-37463,
-37498,
-37544,
-37592,
-37659,
-37771,
-37877,
-38026,
-38143,
-38282,
-38420,
-38573,
-38765,
-38923,
-39064,
-39153,
-39167,
-39129,
-39007,
-38805,
-38489,
-38100,
-37636,
-37154,
-36638,
-36125,
-35586,
-35113,
-34716,
-34496,
-34400,
-34447,
-34508,
-34571,
-34621,
-34687,
-34782,
-34839,
-34893,
-34860,
-34813,
-34807,
-34802,
-34846,
-34812,
-34687,
-34489,
-34254,
-34016,
-33791,
-33551,
-33317,
-33070,
-32891,
-32768,
-32712,
-32673,
-32632,
-32592,
-32532,
-32473,
-32327,
-32128,
-31843,
-31592,
-31439,
-31433,
-31575,
-31776,
-31980,
-32236,
-32444,
-32776,
-33034,
-33317,
-33446,
-33590,
-33627,
-33753,
-33884,
-34026,
-34147,
-34187,
-34209,
-34224,
-34244,
-34278,
-34300,
-34275,
-34223,
-34132,
-34042,
-33995,
-33915,
-33845,
-33745,
-33635,
-33589,
-33568,
-33639,
-33690,
-33722,
-33704,
-33631,
-33642,
-33622,
-33714,
-33764,
-33848,
-33921,
-34046,
-34191,
-34335,
-34433,
-34406,
-34346,
-34200,
-34061,
-33869,
-33625,
-33286,
-32928,
-32570,
-32272,
-32045,
-31813,
-31583,
-31330,
-31044,
-30795,
-30531,
-30237,
-29986,
-29685,
-29469,
-29279,
-29110,
-28949,
-28770,
-28581,
-28484,
-28419,
-28409,
-28392,
-28297,
-28161,
-27947,
-27792,
-27635,
-27538,
-27433,
-27281,
-27032,
-26695,
-26235,
-25733,
-25175,
-24618,
-24067,
-23542,
-23024,
-22630,
-22383,
-22448,
-22800,
-23402,
-24139,
-24825,
-25472,
-25984,
-26537,
-27014,
-27485,
-27780,
-27949,
-27970,
-28000,
-28046,
-28222,
-28387,
-28555,
-28655,
-28723,
-28740,
-28746,
-28693,
-28602,
-28459,
-28303,
-28193,
-28096,
-28060,
-28008,
-27980,
-27952,
-28000,
-28103,
-28331,
-28638,
-29093,
-29636,
-30271,
-30970,
-31655,
-32350,
-32984,
-33643,
-34307,
-35073,
-35893,
-36790,
-37631,
-38394,
-38980,
-39432,
-39718,
-39901,
-39894,
-39780,
-39455,
-39073,
-38618,
-38217,
-37889,
-37673,
-37544,
-37495,
-37480,
-37513,
-37534,
-37609,
-37697,
-37887,
-38142,
-38453,
-38756,
-38989,
-39203,
-39423,
-39761,
-40157,
-40630,
-41028,
-41376,
-41649,
-41910,
-42164,
-42372,
-42423,
-42309,
-42044,
-41713,
-41397,
-41030,
-40636,
-40109,
-39590,
-39010,
-38505,
-37936,
-37342,
-36568,
-35828,
-35035,
-34449,
-33933,
-33593,
-33275,
-33127,
-33051,
-33152,
-33270,
-33379,
-33367,
-33248,
-33068,
-32916,
-32783,
-32658,
-32469,
-32181,
-31831,
-31431,
-31061,
-30700,
-30382,
-30054,
-29713,
-29415,
-29078,
-28849,
-28599,
-28430,
-28251,
-28089,
-27923,
-27732,
-27527,
-27287,
-27029,
-26748,
-26521,
-26314,
-26188,
-26069,
-25996,
-25924,
-25945,
-26007,
-26203,
-26414,
-26681,
-26931,
-27220,
-27543,
-27924,
-28351,
-28761,
-29109,
-29419,
-29619,
-29794,
-29858,
-29857,
-29725,
-29552,
-29325,
-29147,
-28986,
-28893,
-28818,
-28797,
-28853,
-28998,
-29226,
-29543,
-29876,
-30219,
-30561,
-30881,
-31209,
-31548,
-31865,
-32194,
-32470,
-32698,
-32882,
-33009,
-33121,
-33234,
-33361,
-33518,
-33695,
-33874,
-34084,
-34305,
-34550,
-34815,
-35014,
-35212,
-35294,
-35355,
-35377,
-35377,
-35357,
-35319,
-35226,
-35176,
-35078,
-35079,
-35043,
-35083,
-35081,
-35177,
-35297,
-35539,
-35793,
-36086,
-36357,
-36600,
-36836,
-37050,
-37241,
-37394,
-37499,
-37524,
-37567,
-37578,
-37618,
-37635,
-37670,
-37716,
-37775,
-37893,
-38034,
-38203,
-38343,
-38434,
-38492,
-38467,
-38457,
-38349,
-38265,
-38083,
-37919,
-37723,
-37579,
-37456,
-37430,
-37417,
-37436,
-37474,
-37505,
-37589,
-37718,
-37902,
-38113,
-38337,
-38533,
-38724,
-38884,
-39007,
-39105,
-39072,
-38971,
-38700,
-38390,
-38059,
-37781,
-37549,
-37358,
-37127,
-36882,
-36625,
-36429,
-36282,
-36150,
-35985,
-35767,
-35520,
-35311,
-35138,
-35008,
-34869,
-34684,
-34475,
-34276,
-34098,
-33959,
-33816,
-33632,
-33460,
-33275,
-33159,
-33036,
-32914,
-32755,
-32619,
-32497,
-32470,
-32471,
-32404,
-32340,
-32125,
-31968,
-31731,
-31526,
-31249,
-30939,
-30602,
-30323,
-30102,
-29973,
-29865,
-29782,
-29684,
-29621,
-29578,
-29507,
-29398,
-29212,
-28978,
-28766,
-28589,
-28443,
-28280,
-28092,
-27848,
-27619,
-27423,
-27271,
-27161,
-27013,
-26870,
-26655,
-26515,
-26354,
-26289,
-26227,
-26216,
-26201,
-26224,
-26245,
-26285,
-26324,
-26338,
-26332,
-26301,
-26241,
-26193,
-26108,
-26036,
-25928,
-25850,
-25766,
-25741,
-25720,
-25741,
-25745,
-25735,
-25699,
-25666,
-25633,
-25654,
-25658,
-25685,
-25598,
-25450,
-25220,
-24977,
-24776,
-24600,
-24459,
-24307,
-24184,
-24190,
-24321,
-24742,
-25270,
-25946,
-26579,
-27190,
-27723,
-28241,
-28685,
-29061,
-29348,
-29453,
-29525,
-29463,
-29474,
-29443,
-29484,
-29557,
-29608,
-29762,
-29856,
-30043,
-30205,
-30424,
-30645,
-30869,
-31052,
-31216,
-31280,
-31373,
-31386,
-31399,
-31345,
-31250,
-31111,
-31070,
-31119,
-31316,
-31636,
-31971,
-32350,
-32687,
-33131,
-33564,
-34113,
-34658,
-35247,
-35876,
-36559,
-37284,
-38015,
-38638,
-39118,
-39455,
-39670,
-39797,
-39833,
-39774,
-39613,
-39395,
-39242,
-39156,
-39243,
-39355,
-39505,
-39560,
-39576,
-39528,
-39530,
-39520,
-39557,
-39518,
-39394,
-39163,
-38862,
-38572,
-38310,
-38179,
-38077,
-38092,
-38116,
-38242,
-38418,
-38738,
-39088,
-39512,
-39828,
-40094,
-40219,
-40288,
-40322,
-40341,
-40345,
-40267,
-40108,
-39813,
-39391,
-38883,
-38227,
-37504,
-36681,
-35840,
-35032,
-34312,
-33709,
-33223,
-32808,
-32468,
-32156,
-31905,
-31709,
-31562,
-31437,
-31308,
-31151,
-30987,
-30809,
-30648,
-30545,
-30453,
-30395,
-30362,
-30326,
-30342,
-30383,
-30393,
-30412,
-30344,
-30241,
-30098,
-29933,
-29721,
-29537,
-29257,
-29038,
-28782,
-28579,
-28415,
-28259,
-28133,
-27964,
-27799,
-27635,
-27500,
-27421,
-27407,
-27434,
-27548,
-27634,
-27784,
-27865,
-28022,
-28142,
-28355,
-28538,
-28764,
-28960,
-29138,
-29323,
-29482,
-29647,
-29804,
-29934,
-30077,
-30247,
-30493,
-30785,
-31154,
-31478,
-31807,
-32063,
-32324,
-32552,
-32794,
-32990,
-33210,
-33340,
-33556,
-33704,
-33964,
-34144,
-34373,
-34511,
-34649,
-34763,
-34837,
-34945,
-35011,
-35139,
-35272,
-35449,
-35627,
-35832,
-36029,
-36264,
-36539,
-36852,
-37168,
-37486,
-37757,
-38007,
-38241,
-38480,
-38698,
-38903,
-39051,
-39186,
-39278,
-39382,
-39457,
-39539,
-39588,
-39630,
-39671,
-39681,
-39728,
-39719,
-39728,
-39685,
-39683,
-39626,
-39652,
-39615,
-39606,
-39621,
-39564,
-39601,
-39563,
-39558,
-39495,
-39416,
-39296,
-39177,
-39043,
-38964,
-38853,
-38770,
-38648,
-38542,
-38459,
-38376,
-38374,
-38330,
-38303,
-38222,
-38124,
-37984,
-37847,
-37641,
-37389,
-37080,
-36729,
-36365,
-36045,
-35712,
-35410,
-35081,
-34796,
-34511,
-34353,
-34190,
-34087,
-33907,
-33698,
-33410,
-33142,
-32887,
-32678,
-32499,
-32282,
-32016,
-31725,
-31448,
-31224,
-31064,
-30914,
-30772,
-30573,
-30444,
-30294,
-30237,
-30155,
-30037,
-29873,
-29666,
-29507,
-29395,
-29257,
-29095,
-28813,
-28512,
-28239,
-28052,
-27916,
-27816,
-27639,
-27463,
-27278,
-27184,
-27181,
-27236,
-27345,
-27444,
-27599,
-27747,
-27941,
-28095,
-28228,
-28323,
-28356,
-28411,
-28406,
-28451,
-28423,
-28438,
-28388,
-28401,
-28393,
-28428,
-28486,
-28535,
-28615,
-28664,
-28698,
-28736,
-28723,
-28795,
-28852,
-28983,
-29109,
-29182,
-29235,
-29230,
-29273,
-29349,
-29518,
-29753,
-30030,
-30313,
-30597,
-30807,
-31017,
-31153,
-31282,
-31375,
-31449,
-31492,
-31493,
-31446,
-31408,
-31324,
-31359,
-31363,
-31439,
-31495,
-31530,
-31549,
-31625,
-31660,
-31789,
-31853,
-31953,
-31973,
-32018,
-32000,
-32003,
-31906,
-31797,
-31565,
-31345,
-31061,
-30776,
-30506,
-30199,
-29915,
-29604,
-29301,
-28948,
-28618,
-28240,
-27911,
-27573,
-27297,
-27019,
-26770,
-26581,
-26485,
-26578,
-26801,
-27167,
-27563,
-27920,
-28236,
-28465,
-28702,
-28904,
-29087,
-29202,
-29206,
-29137,
-29021,
-28909,
-28855,
-28832,
-28830,
-28789,
-28702,
-28628,
-28546,
-28493,
-28455,
-28383,
-28326,
-28251,
-28242,
-28234,
-28215,
-28150,
-27970,
-27850,
-27732,
-27811,
-27934,
-28185,
-28397,
-28696,
-28987,
-29374,
-29796,
-30207,
-30628,
-31028,
-31511,
-32116,
-32852,
-33633,
-34410,
-35065,
-35623,
-36065,
-36420,
-36688,
-36890,
-36963,
-36978,
-36845,
-36736,
-36578,
-36525,
-36527,
-36590,
-36715,
-36795,
-36893,
-36937,
-37038,
-37139,
-37291,
-37374,
-37421,
-37369,
-37312,
-37270,
-37291,
-37411,
-37567,
-37773,
-38046,
-38367,
-38751,
-39176,
-39522,
-39872,
-40107,
-40378,
-40627,
-40902,
-41154,
-41353,
-41488,
-41561,
-41612,
-41586,
-41521,
-41337,
-41058,
-40657,
-40217,
-39728,
-39287,
-38868,
-38524,
-38165,
-37918,
-37614,
-37448,
-37239,
-37062,
-36849,
-36563,
-36268,
-35948,
-35665,
-35382,
-35124,
-34830,
-34553,
-34286,
-34090,
-33994,
-33989,
-34015,
-34084,
-34059,
-34068,
-34004,
-33996,
-33970,
-33965,
-33919,
-33839,
-33721,
-33571,
-33398,
-33193,
-32942,
-32638,
-32302,
-31913,
-31573,
-31178,
-30866,
-30503,
-30194,
-29861,
-29564,
-29250,
-28977,
-28719,
-28534,
-28429,
-28368,
-28364,
-28350,
-28350,
-28345,
-28376,
-28428,
-28558,
-28635,
-28794,
-28852,
-29027,
-29137,
-29338,
-29497,
-29660,
-29798,
-29921,
-30053,
-30148,
-30231,
-30305,
-30347,
-30397,
-30425,
-30435,
-30401,
-30315,
-30229,
-30136,
-30112,
-30110,
-30154,
-30205,
-30260,
-30317,
-30394,
-30463,
-30554,
-30607,
-30679,
-30766,
-30884,
-31087,
-31321,
-31615,
-31918,
-32242,
-32521,
-32799,
-33025,
-33235,
-33446,
-33630,
-33844,
-34048,
-34262,
-34465,
-34678,
-34894,
-35096,
-35291,
-35439,
-35540,
-35630,
-35659,
-35693,
-35679,
-35660,
-35584,
-35483,
-35391,
-35337,
-35380,
-35481,
-35626,
-35772,
-35909,
-35988,
-36081,
-36146,
-36225,
-36301,
-36338,
-36368,
-36368,
-36364,
-36403,
-36423,
-36464,
-36459,
-36439,
-36380,
-36318,
-36232,
-36145,
-36076,
-35985,
-35956,
-35877,
-35852,
-35767,
-35685,
-35598,
-35477,
-35359,
-35187,
-34975,
-34729,
-34490,
-34282,
-34140,
-34034,
-33953,
-33871,
-33798,
-33731,
-33733,
-33684,
-33725,
-33668,
-33648,
-33579,
-33482,
-33378,
-33216,
-33071,
-32879,
-32746,
-32624,
-32495,
-32369,
-32175,
-31959,
-31743,
-31542,
-31383,
-31248,
-31124,
-31014,
-30878,
-30809,
-30680,
-30669,
-30561,
-30556,
-30481,
-30481,
-30462,
-30508,
-30504,
-30558,
-30526,
-30578,
-30625,
-30743,
-30908,
-31079,
-31228,
-31336,
-31396,
-31456,
-31540,
-31655,
-31797,
-31922,
-32068,
-32177,
-32360,
-32535,
-32788,
-33036,
-33286,
-33502,
-33685,
-33802,
-33927,
-33985,
-34049,
-34077,
-34073,
-34097,
-34069,
-34076,
-34079,
-34086,
-34116,
-34155,
-34166,
-34205,
-34221,
-34278,
-34332,
-34408,
-34479,
-34556,
-34609,
-34665,
-34677,
-34683,
-34636,
-34573,
-34497,
-34423,
-34349,
-34277,
-34177,
-34078,
-33963,
-33859,
-33722,
-33601,
-33404,
-33219,
-33000,
-32806,
-32622,
-32390,
-32110,
-31743,
-31347,
-30924,
-30537,
-30120,
-29722,
-29245,
-28842,
-28407,
-28078,
-27759,
-27399,
-27058,
-26673,
-26321,
-26022,
-25697,
-25389,
-25030,
-24682,
-24413,
-24194,
-24058,
-23857,
-23683,
-23436,
-23328,
-23319,
-23507,
-23798,
-24120,
-24405,
-24656,
-24843,
-25038,
-25207,
-25323,
-25393,
-25385,
-25361,
-25332,
-25379,
-25484,
-25664,
-25864,
-26044,
-26180,
-26258,
-26317,
-26360,
-26415,
-26466,
-26485,
-26489,
-26510,
-26536,
-26687,
-26768,
-26896,
-26896,
-26895,
-26978,
-27186,
-27584,
-28059,
-28515,
-28962,
-29411,
-29983,
-30693,
-31440,
-32167,
-32782,
-33368,
-34032,
-34776,
-35606,
-36335,
-36963,
-37415,
-37891,
-38331,
-38815,
-39152,
-39365,
-39432,
-39450,
-39511,
-39611,
-39746,
-39818,
-39880,
-39935,
-40049,
-40174,
-40310,
-40384,
-40448,
-40529,
-40618,
-40715,
-40747,
-40767,
-40771,
-40912,
-41123,
-41417,
-41668,
-41877,
-42055,
-42299,
-42602,
-42920,
-43146,
-43253,
-43278,
-43337,
-43476,
-43649,
-43770,
-43747,
-43615,
-43429,
-43238,
-43076,
-42789,
-42426,
-41861,
-41268,
-40678,
-40143,
-39656,
-39144,
-38618,
-38074,
-37558,
-37119,
-36713,
-36339,
-35949,
-35523,
-35120,
-34733,
-34402,
-34120,
-33830,
-33543,
-33219,
-32901,
-32618,
-32379,
-32198,
-32018,
-31858,
-31667,
-31482,
-31307,
-31148,
-30995,
-30839,
-30675,
-30503,
-30349,
-30151,
-30000,
-29778,
-29598,
-29345,
-29109,
-28754,
-28407,
-27943,
-27502,
-27073,
-26679,
-26343,
-26051,
-25755,
-25558,
-25337,
-25260,
-25151,
-25137,
-25093,
-25085,
-25152,
-25217,
-25334,
-25396,
-25443,
-25435,
-25479,
-25489,
-25618,
-25721,
-25870,
-26039,
-26170,
-26417,
-26593,
-26873,
-27104,
-27361,
-27614,
-27865,
-28110,
-28339,
-28543,
-28719,
-28852,
-28979,
-29048,
-29105,
-29147,
-29188,
-29269,
-29380,
-29488,
-29611,
-29698,
-29792,
-29911,
-30039,
-30234,
-30385,
-30608,
-30722,
-30924,
-31027,
-31159,
-31272,
-31354,
-31481,
-31645,
-31884,
-32165,
-32492,
-32828,
-33166,
-33594,
-34002,
-34509,
-34996,
-35445,
-35847,
-36154,
-36416,
-36651,
-36841,
-37027,
-37155,
-37241,
-37297,
-37289,
-37337,
-37292,
-37309,
-37225,
-37153,
-37064,
-36980,
-36960,
-36932,
-36961,
-36968,
-36984,
-37017,
-37059,
-37149,
-37245,
-37345,
-37421,
-37477,
-37530,
-37591,
-37636,
-37712,
-37690,
-37718,
-37673,
-37712,
-37766,
-37872,
-37968,
-38021,
-38017,
-37993,
-37958,
-37938,
-37922,
-37818,
-37685,
-37470,
-37283,
-37154,
-37045,
-36974,
-36855,
-36692,
-36515,
-36340,
-36154,
-36026,
-35851,
-35737,
-35603,
-35509,
-35444,
-35404,
-35390,
-35414,
-35460,
-35539,
-35617,
-35649,
-35668,
-35570,
-35502,
-35342,
-35199,
-35015,
-34798,
-34573,
-34315,
-34107,
-33888,
-33744,
-33604,
-33516,
-33452,
-33388,
-33379,
-33297,
-33292,
-33202,
-33143,
-33083,
-33008,
-32969,
-32926,
-32911,
-32923,
-32958,
-32977,
-32988,
-32970,
-32937,
-32924,
-32926,
-32955,
-33023,
-33072,
-33163,
-33203,
-33292,
-33318,
-33390,
-33390,
-33401,
-33359,
-33291,
-33197,
-33109,
-33029,
-32978,
-32959,
-32983,
-33015,
-33094,
-33186,
-33329,
-33489,
-33661,
-33765,
-33853,
-33821,
-33787,
-33703,
-33600,
-33504,
-33360,
-33211,
-33061,
-32928,
-32829,
-32772,
-32697,
-32618,
-32533,
-32443,
-32397,
-32402,
-32416,
-32490,
-32483,
-32489,
-32450,
-32384,
-32326,
-32247,
-32115,
-31955,
-31747,
-31515,
-31305,
-31094,
-30913,
-30720,
-30535,
-30358,
-30173,
-30026,
-29850,
-29644,
-29442,
-29178,
-28974,
-28738,
-28492,
-28216,
-27857,
-27509,
-27130,
-26822,
-26543,
-26293,
-26063,
-25835,
-25636,
-25470,
-25292,
-25119,
-24893,
-24688,
-24463,
-24310,
-24179,
-24037,
-23905,
-23707,
-23584,
-23514,
-23621,
-23855,
-24226,
-24637,
-25044,
-25414,
-25745,
-26043,
-26314,
-26504,
-26647,
-26672,
-26651,
-26579,
-26517,
-26492,
-26487,
-26496,
-26469,
-26410,
-26351,
-26343,
-26356,
-26438,
-26483,
-26512,
-26550,
-26665,
-26891,
-27217,
-27516,
-27751,
-27869,
-27994,
-28194,
-28563,
-28948,
-29349,
-29620,
-29906,
-30262,
-30730,
-31293,
-31812,
-32271,
-32681,
-33197,
-33814,
-34532,
-35187,
-35726,
-36151,
-36500,
-36906,
-37288,
-37598,
-37764,
-37784,
-37759,
-37748,
-37783,
-37829,
-37915,
-38016,
-38201,
-38453,
-38709,
-38950,
-39086,
-39214,
-39343,
-39519,
-39651,
-39722,
-39721,
-39724,
-39876,
-40111,
-40433,
-40677,
-40800,
-40904,
-41037,
-41264,
-41572,
-41745,
-41899,
-41877,
-41954,
-42065,
-42221,
-42336,
-42259,
-42088,
-41790,
-41533,
-41210,
-40874,
-40367,
-39772,
-39134,
-38521,
-38009,
-37505,
-37048,
-36548,
-36094,
-35703,
-35361,
-35083,
-34791,
-34445,
-34081,
-33652,
-33268,
-32858,
-32464,
-32038,
-31583,
-31138,
-30688,
-30314,
-29973,
-29701,
-29413,
-29160,
-28876,
-28670,
-28509,
-28384,
-28333,
-28257,
-28207,
-28154,
-28098,
-28019,
-27912,
-27736,
-27506,
-27275,
-27003,
-26780,
-26500,
-26246,
-25959,
-25653,
-25405,
-25178,
-25027,
-24946,
-24896,
-24923,
-24939,
-25041,
-25133,
-25289,
-25440,
-25616,
-25771,
-25966,
-26155,
-26394,
-26616,
-26868,
-27100,
-27393,
-27702,
-28097,
-28496,
-28962,
-29375,
-29806,
-30234,
-30623,
-31041,
-31369,
-31722,
-31996,
-32308,
-32543,
-32823,
-32993,
-33158,
-33268,
-33372,
-33557,
-33737,
-33993,
-34240,
-34484,
-34732,
-35017,
-35292,
-35639,
-35946,
-36282,
-36593,
-36899,
-37202,
-37496,
-37819,
-38083,
-38399,
-38631,
-38916,
-39169,
-39415,
-39647,
-39839,
-39980,
-40128,
-40236,
-40381,
-40504,
-40608,
-40639,
-40606,
-40499,
-40383,
-40245,
-40127,
-39997,
-39841,
-39670,
-39480,
-39333,
-39204,
-39136,
-39052,
-38995,
-38886,
-38756,
-38631,
-38487,
-38326,
-38180,
-37948,
-37747,
-37489,
-37260,
-37049,
-36839,
-36648,
-36449,
-36260,
-36106,
-35971,
-35889,
-35816,
-35732,
-35631,
-35537,
-35415,
-35346,
-35262,
-35187,
-35083,
-34927,
-34780,
-34638,
-34509,
-34403,
-34243,
-34083,
-33863,
-33633,
-33396,
-33178,
-32945,
-32749,
-32539,
-32381,
-32231,
-32081,
-31909,
-31728,
-31540,
-31390,
-31251,
-31184,
-31102,
-31062,
-31021,
-31013,
-31075,
-31163,
-31293,
-31428,
-31579,
-31727,
-31914,
-32077,
-32258,
-32393,
-32527,
-32614,
-32728,
-32799,
-32891,
-32919,
-32943,
-32931,
-32970,
-33003,
-33056,
-33126,
-33148,
-33168,
-33137,
-33098,
-33057,
-32988,
-32975,
-32906,
-32900,
-32870,
-32856,
-32881,
-32885,
-32928,
-32965,
-33030,
-33104,
-33226,
-33354,
-33505,
-33687,
-33814,
-34003,
-34107,
-34240,
-34319,
-34379,
-34404,
-34395,
-34393,
-34378,
-34372,
-34371,
-34348,
-34310,
-34254,
-34163,
-34096,
-34014,
-33942,
-33873,
-33783,
-33706,
-33615,
-33544,
-33504,
-33445,
-33397,
-33332,
-33238,
-33152,
-33036,
-32925,
-32801,
-32680,
-32548,
-32433,
-32295,
-32200,
-32063,
-31951,
-31771,
-31575,
-31321,
-31026,
-30721,
-30375,
-30054,
-29700,
-29365,
-29012,
-28719,
-28463,
-28286,
-28166,
-28083,
-27981,
-27922,
-27787,
-27751,
-27680,
-27659,
-27618,
-27518,
-27428,
-27245,
-27133,
-26954,
-26859,
-26697,
-26560,
-26376,
-26194,
-25994,
-25819,
-25603,
-25409,
-25169,
-24936,
-24697,
-24489,
-24291,
-24098,
-23920,
-23705,
-23535,
-23376,
-23247,
-23131,
-23011,
-22883,
-22794,
-22719,
-22685,
-22636,
-22524,
-22383,
-22218,
-22091,
-22021,
-21961,
-21900,
-21831,
-21821,
-21953,
-22262,
-22718,
-23280,
-23840,
-24409,
-24979,
-25574,
-26167,
-26688,
-27124,
-27429,
-27680,
-27895,
-28130,
-28351,
-28579,
-28754,
-28930,
-29077,
-29243,
-29379,
-29489,
-29529,
-29549,
-29524,
-29538,
-29587,
-29682,
-29802,
-29920,
-30039,
-30144,
-30307,
-30539,
-30854,
-31261,
-31708,
-32206,
-32702,
-33268,
-33831,
-34485,
-35120,
-35789,
-36446,
-37084,
-37791,
-38494,
-39245,
-39953,
-40591,
-41128,
-41580,
-41951,
-42243,
-42428,
-42453,
-42307,
-42042,
-41727,
-41473,
-41316,
-41268,
-41300,
-41361,
-41434,
-41532,
-41601,
-41756,
-41842,
-41980,
-42015,
-42068,
-42063,
-42143,
-42201,
-42370,
-42495,
-42693,
-42821,
-43004,
-43131,
-43312,
-43472,
-43641,
-43839,
-44011,
-44243,
-44473,
-44687,
-44894,
-44986,
-45021,
-44928,
-44748,
-44494,
-44115,
-43676,
-43067,
-42414,
-41657,
-40915,
-40139,
-39403,
-38669,
-37964,
-37315,
-36734,
-36269,
-35847,
-35505,
-35141,
-34805,
-34462,
-34160,
-33847,
-33552,
-33236,
-32891,
-32561,
-32283,
-32033,
-31908,
-31774,
-31708,
-31613,
-31520,
-31401,
-31285,
-31167,
-31018,
-30839,
-30603,
-30317,
-29983,
-29609,
-29199,
-28772,
-28302,
-27854,
-27369,
-26903,
-26448,
-26007,
-25576,
-25199,
-24858,
-24565,
-24351,
-24163,
-24095,
-24072,
-24136,
-24267,
-24404,
-24586,
-24736,
-24907,
-25083,
-25235,
-25389,
-25512,
-25610,
-25726,
-25866,
-26029,
-26257,
-26460,
-26712,
-26942,
-27235,
-27539,
-27871,
-28175,
-28448,
-28658,
-28842,
-28964,
-29105,
-29214,
-29347,
-29478,
-29656,
-29858,
-30136,
-30437,
-30749,
-31073,
-31379,
-31705,
-32060,
-32413,
-32819,
-33211,
-33637,
-34048,
-34522,
-34971,
-35495,
-35953,
-36405,
-36810,
-37130,
-37456,
-37723,
-37971,
-38231,
-38406,
-38615,
-38774,
-38935,
-39110,
-39243,
-39384,
-39499,
-39575,
-39658,
-39681,
-39701,
-39681,
-39670,
-39631,
-39628,
-39618,
-39640,
-39654,
-39716,
-39735,
-39824,
-39874,
-39958,
-40021,
-40039,
-40040,
-39975,
-39893,
-39786,
-39660,
-39550,
-39415,
-39274,
-39123,
-38948,
-38760,
-38550,
-38300,
-38000,
-37693,
-37312,
-36946,
-36532,
-36127,
-35718,
-35332,
-34943,
-34608,
-34268,
-33955,
-33633,
-33307,
-33011,
-32735,
-32495,
-32288,
-32091,
-31906,
-31725,
-31520,
-31309,
-31102,
-30885,
-30684,
-30454,
-30239,
-29992,
-29727,
-29462,
-29180,
-28922,
-28710,
-28536,
-28397,
-28338,
-28237,
-28180,
-28073,
-27963,
-27828,
-27700,
-27570,
-27456,
-27366,
-27283,
-27223,
-27177,
-27125,
-27106,
-27083,
-27131,
-27180,
-27315,
-27417,
-27565,
-27703,
-27819,
-27981,
-28110,
-28292,
-28433,
-28573,
-28677,
-28785,
-28850,
-28978,
-29041,
-29191,
-29290,
-29442,
-29580,
-29765,
-29958,
-30190,
-30414,
-30695,
-30927,
-31196,
-31453,
-31727,
-31978,
-32230,
-32438,
-32642,
-32831,
-32994,
-33161,
-33290,
-33426,
-33536,
-33688,
-33834,
-34043,
-34252,
-34494,
-34718,
-34979,
-35195,
-35460,
-35662,
-35916,
-36112,
-36369,
-36563,
-36779,
-36938,
-37058,
-37151,
-37206,
-37248,
-37285,
-37276,
-37270,
-37252,
-37197,
-37192,
-37138,
-37109,
-37070,
-36965,
-36907,
-36754,
-36636,
-36432,
-36250,
-36010,
-35820,
-35603,
-35428,
-35187,
-34978,
-34688,
-34423,
-34139,
-33882,
-33632,
-33380,
-33139,
-32866,
-32635,
-32386,
-32169,
-31962,
-31779,
-31590,
-31420,
-31247,
-31068,
-30867,
-30654,
-30408,
-30164,
-29911,
-29659,
-29402,
-29175,
-28929,
-28718,
-28519,
-28327,
-28206,
-28039,
-27944,
-27796,
-27698,
-27585,
-27515,
-27453,
-27402,
-27339,
-27230,
-27076,
-26903,
-26685,
-26477,
-26278,
-26051,
-25897,
-25700,
-25561,
-25415,
-25267,
-25124,
-24909,
-24730,
-24478,
-24316,
-24136,
-24066,
-24002,
-24028,
-24094,
-24252,
-24547,
-24980,
-25578,
-26284,
-27067,
-27843,
-28593,
-29285,
-29923,
-30472,
-30962,
-31314,
-31561,
-31665,
-31696,
-31661,
-31644,
-31634,
-31642,
-31644,
-31622,
-31589,
-31513,
-31478,
-31419,
-31371,
-31303,
-31270,
-31253,
-31330,
-31468,
-31640,
-31845,
-32046,
-32313,
-32651,
-33111,
-33640,
-34209,
-34799,
-35382,
-36014,
-36633,
-37310,
-37889,
-38479,
-38952,
-39469,
-39938,
-40408,
-40810,
-41110,
-41289,
-41380,
-41367,
-41242,
-40994,
-40552,
-40008,
-39354,
-38734,
-38181,
-37751,
-37487,
-37327,
-37298,
-37313,
-37365,
-37412,
-37450,
-37508,
-37559,
-37632,
-37678,
-37709,
-37727,
-37827,
-37966,
-38214,
-38494,
-38747,
-38955,
-39109,
-39216,
-39327,
-39339,
-39291,
-39109,
-38835,
-38519,
-38137,
-37736,
-37258,
-36667,
-36043,
-35344,
-34669,
-34006,
-33302,
-32629,
-31898,
-31238,
-30606,
-30037,
-29538,
-29066,
-28733,
-28454,
-28374,
-28347,
-28452,
-28524,
-28635,
-28699,
-28802,
-28846,
-28889,
-28850,
-28745,
-28573,
-28385,
-28183,
-28037,
-27911,
-27817,
-27755,
-27690,
-27601,
-27497,
-27358,
-27203,
-27069,
-26915,
-26833,
-26736,
-26702,
-26716,
-26752,
-26884,
-27009,
-27210,
-27400,
-27645,
-27887,
-28178,
-28465,
-28767,
-29047,
-29349,
-29665,
-29989,
-30359,
-30685,
-31058,
-31369,
-31735,
-32069,
-32425,
-32760,
-33057,
-33337,
-33528,
-33720,
-33821,
-33908,
-33949,
-33988,
-34014,
-34061,
-34176,
-34299,
-34512,
-34743,
-34999,
-35286,
-35541,
-35780,
-36032,
-36262,
-36515,
-36793,
-37051,
-37327,
-37572,
-37793,
-38036,
-38232,
-38466,
-38636,
-38802,
-38925,
-38999,
-39065,
-39100,
-39103,
-39109,
-39060,
-39010,
-38920,
-38794,
-38669,
-38491,
-38329,
-38144,
-37977,
-37754,
-37565,
-37298,
-37082,
-36847,
-36701,
-36562,
-36501,
-36481,
-36466,
-36521,
-36562,
-36633,
-36722,
-36758,
-36781,
-36743,
-36629,
-36481,
-36254,
-36006,
-35739,
-35461,
-35201,
-34941,
-34699,
-34456,
-34224,
-33970,
-33759,
-33502,
-33252,
-32986,
-32653,
-32350,
-32010,
-31676,
-31391,
-31098,
-30876,
-30654,
-30487,
-30307,
-30124,
-29955,
-29781,
-29650,
-29555,
-29461,
-29439,
-29365,
-29381,
-29353,
-29403,
-29422,
-29464,
-29481,
-29483,
-29446,
-29432,
-29345,
-29304,
-29200,
-29095,
-28978,
-28857,
-28742,
-28648,
-28582,
-28509,
-28487,
-28436,
-28453,
-28481,
-28533,
-28612,
-28666,
-28742,
-28824,
-28935,
-29092,
-29292,
-29514,
-29767,
-30032,
-30327,
-30651,
-30954,
-31270,
-31514,
-31751,
-31971,
-32176,
-32407,
-32565,
-32744,
-32853,
-33026,
-33184,
-33395,
-33596,
-33797,
-33976,
-34122,
-34268,
-34371,
-34476,
-34556,
-34619,
-34713,
-34804,
-34964,
-35126,
-35365,
-35577,
-35843,
-36106,
-36347,
-36613,
-36814,
-37013,
-37185,
-37321,
-37459,
-37609,
-37721,
-37886,
-37967,
-38080,
-38114,
-38138,
-38126,
-38091,
-38053,
-38028,
-38000,
-37996,
-37964,
-37973,
-37930,
-37946,
-37925,
-37955,
-37983,
-37988,
-38020,
-38004,
-38015,
-38047,
-38054,
-38085,
-38080,
-38003,
-37943,
-37796,
-37715,
-37568,
-37458,
-37281,
-37127,
-36926,
-36754,
-36557,
-36387,
-36161,
-35960,
-35701,
-35458,
-35226,
-34962,
-34751,
-34465,
-34221,
-33891,
-33593,
-33250,
-32928,
-32609,
-32291,
-31981,
-31621,
-31281,
-30900,
-30552,
-30245,
-29944,
-29705,
-29442,
-29194,
-28949,
-28756,
-28569,
-28465,
-28369,
-28259,
-28196,
-28051,
-27956,
-27833,
-27693,
-27575,
-27370,
-27210,
-26960,
-26760,
-26539,
-26363,
-26202,
-26063,
-25938,
-25822,
-25738,
-25673,
-25611,
-25568,
-25491,
-25396,
-25297,
-25138,
-25023,
-24858,
-24682,
-24514,
-24268,
-24094,
-23837,
-23646,
-23454,
-23285,
-23137,
-23002,
-22864,
-22727,
-22551,
-22369,
-22149,
-21942,
-21743,
-21591,
-21514,
-21537,
-21689,
-21980,
-22451,
-23070,
-23829,
-24654,
-25499,
-26293,
-26981,
-27570,
-28012,
-28313,
-28509,
-28568,
-28546,
-28444,
-28301,
-28137,
-27978,
-27813,
-27631,
-27475,
-27307,
-27193,
-27116,
-27101,
-27145,
-27238,
-27376,
-27586,
-27849,
-28204,
-28600,
-29051,
-29550,
-30065,
-30715,
-31376,
-32190,
-32990,
-33846,
-34636,
-35389,
-36052,
-36658,
-37190,
-37659,
-38097,
-38476,
-38848,
-39167,
-39497,
-39702,
-39911,
-39958,
-39904,
-39730,
-39422,
-39042,
-38629,
-38256,
-37993,
-37863,
-37957,
-38163,
-38567,
-38996,
-39557,
-40081,
-40688,
-41252,
-41812,
-42307,
-42742,
-43111,
-43433,
-43708,
-43940,
-44115,
-44207,
-44255,
-44204,
-44152,
-43989,
-43829,
-43583,
-43341,
-43043,
-42737,
-42422,
-42019,
-41656,
-41181,
-40757,
-40309,
-39905,
-39503,
-39149,
-38759,
-38415,
-38069,
-37708,
-37439,
-37089,
-36812,
-36519,
-36244,
-36034,
-35885,
-35800,
-35781,
-35782,
-35730,
-35646,
-35409,
-35094,
-34646,
-34069,
-33427,
-32693,
-31930,
-31194,
-30513,
-29910,
-29429,
-28991,
-28668,
-28366,
-28135,
-27937,
-27826,
-27726,
-27709,
-27698,
-27713,
-27778,
-27813,
-27894,
-27934,
-27974,
-27973,
-27975,
-27949,
-27934,
-27915,
-27879,
-27853,
-27795,
-27755,
-27713,
-27664,
-27637,
-27597,
-27564,
-27563,
-27574,
-27667,
-27803,
-27996,
-28216,
-28428,
-28640,
-28809,
-29003,
-29128,
-29320,
-29486,
-29727,
-30008,
-30375,
-30779,
-31271,
-31755,
-32291,
-32796,
-33316,
-33782,
-34181,
-34518,
-34737,
-34929,
-35035,
-35139,
-35187,
-35259,
-35287,
-35359,
-35372,
-35463,
-35484,
-35559,
-35627,
-35710,
-35830,
-35974,
-36144,
-36345,
-36566,
-36794,
-37021,
-37248,
-37450,
-37648,
-37816,
-37984,
-38131,
-38247,
-38322,
-38347,
-38323,
-38278,
-38164,
-38076,
-37917,
-37774,
-37584,
-37392,
-37160,
-36946,
-36678,
-36420,
-36102,
-35782,
-35406,
-35012,
-34609,
-34174,
-33795,
-33373,
-33066,
-32728,
-32521,
-32286,
-32145,
-31986,
-31853,
-31727,
-31599,
-31486,
-31374,
-31295,
-31175,
-31097,
-30950,
-30852,
-30706,
-30615,
-30454,
-30303,
-30069,
-29785,
-29481,
-29162,
-28887,
-28620,
-28405,
-28185,
-27997,
-27824,
-27666,
-27553,
-27421,
-27352,
-27265,
-27253,
-27272,
-27325,
-27413,
-27488,
-27580,
-27653,
-27771,
-27875,
-28013,
-28125,
-28282,
-28411,
-28582,
-28769,
-28971,
-29196,
-29432,
-29645,
-29890,
-30130,
-30377,
-30656,
-30926,
-31221,
-31528,
-31812,
-32134,
-32427,
-32733,
-33021,
-33281,
-33517,
-33738,
-33930,
-34140,
-34371,
-34635,
-34951,
-35266,
-35629,
-35987,
-36383,
-36791,
-37222,
-37592,
-38007,
-38298,
-38623,
-38833,
-39069,
-39208,
-39381,
-39439,
-39561,
-39575,
-39659,
-39688,
-39785,
-39868,
-40013,
-40148,
-40308,
-40384,
-40466,
-40469,
-40501,
-40493,
-40520,
-40517,
-40496,
-40449,
-40377,
-40283,
-40181,
-40075,
-39968,
-39856,
-39758,
-39629,
-39516,
-39357,
-39180,
-39015,
-38806,
-38624,
-38422,
-38196,
-37971,
-37713,
-37454,
-37220,
-36945,
-36715,
-36407,
-36147,
-35866,
-35614,
-35373,
-35149,
-34921,
-34698,
-34491,
-34296,
-34126,
-33969,
-33799,
-33581,
-33333,
-32988,
-32610,
-32194,
-31731,
-31319,
-30868,
-30457,
-30060,
-29625,
-29241,
-28815,
-28447,
-28083,
-27751,
-27428,
-27109,
-26816,
-26543,
-26319,
-26134,
-26011,
-25906,
-25845,
-25804,
-25767,
-25740,
-25729,
-25682,
-25641,
-25591,
-25503,
-25416,
-25271,
-25090,
-24904,
-24655,
-24465,
-24214,
-24047,
-23843,
-23709,
-23595,
-23526,
-23504,
-23531,
-23587,
-23676,
-23781,
-23900,
-24036,
-24163,
-24295,
-24392,
-24467,
-24516,
-24544,
-24558,
-24566,
-24538,
-24492,
-24432,
-24354,
-24305,
-24242,
-24211,
-24139,
-24071,
-23962,
-23864,
-23780,
-23712,
-23718,
-23745,
-23904,
-24138,
-24527,
-25050,
-25737,
-26552,
-27472,
-28463,
-29424,
-30303,
-31051,
-31605,
-32021,
-32281,
-32419,
-32405,
-32287,
-32040,
-31798,
-31550,
-31384,
-31251,
-31173,
-31090,
-31061,
-31094,
-31220,
-31466,
-31778,
-32176,
-32604,
-33117,
-33667,
-34231,
-34787,
-35308,
-35798,
-36320,
-36860,
-37464,
-38104,
-38773,
-39423,
-40065,
-40619,
-41099,
-41413,
-41596,
-41629,
-41576,
-41477,
-41331,
-41186,
-41001,
-40793,
-40565,
-40336,
-40061,
-39757,
-39437,
-39084,
-38828,
-38626,
-38605,
-38741,
-39078,
-39568,
-40198,
-40908,
-41599,
-42264,
-42776,
-43187,
-43448,
-43560,
-43528,
-43353,
-43005,
-42585,
-42043,
-41510,
-40907,
-40329,
-39709,
-39127,
-38559,
-38064,
-37595,
-37179,
-36754,
-36383,
-35996,
-35645,
-35241,
-34808,
-34364,
-33882,
-33478,
-33118,
-32795,
-32526,
-32242,
-31980,
-31739,
-31522,
-31310,
-31101,
-30822,
-30565,
-30247,
-29985,
-29696,
-29398,
-29048,
-28610,
-28104,
-27506,
-26831,
-26112,
-25319,
-24559,
-23834,
-23198,
-22732,
-22388,
-22224,
-22178,
-22261,
-22439,
-22697,
-23028,
-23363,
-23729,
-24043,
-24373,
-24619,
-24887,
-25051,
-25241,
-25314,
-25379,
-25355,
-25336,
-25283,
-25250,
-25244,
-25278,
-25336,
-25419,
-25567,
-25708,
-25928,
-26114,
-26328,
-26516,
-26700,
-26930,
-27181,
-27524,
-27910,
-28340,
-28811,
-29314,
-29860,
-30435,
-31063,
-31661,
-32277,
-32855,
-33468,
-34065,
-34701,
-35314,
-35901,
-36456,
-36940,
-37380,
-37703,
-37965,
-38115,
-38218,
-38298,
-38364,
-38470,
-38587,
-38732,
-38915,
-39101,
-39356,
-39605,
-39901,
-40211,
-40518,
-40856,
-41175,
-41505,
-41808,
-42072,
-42294,
-42467,
-42561,
-42607,
-42579,
-42522,
-42430,
-42334,
-42261,
-42158,
-42083,
-41955,
-41827,
-41690,
-41531,
-41390,
-41214,
-41027,
-40814,
-40572,
-40341,
-40087,
-39829,
-39577,
-39297,
-39050,
-38747,
-38459,
-38114,
-37762,
-37416,
-37062,
-36786,
-36494,
-36243,
-35962,
-35662,
-35362,
-35024,
-34696,
-34336,
-33922,
-33514,
-33034,
-32587,
-32117,
-31673,
-31263,
-30869,
-30536,
-30205,
-29949,
-29703,
-29511,
-29326,
-29206,
-29098,
-29058,
-29038,
-29049,
-29099,
-29109,
-29147,
-29138,
-29109,
-29067,
-28976,
-28896,
-28767,
-28680,
-28566,
-28487,
-28427,
-28366,
-28355,
-28323,
-28377,
-28417,
-28528,
-28638,
-28765,
-28914,
-29049,
-29227,
-29389,
-29589,
-29770,
-29992,
-30180,
-30419,
-30659,
-30914,
-31203,
-31476,
-31793,
-32106,
-32412,
-32762,
-33059,
-33420,
-33744,
-34065,
-34325,
-34543,
-34701,
-34844,
-35012,
-35152,
-35336,
-35470,
-35602,
-35746,
-35942,
-36179,
-36494,
-36810,
-37127,
-37414,
-37664,
-37900,
-38100,
-38277,
-38408,
-38493,
-38526,
-38507,
-38468,
-38361,
-38273,
-38147,
-38097,
-38020,
-37996,
-37897,
-37805,
-37671,
-37527,
-37455,
-37308,
-37234,
-37050,
-36919,
-36736,
-36612,
-36524,
-36477,
-36454,
-36436,
-36416,
-36374,
-36327,
-36243,
-36111,
-35970,
-35787,
-35608,
-35403,
-35204,
-35001,
-34832,
-34637,
-34478,
-34273,
-34029,
-33748,
-33398,
-33043,
-32676,
-32295,
-31921,
-31519,
-31169,
-30856,
-30628,
-30443,
-30335,
-30210,
-30131,
-29999,
-29909,
-29780,
-29676,
-29513,
-29372,
-29161,
-28969,
-28736,
-28489,
-28240,
-27957,
-27718,
-27405,
-27172,
-26868,
-26612,
-26350,
-26127,
-25934,
-25838,
-25739,
-25764,
-25767,
-25866,
-25934,
-26062,
-26152,
-26277,
-26345,
-26409,
-26421,
-26373,
-26297,
-26160,
-26037,
-25908,
-25840,
-25796,
-25795,
-25862,
-25926,
-26078,
-26244,
-26429,
-26666,
-26842,
-27045,
-27180,
-27277,
-27357,
-27360,
-27402,
-27355,
-27347,
-27259,
-27142,
-26965,
-26776,
-26579,
-26487,
-26445,
-26515,
-26630,
-26708,
-26775,
-26756,
-26727,
-26722,
-26732,
-26819,
-26892,
-26945,
-27008,
-27051,
-27254,
-27596,
-28183,
-28965,
-29859,
-30760,
-31597,
-32216,
-32697,
-32901,
-32952,
-32793,
-32472,
-32024,
-31493,
-30919,
-30418,
-29938,
-29613,
-29351,
-29202,
-29123,
-29120,
-29205,
-29379,
-29678,
-30098,
-30618,
-31255,
-31896,
-32562,
-33156,
-33668,
-34088,
-34431,
-34760,
-35082,
-35496,
-35908,
-36434,
-36885,
-37291,
-37568,
-37647,
-37619,
-37412,
-37169,
-36848,
-36553,
-36268,
-36054,
-35858,
-35771,
-35670,
-35624,
-35564,
-35467,
-35408,
-35331,
-35391,
-35552,
-35904,
-36445,
-37130,
-37942,
-38755,
-39554,
-40200,
-40704,
-41043,
-41197,
-41259,
-41161,
-40982,
-40711,
-40339,
-39921,
-39414,
-38881,
-38374,
-37823,
-37390,
-36965,
-36637,
-36415,
-36231,
-36210,
-36197,
-36271,
-36317,
-36327,
-36296,
-36190,
-36059,
-35922,
-35778,
-35650,
-35509,
-35350,
-35204,
-35006,
-34799,
-34569,
-34277,
-34014,
-33684,
-33359,
-33029,
-32671,
-32322,
-31945,
-31527,
-31067,
-30570,
-30020,
-29477,
-28938,
-28486,
-28102,
-27859,
-27756,
-27783,
-27972,
-28232,
-28566,
-28908,
-29204,
-29465,
-29620,
-29754,
-29796,
-29850,
-29834,
-29800,
-29730,
-29571,
-29411,
-29142,
-28913,
-28622,
-28415,
-28231,
-28209,
-28249,
-28451,
-28690,
-29010,
-29334,
-29616,
-29890,
-30089,
-30254,
-30363,
-30481,
-30581,
-30752,
-30979,
-31300,
-31712,
-32167,
-32652,
-33119,
-33539,
-33959,
-34286,
-34658,
-34914,
-35239,
-35450,
-35655,
-35821,
-35932,
-36020,
-36094,
-36111,
-36170,
-36184,
-36245,
-36338,
-36439,
-36645,
-36850,
-37167,
-37495,
-37887,
-38250,
-38615,
-38917,
-39171,
-39389,
-39553,
-39657,
-39721,
-39702,
-39636,
-39549,
-39409,
-39292,
-39136,
-39005,
-38881,
-38791,
-38744,
-38725,
-38736,
-38746,
-38781,
-38787,
-38807,
-38756,
-38707,
-38543,
-38404,
-38178,
-37993,
-37779,
-37564,
-37338,
-37096,
-36864,
-36643,
-36428,
-36242,
-36044,
-35843,
-35653,
-35447,
-35222,
-34986,
-34677,
-34374,
-34026,
-33649,
-33304,
-32906,
-32535,
-32145,
-31801,
-31485,
-31243,
-31051,
-30925,
-30805,
-30725,
-30626,
-30542,
-30455,
-30350,
-30225,
-30084,
-29887,
-29695,
-29447,
-29253,
-28999,
-28841,
-28594,
-28423,
-28230,
-28041,
-27928,
-27796,
-27762,
-27750,
-27784,
-27851,
-27925,
-27990,
-28079,
-28129,
-28207,
-28243,
-28276,
-28286,
-28263,
-28237,
-28222,
-28204,
-28246,
-28286,
-28375,
-28460,
-28564,
-28683,
-28803,
-28959,
-29099,
-29240,
-29404,
-29523,
-29701,
-29826,
-30009,
-30142,
-30286,
-30391,
-30512,
-30663,
-30843,
-31067,
-31300,
-31540,
-31810,
-32108,
-32460,
-32875,
-33268,
-33708,
-34053,
-34402,
-34664,
-34897,
-35065,
-35164,
-35243,
-35238,
-35265,
-35222,
-35218,
-35238,
-35271,
-35415,
-35562,
-35808,
-36042,
-36312,
-36572,
-36812,
-37037,
-37244,
-37375,
-37497,
-37522,
-37545,
-37509,
-37518,
-37503,
-37545,
-37589,
-37669,
-37751,
-37848,
-37929,
-37998,
-38085,
-38120,
-38181,
-38177,
-38170,
-38119,
-38033,
-37959,
-37854,
-37764,
-37671,
-37597,
-37501,
-37434,
-37396,
-37349,
-37394,
-37372,
-37378,
-37340,
-37258,
-37139,
-36994,
-36798,
-36597,
-36326,
-36052,
-35728,
-35423,
-35096,
-34801,
-34475,
-34181,
-33870,
-33628,
-33405,
-33237,
-33099,
-32978,
-32863,
-32764,
-32652,
-32525,
-32403,
-32216,
-32028,
-31817,
-31589,
-31395,
-31173,
-30986,
-30793,
-30668,
-30574,
-30527,
-30518,
-30500,
-30468,
-30377,
-30251,
-30082,
-29877,
-29657,
-29388,
-29103,
-28778,
-28441,
-28123,
-27853,
-27641,
-27522,
-27456,
-27450,
-27484,
-27542,
-27633,
-27749,
-27854,
-27950,
-27985,
-27984,
-27916,
-27826,
-27706,
-27551,
-27353,
-27141,
-26885,
-26703,
-26512,
-26439,
-26379,
-26375,
-26398,
-26462,
-26543,
-26697,
-26822,
-26989,
-27077,
-27110,
-27051,
-26946,
-26761,
-26590,
-26357,
-26155,
-25912,
-25698,
-25479,
-25294,
-25144,
-25019,
-24935,
-24840,
-24730,
-24620,
-24499,
-24396,
-24343,
-24338,
-24426,
-24577,
-24832,
-25177,
-25592,
-26117,
-26624,
-27216,
-27719,
-28252,
-28699,
-29102,
-29427,
-29643,
-29747,
-29736,
-29653,
-29533,
-29401,
-29263,
-29133,
-28943,
-28772,
-28599,
-28490,
-28476,
-28517,
-28613,
-28749,
-28903,
-29144,
-29441,
-29784,
-30198,
-30597,
-31043,
-31526,
-32043,
-32632,
-33215,
-33828,
-34394,
-34959,
-35478,
-35966,
-36368,
-36675,
-36853,
-36950,
-36975,
-36926,
-36878,
-36767,
-36671,
-36535,
-36430,
-36275,
-36208,
-36093,
-36128,
-36182,
-36351,
-36580,
-36867,
-37190,
-37572,
-37963,
-38394,
-38828,
-39195,
-39543,
-39754,
-39929,
-40011,
-40032,
-40008,
-39903,
-39807,
-39621,
-39484,
-39273,
-39136,
-38964,
-38848,
-38754,
-38653,
-38557,
-38433,
-38237,
-38079,
-37861,
-37703,
-37531,
-37384,
-37233,
-37088,
-36988,
-36881,
-36856,
-36798,
-36794,
-36754,
-36726,
-36694,
-36647,
-36577,
-36451,
-36290,
-36061,
-35802,
-35490,
-35105,
-34711,
-34225,
-33764,
-33284,
-32850,
-32455,
-32140,
-31887,
-31714,
-31623,
-31582,
-31626,
-31689,
-31791,
-31884,
-31966,
-32019,
-32049,
-32029,
-31994,
-31916,
-31826,
-31720,
-31592,
-31486,
-31353,
-31268,
-31183,
-31135,
-31094,
-31080,
-31067,
-31100,
-31111,
-31148,
-31175,
-31173,
-31182,
-31149,
-31139,
-31103,
-31093,
-31090,
-31105,
-31187,
-31288,
-31453,
-31667,
-31899,
-32188,
-32471,
-32758,
-33027,
-33255,
-33425,
-33563,
-33625,
-33647,
-33636,
-33565,
-33519,
-33445,
-33403,
-33392,
-33404,
-33454,
-33539,
-33633,
-33775,
-33932,
-34101,
-34265,
-34406,
-34537,
-34620,
-34704,
-34752,
-34808,
-34828,
-34866,
-34871,
-34901,
-34900,
-34929,
-34955,
-34967,
-35022,
-35020,
-35061,
-35044,
-35041,
-35029,
-35032,
-35018,
-34979,
-34933,
-34809,
-34714,
-34575,
-34485,
-34388,
-34297,
-34205,
-34121,
-34054,
-34025,
-34007,
-33994,
-33980,
-33934,
-33917,
-33874,
-33863,
-33822,
-33772,
-33691,
-33598,
-33486,
-33389,
-33291,
-33188,
-33130,
-33061,
-33037,
-33017,
-33002,
-32971,
-32935,
-32863,
-32795,
-32719,
-32644,
-32601,
-32539,
-32537,
-32477,
-32498,
-32483,
-32508,
-32532,
-32553,
-32579,
-32614,
-32647,
-32678,
-32714,
-32703,
-32709,
-32654,
-32622,
-32558,
-32523,
-32488,
-32462,
-32385,
-32351,
-32248,
-32231,
-32193,
-32209,
-32264,
-32282,
-32341,
-32380,
-32418,
-32488,
-32511,
-32553,
-32544,
-32535,
-32523,
-32525,
-32543,
-32561,
-32592,
-32649,
-32728,
-32905,
-33121,
-33402,
-33659,
-33837,
-33932,
-33913,
-33849,
-33777,
-33739,
-33738,
-33745,
-33714,
-33590,
-33438,
-33261,
-33209,
-33267,
-33456,
-33656,
-33788,
-33781,
-33677,
-33522,
-33506,
-33554,
-33790,
-34009,
-34220,
-34307,
-34336,
-34314,
-34354,
-34420,
-34560,
-34693,
-34826,
-34899,
-34983,
-35021,
-35126,
-35175,
-35270,
-35263,
-35254,
-35144,
-35041,
-34900,
-34794,
-34714,
-34695,
-34708,
-34744,
-34741,
-34726,
-34692,
-34647,
-34621,
-34594,
-34582,
-34550,
-34558,
-34526,
-34584,
-34609,
-34699,
-34762,
-34826,
-34915,
-34946,
-34991,
-34938,
-34871,
-34737,
-34620,
-34467,
-34355,
-34197,
-34052,
-33878,
-33679,
-33477,
-33226,
-32988,
-32726,
-32494,
-32327,
-32184,
-32114,
-32037,
-31965,
-31917,
-31886,
-31876,
-31897,
-31857,
-31809,
-31648,
-31489,
-31268,
-31055,
-30835,
-30603,
-30397,
-30212,
-30053,
-29921,
-29805,
-29681,
-29569,
-29465,
-29344,
-29236,
-29068,
-28908,
-28698,
-28516,
-28354,
-28210,
-28084,
-27931,
-27804,
-27644,
-27525,
-27378,
-27259,
-27153,
-27069,
-27064,
-27071,
-27151,
-27213,
-27280,
-27303,
-27281,
-27213,
-27091,
-26918,
-26706,
-26480,
-26274,
-26131,
-26002,
-25943,
-25865,
-25827,
-25785,
-25791,
-25829,
-25883,
-25958,
-26018,
-26079,
-26103,
-26128,
-26122,
-26143,
-26137,
-26166,
-26182,
-26179,
-26155,
-26085,
-26005,
-25947,
-25893,
-25879,
-25881,
-25869,
-25874,
-25899,
-25940,
-26085,
-26216,
-26394,
-26553,
-26677,
-26831,
-27003,
-27263,
-27654,
-28106,
-28627,
-29103,
-29491,
-29762,
-29900,
-30000,
-30022,
-30131,
-30188,
-30303,
-30395,
-30437,
-30504,
-30509,
-30551,
-30575,
-30639,
-30713,
-30826,
-30992,
-31159,
-31386,
-31581,
-31828,
-32032,
-32301,
-32525,
-32823,
-33118,
-33462,
-33873,
-34302,
-34785,
-35264,
-35723,
-36154,
-36544,
-36895,
-37226,
-37492,
-37731,
-37872,
-37952,
-37987,
-37970,
-37978,
-37966,
-37990,
-37986,
-37986,
-37970,
-37951,
-37968,
-37997,
-38107,
-38266,
-38475,
-38740,
-39010,
-39291,
-39527,
-39737,
-39883,
-40019,
-40109,
-40200,
-40271,
-40321,
-40377,
-40383,
-40387,
-40356,
-40309,
-40220,
-40136,
-40004,
-39918,
-39818,
-39728,
-39622,
-39484,
-39301,
-39104,
-38855,
-38668,
-38478,
-38384,
-38270,
-38198,
-38058,
-37899,
-37680,
-37498,
-37321,
-37235,
-37188,
-37173,
-37126,
-37056,
-36860,
-36640,
-36323,
-35977,
-35609,
-35228,
-34877,
-34528,
-34178,
-33812,
-33429,
-33016,
-32659,
-32293,
-32061,
-31875,
-31737,
-31657,
-31521,
-31423,
-31233,
-31098,
-30892,
-30775,
-30611,
-30514,
-30426,
-30336,
-30255,
-30161,
-30055,
-29943,
-29865,
-29793,
-29781,
-29802,
-29816,
-29847,
-29851,
-29847,
-29857,
-29845,
-29850,
-29848,
-29826,
-29826,
-29800,
-29794,
-29772,
-29791,
-29792,
-29858,
-29948,
-30091,
-30274,
-30478,
-30671,
-30862,
-31012,
-31149,
-31250,
-31365,
-31459,
-31601,
-31718,
-31855,
-31991,
-32068,
-32169,
-32240,
-32330,
-32466,
-32636,
-32835,
-33072,
-33250,
-33453,
-33596,
-33772,
-33908,
-34056,
-34172,
-34267,
-34353,
-34419,
-34499,
-34583,
-34669,
-34772,
-34872,
-35005,
-35177,
-35365,
-35546,
-35713,
-35816,
-35868,
-35900,
-35897,
-35903,
-35894,
-35862,
-35827,
-35725,
-35679,
-35532,
-35503,
-35389,
-35338,
-35244,
-35170,
-35051,
-34983,
-34870,
-34815,
-34729,
-34667,
-34602,
-34561,
-34507,
-34459,
-34381,
-34303,
-34218,
-34137,
-34089,
-34040,
-34027,
-34019,
-34002,
-33960,
-33880,
-33770,
-33595,
-33401,
-33141,
-32901,
-32616,
-32373,
-32094,
-31892,
-31626,
-31462,
-31227,
-31072,
-30903,
-30767,
-30666,
-30584,
-30533,
-30496,
-30481,
-30487,
-30527,
-30565,
-30653,
-30716,
-30787,
-30855,
-30895,
-30939,
-30991,
-30993,
-31037,
-31023,
-31027,
-31040,
-31038,
-31089,
-31118,
-31162,
-31138,
-31144,
-31044,
-31030,
-30966,
-30968,
-30983,
-31021,
-31071,
-31134,
-31204,
-31289,
-31388,
-31514,
-31652,
-31816,
-31984,
-32158,
-32337,
-32487,
-32653,
-32797,
-32951,
-33128,
-33251,
-33392,
-33483,
-33561,
-33631,
-33678,
-33723,
-33741,
-33739,
-33739,
-33717,
-33740,
-33754,
-33809,
-33853,
-33908,
-33945,
-33966,
-34003,
-34039,
-34122,
-34229,
-34346,
-34473,
-34587,
-34699,
-34867,
-34998,
-35211,
-35360,
-35530,
-35598,
-35646,
-35592,
-35569,
-35485,
-35447,
-35400,
-35370,
-35366,
-35331,
-35312,
-35211,
-35137,
-34986,
-34900,
-34779,
-34783,
-34760,
-34824,
-34830,
-34827,
-34793,
-34759,
-34721,
-34728,
-34717,
-34739,
-34720,
-34708,
-34657,
-34620,
-34539,
-34472,
-34375,
-34231,
-34106,
-33925,
-33781,
-33597,
-33420,
-33210,
-32994,
-32773,
-32585,
-32393,
-32244,
-32097,
-31944,
-31841,
-31735,
-31689,
-31654,
-31636,
-31593,
-31559,
-31543,
-31545,
-31604,
-31557,
-31519,
-31306,
-31129,
-30922,
-30818,
-30766,
-30740,
-30686,
-30595,
-30479,
-30350,
-30233,
-30131,
-30049,
-29998,
-30002,
-30048,
-30099,
-30098,
-29989,
-29818,
-29620,
-29504,
-29523,
-29683,
-29903,
-30148,
-30248,
-30288,
-30189,
-30082,
-30008,
-30061,
-30189,
-30445,
-30644,
-30845,
-30946,
-30956,
-30943,
-30875,
-30808,
-30757,
-30770,
-30840,
-31050,
-31274,
-31517,
-31665,
-31713,
-31715,
-31700,
-31776,
-31886,
-32053,
-32241,
-32435,
-32601,
-32693,
-32610,
-32390,
-32098,
-31932,
-32047,
-32432,
-32932,
-33279,
-33280,
-32935,
-32421,
-32015,
-31907,
-32160,
-32648,
-33205,
-33647,
-33869,
-33826,
-33553,
-33163,
-32766,
-32563,
-32626,
-33014,
-33578,
-34107,
-34360,
-34162,
-33607,
-32883,
-32363,
-32244,
-32640,
-33258,
-33817,
-33933,
-33539,
-32769,
-32018,
-31611,
-31764,
-32305,
-33016,
-33468,
-33499,
-33101,
-32415,
-31783,
-31359,
-31393,
-31789,
-32493,
-33189,
-33645,
-33665,
-33218,
-32500,
-31772,
-31375,
-31414,
-31918,
-32578,
-33148,
-33311,
-32971,
-32265,
-31401,
-30742,
-30464,
-30673,
-31189,
-31772,
-32110,
-31993,
-31456,
-30631,
-29876,
-29423,
-29451,
-29886,
-30466,
-30990,
-31194,
-31110,
-30824,
-30514,
-30306,
-30286,
-30412,
-30619,
-30860,
-30983,
-31006,
-30822,
-30528,
-30184,
-29980,
-29954,
-30201,
-30510,
-30818,
-30884,
-30690,
-30358,
-29984,
-29890,
-30029,
-30472,
-30943,
-31313,
-31400,
-31184,
-30799,
-30389,
-30155,
-30154,
-30450,
-30882,
-31402,
-31768,
-31981,
-31934,
-31723,
-31465,
-31297,
-31326,
-31607,
-31987,
-32475,
-32746,
-32879,
-32739,
-32486,
-32253,
-32110,
-32176,
-32376,
-32649,
-32919,
-33068,
-33189,
-33218,
-33302,
-33440,
-33653,
-33907,
-34175,
-34397,
-34549,
-34643,
-34657,
-34643,
-34637,
-34644,
-34699,
-34782,
-34875,
-34936,
-34959,
-34913,
-34860,
-34797,
-34811,
-34878,
-35014,
-35149,
-35228,
-35258,
-35145,
-35063,
-34927,
-34935,
-34954,
-35058,
-35112,
-35121,
-35065,
-35005,
-34988,
-35013,
-35120,
-35267,
-35386,
-35554,
-35606,
-35700,
-35693,
-35687,
-35619,
-35546,
-35461,
-35381,
-35322,
-35243,
-35161,
-35000,
-34821,
-34547,
-34324,
-34130,
-34076,
-34119,
-34219,
-34301,
-34296,
-34183,
-34052,
-33913,
-33877,
-33903,
-33951,
-33987,
-33990,
-33960,
-33941,
-33889,
-33839,
-33714,
-33606,
-33487,
-33485,
-33562,
-33723,
-33897,
-33969,
-33917,
-33711,
-33446,
-33172,
-33047,
-33000,
-33126,
-33217,
-33281,
-33194,
-33025,
-32773,
-32575,
-32454,
-32421,
-32492,
-32544,
-32652,
-32689,
-32736,
-32717,
-32676,
-32564,
-32500,
-32453,
-32522,
-32676,
-32828,
-32981,
-33010,
-32942,
-32802,
-32634,
-32538,
-32527,
-32600,
-32767,
-32929,
-33138,
-33296,
-33419,
-33410,
-33324,
-33143,
-32999,
-32935,
-32986,
-33150,
-33344,
-33531,
-33674,
-33741,
-33754,
-33707,
-33604,
-33516,
-33468,
-33569,
-33767,
-34058,
-34297,
-34437,
-34463,
-34420,
-34335,
-34301,
-34228,
-34263,
-34248,
-34355,
-34484,
-34639,
-34777,
-34824,
-34814,
-34736,
-34646,
-34577,
-34542,
-34591,
-34684,
-34854,
-34979,
-35029,
-34932,
-34701,
-34447,
-34297,
-34276,
-34488,
-34703,
-34985,
-35138,
-35202,
-35153,
-34972,
-34741,
-34435,
-34216,
-34122,
-34171,
-34357,
-34486,
-34518,
-34313,
-33948,
-33496,
-33113,
-32860,
-32806,
-32887,
-33042,
-33197,
-33285,
-33280,
-33138,
-32916,
-32625,
-32399,
-32281,
-32351,
-32529,
-32758,
-32873,
-32817,
-32578,
-32272,
-31977,
-31834,
-31813,
-31891,
-32001,
-32064,
-32088,
-32038,
-31921,
-31769,
-31527,
-31302,
-31093,
-30963,
-30979,
-31032,
-31139,
-31156,
-31115,
-31012,
-30947,
-30928,
-30998,
-31072,
-31148,
-31211,
-31261,
-31395,
-31497,
-31620,
-31649,
-31624,
-31561,
-31520,
-31508,
-31581,
-31656,
-31773,
-31833,
-31852,
-31826,
-31721,
-31643,
-31582,
-31668,
-31804,
-32000,
-32158,
-32240,
-32265,
-32238,
-32185,
-32150,
-32100,
-32132,
-32227,
-32460,
-32765,
-33080,
-33227,
-33205,
-32984,
-32734,
-32567,
-32596,
-32799,
-33086,
-33345,
-33486,
-33470,
-33361,
-33179,
-33022,
-32956,
-32959,
-33081,
-33248,
-33394,
-33513,
-33488,
-33366,
-33109,
-32899,
-32733,
-32836,
-33090,
-33525,
-33816,
-33892,
-33614,
-33128,
-32691,
-32502,
-32740,
-33240,
-33798,
-34089,
-34013,
-33619,
-33061,
-32603,
-32354,
-32361,
-32524,
-32761,
-32904,
-32973,
-32845,
-32620,
-32232,
-31868,
-31516,
-31405,
-31494,
-31800,
-32099,
-32236,
-32032,
-31471,
-30761,
-30113,
-29817,
-29999,
-30532,
-31198,
-31579,
-31462,
-30829,
-29855,
-29022,
-28669,
-29003,
-29866,
-30850,
-31448,
-31365,
-30598,
-29474,
-28456,
-27957,
-28071,
-28718,
-29459,
-29998,
-30014,
-29552,
-28740,
-27950,
-27421,
-27416,
-27902,
-28708,
-29499,
-29913,
-29784,
-29076,
-28191,
-27484,
-27403,
-27986,
-28996,
-29956,
-30449,
-30260,
-29594,
-28775,
-28281,
-28305,
-28790,
-29537,
-30134,
-30398,
-30237,
-29808,
-29410,
-29253,
-29457,
-29848,
-30255,
-30446,
-30407,
-30321,
-30343,
-30551,
-30886,
-31128,
-31285,
-31310,
-31447,
-31722,
-32122,
-32487,
-32597,
-32508,
-32256,
-32138,
-32302,
-32757,
-33470,
-34116,
-34538,
-34510,
-34075,
-33430,
-33026,
-33096,
-33851,
-34836,
-35702,
-35831,
-35308,
-34384,
-33758,
-33759,
-34500,
-35424,
-36100,
-36117,
-35564,
-34914,
-34558,
-34810,
-35439,
-36142,
-36421,
-36212,
-35596,
-35087,
-34982,
-35484,
-36198,
-36678,
-36458,
-35595,
-34630,
-34206,
-34705,
-35753,
-36656,
-36644,
-35785,
-34630,
-34076,
-34531,
-35618,
-36507,
-36484,
-35501,
-34235,
-33475,
-33684,
-34622,
-35569,
-35870,
-35318,
-34241,
-33245,
-32873,
-33194,
-33938,
-34559,
-34654,
-34109,
-33259,
-32563,
-32445,
-32928,
-33647,
-34146,
-34000,
-33288,
-32382,
-31797,
-31904,
-32572,
-33469,
-34016,
-33943,
-33260,
-32381,
-31761,
-31693,
-32150,
-32766,
-33227,
-33221,
-32852,
-32281,
-31814,
-31598,
-31633,
-31847,
-32131,
-32369,
-32619,
-32774,
-32883,
-32898,
-32828,
-32742,
-32698,
-32728,
-32828,
-32958,
-33025,
-33128,
-33203,
-33381,
-33557,
-33608,
-33421,
-32955,
-32425,
-32100,
-32227,
-32719,
-33377,
-33769,
-33774,
-33403,
-33000,
-32765,
-32789,
-32955,
-33017,
-32964,
-32789,
-32709,
-32763,
-33000,
-33246,
-33420,
-33421,
-33254,
-32999,
-32756,
-32628,
-32673,
-32857,
-33075,
-33157,
-33049,
-32716,
-32341,
-32082,
-32117,
-32362,
-32702,
-32819,
-32594,
-32046,
-31455,
-31153,
-31326,
-31894,
-32531,
-32881,
-32797,
-32375,
-31892,
-31526,
-31354,
-31239,
-31223,
-31286,
-31550,
-31979,
-32353,
-32458,
-32170,
-31619,
-31121,
-30950,
-31153,
-31584,
-31996,
-32272,
-32330,
-32350,
-32247,
-32175,
-31992,
-31821,
-31677,
-31757,
-31988,
-32440,
-32856,
-33182,
-33258,
-33151,
-32900,
-32665,
-32508,
-32492,
-32665,
-32972,
-33406,
-33851,
-34194,
-34298,
-34096,
-33652,
-33116,
-32822,
-32951,
-33525,
-34364,
-35056,
-35294,
-35043,
-34519,
-34183,
-34260,
-34716,
-35216,
-35415,
-35283,
-35031,
-35099,
-35535,
-36197,
-36602,
-36492,
-35919,
-35295,
-35035,
-35327,
-35916,
-36419,
-36495,
-36191,
-35825,
-35707,
-35958,
-36348,
-36454,
-36200,
-35600,
-35303,
-35452,
-36145,
-36768,
-36937,
-36430,
-35695,
-35269,
-35508,
-36189,
-36754,
-36794,
-36244,
-35532,
-35119,
-35119,
-35499,
-35896,
-36245,
-36417,
-36479,
-36226,
-35710,
-35005,
-34459,
-34421,
-34887,
-35534,
-35951,
-35849,
-35479,
-35111,
-35054,
-35136,
-35158,
-34911,
-34581,
-34363,
-34447,
-34618,
-34640,
-34444,
-34155,
-34071,
-34160,
-34168,
-33767,
-33027,
-32323,
-32180,
-32578,
-33162,
-33295,
-32849,
-32178,
-31877,
-32121,
-32606,
-32664,
-32131,
-31300,
-30861,
-31087,
-31681,
-32025,
-31721,
-31078,
-30589,
-30601,
-30841,
-30833,
-30395,
-29801,
-29618,
-29931,
-30346,
-30265,
-29511,
-28628,
-28402,
-29020,
-30090,
-30542,
-30018,
-28756,
-27776,
-27756,
-28619,
-29642,
-29932,
-29435,
-28520,
-28073,
-28392,
-29242,
-30045,
-30205,
-29671,
-28761,
-28048,
-27924,
-28556,
-29657,
-30630,
-30927,
-30191,
-28738,
-27347,
-26942,
-27806,
-29529,
-30987,
-31297,
-30385,
-28956,
-28167,
-28485,
-29656,
-30727,
-30995,
-30459,
-29800,
-29788,
-30615,
-31821,
-32521,
-32239,
-31094,
-29884,
-29353,
-29989,
-31417,
-32944,
-33730,
-33352,
-32110,
-30654,
-29969,
-30397,
-31733,
-33131,
-33713,
-33214,
-32111,
-31359,
-31629,
-32766,
-33949,
-34233,
-33408,
-32106,
-31426,
-31996,
-33562,
-35104,
-35651,
-34927,
-33580,
-32579,
-32665,
-33701,
-35043,
-35835,
-35622,
-34679,
-33526,
-32962,
-33236,
-34153,
-35090,
-35344,
-34653,
-33342,
-32202,
-32057,
-33048,
-34655,
-35794,
-35724,
-34405,
-32673,
-31611,
-31873,
-33122,
-34530,
-35065,
-34545,
-33370,
-32403,
-32268,
-32866,
-33692,
-33981,
-33512,
-32514,
-31648,
-31514,
-32231,
-33398,
-34252,
-34110,
-32930,
-31204,
-29897,
-29770,
-30819,
-32481,
-33585,
-33579,
-32460,
-31066,
-30263,
-30353,
-30947,
-31358,
-31098,
-30444,
-30044,
-30367,
-31388,
-32366,
-32603,
-31800,
-30351,
-28994,
-28457,
-28854,
-30014,
-31225,
-32015,
-31975,
-31170,
-29975,
-28979,
-28667,
-29084,
-29882,
-30385,
-30324,
-29742,
-29332,
-29501,
-30318,
-31128,
-31219,
-30263,
-28714,
-27551,
-27546,
-28904,
-30850,
-32436,
-32763,
-31858,
-30204,
-28770,
-28107,
-28433,
-29319,
-30347,
-31084,
-31534,
-31789,
-32023,
-32121,
-31926,
-31249,
-30247,
-29293,
-29008,
-29698,
-31354,
-33386,
-34967,
-35424,
-34404,
-32425,
-30274,
-29168,
-29666,
-31682,
-34261,
-36117,
-36469,
-35327,
-33685,
-32537,
-32480,
-33222,
-34017,
-34298,
-34053,
-33759,
-33972,
-34677,
-35562,
-36062,
-35950,
-35347,
-34584,
-33945,
-33671,
-33821,
-34518,
-35608,
-36809,
-37584,
-37656,
-37021,
-36198,
-35599,
-35448,
-35447,
-35392,
-35250,
-35476,
-36329,
-37647,
-38646,
-38473,
-36989,
-34851,
-33339,
-33272,
-34671,
-36608,
-37992,
-38198,
-37348,
-36113,
-35095,
-34705,
-34887,
-35418,
-36000,
-36325,
-36245,
-35759,
-35203,
-34904,
-35154,
-35764,
-36318,
-36326,
-35708,
-34779,
-34068,
-33918,
-34279,
-34761,
-35016,
-34937,
-34676,
-34451,
-34341,
-34213,
-33960,
-33599,
-33295,
-33345,
-33790,
-34476,
-35057,
-35200,
-34802,
-34057,
-33300,
-32921,
-33074,
-33621,
-34324,
-34797,
-34898,
-34620,
-34107,
-33645,
-33295,
-33200,
-33235,
-33360,
-33423,
-33473,
-33503,
-33685,
-34000,
-34378,
-34513,
-34266,
-33524,
-32715,
-32232,
-32500,
-33478,
-34696,
-35551,
-35619,
-34920,
-33963,
-33301,
-33299,
-33820,
-34382,
-34586,
-34325,
-34054,
-34207,
-34973,
-35886,
-36186,
-35427,
-33944,
-32621,
-32370,
-33295,
-34674,
-35496,
-35371,
-34638,
-34209,
-34518,
-35227,
-35516,
-34882,
-33619,
-32681,
-32863,
-34134,
-35747,
-36642,
-36313,
-35030,
-33501,
-32469,
-32323,
-32966,
-34118,
-35181,
-35710,
-35334,
-34214,
-32939,
-32321,
-32707,
-33768,
-34586,
-34398,
-33211,
-31866,
-31335,
-32102,
-33499,
-34514,
-34298,
-32990,
-31430,
-30620,
-30881,
-31796,
-32598,
-32732,
-32284,
-31754,
-31547,
-31802,
-32029,
-31893,
-31152,
-30173,
-29481,
-29609,
-30514,
-31694,
-32460,
-32247,
-31224,
-29892,
-29118,
-29251,
-30178,
-31152,
-31540,
-31076,
-30174,
-29540,
-29621,
-30351,
-31019,
-31051,
-30254,
-29200,
-28701,
-29230,
-30588,
-31864,
-32230,
-31333,
-29759,
-28516,
-28456,
-29618,
-31308,
-32401,
-32286,
-30972,
-29456,
-28588,
-28994,
-30268,
-31570,
-32077,
-31540,
-30475,
-29740,
-29907,
-30934,
-32142,
-32738,
-32338,
-31261,
-30224,
-30012,
-30736,
-31996,
-32928,
-33070,
-32308,
-31361,
-30815,
-31142,
-31999,
-32822,
-33010,
-32465,
-31677,
-31267,
-31698,
-32769,
-33874,
-34232,
-33594,
-32226,
-30993,
-30668,
-31466,
-32958,
-34241,
-34596,
-33875,
-32646,
-31678,
-31686,
-32506,
-33637,
-34287,
-34080,
-33260,
-32519,
-32505,
-33356,
-34534,
-35118,
-34579,
-33023,
-31468,
-30875,
-31825,
-33671,
-35262,
-35420,
-34016,
-31895,
-30442,
-30485,
-31841,
-33492,
-34246,
-33718,
-32405,
-31309,
-31266,
-32172,
-33336,
-33860,
-33261,
-31978,
-30751,
-30514,
-31368,
-32936,
-34192,
-34410,
-33440,
-31816,
-30511,
-30218,
-31000,
-32205,
-33035,
-32955,
-32196,
-31403,
-31117,
-31431,
-31834,
-31766,
-31139,
-30351,
-30118,
-30666,
-31705,
-32469,
-32440,
-31674,
-30778,
-30375,
-30689,
-31359,
-31833,
-31753,
-31312,
-30894,
-30961,
-31455,
-32098,
-32373,
-32107,
-31418,
-30741,
-30508,
-30813,
-31451,
-31982,
-32049,
-31608,
-30972,
-30542,
-30591,
-31062,
-31612,
-31885,
-31753,
-31349,
-31015,
-30998,
-31277,
-31627,
-31768,
-31668,
-31432,
-31389,
-31547,
-31863,
-31939,
-31662,
-31051,
-30595,
-30646,
-31401,
-32453,
-33113,
-32872,
-31668,
-30214,
-29432,
-29862,
-31367,
-32917,
-33585,
-32866,
-31308,
-29882,
-29552,
-30443,
-31921,
-33055,
-33203,
-32531,
-31639,
-31298,
-31686,
-32472,
-32963,
-32693,
-31722,
-30705,
-30280,
-30918,
-32235,
-33539,
-33892,
-33081,
-31526,
-30261,
-30111,
-31222,
-32761,
-33689,
-33324,
-32024,
-30908,
-30944,
-32243,
-33916,
-34639,
-33882,
-32042,
-30501,
-30234,
-31474,
-33305,
-34592,
-34685,
-33780,
-32724,
-32208,
-32419,
-32947,
-33263,
-33156,
-32865,
-32894,
-33496,
-34511,
-35325,
-35381,
-34518,
-33205,
-32250,
-32296,
-33462,
-35074,
-36272,
-36411,
-35514,
-34371,
-33691,
-33978,
-34829,
-35566,
-35641,
-35133,
-34677,
-34887,
-35797,
-36812,
-37048,
-36235,
-34785,
-33741,
-33880,
-35196,
-36892,
-37871,
-37591,
-36338,
-35066,
-34627,
-35306,
-36430,
-37158,
-36911,
-35931,
-35096,
-35086,
-36065,
-37290,
-37833,
-37237,
-35806,
-34540,
-34178,
-34882,
-36017,
-36826,
-36818,
-36236,
-35580,
-35307,
-35476,
-35612,
-35511,
-35010,
-34568,
-34551,
-35158,
-35990,
-36462,
-36065,
-34874,
-33521,
-32781,
-33073,
-34179,
-35322,
-35826,
-35396,
-34402,
-33455,
-33009,
-33117,
-33457,
-33644,
-33495,
-33145,
-32898,
-32874,
-33177,
-33398,
-33437,
-33015,
-32337,
-31737,
-31570,
-31986,
-32746,
-33332,
-33299,
-32536,
-31478,
-30749,
-30845,
-31694,
-32698,
-33216,
-32887,
-32004,
-31149,
-30793,
-30998,
-31455,
-31753,
-31813,
-31719,
-31700,
-31730,
-31735,
-31594,
-31343,
-31140,
-31048,
-31083,
-31139,
-31319,
-31648,
-32161,
-32524,
-32338,
-31543,
-30446,
-29986,
-30559,
-32118,
-33638,
-34090,
-33118,
-31331,
-29952,
-29940,
-31237,
-33057,
-34200,
-34123,
-33060,
-31801,
-31138,
-31317,
-32015,
-32663,
-32863,
-32638,
-32393,
-32432,
-32905,
-33429,
-33608,
-33175,
-32318,
-31632,
-31593,
-32422,
-33719,
-34789,
-35071,
-34417,
-33216,
-32189,
-31894,
-32557,
-33745,
-34833,
-35094,
-34413,
-33176,
-32273,
-32398,
-33573,
-35089,
-35826,
-35238,
-33636,
-32186,
-31945,
-33123,
-34871,
-35875,
-35514,
-34078,
-32793,
-32488,
-33389,
-34626,
-35339,
-35066,
-34147,
-33252,
-32936,
-33275,
-34007,
-34794,
-35223,
-35111,
-34330,
-33230,
-32383,
-32487,
-33689,
-35336,
-36329,
-35822,
-34045,
-32100,
-31409,
-32342,
-34276,
-35702,
-35682,
-34311,
-32672,
-31939,
-32422,
-33583,
-34387,
-34280,
-33392,
-32451,
-32112,
-32620,
-33642,
-34572,
-34813,
-34110,
-32666,
-31151,
-30400,
-30949,
-32600,
-34369,
-35055,
-34097,
-31984,
-30143,
-29732,
-30948,
-32775,
-33835,
-33486,
-32228,
-31224,
-31236,
-32001,
-32600,
-32207,
-31006,
-29887,
-29719,
-30678,
-32129,
-33116,
-33183,
-32306,
-31035,
-29773,
-28984,
-28932,
-29848,
-31458,
-33121,
-33779,
-32929,
-30876,
-28811,
-27939,
-28673,
-30341,
-31714,
-32091,
-31520,
-30950,
-30906,
-31417,
-31743,
-31290,
-30096,
-28929,
-28674,
-29658,
-31398,
-32883,
-33342,
-32580,
-31106,
-29714,
-29112,
-29424,
-30463,
-31548,
-32186,
-32093,
-31509,
-31018,
-31070,
-31654,
-32171,
-31925,
-30806,
-29454,
-29083,
-30250,
-32551,
-34472,
-34748,
-33158,
-30888,
-29488,
-29789,
-31213,
-32473,
-32627,
-31920,
-31354,
-31810,
-33099,
-34149,
-33904,
-32212,
-30033,
-28737,
-29186,
-31166,
-33630,
-35365,
-35611,
-34393,
-32351,
-30373,
-29325,
-29545,
-30975,
-32943,
-34646,
-35379,
-34902,
-33494,
-31774,
-30388,
-29757,
-30032,
-31098,
-32616,
-34107,
-34968,
-34781,
-33581,
-31868,
-30512,
-30115,
-30778,
-31906,
-32834,
-33112,
-32966,
-32784,
-32892,
-33099,
-33036,
-32456,
-31564,
-30966,
-31081,
-31916,
-33032,
-33772,
-33841,
-33250,
-32387,
-31600,
-31139,
-31062,
-31252,
-31648,
-32023,
-32307,
-32461,
-32555,
-32637,
-32745,
-32608,
-32135,
-31242,
-30304,
-29868,
-30267,
-31519,
-32892,
-33743,
-33482,
-32296,
-30876,
-29962,
-30003,
-30807,
-31765,
-32353,
-32372,
-32109,
-31967,
-32171,
-32477,
-32467,
-31863,
-30765,
-29827,
-29644,
-30483,
-31980,
-33293,
-33675,
-32941,
-31501,
-30261,
-29824,
-30403,
-31431,
-32339,
-32625,
-32420,
-32084,
-31977,
-31926,
-31736,
-31096,
-30418,
-30287,
-31198,
-32925,
-34504,
-34911,
-33762,
-31753,
-30101,
-29799,
-30904,
-32572,
-33818,
-34078,
-33591,
-32993,
-32645,
-32663,
-32606,
-32370,
-32018,
-31984,
-32603,
-33708,
-34882,
-35365,
-34956,
-33834,
-32778,
-32411,
-32985,
-34103,
-34977,
-35187,
-34644,
-34011,
-33809,
-34358,
-35254,
-35865,
-35712,
-34794,
-33744,
-33180,
-33576,
-34721,
-36050,
-36832,
-36748,
-35879,
-34795,
-34044,
-33966,
-34493,
-35291,
-35973,
-36376,
-36480,
-36395,
-36234,
-35887,
-35461,
-34964,
-34674,
-34789,
-35313,
-35980,
-36415,
-36281,
-35726,
-35078,
-34755,
-34896,
-35196,
-35349,
-35149,
-34809,
-34698,
-35031,
-35573,
-35913,
-35636,
-34807,
-33947,
-33574,
-34019,
-34956,
-35787,
-35934,
-35245,
-34132,
-33191,
-32916,
-33374,
-34147,
-34757,
-34850,
-34491,
-34039,
-33803,
-33882,
-33954,
-33683,
-32921,
-31983,
-31530,
-31999,
-33402,
-34965,
-35765,
-35175,
-33486,
-31627,
-30677,
-31060,
-32370,
-33664,
-34169,
-33820,
-33069,
-32507,
-32349,
-32331,
-32159,
-31688,
-31209,
-31034,
-31377,
-32069,
-32854,
-33409,
-33551,
-33152,
-32277,
-31105,
-30199,
-30017,
-30769,
-32081,
-33182,
-33464,
-32886,
-32016,
-31460,
-31425,
-31500,
-31251,
-30725,
-30475,
-31135,
-32544,
-33849,
-34002,
-32704,
-30806,
-29562,
-29795,
-31183,
-32626,
-33289,
-32998,
-32454,
-32207,
-32306,
-32371,
-32066,
-31658,
-31571,
-32143,
-32881,
-33351,
-33122,
-32683,
-32520,
-32851,
-33288,
-33163,
-32505,
-31848,
-31982,
-33024,
-34134,
-34440,
-33593,
-32395,
-31950,
-32614,
-33769,
-34268,
-33626,
-32540,
-32144,
-32972,
-34485,
-35311,
-34895,
-33552,
-32589,
-32761,
-33842,
-34832,
-34910,
-34237,
-33560,
-33548,
-34073,
-34482,
-34350,
-33859,
-33590,
-33862,
-34348,
-34476,
-34022,
-33496,
-33474,
-34247,
-35070,
-35244,
-34441,
-33355,
-32900,
-33495,
-34564,
-35091,
-34642,
-33553,
-32897,
-33115,
-33942,
-34486,
-34169,
-33355,
-32840,
-33188,
-34114,
-34726,
-34397,
-33328,
-32313,
-32137,
-32801,
-33662,
-34006,
-33592,
-32809,
-32317,
-32319,
-32816,
-33263,
-33480,
-33332,
-32955,
-32501,
-32071,
-31799,
-31863,
-32268,
-32924,
-33427,
-33496,
-32924,
-32003,
-31082,
-30612,
-30781,
-31400,
-32184,
-32737,
-32811,
-32446,
-31758,
-31053,
-30589,
-30448,
-30698,
-31153,
-31678,
-32032,
-32087,
-31810,
-31357,
-30965,
-30898,
-31113,
-31406,
-31402,
-31014,
-30505,
-30358,
-30948,
-32012,
-32976,
-33019,
-31941,
-30214,
-28807,
-28563,
-29686,
-31483,
-32976,
-33275,
-32341,
-30805,
-29603,
-29349,
-29966,
-30853,
-31423,
-31518,
-31478,
-31672,
-32105,
-32294,
-31861,
-30819,
-29877,
-29663,
-30403,
-31456,
-32089,
-32021,
-31633,
-31688,
-32272,
-32940,
-32789,
-31661,
-30222,
-29613,
-30408,
-32142,
-33604,
-33760,
-32606,
-31009,
-29984,
-30067,
-30901,
-31908,
-32611,
-32935,
-32979,
-32762,
-32233,
-31482,
-30790,
-30567,
-30932,
-31641,
-32247,
-32494,
-32428,
-32221,
-31921,
-31408,
-30632,
-29951,
-29988,
-31006,
-32703,
-33960,
-33983,
-32595,
-30818,
-29783,
-30096,
-31217,
-32076,
-31838,
-30854,
-30012,
-30370,
-31833,
-33504,
-34133,
-33084,
-30930,
-28912,
-28307,
-29412,
-31588,
-33481,
-34124,
-33276,
-31701,
-30364,
-30041,
-30599,
-31524,
-32070,
-32080,
-31734,
-31552,
-31732,
-32167,
-32437,
-32298,
-31745,
-31187,
-30976,
-31267,
-31903,
-32531,
-32827,
-32794,
-32563,
-32428,
-32457,
-32592,
-32623,
-32583,
-32544,
-32758,
-33204,
-33771,
-34067,
-34050,
-33647,
-33225,
-32893,
-32721,
-32728,
-32892,
-33388,
-34152,
-34980,
-35431,
-35146,
-34255,
-33202,
-32635,
-32843,
-33579,
-34434,
-34967,
-35187,
-35286,
-35365,
-35357,
-35049,
-34340,
-33612,
-33281,
-33742,
-34897,
-36171,
-36974,
-36940,
-36170,
-35234,
-34604,
-34595,
-35098,
-35736,
-36101,
-35980,
-35400,
-34766,
-34353,
-34526,
-35034,
-35656,
-35897,
-35634,
-35086,
-34606,
-34561,
-34835,
-35239,
-35284,
-35114,
-34838,
-34919,
-35312,
-35819,
-35897,
-35475,
-34626,
-33993,
-33834,
-34242,
-34842,
-35162,
-35089,
-34693,
-34381,
-34322,
-34522,
-34693,
-34668,
-34351,
-33939,
-33671,
-33641,
-33839,
-34027,
-34083,
-34002,
-33952,
-34081,
-34374,
-34569,
-34395,
-33670,
-32713,
-31911,
-31842,
-32570,
-33752,
-34727,
-34866,
-34061,
-32754,
-31633,
-31288,
-31636,
-32307,
-32645,
-32551,
-32206,
-32168,
-32563,
-33152,
-33362,
-32842,
-31725,
-30661,
-30176,
-30553,
-31501,
-32490,
-33163,
-33308,
-32899,
-32184,
-31242,
-30592,
-30410,
-30907,
-31661,
-32221,
-32154,
-31648,
-31212,
-31352,
-31893,
-32318,
-31997,
-31120,
-30345,
-30512,
-31559,
-32692,
-32958,
-32057,
-30827,
-30323,
-30994,
-32280,
-33012,
-32676,
-31676,
-31004,
-31268,
-32081,
-32598,
-32258,
-31484,
-31144,
-31700,
-32767,
-33332,
-32870,
-31733,
-30896,
-31078,
-32118,
-33153,
-33493,
-33059,
-32422,
-32152,
-32265,
-32514,
-32467,
-32369,
-32453,
-33026,
-33777,
-34264,
-34107,
-33509,
-32910,
-32748,
-33009,
-33437,
-33688,
-33752,
-33749,
-33837,
-33915,
-33835,
-33505,
-33101,
-32947,
-33223,
-33797,
-34345,
-34541,
-34291,
-33831,
-33421,
-33299,
-33500,
-33784,
-34050,
-34007,
-33730,
-33247,
-32826,
-32691,
-33014,
-33757,
-34703,
-35382,
-35432,
-34638,
-33218,
-31815,
-31162,
-31729,
-33273,
-34961,
-35772,
-35236,
-33727,
-32259,
-31764,
-32334,
-33324,
-33816,
-33452,
-32678,
-32334,
-32820,
-33811,
-34434,
-33981,
-32637,
-31122,
-30445,
-30860,
-32056,
-33189,
-33750,
-33564,
-33102,
-32684,
-32578,
-32653,
-32657,
-32478,
-32150,
-31922,
-31927,
-32256,
-32636,
-32944,
-32955,
-32794,
-32584,
-32476,
-32443,
-32409,
-32327,
-32257,
-32359,
-32616,
-32917,
-32974,
-32643,
-32065,
-31549,
-31407,
-31694,
-32228,
-32644,
-32825,
-32669,
-32515,
-32445,
-32564,
-32736,
-32750,
-32518,
-32058,
-31556,
-31208,
-31208,
-31504,
-32021,
-32567,
-32945,
-33105,
-32995,
-32670,
-32266,
-31912,
-31717,
-31805,
-32050,
-32336,
-32561,
-32559,
-32449,
-32219,
-31931,
-31623,
-31330,
-31189,
-31299,
-31686,
-32184,
-32528,
-32584,
-32280,
-31927,
-31686,
-31692,
-31738,
-31631,
-31221,
-30701,
-30452,
-30754,
-31647,
-32750,
-33485,
-33454,
-32649,
-31546,
-30733,
-30625,
-31096,
-31774,
-32074,
-31933,
-31470,
-31184,
-31280,
-31649,
-32020,
-32071,
-31867,
-31626,
-31524,
-31605,
-31624,
-31540,
-31373,
-31407,
-31759,
-32307,
-32649,
-32444,
-31661,
-30704,
-30108,
-30271,
-31153,
-32258,
-33132,
-33327,
-33023,
-32479,
-32192,
-32248,
-32603,
-32867,
-32886,
-32628,
-32320,
-32167,
-32304,
-32515,
-32731,
-32738,
-32695,
-32693,
-32904,
-33238,
-33562,
-33719,
-33636,
-33470,
-33340,
-33419,
-33706,
-34062,
-34286,
-34207,
-33819,
-33266,
-32779,
-32654,
-32839,
-33328,
-33776,
-34105,
-34193,
-34157,
-34054,
-33995,
-33922,
-33888,
-33884,
-33999,
-34142,
-34252,
-34040,
-33527,
-32853,
-32363,
-32485,
-33149,
-34139,
-34880,
-35065,
-34641,
-33961,
-33336,
-33045,
-32951,
-32985,
-33010,
-33085,
-33284,
-33529,
-33746,
-33759,
-33549,
-33200,
-32721,
-32250,
-31813,
-31621,
-31829,
-32514,
-33407,
-34066,
-34124,
-33473,
-32526,
-31688,
-31285,
-31274,
-31419,
-31613,
-31953,
-32498,
-33276,
-33780,
-33763,
-33030,
-31993,
-31262,
-31137,
-31662,
-32289,
-32682,
-32619,
-32350,
-32093,
-32009,
-32014,
-31952,
-31845,
-31666,
-31638,
-31684,
-31838,
-32014,
-32207,
-32367,
-32425,
-32160,
-31684,
-31106,
-30920,
-31374,
-32382,
-33499,
-34055,
-33741,
-32717,
-31516,
-30758,
-30769,
-31441,
-32505,
-33486,
-34183,
-34359,
-34011,
-33174,
-32134,
-31167,
-30600,
-30556,
-30915,
-31516,
-32201,
-32934,
-33732,
-34418,
-34778,
-34497,
-33534,
-32256,
-31105,
-30701,
-31122,
-32258,
-33621,
-34737,
-35352,
-35292,
-34711,
-33701,
-32557,
-31530,
-30986,
-31128,
-31998,
-33323,
-34607,
-35322,
-35211,
-34351,
-33173,
-32228,
-31767,
-31886,
-32261,
-32735,
-33158,
-33638,
-34184,
-34739,
-35070,
-34983,
-34389,
-33525,
-32649,
-32167,
-32225,
-32847,
-33864,
-34879,
-35563,
-35609,
-34937,
-33886,
-32813,
-32215,
-32197,
-32634,
-33188,
-33576,
-33720,
-33736,
-33781,
-33904,
-33998,
-33896,
-33532,
-33051,
-32694,
-32768,
-33298,
-34175,
-34941,
-35248,
-34766,
-33752,
-32538,
-31834,
-31932,
-32847,
-34033,
-34813,
-34763,
-33981,
-33006,
-32508,
-32615,
-33199,
-33589,
-33566,
-33147,
-32841,
-32974,
-33569,
-34148,
-34206,
-33559,
-32428,
-31477,
-31160,
-31692,
-32747,
-33845,
-34472,
-34532,
-33991,
-33301,
-32592,
-32192,
-31995,
-32048,
-32210,
-32473,
-32804,
-33126,
-33354,
-33336,
-33027,
-32518,
-31994,
-31696,
-31789,
-32185,
-32767,
-33268,
-33587,
-33666,
-33605,
-33400,
-33058,
-32527,
-31857,
-31319,
-31234,
-31862,
-33167,
-34661,
-35730,
-35738,
-34600,
-32733,
-30952,
-30145,
-30620,
-32220,
-34167,
-35678,
-36178,
-35591,
-34213,
-32608,
-31177,
-30377,
-30295,
-31006,
-32321,
-33916,
-35401,
-36326,
-36441,
-35680,
-34277,
-32612,
-31205,
-30477,
-30664,
-31660,
-33096,
-34461,
-35331,
-35557,
-35189,
-34396,
-33349,
-32120,
-30998,
-30310,
-30539,
-31813,
-33884,
-35890,
-37023,
-36657,
-34984,
-32693,
-30676,
-29603,
-29691,
-30818,
-32542,
-34402,
-35776,
-36216,
-35566,
-34093,
-32434,
-31165,
-30533,
-30444,
-30626,
-31155,
-32091,
-33574,
-34989,
-35650,
-34783,
-32744,
-30411,
-29136,
-29456,
-30987,
-32733,
-33781,
-34008,
-33805,
-33567,
-33337,
-32782,
-31732,
-30536,
-29819,
-30016,
-31086,
-32383,
-33414,
-33879,
-33898,
-33686,
-33100,
-32162,
-30872,
-29760,
-29452,
-30241,
-31885,
-33657,
-34726,
-34736,
-33796,
-32374,
-31023,
-30059,
-29735,
-30104,
-31161,
-32702,
-34196,
-35149,
-34901,
-33504,
-31317,
-29258,
-28201,
-28532,
-30024,
-31847,
-33213,
-33659,
-33357,
-32760,
-32204,
-31763,
-31274,
-30725,
-30324,
-30444,
-31242,
-32441,
-33549,
-33967,
-33630,
-32709,
-31718,
-30967,
-30594,
-30511,
-30582,
-30848,
-31291,
-31970,
-32618,
-32871,
-32518,
-31581,
-30621,
-30173,
-30531,
-31407,
-32139,
-32143,
-31513,
-30725,
-30580,
-31210,
-32236,
-32861,
-32676,
-31883,
-31105,
-30963,
-31372,
-31933,
-32058,
-31623,
-30977,
-30577,
-30732,
-31268,
-31877,
-32185,
-32150,
-31804,
-31369,
-31079,
-31093,
-31518,
-32188,
-32748,
-32769,
-32216,
-31389,
-30931,
-31272,
-32156,
-32986,
-33039,
-32315,
-31350,
-31020,
-31498,
-32454,
-32974,
-32681,
-31810,
-31180,
-31474,
-32579,
-33898,
-34493,
-34101,
-32915,
-31628,
-30799,
-30656,
-31165,
-32102,
-33269,
-34384,
-35213,
-35469,
-35138,
-34306,
-33315,
-32378,
-31725,
-31452,
-31624,
-32355,
-33527,
-34850,
-35813,
-35960,
-35095,
-33500,
-31724,
-30430,
-30080,
-30740,
-32273,
-34178,
-35875,
-36859,
-36665,
-35328,
-33207,
-31056,
-29712,
-29738,
-31158,
-33354,
-35421,
-36476,
-36214,
-34930,
-33331,
-32074,
-31459,
-31321,
-31485,
-31851,
-32600,
-33831,
-35219,
-36178,
-35927,
-34454,
-32166,
-30213,
-29337,
-29810,
-31138,
-32644,
-33811,
-34547,
-34982,
-35151,
-34894,
-33982,
-32428,
-30605,
-29274,
-29013,
-30194,
-32362,
-34837,
-36556,
-36935,
-35804,
-33665,
-31353,
-29661,
-29043,
-29522,
-30742,
-32262,
-33796,
-35074,
-35946,
-36119,
-35385,
-33743,
-31677,
-29833,
-29021,
-29414,
-30902,
-32801,
-34566,
-35777,
-36219,
-35834,
-34564,
-32725,
-30868,
-29848,
-30072,
-31472,
-33193,
-34500,
-34992,
-35037,
-35121,
-35429,
-35517,
-34854,
-33271,
-31474,
-30372,
-30612,
-32016,
-33762,
-35145,
-35851,
-36045,
-35884,
-35268,
-34094,
-32524,
-31169,
-30744,
-31481,
-32930,
-34330,
-35099,
-35350,
-35368,
-35488,
-35402,
-34856,
-33756,
-32710,
-32322,
-33022,
-34299,
-35422,
-35761,
-35358,
-34716,
-34291,
-34135,
-34008,
-33700,
-33453,
-33550,
-34244,
-35092,
-35563,
-35123,
-33924,
-32560,
-31770,
-31925,
-32830,
-34070,
-35138,
-35868,
-36222,
-36251,
-35930,
-35242,
-34187,
-33009,
-32042,
-31660,
-32073,
-33258,
-34875,
-36461,
-37415,
-37390,
-36343,
-34631,
-32891,
-31640,
-31248,
-31605,
-32489,
-33580,
-34675,
-35587,
-36166,
-36079,
-35296,
-33800,
-32194,
-30908,
-30489,
-30968,
-32190,
-33778,
-35396,
-36600,
-36992,
-36268,
-34481,
-32228,
-30414,
-29759,
-30328,
-31546,
-32602,
-33070,
-33133,
-33234,
-33644,
-34083,
-34025,
-33168,
-31796,
-30591,
-30191,
-30600,
-31456,
-32112,
-32296,
-32066,
-31681,
-31356,
-31178,
-31195,
-31387,
-31819,
-32204,
-32346,
-32001,
-31313,
-30682,
-30486,
-30816,
-31347,
-31601,
-31417,
-30974,
-30752,
-30930,
-31405,
-31652,
-31441,
-30762,
-30155,
-29993,
-30414,
-31172,
-31760,
-31979,
-31787,
-31465,
-31260,
-31227,
-31358,
-31429,
-31458,
-31320,
-31199,
-31129,
-31310,
-31703,
-32251,
-32708,
-32838,
-32615,
-32238,
-31976,
-32111,
-32492,
-32889,
-32914,
-32505,
-31916,
-31485,
-31575,
-32012,
-32638,
-32940,
-32929,
-32685,
-32568,
-32736,
-33126,
-33476,
-33457,
-33082,
-32479,
-32068,
-32067,
-32564,
-33234,
-33819,
-33873,
-33528,
-32842,
-32339,
-32265,
-32708,
-33481,
-34173,
-34485,
-34342,
-33841,
-33330,
-32917,
-32812,
-32845,
-33122,
-33408,
-33768,
-33986,
-33982,
-33729,
-33310,
-33032,
-33008,
-33333,
-33707,
-33870,
-33623,
-33080,
-32581,
-32440,
-32748,
-33294,
-33677,
-33624,
-33136,
-32429,
-32006,
-32067,
-32730,
-33625,
-34356,
-34460,
-33852,
-32785,
-31858,
-31595,
-32164,
-33252,
-34120,
-34323,
-33698,
-32810,
-32158,
-32212,
-32688,
-33194,
-33193,
-32668,
-31940,
-31433,
-31483,
-31979,
-32616,
-33138,
-33220,
-32991,
-32423,
-31778,
-31196,
-30845,
-30870,
-31203,
-31791,
-32381,
-32850,
-33084,
-33040,
-32748,
-32261,
-31668,
-31213,
-31027,
-31216,
-31556,
-31808,
-31747,
-31422,
-31133,
-31147,
-31504,
-31926,
-32036,
-31674,
-31009,
-30502,
-30455,
-30929,
-31600,
-32081,
-32183,
-31920,
-31620,
-31417,
-31372,
-31279,
-31026,
-30635,
-30402,
-30564,
-31185,
-31949,
-32370,
-32160,
-31491,
-30796,
-30625,
-30978,
-31500,
-31702,
-31406,
-30933,
-30746,
-31076,
-31652,
-31946,
-31683,
-31001,
-30490,
-30570,
-31242,
-32151,
-32735,
-32868,
-32672,
-32502,
-32526,
-32654,
-32614,
-32278,
-31758,
-31374,
-31491,
-32109,
-33000,
-33660,
-33789,
-33395,
-32802,
-32379,
-32306,
-32437,
-32644,
-32791,
-33091,
-33557,
-34148,
-34431,
-34134,
-33311,
-32378,
-31926,
-32076,
-32655,
-33107,
-33343,
-33449,
-33832,
-34494,
-35070,
-35047,
-34249,
-33069,
-32206,
-32101,
-32680,
-33381,
-33752,
-33652,
-33448,
-33335,
-33506,
-33622,
-33629,
-33436,
-33351,
-33489,
-33783,
-34006,
-33907,
-33538,
-33086,
-32790,
-32693,
-32742,
-32912,
-33135,
-33514,
-33817,
-33910,
-33604,
-32999,
-32493,
-32387,
-32798,
-33357,
-33682,
-33495,
-33002,
-32577,
-32559,
-32926,
-33326,
-33475,
-33185,
-32701,
-32271,
-32084,
-32179,
-32331,
-32530,
-32679,
-32861,
-33130,
-33416,
-33624,
-33625,
-33378,
-32929,
-32472,
-32127,
-32028,
-32138,
-32385,
-32745,
-33047,
-33372,
-33532,
-33524,
-33276,
-32910,
-32551,
-32432,
-32574,
-32858,
-33176,
-33283,
-33263,
-33197,
-33197,
-33333,
-33468,
-33502,
-33396,
-33170,
-33044,
-33092,
-33325,
-33579,
-33681,
-33564,
-33340,
-33284,
-33465,
-33880,
-34167,
-34122,
-33689,
-33061,
-32640,
-32545,
-32772,
-33062,
-33260,
-33383,
-33533,
-33799,
-34079,
-34139,
-33939,
-33546,
-33201,
-33066,
-33144,
-33320,
-33515,
-33773,
-34088,
-34379,
-34433,
-34081,
-33500,
-33042,
-33076,
-33621,
-34240,
-34483,
-34136,
-33495,
-33070,
-33076,
-33379,
-33585,
-33446,
-33178,
-33056,
-33296,
-33650,
-33739,
-33386,
-32840,
-32574,
-32866,
-33537,
-34084,
-34170,
-33736,
-33228,
-33002,
-33168,
-33511,
-33678,
-33530,
-33233,
-33002,
-33071,
-33332,
-33616,
-33644,
-33429,
-33061,
-32792,
-32747,
-32869,
-32977,
-32893,
-32660,
-32409,
-32399,
-32625,
-32923,
-33076,
-32926,
-32623,
-32422,
-32429,
-32640,
-32785,
-32828,
-32726,
-32730,
-32872,
-33086,
-33096,
-32850,
-32346,
-32014,
-31940,
-32279,
-32748,
-33115,
-33191,
-32951,
-32527,
-32035,
-31701,
-31595,
-31902,
-32437,
-33028,
-33231,
-32959,
-32254,
-31608,
-31353,
-31639,
-32242,
-32727,
-32834,
-32612,
-32264,
-32134,
-32145,
-32302,
-32286,
-32189,
-32095,
-32143,
-32437,
-32707,
-32886,
-32772,
-32461,
-32143,
-31966,
-32029,
-32282,
-32606,
-32844,
-32920,
-32769,
-32505,
-32278,
-32301,
-32592,
-33044,
-33335,
-33341,
-33000,
-32650,
-32495,
-32681,
-33017,
-33245,
-33177,
-32947,
-32738,
-32855,
-33212,
-33598,
-33731,
-33466,
-33036,
-32643,
-32592,
-32845,
-33293,
-33620,
-33744,
-33720,
-33633,
-33714,
-33836,
-33933,
-33832,
-33513,
-33210,
-33056,
-33215,
-33536,
-33825,
-33864,
-33729,
-33450,
-33310,
-33254,
-33323,
-33442,
-33509,
-33647,
-33714,
-33721,
-33609,
-33358,
-33177,
-33114,
-33252,
-33416,
-33511,
-33480,
-33402,
-33404,
-33508,
-33548,
-33418,
-33036,
-32636,
-32408,
-32584,
-32998,
-33416,
-33549,
-33266,
-32775,
-32276,
-32028,
-32024,
-32139,
-32219,
-32158,
-32056,
-32025,
-32180,
-32458,
-32711,
-32795,
-32633,
-32316,
-32054,
-31876,
-31878,
-31924,
-31954,
-31961,
-31956,
-31910,
-31812,
-31561,
-31251,
-31005,
-31006,
-31216,
-31537,
-31711,
-31700,
-31540,
-31449,
-31475,
-31577,
-31566,
-31396,
-31173,
-30979,
-30994,
-31046,
-31072,
-31075,
-31113,
-31398,
-31780,
-32081,
-32021,
-31638,
-31234,
-31182,
-31578,
-32210,
-32595,
-32522,
-32022,
-31495,
-31241,
-31291,
-31524,
-31626,
-31691,
-31707,
-31959,
-32243,
-32536,
-32513,
-32287,
-31983,
-31804,
-31921,
-32194,
-32521,
-32724,
-32724,
-32626,
-32414,
-32225,
-32039,
-31885,
-31835,
-31843,
-32050,
-32302,
-32637,
-32877,
-32978,
-32878,
-32667,
-32369,
-32155,
-31981,
-31968,
-32029,
-32239,
-32481,
-32696,
-32785,
-32667,
-32393,
-32160,
-32030,
-32177,
-32410,
-32689,
-32838,
-32883,
-32830,
-32759,
-32598,
-32395,
-32156,
-32014,
-32069,
-32238,
-32462,
-32502,
-32454,
-32350,
-32398,
-32554,
-32646,
-32567,
-32270,
-32064,
-32124,
-32526,
-33019,
-33213,
-33008,
-32535,
-32171,
-32177,
-32459,
-32813,
-32888,
-32802,
-32578,
-32580,
-32717,
-32879,
-32904,
-32728,
-32493,
-32355,
-32385,
-32515,
-32686,
-32799,
-32921,
-33022,
-33132,
-33159,
-33099,
-32947,
-32783,
-32649,
-32560,
-32520,
-32549,
-32655,
-32899,
-33094,
-33244,
-33159,
-32984,
-32810,
-32839,
-33086,
-33381,
-33511,
-33341,
-32917,
-32500,
-32285,
-32317,
-32579,
-32806,
-32932,
-32899,
-32797,
-32680,
-32650,
-32721,
-32926,
-33163,
-33368,
-33358,
-33114,
-32772,
-32493,
-32506,
-32697,
-32987,
-33071,
-32980,
-32840,
-32814,
-32960,
-33118,
-33089,
-32872,
-32649,
-32648,
-32993,
-33398,
-33653,
-33484,
-33090,
-32745,
-32648,
-32851,
-33021,
-33043,
-32821,
-32556,
-32430,
-32505,
-32689,
-32917,
-33073,
-33269,
-33416,
-33490,
-33398,
-33157,
-32945,
-32862,
-33003,
-33151,
-33224,
-33066,
-32864,
-32774,
-32867,
-33087,
-33207,
-33172,
-33018,
-32945,
-33052,
-33295,
-33481,
-33457,
-33232,
-32902,
-32687,
-32663,
-32741,
-32916,
-32983,
-33054,
-33090,
-33176,
-33263,
-33335,
-33308,
-33256,
-33094,
-33033,
-32940,
-32950,
-32956,
-33010,
-33060,
-33159,
-33263,
-33369,
-33442,
-33394,
-33282,
-33111,
-33032,
-33026,
-33193,
-33390,
-33598,
-33710,
-33702,
-33619,
-33464,
-33341,
-33277,
-33295,
-33408,
-33527,
-33622,
-33661,
-33644,
-33617,
-33599,
-33657,
-33679,
-33698,
-33614,
-33515,
-33416,
-33447,
-33590,
-33786,
-33951,
-33939,
-33814,
-33646,
-33591,
-33685,
-33876,
-33933,
-33864,
-33608,
-33501,
-33543,
-33804,
-34062,
-34079,
-33908,
-33677,
-33666,
-33900,
-34213,
-34278,
-33968,
-33425,
-32974,
-32903,
-33255,
-33729,
-34100,
-34179,
-34031,
-33838,
-33679,
-33584,
-33481,
-33346,
-33210,
-33112,
-33094,
-33101,
-33108,
-33091,
-33112,
-33186,
-33317,
-33439,
-33480,
-33392,
-33223,
-33047,
-32928,
-32953,
-33052,
-33180,
-33230,
-33145,
-32956,
-32753,
-32597,
-32607,
-32683,
-32797,
-32800,
-32729,
-32595,
-32547,
-32633,
-32836,
-33030,
-33111,
-33004,
-32794,
-32565,
-32438,
-32368,
-32376,
-32337,
-32292,
-32281,
-32318,
-32466,
-32595,
-32709,
-32712,
-32697,
-32685,
-32663,
-32654,
-32530,
-32322,
-32066,
-31875,
-31852,
-32033,
-32315,
-32593,
-32703,
-32602,
-32386,
-32089,
-31942,
-31872,
-31942,
-32048,
-32126,
-32226,
-32257,
-32318,
-32338,
-32349,
-32307,
-32241,
-32113,
-31963,
-31793,
-31646,
-31590,
-31671,
-31852,
-32133,
-32347,
-32481,
-32423,
-32276,
-32072,
-31986,
-32001,
-32094,
-32135,
-32092,
-31979,
-31919,
-31984,
-32093,
-32166,
-32054,
-31823,
-31659,
-31738,
-32023,
-32401,
-32571,
-32546,
-32413,
-32383,
-32513,
-32631,
-32543,
-32152,
-31633,
-31300,
-31273,
-31571,
-31882,
-32060,
-32058,
-32046,
-32121,
-32366,
-32522,
-32570,
-32390,
-32154,
-32013,
-31974,
-32023,
-32003,
-31925,
-31776,
-31738,
-31807,
-32026,
-32226,
-32361,
-32326,
-32214,
-32088,
-32064,
-32179,
-32351,
-32505,
-32507,
-32370,
-32162,
-32028,
-32062,
-32269,
-32587,
-32834,
-32968,
-32862,
-32614,
-32359,
-32216,
-32323,
-32630,
-32966,
-33197,
-33150,
-32924,
-32665,
-32607,
-32766,
-33093,
-33353,
-33407,
-33308,
-33154,
-33078,
-33139,
-33240,
-33299,
-33297,
-33226,
-33259,
-33326,
-33493,
-33583,
-33605,
-33498,
-33287,
-33076,
-32942,
-33043,
-33340,
-33800,
-34162,
-34248,
-33950,
-33422,
-32946,
-32731,
-32886,
-33160,
-33346,
-33318,
-33118,
-32999,
-33155,
-33453,
-33806,
-33845,
-33610,
-33194,
-32849,
-32831,
-33061,
-33392,
-33600,
-33485,
-33180,
-32812,
-32592,
-32621,
-32763,
-32947,
-32963,
-32846,
-32693,
-32577,
-32649,
-32724,
-32761,
-32608,
-32331,
-32061,
-32001,
-32210,
-32590,
-32967,
-33059,
-32927,
-32550,
-32205,
-32014,
-31977,
-32121,
-32210,
-32368,
-32449,
-32544,
-32595,
-32542,
-32374,
-32117,
-31879,
-31713,
-31676,
-31687,
-31789,
-31910,
-32124,
-32314,
-32470,
-32418,
-32214,
-31901,
-31660,
-31596,
-31749,
-32050,
-32329,
-32563,
-32601,
-32595,
-32466,
-32354,
-32206,
-32113,
-32037,
-32074,
-32153,
-32327,
-32472,
-32596,
-32589,
-32488,
-32328,
-32183,
-32091,
-32100,
-32151,
-32296,
-32489,
-32703,
-32870,
-32916,
-32781,
-32580,
-32360,
-32284,
-32347,
-32478,
-32614,
-32713,
-32814,
-32931,
-33019,
-32971,
-32754,
-32427,
-32253,
-32307,
-32607,
-32912,
-32974,
-32770,
-32485,
-32345,
-32532,
-32849,
-33124,
-33127,
-32966,
-32761,
-32772,
-32869,
-33017,
-32976,
-32839,
-32669,
-32640,
-32733,
-32873,
-32936,
-32978,
-32944,
-33005,
-32974,
-32923,
-32719,
-32590,
-32554,
-32799,
-33119,
-33411,
-33454,
-33285,
-32965,
-32750,
-32653,
-32817,
-33017,
-33264,
-33389,
-33410,
-33357,
-33218,
-33124,
-33043,
-33063,
-33184,
-33386,
-33626,
-33803,
-33822,
-33627,
-33332,
-33027,
-32918,
-33013,
-33266,
-33553,
-33667,
-33709,
-33572,
-33528,
-33491,
-33582,
-33641,
-33708,
-33722,
-33708,
-33731,
-33744,
-33849,
-33921,
-34000,
-34003,
-33870,
-33663,
-33483,
-33379,
-33487,
-33683,
-33862,
-33929,
-33837,
-33712,
-33669,
-33791,
-33979,
-34137,
-34138,
-33976,
-33821,
-33725,
-33802,
-33923,
-34007,
-33950,
-33764,
-33500,
-33247,
-33100,
-33107,
-33339,
-33681,
-34052,
-34243,
-34151,
-33887,
-33546,
-33361,
-33306,
-33345,
-33275,
-33179,
-33040,
-33118,
-33320,
-33593,
-33679,
-33561,
-33267,
-33031,
-32984,
-33038,
-33131,
-33080,
-32951,
-32830,
-32815,
-32899,
-32906,
-32881,
-32723,
-32686,
-32739,
-32922,
-33066,
-33051,
-32911,
-32681,
-32496,
-32417,
-32358,
-32394,
-32385,
-32440,
-32500,
-32508,
-32480,
-32372,
-32360,
-32408,
-32528,
-32512,
-32289,
-31913,
-31560,
-31509,
-31696,
-32050,
-32217,
-32234,
-32064,
-32071,
-32185,
-32401,
-32448,
-32251,
-31915,
-31692,
-31709,
-31928,
-32107,
-32083,
-31888,
-31665,
-31608,
-31670,
-31785,
-31835,
-31830,
-31820,
-31910,
-31991,
-32045,
-31949,
-31873,
-31837,
-31985,
-32157,
-32246,
-32154,
-31920,
-31758,
-31715,
-31846,
-31989,
-32090,
-32065,
-32045,
-32053,
-32138,
-32193,
-32147,
-31936,
-31708,
-31558,
-31606,
-31896,
-32263,
-32592,
-32762,
-32730,
-32583,
-32425,
-32271,
-32172,
-32035,
-31920,
-31853,
-31905,
-32045,
-32206,
-32287,
-32274,
-32262,
-32298,
-32432,
-32603,
-32648,
-32604,
-32462,
-32372,
-32361,
-32331,
-32259,
-32053,
-31925,
-31937,
-32182,
-32514,
-32737,
-32777,
-32661,
-32566,
-32592,
-32712,
-32820,
-32811,
-32737,
-32661,
-32667,
-32713,
-32721,
-32640,
-32545,
-32518,
-32554,
-32595,
-32502,
-32321,
-32171,
-32243,
-32558,
-32951,
-33178,
-33153,
-32893,
-32624,
-32472,
-32373,
-32382,
-32369,
-32535,
-32882,
-33313,
-33591,
-33436,
-32919,
-32282,
-31952,
-32084,
-32490,
-32932,
-33014,
-32986,
-32810,
-32866,
-32892,
-32881,
-32620,
-32333,
-32183,
-32411,
-32817,
-33222,
-33358,
-33198,
-32990,
-32853,
-32896,
-33014,
-33046,
-32974,
-32880,
-32861,
-33022,
-33208,
-33346,
-33298,
-33132,
-32927,
-32871,
-32953,
-33170,
-33373,
-33462,
-33419,
-33303,
-33217,
-33197,
-33213,
-33223,
-33143,
-33044,
-33002,
-33079,
-33300,
-33516,
-33660,
-33652,
-33500,
-33327,
-33168,
-33143,
-33207,
-33392,
-33568,
-33716,
-33717,
-33552,
-33315,
-33087,
-32976,
-33014,
-33084,
-33151,
-33106,
-33078,
-33035,
-33203,
-33357,
-33566,
-33583,
-33416,
-33146,
-32873,
-32768,
-32846,
-33040,
-33236,
-33289,
-33246,
-33101,
-33033,
-33040,
-33142,
-33221,
-33199,
-33043,
-32794,
-32603,
-32489,
-32579,
-32752,
-32964,
-33101,
-33063,
-32869,
-32598,
-32386,
-32416,
-32634,
-32925,
-33062,
-32917,
-32639,
-32438,
-32537,
-32849,
-33120,
-33075,
-32678,
-32254,
-32027,
-32293,
-32701,
-33031,
-32976,
-32671,
-32399,
-32398,
-32661,
-32912,
-32948,
-32688,
-32357,
-32209,
-32334,
-32648,
-32908,
-32955,
-32789,
-32588,
-32453,
-32515,
-32674,
-32806,
-32864,
-32825,
-32777,
-32813,
-32883,
-32935,
-32870,
-32664,
-32461,
-32359,
-32480,
-32737,
-32976,
-33094,
-33038,
-32891,
-32755,
-32653,
-32592,
-32565,
-32583,
-32658,
-32795,
-32903,
-32914,
-32863,
-32759,
-32743,
-32806,
-32899,
-32930,
-32825,
-32668,
-32512,
-32461,
-32446,
-32435,
-32332,
-32272,
-32204,
-32282,
-32342,
-32410,
-32398,
-32401,
-32544,
-32708,
-32889,
-32845,
-32660,
-32352,
-32220,
-32202,
-32345,
-32409,
-32345,
-32211,
-32096,
-32118,
-32162,
-32169,
-32045,
-31918,
-31895,
-32035,
-32289,
-32443,
-32437,
-32293,
-32171,
-32159,
-32326,
-32465,
-32579,
-32518,
-32409,
-32284,
-32195,
-32127,
-32060,
-31983,
-32014,
-32131,
-32422,
-32755,
-33044,
-33196,
-33165,
-32952,
-32697,
-32396,
-32288,
-32299,
-32501,
-32708,
-32840,
-32798,
-32683,
-32582,
-32678,
-32860,
-33045,
-33102,
-32952,
-32809,
-32789,
-32995,
-33289,
-33507,
-33476,
-33300,
-33054,
-32968,
-33007,
-33111,
-33199,
-33220,
-33239,
-33320,
-33404,
-33491,
-33508,
-33484,
-33476,
-33444,
-33404,
-33270,
-33096,
-33004,
-33037,
-33282,
-33525,
-33651,
-33570,
-33329,
-33150,
-33092,
-33208,
-33346,
-33426,
-33389,
-33318,
-33294,
-33349,
-33451,
-33453,
-33365,
-33138,
-33001,
-32952,
-33140,
-33333,
-33459,
-33385,
-33173,
-32994,
-32988,
-33102,
-33237,
-33201,
-33002,
-32764,
-32717,
-32867,
-33159,
-33301,
-33218,
-32965,
-32775,
-32754,
-32900,
-33063,
-33063,
-32966,
-32804,
-32762,
-32755,
-32765,
-32736,
-32705,
-32793,
-32961,
-33140,
-33142,
-32968,
-32698,
-32519,
-32541,
-32591,
-32637,
-32485,
-32347,
-32308,
-32500,
-32748,
-32923,
-32814,
-32603,
-32341,
-32295,
-32320,
-32396,
-32376,
-32375,
-32438,
-32614,
-32787,
-32805,
-32630,
-32377,
-32199,
-32241,
-32315,
-32367,
-32220,
-32079,
-32075,
-32324,
-32704,
-32962,
-32916,
-32633,
-32250,
-32038,
-32016,
-32147,
-32252,
-32323,
-32329,
-32387,
-32502,
-32596,
-32681,
-32633,
-32544,
-32500,
-32508,
-32603,
-32696,
-32729,
-32683,
-32595,
-32520,
-32549,
-32652,
-32804,
-32907,
-32954,
-32884,
-32813,
-32667,
-32579,
-32485,
-32464,
-32519,
-32677,
-32853,
-32984,
-32967,
-32826,
-32635,
-32505,
-32520,
-32636,
-32788,
-32895,
-32950,
-32997,
-33052,
-33101,
-33099,
-32975,
-32811,
-32638,
-32577,
-32668,
-32782,
-32942,
-32965,
-32937,
-32843,
-32776,
-32728,
-32729,
-32730,
-32689,
-32717,
-32696,
-32785,
-32821,
-32863,
-32787,
-32719,
-32633,
-32672,
-32777,
-32900,
-32971,
-32950,
-32900,
-32870,
-32907,
-32927,
-32935,
-32819,
-32690,
-32630,
-32618,
-32700,
-32745,
-32727,
-32667,
-32605,
-32639,
-32711,
-32801,
-32821,
-32721,
-32598,
-32487,
-32474,
-32513,
-32569,
-32554,
-32466,
-32374,
-32322,
-32398,
-32582,
-32739,
-32857,
-32794,
-32690,
-32544,
-32476,
-32491,
-32566,
-32631,
-32693,
-32696,
-32677,
-32647,
-32543,
-32500,
-32427,
-32506,
-32595,
-32762,
-32863,
-32906,
-32859,
-32767,
-32646,
-32511,
-32361,
-32306,
-32341,
-32556,
-32833,
-33045,
-33097,
-32972,
-32804,
-32752,
-32833,
-32974,
-33030,
-32937,
-32777,
-32667,
-32743,
-32874,
-33043,
-33036,
-32966,
-32875,
-32844,
-32837,
-32805,
-32715,
-32666,
-32731,
-32975,
-33228,
-33385,
-33236,
-32893,
-32545,
-32371,
-32524,
-32858,
-33219,
-33437,
-33451,
-33375,
-33261,
-33250,
-33189,
-33146,
-32939,
-32759,
-32598,
-32671,
-32886,
-33219,
-33417,
-33427,
-33240,
-32991,
-32841,
-32828,
-32942,
-33065,
-33117,
-33133,
-33113,
-33162,
-33197,
-33241,
-33138,
-32960,
-32754,
-32679,
-32806,
-33072,
-33375,
-33488,
-33396,
-33103,
-32824,
-32671,
-32714,
-32869,
-32976,
-32987,
-32853,
-32740,
-32679,
-32801,
-32977,
-33157,
-33177,
-33047,
-32762,
-32486,
-32303,
-32272,
-32451,
-32667,
-32917,
-33069,
-33094,
-32995,
-32813,
-32610,
-32479,
-32445,
-32502,
-32625,
-32714,
-32773,
-32739,
-32674,
-32571,
-32484,
-32406,
-32353,
-32335,
-32357,
-32425,
-32544,
-32620,
-32710,
-32659,
-32625,
-32527,
-32489,
-32468,
-32488,
-32440,
-32424,
-32359,
-32433,
-32620,
-32853,
-33057,
-33044,
-32875,
-32625,
-32473,
-32459,
-32584,
-32681,
-32696,
-32625,
-32539,
-32542,
-32550,
-32578,
-32531,
-32449,
-32407,
-32465,
-32579,
-32722,
-32775,
-32787,
-32729,
-32753,
-32752,
-32809,
-32793,
-32747,
-32687,
-32706,
-32790,
-32952,
-33023,
-32978,
-32748,
-32488,
-32296,
-32317,
-32502,
-32706,
-32827,
-32759,
-32642,
-32587,
-32669,
-32852,
-33002,
-33036,
-32922,
-32824,
-32700,
-32698,
-32634,
-32667,
-32655,
-32816,
-32967,
-33118,
-33109,
-32933,
-32772,
-32693,
-32853,
-33072,
-33258,
-33218,
-33060,
-32851,
-32762,
-32798,
-32880,
-32910,
-32881,
-32812,
-32817,
-32852,
-32949,
-32950,
-32944,
-32853,
-32812,
-32758,
-32751,
-32726,
-32711,
-32753,
-32809,
-32893,
-32936,
-32907,
-32788,
-32658,
-32519,
-32476,
-32501,
-32615,
-32710,
-32811,
-32786,
-32715,
-32591,
-32513,
-32551,
-32673,
-32825,
-32881,
-32823,
-32662,
-32560,
-32532,
-32668,
-32749,
-32763,
-32603,
-32378,
-32267,
-32297,
-32520,
-32748,
-32870,
-32843,
-32701,
-32593,
-32572,
-32669,
-32784,
-32860,
-32795,
-32705,
-32581,
-32591,
-32629,
-32753,
-32815,
-32848,
-32868,
-32878,
-32916,
-32929,
-32849,
-32748,
-32629,
-32636,
-32752,
-32970,
-33147,
-33229,
-33150,
-32983,
-32852,
-32744,
-32778,
-32815,
-32895,
-32994,
-33061,
-33141,
-33134,
-33080,
-32970,
-32864,
-32809,
-32845,
-32952,
-33071,
-33194,
-33234,
-33268,
-33251,
-33237,
-33189,
-33093,
-32990,
-32875,
-32847,
-32919,
-33054,
-33198,
-33252,
-33195,
-33084,
-32941,
-32866,
-32811,
-32842,
-32884,
-32989,
-33142,
-33265,
-33334,
-33263,
-33101,
-32917,
-32854,
-32863,
-32945,
-32934,
-32847,
-32752,
-32716,
-32841,
-33014,
-33179,
-33201,
-33110,
-32959,
-32916,
-32917,
-33016,
-33028,
-32981,
-32853,
-32728,
-32632,
-32618,
-32630,
-32694,
-32743,
-32782,
-32808,
-32833,
-32892,
-32994,
-33124,
-33167,
-33103,
-32843,
-32546,
-32311,
-32288,
-32500,
-32768,
-32993,
-33003,
-32882,
-32752,
-32668,
-32729,
-32804,
-32886,
-32899,
-32895,
-32871,
-32837,
-32778,
-32665,
-32569,
-32520,
-32567,
-32695,
-32793,
-32864,
-32826,
-32763,
-32718,
-32699,
-32770,
-32795,
-32886,
-32860,
-32838,
-32659,
-32498,
-32301,
-32262,
-32347,
-32532,
-32750,
-32802,
-32815,
-32723,
-32741,
-32809,
-32880,
-32830,
-32638,
-32415,
-32261,
-32297,
-32400,
-32472,
-32450,
-32336,
-32279,
-32316,
-32434,
-32528,
-32504,
-32421,
-32323,
-32296,
-32320,
-32312,
-32250,
-32183,
-32171,
-32275,
-32403,
-32444,
-32335,
-32137,
-31965,
-31946,
-32040,
-32194,
-32313,
-32371,
-32405,
-32419,
-32424,
-32352,
-32249,
-32136,
-32112,
-32138,
-32186,
-32129,
-32033,
-31914,
-31948,
-32071,
-32302,
-32371,
-32357,
-32206,
-32105,
-32137,
-32178,
-32258,
-32165,
-32049,
-31986,
-32056,
-32287,
-32521,
-32668,
-32624,
-32493,
-32310,
-32242,
-32234,
-32317,
-32378,
-32422,
-32415,
-32440,
-32469,
-32531,
-32581,
-32580,
-32548,
-32504,
-32481,
-32510,
-32563,
-32577,
-32579,
-32558,
-32578,
-32710,
-32872,
-33074,
-33217,
-33238,
-33160,
-33031,
-32895,
-32822,
-32884,
-32994,
-33189,
-33273,
-33258,
-33113,
-32949,
-32910,
-33039,
-33292,
-33483,
-33493,
-33335,
-33120,
-33077,
-33186,
-33373,
-33490,
-33411,
-33303,
-33213,
-33342,
-33525,
-33659,
-33633,
-33436,
-33299,
-33264,
-33411,
-33564,
-33661,
-33628,
-33571,
-33489,
-33471,
-33396,
-33348,
-33284,
-33319,
-33428,
-33552,
-33579,
-33502,
-33338,
-33237,
-33234,
-33313,
-33390,
-33378,
-33313,
-33258,
-33221,
-33222,
-33177,
-33060,
-32956,
-32880,
-32971,
-33059,
-33174,
-33093,
-32945,
-32717,
-32640,
-32681,
-32887,
-33047,
-33152,
-33030,
-32889,
-32680,
-32603,
-32576,
-32574,
-32533,
-32435,
-32358,
-32337,
-32373,
-32415,
-32377,
-32258,
-32177,
-32162,
-32253,
-32330,
-32303,
-32132,
-31965,
-31854,
-31899,
-31981,
-31957,
-31869,
-31717,
-31735,
-31873,
-32107,
-32206,
-32172,
-31994,
-31910,
-31910,
-32029,
-32045,
-31946,
-31715,
-31562,
-31538,
-31704,
-31834,
-31907,
-31819,
-31718,
-31664,
-31705,
-31764,
-31819,
-31762,
-31759,
-31779,
-31882,
-32057,
-32150,
-32232,
-32173,
-32073,
-31957,
-31862,
-31854,
-31974,
-32176,
-32468,
-32689,
-32767,
-32723,
-32497,
-32355,
-32185,
-32169,
-32207,
-32276,
-32404,
-32511,
-32667,
-32769,
-32823,
-32817,
-32734,
-32728,
-32733,
-32880,
-33022,
-33169,
-33189,
-33129,
-33014,
-32919,
-32944,
-33018,
-33135,
-33240,
-33287,
-33304,
-33368,
-33387,
-33436,
-33380,
-33295,
-33196,
-33175,
-33268,
-33435,
-33593,
-33667,
-33638,
-33534,
-33437,
-33335,
-33319,
-33341,
-33455,
-33608,
-33769,
-33879,
-33850,
-33759,
-33610,
-33539,
-33532,
-33628,
-33687,
-33727,
-33661,
-33631,
-33590,
-33649,
-33708,
-33776,
-33781,
-33744,
-33736,
-33742,
-33839,
-33885,
-33881,
-33763,
-33622,
-33563,
-33636,
-33806,
-33962,
-33951,
-33803,
-33621,
-33532,
-33623,
-33797,
-33934,
-33967,
-33859,
-33793,
-33735,
-33735,
-33710,
-33606,
-33586,
-33602,
-33774,
-33956,
-33989,
-33901,
-33651,
-33509,
-33463,
-33586,
-33670,
-33678,
-33602,
-33557,
-33614,
-33753,
-33900,
-33893,
-33788,
-33578,
-33397,
-33343,
-33331,
-33402,
-33429,
-33482,
-33472,
-33530,
-33511,
-33536,
-33491,
-33447,
-33400,
-33351,
-33339,
-33337,
-33355,
-33356,
-33356,
-33298,
-33273,
-33190,
-33153,
-33109,
-33090,
-33080,
-33054,
-33069,
-33060,
-33079,
-33083,
-33055,
-33000,
-32925,
-32849,
-32825,
-32808,
-32837,
-32812,
-32806,
-32767,
-32735,
-32717,
-32653,
-32571,
-32468,
-32409,
-32407,
-32490,
-32546,
-32577,
-32480,
-32377,
-32246,
-32221,
-32206,
-32242,
-32201,
-32158,
-32092,
-32051,
-32065,
-32044,
-32055,
-31984,
-31950,
-31884,
-31862,
-31831,
-31831,
-31824,
-31841,
-31853,
-31872,
-31846,
-31784,
-31694,
-31603,
-31573,
-31604,
-31641,
-31697,
-31640,
-31573,
-31439,
-31417,
-31453,
-31623,
-31758,
-31843,
-31788,
-31609,
-31432,
-31291,
-31325,
-31423,
-31578,
-31667,
-31701,
-31654,
-31605,
-31565,
-31532,
-31492,
-31448,
-31449,
-31516,
-31689,
-31853,
-31932,
-31875,
-31699,
-31557,
-31549,
-31663,
-31843,
-31899,
-31815,
-31634,
-31510,
-31572,
-31800,
-32055,
-32200,
-32117,
-31915,
-31719,
-31686,
-31840,
-32077,
-32266,
-32307,
-32200,
-32066,
-31970,
-32039,
-32161,
-32271,
-32298,
-32231,
-32164,
-32187,
-32289,
-32482,
-32578,
-32555,
-32381,
-32202,
-32113,
-32215,
-32416,
-32620,
-32705,
-32667,
-32618,
-32619,
-32706,
-32790,
-32792,
-32685,
-32619,
-32658,
-32863,
-33091,
-33172,
-33062,
-32799,
-32607,
-32609,
-32768,
-33031,
-33130,
-33180,
-33112,
-33133,
-33195,
-33284,
-33321,
-33236,
-33115,
-32998,
-32964,
-33010,
-33116,
-33212,
-33301,
-33347,
-33352,
-33360,
-33355,
-33384,
-33428,
-33491,
-33506,
-33501,
-33443,
-33401,
-33362,
-33385,
-33368,
-33374,
-33342,
-33333,
-33362,
-33427,
-33431,
-33450,
-33348,
-33311,
-33266,
-33308,
-33383,
-33384,
-33387,
-33317,
-33283,
-33299,
-33276,
-33283,
-33168,
-33151,
-33119,
-33268,
-33383,
-33489,
-33434,
-33294,
-33116,
-33015,
-33015,
-33075,
-33148,
-33158,
-33125,
-33101,
-33066,
-33123,
-33105,
-33064,
-32942,
-32809,
-32714,
-32728,
-32806,
-32938,
-33022,
-33039,
-32987,
-32904,
-32845,
-32777,
-32796,
-32790,
-32870,
-32945,
-33029,
-33060,
-33019,
-32858,
-32724,
-32577,
-32575,
-32657,
-32801,
-32896,
-32909,
-32802,
-32685,
-32590,
-32586,
-32609,
-32661,
-32635,
-32582,
-32546,
-32571,
-32693,
-32849,
-32912,
-32901,
-32717,
-32552,
-32404,
-32416,
-32467,
-32606,
-32643,
-32665,
-32604,
-32584,
-32577,
-32631,
-32658,
-32659,
-32586,
-32497,
-32456,
-32436,
-32505,
-32563,
-32612,
-32630,
-32646,
-32648,
-32672,
-32677,
-32624,
-32581,
-32490,
-32475,
-32466,
-32505,
-32540,
-32575,
-32598,
-32623,
-32633,
-32640,
-32612,
-32565,
-32511,
-32485,
-32504,
-32580,
-32669,
-32740,
-32777,
-32760,
-32794,
-32786,
-32820,
-32737,
-32616,
-32457,
-32390,
-32473,
-32689,
-32860,
-32942,
-32796,
-32603,
-32448,
-32442,
-32547,
-32658,
-32678,
-32657,
-32585,
-32609,
-32655,
-32750,
-32779,
-32786,
-32784,
-32780,
-32783,
-32716,
-32614,
-32518,
-32538,
-32647,
-32826,
-32908,
-32861,
-32725,
-32570,
-32556,
-32579,
-32722,
-32772,
-32860,
-32883,
-32941,
-32949,
-32897,
-32801,
-32704,
-32708,
-32766,
-32863,
-32871,
-32791,
-32722,
-32734,
-32852,
-32993,
-33010,
-32928,
-32773,
-32756,
-32830,
-33019,
-33104,
-33078,
-32979,
-32961,
-33055,
-33190,
-33227,
-33124,
-32918,
-32799,
-32832,
-32968,
-33119,
-33119,
-33064,
-32990,
-33011,
-33072,
-33070,
-32993,
-32852,
-32841,
-32949,
-33169,
-33331,
-33339,
-33200,
-33039,
-32923,
-32939,
-32962,
-33000,
-32974,
-33000,
-33043,
-33158,
-33225,
-33225,
-33155,
-33039,
-33002,
-32973,
-32993,
-33001,
-32989,
-33001,
-33012,
-33044,
-33065,
-33046,
-33017,
-32955,
-32952,
-32925,
-32921,
-32890,
-32899,
-32930,
-33060,
-33178,
-33326,
-33321,
-33230,
-33036,
-32845,
-32766,
-32774,
-32884,
-32962,
-32963,
-32908,
-32841,
-32865,
-32964,
-33094,
-33109,
-33041,
-32901,
-32816,
-32873,
-33005,
-33142,
-33160,
-33034,
-32880,
-32733,
-32760,
-32834,
-32952,
-32993,
-32944,
-32883,
-32862,
-32945,
-33040,
-33105,
-33047,
-32854,
-32724,
-32608,
-32713,
-32824,
-32942,
-32936,
-32841,
-32697,
-32646,
-32637,
-32691,
-32746,
-32736,
-32748,
-32737,
-32808,
-32858,
-32920,
-32866,
-32770,
-32632,
-32520,
-32493,
-32519,
-32596,
-32658,
-32658,
-32623,
-32554,
-32526,
-32510,
-32526,
-32499,
-32441,
-32355,
-32316,
-32356,
-32489,
-32659,
-32754,
-32738,
-32588,
-32372,
-32236,
-32167,
-32256,
-32400,
-32527,
-32602,
-32610,
-32595,
-32615,
-32608,
-32612,
-32501,
-32386,
-32260,
-32274,
-32433,
-32633,
-32798,
-32773,
-32627,
-32470,
-32394,
-32490,
-32586,
-32621,
-32534,
-32440,
-32454,
-32654,
-32837,
-32978,
-32826,
-32637,
-32431,
-32428,
-32549,
-32666,
-32699,
-32664,
-32636,
-32736,
-32850,
-32966,
-32925,
-32801,
-32695,
-32666,
-32780,
-32872,
-32970,
-32975,
-32972,
-32958,
-32879,
-32727,
-32532,
-32362,
-32340,
-32513,
-32740,
-32932,
-32971,
-32918,
-32844,
-32845,
-32889,
-32916,
-32853,
-32733,
-32651,
-32695,
-32858,
-33051,
-33116,
-33010,
-32747,
-32519,
-32412,
-32560,
-32773,
-32988,
-33039,
-32954,
-32868,
-32820,
-32899,
-32935,
-32890,
-32709,
-32557,
-32521,
-32676,
-32868,
-32956,
-32844,
-32657,
-32497,
-32574,
-32732,
-32889,
-32892,
-32762,
-32659,
-32677,
-32845,
-33036,
-33139,
-33031,
-32849,
-32670,
-32610,
-32663,
-32782,
-32823,
-32846,
-32804,
-32812,
-32883,
-32959,
-33042,
-33012,
-32910,
-32739,
-32590,
-32540,
-32603,
-32763,
-32865,
-32945,
-32858,
-32815,
-32735,
-32813,
-32872,
-32946,
-32884,
-32771,
-32665,
-32646,
-32812,
-33006,
-33196,
-33232,
-33141,
-32949,
-32798,
-32647,
-32617,
-32572,
-32592,
-32588,
-32642,
-32698,
-32776,
-32837,
-32819,
-32804,
-32716,
-32726,
-32699,
-32745,
-32693,
-32631,
-32574,
-32574,
-32743,
-32926,
-33077,
-33020,
-32846,
-32559,
-32465,
-32456,
-32608,
-32680,
-32665,
-32540,
-32508,
-32549,
-32720,
-32865,
-32872,
-32782,
-32611,
-32530,
-32530,
-32590,
-32662,
-32692,
-32692,
-32713,
-32696,
-32721,
-32663,
-32670,
-32643,
-32653,
-32637,
-32591,
-32505,
-32503,
-32553,
-32724,
-32877,
-32929,
-32836,
-32689,
-32556,
-32556,
-32633,
-32704,
-32728,
-32665,
-32593,
-32566,
-32576,
-32619,
-32618,
-32604,
-32567,
-32571,
-32541,
-32535,
-32526,
-32557,
-32690,
-32795,
-32861,
-32737,
-32531,
-32318,
-32272,
-32416,
-32605,
-32739,
-32683,
-32535,
-32422,
-32387,
-32440,
-32449,
-32365,
-32291,
-32273,
-32373,
-32533,
-32558,
-32491,
-32317,
-32273,
-32307,
-32469,
-32507,
-32458,
-32298,
-32244,
-32288,
-32395,
-32441,
-32323,
-32205,
-32157,
-32259,
-32455,
-32538,
-32435,
-32244,
-32072,
-32157,
-32352,
-32604,
-32684,
-32606,
-32444,
-32342,
-32337,
-32426,
-32484,
-32521,
-32534,
-32545,
-32595,
-32595,
-32592,
-32518,
-32477,
-32480,
-32504,
-32568,
-32562,
-32553,
-32580,
-32665,
-32844,
-33042,
-33183,
-33257,
-33157,
-33066,
-32888,
-32828,
-32818,
-32948,
-33130,
-33277,
-33339,
-33254,
-33175,
-33079,
-33159,
-33265,
-33397,
-33392,
-33279,
-33171,
-33147,
-33325,
-33526,
-33702,
-33680,
-33549,
-33393,
-33310,
-33385,
-33467,
-33624,
-33674,
-33773,
-33818,
-33861,
-33845,
-33744,
-33677,
-33643,
-33737,
-33865,
-33952,
-33902,
-33754,
-33563,
-33432,
-33437,
-33481,
-33607,
-33634,
-33694,
-33638,
-33595,
-33508,
-33459,
-33495,
-33583,
-33698,
-33703,
-33616,
-33433,
-33342,
-33393,
-33584,
-33739,
-33763,
-33565,
-33342,
-33214,
-33288,
-33412,
-33456,
-33307,
-33083,
-32916,
-32929,
-33053,
-33154,
-33120,
-33003,
-32922,
-32936,
-33030,
-33072,
-33015,
-32905,
-32850,
-32928,
-33053,
-33102,
-32975,
-32767,
-32594,
-32598,
-32739,
-32898,
-32960,
-32833,
-32685,
-32514,
-32479,
-32474,
-32525,
-32537,
-32570,
-32582,
-32588,
-32548,
-32456,
-32361,
-32301,
-32315,
-32361,
-32403,
-32377,
-32330,
-32269,
-32271,
-32324,
-32397,
-32458,
-32446,
-32402,
-32350,
-32285,
-32282,
-32299,
-32319,
-32378,
-32361,
-32350,
-32270,
-32189,
-32166,
-32158,
-32220,
-32219,
-32201,
-32125,
-32087,
-32103,
-32171,
-32229,
-32222,
-32140,
-32096,
-32110,
-32240,
-32397,
-32473,
-32468,
-32417,
-32386,
-32446,
-32510,
-32513,
-32408,
-32224,
-32119,
-32116,
-32246,
-32394,
-32474,
-32454,
-32398,
-32334,
-32341,
-32335,
-32344,
-32320,
-32320,
-32362,
-32407,
-32460,
-32417,
-32347,
-32232,
-32163,
-32180,
-32247,
-32369,
-32475,
-32536,
-32545,
-32512,
-32448,
-32467,
-32497,
-32615,
-32695,
-32714,
-32574,
-32366,
-32134,
-32017,
-32041,
-32153,
-32311,
-32337,
-32315,
-32168,
-32082,
-32085,
-32190,
-32345,
-32464,
-32476,
-32447,
-32402,
-32421,
-32483,
-32530,
-32485,
-32388,
-32260,
-32223,
-32288,
-32398,
-32475,
-32457,
-32336,
-32276,
-32217,
-32320,
-32390,
-32479,
-32514,
-32497,
-32520,
-32552,
-32581,
-32607,
-32562,
-32506,
-32442,
-32435,
-32456,
-32544,
-32617,
-32707,
-32763,
-32814,
-32827,
-32810,
-32752,
-32653,
-32547,
-32521,
-32552,
-32697,
-32852,
-32998,
-33039,
-33048,
-33006,
-33004,
-33054,
-33109,
-33137,
-33126,
-33069,
-33039,
-33032,
-33058,
-33113,
-33130,
-33143,
-33115,
-33132,
-33143,
-33219,
-33244,
-33266,
-33234,
-33225,
-33258,
-33337,
-33454,
-33510,
-33550,
-33558,
-33578,
-33606,
-33642,
-33607,
-33516,
-33424,
-33380,
-33435,
-33581,
-33696,
-33767,
-33735,
-33654,
-33598,
-33571,
-33599,
-33590,
-33535,
-33460,
-33336,
-33326,
-33354,
-33442,
-33537,
-33548,
-33499,
-33417,
-33351,
-33351,
-33365,
-33411,
-33396,
-33377,
-33333,
-33338,
-33318,
-33345,
-33302,
-33274,
-33200,
-33163,
-33104,
-33057,
-33014,
-32964,
-32945,
-32953,
-32970,
-32987,
-32952,
-32884,
-32818,
-32753,
-32754,
-32772,
-32789,
-32772,
-32710,
-32618,
-32562,
-32543,
-32594,
-32622,
-32682,
-32688,
-32733,
-32744,
-32781,
-32712,
-32597,
-32396,
-32227,
-32148,
-32211,
-32340,
-32468,
-32520,
-32458,
-32400,
-32372,
-32416,
-32519,
-32551,
-32529,
-32439,
-32337,
-32339,
-32384,
-32484,
-32481,
-32402,
-32267,
-32212,
-32315,
-32513,
-32732,
-32780,
-32706,
-32499,
-32412,
-32417,
-32559,
-32637,
-32628,
-32476,
-32368,
-32316,
-32427,
-32545,
-32628,
-32616,
-32517,
-32451,
-32440,
-32534,
-32637,
-32768,
-32814,
-32826,
-32761,
-32648,
-32563,
-32498,
-32534,
-32611,
-32697,
-32772,
-32769,
-32792,
-32790,
-32822,
-32812,
-32749,
-32688,
-32624,
-32670,
-32743,
-32810,
-32796,
-32708,
-32642,
-32670,
-32811,
-32992,
-33057,
-32981,
-32793,
-32599,
-32570,
-32615,
-32773,
-32860,
-32910,
-32924,
-32937,
-33029,
-33086,
-33132,
-33091,
-33014,
-32939,
-32933,
-32936,
-33019,
-33014,
-33007,
-32933,
-32831,
-32755,
-32710,
-32746,
-32833,
-32940,
-33013,
-33054,
-32995,
-32967,
-32896,
-32913,
-32952,
-33026,
-33064,
-33088,
-33033,
-32977,
-32917,
-32880,
-32910,
-32980,
-33069,
-33147,
-33175,
-33127,
-33068,
-32989,
-32981,
-33014,
-33056,
-33102,
-33057,
-33036,
-32943,
-32915,
-32886,
-32868,
-32849,
-32852,
-32886,
-32956,
-33026,
-33052,
-33029,
-32945,
-32837,
-32756,
-32694,
-32687,
-32669,
-32679,
-32695,
-32709,
-32762,
-32782,
-32795,
-32771,
-32709,
-32617,
-32555,
-32441,
-32436,
-32419,
-32485,
-32544,
-32564,
-32513,
-32447,
-32365,
-32358,
-32414,
-32462,
-32523,
-32505,
-32491,
-32485,
-32539,
-32550,
-32561,
-32516,
-32484,
-32528,
-32561,
-32570,
-32472,
-32282,
-32170,
-32189,
-32401,
-32626,
-32709,
-32636,
-32432,
-32315,
-32346,
-32469,
-32567,
-32522,
-32362,
-32234,
-32212,
-32324,
-32468,
-32553,
-32583,
-32593,
-32640,
-32696,
-32686,
-32607,
-32493,
-32431,
-32501,
-32643,
-32783,
-32798,
-32720,
-32576,
-32491,
-32478,
-32494,
-32515,
-32509,
-32506,
-32507,
-32566,
-32586,
-32655,
-32657,
-32728,
-32762,
-32844,
-32884,
-32902,
-32899,
-32883,
-32856,
-32819,
-32764,
-32708,
-32744,
-32799,
-32910,
-32919,
-32831,
-32618,
-32462,
-32411,
-32520,
-32717,
-32825,
-32876,
-32782,
-32795,
-32819,
-32974,
-33064,
-33051,
-32942,
-32784,
-32717,
-32736,
-32838,
-32923,
-32926,
-32856,
-32754,
-32751,
-32778,
-32896,
-32909,
-32841,
-32684,
-32529,
-32487,
-32549,
-32676,
-32732,
-32762,
-32707,
-32749,
-32780,
-32890,
-32879,
-32843,
-32761,
-32753,
-32804,
-32861,
-32833,
-32679,
-32558,
-32487,
-32637,
-32835,
-32988,
-32997,
-32853,
-32721,
-32654,
-32740,
-32829,
-32901,
-32833,
-32735,
-32610,
-32563,
-32533,
-32540,
-32556,
-32548,
-32589,
-32615,
-32638,
-32630,
-32555,
-32522,
-32525,
-32653,
-32799,
-32959,
-32967,
-32886,
-32689,
-32630,
-32676,
-32932,
-33204,
-33362,
-33325,
-33078,
-32799,
-32596,
-32570,
-32681,
-32791,
-32871,
-32774,
-32678,
-32504,
-32472,
-32493,
-32582,
-32690,
-32736,
-32709,
-32640,
-32541,
-32545,
-32569,
-32632,
-32623,
-32563,
-32428,
-32424,
-32473,
-32661,
-32818,
-32867,
-32826,
-32768,
-32820,
-32987,
-33203,
-33275,
-33189,
-32944,
-32730,
-32639,
-32726,
-32871,
-32971,
-32958,
-32843,
-32757,
-32735,
-32790,
-32876,
-32917,
-32881,
-32796,
-32669,
-32593,
-32535,
-32594,
-32629,
-32765,
-32828,
-32937,
-32917,
-32893,
-32789,
-32707,
-32706,
-32767,
-32882,
-32980,
-32942,
-32916,
-32838,
-32894,
-33029,
-33161,
-33222,
-33129,
-32999,
-32885,
-32904,
-33010,
-33097,
-33120,
-33019,
-32918,
-32844,
-32866,
-32928,
-32986,
-33011,
-32999,
-32971,
-32943,
-32895,
-32834,
-32848,
-32849,
-32953,
-33008,
-33031,
-32991,
-32998,
-33041,
-33128,
-33176,
-33083,
-32938,
-32824,
-32865,
-33052,
-33249,
-33277,
-33150,
-32956,
-32893,
-32989,
-33174,
-33249,
-33137,
-32954,
-32815,
-32850,
-32981,
-33032,
-32907,
-32691,
-32524,
-32557,
-32776,
-32945,
-33018,
-32872,
-32712,
-32642,
-32753,
-32982,
-33165,
-33265,
-33213,
-33110,
-33045,
-33012,
-33035,
-33002,
-32969,
-32856,
-32798,
-32762,
-32804,
-32867,
-32904,
-32871,
-32814,
-32723,
-32667,
-32613,
-32599,
-32598,
-32611,
-32637,
-32675,
-32679,
-32629,
-32552,
-32453,
-32473,
-32536,
-32730,
-32874,
-32976,
-32998,
-32944,
-32898,
-32907,
-32890,
-32925,
-32856,
-32797,
-32696,
-32617,
-32616,
-32688,
-32786,
-32914,
-32917,
-32876,
-32753,
-32613,
-32598,
-32608,
-32736,
-32757,
-32741,
-32603,
-32497,
-32456,
-32536,
-32668,
-32742,
-32722,
-32559,
-32413,
-32315,
-32348,
-32484,
-32597,
-32619,
-32550,
-32410,
-32353,
-32347,
-32462,
-32578,
-32639,
-32633,
-32596,
-32588,
-32714,
-32831,
-33017,
-33059,
-33014,
-32892,
-32746,
-32645,
-32617,
-32584,
-32624,
-32557,
-32542,
-32407,
-32373,
-32319,
-32380,
-32480,
-32577,
-32627,
-32566,
-32481,
-32395,
-32434,
-32502,
-32615,
-32612,
-32553,
-32487,
-32473,
-32601,
-32746,
-32861,
-32863,
-32811,
-32795,
-32881,
-33070,
-33224,
-33299,
-33209,
-33033,
-32868,
-32774,
-32771,
-32811,
-32830,
-32795,
-32726,
-32651,
-32654,
-32683,
-32774,
-32831,
-32887,
-32882,
-32896,
-32878,
-32875,
-32868,
-32820,
-32837,
-32829,
-32913,
-32897,
-32920,
-32877,
-32901,
-32997,
-33153,
-33239,
-33242,
-33106,
-32980,
-32937,
-33050,
-33184,
-33259,
-33204,
-33087,
-33006,
-33020,
-33063,
-33043,
-32935,
-32802,
-32760,
-32880,
-33051,
-33179,
-33091,
-32937,
-32759,
-32783,
-32977,
-33234,
-33350,
-33253,
-32998,
-32818,
-32856,
-33166,
-33517,
-33707,
-33566,
-33177,
-32785,
-32616,
-32720,
-32971,
-33071,
-33011,
-32750,
-32615,
-32667,
-32910,
-33152,
-33205,
-33050,
-32796,
-32646,
-32667,
-32812,
-32943,
-32934,
-32837,
-32724,
-32728,
-32866,
-33036,
-33134,
-33100,
-32930,
-32816,
-32798,
-32919,
-33114,
-33181,
-33122,
-32944,
-32762,
-32686,
-32663,
-32690,
-32639,
-32521,
-32431,
-32388,
-32481,
-32620,
-32720,
-32738,
-32669,
-32589,
-32564,
-32600,
-32682,
-32661,
-32641,
-32492,
-32459,
-32458,
-32585,
-32728,
-32795,
-32753,
-32604,
-32460,
-32375,
-32423,
-32525,
-32623,
-32645,
-32564,
-32433,
-32354,
-32338,
-32378,
-32417,
-32404,
-32351,
-32348,
-32394,
-32493,
-32555,
-32517,
-32351,
-32221,
-32150,
-32225,
-32309,
-32344,
-32226,
-32113,
-32083,
-32190,
-32439,
-32569,
-32607,
-32450,
-32306,
-32213,
-32218,
-32286,
-32277,
-32267,
-32200,
-32234,
-32270,
-32362,
-32362,
-32333,
-32287,
-32283,
-32366,
-32450,
-32536,
-32539,
-32512,
-32481,
-32500,
-32554,
-32588,
-32540,
-32409,
-32250,
-32153,
-32203,
-32347,
-32518,
-32594,
-32590,
-32491,
-32481,
-32535,
-32654,
-32747,
-32669,
-32531,
-32338,
-32277,
-32327,
-32492,
-32628,
-32686,
-32645,
-32569,
-32523,
-32573,
-32673,
-32775,
-32822,
-32784,
-32745,
-32712,
-32765,
-32864,
-32938,
-33027,
-33044,
-33050,
-33064,
-33059,
-33067,
-33066,
-33066,
-33068,
-33086,
-33106,
-33078,
-33074,
-32984,
-32961,
-32914,
-32887,
-32875,
-32862,
-32895,
-32952,
-33046,
-33104,
-33138,
-33073,
-33014,
-32939,
-32995,
-33091,
-33248,
-33363,
-33377,
-33281,
-33162,
-33033,
-33028,
-33091,
-33187,
-33264,
-33231,
-33188,
-33075,
-33031,
-32963,
-32959,
-32934,
-33012,
-33103,
-33288,
-33399,
-33473,
-33394,
-33321,
-33218,
-33234,
-33228,
-33183,
-33040,
-32824,
-32683,
-32605,
-32680,
-32789,
-32868,
-32922,
-32879,
-32855,
-32794,
-32743,
-32715,
-32714,
-32726,
-32763,
-32706,
-32598,
-32464,
-32420,
-32551,
-32834,
-33132,
-33339,
-33357,
-33301,
-33250,
-33322,
-33401,
-33500,
-33386,
-33269,
-33063,
-32958,
-32857,
-32752,
-32576,
-32385,
-32294,
-32382,
-32646,
-32991,
-33252,
-33375,
-33369,
-33253,
-33174,
-33081,
-33050,
-32967,
-32918,
-32820,
-32789,
-32745,
-32755,
-32718,
-32700,
-32680,
-32737,
-32868,
-33065,
-33248,
-33334,
-33317,
-33166,
-33028,
-32898,
-32880,
-32889,
-32949,
-32957,
-32952,
-32915,
-32865,
-32817,
-32853,
-32948,
-33163,
-33376,
-33507,
-33461,
-33306,
-33090,
-32976,
-32957,
-32946,
-32910,
-32781,
-32679,
-32698,
-32812,
-32937,
-32909,
-32708,
-32441,
-32246,
-32286,
-32405,
-32536,
-32496,
-32359,
-32177,
-32161,
-32215,
-32372,
-32436,
-32436,
-32367,
-32365,
-32391,
-32465,
-32488,
-32435,
-32365,
-32335,
-32404,
-32545,
-32655,
-32670,
-32555,
-32372,
-32244,
-32243,
-32388,
-32546,
-32661,
-32636,
-32564,
-32457,
-32455,
-32457,
-32484,
-32374,
-32248,
-32085,
-32018,
-32017,
-32057,
-32079,
-32035,
-31991,
-31991,
-32069,
-32229,
-32419,
-32549,
-32631,
-32618,
-32587,
-32573,
-32611,
-32686,
-32771,
-32858,
-32896,
-32973,
-32994,
-33068,
-33102,
-33133,
-33140,
-33156,
-33147,
-33179,
-33159,
-33136,
-33078,
-32978,
-32911,
-32809,
-32733,
-32667,
-32607,
-32594,
-32601,
-32649,
-32707,
-32766,
-32792,
-32816,
-32850,
-32900,
-32982,
-33068,
-33138,
-33185,
-33169,
-33142,
-33121,
-33112,
-33192,
-33254,
-33361,
-33411,
-33420,
-33396,
-33331,
-33276,
-33259,
-33236,
-33260,
-33229,
-33187,
-33115,
-33030,
-32938,
-32879,
-32815,
-32794,
-32762,
-32743,
-32700,
-32672,
-32665,
-32683,
-32759,
-32806,
-32859,
-32835,
-32801,
-32758,
-32738,
-32768,
-32800,
-32834,
-32823,
-32822,
-32813,
-32866,
-32909,
-32961,
-32952,
-32942,
-32896,
-32889,
-32889,
-32878,
-32862,
-32803,
-32799,
-32749,
-32802,
-32764,
-32762,
-32705,
-32628,
-32592,
-32558,
-32588,
-32601,
-32600,
-32605,
-32581,
-32578,
-32614,
-32643,
-32717,
-32774,
-32818,
-32876,
-32919,
-33001,
-33070,
-33128,
-33183,
-33176,
-33179,
-33131,
-33116,
-33055,
-33014,
-32940,
-32874,
-32791,
-32755,
-32685,
-32680,
-32608,
-32578,
-32506,
-32485,
-32488,
-32527,
-32567,
-32602,
-32634,
-32654,
-32724,
-32760,
-32839,
-32845,
-32832,
-32799,
-32813,
-32825,
-32928,
-32954,
-32991,
-32931,
-32908,
-32857,
-32860,
-32842,
-32834,
-32797,
-32756,
-32724,
-32702,
-32694,
-32667,
-32643,
-32592,
-32541,
-32472,
-32386,
-32319,
-32212,
-32154,
-32094,
-32100,
-32111,
-32171,
-32177,
-32205,
-32163,
-32139,
-32108,
-32132,
-32178,
-32235,
-32294,
-32302,
-32330,
-32329,
-32372,
-32423,
-32489,
-32515,
-32517,
-32463,
-32405,
-32347,
-32329,
-32303,
-32303,
-32289,
-32270,
-32258,
-32258,
-32240,
-32224,
-32170,
-32105,
-32039,
-32019,
-32020,
-32046,
-32063,
-32062,
-32044,
-32013,
-32040,
-32052,
-32157,
-32201,
-32321,
-32368,
-32431,
-32506,
-32530,
-32599,
-32593,
-32623,
-32618,
-32659,
-32670,
-32710,
-32680,
-32668,
-32593,
-32593,
-32585,
-32656,
-32701,
-32769,
-32732,
-32716,
-32641,
-32623,
-32615,
-32657,
-32651,
-32655,
-32597,
-32536,
-32519,
-32502,
-32535,
-32557,
-32551,
-32556,
-32538,
-32554,
-32579,
-32608,
-32620,
-32623,
-32596,
-32613,
-32576,
-32599,
-32567,
-32581,
-32567,
-32579,
-32600,
-32613,
-32628,
-32580,
-32553,
-32475,
-32417,
-32379,
-32328,
-32308,
-32240,
-32203,
-32140,
-32130,
-32154,
-32188,
-32216,
-32187,
-32144,
-32039,
-31990,
-31961,
-31978,
-32028,
-32054,
-32053,
-32029,
-32022,
-32033,
-32072,
-32119,
-32104,
-32090,
-32050,
-32028,
-32050,
-32049,
-32040,
-31979,
-31973,
-31992,
-32087,
-32163,
-32212,
-32168,
-32138,
-32106,
-32196,
-32283,
-32365,
-32374,
-32286,
-32238,
-32212,
-32247,
-32305,
-32310,
-32297,
-32279,
-32281,
-32343,
-32432,
-32515,
-32571,
-32582,
-32586,
-32591,
-32592,
-32641,
-32649,
-32707,
-32722,
-32819,
-32846,
-32943,
-32984,
-33006,
-33063,
-33064,
-33163,
-33223,
-33341,
-33405,
-33450,
-33460,
-33447,
-33456,
-33528,
-33572,
-33680,
-33730,
-33765,
-33808,
-33814,
-33906,
-33960,
-34098,
-34156,
-34250,
-34277,
-34329,
-34374,
-34422,
-34504,
-34577,
-34639,
-34712,
-34749,
-34774,
-34787,
-34767,
-34748,
-34729,
-34731,
-34756,
-34766,
-34798,
-34779,
-34805,
-34807,
-34834,
-34879,
-34918,
-34991,
-35021,
-35065,
-35093,
-35109,
-35152,
-35197,
-35266,
-35340,
-35371,
-35395,
-35356,
-35314,
-35285,
-35249,
-35265,
-35222,
-35211,
-35111,
-35023,
-34942,
-34835,
-34834,
-34750,
-34751,
-34677,
-34666,
-34615,
-34609,
-34614,
-34611,
-34640,
-34628,
-34628,
-34631,
-34622,
-34606,
-34590,
-34545,
-34526,
-34502,
-34489,
-34463,
-34405,
-34328,
-34192,
-34105,
-33993,
-33933,
-33864,
-33790,
-33718,
-33627,
-33561,
-33491,
-33445,
-33378,
-33341,
-33299,
-33292,
-33291,
-33323,
-33341,
-33394,
-33426,
-33494,
-33537,
-33575,
-33597,
-33579,
-33586,
-33550,
-33525,
-33451,
-33369,
-33270,
-33189,
-33102,
-33048,
-32950,
-32879,
-32763,
-32663,
-32593,
-32511,
-32473,
-32407,
-32393,
-32343,
-32356,
-32352,
-32368,
-32343,
-32333,
-32270,
-32278,
-32258,
-32289,
-32302,
-32330,
-32314,
-32318,
-32293,
-32310,
-32319,
-32328,
-32343,
-32341,
-32326,
-32311,
-32280,
-32254,
-32229,
-32207,
-32212,
-32199,
-32237,
-32213,
-32223,
-32156,
-32114,
-32042,
-31988,
-31899,
-31823,
-31678,
-31535,
-31365,
-31179,
-31017,
-30833,
-30649,
-30468,
-30288,
-30101,
-29941,
-29751,
-29602,
-29456,
-29337,
-29267,
-29222,
-29197,
-29188,
-29176,
-29188,
-29185,
-29234,
-29231,
-29285,
-29304,
-29389,
-29451,
-29575,
-29642,
-29762,
-29798,
-29894,
-29877,
-29896,
-29793,
-29643,
-29467,
-29211,
-29004,
-28727,
-28503,
-28222,
-28014,
-27802,
-27641,
-27509,
-27353,
-27192,
-27016,
-26864,
-26724,
-26651,
-26560,
-26546,
-26484,
-26511,
-26508,
-26575,
-26599,
-26631,
-26658,
-26648,
-26691,
-26705,
-26745,
-26763,
-26772,
-26763,
-26753,
-26723,
-26711,
-26655,
-26613,
-26578,
-26573,
-26657,
-26802,
-27050,
-27375,
-27772,
-28211,
-28699,
-29217,
-29739,
-30309,
-30864,
-31447,
-31992,
-32562,
-33072,
-33595,
-34106,
-34541,
-34963,
-35266,
-35469,
-35583,
-35568,
-35507,
-35387,
-35256,
-35123,
-34986,
-34863,
-34757,
-34639,
-34547,
-34458,
-34434,
-34478,
-34616,
-34846,
-35175,
-35559,
-36017,
-36498,
-37008,
-37559,
-38085,
-38618,
-39115,
-39566,
-40019,
-40407,
-40817,
-41166,
-41487,
-41713,
-41845,
-41858,
-41728,
-41507,
-41187,
-40819,
-40419,
-40003,
-39594,
-39188,
-38836,
-38482,
-38167,
-37826,
-37501,
-37149,
-36800,
-36437,
-36130,
-35826,
-35614,
-35462,
-35380,
-35387,
-35407,
-35464,
-35479,
-35488,
-35484,
-35453,
-35492,
-35479,
-35531,
-35514,
-35523,
-35514,
-35517,
-35490,
-35477,
-35362,
-35236,
-35017,
-34773,
-34478,
-34171,
-33796,
-33441,
-33043,
-32640,
-32234,
-31792,
-31344,
-30889,
-30423,
-29992,
-29596,
-29228,
-28893,
-28597,
-28312,
-28121,
-27963,
-27937,
-27954,
-28083,
-28209,
-28429,
-28617,
-28908,
-29204,
-29562,
-29932,
-30300,
-30657,
-30988,
-31308,
-31628,
-31930,
-32237,
-32498,
-32771,
-32951,
-33111,
-33192,
-33222,
-33228,
-33228,
-33255,
-33293,
-33366,
-33416,
-33492,
-33548,
-33621,
-33679,
-33741,
-33820,
-33905,
-34016,
-34143,
-34275,
-34447,
-34614,
-34837,
-35097,
-35377,
-35650,
-35879,
-36072,
-36215,
-36402,
-36557,
-36787,
-36936,
-37153,
-37312,
-37515,
-37752,
-37951,
-38193,
-38357,
-38504,
-38643,
-38748,
-38874,
-38951,
-38995,
-39033,
-39028,
-39036,
-38999,
-38945,
-38774,
-38609,
-38301,
-38039,
-37725,
-37418,
-37120,
-36783,
-36484,
-36154,
-35900,
-35655,
-35478,
-35310,
-35201,
-35074,
-35002,
-34936,
-34912,
-34929,
-34956,
-35038,
-35098,
-35205,
-35292,
-35404,
-35458,
-35505,
-35463,
-35383,
-35273,
-35091,
-34927,
-34697,
-34428,
-34111,
-33745,
-33367,
-32987,
-32639,
-32261,
-31934,
-31547,
-31253,
-30959,
-30778,
-30605,
-30479,
-30370,
-30303,
-30289,
-30340,
-30415,
-30527,
-30581,
-30693,
-30785,
-30973,
-31154,
-31337,
-31496,
-31601,
-31692,
-31785,
-31860,
-31915,
-31948,
-31890,
-31860,
-31748,
-31670,
-31531,
-31391,
-31212,
-31046,
-30870,
-30691,
-30487,
-30262,
-30017,
-29770,
-29516,
-29292,
-29082,
-28853,
-28661,
-28442,
-28250,
-28087,
-27925,
-27814,
-27694,
-27628,
-27559,
-27490,
-27440,
-27360,
-27316,
-27310,
-27347,
-27422,
-27509,
-27594,
-27659,
-27733,
-27758,
-27817,
-27811,
-27803,
-27728,
-27632,
-27534,
-27416,
-27330,
-27218,
-27092,
-26976,
-26788,
-26659,
-26452,
-26249,
-26041,
-25767,
-25553,
-25310,
-25163,
-25022,
-24951,
-24850,
-24755,
-24641,
-24546,
-24442,
-24372,
-24255,
-24151,
-24007,
-23918,
-23811,
-23790,
-23710,
-23675,
-23548,
-23491,
-23394,
-23400,
-23440,
-23572,
-23767,
-24090,
-24517,
-25115,
-25819,
-26652,
-27490,
-28367,
-29196,
-30069,
-30917,
-31822,
-32685,
-33517,
-34274,
-34961,
-35594,
-36117,
-36545,
-36796,
-36874,
-36803,
-36613,
-36365,
-36073,
-35711,
-35352,
-34975,
-34669,
-34450,
-34301,
-34246,
-34224,
-34314,
-34537,
-34928,
-35470,
-36146,
-36904,
-37798,
-38756,
-39796,
-40825,
-41787,
-42629,
-43393,
-44075,
-44716,
-45267,
-45675,
-45898,
-45995,
-45949,
-45785,
-45465,
-44929,
-44213,
-43363,
-42495,
-41668,
-40871,
-40083,
-39291,
-38521,
-37866,
-37322,
-36867,
-36412,
-35930,
-35436,
-35035,
-34762,
-34655,
-34624,
-34664,
-34708,
-34825,
-34956,
-35129,
-35233,
-35277,
-35218,
-35144,
-35061,
-35001,
-34940,
-34841,
-34707,
-34541,
-34363,
-34155,
-33903,
-33558,
-33133,
-32628,
-32089,
-31512,
-30944,
-30346,
-29760,
-29162,
-28541,
-27948,
-27294,
-26702,
-26088,
-25581,
-25146,
-24802,
-24558,
-24392,
-24324,
-24388,
-24530,
-24810,
-25147,
-25554,
-26036,
-26549,
-27154,
-27773,
-28439,
-29075,
-29678,
-30237,
-30723,
-31173,
-31511,
-31806,
-31976,
-32078,
-32097,
-32090,
-32021,
-31972,
-31832,
-31701,
-31518,
-31384,
-31310,
-31316,
-31440,
-31567,
-31843,
-32135,
-32569,
-33088,
-33672,
-34248,
-34869,
-35425,
-36086,
-36725,
-37452,
-38098,
-38729,
-39266,
-39760,
-40200,
-40583,
-40880,
-41058,
-41134,
-41130,
-41073,
-41005,
-40902,
-40789,
-40629,
-40465,
-40266,
-40078,
-39866,
-39645,
-39413,
-39147,
-38929,
-38666,
-38485,
-38276,
-38108,
-37925,
-37735,
-37548,
-37373,
-37205,
-37044,
-36900,
-36737,
-36593,
-36459,
-36355,
-36283,
-36263,
-36234,
-36228,
-36177,
-36134,
-36095,
-36066,
-36030,
-35990,
-35868,
-35708,
-35484,
-35218,
-34950,
-34591,
-34217,
-33740,
-33272,
-32750,
-32270,
-31728,
-31213,
-30630,
-30110,
-29597,
-29215,
-28881,
-28602,
-28408,
-28252,
-28249,
-28368,
-28597,
-28923,
-29260,
-29618,
-30024,
-30439,
-30916,
-31358,
-31816,
-32175,
-32543,
-32818,
-33092,
-33294,
-33403,
-33451,
-33413,
-33314,
-33201,
-33010,
-32819,
-32575,
-32303,
-32042,
-31799,
-31635,
-31518,
-31470,
-31434,
-31483,
-31533,
-31732,
-31938,
-32272,
-32593,
-32951,
-33308,
-33655,
-34043,
-34391,
-34753,
-35036,
-35301,
-35515,
-35692,
-35848,
-35925,
-35958,
-35888,
-35769,
-35573,
-35367,
-35126,
-34848,
-34541,
-34173,
-33805,
-33426,
-33045,
-32706,
-32341,
-31995,
-31605,
-31240,
-30836,
-30491,
-30116,
-29769,
-29406,
-29066,
-28743,
-28462,
-28214,
-27983,
-27792,
-27598,
-27441,
-27329,
-27216,
-27152,
-27054,
-26985,
-26900,
-26840,
-26790,
-26751,
-26716,
-26688,
-26582,
-26521,
-26337,
-26189,
-25956,
-25732,
-25456,
-25177,
-24856,
-24556,
-24240,
-23941,
-23684,
-23416,
-23198,
-22949,
-22716,
-22497,
-22303,
-22159,
-22055,
-21980,
-21958,
-21924,
-21954,
-21975,
-22044,
-22098,
-22185,
-22258,
-22420,
-22618,
-22933,
-23346,
-23859,
-24538,
-25292,
-26243,
-27252,
-28400,
-29543,
-30709,
-31847,
-32960,
-34089,
-35218,
-36326,
-37375,
-38307,
-39081,
-39724,
-40191,
-40498,
-40619,
-40523,
-40233,
-39787,
-39259,
-38672,
-38098,
-37461,
-36896,
-36324,
-35905,
-35631,
-35480,
-35531,
-35666,
-36006,
-36535,
-37281,
-38262,
-39334,
-40537,
-41750,
-42998,
-44222,
-45387,
-46394,
-47281,
-47976,
-48521,
-48937,
-49144,
-49192,
-48953,
-48510,
-47819,
-46946,
-45894,
-44676,
-43381,
-42033,
-40715,
-39490,
-38340,
-37316,
-36359,
-35526,
-34798,
-34200,
-33714,
-33313,
-32997,
-32798,
-32702,
-32792,
-32921,
-33190,
-33392,
-33668,
-33865,
-34104,
-34232,
-34330,
-34288,
-34207,
-34095,
-33950,
-33837,
-33599,
-33348,
-32939,
-32490,
-31977,
-31393,
-30773,
-30047,
-29328,
-28547,
-27821,
-27082,
-26340,
-25612,
-24871,
-24207,
-23596,
-23091,
-22642,
-22313,
-22062,
-21937,
-21980,
-22152,
-22510,
-22943,
-23480,
-24095,
-24749,
-25528,
-26337,
-27247,
-28163,
-29063,
-29938,
-30711,
-31417,
-31968,
-32418,
-32711,
-32882,
-32948,
-32918,
-32847,
-32694,
-32498,
-32255,
-31968,
-31708,
-31462,
-31286,
-31153,
-31088,
-31161,
-31319,
-31690,
-32160,
-32781,
-33460,
-34222,
-34989,
-35814,
-36632,
-37425,
-38210,
-38909,
-39559,
-40135,
-40623,
-41047,
-41333,
-41519,
-41542,
-41443,
-41209,
-40882,
-40508,
-40089,
-39665,
-39229,
-38778,
-38345,
-37892,
-37486,
-37076,
-36723,
-36393,
-36096,
-35854,
-35625,
-35458,
-35313,
-35188,
-35072,
-34953,
-34795,
-34637,
-34426,
-34198,
-33945,
-33671,
-33441,
-33197,
-33018,
-32805,
-32620,
-32384,
-32163,
-31928,
-31725,
-31553,
-31403,
-31285,
-31139,
-31031,
-30873,
-30736,
-30589,
-30421,
-30235,
-30045,
-29822,
-29631,
-29439,
-29290,
-29158,
-29042,
-28954,
-28877,
-28837,
-28850,
-28873,
-28975,
-29053,
-29250,
-29447,
-29771,
-30119,
-30542,
-30984,
-31440,
-31885,
-32341,
-32771,
-33180,
-33539,
-33902,
-34192,
-34477,
-34720,
-34913,
-35108,
-35226,
-35332,
-35426,
-35482,
-35546,
-35576,
-35620,
-35620,
-35638,
-35651,
-35641,
-35682,
-35694,
-35738,
-35794,
-35849,
-35957,
-36051,
-36175,
-36291,
-36394,
-36477,
-36570,
-36605,
-36690,
-36701,
-36766,
-36758,
-36817,
-36815,
-36861,
-36838,
-36814,
-36726,
-36601,
-36430,
-36232,
-35973,
-35728,
-35419,
-35124,
-34805,
-34434,
-34049,
-33608,
-33128,
-32641,
-32143,
-31643,
-31157,
-30671,
-30192,
-29731,
-29311,
-28877,
-28526,
-28130,
-27810,
-27445,
-27124,
-26784,
-26491,
-26178,
-25920,
-25636,
-25398,
-25133,
-24883,
-24637,
-24403,
-24168,
-23973,
-23776,
-23600,
-23444,
-23271,
-23144,
-22989,
-22874,
-22739,
-22649,
-22563,
-22521,
-22520,
-22548,
-22637,
-22746,
-22911,
-23104,
-23310,
-23541,
-23748,
-23959,
-24152,
-24378,
-24613,
-24871,
-25130,
-25332,
-25527,
-25615,
-25721,
-25747,
-25781,
-25770,
-25741,
-25676,
-25595,
-25504,
-25430,
-25372,
-25359,
-25387,
-25468,
-25679,
-25960,
-26418,
-27029,
-27826,
-28831,
-30066,
-31495,
-33089,
-34717,
-36342,
-37859,
-39335,
-40684,
-41989,
-43160,
-44196,
-45024,
-45675,
-46109,
-46358,
-46364,
-46129,
-45593,
-44840,
-43887,
-42826,
-41700,
-40564,
-39424,
-38406,
-37508,
-36788,
-36258,
-35877,
-35674,
-35642,
-35798,
-36202,
-36797,
-37612,
-38564,
-39669,
-40820,
-42043,
-43201,
-44257,
-45127,
-45777,
-46253,
-46523,
-46706,
-46685,
-46570,
-46267,
-45764,
-45100,
-44180,
-43100,
-41810,
-40412,
-38915,
-37438,
-35989,
-34682,
-33467,
-32435,
-31536,
-30766,
-30132,
-29550,
-29027,
-28599,
-28190,
-27979,
-27852,
-27937,
-28165,
-28533,
-29002,
-29526,
-30045,
-30583,
-31035,
-31468,
-31769,
-32070,
-32261,
-32474,
-32634,
-32762,
-32809,
-32740,
-32531,
-32171,
-31664,
-31050,
-30316,
-29545,
-28750,
-27936,
-27184,
-26383,
-25645,
-24910,
-24257,
-23708,
-23316,
-23019,
-22917,
-22910,
-23103,
-23460,
-24049,
-24769,
-25653,
-26543,
-27516,
-28433,
-29427,
-30353,
-31311,
-32212,
-33048,
-33787,
-34393,
-34842,
-35115,
-35199,
-35150,
-34925,
-34666,
-34278,
-33924,
-33500,
-33103,
-32687,
-32309,
-32002,
-31740,
-31596,
-31499,
-31529,
-31659,
-31948,
-32418,
-33032,
-33780,
-34569,
-35381,
-36150,
-36913,
-37613,
-38288,
-38877,
-39391,
-39828,
-40202,
-40520,
-40761,
-40921,
-40938,
-40833,
-40580,
-40225,
-39770,
-39252,
-38704,
-38114,
-37580,
-37022,
-36527,
-35998,
-35514,
-34999,
-34527,
-34099,
-33702,
-33367,
-33071,
-32851,
-32674,
-32579,
-32530,
-32534,
-32546,
-32582,
-32607,
-32667,
-32685,
-32763,
-32807,
-32890,
-32984,
-33051,
-33098,
-33069,
-32985,
-32837,
-32672,
-32492,
-32301,
-32122,
-31888,
-31650,
-31370,
-31082,
-30798,
-30470,
-30223,
-29928,
-29754,
-29625,
-29584,
-29667,
-29782,
-30025,
-30295,
-30636,
-31024,
-31430,
-31880,
-32331,
-32797,
-33293,
-33811,
-34359,
-34921,
-35461,
-35979,
-36410,
-36786,
-37025,
-37248,
-37366,
-37496,
-37555,
-37631,
-37636,
-37650,
-37602,
-37529,
-37441,
-37284,
-37138,
-36930,
-36784,
-36602,
-36517,
-36426,
-36375,
-36369,
-36345,
-36373,
-36394,
-36407,
-36463,
-36473,
-36557,
-36679,
-36844,
-37088,
-37298,
-37532,
-37718,
-37910,
-38046,
-38175,
-38210,
-38242,
-38160,
-38088,
-37932,
-37780,
-37498,
-37209,
-36755,
-36252,
-35657,
-35005,
-34307,
-33603,
-32848,
-32144,
-31395,
-30698,
-30003,
-29335,
-28708,
-28126,
-27609,
-27181,
-26795,
-26516,
-26266,
-26103,
-25970,
-25866,
-25782,
-25698,
-25601,
-25486,
-25357,
-25184,
-25034,
-24850,
-24655,
-24421,
-24156,
-23867,
-23524,
-23211,
-22864,
-22568,
-22285,
-22001,
-21804,
-21573,
-21472,
-21345,
-21306,
-21273,
-21271,
-21268,
-21317,
-21379,
-21507,
-21712,
-21952,
-22272,
-22595,
-22954,
-23305,
-23649,
-24000,
-24330,
-24686,
-25055,
-25406,
-25784,
-26102,
-26408,
-26658,
-26853,
-27023,
-27149,
-27254,
-27315,
-27297,
-27224,
-27088,
-26917,
-26751,
-26621,
-26504,
-26494,
-26525,
-26705,
-27073,
-27627,
-28462,
-29473,
-30766,
-32228,
-33825,
-35552,
-37202,
-38858,
-40352,
-41779,
-43094,
-44322,
-45415,
-46302,
-46960,
-47319,
-47430,
-47244,
-46781,
-46005,
-44983,
-43739,
-42425,
-41051,
-39727,
-38433,
-37234,
-36203,
-35355,
-34752,
-34343,
-34091,
-34016,
-34141,
-34507,
-35184,
-36084,
-37152,
-38339,
-39505,
-40738,
-41830,
-42846,
-43581,
-44085,
-44366,
-44505,
-44546,
-44534,
-44330,
-43984,
-43369,
-42577,
-41582,
-40413,
-39077,
-37620,
-36085,
-34584,
-33214,
-31983,
-30969,
-30048,
-29297,
-28615,
-28054,
-27546,
-27087,
-26708,
-26396,
-26277,
-26317,
-26598,
-27057,
-27681,
-28395,
-29176,
-29925,
-30683,
-31333,
-31947,
-32501,
-33016,
-33526,
-33964,
-34345,
-34591,
-34718,
-34670,
-34436,
-34030,
-33352,
-32582,
-31625,
-30693,
-29723,
-28814,
-27883,
-26975,
-26087,
-25289,
-24612,
-24098,
-23748,
-23580,
-23612,
-23848,
-24317,
-24999,
-25848,
-26823,
-27861,
-28913,
-29987,
-31014,
-32020,
-32955,
-33829,
-34584,
-35231,
-35715,
-36037,
-36137,
-36058,
-35761,
-35349,
-34832,
-34289,
-33776,
-33268,
-32830,
-32411,
-32032,
-31702,
-31435,
-31269,
-31199,
-31265,
-31446,
-31739,
-32188,
-32748,
-33454,
-34243,
-35033,
-35797,
-36453,
-37035,
-37550,
-38009,
-38436,
-38798,
-39115,
-39388,
-39614,
-39789,
-39865,
-39811,
-39598,
-39231,
-38794,
-38260,
-37752,
-37194,
-36646,
-36081,
-35522,
-34960,
-34405,
-33833,
-33231,
-32655,
-32064,
-31566,
-31143,
-30823,
-30587,
-30474,
-30414,
-30480,
-30581,
-30763,
-30973,
-31241,
-31523,
-31843,
-32166,
-32475,
-32765,
-33017,
-33225,
-33346,
-33438,
-33344,
-33256,
-32986,
-32728,
-32413,
-32089,
-31785,
-31509,
-31246,
-31031,
-30814,
-30624,
-30422,
-30281,
-30228,
-30304,
-30576,
-30954,
-31499,
-32090,
-32758,
-33492,
-34221,
-34984,
-35626,
-36275,
-36803,
-37386,
-37914,
-38429,
-38883,
-39252,
-39550,
-39793,
-39968,
-40041,
-39969,
-39791,
-39499,
-39270,
-39043,
-38928,
-38799,
-38675,
-38557,
-38416,
-38362,
-38210,
-38099,
-37834,
-37620,
-37420,
-37341,
-37401,
-37522,
-37691,
-37842,
-37974,
-38070,
-38126,
-38155,
-38117,
-38084,
-38057,
-38078,
-38120,
-38207,
-38251,
-38291,
-38249,
-38196,
-38024,
-37781,
-37365,
-36908,
-36331,
-35802,
-35198,
-34634,
-34005,
-33395,
-32720,
-32043,
-31315,
-30555,
-29801,
-29068,
-28422,
-27852,
-27340,
-26899,
-26459,
-26087,
-25762,
-25511,
-25338,
-25160,
-25012,
-24858,
-24710,
-24621,
-24536,
-24433,
-24327,
-24139,
-23971,
-23766,
-23609,
-23440,
-23282,
-23126,
-22939,
-22777,
-22597,
-22419,
-22265,
-22093,
-21972,
-21891,
-21839,
-21871,
-21923,
-22014,
-22141,
-22234,
-22394,
-22477,
-22620,
-22664,
-22752,
-22807,
-22969,
-23217,
-23582,
-24015,
-24479,
-24885,
-25296,
-25610,
-25983,
-26314,
-26704,
-27044,
-27414,
-27744,
-28067,
-28342,
-28592,
-28755,
-28882,
-28894,
-28868,
-28720,
-28511,
-28221,
-27867,
-27559,
-27308,
-27196,
-27231,
-27389,
-27713,
-28152,
-28808,
-29697,
-30859,
-32302,
-33945,
-35667,
-37424,
-39088,
-40660,
-42140,
-43433,
-44601,
-45540,
-46258,
-46804,
-47066,
-47146,
-46923,
-46428,
-45630,
-44557,
-43316,
-41917,
-40526,
-39110,
-37735,
-36474,
-35286,
-34375,
-33639,
-33180,
-32843,
-32701,
-32596,
-32760,
-33083,
-33725,
-34576,
-35578,
-36650,
-37752,
-38841,
-39865,
-40775,
-41428,
-41870,
-42075,
-42190,
-42273,
-42367,
-42385,
-42290,
-41954,
-41383,
-40556,
-39512,
-38262,
-36874,
-35375,
-33853,
-32421,
-31113,
-29996,
-29061,
-28239,
-27526,
-26829,
-26216,
-25649,
-25210,
-24930,
-24848,
-25004,
-25398,
-26077,
-26982,
-28120,
-29340,
-30562,
-31705,
-32670,
-33520,
-34303,
-35040,
-35776,
-36404,
-36907,
-37211,
-37286,
-37204,
-36841,
-36309,
-35488,
-34497,
-33372,
-32275,
-31226,
-30243,
-29300,
-28357,
-27487,
-26735,
-26183,
-25818,
-25644,
-25567,
-25680,
-25917,
-26429,
-27121,
-27998,
-28966,
-29916,
-30861,
-31759,
-32629,
-33487,
-34312,
-35059,
-35720,
-36234,
-36622,
-36835,
-36881,
-36750,
-36437,
-36000,
-35496,
-34951,
-34480,
-34015,
-33582,
-33157,
-32698,
-32257,
-31841,
-31481,
-31207,
-31013,
-30949,
-31009,
-31259,
-31677,
-32230,
-32902,
-33569,
-34220,
-34800,
-35325,
-35827,
-36323,
-36778,
-37227,
-37599,
-37945,
-38195,
-38423,
-38473,
-38446,
-38155,
-37744,
-37148,
-36446,
-35753,
-34993,
-34315,
-33587,
-32875,
-32186,
-31512,
-30907,
-30334,
-29815,
-29305,
-28879,
-28528,
-28352,
-28331,
-28433,
-28646,
-28888,
-29211,
-29571,
-30051,
-30533,
-31078,
-31554,
-32051,
-32489,
-32939,
-33360,
-33696,
-33941,
-34057,
-34069,
-34056,
-33962,
-33891,
-33706,
-33487,
-33175,
-32915,
-32687,
-32601,
-32604,
-32689,
-32763,
-32846,
-32905,
-33023,
-33248,
-33633,
-34139,
-34777,
-35455,
-36186,
-36946,
-37675,
-38430,
-39080,
-39694,
-40186,
-40669,
-41095,
-41536,
-41927,
-42216,
-42407,
-42473,
-42478,
-42492,
-42424,
-42260,
-41907,
-41393,
-40840,
-40345,
-40007,
-39808,
-39570,
-39337,
-38962,
-38609,
-38232,
-37897,
-37499,
-37110,
-36722,
-36486,
-36419,
-36560,
-36736,
-36903,
-36931,
-36859,
-36730,
-36577,
-36441,
-36274,
-36095,
-35887,
-35684,
-35548,
-35395,
-35299,
-35076,
-34748,
-34292,
-33653,
-32982,
-32228,
-31501,
-30783,
-30096,
-29456,
-28848,
-28325,
-27800,
-27298,
-26727,
-26115,
-25468,
-24890,
-24402,
-24124,
-23938,
-23827,
-23730,
-23617,
-23531,
-23541,
-23567,
-23661,
-23691,
-23681,
-23631,
-23665,
-23715,
-23842,
-23887,
-23886,
-23818,
-23767,
-23746,
-23782,
-23766,
-23727,
-23581,
-23459,
-23380,
-23371,
-23421,
-23470,
-23489,
-23507,
-23541,
-23619,
-23781,
-23976,
-24230,
-24440,
-24684,
-24868,
-25081,
-25318,
-25564,
-25919,
-26299,
-26768,
-27279,
-27776,
-28288,
-28721,
-29108,
-29415,
-29658,
-29858,
-30051,
-30205,
-30353,
-30406,
-30408,
-30308,
-30195,
-30029,
-29834,
-29556,
-29145,
-28670,
-28107,
-27620,
-27283,
-27105,
-27200,
-27433,
-27898,
-28544,
-29434,
-30593,
-31998,
-33597,
-35334,
-37056,
-38746,
-40328,
-41764,
-43059,
-44147,
-45028,
-45708,
-46124,
-46366,
-46333,
-46064,
-45530,
-44675,
-43595,
-42267,
-40830,
-39342,
-37872,
-36477,
-35147,
-33956,
-32937,
-32147,
-31622,
-31291,
-31097,
-31010,
-30960,
-31160,
-31519,
-32256,
-33148,
-34232,
-35330,
-36454,
-37591,
-38657,
-39662,
-40416,
-40973,
-41334,
-41612,
-41932,
-42228,
-42481,
-42510,
-42279,
-41727,
-40912,
-39851,
-38584,
-37137,
-35552,
-33925,
-32342,
-30926,
-29700,
-28687,
-27786,
-26992,
-26227,
-25573,
-25029,
-24679,
-24556,
-24693,
-25091,
-25771,
-26719,
-27918,
-29280,
-30679,
-32054,
-33258,
-34319,
-35270,
-36084,
-36908,
-37569,
-38131,
-38462,
-38564,
-38446,
-38135,
-37610,
-36879,
-35936,
-34826,
-33661,
-32521,
-31486,
-30493,
-29561,
-28595,
-27697,
-26901,
-26285,
-25884,
-25652,
-25570,
-25626,
-25841,
-26240,
-26811,
-27505,
-28243,
-29027,
-29770,
-30570,
-31380,
-32223,
-33089,
-33890,
-34665,
-35300,
-35801,
-36122,
-36264,
-36198,
-36026,
-35684,
-35334,
-34888,
-34500,
-34071,
-33681,
-33251,
-32772,
-32239,
-31676,
-31144,
-30710,
-30427,
-30306,
-30362,
-30580,
-30945,
-31434,
-32024,
-32638,
-33246,
-33801,
-34329,
-34856,
-35408,
-36005,
-36580,
-37149,
-37593,
-37998,
-38251,
-38453,
-38495,
-38398,
-38131,
-37689,
-37176,
-36561,
-35985,
-35383,
-34814,
-34202,
-33571,
-32896,
-32216,
-31594,
-30994,
-30528,
-30065,
-29733,
-29404,
-29217,
-29084,
-29103,
-29222,
-29433,
-29749,
-30115,
-30568,
-31051,
-31588,
-32102,
-32618,
-33063,
-33500,
-33857,
-34201,
-34441,
-34612,
-34674,
-34687,
-34630,
-34541,
-34435,
-34203,
-33940,
-33528,
-33155,
-32839,
-32703,
-32797,
-33038,
-33380,
-33707,
-33967,
-34222,
-34482,
-34874,
-35360,
-35991,
-36627,
-37342,
-38004,
-38691,
-39304,
-39854,
-40289,
-40633,
-40873,
-41078,
-41173,
-41247,
-41186,
-41084,
-40892,
-40681,
-40474,
-40251,
-39976,
-39587,
-39090,
-38480,
-37918,
-37417,
-37107,
-36927,
-36784,
-36628,
-36363,
-36009,
-35624,
-35199,
-34858,
-34571,
-34404,
-34363,
-34432,
-34627,
-34834,
-35019,
-35026,
-34951,
-34685,
-34475,
-34241,
-34113,
-33976,
-33833,
-33616,
-33401,
-33137,
-32929,
-32621,
-32254,
-31702,
-31012,
-30286,
-29522,
-28873,
-28237,
-27691,
-27158,
-26707,
-26251,
-25901,
-25488,
-25109,
-24681,
-24273,
-23973,
-23808,
-23817,
-23952,
-24109,
-24274,
-24344,
-24451,
-24544,
-24739,
-24958,
-25167,
-25364,
-25490,
-25609,
-25714,
-25817,
-25893,
-25922,
-25956,
-25976,
-26036,
-26085,
-26120,
-26078,
-25975,
-25840,
-25720,
-25652,
-25619,
-25570,
-25503,
-25383,
-25297,
-25252,
-25347,
-25516,
-25785,
-26037,
-26301,
-26524,
-26800,
-27087,
-27495,
-27944,
-28480,
-29063,
-29662,
-30286,
-30822,
-31316,
-31646,
-31879,
-32036,
-32075,
-32110,
-32050,
-31936,
-31750,
-31499,
-31177,
-30834,
-30403,
-29925,
-29344,
-28752,
-28134,
-27625,
-27277,
-27136,
-27300,
-27707,
-28409,
-29394,
-30649,
-32179,
-33888,
-35704,
-37475,
-39085,
-40454,
-41622,
-42632,
-43623,
-44491,
-45233,
-45731,
-45917,
-45920,
-45676,
-45272,
-44585,
-43552,
-42251,
-40713,
-39243,
-37795,
-36478,
-35182,
-33954,
-32885,
-32083,
-31551,
-31213,
-30854,
-30463,
-30066,
-29876,
-30075,
-30650,
-31572,
-32641,
-33812,
-35047,
-36322,
-37629,
-38801,
-39807,
-40614,
-41245,
-41867,
-42441,
-43004,
-43423,
-43562,
-43389,
-42798,
-41878,
-40625,
-39131,
-37434,
-35624,
-33777,
-31980,
-30348,
-28901,
-27676,
-26657,
-25789,
-25009,
-24362,
-23809,
-23514,
-23447,
-23711,
-24239,
-25038,
-26088,
-27336,
-28719,
-30174,
-31509,
-32746,
-33764,
-34712,
-35585,
-36492,
-37300,
-37995,
-38426,
-38616,
-38542,
-38296,
-37816,
-37202,
-36339,
-35361,
-34275,
-33194,
-32110,
-31067,
-29971,
-28861,
-27724,
-26685,
-25780,
-25123,
-24698,
-24489,
-24518,
-24686,
-25099,
-25663,
-26462,
-27338,
-28330,
-29332,
-30415,
-31535,
-32769,
-34030,
-35265,
-36413,
-37329,
-38084,
-38524,
-38754,
-38718,
-38475,
-38096,
-37670,
-37197,
-36795,
-36320,
-35866,
-35273,
-34628,
-33910,
-33191,
-32546,
-32017,
-31669,
-31500,
-31552,
-31790,
-32199,
-32741,
-33322,
-33918,
-34460,
-34940,
-35393,
-35843,
-36327,
-36879,
-37447,
-38067,
-38627,
-39128,
-39489,
-39681,
-39718,
-39591,
-39350,
-38980,
-38502,
-37915,
-37223,
-36509,
-35705,
-34921,
-34034,
-33094,
-32103,
-31042,
-30070,
-29164,
-28406,
-27759,
-27231,
-26794,
-26459,
-26308,
-26237,
-26413,
-26683,
-27139,
-27693,
-28365,
-29083,
-29858,
-30593,
-31295,
-31921,
-32502,
-33009,
-33453,
-33827,
-34074,
-34252,
-34296,
-34295,
-34183,
-34014,
-33723,
-33314,
-32828,
-32308,
-31915,
-31702,
-31736,
-32001,
-32330,
-32710,
-32948,
-33150,
-33332,
-33576,
-33992,
-34548,
-35228,
-36004,
-36726,
-37511,
-38146,
-38794,
-39295,
-39734,
-40081,
-40360,
-40600,
-40739,
-40830,
-40784,
-40707,
-40566,
-40412,
-40243,
-39970,
-39572,
-39025,
-38326,
-37624,
-36972,
-36510,
-36160,
-35950,
-35693,
-35383,
-34946,
-34467,
-33939,
-33510,
-33157,
-32968,
-32927,
-33027,
-33227,
-33453,
-33614,
-33654,
-33583,
-33396,
-33221,
-33057,
-32976,
-32923,
-32853,
-32745,
-32549,
-32346,
-32081,
-31817,
-31448,
-30960,
-30374,
-29671,
-29027,
-28364,
-27835,
-27317,
-26846,
-26401,
-25965,
-25562,
-25168,
-24770,
-24357,
-23993,
-23720,
-23599,
-23654,
-23846,
-24092,
-24362,
-24609,
-24851,
-25166,
-25489,
-25902,
-26306,
-26710,
-27053,
-27348,
-27619,
-27833,
-28057,
-28195,
-28353,
-28446,
-28541,
-28623,
-28651,
-28619,
-28531,
-28370,
-28200,
-28060,
-27948,
-27867,
-27764,
-27627,
-27452,
-27304,
-27243,
-27298,
-27466,
-27695,
-27842,
-28034,
-28127,
-28352,
-28655,
-29060,
-29588,
-30110,
-30671,
-31232,
-31739,
-32232,
-32576,
-32837,
-32989,
-33064,
-33127,
-33123,
-33049,
-32836,
-32517,
-32075,
-31601,
-31077,
-30500,
-29833,
-29076,
-28253,
-27463,
-26797,
-26379,
-26206,
-26356,
-26759,
-27432,
-28368,
-29563,
-31021,
-32690,
-34426,
-36124,
-37647,
-38938,
-40040,
-40986,
-41842,
-42570,
-43118,
-43442,
-43495,
-43355,
-43001,
-42451,
-41613,
-40490,
-39081,
-37572,
-36131,
-34810,
-33638,
-32538,
-31524,
-30668,
-30057,
-29711,
-29541,
-29383,
-29199,
-29073,
-29166,
-29644,
-30503,
-31649,
-32942,
-34278,
-35635,
-37036,
-38411,
-39741,
-40836,
-41751,
-42465,
-43085,
-43657,
-44178,
-44553,
-44670,
-44431,
-43810,
-42830,
-41578,
-40080,
-38497,
-36773,
-35109,
-33469,
-32012,
-30754,
-29712,
-28842,
-28091,
-27447,
-26887,
-26523,
-26364,
-26487,
-26891,
-27501,
-28355,
-29353,
-30530,
-31845,
-33154,
-34424,
-35489,
-36440,
-37271,
-38103,
-38933,
-39699,
-40292,
-40581,
-40623,
-40364,
-39960,
-39336,
-38530,
-37504,
-36305,
-35011,
-33679,
-32372,
-31078,
-29781,
-28452,
-27167,
-25979,
-25006,
-24264,
-23834,
-23630,
-23702,
-23979,
-24504,
-25228,
-26135,
-27148,
-28203,
-29291,
-30416,
-31575,
-32828,
-34063,
-35229,
-36235,
-36992,
-37518,
-37780,
-37852,
-37707,
-37435,
-37015,
-36560,
-36103,
-35665,
-35249,
-34801,
-34294,
-33689,
-33053,
-32397,
-31841,
-31408,
-31140,
-31034,
-31087,
-31287,
-31622,
-32055,
-32533,
-33009,
-33456,
-33862,
-34270,
-34735,
-35250,
-35852,
-36463,
-37107,
-37693,
-38214,
-38651,
-38929,
-39074,
-39015,
-38792,
-38402,
-37883,
-37287,
-36583,
-35853,
-35046,
-34203,
-33280,
-32324,
-31340,
-30386,
-29518,
-28730,
-28067,
-27536,
-27097,
-26807,
-26638,
-26603,
-26740,
-26996,
-27405,
-27946,
-28574,
-29294,
-29988,
-30680,
-31279,
-31833,
-32338,
-32807,
-33239,
-33616,
-33914,
-34126,
-34270,
-34336,
-34351,
-34281,
-34104,
-33863,
-33493,
-33134,
-32784,
-32565,
-32479,
-32553,
-32732,
-32965,
-33166,
-33309,
-33381,
-33459,
-33568,
-33869,
-34242,
-34849,
-35513,
-36227,
-36964,
-37566,
-38157,
-38586,
-38968,
-39285,
-39541,
-39756,
-39895,
-39932,
-39883,
-39712,
-39511,
-39184,
-38841,
-38334,
-37733,
-37034,
-36233,
-35483,
-34767,
-34217,
-33768,
-33453,
-33166,
-32895,
-32554,
-32190,
-31768,
-31430,
-31153,
-31057,
-31120,
-31307,
-31577,
-31833,
-31988,
-32051,
-31968,
-31829,
-31677,
-31544,
-31485,
-31427,
-31401,
-31303,
-31181,
-31010,
-30816,
-30602,
-30327,
-29993,
-29569,
-29059,
-28544,
-28006,
-27540,
-27158,
-26770,
-26541,
-26245,
-26087,
-25875,
-25717,
-25577,
-25515,
-25535,
-25708,
-25990,
-26370,
-26820,
-27273,
-27729,
-28208,
-28669,
-29202,
-29687,
-30172,
-30565,
-30872,
-31096,
-31231,
-31304,
-31345,
-31326,
-31331,
-31280,
-31288,
-31256,
-31264,
-31208,
-31110,
-30949,
-30717,
-30493,
-30280,
-30111,
-30003,
-29854,
-29711,
-29540,
-29361,
-29258,
-29192,
-29204,
-29224,
-29257,
-29303,
-29414,
-29624,
-30017,
-30488,
-31094,
-31638,
-32165,
-32521,
-32776,
-32885,
-32934,
-32884,
-32864,
-32746,
-32639,
-32381,
-32022,
-31484,
-30815,
-30070,
-29308,
-28550,
-27808,
-26957,
-26109,
-25154,
-24359,
-23723,
-23419,
-23410,
-23644,
-24046,
-24577,
-25299,
-26249,
-27523,
-29074,
-30781,
-32513,
-34057,
-35356,
-36379,
-37174,
-37813,
-38359,
-38819,
-39208,
-39478,
-39583,
-39495,
-39162,
-38578,
-37794,
-36844,
-35834,
-34821,
-33826,
-32900,
-32034,
-31274,
-30718,
-30310,
-30113,
-29996,
-29906,
-29817,
-29757,
-29829,
-30155,
-30794,
-31789,
-33059,
-34494,
-36040,
-37572,
-39077,
-40461,
-41648,
-42618,
-43380,
-44017,
-44618,
-45264,
-45815,
-46275,
-46355,
-46063,
-45317,
-44212,
-42864,
-41379,
-39867,
-38377,
-36978,
-35704,
-34550,
-33528,
-32634,
-31797,
-31079,
-30396,
-29839,
-29402,
-29115,
-29029,
-29135,
-29477,
-30073,
-30881,
-31850,
-32862,
-33826,
-34680,
-35430,
-36134,
-36848,
-37610,
-38370,
-39044,
-39545,
-39794,
-39756,
-39454,
-38899,
-38122,
-37166,
-36036,
-34819,
-33488,
-32138,
-30741,
-29350,
-27925,
-26548,
-25272,
-24156,
-23328,
-22742,
-22464,
-22406,
-22577,
-22945,
-23470,
-24151,
-24936,
-25766,
-26686,
-27612,
-28645,
-29698,
-30843,
-31953,
-33058,
-34008,
-34834,
-35440,
-35868,
-36108,
-36215,
-36254,
-36228,
-36249,
-36245,
-36225,
-36120,
-35857,
-35459,
-34907,
-34301,
-33647,
-33102,
-32603,
-32270,
-32061,
-31996,
-32080,
-32262,
-32544,
-32844,
-33193,
-33539,
-33945,
-34407,
-34953,
-35607,
-36319,
-37089,
-37801,
-38484,
-39001,
-39408,
-39619,
-39668,
-39565,
-39320,
-38968,
-38523,
-37999,
-37416,
-36748,
-36039,
-35248,
-34449,
-33600,
-32787,
-31974,
-31241,
-30551,
-29940,
-29374,
-28870,
-28417,
-28027,
-27769,
-27597,
-27609,
-27711,
-27940,
-28189,
-28511,
-28820,
-29202,
-29588,
-30067,
-30533,
-31094,
-31581,
-32113,
-32558,
-33008,
-33399,
-33770,
-34038,
-34228,
-34235,
-34147,
-33916,
-33640,
-33419,
-33245,
-33230,
-33273,
-33395,
-33460,
-33480,
-33392,
-33259,
-33148,
-33130,
-33237,
-33526,
-33903,
-34392,
-34878,
-35369,
-35822,
-36254,
-36674,
-37057,
-37424,
-37732,
-38023,
-38225,
-38392,
-38494,
-38561,
-38580,
-38531,
-38434,
-38176,
-37861,
-37376,
-36894,
-36377,
-35952,
-35588,
-35283,
-35019,
-34702,
-34369,
-33944,
-33510,
-33045,
-32664,
-32365,
-32217,
-32195,
-32281,
-32390,
-32506,
-32571,
-32597,
-32624,
-32625,
-32655,
-32671,
-32717,
-32737,
-32775,
-32803,
-32822,
-32855,
-32848,
-32796,
-32718,
-32539,
-32307,
-32005,
-31638,
-31297,
-30944,
-30644,
-30397,
-30157,
-29969,
-29751,
-29526,
-29287,
-29025,
-28797,
-28599,
-28495,
-28482,
-28540,
-28685,
-28881,
-29152,
-29469,
-29868,
-30256,
-30688,
-31062,
-31399,
-31697,
-31913,
-32101,
-32218,
-32306,
-32393,
-32495,
-32597,
-32672,
-32653,
-32527,
-32297,
-31997,
-31673,
-31324,
-31011,
-30664,
-30348,
-30064,
-29827,
-29659,
-29511,
-29398,
-29259,
-29101,
-28943,
-28787,
-28668,
-28598,
-28621,
-28696,
-28900,
-29136,
-29487,
-29840,
-30238,
-30608,
-30902,
-31073,
-31098,
-30960,
-30775,
-30542,
-30323,
-30205,
-30007,
-29852,
-29549,
-29160,
-28643,
-28002,
-27325,
-26631,
-25990,
-25382,
-24803,
-24172,
-23485,
-22818,
-22205,
-21849,
-21701,
-21852,
-22131,
-22592,
-23201,
-24055,
-25233,
-26725,
-28452,
-30272,
-32016,
-33541,
-34798,
-35809,
-36627,
-37357,
-38031,
-38702,
-39262,
-39704,
-39858,
-39768,
-39399,
-38868,
-38238,
-37571,
-36921,
-36307,
-35758,
-35280,
-34883,
-34589,
-34325,
-34130,
-33888,
-33684,
-33462,
-33293,
-33313,
-33524,
-34115,
-34965,
-36167,
-37428,
-38802,
-39998,
-41151,
-42086,
-42951,
-43641,
-44252,
-44792,
-45297,
-45839,
-46347,
-46712,
-46823,
-46489,
-45745,
-44548,
-43097,
-41475,
-39879,
-38381,
-37082,
-35945,
-35009,
-34123,
-33285,
-32429,
-31566,
-30769,
-30022,
-29421,
-28880,
-28566,
-28364,
-28408,
-28707,
-29148,
-29769,
-30366,
-30952,
-31415,
-31847,
-32183,
-32579,
-32992,
-33427,
-33885,
-34250,
-34475,
-34514,
-34281,
-33873,
-33228,
-32476,
-31580,
-30594,
-29522,
-28390,
-27189,
-25986,
-24755,
-23619,
-22568,
-21735,
-21117,
-20788,
-20666,
-20759,
-20972,
-21314,
-21759,
-22299,
-22969,
-23735,
-24630,
-25632,
-26778,
-27999,
-29307,
-30612,
-31860,
-33041,
-34082,
-34974,
-35708,
-36266,
-36709,
-37062,
-37399,
-37736,
-38052,
-38274,
-38330,
-38210,
-37844,
-37314,
-36682,
-35993,
-35366,
-34772,
-34353,
-33995,
-33888,
-33808,
-33933,
-34050,
-34250,
-34423,
-34587,
-34801,
-34993,
-35299,
-35581,
-35958,
-36340,
-36719,
-37124,
-37447,
-37718,
-37883,
-37911,
-37845,
-37627,
-37346,
-36933,
-36497,
-35964,
-35445,
-34881,
-34310,
-33708,
-33083,
-32387,
-31675,
-30893,
-30140,
-29337,
-28616,
-27844,
-27145,
-26460,
-25856,
-25392,
-25107,
-24992,
-25094,
-25276,
-25566,
-25855,
-26188,
-26599,
-27064,
-27702,
-28355,
-29134,
-29876,
-30664,
-31374,
-32081,
-32683,
-33206,
-33558,
-33789,
-33861,
-33825,
-33683,
-33514,
-33325,
-33217,
-33179,
-33270,
-33414,
-33571,
-33667,
-33703,
-33613,
-33550,
-33411,
-33407,
-33441,
-33619,
-33931,
-34338,
-34862,
-35431,
-36025,
-36642,
-37201,
-37751,
-38175,
-38584,
-38862,
-39177,
-39462,
-39790,
-40123,
-40401,
-40587,
-40636,
-40541,
-40308,
-39944,
-39470,
-38951,
-38395,
-37910,
-37492,
-37150,
-36895,
-36604,
-36303,
-35954,
-35538,
-35136,
-34693,
-34343,
-34067,
-33926,
-33876,
-33893,
-33949,
-33992,
-34022,
-34048,
-34057,
-34059,
-34017,
-33954,
-33871,
-33869,
-33861,
-33956,
-34010,
-34031,
-33982,
-33844,
-33617,
-33330,
-32961,
-32570,
-32180,
-31790,
-31483,
-31162,
-30891,
-30596,
-30312,
-30064,
-29839,
-29724,
-29602,
-29579,
-29575,
-29614,
-29729,
-29862,
-30064,
-30284,
-30513,
-30760,
-30975,
-31207,
-31390,
-31602,
-31763,
-31947,
-32074,
-32142,
-32129,
-32006,
-31856,
-31656,
-31469,
-31255,
-31008,
-30708,
-30368,
-30015,
-29684,
-29376,
-29090,
-28817,
-28597,
-28413,
-28351,
-28335,
-28427,
-28498,
-28620,
-28721,
-28818,
-28933,
-29035,
-29165,
-29339,
-29570,
-29851,
-30205,
-30528,
-30869,
-31106,
-31326,
-31377,
-31377,
-31209,
-30970,
-30629,
-30275,
-29873,
-29533,
-29167,
-28861,
-28553,
-28200,
-27820,
-27343,
-26813,
-26298,
-25843,
-25547,
-25337,
-25173,
-24891,
-24491,
-23986,
-23511,
-23228,
-23222,
-23514,
-24102,
-24862,
-25827,
-26984,
-28362,
-29946,
-31669,
-33350,
-34872,
-36095,
-37000,
-37678,
-38266,
-38884,
-39564,
-40223,
-40734,
-40909,
-40801,
-40389,
-39874,
-39327,
-38827,
-38306,
-37835,
-37291,
-36849,
-36427,
-36095,
-35790,
-35436,
-35019,
-34521,
-34061,
-33714,
-33589,
-33776,
-34238,
-34976,
-35849,
-36792,
-37697,
-38521,
-39284,
-39976,
-40664,
-41342,
-42065,
-42794,
-43565,
-44286,
-44889,
-45273,
-45286,
-44914,
-44124,
-43004,
-41691,
-40301,
-38987,
-37816,
-36838,
-36000,
-35232,
-34455,
-33568,
-32595,
-31576,
-30575,
-29680,
-28913,
-28250,
-27742,
-27339,
-27171,
-27170,
-27379,
-27692,
-28025,
-28378,
-28663,
-29000,
-29401,
-29926,
-30601,
-31325,
-32104,
-32773,
-33312,
-33652,
-33788,
-33753,
-33500,
-33135,
-32543,
-31839,
-30953,
-29964,
-28941,
-27881,
-26920,
-26015,
-25276,
-24716,
-24372,
-24210,
-24233,
-24353,
-24574,
-24869,
-25221,
-25702,
-26270,
-26997,
-27860,
-28858,
-30003,
-31166,
-32403,
-33483,
-34555,
-35463,
-36301,
-37098,
-37792,
-38501,
-39119,
-39730,
-40297,
-40800,
-41231,
-41461,
-41460,
-41149,
-40545,
-39727,
-38765,
-37823,
-36953,
-36230,
-35614,
-35130,
-34688,
-34325,
-33986,
-33706,
-33468,
-33270,
-33097,
-33000,
-32951,
-33052,
-33214,
-33554,
-33906,
-34320,
-34676,
-34981,
-35224,
-35394,
-35506,
-35553,
-35526,
-35442,
-35278,
-35057,
-34772,
-34436,
-34068,
-33619,
-33125,
-32540,
-31867,
-31134,
-30332,
-29519,
-28721,
-27960,
-27298,
-26707,
-26243,
-25878,
-25658,
-25561,
-25606,
-25781,
-26019,
-26339,
-26631,
-26992,
-27341,
-27801,
-28360,
-29009,
-29773,
-30558,
-31377,
-32141,
-32854,
-33438,
-33930,
-34272,
-34515,
-34640,
-34741,
-34748,
-34807,
-34786,
-34814,
-34803,
-34810,
-34825,
-34849,
-34864,
-34876,
-34806,
-34733,
-34600,
-34511,
-34488,
-34613,
-34838,
-35212,
-35611,
-36029,
-36441,
-36849,
-37276,
-37712,
-38159,
-38555,
-38935,
-39253,
-39581,
-39897,
-40243,
-40542,
-40772,
-40877,
-40842,
-40652,
-40410,
-40038,
-39664,
-39225,
-38820,
-38394,
-38015,
-37680,
-37338,
-37057,
-36669,
-36275,
-35774,
-35244,
-34726,
-34233,
-33873,
-33556,
-33315,
-33103,
-32876,
-32665,
-32451,
-32249,
-32058,
-31864,
-31645,
-31444,
-31252,
-31120,
-31040,
-30985,
-30974,
-30945,
-30925,
-30866,
-30800,
-30673,
-30533,
-30355,
-30189,
-30064,
-29941,
-29883,
-29823,
-29787,
-29765,
-29749,
-29736,
-29743,
-29702,
-29672,
-29584,
-29492,
-29374,
-29269,
-29224,
-29193,
-29230,
-29280,
-29340,
-29425,
-29448,
-29565,
-29629,
-29774,
-29892,
-30006,
-30118,
-30210,
-30326,
-30435,
-30561,
-30645,
-30672,
-30610,
-30484,
-30300,
-30103,
-29909,
-29746,
-29620,
-29537,
-29479,
-29476,
-29493,
-29521,
-29563,
-29543,
-29547,
-29461,
-29410,
-29318,
-29302,
-29288,
-29335,
-29362,
-29388,
-29368,
-29345,
-29336,
-29379,
-29479,
-29607,
-29710,
-29725,
-29700,
-29577,
-29494,
-29390,
-29347,
-29263,
-29140,
-28916,
-28602,
-28255,
-27926,
-27629,
-27397,
-27168,
-26932,
-26668,
-26398,
-26084,
-25760,
-25335,
-24831,
-24196,
-23541,
-22922,
-22514,
-22338,
-22462,
-22822,
-23413,
-24226,
-25279,
-26630,
-28191,
-29857,
-31411,
-32685,
-33590,
-34234,
-34762,
-35419,
-36202,
-37121,
-37901,
-38473,
-38712,
-38699,
-38567,
-38403,
-38287,
-38145,
-37904,
-37538,
-37036,
-36455,
-35907,
-35349,
-34860,
-34292,
-33701,
-33015,
-32374,
-31808,
-31510,
-31446,
-31783,
-32388,
-33305,
-34380,
-35577,
-36745,
-37860,
-38854,
-39767,
-40656,
-41593,
-42597,
-43614,
-44517,
-45219,
-45584,
-45596,
-45263,
-44595,
-43666,
-42529,
-41254,
-39986,
-38757,
-37687,
-36674,
-35729,
-34732,
-33654,
-32549,
-31397,
-30297,
-29207,
-28150,
-27177,
-26306,
-25615,
-25232,
-25064,
-25232,
-25524,
-25945,
-26372,
-26833,
-27366,
-27995,
-28803,
-29721,
-30722,
-31699,
-32547,
-33259,
-33749,
-34112,
-34274,
-34325,
-34213,
-33942,
-33567,
-33036,
-32413,
-31681,
-30891,
-30106,
-29405,
-28847,
-28463,
-28218,
-28058,
-27943,
-27839,
-27809,
-27834,
-27970,
-28174,
-28459,
-28819,
-29300,
-29911,
-30684,
-31624,
-32675,
-33812,
-34938,
-36045,
-37050,
-37972,
-38771,
-39503,
-40173,
-40800,
-41410,
-41918,
-42307,
-42499,
-42412,
-42071,
-41471,
-40693,
-39848,
-38981,
-38213,
-37498,
-36899,
-36369,
-35941,
-35614,
-35386,
-35215,
-35076,
-34905,
-34675,
-34425,
-34173,
-33982,
-33870,
-33845,
-33852,
-33923,
-33984,
-34089,
-34165,
-34242,
-34293,
-34321,
-34310,
-34325,
-34245,
-34227,
-34059,
-33905,
-33621,
-33282,
-32905,
-32449,
-31959,
-31428,
-30751,
-30077,
-29258,
-28496,
-27728,
-27095,
-26565,
-26180,
-25945,
-25831,
-25834,
-25963,
-26156,
-26446,
-26762,
-27081,
-27454,
-27803,
-28216,
-28671,
-29143,
-29715,
-30248,
-30876,
-31476,
-32097,
-32704,
-33241,
-33695,
-34042,
-34284,
-34464,
-34631,
-34805,
-34988,
-35150,
-35220,
-35234,
-35187,
-35175,
-35208,
-35302,
-35405,
-35445,
-35413,
-35295,
-35182,
-35173,
-35308,
-35644,
-36084,
-36630,
-37138,
-37680,
-38177,
-38719,
-39309,
-39925,
-40520,
-41058,
-41477,
-41820,
-42119,
-42405,
-42700,
-42957,
-43074,
-43052,
-42786,
-42395,
-41836,
-41265,
-40638,
-40067,
-39483,
-38962,
-38440,
-37936,
-37392,
-36821,
-36225,
-35637,
-35036,
-34524,
-34003,
-33598,
-33215,
-32963,
-32809,
-32745,
-32764,
-32802,
-32847,
-32894,
-32893,
-32903,
-32871,
-32838,
-32796,
-32704,
-32605,
-32424,
-32195,
-31940,
-31612,
-31325,
-30947,
-30587,
-30125,
-29681,
-29205,
-28766,
-28380,
-28016,
-27704,
-27414,
-27184,
-27069,
-27037,
-27166,
-27322,
-27589,
-27794,
-28080,
-28354,
-28659,
-29028,
-29385,
-29799,
-30213,
-30624,
-31049,
-31424,
-31792,
-32094,
-32342,
-32541,
-32652,
-32737,
-32716,
-32658,
-32545,
-32347,
-32133,
-31834,
-31490,
-31102,
-30661,
-30203,
-29782,
-29350,
-29042,
-28723,
-28502,
-28284,
-28149,
-28047,
-28033,
-28096,
-28195,
-28343,
-28499,
-28665,
-28860,
-29110,
-29386,
-29717,
-30049,
-30334,
-30583,
-30795,
-30996,
-31247,
-31520,
-31825,
-32057,
-32211,
-32164,
-31989,
-31670,
-31230,
-30785,
-30268,
-29774,
-29252,
-28711,
-28147,
-27528,
-26901,
-26237,
-25668,
-25138,
-24775,
-24397,
-24049,
-23572,
-23037,
-22470,
-22012,
-21790,
-21828,
-22113,
-22560,
-23104,
-23743,
-24583,
-25667,
-27071,
-28668,
-30277,
-31686,
-32697,
-33280,
-33581,
-33726,
-34016,
-34399,
-34931,
-35393,
-35677,
-35776,
-35687,
-35576,
-35468,
-35373,
-35240,
-34989,
-34655,
-34265,
-33924,
-33650,
-33454,
-33261,
-33046,
-32776,
-32488,
-32240,
-32107,
-32200,
-32545,
-33223,
-34218,
-35470,
-36929,
-38415,
-39852,
-41158,
-42254,
-43216,
-44026,
-44747,
-45416,
-45971,
-46480,
-46751,
-46897,
-46675,
-46219,
-45375,
-44301,
-42997,
-41678,
-40368,
-39272,
-38290,
-37427,
-36553,
-35595,
-34580,
-33524,
-32543,
-31615,
-30725,
-29811,
-28910,
-28036,
-27385,
-26993,
-26938,
-27131,
-27459,
-27863,
-28281,
-28724,
-29265,
-29871,
-30571,
-31326,
-32083,
-32763,
-33332,
-33710,
-33899,
-33917,
-33773,
-33567,
-33260,
-32939,
-32530,
-32029,
-31425,
-30754,
-30014,
-29360,
-28749,
-28316,
-27977,
-27706,
-27495,
-27257,
-27062,
-26899,
-26773,
-26745,
-26740,
-26815,
-26944,
-27229,
-27661,
-28318,
-29126,
-30083,
-31130,
-32204,
-33320,
-34418,
-35471,
-36417,
-37307,
-38036,
-38786,
-39431,
-40071,
-40561,
-40868,
-40940,
-40747,
-40411,
-39908,
-39418,
-38891,
-38415,
-37915,
-37439,
-36962,
-36499,
-36070,
-35691,
-35336,
-34985,
-34609,
-34193,
-33753,
-33319,
-32924,
-32625,
-32399,
-32284,
-32208,
-32243,
-32321,
-32443,
-32604,
-32746,
-32886,
-33017,
-33102,
-33211,
-33252,
-33251,
-33180,
-33014,
-32803,
-32547,
-32232,
-31900,
-31455,
-30980,
-30371,
-29732,
-29050,
-28375,
-27757,
-27185,
-26727,
-26324,
-26017,
-25739,
-25516,
-25327,
-25163,
-25090,
-25036,
-25073,
-25132,
-25298,
-25516,
-25852,
-26294,
-26832,
-27484,
-28172,
-28941,
-29684,
-30448,
-31165,
-31865,
-32557,
-33208,
-33876,
-34491,
-35081,
-35594,
-36030,
-36399,
-36688,
-36940,
-37128,
-37290,
-37409,
-37516,
-37623,
-37771,
-37957,
-38280,
-38642,
-39117,
-39592,
-40019,
-40368,
-40590,
-40768,
-40905,
-41104,
-41303,
-41586,
-41827,
-42107,
-42334,
-42586,
-42839,
-43102,
-43382,
-43610,
-43811,
-43950,
-44028,
-44058,
-44024,
-43926,
-43727,
-43402,
-42973,
-42424,
-41807,
-41109,
-40387,
-39627,
-38891,
-38162,
-37465,
-36749,
-36049,
-35259,
-34493,
-33653,
-32894,
-32131,
-31491,
-30884,
-30348,
-29849,
-29348,
-28885,
-28381,
-27931,
-27407,
-26975,
-26496,
-26181,
-25933,
-25859,
-25881,
-25992,
-26080,
-26157,
-26157,
-26140,
-26085,
-26056,
-26020,
-25965,
-25924,
-25872,
-25884,
-25964,
-26065,
-26224,
-26322,
-26432,
-26491,
-26586,
-26738,
-26929,
-27168,
-27394,
-27639,
-27840,
-28075,
-28290,
-28491,
-28716,
-28882,
-29062,
-29258,
-29442,
-29697,
-29941,
-30227,
-30549,
-30861,
-31266,
-31655,
-32123,
-32555,
-32976,
-33361,
-33700,
-33989,
-34237,
-34406,
-34500,
-34540,
-34524,
-34556,
-34620,
-34759,
-34913,
-35098,
-35191,
-35268,
-35265,
-35258,
-35253,
-35284,
-35282,
-35333,
-35330,
-35361,
-35396,
-35455,
-35504,
-35556,
-35528,
-35441,
-35315,
-35098,
-34929,
-34746,
-34583,
-34436,
-34214,
-33906,
-33461,
-32870,
-32167,
-31369,
-30562,
-29695,
-28840,
-27895,
-26893,
-25797,
-24646,
-23514,
-22454,
-21474,
-20578,
-19625,
-18662,
-17584,
-16559,
-15622,
-14964,
-14572,
-14471,
-14597,
-14850,
-15283,
-15896,
-16801,
-18013,
-19482,
-21045,
-22549,
-23777,
-24770,
-25523,
-26258,
-27081,
-28053,
-29121,
-30168,
-31043,
-31736,
-32299,
-32748,
-33250,
-33654,
-33991,
-34147,
-34123,
-34015,
-33906,
-33848,
-33905,
-33952,
-34042,
-34049,
-34055,
-34156,
-34350,
-34857,
-35563,
-36608,
-37866,
-39321,
-40914,
-42484,
-44034,
-45390,
-46597,
-47623,
-48502,
-49310,
-50031,
-50719,
-51264,
-51721,
-51929,
-51958,
-51643,
-51095,
-50211,
-49163,
-47967,
-46803,
-45708,
-44702,
-43738,
-42715,
-41577,
-40357,
-39062,
-37801,
-36563,
-35334,
-34085,
-32840,
-31643,
-30680,
-29981,
-29589,
-29425,
-29367,
-29382,
-29411,
-29519,
-29710,
-30005,
-30351,
-30710,
-31052,
-31316,
-31520,
-31596,
-31550,
-31381,
-31076,
-30662,
-30193,
-29667,
-29118,
-28501,
-27792,
-27037,
-26226,
-25474,
-24856,
-24351,
-24048,
-23780,
-23608,
-23416,
-23238,
-23077,
-22956,
-22878,
-22863,
-22903,
-23082,
-23389,
-23907,
-24627,
-25464,
-26422,
-27415,
-28405,
-29422,
-30380,
-31327,
-32162,
-32951,
-33657,
-34355,
-35085,
-35787,
-36438,
-36922,
-37223,
-37305,
-37266,
-37145,
-37053,
-37000,
-36992,
-37041,
-37083,
-37154,
-37255,
-37364,
-37497,
-37597,
-37659,
-37615,
-37517,
-37344,
-37177,
-37009,
-36891,
-36800,
-36784,
-36788,
-36888,
-36997,
-37211,
-37406,
-37653,
-37830,
-37974,
-38042,
-38039,
-37977,
-37838,
-37670,
-37424,
-37186,
-36859,
-36540,
-36110,
-35651,
-35107,
-34509,
-33906,
-33262,
-32652,
-32064,
-31520,
-31061,
-30681,
-30388,
-30164,
-29975,
-29808,
-29615,
-29430,
-29214,
-29090,
-28974,
-29030,
-29121,
-29380,
-29656,
-30060,
-30464,
-30977,
-31476,
-32024,
-32495,
-32927,
-33267,
-33517,
-33715,
-33861,
-33969,
-34060,
-34063,
-34014,
-33891,
-33727,
-33536,
-33372,
-33212,
-33070,
-32936,
-32814,
-32690,
-32656,
-32725,
-32948,
-33363,
-33905,
-34521,
-35140,
-35666,
-36095,
-36435,
-36724,
-37040,
-37380,
-37816,
-38240,
-38686,
-39094,
-39418,
-39731,
-39993,
-40219,
-40418,
-40515,
-40493,
-40321,
-40019,
-39619,
-39172,
-38711,
-38206,
-37667,
-37045,
-36292,
-35533,
-34696,
-33939,
-33261,
-32681,
-32239,
-31884,
-31613,
-31380,
-31211,
-31020,
-30867,
-30695,
-30574,
-30511,
-30525,
-30602,
-30730,
-30841,
-30904,
-30931,
-30844,
-30785,
-30670,
-30610,
-30553,
-30547,
-30535,
-30506,
-30410,
-30331,
-30149,
-30018,
-29862,
-29704,
-29545,
-29345,
-29127,
-28949,
-28823,
-28819,
-28892,
-29068,
-29288,
-29501,
-29781,
-30038,
-30393,
-30805,
-31274,
-31810,
-32301,
-32839,
-33276,
-33732,
-34128,
-34528,
-34900,
-35281,
-35582,
-35893,
-36097,
-36292,
-36438,
-36561,
-36673,
-36779,
-36869,
-36960,
-37044,
-37100,
-37146,
-37110,
-37048,
-36873,
-36677,
-36395,
-36098,
-35746,
-35411,
-35038,
-34763,
-34469,
-34281,
-34066,
-33920,
-33709,
-33520,
-33266,
-32997,
-32693,
-32406,
-32147,
-31938,
-31749,
-31508,
-31227,
-30777,
-30298,
-29735,
-29206,
-28717,
-28241,
-27806,
-27349,
-26912,
-26458,
-26037,
-25610,
-25205,
-24800,
-24354,
-23858,
-23256,
-22571,
-21819,
-21101,
-20450,
-19924,
-19446,
-18978,
-18481,
-17939,
-17392,
-16900,
-16406,
-16013,
-15577,
-15215,
-14914,
-14753,
-14772,
-14971,
-15368,
-15863,
-16554,
-17382,
-18429,
-19690,
-21135,
-22643,
-24156,
-25492,
-26660,
-27686,
-28626,
-29650,
-30726,
-31880,
-32946,
-33893,
-34609,
-35224,
-35775,
-36355,
-36947,
-37483,
-37891,
-38142,
-38259,
-38337,
-38421,
-38541,
-38693,
-38798,
-38872,
-38897,
-38926,
-38977,
-39139,
-39369,
-39778,
-40345,
-41126,
-42058,
-43087,
-44041,
-44870,
-45514,
-46017,
-46501,
-46983,
-47495,
-47933,
-48275,
-48467,
-48475,
-48383,
-48026,
-47514,
-46708,
-45729,
-44638,
-43558,
-42546,
-41613,
-40665,
-39689,
-38653,
-37617,
-36595,
-35638,
-34689,
-33696,
-32640,
-31526,
-30500,
-29685,
-29123,
-28874,
-28752,
-28758,
-28714,
-28722,
-28783,
-28964,
-29262,
-29657,
-30073,
-30471,
-30847,
-31159,
-31408,
-31603,
-31641,
-31604,
-31425,
-31189,
-30864,
-30488,
-30000,
-29440,
-28750,
-28088,
-27411,
-26861,
-26370,
-25936,
-25519,
-25111,
-24730,
-24405,
-24141,
-23929,
-23736,
-23555,
-23457,
-23442,
-23638,
-23992,
-24568,
-25290,
-26077,
-26998,
-27873,
-28886,
-29811,
-30754,
-31605,
-32393,
-33193,
-33949,
-34772,
-35557,
-36264,
-36826,
-37202,
-37409,
-37513,
-37574,
-37608,
-37650,
-37650,
-37645,
-37622,
-37609,
-37637,
-37690,
-37757,
-37775,
-37729,
-37577,
-37405,
-37168,
-36974,
-36770,
-36657,
-36607,
-36654,
-36819,
-37057,
-37328,
-37691,
-38000,
-38412,
-38803,
-39205,
-39572,
-39839,
-40023,
-40121,
-40131,
-40149,
-40075,
-40005,
-39841,
-39577,
-39225,
-38770,
-38241,
-37691,
-37118,
-36598,
-36068,
-35609,
-35142,
-34746,
-34370,
-34072,
-33762,
-33455,
-33087,
-32651,
-32245,
-31846,
-31563,
-31385,
-31264,
-31247,
-31258,
-31366,
-31564,
-31795,
-32107,
-32356,
-32633,
-32814,
-33005,
-33153,
-33289,
-33388,
-33429,
-33395,
-33285,
-33097,
-32846,
-32538,
-32165,
-31771,
-31345,
-30914,
-30528,
-30139,
-29826,
-29516,
-29263,
-29079,
-28951,
-28956,
-28994,
-29127,
-29271,
-29473,
-29688,
-29969,
-30253,
-30600,
-30865,
-31194,
-31391,
-31717,
-32017,
-32434,
-32879,
-33312,
-33699,
-34011,
-34239,
-34492,
-34704,
-34996,
-35203,
-35387,
-35447,
-35436,
-35366,
-35285,
-35189,
-35057,
-34888,
-34604,
-34283,
-33922,
-33616,
-33376,
-33251,
-33204,
-33237,
-33356,
-33504,
-33735,
-33976,
-34240,
-34504,
-34773,
-35050,
-35378,
-35696,
-36069,
-36373,
-36737,
-37015,
-37334,
-37573,
-37790,
-37930,
-38009,
-38040,
-38064,
-38069,
-38103,
-38086,
-38038,
-37898,
-37693,
-37466,
-37156,
-36912,
-36592,
-36302,
-35975,
-35674,
-35402,
-35267,
-35176,
-35241,
-35326,
-35430,
-35539,
-35621,
-35746,
-35900,
-36056,
-36273,
-36385,
-36518,
-36534,
-36539,
-36509,
-36433,
-36305,
-36110,
-35845,
-35556,
-35191,
-34849,
-34416,
-34002,
-33500,
-32986,
-32454,
-31882,
-31307,
-30649,
-29962,
-29207,
-28445,
-27718,
-27029,
-26437,
-25884,
-25376,
-24933,
-24544,
-24257,
-24090,
-23987,
-24011,
-24003,
-24070,
-24083,
-24142,
-24158,
-24211,
-24289,
-24384,
-24563,
-24753,
-24952,
-25133,
-25256,
-25347,
-25442,
-25558,
-25725,
-25923,
-26146,
-26310,
-26469,
-26566,
-26649,
-26706,
-26788,
-26825,
-26854,
-26786,
-26646,
-26407,
-26140,
-25880,
-25691,
-25558,
-25471,
-25381,
-25249,
-25132,
-24954,
-24857,
-24661,
-24450,
-24156,
-23809,
-23531,
-23341,
-23310,
-23464,
-23720,
-24062,
-24468,
-24957,
-25587,
-26402,
-27443,
-28596,
-29845,
-30932,
-31824,
-32418,
-32823,
-33143,
-33500,
-33937,
-34385,
-34763,
-34970,
-35006,
-34936,
-34832,
-34810,
-34806,
-34842,
-34748,
-34570,
-34255,
-33898,
-33559,
-33241,
-33017,
-32741,
-32523,
-32216,
-31996,
-31725,
-31593,
-31496,
-31638,
-32010,
-32661,
-33541,
-34506,
-35425,
-36213,
-36845,
-37384,
-37884,
-38378,
-38852,
-39297,
-39702,
-40057,
-40354,
-40532,
-40509,
-40260,
-39823,
-39255,
-38736,
-38279,
-37961,
-37707,
-37447,
-37187,
-36853,
-36575,
-36260,
-35996,
-35637,
-35185,
-34600,
-33931,
-33328,
-32872,
-32665,
-32687,
-32883,
-33145,
-33419,
-33666,
-33962,
-34292,
-34748,
-35240,
-35815,
-36339,
-36835,
-37251,
-37559,
-37763,
-37809,
-37742,
-37593,
-37366,
-37139,
-36814,
-36428,
-35958,
-35402,
-34872,
-34355,
-33899,
-33478,
-33089,
-32697,
-32366,
-32061,
-31798,
-31560,
-31276,
-30975,
-30634,
-30291,
-30062,
-29904,
-29908,
-30010,
-30197,
-30473,
-30783,
-31172,
-31549,
-31899,
-32176,
-32328,
-32431,
-32474,
-32546,
-32629,
-32741,
-32752,
-32701,
-32468,
-32203,
-31807,
-31486,
-31123,
-30855,
-30623,
-30433,
-30320,
-30261,
-30263,
-30305,
-30387,
-30410,
-30463,
-30442,
-30415,
-30389,
-30344,
-30336,
-30421,
-30548,
-30793,
-31090,
-31449,
-31842,
-32275,
-32762,
-33288,
-33859,
-34405,
-34906,
-35324,
-35651,
-35904,
-36093,
-36245,
-36349,
-36418,
-36395,
-36372,
-36249,
-36129,
-35989,
-35847,
-35746,
-35653,
-35574,
-35550,
-35533,
-35631,
-35745,
-35946,
-36164,
-36341,
-36478,
-36529,
-36561,
-36562,
-36621,
-36673,
-36784,
-36896,
-37036,
-37181,
-37324,
-37454,
-37566,
-37648,
-37662,
-37658,
-37548,
-37415,
-37199,
-36937,
-36631,
-36292,
-35932,
-35553,
-35122,
-34686,
-34194,
-33719,
-33245,
-32786,
-32398,
-32005,
-31645,
-31295,
-30968,
-30679,
-30457,
-30313,
-30203,
-30182,
-30128,
-30138,
-30131,
-30149,
-30229,
-30328,
-30512,
-30706,
-30952,
-31212,
-31446,
-31704,
-31865,
-32045,
-32152,
-32269,
-32387,
-32497,
-32567,
-32591,
-32541,
-32431,
-32296,
-32167,
-32077,
-32005,
-31945,
-31833,
-31701,
-31547,
-31442,
-31397,
-31469,
-31624,
-31860,
-32135,
-32407,
-32711,
-33018,
-33417,
-33847,
-34359,
-34862,
-35366,
-35791,
-36185,
-36517,
-36856,
-37194,
-37557,
-37951,
-38317,
-38689,
-38966,
-39194,
-39275,
-39282,
-39190,
-39030,
-38846,
-38580,
-38335,
-38025,
-37730,
-37429,
-37124,
-36846,
-36540,
-36259,
-35994,
-35767,
-35620,
-35520,
-35511,
-35551,
-35650,
-35785,
-35980,
-36190,
-36423,
-36643,
-36841,
-36979,
-37071,
-37090,
-37082,
-37039,
-36949,
-36831,
-36657,
-36434,
-36133,
-35815,
-35396,
-34998,
-34494,
-33973,
-33408,
-32789,
-32188,
-31534,
-30917,
-30278,
-29639,
-29051,
-28451,
-27969,
-27544,
-27204,
-26925,
-26691,
-26510,
-26390,
-26344,
-26341,
-26442,
-26511,
-26661,
-26770,
-26934,
-27082,
-27239,
-27394,
-27507,
-27645,
-27729,
-27842,
-27926,
-28021,
-28060,
-28084,
-28047,
-27990,
-27882,
-27774,
-27607,
-27465,
-27252,
-27045,
-26783,
-26550,
-26295,
-26065,
-25841,
-25645,
-25498,
-25373,
-25292,
-25235,
-25235,
-25195,
-25198,
-25155,
-25152,
-25129,
-25157,
-25101,
-25090,
-24977,
-24879,
-24782,
-24719,
-24724,
-24768,
-24848,
-24961,
-25024,
-25058,
-24982,
-24811,
-24629,
-24434,
-24377,
-24438,
-24561,
-24731,
-24817,
-24903,
-24987,
-25209,
-25567,
-26100,
-26749,
-27382,
-27991,
-28415,
-28727,
-28930,
-29148,
-29471,
-29932,
-30468,
-30989,
-31367,
-31617,
-31756,
-31911,
-32126,
-32362,
-32562,
-32646,
-32637,
-32529,
-32453,
-32342,
-32257,
-32148,
-32090,
-32084,
-32188,
-32286,
-32431,
-32464,
-32564,
-32717,
-33041,
-33538,
-34114,
-34754,
-35302,
-35819,
-36240,
-36644,
-37016,
-37401,
-37817,
-38300,
-38801,
-39347,
-39776,
-40106,
-40256,
-40254,
-40226,
-40095,
-40076,
-39968,
-39899,
-39716,
-39458,
-39134,
-38806,
-38529,
-38321,
-38207,
-38086,
-37938,
-37746,
-37497,
-37337,
-37256,
-37357,
-37570,
-37881,
-38204,
-38533,
-38857,
-39227,
-39631,
-40099,
-40595,
-41062,
-41510,
-41868,
-42123,
-42281,
-42306,
-42250,
-42101,
-41894,
-41632,
-41293,
-40874,
-40344,
-39739,
-39058,
-38345,
-37607,
-36906,
-36197,
-35556,
-34921,
-34363,
-33856,
-33380,
-32982,
-32548,
-32166,
-31793,
-31465,
-31210,
-31041,
-30902,
-30856,
-30798,
-30809,
-30843,
-30949,
-31113,
-31247,
-31381,
-31382,
-31347,
-31261,
-31187,
-31132,
-31087,
-30936,
-30754,
-30376,
-30007,
-29535,
-29143,
-28719,
-28364,
-27988,
-27630,
-27281,
-26903,
-26589,
-26266,
-26074,
-25939,
-25953,
-26000,
-26125,
-26228,
-26358,
-26523,
-26733,
-27014,
-27364,
-27722,
-28121,
-28501,
-28920,
-29373,
-29846,
-30344,
-30834,
-31269,
-31655,
-31984,
-32262,
-32542,
-32783,
-33051,
-33279,
-33528,
-33710,
-33898,
-34036,
-34138,
-34243,
-34285,
-34369,
-34411,
-34524,
-34588,
-34760,
-34875,
-35048,
-35193,
-35297,
-35431,
-35487,
-35656,
-35817,
-36078,
-36341,
-36611,
-36850,
-37036,
-37196,
-37365,
-37535,
-37767,
-37953,
-38163,
-38301,
-38426,
-38484,
-38546,
-38600,
-38614,
-38620,
-38523,
-38411,
-38189,
-37989,
-37746,
-37552,
-37387,
-37242,
-37140,
-36973,
-36786,
-36502,
-36192,
-35893,
-35643,
-35455,
-35332,
-35160,
-34996,
-34762,
-34541,
-34322,
-34130,
-33962,
-33828,
-33713,
-33652,
-33640,
-33629,
-33662,
-33610,
-33555,
-33436,
-33337,
-33185,
-33109,
-33014,
-32987,
-33005,
-33019,
-33064,
-33038,
-32971,
-32856,
-32729,
-32640,
-32572,
-32548,
-32540,
-32498,
-32470,
-32406,
-32361,
-32355,
-32345,
-32367,
-32393,
-32414,
-32498,
-32615,
-32814,
-33063,
-33333,
-33582,
-33790,
-33939,
-34023,
-34102,
-34130,
-34216,
-34316,
-34486,
-34708,
-34970,
-35220,
-35458,
-35641,
-35807,
-35865,
-35939,
-35884,
-35850,
-35778,
-35730,
-35714,
-35742,
-35770,
-35790,
-35749,
-35708,
-35620,
-35582,
-35571,
-35591,
-35665,
-35688,
-35726,
-35711,
-35672,
-35648,
-35608,
-35631,
-35612,
-35600,
-35532,
-35418,
-35298,
-35147,
-35075,
-34986,
-34971,
-34935,
-34901,
-34849,
-34790,
-34719,
-34624,
-34544,
-34404,
-34283,
-34075,
-33874,
-33622,
-33362,
-33111,
-32853,
-32601,
-32347,
-32063,
-31749,
-31403,
-31065,
-30681,
-30375,
-30011,
-29746,
-29457,
-29211,
-28987,
-28779,
-28554,
-28340,
-28097,
-27858,
-27646,
-27460,
-27338,
-27279,
-27230,
-27248,
-27209,
-27219,
-27187,
-27177,
-27185,
-27156,
-27160,
-27129,
-27071,
-27031,
-26960,
-26897,
-26786,
-26677,
-26455,
-26266,
-26019,
-25822,
-25657,
-25491,
-25352,
-25112,
-24863,
-24508,
-24186,
-23861,
-23622,
-23423,
-23279,
-23131,
-23024,
-22881,
-22796,
-22733,
-22735,
-22762,
-22828,
-22876,
-22982,
-23080,
-23285,
-23512,
-23824,
-24081,
-24317,
-24449,
-24536,
-24594,
-24642,
-24710,
-24797,
-24949,
-25175,
-25588,
-26105,
-26792,
-27486,
-28128,
-28610,
-28913,
-28974,
-28934,
-28785,
-28750,
-28856,
-29175,
-29542,
-29917,
-30071,
-30107,
-30068,
-30092,
-30216,
-30406,
-30489,
-30511,
-30459,
-30486,
-30667,
-31012,
-31391,
-31724,
-31984,
-32129,
-32302,
-32483,
-32708,
-33018,
-33480,
-34105,
-34975,
-35847,
-36731,
-37353,
-37854,
-38111,
-38361,
-38562,
-38759,
-38977,
-39187,
-39482,
-39805,
-40230,
-40567,
-40870,
-40966,
-40960,
-40852,
-40733,
-40617,
-40549,
-40475,
-40395,
-40281,
-40128,
-39967,
-39836,
-39746,
-39713,
-39693,
-39670,
-39616,
-39581,
-39602,
-39735,
-39988,
-40297,
-40615,
-40835,
-40976,
-41054,
-41090,
-41142,
-41197,
-41231,
-41232,
-41163,
-41041,
-40847,
-40615,
-40337,
-40056,
-39750,
-39445,
-39080,
-38647,
-38139,
-37532,
-36922,
-36272,
-35690,
-35136,
-34645,
-34186,
-33775,
-33406,
-33077,
-32809,
-32543,
-32325,
-32050,
-31853,
-31613,
-31490,
-31424,
-31416,
-31460,
-31465,
-31427,
-31305,
-31167,
-30977,
-30844,
-30679,
-30522,
-30293,
-30017,
-29696,
-29410,
-29095,
-28831,
-28484,
-28112,
-27657,
-27179,
-26714,
-26289,
-25934,
-25672,
-25462,
-25381,
-25345,
-25381,
-25462,
-25573,
-25762,
-25993,
-26294,
-26591,
-26833,
-27043,
-27192,
-27368,
-27596,
-27880,
-28196,
-28521,
-28794,
-29065,
-29296,
-29572,
-29799,
-30090,
-30272,
-30500,
-30633,
-30781,
-30916,
-31039,
-31220,
-31353,
-31550,
-31668,
-31829,
-31932,
-32080,
-32239,
-32464,
-32733,
-33048,
-33379,
-33726,
-34067,
-34419,
-34773,
-35141,
-35488,
-35829,
-36122,
-36425,
-36687,
-37012,
-37317,
-37633,
-37967,
-38229,
-38533,
-38805,
-39091,
-39398,
-39692,
-39946,
-40158,
-40263,
-40336,
-40351,
-40344,
-40373,
-40404,
-40460,
-40511,
-40544,
-40555,
-40546,
-40511,
-40495,
-40485,
-40496,
-40543,
-40570,
-40591,
-40596,
-40567,
-40597,
-40572,
-40621,
-40561,
-40500,
-40302,
-40093,
-39811,
-39591,
-39322,
-39111,
-38845,
-38577,
-38289,
-37983,
-37693,
-37386,
-37079,
-36744,
-36376,
-35985,
-35564,
-35097,
-34656,
-34137,
-33703,
-33277,
-32941,
-32669,
-32403,
-32114,
-31734,
-31328,
-30847,
-30478,
-30143,
-29916,
-29719,
-29518,
-29327,
-29101,
-28951,
-28781,
-28669,
-28581,
-28492,
-28450,
-28412,
-28377,
-28340,
-28305,
-28256,
-28253,
-28243,
-28269,
-28233,
-28166,
-28047,
-27901,
-27822,
-27781,
-27874,
-28009,
-28277,
-28504,
-28797,
-29004,
-29178,
-29360,
-29529,
-29824,
-30152,
-30592,
-31034,
-31450,
-31831,
-32159,
-32473,
-32787,
-33139,
-33540,
-34009,
-34495,
-34996,
-35434,
-35777,
-36060,
-36254,
-36435,
-36621,
-36761,
-36904,
-36928,
-36923,
-36862,
-36830,
-36810,
-36883,
-36919,
-37038,
-37064,
-37084,
-37062,
-36957,
-36863,
-36722,
-36577,
-36453,
-36322,
-36188,
-36049,
-35879,
-35673,
-35459,
-35203,
-34968,
-34715,
-34489,
-34218,
-33999,
-33684,
-33427,
-33085,
-32796,
-32472,
-32164,
-31842,
-31451,
-31041,
-30538,
-30053,
-29529,
-29083,
-28680,
-28347,
-28066,
-27760,
-27459,
-27091,
-26661,
-26237,
-25751,
-25348,
-24930,
-24611,
-24319,
-24055,
-23807,
-23524,
-23275,
-23052,
-22877,
-22761,
-22628,
-22507,
-22321,
-22175,
-22031,
-21971,
-21920,
-21888,
-21835,
-21770,
-21743,
-21759,
-21837,
-21974,
-22123,
-22292,
-22472,
-22644,
-22876,
-23087,
-23339,
-23580,
-23829,
-24087,
-24328,
-24551,
-24753,
-24879,
-24994,
-25071,
-25153,
-25302,
-25424,
-25663,
-25841,
-26083,
-26310,
-26536,
-26844,
-27203,
-27716,
-28352,
-29074,
-29860,
-30526,
-31081,
-31383,
-31585,
-31689,
-31895,
-32220,
-32693,
-33244,
-33760,
-34209,
-34571,
-34901,
-35249,
-35653,
-36067,
-36387,
-36620,
-36672,
-36737,
-36760,
-36900,
-37003,
-37119,
-37070,
-36901,
-36640,
-36354,
-36123,
-36044,
-36096,
-36402,
-36861,
-37432,
-38007,
-38422,
-38657,
-38717,
-38638,
-38556,
-38485,
-38443,
-38481,
-38549,
-38711,
-38930,
-39136,
-39315,
-39365,
-39334,
-39282,
-39191,
-39189,
-39155,
-39155,
-39096,
-39032,
-38892,
-38739,
-38480,
-38197,
-37843,
-37531,
-37192,
-36916,
-36688,
-36552,
-36581,
-36767,
-37098,
-37507,
-37844,
-38120,
-38249,
-38345,
-38444,
-38545,
-38703,
-38815,
-38968,
-39053,
-39186,
-39283,
-39415,
-39517,
-39613,
-39650,
-39667,
-39572,
-39413,
-39108,
-38744,
-38297,
-37852,
-37422,
-37024,
-36632,
-36262,
-35791,
-35348,
-34774,
-34241,
-33692,
-33189,
-32808,
-32497,
-32290,
-32137,
-31983,
-31822,
-31591,
-31313,
-30983,
-30626,
-30288,
-29971,
-29720,
-29526,
-29378,
-29248,
-29168,
-29045,
-28954,
-28808,
-28631,
-28403,
-28102,
-27790,
-27428,
-27145,
-26863,
-26653,
-26470,
-26304,
-26137,
-25992,
-25877,
-25799,
-25789,
-25799,
-25880,
-25949,
-26036,
-26108,
-26171,
-26264,
-26350,
-26473,
-26661,
-26875,
-27136,
-27427,
-27678,
-27961,
-28192,
-28455,
-28701,
-28998,
-29277,
-29620,
-29938,
-30262,
-30559,
-30791,
-31006,
-31149,
-31316,
-31483,
-31743,
-32071,
-32515,
-32996,
-33526,
-33999,
-34464,
-34871,
-35287,
-35724,
-36173,
-36641,
-37087,
-37470,
-37849,
-38167,
-38526,
-38889,
-39279,
-39635,
-39959,
-40216,
-40457,
-40676,
-40919,
-41176,
-41419,
-41631,
-41722,
-41755,
-41667,
-41570,
-41426,
-41300,
-41167,
-41036,
-40852,
-40696,
-40507,
-40381,
-40275,
-40212,
-40138,
-40070,
-39917,
-39746,
-39473,
-39207,
-38869,
-38578,
-38264,
-37981,
-37726,
-37441,
-37209,
-36883,
-36597,
-36221,
-35897,
-35535,
-35212,
-34885,
-34546,
-34218,
-33872,
-33537,
-33222,
-32896,
-32633,
-32340,
-32143,
-31931,
-31772,
-31584,
-31366,
-31097,
-30826,
-30584,
-30444,
-30410,
-30445,
-30525,
-30536,
-30541,
-30445,
-30390,
-30335,
-30329,
-30359,
-30375,
-30393,
-30347,
-30314,
-30241,
-30248,
-30236,
-30271,
-30255,
-30215,
-30130,
-30058,
-30004,
-30033,
-30077,
-30231,
-30322,
-30514,
-30640,
-30800,
-30904,
-30974,
-31021,
-31054,
-31107,
-31210,
-31318,
-31438,
-31582,
-31707,
-31919,
-32120,
-32359,
-32544,
-32665,
-32736,
-32794,
-32886,
-33084,
-33300,
-33550,
-33716,
-33815,
-33822,
-33801,
-33762,
-33736,
-33716,
-33675,
-33600,
-33507,
-33412,
-33348,
-33355,
-33368,
-33433,
-33425,
-33391,
-33260,
-33115,
-32903,
-32778,
-32632,
-32571,
-32519,
-32460,
-32389,
-32282,
-32189,
-32046,
-31956,
-31767,
-31630,
-31423,
-31325,
-31243,
-31257,
-31251,
-31203,
-31045,
-30790,
-30527,
-30262,
-30102,
-29956,
-29855,
-29663,
-29458,
-29232,
-29068,
-29003,
-28981,
-28909,
-28751,
-28463,
-28174,
-27974,
-27933,
-28028,
-28172,
-28241,
-28235,
-28154,
-28042,
-27971,
-27959,
-28054,
-28242,
-28539,
-28825,
-29081,
-29156,
-29171,
-29137,
-29224,
-29473,
-29789,
-30130,
-30361,
-30484,
-30581,
-30637,
-30708,
-30713,
-30705,
-30669,
-30757,
-30949,
-31238,
-31522,
-31683,
-31730,
-31692,
-31653,
-31729,
-31867,
-32100,
-32323,
-32505,
-32568,
-32547,
-32403,
-32242,
-32158,
-32157,
-32265,
-32396,
-32439,
-32401,
-32211,
-32015,
-31851,
-31795,
-31831,
-31948,
-32050,
-32153,
-32134,
-32048,
-31871,
-31667,
-31566,
-31600,
-31868,
-32263,
-32693,
-32929,
-32905,
-32584,
-32151,
-31831,
-31707,
-31886,
-32094,
-32252,
-32175,
-31959,
-31695,
-31538,
-31508,
-31540,
-31560,
-31494,
-31381,
-31284,
-31228,
-31239,
-31277,
-31295,
-31305,
-31259,
-31191,
-31073,
-30950,
-30861,
-30869,
-31057,
-31362,
-31815,
-32212,
-32564,
-32733,
-32823,
-32782,
-32796,
-32810,
-32926,
-33076,
-33271,
-33444,
-33641,
-33826,
-33975,
-34124,
-34189,
-34190,
-34168,
-34082,
-34097,
-34100,
-34170,
-34217,
-34221,
-34170,
-34116,
-34073,
-34126,
-34208,
-34323,
-34380,
-34350,
-34257,
-34173,
-34162,
-34305,
-34554,
-34846,
-35094,
-35245,
-35297,
-35282,
-35256,
-35210,
-35213,
-35248,
-35351,
-35539,
-35733,
-35929,
-35998,
-35968,
-35884,
-35800,
-35805,
-35807,
-35805,
-35663,
-35417,
-35116,
-34790,
-34585,
-34407,
-34277,
-34116,
-33894,
-33627,
-33320,
-33028,
-32748,
-32562,
-32386,
-32284,
-32193,
-32101,
-32050,
-31976,
-31978,
-31888,
-31826,
-31655,
-31526,
-31467,
-31525,
-31712,
-31893,
-32046,
-32128,
-32223,
-32369,
-32631,
-32858,
-33004,
-32953,
-32805,
-32665,
-32602,
-32700,
-32829,
-32992,
-33091,
-33159,
-33143,
-33101,
-32937,
-32743,
-32571,
-32501,
-32580,
-32729,
-32851,
-32859,
-32758,
-32596,
-32460,
-32383,
-32357,
-32386,
-32474,
-32651,
-32875,
-33150,
-33345,
-33494,
-33546,
-33627,
-33753,
-33972,
-34187,
-34395,
-34452,
-34456,
-34373,
-34345,
-34364,
-34476,
-34625,
-34780,
-34895,
-34929,
-34932,
-34879,
-34819,
-34767,
-34676,
-34629,
-34519,
-34448,
-34351,
-34275,
-34169,
-34056,
-33899,
-33716,
-33545,
-33395,
-33340,
-33412,
-33555,
-33733,
-33821,
-33759,
-33598,
-33373,
-33242,
-33210,
-33297,
-33398,
-33473,
-33503,
-33461,
-33423,
-33373,
-33337,
-33355,
-33457,
-33666,
-33928,
-34157,
-34238,
-34144,
-33898,
-33639,
-33432,
-33317,
-33289,
-33255,
-33243,
-33184,
-33127,
-33002,
-32833,
-32583,
-32362,
-32229,
-32226,
-32365,
-32511,
-32609,
-32580,
-32424,
-32264,
-32175,
-32200,
-32364,
-32540,
-32672,
-32766,
-32754,
-32808,
-32875,
-33037,
-33226,
-33385,
-33519,
-33536,
-33529,
-33434,
-33326,
-33197,
-33085,
-33021,
-32982,
-32903,
-32821,
-32651,
-32484,
-32365,
-32281,
-32311,
-32261,
-32246,
-32090,
-31955,
-31760,
-31608,
-31477,
-31396,
-31429,
-31482,
-31659,
-31755,
-31861,
-31783,
-31705,
-31621,
-31657,
-31910,
-32267,
-32740,
-33098,
-33261,
-33122,
-32732,
-32263,
-31920,
-31902,
-32190,
-32625,
-32916,
-32841,
-32404,
-31751,
-31250,
-31061,
-31287,
-31577,
-31787,
-31612,
-31215,
-30805,
-30676,
-30921,
-31356,
-31636,
-31600,
-31253,
-30966,
-31029,
-31616,
-32437,
-33184,
-33476,
-33347,
-33109,
-33053,
-33445,
-34128,
-34835,
-35259,
-35332,
-35065,
-34776,
-34628,
-34772,
-35167,
-35617,
-35888,
-35824,
-35472,
-34995,
-34713,
-34711,
-34869,
-35017,
-34839,
-34498,
-34088,
-33978,
-34200,
-34567,
-34773,
-34595,
-34104,
-33653,
-33616,
-34096,
-34901,
-35468,
-35494,
-34962,
-34348,
-34272,
-34860,
-35850,
-36452,
-36249,
-35372,
-34529,
-34467,
-35245,
-36271,
-36704,
-36130,
-35082,
-34374,
-34665,
-35721,
-36653,
-36665,
-35517,
-33951,
-32868,
-32967,
-34063,
-35467,
-36261,
-35956,
-34647,
-32965,
-31688,
-31500,
-32411,
-34055,
-35517,
-36072,
-35423,
-33998,
-32617,
-32106,
-32643,
-33858,
-34986,
-35385,
-35032,
-34145,
-33403,
-32975,
-33040,
-33335,
-33656,
-33905,
-33976,
-33842,
-33558,
-33105,
-32753,
-32548,
-32668,
-32909,
-33102,
-33031,
-32643,
-32077,
-31512,
-31180,
-31099,
-31221,
-31431,
-31490,
-31398,
-31044,
-30612,
-30176,
-30004,
-30080,
-30399,
-30710,
-30772,
-30542,
-29985,
-29466,
-29062,
-29034,
-29182,
-29382,
-29352,
-29039,
-28568,
-28109,
-27939,
-27958,
-28133,
-28151,
-27889,
-27393,
-26849,
-26514,
-26516,
-26755,
-27045,
-27108,
-26864,
-26379,
-25866,
-25590,
-25629,
-25962,
-26345,
-26588,
-26551,
-26247,
-25853,
-25496,
-25422,
-25584,
-26017,
-26452,
-26811,
-26857,
-26681,
-26372,
-26127,
-26172,
-26425,
-26861,
-27205,
-27443,
-27552,
-27643,
-27775,
-27965,
-28130,
-28267,
-28399,
-28630,
-28970,
-29392,
-29791,
-30083,
-30313,
-30520,
-30833,
-31174,
-31562,
-31836,
-32101,
-32275,
-32564,
-32882,
-33261,
-33629,
-33920,
-34173,
-34456,
-34775,
-35153,
-35514,
-35765,
-35864,
-35884,
-35901,
-36095,
-36480,
-36988,
-37472,
-37796,
-37810,
-37678,
-37410,
-37287,
-37335,
-37578,
-37929,
-38252,
-38430,
-38424,
-38261,
-38071,
-37953,
-37992,
-38148,
-38337,
-38481,
-38433,
-38300,
-38049,
-37842,
-37694,
-37618,
-37535,
-37465,
-37308,
-37129,
-36981,
-36810,
-36735,
-36568,
-36382,
-36076,
-35732,
-35380,
-35110,
-34911,
-34798,
-34669,
-34504,
-34250,
-33944,
-33642,
-33405,
-33227,
-33131,
-32990,
-32865,
-32597,
-32415,
-32237,
-32253,
-32395,
-32581,
-32732,
-32665,
-32415,
-31989,
-31599,
-31382,
-31466,
-31795,
-32224,
-32504,
-32539,
-32241,
-31798,
-31330,
-31083,
-31051,
-31276,
-31625,
-31945,
-32169,
-32110,
-31801,
-31315,
-30858,
-30750,
-31068,
-31758,
-32468,
-32826,
-32621,
-31963,
-31161,
-30623,
-30629,
-31109,
-31925,
-32708,
-33204,
-33233,
-32809,
-32105,
-31455,
-31225,
-31563,
-32423,
-33367,
-34002,
-34031,
-33477,
-32646,
-31889,
-31512,
-31582,
-32062,
-32758,
-33390,
-33709,
-33472,
-32722,
-31721,
-30952,
-30765,
-31283,
-32146,
-32917,
-33148,
-32808,
-32032,
-31221,
-30549,
-30264,
-30281,
-30708,
-31289,
-31893,
-32158,
-31919,
-31220,
-30409,
-29885,
-29924,
-30419,
-31119,
-31705,
-32053,
-32118,
-31968,
-31618,
-31166,
-30813,
-30829,
-31394,
-32396,
-33385,
-33900,
-33624,
-32815,
-31913,
-31576,
-31898,
-32832,
-33800,
-34422,
-34506,
-34128,
-33604,
-33157,
-32989,
-33041,
-33301,
-33619,
-34010,
-34413,
-34766,
-35003,
-34946,
-34679,
-34188,
-33833,
-33748,
-34182,
-34889,
-35757,
-36240,
-36287,
-35740,
-34991,
-34305,
-34081,
-34355,
-35024,
-35734,
-36163,
-36095,
-35549,
-34733,
-33962,
-33502,
-33513,
-33929,
-34601,
-35193,
-35449,
-35216,
-34509,
-33633,
-32903,
-32690,
-33087,
-33864,
-34623,
-34950,
-34659,
-33935,
-33092,
-32518,
-32383,
-32661,
-33181,
-33770,
-34159,
-34253,
-33845,
-33114,
-32307,
-31824,
-31982,
-32645,
-33502,
-33954,
-33807,
-33114,
-32365,
-31976,
-32122,
-32633,
-33121,
-33337,
-33215,
-32979,
-32851,
-32946,
-33236,
-33476,
-33516,
-33368,
-33102,
-33024,
-33183,
-33629,
-34111,
-34440,
-34355,
-34051,
-33579,
-33451,
-33650,
-34300,
-35055,
-35684,
-35921,
-35771,
-35337,
-34836,
-34523,
-34491,
-34892,
-35590,
-36443,
-37025,
-37080,
-36415,
-35353,
-34363,
-34050,
-34647,
-35916,
-37239,
-37931,
-37682,
-36638,
-35412,
-34628,
-34725,
-35601,
-36869,
-37833,
-38154,
-37651,
-36685,
-35729,
-35258,
-35372,
-35933,
-36519,
-36880,
-36874,
-36672,
-36364,
-36057,
-35602,
-35030,
-34394,
-34001,
-34148,
-34735,
-35483,
-35729,
-35131,
-33750,
-32148,
-31142,
-31133,
-32134,
-33369,
-34072,
-33710,
-32352,
-30777,
-29739,
-29791,
-30748,
-31978,
-32628,
-32357,
-31313,
-30176,
-29671,
-29947,
-30773,
-31395,
-31427,
-30827,
-30122,
-29832,
-30091,
-30570,
-30708,
-30241,
-29400,
-28720,
-28690,
-29262,
-29964,
-30175,
-29643,
-28598,
-27618,
-27284,
-27647,
-28491,
-29217,
-29452,
-29124,
-28548,
-28048,
-27987,
-28287,
-28814,
-29355,
-29767,
-30082,
-30230,
-30262,
-30127,
-30068,
-30188,
-30684,
-31403,
-31962,
-32136,
-31743,
-31206,
-30889,
-31124,
-31757,
-32438,
-32719,
-32521,
-32047,
-31594,
-31414,
-31471,
-31606,
-31687,
-31670,
-31594,
-31576,
-31614,
-31689,
-31778,
-31754,
-31652,
-31458,
-31289,
-31311,
-31569,
-32101,
-32683,
-33127,
-33216,
-32994,
-32587,
-32330,
-32341,
-32688,
-33081,
-33333,
-33211,
-32831,
-32446,
-32293,
-32502,
-32848,
-33010,
-32759,
-32185,
-31593,
-31396,
-31685,
-32245,
-32634,
-32528,
-31930,
-31251,
-30848,
-31006,
-31564,
-32079,
-32245,
-31834,
-31141,
-30571,
-30582,
-31264,
-32466,
-33520,
-33908,
-33334,
-31970,
-30645,
-30003,
-30593,
-32000,
-33533,
-34260,
-33801,
-32506,
-31100,
-30369,
-30577,
-31349,
-32201,
-32555,
-32373,
-31846,
-31314,
-31014,
-30956,
-30983,
-30972,
-30754,
-30508,
-30228,
-30259,
-30499,
-30891,
-31115,
-30880,
-30312,
-29704,
-29571,
-30078,
-30900,
-31434,
-31194,
-30300,
-29390,
-29228,
-29977,
-31192,
-32017,
-31893,
-30996,
-29957,
-29473,
-29749,
-30478,
-31160,
-31464,
-31397,
-31078,
-30733,
-30304,
-29998,
-29834,
-29968,
-30352,
-30649,
-30721,
-30423,
-30037,
-29927,
-30167,
-30619,
-30854,
-30600,
-29972,
-29363,
-29225,
-29696,
-30516,
-31197,
-31328,
-30943,
-30298,
-29965,
-30131,
-30781,
-31503,
-31902,
-31747,
-31303,
-30879,
-30956,
-31484,
-32233,
-32704,
-32636,
-32077,
-31499,
-31309,
-31814,
-32735,
-33618,
-33913,
-33487,
-32625,
-31909,
-31950,
-32797,
-34167,
-35266,
-35587,
-34949,
-33805,
-32895,
-32751,
-33501,
-34663,
-35615,
-35992,
-35726,
-35252,
-34822,
-34670,
-34622,
-34551,
-34463,
-34502,
-34885,
-35557,
-36221,
-36356,
-35824,
-34660,
-33545,
-33070,
-33598,
-34832,
-36095,
-36562,
-35933,
-34465,
-32995,
-32259,
-32599,
-33828,
-35125,
-35917,
-35719,
-34716,
-33325,
-32272,
-31932,
-32518,
-33685,
-34902,
-35539,
-35313,
-34324,
-33132,
-32324,
-32336,
-33061,
-34089,
-34833,
-34923,
-34401,
-33625,
-33044,
-32984,
-33424,
-34104,
-34695,
-34898,
-34762,
-34366,
-34025,
-33875,
-33995,
-34311,
-34644,
-34997,
-35293,
-35598,
-35830,
-35817,
-35515,
-35036,
-34769,
-35100,
-36034,
-37078,
-37547,
-37035,
-35915,
-35064,
-35250,
-36430,
-37707,
-38048,
-37059,
-35407,
-34306,
-34485,
-35817,
-37206,
-37763,
-37156,
-35972,
-34922,
-34563,
-34784,
-35317,
-35884,
-36293,
-36424,
-36070,
-35230,
-34222,
-33668,
-34049,
-35191,
-36410,
-36828,
-36207,
-34968,
-34024,
-33842,
-34367,
-35009,
-35381,
-35470,
-35545,
-35674,
-35554,
-34856,
-33706,
-32685,
-32611,
-33605,
-35041,
-35886,
-35465,
-34080,
-32600,
-31939,
-32283,
-33161,
-33801,
-33855,
-33402,
-32832,
-32416,
-32205,
-32081,
-32030,
-32092,
-32287,
-32570,
-32714,
-32756,
-32631,
-32647,
-32702,
-32858,
-32868,
-32777,
-32690,
-32766,
-33096,
-33426,
-33614,
-33467,
-33171,
-32969,
-33092,
-33451,
-33857,
-34020,
-33859,
-33609,
-33484,
-33728,
-34209,
-34582,
-34566,
-34129,
-33621,
-33491,
-33977,
-34730,
-35255,
-35055,
-34322,
-33606,
-33551,
-34243,
-35152,
-35560,
-35162,
-34342,
-33773,
-34011,
-34761,
-35389,
-35277,
-34404,
-33413,
-33062,
-33569,
-34618,
-35274,
-35009,
-33821,
-32402,
-31613,
-31911,
-33047,
-34199,
-34558,
-33804,
-32333,
-31066,
-30679,
-31373,
-32525,
-33284,
-33016,
-31840,
-30474,
-29827,
-30263,
-31492,
-32584,
-32791,
-31938,
-30513,
-29454,
-29264,
-29973,
-30968,
-31608,
-31601,
-31071,
-30451,
-30005,
-29801,
-29662,
-29491,
-29366,
-29444,
-29816,
-30365,
-30608,
-30399,
-29607,
-28731,
-28295,
-28613,
-29520,
-30444,
-30761,
-30312,
-29447,
-28829,
-28918,
-29642,
-30554,
-31032,
-30881,
-30266,
-29641,
-29412,
-29662,
-30187,
-30691,
-30995,
-31085,
-31073,
-31009,
-30898,
-30664,
-30414,
-30282,
-30498,
-31064,
-31765,
-32144,
-31927,
-31090,
-30131,
-29624,
-29974,
-31031,
-32177,
-32768,
-32344,
-31230,
-29971,
-29362,
-29733,
-30926,
-32308,
-33173,
-33033,
-31940,
-30427,
-29244,
-29011,
-29807,
-31213,
-32478,
-32967,
-32558,
-31441,
-30275,
-29438,
-29202,
-29551,
-30320,
-31337,
-32254,
-32606,
-32109,
-30715,
-29072,
-28021,
-28285,
-29818,
-31792,
-33037,
-32791,
-31156,
-29103,
-27787,
-27857,
-29204,
-31000,
-32325,
-32602,
-31814,
-30469,
-29214,
-28621,
-28933,
-29985,
-31336,
-32446,
-32874,
-32552,
-31714,
-30755,
-30113,
-30029,
-30553,
-31573,
-32856,
-33910,
-34339,
-33792,
-32506,
-31137,
-30517,
-31176,
-32799,
-34538,
-35411,
-35040,
-33818,
-32657,
-32147,
-32433,
-33088,
-33663,
-34070,
-34424,
-34796,
-35093,
-34865,
-34134,
-33054,
-32375,
-32516,
-33536,
-34938,
-36036,
-36315,
-35748,
-34616,
-33433,
-32633,
-32520,
-33145,
-34348,
-35649,
-36504,
-36495,
-35530,
-33994,
-32645,
-32111,
-32769,
-34226,
-35776,
-36496,
-35999,
-34464,
-32730,
-31650,
-31731,
-32760,
-34025,
-34704,
-34419,
-33364,
-32096,
-31335,
-31287,
-31893,
-32636,
-32961,
-32629,
-31681,
-30690,
-30227,
-30618,
-31641,
-32526,
-32522,
-31428,
-29818,
-28790,
-29102,
-30656,
-32416,
-33219,
-32486,
-30847,
-29457,
-29387,
-30689,
-32560,
-33846,
-33904,
-32855,
-31528,
-30724,
-30852,
-31749,
-32903,
-33844,
-34322,
-34372,
-34039,
-33478,
-32789,
-32170,
-32009,
-32510,
-33757,
-35315,
-36432,
-36543,
-35406,
-33650,
-32192,
-31910,
-33062,
-35095,
-37003,
-37895,
-37353,
-35833,
-34128,
-33148,
-33340,
-34565,
-36201,
-37457,
-37792,
-37179,
-36008,
-34913,
-34401,
-34535,
-35173,
-35918,
-36482,
-36814,
-36854,
-36639,
-36134,
-35342,
-34507,
-33951,
-33999,
-34683,
-35640,
-36253,
-36088,
-35023,
-33620,
-32542,
-32383,
-33146,
-34282,
-35039,
-34906,
-33945,
-32782,
-32003,
-31990,
-32486,
-33024,
-33225,
-33035,
-32749,
-32613,
-32599,
-32546,
-32162,
-31587,
-31182,
-31312,
-32159,
-33214,
-33930,
-33711,
-32595,
-31186,
-30293,
-30463,
-31620,
-33032,
-33890,
-33708,
-32718,
-31610,
-31145,
-31595,
-32604,
-33527,
-33770,
-33376,
-32779,
-32606,
-33061,
-33870,
-34371,
-34171,
-33343,
-32563,
-32429,
-33233,
-34474,
-35441,
-35505,
-34716,
-33656,
-33023,
-33202,
-33975,
-34787,
-35195,
-35016,
-34623,
-34328,
-34419,
-34653,
-34808,
-34684,
-34451,
-34421,
-34762,
-35264,
-35490,
-35077,
-34223,
-33538,
-33686,
-34708,
-36015,
-36551,
-35802,
-33983,
-32224,
-31553,
-32530,
-34486,
-36300,
-36840,
-35774,
-33698,
-31731,
-30913,
-31575,
-33241,
-34900,
-35546,
-34893,
-33244,
-31705,
-30975,
-31444,
-32530,
-33441,
-33522,
-32769,
-31815,
-31237,
-31388,
-31792,
-31999,
-31578,
-30858,
-30352,
-30499,
-31237,
-31903,
-31959,
-31130,
-29902,
-29008,
-29019,
-29927,
-31094,
-31781,
-31529,
-30518,
-29452,
-28893,
-29218,
-30008,
-30774,
-31075,
-30887,
-30584,
-30508,
-30735,
-31032,
-31077,
-30735,
-30304,
-30173,
-30676,
-31676,
-32695,
-33169,
-32790,
-31756,
-30657,
-30123,
-30457,
-31521,
-32770,
-33662,
-33913,
-33457,
-32652,
-31715,
-31127,
-31018,
-31643,
-32728,
-34003,
-34808,
-34785,
-33898,
-32656,
-31773,
-31815,
-32732,
-34025,
-34868,
-34867,
-33992,
-32970,
-32412,
-32687,
-33540,
-34306,
-34453,
-33832,
-32948,
-32311,
-32383,
-32913,
-33561,
-33753,
-33486,
-32913,
-32423,
-32145,
-32075,
-32012,
-31965,
-31937,
-32089,
-32375,
-32651,
-32676,
-32372,
-31871,
-31466,
-31467,
-31883,
-32523,
-33014,
-33025,
-32606,
-31980,
-31589,
-31735,
-32345,
-33134,
-33579,
-33497,
-32869,
-32196,
-31886,
-32216,
-33037,
-33884,
-34292,
-34092,
-33427,
-32748,
-32461,
-32662,
-33269,
-33919,
-34363,
-34436,
-34079,
-33526,
-32941,
-32720,
-32997,
-33739,
-34568,
-35016,
-34761,
-33961,
-33064,
-32769,
-33173,
-34192,
-35063,
-35369,
-34911,
-34157,
-33652,
-33817,
-34550,
-35290,
-35561,
-35098,
-34327,
-33794,
-33955,
-34704,
-35482,
-35706,
-35213,
-34294,
-33669,
-33635,
-34215,
-34856,
-35089,
-34708,
-34040,
-33508,
-33455,
-33695,
-33887,
-33664,
-33126,
-32612,
-32566,
-33018,
-33477,
-33410,
-32493,
-31241,
-30454,
-30786,
-32079,
-33357,
-33604,
-32362,
-30369,
-28874,
-28879,
-30368,
-32256,
-33257,
-32613,
-30727,
-28692,
-27705,
-28187,
-29775,
-31383,
-32122,
-31544,
-29991,
-28328,
-27359,
-27583,
-28625,
-29856,
-30412,
-30134,
-29338,
-28717,
-28678,
-29017,
-29150,
-28794,
-28168,
-28140,
-29127,
-30848,
-32080,
-31867,
-30083,
-27977,
-27045,
-28097,
-30460,
-32640,
-33290,
-32292,
-30595,
-29474,
-29486,
-30420,
-31488,
-32169,
-32383,
-32333,
-32206,
-31964,
-31626,
-31235,
-31071,
-31313,
-31816,
-32462,
-32900,
-33098,
-33019,
-32704,
-32187,
-31619,
-31271,
-31484,
-32354,
-33544,
-34470,
-34502,
-33639,
-32331,
-31431,
-31533,
-32587,
-33986,
-34891,
-34830,
-34003,
-33066,
-32775,
-33236,
-34105,
-34570,
-34275,
-33395,
-32692,
-32769,
-33594,
-34555,
-34681,
-33842,
-32429,
-31521,
-31736,
-33024,
-34544,
-35399,
-35167,
-34135,
-32922,
-32082,
-31857,
-32129,
-32846,
-33730,
-34652,
-35241,
-35234,
-34538,
-33472,
-32486,
-32165,
-32627,
-33709,
-34952,
-35811,
-36066,
-35577,
-34714,
-33723,
-33117,
-32985,
-33430,
-34091,
-34747,
-35043,
-34965,
-34556,
-34063,
-33594,
-33329,
-33238,
-33354,
-33620,
-34044,
-34480,
-34835,
-34880,
-34618,
-34043,
-33549,
-33358,
-33710,
-34416,
-35044,
-35242,
-34771,
-34096,
-33654,
-33950,
-34786,
-35655,
-35890,
-35289,
-34276,
-33513,
-33630,
-34462,
-35530,
-36050,
-35779,
-34826,
-33826,
-33182,
-33196,
-33631,
-34243,
-34676,
-34728,
-34432,
-33857,
-33328,
-33074,
-33210,
-33629,
-34051,
-34128,
-33760,
-33045,
-32279,
-31768,
-31673,
-31985,
-32586,
-33251,
-33674,
-33590,
-32860,
-31676,
-30583,
-30120,
-30631,
-31870,
-33112,
-33575,
-32918,
-31415,
-29990,
-29244,
-29661,
-30702,
-31786,
-32202,
-31783,
-30781,
-29695,
-29085,
-29097,
-29755,
-30650,
-31352,
-31503,
-31014,
-30098,
-29246,
-28841,
-29086,
-29799,
-30673,
-31361,
-31773,
-31757,
-31439,
-30790,
-30096,
-29680,
-29939,
-30941,
-32285,
-33236,
-33217,
-32226,
-30953,
-30245,
-30637,
-31885,
-33201,
-33937,
-33733,
-33006,
-32175,
-31708,
-31692,
-32087,
-32756,
-33447,
-33878,
-33750,
-33043,
-32177,
-31749,
-32209,
-33348,
-34378,
-34610,
-33844,
-32734,
-32170,
-32582,
-33737,
-34753,
-35040,
-34544,
-33810,
-33391,
-33459,
-33763,
-33909,
-33913,
-33840,
-34029,
-34347,
-34567,
-34453,
-34026,
-33546,
-33343,
-33420,
-33687,
-33879,
-33969,
-33878,
-33670,
-33310,
-32832,
-32488,
-32446,
-32858,
-33433,
-33763,
-33517,
-32774,
-32034,
-31849,
-32389,
-33333,
-33971,
-33921,
-33193,
-32384,
-32111,
-32577,
-33423,
-33951,
-33662,
-32705,
-31802,
-31755,
-32785,
-34246,
-35159,
-34726,
-33332,
-31972,
-31766,
-32943,
-34624,
-35543,
-34983,
-33382,
-31977,
-31791,
-33034,
-34708,
-35781,
-35507,
-34210,
-32738,
-31929,
-32255,
-33486,
-35121,
-36367,
-36667,
-35748,
-34052,
-32439,
-31920,
-32860,
-34778,
-36468,
-36923,
-35913,
-34260,
-33061,
-33005,
-33889,
-34911,
-35531,
-35572,
-35431,
-35304,
-35077,
-34499,
-33564,
-32797,
-32873,
-33988,
-35607,
-36683,
-36476,
-35007,
-33205,
-32030,
-32193,
-33389,
-34964,
-35964,
-36004,
-35034,
-33555,
-32230,
-31587,
-31951,
-33056,
-34359,
-35105,
-34899,
-33792,
-32423,
-31487,
-31559,
-32474,
-33712,
-34472,
-34277,
-33296,
-32030,
-31290,
-31330,
-31988,
-32581,
-32582,
-31969,
-31158,
-30818,
-31148,
-31881,
-32370,
-32241,
-31412,
-30463,
-29741,
-29524,
-29654,
-29884,
-30136,
-30355,
-30562,
-30496,
-30030,
-29173,
-28265,
-27871,
-28214,
-29172,
-30193,
-30724,
-30478,
-29641,
-28503,
-27558,
-27078,
-27339,
-28321,
-29686,
-30732,
-30780,
-29628,
-27751,
-26372,
-26296,
-27735,
-29777,
-31219,
-31288,
-30106,
-28518,
-27346,
-27007,
-27294,
-27928,
-28689,
-29582,
-30450,
-30940,
-30711,
-29636,
-28283,
-27380,
-27614,
-28960,
-30815,
-32246,
-32669,
-32026,
-30852,
-29808,
-29406,
-29719,
-30504,
-31524,
-32506,
-33392,
-33976,
-34110,
-33600,
-32634,
-31725,
-31516,
-32370,
-33933,
-35323,
-35748,
-34911,
-33490,
-32392,
-32369,
-33307,
-34591,
-35451,
-35603,
-35313,
-34912,
-34836,
-34914,
-35135,
-35327,
-35552,
-35791,
-35994,
-35999,
-35828,
-35601,
-35562,
-35782,
-36147,
-36510,
-36689,
-36823,
-36993,
-37144,
-37197,
-36899,
-36429,
-36032,
-36061,
-36493,
-37047,
-37198,
-36790,
-35993,
-35226,
-34891,
-34943,
-35174,
-35377,
-35405,
-35514,
-35621,
-35691,
-35481,
-34835,
-34010,
-33321,
-33163,
-33545,
-34206,
-34672,
-34683,
-34195,
-33516,
-32958,
-32836,
-33118,
-33600,
-33993,
-33979,
-33599,
-32997,
-32487,
-32333,
-32532,
-32904,
-33143,
-33025,
-32506,
-31801,
-31179,
-30949,
-31185,
-31711,
-32204,
-32284,
-31887,
-31149,
-30501,
-30283,
-30510,
-31001,
-31350,
-31338,
-31042,
-30615,
-30310,
-30171,
-30168,
-30353,
-30691,
-31304,
-31905,
-32254,
-32041,
-31303,
-30428,
-29951,
-30174,
-31059,
-32086,
-32813,
-32872,
-32350,
-31504,
-30760,
-30404,
-30597,
-31350,
-32336,
-33221,
-33550,
-33134,
-32170,
-31168,
-30670,
-30956,
-31844,
-32856,
-33474,
-33526,
-33041,
-32392,
-31887,
-31778,
-32153,
-32910,
-33771,
-34387,
-34392,
-33777,
-32878,
-32247,
-32300,
-33062,
-34041,
-34711,
-34688,
-34171,
-33495,
-33099,
-33021,
-33212,
-33503,
-33855,
-34222,
-34429,
-34217,
-33476,
-32443,
-31711,
-31786,
-32698,
-33884,
-34499,
-34067,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32767,
+32768,
+32766,
+32768,
+32766,
+32767,
 32769,
-31394,
-30704,
-31136,
-32256,
-33546,
-34191,
-34002,
-33016,
-31743,
-30756,
-30582,
-31340,
-32723,
-33917,
-34264,
-33445,
-32029,
-30898,
-30914,
-32006,
-33487,
-34278,
-33936,
-32692,
-31581,
-31261,
-31975,
-33110,
-33922,
-33954,
-33295,
-32419,
-31844,
-31745,
-32097,
-32670,
-33197,
-33510,
-33490,
-33157,
-32692,
-32340,
-32308,
-32624,
-33069,
-33406,
-33526,
-33438,
-33365,
-33323,
-33303,
-33177,
-32945,
-32777,
-32869,
-33233,
-33770,
-34119,
-34236,
-34062,
-33828,
-33592,
-33444,
-33287,
-33340,
-33644,
-34249,
-34795,
-34837,
-34159,
-33122,
-32394,
-32583,
-33490,
-34420,
-34536,
-33754,
-32732,
-32389,
-33016,
-34071,
-34512,
-33858,
-32486,
-31435,
-31490,
-32559,
-33813,
-34338,
-33871,
-32809,
-31902,
-31608,
-31905,
-32538,
-33177,
-33662,
-33779,
-33480,
-32731,
-31905,
-31520,
-31878,
-32861,
-33807,
-34105,
-33617,
-32773,
-32248,
-32351,
-32793,
-33114,
-32983,
-32688,
-32676,
-33102,
-33682,
+32761,
+32779,
+32745,
+32803,
+32701,
+33013,
+33613,
+33550,
+33597,
+33781,
 33789,
-33201,
-32199,
-31527,
-31687,
-32570,
-33598,
-34021,
-33734,
-33005,
-32528,
-32608,
-33189,
-33828,
-34166,
-33996,
-33559,
-33094,
-32895,
+33466,
+33220,
 33084,
-33519,
-34049,
-34345,
-34310,
-33908,
-33432,
-33147,
-33256,
-33775,
-34347,
-34733,
-34618,
-34082,
-33338,
-32660,
-32325,
-32370,
-32791,
-33419,
-33954,
-34199,
-33907,
-33153,
-32224,
-31571,
-31524,
-32098,
-32959,
-33548,
-33600,
-33011,
-32152,
-31371,
-30989,
-30965,
-31222,
-31494,
-31712,
-31704,
-31543,
-31152,
-30723,
-30330,
-30178,
-30251,
-30477,
-30632,
-30508,
-30114,
-29584,
-29206,
-29205,
-29595,
-30137,
-30535,
-30459,
-29949,
-29227,
-28721,
-28798,
-29418,
-30265,
-30748,
-30496,
-29580,
-28516,
-28024,
-28494,
-29782,
-31154,
-31919,
-31575,
-30479,
-29205,
-28501,
-28681,
-29528,
-30602,
-31378,
-31670,
-31475,
-31073,
-30644,
-30454,
-30518,
-30865,
-31306,
-31738,
-32047,
-32284,
-32496,
-32745,
-32945,
+32894,
+32922,
+32760,
+32606,
+32553,
+32527,
+32740,
+32880,
+32770,
+32550,
+32289,
+32319,
+32533,
+32265,
+31935,
+32223,
+32441,
+32550,
+32544,
+32491,
+32756,
+32668,
+32522,
+32324,
+32390,
+32788,
+32623,
+32546,
+32832,
+33005,
+33024,
+33133,
+33166,
 33008,
-32886,
-32763,
-32878,
-33384,
-34206,
-34966,
-35352,
-35194,
-34738,
-34362,
-34418,
-34949,
-35690,
-36322,
-36589,
-36507,
-36282,
-36120,
-36124,
-36271,
-36455,
-36643,
-36825,
-37067,
-37343,
-37599,
-37698,
-37610,
-37400,
-37213,
-37202,
-37282,
-37411,
-37360,
-37229,
-37112,
-37214,
-37514,
-37838,
-37866,
-37536,
-36910,
-36337,
-36060,
-36118,
-36411,
-36696,
-36881,
-36910,
-36790,
-36501,
-36021,
-35460,
-34989,
-34784,
-34949,
-35273,
-35554,
-35457,
-35006,
-34272,
-33643,
-33224,
-33214,
-33391,
-33572,
-33568,
-33247,
-32731,
-32142,
-31692,
-31529,
-31580,
-31824,
-32016,
+32752,
+32576,
+32863,
+33117,
+32954,
+32801,
+32812,
+33286,
+33276,
+33236,
+32985,
 32098,
-31975,
-31742,
-31380,
-31084,
-30800,
-30684,
-30763,
-31042,
-31451,
-31717,
-31697,
-31307,
-30859,
-30649,
-30947,
-31586,
-32167,
-32273,
-31766,
-31001,
-30426,
-30446,
-30952,
-31632,
-32073,
-32091,
-31823,
-31462,
-31202,
-31048,
-30941,
-30861,
-30924,
-31149,
-31628,
-32104,
-32413,
-32320,
-31880,
-31312,
-30892,
-30903,
-31304,
-31964,
-32532,
-32805,
-32676,
-32281,
-31837,
-31597,
-31583,
-31810,
-32085,
-32294,
-32442,
-32438,
-32333,
-32023,
-31478,
-30797,
-30241,
-30122,
-30603,
-31543,
-32464,
-32829,
-32376,
-31237,
-29979,
-29216,
-29241,
-30001,
-31039,
-31821,
-32042,
-31676,
-30968,
-30301,
-29914,
-29999,
-30427,
-30995,
-31486,
-31677,
-31621,
-31380,
-31103,
-30848,
-30654,
-30535,
-30578,
-30884,
-31444,
-32025,
-32350,
-32125,
-31448,
-30645,
-30227,
-30541,
-31438,
-32531,
-33181,
-33112,
-32385,
-31458,
-30828,
-30823,
-31372,
-32128,
-32725,
-32900,
-32773,
-32532,
-32420,
-32484,
-32643,
-32779,
-32814,
-32816,
-32861,
-33032,
-33211,
-33300,
-33200,
-32897,
-32628,
-32453,
-32551,
-32842,
+31898,
+32030,
+32471,
+32142,
+31930,
+32403,
+32727,
+32987,
+32560,
+32769,
+32860,
+31897,
+31125,
+31851,
+32746,
+31886,
+31253,
+32391,
 33172,
+32545,
+32275,
+32778,
+33351,
+32566,
+31746,
+32733,
+33397,
+32858,
+32498,
+33206,
+33350,
+32778,
+32594,
+32652,
+32701,
+32644,
+32932,
+32764,
+32457,
+32744,
+33041,
+33168,
+32695,
+32676,
+33208,
+33015,
+32601,
+33041,
+33705,
+33263,
+32479,
+32669,
+33633,
+33553,
+32445,
+32732,
 33415,
-33453,
-33347,
-33142,
-33045,
-32966,
-33043,
-33085,
-33120,
-33134,
-33133,
-33197,
-33243,
-33219,
-33007,
-32671,
-32345,
-32282,
-32566,
-33055,
-33464,
-33552,
+32943,
+32978,
+32854,
+32296,
+32669,
+32827,
+32716,
+32757,
+33002,
+33108,
+32375,
+32485,
+33288,
+32835,
+32414,
+33188,
+32785,
+31795,
+32826,
+33748,
+33225,
+32558,
+32846,
+33693,
+33700,
+32626,
+33026,
+33761,
+32721,
+32294,
+32800,
+33843,
+32982,
+32215,
+34252,
+34099,
+33389,
+33714,
+34024,
+34042,
+33198,
+33135,
+32333,
+32302,
+33014,
+32651,
+33147,
+32913,
+31754,
+32907,
+33680,
+32767,
+32480,
+32592,
+32631,
+31695,
+31978,
+33300,
+31847,
+31297,
+32761,
+33305,
+32610,
+31552,
+32395,
+33735,
+32977,
+31658,
+32822,
+33755,
+32099,
+31813,
+33786,
+34140,
+32116,
+31758,
 33248,
-32833,
-32545,
-32551,
-32726,
-32847,
-32818,
-32729,
-32751,
-32951,
-33134,
-33073,
-32672,
-32169,
-31885,
-32113,
 32675,
-33282,
-33491,
-33219,
-32619,
-32037,
-31748,
-31763,
-32039,
-32315,
-32562,
-32618,
-32567,
-32426,
-32322,
-32345,
-32463,
-32622,
-32606,
-32443,
-32196,
-32171,
-32437,
-32967,
-33381,
-33401,
-32930,
-32251,
-31723,
-31706,
-32049,
-32589,
-32921,
-32962,
-32785,
-32562,
-32393,
-32375,
-32438,
-32680,
-33015,
-33320,
-33474,
-33259,
-32797,
-32345,
-32167,
-32435,
-32955,
-33435,
-33597,
-33435,
-33096,
-32827,
-32769,
-32896,
-33150,
-33421,
-33672,
-33825,
-33782,
-33571,
-33228,
-32990,
+31430,
+31865,
+32776,
+32713,
+31768,
+31834,
+32655,
+32018,
+31473,
+32116,
+32475,
+31586,
+31991,
+32925,
+32041,
+32020,
+32855,
+32462,
+31885,
+32621,
+32814,
+32340,
+32193,
+32736,
+33826,
+33361,
+32642,
 32986,
-33272,
-33646,
-33972,
-33997,
-33856,
-33642,
-33568,
-33642,
-33782,
-33843,
-33761,
-33635,
-33591,
-33719,
-33981,
-34128,
-33989,
-33509,
-32879,
-32468,
-32496,
-32985,
-33606,
-34030,
-33948,
-33528,
-32999,
-32735,
-32782,
-33104,
-33430,
-33626,
-33647,
-33562,
-33489,
-33439,
-33405,
-33353,
-33269,
-33192,
-33138,
-33170,
-33235,
+33747,
+33434,
+33034,
+33711,
+33081,
+32599,
 33397,
-33535,
-33653,
-33683,
-33614,
-33525,
+33565,
+33362,
+34038,
+34151,
+34000,
+33913,
+33510,
+33900,
+33988,
+33518,
+32914,
+33076,
+33533,
+33371,
+33280,
+33302,
+33308,
+32482,
+32357,
+32789,
+32359,
+32455,
+32418,
+32432,
+32973,
+32721,
+32425,
+32350,
+31590,
+32044,
+32563,
+31745,
+32160,
+32697,
+32558,
+32801,
+33272,
+33538,
 33395,
-33337,
-33306,
-33309,
-33342,
-33386,
-33545,
-33708,
-33915,
-33924,
-33773,
-33387,
-33032,
-32821,
-32993,
-33434,
-34011,
-34447,
-34553,
-34326,
-33907,
-33507,
-33317,
-33353,
-33571,
-33793,
-33904,
-33882,
-33727,
-33625,
-33547,
-33673,
-33864,
-34133,
-34326,
-34377,
-34238,
-33996,
-33761,
-33767,
-34018,
-34462,
-34805,
-34880,
-34560,
-34026,
-33600,
-33484,
-33780,
-34330,
-34798,
-35066,
-34977,
-34654,
-34330,
-34056,
-34070,
-34200,
-34487,
-34637,
-34666,
-34451,
-34171,
-33944,
-33864,
-33914,
-33935,
-33883,
-33710,
-33621,
-33688,
-33945,
-34209,
-34274,
-34019,
-33643,
-33277,
-33225,
-33407,
-33693,
-33863,
-33767,
-33521,
-33226,
-33085,
-33113,
-33242,
-33368,
-33369,
-33237,
+33210,
+33681,
+34220,
+33652,
+33419,
+33476,
+33074,
+33233,
+33184,
+32838,
+32623,
+32592,
+32774,
+32818,
+32810,
+32801,
+32649,
+32114,
+32301,
+32469,
+31829,
+31573,
+31522,
+31568,
+31490,
+31380,
+31505,
+31126,
+30616,
+30440,
+30552,
+30594,
+30220,
+30328,
+30806,
+30621,
+30713,
+31305,
+31118,
+30716,
+30877,
+31211,
+31258,
+31152,
+31041,
+31000,
+30937,
+31092,
+31102,
+30794,
+31070,
+31085,
+30729,
+30829,
+31282,
+31658,
+31629,
+31525,
+31668,
+32258,
+32357,
+32221,
+32534,
+32812,
+33419,
+33812,
+34086,
+34767,
+34961,
+35329,
+35716,
+36182,
+36775,
+36839,
+37173,
+37407,
+38140,
+38491,
+38113,
+38345,
+38622,
+38798,
+38299,
+38213,
+38549,
+38308,
+38090,
+37722,
+37635,
+37343,
+36710,
+36143,
+35524,
+35235,
+34744,
+34049,
+33586,
+33510,
+33281,
+32727,
+32753,
+32554,
+32313,
+32229,
+32127,
+32109,
+31621,
+31678,
+31673,
+31379,
+31673,
+31870,
+31639,
+31594,
+31982,
+31991,
+32112,
+32390,
+32205,
+32092,
+31938,
+31679,
+31290,
+31041,
+30815,
+30125,
+29767,
+29593,
+29177,
+28937,
+28836,
+29031,
+28822,
+28291,
+28558,
+28638,
+27983,
+27355,
+27162,
+26973,
+26635,
+26310,
+26345,
+26587,
+26552,
+26738,
+26863,
+27090,
+27528,
+27121,
+26643,
+26896,
+27031,
+26832,
+27045,
+27537,
+28161,
+28726,
+29657,
+31439,
+32156,
+32940,
+34272,
+35013,
+36257,
+36621,
+36981,
+38004,
+37737,
+37904,
+38740,
+38803,
+39115,
+39342,
+39754,
+40790,
+40558,
+40705,
+41288,
+40773,
+40573,
+40037,
+39397,
+38796,
+37807,
+37126,
+36235,
+35486,
+35239,
+34356,
+33518,
+33632,
+33311,
+32476,
+32218,
+32302,
+31866,
+31857,
+32584,
+32673,
+32986,
+33578,
+34283,
+35055,
+35434,
+36125,
+36231,
+36283,
+36753,
+36835,
+36972,
+36689,
+36241,
+36458,
+36524,
+36124,
+35838,
+35641,
+35700,
+35488,
+34640,
+34199,
+33795,
 33054,
-32857,
-32778,
-32793,
-32916,
-32957,
-32951,
-32740,
-32498,
-32258,
-32176,
-32160,
-32214,
-32161,
-32095,
-32024,
-32057,
-32170,
-32209,
-32115,
-31835,
-31610,
-31498,
-31640,
-31834,
-31906,
-31877,
-31716,
-31751,
-31887,
-32093,
-32119,
-31791,
-31323,
-30872,
-30778,
-30972,
-31363,
-31683,
-31790,
-31709,
-31410,
-31070,
-30665,
-30343,
-30210,
-30314,
-30638,
-31017,
-31222,
-31233,
-30999,
-30759,
-30563,
-30434,
-30395,
-30345,
-30391,
-30559,
-30838,
-31121,
-31275,
-31207,
-31021,
-30809,
-30697,
-30673,
-30716,
-30778,
-30957,
-31221,
-31584,
-31825,
+32303,
+31593,
+31290,
+30603,
+29914,
+29878,
+29446,
+29215,
+29079,
+28346,
+28077,
+27991,
+27590,
+27207,
+26944,
+26862,
+26658,
+26547,
+26703,
+27017,
+27313,
+27308,
+27558,
+27509,
+27160,
+27292,
+26759,
+26073,
+25813,
+24975,
+24280,
+24299,
+24046,
+23101,
+22535,
+21993,
+22929,
+24851,
+25059,
+26916,
+28659,
+29980,
+33025,
+34971,
+36337,
+36922,
+37461,
+38175,
+39403,
+40856,
+40394,
+40949,
+42230,
+42914,
+44302,
+45407,
+45633,
+45588,
+45861,
+45257,
+44384,
+43482,
+41411,
+39484,
+37802,
+36499,
+35089,
+33634,
+32500,
+31238,
+30686,
+29891,
+29363,
+28931,
+27545,
+27149,
+27108,
+26541,
+25941,
+26547,
+27282,
+27056,
+28913,
+30692,
+31502,
+33290,
+35308,
+37348,
+39061,
+40131,
+40850,
+42169,
+42730,
+42670,
+42703,
+42401,
+42019,
+41152,
+40761,
+40456,
+39502,
+38199,
+37076,
+36739,
+35569,
+33878,
+32582,
+31169,
+29991,
+28592,
+27347,
+26513,
+25787,
+25527,
+25179,
+25162,
+25816,
+25793,
+25371,
+25866,
+26385,
+26199,
+26137,
+25863,
+25728,
+26056,
+26132,
+26524,
+27318,
+27904,
+28631,
+28996,
+28920,
+29896,
+29831,
+28304,
+27474,
+26867,
+26228,
+24663,
+23459,
+22233,
+21074,
+20053,
+20451,
+24270,
+24433,
+25256,
+28467,
+30190,
+33847,
+35527,
+36629,
+37552,
+37520,
+38806,
+40326,
+42209,
+42163,
+42502,
+44593,
+46192,
+47983,
+48895,
+48834,
+48073,
+47691,
+46718,
+44782,
+43507,
+40591,
+38238,
+36753,
+35842,
+35570,
+34084,
+33137,
+31922,
+31433,
+31009,
+29475,
+28430,
+26368,
+24896,
+24306,
+23580,
+23838,
+24107,
+24988,
+26157,
+28931,
+32199,
+33712,
+36071,
+37656,
+38828,
+40341,
+40804,
+41169,
+41718,
+42509,
+42283,
+42423,
+43643,
+43638,
+43271,
+42961,
+41599,
+39978,
+39020,
+37260,
+35343,
+33412,
+30572,
+29236,
+28742,
+27688,
+26606,
+25947,
+25756,
+25566,
+25891,
+25891,
+25603,
+25704,
+25220,
+25085,
+25754,
+25841,
+25567,
+25697,
+26035,
+26676,
+27561,
+27946,
+27827,
+28243,
+28819,
+28735,
+28669,
+28587,
+28338,
+27870,
+27207,
+26883,
+26701,
+26233,
+25263,
+24028,
+22737,
+21995,
+19872,
+18902,
+22977,
+23494,
+23574,
+26934,
+28489,
+32588,
+35395,
+36136,
+37906,
+38254,
+38263,
+40497,
+43465,
+43170,
+43558,
+45237,
+46621,
+48678,
+49218,
+48669,
+47350,
+46585,
+45062,
+42316,
+41711,
+40030,
+37493,
+35921,
+35486,
+35904,
+35213,
+34073,
+32302,
+31339,
+30342,
+28544,
+26950,
+24812,
+23434,
+22524,
+22140,
+22936,
+24865,
+26740,
+27364,
+29955,
+34037,
+36289,
+37132,
+38025,
+38191,
+38443,
+39490,
+38903,
+38958,
+39534,
+39554,
+40340,
+41548,
+43831,
+44102,
+43226,
+43186,
+41406,
+40184,
+38790,
+35476,
+32528,
+30448,
+28769,
+28257,
+28769,
+28180,
+28013,
+28410,
+28322,
+28875,
+28999,
+28063,
+27125,
+26815,
+26089,
+26300,
+27485,
+27392,
+27598,
+28745,
+29790,
+30442,
+30714,
+30544,
+29531,
+29061,
+28953,
+28040,
+27263,
+27049,
+26887,
+26160,
+26341,
+26536,
+25476,
+25574,
+24772,
+24329,
+23477,
+21178,
+19604,
+17878,
+22290,
+24265,
+23284,
+27403,
+28922,
+32379,
+36318,
+37888,
+39336,
+39311,
+38381,
+39390,
+43634,
+43510,
+43494,
+44998,
+45581,
+48569,
+49103,
+48604,
+47641,
+46178,
+44256,
+40770,
+39918,
+38709,
+36073,
+33922,
+33285,
+34149,
+34200,
+33898,
+31945,
+31025,
+30486,
+28308,
+26854,
+24937,
+23880,
+22698,
+21854,
+23683,
+25792,
+28136,
+29250,
+30993,
+34687,
+36926,
+37822,
+37659,
+38011,
+38157,
+38326,
+38347,
+38097,
+39334,
+39035,
+38983,
+39717,
+40200,
+40912,
+39896,
+38929,
+38114,
+36751,
+35229,
+34158,
+32446,
+30758,
+30599,
+29106,
+28868,
+29976,
+29292,
+29176,
+29134,
+28757,
+29109,
+29516,
+29228,
+29000,
+29838,
+30309,
+30881,
+31826,
+32580,
+32526,
+32088,
+31985,
+31152,
+30532,
+30155,
+28887,
+27727,
+26949,
+26352,
+26202,
+25643,
+25477,
+24909,
+23247,
+23042,
+21739,
+20741,
+20957,
+17630,
+16595,
+15979,
+18092,
+24320,
+25470,
+28772,
+32220,
+34417,
+37948,
+39910,
+40704,
+39736,
+38411,
+37726,
+41741,
+45391,
+46174,
+48596,
+49736,
+51844,
+52554,
+50961,
+48324,
+44243,
+40232,
+35539,
+33190,
+33199,
+32510,
+31673,
 31800,
-31411,
-30867,
-30370,
-30291,
-30577,
-31162,
-31662,
-31887,
-31752,
-31395,
-31070,
-30937,
-31020,
-31237,
-31406,
+33473,
+34029,
+33900,
+31856,
+28734,
+26550,
+23319,
+21840,
+21696,
+22184,
+24056,
+25589,
+28307,
+32057,
+35011,
+36606,
+36662,
+36575,
+36875,
+36857,
+37244,
+38303,
+39015,
+39799,
+41321,
+42097,
+43013,
+43216,
+40781,
+38005,
+35471,
+33922,
+33131,
+33352,
+33135,
+32529,
+33419,
+33749,
+33822,
+33419,
+32302,
+29837,
+27802,
+27455,
+27234,
+29116,
+29985,
+29771,
+31827,
+33675,
+33905,
+34059,
+34087,
+32489,
 31482,
-31455,
-31465,
-31548,
-31709,
-31873,
-31912,
-31883,
-31762,
-31764,
-31878,
-32124,
-32400,
-32599,
-32667,
-32593,
-32480,
-32380,
-32419,
-32554,
-32774,
-32877,
-32847,
-32635,
-32449,
-32431,
-32674,
-33062,
-33338,
-33289,
-32910,
-32406,
-32142,
-32213,
-32659,
-33067,
-33259,
-33043,
-32611,
-32157,
-32017,
-32151,
-32544,
-32928,
-33187,
-33256,
-33154,
-32989,
-32769,
-32563,
-32375,
-32250,
-32306,
-32511,
-32866,
-33144,
-33230,
-33002,
-32574,
-32134,
-31872,
-31934,
-32193,
-32595,
-32897,
-33078,
-33077,
-32999,
-32791,
-32550,
-32223,
-31907,
-31687,
-31697,
+31308,
+30435,
+30647,
+31329,
+30738,
+30037,
+30386,
+30357,
+28988,
+27571,
+25942,
+24023,
+22821,
+21760,
+20390,
+20034,
+20128,
+19398,
+19590,
+20375,
+19762,
+19195,
+18250,
+17781,
+25113,
+29159,
+29526,
+35993,
+37128,
+38416,
+42308,
+42692,
+42739,
+42161,
+40059,
+41478,
+47218,
+49279,
+49977,
+50607,
+50493,
+49717,
+46329,
+43712,
+40392,
+36147,
+32384,
+29745,
+30321,
+31786,
+32252,
+31971,
 31946,
-32405,
-32871,
-33163,
-33119,
-32781,
-32282,
+31900,
+30956,
+29530,
+26780,
+25273,
+24219,
+22789,
+24205,
+26730,
+29393,
+31671,
+33023,
+34806,
+36141,
+37285,
+37127,
+35893,
+36495,
+37443,
+37577,
+38759,
+40380,
+41011,
+41274,
+40889,
+40090,
+39163,
+36918,
+34772,
+32762,
+31309,
+32014,
+32313,
+32511,
+33199,
+33160,
+32855,
+32300,
+32013,
+30627,
+29454,
+29639,
+29267,
+30115,
+32392,
+33764,
+33971,
+34650,
+35099,
+34548,
+34135,
+33243,
+32142,
+31605,
 31825,
-31655,
-31723,
-32048,
-32402,
-32671,
-32777,
-32693,
-32467,
-32145,
-31753,
-31464,
-31332,
-31537,
-31988,
-32519,
-32819,
-32749,
-32341,
-31924,
-31727,
-31870,
-32172,
-32353,
-32273,
-32079,
-31963,
-32159,
-32570,
-32890,
-32908,
-32526,
-31977,
-31596,
-31589,
-32005,
-32614,
-33205,
-33538,
-33581,
-33332,
-32942,
-32514,
-32207,
-32099,
-32212,
-32520,
-32873,
-33157,
-33270,
-33185,
-33000,
-32819,
-32734,
-32751,
-32803,
-32810,
-32759,
-32711,
-32797,
-33052,
-33456,
-33780,
-33890,
-33646,
-33177,
-32697,
-32459,
-32562,
-32998,
-33505,
-33936,
-34109,
-34078,
+31846,
+31840,
+32334,
+31259,
+29902,
+29140,
+28041,
+26825,
+24871,
+22658,
+21258,
+20747,
+20242,
+20419,
+20082,
+18362,
+18112,
+17960,
+18492,
+17704,
+16706,
+15649,
+17996,
+28065,
+31083,
+34662,
+40052,
+38877,
+40745,
+42127,
+42658,
+43492,
+42021,
+40308,
+44812,
+51233,
+52549,
+55010,
+54109,
+51260,
+47942,
+42831,
+40417,
+37681,
+34467,
+31485,
+29409,
+31594,
+34039,
 33866,
-33607,
-33353,
-33109,
-33034,
-33112,
-33435,
-33933,
-34354,
-34576,
-34340,
-33831,
-33184,
-32838,
-32891,
-33372,
-33973,
-34366,
-34392,
-34071,
-33690,
-33498,
-33638,
-33939,
-34208,
-34269,
-34094,
-33956,
-33849,
-33973,
-34036,
-34041,
-33834,
-33578,
-33458,
-33502,
-33793,
-34025,
-34165,
-34049,
-33808,
-33513,
-33379,
-33356,
-33484,
-33595,
-33622,
-33519,
-33356,
-33167,
-33100,
-33085,
-33191,
-33299,
-33420,
-33513,
-33569,
-33576,
-33544,
-33435,
-33348,
-33288,
-33318,
-33442,
-33606,
-33689,
-33689,
-33495,
-33296,
-33147,
-33163,
-33400,
-33706,
-34017,
-34150,
-34059,
-33827,
-33494,
-33272,
-33200,
-33285,
-33489,
-33638,
-33691,
-33589,
-33386,
-33218,
-33128,
-33211,
-33356,
-33532,
-33648,
-33684,
-33676,
-33672,
-33694,
-33714,
-33674,
-33567,
-33384,
-33268,
-33314,
-33550,
-33899,
-34191,
-34248,
-34064,
-33726,
-33476,
-33455,
-33737,
-34164,
-34566,
-34744,
-34640,
-34351,
-33986,
-33744,
-33657,
-33755,
-33935,
-34141,
-34230,
-34245,
-34097,
-33957,
-33813,
-33782,
-33868,
-34049,
-34298,
-34526,
-34676,
-34665,
-34517,
-34211,
-33940,
-33708,
-33705,
-33875,
-34219,
-34533,
-34738,
-34667,
-34451,
-34110,
-33911,
-33905,
-34107,
-34409,
-34589,
-34577,
-34310,
-33969,
-33691,
-33618,
-33730,
-33855,
-33894,
-33723,
-33412,
-33152,
-33006,
-33148,
-33372,
-33619,
-33665,
-33548,
-33290,
-33029,
-32846,
-32799,
-32855,
-32962,
-33083,
-33089,
-33032,
-32819,
-32598,
-32449,
-32444,
-32591,
-32767,
-32902,
-32875,
+32929,
+30969,
+27067,
+24484,
+23104,
+21835,
+23432,
+24436,
+24891,
+27387,
+29897,
 32771,
-32598,
-32434,
-32302,
-32137,
-32006,
-31952,
-31998,
-32177,
-32322,
-32346,
-32197,
-31949,
-31774,
-31731,
-31839,
-31930,
-31948,
-31823,
-31658,
-31560,
-31535,
-31638,
-31687,
-31759,
-31727,
-31709,
-31657,
-31667,
-31634,
-31664,
-31649,
-31636,
-31625,
-31604,
-31677,
-31776,
-31922,
-31968,
-31839,
-31542,
-31161,
-30955,
-30983,
-31304,
-31690,
-31907,
-31870,
-31516,
-31175,
-30914,
-30945,
-31135,
-31418,
-31614,
-31704,
-31702,
+33755,
+32683,
+32100,
+31588,
+32136,
+34150,
+37142,
+39899,
+41804,
+42188,
+41832,
+41907,
+41537,
+39735,
+36648,
+34189,
+33340,
+34649,
+37233,
+38840,
+39054,
+37936,
+35484,
+33026,
+31192,
+29447,
+28314,
+26979,
+27808,
+31080,
+34064,
+36584,
+37222,
+36322,
+34531,
+32456,
+31332,
+31080,
+31461,
+32218,
+33421,
+34811,
+36464,
+37023,
+35184,
+32394,
+29036,
+26104,
+25137,
+25241,
+25327,
+24874,
+23715,
+22449,
+21618,
+21012,
+19396,
+17226,
+15131,
+14504,
+15650,
+17083,
+17388,
+18027,
+16395,
+18462,
+29013,
+32164,
+36117,
+40075,
+37518,
+39949,
+41673,
+42989,
+45604,
+45636,
+44668,
+49636,
+55963,
+56850,
+57483,
+54535,
+49688,
+44649,
+40095,
+38886,
+38109,
+37041,
+34427,
+31592,
+31471,
+31131,
+28876,
+26374,
+23378,
+20602,
+20427,
+21094,
+22849,
+27080,
+28108,
+27280,
+28160,
+28105,
+28788,
+30040,
+29793,
+31115,
+33900,
+36250,
+38890,
+41631,
+43603,
+43427,
+41054,
+39118,
+37716,
+37198,
+37924,
+37262,
+36807,
+36866,
+36693,
+36679,
+36282,
+36330,
+34763,
 31634,
-31572,
-31499,
-31418,
-31402,
-31399,
-31541,
-31740,
-31997,
-32238,
-32327,
-32246,
-32015,
-31693,
-31513,
-31532,
-31824,
-32232,
-32586,
-32653,
-32422,
-31985,
-31513,
-31190,
-31090,
-31145,
-31362,
-31583,
-31798,
-31907,
-31840,
-31596,
-31245,
-30967,
-30894,
-31082,
-31418,
-31677,
-31738,
-31542,
-31275,
-31045,
-31037,
-31139,
-31340,
-31452,
-31457,
-31407,
-31341,
-31324,
-31402,
-31456,
-31540,
-31512,
-31458,
-31401,
-31411,
-31526,
-31679,
-31823,
-31819,
-31661,
-31397,
-31098,
-30977,
-31007,
-31251,
-31566,
-31839,
-31982,
-31946,
-31775,
-31555,
-31372,
-31328,
-31438,
-31693,
-31977,
-32170,
+29676,
+28535,
+29031,
+30119,
+30523,
+31838,
+33143,
+33683,
+34962,
+36237,
+36260,
+35601,
+34194,
+33072,
+33277,
+34225,
+34928,
+35435,
+35951,
+35359,
+34029,
+32759,
+30798,
+28670,
+26600,
+25269,
+24965,
+24081,
+23105,
+21597,
+20000,
+18691,
+17286,
+16103,
+14114,
+14284,
+14190,
+14410,
+15466,
+14152,
+14805,
+14851,
+24023,
+33595,
+36074,
+41770,
+40395,
+40599,
+42314,
+42528,
+46394,
+48509,
+49038,
+51283,
+58866,
+61563,
+60427,
+58183,
+51555,
+46594,
+41920,
+39955,
+40763,
+41499,
+39926,
+35719,
 32197,
-32013,
-31725,
-31487,
-31407,
-31525,
-31823,
-32100,
-32315,
-32301,
-32161,
-31927,
-31717,
-31654,
-31679,
-31841,
+29424,
+27114,
+23583,
+20707,
+19479,
+19142,
+20505,
+22349,
+25734,
+27859,
+26400,
+24754,
+23926,
+24975,
+27644,
+29722,
+31633,
+33983,
+36039,
+37251,
+38724,
+40682,
+41094,
+39673,
+37734,
+37289,
+38345,
+39012,
+38058,
+35888,
+34902,
+34499,
+35910,
+37116,
+35728,
+34237,
+30900,
+30469,
+31420,
+31285,
+32893,
+31350,
+31243,
+33133,
+34114,
+35958,
+34943,
+32783,
+33359,
+35335,
+36670,
+37739,
+38382,
+38277,
+37743,
+36764,
+36418,
+35720,
+33505,
+30940,
+29168,
+28661,
+29085,
+28428,
+25830,
+22852,
+19966,
+18455,
+17266,
+16572,
+16421,
+13789,
+13468,
+13469,
+13086,
+13760,
+11375,
+9983,
+10511,
+21034,
+30816,
+34195,
+38665,
+35974,
+36011,
+37224,
+38934,
+44918,
+48112,
+49052,
+51780,
+59168,
+61930,
+60696,
+57629,
+52015,
+47897,
+44242,
+44104,
+46140,
+46988,
+42921,
+36239,
+31905,
+29815,
+28719,
+26714,
+25354,
+24062,
+22464,
+21966,
+21768,
+23888,
+24273,
+21568,
+21047,
+23062,
+26821,
+30461,
 31978,
-32064,
-32011,
-31879,
-31703,
-31589,
-31529,
-31543,
-31562,
-31507,
-31433,
-31272,
-31167,
-31140,
-31208,
-31395,
-31531,
-31641,
-31564,
-31397,
-31150,
-30983,
-30934,
-31069,
-31287,
-31448,
-31486,
-31306,
-31060,
-30860,
-30822,
-30976,
-31231,
-31461,
-31528,
-31481,
-31247,
-31071,
-30889,
-30848,
-30891,
-30980,
-31074,
-31102,
-31080,
-31031,
-30972,
-30943,
-30899,
-30871,
-30831,
-30899,
-31044,
-31352,
+31814,
+32070,
+33194,
+34437,
+36435,
+39300,
+40754,
+39182,
+37904,
+38599,
+39421,
+38489,
+36032,
+34192,
+34165,
+36639,
+37582,
+36804,
+35261,
 31640,
-31813,
-31740,
-31478,
-31150,
-31020,
-31124,
-31483,
-31871,
-32147,
-32212,
-32099,
-31979,
-31956,
+30166,
+29100,
+29436,
+31594,
+31036,
+30262,
+31383,
+33891,
+34749,
+33551,
+31851,
+30806,
+32705,
+35669,
+38048,
+39810,
+39550,
+37784,
+36351,
+36631,
+38116,
+37596,
+35350,
+33605,
+33437,
+33674,
+33158,
+31373,
+27566,
+23309,
+20157,
+20221,
+20791,
+21165,
+19916,
+15774,
+14243,
+13478,
+13228,
+11780,
+9662,
+8046,
+10909,
+24270,
+32062,
+34575,
+34890,
+30150,
+30202,
+32456,
+37639,
+45685,
+48835,
+48763,
+54303,
+60675,
+60118,
+57805,
+54558,
+51189,
+49361,
+48099,
+49484,
+52207,
+50018,
+41735,
+33024,
+28656,
+28148,
+27668,
+27789,
+28523,
+26878,
+23696,
+20744,
+18868,
+19557,
+19676,
+18398,
+20146,
+24448,
+28961,
+31366,
+30875,
+29672,
+29527,
+30907,
+32726,
+36643,
+41725,
+43458,
+41479,
+39072,
+37845,
+37113,
+36595,
+35549,
+35919,
+37149,
+37652,
+37002,
+34825,
+34166,
+32437,
+29209,
+27212,
+27581,
+29794,
+30478,
+30591,
+30079,
+29954,
+29416,
+28697,
+30979,
+32879,
+34025,
+35450,
+36159,
+36710,
+36628,
+36282,
+36397,
+37214,
+38282,
+38177,
+37873,
+38099,
+37393,
+35532,
+33481,
+31684,
+28845,
+25930,
+24337,
+23402,
+22805,
+21214,
+18669,
+16559,
+14291,
+12652,
+10272,
+7305,
+8018,
+7012,
+13030,
+26731,
+29679,
+30366,
+29197,
+25882,
+29484,
+33382,
+38744,
+46258,
+48456,
+49188,
+56722,
+61530,
+58512,
+56638,
+55422,
+54600,
+55395,
+54652,
+55237,
+55957,
+50353,
+41971,
+35482,
+32575,
+31910,
+30874,
+31088,
+31001,
+27934,
+23803,
+19791,
+17056,
+17478,
+18719,
+19125,
+21013,
+24537,
+26804,
+26888,
+26160,
+25931,
+27328,
+30140,
+32909,
+37780,
+43518,
+44251,
+41385,
+38055,
+36342,
+36780,
+37471,
+38193,
+39135,
+39565,
+38414,
+35917,
+34079,
+32412,
+31167,
+30322,
+28137,
+30046,
+31915,
+29169,
+27610,
+24974,
+23351,
+25397,
+27479,
+30673,
+34016,
+34604,
+33898,
+33101,
+32171,
+32612,
+33919,
+34987,
+37541,
+40294,
+40787,
+40525,
+39675,
+37852,
+36264,
+34660,
+34512,
+34622,
+32665,
+30687,
+28375,
+25778,
+22894,
+19640,
+17369,
+15247,
+13697,
+10213,
+7444,
+6544,
+6081,
+15872,
+24346,
+24243,
+25331,
+22922,
+22620,
+26785,
+30041,
+36400,
+42326,
+43284,
+47386,
+55997,
+57394,
+54305,
+54183,
+54440,
+55644,
+55621,
+54698,
+57476,
+57443,
+51314,
+44439,
+38800,
+35981,
+35106,
+34704,
+34971,
+33303,
+28886,
+23995,
+19557,
+18311,
+20416,
+21201,
+20210,
+20716,
+23383,
+25632,
+26244,
+26076,
+26081,
+27152,
+29324,
+33315,
+39907,
+44913,
+44150,
+40113,
+36448,
+36492,
+39803,
+41944,
+42294,
+41164,
+39212,
+37717,
+35412,
+33103,
+30592,
+27751,
+27113,
+28056,
+33068,
+35985,
+29793,
+22747,
+17598,
+16439,
+21609,
+27156,
+30345,
+32032,
+31893,
+30964,
+31319,
+30938,
+30029,
+30635,
+32267,
+36480,
+41549,
+43952,
+43325,
+39598,
+35423,
+34325,
+36165,
+38672,
+39482,
+37794,
+34431,
+30529,
+27023,
+24954,
+22540,
+19932,
+18615,
+16331,
+13093,
+10684,
+7153,
+6833,
+14825,
+19417,
+21262,
+24097,
+22551,
+24146,
+26542,
+27641,
+33231,
+37772,
+40457,
+47983,
+55405,
+55568,
+54041,
+53927,
+54395,
+55138,
+53062,
+52232,
+55439,
+55121,
+50546,
+45763,
+41013,
+38247,
+36525,
+35360,
+35676,
+33979,
+29538,
+24478,
+20146,
+19275,
+21217,
+21821,
+20735,
+21045,
+23020,
+24460,
+25385,
+25833,
+26412,
+27835,
+29755,
+33874,
+40217,
+44602,
+44376,
+41210,
+38438,
+38680,
+41253,
+42801,
+42910,
+42140,
+40160,
+38524,
+36517,
+34225,
 32062,
-32317,
-32575,
-32786,
-32944,
-33026,
-33079,
-33165,
-33209,
-33290,
-33322,
-33331,
-33286,
+29450,
+27533,
+26771,
+29707,
+31997,
+29541,
+25853,
+20770,
+18602,
+20843,
+24559,
+28988,
+31053,
+30743,
+29747,
+29446,
+29899,
+31103,
+32201,
+32743,
+34714,
+37251,
+39919,
+41279,
+39268,
+36409,
+35323,
+36455,
+38820,
+40124,
+38986,
+35569,
+31458,
+28136,
+26040,
+24996,
+23758,
+21710,
+19243,
+16920,
+13848,
+10436,
+7230,
+7546,
+16257,
+23640,
+25133,
+24450,
+21546,
+22274,
+24420,
+27025,
+33880,
+39646,
+42380,
+46891,
+53396,
+55821,
+53766,
+51648,
+50736,
+50410,
+50267,
+51897,
+55302,
+54610,
+48646,
+42787,
+39007,
+37420,
+37634,
+38323,
+36948,
+33342,
+29652,
+26120,
+23559,
+22352,
+21972,
+22097,
+21871,
+22115,
+24330,
+25789,
+24865,
+24059,
+24542,
+27076,
+31075,
+35433,
+40111,
+42811,
+41629,
+39456,
+38611,
+38812,
+40586,
+42221,
+42562,
+42393,
+41352,
+39899,
+37934,
+34736,
+31732,
+29667,
+27858,
+27686,
+27765,
+28047,
+29540,
+27223,
+23906,
+23570,
+23140,
+23955,
+26059,
+27174,
+27870,
+28240,
+27946,
+29694,
+31916,
+31216,
+31373,
+33237,
+35256,
+37174,
+37795,
+37887,
+38243,
+38181,
+38310,
+39963,
+40955,
+39254,
+36091,
+32490,
+30323,
+29617,
+28594,
+27437,
+25245,
+22489,
+20083,
+16611,
+12379,
+8767,
+6567,
+9504,
+19173,
+26411,
+26870,
+24312,
+20778,
+20343,
+23264,
+28441,
+35959,
+41355,
+44019,
+49476,
+55164,
+54975,
+51768,
+50293,
+51107,
+51716,
+52191,
+54822,
+57513,
+55134,
+47945,
+41804,
+38457,
+37159,
+37289,
+37740,
+36985,
+33603,
+29390,
+25103,
+21340,
+19935,
+20080,
+21471,
+23008,
+23572,
+24336,
+24089,
+22536,
+22208,
+23731,
+26466,
+30549,
+35918,
+40702,
+42555,
+41380,
+39355,
+38342,
+39084,
+41548,
+44430,
+45449,
+44297,
+42267,
+39554,
+36905,
+34062,
+31333,
+29522,
+28181,
+27557,
+27094,
+26168,
+24262,
+22629,
+22935,
+23471,
+23839,
+24596,
+24918,
+25217,
+25690,
+26540,
+28129,
+29270,
+30260,
+32651,
+35608,
+37078,
+37343,
+38040,
+39233,
+40441,
+41080,
+41378,
+42519,
+43214,
+41887,
+39228,
+36354,
+34047,
+32221,
+30793,
+28998,
+26840,
+24610,
+21422,
+18343,
+15945,
+13608,
+10927,
+7744,
+5895,
+7826,
+15098,
+23545,
+26088,
+23500,
+20658,
+20930,
+24741,
+30519,
+38065,
+44971,
+48192,
+49714,
+52728,
+55203,
+53891,
+51676,
+52295,
+54551,
+55830,
+55777,
+55847,
+54815,
+49832,
+43536,
+39294,
+36514,
+35538,
+36066,
+35742,
+33175,
+28768,
+24304,
+20501,
+17575,
+17174,
+19425,
+21920,
+22802,
+22777,
+22672,
+22250,
+22144,
+23826,
+27257,
+30762,
+33933,
+37834,
+41284,
+42198,
+41572,
+40871,
+40369,
+40722,
+42463,
+44935,
+46340,
+44893,
+41929,
+38660,
+35272,
+32623,
+30856,
+29897,
+29144,
+27783,
+25987,
+24350,
+22507,
+22532,
+23892,
+23419,
+23764,
+24345,
+24002,
+25201,
+25741,
+26640,
+29055,
+30548,
+32550,
+35229,
+37083,
+38115,
+39033,
+40141,
+41069,
+41852,
+41897,
+41646,
+42418,
+42813,
+42182,
+40469,
+36702,
 33244,
-33246,
-33331,
-33559,
-33838,
-34163,
-34332,
-34343,
-34139,
-33931,
-33790,
-33932,
-34253,
-34642,
-34895,
-34942,
+30542,
+28388,
+27672,
+26624,
+25217,
+22296,
+18003,
+14929,
+12667,
+10318,
+7543,
+5088,
+6065,
+12798,
+21650,
+26600,
+27020,
+25285,
+23813,
+24901,
+29504,
+36869,
+44896,
+50158,
+52217,
+54157,
+55081,
+53779,
+53104,
+54565,
+56156,
+55561,
+54090,
+53862,
+53638,
+50701,
+45338,
+40237,
+35720,
+33051,
+33022,
+33300,
+32510,
+29703,
+25137,
+20310,
+16322,
+15050,
+16785,
+19481,
+21610,
+22828,
+23045,
+22514,
+21872,
+22330,
+24393,
+27116,
+30809,
+35395,
+39104,
+40757,
+40617,
+40119,
+39897,
+40186,
+41854,
+44151,
+45733,
+45586,
+43475,
+40689,
+37539,
+34699,
+32902,
+31752,
+31497,
+31338,
+30133,
+27615,
+24248,
+21947,
+21921,
+23318,
+25221,
+26605,
+26472,
+26224,
+26161,
+26114,
+27356,
+29327,
+31995,
+35048,
+37311,
+38631,
+39041,
+38506,
+38096,
+39110,
+40356,
+40944,
+41080,
+40989,
+40722,
+39477,
+37344,
+35300,
+33435,
+31198,
+28774,
+26949,
+25897,
+24801,
+23223,
+20665,
+17691,
+15738,
+13936,
+11993,
+10313,
+9225,
+11183,
+17673,
+26081,
+31720,
+32342,
+30478,
+29342,
+30140,
+33380,
+39164,
+46089,
+51028,
+53309,
+54560,
+54354,
+51806,
+49245,
+49382,
+50220,
+49525,
+48479,
+48244,
+48042,
+45890,
+41807,
+37608,
+33756,
+30519,
+29004,
+29074,
+29392,
+28871,
+27080,
+23496,
+19201,
+16939,
+17725,
+20200,
+22332,
+23707,
+24548,
+24216,
+23313,
+23613,
+25200,
+27761,
+31310,
+35236,
+38804,
+40439,
+40273,
+39638,
+38917,
+38854,
+39877,
+41880,
+44026,
+44927,
+44085,
+41644,
+38016,
+34314,
+31502,
+30189,
+30431,
+31231,
+31660,
+30707,
+28271,
+25554,
+22943,
+21475,
+22489,
+25935,
+30367,
+33394,
+33821,
+32732,
+31199,
+29905,
+29708,
+31395,
+35157,
+38941,
+41469,
+42126,
+40918,
+38951,
+37047,
+36402,
+36677,
+37070,
+37731,
+38415,
+37983,
+35999,
+33366,
+30429,
+27482,
+24975,
+23265,
+22823,
+23416,
+23415,
+22515,
+21184,
+19348,
+17840,
+16767,
+15742,
+14675,
+13849,
+15476,
+22430,
+32167,
+38511,
+39811,
+38011,
+34913,
+32830,
+33117,
+37082,
+43940,
+49166,
+52010,
+53404,
+51588,
+46560,
+42567,
+42161,
+42780,
+42435,
+42233,
+43643,
+44619,
+42297,
+38223,
+34391,
+30756,
+28305,
+27969,
+28900,
+29794,
+29850,
+28774,
+25687,
+21823,
+19942,
+20339,
+21482,
+22928,
+25767,
+28517,
+28953,
+27777,
+26574,
+26786,
+28634,
+31680,
+35978,
+39944,
+41713,
+41681,
+40376,
+38372,
+37223,
+37402,
+38303,
+39822,
+41329,
+41595,
+40186,
+37227,
+34160,
+32155,
+30584,
+29778,
+30121,
+30827,
+31076,
+30531,
+29205,
+27169,
+25607,
+25378,
+26930,
+30502,
+33584,
+34912,
+35339,
+34602,
+33550,
+32879,
+32697,
+33976,
+36377,
+38636,
+40613,
+41534,
+39944,
+37087,
+35273,
 34803,
-34689,
-34643,
-34750,
-34882,
-35043,
-35135,
-35290,
-35458,
-35673,
-35838,
-35919,
-35913,
-35872,
-35881,
-35914,
-35995,
-36046,
-36092,
-36133,
-36168,
-36170,
-36103,
-35975,
-35817,
-35735,
-35765,
-35931,
-36138,
+35298,
+36209,
+37067,
+37398,
+35958,
+33429,
+31558,
+30249,
+29539,
+28922,
+27742,
+26713,
+25573,
+24325,
+23428,
+23012,
+23015,
+23207,
+23017,
+21885,
+20305,
+18042,
+15829,
+15452,
+19895,
+29746,
+38065,
+41326,
+41291,
+38452,
+34384,
+30584,
+29874,
+34438,
+41114,
+46904,
+51907,
+54255,
+50340,
+43555,
+39383,
+37636,
+37163,
+37727,
+39847,
+42502,
+42164,
+39048,
+35355,
+31120,
+27281,
+24901,
+24256,
+24738,
+25763,
+27318,
+27181,
+25040,
+23069,
+21867,
+21089,
+21155,
+23392,
+26977,
+29584,
+30816,
+31592,
+31794,
+31652,
+32144,
+33784,
+36384,
+38830,
+40714,
+41616,
+41076,
+39984,
+39129,
+38547,
+38520,
+39114,
+39547,
+38857,
+37139,
+35168,
+33503,
+32369,
+31429,
+30725,
+30015,
+28756,
+27585,
+27275,
+27354,
+27337,
+27513,
+27340,
+27930,
+30151,
+32135,
+33546,
+34255,
+34547,
+35004,
+35105,
+35650,
+37061,
+38511,
+39842,
+41449,
+42362,
+41708,
+40468,
+39582,
+39447,
+39486,
+39515,
+40052,
+40168,
+39048,
+37099,
+34425,
+31480,
+29207,
+27770,
+26845,
+25512,
+23750,
+22371,
+21162,
+20047,
+19601,
+19920,
+20317,
+20273,
+19600,
+17979,
+15879,
+14311,
+14793,
+20803,
+30873,
+39107,
+43830,
+44307,
+41126,
+35947,
+30976,
+31005,
+36369,
+43048,
+49304,
+54721,
+55613,
+49574,
+41825,
+37259,
+35120,
+34280,
+35151,
+38368,
+41185,
+40280,
+37466,
+34183,
+29981,
+26037,
+23598,
+22672,
+22791,
+24827,
+27458,
+27946,
+27422,
+27127,
+26300,
+24025,
+21856,
+22575,
+24827,
+26998,
+30274,
+34082,
+36533,
+36919,
+36117,
+35268,
+34948,
+35896,
+38056,
+40399,
+41930,
+43100,
+43702,
+42021,
+39495,
+38053,
+36853,
+35757,
+35365,
+35784,
+35932,
+34492,
+32066,
+29755,
+27898,
+26680,
+26490,
+26535,
+26048,
+26011,
+25974,
+25889,
+26388,
+27862,
+31036,
+33919,
+35800,
+37409,
+37886,
+37544,
+37171,
+37904,
+39897,
+41981,
+43928,
+45346,
+46067,
+45341,
+43333,
+41560,
+39674,
+37723,
+36493,
 36288,
-36342,
+36702,
+36367,
+34576,
+31106,
+27319,
+24535,
+22238,
+20925,
+20507,
+20212,
+19791,
+19045,
+18950,
+19509,
+19741,
+19374,
+18784,
+18889,
+19833,
+20510,
+20908,
+20989,
+21291,
+25905,
+33175,
+38844,
+43329,
+44934,
+43244,
+39034,
+34140,
+33495,
+36730,
+40422,
+44994,
+50708,
+52604,
+48032,
+42151,
+37965,
+34374,
+31399,
+30397,
+33154,
+36627,
+37232,
+36559,
+34385,
+30328,
+26715,
+24445,
+23320,
+23524,
+25680,
+28205,
+29453,
+30494,
+31595,
+31653,
+29694,
+27438,
+27265,
+27763,
+28515,
+31131,
+34828,
+37934,
+39364,
+39353,
+38838,
+37675,
+36226,
+35248,
+35107,
+36326,
+38829,
+40836,
+40668,
+39420,
+37682,
+34883,
+32042,
+30169,
+30061,
+31073,
+31607,
+31984,
+32227,
+31729,
+30776,
+29592,
+28464,
+28017,
+28361,
+29454,
+31186,
+33352,
+35913,
+38291,
+39419,
+39785,
+39924,
+38930,
+37625,
+37067,
+37542,
+39236,
+40809,
+41703,
+42242,
+41669,
+39978,
+37961,
+35773,
+33918,
+33032,
+32590,
+32114,
+31783,
+31006,
+29543,
+27709,
+25674,
+24296,
+23272,
+22158,
+21787,
+22005,
+22682,
+23542,
+23681,
+23047,
+21751,
+20200,
+19638,
+20805,
+22777,
+25051,
+26517,
+25966,
+24767,
+23021,
+24022,
+29630,
+35066,
+39854,
+43439,
+44030,
+41578,
+35984,
+31437,
+30730,
+32325,
+35940,
+42197,
+47848,
+47890,
+44271,
+40364,
+35469,
+30774,
+28431,
+30434,
+34907,
+37908,
+40313,
+41121,
+39021,
+35744,
+32803,
+31245,
+30380,
+30696,
+32346,
+33135,
+33337,
+34134,
+34408,
+33045,
+30817,
+29499,
+28173,
+25943,
+24967,
+26499,
+29752,
+32719,
+34867,
 36239,
-36099,
-35910,
-35798,
-35699,
-35687,
-35697,
-35768,
-35884,
-36017,
-36119,
-36110,
-36008,
-35800,
-35673,
-35662,
-35838,
-36135,
-36414,
-36554,
-36513,
-36281,
-36000,
-35715,
+35779,
+33700,
+31300,
+29722,
+30043,
+32733,
+36652,
+39903,
+41754,
+42145,
+40540,
+37635,
+34935,
+33806,
+34171,
+34969,
+36249,
+37115,
+36881,
+35876,
+34338,
+32727,
+31318,
+30204,
+29560,
+29493,
+30011,
+31296,
+32927,
+34544,
+36254,
+37381,
+37114,
 35594,
-35614,
-35838,
-36095,
-36313,
-36281,
-36025,
-35592,
-35246,
-35112,
-35298,
-35640,
-35941,
-36019,
-35842,
-35514,
-35205,
-35036,
-34986,
-35066,
-35088,
-35070,
-34984,
-34845,
-34750,
-34700,
-34735,
-34814,
-34927,
-34985,
-35009,
-34933,
-34819,
-34730,
-34690,
-34741,
-34828,
-34878,
-34841,
-34701,
-34450,
-34220,
-34044,
-34020,
-34122,
-34277,
-34378,
-34384,
-34199,
-33967,
-33683,
-33500,
-33436,
-33532,
-33635,
-33760,
-33675,
-33497,
-33155,
-32870,
-32664,
-32661,
-32795,
-33012,
-33173,
-33274,
-33258,
-33212,
-33159,
-33151,
-33163,
-33205,
-33230,
-33215,
-33200,
-33115,
-33084,
-33046,
-33047,
-33056,
-33019,
-32955,
-32850,
-32799,
-32843,
-32959,
-33151,
-33236,
-33274,
-33149,
-32997,
-32865,
-32789,
-32819,
-32871,
-32926,
-32992,
-32970,
-32983,
-32903,
+33493,
+31944,
+31781,
+33053,
+35877,
+39254,
+41223,
+41052,
+39148,
+35996,
 32867,
-32811,
-32797,
-32836,
-32890,
-32992,
-33018,
-33048,
-32966,
-32884,
-32738,
-32606,
-32458,
-32327,
-32180,
-32083,
-31968,
-31953,
-31895,
-31870,
-31800,
-31729,
-31696,
-31698,
-31755,
-31786,
-31788,
-31678,
-31530,
-31367,
-31248,
-31216,
-31193,
-31121,
-30982,
-30737,
-30504,
-30329,
-30307,
-30357,
-30428,
-30405,
-30223,
-29981,
+31092,
+30784,
+31370,
+31991,
+32373,
+32162,
+31127,
+29709,
+28122,
+26452,
+24801,
+23631,
+23278,
+23197,
+23110,
+23044,
+22846,
+22171,
+20970,
+20203,
+20159,
+20723,
+21924,
+23345,
+24295,
+24309,
+23828,
+22233,
+22914,
+28474,
+34244,
+39590,
+43774,
+44749,
+42820,
+37294,
+32332,
+31804,
+33659,
+36910,
+43244,
+49953,
+51343,
+48550,
+44918,
+40042,
+35123,
+32023,
+32922,
+37188,
+40055,
+41767,
+42213,
+39523,
+35441,
+31916,
+29801,
+28849,
+29183,
+30188,
+30309,
+29792,
+29735,
+29943,
+29057,
+27487,
+27199,
+26802,
+25418,
+25006,
+26314,
+29161,
+32069,
+34406,
+36292,
+37053,
+36527,
+35233,
+34055,
+33539,
+34630,
+37061,
+39314,
+41261,
+42719,
+42625,
+40709,
+37450,
+34579,
+32999,
+32238,
+32858,
+34380,
+35790,
+36326,
+35559,
+33774,
+31400,
+29172,
+28159,
+28651,
+30490,
+33269,
+35934,
+37523,
+37705,
+36734,
+34763,
+32962,
+32071,
+32227,
+33434,
+34968,
+36835,
+38341,
+38533,
+37542,
+35663,
+33380,
+31262,
+29781,
+29224,
+29276,
+29642,
+29996,
+30195,
+30078,
+28977,
+27077,
+24645,
+22537,
+21495,
+21202,
+21569,
+22499,
+23498,
+23968,
+23589,
+22857,
+22324,
+21971,
+22507,
+23705,
+25856,
+28715,
+30427,
+31304,
+30966,
+31823,
+35620,
+38951,
+42223,
+45148,
+46786,
+45929,
+41621,
+37650,
+35665,
+35414,
+36095,
+38898,
+43620,
+45178,
+43482,
+40424,
+35941,
+31564,
+28056,
+27467,
+30281,
+33412,
+36065,
+37125,
+36403,
+34382,
+31559,
+29413,
+27915,
+28327,
+29909,
+30809,
+31473,
+31930,
+32134,
+31342,
 29712,
-29543,
-29478,
-29492,
-29513,
-29480,
-29365,
-29180,
-28960,
-28743,
-28579,
-28503,
-28535,
+29000,
+28749,
+28267,
+28121,
+28964,
+31053,
+33320,
+35150,
+35959,
+35980,
+35446,
+33896,
+32766,
+32549,
+33508,
+35541,
+37040,
+38218,
+39091,
+38689,
+37528,
+35687,
+34269,
+33923,
+33805,
+34300,
+34913,
+35421,
+35732,
+35514,
+35024,
+34273,
+33360,
+32566,
+32582,
+33155,
+34291,
+36128,
+37344,
+37544,
+36403,
+34254,
+32212,
+30680,
+30415,
+31446,
+33325,
+35167,
+35766,
+34835,
+32729,
+30451,
+28782,
+27709,
+27572,
+28175,
+29108,
+29536,
+28898,
+28244,
+27916,
+28176,
+28574,
+28568,
+28575,
 28663,
-28835,
-28969,
-29010,
-28909,
-28751,
-28597,
-28543,
-28626,
-28752,
-28864,
-28878,
-28761,
-28649,
-28554,
-28560,
-28617,
-28642,
-28643,
-28581,
-28588,
-28677,
-28807,
-28959,
-28962,
-28877,
-28676,
-28519,
-28450,
-28496,
-28635,
-28767,
-28888,
-28907,
-28919,
-28845,
-28790,
-28701,
-28638,
-28587,
-28634,
-28698,
-28784,
-28843,
-28844,
-28846,
-28930,
-29170,
-29570,
-30093,
-30539,
+28552,
+28062,
+28196,
+29050,
+29810,
+30261,
+30291,
+30088,
+29628,
+28951,
+28591,
+28954,
+29831,
+30576,
+30893,
+30120,
+30222,
+33056,
+35737,
+37830,
+39292,
+39709,
+38610,
+35017,
+31771,
+30618,
+31249,
+32710,
+35874,
+40288,
+42172,
+41256,
+38972,
+35901,
+32405,
+29271,
+28947,
+31832,
+35255,
+38163,
+39706,
+39713,
+38045,
+34883,
+32037,
+30382,
+30524,
+31628,
+32557,
+32733,
+32519,
+32257,
+30924,
+28986,
+27757,
+27198,
+26770,
+26413,
+26741,
+28469,
+30323,
+31644,
+32703,
+33497,
+33689,
+32747,
+31897,
+31769,
+32443,
+33905,
+35539,
+37334,
+38875,
+39355,
+38986,
+37611,
+35842,
+34673,
+34169,
+34497,
+35493,
+37152,
+38416,
+38458,
+37509,
+35867,
+34077,
+32429,
+31588,
+31904,
+32619,
+33473,
+34136,
+33911,
+32985,
+31244,
+29471,
+28338,
+27872,
+28398,
+29512,
+30874,
+31784,
+32150,
+32248,
+32020,
+31700,
+31385,
+31350,
+31578,
+32041,
+32834,
+33349,
+33839,
+34577,
+35084,
+35255,
+34641,
+33486,
+32439,
+31199,
+30020,
+29671,
+30053,
+30724,
+31322,
+31201,
+30512,
+29538,
+28176,
+26905,
+26141,
+25982,
+26656,
+27517,
+27157,
+27611,
+29646,
+30974,
+32099,
+32653,
+33242,
+33614,
+32116,
 30894,
-30978,
-30980,
-30886,
-30873,
-30921,
-31070,
-31214,
-31316,
-31357,
-31267,
-31164,
-31020,
-30930,
-30904,
-30936,
-30981,
-31030,
-31029,
-30998,
-30949,
-30986,
-31020,
-31171,
-31237,
-31290,
-31198,
-31058,
-30912,
-30891,
-31059,
-31472,
-32031,
-32704,
-33258,
-33717,
-33893,
-33920,
-33761,
-33623,
-33570,
-33722,
-34027,
-34416,
-34715,
-34854,
-34710,
-34406,
-34044,
-33750,
-33682,
-33771,
-33994,
-34212,
+30883,
+31402,
+32547,
+35419,
+39114,
+41251,
+41625,
+40984,
+39453,
+36996,
+34749,
+34742,
+36618,
+38284,
+40071,
+41308,
+41153,
+39771,
+37474,
+35550,
+33951,
+32604,
+32165,
+32234,
+31888,
+31230,
+30468,
+29199,
+27770,
+26726,
+26037,
+25635,
+25387,
+25508,
+26525,
+27590,
+28774,
+30609,
+32458,
+33562,
+33785,
+33839,
+33975,
 34359,
-34451,
-34490,
-34624,
-34805,
-35084,
-35317,
-35443,
-35454,
-35382,
-35376,
-35487,
-35785,
-36187,
-36568,
-36863,
-36989,
-37051,
-37059,
-37150,
-37266,
-37416,
-37470,
-37472,
-37372,
-37279,
-37236,
-37181,
+34930,
+36101,
+37841,
+39228,
+40036,
+40101,
+39133,
+37542,
+35893,
+34640,
+34139,
+34374,
+35322,
+36088,
+36279,
+35753,
+34608,
+33089,
+31445,
+30665,
+30657,
+31155,
+31860,
+32373,
+32351,
+31666,
+30733,
+29832,
+29440,
+29846,
+30690,
+31602,
+32403,
+33123,
+33798,
+34051,
+34175,
+34435,
+34545,
+34312,
+33654,
+33168,
+33083,
+33239,
+33835,
+34629,
+35088,
+34529,
+32895,
+30823,
+28831,
+27308,
+26475,
+26705,
+27414,
+27712,
+27483,
+26472,
+24687,
+22726,
+21321,
+20574,
+20596,
+21642,
+22687,
+24121,
+26330,
+28245,
+30395,
+31913,
+32731,
+33476,
+33430,
+33264,
+33473,
+34900,
+37155,
+40112,
+43647,
+45921,
+46776,
+46168,
+44379,
+41970,
+39229,
+37947,
+38732,
+40195,
+41825,
+42850,
+42696,
+40795,
+37485,
+34389,
+31947,
+30573,
+30422,
+31002,
+31495,
+31202,
+30159,
+28374,
+26054,
+23998,
+23070,
+23307,
+24274,
+25768,
+27637,
+29405,
+30786,
+31798,
+32583,
+33080,
+33250,
+33571,
+34051,
+34940,
+36417,
+38054,
+39454,
+40248,
+40308,
+39628,
+38445,
 37147,
-36976,
-36722,
-36434,
-36131,
-35986,
-35859,
-35854,
-35809,
-35804,
-35820,
-35883,
-35992,
-36032,
-36012,
-35858,
-35657,
-35475,
-35384,
-35410,
-35493,
-35566,
-35506,
-35301,
-34908,
-34472,
-34050,
-33804,
-33699,
-33716,
-33684,
-33516,
-33151,
+36111,
+35665,
+35581,
+35836,
+36096,
+35718,
+35354,
+34760,
+33867,
+32895,
+31713,
+31130,
+30824,
+30798,
+31070,
+31446,
+31887,
+31911,
+31774,
+31277,
+30958,
+31137,
+31278,
+31873,
+32838,
+34003,
+35255,
+35843,
+36194,
+36196,
+35455,
+34481,
+33568,
+33342,
+33449,
+33521,
+33549,
+33207,
+32528,
+31463,
+30375,
+29286,
+27963,
+26754,
+25660,
+24697,
+24220,
+24256,
+24565,
+24659,
+24405,
+23864,
+23116,
+22541,
+22211,
+22421,
+23184,
+23933,
+25665,
+28318,
+30739,
+32927,
+34007,
+34642,
+34933,
+34553,
+34557,
+35063,
+36659,
+38792,
+41326,
+43819,
+44876,
+44655,
+43319,
+41788,
+40285,
+38737,
+38309,
+38994,
+40056,
+40775,
+40580,
+39809,
+38082,
+35560,
+33411,
+31973,
+31490,
+31708,
+32359,
+32660,
+31683,
+30155,
+28528,
+27212,
+26183,
+25614,
+26126,
+26950,
+27718,
+28646,
+29663,
+30644,
+31307,
+31911,
+32603,
+33125,
+33654,
+34169,
+34791,
+35497,
+36182,
+37004,
+37491,
+37522,
+37199,
+36575,
+35893,
+35333,
+35066,
+35060,
+35247,
+35279,
+35178,
+34965,
+34443,
+33858,
+33157,
 32665,
-32214,
-31823,
-31616,
-31440,
-31301,
-31082,
-30808,
+32478,
+32412,
+32625,
+32851,
+33031,
+33043,
+32827,
+32445,
+31919,
+31685,
+31757,
+32041,
+32316,
+32504,
+32748,
+32800,
+32615,
+32405,
+32278,
+32156,
+32057,
+32041,
+31850,
+31329,
+30711,
+30058,
+29641,
+29678,
+30175,
+30968,
+31299,
+30842,
+29934,
+28811,
+27680,
+27057,
+27291,
+28166,
+29181,
+29904,
+30130,
+29691,
+28599,
+27574,
+27107,
+27398,
+28551,
+29922,
+30877,
+31548,
+32170,
+32486,
+32672,
+32792,
+33192,
+33684,
+33615,
+33538,
+33576,
+33873,
+34392,
+35407,
+37065,
+38261,
+38473,
+38090,
+37447,
+36596,
+35666,
+35392,
+36154,
+37427,
+38737,
+39224,
+38762,
+37534,
+35939,
+34862,
+34210,
+34085,
+34430,
+34582,
+34188,
+33020,
+31407,
+30069,
+29244,
+28981,
+29200,
+29598,
+29933,
+30188,
+30480,
+30653,
+30885,
+31190,
+31644,
+32331,
+33015,
+33693,
+34179,
+34551,
+34726,
+34807,
+34838,
+35039,
+35537,
+35803,
+35935,
+35926,
+35771,
+35412,
+34880,
+34486,
+34202,
+33852,
+33353,
+32977,
+32699,
+32232,
+31568,
+30956,
 30490,
-30187,
-29928,
-29746,
-29656,
-29658,
-29777,
-29925,
-30086,
-30161,
-30155,
-30034,
-29893,
-29760,
-29739,
-29783,
-29924,
-30005,
-30028,
-29895,
-29651,
-29354,
-29064,
-28859,
-28799,
-28863,
-29021,
-29168,
-29260,
-29268,
-29220,
-29276,
-29402,
-29676,
-29917,
-30107,
-30156,
-30163,
-30266,
-30531,
-30994,
-31526,
-32019,
-32345,
-32563,
-32693,
-32908,
-33238,
-33700,
-34212,
-34659,
-34982,
-35075,
-35083,
-34986,
-34999,
-35114,
-35321,
+30080,
+29693,
+29472,
+29380,
+29364,
+29479,
+29463,
+29531,
+29713,
+29863,
+30166,
+30458,
+30934,
+31738,
+32653,
+33814,
+34765,
+35318,
+35426,
+35085,
+34868,
+34725,
+34969,
 35582,
-35777,
-35851,
-35894,
-35865,
-35973,
-36116,
-36409,
-36683,
-36987,
-37232,
-37469,
-37690,
-37881,
-38035,
-38086,
-38094,
-38050,
-38091,
-38238,
-38427,
-38643,
-38695,
-38628,
-38498,
-38364,
-38356,
-38400,
-38448,
-38409,
-38286,
-38070,
-37859,
-37607,
-37399,
-37143,
-36903,
-36676,
-36470,
-36293,
-36121,
-35920,
-35749,
-35606,
-35553,
-35551,
-35560,
-35552,
-35476,
-35338,
-35115,
-34847,
-34534,
-34260,
-34063,
-33938,
-33863,
-33704,
-33402,
-32997,
-32536,
-32244,
-32092,
-32126,
-32145,
-32098,
-31847,
-31552,
-31211,
-31032,
-30956,
+36247,
+36979,
+37397,
+37256,
+36552,
+35516,
+34345,
+33257,
+32517,
+32129,
+32212,
+32548,
+32595,
+32370,
+31626,
+30378,
+29194,
+28187,
+27801,
+28159,
+28872,
+29575,
+29814,
+29745,
+29458,
+29025,
+28620,
+28465,
+29111,
+30210,
+31316,
+32342,
+33246,
+34140,
+34868,
+35459,
+35900,
+36192,
+36565,
+36861,
+37024,
+37091,
+37048,
+36877,
+36441,
+35844,
+35025,
+34017,
+32906,
+31855,
+31128,
+30453,
+29868,
+29403,
+28796,
+27975,
+26995,
+26129,
+25688,
+25792,
+26508,
+27759,
+29069,
+30091,
+30648,
 30993,
-31003,
-30955,
-30808,
-30633,
-30484,
-30445,
-30511,
-30668,
-30821,
-30956,
-31007,
-31048,
-31088,
-31187,
-31331,
-31453,
-31537,
-31492,
-31411,
-31270,
-31136,
-31032,
-30951,
-30939,
-30936,
-31006,
-31078,
-31164,
-31200,
-31204,
-31154,
-31194,
-31270,
+31353,
+31965,
+33174,
+34732,
+36401,
+37763,
+38654,
+39024,
+38852,
+38490,
+38165,
+37996,
+37961,
+38221,
+38521,
+38418,
+38001,
+37201,
+36078,
+34738,
+33343,
+32302,
+31535,
+31046,
+30847,
+30519,
+29885,
+29124,
+28266,
+27537,
+27212,
+27250,
+27605,
+28151,
+28748,
+29249,
+29616,
+29920,
+30361,
+30913,
+31462,
+32366,
+33650,
+34869,
+35896,
+36861,
+37513,
+37728,
+37717,
+37563,
+37510,
+37622,
+37737,
+37898,
+37879,
+37607,
+37263,
+36709,
+35921,
+35146,
+34307,
+33330,
+32408,
+31625,
+31169,
+30928,
+30756,
+30585,
+30276,
+29746,
+29086,
+28558,
+28265,
+28438,
+29089,
+29849,
+30411,
+30730,
+30944,
+31137,
+31400,
+31903,
+32682,
+33432,
+34083,
+34774,
+35439,
+35993,
+36334,
+36595,
+36837,
+36822,
+36559,
+36162,
+35570,
+34906,
+34300,
+33745,
+33177,
+32481,
+31786,
+31147,
+30410,
+29586,
+28871,
+28214,
+27641,
+27272,
+27045,
+26960,
+26986,
+27162,
+27556,
+28000,
+28434,
+29083,
+29762,
+30298,
+30773,
+31357,
+32030,
+32681,
+33376,
+34005,
+34523,
+34879,
+35071,
+35114,
+34952,
+34651,
+34393,
+34306,
+34350,
+34547,
+34896,
+35048,
+34822,
+34398,
+33813,
+33179,
+32683,
+32455,
+32534,
+32691,
+32829,
+32875,
+32651,
+32199,
+31751,
 31489,
-31709,
-31936,
-32050,
-32054,
-31947,
-31831,
-31748,
-31808,
-31979,
+31357,
+31339,
+31538,
+31903,
+32344,
+32626,
+32830,
+33203,
+33519,
+33688,
+33758,
+33842,
+34164,
+34610,
+35153,
+35734,
+36097,
+36258,
+36089,
+35516,
+34754,
+34108,
+33841,
+33893,
+34223,
+34748,
+35121,
+35209,
+34799,
+33927,
+33038,
+32230,
+31911,
+32186,
+32859,
+33713,
+34197,
+34152,
+33582,
+32644,
+31717,
+30998,
+30716,
+30946,
+31489,
+32055,
+32347,
+32273,
+31822,
+31216,
+30721,
+30562,
+30945,
+31741,
+32654,
+33329,
+33663,
+33740,
+33711,
+33779,
+33952,
+34210,
+34484,
+34604,
+34490,
+34276,
+34023,
+33787,
+33591,
+33332,
+33020,
+32752,
+32462,
+32077,
+31624,
+31089,
+30703,
+30501,
+30432,
+30472,
+30508,
+30524,
+30453,
+30278,
+30208,
+30373,
+30687,
+31094,
+31409,
+31607,
+31698,
+31781,
+31994,
 32284,
-32575,
-32787,
-32866,
-32783,
-32671,
-32553,
-32555,
-32659,
-32793,
-32928,
-32902,
-32804,
-32553,
-32310,
-32085,
-31953,
-31898,
-31905,
-31920,
-31970,
-31980,
-32026,
-32050,
-32064,
-32082,
-32117,
-32154,
+32708,
+33136,
+33399,
+33528,
+33683,
+33772,
+33748,
+33787,
+33918,
+34205,
+34516,
+34618,
+34534,
+34308,
+33833,
+33301,
+32872,
+32678,
+32799,
+32894,
+32785,
+32461,
+31979,
+31413,
+30871,
+30563,
+30601,
+30858,
+31141,
+31316,
+31416,
+31401,
+31187,
+31027,
+31074,
+31244,
+31493,
+31884,
+32354,
+32828,
+33316,
+33783,
+34077,
+34148,
+34073,
+33971,
+33971,
+34137,
+34658,
+35325,
+35786,
+35944,
+35879,
+35582,
+35011,
+34335,
+33800,
+33533,
+33519,
+33766,
+34016,
+34023,
+33652,
+32998,
+32211,
+31362,
+30728,
+30410,
+30315,
+30485,
+30836,
+31077,
+31122,
+30985,
+30690,
+30492,
+30457,
+30645,
+31361,
+32357,
+33264,
+33921,
+34225,
+34361,
+34436,
+34451,
+34611,
+35020,
+35514,
+35942,
+36116,
+36003,
+35740,
+35324,
+34819,
+34431,
+34187,
+34042,
+33943,
+33724,
+33347,
+32807,
+32206,
+31702,
+31400,
+31256,
+31253,
+31358,
+31355,
+31191,
+30979,
+30746,
+30618,
+30590,
+30628,
+30930,
+31243,
+31516,
+31786,
+31963,
 32225,
+32604,
+32970,
+33175,
+33267,
+33190,
+32932,
+32796,
+32912,
+33177,
+33431,
+33560,
+33464,
+33076,
+32490,
+31918,
+31536,
+31411,
+31465,
+31602,
+31661,
+31591,
+31528,
+31367,
+31185,
+31202,
+31418,
+31752,
+32020,
+32164,
 32273,
-32335,
-32341,
-32334,
-32294,
-32272,
-32228,
-32216,
-32162,
-32170,
-32176,
+32332,
+32247,
+32183,
 32256,
-32375,
-32485,
-32528,
-32439,
-32262,
-32021,
-31868,
+32441,
+32763,
+33067,
+33346,
+33564,
+33713,
+33844,
+33852,
+33786,
+33663,
+33656,
+33736,
+33805,
+34021,
+34179,
+34293,
+34286,
+34130,
+34001,
+33754,
+33564,
+33472,
+33466,
+33547,
+33626,
+33704,
+33599,
+33347,
+33093,
+32792,
+32504,
+32248,
+32023,
+31901,
+31809,
+31683,
+31452,
+31204,
+31011,
+30856,
+30834,
+30873,
+30968,
+31136,
+31376,
+31742,
+32167,
+32591,
+32927,
+33201,
+33591,
+34078,
+34533,
+34802,
+34971,
+35177,
+35318,
+35418,
+35530,
+35586,
+35570,
+35393,
+35090,
+34787,
+34465,
+34238,
+34023,
+33812,
+33665,
+33483,
+33308,
+33034,
+32718,
+32445,
+32083,
+31781,
+31648,
+31711,
+31707,
+31511,
+31319,
+31106,
+30989,
+30970,
+31159,
+31485,
+31669,
+31731,
+31699,
+31636,
+31568,
+31532,
+31611,
+31800,
+32073,
+32335,
+32441,
+32378,
+32208,
+31978,
+31772,
+31723,
+31784,
+31863,
+31916,
+31851,
+31608,
+31333,
+31048,
+30734,
+30643,
+30770,
+31008,
+31355,
+31627,
+31790,
+31801,
+31623,
+31496,
+31491,
+31629,
+32001,
+32565,
+33111,
+33573,
+33933,
+34141,
+34240,
+34276,
+34344,
+34407,
+34522,
+34777,
+35118,
+35476,
+35726,
+35908,
+35985,
+35797,
+35370,
+34953,
+34777,
+34789,
+34931,
+35145,
+35247,
+35154,
+34824,
+34263,
+33718,
+33319,
+33046,
+32917,
+32809,
+32735,
+32677,
+32443,
+32068,
+31673,
+31434,
+31309,
+31224,
+31223,
+31264,
+31380,
+31536,
+31644,
+31747,
+31875,
+32066,
+32235,
+32406,
+32662,
+32892,
+33114,
+33312,
+33484,
+33629,
+33754,
+33866,
+33952,
+34052,
+34107,
+34131,
+34134,
+34061,
+33865,
+33616,
+33450,
+33353,
+33313,
+33333,
+33364,
+33302,
+33119,
+32782,
+32408,
+32177,
+32065,
+31949,
+31848,
+31762,
+31577,
+31344,
+31124,
+31051,
+31088,
+31039,
+30868,
+30644,
+30395,
+30104,
+29989,
+30056,
+30152,
+30346,
+30520,
+30625,
+30745,
+30751,
+30738,
+30743,
+30790,
+30998,
+31243,
+31477,
+31659,
 31854,
-31984,
-32207,
-32333,
-32330,
-32170,
-31940,
-31813,
-31801,
-32013,
-32303,
-32605,
-32823,
-32935,
-32935,
-32971,
-32970,
-33032,
-33132,
-33178,
-33312,
-33348,
-33419,
-33397,
-33314,
-33189,
-33049,
-32985,
-33018,
-33104,
-33218,
-33229,
-33197,
-33055,
-32899,
-32761,
-32605,
-32550,
-32492,
-32500,
+31967,
+31903,
+31914,
+32051,
+32328,
+32699,
+33034,
+33333,
+33488,
+33495,
+33475,
+33462,
+33450,
+33574,
+33806,
+33952,
+34047,
+34149,
+34203,
+34197,
+34026,
+33727,
+33538,
+33434,
+33451,
+33649,
+33905,
+34083,
+34196,
+34157,
+33930,
+33671,
+33474,
+33503,
+33733,
+34108,
+34528,
+34797,
+34832,
+34679,
+34439,
+34111,
+33875,
+33780,
+33810,
+33837,
+33737,
+33592,
+33411,
+33120,
+32755,
 32536,
-32533,
-32489,
-32393,
-32250,
-32169,
-32158,
-32193,
-32282,
-32362,
-32426,
-32485,
-32444,
-32356,
-32158,
-31922,
-31731,
-31650,
-31641,
-31690,
-31624,
-31460,
-31193,
-30954,
-30816,
-30806,
-30896,
-30943,
-30972,
-30881,
-30806,
-30724,
-30706,
-30652,
-30632,
-30489,
-30405,
-30251,
-30261,
-30264,
-30390,
-30477,
-30539,
-30533,
-30510,
-30470,
-30515,
-30578,
-30706,
-30825,
-30933,
-31006,
-31049,
-31052,
-31001,
-30937,
-30865,
-30870,
-30975,
-31197,
-31444,
-31624,
-31697,
-31664,
-31657,
-31780,
-32019,
-32361,
-32590,
-32723,
-32665,
-32624,
-32574,
-32682,
-32783,
-32910,
-32988,
-33014,
-33044,
-33070,
-33100,
-33144,
-33149,
-33226,
-33266,
-33384,
-33473,
-33562,
-33706,
-33835,
-34075,
-34275,
-34484,
-34531,
-34524,
-34397,
-34381,
-34486,
-34749,
-35101,
-35358,
-35464,
-35403,
-35330,
-35305,
-35451,
-35623,
-35745,
-35714,
-35538,
-35325,
-35145,
-35041,
-34963,
-34871,
-34765,
-34660,
-34600,
-34558,
-34479,
-34328,
-34094,
-33872,
-33732,
-33753,
-33893,
-34104,
-34246,
-34237,
-34064,
-33738,
-33362,
-33058,
-32883,
-32886,
-33012,
-33174,
-33291,
-33306,
-33214,
-33024,
-32813,
-32585,
-32350,
-32150,
-31945,
-31792,
-31746,
-31715,
-31770,
-31732,
-31617,
-31360,
-31016,
-30713,
-30477,
-30460,
-30577,
-30781,
+32405,
+32278,
+32156,
+32056,
+31983,
+31954,
+31964,
+31962,
+31973,
+31941,
+31961,
+31999,
+32020,
+32103,
+32275,
+32545,
+32788,
+33008,
+33218,
+33397,
+33585,
+33804,
+34065,
+34287,
+34528,
+34717,
+34780,
+34815,
+34769,
+34710,
+34625,
+34587,
+34611,
+34576,
+34442,
+34108,
+33716,
+33262,
+32753,
+32255,
+31798,
+31487,
+31249,
+31104,
 30980,
-31044,
-31015,
-30875,
-30760,
-30637,
-30613,
-30579,
-30567,
+30874,
+30782,
 30527,
-30525,
-30542,
-30601,
-30629,
-30616,
-30509,
-30405,
-30295,
-30296,
-30361,
-30403,
-30446,
-30328,
-30246,
-30119,
-30104,
-30145,
-30222,
-30278,
-30246,
-30194,
-30143,
-30151,
-30266,
-30406,
-30563,
-30674,
-30764,
-30823,
-30931,
-31019,
-31100,
-31128,
-31107,
-31065,
-31024,
-31031,
-31029,
-31061,
-31067,
-31091,
-31184,
-31304,
-31485,
-31608,
-31705,
-31651,
-31615,
-31551,
-31633,
-31821,
-32088,
-32396,
-32617,
+30175,
+29843,
+29719,
+29836,
+30050,
+30415,
+30838,
+31202,
+31464,
+31638,
+31792,
+31898,
+31956,
+32085,
+32321,
+32587,
+32845,
+32965,
+32920,
+32737,
+32518,
+32298,
+32030,
+31872,
+31873,
+32006,
+32142,
+32229,
+32301,
+32217,
+31991,
+31796,
+31690,
+31733,
+31907,
+32114,
+32310,
+32570,
+32802,
+32874,
+32891,
+32893,
+32866,
 32815,
-32902,
-32980,
-33019,
-33078,
-33161,
-33338,
-33585,
-33924,
-34230,
-34473,
-34559,
-34511,
-34409,
-34306,
-34257,
-34290,
-34347,
-34433,
-34514,
-34574,
-34586,
-34581,
-34495,
-34428,
-34347,
-34316,
-34346,
-34418,
-34501,
-34563,
-34544,
-34507,
-34389,
-34330,
-34313,
-34433,
-34595,
-34745,
-34756,
-34587,
-34296,
-34012,
-33823,
-33876,
-33973,
+32846,
+32962,
+33187,
+33511,
+33739,
+33819,
+33762,
+33674,
+33622,
+33561,
+33619,
+33831,
+34010,
+34035,
+34023,
+33957,
+33734,
+33479,
+33271,
+33066,
+32890,
+32828,
+32846,
+32800,
+32704,
+32660,
+32630,
+32619,
+32617,
+32620,
+32662,
+32737,
+32847,
+32981,
+33113,
+33261,
+33397,
+33475,
+33527,
+33592,
+33729,
+33898,
+34033,
+34089,
+34059,
+33949,
+33751,
+33629,
+33676,
+33746,
+33756,
+33745,
+33601,
+33324,
+33002,
+32754,
+32587,
+32424,
+32403,
+32426,
+32351,
+32195,
+32028,
+31880,
+31688,
+31581,
+31627,
+31688,
+31704,
+31851,
+32129,
+32364,
+32538,
+32692,
+32762,
+32752,
+32771,
+32862,
+33178,
+33551,
+33850,
+34075,
+34202,
+34237,
+34100,
+34050,
+33984,
+33809,
+33784,
+33931,
+33875,
+33455,
+33194,
+32969,
+32338,
+31755,
+31661,
+31701,
+31373,
+31185,
+31402,
+31464,
+31156,
+30852,
+30960,
+31042,
+30875,
+30994,
+31405,
+31595,
+31566,
+31649,
+31806,
+31935,
+32148,
+32371,
+32454,
+32444,
+32393,
+32276,
+32122,
+32110,
+32302,
+32411,
+32419,
+32478,
+32392,
+32172,
+32011,
+31917,
+31923,
+32027,
+32229,
+32391,
+32454,
+32577,
+32664,
+32561,
+32428,
+32468,
+32667,
+32925,
+33245,
+33612,
+33821,
+33895,
+33959,
+33926,
+33857,
+33930,
 34135,
-34129,
-33944,
-33690,
-33393,
-33242,
-33221,
-33286,
-33402,
-33424,
-33400,
-33316,
-33236,
-33197,
-33195,
-33212,
-33214,
-33182,
-33135,
-33056,
-32975,
-32886,
-32839,
-32814,
-32880,
-32913,
-32977,
-32937,
-32860,
+34323,
+34465,
+34538,
+34472,
+34298,
+34053,
+33822,
+33655,
+33521,
+33414,
+33349,
+33235,
+33073,
+32856,
+32561,
+32351,
+32228,
+32242,
+32319,
+32347,
+32359,
+32317,
+32280,
+32239,
+32243,
+32359,
+32467,
+32577,
+32640,
+32658,
+32644,
+32560,
+32596,
+32661,
 32721,
+32800,
+32850,
+32905,
+32917,
+32885,
+32892,
+33016,
+33212,
+33413,
+33629,
+33789,
+33807,
+33782,
+33755,
+33742,
+33752,
+33844,
+33961,
+33983,
+33965,
+33907,
+33764,
+33596,
+33499,
+33407,
+33276,
+33165,
+33059,
+32875,
+32723,
 32633,
-32611,
-32646,
-32691,
-32657,
-32573,
-32426,
-32339,
-32320,
-32443,
-32595,
-32749,
-32841,
-32844,
-32857,
-32881,
-32977,
-33150,
-33288,
-33419,
-33468,
-33517,
-33574,
-33736,
-33908,
-34065,
-34133,
-34032,
-33892,
-33719,
-33687,
-33785,
-34032,
-34291,
-34482,
-34544,
-34474,
-34387,
-34314,
-34353,
-34491,
-34663,
-34868,
-35015,
-35132,
-35201,
-35264,
-35300,
-35370,
-35421,
-35518,
-35621,
-35739,
-35870,
-35949,
-36037,
-36056,
-36089,
-36092,
-36065,
-35993,
-35910,
-35776,
-35679,
-35576,
-35512,
-35390,
-35277,
-35070,
-34861,
-34700,
-34565,
-34549,
-34544,
-34563,
-34517,
-34423,
-34279,
-34131,
-34036,
-33993,
-34013,
-34001,
-33932,
-33765,
-33563,
-33373,
-33294,
-33250,
-33256,
-33159,
-33006,
-32805,
-32640,
-32584,
-32553,
-32567,
-32474,
-32342,
-32149,
-31965,
-31790,
-31639,
-31486,
-31366,
-31302,
-31318,
-31374,
-31443,
-31460,
-31437,
-31394,
-31371,
-31403,
-31496,
-31617,
-31799,
-31967,
-32125,
-32223,
-32203,
-32095,
-31904,
-31730,
-31629,
-31686,
-31864,
-32111,
-32291,
-32358,
-32273,
-32078,
-31900,
-31778,
-31812,
-31978,
-32173,
-32370,
-32429,
-32432,
-32332,
-32250,
-32227,
+32558,
+32530,
+32521,
+32448,
 32275,
-32413,
-32579,
-32753,
-32922,
-33083,
-33217,
-33353,
-33459,
-33540,
-33576,
-33601,
-33611,
-33630,
-33645,
-33600,
-33527,
-33369,
-33219,
-33063,
-32987,
-32898,
-32851,
-32756,
-32665,
-32603,
-32574,
-32625,
-32649,
-32672,
-32604,
-32533,
-32431,
+32084,
+31981,
+32019,
+32009,
+31964,
+31984,
+31925,
+31764,
+31572,
+31475,
+31480,
+31489,
+31559,
+31635,
+31623,
+31531,
+31432,
+31345,
+31309,
+31389,
+31528,
+31775,
+31980,
+32045,
+32050,
+32005,
+32058,
+32228,
+32516,
+32886,
+33152,
+33289,
+33392,
+33417,
+33460,
+33608,
+33733,
+33844,
+33963,
+34037,
+34010,
+33861,
+33728,
+33678,
+33597,
+33539,
+33432,
+33286,
+33145,
+32963,
+32794,
+32612,
+32460,
 32377,
-32370,
-32430,
-32498,
+32283,
+32215,
+32201,
+32196,
+32178,
+32170,
+32259,
+32347,
+32435,
+32504,
+32532,
 32587,
-32594,
-32605,
-32544,
-32521,
-32507,
-32547,
-32636,
-32705,
-32752,
-32677,
-32553,
-32298,
-32081,
-31837,
-31669,
-31544,
-31417,
-31327,
-31172,
-31052,
-30902,
-30801,
-30717,
-30660,
-30662,
-30715,
-30823,
-30972,
-31115,
-31200,
-31247,
-31209,
-31183,
-31144,
-31163,
-31184,
-31264,
-31332,
-31444,
-31528,
-31617,
-31619,
-31523,
-31382,
-31177,
-31119,
-31163,
-31346,
-31538,
-31583,
-31462,
-31206,
-31041,
-31102,
-31498,
-32059,
-32609,
-32908,
-32922,
-32756,
-32576,
-32588,
-32753,
-33036,
-33276,
-33418,
-33451,
-33456,
-33475,
-33534,
-33505,
-33407,
-33153,
-32900,
-32702,
-32696,
-32840,
-33063,
-33230,
-33281,
-33171,
+32710,
+32871,
+32949,
+33026,
+33041,
 32995,
-32772,
-32596,
-32463,
-32434,
-32538,
-32768,
-33153,
-33558,
-33943,
-34143,
-34152,
-33948,
-33678,
-33406,
-33313,
-33362,
-33574,
-33774,
-33948,
-33925,
-33839,
-33611,
-33428,
-33192,
-33010,
-32807,
-32603,
-32477,
-32427,
-32533,
-32720,
-32913,
-33057,
-33065,
-32957,
-32753,
-32555,
-32410,
-32433,
-32596,
-32913,
-33297,
+32964,
+32943,
+32996,
+33041,
+32992,
+32924,
+32857,
+32722,
+32649,
+32624,
+32532,
+32414,
+32276,
+32150,
+32036,
+31939,
+31965,
+32085,
+32192,
+32334,
+32446,
+32512,
+32531,
+32541,
+32689,
+32861,
+33025,
+33289,
 33611,
-33817,
-33806,
-33669,
-33468,
-33319,
-33267,
-33318,
-33412,
-33509,
-33542,
-33510,
-33385,
-33250,
-33081,
+33851,
+34014,
+34152,
+34232,
+34319,
+34362,
+34364,
+34324,
+34135,
+33875,
+33594,
+33343,
+33157,
+33039,
 32953,
-32821,
-32724,
+32822,
+32603,
+32269,
+31895,
+31512,
+31226,
+31143,
+31187,
+31234,
+31215,
+31160,
+31036,
+30882,
+30787,
+30876,
+31110,
+31358,
+31671,
+31971,
+32218,
+32382,
+32508,
+32661,
+32862,
+33151,
+33391,
+33624,
+33875,
+34064,
+34181,
+34201,
+34232,
+34255,
+34295,
+34313,
+34252,
+34194,
+34059,
+33955,
+33823,
+33673,
+33608,
+33515,
+33424,
+33275,
+33055,
+32873,
+32711,
+32627,
+32591,
+32577,
+32644,
+32676,
 32624,
-32516,
-32421,
-32318,
-32278,
-32301,
-32399,
-32533,
-32639,
-32702,
-32623,
-32525,
-32360,
-32258,
+32524,
+32386,
 32234,
-32230,
-32272,
-32241,
-32148,
-32024,
-31818,
-31616,
-31368,
-31111,
-30881,
-30676,
-30514,
-30410,
-30303,
-30221,
-30095,
-30000,
-29855,
-29779,
-29647,
-29507,
-29298,
-29043,
-28807,
-28668,
-28638,
-28740,
-28856,
-28967,
-28951,
-28881,
-28693,
-28510,
-28280,
-28039,
-27853,
-27690,
-27640,
-27644,
-27630,
-27537,
-27333,
-27070,
-26956,
-27059,
-27576,
-28348,
-29301,
-30243,
-30981,
-31532,
-31848,
-32027,
-32112,
-32149,
-32169,
-32231,
-32422,
-32771,
-33306,
-33839,
-34263,
-34347,
-34096,
-33581,
-33110,
-32941,
-33277,
-34011,
-34932,
-35676,
-36015,
-35899,
-35388,
-34781,
-34176,
-33856,
-33813,
-34182,
-34869,
-35805,
-36764,
-37561,
-37968,
-38007,
-37745,
-37393,
-37176,
-37142,
-37388,
-37703,
-38035,
-38210,
-38231,
-38050,
-37750,
-37344,
-36865,
-36374,
-35880,
-35518,
-35327,
-35362,
-35654,
-36054,
-36483,
-36770,
-36796,
-36589,
-36152,
-35645,
-35239,
-34966,
-34988,
-35164,
-35474,
-35759,
-35977,
-36025,
-35974,
-35790,
-35562,
-35310,
-35060,
-34864,
-34709,
-34590,
-34491,
-34340,
-34074,
-33699,
+32146,
+32179,
+32385,
+32598,
+32818,
+33031,
+33138,
+33093,
+32973,
+32954,
+32947,
+33030,
+33231,
+33405,
+33551,
+33590,
+33584,
+33443,
+33223,
+33013,
+32805,
+32663,
+32593,
+32658,
+32675,
+32540,
+32343,
+32233,
+32006,
+31802,
+31727,
+31679,
+31709,
+31768,
+31853,
+31918,
+32036,
+32150,
+32136,
+32154,
+32280,
+32400,
+32499,
+32648,
+32870,
+32908,
+32903,
+33046,
+33047,
+33057,
+33084,
+33081,
+33128,
+33113,
 33161,
-32604,
-32069,
-31612,
-31279,
-31035,
-30841,
-30767,
-30694,
-30770,
-30854,
-31000,
-31179,
-31345,
-31523,
-31653,
-31713,
-31669,
-31539,
-31382,
-31269,
-31295,
-31394,
-31574,
-31755,
-31847,
-31895,
-31778,
-31596,
-31323,
-31026,
-30801,
-30731,
-30804,
-31009,
-31175,
-31261,
-31166,
-30937,
-30649,
-30392,
-30260,
-30349,
-30623,
-31120,
-31712,
-32322,
-32843,
-33215,
-33420,
-33560,
-33668,
-33872,
-34151,
-34512,
-34895,
-35215,
-35394,
-35450,
-35305,
-35124,
-34850,
-34626,
-34474,
-34412,
-34435,
-34497,
-34551,
-34557,
-34513,
-34442,
-34382,
-34337,
-34370,
-34361,
-34409,
-34378,
-34386,
-34409,
-34510,
-34690,
-34921,
-35162,
-35360,
-35463,
-35515,
-35525,
-35506,
-35533,
-35495,
-35463,
-35333,
-35144,
-34877,
-34572,
-34243,
-33931,
-33663,
-33414,
-33219,
-32987,
-32751,
-32506,
-32301,
-32155,
-32174,
-32252,
-32431,
-32580,
-32722,
-32782,
-32856,
-32838,
-32882,
-32824,
-32798,
+33121,
+33004,
+32872,
 32714,
-32692,
-32699,
-32828,
-32965,
-33089,
-33098,
-32950,
-32722,
-32416,
-32189,
-32006,
-31894,
-31795,
-31661,
-31480,
-31260,
-30997,
-30784,
-30582,
-30470,
-30444,
-30474,
-30584,
-30646,
-30766,
-30826,
-30975,
-31092,
-31275,
-31402,
-31546,
-31634,
-31716,
-31785,
-31810,
-31796,
-31732,
-31646,
-31546,
-31527,
-31487,
-31544,
-31534,
-31550,
-31511,
-31462,
-31369,
-31264,
-31132,
-31006,
-30925,
-30897,
-30934,
-31021,
-31142,
-31229,
-31327,
-31353,
-31387,
-31402,
-31490,
+32532,
+32377,
+32441,
+32455,
+32343,
+32325,
+32211,
+32043,
+31879,
 31667,
-31919,
-32231,
-32465,
-32615,
-32609,
+31554,
+31528,
+31511,
+31500,
+31484,
+31475,
+31383,
+31306,
+31329,
+31412,
+31594,
+31670,
+31813,
+32006,
+32055,
+32215,
+32356,
+32434,
+32624,
+32810,
+32950,
+33084,
+33297,
+33453,
+33568,
+33682,
+33836,
+33978,
+33984,
+34013,
+34079,
+34081,
+34074,
+34159,
+34202,
+34220,
+34230,
+34146,
+34131,
+34148,
+34207,
+34253,
+34220,
+34176,
+34132,
+34064,
+33988,
+33936,
+33810,
+33600,
+33434,
+33367,
+33208,
+33122,
+33178,
+33093,
+32985,
+32845,
+32742,
+32720,
+32673,
+32725,
+32723,
+32603,
+32581,
+32604,
+32627,
+32669,
+32804,
+32910,
+32858,
+32757,
+32803,
+32758,
+32719,
+32788,
+32860,
+32935,
+32916,
+32945,
+32828,
+32682,
+32679,
+32596,
+32485,
+32487,
+32591,
+32473,
+32381,
 32517,
-32390,
-32306,
-32269,
-32243,
-32224,
-32147,
-32092,
-32019,
-31971,
-31919,
-31856,
-31757,
-31665,
-31607,
-31586,
-31672,
-31769,
-31909,
-32024,
-32051,
-32056,
-31982,
-31937,
-31924,
-31983,
-32103,
+32483,
+32372,
+32393,
+32337,
+32186,
+32052,
+32290,
+32402,
+32258,
+32458,
+32750,
+32647,
+32543,
+32878,
+33025,
+32890,
+32905,
+33159,
+33081,
+32892,
+33062,
+32975,
+32712,
+32658,
+32742,
+32512,
+32142,
+32032,
+31770,
+31206,
+31075,
+31060,
+30668,
+30492,
+30474,
+30304,
+30129,
+30294,
+30269,
+30094,
+30163,
+30383,
+30403,
+30399,
+30827,
+31186,
+31275,
+31596,
+32038,
 32232,
-32360,
-32428,
-32473,
-32478,
-32474,
-32466,
-32464,
-32432,
-32427,
-32401,
-32350,
-32315,
-32164,
-32055,
-31867,
-31742,
-31696,
-31729,
-31841,
-31973,
-32092,
-32132,
-32163,
-32168,
-32263,
-32439,
-32690,
-32985,
-33197,
-33389,
-33427,
-33495,
-33523,
-33588,
-33716,
-33785,
-33883,
-33892,
-33936,
-33969,
-34070,
-34159,
-34232,
+32388,
+32599,
+32874,
+33103,
+33419,
+33683,
+33981,
+34476,
+34465,
+34419,
+34577,
+34601,
+34411,
+34541,
+34816,
+34776,
+34402,
+34529,
+34890,
+34291,
 34239,
-34194,
-34117,
-34069,
-34029,
-34060,
-34091,
-34151,
-34199,
-34232,
-34241,
-34282,
-34314,
-34404,
-34556,
-34728,
-34951,
-35120,
-35241,
-35298,
-35305,
-35288,
-35323,
-35315,
-35348,
-35310,
-35204,
-35070,
-34827,
-34622,
-34413,
-34317,
-34258,
-34272,
-34252,
-34182,
-34023,
-33823,
-33577,
-33399,
-33300,
-33276,
-33330,
-33366,
-33316,
-33240,
-33035,
-32919,
-32778,
+34594,
+34275,
+33729,
+33851,
+34219,
+33552,
+33112,
+33585,
+33465,
+32871,
+33069,
+33377,
+32906,
+32309,
+32825,
+33077,
+32695,
+32832,
+33178,
+32999,
+32950,
+33323,
+33036,
+32936,
+33104,
+33270,
+33253,
+32934,
+33227,
+33153,
+32823,
+33013,
+33125,
+32512,
+32420,
+33002,
+32584,
+33393,
+33499,
+31315,
+31423,
+32827,
+32923,
+31917,
+32946,
+33432,
+31219,
+32152,
+35591,
+34960,
+31382,
+31999,
+34908,
+34240,
+32571,
+33703,
+35406,
+33631,
+32804,
+34967,
+36390,
+33675,
+32169,
+35107,
+35842,
+33010,
+32679,
+34375,
+33550,
+32484,
 32810,
-32857,
-32980,
-33067,
-33118,
+33690,
+31812,
+32251,
+31938,
+31065,
+31542,
+30582,
+30609,
+30066,
+30872,
+29640,
+29534,
+30653,
+29732,
+30214,
+28919,
+29682,
+31239,
+30168,
+30523,
+31611,
+30602,
+30924,
+31001,
+32111,
+32675,
+30831,
+32827,
+33456,
+32366,
+33039,
+33566,
+32948,
+32592,
+34088,
+33962,
+33406,
+34000,
+33544,
+34796,
+33930,
+30630,
+33393,
+36117,
+30395,
+31826,
+37165,
+32237,
+31333,
 33081,
-33049,
-32905,
-32862,
-32721,
-32677,
-32571,
-32465,
-32337,
-32176,
-31999,
-31840,
-31660,
-31538,
-31438,
-31354,
-31331,
-31275,
-31294,
-31285,
-31320,
-31335,
-31373,
-31384,
-31403,
+34690,
+32323,
 31358,
-31333,
-31247,
-31205,
-31163,
-31167,
-31209,
-31286,
-31337,
-31401,
-31415,
-31409,
-31391,
-31356,
+32902,
+32711,
+32910,
+30734,
+32674,
+34403,
+31889,
+29976,
+34334,
+33493,
+29128,
+34421,
+32017,
+30905,
+35850,
+33194,
+33743,
+33913,
+33297,
+33844,
+32896,
+32013,
+35311,
+33326,
+30674,
+35405,
+34170,
+32632,
+33961,
+32885,
+34519,
+33109,
+32290,
+35865,
+30071,
+33725,
+33579,
 31320,
-31305,
-31263,
-31269,
-31214,
-31169,
-31082,
-30941,
-30791,
-30637,
-30537,
-30524,
-30576,
-30696,
-30812,
-30934,
-30982,
-31063,
-31098,
-31153,
-31221,
-31277,
-31341,
-31396,
-31449,
-31474,
-31496,
-31456,
-31464,
-31453,
-31543,
-31662,
-31868,
-32045,
-32203,
-32307,
-32353,
-32408,
-32450,
-32544,
-32611,
-32694,
-32765,
-32879,
-33039,
-33291,
-33569,
-33848,
-34009,
-34114,
-34099,
-34127,
-34219,
-34416,
-34715,
-35036,
-35304,
-35454,
-35492,
-35412,
-35296,
-35165,
-35093,
-35077,
-35170,
-35259,
-35430,
-35507,
-35554,
-35527,
-35445,
-35368,
-35283,
-35230,
-35213,
-35222,
-35267,
-35364,
-35446,
-35561,
-35572,
-35574,
-35473,
-35370,
-35260,
-35191,
-35123,
-35114,
-35035,
-34987,
-34886,
-34835,
-34790,
-34765,
-34740,
-34621,
-34466,
-34165,
-33864,
-33561,
-33318,
-33197,
-33158,
-33192,
-33203,
-33211,
-33075,
-32936,
-32665,
-32432,
+35357,
+31549,
+34589,
+33021,
+31799,
+35387,
+32499,
+35425,
+30427,
+33992,
+35498,
+30734,
+36167,
+33854,
+32386,
+35355,
+33060,
+34538,
+33320,
+36088,
+33296,
+31215,
+38893,
+30233,
+36619,
+32538,
+32590,
+35973,
+31599,
+33143,
+33644,
+33416,
+32682,
+30852,
+33905,
+32488,
+31209,
+31979,
+30094,
+33142,
+29641,
+31791,
+30565,
+28818,
+33079,
+30225,
+28515,
+33533,
+29496,
+30580,
+30239,
+30304,
+32822,
+29979,
+31750,
+31633,
+31767,
+32389,
+31508,
+32865,
+32002,
+32653,
+33575,
+31536,
+34105,
+34035,
+32484,
+34108,
+32069,
+34700,
+32927,
+33363,
+31551,
+36071,
+32199,
+32054,
+34345,
+32603,
+32827,
+31807,
+34093,
+28791,
+36762,
+29814,
+33241,
+32666,
+31836,
+34123,
+29041,
+34714,
+31979,
+31307,
+31245,
+32767,
+34554,
+29698,
+33331,
+34771,
+31346,
+32434,
+33165,
+32729,
+33256,
+31172,
+32753,
+34938,
+30613,
+35053,
+33596,
+32746,
 32203,
-32052,
-31986,
-31968,
-32027,
-32028,
-32026,
-31903,
-31704,
-31448,
-31157,
-30961,
-30800,
-30764,
-30714,
-30675,
-30634,
-30556,
-30565,
-30553,
-30587,
-30563,
-30502,
-30395,
-30314,
-30300,
-30391,
-30513,
-30688,
-30798,
-30904,
-30955,
-31016,
-31063,
-31132,
-31211,
-31333,
-31431,
-31570,
-31656,
-31720,
-31794,
-31803,
-31871,
-31944,
-32022,
-32149,
-32198,
-32245,
-32234,
-32202,
-32184,
-32223,
-32354,
-32553,
-32844,
-33082,
+32516,
+34584,
+30658,
+32940,
+34492,
+30421,
+33092,
+32797,
+33474,
+32129,
+31645,
+33951,
+31257,
+34531,
+32602,
+33692,
+34031,
+31680,
+34669,
+34146,
+33639,
+32837,
+36605,
+32697,
+33473,
+37123,
+32428,
+35434,
+33720,
+35572,
+34220,
+32222,
+38563,
+31779,
+32884,
+35267,
+34324,
+34444,
+29635,
+36476,
+34495,
+30620,
+32879,
+33343,
+33188,
+29975,
+33191,
+31585,
+33078,
+30072,
+32111,
+33299,
+30252,
+31778,
+31526,
+32148,
+31295,
+31011,
+33338,
+31235,
+30465,
+34491,
+30529,
+33225,
+31369,
+33055,
+33487,
+29450,
+37026,
+29243,
+32331,
+34166,
+30620,
+34273,
+30793,
+35921,
+29342,
 33312,
-33380,
-33367,
-33292,
-33251,
-33348,
-33584,
-33925,
-34224,
-34391,
-34380,
-34223,
-34047,
-33938,
-33948,
-34062,
-34188,
-34310,
-34345,
-34358,
-34264,
-34175,
-34030,
-33888,
-33775,
-33691,
-33651,
-33608,
-33545,
-33435,
-33295,
-33129,
-32969,
-32793,
-32668,
-32547,
-32482,
-32402,
-32365,
-32261,
-32140,
-31991,
-31819,
-31694,
-31565,
-31486,
-31375,
-31233,
-31013,
-30771,
-30514,
-30306,
-30154,
-30018,
-29937,
-29785,
-29625,
-29409,
-29179,
-28997,
-28770,
-28624,
-28423,
-28278,
-28110,
-27999,
-27880,
-27828,
-27759,
-27760,
-27784,
-27870,
-28043,
-28244,
-28534,
-28773,
-29037,
-29197,
-29334,
-29414,
-29485,
-29535,
-29616,
-29697,
-29825,
-29995,
-30159,
-30334,
-30461,
-30501,
-30528,
-30505,
-30563,
-30735,
-31032,
-31414,
-31821,
-32119,
-32357,
-32472,
-32555,
-32623,
-32768,
-33003,
-33347,
-33777,
-34250,
-34671,
-35087,
-35351,
-35652,
-35861,
-36122,
-36344,
-36524,
-36666,
-36775,
-36903,
-37061,
-37254,
-37407,
-37504,
-37501,
-37422,
-37303,
-37187,
-37110,
-37114,
-37165,
-37311,
-37480,
-37665,
-37795,
-37829,
-37745,
-37587,
-37415,
-37262,
-37253,
-37280,
-37393,
-37434,
-37383,
-37236,
-36976,
-36748,
-36496,
-36362,
-36236,
-36161,
-36052,
-35882,
-35633,
-35306,
-34944,
-34583,
-34267,
-34022,
+35224,
+28342,
+35815,
+32082,
+32592,
+32910,
+34474,
+33452,
+32995,
+33238,
+32773,
+33663,
+33086,
+33933,
+32311,
+32576,
+33616,
+34400,
+31640,
+32706,
 33822,
-33656,
-33459,
-33226,
-32912,
-32584,
-32244,
-31971,
-31748,
-31655,
-31579,
-31554,
-31474,
-31312,
-31097,
-30795,
-30519,
-30324,
-30186,
-30188,
-30161,
-30155,
-30051,
-29905,
-29746,
-29575,
-29503,
-29398,
-29322,
-29213,
-29054,
-28969,
-28911,
-28951,
-29010,
-29070,
-29028,
-28936,
-28831,
-28780,
-28871,
-29056,
-29288,
-29477,
-29617,
-29709,
-29813,
-30006,
-30221,
-30500,
+31148,
+32154,
+33824,
+32048,
+32111,
+31222,
+33130,
+31689,
+33044,
+31234,
+32267,
+31895,
 30697,
-30854,
-30920,
-31038,
-31182,
-31424,
-31711,
-31978,
-32200,
-32369,
-32454,
-32570,
-32680,
-32804,
-32945,
-33066,
-33164,
-33283,
-33376,
-33491,
-33586,
-33682,
-33739,
-33790,
-33861,
-33950,
-34080,
-34241,
-34399,
-34551,
-34689,
-34785,
-34902,
-35015,
-35163,
-35295,
-35408,
-35434,
-35393,
-35314,
-35252,
-35206,
-35275,
-35292,
-35335,
-35283,
-35199,
-35103,
-35013,
-34986,
-34951,
-34950,
-34888,
-34838,
-34788,
-34733,
-34727,
-34674,
-34621,
-34526,
-34418,
-34332,
-34296,
-34312,
-34320,
-34364,
-34294,
-34249,
-34111,
-34017,
-33917,
-33832,
-33761,
-33688,
-33580,
-33467,
-33301,
-33077,
-32882,
-32634,
-32518,
-32378,
-32354,
-32271,
-32214,
-32103,
-32030,
-31949,
-31921,
-31881,
-31870,
-31867,
-31884,
-31944,
-31992,
-32071,
-32099,
-32124,
-32131,
-32136,
-32203,
-32276,
-32380,
-32492,
-32568,
-32632,
-32645,
-32624,
-32593,
-32579,
-32572,
-32602,
-32614,
-32591,
-32578,
-32545,
-32565,
-32631,
-32694,
-32784,
-32836,
+33179,
+32717,
+31732,
+32494,
+32041,
+31510,
+33844,
+30393,
+33957,
+33389,
+30209,
+34566,
+31201,
+33309,
+32933,
+33124,
+32328,
+31288,
+34756,
+31179,
+32953,
 32903,
-32987,
-33115,
-33267,
-33458,
-33597,
-33739,
-33863,
-33928,
-34032,
-34053,
-34072,
-34084,
-34079,
-34181,
+33775,
+31799,
+31168,
+34495,
+31926,
+33136,
+31539,
+32506,
+33834,
+31519,
+31859,
+35705,
+32092,
+31989,
+33854,
+32433,
+32498,
+34995,
+33454,
+31198,
+34214,
+33628,
+31779,
+35204,
+34650,
+30485,
+34900,
+34045,
+32288,
+33016,
+36794,
+32175,
+31089,
+35342,
+31499,
+35970,
+31169,
+32179,
+34927,
+30846,
+30597,
+34427,
+34893,
+28481,
+32577,
+32630,
+32570,
+31176,
+31110,
+35237,
+30170,
+31374,
+33021,
+32068,
 34261,
-34374,
-34418,
-34368,
-34258,
-34109,
-33997,
-33964,
-33998,
-34070,
-34113,
-34148,
-34187,
-34296,
-34518,
-34819,
-35165,
-35466,
-35710,
+30405,
+31204,
 35866,
-36019,
-36198,
-36368,
-36510,
-36502,
-36368,
-36166,
-36003,
-35954,
-35967,
+30439,
+32335,
+35928,
+34661,
+30985,
+34490,
+35558,
+31592,
+34860,
+33753,
+34366,
+33711,
+32603,
+34397,
+35843,
+32383,
+32784,
+33493,
+33537,
+33098,
+30404,
 35921,
-35664,
-35225,
-34717,
-34311,
-34135,
-34131,
-34182,
-34125,
-33889,
-33580,
-33222,
-32984,
-32786,
-32604,
-32440,
-32263,
-32176,
-32215,
-32369,
-32552,
-32707,
-32732,
-32635,
-32506,
-32347,
-32304,
-32267,
-32291,
-32238,
-32144,
-31979,
-31790,
-31632,
-31497,
-31363,
-31240,
-31080,
-30954,
-30874,
-30872,
-30954,
-31066,
-31159,
-31258,
-31322,
-31450,
-31571,
-31725,
-31797,
-31824,
-31795,
-31778,
-31843,
-31991,
-32207,
-32413,
-32552,
-32604,
-32563,
-32474,
-32386,
-32322,
-32326,
-32360,
-32432,
-32513,
-32547,
-32542,
-32454,
-32329,
-32179,
-32092,
-32038,
+32804,
+28884,
+32709,
+33341,
+30580,
+32751,
+32660,
+30109,
+35151,
+27630,
 32089,
-32145,
-32231,
-32285,
-32338,
-32381,
-32463,
-32489,
-32537,
-32511,
-32469,
-32403,
-32360,
-32300,
-32255,
-32149,
-31985,
-31797,
-31569,
-31358,
-31170,
-30989,
-30825,
-30635,
-30456,
-30289,
-30158,
-30078,
-30034,
-30056,
-30037,
-30016,
-29888,
-29718,
-29503,
-29288,
-29126,
-29003,
-28915,
-28837,
-28726,
-28623,
-28472,
-28340,
-28186,
-28026,
-27849,
-27647,
-27435,
-27178,
-26943,
-26684,
-26447,
-26184,
-25900,
-25587,
-25341,
-25207,
-25386,
-25824,
-26577,
-27424,
-28230,
-28781,
-29066,
-29086,
-29061,
-29076,
-29231,
-29519,
-29802,
-30093,
-30303,
-30514,
-30688,
-30764,
-30671,
-30338,
-29865,
-29534,
-29498,
-29980,
-30725,
-31570,
-32132,
-32323,
-32128,
-31726,
-31287,
-30952,
-30859,
-31003,
-31501,
-32253,
-33212,
-34201,
-35042,
-35632,
-35897,
-35912,
-35768,
-35588,
-35542,
-35674,
-36055,
-36578,
-37159,
-37619,
-37836,
-37739,
-37348,
-36748,
-36095,
-35562,
-35295,
-35381,
-35786,
-36443,
-37069,
-37600,
-37791,
-37741,
-37474,
-37122,
-36835,
-36641,
-36646,
-36798,
-37070,
-37419,
-37700,
-37888,
-37903,
-37765,
-37570,
-37324,
-37125,
-36941,
-36778,
-36634,
-36484,
-36306,
-36110,
-35805,
-35423,
-34946,
-34406,
-33901,
-33463,
-33125,
-32880,
-32673,
-32487,
-32325,
-32212,
-32205,
-32283,
-32416,
-32560,
-32586,
-32545,
-32355,
-32121,
-31817,
-31536,
-31289,
-31122,
-31081,
-31075,
-31106,
-31038,
-30833,
-30459,
-30006,
-29512,
-29152,
-28936,
-28895,
-29024,
-29141,
-29284,
-29243,
-29089,
-28795,
-28483,
-28234,
-28163,
-28301,
-28634,
-29117,
-29666,
-30202,
-30647,
-30967,
-31177,
-31313,
-31476,
-31681,
+36415,
+28601,
+31398,
+32838,
+32314,
+30645,
+33263,
+34257,
+30353,
+32116,
+33884,
+32525,
 32025,
-32418,
-32894,
-33282,
-33588,
-33741,
-33764,
-33712,
-33594,
-33513,
-33442,
-33478,
-33546,
-33759,
-34006,
-34320,
-34603,
-34821,
-34940,
-34997,
-35033,
-35088,
-35238,
-35400,
-35688,
-35900,
-36196,
-36408,
-36625,
-36785,
-36918,
-37041,
-37189,
-37344,
-37543,
-37712,
-37803,
-37795,
-37641,
-37430,
-37190,
-37028,
-36908,
-36875,
-36799,
-36691,
-36524,
-36267,
-36033,
-35809,
-35630,
-35542,
-35501,
-35581,
-35712,
-35872,
-36001,
-36035,
-35946,
-35726,
-35446,
-35136,
-34908,
-34727,
-34635,
-34606,
-34541,
-34454,
-34282,
-33999,
-33683,
-33304,
-32947,
-32629,
-32352,
-32147,
+33832,
+35549,
+29232,
+31392,
+36707,
+31372,
+31597,
+34503,
+32452,
+31753,
+32350,
+32351,
+35137,
+31109,
+31004,
+35152,
+30748,
+31906,
+33563,
+34775,
+31652,
+28451,
+37322,
+32217,
+29737,
+35578,
+34240,
+30870,
+31260,
+36146,
+33567,
+33231,
+33632,
+32309,
+33706,
+34197,
+34070,
+33312,
+32779,
+33291,
+32169,
+33809,
+34324,
+32422,
+34904,
+30439,
+31694,
+35208,
+32662,
+31778,
+31495,
+34120,
+30504,
+31164,
+34302,
+32471,
+30841,
+31604,
+32569,
+31363,
+32864,
+32394,
+32731,
+32360,
+30081,
+33592,
+33890,
 31980,
-31834,
-31642,
-31428,
-31116,
-30814,
-30519,
-30343,
-30232,
-30225,
-30203,
-30219,
-30186,
-30207,
-30227,
-30310,
-30346,
-30405,
-30427,
-30447,
-30479,
-30510,
-30493,
-30443,
-30335,
-30214,
-30183,
-30163,
-30274,
-30370,
-30475,
-30518,
-30503,
-30466,
-30410,
-30400,
-30424,
-30517,
-30661,
-30836,
-31039,
-31212,
-31352,
-31433,
-31483,
-31533,
-31613,
-31771,
-31984,
-32235,
-32476,
-32713,
-32880,
-33054,
-33157,
-33254,
-33301,
-33309,
-33307,
-33296,
-33319,
-33381,
-33470,
-33602,
-33682,
-33763,
-33762,
-33719,
-33729,
-33744,
-33905,
-34109,
-34337,
-34538,
-34634,
-34666,
-34654,
-34661,
-34736,
-34821,
-34959,
-35015,
-35050,
-35015,
-34976,
-34924,
-34921,
-34913,
-34919,
-34891,
-34841,
-34756,
-34628,
-34496,
-34327,
-34191,
-34056,
-33957,
-33896,
-33831,
-33752,
-33677,
-33576,
-33547,
-33558,
-33630,
-33747,
-33836,
-33886,
-33915,
-33855,
-33854,
-33814,
-33811,
-33802,
-33747,
-33661,
-33536,
-33359,
-33241,
+31671,
+34570,
+32869,
+31661,
+34285,
+32047,
+33304,
+34273,
+33875,
 33097,
-33037,
-32954,
-32878,
-32761,
-32627,
-32497,
-32380,
-32303,
-32248,
-32187,
-32136,
-32059,
-32004,
+32513,
+35187,
+32642,
+33479,
+33648,
+32663,
+34145,
+29841,
+34874,
+36079,
+32309,
+31693,
+32265,
+35368,
+29736,
+33420,
+36716,
+29872,
+32330,
+31954,
+32911,
 31950,
-31936,
-31970,
-31996,
-32095,
-32160,
-32255,
+30885,
+33765,
+30375,
+31783,
+33506,
+32083,
+30982,
+31782,
+33777,
+30565,
+31430,
+34214,
+31708,
+31856,
+33483,
+32301,
+29645,
+33894,
+33471,
+30977,
+32040,
+33926,
+34005,
+29426,
+31101,
+32838,
+34742,
+30982,
+30706,
+35370,
+32478,
+30086,
+32235,
+37252,
+30731,
+29997,
+34851,
+33093,
+33897,
+33398,
+35493,
+32539,
+32019,
+34839,
+33000,
+35100,
+36350,
+32768,
+32218,
+34678,
+33239,
+34301,
+35330,
+33067,
+32566,
+33811,
+33963,
+33595,
+35285,
+33207,
+31335,
+31850,
+33525,
+34720,
+33850,
+32735,
+31832,
+32335,
+32508,
+31316,
+33960,
+34167,
+30721,
+31346,
+34383,
+33957,
+32762,
+33664,
+32282,
+30556,
+32899,
+34517,
+33189,
+33769,
+30950,
+32415,
+32708,
+32957,
+33687,
+32041,
 32365,
-32442,
-32547,
-32629,
-32716,
-32805,
-32861,
-32905,
-32896,
-32833,
-32753,
-32636,
-32532,
-32453,
-32354,
-32293,
-32203,
-32123,
-32056,
-31995,
-31982,
-31961,
+29797,
+33079,
+35963,
+30737,
+32685,
+31912,
+30865,
+32900,
+33269,
+34609,
+31758,
+30945,
+32151,
+32759,
+33028,
+34830,
+33227,
+31330,
+31531,
+33135,
+34502,
+33902,
+32493,
+32719,
+32789,
+30483,
+33267,
+35923,
+32822,
+30403,
+30574,
+33051,
+31523,
+31483,
+32998,
+31663,
+29291,
+30117,
+33125,
 31956,
-31924,
-31913,
-31920,
-31940,
-31969,
-31999,
-32015,
-32034,
-32066,
-32128,
-32216,
-32299,
-32377,
-32418,
+32664,
+30235,
+30409,
+32246,
+30413,
+32230,
+34519,
+33026,
+28928,
+32236,
+33877,
+32758,
+32538,
+31230,
+32986,
+32569,
+32598,
+33298,
+35259,
+31910,
+29927,
+33215,
+34196,
+33904,
+34547,
+34433,
+30369,
+33019,
+35315,
 32453,
-32460,
-32485,
-32511,
-32577,
-32651,
-32738,
-32785,
-32791,
-32718,
-32611,
-32505,
-32480,
-32509,
-32622,
-32743,
-32838,
-32904,
-32914,
-32924,
-32961,
-33001,
-33094,
-33168,
-33282,
-33394,
-33502,
-33614,
-33643,
-33628,
-33524,
-33376,
-33256,
-33143,
-33127,
-33123,
+32425,
+34078,
+33461,
+30938,
+33221,
+35746,
+33346,
+31438,
+30975,
+32563,
+34354,
+32615,
+33817,
+33424,
+31551,
+33007,
+32461,
+33128,
+34406,
+34610,
+32391,
+31587,
+35212,
+35522,
+33513,
+31606,
+33477,
+34141,
+33215,
+34730,
+34089,
+34828,
+34180,
+31968,
+33241,
+34335,
+33965,
+33237,
+32712,
+33307,
+33786,
+31106,
+31553,
+32358,
+31464,
+32173,
+31232,
+30951,
+32266,
+33287,
+32368,
+30118,
+31683,
+32559,
+30785,
 33140,
-33098,
-33061,
-32945,
-32876,
-32750,
-32662,
-32511,
-32401,
-32291,
-32212,
-32210,
-32158,
-32153,
-32046,
-31949,
-31820,
-31734,
-31710,
-31745,
-31772,
-31806,
-31768,
-31708,
-31646,
-31558,
-31523,
-31458,
-31419,
-31348,
-31260,
-31120,
-30966,
-30757,
-30576,
-30377,
-30269,
-30185,
-30191,
-30217,
-30279,
-30318,
-30358,
-30367,
-30360,
-30381,
-30353,
-30398,
-30428,
-30540,
-30653,
-30814,
-30916,
-31018,
-31029,
-31042,
-30997,
-31038,
-31072,
-31191,
-31293,
-31383,
-31446,
-31429,
-31427,
-31402,
-31390,
-31398,
-31406,
-31407,
-31428,
-31454,
-31497,
-31592,
-31714,
-31847,
-31988,
-32109,
-32219,
-32340,
-32468,
-32625,
-32783,
+33826,
+33836,
+32051,
+30846,
+33282,
+33611,
+33964,
+33209,
+32701,
+33408,
+32523,
+33966,
+35493,
+33454,
+32215,
+33010,
+32960,
+31625,
+34632,
+35473,
+31343,
+31489,
+33434,
+33081,
+31643,
 32911,
+33811,
+30838,
+30889,
+33770,
+33348,
+32139,
+31828,
+31912,
+31954,
+31658,
+32438,
+34184,
+32223,
+32261,
+33040,
+32104,
+32786,
+32160,
+33402,
+34016,
+31443,
+32289,
+33835,
+31867,
+31816,
+32969,
+32808,
+31218,
+31278,
+34807,
+32839,
+31319,
+32936,
+31447,
+31525,
+31706,
+33794,
+33811,
+31371,
+30943,
+32260,
+33027,
+32298,
+33038,
+32958,
+32397,
+32254,
+32396,
+33339,
+33727,
+33080,
+32350,
+32318,
+33919,
+34541,
+34389,
+33049,
+32490,
+33287,
+33096,
+33355,
+34457,
+34581,
+33121,
+33655,
+32555,
+32475,
+33938,
+33677,
+32748,
+31841,
+33147,
 33011,
-33055,
-33108,
-33129,
-33199,
-33247,
-33309,
-33326,
-33331,
-33326,
-33316,
-33329,
-33328,
-33352,
-33335,
-33359,
-33359,
-33386,
-33387,
-33360,
-33286,
-33190,
-33088,
-33012,
-33001,
-33041,
-33141,
-33250,
-33346,
-33393,
-33399,
-33352,
-33327,
-33296,
-33347,
-33397,
-33502,
-33551,
-33560,
-33483,
-33353,
-33190,
-33057,
+32029,
+32329,
+32252,
+32098,
+31111,
+31112,
+33084,
 32941,
-32868,
-32821,
-32749,
-32688,
-32569,
-32467,
-32337,
-32258,
-32202,
-32193,
-32234,
-32249,
-32303,
-32272,
-32255,
-32213,
-32218,
-32233,
-32343,
-32433,
-32542,
-32632,
-32656,
-32717,
-32749,
-32795,
-32835,
-32822,
-32756,
-32648,
-32529,
-32432,
-32406,
-32383,
-32404,
-32344,
-32260,
-32102,
-31977,
-31861,
-31817,
-31840,
-31882,
-31976,
-32039,
+32709,
+31676,
+31159,
+32326,
+31846,
+32968,
+33602,
+32419,
+32239,
+31994,
+32097,
+33322,
+33555,
+32679,
+32084,
+32860,
+33042,
+33057,
+34116,
+32919,
+32074,
 32091,
-32124,
-32143,
-32155,
+33183,
+34376,
+33301,
+33378,
+33089,
+31863,
+32142,
+33263,
+33937,
+33276,
+32641,
 32197,
-32242,
-32293,
-32366,
+33270,
+32838,
+32694,
+33524,
+31931,
+31942,
+32539,
+33743,
+34505,
+33509,
+32226,
+32765,
+32519,
+32730,
+34038,
+33880,
+33308,
+32260,
+32878,
+33586,
+33248,
+33127,
+33498,
+32763,
+32398,
+32852,
+34062,
+33710,
+32460,
+32552,
+32094,
+32541,
+33149,
+33232,
+32816,
+32325,
+31958,
+32157,
+32631,
+32746,
+32440,
+32139,
+31495,
+31982,
+32370,
+32159,
+32313,
+31396,
+31634,
+31514,
+31748,
+32436,
+31891,
+31428,
+31584,
+31784,
+30937,
+32436,
+33585,
+31602,
+32177,
+33146,
+32337,
+32390,
+32775,
+33121,
+32932,
+32940,
+33442,
+33174,
+33233,
+34107,
+33165,
+33422,
+34143,
+33738,
+33666,
+33474,
+33841,
+33496,
+32988,
+33377,
+33759,
+33221,
+33680,
+33689,
+33115,
+33173,
+33555,
+33647,
+33258,
+33565,
+33751,
+33467,
+32917,
+33699,
+33971,
+33284,
+33982,
+33933,
+33866,
+33777,
+34247,
+34102,
+33904,
+34476,
+33901,
+34146,
+33538,
+33804,
+34144,
+33705,
+33020,
+32861,
+33438,
+32704,
+32758,
+32952,
+32147,
+31334,
+30977,
+31292,
+31162,
+30997,
+30829,
+30116,
+30091,
+30095,
+29905,
+29827,
+29209,
+28562,
+28549,
+28457,
+28836,
+29454,
+28534,
+27528,
+27595,
+27345,
+27105,
+27766,
+27598,
+28346,
+30869,
+30978,
+30296,
+29418,
+29230,
+29849,
+30524,
+32170,
+33867,
+34516,
+33698,
+34012,
+35311,
+35533,
+35886,
+36507,
+37064,
+38591,
+39073,
+38874,
+39607,
+40206,
+38984,
+38518,
+39997,
+41252,
+41082,
+40922,
+40339,
+39251,
+38912,
+38261,
+38495,
+38671,
+38715,
+37118,
+36067,
+35619,
+34604,
+33873,
+33255,
+33506,
+32527,
+32550,
+32875,
+31891,
+31356,
+30595,
+29456,
+29728,
+30686,
+30582,
+30888,
+30561,
+30087,
+29897,
+29775,
+29922,
+30528,
+30467,
+30029,
+30041,
+30031,
+30135,
+30454,
+30730,
+30087,
+30017,
+29516,
+29133,
+28919,
+28983,
+29036,
+28145,
+27403,
+27197,
+27547,
+26765,
+25628,
+24458,
+25640,
+28325,
+29024,
+28807,
+27257,
+25272,
+25948,
+27565,
+28039,
+29960,
+31437,
+30135,
+29744,
+32680,
+34094,
+33430,
+34146,
+34898,
+36061,
+37494,
+38617,
+40247,
+40685,
+39423,
+38457,
+39718,
+41605,
+42657,
+42643,
+41738,
+40746,
+39982,
+39396,
+39415,
+39840,
+38809,
+38105,
+36883,
+36408,
+36319,
+34808,
+33410,
+32039,
+31582,
+31621,
+31971,
+31269,
+30650,
+29854,
+29130,
+29060,
+29765,
+30409,
+29701,
+29645,
+29662,
+30773,
+31171,
+31301,
+31374,
+30774,
+31720,
+32493,
+33391,
+33795,
+33648,
+34242,
+34359,
+34559,
+35150,
+35277,
+35662,
+35191,
+34439,
+34650,
+35040,
+35207,
+34892,
+33856,
+32991,
+33085,
+33408,
+32733,
+32468,
+32320,
+30907,
+29763,
+29399,
+30007,
+29686,
+28309,
+27090,
+26434,
+26000,
+25732,
+24126,
+22666,
+24063,
+26264,
+27416,
+26107,
+25009,
+24458,
+23900,
+24935,
+26048,
+28214,
+29567,
+29151,
+29257,
+31303,
+33271,
+32831,
+33235,
+35138,
+37480,
+38524,
+38835,
+40682,
+42171,
+41392,
+40517,
+41654,
+43639,
+44653,
+44809,
+44492,
+43317,
+42379,
+41084,
+39949,
+40224,
+40560,
+39510,
+37744,
+35905,
+34233,
+33006,
+31715,
+30707,
+29872,
+29317,
+28825,
+28007,
+27030,
+26579,
+25864,
+24329,
+24194,
+25353,
+27444,
+28388,
+28166,
+27998,
+28328,
+28371,
+29348,
+31688,
+33757,
+34906,
+34980,
+35124,
+35260,
+36792,
+38208,
+38948,
+39240,
+39664,
+40202,
+40312,
+40462,
+40302,
+39261,
+38443,
+38297,
+37547,
+37488,
+37039,
+35102,
+33227,
+31545,
+30557,
+30257,
+29205,
+28401,
+26993,
+25609,
+25087,
+23426,
+22691,
+22546,
+21360,
+20405,
+19615,
+19570,
+20663,
+21979,
+23370,
+24173,
+22937,
+22184,
+23535,
+25363,
+26720,
+28191,
+29853,
+30566,
+31269,
+32970,
+35227,
+36559,
+36735,
+37359,
+39184,
+40676,
+41964,
+43101,
+43622,
+43987,
+43463,
+43116,
+44200,
+45238,
+45326,
+44584,
+43272,
+42005,
+40867,
+40158,
+39573,
+38705,
+37838,
+36318,
+34804,
+33515,
+31844,
+31149,
+30360,
+28877,
+28187,
+28169,
+28016,
+27412,
+26930,
+26342,
+25728,
+25153,
+25747,
+27875,
+28746,
+29697,
+30430,
+29453,
+30940,
+32633,
+32507,
+33897,
+35389,
+36516,
+37194,
+37682,
+38630,
+38785,
+38803,
+38798,
+39772,
+40977,
+40808,
+40641,
+39799,
+38911,
+38700,
+37398,
+37509,
+37440,
+35546,
+34279,
+32361,
+31598,
+30639,
+28848,
+28154,
+26691,
+25749,
+24826,
+23719,
+23341,
+22275,
+21104,
+20030,
+19757,
+19833,
+18818,
+18429,
+19120,
+20489,
+23111,
+24222,
+22666,
+22506,
+23278,
+23900,
+25965,
+28330,
+30062,
+30911,
+31184,
+32113,
+34217,
+35506,
+36051,
+37163,
+38478,
+39504,
+40968,
+42549,
+43329,
+43380,
+42698,
+42099,
+43131,
+45198,
+45729,
+44991,
+43127,
+41407,
+40619,
+40266,
+40503,
+40153,
+38679,
+36929,
+35357,
+34084,
+33803,
+33352,
+32054,
+30664,
+29595,
+29870,
+30719,
+30418,
+29484,
+28665,
+27182,
+26760,
+28415,
+30460,
+31601,
+31617,
+31701,
+31113,
+31845,
+33979,
+34427,
+34652,
+35179,
+35675,
+37092,
+38358,
+38496,
+38387,
+37965,
+37139,
+38047,
+39655,
+39415,
+39026,
+37993,
+36415,
+36558,
+36420,
+35483,
+35269,
+33896,
+32103,
+30791,
+29865,
+29710,
+28512,
+26652,
+24751,
+24228,
+23999,
+23559,
+23076,
+21800,
+20740,
+19842,
+19484,
+19839,
+19453,
+18842,
+19404,
+20767,
+23766,
+25856,
+25150,
+23983,
+23851,
+25323,
+27759,
+30229,
+32267,
+33269,
+33604,
+34377,
+35726,
+37467,
+38633,
+39499,
+40579,
+41385,
+42645,
+44368,
+45052,
+44544,
+43700,
+43009,
+44061,
+45253,
+45424,
+45042,
+43476,
+41043,
+39576,
+39277,
+38816,
+38516,
+37316,
+34970,
+33339,
+32514,
+31429,
+30549,
+29586,
+28546,
+27887,
+27974,
+28238,
+28350,
+27766,
+26539,
+25863,
+25572,
+26917,
+28977,
+30373,
+30698,
+30810,
+31299,
+31013,
+31867,
+33235,
+34583,
+35827,
+36253,
+37184,
+38223,
+38448,
+38011,
+38449,
+38270,
+38275,
+39323,
+39637,
+39741,
+38925,
+37365,
+36548,
+36704,
+36035,
+35499,
+34733,
+33149,
+31764,
+30394,
+29536,
+28898,
+27388,
+25619,
+24637,
+24211,
+24453,
+23455,
+22082,
+21101,
+20175,
+20152,
+20113,
+19914,
+19457,
+19119,
+20055,
+22916,
+25725,
+25753,
+24299,
+23817,
+24956,
+27293,
+29792,
+31816,
+32598,
+32707,
+33729,
+35645,
+37922,
+39065,
+39198,
+40075,
+40871,
+42307,
+44200,
+45649,
+46081,
+44543,
+43520,
+44133,
+45468,
+46657,
+45965,
+44249,
+42426,
+40708,
+39941,
+39600,
+39338,
+38223,
+35849,
+33823,
+32947,
 32390,
-32401,
-32405,
-32354,
-32336,
-32293,
-32245,
-32236,
-32199,
-32159,
-32108,
-31975,
-31856,
-31677,
-31568,
-31464,
-31417,
-31388,
-31336,
-31287,
-31185,
-31098,
-30994,
-30904,
-30838,
-30772,
-30734,
-30708,
-30689,
-30685,
-30672,
-30630,
-30624,
-30581,
-30619,
-30684,
-30785,
-30942,
-31125,
-31317,
-31541,
-31716,
-31924,
-32053,
-32184,
-32295,
-32418,
-32584,
-32775,
-32982,
-33140,
-33242,
-33286,
-33252,
-33288,
-33307,
-33455,
-33614,
-33827,
-34006,
-34168,
-34242,
-34296,
-34301,
-34332,
-34359,
-34445,
-34545,
-34665,
-34798,
-34914,
-35033,
-35135,
-35220,
-35303,
-35366,
-35441,
-35522,
-35642,
-35734,
-35866,
-35959,
-36041,
-36097,
-36164,
-36197,
-36302,
-36359,
-36459,
-36512,
-36554,
-36587,
-36623,
-36712,
-36796,
-36955,
-37071,
-37218,
-37291,
-37343,
-37331,
-37298,
-37243,
-37191,
-37182,
-37179,
-37223,
-37233,
-37237,
-37197,
-37135,
-37043,
-36973,
-36879,
-36825,
-36747,
-36692,
-36612,
-36543,
-36451,
-36345,
-36187,
-35990,
-35748,
-35491,
-35264,
-35058,
-34929,
-34822,
-34734,
-34642,
-34499,
-34354,
-34165,
-34021,
-33869,
-33760,
-33612,
-33483,
-33281,
-33086,
-32876,
-32681,
-32511,
-32369,
-32198,
-32062,
-31868,
-31677,
-31496,
-31295,
-31146,
-30989,
-30857,
-30734,
-30594,
-30480,
-30336,
-30217,
-30075,
-29951,
-29837,
-29748,
-29656,
-29616,
-29574,
-29576,
-29633,
-29691,
-29809,
-29918,
-30025,
-30118,
-30178,
-30209,
-30255,
-30277,
-30352,
-30464,
-30601,
-30769,
-30892,
-30983,
-31004,
-31007,
-31004,
-31054,
-31177,
-31310,
-31535,
-31659,
-31834,
-31900,
-31981,
-32058,
-32121,
-32226,
-32285,
-32371,
-32393,
-32479,
-32529,
-32635,
-32742,
-32860,
-33001,
-33105,
-33214,
-33278,
-33336,
-33367,
-33400,
-33455,
-33494,
+31395,
+30306,
+28860,
+27565,
+27550,
+28156,
+28009,
+27575,
+27084,
+25768,
+25082,
+25882,
+27162,
+28798,
+30096,
+29547,
+30500,
+31140,
+31486,
+33363,
 33582,
-33630,
-33706,
-33727,
-33749,
-33753,
-33742,
-33748,
-33728,
-33753,
-33749,
+34886,
+36038,
+36377,
+37296,
+38286,
+39141,
+39168,
+39098,
+38497,
+38769,
+39638,
+39706,
+39139,
+38511,
+37542,
+36725,
+36149,
+35313,
+34987,
+33849,
+32235,
+30848,
+29219,
+28899,
+27774,
+26283,
+25417,
+24146,
+23554,
+23114,
+22644,
+21534,
+20779,
+20709,
+19348,
+18858,
+19407,
+18548,
+18950,
+20868,
+24014,
+26323,
+25417,
+24133,
+23964,
+25213,
+27534,
+30076,
+31921,
+32970,
+33721,
+34687,
+36219,
+37825,
+38665,
+39303,
+40404,
+41687,
+43612,
+44906,
+45676,
+46015,
+44966,
+43988,
+44466,
+45995,
+46676,
+45949,
+44565,
+42505,
+40481,
+39600,
+39162,
+38645,
+37674,
+36041,
+34261,
+32668,
+31508,
+30694,
+29750,
+28149,
+27291,
+27456,
+27707,
+28006,
+27318,
+26542,
+25908,
+25270,
+25651,
+27341,
+28888,
+29889,
+30746,
+30798,
+31551,
+32304,
+33643,
+35321,
+36124,
+37508,
+38536,
+39162,
+39439,
+39748,
+40732,
+40817,
+40537,
+40629,
+41300,
+41443,
+40392,
+39236,
+38519,
+37803,
+36996,
+36154,
+35169,
+34538,
+32726,
+30536,
+29140,
+27991,
+26990,
+25357,
+24078,
+23183,
+22239,
+21677,
+20960,
+20046,
+19399,
+18795,
+18122,
+17842,
+17737,
+17391,
+16467,
+17623,
+21059,
+24625,
+25987,
+24574,
+23565,
+23902,
+25999,
+28773,
+31379,
+33354,
+34045,
+34728,
+35992,
+38411,
+40068,
+40420,
+41459,
+42699,
+43798,
+45151,
+46724,
+47665,
+47208,
+45350,
+44387,
+45189,
+46070,
+46052,
+45006,
+43252,
+40966,
+38939,
+37905,
+37431,
+36793,
+35464,
+33573,
+31751,
+30166,
+29689,
+29020,
+27516,
+26327,
+25622,
+26001,
+26550,
+26971,
+27477,
+27022,
+25830,
+25199,
+25945,
+27887,
+30082,
+31168,
+32025,
+32845,
+33255,
+34595,
+35205,
+35818,
+38143,
+39391,
+39945,
+40993,
+41403,
+41553,
+41303,
+40302,
+39731,
+40591,
+41574,
+41509,
+40624,
+38868,
+37189,
+36175,
+35260,
+34950,
+34720,
+33641,
+32021,
+30174,
+28786,
+27985,
+26929,
+25325,
+24012,
+23223,
+23306,
+23667,
+23439,
+22899,
+21805,
+20180,
+19595,
+20262,
+20735,
+20618,
+19891,
+18809,
+19930,
+24471,
+28034,
+28083,
+26260,
+24556,
+25089,
+27232,
+29690,
+32679,
+34299,
+33492,
+33451,
+35525,
+37493,
+38489,
+39526,
+40765,
+41324,
+41236,
+41868,
+43959,
+45520,
+45030,
+42981,
+41579,
+41993,
+42679,
+42837,
+42732,
+41772,
+39457,
+36766,
+35153,
+34725,
+35297,
+35409,
+33702,
+31355,
+29553,
+28385,
+27828,
+27385,
+26742,
+26627,
+26480,
+26352,
+26877,
+28112,
+28893,
+27717,
+25991,
+25752,
+27837,
+30781,
+32601,
 33813,
-33862,
-33931,
-34002,
-34008,
-34025,
-33977,
-33944,
-33910,
-33902,
-33900,
-33922,
-33894,
-33867,
-33823,
-33745,
-33740,
-33674,
-33665,
-33635,
-33582,
-33534,
+34063,
+34252,
+35125,
+35997,
+37919,
+39530,
+40631,
+41437,
+41759,
+43071,
+43694,
+42949,
+41530,
+40721,
+41170,
+41772,
+41589,
+40838,
+40267,
+38869,
+36594,
+34816,
+34143,
+34026,
+33275,
+31849,
+30153,
+28474,
+26986,
+26100,
+25064,
+24219,
+23623,
+22480,
+21625,
+21533,
+21951,
+22059,
+21762,
+20747,
+19830,
+19939,
+20819,
+21107,
+20417,
+19489,
+19312,
+23181,
+28684,
+30560,
+29888,
+27873,
+26539,
+27285,
+29270,
+32858,
+36074,
+36530,
+35548,
+36546,
+38686,
+39657,
+40397,
+41147,
+42001,
+42221,
+41790,
+42962,
+45373,
+45701,
+43511,
+41007,
+40119,
+40967,
+41842,
+42362,
+41959,
+40259,
+37563,
+34921,
+34139,
+34336,
+35323,
+35187,
+32815,
+30719,
+29098,
+28579,
+28640,
+27974,
+27605,
+27552,
+27093,
+27240,
+28048,
+29234,
+29339,
+27568,
+26220,
+26748,
+29054,
+31517,
 33470,
-33398,
-33357,
-33297,
-33256,
-33178,
-33109,
-33005,
-32925,
-32837,
-32788,
-32715,
-32663,
-32568,
-32483,
-32385,
-32324,
-32255,
-32188,
-32087,
-31931,
-31751,
-31595,
-31509,
-31516,
-31632,
-31754,
-31828,
-31825,
-31696,
-31533,
-31401,
-31298,
-31318,
-31349,
-31420,
-31405,
-31387,
-31293,
-31230,
-31158,
-31105,
-31035,
-30960,
-30906,
-30872,
-30947,
-31071,
-31234,
-31365,
-31398,
-31363,
-31285,
-31199,
-31220,
-31251,
-31393,
-31488,
-31625,
-31704,
-31837,
-31933,
-32098,
-32197,
-32302,
-32306,
-32304,
-32289,
-32302,
-32406,
-32518,
-32710,
-32804,
-32885,
-32825,
-32736,
-32621,
-32504,
+34224,
+33955,
+33426,
+33753,
+35232,
+37441,
+39512,
+39795,
+39422,
+39500,
+40575,
+41331,
+40796,
+39614,
+38699,
+38732,
+38944,
+39120,
+38902,
+37960,
+36024,
+33759,
+32503,
+32329,
+32698,
 32456,
-32423,
-32502,
-32566,
-32716,
-32848,
-32997,
-33074,
-33124,
-33079,
-32999,
-32905,
-32842,
-32844,
-32928,
-33055,
-33223,
-33328,
-33388,
-33358,
-33293,
-33188,
-33137,
-33110,
-33168,
-33282,
-33399,
-33520,
-33584,
-33597,
-33541,
-33452,
-33319,
-33244,
-33180,
-33209,
-33231,
-33286,
-33290,
-33269,
-33234,
-33186,
-33199,
-33224,
-33283,
-33324,
-33345,
-33308,
-33277,
-33210,
-33175,
-33142,
-33095,
-33028,
-32943,
-32837,
-32741,
-32668,
-32596,
-32578,
-32509,
-32463,
-32390,
-32316,
-32273,
-32250,
-32261,
-32258,
-32245,
-32183,
-32075,
-31977,
-31856,
-31850,
-31848,
-31965,
-32047,
-32148,
-32187,
-32143,
-32080,
-31955,
-31883,
-31839,
-31842,
-31884,
-31919,
-31898,
-31820,
-31661,
-31460,
-31245,
-31081,
-30903,
-30830,
-30725,
-30672,
-30621,
-30550,
-30525,
-30477,
-30456,
-30408,
-30365,
-30275,
-30170,
-30068,
-29940,
-29911,
-29851,
-29898,
-29899,
-29920,
-29879,
-29810,
-29694,
-29619,
-29520,
-29464,
-29404,
-29331,
-29248,
-29117,
-29019,
-28924,
-28912,
-29016,
-29175,
-29478,
-29799,
-30209,
-30584,
-30998,
-31353,
-31723,
-32051,
-32345,
-32623,
-32849,
-33046,
-33215,
-33357,
-33503,
-33620,
-33714,
-33786,
-33770,
-33756,
-33692,
-33701,
-33748,
-33913,
-34104,
-34379,
-34580,
-34761,
-34807,
-34793,
-34708,
-34612,
-34569,
-34590,
-34730,
-34979,
-35291,
-35655,
-35950,
-36191,
-36262,
-36249,
-36096,
-35957,
-35855,
-35881,
-36021,
-36268,
-36531,
-36747,
-36821,
-36759,
-36529,
-36264,
-35965,
-35760,
-35675,
-35735,
-35892,
-36121,
-36327,
-36473,
-36510,
-36421,
-36258,
-36061,
-35836,
-35720,
-35593,
-35578,
-35565,
-35565,
-35559,
-35489,
-35401,
-35246,
-35055,
-34831,
-34605,
-34398,
-34257,
-34182,
-34152,
-34127,
-34034,
-33863,
-33606,
-33269,
-32962,
-32660,
-32472,
-32336,
-32263,
-32188,
-32100,
-31974,
-31849,
-31732,
-31653,
+31236,
+29740,
+28255,
+27040,
+26507,
+26229,
+25895,
+25519,
+24647,
+23819,
+23918,
+24290,
+24518,
+24439,
+23843,
+23285,
+23179,
+23680,
+24401,
+23878,
+22592,
+21483,
+22342,
+27121,
+31336,
+32470,
+30827,
+27609,
+26404,
+26799,
+28832,
+32009,
+34659,
+35442,
+35031,
+35827,
+36633,
+37004,
+37538,
+38264,
+38758,
+38487,
+38723,
+41445,
+43887,
+43184,
+40730,
+38155,
+37725,
+38705,
+40505,
+42411,
+42219,
+40363,
+37438,
+35044,
+34478,
+35501,
+36905,
+36260,
+33994,
+31912,
+31120,
+31574,
+31501,
+30663,
+29918,
+28957,
+28625,
+29570,
+31219,
+32350,
+31501,
+29477,
+28091,
+28723,
+31152,
+33519,
+34796,
+35186,
+35019,
+34683,
+34427,
+35068,
+37197,
+38427,
+38719,
+38681,
+38549,
+39218,
+39545,
+39182,
+38110,
+37052,
+36424,
+36338,
+36839,
+36730,
+35909,
+34093,
+32116,
+31065,
+30558,
+30420,
+30029,
+29459,
+28714,
+28103,
+27311,
+26563,
+26231,
+25838,
+25887,
+26466,
+26731,
+26146,
+25671,
+25559,
+25813,
+26494,
+27087,
+27324,
+27239,
+26975,
+26568,
+26438,
+25594,
+24145,
+22950,
+24288,
+29164,
+32824,
+33442,
+31130,
+27735,
+26288,
+26292,
+27998,
+31294,
+34017,
+34823,
+35397,
+36398,
+36360,
+35955,
+35954,
+36186,
+36251,
+36463,
+38116,
+41338,
+43230,
+42460,
+40519,
+38263,
+37638,
+38099,
+39787,
+41847,
+41951,
+41021,
+39127,
+36930,
+35317,
+35030,
+35478,
+34919,
+33798,
+32755,
+32410,
+32504,
+31734,
+30612,
+29671,
+28484,
+28199,
+29011,
+30119,
+31539,
+31965,
+31000,
+29602,
+29250,
+30566,
+32392,
+34051,
+35314,
+35934,
+35942,
+35536,
+36067,
+37040,
+37521,
+38519,
+38956,
+39417,
+40189,
+40346,
+39973,
+39065,
+37880,
+36444,
+35409,
+34856,
+35133,
+35495,
+34790,
+33515,
+31568,
+29678,
+28468,
+27890,
+27797,
+28111,
+28268,
+27949,
+27764,
+27308,
+26806,
+26446,
+26323,
+26477,
+26669,
+27076,
+27430,
+27795,
+28074,
+28201,
+28537,
+28248,
+27823,
+27660,
+27450,
+27761,
+26861,
+25465,
+24130,
+24219,
+27950,
 31601,
-31584,
-31552,
-31509,
-31428,
-31291,
-31146,
-30980,
-30794,
-30645,
-30471,
-30346,
-30179,
-30052,
-29866,
-29689,
-29508,
-29319,
-29184,
+33024,
+31899,
+29604,
+28182,
+27316,
+27716,
+29727,
+32091,
+33209,
+33988,
+35393,
+36239,
+35850,
+35383,
+35540,
+35701,
+35554,
+36030,
+38447,
+41300,
+42552,
+42233,
+40584,
+38873,
+38253,
+38690,
+39680,
+40487,
+41159,
+41075,
+39614,
+37493,
+36025,
+35795,
+35694,
+34408,
+32804,
+31859,
+31613,
+31692,
+31309,
+31015,
+30549,
+29131,
+27705,
+27213,
+28025,
+29532,
+30662,
+31058,
+31121,
+31203,
+31402,
+32002,
+32892,
+33844,
+34578,
+34665,
+34685,
+35578,
+36677,
+37096,
+37426,
+37711,
+37708,
+37404,
+37331,
+37233,
+36851,
+36418,
+35517,
+34765,
+34312,
+33877,
+33276,
+32468,
+31565,
+30806,
+30329,
+30226,
+30260,
+30099,
+29942,
+29748,
+29419,
 29096,
-29064,
-29071,
-29126,
+28908,
+29292,
+29627,
+29131,
+28656,
+28740,
+29220,
+29450,
+29326,
+28973,
+28461,
+28054,
+27814,
+27975,
+28247,
+28500,
+28369,
+27640,
+26972,
+25674,
+24213,
+22563,
+22524,
+26377,
+30091,
+31879,
+31904,
+30443,
+29613,
+28798,
+28264,
+29340,
+30923,
+32380,
+34460,
+37308,
+39112,
+39454,
+39407,
+39206,
+38707,
+37947,
+38161,
+40548,
+43023,
+44678,
+45662,
+44909,
+43521,
+41942,
+40906,
+40851,
+40762,
+41013,
+41121,
+40240,
+38574,
+36895,
+35874,
+34801,
+33073,
+31078,
 29105,
-29152,
-29055,
-29049,
-28966,
-28978,
-29030,
-29161,
-29368,
-29589,
-29868,
-30125,
-30391,
-30637,
-30846,
-31070,
-31251,
-31450,
-31650,
-31868,
-32122,
-32345,
-32579,
-32746,
-32863,
-32895,
-32891,
-32842,
-32843,
-32867,
-32967,
-33143,
-33356,
-33587,
-33822,
-33980,
-34109,
-34166,
-34192,
-34202,
-34245,
-34293,
-34430,
-34546,
-34705,
-34840,
-34937,
-35000,
-35040,
-35055,
-35057,
-35105,
-35113,
-35192,
-35224,
-35284,
-35295,
-35283,
-35211,
-35123,
-34983,
-34857,
-34740,
-34657,
-34618,
-34574,
-34557,
-34495,
-34461,
-34409,
-34380,
-34406,
-34425,
-34487,
-34510,
-34484,
-34423,
-34304,
-34147,
-34021,
-33874,
-33783,
-33681,
-33609,
-33514,
-33445,
-33316,
-33210,
-33045,
-32885,
-32727,
-32591,
-32505,
-32479,
-32477,
-32495,
-32470,
-32381,
-32239,
-32067,
-31916,
-31855,
-31857,
-31942,
-32032,
-32107,
-32124,
-32089,
-32043,
-31972,
-31993,
-32007,
-32090,
-32154,
-32185,
-32208,
-32153,
-32125,
-32050,
-32021,
-31976,
-31958,
-31961,
-31948,
-31952,
-31938,
-31939,
-31919,
-31939,
-31960,
-32038,
-32081,
-32193,
-32211,
-32296,
-32299,
-32350,
-32397,
-32443,
-32517,
-32567,
-32594,
-32623,
-32653,
-32699,
-32800,
-32905,
-33000,
-33055,
-33022,
-32964,
-32867,
-32814,
-32792,
-32825,
-32868,
-32890,
-32848,
-32761,
-32627,
-32519,
-32433,
-32411,
-32432,
-32480,
-32541,
-32575,
-32602,
-32621,
-32637,
-32624,
-32648,
-32614,
-32645,
+27935,
+27510,
+27469,
+27971,
+27799,
+26892,
+25971,
+25248,
+25438,
+26346,
+27230,
+28104,
+28661,
+28834,
+29336,
+30582,
+32059,
+33400,
+34078,
+34039,
+34244,
+34882,
+35837,
+37007,
+37915,
+38041,
+37565,
+36599,
+36289,
+37178,
+37829,
+38055,
+37211,
+35873,
+34964,
+34272,
+34013,
+34099,
+33743,
+32799,
+31911,
+31159,
+31148,
+31328,
+31143,
+30536,
+29626,
+28690,
+28377,
+28855,
+29515,
+29879,
+29726,
+29285,
+28639,
+28199,
+28519,
+29025,
+29069,
+28480,
+27611,
+27160,
+27523,
+28335,
+28934,
+28864,
+28231,
+27592,
+26944,
+26454,
+25774,
+25046,
+24183,
+24986,
+28384,
+31302,
+32989,
+32831,
+31754,
+31254,
+30350,
+30119,
+31400,
+32632,
+33881,
+36089,
+38683,
+40179,
+40536,
+40781,
+40802,
+40298,
+39036,
+38652,
+40238,
+42153,
+44067,
+45444,
+45270,
+44252,
+42883,
+41588,
+39968,
+38489,
+37950,
+37724,
+37186,
+36230,
+35795,
+35735,
+34518,
+32056,
+29037,
+26503,
+25397,
+25308,
+25813,
+26490,
+26624,
+26665,
+26481,
+25911,
+25573,
+25268,
+24987,
+25056,
+25655,
+26997,
+29036,
+31164,
+32799,
+33380,
+33290,
+33382,
+33435,
+33655,
+34374,
+35360,
+36575,
+37881,
+38929,
+39430,
+39566,
+39207,
+38115,
+37198,
+36640,
+36462,
+36757,
+36629,
+36531,
+36366,
+35728,
+35038,
+34300,
+33415,
+32272,
+31138,
+30474,
+30387,
+30615,
+30737,
+30437,
+30124,
+29463,
+28837,
+28396,
+28044,
+28109,
+28170,
+28231,
+28389,
+28617,
+29009,
+29517,
+29706,
+29267,
+28695,
+28316,
+28218,
+28984,
+29729,
+30264,
+30629,
+30542,
+30485,
+30076,
+29040,
+27904,
+26763,
+26929,
+29470,
+32221,
+34115,
+34926,
+34790,
+34229,
+33163,
+32265,
+32240,
+32782,
+33544,
+35109,
+37103,
+38591,
+39806,
+41462,
+42368,
+41282,
+38908,
+37172,
+37093,
+38310,
+40207,
+41717,
+42088,
+41610,
+40999,
+40282,
+38772,
+37018,
+35780,
+34362,
+32487,
+31285,
+31188,
+32049,
+32300,
+30946,
+28868,
+26619,
+24977,
+24052,
+23578,
+23574,
+23804,
+24224,
+24646,
+25047,
+25881,
+26805,
+27398,
+27462,
+27271,
+27401,
+28163,
+29804,
+31851,
+33744,
+35500,
+36702,
+37141,
+37069,
+36798,
+36808,
+37145,
+37420,
+37535,
+37770,
+38141,
+38590,
+39053,
+39143,
+38474,
+37173,
+35567,
+34518,
+34475,
+34725,
+34846,
+34834,
+34773,
+34289,
+33520,
+32925,
 32636,
-32689,
-32736,
-32806,
-32879,
-32938,
-32972,
-32966,
-32976,
-32958,
-32971,
+32576,
+32082,
+31478,
+31733,
+32505,
+33266,
+33672,
+34008,
+34224,
+34274,
+34214,
+33995,
+33725,
+33602,
+33693,
+33653,
+33738,
+34078,
+34387,
+34243,
+33585,
+32605,
+31786,
+31085,
+30223,
+29490,
+28924,
+28492,
+28374,
+27971,
+27528,
+27046,
+25714,
+24089,
+22595,
+22833,
+24797,
+26565,
+27743,
+28034,
+28352,
+28752,
+28670,
+28330,
+28037,
+27969,
+28318,
+29637,
+31668,
+33626,
+35913,
+38373,
+39740,
+39750,
+38637,
+37655,
+37506,
+37575,
+38175,
+38957,
+39794,
+40986,
+41966,
+42365,
+41783,
+40561,
+39085,
+37263,
+35115,
+33522,
+33111,
+33337,
+33105,
+32632,
+31843,
+30697,
+29726,
+28836,
+28246,
+27747,
+27008,
+26340,
+25969,
+26042,
+26652,
+27567,
+28735,
+29652,
+29828,
+29349,
+28873,
+28861,
+29531,
+30560,
+31540,
+32472,
 33008,
-33045,
-33127,
-33147,
-33182,
-33130,
-33071,
-32945,
-32848,
-32769,
-32720,
-32756,
-32778,
-32852,
-32853,
+33368,
+33871,
+34563,
+35185,
+35390,
+35295,
+35115,
+35046,
+35329,
+36066,
+36851,
+37377,
+37575,
+37629,
+37787,
+38196,
+38483,
+38368,
+37906,
+37476,
+37430,
+37596,
+38111,
+38718,
+39104,
+38692,
+37803,
+37099,
+36463,
+35947,
+35345,
+34828,
+34312,
+33772,
+33324,
 32873,
-32812,
-32808,
-32783,
-32858,
-32936,
-33058,
-33147,
+32546,
+32385,
+31987,
+31215,
+30355,
+29832,
+29657,
+29362,
+28795,
+28259,
+27638,
+27138,
+26683,
+26274,
+26208,
+26289,
+26325,
+26193,
+25929,
+25736,
+25748,
+25654,
+25685,
+25426,
+24797,
+24280,
+24369,
+25909,
+27753,
+29049,
+29519,
+29444,
+29638,
+30022,
+30656,
+31188,
+31413,
+31219,
+31149,
+31947,
+33148,
+34624,
+36597,
+38601,
+39702,
+39746,
+39250,
+39355,
+39571,
+39535,
+39387,
+38572,
+38085,
+38234,
+39105,
+40077,
+40333,
+40258,
+39415,
+37484,
+35042,
 33213,
-33209,
-33194,
-33153,
-33145,
-33206,
-33248,
-33400,
-33427,
-33521,
-33488,
-33475,
-33432,
-33392,
-33411,
-33418,
-33485,
-33539,
-33584,
-33620,
-33601,
-33586,
-33539,
-33517,
-33514,
-33534,
-33595,
-33652,
-33713,
-33733,
-33758,
-33727,
-33726,
-33702,
-33700,
-33680,
-33676,
-33616,
-33588,
-33521,
-33467,
-33413,
-33334,
-33253,
-33122,
-32991,
-32860,
-32737,
-32673,
-32635,
-32608,
-32590,
-32522,
-32431,
-32328,
-32228,
-32191,
-32163,
-32225,
-32238,
-32254,
-32249,
-32150,
-32113,
-32021,
-32014,
-32004,
-32046,
-32062,
-32071,
-32053,
-31981,
-31912,
-31815,
-31737,
-31670,
+32161,
+31563,
+31149,
+30665,
+30384,
+30356,
+30390,
+30108,
+29509,
+28793,
+28262,
+27803,
+27417,
+27539,
+27877,
+28347,
+28951,
+29497,
+29922,
+30503,
+31472,
+32333,
+32988,
+33548,
+34148,
+34662,
+34920,
+35286,
+35815,
+36550,
+37469,
+38256,
+38886,
+39295,
+39524,
+39673,
+39719,
+39675,
+39618,
+39592,
+39551,
+39295,
+38959,
+38644,
+38404,
+38282,
+38011,
+37371,
+36392,
+35387,
+34541,
+34070,
+33417,
+32692,
+32000,
+31252,
+30729,
+30348,
+29994,
+29557,
+29036,
+28285,
+27764,
+27319,
+27211,
+27614,
+28083,
+28378,
+28428,
+28410,
+28422,
+28617,
+28714,
+28872,
+29180,
+29275,
+29744,
+30595,
+31150,
+31459,
+31441,
+31351,
+31479,
 31618,
-31580,
-31552,
-31524,
-31473,
-31415,
-31334,
-31257,
-31183,
-31136,
-31115,
-31116,
-31156,
-31179,
-31237,
-31259,
-31280,
-31308,
-31300,
-31316,
-31340,
-31344,
-31420,
-31440,
-31512,
-31525,
-31564,
-31548,
-31533,
-31504,
-31509,
-31543,
-31605,
-31704,
-31783,
-31843,
-31870,
-31844,
-31826,
-31816,
-31833,
-31901,
-31997,
-32095,
-32187,
-32240,
-32248,
-32270,
+31854,
+32020,
+31906,
+31347,
+30484,
+29622,
+28591,
+27600,
+26753,
+26586,
+27547,
+28484,
+29083,
+29133,
+28864,
+28767,
+28574,
+28356,
+28274,
+28094,
+27793,
+28130,
+29031,
+30185,
+31536,
+33621,
+35633,
+36688,
+36964,
+36588,
+36605,
+36871,
+37163,
+37394,
+37292,
+37541,
+38397,
+39513,
+40392,
+41135,
+41578,
+41511,
+40662,
+39290,
+38173,
+37444,
+36827,
+35965,
+35109,
+34291,
+33985,
+34073,
+33995,
+33911,
+33582,
+32931,
+31937,
+30839,
+29879,
+28960,
+28434,
+28343,
+28385,
+28642,
+29019,
+29485,
+29941,
+30221,
+30408,
+30385,
+30155,
+30143,
+30329,
+30538,
+30769,
+31319,
 32239,
-32264,
-32266,
-32331,
-32361,
-32462,
-32471,
-32536,
-32517,
-32512,
-32476,
-32435,
-32397,
-32376,
-32363,
-32386,
-32392,
-32428,
-32453,
-32471,
-32497,
-32515,
-32545,
-32584,
-32617,
-32687,
-32734,
-32820,
-32854,
-32926,
-32969,
-33012,
-33096,
-33126,
-33199,
-33250,
-33264,
-33300,
-33286,
-33273,
-33287,
-33272,
-33290,
-33313,
-33314,
-33318,
-33289,
-33274,
-33232,
-33235,
-33224,
-33223,
-33249,
-33233,
-33238,
-33224,
-33204,
+33023,
+33642,
+34253,
+34898,
+35433,
+35668,
+35652,
+35390,
+35481,
+35898,
+36155,
+36336,
+36382,
+36448,
+36394,
+36139,
+35951,
+35761,
+35495,
+34962,
+34299,
+33937,
+33756,
+33688,
+33592,
 33210,
-33209,
-33242,
-33285,
-33310,
-33349,
-33362,
-33370,
-33373,
-33370,
-33370,
-33362,
-33357,
-33350,
-33329,
-33310,
-33294,
-33252,
-33233,
-33172,
-33123,
-33072,
-33001,
-32962,
-32912,
-32869,
-32852,
-32798,
-32787,
-32719,
-32697,
-32656,
-32620,
-32622,
-32589,
-32612,
-32602,
-32613,
-32614,
-32613,
-32595,
-32578,
-32539,
-32489,
-32456,
-32416,
-32399,
-32381,
-32351,
-32316,
-32256,
-32192,
-32118,
-32056,
-32015,
-31979,
-31980,
-31959,
-31965,
-31975,
-31979,
-32007,
-32040,
-32094,
-32149,
-32206,
-32261,
-32310,
-32354,
-32398,
-32426,
-32485,
-32528,
-32588,
-32645,
-32701,
-32742,
-32773,
-32772,
-32788,
-32807,
-32828,
-32871,
-32907,
-32942,
-32981,
-32995,
-33012,
-33039,
-33046,
-33090,
-33099,
-33143,
-33169,
-33221,
-33266,
-33345,
-33411,
-33516,
-33572,
-33672,
-33701,
-33792,
-33813,
-33875,
-33898,
-33929,
-33920,
-33925,
-33872,
-33857,
-33804,
-33773,
-33716,
-33677,
-33615,
-33564,
-33521,
-33466,
-33442,
-33407,
-33374,
-33367,
-33315,
-33293,
-33239,
+32758,
+32347,
+31752,
+31240,
+30896,
+30640,
+30492,
+30500,
+30538,
+30754,
+31219,
+31467,
+31784,
+32197,
+32778,
+33505,
+33916,
+34074,
+34077,
+34092,
+34172,
+34275,
+34478,
+34665,
+34631,
+34431,
+34170,
+33866,
+33396,
+32830,
+32082,
+30959,
+29675,
+28459,
+27374,
+26366,
+25343,
+24443,
+23842,
+23341,
+23778,
+24659,
+25199,
+25388,
+25378,
+25861,
+26259,
+26426,
+26469,
+26698,
+26854,
+27255,
+28449,
+30066,
+32076,
+34110,
+36260,
+37957,
+39088,
+39518,
+39676,
+39997,
+40246,
+40582,
+40694,
+40965,
+41603,
+42369,
+43073,
+43411,
+43698,
+43488,
+42753,
+41308,
+39621,
+38091,
+36710,
+35528,
+34413,
+33526,
+32631,
+32010,
+31497,
+30981,
+30520,
+29973,
+29370,
+28376,
+27084,
+26026,
+25377,
+25104,
+25159,
+25385,
+25475,
+25716,
+26206,
+26849,
+27622,
+28331,
+28868,
+29095,
+29280,
+29594,
+29918,
+30390,
+30916,
+31249,
+31661,
+32477,
+33583,
+34990,
+36158,
+36851,
+37236,
+37325,
+37224,
+36999,
+36945,
+37019,
+37243,
+37477,
+37654,
+37687,
+37788,
+37997,
+37986,
+37801,
+37313,
+36944,
+36536,
+35994,
+35620,
+35392,
+35473,
+35650,
+35492,
+35008,
+34330,
+33731,
+33452,
+33316,
+33149,
+32958,
+32930,
+32982,
+32924,
+33013,
 33218,
-33170,
-33171,
-33117,
+33375,
+33360,
 33105,
-33070,
-33036,
-33025,
-32986,
-32971,
-32955,
-32923,
-32918,
-32888,
-32850,
-32842,
-32781,
-32755,
+32966,
+33083,
+33499,
+33829,
+33713,
+33352,
+32940,
 32690,
-32640,
-32559,
-32482,
-32391,
-32292,
-32223,
-32145,
-32105,
-32062,
-32045,
-32020,
-32000,
-31982,
-31959,
-31944,
-31922,
-31921,
-31884,
-31878,
-31831,
-31780,
-31741,
-31656,
-31634,
-31566,
-31552,
-31500,
-31473,
-31440,
-31391,
-31366,
-31326,
-31321,
-31317,
-31317,
-31344,
-31339,
-31373,
-31373,
-31369,
-31408,
-31415,
-31471,
-31521,
-31580,
-31664,
-31741,
-31846,
-31939,
-32072,
-32166,
-32318,
-32402,
-32514,
-32590,
-32659,
-32722,
-32788,
-32852,
-32918,
-32993,
-33048,
-33124,
-33165,
-33250,
-33302,
-33408,
-33501,
-33618,
-33747,
-33855,
-33952,
-34043,
-34110,
-34168,
-34240,
-34284,
-34349,
-34405,
-34421,
-34453,
-34443,
-34450,
-34465,
+32453,
+32427,
+32484,
+32330,
+31945,
+31312,
+30708,
+30199,
+29633,
+28985,
+28186,
+27161,
+26272,
+25659,
+25096,
+24485,
+24039,
+23575,
+23865,
+25036,
+26055,
+26631,
+26583,
+26495,
+26398,
+26394,
+26472,
+26949,
+27677,
+28283,
+29249,
+30347,
+31725,
+33277,
+35110,
+36588,
+37527,
+37824,
+37774,
+38262,
+38875,
+39417,
+39646,
+39942,
+40589,
+41122,
+41686,
+42025,
+42248,
+41870,
+40803,
+39178,
+37480,
+36119,
+35068,
+34074,
+32866,
+31579,
+30323,
+29403,
+28685,
+28304,
+28169,
+27893,
+27276,
+26505,
+25666,
+25029,
+24907,
+25149,
+25600,
+26174,
+26849,
+27723,
+28933,
+30241,
+31370,
+32306,
+32991,
+33397,
+33978,
+34744,
+35623,
+36592,
+37509,
+38372,
+39177,
+39827,
+40251,
+40600,
+40507,
+40127,
+39663,
+39216,
+38978,
+38636,
+38156,
+37501,
+36839,
+36263,
+35890,
+35629,
+35350,
+35063,
+34651,
+34239,
+33648,
+32936,
+32394,
+31897,
+31397,
+31096,
+31034,
+31278,
+31745,
+32243,
+32631,
+32874,
+32948,
+33059,
+33163,
+33051,
+32918,
+32867,
+32920,
+33113,
+33509,
+33985,
+34323,
+34399,
+34377,
+34307,
+34095,
+33865,
+33621,
+33446,
+33246,
+32923,
+32550,
+32191,
+31779,
+31027,
+30052,
+29013,
+28295,
+27984,
+27746,
+27602,
+27272,
+26838,
+26382,
+25811,
+25167,
+24497,
+23895,
+23396,
+22984,
+22755,
+22494,
+22132,
+21858,
+21992,
+23235,
+25016,
+26664,
+27700,
+28342,
+28933,
+29380,
+29538,
+29594,
+29914,
+30312,
+31254,
+32709,
 34481,
-34500,
-34558,
-34578,
-34614,
-34605,
-34603,
-34585,
-34551,
-34548,
-34508,
-34495,
-34448,
-34389,
-34321,
-34258,
-34184,
-34153,
-34147,
-34131,
-34175,
-34152,
-34169,
-34146,
-34131,
-34128,
-34118,
-34108,
-34103,
-34053,
-34001,
-33904,
-33802,
-33687,
-33584,
-33517,
-33426,
-33373,
-33300,
-33221,
-33155,
-33067,
-33010,
-32969,
-32928,
-32899,
-32837,
-32788,
-32678,
-32630,
-32511,
-32485,
-32403,
-32388,
-32349,
-32314,
-32281,
-32256,
-32237,
-32259,
-32277,
-32322,
-32342,
-32357,
-32350,
-32338,
-32311,
-32288,
-32291,
-32276,
-32288,
-32271,
-32246,
-32224,
-32211,
-32197,
-32245,
-32252,
-32339,
-32349,
-32398,
-32374,
-32370,
+36426,
+38519,
+40570,
+41972,
+42433,
+41745,
+41260,
+41440,
+41740,
+42020,
+42134,
+42503,
+42997,
+43467,
+44025,
+44698,
+45007,
+44496,
+43068,
+40919,
+38653,
+36756,
+35481,
+34479,
+33543,
+32569,
+31890,
+31614,
+31291,
+30833,
+29987,
+28762,
+27377,
+25998,
+24861,
+24171,
+24145,
+24569,
+25086,
+25498,
+25874,
+26457,
+27243,
+28167,
+28842,
+29212,
+29655,
+30432,
+31383,
+32424,
+33625,
+34993,
+36400,
+37454,
+38207,
+38783,
+39244,
+39588,
+39695,
+39639,
+39636,
+39749,
+39958,
+40031,
+39787,
+39412,
+38955,
+38293,
+37326,
+36123,
+34955,
+33948,
+33012,
+32283,
+31721,
+31100,
+30461,
+29731,
+28925,
+28411,
+28171,
+27833,
+27455,
+27228,
+27095,
+27197,
+27559,
+27974,
+28433,
+28779,
+29060,
+29434,
+29963,
+30675,
+31462,
+32218,
+32833,
+33290,
+33685,
+34250,
+34974,
+35670,
+36360,
+36932,
+37214,
+37277,
+37217,
+37102,
+36897,
+36435,
+35818,
+35197,
+34423,
+33626,
+32880,
+32166,
+31594,
+31067,
+30411,
+29659,
+28931,
+28343,
+27927,
+27591,
+27403,
+27080,
+26480,
+25877,
+25419,
+24921,
+24302,
+24012,
+24254,
+25579,
+27840,
+29923,
+31316,
+31692,
+31637,
+31617,
+31484,
+31291,
+31350,
+31814,
+32684,
+34183,
+36033,
+37878,
+39483,
+40786,
+41397,
+40968,
+39375,
+37745,
+37305,
+37397,
+37580,
+37687,
+37996,
+38723,
+39254,
+39256,
+38540,
+37222,
+35380,
+33288,
+31256,
+29509,
+28488,
+28422,
+28722,
+28876,
+28583,
+28026,
+27758,
+27491,
+27063,
+26739,
+26769,
+27195,
+27902,
+28753,
+29669,
+30692,
+31731,
+32754,
+33545,
+33903,
+34017,
+34307,
+35010,
+35784,
+36522,
+37318,
+38029,
+38639,
+39010,
+39105,
+39011,
+38654,
+38154,
+37544,
+36862,
+36498,
+36513,
+36709,
+36741,
+36256,
+35465,
+34696,
+33984,
+33251,
 32345,
-32335,
-32332,
-32344,
-32336,
-32343,
-32317,
-32290,
-32269,
-32271,
-32280,
-32368,
-32409,
-32525,
-32585,
-32674,
-32740,
-32818,
-32894,
-32997,
-33065,
-33161,
-33222,
-33285,
-33330,
-33374,
-33425,
-33491,
-33564,
-33637,
-33723,
-33758,
-33848,
-33880,
-33969,
-34033,
-34109,
-34170,
-34216,
-34230,
-34240,
-34211,
-34224,
-34221,
-34255,
-34282,
-34321,
-34335,
-34362,
-34358,
-34381,
-34397,
-34427,
-34488,
-34524,
-34572,
-34574,
-34554,
-34506,
-34450,
-34385,
-34329,
-34274,
-34237,
-34169,
-34133,
-34046,
-33991,
-33915,
-33874,
-33806,
-33809,
-33739,
-33725,
-33673,
-33622,
-33568,
-33483,
-33420,
-33337,
-33249,
-33178,
-33069,
-32993,
-32921,
-32820,
-32794,
-32702,
-32660,
-32589,
-32517,
-32437,
-32362,
-32278,
-32201,
+31376,
+30669,
+30122,
+29656,
+29416,
+29372,
+29458,
+29459,
+29291,
+28976,
+28654,
+28468,
+28488,
+28663,
+28947,
+29504,
+30343,
+31245,
+31984,
+32563,
+33028,
+33589,
+34135,
+34468,
+34710,
+35134,
+35842,
+36600,
+37179,
+37599,
+37982,
+38137,
+38054,
+37991,
+37939,
+37958,
+38002,
+38044,
+38063,
+37823,
+37439,
+36939,
+36373,
+35710,
+34974,
+34207,
+33251,
+32298,
+31267,
+30242,
+29439,
+28751,
+28360,
+28069,
+27702,
+27190,
+26548,
+26058,
+25742,
+25558,
+25289,
+24856,
+24292,
+23642,
+23137,
+22724,
+22151,
+21596,
+21681,
+23077,
+25494,
+27567,
+28503,
+28443,
+27979,
+27464,
+27123,
+27228,
+27863,
+29044,
+30703,
+32996,
+35389,
+37185,
+38483,
+39477,
+39961,
+39427,
+38252,
+37948,
+39008,
+40686,
+42299,
+43442,
+44101,
+44227,
+43811,
+43054,
+42035,
+40753,
+39510,
+38410,
+37414,
+36513,
+35884,
+35774,
+35422,
+34079,
+31933,
+29919,
+28655,
+27950,
+27696,
+27770,
+27935,
+27972,
+27911,
+27801,
+27672,
+27564,
+27668,
+28208,
+28825,
+29302,
+30017,
+31255,
+32810,
+34180,
+34925,
+35193,
+35347,
+35494,
+35716,
+36144,
+36796,
+37450,
+37987,
+38319,
+38270,
+37925,
+37387,
+36686,
+35775,
+34604,
+33392,
+32502,
+31990,
+31598,
+31288,
+30959,
+30607,
+30061,
+29176,
+28389,
+27832,
+27423,
+27258,
+27401,
+27668,
+28002,
+28419,
+28974,
+29654,
+30381,
+31222,
 32126,
-32032,
-31963,
-31839,
-31750,
-31624,
-31512,
-31421,
-31327,
-31272,
-31221,
-31177,
-31147,
-31088,
-31066,
-30987,
-30954,
-30893,
-30865,
-30825,
-30798,
-30771,
-30727,
-30703,
-30647,
-30606,
-30580,
-30544,
-30573,
-30565,
-30619,
-30648,
-30693,
-30716,
-30749,
-30757,
-30786,
-30775,
-30820,
-30821,
-30878,
-30893,
+33020,
+33730,
+34375,
+35269,
+36387,
+37609,
+38608,
+39220,
+39543,
+39694,
+40015,
+40391,
+40497,
+40511,
+40381,
+40069,
+39758,
+39352,
+38821,
+38195,
+37467,
+36690,
+35873,
+35143,
+34492,
+33965,
+33326,
+32184,
+30879,
+29635,
+28447,
+27422,
+26549,
+26001,
+25804,
+25715,
+25590,
+25268,
+24674,
+24030,
+23595,
+23529,
+23779,
+24170,
+24464,
+24565,
+24489,
+24303,
+24140,
+23869,
+23701,
+24150,
+25725,
+28470,
+31029,
+32301,
+32259,
+31576,
+31145,
+31114,
+31760,
+33135,
+34767,
+36330,
+38091,
+40073,
+41405,
+41590,
+41170,
+40581,
+39751,
+38823,
+38737,
+40208,
+42243,
+43455,
+43334,
+42068,
+40306,
+38581,
+37154,
+36022,
+34796,
+33492,
+32502,
+31756,
+31075,
+30274,
+29386,
+28110,
+26096,
+23834,
+22394,
+22259,
+23022,
+24052,
+24873,
+25323,
+25329,
+25248,
+25424,
+25921,
+26508,
+27198,
+28332,
+29869,
+31656,
+33472,
+35302,
+36956,
+37950,
+38300,
+38582,
+39116,
+39896,
+40854,
+41802,
+42466,
+42578,
+42344,
+42068,
+41691,
+41210,
+40586,
+39824,
+39046,
+38110,
+37082,
+36230,
+35362,
+34324,
+33050,
+31673,
+30528,
+29707,
+29199,
+29040,
+29118,
+29116,
+28884,
+28574,
+28370,
+28367,
+28636,
+29059,
+29581,
+30193,
+30914,
+31795,
+32738,
+33756,
+34529,
+35012,
+35460,
+35948,
+36800,
+37679,
+38264,
+38538,
+38356,
+38098,
+37895,
+37555,
+37202,
+36752,
+36468,
+36423,
+36230,
+35799,
+35196,
+34655,
+34024,
+33054,
+31902,
+30868,
+30318,
+30018,
+29659,
+29177,
+28489,
+27701,
+26877,
+26126,
+25756,
+25853,
+26161,
+26409,
+26287,
+25918,
+25799,
+26075,
+26647,
+27185,
+27372,
+27340,
+26965,
+26476,
+26623,
+26757,
+26747,
+26948,
+27246,
+28959,
+31584,
+32915,
+32472,
 30932,
-30963,
-30983,
-31017,
-31054,
-31091,
-31166,
-31217,
-31297,
-31372,
-31448,
-31501,
-31588,
-31611,
-31675,
-31706,
-31728,
-31773,
-31796,
-31823,
-31878,
-31900,
-31947,
-31963,
-31979,
-31972,
-31985,
-31974,
-31993,
-31996,
-32011,
-32024,
-31998,
-31985,
-31936,
-31887,
-31851,
-31798,
-31785,
-31767,
-31759,
-31751,
-31718,
-31684,
-31628,
-31565,
-31512,
-31441,
-31387,
-31333,
-31263,
-31216,
-31124,
-31059,
-30952,
-30863,
-30766,
-30680,
-30606,
-30523,
-30474,
-30399,
-30338,
+29601,
+29125,
+29381,
+30626,
+32558,
+34087,
+35089,
+36420,
+37555,
+37427,
+36547,
+35875,
+35620,
+35396,
+35555,
+37136,
+39543,
+41037,
+41165,
+40348,
+38888,
+37378,
+36397,
+36212,
+36328,
+36065,
+35642,
+35198,
+34559,
+33689,
+32677,
+31529,
+30024,
+28479,
+27751,
+28237,
+29209,
+29745,
+29837,
+29586,
+28896,
+28247,
+28439,
+29326,
+30093,
+30471,
+30982,
+32168,
+33550,
+34635,
+35457,
+35937,
+36122,
+36249,
+36625,
+37508,
+38604,
+39393,
+39707,
+39548,
+39134,
+38800,
+38725,
+38802,
+38683,
+38199,
+37556,
+36871,
+36229,
+35657,
+34970,
+34026,
+32911,
+31797,
+31055,
+30718,
+30453,
+30076,
+29463,
+28812,
+28229,
+27807,
+27789,
+27996,
+28201,
+28281,
+28216,
+28293,
+28563,
+28955,
+29387,
+29849,
 30269,
-30200,
-30128,
-30071,
-30033,
-30006,
-30005,
-30047,
-30067,
-30149,
-30203,
-30273,
-30364,
-30430,
-30524,
-30581,
-30657,
-30709,
-30739,
-30780,
-30770,
-30780,
-30750,
-30727,
-30719,
-30687,
-30719,
-30707,
-30786,
-30839,
-30949,
-31045,
+30671,
+31288,
+32120,
+33274,
+34402,
+35054,
+35259,
+35214,
+35404,
+36046,
+36817,
+37384,
+37538,
+37508,
+37670,
+37926,
+38133,
+38165,
+37952,
+37675,
+37434,
+37375,
+37335,
+36994,
+36327,
+35425,
+34473,
+33630,
+33090,
+32767,
+32386,
+31819,
+31174,
+30665,
+30516,
+30379,
+29882,
+29099,
+28123,
+27520,
+27477,
+27751,
+27982,
+27835,
+27349,
+26694,
+26377,
+26460,
+26836,
+27107,
+26773,
+26146,
+25480,
+25027,
+24732,
+24401,
+24417,
+25176,
+26642,
+28240,
+29430,
+29730,
+29413,
+28936,
+28513,
+28596,
+29158,
+30171,
+31536,
+33210,
+34967,
+36359,
+36959,
+36861,
+36550,
+36180,
+36194,
+36861,
+37974,
+39201,
+39931,
+39994,
+39644,
+39115,
+38756,
+38415,
+37881,
+37373,
+36986,
+36802,
+36735,
+36567,
+36072,
+35112,
+33761,
+32458,
+31716,
+31620,
+31885,
+32044,
+31920,
+31596,
+31265,
+31093,
+31093,
+31168,
 31159,
-31268,
-31376,
-31453,
-31566,
-31653,
-31751,
-31859,
-31955,
+31087,
+31181,
+31659,
+32474,
+33251,
+33630,
+33574,
+33406,
+33453,
+33776,
+34262,
+34627,
+34800,
+34880,
+34923,
+35013,
+35043,
+35035,
+34912,
+34595,
+34286,
+34068,
+33986,
+33918,
+33817,
+33602,
+33282,
+33070,
+33000,
+32867,
+32651,
+32515,
+32493,
+32551,
+32649,
+32714,
+32612,
+32492,
+32329,
+32205,
+32287,
+32433,
+32539,
+32528,
+32560,
+32739,
+33396,
+33932,
+33770,
+33755,
+33418,
+33284,
+33775,
+33547,
+33770,
+34315,
+34346,
+34694,
+34979,
+35182,
+35251,
+34893,
+34704,
+34737,
+34657,
+34570,
+34552,
+34680,
+34914,
+34937,
+34621,
+34194,
+33695,
+32969,
+32332,
+32023,
+31898,
+31855,
+31493,
+30818,
+30222,
+29790,
+29471,
+29067,
+28527,
+28067,
+27664,
+27248,
+27062,
+27210,
+27291,
+26908,
+26288,
+25926,
+25798,
+25878,
+26081,
+26123,
+26170,
+26145,
+25945,
+25873,
+25895,
+26223,
+26686,
+27269,
+28624,
+29755,
+30045,
+30296,
+30496,
+30574,
+30837,
+31369,
 32051,
-32156,
-32243,
-32377,
-32510,
-32731,
-32934,
-33241,
-33510,
-33847,
-34171,
-34487,
-34822,
-35126,
-35444,
-35741,
-36020,
-36273,
-36492,
-36687,
-36845,
-36984,
-37109,
-37235,
-37343,
-37467,
-37547,
-37640,
-37719,
-37788,
-37856,
-37923,
-37989,
-38036,
-38080,
-38112,
-38093,
-38115,
-38078,
-38091,
-38069,
-38103,
-38105,
-38137,
-38135,
-38150,
-38138,
-38142,
-38156,
-38153,
-38187,
-38174,
-38179,
-38150,
-38094,
-38026,
-37935,
-37840,
-37752,
-37626,
-37525,
-37365,
-37224,
-37034,
-36846,
-36621,
-36422,
-36176,
-35957,
-35712,
-35458,
-35197,
-34930,
-34661,
-34403,
-34143,
-33919,
-33670,
-33471,
-33231,
-33053,
-32848,
-32696,
-32550,
-32441,
-32341,
-32253,
-32158,
-32084,
-31992,
-31914,
-31856,
-31789,
-31748,
-31719,
-31629,
-31593,
-31483,
-31402,
-31310,
-31225,
-31160,
-31089,
-31048,
-30966,
-30920,
-30836,
-30764,
-30707,
-30646,
-30607,
-30554,
-30504,
-30449,
-30363,
-30301,
-30211,
-30145,
-30103,
-30024,
-30023,
-29953,
-29952,
-29916,
-29907,
-29931,
-29953,
-30017,
-30058,
-30130,
-30178,
-30233,
-30280,
-30316,
-30384,
-30438,
-30497,
-30577,
-30597,
-30672,
-30689,
-30729,
-30765,
-30812,
-30868,
-30925,
-30986,
-31006,
-31059,
-31045,
+32810,
+33867,
+35262,
+36543,
+37501,
+37953,
+37974,
+37986,
+37959,
+38100,
+38740,
+39527,
+40015,
+40268,
+40389,
+40305,
+40016,
+39727,
+39306,
+38657,
+38283,
+37889,
+37333,
+37166,
+36880,
+35971,
+34879,
+33810,
+32644,
+31871,
+31536,
+31083,
+30619,
+30344,
+30049,
+29805,
+29816,
+29857,
+29845,
+29823,
+29777,
+29856,
+30271,
+30860,
+31254,
+31590,
+31982,
+32236,
+32642,
+33255,
+33770,
+34165,
+34429,
+34665,
+35013,
+35548,
+35874,
+35901,
+35815,
+35565,
+35326,
+35069,
+34800,
+34611,
+34451,
+34219,
+34045,
+34000,
+33765,
+33152,
+32361,
+31650,
+31062,
+30666,
+30495,
+30522,
+30718,
+30900,
+31009,
+31026,
 31085,
-31067,
-31088,
-31099,
-31117,
-31115,
-31143,
-31115,
-31164,
-31149,
-31188,
-31205,
-31243,
-31280,
-31303,
-31346,
-31358,
-31402,
-31411,
-31463,
-31483,
-31526,
-31545,
-31589,
-31607,
-31674,
-31707,
-31798,
-31857,
-31945,
-32020,
-32090,
-32166,
-32213,
-32291,
-32331,
-32429,
-32452,
-32544,
-32573,
-32619,
-32673,
-32697,
-32755,
-32819,
-32879,
-32965,
-33043,
-33134,
-33213,
-33306,
-33369,
-33463,
-33536,
-33617,
-33695,
-33762,
-33815,
-33885,
-33937,
+31150,
+31016,
+30979,
+31137,
+31386,
+31817,
+32328,
+32803,
+33259,
+33565,
+33719,
+33734,
+33759,
+33907,
 33996,
-34059,
-34103,
-34174,
 34229,
-34297,
-34350,
-34438,
-34477,
-34566,
-34602,
-34674,
-34710,
-34762,
-34787,
-34816,
-34826,
-34831,
-34825,
-34815,
-34805,
-34768,
-34769,
-34704,
-34687,
-34624,
-34576,
-34516,
-34457,
-34381,
-34325,
-34255,
-34166,
-34117,
-34001,
-33936,
-33826,
-33751,
-33652,
-33589,
-33495,
-33437,
-33358,
-33289,
-33215,
-33143,
-33052,
-32985,
-32892,
-32835,
-32719,
-32661,
-32535,
-32458,
-32333,
-32235,
-32092,
-32003,
-31855,
-31754,
-31632,
-31508,
-31422,
-31309,
-31226,
-31106,
-31041,
-30902,
-30855,
-30732,
-30681,
-30596,
-30551,
-30496,
-30454,
-30415,
-30361,
-30348,
-30288,
-30312,
-30280,
-30326,
-30329,
-30381,
-30398,
-30443,
-30450,
-30498,
+34585,
+35018,
+35514,
+35614,
+35436,
+35362,
+35226,
+34881,
+34780,
+34823,
+34732,
+34726,
+34668,
+34465,
+34098,
+33601,
+32992,
+32406,
+31943,
+31702,
+31576,
+31580,
+31468,
+30958,
+30711,
 30501,
-30558,
-30597,
-30655,
-30719,
-30791,
-30858,
-30945,
-31018,
-31085,
-31197,
-31287,
-31409,
-31523,
-31658,
-31772,
-31916,
-32008,
-32131,
-32210,
-32323,
-32400,
-32508,
-32610,
-32709,
-32829,
-32917,
-33028,
-33112,
-33209,
+30110,
+30019,
+30082,
+29629,
+29676,
+30266,
+30079,
+30204,
+30835,
+30946,
+30741,
+31065,
+31628,
+31756,
+31998,
+32666,
+32322,
+32106,
+33224,
+32465,
+32129,
+33660,
+33560,
+32544,
+33596,
+34155,
+32361,
+33272,
+33517,
+31646,
+32970,
+33132,
+31336,
+32516,
+33640,
+31793,
+31900,
+33309,
+31411,
+30659,
+32120,
+30618,
+29477,
+30951,
+30853,
+30256,
+30871,
+30813,
+29976,
+30528,
+30688,
+29886,
+30937,
+31201,
+30140,
+30897,
+31974,
+31460,
+31597,
+32762,
+32494,
+32171,
+32907,
+33230,
+33648,
+34400,
+34657,
+34647,
+34873,
+34919,
+34804,
+35153,
+35156,
+34928,
+35104,
+35015,
+35113,
+35536,
+35700,
+35548,
+35313,
+35018,
+34304,
+34133,
+34275,
+33941,
+33933,
+33982,
+33817,
+33505,
+33721,
+33917,
+33180,
+33115,
+33194,
+32583,
+32465,
+32713,
+32653,
+32471,
+32835,
+32941,
+32545,
+32740,
+33322,
 33294,
-33390,
-33473,
-33584,
-33675,
-33766,
-33851,
-33918,
-33977,
-34034,
-34090,
-34124,
-34197,
-34252,
-34316,
-34409,
-34458,
-34561,
-34600,
-34678,
-34720,
-34779,
-34830,
-34883,
-34917,
-34965,
-34975,
-35000,
-34976,
-34965,
-34920,
-34881,
-34832,
-34813,
-34775,
-34765,
-34732,
-34691,
-34645,
-34584,
-34508,
-34454,
-34365,
-34314,
-34245,
-34170,
-34103,
-34003,
-33919,
-33802,
-33707,
-33612,
-33533,
-33463,
-33429,
-33370,
-33349,
-33298,
-33262,
-33229,
-33173,
-33154,
-33092,
-33103,
+32958,
+33319,
+33773,
+33577,
+33593,
+34267,
+34443,
+34223,
+34373,
+34746,
+34762,
+34520,
+34875,
+34896,
+34321,
+34689,
+35235,
+34701,
+34139,
+34484,
+33951,
+32869,
 33031,
-33059,
-32987,
-32991,
-32932,
-32896,
-32866,
-32816,
-32800,
-32771,
-32766,
-32747,
-32762,
-32722,
-32720,
-32677,
-32652,
-32593,
-32570,
-32515,
-32497,
-32456,
-32427,
-32402,
-32361,
-32339,
-32305,
-32281,
-32284,
-32279,
-32297,
-32322,
-32348,
-32385,
-32403,
-32417,
-32438,
-32438,
-32458,
-32470,
-32487,
-32535,
-32547,
+33293,
 32609,
-32612,
-32664,
-32677,
-32717,
-32751,
+32368,
+32853,
+32282,
+31803,
+32071,
+31936,
+31280,
+30990,
+31133,
+30972,
+31045,
+31303,
+31587,
+31584,
+31552,
+31857,
+31705,
+31682,
+32129,
+32265,
+32079,
+32487,
+33212,
+32749,
 32787,
-32841,
-32897,
-32950,
-33015,
-33040,
-33086,
-33112,
-33146,
-33177,
-33230,
-33266,
-33340,
-33399,
-33465,
-33523,
-33582,
-33621,
-33687,
-33714,
-33783,
-33810,
-33851,
-33877,
-33877,
-33880,
-33853,
-33832,
-33793,
-33767,
-33731,
-33697,
-33675,
+33488,
+33180,
+32968,
+33401,
+33367,
+32729,
+33535,
+33583,
+32546,
+33759,
+33634,
+32344,
+32753,
+32863,
+31839,
+31516,
+32219,
+30769,
+29975,
+31603,
+29839,
+29030,
+31425,
+29493,
+28072,
+29987,
+28763,
+27386,
+29532,
+29049,
+27439,
+29925,
+29616,
+28267,
+30175,
+29774,
+29496,
+30386,
+30404,
+31075,
+31510,
+32402,
+32345,
+32683,
+34628,
+33344,
+33923,
+35767,
+33805,
+35404,
+35592,
+34785,
+36462,
+35007,
+36332,
+35410,
+34944,
+36374,
+34374,
+36233,
+34454,
+34454,
+35419,
+32816,
+34579,
+33253,
+32923,
+33998,
+31816,
+33454,
+33263,
+31712,
+33183,
+32333,
+31582,
+32434,
+32845,
+32756,
+32847,
+33065,
 33630,
-33625,
-33589,
-33586,
-33566,
-33559,
-33548,
-33536,
-33540,
-33512,
+32862,
+32326,
+33663,
+33105,
+32843,
+32885,
+32919,
+33477,
+32714,
+32883,
+33035,
+32075,
+32734,
+31979,
+31424,
+32759,
+32032,
+31097,
+31708,
+32310,
+31256,
+31474,
+32427,
+32111,
+31712,
+32432,
+33238,
+32699,
+32619,
+33881,
+34094,
+32787,
+34439,
+34909,
+34430,
+35223,
+35289,
+36425,
+35426,
+35855,
+36178,
+36065,
+35989,
+35720,
+36634,
+35589,
+36443,
+35846,
+35194,
+36704,
+35447,
+34668,
+35688,
+35383,
+34873,
+34676,
+34315,
+34433,
+33372,
+32603,
+32831,
+32372,
+32141,
+31421,
+31423,
+31213,
+30200,
+30258,
+29619,
+28996,
+30004,
+28252,
+29239,
+28835,
+29026,
+29853,
+27755,
+30842,
+28485,
+28120,
+30963,
+28506,
+30405,
+30065,
+31624,
+31220,
+29905,
+33788,
+30577,
+31892,
+32977,
+31926,
+33895,
+31766,
+34800,
+33819,
+33531,
+35761,
+32858,
+35191,
+33204,
+33225,
+35523,
+31822,
+34334,
 33504,
-33495,
-33473,
-33479,
-33453,
-33434,
-33409,
-33380,
+32793,
+33551,
+31486,
+34284,
+31119,
+30993,
 33346,
+30532,
+31047,
+30334,
+32095,
+30587,
+28660,
+32206,
+29776,
+29305,
+30076,
+29748,
+30989,
+27738,
+30718,
+31931,
+28087,
+30325,
+31838,
+31865,
+29370,
+31266,
+35521,
+30142,
+31882,
+36215,
+32820,
+33718,
+34084,
+35243,
+35658,
+33351,
+35939,
+37298,
+35986,
+34979,
+36750,
+38069,
+33719,
+36257,
+37661,
+34439,
+36225,
+35561,
+35344,
+36140,
+34251,
+34591,
+34825,
+34098,
+33385,
+34432,
+34818,
+32936,
+34283,
+34665,
+33235,
+33444,
+33395,
+34508,
+33390,
+32640,
+35454,
+33985,
+33891,
+34137,
+35299,
+34992,
+32900,
+34927,
+34793,
+34968,
+33174,
+35316,
+35398,
+31972,
+35535,
+33841,
+33115,
+33964,
+31790,
+34098,
+31780,
+31555,
+32418,
+31760,
+31101,
+29699,
+32367,
+29932,
+30218,
+30947,
+29822,
+30830,
+28888,
+31741,
+29807,
+29661,
+32164,
+28737,
+31450,
+30557,
+30918,
+32296,
+30091,
+32847,
+31424,
+31968,
+32465,
+31731,
+34196,
+31025,
+32964,
+33834,
+31732,
+34237,
+32515,
+34608,
+32862,
+32070,
+35120,
+30742,
+33227,
+32574,
+32095,
+33271,
+30554,
+34135,
+31835,
+31062,
+32792,
+31389,
+31434,
+30479,
+32115,
+31075,
+31143,
+31424,
+31432,
+32068,
+30575,
+31905,
+31017,
+31060,
+31694,
+31093,
+31662,
+31470,
+31904,
+30556,
+32560,
+31489,
+30105,
 33342,
-33305,
-33301,
-33280,
-33262,
-33221,
-33183,
-33117,
-33071,
-32987,
-32939,
-32856,
-32784,
-32709,
-32600,
-32521,
-32387,
-32317,
-32198,
-32128,
-32056,
-31982,
-31920,
-31843,
-31756,
-31708,
-31621,
-31587,
-31522,
-31490,
-31431,
-31382,
-31321,
-31255,
-31217,
-31153,
-31144,
-31110,
-31098,
-31074,
-31032,
-31014,
-30977,
-30962,
-30950,
-30948,
-30938,
-30945,
-30904,
-30880,
-30850,
-30815,
-30813,
-30804,
-30829,
-30843,
-30862,
-30865,
-30882,
-30879,
-30919,
-30945,
-30993,
-31034,
-31070,
-31096,
-31107,
-31105,
-31121,
-31135,
-31185,
-31197,
-31276,
-31279,
-31353,
+30088,
+31793,
+32574,
+31706,
+32638,
+30332,
+33548,
+31402,
+31463,
+32953,
+31394,
+34173,
+30933,
+32951,
+34012,
+32333,
+33112,
+33626,
+35227,
+32364,
+35045,
+35446,
+34177,
+35329,
+35254,
+36690,
+34046,
+36697,
+36381,
+35408,
+36656,
+35446,
+37443,
+34913,
+35716,
+36428,
+35383,
+34970,
+35300,
+35854,
+33010,
+35117,
+34568,
+33012,
+33550,
+32873,
+33435,
+31703,
+32812,
+32424,
+31011,
+33006,
 31375,
+31201,
+31986,
+31457,
 31441,
-31516,
-31596,
-31717,
-31809,
-31909,
-31994,
-32068,
-32141,
-32239,
-32297,
-32434,
-32495,
-32593,
-32675,
-32707,
-32785,
-32829,
-32909,
-32993,
-33073,
-33161,
-33218,
-33277,
-33290,
-33318,
-33332,
-33344,
-33387,
-33387,
-33411,
-33374,
-33372,
-33315,
-33295,
-33265,
-33265,
-33251,
-33269,
-33224,
-33244,
-33179,
-33175,
-33129,
-33115,
-33101,
-33078,
-33060,
-33015,
-32973,
-32938,
-32880,
-32877,
-32842,
-32829,
-32822,
-32795,
-32778,
-32748,
-32728,
-32713,
-32712,
-32706,
-32722,
-32704,
-32700,
-32676,
-32658,
-32654,
-32648,
-32673,
-32698,
-32720,
-32736,
-32733,
-32754,
-32730,
-32763,
-32733,
+30806,
+32538,
+31113,
+30998,
+33691,
+30308,
 32777,
-32756,
-32773,
+33228,
+31241,
+32856,
+32499,
+33530,
+31695,
+33652,
+34473,
+31824,
+34949,
+32980,
+33866,
+34862,
+32383,
+35414,
+33254,
+34167,
+34592,
+32835,
+35673,
 32761,
-32739,
-32723,
-32681,
-32684,
-32653,
-32664,
-32657,
-32675,
-32666,
-32691,
-32677,
-32705,
-32716,
-32736,
-32750,
-32770,
-32771,
-32812,
-32792,
-32822,
-32832,
-32836,
-32866,
-32864,
-32898,
-32895,
-32919,
-32922,
-32936,
-32959,
-32934,
-32964,
-32913,
-32917,
-32841,
-32812,
-32741,
-32684,
-32633,
-32563,
-32505,
-32450,
-32392,
-32327,
-32277,
-32221,
-32206,
-32154,
-32177,
-32126,
-32153,
-32102,
-32104,
-32068,
-32053,
-32027,
-32036,
-32009,
-32054,
+34173,
+35321,
+31900,
+35228,
+33103,
+33221,
+33687,
+32367,
+35065,
+30857,
+32968,
+33627,
+30283,
+33223,
+31870,
+31945,
+30499,
+31539,
+32872,
+28440,
+32007,
+32384,
+28481,
+31208,
+31399,
+31361,
+29214,
+31204,
+32693,
+29014,
+31671,
+31313,
+31982,
+30312,
+30893,
+34001,
+30292,
+31679,
+32081,
+33547,
+30491,
+30855,
+35794,
+30295,
+31007,
+35347,
+31836,
+29918,
+34282,
+33336,
+30409,
+32511,
+33106,
+32737,
+31227,
+32800,
+33441,
+30980,
+31790,
+32307,
+32896,
+31073,
+30444,
+33601,
+30946,
+30795,
+32303,
+32302,
+31673,
+29829,
+33145,
+31575,
+30438,
+32447,
+32270,
+30689,
+31691,
+34394,
+30584,
+32173,
+33890,
+32489,
+32041,
+33819,
+34770,
+32632,
+34781,
+34171,
+35147,
+34840,
+33605,
+36757,
+34892,
+34407,
+36418,
+36234,
+34878,
+35473,
+36073,
+35011,
+35094,
+34923,
+35743,
+34028,
+34944,
+35201,
+33012,
+34658,
+34100,
+33957,
+31904,
+33572,
+34927,
+30983,
+33327,
+33397,
 32036,
-32064,
-32062,
-32072,
-32075,
-32091,
-32105,
-32121,
-32158,
-32137,
-32182,
+31476,
+31821,
+33803,
+30831,
+31114,
+33041,
+31976,
+30661,
+31786,
+33295,
+30286,
+31920,
+33155,
+31675,
+32272,
+32636,
+33242,
+32407,
+32817,
+33543,
+32876,
+33295,
+33113,
+34372,
+33511,
+33942,
+34404,
+33685,
+34369,
+33702,
+34271,
+34444,
+33712,
+34289,
+33689,
+33700,
+33566,
+34073,
+32882,
+33199,
+33193,
+32509,
+33547,
+31910,
+32392,
+33398,
+31149,
+31362,
+32841,
+31072,
+30633,
+32144,
+31186,
+31336,
+30765,
+31193,
+32788,
+28980,
+31412,
+32302,
+29526,
+31102,
+32129,
+31283,
+30336,
+31374,
+32416,
+32065,
+30296,
+32977,
+31543,
+30443,
+33336,
+31871,
+30932,
+31851,
+32678,
+30106,
+31606,
+33349,
+30392,
+31521,
+30458,
+33230,
+31036,
+29466,
+33947,
+30624,
+31239,
+31992,
+31972,
+31863,
+31247,
+32776,
+32549,
+32463,
+32953,
+33857,
+33466,
+32455,
+34436,
+34860,
+32937,
+34137,
+35542,
+34815,
+33456,
+36059,
+36252,
+34558,
+36130,
+34712,
+35121,
+35523,
+34719,
+35093,
+35149,
+35669,
+34200,
+34656,
+34816,
+34471,
+34327,
+33730,
+33970,
+34195,
+34302,
+31950,
+33800,
+33947,
+31458,
+32425,
+32420,
+33096,
+30911,
+31237,
+33555,
+30982,
+31225,
+31751,
+31841,
+31404,
+31209,
+32152,
+31181,
 32117,
-32138,
-32073,
-32061,
-32018,
-32008,
-31975,
+31923,
+31689,
+32004,
+32527,
+31638,
+32493,
+33017,
 31975,
-31955,
-31964,
-31962,
-31980,
-32001,
-32031,
-32075,
-32108,
-32164,
-32177,
-32243,
-32253,
-32289,
-32308,
-32323,
-32340,
-32344,
-32376,
-32379,
-32446,
-32469,
-32550,
-32625,
-32681,
-32774,
-32838,
-32931,
-33024,
-33125,
-33231,
-33339,
-33441,
-33546,
+32916,
+33864,
+33252,
+33140,
+34002,
 33619,
-33704,
-33758,
-33851,
-33921,
-34018,
-34094,
-34193,
-34249,
-34318,
-34357,
-34390,
-34413,
-34438,
-34449,
-34470,
-34455,
-34472,
-34422,
-34422,
-34365,
-34351,
-34315,
-34292,
-34279,
-34267,
-34273,
-34256,
-34276,
-34267,
-34275,
-34271,
-34260,
-34247,
-34243,
-34224,
-34222,
-34212,
-34211,
-34187,
-34179,
-34144,
-34117,
-34090,
-34059,
-34039,
-34031,
-34015,
-33999,
+33133,
+34186,
 33962,
-33908,
-33857,
-33784,
-33729,
-33668,
-33620,
-33593,
-33546,
-33523,
-33472,
-33432,
-33408,
-33363,
-33369,
-33350,
-33357,
 33370,
-33374,
-33369,
-33359,
-33332,
-33311,
-33288,
-33267,
-33253,
-33241,
-33222,
-33220,
-33196,
-33208,
-33176,
-33200,
-33185,
-33227,
-33225,
-33272,
-33280,
-33331,
-33352,
-33395,
-33421,
-33455,
-33497,
-33523,
-33588,
-33617,
-33691,
-33738,
-33810,
-33856,
-33920,
-33966,
-34000,
-34045,
-34090,
-34118,
-34169,
-34190,
-34223,
-34241,
-34238,
-34235,
-34240,
-34241,
-34262,
-34263,
-34306,
-34301,
-34349,
-34338,
-34374,
-34372,
-34396,
-34406,
-34433,
-34430,
-34466,
-34442,
-34436,
-34423,
-34388,
-34355,
-34320,
-34274,
-34237,
-34178,
-34127,
-34043,
-33991,
-33890,
-33803,
-33702,
-33602,
-33495,
-33396,
-33294,
-33195,
-33103,
-32995,
-32899,
-32801,
-32718,
-32631,
-32569,
-32496,
+34106,
+32779,
+33752,
+35518,
+31634,
+33553,
+34859,
+32209,
+33318,
+32829,
+33958,
+31531,
+31752,
+33764,
+32506,
+32449,
+32041,
+32778,
+32769,
+32222,
+32529,
+32817,
+31671,
+32135,
+32739,
+32544,
+32515,
+31237,
+31990,
+33145,
+32212,
+31860,
 32467,
-32402,
-32373,
-32307,
-32266,
-32196,
-32147,
-32079,
-32040,
-31955,
-31927,
-31823,
-31777,
-31682,
-31614,
-31535,
-31450,
-31405,
-31308,
-31276,
-31199,
-31161,
-31106,
-31076,
-31017,
-30993,
-30937,
-30903,
-30857,
-30823,
-30795,
-30762,
-30757,
-30720,
-30702,
-30667,
-30647,
-30595,
-30581,
-30553,
-30547,
-30547,
-30535,
-30528,
-30514,
-30490,
-30472,
-30461,
-30448,
-30468,
-30469,
-30477,
-30482,
-30476,
-30457,
-30439,
-30419,
-30381,
-30383,
-30342,
-30335,
-30300,
-30273,
-30252,
-30222,
-30204,
-30195,
-30192,
-30182,
-30192,
-30180,
-30188,
-30188,
-30180,
-30192,
-30160,
-30163,
-30124,
-30101,
-30074,
-30049,
-30035,
-30035,
-30025,
-30050,
-30037,
-30043,
-30031,
-30029,
-30002,
-30005,
-29987,
-29978,
-29947,
-29927,
-29864,
-29851,
-29795,
-29808,
-29831,
-29895,
-29996,
-30104,
-30267,
-30414,
-30583,
-30754,
-30913,
-31082,
-31193,
-31318,
-31382,
-31419,
-31426,
-31382,
-31333,
-31251,
-31177,
-31090,
-31041,
-30981,
-30978,
-30978,
-31032,
-31083,
-31176,
-31239,
-31350,
-31402,
-31482,
-31520,
-31567,
-31591,
-31601,
-31620,
-31610,
-31618,
-31635,
-31633,
-31738,
-31790,
-31965,
-32104,
-32327,
-32523,
-32755,
-32968,
-33190,
-33397,
-33603,
-33786,
-33967,
-34115,
-34244,
-34349,
-34439,
-34521,
-34586,
-34666,
-34734,
-34806,
-34876,
-34953,
-35026,
-35102,
-35163,
-35218,
-35266,
-35295,
-35331,
-35341,
-35384,
-35419,
-35473,
-35545,
-35603,
-35684,
-35777,
-35863,
-35997,
-36089,
-36251,
-36381,
-36509,
-36641,
-36720,
-36813,
-36853,
-36899,
-36908,
-36938,
-36937,
-36944,
-36932,
-36912,
-36893,
-36846,
-36823,
-36768,
-36748,
-36684,
-36651,
-36552,
-36491,
-36363,
-36275,
-36116,
-36000,
-35833,
-35702,
-35530,
-35405,
-35249,
-35158,
-35026,
-34973,
-34866,
-34840,
-34749,
-34730,
-34644,
-34623,
-34561,
-34542,
-34481,
-34431,
-34345,
-34258,
-34150,
-34053,
-33929,
-33836,
-33718,
-33625,
-33503,
-33397,
-33246,
+32314,
+31218,
+31813,
+32436,
+31816,
+31530,
+30495,
+32757,
+32578,
+30758,
+31889,
+31424,
+31749,
+31877,
+31408,
+31583,
+32532,
+30751,
+31155,
+33276,
+32283,
+32758,
+32429,
+32438,
+32753,
+33205,
+33652,
+33432,
+34268,
+33270,
+32862,
+34064,
+34129,
+33784,
+34283,
+33378,
+32627,
+34727,
+34107,
+32811,
+33234,
+33597,
+33340,
+31648,
+32704,
+33893,
+31938,
+31153,
+32793,
+33478,
+31507,
+32062,
+32559,
+31817,
+31859,
+31668,
+32539,
+31503,
+31536,
+33891,
+31680,
+31292,
+34332,
+33032,
+30751,
+31372,
+33862,
+34367,
+31228,
+32176,
+35385,
+33700,
+30950,
+33389,
+35115,
+32325,
+32154,
+33746,
+34966,
+33615,
+32133,
+34971,
+34876,
+32272,
 33141,
-32977,
-32873,
-32719,
-32611,
-32461,
-32337,
-32180,
-32039,
-31883,
-31739,
-31609,
-31475,
-31363,
-31240,
-31124,
-31023,
-30895,
-30819,
-30687,
-30635,
-30506,
-30463,
-30362,
-30301,
-30229,
-30178,
-30134,
-30106,
-30092,
-30077,
-30089,
-30084,
-30115,
-30120,
-30161,
-30193,
-30220,
-30264,
-30283,
-30310,
-30326,
-30347,
-30361,
-30387,
-30422,
-30447,
-30486,
-30498,
-30556,
-30557,
-30633,
-30660,
-30737,
-30798,
-30867,
-30936,
-31015,
-31067,
-31172,
-31224,
-31343,
-31446,
-31550,
-31679,
-31771,
-31899,
-31999,
-32135,
-32232,
-32388,
-32473,
-32631,
-32702,
-32834,
-32911,
-33012,
-33094,
-33197,
-33258,
-33372,
-33420,
-33523,
-33577,
+33768,
+33975,
+33067,
+33276,
+35289,
+32456,
+32986,
+34582,
+32696,
+33390,
+33030,
+33991,
+32545,
+31634,
+34496,
+33303,
+31974,
+32500,
+33344,
+32497,
+31817,
+33225,
 33644,
-33721,
-33758,
-33836,
-33861,
-33927,
-33940,
-33984,
-34010,
-34032,
-34070,
-34075,
-34132,
-34118,
-34187,
-34169,
-34240,
-34236,
-34294,
-34324,
-34372,
-34419,
-34432,
-34488,
-34490,
-34522,
-34542,
-34568,
-34585,
-34615,
-34608,
-34620,
-34620,
-34595,
-34606,
-34574,
-34589,
-34555,
-34556,
-34508,
-34492,
-34451,
-34424,
-34390,
-34362,
+32496,
+31232,
+34702,
+34540,
+30210,
+34091,
+35661,
+31132,
+31048,
+35364,
+35717,
+31160,
+31725,
+35244,
+34518,
+30852,
+31980,
+36837,
+32882,
+29486,
+34636,
+35282,
+31497,
+30245,
+34008,
+34304,
+29665,
+32175,
 34345,
-34329,
-34303,
-34283,
-34255,
-34256,
-34218,
-34222,
-34196,
-34181,
-34181,
+32253,
+30302,
+31950,
+34310,
+31801,
+29742,
+33409,
+33973,
+29952,
+31203,
+35167,
+31201,
+28727,
+32960,
+33038,
+30983,
+30724,
+33298,
+32887,
+30511,
+30823,
+32729,
+31379,
+30827,
+31801,
+30957,
+32481,
+31473,
+31618,
+31235,
+31049,
+32349,
+30858,
+32440,
+31905,
+31621,
+32634,
+31444,
+32541,
+31604,
+33515,
+33224,
+30419,
+33448,
+35335,
+33422,
+31338,
+33636,
+35842,
+31843,
+30641,
+35974,
+35279,
+29703,
+33438,
+36061,
+32302,
+31199,
 34138,
-34129,
-34092,
-34078,
-34059,
-34052,
-34037,
-34025,
-34029,
-34008,
-34026,
-34000,
+35629,
+30497,
+30900,
+34721,
+34796,
+30647,
+30191,
+36528,
+33703,
+29039,
+32236,
+36029,
+33610,
+29205,
+32545,
+36545,
+32346,
+30504,
 34030,
-34003,
-34019,
-34006,
-33965,
-33964,
-33877,
-33868,
-33786,
-33750,
-33691,
-33633,
-33579,
-33510,
-33457,
-33391,
-33356,
-33328,
-33307,
-33288,
-33274,
-33242,
-33218,
-33180,
-33138,
-33105,
-33053,
-33037,
-32966,
-32939,
-32851,
-32790,
-32699,
-32634,
-32566,
-32503,
-32469,
-32394,
-32359,
-32268,
-32219,
-32133,
-32073,
-32006,
-31965,
-31900,
+35621,
+34323,
+30909,
+33227,
+36586,
+33558,
+31275,
+33794,
+35911,
+34324,
+32855,
+34921,
+35185,
+33575,
+33934,
+35252,
+32797,
+32671,
+35973,
+35876,
+33039,
+32054,
+36478,
+36304,
+31710,
+32399,
+35719,
+35116,
+31120,
+31943,
+36889,
+34154,
+30115,
+32225,
+33618,
+33652,
+30951,
+31122,
+32367,
+30899,
+32076,
+31734,
+30758,
+31339,
+30999,
+31431,
+30346,
+31002,
+31910,
+31145,
+31519,
+31065,
+32336,
+32520,
+32214,
+32794,
+31612,
+32522,
+32757,
+33097,
+33076,
+32091,
+33775,
+32870,
+32722,
+34453,
+33380,
+32779,
+33864,
+33616,
+33117,
+33788,
+32641,
+33244,
+33165,
+32028,
+34424,
+32685,
+32307,
+34148,
+32351,
+33009,
+32092,
+31840,
+33343,
+31698,
+30925,
+32319,
+33126,
+31564,
+31351,
+31571,
+31340,
+31844,
+30670,
+31469,
+31999,
+31376,
+30545,
+31370,
+31904,
+30944,
+31334,
+31127,
+31586,
+30813,
 31875,
-31794,
-31768,
-31701,
-31696,
-31645,
-31685,
-31656,
-31712,
-31706,
-31731,
-31759,
-31771,
-31818,
-31831,
-31884,
-31898,
-31941,
-31928,
-31958,
-31936,
-31967,
-31968,
-32001,
-32038,
-32056,
-32099,
-32116,
-32159,
-32196,
-32247,
-32333,
-32382,
-32470,
-32527,
-32585,
-32643,
-32687,
-32734,
-32807,
 32862,
-32959,
-33008,
-33094,
-33145,
-33189,
-33269,
-33315,
-33407,
-33486,
-33569,
-33652,
-33692,
-33768,
-33786,
-33830,
-33876,
-33916,
-33979,
-34018,
-34072,
-34098,
-34143,
-34192,
-34231,
-34316,
-34362,
-34457,
-34502,
-34566,
-34598,
-34622,
-34650,
-34653,
-34668,
-34656,
-34632,
-34600,
-34539,
-34489,
-34410,
-34346,
-34284,
-34218,
-34173,
-34073,
-34021,
-33908,
+32547,
+31769,
+32184,
+33645,
+32594,
+32361,
+33890,
+33775,
+32309,
+32711,
+34244,
+34639,
+32591,
+33027,
+33752,
+33355,
+33599,
+33773,
+33304,
+32540,
+33711,
+33381,
+32614,
+33462,
+32779,
+33162,
+32837,
+32066,
+32733,
+33405,
+33349,
+32186,
+32321,
+33449,
+33186,
+32520,
+33082,
+33250,
+33442,
+33170,
+33371,
+33476,
+33593,
+33981,
+32792,
+32889,
+33720,
+33956,
+33403,
+33099,
+34333,
 33813,
-33716,
-33581,
-33494,
-33362,
-33233,
-33101,
-32938,
-32783,
-32626,
-32467,
-32344,
-32207,
-32089,
-31977,
-31866,
-31747,
-31650,
-31523,
-31450,
-31325,
-31248,
-31135,
-31043,
-30914,
-30794,
-30664,
-30537,
-30436,
-30322,
-30217,
-30130,
-30030,
-29932,
-29869,
-29740,
-29702,
-29601,
-29555,
-29488,
-29424,
-29357,
-29313,
-29223,
-29209,
-29135,
-29145,
-29120,
-29128,
-29144,
-29156,
-29196,
-29216,
-29266,
-29318,
-29371,
-29446,
-29483,
-29571,
-29582,
-29684,
-29682,
-29768,
-29810,
-29881,
-29962,
-30041,
-30127,
-30220,
-30324,
-30434,
-30537,
-30669,
-30773,
-30897,
-31010,
-31108,
-31192,
-31294,
-31352,
-31451,
-31502,
-31588,
-31636,
-31714,
-31750,
-31829,
-31864,
-31947,
-31975,
-32063,
-32079,
-32145,
+33389,
+34138,
+33430,
+33196,
+33447,
+33365,
+32919,
+33794,
+33470,
+33328,
+33333,
+33302,
+33394,
+32834,
+32765,
+32561,
+32882,
+32607,
+32612,
+32900,
+32948,
 32138,
-32184,
-32163,
-32184,
-32160,
-32166,
-32154,
-32148,
-32131,
-32125,
-32120,
-32119,
-32141,
-32161,
-32195,
-32236,
-32274,
-32299,
-32316,
-32319,
-32322,
-32293,
-32298,
-32234,
-32212,
-32144,
-32075,
-32011,
-31927,
-31888,
-31814,
-31802,
-31757,
-31764,
-31754,
-31759,
-31786,
-31793,
-31820,
-31846,
-31867,
-31880,
-31894,
-31899,
-31896,
-31893,
-31893,
-31894,
-31911,
-31928,
-31938,
+32616,
+33088,
+31550,
+32596,
+32792,
+31513,
+32568,
+32428,
+32150,
+32199,
+32635,
+32539,
 31962,
-31990,
-32004,
-32051,
-32080,
-32121,
-32155,
-32160,
-32191,
-32172,
-32186,
-32159,
-32163,
-32143,
-32177,
-32161,
-32204,
-32226,
-32256,
-32329,
-32357,
-32465,
-32514,
-32634,
-32708,
-32816,
-32883,
-32973,
-33034,
-33100,
-33195,
-33236,
-33358,
-33407,
-33531,
-33598,
-33725,
-33809,
-33949,
-34047,
-34184,
-34297,
-34419,
-34525,
-34630,
-34710,
-34803,
-34869,
-34949,
-35011,
-35066,
-35125,
-35184,
-35247,
-35334,
-35397,
-35514,
-35593,
-35704,
-35799,
-35889,
-35993,
-36055,
-36166,
-36229,
-36312,
-36390,
-36421,
-36488,
-36503,
-36538,
-36547,
-36584,
-36603,
-36628,
-36657,
-36649,
-36674,
-36646,
-36644,
-36625,
-36598,
-36567,
-36534,
-36475,
-36437,
-36358,
-36303,
-36243,
-36171,
-36126,
-36056,
-36021,
-35967,
-35927,
-35888,
-35837,
-35791,
-35745,
-35675,
-35620,
-35536,
-35455,
-35376,
-35278,
-35197,
-35092,
-35009,
-34913,
-34827,
-34743,
-34648,
-34583,
-34493,
-34439,
-34348,
-34270,
-34185,
-34080,
-33983,
-33874,
-33750,
-33648,
-33515,
-33398,
+32923,
+32414,
+32703,
+33206,
+32633,
+33109,
+32870,
+33506,
+33079,
+32844,
+33720,
+33768,
+33730,
+33176,
+33697,
+33589,
+33205,
+33757,
+33470,
+33252,
+33380,
+33538,
 33288,
-33170,
-33078,
-32967,
-32884,
-32797,
-32719,
-32642,
-32571,
-32501,
-32416,
-32354,
-32263,
-32176,
-32098,
-31985,
-31913,
-31793,
-31720,
-31642,
-31574,
-31520,
-31468,
-31436,
-31400,
-31393,
-31375,
-31390,
-31409,
-31427,
-31454,
-31467,
-31481,
-31508,
-31503,
-31538,
-31536,
-31567,
-31588,
-31607,
-31638,
-31672,
-31701,
-31752,
-31814,
-31867,
-31952,
-32015,
-32078,
-32166,
-32208,
-32300,
-32336,
-32411,
-32461,
 32528,
+33333,
+32823,
+32000,
+32152,
+32217,
+32725,
+32125,
+31822,
+32063,
+31444,
+31127,
+31578,
+31598,
+31399,
+31184,
+30871,
+31612,
+31785,
+31419,
+32366,
+31719,
+31306,
+31901,
+32379,
+32077,
+32135,
+32773,
+32209,
+31815,
+32335,
+32942,
+32420,
+31913,
+32532,
+32607,
+32111,
+32607,
+32930,
+32279,
+32192,
+32359,
+32575,
+32359,
+32339,
+33004,
+32385,
+32604,
+32772,
+32738,
+32613,
+32426,
+32992,
+33095,
+32848,
+32454,
+32952,
+33095,
+32918,
+33435,
 32572,
-32640,
-32690,
-32767,
-32842,
+32497,
+32973,
+32572,
+33259,
+33016,
+32619,
+32927,
+32988,
+32905,
+32854,
+33443,
 32928,
-33029,
-33114,
-33248,
-33319,
-33441,
-33538,
-33627,
+32854,
+32724,
+32540,
+33408,
+33253,
+33011,
+33073,
+32905,
+33083,
+33063,
+33378,
+32992,
+32695,
+33088,
+33245,
+33241,
+32961,
+32988,
+33287,
+33376,
+33044,
+33373,
 33732,
-33809,
-33881,
-33952,
-34001,
-34038,
-34079,
-34120,
-34162,
-34207,
-34245,
-34312,
-34336,
-34399,
-34435,
-34481,
-34530,
-34562,
-34597,
-34623,
-34641,
-34635,
-34622,
-34609,
-34587,
-34584,
-34548,
-34547,
-34538,
-34518,
-34529,
-34502,
-34505,
-34515,
-34505,
-34511,
-34487,
-34477,
-34449,
-34408,
-34378,
-34325,
-34282,
-34236,
-34183,
-34130,
-34090,
-34023,
-33994,
-33949,
-33906,
-33889,
-33828,
-33807,
-33756,
-33703,
-33670,
-33595,
-33551,
-33486,
+33314,
+33427,
+33635,
+33632,
+33676,
 33422,
-33357,
-33287,
-33207,
-33148,
+33816,
+33758,
+33775,
+33731,
+33695,
+33924,
+33840,
+34103,
+33142,
+33589,
+34158,
+33490,
+33272,
 33063,
-33023,
-32922,
-32892,
-32806,
-32736,
+33128,
+33437,
+33216,
+32958,
+33220,
+32744,
+32702,
+32697,
+32671,
+33060,
+32621,
+32317,
+32319,
+32567,
+32721,
+32636,
+32061,
+32045,
 32676,
-32588,
-32529,
-32443,
-32373,
-32302,
-32230,
-32157,
-32082,
-32008,
-31947,
-31879,
-31839,
-31771,
-31754,
-31688,
-31661,
-31608,
-31574,
-31517,
-31476,
-31413,
-31367,
-31286,
-31227,
-31134,
-31060,
-30976,
-30891,
-30825,
-30727,
-30678,
-30588,
-30541,
-30455,
-30423,
-30342,
-30309,
-30248,
-30195,
-30150,
-30086,
-30019,
-29977,
-29887,
-29851,
-29784,
-29726,
-29679,
-29612,
-29585,
-29525,
-29500,
-29450,
-29415,
-29393,
-29344,
-29321,
-29284,
-29248,
-29208,
-29192,
-29132,
-29148,
-29100,
-29124,
-29112,
-29132,
-29171,
-29193,
-29265,
-29291,
-29374,
-29390,
-29475,
-29498,
-29552,
-29582,
-29591,
-29615,
-29619,
-29614,
-29628,
-29614,
-29635,
-29640,
-29657,
-29693,
-29718,
-29759,
-29799,
-29840,
-29878,
-29926,
-29953,
-29977,
-30011,
-30007,
-30033,
-30039,
-30024,
-30047,
-30040,
-30060,
-30092,
-30095,
-30168,
-30176,
-30273,
-30291,
-30388,
-30419,
-30504,
-30534,
-30583,
-30617,
-30618,
-30659,
-30611,
-30650,
-30595,
-30618,
-30603,
-30624,
-30657,
-30720,
-30803,
-30918,
-31049,
-31211,
-31387,
-31580,
-31768,
+32138,
+31906,
+32246,
+32310,
+32263,
+31770,
+31673,
+32363,
+32242,
+32050,
+32017,
+32077,
+31925,
+31884,
+32407,
+32569,
+32353,
+31471,
+31720,
+32184,
+32419,
+32249,
 31957,
-32135,
-32298,
-32436,
-32543,
-32634,
-32686,
-32731,
-32742,
-32755,
-32756,
-32755,
-32754,
-32763,
-32778,
-32804,
-32829,
-32876,
+31820,
+32004,
+32330,
+32078,
+32482,
+32187,
+32245,
+32990,
+32313,
+32671,
+33098,
+32662,
+33284,
+33211,
+33185,
+33294,
+33427,
+33551,
+32885,
+33873,
+33862,
+32840,
+33254,
+33096,
+33722,
+33227,
+33052,
+33482,
+32627,
+32902,
+32713,
+32717,
+32323,
+32235,
+33032,
+32266,
+32029,
+32527,
+32471,
+31946,
+31633,
+32171,
+32378,
+31696,
+32012,
+32641,
+32332,
+32051,
+32323,
+32578,
+32202,
+32129,
+32743,
+32739,
+32352,
+32525,
+33040,
+32620,
+32457,
+32820,
+32518,
+32953,
+32937,
+32852,
+32816,
+32740,
+33077,
+32810,
+32652,
+33341,
+33021,
+32772,
+33401,
+33237,
+33041,
+33661,
+33596,
+32952,
+33501,
+33628,
+33536,
+33751,
+33726,
+34038,
+33628,
+33525,
+33874,
+33725,
+34082,
+33865,
+33871,
+33820,
+33035,
+33759,
+34080,
+33449,
+33181,
+33226,
+33560,
+33166,
+32997,
+32949,
+32818,
+32768,
+32978,
+32760,
+32299,
+32524,
+32371,
+32530,
+32160,
+31644,
+32072,
+32224,
+32273,
+31863,
+31937,
+31832,
+31639,
+31965,
+31906,
+31966,
+32140,
+31841,
+31921,
+32096,
+32157,
+31720,
+31893,
+32730,
+32464,
+31977,
+31978,
+32201,
+32396,
+32554,
+32485,
+32131,
+32060,
+32624,
+32684,
+32700,
+32780,
+32598,
+32638,
+32375,
+32384,
+33033,
+32794,
+32182,
+33077,
+33232,
+32173,
+32681,
+33061,
+32656,
+32390,
+33052,
+33116,
+32907,
+32942,
+33180,
+33131,
+32977,
+33426,
+33261,
+33166,
+33051,
+33472,
+33553,
+33092,
+33620,
+33517,
+33019,
+33110,
+33086,
+33536,
+33150,
+32843,
+33296,
+33034,
+33210,
+32821,
+32539,
+33146,
+32518,
+32743,
+32783,
+32706,
+32874,
+32264,
+32809,
+32597,
+32749,
+32490,
+32560,
+32837,
+32513,
+32826,
+32866,
+32790,
+32450,
+32895,
+32978,
+32516,
+32736,
+32852,
+32810,
+32852,
+32597,
+32341,
+32313,
+32299,
+32637,
+32740,
+32324,
+32282,
+32232,
+32038,
+32010,
+32340,
+32256,
+32408,
+32462,
+32087,
+32033,
+32729,
+33188,
+32380,
+32541,
+32740,
+32743,
+32998,
 32893,
+33396,
+33170,
+33012,
+33344,
+33391,
+33563,
+33177,
+33144,
+33562,
+33222,
+33286,
+33359,
+33429,
+33136,
+33173,
+33304,
+33084,
+33078,
+32848,
+33156,
+32918,
+32907,
 32961,
-32957,
+32624,
+32927,
+33007,
+32669,
+32476,
+32462,
+32758,
+32514,
+32230,
+32598,
+32647,
+32370,
+32197,
+32223,
+32827,
+32372,
+32048,
+32404,
+32565,
+32576,
+32595,
+32673,
+32569,
+32879,
+32838,
+32441,
+32725,
+32915,
+32565,
+32731,
+33047,
+33047,
+32678,
+32774,
+32944,
+32737,
+32690,
+32801,
+32758,
+32719,
+32910,
+32936,
+32857,
+32678,
+32693,
+32654,
+32772,
+32610,
+32514,
+32460,
+32423,
+32816,
+32577,
+32530,
+32732,
+32526,
+32524,
+32827,
+32816,
+32312,
+32623,
+33009,
+32844,
+32923,
+32791,
+32907,
+32993,
+32694,
+32832,
+33295,
+32591,
+32833,
+33458,
+33255,
+32914,
+32713,
+33367,
+33041,
+32909,
+33137,
+33220,
+32929,
+32839,
+33454,
+32860,
+32832,
+32883,
+32783,
+33181,
+32494,
+32418,
+33089,
+32790,
+32462,
+32704,
+32684,
+32396,
+32361,
+32640,
+32596,
+32504,
+32361,
+32672,
+32981,
+32544,
+32602,
+32629,
+32498,
+32477,
+32661,
+32782,
+32782,
+32690,
+32964,
+32715,
+32373,
+32746,
+32668,
+32910,
+32906,
+32554,
+32901,
 33001,
-33009,
-33008,
-33007,
-32987,
-32963,
-32955,
-32930,
+32804,
+33155,
 32940,
+32803,
+32883,
+32883,
+32902,
+32718,
+32762,
+32927,
+32656,
+32496,
+32816,
+32565,
+32712,
+32771,
+32601,
+32698,
+32310,
+32703,
+32735,
+32655,
+32799,
+32599,
+32783,
+32929,
+32809,
+32679,
+33108,
+33032,
+32728,
+33014,
+33120,
+32873,
 32947,
-32969,
-33027,
-33058,
-33152,
-33204,
-33306,
-33382,
-33468,
-33568,
-33633,
-33724,
-33777,
-33867,
-33898,
-33979,
-34027,
-34084,
-34142,
-34204,
-34254,
-34328,
-34372,
-34415,
-34476,
-34476,
-34530,
-34511,
-34533,
-34533,
-34519,
-34508,
-34509,
-34498,
-34509,
-34523,
-34544,
-34584,
-34640,
-34700,
-34776,
-34861,
-34956,
-35046,
-35130,
-35225,
-35304,
-35396,
-35443,
-35535,
-35561,
-35646,
-35654,
-35713,
-35728,
-35755,
-35778,
-35793,
-35815,
-35823,
-35832,
-35841,
-35826,
-35838,
-35804,
-35804,
-35768,
-35744,
-35699,
-35673,
-35619,
-35584,
-35532,
-35495,
-35432,
-35414,
-35337,
-35334,
-35256,
-35255,
-35178,
-35157,
-35101,
-35048,
-35014,
-34942,
-34916,
-34852,
-34805,
-34780,
-34720,
-34704,
-34667,
-34642,
-34622,
-34586,
-34561,
-34535,
-34493,
-34450,
-34382,
-34336,
-34254,
-34178,
-34088,
-34002,
-33916,
-33815,
-33747,
-33630,
+33238,
+33247,
+32963,
+32943,
+33217,
+32988,
+32784,
+33192,
+33200,
+32912,
+32871,
+32784,
+33120,
+33019,
+32963,
+32889,
+32583,
+32771,
+32802,
+33155,
+32805,
+32348,
+32923,
+32803,
+32753,
+32945,
+32728,
+32559,
+32771,
+32793,
+32722,
+32913,
+32441,
+32400,
+32755,
+32815,
+32740,
+32366,
+32378,
+32375,
+32425,
+32420,
+32222,
+32262,
+32362,
+32048,
+32118,
+32479,
+32277,
+32190,
+32052,
+32027,
+32298,
+32199,
+32160,
+32047,
+32475,
+32516,
+32227,
+32416,
+32483,
+32565,
+32505,
+32563,
+32605,
+33057,
+33185,
+32802,
+33216,
+33056,
+33116,
+33405,
+33172,
+33368,
+33346,
+33545,
+33402,
+33464,
+33659,
+33319,
+33401,
+33504,
+33313,
+33309,
+33324,
+33108,
+32951,
+33113,
+32758,
+32865,
+33042,
+32625,
+32482,
+32402,
+32291,
+32262,
+32191,
+31980,
+31845,
+31852,
+32089,
+32021,
+31938,
+31660,
+31755,
+31791,
+31711,
+31797,
+32005,
+32208,
+31837,
+32214,
+32749,
+32357,
+32176,
+32546,
+32808,
+32721,
+33032,
+33116,
+32953,
+33207,
+33387,
+33349,
+33217,
+33550,
 33582,
-33471,
-33411,
-33317,
-33237,
-33167,
-33068,
-32994,
-32903,
-32807,
-32726,
-32638,
-32536,
-32471,
-32377,
-32323,
+33271,
+33650,
+33822,
+33566,
+33667,
+33637,
+33708,
+33740,
+33855,
+33721,
+33697,
+33879,
+33624,
+33840,
+33886,
+33593,
+33721,
+33899,
+33595,
+33584,
+33632,
+33828,
+33626,
+33308,
+33490,
+33517,
+33451,
+33339,
+33355,
+33262,
+33111,
+33062,
+33085,
+32988,
+32836,
+32800,
+32767,
+32538,
+32447,
+32531,
+32293,
+32196,
+32124,
+32030,
+31963,
+31821,
+31847,
+31845,
+31603,
+31664,
+31541,
+31485,
+31821,
+31439,
+31421,
+31689,
+31585,
+31412,
+31735,
+31808,
+31609,
+31842,
+31564,
+32026,
+31927,
+31842,
+32284,
+32014,
 32241,
 32189,
-32143,
-32095,
-32059,
-32025,
-31989,
-31953,
-31930,
-31880,
-31857,
-31801,
-31769,
-31721,
-31693,
-31631,
-31610,
-31552,
-31524,
-31490,
-31458,
-31438,
-31419,
-31404,
-31389,
-31391,
-31369,
-31383,
-31370,
-31377,
-31383,
-31401,
-31407,
-31438,
-31465,
-31493,
-31563,
-31586,
-31658,
-31723,
-31779,
-31859,
-31924,
-31980,
-32064,
-32099,
-32182,
-32195,
-32255,
-32273,
-32307,
-32336,
-32356,
-32396,
-32403,
-32470,
-32478,
+32465,
+32372,
+32248,
+32641,
+32704,
+32688,
+32769,
+33072,
+32707,
+32922,
+33196,
+33233,
+33150,
+32987,
+33314,
+33345,
+33440,
+33485,
+33387,
+33345,
+33393,
+33394,
+33318,
+33350,
+33340,
+33209,
+33192,
+33436,
+33154,
+33055,
+33140,
+33105,
+32935,
+32740,
+32998,
+32936,
+32752,
+32972,
+32991,
+32597,
+32798,
+32800,
+32597,
+32615,
+32602,
+32901,
+32562,
+32472,
+32656,
+32592,
+32636,
+32467,
 32539,
-32569,
-32623,
-32675,
-32717,
-32781,
+32667,
+32645,
+32525,
+32485,
+32610,
+32635,
+32504,
+32596,
+32741,
+32842,
+32559,
+32538,
+32858,
+32523,
+32581,
+32668,
+32670,
+32851,
+32651,
+32597,
+32847,
+32644,
+32638,
+32959,
+32827,
+32779,
+32782,
+32830,
+32914,
+32854,
+32989,
+33081,
+33109,
+32918,
+32989,
+33110,
+32967,
+32931,
+33241,
+33112,
+32901,
+33051,
+33175,
+33097,
+32953,
+33028,
+33034,
+32991,
+32900,
+32944,
+33317,
+33017,
 32815,
-32871,
-32906,
-32965,
-32973,
-33044,
-33055,
-33126,
-33154,
-33220,
-33272,
-33346,
-33417,
-33505,
-33600,
-33682,
-33798,
-33863,
-33995,
-34054,
-34148,
-34226,
-34285,
-34365,
-34387,
-34460,
-34463,
-34520,
-34535,
-34574,
-34586,
-34609,
-34647,
-34649,
-34690,
-34699,
-34717,
-34748,
-34757,
-34774,
-34786,
-34792,
-34784,
-34805,
-34775,
-34797,
-34764,
-34776,
-34745,
-34750,
-34720,
-34744,
-34702,
-34728,
-34688,
-34708,
-34689,
-34693,
-34680,
-34681,
-34666,
-34682,
-34649,
-34660,
-34632,
-34632,
-34604,
-34579,
-34573,
-34530,
-34519,
-34480,
-34451,
-34424,
-34387,
-34345,
-34322,
-34264,
-34238,
-34197,
-34158,
-34128,
-34089,
-34053,
-34021,
-33985,
-33960,
-33934,
-33907,
-33890,
-33871,
-33858,
-33861,
-33823,
-33850,
-33807,
-33821,
-33810,
-33782,
-33790,
-33764,
-33748,
-33745,
-33704,
-33695,
-33675,
-33645,
-33643,
-33597,
-33607,
-33566,
-33562,
-33538,
-33516,
-33501,
-33471,
-33437,
-33410,
-33376,
-33329,
-33298,
-33237,
-33201,
-33141,
-33091,
-33023,
-32975,
-32890,
-32848,
+32921,
+32918,
+33061,
+32874,
+33097,
+32896,
+32832,
+32938,
+32964,
+32999,
+32677,
+32892,
+32750,
+32661,
+32758,
+32858,
 32769,
-32713,
-32647,
-32585,
-32528,
-32465,
-32407,
-32364,
-32295,
-32268,
-32189,
-32157,
-32087,
-32026,
-31952,
-31876,
-31780,
-31694,
-31592,
-31479,
-31383,
-31244,
-31151,
-31021,
-30914,
-30795,
-30695,
-30571,
-30489,
-30354,
-30264,
-30152,
-30036,
-29934,
-29818,
-29700,
-29598,
-29483,
-29377,
-29285,
-29187,
-29102,
-29038,
-28951,
-28914,
-28845,
-28790,
-28758,
-28682,
-28649,
-28581,
-28518,
-28464,
-28384,
-28318,
-28250,
-28172,
-28103,
-28053,
-27981,
-27941,
-27892,
-27878,
-27841,
-27852,
-27833,
-27857,
-27853,
-27890,
-27894,
-27932,
-27950,
-27964,
-28000,
-28013,
-28045,
-28081,
-28089,
-28132,
-28146,
-28177,
-28188,
-28231,
-28243,
-28278,
-28314,
-28340,
-28392,
-28423,
-28474,
-28511,
-28571,
-28623,
-28677,
-28744,
-28807,
-28872,
-28942,
-29024,
-29079,
-29184,
-29226,
-29344,
-29403,
-29505,
-29601,
-29694,
-29803,
-29888,
-29990,
-30065,
-30164,
-30220,
-30287,
-30346,
-30389,
-30441,
-30480,
-30512,
-30566,
-30607,
-30674,
-30740,
-30838,
-30945,
-31078,
-31212,
-31373,
-31519,
-31686,
-31828,
-31965,
-32106,
-32197,
-32317,
-32403,
-32474,
-32550,
-32591,
-32672,
-32713,
+32491,
+32648,
+32563,
+32523,
+32348,
+32507,
+32715,
+32241,
+32383,
+32614,
+32631,
+32344,
+32478,
+32704,
+32499,
+32510,
+32579,
+32833,
+32562,
+32553,
+32752,
+32856,
 32785,
-32840,
-32939,
+32793,
+33062,
+32645,
+32432,
+32848,
+32918,
+32855,
+32693,
+33029,
+32744,
+32582,
+32975,
+32920,
+32775,
+32648,
+32828,
+32635,
+32779,
+32744,
+32976,
+32888,
+32646,
+32842,
+32879,
+33011,
+32597,
+32752,
+32867,
+32820,
+32858,
+32699,
+33149,
 32997,
-33122,
-33185,
-33317,
-33395,
-33496,
-33577,
-33655,
-33717,
-33772,
-33837,
-33885,
-33928,
-34009,
-34033,
-34133,
-34185,
-34282,
-34369,
-34461,
-34599,
-34673,
-34831,
-34890,
-35035,
-35106,
-35212,
-35286,
-35356,
-35427,
-35484,
-35543,
-35600,
-35651,
-35713,
-35759,
-35809,
-35856,
-35903,
-35946,
-35995,
-36018,
-36063,
-36090,
-36114,
-36145,
-36161,
-36186,
-36218,
-36238,
-36288,
-36319,
-36365,
-36431,
-36463,
-36540,
-36562,
-36637,
-36639,
-36715,
-36707,
-36771,
-36757,
-36786,
-36806,
-36778,
-36818,
-36775,
-36799,
-36762,
-36772,
-36736,
-36741,
-36681,
-36671,
-36616,
-36575,
-36509,
-36461,
-36397,
-36333,
-36289,
-36214,
-36179,
-36115,
-36086,
-36031,
-36002,
-35974,
-35932,
-35896,
-35873,
-35803,
-35780,
-35689,
-35642,
-35566,
-35480,
-35415,
-35329,
-35248,
-35195,
-35106,
-35067,
-35003,
-34947,
-34905,
-34859,
-34823,
-34772,
-34721,
-34656,
-34591,
-34505,
-34417,
-34323,
-34220,
-34110,
-34012,
-33912,
-33819,
-33733,
-33644,
-33584,
-33495,
-33458,
+32574,
+32613,
+32776,
+32773,
+32750,
+32580,
+32795,
+32956,
+32526,
+32601,
+32575,
+32784,
+32688,
+32534,
+32752,
+32655,
+32696,
+32538,
+32612,
+32876,
+32615,
+32658,
+32647,
+32559,
+32633,
+32468,
+32748,
+32666,
+32363,
+32633,
+32522,
+32330,
+32395,
+32443,
+32389,
+32384,
+32372,
+32298,
+32283,
+32415,
+32202,
+32496,
+32532,
+32346,
+32587,
+32563,
+32507,
+32535,
+32591,
+33027,
+33195,
+32794,
+33155,
+33231,
+33195,
+33331,
+33229,
+33619,
+33462,
+33416,
+33826,
+33781,
+33698,
+33908,
+33599,
+33459,
+33716,
+33462,
+33646,
+33534,
+33485,
+33646,
+33341,
+33322,
+33054,
+33015,
+33051,
+32947,
+32972,
+32991,
+32691,
+32820,
+32741,
+32423,
+32614,
+32507,
+32334,
+32375,
+32290,
+32387,
+32416,
+32267,
+32379,
+32251,
+32196,
+32159,
+32150,
+32162,
+32180,
+32408,
+32464,
+32442,
+32179,
+32333,
+32444,
+32299,
+32354,
+32426,
+32254,
+32235,
+32555,
+32442,
+32631,
+32560,
+32033,
+32288,
+32178,
+32203,
+32459,
+32457,
+32447,
+32273,
+32423,
+32305,
+32360,
+32538,
+32567,
+32514,
+32463,
+32694,
+32845,
+32630,
+32583,
+32967,
+33030,
+33092,
+33085,
+33062,
+33127,
+33174,
+33232,
+33292,
+33479,
+33617,
+33567,
+33416,
+33675,
+33677,
+33583,
+33444,
+33367,
+33531,
+33379,
+33375,
 33368,
-33320,
-33252,
-33166,
-33112,
-33002,
-32929,
-32812,
+33306,
+33232,
+33040,
+32960,
+32972,
+32814,
+32777,
+32693,
+32570,
+32643,
+32791,
+32550,
+32191,
+32435,
+32420,
+32500,
+32424,
+32423,
+32351,
+32370,
+32720,
+32475,
+32572,
+32421,
+32498,
+32563,
+32495,
+32846,
+32635,
+32551,
+32735,
+32833,
+32711,
+32717,
+32734,
+32735,
+32997,
+32672,
+32710,
+32961,
+33062,
+33036,
+32939,
+33011,
+32747,
+32832,
+33043,
+32908,
+33018,
+33046,
+32877,
+33082,
+33120,
+32995,
+33072,
+32977,
+32846,
+32907,
+33040,
+32854,
+32668,
+32700,
+32778,
 32718,
-32610,
-32490,
-32408,
-32294,
-32242,
-32153,
-32118,
-32072,
-32047,
-32039,
-32020,
-32026,
-32017,
-32021,
-32028,
-32024,
-32022,
-32016,
-32007,
-32006,
-31989,
-31990,
-31992,
-31985,
-32018,
-32009,
-32041,
-32042,
-32072,
-32066,
-32089,
-32074,
-32080,
-32060,
-32058,
-32044,
-32050,
-32046,
-32064,
-32088,
-32129,
-32170,
-32251,
-32311,
-32418,
-32489,
+32449,
+32497,
+32500,
+32387,
+32474,
+32544,
+32491,
+32593,
+32377,
+32296,
+32615,
+32420,
+32459,
+32333,
+32369,
+32684,
+32612,
+32502,
+32721,
+32629,
+32458,
+32533,
+32575,
+32739,
+32857,
+32917,
+32718,
+32861,
+32763,
+32478,
+32773,
+32837,
+33011,
+32829,
+32818,
+32853,
+32813,
+32802,
+32540,
+32676,
+32811,
+32805,
+32841,
+32736,
+32592,
+32909,
+32787,
+32776,
+32777,
+32505,
+32574,
+32639,
+32503,
+32835,
+32839,
+32724,
+33334,
+32823,
+32652,
+32809,
+32449,
+32702,
+32611,
+32605,
+32509,
+32541,
+32806,
+32889,
+33213,
+32791,
+32817,
+32894,
+32762,
+32900,
+32584,
+32636,
+32941,
+32757,
+32814,
+32913,
+32946,
+33159,
+32946,
+33051,
+32961,
+32883,
+33043,
+32847,
+32918,
+32963,
+33120,
+32997,
+32978,
+33157,
+33026,
+33104,
+32961,
+32896,
+32647,
+32860,
+32785,
+32923,
+33243,
+33009,
+32948,
+32788,
+32871,
+32759,
+32566,
+32672,
+32604,
+32482,
+32863,
+32961,
+32896,
+32799,
 32606,
-32689,
-32784,
+32912,
+32727,
+32652,
+32702,
+32487,
+32723,
+32422,
+32470,
+32543,
+32368,
+32623,
+32622,
+32979,
+32910,
+32586,
+32599,
+32332,
+32508,
+32534,
+32469,
+32566,
+32540,
+32801,
+32846,
+33190,
+33066,
+32754,
+32801,
+32651,
+32823,
+32913,
+32823,
+32892,
+32851,
+33066,
+33154,
+33038,
+33154,
+33118,
+32937,
 32864,
-32939,
-33002,
-33044,
+33086,
+32820,
+33211,
+32985,
+33212,
+33479,
+32726,
+32964,
+32730,
+33042,
+32883,
+32760,
+32852,
+32874,
+33052,
+32857,
+33120,
+32833,
+32626,
+32465,
+32592,
+32677,
+32615,
+32597,
+32495,
+32769,
+32478,
+32517,
+32557,
+32361,
+32360,
+32455,
+32434,
+32243,
+32240,
+32172,
+32494,
+32383,
+32201,
+32275,
+32304,
+32316,
+32446,
+32504,
+32576,
+32372,
+32245,
+32549,
+32526,
+32685,
+32385,
+32462,
+32655,
+32574,
+32803,
+32740,
+32927,
+33079,
+33042,
 33095,
-33119,
-33151,
-33180,
-33199,
+33068,
+32974,
+32851,
+32971,
+33116,
+32960,
+33248,
+33279,
+33042,
 33227,
-33245,
-33277,
-33306,
-33346,
-33392,
-33424,
-33472,
-33507,
-33554,
-33585,
-33607,
-33642,
-33654,
-33671,
-33685,
-33704,
-33724,
-33750,
-33762,
-33815,
-33846,
-33895,
-33939,
-33978,
-34044,
-34065,
-34118,
-34139,
-34156,
-34167,
-34162,
-34157,
-34128,
-34130,
-34078,
-34071,
-34039,
-34018,
-34008,
-33978,
-33988,
-33969,
-33980,
-33979,
-33954,
-33975,
-33939,
-33942,
-33916,
-33897,
-33883,
-33848,
-33848,
-33826,
-33815,
-33813,
-33800,
-33805,
-33817,
-33795,
-33819,
-33797,
-33783,
-33759,
-33717,
-33668,
-33620,
-33552,
-33488,
-33432,
-33347,
-33297,
-33230,
-33176,
-33143,
-33087,
+33123,
+32906,
+33162,
+33412,
+33283,
+33135,
+32715,
+32742,
+32936,
+32698,
+32790,
+32535,
+32621,
+33256,
+33337,
+33395,
+33151,
+32682,
+32350,
+32942,
+33386,
 33080,
-33035,
-33022,
-32996,
-32970,
-32944,
-32922,
-32875,
-32855,
-32798,
+32905,
+32765,
+32679,
+32890,
+33317,
+33044,
+32869,
+32987,
+32781,
+33213,
+33402,
+33054,
+32810,
+32796,
+32803,
+32367,
+32428,
+32281,
+32289,
+32430,
+32431,
+32373,
+32552,
+32523,
+32291,
+32605,
+32522,
+32417,
+32136,
+32025,
+32012,
+32221,
+32623,
+32584,
+32760,
+32974,
+33088,
+33164,
+33153,
+32999,
+32727,
+32593,
+32707,
+32818,
+32981,
+33177,
+33118,
+33263,
+33425,
+33280,
+33247,
+33118,
+32868,
+32771,
+32664,
+32760,
+32828,
 32759,
-32714,
-32663,
-32625,
-32576,
-32541,
+32809,
+32844,
+32932,
+32925,
+32861,
+32798,
+32769,
+32642,
+32577,
+32598,
+32609,
+32765,
+32934,
+33128,
+33175,
+33061,
+32868,
+32706,
+32557,
 32502,
-32478,
-32426,
-32418,
-32378,
-32334,
+32588,
+32730,
+32828,
+32823,
+32945,
+32917,
+32832,
+32769,
+32682,
+32599,
+32394,
+32144,
+32123,
+32189,
+32119,
+32235,
 32321,
-32242,
-32234,
-32156,
-32136,
-32071,
-32035,
-31976,
-31949,
-31902,
-31872,
-31850,
-31820,
-31825,
-31797,
-31797,
-31768,
-31754,
-31727,
-31682,
-31672,
-31596,
-31570,
-31502,
-31446,
-31399,
-31333,
-31284,
-31234,
-31186,
-31153,
-31103,
-31076,
-31010,
-31001,
-30926,
-30900,
-30834,
-30772,
-30730,
-30660,
-30589,
-30548,
-30465,
-30436,
-30381,
-30343,
-30321,
-30291,
-30277,
-30248,
-30239,
-30202,
-30192,
-30152,
-30129,
-30089,
-30067,
-30021,
-29997,
-29967,
-29932,
-29918,
-29894,
-29888,
-29883,
-29876,
-29878,
-29878,
-29872,
-29871,
-29852,
-29837,
-29834,
-29801,
-29789,
-29762,
-29760,
-29745,
-29737,
-29738,
-29733,
-29749,
-29757,
-29768,
-29803,
-29804,
-29850,
-29854,
-29875,
-29896,
-29887,
-29907,
-29896,
-29895,
-29904,
-29883,
-29904,
-29866,
-29881,
-29850,
-29832,
-29823,
-29796,
-29781,
-29766,
-29764,
-29742,
-29769,
-29740,
-29774,
-29774,
-29783,
-29820,
-29822,
-29868,
-29904,
-29918,
-29973,
-29978,
-30029,
-30026,
-30073,
-30075,
-30104,
-30136,
-30143,
-30197,
-30200,
-30255,
-30262,
-30306,
-30334,
-30347,
-30402,
-30418,
-30471,
-30514,
-30554,
-30637,
-30676,
-30761,
-30830,
-30911,
-31012,
-31103,
-31217,
-31310,
-31418,
-31495,
-31596,
-31643,
-31733,
-31752,
-31830,
-31864,
-31906,
-31964,
+32429,
+32505,
+32360,
+32291,
+32270,
+32210,
+32052,
+32040,
+32042,
+32070,
+32297,
+32503,
+32594,
+32660,
+32683,
+32587,
+32710,
+32702,
+32627,
+32637,
+32521,
+32540,
+32556,
+32595,
+32617,
+32580,
+32572,
+32619,
+32537,
+32380,
+32241,
+32139,
+32207,
+32052,
+31986,
+32042,
+32053,
+32088,
+32067,
 31994,
-32059,
-32118,
-32172,
-32268,
-32315,
-32436,
+32040,
+32161,
+32164,
+32322,
+32271,
+32265,
+32299,
+32415,
+32595,
+32599,
+32693,
+32871,
+33011,
+33154,
+33403,
+33455,
+33586,
+33770,
+33893,
+34166,
+34331,
+34494,
+34712,
+34777,
+34737,
+34767,
+34801,
+34872,
+35032,
+35109,
+35273,
+35381,
+35284,
+35233,
+35028,
+34805,
+34693,
+34611,
+34624,
+34635,
+34575,
+34513,
+34398,
+34104,
+33854,
+33641,
+33430,
+33311,
+33309,
+33443,
+33566,
+33587,
+33445,
+33194,
+32952,
+32677,
+32457,
+32362,
+32356,
+32291,
+32282,
+32321,
+32306,
+32339,
+32312,
+32223,
+32218,
+32202,
+32053,
+31805,
+31369,
+30826,
+30292,
+29754,
+29347,
+29192,
+29190,
+29237,
+29386,
+29649,
+29883,
+29786,
+29239,
+28475,
+27819,
+27342,
+26872,
+26563,
+26509,
+26595,
+26668,
+26736,
+26768,
+26699,
+26578,
+26804,
+27770,
+29210,
+30871,
+32548,
+34096,
+35265,
+35578,
+35252,
+34870,
+34538,
+34480,
+35170,
+36499,
+38090,
+39574,
+40809,
+41716,
+41733,
+40820,
+39590,
+38488,
+37496,
+36449,
+35605,
+35386,
+35477,
+35477,
+35506,
+35525,
+35454,
+35030,
+34153,
+33049,
+31794,
+30428,
+29230,
+28320,
+27931,
+28219,
+28903,
+29926,
+30995,
+31928,
+32763,
+33186,
+33235,
+33353,
+33558,
+33738,
+34023,
+34428,
+35109,
+35866,
+36406,
+36940,
+37535,
+38164,
+38652,
+38937,
+39045,
+38925,
+38327,
+37420,
+36472,
+35662,
+35187,
+34942,
+34960,
+35202,
+35466,
+35385,
+34925,
+34099,
+33004,
+31900,
+30991,
+30458,
+30312,
+30491,
+30821,
+31320,
+31713,
+31902,
+31859,
+31524,
+31054,
+30481,
+29772,
+29069,
+28452,
+27924,
+27631,
+27422,
+27317,
+27502,
+27728,
+27815,
+27639,
+27322,
+26960,
+26464,
+25773,
+25165,
+24839,
+24556,
+24247,
+23920,
+23714,
+23481,
+23441,
+24081,
+25835,
+28345,
+30945,
+33495,
+35609,
+36772,
+36643,
+35693,
+34698,
+34207,
+34569,
+36108,
+38795,
+41746,
+44121,
+45624,
+45999,
+44881,
+42550,
+40028,
+37919,
+36359,
+35082,
+34583,
+34858,
+35203,
+35170,
+34914,
+34562,
+33884,
+32643,
+30928,
+29168,
+27299,
+25588,
+24544,
+24387,
+25140,
+26564,
+28429,
+30235,
+31525,
+32069,
+32045,
+31676,
+31328,
+31567,
+32593,
+34236,
+36095,
+38085,
+39780,
+40859,
+41142,
+40896,
+40465,
+39866,
+39158,
+38477,
+37919,
+37375,
+36892,
+36458,
+36260,
+36176,
+36074,
+35860,
+35244,
+34186,
+32783,
+31176,
+29637,
+28585,
+28270,
+28893,
+30036,
+31353,
+32541,
+33280,
+33415,
+33023,
+32299,
+31641,
+31433,
+31726,
+32586,
+33677,
+34731,
+35522,
+35927,
+35764,
+35125,
+34177,
+33059,
+31980,
+30859,
+29755,
+28754,
+27981,
+27452,
+27137,
+26907,
+26751,
+26605,
+26175,
+25462,
+24547,
+23681,
+22946,
+22312,
+21979,
+21954,
+22095,
+22417,
+23339,
+25308,
+28393,
+31836,
+35229,
+38288,
+40212,
+40501,
+39281,
+37451,
+35931,
+35487,
+36562,
+39319,
+43023,
+46383,
+48548,
+49158,
+47843,
+44665,
+40737,
+37289,
+34821,
+33291,
+32738,
+33144,
+33906,
+34292,
+34113,
+33595,
 32513,
-32619,
-32731,
-32817,
-32933,
-33013,
-33108,
-33196,
-33278,
-33369,
-33451,
-33548,
-33636,
-33741,
-33832,
-33953,
+30740,
+28579,
+26328,
+24216,
+22642,
+21948,
+22495,
+24086,
+26351,
+29065,
+31414,
+32703,
+32936,
+32486,
+31717,
+31139,
+31345,
+32767,
+35004,
+37430,
+39560,
+41038,
+41546,
+40887,
+39662,
+38339,
+37083,
+36099,
+35458,
+35069,
+34636,
+33936,
+33213,
+32607,
+31933,
+31405,
+31019,
+30587,
+30035,
+29448,
+29039,
+28848,
+28952,
+29468,
+30534,
+31897,
+33172,
+34201,
+34923,
+35337,
+35542,
+35627,
+35656,
+35735,
+35951,
+36286,
+36561,
+36712,
+36806,
+36842,
+36606,
+35979,
+35128,
 34041,
-34161,
-34249,
-34354,
-34449,
-34546,
-34623,
-34712,
-34788,
-34842,
-34922,
-34976,
-35041,
-35103,
-35172,
-35231,
-35326,
-35390,
-35468,
-35559,
-35621,
-35702,
-35750,
+32643,
+31152,
+29737,
+28509,
+27454,
+26481,
+25646,
+24884,
+24175,
+23600,
+23137,
+22744,
+22525,
+22627,
+23107,
+23745,
+24380,
+25119,
+25635,
+25775,
+25676,
+25432,
+25378,
+25980,
+27812,
+31517,
+36316,
+40714,
+44168,
+46137,
+46097,
+43913,
+40532,
+37528,
+35864,
 35822,
-35859,
-35920,
-35946,
-35985,
-36033,
-36044,
-36089,
-36089,
-36131,
-36147,
-36190,
-36217,
-36260,
-36290,
-36336,
-36349,
-36402,
-36400,
-36426,
-36438,
-36415,
-36440,
-36402,
-36404,
-36375,
-36346,
-36330,
-36275,
-36266,
-36213,
-36188,
-36150,
-36091,
-36074,
-36008,
-35973,
-35911,
-35853,
-35780,
-35736,
-35632,
-35583,
-35504,
-35423,
-35360,
-35290,
-35225,
-35164,
-35122,
-35044,
-35012,
-34959,
-34909,
-34880,
-34817,
-34787,
-34737,
-34683,
-34646,
-34581,
-34531,
-34488,
-34438,
-34391,
-34367,
+37592,
+40844,
+44243,
+46254,
+46692,
+45781,
+43088,
+38925,
+34667,
+31537,
+29549,
+28211,
+27934,
+28998,
+30577,
+31781,
+32474,
+32801,
+32180,
+30312,
+27961,
+25625,
+23726,
+22890,
+23482,
+25626,
+28463,
+31299,
+33792,
+35110,
+34939,
+33915,
+32683,
+31758,
+31513,
+32425,
+34560,
+36920,
+38864,
+40214,
+40905,
+40593,
+39245,
+37576,
+36002,
+34536,
+33359,
+32684,
+32523,
+32621,
+32743,
+32986,
+33065,
+32677,
+32106,
+31380,
+30483,
+29750,
+29650,
+30300,
+31437,
+32800,
+34358,
+35975,
+37040,
+37486,
+37645,
+37538,
+37122,
+36624,
+36374,
+36377,
+36436,
+36686,
+37295,
+37912,
+38216,
+38085,
+37513,
+36255,
 34308,
+32132,
+30001,
+28128,
+26804,
+26098,
+25784,
+25484,
+25031,
+24422,
+23535,
+22565,
+21785,
+21358,
+21265,
+21384,
+21957,
+22954,
+23992,
+25049,
+26111,
+26854,
+27258,
+27218,
+26760,
+26471,
+27077,
+29476,
+33854,
+38825,
+43118,
+46282,
+47453,
+45981,
+42448,
+38400,
+35396,
+34058,
+34555,
+37119,
+40759,
+43547,
+44540,
+44310,
+42604,
+39054,
+34610,
+30934,
+28640,
+27078,
+26278,
+27050,
+29178,
+31329,
+33035,
+34325,
+34687,
+33356,
+30700,
+27868,
+25304,
+23735,
+23861,
+25842,
+28925,
+32016,
+34587,
+36034,
+35766,
 34295,
-34243,
-34215,
-34176,
-34126,
-34084,
-34030,
-33978,
-33933,
-33852,
-33821,
-33727,
-33686,
-33607,
-33565,
-33502,
-33466,
-33414,
-33402,
-33357,
-33353,
-33327,
-33312,
-33296,
-33274,
-33254,
-33223,
-33221,
-33178,
-33183,
-33158,
-33147,
-33136,
-33142,
-33128,
-33139,
-33148,
-33155,
-33187,
-33207,
-33232,
-33259,
-33285,
-33302,
-33324,
-33343,
-33361,
-33363,
-33392,
-33391,
-33424,
-33424,
-33464,
-33451,
-33502,
-33481,
-33518,
-33511,
-33524,
-33533,
-33523,
-33541,
-33514,
-33534,
-33515,
-33520,
-33529,
-33521,
-33552,
-33547,
-33597,
-33593,
-33640,
-33647,
-33700,
-33704,
-33746,
-33749,
-33789,
-33792,
-33809,
-33819,
-33819,
-33821,
-33821,
-33820,
+32826,
+31698,
+31210,
+31736,
+33467,
+35775,
+37565,
+38782,
+39634,
+39792,
+38798,
+37185,
+35532,
 33820,
-33826,
-33814,
-33840,
-33833,
-33856,
-33864,
-33866,
-33892,
-33876,
-33906,
+32081,
+30813,
+30431,
+30755,
+31531,
+32473,
+33225,
+33367,
+32728,
+31778,
+31037,
+30414,
+30328,
+31468,
+33508,
+35618,
+37403,
+38849,
+39827,
+39938,
+39293,
+38764,
+38471,
+38041,
+37452,
+37499,
+37995,
+38127,
+38075,
+38183,
+38278,
+37751,
+36365,
+34608,
+32743,
+30542,
+28436,
+26873,
+25781,
+25149,
+24736,
+24426,
+23975,
+23433,
+22954,
+22421,
+21971,
+21869,
+22122,
+22507,
+22727,
+23231,
+24459,
+25641,
+26677,
+27758,
+28577,
+28909,
+28508,
+27551,
+27233,
+28148,
+30879,
+35660,
+40684,
+44579,
+46795,
+46926,
+44558,
+40531,
+36434,
+33680,
+32643,
+33136,
+35536,
+38881,
+41401,
+42220,
+42369,
+41396,
+38260,
 33859,
-33905,
-33858,
-33887,
-33865,
-33873,
-33879,
-33876,
-33888,
-33873,
-33909,
-33883,
+30004,
+27510,
+25659,
+24845,
+26071,
+29349,
+32659,
+35070,
+36875,
+37222,
+35453,
+32313,
+29254,
+26774,
+25603,
+25955,
+27985,
+30865,
+33489,
+35708,
+36848,
+36428,
+34976,
+33574,
+32264,
+31199,
+31014,
+32244,
+34207,
+35841,
+37208,
+38219,
+38419,
+37146,
+35017,
+32870,
+30919,
+29291,
+28374,
+28613,
+29608,
+31043,
+32514,
+33688,
+34083,
+33877,
+33182,
+32607,
+32757,
+33037,
+34134,
+36193,
+38422,
+40182,
+41561,
+42361,
+42531,
+41850,
+40411,
+39524,
+38663,
+37453,
+36527,
+36710,
+36883,
+36425,
+35887,
+35419,
+34743,
+32984,
+30771,
+28864,
+27294,
+25460,
+24133,
+23696,
+23565,
+23648,
+23700,
+23848,
+23806,
+23740,
+23487,
+23397,
+23519,
+23770,
+24454,
+25083,
+25906,
+27270,
+28731,
+29650,
+30224,
+30386,
+30047,
+29143,
+27633,
+27176,
+28548,
+32000,
+37055,
+41779,
+45023,
+46362,
+45517,
+42268,
+37889,
+33932,
+31649,
+30954,
+31592,
+34170,
+37634,
+40376,
+41664,
+42441,
+41752,
+38575,
 33920,
-33916,
-33917,
-33941,
-33917,
-33944,
-33926,
-33922,
-33903,
-33892,
-33856,
-33851,
-33808,
-33800,
-33763,
-33753,
-33720,
-33700,
-33687,
-33647,
-33657,
-33596,
-33600,
-33551,
-33525,
-33499,
-33449,
-33426,
-33399,
-33366,
-33351,
-33332,
-33298,
-33299,
-33266,
-33254,
-33233,
-33205,
-33178,
-33148,
-33115,
-33088,
-33034,
-33015,
-32960,
-32925,
-32869,
-32814,
-32749,
-32693,
-32628,
+29715,
+26970,
+25046,
+24675,
+26734,
+30684,
+34319,
+36903,
+38438,
+38161,
+35898,
 32564,
-32513,
-32455,
-32401,
-32367,
-32301,
-32246,
-32202,
-32132,
-32092,
-32010,
-31961,
-31885,
-31828,
-31762,
-31687,
-31639,
-31546,
-31499,
-31405,
-31346,
-31267,
-31193,
-31130,
-31034,
-30987,
-30892,
-30843,
-30766,
-30693,
-30628,
-30556,
+29513,
+26936,
+25621,
+25868,
+27483,
+29794,
+32218,
+34662,
+36120,
+36015,
+34898,
+33685,
+32228,
+30723,
+30348,
+31453,
+33229,
+34867,
+36580,
+37989,
+38497,
+37698,
+35980,
+34201,
+32227,
+30507,
+29419,
+29103,
+29736,
+31067,
+32598,
+33879,
+34600,
+34635,
+34221,
+33141,
+32802,
+33686,
+34511,
+35954,
+38036,
+39835,
+40889,
+41235,
+40885,
+40265,
+39064,
+37447,
+36771,
+36030,
+34845,
+34356,
+34851,
+34910,
+34279,
+33797,
+33185,
+32212,
+30303,
+28224,
+26707,
+25499,
+24273,
+23832,
+24240,
+24582,
+25146,
+25637,
+25863,
+26002,
+26101,
+25848,
+25613,
+25385,
+25348,
+26031,
+26804,
+27933,
+29684,
+31291,
+32030,
+32050,
+31494,
+30412,
+28738,
+27276,
+27710,
+30646,
+35724,
+40422,
+43656,
+45660,
+45762,
+43474,
+39321,
+35083,
+32180,
+30767,
+29969,
+31489,
+35104,
+38764,
+41285,
+42990,
+43380,
+40633,
+35616,
+30347,
+26657,
+24343,
+23470,
+25020,
+28756,
+32697,
+35634,
+37950,
+38583,
+37159,
+34298,
+31049,
+27731,
+25128,
+24488,
+25699,
+28299,
+31568,
+35249,
+38085,
+38702,
+37668,
+36333,
+34626,
+32545,
+31501,
+32207,
+33910,
+35399,
+36862,
+38643,
+39673,
+39359,
+37898,
+35734,
+33084,
+30077,
+27749,
+26482,
+26390,
+27699,
+29853,
+31921,
+33463,
+34235,
+34199,
+33312,
+31911,
+31993,
+32952,
+33596,
+35219,
+37504,
+39283,
+40381,
+40806,
+40573,
+39975,
+38326,
+36511,
+35684,
+34473,
+33147,
+33040,
+33607,
+33403,
+32983,
+32722,
+32113,
+30941,
+29034,
+27295,
+25991,
+24748,
+23732,
+23835,
+24608,
+25505,
+26694,
+27626,
+28195,
+28556,
+28616,
+28205,
+27870,
+27441,
+27321,
+27841,
+28373,
+29544,
+31254,
+32559,
+33093,
+33030,
+32090,
 30498,
-30431,
-30389,
-30332,
-30292,
-30264,
-30221,
-30209,
-30164,
-30160,
-30115,
-30110,
-30075,
-30042,
-30018,
-29947,
-29942,
-29859,
-29844,
-29792,
-29748,
-29724,
-29680,
-29670,
-29654,
-29622,
-29632,
-29614,
-29611,
-29623,
-29595,
-29626,
-29588,
-29606,
-29568,
-29577,
-29553,
-29551,
-29540,
-29537,
-29536,
-29543,
-29557,
-29565,
-29588,
-29598,
-29615,
-29635,
-29635,
-29654,
-29633,
-29668,
-29642,
-29660,
-29638,
-29648,
-29637,
-29662,
-29647,
-29691,
-29701,
-29747,
-29784,
-29846,
-29884,
-29952,
-29999,
-30032,
-30095,
-30101,
-30154,
-30157,
-30207,
-30206,
-30257,
-30268,
-30318,
-30351,
-30387,
-30441,
-30464,
-30520,
-30537,
-30572,
-30583,
-30614,
-30611,
-30634,
-30622,
-30625,
-30616,
-30614,
-30611,
-30609,
-30626,
-30622,
-30673,
-30667,
-30740,
-30745,
-30822,
-30840,
-30921,
-30927,
-31003,
-31001,
-31040,
+28250,
+26377,
+26753,
+29570,
+34433,
+38927,
+41867,
+43392,
+43064,
+40407,
+36208,
+32449,
+30150,
+29296,
+29248,
+31586,
+35689,
+39692,
+42483,
+44175,
+44423,
+41584,
+36773,
+32027,
+28833,
+26894,
+26503,
+28320,
+31868,
+35461,
+38147,
+40238,
+40421,
+38492,
+35032,
 31064,
-31050,
-31098,
-31081,
-31126,
-31137,
-31174,
-31222,
-31262,
-31314,
-31374,
-31410,
-31470,
-31515,
-31541,
-31592,
-31610,
-31645,
-31669,
-31684,
-31737,
-31738,
-31794,
-31819,
-31879,
-31917,
-31992,
-32043,
-32130,
-32202,
-32294,
-32373,
-32467,
-32544,
-32630,
-32702,
+27170,
+24279,
+23682,
+25250,
+28185,
+31608,
+35212,
+37528,
+37705,
+36565,
+35249,
+33689,
+31849,
+31021,
+31635,
+32999,
+34285,
+35837,
+37699,
+38933,
+38792,
+37274,
+35054,
+32318,
+29515,
+27522,
+26644,
+26990,
+28591,
+30663,
+32345,
+33608,
+34272,
+34275,
+33506,
+32558,
+32738,
+33303,
+33588,
+34831,
+36951,
+38587,
+39552,
+39928,
+39503,
+38337,
+36247,
+34207,
+33171,
+32182,
+31159,
+31313,
+31997,
+31827,
+31482,
+31302,
+30826,
+29981,
+28545,
+27127,
+26283,
+25708,
+25546,
+26375,
+27730,
+29194,
+30561,
+31236,
+31334,
+31277,
+31214,
+30717,
+30128,
+29698,
+29263,
+29213,
+29423,
+30494,
+32157,
+32892,
+32839,
+32404,
+30799,
+28575,
+26068,
+23749,
+23630,
+25301,
+29070,
+34055,
+37186,
+38806,
+39607,
+38561,
+35855,
+32879,
+30715,
+29993,
+29750,
+30816,
+34478,
+39103,
+42590,
+44651,
+46236,
+45333,
+41371,
+36983,
+33537,
+31056,
+29415,
+29119,
+30899,
+33812,
+36143,
+38363,
+39793,
+38901,
+36036,
+32146,
+27915,
+24181,
+22444,
+22952,
+24921,
+27628,
+30831,
+34016,
+35870,
+36237,
+36256,
+35856,
+34297,
+32607,
+32004,
+32534,
+33546,
+34958,
+37077,
+39015,
+39667,
+38970,
+37408,
+35259,
 32776,
-32836,
-32910,
-32957,
-33043,
-33101,
-33180,
-33251,
-33345,
-33422,
-33518,
-33601,
-33688,
-33768,
-33853,
-33921,
-34004,
-34086,
-34151,
-34240,
-34319,
-34396,
-34491,
-34559,
-34654,
-34747,
-34825,
-34928,
-35024,
-35118,
-35212,
-35314,
-35381,
-35477,
-35511,
-35596,
-35616,
-35671,
-35697,
-35746,
-35763,
-35826,
-35826,
-35910,
-35906,
-35987,
-36002,
-36060,
-36095,
-36140,
-36165,
-36200,
-36216,
-36239,
-36248,
-36262,
-36271,
-36289,
-36291,
-36316,
-36314,
-36331,
-36325,
-36323,
-36308,
-36298,
-36279,
-36268,
-36224,
-36223,
-36163,
-36137,
-36082,
-36037,
+30556,
+28867,
+27758,
+27717,
+28503,
+29597,
+31076,
+32567,
+33763,
+34249,
+33648,
+33220,
+33468,
+33261,
+33246,
+34383,
+35827,
+37055,
+38018,
+38491,
+38546,
+37836,
+36393,
+35281,
+34368,
+33046,
+32223,
+32389,
+32608,
+32646,
+32744,
+32828,
+32807,
+32304,
+31290,
+30387,
+29757,
+29024,
+28502,
+28674,
+29486,
+30668,
+31704,
+32203,
+32509,
+32640,
+32010,
+30989,
+30072,
+29510,
+29110,
+28663,
+28711,
+29470,
+30612,
+31085,
+30549,
+30016,
+29176,
+27302,
+25409,
+23467,
+21861,
+22117,
+24080,
+28437,
+33555,
+36618,
+38703,
+39859,
+38874,
+36916,
+35284,
+34327,
+33686,
+33286,
+35002,
+38759,
+42123,
+44229,
+45859,
+46791,
+44578,
+39856,
+35976,
+33266,
+30775,
+28891,
+28425,
+29749,
+31432,
+32569,
+33883,
+34498,
+33245,
+30588,
+27202,
+23601,
+21135,
+20742,
+21767,
+23725,
+26783,
+30596,
+34093,
+36260,
+37409,
+38267,
+37849,
+36001,
+34332,
+33837,
+34236,
+34794,
+35589,
+36736,
+37713,
+37839,
+36944,
+35437,
+33715,
+31663,
+29358,
+27137,
+25391,
+25086,
+25853,
+27089,
+29111,
+31396,
+33185,
+33875,
+33498,
+33196,
+33561,
+33639,
+33384,
+33932,
+35422,
+37220,
+38556,
+39477,
+40391,
+40553,
+39465,
+37916,
+36871,
 35961,
-35917,
-35834,
-35791,
-35732,
-35677,
-35635,
-35567,
-35517,
-35449,
-35382,
-35318,
-35239,
-35179,
-35119,
-35062,
-35019,
-34976,
-34936,
-34889,
-34856,
-34808,
-34774,
-34741,
 34692,
-34672,
-34615,
-34595,
-34542,
-34503,
-34457,
-34420,
-34373,
-34365,
-34314,
-34317,
-34277,
-34269,
-34247,
-34219,
-34219,
-34188,
-34197,
-34198,
-34212,
-34228,
-34225,
-34249,
-34230,
-34248,
-34208,
-34213,
-34185,
-34183,
-34182,
-34185,
-34188,
-34203,
-34184,
-34213,
-34166,
-34183,
-34145,
-34136,
-34134,
-34116,
-34126,
-34117,
-34120,
-34115,
-34107,
-34107,
-34067,
-34091,
-34038,
-34081,
-34049,
-34088,
-34083,
-34106,
-34104,
-34115,
-34095,
-34090,
-34057,
-34008,
-33979,
-33906,
-33887,
-33834,
-33843,
-33843,
-33874,
-33907,
-33965,
-33965,
-34013,
-33965,
-33953,
-33871,
-33817,
-33745,
-33688,
-33624,
+33933,
+33934,
+34061,
+34002,
+33868,
+33996,
+33857,
+32953,
+31813,
+30875,
+30067,
+29609,
+29628,
+30055,
+30762,
+31390,
+31954,
+32109,
+31676,
+30992,
+30033,
+29073,
+28437,
+28400,
+28730,
+29029,
+29574,
+30532,
+31314,
+31209,
+30277,
+29163,
+28227,
+26796,
+25560,
+24881,
+23526,
+23516,
+25832,
+29944,
+34878,
+37667,
+39580,
+40902,
+39895,
+38297,
+36857,
+35769,
+34541,
 33585,
-33534,
+34976,
+37691,
+39984,
+42053,
+44294,
+45283,
+43020,
+38970,
+36017,
+33554,
+30596,
+28241,
+27175,
+27678,
+28678,
+29927,
+32098,
+33650,
+33518,
+31825,
+28938,
+26012,
+24376,
+24348,
+25240,
+26983,
+30002,
 33498,
-33434,
-33389,
-33303,
-33252,
-33171,
-33107,
-33076,
-33002,
-32999,
-32944,
-32922,
-32835,
-32779,
-32684,
-32578,
-32491,
-32396,
-32328,
-32291,
-32257,
-32259,
-32252,
-32263,
-32244,
-32223,
-32165,
-32101,
-32007,
-31914,
-31836,
-31745,
-31700,
-31651,
-31640,
-31627,
+36315,
+38483,
+40297,
+41465,
+40547,
+37822,
+35619,
+34321,
+33467,
+32992,
+33235,
+34308,
+35227,
+35547,
+35282,
+34439,
+33123,
+31130,
+28716,
+26715,
+25650,
+25780,
+26639,
+27806,
+29761,
+32148,
+33923,
+34650,
+34790,
+34805,
+34848,
+34820,
+34504,
+34857,
+36022,
+37283,
+38554,
+39583,
+40539,
+40840,
+40047,
+38810,
+37672,
+36685,
+35243,
+33865,
+33091,
+32460,
+31849,
+31267,
+30982,
+30929,
+30671,
+30198,
+29874,
+29765,
+29732,
+29590,
+29274,
+29230,
+29403,
+29650,
+30005,
+30326,
+30641,
+30486,
+29907,
+29536,
+29489,
+29562,
+29395,
+29298,
+29384,
+29334,
+29609,
+29683,
+29406,
+29132,
+28259,
+27395,
+26665,
+25764,
+24190,
+22516,
+22822,
+25280,
+29871,
+33572,
+35434,
+37889,
+38719,
+38273,
+37538,
+35900,
+34293,
+32376,
+31455,
+33301,
+36755,
+39756,
+42612,
+45194,
+45281,
+42502,
+38788,
+35707,
+32554,
+29198,
+26304,
+25088,
+25933,
+27364,
+29724,
+32552,
+34108,
+34196,
+33057,
+30874,
+28867,
+28041,
+27820,
+28162,
+29305,
 31616,
-31621,
-31569,
-31559,
-31482,
-31439,
-31385,
-31323,
+34947,
+37966,
+40170,
+41924,
+42418,
+40695,
+38208,
+36364,
+35392,
+34891,
+34185,
+33828,
+34001,
+34237,
+34322,
+34203,
+33621,
+32459,
+30770,
+28487,
+26565,
+25828,
+26168,
+27090,
+28217,
+29696,
+31477,
+33249,
+34276,
+34817,
+35216,
+35179,
+35398,
+35298,
+35313,
+36619,
+38179,
+39928,
+41474,
+42417,
+43073,
+42395,
+40635,
+38970,
+37383,
+35636,
+34011,
+32967,
+32755,
+32891,
+32870,
+32719,
+32193,
 31317,
-31282,
-31316,
-31303,
-31321,
-31303,
-31256,
-31220,
-31139,
-31092,
-31027,
-31000,
-30999,
-31023,
-31056,
-31095,
-31116,
-31115,
-31112,
-31056,
-31038,
-30972,
-30947,
-30920,
-30919,
-30915,
-30930,
-30929,
-30934,
-30912,
-30911,
-30862,
-30865,
-30838,
-30846,
-30849,
-30898,
-30888,
-30959,
-30923,
-30968,
-30934,
-30930,
-30900,
-30886,
-30857,
-30852,
-30859,
-30852,
-30893,
-30910,
-30932,
-30975,
-30964,
-31002,
-30961,
-30949,
-30911,
-30870,
-30836,
-30827,
-30794,
-30830,
-30815,
-30863,
-30880,
-30913,
-30935,
-30964,
-30982,
-31024,
-31047,
-31108,
-31141,
-31197,
-31234,
-31246,
-31262,
-31238,
-31213,
-31167,
-31139,
-31114,
-31104,
-31112,
-31107,
-31139,
-31134,
-31128,
-31128,
-31070,
-31054,
-30997,
-30969,
-30938,
-30928,
-30912,
-30910,
-30904,
-30898,
-30901,
-30891,
-30898,
-30896,
-30934,
-30937,
-30987,
-31006,
-31037,
-31058,
-31061,
-31074,
+30128,
+28780,
+27688,
+27071,
+27328,
+28081,
+29009,
+30215,
+31430,
+32345,
+32727,
+32533,
+31841,
+30657,
+29373,
+28490,
+28052,
+28201,
+28664,
+29397,
+30333,
+31004,
+31818,
+32173,
+31249,
+29760,
+28156,
+26235,
+24768,
+23573,
+22019,
+22115,
+23746,
+27068,
+31684,
+33562,
+34425,
+35666,
+35597,
+35208,
+34295,
+33428,
+32792,
+32105,
+33223,
+36924,
+41142,
+44034,
+45980,
+46875,
+45392,
+41650,
+38316,
+35574,
+32568,
+29788,
+27406,
+27101,
+28298,
+29859,
+32086,
+33711,
+33778,
+32938,
+31425,
+29347,
+27975,
+27260,
+26794,
+26794,
+27685,
+30066,
+33336,
+36414,
+38781,
+40555,
+40763,
+39407,
+37921,
+36499,
+35337,
+34191,
+32935,
+32265,
+32328,
+32741,
+33123,
+33244,
+32810,
+31884,
+30384,
+28374,
+26723,
+25740,
+25178,
+25060,
+25524,
+26835,
+28933,
+31166,
+33218,
+35076,
+36399,
+37127,
+37521,
+37963,
+39120,
+40354,
+40919,
+41569,
+42342,
+43107,
+43807,
+44062,
+43716,
+42437,
+40374,
+38170,
+36032,
+33668,
+31484,
+29839,
+28402,
+26946,
+25946,
+25982,
+26160,
+26059,
+25908,
+25966,
+26321,
+26603,
+27151,
+27860,
+28496,
+29068,
+29688,
+30532,
+31677,
+32969,
+34002,
+34495,
+34556,
+34920,
+35259,
+35259,
+35316,
+35401,
+35542,
+35304,
+34742,
+34218,
+32873,
+30547,
+27908,
+24641,
+21486,
+18646,
+15633,
+14477,
+15275,
+18014,
+22540,
+25523,
+28067,
+31029,
+32788,
+33967,
+34034,
+33880,
+34057,
+34373,
+36591,
+40914,
+45385,
+48520,
+50697,
+51949,
+51083,
+47963,
+44723,
+41558,
+37828,
+34055,
+30705,
+29394,
+29435,
+29990,
 31052,
-31060,
-31035,
-31044,
-31026,
-31048,
-31040,
-31080,
-31074,
-31109,
-31102,
-31129,
-31116,
-31138,
-31121,
-31131,
-31104,
-31108,
-31098,
-31089,
-31103,
-31091,
-31117,
-31134,
-31140,
-31173,
-31182,
-31217,
-31228,
-31265,
-31296,
-31345,
-31398,
-31451,
-31505,
-31547,
-31587,
 31601,
-31620,
-31625,
-31632,
-31638,
-31674,
-31684,
-31733,
-31756,
-31778,
-31816,
-31813,
-31841,
-31833,
-31868,
-31871,
-31926,
-31968,
-32039,
-32095,
-32177,
-32214,
-32296,
-32320,
-32380,
-32428,
-32469,
-32550,
-32598,
-32699,
-32767,
-32854,
+31064,
+29685,
+27788,
+25487,
+24027,
+23416,
+22963,
+22897,
+23927,
+26403,
+29430,
+32156,
+34374,
+36426,
+37314,
+37051,
+37029,
+37254,
+37597,
+37515,
+37010,
+36776,
+37013,
+37638,
+38047,
+37838,
+37178,
+36116,
+34519,
+32648,
+31060,
+30162,
+29620,
+29072,
+29140,
+30043,
+31488,
 32924,
-32993,
-33033,
-33098,
-33121,
-33165,
-33202,
-33240,
-33300,
-33335,
-33388,
-33441,
-33488,
-33546,
-33589,
-33648,
-33693,
-33774,
-33819,
-33922,
-33982,
-34077,
-34166,
-34240,
-34326,
-34399,
-34442,
-34518,
-34542,
-34590,
-34625,
-34660,
-34707,
-34758,
-34803,
-34873,
-34892,
-34957,
-34956,
-34989,
-34977,
-34992,
-34981,
-34984,
-34993,
-35000,
-35034,
-35043,
-35090,
-35089,
-35132,
-35122,
-35147,
-35150,
-35169,
-35193,
-35214,
-35236,
-35261,
-35273,
-35294,
-35285,
-35277,
-35253,
-35225,
-35214,
-35180,
-35168,
-35164,
-35121,
-35161,
-35093,
-35112,
-35058,
-35032,
-34993,
-34943,
-34907,
-34850,
-34827,
-34785,
-34755,
-34730,
-34706,
-34663,
-34645,
-34601,
-34568,
-34529,
-34481,
-34463,
-34396,
-34398,
-34339,
-34323,
-34283,
-34257,
-34213,
-34197,
-34130,
-34127,
-34056,
-34050,
-33999,
-33983,
-33954,
-33928,
-33889,
-33872,
-33825,
-33808,
-33773,
-33741,
-33710,
-33687,
-33661,
-33644,
-33617,
-33618,
-33583,
-33576,
-33557,
-33522,
-33522,
-33486,
-33473,
-33451,
-33433,
-33410,
-33394,
-33357,
-33338,
-33306,
-33281,
+33714,
+34049,
+33894,
+33366,
+32939,
+32652,
+33358,
+35135,
+36433,
+37390,
+38688,
+39723,
+40417,
+40318,
+39178,
+37662,
+35520,
 33254,
-33244,
-33224,
-33215,
-33212,
-33210,
-33204,
-33208,
-33191,
-33204,
-33178,
-33192,
-33159,
-33196,
-33175,
-33207,
-33217,
-33244,
-33252,
-33279,
+31883,
+31204,
+30697,
+30527,
+30837,
+30867,
+30598,
+30539,
+30304,
+29868,
+29337,
+28833,
+29063,
+29768,
+30801,
+32321,
+33722,
+34908,
+35877,
+36439,
+36773,
+37045,
+37115,
+36674,
+35746,
+34753,
+34073,
+33522,
+32686,
+31948,
+31199,
+29754,
+28234,
+26922,
+25596,
+24377,
+22547,
+20476,
+18963,
+17411,
+15985,
+14921,
+14974,
+16549,
+19686,
+24154,
+27664,
+30753,
+33858,
+35801,
+37461,
+38280,
+38537,
+38869,
+38998,
+39751,
+42094,
+44831,
+46536,
+47901,
+48523,
+47477,
+44652,
+41603,
+38648,
+35655,
+32608,
+29704,
+28742,
+28740,
+29253,
+30479,
+31422,
+31583,
+30888,
+29406,
+27445,
+25917,
+24745,
+23918,
+23450,
+24008,
+26082,
+28878,
+31590,
+33975,
+36255,
+37418,
+37610,
+37640,
+37644,
+37763,
+37410,
+36765,
+36673,
+37332,
+38410,
+39560,
+40119,
+40086,
+39586,
+38239,
+36595,
+35139,
+34077,
+33067,
+31869,
+31258,
+31382,
+32083,
+32830,
 33287,
-33298,
-33295,
-33322,
-33300,
-33326,
-33315,
-33315,
-33332,
-33320,
-33323,
-33312,
-33316,
-33309,
-33331,
-33338,
-33360,
-33396,
-33411,
-33444,
-33461,
-33466,
-33477,
-33468,
-33451,
-33464,
-33420,
-33448,
-33407,
+33394,
+32851,
+31760,
+30528,
+29510,
+28971,
+29116,
+29694,
+30587,
+31414,
+32439,
+33689,
+34488,
+35207,
+35439,
+35189,
+34606,
+33621,
+33193,
+33526,
+34227,
+35069,
+36043,
+37036,
+37786,
+38041,
+38100,
+37896,
+37182,
+36292,
+35416,
+35233,
+35529,
+35900,
+36394,
+36553,
+36293,
+35554,
+34425,
+32992,
+31298,
+29205,
+27044,
+25372,
+24270,
+23981,
+24106,
+24201,
+24564,
+25123,
+25444,
+25922,
+26470,
+26706,
+26857,
+26399,
+25701,
+25363,
+24990,
+24435,
+23533,
+23448,
+24479,
+26393,
+29847,
+32406,
+33517,
+34747,
+34942,
+34812,
+34562,
+33563,
+32738,
+32004,
+31478,
+32700,
+35390,
+37420,
+38821,
+40086,
+40493,
+39273,
+37959,
+37169,
+36284,
+35172,
+33333,
+32685,
 33414,
-33408,
-33387,
+34308,
+35789,
+37269,
+37789,
+37401,
+36407,
+34885,
+33465,
+32369,
+31551,
+30626,
+29921,
+30191,
+31177,
+32158,
+32486,
+32723,
+32490,
+31467,
+30615,
+30268,
+30364,
+30457,
+30336,
+30565,
+31440,
+32766,
+34402,
+35655,
+36241,
+36414,
+36123,
+35745,
+35537,
+35759,
+36339,
+36563,
+36674,
+37041,
+37453,
+37673,
+37410,
+36629,
+35550,
+34198,
+32801,
+31641,
+30684,
+30214,
+30129,
+30224,
+30707,
+31464,
+32027,
+32391,
+32587,
+32297,
+32007,
+31700,
+31400,
+31861,
+32704,
+33855,
+35357,
+36525,
+37555,
+38687,
+39277,
+39042,
+38318,
+37432,
+36540,
+35775,
+35506,
+35791,
+36423,
+36980,
+37084,
+36829,
+36142,
+34983,
+33399,
+31550,
+29640,
+27972,
+26915,
+26397,
+26418,
+26786,
+27238,
+27633,
+27933,
+28078,
+27889,
+27451,
+26796,
+26060,
+25491,
+25249,
+25181,
+25148,
+25062,
+24793,
+24754,
+25048,
+24804,
+24392,
+24703,
+25011,
+26084,
+27999,
+28906,
+29960,
+31336,
+31955,
+32514,
+32590,
+32203,
+32137,
+32370,
+32754,
+34098,
+35832,
+37002,
+38302,
+39781,
+40269,
+40052,
+39718,
+38803,
+38204,
+37731,
+37272,
+37867,
+38872,
+40088,
+41515,
+42270,
+42105,
+41294,
+39735,
+37619,
+35540,
+33858,
+32554,
+31469,
+30917,
+30796,
+31113,
+31380,
+31202,
+30939,
+30005,
+28714,
+27647,
+26562,
+25961,
+26108,
+26524,
+27354,
+28509,
+29849,
+31270,
+32270,
+33041,
+33723,
+34142,
+34362,
+34605,
+35049,
+35404,
+35832,
+36609,
+37201,
+37751,
+38308,
+38550,
+38604,
+38210,
+37540,
+37141,
+36492,
+35658,
+35156,
+34554,
+33949,
+33667,
+33633,
+33458,
+33085,
+33006,
+33034,
+32737,
+32548,
+32461,
+32350,
+32383,
+32625,
+33325,
+33944,
+34132,
+34495,
+35215,
+35799,
+35895,
+35733,
+35769,
+35700,
+35567,
+35701,
+35674,
+35621,
+35529,
+35163,
+34960,
+34855,
+34628,
+34272,
+33620,
+32857,
+32060,
+31055,
+30030,
+29213,
+28561,
+27859,
+27342,
+27231,
+27193,
+27169,
+27078,
+26895,
+26471,
+25823,
+25338,
+24520,
+23617,
+23141,
+22791,
+22767,
+22966,
+23530,
+24302,
+24601,
+24787,
+25590,
+27466,
+28932,
+28759,
+29209,
+30029,
+30153,
+30437,
+30553,
+31326,
+32207,
+32648,
+34176,
+36666,
+38166,
+38736,
+39492,
+40570,
+40967,
+40616,
+40401,
+39963,
+39718,
+39609,
+39749,
+40594,
+41063,
+41181,
+41179,
+40602,
+39762,
+38646,
+36912,
+35140,
+33771,
+32806,
+32066,
+31486,
+31457,
+31307,
+30844,
+30282,
+29412,
+28478,
+27197,
+25918,
+25392,
+25439,
+26017,
+26825,
+27382,
+28188,
+29068,
+29810,
+30490,
+30907,
+31372,
+31816,
+32243,
+33048,
+34066,
+35141,
+36125,
+37005,
+37948,
+38807,
+39688,
+40275,
+40351,
+40457,
+40559,
+40486,
+40544,
+40582,
+40601,
+40474,
+39837,
+39091,
+38293,
+37385,
+36379,
+35113,
+33684,
+32677,
+31728,
+30483,
+29699,
+29134,
+28653,
+28462,
+28329,
+28258,
+28228,
+27919,
+27853,
+28532,
+29177,
+29818,
+31022,
+32171,
+33128,
+34512,
+35774,
+36449,
+36880,
+36875,
+36859,
+37078,
+36968,
+36584,
+36191,
+35678,
+34963,
+34236,
+33407,
+32479,
+31459,
+30042,
+28682,
+27769,
+26676,
+25325,
+24330,
+23518,
+22897,
+22479,
+22058,
+21869,
+21755,
+21957,
+22476,
+23086,
+23836,
+24553,
+24989,
+25287,
+25852,
+26553,
+27703,
+29859,
+31388,
+31896,
+33238,
+34564,
+35667,
+36586,
+36798,
+37078,
+36669,
+35998,
+36894,
+38396,
+38676,
+38423,
+38738,
+39281,
+39292,
+39142,
+39046,
+38466,
+37540,
+36664,
+36790,
+37833,
+38368,
+38673,
+39080,
+39398,
+39668,
+39397,
+38304,
+37021,
+35813,
+34232,
+32801,
+32132,
+31596,
+30626,
+29724,
+29254,
+28950,
+28396,
+27445,
+26651,
+26141,
+25802,
+25871,
+26111,
+26346,
+26882,
+27687,
+28451,
+29289,
+30261,
+31000,
+31486,
+32513,
+34004,
+35290,
+36640,
+37836,
+38895,
+39954,
+40679,
+41423,
+41745,
+41431,
+41024,
+40519,
+40205,
+39929,
+39194,
+38265,
+37461,
+36574,
+35549,
+34543,
+33548,
+32609,
+31948,
+31357,
+30592,
+30448,
+30527,
+30336,
+30382,
+30302,
+30248,
+30207,
+30018,
+30195,
+30667,
+30960,
+31130,
+31426,
+31921,
+32533,
+32799,
+33303,
+33813,
+33764,
+33671,
+33415,
+33375,
 33390,
-33356,
-33349,
-33314,
-33284,
-33267,
-33213,
-33197,
-33131,
-33118,
-33052,
-33007,
-32962,
-32901,
-32876,
-32809,
-32789,
-32723,
-32726,
-32668,
-32671,
-32623,
-32618,
+32914,
 32578,
-32538,
-32506,
-32447,
-32417,
-32344,
-32331,
-32259,
-32269,
-32226,
-32234,
-32209,
-32218,
-32173,
-32182,
-32113,
-32106,
-32032,
-32007,
-31936,
-31902,
-31832,
-31801,
-31721,
-31680,
-31609,
-31551,
-31499,
-31445,
-31395,
-31373,
-31330,
-31331,
-31309,
-31299,
-31296,
-31256,
-31255,
-31213,
-31195,
-31176,
-31155,
-31144,
-31152,
-31131,
-31160,
-31156,
-31154,
-31175,
-31152,
-31170,
-31162,
-31181,
-31179,
-31204,
-31199,
-31240,
-31232,
-31268,
-31267,
-31293,
-31302,
-31339,
-31353,
-31403,
-31437,
-31491,
-31542,
-31591,
-31635,
-31669,
-31696,
-31713,
-31737,
-31729,
-31732,
-31745,
-31729,
-31744,
-31750,
-31755,
-31767,
-31787,
-31794,
-31828,
-31870,
-31904,
-31953,
-32026,
-32065,
-32154,
-32192,
-32276,
-32299,
-32361,
-32387,
-32408,
-32445,
-32458,
-32496,
-32495,
-32553,
-32560,
-32604,
-32609,
-32624,
-32620,
-32612,
-32590,
-32573,
-32552,
-32545,
-32522,
-32535,
-32517,
-32539,
-32538,
-32558,
-32554,
-32579,
-32589,
-32607,
-32654,
-32664,
+32374,
+32078,
+31597,
+31266,
+31190,
+30521,
+29972,
+29439,
+29024,
+28714,
+28010,
+28124,
+28195,
+27914,
+28582,
+29116,
+29282,
+30070,
+30626,
+30670,
+30796,
+31478,
+31722,
+31846,
+32526,
+32381,
+32183,
+32427,
+32035,
+31815,
+32155,
+31865,
+31598,
 32708,
+32553,
+31769,
+32193,
+31751,
+31493,
+31428,
+31204,
+31324,
+31061,
+30881,
+31801,
 32741,
-32768,
-32793,
-32805,
-32800,
-32778,
-32778,
-32748,
-32729,
-32719,
-32699,
-32694,
-32702,
-32672,
-32688,
-32645,
-32632,
-32584,
-32561,
-32500,
-32492,
-32440,
-32419,
-32409,
-32384,
-32388,
-32367,
-32385,
-32354,
-32402,
-32366,
-32414,
+32789,
+33074,
+33641,
+34118,
+34149,
+34115,
+34213,
+34085,
+34321,
+34252,
+34315,
+35074,
+35311,
+35178,
+35566,
+35966,
+35838,
+35771,
+35125,
+34398,
+33907,
+33014,
 32405,
-32448,
-32476,
-32503,
-32547,
-32568,
-32621,
-32616,
-32660,
-32645,
-32676,
-32668,
-32670,
-32674,
-32674,
-32671,
-32674,
-32655,
-32643,
-32625,
-32582,
-32575,
-32501,
-32504,
-32449,
-32434,
-32410,
-32417,
-32399,
-32449,
-32443,
-32482,
-32526,
-32542,
-32623,
-32629,
-32703,
-32744,
-32796,
-32854,
-32880,
-32924,
-32943,
-32958,
-32953,
-32949,
-32927,
-32916,
-32897,
-32881,
-32877,
-32844,
-32869,
-32821,
-32856,
-32793,
-32821,
-32775,
-32788,
-32765,
-32775,
-32803,
-32830,
-32864,
-32933,
-32957,
-33037,
-33073,
-33135,
-33177,
-33214,
-33262,
-33276,
-33304,
-33311,
-33303,
-33297,
-33274,
-33232,
-33212,
-33154,
-33121,
-33089,
-33053,
-33038,
-33031,
-33032,
-33042,
-33068,
-33079,
-33103,
-33132,
-33141,
-33191,
-33195,
-33252,
-33261,
-33312,
-33336,
-33375,
-33409,
-33438,
-33453,
-33484,
-33462,
-33483,
-33433,
-33429,
-33364,
-33334,
-33281,
-33219,
-33184,
-33106,
-33081,
-33024,
-32986,
-32961,
-32940,
-32939,
-32938,
-32947,
-32976,
-32990,
-33028,
-33030,
-33076,
-33070,
-33090,
-33095,
-33079,
-33096,
-33073,
-33080,
-33056,
-33066,
-33029,
-33025,
-32993,
-32969,
-32936,
-32890,
-32840,
-32809,
-32737,
-32707,
-32647,
-32621,
-32567,
-32550,
-32514,
-32499,
-32489,
-32491,
-32485,
-32515,
-32518,
-32546,
-32558,
-32599,
-32590,
-32642,
-32619,
-32665,
-32652,
-32658,
-32666,
-32646,
-32663,
-32638,
-32643,
-32626,
-32622,
-32614,
-32599,
-32598,
-32566,
-32575,
-32553,
-32559,
-32546,
-32554,
-32551,
-32582,
-32581,
-32640,
-32646,
-32714,
-32743,
-32823,
-32857,
-32946,
-32976,
-33057,
-33106,
-33156,
+32092,
+31981,
+31632,
+31573,
+31994,
+32436,
+32935,
+32719,
+32777,
 33211,
-33244,
-33284,
-33306,
-33325,
-33334,
-33354,
-33362,
-33348,
-33360,
-33350,
-33342,
-33354,
-33329,
-33330,
-33341,
-33322,
-33334,
-33345,
-33334,
-33378,
-33357,
-33407,
-33424,
-33455,
-33505,
-33523,
-33581,
-33596,
-33647,
-33665,
-33704,
-33712,
-33749,
-33747,
-33778,
-33771,
-33774,
-33783,
-33769,
-33769,
-33767,
-33747,
-33765,
-33720,
-33749,
-33699,
-33734,
-33690,
-33720,
-33683,
-33714,
-33682,
-33707,
-33690,
-33698,
-33702,
-33695,
-33699,
-33696,
-33697,
-33696,
-33680,
-33673,
+32886,
+32559,
+32800,
+32644,
+32317,
+32679,
+33327,
 33644,
-33639,
-33602,
-33587,
-33541,
-33503,
-33488,
-33420,
-33407,
-33338,
-33324,
-33260,
-33230,
-33177,
-33146,
-33104,
-33067,
-33030,
-32997,
-32960,
-32927,
-32897,
-32865,
-32818,
-32813,
-32733,
+34184,
+34454,
+34364,
+34780,
+34928,
+34755,
+34535,
+34263,
+33911,
+33382,
+33580,
+33741,
+33267,
+33366,
+33507,
+33296,
+33709,
+34194,
+33680,
+33240,
+33227,
+32796,
+32246,
+32507,
+32431,
+32216,
+32669,
+32815,
+33201,
+33572,
+33297,
+33045,
+32786,
+32380,
+32261,
+31961,
+31462,
+31514,
+31821,
+31643,
+32249,
+33298,
+32214,
+32236,
+32811,
+31260,
+31605,
+31171,
+30990,
+31503,
+31138,
+33074,
+33190,
+34046,
+35391,
+34557,
+35697,
+35365,
+34820,
+34734,
+34091,
+34698,
+33661,
+34974,
+34770,
+35165,
+35871,
+34891,
+36250,
+34796,
+36303,
+34227,
+33860,
+36105,
+31589,
+34146,
+35321,
+32219,
+34839,
+34318,
+32886,
+34036,
+33428,
+32654,
+33034,
+32122,
+31060,
+31537,
+30572,
+30110,
+30773,
+29443,
+29207,
+29019,
+27951,
+28118,
+26879,
+26741,
+26871,
+25590,
+26332,
+26278,
+25376,
+26509,
+26626,
+26219,
+27147,
+27714,
+28056,
+28702,
+29718,
+30589,
+31504,
+32322,
+33251,
+34178,
+35167,
+35850,
+36115,
+37456,
+37681,
+37315,
+38267,
+38252,
+37996,
+38462,
+38060,
+37610,
+37310,
+36833,
+36370,
+35388,
+34788,
+34255,
+33394,
+33013,
+32390,
+32393,
+32673,
+31591,
+31808,
+32508,
+31376,
+31226,
+32219,
+31239,
+31147,
+32750,
+31237,
+31043,
+33279,
+32027,
+31652,
+33918,
+32734,
+31486,
+33504,
+32604,
+30896,
+32781,
+32177,
+30107,
+31448,
+31759,
+30059,
+30943,
+32297,
+30995,
+31554,
+33755,
+32035,
 32748,
-32668,
-32659,
-32608,
-32577,
-32544,
-32491,
-32466,
-32418,
-32385,
-32348,
-32303,
-32268,
+34538,
+33159,
+33275,
+34436,
+34937,
+33837,
+34909,
+36260,
+34331,
+35002,
+36112,
+33953,
+33931,
+35476,
+33577,
+33151,
+34855,
+33208,
+32527,
+34317,
+32963,
+32115,
+33835,
+32467,
+32556,
+33258,
+32947,
+33512,
+33032,
+34104,
+34026,
+33688,
+35630,
+35408,
+34411,
+36528,
+36339,
+34120,
+37186,
+36673,
+34698,
+37874,
+36642,
+35442,
+36786,
+36474,
+34921,
+34215,
+35688,
+32158,
+32158,
+33640,
+29796,
+31950,
+31272,
+30068,
+31246,
+30050,
+30470,
+28953,
+29775,
+28718,
+27611,
+29424,
+28158,
+28666,
+30260,
+29937,
+30894,
+31917,
+31077,
+32271,
+32173,
+31362,
+31748,
+31547,
+31813,
+31254,
+32124,
+33207,
+32316,
+33123,
+32775,
+32580,
+32669,
+31491,
+32541,
+31319,
+31485,
+31906,
+30500,
+33615,
+31883,
+30697,
+34127,
+31230,
+31256,
+32460,
+30940,
+31033,
+30157,
+31027,
+30118,
+30317,
+30898,
+29556,
+31657,
+30314,
+30138,
+31706,
+30037,
+30224,
+30500,
+30084,
+30731,
+29435,
+30492,
+30916,
+30175,
+31846,
+30933,
+32211,
+32080,
+31825,
+33898,
+31920,
+34191,
+34869,
+32878,
+35484,
+35379,
+34506,
+34578,
+36191,
+34631,
+33679,
+36449,
+33120,
+33677,
+35844,
+32159,
+33767,
+35254,
+32360,
+34084,
+34384,
+33019,
+34642,
+34405,
+34003,
+34923,
+35971,
+34790,
+36376,
+36602,
+35753,
+37502,
+34849,
+36680,
+36466,
+34314,
+36744,
+34790,
+34486,
+36366,
+34515,
+34481,
+36100,
+34305,
+33147,
+35377,
+33052,
+32766,
+33726,
+31934,
+32312,
+32538,
+32803,
+32705,
+32939,
+33456,
+33093,
+33789,
+33590,
+34303,
+33928,
+34264,
+34685,
+33979,
+35128,
+34181,
+35078,
+33622,
+34515,
+33802,
+32005,
+34433,
+31164,
+32478,
+31806,
+30391,
+32602,
+29680,
+30727,
+31279,
+29665,
+29403,
+30398,
+29474,
+28817,
+30526,
+29066,
+30344,
+30407,
+29586,
+30996,
+31073,
+30301,
+31200,
+31784,
+29744,
+32103,
+31267,
+29710,
+33184,
+30401,
+29864,
+32876,
+30426,
+29328,
+32505,
+30444,
+28561,
+32788,
+29311,
+29052,
+32692,
+29164,
+30015,
+32843,
+30824,
+30433,
+34103,
+32255,
+31481,
+35049,
+33033,
+32694,
+34786,
+34553,
+32652,
+34713,
+35911,
+32526,
+34393,
+36491,
+32599,
+34295,
+35921,
+31726,
+33946,
+33434,
+31198,
+33107,
+30495,
+31897,
+31098,
+29480,
+32815,
+29836,
 32248,
-32202,
-32186,
-32161,
-32126,
-32125,
-32097,
-32085,
-32078,
-32057,
-32062,
-32040,
-32042,
-32025,
-32022,
-32008,
-32006,
-31984,
-31980,
-31962,
-31963,
-31940,
-31950,
-31925,
-31932,
-31934,
-31920,
-31955,
-31928,
-31968,
-31967,
-31995,
-32015,
+33079,
+30745,
+33844,
+34132,
 32033,
-32072,
-32079,
-32128,
-32150,
-32169,
-32214,
-32218,
-32244,
-32268,
-32264,
-32278,
-32266,
-32269,
-32238,
-32235,
-32199,
-32192,
-32155,
-32148,
-32115,
-32124,
-32078,
-32117,
-32066,
-32128,
-32092,
-32149,
-32143,
-32196,
-32207,
-32252,
-32271,
-32316,
-32345,
-32362,
-32405,
-32404,
-32422,
-32420,
-32412,
-32398,
-32391,
-32348,
-32336,
-32296,
-32259,
-32224,
-32183,
-32140,
-32111,
-32064,
-32021,
-32011,
-31951,
-31947,
-31907,
-31898,
-31890,
-31867,
-31883,
-31863,
-31886,
-31878,
-31895,
-31896,
-31913,
-31925,
-31933,
-31966,
-31953,
-31973,
-31968,
-31982,
-31973,
-31974,
-31965,
-31952,
-31955,
-31925,
-31944,
-31925,
-31942,
-31945,
-31943,
-31964,
-31966,
-31976,
-31991,
-31988,
-31989,
-31986,
-31995,
-31996,
-32019,
-32019,
-32043,
-32060,
-32087,
-32115,
-32156,
-32198,
-32242,
-32302,
-32353,
-32414,
-32475,
-32533,
-32595,
-32646,
-32690,
-32732,
-32762,
-32806,
+33931,
+36364,
+32324,
+35002,
+37419,
+33115,
+36226,
+37134,
+34458,
+35813,
+36977,
+35228,
+34096,
+36217,
+33589,
+33244,
+34735,
+32223,
 32804,
-32841,
-32852,
-32867,
-32898,
-32904,
-32938,
-32942,
-32974,
-32987,
-33011,
-33024,
-33049,
-33074,
-33088,
-33127,
-33142,
-33178,
-33225,
-33241,
-33311,
+32947,
+32394,
+31233,
+33253,
+32502,
+30610,
+33741,
+31724,
+32568,
+33324,
+33206,
+33951,
+32696,
+35178,
+33863,
+33849,
+35038,
+34512,
+34472,
+35052,
+34751,
+33999,
+36290,
+32407,
+34374,
+35829,
+30893,
+34914,
+33209,
+31556,
 33327,
-33393,
-33435,
-33484,
-33532,
-33564,
-33608,
-33625,
-33654,
-33647,
-33638,
-33613,
-33572,
-33527,
-33478,
-33421,
-33363,
-33316,
-33266,
-33243,
-33198,
-33202,
-33173,
-33189,
-33174,
-33188,
-33187,
-33188,
-33203,
-33187,
-33215,
+31497,
+31724,
+30588,
+31740,
+29989,
+29932,
+31426,
+29078,
+30580,
+30772,
+30885,
+30385,
+31662,
+32728,
+30247,
+32596,
+33672,
+30907,
+32930,
+34636,
+31866,
+34000,
+33949,
+32817,
+34261,
+32541,
+33321,
+33123,
+31905,
+32048,
+32600,
+31866,
+31923,
+32981,
+31646,
+33091,
+32885,
+32249,
+34230,
+32857,
+33125,
+34589,
+32769,
+33928,
+34585,
+32895,
+34980,
+34173,
+34604,
+34961,
+34172,
+35456,
+33906,
+34653,
+34155,
+33698,
+32988,
+33265,
+32153,
+31187,
 33197,
+29216,
+32007,
+30878,
+28127,
+32142,
+28289,
+28734,
+29923,
+29023,
+28291,
+29748,
+31165,
+27765,
+31946,
+31219,
+29892,
+32803,
+31639,
+31348,
+32218,
+33236,
+31402,
+32555,
+34335,
+31557,
+33945,
+33934,
+33424,
+33989,
+33128,
+34289,
+31938,
+34140,
+34487,
+31560,
+33953,
+35086,
+32590,
+33659,
+36084,
+33711,
+33448,
+35011,
+34093,
 33209,
-33226,
-33202,
-33226,
-33190,
-33193,
-33169,
-33131,
-33106,
-33044,
-33010,
-32925,
-32880,
-32785,
-32721,
-32635,
-32546,
-32494,
-32402,
-32374,
-32301,
-32275,
-32247,
-32230,
-32229,
-32226,
-32242,
-32244,
-32269,
-32273,
-32303,
-32317,
-32330,
-32358,
-32358,
-32381,
-32383,
-32397,
-32382,
-32402,
-32374,
-32390,
-32374,
-32361,
-32367,
-32353,
-32346,
-32357,
-32339,
-32366,
-32353,
-32363,
-32368,
-32379,
-32382,
-32406,
-32401,
-32436,
-32435,
-32477,
-32476,
-32519,
-32530,
-32558,
-32583,
-32605,
-32632,
-32652,
-32665,
-32692,
-32701,
-32728,
-32733,
-32764,
+34046,
+34920,
+33459,
+34544,
+34606,
+34160,
+35649,
+33767,
+35303,
+35018,
+33045,
+34771,
+33791,
+33272,
+34063,
+32371,
+31870,
+33820,
+31520,
+30807,
+33406,
+30115,
+30590,
+31880,
+28995,
+30714,
+30937,
+28941,
+30536,
+31944,
+29877,
+31192,
+32938,
+30545,
+32909,
+33311,
+31363,
+33801,
+32669,
+32616,
+34179,
+32592,
+34336,
+34204,
+33397,
+34168,
+34298,
+33800,
+33445,
+34123,
+32588,
+33121,
+33244,
+32092,
+33801,
+32464,
+33477,
+32509,
+33109,
+34305,
+32271,
+35023,
+32463,
+34281,
+34598,
+31906,
+36693,
+33716,
+33235,
+36491,
+33545,
+34406,
+35958,
+33984,
+33336,
+36285,
+33516,
+33145,
+36192,
+32074,
+33164,
+34834,
+31514,
+33748,
+33180,
+31503,
+32367,
+31078,
+32091,
+30746,
+29360,
+30632,
+29788,
+28089,
+29968,
+29873,
+26806,
+30004,
+29240,
+26725,
+30773,
+28970,
+26855,
+29984,
+30357,
+27648,
+30640,
+32095,
+29443,
+31379,
+34211,
+32335,
+32715,
+35364,
 32772,
-32810,
-32823,
-32852,
-32881,
-32908,
-32933,
-32965,
-32983,
-33010,
-33035,
-33055,
-33072,
-33083,
-33095,
-33110,
-33112,
-33139,
-33128,
-33163,
-33158,
-33181,
-33193,
-33198,
-33230,
-33236,
-33270,
-33269,
-33302,
-33306,
-33337,
-33345,
-33367,
-33385,
-33402,
-33422,
-33437,
-33454,
-33463,
-33476,
-33488,
-33481,
-33490,
-33489,
-33483,
-33481,
-33459,
-33469,
-33454,
-33469,
-33460,
-33463,
-33465,
-33483,
-33471,
-33511,
-33480,
-33520,
-33501,
-33513,
-33524,
-33523,
-33530,
-33542,
-33529,
-33535,
-33529,
-33514,
-33515,
-33496,
-33488,
-33480,
-33454,
-33468,
-33434,
-33450,
-33430,
-33425,
-33427,
-33401,
-33414,
-33405,
-33407,
-33400,
-33412,
-33412,
-33423,
-33436,
-33436,
-33444,
+34234,
+35613,
+34649,
+35791,
+35789,
+35761,
+36294,
+37197,
+36680,
+36301,
+36950,
+35488,
+34947,
+35704,
+35301,
+33453,
+34113,
+34250,
+32808,
+33985,
+33002,
+32516,
+33050,
+31141,
+31776,
+31792,
+30389,
+31205,
+30785,
+29998,
+31473,
+31860,
+30115,
+31943,
+32483,
+30275,
+32462,
+33024,
+30781,
+32740,
+33164,
+31650,
+33927,
+33606,
+32509,
+34468,
+33765,
+32929,
+34509,
+33190,
+32052,
+34256,
+31610,
+32067,
+34206,
+30533,
+32964,
+33172,
+31207,
+33974,
+31869,
+32833,
+33533,
+31554,
+33351,
+33042,
+32407,
+33325,
 33447,
-33425,
-33430,
-33406,
+33070,
+32994,
+33963,
+34048,
+33009,
+34616,
+33717,
+33090,
+33971,
+32978,
+33931,
+31991,
+33308,
+33260,
+31509,
+34022,
+32373,
+32257,
+33709,
+32677,
+32658,
+33115,
+33375,
+31900,
+33275,
+33255,
+33018,
+34112,
+32843,
+34070,
+33897,
+33291,
+34681,
 33394,
-33360,
-33345,
-33289,
-33282,
-33225,
-33205,
-33156,
-33133,
-33085,
-33066,
-33019,
-33005,
-32972,
-32957,
-32942,
-32927,
-32911,
-32915,
-32891,
-32895,
-32873,
-32870,
-32867,
-32851,
-32848,
-32827,
-32816,
-32805,
-32776,
-32770,
-32730,
-32720,
-32685,
-32651,
-32626,
-32578,
-32568,
-32511,
-32517,
-32459,
-32470,
-32430,
-32418,
-32421,
-32383,
-32406,
-32377,
-32404,
-32390,
-32411,
-32417,
-32426,
-32447,
-32452,
-32464,
-32481,
-32470,
-32499,
-32484,
-32493,
-32479,
-32473,
-32480,
+32292,
+34068,
+33036,
+31649,
+33439,
+32262,
+30875,
+31774,
+31118,
+30187,
+30635,
+29561,
+29612,
+30460,
+28709,
+30313,
+29491,
+28612,
+31771,
+29343,
+29406,
+31780,
+30550,
+30951,
+31957,
+32845,
+32778,
+33510,
+35222,
+34482,
+35596,
+36580,
+36092,
+36632,
+37396,
+37524,
+37306,
+37233,
+37362,
+37721,
+36489,
+36264,
+37036,
+35922,
+34869,
+35491,
+34315,
+33198,
+33553,
+32155,
+31585,
+32083,
+31437,
+30607,
+31557,
+31169,
+31118,
+32076,
+30625,
+31460,
+31958,
+30947,
+30968,
+32095,
+31870,
+30923,
+32510,
+32292,
+31605,
+32265,
+32400,
+30711,
+30703,
+32740,
+30064,
+29939,
+32092,
+30248,
+30472,
+31627,
+31175,
+30444,
+31536,
+32037,
+30313,
 32471,
-32470,
-32477,
-32459,
-32478,
-32466,
-32474,
-32473,
-32480,
-32476,
-32491,
-32490,
-32494,
-32495,
-32489,
-32506,
-32487,
-32521,
-32472,
-32532,
-32479,
-32531,
-32500,
-32528,
-32530,
-32537,
-32543,
-32542,
-32546,
-32547,
-32553,
-32539,
-32557,
-32548,
-32553,
-32578,
-32576,
-32600,
+32401,
+30844,
+32666,
+32599,
+32582,
+32865,
+33181,
+32923,
+32561,
+33388,
+33182,
+33017,
+33114,
+33295,
+32580,
+32686,
+33384,
+32736,
+32645,
+32960,
+32877,
+32067,
+33129,
+32741,
+31672,
+32638,
+32342,
+32564,
+32330,
+32568,
+33262,
+31885,
+32424,
+32941,
+32211,
+33153,
+33126,
+32304,
+33307,
+33218,
+32779,
+33789,
+33454,
+33086,
+33877,
+33702,
+33758,
+33620,
+34022,
+33429,
+32597,
+33909,
+33111,
+33009,
+33715,
+33388,
+33305,
+33138,
+33556,
+33606,
+33356,
+33305,
+33758,
+33724,
+32866,
+33986,
+34341,
+33311,
+33779,
+33768,
+33620,
+34378,
+33932,
+34079,
+34818,
+33642,
+34271,
+35018,
+34031,
+34520,
+34398,
+33938,
+33791,
+33781,
+34178,
+33371,
+33630,
+33562,
+33080,
+33389,
+32847,
+32921,
+32718,
+32217,
+32098,
+32159,
+31986,
+31646,
+31780,
+31876,
+31965,
+31017,
+31241,
+31801,
+30572,
+30407,
+31147,
+30842,
+30291,
+30656,
+31166,
+30916,
+30611,
+31318,
+31723,
+30435,
+31127,
+31752,
+30950,
+31381,
+31496,
+31830,
+31810,
+32091,
+32700,
+32343,
+32818,
+32574,
+32756,
+33202,
+32213,
+33007,
+32651,
+32136,
+33186,
+33010,
+32325,
+32574,
+33171,
+32174,
+32179,
+33081,
+32811,
+31883,
+31981,
+33128,
+32299,
+31729,
+32654,
+32519,
+31371,
+32102,
+32610,
+31877,
+32201,
+32113,
+32774,
+32079,
+31930,
+33582,
+32928,
+32083,
+32907,
+33146,
+32779,
+32771,
+32821,
+33776,
+33168,
 32600,
-32605,
-32623,
-32602,
+33884,
+33927,
+33069,
+33483,
+34537,
+33195,
+33403,
+34325,
+33587,
+34117,
+34021,
+33978,
+33640,
+33740,
+34066,
+33372,
+33578,
+33369,
+33078,
+33430,
+33577,
+33338,
+33454,
+33658,
+33159,
+33702,
+34081,
+33256,
+33492,
+33576,
+33144,
+33531,
+33670,
+33729,
+33365,
+33580,
+34220,
+33502,
+34142,
+34665,
+33724,
+33951,
+34224,
+33820,
+34053,
+34669,
+34234,
+33687,
+34554,
+34423,
+33917,
+34588,
+33968,
+33726,
+33708,
+33049,
+33576,
+33327,
+32757,
+33116,
+32778,
+32498,
+32837,
+32663,
+32074,
+32079,
+32276,
+31834,
+31881,
+31707,
+31585,
+31765,
+31625,
+31681,
+31580,
+31960,
+31486,
+31047,
+31863,
+31208,
+31102,
+31735,
+31550,
+31400,
+31734,
+32341,
+31686,
+31851,
 32615,
-32589,
-32592,
-32573,
+31569,
+31096,
+31865,
+31528,
+30958,
+31629,
+31307,
+31124,
+31480,
+31325,
+31528,
+31402,
+31686,
+31658,
+30974,
+31551,
+31964,
+31356,
+31709,
+32175,
+31497,
+31802,
+32318,
+31721,
+31837,
+32013,
+31585,
+31553,
+31285,
+31210,
+31640,
+31140,
+31085,
+31457,
+30874,
+31218,
+31474,
+30886,
+30998,
+31063,
+30964,
+30805,
+31385,
+31696,
+31057,
+31832,
+32143,
+32044,
+32812,
+33079,
+33284,
+33301,
+33313,
+34188,
+34105,
+33981,
+34833,
+34748,
+34823,
+35347,
+35778,
+35933,
+35940,
+36173,
+36074,
+35755,
+36122,
+36255,
+35790,
+35689,
+36036,
+35974,
+35693,
+36379,
+36328,
+35540,
+36153,
+35969,
+35169,
+35894,
+35556,
+34967,
+35095,
+34732,
+34825,
+34999,
+34725,
+34828,
+34688,
+34055,
+34267,
+34222,
+33488,
+33662,
+33473,
+32681,
+32994,
+33274,
+33134,
+33242,
+33112,
+33067,
+32929,
+32858,
+33233,
+33016,
+32794,
+32992,
+32907,
+32805,
+32978,
+32973,
+32613,
+32173,
+31954,
+31784,
+31716,
+31769,
+31370,
+31193,
+30731,
+30319,
+30374,
+29742,
+29466,
+29388,
+28728,
+28541,
+28976,
+28732,
+28645,
+28836,
+28598,
+28608,
+28625,
+28915,
+28706,
+28487,
+28879,
+28866,
+28614,
+28723,
+28820,
+29193,
+30531,
+30989,
+30912,
+31333,
+31150,
+30904,
+31029,
+30956,
+31159,
+31196,
+30898,
+32031,
+33711,
+33762,
+33720,
+34725,
+34403,
+33675,
+34212,
+34497,
+35085,
+35441,
+35503,
+36565,
+37044,
+37278,
+37448,
+37247,
+36954,
+36179,
+35811,
+35846,
+36019,
+35675,
+35392,
+35528,
+34447,
+33725,
+33489,
+32225,
+31427,
+30826,
+29912,
+29677,
+30076,
+30040,
+29736,
+30003,
+29671,
+28841,
+29044,
+29232,
+29445,
+30070,
+30289,
+31505,
+32574,
+33222,
+34680,
+35054,
+35121,
+35761,
+35890,
+36393,
+37230,
+37900,
+38058,
+38264,
+38660,
+38416,
+38405,
+38115,
+37355,
+36704,
+36087,
+35639,
+35535,
+35366,
+34504,
+33980,
+33373,
+32262,
+32130,
+31555,
+30951,
+30958,
+30484,
+30666,
+31008,
+31196,
+31516,
+31283,
+30945,
+31015,
+31187,
+31195,
+31706,
+32061,
+31744,
+32284,
+32853,
 32563,
-32545,
-32536,
-32524,
-32512,
-32518,
-32485,
-32512,
-32483,
-32497,
-32484,
-32480,
-32489,
-32466,
-32506,
-32466,
-32507,
-32476,
-32506,
-32468,
-32497,
-32460,
-32483,
-32450,
-32460,
-32437,
-32428,
-32424,
-32383,
-32380,
-32336,
-32321,
-32277,
-32247,
-32208,
-32167,
-32156,
-32114,
-32122,
-32088,
-32111,
-32100,
-32129,
-32120,
-32147,
-32150,
-32162,
-32188,
-32172,
-32204,
-32202,
-32213,
-32238,
-32234,
-32260,
-32257,
-32273,
-32291,
-32290,
-32302,
-32308,
+32801,
+32788,
+32093,
+31892,
+32002,
+32054,
+32169,
 32319,
-32328,
-32332,
-32347,
-32350,
-32385,
-32383,
-32423,
-32430,
-32455,
-32492,
-32505,
-32559,
-32565,
-32624,
-32629,
-32683,
-32707,
-32725,
-32777,
-32772,
-32805,
-32809,
-32815,
-32835,
-32838,
-32848,
-32858,
-32867,
-32881,
-32898,
-32908,
-32930,
-32940,
-32959,
-32989,
-32989,
-33029,
-33033,
-33085,
-33086,
-33155,
-33152,
-33211,
-33224,
-33239,
-33275,
-33268,
-33288,
+32304,
+32206,
+32174,
+32498,
+32238,
+31871,
+32322,
+31960,
+32002,
+32819,
+32966,
+33098,
+33386,
+33293,
+33012,
+33183,
+33084,
+32599,
+32527,
+32463,
+32199,
+32246,
+32508,
+32120,
+31680,
+31596,
+30980,
+30866,
+30903,
+30692,
+30505,
+30249,
+30467,
+30515,
+30579,
+30930,
+31061,
+30844,
+31228,
+31650,
+31820,
+32553,
+32659,
+32744,
+33061,
+33068,
+33237,
+33456,
+33855,
+34480,
+34389,
+34792,
+35414,
+35371,
+35687,
+35380,
+34911,
+34705,
+34448,
+33893,
+33883,
+34251,
+33361,
+32888,
 33291,
-33283,
-33289,
-33290,
-33277,
-33294,
-33289,
-33294,
-33309,
-33319,
-33331,
-33349,
-33346,
-33377,
-33375,
-33392,
-33395,
-33413,
-33418,
-33435,
-33428,
-33442,
+33030,
+32359,
+31799,
+31761,
+31356,
+30492,
+30788,
+31001,
+30664,
+30542,
+30569,
+30586,
+30327,
+30402,
+30237,
+30149,
+30242,
+30177,
+30538,
+30857,
+31077,
+31080,
+31027,
+31101,
+31483,
+31654,
+31648,
+32362,
+32937,
+33048,
+33617,
+34446,
+34425,
+34269,
+34523,
+34563,
+34355,
+34408,
+34570,
+34303,
+34620,
+34566,
+33862,
+34104,
+33692,
+33209,
 33431,
-33432,
-33417,
-33410,
-33384,
-33381,
-33330,
-33309,
-33275,
-33227,
-33195,
-33145,
-33101,
-33069,
-33035,
-32985,
-32985,
-32954,
-32955,
-32952,
-32958,
-32978,
-33009,
-33025,
-33069,
-33071,
-33118,
-33133,
-33154,
-33179,
-33164,
-33203,
-33165,
+33246,
 33194,
-33164,
-33157,
-33151,
-33112,
-33109,
-33047,
-33037,
-32975,
-32946,
-32898,
-32862,
-32814,
-32792,
-32748,
-32749,
-32701,
-32711,
-32683,
-32706,
-32698,
-32719,
-32742,
-32756,
-32781,
-32812,
-32821,
-32865,
-32852,
-32894,
-32884,
-32908,
-32891,
-32889,
-32885,
-32854,
-32866,
-32820,
-32813,
-32796,
-32763,
-32757,
-32740,
-32705,
-32728,
-32673,
-32700,
-32682,
-32681,
-32701,
-32690,
-32719,
-32733,
-32746,
-32783,
-32786,
-32828,
-32830,
-32863,
-32869,
-32886,
+33154,
+32867,
 32887,
-32892,
+32925,
+32648,
+32677,
+32433,
+32438,
+32829,
 32889,
-32876,
-32866,
-32851,
-32819,
-32809,
-32778,
-32766,
+33293,
+33513,
+33913,
+34040,
+33689,
+34284,
+34489,
+34349,
+34862,
+35209,
+35353,
+35633,
+35947,
+36098,
+35992,
+35678,
+35402,
+34869,
+34538,
+34526,
+34123,
+34024,
+33745,
+33313,
+33132,
+32684,
+32516,
+32189,
+31600,
+31335,
+31414,
+31413,
+31476,
+31979,
+32205,
+31725,
+31868,
+32356,
+31891,
+31971,
+32442,
+32252,
+32408,
+32922,
+33357,
+33570,
+33644,
+33503,
+33090,
+32826,
+32615,
+32642,
+32537,
+32366,
+32579,
+32551,
+32552,
+32744,
+32312,
+31674,
+31305,
+30922,
+30649,
+30842,
+31190,
+31190,
+31186,
+31433,
+31633,
+31167,
+31384,
+31414,
+31152,
+32568,
+32776,
 32748,
-32725,
-32727,
-32711,
-32701,
-32713,
-32689,
-32698,
-32700,
-32705,
-32704,
-32730,
-32722,
-32755,
-32759,
-32777,
-32782,
-32799,
+33409,
+33501,
+33368,
+32741,
+33030,
+33203,
+32573,
+32541,
+33565,
+34144,
+33420,
+33563,
+33939,
+33420,
+32790,
+32452,
+32901,
+32971,
+32401,
+32930,
+33793,
+33483,
+33305,
+33551,
+33241,
+32826,
+32523,
+32272,
+32540,
+32625,
+32277,
+32245,
+32031,
+31353,
+30685,
+30305,
+29984,
+29663,
+29029,
+28665,
+28931,
+28736,
+28019,
+27664,
+27519,
+26951,
+28355,
+30983,
+32041,
+32156,
+32784,
+34263,
+33566,
+33300,
+35639,
+35443,
+33804,
+34906,
+37527,
+37759,
+37154,
+38026,
+38063,
+36860,
+35523,
+35637,
+36771,
+36149,
+34986,
+35468,
+36034,
+35564,
+34855,
+34500,
+33672,
+32082,
+31010,
+30735,
+30982,
+31544,
+31644,
+31303,
+31551,
+31903,
+31296,
+30748,
+31163,
+30955,
+30253,
+31125,
+32836,
+33558,
+34151,
+35209,
+35328,
+34621,
+34441,
+34552,
+34381,
+34377,
+34381,
+34692,
+35348,
+35528,
+35497,
+35154,
+34231,
+33435,
+32741,
+32177,
+32418,
 32794,
-32796,
-32800,
-32779,
-32782,
-32738,
-32748,
-32689,
-32688,
-32645,
-32618,
-32587,
-32554,
-32526,
-32483,
+32867,
+32712,
+32832,
+33079,
+32444,
+31878,
+31497,
+30758,
+30456,
+30647,
+30974,
+31399,
+31731,
+31784,
+31569,
+31516,
+31524,
+31252,
+30932,
+31013,
+31330,
+31393,
+31941,
+32592,
+32412,
+32230,
+32100,
+31909,
+31674,
+31654,
+32020,
+31984,
+31989,
+32349,
+32485,
+32451,
+32403,
+32184,
+31745,
+31843,
+32137,
+32263,
+32973,
+33444,
+33605,
+33859,
+33991,
+34216,
+34135,
+34041,
+34207,
+34265,
+34555,
+35117,
+35308,
+35324,
+35220,
+34611,
+34265,
+34184,
+33580,
+33289,
+33326,
+32901,
+32863,
+33116,
+32930,
+32663,
+32335,
+31829,
+31434,
+31292,
+31311,
+31392,
+31319,
+31166,
+31276,
+31417,
+31357,
+31272,
+31174,
+30780,
+30529,
+30807,
+31062,
+31208,
+31404,
+31482,
+31462,
+31863,
+32295,
+32469,
+32681,
+33054,
+33830,
+34115,
+34418,
+35300,
+35422,
+35082,
+35288,
+35543,
+35372,
+35201,
+35363,
+35582,
+35370,
+35136,
+34975,
+34792,
+34633,
+33862,
+33193,
+33215,
+32915,
+32208,
+31974,
+32025,
+31429,
+30828,
+30663,
+30568,
+30548,
+30332,
+30507,
+30912,
+31054,
+31330,
+31654,
+31819,
+32034,
+32242,
+32188,
+32555,
+33310,
+33274,
+33606,
+34372,
+34068,
+34034,
+34376,
+34150,
+33788,
+33596,
+33304,
+32795,
 32477,
-32430,
-32447,
-32404,
-32420,
-32401,
-32403,
-32393,
-32394,
-32378,
-32389,
-32356,
-32376,
-32343,
-32369,
-32326,
-32366,
-32326,
-32362,
-32333,
-32355,
-32332,
-32336,
-32312,
-32302,
-32279,
-32263,
-32257,
-32222,
+32266,
+31823,
+31486,
+31013,
+30311,
+29919,
+29415,
+28784,
+28271,
+27891,
+27752,
+28038,
+28784,
+29335,
+29538,
+29826,
+30337,
+30508,
+30745,
+31796,
+32490,
+32752,
+33794,
+35048,
+35894,
+36509,
+36919,
+37396,
+37433,
+37107,
+37308,
+37795,
+37583,
+37246,
+37427,
+36998,
+36342,
+36058,
+35303,
+34273,
+33650,
+32921,
+31962,
+31587,
+31324,
+30517,
+30180,
+30046,
+29600,
+29314,
+28960,
+29021,
+28925,
+28882,
+29466,
+29834,
+30478,
+30941,
+31420,
+32202,
+32570,
+32935,
+33281,
+33585,
+33798,
+34077,
+34558,
+34891,
+35308,
+35385,
+35235,
+35314,
+35109,
+34951,
+34843,
+34715,
+34522,
+34302,
+34336,
+34135,
+33821,
+33603,
+33074,
+32512,
+32267,
+32036,
+31875,
+31897,
+32056,
+32134,
+32271,
+32583,
+32616,
+32590,
+32585,
+32582,
+32761,
+33004,
+33431,
+33865,
+34052,
+34099,
+34376,
+34242,
+33980,
+34101,
+34309,
+35163,
+35856,
+36404,
+36324,
+36011,
+35606,
+34376,
+34124,
+33614,
+32751,
+32283,
+32361,
+32724,
+32373,
+32270,
+31985,
+31492,
+31079,
+30890,
+31147,
+31462,
+31783,
+31799,
+32191,
+32611,
+32381,
+32360,
+32559,
+32315,
+32061,
+32213,
+32402,
+32517,
+32417,
 32240,
-32201,
+31797,
+31163,
+30643,
+30153,
+30049,
+29892,
+29295,
+28912,
+28620,
+28178,
+27662,
+26922,
+26201,
+25318,
+25844,
+28224,
+29085,
+29262,
+30043,
+30741,
+30269,
+29585,
+31494,
+32188,
+30913,
+31527,
+34175,
+35915,
+35587,
+36053,
+37614,
+37353,
+35551,
+35810,
+37565,
+37491,
+36630,
+37097,
+37864,
+37579,
+36928,
+36489,
+35809,
+34408,
+33136,
+32475,
 32217,
-32186,
-32205,
-32178,
-32194,
-32181,
-32173,
-32186,
-32174,
-32180,
-32192,
-32186,
-32192,
-32213,
-32205,
-32235,
-32228,
-32246,
-32258,
-32265,
-32283,
-32285,
-32305,
-32324,
-32318,
-32339,
-32340,
-32331,
-32345,
-32331,
-32329,
-32329,
-32331,
-32332,
-32341,
-32350,
-32357,
-32378,
-32399,
-32408,
-32444,
-32444,
-32500,
-32501,
-32562,
-32579,
-32637,
-32668,
-32730,
-32762,
-32832,
-32857,
-32924,
-32930,
-32980,
-32982,
-33020,
-33014,
-33036,
-33019,
-33038,
-33020,
-33035,
-33007,
-33040,
-33008,
-33031,
-33024,
-33017,
-33037,
-33017,
-33053,
-33034,
-33067,
-33059,
-33067,
-33084,
-33067,
-33098,
-33081,
-33096,
-33091,
-33099,
-33088,
-33087,
-33078,
-33057,
-33040,
-33014,
-32973,
-32952,
-32910,
-32871,
-32850,
-32809,
-32800,
-32780,
-32785,
-32777,
-32800,
-32806,
-32831,
-32838,
-32873,
-32883,
-32923,
-32931,
-32976,
-32968,
-33016,
-33009,
-33049,
-33039,
-33057,
-33046,
-33060,
-33039,
-33035,
-33007,
-32987,
-32975,
-32939,
-32926,
-32885,
-32884,
-32838,
-32855,
-32809,
-32838,
-32803,
-32818,
-32840,
-32836,
-32890,
+32531,
+32382,
+31516,
+31083,
+31029,
+30005,
+28928,
+29167,
+29078,
+28244,
+28629,
+30206,
+31172,
+31691,
+32882,
+33739,
+33607,
+33455,
+34024,
+34807,
+35042,
+35410,
+36188,
+36782,
+37181,
+37716,
+37637,
+37031,
+36794,
+36290,
+35624,
+35584,
+35996,
+35732,
+34897,
+34597,
+34273,
+33312,
+32349,
+31840,
+31109,
+30352,
+30195,
+30221,
+30338,
+30467,
+30485,
+30236,
+30258,
+30518,
+30417,
+30510,
+31043,
+31427,
+31625,
+32226,
 32897,
-32947,
-32960,
-33010,
-33019,
-33068,
-33071,
-33110,
-33121,
-33142,
-33140,
-33163,
-33138,
-33157,
-33131,
-33123,
-33108,
-33077,
-33065,
-33030,
-33028,
-32999,
-32991,
-32982,
-32989,
-32996,
-33006,
-33025,
-33040,
-33080,
-33089,
-33126,
-33140,
-33182,
-33195,
-33238,
-33238,
-33272,
-33279,
-33285,
-33293,
-33274,
-33265,
-33243,
-33214,
-33174,
-33152,
-33094,
-33074,
-33026,
-33001,
-32977,
-32953,
-32941,
-32928,
-32930,
-32924,
-32938,
-32943,
-32968,
-32981,
-33013,
+33246,
+33310,
+33372,
+33702,
+33723,
+33904,
+34525,
+34661,
+34829,
+35046,
+34934,
+34910,
+34760,
+34326,
+33970,
+33749,
+33547,
+33737,
+33901,
+33819,
+33753,
+33371,
 33030,
-33050,
-33082,
-33081,
-33100,
-33095,
-33090,
-33073,
-33058,
-33023,
-32995,
-32963,
-32911,
-32878,
-32808,
-32769,
-32712,
-32661,
-32627,
-32563,
-32549,
-32516,
-32503,
-32501,
-32505,
-32502,
-32531,
-32529,
-32558,
-32564,
-32581,
-32594,
-32595,
-32618,
-32615,
-32621,
-32632,
-32616,
-32625,
-32600,
-32592,
-32572,
-32541,
-32507,
-32485,
-32416,
-32418,
-32359,
-32353,
-32326,
-32325,
-32312,
-32323,
-32325,
-32330,
-32357,
-32351,
-32389,
+32760,
 32387,
-32413,
-32422,
-32455,
-32449,
-32490,
-32468,
-32494,
-32479,
-32482,
-32462,
-32454,
-32438,
-32421,
-32407,
-32370,
-32360,
-32321,
-32318,
-32289,
-32263,
-32267,
-32237,
-32250,
-32234,
-32257,
-32254,
-32289,
-32302,
-32330,
-32353,
-32380,
-32398,
-32427,
-32436,
-32459,
-32479,
-32484,
-32514,
-32509,
-32534,
-32535,
-32554,
-32538,
-32555,
-32525,
-32538,
-32520,
-32511,
-32501,
-32481,
-32478,
-32466,
-32470,
-32461,
-32481,
+32187,
+32004,
+31955,
+32171,
+32446,
+32720,
+32902,
+32745,
+32448,
+32199,
+32011,
+31940,
+31926,
+31989,
+32077,
+32292,
 32459,
-32496,
-32461,
-32507,
-32473,
-32507,
-32489,
-32512,
 32505,
-32518,
-32514,
-32518,
-32511,
-32501,
-32508,
+32747,
+32707,
 32483,
-32497,
-32476,
-32464,
-32459,
-32450,
-32453,
-32443,
-32450,
-32445,
-32448,
-32455,
-32445,
-32470,
-32464,
-32484,
-32492,
-32508,
-32536,
-32545,
-32583,
-32582,
-32619,
-32614,
+32734,
+32923,
+33005,
+33278,
+33610,
+33515,
+33165,
+33120,
+32973,
 32638,
-32630,
-32647,
-32651,
-32633,
-32656,
+32297,
+32173,
+31940,
+31717,
+31791,
+31645,
+31458,
+31264,
+30759,
+30264,
+30218,
+30356,
+30365,
+30438,
+30805,
+31036,
+31027,
+31294,
+31442,
+31392,
+31414,
+31502,
+31851,
+32218,
 32629,
-32638,
-32633,
-32618,
-32635,
-32618,
-32622,
-32607,
-32621,
-32593,
-32618,
-32600,
-32619,
-32618,
-32636,
-32639,
-32659,
-32669,
+33001,
+33146,
+33295,
+33332,
+33327,
+33357,
+33382,
+33192,
+32996,
+33251,
+33396,
+33303,
+33497,
+33481,
+33055,
+32811,
+32582,
+32249,
+32229,
+32279,
+32210,
+32441,
 32667,
-32707,
-32678,
-32734,
-32704,
-32740,
+32803,
+32751,
+32444,
+32386,
+32119,
+31813,
+31973,
+32120,
+32195,
+32353,
+32399,
+32284,
+32208,
+31980,
+31566,
+31377,
+31198,
+30903,
+30735,
+30683,
+30609,
+30682,
+31118,
+31736,
+32176,
+32588,
+33138,
+33274,
+33439,
+34016,
+34289,
+34368,
+34665,
+35033,
+35298,
+35527,
+35861,
+36099,
+36290,
+36510,
+36633,
+36938,
+37301,
+37292,
+37179,
+37236,
+37132,
+36888,
+36685,
+36456,
+35987,
+35258,
+34824,
+34504,
+34016,
+33622,
+33085,
+32512,
+32050,
+31488,
+30990,
+30604,
+30207,
+29841,
+29605,
+29625,
+29916,
+30181,
+30280,
+30610,
+30977,
+31009,
+31329,
+31813,
+32055,
+32289,
+32471,
 32737,
-32745,
-32759,
-32755,
-32778,
-32763,
-32787,
-32757,
-32785,
-32748,
-32785,
-32757,
-32792,
-32773,
+33115,
+33329,
+33449,
+33638,
+33750,
+33740,
+33761,
+33936,
+34013,
+33913,
+33910,
+33817,
+33686,
+33589,
+33403,
+33252,
+33007,
+32784,
+32569,
+32320,
+32084,
+31592,
+31629,
+31813,
+31392,
+31358,
+31374,
+31165,
+30955,
+30950,
+31351,
+31285,
+31264,
+31615,
+31949,
+32288,
+32287,
+32535,
+32869,
+32617,
+32436,
+32711,
+33082,
+33000,
+32845,
+33214,
+33362,
+33129,
+33273,
+33591,
+33440,
+33193,
+33278,
+33228,
+33228,
+33337,
+33220,
+33093,
+32841,
+32606,
+32460,
+32271,
+32262,
+32081,
+31834,
+32057,
+32153,
+31877,
+31886,
+31815,
+31254,
+30812,
+30615,
+30480,
+30361,
+30056,
+29872,
+29913,
+29708,
+29461,
+29241,
+28929,
+29187,
+30198,
+31362,
+32352,
+33044,
+33499,
+33774,
+33703,
+33901,
+34592,
+34791,
+34563,
+34975,
+35961,
+36234,
+35859,
+36266,
+36824,
+36255,
+35676,
+36119,
+36505,
+36051,
+35609,
+35566,
+35399,
+34828,
+34260,
+34120,
+33601,
+32670,
+32260,
+31978,
+31650,
+31556,
+31299,
+30801,
+30336,
+29873,
+29325,
+29064,
+29131,
+29025,
+29033,
+29598,
+30390,
+31061,
+31651,
+32354,
+32858,
+32852,
+32970,
+33593,
+34105,
+34205,
+34416,
+34836,
+35037,
+35090,
+35233,
+35281,
+34986,
+34662,
+34548,
+34409,
+34435,
+34490,
+34157,
+33775,
+33523,
+33201,
+32724,
+32476,
+32468,
+32066,
+31861,
+32106,
+32033,
+32018,
+32193,
+32115,
+31978,
+31954,
+31930,
+31968,
+32172,
+32310,
+32453,
+32597,
+32707,
+33001,
+32959,
+32795,
+32886,
+32634,
+32409,
+32535,
+32622,
+32633,
+32647,
 32808,
-32802,
-32827,
-32819,
-32838,
-32843,
+32968,
+32962,
+33055,
+33173,
+32953,
+32730,
+32840,
+32826,
 32847,
-32846,
-32864,
-32841,
-32873,
-32836,
-32877,
-32845,
+33152,
+33186,
+33192,
+33453,
+33472,
+33398,
+33540,
+33608,
+33515,
+33592,
+33740,
+33720,
+33686,
+33579,
+33410,
+33127,
+32743,
+32614,
+32432,
+32182,
+32246,
+32171,
+32005,
+32066,
+31988,
+31735,
+31583,
+31475,
+31256,
+31113,
+31188,
+31285,
+31316,
+31402,
+31539,
+31529,
+31542,
+31785,
+31851,
+31836,
+32097,
+32259,
+32252,
+32379,
+32521,
+32475,
+32375,
+32398,
+32475,
+32543,
+32682,
+32865,
+33023,
+33196,
+33290,
+33275,
+33308,
+33295,
+33226,
+33239,
+33221,
+33216,
+33316,
+33371,
+33368,
+33347,
+33289,
+33178,
+33008,
+32876,
+32772,
+32655,
+32602,
+32611,
+32600,
+32493,
+32398,
+32314,
+32119,
+31984,
+31966,
+32006,
+32148,
+32312,
+32433,
+32589,
+32741,
+32789,
+32867,
+32975,
+33033,
+33108,
+33216,
+33420,
+33657,
+33825,
+33923,
+33886,
+33766,
+33619,
+33471,
+33383,
+33285,
+33181,
+33100,
+33015,
+32951,
 32888,
-32866,
-32895,
-32883,
-32907,
-32882,
-32912,
-32877,
+32791,
+32636,
+32388,
+32150,
+32041,
+31981,
+31926,
+31870,
+31729,
+31577,
+31473,
+31360,
+31315,
+31351,
+31381,
+31465,
+31660,
+31946,
+32302,
+32591,
+32786,
+32989,
+33176,
+33400,
+33742,
+34039,
+34232,
+34396,
+34450,
+34478,
+34584,
+34601,
+34538,
+34449,
+34250,
+34140,
+34165,
+34134,
+34112,
+33996,
+33689,
+33435,
+33225,
+33012,
 32893,
-32889,
-32860,
-32882,
-32842,
-32872,
-32834,
-32852,
-32833,
-32835,
-32847,
-32830,
-32857,
-32824,
-32860,
-32830,
-32859,
-32843,
-32850,
-32844,
-32857,
-32837,
-32868,
-32861,
-32885,
-32897,
-32920,
-32938,
-32964,
-32990,
-33007,
-33035,
-33040,
-33058,
-33056,
-33070,
-33068,
-33074,
-33069,
-33093,
-33058,
-33100,
-33069,
-33109,
-33103,
-33116,
-33122,
-33136,
-33143,
-33155,
-33160,
-33179,
-33199,
-33205,
-33241,
-33242,
-33281,
-33290,
-33329,
-33346,
+32696,
+32466,
+32349,
+32254,
+32281,
+32358,
+32310,
+32284,
+32250,
+32206,
+32322,
+32383,
+32334,
+32344,
+32290,
+32294,
+32511,
+32743,
+32986,
+33227,
 33374,
-33397,
-33426,
-33438,
+33565,
+33774,
+33961,
+34172,
+34232,
+34226,
+34317,
+34364,
+34434,
+34566,
+34508,
+34328,
+34180,
+33986,
+33822,
+33720,
+33560,
+33338,
+33078,
+32839,
+32654,
+32440,
+32201,
+31951,
+31626,
+31333,
+31180,
+31051,
+30899,
+30798,
+30694,
+30574,
+30578,
+30690,
+30762,
+30808,
+30899,
+30987,
+31098,
+31297,
+31512,
+31669,
+31765,
+31870,
+31964,
+31978,
+32000,
+32007,
+31889,
+31782,
+31746,
+31629,
+31444,
+31271,
+31049,
+30768,
+30531,
+30338,
+30130,
+30008,
+30080,
+30280,
+30515,
+30708,
+30778,
+30732,
+30701,
+30848,
+31160,
+31464,
+31754,
+32053,
+32371,
+32950,
+33843,
+34814,
+35741,
+36495,
+36984,
+37348,
+37641,
+37856,
+38040,
+38108,
+38080,
+38112,
+38144,
+38149,
+38184,
+38095,
+37844,
+37514,
+37038,
+36411,
+35711,
+34929,
+34150,
+33458,
+32856,
+32438,
+32165,
+31916,
+31750,
+31577,
+31309,
+31096,
+30910,
+30704,
+30557,
+30371,
+30148,
+30004,
+29919,
+29958,
+30126,
+30276,
+30439,
+30616,
+30727,
+30868,
+31019,
+31069,
+31099,
+31130,
+31159,
+31243,
+31338,
+31423,
+31520,
+31618,
+31787,
+32021,
+32221,
+32409,
+32579,
+32705,
+32884,
+33132,
+33378,
+33617,
+33822,
+33996,
+34170,
+34359,
+34553,
+34716,
+34814,
+34826,
+34779,
+34678,
+34515,
+34321,
+34100,
+33835,
+33579,
+33361,
+33138,
+32901,
+32646,
+32339,
+31988,
+31630,
+31314,
+31023,
+30747,
+30548,
+30411,
+30307,
+30312,
+30405,
+30485,
+30598,
+30790,
+31015,
+31291,
+31654,
+32018,
+32313,
+32608,
+32925,
+33206,
+33482,
+33766,
+33980,
+34133,
+34323,
+34544,
+34726,
+34878,
+34984,
+34958,
+34839,
+34758,
+34644,
+34443,
+34244,
+34009,
+33705,
 33469,
-33479,
-33489,
-33498,
-33511,
-33507,
-33530,
-33513,
-33528,
-33509,
-33512,
-33518,
-33504,
-33522,
-33502,
-33528,
-33505,
+33341,
+33222,
+33109,
+33033,
+32939,
+32823,
+32763,
+32735,
+32644,
+32524,
+32429,
+32334,
+32277,
+32322,
+32404,
+32442,
+32494,
+32594,
+32683,
+32791,
+32953,
+33084,
+33179,
+33336,
+33524,
+33677,
+33816,
+33882,
+33829,
+33731,
+33641,
+33580,
+33550,
 33517,
-33502,
-33497,
-33502,
 33482,
-33502,
-33467,
-33484,
-33456,
-33468,
-33455,
-33450,
-33452,
-33460,
-33444,
-33471,
-33450,
-33464,
-33460,
-33456,
-33467,
-33461,
-33471,
-33456,
-33465,
-33433,
-33447,
-33413,
-33426,
-33398,
-33408,
-33381,
-33369,
-33359,
-33340,
-33327,
-33321,
-33297,
+33434,
+33353,
 33298,
-33265,
-33259,
-33231,
-33228,
-33191,
-33195,
-33169,
-33169,
-33141,
-33142,
-33124,
-33111,
-33099,
-33076,
-33081,
-33050,
-33056,
-33009,
-33002,
-32973,
-32944,
-32930,
-32903,
-32882,
-32878,
-32841,
-32834,
-32812,
-32791,
-32805,
-32767,
-32786,
+33225,
+33062,
+32861,
+32609,
+32301,
+32054,
+31842,
+31631,
+31484,
+31320,
+31165,
+31095,
+31008,
+30950,
+30934,
+30846,
+30811,
+30859,
+30888,
+30992,
+31094,
+31119,
+31214,
+31338,
+31513,
+31812,
+32069,
+32317,
+32593,
+32775,
+32990,
+33224,
+33314,
+33377,
+33388,
+33291,
+33258,
+33224,
+33136,
+33080,
+32975,
+32864,
+32818,
+32749,
+32710,
+32710,
+32659,
+32672,
+32735,
+32743,
+32761,
 32760,
-32756,
-32753,
-32709,
-32719,
-32682,
-32675,
-32664,
-32639,
-32621,
-32627,
-32586,
-32606,
-32575,
-32590,
-32570,
-32587,
-32561,
-32568,
-32551,
-32530,
-32539,
-32512,
-32518,
-32493,
-32487,
-32470,
-32470,
+32692,
+32659,
+32674,
+32701,
+32751,
+32795,
+32829,
+32874,
+32914,
+32947,
+32930,
+32803,
+32626,
 32449,
-32456,
-32440,
-32439,
-32447,
-32427,
-32425,
-32415,
-32401,
-32400,
-32378,
-32394,
-32369,
-32392,
-32380,
-32391,
-32409,
-32419,
-32445,
-32467,
+32274,
+32171,
+32134,
+32072,
+32025,
+32048,
+32070,
+32106,
+32157,
+32118,
+32024,
+31969,
+31964,
+32033,
+32154,
+32260,
+32324,
+32366,
+32483,
+32691,
+32929,
+33231,
+33539,
+33769,
+34012,
+34257,
+34389,
+34453,
+34457,
+34376,
+34294,
+34265,
+34272,
+34261,
+34228,
+34206,
+34148,
+34060,
+34016,
+33913,
+33724,
+33587,
+33476,
+33373,
+33360,
+33369,
+33311,
+33252,
+33215,
+33189,
+33213,
+33292,
+33390,
+33493,
+33627,
+33805,
+33963,
+34084,
+34197,
+34240,
+34243,
+34294,
+34351,
+34393,
+34442,
+34438,
+34356,
+34232,
+34055,
+33802,
+33497,
+33196,
+32900,
+32633,
+32457,
+32314,
+32143,
+31970,
+31766,
+31533,
+31324,
+31157,
+31027,
+30900,
+30793,
+30726,
+30637,
+30557,
+30538,
+30492,
+30455,
+30479,
+30459,
+30392,
+30328,
+30248,
+30195,
+30186,
+30187,
+30171,
+30101,
+30035,
+30040,
+30033,
+30000,
+29952,
+29836,
+29832,
+30114,
+30584,
+31071,
+31384,
+31388,
+31173,
+30989,
+31025,
+31253,
+31475,
+31590,
+31615,
+31655,
+31947,
+32530,
+33187,
+33791,
+34243,
+34518,
+34733,
+34953,
+35164,
+35297,
+35380,
+35537,
+35773,
+36106,
+36514,
+36805,
+36916,
+36942,
+36886,
+36778,
+36637,
+36377,
+35990,
+35541,
+35142,
+34886,
+34710,
+34573,
+34426,
+34154,
+33829,
+33508,
+33126,
+32731,
+32330,
+31885,
+31478,
+31128,
+30803,
+30528,
+30297,
+30135,
+30082,
+30106,
+30191,
+30287,
+30344,
+30418,
+30510,
+30617,
+30799,
+31007,
+31241,
+31556,
+31893,
+32246,
+32610,
+32917,
+33187,
+33436,
+33648,
+33824,
+33950,
+34035,
+34114,
+34191,
+34288,
+34411,
+34498,
+34566,
+34617,
+34605,
+34577,
+34519,
+34420,
+34345,
+34283,
+34228,
+34187,
+34122,
+34060,
+34030,
+34014,
+34017,
+33978,
+33849,
+33692,
+33513,
+33356,
+33290,
+33216,
+33100,
+32980,
+32784,
+32565,
+32406,
+32209,
+32011,
+31860,
+31713,
+31664,
+31714,
+31778,
+31877,
+31940,
+31957,
+32032,
+32122,
+32253,
+32465,
+32638,
+32801,
+33020,
+33199,
+33402,
+33645,
+33792,
+33922,
+34066,
+34186,
+34375,
+34561,
+34645,
+34656,
+34545,
+34347,
+34160,
+33915,
+33596,
+33236,
+32783,
+32335,
+31977,
+31641,
+31338,
+31034,
+30666,
+30321,
+30032,
+29763,
+29549,
+29362,
+29190,
+29124,
+29161,
+29265,
+29436,
+29606,
+29756,
+29958,
+30223,
+30543,
+30897,
+31199,
+31439,
+31644,
+31818,
+31992,
+32130,
+32174,
+32163,
+32134,
+32122,
+32198,
+32299,
+32317,
+32249,
+32078,
+31875,
+31768,
+31764,
+31820,
+31884,
+31895,
+31898,
+31942,
+32013,
+32119,
+32182,
+32165,
+32161,
+32226,
+32374,
+32623,
+32890,
+33107,
+33338,
+33612,
+33936,
+34301,
+34625,
+34875,
+35068,
+35250,
+35502,
+35799,
+36069,
+36313,
+36477,
+36555,
+36630,
+36662,
+36623,
+36530,
+36366,
+36176,
+36016,
+35884,
+35740,
+35539,
+35282,
+35007,
+34738,
+34502,
+34270,
+33981,
+33639,
+33285,
+32972,
+32719,
 32497,
-32519,
-32546,
-32554,
-32574,
-32575,
-32573,
-32587,
-32558,
-32571,
-32528,
-32542,
-32498,
-32505,
-32469,
-32485,
-32452,
-32460,
-32452,
-32420,
-32444,
-32396,
-32431,
-32405,
-32407,
-32417,
-32403,
-32433,
-32423,
-32448,
+32266,
+31995,
+31718,
+31518,
+31404,
+31389,
+31451,
+31499,
+31545,
+31610,
+31706,
+31874,
+32087,
+32285,
 32465,
-32490,
-32511,
-32538,
-32545,
-32580,
-32576,
-32593,
+32635,
+32842,
+33126,
+33436,
+33726,
+33948,
+34080,
+34205,
+34347,
+34482,
+34599,
+34636,
+34590,
+34546,
+34516,
+34509,
+34494,
+34412,
+34283,
+34132,
+33989,
+33877,
+33757,
+33604,
+33423,
+33213,
+33006,
+32810,
 32595,
-32590,
-32599,
-32573,
-32580,
-32539,
-32543,
-32509,
-32503,
-32482,
-32472,
-32474,
-32450,
-32454,
-32426,
-32445,
-32407,
-32426,
-32401,
-32387,
-32398,
-32360,
-32369,
-32354,
-32362,
-32350,
-32377,
-32347,
-32377,
-32355,
-32376,
-32360,
-32363,
-32362,
-32345,
-32343,
-32337,
-32313,
-32341,
-32298,
-32324,
-32310,
-32311,
-32335,
-32312,
-32347,
+32374,
+32156,
+31944,
+31783,
+31656,
+31522,
+31360,
+31140,
+30894,
+30667,
+30468,
+30302,
+30144,
+29964,
+29784,
+29623,
+29491,
+29385,
+29283,
+29180,
+29115,
+29135,
+29251,
+29410,
+29547,
+29612,
+29620,
+29642,
+29720,
+29841,
+29954,
+30018,
+30035,
+30060,
+30150,
+30310,
+30491,
+30612,
+30635,
+30606,
+30659,
+30915,
+31388,
+31958,
+32434,
+32690,
+32754,
+32756,
+32802,
+32906,
+32995,
+33003,
+32949,
+32947,
+33072,
+33298,
+33559,
+33787,
+33971,
+34142,
+34320,
+34462,
+34525,
+34521,
+34502,
+34547,
+34701,
+34952,
+35224,
+35456,
+35628,
+35731,
+35796,
+35833,
+35828,
+35771,
+35666,
+35535,
+35398,
+35275,
+35149,
+35004,
+34856,
+34731,
+34642,
+34563,
+34447,
+34256,
+34002,
+33734,
+33483,
+33241,
+32990,
+32723,
+32463,
+32248,
+32096,
+31990,
+31887,
+31767,
+31642,
+31522,
+31437,
+31393,
+31374,
+31384,
+31435,
+31547,
+31719,
+31922,
+32112,
+32247,
 32333,
-32366,
-32360,
-32377,
-32388,
-32392,
-32407,
-32406,
-32413,
-32422,
-32435,
-32433,
-32447,
-32453,
-32446,
-32466,
-32439,
-32469,
-32443,
-32457,
-32442,
-32438,
-32426,
-32418,
-32397,
-32416,
-32384,
-32407,
-32380,
-32403,
-32398,
-32395,
-32405,
-32401,
-32415,
-32413,
-32415,
-32422,
-32413,
-32411,
-32413,
-32407,
-32409,
-32415,
-32393,
-32411,
-32380,
-32385,
-32378,
-32362,
-32375,
-32346,
-32360,
-32346,
-32346,
-32347,
-32339,
-32342,
-32341,
-32350,
-32342,
-32358,
-32329,
-32355,
-32328,
-32336,
-32340,
-32306,
-32342,
-32302,
-32326,
-32297,
-32310,
-32278,
-32293,
-32259,
-32275,
-32258,
-32245,
-32241,
-32227,
-32219,
-32222,
-32209,
-32213,
-32214,
-32205,
-32215,
-32213,
-32209,
-32222,
-32221,
-32215,
-32228,
-32211,
-32221,
-32220,
-32201,
-32226,
-32200,
-32229,
-32220,
-32243,
-32262,
-32264,
-32309,
-32293,
-32354,
-32347,
-32396,
-32412,
-32431,
-32473,
-32472,
-32512,
-32511,
-32558,
-32558,
-32612,
-32600,
-32647,
-32643,
-32661,
-32685,
-32671,
-32717,
-32697,
-32739,
-32731,
-32749,
-32772,
-32774,
-32815,
+32419,
+32531,
+32672,
 32822,
-32872,
-32897,
-32941,
-32978,
-32998,
-33053,
-33074,
-33111,
+32951,
+33070,
+33215,
+33420,
+33690,
+33975,
+34224,
+34402,
+34511,
+34591,
+34659,
+34723,
+34774,
+34793,
+34783,
+34754,
+34725,
+34705,
+34688,
+34674,
+34652,
+34606,
+34538,
+34453,
+34350,
+34235,
+34125,
+34020,
+33932,
+33873,
+33840,
+33814,
+33781,
+33734,
+33672,
+33612,
+33557,
+33496,
+33409,
+33291,
+33144,
+32966,
+32774,
+32586,
+32410,
+32254,
+32090,
+31873,
+31591,
+31258,
+30911,
+30581,
+30259,
+29930,
+29593,
+29281,
+29030,
+28848,
+28694,
+28522,
+28318,
+28107,
+27938,
+27851,
+27849,
+27903,
+27971,
+28045,
+28125,
+28196,
+28278,
+28385,
+28517,
+28680,
+28874,
+29091,
+29327,
+29599,
+29894,
+30153,
+30344,
+30478,
+30610,
+30836,
+31217,
+31680,
+32096,
+32400,
+32604,
+32780,
+33012,
+33303,
+33578,
+33777,
+33937,
+34118,
+34370,
+34693,
+35019,
+35286,
+35485,
+35654,
+35810,
+35947,
+36060,
+36141,
+36214,
+36322,
+36475,
+36620,
+36726,
+36785,
+36797,
+36775,
+36725,
+36620,
+36457,
+36280,
+36122,
+36002,
+35901,
+35764,
+35563,
+35330,
+35118,
+34951,
+34818,
+34659,
+34417,
+34114,
+33818,
+33576,
+33379,
+33177,
+32920,
+32606,
+32307,
+32112,
+32033,
+32021,
+32025,
+32009,
+31989,
+32005,
+32050,
+32080,
+32065,
+32045,
+32088,
+32243,
+32501,
+32783,
+32999,
+33123,
+33200,
+33276,
+33386,
+33512,
+33612,
+33672,
+33722,
+33808,
+33938,
+34075,
+34158,
+34153,
+34091,
+34019,
+33981,
+33973,
+33950,
+33898,
+33841,
+33809,
+33807,
+33801,
+33718,
+33555,
+33356,
+33179,
+33069,
+32995,
+32917,
+32804,
+32666,
+32540,
+32439,
+32343,
+32217,
+32077,
+31942,
+31847,
+31804,
+31752,
+31655,
+31506,
+31336,
+31189,
+31067,
+30939,
+30781,
+30597,
+30427,
+30317,
+30253,
+30184,
+30094,
+29995,
+29914,
+29881,
+29877,
+29856,
+29805,
+29755,
+29736,
+29757,
+29816,
+29877,
+29899,
+29897,
+29881,
+29836,
+29781,
+29753,
+29764,
+29809,
+29896,
+29990,
+30061,
+30129,
+30213,
+30301,
+30390,
+30513,
+30686,
+30915,
+31211,
+31504,
+31717,
+31865,
+32004,
+32180,
+32423,
+32724,
+33018,
+33280,
+33544,
+33840,
+34153,
+34450,
+34709,
+34916,
+35103,
+35315,
+35552,
+35759,
+35911,
+36023,
+36101,
+36184,
+36294,
+36388,
+36430,
+36414,
+36350,
+36255,
+36145,
+36016,
+35853,
+35649,
+35428,
+35227,
+35057,
+34914,
+34783,
+34637,
+34484,
+34356,
+34250,
+34129,
+33980,
+33804,
+33616,
+33461,
+33367,
+33312,
+33253,
+33190,
 33149,
-33169,
-33205,
-33227,
-33235,
-33264,
-33268,
-33282,
-33301,
-33307,
-33310,
-33315,
-33304,
+33133,
+33162,
+33233,
 33305,
-33296,
+33357,
+33399,
+33451,
+33497,
+33524,
+33530,
+33521,
+33530,
+33581,
+33659,
+33738,
+33796,
+33821,
+33820,
+33824,
+33851,
+33882,
+33885,
+33874,
+33875,
+33886,
+33908,
+33929,
+33929,
+33887,
+33817,
+33746,
+33680,
+33614,
+33525,
+33425,
+33348,
 33290,
-33289,
-33283,
-33284,
-33270,
-33274,
-33272,
-33272,
-33296,
-33294,
-33313,
-33342,
-33347,
-33375,
-33388,
-33415,
-33430,
-33465,
-33467,
-33500,
-33507,
-33519,
-33536,
-33517,
-33558,
-33526,
-33558,
+33231,
+33149,
+33045,
+32921,
+32753,
+32567,
+32406,
+32252,
+32080,
+31891,
+31694,
+31487,
+31268,
+31047,
+30835,
+30627,
+30435,
+30295,
+30199,
+30127,
+30044,
+29922,
+29791,
+29689,
+29633,
+29614,
+29608,
+29581,
+29548,
+29538,
+29568,
+29617,
+29646,
+29652,
+29644,
+29661,
+29744,
+29893,
+30042,
+30143,
+30219,
+30312,
+30434,
+30542,
+30607,
+30627,
+30613,
+30620,
+30685,
+30808,
+30947,
+31037,
+31080,
+31142,
+31265,
+31418,
+31550,
+31642,
+31721,
+31826,
+31984,
+32205,
+32464,
+32703,
+32904,
+33104,
+33340,
+33602,
+33849,
+34080,
+34318,
+34567,
+34832,
+35119,
+35390,
+35581,
+35702,
+35810,
+35927,
+36056,
+36169,
+36236,
+36272,
+36310,
+36326,
+36297,
+36236,
+36133,
+35969,
+35787,
+35628,
+35451,
+35243,
+35065,
+34934,
+34812,
+34699,
+34587,
+34458,
+34352,
+34286,
+34225,
+34195,
+34223,
+34241,
+34205,
+34180,
+34197,
+34183,
+34138,
+34120,
+34117,
+34083,
+34060,
+34089,
+34110,
+34055,
+33919,
+33834,
+33913,
+33994,
+33882,
+33683,
 33538,
-33539,
-33524,
-33520,
-33496,
-33492,
+33381,
+33174,
+33021,
+32908,
+32682,
+32399,
+32262,
+32258,
+32168,
+31917,
+31694,
+31627,
+31585,
+31435,
+31306,
+31312,
+31266,
+31082,
+31000,
+31092,
+31103,
+30980,
+30915,
+30932,
+30899,
+30843,
+30882,
+30948,
+30925,
+30862,
+30863,
+30939,
+30984,
+30910,
+30817,
+30830,
+30911,
+30987,
+31099,
+31232,
+31240,
+31138,
+31106,
+31138,
+31083,
+30967,
+30914,
+30901,
+30895,
+30948,
+31036,
+31067,
+31042,
+31040,
+31084,
+31121,
+31127,
+31105,
+31094,
+31129,
+31188,
+31262,
+31396,
+31550,
+31617,
+31645,
+31725,
+31807,
+31842,
+31920,
+32101,
+32282,
+32424,
+32611,
+32852,
+33042,
+33164,
+33291,
+33440,
+33592,
+33763,
+33991,
+34245,
+34455,
+34587,
+34707,
+34861,
+34967,
+34985,
+34991,
+35053,
+35119,
+35154,
+35213,
+35279,
+35275,
+35206,
+35155,
+35117,
+35031,
+34901,
+34787,
+34701,
+34604,
+34488,
+34381,
+34286,
+34184,
+34072,
+33980,
+33896,
+33803,
+33712,
+33641,
+33591,
+33533,
 33471,
-33469,
-33446,
-33451,
-33424,
-33431,
-33410,
-33420,
-33417,
-33414,
-33429,
-33420,
-33423,
-33433,
-33407,
-33427,
-33402,
 33412,
-33400,
-33389,
-33373,
+33335,
+33258,
+33217,
+33206,
+33194,
+33177,
+33201,
+33258,
+33297,
+33312,
+33322,
+33320,
+33315,
 33363,
-33340,
-33330,
-33306,
-33298,
-33276,
-33268,
-33242,
-33232,
-33205,
-33192,
-33187,
-33176,
-33166,
-33165,
-33153,
-33158,
-33140,
-33152,
-33137,
-33141,
+33442,
+33472,
+33449,
+33420,
+33394,
+33342,
+33257,
 33147,
-33115,
-33140,
-33106,
-33112,
-33095,
-33087,
-33076,
-33078,
+33008,
+32863,
+32741,
+32658,
+32579,
+32454,
+32314,
+32236,
+32206,
+32131,
+31996,
+31842,
+31673,
+31496,
+31365,
+31312,
+31268,
+31195,
+31146,
+31151,
+31163,
+31168,
+31197,
+31243,
+31289,
+31360,
+31491,
+31634,
+31717,
+31735,
+31742,
+31767,
+31828,
+31958,
+32142,
+32311,
+32415,
+32485,
+32570,
+32623,
+32592,
+32539,
+32528,
+32551,
+32591,
+32672,
+32770,
+32799,
+32750,
+32703,
+32686,
+32626,
+32513,
+32422,
+32381,
+32374,
+32399,
+32473,
+32577,
+32647,
+32670,
+32674,
+32659,
+32592,
+32487,
+32415,
+32430,
+32518,
+32647,
+32798,
+32922,
+32955,
+32914,
+32869,
+32842,
+32803,
+32772,
+32829,
+32972,
+33130,
+33255,
+33310,
+33271,
+33161,
 33056,
-33075,
-33038,
-33064,
-33043,
-33055,
-33051,
-33064,
-33053,
-33065,
-33051,
-33053,
-33047,
-33039,
-33047,
-33023,
-33035,
-33007,
-33015,
-32988,
+33033,
+33082,
+33152,
+33239,
+33340,
+33436,
+33477,
+33415,
+33279,
+33120,
 32988,
+32935,
 32971,
-32967,
-32946,
-32948,
-32921,
-32922,
-32920,
-32897,
+33043,
+33087,
+33086,
+33065,
+33020,
 32933,
+32797,
+32654,
+32543,
+32489,
+32506,
+32565,
+32624,
+32657,
+32657,
+32638,
+32612,
+32578,
+32552,
+32559,
+32623,
+32755,
+32930,
+33107,
+33247,
+33326,
+33355,
+33352,
+33337,
+33331,
+33347,
+33398,
+33495,
+33607,
+33697,
+33757,
+33777,
+33769,
+33748,
+33721,
+33703,
+33697,
+33697,
+33699,
+33691,
+33653,
+33578,
+33473,
+33353,
+33225,
+33104,
+32996,
 32895,
-32937,
-32928,
-32961,
-32978,
+32794,
+32686,
+32576,
+32461,
+32344,
+32239,
+32158,
+32100,
+32064,
+32037,
+32010,
+31978,
+31947,
+31930,
+31937,
+31973,
+32037,
+32120,
+32203,
+32261,
+32271,
+32228,
+32162,
+32109,
+32093,
+32133,
+32214,
+32311,
+32394,
+32420,
+32382,
+32297,
+32183,
+32066,
+31965,
+31896,
+31874,
+31882,
+31912,
+31952,
+31974,
+31972,
+31946,
+31933,
+31950,
+31979,
+31989,
+32000,
+32041,
+32117,
+32245,
+32414,
+32592,
+32733,
+32816,
+32872,
+32930,
+32989,
+33048,
+33120,
+33215,
+33341,
+33483,
+33605,
+33649,
+33575,
+33420,
+33270,
+33191,
+33181,
+33191,
+33202,
+33214,
+33203,
+33136,
 32999,
-33023,
-33047,
-33071,
-33087,
-33108,
-33118,
-33112,
-33131,
-33102,
-33117,
-33090,
-33088,
-33067,
-33054,
-33044,
-33028,
-33017,
-32993,
-32997,
-32977,
-32981,
-32980,
-32970,
-32976,
-32975,
-32982,
-32991,
-33015,
-33028,
+32793,
+32556,
+32358,
+32247,
+32229,
+32264,
+32316,
+32366,
+32390,
+32387,
+32367,
+32351,
+32354,
+32369,
+32397,
+32445,
+32510,
+32583,
+32651,
+32705,
+32758,
+32827,
+32907,
+32987,
 33054,
-33076,
-33086,
-33124,
-33143,
-33164,
-33171,
-33190,
-33185,
-33198,
-33181,
+33096,
+33129,
+33165,
+33206,
+33260,
+33313,
+33366,
+33421,
+33465,
+33488,
+33482,
+33464,
+33461,
+33476,
+33499,
+33514,
+33531,
+33533,
+33510,
+33475,
+33447,
+33426,
+33408,
+33405,
+33424,
+33443,
+33424,
+33365,
+33269,
 33162,
-33160,
-33118,
-33113,
-33070,
-33060,
-33030,
-33009,
-32980,
-32962,
-32952,
-32922,
+33058,
+32975,
 32928,
-32886,
-32899,
-32862,
-32876,
-32857,
-32850,
-32850,
-32840,
-32854,
-32846,
-32861,
-32852,
+32897,
+32871,
+32844,
+32800,
+32739,
+32654,
+32555,
+32476,
+32422,
+32392,
+32398,
+32430,
+32465,
+32488,
+32483,
+32472,
+32470,
+32471,
+32482,
+32493,
+32497,
+32501,
+32509,
+32530,
+32545,
+32547,
+32552,
+32581,
+32610,
+32606,
+32575,
+32535,
+32507,
+32494,
+32483,
+32484,
+32491,
+32481,
+32461,
+32429,
+32372,
+32280,
+32175,
+32109,
+32108,
+32142,
+32175,
+32206,
+32241,
+32274,
+32302,
+32325,
+32359,
+32413,
+32486,
+32578,
+32675,
+32762,
+32811,
+32838,
 32869,
-32857,
-32867,
-32848,
-32861,
-32837,
+32910,
+32962,
+33020,
+33103,
+33199,
+33264,
+33288,
+33286,
+33290,
+33319,
+33357,
+33389,
+33421,
+33436,
+33420,
+33368,
+33272,
+33147,
+33029,
+32958,
+32962,
+33030,
+33111,
+33170,
+33184,
+33159,
+33095,
+32984,
+32858,
+32758,
+32701,
+32704,
+32760,
 32829,
+32883,
+32896,
+32866,
+32811,
+32753,
+32706,
+32684,
+32701,
+32752,
 32818,
-32781,
-32764,
-32757,
-32709,
-32723,
-32682,
-32679,
-32662,
-32658,
-32647,
-32646,
-32650,
-32640,
-32648,
-32644,
-32653,
-32660,
-32665,
-32664,
-32685,
-32667,
-32707,
-32681,
-32705,
+32872,
+32891,
+32865,
+32804,
+32746,
+32713,
+32698,
 32703,
-32694,
-32704,
-32687,
-32676,
-32672,
-32644,
-32634,
-32605,
-32589,
-32564,
-32552,
-32520,
-32515,
-32494,
-32494,
-32479,
-32484,
-32468,
-32492,
-32464,
-32488,
-32484,
-32493,
-32495,
-32493,
-32508,
-32495,
-32523,
-32488,
-32520,
-32494,
-32500,
-32498,
-32477,
-32487,
-32463,
-32451,
-32441,
-32420,
-32411,
-32402,
-32382,
-32372,
-32365,
-32351,
+32733,
+32775,
+32798,
+32786,
+32730,
+32649,
+32554,
+32466,
+32419,
+32401,
+32384,
+32363,
 32347,
-32330,
-32328,
-32329,
-32315,
-32323,
-32304,
-32324,
-32289,
-32317,
-32287,
-32304,
-32292,
-32292,
-32279,
-32292,
-32264,
-32275,
-32256,
-32252,
-32259,
-32237,
-32237,
-32230,
-32210,
-32221,
-32190,
-32201,
+32346,
+32340,
+32299,
+32249,
+32214,
+32193,
 32182,
-32178,
-32172,
-32155,
-32153,
-32137,
-32131,
-32127,
-32108,
-32119,
-32095,
-32117,
-32093,
-32110,
-32093,
-32124,
-32117,
-32133,
-32150,
-32150,
-32180,
-32171,
-32204,
-32196,
-32231,
-32225,
-32257,
-32254,
-32283,
-32271,
-32301,
-32283,
-32315,
-32302,
+32179,
+32190,
+32214,
+32245,
+32279,
 32317,
-32318,
-32314,
-32325,
-32323,
-32326,
-32339,
 32338,
-32365,
-32371,
+32334,
+32330,
+32349,
 32394,
-32405,
-32431,
-32448,
-32477,
-32486,
-32524,
-32523,
-32577,
-32561,
-32599,
-32594,
-32613,
-32621,
-32619,
-32630,
-32624,
-32623,
-32614,
-32619,
-32589,
-32608,
-32556,
-32593,
-32535,
-32562,
-32527,
-32527,
-32527,
-32516,
-32521,
-32532,
-32515,
+32458,
 32550,
-32537,
-32564,
-32568,
-32585,
-32587,
-32621,
-32608,
-32649,
-32632,
-32660,
-32649,
-32668,
-32661,
-32667,
-32662,
-32663,
-32658,
-32650,
-32643,
-32630,
-32622,
-32620,
+32675,
+32822,
+32943,
+33009,
+33030,
+33024,
+33023,
+33024,
+33039,
+33064,
+33080,
+33092,
+33092,
+33060,
+32980,
+32875,
+32795,
+32784,
+32826,
+32890,
+32963,
+33021,
+33053,
+33043,
+32991,
+32919,
+32854,
+32818,
+32831,
+32907,
+33000,
+33082,
+33138,
+33151,
+33122,
+33060,
+33002,
+32987,
+33025,
+33095,
+33175,
+33249,
+33287,
+33264,
+33180,
+33066,
+32975,
+32930,
+32935,
+32985,
+33054,
+33096,
+33075,
+32996,
+32869,
+32713,
+32576,
+32504,
+32510,
+32552,
 32591,
-32603,
-32578,
-32573,
-32561,
-32557,
+32618,
+32623,
+32591,
+32510,
+32400,
+32330,
+32319,
+32348,
+32394,
+32445,
+32483,
+32476,
+32439,
+32378,
+32309,
+32257,
+32242,
+32282,
+32354,
+32422,
+32475,
+32518,
 32545,
-32556,
-32544,
-32556,
-32548,
+32539,
+32510,
+32476,
+32466,
+32479,
+32489,
+32505,
+32516,
+32507,
+32486,
+32459,
+32447,
+32448,
+32461,
+32494,
 32552,
-32565,
-32553,
-32573,
-32569,
-32570,
-32583,
-32562,
-32586,
-32563,
-32585,
-32571,
-32569,
-32584,
-32573,
-32583,
-32582,
-32582,
-32590,
-32592,
-32603,
-32599,
-32626,
-32618,
-32642,
-32660,
-32652,
-32690,
-32674,
-32707,
-32703,
-32724,
-32735,
-32732,
-32754,
+32609,
+32638,
+32645,
+32634,
+32625,
+32614,
+32606,
+32622,
+32655,
+32689,
+32721,
 32747,
 32769,
-32782,
-32770,
-32800,
-32797,
-32800,
-32834,
-32812,
-32836,
-32838,
-32844,
-32845,
-32858,
-32858,
-32867,
-32863,
-32874,
-32877,
-32884,
-32889,
-32877,
-32888,
-32878,
-32887,
-32879,
-32891,
-32878,
+32772,
+32767,
+32788,
+32818,
+32842,
+32854,
+32856,
+32871,
+32892,
 32895,
-32867,
-32903,
-32882,
-32909,
-32899,
-32924,
-32926,
-32950,
-32961,
-32981,
-32982,
-32998,
-33014,
-33007,
-33043,
-33032,
-33049,
-33051,
-33039,
-33039,
-33055,
-33042,
-33045,
-33042,
-33028,
-33054,
-33027,
-33060,
-33034,
-33056,
-33055,
-33062,
+32881,
+32860,
+32842,
+32839,
+32842,
+32847,
+32847,
+32857,
+32898,
+32964,
+33030,
+33061,
 33073,
 33078,
-33087,
-33104,
-33098,
-33129,
-33117,
-33153,
-33138,
-33156,
-33156,
-33153,
-33171,
-33162,
-33166,
-33165,
-33156,
-33157,
-33156,
-33152,
-33154,
+33096,
+33125,
+33153,
+33194,
+33252,
+33322,
+33399,
+33463,
+33500,
+33519,
+33516,
+33511,
+33516,
+33505,
+33491,
+33474,
+33455,
+33454,
+33459,
+33461,
+33466,
+33445,
+33416,
+33385,
+33342,
+33303,
+33255,
+33202,
+33162,
+33124,
+33085,
+33042,
+32972,
+32905,
+32849,
+32799,
+32776,
+32742,
+32690,
+32643,
+32601,
+32582,
+32570,
+32540,
+32509,
+32474,
+32449,
+32438,
+32414,
+32387,
+32382,
+32404,
+32469,
+32542,
+32576,
+32570,
+32527,
+32482,
+32455,
+32426,
+32410,
+32414,
+32446,
+32512,
+32570,
+32595,
+32582,
+32533,
+32486,
+32456,
+32430,
+32405,
+32372,
+32357,
+32363,
+32366,
+32357,
+32333,
+32316,
+32316,
+32335,
+32366,
+32395,
+32415,
+32438,
+32453,
+32455,
+32445,
+32416,
+32397,
+32395,
+32402,
+32415,
+32415,
+32410,
+32404,
+32382,
+32363,
+32349,
+32342,
+32346,
+32345,
+32333,
+32323,
+32307,
+32281,
+32257,
+32229,
+32213,
+32211,
+32215,
+32221,
+32217,
+32212,
+32228,
+32274,
+32336,
+32414,
+32482,
+32546,
+32617,
+32663,
+32700,
+32738,
+32782,
+32865,
+32974,
+33078,
+33175,
+33242,
+33285,
+33312,
+33302,
+33288,
+33275,
+33277,
+33317,
+33371,
+33434,
+33495,
+33527,
+33543,
+33537,
+33501,
+33464,
+33432,
+33415,
+33423,
+33423,
+33412,
+33390,
+33343,
+33295,
+33245,
+33195,
+33168,
 33152,
-33143,
-33159,
-33144,
-33167,
-33151,
-33167,
-33164,
-33166,
-33169,
-33179,
-33165,
-33170,
-33178,
-33148,
-33171,
-33155,
-33135,
-33161,
+33142,
+33132,
 33106,
-33131,
-33107,
-33104,
-33099,
-33084,
-33081,
-33077,
-33069,
-33074,
+33079,
 33060,
-33070,
-33053,
-33072,
-33063,
-33075,
-33067,
-33080,
-33069,
-33086,
-33080,
-33095,
-33087,
-33090,
-33094,
-33091,
-33105,
-33093,
-33104,
-33103,
-33108,
-33102,
-33109,
-33105,
-33113,
-33102,
-33112,
-33103,
-33107,
-33108,
-33098,
-33100,
-33099,
-33091,
-33092,
-33089,
-33074,
-33092,
-33063,
-33084,
-33061,
-33073,
-33061,
-33070,
-33053,
-33073,
-33045,
-33069,
-33045,
-33054,
-33052,
-33047,
+33050,
 33058,
-33041,
-33045,
-33042,
-33031,
-33035,
-33037,
-33020,
-33027,
-33018,
-33000,
-33024,
-32985,
-33021,
-32985,
-33022,
-32983,
-33015,
-33003,
-33010,
-33023,
-33009,
-33033,
+33055,
+33043,
 33025,
-33045,
-33041,
-33050,
-33045,
-33063,
-33048,
-33062,
-33044,
-33052,
-33041,
-33036,
-33027,
-33019,
-33008,
-32990,
-32983,
-32971,
+32995,
 32963,
-32952,
-32942,
-32935,
-32926,
-32920,
+32929,
 32911,
-32906,
-32904,
-32897,
-32893,
-32897,
-32881,
-32888,
-32874,
-32880,
-32865,
-32869,
-32868,
-32847,
-32857,
-32825,
-32840,
-32817,
-32822,
-32802,
-32796,
-32796,
-32774,
-32787,
-32770,
-32772,
-32772,
-32766,
-32775,
-32770,
-32779,
-32775,
-32786,
-32779,
-32786,
-32800,
-32789,
-32809,
-32796,
-32812,
-32803,
-32821,
-32805,
-32812,
-32825,
-32801,
-32828,
-32805,
-32824,
-32818,
-32819,
-32831,
-32826,
-32827,
-32843,
-32826,
-32860,
-32836,
-32855,
-32862,
-32859,
-32880,
-32872,
-32887,
-32886,
-32887,
-32891,
-32895,
-32898,
-32900,
-32901,
-32896,
-32899,
-32902,
-32887,
-32903,
-32875,
-32874,
+32924,
+32977,
+33048,
+33105,
+33120,
+33095,
+33057,
+33013,
+32984,
+32974,
+32983,
+33030,
+33097,
+33160,
+33192,
+33168,
+33104,
+33030,
+32965,
+32914,
 32876,
+32851,
+32848,
+32859,
 32861,
-32868,
-32835,
 32842,
-32811,
-32807,
 32789,
-32773,
-32752,
-32745,
-32700,
-32705,
-32672,
-32660,
-32641,
-32616,
-32597,
-32586,
-32579,
-32557,
-32540,
-32541,
-32502,
-32531,
-32481,
-32506,
-32467,
-32465,
-32451,
-32426,
-32429,
-32403,
-32384,
-32365,
-32342,
+32725,
+32676,
+32650,
+32644,
+32652,
+32670,
+32689,
+32701,
+32690,
+32649,
+32588,
+32527,
+32489,
+32477,
+32482,
+32494,
+32505,
+32505,
+32493,
+32466,
+32424,
+32385,
+32352,
+32329,
 32317,
-32300,
-32269,
-32244,
-32219,
-32187,
-32173,
-32150,
-32133,
-32113,
-32082,
-32073,
-32058,
-32061,
-32049,
-32049,
-32035,
-32047,
-32031,
-32056,
-32034,
-32054,
-32035,
-32044,
-32039,
-32046,
-32035,
-32025,
-32031,
-31999,
-32022,
-32002,
-31992,
-32003,
-31975,
-31987,
-31983,
-31995,
-32016,
-32003,
-32035,
-32015,
-32068,
-32050,
-32113,
-32094,
-32132,
-32148,
-32155,
-32208,
-32186,
-32250,
-32221,
-32267,
-32268,
-32296,
 32306,
-32330,
-32322,
-32356,
-32353,
+32297,
+32286,
+32267,
+32250,
+32227,
+32201,
+32178,
+32149,
+32122,
+32107,
+32102,
+32122,
+32158,
+32193,
+32235,
+32273,
+32297,
+32314,
+32321,
+32335,
 32374,
-32391,
-32400,
-32411,
-32417,
-32436,
-32432,
-32463,
-32449,
-32463,
-32463,
-32472,
-32475,
-32486,
-32469,
+32429,
 32493,
-32466,
-32486,
-32475,
-32484,
-32481,
-32483,
-32473,
-32486,
-32495,
-32514,
-32509,
-32537,
-32518,
-32570,
-32547,
+32558,
 32601,
-32581,
-32614,
-32611,
-32637,
-32640,
-32650,
-32649,
-32640,
-32653,
-32631,
-32642,
-32627,
-32638,
-32611,
+32623,
+32623,
+32601,
+32568,
+32536,
+32520,
+32529,
+32558,
+32596,
+32634,
+32657,
+32665,
+32657,
+32632,
+32603,
+32571,
+32551,
+32550,
+32558,
+32570,
+32575,
+32574,
+32576,
+32582,
+32593,
 32616,
-32617,
-32601,
-32623,
-32606,
-32617,
-32621,
-32623,
-32647,
-32653,
-32675,
-32691,
-32697,
-32729,
-32736,
-32765,
-32780,
-32785,
+32652,
+32687,
+32720,
+32748,
+32773,
 32800,
-32811,
-32817,
-32842,
-32818,
-32839,
-32828,
-32832,
-32830,
-32847,
-32827,
-32838,
-32831,
-32830,
-32847,
-32856,
-32860,
-32870,
+32824,
+32844,
+32858,
+32874,
 32884,
-32885,
-32921,
-32920,
-32943,
-32950,
-32961,
-32976,
-32985,
-32995,
-32994,
+32883,
+32884,
+32886,
+32898,
+32933,
+32975,
 33009,
-33001,
-33004,
-33003,
-32999,
-33007,
-32998,
-32996,
-32982,
-32993,
-32984,
-32989,
-32989,
-32996,
-33003,
-32999,
-33019,
-33023,
-33030,
+33039,
+33047,
+33044,
+33040,
+33043,
 33057,
-33050,
 33079,
-33087,
-33107,
 33109,
-33138,
-33127,
-33163,
-33148,
-33175,
+33139,
+33157,
+33165,
+33160,
+33153,
+33151,
 33156,
-33178,
-33169,
-33173,
 33166,
-33169,
-33162,
-33156,
-33163,
-33139,
-33147,
-33138,
-33118,
-33130,
-33108,
-33117,
+33171,
+33168,
+33154,
+33129,
+33102,
+33082,
+33068,
+33064,
+33069,
+33077,
+33088,
+33093,
+33099,
+33105,
+33107,
 33108,
 33104,
-33104,
-33094,
+33097,
 33087,
-33098,
-33074,
-33109,
-33058,
-33107,
-33048,
-33094,
-33052,
+33076,
 33067,
-33062,
-33048,
-33058,
-33033,
-33042,
-33018,
-33029,
-33009,
-33017,
-33002,
-33002,
-33005,
-33002,
-32995,
-32988,
-33001,
-32988,
-33007,
-32999,
-33007,
-33008,
-33001,
-33017,
+33063,
+33055,
+33052,
+33047,
+33037,
+33027,
+33011,
+33003,
+33003,
+33010,
+33026,
+33043,
+33054,
+33051,
+33036,
+33006,
+32971,
+32943,
+32918,
+32902,
+32891,
+32879,
+32867,
+32847,
+32823,
+32798,
+32778,
+32770,
+32773,
+32781,
+32792,
+32804,
+32811,
+32814,
+32816,
+32822,
+32832,
+32843,
+32859,
+32878,
+32889,
+32897,
+32901,
+32894,
+32878,
+32857,
+32819,
+32772,
+32716,
+32656,
+32602,
+32557,
+32521,
+32488,
+32450,
+32403,
+32344,
+32269,
+32194,
+32129,
+32074,
+32049,
+32042,
+32042,
+32044,
+32034,
+32017,
+31996,
+31985,
+32003,
+32036,
+32088,
+32148,
+32206,
+32259,
+32307,
+32348,
+32386,
+32422,
+32448,
+32467,
+32478,
+32480,
+32479,
+32482,
+32504,
+32539,
+32579,
+32621,
+32646,
+32645,
+32631,
+32616,
+32610,
+32621,
+32655,
+32706,
+32759,
+32802,
+32826,
+32833,
+32834,
+32834,
+32851,
+32883,
+32924,
+32964,
 32993,
-33029,
-33002,
-33020,
+33004,
+33003,
+32994,
+32986,
+32995,
 33014,
-33020,
-33010,
-33024,
-33002,
-33016,
+33047,
+33089,
+33129,
+33158,
+33171,
+33169,
+33159,
+33142,
+33121,
+33109,
+33096,
+33088,
+33080,
+33066,
+33055,
+33035,
 33015,
-32998,
-33012,
-33002,
-32995,
 33005,
-32979,
-32988,
-32990,
-32983,
-33004,
-32981,
-33002,
-32983,
-32999,
-32999,
-33004,
+32996,
+32996,
+33005,
+33007,
 33013,
 33017,
-33013,
-33029,
-33005,
-33032,
-33015,
-33011,
-33023,
 33012,
-33016,
+33009,
+32998,
+32987,
+32991,
+32993,
+33005,
 33019,
-32999,
-33002,
-32999,
-32981,
-32996,
-32983,
+33018,
+33017,
+33012,
 32994,
-32985,
-32985,
-32992,
+32988,
 32987,
-33014,
-33005,
-33033,
-33037,
-33049,
+33002,
+33040,
 33073,
-33062,
-33096,
-33079,
-33114,
-33121,
-33118,
-33139,
-33137,
-33140,
-33151,
-33140,
-33157,
-33146,
-33153,
-33154,
-33147,
-33141,
-33141,
-33129,
-33151,
-33133,
-33160,
+33106,
 33134,
-33172,
+33145,
+33152,
 33147,
-33182,
-33162,
-33200,
-33196,
-33218,
-33225,
-33234,
-33236,
-33248,
-33255,
-33252,
-33271,
-33252,
-33271,
-33256,
-33255,
-33252,
-33239,
-33239,
+33138,
+33147,
+33160,
+33189,
 33225,
-33221,
-33206,
-33201,
-33185,
-33178,
-33161,
-33154,
-33139,
-33141,
-33120,
-33123,
-33096,
+33246,
+33261,
+33260,
+33242,
+33219,
+33187,
+33153,
+33125,
 33090,
-33080,
-33065,
-33059,
-33039,
-33027,
-33015,
-33003,
-32979,
-32972,
-32960,
-32939,
-32935,
-32914,
-32896,
-32889,
-32862,
-32846,
-32836,
-32805,
-32793,
-32773,
-32752,
-32716,
-32721,
-32656,
-32677,
-32609,
-32614,
-32562,
-32552,
-32523,
-32498,
-32478,
-32442,
-32426,
+33055,
+33014,
+32970,
+32930,
+32883,
+32830,
+32771,
+32704,
+32626,
+32548,
+32473,
 32402,
-32382,
-32365,
-32355,
-32325,
-32331,
-32296,
-32316,
-32270,
-32307,
-32245,
-32286,
-32237,
-32255,
-32236,
-32208,
-32230,
-32185,
-32192,
-32166,
-32149,
-32145,
-32126,
-32110,
-32096,
-32082,
-32069,
-32062,
-32061,
-32045,
-32062,
-32049,
-32057,
-32074,
-32077,
-32097,
-32119,
-32123,
-32160,
-32164,
-32193,
-32204,
-32238,
-32238,
-32278,
-32275,
-32310,
-32313,
-32335,
 32349,
-32346,
-32374,
-32369,
-32380,
-32403,
-32393,
-32412,
+32310,
+32281,
+32254,
+32223,
+32183,
+32140,
+32096,
+32062,
+32052,
+32069,
+32114,
+32170,
+32229,
+32286,
+32332,
+32365,
+32392,
 32414,
-32412,
-32446,
-32439,
-32457,
-32479,
-32474,
-32492,
-32514,
-32514,
-32538,
-32555,
-32540,
-32589,
-32577,
-32602,
-32615,
-32609,
-32636,
-32625,
-32644,
-32644,
-32652,
-32669,
-32661,
-32671,
-32662,
-32682,
-32675,
-32686,
-32695,
+32445,
+32482,
+32520,
+32560,
+32599,
+32626,
+32647,
+32665,
+32674,
 32690,
-32698,
-32705,
-32714,
-32712,
-32733,
-32731,
-32740,
-32760,
-32745,
-32765,
-32771,
-32771,
-32783,
-32788,
+32704,
+32726,
+32750,
+32768,
 32786,
 32803,
-32802,
-32809,
-32799,
-32814,
-32787,
-32814,
-32785,
-32804,
-32793,
-32788,
-32801,
-32765,
-32795,
-32772,
-32772,
-32798,
-32759,
-32788,
-32772,
-32776,
-32785,
-32781,
-32787,
-32784,
-32793,
-32783,
 32803,
-32790,
-32800,
-32789,
+32798,
 32792,
 32781,
-32785,
-32780,
-32768,
-32766,
-32743,
-32734,
-32735,
-32702,
+32778,
+32778,
+32782,
+32790,
+32795,
+32790,
+32778,
+32748,
 32715,
-32683,
-32684,
-32661,
-32641,
-32638,
-32621,
-32614,
-32599,
-32590,
-32573,
-32561,
-32558,
-32544,
-32552,
-32523,
-32535,
-32516,
-32517,
-32507,
-32497,
-32492,
-32492,
-32460,
-32480,
-32432,
-32448,
-32408,
-32407,
-32390,
-32361,
-32362,
-32338,
-32322,
-32313,
-32283,
-32264,
-32259,
-32229,
-32237,
-32212,
-32203,
-32188,
-32178,
-32173,
-32168,
-32170,
-32165,
-32169,
-32171,
-32169,
-32181,
-32169,
-32195,
-32187,
+32677,
+32634,
+32600,
+32564,
+32541,
+32521,
+32500,
+32474,
+32434,
+32386,
+32341,
+32286,
+32239,
 32202,
-32209,
-32217,
-32211,
+32172,
+32168,
+32172,
+32185,
+32208,
+32222,
 32231,
-32213,
 32238,
-32226,
-32237,
-32234,
-32241,
-32234,
-32253,
-32230,
-32263,
-32243,
-32268,
-32284,
-32282,
-32310,
-32323,
-32323,
-32369,
-32359,
-32404,
-32401,
-32450,
-32454,
-32502,
-32503,
-32540,
-32549,
-32595,
-32590,
-32647,
-32640,
-32662,
-32670,
-32680,
-32693,
-32695,
-32714,
-32715,
-32727,
-32722,
-32731,
-32737,
-32736,
-32758,
-32755,
-32778,
-32784,
-32793,
-32811,
-32820,
-32844,
-32862,
-32881,
-32903,
-32927,
-32955,
-32970,
-32993,
-33006,
-33022,
-33053,
-33049,
-33085,
-33075,
-33097,
-33091,
-33107,
-33103,
-33128,
-33125,
-33147,
-33131,
-33159,
+32244,
+32265,
+32305,
+32352,
+32415,
+32488,
+32558,
+32629,
+32671,
+32700,
+32723,
+32734,
+32762,
+32796,
+32840,
+32906,
+32971,
+33027,
+33073,
+33096,
+33120,
 33144,
-33170,
-33161,
-33182,
-33187,
-33213,
-33221,
-33242,
-33250,
-33279,
-33286,
-33317,
-33341,
-33359,
-33384,
-33400,
-33412,
-33419,
-33440,
-33444,
-33456,
-33488,
-33467,
-33505,
-33479,
-33492,
-33500,
+33159,
+33193,
+33239,
+33292,
+33363,
+33411,
+33448,
+33483,
 33492,
-33521,
-33498,
-33530,
-33509,
-33531,
-33502,
-33545,
-33516,
-33559,
-33553,
-33575,
-33601,
-33587,
-33618,
-33618,
-33626,
-33654,
-33646,
-33672,
-33668,
-33680,
-33672,
-33670,
-33677,
-33680,
-33685,
-33678,
-33685,
-33650,
-33662,
-33627,
-33628,
-33630,
-33602,
-33621,
-33588,
-33583,
-33578,
-33562,
-33553,
-33551,
-33541,
-33540,
-33524,
+33507,
 33519,
-33493,
-33483,
-33465,
-33443,
-33440,
-33416,
-33408,
-33383,
-33352,
-33332,
-33302,
-33274,
-33256,
-33219,
-33217,
-33153,
-33162,
-33084,
-33098,
-33036,
-33046,
-32997,
-32998,
-32958,
-32948,
-32913,
-32898,
-32856,
-32864,
-32822,
-32820,
-32785,
-32768,
-32746,
-32726,
-32709,
-32687,
-32681,
-32666,
-32637,
-32633,
-32604,
-32583,
-32579,
-32549,
-32550,
-32545,
-32510,
-32534,
-32491,
-32508,
-32498,
-32478,
-32510,
-32470,
-32502,
-32482,
-32479,
-32485,
-32475,
-32468,
-32485,
-32464,
-32478,
-32475,
-32453,
+33524,
+33561,
+33600,
+33631,
+33667,
+33673,
+33680,
+33675,
+33637,
+33615,
+33585,
+33554,
+33538,
+33498,
+33449,
+33404,
+33329,
+33252,
+33172,
+33078,
+33010,
+32941,
+32870,
+32812,
+32745,
+32692,
+32645,
+32587,
+32547,
+32516,
+32494,
+32490,
+32483,
 32475,
-32438,
-32465,
-32431,
-32446,
-32425,
-32435,
-32413,
-32411,
-32398,
-32397,
+32473,
+32460,
+32444,
+32426,
 32402,
-32390,
-32406,
 32398,
-32399,
-32407,
-32393,
-32427,
+32400,
 32413,
-32423,
-32432,
-32429,
-32446,
-32455,
-32444,
-32472,
-32469,
-32482,
-32492,
-32495,
+32427,
+32452,
+32467,
+32506,
 32505,
-32515,
-32509,
-32528,
-32520,
-32532,
-32544
+32554
 };
@@ -1,5 +1,5 @@
-// This file was generated by executing this statement: wav2c p2Unfrozen.wav
-extern uint16_t p2Unfrozen_wav[];
-#define P2UNFROZEN_WAV_SAMPLE_RATE 480000
+// This file was generated by executing this statement: wav2c -rate 16000 p2Unfrozen.wav
+extern const uint16_t p2Unfrozen_wav[];
+#define P2UNFROZEN_WAV_SAMPLE_RATE 16000
 #define P2UNFROZEN_WAV_BITS_PER_SAMPLE 16
-#define P2UNFROZEN_WAV_NUMBER_OF_SAMPLES 112422
+#define P2UNFROZEN_WAV_NUMBER_OF_SAMPLES 37474
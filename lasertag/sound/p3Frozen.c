@@ -1,69812 +1,23275 @@
-// This file was generated by executing this statement: wav2c p3Frozen.wav
+// This file was generated by executing this statement: wav2c -rate 16000 p3Frozen.wav
 
 #include <stdint.h>
 
-uint16_t p3Frozen_wav[69806] = {
-32582,
-32568,
-32572,
-32575,
-32569,
-32584,
-32575,
-32575,
-32565,
-32557,
-32560,
-32564,
-32556,
-32560,
-32525,
-32549,
-32521,
-32546,
-32546,
-32561,
-32550,
+const uint16_t p3Frozen_wav[23269] = {
+32641,
 32557,
-32546,
-32542,
-32545,
+32583,
+32559,
+32558,
 32535,
-32522,
+32547,
+32554,
+32541,
 32505,
-32486,
-32474,
-32465,
-32463,
-32442,
-32445,
-32410,
-32422,
-32406,
-32444,
-32440,
-32462,
-32464,
-32454,
-32464,
-32444,
-32458,
-32441,
-32459,
-32419,
-32428,
-32417,
-32407,
-32436,
-32412,
-32433,
-32428,
-32401,
-32425,
-32390,
-32397,
-32390,
-32371,
-32377,
-32388,
-32388,
-32430,
-32431,
+32467,
 32433,
+32420,
+32457,
+32458,
+32447,
+32424,
+32420,
+32423,
+32402,
+32375,
+32403,
 32431,
-32407,
 32415,
-32415,
-32442,
-32445,
-32470,
-32463,
-32472,
-32480,
-32500,
-32504,
-32525,
-32537,
-32542,
-32591,
-32594,
-32632,
-32617,
-32610,
-32604,
-32599,
-32620,
-32632,
-32645,
+32447,
+32478,
+32503,
+32559,
+32616,
+32606,
+32630,
 32643,
-32649,
-32628,
-32640,
-32648,
-32659,
-32690,
-32691,
+32646,
 32696,
-32701,
-32691,
-32700,
-32695,
-32719,
-32739,
-32761,
-32761,
-32781,
-32777,
-32810,
-32813,
-32840,
-32845,
-32847,
-32853,
-32854,
-32869,
-32896,
-32912,
-32914,
-32932,
-32918,
-32935,
-32932,
-32951,
-32938,
-32950,
-32934,
-32940,
-32940,
-32963,
-32973,
-32984,
-32989,
-32981,
-32994,
-32995,
+32692,
+32720,
+32765,
+32804,
+32843,
+32860,
+32906,
+32929,
+32942,
+32939,
+32959,
+32985,
+33001,
 33014,
-33015,
-33017,
-33013,
-33017,
-33008,
+33023,
 33048,
-33033,
-33067,
-33028,
-33043,
-33018,
-33024,
-33030,
-33046,
-33047,
-33056,
-33026,
-33032,
-33006,
-33017,
-33002,
-33028,
-33012,
-33034,
-33003,
 33025,
-32997,
+33042,
+33038,
+33009,
 33022,
-32986,
-33010,
-32971,
-32994,
-32963,
-32975,
-32961,
-32972,
+33013,
+33001,
+32980,
 32967,
-32976,
-32960,
-32969,
-32942,
-32949,
-32925,
-32931,
-32912,
-32916,
-32914,
-32905,
-32909,
-32884,
-32870,
-32841,
-32821,
-32812,
-32812,
-32822,
-32831,
-32826,
-32819,
-32802,
-32782,
+32970,
+32952,
+32923,
+32913,
+32888,
+32823,
+32820,
+32820,
 32767,
-32762,
-32756,
-32764,
-32779,
-32769,
-32789,
-32763,
-32763,
-32746,
-32738,
-32727,
-32718,
-32719,
-32716,
-32718,
-32723,
-32724,
+32766,
+32778,
+32748,
+32721,
+32717,
 32736,
-32749,
-32742,
-32757,
-32746,
-32739,
-32758,
-32740,
-32768,
-32754,
+32750,
+32748,
+32762,
 32772,
-32767,
-32771,
-32770,
-32761,
 32750,
-32746,
-32746,
-32745,
-32763,
-32743,
-32746,
-32723,
-32726,
-32725,
-32742,
-32761,
+32752,
+32737,
+32731,
+32773,
 32782,
-32778,
-32785,
-32771,
-32777,
-32790,
-32793,
-32788,
-32784,
-32784,
 32786,
-32813,
-32810,
-32839,
-32823,
-32830,
-32839,
-32849,
-32881,
-32889,
-32887,
-32902,
-32865,
-32890,
-32879,
-32905,
-32910,
-32929,
-32898,
-32928,
-32892,
-32941,
-32925,
-32971,
-32956,
-32978,
-32980,
-32986,
-32997,
-33012,
-33014,
-33028,
-33035,
-33048,
-33057,
-33055,
-33063,
-33042,
-33042,
-33046,
-33036,
-33063,
-33045,
-33055,
-33034,
-33047,
-33045,
-33077,
-33077,
-33109,
-33087,
-33117,
-33071,
-33086,
-33077,
-33069,
-33088,
+32788,
+32816,
+32833,
+32873,
+32888,
+32888,
+32916,
+32915,
+32952,
+32984,
+33004,
+33040,
+33056,
+33044,
+33050,
+33044,
+33066,
+33104,
+33076,
 33086,
-33094,
 33076,
-33063,
-33044,
-33037,
-33048,
-33059,
-33065,
-33085,
-33056,
-33080,
-33062,
+33042,
 33068,
-33095,
-33084,
-33101,
-33096,
-33084,
-33097,
-33088,
+33069,
+33083,
 33096,
-33100,
-33082,
-33090,
-33068,
+33092,
+33091,
+33071,
+33079,
 33074,
-33077,
-33065,
-33089,
-33072,
-33082,
-33073,
-33068,
-33064,
-33062,
-33054,
 33061,
-33039,
-33050,
-33003,
-33017,
-32979,
-33002,
-32986,
+33048,
 33002,
-32983,
-32986,
-32956,
-32956,
-32939,
-32946,
-32942,
-32938,
-32925,
-32908,
-32904,
-32895,
-32898,
-32894,
-32860,
-32859,
-32836,
-32837,
-32840,
-32810,
-32813,
-32771,
-32774,
-32769,
-32792,
+32995,
+32976,
+32947,
+32932,
+32907,
+32881,
+32847,
+32816,
+32773,
 32804,
-32826,
-32813,
-32805,
-32784,
-32761,
-32762,
-32730,
-32742,
-32700,
-32715,
-32692,
-32695,
-32682,
-32675,
-32652,
-32658,
+32806,
+32750,
+32718,
+32690,
+32661,
 32641,
-32644,
-32643,
-32633,
-32640,
-32629,
-32616,
-32618,
-32592,
-32597,
-32579,
-32574,
-32564,
-32558,
-32538,
-32529,
-32510,
-32508,
-32506,
-32505,
-32509,
-32509,
-32518,
-32512,
-32506,
-32520,
-32510,
-32528,
+32636,
+32610,
+32582,
+32554,
 32514,
+32507,
 32512,
-32521,
-32502,
-32516,
-32510,
-32524,
-32509,
-32514,
-32511,
-32535,
-32538,
-32572,
-32570,
-32567,
-32575,
-32548,
-32566,
-32549,
-32562,
-32571,
-32576,
-32583,
-32586,
-32587,
-32580,
-32586,
-32577,
-32600,
+32515,
+32517,
+32513,
+32513,
+32518,
+32561,
+32568,
+32554,
+32578,
+32585,
 32584,
-32618,
-32621,
-32623,
-32653,
-32636,
-32663,
-32656,
-32662,
+32609,
+32640,
 32660,
-32663,
-32659,
-32672,
-32673,
-32696,
-32692,
-32687,
-32687,
+32660,
+32680,
+32690,
 32666,
-32667,
-32668,
-32673,
-32701,
-32686,
-32724,
-32692,
-32714,
-32695,
+32690,
 32708,
 32702,
-32744,
-32748,
-32787,
-32789,
-32803,
-32815,
-32805,
-32813,
-32817,
+32756,
+32806,
 32810,
-32840,
-32829,
-32839,
 32830,
-32819,
-32809,
-32813,
-32806,
-32816,
-32807,
-32812,
-32807,
+32828,
+32810,
+32810,
+32805,
+32802,
 32792,
-32820,
-32787,
-32824,
-32784,
-32803,
+32792,
+32791,
+32815,
+32840,
+32827,
 32786,
-32790,
-32790,
-32795,
-32797,
-32783,
-32798,
-32785,
-32811,
-32808,
-32842,
-32820,
-32852,
-32832,
-32829,
-32841,
-32800,
-32819,
-32765,
-32796,
-32743,
-32783,
-32756,
+32764,
 32773,
-32776,
-32770,
-32761,
-32750,
-32746,
-32734,
-32727,
-32726,
-32697,
-32687,
-32655,
-32646,
-32631,
-32624,
-32606,
-32597,
-32588,
-32560,
-32562,
-32545,
-32563,
+32752,
+32729,
+32682,
+32630,
+32599,
+32553,
+32577,
 32570,
-32595,
-32578,
-32578,
-32552,
-32528,
 32529,
+32535,
 32524,
-32541,
-32538,
-32534,
-32520,
-32528,
-32514,
-32550,
-32534,
-32558,
-32537,
-32524,
-32520,
-32518,
-32520,
-32540,
-32514,
-32518,
-32497,
-32495,
-32484,
-32477,
+32543,
+32531,
+32521,
+32517,
+32481,
+32467,
+32475,
 32464,
-32473,
-32461,
-32477,
-32468,
-32478,
-32470,
-32468,
-32462,
-32449,
-32462,
-32448,
-32466,
-32437,
-32432,
-32405,
-32417,
-32428,
-32440,
-32463,
-32443,
-32441,
-32428,
-32417,
+32459,
 32439,
-32448,
-32463,
-32487,
-32474,
-32490,
-32470,
-32463,
-32453,
-32461,
-32454,
-32471,
-32471,
-32466,
-32487,
-32467,
-32480,
-32502,
-32511,
-32550,
-32538,
-32530,
-32504,
-32491,
-32466,
-32491,
+32418,
+32450,
+32430,
+32446,
 32488,
-32519,
-32508,
-32509,
-32484,
-32479,
+32460,
+32461,
+32473,
 32482,
-32464,
+32538,
+32506,
+32483,
+32512,
+32480,
+32477,
+32469,
 32492,
-32461,
-32487,
-32463,
-32467,
-32478,
-32494,
-32505,
-32532,
-32511,
-32534,
-32499,
 32524,
-32509,
-32537,
-32532,
-32556,
-32557,
-32566,
-32561,
-32579,
-32583,
-32605,
-32597,
-32615,
-32602,
-32612,
-32612,
-32603,
-32618,
-32620,
-32617,
-32624,
-32603,
-32615,
-32589,
-32614,
+32512,
+32541,
+32563,
+32586,
+32609,
 32608,
-32625,
-32644,
-32641,
-32674,
-32659,
+32619,
+32611,
+32605,
+32637,
+32675,
+32694,
+32706,
 32698,
-32682,
 32704,
-32691,
-32707,
-32696,
-32719,
-32693,
-32711,
-32687,
-32701,
-32694,
-32721,
-32722,
-32749,
-32748,
-32762,
-32757,
-32792,
-32778,
-32813,
-32786,
-32807,
-32787,
-32799,
-32804,
-32807,
-32797,
-32795,
-32781,
+32739,
+32771,
 32795,
-32806,
-32812,
-32835,
-32833,
-32839,
-32847,
-32843,
-32869,
-32854,
-32873,
-32865,
-32873,
-32864,
-32860,
-32832,
+32799,
+32800,
+32791,
+32814,
+32844,
+32853,
+32875,
+32849,
 32840,
-32826,
-32857,
-32863,
-32878,
-32876,
-32874,
-32883,
-32886,
-32913,
-32945,
-32956,
-32973,
-32973,
-32981,
-33003,
-33014,
-33038,
+32872,
+32881,
+32937,
+32977,
+33017,
 33043,
-33042,
-33038,
-33040,
-33040,
-33068,
-33066,
-33104,
-33091,
-33114,
-33114,
-33119,
+33046,
+33090,
+33118,
 33151,
-33144,
-33177,
-33169,
-33189,
-33207,
-33223,
-33232,
-33237,
-33228,
-33227,
-33219,
-33243,
-33234,
-33270,
-33261,
-33289,
+33193,
+33229,
+33229,
+33241,
 33286,
-33297,
-33282,
-33306,
-33291,
-33340,
-33345,
+33288,
+33330,
+33400,
 33391,
-33404,
-33402,
-33406,
-33379,
-33384,
-33384,
-33390,
-33393,
-33401,
+33385,
 33413,
-33406,
-33444,
-33423,
-33438,
 33429,
-33425,
+33433,
+33429,
+33430,
 33437,
-33425,
-33445,
-33417,
-33438,
-33412,
-33442,
-33425,
-33460,
-33421,
-33457,
-33432,
-33442,
-33439,
-33427,
-33416,
-33392,
-33391,
-33384,
-33406,
-33392,
+33446,
+33422,
+33394,
 33391,
-33362,
-33348,
-33349,
-33353,
-33373,
-33367,
-33367,
-33341,
-33345,
-33320,
-33319,
-33298,
-33293,
-33273,
-33278,
-33244,
-33251,
-33202,
-33214,
-33163,
+33356,
+33361,
+33356,
+33309,
+33283,
+33235,
 33182,
-33155,
-33178,
-33154,
-33151,
-33135,
-33128,
-33126,
-33120,
-33101,
-33093,
-33069,
-33039,
-33050,
-33019,
-33043,
-33003,
-33012,
-32961,
-32965,
-32944,
-32947,
-32958,
-32941,
-32947,
-32930,
-32927,
+33163,
+33140,
+33117,
+33067,
+33034,
+32996,
+32951,
+32945,
 32932,
-32913,
-32906,
-32906,
-32858,
-32885,
-32841,
+32904,
 32870,
-32835,
-32836,
-32799,
-32793,
-32759,
-32777,
-32752,
-32760,
-32732,
-32724,
-32700,
-32714,
-32694,
-32724,
-32694,
-32702,
-32674,
-32684,
-32665,
-32676,
-32666,
+32841,
+32788,
+32758,
+32722,
+32705,
+32695,
+32672,
 32663,
-32657,
-32627,
-32614,
-32601,
-32586,
-32583,
-32579,
+32615,
 32580,
-32582,
-32602,
-32588,
-32609,
-32585,
-32573,
-32546,
-32532,
-32514,
-32524,
-32513,
-32529,
-32512,
-32502,
-32487,
-32476,
-32477,
-32488,
-32496,
-32507,
-32511,
-32484,
-32504,
-32454,
-32486,
-32452,
-32459,
-32447,
-32434,
-32422,
-32403,
-32382,
-32381,
-32376,
-32381,
-32374,
+32587,
+32599,
+32548,
+32518,
+32515,
+32478,
+32497,
+32499,
+32466,
+32450,
+32399,
 32380,
-32338,
-32353,
-32315,
-32341,
-32320,
-32321,
-32301,
-32293,
-32275,
-32287,
-32291,
-32332,
-32327,
-32348,
-32337,
-32323,
-32319,
-32310,
-32304,
-32299,
-32273,
-32264,
-32254,
-32264,
-32281,
-32296,
-32305,
-32317,
-32294,
-32303,
-32310,
-32299,
-32322,
-32289,
-32298,
-32278,
-32297,
-32303,
-32313,
-32306,
-32297,
+32365,
+32333,
+32316,
 32281,
-32266,
-32285,
-32272,
-32315,
-32288,
 32319,
-32279,
-32282,
+32337,
+32312,
+32275,
 32266,
-32260,
-32270,
-32278,
-32267,
-32289,
-32267,
-32272,
-32264,
-32258,
-32287,
-32288,
-32324,
-32315,
-32331,
-32338,
-32325,
-32351,
-32325,
-32339,
+32303,
 32307,
-32299,
-32288,
-32295,
+32303,
+32291,
+32307,
+32283,
+32284,
 32304,
+32265,
+32275,
+32273,
+32268,
 32311,
+32334,
+32335,
+32299,
+32301,
+32321,
 32318,
-32324,
-32312,
-32322,
-32303,
+32363,
+32353,
+32319,
+32346,
+32333,
 32347,
-32336,
-32371,
-32366,
-32368,
-32355,
-32330,
-32332,
-32312,
-32330,
-32335,
-32342,
-32350,
-32342,
-32336,
-32326,
-32337,
-32339,
-32369,
-32375,
-32401,
-32391,
-32411,
-32419,
-32431,
-32459,
-32449,
-32465,
-32426,
-32427,
-32425,
-32436,
-32448,
-32456,
-32453,
-32454,
-32449,
-32458,
-32477,
-32501,
-32523,
+32390,
+32422,
+32455,
+32428,
+32446,
+32452,
+32478,
 32529,
-32528,
-32526,
-32526,
-32562,
-32571,
-32644,
-32632,
-32675,
-32648,
-32659,
-32651,
-32679,
-32702,
-32732,
-32752,
-32763,
-32751,
+32531,
+32624,
+32657,
+32676,
+32750,
 32761,
-32770,
-32793,
-32808,
-32833,
-32832,
-32842,
-32829,
-32845,
-32835,
-32860,
-32857,
-32875,
-32892,
-32892,
-32918,
-32919,
-32941,
-32943,
-32958,
-32952,
-32976,
+32810,
+32839,
+32841,
+32876,
+32911,
+32946,
+32967,
+32979,
 32967,
-32985,
-32974,
-32974,
-32977,
 32966,
+32969,
+32936,
 32960,
-32972,
-32953,
+32993,
+32984,
 32982,
-32972,
-32959,
-32972,
-32935,
-32946,
-32930,
-32943,
-32957,
-32978,
-32991,
-32998,
-32985,
-32989,
-32976,
-32994,
+32967,
+32967,
+32973,
 32971,
-32993,
-32977,
-32968,
-32968,
-32963,
-32954,
+32950,
+32960,
 32989,
-32953,
-32985,
-32962,
-32973,
+32977,
 32976,
-32974,
-32967,
-32957,
-32944,
-32951,
-32945,
-32969,
-32967,
-32990,
-32980,
-32993,
-32983,
-32968,
-32993,
+32964,
+32952,
+32966,
 32953,
-32997,
-32957,
+32959,
 32981,
-32963,
+32982,
+32981,
+32970,
+32959,
 32962,
-32941,
-32964,
-32943,
-32973,
-32961,
+32976,
 32969,
-32959,
-32948,
-32951,
-32950,
 32961,
-32978,
-32963,
-32988,
 32980,
-32979,
-32990,
-32974,
-32992,
-32973,
-32978,
-32978,
-32970,
-32967,
-32963,
-32950,
-32971,
-32943,
-32975,
-32966,
-32962,
-32992,
-32963,
-32977,
-32977,
-32958,
-32966,
-32953,
-32969,
-32965,
-32993,
-32977,
 33003,
-32998,
-33008,
-33015,
-33017,
-33017,
-33019,
-32998,
-33018,
+33016,
+33011,
+33004,
+33003,
+33027,
+33033,
 32997,
-33014,
-33000,
-33001,
-33008,
-32999,
+32991,
+33004,
+33007,
+33017,
 33023,
-33025,
-33039,
-33034,
 33041,
-33008,
-33022,
-32990,
-32990,
-32992,
-32989,
-32990,
-33010,
-32995,
-33016,
-33000,
-33007,
-33011,
-33010,
-33024,
-33010,
-33037,
-33001,
-33045,
-33020,
-33049,
-33051,
-33057,
-33067,
-33062,
 33066,
+33054,
 33053,
-33047,
-33050,
-33049,
-33067,
-33080,
-33093,
 33091,
-33086,
-33064,
-33072,
-33050,
-33080,
-33087,
-33105,
-33102,
-33106,
-33090,
-33087,
-33099,
-33084,
-33129,
-33109,
-33141,
-33117,
-33114,
-33107,
-33088,
-33108,
-33088,
-33113,
-33083,
+33071,
+33073,
 33107,
-33088,
-33112,
-33112,
+33087,
 33114,
+33122,
+33099,
+33098,
+33098,
 33118,
-33093,
-33084,
-33062,
-33068,
 33079,
-33101,
-33104,
-33118,
-33074,
-33093,
-33040,
-33073,
-33053,
-33082,
-33080,
-33085,
-33076,
-33078,
-33073,
-33076,
-33063,
-33060,
-33043,
-33050,
-33024,
-33029,
-33010,
-33004,
-33004,
-32977,
-33000,
-32977,
-32987,
-32983,
-32983,
-33004,
-33004,
-33019,
-33019,
-32990,
+33081,
+33105,
+33061,
+33072,
+33083,
+33068,
+33052,
+33021,
 32998,
-32955,
-32968,
-32970,
-32981,
-32999,
-32993,
-32996,
-32964,
-32945,
-32911,
-32897,
-32888,
-32899,
-32909,
-32920,
-32927,
-32927,
-32922,
-32936,
+32983,
+32989,
+33016,
+32984,
+32969,
+33000,
+32939,
+32893,
 32917,
-32909,
-32895,
-32867,
-32863,
-32864,
-32855,
-32875,
-32844,
-32852,
-32825,
-32832,
-32808,
-32789,
-32780,
-32752,
-32746,
-32732,
-32735,
-32714,
-32729,
-32663,
-32691,
-32629,
-32668,
-32654,
-32676,
-32671,
-32669,
-32632,
-32620,
-32571,
-32576,
-32549,
-32559,
-32552,
-32561,
-32543,
-32556,
-32517,
-32521,
-32508,
-32491,
-32504,
-32477,
-32483,
-32466,
-32449,
-32445,
-32420,
-32432,
-32418,
-32412,
-32398,
-32378,
-32359,
-32359,
-32337,
-32346,
-32321,
-32341,
-32307,
-32330,
-32300,
-32310,
+32931,
+32905,
+32866,
+32858,
+32837,
+32791,
+32745,
+32722,
+32667,
+32661,
+32664,
+32583,
+32554,
+32553,
+32515,
+32494,
+32464,
+32431,
+32410,
+32364,
+32338,
+32320,
 32312,
-32314,
-32288,
-32291,
-32263,
-32266,
-32268,
-32268,
-32273,
-32276,
-32258,
-32271,
-32254,
-32261,
+32296,
+32265,
+32272,
+32262,
 32264,
-32266,
-32267,
-32258,
 32260,
-32251,
-32251,
-32272,
 32257,
-32267,
-32268,
-32234,
-32250,
-32226,
-32245,
-32235,
-32236,
-32213,
-32201,
-32179,
-32169,
-32184,
+32265,
+32239,
+32239,
+32196,
 32179,
+32194,
+32180,
 32208,
-32192,
-32190,
-32179,
-32173,
-32186,
-32202,
 32213,
+32177,
+32159,
 32216,
-32214,
-32207,
-32207,
-32181,
-32202,
-32143,
-32178,
-32136,
-32182,
-32190,
-32216,
-32248,
-32223,
-32249,
-32212,
-32240,
-32232,
-32244,
-32246,
-32246,
-32256,
-32254,
-32262,
-32258,
-32276,
+32236,
+32233,
+32251,
+32260,
 32269,
-32264,
-32259,
-32246,
-32257,
-32265,
-32280,
-32292,
-32294,
-32321,
-32297,
-32321,
+32253,
+32277,
 32309,
-32320,
-32321,
-32336,
-32336,
-32351,
-32356,
-32355,
-32374,
-32382,
-32410,
-32415,
-32447,
-32448,
-32480,
-32482,
-32520,
-32515,
-32541,
-32523,
-32536,
-32531,
-32542,
-32552,
-32559,
-32553,
-32557,
-32531,
-32559,
+32312,
+32333,
+32352,
+32387,
+32437,
+32494,
+32528,
+32537,
 32553,
-32589,
-32579,
-32616,
-32618,
-32644,
-32670,
-32653,
-32692,
-32680,
-32690,
-32736,
-32725,
-32771,
-32746,
-32758,
-32749,
-32779,
-32782,
-32816,
-32807,
-32834,
-32829,
-32881,
-32900,
-32942,
+32550,
+32571,
+32631,
+32664,
+32706,
+32747,
+32765,
+32799,
+32849,
+32928,
 32939,
-32945,
-32932,
-32936,
-32954,
-32981,
-33002,
-33030,
-33003,
-33041,
-33021,
-33059,
-33056,
-33102,
-33083,
-33133,
-33109,
-33156,
-33164,
-33198,
-33210,
-33212,
-33220,
-33219,
-33236,
-33233,
-33259,
-33249,
-33268,
-33251,
-33268,
-33257,
-33272,
-33276,
-33274,
-33284,
-33297,
-33281,
-33295,
-33271,
-33281,
-33280,
-33297,
-33307,
-33308,
-33321,
-33302,
-33317,
-33314,
-33336,
-33366,
-33364,
-33391,
-33348,
-33363,
-33338,
-33367,
+32977,
+33024,
+33048,
+33100,
+33148,
+33206,
+33225,
+33248,
+33263,
+33265,
+33289,
+33282,
+33285,
+33311,
+33311,
+33359,
+33365,
+33353,
+33350,
+33331,
 33345,
-33367,
-33346,
-33341,
-33333,
-33326,
-33335,
-33348,
-33340,
-33352,
-33334,
-33324,
-33334,
-33317,
-33329,
-33303,
-33302,
-33258,
-33270,
-33230,
+33331,
+33320,
 33271,
-33238,
-33253,
-33228,
-33207,
-33178,
-33185,
-33180,
-33196,
-33205,
-33183,
+33252,
+33226,
+33182,
+33195,
+33159,
+33166,
 33172,
-33151,
-33156,
+33131,
+33131,
+33123,
+33155,
 33157,
-33173,
-33173,
-33177,
-33165,
-33163,
-33134,
-33147,
 33117,
-33138,
-33111,
-33148,
-33106,
-33147,
-33120,
-33137,
-33149,
-33165,
-33166,
-33178,
-33129,
-33125,
-33110,
-33114,
-33144,
-33137,
-33127,
-33116,
+33135,
+33087,
 33074,
-33072,
-33070,
-33072,
-33102,
-33070,
-33100,
-33073,
-33081,
-33082,
 33089,
-33089,
-33076,
-33074,
-33051,
-33051,
+33080,
+33083,
 33046,
-33042,
 33054,
-33058,
-33061,
-33062,
-33050,
-33031,
-33045,
-33033,
-33075,
-33078,
-33088,
-33093,
-33061,
-33047,
-33030,
-32999,
-33014,
-32986,
-32990,
-32957,
-32964,
-32949,
-32947,
+33057,
+33037,
+33082,
+33067,
+33012,
+32980,
 32953,
-32943,
-32940,
-32938,
-32943,
-32964,
-32975,
-33001,
-32988,
-32981,
-32961,
-32912,
-32930,
-32886,
-32909,
-32876,
-32893,
-32883,
-32902,
-32902,
-32901,
-32880,
-32888,
-32874,
-32903,
-32904,
-32930,
-32927,
-32935,
-32915,
-32904,
-32880,
-32859,
-32866,
-32858,
-32888,
+32942,
+32948,
+32990,
+32958,
+32897,
+32891,
+32897,
+32885,
 32907,
-32910,
-32896,
-32873,
+32934,
+32877,
+32869,
+32909,
+32838,
+32823,
+32852,
 32832,
-32816,
-32815,
-32827,
-32830,
-32871,
-32824,
-32868,
-32817,
-32844,
-32833,
-32855,
-32856,
-32864,
-32839,
-32842,
-32807,
-32804,
-32793,
-32802,
-32805,
-32798,
-32767,
-32761,
-32711,
-32741,
-32718,
-32745,
-32732,
-32726,
-32722,
-32709,
-32717,
-32701,
-32715,
-32688,
-32692,
-32692,
-32680,
-32686,
-32670,
-32654,
-32648,
-32621,
-32613,
-32605,
+32861,
+32829,
+32801,
+32791,
+32734,
+32731,
+32724,
+32705,
+32694,
+32679,
+32642,
 32607,
-32591,
-32597,
-32564,
-32578,
-32551,
-32557,
-32553,
-32542,
-32558,
-32533,
-32566,
-32553,
-32546,
-32534,
-32473,
-32461,
-32410,
-32428,
-32414,
-32430,
-32424,
-32394,
-32393,
-32352,
-32359,
-32340,
-32332,
-32301,
-32302,
-32262,
-32272,
-32254,
-32247,
-32226,
-32211,
-32179,
+32586,
+32562,
+32544,
+32559,
+32519,
+32429,
+32421,
+32387,
+32337,
+32294,
+32253,
+32209,
+32163,
 32179,
-32161,
-32164,
-32173,
-32184,
-32172,
-32207,
-32177,
-32190,
-32156,
-32141,
-32120,
-32128,
-32141,
-32154,
-32173,
-32167,
-32157,
+32191,
 32138,
-32100,
-32085,
-32053,
-32050,
-32028,
-32044,
-32050,
+32140,
+32168,
+32109,
+32038,
+32061,
+32122,
 32090,
-32106,
-32139,
-32108,
-32115,
-32078,
-32079,
-32078,
 32085,
-32107,
-32102,
-32115,
-32126,
-32131,
-32164,
-32161,
-32183,
+32118,
+32152,
+32181,
 32174,
-32182,
-32170,
-32183,
-32169,
-32188,
 32188,
-32193,
-32199,
-32215,
-32203,
-32211,
-32195,
-32189,
-32190,
-32225,
-32218,
-32289,
-32256,
-32296,
-32286,
-32311,
-32345,
-32370,
-32367,
-32364,
-32360,
-32355,
-32405,
-32387,
-32402,
-32343,
-32332,
-32319,
-32376,
-32413,
-32430,
-32394,
-32362,
-32383,
-32455,
-32590,
-32672,
-32692,
-32642,
-32543,
-32497,
-32450,
-32468,
-32456,
-32484,
-32479,
-32517,
-32533,
-32561,
-32558,
-32534,
-32523,
-32519,
-32541,
-32554,
-32577,
-32591,
-32613,
-32651,
-32644,
-32652,
-32605,
+32210,
+32192,
+32219,
+32267,
+32326,
+32354,
+32388,
+32363,
+32358,
+32395,
+32410,
+32645,
 32580,
-32564,
-32609,
-32629,
-32677,
-32652,
-32668,
-32690,
-32752,
-32844,
-32875,
-32877,
-32808,
-32745,
-32701,
-32680,
-32683,
-32698,
-32679,
-32697,
-32718,
-32747,
-32791,
-32797,
-32781,
-32778,
-32757,
-32777,
-32761,
-32781,
-32761,
-32765,
-32761,
-32781,
-32799,
-32821,
-32832,
-32817,
-32837,
-32820,
-32861,
-32882,
-32897,
-32895,
+32434,
+32508,
+32539,
+32539,
+32539,
+32634,
+32623,
+32593,
+32640,
+32714,
 32859,
-32845,
-32805,
-32829,
-32813,
-32840,
-32833,
-32833,
-32846,
-32855,
-32863,
-32875,
-32838,
-32822,
-32774,
-32760,
-32755,
-32748,
-32772,
-32761,
-32785,
-32777,
-32802,
-32787,
-32781,
-32745,
-32698,
-32690,
-32682,
-32710,
-32747,
-32786,
-32797,
-32796,
-32789,
-32784,
-32780,
-32767,
-32743,
-32726,
-32715,
-32754,
-32780,
+32766,
+32666,
+32711,
+32770,
+32783,
+32765,
+32764,
 32801,
+32823,
+32860,
+32885,
+32825,
+32824,
+32851,
+32858,
+32788,
+32748,
 32783,
+32788,
+32711,
+32708,
+32797,
+32790,
+32730,
+32773,
+32734,
+32739,
+32534,
+32723,
 32709,
-32694,
+32849,
+33679,
+33123,
+32986,
+33049,
+32906,
+33056,
+32701,
+32892,
+33020,
+33196,
+33788,
+33663,
+33419,
+33049,
+32973,
+33111,
+33002,
+32893,
+32937,
+33012,
+33038,
+33213,
+33483,
+33141,
+32742,
+33195,
+33293,
+32907,
+32839,
+33060,
+33220,
+33211,
+33189,
+33322,
+33513,
+33533,
+33686,
+33767,
+33819,
+33601,
+33338,
+33322,
+33177,
+33373,
+33431,
+33386,
+33510,
+33434,
+33774,
+34114,
+33924,
+33469,
+33284,
+33375,
+33143,
+32889,
+32822,
+32733,
+32563,
+32538,
+32996,
+33164,
+32860,
 32674,
-32702,
-32678,
-32615,
-32526,
-32519,
-32630,
+32606,
+32692,
+32610,
+32557,
+32427,
+32095,
+32154,
+32516,
+32777,
+32619,
+32512,
+32656,
+32659,
+32497,
+32480,
+32808,
+32662,
+32311,
+32409,
+32642,
+32776,
+32623,
+32626,
+32669,
+32387,
+32506,
 32796,
-32878,
-32826,
-32641,
-32574,
-32729,
-33134,
-33578,
-33798,
-33693,
-33329,
-33007,
-32869,
-32958,
-33100,
-33154,
-33065,
-32941,
-32887,
-32920,
-33007,
-33052,
-33015,
-32962,
-32915,
-32842,
-32813,
-32708,
-32731,
-32784,
-32970,
-33088,
-33118,
-33045,
-32982,
-33107,
-33362,
-33708,
-33886,
-33880,
-33702,
-33561,
-33501,
-33558,
-33515,
-33389,
-33132,
-32952,
-32886,
-32972,
-33069,
-33108,
-33063,
-33017,
-33036,
-33061,
-33096,
-33004,
-32913,
-32811,
-32840,
-32915,
-32998,
-33022,
-32989,
-32957,
-32979,
-33025,
-33080,
-33114,
-33116,
-33185,
-33273,
-33442,
-33502,
-33497,
-33328,
-33118,
-32906,
-32782,
-32767,
-32852,
-32997,
-33169,
-33317,
-33360,
-33333,
-33159,
-33022,
-32870,
-32839,
-32825,
-32874,
-32904,
-32949,
-33032,
-33122,
-33219,
-33255,
-33246,
-33185,
-33176,
-33182,
-33219,
-33230,
-33222,
-33235,
-33269,
-33394,
-33475,
-33568,
-33545,
-33506,
-33494,
-33542,
-33631,
-33732,
-33747,
-33753,
-33737,
-33752,
-33815,
-33845,
-33812,
-33729,
-33564,
-33471,
-33373,
-33361,
-33348,
-33333,
-33310,
-33258,
-33221,
-33187,
-33216,
-33255,
-33366,
-33432,
-33477,
-33450,
-33394,
-33344,
-33364,
-33437,
-33498,
-33546,
-33485,
-33443,
-33403,
-33471,
-33626,
-33786,
-33966,
-34043,
-34097,
-34090,
-34033,
-33943,
-33796,
-33621,
-33457,
-33335,
-33290,
-33290,
-33338,
-33358,
-33374,
-33323,
-33257,
-33144,
-33045,
-32943,
-32892,
-32845,
-32839,
-32827,
-32799,
-32785,
-32723,
-32684,
-32619,
-32560,
-32525,
-32493,
-32545,
-32643,
-32817,
-32983,
-33145,
-33189,
-33189,
-33057,
-32969,
-32831,
-32796,
-32720,
-32694,
-32628,
-32610,
-32589,
-32623,
-32673,
-32697,
-32712,
-32637,
-32619,
-32551,
-32563,
-32559,
-32559,
-32517,
-32417,
-32309,
-32178,
-32105,
-32063,
-32074,
-32154,
-32258,
-32397,
-32514,
-32640,
-32720,
-32765,
-32784,
-32700,
-32645,
-32525,
-32501,
-32490,
-32560,
-32623,
-32677,
-32676,
-32670,
-32633,
-32620,
-32568,
-32523,
-32450,
-32425,
-32455,
-32575,
 32713,
-32833,
-32847,
-32783,
-32640,
-32502,
-32385,
-32330,
-32318,
-32323,
-32403,
-32469,
-32581,
-32644,
-32733,
-32746,
-32770,
-32726,
-32714,
-32622,
-32607,
-32565,
-32609,
-32677,
-32700,
-32692,
-32596,
-32461,
-32376,
-32342,
-32410,
-32529,
-32636,
-32731,
-32781,
-32795,
-32785,
-32721,
-32634,
-32535,
-32418,
-32384,
-32354,
-32411,
-32460,
-32525,
-32550,
-32561,
-32524,
-32481,
-32401,
-32319,
+32438,
+32399,
+32556,
+32476,
+32242,
+32205,
 32253,
-32178,
-32196,
-32180,
-32258,
-32266,
-32265,
-32176,
-32056,
-31889,
-31751,
-31655,
-31640,
-31680,
-31795,
-31906,
-32012,
-32041,
-31995,
-31912,
-31812,
-31763,
-31751,
-31773,
-31775,
-31769,
-31728,
-31756,
-31791,
-31881,
-31939,
-31944,
-31882,
-31780,
-31701,
-31645,
-31676,
-31691,
-31769,
-31737,
-31714,
-31560,
-31423,
-31271,
-31179,
-31199,
-31271,
-31407,
-31510,
-31588,
-31636,
-31666,
-31689,
-31698,
-31646,
-31647,
-31621,
-31688,
-31775,
-31819,
-31833,
-31773,
-31756,
-31796,
-31889,
-31987,
-31950,
-31844,
-31716,
-31693,
-31839,
-32029,
-32186,
-32165,
-32038,
-31906,
-31823,
-31880,
-31910,
+31901,
+31624,
+31925,
+31984,
+31776,
+31762,
+31761,
 31926,
-31853,
 31795,
-31823,
-31952,
-32146,
-32291,
-32327,
-32226,
-32068,
-31924,
-31873,
-31937,
-32073,
-32222,
-32288,
-32245,
-32088,
-31961,
-31892,
-32021,
-32192,
-32430,
-32508,
-32502,
-32417,
-32381,
-32391,
-32504,
-32518,
-32512,
-32433,
-32378,
-32448,
-32562,
-32733,
-32776,
-32750,
-32596,
-32506,
-32485,
-32612,
-32764,
-32916,
-32957,
-32916,
-32857,
-32819,
-32858,
-32946,
-33019,
-33036,
-32970,
-32892,
-32819,
+31654,
+31764,
+31406,
+31205,
+31494,
+31694,
+31627,
+31731,
+31770,
+31860,
+31887,
+31772,
+32108,
+31959,
+31869,
+31835,
+32116,
+32250,
+31855,
+32241,
+32072,
+32037,
+32480,
+32415,
+32493,
+32420,
+32698,
+32620,
+32602,
+32951,
+32832,
+33009,
+32893,
+32866,
 32823,
-32870,
-32890,
-32910,
-32821,
-32770,
-32742,
-32792,
-32895,
-32967,
-32941,
-32828,
-32663,
-32564,
-32550,
-32657,
+32814,
+32923,
+32578,
 32766,
-32887,
-32901,
-32950,
-32991,
-33171,
-33322,
-33505,
-33466,
-33341,
-33110,
-32959,
-32999,
-33209,
-33491,
-33706,
-33745,
-33640,
-33504,
-33408,
-33422,
-33500,
-33550,
-33581,
-33564,
-33542,
-33568,
-33564,
-33551,
-33451,
+32937,
+33356,
 33306,
-33180,
-33100,
-33150,
-33258,
-33420,
-33516,
-33579,
-33534,
-33467,
-33399,
-33391,
-33405,
-33495,
-33569,
+33031,
+33662,
+33538,
+33459,
+33588,
+33555,
+33318,
+33142,
+33526,
+33468,
+33417,
 33658,
-33778,
-33904,
-34074,
-34199,
-34274,
-34201,
-34075,
-33910,
-33835,
-33861,
-33991,
-34122,
-34203,
-34145,
-34003,
-33796,
-33584,
-33441,
-33343,
-33358,
-33389,
-33461,
-33460,
-33421,
-33352,
-33307,
-33299,
-33330,
-33302,
-33251,
-33116,
-33059,
-33116,
-33318,
-33579,
-33795,
-33840,
-33770,
-33626,
-33557,
-33512,
-33550,
-33513,
-33422,
-33290,
-33203,
-33235,
-33405,
-33573,
-33650,
-33563,
-33302,
-33050,
-32880,
-32935,
-33118,
-33325,
-33473,
-33426,
-33363,
-33230,
-33162,
-33159,
-33141,
-33142,
-33098,
-33013,
-32969,
-32950,
-33057,
-33239,
-33459,
-33584,
-33536,
-33268,
-32994,
-32748,
-32832,
-33056,
-33375,
-33481,
-33365,
-33089,
-32859,
-32861,
-33028,
-33265,
-33388,
-33309,
-33141,
-33017,
-33026,
-33180,
-33352,
-33423,
+34078,
+34198,
+33847,
+34108,
+34023,
+33407,
+33428,
+33387,
 33341,
-33191,
-33006,
-33024,
-33127,
-33372,
-33556,
-33622,
-33530,
-33335,
-33200,
-33158,
-33291,
-33430,
-33517,
-33418,
-33221,
-33017,
-32945,
-33059,
-33257,
-33393,
-33357,
-33102,
-32759,
-32521,
-32490,
-32736,
-33056,
+33197,
+33157,
+33751,
+33662,
+33526,
+33289,
+33406,
+33536,
+32916,
 33302,
-33356,
-33160,
-32905,
-32660,
-32585,
-32587,
-32652,
-32673,
-32696,
-32697,
-32781,
-32831,
-32827,
-32706,
-32492,
-32290,
-32251,
+33380,
+33114,
+33131,
+32913,
+33511,
+33222,
+32883,
+33417,
+32932,
+33212,
+33182,
+33154,
+33360,
+32999,
+33564,
+33334,
+33294,
+33409,
+32963,
+33389,
+32761,
+32739,
+33319,
+32708,
+32606,
+32750,
+32796,
+32319,
+32603,
+32680,
+31878,
+32308,
+32226,
+32003,
+32048,
+32066,
+32391,
+31967,
+32127,
+32361,
 32364,
-32615,
-32825,
-32854,
+32434,
+32230,
+32655,
+32709,
+32370,
+32530,
+32925,
+32668,
+32322,
+32809,
+32810,
+32570,
+32728,
+32804,
+32904,
+32900,
+32837,
+32914,
+33054,
+32904,
+32934,
+32922,
+32604,
+32737,
+32688,
 32684,
-32354,
-32045,
-31869,
-31913,
-32101,
-32309,
-32429,
-32378,
-32227,
-32072,
-31961,
-32007,
-32045,
-32111,
-32064,
-31996,
-31964,
-32046,
-32191,
-32377,
-32414,
+32638,
+32353,
+32518,
+32389,
+32521,
+32604,
+32395,
 32328,
-32121,
-31935,
-31886,
-31969,
-32147,
-32308,
-32365,
-32360,
-32296,
-32308,
-32359,
-32452,
-32489,
-32448,
-32329,
-32235,
-32209,
-32313,
-32498,
-32670,
-32788,
-32772,
+32087,
+32246,
+32315,
+32465,
+32491,
+32394,
+32699,
+32397,
+32519,
+32909,
+32503,
+32556,
+32683,
+32616,
+32638,
+32695,
+32564,
+32512,
+32548,
+32125,
+32216,
+32594,
+32511,
+32588,
+32604,
+32488,
+32526,
+32681,
+32516,
+32316,
+32681,
+32401,
+32326,
+32918,
+32685,
+32662,
+32849,
+32671,
+32725,
+32856,
+32964,
+32889,
+32841,
+32761,
+32715,
+33027,
+32846,
+32626,
+32864,
+32902,
+32882,
+32985,
+33213,
+33127,
+33068,
+33070,
+33144,
+33418,
+33297,
+33269,
+33308,
+33233,
+33318,
+33294,
+33461,
+33416,
+33114,
+33355,
+33184,
+33057,
+33055,
+32841,
+32822,
+32749,
+32829,
+32539,
+32664,
+32860,
+32472,
+32638,
+32997,
+32947,
+32876,
+33060,
+33002,
+32833,
+33163,
+33142,
+32837,
+33020,
+32810,
+32609,
+32916,
+32747,
+32553,
+32699,
+32687,
 32697,
-32557,
-32460,
-32378,
+33012,
+33091,
+32822,
+32820,
+32698,
+32687,
+32923,
+32959,
+32546,
+32417,
+32838,
+32737,
+32726,
+32775,
+32413,
+32467,
+32573,
+32375,
+32382,
 32383,
-32412,
-32522,
-32657,
-32827,
-32924,
-32956,
-32844,
-32663,
-32474,
-32325,
+32148,
+32157,
+32345,
+32279,
 32332,
-32432,
-32621,
-32806,
-32923,
-32900,
-32827,
-32672,
-32591,
 32563,
-32607,
-32680,
-32746,
-32756,
-32784,
-32775,
-32838,
-32878,
-32922,
+32418,
+32447,
+32939,
 32935,
-32900,
-32887,
-32867,
-32845,
-32869,
-32838,
-32873,
-32900,
-32958,
-33037,
-33056,
-33047,
-32969,
-32904,
-32852,
-32887,
-32929,
-32996,
-32985,
-32927,
-32795,
-32686,
-32605,
-32605,
-32660,
-32732,
-32768,
-32762,
-32692,
-32645,
-32635,
-32662,
-32736,
-32710,
-32663,
-32525,
+32797,
+32792,
+32675,
+32761,
+32784,
+32840,
+32782,
+32592,
+32615,
+32547,
+32999,
+33158,
+32875,
+33079,
+32936,
+32988,
+33263,
+33222,
+32919,
+32591,
+32458,
+32511,
+32682,
+32473,
+32285,
 32390,
-32346,
-32357,
-32462,
-32533,
-32528,
-32478,
-32372,
-32355,
-32401,
-32512,
-32641,
-32663,
-32622,
-32504,
-32406,
-32377,
-32391,
-32401,
-32356,
-32243,
-32117,
-32061,
-32081,
-32190,
-32275,
-32315,
-32302,
-32291,
-32311,
-32400,
-32491,
-32537,
-32544,
-32456,
+32175,
+32097,
 32411,
-32370,
-32423,
-32501,
-32609,
-32682,
-32653,
-32576,
-32412,
-32333,
-32324,
-32494,
-32713,
-32902,
-32951,
-32826,
-32620,
+32394,
+32223,
+32110,
+31992,
+32268,
+32404,
+32263,
+32267,
+32078,
+32213,
 32472,
-32411,
-32500,
-32583,
-32685,
-32651,
-32659,
-32613,
-32652,
-32643,
-32650,
-32615,
-32614,
-32627,
-32692,
-32704,
-32712,
-32633,
-32546,
-32492,
-32475,
-32530,
-32569,
-32599,
-32531,
-32426,
-32269,
-32133,
-32062,
-32087,
-32211,
-32376,
-32515,
-32612,
-32587,
-32562,
-32503,
-32488,
-32546,
-32588,
-32635,
-32637,
-32600,
-32554,
-32503,
-32500,
-32468,
-32519,
-32511,
-32589,
+32570,
+32407,
+32207,
+32518,
+32523,
+32432,
+32604,
+32451,
+32460,
+32517,
 32622,
-32676,
-32682,
-32632,
-32525,
-32390,
-32312,
-32303,
-32419,
-32564,
-32679,
-32708,
-32569,
-32414,
-32231,
-32218,
-32323,
-32546,
-32775,
-32921,
-32933,
-32821,
-32686,
-32582,
-32586,
-32661,
-32772,
-32847,
-32853,
-32792,
-32721,
-32661,
-32666,
-32683,
-32736,
-32772,
-32800,
-32858,
-32890,
-32949,
-32974,
-32964,
-32925,
-32882,
-32848,
-32845,
-32854,
-32834,
-32812,
-32750,
-32703,
-32688,
-32735,
-32795,
-32936,
-32998,
-33064,
-32973,
-32878,
-32698,
-32620,
-32607,
-32684,
-32804,
-32885,
-32914,
-32898,
-32878,
-32880,
-32885,
-32914,
-32902,
+32937,
 32928,
-32958,
-33048,
-33153,
-33239,
-33235,
-33199,
-33110,
-33059,
-33049,
-33074,
+32797,
+32464,
+32466,
+32526,
+32480,
+32406,
+32140,
+32300,
+32321,
+32440,
+32709,
+32914,
+32939,
+32739,
+33022,
 33102,
-33103,
-33057,
-33052,
-33060,
-33143,
-33258,
-33360,
-33434,
-33405,
-33365,
-33282,
-33248,
-33254,
-33280,
-33302,
-33321,
-33287,
-33275,
-33248,
-33246,
-33257,
-33286,
-33299,
-33316,
-33316,
-33304,
-33330,
-33371,
-33441,
-33514,
-33495,
-33443,
-33292,
-33163,
-33103,
-33138,
-33260,
-33354,
-33395,
-33320,
-33187,
-33064,
-33009,
-33053,
-33093,
-33150,
-33060,
-32983,
-32844,
-32814,
-32828,
-32859,
-32864,
+33161,
+33392,
+33188,
+33182,
+33406,
+33547,
+33522,
+33616,
+33650,
+33530,
+33764,
+33722,
+33690,
+34114,
+33905,
+33688,
+33847,
+33836,
+33996,
+34223,
+33984,
+33732,
+34036,
+34078,
+34100,
+34161,
+33983,
+33800,
+33696,
+33813,
+33670,
+33724,
+33636,
+33418,
+33686,
+33642,
+33624,
+33678,
+33483,
+33293,
+33259,
+33384,
+33175,
+33100,
+32980,
+32757,
+32932,
+32986,
+33043,
 32801,
-32726,
+32698,
+32806,
+32761,
 32717,
-32754,
-32846,
-32858,
-32807,
-32634,
-32516,
-32452,
-32540,
-32690,
-32832,
-32891,
-32839,
-32720,
-32577,
-32494,
-32450,
-32522,
-32625,
-32780,
-32910,
-32997,
-33034,
-32997,
-32953,
-32884,
-32871,
-32867,
-32932,
-32993,
-33063,
-33096,
-33061,
-33008,
-32904,
-32846,
-32839,
-32899,
-33023,
-33165,
-33237,
-33247,
-33142,
-33003,
-32890,
-32822,
-32876,
-32944,
-33035,
-33020,
-32954,
-32790,
-32684,
-32591,
-32620,
-32707,
-32807,
-32924,
-32917,
-32888,
-32738,
-32642,
-32545,
-32546,
-32593,
-32663,
-32714,
-32723,
-32688,
-32681,
-32649,
-32690,
-32708,
-32792,
-32869,
-32988,
-33095,
-33142,
-33128,
-33002,
-32885,
-32802,
-32770,
-32821,
-32841,
-32823,
-32766,
-32669,
-32640,
-32637,
-32708,
-32773,
-32861,
-32908,
-32965,
-32981,
+32489,
+32500,
+32130,
+31834,
+31794,
+31798,
+31957,
+31492,
+31252,
+31290,
+31279,
+31388,
+31376,
+31027,
+30790,
+30917,
+30757,
+30728,
+30641,
+30328,
+30264,
+30131,
+30331,
+30563,
+30440,
+30423,
+30202,
+30455,
+30653,
+30523,
+30493,
+30152,
+30292,
+30393,
+30401,
+30653,
+30681,
+30588,
+30854,
+31182,
+31380,
+31707,
+31705,
+31783,
+31999,
+32252,
+32650,
 32966,
-32871,
-32725,
-32548,
-32405,
-32353,
-32410,
-32555,
-32733,
-32839,
-32877,
-32810,
-32736,
-32668,
-32674,
-32736,
-32791,
-32827,
-32761,
-32670,
-32514,
-32423,
-32368,
-32389,
-32471,
-32541,
-32585,
-32582,
-32503,
-32446,
-32365,
-32357,
-32345,
-32393,
-32398,
-32420,
-32375,
-32320,
-32229,
-32150,
-32106,
-32096,
-32157,
-32227,
-32313,
-32348,
-32350,
-32314,
-32267,
-32258,
-32279,
-32339,
-32429,
-32497,
-32556,
-32555,
-32505,
-32429,
-32359,
-32359,
-32436,
-32597,
-32802,
-32933,
-33028,
-32996,
-32930,
-32854,
-32803,
-32808,
-32808,
-32823,
-32773,
-32756,
-32690,
-32691,
-32677,
-32728,
-32748,
-32788,
-32795,
-32783,
-32799,
-32797,
-32839,
-32859,
-32824,
-32803,
-32697,
-32639,
-32589,
-32582,
-32610,
-32610,
-32595,
-32563,
-32559,
-32613,
-32783,
-32970,
-33184,
-33225,
-33194,
-33017,
-32902,
-32844,
-32910,
-33040,
-33101,
-33104,
-32992,
-32915,
-32859,
-32923,
-33013,
-33125,
-33191,
-33240,
-33259,
-33273,
-33234,
-33176,
-33038,
-32912,
-32773,
-32668,
-32601,
-32544,
+33050,
+33103,
+33426,
+33825,
+34241,
+34605,
+34924,
+35040,
+35215,
+35612,
+35781,
+36110,
+36263,
+36223,
+36462,
+36733,
+36879,
+36962,
+37178,
+36935,
+36856,
+37077,
+36845,
+36855,
+36622,
+36083,
+35946,
+35797,
+35542,
+35319,
+34920,
+34518,
+34385,
+34203,
+33913,
+33676,
+33450,
+33131,
+32946,
+32988,
+32959,
+32867,
+32667,
 32494,
-32455,
-32436,
-32456,
-32515,
-32577,
-32664,
-32682,
-32657,
-32583,
-32455,
-32379,
-32297,
+32587,
+32561,
+32538,
+32528,
 32298,
-32312,
-32363,
-32384,
-32356,
-32294,
-32177,
-32094,
-32040,
-32096,
-32184,
-32334,
-32415,
-32464,
-32432,
-32377,
-32327,
-32279,
-32238,
-32200,
-32133,
-32097,
-32039,
-32028,
-32017,
-32043,
-32125,
-32235,
-32371,
-32433,
-32438,
-32357,
-32277,
-32229,
-32251,
-32294,
-32297,
-32232,
-32144,
-32027,
-32068,
-32104,
-32252,
-32332,
-32408,
-32453,
-32500,
-32545,
-32586,
-32573,
-32516,
-32391,
+32348,
+32388,
 32291,
-32201,
-32215,
-32294,
-32397,
-32524,
+32349,
+32183,
+32044,
+31965,
+31837,
+31889,
+31772,
+31641,
+31397,
+31078,
+30974,
+30603,
+30265,
+29875,
+29451,
+29137,
+28744,
+28454,
+28006,
+27682,
+27420,
+27018,
+26874,
+26669,
+26350,
+26237,
+25948,
+26076,
+26130,
+25718,
+25816,
+25810,
+26291,
+27638,
+28555,
+29451,
+31169,
+32646,
+34250,
+36233,
+37536,
+38704,
+39277,
+39451,
+40540,
+40944,
+40348,
+40012,
+39833,
+39796,
+39073,
+38627,
+38671,
+37956,
+37636,
+37149,
+36688,
+36592,
+35774,
+35238,
+34276,
+33599,
+33432,
+32268,
+31472,
+31015,
+30896,
+30541,
+29926,
+30207,
+30389,
+30614,
+30984,
+31192,
+32043,
+33025,
+33317,
+34217,
+34998,
+35501,
+36272,
+36275,
+36884,
+37538,
+37422,
+37336,
+37521,
+37360,
+36701,
+36591,
+36157,
+35198,
+34563,
+33961,
+33147,
+32786,
+32493,
+31770,
+31621,
+31537,
+31514,
+31878,
+31918,
+32292,
+32482,
+32284,
 32576,
-32571,
-32530,
-32450,
-32429,
-32432,
-32486,
-32562,
-32592,
-32599,
-32532,
-32463,
-32397,
-32417,
-32436,
-32514,
-32534,
-32528,
-32524,
-32518,
-32612,
-32722,
-32870,
-32964,
-32971,
-32959,
-32903,
-32881,
-32865,
-32804,
-32726,
-32574,
-32459,
-32387,
-32396,
-32464,
-32544,
-32552,
-32546,
-32476,
-32454,
-32464,
+32681,
+32420,
+31995,
+31613,
+31087,
+30454,
+30133,
+29614,
+29282,
+29038,
+28436,
+28341,
+27990,
+27578,
+27359,
+26693,
+25847,
+25161,
+24426,
+23872,
+23526,
+22717,
+21381,
+20533,
+19980,
+20335,
+23975,
+23653,
+24134,
+27986,
+29543,
+34077,
+36253,
+38073,
+40785,
+40647,
+41767,
+43792,
+45314,
+43545,
+42261,
+43075,
+42660,
+43265,
+42498,
+41233,
+41627,
+40849,
+40050,
+39360,
+38749,
+37522,
+34948,
+33041,
+32137,
+31802,
+29394,
+26645,
+26018,
+25693,
+25518,
+24937,
+25167,
+25793,
+26612,
+27776,
+28783,
+31009,
+32236,
+32480,
+33496,
+34901,
+36797,
+37525,
+37481,
+37971,
+38702,
+39360,
+39582,
+39936,
+39889,
+39287,
+39024,
+38812,
+38678,
+38101,
+36877,
+35690,
+34876,
+34471,
+33948,
+33531,
+32685,
+31913,
+32136,
+32479,
+32822,
+32793,
+32394,
+32446,
+32510,
+32376,
+32344,
+31934,
+31266,
+30721,
+30399,
+30250,
+30039,
+29508,
+28832,
+28561,
+28431,
+28191,
+27662,
+26886,
+26048,
+25204,
+24671,
+23847,
+23026,
+22261,
+21233,
+20969,
+20145,
+19253,
+18793,
+18417,
+20583,
+23007,
+24665,
+27018,
+30298,
+34227,
+37454,
+40526,
+42719,
+44202,
+44384,
+44476,
+46023,
+45674,
+44191,
+43294,
+43103,
+43504,
+43225,
+42769,
+42512,
+42302,
+41423,
+39906,
+38611,
+37119,
+34796,
+31551,
+29098,
+28128,
+26756,
+24792,
+23549,
+23663,
+24617,
+25582,
+26903,
+28540,
+30117,
+31707,
+32962,
+34434,
+35935,
+36436,
+36231,
+36268,
+37149,
+38044,
+38606,
+38736,
+38486,
+38760,
+39057,
+39211,
+39346,
+38789,
+38273,
+38077,
+37299,
+36783,
+36540,
+35103,
+33521,
+32655,
+32493,
+32247,
+31509,
+30911,
+30976,
+31731,
+32125,
+32190,
+32187,
+32105,
+31976,
+31781,
+31844,
+31705,
+31336,
+30726,
+30383,
+30754,
+30441,
+29866,
+29242,
+28454,
+27743,
+26686,
+25630,
+24446,
+23609,
+22453,
+21820,
+21564,
+20539,
+20348,
+19565,
+19010,
+18890,
+18208,
+17887,
+19350,
+21804,
+23604,
+27160,
+30692,
+34118,
+38080,
+40822,
+43867,
+45414,
+45104,
+44852,
+44589,
+43849,
+42680,
+42127,
+41385,
+41197,
+41845,
+42288,
+43167,
+43167,
+42539,
+41589,
+39864,
+37995,
+35128,
+31872,
+28925,
+26503,
+24623,
+23551,
+23669,
+24195,
+25372,
+27449,
+30196,
+32859,
+35007,
+36838,
+37752,
+38262,
+38265,
+37720,
+37088,
+35856,
+35054,
+34767,
+34955,
+35637,
+36210,
+36907,
+37297,
+37624,
+37772,
+37229,
+36642,
+35583,
+34208,
+33136,
 32490,
-32501,
-32429,
-32304,
-32172,
-32115,
-32145,
-32231,
-32337,
-32354,
-32334,
-32295,
-32300,
-32361,
-32464,
-32551,
-32641,
-32688,
-32765,
-32843,
-32914,
-32990,
-32979,
-32931,
-32850,
-32773,
-32746,
-32788,
-32885,
-33019,
-33107,
-33140,
-33117,
-33069,
-33077,
-33141,
-33268,
-33378,
-33407,
-33367,
-33251,
-33162,
-33135,
-33148,
-33207,
-33273,
-33300,
-33403,
-33439,
-33543,
-33561,
-33569,
-33526,
-33505,
-33515,
-33563,
-33638,
-33675,
-33679,
-33630,
-33575,
-33546,
-33550,
-33594,
-33657,
-33751,
-33802,
-33797,
-33740,
-33653,
-33628,
-33671,
-33821,
-33996,
-34132,
-34135,
-34068,
-33879,
-33764,
-33675,
-33700,
-33751,
-33816,
-33842,
-33852,
-33823,
-33839,
-33859,
-33919,
-34009,
-34093,
-34170,
-34205,
-34209,
-34115,
-34009,
-33843,
-33750,
-33721,
-33784,
-33920,
-34048,
-34106,
-34132,
-34061,
-34048,
-34039,
-34096,
-34161,
-34194,
-34166,
-34116,
-34013,
-33980,
-33918,
-33889,
-33814,
-33743,
-33679,
-33685,
-33716,
-33804,
-33817,
-33818,
-33723,
-33661,
-33629,
-33668,
-33733,
-33769,
-33735,
-33628,
-33515,
-33413,
-33430,
-33482,
-33604,
-33684,
-33722,
-33699,
-33640,
-33595,
-33591,
-33620,
-33683,
-33679,
-33694,
-33612,
-33565,
-33471,
-33418,
-33347,
-33300,
-33255,
-33237,
-33252,
-33306,
-33356,
-33387,
-33360,
-33271,
-33183,
-33103,
-33069,
-33101,
-33103,
-33077,
-33004,
-32857,
-32785,
-32739,
-32782,
-32879,
-32936,
-32995,
-32975,
-32966,
-33000,
-33015,
-33066,
-33010,
-32941,
-32781,
-32711,
-32639,
-32710,
-32751,
-32821,
-32813,
-32787,
-32755,
-32737,
-32766,
-32768,
-32736,
-32655,
-32541,
-32470,
-32463,
-32495,
-32511,
-32454,
-32326,
-32114,
-31966,
-31843,
-31828,
-31851,
-31840,
-31819,
-31740,
-31736,
-31776,
-31877,
-31979,
-31983,
-31863,
-31685,
-31454,
-31333,
-31264,
-31274,
-31298,
-31282,
-31290,
-31234,
-31281,
-31271,
-31349,
-31341,
-31402,
-31384,
-31409,
-31362,
-31315,
-31180,
-31038,
-30890,
-30788,
-30788,
-30818,
-30907,
-30921,
-30910,
-30814,
-30751,
-30703,
-30708,
-30742,
-30743,
-30722,
-30625,
-30520,
-30426,
-30323,
-30304,
-30261,
-30265,
-30223,
-30175,
-30140,
-30144,
-30205,
-30322,
-30446,
-30550,
-30569,
-30543,
-30472,
-30435,
-30419,
-30438,
-30423,
-30381,
-30276,
-30208,
-30195,
-30281,
-30449,
-30602,
-30689,
-30669,
-30593,
-30506,
-30506,
-30531,
-30570,
-30518,
-30397,
-30229,
-30120,
-30122,
-30193,
-30334,
-30392,
-30403,
-30373,
-30331,
-30362,
-30410,
-30516,
-30580,
-30651,
-30665,
-30696,
-30673,
-30670,
-30603,
-30613,
-30597,
-30711,
-30833,
-30997,
-31139,
-31184,
-31251,
-31259,
-31369,
-31482,
-31639,
-31724,
-31761,
-31715,
-31691,
-31672,
-31734,
-31797,
-31882,
-31933,
-31980,
-32049,
-32142,
-32267,
-32395,
-32523,
-32629,
-32772,
-32869,
-32980,
-33025,
-33059,
-33037,
-33049,
-33057,
-33094,
-33199,
-33285,
-33436,
-33556,
-33691,
-33834,
-33948,
-34116,
-34224,
-34381,
-34486,
-34622,
-34715,
-34822,
-34916,
-34982,
-35038,
-35054,
-35064,
-35104,
-35205,
-35344,
-35498,
-35625,
-35698,
-35731,
-35769,
-35855,
-35967,
-36124,
-36223,
-36275,
-36257,
-36232,
-36190,
-36226,
-36280,
-36378,
-36466,
-36563,
-36636,
-36719,
-36806,
-36858,
-36887,
-36900,
-36906,
-36966,
-37021,
-37135,
-37175,
-37179,
-37054,
-36945,
-36811,
-36809,
-36845,
-36961,
-37063,
-37080,
-37029,
-36928,
-36829,
-36818,
-36808,
-36879,
-36839,
-36794,
-36604,
-36425,
-36223,
-36085,
-36005,
-35969,
-35950,
-35910,
-35870,
-35785,
-35720,
-35622,
-35556,
-35470,
-35392,
-35312,
-35207,
-35089,
-34925,
-34770,
-34611,
-34510,
-34447,
-34420,
-34393,
-34360,
-34272,
-34197,
-34100,
-34009,
-33931,
-33820,
-33759,
-33652,
-33616,
-33531,
-33454,
-33362,
-33230,
-33140,
-33014,
-32994,
-32936,
-32964,
-32959,
-32987,
-32986,
-32990,
-32957,
-32935,
-32903,
-32860,
-32818,
-32748,
-32675,
-32580,
-32526,
-32483,
-32513,
-32540,
-32601,
-32592,
-32602,
-32560,
-32519,
-32542,
-32519,
-32572,
-32566,
-32514,
-32470,
-32355,
-32310,
-32270,
-32290,
-32355,
-32383,
-32423,
-32384,
-32346,
-32302,
-32286,
-32312,
-32337,
-32346,
-32334,
-32257,
-32183,
-32109,
-32061,
-32054,
-32025,
-32015,
-31957,
-31914,
-31857,
-31845,
-31838,
-31875,
-31882,
-31877,
-31843,
-31775,
-31715,
-31663,
-31640,
-31583,
-31534,
-31391,
-31278,
-31148,
-31063,
-31042,
-31013,
-30994,
-30881,
-30765,
-30588,
-30459,
-30355,
-30268,
-30170,
-30039,
-29880,
-29699,
-29565,
-29437,
-29361,
-29263,
-29150,
-29002,
-28853,
-28732,
-28635,
-28573,
-28465,
-28332,
-28163,
-27981,
-27868,
-27750,
-27707,
-27626,
-27524,
-27413,
-27262,
-27148,
-27020,
-26958,
-26895,
-26867,
-26833,
-26756,
-26681,
-26557,
-26439,
-26349,
-26300,
-26256,
-26242,
-26162,
-26058,
-25966,
-25894,
-25960,
-26053,
-26177,
-26236,
-26141,
-25986,
-25806,
-25683,
-25693,
-25780,
-25832,
-25875,
-25802,
-25786,
-25830,
-26000,
-26331,
-26717,
-27176,
-27611,
-28001,
-28328,
-28581,
-28793,
-29064,
-29431,
-29944,
-30559,
-31177,
-31746,
-32214,
-32643,
-33079,
-33622,
-34245,
-34961,
-35619,
-36244,
-36723,
-37153,
-37530,
-37931,
-38320,
-38723,
-38991,
-39215,
-39256,
-39293,
-39317,
-39465,
-39735,
-40118,
-40533,
-40842,
-41011,
-40948,
-40780,
-40537,
-40329,
-40202,
-40093,
-40038,
-39936,
-39862,
-39819,
-39830,
-39835,
-39827,
-39633,
-39397,
-39055,
-38804,
-38641,
-38644,
-38674,
-38739,
-38661,
-38491,
-38217,
-37960,
-37784,
-37662,
-37640,
-37541,
-37401,
-37167,
-36906,
-36741,
-36668,
-36690,
-36700,
-36613,
-36377,
-36071,
-35756,
-35537,
-35383,
-35250,
-35024,
-34682,
-34282,
-33897,
-33673,
-33585,
-33612,
-33597,
-33454,
-33108,
-32699,
-32246,
-31903,
-31660,
-31483,
-31331,
-31161,
-31010,
-30906,
-30874,
-30897,
-30883,
-30779,
-30549,
-30269,
-30011,
-29915,
-29945,
-30085,
-30238,
-30314,
-30359,
-30352,
-30404,
-30513,
-30640,
-30780,
-30885,
-30957,
-31014,
-31097,
-31208,
-31416,
-31670,
-32033,
-32407,
-32768,
-33037,
-33170,
-33251,
-33314,
-33501,
-33805,
-34196,
-34599,
-34858,
-35025,
-35117,
-35225,
-35479,
-35787,
-36113,
-36309,
-36341,
-36281,
-36235,
-36343,
-36571,
-36926,
-37216,
-37437,
-37508,
-37519,
-37485,
-37428,
-37400,
-37345,
-37335,
-37358,
-37421,
-37517,
-37571,
-37525,
-37375,
-37127,
-36876,
-36684,
-36603,
-36595,
-36606,
-36554,
-36402,
-36142,
-35836,
-35494,
-35206,
-34959,
-34740,
-34568,
-34375,
-34185,
-33954,
-33710,
-33406,
-33163,
-32938,
-32837,
-32768,
-32757,
-32655,
-32518,
-32241,
-31996,
-31745,
-31649,
-31599,
-31637,
-31636,
-31605,
-31520,
-31473,
-31456,
-31521,
-31639,
-31770,
-31871,
-31913,
-31930,
-31911,
-32002,
-32090,
-32285,
-32438,
-32526,
-32499,
-32398,
-32292,
-32261,
-32338,
-32461,
-32603,
-32677,
-32685,
-32656,
-32613,
-32536,
-32450,
-32305,
-32124,
-31982,
-31835,
-31743,
-31641,
-31483,
-31296,
-31065,
-30840,
-30636,
-30488,
-30331,
-30229,
-30110,
-29976,
-29827,
-29637,
-29458,
-29331,
-29248,
-29238,
-29179,
-29066,
-28845,
-28618,
-28416,
-28327,
-28323,
-28354,
-28320,
-28202,
-27983,
-27778,
-27624,
-27567,
-27559,
-27514,
-27381,
-27166,
-26893,
-26667,
-26416,
-26195,
-25905,
-25575,
-25310,
-25078,
-24939,
-24775,
-24515,
-24202,
-23906,
-23761,
-23750,
-23759,
-23657,
-23368,
-22974,
-22578,
-22245,
-21895,
-21531,
-21066,
-20675,
-20409,
-20291,
-20237,
-20061,
-19884,
-19848,
-20281,
-21311,
-22686,
-23983,
-24611,
-24451,
-23708,
-23061,
-23076,
-24037,
-25564,
-27118,
-28130,
-28551,
-28781,
-29382,
-30674,
-32462,
-34231,
-35445,
-35986,
-36134,
-36369,
-37059,
-38152,
-39357,
-40289,
-40759,
-40779,
-40687,
-40637,
-40849,
-41253,
-41794,
-42391,
-43047,
-43751,
-44479,
-45097,
-45335,
-45142,
-44431,
-43522,
-42705,
-42268,
-42259,
-42590,
-42912,
-43088,
-42985,
-42790,
-42640,
-42742,
-42986,
-43283,
-43335,
-43053,
-42502,
-41848,
-41395,
-41228,
-41334,
-41542,
-41636,
-41524,
-41218,
-40840,
-40481,
-40260,
-40048,
-39888,
-39618,
-39362,
-39090,
-38916,
-38741,
-38528,
-38147,
-37529,
-36728,
-35813,
-34920,
-34188,
-33535,
-33069,
-32643,
-32333,
-32135,
-32036,
-31970,
-31790,
-31339,
-30512,
-29436,
-28234,
-27262,
-26597,
-26286,
-26167,
-26079,
-25918,
-25755,
-25618,
-25619,
-25620,
-25598,
-25379,
-25124,
-24869,
-24828,
-24953,
-25215,
-25458,
-25625,
-25768,
-25931,
-26242,
-26616,
-27083,
-27441,
-27785,
-28011,
-28350,
-28778,
-29430,
-30210,
-30996,
-31670,
-32058,
-32269,
-32258,
-32331,
-32449,
-32756,
-33127,
-33519,
-33908,
-34345,
-34876,
-35516,
-36216,
-36809,
-37262,
-37461,
-37508,
-37460,
-37464,
-37484,
-37619,
-37763,
-37963,
-38185,
-38434,
-38701,
-38979,
-39195,
-39354,
-39464,
-39512,
-39586,
-39672,
-39812,
-39929,
-40029,
-39997,
-39895,
-39686,
-39490,
-39278,
-39162,
-39071,
-39020,
-38970,
-38891,
-38820,
-38752,
-38707,
-38668,
-38588,
-38408,
-38116,
-37727,
-37280,
-36873,
-36441,
-36090,
-35704,
-35369,
-35073,
-34846,
-34725,
-34605,
-34490,
-34336,
-34108,
-33946,
-33772,
-33667,
-33550,
-33338,
-33055,
-32668,
-32331,
-32034,
-31920,
-31917,
-32009,
-32150,
-32245,
-32381,
-32459,
-32603,
-32715,
-32835,
-32887,
-32875,
-32778,
-32651,
-32508,
-32405,
-32361,
-32371,
-32443,
-32492,
-32545,
-32513,
-32473,
-32396,
-32372,
-32362,
-32368,
-32353,
-32274,
-32127,
-31925,
-31704,
-31482,
-31270,
-31077,
-30880,
-30724,
-30577,
-30471,
-30404,
-30341,
-30303,
-30253,
-30193,
-30131,
-30031,
-29908,
-29739,
-29504,
-29274,
-29025,
-28825,
-28688,
-28608,
-28565,
-28533,
-28478,
-28438,
-28354,
-28295,
-28184,
-28062,
-27886,
-27665,
-27413,
-27139,
-26899,
-26605,
-26354,
-26043,
-25744,
-25460,
-25205,
-25004,
-24837,
-24668,
-24454,
-24162,
-23873,
-23512,
-23265,
-23007,
-22819,
-22568,
-22268,
-21892,
-21532,
-21229,
-21075,
-20998,
-20962,
-20827,
-20560,
-20158,
-19749,
-19428,
-19220,
-19138,
-19008,
-18824,
-18544,
-18353,
-18392,
-18831,
-19585,
-20609,
-21565,
-22408,
-23003,
-23516,
-24019,
-24644,
-25381,
-26199,
-27061,
-27976,
-29021,
-30242,
-31616,
-33003,
-34285,
-35400,
-36401,
-37398,
-38458,
-39552,
-40571,
-41435,
-42111,
-42686,
-43223,
-43771,
-44221,
-44489,
-44533,
-44370,
-44213,
-44211,
-44468,
-44982,
-45560,
-46038,
-46210,
-46073,
-45667,
-45138,
-44624,
-44205,
-43832,
-43558,
-43298,
-43099,
-43060,
-43067,
-43261,
-43414,
-43521,
-43509,
-43373,
-43204,
-43040,
-42895,
-42803,
-42666,
-42596,
-42480,
-42447,
-42391,
-42320,
-42131,
-41851,
-41406,
-40918,
-40402,
-39910,
-39453,
-39040,
-38603,
-38167,
-37683,
-37109,
-36471,
-35702,
-34791,
-33774,
-32664,
-31533,
-30564,
-29685,
-29108,
-28687,
-28394,
-28134,
-27786,
-27333,
-26754,
-26104,
-25420,
-24800,
-24244,
-23823,
-23554,
-23428,
-23477,
-23674,
-23931,
-24292,
-24611,
-24940,
-25254,
-25581,
-25960,
-26403,
-26898,
-27453,
-27985,
-28549,
-29060,
-29596,
-30117,
-30656,
-31195,
-31697,
-32171,
-32570,
-32976,
-33386,
-33873,
-34416,
-35011,
-35516,
-35964,
-36219,
-36374,
-36414,
-36402,
-36342,
-36251,
-36169,
-36153,
-36240,
-36484,
-36803,
-37175,
-37502,
-37779,
-38028,
-38246,
-38454,
-38621,
-38730,
-38760,
-38723,
-38632,
-38565,
-38490,
-38526,
-38596,
-38739,
-38901,
-39013,
-39088,
-39089,
-39120,
-39177,
-39303,
-39380,
-39381,
-39230,
-39017,
-38745,
-38557,
-38398,
-38315,
-38231,
-38155,
-38026,
-37878,
-37634,
-37341,
-37052,
-36824,
-36739,
-36740,
-36743,
-36582,
-36224,
-35672,
-35067,
-34466,
-33994,
-33550,
-33191,
-32857,
-32622,
-32508,
-32485,
-32524,
-32498,
-32421,
-32228,
-31997,
-31766,
-31505,
-31292,
-31087,
-30901,
-30826,
-30829,
-30974,
-31205,
-31483,
-31731,
-31933,
-32060,
-32114,
-32156,
-32173,
-32192,
-32205,
-32207,
-32176,
-32171,
-32121,
-32115,
-32069,
-32040,
-31973,
-31904,
-31831,
-31780,
-31778,
-31801,
-31840,
-31850,
-31798,
-31730,
-31573,
-31473,
-31310,
-31172,
-30970,
-30746,
-30527,
-30368,
-30375,
-30471,
-30651,
-30761,
-30781,
-30634,
-30440,
-30202,
-30024,
-29867,
-29711,
-29508,
-29244,
-28961,
-28674,
-28456,
-28226,
-28023,
-27758,
-27421,
-27061,
-26679,
-26314,
-25977,
-25629,
-25252,
-24865,
-24452,
-24116,
-23818,
-23583,
-23301,
-22929,
-22516,
-22070,
-21842,
-21744,
-21823,
-21808,
-21647,
-21238,
-20808,
-20456,
-20359,
-20389,
-20421,
-20259,
-19931,
-19513,
-19188,
-19031,
-19054,
-19066,
-19050,
-18873,
-18653,
-18397,
-18198,
-18029,
-17926,
-17923,
-18099,
-18572,
-19295,
-20230,
-21106,
-21861,
-22399,
-22899,
-23563,
-24524,
-25799,
-27184,
-28530,
-29672,
-30679,
-31665,
-32811,
-34109,
-35549,
-36897,
-38102,
-39057,
-39939,
-40796,
-41793,
-42858,
-43881,
-44715,
-45195,
-45421,
-45354,
-45250,
-45101,
-45014,
-44929,
-44859,
-44776,
-44673,
-44585,
-44426,
-44200,
-43868,
-43445,
-43022,
-42663,
-42426,
-42265,
-42146,
-41942,
-41680,
-41373,
-41166,
-41079,
-41214,
-41403,
-41665,
-41840,
-41985,
-42109,
-42278,
-42566,
-42851,
-43186,
-43319,
-43347,
-43167,
-42945,
-42709,
-42530,
-42319,
-42046,
-41607,
-41056,
-40438,
-39827,
-39279,
-38696,
-38036,
-37182,
-36190,
-35098,
-33986,
-32945,
-31888,
-30887,
-29869,
-28907,
-28015,
-27227,
-26513,
-25856,
-25210,
-24618,
-24115,
-23747,
-23549,
-23506,
-23550,
-23686,
-23804,
-23984,
-24182,
-24484,
-24876,
-25378,
-25978,
-26665,
-27441,
-28312,
-29235,
-30205,
-31135,
-32043,
-32848,
-33622,
-34317,
-35018,
-35662,
-36303,
-36823,
-37256,
-37559,
-37764,
-37932,
-38080,
-38240,
-38364,
-38387,
-38294,
-38097,
-37872,
-37689,
-37550,
-37367,
-37137,
-36719,
-36287,
-35814,
-35479,
-35236,
-35082,
-34953,
-34834,
-34747,
-34721,
-34816,
-34960,
-35205,
-35399,
-35627,
-35816,
-36020,
-36220,
-36450,
-36667,
-36893,
-37091,
-37208,
-37321,
-37379,
-37486,
-37610,
-37736,
-37814,
-37793,
-37638,
-37450,
-37199,
-37032,
-36842,
-36660,
-36385,
-36016,
-35569,
-35108,
-34625,
-34228,
-33820,
-33462,
-33137,
-32844,
-32645,
-32484,
-32401,
-32339,
-32294,
-32294,
-32324,
-32509,
-32772,
-33166,
-33565,
-33952,
-34217,
-34437,
-34550,
-34722,
-34935,
-35285,
-35721,
-36183,
-36589,
-36843,
-37014,
-37096,
-37276,
-37540,
-37874,
-38123,
-38131,
-37800,
-37239,
-36544,
-35965,
-35566,
-35326,
-35144,
-34831,
-34408,
-33762,
-33162,
-32568,
-32174,
-31882,
-31700,
-31494,
-31264,
-30954,
-30657,
-30396,
-30234,
-30158,
-30102,
-30118,
-30111,
-30210,
-30361,
-30606,
-30910,
-31245,
-31609,
-32018,
-32460,
-32901,
-33226,
-33394,
-33330,
-33123,
-32905,
-32721,
-32656,
-32601,
-32521,
-32344,
-32069,
-31726,
-31303,
-30839,
-30289,
-29635,
-28907,
-28100,
-27340,
-26565,
-25914,
-25275,
-24720,
-24114,
-23550,
-22923,
-22328,
-21804,
-21336,
-20990,
-20757,
-20560,
-20457,
-20375,
-20354,
-20410,
-20534,
-20707,
-20881,
-21012,
-21057,
-21088,
-21139,
-21334,
-21644,
-22038,
-22420,
-22668,
-22818,
-22824,
-22805,
-22771,
-22739,
-22686,
-22576,
-22390,
-22150,
-21887,
-21601,
-21378,
-21142,
-21013,
-20966,
-21067,
-21287,
-21591,
-21883,
-22160,
-22423,
-22749,
-23253,
-23952,
-24807,
-25745,
-26659,
-27601,
-28560,
-29715,
-30977,
-32404,
-33770,
-35051,
-36153,
-37143,
-38079,
-39087,
-40144,
-41244,
-42271,
-43141,
-43809,
-44249,
-44511,
-44612,
-44587,
-44462,
-44237,
-43974,
-43689,
-43455,
-43246,
-43028,
-42708,
-42261,
-41645,
-41000,
-40339,
-39814,
-39375,
-39041,
-38747,
-38512,
-38342,
-38271,
-38291,
-38353,
-38466,
-38562,
-38695,
-38863,
-39101,
-39404,
-39761,
-40178,
-40603,
-41074,
-41490,
-41886,
-42166,
-42323,
-42322,
-42135,
-41823,
-41374,
-40874,
-40393,
-39902,
-39459,
-38952,
-38356,
-37641,
-36754,
-35788,
-34679,
-33530,
-32320,
-31101,
-29982,
-28920,
-28054,
-27299,
-26672,
-26094,
-25540,
-25013,
-24527,
-24148,
-23891,
-23795,
-23847,
-24049,
-24384,
-24867,
-25445,
-26130,
-26825,
-27582,
-28285,
-29071,
-29849,
-30770,
-31686,
-32692,
-33617,
-34533,
-35410,
-36225,
-37022,
-37752,
-38374,
-38882,
-39236,
-39450,
-39519,
-39472,
-39326,
-39124,
-38858,
-38609,
-38305,
-38005,
-37661,
-37262,
-36844,
-36344,
-35813,
-35203,
-34588,
-33999,
-33464,
-33054,
-32705,
-32455,
-32229,
-32073,
-31963,
-31936,
-32001,
-32144,
-32346,
-32596,
-32888,
-33193,
-33554,
-33920,
-34309,
-34682,
-35025,
-35374,
-35692,
-36036,
-36338,
-36579,
-36724,
-36731,
-36664,
-36569,
-36447,
-36371,
-36250,
-36120,
-35894,
-35628,
-35283,
-34914,
-34495,
-34039,
-33612,
-33184,
-32832,
-32478,
-32172,
-31892,
-31671,
-31539,
-31535,
-31601,
-31747,
-31932,
-32132,
-32440,
-32866,
-33496,
-34271,
-35174,
-36000,
-36773,
-37343,
-37840,
-38257,
-38687,
-39102,
-39495,
-39810,
-40075,
-40221,
-40356,
-40375,
-40425,
-40422,
-40543,
-40590,
-40656,
-40390,
-39877,
-38975,
-38000,
-36983,
-36222,
-35562,
-35022,
-34400,
-33693,
-32930,
-32240,
-31684,
-31334,
-31143,
-31093,
-31092,
-31097,
-31027,
-30881,
-30686,
-30539,
-30508,
-30577,
-30688,
-30746,
-30751,
-30753,
-30882,
-31162,
-31584,
-32026,
-32407,
-32707,
-32886,
-32968,
-32889,
-32680,
-32315,
-31975,
-31655,
-31480,
-31287,
-31034,
-30615,
-30112,
-29563,
-29100,
-28675,
-28205,
-27722,
-27157,
-26660,
-26179,
-25799,
-25330,
-24907,
-24384,
-23951,
-23589,
-23317,
-23084,
-22867,
-22625,
-22451,
-22361,
-22359,
-22460,
-22620,
-22829,
-23131,
-23426,
-23752,
-23937,
-24036,
-24050,
-24042,
-24159,
-24358,
-24659,
-24923,
-25079,
-25143,
-25133,
-25197,
-25266,
-25333,
-25209,
-24847,
-24352,
-23798,
-23421,
-23082,
-22726,
-22114,
-21307,
-20476,
-19938,
-19810,
-20080,
-20458,
-20697,
-20750,
-20625,
-20678,
-20934,
-21488,
-22237,
-23095,
-24079,
-25208,
-26552,
-28071,
-29644,
-31141,
-32388,
-33410,
-34285,
-35129,
-36153,
-37295,
-38597,
-39805,
-40861,
-41611,
-42156,
-42494,
-42721,
-42753,
-42508,
-41992,
-41230,
-40500,
-39963,
-39751,
-39787,
-39887,
-39791,
-39447,
-38840,
-38169,
-37550,
-37154,
-36910,
-36938,
-37073,
-37491,
-38060,
-38853,
-39714,
-40555,
-41277,
-41841,
-42304,
-42751,
-43265,
-43870,
-44549,
-45266,
-45982,
-46709,
-47401,
-47974,
-48342,
-48406,
-48127,
-47519,
-46601,
-45511,
-44278,
-43105,
-42026,
-41098,
-40241,
-39309,
-38161,
-36806,
-35231,
-33665,
-32034,
-30489,
-28923,
-27510,
-26289,
-25491,
-25023,
-24853,
-24718,
-24534,
-24263,
-24085,
-24049,
-24318,
-24712,
-25246,
-25836,
-26513,
-27380,
-28380,
-29542,
-30672,
-31776,
-32722,
-33541,
-34260,
-34841,
-35347,
-35792,
-36109,
-36424,
-36619,
-36798,
-36878,
-36943,
-36871,
-36767,
-36414,
-35961,
-35278,
-34497,
-33652,
-32814,
-32053,
-31392,
-30824,
-30353,
-29985,
-29732,
-29540,
-29461,
-29349,
-29277,
-29181,
-29144,
-29210,
-29456,
-29868,
-30426,
-31094,
-31745,
-32488,
-33196,
-33940,
-34650,
-35273,
-35808,
-36185,
-36529,
-36807,
-37146,
-37476,
-37832,
-38106,
-38307,
-38332,
-38219,
-37943,
-37545,
-37047,
-36486,
-35880,
-35231,
-34608,
-34017,
-33588,
-33294,
-33162,
-33081,
-32978,
-32755,
-32457,
-32126,
-31821,
-31655,
-31593,
-31662,
-31879,
-32199,
-32666,
-33195,
-33756,
-34296,
-34786,
-35300,
-35864,
-36565,
-37384,
-38203,
-38943,
-39455,
-39786,
-39971,
-40132,
-40281,
-40427,
-40423,
-40239,
-39886,
-39434,
-39021,
-38703,
-38455,
-38256,
-37995,
-37654,
-37238,
-36727,
-36186,
-35569,
-34930,
-34243,
-33542,
-32836,
-32166,
-31563,
-31112,
-30757,
-30551,
-30398,
-30348,
-30324,
-30434,
-30596,
-30800,
-30966,
-31019,
-30908,
-30770,
-30553,
-30443,
-30360,
-30339,
-30319,
-30338,
-30384,
-30490,
-30640,
-30779,
-30856,
-30886,
-30858,
-30838,
-30823,
-30805,
-30752,
-30629,
-30448,
-30254,
-30066,
-29966,
-29902,
-29920,
-29925,
-29936,
-29935,
-29941,
-30057,
-30265,
-30613,
-30948,
-31230,
-31294,
-31260,
-31068,
-30891,
-30666,
-30404,
-30018,
-29577,
-29129,
-28871,
-28781,
-28884,
-28987,
-28995,
-28806,
-28530,
-28131,
-27791,
-27354,
-26929,
-26392,
-25866,
-25418,
-25107,
-24997,
-24997,
-25035,
-25058,
-24997,
-24940,
-24944,
-24988,
-25119,
-25164,
-25189,
-25083,
-24915,
-24630,
-24217,
-23672,
-23124,
-22609,
-22225,
-21811,
-21193,
-20332,
-19347,
-18612,
-18422,
-18821,
-19509,
-20069,
-20153,
-19845,
-19365,
-19085,
-19135,
-19497,
-20049,
-20816,
-21796,
-23125,
-24696,
-26353,
-27902,
-29195,
-30315,
-31350,
-32410,
-33556,
-34664,
-35725,
-36606,
-37350,
-37970,
-38533,
-39117,
-39661,
-40108,
-40278,
-40101,
-39626,
-39066,
-38727,
-38792,
-39227,
-39834,
-40213,
-40297,
-39981,
-39591,
-39209,
-39096,
-39122,
-39413,
-39838,
-40581,
-41555,
-42741,
-43955,
-45042,
-45877,
-46533,
-47017,
-47498,
-47934,
-48347,
-48682,
-48917,
-49039,
-49081,
-49047,
-48929,
-48678,
-48261,
-47529,
-46533,
-45145,
-43612,
-41908,
-40354,
-38857,
-37594,
-36389,
-35231,
-34018,
-32728,
-31366,
-29969,
-28590,
-27278,
-26163,
-25289,
-24798,
-24674,
-24923,
-25389,
-25949,
-26466,
-26908,
-27337,
-27788,
-28379,
-29033,
-29753,
-30461,
-31146,
-31826,
-32576,
-33379,
-34202,
-34980,
-35598,
-36003,
-36255,
-36300,
-36317,
-36165,
-35983,
-35668,
-35311,
-34967,
-34681,
-34503,
-34350,
-34139,
-33813,
-33327,
-32764,
-32224,
-31752,
-31449,
-31245,
-31197,
-31216,
-31366,
-31559,
-31838,
-32118,
-32408,
-32633,
-32848,
-33032,
-33241,
-33498,
-33826,
-34222,
-34691,
-35190,
-35733,
-36256,
-36758,
-37140,
-37375,
-37452,
-37351,
-37129,
-36828,
-36524,
-36215,
-36011,
-35812,
-35662,
-35485,
-35229,
-34921,
-34504,
-34072,
-33586,
-33115,
-32611,
-32122,
-31701,
-31357,
-31206,
-31172,
-31290,
-31435,
-31577,
-31637,
-31665,
-31636,
-31658,
-31754,
-31937,
-32228,
-32582,
-32982,
-33411,
-33813,
-34228,
-34547,
-34863,
-35063,
-35241,
-35359,
-35525,
-35746,
-36115,
-36599,
-37137,
-37643,
-37936,
-37998,
-37822,
-37526,
-37231,
-37011,
-36819,
-36652,
-36365,
-36024,
-35619,
-35275,
-35000,
-34843,
-34686,
-34528,
-34255,
-33881,
-33409,
-32887,
-32429,
-32010,
-31716,
-31428,
-31169,
-30848,
-30535,
-30261,
-30132,
-30147,
-30306,
-30563,
-30802,
-31065,
-31270,
-31426,
-31515,
-31512,
-31472,
-31463,
-31553,
-31734,
-32013,
-32206,
-32372,
-32436,
-32524,
-32625,
-32783,
-32935,
-33034,
-33121,
-33159,
-33219,
-33204,
-33146,
-32974,
-32791,
-32643,
-32552,
-32536,
-32421,
-32270,
-31974,
-31690,
-31407,
-31168,
-30944,
-30740,
-30571,
-30491,
-30440,
-30418,
-30288,
-29999,
-29597,
-29089,
-28654,
-28312,
-28115,
-28046,
-28047,
-28097,
-28118,
-28029,
-27835,
-27484,
-27076,
-26701,
-26440,
-26329,
-26341,
-26411,
-26431,
-26428,
-26369,
-26366,
-26358,
-26301,
-26073,
-25650,
-25109,
-24613,
-24235,
-23923,
-23460,
-22691,
-21669,
-20586,
-19726,
-19160,
-18737,
-18240,
-17504,
-16717,
-16090,
-15832,
-15945,
-16173,
-16373,
-16466,
-16614,
-16956,
-17565,
-18268,
-18982,
-19642,
-20463,
-21699,
-23546,
-25875,
-28327,
-30381,
-31763,
-32470,
-32884,
-33385,
-34258,
-35314,
-36318,
-36861,
-36914,
-36651,
-36400,
-36391,
-36656,
-36942,
-37096,
-36933,
-36593,
-36308,
-36231,
-36556,
-37077,
-37765,
-38358,
-38931,
-39372,
-39870,
-40334,
-40900,
-41536,
-42414,
-43610,
-45205,
-47100,
-49070,
-50796,
-52049,
-52733,
-52945,
-52891,
-52702,
-52488,
-52131,
-51639,
-50859,
-49972,
-48937,
-47871,
-46684,
-45298,
-43689,
-41882,
-40034,
-38218,
-36559,
-35006,
-33597,
-32311,
-31221,
-30360,
-29689,
-29166,
-28700,
-28256,
-27857,
-27513,
-27277,
-27205,
-27383,
-27896,
-28763,
-29930,
-31178,
-32304,
-33131,
-33623,
-33847,
-33928,
-33931,
-33914,
-33836,
-33707,
-33553,
-33332,
-33107,
-32793,
-32386,
-31894,
-31393,
-30922,
-30610,
-30386,
-30258,
-30147,
-30008,
-29907,
-29912,
-30120,
-30538,
-31081,
-31670,
-32160,
-32573,
-32926,
-33286,
-33718,
-34208,
-34728,
-35259,
-35761,
-36254,
-36688,
-37041,
-37245,
-37248,
-37066,
-36659,
-36166,
-35569,
-34993,
-34460,
-33995,
-33657,
-33385,
-33290,
-33226,
-33288,
-33348,
-33441,
-33483,
-33553,
-33601,
-33695,
-33838,
-33979,
-34192,
-34371,
-34646,
-34897,
-35152,
-35389,
-35454,
-35457,
-35259,
-35018,
-34737,
-34482,
-34255,
-34069,
-33838,
-33596,
-33297,
-32985,
-32675,
-32379,
-32109,
-31876,
-31687,
-31550,
-31483,
-31483,
-31603,
-31840,
-32263,
-32799,
-33511,
-34237,
-34973,
-35600,
-36102,
-36501,
-36860,
-37274,
-37832,
-38551,
-39311,
-40004,
-40346,
-40420,
-40176,
-39966,
-39861,
-39969,
-40077,
-39938,
-39361,
-38367,
-37191,
-36131,
-35419,
-35074,
-34916,
-34722,
-34270,
-33588,
-32725,
-31911,
-31292,
-30897,
-30734,
-30669,
-30632,
-30595,
-30546,
-30594,
-30719,
-31052,
-31464,
-32030,
-32588,
-33108,
-33488,
-33640,
-33646,
-33501,
-33411,
-33447,
-33627,
-33925,
-34099,
-34075,
-33766,
-33272,
-32721,
-32286,
-31954,
-31756,
-31523,
-31285,
-30944,
-30578,
-30202,
-29833,
-29514,
-29273,
-29113,
-29018,
-28993,
-28945,
-28925,
-28920,
-28983,
-29174,
-29485,
-29855,
-30242,
-30529,
-30709,
-30754,
-30703,
-30586,
-30460,
-30319,
-30169,
-29950,
-29667,
-29297,
-28881,
-28508,
-28104,
-27737,
-27286,
-26749,
-26214,
-25706,
-25350,
-25103,
-24946,
-24748,
-24581,
-24432,
-24511,
-24715,
-25110,
-25420,
-25637,
-25712,
-25765,
-25904,
-26154,
-26328,
-26269,
-25792,
-24968,
-24038,
-23251,
-22783,
-22373,
-21832,
-20745,
-19280,
-17689,
-16465,
-15893,
-15918,
-16181,
-16303,
-16027,
-15500,
-15002,
-14852,
-15204,
-16007,
-17143,
-18499,
-20100,
-21958,
-24026,
-26169,
-28122,
-29732,
-30972,
-31967,
-32959,
-34004,
-35029,
-35836,
-36276,
-36319,
-36209,
-36119,
-36217,
-36418,
-36516,
-36347,
-35854,
-35253,
-34802,
-34765,
-35216,
-35949,
-36848,
-37522,
-38084,
-38464,
-38918,
-39550,
-40480,
-41698,
-43221,
-44974,
-46867,
-48768,
-50455,
-51835,
-52781,
-53391,
-53657,
-53746,
-53618,
-53252,
-52647,
-51703,
-50565,
-49159,
-47696,
-46095,
-44479,
-42778,
-41005,
-39229,
-37461,
-35810,
-34347,
-33097,
-32163,
-31489,
-31136,
-30967,
-30945,
-30957,
-30927,
-30901,
-30880,
-30939,
-31143,
-31489,
-32051,
-32756,
-33614,
-34403,
-35068,
-35428,
-35449,
-35267,
-34852,
-34461,
-33930,
-33355,
-32587,
-31720,
-30754,
-29853,
-28998,
-28268,
-27600,
-27019,
-26571,
-26294,
-26320,
-26571,
-27125,
-27768,
-28556,
-29353,
-30279,
-31242,
-32316,
-33354,
-34331,
-35164,
-35882,
-36531,
-37122,
-37669,
-38108,
-38419,
-38583,
-38646,
-38631,
-38595,
-38451,
-38196,
-37743,
-37118,
-36361,
-35540,
-34775,
-34031,
-33470,
-32999,
-32716,
-32646,
-32742,
-33084,
-33539,
-34094,
-34670,
-35229,
-35802,
-36394,
-37047,
-37664,
-38268,
-38698,
-39004,
-39097,
-39043,
-38845,
-38506,
-38038,
-37403,
-36654,
-35763,
-34867,
-33951,
-33096,
-32331,
-31647,
-31129,
-30673,
-30359,
-30034,
-29778,
-29526,
-29378,
-29381,
-29607,
-30018,
-30578,
-31175,
-31777,
-32374,
-33007,
-33740,
-34518,
-35326,
-35976,
-36472,
-36726,
-36872,
-36959,
-37016,
-37028,
-36848,
-36481,
-35932,
-35322,
-34855,
-34570,
-34483,
-34423,
-34259,
-33917,
-33479,
-33069,
-32823,
-32768,
-32793,
-32819,
-32738,
-32627,
-32591,
-32701,
-32980,
-33278,
-33526,
-33598,
-33584,
-33582,
-33688,
-33963,
-34386,
-34808,
-35161,
-35326,
-35266,
-34981,
-34536,
-34005,
-33472,
-33001,
-32608,
-32305,
-32002,
-31719,
-31409,
-31116,
-30930,
-30867,
-30988,
-31204,
-31436,
-31574,
-31580,
-31480,
-31336,
-31276,
-31303,
-31471,
-31688,
-31937,
-32115,
-32238,
-32291,
-32296,
-32300,
-32337,
-32415,
-32616,
-32825,
-33091,
-33205,
-33225,
-33019,
-32707,
-32332,
-31973,
-31702,
-31477,
-31309,
-31154,
-30985,
-30811,
-30582,
-30306,
-29962,
-29599,
-29217,
-28924,
-28638,
-28396,
-28090,
-27720,
-27340,
-27028,
-26928,
-26981,
-27183,
-27257,
-27148,
-26772,
-26320,
-26015,
-26032,
-26343,
-26742,
-26831,
-26401,
-25426,
-24148,
-22965,
-22163,
-21762,
-21519,
-21031,
-20015,
-18442,
-16638,
-15026,
-13971,
-13583,
-13615,
-13789,
-13772,
-13585,
-13341,
-13327,
-13672,
-14437,
-15471,
-16813,
-18343,
-20153,
-22126,
-24042,
-25736,
-26981,
-27929,
-28706,
-29634,
-30650,
-31711,
-32474,
-32813,
-32779,
-32628,
-32794,
-33373,
-34358,
-35338,
-35973,
-36032,
-35684,
-35228,
-35152,
-35628,
-36697,
-38106,
-39562,
-40864,
-41903,
-42728,
-43430,
-44158,
-45063,
-46216,
-47649,
-49279,
-50895,
-52323,
-53306,
-53781,
-53748,
-53362,
-52775,
-52118,
-51401,
-50593,
-49553,
-48342,
-46910,
-45503,
-44190,
-43118,
-42240,
-41456,
-40665,
-39755,
-38738,
-37702,
-36720,
-35955,
-35438,
-35204,
-35188,
-35319,
-35438,
-35459,
-35256,
-34829,
-34238,
-33590,
-33037,
-32617,
-32409,
-32297,
-32226,
-32005,
-31649,
-31001,
-30291,
-29473,
-28783,
-28152,
-27605,
-27017,
-26336,
-25655,
-24997,
-24662,
-24556,
-24757,
-25084,
-25441,
-25824,
-26253,
-26791,
-27477,
-28247,
-29063,
-29858,
-30645,
-31452,
-32264,
-33060,
-33760,
-34306,
-34712,
-34971,
-35160,
-35329,
-35477,
-35647,
-35749,
-35840,
-35881,
-35907,
-35975,
-36007,
-36104,
-36145,
-36198,
-36245,
-36292,
-36397,
-36502,
-36676,
-36907,
-37215,
-37676,
-38238,
-38908,
-39583,
-40144,
-40578,
-40813,
-40911,
-40929,
-40917,
-40901,
-40823,
-40673,
-40338,
-39894,
-39286,
-38609,
-37857,
-37070,
-36212,
-35346,
-34434,
-33634,
-32913,
-32427,
-32110,
-31970,
-31944,
-31965,
-32045,
-32088,
-32207,
-32323,
-32513,
-32768,
-33032,
-33299,
-33474,
-33593,
-33634,
-33686,
-33751,
-33830,
-33822,
-33671,
-33326,
-32839,
-32341,
-31912,
-31632,
-31440,
-31237,
-30964,
-30566,
-30184,
-29900,
-29888,
-30173,
-30682,
-31270,
-31756,
-32013,
-32071,
-31964,
-31896,
-31909,
-32059,
-32255,
-32452,
-32500,
-32473,
-32303,
-32153,
-31954,
-31839,
-31740,
-31743,
-31840,
-31986,
-32214,
-32374,
-32464,
-32462,
-32353,
-32279,
-32189,
-32206,
-32231,
-32317,
-32375,
-32466,
-32599,
-32784,
-33109,
-33499,
-33941,
-34326,
-34568,
-34586,
-34411,
-34072,
-33660,
-33302,
-33018,
-32832,
-32724,
-32615,
-32487,
-32340,
-32197,
-32140,
-32164,
-32301,
-32453,
-32642,
-32754,
-32877,
-32933,
-33014,
-33071,
-33125,
-33167,
-33155,
-33077,
-32913,
-32616,
-32234,
-31736,
-31215,
-30717,
-30259,
-29838,
-29351,
-28778,
-28018,
-27123,
-26159,
-25256,
-24512,
-24019,
-23740,
-23679,
-23748,
-23949,
-24221,
-24577,
-24894,
-25135,
-25218,
-25177,
-25137,
-25162,
-25294,
-25402,
-25235,
-24729,
-23822,
-22805,
-21916,
-21315,
-20928,
-20491,
-19734,
-18585,
-17206,
-16013,
-15261,
-15039,
-15113,
-15101,
-14802,
-14254,
-13822,
-13836,
-14512,
-15726,
-17213,
-18809,
-20446,
-22316,
-24481,
-26845,
-29139,
-30929,
-32076,
-32585,
-32838,
-33088,
-33551,
-34034,
-34388,
-34353,
-34072,
-33691,
-33578,
-33742,
-34126,
-34472,
-34619,
-34692,
-34905,
-35534,
-36671,
-38125,
-39669,
-41027,
-42099,
-42896,
-43537,
-44130,
-44831,
-45744,
-46906,
-48392,
-49975,
-51551,
-52846,
-53647,
-53941,
-53641,
-52963,
-51952,
-50874,
-49770,
-48736,
-47724,
-46683,
-45558,
-44418,
-43250,
-42242,
-41331,
-40609,
-39971,
-39421,
-39011,
-38742,
-38660,
-38702,
-38835,
-38971,
-39099,
-39147,
-39042,
-38706,
-38011,
-37007,
-35792,
-34533,
-33431,
-32483,
-31746,
-31068,
-30451,
-29802,
-29076,
-28290,
-27379,
-26492,
-25670,
-25078,
-24702,
-24531,
-24466,
-24482,
-24607,
-24896,
-25384,
-26046,
-26767,
-27434,
-28054,
-28623,
-29270,
-30014,
-30877,
-31764,
-32657,
-33435,
-34078,
-34550,
-34850,
-34973,
-35003,
-34930,
-34869,
-34799,
-34817,
-34875,
-35042,
-35276,
-35586,
-35958,
-36370,
-36805,
-37242,
-37693,
-38088,
-38474,
-38824,
-39162,
-39514,
-39901,
-40340,
-40804,
-41247,
-41658,
-41950,
-42133,
-42167,
-42028,
-41763,
-41354,
-40914,
-40433,
-40006,
-39608,
-39248,
-38878,
-38489,
-38039,
-37545,
-36992,
-36404,
-35777,
-35154,
-34588,
-34089,
-33772,
-33548,
-33515,
-33550,
-33654,
-33733,
-33737,
-33669,
-33511,
-33359,
-33181,
-33111,
-33039,
-33003,
-32851,
-32584,
-32168,
-31750,
-31336,
-31049,
-30772,
-30484,
-30051,
-29570,
-29144,
-28922,
-28968,
-29183,
-29449,
-29619,
-29743,
-29946,
-30383,
-31098,
-31935,
-32635,
-32957,
-32820,
-32406,
-31990,
-31823,
-31952,
-32192,
-32295,
-32031,
-31517,
-30869,
-30484,
-30427,
-30711,
-31094,
-31361,
-31455,
-31420,
-31485,
-31763,
-32235,
-32768,
-33140,
-33264,
-33217,
-33106,
-33101,
-33247,
-33464,
-33683,
-33875,
-34019,
-34218,
-34456,
-34686,
-34807,
-34720,
-34455,
-34086,
-33758,
-33530,
-33429,
-33298,
-33122,
-32770,
-32399,
-32064,
-31954,
-32056,
-32365,
-32693,
-32976,
-33055,
-33025,
-32857,
-32723,
-32599,
-32613,
-32617,
-32709,
-32683,
-32542,
-32212,
-31648,
-30949,
-30139,
-29366,
-28686,
-28192,
-27838,
-27595,
-27370,
-27042,
-26595,
-25978,
-25291,
-24573,
-23959,
-23472,
-23123,
-22969,
-22887,
-22944,
-23031,
-23184,
-23346,
-23592,
-23844,
-24210,
-24537,
-24892,
-25122,
-25234,
-25178,
-24969,
-24564,
-24018,
-23324,
-22564,
-21791,
-21052,
-20301,
-19509,
-18579,
-17624,
-16681,
-16004,
-15564,
-15458,
-15560,
-15766,
-16101,
-16438,
-16874,
-17335,
-17833,
-18490,
-19378,
-20715,
-22559,
-24788,
-27149,
-29209,
-30678,
-31423,
-31590,
-31454,
-31296,
-31275,
-31314,
-31337,
-31161,
-30869,
-30555,
-30368,
-30431,
-30615,
-30838,
-30928,
-30943,
-31041,
-31483,
-32427,
-33887,
-35664,
-37519,
-39188,
-40570,
-41658,
-42537,
-43281,
-44031,
-44876,
-45952,
-47300,
-48825,
-50287,
-51391,
-51870,
-51656,
-50888,
-49773,
-48633,
-47641,
-46844,
-46242,
-45692,
-45136,
-44477,
-43797,
-43111,
-42624,
-42346,
-42356,
-42522,
-42727,
-42859,
-42849,
-42770,
-42635,
-42599,
-42582,
-42607,
-42512,
-42154,
-41441,
-40282,
-38749,
-36985,
-35202,
-33622,
-32289,
-31280,
-30457,
-29809,
-29195,
-28676,
-28098,
-27545,
-26963,
-26445,
-26103,
-26036,
-26236,
-26689,
-27181,
-27722,
-28178,
-28652,
-29139,
-29639,
-30097,
-30473,
-30703,
-30886,
-31046,
-31246,
-31506,
-31739,
-31946,
-32038,
-32075,
-32023,
-31950,
-31919,
-31935,
-32082,
-32323,
-32696,
-33181,
-33739,
-34370,
-35014,
-35680,
-36350,
-37010,
-37661,
-38267,
-38780,
-39153,
-39387,
-39435,
-39453,
-39377,
-39390,
-39409,
-39485,
-39538,
-39558,
-39539,
-39499,
-39446,
-39418,
-39389,
-39375,
-39388,
-39427,
-39529,
-39651,
-39775,
-39833,
-39812,
-39649,
-39439,
-39089,
-38745,
-38287,
-37828,
-37326,
-36870,
-36488,
-36223,
-36039,
-35915,
-35722,
-35441,
-35064,
-34654,
-34303,
-34111,
-34034,
-34061,
-34017,
-33878,
-33635,
-33411,
-33286,
-33356,
-33542,
-33750,
-33863,
-33793,
-33599,
-33322,
-33093,
-32957,
-32947,
-32998,
-33060,
-33009,
-32834,
-32512,
-32166,
-31914,
-31918,
-32216,
-32749,
-33245,
-33495,
-33228,
-32569,
-31660,
-30979,
-30629,
-30774,
-31058,
-31266,
-31177,
-30828,
-30514,
-30400,
-30681,
-31231,
-31917,
-32605,
-33205,
-33750,
-34175,
-34488,
-34588,
-34491,
-34238,
-33930,
-33705,
-33561,
-33464,
-33294,
-33006,
-32617,
-32305,
-32158,
-32292,
-32579,
-32817,
-32814,
-32434,
-31861,
-31225,
-30907,
-30924,
-31297,
-31791,
-32126,
-32251,
-32113,
-31908,
-31806,
-31840,
-32047,
-32261,
-32441,
-32469,
-32422,
-32254,
-32071,
-31867,
-31673,
-31505,
-31357,
-31206,
-31003,
-30643,
-30123,
-29394,
-28618,
-27833,
-27245,
-26808,
-26536,
-26306,
-26023,
-25629,
-25147,
-24648,
-24169,
-23844,
-23705,
-23796,
-24092,
-24448,
-24744,
-24890,
-24902,
-24919,
-24998,
-25137,
-25210,
-25105,
-24847,
-24544,
-24323,
-24185,
-23958,
-23477,
-22704,
-21820,
-21070,
-20578,
-20275,
-19835,
-19158,
-18155,
-17172,
-16461,
-16234,
-16474,
-16900,
-17435,
-17783,
-18196,
-18562,
-19144,
-19944,
-20993,
-22306,
-23856,
-25507,
-27167,
-28556,
-29495,
-29895,
-29766,
-29377,
-28879,
-28491,
-28166,
-27870,
-27485,
-27102,
-26758,
-26719,
-26960,
-27559,
-28240,
-28937,
-29568,
-30181,
-31023,
-32151,
-33688,
-35487,
-37361,
-39133,
-40623,
-41821,
-42729,
-43417,
-44051,
-44700,
-45545,
-46645,
-47920,
-49197,
-50166,
-50504,
-50186,
-49202,
-47965,
-46817,
-46026,
-45696,
-45575,
-45514,
-45245,
-44781,
-44253,
-43780,
-43561,
-43556,
-43781,
-44125,
-44493,
-44825,
-44964,
-44937,
-44685,
-44369,
-44017,
-43685,
-43264,
-42581,
-41539,
-40065,
-38322,
-36451,
-34737,
-33234,
-32111,
-31242,
-30630,
-30151,
-29732,
-29343,
-28901,
-28491,
-28125,
-27948,
-27974,
-28250,
-28614,
-28975,
-29182,
-29230,
-29180,
-29155,
-29158,
-29167,
-29066,
-28822,
-28479,
-28141,
-27908,
-27788,
-27771,
-27752,
-27724,
-27714,
-27700,
-27768,
-27839,
-28018,
-28289,
-28812,
-29508,
-30450,
-31388,
-32360,
-33147,
-33930,
-34589,
-35329,
-36014,
-36671,
-37201,
-37525,
-37671,
-37645,
-37511,
-37374,
-37209,
-37109,
-36998,
-36908,
-36838,
-36778,
-36817,
-36928,
-37131,
-37440,
-37751,
-38213,
-38640,
-39210,
-39725,
-40218,
-40581,
-40816,
-40970,
-41035,
-41090,
-41050,
-40928,
-40639,
-40264,
-39809,
-39402,
-39031,
-38714,
-38359,
-37981,
-37521,
-37130,
-36838,
-36717,
-36741,
-36767,
-36775,
-36653,
-36499,
-36373,
-36351,
-36463,
-36634,
-36787,
-36867,
-36826,
-36739,
-36539,
-36381,
-36134,
-35912,
-35662,
-35369,
-35065,
-34673,
-34225,
-33711,
-33218,
-32815,
-32600,
-32631,
-32876,
-33185,
-33415,
-33290,
-32806,
-31989,
-31090,
-30339,
-29961,
-29819,
-29878,
-29753,
-29507,
-29071,
-28764,
-28622,
-28828,
-29170,
-29567,
-29857,
-30019,
-30096,
-30175,
-30295,
-30492,
-30711,
-30909,
-31022,
-31015,
-30860,
-30645,
-30408,
-30307,
-30347,
-30567,
-30846,
-31126,
-31298,
-31277,
-31112,
-30758,
-30326,
-29926,
-29654,
-29615,
-29778,
-30048,
-30310,
-30496,
-30585,
-30680,
-30885,
-31225,
-31738,
-32275,
-32793,
-33172,
-33348,
-33414,
-33379,
-33388,
-33523,
-33744,
-34030,
-34186,
-34105,
-33743,
-33131,
-32468,
-31838,
-31362,
-30998,
-30614,
-30124,
-29429,
-28520,
-27503,
-26446,
-25512,
-24779,
-24299,
-24133,
-24191,
-24511,
-24948,
-25489,
-26043,
-26579,
-27081,
-27510,
-27842,
-28031,
-28015,
-27714,
-27143,
-26316,
-25379,
-24441,
-23615,
-22905,
-22282,
-21610,
-20849,
-19953,
-19045,
-18208,
-17579,
-17164,
-16903,
-16740,
-16537,
-16349,
-16161,
-16074,
-16083,
-16219,
-16502,
-17010,
-17952,
-19368,
-21365,
-23668,
-26039,
-28042,
-29474,
-30245,
-30466,
-30356,
-30075,
-29669,
-29179,
-28457,
-27564,
-26574,
-25680,
-25134,
-25011,
-25341,
-25958,
-26729,
-27506,
-28417,
-29558,
-31140,
-33133,
-35422,
-37750,
-39805,
-41507,
-42696,
-43548,
-44081,
-44487,
-44916,
-45519,
-46421,
-47533,
-48750,
-49744,
-50358,
-50426,
-50041,
-49340,
-48548,
-47876,
-47467,
-47317,
-47425,
-47531,
-47530,
-47290,
-46851,
-46364,
-46038,
-45898,
-46008,
-46128,
-46259,
-46294,
-46346,
-46441,
-46546,
-46637,
-46513,
-46132,
-45399,
-44270,
-42797,
-41002,
-39071,
-37133,
-35391,
-33920,
-32703,
-31719,
-30854,
-30174,
-29643,
-29375,
-29239,
-29307,
-29415,
-29640,
-29882,
-30140,
-30298,
-30297,
-30083,
-29707,
-29253,
-28765,
-28239,
-27621,
-26909,
-26059,
-25250,
-24495,
-23966,
-23660,
-23635,
-23838,
-24240,
-24738,
-25216,
-25648,
-26040,
-26511,
-27152,
-28001,
-28976,
-29907,
-30688,
-31240,
-31665,
-32067,
-32579,
-33216,
-33950,
-34722,
-35358,
-35900,
-36202,
-36352,
-36311,
-36214,
-36017,
-35859,
-35676,
-35535,
-35473,
-35520,
-35725,
-36120,
-36628,
-37257,
-37968,
-38727,
-39572,
-40424,
-41285,
-42021,
-42721,
-43223,
-43669,
-43915,
-43983,
-43782,
-43334,
-42670,
-41926,
-41138,
-40391,
-39697,
-39092,
-38715,
-38543,
-38686,
-38959,
-39311,
-39577,
-39737,
-39847,
-39929,
-40030,
-40122,
-40137,
-40039,
-39860,
-39633,
-39465,
-39368,
-39296,
-39222,
-38992,
-38644,
-38103,
-37527,
-36854,
-36239,
-35540,
-34817,
-33996,
-33113,
-32258,
-31522,
-31025,
-30737,
-30659,
-30606,
-30532,
-30291,
-29905,
-29392,
-28864,
-28380,
-28057,
-27883,
-27799,
-27780,
-27671,
-27454,
-27130,
-26682,
-26276,
-25844,
-25528,
-25237,
-25065,
-24984,
-25049,
-25281,
-25586,
-26011,
-26355,
-26711,
-26960,
-27156,
-27293,
-27382,
-27505,
-27674,
-27976,
-28381,
-28815,
-29206,
-29453,
-29522,
-29531,
-29462,
-29521,
-29620,
-29904,
-30231,
-30621,
-30972,
-31264,
-31494,
-31705,
-31984,
-32356,
-32830,
-33304,
-33743,
-34032,
-34284,
-34492,
-34822,
-35205,
-35625,
-36011,
-36189,
-36239,
-36017,
-35676,
-35159,
-34581,
-33929,
-33256,
-32564,
-31819,
-31040,
-30187,
-29329,
-28512,
-27826,
-27323,
-27037,
-26913,
-26913,
-26970,
-26997,
-27001,
-26969,
-26987,
-27073,
-27268,
-27487,
-27632,
-27589,
-27291,
-26727,
-25964,
-25076,
-24093,
-23059,
-21942,
-20805,
-19667,
-18625,
-17713,
-16930,
-16210,
-15511,
-14768,
-14090,
-13556,
-13278,
-13328,
-13606,
-14074,
-14604,
-15274,
-16160,
-17414,
-19115,
-21177,
-23378,
-25427,
-27035,
-28056,
-28483,
-28440,
-28126,
-27622,
-27062,
-26354,
-25577,
-24665,
-23812,
-23066,
-22690,
-22647,
-23048,
-23779,
-24764,
-25985,
-27313,
-28860,
-30534,
-32413,
-34449,
-36601,
-38797,
-40879,
-42746,
-44225,
-45355,
-46121,
-46797,
-47513,
-48489,
-49671,
-50900,
-51849,
-52284,
-52049,
-51284,
-50250,
-49280,
-48648,
-48391,
-48468,
-48696,
-48895,
-48999,
-48977,
-48919,
-48898,
-48985,
-49223,
-49522,
-49909,
-50188,
-50432,
-50539,
-50555,
-50473,
-50237,
-49782,
-49064,
-47961,
-46484,
-44666,
-42579,
-40409,
-38313,
-36435,
-34844,
-33514,
-32394,
-31393,
-30511,
-29764,
-29254,
-29052,
-29134,
-29433,
-29807,
-30126,
-30262,
-30222,
-30008,
-29667,
-29308,
-28855,
-28372,
-27763,
-27020,
-26130,
-25124,
-24059,
-23022,
-22111,
-21362,
-20870,
-20618,
-20612,
-20833,
-21139,
-21574,
-22046,
-22622,
-23369,
-24289,
-25398,
-26520,
-27610,
-28501,
-29266,
-29959,
-30701,
-31566,
-32529,
-33486,
-34354,
-34975,
-35421,
-35634,
-35742,
-35798,
-35803,
-35816,
-35827,
-35881,
-35997,
-36229,
-36536,
-36970,
-37472,
-38085,
-38809,
-39662,
-40577,
-41601,
-42514,
-43424,
-44166,
-44846,
-45389,
-45870,
-46131,
-46221,
-45992,
-45487,
-44787,
-43995,
-43251,
-42645,
-42217,
-41935,
-41810,
-41740,
-41815,
-41917,
-42104,
-42307,
-42485,
-42619,
-42673,
-42658,
-42585,
-42449,
-42317,
-42170,
-42028,
-41888,
-41699,
-41434,
-41037,
-40475,
-39767,
-38921,
-38058,
-37155,
-36302,
-35448,
-34582,
-33694,
-32786,
-31955,
-31250,
-30770,
-30504,
-30407,
-30365,
-30249,
-29943,
-29456,
-28818,
-28207,
-27668,
-27295,
-27016,
-26769,
-26499,
-26155,
-25794,
-25422,
-25111,
-24834,
-24614,
-24394,
-24196,
-24052,
-23902,
-23926,
-23963,
-24215,
-24509,
-24882,
-25189,
-25430,
-25550,
-25699,
-25874,
-26253,
-26721,
-27342,
-27892,
-28415,
-28743,
-29001,
-29142,
-29268,
-29407,
-29644,
-29944,
-30370,
-30757,
-31183,
-31467,
-31742,
-31914,
-32111,
-32354,
-32641,
-33023,
-33394,
-33768,
-34072,
-34341,
-34531,
-34776,
-35022,
-35340,
-35637,
-35817,
-35811,
-35554,
-35088,
-34470,
-33781,
-33066,
-32375,
-31666,
-30977,
-30316,
-29729,
-29300,
-29024,
-28905,
-28900,
-28908,
-28928,
-28834,
-28706,
-28482,
-28246,
-27957,
-27627,
-27238,
-26746,
-26156,
-25444,
-24632,
-23784,
-22881,
-22017,
-21122,
-20239,
-19308,
-18343,
-17356,
-16352,
-15419,
-14513,
-13738,
-13062,
-12593,
-12289,
-12308,
-12493,
-12971,
-13535,
-14241,
-14992,
-15894,
-16964,
-18341,
-19987,
-21779,
-23611,
-25144,
-26312,
-26887,
-26930,
-26471,
-25656,
-24661,
-23634,
-22696,
-21920,
-21332,
-20990,
-20899,
-21128,
-21698,
-22535,
-23603,
-24756,
-26028,
-27418,
-29113,
-31075,
-33436,
-35912,
-38471,
-40764,
-42703,
-44184,
-45211,
-45921,
-46455,
-46970,
-47616,
-48373,
-49210,
-49925,
-50418,
-50576,
-50390,
-49950,
-49372,
-48878,
-48570,
-48643,
-49029,
-49671,
-50387,
-50976,
-51384,
-51580,
-51694,
-51800,
-51962,
-52173,
-52408,
-52605,
-52784,
-52902,
-52952,
-52886,
-52557,
-51966,
-50945,
-49594,
-47851,
-45899,
-43826,
-41782,
-39875,
-38144,
-36607,
-35215,
-33964,
-32819,
-31859,
-31121,
-30628,
-30437,
-30417,
-30598,
-30799,
-30993,
-31077,
-31038,
-30818,
-30420,
-29783,
-28980,
-27985,
-26876,
-25697,
-24480,
-23219,
-21991,
-20721,
-19589,
-18581,
-17863,
-17420,
-17320,
-17455,
-17800,
-18326,
-18958,
-19820,
-20787,
-21951,
-23117,
-24271,
-25293,
-26169,
-26955,
-27689,
-28487,
-29368,
-30347,
-31303,
-32210,
-32885,
-33346,
-33563,
-33637,
-33680,
-33748,
-33923,
-34143,
-34452,
-34750,
-35122,
-35510,
-36035,
-36636,
-37406,
-38243,
-39194,
-40159,
-41175,
-42176,
-43172,
-44109,
-44979,
-45720,
-46302,
-46710,
-46895,
-46901,
-46709,
-46406,
-46009,
-45624,
-45255,
-44972,
-44735,
-44592,
-44472,
-44397,
-44341,
-44280,
-44282,
-44262,
-44334,
-44387,
-44447,
-44446,
-44368,
-44246,
-44080,
-43952,
-43805,
-43685,
-43463,
-43138,
-42671,
-42024,
-41258,
-40361,
-39360,
-38328,
-37298,
-36319,
-35422,
-34553,
-33742,
-32963,
-32239,
-31656,
-31199,
-30867,
-30650,
-30410,
-30175,
-29843,
-29421,
-28908,
-28325,
-27738,
-27171,
-26716,
-26328,
-26014,
-25731,
-25469,
-25242,
-25072,
-24955,
-24834,
-24692,
-24478,
-24274,
-24085,
-23992,
-23879,
-23789,
-23605,
-23425,
-23255,
-23222,
-23258,
-23412,
-23614,
-23894,
-24242,
-24720,
-25261,
-25876,
-26535,
-27203,
-27898,
-28519,
-29081,
-29474,
-29740,
-29951,
-30153,
-30476,
-30821,
-31225,
-31566,
-31901,
-32188,
-32501,
-32821,
-33126,
-33436,
-33713,
-34071,
-34442,
-34880,
-35281,
-35600,
-35747,
-35769,
-35593,
-35329,
-34930,
-34490,
-34033,
-33591,
-33204,
-32859,
-32543,
-32277,
-32009,
-31826,
-31662,
-31569,
-31449,
-31310,
-31071,
-30768,
-30362,
-29906,
-29370,
-28767,
-28067,
-27278,
-26438,
-25598,
-24842,
-24122,
-23490,
-22809,
-22098,
-21282,
-20403,
-19437,
-18448,
-17393,
-16403,
-15469,
-14730,
-14201,
-13876,
-13773,
-13784,
-13938,
-14213,
-14577,
-15111,
-15773,
-16679,
-17823,
-19204,
-20705,
-22177,
-23391,
-24232,
-24619,
-24614,
-24277,
-23719,
-22977,
-22137,
-21216,
-20347,
-19627,
-19158,
-19021,
-19255,
-19766,
-20582,
-21510,
-22584,
-23770,
-25108,
-26741,
-28663,
-30923,
-33400,
-35909,
-38267,
-40290,
-41899,
-43121,
-44045,
-44797,
-45492,
-46174,
-46879,
-47552,
-48153,
-48614,
-48891,
-48943,
-48883,
-48708,
-48645,
-48737,
-49074,
-49664,
-50355,
-51132,
-51840,
-52441,
-52929,
-53226,
-53469,
-53549,
-53653,
-53746,
-53852,
-54036,
-54152,
-54290,
-54295,
-54165,
-53781,
-53040,
-51895,
-50354,
-48550,
-46634,
-44825,
-43140,
-41654,
-40257,
-38887,
-37559,
-36245,
-35051,
-34013,
-33226,
-32655,
-32309,
-32087,
-31933,
-31774,
-31566,
-31307,
-30956,
-30505,
-29865,
-29021,
-27963,
-26743,
-25381,
-23994,
-22552,
-21144,
-19787,
-18562,
-17534,
-16741,
-16145,
-15756,
-15522,
-15486,
-15678,
-16159,
-16906,
-17892,
-18942,
-20033,
-20989,
-21876,
-22642,
-23371,
-24111,
-24906,
-25770,
-26627,
-27443,
-28095,
-28594,
-28918,
-29188,
-29378,
-29597,
-29826,
-30052,
-30352,
-30713,
-31195,
-31822,
-32542,
-33377,
-34262,
-35200,
-36157,
-37161,
-38212,
-39297,
-40422,
-41576,
-42685,
-43788,
-44754,
-45581,
-46198,
-46601,
-46805,
-46844,
-46833,
-46734,
-46732,
-46690,
-46712,
-46708,
-46685,
-46642,
-46580,
-46507,
-46493,
-46535,
-46653,
-46842,
-47016,
-47191,
-47351,
-47446,
-47600,
-47667,
-47775,
-47729,
-47634,
-47401,
-47049,
-46650,
-46126,
-45528,
-44819,
-43954,
-42981,
-41905,
-40815,
-39681,
-38617,
-37546,
-36549,
-35583,
-34701,
-33870,
-33161,
-32508,
-31957,
-31467,
-30996,
-30585,
-30191,
-29812,
-29497,
-29132,
-28777,
-28358,
-27838,
-27275,
-26632,
-25979,
-25340,
-24686,
-24084,
-23475,
-22921,
-22442,
-22071,
-21839,
-21750,
-21759,
-21842,
-21916,
-21963,
-21991,
-21977,
-22027,
-22071,
-22200,
-22328,
-22483,
-22629,
-22825,
-23042,
-23366,
-23738,
-24174,
-24651,
-25112,
-25653,
-26116,
-26658,
-27140,
-27628,
-28129,
-28609,
-29127,
-29629,
-30135,
-30622,
-31089,
-31540,
-31969,
-32361,
-32696,
-32988,
-33216,
-33422,
-33595,
-33702,
-33777,
-33743,
-33696,
-33636,
-33572,
-33587,
-33537,
-33506,
-33387,
-33217,
-33026,
-32816,
-32630,
-32472,
-32316,
-32141,
-31973,
-31748,
-31560,
-31327,
-31077,
-30809,
-30441,
-30038,
-29492,
-28875,
-28163,
-27330,
-26463,
-25483,
-24474,
-23433,
-22360,
-21282,
-20201,
-19106,
-18058,
-17106,
-16314,
-15788,
-15496,
-15456,
-15577,
-15803,
-16101,
-16467,
-16995,
-17729,
-18720,
-19951,
-21317,
-22646,
-23776,
-24544,
-24874,
-24809,
-24427,
-23862,
-23169,
-22392,
-21535,
-20647,
-19774,
-19065,
-18548,
-18281,
-18265,
-18435,
-18845,
-19444,
-20308,
-21380,
-22753,
-24358,
-26318,
-28500,
-30863,
-33209,
-35335,
-37174,
-38730,
-40073,
-41296,
-42477,
-43512,
-44475,
-45264,
-45924,
-46383,
-46643,
-46633,
-46469,
-46237,
-46174,
-46327,
-46776,
-47381,
-48115,
-48888,
-49684,
-50485,
-51234,
-51883,
-52417,
-52842,
-53239,
-53616,
-54008,
-54404,
-54784,
-55166,
-55545,
-55783,
-55820,
-55408,
-54590,
-53362,
-51944,
-50442,
-48997,
-47598,
-46273,
-44975,
-43761,
-42545,
-41343,
-40096,
-38830,
-37682,
-36697,
-35982,
-35449,
-35028,
-34632,
-34237,
-33840,
-33495,
-33087,
-32639,
-32030,
-31329,
-30510,
-29589,
-28588,
-27393,
-26120,
-24742,
-23459,
-22284,
-21257,
-20326,
-19446,
-18666,
-18025,
-17620,
-17493,
-17597,
-17932,
-18348,
-18886,
-19403,
-19949,
-20445,
-20973,
-21559,
-22241,
-23024,
-23845,
-24589,
-25230,
-25661,
-25962,
-26185,
-26341,
-26538,
-26728,
-26981,
-27275,
-27650,
-28135,
-28692,
-29405,
-30193,
-31077,
-32013,
-32955,
-33896,
-34820,
-35800,
-36795,
-37904,
-39008,
-40141,
-41175,
-42131,
-42920,
-43580,
-44081,
-44444,
-44698,
-44898,
-45052,
-45249,
-45416,
-45586,
-45731,
-45813,
-45907,
-45959,
-46051,
-46159,
-46306,
-46515,
-46737,
-47028,
-47283,
-47548,
-47760,
-47962,
-48123,
-48294,
-48400,
-48454,
-48346,
-48128,
-47715,
-47260,
-46665,
-46087,
-45430,
-44689,
-43900,
-42970,
-42056,
-41093,
-40211,
-39385,
-38614,
-37867,
-37110,
-36319,
-35519,
-34732,
-33997,
-33350,
-32785,
-32275,
-31815,
-31361,
-30923,
-30438,
-29963,
-29423,
-28883,
-28328,
-27767,
-27218,
-26677,
-26108,
-25572,
-25019,
-24534,
-24090,
-23727,
-23418,
-23093,
-22838,
-22529,
-22278,
-22053,
-21849,
-21728,
-21654,
-21639,
-21685,
-21739,
-21827,
-21875,
-21947,
-21998,
-22107,
-22310,
-22597,
-22974,
-23375,
-23748,
-24080,
-24371,
-24665,
-25042,
-25467,
-26033,
-26614,
-27244,
-27826,
-28369,
-28851,
-29323,
-29756,
-30224,
-30629,
-31030,
-31315,
-31534,
-31617,
-31681,
-31702,
-31771,
-31897,
-32074,
-32267,
-32459,
-32593,
-32669,
-32699,
-32677,
-32681,
-32648,
-32664,
-32631,
-32614,
-32528,
-32449,
-32307,
-32150,
-31963,
-31761,
-31523,
-31273,
-30963,
-30645,
-30266,
-29863,
-29378,
-28830,
-28163,
-27411,
-26531,
-25590,
-24565,
-23509,
-22426,
-21339,
-20235,
-19181,
-18153,
-17261,
-16528,
-16034,
-15799,
-15838,
-16138,
-16624,
-17277,
-18091,
-19045,
-20246,
-21558,
-22981,
-24278,
-25327,
-25965,
-26212,
-26042,
-25643,
-24976,
-24182,
-23207,
-22176,
-21041,
-19966,
-18903,
-17997,
-17313,
-16892,
-16850,
-17109,
-17666,
-18444,
-19456,
-20761,
-22444,
-24499,
-26861,
-29377,
-31877,
-34231,
-36381,
-38271,
-39963,
-41375,
-42598,
-43553,
-44376,
-44959,
-45448,
-45677,
-45747,
-45590,
-45310,
-44983,
-44721,
-44620,
-44746,
-45081,
-45596,
-46206,
-46831,
-47457,
-48079,
-48733,
-49482,
-50284,
-51148,
-51940,
-52706,
-53334,
-53888,
-54369,
-54666,
-54846,
-54704,
-54331,
-53638,
-52702,
-51557,
-50294,
-48964,
-47692,
-46457,
-45349,
-44278,
-43201,
-42130,
-40976,
-39874,
-38840,
-37945,
-37241,
-36657,
-36195,
-35778,
-35395,
-35006,
-34607,
-34193,
-33700,
-33143,
-32472,
-31726,
-30902,
-30075,
-29155,
-28255,
-27237,
-26227,
-25129,
-24112,
-23076,
-22187,
-21311,
-20596,
-19960,
-19484,
-19171,
-19033,
-19044,
-19187,
-19353,
-19616,
-19864,
-20214,
-20619,
-21166,
-21794,
-22517,
-23232,
-23929,
-24557,
-25106,
-25585,
-26016,
-26396,
-26804,
-27202,
-27643,
-28133,
-28656,
-29248,
-29851,
-30486,
-31148,
-31824,
-32509,
-33187,
-33887,
-34637,
-35451,
-36400,
-37403,
-38486,
-39516,
-40463,
-41296,
-41980,
-42585,
-43047,
-43483,
-43804,
-44118,
-44373,
-44619,
-44842,
-45020,
-45176,
-45325,
-45475,
-45700,
-45910,
-46229,
-46517,
-46885,
-47265,
-47681,
-48090,
-48458,
-48748,
-48961,
-49054,
-49087,
-49001,
-48791,
-48493,
-48026,
-47517,
-46901,
-46269,
-45574,
-44830,
-44074,
-43242,
-42459,
-41676,
-40990,
-40350,
-39773,
-39186,
-38633,
-38020,
-37446,
-36858,
-36316,
-35824,
-35314,
-34893,
-34414,
-33992,
-33474,
-32981,
-32349,
-31768,
-31057,
-30392,
-29627,
-28890,
-28138,
-27437,
-26818,
-26246,
-25710,
-25126,
-24498,
-23809,
-23116,
-22469,
-21884,
-21410,
-21005,
-20779,
-20627,
-20668,
-20749,
-20900,
-21027,
-21141,
-21232,
-21338,
-21466,
-21651,
-21868,
-22160,
-22522,
-22920,
-23318,
-23670,
-23922,
-24118,
-24302,
-24488,
-24757,
-25055,
-25438,
-25826,
-26305,
-26782,
-27300,
-27811,
-28272,
-28714,
-29164,
-29604,
-30109,
-30645,
-31182,
-31777,
-32311,
-32852,
-33322,
-33694,
-34004,
-34151,
-34258,
-34244,
-34198,
-34099,
-33949,
-33717,
-33468,
-33134,
-32827,
-32522,
-32254,
-32030,
-31822,
-31637,
-31456,
-31281,
-31162,
-31038,
-31009,
-30930,
-30912,
-30797,
-30641,
-30340,
-29913,
-29335,
-28612,
-27788,
-26835,
-25798,
-24668,
-23452,
-22222,
-20977,
-19808,
-18793,
-17923,
-17309,
-16858,
-16661,
-16635,
-16850,
-17286,
-17947,
-18863,
-19946,
-21241,
-22587,
-23955,
-25120,
-26026,
-26501,
-26616,
-26372,
-25926,
-25309,
-24576,
-23718,
-22739,
-21674,
-20631,
-19659,
-18868,
-18270,
-17926,
-17834,
-18088,
-18607,
-19493,
-20660,
-22151,
-24003,
-26142,
-28560,
-31012,
-33363,
-35466,
-37248,
-38813,
-40175,
-41488,
-42676,
-43802,
-44743,
-45488,
-45949,
-46071,
-45884,
-45430,
-44908,
-44485,
-44290,
-44371,
-44713,
-45168,
-45744,
-46300,
-46849,
-47396,
-47918,
-48478,
-49064,
-49716,
-50383,
-51047,
-51647,
-52154,
-52581,
-52931,
-53148,
-53203,
-52992,
-52513,
-51798,
-50940,
-50003,
-49117,
-48224,
-47387,
-46548,
-45676,
-44779,
-43770,
-42700,
-41550,
-40427,
-39389,
-38493,
-37716,
-36998,
-36292,
-35551,
-34799,
-34042,
-33273,
-32532,
-31773,
-31078,
-30392,
-29806,
-29232,
-28665,
-28077,
-27426,
-26772,
-26114,
-25516,
-24991,
-24511,
-24074,
-23643,
-23207,
-22768,
-22342,
-21893,
-21486,
-21027,
-20579,
-20159,
-19746,
-19474,
-19291,
-19284,
-19469,
-19771,
-20244,
-20785,
-21371,
-21992,
-22643,
-23348,
-24173,
-25120,
-26189,
-27314,
-28444,
-29508,
-30463,
-31318,
-32064,
-32744,
-33352,
-33942,
-34447,
-34994,
-35479,
-36014,
-36488,
-36979,
-37397,
-37772,
-38132,
-38450,
-38805,
-39124,
-39471,
-39778,
-40156,
-40560,
-41072,
-41675,
-42318,
-43008,
-43671,
-44343,
-45017,
-45731,
-46486,
-47253,
-48024,
-48700,
-49280,
-49635,
-49847,
-49833,
-49733,
-49517,
-49259,
-48909,
-48493,
-47917,
-47280,
-46480,
-45702,
-44834,
-44050,
-43275,
-42568,
-41911,
-41334,
-40796,
-40323,
-39912,
-39487,
-39161,
-38768,
-38422,
-38018,
-37612,
-37203,
-36799,
-36430,
-36095,
-35752,
-35398,
-34928,
-34345,
-33579,
-32695,
-31672,
-30597,
-29507,
-28441,
-27420,
-26482,
-25567,
-24748,
-23953,
-23275,
-22674,
-22271,
-21976,
-21886,
-21854,
-21936,
-22020,
-22176,
-22395,
-22630,
-22931,
-23168,
-23343,
-23441,
-23405,
-23345,
-23185,
-23030,
-22865,
-22738,
-22702,
-22716,
-22784,
-22863,
-22952,
-23085,
-23303,
-23678,
-24188,
-24821,
-25535,
-26293,
-27060,
-27840,
-28534,
-29235,
-29853,
-30491,
-31097,
-31721,
-32239,
-32694,
-32972,
-33172,
-33287,
-33395,
-33516,
-33616,
-33704,
-33716,
-33686,
-33615,
-33524,
-33439,
-33330,
-33228,
-33088,
-32978,
-32802,
-32705,
-32540,
-32452,
-32359,
-32274,
-32259,
-32163,
-32101,
-31963,
-31762,
-31566,
-31320,
-31116,
-30907,
-30697,
-30430,
-30096,
-29626,
-29079,
-28400,
-27668,
-26831,
-25954,
-25010,
-24051,
-23025,
-22000,
-20874,
-19778,
-18630,
-17590,
-16602,
-15790,
-15128,
-14680,
-14453,
-14474,
-14693,
-15139,
-15771,
-16639,
-17720,
-19019,
-20466,
-21885,
-23163,
-24176,
-24848,
-25301,
-25445,
-25472,
-25256,
-24938,
-24414,
-23830,
-23088,
-22342,
-21567,
-20869,
-20324,
-19979,
-19892,
-20028,
-20392,
-21013,
-21938,
-23275,
-25026,
-27118,
-29450,
-31866,
-34280,
-36612,
-38850,
-40957,
-42911,
-44685,
-46291,
-47694,
-48911,
-49807,
-50391,
-50529,
-50358,
-49872,
-49263,
-48605,
-48008,
-47482,
-47094,
-46759,
-46522,
-46276,
-46034,
-45845,
-45697,
-45810,
-46044,
-46594,
-47228,
-47992,
-48798,
-49604,
-50413,
-51184,
-51817,
-52324,
-52549,
-52587,
-52337,
-51902,
-51274,
-50520,
-49677,
-48761,
-47755,
-46623,
-45324,
-43906,
-42327,
-40793,
-39239,
-37846,
-36540,
-35386,
-34367,
-33477,
-32738,
-32087,
-31508,
-31012,
-30569,
-30266,
-30087,
-30050,
-30137,
-30220,
-30318,
-30282,
-30205,
-30013,
-29802,
-29526,
-29280,
-28948,
-28576,
-28074,
-27433,
-26672,
-25799,
-24895,
-23999,
-23148,
-22353,
-21681,
-21102,
-20729,
-20545,
-20590,
-20911,
-21388,
-22105,
-22864,
-23769,
-24671,
-25674,
-26710,
-27840,
-29044,
-30293,
-31535,
-32716,
-33762,
-34670,
-35358,
-35891,
-36188,
-36324,
-36284,
-36158,
-35946,
-35743,
-35512,
-35305,
-35050,
-34842,
-34625,
-34532,
-34547,
-34736,
-35110,
-35675,
-36418,
-37331,
-38403,
-39603,
-40882,
-42220,
-43488,
-44695,
-45749,
-46625,
-47347,
-47843,
-48181,
-48309,
-48247,
-47988,
-47541,
-46939,
-46187,
-45353,
-44442,
-43566,
-42684,
-41916,
-41213,
-40611,
-40073,
-39598,
-39160,
-38843,
-38562,
-38450,
-38383,
-38420,
-38479,
-38567,
-38636,
-38711,
-38705,
-38674,
-38528,
-38334,
-38033,
-37612,
-37052,
-36317,
-35425,
-34422,
-33355,
-32259,
-31136,
-29972,
-28776,
-27581,
-26428,
-25411,
-24514,
-23823,
-23241,
-22885,
-22641,
-22577,
-22594,
-22690,
-22850,
-23065,
-23369,
-23765,
-24179,
-24663,
-25052,
-25462,
-25780,
-26088,
-26333,
-26494,
-26565,
-26536,
-26410,
-26223,
-25969,
-25662,
-25399,
-25095,
-24946,
-24833,
-24924,
-25047,
-25348,
-25647,
-26091,
-26568,
-27152,
-27786,
-28494,
-29222,
-30015,
-30761,
-31513,
-32143,
-32714,
-33204,
-33597,
-33951,
-34184,
-34362,
-34409,
-34397,
-34313,
-34208,
-34066,
-33906,
-33703,
-33509,
-33323,
-33169,
-33069,
-32981,
-32931,
-32922,
-32909,
-32967,
-32933,
-32890,
-32748,
-32566,
-32410,
-32243,
-32156,
-32020,
-31897,
-31673,
-31464,
-31129,
-30822,
-30440,
-30035,
-29637,
-29193,
-28772,
-28275,
-27744,
-27127,
-26434,
-25761,
-25003,
-24303,
-23513,
-22702,
-21820,
-20879,
-19950,
-18990,
-18071,
-17148,
-16267,
-15381,
-14567,
-13740,
-13099,
-12552,
-12299,
-12326,
-12620,
-13222,
-13965,
-14935,
-16046,
-17349,
-18851,
-20485,
-22207,
-23854,
-25336,
-26541,
-27480,
-28100,
-28504,
-28647,
-28595,
-28370,
-27953,
-27424,
-26789,
-26115,
-25465,
-24843,
-24347,
-24011,
-23913,
-24129,
-24690,
-25612,
-26919,
-28530,
-30445,
-32581,
-34861,
-37295,
-39747,
-42220,
-44603,
-46820,
-48807,
-50509,
-51886,
-52949,
-53677,
-54024,
-54019,
-53554,
-52796,
-51732,
-50586,
-49368,
-48247,
-47160,
-46186,
-45297,
-44517,
-43891,
-43390,
-43112,
-43032,
-43272,
-43787,
-44621,
-45613,
-46712,
-47739,
-48662,
-49426,
-50016,
-50407,
-50592,
-50506,
-50168,
-49604,
-48845,
-47896,
-46831,
-45625,
-44333,
-42987,
-41609,
-40193,
-38805,
-37397,
-36062,
-34823,
-33702,
-32783,
-32038,
-31468,
-31038,
-30693,
-30398,
-30140,
-29874,
-29655,
-29506,
-29414,
-29442,
-29452,
-29499,
-29462,
-29393,
-29286,
-29173,
-29108,
-29042,
-28996,
-28902,
-28745,
-28501,
-28162,
-27736,
-27267,
-26746,
-26239,
-25720,
-25233,
-24753,
-24329,
-23958,
-23692,
-23535,
-23530,
-23615,
-23868,
-24164,
-24644,
-25212,
-25941,
-26825,
-27840,
-28999,
-30214,
-31463,
-32655,
-33772,
-34765,
-35651,
-36367,
-37029,
-37531,
-37961,
-38264,
-38465,
-38577,
-38543,
-38416,
-38170,
-37836,
-37488,
-37123,
-36822,
-36584,
-36432,
-36416,
-36508,
-36815,
-37274,
-37953,
-38741,
-39640,
-40562,
-41489,
-42386,
-43281,
-44128,
-44955,
-45683,
-46283,
-46700,
-46868,
-46819,
-46520,
-46051,
-45408,
-44669,
-43826,
-42929,
-41967,
-40993,
-40016,
-39094,
-38230,
-37451,
-36736,
-36127,
-35582,
-35148,
-34810,
-34577,
-34428,
-34317,
-34231,
-34126,
-34018,
-33875,
-33758,
-33604,
-33466,
-33273,
-33070,
-32788,
-32500,
-32122,
-31747,
-31279,
-30721,
-30079,
-29316,
-28527,
-27730,
-26976,
-26314,
-25732,
-25230,
-24845,
-24499,
-24260,
-24014,
-23837,
-23632,
-23499,
-23420,
-23448,
-23611,
-23888,
-24301,
-24806,
-25399,
-26032,
-26646,
-27208,
-27696,
-28069,
-28410,
-28673,
-28931,
-29143,
-29391,
-29620,
-29875,
-30093,
-30233,
-30260,
-30157,
-29946,
-29722,
-29499,
-29410,
-29358,
-29494,
-29685,
-30052,
-30493,
-31012,
-31546,
-32087,
-32626,
-33237,
-33836,
-34511,
-35140,
-35731,
-36245,
-36641,
-36945,
-37123,
-37196,
-37130,
-36953,
-36665,
-36279,
-35791,
-35178,
-34464,
-33686,
-32897,
-32140,
-31431,
-30797,
-30217,
-29736,
-29332,
-28988,
-28725,
-28456,
-28213,
-27991,
-27789,
-27683,
-27615,
-27624,
-27627,
-27623,
-27550,
-27427,
-27158,
-26774,
-26256,
-25577,
-24805,
-23912,
-22999,
-22006,
-21031,
-20016,
-19006,
-18038,
-17091,
-16226,
-15368,
-14561,
-13734,
-12998,
-12291,
-11791,
-11427,
-11272,
-11294,
-11479,
-11867,
-12503,
-13341,
-14470,
-15771,
-17283,
-18974,
-20782,
-22614,
-24382,
-25922,
-27244,
-28328,
-29253,
-30045,
-30687,
-31121,
-31337,
-31313,
-31111,
-30760,
-30289,
-29711,
-29077,
-28495,
-28028,
-27836,
-27856,
-28186,
-28753,
-29682,
-30966,
-32650,
-34640,
-36853,
-39180,
-41545,
-43941,
-46304,
-48597,
-50745,
-52697,
-54456,
-55983,
-57225,
-58069,
-58365,
-58163,
-57435,
-56454,
-55276,
-54063,
-52812,
-51518,
-50215,
-48901,
-47620,
-46399,
-45309,
-44364,
-43746,
-43452,
-43577,
-44013,
-44670,
-45431,
-46258,
-47095,
-47998,
-48823,
-49592,
-50127,
-50435,
-50452,
-50215,
-49747,
-49052,
-48158,
-47070,
-45847,
-44451,
-42946,
-41292,
-39543,
-37723,
-35927,
-34210,
-32648,
-31288,
-30116,
-29153,
-28343,
-27676,
-27072,
-26580,
-26121,
-25832,
-25650,
-25632,
-25727,
-25853,
-25974,
-26065,
-26138,
-26201,
-26345,
-26500,
-26684,
-26853,
-26887,
-26860,
-26666,
-26395,
-26018,
-25590,
-25139,
-24660,
-24172,
-23690,
-23210,
-22735,
-22309,
-21917,
-21628,
-21473,
-21451,
-21603,
-21910,
-22368,
-23007,
-23793,
-24771,
-25869,
-27164,
-28504,
-29955,
-31373,
-32752,
-34005,
-35118,
-36071,
-36946,
-37754,
-38515,
-39229,
-39793,
-40219,
-40431,
-40505,
-40406,
-40294,
-40095,
-39897,
-39718,
-39523,
-39421,
-39325,
-39363,
-39446,
-39712,
-40051,
-40569,
-41157,
-41805,
-42518,
-43221,
-43950,
-44673,
-45357,
-45998,
-46554,
-46949,
-47225,
-47286,
-47160,
-46839,
-46275,
-45570,
-44672,
-43654,
-42528,
-41267,
-39980,
-38591,
-37225,
-35927,
-34719,
-33691,
-32801,
-32095,
-31530,
-31105,
-30788,
-30604,
-30512,
-30484,
-30519,
-30551,
-30629,
-30656,
-30697,
-30642,
-30547,
-30344,
-30049,
-29675,
-29198,
-28591,
-27912,
-27083,
-26238,
-25385,
-24579,
-23923,
-23317,
-22873,
-22475,
-22173,
-21944,
-21795,
-21745,
-21795,
-21964,
-22237,
-22611,
-23088,
-23605,
-24203,
-24790,
-25421,
-26021,
-26610,
-27146,
-27617,
-28041,
-28394,
-28743,
-29066,
-29402,
-29757,
-30116,
-30463,
-30825,
-31135,
-31445,
-31753,
-32054,
-32375,
-32702,
-33050,
-33419,
-33783,
-34126,
-34457,
-34742,
-35022,
-35277,
-35566,
-35838,
-36163,
-36447,
-36754,
-37014,
-37255,
-37436,
-37571,
-37679,
-37729,
-37774,
-37793,
-37721,
-37625,
-37364,
-37064,
-36644,
-36184,
-35689,
-35150,
-34587,
-33989,
-33331,
-32668,
-31962,
-31273,
-30594,
-29905,
-29275,
-28598,
-28013,
-27402,
-26911,
-26468,
-26136,
-25880,
-25704,
-25565,
-25480,
-25427,
-25400,
-25375,
-25321,
-25216,
-25002,
-24689,
-24193,
-23608,
-22849,
-22014,
-21091,
-20127,
-19144,
-18129,
-17102,
-16085,
-15090,
-14222,
-13447,
-12805,
-12247,
-11754,
-11298,
-10975,
-10769,
-10769,
-10930,
-11249,
-11720,
-12376,
-13272,
-14410,
-15771,
-17323,
-18991,
-20812,
-22734,
-24680,
-26540,
-28197,
-29615,
-30807,
-31895,
-32896,
-33831,
-34633,
-35235,
-35650,
-35862,
-35923,
-35801,
-35515,
-35092,
-34676,
-34365,
-34260,
-34393,
-34690,
-35221,
-35913,
-36916,
-38169,
-39659,
-41311,
-43030,
-44892,
-46821,
-48946,
-51073,
-53200,
-55185,
-56994,
-58612,
-59993,
-61043,
-61653,
-61844,
-61593,
-61085,
-60376,
-59520,
-58512,
-57312,
-55945,
-54423,
-52814,
-51128,
-49432,
-47776,
-46294,
-45088,
-44208,
-43664,
-43375,
-43257,
-43333,
-43550,
-43943,
-44445,
-44981,
-45459,
-45849,
-46125,
-46290,
-46346,
-46218,
-45915,
-45339,
-44570,
-43524,
-42311,
-40888,
-39331,
-37636,
-35873,
-34088,
-32340,
-30629,
-29032,
-27510,
-26149,
-24878,
-23726,
-22682,
-21772,
-20991,
-20420,
-20028,
-19835,
-19755,
-19793,
-19870,
-20033,
-20251,
-20631,
-21044,
-21652,
-22224,
-22857,
-23425,
-23943,
-24350,
-24695,
-24891,
-25047,
-25050,
-25014,
-24844,
-24618,
-24299,
-23979,
-23602,
-23279,
-22955,
-22663,
-22412,
-22214,
-22133,
-22207,
-22504,
-23028,
-23800,
-24739,
-25894,
-27147,
-28558,
-30103,
-31702,
-33383,
-35059,
-36722,
-38351,
-39929,
-41397,
-42768,
-43880,
-44804,
-45376,
-45684,
-45674,
-45430,
-44950,
-44344,
-43601,
-42820,
-41990,
-41144,
-40330,
-39585,
-38917,
-38427,
-38050,
-37893,
-37854,
-38037,
-38353,
-38817,
-39443,
-40106,
-40899,
-41638,
-42371,
-43019,
-43520,
-43882,
-44036,
-43981,
-43702,
-43177,
-42466,
-41497,
-40409,
-39113,
-37722,
-36240,
-34709,
-33219,
-31789,
-30441,
-29220,
-28128,
-27173,
-26426,
-25828,
-25451,
-25219,
-25183,
-25259,
-25537,
-25900,
-26419,
-26975,
-27551,
-28075,
-28479,
-28767,
-28907,
-28929,
-28829,
-28661,
-28401,
-28095,
-27708,
-27294,
-26809,
-26338,
-25820,
-25337,
-24876,
-24473,
-24136,
-23910,
-23760,
-23752,
-23848,
-24069,
-24415,
-24845,
-25394,
-25973,
-26660,
-27337,
-28103,
-28842,
-29632,
-30398,
-31187,
-31955,
-32703,
-33374,
-33984,
-34477,
-34908,
-35266,
-35565,
-35812,
-35978,
-36087,
-36119,
-36093,
-36009,
-35896,
-35727,
-35574,
-35368,
-35225,
-35078,
-34971,
-34890,
-34862,
-34869,
-34945,
-35077,
-35247,
-35420,
-35635,
-35804,
-36035,
-36221,
-36417,
-36551,
-36620,
-36625,
-36554,
-36400,
-36206,
-35883,
-35494,
-35003,
-34414,
-33769,
-33070,
-32352,
-31615,
-30856,
-30063,
-29281,
-28489,
-27765,
-27099,
-26491,
-25978,
-25502,
-25083,
-24715,
-24387,
-24132,
-23915,
-23770,
-23643,
-23557,
-23489,
-23368,
-23243,
-22968,
-22635,
-22156,
-21591,
-20952,
-20262,
-19551,
-18788,
-18023,
-17233,
-16445,
-15735,
-15035,
-14494,
-13991,
-13631,
-13327,
-13159,
-13055,
-13086,
-13159,
-13340,
-13590,
-13931,
-14397,
-15005,
-15746,
-16701,
-17715,
-18984,
-20342,
-21910,
-23644,
-25453,
-27305,
-29049,
-30669,
-32118,
-33495,
-34781,
-36034,
-37229,
-38317,
-39300,
-40081,
-40673,
-41008,
-41112,
-40993,
-40763,
-40483,
-40267,
-40103,
-40050,
-40066,
-40234,
-40565,
-41095,
-41838,
-42743,
-43828,
-45055,
-46477,
-48043,
-49771,
-51574,
-53437,
-55263,
-57068,
-58679,
-60084,
-61109,
-61749,
-61972,
-61885,
-61494,
-60931,
-60137,
-59188,
-58017,
-56662,
-55059,
-53268,
-51263,
-49184,
-47087,
-45195,
-43524,
-42230,
-41222,
-40561,
-40161,
-40044,
-40125,
-40421,
-40803,
-41278,
-41752,
-42209,
-42613,
-42962,
-43156,
-43270,
-43142,
-42880,
-42362,
-41558,
-40494,
-39113,
-37514,
-35770,
-33883,
-32020,
-30108,
-28312,
-26591,
-25048,
-23664,
-22444,
-21391,
-20470,
-19751,
-19247,
-18981,
-18957,
-19105,
-19387,
-19707,
-20093,
-20484,
-20958,
-21431,
-21980,
-22509,
-23054,
-23521,
-23939,
-24222,
-24411,
-24488,
-24461,
-24399,
-24268,
-24145,
-23991,
-23898,
-23778,
-23761,
-23725,
-23741,
-23724,
-23726,
-23697,
-23685,
-23688,
-23762,
-23943,
-24299,
-24804,
-25513,
-26344,
-27305,
-28320,
-29412,
-30521,
-31749,
-32969,
-34332,
-35664,
-37091,
-38464,
-39818,
-41032,
-42125,
-42948,
-43585,
-43905,
-44020,
-43855,
-43462,
-42856,
-42084,
-41204,
-40271,
-39307,
-38412,
-37553,
-36837,
-36262,
-35827,
-35608,
-35508,
-35639,
-35938,
-36452,
-37189,
-38044,
-39050,
-40035,
-41034,
-41927,
-42759,
-43449,
-43948,
-44252,
-44225,
-43973,
-43344,
-42492,
-41372,
-40075,
-38631,
-37139,
-35597,
-34167,
-32797,
-31600,
-30523,
-29628,
-28880,
-28318,
-27935,
-27767,
-27814,
-28059,
-28432,
-28985,
-29566,
-30272,
-30916,
-31549,
-32082,
-32462,
-32691,
-32751,
-32659,
-32480,
-32188,
-31856,
-31449,
-31002,
-30479,
-29921,
-29280,
-28675,
-28018,
-27465,
-26923,
-26504,
-26166,
-25908,
-25772,
-25666,
-25711,
-25762,
-25960,
-26175,
-26492,
-26854,
-27296,
-27748,
-28242,
-28699,
-29143,
-29544,
-29940,
-30335,
-30742,
-31170,
-31577,
-31971,
-32340,
-32654,
-32989,
-33237,
-33494,
-33650,
-33750,
-33787,
-33756,
-33690,
-33597,
-33480,
-33406,
-33299,
-33253,
-33137,
-33056,
-32913,
-32779,
-32674,
-32594,
-32606,
-32667,
-32840,
-33044,
-33364,
-33660,
-34023,
-34320,
-34594,
-34775,
-34857,
-34821,
-34650,
-34352,
-33959,
-33467,
-32949,
-32363,
-31761,
-31138,
-30462,
-29828,
-29183,
-28598,
-28082,
-27630,
-27253,
-26946,
-26678,
-26510,
-26372,
-26329,
-26334,
-26405,
-26491,
-26583,
-26631,
-26661,
-26591,
-26513,
-26311,
-26125,
-25828,
-25510,
-25124,
-24660,
-24175,
-23611,
-23084,
-22534,
-22027,
-21565,
-21139,
-20773,
-20406,
-20112,
-19832,
-19657,
-19561,
-19589,
-19725,
-19923,
-20147,
-20395,
-20560,
-20733,
-20825,
-20904,
-20973,
-21083,
-21296,
-21642,
-22232,
-23075,
-24235,
-25685,
-27376,
-29178,
-31003,
-32713,
-34276,
-35724,
-37062,
-38343,
-39539,
-40644,
-41585,
-42387,
-43006,
-43442,
-43655,
-43589,
-43217,
-42601,
-41807,
-40950,
-40107,
-39378,
-38800,
-38474,
-38378,
-38553,
-38910,
-39454,
-40123,
-40946,
-41968,
-43151,
-44547,
-46016,
-47607,
-49217,
-50888,
-52438,
-53848,
-54865,
-55523,
-55738,
-55628,
-55282,
-54716,
-54020,
-53123,
-52069,
-50858,
-49477,
-47952,
-46270,
-44531,
-42741,
-41096,
-39608,
-38366,
-37358,
-36636,
-36158,
-35993,
-36047,
-36270,
-36550,
-36824,
-37087,
-37320,
-37604,
-37853,
-38089,
-38250,
-38308,
-38245,
-38062,
-37677,
-37130,
-36325,
-35385,
-34301,
-33174,
-32025,
-30857,
-29682,
-28518,
-27424,
-26389,
-25438,
-24537,
-23689,
-22936,
-22255,
-21751,
-21371,
-21096,
-20911,
-20765,
-20654,
-20611,
-20580,
-20641,
-20702,
-20850,
-21012,
-21273,
-21572,
-21973,
-22401,
-22870,
-23345,
-23759,
-24157,
-24448,
-24696,
-24887,
-25027,
-25160,
-25208,
-25230,
-25131,
-24940,
-24661,
-24334,
-23982,
-23723,
-23508,
-23495,
-23586,
-23910,
-24376,
-25095,
-25927,
-26991,
-28110,
-29430,
-30769,
-32259,
-33772,
-35357,
-36944,
-38495,
-39969,
-41265,
-42408,
-43261,
-43879,
-44182,
-44212,
-43983,
-43513,
-42859,
-42111,
-41237,
-40410,
-39522,
-38767,
-38031,
-37445,
-36993,
-36737,
-36694,
-36898,
-37320,
-37922,
-38706,
-39565,
-40547,
-41527,
-42507,
-43409,
-44182,
-44810,
-45247,
-45492,
-45486,
-45250,
-44743,
-44005,
-43066,
-41949,
-40707,
-39367,
-37983,
-36590,
-35245,
-34000,
-32909,
-31947,
-31185,
-30543,
-30071,
-29708,
-29502,
-29404,
-29467,
-29666,
-29971,
-30396,
-30851,
-31307,
-31726,
-32064,
-32319,
-32484,
-32522,
-32474,
-32290,
-32043,
-31699,
-31286,
-30818,
-30282,
-29705,
-29090,
-28464,
-27836,
-27239,
-26683,
-26171,
-25787,
-25462,
-25310,
-25236,
-25285,
-25415,
-25626,
-25890,
-26240,
-26619,
-27072,
-27563,
-28103,
-28704,
-29341,
-30026,
-30708,
-31389,
-32050,
-32682,
-33262,
-33771,
-34200,
-34543,
-34773,
-34932,
-35003,
-34974,
-34896,
-34701,
-34489,
-34236,
-33994,
-33752,
-33550,
-33369,
-33216,
-33147,
-33110,
-33217,
-33334,
-33585,
-33832,
-34159,
-34499,
-34885,
-35284,
-35681,
-36062,
-36386,
-36638,
-36823,
-36863,
-36835,
-36665,
-36412,
-36083,
-35691,
-35261,
-34790,
-34209,
-33572,
-32799,
-32029,
-31215,
-30487,
-29788,
-29203,
-28698,
-28294,
-28037,
-27905,
-27898,
-28005,
-28172,
-28405,
-28699,
-28991,
-29298,
-29543,
-29736,
-29882,
-29952,
-30018,
-30002,
-29923,
-29749,
-29411,
-29016,
-28478,
-27917,
-27329,
-26726,
-26149,
-25600,
-25076,
-24603,
-24155,
-23759,
-23405,
-23126,
-22927,
-22825,
-22798,
-22869,
-22945,
-23106,
-23246,
-23451,
-23671,
-23899,
-24088,
-24212,
-24258,
-24293,
-24286,
-24342,
-24364,
-24471,
-24596,
-24853,
-25329,
-26060,
-27122,
-28427,
-29932,
-31537,
-33135,
-34674,
-36095,
-37369,
-38508,
-39532,
-40418,
-41220,
-41800,
-42205,
-42368,
-42324,
-42132,
-41800,
-41350,
-40773,
-40049,
-39220,
-38313,
-37455,
-36734,
-36189,
-35925,
-35848,
-36030,
-36387,
-36933,
-37656,
-38536,
-39597,
-40780,
-42149,
-43614,
-45158,
-46640,
-47959,
-48955,
-49610,
-49898,
-49899,
-49688,
-49306,
-48781,
-48086,
-47214,
-46173,
-44914,
-43512,
-41934,
-40282,
-38601,
-36976,
-35480,
-34126,
-32960,
-31985,
-31227,
-30758,
-30558,
-30672,
-30967,
-31419,
-31866,
-32260,
-32582,
-32823,
-33071,
-33302,
-33582,
-33814,
-33994,
-34030,
-33922,
-33633,
-33218,
-32655,
-32005,
-31246,
-30409,
-29467,
-28499,
-27442,
-26398,
-25298,
-24255,
-23257,
-22361,
-21628,
-21022,
-20578,
-20266,
-20046,
-19959,
-19992,
-20180,
-20514,
-20997,
-21582,
-22283,
-23085,
-23931,
-24866,
-25780,
-26720,
-27636,
-28506,
-29345,
-30080,
-30674,
-31037,
-31179,
-31079,
-30780,
-30401,
-29958,
-29523,
-29082,
-28608,
-28088,
-27576,
-27073,
-26713,
-26531,
-26612,
-26928,
-27478,
-28201,
-29104,
-30103,
-31281,
-32536,
-33973,
-35463,
-37013,
-38509,
-39905,
-41115,
-42136,
-42950,
-43550,
-43988,
-44225,
-44270,
-44098,
-43693,
-43032,
-42152,
-41097,
-39941,
-38786,
-37684,
-36753,
-35934,
-35303,
-34782,
-34417,
-34166,
-34108,
-34237,
-34541,
-35047,
-35627,
-36307,
-36972,
-37627,
-38235,
-38828,
-39355,
-39874,
-40257,
-40539,
-40593,
-40450,
-40042,
-39477,
-38737,
-38021,
-37279,
-36658,
-36054,
-35479,
-34850,
-34160,
-33424,
-32681,
-32039,
-31484,
-31056,
-30661,
-30311,
-29908,
-29585,
-29299,
-29191,
-29222,
-29407,
-29649,
-29903,
-30131,
-30299,
-30439,
-30565,
-30696,
-30865,
-31017,
-31199,
-31313,
-31372,
-31372,
-31259,
-31119,
-30917,
-30689,
-30481,
-30234,
-30014,
-29741,
-29429,
-29090,
-28694,
-28351,
-28061,
-27893,
-27859,
-27926,
-28100,
-28319,
-28608,
-28981,
-29433,
-29991,
-30633,
-31298,
-32003,
-32682,
-33363,
-34022,
-34674,
-35290,
-35899,
-36415,
-36873,
-37135,
-37267,
-37232,
-37092,
-36893,
-36683,
-36442,
-36216,
-35944,
-35656,
-35398,
-35137,
-35004,
-34895,
-34916,
-34972,
-35111,
-35298,
-35585,
-35916,
-36344,
-36779,
-37244,
-37704,
-38074,
-38450,
-38724,
-38954,
-39125,
-39182,
-39193,
-39063,
-38900,
-38598,
-38276,
-37802,
-37247,
-36552,
-35742,
-34856,
-33970,
-33070,
-32267,
-31482,
-30788,
-30141,
-29605,
-29185,
-28927,
-28810,
-28825,
-28914,
-29048,
-29204,
-29382,
-29597,
-29825,
-30077,
-30234,
-30373,
-30373,
-30330,
-30205,
-30020,
-29783,
-29477,
-29077,
-28641,
-28089,
-27529,
-26878,
-26237,
-25580,
-24991,
-24449,
-23972,
-23567,
-23207,
-22928,
-22723,
-22567,
-22532,
-22518,
-22616,
-22738,
-22884,
-22998,
-23100,
-23082,
-23079,
-23002,
-22953,
-22874,
-22720,
-22506,
-22146,
-21839,
-21655,
-21800,
-22417,
-23448,
-24824,
-26342,
-27794,
-29215,
-30538,
-31949,
-33430,
-34908,
-36309,
-37405,
-38240,
-38755,
-39084,
-39273,
-39310,
-39273,
-38995,
-38552,
-37830,
-36869,
-35752,
-34586,
-33561,
-32813,
-32362,
-32192,
-32179,
-32296,
-32550,
-32980,
-33652,
-34552,
-35668,
-36944,
-38461,
-40080,
-41759,
-43253,
-44383,
-45021,
-45255,
-45170,
-45010,
-44779,
-44528,
-44155,
-43621,
-42922,
-42048,
-41103,
-40052,
-38998,
-37922,
-36881,
-35840,
-34816,
-33795,
-32860,
-32149,
-31777,
-31802,
-32168,
-32732,
-33283,
-33741,
-33977,
-34088,
-34083,
-34062,
-34077,
-34114,
-34235,
-34304,
-34290,
-34162,
-33854,
-33521,
-33119,
-32764,
-32432,
-32043,
-31616,
-31070,
-30503,
-29873,
-29310,
-28734,
-28255,
-27828,
-27483,
-27207,
-26964,
-26693,
-26399,
-26075,
-25786,
-25629,
-25644,
-25852,
-26190,
-26545,
-26884,
-27141,
-27423,
-27779,
-28262,
-28948,
-29646,
-30391,
-30937,
-31312,
-31429,
-31399,
-31197,
-31017,
-30810,
-30666,
-30500,
-30260,
-29898,
-29427,
-28913,
-28476,
-28173,
-28071,
-28097,
-28264,
-28487,
-28786,
-29169,
-29660,
-30258,
-31011,
-31887,
-32889,
-33976,
-35089,
-36168,
-37197,
-38110,
-38952,
-39709,
-40352,
-40914,
-41287,
-41493,
-41493,
-41240,
-40826,
-40205,
-39568,
-38923,
-38398,
-37956,
-37563,
-37155,
-36710,
-36211,
-35813,
-35507,
-35420,
-35484,
-35690,
-35948,
-36284,
-36657,
-37114,
-37701,
-38350,
-39089,
-39765,
-40342,
-40718,
-40886,
-40848,
-40643,
-40376,
-40022,
-39649,
-39180,
-38614,
-37971,
-37186,
-36381,
-35475,
-34552,
-33599,
-32624,
-31705,
-30830,
-30087,
-29469,
-28985,
-28652,
-28416,
-28347,
-28422,
-28678,
-29062,
-29543,
-30022,
-30472,
-30879,
-31240,
-31607,
-31943,
-32273,
-32504,
-32629,
-32643,
-32530,
-32330,
-32058,
-31712,
-31309,
-30834,
-30301,
-29709,
-29132,
-28579,
-28156,
-27856,
-27716,
-27730,
-27899,
-28167,
-28590,
-29119,
-29764,
-30542,
-31341,
-32237,
-33065,
-33929,
-34743,
-35560,
-36357,
-37129,
-37832,
-38426,
-38913,
-39229,
-39462,
-39530,
-39505,
-39352,
-39105,
-38761,
-38438,
-38085,
-37815,
-37578,
-37397,
-37276,
-37208,
-37179,
-37255,
-37352,
-37551,
-37784,
-38074,
-38403,
-38741,
-39084,
-39379,
-39672,
-39880,
-40089,
-40184,
-40269,
-40225,
-40113,
-39902,
-39643,
-39321,
-39012,
-38617,
-38215,
-37731,
-37176,
-36573,
-35955,
-35311,
-34685,
-34012,
-33336,
-32621,
-31916,
-31202,
-30567,
-29924,
-29362,
-28794,
-28260,
-27752,
-27297,
-26880,
-26553,
-26237,
-25981,
-25713,
-25466,
-25198,
-24975,
-24727,
-24517,
-24303,
-24075,
-23841,
-23553,
-23265,
-22942,
-22634,
-22326,
-22006,
-21691,
-21310,
-20947,
-20518,
-20150,
-19787,
-19490,
-19211,
-18959,
-18707,
-18488,
-18323,
-18261,
-18319,
-18462,
-18682,
-18953,
-19198,
-19456,
-19657,
-19829,
-20001,
-20142,
-20337,
-20508,
-20679,
-20791,
-20850,
-20884,
-21019,
-21324,
-21946,
-22848,
-24006,
-25241,
-26437,
-27572,
-28643,
-29736,
-30893,
-32082,
-33225,
-34238,
-35049,
-35705,
-36238,
-36720,
-37138,
-37515,
-37781,
-37942,
-37908,
-37695,
-37290,
-36801,
-36342,
-36030,
-35912,
-35993,
-36182,
-36461,
-36768,
-37177,
-37645,
-38191,
-38848,
-39578,
-40475,
-41496,
-42611,
-43666,
-44557,
-45120,
-45430,
-45540,
-45596,
-45639,
-45694,
-45645,
-45486,
-45115,
-44562,
-43883,
-43107,
-42347,
-41598,
-40870,
-40134,
-39285,
-38358,
-37323,
-36345,
-35529,
-34987,
-34765,
-34795,
-34954,
-35134,
-35251,
-35268,
-35216,
-35137,
-35050,
-35043,
-35049,
-35108,
-35111,
-35037,
-34805,
-34456,
-33957,
-33391,
-32797,
-32191,
-31599,
-31037,
-30416,
-29784,
-29022,
-28248,
-27466,
-26843,
-26398,
-26205,
-26163,
-26197,
-26200,
-26178,
-26159,
-26244,
-26513,
-26961,
-27592,
-28237,
-28869,
-29351,
-29739,
-30013,
-30263,
-30577,
-30900,
-31315,
-31644,
-31919,
-31987,
-31908,
-31683,
-31384,
-31104,
-30854,
-30662,
-30516,
-30364,
-30223,
-30080,
-29993,
-29971,
-30097,
-30345,
-30742,
-31244,
-31807,
-32430,
-32997,
-33576,
-34117,
-34662,
-35261,
-35889,
-36570,
-37271,
-37944,
-38538,
-39006,
-39310,
-39528,
-39580,
-39630,
-39573,
-39487,
-39246,
-38904,
-38378,
-37799,
-37223,
-36718,
-36388,
-36141,
-35995,
-35874,
-35789,
-35695,
-35695,
-35698,
-35802,
-35969,
-36200,
-36564,
-36942,
-37372,
-37743,
-38064,
-38307,
-38525,
-38706,
-38850,
-38897,
-38810,
-38577,
-38195,
-37733,
-37143,
-36559,
-35871,
-35251,
-34614,
-34039,
-33487,
-32957,
-32420,
-31920,
-31475,
-31156,
-30956,
-30933,
-31014,
-31214,
-31505,
-31817,
-32196,
-32541,
-32913,
-33279,
-33594,
-33939,
-34142,
-34322,
-34362,
-34334,
-34254,
-34139,
-34006,
-33857,
-33671,
-33453,
-33208,
-32959,
-32736,
-32519,
-32390,
-32301,
-32314,
-32435,
-32638,
-32933,
-33299,
-33682,
-34112,
-34540,
-35023,
-35513,
-36068,
-36622,
-37161,
-37699,
-38144,
-38561,
-38902,
-39165,
-39375,
-39482,
-39518,
-39453,
-39339,
-39131,
-38913,
-38633,
-38355,
-38082,
-37818,
-37569,
-37370,
-37140,
-36975,
-36753,
-36577,
-36401,
-36254,
-36160,
-36078,
-36070,
-36065,
-36098,
-36161,
-36186,
-36293,
-36307,
-36380,
-36407,
-36413,
-36389,
-36294,
-36145,
-35902,
-35595,
-35178,
-34729,
-34185,
-33639,
-33031,
-32431,
-31778,
-31115,
-30409,
-29682,
-28929,
-28189,
-27505,
-26822,
-26248,
-25640,
-25156,
-24641,
-24249,
-23881,
-23594,
-23357,
-23119,
-22930,
-22708,
-22529,
-22323,
-22148,
-21957,
-21766,
-21568,
-21389,
-21204,
-21095,
-20985,
-20901,
-20798,
-20664,
-20506,
-20348,
-20176,
-20058,
-19914,
-19837,
-19758,
-19726,
-19753,
-19776,
-19867,
-19983,
-20148,
-20388,
-20652,
-20968,
-21283,
-21598,
-21884,
-22164,
-22414,
-22684,
-22892,
-23123,
-23310,
-23545,
-23743,
-23977,
-24178,
-24372,
-24569,
-24760,
-24980,
-25177,
-25395,
-25581,
-25815,
-26043,
-26364,
-26691,
-27070,
-27489,
-27972,
-28597,
-29337,
-30228,
-31181,
-32169,
-33128,
-34037,
-34861,
-35602,
-36255,
-36786,
-37239,
-37583,
-37822,
-37950,
-37962,
-37830,
-37640,
-37367,
-37108,
-36838,
-36628,
-36410,
-36244,
-36089,
-35965,
-35872,
-35824,
-35841,
-35926,
-36116,
-36341,
-36637,
-36889,
-37139,
-37391,
-37679,
-38009,
-38423,
-38824,
-39208,
-39534,
-39727,
-39864,
-39839,
-39773,
-39602,
-39418,
-39206,
-39008,
-38759,
-38507,
-38173,
-37787,
-37387,
-36969,
-36606,
-36285,
-35997,
-35761,
-35528,
-35303,
-35135,
-34969,
-34964,
-35039,
-35280,
-35624,
-35984,
-36348,
-36599,
-36780,
-36889,
-36950,
-37030,
-37077,
-37159,
-37184,
-37190,
-37117,
-37006,
-36811,
-36603,
-36379,
-36161,
-36001,
-35809,
-35656,
-35432,
-35230,
-34965,
-34743,
-34551,
-34428,
-34409,
-34458,
-34549,
-34683,
-34756,
-34834,
-34850,
-34845,
-34857,
-34841,
-34859,
-34777,
-34713,
-34520,
-34341,
-34117,
-33895,
-33715,
-33545,
-33421,
-33293,
-33153,
-32972,
-32727,
-32466,
-32147,
-31918,
-31657,
-31513,
-31342,
-31224,
-31116,
-31035,
-31042,
-31074,
-31199,
-31337,
-31492,
-31670,
-31809,
-31985,
-32156,
-32323,
-32546,
-32749,
-33012,
-33301,
-33579,
-33861,
-34087,
-34284,
-34434,
-34549,
-34622,
-34666,
-34682,
-34667,
-34616,
-34541,
-34443,
-34354,
-34241,
-34179,
-34143,
-34174,
-34282,
-34420,
-34606,
-34735,
-34878,
-34984,
-35129,
-35338,
-35546,
-35816,
-36023,
-36236,
-36411,
-36603,
-36764,
-36927,
-37023,
-37066,
-37054,
-37004,
-36908,
-36810,
-36668,
-36549,
-36395,
-36223,
-36070,
-35877,
-35746,
-35639,
-35597,
-35637,
-35679,
-35764,
-35799,
-35859,
-35913,
-35986,
-36122,
-36218,
-36376,
-36444,
-36559,
-36631,
-36759,
-36901,
-37060,
-37208,
-37290,
-37340,
-37322,
-37261,
-37176,
-37020,
-36828,
-36563,
-36277,
-35946,
-35667,
-35362,
-35124,
-34903,
-34735,
-34594,
-34510,
-34395,
-34333,
-34224,
-34174,
-34182,
-34232,
-34338,
-34437,
-34465,
-34484,
-34415,
-34369,
-34266,
-34163,
-33980,
-33819,
-33591,
-33384,
-33168,
-32931,
-32704,
-32469,
-32240,
-32055,
-31905,
-31759,
-31650,
-31486,
-31361,
-31186,
-31057,
-30928,
-30838,
-30789,
-30776,
-30817,
-30879,
-31018,
-31129,
-31311,
-31424,
-31558,
-31610,
-31629,
-31570,
-31453,
-31295,
-31067,
-30837,
-30556,
-30288,
-29990,
-29689,
-29374,
-29082,
-28760,
-28483,
-28188,
-27907,
-27639,
-27374,
-27116,
-26934,
-26719,
-26603,
-26436,
-26318,
-26184,
-26018,
-25898,
-25756,
-25663,
-25610,
-25601,
-25656,
-25755,
-25887,
-26040,
-26173,
-26315,
-26389,
-26490,
-26499,
-26526,
-26478,
-26425,
-26347,
-26261,
-26201,
-26146,
-26134,
-26117,
-26091,
-26074,
-26015,
-25974,
-25896,
-25873,
-25811,
-25858,
-25861,
-25928,
-25908,
-25837,
-25662,
-25407,
-25138,
-24845,
-24634,
-24390,
-24235,
-24047,
-23914,
-23834,
-23842,
-23968,
-24202,
-24505,
-24864,
-25215,
-25538,
-25816,
-26052,
-26257,
-26413,
-26576,
-26664,
-26774,
-26772,
-26736,
-26631,
-26455,
-26337,
-26191,
-26167,
-26122,
-26167,
-26195,
-26313,
-26507,
-26821,
-27308,
-27883,
-28578,
-29289,
-29990,
-30663,
-31266,
-31861,
-32414,
-33005,
-33603,
-34249,
-34858,
-35417,
-35887,
-36219,
-36497,
-36652,
-36835,
-36928,
-37075,
-37136,
-37182,
-37175,
-37128,
-37085,
-37053,
-37050,
-37068,
-37109,
-37176,
-37259,
-37409,
-37572,
-37837,
-38111,
-38472,
-38851,
-39241,
-39596,
-39907,
-40128,
-40271,
-40353,
-40370,
-40388,
-40382,
-40380,
-40358,
-40305,
-40167,
-39983,
-39740,
-39498,
-39278,
-39115,
-38969,
-38820,
-38632,
-38402,
-38173,
-37974,
-37846,
-37754,
-37689,
-37610,
-37531,
-37458,
-37349,
-37220,
-37006,
-36765,
-36499,
-36301,
-36190,
-36127,
-36089,
-36001,
-35875,
-35757,
-35656,
-35612,
-35609,
-35602,
-35603,
-35574,
-35534,
-35462,
-35349,
-35202,
-35024,
-34860,
-34693,
-34532,
-34324,
-34055,
-33731,
-33377,
-33017,
-32686,
-32409,
-32152,
-31972,
-31808,
-31666,
-31548,
-31438,
-31394,
-31437,
-31604,
-31869,
-32162,
-32405,
-32558,
-32652,
-32680,
-32724,
-32756,
-32766,
-32765,
-32727,
-32691,
-32640,
-32567,
-32471,
-32385,
-32375,
-32502,
-32770,
-33123,
-33477,
-33800,
-34102,
-34458,
-34868,
-35396,
-35901,
-36415,
-36864,
-37282,
-37709,
-38053,
-38347,
-38520,
-38601,
-38681,
-38694,
-38710,
-38657,
-38479,
-38277,
-38008,
-37791,
-37601,
-37414,
-37294,
-37178,
-37163,
-37200,
-37281,
-37361,
-37418,
-37482,
-37590,
-37744,
-37938,
-38058,
-38142,
-38143,
-38189,
-38258,
-38411,
-38526,
-38613,
-38580,
-38476,
-38259,
-38003,
-37679,
-37296,
-36927,
-36544,
-36168,
-35811,
-35366,
-34933,
-34447,
-34008,
-33667,
-33365,
-33191,
-33014,
-32955,
-32908,
-32952,
-32997,
-33062,
-33091,
-33118,
-33162,
-33222,
-33280,
-33301,
-33253,
-33120,
-32987,
-32799,
-32707,
-32589,
-32495,
-32391,
-32256,
-32118,
-31981,
-31821,
-31677,
-31533,
-31413,
-31351,
-31349,
-31442,
-31559,
-31723,
-31856,
-31981,
-32067,
-32166,
-32221,
-32335,
-32370,
-32450,
-32469,
-32511,
-32565,
-32639,
-32752,
-32855,
-32950,
-33046,
-33122,
-33241,
-33378,
-33546,
-33706,
-33824,
-33878,
-33859,
-33791,
-33680,
-33532,
-33368,
-33145,
-32932,
-32694,
-32498,
-32323,
-32161,
-32034,
-31906,
-31816,
-31766,
-31770,
-31782,
-31801,
-31754,
-31652,
-31495,
-31314,
-31153,
-30997,
-30833,
-30603,
-30304,
-29949,
-29597,
-29253,
-28941,
-28598,
-28211,
-27757,
-27277,
-26770,
-26327,
-25932,
-25590,
-25310,
-25062,
-24863,
-24720,
-24601,
-24547,
-24505,
-24508,
-24532,
-24569,
-24634,
-24694,
-24788,
-24895,
-25057,
-25251,
-25501,
-25779,
-26052,
-26259,
-26362,
-26330,
-26141,
-25885,
-25572,
-25294,
-25037,
-24787,
-24506,
-24175,
-23854,
-23568,
-23426,
-23416,
-23560,
-23821,
-24180,
-24579,
-25055,
-25520,
-26034,
-26505,
-26969,
-27383,
-27781,
-28109,
-28374,
-28565,
-28739,
-28889,
-29124,
-29416,
-29778,
-30178,
-30538,
-30888,
-31170,
-31443,
-31716,
-31959,
-32178,
-32297,
-32356,
-32346,
-32346,
-32352,
-32382,
-32448,
-32512,
-32649,
-32885,
-33215,
-33705,
-34243,
-34847,
-35442,
-36035,
-36606,
-37175,
-37695,
-38136,
-38491,
-38638,
-38655,
-38451,
-38115,
-37666,
-37175,
-36678,
-36224,
-35820,
-35471,
-35214,
-35024,
-34972,
-34944,
-35029,
-35052,
-35140,
-35178,
-35289,
-35398,
-35594,
-35746,
-35895,
-35968,
-35965,
-35885,
-35751,
-35514,
-35247,
-34900,
-34548,
-34228,
-33992,
-33852,
-33765,
-33685,
-33568,
-33350,
-33085,
-32757,
-32399,
-32032,
-31596,
-31178,
-30703,
-30343,
-30014,
-29808,
-29648,
-29565,
-29546,
-29613,
-29805,
-30016,
-30330,
-30589,
-30892,
-31182,
-31479,
-31735,
-31929,
-32031,
-32098,
-32154,
-32241,
-32307,
-32389,
-32379,
-32408,
-32423,
-32524,
-32691,
-32909,
-33145,
-33448,
-33772,
-34171,
-34582,
-34947,
-35233,
-35433,
-35513,
-35564,
-35505,
-35446,
-35311,
-35201,
-35129,
-35089,
-35123,
-35149,
-35204,
-35289,
-35426,
-35639,
-35912,
-36200,
-36494,
-36789,
-37036,
-37332,
-37541,
-37731,
-37815,
-37863,
-37859,
-37872,
-37909,
-37910,
-37961,
-37904,
-37934,
-37893,
-37950,
-37966,
-38007,
-37970,
-37919,
-37770,
-37633,
-37467,
-37313,
-37182,
-37037,
-36923,
-36806,
-36766,
-36705,
-36716,
-36698,
-36658,
-36613,
-36516,
-36443,
-36335,
-36248,
-36123,
-35951,
-35772,
-35555,
-35338,
-35138,
-34913,
-34685,
-34452,
-34197,
-33954,
-33735,
-33525,
-33318,
-33123,
-32848,
-32635,
-32357,
-32207,
-32079,
-32075,
-32096,
-32199,
-32268,
-32396,
-32474,
-32606,
-32704,
-32807,
-32862,
-32880,
-32813,
-32701,
-32553,
-32380,
-32249,
-32124,
-32008,
-31910,
-31768,
-31681,
-31543,
-31542,
-31491,
-31570,
-31656,
-31792,
-31994,
-32213,
-32489,
-32768,
-33017,
-33260,
-33425,
-33580,
-33671,
-33727,
-33739,
-33727,
-33682,
-33661,
-33656,
-33722,
-33826,
-33997,
-34179,
-34368,
-34542,
-34704,
-34833,
-34943,
-35045,
-35097,
-35144,
-35160,
-35154,
-35115,
-35051,
-34955,
-34821,
-34713,
-34553,
-34485,
-34360,
-34292,
-34149,
-33994,
-33796,
-33589,
-33417,
-33256,
-33160,
-33076,
-33052,
-33096,
-33192,
-33324,
-33428,
-33444,
-33395,
-33309,
-33227,
-33177,
-33062,
-32890,
-32587,
-32223,
-31873,
-31547,
-31346,
-31129,
-30982,
-30824,
-30721,
-30638,
-30556,
-30410,
-30248,
-30020,
-29888,
-29785,
-29738,
-29648,
-29438,
-29204,
-28942,
-28811,
-28785,
-28891,
-29011,
-29105,
-29148,
-29134,
-29051,
-28938,
-28721,
-28430,
-28127,
-27773,
-27533,
-27408,
-27461,
-27648,
-27944,
-28180,
-28372,
-28395,
-28351,
-28302,
-28288,
-28342,
-28393,
-28396,
-28373,
-28342,
-28440,
-28661,
-29019,
-29430,
-29778,
-30056,
-30210,
-30342,
-30438,
-30546,
-30685,
-30815,
-30962,
-31031,
-30999,
-30856,
-30683,
-30586,
-30752,
-31137,
-31798,
-32493,
-33228,
-33794,
-34285,
-34560,
-34635,
-34470,
-34091,
-33595,
-33182,
-32881,
-32820,
-32870,
-33095,
-33386,
-33869,
-34413,
-35037,
-35616,
-36084,
-36434,
-36641,
-36752,
-36717,
-36544,
-36260,
-35891,
-35574,
-35288,
-35073,
-34827,
-34571,
-34332,
-34219,
-34300,
-34578,
-34968,
-35292,
-35474,
-35415,
-35191,
-34851,
-34490,
-34159,
-33857,
-33645,
-33478,
-33484,
-33613,
-33843,
-34054,
-34124,
-33990,
-33698,
-33316,
-32984,
-32765,
-32611,
-32516,
-32283,
-31999,
-31584,
-31166,
-30813,
-30541,
-30393,
-30314,
-30177,
-30003,
-29704,
-29421,
-29227,
-29201,
-29339,
-29548,
-29666,
-29608,
-29410,
-29091,
-28856,
-28666,
-28594,
-28554,
-28484,
-28369,
-28236,
-28072,
-27954,
-27799,
-27615,
-27392,
-27130,
-26968,
-26886,
-27012,
-27210,
-27492,
-27700,
-27913,
-28068,
-28297,
-28634,
-28982,
-29401,
-29663,
-29877,
-29961,
-30056,
-30151,
-30264,
-30317,
-30279,
-30139,
-29974,
-29887,
-29908,
-30077,
-30280,
-30534,
-30797,
-31130,
-31588,
-32152,
-32762,
-33264,
-33622,
-33757,
-33824,
-33866,
-33966,
-34162,
-34264,
-34327,
-34205,
-34065,
-33934,
-33912,
-33980,
-34064,
-34128,
-34106,
-34086,
-34064,
-34121,
-34236,
-34362,
-34489,
-34588,
-34655,
-34727,
-34771,
-34797,
-34795,
-34726,
-34689,
-34602,
-34619,
-34634,
-34723,
-34829,
-34913,
-34986,
-34986,
-34945,
-34841,
-34713,
-34579,
-34461,
-34437,
-34461,
-34556,
-34687,
-34769,
-34821,
-34787,
-34749,
-34723,
-34769,
-34857,
-34961,
-35054,
-35091,
-35177,
-35256,
-35392,
-35520,
-35584,
-35619,
-35609,
-35634,
-35671,
-35666,
-35589,
-35388,
-35182,
-35014,
-34973,
-34995,
-34990,
-34936,
-34744,
-34597,
-34443,
-34406,
-34427,
-34409,
-34460,
-34438,
-34521,
-34609,
-34719,
-34801,
-34774,
-34721,
-34559,
-34480,
-34366,
-34339,
-34321,
-34297,
-34285,
-34241,
-34229,
-34247,
-34289,
-34363,
-34410,
-34452,
-34475,
-34449,
-34446,
-34384,
-34336,
-34283,
-34245,
-34242,
-34251,
-34263,
-34278,
-34309,
-34328,
-34369,
-34399,
-34399,
-34401,
-34381,
-34398,
-34416,
-34428,
-34414,
-34349,
-34279,
-34220,
-34171,
-34160,
-34124,
-34057,
-33953,
-33795,
-33670,
-33559,
-33511,
-33470,
-33450,
-33385,
-33308,
-33216,
-33130,
-33096,
-33078,
-33106,
-33106,
-33103,
-33045,
-33018,
-32965,
-32959,
-32941,
-32932,
-32883,
-32813,
-32690,
-32525,
-32343,
-32075,
-31821,
-31525,
-31331,
-31149,
-31096,
-30989,
-30926,
-30733,
-30539,
-30338,
-30196,
-30192,
-30238,
-30369,
-30461,
-30539,
-30589,
-30630,
-30739,
-30853,
-31002,
-31114,
-31217,
-31300,
-31405,
-31542,
-31752,
-31961,
-32173,
-32326,
-32426,
-32500,
-32550,
-32618,
-32690,
-32766,
-32841,
-32918,
-33016,
-33146,
-33323,
-33493,
-33673,
-33825,
-33999,
-34219,
-34521,
-34928,
-35376,
-35812,
-36148,
-36329,
-36439,
-36454,
-36513,
-36571,
-36634,
-36657,
-36667,
-36674,
-36743,
-36840,
-36928,
-36902,
-36818,
-36665,
-36595,
-36618,
-36705,
-36795,
-36754,
-36633,
-36438,
-36271,
-36214,
-36204,
-36285,
-36387,
-36463,
-36547,
-36547,
-36531,
-36456,
-36406,
-36370,
-36315,
-36229,
-36007,
-35766,
-35489,
-35345,
-35193,
-35069,
-34773,
-34490,
-34205,
-34116,
-34169,
-34220,
-34146,
-33890,
-33593,
-33406,
-33358,
-33330,
-33143,
-32762,
-32271,
-31908,
-31780,
-31740,
-31684,
-31426,
-31047,
-30774,
-30657,
-30723,
-30816,
-30780,
-30686,
-30591,
-30613,
-30713,
-30722,
-30563,
-30217,
-29805,
-29454,
-29203,
-28951,
-28693,
-28295,
-27958,
-27658,
-27540,
-27525,
-27566,
-27629,
-27662,
-27710,
-27770,
-27918,
-28127,
-28431,
-28735,
-28966,
-29000,
-28835,
-28562,
-28336,
-28294,
-28483,
-28771,
-29030,
-29184,
-29232,
-29277,
-29416,
-29595,
-29829,
-30017,
-30147,
-30317,
-30494,
-30741,
-30902,
-30952,
-30795,
-30569,
-30436,
-30541,
-30912,
-31409,
-31795,
-32012,
-32087,
-32253,
-32724,
-33324,
-33978,
-34221,
-34142,
-33840,
-33687,
-33788,
-34110,
-34338,
-34337,
-34126,
-33892,
-33808,
-33844,
-33873,
-33735,
-33475,
-33244,
-33159,
-33181,
-33242,
-33146,
-33029,
-32865,
-32858,
-32896,
-32950,
-32927,
-32856,
-32879,
-32967,
-33175,
-33238,
-33157,
-32878,
-32553,
-32302,
-32164,
-32072,
-31908,
-31613,
-31191,
-30757,
-30372,
-30140,
-30009,
-29974,
-29926,
-29794,
-29570,
-29236,
-28904,
-28644,
-28494,
-28518,
-28575,
-28706,
-28787,
-28910,
-29057,
-29245,
-29395,
-29452,
-29350,
-29128,
-28843,
-28581,
-28369,
-28193,
-27971,
-27672,
-27299,
-26987,
-26770,
-26753,
-26784,
-26810,
-26756,
-26727,
-26870,
-27293,
-27910,
-28482,
-28823,
-28858,
-28851,
-28965,
-29359,
-29878,
-30259,
-30446,
-30418,
-30493,
-30745,
-31209,
-31628,
-31862,
-31878,
-31828,
-31900,
-32169,
-32529,
-32832,
-32965,
-32918,
-32844,
-32817,
-32948,
-33195,
-33521,
-33868,
-34179,
-34428,
-34555,
-34652,
-34624,
-34665,
-34720,
-34879,
-35131,
-35374,
-35595,
-35720,
-35750,
-35739,
-35685,
-35661,
-35581,
-35517,
-35432,
-35468,
-35548,
-35731,
-35830,
-35751,
-35537,
-35167,
-34847,
-34614,
-34446,
-34276,
-34022,
-33683,
-33398,
-33222,
-33236,
-33334,
-33405,
-33384,
-33236,
-33172,
-33224,
-33535,
-33962,
-34371,
-34582,
-34585,
-34464,
-34369,
-34379,
-34474,
-34524,
-34435,
-34169,
-33850,
-33544,
-33354,
-33226,
-33098,
-32916,
-32711,
-32539,
-32491,
-32540,
-32641,
-32664,
-32577,
-32396,
-32203,
-32155,
-32215,
-32405,
-32534,
-32584,
-32461,
-32334,
-32249,
-32330,
-32604,
-32892,
-33219,
-33402,
-33539,
-33647,
-33821,
-34026,
-34272,
-34419,
-34494,
-34482,
-34486,
-34531,
-34657,
-34815,
-34983,
-35175,
-35358,
-35582,
-35764,
-35921,
-36000,
-36046,
-36060,
-36059,
-36040,
-36056,
-36150,
-36427,
-36838,
-37287,
-37520,
-37488,
-37264,
-37167,
-37397,
-37969,
-38592,
-38972,
-38937,
-38704,
-38483,
-38493,
-38613,
-38608,
-38389,
-38063,
-37883,
-37967,
-38215,
-38339,
-38208,
-37915,
-37678,
-37722,
-37931,
-38104,
-38026,
-37660,
-37255,
-36924,
-36786,
-36704,
-36549,
-36318,
-36094,
-35988,
-35983,
-35983,
-35825,
-35468,
-34969,
-34512,
-34121,
-33961,
-33828,
-33774,
-33573,
-33220,
-32695,
-32092,
-31587,
-31349,
-31376,
-31551,
-31670,
-31512,
-31182,
-30772,
-30559,
-30494,
-30498,
-30279,
-29792,
-29126,
-28517,
-28222,
-28213,
-28389,
-28547,
-28553,
-28494,
-28426,
-28477,
-28582,
-28721,
-28750,
-28724,
-28657,
-28625,
-28667,
-28730,
-28760,
-28713,
-28580,
-28448,
-28398,
-28507,
-28715,
-29009,
-29185,
-29332,
-29363,
-29464,
-29666,
-30020,
-30499,
-30952,
-31320,
-31591,
-31771,
-32001,
-32275,
-32622,
-32978,
-33261,
-33517,
-33734,
-34025,
-34392,
-34830,
-35265,
-35589,
-35812,
-35858,
-35890,
-35944,
-36064,
-36319,
-36471,
-36589,
-36462,
-36239,
-35989,
-35890,
-36029,
-36357,
-36718,
-36957,
-36935,
-36731,
-36468,
-36349,
-36472,
-36808,
-37197,
-37465,
-37433,
-37105,
-36591,
-36032,
-35658,
-35495,
-35528,
-35585,
-35499,
-35193,
-34683,
-34180,
-33742,
-33536,
-33452,
-33446,
-33362,
-33235,
-33023,
-32817,
-32622,
-32382,
-32140,
-31854,
-31651,
-31512,
-31509,
-31515,
-31448,
-31218,
-30845,
-30420,
-30094,
-29917,
-29792,
-29634,
-29298,
-28896,
-28528,
-28386,
-28397,
-28433,
-28328,
-28019,
-27740,
-27626,
-27842,
-28177,
-28450,
-28446,
-28239,
-28063,
-28104,
-28369,
-28676,
-28810,
-28640,
-28323,
-28046,
-28065,
-28388,
-28897,
-29352,
-29579,
-29578,
-29451,
-29347,
-29439,
-29706,
-30104,
-30499,
-30790,
-30987,
-31099,
-31197,
-31224,
-31184,
-30991,
-30770,
-30664,
-30845,
-31352,
-31996,
-32502,
-32658,
-32542,
-32358,
-32417,
-32686,
-33033,
-33144,
-33049,
-32842,
-32909,
-33207,
-33604,
-33709,
-33410,
-32849,
-32454,
-32487,
-32939,
-33488,
-33841,
-33906,
-33818,
-33834,
-33944,
-34134,
-34162,
-34038,
-33803,
-33602,
-33544,
-33577,
-33692,
-33834,
-33966,
-34024,
-33944,
-33656,
-33311,
-33011,
-32939,
-33070,
-33183,
-33091,
-32642,
-31976,
-31322,
-30871,
-30680,
-30677,
-30769,
-30904,
-31097,
-31266,
-31376,
-31302,
-31126,
-30971,
-31061,
-31388,
-31853,
-32164,
-32182,
-31950,
-31674,
-31617,
-31765,
-32064,
-32208,
-32086,
-31750,
-31310,
-31051,
-31005,
-31184,
-31374,
-31451,
-31277,
-30885,
-30419,
-30007,
-29773,
-29780,
-29968,
-30300,
-30700,
-31093,
-31461,
-31718,
-31895,
-31938,
-31949,
-31910,
-31954,
-32083,
-32319,
-32653,
-32943,
-33161,
-33147,
-33033,
-32914,
-32962,
-33262,
-33684,
-34002,
-34050,
-33782,
-33408,
-33265,
-33520,
-34163,
-34900,
-35404,
-35408,
-34994,
-34433,
-34026,
-34061,
-34391,
-34949,
-35309,
-35514,
-35409,
-35329,
-35325,
-35491,
-35728,
-35815,
-35685,
-35323,
-34980,
-34824,
-34989,
-35381,
-35735,
-35879,
-35696,
-35365,
-35058,
-34896,
-34875,
-34840,
-34747,
-34587,
-34473,
-34464,
-34558,
-34617,
-34575,
-34406,
-34213,
-34000,
-33859,
-33654,
-33423,
-33143,
-32923,
-32799,
-32765,
-32722,
-32625,
-32468,
-32280,
-32129,
-31964,
-31794,
-31643,
-31540,
-31560,
-31665,
-31734,
-31716,
-31575,
-31491,
-31495,
-31642,
-31705,
-31578,
-31265,
-30966,
-30911,
-31186,
-31512,
-31705,
-31466,
-30999,
-30486,
-30253,
-30326,
-30590,
-30821,
-30949,
-30944,
-30975,
-31022,
-31078,
-31077,
-31000,
-30951,
-31072,
-31379,
-31842,
-32206,
-32362,
-32202,
-31940,
-31787,
-31935,
-32364,
-32835,
-33138,
-33085,
-32814,
-32509,
-32341,
-32387,
-32505,
-32670,
-32808,
-32941,
-33090,
-33141,
-33070,
-32903,
-32801,
-32948,
-33390,
-33983,
-34470,
-34715,
-34671,
-34549,
-34437,
-34410,
-34377,
-34299,
-34171,
-34120,
-34143,
-34312,
-34468,
-34646,
-34815,
-35014,
-35189,
-35245,
-35140,
-34982,
-34979,
-35216,
-35584,
-35732,
-35522,
-34982,
-34632,
-34713,
-35314,
-35948,
-36125,
-35700,
-35026,
-34635,
-34864,
-35454,
-35916,
-35854,
-35330,
-34781,
-34557,
-34680,
-34900,
-34871,
-34610,
-34318,
-34258,
-34468,
-34787,
-34952,
-34957,
-34870,
-34879,
-35017,
-35151,
-35202,
-35072,
-34861,
-34692,
-34595,
-34573,
-34491,
-34322,
-34099,
-33842,
-33709,
-33614,
-33602,
-33561,
-33494,
-33430,
-33381,
-33411,
-33461,
-33447,
-33369,
-33150,
-32946,
-32816,
-32760,
-32810,
-32823,
-32812,
-32749,
-32708,
-32684,
-32708,
-32649,
-32550,
-32384,
-32242,
-32207,
-32206,
-32250,
-32172,
-31993,
-31743,
-31486,
-31298,
-31199,
-31134,
-31108,
-31060,
-31008,
-30961,
-30960,
-31028,
-31182,
-31329,
-31427,
-31354,
-31178,
-31008,
-30995,
-31196,
-31482,
-31642,
-31525,
-31168,
-30809,
-30711,
-30966,
-31435,
-31755,
-31738,
-31340,
-30881,
-30673,
-30938,
-31524,
-32162,
-32435,
-32283,
-31914,
-31642,
-31755,
-32234,
-32734,
-32985,
-32780,
-32342,
-31938,
-31914,
-32158,
-32568,
-32770,
-32748,
-32574,
-32461,
-32573,
-32826,
-33097,
-33160,
-33038,
-32765,
-32592,
-32549,
-32724,
-32934,
-33084,
-33071,
-32963,
-32852,
-32836,
-32944,
-33111,
-33254,
-33336,
-33253,
-33138,
-32906,
-32731,
-32650,
-32724,
-32978,
-33222,
-33336,
-33171,
-32901,
-32627,
-32765,
-33108,
-33691,
-34063,
-34165,
-34048,
-33884,
-33840,
-33878,
-33861,
-33710,
-33429,
-33228,
-33147,
-33245,
-33305,
-33242,
-33007,
-32735,
-32567,
-32561,
-32639,
-32682,
-32579,
-32372,
-32111,
-31994,
-31958,
-32072,
-32173,
-32202,
-32131,
-31948,
-31801,
-31728,
-31815,
-31983,
-32131,
-32137,
-31968,
-31724,
-31557,
-31560,
-31669,
-31724,
-31559,
-31158,
-30707,
-30374,
-30325,
-30451,
-30615,
-30635,
-30526,
-30401,
-30405,
-30604,
-30846,
-31031,
-31011,
-30824,
-30573,
-30388,
-30335,
-30398,
-30486,
-30545,
-30485,
-30403,
-30313,
-30401,
-30649,
-31059,
-31399,
-31568,
-31465,
-31312,
-31281,
-31571,
-32030,
-32431,
-32484,
-32167,
-31725,
-31449,
-31499,
-31764,
-31995,
-32036,
-31919,
-31887,
-32019,
-32322,
-32585,
-32706,
-32698,
-32762,
-32966,
-33303,
-33628,
-33781,
-33827,
-33890,
-34043,
-34317,
-34554,
-34687,
-34734,
-34732,
-34777,
-34788,
-34718,
-34554,
-34379,
-34315,
-34357,
-34452,
-34398,
-34195,
-33922,
-33783,
-33880,
-34137,
-34388,
-34423,
-34293,
-34090,
-34027,
-34198,
-34455,
-34689,
-34663,
-34444,
-34163,
-34018,
-34126,
-34365,
-34564,
-34461,
-34127,
-33595,
-33184,
-32963,
-32927,
-32902,
-32746,
-32415,
-32057,
-31814,
-31773,
-31886,
-31965,
-31922,
-31669,
-31382,
-31158,
-31161,
-31287,
-31471,
-31539,
-31435,
-31305,
-31162,
-31164,
-31204,
-31246,
-31244,
-31253,
-31313,
-31435,
-31496,
-31425,
-31234,
-31032,
-31016,
-31214,
-31533,
-31769,
-31782,
-31640,
-31462,
-31411,
-31479,
-31602,
-31689,
-31752,
-31818,
-31934,
-31972,
-31945,
-31800,
-31725,
-31775,
-31960,
-32117,
-32095,
-31907,
-31724,
-31761,
-32062,
-32438,
-32619,
-32548,
-32319,
-32251,
-32467,
-32902,
-33298,
-33465,
-33404,
-33335,
-33376,
-33615,
-33805,
-33930,
-33864,
-33792,
-33752,
-33840,
-33943,
-34003,
-34062,
-34102,
-34321,
-34567,
-34788,
-34858,
-34699,
-34473,
-34286,
-34347,
-34578,
-34975,
-35248,
-35359,
-35334,
-35243,
-35294,
-35406,
-35529,
-35514,
-35391,
-35280,
-35340,
-35505,
-35754,
-35755,
-35590,
-35296,
-35130,
-35108,
-35184,
-35115,
-34900,
-34619,
-34483,
-34549,
-34666,
-34633,
-34342,
-33972,
-33709,
-33723,
-33814,
-33806,
-33533,
-33117,
-32811,
-32757,
-32874,
-32925,
-32736,
-32380,
-32048,
-31913,
-31961,
-31987,
-31894,
-31657,
-31452,
-31353,
-31437,
-31495,
-31514,
-31383,
-31284,
-31167,
-31122,
-30978,
-30764,
-30530,
-30383,
-30441,
-30612,
-30846,
-30954,
-31007,
-30976,
-30966,
-31001,
-31026,
-31034,
-31092,
-31162,
-31347,
-31532,
-31663,
-31690,
-31605,
-31527,
-31520,
-31647,
-31850,
-32100,
-32317,
-32498,
-32651,
-32748,
-32833,
-32850,
-32858,
-32857,
-32897,
-32942,
-32953,
-32897,
-32725,
-32513,
-32353,
-32325,
-32525,
-32766,
-33038,
-33109,
-33112,
-33063,
-33114,
-33255,
-33362,
-33390,
-33235,
-33119,
-33096,
-33259,
-33487,
-33599,
-33506,
-33275,
-33082,
-33061,
-33206,
-33386,
-33411,
-33289,
-33046,
-32839,
-32702,
-32656,
-32592,
-32527,
-32396,
-32255,
-32087,
-31911,
-31794,
-31728,
-31808,
-31909,
-31986,
-31904,
-31698,
-31454,
-31289,
-31285,
-31363,
-31429,
-31378,
-31241,
-31067,
-30955,
-30874,
-30758,
-30607,
-30370,
-30194,
-30125,
-30170,
-30283,
-30355,
-30352,
-30275,
-30147,
-30044,
-29958,
-29965,
-30026,
-30139,
-30252,
-30228,
-30156,
-29978,
-29932,
-30021,
-30251,
-30464,
-30545,
-30515,
-30511,
-30686,
-30994,
-31323,
-31455,
-31368,
-31269,
-31320,
-31666,
-32158,
-32531,
-32563,
-32338,
-32003,
-31874,
-31971,
-32250,
-32443,
-32517,
-32409,
-32369,
-32405,
-32674,
-33014,
-33363,
-33657,
-33834,
-34047,
-34255,
-34570,
-34855,
-35134,
-35277,
-35369,
-35393,
-35448,
-35534,
-35608,
-35623,
-35551,
-35395,
-35274,
-35253,
-35355,
-35563,
-35726,
-35802,
-35721,
-35642,
-35570,
-35675,
-35861,
-36102,
-36340,
-36456,
-36567,
-36612,
-36688,
-36754,
-36796,
-36832,
-36840,
-36856,
-36902,
-36951,
-36979,
-36962,
-36902,
-36827,
-36797,
-36838,
-36921,
-36985,
-37010,
-36896,
-36761,
-36560,
-36434,
-36332,
-36317,
-36260,
-36273,
-36205,
-36215,
-36164,
-36121,
-36046,
-35889,
-35742,
-35548,
-35382,
-35268,
-35132,
-35036,
-34834,
-34617,
-34355,
-34090,
-33931,
-33798,
-33791,
-33770,
-33747,
-33637,
-33467,
-33284,
-33134,
-33028,
-32961,
-32885,
-32746,
-32564,
-32348,
-32112,
-31963,
-31797,
-31647,
-31435,
-31117,
-30756,
-30370,
-30035,
-29812,
-29684,
-29595,
-29533,
-29401,
-29257,
-29115,
-29047,
-29062,
-29155,
-29238,
-29288,
-29254,
-29207,
-29132,
-29142,
-29149,
-29224,
-29229,
-29261,
-29236,
-29262,
-29294,
-29387,
-29516,
-29702,
-29934,
-30211,
-30474,
-30694,
-30811,
-30835,
-30826,
-30814,
-30951,
-31158,
-31496,
-31802,
-32074,
-32225,
-32339,
-32428,
-32572,
-32804,
-33066,
-33342,
-33585,
-33748,
-33875,
-33930,
-34003,
-34011,
-34082,
-34096,
-34217,
-34324,
-34507,
-34663,
-34817,
-34900,
-34997,
-35071,
-35249,
-35373,
-35518,
-35535,
-35505,
-35478,
-35518,
-35646,
-35779,
-35825,
-35718,
-35545,
-35307,
-35248,
-35185,
-35238,
-35156,
-35030,
-34801,
-34569,
-34388,
-34219,
-34156,
-34027,
-33976,
-33824,
-33668,
-33434,
-33243,
-33103,
-33068,
-33050,
-32981,
-32787,
-32510,
-32281,
-32171,
-32186,
-32193,
-32052,
-31815,
-31559,
-31448,
-31518,
-31572,
-31487,
-31155,
-30743,
-30464,
-30436,
-30595,
-30715,
-30632,
-30348,
-30028,
-29841,
-29850,
-29949,
-30022,
-30009,
-29900,
-29842,
-29780,
-29788,
-29764,
-29741,
-29705,
-29688,
-29670,
-29627,
-29575,
-29523,
-29513,
-29552,
-29549,
-29516,
-29370,
-29300,
-29259,
-29416,
-29598,
-29808,
-29860,
-29835,
-29713,
-29670,
-29736,
-29905,
-30103,
-30207,
-30257,
-30193,
-30206,
-30267,
-30429,
-30631,
-30801,
-30818,
-30801,
-30700,
-30699,
-30771,
-30953,
-31115,
-31276,
-31343,
-31408,
-31490,
-31652,
-31847,
-32078,
-32213,
-32297,
-32298,
-32323,
-32377,
-32518,
-32665,
-32813,
-32851,
-32826,
-32708,
-32630,
-32573,
-32614,
-32694,
-32744,
-32705,
-32563,
-32336,
-32155,
-32028,
-32094,
-32254,
-32483,
-32644,
-32658,
-32530,
-32309,
-32097,
-32032,
-32066,
-32259,
-32402,
-32510,
-32484,
-32418,
-32347,
-32286,
-32259,
-32159,
-32066,
-31943,
-31879,
-31877,
-31890,
-31851,
-31661,
-31379,
-31073,
-30908,
-30982,
-31225,
-31499,
-31611,
-31451,
-31186,
-30957,
-30958,
-31212,
-31528,
-31769,
-31780,
-31729,
-31692,
-31829,
-32039,
-32210,
-32299,
-32285,
-32320,
-32423,
-32564,
-32617,
-32601,
-32501,
-32556,
-32728,
-33061,
-33339,
-33497,
-33533,
-33577,
-33700,
-33959,
-34251,
-34485,
-34711,
-34903,
-35192,
-35559,
-35886,
-36144,
-36187,
-36195,
-36153,
-36290,
-36565,
-36949,
-37350,
-37611,
-37748,
-37742,
-37728,
-37756,
-37863,
-38046,
-38173,
-38289,
-38289,
-38242,
-38202,
-38135,
-38163,
-38122,
-38178,
-38190,
-38205,
-38239,
-38192,
-38162,
-38051,
-37941,
-37822,
-37761,
-37748,
-37767,
-37797,
-37743,
-37613,
-37376,
-37104,
-36837,
-36650,
-36501,
-36382,
-36211,
-35976,
-35690,
-35359,
-35072,
-34792,
-34562,
-34339,
-34129,
-33876,
-33640,
-33358,
-33103,
-32905,
-32746,
-32687,
-32635,
-32554,
-32394,
-32222,
-32052,
-31981,
-31941,
-31860,
-31697,
-31411,
-31156,
-31048,
-31083,
-31258,
-31303,
-31218,
-30928,
-30569,
-30274,
-30120,
-30084,
-30079,
-30110,
-30062,
-30099,
-30088,
-30160,
-30156,
-30177,
-30134,
-30130,
-30150,
-30261,
-30423,
-30630,
-30862,
-31044,
-31229,
-31388,
-31613,
-31880,
-32216,
-32452,
-32544,
-32408,
-32117,
-31820,
-31648,
-31722,
-31985,
-32344,
-32662,
-32872,
-32981,
-33043,
-33092,
-33170,
-33256,
-33383,
-33522,
-33709,
-33920,
-34135,
-34374,
-34587,
-34777,
-34904,
-34924,
-34856,
-34766,
-34775,
-34895,
-35142,
-35342,
-35435,
-35407,
-35304,
-35324,
-35410,
-35525,
-35491,
-35243,
-34860,
-34489,
-34295,
-34310,
-34443,
-34593,
-34663,
-34633,
-34538,
-34349,
-34119,
-33859,
-33631,
-33469,
-33385,
-33313,
-33211,
-33069,
-32962,
-32895,
-32866,
-32743,
-32436,
-31986,
-31508,
-31200,
-31102,
-31172,
-31191,
-31116,
-30932,
-30765,
-30660,
-30661,
-30584,
-30421,
-30140,
-29873,
-29764,
-29819,
-29992,
-30118,
-30143,
-30036,
-29918,
-29822,
-29830,
-29835,
-29839,
-29731,
-29628,
-29544,
-29553,
-29695,
-29824,
-29943,
-29934,
-29891,
-29873,
-29977,
-30224,
-30515,
-30804,
-30958,
-31039,
-31057,
-31191,
-31344,
-31649,
-31838,
-31987,
-31996,
-31957,
-31997,
-32149,
-32411,
-32689,
-32852,
-32832,
-32691,
-32539,
-32545,
-32735,
-33007,
-33240,
-33245,
-33115,
-32906,
-32843,
-32953,
-33179,
-33381,
-33455,
-33419,
-33373,
-33451,
-33634,
-33863,
-33950,
-33829,
-33518,
-33174,
-32975,
-32942,
-33084,
-33186,
-33173,
-32936,
-32565,
-32222,
-32034,
-32081,
-32221,
-32343,
-32217,
-31886,
-31476,
-31153,
-31128,
-31300,
-31529,
-31617,
-31474,
-31226,
-31030,
-30985,
-31066,
-31124,
-31049,
-30856,
-30632,
-30483,
-30453,
-30422,
-30350,
-30209,
-30004,
-29885,
-29781,
-29760,
-29731,
-29737,
-29777,
-29848,
-29913,
-29912,
-29837,
-29777,
-29706,
-29739,
-29733,
-29730,
-29639,
-29578,
-29635,
-29810,
-30097,
-30334,
-30522,
-30639,
-30765,
-30921,
-31087,
-31182,
-31250,
-31266,
-31371,
-31537,
-31742,
-31890,
-31951,
-31974,
-32044,
-32170,
-32359,
-32468,
-32533,
-32525,
-32632,
-32771,
-33011,
-33156,
-33183,
-33115,
-32994,
-33027,
-33130,
-33339,
-33556,
-33717,
-33880,
-34056,
-34258,
-34486,
-34660,
-34761,
-34807,
-34866,
-34954,
-35136,
-35325,
-35528,
-35646,
-35718,
-35726,
-35721,
-35729,
-35698,
-35691,
-35613,
-35619,
-35592,
-35681,
-35671,
-35639,
-35482,
-35241,
-35027,
-34877,
-34810,
-34866,
-34892,
-34925,
-34909,
-34798,
-34682,
-34521,
-34412,
-34390,
-34446,
-34600,
-34694,
-34768,
-34657,
-34565,
-34392,
-34293,
-34199,
-34082,
-33909,
-33723,
-33505,
-33349,
-33156,
-33001,
-32813,
-32646,
-32545,
-32420,
-32344,
-32142,
-31988,
-31842,
-31866,
-32005,
-32190,
-32267,
-32228,
-32109,
-32050,
-32099,
-32261,
-32373,
-32426,
-32419,
-32384,
-32487,
-32567,
-32690,
-32659,
-32568,
-32454,
-32390,
-32418,
-32480,
-32512,
-32507,
-32514,
-32567,
-32724,
-32911,
-33062,
-33091,
-33018,
-32893,
-32822,
-32886,
-33063,
-33307,
-33471,
-33591,
-33582,
-33628,
-33696,
-33851,
-34063,
-34198,
-34305,
-34317,
-34323,
-34314,
-34345,
-34334,
-34311,
-34229,
-34150,
-34117,
-34150,
-34219,
-34274,
-34251,
-34201,
-34127,
-34165,
-34241,
-34379,
-34451,
-34443,
-34366,
-34295,
-34292,
-34328,
-34397,
-34375,
-34342,
-34245,
-34237,
-34264,
-34358,
-34398,
-34350,
-34211,
-34036,
-33907,
-33872,
-33848,
-33828,
-33689,
-33526,
-33382,
-33350,
-33408,
-33485,
-33471,
-33297,
-33057,
-32867,
-32797,
-32914,
-33018,
-33092,
-32982,
-32825,
-32631,
-32586,
-32593,
-32699,
-32696,
-32596,
-32418,
-32227,
-32169,
-32194,
-32279,
-32303,
-32230,
-32069,
-31864,
-31707,
-31575,
-31462,
-31365,
-31306,
-31305,
-31389,
-31471,
-31464,
-31397,
-31224,
-31139,
-31109,
-31218,
-31361,
-31501,
-31580,
-31653,
-31703,
-31784,
-31841,
-31890,
-31940,
-31989,
-32083,
-32173,
-32221,
-32205,
-32056,
-31918,
-31745,
-31708,
-31719,
-31819,
-31883,
-31918,
-31901,
-31849,
-31881,
-31940,
-32166,
-32373,
-32620,
-32757,
-32812,
-32829,
-32872,
-32985,
-33157,
-33282,
-33349,
-33298,
-33237,
-33193,
-33239,
-33258,
-33285,
-33233,
-33222,
-33255,
-33353,
-33400,
-33332,
-33147,
-32941,
-32901,
-33030,
-33319,
-33544,
-33561,
-33409,
-33106,
-32960,
-32900,
-33105,
-33284,
-33462,
-33490,
-33401,
-33257,
-33079,
-32987,
-32886,
-32913,
-32890,
-32902,
-32890,
-32846,
-32848,
-32841,
-32878,
-32908,
-32902,
-32847,
-32763,
-32688,
-32668,
-32713,
-32795,
-32880,
-32894,
-32835,
-32713,
-32578,
-32529,
-32509,
-32580,
-32645,
-32684,
-32716,
-32707,
-32699,
-32678,
-32671,
-32629,
-32639,
-32650,
-32738,
-32819,
-32892,
-32857,
-32740,
-32548,
-32409,
-32358,
-32448,
-32513,
-32530,
-32353,
-32111,
-31886,
-31797,
-31861,
-31963,
-32001,
-31908,
-31802,
-31715,
-31799,
-31914,
-32012,
-31978,
-31881,
-31799,
-31825,
-31931,
-32041,
-32057,
-31998,
-31886,
-31835,
-31798,
-31819,
-31779,
-31750,
-31706,
-31718,
-31734,
-31715,
-31655,
-31554,
-31513,
-31534,
-31619,
-31732,
-31784,
-31785,
-31773,
-31810,
-31935,
-32120,
-32318,
-32397,
-32431,
-32365,
-32349,
-32380,
-32494,
-32573,
-32642,
-32599,
-32646,
-32713,
-32936,
-33129,
-33237,
-33186,
-33008,
-32860,
-32809,
-32899,
-33046,
-33155,
-33091,
-32952,
-32759,
-32663,
-32701,
-32788,
-32888,
-32889,
-32787,
-32678,
-32583,
-32627,
-32712,
-32794,
-32795,
-32712,
-32579,
-32483,
-32480,
-32566,
-32703,
-32800,
-32816,
-32782,
-32715,
-32684,
-32719,
-32747,
-32782,
-32769,
-32739,
-32671,
-32628,
-32544,
-32460,
-32382,
-32305,
-32358,
-32415,
-32533,
-32564,
-32508,
-32409,
-32299,
-32261,
-32276,
-32319,
-32361,
-32392,
-32484,
-32600,
-32771,
-32918,
-32956,
-32904,
-32769,
-32599,
-32567,
-32578,
-32753,
-32933,
-33148,
-33274,
-33340,
-33296,
-33192,
-33043,
-32919,
-32834,
-32851,
-32905,
-32977,
-33008,
-32930,
-32800,
-32638,
-32507,
-32477,
-32470,
-32531,
-32534,
-32546,
-32502,
-32483,
-32454,
-32429,
-32413,
-32386,
-32367,
-32365,
-32334,
-32331,
-32291,
-32300,
-32322,
-32365,
-32353,
-32343,
-32227,
-32216,
-32197,
-32282,
-32322,
-32268,
-32107,
-31896,
-31755,
-31782,
-31928,
-32142,
-32262,
-32274,
-32206,
-32132,
-32161,
-32289,
-32460,
-32614,
-32692,
-32672,
-32645,
-32629,
-32661,
-32778,
-32833,
-32882,
-32783,
-32705,
-32602,
-32665,
-32794,
-32998,
-33144,
-33164,
-33094,
-32979,
-32928,
-32941,
-32994,
-33007,
-32950,
-32907,
-32858,
-32977,
-33080,
-33236,
-33237,
-33201,
-33079,
-33088,
-33186,
-33388,
-33538,
-33549,
-33374,
-33154,
-32981,
-33029,
-33237,
-33532,
-33720,
-33782,
-33698,
-33646,
-33616,
-33700,
-33784,
-33827,
-33825,
-33772,
-33740,
-33708,
-33693,
-33608,
-33523,
-33393,
-33276,
-33187,
-33109,
-33064,
-33090,
-33156,
-33233,
-33249,
-33158,
-33004,
-32858,
-32829,
-32938,
-33084,
-33208,
-33171,
-32992,
-32817,
-32690,
-32735,
-32890,
-33027,
-33086,
-33006,
-32862,
-32781,
-32764,
-32828,
-32879,
-32817,
-32691,
-32535,
-32495,
-32572,
-32705,
-32799,
-32716,
-32599,
-32456,
-32498,
-32686,
-32964,
-33185,
-33239,
-33098,
-32922,
-32782,
-32821,
-32941,
-33112,
-33185,
-33191,
-33179,
-33206,
-33303,
-33369,
-33375,
-33216,
-33088,
-32995,
-33083,
-33281,
-33437,
-33460,
-33341,
-33116,
-33005,
-32959,
-33095,
-33240,
-33344,
-33408,
-33392,
-33401,
-33442,
-33520,
-33662,
-33766,
-33844,
-33837,
-33818,
-33818,
-33934,
-34083,
-34245,
-34241,
-34093,
-33816,
-33646,
-33648,
-33826,
-34056,
-34096,
-33951,
-33632,
-33396,
-33330,
-33467,
-33680,
-33795,
-33748,
-33638,
-33482,
-33468,
-33468,
-33526,
-33489,
-33428,
-33322,
-33243,
-33209,
-33233,
-33240,
-33261,
-33204,
-33107,
-33018,
-32904,
-32900,
-32919,
-32994,
-33004,
-32942,
-32730,
-32498,
-32244,
-32152,
-32155,
-32281,
-32358,
-32327,
-32142,
-31895,
-31707,
-31663,
-31766,
-31864,
-31878,
-31769,
-31619,
-31506,
-31497,
-31476,
-31403,
-31232,
-31103,
-31129,
-31392,
-31778,
-32086,
-32166,
-31990,
-31716,
-31562,
-31605,
-31878,
-32151,
-32379,
-32396,
-32326,
-32200,
-32155,
-32223,
-32367,
-32539,
-32627,
-32620,
-32477,
-32373,
-32266,
-32361,
-32457,
-32618,
-32640,
-32632,
-32591,
-32608,
-32726,
-32846,
-32934,
-32912,
-32881,
-32853,
-33000,
-33150,
-33384,
-33461,
-33512,
-33431,
-33420,
-33392,
-33447,
-33489,
-33530,
-33572,
-33571,
-33595,
-33537,
-33466,
-33386,
-33283,
-33264,
-33248,
-33244,
-33203,
-33081,
-32939,
-32730,
-32592,
-32485,
-32467,
-32548,
-32633,
-32742,
-32754,
-32684,
-32549,
-32440,
-32381,
-32407,
-32434,
-32464,
-32433,
-32388,
-32395,
-32413,
-32481,
-32450,
-32395,
-32252,
-32156,
-32119,
-32164,
-32200,
-32160,
-31966,
-31674,
-31404,
-31259,
-31292,
-31460,
-31575,
-31604,
-31405,
-31193,
-30992,
-31016,
-31185,
-31462,
-31651,
-31727,
-31622,
-31532,
-31451,
-31487,
-31569,
-31614,
-31606,
-31508,
-31450,
-31464,
-31564,
-31698,
-31735,
-31678,
-31525,
-31360,
-31326,
-31366,
-31543,
-31690,
-31850,
-31915,
-31946,
-31965,
-31952,
-32034,
-32178,
-32434,
-32731,
-32954,
-33061,
-33069,
-33082,
-33203,
-33415,
-33650,
-33734,
-33676,
-33533,
-33458,
-33471,
-33583,
-33604,
-33603,
-33552,
-33576,
-33744,
-33885,
-33973,
-33871,
-33726,
-33645,
-33749,
-33932,
-34120,
-34112,
-34008,
-33865,
-33793,
-33812,
-33793,
-33777,
-33728,
-33748,
-33855,
-33963,
-33988,
-33935,
-33826,
-33866,
-33949,
-34082,
-34035,
-33839,
-33628,
-33493,
-33568,
-33707,
-33740,
-33646,
-33454,
-33412,
-33539,
-33778,
-33893,
-33814,
-33531,
-33230,
-33071,
-33021,
-33052,
-32976,
-32877,
-32768,
-32793,
-32889,
-32965,
-32953,
-32823,
-32662,
-32599,
-32643,
-32778,
-32865,
-32847,
-32745,
-32608,
-32571,
-32610,
-32697,
-32749,
-32692,
-32546,
-32377,
-32221,
-32182,
-32147,
-32155,
-32151,
-32175,
-32258,
-32357,
-32395,
-32338,
-32138,
-31967,
-31898,
-32037,
-32305,
-32564,
-32738,
-32786,
-32766,
-32745,
-32724,
-32702,
-32688,
-32707,
-32834,
-33001,
-33155,
-33163,
-33060,
-32927,
-32898,
-33008,
-33188,
-33298,
-33232,
-33062,
-32872,
-32781,
-32783,
-32809,
-32796,
-32752,
-32757,
-32806,
-32913,
-32960,
-32967,
-32976,
-33031,
-33165,
-33316,
-33320,
-33264,
-33087,
-33074,
-33142,
-33397,
-33546,
-33616,
-33493,
-33345,
-33284,
-33263,
-33356,
-33329,
-33278,
-33128,
-33013,
-32969,
-32965,
-32992,
-32970,
-32875,
-32752,
-32628,
-32564,
-32550,
-32556,
-32576,
-32545,
-32531,
-32511,
-32495,
-32489,
-32464,
-32420,
-32374,
-32372,
-32361,
-32418,
-32425,
-32450,
-32445,
-32439,
-32428,
-32341,
-32219,
-32080,
-31980,
-32045,
-32145,
-32269,
-32241,
-32128,
-31908,
-31828,
-31828,
-31947,
-32060,
-32076,
-32046,
-31997,
-32010,
-32051,
-32055,
-32035,
-31967,
-31993,
-32071,
-32182,
-32243,
-32233,
-32220,
-32262,
-32406,
-32490,
-32516,
-32330,
-32149,
-32049,
-32150,
-32382,
-32599,
-32643,
-32545,
-32400,
-32336,
-32437,
-32571,
-32662,
-32603,
-32446,
-32314,
-32312,
-32453,
-32657,
-32770,
-32730,
-32603,
-32492,
-32554,
-32769,
-33018,
-33149,
-33080,
-32863,
-32702,
-32681,
-32858,
-33088,
-33186,
-33075,
-32817,
-32571,
-32483,
-32616,
-32790,
-32922,
-32858,
-32715,
-32600,
-32667,
-32872,
-33043,
-33057,
-32843,
-32571,
-32395,
-32445,
-32601,
-32729,
-32646,
-32452,
-32218,
-32216,
-32367,
-32612,
-32789,
-32737,
-32596,
-32377,
-32249,
-32238,
-32334,
-32488,
-32625,
-32703,
-32639,
-32505,
-32346,
-32313,
-32436,
-32648,
-32770,
-32715,
-32516,
-32351,
-32402,
-32620,
-32844,
-32873,
-32629,
-32398,
-32251,
-32435,
-32692,
-32849,
-32759,
-32514,
-32365,
-32438,
-32653,
-32835,
-32776,
-32608,
-32430,
-32449,
-32597,
-32744,
-32709,
-32549,
-32364,
-32355,
-32544,
-32816,
-33036,
-33112,
-33081,
-33046,
-33027,
-33093,
-33129,
-33195,
-33205,
-33245,
-33244,
-33260,
-33214,
-33228,
-33242,
-33327,
-33409,
-33438,
-33454,
-33459,
-33530,
-33644,
-33742,
-33782,
-33726,
-33649,
-33583,
-33640,
-33689,
-33780,
-33733,
-33654,
-33561,
-33530,
-33611,
-33736,
-33905,
-34000,
-34083,
-34091,
-34069,
-34035,
-34021,
-34019,
-34048,
-34071,
-34033,
-33957,
-33870,
-33828,
-33867,
-33956,
-33985,
-33931,
-33782,
-33647,
-33591,
-33642,
-33704,
-33667,
-33530,
-33328,
-33251,
-33306,
-33475,
-33602,
-33581,
-33396,
-33205,
-33057,
-33119,
-33255,
-33402,
-33477,
-33408,
-33308,
-33200,
-33176,
-33164,
-33162,
-33146,
-33043,
-33056,
-33037,
-33132,
-33203,
-33174,
-33060,
-32840,
-32649,
-32566,
-32632,
-32794,
-32949,
-32989,
-32877,
-32645,
-32418,
-32272,
-32279,
-32374,
-32510,
-32557,
-32509,
-32386,
-32251,
-32236,
-32305,
-32425,
-32501,
-32468,
-32411,
-32404,
-32479,
-32674,
-32730,
-32735,
-32542,
-32406,
-32385,
-32580,
-32839,
-33022,
-32998,
-32847,
-32688,
-32699,
-32839,
-33058,
-33172,
-33156,
-33070,
-32957,
-32963,
-33014,
-33120,
-33203,
-33224,
-33223,
-33185,
-33154,
-33150,
-33203,
-33314,
-33417,
-33472,
-33433,
-33301,
-33227,
-33147,
-33206,
-33226,
-33238,
-33125,
-33018,
-32900,
-32909,
-32993,
-33065,
-33082,
-33002,
-32902,
-32843,
-32927,
-33077,
-33272,
-33344,
-33287,
-33126,
-32950,
-32900,
-32907,
-33017,
-33048,
-33005,
-32862,
-32713,
-32588,
-32545,
-32488,
-32478,
-32393,
-32349,
-32289,
-32266,
-32234,
-32176,
-32106,
-32063,
-32066,
-32118,
-32176,
-32207,
-32161,
-32122,
-32039,
-32070,
-32090,
-32208,
-32265,
-32299,
-32268,
-32208,
-32124,
-32045,
-31985,
-31884,
-31808,
-31693,
-31624,
-31602,
-31625,
-31674,
-31688,
-31676,
-31610,
-31580,
-31568,
-31633,
-31681,
-31727,
-31695,
-31614,
-31579,
-31555,
-31600,
-31670,
-31682,
-31643,
-31569,
-31487,
-31496,
-31532,
-31585,
-31585,
-31548,
-31472,
-31465,
-31474,
-31554,
-31599,
-31559,
-31481,
-31354,
-31320,
-31374,
-31489,
-31566,
-31574,
-31477,
-31413,
-31411,
-31549,
-31745,
-31891,
-31938,
-31868,
-31784,
-31783,
-31846,
-31994,
-32074,
-32101,
-32025,
-31969,
-31902,
-31985,
-32036,
-32201,
-32268,
-32333,
-32332,
-32286,
-32273,
-32251,
-32289,
-32314,
-32331,
-32298,
-32258,
-32196,
-32214,
-32277,
-32368,
-32495,
-32529,
-32539,
-32464,
-32427,
-32395,
-32462,
-32518,
-32585,
-32591,
-32566,
-32494,
-32475,
-32428,
-32413,
-32351,
-32267,
-32189,
-32160,
-32216,
-32339,
-32476,
-32539,
-32528,
-32445,
-32331,
-32294,
-32274,
-32341,
-32350,
-32391,
-32393,
-32444,
-32532,
-32638,
-32690,
-32634,
-32492,
-32298,
-32248,
-32300,
-32472,
-32647,
-32671,
-32566,
-32323,
-32148,
-32101,
-32209,
-32355,
-32394,
-32240,
-31982,
-31734,
-31688,
-31848,
-32119,
-32335,
-32355,
-32229,
-32031,
-31987,
-32107,
-32349,
-32578,
-32613,
-32499,
-32299,
-32183,
-32247,
-32429,
-32617,
-32709,
-32590,
-32413,
-32255,
-32229,
-32338,
-32473,
-32535,
-32517,
-32448,
-32424,
-32521,
-32690,
-32940,
-33122,
-33275,
-33310,
-33321,
-33302,
-33333,
-33445,
-33587,
-33768,
-33806,
-33814,
-33729,
-33753,
-33899,
-34152,
-34316,
-34362,
-34209,
-34067,
-34080,
-34264,
-34527,
-34672,
-34616,
-34443,
-34336,
-34363,
-34546,
-34658,
-34682,
-34551,
-34448,
-34474,
-34578,
-34759,
-34825,
-34789,
-34749,
-34673,
-34714,
-34715,
-34697,
-34623,
-34561,
-34527,
-34578,
-34610,
-34633,
-34570,
-34510,
-34455,
-34485,
-34540,
-34593,
-34544,
-34429,
-34249,
-34118,
-34081,
-34111,
-34212,
-34224,
-34211,
-34108,
-34004,
-33910,
-33825,
-33742,
-33674,
-33646,
-33691,
-33797,
-33855,
-33842,
-33709,
-33559,
-33474,
-33524,
-33649,
-33756,
-33708,
-33512,
-33245,
-33056,
-33024,
-33157,
-33349,
-33450,
-33405,
-33187,
-32937,
-32743,
-32688,
-32742,
-32845,
-32891,
-32853,
-32763,
-32721,
-32751,
-32872,
-32963,
-32951,
-32845,
-32728,
-32763,
-32962,
-33298,
-33506,
-33526,
-33290,
-33022,
-32909,
-33032,
-33315,
-33529,
-33536,
-33334,
-33128,
-33049,
-33237,
-33521,
-33752,
-33780,
-33594,
-33376,
-33252,
-33364,
-33605,
-33900,
-34047,
-34044,
-33923,
-33809,
-33842,
-33983,
-34203,
-34341,
-34346,
-34201,
-34057,
-33955,
-34003,
-34131,
-34205,
-34215,
-34077,
-33938,
-33865,
-33848,
-33898,
-33882,
-33802,
-33724,
-33685,
-33766,
-33869,
-33925,
-33831,
-33647,
-33431,
-33304,
-33292,
-33312,
-33325,
-33251,
-33133,
-33007,
-32907,
-32852,
-32813,
-32723,
-32639,
-32441,
-32251,
-31993,
-31785,
-31655,
-31628,
-31667,
-31699,
-31660,
-31541,
-31426,
-31303,
-31317,
-31307,
-31317,
-31256,
-31154,
-31097,
-31095,
-31133,
-31205,
-31182,
-31176,
-31106,
-31144,
-31171,
-31232,
-31214,
-31114,
-30998,
-30894,
-30869,
-30931,
-30993,
-31058,
-31034,
-30979,
-30874,
-30811,
-30830,
-30914,
-31099,
-31229,
-31283,
-31254,
-31199,
-31256,
-31438,
-31714,
-31954,
-32015,
-31931,
-31759,
-31723,
-31861,
-32116,
-32346,
-32399,
-32287,
-32117,
-32042,
-32114,
-32344,
-32526,
-32636,
-32590,
-32458,
-32343,
-32297,
-32379,
-32524,
-32682,
-32756,
-32710,
-32604,
-32489,
-32532,
-32670,
-32889,
-32956,
-32864,
-32628,
-32459,
-32514,
-32742,
-33001,
-33069,
-32895,
-32628,
-32506,
-32566,
-32793,
-32879,
-32765,
-32463,
-32174,
-32083,
-32169,
-32322,
-32365,
-32258,
-32067,
-31943,
-31877,
-31864,
-31804,
-31670,
-31525,
-31414,
-31356,
-31368,
-31396,
-31469,
-31577,
-31677,
-31724,
-31657,
-31492,
-31392,
-31374,
-31523,
-31637,
-31664,
-31495,
-31280,
-31171,
-31210,
-31402,
-31526,
-31487,
-31326,
-31110,
-31040,
-31072,
-31217,
-31300,
-31328,
-31276,
-31198,
-31114,
-31060,
-31057,
-31154,
-31335,
-31509,
-31562,
-31443,
-31270,
-31218,
-31465,
-31907,
-32298,
-32417,
-32147,
-31777,
-31553,
-31675,
-32038,
-32335,
-32366,
-32075,
-31735,
-31570,
-31736,
-32097,
-32393,
-32468,
-32258,
-31982,
-31836,
-31912,
-32168,
-32384,
-32480,
-32377,
-32314,
-32358,
-32595,
-32885,
-33050,
-32988,
-32830,
-32686,
-32798,
-33067,
-33418,
-33640,
-33646,
-33497,
-33353,
-33271,
-33349,
-33432,
-33550,
-33573,
-33594,
-33572,
-33578,
-33551,
-33518,
-33477,
-33418,
-33409,
-33407,
-33444,
-33499,
-33522,
-33559,
-33502,
-33489,
-33432,
-33464,
-33521,
-33594,
-33631,
-33604,
-33535,
-33494,
-33472,
-33516,
-33514,
-33515,
-33469,
-33489,
-33569,
-33717,
-33818,
-33781,
-33588,
-33352,
-33175,
-33183,
-33310,
-33455,
-33461,
-33310,
-33078,
-32872,
-32870,
-32945,
-33133,
-33182,
-33138,
-33023,
-32961,
-33055,
-33222,
-33379,
-33394,
-33268,
-33144,
-33102,
-33225,
-33402,
-33461,
-33389,
-33193,
-33057,
-33100,
-33270,
-33484,
-33597,
-33582,
-33491,
-33441,
-33421,
-33468,
-33495,
-33493,
-33496,
-33456,
-33429,
-33371,
-33334,
-33373,
-33521,
-33725,
-33877,
-33886,
-33754,
-33608,
-33604,
-33725,
-33945,
-34069,
-34047,
-33939,
-33828,
-33858,
-33985,
-34121,
-34196,
-34175,
-34127,
-34124,
-34124,
-34128,
-34047,
-33924,
-33823,
-33809,
-33882,
-33976,
-33991,
-33900,
-33731,
-33629,
-33625,
-33791,
-33965,
-34098,
-34070,
-33915,
-33748,
-33676,
-33707,
-33850,
-33930,
-33933,
-33809,
-33675,
-33582,
-33604,
-33674,
-33711,
-33687,
-33556,
-33434,
-33338,
-33332,
-33384,
-33410,
-33364,
-33184,
-32906,
-32619,
-32415,
-32409,
-32549,
-32770,
-32896,
-32837,
-32678,
-32468,
-32403,
-32462,
-32603,
-32688,
-32650,
-32507,
-32404,
-32387,
-32555,
-32752,
-32874,
-32819,
-32599,
-32388,
-32320,
-32439,
-32684,
-32858,
-32817,
-32634,
-32383,
-32343,
-32468,
-32727,
-32904,
-32918,
-32774,
-32661,
-32611,
-32673,
-32765,
-32799,
-32841,
-32927,
-33069,
-33231,
-33280,
-33202,
-33071,
-33010,
-33086,
-33241,
-33359,
-33372,
-33364,
-33378,
-33523,
-33655,
-33722,
-33610,
-33457,
-33339,
-33404,
-33562,
-33708,
-33747,
-33667,
-33613,
-33646,
-33791,
-33958,
-34026,
-34045,
-33956,
-33912,
-33865,
-33833,
-33834,
-33862,
-33960,
-34068,
-34107,
-33999,
-33813,
-33604,
-33577,
-33671,
-33799,
-33809,
-33625,
-33332,
-33141,
-33110,
-33258,
-33412,
-33405,
-33237,
-32964,
-32789,
-32733,
-32805,
-32860,
-32810,
-32646,
-32435,
-32251,
-32202,
-32194,
-32280,
-32274,
-32212,
-32049,
-31857,
-31733,
-31685,
-31742,
-31764,
-31669,
-31431,
-31144,
-30961,
-30984,
-31160,
-31309,
-31285,
-31066,
-30772,
-30629,
-30673,
-30902,
-31025,
-30998,
-30799,
-30550,
-30466,
-30484,
-30608,
-30646,
-30576,
-30466,
-30334,
-30331,
-30373,
-30468,
-30539,
-30608,
-30660,
-30733,
-30798,
-30839,
-30829,
-30817,
-30779,
-30768,
-30812,
-30835,
-30930,
-30975,
-31080,
-31129,
-31225,
-31255,
-31313,
-31314,
-31322,
-31311,
-31311,
-31334,
-31347,
-31381,
-31352,
-31321,
-31254,
-31257,
-31357,
-31551,
-31736,
-31812,
-31680,
-31501,
-31360,
-31473,
-31733,
-32040,
-32171,
-32074,
-31860,
-31706,
-31714,
-31865,
-31972,
-31989,
-31893,
-31816,
-31840,
-31908,
-31936,
-31890,
-31750,
-31748,
-31793,
-32023,
-32138,
-32176,
-32049,
-31927,
-31886,
-31997,
-32151,
-32275,
-32262,
-32171,
-32028,
-31977,
-31967,
-32029,
-32091,
-32100,
-32119,
-32081,
-32111,
-32083,
-32081,
-31995,
-31945,
-31907,
-31983,
-32108,
-32245,
-32318,
-32320,
-32248,
-32246,
-32281,
-32397,
-32523,
-32564,
-32581,
-32550,
-32594,
-32714,
-32855,
-32983,
-32991,
-32930,
-32870,
-32881,
-33057,
-33286,
-33514,
-33620,
-33586,
-33500,
-33420,
-33450,
-33572,
-33687,
-33757,
-33721,
-33654,
-33615,
-33655,
-33770,
-33876,
-33923,
-33881,
-33798,
-33765,
-33789,
-33889,
-33966,
-33971,
-33915,
-33837,
-33860,
-33913,
-34074,
-34131,
-34129,
-34032,
-33902,
-33869,
-33855,
-33911,
-33935,
-33939,
-33900,
-33921,
-33884,
-33886,
-33825,
-33722,
-33635,
-33552,
-33536,
-33519,
-33478,
-33376,
-33271,
-33172,
-33189,
-33277,
-33366,
-33400,
-33281,
-33111,
-32939,
-32896,
-33019,
-33204,
-33389,
-33403,
-33279,
-33074,
-32888,
-32858,
-32918,
-33071,
-33179,
-33198,
-33149,
-33059,
-33017,
-33041,
-33113,
-33172,
-33206,
-33129,
-33054,
-32978,
-32921,
-32972,
-32983,
-33061,
-33071,
-33078,
-33030,
-33013,
-33005,
-33092,
-33204,
-33339,
-33365,
-33320,
-33207,
-33167,
-33249,
-33470,
-33663,
-33756,
-33676,
-33530,
-33455,
-33503,
-33629,
-33748,
-33742,
-33683,
-33617,
-33669,
-33766,
-33847,
-33824,
-33700,
-33574,
-33480,
-33499,
-33482,
-33496,
-33451,
-33452,
-33527,
-33612,
-33743,
-33781,
-33816,
-33801,
-33835,
-33839,
-33850,
-33829,
-33887,
-33985,
-34139,
-34220,
-34159,
-33981,
-33798,
-33702,
-33781,
-33904,
-33975,
-33904,
-33768,
-33658,
-33670,
-33731,
-33774,
-33707,
-33583,
-33472,
-33483,
-33567,
-33684,
-33709,
-33685,
-33632,
-33675,
-33804,
-33974,
-34073,
-34061,
-33959,
-33854,
-33855,
-33980,
-34145,
-34280,
-34237,
-34124,
-33942,
-33886,
-33915,
-34018,
-34019,
-33924,
-33709,
-33540,
-33486,
-33514,
-33672,
-33687,
-33728,
-33624,
-33581,
-33509,
-33529,
-33550,
-33669,
-33783,
-33939,
-33987,
-33904,
-33743,
-33527,
-33475,
-33483,
-33633,
-33691,
-33702,
-33611,
-33540,
-33537,
-33584,
-33636,
-33584,
-33479,
-33316,
-33232,
-33199,
-33227,
-33279,
-33274,
-33254,
-33242,
-33224,
-33273,
-33304,
-33324,
-33298,
-33223,
-33124,
-33025,
-32999,
-32997,
-33063,
-33120,
-33114,
-33074,
-32954,
-32837,
-32756,
-32712,
-32726,
-32720,
-32683,
-32582,
-32498,
-32389,
-32345,
-32296,
-32272,
-32232,
-32196,
-32133,
-32086,
-32039,
-32010,
-31999,
-32010,
-32014,
-31990,
-31944,
-31853,
-31784,
-31696,
-31638,
-31542,
-31435,
-31340,
-31246,
-31239,
-31223,
-31213,
-31122,
-31018,
-30902,
-30886,
-30898,
-30945,
-30856,
-30648,
-30356,
-30085,
-30005,
-30064,
-30243,
-30360,
-30321,
-30123,
-29862,
-29667,
-29662,
-29786,
-30017,
-30205,
-30307,
-30342,
-30334,
-30331,
-30360,
-30363,
-30387,
-30366,
-30399,
-30451,
-30535,
-30585,
-30626,
-30598,
-30633,
-30643,
-30710,
-30741,
-30760,
-30789,
-30847,
-30945,
-31044,
-31077,
-31069,
-31073,
-31117,
-31280,
-31387,
-31483,
-31453,
-31418,
-31460,
-31584,
-31787,
-31903,
-31969,
-31952,
-32012,
-32155,
-32340,
-32487,
-32488,
-32454,
-32379,
-32428,
-32514,
-32611,
-32643,
-32607,
-32588,
-32605,
-32688,
-32770,
-32769,
-32727,
-32676,
-32707,
-32851,
-33014,
-33179,
-33248,
-33252,
-33225,
-33233,
-33245,
-33305,
-33295,
-33263,
-33168,
-33067,
-33007,
-32964,
-32974,
-32989,
-32980,
-32997,
-32987,
-32977,
-32958,
-32885,
-32822,
-32712,
-32676,
-32646,
-32662,
-32679,
-32621,
-32586,
-32501,
-32481,
-32477,
-32524,
-32525,
-32515,
-32425,
-32345,
-32269,
-32258,
-32301,
-32371,
-32413,
-32369,
-32223,
-32030,
-31867,
-31801,
-31880,
-32019,
-32134,
-32164,
-32085,
-31997,
-31960,
-32003,
-32084,
-32110,
-32051,
-31962,
-31886,
-31916,
-32013,
-32078,
-32124,
-32063,
-32023,
-32023,
-32098,
-32200,
-32276,
-32281,
-32221,
-32171,
-32119,
-32160,
-32232,
-32346,
-32505,
-32574,
-32648,
-32625,
-32607,
-32659,
-32740,
-32899,
-32973,
-33023,
-32973,
-33007,
-33103,
-33260,
-33422,
-33395,
-33270,
-33074,
-33002,
-33121,
-33376,
-33637,
-33771,
-33708,
-33554,
-33419,
-33406,
-33556,
-33699,
-33825,
-33806,
-33742,
-33671,
-33684,
-33733,
-33825,
-33808,
-33815,
-33749,
-33814,
-33887,
-33969,
-33969,
-33899,
-33775,
-33757,
-33845,
-33979,
-34075,
-34035,
-33875,
-33714,
-33576,
-33578,
-33603,
-33699,
-33744,
-33826,
-33830,
-33798,
-33683,
-33512,
-33426,
-33456,
-33572,
-33728,
-33708,
-33624,
-33446,
-33397,
-33407,
-33458,
-33428,
-33319,
-33228,
-33256,
-33421,
-33600,
-33617,
-33436,
-33196,
-33065,
-33147,
-33377,
-33519,
-33463,
-33229,
-32967,
-32910,
-33059,
-33322,
-33532,
-33577,
-33477,
-33367,
-33275,
-33313,
-33373,
-33481,
-33528,
-33546,
-33512,
-33470,
-33446,
-33488,
-33575,
-33660,
-33676,
-33611,
-33511,
-33497,
-33629,
-33867,
-34128,
-34219,
-34155,
-33953,
-33794,
-33787,
-33934,
-34129,
-34297,
-34273,
-34252,
-34131,
-34187,
-34277,
-34470,
-34574,
-34645,
-34589,
-34536,
-34505,
-34539,
-34595,
-34638,
-34622,
-34530,
-34458,
-34394,
-34466,
-34536,
-34648,
-34616,
-34536,
-34352,
-34234,
-34207,
-34280,
-34405,
-34444,
-34390,
-34180,
-33954,
-33746,
-33651,
-33670,
-33691,
-33731,
-33643,
-33542,
-33382,
-33240,
-33131,
-33023,
-32946,
-32877,
-32841,
-32851,
-32900,
-32902,
-32857,
-32723,
-32583,
-32475,
-32457,
-32459,
-32459,
-32409,
-32310,
-32253,
-32231,
-32256,
-32289,
-32241,
-32184,
-32077,
-32027,
-31961,
-31941,
-31853,
-31823,
-31755,
-31757,
-31742,
-31714,
-31672,
-31684,
-31732,
-31828,
-31866,
-31798,
-31642,
-31471,
-31412,
-31477,
-31628,
-31716,
-31681,
-31545,
-31410,
-31398,
-31484,
-31625,
-31727,
-31689,
-31648,
-31580,
-31649,
-31777,
-31920,
-31982,
-31951,
-31831,
-31772,
-31777,
-31874,
-31989,
-32025,
-31961,
-31868,
-31781,
-31828,
-31955,
-32124,
-32200,
-32211,
-32118,
-32062,
-32052,
-32134,
-32231,
-32289,
-32300,
-32237,
-32242,
-32269,
-32379,
-32447,
-32483,
-32416,
-32384,
-32395,
-32543,
-32729,
-32920,
-32962,
-32852,
-32695,
-32534,
-32558,
-32683,
-32897,
-33016,
-33028,
-32877,
-32730,
-32627,
-32700,
-32861,
-33050,
-33150,
-33135,
-33022,
-32914,
-32859,
-32890,
-32928,
-32942,
-32850,
-32758,
-32683,
-32708,
-32800,
-32869,
-32815,
-32676,
-32470,
-32364,
-32376,
-32486,
-32590,
-32589,
-32508,
-32393,
-32314,
-32301,
-32286,
-32258,
-32230,
-32171,
-32201,
-32191,
-32257,
-32246,
-32314,
-32347,
-32367,
-32309,
-32097,
-31910,
-31756,
-31854,
-32064,
-32279,
-32337,
-32195,
-32026,
-31962,
-32108,
-32291,
-32370,
-32217,
-31954,
-31751,
-31813,
-32013,
-32297,
-32401,
-32348,
-32182,
-32036,
-31973,
-31960,
-31966,
-32020,
-32083,
-32211,
-32264,
-32251,
-32178,
-32121,
-32220,
-32359,
-32439,
-32369,
-32075,
-31901,
-31862,
-32158,
-32459,
-32661,
-32578,
-32363,
-32281,
-32342,
-32556,
-32652,
-32532,
-32340,
-32208,
-32336,
-32641,
-32902,
-32982,
-32887,
-32758,
-32773,
-32854,
-32938,
-32893,
-32744,
-32629,
-32636,
-32710,
-32809,
-32816,
-32796,
-32830,
-32902,
-32951,
-32879,
-32672,
-32498,
-32465,
-32618,
-32781,
-32819,
-32615,
-32385,
-32259,
-32383,
-32599,
-32698,
-32547,
-32240,
-31998,
-32038,
-32283,
-32632,
-32760,
-32716,
-32496,
-32344,
-32297,
-32349,
-32431,
-32410,
-32355,
-32239,
-32137,
-32081,
-32072,
-32149,
-32334,
-32519,
-32634,
-32589,
-32402,
-32170,
-32066,
-32087,
-32226,
-32339,
-32402,
-32455,
-32532,
-32655,
-32726,
-32689,
-32545,
-32438,
-32450,
-32587,
-32705,
-32672,
-32500,
-32376,
-32476,
-32812,
-33224,
-33414,
-33248,
-32905,
-32580,
-32565,
-32807,
-33081,
-33200,
-33085,
-32858,
-32778,
-32919,
-33197,
-33414,
-33341,
-33066,
-32707,
-32636,
-32817,
-33244,
-33526,
-33520,
-33216,
-32884,
-32770,
-32952,
-33222,
-33362,
-33224,
-32996,
-32914,
-33076,
-33400,
-33570,
-33474,
-33191,
-32999,
-33084,
-33413,
-33722,
-33745,
-33488,
-33115,
-32916,
-33029,
-33299,
-33564,
-33590,
-33426,
-33220,
-33111,
-33240,
-33414,
-33559,
-33458,
-33199,
-32918,
-32796,
-32946,
-33236,
-33513,
-33582,
-33452,
-33257,
-33166,
-33242,
-33459,
-33642,
-33712,
-33648,
-33413,
-33226,
-33033,
-33046,
-33187,
-33454,
-33667,
-33676,
-33428,
-33043,
-32748,
-32740,
-33034,
-33396,
-33597,
-33466,
-33110,
-32794,
-32679,
-32831,
-33104,
-33243,
-33225,
-33064,
-32916,
-32919,
-33016,
-33188,
-33262,
-33257,
-33140,
-33053,
-32993,
-33041,
-33087,
-33123,
-33036,
-32849,
-32633,
-32480,
-32514,
-32685,
-32923,
-33034,
-33012,
-32846,
-32719,
-32768,
-32963,
-33230,
-33323,
-33217,
-32917,
-32655,
-32561,
-32676,
-32913,
-33094,
-33137,
-33028,
-32919,
-32865,
-32943,
-32992,
-33018,
-32902,
-32816,
-32815,
-33001,
-33310,
-33541,
-33556,
-33275,
-32848,
-32517,
-32490,
-32783,
-33247,
-33562,
-33534,
-33190,
-32779,
-32647,
-32969,
-33588,
-34153,
-34305,
-33959,
-33381,
-32922,
-32859,
-33101,
-33428,
-33546,
-33446,
-33212,
-33064,
-33018,
-33044,
-33010,
-32974,
-32914,
-32897,
-32868,
-32775,
-32720,
-32742,
-32961,
-33203,
-33337,
-33106,
-32709,
-32313,
-32343,
-32694,
-33162,
-33295,
-33101,
-32715,
-32625,
-32930,
-33439,
-33762,
-33562,
-33004,
-32453,
-32273,
-32522,
-32931,
-33204,
-33139,
-32919,
-32672,
-32589,
-32603,
-32650,
-32672,
-32655,
-32686,
-32664,
-32700,
-32668,
-32730,
-32848,
-33060,
-33194,
-33194,
-33000,
-32811,
-32777,
-32980,
-33371,
-33652,
-33776,
-33573,
-33284,
-33016,
-32938,
-33053,
-33253,
-33470,
-33591,
-33661,
-33628,
-33596,
-33502,
-33401,
-33316,
-33223,
-33245,
-33279,
-33418,
-33479,
-33487,
-33375,
-33194,
-33010,
-32887,
-32847,
-32899,
-33020,
-33153,
-33305,
-33354,
-33292,
-33097,
-32853,
-32723,
-32765,
-32973,
-33185,
-33270,
-33118,
-32859,
-32610,
-32504,
-32577,
-32664,
-32725,
-32682,
-32625,
-32593,
-32603,
-32588,
-32473,
-32250,
-31959,
-31762,
-31690,
-31799,
-32016,
-32252,
-32423,
-32453,
-32335,
-32136,
-31963,
-31866,
-31931,
-32003,
-32034,
-31930,
-31751,
-31667,
-31738,
-31926,
-32087,
-32039,
-31832,
-31624,
-31561,
-31745,
-31911,
-31925,
-31678,
-31352,
-31228,
-31365,
-31709,
-31928,
-31958,
-31787,
-31668,
-31700,
-31847,
-31928,
-31841,
-31659,
-31555,
-31688,
-31979,
-32205,
-32255,
-32063,
-31900,
-31806,
-31908,
-31989,
-32061,
-32016,
-32008,
-32025,
-32068,
-32063,
-31955,
-31892,
-31902,
-32023,
-32145,
-32118,
-31980,
-31880,
-31946,
-32221,
-32451,
-32490,
-32236,
-31985,
-31929,
-32127,
-32421,
-32463,
-32294,
-31984,
-31996,
-32222,
-32606,
-32714,
-32419,
-31984,
-31731,
-31915,
-32377,
-32710,
-32669,
-32294,
-31934,
-31912,
-32224,
-32605,
-32737,
-32492,
-32086,
-31815,
-31891,
-32230,
-32669,
-32880,
-32859,
-32575,
-32262,
-32037,
-32056,
-32290,
-32597,
-32814,
-32759,
-32482,
-32144,
-32032,
-32181,
-32541,
-32743,
-32653,
-32300,
-32022,
-32100,
-32539,
-33069,
-33201,
-32868,
-32186,
-31712,
-31704,
-32248,
-32871,
-33256,
-33090,
-32634,
-32113,
-31921,
-32004,
-32371,
-32680,
-32910,
-32887,
-32717,
-32477,
-32320,
-32370,
-32664,
-33022,
-33280,
-33237,
-33020,
-32741,
-32721,
-32882,
-33118,
-33210,
-33096,
-32950,
-32954,
-33208,
-33516,
-33668,
-33522,
-33220,
-32985,
-33006,
-33164,
-33301,
-33226,
-32995,
-32823,
-32854,
-33146,
-33438,
-33641,
-33576,
-33397,
-33178,
-33063,
-32976,
-32981,
-32973,
-33043,
-33158,
-33246,
-33295,
-33225,
-33105,
-33050,
-32993,
-33029,
-32968,
-32888,
-32827,
-32835,
-32931,
-33011,
-32954,
-32823,
-32602,
-32569,
-32622,
-32765,
-32805,
-32678,
-32534,
-32419,
-32471,
-32578,
-32595,
-32547,
-32448,
-32474,
-32575,
-32624,
-32506,
-32236,
-32044,
-32134,
-32480,
-32832,
-32875,
-32645,
-32353,
-32376,
-32701,
-33075,
-33141,
-32856,
-32480,
-32474,
-32849,
-33345,
-33477,
-33057,
-32470,
-32129,
-32411,
-32959,
-33406,
-33326,
-32966,
-32702,
-32891,
-33397,
-33800,
-33771,
-33341,
-32890,
-32809,
-33153,
-33682,
-34008,
-33955,
-33672,
-33430,
-33486,
-33757,
-34080,
-34159,
-33981,
-33671,
-33434,
-33479,
-33774,
-34086,
-34261,
-34138,
-33861,
-33587,
-33542,
-33659,
-33892,
-34059,
-34135,
-34144,
-34177,
-34249,
-34324,
-34345,
-34287,
-34222,
-34185,
-34205,
-34209,
-34157,
-33972,
-33752,
-33550,
-33516,
-33637,
-33930,
-34234,
-34500,
-34647,
-34671,
-34605,
-34482,
-34321,
-34118,
-33915,
-33694,
-33545,
-33464,
-33459,
-33508,
-33497,
-33440,
-33293,
-33169,
-33153,
-33245,
-33427,
-33540,
-33523,
-33380,
-33163,
-33014,
-32898,
-32802,
-32639,
-32396,
-32178,
-32121,
-32275,
-32612,
-32934,
-33107,
-33040,
-32824,
-32655,
-32632,
-32817,
-32975,
-32971,
-32668,
-32246,
-31864,
-31783,
-31866,
-32040,
-31985,
-31798,
-31518,
-31495,
-31664,
-31995,
-32178,
-32100,
-31899,
-31672,
-31647,
-31698,
-31658,
-31485,
-31233,
-31151,
-31412,
-31875,
-32342,
-32511,
-32318,
-31943,
-31597,
-31520,
-31651,
-31923,
-32122,
-32184,
-32099,
-31931,
-31809,
-31782,
-31928,
-32162,
-32410,
-32504,
-32465,
-32365,
-32338,
-32518,
-32754,
-32920,
-32790,
-32425,
-32024,
-31863,
-32043,
-32436,
-32805,
-32942,
-32869,
-32693,
-32525,
-32393,
-32337,
-32327,
-32588,
-33027,
-33462,
-33592,
-33159,
-32441,
-31864,
-31935,
-32595,
-33416,
-33762,
-33488,
-32886,
-32575,
-32767,
-33275,
-33490,
-33077,
-32230,
-31510,
-31407,
-31936,
-32625,
-32952,
-32739,
-32168,
-31788,
-31733,
-32112,
-32513,
-32767,
-32702,
-32474,
-32176,
-32010,
-31996,
-32068,
-32183,
-32222,
-32140,
-31978,
-31762,
-31667,
-31732,
-31953,
-32257,
-32476,
-32494,
-32266,
-31913,
-31562,
-31365,
-31395,
-31545,
-31737,
-31823,
-31816,
-31794,
-31800,
-31902,
-32004,
-32005,
-31863,
-31620,
-31473,
-31644,
-32138,
-32765,
-33152,
-32958,
-32304,
-31525,
-31271,
-31766,
-32783,
-33676,
-33882,
-33315,
-32534,
-32085,
-32365,
-32979,
-33429,
-33299,
-32770,
-32395,
-32588,
-33328,
-34108,
-34347,
-33909,
-33091,
-32564,
-32708,
-33492,
-34363,
-34804,
-34519,
-33768,
-33085,
-32900,
-33289,
-33888,
-34245,
-34072,
-33583,
-33190,
-33266,
-33844,
-34574,
-34953,
-34776,
-34107,
-33406,
-33002,
-33105,
-33485,
-33881,
-34017,
-33911,
-33690,
-33542,
-33454,
-33387,
-33139,
-32884,
-32681,
-32814,
-33191,
-33575,
-33669,
-33372,
-32879,
-32544,
-32543,
-32857,
-33201,
-33403,
-33409,
-33322,
-33178,
-32907,
-32485,
-32018,
-31834,
-32091,
-32666,
-33087,
-32949,
-32272,
-31477,
-31185,
-31497,
-32190,
-32609,
-32552,
-32177,
-32006,
-32273,
-32769,
-32997,
-32564,
-31695,
-30895,
-30693,
-31167,
-31883,
-32343,
-32290,
-31916,
-31641,
-31755,
-32244,
-32736,
-32905,
-32607,
-32065,
-31640,
-31639,
-32019,
-32488,
-32736,
-32617,
-32317,
-32115,
-32187,
-32459,
-32683,
-32755,
-32647,
-32649,
-32735,
-32926,
-32939,
-32807,
-32592,
-32543,
-32740,
-32932,
-33012,
-32817,
-32619,
-32595,
-32800,
-32958,
-32945,
-32706,
-32747,
-33264,
-34168,
-34872,
-34801,
-33904,
-32874,
-32352,
-32777,
-33605,
-34153,
-33972,
-33298,
-32821,
-32953,
-33512,
-33901,
-33607,
-32820,
-32115,
-32144,
-32906,
-33975,
-34615,
-34580,
-33999,
-33333,
-32963,
-32948,
-33214,
-33540,
-33804,
-33904,
-33805,
-33500,
-33193,
-33054,
-33203,
-33578,
-33866,
-33896,
-33656,
-33438,
-33427,
-33643,
-33769,
-33533,
-32951,
-32403,
-32246,
-32656,
-33237,
-33552,
-33282,
-32715,
-32219,
-32287,
-32736,
-33293,
-33516,
-33328,
-32983,
-32736,
-32767,
-32929,
-33064,
-33105,
-33094,
-33134,
-33186,
-33136,
-32927,
-32575,
-32294,
-32198,
-32352,
-32618,
-32851,
-32909,
-32804,
-32564,
-32273,
-32038,
-31932,
-32025,
-32258,
-32460,
-32459,
-32239,
-31898,
-31797,
-32008,
-32487,
-32839,
-32849,
-32470,
-32129,
-32073,
-32453,
-32877,
-32991,
-32652,
-32097,
-31802,
-31922,
-32334,
-32605,
-32482,
-32109,
-31847,
-31970,
-32453,
-32927,
-33049,
-32840,
-32405,
-32205,
-32203,
-32441,
-32558,
-32557,
-32383,
-32256,
-32258,
-32366,
-32584,
-32661,
-32704,
-32573,
-32452,
-32331,
-32335,
-32436,
-32678,
-32873,
-32990,
-32893,
-32679,
-32405,
-32205,
-32171,
-32201,
-32274,
-32253,
-32145,
-31970,
-31862,
-31844,
-31992,
-32196,
-32372,
-32411,
-32242,
-31955,
-31617,
-31461,
-31460,
-31707,
-32021,
-32320,
-32471,
-32412,
-32188,
-31941,
-31892,
-32137,
-32657,
-33093,
-33188,
-32785,
-32188,
-31829,
-32026,
-32690,
-33254,
-33255,
-32588,
-31644,
-31143,
-31349,
-32137,
-32945,
-33270,
-33067,
-32599,
-32153,
-31885,
-31694,
-31568,
-31580,
-31956,
-32600,
-33296,
-33579,
-33286,
-32653,
-32122,
-32099,
-32563,
-33231,
-33756,
-33960,
-33968,
-33774,
-33547,
-33081,
-32558,
-32032,
-31852,
-32011,
-32479,
-32941,
-33251,
-33368,
-33425,
-33465,
-33466,
-33401,
-33302,
-33375,
-33715,
-34194,
-34482,
-34285,
-33605,
-32888,
-32642,
-33146,
-34179,
-35150,
-35466,
-34975,
-33978,
-33080,
-32739,
-33066,
-33737,
-34361,
-34545,
-34318,
-33851,
-33415,
-33115,
-32966,
-32837,
-32861,
-33011,
-33435,
-33862,
-34113,
-33866,
-33373,
-32943,
-32994,
-33554,
-34189,
-34474,
-34209,
-33677,
-33347,
-33438,
-33770,
-33862,
-33501,
-32872,
-32443,
-32606,
-33263,
-33927,
-34131,
-33702,
-32922,
-32242,
-31999,
-32161,
-32545,
-32863,
-33052,
-33116,
-33198,
-33242,
-33292,
-33169,
-32968,
-32726,
-32653,
-32832,
-33217,
-33603,
-33799,
-33682,
-33427,
-33138,
-33020,
-32923,
-32899,
-32800,
-32769,
-32773,
-32754,
-32526,
-32007,
-31387,
-31113,
-31451,
-32397,
-33360,
-33803,
-33421,
-32502,
-31612,
-31242,
-31390,
-31812,
-32121,
-32273,
-32342,
-32464,
-32589,
-32561,
-32267,
-31905,
-31713,
-31934,
-32477,
-33007,
-33200,
-32966,
-32444,
-31987,
-31842,
-31968,
-32349,
-32619,
-32751,
-32649,
-32376,
-32150,
-32017,
-32112,
-32400,
-32767,
-33072,
-33231,
-33243,
-33184,
-33167,
-33171,
-33202,
-33161,
-33103,
-33025,
-33078,
-33173,
-33316,
-33329,
-33269,
-33104,
-33120,
-33260,
-33645,
-33960,
-34119,
-33937,
-33555,
-33143,
-32956,
-33075,
-33376,
-33640,
-33672,
-33425,
-33071,
-32795,
-32690,
-32747,
-32872,
-32997,
-33183,
-33410,
-33638,
-33682,
-33480,
-33075,
-32747,
-32702,
-32976,
-33285,
-33343,
-32992,
-32406,
-31963,
-31846,
-32153,
-32515,
-32880,
-32989,
-33076,
-33044,
-32971,
-32703,
-32314,
-31950,
-31829,
-32016,
-32329,
-32543,
-32482,
-32217,
-31964,
-31921,
-32033,
-32218,
-32239,
-32133,
-31983,
-31909,
-31908,
-31914,
-31769,
-31531,
-31256,
-31106,
-31125,
-31350,
-31628,
-31921,
-32099,
-32088,
-31915,
-31598,
-31327,
-31277,
-31501,
-31916,
-32259,
-32344,
-32139,
-31818,
-31617,
-31658,
-31821,
-31980,
-31954,
-31839,
-31799,
-31952,
-32289,
-32587,
-32595,
-32279,
-31753,
-31368,
-31329,
-31668,
-32139,
-32432,
-32386,
-32071,
-31827,
-31845,
-32242,
-32710,
-33029,
-32970,
-32680,
-32385,
-32325,
-32497,
-32729,
-32827,
-32773,
-32651,
-32601,
-32699,
-32885,
-33052,
-33196,
-33247,
-33330,
-33328,
-33265,
-33081,
-32866,
-32714,
-32677,
-32719,
-32765,
-32689,
-32514,
-32359,
-32303,
-32469,
-32701,
-32894,
-32892,
-32736,
-32575,
-32598,
-32893,
-33289,
-33518,
-33410,
-32933,
-32377,
-32033,
-32036,
-32331,
-32626,
-32770,
-32744,
-32676,
-32676,
-32767,
-32748,
-32558,
-32138,
-31744,
-31589,
-31767,
-32196,
-32533,
-32536,
-32137,
-31499,
-31035,
-30940,
-31283,
-31796,
-32226,
-32386,
-32388,
-32322,
-32357,
-32361,
-32277,
-32026,
-31791,
-31757,
-31975,
-32355,
-32548,
-32443,
-32063,
-31686,
-31596,
-31867,
-32347,
-32756,
-32889,
-32707,
-32358,
-32071,
-31948,
-32096,
-32329,
-32627,
-32781,
-32800,
-32684,
-32523,
-32433,
-32512,
-32762,
-33167,
-33557,
-33783,
-33728,
-33471,
-33163,
-33079,
-33303,
-33701,
-34061,
-34088,
-33813,
-33450,
-33285,
-33446,
-33843,
-34136,
-34212,
-33997,
-33743,
-33662,
-33800,
-34055,
-34232,
-34235,
-34091,
-33909,
-33801,
-33722,
-33715,
-33683,
-33662,
-33718,
-33778,
-33997,
-34194,
-34468,
-34601,
-34587,
-34264,
-33785,
-33311,
-33136,
-33427,
-34053,
-34735,
-35060,
-34854,
-34241,
-33564,
-33221,
-33399,
-33910,
-34483,
-34767,
-34616,
-34309,
-33963,
-33923,
-33994,
-34092,
-33971,
-33727,
-33570,
-33711,
-34072,
-34464,
-34450,
-34064,
-33482,
-33135,
-33257,
-33712,
-34149,
-34167,
-33782,
-33137,
-32631,
-32450,
-32549,
-32878,
-33179,
-33468,
-33582,
-33555,
-33368,
-33162,
-33097,
-33272,
-33586,
-33793,
-33646,
-33173,
-32574,
-32266,
-32368,
-32802,
-33277,
-33516,
-33528,
-33410,
-33342,
-33334,
-33286,
-33141,
-32898,
-32767,
-32812,
-33000,
-33222,
-33225,
-33042,
-32652,
-32347,
-32156,
-32199,
-32409,
-32702,
-33047,
-33299,
-33494,
-33441,
-33279,
-32937,
-32639,
-32441,
-32450,
-32622,
-32800,
-32874,
-32748,
-32497,
-32291,
-32226,
-32358,
-32598,
-32844,
-33052,
-33241,
-33417,
-33476,
-33328,
-32822,
-32112,
-31471,
-31158,
-31334,
-31791,
-32206,
-32370,
-32211,
-31964,
-31784,
-31814,
-31941,
-32084,
-32132,
-32111,
-32057,
-31976,
-31818,
-31566,
-31235,
-30941,
-30764,
-30740,
-30848,
-30992,
-31111,
-31187,
-31148,
-31075,
-30942,
-30889,
-30934,
-31121,
-31298,
-31385,
-31209,
-30848,
-30425,
-30101,
-29994,
-30040,
-30128,
-30216,
-30296,
-30461,
-30743,
-31019,
-31235,
-31228,
-31065,
-30809,
-30572,
-30392,
-30281,
-30203,
-30223,
-30345,
-30547,
-30722,
-30775,
-30678,
-30541,
-30483,
-30578,
-30841,
-31086,
-31339,
-31462,
-31639,
-31790,
-31961,
-32028,
-31935,
-31762,
-31556,
-31456,
-31507,
-31684,
-31940,
-32217,
-32463,
-32638,
-32696,
-32677,
-32604,
-32630,
-32757,
-32946,
-33093,
-33037,
-32848,
-32609,
-32563,
-32733,
-33170,
-33615,
-34022,
-34291,
-34465,
-34669,
-34771,
-34887,
-34758,
-34583,
-34324,
-34270,
-34409,
-34774,
-35149,
-35381,
-35350,
-35084,
-34747,
-34467,
-34374,
-34435,
-34578,
-34710,
-34789,
-34862,
-34997,
-35171,
-35372,
-35454,
-35366,
-35149,
-34899,
-34791,
-34880,
-35127,
-35377,
-35495,
-35521,
-35475,
-35530,
-35651,
-35780,
-35762,
-35620,
-35395,
-35274,
-35292,
-35357,
-35348,
-35154,
-34846,
-34607,
-34549,
-34735,
-34982,
-35150,
-35125,
-34952,
-34727,
-34565,
-34453,
-34379,
-34278,
-34188,
-34165,
-34272,
-34494,
-34760,
-34899,
-34858,
-34592,
-34279,
-34027,
-34000,
-34198,
-34489,
-34822,
-35027,
-35157,
-35169,
-35150,
-35046,
-34884,
-34634,
-34364,
-34154,
-34048,
-34083,
-34093,
-34011,
-33756,
-33404,
-33091,
-32952,
-32932,
-32967,
-32892,
-32703,
-32550,
-32546,
-32729,
-32964,
-33082,
-33087,
-33010,
-33121,
-33351,
-33688,
-33849,
-33794,
-33600,
-33424,
-33348,
-33296,
-33103,
-32806,
-32470,
-32385,
-32504,
-32763,
-32795,
-32536,
-32015,
-31538,
-31286,
-31241,
-31272,
-31163,
-30931,
-30731,
-30684,
-30893,
-31153,
-31337,
-31307,
-31132,
-30946,
-30854,
-30876,
-31015,
-31150,
-31271,
-31295,
-31179,
-30995,
-30800,
-30667,
-30687,
-30686,
-30659,
-30369,
-30040,
-29695,
-29618,
-29768,
-30009,
-30147,
-30038,
-29832,
-29605,
-29548,
-29589,
-29651,
-29629,
-29571,
-29540,
-29571,
-29606,
-29532,
-29304,
-29044,
-28844,
-28862,
-28985,
-29162,
-29221,
-29240,
-29255,
-29381,
-29551,
-29722,
-29806,
-29878,
-29993,
-30172,
-30366,
-30387,
-30232,
-29893,
-29591,
-29403,
-29345,
-29364,
-29364,
-29346,
-29294,
-29197,
-29000,
-28715,
-28398,
-28248,
-28349,
-28670,
-28984,
-29076,
-28913,
-28630,
-28521,
-28629,
-28933,
-29169,
-29236,
-29219,
-29333,
-29760,
-30432,
-31096,
-31473,
-31471,
-31219,
-31016,
-31066,
-31385,
-31796,
-32031,
-32002,
-31768,
-31592,
-31582,
-31812,
-32099,
-32191,
-32069,
-31645,
-31294,
-31054,
-31120,
-31327,
-31550,
-31668,
-31633,
-31592,
-31568,
-31651,
-31793,
-31986,
-32209,
-32513,
-32901,
-33395,
-33941,
-34449,
-34870,
-35105,
-35241,
-35283,
-35396,
-35570,
-35854,
-36097,
-36251,
-36214,
-36087,
-35900,
-35808,
-35766,
-35722,
-35613,
-35356,
-35087,
-34854,
-34753,
-34770,
-34815,
-34943,
-35072,
-35381,
-35781,
-36308,
-36840,
-37232,
-37564,
-37777,
-38031,
-38340,
-38629,
-38920,
-39094,
-39207,
-39268,
-39285,
-39252,
-39124,
-38843,
-38499,
-38115,
-37866,
-37733,
-37728,
-37746,
-37704,
-37596,
-37503,
-37446,
-37485,
-37530,
-37512,
-37405,
-37288,
-37214,
-37332,
-37502,
-37720,
-37819,
-37811,
-37732,
-37698,
-37706,
-37798,
-37795,
-37754,
-37561,
-37335,
-37106,
-36901,
-36716,
-36440,
-36111,
-35637,
-35189,
-34748,
-34390,
-34100,
-33795,
-33494,
-33183,
-32951,
-32864,
-32892,
-33049,
-33216,
-33382,
-33497,
-33610,
-33672,
-33743,
-33736,
-33668,
-33557,
-33409,
-33289,
-33194,
-33110,
-32980,
-32826,
-32606,
-32457,
-32346,
-32322,
-32296,
-32227,
-32058,
-31860,
-31637,
-31519,
-31410,
-31363,
-31277,
-31204,
-31117,
-31119,
-31128,
-31237,
-31345,
-31515,
-31721,
-31966,
-32247,
-32475,
-32664,
-32761,
-32816,
-32830,
-32835,
-32811,
-32741,
-32602,
-32428,
-32251,
-32198,
-32230,
-32436,
-32613,
-32828,
-32907,
-32996,
-33020,
-33038,
-32992,
-32905,
-32814,
-32896,
-33109,
-33468,
-33710,
-33730,
-33497,
-33208,
-33030,
-33090,
-33240,
-33377,
-33354,
-33338,
-33394,
-33695,
-34000,
-34193,
-34017,
-33633,
-33192,
-32989,
-33069,
-33319,
-33523,
-33524,
-33309,
-32987,
-32640,
-32362,
-32105,
-31910,
-31672,
-31519,
-31359,
-31299,
-31276,
-31262,
-31243,
-31182,
-31067,
-30963,
-30860,
-30789,
-30793,
-30771,
-30761,
-30725,
-30624,
-30515,
-30319,
-30098,
-29871,
-29647,
-29590,
-29596,
-29765,
-29897,
-29945,
-29813,
-29499,
-29111,
-28704,
-28417,
-28210,
-28090,
-27997,
-27892,
-27796,
-27710,
-27602,
-27452,
-27218,
-26915,
-26619,
-26496,
-26557,
-26867,
-27270,
-27616,
-27850,
-27907,
-27941,
-27985,
-28076,
-28194,
-28199,
-28173,
-28095,
-28090,
-28171,
-28246,
-28207,
-27977,
-27561,
-27137,
-26735,
-26500,
-26324,
-26204,
-26100,
-26100,
-26239,
-26562,
-26954,
-27341,
-27623,
-27783,
-27907,
-28071,
-28364,
-28800,
-29349,
-29901,
-30401,
-30749,
-30983,
-31101,
-31208,
-31273,
-31364,
-31359,
-31338,
-31176,
-31038,
-30864,
-30725,
-30612,
-30505,
-30386,
-30318,
-30263,
-30323,
-30470,
-30688,
-30965,
-31245,
-31540,
-31857,
-32227,
-32660,
-33171,
-33718,
-34233,
-34701,
-35032,
-35295,
-35508,
-35700,
-35956,
-36220,
-36486,
-36658,
-36697,
-36587,
-36399,
-36190,
-36043,
-35961,
-35905,
-35785,
-35615,
-35427,
-35297,
-35348,
-35518,
-35794,
-36029,
-36212,
-36385,
-36581,
-36907,
-37219,
-37525,
-37672,
-37738,
-37767,
-37911,
-38149,
-38461,
-38700,
-38833,
-38804,
-38739,
-38629,
-38529,
-38449,
-38259,
-38050,
-37773,
-37565,
-37443,
-37379,
-37313,
-37128,
-36856,
-36500,
-36220,
-36039,
-35969,
-35903,
-35809,
-35641,
-35543,
-35534,
-35709,
-35958,
-36223,
-36398,
-36435,
-36407,
-36332,
-36272,
-36241,
-36218,
-36145,
-36061,
-35889,
-35704,
-35465,
-35189,
-34853,
-34508,
-34154,
-33872,
-33636,
-33437,
-33230,
-33004,
-32777,
-32588,
-32402,
-32293,
-32149,
-32084,
-32076,
-32203,
-32388,
-32553,
-32617,
-32543,
-32459,
-32473,
-32675,
-33020,
-33332,
-33494,
-33431,
-33168,
-32910,
-32631,
-32530,
-32404,
-32310,
-32116,
-31882,
-31612,
-31366,
-31201,
-31058,
-31022,
-31037,
-31099,
-31257,
-31396,
-31528,
-31604,
-31675,
-31772,
-32015,
-32322,
-32743,
-33046,
-33291,
-33364,
-33387,
-33402,
-33457,
-33520,
-33587,
-33578,
-33522,
-33455,
-33367,
-33357,
-33361,
-33378,
-33410,
-33373,
-33345,
-33267,
-33219,
-33207,
-33274,
-33423,
-33608,
-33837,
-33974,
-34151,
-34217,
-34333,
-34444,
-34550,
-34721,
-34838,
-34989,
-35104,
-35219,
-35280,
-35333,
-35295,
-35248,
-35156,
-35066,
-35008,
-34960,
-34938,
-34874,
-34809,
-34664,
-34577,
-34440,
-34386,
-34357,
-34393,
-34501,
-34636,
-34806,
-34880,
-34900,
-34831,
-34752,
-34770,
-34884,
-35087,
-35321,
-35429,
-35420,
-35242,
-35008,
-34753,
-34626,
-34534,
-34580,
-34546,
-34534,
-34402,
-34188,
-33900,
-33504,
-33101,
-32694,
-32408,
-32267,
-32283,
-32409,
-32505,
-32537,
-32443,
-32278,
-32079,
-31857,
-31669,
-31482,
-31373,
-31320,
-31320,
-31315,
-31260,
-31137,
-30948,
-30753,
-30531,
-30295,
-30039,
-29845,
-29808,
-29948,
-30186,
-30305,
-30187,
-29823,
-29360,
-29031,
-28869,
-28848,
-28717,
-28441,
-28049,
-27734,
-27626,
-27712,
-27797,
-27739,
-27494,
-27138,
-26876,
-26778,
-26859,
-26962,
-27086,
-27081,
-27059,
-26989,
-26912,
-26833,
-26734,
-26628,
-26512,
-26400,
-26274,
-26219,
-26207,
-26299,
-26371,
-26460,
-26422,
-26428,
-26438,
-26664,
-26995,
-27445,
-27832,
-28120,
-28335,
-28534,
-28801,
-29143,
-29470,
-29744,
-29885,
-29937,
-29892,
-29841,
-29750,
-29618,
-29461,
-29244,
-29138,
-29029,
-29068,
-29062,
-29030,
-28910,
-28825,
-28817,
-29072,
-29489,
-30076,
-30638,
-31115,
-31519,
-31889,
-32333,
-32847,
-33407,
-33960,
-34487,
-34943,
-35369,
-35676,
-35887,
-35941,
-35921,
-35834,
-35785,
-35704,
-35609,
-35410,
-35128,
-34791,
-34457,
-34181,
-33973,
-33871,
-33813,
-33898,
-34008,
-34244,
-34476,
-34762,
-35080,
-35415,
-35855,
-36296,
-36779,
-37193,
-37526,
-37788,
-37931,
-38110,
-38174,
-38278,
-38218,
-38093,
-37817,
-37508,
-37185,
-36882,
-36628,
-36309,
-35987,
-35591,
-35255,
-34949,
-34762,
-34640,
-34547,
-34494,
-34432,
-34435,
-34490,
-34636,
-34843,
-35053,
-35304,
-35468,
-35691,
-35832,
-36019,
-36128,
-36227,
-36248,
-36264,
-36218,
-36161,
-36020,
-35827,
-35531,
-35199,
-34836,
-34513,
-34177,
-33901,
-33585,
-33380,
-33165,
-33091,
-33028,
-33023,
-33015,
-33043,
-33114,
-33293,
-33504,
-33776,
-33990,
-34149,
-34284,
-34360,
-34501,
-34663,
-34881,
-35092,
-35254,
-35357,
-35370,
-35310,
-35194,
-35028,
-34833,
-34667,
-34496,
-34407,
-34286,
-34163,
-33943,
-33705,
-33418,
-33258,
-33159,
-33210,
-33326,
-33462,
-33588,
-33701,
-33813,
-33954,
-34112,
-34294,
-34461,
-34643,
-34798,
-34974,
-35141,
-35281,
-35384,
-35413,
-35384,
-35319,
-35234,
-35189,
-35149,
-35116,
-35046,
-34894,
-34713,
-34441,
-34244,
-34052,
-33983,
-33991,
-34023,
-34086,
-34070,
-34043,
-33982,
-33961,
-34049,
-34187,
-34396,
-34584,
-34710,
-34801,
-34844,
-34890,
-34960,
-34988,
-35047,
-34998,
-34982,
-34888,
-34864,
-34766,
-34698,
-34508,
-34292,
-34001,
-33742,
-33513,
-33368,
-33199,
-33077,
-32876,
-32767,
-32667,
-32690,
-32748,
-32797,
-32819,
-32803,
-32778,
-32817,
-32856,
-32921,
-32925,
-32882,
-32790,
-32649,
-32507,
-32355,
-32197,
-32031,
-31888,
-31721,
-31600,
-31455,
-31326,
-31184,
-31047,
-30900,
-30803,
-30675,
-30582,
-30487,
-30367,
-30266,
-30139,
-29997,
-29876,
-29733,
-29657,
-29558,
-29500,
-29400,
-29251,
-29057,
-28844,
-28673,
-28608,
-28647,
-28777,
-28887,
-28986,
-28961,
-28959,
-28930,
-28940,
-28939,
-28900,
-28782,
-28675,
-28550,
-28480,
-28382,
-28192,
-27899,
-27512,
-27136,
-26854,
-26729,
-26645,
-26618,
-26467,
-26265,
-26021,
-25823,
-25725,
-25700,
-25665,
-25606,
-25449,
-25312,
-25218,
-25203,
-25290,
-25396,
-25541,
-25664,
-25873,
-26131,
-26470,
-26835,
-27174,
-27476,
-27705,
-27907,
-28052,
-28180,
-28290,
-28367,
-28460,
-28538,
-28585,
-28569,
-28477,
-28285,
-28099,
-27885,
-27761,
-27649,
-27589,
-27498,
-27420,
-27324,
-27282,
-27302,
-27415,
-27619,
-27884,
-28241,
-28668,
-29187,
-29795,
-30452,
-31117,
-31783,
-32417,
-33039,
-33662,
-34264,
-34817,
-35296,
-35642,
-35915,
-36048,
-36137,
-36131,
-36097,
-36011,
-35886,
-35753,
-35583,
-35405,
-35260,
-35083,
-34996,
-34947,
-34993,
-35126,
-35321,
-35559,
-35868,
-36195,
-36656,
-37174,
-37811,
-38477,
-39105,
-39690,
-40168,
-40601,
-41017,
-41387,
-41727,
-41945,
-42012,
-41941,
-41738,
-41476,
-41207,
-40902,
-40575,
-40169,
-39725,
-39279,
-38889,
-38604,
-38413,
-38265,
-38135,
-37989,
-37893,
-37829,
-37902,
-38017,
-38234,
-38467,
-38715,
-38956,
-39157,
-39300,
-39394,
-39405,
-39405,
-39371,
-39324,
-39247,
-39091,
-38814,
-38452,
-37992,
-37531,
-37095,
-36631,
-36193,
-35643,
-35096,
-34537,
-34073,
-33752,
-33502,
-33300,
-33068,
-32801,
-32596,
-32464,
-32447,
-32556,
-32647,
-32794,
-32838,
-32911,
-32962,
-33058,
-33134,
-33232,
-33303,
-33317,
-33328,
-33244,
-33128,
-32957,
-32774,
-32563,
-32356,
-32134,
-31884,
-31606,
-31296,
-30974,
-30668,
-30406,
-30212,
-30060,
-29982,
-29908,
-29865,
-29868,
-29888,
-30015,
-30184,
-30422,
-30717,
-31018,
-31359,
-31716,
-32090,
-32477,
-32855,
-33178,
-33449,
-33669,
-33842,
-34018,
-34160,
-34284,
-34354,
-34339,
-34275,
-34146,
-34009,
-33879,
-33752,
-33642,
-33512,
-33385,
-33269,
-33186,
-33164,
-33175,
-33244,
-33329,
-33472,
-33659,
-33898,
-34194,
-34528,
-34874,
-35245,
-35598,
-35986,
-36312,
-36624,
-36816,
-36949,
-36988,
-36979,
-36928,
-36832,
-36697,
-36478,
-36204,
-35836,
-35441,
-35032,
-34667,
-34343,
-34079,
-33818,
-33587,
-33356,
-33180,
-33065,
-33020,
-33049,
-33077,
-33125,
-33151,
-33234,
-33351,
-33545,
-33722,
-33853,
-33913,
-33908,
-33909,
-33896,
-33872,
-33766,
-33566,
-33243,
-32888,
-32523,
-32187,
-31885,
-31496,
-31122,
-30651,
-30229,
-29866,
-29572,
-29353,
-29117,
-28865,
-28612,
-28417,
-28340,
-28349,
-28435,
-28458,
-28462,
-28422,
-28425,
-28483,
-28620,
-28716,
-28820,
-28792,
-28775,
-28701,
-28658,
-28577,
-28478,
-28337,
-28209,
-28041,
-27908,
-27720,
-27473,
-27241,
-26938,
-26724,
-26507,
-26326,
-26197,
-26093,
-26052,
-26062,
-26110,
-26170,
-26208,
-26223,
-26228,
-26238,
-26251,
-26249,
-26221,
-26156,
-26076,
-25996,
-25935,
-25924,
-25882,
-25888,
-25861,
-25877,
-25947,
-26095,
-26306,
-26582,
-26881,
-27198,
-27481,
-27820,
-28097,
-28453,
-28743,
-29051,
-29324,
-29554,
-29768,
-29903,
-29996,
-29999,
-29977,
-29879,
-29790,
-29658,
-29497,
-29349,
-29144,
-28980,
-28838,
-28758,
-28747,
-28801,
-28887,
-29048,
-29286,
-29608,
-30090,
-30626,
-31276,
-31912,
-32564,
-33254,
-33978,
-34740,
-35455,
-36089,
-36589,
-37019,
-37364,
-37714,
-38010,
-38198,
-38206,
-38068,
-37802,
-37524,
-37240,
-37002,
-36761,
-36515,
-36305,
-36098,
-36029,
-36001,
-36120,
-36234,
-36436,
-36653,
-36998,
-37459,
-38013,
-38659,
-39269,
-39834,
-40338,
-40775,
-41227,
-41609,
-41978,
-42217,
-42383,
-42414,
-42393,
-42233,
-41989,
-41613,
-41148,
-40646,
-40135,
-39721,
-39335,
-39018,
-38712,
-38401,
-38082,
-37812,
-37514,
-37355,
-37257,
-37279,
-37451,
-37658,
-37909,
-38139,
-38288,
-38397,
-38452,
-38481,
-38530,
-38544,
-38557,
-38467,
-38311,
-38025,
-37640,
-37217,
-36735,
-36279,
-35803,
-35331,
-34849,
-34362,
-33874,
-33415,
-32970,
-32565,
-32137,
-31774,
-31410,
-31169,
-30968,
-30869,
-30806,
-30762,
-30731,
-30665,
-30651,
-30641,
-30679,
-30721,
-30766,
-30762,
-30781,
-30711,
-30712,
-30642,
-30592,
-30497,
-30340,
-30152,
-29924,
-29701,
-29487,
-29298,
-29124,
-28934,
-28755,
-28528,
-28348,
-28176,
-28058,
-27972,
-27928,
-27894,
-27940,
-27972,
-28135,
-28280,
-28547,
-28784,
-29134,
-29455,
-29883,
-30230,
-30640,
-30945,
-31313,
-31612,
-31962,
-32280,
-32580,
-32835,
-33034,
-33177,
-33289,
-33343,
-33360,
-33388,
-33350,
-33411,
-33403,
-33435,
-33393,
-33346,
-33277,
-33292,
-33397,
-33605,
-33845,
-34127,
-34366,
-34652,
-34932,
-35267,
-35664,
-36045,
-36460,
-36831,
-37176,
-37503,
-37777,
-38027,
-38201,
-38312,
-38336,
-38267,
-38149,
-37993,
-37816,
-37669,
-37477,
-37276,
-37006,
-36682,
-36373,
-36071,
-35873,
-35692,
-35597,
-35468,
-35402,
-35325,
-35321,
-35360,
-35431,
-35524,
-35618,
-35709,
-35793,
-35841,
-35887,
-35849,
-35781,
-35624,
-35453,
-35231,
-35016,
-34745,
-34464,
-34123,
-33728,
-33288,
-32817,
-32355,
-31920,
-31528,
-31153,
-30841,
-30481,
-30200,
-29849,
-29630,
-29353,
-29183,
-29015,
-28851,
-28716,
-28576,
-28459,
-28392,
-28323,
-28307,
-28267,
-28229,
-28166,
-28089,
-27990,
-27894,
-27761,
-27637,
-27473,
-27346,
-27171,
-27057,
-26908,
-26777,
-26633,
-26475,
-26338,
-26196,
-26089,
-25943,
-25802,
-25642,
-25444,
-25312,
-25142,
-25037,
-24920,
-24808,
-24697,
-24564,
-24487,
-24403,
-24399,
-24405,
-24432,
-24489,
-24547,
-24690,
-24853,
-25135,
-25425,
-25810,
-26167,
-26576,
-26943,
-27329,
-27659,
-28020,
-28354,
-28738,
-29090,
-29416,
-29631,
-29744,
-29756,
-29734,
-29680,
-29630,
-29561,
-29479,
-29341,
-29184,
-28968,
-28764,
-28556,
-28400,
-28354,
-28432,
-28638,
-28935,
-29256,
-29582,
-29974,
-30416,
-30979,
-31657,
-32391,
-33169,
-33952,
-34685,
-35448,
-36100,
-36739,
-37237,
-37674,
-38031,
-38338,
-38613,
-38815,
-38879,
-38817,
-38614,
-38349,
-38069,
-37859,
-37665,
-37507,
-37301,
-37062,
-36867,
-36687,
-36726,
-36818,
-37077,
-37364,
-37667,
-38021,
-38387,
-38852,
-39382,
-39925,
-40498,
-40983,
-41446,
-41829,
-42175,
-42433,
-42649,
-42731,
-42748,
-42680,
-42521,
-42357,
-42115,
-41843,
-41483,
-41051,
-40574,
-40110,
-39654,
-39298,
-38933,
-38644,
-38342,
-38074,
-37842,
-37670,
-37560,
-37500,
-37465,
-37467,
-37493,
-37564,
-37686,
-37770,
-37878,
-37846,
-37829,
-37718,
-37632,
-37498,
-37340,
-37106,
-36811,
-36476,
-36126,
-35800,
-35463,
-35107,
-34661,
-34160,
-33603,
-33078,
-32600,
-32226,
-31886,
-31582,
-31246,
-30879,
-30544,
-30212,
-29957,
-29738,
-29591,
-29519,
-29490,
-29540,
-29546,
-29602,
-29573,
-29617,
-29675,
-29787,
-29936,
-30001,
-30009,
-29940,
-29828,
-29755,
-29710,
-29637,
-29554,
-29359,
-29150,
-28864,
-28605,
-28331,
-28110,
-27959,
-27829,
-27771,
-27662,
-27560,
-27446,
-27388,
-27438,
-27645,
-27962,
-28364,
-28730,
-29074,
-29362,
-29688,
-30059,
-30514,
-31029,
-31524,
-31983,
-32343,
-32651,
-32892,
-33099,
-33263,
-33362,
-33434,
-33448,
-33471,
-33491,
-33526,
-33529,
-33514,
-33483,
-33451,
-33478,
-33545,
-33702,
-33865,
-34074,
-34271,
-34499,
-34755,
-35027,
-35362,
-35669,
-36027,
-36313,
-36592,
-36822,
-37019,
-37172,
-37323,
-37423,
-37519,
-37561,
-37566,
-37507,
-37422,
-37266,
-37145,
-36982,
-36859,
-36703,
-36530,
-36340,
-36151,
-35970,
-35857,
-35748,
-35659,
-35596,
-35465,
-35429,
-35339,
-35345,
-35309,
-35306,
-35237,
-35154,
-35034,
-34930,
-34809,
-34690,
-34499,
-34293,
-33994,
-33723,
-33409,
-33136,
-32826,
-32454,
-32058,
-31585,
-31197,
-30824,
-30578,
-30358,
-30164,
-29919,
-29669,
-29382,
-29109,
-28858,
-28661,
-28474,
-28376,
-28263,
-28172,
-28077,
-27933,
-27764,
-27573,
-27388,
-27224,
-27120,
-27021,
-26966,
-26897,
-26827,
-26714,
-26605,
-26485,
-26377,
-26286,
-26219,
-26162,
-26130,
-26097,
-26046,
-25981,
-25885,
-25760,
-25617,
-25459,
-25314,
-25185,
-25031,
-24908,
-24709,
-24567,
-24375,
-24273,
-24197,
-24208,
-24271,
-24356,
-24492,
-24640,
-24901,
-25193,
-25646,
-26064,
-26549,
-26917,
-27293,
-27629,
-28043,
-28450,
-28915,
-29272,
-29572,
-29757,
-29900,
-30006,
-30094,
-30124,
-30075,
-29920,
-29740,
-29505,
-29362,
-29205,
-29100,
-28955,
-28788,
-28663,
-28606,
-28692,
-28897,
-29231,
-29594,
-30038,
-30489,
-31023,
-31643,
-32325,
-33051,
-33781,
-34466,
-35133,
-35768,
-36371,
-36924,
-37378,
-37737,
-38006,
-38175,
-38353,
-38424,
-38520,
-38477,
-38343,
-38117,
-37827,
-37570,
-37318,
-37155,
-37009,
-36928,
-36844,
-36850,
-36861,
-37002,
-37136,
-37371,
-37616,
-37950,
-38320,
-38780,
-39238,
-39699,
-40124,
-40485,
-40822,
-41153,
-41449,
-41738,
-41938,
-42069,
-42076,
-42031,
-41918,
-41769,
-41600,
-41355,
-41066,
-40728,
-40387,
-40029,
-39709,
-39317,
-38982,
-38611,
-38329,
-38083,
-37917,
-37771,
-37668,
-37551,
-37483,
-37455,
-37482,
-37545,
-37636,
-37701,
-37808,
-37838,
-37904,
-37885,
-37869,
-37808,
-37754,
-37661,
-37584,
-37417,
-37224,
-36960,
-36664,
-36354,
-35990,
-35626,
-35204,
-34807,
-34372,
-33985,
-33569,
-33193,
-32784,
-32422,
-32079,
-31786,
-31559,
-31373,
-31200,
-31113,
-30992,
-30999,
-30999,
-31106,
-31189,
-31337,
-31432,
-31585,
-31674,
-31809,
-31874,
-31927,
-31926,
-31891,
-31842,
-31795,
-31716,
-31634,
-31464,
-31267,
-31007,
-30730,
-30441,
-30178,
-29909,
-29704,
-29499,
-29375,
-29304,
-29236,
-29246,
-29241,
-29322,
-29468,
-29703,
-29992,
-30296,
-30588,
-30878,
-31204,
-31542,
-31964,
-32323,
-32714,
-32999,
-33273,
-33474,
-33685,
-33831,
-33952,
-33998,
-34013,
-33968,
-33942,
-33887,
-33847,
-33798,
-33734,
-33673,
-33656,
-33645,
-33721,
-33793,
-33881,
-33973,
-34056,
-34188,
-34322,
-34508,
-34662,
-34834,
-34973,
-35141,
-35278,
-35453,
-35565,
-35656,
-35686,
-35663,
-35627,
-35566,
-35492,
-35446,
-35353,
-35294,
-35195,
-35074,
-34956,
-34785,
-34652,
-34516,
-34414,
-34346,
-34264,
-34191,
-34080,
-33956,
-33837,
-33739,
-33661,
-33580,
-33462,
-33299,
-33068,
-32819,
-32575,
-32331,
-32125,
-31870,
-31615,
-31307,
-31021,
-30732,
-30492,
-30233,
-30013,
-29763,
-29565,
-29384,
-29245,
-29137,
-28994,
-28857,
-28671,
-28484,
-28282,
-28094,
-27927,
-27770,
-27621,
-27467,
-27305,
-27119,
-26937,
-26703,
-26541,
-26344,
-26253,
-26147,
-26116,
-26053,
-26016,
-25922,
-25867,
-25791,
-25781,
-25786,
-25824,
-25888,
-25923,
-26003,
-26018,
-26066,
-26058,
-26050,
-25991,
-25917,
-25795,
-25689,
-25531,
-25420,
-25303,
-25207,
-25142,
-25054,
-24997,
-24937,
-24918,
-24970,
-25101,
-25306,
-25613,
-25912,
-26302,
-26663,
-27077,
-27530,
-27987,
-28472,
-28909,
-29345,
-29685,
-30037,
-30294,
-30543,
-30718,
-30828,
-30873,
-30836,
-30740,
-30641,
-30482,
-30329,
-30109,
-29905,
-29683,
-29522,
-29454,
-29479,
-29630,
-29815,
-30067,
-30333,
-30656,
-31075,
-31579,
-32185,
-32833,
-33494,
-34158,
-34797,
-35407,
-35998,
-36529,
-37016,
-37426,
-37769,
-38047,
-38249,
-38340,
-38351,
-38253,
-38125,
-37955,
-37753,
-37589,
-37360,
-37229,
-37035,
-36956,
-36823,
-36752,
-36685,
-36668,
-36767,
-36955,
-37248,
-37586,
-37964,
-38298,
-38664,
-38976,
-39284,
-39564,
-39799,
-40045,
-40266,
-40481,
-40654,
-40759,
-40773,
-40719,
-40637,
-40525,
-40440,
-40292,
-40119,
-39835,
-39530,
-39168,
-38884,
-38586,
-38374,
-38157,
-37928,
-37727,
-37486,
-37334,
-37153,
-37069,
-36946,
-36868,
-36787,
-36757,
-36762,
-36805,
-36871,
-36897,
-36911,
-36866,
-36820,
-36770,
-36719,
-36681,
-36607,
-36516,
-36398,
-36192,
-36025,
-35741,
-35520,
-35235,
-34986,
-34707,
-34441,
-34138,
-33848,
-33506,
-33184,
-32850,
-32545,
-32301,
-32039,
-31891,
-31694,
-31604,
-31482,
-31427,
-31382,
-31360,
-31377,
-31389,
-31466,
-31520,
-31628,
-31711,
-31796,
-31871,
-31919,
-31953,
-31964,
-31962,
-31925,
-31861,
-31775,
-31623,
-31498,
-31296,
-31115,
-30951,
-30730,
-30605,
-30392,
-30264,
-30093,
-29994,
-29921,
-29931,
-29969,
-30076,
-30204,
-30381,
-30582,
-30838,
-31116,
-31443,
-31736,
-32070,
-32354,
-32649,
-32900,
-33158,
-33382,
-33610,
-33813,
-33951,
-34074,
-34062,
-34078,
-33974,
-33981,
-33921,
-33950,
-33939,
-33921,
-33903,
-33863,
-33855,
-33854,
-33881,
-33933,
-34002,
-34123,
-34260,
-34450,
-34625,
-34805,
-34952,
-35082,
-35229,
-35344,
-35505,
-35622,
-35729,
-35810,
-35818,
-35858,
-35836,
-35849,
-35809,
-35773,
-35700,
-35628,
-35572,
-35516,
-35446,
-35362,
-35222,
-35113,
-35013,
-34958,
-34943,
-34878,
-34798,
-34652,
-34487,
-34351,
-34197,
-34089,
-33951,
-33796,
-33636,
-33450,
-33301,
-33152,
-32995,
-32831,
-32622,
-32433,
-32245,
-32089,
-31955,
-31797,
-31617,
-31391,
-31142,
-30907,
-30652,
-30425,
-30139,
-29853,
-29568,
-29291,
-29099,
-28899,
-28710,
-28501,
-28265,
-28057,
-27908,
-27781,
-27721,
-27624,
-27525,
-27415,
-27319,
-27261,
-27251,
-27248,
-27254,
-27244,
-27243,
-27252,
-27299,
-27358,
-27390,
-27405,
-27318,
-27221,
-27073,
-26926,
-26783,
-26615,
-26440,
-26244,
-26027,
-25841,
-25598,
-25416,
-25203,
-25046,
-24959,
-24929,
-24972,
-25050,
-25145,
-25280,
-25474,
-25753,
-26126,
-26587,
-27025,
-27474,
-27822,
-28170,
-28491,
-28859,
-29204,
-29528,
-29733,
-29842,
-29872,
-29850,
-29829,
-29777,
-29680,
-29517,
-29290,
-29061,
-28859,
-28720,
-28621,
-28562,
-28549,
-28570,
-28702,
-28873,
-29150,
-29439,
-29801,
-30183,
-30639,
-31159,
-31730,
-32354,
-32967,
-33572,
-34141,
-34658,
-35145,
-35550,
-35894,
-36122,
-36287,
-36372,
-36417,
-36413,
-36412,
-36346,
-36280,
-36140,
-36030,
-35891,
-35824,
-35724,
-35722,
-35717,
-35769,
-35847,
-35957,
-36094,
-36269,
-36498,
-36789,
-37120,
-37452,
-37784,
-38007,
-38259,
-38416,
-38637,
-38854,
-39079,
-39303,
-39443,
-39544,
-39551,
-39560,
-39512,
-39471,
-39363,
-39205,
-39005,
-38770,
-38574,
-38388,
-38247,
-38078,
-37922,
-37748,
-37589,
-37479,
-37375,
-37274,
-37191,
-37073,
-37033,
-36993,
-37020,
-37041,
-37059,
-37081,
-37099,
-37126,
-37181,
-37181,
-37179,
-37123,
-37049,
-36989,
-36913,
-36840,
-36758,
-36621,
-36473,
-36270,
-36078,
-35819,
-35620,
-35315,
-35068,
-34774,
-34497,
-34255,
-33998,
-33783,
-33545,
-33364,
-33154,
-33043,
-32912,
-32863,
-32808,
-32779,
-32789,
-32828,
-32902,
-32975,
-33052,
-33078,
-33115,
-33146,
-33189,
-33243,
-33283,
-33283,
-33244,
-33142,
-33003,
-32828,
-32636,
-32429,
-32217,
-32003,
-31800,
-31589,
-31394,
-31202,
-31042,
-30889,
-30807,
-30737,
-30743,
-30753,
-30821,
-30855,
-30966,
-31039,
-31203,
-31356,
-31575,
-31781,
-31991,
-32146,
-32286,
-32359,
-32455,
-32522,
-32593,
-32628,
-32618,
-32542,
-32446,
-32311,
-32203,
-32119,
-32020,
-31972,
-31876,
-31846,
-31809,
-31854,
-31914,
-32038,
-32158,
-32305,
-32456,
-32620,
-32807,
-32989,
-33164,
-33329,
-33468,
-33598,
-33761,
-33879,
-34025,
-34093,
-34089,
-34054,
-33949,
-33860,
-33791,
-33734,
-33681,
-33601,
-33470,
-33318,
-33180,
-33077,
-33057,
-33086,
-33149,
-33209,
-33244,
-33265,
-33293,
-33319,
-33366,
-33414,
-33464,
-33522,
-33532,
-33569,
-33496,
-33455,
-33312,
-33202,
-33041,
-32928,
-32791,
-32687,
-32514,
-32362,
-32141,
-31934,
-31696,
-31490,
-31267,
-31089,
-30846,
-30650,
-30397,
-30174,
-29968,
-29792,
-29668,
-29577,
-29506,
-29430,
-29364,
-29287,
-29208,
-29127,
-29053,
-29001,
-29003,
-29010,
-29079,
-29105,
-29126,
-29102,
-29045,
-29026,
-28972,
-28993,
-28955,
-28949,
-28880,
-28826,
-28730,
-28637,
-28485,
-28340,
-28142,
-27953,
-27764,
-27528,
-27306,
-27015,
-26752,
-26506,
-26341,
-26261,
-26239,
-26271,
-26297,
-26345,
-26403,
-26524,
-26673,
-26918,
-27195,
-27512,
-27859,
-28199,
-28528,
-28869,
-29147,
-29432,
-29651,
-29854,
-29991,
-30096,
-30096,
-30034,
-29918,
-29742,
-29634,
-29495,
-29421,
-29320,
-29197,
-29047,
-28878,
-28725,
-28630,
-28597,
-28673,
-28814,
-29070,
-29393,
-29760,
-30168,
-30587,
-31021,
-31483,
-31966,
-32470,
-32945,
-33410,
-33826,
-34198,
-34551,
-34839,
-35099,
-35271,
-35397,
-35442,
-35481,
-35453,
-35429,
-35374,
-35300,
-35219,
-35153,
-35121,
-35143,
-35192,
-35307,
-35382,
-35526,
-35624,
-35800,
-35989,
-36258,
-36555,
-36882,
-37218,
-37512,
-37821,
-38088,
-38350,
-38582,
-38786,
-38953,
-39100,
-39220,
-39298,
-39378,
-39405,
-39399,
-39347,
-39253,
-39123,
-39005,
-38863,
-38753,
-38610,
-38515,
-38347,
-38262,
-38096,
-38031,
-37951,
-37898,
-37899,
-37847,
-37846,
-37822,
-37832,
-37861,
-37928,
-37999,
-38108,
-38170,
-38245,
-38257,
-38271,
-38225,
-38203,
-38097,
-38037,
-37911,
-37839,
-37706,
-37614,
-37443,
-37244,
-36991,
-36695,
-36399,
-36110,
-35841,
-35618,
-35401,
-35191,
-34981,
-34761,
-34545,
-34362,
-34190,
-34080,
-33999,
-33979,
-33980,
-34015,
-34062,
-34106,
-34165,
-34193,
-34287,
-34323,
-34452,
-34496,
-34596,
-34579,
-34547,
-34417,
-34261,
-34068,
-33873,
-33685,
-33500,
-33282,
-33029,
-32736,
-32406,
-32104,
-31817,
-31616,
-31439,
-31328,
-31222,
-31156,
-31134,
-31152,
-31260,
-31363,
-31542,
-31695,
-31861,
-32056,
-32227,
-32441,
-32616,
-32799,
-32912,
-33026,
-33071,
-33094,
-33075,
-33007,
-32888,
-32735,
-32545,
-32357,
-32170,
-32001,
-31836,
-31680,
-31542,
-31408,
-31309,
-31228,
-31193,
-31184,
-31250,
-31351,
-31516,
-31708,
-31921,
-32144,
-32339,
-32544,
-32721,
-32916,
-33094,
-33259,
-33412,
-33522,
-33605,
-33632,
-33638,
-33567,
-33483,
-33322,
-33190,
-33002,
-32852,
-32666,
-32492,
-32307,
-32122,
-31927,
-31751,
-31582,
-31466,
-31400,
-31364,
-31393,
-31429,
-31499,
-31563,
-31632,
-31707,
-31789,
-31900,
-32033,
-32177,
-32306,
-32428,
-32479,
-32508,
-32456,
-32390,
-32258,
-32119,
-31901,
-31667,
-31381,
-31050,
-30736,
-30362,
-30051,
-29670,
-29363,
-28997,
-28690,
-28401,
-28152,
-27970,
-27819,
-27733,
-27682,
-27644,
-27663,
-27658,
-27735,
-27790,
-27917,
-28038,
-28202,
-28349,
-28486,
-28584,
-28655,
-28673,
-28676,
-28676,
-28631,
-28601,
-28485,
-28349,
-28121,
-27888,
-27574,
-27309,
-26989,
-26724,
-26419,
-26183,
-25917,
-25732,
-25537,
-25435,
-25346,
-25348,
-25402,
-25509,
-25697,
-25896,
-26180,
-26432,
-26763,
-27068,
-27435,
-27779,
-28166,
-28500,
-28842,
-29114,
-29341,
-29488,
-29595,
-29606,
-29588,
-29538,
-29460,
-29392,
-29294,
-29196,
-29055,
-28942,
-28791,
-28697,
-28632,
-28603,
-28673,
-28771,
-28967,
-29217,
-29531,
-29897,
-30268,
-30677,
-31074,
-31508,
-31928,
-32371,
-32789,
-33223,
-33597,
-33961,
-34268,
-34543,
-34746,
-34920,
-35013,
-35082,
-35135,
-35132,
-35180,
-35176,
-35210,
-35223,
-35270,
-35318,
-35412,
-35504,
-35634,
-35763,
-35941,
-36146,
-36373,
-36649,
-36891,
-37173,
-37446,
-37726,
-38032,
-38276,
-38510,
-38656,
-38772,
-38864,
-38942,
-39045,
-39087,
-39161,
-39145,
-39149,
-39135,
-39102,
-39084,
-39018,
-38941,
-38846,
-38760,
-38688,
-38639,
-38606,
-38580,
-38562,
-38537,
-38494,
-38484,
-38426,
-38420,
-38358,
-38335,
-38301,
-38277,
-38269,
-38263,
-38249,
-38252,
-38215,
-38196,
-38150,
-38109,
-38053,
-37975,
-37882,
-37764,
-37670,
-37562,
-37480,
-37415,
-37288,
-37168,
-36990,
-36766,
-36578,
-36370,
-36192,
-36026,
-35840,
-35675,
-35545,
-35416,
-35309,
-35209,
-35094,
-34975,
-34893,
-34807,
-34796,
-34783,
-34786,
-34794,
-34778,
-34797,
-34807,
-34807,
-34838,
-34793,
-34758,
-34684,
-34596,
-34498,
-34416,
-34298,
-34173,
-34010,
-33830,
-33655,
-33461,
-33309,
-33122,
-32982,
-32818,
-32705,
-32585,
-32545,
-32451,
-32440,
-32391,
-32380,
-32381,
-32386,
-32410,
-32439,
-32487,
-32540,
-32611,
-32682,
-32698,
-32732,
-32695,
-32700,
-32681,
-32679,
-32647,
-32607,
-32515,
-32412,
-32324,
-32244,
-32190,
-32140,
-32077,
-31991,
-31926,
-31842,
-31817,
-31808,
-31829,
-31861,
-31884,
-31908,
-31934,
-32002,
-32093,
-32206,
-32349,
-32432,
-32535,
-32562,
-32590,
-32632,
-32630,
-32707,
-32698,
-32754,
-32734,
-32731,
-32691,
-32656,
-32596,
-32549,
-32482,
-32381,
-32314,
-32209,
-32158,
-32094,
-32081,
-32041,
-32069,
-32037,
-32107,
-32110,
-32186,
-32201,
-32263,
-32285,
-32329,
-32370,
-32414,
-32443,
-32448,
-32412,
-32349,
-32262,
-32167,
-32058,
-31963,
-31828,
-31736,
-31570,
-31437,
-31265,
-31060,
-30905,
-30696,
-30565,
-30407,
-30305,
-30171,
-30082,
-29956,
-29861,
-29727,
-29628,
-29509,
-29424,
-29334,
-29277,
-29201,
-29112,
-28990,
-28856,
-28675,
-28546,
-28396,
-28286,
-28187,
-28073,
-27966,
-27845,
-27724,
-27635,
-27572,
-27543,
-27540,
-27548,
-27518,
-27485,
-27419,
-27317,
-27232,
-27138,
-27072,
-27003,
-26918,
-26815,
-26712,
-26575,
-26471,
-26353,
-26286,
-26226,
-26172,
-26165,
-26148,
-26210,
-26267,
-26408,
-26534,
-26729,
-26892,
-27109,
-27305,
-27504,
-27673,
-27819,
-27944,
-28057,
-28172,
-28289,
-28363,
-28429,
-28461,
-28469,
-28519,
-28540,
-28618,
-28672,
-28736,
-28772,
-28851,
-28924,
-29112,
-29312,
-29599,
-29885,
-30184,
-30444,
-30696,
-30926,
-31169,
-31439,
-31718,
-31995,
-32261,
-32496,
-32695,
-32890,
-33037,
-33193,
-33293,
-33415,
-33512,
-33647,
-33777,
-33936,
-34109,
-34273,
-34475,
-34662,
-34898,
-35136,
-35415,
-35658,
-35961,
-36194,
-36500,
-36740,
-37021,
-37254,
-37485,
-37672,
-37831,
-37973,
-38065,
-38126,
-38135,
-38104,
-38031,
-37949,
-37872,
-37823,
-37816,
-37834,
-37870,
-37904,
-37949,
-37994,
-38063,
-38157,
-38282,
-38439,
-38578,
-38757,
-38868,
-39021,
-39121,
-39227,
-39283,
-39339,
-39293,
-39268,
-39131,
-39031,
-38884,
-38748,
-38595,
-38404,
-38218,
-37992,
-37811,
-37659,
-37537,
-37477,
-37419,
-37379,
-37361,
-37341,
-37363,
-37398,
-37446,
-37501,
-37529,
-37567,
-37563,
-37553,
-37507,
-37463,
-37382,
-37298,
-37159,
-37023,
-36839,
-36651,
-36459,
-36254,
-36081,
-35904,
-35737,
-35585,
-35408,
-35269,
-35130,
-35032,
-34971,
-34943,
-34956,
-34940,
-34963,
-34910,
-34901,
-34881,
-34888,
-34919,
-34950,
-34938,
-34922,
-34823,
-34745,
-34605,
-34516,
-34359,
-34254,
-34068,
-33925,
-33762,
-33616,
-33488,
-33355,
-33195,
-33037,
-32862,
-32738,
-32620,
-32554,
-32508,
-32433,
-32396,
-32311,
-32326,
-32293,
-32336,
-32336,
-32328,
-32294,
-32298,
-32257,
-32281,
-32264,
-32224,
-32173,
-32153,
-32123,
-32132,
-32130,
-32055,
-31979,
-31847,
-31731,
-31640,
-31573,
-31521,
-31476,
-31415,
-31363,
-31314,
-31292,
-31293,
-31323,
-31379,
-31410,
-31492,
-31525,
-31614,
-31676,
-31761,
-31856,
-31954,
-32053,
-32132,
-32199,
-32214,
-32242,
-32216,
-32239,
-32238,
-32225,
-32188,
-32116,
-32008,
-31938,
-31837,
-31801,
-31741,
-31692,
-31627,
-31611,
-31558,
-31605,
-31579,
-31601,
-31575,
-31549,
-31540,
-31559,
-31587,
-31647,
-31674,
-31708,
-31705,
-31692,
-31680,
-31656,
-31619,
-31563,
-31461,
-31371,
-31241,
-31145,
-31002,
-30883,
-30695,
-30511,
-30285,
-30084,
-29865,
-29680,
-29488,
-29327,
-29188,
-29094,
-29022,
-29015,
-28988,
-28991,
-28979,
-28934,
-28944,
-28900,
-28927,
-28916,
-28913,
-28868,
-28803,
-28702,
-28582,
-28457,
-28286,
-28136,
-27933,
-27732,
-27525,
-27285,
-27085,
-26859,
-26666,
-26475,
-26329,
-26213,
-26149,
-26136,
-26142,
-26197,
-26272,
-26375,
-26507,
-26659,
-26865,
-27064,
-27284,
-27457,
-27612,
-27712,
-27792,
-27850,
-27899,
-27931,
-27918,
-27866,
-27734,
-27607,
-27425,
-27298,
-27153,
-27099,
-27080,
-27133,
-27247,
-27367,
-27526,
-27696,
-27893,
-28141,
-28479,
-28866,
-29332,
-29793,
-30257,
-30669,
-31073,
-31394,
-31699,
-31939,
-32139,
-32294,
-32417,
-32490,
-32524,
-32553,
-32537,
-32548,
-32555,
-32555,
-32591,
-32616,
-32695,
-32815,
-32985,
-33246,
-33544,
-33907,
-34290,
-34716,
-35141,
-35597,
-36036,
-36465,
-36867,
-37213,
-37547,
-37804,
-38049,
-38217,
-38365,
-38432,
-38476,
-38441,
-38398,
-38303,
-38241,
-38130,
-38073,
-38000,
-37973,
-37971,
-38013,
-38072,
-38176,
-38273,
-38402,
-38535,
-38669,
-38841,
-38994,
-39174,
-39307,
-39437,
-39554,
-39603,
-39684,
-39678,
-39697,
-39618,
-39524,
-39363,
-39171,
-38983,
-38781,
-38609,
-38458,
-38301,
-38168,
-38037,
-37905,
-37807,
-37689,
-37599,
-37494,
-37416,
-37349,
-37315,
-37292,
-37289,
-37255,
-37198,
-37147,
-37032,
-36968,
-36838,
-36753,
-36630,
-36525,
-36404,
-36278,
-36148,
-36018,
-35910,
-35790,
-35726,
-35614,
-35539,
-35412,
-35275,
-35118,
-34982,
-34850,
-34761,
-34681,
-34614,
-34543,
-34466,
-34386,
-34332,
-34289,
-34264,
-34253,
-34231,
-34223,
-34213,
-34217,
-34227,
-34210,
-34218,
-34176,
-34192,
-34141,
-34156,
-34092,
-34071,
-33985,
-33933,
-33826,
-33755,
-33623,
-33490,
-33365,
-33240,
-33182,
-33111,
-33062,
-32984,
-32909,
-32856,
-32812,
-32838,
-32850,
-32884,
-32913,
-32940,
-32990,
-33072,
-33154,
-33274,
-33350,
-33430,
-33471,
-33467,
-33458,
-33385,
-33315,
-33235,
-33142,
-33059,
-32918,
-32809,
-32647,
-32552,
-32455,
-32379,
-32344,
-32273,
-32264,
-32254,
-32287,
-32381,
-32457,
-32573,
-32660,
-32760,
-32846,
-32947,
-33002,
-33075,
-33052,
-33060,
-33001,
-32969,
-32884,
-32834,
-32691,
-32599,
-32405,
-32282,
-32100,
-31977,
-31847,
-31736,
-31648,
-31594,
-31569,
-31602,
-31626,
-31684,
-31718,
-31753,
-31775,
-31804,
-31821,
-31842,
-31815,
-31790,
-31696,
-31629,
-31492,
-31390,
-31257,
-31113,
-30961,
-30761,
-30587,
-30362,
-30183,
-29963,
-29792,
-29619,
-29452,
-29319,
-29190,
-29108,
-28997,
-28943,
-28853,
-28818,
-28795,
-28766,
-28778,
-28768,
-28749,
-28736,
-28668,
-28606,
-28506,
-28402,
-28248,
-28125,
-27940,
-27766,
-27576,
-27349,
-27162,
-26963,
-26807,
-26633,
-26487,
-26302,
-26161,
-26005,
-25879,
-25768,
-25658,
-25538,
-25415,
-25304,
-25213,
-25187,
-25166,
-25231,
-25285,
-25390,
-25501,
-25650,
-25787,
-25983,
-26125,
-26294,
-26419,
-26546,
-26668,
-26752,
-26838,
-26837,
-26833,
-26749,
-26667,
-26550,
-26436,
-26291,
-26164,
-26020,
-25946,
-25916,
-25956,
-26087,
-26264,
-26498,
-26800,
-27132,
-27531,
-27962,
-28398,
-28865,
-29317,
-29796,
-30273,
-30738,
-31169,
-31549,
-31825,
-32042,
-32139,
-32177,
-32161,
-32122,
-32080,
-32081,
-32085,
-32158,
-32255,
-32387,
-32534,
-32727,
-32916,
-33186,
-33497,
-33876,
-34323,
-34810,
-35324,
-35828,
-36322,
-36763,
-37190,
-37545,
-37875,
-38140,
-38332,
-38504,
-38593,
-38682,
-38700,
-38713,
-38684,
-38641,
-38568,
-38506,
-38449,
-38432,
-38459,
-38525,
-38673,
-38820,
-39037,
-39212,
-39435,
-39610,
-39789,
-39965,
-40089,
-40219,
-40276,
-40317,
-40295,
-40243,
-40146,
-40057,
-39940,
-39816,
-39687,
-39521,
-39396,
-39219,
-39094,
-38950,
-38849,
-38772,
-38713,
-38700,
-38690,
-38689,
-38678,
-38627,
-38535,
-38447,
-38262,
-38142,
-37929,
-37770,
-37580,
-37385,
-37198,
-36967,
-36759,
-36500,
-36279,
-36037,
-35856,
-35665,
-35545,
-35422,
-35377,
-35324,
-35348,
-35344,
-35395,
-35392,
-35414,
-35373,
-35358,
-35296,
-35250,
-35149,
-35059,
-34905,
-34747,
-34580,
-34376,
-34196,
-33997,
-33796,
-33625,
-33445,
-33322,
-33216,
-33157,
-33117,
-33102,
-33128,
-33185,
-33269,
-33385,
-33516,
-33626,
-33734,
-33802,
-33849,
-33883,
-33876,
-33852,
-33811,
-33725,
-33680,
-33590,
-33541,
-33456,
-33364,
-33268,
-33166,
-33077,
-33039,
-32979,
-32991,
-32939,
-32953,
-32929,
-32962,
-33007,
-33090,
-33175,
-33260,
-33306,
-33374,
-33413,
-33453,
-33498,
-33499,
-33515,
-33480,
-33447,
-33385,
-33331,
-33265,
-33235,
-33197,
-33191,
-33198,
-33175,
-33168,
-33129,
-33112,
-33139,
-33161,
-33224,
-33304,
-33361,
-33469,
-33511,
-33562,
-33550,
-33512,
-33428,
-33372,
-33310,
-33286,
-33244,
-33216,
-33153,
-33089,
-33016,
-32948,
-32879,
-32806,
-32730,
-32641,
-32561,
-32481,
-32413,
-32348,
-32305,
-32221,
-32205,
-32127,
-32137,
-32119,
-32096,
-32079,
-32027,
-31964,
-31903,
-31837,
-31777,
-31698,
-31616,
-31492,
-31352,
-31215,
-31047,
-30911,
-30727,
-30574,
-30361,
-30168,
-29947,
-29759,
-29598,
-29442,
-29340,
-29223,
-29141,
-29061,
-29000,
-28945,
-28927,
-28906,
-28911,
-28924,
-28901,
-28888,
-28835,
-28755,
-28677,
-28550,
-28443,
-28283,
-28121,
-27925,
-27690,
-27447,
-27182,
-26919,
-26676,
-26440,
-26214,
-26022,
-25846,
-25708,
-25637,
-25571,
-25528,
-25475,
-25436,
-25417,
-25475,
-25582,
-25752,
-25963,
-26150,
-26342,
-26490,
-26657,
-26794,
-26935,
-27043,
-27113,
-27135,
-27106,
-27015,
-26925,
-26777,
-26650,
-26503,
-26385,
-26262,
-26182,
-26108,
-26099,
-26104,
-26184,
-26318,
-26492,
-26757,
-27030,
-27393,
-27753,
-28150,
-28546,
-28921,
-29322,
-29672,
-30038,
-30339,
-30610,
-30795,
-30946,
-31028,
-31089,
-31150,
-31159,
-31206,
-31222,
-31260,
-31331,
-31435,
-31589,
-31812,
-32075,
-32381,
-32742,
-33093,
-33503,
-33898,
-34303,
-34715,
-35088,
-35455,
-35788,
-36070,
-36316,
-36508,
-36667,
-36771,
-36877,
-36925,
-37005,
-37073,
-37143,
-37233,
-37315,
-37409,
-37512,
-37639,
-37753,
-37943,
-38081,
-38327,
-38536,
-38820,
-39086,
-39316,
-39552,
-39689,
-39827,
-39888,
-39937,
-39956,
-39924,
-39887,
-39782,
-39690,
-39571,
-39447,
-39348,
-39234,
-39162,
-39067,
-39028,
-38951,
-38954,
-38901,
-38910,
-38895,
-38926,
-38961,
-39001,
-39053,
-39056,
-39037,
-38974,
-38811,
-38669,
-38417,
-38186,
-37932,
-37670,
-37439,
-37179,
-36954,
-36692,
-36462,
-36221,
-36015,
-35855,
-35715,
-35643,
-35560,
-35546,
-35500,
-35538,
-35524,
-35561,
-35532,
-35495,
-35432,
-35345,
-35229,
-35119,
-34935,
-34744,
-34548,
-34325,
-34145,
-33979,
-33792,
-33648,
-33468,
-33337,
-33244,
-33151,
-33128,
-33041,
-33020,
-32957,
-32965,
-32985,
-33044,
-33101,
-33172,
-33179,
-33220,
-33178,
-33171,
-33145,
-33094,
-33080,
-33019,
-32976,
-32941,
-32873,
-32858,
-32785,
-32806,
-32752,
-32804,
-32788,
-32801,
-32802,
-32775,
-32781,
-32804,
-32850,
-32925,
-32983,
-33040,
-33064,
-33094,
-33110,
-33144,
-33164,
-33174,
-33184,
-33162,
-33158,
-33131,
-33115,
-33081,
-33072,
-33041,
-33059,
-33041,
-33039,
-33030,
-32982,
-32984,
-32950,
-32996,
-33031,
-33108,
-33176,
-33278,
-33369,
-33451,
-33523,
-33570,
-33600,
-33623,
-33633,
-33613,
-33604,
-33528,
-33488,
-33413,
-33379,
-33303,
-33282,
-33177,
-33120,
-32990,
-32872,
-32736,
-32582,
-32449,
-32318,
-32239,
-32198,
-32173,
-32181,
-32154,
-32153,
-32089,
-32069,
-32039,
-32024,
-32024,
-31999,
-31944,
-31890,
-31765,
-31706,
-31553,
-31468,
-31318,
-31160,
-30997,
-30804,
-30616,
-30456,
-30260,
-30115,
-29970,
-29840,
-29739,
-29648,
-29535,
-29452,
-29330,
-29237,
-29164,
-29100,
-29062,
-29039,
-28993,
-28997,
-28970,
-28993,
-28979,
-28989,
-28947,
-28899,
-28788,
-28649,
-28483,
-28302,
-28136,
-27960,
-27812,
-27641,
-27485,
-27333,
-27169,
-27053,
-26906,
-26791,
-26670,
-26557,
-26467,
-26388,
-26324,
-26235,
-26153,
-26032,
-25949,
-25878,
-25892,
-25918,
-26032,
-26120,
-26245,
-26417,
-26580,
-26836,
-27055,
-27294,
-27457,
-27596,
-27629,
-27632,
-27536,
-27451,
-27283,
-27183,
-27024,
-26904,
-26774,
-26628,
-26561,
-26475,
-26526,
-26618,
-26793,
-27044,
-27298,
-27649,
-28002,
-28415,
-28837,
-29246,
-29666,
-30037,
-30404,
-30682,
-30949,
-31112,
-31235,
-31301,
-31319,
-31337,
-31347,
-31366,
-31386,
-31437,
-31489,
-31642,
-31829,
-32136,
-32461,
-32863,
-33244,
-33695,
-34130,
-34625,
-35075,
-35517,
-35876,
-36194,
-36460,
-36712,
-36903,
-37044,
-37126,
-37137,
-37154,
-37153,
-37197,
-37228,
-37310,
-37374,
-37532,
-37705,
-37936,
-38160,
-38437,
-38661,
-38976,
-39245,
-39588,
-39862,
-40149,
-40367,
-40541,
-40690,
-40766,
-40788,
-40748,
-40645,
-40533,
-40417,
-40276,
-40185,
-40039,
-39957,
-39864,
-39845,
-39810,
-39845,
-39824,
-39862,
-39882,
-39939,
-40010,
-40087,
-40143,
-40151,
-40152,
-40078,
-40002,
-39852,
-39652,
-39404,
-39111,
-38797,
-38470,
-38170,
-37872,
-37633,
-37416,
-37217,
-37083,
-36915,
-36830,
-36720,
-36654,
-36644,
-36596,
-36618,
-36592,
-36584,
-36544,
-36469,
-36344,
-36192,
-35971,
-35745,
-35483,
-35230,
-34972,
-34698,
-34447,
-34188,
-33980,
-33812,
-33703,
-33644,
-33612,
-33604,
-33601,
-33583,
-33588,
-33543,
-33547,
-33477,
-33462,
-33392,
-33348,
-33256,
-33159,
-33038,
-32907,
-32771,
-32624,
-32487,
-32354,
-32244,
-32178,
-32136,
-32136,
-32154,
-32168,
-32231,
-32244,
-32317,
-32336,
-32385,
-32411,
-32403,
-32404,
-32346,
-32298,
-32255,
-32185,
-32187,
-32155,
-32185,
-32184,
-32187,
-32176,
-32154,
-32156,
-32159,
-32197,
-32240,
-32278,
-32321,
-32324,
-32347,
-32318,
-32323,
-32299,
-32262,
-32251,
-32186,
-32147,
-32075,
-32001,
-31958,
-31929,
-31950,
-31952,
-31993,
-32031,
-32111,
-32207,
-32345,
-32458,
-32560,
-32609,
-32617,
-32625,
-32608,
-32623,
-32584,
-32557,
-32450,
-32379,
-32233,
-32134,
-31984,
-31826,
-31671,
-31466,
-31339,
-31204,
-31155,
-31130,
-31163,
-31212,
-31281,
-31381,
-31443,
-31562,
-31606,
-31673,
-31642,
-31622,
-31534,
-31459,
-31335,
-31203,
-31029,
-30864,
-30671,
-30498,
-30328,
-30160,
-30031,
-29899,
-29819,
-29760,
-29746,
-29729,
-29751,
-29737,
-29748,
-29767,
-29757,
-29773,
-29711,
-29652,
-29519,
-29395,
-29245,
-29109,
-29001,
-28884,
-28783,
-28687,
-28586,
-28526,
-28448,
-28390,
-28319,
-28230,
-28148,
-28067,
-28008,
-27993,
-27963,
-27960,
-27913,
-27863,
-27786,
-27698,
-27577,
-27476,
-27319,
-27164,
-26997,
-26822,
-26672,
-26517,
-26358,
-26193,
-26037,
-25929,
-25862,
-25919,
-25996,
-26208,
-26405,
-26715,
-27044,
-27431,
-27806,
-28125,
-28375,
-28514,
-28576,
-28557,
-28448,
-28275,
-28033,
-27755,
-27505,
-27278,
-27112,
-26984,
-26912,
-26894,
-26973,
-27139,
-27403,
-27727,
-28086,
-28504,
-28941,
-29445,
-29935,
-30387,
-30771,
-31063,
-31285,
-31419,
-31503,
-31478,
-31411,
-31281,
-31153,
-31086,
-31030,
-31086,
-31127,
-31285,
-31462,
-31769,
-32096,
-32553,
-32992,
-33510,
-34023,
-34558,
-35091,
-35596,
-36034,
-36388,
-36642,
-36764,
-36806,
-36748,
-36614,
-36476,
-36280,
-36175,
-36100,
-36169,
-36301,
-36513,
-36766,
-37033,
-37331,
-37657,
-38012,
-38366,
-38697,
-38988,
-39273,
-39533,
-39839,
-40077,
-40310,
-40402,
-40442,
-40326,
-40229,
-40001,
-39829,
-39607,
-39424,
-39322,
-39276,
-39331,
-39425,
-39532,
-39659,
-39733,
-39837,
-39860,
-39922,
-39884,
-39890,
-39833,
-39812,
-39764,
-39708,
-39638,
-39514,
-39371,
-39150,
-38929,
-38631,
-38353,
-38053,
-37812,
-37599,
-37451,
-37349,
-37265,
-37242,
-37229,
-37258,
-37274,
-37263,
-37209,
-37093,
-36956,
-36804,
-36649,
-36525,
-36381,
-36220,
-36054,
-35844,
-35651,
-35435,
-35257,
-35047,
-34879,
-34677,
-34506,
-34354,
-34222,
-34176,
-34129,
-34162,
-34170,
-34201,
-34163,
-34130,
-34011,
-33903,
-33755,
-33603,
-33453,
-33300,
-33182,
-33069,
-32987,
-32922,
-32874,
-32847,
-32832,
-32817,
-32825,
-32817,
-32835,
-32844,
-32850,
-32885,
-32892,
-32945,
-32960,
-32994,
-32977,
-32974,
-32927,
-32879,
-32818,
-32734,
-32651,
-32568,
-32496,
-32457,
-32464,
-32493,
-32561,
-32627,
-32713,
-32807,
-32918,
-33025,
-33114,
-33182,
-33211,
-33231,
-33216,
-33210,
-33202,
-33164,
-33160,
-33105,
-33076,
-33004,
-32942,
-32832,
-32770,
-32658,
-32630,
-32576,
-32573,
-32588,
-32627,
-32715,
-32812,
-32948,
-33060,
-33171,
-33218,
-33263,
-33230,
-33193,
-33118,
-33040,
-32953,
-32865,
-32786,
-32678,
-32585,
-32447,
-32297,
-32160,
-32016,
-31907,
-31804,
-31713,
-31646,
-31588,
-31543,
-31550,
-31556,
-31596,
-31620,
-31606,
-31576,
-31478,
-31374,
-31212,
-31054,
-30889,
-30711,
-30576,
-30414,
-30301,
-30186,
-30094,
-30016,
-29919,
-29832,
-29726,
-29629,
-29561,
-29485,
-29466,
-29425,
-29414,
-29392,
-29406,
-29380,
-29396,
-29293,
-29220,
-29013,
-28845,
-28611,
-28416,
-28249,
-28085,
-27996,
-27904,
-27869,
-27849,
-27841,
-27872,
-27849,
-27890,
-27859,
-27885,
-27870,
-27874,
-27896,
-27891,
-27904,
-27896,
-27864,
-27828,
-27741,
-27638,
-27526,
-27396,
-27252,
-27128,
-27020,
-26915,
-26869,
-26796,
-26768,
-26715,
-26665,
-26592,
-26500,
-26393,
-26289,
-26192,
-26197,
-26269,
-26482,
-26762,
-27142,
-27535,
-27960,
-28355,
-28716,
-29014,
-29191,
-29258,
-29174,
-29007,
-28742,
-28445,
-28144,
-27871,
-27669,
-27555,
-27532,
-27613,
-27759,
-27944,
-28232,
-28500,
-28862,
-29240,
-29638,
-30087,
-30479,
-30897,
-31227,
-31543,
-31740,
-31888,
-31915,
-31844,
-31723,
-31514,
-31383,
-31229,
-31246,
-31290,
-31537,
-31788,
-32195,
-32585,
-33046,
-33493,
-33945,
-34385,
-34771,
-35128,
-35423,
-35665,
-35858,
-35970,
-36023,
-35978,
-35866,
-35676,
-35467,
-35228,
-35072,
-34947,
-35005,
-35161,
-35488,
-35928,
-36411,
-36941,
-37442,
-37917,
-38322,
-38686,
-38928,
-39130,
-39227,
-39287,
-39339,
-39325,
-39342,
-39292,
-39221,
-39128,
-38951,
-38805,
-38569,
-38398,
-38245,
-38174,
-38233,
-38335,
-38567,
-38808,
-39062,
-39330,
-39533,
-39712,
-39780,
-39782,
-39701,
-39587,
-39450,
-39348,
-39264,
-39203,
-39157,
-39065,
-38970,
-38821,
-38658,
-38469,
-38272,
-38069,
-37878,
-37715,
-37591,
-37521,
-37502,
-37523,
-37570,
-37576,
-37557,
-37486,
-37378,
-37249,
-37119,
-36964,
-36827,
-36705,
-36622,
-36582,
-36581,
-36565,
-36524,
-36417,
-36292,
-36112,
-35982,
-35812,
-35672,
-35498,
-35337,
-35200,
-35093,
-35013,
-34975,
-34890,
-34820,
-34695,
-34575,
-34474,
-34348,
-34269,
-34172,
-34106,
-34060,
-34031,
-34040,
-34069,
-34075,
-34096,
-34040,
-33989,
-33866,
-33732,
-33565,
-33401,
-33234,
-33100,
-32991,
-32930,
-32924,
-32953,
-33016,
-33092,
-33162,
-33219,
-33261,
-33252,
-33243,
-33197,
-33142,
-33084,
-33013,
-32932,
-32845,
-32755,
-32659,
-32576,
-32481,
-32387,
-32277,
-32187,
-32093,
-32040,
-32000,
-32026,
-32083,
-32170,
-32279,
-32403,
-32501,
-32579,
-32612,
-32592,
-32538,
-32440,
-32326,
-32204,
-32078,
-31983,
-31925,
-31889,
-31892,
-31877,
-31884,
-31852,
-31842,
-31815,
-31790,
-31746,
-31691,
-31630,
-31556,
-31503,
-31429,
-31345,
-31249,
-31121,
-31029,
-30911,
-30827,
-30746,
-30651,
-30583,
-30513,
-30492,
-30509,
-30561,
-30632,
-30721,
-30776,
-30847,
-30842,
-30850,
-30789,
-30699,
-30582,
-30445,
-30311,
-30170,
-30067,
-29952,
-29870,
-29784,
-29731,
-29679,
-29654,
-29622,
-29605,
-29574,
-29564,
-29530,
-29537,
-29557,
-29591,
-29655,
-29689,
-29752,
-29773,
-29784,
-29764,
-29738,
-29685,
-29644,
-29546,
-29472,
-29340,
-29240,
-29135,
-29049,
-29012,
-28941,
-28912,
-28846,
-28773,
-28728,
-28704,
-28728,
-28753,
-28794,
-28840,
-28869,
-28952,
-28980,
-29082,
-29104,
-29128,
-29096,
-29006,
-28913,
-28777,
-28666,
-28527,
-28424,
-28317,
-28268,
-28224,
-28241,
-28237,
-28251,
-28210,
-28160,
-28093,
-27991,
-27912,
-27756,
-27652,
-27505,
-27459,
-27450,
-27545,
-27693,
-27883,
-28160,
-28423,
-28785,
-29106,
-29425,
-29647,
-29771,
-29768,
-29655,
-29466,
-29181,
-28907,
-28592,
-28366,
-28211,
-28165,
-28255,
-28449,
-28755,
-29131,
-29517,
-29927,
-30299,
-30674,
-30965,
-31263,
-31464,
-31646,
-31740,
-31804,
-31787,
-31725,
-31627,
-31482,
-31366,
-31261,
-31211,
-31250,
-31358,
-31587,
-31898,
-32301,
-32756,
-33220,
-33688,
-34119,
-34463,
-34766,
-34937,
-35073,
-35135,
-35196,
-35268,
-35366,
-35434,
-35505,
-35499,
-35489,
-35461,
-35458,
-35489,
-35569,
-35723,
-35940,
-36250,
-36648,
-37085,
-37505,
-37874,
-38110,
-38248,
-38269,
-38196,
-38090,
-37952,
-37832,
-37799,
-37797,
-37942,
-38077,
-38309,
-38479,
-38653,
-38738,
-38778,
-38764,
-38723,
-38711,
-38698,
-38773,
-38849,
-39005,
-39090,
-39181,
-39156,
-39050,
-38860,
-38587,
-38288,
-38015,
-37809,
-37683,
-37694,
-37749,
-37919,
-38051,
-38196,
-38266,
-38277,
-38224,
-38099,
-37941,
-37724,
-37529,
-37344,
-37200,
-37127,
-37052,
-37032,
-36940,
-36838,
-36650,
-36435,
-36198,
-35953,
-35764,
-35617,
-35548,
-35502,
-35536,
-35543,
-35587,
-35568,
-35504,
-35374,
-35187,
-34970,
-34749,
-34575,
-34430,
-34348,
-34296,
-34284,
-34256,
-34242,
-34195,
-34167,
-34056,
-33972,
-33786,
-33643,
-33448,
-33325,
-33221,
-33197,
-33212,
-33268,
-33319,
-33388,
-33402,
-33429,
-33390,
-33327,
-33252,
-33158,
-33088,
-33012,
-32953,
-32915,
-32855,
-32810,
-32725,
-32643,
-32579,
-32477,
-32446,
-32370,
-32381,
-32365,
-32425,
-32470,
-32577,
-32683,
-32817,
-32948,
-33071,
-33136,
-33185,
-33122,
-33062,
-32920,
-32783,
-32635,
-32481,
-32359,
-32232,
-32168,
-32103,
-32104,
-32109,
-32155,
-32209,
-32287,
-32346,
-32407,
-32437,
-32436,
-32421,
-32404,
-32384,
-32369,
-32322,
-32269,
-32168,
-32065,
-31946,
-31809,
-31708,
-31559,
-31473,
-31387,
-31352,
-31345,
-31418,
-31448,
-31562,
-31612,
-31701,
-31732,
-31734,
-31676,
-31579,
-31453,
-31302,
-31168,
-31032,
-30915,
-30844,
-30762,
-30751,
-30717,
-30742,
-30712,
-30745,
-30710,
-30746,
-30729,
-30770,
-30807,
-30859,
-30933,
-31006,
-31063,
-31134,
-31136,
-31150,
-31055,
-30972,
-30809,
-30672,
-30519,
-30397,
-30311,
-30224,
-30197,
-30174,
-30180,
-30188,
-30212,
-30168,
-30166,
-30091,
-30066,
-30051,
-30067,
-30137,
-30193,
-30304,
-30351,
-30407,
-30385,
-30344,
-30227,
-30094,
-29920,
-29726,
-29548,
-29393,
-29290,
-29237,
-29235,
-29244,
-29303,
-29318,
-29379,
-29424,
-29482,
-29543,
-29581,
-29625,
-29655,
-29681,
-29722,
-29722,
-29699,
-29651,
-29523,
-29425,
-29273,
-29143,
-29006,
-28886,
-28789,
-28742,
-28735,
-28783,
-28789,
-28835,
-28801,
-28784,
-28741,
-28659,
-28568,
-28428,
-28288,
-28177,
-28135,
-28161,
-28299,
-28495,
-28808,
-29171,
-29589,
-30023,
-30405,
-30701,
-30877,
-30878,
-30748,
-30445,
-30038,
-29588,
-29144,
-28804,
-28620,
-28584,
-28736,
-29010,
-29377,
-29837,
-30323,
-30807,
-31279,
-31657,
-31995,
-32204,
-32386,
-32444,
-32510,
-32484,
-32458,
-32337,
-32226,
-32021,
-31852,
-31677,
-31544,
-31544,
-31636,
-31904,
-32302,
-32828,
-33394,
-33988,
-34488,
-34930,
-35242,
-35430,
-35517,
-35503,
-35447,
-35422,
-35420,
-35514,
-35591,
-35667,
-35710,
-35660,
-35666,
-35613,
-35667,
-35706,
-35880,
-36124,
-36528,
-37025,
-37562,
-38072,
-38430,
-38674,
-38717,
-38661,
-38460,
-38183,
-37852,
-37568,
-37387,
-37371,
-37521,
-37756,
-38063,
-38330,
-38594,
-38749,
-38861,
-38871,
-38843,
-38801,
-38827,
-38902,
-39080,
-39262,
-39413,
-39473,
-39420,
-39235,
-38948,
-38586,
-38163,
-37800,
-37488,
-37323,
-37308,
-37413,
-37615,
-37830,
-38009,
-38131,
-38126,
-38091,
-37889,
-37719,
-37442,
-37227,
-37022,
-36911,
-36834,
-36818,
-36746,
-36636,
-36448,
-36184,
-35878,
-35585,
-35248,
-35037,
-34829,
-34746,
-34730,
-34749,
-34788,
-34774,
-34725,
-34612,
-34490,
-34293,
-34112,
-33883,
-33684,
-33489,
-33347,
-33233,
-33165,
-33119,
-33077,
-33051,
-32972,
-32859,
-32705,
-32467,
-32263,
-32028,
-31874,
-31743,
-31686,
-31649,
-31664,
-31685,
-31728,
-31781,
-31794,
-31765,
-31711,
-31584,
-31496,
-31379,
-31283,
-31229,
-31167,
-31132,
-31115,
-31117,
-31128,
-31163,
-31141,
-31145,
-31075,
-31033,
-30967,
-30952,
-30934,
-30998,
-31048,
-31163,
-31266,
-31396,
-31502,
-31561,
-31605,
-31547,
-31505,
-31392,
-31281,
-31182,
-31077,
-31050,
-31032,
-31075,
-31152,
-31215,
-31301,
-31359,
-31399,
-31468,
-31486,
-31516,
-31513,
-31504,
-31513,
-31560,
-31608,
-31697,
-31737,
-31806,
-31815,
-31833,
-31808,
-31775,
-31753,
-31707,
-31755,
-31767,
-31858,
-31933,
-31999,
-32107,
-32157,
-32261,
-32312,
-32332,
-32339,
-32280,
-32246,
-32214,
-32216,
-32224,
-32260,
-32293,
-32340,
-32424,
-32502,
-32605,
-32683,
-32736,
-32778,
-32780,
-32808,
-32837,
-32883,
-32951,
-33002,
-33041,
-33071,
-33045,
-33008,
-32926,
-32808,
-32673,
-32523,
-32390,
-32271,
-32197,
-32140,
-32143,
-32159,
-32198,
-32254,
-32288,
-32310,
-32296,
-32258,
-32185,
-32134,
-32049,
-31999,
-31927,
-31881,
-31799,
-31722,
-31606,
-31469,
-31317,
-31133,
-30964,
-30794,
-30641,
-30541,
-30438,
-30407,
-30371,
-30371,
-30332,
-30305,
-30230,
-30150,
-30034,
-29922,
-29803,
-29692,
-29625,
-29514,
-29467,
-29350,
-29275,
-29141,
-29019,
-28913,
-28787,
-28741,
-28695,
-28698,
-28755,
-28817,
-28914,
-28998,
-29027,
-28996,
-28887,
-28729,
-28506,
-28301,
-28088,
-27922,
-27820,
-27769,
-27794,
-27882,
-27995,
-28142,
-28251,
-28353,
-28403,
-28442,
-28492,
-28512,
-28554,
-28539,
-28485,
-28395,
-28275,
-28178,
-28111,
-28120,
-28206,
-28421,
-28776,
-29260,
-29880,
-30458,
-31030,
-31387,
-31587,
-31596,
-31401,
-31084,
-30648,
-30209,
-29879,
-29769,
-29911,
-30306,
-30841,
-31441,
-32041,
-32573,
-33045,
-33390,
-33588,
-33679,
-33649,
-33647,
-33646,
-33745,
-33821,
-33927,
-33936,
-33937,
-33877,
-33829,
-33817,
-33873,
-34074,
-34439,
-34980,
-35619,
-36310,
-36890,
-37352,
-37598,
-37662,
-37567,
-37373,
-37142,
-36968,
-36900,
-36992,
-37221,
-37584,
-37903,
-38231,
-38379,
-38406,
-38285,
-38084,
-37904,
-37797,
-37829,
-38095,
-38479,
-39065,
-39603,
-40116,
-40391,
-40475,
-40284,
-39962,
-39541,
-39157,
-38869,
-38766,
-38860,
-39145,
-39545,
-39921,
-40186,
-40219,
-40099,
-39797,
-39459,
-39137,
-38877,
-38771,
-38788,
-39020,
-39315,
-39641,
-39858,
-39834,
-39623,
-39179,
-38654,
-38078,
-37548,
-37133,
-36834,
-36746,
-36783,
-36965,
-37142,
-37264,
-37267,
-37132,
-36885,
-36568,
-36226,
-35913,
-35649,
-35470,
-35358,
-35276,
-35170,
-35021,
-34747,
-34395,
-33945,
-33460,
-33002,
-32566,
-32253,
-32008,
-31912,
-31871,
-31924,
-31974,
-32032,
-32016,
-31940,
-31793,
-31597,
-31361,
-31118,
-30825,
-30590,
-30302,
-30119,
-29904,
-29784,
-29652,
-29547,
-29454,
-29348,
-29234,
-29098,
-28931,
-28763,
-28572,
-28431,
-28319,
-28277,
-28282,
-28364,
-28439,
-28581,
-28658,
-28735,
-28723,
-28639,
-28504,
-28301,
-28114,
-27962,
-27868,
-27881,
-27958,
-28114,
-28325,
-28563,
-28814,
-29003,
-29160,
-29196,
-29220,
-29166,
-29162,
-29179,
-29261,
-29409,
-29563,
-29749,
-29871,
-29977,
-30010,
-29970,
-29921,
-29800,
-29765,
-29730,
-29841,
-29989,
-30271,
-30598,
-30968,
-31340,
-31666,
-31928,
-32096,
-32200,
-32229,
-32239,
-32238,
-32270,
-32352,
-32486,
-32679,
-32905,
-33129,
-33329,
-33452,
-33530,
-33547,
-33543,
-33538,
-33529,
-33559,
-33619,
-33706,
-33860,
-34007,
-34225,
-34393,
-34590,
-34697,
-34822,
-34833,
-34914,
-34884,
-34950,
-34955,
-35046,
-35124,
-35236,
-35349,
-35432,
-35499,
-35509,
-35509,
-35477,
-35461,
-35404,
-35396,
-35318,
-35314,
-35259,
-35294,
-35275,
-35294,
-35260,
-35193,
-35130,
-35023,
-34903,
-34763,
-34604,
-34464,
-34388,
-34336,
-34363,
-34375,
-34376,
-34369,
-34326,
-34271,
-34194,
-34087,
-33942,
-33802,
-33645,
-33530,
-33424,
-33323,
-33192,
-33074,
-32919,
-32784,
-32627,
-32461,
-32234,
-32053,
-31811,
-31674,
-31517,
-31434,
-31332,
-31235,
-31135,
-31034,
-30926,
-30838,
-30729,
-30644,
-30566,
-30493,
-30432,
-30361,
-30262,
-30148,
-30028,
-29894,
-29750,
-29619,
-29494,
-29393,
-29320,
-29274,
-29239,
-29255,
-29235,
-29254,
-29210,
-29191,
-29102,
-29050,
-28966,
-28927,
-28913,
-28976,
-29076,
-29233,
-29407,
-29553,
-29691,
-29734,
-29761,
-29723,
-29625,
-29531,
-29397,
-29293,
-29202,
-29157,
-29144,
-29181,
-29204,
-29284,
-29332,
-29443,
-29559,
-29712,
-29864,
-30050,
-30177,
-30325,
-30383,
-30382,
-30309,
-30176,
-29984,
-29830,
-29665,
-29625,
-29640,
-29877,
-30234,
-30842,
-31544,
-32300,
-32935,
-33353,
-33478,
-33292,
-32838,
-32170,
-31413,
-30678,
-30126,
-29885,
-29974,
-30393,
-31020,
-31759,
-32521,
-33201,
-33755,
-34083,
-34204,
-34070,
-33829,
-33529,
-33315,
-33184,
-33169,
-33183,
-33219,
-33200,
-33126,
-33026,
-32875,
-32839,
-32893,
-33234,
-33758,
-34518,
-35291,
-35998,
-36454,
-36605,
-36441,
-35978,
-35391,
-34771,
-34308,
-34118,
-34233,
-34639,
-35226,
-35846,
-36379,
-36731,
-36837,
-36742,
-36427,
-36083,
-35769,
-35635,
-35792,
-36174,
-36804,
-37485,
-38091,
-38486,
-38562,
-38313,
-37749,
-37061,
-36330,
-35816,
-35555,
-35672,
-36074,
-36694,
-37313,
-37827,
-38113,
-38079,
-37844,
-37439,
-37023,
-36746,
-36629,
-36807,
-37116,
-37556,
-37901,
-38118,
-38052,
-37757,
-37200,
-36560,
-35839,
-35247,
-34792,
-34571,
-34621,
-34830,
-35189,
-35527,
-35746,
-35839,
-35723,
-35527,
-35224,
-34922,
-34657,
-34438,
-34294,
-34205,
-34097,
-33962,
-33713,
-33379,
-32964,
-32520,
-32110,
-31773,
-31567,
-31465,
-31474,
-31536,
-31608,
-31635,
-31637,
-31583,
-31537,
-31489,
-31426,
-31361,
-31232,
-31061,
-30844,
-30533,
-30240,
-29865,
-29565,
-29290,
-29148,
-29099,
-29186,
-29312,
-29466,
-29579,
-29635,
-29594,
-29520,
-29343,
-29208,
-29063,
-29065,
-29156,
-29384,
-29675,
-29978,
-30209,
-30313,
-30272,
-30080,
-29773,
-29422,
-29083,
-28853,
-28767,
-28859,
-29124,
-29470,
-29848,
-30178,
-30404,
-30505,
-30498,
-30425,
-30313,
-30250,
-30232,
-30298,
-30448,
-30632,
-30837,
-31017,
-31130,
-31160,
-31140,
-31069,
-31012,
-30973,
-31008,
-31100,
-31267,
-31496,
-31747,
-32002,
-32192,
-32303,
-32308,
-32240,
-32151,
-32048,
-31996,
-31999,
-32023,
-32131,
-32227,
-32394,
-32563,
-32760,
-32919,
-33071,
-33170,
-33308,
-33372,
-33479,
-33519,
-33573,
-33589,
-33655,
-33699,
-33834,
-33906,
-34024,
-34115,
-34189,
-34303,
-34368,
-34452,
-34498,
-34527,
-34572,
-34608,
-34705,
-34779,
-34916,
-35018,
-35167,
-35316,
-35431,
-35584,
-35671,
-35756,
-35837,
-35906,
-35999,
-36075,
-36157,
-36214,
-36299,
-36341,
-36382,
-36417,
-36384,
-36419,
-36425,
-36506,
-36601,
-36718,
-36820,
-36945,
-37030,
-37131,
-37194,
-37262,
-37273,
-37299,
-37257,
-37236,
-37181,
-37103,
-37016,
-36896,
-36816,
-36716,
-36682,
-36637,
-36617,
-36644,
-36677,
-36782,
-36860,
-36942,
-36964,
-36911,
-36815,
-36626,
-36433,
-36196,
-35965,
-35728,
-35543,
-35364,
-35274,
-35184,
-35138,
-35061,
-35012,
-34891,
-34800,
-34653,
-34499,
-34346,
-34191,
-34056,
-33957,
-33833,
-33761,
-33606,
-33448,
-33217,
-32945,
-32636,
-32336,
-31990,
-31773,
-31513,
-31416,
-31319,
-31328,
-31344,
-31348,
-31319,
-31240,
-31091,
-30911,
-30672,
-30417,
-30163,
-29898,
-29685,
-29506,
-29369,
-29259,
-29196,
-29136,
-29124,
-29105,
-29104,
-29073,
-28986,
-28888,
-28706,
-28541,
-28375,
-28181,
-28085,
-27969,
-27941,
-27948,
-27989,
-28019,
-28062,
-28024,
-28038,
-27984,
-28001,
-27976,
-27988,
-27931,
-27864,
-27674,
-27468,
-27161,
-26844,
-26528,
-26194,
-25976,
-25824,
-25888,
-26155,
-26703,
-27468,
-28431,
-29421,
-30315,
-30925,
-31087,
-30751,
-29938,
-28751,
-27496,
-26270,
-25454,
-25022,
-25145,
-25694,
-26597,
-27714,
-28820,
-29831,
-30546,
-30939,
-30988,
-30747,
-30372,
-29943,
-29621,
-29445,
-29447,
-29512,
-29652,
-29642,
-29559,
-29295,
-29013,
-28773,
-28762,
-29093,
-29783,
-30824,
-31945,
-33036,
-33769,
-34081,
-33838,
-33188,
-32265,
-31373,
-30711,
-30517,
-30783,
-31521,
-32454,
-33454,
-34259,
-34731,
-34857,
-34572,
-34069,
-33424,
-32907,
-32658,
-32803,
-33382,
-34272,
-35385,
-36436,
-37286,
-37727,
-37705,
-37221,
-36469,
-35622,
-35008,
-34726,
-34919,
-35473,
-36242,
-37027,
-37625,
-37940,
-37869,
-37557,
-37057,
-36645,
-36400,
-36486,
-36812,
-37348,
-37879,
-38333,
-38554,
-38577,
-38312,
-37905,
-37321,
-36775,
-36272,
-35991,
-35925,
-36103,
-36445,
-36875,
-37280,
-37564,
-37705,
-37646,
-37455,
-37123,
-36776,
-36417,
-36170,
-35976,
-35879,
-35746,
-35577,
-35338,
-35038,
-34758,
-34507,
-34341,
-34225,
-34182,
-34166,
-34189,
-34217,
-34207,
-34153,
-34064,
-33965,
-33901,
-33901,
-33881,
-33839,
-33675,
-33402,
-33036,
-32618,
-32185,
-31779,
-31434,
-31194,
-31090,
-31127,
-31239,
-31397,
-31509,
-31560,
-31527,
-31420,
-31243,
-31038,
-30794,
-30618,
-30516,
-30545,
-30696,
-30875,
-31049,
-31102,
-31028,
-30830,
-30493,
-30130,
-29720,
-29384,
-29154,
-29050,
-29140,
-29316,
-29623,
-29892,
-30165,
-30346,
-30461,
-30534,
-30558,
-30566,
-30518,
-30456,
-30351,
-30266,
-30169,
-30095,
-30008,
-29957,
-29876,
-29869,
-29860,
-29912,
-29983,
-30066,
-30195,
-30358,
-30553,
-30774,
-30984,
-31147,
-31358,
-31509,
-31738,
-31953,
-32141,
-32311,
-32417,
-32473,
-32514,
-32505,
-32470,
-32411,
-32381,
-32409,
-32540,
-32725,
-32979,
-33239,
-33478,
-33695,
-33865,
-34033,
-34168,
-34307,
-34472,
-34670,
-34947,
-35239,
-35560,
-35814,
-36044,
-36211,
-36307,
-36351,
-36328,
-36265,
-36237,
-36234,
-36355,
-36558,
-36848,
-37175,
-37523,
-37831,
-38143,
-38368,
-38542,
-38659,
-38711,
-38750,
-38735,
-38763,
-38757,
-38810,
-38805,
-38861,
-38887,
-38979,
-39044,
-39158,
-39252,
-39335,
-39386,
-39398,
-39374,
-39344,
-39274,
-39235,
-39191,
-39162,
-39178,
-39167,
-39172,
-39132,
-39031,
-38875,
-38664,
-38406,
-38131,
-37876,
-37668,
-37568,
-37574,
-37669,
-37819,
-37947,
-38015,
-37931,
-37719,
-37358,
-36894,
-36382,
-35857,
-35436,
-35110,
-34981,
-34942,
-35011,
-35097,
-35101,
-35061,
-34872,
-34600,
-34246,
-33854,
-33460,
-33136,
-32879,
-32721,
-32628,
-32530,
-32442,
-32245,
-31981,
-31589,
-31117,
-30637,
-30178,
-29828,
-29609,
-29540,
-29550,
-29656,
-29715,
-29764,
-29658,
-29483,
-29149,
-28729,
-28280,
-27819,
-27464,
-27209,
-27076,
-27073,
-27110,
-27221,
-27275,
-27330,
-27277,
-27190,
-27015,
-26810,
-26603,
-26371,
-26175,
-25999,
-25866,
-25785,
-25764,
-25774,
-25819,
-25876,
-25956,
-26075,
-26190,
-26350,
-26446,
-26520,
-26509,
-26422,
-26267,
-26065,
-25826,
-25606,
-25401,
-25267,
-25186,
-25193,
-25249,
-25377,
-25541,
-25743,
-25988,
-26251,
-26527,
-26734,
-26884,
-26864,
-26722,
-26444,
-26095,
-25693,
-25304,
-24913,
-24630,
-24474,
-24564,
-24913,
-25570,
-26490,
-27621,
-28840,
-29966,
-30796,
-31092,
-30727,
-29731,
-28285,
-26664,
-25221,
-24172,
-23668,
-23821,
-24529,
-25809,
-27362,
-28997,
-30377,
-31276,
-31645,
-31443,
-30925,
-30152,
-29443,
-28843,
-28554,
-28555,
-28805,
-29171,
-29423,
-29521,
-29334,
-29048,
-28773,
-28720,
-29075,
-29840,
-31068,
-32476,
-33894,
-34920,
-35399,
-35078,
-34162,
-32793,
-31452,
-30441,
-30105,
-30505,
-31568,
-33020,
-34554,
-35823,
-36617,
-36738,
-36264,
-35279,
-34119,
-33099,
-32531,
-32626,
-33366,
-34693,
-36254,
-37856,
-39099,
-39750,
-39680,
-38869,
-37636,
-36272,
-35268,
-34832,
-35052,
-35842,
-36872,
-37982,
-38808,
-39251,
-39206,
-38684,
-37925,
-37182,
-36755,
-36805,
-37305,
-38056,
-38823,
-39406,
-39697,
-39640,
-39254,
-38634,
-37832,
-37125,
-36577,
-36389,
-36548,
-36927,
-37492,
-37984,
-38417,
-38607,
-38629,
-38360,
-37979,
-37465,
-37063,
-36760,
-36657,
-36629,
-36647,
-36577,
-36417,
-36175,
-35905,
-35689,
-35569,
-35561,
-35671,
-35818,
-35967,
-36028,
-35968,
-35774,
-35497,
-35201,
-34961,
-34858,
-34848,
-34962,
-35077,
-35121,
-35080,
-34873,
-34549,
-34142,
-33712,
-33379,
-33183,
-33202,
-33402,
-33736,
-34109,
-34432,
-34615,
-34634,
-34434,
-34083,
-33596,
-33092,
-32681,
-32454,
-32490,
-32714,
-33058,
-33397,
-33631,
-33731,
-33640,
-33421,
-33068,
-32728,
-32407,
-32249,
-32226,
-32373,
-32595,
-32832,
-33075,
-33222,
-33347,
-33358,
-33319,
-33192,
-33002,
-32813,
-32606,
-32447,
-32321,
-32208,
-32164,
-32108,
-32144,
-32206,
-32322,
-32481,
-32637,
-32812,
-32963,
-33047,
-33127,
-33061,
-33023,
-32859,
-32767,
-32659,
-32645,
-32669,
-32731,
-32788,
-32783,
-32741,
-32612,
-32461,
-32279,
-32143,
-32075,
-32134,
-32355,
-32658,
-33073,
-33474,
-33822,
-34065,
-34163,
-34139,
-34001,
-33773,
-33528,
-33288,
-33148,
-33105,
-33196,
-33353,
-33579,
-33750,
-33923,
-33964,
-33960,
-33892,
-33794,
-33738,
-33731,
-33833,
-34057,
-34333,
-34689,
-35017,
-35291,
-35474,
-35496,
-35433,
-35238,
-34964,
-34685,
-34396,
-34212,
-34106,
-34138,
-34259,
-34495,
-34718,
-35008,
-35191,
-35374,
-35427,
-35442,
-35377,
-35315,
-35239,
-35221,
-35230,
-35261,
-35339,
-35370,
-35410,
-35405,
-35318,
-35196,
-34970,
-34718,
-34457,
-34211,
-34036,
-33938,
-33953,
-34044,
-34232,
-34442,
-34657,
-34815,
-34860,
-34841,
-34660,
-34471,
-34123,
-33840,
-33473,
-33227,
-32996,
-32905,
-32833,
-32839,
-32819,
-32765,
-32681,
-32522,
-32380,
-32200,
-32056,
-31974,
-31904,
-31976,
-31999,
-32136,
-32157,
-32178,
-32077,
-31881,
-31609,
-31246,
-30882,
-30534,
-30280,
-30100,
-30060,
-30082,
-30214,
-30312,
-30449,
-30470,
-30467,
-30353,
-30205,
-30008,
-29841,
-29696,
-29610,
-29554,
-29528,
-29517,
-29507,
-29484,
-29434,
-29366,
-29271,
-29181,
-29081,
-29026,
-28997,
-29014,
-29062,
-29112,
-29213,
-29277,
-29396,
-29499,
-29588,
-29707,
-29772,
-29864,
-29912,
-29922,
-29873,
-29721,
-29535,
-29275,
-29072,
-28914,
-28898,
-28965,
-29156,
-29388,
-29690,
-29982,
-30276,
-30477,
-30607,
-30597,
-30529,
-30376,
-30208,
-29994,
-29774,
-29512,
-29287,
-29099,
-28956,
-28902,
-28822,
-28783,
-28756,
-28830,
-28981,
-29259,
-29509,
-29770,
-29875,
-29854,
-29682,
-29383,
-28984,
-28566,
-28112,
-27720,
-27419,
-27272,
-27337,
-27666,
-28294,
-29188,
-30299,
-31439,
-32375,
-32877,
-32698,
-31819,
-30350,
-28545,
-26822,
-25408,
-24632,
-24507,
-25169,
-26384,
-28139,
-29939,
-31606,
-32639,
-32999,
-32597,
-31702,
-30522,
-29387,
-28477,
-27983,
-27948,
-28388,
-29091,
-29854,
-30349,
-30466,
-30161,
-29663,
-29274,
-29190,
-29704,
-30703,
-32217,
-33775,
-35144,
-35798,
-35552,
-34432,
-32666,
-30839,
-29421,
-28835,
-29207,
-30470,
-32288,
-34344,
-36159,
-37409,
-37833,
-37358,
-36196,
-34595,
-33126,
-32105,
-31968,
-32736,
-34326,
-36423,
-38537,
-40214,
-41043,
-40905,
-39879,
-38275,
-36608,
-35277,
-34688,
-34918,
-35868,
-37248,
-38663,
-39771,
-40333,
-40294,
-39799,
-39106,
-38520,
-38373,
-38697,
-39564,
-40600,
-41649,
-42295,
-42482,
-42080,
-41271,
-40185,
-39079,
-38149,
-37575,
-37467,
-37824,
-38535,
-39429,
-40269,
-40922,
-41221,
-41238,
-40961,
-40601,
-40222,
-39997,
-39888,
-39920,
-39887,
-39785,
-39414,
-38877,
-38206,
-37559,
-37117,
-36951,
-37086,
-37495,
-38008,
-38466,
-38735,
-38693,
-38347,
-37770,
-37086,
-36462,
-36032,
-35880,
-35960,
-36214,
-36473,
-36593,
-36501,
-36097,
-35462,
-34676,
-33864,
-33224,
-32808,
-32750,
-32965,
-33361,
-33820,
-34098,
-34146,
-33852,
-33264,
-32458,
-31610,
-30853,
-30380,
-30221,
-30432,
-30806,
-31295,
-31621,
-31724,
-31528,
-31038,
-30354,
-29572,
-28814,
-28229,
-27843,
-27726,
-27834,
-28050,
-28361,
-28640,
-28853,
-28986,
-28977,
-28851,
-28619,
-28315,
-27979,
-27654,
-27338,
-27082,
-26842,
-26669,
-26547,
-26504,
-26546,
-26625,
-26749,
-26865,
-26955,
-27035,
-27045,
-27021,
-26974,
-26851,
-26811,
-26769,
-26816,
-26935,
-27084,
-27205,
-27294,
-27269,
-27149,
-26984,
-26786,
-26678,
-26676,
-26853,
-27175,
-27623,
-28105,
-28563,
-28923,
-29135,
-29189,
-29087,
-28855,
-28608,
-28366,
-28271,
-28365,
-28642,
-29144,
-29705,
-30335,
-30862,
-31288,
-31525,
-31623,
-31559,
-31438,
-31303,
-31220,
-31308,
-31497,
-31851,
-32248,
-32666,
-33053,
-33381,
-33621,
-33814,
-33918,
-34015,
-34082,
-34208,
-34402,
-34639,
-34976,
-35284,
-35640,
-35933,
-36200,
-36378,
-36492,
-36489,
-36445,
-36361,
-36322,
-36390,
-36571,
-36880,
-37269,
-37676,
-38063,
-38387,
-38626,
-38766,
-38795,
-38695,
-38510,
-38276,
-38068,
-37924,
-37914,
-37986,
-38169,
-38421,
-38667,
-38959,
-39130,
-39254,
-39222,
-39145,
-38976,
-38833,
-38673,
-38567,
-38455,
-38371,
-38307,
-38263,
-38231,
-38185,
-38139,
-38096,
-38043,
-38035,
-38002,
-38031,
-38011,
-38033,
-38017,
-37994,
-37926,
-37762,
-37535,
-37238,
-36929,
-36631,
-36371,
-36126,
-35930,
-35766,
-35654,
-35611,
-35590,
-35614,
-35609,
-35608,
-35559,
-35477,
-35342,
-35135,
-34873,
-34570,
-34260,
-33938,
-33640,
-33350,
-33081,
-32895,
-32763,
-32748,
-32767,
-32848,
-32883,
-32904,
-32858,
-32754,
-32582,
-32319,
-32013,
-31666,
-31364,
-31108,
-30974,
-30869,
-30866,
-30830,
-30817,
-30740,
-30638,
-30470,
-30297,
-30119,
-29983,
-29955,
-29967,
-30058,
-30149,
-30212,
-30253,
-30196,
-30057,
-29811,
-29472,
-29071,
-28654,
-28304,
-28061,
-27962,
-28014,
-28174,
-28426,
-28690,
-28876,
-28999,
-28959,
-28853,
-28645,
-28359,
-28057,
-27688,
-27341,
-27031,
-26816,
-26713,
-26719,
-26771,
-26865,
-26982,
-27097,
-27190,
-27269,
-27261,
-27264,
-27219,
-27225,
-27145,
-26994,
-26656,
-26211,
-25722,
-25313,
-25017,
-24834,
-24673,
-24635,
-24738,
-25205,
-26033,
-27168,
-28447,
-29620,
-30547,
-31047,
-30949,
-30174,
-28681,
-26730,
-24701,
-23049,
-22100,
-22008,
-22630,
-23910,
-25634,
-27646,
-29619,
-31181,
-31966,
-31908,
-31141,
-30070,
-29028,
-28197,
-27670,
-27403,
-27488,
-27830,
-28416,
-28889,
-29104,
-28901,
-28469,
-28184,
-28290,
-29007,
-30160,
-31632,
-33105,
-34370,
-35099,
-35108,
-34229,
-32701,
-30921,
-29453,
-28782,
-29073,
-30202,
-31894,
-33731,
-35451,
-36704,
-37302,
-37093,
-36171,
-34825,
-33511,
-32627,
-32496,
-33157,
-34472,
-36164,
-37856,
-39230,
-39999,
-40036,
-39343,
-38221,
-36960,
-35999,
-35601,
-35819,
-36621,
-37697,
-38804,
-39595,
-39965,
-39820,
-39317,
-38696,
-38191,
-38093,
-38447,
-39235,
-40211,
-41131,
-41741,
-41913,
-41626,
-41039,
-40198,
-39369,
-38579,
-38009,
-37727,
-37744,
-38062,
-38526,
-39007,
-39380,
-39587,
-39656,
-39619,
-39511,
-39380,
-39234,
-39099,
-38960,
-38754,
-38404,
-37851,
-37106,
-36308,
-35588,
-35135,
-34950,
-35037,
-35280,
-35572,
-35801,
-35889,
-35716,
-35329,
-34736,
-34121,
-33606,
-33350,
-33303,
-33439,
-33572,
-33582,
-33399,
-32982,
-32390,
-31647,
-30870,
-30141,
-29568,
-29266,
-29250,
-29498,
-29897,
-30301,
-30558,
-30560,
-30286,
-29751,
-29066,
-28355,
-27713,
-27328,
-27229,
-27461,
-27903,
-28450,
-28890,
-29112,
-29043,
-28707,
-28169,
-27562,
-26917,
-26404,
-26023,
-25888,
-26005,
-26279,
-26726,
-27153,
-27576,
-27885,
-28075,
-28137,
-28059,
-27906,
-27705,
-27558,
-27484,
-27531,
-27636,
-27803,
-27979,
-28136,
-28277,
-28353,
-28390,
-28390,
-28387,
-28410,
-28513,
-28723,
-29043,
-29477,
-29930,
-30422,
-30852,
-31222,
-31474,
-31597,
-31593,
-31466,
-31294,
-31140,
-31073,
-31170,
-31393,
-31766,
-32232,
-32702,
-33174,
-33562,
-33826,
-33984,
-33998,
-33973,
-33917,
-33929,
-34059,
-34260,
-34651,
-35053,
-35568,
-36034,
-36447,
-36709,
-36840,
-36800,
-36671,
-36504,
-36352,
-36304,
-36357,
-36546,
-36851,
-37226,
-37627,
-38042,
-38348,
-38632,
-38783,
-38895,
-38961,
-39015,
-39078,
-39162,
-39257,
-39349,
-39427,
-39483,
-39504,
-39534,
-39534,
-39580,
-39596,
-39696,
-39757,
-39942,
-40112,
-40345,
-40587,
-40760,
-40890,
-40901,
-40802,
-40631,
-40358,
-40095,
-39798,
-39584,
-39413,
-39339,
-39341,
-39403,
-39526,
-39671,
-39824,
-39945,
-40028,
-39998,
-39917,
-39729,
-39489,
-39237,
-38958,
-38712,
-38466,
-38250,
-38031,
-37843,
-37649,
-37493,
-37341,
-37207,
-37097,
-36982,
-36894,
-36790,
-36703,
-36562,
-36415,
-36221,
-35996,
-35752,
-35495,
-35230,
-34954,
-34684,
-34392,
-34145,
-33914,
-33713,
-33540,
-33391,
-33247,
-33115,
-32973,
-32816,
-32645,
-32477,
-32310,
-32177,
-32056,
-31939,
-31805,
-31654,
-31448,
-31280,
-31036,
-30869,
-30676,
-30502,
-30355,
-30244,
-30125,
-30062,
-29915,
-29798,
-29627,
-29440,
-29277,
-29099,
-28959,
-28819,
-28716,
-28681,
-28673,
-28709,
-28737,
-28756,
-28727,
-28672,
-28580,
-28442,
-28270,
-28073,
-27876,
-27754,
-27665,
-27645,
-27620,
-27579,
-27514,
-27429,
-27357,
-27296,
-27275,
-27319,
-27399,
-27592,
-27784,
-28034,
-28202,
-28300,
-28293,
-28161,
-27972,
-27648,
-27300,
-26898,
-26546,
-26312,
-26207,
-26307,
-26512,
-26843,
-27221,
-27603,
-28017,
-28333,
-28612,
-28701,
-28692,
-28531,
-28262,
-27930,
-27527,
-27090,
-26654,
-26239,
-25919,
-25751,
-25729,
-25882,
-26153,
-26513,
-26876,
-27242,
-27522,
-27696,
-27710,
-27527,
-27188,
-26674,
-26147,
-25583,
-25108,
-24738,
-24497,
-24467,
-24650,
-25121,
-25836,
-26791,
-27932,
-29053,
-30106,
-30728,
-30833,
-30241,
-29015,
-27335,
-25493,
-23804,
-22518,
-21857,
-21903,
-22718,
-24146,
-26046,
-27993,
-29732,
-30898,
-31391,
-31231,
-30556,
-29633,
-28666,
-27878,
-27371,
-27205,
-27289,
-27509,
-27686,
-27739,
-27597,
-27401,
-27293,
-27518,
-28188,
-29382,
-30949,
-32629,
-34114,
-35050,
-35219,
-34561,
-33236,
-31566,
-30023,
-28992,
-28763,
-29379,
-30667,
-32329,
-34018,
-35433,
-36342,
-36657,
-36341,
-35586,
-34638,
-33902,
-33657,
-34091,
-35122,
-36529,
-37978,
-39170,
-39925,
-40089,
-39711,
-38926,
-37960,
-37221,
-36903,
-37205,
-37963,
-39008,
-39980,
-40722,
-41070,
-41049,
-40699,
-40178,
-39683,
-39447,
-39625,
-40232,
-41095,
-41977,
-42637,
-42984,
-43001,
-42757,
-42358,
-41790,
-41206,
-40622,
-40217,
-39999,
-40019,
-40180,
-40376,
-40551,
-40653,
-40745,
-40801,
-40932,
-41023,
-41186,
-41258,
-41287,
-41114,
-40771,
-40139,
-39344,
-38443,
-37635,
-37032,
-36756,
-36766,
-37039,
-37364,
-37663,
-37810,
-37714,
-37481,
-37005,
-36549,
-36044,
-35750,
-35589,
-35618,
-35714,
-35736,
-35660,
-35368,
-34947,
-34383,
-33750,
-33083,
-32526,
-32122,
-32031,
-32149,
-32468,
-32774,
-32952,
-32898,
-32599,
-32102,
-31470,
-30753,
-30162,
-29670,
-29549,
-29669,
-30068,
-30524,
-30923,
-31139,
-31177,
-30977,
-30601,
-30040,
-29394,
-28716,
-28197,
-27882,
-27835,
-28049,
-28399,
-28857,
-29326,
-29726,
-30011,
-30118,
-30001,
-29786,
-29432,
-29135,
-28888,
-28717,
-28653,
-28609,
-28666,
-28733,
-28868,
-28999,
-29120,
-29234,
-29293,
-29424,
-29560,
-29818,
-30104,
-30450,
-30757,
-31055,
-31261,
-31405,
-31432,
-31369,
-31189,
-30953,
-30752,
-30633,
-30694,
-30921,
-31268,
-31765,
-32247,
-32827,
-33272,
-33672,
-33879,
-33913,
-33832,
-33661,
-33525,
-33429,
-33461,
-33569,
-33832,
-34162,
-34621,
-35094,
-35555,
-35926,
-36172,
-36306,
-36334,
-36314,
-36252,
-36212,
-36162,
-36170,
-36205,
-36288,
-36418,
-36576,
-36763,
-36968,
-37199,
-37474,
-37769,
-38102,
-38430,
-38718,
-38914,
-39004,
-38956,
-38778,
-38521,
-38164,
-37821,
-37491,
-37254,
-37122,
-37134,
-37262,
-37521,
-37834,
-38208,
-38558,
-38859,
-39057,
-39124,
-39035,
-38832,
-38481,
-38080,
-37591,
-37115,
-36638,
-36252,
-35964,
-35784,
-35747,
-35780,
-35921,
-36084,
-36248,
-36373,
-36405,
-36346,
-36195,
-35951,
-35658,
-35327,
-34971,
-34602,
-34242,
-33896,
-33578,
-33321,
-33103,
-32970,
-32881,
-32849,
-32854,
-32857,
-32828,
-32772,
-32619,
-32427,
-32132,
-31789,
-31410,
-31030,
-30693,
-30460,
-30289,
-30261,
-30239,
-30306,
-30316,
-30334,
-30265,
-30139,
-29936,
-29693,
-29410,
-29168,
-28918,
-28740,
-28537,
-28380,
-28181,
-28007,
-27853,
-27750,
-27712,
-27755,
-27875,
-28048,
-28275,
-28471,
-28630,
-28689,
-28635,
-28455,
-28144,
-27794,
-27387,
-27059,
-26813,
-26696,
-26747,
-26913,
-27177,
-27490,
-27801,
-28076,
-28274,
-28396,
-28434,
-28435,
-28412,
-28416,
-28430,
-28497,
-28526,
-28571,
-28557,
-28519,
-28474,
-28404,
-28388,
-28397,
-28511,
-28681,
-28974,
-29278,
-29634,
-29954,
-30180,
-30334,
-30327,
-30265,
-30072,
-29875,
-29633,
-29440,
-29315,
-29313,
-29433,
-29697,
-30020,
-30409,
-30791,
-31147,
-31455,
-31680,
-31860,
-31902,
-31917,
-31801,
-31700,
-31509,
-31362,
-31120,
-30941,
-30740,
-30672,
-30666,
-30827,
-31034,
-31348,
-31630,
-31937,
-32182,
-32385,
-32525,
-32572,
-32549,
-32412,
-32223,
-31931,
-31618,
-31302,
-30998,
-30796,
-30611,
-30555,
-30501,
-30546,
-30604,
-30771,
-30928,
-31113,
-31238,
-31242,
-31133,
-30889,
-30556,
-30189,
-29850,
-29593,
-29475,
-29524,
-29774,
-30205,
-30818,
-31490,
-32205,
-32764,
-33135,
-33166,
-32849,
-32192,
-31275,
-30219,
-29144,
-28230,
-27593,
-27315,
-27478,
-28036,
-28964,
-30116,
-31322,
-32403,
-33200,
-33612,
-33632,
-33330,
-32782,
-32170,
-31513,
-30980,
-30524,
-30214,
-30020,
-29968,
-30045,
-30228,
-30537,
-30959,
-31489,
-32201,
-33032,
-33982,
-34919,
-35700,
-36159,
-36211,
-35841,
-35155,
-34309,
-33503,
-32906,
-32651,
-32806,
-33345,
-34182,
-35145,
-36043,
-36758,
-37138,
-37241,
-37071,
-36781,
-36471,
-36365,
-36459,
-36933,
-37554,
-38308,
-38894,
-39257,
-39272,
-39042,
-38594,
-38131,
-37716,
-37497,
-37499,
-37790,
-38268,
-38884,
-39443,
-39841,
-39998,
-39886,
-39610,
-39230,
-38926,
-38700,
-38689,
-38809,
-39089,
-39371,
-39621,
-39739,
-39684,
-39460,
-39078,
-38604,
-38108,
-37643,
-37259,
-36994,
-36810,
-36737,
-36689,
-36674,
-36635,
-36561,
-36486,
-36424,
-36381,
-36379,
-36314,
-36203,
-35953,
-35592,
-35140,
-34625,
-34096,
-33597,
-33123,
-32731,
-32425,
-32222,
-32048,
-31943,
-31798,
-31675,
-31528,
-31392,
-31302,
-31223,
-31230,
-31241,
-31283,
-31325,
-31270,
-31130,
-30848,
-30436,
-29998,
-29523,
-29141,
-28833,
-28648,
-28608,
-28667,
-28839,
-29019,
-29194,
-29282,
-29276,
-29184,
-29032,
-28874,
-28765,
-28770,
-28885,
-29124,
-29425,
-29737,
-29977,
-30099,
-30078,
-29924,
-29691,
-29417,
-29192,
-29027,
-29030,
-29161,
-29467,
-29857,
-30310,
-30735,
-31092,
-31347,
-31508,
-31556,
-31591,
-31577,
-31588,
-31630,
-31691,
-31806,
-31940,
-32069,
-32230,
-32319,
-32437,
-32467,
-32516,
-32518,
-32566,
-32648,
-32764,
-32943,
-33130,
-33363,
-33610,
-33853,
-34103,
-34295,
-34461,
-34538,
-34572,
-34537,
-34481,
-34384,
-34271,
-34186,
-34118,
-34161,
-34253,
-34429,
-34608,
-34787,
-34894,
-34954,
-34961,
-34922,
-34866,
-34822,
-34791,
-34851,
-34968,
-35162,
-35388,
-35630,
-35787,
-35906,
-35879,
-35777,
-35575,
-35276,
-35000,
-34699,
-34516,
-34397,
-34412,
-34490,
-34630,
-34763,
-34876,
-34930,
-34956,
-34916,
-34878,
-34775,
-34720,
-34635,
-34615,
-34596,
-34545,
-34507,
-34367,
-34243,
-34067,
-33942,
-33791,
-33694,
-33576,
-33525,
-33499,
-33536,
-33593,
-33619,
-33632,
-33573,
-33508,
-33401,
-33299,
-33163,
-33018,
-32873,
-32747,
-32640,
-32586,
-32506,
-32442,
-32339,
-32255,
-32155,
-32079,
-32004,
-31928,
-31875,
-31850,
-31821,
-31854,
-31801,
-31782,
-31708,
-31636,
-31600,
-31586,
-31597,
-31639,
-31651,
-31674,
-31669,
-31657,
-31641,
-31598,
-31562,
-31501,
-31450,
-31382,
-31315,
-31255,
-31208,
-31193,
-31200,
-31239,
-31308,
-31385,
-31512,
-31629,
-31796,
-31928,
-32110,
-32209,
-32384,
-32465,
-32594,
-32627,
-32629,
-32551,
-32444,
-32328,
-32221,
-32178,
-32128,
-32167,
-32231,
-32384,
-32599,
-32873,
-33197,
-33503,
-33806,
-34064,
-34261,
-34376,
-34395,
-34334,
-34229,
-34147,
-34077,
-34099,
-34148,
-34265,
-34400,
-34601,
-34791,
-35024,
-35198,
-35360,
-35501,
-35614,
-35742,
-35842,
-35917,
-35914,
-35910,
-35841,
-35798,
-35683,
-35595,
-35432,
-35368,
-35320,
-35406,
-35538,
-35719,
-35887,
-36016,
-36136,
-36161,
-36144,
-35958,
-35684,
-35356,
-35031,
-34781,
-34609,
-34494,
-34439,
-34437,
-34511,
-34634,
-34746,
-34783,
-34713,
-34550,
-34318,
-34084,
-33829,
-33552,
-33288,
-33008,
-32799,
-32636,
-32485,
-32323,
-32098,
-31904,
-31714,
-31602,
-31517,
-31383,
-31236,
-31035,
-30896,
-30774,
-30692,
-30556,
-30356,
-30137,
-29922,
-29816,
-29701,
-29674,
-29556,
-29500,
-29464,
-29448,
-29438,
-29253,
-28987,
-28575,
-28210,
-27863,
-27594,
-27308,
-27028,
-26793,
-26694,
-26769,
-26936,
-27161,
-27303,
-27411,
-27487,
-27555,
-27562,
-27449,
-27160,
-26789,
-26373,
-26035,
-25716,
-25424,
-25130,
-24868,
-24761,
-24768,
-24923,
-25082,
-25275,
-25462,
-25722,
-26021,
-26236,
-26327,
-26157,
-25913,
-25653,
-25504,
-25453,
-25423,
-25441,
-25524,
-25807,
-26285,
-26855,
-27358,
-27686,
-27768,
-27715,
-27550,
-27287,
-26952,
-26536,
-26232,
-26112,
-26331,
-26726,
-27251,
-27754,
-28191,
-28680,
-29100,
-29526,
-29799,
-29950,
-30057,
-30238,
-30523,
-30884,
-31164,
-31294,
-31258,
-31138,
-31008,
-30901,
-30791,
-30779,
-30941,
-31408,
-32246,
-33272,
-34390,
-35272,
-35893,
-36167,
-36176,
-35960,
-35589,
-35189,
-34880,
-34830,
-35101,
-35606,
-36222,
-36806,
-37244,
-37550,
-37747,
-37830,
-37869,
-37883,
-37966,
-38208,
-38605,
-39145,
-39709,
-40148,
-40453,
-40501,
-40418,
-40148,
-39809,
-39426,
-39094,
-38936,
-38962,
-39220,
-39618,
-40061,
-40464,
-40751,
-40901,
-40926,
-40837,
-40676,
-40439,
-40213,
-39920,
-39691,
-39485,
-39299,
-39188,
-39064,
-38995,
-38923,
-38906,
-38869,
-38832,
-38735,
-38578,
-38385,
-38181,
-37974,
-37772,
-37547,
-37311,
-37059,
-36833,
-36631,
-36425,
-36199,
-35937,
-35613,
-35295,
-34971,
-34657,
-34369,
-34107,
-33882,
-33762,
-33662,
-33654,
-33540,
-33429,
-33179,
-32902,
-32598,
-32285,
-32018,
-31772,
-31618,
-31523,
-31520,
-31536,
-31538,
-31483,
-31307,
-31090,
-30807,
-30512,
-30222,
-29931,
-29707,
-29544,
-29474,
-29512,
-29571,
-29678,
-29723,
-29723,
-29644,
-29508,
-29326,
-29186,
-29004,
-28955,
-28908,
-28982,
-29096,
-29262,
-29421,
-29554,
-29614,
-29637,
-29596,
-29552,
-29496,
-29446,
-29435,
-29444,
-29526,
-29646,
-29831,
-29998,
-30205,
-30378,
-30560,
-30702,
-30825,
-30907,
-30985,
-31054,
-31139,
-31254,
-31390,
-31519,
-31647,
-31748,
-31838,
-31934,
-31998,
-32093,
-32152,
-32261,
-32408,
-32587,
-32847,
-33099,
-33363,
-33614,
-33838,
-34047,
-34209,
-34282,
-34284,
-34215,
-34086,
-33998,
-33884,
-33870,
-33905,
-33995,
-34182,
-34355,
-34604,
-34795,
-34996,
-35127,
-35261,
-35335,
-35434,
-35486,
-35514,
-35525,
-35489,
-35439,
-35396,
-35311,
-35278,
-35217,
-35207,
-35176,
-35202,
-35243,
-35291,
-35387,
-35443,
-35527,
-35546,
-35578,
-35548,
-35537,
-35499,
-35466,
-35419,
-35342,
-35276,
-35167,
-35082,
-34972,
-34893,
-34809,
-34768,
-34729,
-34752,
-34793,
-34856,
-34901,
-34925,
-34882,
-34817,
-34713,
-34584,
-34485,
-34360,
-34312,
-34278,
-34311,
-34373,
-34429,
-34505,
-34497,
-34535,
-34465,
-34441,
-34342,
-34236,
-34136,
-33977,
-33890,
-33750,
-33663,
-33599,
-33548,
-33595,
-33644,
-33754,
-33847,
-33948,
-34013,
-34093,
-34147,
-34175,
-34138,
-34063,
-33912,
-33762,
-33625,
-33475,
-33371,
-33261,
-33173,
-33132,
-33130,
-33174,
-33238,
-33339,
-33423,
-33550,
-33699,
-33797,
-33917,
-33919,
-33911,
-33834,
-33741,
-33613,
-33497,
-33333,
-33217,
-33088,
-33062,
-33046,
-33154,
-33227,
-33362,
-33461,
-33547,
-33624,
-33673,
-33698,
-33683,
-33626,
-33528,
-33420,
-33322,
-33228,
-33178,
-33121,
-33099,
-33078,
-33094,
-33103,
-33151,
-33134,
-33158,
-33111,
-33090,
-33040,
-32969,
-32853,
-32730,
-32567,
-32462,
-32373,
-32357,
-32367,
-32390,
-32420,
-32395,
-32408,
-32379,
-32331,
-32253,
-32138,
-31956,
-31796,
-31625,
-31505,
-31422,
-31344,
-31246,
-31143,
-31009,
-30887,
-30774,
-30685,
-30564,
-30498,
-30413,
-30425,
-30456,
-30524,
-30545,
-30521,
-30401,
-30245,
-30016,
-29774,
-29491,
-29214,
-29006,
-28865,
-28870,
-28904,
-29001,
-29077,
-29136,
-29200,
-29224,
-29235,
-29190,
-29066,
-28900,
-28727,
-28554,
-28424,
-28273,
-28133,
-27987,
-27877,
-27823,
-27803,
-27818,
-27871,
-27932,
-28091,
-28235,
-28426,
-28548,
-28580,
-28543,
-28427,
-28299,
-28136,
-27971,
-27797,
-27622,
-27499,
-27404,
-27398,
-27358,
-27425,
-27431,
-27571,
-27729,
-27966,
-28207,
-28424,
-28583,
-28675,
-28696,
-28643,
-28541,
-28341,
-28104,
-27850,
-27592,
-27448,
-27378,
-27459,
-27670,
-27964,
-28325,
-28660,
-28921,
-29065,
-29086,
-29007,
-28876,
-28740,
-28645,
-28606,
-28628,
-28711,
-28933,
-29260,
-29820,
-30471,
-31209,
-31874,
-32385,
-32665,
-32693,
-32520,
-32133,
-31684,
-31206,
-30833,
-30640,
-30640,
-30807,
-31089,
-31424,
-31797,
-32235,
-32695,
-33236,
-33735,
-34300,
-34865,
-35491,
-36122,
-36638,
-36986,
-37040,
-36874,
-36513,
-36023,
-35516,
-35007,
-34688,
-34657,
-35069,
-35862,
-36909,
-37972,
-38832,
-39378,
-39644,
-39620,
-39465,
-39183,
-38953,
-38831,
-38954,
-39229,
-39590,
-39835,
-39869,
-39718,
-39474,
-39275,
-39162,
-39132,
-39200,
-39364,
-39686,
-40117,
-40560,
-40907,
-41005,
-40920,
-40595,
-40214,
-39737,
-39268,
-38797,
-38450,
-38230,
-38231,
-38346,
-38513,
-38627,
-38692,
-38691,
-38708,
-38685,
-38651,
-38504,
-38258,
-37882,
-37401,
-36818,
-36161,
-35474,
-34818,
-34291,
-33919,
-33755,
-33700,
-33709,
-33684,
-33609,
-33461,
-33305,
-33107,
-32969,
-32797,
-32633,
-32409,
-32109,
-31773,
-31288,
-30776,
-30117,
-29489,
-28847,
-28340,
-27962,
-27714,
-27601,
-27551,
-27602,
-27674,
-27782,
-27833,
-27801,
-27621,
-27377,
-27060,
-26807,
-26556,
-26380,
-26228,
-26133,
-26118,
-26133,
-26193,
-26220,
-26234,
-26194,
-26198,
-26191,
-26268,
-26347,
-26471,
-26590,
-26722,
-26904,
-27055,
-27239,
-27322,
-27383,
-27373,
-27338,
-27324,
-27369,
-27506,
-27773,
-28200,
-28715,
-29302,
-29866,
-30333,
-30719,
-30940,
-31080,
-31120,
-31113,
-31106,
-31124,
-31214,
-31404,
-31679,
-32024,
-32403,
-32783,
-33185,
-33566,
-33997,
-34388,
-34850,
-35203,
-35566,
-35816,
-36045,
-36230,
-36387,
-36521,
-36636,
-36708,
-36806,
-36924,
-37100,
-37346,
-37604,
-37891,
-38152,
-38391,
-38629,
-38804,
-38985,
-39102,
-39224,
-39289,
-39368,
-39365,
-39368,
-39308,
-39272,
-39229,
-39262,
-39303,
-39390,
-39480,
-39549,
-39588,
-39605,
-39546,
-39470,
-39301,
-39120,
-38903,
-38721,
-38562,
-38484,
-38425,
-38437,
-38415,
-38468,
-38442,
-38477,
-38418,
-38357,
-38213,
-38022,
-37806,
-37551,
-37321,
-37070,
-36814,
-36546,
-36248,
-35982,
-35728,
-35548,
-35369,
-35246,
-35113,
-34992,
-34879,
-34779,
-34700,
-34622,
-34531,
-34416,
-34234,
-34063,
-33835,
-33662,
-33481,
-33371,
-33233,
-33162,
-33065,
-32974,
-32900,
-32819,
-32748,
-32667,
-32575,
-32475,
-32366,
-32282,
-32191,
-32145,
-32085,
-32036,
-31977,
-31900,
-31820,
-31751,
-31697,
-31658,
-31648,
-31623,
-31643,
-31632,
-31682,
-31719,
-31787,
-31818,
-31865,
-31830,
-31841,
-31788,
-31771,
-31762,
-31716,
-31706,
-31669,
-31644,
-31646,
-31686,
-31723,
-31823,
-31871,
-31942,
-31980,
-31998,
-32012,
-32002,
-32004,
-31999,
-32011,
-32028,
-32079,
-32134,
-32219,
-32273,
-32314,
-32331,
-32317,
-32298,
-32300,
-32319,
-32368,
-32473,
-32558,
-32686,
-32803,
-32915,
-33024,
-33091,
-33136,
-33138,
-33138,
-33098,
-33077,
-33063,
-33056,
-33105,
-33142,
-33234,
-33283,
-33347,
-33336,
-33298,
-33240,
-33127,
-33088,
-32978,
-32972,
-32950,
-33008,
-33092,
-33201,
-33322,
-33416,
-33490,
-33521,
-33535,
-33507,
-33443,
-33358,
-33246,
-33132,
-33022,
-32892,
-32770,
-32594,
-32413,
-32199,
-31993,
-31834,
-31736,
-31700,
-31731,
-31807,
-31919,
-32014,
-32134,
-32150,
-32136,
-32024,
-31813,
-31616,
-31339,
-31154,
-30915,
-30736,
-30517,
-30345,
-30170,
-30060,
-29950,
-29887,
-29789,
-29752,
-29689,
-29693,
-29695,
-29729,
-29721,
-29707,
-29619,
-29514,
-29348,
-29174,
-28988,
-28837,
-28698,
-28599,
-28493,
-28380,
-28252,
-28117,
-28016,
-27957,
-27912,
-27887,
-27867,
-27835,
-27846,
-27834,
-27834,
-27831,
-27775,
-27718,
-27661,
-27611,
-27592,
-27552,
-27536,
-27489,
-27471,
-27463,
-27451,
-27393,
-27321,
-27181,
-27082,
-26991,
-26963,
-27001,
-27031,
-27132,
-27156,
-27246,
-27260,
-27330,
-27358,
-27425,
-27461,
-27523,
-27572,
-27581,
-27560,
-27442,
-27330,
-27148,
-27066,
-26978,
-26981,
-26956,
-26911,
-26848,
-26823,
-26866,
-27025,
-27185,
-27378,
-27494,
-27670,
-27900,
-28325,
-28895,
-29557,
-30198,
-30723,
-31022,
-31132,
-30942,
-30586,
-30060,
-29561,
-29156,
-28938,
-28932,
-29089,
-29374,
-29774,
-30206,
-30632,
-30983,
-31188,
-31359,
-31533,
-31927,
-32471,
-33222,
-33880,
-34435,
-34725,
-34864,
-34818,
-34706,
-34465,
-34206,
-33943,
-33818,
-33988,
-34426,
-35181,
-35995,
-36730,
-37248,
-37425,
-37410,
-37219,
-37069,
-36994,
-37060,
-37258,
-37514,
-37817,
-38044,
-38262,
-38312,
-38380,
-38340,
-38392,
-38487,
-38694,
-38996,
-39338,
-39729,
-40064,
-40277,
-40381,
-40224,
-40002,
-39621,
-39297,
-38958,
-38687,
-38437,
-38229,
-38092,
-38103,
-38244,
-38469,
-38740,
-38969,
-39187,
-39350,
-39507,
-39552,
-39498,
-39232,
-38853,
-38365,
-37889,
-37468,
-37113,
-36819,
-36587,
-36392,
-36236,
-36062,
-35888,
-35663,
-35472,
-35319,
-35282,
-35322,
-35400,
-35458,
-35445,
-35347,
-35130,
-34847,
-34447,
-34058,
-33651,
-33342,
-33128,
-33018,
-32951,
-32910,
-32833,
-32739,
-32625,
-32484,
-32348,
-32178,
-32041,
-31890,
-31763,
-31638,
-31509,
-31375,
-31241,
-31152,
-31125,
-31176,
-31326,
-31520,
-31776,
-31994,
-32200,
-32316,
-32362,
-32319,
-32230,
-32113,
-32025,
-31957,
-31950,
-31952,
-31980,
-32011,
-32021,
-32013,
-32012,
-32005,
-32075,
-32180,
-32377,
-32634,
-32911,
-33198,
-33459,
-33712,
-33927,
-34117,
-34251,
-34365,
-34447,
-34508,
-34563,
-34602,
-34607,
-34623,
-34626,
-34660,
-34732,
-34837,
-34960,
-35082,
-35183,
-35263,
-35307,
-35334,
-35343,
-35363,
-35411,
-35486,
-35625,
-35811,
-36015,
-36241,
-36379,
-36470,
-36435,
-36336,
-36162,
-36007,
-35841,
-35728,
-35680,
-35660,
-35708,
-35747,
-35789,
-35779,
-35727,
-35603,
-35463,
-35291,
-35127,
-34978,
-34816,
-34687,
-34569,
-34456,
-34405,
-34339,
-34305,
-34267,
-34211,
-34187,
-34116,
-34088,
-34046,
-34005,
-33935,
-33836,
-33683,
-33508,
-33293,
-33048,
-32807,
-32533,
-32287,
-32024,
-31819,
-31618,
-31487,
-31400,
-31351,
-31354,
-31374,
-31393,
-31435,
-31409,
-31395,
-31314,
-31214,
-31110,
-30952,
-30833,
-30640,
-30491,
-30305,
-30155,
-30036,
-29933,
-29855,
-29789,
-29737,
-29710,
-29723,
-29753,
-29822,
-29862,
-29905,
-29913,
-29921,
-29957,
-29997,
-30086,
-30167,
-30283,
-30378,
-30478,
-30557,
-30593,
-30595,
-30514,
-30438,
-30300,
-30222,
-30144,
-30147,
-30206,
-30316,
-30498,
-30677,
-30861,
-31036,
-31191,
-31329,
-31472,
-31592,
-31714,
-31849,
-31987,
-32169,
-32327,
-32490,
-32603,
-32649,
-32654,
-32624,
-32585,
-32534,
-32516,
-32463,
-32490,
-32521,
-32609,
-32771,
-32948,
-33152,
-33349,
-33532,
-33684,
-33806,
-33864,
-33923,
-33954,
-34026,
-34102,
-34195,
-34258,
-34319,
-34354,
-34425,
-34476,
-34578,
-34627,
-34700,
-34706,
-34723,
-34742,
-34757,
-34812,
-34832,
-34883,
-34928,
-34998,
-35067,
-35117,
-35140,
-35122,
-35042,
-34946,
-34830,
-34723,
-34660,
-34608,
-34633,
-34634,
-34646,
-34634,
-34572,
-34535,
-34500,
-34484,
-34484,
-34434,
-34365,
-34259,
-34154,
-34056,
-33981,
-33892,
-33788,
-33627,
-33416,
-33175,
-32915,
-32705,
-32471,
-32347,
-32218,
-32191,
-32177,
-32195,
-32215,
-32199,
-32158,
-32047,
-31887,
-31694,
-31462,
-31213,
-30967,
-30734,
-30536,
-30343,
-30165,
-29987,
-29780,
-29606,
-29405,
-29271,
-29149,
-29080,
-29030,
-29020,
-29043,
-29080,
-29142,
-29148,
-29138,
-29021,
-28891,
-28691,
-28505,
-28311,
-28104,
-27950,
-27761,
-27672,
-27581,
-27537,
-27516,
-27483,
-27493,
-27520,
-27590,
-27671,
-27759,
-27794,
-27848,
-27842,
-27869,
-27888,
-27877,
-27892,
-27864,
-27882,
-27894,
-27936,
-27956,
-27947,
-27933,
-27894,
-27874,
-27875,
-27902,
-27958,
-28046,
-28158,
-28272,
-28371,
-28398,
-28421,
-28422,
-28455,
-28518,
-28567,
-28603,
-28574,
-28530,
-28459,
-28410,
-28333,
-28290,
-28233,
-28306,
-28443,
-28712,
-28912,
-29078,
-29039,
-28973,
-28893,
-28911,
-29015,
-29125,
-29226,
-29278,
-29366,
-29456,
-29608,
-29737,
-29840,
-29956,
-30070,
-30221,
-30368,
-30431,
-30464,
-30490,
-30536,
-30676,
-30798,
-30875,
-30897,
-30932,
-31048,
-31330,
-31611,
-31915,
-32078,
-32246,
-32469,
-32784,
-33139,
-33445,
-33580,
-33666,
-33747,
-33913,
-34191,
-34420,
-34613,
-34689,
-34783,
-34917,
-35120,
-35366,
-35583,
-35825,
-36073,
-36347,
-36643,
-36821,
-36989,
-37060,
-37224,
-37424,
-37684,
-37893,
-38061,
-38170,
-38365,
-38602,
-38888,
-39149,
-39311,
-39409,
-39499,
-39580,
-39716,
-39777,
-39797,
-39761,
-39707,
-39731,
-39792,
-39868,
-39932,
-39921,
-39948,
-39921,
-39974,
-39977,
-39984,
-39961,
-39954,
-39965,
-40012,
-40035,
-40009,
-39941,
-39779,
-39610,
-39396,
-39136,
-38892,
-38599,
-38386,
-38184,
-38071,
-37961,
-37891,
-37845,
-37758,
-37731,
-37604,
-37502,
-37283,
-37085,
-36821,
-36628,
-36403,
-36219,
-35974,
-35730,
-35409,
-35118,
-34789,
-34502,
-34222,
-33984,
-33757,
-33543,
-33359,
-33159,
-32984,
-32778,
-32577,
-32388,
-32158,
-31993,
-31768,
-31609,
-31435,
-31270,
-31123,
-30943,
-30784,
-30586,
-30459,
-30295,
-30230,
-30129,
-30111,
-30046,
-30018,
-29945,
-29860,
-29737,
-29600,
-29460,
-29341,
-29261,
-29171,
-29126,
-29064,
-29057,
-29075,
-29133,
-29207,
-29260,
-29296,
-29318,
-29348,
-29408,
-29486,
-29558,
-29611,
-29617,
-29636,
-29620,
-29624,
-29655,
-29662,
-29714,
-29762,
-29851,
-29964,
-30115,
-30261,
-30443,
-30610,
-30787,
-30944,
-31087,
-31178,
-31266,
-31316,
-31363,
-31406,
-31484,
-31548,
-31684,
-31815,
-32009,
-32198,
-32389,
-32557,
-32692,
-32807,
-32885,
-32949,
-33005,
-33060,
-33168,
-33282,
-33460,
-33630,
-33789,
-33925,
-34003,
-34106,
-34165,
-34272,
-34350,
-34470,
-34580,
-34721,
-34856,
-34966,
-35095,
-35117,
-35190,
-35163,
-35171,
-35160,
-35174,
-35215,
-35312,
-35402,
-35564,
-35675,
-35813,
-35886,
-35956,
-36021,
-36061,
-36105,
-36124,
-36092,
-36109,
-36046,
-36054,
-35994,
-35945,
-35902,
-35880,
-35936,
-36014,
-36088,
-36109,
-36065,
-36025,
-36048,
-36242,
-36494,
-36820,
-37022,
-37099,
-36995,
-36777,
-36467,
-36193,
-35981,
-35889,
-35934,
-36026,
-36100,
-36086,
-35982,
-35856,
-35796,
-35818,
-35898,
-35985,
-35970,
-35938,
-35851,
-35796,
-35769,
-35695,
-35616,
-35469,
-35339,
-35229,
-35095,
-34992,
-34831,
-34745,
-34719,
-34842,
-35026,
-35155,
-35193,
-35031,
-34749,
-34415,
-34045,
-33797,
-33586,
-33534,
-33521,
-33568,
-33570,
-33455,
-33280,
-33059,
-32899,
-32838,
-32870,
-32891,
-32894,
-32794,
-32644,
-32455,
-32270,
-32111,
-31944,
-31828,
-31719,
-31663,
-31605,
-31538,
-31437,
-31356,
-31284,
-31267,
-31303,
-31321,
-31346,
-31300,
-31214,
-31102,
-30960,
-30813,
-30664,
-30548,
-30436,
-30406,
-30320,
-30268,
-30170,
-30060,
-29977,
-29918,
-29897,
-29927,
-29957,
-29989,
-29986,
-29979,
-29920,
-29843,
-29706,
-29578,
-29434,
-29342,
-29264,
-29190,
-29150,
-29094,
-29099,
-29091,
-29100,
-29084,
-29033,
-28976,
-28909,
-28854,
-28812,
-28758,
-28742,
-28691,
-28728,
-28714,
-28780,
-28743,
-28746,
-28663,
-28637,
-28614,
-28660,
-28713,
-28798,
-28835,
-28858,
-28870,
-28851,
-28837,
-28807,
-28747,
-28676,
-28595,
-28497,
-28431,
-28388,
-28381,
-28412,
-28468,
-28498,
-28521,
-28477,
-28396,
-28292,
-28158,
-28072,
-27986,
-27959,
-27937,
-27939,
-27938,
-27961,
-27965,
-27978,
-27947,
-27873,
-27772,
-27630,
-27497,
-27381,
-27272,
-27169,
-27055,
-26939,
-26817,
-26714,
-26616,
-26534,
-26519,
-26542,
-26685,
-26902,
-27184,
-27518,
-27858,
-28307,
-28786,
-29377,
-29891,
-30315,
-30539,
-30595,
-30536,
-30406,
-30251,
-30090,
-29909,
-29775,
-29708,
-29725,
-29776,
-29855,
-29858,
-29892,
-29922,
-30013,
-30173,
-30325,
-30528,
-30731,
-31030,
-31379,
-31800,
-32205,
-32566,
-32877,
-33154,
-33473,
-33790,
-34176,
-34558,
-35017,
-35482,
-35980,
-36449,
-36784,
-37003,
-37011,
-36924,
-36718,
-36511,
-36272,
-36095,
-35977,
-35963,
-36038,
-36217,
-36408,
-36670,
-36921,
-37240,
-37612,
-38019,
-38448,
-38872,
-39246,
-39661,
-40010,
-40394,
-40684,
-40933,
-41084,
-41151,
-41143,
-41054,
-40913,
-40713,
-40483,
-40282,
-40091,
-39990,
-39911,
-39892,
-39899,
-39874,
-39856,
-39791,
-39704,
-39648,
-39586,
-39606,
-39640,
-39709,
-39759,
-39774,
-39723,
-39629,
-39486,
-39309,
-39119,
-38924,
-38713,
-38543,
-38329,
-38158,
-37925,
-37697,
-37353,
-37000,
-36548,
-36093,
-35638,
-35193,
-34809,
-34468,
-34146,
-33886,
-33588,
-33334,
-33061,
-32808,
-32602,
-32433,
-32314,
-32251,
-32183,
-32118,
-32027,
-31876,
-31694,
-31457,
-31175,
-30849,
-30517,
-30182,
-29909,
-29673,
-29480,
-29326,
-29145,
-29002,
-28841,
-28737,
-28637,
-28566,
-28501,
-28418,
-28332,
-28227,
-28121,
-28077,
-28017,
-28079,
-28113,
-28248,
-28365,
-28508,
-28665,
-28797,
-28934,
-29025,
-29135,
-29217,
-29327,
-29431,
-29548,
-29654,
-29757,
-29830,
-29911,
-29979,
-30098,
-30236,
-30440,
-30668,
-30950,
-31244,
-31550,
-31867,
-32158,
-32444,
-32656,
-32874,
-32999,
-33162,
-33272,
-33450,
-33600,
-33824,
-34023,
-34263,
-34479,
-34700,
-34915,
-35133,
-35356,
-35571,
-35748,
-35923,
-36062,
-36197,
-36343,
-36453,
-36565,
-36618,
-36591,
-36573,
-36471,
-36422,
-36364,
-36327,
-36336,
-36362,
-36447,
-36554,
-36694,
-36809,
-36897,
-36943,
-36934,
-36898,
-36785,
-36679,
-36507,
-36372,
-36233,
-36137,
-36064,
-36007,
-35932,
-35853,
-35751,
-35619,
-35458,
-35278,
-35043,
-34826,
-34600,
-34417,
-34263,
-34127,
-34010,
-33876,
-33763,
-33615,
-33494,
-33322,
-33159,
-32984,
-32799,
-32647,
-32488,
-32360,
-32251,
-32139,
-32052,
-31943,
-31820,
-31671,
-31476,
-31279,
-31061,
-30869,
-30682,
-30526,
-30400,
-30303,
-30266,
-30272,
-30285,
-30314,
-30293,
-30260,
-30220,
-30191,
-30180,
-30193,
-30172,
-30184,
-30123,
-30123,
-30040,
-30026,
-29968,
-29946,
-29931,
-29936,
-29987,
-30069,
-30199,
-30346,
-30512,
-30680,
-30831,
-30978,
-31110,
-31248,
-31366,
-31495,
-31589,
-31678,
-31726,
-31785,
-31804,
-31883,
-31931,
-32048,
-32166,
-32344,
-32523,
-32719,
-32928,
-33098,
-33295,
-33420,
-33596,
-33703,
-33865,
-33992,
-34128,
-34236,
-34336,
-34369,
-34414,
-34384,
-34381,
-34385,
-34414,
-34476,
-34531,
-34614,
-34641,
-34727,
-34742,
-34834,
-34873,
-34960,
-35016,
-35076,
-35132,
-35178,
-35207,
-35227,
-35245,
-35236,
-35225,
-35217,
-35187,
-35201,
-35163,
-35165,
-35083,
-35044,
-34921,
-34859,
-34758,
-34731,
-34694,
-34688,
-34679,
-34614,
-34555,
-34424,
-34316,
-34194,
-34093,
-33992,
-33906,
-33804,
-33716,
-33627,
-33558,
-33493,
-33412,
-33327,
-33177,
-33022,
-32832,
-32677,
-32536,
-32413,
-32317,
-32181,
-32081,
-31939,
-31827,
-31716,
-31612,
-31539,
-31462,
-31404,
-31336,
-31246,
-31105,
-30941,
-30756,
-30598,
-30485,
-30416,
-30363,
-30330,
-30255,
-30181,
-30130,
-30135,
-30241,
-30437,
-30673,
-30903,
-31041,
-31048,
-30972,
-30794,
-30682,
-30587,
-30603,
-30587,
-30599,
-30508,
-30422,
-30351,
-30380,
-30484,
-30708,
-30893,
-31080,
-31148,
-31168,
-31137,
-31097,
-31117,
-31171,
-31242,
-31360,
-31355,
-31354,
-31298,
-31245,
-31325,
-31462,
-31718,
-31997,
-32252,
-32485,
-32634,
-32752,
-32772,
-32766,
-32703,
-32689,
-32698,
-32798,
-32890,
-32983,
-32982,
-32988,
-32949,
-33012,
-33124,
-33295,
-33483,
-33667,
-33792,
-33863,
-33881,
-33828,
-33749,
-33681,
-33680,
-33733,
-33856,
-33972,
-34043,
-34088,
-34080,
-34125,
-34161,
-34280,
-34379,
-34516,
-34599,
-34691,
-34678,
-34662,
-34563,
-34449,
-34314,
-34200,
-34086,
-33980,
-33892,
-33797,
-33732,
-33657,
-33597,
-33544,
-33467,
-33423,
-33381,
-33319,
-33271,
-33171,
-33075,
-32979,
-32929,
-32863,
-32836,
-32740,
-32579,
-32383,
-32118,
-31946,
-31733,
-31669,
-31583,
-31567,
-31566,
-31520,
-31481,
-31386,
-31234,
-31106,
-30944,
-30814,
-30671,
-30505,
-30319,
-30142,
-29992,
-29886,
-29852,
-29808,
-29764,
-29704,
-29593,
-29518,
-29418,
-29395,
-29342,
-29336,
-29309,
-29265,
-29252,
-29180,
-29171,
-29085,
-29051,
-28977,
-28942,
-28898,
-28899,
-28857,
-28851,
-28796,
-28774,
-28719,
-28698,
-28683,
-28668,
-28652,
-28625,
-28595,
-28602,
-28640,
-28723,
-28835,
-28920,
-28939,
-28926,
-28876,
-28859,
-28908,
-28947,
-29054,
-29089,
-29166,
-29160,
-29190,
-29167,
-29168,
-29145,
-29189,
-29263,
-29387,
-29518,
-29599,
-29659,
-29694,
-29768,
-29904,
-30028,
-30180,
-30211,
-30297,
-30287,
-30377,
-30419,
-30450,
-30442,
-30427,
-30441,
-30536,
-30656,
-30779,
-30845,
-30901,
-30976,
-31133,
-31356,
-31642,
-31914,
-32203,
-32488,
-32750,
-33034,
-33228,
-33399,
-33513,
-33623,
-33727,
-33829,
-33875,
-33865,
-33856,
-33810,
-33881,
-33908,
-34004,
-34021,
-34051,
-34062,
-34127,
-34206,
-34333,
-34433,
-34553,
-34637,
-34752,
-34822,
-34920,
-34971,
-35063,
-35172,
-35343,
-35587,
-35841,
-36102,
-36333,
-36493,
-36647,
-36713,
-36824,
-36862,
-36941,
-36973,
-37010,
-37028,
-37017,
-37028,
-37012,
-37010,
-37001,
-36990,
-36950,
-36960,
-36901,
-36952,
-36950,
-37066,
-37153,
-37308,
-37434,
-37558,
-37659,
-37712,
-37752,
-37756,
-37745,
-37734,
-37706,
-37667,
-37643,
-37581,
-37561,
-37503,
-37502,
-37442,
-37427,
-37339,
-37270,
-37149,
-37023,
-36898,
-36756,
-36637,
-36488,
-36352,
-36192,
-36056,
-35909,
-35800,
-35673,
-35551,
-35422,
-35317,
-35243,
-35226,
-35232,
-35264,
-35274,
-35279,
-35233,
-35196,
-35109,
-35021,
-34885,
-34761,
-34591,
-34454,
-34268,
-34095,
-33887,
-33730,
-33560,
-33463,
-33346,
-33230,
-33121,
-32992,
-32925,
-32892,
-32902,
-32933,
-32922,
-32926,
-32875,
-32863,
-32821,
-32798,
-32782,
-32768,
-32800,
-32847,
-32914,
-32981,
-33017,
-33061,
-33079,
-33091,
-33123,
-33079,
-33042,
-32963,
-32849,
-32784,
-32666,
-32602,
-32528,
-32495,
-32466,
-32505,
-32540,
-32614,
-32681,
-32742,
-32850,
-32921,
-33043,
-33079,
-33098,
-33076,
-33011,
-32974,
-32902,
-32861,
-32791,
-32733,
-32678,
-32631,
-32605,
-32586,
-32586,
-32626,
-32665,
-32757,
-32840,
-32920,
-32977,
-32992,
-32961,
-32921,
-32831,
-32743,
-32632,
-32556,
-32495,
-32503,
-32534,
-32628,
-32701,
-32784,
-32829,
-32872,
-32883,
-32920,
-32926,
-32943,
-32953,
-32940,
-32940,
-32914,
-32908,
-32899,
-32936,
-32940,
-32965,
-32950,
-32903,
-32875,
-32819,
-32824,
-32833,
-32847,
-32855,
-32785,
-32743,
-32625,
-32574,
-32499,
-32473,
-32454,
-32436,
-32436,
-32445,
-32473,
-32511,
-32565,
-32602,
-32668,
-32681,
-32734,
-32723,
-32734,
-32681,
-32611,
-32526,
-32447,
-32390,
-32370,
-32337,
-32334,
-32309,
-32312,
-32282,
-32302,
-32292,
-32300,
-32307,
-32279,
-32293,
-32237,
-32215,
-32137,
-32070,
-31970,
-31929,
-31838,
-31860,
-31819,
-31897,
-31910,
-31985,
-31997,
-32009,
-31986,
-31957,
-31978,
-31989,
-32077,
-32101,
-32126,
-32096,
-32018,
-31945,
-31836,
-31748,
-31653,
-31531,
-31412,
-31286,
-31168,
-31152,
-31161,
-31262,
-31395,
-31474,
-31539,
-31459,
-31379,
-31235,
-31181,
-31146,
-31194,
-31237,
-31279,
-31273,
-31223,
-31155,
-31100,
-31027,
-31005,
-30938,
-30907,
-30824,
-30731,
-30611,
-30489,
-30395,
-30377,
-30381,
-30442,
-30491,
-30487,
-30447,
-30375,
-30292,
-30244,
-30206,
-30206,
-30211,
-30209,
-30197,
-30145,
-30093,
-29987,
-29888,
-29780,
-29707,
-29676,
-29730,
-29787,
-29902,
-29964,
-30029,
-30038,
-30049,
-30055,
-30069,
-30070,
-30060,
-29997,
-29935,
-29833,
-29746,
-29672,
-29628,
-29646,
-29718,
-29857,
-29987,
-30159,
-30261,
-30403,
-30523,
-30704,
-30880,
-31057,
-31135,
-31150,
-31055,
-30995,
-30965,
-31038,
-31197,
-31335,
-31451,
-31455,
-31431,
-31373,
-31386,
-31438,
-31568,
-31719,
-31893,
-32056,
-32207,
-32300,
-32342,
-32333,
-32320,
-32309,
-32378,
-32426,
-32546,
-32588,
-32685,
-32739,
-32870,
-32995,
-33151,
-33266,
-33317,
-33358,
-33338,
-33392,
-33472,
-33581,
-33751,
-33836,
-33906,
-33889,
-33823,
-33759,
-33758,
-33839,
-34020,
-34189,
-34338,
-34320,
-34233,
-34029,
-33938,
-33968,
-34180,
-34491,
-34727,
-34830,
-34799,
-34689,
-34690,
-34740,
-34879,
-34924,
-34882,
-34713,
-34573,
-34489,
-34483,
-34502,
-34487,
-34413,
-34363,
-34309,
-34311,
-34308,
-34300,
-34284,
-34298,
-34297,
-34289,
-34177,
-34026,
-33872,
-33806,
-33830,
-33886,
-33889,
-33816,
-33704,
-33671,
-33687,
-33781,
-33762,
-33734,
-33633,
-33625,
-33674,
-33650,
-33565,
-33340,
-33152,
-33118,
-33214,
-33323,
-33298,
-33094,
-32936,
-32950,
-33194,
-33420,
-33450,
-33169,
-32766,
-32590,
-32699,
-33089,
-33396,
-33405,
-33214,
-32902,
-32793,
-32807,
-32905,
-32928,
-32946,
-32992,
-33220,
-33438,
-33604,
-33517,
-33322,
-33109,
-33022,
-33009,
-32948,
-32868,
-32757,
-32840,
-33061,
-33330,
-33445,
-33277,
-32970,
-32664,
-32640,
-32782,
-33060,
-33182,
-33157,
-32993,
-32833,
-32734,
-32714,
-32718,
-32714,
-32747,
-32753,
-32786,
-32726,
-32610,
-32436,
-32300,
-32301,
-32451,
-32679,
-32847,
-32798,
-32499,
-32096,
-31702,
-31583,
-31638,
-31810,
-31915,
-31864,
-31695,
-31549,
-31453,
-31458,
-31506,
-31549,
-31711,
-31926,
-32220,
-32377,
-32275,
-31939,
-31553,
-31353,
-31461,
-31752,
-32030,
-32119,
-32006,
-31847,
-31696,
-31621,
-31473,
-31332,
-31197,
-31318,
-31646,
-32059,
-32360,
-32304,
-32032,
-31655,
-31473,
-31503,
-31724,
-31998,
-32239,
-32448,
-32636,
-32832,
-32949,
-33071,
-33129,
-33287,
-33505,
-33773,
-33994,
-34115,
-34138,
-34125,
-34153,
-34253,
-34352,
-34463,
-34528,
-34605,
-34717,
-34854,
-34996,
-35138,
-35227,
-35366,
-35487,
-35702,
-35903,
-36105,
-36285,
-36417,
-36533,
-36631,
-36734,
-36832,
-36945,
-37052,
-37143,
-37265,
-37326,
-37446,
-37511,
-37593,
-37649,
-37694,
-37720,
-37753,
-37740,
-37755,
-37734,
-37743,
-37717,
-37704,
-37634,
-37565,
-37474,
-37381,
-37289,
-37188,
-37067,
-36951,
-36837,
-36803,
-36800,
-36867,
-36873,
-36811,
-36633,
-36404,
-36170,
-36013,
-35909,
-35850,
-35770,
-35646,
-35493,
-35322,
-35174,
-35014,
-34862,
-34636,
-34398,
-34177,
-34005,
-33951,
-33915,
-33848,
-33665,
-33355,
-33010,
-32744,
-32563,
-32494,
-32405,
-32255,
-32005,
-31720,
-31487,
-31339,
-31321,
-31372,
-31406,
-31431,
-31349,
-31226,
-31056,
-30867,
-30753,
-30646,
-30574,
-30449,
-30243,
-30002,
-29842,
-29777,
-29802,
-29778,
-29596,
-29283,
-28931,
-28777,
-28870,
-29161,
-29461,
-29591,
-29484,
-29245,
-29005,
-28908,
-28933,
-29078,
-29185,
-29290,
-29272,
-29215,
-29106,
-29022,
-29030,
-29125,
-29322,
-29472,
-29569,
-29552,
-29482,
-29465,
-29475,
-29589,
-29635,
-29680,
-29687,
-29704,
-29791,
-29842,
-29880,
-29826,
-29792,
-29811,
-29945,
-30177,
-30385,
-30498,
-30464,
-30331,
-30231,
-30202,
-30325,
-30509,
-30752,
-30911,
-31030,
-31030,
-31015,
-30990,
-30999,
-31052,
-31152,
-31287,
-31449,
-31533,
-31569,
-31494,
-31403,
-31352,
-31419,
-31571,
-31707,
-31787,
-31750,
-31682,
-31640,
-31638,
-31687,
-31695,
-31711,
-31745,
-31910,
-32104,
-32326,
-32373,
-32252,
-32063,
-31892,
-31929,
-32066,
-32263,
-32363,
-32352,
-32261,
-32215,
-32238,
-32306,
-32395,
-32395,
-32419,
-32430,
-32546,
-32716,
-32879,
-32971,
-32933,
-32796,
-32696,
-32635,
-32737,
-32859,
-32972,
-33000,
-32958,
-32911,
-32930,
-33022,
-33157,
-33252,
-33290,
-33248,
-33166,
-33089,
-33036,
-33071,
-33175,
-33334,
-33500,
-33514,
-33443,
-33212,
-33034,
-32980,
-33111,
-33342,
-33547,
-33662,
-33638,
-33548,
-33456,
-33353,
-33205,
-33080,
-32942,
-32923,
-32982,
-33040,
-33057,
-32934,
-32817,
-32721,
-32755,
-32864,
-32942,
-32910,
-32796,
-32669,
-32677,
-32829,
-33064,
-33247,
-33222,
-33006,
-32648,
-32323,
-32173,
-32171,
-32323,
-32455,
-32489,
-32456,
-32324,
-32271,
-32224,
-32262,
-32287,
-32297,
-32255,
-32148,
-31973,
-31778,
-31629,
-31592,
-31682,
-31851,
-31934,
-31899,
-31678,
-31503,
-31395,
-31559,
-31773,
-32000,
-31997,
-31852,
-31592,
-31405,
-31358,
-31420,
-31520,
-31563,
-31508,
-31435,
-31351,
-31311,
-31349,
-31364,
-31432,
-31474,
-31542,
-31583,
-31576,
-31460,
-31313,
-31204,
-31298,
-31617,
-32014,
-32298,
-32274,
-31991,
-31733,
-31685,
-31986,
-32435,
-32777,
-32807,
-32638,
-32412,
-32363,
-32484,
-32653,
-32772,
-32806,
-32789,
-32808,
-32776,
-32692,
-32585,
-32606,
-32905,
-33392,
-33824,
-34001,
-33728,
-33317,
-33031,
-33095,
-33541,
-34023,
-34377,
-34480,
-34406,
-34290,
-34184,
-34114,
-34088,
-34179,
-34443,
-34762,
-34998,
-34926,
-34534,
-34114,
-33903,
-34156,
-34724,
-35301,
-35549,
-35375,
-34925,
-34512,
-34397,
-34609,
-35048,
-35449,
-35669,
-35647,
-35438,
-35222,
-35052,
-35082,
-35175,
-35402,
-35582,
-35733,
-35842,
-35866,
-35874,
-35757,
-35597,
-35369,
-35238,
-35265,
-35528,
-35958,
-36358,
-36525,
-36303,
-35694,
-34983,
-34501,
-34551,
-35148,
-35976,
-36617,
-36677,
-36152,
-35322,
-34627,
-34476,
-34829,
-35513,
-36097,
-36362,
-36196,
-35828,
-35353,
-35032,
-34798,
-34719,
-34707,
-34830,
-35040,
-35278,
-35403,
-35223,
-34823,
-34295,
-33988,
-34052,
-34433,
-34880,
-35064,
-34848,
-34376,
-33945,
-33796,
-33959,
-34204,
-34281,
-34080,
-33705,
-33428,
-33410,
-33632,
-33843,
-33839,
-33512,
-33124,
-32901,
-33104,
-33543,
-33930,
-33873,
-33265,
-32420,
-31841,
-31907,
-32675,
-33650,
-34189,
-33905,
-32828,
-31649,
-31069,
-31482,
-32635,
-33794,
-34179,
-33542,
-32247,
-31153,
-30857,
-31543,
-32652,
-33471,
-33483,
-32687,
-31661,
-30991,
-31058,
-31737,
-32500,
-32942,
-32785,
-32287,
-31762,
-31585,
-31736,
-32039,
-32171,
-32060,
-31745,
-31563,
-31570,
-31843,
-32048,
-32019,
-31702,
-31319,
-31235,
-31539,
-32048,
-32362,
-32132,
-31571,
-31002,
-30991,
-31456,
-32085,
-32276,
-31910,
-31249,
-30808,
-30849,
-31166,
-31385,
-31251,
-31021,
-30959,
-31263,
-31577,
-31506,
-30940,
-30284,
-30084,
-30591,
-31422,
-31934,
-31767,
-31093,
-30503,
-30377,
-30666,
-30933,
-30957,
-30755,
-30741,
-30974,
-31285,
-31247,
-30788,
-30235,
-30094,
-30572,
-31262,
-31614,
-31316,
-30578,
-30026,
-29945,
-30321,
-30635,
-30723,
-30588,
-30620,
-30899,
-31195,
-31086,
-30502,
-29744,
-29519,
-30049,
-31135,
-32018,
-32080,
-31321,
-30279,
-29692,
-30004,
-30912,
-31861,
-32190,
-31744,
-30853,
-30170,
-30080,
-30660,
-31453,
-31965,
-31881,
-31362,
-30745,
-30508,
-30732,
-31252,
-31739,
-31940,
-31811,
-31544,
-31298,
-31267,
-31512,
-31924,
-32393,
-32662,
-32589,
-32207,
-31757,
-31598,
-31962,
-32721,
-33455,
-33705,
-33276,
-32431,
-31714,
-31606,
-32178,
-33120,
-33828,
-33938,
-33459,
-32746,
-32344,
-32491,
-33135,
-33804,
-34167,
-33957,
-33488,
-33069,
-33082,
-33529,
-34129,
-34471,
-34356,
-33870,
-33377,
-33247,
-33580,
-34171,
-34608,
-34548,
-34040,
-33310,
-32938,
-33091,
-33814,
-34611,
-35030,
-34728,
-33843,
-32826,
-32223,
-32399,
-33220,
-34274,
-34931,
-34853,
-34065,
-32978,
-32175,
-31973,
-32484,
-33227,
-33913,
-34015,
-33705,
-33082,
-32548,
-32289,
-32283,
-32404,
-32442,
-32400,
-32312,
-32342,
-32440,
-32519,
-32387,
-31969,
-31441,
-31062,
-31172,
-31693,
-32360,
-32658,
-32311,
-31460,
-30633,
-30312,
-30773,
-31609,
-32304,
-32350,
-31685,
-30763,
-30063,
-29987,
-30447,
-31160,
-31684,
-31870,
-31622,
-31144,
-30583,
-30190,
-30082,
-30306,
-30847,
-31450,
-31902,
-31996,
-31638,
-30978,
-30290,
-29830,
-29882,
-30431,
-31288,
-32120,
-32473,
-32263,
-31505,
-30684,
-30227,
-30407,
-31225,
-32172,
-32873,
-32866,
-32329,
-31589,
-31231,
-31516,
-32313,
-33130,
-33431,
-33039,
-32249,
-31671,
-31744,
-32453,
-33309,
-33781,
-33583,
-33061,
-32669,
-32784,
-33333,
-33817,
-33938,
-33597,
-33193,
-33142,
-33613,
-34377,
-34990,
-35086,
-34668,
-34030,
-33609,
-33686,
-34148,
-34813,
-35217,
-35305,
-35034,
-34680,
-34411,
-34384,
-34503,
-34772,
-35035,
-35277,
-35403,
-35374,
-35157,
-34923,
-34804,
-34983,
-35400,
-35852,
-36029,
-35845,
-35359,
-34990,
-34930,
-35292,
-35858,
-36231,
-36197,
-35744,
-35120,
-34719,
-34711,
-35043,
-35494,
-35697,
-35654,
-35344,
-35058,
-34884,
-34822,
-34831,
-34799,
-34831,
-34946,
-35098,
-35206,
-35055,
-34690,
-34298,
-34122,
-34307,
-34731,
-35086,
-35184,
-34920,
-34493,
-34094,
-33877,
-33782,
-33823,
-33852,
-33925,
-34020,
-34066,
-34050,
-33990,
-33911,
-33833,
-33669,
-33346,
-32842,
-32438,
-32411,
-32943,
-33892,
-34649,
-34830,
-34145,
-33029,
-32089,
-31815,
-32340,
-33236,
-33949,
-34095,
-33684,
-33019,
-32512,
-32355,
-32526,
-32808,
-33006,
-33091,
-33081,
-33058,
-32950,
-32692,
-32307,
-31984,
-32003,
-32502,
-33265,
-33873,
-33844,
-33150,
-32156,
-31438,
-31468,
-32118,
-33070,
-33712,
-33884,
-33548,
-33014,
-32483,
-32131,
-32033,
-32233,
-32735,
-33370,
-33870,
-33969,
-33578,
-32873,
-32252,
-31990,
-32204,
-32706,
-33241,
-33532,
-33550,
-33258,
-32865,
-32461,
-32243,
-32274,
-32567,
-33022,
-33393,
-33513,
-33186,
-32595,
-31973,
-31733,
-32080,
-32889,
-33727,
-34070,
-33663,
-32686,
-31713,
-31277,
-31547,
-32271,
-32936,
-33194,
-33079,
-32786,
-32587,
-32416,
-32194,
-31828,
-31473,
-31436,
-31742,
-32349,
-32785,
-32907,
-32647,
-32309,
-32128,
-32129,
-32184,
-32054,
-31759,
-31477,
-31502,
-31952,
-32648,
-33185,
-33248,
-32674,
-31847,
-31094,
-30870,
-31206,
-31817,
-32408,
-32608,
-32505,
-32230,
-32014,
-31995,
-32012,
-32036,
-31947,
-31862,
-31922,
-32153,
-32477,
-32645,
-32506,
-32187,
-31939,
-32098,
-32677,
-33265,
-33361,
-32725,
-31658,
-30950,
-31148,
-32245,
-33502,
-34091,
-33682,
-32715,
-31923,
-31825,
-32190,
-32530,
-32539,
-32337,
-32466,
-32922,
-33470,
-33466,
-32860,
-32064,
-31822,
-32338,
-33157,
-33508,
-33021,
-32089,
-31601,
-31993,
-33056,
-33937,
-34019,
-33273,
-32373,
-31861,
-31963,
-32348,
-32693,
-32879,
-33068,
-33367,
-33553,
-33386,
-32613,
-31693,
-31059,
-31277,
-32198,
-33320,
-33938,
-33730,
-32850,
-31869,
-31302,
-31352,
-31901,
-32431,
-32727,
-32610,
-32316,
-32113,
-32159,
-32357,
-32493,
-32327,
-31828,
-31285,
-30879,
-30989,
-31432,
-32150,
-32687,
-32878,
-32499,
-31727,
-30839,
-30298,
-30405,
-31123,
-32071,
-32643,
-32545,
-31904,
-31220,
-30939,
-31099,
-31341,
-31271,
-30904,
-30691,
-31025,
-31873,
-32624,
-32550,
-31589,
-30308,
-29692,
-30175,
-31433,
-32562,
-32818,
-32232,
-31319,
-30767,
-30725,
-31026,
-31329,
-31611,
-31841,
-32045,
-31888,
-31328,
-30582,
-30302,
-30913,
-32080,
-32973,
-32723,
-31375,
-29933,
-29538,
-30600,
-32351,
-33491,
-33275,
-32048,
-30883,
-30636,
-31219,
-31899,
-31991,
-31553,
-31209,
-31523,
-32399,
-33200,
-33247,
-32444,
-31312,
-30478,
-30386,
-30867,
-31708,
-32521,
-33164,
-33386,
-33037,
-32070,
-30936,
-30175,
-30385,
-31400,
-32695,
-33398,
-33252,
-32459,
-31751,
-31562,
-31825,
-32146,
-32148,
-31890,
-31715,
-31937,
-32473,
-32980,
-33070,
-32684,
-32095,
-31619,
-31516,
-31670,
-31998,
-32331,
-32672,
-32927,
-33028,
-32820,
-32349,
-31808,
-31458,
-31545,
-31994,
-32619,
-33133,
-33339,
-33236,
-32863,
-32397,
-31976,
-31741,
-31854,
-32256,
-32823,
-33281,
-33428,
-33311,
-33051,
-32826,
-32695,
-32498,
-32263,
-32053,
-32121,
-32630,
-33382,
-33954,
-33993,
-33452,
-32717,
-32351,
-32512,
-33055,
-33468,
-33452,
-33168,
-32966,
-33227,
-33858,
-34443,
-34548,
-34055,
-33226,
-32594,
-32488,
-32985,
-33824,
-34612,
-35007,
-34845,
-34161,
-33279,
-32676,
-32711,
-33465,
-34483,
-35185,
-35089,
-34398,
-33618,
-33337,
-33678,
-34222,
-34467,
-34293,
-34040,
-34177,
-34719,
-35221,
-35118,
-34402,
-33648,
-33514,
-34187,
-35056,
-35360,
-34914,
-34219,
-34113,
-34829,
-35713,
-35864,
-34956,
-33584,
-32962,
-33559,
-35058,
-36292,
-36487,
-35733,
-34813,
-34387,
-34556,
-34778,
-34698,
-34443,
-34460,
-35072,
-35902,
-36322,
-35860,
-34798,
-33872,
-33706,
-34319,
-35146,
-35518,
-35298,
-34785,
-34536,
-34865,
-35418,
-35829,
-35548,
-34797,
-33921,
-33627,
-34048,
-34988,
-35851,
-36076,
-35603,
-34708,
-33967,
-33676,
-33868,
-34168,
-34396,
-34402,
-34431,
-34472,
-34603,
-34558,
-34350,
-34027,
-33831,
-33845,
-33983,
-33990,
-33786,
-33483,
-33291,
-33375,
-33595,
-33767,
-33746,
-33567,
-33317,
-33069,
-32691,
-32270,
-31899,
-32010,
-32643,
-33549,
-34090,
-33767,
-32652,
-31416,
-30796,
-31165,
-32099,
-32904,
-33028,
-32513,
-31846,
-31437,
-31361,
-31370,
-31216,
-30958,
-30903,
-31252,
-31899,
-32395,
-32317,
-31600,
-30570,
-29848,
-29782,
-30409,
-31237,
-31808,
-31825,
-31480,
-31136,
-31049,
-31124,
-31006,
-30497,
-29890,
-29694,
-30369,
-31644,
-32732,
-32836,
-31879,
-30491,
-29746,
-29980,
-30924,
-31692,
-31821,
-31473,
-31214,
-31398,
-31757,
-31826,
-31352,
-30750,
-30645,
-31287,
-32208,
-32712,
-32485,
-31831,
-31518,
-31793,
-32368,
-32568,
-32167,
-31517,
-31531,
-32401,
-33800,
-34624,
-34256,
-32832,
-31379,
-30829,
-31591,
-33112,
-34516,
-35083,
-34762,
-33860,
-33017,
-32533,
-32586,
-33032,
-33638,
-34175,
-34435,
-34417,
-34254,
-34136,
-34170,
-34302,
-34339,
-34201,
-33984,
-33896,
-34166,
-34669,
-35180,
-35360,
-35162,
-34778,
-34544,
-34613,
-34927,
-35131,
-35053,
-34634,
-34253,
-34152,
-34558,
-35241,
-35818,
-35974,
-35553,
-34759,
-33961,
-33519,
-33600,
-34182,
-34913,
-35513,
-35641,
-35333,
-34701,
-34123,
-33745,
-33663,
-33657,
-33742,
-33854,
-34174,
-34618,
-34876,
-34623,
-33737,
-32674,
-32156,
-32582,
-33668,
-34561,
-34437,
-33387,
-32117,
-31682,
-32201,
-33159,
-33519,
-32997,
-32071,
-31669,
-32080,
-32822,
-32894,
-32028,
-30710,
-30126,
-30753,
-32184,
-33212,
-33007,
-31714,
-30271,
-29668,
-30060,
-30883,
-31406,
-31336,
-30975,
-30777,
-30828,
-30873,
-30580,
-29970,
-29412,
-29407,
-29952,
-30782,
-31222,
-30999,
-30139,
-29217,
-28688,
-28877,
-29476,
-30145,
-30401,
-30213,
-29756,
-29400,
-29259,
-29328,
-29318,
-29208,
-29055,
-29138,
-29472,
-29965,
-30203,
-30041,
-29516,
-28974,
-28781,
-29024,
-29557,
-30070,
-30271,
-30217,
-29952,
-29761,
-29707,
-29818,
-30017,
-30170,
-30256,
-30247,
-30225,
-30194,
-30302,
-30431,
-30696,
-30878,
-31006,
-30910,
-30702,
-30444,
-30394,
-30622,
-31097,
-31531,
-31690,
-31473,
-31139,
-30978,
-31261,
-31771,
-32181,
-32144,
-31643,
-31139,
-31011,
-31513,
-32340,
-32960,
-33000,
-32496,
-31833,
-31588,
-31838,
-32430,
-32792,
-32723,
-32257,
-31940,
-32164,
-32897,
-33711,
-33898,
-33218,
-32023,
-31118,
-31225,
-32407,
-33974,
-34990,
-34817,
-33628,
-32172,
-31382,
-31551,
-32554,
-33597,
-34216,
-34204,
-33845,
-33478,
-33353,
-33329,
-33259,
-33023,
-32745,
-32732,
-33134,
-33869,
-34635,
-34920,
-34602,
-33774,
-32918,
-32513,
-32771,
-33485,
-34268,
-34627,
-34485,
-33988,
-33527,
-33409,
-33658,
-34073,
-34341,
-34287,
-34004,
-33682,
-33646,
-33844,
-34234,
-34464,
-34424,
-34150,
-33898,
-33876,
-34195,
-34616,
-34905,
-34794,
-34296,
-33687,
-33310,
-33494,
-34169,
-35037,
-35559,
-35403,
-34657,
-33758,
-33299,
-33606,
-34395,
-35165,
-35325,
-34843,
-34155,
-33819,
-34117,
-34771,
-35268,
-35195,
-34701,
-34174,
-34074,
-34475,
-34973,
-35193,
-34941,
-34423,
-34117,
-34207,
-34689,
-35148,
-35276,
-34949,
-34435,
-34079,
-34103,
-34480,
-34857,
-34977,
-34683,
-34213,
-33895,
-33965,
-34424,
-34948,
-35179,
-34912,
-34298,
-33673,
-33424,
-33657,
-34195,
-34668,
-34848,
-34681,
-34414,
-34187,
-34080,
-33904,
-33623,
-33341,
-33316,
-33765,
-34369,
-34732,
-34425,
-33616,
-32872,
-32752,
-33257,
-33838,
-33875,
-33328,
-32736,
-32815,
-33571,
-34331,
-34216,
-33093,
-31740,
-31239,
-32012,
-33404,
-34258,
-33924,
-32847,
-31951,
-31990,
-32589,
-32969,
-32569,
-31737,
-31264,
-31698,
-32652,
-33317,
-33114,
-32312,
-31571,
-31527,
-31843,
-32060,
-31719,
-31162,
-31032,
-31595,
-32542,
-33032,
-32712,
-31780,
-31040,
-30988,
-31475,
-31929,
-31832,
-31335,
-30968,
-31245,
-32069,
-32844,
-32966,
-32254,
-31148,
-30326,
-30230,
-30852,
-31786,
-32517,
-32748,
-32463,
-31870,
-31319,
-31020,
-31135,
-31520,
-31986,
-32274,
-32278,
-32032,
-31770,
-31624,
-31786,
-32073,
-32449,
-32596,
-32549,
-32282,
-32074,
-32055,
-32297,
-32656,
-32878,
-32869,
-32634,
-32488,
-32547,
-32855,
-33095,
-33074,
-32726,
-32362,
-32310,
-32704,
-33377,
-33827,
-33862,
-33364,
-32758,
-32353,
-32381,
-32783,
-33329,
-33803,
-34079,
-34115,
-33929,
-33560,
-33087,
-32721,
-32597,
-32930,
-33531,
-34236,
-34589,
-34475,
-33839,
-33115,
-32600,
-32683,
-33169,
-33884,
-34341,
-34374,
-34034,
-33499,
-33120,
-32980,
-33098,
-33364,
-33585,
-33790,
-33877,
-33912,
-33863,
-33675,
-33369,
-32985,
-32753,
-32782,
-33182,
-33722,
-34127,
-34120,
-33693,
-33089,
-32668,
-32574,
-32767,
-32956,
-33086,
-33061,
-33070,
-33056,
-32960,
-32685,
-32346,
-32252,
-32528,
-33083,
-33374,
-33112,
-32338,
-31590,
-31539,
-32220,
-33237,
-33773,
-33526,
-32664,
-31888,
-31625,
-31850,
-32179,
-32238,
-32162,
-32131,
-32480,
-32828,
-32955,
-32477,
-31785,
-31205,
-31243,
-31711,
-32319,
-32684,
-32769,
-32735,
-32686,
-32606,
-32278,
-31856,
-31496,
-31601,
-32112,
-32744,
-33015,
-32796,
-32311,
-31992,
-32032,
-32244,
-32278,
-31978,
-31620,
-31593,
-32085,
-32815,
-33211,
-32955,
-32136,
-31339,
-31046,
-31405,
-32121,
-32688,
-32867,
-32619,
-32262,
-31956,
-31826,
-31784,
-31794,
-31774,
-31808,
-31821,
-31885,
-31994,
-32085,
-32187,
-32046,
-31713,
-31136,
-30667,
-30545,
-30963,
-31672,
-32289,
-32321,
-31712,
-30792,
-30089,
-30056,
-30683,
-31498,
-32003,
-31804,
-31091,
-30365,
-30107,
-30492,
-31147,
-31583,
-31420,
-30804,
-30242,
-30214,
-30774,
-31462,
-31682,
-31161,
-30220,
-29521,
-29604,
-30453,
-31536,
-32192,
-32053,
-31322,
-30440,
-29894,
-29900,
-30384,
-31086,
-31734,
-32110,
-32062,
-31725,
-31264,
-31048,
-31161,
-31498,
-31773,
-31748,
-31560,
-31504,
-31871,
-32535,
-33045,
-33005,
-32311,
-31498,
-31131,
-31600,
-32613,
-33570,
-33884,
-33506,
-32829,
-32407,
-32529,
-33055,
-33575,
-33772,
-33580,
-33255,
-33092,
-33293,
-33721,
-34232,
-34486,
-34500,
-34245,
-33971,
-33812,
-33805,
-34007,
-34283,
-34582,
-34836,
-34951,
-34898,
-34698,
-34459,
-34335,
-34474,
-34783,
-35174,
-35357,
-35312,
-34995,
-34670,
-34439,
-34491,
-34688,
-35036,
-35278,
-35476,
-35516,
-35495,
-35330,
-35076,
-34670,
-34243,
-33997,
-34128,
-34697,
-35484,
-36092,
-36152,
-35606,
-34713,
-33904,
-33586,
-33695,
-34137,
-34558,
-34891,
-35073,
-35184,
-35109,
-34819,
-34282,
-33688,
-33277,
-33256,
-33578,
-34046,
-34388,
-34498,
-34413,
-34292,
-34186,
-34039,
-33656,
-33010,
-32318,
-31982,
-32350,
-33327,
-34456,
-34934,
-34469,
-33103,
-31713,
-30955,
-31241,
-32172,
-33090,
-33452,
-33199,
-32746,
-32435,
-32421,
-32449,
-32261,
-31836,
-31381,
-31232,
-31539,
-32063,
-32616,
-32787,
-32646,
-32231,
-31783,
-31406,
-31135,
-30983,
-30945,
-31110,
-31490,
-32024,
-32467,
-32597,
-32237,
-31557,
-30782,
-30307,
-30181,
-30417,
-30756,
-31214,
-31707,
-32253,
-32622,
-32462,
-31709,
-30608,
-29780,
-29802,
-30567,
-31630,
-32237,
-32228,
-31889,
-31798,
-32069,
-32315,
-31987,
-31010,
-30018,
-29795,
-30779,
-32318,
-33566,
-33685,
-32896,
-31789,
-31138,
-30963,
-31064,
-31152,
-31295,
-31865,
-32737,
-33590,
-33731,
-33061,
-32011,
-31330,
-31467,
-32139,
-32791,
-32969,
-32855,
-32917,
-33415,
-34108,
-34410,
-33892,
-32843,
-31890,
-31750,
-32499,
-33655,
-34524,
-34647,
-34113,
-33458,
-33081,
-33230,
-33617,
-33888,
-33829,
-33500,
-33185,
-33203,
-33606,
-34171,
-34628,
-34691,
-34423,
-34017,
-33710,
-33618,
-33669,
-33798,
-33825,
-33899,
-33983,
-34170,
-34397,
-34514,
-34491,
-34288,
-34030,
-33798,
-33743,
-33711,
-33752,
-33695,
-33679,
-33695,
-33838,
-33994,
-34026,
-33876,
-33613,
-33481,
-33542,
-33782,
-33862,
-33613,
-33107,
-32680,
-32739,
-33265,
-33994,
-34362,
-34177,
-33572,
-32916,
-32607,
-32608,
-32805,
-32993,
-33179,
-33422,
-33617,
-33599,
-33163,
-32560,
-32131,
-32322,
-32958,
-33572,
-33627,
-33080,
-32474,
-32340,
-32840,
-33411,
-33463,
-32767,
-31971,
-31703,
-32411,
-33452,
-34085,
-33754,
-32852,
-32139,
-32192,
-32783,
-33272,
-33070,
-32414,
-31900,
-32176,
-33169,
-34205,
-34602,
-34045,
-32899,
-31803,
-31195,
-31291,
-31929,
-32978,
-34069,
-34907,
-35038,
-34311,
-33028,
-31748,
-31235,
-31612,
-32644,
-33671,
-34254,
-34314,
-34088,
-33717,
-33276,
-32662,
-32065,
-31767,
-32108,
-33000,
-33977,
-34441,
-34168,
-33387,
-32695,
-32412,
-32514,
-32669,
-32657,
-32602,
-32773,
-33262,
-33796,
-33924,
-33385,
-32496,
-31756,
-31669,
-32156,
-32850,
-33235,
-33193,
-32880,
-32666,
-32622,
-32676,
-32555,
-32244,
-31905,
-31842,
-32192,
-32814,
-33278,
-33269,
-32687,
-31882,
-31297,
-31303,
-31799,
-32430,
-32761,
-32636,
-32273,
-32027,
-32067,
-32321,
-32486,
-32349,
-32025,
-31691,
-31627,
-31768,
-31974,
-32099,
-32118,
-32192,
-32312,
-32424,
-32337,
-32047,
-31650,
-31468,
-31526,
-31844,
-32100,
-32260,
-32247,
-32275,
-32274,
-32239,
-32009,
-31682,
-31478,
-31592,
-32079,
-32543,
-32721,
-32430,
-31968,
-31717,
-31921,
-32419,
-32808,
-32815,
-32429,
-31994,
-31815,
-31998,
-32375,
-32685,
-32850,
-32810,
-32704,
-32497,
-32208,
-31983,
-31892,
-32095,
-32523,
-32880,
-32997,
-32764,
-32420,
-32206,
-32208,
-32345,
-32351,
-32200,
-31965,
-31960,
-32223,
-32657,
-32943,
-32837,
-32413,
-31900,
-31625,
-31727,
-32047,
-32415,
-32533,
-32509,
-32370,
-32359,
-32464,
-32547,
-32472,
-32133,
-31715,
-31430,
-31509,
-31902,
-32380,
-32696,
-32642,
-32349,
-32001,
-31739,
-31601,
-31470,
-31384,
-31391,
-31665,
-32163,
-32675,
-32901,
-32711,
-32188,
-31641,
-31334,
-31282,
-31451,
-31637,
-31908,
-32191,
-32492,
-32589,
-32408,
-32053,
-31757,
-31810,
-32088,
-32283,
-32078,
-31547,
-31123,
-31300,
-32103,
-33130,
-33691,
-33548,
-32824,
-32108,
-31650,
-31479,
-31354,
-31238,
-31426,
-32109,
-33229,
-34104,
-34177,
-33306,
-32050,
-31271,
-31308,
-31959,
-32505,
-32601,
-32411,
-32386,
-32823,
-33316,
-33433,
-32846,
-32066,
-31663,
-32040,
-32785,
-33220,
-32980,
-32353,
-32027,
-32409,
-33227,
-33766,
-33527,
-32681,
-31887,
-31683,
-32163,
-32767,
-33151,
-33124,
-33059,
-33122,
-33333,
-33294,
-32876,
-32199,
-31768,
-31931,
-32733,
-33698,
-34337,
-34315,
-33676,
-32840,
-32108,
-31867,
-31989,
-32521,
-33133,
-33825,
-34300,
-34541,
-34314,
-33696,
-32850,
-32215,
-32111,
-32719,
-33623,
-34405,
-34533,
-34102,
-33440,
-33055,
-33006,
-33157,
-33126,
-32926,
-32865,
-33247,
-34134,
-34965,
-35147,
-34431,
-33180,
-32161,
-32052,
-32814,
-33992,
-34838,
-34993,
-34559,
-33967,
-33564,
-33493,
-33624,
-33770,
-33816,
-33720,
-33608,
-33569,
-33832,
-34351,
-35012,
-35385,
-35107,
-34111,
-32852,
-31961,
-32056,
-33048,
-34384,
-35362,
-35518,
-35090,
-34474,
-34086,
-33861,
-33617,
-33205,
-32820,
-32842,
-33465,
-34517,
-35418,
-35705,
-35145,
-34126,
-33141,
-32654,
-32718,
-33075,
-33413,
-33622,
-33845,
-34286,
-34925,
-35391,
-35234,
-34251,
-32756,
-31512,
-31186,
-31996,
-33446,
-34743,
-35253,
-34993,
-34341,
-33890,
-33754,
-33701,
-33324,
-32514,
-31687,
-31484,
-32333,
-33976,
-35580,
-36201,
-35419,
-33695,
-31986,
-31242,
-31539,
-32437,
-33043,
-33081,
-32799,
-32862,
-33589,
-34635,
-35219,
-34676,
-33064,
-31158,
-29891,
-29932,
-31052,
-32696,
-33998,
-34610,
-34470,
-33905,
-33196,
-32485,
-31847,
-31258,
-30913,
-30952,
-31553,
-32634,
-33842,
-34693,
-34759,
-33973,
-32640,
-31288,
-30486,
-30448,
-31079,
-32003,
-32781,
-33203,
-33224,
-33034,
-32739,
-32422,
-32088,
-31680,
-31359,
-31124,
-31184,
-31406,
-31834,
-32306,
-32833,
-33267,
-33414,
-33075,
-32213,
-31215,
-30575,
-30743,
-31635,
-32715,
-33303,
-33167,
-32532,
-32036,
-32018,
-32391,
-32681,
-32519,
-31933,
-31350,
-31193,
-31562,
-32202,
-32758,
-32980,
-32920,
-32649,
-32285,
-31867,
-31516,
-31418,
-31686,
-32180,
-32673,
-32767,
-32576,
-32321,
-32353,
-32673,
-32990,
-32859,
-32279,
-31499,
-31203,
-31486,
-32290,
-32978,
-33318,
-33199,
-33015,
-32871,
-32782,
-32490,
-32002,
-31518,
-31499,
-31969,
-32745,
-33282,
-33376,
-33074,
-32814,
-32733,
-32816,
-32699,
-32303,
-31746,
-31521,
-31861,
-32677,
-33596,
-34097,
-34090,
-33596,
-32954,
-32334,
-31933,
-31750,
-31952,
-32462,
-33245,
-33941,
-34279,
-34065,
-33433,
-32663,
-32113,
-31931,
-32102,
-32428,
-32794,
-33111,
-33418,
-33741,
-33923,
-33900,
-33445,
-32715,
-31934,
-31503,
-31725,
-32528,
-33591,
-34379,
-34497,
-33975,
-33063,
-32310,
-32023,
-32236,
-32723,
-33137,
-33367,
-33407,
-33474,
-33550,
-33571,
-33275,
-32679,
-31982,
-31622,
-31870,
-32620,
-33511,
-33967,
-33926,
-33480,
-33085,
-32877,
-32752,
-32494,
-32002,
-31579,
-31601,
-32180,
-33104,
-33844,
-34130,
-33937,
-33449,
-32865,
-32066,
-31078,
-30159,
-29830,
-30568,
-32231,
-34072,
-35200,
-35015,
-33871,
-32407,
-31325,
-30807,
-30654,
-30709,
-30967,
-31680,
-32672,
-33624,
-33932,
-33443,
-32448,
-31546,
-31074,
-30980,
-30961,
-30826,
-30786,
-31134,
-31894,
-32755,
-33137,
-32858,
-32185,
-31601,
-31462,
-31582,
-31610,
-31398,
-31097,
-31197,
-31685,
-32359,
-32595,
-32300,
-31668,
-31301,
-31393,
-31713,
-31816,
-31496,
-31079,
-31067,
-31612,
-32322,
-32559,
-32049,
-31160,
-30602,
-30876,
-31728,
-32578,
-32799,
-32395,
-31793,
-31420,
-31442,
-31499,
-31393,
-31090,
-30998,
-31415,
-32334,
-33298,
-33685,
-33200,
-32049,
-30900,
-30341,
-30658,
-31501,
-32301,
-32649,
-32535,
-32355,
-32471,
-32825,
-33087,
-32816,
-32044,
-31301,
-31069,
-31624,
-32494,
-33097,
-33069,
-32608,
-32318,
-32485,
-33060,
-33479,
-33367,
-32811,
-32196,
-32037,
-32373,
-32946,
-33297,
-33295,
-33083,
-32978,
-33195,
-33545,
-33748,
-33560,
-33033,
-32589,
-32553,
-33020,
-33618,
-33825,
-33430,
-32740,
-32447,
-33007,
-34189,
-35203,
-35239,
-34259,
-32986,
-32323,
-32680,
-33479,
-33983,
-33765,
-33270,
-33271,
-34044,
-35069,
-35424,
-34640,
-33234,
-32201,
-32316,
-33331,
-34470,
-34890,
-34575,
-34050,
-33896,
-34161,
-34383,
-34150,
-33464,
-32869,
-32847,
-33484,
-34328,
-34787,
-34546,
-33861,
-33217,
-33100,
-33494,
-34080,
-34345,
-34204,
-33731,
-33479,
-33517,
-33795,
-33837,
-33417,
-32854,
-32625,
-33252,
-34361,
-35221,
-35050,
-33894,
-32559,
-32056,
-32592,
-33582,
-33989,
-33500,
-32592,
-32296,
-32953,
-34052,
-34558,
-33920,
-32651,
-31774,
-31997,
-33033,
-33903,
-33895,
-33097,
-32284,
-32121,
-32544,
-33087,
-33228,
-33107,
-33108,
-33393,
-33657,
-33403,
-32541,
-31689,
-31529,
-32318,
-33484,
-34092,
-33822,
-32962,
-32481,
-32700,
-33429,
-33762,
-33328,
-32336,
-31619,
-31783,
-32674,
-33674,
-34064,
-33798,
-33230,
-32936,
-32983,
-33190,
-33145,
-32832,
-32443,
-32385,
-32718,
-33342,
-33837,
-34106,
-34043,
-33874,
-33665,
-33339,
-32861,
-32116,
-31459,
-31269,
-31951,
-33403,
-35125,
-36215,
-36183,
-34935,
-33195,
-31758,
-31220,
-31597,
-32392,
-33162,
-33644,
-33956,
-34281,
-34569,
-34684,
-34266,
-33454,
-32431,
-31735,
-31637,
-32143,
-32963,
-33707,
-34121,
-34158,
-33956,
-33710,
-33517,
-33347,
-33110,
-32716,
-32258,
-31862,
-31825,
-32182,
-32923,
-33737,
-34264,
-34326,
-33873,
-33131,
-32364,
-31828,
-31535,
-31581,
-31826,
-32316,
-32900,
-33398,
-33574,
-33281,
-32580,
-31745,
-31216,
-31145,
-31610,
-32289,
-32829,
-33063,
-32880,
-32473,
-32049,
-31749,
-31729,
-31916,
-32252,
-32458,
-32452,
-32158,
-31861,
-31763,
-32009,
-32408,
-32621,
-32422,
-31922,
-31515,
-31524,
-31951,
-32366,
-32387,
-31928,
-31396,
-31251,
-31666,
-32274,
-32545,
-32272,
-31654,
-31328,
-31488,
-32089,
-32624,
-32845,
-32789,
-32760,
-32821,
-32802,
-32417,
-31785,
-31320,
-31616,
-32632,
-33803,
-34272,
-33657,
-32339,
-31281,
-31171,
-32050,
-33242,
-33947,
-33762,
-33027,
-32345,
-32186,
-32566,
-33057,
-33236,
-32986,
-32587,
-32393,
-32656,
-33141,
-33512,
-33431,
-32989,
-32556,
-32567,
-33059,
-33726,
-34023,
-33773,
-33139,
-32658,
-32698,
-33185,
-33779,
-33946,
-33598,
-32870,
-32146,
-31797,
-31886,
-32451,
-33271,
-34123,
-34637,
-34585,
-33843,
-32804,
-31892,
-31590,
-31916,
-32518,
-32988,
-33083,
-32966,
-32968,
-33203,
-33485,
-33485,
-32958,
-32145,
-31453,
-31329,
-31826,
-32639,
-33280,
-33451,
-33121,
-32600,
-32129,
-31939,
-31936,
-32011,
-31976,
-31815,
-31567,
-31469,
-31622,
-32075,
-32590,
-32885,
-32696,
-32019,
-31224,
-30674,
-30764,
-31371,
-32193,
-32721,
-32709,
-32186,
-31514,
-31024,
-30962,
-31216,
-31629,
-31960,
-32122,
-32219,
-32257,
-32341,
-32304,
-32103,
-31634,
-31143,
-30804,
-30877,
-31363,
-32070,
-32674,
-32953,
-32827,
-32381,
-31814,
-31287,
-30929,
-30948,
-31335,
-32046,
-32793,
-33171,
-33021,
-32407,
-31779,
-31507,
-31737,
-32173,
-32426,
-32297,
-31954,
-31805,
-32056,
-32631,
-33166,
-33384,
-33246,
-32932,
-32575,
-32290,
-31951,
-31766,
-31847,
-32402,
-33294,
-34003,
-34191,
-33634,
-32723,
-31957,
-31630,
-31794,
-32028,
-32309,
-32505,
-32941,
-33471,
-33968,
-33965,
-33451,
-32622,
-32015,
-31995,
-32474,
-33101,
-33384,
-33194,
-32693,
-32342,
-32442,
-32963,
-33677,
-34097,
-34036,
-33497,
-32798,
-32278,
-32163,
-32417,
-32795,
-33061,
-33086,
-32940,
-32802,
-32833,
-33043,
-33308,
-33423,
-33250,
-32854,
-32372,
-32104,
-32187,
-32666,
-33349,
-33936,
-34185,
-33967,
-33384,
-32658,
-32053,
-31763,
-31793,
-32144,
-32593,
-33084,
-33454,
-33697,
-33766,
-33704,
-33486,
-33183,
-32810,
-32462,
-32267,
-32275,
-32624,
-33157,
-33732,
-34015,
-33817,
-33203,
-32439,
-31960,
-32023,
-32502,
-33113,
-33418,
-33356,
-33075,
-32887,
-32892,
-33006,
-32973,
-32758,
-32492,
-32529,
-32934,
-33526,
-33941,
-33787,
-33165,
-32353,
-31884,
-31917,
-32497,
-33112,
-33553,
-33509,
-33180,
-32785,
-32565,
-32603,
-32723,
-32839,
-32802,
-32798,
-32844,
-33040,
-33172,
-33113,
-32802,
-32386,
-32154,
-32234,
-32580,
-32971,
-33232,
-33344,
-33362,
-33364,
-33254,
-32972,
-32546,
-32185,
-32147,
-32464,
-32962,
-33307,
-33340,
-33180,
-33061,
-33212,
-33517,
-33764,
-33672,
-33316,
-32861,
-32589,
-32649,
-32931,
-33297,
-33622,
-33787,
-33857,
-33758,
-33583,
-33359,
-33226,
-33268,
-33397,
-33565,
-33528,
-33391,
-33165,
-33080,
-33159,
-33322,
-33474,
-33482,
-33475,
-33515,
-33689,
-33928,
-33993,
-33873,
-33487,
-33182,
-33068,
-33336,
-33777,
-34155,
-34208,
-33948,
-33518,
-33283,
-33302,
-33579,
-33784,
-33770,
-33551,
-33358,
-33439,
-33754,
-34069,
-34095,
-33738,
-33258,
-33077,
-33350,
-34004,
-34553,
-34661,
-34195,
-33445,
-32827,
-32657,
-32955,
-33538,
-34067,
-34427,
-34497,
-34414,
-34165,
-33874,
-33498,
-33100,
-32840,
-32748,
-32923,
-33252,
-33525,
-33637,
-33607,
-33516,
-33593,
-33700,
-33744,
-33545,
-33148,
-32798,
-32735,
-32967,
-33328,
-33495,
-33437,
-33283,
-33283,
-33468,
-33635,
-33463,
-32938,
-32345,
-32131,
-32528,
-33285,
-33969,
-34137,
-33787,
-33205,
-32716,
-32532,
-32492,
-32464,
-32346,
-32196,
-32102,
-32108,
-32134,
-32222,
-32361,
-32580,
-32847,
-32898,
-32783,
-32425,
-32250,
-32334,
-32725,
-33002,
-32933,
-32386,
-31782,
-31472,
-31661,
-32076,
-32315,
-32198,
-31867,
-31723,
-31940,
-32368,
-32629,
-32522,
-32103,
-31745,
-31576,
-31544,
-31454,
-31219,
-31103,
-31351,
-31954,
-32545,
-32634,
-32151,
-31451,
-31166,
-31523,
-32302,
-32924,
-32962,
-32552,
-32005,
-31731,
-31663,
-31551,
-31248,
-30855,
-30766,
-31113,
-31761,
-32283,
-32371,
-32103,
-31770,
-31722,
-31897,
-32090,
-32057,
-31747,
-31441,
-31330,
-31465,
-31731,
-31802,
-31700,
-31482,
-31397,
-31646,
-32079,
-32512,
-32664,
-32458,
-32072,
-31730,
-31679,
-31872,
-32150,
-32279,
-32232,
-32066,
-32016,
-32077,
-32173,
-32188,
-32022,
-31918,
-31878,
-32038,
-32141,
-32043,
-31809,
-31612,
-31786,
-32227,
-32723,
-32803,
-32465,
-31912,
-31646,
-31868,
-32426,
-32880,
-32864,
-32465,
-31992,
-31863,
-32128,
-32560,
-32823,
-32720,
-32417,
-32179,
-32292,
-32669,
-33142,
-33347,
-33204,
-32787,
-32402,
-32250,
-32399,
-32650,
-32749,
-32667,
-32417,
-32304,
-32384,
-32657,
-32916,
-32996,
-32958,
-32807,
-32780,
-32751,
-32776,
-32770,
-32876,
-33107,
-33482,
-33727,
-33751,
-33481,
-33165,
-33004,
-33061,
-33151,
-33130,
-32928,
-32833,
-33017,
-33537,
-34026,
-34145,
-33749,
-33106,
-32658,
-32734,
-33140,
-33586,
-33628,
-33353,
-32984,
-32925,
-33155,
-33597,
-33823,
-33793,
-33488,
-33194,
-32999,
-33047,
-33188,
-33453,
-33630,
-33736,
-33639,
-33419,
-33216,
-33172,
-33410,
-33722,
-33917,
-33712,
-33276,
-32771,
-32629,
-32770,
-33129,
-33311,
-33235,
-33042,
-32954,
-33222,
-33626,
-33964,
-33863,
-33384,
-32744,
-32343,
-32383,
-32797,
-33261,
-33470,
-33335,
-33053,
-32894,
-33063,
-33360,
-33545,
-33301,
-32754,
-32206,
-32096,
-32434,
-33019,
-33393,
-33358,
-33050,
-32746,
-32688,
-32803,
-32852,
-32736,
-32513,
-32494,
-32697,
-33045,
-33152,
-32894,
-32428,
-32084,
-32058,
-32353,
-32573,
-32619,
-32396,
-32206,
-32166,
-32269,
-32386,
-32374,
-32351,
-32430,
-32679,
-32895,
-32947,
-32744,
-32513,
-32471,
-32578,
-32660,
-32431,
-31941,
-31530,
-31586,
-32140,
-32832,
-33141,
-32863,
-32266,
-31872,
-31984,
-32511,
-32965,
-33015,
-32640,
-32158,
-31883,
-31881,
-31943,
-31941,
-31841,
-31830,
-32076,
-32470,
-32782,
-32780,
-32442,
-32075,
-31906,
-32091,
-32505,
-32829,
-32885,
-32646,
-32284,
-32049,
-32057,
-32275,
-32521,
-32647,
-32623,
-32517,
-32478,
-32476,
-32479,
-32414,
-32277,
-32237,
-32357,
-32619,
-32842,
-32831,
-32600,
-32336,
-32286,
-32533,
-32920,
-33142,
-33035,
-32706,
-32372,
-32264,
-32438,
-32689,
-32965,
-33100,
-33243,
-33291,
-33293,
-33067,
-32731,
-32370,
-32263,
-32451,
-32809,
-33145,
-33203,
-33074,
-32860,
-32762,
-32807,
-32873,
-32859,
-32729,
-32570,
-32513,
-32609,
-32810,
-33025,
-33175,
-33244,
-33229,
-33199,
-33115,
-33083,
-33063,
-33136,
-33211,
-33262,
-33227,
-33209,
-33206,
-33362,
-33509,
-33545,
-33377,
-32988,
-32675,
-32556,
-32771,
-33167,
-33507,
-33670,
-33585,
-33432,
-33233,
-33056,
-32870,
-32726,
-32759,
-33043,
-33501,
-33938,
-34051,
-33852,
-33452,
-33194,
-33177,
-33372,
-33579,
-33642,
-33596,
-33552,
-33541,
-33502,
-33319,
-33004,
-32814,
-32855,
-33222,
-33572,
-33698,
-33441,
-33101,
-32942,
-33138,
-33483,
-33641,
-33424,
-33005,
-32705,
-32837,
-33317,
-33795,
-33950,
-33693,
-33273,
-33011,
-33097,
-33381,
-33642,
-33583,
-33274,
-32861,
-32647,
-32687,
-32950,
-33181,
-33239,
-33099,
-32886,
-32767,
-32794,
-32902,
-32952,
-32878,
-32764,
-32667,
-32801,
-32991,
-33202,
-33186,
-33022,
-32736,
-32543,
-32515,
-32610,
-32798,
-32893,
-32930,
-32855,
-32745,
-32608,
-32513,
-32456,
-32501,
-32561,
-32675,
-32732,
-32780,
-32761,
-32701,
-32541,
-32345,
-32071,
-31868,
-31780,
-31877,
-32093,
-32287,
-32393,
-32313,
-32206,
-32118,
-32157,
-32277,
-32375,
-32359,
-32232,
-32043,
-31971,
-32046,
-32271,
-32514,
-32639,
-32588,
-32403,
-32199,
-32092,
-32018,
-31997,
-31850,
-31698,
-31604,
-31678,
-31935,
-32210,
-32360,
-32306,
-32139,
-32012,
-32011,
-32117,
-32163,
-32139,
-31986,
-31932,
-31944,
-32069,
-32176,
-32203,
-32180,
-32177,
-32202,
-32219,
-32143,
-31973,
-31875,
-31910,
-32167,
-32464,
-32623,
-32568,
-32336,
-32162,
-32175,
-32351,
-32532,
-32510,
-32223,
-31825,
-31604,
-31705,
-32178,
-32729,
-33105,
-33077,
-32737,
-32327,
-32123,
-32241,
-32562,
-32853,
-32987,
-32949,
-32840,
-32809,
-32822,
-32826,
-32775,
-32725,
-32708,
-32816,
-32883,
-32925,
-32849,
-32841,
-32952,
-33137,
-33263,
-33157,
-32897,
-32713,
-32775,
-33133,
-33487,
-33541,
-33228,
-32756,
-32471,
-32624,
-33057,
-33478,
-33591,
-33376,
-33055,
-32909,
-33050,
-33300,
-33508,
-33478,
-33286,
-33124,
-33106,
-33298,
-33496,
-33623,
-33506,
-33332,
-33180,
-33183,
-33290,
-33368,
-33301,
-33150,
-33062,
-33192,
-33519,
-33836,
-33913,
-33710,
-33376,
-33178,
-33229,
-33454,
-33620,
-33579,
-33392,
-33204,
-33231,
-33389,
-33561,
-33551,
-33393,
-33173,
-33118,
-33179,
-33360,
-33460,
-33471,
-33415,
-33350,
-33344,
-33315,
-33271,
-33166,
-33068,
-33016,
-33005,
-33055,
-33064,
-33110,
-33117,
-33171,
-33206,
-33214,
-33155,
-33051,
-32932,
-32829,
-32780,
-32779,
-32838,
-32957,
-33089,
-33223,
-33238,
-33140,
-32890,
-32618,
-32434,
-32442,
-32677,
-32991,
-33244,
-33292,
-33089,
-32798,
-32510,
-32388,
-32369,
-32404,
-32362,
-32354,
-32360,
-32600,
-32873,
-33145,
-33095,
-32809,
-32332,
-32013,
-31988,
-32266,
-32668,
-32968,
-33018,
-32905,
-32721,
-32584,
-32544,
-32501,
-32457,
-32364,
-32321,
-32328,
-32447,
-32533,
-32578,
-32447,
-32222,
-31934,
-31776,
-31746,
-31911,
-32131,
-32340,
-32451,
-32485,
-32438,
-32404,
-32361,
-32314,
-32255,
-32174,
-32181,
-32238,
-32399,
-32554,
-32614,
-32562,
-32430,
-32314,
-32297,
-32336,
-32355,
-32271,
-32131,
-31983,
-32027,
-32164,
-32357,
-32427,
-32295,
-32146,
-32018,
-32130,
-32293,
-32440,
-32397,
-32275,
-32150,
-32226,
-32443,
-32693,
-32831,
-32783,
-32608,
-32465,
-32352,
-32379,
-32385,
-32459,
-32483,
-32550,
-32600,
-32654,
-32632,
-32576,
-32462,
-32355,
-32308,
-32284,
-32362,
-32427,
-32523,
-32618,
-32667,
-32756,
-32752,
-32766,
-32692,
-32664,
-32621,
-32642,
-32674,
-32644,
-32609,
-32538,
-32567,
-32718,
-32946,
-33131,
-33225,
-33131,
-33077,
-33028,
-33141,
-33271,
-33337,
-33278,
-33119,
-32978,
-32944,
-32998,
-33087,
-33067,
-33002,
-32867,
-32856,
-32933,
-33132,
-33275,
-33314,
-33164,
-32940,
-32760,
-32723,
-32893,
-33164,
-33440,
-33576,
-33599,
-33491,
-33416,
-33320,
-33313,
-33274,
-33273,
-33254,
-33242,
-33261,
-33267,
-33268,
-33310,
-33309,
-33387,
-33361,
-33335,
-33227,
-33150,
-33139,
-33185,
-33264,
-33288,
-33238,
-33205,
-33181,
-33271,
-33396,
-33427,
-33412,
-33240,
-33105,
-32972,
-32955,
-32968,
-33032,
-33145,
-33286,
-33476,
-33641,
-33702,
-33661,
-33513,
-33317,
-33153,
-32998,
-32851,
-32734,
-32626,
-32615,
-32705,
-32890,
-33044,
-33149,
-33024,
-32865,
-32588,
-32453,
-32419,
-32585,
-32795,
-33039,
-33157,
-33193,
-33112,
-32968,
-32833,
-32680,
-32598,
-32504,
-32483,
-32484,
-32513,
-32561,
-32564,
-32600,
-32605,
-32650,
-32689,
-32726,
-32703,
-32656,
-32545,
-32490,
-32447,
-32460,
-32463,
-32388,
-32312,
-32186,
-32202,
-32274,
-32401,
-32440,
-32347,
-32188,
-32114,
-32249,
-32519,
-32819,
-32862,
-32676,
-32377,
-32159,
-32171,
-32294,
-32385,
-32345,
-32215,
-32165,
-32268,
-32496,
-32646,
-32615,
-32426,
-32211,
-32134,
-32210,
-32321,
-32438,
-32454,
-32465,
-32498,
-32526,
-32499,
-32405,
-32244,
-32172,
-32171,
-32261,
-32351,
-32420,
-32448,
-32521,
-32627,
-32682,
-32674,
-32552,
-32410,
-32391,
-32433,
-32554,
-32579,
-32490,
-32371,
-32289,
-32391,
-32528,
-32662,
-32662,
-32602,
-32524,
-32568,
-32624,
-32678,
-32622,
-32519,
-32473,
-32560,
-32739,
-32935,
-33022,
-32963,
-32878,
-32772,
-32743,
-32722,
-32716,
-32707,
-32711,
-32761,
-32820,
-32829,
-32768,
-32635,
-32520,
-32486,
-32600,
-32772,
-32948,
-32982,
-32873,
-32706,
-32614,
-32661,
-32843,
-32983,
-33005,
-32880,
-32763,
-32735,
-32873,
-32954,
-32947,
-32756,
-32588,
-32586,
-32813,
-33079,
-33210,
-33082,
-32877,
-32776,
-32901,
-33122,
-33190,
-33021,
-32668,
-32427,
-32407,
-32661,
-32916,
-33038,
-32988,
-32859,
-32817,
-32857,
-32930,
-32939,
-32880,
-32823,
-32832,
-32898,
-32947,
-32945,
-32913,
-32875,
-32937,
-32985,
-33019,
-32950,
-32827,
-32781,
-32783,
-32944,
-33079,
-33172,
-33143,
-33042,
-32919,
-32842,
-32805,
-32836,
-32863,
-32938,
-32977,
-33023,
-33038,
-32995,
-32953,
-32862,
-32849,
-32859,
-32908,
-32982,
-33014,
-33028,
-33019,
-32988,
-33016,
-33050,
-33142,
-33215,
-33218,
-33193,
-33076,
-33008,
-32908,
-32918,
-32902,
-32913,
-32851,
-32781,
-32675,
-32660,
-32709,
-32847,
-33023,
-33130,
-33141,
-33048,
-32916,
-32803,
-32819,
-32840,
-32959,
-32971,
-33002,
-32983,
-33009,
-33057,
-33069,
-33058,
-32969,
-32919,
-32870,
-32953,
-32970,
-33017,
-32931,
-32898,
-32864,
-32917,
-32928,
-32892,
-32730,
-32584,
-32513,
-32594,
-32793,
-32980,
-33054,
-33031,
-32919,
-32835,
-32752,
-32682,
-32617,
-32556,
-32543,
-32610,
-32717,
-32804,
-32843,
-32791,
-32735,
-32659,
-32650,
-32653,
-32655,
-32698,
-32725,
-32825,
-32950,
-33040,
-33028,
-32884,
-32632,
-32405,
-32271,
-32338,
-32492,
-32662,
-32688,
-32626,
-32473,
-32441,
-32505,
-32668,
-32800,
-32826,
-32716,
-32580,
-32489,
-32513,
-32586,
-32667,
-32636,
-32575,
-32494,
-32515,
-32643,
-32842,
-32994,
-33043,
-32929,
-32763,
-32579,
-32512,
-32522,
-32609,
-32679,
-32746,
-32739,
-32756,
-32737,
-32735,
-32738,
-32677,
-32683,
-32610,
-32642,
-32635,
-32641,
-32642,
-32605,
-32562,
-32558,
-32579,
-32639,
-32719,
-32733,
-32706,
-32644,
-32582,
-32605,
-32710,
-32862,
-33008,
-33035,
-32948,
-32718,
-32515,
-32342,
-32362,
-32478,
-32695,
-32850,
-32897,
-32810,
-32655,
-32524,
-32491,
-32551,
-32694,
-32779,
-32804,
-32716,
-32544,
-32375,
-32227,
-32179,
-32231,
-32383,
-32617,
-32851,
-33041,
-33117,
-33048,
-32895,
-32704,
-32577,
-32507,
-32538,
-32584,
-32646,
-32685,
-32714,
-32747,
-32795,
-32805,
-32776,
-32661,
-32534,
-32443,
-32464,
-32544,
-32681,
-32745,
-32763,
-32721,
-32683,
-32650,
-32599,
-32474,
-32314,
-32149,
-32154,
-32302,
-32562,
-32804,
-32894,
-32873,
-32733,
-32647,
-32530,
-32546,
-32522,
-32620,
-32729,
-32920,
-33078,
-33116,
-33024,
-32783,
-32573,
-32462,
-32486,
-32664,
-32790,
-32881,
-32811,
-32708,
-32619,
-32603,
-32674,
-32717,
-32712,
-32658,
-32602,
-32652,
-32770,
-32856,
-32894,
-32814,
-32747,
-32733,
-32793,
-32845,
-32810,
-32739,
-32725,
-32882,
-33169,
-33408,
-33389,
-33145,
-32805,
-32645,
-32804,
-33101,
-33356,
-33318,
-33097,
-32853,
-32832,
-32975,
-33233,
-33332,
-33269,
-33093,
-32914,
-32808,
-32785,
-32734,
-32773,
-32811,
-32911,
-32983,
-32986,
-32924,
-32888,
-32939,
-33073,
-33165,
-33131,
-32942,
-32816,
-32815,
-33080,
-33328,
-33477,
-33274,
-32936,
-32615,
-32569,
-32768,
-33095,
-33261,
-33278,
-33100,
-33026,
-33086,
-33307,
-33462,
-33415,
-33087,
-32711,
-32501,
-32625,
-33005,
-33297,
-33363,
-33015,
-32642,
-32438,
-32593,
-32967,
-33263,
-33266,
-33045,
-32793,
-32730,
-32865,
-33044,
-33087,
-33000,
-32816,
-32734,
-32680,
-32697,
-32698,
-32791,
-32962,
-33161,
-33265,
-33108,
-32793,
-32525,
-32529,
-32805,
-33128,
-33211,
-32978,
-32649,
-32461,
-32608,
-32861,
-32992,
-32801,
-32451,
-32260,
-32389,
-32814,
-33175,
-33213,
-32914,
-32452,
-32180,
-32204,
-32449,
-32757,
-32916,
-32953,
-32858,
-32731,
-32610,
-32543,
-32518,
-32616,
-32653,
-32672,
-32501,
-32314,
-32173,
-32284,
-32568,
-32904,
-33077,
-32977,
-32704,
-32460,
-32362,
-32486,
-32626,
-32711,
-32635,
-32491,
-32358,
-32353,
-32442,
-32534,
-32561,
-32481,
-32340,
-32234,
-32214,
-32292,
-32400,
-32490,
-32537,
-32532,
-32574,
-32614,
-32674,
-32679,
-32652,
-32647,
-32671,
-32749,
-32758,
-32633,
-32440,
-32216,
-32171,
-32259,
-32436,
-32552,
-32565,
-32589,
-32652,
-32829,
-32909,
-32840,
-32573,
-32321,
-32289,
-32480,
-32761,
-32844,
-32698,
-32395,
-32283,
-32392,
-32669,
-32858,
-32806,
-32614,
-32499,
-32628,
-32879,
-33125,
-33083,
-32874,
-32575,
-32448,
-32451,
-32517,
-32506,
-32380,
-32278,
-32278,
-32421,
-32617,
-32774,
-32796,
-32777,
-32748,
-32814,
-32889,
-32958,
-32888,
-32754,
-32587,
-32516,
-32553,
-32665,
-32774,
-32790,
-32767,
-32740,
-32822,
-32974,
-33115,
-33165,
-33042,
-32897,
-32760,
-32775,
-32790,
-32817,
-32721,
-32627,
-32604,
-32649,
-32778,
-32806,
-32796,
-32759,
-32832,
-33018,
-33221,
-33283,
-33159,
-32957,
-32799,
-32863,
-32972,
-33096,
-33021,
-32888,
-32770,
-32796,
-32940,
-33127,
-33207,
-33243,
-33192,
-33208,
-33170,
-33137,
-33033,
-32969,
-33016,
-33147,
-33284,
-33316,
-33222,
-33086,
-33049,
-33117,
-33218,
-33189,
-33004,
-32762,
-32667,
-32818,
-33131,
-33400,
-33463,
-33310,
-33061,
-32953,
-33024,
-33210,
-33356,
-33303,
-33104,
-32870,
-32760,
-32828,
-33006,
-33144,
-33149,
-32997,
-32827,
-32705,
-32768,
-32890,
-33052,
-33072,
-33026,
-32924,
-32895,
-32956,
-33047,
-33130,
-33109,
-33025,
-32914,
-32874,
-32887,
-32983,
-32994,
-33014,
-32908,
-32865,
-32827,
-32846,
-32873,
-32838,
-32743,
-32605,
-32535,
-32543,
-32687,
-32833,
-32923,
-32894,
-32732,
-32559,
-32417,
-32417,
-32443,
-32526,
-32527,
-32533,
-32525,
-32585,
-32676,
-32765,
-32797,
-32745,
-32689,
-32642,
-32640,
-32657,
-32604,
-32517,
-32410,
-32376,
-32459,
-32610,
-32738,
-32732,
-32624,
-32429,
-32320,
-32267,
-32337,
-32404,
-32440,
-32421,
-32343,
-32268,
-32219,
-32214,
-32246,
-32322,
-32316,
-32287,
-32150,
-32078,
-32086,
-32241,
-32465,
-32626,
-32635,
-32525,
-32386,
-32383,
-32454,
-32584,
-32565,
-32433,
-32251,
-32198,
-32286,
-32478,
-32544,
-32501,
-32329,
-32204,
-32195,
-32231,
-32251,
-32195,
-32103,
-32119,
-32234,
-32363,
-32402,
-32316,
-32207,
-32241,
-32419,
-32631,
-32686,
-32553,
-32342,
-32307,
-32507,
-32857,
-33094,
-33086,
-32858,
-32612,
-32519,
-32580,
-32681,
-32689,
-32597,
-32522,
-32515,
-32631,
-32722,
-32787,
-32752,
-32745,
-32735,
-32741,
-32710,
-32611,
-32608,
-32665,
-32876,
-33047,
-33073,
-32949,
-32775,
-32759,
-32941,
-33220,
-33396,
-33320,
-33092,
-32850,
-32807,
-32950,
-33174,
-33288,
-33277,
-33165,
-33109,
-33141,
-33235,
-33325,
-33285,
-33194,
-33068,
-33007,
-33075,
-33178,
-33354,
-33427,
-33481,
-33359,
-33263,
-33100,
-33069,
-33091,
-33204,
-33294,
-33372,
-33368,
-33358,
-33360,
-33409,
-33490,
-33558,
-33557,
-33499,
-33395,
-33327,
-33305,
-33330,
-33358,
-33332,
-33276,
-33182,
-33196,
-33268,
-33383,
-33491,
-33444,
-33330,
-33166,
-33064,
-33103,
-33169,
-33274,
-33231,
-33152,
-32988,
-32919,
-32916,
-33019,
-33114,
-33176,
-33181,
-33150,
-33159,
-33155,
-33196,
-33146,
-33047,
-32884,
-32741,
-32722,
-32822,
-33059,
-33227,
-33302,
-33139,
-32841,
-32542,
-32428,
-32497,
-32744,
-32926,
-32954,
-32851,
-32687,
-32645,
-32721,
-32801,
-32773,
-32614,
-32400,
-32338,
-32387,
-32544,
-32593,
-32501,
-32372,
-32270,
-32382,
-32525,
-32623,
-32581,
-32430,
-32354,
-32379,
-32501,
-32541,
-32484,
-32351,
-32316,
-32426,
-32635,
-32760,
-32709,
-32498,
-32282,
-32205,
-32243,
-32379,
-32378,
-32313,
-32159,
-32073,
-32088,
-32187,
-32323,
-32372,
-32380,
-32301,
-32240,
-32223,
-32261,
-32386,
-32476,
-32547,
-32462,
-32288,
-32044,
-31871,
-31853,
-31946,
-32144,
-32254,
-32288,
-32199,
-32119,
-32125,
-32223,
-32403,
-32558,
-32622,
-32604,
-32530,
-32442,
-32419,
-32357,
-32380,
-32308,
-32275,
-32174,
-32121,
-32108,
-32179,
-32316,
-32506,
-32632,
-32698,
-32636,
-32543,
-32408,
-32336,
-32217,
-32174,
-32104,
-32134,
-32230,
-32368,
-32470,
-32471,
-32359,
-32275,
-32260,
-32452,
-32674,
-32911,
-32970,
-32925,
-32833,
-32790,
-32833,
-32905,
-32930,
-32907,
-32817,
-32736,
-32686,
-32618,
-32619,
-32578,
-32638,
-32732,
-32887,
-33028,
-33088,
-33049,
-32971,
-32902,
-32933,
-33036,
-33144,
-33122,
-33024,
-32846,
-32823,
-32945,
-33194,
-33406,
-33406,
-33268,
-33035,
-32993,
-33034,
-33211,
-33244,
-33212,
-33171,
-33249,
-33481,
-33695,
-33715,
-33506,
-33211,
-33076,
-33180,
-33415,
-33520,
-33428,
-33133,
-32968,
-32989,
-33238,
-33451,
-33484,
-33336,
-33126,
-33086,
-33206,
-33452,
-33633,
-33704,
-33665,
-33598,
-33515,
-33457,
-33376,
-33327,
-33316,
-33363,
-33405,
-33412,
-33326,
-33247,
-33193,
-33229,
-33303,
-33313,
-33306,
-33228,
-33223,
-33292,
-33390,
-33476,
-33435,
-33321,
-33151,
-33015,
-32904,
-32838,
-32751,
-32736,
-32772,
-32858,
-32964,
-33010,
-33012,
-33012,
-33064,
-33132,
-33179,
-33091,
-32922,
-32776,
-32746,
-32905,
-33005,
-33050,
-32850,
-32612,
-32476,
-32494,
-32666,
-32773,
-32725,
-32607,
-32454,
-32420,
-32442,
-32430,
-32357,
-32282,
-32276,
-32424,
-32556,
-32612,
-32454,
-32258,
-32118,
-32190,
-32353,
-32525,
-32515,
-32437,
-32314,
-32253,
-32284,
-32258,
-32233,
-32215,
-32254,
-32420,
-32496,
-32461,
-32256,
-32039,
-31971,
-32090,
-32335,
-32455,
-32441,
-32276,
-32198,
-32219,
-32360,
-32390,
-32342,
-32138,
-32049,
-32057,
-32210,
-32329,
-32361,
-32288,
-32245,
-32268,
-32356,
-32382,
-32331,
-32190,
-32113,
-32117,
-32201,
-32282,
-32266,
-32194,
-32144,
-32146,
-32215,
-32280,
-32268,
-32246,
-32206,
-32309,
-32459,
-32686,
-32798,
-32802,
-32713,
-32586,
-32555,
-32590,
-32625,
-32613,
-32470,
-32342,
-32287,
-32434,
-32655,
-32828,
-32815,
-32638,
-32446,
-32454,
-32591,
-32820,
-32848,
-32710,
-32486,
-32424,
-32576,
-32849,
-33005,
-32919,
-32652,
-32476,
-32494,
-32795,
-33063,
-33205,
-33066,
-32840,
-32695,
-32793,
-33025,
-33268,
-33298,
-33138,
-32896,
-32710,
-32747,
-32922,
-33129,
-33229,
-33182,
-33060,
-33025,
-33056,
-33191,
-33255,
-33242,
-33135,
-33080,
-33122,
-33219,
-33328,
-33280,
-33193,
-33051,
-33032,
-33102,
-33219,
-33265,
-33217,
-33090,
-32989,
-32967,
-32994,
-33095,
-33162,
-33269,
-33324,
-33410,
-33439,
-33418,
-33375,
-33257,
-33183,
-33116,
-33091,
-33097,
-33096,
-33107,
-33101,
-33134,
-33159,
-33217,
-33261,
-33254,
-33235,
-33143,
-33060,
-33009,
-33018,
-33113,
-33249,
-33389,
-33496,
-33451,
-33334,
-33098,
-32839,
-32673,
-32583,
-32674,
-32803,
-32977,
-33078,
-33121,
-33091,
-33036,
-32971,
-32918,
-32947,
-33003,
-33135,
-33223,
-33182,
-33018,
-32786,
-32650,
-32693,
-32853,
-32966,
-32908,
-32678,
-32465,
-32426,
-32646,
-32923,
-33088,
-32994,
-32782,
-32625,
-32655,
-32779,
-32841,
-32689,
-32449,
-32245,
-32308,
-32550,
-32813,
-32942,
-32819,
-32630,
-32466,
-32433,
-32496,
-32534,
-32516,
-32448,
-32428,
-32456,
-32580,
-32628,
-32645,
-32514,
-32425,
-32365,
-32454,
-32569,
-32656,
-32586,
-32436,
-32286,
-32275,
-32374,
-32498,
-32505,
-32370,
-32237,
-32186,
-32289,
-32425,
-32435,
-32353,
-32242,
-32330,
-32569,
-32838,
-32901,
-32706,
-32377,
-32223,
-32226,
-32457,
-32524,
-32454,
-32280,
-32231,
-32391,
-32705,
-32844,
-32778,
-32499,
-32276,
-32254,
-32384,
-32495,
-32509,
-32384,
-32346,
-32415,
-32612,
-32707,
-32630,
-32439,
-32259,
-32306,
-32466,
-32656,
-32709,
-32599,
-32468,
-32451,
-32559,
-32775,
-32865,
-32879,
-32741,
-32608,
-32595,
-32655,
-32817,
-32887,
-32879,
-32766,
-32644,
-32595,
-32607,
-32640,
-32632,
-32558,
-32539,
-32590,
-32795,
-32996,
-33158,
-33115,
-33004,
-32877,
-32838,
-32857,
-32932,
-32910,
-32970,
-32985,
-33098,
-33084,
-33004,
-32795,
-32671,
-32736,
-32963,
-33262,
-33344,
-33229,
-32950,
-32760,
-32741,
-32896,
-32988,
-33016,
-32885,
-32799,
-32858,
-33019,
-33204,
-33235,
-33127,
-32969,
-32868,
-32957,
-33096,
-33254,
-33266,
-33179,
-33023,
-32964,
-32964,
-33074,
-33161,
-33147,
-33075,
-32938,
-32884,
-32909,
-33002,
-33106,
-33132,
-33084,
-33016,
-32976,
-32998,
-33016,
-33001,
-32909,
-32784,
-32716,
-32713,
-32881,
-33037,
-33220,
-33232,
-33137,
-32936,
-32753,
-32706,
-32837,
-33074,
-33277,
-33265,
-33058,
-32727,
-32518,
-32558,
-32807,
-33057,
-33159,
-33042,
-32911,
-32893,
-33037,
-33174,
-33139,
-32846,
-32529,
-32374,
-32514,
-32805,
-32976,
-32962,
-32805,
-32735,
-32819,
-32934,
-32947,
-32755,
-32572,
-32543,
-32783,
-33044,
-33116,
-32882,
-32566,
-32472,
-32674,
-32993,
-33117,
-32843,
-32433,
-32140,
-32288,
-32627,
-32989,
-33025,
-32856,
-32694,
-32681,
-32789,
-32784,
-32607,
-32347,
-32262,
-32430,
-32747,
-32909,
-32865,
-32649,
-32559,
-32655,
-32817,
-32826,
-32634,
-32359,
-32328,
-32558,
-32900,
-33014,
-32791,
-32416,
-32210,
-32327,
-32697,
-32885,
-32841,
-32548,
-32304,
-32375,
-32552,
-32742,
-32663,
-32408,
-32234,
-32250,
-32486,
-32676,
-32672,
-32494,
-32351,
-32387,
-32643,
-32867,
-32963,
-32788,
-32539,
-32337,
-32311,
-32402,
-32556,
-32624,
-32680,
-32657,
-32600,
-32514,
-32377,
-32296,
-32252,
-32344,
-32453,
-32620,
-32714,
-32809,
-32848,
-32871,
-32770,
-32606,
-32380,
-32213,
-32206,
-32303,
-32443,
-32494,
-32455,
-32410,
-32454,
-32608,
-32763,
-32780,
-32642,
-32427,
-32322,
-32388,
-32581,
-32726,
-32728,
-32593,
-32454,
-32417,
-32474,
-32546,
-32532,
-32446,
-32364,
-32391,
-32513,
-32628,
-32729,
-32729,
-32724,
-32714,
-32701,
-32658,
-32577,
-32489,
-32474,
-32561,
-32702,
-32813,
-32845,
-32781,
-32716,
-32678,
-32726,
-32781,
-32818,
-32791,
-32704,
-32622,
-32539,
-32495,
-32508,
-32564,
-32674,
-32774,
-32892,
-32912,
-32945,
-32932,
-32990,
-33014,
-32994,
-32891,
-32723,
-32639,
-32636,
-32780,
-32897,
-32966,
-32882,
-32816,
-32835,
-32977,
-33184,
-33236,
-33178,
-32954,
-32862,
-32853,
-33035,
-33176,
-33255,
-33223,
-33197,
-33175,
-33222,
-33193,
-33111,
-32990,
-32928,
-32972,
-33090,
-33213,
-33253,
-33283,
-33263,
-33326,
-33356,
-33339,
-33251,
-33091,
-33013,
-33018,
-33132,
-33241,
-33320,
-33343,
-33377,
-33411,
-33478,
-33457,
-33413,
-33331,
-33280,
-33309,
-33322,
-33305,
-33227,
-33138,
-33178,
-33245,
-33394,
-33384,
-33338,
-33191,
-33194,
-33248,
-33379,
-33410,
-33302,
-33227,
-33165,
-33265,
-33337,
-33331,
-33178,
-33045,
-33036,
-33229,
-33444,
-33523,
-33373,
-33112,
-32992,
-33039,
-33287,
-33384,
-33323,
-33012,
-32728,
-32589,
-32676,
-32851,
-32982,
-32988,
-32913,
-32831,
-32843,
-32868,
-32951,
-32988,
-33030,
-33055,
-33052,
-33015,
-32931,
-32868,
-32840,
-32831,
-32808,
-32720,
-32578,
-32464,
-32443,
-32470,
-32562,
-32571,
-32513,
-32464,
-32414,
-32474,
-32529,
-32544,
-32475,
-32373,
-32325,
-32381,
-32512,
-32606,
-32659,
-32590,
-32550,
-32508,
-32529,
-32524,
-32483,
-32332,
-32192,
-32080,
-32073,
-32167,
-32313,
-32459,
-32536,
-32545,
-32415,
-32263,
-32103,
-32041,
-32145,
-32278,
-32409,
-32378,
-32217,
-32015,
-31900,
-31957,
-32116,
-32288,
-32310,
-32196,
-32061,
-31982,
-32106,
-32304,
-32483,
-32501,
-32337,
-32122,
-32020,
-32082,
-32308,
-32450,
-32425,
-32232,
-31975,
-31875,
-31920,
-32063,
-32128,
-32094,
-32022,
-32062,
-32240,
-32441,
-32503,
-32377,
-32194,
-32098,
-32212,
-32386,
-32498,
-32388,
-32213,
-32054,
-32106,
-32251,
-32357,
-32285,
-32061,
-31868,
-31849,
-32003,
-32252,
-32397,
-32446,
-32413,
-32476,
-32587,
-32762,
-32788,
-32689,
-32387,
-32176,
-32100,
-32256,
-32513,
-32632,
-32532,
-32286,
-32071,
-32127,
-32395,
-32709,
-32839,
-32757,
-32620,
-32640,
-32911,
-33188,
-33273,
-33040,
-32648,
-32417,
-32500,
-32819,
-33062,
-33115,
-32863,
-32666,
-32579,
-32710,
-32862,
-32949,
-32932,
-32941,
-33025,
-33139,
-33200,
-33120,
-33002,
-32954,
-33029,
-33186,
-33243,
-33187,
-33090,
-33072,
-33239,
-33466,
-33589,
-33581,
-33376,
-33314,
-33318,
-33524,
-33667,
-33656,
-33457,
-33201,
-33026,
-33070,
-33257,
-33499,
-33677,
-33722,
-33675,
-33577,
-33496,
-33437,
-33477,
-33516,
-33606,
-33593,
-33556,
-33477,
-33442,
-33508,
-33606,
-33674,
-33659,
-33504,
-33395,
-33334,
-33431,
-33593,
-33702,
-33682,
-33554,
-33416,
-33334,
-33379,
-33463,
-33550,
-33596,
-33570,
-33539,
-33465,
-33413,
-33334,
-33312,
-33319,
-33370,
-33395,
-33353,
-33228,
-33134,
-33089,
-33145,
-33267,
-33314,
-33271,
-33138,
-32989,
-32875,
-32891,
-32889,
-32935,
-32915,
-32930,
-32955,
-33055,
-33120,
-33118,
-33025,
-32828,
-32671,
-32579,
-32627,
-32731,
-32857,
-32842,
-32774,
-32617,
-32528,
-32507,
-32594,
-32676,
-32709,
-32639,
-32480,
-32380,
-32342,
-32455,
-32569,
-32650,
-32572,
-32427,
-32273,
-32232,
-32290,
-32393,
-32430,
-32419,
-32395,
-32465,
-32568,
-32628,
-32545,
-32373,
-32279,
-32340,
-32542,
-32659,
-32524,
-32167,
-31797,
-31738,
-32012,
-32451,
-32722,
-32627,
-32307,
-32026,
-32006,
-32248,
-32516,
-32572,
-32439,
-32163,
-32070,
-32102,
-32263,
-32400,
-32408,
-32337,
-32280,
-32242,
-32265,
-32269,
-32260,
-32301,
-32362,
-32491,
-32567,
-32566,
-32446,
-32298,
-32166,
-32156,
-32223,
-32338,
-32395,
-32408,
-32325,
-32351,
-32375,
-32497,
-32548,
-32490,
-32366,
-32214,
-32247,
-32370,
-32571,
-32679,
-32624,
-32503,
-32388,
-32399,
-32508,
-32599,
-32608,
-32553,
-32470,
-32501,
-32561,
-32653,
-32662,
-32588,
-32514,
-32463,
-32485,
-32543,
-32559,
-32582,
-32568,
-32599,
-32617,
-32632,
-32587,
-32511,
-32481,
-32487,
-32640,
-32763,
-32901,
-32854,
-32759,
-32604,
-32564,
-32670,
-32871,
-33098,
-33163,
-33111,
-32906,
-32757,
-32694,
-32757,
-32901,
-32961,
-32988,
-32895,
-32826,
-32793,
-32830,
-32900,
-32962,
-32961,
-32904,
-32811,
-32751,
-32729,
-32816,
-32895,
-33010,
-33027,
-33024,
-33026,
-33051,
-33172,
-33277,
-33340,
-33261,
-33093,
-32898,
-32791,
-32828,
-32987,
-33163,
-33249,
-33201,
-33058,
-32957,
-32946,
-33078,
-33256,
-33349,
-33332,
-33172,
-33013,
-32913,
-32903,
-32965,
-32974,
-32941,
-32858,
-32824,
-32863,
-32998,
-33110,
-33190,
-33207,
-33171,
-33150,
-33098,
-33047,
-32984,
-32967,
-32997,
-33081,
-33111,
-33066,
-32914,
-32813,
-32799,
-32943,
-33115,
-33211,
-33178,
-33038,
-32954,
-32907,
-32928,
-32895,
-32796,
-32704,
-32707,
-32850,
-33046,
-33132,
-33014,
-32793,
-32526,
-32485,
-32525,
-32721,
-32820,
-32881,
-32834,
-32810,
-32806,
-32782,
-32748,
-32644,
-32566,
-32510,
-32525,
-32553,
-32605,
-32607,
-32644,
-32664,
-32716,
-32711,
-32727,
-32676,
-32681,
-32661,
-32654,
-32621,
-32583,
-32582,
-32636,
-32706,
-32743,
-32672,
-32562,
-32452,
-32455,
-32545,
-32626,
-32643,
-32575,
-32547,
-32631,
-32814,
-32990,
-32978,
-32802,
-32529,
-32393,
-32461,
-32653,
-32811,
-32785,
-32633,
-32486,
-32478,
-32645,
-32816,
-32926,
-32861,
-32732,
-32613,
-32617,
-32661,
-32763,
-32800,
-32788,
-32734,
-32658,
-32579,
-32563,
-32599,
-32703,
-32839,
-32930,
-32953,
-32903,
-32872,
-32871,
-32928,
-32971,
-32942,
-32834,
-32712,
-32653,
-32688,
-32777,
-32824,
-32828,
-32769,
-32773,
-32806,
-32957,
-33015,
-33046,
-32925,
-32804,
-32716,
-32771,
-32878,
-33054,
-33091,
-33052,
-32928,
-32825,
-32830,
-32931,
-33041,
-33106,
-33047,
-32954,
-32877,
-32868,
-32951,
-33015,
-33031,
-33007,
-32913,
-32866,
-32823,
-32800,
-32815,
-32799,
-32867,
-32902,
-32944,
-32918,
-32856,
-32838,
-32839,
-32892,
-32884,
-32823,
-32673,
-32622,
-32694,
-32912,
-33131,
-33200,
-33057,
-32847,
-32648,
-32645,
-32719,
-32841,
-32855,
-32841,
-32828,
-32903,
-33012,
-33033,
-32960,
-32797,
-32664,
-32624,
-32679,
-32694,
-32690,
-32602,
-32577,
-32619,
-32726,
-32775,
-32758,
-32649,
-32563,
-32551,
-32622,
-32711,
-32765,
-32744,
-32709,
-32679,
-32666,
-32636,
-32615,
-32568,
-32571,
-32558,
-32545,
-32470,
-32398,
-32371,
-32462,
-32591,
-32702,
-32669,
-32527,
-32403,
-32388,
-32546,
-32707,
-32789,
-32622,
-32404,
-32198,
-32193,
-32307,
-32438,
-32449,
-32343,
-32174,
-32114,
-32119,
-32244,
-32360,
-32442,
-32488,
-32535,
-32513,
-32497,
-32380,
-32303,
-32258,
-32279,
-32346,
-32342,
-32280,
-32176,
-32104,
-32148,
-32286,
-32420,
-32528,
-32530,
-32457,
-32405,
-32346,
-32365,
-32341,
-32308,
-32203,
-32109,
-32042,
-32051,
-32136,
-32213,
-32300,
-32273,
-32252,
-32205,
-32247,
-32305,
-32405,
-32426,
-32399,
-32320,
-32262,
-32279,
-32329,
-32392,
-32358,
-32248,
-32100,
-31987,
-32050,
-32175,
-32425,
-32562,
-32632,
-32553,
-32437,
-32328,
-32313,
-32347,
-32402,
-32408,
-32369,
-32306,
-32339,
-32421,
-32562,
-32573,
-32519,
-32357,
-32306,
-32416,
-32625,
-32841,
-32829,
-32660,
-32456,
-32393,
-32568,
-32801,
-32909,
-32779,
-32506,
-32285,
-32348,
-32579,
-32869,
-32974,
-32822,
-32565,
-32324,
-32251,
-32351,
-32537,
-32708,
-32885,
-32949,
-33024,
-32991,
-32928,
-32837,
-32809,
-32795,
-32931,
-33020,
-33082,
-33091,
-32976,
-32915,
-32862,
-32911,
-33007,
-33067,
-33099,
-33043,
-33049,
-33074,
-33176,
-33201,
-33197,
-33053,
-32992,
-32951,
-33044,
-33115,
-33127,
-33057,
-33041,
-33092,
-33316,
-33462,
-33511,
-33344,
-33144,
-33064,
-33198,
-33448,
-33634,
-33616,
-33424,
-33200,
-33122,
-33214,
-33370,
-33454,
-33405,
-33236,
-33127,
-33073,
-33181,
-33296,
-33392,
-33447,
-33428,
-33445,
-33486,
-33565,
-33654,
-33698,
-33649,
-33579,
-33491,
-33501,
-33650,
-33839,
-34002,
-33984,
-33767,
-33480,
-33262,
-33274,
-33461,
-33701,
-33827,
-33740,
-33552,
-33408,
-33379,
-33518,
-33619,
-33638,
-33510,
-33351,
-33273,
-33300,
-33447,
-33554,
-33592,
-33533,
-33417,
-33372,
-33398,
-33537,
-33726,
-33887,
-33922,
-33841,
-33664,
-33536,
-33547,
-33688,
-33859,
-33924,
-33738,
-33456,
-33175,
-33132,
-33292,
-33555,
-33661,
-33602,
-33379,
-33245,
-33258,
-33443,
-33605,
-33652,
-33546,
-33385,
-33316,
-33308,
-33395,
-33402,
-33367,
-33281,
-33188,
-33196,
-33151,
-33256,
-33296,
-33434,
-33548,
-33544,
-33496,
-33279,
-33178,
-33150,
-33272,
-33414,
-33436,
-33273,
-33058,
-32849,
-32856,
-32969,
-33108,
-33158,
-33054,
-32904,
-32822,
-32823,
-32939,
-33020,
-33025,
-32968,
-32881,
-32869,
-32962,
-33087,
-33152,
-33125,
-32967,
-32840,
-32757,
-32818,
-32940,
-33017,
-33006,
-32826,
-32637,
-32429,
-32384,
-32420,
-32494,
-32574,
-32561,
-32553,
-32534,
-32580,
-32602,
-32631,
-32523,
-32421,
-32274,
-32252,
-32305,
-32382,
-32440,
-32383,
-32295,
-32217,
-32253,
-32370,
-32514,
-32596,
-32580,
-32488,
-32400,
-32353,
-32384,
-32450,
-32503,
-32495,
-32420,
-32287,
-32135,
-32025,
-31988,
-32014,
-32089,
-32094,
-32047,
-31920,
-31824,
-31813,
-31877,
-31991,
-32061,
-32064,
-32031,
-32029,
-32073,
-32156,
-32185,
-32121,
-32028,
-31924,
-31931,
-31960,
-32042,
-32049,
-32042,
-32017,
-32028,
-32028,
-32036,
-31970,
-31932,
-31913,
-31938,
-31983,
-31994,
-31938,
-31926,
-31895,
-31964,
-32008,
-31998,
-31917,
-31845,
-31835,
-31958,
-32136,
-32269,
-32216,
-32045,
-31754,
-31635,
-31690,
-31950,
-32215,
-32321,
-32221,
-32019,
-31910,
-32020,
-32296,
-32532,
-32511,
-32235,
-31841,
-31590,
-31648,
-31933,
-32204,
-32342,
-32141,
-31946,
-31756,
-31895,
-32130,
-32436,
-32501,
-32393,
-32122,
-31949,
-31919,
-32065,
-32193,
-32219,
-32101,
-31972,
-31969,
-32132,
-32352,
-32503,
-32502,
-32439,
-32430,
-32529,
-32662,
-32677,
-32557,
-32346,
-32237,
-32257,
-32343,
-32360,
-32253,
-32165,
-32203,
-32447,
-32694,
-32817,
-32675,
-32462,
-32323,
-32386,
-32537,
-32555,
-32431,
-32208,
-32151,
-32267,
-32494,
-32573,
-32508,
-32380,
-32434,
-32719,
-33050,
-33146,
-32973,
-32600,
-32430,
-32496,
-32788,
-32903,
-32832,
-32517,
-32371,
-32444,
-32730,
-32972,
-32969,
-32792,
-32643,
-32671,
-32880,
-33034,
-33001,
-32783,
-32555,
-32479,
-32613,
-32787,
-32908,
-32877,
-32790,
-32731,
-32730,
-32762,
-32806,
-32817,
-32840,
-32890,
-32896,
-32891,
-32852,
-32866,
-32960,
-33140,
-33257,
-33274,
-33161,
-33085,
-33099,
-33271,
-33359,
-33354,
-33097,
-32863,
-32730,
-32839,
-33029,
-33157,
-33089,
-32899,
-32763,
-32809,
-32999,
-33205,
-33242,
-33157,
-33024,
-33011,
-33127,
-33274,
-33333,
-33218,
-33025,
-32862,
-32869,
-33004,
-33219,
-33343,
-33350,
-33205,
-33048,
-32949,
-33015,
-33204,
-33437,
-33563,
-33537,
-33341,
-33127,
-33008,
-33067,
-33227,
-33371,
-33363,
-33184,
-32952,
-32800,
-32855,
-33047,
-33316,
-33457,
-33467,
-33362,
-33248,
-33230,
-33258,
-33323,
-33321,
-33233,
-33112,
-33021,
-32989,
-33099,
-33199,
-33331,
-33332,
-33298,
-33176,
-33113,
-33099,
-33178,
-33286,
-33396,
-33409,
-33346,
-33208,
-33057,
-32981,
-33015,
-33124,
-33280,
-33367,
-33330,
-33220,
-33076,
-33020,
-33099,
-33226,
-33358,
-33397,
-33326,
-33236,
-33145,
-33121,
-33130,
-33126,
-33086,
-33021,
-32926,
-32906,
-32903,
-32977,
-33067,
-33128,
-33200,
-33184,
-33154,
-33094,
-33078,
-33088,
-33135,
-33158,
-33138,
-33050,
-32943,
-32856,
-32834,
-32864,
-32928,
-32980,
-33058,
-33104,
-33157,
-33189,
-33135,
-33081,
-32930,
-32854,
-32811,
-32812,
-32869,
-32869,
-32807,
-32709,
-32605,
-32610,
-32739,
-32910,
-33091,
-33105,
-33072,
-32962,
-32934,
-32944,
-32986,
-32963,
-32884,
-32816,
-32837,
-32909,
-32990,
-32930,
-32809,
-32712,
-32777,
-32995,
-33202,
-33237,
-33089,
-32880,
-32843,
-32916,
-33044,
-32956,
-32655,
-32351,
-32230,
-32430,
-32773,
-32958,
-32906,
-32706,
-32613,
-32770,
-33034,
-33170,
-33015,
-32681,
-32456,
-32493,
-32776,
-33044,
-33128,
-32984,
-32800,
-32688,
-32724,
-32767,
-32752,
-32675,
-32640,
-32729,
-32892,
-33039,
-33035,
-32946,
-32823,
-32821,
-32903,
-32992,
-33020,
-32926,
-32830,
-32799,
-32822,
-32917,
-32940,
-32883,
-32768,
-32641,
-32618,
-32657,
-32820,
-32926,
-33043,
-33050,
-33029,
-32980,
-32942,
-32913,
-32902,
-32881,
-32874,
-32887,
-32879,
-32881,
-32850,
-32842,
-32896,
-32974,
-33055,
-33004,
-32826,
-32608,
-32518,
-32661,
-32951,
-33180,
-33201,
-32952,
-32702,
-32593,
-32725,
-32961,
-33030,
-32889,
-32665,
-32563,
-32703,
-32925,
-33039,
-32915,
-32669,
-32533,
-32603,
-32826,
-32940,
-32829,
-32588,
-32394,
-32461,
-32638,
-32831,
-32776,
-32605,
-32398,
-32404,
-32586,
-32812,
-32902,
-32779,
-32587,
-32394,
-32395,
-32465,
-32600,
-32650,
-32632,
-32569,
-32498,
-32487,
-32478,
-32522,
-32537,
-32569,
-32581,
-32580,
-32580,
-32554,
-32553,
-32535,
-32537,
-32512,
-32499,
-32431,
-32364,
-32293,
-32224,
-32232,
-32199,
-32183,
-32154,
-32091,
-32125,
-32195,
-32307,
-32396,
-32360,
-32300,
-32196,
-32163,
-32172,
-32148,
-32078,
-31948,
-31903,
-31973,
-32185,
-32328,
-32328,
-32125,
-31904,
-31807,
-31986,
-32258,
-32499,
-32481,
-32259,
-32021,
-31885,
-31970,
-32149,
-32226,
-32204,
-31970,
-31828,
-31760,
-31911,
-32118,
-32307,
-32361,
-32276,
-32135,
-32025,
-31980,
-31992,
-31976,
-31970,
-31915,
-31959,
-32050,
-32182,
-32330,
-32335,
-32317,
-32239,
-32176,
-32173,
-32149,
-32179,
-32189,
-32248,
-32275,
-32281,
-32198,
-32088,
-32065,
-32135,
-32347,
-32475,
-32532,
-32378,
-32283,
-32243,
-32424,
-32592,
-32676,
-32538,
-32316,
-32132,
-32101,
-32167,
-32236,
-32231,
-32280,
-32434,
-32727,
-32996,
-33093,
-32964,
-32775,
-32686,
-32824,
-32977,
-33057,
-32859,
-32613,
-32471,
-32570,
-32806,
-32975,
-32955,
-32834,
-32785,
-32960,
-33217,
-33442,
-33373,
-33209,
-32948,
-32932,
-32965,
-33107,
-33066,
-32945,
-32825,
-32801,
-32960,
-33094,
-33206,
-33144,
-33076,
-33062,
-33200,
-33389,
-33600,
-33635,
-33585,
-33467,
-33429,
-33495,
-33655,
-33812,
-33840,
-33806,
-33631,
-33522,
-33484,
-33524,
-33615,
-33633,
-33616,
-33536,
-33526,
-33537,
-33664,
-33709,
-33735,
-33577,
-33417,
-33237,
-33201,
-33223,
-33303,
-33334,
-33296,
-33231,
-33190,
-33228,
-33327,
-33439,
-33561,
-33641,
-33732,
-33805,
-33803,
-33783,
-33639,
-33513,
-33417,
-33371,
-33391,
-33357,
-33339,
-33223,
-33196,
-33105,
-33082,
-33015,
-32989,
-33021,
-33149,
-33343,
-33461,
-33475,
-33259,
-33020,
-32805,
-32776,
-32916,
-33129,
-33308,
-33364,
-33315,
-33207,
-33112,
-33062,
-33022,
-33029,
-33016,
-33003,
-32997,
-32961,
-32928,
-32860,
-32788,
-32682,
-32617,
-32533,
-32509,
-32480,
-32490,
-32497,
-32503,
-32500,
-32475,
-32421,
-32386,
-32373,
-32489,
-32617,
-32809,
-32834,
-32757,
-32507,
-32262,
-32137,
-32172,
-32335,
-32513,
-32552,
-32494,
-32340,
-32234,
-32184,
-32196,
-32218,
-32215,
-32179,
-32158,
-32099,
-32081,
-32039,
-32005,
-32014,
-32073,
-32175,
-32297,
-32363,
-32337,
-32262,
-32136,
-32093,
-32163,
-32305,
-32529,
-32655,
-32690,
-32579,
-32408,
-32241,
-32139,
-32132,
-32182,
-32270,
-32333,
-32355,
-32321,
-32235,
-32140,
-32067,
-32043,
-32067,
-32093,
-32090,
-32020,
-31966,
-31929,
-32001,
-32115,
-32292,
-32391,
-32462,
-32450,
-32424,
-32406,
-32389,
-32365,
-32327,
-32320,
-32364,
-32523,
-32735,
-32941,
-33055,
-32996,
-32873,
-32730,
-32726,
-32848,
-33020,
-33125,
-33058,
-32876,
-32652,
-32527,
-32519,
-32634,
-32716,
-32779,
-32729,
-32681,
-32681,
-32764,
-32952,
-33125,
-33263,
-33246,
-33168,
-33022,
-32970,
-33003,
-33155,
-33287,
-33364,
-33289,
-33166,
-33015,
-33012,
-33107,
-33331,
-33486,
-33533,
-33392,
-33176,
-33032,
-33057,
-33258,
-33475,
-33528,
-33380,
-33102,
-32948,
-33136,
-33662,
-34323,
-34853,
-35032,
-34942,
-34751,
-34651,
-34725,
-34836,
-34865,
-34708,
-34349,
-33998,
-33653,
-33449,
-33278,
-33114,
-32948,
-32713,
-32571,
-32441,
-32491,
-32651,
-32887,
-33108,
-33198,
-33163,
-33052,
-33006,
-33078,
-33261,
-33448,
-33520,
-33509,
-33515,
-33623,
-33968,
-34297,
-34579,
-34582,
-34423,
-34204,
-34035,
-33993,
-33967,
-33876,
-33711,
-33451,
-33273,
-33127,
-33096,
-33004,
-32904,
-32704,
-32560,
-32428,
-32432,
-32371,
-32344,
-32128,
-31978,
-31869,
-31930,
-32122,
-32266,
-32298,
-32211,
-32081,
-32155,
-32387,
-32819,
-33131,
-33321,
-33285,
-33224,
-33195,
-33239,
-33260,
-33116,
-32849,
-32455,
-32162,
-32025,
-32059,
-32119,
-32142,
-32010,
-31803,
-31607,
-31467,
-31431,
-31396,
-31318,
-31190,
-31027,
-30931,
-30895,
-30914,
-30893,
-30867,
-30810,
-30847,
-30957,
-31158,
-31379,
-31565,
-31782,
-31977,
-32252,
-32490,
-32647,
-32715,
-32638,
-32599,
-32524,
-32528,
-32510,
-32472,
-32395,
-32304,
-32252,
-32246,
-32243,
-32193,
-32045,
-31833,
-31623,
-31479,
-31456,
-31500,
-31554,
-31549,
-31444,
-31330,
-31206,
-31202,
-31211,
-31270,
-31304,
-31335,
-31398,
-31496,
-31662,
-31856,
-32010,
-32167,
-32262,
-32367,
-32453,
-32536,
-32561,
-32564,
-32531,
-32519,
-32549,
-32600,
-32676,
-32696,
-32708,
-32642,
-32623,
-32564,
-32550,
-32489,
-32378,
-32261,
-32149,
-32137,
-32216,
-32336,
-32464,
-32512,
-32510,
-32492,
-32519,
-32600,
-32741,
-32917,
-33094,
-33237,
-33383,
-33443,
-33506,
-33491,
-33462,
-33452,
-33396,
-33380,
-33282,
-33236,
-33212,
-33264,
-33345,
-33428,
-33430,
-33402,
-33326,
-33347,
-33399,
-33515,
-33557,
-33560,
-33495,
-33509,
-33547,
-33707,
-33783,
-33859,
-33805,
-33770,
-33761,
-33853,
-33981,
-34134,
-34141,
-34105,
-33960,
-33809,
-33693,
-33604,
-33539,
-33446,
-33363,
-33237,
-33186,
-33157,
-33212,
-33270,
-33357,
-33382,
-33433,
-33434,
-33470,
-33485,
-33497,
-33495,
-33483,
-33429,
-33410,
-33372,
-33352,
-33401,
-33454,
-33551,
-33646,
-33667,
-33672,
-33567,
-33476,
-33341,
-33282,
-33230,
-33235,
-33250,
-33231,
-33235,
-33180,
-33174,
-33131,
-33114,
-33083,
-33028,
-32996,
-32957,
-32947,
-32949,
-32924,
-32900,
-32825,
-32760,
-32682,
-32629,
-32597,
-32583,
-32577,
-32577,
-32561,
-32541,
-32497,
-32460,
-32443,
-32444,
-32502,
-32539,
-32595,
-32631,
-32657,
-32728,
-32801,
-32915,
-32992,
-33050,
-33054,
-33037,
-33003,
-32981,
-32938,
-32911,
-32851,
-32798,
-32748,
-32710,
-32700,
-32688,
-32680,
-32648,
-32624,
-32583,
-32604,
-32591,
-32641,
-32634,
-32654,
-32661,
-32672,
-32748,
-32805,
-32887,
-32913,
-32909,
-32849,
-32832,
-32784,
-32822,
-32839,
-32853,
-32855,
-32807,
-32818,
-32783,
-32831,
-32826,
-32844,
-32824,
-32834,
-32828,
-32901,
-32923,
-32977,
-32946,
-32934,
-32920,
-32934,
-33008,
-33066,
-33106,
-33098,
-33025,
-32999,
-32966,
-33002,
-33037,
-33043,
-32993,
-32910,
-32835,
-32789,
-32794,
-32807,
-32792,
-32754,
-32703,
-32696,
-32724,
-32779,
-32809,
-32802,
-32770,
-32765,
-32789,
-32863,
-32911,
-32954,
-32945,
-32963,
-32987,
-33029,
-33055,
-33045,
-32997,
-32953,
-32948,
-32958,
-33020,
-33026,
-33016,
-32989,
-32943,
-32963,
-32986,
-33052,
-33103,
-33092,
-33102,
-33046,
-33047,
-33038,
-33027,
-33024,
-32963,
-32923,
-32856,
-32799,
-32754,
-32683,
-32625,
-32546,
-32501,
-32456,
-32427,
-32387,
-32316,
-32259,
-32190,
-32186,
-32186,
-32227,
-32257,
-32280,
-32315,
-32349,
-32415,
-32476,
-32532,
-32556,
-32569,
-32581,
-32555,
-32588,
-32542,
-32511,
-32403,
-32303,
-32189,
-32144,
-32085,
-32079,
-32004,
-31921,
-31812,
-31697,
-31648,
-31599,
-31599,
-31563,
-31528,
-31439,
-31403,
-31338,
-31340,
-31358,
-31396,
-31474,
-31516,
-31598,
-31600,
-31674,
-31688,
-31815,
-31883,
-32026,
-32092,
-32152,
-32166,
-32207,
-32237,
-32334,
-32408,
-32483,
-32497,
-32479,
-32436,
-32389,
-32376,
-32330,
-32322,
-32255,
-32205,
-32128,
-32062,
-32014,
-31973,
-31956,
-31931,
-31932,
-31909,
-31928,
-31905,
-31904,
-31899,
-31910,
-31988,
-32092,
-32210,
-32336,
-32435,
-32530,
-32626,
-32751,
-32856,
-32986,
-33038,
-33095,
-33103,
-33123,
-33154,
-33163,
-33189,
-33186,
-33182,
-33200,
-33189,
-33229,
-33188,
-33199,
-33136,
-33112,
-33071,
-33048,
-33022,
-32980,
-32922,
-32881,
-32857,
-32877,
-32934,
-32978,
-33009,
-33007,
-32967,
-32955,
-32961,
-32999,
-33024,
-33027,
-32995,
-32963,
-32937,
-32963,
-33002,
-33067,
-33118,
-33125,
-33144,
-33133,
-33144,
-33168,
-33190,
-33207,
-33219,
-33243,
-33270,
-33310,
-33364,
-33379,
-33406,
-33395,
-33421,
-33445,
-33487,
-33486,
-33488,
-33451,
-33430,
-33414,
-33432,
-33419,
-33424,
-33353,
-33297,
-33199,
-33140,
-33060,
-33034,
-32935,
-32909,
-32787,
-32744,
-32671,
-32644,
-32637,
-32638,
-32650,
-32651,
-32662,
-32677,
-32695,
-32750,
-32759,
-32848,
-32859,
-32968,
-33005,
-33090,
-33134,
-33194,
-33218,
-33273,
-33313,
-33356,
-33395,
-33403,
-33403,
-33372,
-33340,
-33322,
-33291,
-33293,
-33257,
-33236,
-33191,
-33117,
-33049,
-32973,
-32920,
-32902,
-32890,
-32892,
-32887,
-32879,
-32858,
-32861,
-32852,
-32877,
-32927,
-32977,
-33045,
-33087,
-33121,
-33156,
-33190,
-33230,
-33290,
-33349,
-33420,
-33492,
-33551,
-33593,
-33601,
-33613,
-33600,
-33636,
-33664,
-33727,
-33754,
-33766,
-33729,
-33679,
-33641,
-33633,
-33661,
-33706,
-33737,
-33733,
-33699,
-33652,
-33626,
-33628,
-33655,
-33688,
-33700,
-33692,
-33668,
-33658,
-33620,
-33621,
-33594,
-33601,
-33594,
-33622,
-33647,
-33647,
-33665,
-33621,
-33611,
-33592,
-33602,
-33615,
-33615,
-33599,
-33577,
-33529,
-33511,
-33464,
-33450,
-33407,
-33380,
-33352,
-33323,
-33283,
-33239,
-33139,
-33035,
-32926,
-32790,
-32724,
-32621,
-32533,
-32384,
-32228,
-32036,
-31893,
-31778,
-31691,
-31596,
-31487,
-31311,
-31185,
-31031,
-30950,
-30912,
-30867,
-30850,
-30790,
-30761,
-30722,
-30738,
-30753,
-30804,
-30832,
-30830,
-30824,
-30780,
-30746,
-30719,
-30652,
-30601,
-30499,
-30382,
-30270,
-30118,
-29993,
-29837,
-29670,
-29511,
-29326,
-29146,
-28966,
-28770,
-28629,
-28484,
-28386,
-28287,
-28190,
-28094,
-28021,
-27941,
-27911,
-27893,
-27861,
-27826,
-27793,
-27760,
-27758,
-27800,
-27863,
-27953,
-28039,
-28136,
-28247,
-28412,
-28613,
-28857,
-29124,
-29374,
-29647,
-29945,
-30241,
-30625,
-30994,
-31384,
-31748,
-32100,
-32426,
-32727,
-33023,
-33261,
-33475,
-33629,
-33761,
-33845,
-33928,
-33951,
-33947,
-33903,
-33827,
-33781,
-33735,
-33710,
-33685,
-33640,
-33588,
-33590,
-33607,
-33755,
-33931,
-34163,
-34409,
-34640,
-34919,
-35231,
-35620,
-36045,
-36477,
-36867,
-37235,
-37565,
-37911,
-38256,
-38599,
-38898,
-39131,
-39317,
-39445,
-39545,
-39635,
-39664,
-39685,
-39619,
-39514,
-39389,
-39240,
-39097,
-38955,
-38773,
-38587,
-38367,
-38157,
-37944,
-37752,
-37583,
-37404,
-37226,
-37062,
-36883,
-36738,
-36587,
-36439,
-36311,
-36176,
-36055,
-35931,
-35802,
-35686,
-35557,
-35461,
-35374,
-35315,
-35246,
-35189,
-35087,
-35003,
-34878,
-34790,
-34701,
-34615,
-34508,
-34365,
-34187,
-33994,
-33805,
-33615,
-33439,
-33220,
-32984,
-32661,
-32324,
-31965,
-31630,
-31303,
-31005,
-30672,
-30347,
-29979,
-29678,
-29377,
-29190,
-29011,
-28887,
-28744,
-28637,
-28530,
-28510,
-28551,
-28683,
-28836,
-29040,
-29206,
-29412,
-29636,
-29888,
-30206,
-30473,
-30789,
-30977,
-31226,
-31391,
-31615,
-31833,
-32053,
-32277,
-32432,
-32599,
-32712,
-32819,
-32942,
-33022,
-33125,
-33190,
-33245,
-33299,
-33320,
-33350,
-33377,
-33422,
-33495,
-33603,
-33691,
-33817,
-33868,
-33953,
-33988,
-34083,
-34211,
-34375,
-34562,
-34752,
-34898,
-35054,
-35212,
-35415,
-35653,
-35895,
-36132,
-36354,
-36517,
-36692,
-36834,
-37007,
-37161,
-37315,
-37422,
-37508,
-37538,
-37535,
-37480,
-37400,
-37276,
-37130,
-36950,
-36757,
-36529,
-36285,
-36011,
-35732,
-35454,
-35215,
-34981,
-34771,
-34547,
-34306,
-34061,
-33848,
-33645,
-33526,
-33393,
-33308,
-33196,
-33115,
-33009,
-32952,
-32898,
-32871,
-32832,
-32764,
-32682,
-32575,
-32475,
-32373,
-32272,
-32174,
-32058,
-31895,
-31753,
-31579,
-31395,
-31229,
-31018,
-30826,
-30593,
-30363,
-30137,
-29893,
-29679,
-29442,
-29240,
-28989,
-28801,
-28548,
-28350,
-28130,
-27915,
-27705,
-27489,
-27291,
-27103,
-26948,
-26813,
-26695,
-26633,
-26561,
-26547,
-26531,
-26550,
-26594,
-26661,
-26763,
-26889,
-27018,
-27190,
-27308,
-27467,
-27574,
-27713,
-27802,
-27924,
-27980,
-28026,
-28016,
-27968,
-27866,
-27780,
-27649,
-27546,
-27403,
-27238,
-27064,
-26836,
-26644,
-26422,
-26260,
-26094,
-25955,
-25835,
-25690,
-25599,
-25492,
-25449,
-25406,
-25392,
-25376,
-25353,
-25327,
-25292,
-25268,
-25236,
-25230,
-25230,
-25298,
-25369,
-25532,
-25712,
-25960,
-26266,
-26618,
-27058,
-27539,
-28114,
-28690,
-29362,
-29998,
-30705,
-31408,
-32115,
-32831,
-33492,
-34114,
-34654,
-35129,
-35520,
-35831,
-36031,
-36102,
-36059,
-35916,
-35700,
-35461,
-35198,
-34892,
-34596,
-34237,
-33911,
-33640,
-33473,
-33401,
-33475,
-33581,
-33789,
-34073,
-34431,
-34978,
-35623,
-36413,
-37249,
-38122,
-38993,
-39869,
-40735,
-41585,
-42411,
-43138,
-43796,
-44313,
-44737,
-45032,
-45205,
-45279,
-45185,
-45043,
-44777,
-44479,
-44101,
-43685,
-43175,
-42621,
-42042,
-41444,
-40911,
-40394,
-39906,
-39440,
-38935,
-38478,
-38042,
-37678,
-37417,
-37159,
-36959,
-36736,
-36535,
-36362,
-36221,
-36134,
-36078,
-36031,
-35992,
-35941,
-35918,
-35921,
-35929,
-35972,
-35952,
-35972,
-35903,
-35851,
-35749,
-35605,
-35423,
-35134,
-34827,
-34430,
-34013,
-33536,
-32979,
-32385,
-31703,
-30990,
-30249,
-29495,
-28761,
-28007,
-27270,
-26550,
-25877,
-25281,
-24786,
-24386,
-24106,
-23900,
-23804,
-23784,
-23883,
-24066,
-24379,
-24723,
-25151,
-25599,
-26061,
-26571,
-27077,
-27572,
-28092,
-28535,
-28974,
-29357,
-29689,
-29954,
-30165,
-30300,
-30388,
-30446,
-30457,
-30497,
-30490,
-30477,
-30460,
-30409,
-30410,
-30443,
-30504,
-30638,
-30758,
-30930,
-31090,
-31293,
-31534,
-31810,
-32135,
-32475,
-32844,
-33194,
-33564,
-33938,
-34310,
-34719,
-35091,
-35478,
-35843,
-36196,
-36547,
-36894,
-37235,
-37553,
-37871,
-38143,
-38413,
-38661,
-38917,
-39132,
-39335,
-39495,
-39616,
-39683,
-39758,
-39765,
-39791,
-39771,
-39686,
-39586,
-39416,
-39233,
-39062,
-38855,
-38705,
-38506,
-38331,
-38146,
-37970,
-37831,
-37703,
-37609,
-37516,
-37461,
-37384,
-37355,
-37302,
-37293,
-37249,
-37222,
-37151,
-37106,
-37003,
-36946,
-36830,
-36699,
-36511,
-36262,
-35982,
-35684,
-35381,
-35093,
-34805,
-34494,
-34194,
-33852,
-33554,
-33278,
-33052,
-32864,
-32701,
-32532,
-32392,
-32228,
-32130,
-32022,
-31975,
-31929,
-31891,
-31865,
-31818,
-31775,
-31716,
-31648,
-31545,
-31467,
-31350,
-31259,
-31134,
-31028,
-30895,
-30798,
-30690,
-30634,
-30585,
-30599,
-30609,
-30652,
-30678,
-30728,
-30771,
-30848,
-30942,
-31050,
-31154,
-31267,
-31318,
-31406,
-31427,
-31488,
-31522,
-31537,
-31548,
-31489,
-31435,
-31331,
-31244,
-31122,
-31055,
-30939,
-30864,
-30771,
-30688,
-30622,
-30556,
-30485,
-30430,
-30363,
-30308,
-30246,
-30180,
-30096,
-30004,
-29890,
-29770,
-29633,
-29507,
-29350,
-29213,
-29056,
-28899,
-28745,
-28578,
-28432,
-28317,
-28212,
-28171,
-28123,
-28101,
-28103,
-28084,
-28125,
-28150,
-28220,
-28283,
-28356,
-28388,
-28433,
-28429,
-28437,
-28417,
-28368,
-28317,
-28205,
-28088,
-27915,
-27722,
-27516,
-27263,
-27020,
-26732,
-26457,
-26167,
-25894,
-25613,
-25341,
-25074,
-24785,
-24543,
-24289,
-24097,
-23931,
-23815,
-23713,
-23687,
-23695,
-23792,
-24021,
-24303,
-24749,
-25215,
-25787,
-26418,
-27122,
-27926,
-28779,
-29683,
-30586,
-31480,
-32363,
-33192,
-34027,
-34773,
-35475,
-36022,
-36468,
-36761,
-36961,
-37041,
-37027,
-36875,
-36648,
-36249,
-35856,
-35375,
-34928,
-34529,
-34107,
-33795,
-33460,
-33259,
-33142,
-33154,
-33346,
-33602,
-34036,
-34517,
-35143,
-35827,
-36644,
-37500,
-38424,
-39327,
-40204,
-41074,
-41855,
-42624,
-43258,
-43806,
-44165,
-44426,
-44508,
-44502,
-44375,
-44128,
-43766,
-43301,
-42723,
-42119,
-41469,
-40837,
-40193,
-39554,
-38909,
-38285,
-37682,
-37151,
-36648,
-36253,
-35859,
-35573,
-35301,
-35140,
-35002,
-34936,
-34889,
-34873,
-34864,
-34904,
-34939,
-35025,
-35066,
-35123,
-35110,
-35125,
-35102,
-35096,
-35085,
-35034,
-34934,
-34800,
-34567,
-34321,
-34003,
-33649,
-33232,
-32759,
-32238,
-31647,
-31055,
-30426,
-29807,
-29169,
-28531,
-27912,
-27314,
-26767,
-26278,
-25810,
-25425,
-25067,
-24806,
-24658,
-24579,
-24646,
-24771,
-24989,
-25240,
-25586,
-25949,
-26409,
-26865,
-27364,
-27838,
-28285,
-28713,
-29102,
-29496,
-29852,
-30173,
-30459,
-30668,
-30889,
-31023,
-31165,
-31283,
-31350,
-31432,
-31503,
-31568,
-31691,
-31811,
-31999,
-32180,
-32427,
-32671,
-32980,
-33312,
-33657,
-34058,
-34423,
-34834,
-35212,
-35602,
-36004,
-36366,
-36758,
-37088,
-37411,
-37715,
-37962,
-38230,
-38441,
-38646,
-38815,
-38972,
-39073,
-39194,
-39256,
-39333,
-39374,
-39417,
-39412,
-39414,
-39355,
-39281,
-39187,
-39060,
-38935,
-38771,
-38579,
-38359,
-38101,
-37824,
-37529,
-37243,
-36934,
-36663,
-36359,
-36088,
-35814,
-35559,
-35360,
-35155,
-35033,
-34887,
-34807,
-34716,
-34658,
-34619,
-34564,
-34530,
-34458,
-34397,
-34310,
-34219,
-34097,
-33958,
-33760,
-33517,
-33242,
-32943,
-32632,
-32333,
-31986,
-31650,
-31263,
-30906,
-30552,
-30264,
-30012,
-29840,
-29678,
-29574,
-29501,
-29467,
-29515,
-29599,
-29753,
-29922,
-30120,
-30314,
-30516,
-30750,
-30964,
-31227,
-31434,
-31676,
-31862,
-32035,
-32218,
-32326,
-32457,
-32517,
-32552,
-32577,
-32591,
-32619,
-32644,
-32669,
-32697,
-32714,
-32758,
-32815,
-32923,
-33007,
-33129,
-33194,
-33282,
-33336,
-33412,
-33487,
-33601,
-33673,
-33767,
-33822,
-33869,
-33936,
-33973,
-34047,
-34060,
-34095,
-34072,
-34076,
-34056,
-34058,
-34074,
-34066,
-34070,
-34044,
-34027,
-33993,
-33924,
-33835,
-33682,
-33480,
-33244,
-32941,
-32612,
-32252,
-31847,
-31408,
-30920,
-30434,
-29892,
-29399,
-28856,
-28344,
-27821,
-27351,
-26887,
-26505,
-26200,
-25927,
-25795,
-25664,
-25646,
-25670,
-25733,
-25883,
-26027,
-26216,
-26412,
-26589,
-26748,
-26909,
-27016,
-27128,
-27183,
-27203,
-27167,
-27086,
-26904,
-26706,
-26418,
-26104,
-25759,
-25348,
-24962,
-24532,
-24108,
-23681,
-23276,
-22896,
-22556,
-22270,
-21993,
-21808,
-21623,
-21524,
-21477,
-21504,
-21662,
-21882,
-22304,
-22802,
-23478,
-24245,
-25127,
-26104,
-27185,
-28369,
-29623,
-30961,
-32273,
-33595,
-34827,
-36002,
-37128,
-38138,
-39085,
-39896,
-40537,
-41026,
-41289,
-41380,
-41323,
-41059,
-40727,
-40193,
-39655,
-38999,
-38382,
-37770,
-37221,
-36747,
-36382,
-36103,
-36022,
-36067,
-36324,
-36758,
-37329,
-38071,
-38902,
-39860,
-40920,
-42055,
-43219,
-44398,
-45492,
-46507,
-47383,
-48101,
-48647,
-48992,
-49140,
-49056,
-48788,
-48321,
-47701,
-46922,
-45999,
-44948,
-43785,
-42587,
-41331,
-40154,
-38965,
-37889,
-36827,
-35897,
-35014,
-34293,
-33673,
-33183,
-32824,
-32549,
-32383,
-32290,
-32274,
-32313,
-32406,
-32499,
-32621,
-32743,
-32857,
-32996,
-33096,
-33151,
-33168,
-33070,
-32974,
-32767,
-32598,
-32309,
-32031,
-31637,
-31187,
-30656,
-30074,
-29428,
-28780,
-28068,
-27365,
-26626,
-25888,
-25192,
-24516,
-23919,
-23385,
-22929,
-22597,
-22341,
-22253,
-22255,
-22410,
-22660,
-23029,
-23517,
-24109,
-24785,
-25564,
-26351,
-27194,
-27989,
-28791,
-29508,
-30212,
-30800,
-31343,
-31715,
-32031,
-32156,
-32244,
-32188,
-32070,
-31902,
-31670,
-31408,
-31173,
-30913,
-30745,
-30601,
-30558,
-30586,
-30716,
-30940,
-31297,
-31743,
-32312,
-32942,
-33662,
-34416,
-35214,
-36018,
-36821,
-37583,
-38320,
-38966,
-39540,
-40030,
-40416,
-40718,
-40891,
-40999,
-40972,
-40890,
-40700,
-40477,
-40166,
-39838,
-39441,
-39035,
-38602,
-38171,
-37734,
-37334,
-36923,
-36542,
-36162,
-35800,
-35459,
-35117,
-34822,
-34523,
-34270,
-34017,
-33784,
-33575,
-33373,
-33223,
-33072,
-32975,
-32890,
-32837,
-32813,
-32793,
-32780,
-32762,
-32764,
-32718,
-32703,
-32628,
-32525,
-32411,
-32209,
-31992,
-31699,
-31406,
-31022,
-30671,
-30228,
-29798,
-29331,
-28852,
-28379,
-27970,
-27568,
-27299,
-27081,
-26963,
-26945,
-26993,
-27154,
-27379,
-27720,
-28137,
-28649,
-29198,
-29807,
-30412,
-31050,
-31674,
-32294,
-32904,
-33458,
-33990,
-34404,
-34756,
-35000,
-35150,
-35238,
-35239,
-35238,
-35145,
-35086,
-34948,
-34847,
-34682,
-34564,
-34422,
-34331,
-34278,
-34254,
-34284,
-34371,
-34452,
-34657,
-34838,
-35119,
-35419,
-35766,
-36116,
-36481,
-36818,
-37157,
-37438,
-37731,
-37969,
-38201,
-38412,
-38551,
-38700,
-38751,
-38786,
-38766,
-38670,
-38555,
-38349,
-38113,
-37816,
-37463,
-37090,
-36652,
-36197,
-35729,
-35217,
-34724,
-34206,
-33694,
-33187,
-32703,
-32208,
-31786,
-31357,
-30994,
-30675,
-30399,
-30165,
-29964,
-29809,
-29673,
-29588,
-29475,
-29411,
-29287,
-29180,
-29003,
-28828,
-28588,
-28339,
-28046,
-27727,
-27367,
-26958,
-26512,
-26047,
-25545,
-25074,
-24573,
-24163,
-23746,
-23434,
-23139,
-22933,
-22793,
-22729,
-22766,
-22882,
-23086,
-23353,
-23635,
-23961,
-24259,
-24607,
-24923,
-25276,
-25619,
-25942,
-26243,
-26480,
-26657,
-26774,
-26844,
-26850,
-26850,
-26791,
-26694,
-26577,
-26363,
-26167,
-25926,
-25724,
-25567,
-25452,
-25397,
-25333,
-25331,
-25288,
-25306,
-25363,
-25528,
-25783,
-26203,
-26696,
-27379,
-28101,
-28980,
-29950,
-31018,
-32218,
-33486,
-34820,
-36145,
-37484,
-38659,
-39802,
-40764,
-41629,
-42378,
-42999,
-43476,
-43787,
-43876,
-43730,
-43365,
-42751,
-42014,
-41111,
-40182,
-39210,
-38253,
-37332,
-36432,
-35631,
-34921,
-34367,
-34035,
-33886,
-34012,
-34312,
-34814,
-35450,
-36228,
-37086,
-38083,
-39160,
-40309,
-41496,
-42634,
-43653,
-44505,
-45114,
-45499,
-45656,
-45612,
-45399,
-45036,
-44475,
-43763,
-42815,
-41707,
-40438,
-39064,
-37650,
-36251,
-34907,
-33658,
-32482,
-31430,
-30454,
-29630,
-28938,
-28430,
-28105,
-27946,
-27960,
-28064,
-28281,
-28546,
-28882,
-29281,
-29748,
-30301,
-30903,
-31562,
-32160,
-32734,
-33175,
-33533,
-33752,
-33918,
-33972,
-33999,
-33911,
-33740,
-33464,
-33025,
-32501,
-31830,
-31109,
-30322,
-29527,
-28712,
-27908,
-27102,
-26338,
-25616,
-24995,
-24502,
-24161,
-24009,
-24034,
-24210,
-24568,
-25022,
-25651,
-26364,
-27218,
-28154,
-29193,
-30248,
-31325,
-32354,
-33302,
-34174,
-34904,
-35534,
-36025,
-36364,
-36581,
-36597,
-36493,
-36217,
-35799,
-35313,
-34732,
-34151,
-33578,
-33037,
-32571,
-32174,
-31862,
-31641,
-31540,
-31558,
-31717,
-32015,
-32454,
-33007,
-33669,
-34399,
-35181,
-35988,
-36783,
-37604,
-38336,
-39057,
-39665,
-40177,
-40561,
-40826,
-40939,
-40959,
-40855,
-40668,
-40383,
-40009,
-39549,
-38987,
-38381,
-37703,
-37020,
-36325,
-35660,
-35017,
-34409,
-33850,
-33309,
-32826,
-32365,
-31992,
-31648,
-31392,
-31190,
-31033,
-30941,
-30867,
-30860,
-30868,
-30966,
-31081,
-31274,
-31487,
-31724,
-31966,
-32165,
-32390,
-32549,
-32725,
-32841,
-32941,
-32975,
-32967,
-32879,
-32733,
-32535,
-32279,
-32016,
-31694,
-31372,
-30995,
-30601,
-30199,
-29773,
-29410,
-29100,
-28873,
-28763,
-28776,
-28864,
-29103,
-29413,
-29825,
-30358,
-30931,
-31638,
-32364,
-33141,
-33932,
-34706,
-35472,
-36218,
-36906,
-37562,
-38116,
-38596,
-38930,
-39163,
-39239,
-39186,
-39043,
-38799,
-38521,
-38180,
-37831,
-37461,
-37093,
-36736,
-36400,
-36086,
-35841,
-35623,
-35487,
-35425,
-35395,
-35484,
-35602,
-35809,
-36070,
-36361,
-36710,
-37028,
-37373,
-37656,
-37923,
-38131,
-38290,
-38380,
-38409,
-38373,
-38285,
-38131,
-37921,
-37642,
-37306,
-36902,
-36451,
-35925,
-35376,
-34742,
-34120,
-33424,
-32720,
-32014,
-31275,
-30570,
-29849,
-29170,
-28529,
-27921,
-27401,
-26905,
-26512,
-26158,
-25888,
-25689,
-25552,
-25499,
-25507,
-25581,
-25719,
-25879,
-26077,
-26250,
-26408,
-26531,
-26578,
-26600,
-26539,
-26428,
-26242,
-25993,
-25652,
-25306,
-24831,
-24413,
-23908,
-23437,
-22975,
-22524,
-22135,
-21778,
-21503,
-21325,
-21214,
-21269,
-21405,
-21665,
-22021,
-22449,
-22910,
-23425,
-23933,
-24488,
-25044,
-25612,
-26166,
-26692,
-27182,
-27644,
-28032,
-28411,
-28704,
-28978,
-29169,
-29329,
-29380,
-29406,
-29317,
-29211,
-29071,
-28910,
-28795,
-28679,
-28568,
-28455,
-28299,
-28171,
-28050,
-28004,
-28008,
-28141,
-28378,
-28757,
-29290,
-29933,
-30789,
-31746,
-32911,
-34181,
-35573,
-37028,
-38453,
-39800,
-41027,
-42113,
-43064,
-43848,
-44488,
-44942,
-45208,
-45250,
-45034,
-44594,
-43869,
-42957,
-41857,
-40653,
-39394,
-38118,
-36877,
-35679,
-34608,
-33668,
-32940,
-32436,
-32156,
-32149,
-32324,
-32743,
-33281,
-34020,
-34851,
-35827,
-36904,
-38035,
-39220,
-40348,
-41365,
-42229,
-42842,
-43239,
-43381,
-43324,
-43108,
-42693,
-42180,
-41446,
-40601,
-39581,
-38440,
-37186,
-35898,
-34567,
-33312,
-32103,
-31017,
-30037,
-29192,
-28482,
-27930,
-27549,
-27335,
-27266,
-27364,
-27547,
-27831,
-28178,
-28612,
-29125,
-29746,
-30438,
-31197,
-31996,
-32761,
-33511,
-34111,
-34644,
-34986,
-35252,
-35390,
-35425,
-35391,
-35193,
-34879,
-34404,
-33802,
-33050,
-32229,
-31343,
-30409,
-29506,
-28596,
-27749,
-26982,
-26302,
-25767,
-25376,
-25153,
-25139,
-25279,
-25650,
-26135,
-26801,
-27539,
-28422,
-29344,
-30350,
-31379,
-32361,
-33338,
-34171,
-34942,
-35544,
-36057,
-36400,
-36634,
-36721,
-36667,
-36516,
-36191,
-35815,
-35265,
-34709,
-34066,
-33481,
-32926,
-32485,
-32107,
-31848,
-31663,
-31576,
-31595,
-31695,
-31934,
-32229,
-32667,
-33156,
-33749,
-34380,
-35060,
-35752,
-36448,
-37102,
-37712,
-38257,
-38718,
-39060,
-39297,
-39393,
-39386,
-39271,
-39062,
-38782,
-38427,
-37962,
-37434,
-36788,
-36086,
-35323,
-34537,
-33757,
-33002,
-32297,
-31656,
-31083,
-30598,
-30155,
-29806,
-29539,
-29340,
-29262,
-29250,
-29351,
-29502,
-29750,
-30022,
-30350,
-30730,
-31103,
-31523,
-31918,
-32279,
-32613,
-32868,
-33070,
-33211,
-33268,
-33304,
-33206,
-33135,
-32906,
-32716,
-32401,
-32099,
-31754,
-31443,
-31128,
-30900,
-30676,
-30524,
-30387,
-30298,
-30262,
-30295,
-30405,
-30615,
-30919,
-31312,
-31832,
-32401,
-33073,
-33777,
-34502,
-35258,
-35986,
-36726,
-37411,
-38063,
-38626,
-39153,
-39599,
-39984,
-40310,
-40552,
-40706,
-40757,
-40697,
-40528,
-40283,
-39940,
-39572,
-39172,
-38784,
-38445,
-38116,
-37862,
-37608,
-37413,
-37268,
-37147,
-37090,
-37083,
-37104,
-37181,
-37313,
-37459,
-37667,
-37877,
-38090,
-38301,
-38480,
-38610,
-38696,
-38689,
-38636,
-38469,
-38258,
-37975,
-37613,
-37224,
-36734,
-36227,
-35641,
-35032,
-34370,
-33656,
-32927,
-32134,
-31380,
-30590,
-29840,
-29097,
-28395,
-27712,
-27119,
-26558,
-26093,
-25672,
-25331,
-25069,
-24871,
-24753,
-24691,
-24673,
-24703,
-24759,
-24863,
-25012,
-25168,
-25361,
-25504,
-25653,
-25717,
-25787,
-25745,
-25675,
-25497,
-25268,
-25000,
-24656,
-24325,
-23908,
-23530,
-23124,
-22756,
-22461,
-22184,
-22013,
-21854,
-21782,
-21757,
-21817,
-21989,
-22223,
-22599,
-23019,
-23576,
-24149,
-24810,
-25438,
-26112,
-26715,
-27337,
-27897,
-28456,
-28941,
-29402,
-29750,
-30075,
-30317,
-30529,
-30698,
-30822,
-30884,
-30902,
-30849,
-30744,
-30602,
-30424,
-30256,
-30072,
-29914,
-29793,
-29701,
-29655,
-29580,
-29527,
-29462,
-29446,
-29510,
-29681,
-29960,
-30351,
-30856,
-31491,
-32342,
-33327,
-34536,
-35814,
-37202,
-38608,
-39974,
-41284,
-42415,
-43324,
-44002,
-44431,
-44690,
-44772,
-44673,
-44351,
-43770,
-42985,
-41981,
-40865,
-39599,
-38252,
-36829,
-35402,
-34073,
-32879,
-31867,
-31076,
-30458,
-30130,
-30053,
-30247,
-30699,
-31274,
-32001,
-32771,
-33686,
-34666,
-35789,
-36923,
-38085,
-39155,
-40127,
-40937,
-41530,
-41906,
-42009,
-41893,
-41588,
-41113,
-40534,
-39805,
-38958,
-37967,
-36832,
-35643,
-34364,
-33114,
-31884,
-30691,
-29612,
-28616,
-27795,
-27154,
-26698,
-26467,
-26366,
-26457,
-26683,
-27038,
-27540,
-28099,
-28786,
-29523,
-30379,
-31341,
-32353,
-33416,
-34367,
-35216,
-35904,
-36424,
-36820,
-37024,
-37111,
-36991,
-36765,
-36384,
-35888,
-35240,
-34457,
-33501,
-32468,
-31383,
-30286,
-29261,
-28247,
-27332,
-26519,
-25859,
-25391,
-25147,
-25084,
-25231,
-25535,
-25999,
-26652,
-27410,
-28301,
-29259,
-30258,
-31334,
-32354,
-33410,
-34323,
-35152,
-35821,
-36342,
-36733,
-36988,
-37161,
-37169,
-37087,
-36843,
-36505,
-36034,
-35517,
-34914,
-34322,
-33731,
-33173,
-32726,
-32336,
-32081,
-31898,
-31843,
-31859,
-31985,
-32221,
-32551,
-32972,
-33466,
-34032,
-34654,
-35342,
-36063,
-36811,
-37534,
-38204,
-38790,
-39254,
-39630,
-39845,
-39955,
-39899,
-39777,
-39500,
-39190,
-38757,
-38261,
-37643,
-36999,
-36226,
-35498,
-34669,
-33919,
-33127,
-32461,
-31805,
-31310,
-30865,
-30549,
-30309,
-30152,
-30109,
-30140,
-30260,
-30447,
-30706,
-31006,
-31371,
-31759,
-32170,
-32570,
-32956,
-33272,
-33602,
-33818,
-34025,
-34120,
-34131,
-34083,
-33945,
-33772,
-33537,
-33259,
-32927,
-32568,
-32212,
-31844,
-31546,
-31236,
-31031,
-30862,
-30810,
-30826,
-30935,
-31089,
-31309,
-31587,
-31920,
-32358,
-32850,
-33412,
-34007,
-34631,
-35263,
-35919,
-36529,
-37099,
-37593,
-38010,
-38364,
-38634,
-38844,
-38939,
-38978,
-38923,
-38834,
-38686,
-38512,
-38262,
-37957,
-37590,
-37190,
-36793,
-36398,
-36045,
-35710,
-35452,
-35259,
-35144,
-35106,
-35082,
-35140,
-35168,
-35270,
-35364,
-35505,
-35627,
-35769,
-35871,
-35967,
-36069,
-36118,
-36159,
-36120,
-36026,
-35848,
-35623,
-35287,
-34944,
-34467,
-33998,
-33478,
-32926,
-32411,
-31854,
-31327,
-30812,
-30258,
-29768,
-29218,
-28752,
-28265,
-27811,
-27384,
-26995,
-26664,
-26368,
-26175,
-25990,
-25925,
-25850,
-25876,
-25904,
-26012,
-26119,
-26277,
-26425,
-26595,
-26767,
-26955,
-27145,
-27328,
-27505,
-27620,
-27718,
-27746,
-27728,
-27654,
-27527,
-27320,
-27056,
-26754,
-26400,
-26090,
-25771,
-25482,
-25233,
-25004,
-24879,
-24804,
-24859,
-24932,
-25116,
-25299,
-25588,
-25932,
-26372,
-26860,
-27387,
-27920,
-28481,
-29039,
-29621,
-30161,
-30650,
-31031,
-31351,
-31619,
-31845,
-32050,
-32151,
-32202,
-32176,
-32108,
-32045,
-31926,
-31776,
-31548,
-31285,
-31014,
-30737,
-30521,
-30267,
-30025,
-29789,
-29535,
-29375,
-29189,
-29073,
-28899,
-28735,
-28596,
-28485,
-28547,
-28650,
-28954,
-29352,
-29894,
-30626,
-31510,
-32611,
-33836,
-35138,
-36456,
-37701,
-38873,
-39936,
-40811,
-41468,
-41858,
-41964,
-41895,
-41628,
-41251,
-40673,
-39897,
-38917,
-37783,
-36625,
-35437,
-34282,
-33134,
-32015,
-31052,
-30294,
-29845,
-29652,
-29677,
-29888,
-30256,
-30884,
-31665,
-32623,
-33554,
-34532,
-35438,
-36461,
-37512,
-38618,
-39616,
-40453,
-41083,
-41558,
-41878,
-42037,
-41997,
-41728,
-41268,
-40679,
-40032,
-39318,
-38479,
-37523,
-36402,
-35252,
-34085,
-32996,
-31943,
-30977,
-30069,
-29306,
-28729,
-28334,
-28177,
-28154,
-28314,
-28572,
-28990,
-29515,
-30196,
-30957,
-31798,
-32674,
-33584,
-34501,
-35392,
-36204,
-36860,
-37304,
-37510,
-37514,
-37358,
-37045,
-36612,
-36016,
-35245,
-34405,
-33457,
-32471,
-31447,
-30336,
-29214,
-28082,
-27067,
-26185,
-25463,
-24883,
-24404,
-24131,
-24001,
-24176,
-24499,
-25023,
-25617,
-26303,
-27105,
-27972,
-28956,
-29890,
-30861,
-31712,
-32549,
-33297,
-33992,
-34560,
-34989,
-35264,
-35395,
-35442,
-35373,
-35247,
-34979,
-34643,
-34168,
-33663,
-33125,
-32611,
-32132,
-31749,
-31391,
-31181,
-31063,
-31071,
-31239,
-31459,
-31833,
-32266,
-32817,
-33460,
-34239,
-35047,
-35945,
-36816,
-37696,
-38568,
-39383,
-40139,
-40767,
-41256,
-41559,
-41715,
-41703,
-41550,
-41256,
-40815,
-40277,
-39657,
-38962,
-38239,
-37422,
-36600,
-35716,
-34904,
-34068,
-33386,
-32733,
-32200,
-31776,
-31441,
-31248,
-31157,
-31151,
-31262,
-31415,
-31691,
-31979,
-32374,
-32749,
-33165,
-33560,
-33966,
-34349,
-34707,
-35022,
-35248,
-35420,
-35474,
-35448,
-35345,
-35128,
-34856,
-34508,
-34101,
-33694,
-33241,
-32779,
-32323,
-31871,
-31473,
-31144,
-30868,
-30709,
-30618,
-30639,
-30750,
-30969,
-31278,
-31658,
-32117,
-32624,
-33172,
-33807,
-34408,
-35072,
-35671,
-36259,
-36795,
-37264,
-37670,
-37978,
-38205,
-38328,
-38369,
-38346,
-38206,
-38029,
-37722,
-37393,
-37005,
-36590,
-36161,
-35687,
-35221,
-34743,
-34282,
-33894,
-33522,
-33264,
-33024,
-32905,
-32855,
-32859,
-32964,
-33051,
-33191,
-33329,
-33488,
-33684,
-33895,
-34095,
-34288,
-34453,
-34567,
-34702,
-34719,
-34727,
-34622,
-34453,
-34191,
-33868,
-33460,
-32999,
-32476,
-31916,
-31358,
-30801,
-30322,
-29819,
-29395,
-28945,
-28529,
-28148,
-27787,
-27468,
-27204,
-26970,
-26829,
-26722,
-26714,
-26744,
-26838,
-26995,
-27149,
-27380,
-27564,
-27797,
-27972,
-28173,
-28323,
-28501,
-28652,
-28811,
-28990,
-29126,
-29280,
-29368,
-29414,
-29377,
-29285,
-29101,
-28867,
-28579,
-28260,
-27897,
-27555,
-27187,
-26872,
-26571,
-26362,
-26188,
-26116,
-26096,
-26149,
-26280,
-26505,
-26811,
-27218,
-27684,
-28185,
-28742,
-29301,
-29882,
-30464,
-31024,
-31515,
-31937,
-32286,
-32534,
-32751,
-32859,
-32914,
-32881,
-32803,
-32703,
-32549,
-32365,
-32085,
-31754,
-31356,
-30975,
-30583,
-30228,
-29864,
-29503,
-29195,
-28898,
-28730,
-28536,
-28441,
-28299,
-28222,
-28160,
-28116,
-28056,
-27945,
-27800,
-27699,
-27727,
-27907,
-28269,
-28760,
-29378,
-30152,
-31075,
-32168,
-33352,
-34499,
-35573,
-36510,
-37291,
-37963,
-38389,
-38600,
-38579,
-38359,
-38077,
-37708,
-37296,
-36687,
-35967,
-35065,
-34129,
-33222,
-32370,
-31590,
-30895,
-30356,
-30038,
-29989,
-30145,
-30472,
-30880,
-31377,
-31984,
-32695,
-33486,
-34269,
-35045,
-35763,
-36546,
-37357,
-38212,
-39013,
-39699,
-40221,
-40564,
-40787,
-40814,
-40759,
-40497,
-40156,
-39721,
-39224,
-38712,
-38094,
-37390,
-36562,
-35610,
-34607,
-33630,
-32686,
-31893,
-31179,
-30631,
-30231,
-29991,
-29951,
-30071,
-30316,
-30703,
-31139,
-31710,
-32338,
-33065,
-33812,
-34582,
-35306,
-36029,
-36681,
-37270,
-37715,
-37943,
-37972,
-37763,
-37479,
-37036,
-36551,
-35935,
-35192,
-34445,
-33589,
-32814,
-31974,
-31146,
-30296,
-29501,
-28810,
-28261,
-27891,
-27555,
-27360,
-27164,
-27165,
-27276,
-27612,
-28025,
-28591,
-29166,
-29879,
-30595,
-31439,
-32247,
-33049,
-33759,
-34389,
-34941,
-35427,
-35851,
-36188,
-36429,
-36565,
-36606,
-36584,
-36479,
-36293,
-36004,
-35581,
-35076,
-34519,
-33988,
-33527,
-33151,
-32880,
-32662,
-32572,
-32560,
-32668,
-32862,
-33107,
-33405,
-33764,
-34177,
-34696,
-35240,
-35879,
-36488,
-37114,
-37721,
-38279,
-38791,
-39157,
-39419,
-39502,
-39486,
-39309,
-39043,
-38637,
-38127,
-37540,
-36889,
-36198,
-35485,
-34727,
-33977,
-33192,
-32482,
-31778,
-31184,
-30598,
-30139,
-29699,
-29419,
-29209,
-29115,
-29114,
-29160,
-29312,
-29508,
-29806,
-30120,
-30487,
-30806,
-31121,
-31410,
-31673,
-31933,
-32123,
-32310,
-32396,
-32484,
-32481,
-32457,
-32345,
-32196,
-31979,
-31774,
-31546,
-31356,
-31179,
-31045,
-30939,
-30905,
-30922,
-31009,
-31158,
-31353,
-31618,
-31938,
-32314,
-32743,
-33219,
-33696,
-34214,
-34734,
-35270,
-35803,
-36340,
-36819,
-37300,
-37730,
-38132,
-38488,
-38786,
-39028,
-39185,
-39322,
-39331,
-39306,
-39146,
-38894,
-38573,
-38164,
-37748,
-37277,
-36799,
-36291,
-35799,
-35314,
-34896,
-34507,
-34187,
-33934,
-33772,
-33706,
-33775,
-33904,
-34089,
-34298,
-34486,
-34715,
-34916,
-35121,
-35259,
-35350,
-35373,
-35345,
-35267,
-35136,
-34910,
-34608,
-34209,
-33758,
-33251,
-32688,
-32086,
-31440,
-30795,
-30182,
-29636,
-29173,
-28770,
-28443,
-28146,
-27906,
-27705,
-27544,
-27405,
-27301,
-27198,
-27169,
-27167,
-27252,
-27368,
-27535,
-27719,
-27932,
-28193,
-28440,
-28726,
-28964,
-29201,
-29430,
-29616,
-29830,
-29980,
-30160,
-30240,
-30355,
-30376,
-30381,
-30322,
-30208,
-30011,
-29749,
-29442,
-29112,
-28787,
-28478,
-28206,
-27969,
-27798,
-27724,
-27756,
-27904,
-28117,
-28355,
-28679,
-28983,
-29412,
-29845,
-30314,
-30748,
-31143,
-31510,
-31888,
-32291,
-32642,
-32992,
-33174,
-33358,
-33412,
-33488,
-33459,
-33364,
-33172,
-32951,
-32702,
-32509,
-32256,
-31946,
-31521,
-31018,
-30498,
-29986,
-29525,
-29049,
-28582,
-28149,
-27766,
-27495,
-27257,
-27080,
-26863,
-26682,
-26534,
-26405,
-26319,
-26151,
-25949,
-25751,
-25622,
-25650,
-25827,
-26115,
-26529,
-27006,
-27705,
-28509,
-29512,
-30545,
-31632,
-32652,
-33644,
-34507,
-35212,
-35685,
-35903,
-35929,
-35837,
-35671,
-35511,
-35253,
-34954,
-34581,
-34127,
-33714,
-33243,
-32831,
-32387,
-32038,
-31753,
-31649,
-31667,
-31877,
-32173,
-32605,
-33097,
-33671,
-34283,
-34865,
-35460,
-35967,
-36528,
-37107,
-37762,
-38536,
-39304,
-40126,
-40816,
-41386,
-41827,
-42074,
-42209,
-42171,
-41995,
-41724,
-41353,
-40949,
-40463,
-39892,
-39197,
-38351,
-37432,
-36481,
-35555,
-34721,
-33961,
-33342,
-32873,
-32611,
-32550,
-32664,
-32871,
-33156,
-33483,
-33852,
-34262,
-34663,
-35052,
-35389,
-35700,
-36004,
-36310,
-36500,
-36638,
-36519,
-36308,
-35948,
-35535,
-35055,
-34544,
-33966,
-33384,
-32803,
-32230,
-31641,
-31021,
-30295,
-29561,
-28822,
-28147,
-27575,
-27044,
-26587,
-26176,
-25850,
-25639,
-25564,
-25621,
-25797,
-26080,
-26486,
-27004,
-27656,
-28417,
-29221,
-30089,
-30900,
-31712,
-32430,
-33092,
-33639,
-34105,
-34427,
-34672,
-34817,
-34918,
-34949,
-34910,
-34766,
-34519,
-34181,
-33837,
-33463,
-33184,
-32917,
-32743,
-32645,
-32623,
-32711,
-32855,
-33052,
-33299,
-33521,
-33833,
-34141,
-34551,
-34951,
-35446,
-35916,
-36469,
-36996,
-37536,
-37984,
-38382,
-38623,
-38817,
-38846,
-38848,
-38684,
-38506,
-38195,
-37859,
-37460,
-36981,
-36467,
-35843,
-35203,
-34527,
-33848,
-33206,
-32545,
-31938,
-31371,
-30884,
-30500,
-30188,
-29965,
-29780,
-29699,
-29650,
-29701,
-29801,
-29925,
-30086,
-30241,
-30420,
-30613,
-30814,
-30987,
-31164,
-31284,
-31446,
-31560,
-31703,
-31795,
-31845,
-31850,
-31831,
-31784,
-31725,
-31618,
-31519,
-31374,
-31309,
-31241,
-31226,
-31205,
-31193,
-31161,
-31205,
-31254,
-31409,
-31573,
-31797,
-32055,
-32383,
-32751,
-33157,
-33573,
-33990,
-34405,
-34843,
-35319,
-35761,
-36186,
-36531,
-36809,
-37033,
-37203,
-37308,
-37342,
-37253,
-37089,
-36863,
-36600,
-36315,
-36005,
-35699,
-35395,
-35168,
-34961,
-34825,
-34704,
-34554,
-34447,
-34364,
-34372,
-34461,
-34603,
-34801,
-34993,
-35218,
-35421,
-35632,
-35816,
-35946,
-36062,
-36128,
-36207,
-36217,
-36228,
-36126,
-35992,
-35784,
-35524,
-35254,
-34914,
-34563,
-34123,
-33678,
-33169,
-32674,
-32170,
-31706,
-31237,
-30855,
-30458,
-30140,
-29883,
-29623,
-29482,
-29324,
-29294,
-29285,
-29399,
-29559,
-29788,
-30050,
-30308,
-30601,
-30889,
-31169,
-31478,
-31701,
-31950,
-32079,
-32220,
-32244,
-32256,
-32148,
-32029,
-31811,
-31594,
-31331,
-31026,
-30714,
-30332,
-29964,
-29557,
-29202,
-28868,
-28576,
-28340,
-28129,
-28006,
-27908,
-27911,
-27934,
-28054,
-28189,
-28418,
-28667,
-29007,
-29337,
-29735,
-30063,
-30440,
-30737,
-31071,
-31354,
-31620,
-31805,
-31911,
-31910,
-31843,
-31682,
-31516,
-31265,
-31012,
-30720,
-30433,
-30151,
-29873,
-29536,
-29169,
-28728,
-28275,
-27853,
-27478,
-27146,
-26836,
-26550,
-26292,
-26099,
-25977,
-25912,
-25865,
-25833,
-25796,
-25795,
-25809,
-25815,
-25786,
-25727,
-25688,
-25723,
-25870,
-26136,
-26465,
-26882,
-27378,
-28014,
-28836,
-29808,
-30903,
-32036,
-33163,
-34224,
-35179,
-35948,
-36515,
-36816,
-36984,
-36992,
-37010,
-36982,
-36939,
-36840,
-36674,
-36439,
-36198,
-35895,
-35643,
-35358,
-35142,
-34980,
-34954,
-35006,
-35182,
-35404,
-35656,
-35922,
-36183,
-36440,
-36672,
-36894,
-37090,
-37340,
-37627,
-38070,
-38601,
-39247,
-39933,
-40570,
-41135,
-41587,
-41923,
-42158,
-42309,
-42384,
-42392,
-42366,
-42234,
-42007,
-41585,
-40919,
-40028,
-38971,
-37822,
-36700,
-35645,
-34669,
-33837,
-33121,
-32586,
-32195,
-31953,
-31769,
-31654,
-31553,
-31502,
-31530,
-31557,
-31658,
-31721,
-31855,
-32004,
-32198,
-32401,
-32501,
-32538,
-32430,
-32303,
-32119,
-31986,
-31824,
-31701,
-31547,
-31358,
-31147,
-30815,
-30388,
-29834,
-29177,
-28501,
-27826,
-27160,
-26564,
-25949,
-25390,
-24869,
-24438,
-24143,
-23977,
-24036,
-24213,
-24683,
-25268,
-26105,
-27027,
-28045,
-29082,
-30124,
-31103,
-32051,
-32896,
-33657,
-34326,
-34896,
-35406,
-35842,
-36216,
-36513,
-36685,
-36786,
-36697,
-36567,
-36304,
-36082,
-35827,
-35654,
-35514,
-35440,
-35408,
-35369,
-35307,
-35219,
-35050,
-34926,
-34801,
-34779,
-34850,
-35023,
-35288,
-35627,
-36024,
-36466,
-36924,
-37349,
-37773,
-38092,
-38413,
-38627,
-38798,
-38891,
-38899,
-38823,
-38670,
-38414,
-38066,
-37599,
-37013,
-36326,
-35550,
-34738,
-33921,
-33099,
-32323,
-31557,
-30840,
-30171,
-29559,
-29030,
-28603,
-28273,
-28077,
-27981,
-27983,
-28059,
-28171,
-28318,
-28475,
-28652,
-28860,
-29091,
-29403,
-29727,
-30110,
-30477,
-30839,
-31154,
-31424,
-31592,
-31713,
-31720,
-31682,
-31550,
-31409,
-31207,
-31025,
-30830,
-30646,
-30478,
-30328,
-30207,
-30093,
-30028,
-29983,
-30008,
-30145,
-30386,
-30805,
-31338,
-32007,
-32737,
-33510,
-34244,
-34986,
-35606,
-36194,
-36706,
-37130,
-37542,
-37876,
-38194,
-38455,
-38630,
-38745,
-38816,
-38814,
-38846,
-38758,
-38725,
-38576,
-38460,
-38310,
-38183,
-38064,
-37931,
-37789,
-37622,
-37498,
-37313,
-37208,
-37003,
-36891,
-36752,
-36733,
-36762,
-36895,
-37018,
-37186,
-37312,
-37461,
-37581,
-37722,
-37778,
-37826,
-37782,
-37691,
-37565,
-37328,
-37040,
-36593,
-36133,
-35570,
-35061,
-34503,
-33954,
-33373,
-32805,
-32248,
-31742,
-31275,
-30856,
-30464,
-30131,
-29868,
-29688,
-29577,
-29510,
-29467,
-29446,
-29457,
-29499,
-29569,
-29641,
-29702,
-29766,
-29811,
-29913,
-29972,
-30069,
-30113,
-30126,
-30158,
-30110,
-30100,
-30015,
-29918,
-29781,
-29614,
-29472,
-29303,
-29165,
-29001,
-28826,
-28634,
-28442,
-28251,
-28060,
-27908,
-27743,
-27643,
-27564,
-27546,
-27615,
-27707,
-27888,
-28077,
-28323,
-28593,
-28903,
-29194,
-29497,
-29697,
-29913,
-30013,
-30155,
-30202,
-30320,
-30318,
-30366,
-30330,
-30331,
-30268,
-30250,
-30149,
-30089,
-30010,
-29993,
-29995,
-30037,
-30025,
-29973,
-29899,
-29769,
-29680,
-29553,
-29448,
-29331,
-29197,
-29120,
-29043,
-28985,
-28951,
-28858,
-28793,
-28711,
-28644,
-28542,
-28396,
-28167,
-27904,
-27669,
-27461,
-27359,
-27337,
-27357,
-27492,
-27734,
-28134,
-28758,
-29544,
-30532,
-31661,
-32873,
-34100,
-35241,
-36168,
-36890,
-37341,
-37620,
-37783,
-37872,
-37946,
-37982,
-37983,
-37926,
-37792,
-37590,
-37301,
-36955,
-36548,
-36102,
-35681,
-35264,
-34933,
-34635,
-34397,
-34198,
-34015,
-33810,
-33633,
-33368,
-33159,
-32957,
-32866,
-32975,
-33303,
-33898,
-34696,
-35589,
-36523,
-37372,
-38121,
-38764,
-39246,
-39675,
-39994,
-40311,
-40562,
-40754,
-40761,
-40544,
-40011,
-39219,
-38171,
-36985,
-35775,
-34536,
-33446,
-32458,
-31663,
-31074,
-30602,
-30232,
-29902,
-29531,
-29205,
-28835,
-28520,
-28222,
-28014,
-27914,
-27974,
-28196,
-28530,
-28930,
-29313,
-29646,
-29922,
-30180,
-30428,
-30723,
-31033,
-31426,
-31750,
-32097,
-32252,
-32293,
-32090,
-31682,
-31112,
-30402,
-29678,
-28916,
-28223,
-27542,
-26964,
-26437,
-26040,
-25779,
-25702,
-25787,
-26097,
-26566,
-27250,
-28084,
-29036,
-30054,
-31062,
-32012,
-32895,
-33675,
-34372,
-34993,
-35529,
-36053,
-36518,
-37030,
-37493,
-37945,
-38248,
-38460,
-38461,
-38371,
-38173,
-37899,
-37662,
-37369,
-37161,
-36946,
-36775,
-36538,
-36252,
-35837,
-35360,
-34871,
-34423,
-34087,
-33886,
-33851,
-33982,
-34288,
-34730,
-35261,
-35805,
-36323,
-36763,
-37140,
-37439,
-37681,
-37795,
-37889,
-37847,
-37787,
-37637,
-37388,
-36996,
-36464,
-35756,
-34991,
-34129,
-33281,
-32411,
-31572,
-30752,
-30043,
-29359,
-28792,
-28237,
-27731,
-27329,
-26984,
-26806,
-26707,
-26695,
-26740,
-26807,
-26949,
-27102,
-27321,
-27553,
-27820,
-28141,
-28546,
-29026,
-29624,
-30207,
-30820,
-31352,
-31827,
-32245,
-32539,
-32760,
-32851,
-32878,
-32862,
-32850,
-32829,
-32845,
-32811,
-32804,
-32739,
-32690,
-32606,
-32537,
-32484,
-32481,
-32583,
-32797,
-33166,
-33637,
-34227,
-34828,
-35438,
-36020,
-36523,
-37034,
-37430,
-37869,
-38270,
-38671,
-39145,
-39585,
-40095,
-40540,
-40984,
-41345,
-41661,
-41880,
-42047,
-42124,
-42114,
-42043,
-41898,
-41721,
-41519,
-41279,
-40992,
-40678,
-40292,
-39908,
-39490,
-39095,
-38695,
-38348,
-38012,
-37724,
-37481,
-37215,
-37002,
-36717,
-36472,
-36192,
-35944,
-35686,
-35457,
-35197,
-34945,
-34670,
-34359,
-34057,
-33707,
-33386,
-33057,
-32793,
-32517,
-32306,
-32065,
-31830,
-31568,
-31274,
-30948,
-30605,
-30183,
-29762,
-29308,
-28876,
-28473,
-28093,
-27760,
-27427,
-27196,
-26973,
-26872,
-26760,
-26695,
-26630,
-26604,
-26648,
-26788,
-26975,
-27219,
-27452,
-27717,
-28012,
-28319,
-28617,
-28867,
-29039,
-29181,
-29308,
-29427,
-29577,
-29641,
-29681,
-29647,
-29606,
-29553,
-29480,
-29361,
-29179,
-28971,
-28758,
-28581,
-28457,
-28378,
-28287,
-28264,
-28248,
-28336,
-28490,
-28703,
-28925,
-29138,
-29349,
-29536,
-29813,
-30074,
-30433,
-30740,
-31053,
-31302,
-31544,
-31759,
-31979,
-32114,
-32238,
-32314,
-32401,
-32551,
-32676,
-32754,
-32677,
-32471,
-32179,
-31884,
-31622,
-31379,
-31041,
-30679,
-30235,
-29891,
-29608,
-29401,
-29178,
-28939,
-28656,
-28446,
-28234,
-28023,
-27713,
-27292,
-26875,
-26573,
-26451,
-26530,
-26668,
-26872,
-27106,
-27540,
-28169,
-29097,
-30152,
-31337,
-32503,
-33685,
-34756,
-35670,
-36282,
-36611,
-36638,
-36544,
-36362,
-36216,
-36015,
-35760,
-35414,
-34981,
-34565,
-34171,
-33810,
-33486,
-33116,
-32743,
-32360,
-31999,
-31731,
-31496,
-31338,
-31216,
-31114,
-31123,
-31139,
-31246,
-31360,
-31516,
-31829,
-32301,
-33147,
-34205,
-35481,
-36737,
-37908,
-38939,
-39849,
-40666,
-41362,
-41898,
-42263,
-42488,
-42595,
-42579,
-42320,
-41806,
-40921,
-39862,
-38665,
-37539,
-36429,
-35399,
-34365,
-33445,
-32670,
-32118,
-31711,
-31394,
-31049,
-30705,
-30357,
-30073,
-29814,
-29604,
-29394,
-29299,
-29305,
-29522,
-29869,
-30250,
-30660,
-30942,
-31305,
-31610,
-32066,
-32491,
-32985,
-33405,
-33763,
-34012,
-34075,
-33961,
-33559,
-33000,
-32245,
-31457,
-30612,
-29810,
-29020,
-28269,
-27584,
-26972,
-26494,
-26177,
-26008,
-26026,
-26206,
-26539,
-27010,
-27585,
-28241,
-28932,
-29619,
-30280,
-30855,
-31411,
-31859,
-32343,
-32785,
-33291,
-33848,
-34454,
-35110,
-35756,
-36361,
-36882,
-37287,
-37521,
-37700,
-37747,
-37776,
-37762,
-37669,
-37542,
-37303,
-36971,
-36553,
-36086,
-35546,
-35039,
-34525,
-34151,
-33930,
-33894,
-34032,
-34311,
-34658,
-35083,
-35504,
-35940,
-36291,
-36588,
-36727,
-36840,
-36831,
-36852,
-36781,
-36703,
-36526,
-36306,
-36037,
-35756,
-35430,
-35119,
-34746,
-34398,
-34040,
-33695,
-33367,
-32999,
-32612,
-32149,
-31672,
-31160,
-30670,
-30181,
-29736,
-29301,
-28943,
-28604,
-28346,
-28157,
-28001,
-27944,
-27930,
-28015,
-28230,
-28529,
-28990,
-29443,
-30005,
-30479,
-30960,
-31345,
-31644,
-31839,
-31878,
-31846,
-31746,
-31632,
-31566,
-31524,
-31526,
-31522,
-31566,
-31595,
-31693,
-31766,
-31850,
-31926,
-32022,
-32220,
-32455,
-32844,
-33194,
-33649,
-34099,
-34576,
-35127,
-35615,
-36116,
-36517,
-36893,
-37294,
-37695,
-38211,
-38680,
-39238,
-39729,
-40302,
-40840,
-41370,
-41806,
-42123,
-42334,
-42462,
-42499,
-42459,
-42302,
-42048,
-41689,
-41309,
-40904,
-40528,
-40126,
-39732,
-39300,
-38900,
-38486,
-38132,
-37763,
-37404,
-37092,
-36762,
-36526,
-36300,
-36120,
-35957,
-35800,
-35634,
-35470,
-35334,
-35150,
-34965,
-34719,
-34433,
-34158,
-33832,
-33573,
-33285,
-33053,
-32771,
-32489,
-32161,
-31806,
-31394,
-30951,
-30433,
-29894,
-29342,
-28815,
-28365,
-27930,
-27624,
-27305,
-27134,
-26981,
-26939,
-26959,
-26998,
-27087,
-27158,
-27270,
-27424,
-27626,
-27865,
-28132,
-28435,
-28751,
-29073,
-29424,
-29707,
-30017,
-30198,
-30371,
-30477,
-30559,
-30637,
-30693,
-30708,
-30706,
-30645,
-30551,
-30475,
-30306,
-30161,
-29897,
-29616,
-29302,
-29003,
-28736,
-28504,
-28314,
-28148,
-28133,
-28212,
-28477,
-28798,
-29174,
-29541,
-29864,
-30230,
-30587,
-30997,
-31338,
-31695,
-31968,
-32287,
-32571,
-32862,
-33089,
-33257,
-33362,
-33443,
-33480,
-33487,
-33345,
-33116,
-32733,
-32332,
-31912,
-31553,
-31225,
-30891,
-30539,
-30145,
-29758,
-29352,
-29003,
-28674,
-28385,
-28134,
-27888,
-27669,
-27418,
-27107,
-26773,
-26315,
-25940,
-25521,
-25274,
-25049,
-24941,
-24884,
-24946,
-25183,
-25651,
-26372,
-27264,
-28255,
-29187,
-30066,
-30760,
-31349,
-31714,
-31930,
-31980,
-31987,
-31992,
-32014,
-32062,
-32021,
-31962,
-31851,
-31808,
-31821,
-31901,
-31939,
-31948,
-31866,
-31797,
-31717,
-31676,
-31641,
-31572,
-31577,
-31574,
-31724,
-31850,
-32071,
-32302,
-32657,
-33264,
-34070,
-35172,
-36347,
-37586,
-38769,
-39917,
-40961,
-41933,
-42745,
-43397,
-43970,
-44379,
-44747,
-44908,
-44868,
-44571,
-44059,
-43373,
-42643,
-41837,
-41038,
-40210,
-39378,
-38627,
-37928,
-37331,
-36762,
-36183,
-35636,
-35045,
-34472,
-33835,
-33169,
-32439,
-31756,
-31159,
-30724,
-30498,
-30398,
-30421,
-30525,
-30674,
-30912,
-31199,
-31568,
-31984,
-32460,
-32913,
-33363,
-33662,
-33827,
-33751,
-33512,
-33042,
-32499,
-31812,
-31073,
-30251,
-29367,
-28471,
-27561,
-26701,
-25931,
-25273,
-24736,
-24359,
-24102,
-23988,
-24009,
-24127,
-24374,
-24680,
-25069,
-25518,
-25979,
-26483,
-26986,
-27536,
-28105,
-28807,
-29558,
-30465,
-31406,
-32408,
-33360,
-34266,
-35074,
-35772,
-36372,
-36825,
-37190,
-37414,
-37541,
-37545,
-37437,
-37186,
-36810,
-36337,
-35796,
-35268,
-34762,
-34314,
-33964,
-33686,
-33540,
-33507,
-33536,
-33676,
-33804,
-33992,
-34168,
-34337,
-34535,
-34698,
-34878,
-35055,
-35234,
-35443,
-35656,
-35884,
-36092,
-36284,
-36414,
-36541,
-36576,
-36618,
-36561,
-36490,
-36282,
-36046,
-35647,
-35226,
-34665,
-34052,
-33397,
-32648,
-31943,
-31212,
-30531,
-29888,
-29267,
-28689,
-28191,
-27774,
-27491,
-27322,
-27254,
-27295,
-27407,
-27599,
-27866,
-28144,
-28464,
-28768,
-29075,
-29405,
-29734,
-30084,
-30450,
-30808,
-31182,
-31557,
-31944,
-32348,
-32704,
-33027,
-33316,
-33542,
-33782,
-33996,
-34206,
-34408,
-34579,
-34743,
-34866,
-34980,
-35075,
-35149,
-35259,
-35390,
-35576,
-35864,
-36194,
-36631,
-37105,
-37653,
-38201,
-38788,
-39353,
-39893,
-40437,
-40891,
-41356,
-41758,
-42134,
-42477,
-42761,
-43001,
-43162,
-43269,
-43318,
-43306,
-43288,
-43182,
-43099,
-42945,
-42774,
-42570,
-42309,
-42007,
-41638,
-41185,
-40704,
-40121,
-39545,
-38889,
-38252,
-37620,
-36966,
-36406,
-35780,
-35270,
-34683,
-34195,
-33688,
-33247,
-32823,
-32437,
-32105,
-31762,
-31502,
-31175,
-30905,
-30586,
-30240,
-29898,
-29508,
-29134,
-28742,
-28374,
-28010,
-27698,
-27372,
-27151,
-26869,
-26702,
-26469,
-26312,
-26132,
-26009,
-25854,
-25767,
-25638,
-25557,
-25508,
-25466,
-25527,
-25554,
-25695,
-25813,
-26003,
-26216,
-26450,
-26747,
-27044,
-27373,
-27718,
-28062,
-28392,
-28705,
-28968,
-29226,
-29449,
-29667,
-29887,
-30112,
-30301,
-30508,
-30629,
-30787,
-30876,
-31000,
-31093,
-31212,
-31288,
-31410,
-31468,
-31591,
-31693,
-31826,
-32003,
-32181,
-32409,
-32665,
-32926,
-33243,
-33543,
-33876,
-34245,
-34608,
-35018,
-35392,
-35763,
-36049,
-36310,
-36492,
-36636,
-36759,
-36821,
-36873,
-36867,
-36837,
-36737,
-36601,
-36354,
-36043,
-35597,
-35075,
-34468,
-33786,
-33119,
-32373,
-31693,
-30925,
-30198,
-29411,
-28633,
-27809,
-27001,
-26154,
-25350,
-24551,
-23804,
-23093,
-22429,
-21775,
-21199,
-20647,
-20224,
-19895,
-19674,
-19609,
-19647,
-19888,
-20326,
-20966,
-21814,
-22754,
-23745,
-24617,
-25403,
-25952,
-26396,
-26643,
-26834,
-27004,
-27193,
-27471,
-27771,
-28085,
-28389,
-28615,
-28796,
-28941,
-29040,
-29150,
-29236,
-29365,
-29508,
-29747,
-30020,
-30388,
-30780,
-31203,
-31644,
-32087,
-32556,
-33111,
-33765,
-34613,
-35643,
-36882,
-38275,
-39755,
-41229,
-42613,
-43857,
-44920,
-45792,
-46513,
-47083,
-47582,
-47985,
-48313,
-48510,
-48547,
-48340,
-47948,
-47343,
-46598,
-45784,
-44915,
-44087,
-43345,
-42650,
-42095,
-41546,
-41041,
-40482,
-39877,
-39210,
-38481,
-37730,
-36946,
-36191,
-35510,
-34916,
-34491,
-34157,
-33952,
-33796,
-33651,
-33534,
-33444,
-33360,
-33383,
-33396,
-33475,
-33527,
-33504,
-33386,
-33073,
-32640,
-32009,
-31308,
-30496,
-29690,
-28876,
-28088,
-27343,
-26623,
-25956,
-25302,
-24722,
-24157,
-23704,
-23327,
-23066,
-22929,
-22846,
-22896,
-22944,
-23068,
-23170,
-23271,
-23376,
-23480,
-23648,
-23879,
-24264,
-24761,
-25414,
-26144,
-26972,
-27772,
-28614,
-29305,
-29963,
-30502,
-30928,
-31338,
-31657,
-31975,
-32273,
-32500,
-32698,
-32778,
-32835,
-32790,
-32814,
-32771,
-32887,
-33015,
-33312,
-33677,
-34156,
-34676,
-35231,
-35754,
-36250,
-36676,
-37018,
-37342,
-37566,
-37821,
-38019,
-38258,
-38496,
-38783,
-39064,
-39390,
-39677,
-40003,
-40282,
-40595,
-40852,
-41103,
-41280,
-41382,
-41363,
-41281,
-41021,
-40750,
-40315,
-39889,
-39384,
-38902,
-38400,
-37943,
-37479,
-37059,
-36616,
-36205,
-35773,
-35396,
-35015,
-34692,
-34399,
-34126,
-33902,
-33684,
-33467,
-33253,
-33004,
-32738,
-32473,
-32207,
-32010,
-31872,
-31831,
-31874,
-31994,
-32185,
-32390,
-32644,
-32833,
-33008,
-33135,
-33211,
-33258,
-33282,
-33275,
-33261,
-33215,
-33136,
-33030,
-32908,
-32737,
-32606,
-32385,
-32259,
-32084,
-32001,
-32002,
-32058,
-32217,
-32444,
-32686,
-33005,
-33273,
-33547,
-33812,
-34001,
-34234,
-34391,
-34600,
-34784,
-34980,
-35182,
-35366,
-35584,
-35776,
-36016,
-36236,
-36473,
-36694,
-36897,
-37045,
-37192,
-37237,
-37286,
-37220,
-37122,
-36915,
-36668,
-36322,
-35956,
-35533,
-35097,
-34630,
-34199,
-33764,
-33383,
-33025,
-32695,
-32430,
-32161,
-31973,
-31778,
-31652,
-31530,
-31451,
-31379,
-31321,
-31237,
-31192,
-31089,
-31043,
-30958,
-30899,
-30874,
-30839,
-30846,
-30843,
-30837,
-30833,
-30813,
-30799,
-30767,
-30752,
-30691,
-30631,
-30542,
-30435,
-30341,
-30237,
-30161,
-30122,
-30090,
-30089,
-30106,
-30152,
-30220,
-30352,
-30487,
-30700,
-30936,
-31199,
-31478,
-31779,
-32030,
-32292,
-32515,
-32728,
-32943,
-33130,
-33324,
-33492,
-33662,
-33824,
-33989,
-34186,
-34355,
-34561,
-34739,
-34891,
-35026,
-35110,
-35134,
-35136,
-35048,
-34939,
-34788,
-34602,
-34413,
-34204,
-34013,
-33823,
-33678,
-33574,
-33514,
-33537,
-33572,
-33659,
-33720,
-33777,
-33804,
-33798,
-33741,
-33660,
-33511,
-33343,
-33134,
-32866,
-32610,
-32274,
-31935,
-31564,
-31172,
-30802,
-30398,
-30011,
-29581,
-29136,
-28643,
-28134,
-27598,
-27060,
-26487,
-25910,
-25267,
-24607,
-23899,
-23181,
-22469,
-21798,
-21198,
-20668,
-20252,
-19913,
-19654,
-19424,
-19212,
-18995,
-18798,
-18624,
-18535,
-18514,
-18636,
-18871,
-19306,
-19900,
-20698,
-21669,
-22727,
-23881,
-24955,
-25983,
-26837,
-27607,
-28189,
-28772,
-29246,
-29786,
-30301,
-30853,
-31324,
-31751,
-32048,
-32231,
-32344,
-32401,
-32464,
-32570,
-32726,
-32957,
-33247,
-33582,
-33953,
-34330,
-34730,
-35068,
-35432,
-35742,
-36112,
-36522,
-37044,
-37709,
-38484,
-39406,
-40375,
-41383,
-42325,
-43186,
-43912,
-44521,
-45017,
-45438,
-45832,
-46163,
-46454,
-46621,
-46625,
-46427,
-45987,
-45345,
-44543,
-43614,
-42645,
-41674,
-40762,
-39918,
-39166,
-38448,
-37798,
-37148,
-36507,
-35879,
-35253,
-34637,
-34062,
-33489,
-33003,
-32555,
-32228,
-31971,
-31800,
-31693,
-31617,
-31589,
-31578,
-31623,
-31744,
-31908,
-32137,
-32373,
-32576,
-32693,
-32714,
-32578,
-32359,
-32009,
-31601,
-31157,
-30667,
-30172,
-29652,
-29101,
-28525,
-27938,
-27327,
-26785,
-26244,
-25836,
-25475,
-25240,
-25078,
-24967,
-24924,
-24869,
-24862,
-24816,
-24794,
-24782,
-24833,
-24956,
-25216,
-25574,
-26093,
-26687,
-27411,
-28166,
-28953,
-29710,
-30424,
-31083,
-31665,
-32222,
-32703,
-33174,
-33575,
-33928,
-34196,
-34371,
-34486,
-34491,
-34541,
-34495,
-34568,
-34616,
-34775,
-34964,
-35219,
-35493,
-35799,
-36075,
-36366,
-36569,
-36796,
-36914,
-37064,
-37113,
-37197,
-37234,
-37291,
-37377,
-37465,
-37600,
-37766,
-37925,
-38168,
-38367,
-38623,
-38832,
-39027,
-39156,
-39220,
-39201,
-39117,
-38962,
-38762,
-38540,
-38257,
-38016,
-37731,
-37492,
-37233,
-36952,
-36687,
-36355,
-36072,
-35744,
-35480,
-35219,
-35002,
-34807,
-34650,
-34478,
-34356,
-34208,
-34067,
-33927,
-33765,
-33641,
-33525,
-33453,
-33405,
-33418,
-33449,
-33529,
-33598,
-33706,
-33754,
-33800,
-33803,
-33747,
-33715,
-33618,
-33554,
-33429,
-33329,
-33179,
-33028,
-32868,
-32708,
-32545,
-32401,
-32270,
-32125,
-32019,
-31914,
-31837,
-31805,
-31777,
-31823,
-31839,
-31926,
-32009,
-32104,
-32229,
-32328,
-32455,
-32572,
-32687,
-32803,
-32904,
-32984,
-33082,
-33137,
-33236,
-33322,
-33428,
-33543,
-33643,
-33753,
-33833,
-33921,
-33970,
-34024,
-34019,
-34030,
-33985,
-33941,
-33868,
-33782,
-33694,
-33571,
-33462,
-33334,
-33212,
-33108,
-33029,
-32953,
-32908,
-32865,
-32849,
-32851,
-32876,
-32927,
-32982,
-33074,
-33135,
-33230,
-33286,
-33357,
-33420,
-33516,
-33573,
-33708,
-33783,
-33921,
-34016,
-34116,
-34231,
-34311,
-34429,
-34486,
-34565,
-34577,
-34579,
-34497,
-34416,
-34267,
-34155,
-33989,
-33870,
-33739,
-33634,
-33563,
-33516,
-33515,
-33552,
-33624,
-33705,
-33835,
-33923,
-34065,
-34146,
-34280,
-34357,
-34464,
-34505,
-34562,
-34563,
-34566,
-34550,
-34517,
-34478,
-34416,
-34340,
-34240,
-34131,
-33997,
-33873,
-33695,
-33524,
-33251,
-32933,
-32554,
-32058,
-31593,
-31028,
-30529,
-30001,
-29506,
-29030,
-28591,
-28181,
-27899,
-27655,
-27555,
-27517,
-27550,
-27618,
-27654,
-27708,
-27694,
-27747,
-27722,
-27748,
-27718,
-27685,
-27591,
-27481,
-27364,
-27248,
-27229,
-27184,
-27234,
-27249,
-27252,
-27213,
-27107,
-26969,
-26763,
-26553,
-26275,
-26002,
-25667,
-25325,
-24954,
-24603,
-24274,
-24001,
-23784,
-23628,
-23534,
-23511,
-23502,
-23569,
-23583,
-23667,
-23656,
-23691,
-23689,
-23724,
-23791,
-23910,
-24148,
-24434,
-24918,
-25481,
-26223,
-27085,
-28017,
-28980,
-29891,
-30678,
-31373,
-31901,
-32379,
-32765,
-33151,
-33539,
-33892,
-34260,
-34499,
-34715,
-34843,
-34921,
-35020,
-35091,
-35178,
-35275,
-35326,
-35373,
-35374,
-35361,
-35337,
-35288,
-35214,
-35103,
-34923,
-34751,
-34592,
-34537,
-34600,
-34837,
-35212,
-35716,
-36280,
-36850,
-37378,
-37830,
-38210,
-38554,
-38873,
-39193,
-39506,
-39809,
-40009,
-40169,
-40165,
-40096,
-39847,
-39506,
-39077,
-38591,
-38101,
-37650,
-37234,
-36910,
-36594,
-36337,
-36065,
-35785,
-35496,
-35101,
-34732,
-34225,
-33780,
-33290,
-32918,
-32574,
-32399,
-32280,
-32280,
-32354,
-32479,
-32676,
-32894,
-33172,
-33483,
-33848,
-34216,
-34600,
-34907,
-35162,
-35276,
-35309,
-35225,
-35071,
-34886,
-34636,
-34413,
-34111,
-33842,
-33509,
-33206,
-32872,
-32576,
-32278,
-32028,
-31790,
-31607,
-31409,
-31266,
-31084,
-30937,
-30778,
-30641,
-30481,
-30385,
-30253,
-30219,
-30208,
-30317,
-30518,
-30809,
-31192,
-31628,
-32074,
-32525,
-32905,
-33284,
-33558,
-33840,
-34011,
-34214,
-34306,
-34397,
-34393,
-34329,
-34200,
-34016,
-33806,
-33578,
-33359,
-33160,
-33017,
-32888,
-32818,
-32759,
-32729,
-32678,
-32656,
-32555,
-32518,
-32403,
-32351,
-32275,
-32241,
-32251,
-32294,
-32405,
-32553,
-32757,
-32976,
-33260,
-33509,
-33808,
-34051,
-34312,
-34525,
-34731,
-34896,
-35006,
-35098,
-35117,
-35096,
-35052,
-34958,
-34884,
-34785,
-34705,
-34617,
-34548,
-34458,
-34398,
-34324,
-34289,
-34252,
-34261,
-34269,
-34325,
-34361,
-34419,
-34452,
-34500,
-34527,
-34581,
-34618,
-34709,
-34793,
-34906,
-35031,
-35169,
-35350,
-35492,
-35689,
-35819,
-35979,
-36060,
-36156,
-36179,
-36192,
-36157,
-36081,
-35983,
-35843,
-35673,
-35463,
-35255,
-34992,
-34760,
-34512,
-34275,
-34084,
-33884,
-33743,
-33586,
-33456,
-33337,
-33229,
-33136,
-33061,
-33000,
-32973,
-32980,
-32994,
-33040,
-33079,
-33149,
-33166,
-33227,
-33250,
-33304,
-33370,
-33442,
-33528,
-33623,
-33690,
-33783,
-33807,
-33836,
-33801,
-33735,
-33634,
-33513,
-33368,
-33245,
-33094,
-32994,
-32906,
-32832,
-32806,
-32759,
-32746,
-32740,
-32718,
-32743,
-32740,
-32796,
-32853,
-32935,
-33041,
-33145,
-33266,
-33362,
-33480,
-33574,
-33682,
-33789,
-33901,
-34045,
-34165,
-34330,
-34441,
-34589,
-34706,
-34819,
-34935,
-35010,
-35081,
-35123,
-35138,
-35146,
-35115,
-35104,
-35053,
-35027,
-34980,
-34934,
-34908,
-34865,
-34879,
-34871,
-34919,
-34966,
-35034,
-35107,
-35170,
-35236,
-35257,
-35316,
-35322,
-35378,
-35399,
-35428,
-35464,
-35481,
-35508,
-35517,
-35525,
-35506,
-35481,
-35416,
-35362,
-35249,
-35144,
-34988,
-34805,
-34597,
-34360,
-34073,
-33797,
-33443,
-33114,
-32725,
-32332,
-31936,
-31527,
-31147,
-30784,
-30428,
-30117,
-29778,
-29505,
-29200,
-28949,
-28685,
-28470,
-28268,
-28112,
-27962,
-27867,
-27760,
-27688,
-27646,
-27649,
-27697,
-27817,
-27947,
-28130,
-28305,
-28476,
-28628,
-28768,
-28880,
-28974,
-29004,
-29010,
-28924,
-28809,
-28614,
-28390,
-28141,
-27867,
-27608,
-27337,
-27069,
-26794,
-26508,
-26203,
-25947,
-25673,
-25476,
-25308,
-25156,
-25061,
-24950,
-24879,
-24801,
-24746,
-24710,
-24665,
-24664,
-24645,
-24676,
-24688,
-24740,
-24755,
-24796,
-24827,
-24866,
-24959,
-25056,
-25242,
-25405,
-25666,
-25922,
-26260,
-26644,
-27081,
-27564,
-28035,
-28502,
-28877,
-29181,
-29371,
-29470,
-29531,
-29580,
-29636,
-29762,
-29864,
-30044,
-30146,
-30289,
-30367,
-30494,
-30610,
-30804,
-30956,
-31179,
-31302,
-31499,
-31587,
-31756,
-31851,
-31977,
-32064,
-32130,
-32196,
-32260,
-32361,
-32524,
-32755,
-33107,
-33525,
-34032,
-34551,
-35045,
-35462,
-35801,
-36072,
-36309,
-36554,
-36783,
-37059,
-37312,
-37565,
-37788,
-37907,
-37984,
-37892,
-37755,
-37526,
-37268,
-37040,
-36812,
-36648,
-36485,
-36397,
-36274,
-36224,
-36112,
-36032,
-35891,
-35756,
-35571,
-35406,
-35256,
-35166,
-35134,
-35215,
-35327,
-35538,
-35759,
-35999,
-36226,
-36453,
-36663,
-36909,
-37186,
-37505,
-37831,
-38134,
-38404,
-38576,
-38686,
-38715,
-38676,
-38598,
-38465,
-38309,
-38115,
-37874,
-37618,
-37273,
-36938,
-36531,
-36132,
-35730,
-35331,
-34949,
-34574,
-34202,
-33864,
-33553,
-33262,
-33023,
-32801,
-32601,
-32448,
-32313,
-32243,
-32237,
-32304,
-32409,
-32618,
-32767,
-32982,
-33098,
-33214,
-33240,
-33253,
-33186,
-33144,
-33061,
-32996,
-32900,
-32808,
-32652,
-32494,
-32289,
-32056,
-31831,
-31567,
-31357,
-31148,
-30979,
-30840,
-30742,
-30651,
-30584,
-30500,
-30434,
-30323,
-30249,
-30140,
-30090,
-30039,
-30091,
-30146,
-30346,
-30534,
-30824,
-31102,
-31427,
-31721,
-32039,
-32305,
-32586,
-32806,
-33013,
-33180,
-33313,
-33413,
-33501,
-33514,
-33560,
-33535,
-33544,
-33539,
-33546,
-33560,
-33578,
-33596,
-33636,
-33626,
-33653,
-33643,
-33669,
-33679,
-33718,
-33726,
-33801,
-33824,
-33912,
-33989,
-34075,
-34191,
-34288,
-34403,
-34530,
-34676,
-34831,
-35026,
-35188,
-35379,
-35524,
-35626,
-35702,
-35693,
-35690,
-35595,
-35543,
-35415,
-35322,
-35221,
-35118,
-35026,
-34950,
-34888,
-34838,
-34801,
-34758,
-34732,
-34680,
-34657,
-34607,
-34604,
-34578,
-34602,
-34589,
-34625,
-34624,
-34632,
-34648,
-34650,
-34673,
-34705,
-34714,
-34755,
-34743,
-34753,
-34736,
-34741,
-34720,
-34710,
-34635,
-34544,
-34378,
-34193,
-33975,
-33787,
-33619,
-33505,
-33423,
-33377,
-33373,
-33366,
-33443,
-33501,
-33660,
-33768,
-33960,
-34084,
-34231,
-34328,
-34415,
-34500,
-34570,
-34653,
-34713,
-34788,
-34862,
-34912,
-34992,
-35032,
-35105,
-35122,
-35196,
-35188,
-35239,
-35211,
-35219,
-35169,
-35123,
-35041,
-34972,
-34876,
-34834,
-34758,
-34736,
-34684,
-34648,
-34600,
-34589,
-34547,
-34598,
-34616,
-34698,
-34767,
-34844,
-34885,
-34937,
-34933,
-34927,
-34893,
-34827,
-34749,
-34639,
-34517,
-34375,
-34222,
-34076,
-33903,
-33744,
-33565,
-33358,
-33155,
-32879,
-32620,
-32319,
-32016,
-31729,
-31422,
-31164,
-30906,
-30686,
-30491,
-30355,
-30229,
-30174,
-30137,
-30127,
-30158,
-30187,
-30231,
-30284,
-30346,
-30415,
-30485,
-30572,
-30632,
-30698,
-30737,
-30756,
-30732,
-30687,
-30579,
-30478,
-30318,
-30185,
-30014,
-29866,
-29721,
-29573,
-29441,
-29292,
-29152,
-28992,
-28854,
-28686,
-28564,
-28430,
-28343,
-28260,
-28252,
-28244,
-28291,
-28382,
-28472,
-28620,
-28724,
-28845,
-28949,
-29010,
-29079,
-29077,
-29092,
-29037,
-28998,
-28912,
-28838,
-28767,
-28680,
-28647,
-28577,
-28516,
-28438,
-28285,
-28135,
-27886,
-27660,
-27385,
-27140,
-26862,
-26623,
-26367,
-26152,
-25953,
-25820,
-25722,
-25689,
-25691,
-25698,
-25732,
-25737,
-25794,
-25805,
-25876,
-25909,
-25947,
-25993,
-25980,
-26020,
-26011,
-26070,
-26157,
-26289,
-26521,
-26775,
-27169,
-27545,
-28012,
-28393,
-28748,
-29003,
-29125,
-29173,
-29118,
-29040,
-28968,
-28903,
-28898,
-28907,
-28951,
-29016,
-29073,
-29186,
-29263,
-29422,
-29511,
-29680,
-29794,
-29968,
-30119,
-30318,
-30498,
-30716,
-30885,
-31081,
-31234,
-31410,
-31607,
-31848,
-32178,
-32574,
-33080,
-33598,
-34187,
-34724,
-35232,
-35680,
-36048,
-36379,
-36697,
-36981,
-37304,
-37625,
-37929,
-38234,
-38499,
-38697,
-38881,
-38963,
-39058,
-39082,
-39132,
-39178,
-39209,
-39300,
-39326,
-39430,
-39493,
-39570,
-39683,
-39748,
-39873,
-39909,
-40009,
-40014,
-40082,
-40118,
-40171,
-40274,
-40351,
-40425,
-40476,
-40471,
-40463,
-40435,
-40395,
-40402,
-40359,
-40353,
-40271,
-40171,
-40017,
-39848,
-39636,
-39451,
-39206,
-38965,
-38652,
-38302,
-37895,
-37428,
-36968,
-36465,
-35993,
-35557,
-35139,
-34812,
-34497,
-34256,
-34016,
-33802,
-33613,
-33432,
-33284,
-33141,
-33024,
-32919,
-32826,
-32715,
-32612,
-32480,
-32335,
-32171,
-32011,
-31827,
-31655,
-31489,
-31327,
-31209,
-31077,
-30977,
-30869,
-30747,
-30608,
-30419,
-30221,
-29983,
-29762,
-29541,
-29345,
-29194,
-29066,
-28969,
-28876,
-28823,
-28774,
-28770,
-28781,
-28842,
-28959,
-29088,
-29275,
-29436,
-29614,
-29781,
-29925,
-30090,
-30236,
-30414,
-30577,
-30769,
-30921,
-31070,
-31176,
-31258,
-31315,
-31361,
-31400,
-31441,
-31460,
-31510,
-31545,
-31614,
-31696,
-31777,
-31881,
-31954,
-32044,
-32094,
-32173,
-32234,
-32341,
-32458,
-32606,
-32771,
-32929,
-33105,
-33265,
-33427,
-33597,
-33738,
-33914,
-34057,
-34240,
-34444,
-34623,
-34857,
-35018,
-35208,
-35327,
-35435,
-35519,
-35581,
-35664,
-35725,
-35784,
-35836,
-35873,
-35919,
-35982,
-36050,
-36155,
-36274,
-36377,
-36500,
-36584,
-36656,
-36704,
-36764,
-36795,
-36849,
-36881,
-36914,
-36949,
-36966,
-36973,
-37031,
-37045,
-37149,
-37204,
-37318,
-37397,
-37487,
-37585,
-37673,
-37777,
-37896,
-37982,
-38060,
-38075,
-38045,
-37993,
-37938,
-37899,
-37919,
-37885,
-37892,
-37773,
-37663,
-37451,
-37275,
-37063,
-36932,
-36751,
-36632,
-36411,
-36210,
-35968,
-35703,
-35524,
-35280,
-35145,
-34943,
-34774,
-34561,
-34343,
-34134,
-33922,
-33726,
-33540,
-33365,
-33193,
-33026,
-32865,
-32698,
-32535,
-32361,
-32187,
-32022,
-31879,
-31721,
-31604,
-31440,
-31290,
-31090,
-30872,
-30659,
-30440,
-30286,
-30132,
-30026,
-29919,
-29813,
-29706,
-29595,
-29496,
-29433,
-29391,
-29403,
-29427,
-29524,
-29617,
-29774,
-29915,
-30098,
-30285,
-30480,
-30689,
-30903,
-31110,
-31340,
-31504,
-31697,
-31832,
-31993,
-32143,
-32318,
-32496,
-32650,
-32823,
-32914,
-33021,
-33067,
-33092,
-33143,
-33161,
-33176,
-33221,
-33188,
-33204,
-33151,
-33117,
-33072,
-33036,
-33014,
-33006,
-33012,
-33034,
-33055,
-33103,
-33159,
-33244,
-33311,
-33397,
-33442,
-33478,
-33461,
-33409,
-33295,
-33171,
-32991,
-32828,
-32636,
-32491,
-32304,
-32141,
-31938,
-31710,
-31450,
-31201,
-30906,
-30668,
-30386,
-30128,
-29841,
-29510,
-29172,
-28761,
-28381,
-27985,
-27621,
-27289,
-26987,
-26710,
-26481,
-26234,
-26063,
-25864,
-25747,
-25587,
-25482,
-25329,
-25182,
-25012,
-24837,
-24675,
-24543,
-24421,
-24329,
-24266,
-24230,
-24214,
-24222,
-24237,
-24279,
-24330,
-24391,
-24463,
-24532,
-24601,
-24661,
-24700,
-24719,
-24742,
-24768,
-24817,
-24906,
-24972,
-25109,
-25182,
-25308,
-25411,
-25526,
-25689,
-25831,
-26034,
-26217,
-26418,
-26608,
-26829,
-27047,
-27320,
-27610,
-27950,
-28334,
-28733,
-29211,
-29709,
-30282,
-30880,
-31493,
-32080,
-32607,
-33060,
-33488,
-33843,
-34252,
-34609,
-35023,
-35424,
-35791,
-36160,
-36477,
-36743,
-37007,
-37142,
-37294,
-37344,
-37394,
-37406,
-37470,
-37529,
-37637,
-37708,
-37766,
-37752,
-37698,
-37603,
-37526,
-37479,
-37523,
-37631,
-37818,
-38014,
-38217,
-38372,
-38460,
-38510,
-38457,
-38401,
-38261,
-38163,
-38069,
-38035,
-38035,
-38072,
-38086,
-38081,
-37984,
-37867,
-37652,
-37463,
-37213,
-37009,
-36774,
-36570,
-36332,
-36119,
-35871,
-35625,
-35406,
-35147,
-34934,
-34706,
-34501,
-34352,
-34215,
-34180,
-34186,
-34282,
-34413,
-34596,
-34769,
-34941,
-35097,
-35215,
-35322,
-35397,
-35476,
-35536,
-35607,
-35646,
-35693,
-35715,
-35736,
-35723,
-35708,
-35665,
-35613,
-35528,
-35431,
-35311,
-35151,
-34976,
-34791,
-34562,
-34378,
-34132,
-33958,
-33752,
-33603,
-33443,
-33338,
-33202,
-33104,
-32971,
-32917,
-32820,
-32819,
-32796,
-32822,
-32840,
-32813,
-32810,
-32728,
-32691,
-32600,
-32480,
-32393,
-32231,
-32120,
-31989,
-31886,
-31774,
-31657,
-31519,
-31387,
-31224,
-31089,
-30934,
-30798,
-30690,
-30587,
-30528,
-30468,
-30437,
-30373,
-30338,
-30261,
-30219,
-30166,
-30121,
-30083,
-30049,
-30038,
-30032,
-30062,
-30111,
-30187,
-30297,
-30368,
-30505,
-30572,
-30677,
-30762,
-30823,
-30904,
-30938,
-31005,
-31035,
-31077,
-31096,
-31127,
-31166,
-31220,
-31294,
-31397,
-31528,
-31673,
-31841,
-32054,
-32302,
-32600,
-32930,
-33249,
-33566,
-33882,
-34165,
-34472,
-34745,
-35040,
-35313,
-35603,
-35925,
-36224,
-36598,
-36885,
-37194,
-37452,
-37678,
-37899,
-38075,
-38247,
-38370,
-38435,
-38470,
-38439,
-38377,
-38293,
-38170,
-38046,
-37888,
-37782,
-37652,
-37617,
-37575,
-37552,
-37516,
-37422,
-37323,
-37188,
-37092,
-36983,
-36912,
-36814,
-36716,
-36611,
-36484,
-36336,
-36173,
-35976,
-35781,
-35581,
-35423,
-35277,
-35161,
-35046,
-34907,
-34762,
-34579,
-34377,
-34160,
-33910,
-33650,
-33401,
-33137,
-32918,
-32673,
-32427,
-32187,
-31942,
-31690,
-31509,
-31284,
-31186,
-31041,
-30978,
-30882,
-30852,
-30787,
-30797,
-30757,
-30770,
-30770,
-30787,
-30821,
-30867,
-30933,
-30992,
-31073,
-31129,
-31212,
-31278,
-31362,
-31416,
-31486,
-31552,
-31674,
-31804,
-31971,
-32081,
-32188,
-32221,
-32239,
-32275,
-32320,
-32403,
-32511,
-32618,
-32736,
-32794,
-32883,
-32886,
-32959,
-33007,
-33100,
-33221,
-33328,
-33450,
-33520,
-33580,
-33580,
-33590,
-33571,
-33585,
-33596,
-33640,
-33680,
-33740,
-33776,
-33807,
-33826,
-33815,
-33826,
-33809,
-33817,
-33792,
-33781,
-33713,
-33649,
-33545,
-33436,
-33319,
-33212,
-33076,
-32967,
-32828,
-32723,
-32587,
-32500,
-32385,
-32267,
-32132,
-31962,
-31751,
-31547,
-31281,
-31051,
-30784,
-30581,
-30384,
-30204,
-29979,
-29725,
-29453,
-29229,
-29101,
-29060,
-29065,
-29064,
-28994,
-28896,
-28762,
-28638,
-28499,
-28335,
-28134,
-27965,
-27858,
-27868,
-27985,
-28115,
-28231,
-28238,
-28227,
-28180,
-28197,
-28277,
-28392,
-28573,
-28732,
-28892,
-29074,
-29224,
-29423,
-29625,
-29844,
-30055,
-30217,
-30347,
-30425,
-30549,
-30712,
-31005,
-31345,
-31710,
-31903,
-31965,
-31784,
-31621,
-31546,
-31759,
-32182,
-32722,
-33162,
-33384,
-33452,
-33383,
-33399,
-33467,
-33625,
-33770,
-33915,
-34025,
-34174,
-34307,
-34447,
-34478,
-34454,
-34326,
-34195,
-34091,
-34062,
-34088,
-34214,
-34293,
-34358,
-34267,
-34089,
-33842,
-33657,
-33551,
-33572,
-33607,
-33566,
-33455,
-33225,
-33049,
-32894,
-32794,
-32677,
-32489,
-32244,
-32020,
-31833,
-31778,
-31714,
-31649,
-31467,
-31204,
-30926,
-30694,
-30576,
-30554,
-30547,
-30540,
-30455,
-30396,
-30326,
-30371,
-30412,
-30514,
-30533,
-30517,
-30452,
-30397,
-30352,
-30375,
-30387,
-30428,
-30444,
-30421,
-30402,
-30312,
-30308,
-30272,
-30373,
-30439,
-30548,
-30575,
-30529,
-30474,
-30434,
-30461,
-30559,
-30656,
-30747,
-30839,
-30906,
-31061,
-31191,
-31365,
-31496,
-31605,
-31700,
-31827,
-31972,
-32204,
-32395,
-32616,
-32730,
-32812,
-32818,
-32765,
-32748,
-32727,
-32809,
-32936,
-33094,
-33251,
-33324,
-33328,
-33283,
-33198,
-33123,
-33091,
-33094,
-33168,
-33281,
-33424,
-33578,
-33687,
-33780,
-33755,
-33766,
-33682,
-33692,
-33739,
-33874,
-34074,
-34293,
-34475,
-34604,
-34614,
-34589,
-34466,
-34394,
-34309,
-34327,
-34379,
-34486,
-34569,
-34626,
-34596,
-34537,
-34420,
-34293,
-34183,
-34063,
-33998,
-33965,
-33963,
-33997,
-34015,
-33979,
-33915,
-33837,
-33779,
-33823,
-33913,
-34092,
-34283,
-34461,
-34608,
-34699,
-34791,
-34820,
-34890,
-34917,
-35018,
-35145,
-35375,
-35610,
-35855,
-36028,
-36072,
-36044,
-35951,
-35879,
-35931,
-36030,
-36226,
-36349,
-36440,
-36356,
-36240,
-36034,
-35879,
-35772,
-35813,
-35918,
-36107,
-36228,
-36308,
-36267,
-36194,
-36141,
-36155,
-36261,
-36422,
-36556,
-36667,
-36699,
-36673,
-36656,
-36572,
-36511,
-36380,
-36229,
-36088,
-35977,
-35970,
-35995,
-36023,
-35980,
-35796,
-35511,
-35146,
-34796,
-34536,
-34347,
-34249,
-34143,
-33999,
-33750,
-33440,
-33025,
-32670,
-32311,
-32113,
-31968,
-31899,
-31876,
-31811,
-31774,
-31706,
-31602,
-31443,
-31218,
-30957,
-30767,
-30670,
-30765,
-30934,
-31152,
-31235,
-31237,
-31080,
-30862,
-30638,
-30402,
-30280,
-30212,
-30273,
-30398,
-30554,
-30641,
-30603,
-30402,
-30108,
-29766,
-29512,
-29408,
-29475,
-29711,
-30012,
-30295,
-30443,
-30444,
-30275,
-30082,
-29894,
-29878,
-29997,
-30303,
-30638,
-31013,
-31261,
-31416,
-31464,
-31428,
-31434,
-31458,
-31626,
-31866,
-32178,
-32509,
-32775,
-32981,
-33071,
-33056,
-32974,
-32826,
-32681,
-32587,
-32560,
-32626,
-32736,
-32845,
-32896,
-32835,
-32718,
-32567,
-32436,
-32390,
-32416,
-32468,
-32547,
-32571,
-32586,
-32586,
-32602,
-32617,
-32666,
-32684,
-32711,
-32712,
-32746,
-32764,
-32809,
-32837,
-32839,
-32897,
-32905,
-33038,
-33104,
-33192,
-33144,
-32981,
-32678,
-32359,
-32055,
-31909,
-31885,
-31955,
-32033,
-32011,
-31871,
-31644,
-31353,
-31158,
-31021,
-31040,
-31165,
-31356,
-31625,
-31858,
-32032,
-32086,
-32000,
-31857,
-31764,
-31795,
-32088,
-32487,
-32995,
-33346,
-33521,
-33510,
-33379,
-33323,
-33384,
-33686,
-34070,
-34501,
-34781,
-34874,
-34835,
-34726,
-34727,
-34836,
-35003,
-35124,
-35078,
-34918,
-34762,
-34733,
-34924,
-35172,
-35374,
-35345,
-35148,
-34895,
-34790,
-34909,
-35206,
-35541,
-35750,
-35781,
-35655,
-35514,
-35476,
-35542,
-35735,
-35912,
-36039,
-36091,
-36042,
-35990,
-35904,
-35807,
-35726,
-35616,
-35584,
-35559,
-35606,
-35598,
-35587,
-35410,
-35278,
-35080,
-35037,
-35018,
-35015,
-34912,
-34660,
-34376,
-34088,
-34056,
-34189,
-34438,
-34600,
-34521,
-34197,
-33751,
-33349,
-33210,
-33278,
-33580,
-33787,
-33914,
-33765,
-33517,
-33178,
-33020,
-32937,
-33066,
-33102,
-33057,
-32822,
-32535,
-32386,
-32418,
-32623,
-32773,
-32715,
-32389,
-31946,
-31596,
-31509,
-31646,
-31903,
-32047,
-32057,
-31921,
-31704,
-31526,
-31304,
-31217,
-31153,
-31274,
-31447,
-31635,
-31690,
-31612,
-31428,
-31269,
-31189,
-31112,
-31035,
-30804,
-30589,
-30379,
-30382,
-30495,
-30650,
-30624,
-30380,
-29914,
-29451,
-29103,
-29052,
-29170,
-29369,
-29480,
-29382,
-29216,
-28916,
-28650,
-28316,
-28011,
-27708,
-27621,
-27728,
-28029,
-28267,
-28300,
-28036,
-27660,
-27347,
-27254,
-27342,
-27467,
-27536,
-27578,
-27632,
-27713,
-27751,
-27580,
-27233,
-26846,
-26636,
-26746,
-27094,
-27424,
-27559,
-27428,
-27194,
-27015,
-27022,
-27149,
-27334,
-27433,
-27509,
-27551,
-27660,
-27827,
-28037,
-28238,
-28376,
-28436,
-28449,
-28443,
-28535,
-28727,
-29050,
-29487,
-29858,
-30202,
-30324,
-30379,
-30398,
-30525,
-30868,
-31328,
-31850,
-32256,
-32497,
-32596,
-32703,
-32887,
-33218,
-33536,
-33786,
-33910,
-34018,
-34231,
-34613,
-35059,
-35494,
-35741,
-35887,
-35934,
-36031,
-36127,
-36225,
-36303,
-36425,
-36636,
-36922,
-37174,
-37279,
-37145,
-36879,
-36626,
-36545,
-36642,
-36813,
-36978,
-37021,
-37005,
-36970,
-36941,
-36915,
-36868,
-36727,
-36578,
-36471,
-36442,
-36510,
-36611,
-36679,
-36628,
-36504,
-36290,
-36107,
-35959,
-35878,
-35818,
-35717,
-35595,
-35343,
-35130,
-34893,
-34725,
-34642,
-34553,
-34508,
-34389,
-34249,
-34014,
-33771,
-33496,
-33273,
-33101,
-33007,
-32962,
-32964,
-32964,
-32904,
-32835,
-32676,
-32564,
-32452,
-32443,
-32471,
-32629,
-32761,
-32936,
-33037,
-33048,
-32975,
-32801,
-32576,
-32362,
-32211,
-32186,
-32275,
-32400,
-32530,
-32509,
-32447,
-32282,
-32191,
-32148,
-32210,
-32293,
-32389,
-32511,
-32610,
-32737,
-32801,
-32771,
-32682,
-32540,
-32463,
-32476,
-32561,
-32657,
-32770,
-32863,
-32985,
-33106,
-33203,
-33193,
-33110,
-32977,
-32910,
-32959,
-33133,
-33321,
-33503,
-33580,
-33538,
-33378,
-33043,
-32643,
-32269,
-32091,
-32230,
-32574,
-32959,
-33079,
-32787,
-32223,
-31561,
-31202,
-31216,
-31613,
-32097,
-32487,
-32512,
-32310,
-31861,
-31506,
-31230,
-31232,
-31397,
-31681,
-32005,
-32270,
-32425,
-32491,
-32365,
-32168,
-31915,
-31732,
-31799,
-32087,
-32611,
-33132,
-33448,
-33427,
-33061,
-32570,
-32202,
-32146,
-32411,
-32868,
-33230,
-33400,
-33265,
-33014,
-32776,
-32714,
-32807,
-32992,
-33168,
-33296,
-33449,
-33627,
-33839,
-33948,
-33907,
-33748,
-33619,
-33685,
-33962,
-34376,
-34693,
-34795,
-34720,
-34578,
-34480,
-34529,
-34572,
-34732,
-34905,
-35199,
-35532,
-35798,
-35796,
-35535,
-35080,
-34692,
-34526,
-34615,
-34826,
-35063,
-35108,
-35103,
-34921,
-34695,
-34383,
-34018,
-33736,
-33578,
-33638,
-33837,
-34030,
-34125,
-34037,
-33827,
-33551,
-33334,
-33113,
-32978,
-32853,
-32778,
-32848,
-32971,
-33244,
-33469,
-33550,
-33448,
-33094,
-32717,
-32417,
-32374,
-32610,
-33017,
-33394,
-33556,
-33422,
-33009,
-32526,
-32165,
-32067,
-32282,
-32701,
-33130,
-33425,
-33467,
-33303,
-33051,
-32826,
-32758,
-32861,
-33119,
-33448,
-33775,
-34031,
-34163,
-34184,
-34053,
-33902,
-33753,
-33787,
-34045,
-34527,
-35094,
-35467,
-35484,
-35099,
-34621,
-34285,
-34485,
-35019,
-35696,
-36089,
-36051,
-35727,
-35391,
-35307,
-35446,
-35677,
-35744,
-35708,
-35602,
-35671,
-35860,
-36100,
-36142,
-35928,
-35500,
-35095,
-34894,
-35009,
-35355,
-35758,
-35989,
-35969,
-35643,
-35173,
-34649,
-34254,
-34035,
-34009,
-34121,
-34256,
-34305,
-34138,
-33783,
-33222,
-32670,
-32191,
-31934,
-31844,
-31886,
-32005,
-32096,
-32169,
-32001,
-31602,
-30899,
-30135,
-29595,
-29529,
-29944,
-30542,
-30952,
-30845,
-30256,
-29437,
-28767,
-28458,
-28623,
-29061,
-29654,
-30043,
-30061,
-29588,
-28712,
-27928,
-27578,
-27990,
-28803,
-29522,
-29567,
-29021,
-28251,
-27922,
-28099,
-28614,
-28923,
-28954,
-28931,
-29223,
-29835,
-30333,
-30178,
-29390,
-28570,
-28529,
-29642,
-31295,
-32635,
-32799,
-32046,
-30975,
-30491,
-30782,
-31602,
-32363,
-32847,
-33069,
-33289,
-33519,
-33700,
-33699,
-33550,
-33428,
-33369,
-33358,
-33332,
-33386,
-33705,
-34368,
-35058,
-35288,
-34666,
-33497,
-32437,
-32308,
-33149,
-34377,
-35055,
-34775,
-33831,
-33070,
-33057,
-33763,
-34519,
-34818,
-34458,
-33928,
-33605,
-33718,
-33980,
-34144,
-34058,
-33898,
-33814,
-33838,
-33781,
-33548,
-33107,
-32711,
-32474,
-32438,
-32463,
-32447,
-32356,
-32236,
-32042,
-31696,
-31158,
-30577,
-30235,
-30360,
-30859,
-31381,
-31473,
-30991,
-30228,
-29612,
-29572,
-29987,
-30575,
-30867,
-30702,
-30269,
-29866,
-29772,
-29984,
-30292,
-30490,
-30442,
-30274,
-30079,
-30047,
-30025,
-30032,
-29905,
-29793,
-29853,
-30091,
-30490,
-30656,
-30404,
-29758,
-28996,
-28633,
-28853,
-29566,
-30341,
-30766,
-30673,
-30244,
-29749,
-29514,
-29542,
-29792,
-30092,
-30383,
-30567,
-30678,
-30693,
-30691,
-30740,
-30837,
-30905,
-30862,
-30749,
-30639,
-30851,
-31336,
-31901,
-32167,
-31854,
-31179,
-30608,
-30661,
-31379,
-32354,
-32915,
-32734,
-31980,
-31172,
-30832,
-31034,
-31502,
-31920,
-32070,
-32109,
-32069,
-32053,
-31877,
-31574,
-31259,
-31125,
-31392,
-31860,
-32364,
-32590,
-32513,
-32266,
-31987,
-31795,
-31696,
-31725,
-31918,
-32315,
-32812,
-33150,
-33154,
-32722,
-32131,
-31718,
-31818,
-32431,
-33272,
-33967,
-34162,
-33870,
-33243,
-32691,
-32430,
-32636,
-33189,
-33898,
-34460,
-34786,
-34718,
-34448,
-34063,
-33760,
-33658,
-33793,
-34166,
-34679,
-35223,
-35643,
-35795,
-35633,
-35164,
-34654,
-34293,
-34348,
-34762,
-35442,
-36024,
-36300,
-36174,
-35738,
-35245,
-34899,
-34838,
-35043,
-35406,
-35753,
-35956,
-35962,
-35813,
-35610,
-35502,
-35422,
-35384,
-35186,
-34917,
-34652,
-34642,
-34946,
-35392,
-35677,
-35475,
-34838,
-34100,
-33632,
-33723,
-34140,
-34616,
-34805,
-34682,
-34411,
-34128,
-33894,
-33630,
-33358,
-33190,
-33294,
-33699,
-34173,
-34460,
-34330,
-33918,
-33456,
-33191,
-33163,
-33338,
-33550,
-33875,
-34219,
-34563,
-34668,
-34444,
-33925,
-33463,
-33369,
-33763,
-34457,
-35001,
-35162,
-34927,
-34571,
-34402,
-34507,
-34788,
-35003,
-35047,
-34995,
-34950,
-35057,
-35176,
-35210,
-35034,
-34654,
-34361,
-34243,
-34553,
-35011,
-35441,
-35516,
-35158,
-34566,
-33991,
-33770,
-33941,
-34420,
-34957,
-35343,
-35433,
-35234,
-34752,
-34185,
-33702,
-33498,
-33734,
-34291,
-34954,
-35341,
-35202,
-34527,
-33652,
-33007,
-32981,
-33600,
-34555,
-35298,
-35363,
-34681,
-33499,
-32409,
-31881,
-32109,
-32962,
-33901,
-34572,
-34618,
-34099,
-33242,
-32364,
-31693,
-31354,
-31394,
-31738,
-32340,
-32922,
-33255,
-33049,
-32300,
-31267,
-30410,
-30216,
-30734,
-31740,
-32597,
-32964,
-32613,
-31955,
-31415,
-31406,
-31903,
-32601,
-33037,
-32981,
-32441,
-31785,
-31391,
-31556,
-32203,
-33085,
-33823,
-34145,
-34018,
-33598,
-33088,
-32769,
-32646,
-32792,
-33069,
-33401,
-33685,
-33846,
-33887,
-33806,
-33687,
-33558,
-33472,
-33452,
-33438,
-33481,
-33551,
-33734,
-34029,
-34481,
-34895,
-35196,
-35103,
-34644,
-33869,
-33162,
-32877,
-33272,
-34327,
-35586,
-36504,
+32293,
+32505,
+33560,
+34437,
+34924,
+36205,
+36979,
+37566,
+38106,
 36568,
-35697,
-34239,
-32833,
+35319,
+34392,
+32579,
+31695,
+30956,
+30242,
+30090,
+30384,
+31217,
+32494,
+33352,
+32929,
+32577,
+32092,
+30824,
+28910,
+26575,
+24708,
+22930,
+21337,
+20580,
+20344,
+20725,
+21042,
+21350,
+22394,
+22845,
+22733,
+22391,
+21623,
+20989,
+21313,
+22130,
+23280,
+25715,
+28592,
+32381,
+36157,
+39085,
+42265,
+44256,
+44590,
+43962,
+43260,
+42234,
+40372,
+39013,
+38367,
+38342,
+38708,
+39392,
+40620,
+41875,
+42324,
+41368,
+39922,
+38349,
+35787,
+32309,
+28940,
+26665,
+25011,
+23897,
+24040,
+25460,
+27554,
+29880,
+32661,
+35413,
+37738,
+39246,
+39464,
+38877,
+37993,
+36847,
+35198,
+33481,
+32440,
+31969,
 32140,
-32405,
-33444,
-34714,
-35537,
-35603,
-34827,
-33648,
-32507,
-31891,
-31880,
-32419,
-33123,
-33711,
-33957,
-33779,
-33345,
-32794,
-32339,
-32113,
-32144,
-32348,
-32585,
-32657,
-32519,
-32168,
-31754,
-31451,
-31323,
-31445,
-31679,
-31872,
-31869,
-31470,
-30829,
-30088,
-29761,
-30015,
-30888,
-31848,
-32308,
-31871,
-30726,
-29535,
-29058,
-29433,
-30447,
-31233,
-31473,
-31031,
-30418,
-30041,
-30002,
-30172,
-30327,
-30437,
-30583,
-30788,
-30888,
-30746,
-30334,
-29989,
-29990,
-30441,
-31035,
-31378,
-31238,
-30828,
-30492,
-30456,
-30652,
-30780,
-30738,
-30663,
-30836,
-31357,
-31972,
-32242,
-31860,
-31045,
-30205,
-29951,
-30364,
-31239,
-32045,
-32398,
-32225,
-31696,
-31204,
-30964,
-31039,
-31347,
-31608,
-31724,
-31621,
-31376,
-31182,
-31150,
-31347,
-31698,
-32007,
-32087,
-31804,
-31159,
-30369,
-29771,
+32880,
+33930,
+35021,
+36045,
+36701,
+36578,
+36239,
+35643,
+34471,
+33211,
+32157,
+31554,
+31744,
+32432,
+34288,
+36743,
+38285,
+39461,
+40273,
+40366,
+40664,
+39810,
+37051,
+34970,
+32977,
+31288,
+31138,
+30835,
+30551,
+30698,
+30932,
+31967,
+32951,
+32606,
+31735,
+30962,
 29640,
-30127,
-31031,
-31928,
-32412,
-32180,
-31348,
-30250,
-29339,
-28963,
-29180,
-29915,
-30808,
-31604,
-31952,
-31761,
-31052,
-30125,
-29354,
-29036,
-29273,
-29906,
-30632,
-31217,
-31451,
-31380,
-30983,
-30417,
-29839,
-29479,
-29634,
-30226,
-31149,
-31805,
-31943,
-31355,
-30444,
-29680,
-29541,
-30084,
-31054,
-32025,
-32628,
-32695,
-32260,
-31516,
-30677,
-30103,
-29990,
-30503,
-31492,
-32559,
-33345,
-33448,
-32975,
-32117,
-31257,
-30721,
-30594,
-30952,
-31677,
-32579,
-33416,
-33840,
-33749,
-33168,
-32427,
-31918,
-31823,
-32191,
-32739,
-33340,
-33770,
-34101,
-34204,
-34145,
-33840,
-33527,
-33370,
-33607,
-34106,
-34596,
-34695,
-34369,
-33802,
-33395,
-33429,
-33786,
-34236,
-34428,
-34250,
-33875,
-33426,
-33048,
-32752,
-32542,
-32499,
-32652,
-32970,
-33246,
-33285,
-32957,
-32424,
-31890,
-31627,
-31624,
-31845,
-32079,
-32307,
-32439,
-32475,
-32352,
-32062,
-31712,
-31521,
-31626,
-32015,
-32510,
-32774,
-32715,
-32421,
-32110,
-32072,
-32273,
-32618,
-32863,
-32913,
-32786,
-32666,
-32623,
-32771,
-32978,
-33190,
-33347,
-33390,
-33443,
-33438,
-33489,
-33494,
-33543,
-33675,
-33914,
-34303,
-34670,
-34904,
-34862,
-34637,
-34372,
-34362,
-34632,
-35186,
-35762,
-36172,
-36338,
-36255,
-36100,
-35941,
-35889,
-35924,
-36072,
-36338,
-36696,
-37071,
-37332,
-37281,
-36881,
-36214,
+28154,
+26709,
+25298,
+24000,
+23037,
+22498,
+22415,
+23154,
+23925,
+24056,
+24673,
+25094,
+25341,
+24770,
+23508,
+22012,
+20032,
+20369,
+20717,
+21441,
+24099,
+28062,
+32392,
+35142,
+38593,
+41602,
+42747,
+41944,
+40004,
+39841,
+38875,
+37121,
+37098,
+38854,
+41257,
+42777,
+44519,
+46743,
+48306,
+47552,
+44244,
+41153,
+38106,
+33715,
+28860,
+25553,
+24649,
+24140,
+24664,
+26567,
+29496,
+32746,
+34833,
+36135,
+36783,
+36896,
+35945,
+33650,
+31389,
+29985,
+29452,
+29173,
+29466,
+31063,
+33217,
+35267,
+36531,
+37471,
+38310,
+37930,
+36503,
+34580,
+33321,
+32948,
+32141,
+31576,
+32215,
+33759,
+35280,
+37400,
+39433,
+40160,
+40393,
+39466,
+38438,
+37676,
+36164,
+34257,
+32152,
+30778,
+30319,
+30619,
+30985,
+30595,
+30309,
+30408,
+30758,
+30873,
+30799,
+30455,
+29951,
+29941,
+29929,
+30633,
+31274,
+30929,
+29974,
+28910,
+28943,
+28554,
+27342,
+25883,
+24992,
+25029,
+24975,
+25117,
+24998,
+23572,
+22349,
+20183,
+18575,
+19908,
+19513,
+19369,
+21904,
+26284,
+30362,
+33511,
+36638,
+38511,
+40142,
+39573,
+38855,
+40156,
+39652,
+39066,
+40636,
+43905,
+46560,
+47910,
+48931,
+49035,
+48259,
+45159,
+40336,
+36390,
+32729,
+28590,
+25285,
+24936,
+26446,
+27817,
+29737,
+31842,
+34206,
+36006,
+36310,
 35651,
-35461,
-35854,
-36548,
-37189,
-37344,
-36994,
-36346,
-35867,
-35664,
-35736,
-35784,
-35697,
-35620,
-35714,
-36044,
-36370,
-36342,
-35787,
-34966,
-34228,
-33983,
-34196,
-34594,
-34951,
-35036,
-34995,
-34758,
-34386,
-33913,
-33517,
-33555,
-34091,
-34900,
-35299,
-34881,
-33595,
-32196,
+34710,
+34121,
+32787,
+31425,
+31234,
+31831,
+32639,
+33245,
+34218,
+35738,
+37131,
+37361,
+36506,
+35828,
+35228,
+34074,
+32604,
+31375,
+31279,
+31648,
+31657,
+32225,
+33409,
+34556,
+35244,
+35738,
+37162,
+37976,
+37252,
+36622,
+35642,
+34817,
+34272,
+32883,
+31720,
+30835,
+30149,
+30524,
+31303,
 31476,
-31940,
-33302,
-34723,
-35414,
-35132,
-34152,
-33152,
-32498,
-32297,
-32390,
-32536,
-32736,
-32968,
-33305,
-33627,
-33877,
-33870,
-33644,
-33133,
-32536,
-31916,
-31640,
-31777,
-32429,
-33232,
-33835,
-33936,
-33576,
-33129,
-32832,
-32852,
-32891,
-32735,
-32353,
-32092,
-32379,
-33282,
-34497,
-35360,
-35428,
-34714,
-33641,
-32775,
-32452,
-32694,
-33236,
-33995,
-34653,
-35185,
-35297,
-34925,
-34143,
-33230,
-32623,
-32548,
-32969,
-33633,
-34252,
-34687,
-34911,
-34925,
-34698,
-34211,
-33609,
-33146,
-33007,
-33298,
-33718,
-34083,
-34234,
-34245,
-34287,
-34351,
-34212,
-33767,
-32968,
-32196,
-31877,
-32163,
-32844,
-33471,
-33537,
-33134,
-32403,
-31881,
-31652,
+31591,
+32175,
+32564,
+32882,
+33217,
+33087,
+32690,
+32387,
 31733,
-31781,
-31681,
-31364,
-31021,
-30818,
-30883,
-31198,
-31658,
-32043,
-32097,
-31702,
-30911,
-30077,
-29603,
-29767,
-30445,
-31212,
-31604,
-31334,
-30637,
-29810,
-29342,
-29251,
-29472,
-29713,
-29928,
-30048,
-30297,
-30538,
-30796,
-30712,
-30349,
-29754,
-29413,
-29562,
-30306,
-31267,
-31843,
-31681,
-30789,
-29734,
-29209,
-29583,
-30700,
-31988,
-32775,
-32747,
-32005,
-30970,
-30086,
+30900,
+30523,
+30247,
+29135,
+28082,
+28124,
+27809,
+26704,
+26359,
+26380,
+26428,
+25552,
+24365,
+22546,
+19890,
+18065,
+16242,
+16054,
+16698,
+18237,
+20451,
+25930,
+31680,
+33485,
+36222,
+36717,
+36608,
+36942,
+36271,
+37708,
+39439,
+40844,
+43645,
+49054,
+52725,
+52738,
+51576,
+49000,
+45242,
+40086,
+34954,
+31278,
+29113,
+27903,
+27160,
+28812,
+32263,
+33884,
+33881,
+33563,
+32783,
+31383,
+30405,
+29988,
+30147,
+31634,
+32949,
+34186,
+35780,
+37032,
+37057,
+35578,
+33995,
+33278,
+33350,
+33547,
+33829,
+34386,
+35168,
+35430,
+34745,
+34053,
+33305,
+32374,
+31689,
+31485,
+32257,
+34232,
+36127,
+37242,
+39363,
+40355,
+39915,
+39897,
+37219,
+35054,
+34284,
+31920,
+30717,
+30604,
+30724,
+32023,
+33487,
+33492,
+33665,
+34040,
+32764,
+31709,
+30981,
+29809,
+29129,
+28942,
+28993,
+29857,
+30711,
+30582,
+30180,
+29270,
+28156,
+26708,
+25405,
+24698,
+24543,
+25399,
+25767,
+26368,
+24903,
+22858,
+20657,
+16568,
+16100,
+15556,
+15182,
+18488,
+24078,
 29664,
-29828,
-30558,
-31596,
-32646,
-33292,
-33324,
-32791,
-32011,
-31411,
-31221,
-31503,
-31960,
-32488,
-32892,
-33221,
-33367,
-33284,
-32812,
-32109,
-31398,
-31069,
-31268,
-31904,
-32636,
-33172,
-33383,
-33358,
-33208,
-32992,
-32685,
-32256,
-31807,
-31426,
-31256,
-31333,
-31596,
-32086,
-32629,
+33030,
+35773,
+36249,
+36394,
+35854,
+34795,
+36779,
+38521,
+40425,
+45016,
+50431,
+53397,
+53606,
+51719,
+47689,
+42760,
+37481,
+33087,
+31148,
+30926,
+30909,
+31464,
+33634,
+35388,
+34912,
+33314,
+30787,
+28252,
+26564,
+26601,
+28522,
+31282,
+34296,
+36557,
+38086,
+38660,
+38447,
+37120,
+34763,
+32996,
+32766,
+34084,
+35809,
+37672,
+38993,
+38852,
+37394,
+34878,
+32305,
+30704,
+29759,
+29389,
+30579,
+32358,
+34549,
+36436,
+36980,
+36840,
+35334,
+34489,
+33897,
+32859,
+32771,
+32630,
+33247,
+33616,
+33949,
+35170,
+34984,
+33463,
+32310,
+31393,
+30887,
+31424,
+31483,
+31308,
+31925,
+32301,
+32314,
+32860,
 33190,
-33387,
-33094,
-32279,
-31311,
-30824,
-31135,
-32169,
-33328,
-33835,
-33484,
-32435,
-31498,
-31107,
-31414,
-31957,
-32260,
-32104,
-31679,
-31442,
-31632,
-32177,
-32711,
-32801,
-32413,
-31724,
-31207,
-31121,
-31538,
-32134,
-32603,
-32696,
-32485,
-32193,
-32026,
-32092,
-32243,
-32373,
-32402,
-32393,
-32476,
-32688,
-32977,
-33103,
-33010,
-32593,
-32087,
-31658,
-31588,
-31969,
-32696,
-33572,
-34196,
-34390,
-33961,
-33142,
-32226,
-31606,
-31593,
-32138,
-33089,
-33959,
-34438,
-34253,
-33575,
-32706,
-32047,
-31928,
-32316,
-33056,
-33785,
-34208,
-34271,
-34019,
-33639,
-33267,
-32975,
-32740,
-32687,
-32750,
-33132,
-33610,
-34072,
-34146,
-33739,
-32931,
+32351,
+31464,
+30999,
+30304,
+29218,
+28409,
+27315,
+27014,
+27129,
+26014,
+26745,
+25401,
+22185,
+21015,
+16636,
+13598,
+13732,
+13394,
+15405,
+20234,
+25656,
+28765,
+31690,
+32754,
+33425,
+35912,
+35300,
+36639,
+40906,
+43404,
+46225,
+50909,
+53765,
+52790,
+50571,
+46929,
+43115,
+40657,
+37701,
+35430,
+35324,
+35247,
+33604,
+32391,
+32037,
+30249,
+28190,
+26308,
+24683,
+25040,
+26288,
+28220,
+30670,
+33046,
+34709,
+35331,
+35746,
+35927,
+36080,
+36249,
+36506,
+37222,
+38911,
+40567,
+40935,
+40824,
+39889,
+37860,
+35332,
+32934,
+31959,
+32045,
+32311,
+33055,
+33569,
+33770,
+33656,
+32345,
+31433,
+30576,
+29887,
+31272,
+32057,
+31919,
+32428,
+32334,
+31812,
+31847,
+32364,
+32377,
+32188,
+32386,
+32792,
+33940,
+34595,
+33662,
+32843,
+32479,
+32146,
+32452,
+32875,
+33067,
+33155,
+32629,
+31208,
+29843,
+28010,
+25258,
+23753,
+23920,
+24940,
+25127,
+25359,
+24658,
+21956,
+20478,
+17194,
+15099,
+14712,
+13944,
+17119,
+22396,
+29078,
+32607,
+33568,
+34299,
+33658,
+34363,
+35008,
+38042,
+42167,
+44086,
+46950,
+51534,
+53937,
+51956,
+48746,
+45550,
+42253,
+39936,
+38783,
+38790,
+39190,
+37968,
+34590,
+31686,
+29848,
+27340,
+25120,
+24424,
+24934,
+26728,
+28658,
+30848,
+33451,
+34837,
+34942,
+34807,
+35277,
+36368,
+37685,
+38819,
+39910,
+41246,
+42140,
+41749,
+40446,
+39239,
+38049,
+36392,
+34590,
+33554,
+33653,
+33672,
+33178,
+33022,
 32142,
-31707,
-31867,
-32393,
-32945,
-33151,
-32946,
-32518,
-32120,
-31963,
-31939,
-31979,
-31844,
-31560,
-31159,
-30777,
-30573,
-30553,
-30806,
-31089,
-31352,
-31325,
-31084,
-30652,
-30358,
-30269,
-30464,
-30686,
-30773,
-30623,
-30369,
-30246,
-30402,
-30845,
-31232,
-31361,
-30995,
-30400,
-29927,
-29990,
-30651,
-31602,
-32333,
-32429,
-31892,
-31154,
-30648,
-30752,
-31168,
-31679,
-31769,
-31590,
-31261,
-31205,
-31443,
-31897,
-32241,
-32352,
-32251,
-32106,
-32084,
-32197,
-32342,
-32443,
-32409,
-32352,
-32347,
-32482,
-32741,
-33028,
-33215,
-33215,
-33093,
-32980,
-33075,
-33429,
-33999,
-34506,
-34751,
-34598,
-34154,
-33690,
-33465,
-33570,
-34031,
-34494,
-34917,
-34986,
-34913,
+31085,
+30012,
+28962,
+29420,
+29951,
+31951,
+32792,
+31864,
+32248,
+30912,
+30697,
+31438,
+31790,
+33097,
+33155,
+33423,
+34056,
+34670,
+34455,
+33548,
+33090,
+32094,
+32337,
+33083,
+32702,
+32643,
+32543,
+30941,
+28694,
+27597,
+26588,
+24583,
+23132,
+22942,
+23347,
+24206,
+25106,
+24988,
+23291,
+21092,
+18541,
+16037,
+15507,
+16488,
+17820,
+20723,
+27153,
+31403,
+31329,
+31297,
+30571,
+30615,
+30933,
+32454,
+37475,
+41710,
+43973,
+47350,
+51344,
+50914,
+47609,
+45715,
+43773,
+42365,
+42720,
+42770,
+42578,
+42178,
+38725,
+33639,
+30433,
+28696,
+26922,
+26072,
+27157,
+28685,
+30073,
+30903,
+31484,
+32055,
+31954,
+32071,
+33183,
+35013,
+37013,
+38782,
+39445,
+39389,
+39527,
+39507,
+39381,
+39437,
+39772,
+39660,
+38734,
+37325,
+36223,
+35726,
 34644,
-34461,
-34285,
-34212,
-34164,
-34203,
-34405,
-34773,
-35275,
-35641,
-35690,
-35313,
-34718,
-34235,
-34205,
-34632,
-35309,
-35756,
-35769,
-35316,
-34725,
-34327,
-34268,
-34506,
-34771,
-34935,
-34891,
-34820,
-34732,
-34806,
-34916,
-35099,
-35176,
-35106,
-34769,
-34295,
-33842,
-33685,
-34033,
-34703,
-35504,
-35923,
-35852,
-35294,
-34601,
-34055,
-33789,
-33793,
-33904,
-34106,
-34368,
-34739,
-35115,
-35341,
-35268,
-34854,
-34259,
-33716,
-33458,
-33621,
-34087,
-34712,
-35194,
-35329,
-35087,
-34542,
-33983,
-33695,
-33802,
-34281,
-34852,
-35178,
-35083,
-34554,
-33937,
-33564,
-33749,
-34378,
-35134,
-35527,
-35258,
-34430,
-33447,
-32776,
-32689,
-33088,
-33623,
-34099,
-34260,
-34291,
-34150,
-33889,
-33494,
-32988,
-32664,
-32621,
-32916,
-33335,
-33481,
-33342,
+34059,
+33854,
+33319,
+33722,
+33622,
 32936,
+33066,
+32519,
+31895,
+33295,
+32498,
+30718,
+31189,
+30574,
+31172,
+33252,
+34464,
+34233,
+33578,
+32981,
+32186,
+32807,
+31846,
+30944,
+32116,
+31942,
+32010,
+32505,
+32052,
+31513,
+30997,
+29398,
+27248,
+26283,
+25185,
+23793,
+24151,
+24805,
+25100,
+24991,
+24455,
+23342,
+21197,
+19737,
+17257,
+16397,
+17847,
+19141,
+22286,
+27202,
+29836,
+28936,
+27826,
+26795,
+27536,
+29550,
+32184,
+37334,
+41852,
+44013,
+46656,
+50156,
+49194,
+46067,
+45462,
+44296,
+43506,
+44556,
+44875,
+44065,
+42553,
+38337,
+33239,
+30625,
+29348,
+28105,
+28279,
+29134,
+29205,
+29009,
+28198,
+27711,
+27754,
+27807,
+28829,
+31386,
+33920,
+36016,
+37531,
+37520,
+37102,
+36825,
+36939,
+37758,
+39215,
+40559,
+41063,
+40905,
+39824,
+38711,
+37521,
+36737,
+36745,
+36392,
+36615,
+36849,
+36355,
+35660,
+34674,
+33221,
 32620,
-32454,
-32479,
-32427,
-32420,
-32447,
-32672,
-32893,
-32775,
-32129,
-31153,
-30489,
-30618,
-31560,
+33422,
+31959,
+29984,
+29727,
+28792,
+29133,
+30056,
+30268,
+30934,
+30846,
+30319,
+30834,
+31307,
+30309,
+29635,
+30293,
+30704,
+31707,
+33184,
+33362,
+33771,
+34092,
+32472,
+30983,
+29430,
+26449,
+24306,
+24502,
+26045,
+27504,
+28018,
+26313,
+23617,
+21615,
+19033,
+17176,
+16523,
+16097,
+16472,
+19402,
+26015,
+30251,
+30064,
+28466,
+25681,
+25354,
+27492,
+31165,
+37702,
+42755,
+44442,
+46456,
+49711,
+50078,
+47839,
+47451,
+47246,
+46072,
+46093,
+46393,
+46579,
+45439,
+40965,
+35434,
+31667,
+29699,
+29251,
+29927,
+30253,
+29292,
+27588,
+25277,
+23626,
+24278,
+25611,
+27185,
+29884,
+31686,
+33198,
+35390,
+36331,
+36042,
+35526,
+35747,
+37239,
+39591,
+42010,
+43694,
+43742,
+41964,
+39650,
+38595,
+39275,
+39864,
+40107,
+39860,
+39365,
+38997,
+37518,
+35545,
+33117,
+31018,
+30613,
+29909,
+28380,
+27820,
+27445,
+26276,
+25228,
+25073,
+25971,
+26984,
+27368,
+27995,
+29184,
+29536,
+29618,
+30638,
+31471,
+32381,
+33709,
+34527,
+35614,
+36236,
+35155,
+33266,
+31027,
+28521,
+27022,
+26977,
+26960,
+27278,
+27579,
+25973,
+23052,
+19665,
+16939,
+14761,
+13299,
+14054,
+16167,
+21171,
+27037,
+28446,
+27051,
+24673,
+22680,
+23768,
+27338,
+32405,
+38793,
+44242,
+46775,
+49689,
+52260,
+50267,
+48379,
+48911,
+48908,
+49219,
+50198,
+50562,
+49786,
+46494,
+40401,
+34850,
+31387,
+29265,
+29429,
+30270,
+29679,
+28368,
+26127,
+23033,
+20854,
+20834,
+22028,
+24315,
+27583,
+29970,
+32522,
+34987,
+35754,
+35803,
+36014,
+36953,
+38816,
+41576,
+44172,
+45862,
+45981,
+44005,
+42205,
+41762,
+42100,
+42618,
+42581,
+42166,
+41705,
+40473,
+38050,
+35446,
+32794,
+30762,
+30374,
+29440,
+27685,
+26760,
+25803,
+24823,
+24220,
+23881,
+24535,
+25405,
+25903,
+27312,
+28771,
+29254,
+29964,
+31160,
+31926,
+32645,
+33773,
+34535,
+35348,
+35799,
+34476,
+32364,
+30317,
+29022,
+28918,
+28701,
+27952,
+26756,
+24632,
+22014,
+19304,
+16365,
+13730,
+12307,
+12960,
+14991,
+18349,
+23582,
+26909,
+25641,
+22715,
+20963,
+21715,
+24740,
+29116,
+35916,
+42720,
+45903,
+47628,
+49912,
+50411,
+48847,
+49054,
+50959,
+51713,
+52156,
+52796,
+52861,
+50970,
+45890,
+39876,
+35218,
+31858,
+30426,
+30798,
+31041,
+29789,
+26879,
+23232,
+19575,
+17436,
+17797,
+19812,
+23116,
+26182,
+28478,
+31322,
+33335,
+33680,
+34149,
+35113,
+36647,
+39185,
+42180,
+44975,
+46707,
+46711,
+45622,
+44740,
+44401,
+44261,
+44400,
+44363,
+43955,
+43454,
+42047,
+39348,
+36338,
+33725,
+31666,
+30622,
+29860,
+28308,
+26733,
+25704,
+25104,
+24652,
+24130,
+23742,
+23302,
+23373,
+24286,
+25844,
+27922,
+29442,
+30198,
+31186,
+32222,
+33104,
+34083,
+35262,
+35776,
+34920,
+33605,
+32541,
+31822,
+31454,
+30758,
+29381,
+27266,
+24846,
+22799,
+20419,
+17383,
+14751,
+13739,
+14229,
+15759,
+19223,
+23375,
+24628,
+22967,
+20360,
+19015,
+20575,
+23759,
+28671,
+35912,
+41899,
+44802,
+46869,
+48623,
+48856,
+48753,
+50350,
+52464,
+53429,
+53760,
+54148,
+54184,
+51876,
+46659,
+41636,
+37564,
+34010,
+32316,
+31760,
+30976,
+29006,
+25410,
+21121,
+17555,
+15735,
+15697,
+17865,
+21017,
+23356,
+25779,
+28086,
+29188,
+29807,
+30724,
+32542,
+35199,
+38207,
+41566,
+44759,
+46598,
+46821,
+46694,
+46697,
+46503,
+46667,
+47185,
+47590,
+47737,
+47066,
+45527,
+42982,
+39691,
+36546,
+33878,
+31957,
+30581,
+29482,
+28350,
+26636,
+24695,
+22923,
+21839,
+21839,
+21981,
+22086,
+22473,
+23060,
+24166,
+25640,
+27132,
+28627,
+30122,
+31553,
+32687,
+33434,
+33755,
+33637,
+33546,
+33223,
+32634,
+32145,
+31552,
+30798,
+29501,
+27343,
+24474,
+21287,
+18054,
+15784,
+15574,
+16478,
+18714,
+22661,
+24861,
+23878,
+21515,
+19085,
+18227,
+19486,
+22702,
+28548,
+35295,
+40119,
+43477,
+45968,
+46590,
+46214,
+47341,
+49731,
+51840,
+53279,
+54354,
+55584,
+55370,
+51987,
+47551,
+43804,
+40040,
+36756,
+34978,
+33900,
+32581,
+30554,
+27362,
+23495,
+20286,
+18059,
+17577,
+18900,
+20430,
+22259,
+24585,
+25978,
+26520,
+27286,
+28696,
+31087,
+33884,
+36817,
+40123,
+42936,
+44433,
+45074,
+45577,
+45908,
+46149,
+46756,
+47537,
+48134,
+48443,
+47731,
+46081,
+43882,
+41103,
+38614,
+36320,
+34003,
+32273,
+30921,
+29422,
+27778,
+26109,
+24537,
+23400,
+22545,
+21855,
+21641,
+21823,
+21996,
+22606,
+23745,
+24676,
+26017,
+27831,
+29314,
+30642,
+31522,
+31706,
+32072,
 32593,
-33028,
-32465,
-31416,
-30601,
-30576,
-31143,
-31674,
-31634,
-31018,
-30285,
-29977,
-30174,
-30638,
-30951,
-30979,
-30877,
-30868,
-30991,
+32687,
+32652,
+32541,
+32149,
+31527,
+30641,
+29380,
+27406,
+24566,
+21334,
+18163,
+16024,
+16144,
+18070,
+21586,
+25301,
+26083,
+24144,
+21086,
+17968,
+16875,
+18411,
+22470,
+29352,
+36396,
+41369,
+44371,
+45680,
+45316,
+44616,
+45603,
+47446,
+49489,
+51939,
+53910,
+54810,
+53656,
+50276,
+46478,
+43206,
+39872,
+37234,
+35776,
+34619,
+33129,
+30920,
+28233,
+25151,
+22166,
+19962,
+19035,
+19366,
+20208,
+21798,
+23931,
+25586,
+26794,
+28135,
+29844,
+31832,
+33879,
+36400,
+39506,
+42000,
+43458,
+44390,
+45009,
+45497,
+46199,
+47279,
+48447,
+49073,
+48794,
+47511,
+45572,
+43252,
+40988,
+39192,
+37445,
+35802,
+34440,
+32948,
 31090,
-30895,
-30432,
-29948,
-29779,
-30172,
-30966,
-31782,
-32201,
-32028,
-31452,
-30794,
-30456,
-30437,
-30660,
-30873,
-31093,
-31372,
-31897,
-32437,
-32767,
-32487,
-31706,
-30808,
-30341,
-30616,
-31404,
-32213,
-32552,
-32347,
-31909,
-31573,
-31617,
-31847,
-32077,
-32108,
-31986,
-31846,
-31860,
-32011,
-32162,
-32267,
-32228,
-32201,
-32294,
+28870,
+26830,
+25113,
+23136,
+21382,
+20663,
+20878,
+21252,
+21626,
+22538,
+23647,
+24311,
+25048,
+26308,
+27792,
+29165,
+30631,
+32325,
+33703,
+34245,
+34100,
+33452,
 32525,
-32812,
-33011,
-32963,
-32766,
-32549,
-32462,
-32556,
-32659,
-32687,
-32573,
-32473,
-32503,
-32684,
-32790,
-32662,
-32253,
-31784,
-31586,
-31740,
-32092,
-32268,
-32065,
-31549,
-31055,
-30923,
-31170,
-31634,
-31989,
-32058,
-31887,
-31572,
-31325,
-31165,
-31174,
-31343,
-31654,
-32025,
-32315,
-32430,
-32316,
-32151,
-32072,
-32198,
-32536,
-32840,
-33001,
-32855,
-32531,
-32203,
-32100,
-32270,
-32631,
-32917,
-32998,
-32818,
-32546,
-32378,
-32378,
-32513,
-32624,
-32676,
-32674,
-32738,
-32833,
-32914,
-32855,
-32778,
-32793,
-33062,
-33556,
-33938,
-34004,
-33672,
-33250,
-33174,
-33646,
-34487,
-35193,
-35252,
-34551,
-33499,
-32750,
-32942,
-33972,
-35432,
-36391,
-36430,
-35568,
-34380,
-33606,
-33473,
-33881,
-34336,
-34651,
-34802,
-35117,
-35512,
-35782,
-35530,
-34680,
-33631,
-33022,
-33174,
-34002,
-34926,
-35531,
-35620,
-35445,
-35124,
-34765,
-34258,
-33764,
-33487,
-33791,
-34481,
-35174,
-35245,
-34550,
-33537,
-32887,
-33156,
-34082,
-35128,
-35411,
-34853,
-33623,
-32512,
-31928,
-32137,
-32776,
-33536,
-33934,
-33890,
-33355,
-32640,
-31936,
-31608,
-31646,
-32000,
-32387,
-32588,
-32508,
-32210,
-31834,
-31553,
-31383,
-31294,
-31242,
-31205,
-31239,
-31442,
-31741,
-32013,
-32044,
-31616,
-30923,
-30228,
-30019,
-30451,
-31291,
-32049,
-32185,
-31682,
-30869,
-30308,
-30261,
-30672,
-31123,
-31414,
-31473,
-31495,
-31516,
-31452,
-31101,
-30505,
-29956,
-29873,
-30388,
-31300,
-32056,
-32247,
-31851,
-31216,
+31820,
+31293,
+30985,
 30812,
-30884,
-31290,
-31749,
-31930,
-31876,
-31727,
-31751,
-31942,
-32215,
-32279,
-32121,
-31861,
-31833,
-32181,
-32776,
-33247,
-33280,
-32939,
-32611,
-32696,
-33296,
-34036,
-34400,
-34179,
-33565,
-33070,
-33018,
-33337,
-33697,
-33936,
-34077,
-34409,
-34983,
-35481,
-35609,
-35109,
-34425,
-33939,
-34096,
-34654,
-35282,
-35622,
-35637,
-35590,
-35514,
-35390,
-35024,
-34541,
-34308,
-34674,
-35612,
-36614,
-37059,
-36604,
-35651,
-34780,
-34533,
-34887,
-35404,
-35735,
-35734,
-35690,
-35695,
-35817,
-35738,
-35392,
-34912,
-34575,
-34666,
-35041,
-35401,
-35522,
-35274,
-34945,
-34593,
-34320,
-34017,
-33600,
-33277,
-33143,
-33392,
-33847,
-34244,
-34338,
-34041,
-33515,
-32945,
-32487,
-32203,
-32122,
-32267,
-32619,
-33093,
-33468,
-33521,
-33092,
-32342,
-31545,
-31190,
-31442,
-32187,
-33024,
-33330,
-32905,
-31801,
-30620,
-29924,
-30130,
-31065,
-32214,
-32920,
-32775,
-31874,
-30599,
-29478,
-28858,
-28781,
-29166,
-29805,
-30605,
+29907,
+27785,
+24664,
+20978,
+17939,
+16645,
+17294,
+19945,
+23962,
+26490,
+25944,
+23691,
+20654,
+18243,
+18104,
+20628,
+26186,
+33335,
+38833,
+42657,
+45515,
+45851,
+44506,
+44680,
+46321,
+47903,
+49733,
+51622,
+52949,
+52970,
+50957,
+48207,
+45709,
+42669,
+39416,
+36977,
+34819,
+32508,
+30416,
+28660,
+26771,
+24986,
+23640,
+22340,
+21026,
+19767,
+19283,
+20247,
+21985,
+24177,
+27314,
+30466,
+32745,
+34458,
+36009,
+37388,
+38470,
+39450,
+40575,
+42316,
+44349,
+46475,
+48716,
+49827,
+49527,
+48477,
+46504,
+44038,
+41920,
+40323,
+39144,
+38021,
+36800,
+35760,
+34337,
+31677,
+28436,
+25583,
+23258,
+22001,
+21912,
+22398,
+23156,
+23436,
+23008,
+22715,
+22844,
+23328,
+24801,
+27085,
+29205,
+31123,
+32667,
+33302,
+33610,
+33694,
+33428,
+33101,
+32684,
+32353,
+32184,
+31769,
+31117,
+30428,
+29078,
+26828,
+24052,
+20880,
+17589,
+15118,
+14481,
+15759,
+19043,
+23142,
+25303,
+25247,
+23837,
+21542,
+20012,
+20363,
+23305,
+29420,
+36642,
+42882,
+47727,
+50354,
+49899,
+47983,
+46789,
+46022,
+45800,
+47221,
+49623,
+51814,
+52589,
+51260,
+48774,
+45318,
+40789,
+36530,
+33496,
+31503,
+30269,
+30120,
+30301,
+29788,
+28960,
+27433,
+24899,
+22358,
+20725,
+20894,
+22885,
+25661,
+29049,
+32707,
+35376,
+36313,
+35959,
+35290,
+34639,
+34736,
+36417,
+39603,
+43494,
+46635,
+48176,
+47988,
+46191,
+43550,
+41222,
+39587,
+38587,
+38406,
+38656,
+38650,
+38046,
+36300,
+33373,
+29955,
+26453,
+23788,
+22670,
+22674,
+23388,
+24629,
+25803,
+26483,
+26425,
+25667,
+24937,
+25059,
+26090,
+27779,
+30014,
+32141,
+33616,
+34341,
+34330,
+33886,
+33339,
+32966,
+32943,
+32864,
+32416,
+32014,
+31457,
+30427,
+29216,
+27728,
+25752,
+23511,
+20899,
+18055,
+15402,
+13067,
+12329,
+13972,
+17357,
+22199,
+26550,
+28494,
+28361,
+26794,
+24844,
+23920,
+25615,
+30447,
+37280,
+44608,
+50496,
+53686,
+53554,
+50591,
+47147,
+44544,
+43081,
+43817,
+46685,
+49442,
+50569,
+49618,
+46814,
+42995,
+38789,
+34820,
+32033,
+30700,
+29872,
+29432,
+29484,
+29290,
+29041,
+28751,
+27736,
+26238,
+24755,
+23692,
+23625,
+24636,
+26819,
+30219,
+33769,
+36389,
+37950,
+38573,
+38162,
+37133,
+36433,
+36809,
+38744,
+41488,
+44132,
+46286,
+46813,
+45413,
+42924,
+40020,
+37448,
+35583,
+34580,
+34227,
+33884,
+33460,
+32794,
+31745,
+30064,
+27736,
+25720,
+24520,
+23815,
+23430,
+23882,
+25410,
+27199,
+28415,
+29140,
+29886,
+30244,
+29731,
+29359,
+30063,
+31529,
+33236,
+35130,
+36658,
+37177,
+36682,
+35163,
+32911,
+30779,
+29340,
+28449,
+27808,
+27609,
+27566,
+26774,
+24798,
+22020,
+19005,
+16227,
+13734,
+11797,
+11267,
+12517,
+15746,
+20812,
+25894,
+29290,
+31088,
+31150,
+29671,
+28082,
+28133,
+31012,
+36810,
+43982,
+50697,
+56030,
+58333,
+56487,
+52767,
+48940,
+45261,
+43495,
+44638,
+47133,
+49560,
+50472,
+49037,
+45851,
+41285,
+35933,
+31274,
+28356,
+26558,
+25662,
+25848,
+26136,
+26502,
+26903,
+26389,
+25133,
+23693,
+22297,
+21474,
+21901,
+23806,
+27138,
 31389,
-31951,
-31863,
-30984,
-29357,
-27712,
-26857,
-27442,
-29300,
-31573,
-33036,
-32938,
-31295,
-29086,
-27383,
-27076,
-28097,
-29887,
-31576,
-32499,
-32492,
-31704,
-30603,
-29636,
-29099,
-29157,
-29599,
-30248,
-30861,
-31281,
-31602,
-31711,
-31644,
-31237,
-30603,
-29977,
-29740,
-30176,
-31084,
-32122,
-32639,
-32574,
-32022,
+35101,
+37764,
+39790,
+40503,
+40089,
+39546,
+39341,
+40073,
+41808,
+43954,
+45995,
+47221,
+46823,
+44679,
+41281,
+37229,
+33685,
 31526,
-31414,
-31696,
-32135,
-32349,
-32288,
-32061,
-31914,
-32007,
-32292,
-32676,
-33005,
-33213,
-33215,
-32927,
-32380,
-31692,
-31221,
-31172,
-31679,
-32438,
-33100,
-33301,
-32972,
-32311,
-31661,
-31244,
-31226,
-31491,
-31921,
-32413,
-32762,
-32953,
-32813,
-32414,
-31861,
-31374,
-31234,
-31518,
-32189,
-32937,
-33416,
-33446,
-32981,
-32343,
-31793,
-31589,
-31770,
-32163,
-32576,
-32872,
-32974,
-32868,
-32621,
-32212,
-31844,
-31541,
-31574,
-31839,
-32374,
-32826,
-33057,
-32898,
-32521,
-32143,
-32098,
-32385,
-32872,
-33152,
-33094,
-32701,
-32344,
-32313,
-32659,
-33180,
-33539,
-33599,
-33537,
-33549,
-33752,
-33988,
-34001,
-33805,
-33539,
-33531,
-33789,
-34082,
-34096,
-33799,
-33413,
-33414,
-33765,
-34278,
-34455,
-34174,
-33701,
-33426,
-33640,
-34027,
-34247,
-33991,
-33494,
-33203,
-33397,
-33949,
-34409,
-34357,
-33908,
-33341,
-33145,
-33352,
-33767,
-34085,
-34166,
-34118,
-34051,
-34033,
-33960,
-33764,
-33523,
-33384,
-33521,
-33853,
-34187,
-34311,
-34146,
-33793,
-33477,
-33293,
+30609,
+30505,
+30675,
+30533,
+29681,
+27890,
+25388,
+23327,
+22178,
+21741,
+22239,
+23612,
+25416,
+27144,
+28401,
+29405,
+30470,
+31450,
+32368,
+33420,
+34449,
+35288,
+36146,
+37023,
+37570,
+37780,
+37604,
+36650,
+35152,
 33338,
-33478,
-33697,
-33854,
-34000,
-34068,
-34052,
-33950,
-33725,
-33457,
-33232,
-33117,
-33199,
-33439,
-33737,
-33952,
-33976,
-33792,
-33500,
-33239,
-33181,
-33308,
-33569,
-33787,
-33855,
-33754,
-33548,
-33383,
-33283,
-33374,
-33509,
-33725,
-33866,
-33920,
-33861,
-33719,
-33572,
-33473,
-33484,
-33625,
-33873,
-34131,
-34276,
-34117,
-33681,
-33109,
-32751,
-32949,
-33632,
-34431,
-34753,
-34218,
-33122,
-32061,
-31772,
-32338,
-33389,
-34148,
-34276,
-33799,
-33217,
-32852,
-32678,
-32492,
-32167,
-31921,
-32085,
-32731,
-33507,
-33853,
-33499,
-32625,
-31857,
-31534,
-31779,
-32169,
-32441,
-32451,
-32413,
-32340,
-32235,
-31902,
-31378,
-30983,
-31018,
-31502,
-32065,
-32211,
-31802,
-31146,
-30739,
-30919,
-31439,
-31920,
-31998,
-31773,
-31574,
-31628,
-31850,
-31972,
-31780,
-31463,
-31330,
-31557,
-32048,
-32424,
-32429,
-32161,
-31874,
-31869,
-32118,
-32380,
-32465,
-32362,
-32264,
-32403,
-32708,
-33076,
-33221,
-33145,
-32873,
-32608,
-32418,
-32408,
-32622,
-33085,
-33743,
-34366,
-34701,
-34591,
-34203,
-33887,
-33926,
-34322,
-34726,
-34808,
-34518,
-34176,
-34261,
-34930,
-35884,
-36554,
-36474,
-35742,
-34763,
-34210,
-34333,
-35029,
-35911,
-36490,
-36726,
-36598,
-36401,
-36202,
-36003,
-35739,
-35396,
-35043,
-34940,
-35169,
-35757,
+31273,
+29258,
+27417,
+26134,
+25569,
+25398,
+25212,
+24211,
+22004,
+19150,
+16066,
+13469,
+11724,
+10805,
+11214,
+13309,
+17272,
+22776,
+28152,
+31938,
+34580,
+35918,
+35459,
+34418,
+34650,
+36963,
+41250,
+46893,
+53144,
+58666,
+61613,
+61129,
+58464,
+54469,
+49388,
+45122,
+43335,
+43584,
+44953,
+46145,
+46209,
+44569,
+40884,
+35883,
+30627,
+26148,
+22679,
+20422,
+19757,
+20031,
+21068,
+22854,
+24358,
+25032,
+24852,
+23963,
+22961,
+22210,
+22510,
+24743,
+28572,
+33371,
+38358,
+42747,
+45391,
+45419,
+43613,
+41145,
+38930,
+37877,
+38353,
+40126,
+42371,
+43880,
+43694,
+41519,
+37714,
+33225,
+29212,
+26421,
+25222,
+25526,
+26977,
+28485,
+28925,
+28405,
+27288,
+25824,
+24473,
+23766,
+24074,
+25380,
+27356,
+29619,
+31963,
+33971,
+35271,
+35976,
+36098,
+35728,
+35226,
+34885,
+34955,
+35421,
+36031,
+36545,
+36555,
+35890,
+34415,
+32356,
+30065,
+27766,
+25968,
+24715,
+23918,
+23561,
+23228,
+22155,
+20270,
+18014,
+15724,
+13997,
+13154,
+13167,
+13930,
+15768,
+18952,
+23650,
+29035,
+33507,
+37205,
+40108,
+41085,
+40512,
+40019,
+40587,
+42724,
+46493,
+51556,
+57077,
+61092,
+61895,
+60126,
+56672,
+51253,
+45198,
+41217,
+40049,
+40799,
+42221,
+43159,
+42888,
+40470,
+35771,
+30108,
+25059,
+21371,
+19257,
+19099,
+20095,
+21435,
+23051,
+24225,
+24472,
+24135,
+23799,
+23729,
+23705,
+23758,
+24816,
+27295,
+30542,
+34305,
+38477,
+42103,
+43927,
+43452,
+41213,
+38392,
+36265,
+35512,
 36466,
-36957,
-36994,
-36493,
-35701,
-34902,
-34497,
-34537,
-35033,
-35622,
-36090,
-36126,
-35753,
-35031,
-34299,
-33783,
-33660,
-33918,
-34319,
-34657,
-34644,
-34321,
-33702,
-33119,
-32674,
-32512,
-32507,
-32534,
-32554,
-32534,
-32627,
-32691,
-32632,
-32139,
-31263,
-30260,
-29682,
-29897,
-30837,
-31995,
-32596,
-32334,
-31279,
-30037,
-29196,
-28970,
-29309,
-29812,
-30290,
-30546,
-30664,
-30556,
-30347,
-30017,
-29714,
-29541,
-29447,
-29365,
-29213,
-29063,
-29168,
-29577,
-30160,
-30508,
-30308,
-29594,
-28857,
-28595,
-29036,
-29820,
-30367,
-30217,
-29560,
-28883,
-28818,
-29475,
-30466,
-31213,
-31213,
-30581,
-29625,
-28995,
-28928,
-29541,
-30446,
-31243,
-31543,
-31243,
-30616,
-30101,
-30164,
-30755,
-31622,
-32028,
-31757,
-30806,
-29863,
-29492,
-30042,
-31157,
-32284,
-32808,
+39030,
+41943,
+43953,
+43952,
+41376,
+37124,
+32809,
+29621,
+27942,
+28045,
+29589,
+31549,
+32689,
+32472,
+31453,
+29912,
+28033,
+26503,
+25756,
+25783,
+26485,
+27760,
+29135,
+30340,
+31574,
+32673,
+33477,
+33790,
+33588,
+33317,
+33042,
+32671,
 32672,
-32057,
-31468,
-31026,
-30839,
-30712,
-30599,
-30648,
-30895,
-31486,
-32111,
-32605,
-32613,
-32213,
-31474,
-30783,
-30369,
-30383,
-30775,
-31310,
-31741,
-31877,
-31744,
-31430,
-31251,
-31205,
-31385,
-31532,
-31556,
-31380,
-31098,
-30938,
-30967,
-31248,
-31634,
+33351,
+34324,
+34861,
+34352,
+32943,
+31126,
+29187,
+27630,
+26689,
+26325,
+26492,
+26651,
+26330,
+25508,
+24165,
+22534,
+21146,
+20101,
+19566,
+19920,
+20578,
+20898,
+21297,
+23068,
+27385,
+32696,
+37082,
+40617,
+43030,
+43560,
+41834,
+39348,
+38409,
+39422,
+41990,
+45994,
+50905,
+54849,
+55661,
+53982,
+50882,
+46251,
+41117,
+37337,
+36015,
+36523,
+37357,
+38064,
+38275,
+37092,
+34329,
+30833,
+27440,
+24520,
+22281,
+21089,
+20669,
+20623,
+21025,
+21963,
+23339,
+24453,
+25034,
+25222,
+24661,
+23710,
+23596,
+25080,
+28131,
+32248,
+36943,
+41279,
+43871,
+43979,
+42094,
+39547,
+37437,
+36705,
+37922,
+40546,
+43398,
+45258,
+45239,
+43068,
+39366,
+35249,
+31955,
+30068,
+29408,
+29982,
+31305,
+32326,
+32462,
+31703,
+30280,
+28467,
+26673,
+25481,
+25280,
+25902,
+27063,
+28708,
+30703,
+32687,
+34195,
+34938,
+34877,
+34244,
+33542,
+33141,
+33348,
+34155,
+35283,
+36384,
+36880,
+36404,
+35275,
+33548,
+31237,
+29186,
+28048,
+27985,
+28705,
+29535,
+29971,
+29918,
+29008,
+27319,
+25600,
+24158,
+23122,
+22812,
+23082,
+23685,
+24196,
+24312,
+24445,
+25339,
+28413,
+33154,
+37354,
+40446,
+42188,
+42139,
+40764,
+38321,
+36201,
+36020,
+37663,
+40777,
+45170,
+48944,
+49918,
+48760,
+46180,
+41926,
+36988,
+32952,
+30755,
+30977,
+32261,
+33066,
+33817,
+33919,
+32661,
+30399,
+27458,
+24243,
+21629,
+20249,
+20005,
+20981,
+23085,
+25783,
+28515,
+30668,
+31072,
+29965,
+28603,
+27081,
+26605,
+28211,
+31264,
+35469,
+39900,
+42946,
+44223,
+43691,
+41094,
+37697,
+35295,
+34174,
+34550,
+36300,
+38242,
+39858,
+40604,
+39462,
+37292,
+35480,
+33414,
+31496,
+30291,
+29316,
+29395,
+30133,
+30560,
+31030,
+31376,
+31115,
+30469,
+29745,
+28699,
+27900,
+28088,
+28984,
+30618,
+32695,
+34660,
+36435,
+37257,
+36901,
+36205,
+35389,
+34907,
+35108,
+35923,
+37248,
+38437,
+39118,
+39072,
+38266,
+36545,
+33964,
+31487,
+29602,
+28816,
+29041,
+29603,
+30241,
+30335,
+29774,
+28637,
+26877,
+24996,
+23554,
+22725,
+22521,
+22892,
+23091,
+22954,
+22493,
+21644,
+23473,
+27784,
 31976,
-32222,
-32246,
-32084,
-31718,
-31230,
-30808,
-30665,
-30944,
-31533,
-32228,
-32647,
-32667,
-32306,
-31830,
-31411,
-31271,
-31298,
-31546,
-31925,
-32358,
-32761,
-32904,
-32707,
-32195,
-31662,
-31382,
-31627,
-32221,
-32966,
-33458,
-33590,
-33329,
-32883,
-32419,
-32104,
-31998,
-32147,
-32478,
-32991,
-33487,
-33841,
-33945,
-33724,
-33355,
-32894,
-32608,
-32533,
-32769,
-33197,
-33684,
-33994,
-34062,
-33836,
-33545,
-33376,
-33482,
-33791,
+36262,
+38795,
+39292,
+38580,
+35709,
+32851,
+32136,
+33034,
+35607,
+40140,
+44328,
+45230,
+44481,
+42954,
+40025,
+36908,
+33767,
+31800,
+32704,
+34008,
+34041,
+34247,
 34130,
-34218,
-34080,
-33756,
-33561,
-33562,
-33805,
-34047,
-34200,
-34117,
-33993,
-33828,
-33820,
-33836,
-33894,
-33931,
-33959,
-34062,
-34163,
-34250,
-34218,
-34029,
-33799,
-33618,
-33652,
-33919,
-34290,
-34609,
-34693,
-34509,
-34187,
-33871,
-33746,
-33825,
-34068,
-34396,
-34729,
-35008,
-35142,
-35104,
+33146,
+32032,
+30510,
+28731,
+27494,
+26694,
+25788,
+25858,
+26868,
+27786,
+29652,
+31321,
+31196,
+30680,
+29882,
+28488,
+28091,
+28800,
+30252,
+32900,
+36164,
+38963,
+40891,
+41499,
+40204,
+38408,
+37144,
+35813,
+35476,
+36286,
+37684,
+39776,
+40878,
+40374,
+39175,
+37203,
+34552,
+31694,
+29475,
+28414,
+28685,
+30014,
+31254,
+32257,
+32646,
+32050,
+30839,
+29124,
+27857,
+27890,
+29118,
+31360,
+33918,
+36364,
+38424,
+39458,
+39344,
+38434,
+37571,
+37209,
+37357,
+38079,
+39077,
+39891,
+40260,
+39901,
+39002,
+37722,
+35957,
+34013,
+31913,
+29934,
+28261,
+26888,
+25975,
+25209,
+24514,
+23836,
+22944,
+22016,
+20927,
+19800,
+18947,
+18337,
+18453,
+19216,
+19829,
+20329,
+20797,
+20999,
+22874,
+26423,
+29760,
+33201,
+35732,
+37113,
+37966,
+37263,
+36059,
+36153,
+37204,
+38805,
+41531,
+44514,
+45572,
+45661,
+45136,
+43097,
+40889,
+38337,
+35537,
 34783,
-34331,
-33847,
-33577,
-33602,
-33891,
-34318,
-34684,
-34926,
-34947,
-34776,
-34406,
-33938,
-33490,
-33233,
-33283,
-33615,
-34065,
-34423,
-34517,
-34369,
-34073,
-33781,
-33575,
-33494,
-33526,
-33660,
-33914,
-34222,
-34545,
-34711,
-34651,
-34354,
-33933,
-33529,
-33329,
-33315,
-33538,
-33818,
-34110,
-34254,
-34217,
-33957,
-33502,
-32964,
-32505,
-32290,
-32436,
-32882,
-33453,
-33883,
-33929,
-33576,
-32890,
-32198,
-31715,
-31679,
-32007,
-32620,
-33226,
-33684,
-33819,
-33616,
-33197,
-32614,
-32176,
-31935,
-32070,
-32491,
-33093,
-33577,
-33785,
-33554,
-32932,
-32182,
-31556,
-31363,
-31685,
-32353,
-33060,
-33461,
-33358,
-32854,
-32192,
-31782,
-31685,
-31986,
-32402,
-32789,
-33061,
-33166,
-33172,
-33025,
-32755,
-32403,
-32122,
-32080,
-32358,
-32844,
-33396,
-33727,
-33839,
-33678,
-33430,
-33133,
-32920,
-32792,
-32806,
-32987,
-33264,
-33628,
-33874,
-34034,
-33995,
-33876,
-33736,
-33635,
-33650,
-33716,
-33920,
-34177,
-34499,
-34792,
-35015,
-35077,
-35010,
-34806,
-34622,
-34554,
-34620,
-34861,
-35152,
-35396,
-35527,
-35486,
-35375,
-35233,
-35178,
-35213,
-35341,
-35479,
-35559,
-35558,
-35467,
-35349,
-35248,
-35197,
-35204,
-35195,
-35166,
-35099,
-35046,
-35046,
-35115,
-35170,
-35156,
-35043,
-34844,
-34748,
-34728,
-34848,
-34955,
-34916,
-34746,
-34456,
-34258,
-34198,
-34265,
-34360,
-34331,
-34163,
-33900,
-33691,
-33555,
-33557,
+35257,
+35124,
+35064,
+35024,
+33970,
+32180,
+30440,
+28228,
+26418,
+26182,
+26169,
+26963,
+28866,
+30010,
+30916,
+31908,
+31680,
+30856,
+30366,
+29989,
+30347,
+31817,
 33572,
-33531,
-33398,
-33160,
-32916,
-32703,
-32566,
-32468,
-32393,
-32317,
-32226,
-32160,
-32114,
-32069,
-32054,
-31993,
-31929,
-31846,
-31721,
-31589,
-31423,
-31298,
-31272,
-31357,
-31537,
-31639,
+35253,
+37272,
+39003,
+39593,
+39484,
+38376,
+36744,
+35977,
+35728,
+35778,
+36571,
+37726,
+38543,
+38877,
+38219,
+36525,
+34631,
+32942,
+31488,
+30916,
+31505,
+32542,
+33619,
+34304,
+34258,
+33850,
+33214,
+32526,
+32318,
+32937,
+34104,
+35525,
+37167,
+38561,
+39367,
+39462,
+38903,
+38079,
+37359,
+36762,
+36258,
+36061,
+36150,
+36324,
+36416,
+36141,
+35189,
+33628,
+31787,
+29673,
+27498,
+25657,
+24242,
+23347,
+22718,
+22146,
+21566,
+21093,
+20790,
+20351,
+19917,
+19740,
+19856,
+20387,
+21278,
+22170,
+22891,
+23544,
+24167,
+24778,
+25374,
+26071,
+27054,
+28604,
+31171,
+34045,
+36239,
+37590,
+37947,
+37380,
+36610,
+36098,
+35814,
+36119,
+36881,
+37686,
+38817,
+39750,
+39755,
+39217,
+38494,
+37386,
+36276,
+35533,
+34980,
+35286,
+36333,
+36891,
+37082,
+37191,
+36812,
+36174,
+35642,
+34975,
+34432,
+34559,
+34823,
+34855,
+34790,
+34341,
+33702,
+33302,
+32725,
+31906,
+31343,
+31050,
+31187,
 31664,
-31387,
-31114,
-30803,
-30704,
-30842,
-31086,
-31361,
-31475,
-31418,
-31214,
-30941,
-30682,
-30491,
-30363,
-30320,
-30352,
-30499,
-30661,
-30891,
-30939,
-30896,
-30643,
-30333,
-30082,
-30009,
-30160,
-30446,
-30758,
-30931,
-30922,
-30730,
-30460,
-30240,
-30129,
-30173,
-30346,
-30549,
-30786,
-30907,
-30975,
-30913,
-30802,
-30703,
-30659,
-30775,
-30969,
-31230,
-31425,
-31474,
-31349,
-31103,
-30831,
-30650,
-30647,
-30799,
-31071,
-31333,
-31496,
-31512,
-31390,
-31223,
-31066,
-31065,
-31156,
-31351,
-31540,
-31646,
-31648,
-31566,
-31469,
-31432,
-31466,
-31540,
-31596,
-31601,
-31581,
-31629,
-31761,
-32007,
-32255,
-32425,
+32148,
+32761,
+33582,
+34285,
+34625,
+34660,
+34455,
+34164,
+34289,
+34732,
+35147,
+35791,
+36428,
+36910,
+37066,
+36794,
+36401,
+35880,
+35611,
+35748,
+35915,
+36234,
+36547,
+36905,
+37292,
+37273,
+36814,
+35969,
+35107,
+34615,
+34303,
+34192,
+34413,
+34443,
+34139,
+33609,
+32928,
+32251,
+31762,
+31352,
+30928,
+30778,
+31005,
+31435,
+31627,
+31285,
+30566,
+29686,
+28772,
+27908,
+27130,
+26584,
+26177,
+25760,
+25604,
+25889,
+26304,
+26514,
+26421,
+26201,
+26109,
+26029,
+25849,
+25885,
+25827,
+25137,
+24404,
+23916,
+23967,
+24860,
+25822,
+26414,
+26766,
+26614,
+26217,
+26147,
+26512,
+27885,
+30000,
+31848,
+33614,
+35417,
+36483,
+36949,
+37177,
+37088,
+37065,
+37269,
+37822,
+38852,
+39903,
+40348,
+40382,
+40302,
+39734,
+39124,
+38614,
+37999,
+37661,
+37478,
+36985,
+36330,
+36058,
+35776,
+35584,
+35595,
+35334,
+34871,
+34311,
+33386,
+32389,
+31821,
+31424,
+31626,
+32381,
+32713,
+32740,
+32724,
+32434,
+32541,
+33439,
+34491,
+35870,
+37331,
+38303,
+38704,
+38611,
+38052,
+37391,
+37193,
+37325,
+37623,
+38033,
+38213,
+38506,
+38494,
+37649,
+36567,
+35358,
+34037,
+33153,
+32938,
+33036,
+33179,
+33284,
+32985,
+32583,
+32265,
+31824,
+31413,
+31438,
+31855,
+32161,
+32383,
+32512,
+32748,
+33036,
+33387,
+33815,
+33800,
+33351,
+32707,
+32164,
+31814,
+31794,
+31639,
+31167,
+30586,
+29611,
+28585,
+27280,
+25922,
+25069,
+24605,
+24508,
+24629,
+24900,
+25498,
+26268,
+26138,
+25306,
+24489,
+23590,
+23546,
+24601,
+26014,
+27400,
+28368,
+28898,
+29786,
+30870,
+31726,
+32285,
+32359,
+32424,
+32891,
+34238,
+36042,
+37687,
+38658,
+38107,
+36688,
+35465,
+34968,
+35060,
+35288,
+35747,
+35969,
+35525,
+34543,
+33858,
+33548,
+32775,
+31585,
+30355,
+29625,
+29648,
+30285,
+31213,
+31895,
+32185,
 32347,
-32122,
-31787,
-31553,
-31529,
-31754,
-32117,
-32508,
-32670,
-32674,
-32412,
-32116,
-31831,
-31685,
-31687,
-31832,
-32073,
-32364,
-32655,
-32871,
-32937,
-32874,
-32661,
-32410,
-32224,
-32168,
-32272,
-32523,
-32784,
-33035,
-33170,
-33145,
-33047,
-32832,
-32665,
-32555,
-32535,
-32622,
-32727,
-32865,
-32943,
-32973,
-32913,
-32807,
-32662,
-32536,
-32453,
-32464,
-32493,
-32557,
-32571,
-32563,
-32549,
-32549,
-32579,
-32623,
-32618,
-32612,
-32607,
-32639,
-32729,
-32774,
-32756,
-32659,
-32483,
-32404,
-32391,
+32456,
+32878,
+33804,
+34925,
+35547,
+35412,
+35145,
+35131,
+35449,
+36183,
+37072,
+37707,
+37877,
+37917,
+37918,
+37973,
+37903,
+37474,
+37034,
+36758,
+36691,
+36529,
+36241,
+35767,
+35132,
+34444,
+33736,
+33104,
+32380,
+32063,
+32284,
+32595,
+32870,
+32697,
+32249,
+31896,
+31574,
+31555,
+31991,
+32760,
+33437,
+33727,
+33685,
+33720,
+34175,
+34705,
+35033,
+35163,
+35049,
+34696,
+34381,
+33982,
+33426,
+33058,
+33221,
+33416,
+33267,
+32845,
+31907,
+31097,
+30763,
+30377,
+29917,
+29606,
+28976,
+28866,
+29161,
+28919,
+28118,
+27402,
+27943,
+28384,
+28311,
+28378,
+28459,
+29395,
+30252,
+30514,
+30994,
+30818,
+30780,
+32465,
+34320,
+34419,
+33221,
+32830,
+33905,
+35566,
+36694,
+36503,
+35606,
+34799,
+34239,
+34952,
+35419,
+34503,
+33613,
+33637,
+34102,
+33339,
+32602,
+32009,
+30784,
+30325,
+29689,
+29225,
+29645,
+29120,
+28587,
+28372,
+27954,
+27372,
+26914,
+27469,
+28079,
+29008,
+29850,
+30178,
+30247,
+29913,
+30263,
+31148,
+32752,
+33760,
+33998,
+34283,
+33968,
+34038,
+34105,
+34212,
+34597,
+34768,
+34738,
+34610,
+34817,
+34998,
+34706,
+34430,
+34685,
+34779,
+34787,
+35017,
+35300,
+35547,
+35683,
+35529,
+35071,
+34952,
+34621,
+34381,
+34478,
+34709,
+34709,
+34379,
+34297,
+34239,
+34345,
+34480,
+34377,
+34262,
+34251,
+34347,
+34390,
+34408,
+34398,
+34224,
+34121,
+33806,
+33505,
+33388,
+33136,
+33099,
+33056,
+32957,
+32880,
 32543,
-32664,
-32763,
-32655,
-32476,
-32230,
-32115,
-32123,
-32263,
-32432,
-32556,
-32631,
-32635,
-32637,
-32577,
-32423,
-32190,
-31917,
-31808,
-31908,
-32253,
-32642,
-32884,
-32848,
-32588,
-32239,
-32017,
-31973,
-32100,
-32305,
-32514,
-32678,
-32779,
-32770,
-32699,
-32492,
-32323,
-32185,
-32224,
-32328,
-32460,
-32474,
-32367,
-32159,
-31981,
-31937,
-32031,
-32266,
-32483,
-32621,
-32620,
-32518,
-32358,
-32210,
-32092,
-32007,
+31799,
+31176,
+30899,
+30340,
+30247,
+30535,
+30735,
+31114,
+31406,
 31963,
-32005,
-32122,
-32317,
-32517,
-32632,
-32617,
-32498,
-32374,
-32293,
-32346,
-32476,
-32658,
-32829,
-32932,
-32942,
-32854,
-32697,
-32485,
-32384,
-32357,
-32538,
-32746,
-32966,
-33042,
-32976,
-32828,
-32644,
-32567,
-32575,
-32725,
-32935,
-33169,
-33362,
-33458,
-33443,
-33273,
-33038,
-32793,
-32642,
-32698,
-32914,
-33294,
+32429,
+32621,
+32834,
+33157,
+33666,
+34215,
+35389,
+36322,
+36535,
+36626,
+36781,
+36871,
+36631,
+36750,
+36471,
+36183,
+36503,
+36489,
+36410,
+35961,
+35403,
+34703,
+34225,
+34014,
+33547,
+32995,
+32070,
+31521,
+30909,
+30674,
+30711,
+30628,
+29885,
+28903,
+27992,
+27486,
+27698,
+27877,
+28780,
+28787,
+28357,
+28972,
+29341,
+29778,
+30334,
+30912,
+30536,
+30985,
+31896,
+32843,
+34072,
+33858,
+34158,
+34074,
+33696,
+33402,
+33088,
+33000,
+32845,
+32952,
+33180,
+32607,
+32031,
+31225,
+30110,
+29944,
+29220,
+28531,
+28665,
+29088,
+29426,
+28854,
+28200,
+27272,
+26807,
+26664,
+27415,
+28672,
+29126,
+30117,
+30630,
+31502,
+31935,
+32451,
+32981,
+32911,
+33883,
+34571,
+34639,
+35146,
+35683,
+35740,
+35456,
+35619,
+35708,
+34898,
+34234,
+33416,
+33330,
+33233,
+33566,
+34536,
+34421,
+34475,
+33884,
+33200,
+32717,
+32551,
+32557,
+32169,
+32520,
+32342,
+32578,
+33408,
+33826,
+34406,
+34507,
+34785,
+35401,
+35870,
+36123,
+35965,
+36959,
+37340,
+37571,
+38768,
+38707,
+38383,
+38110,
+38123,
+37885,
+37932,
+37388,
+36586,
+36181,
+35917,
+35026,
+33897,
 33625,
-33850,
-33839,
-33685,
-33394,
-33178,
-33030,
-33021,
-33066,
-33151,
-33190,
-33252,
-33286,
-33335,
-33332,
-33253,
-33077,
-32871,
-32715,
-32712,
-32857,
-33135,
-33405,
-33571,
-33615,
-33494,
-33311,
-33096,
+32034,
+31451,
+31435,
+30648,
+30184,
+28620,
+28311,
+28548,
+28553,
+28737,
+28665,
+28697,
+28417,
+28979,
+29378,
+30030,
+31316,
+32007,
 32958,
-32903,
-33020,
-33258,
-33549,
-33796,
-33869,
-33775,
-33519,
-33284,
-33148,
-33202,
-33413,
-33684,
-33918,
-33998,
-33931,
-33662,
-33404,
-33116,
-33084,
-33193,
-33535,
-33901,
-34216,
-34297,
-34193,
-33910,
-33622,
-33444,
-33464,
-33668,
-33960,
-34289,
-34493,
-34633,
-34597,
-34466,
-34230,
-33928,
-33697,
-33635,
+33752,
+34820,
+35806,
+35930,
+36503,
+36225,
+36038,
+36940,
+36481,
+36794,
+37451,
+36021,
+35552,
+35157,
 33789,
-34217,
-34669,
-35096,
-35203,
-35090,
-34717,
-34339,
-34009,
-33876,
-33942,
-34136,
-34444,
-34727,
-34922,
-34993,
-34840,
-34590,
-34254,
-33995,
-33914,
-33987,
-34296,
-34610,
-34873,
-34977,
-34841,
-34570,
-34243,
+33398,
+33066,
+32361,
+31653,
+31529,
+30800,
+29983,
+29205,
+28502,
+28184,
+27774,
+28317,
+28167,
+28607,
+28355,
+28382,
+29571,
+29379,
+30081,
+30991,
+31255,
+30706,
+31458,
+32513,
+32595,
+32942,
+33123,
+33486,
+32668,
+33294,
+33996,
 33982,
-33943,
-34069,
-34345,
-34611,
-34784,
-34761,
-34622,
-34354,
-34124,
-33975,
-33941,
-34048,
-34232,
-34415,
-34558,
-34570,
-34524,
-34395,
-34256,
-34158,
+33921,
+33477,
 34059,
-34030,
-34019,
-34094,
-34215,
-34345,
-34414,
-34358,
-34179,
-33895,
-33695,
-33571,
-33660,
-33820,
-33969,
-34040,
-33931,
-33785,
-33571,
-33483,
-33415,
-33431,
-33412,
-33384,
-33370,
-33382,
-33457,
-33470,
-33438,
-33258,
-33040,
-32833,
-32755,
-32837,
-33023,
-33209,
-33291,
-33203,
-33004,
-32727,
-32510,
-32404,
-32411,
-32511,
-32608,
-32633,
-32566,
-32387,
-32227,
-32060,
-32034,
-32061,
-32157,
-32207,
-32207,
-32114,
-32012,
-31932,
-31897,
-31944,
-31958,
-32005,
-31955,
-31940,
-31946,
-31999,
-32103,
-32167,
-32210,
-32178,
-32116,
-32079,
-32042,
-32087,
-32104,
-32148,
-32185,
-32203,
-32265,
-32275,
-32282,
-32174,
-32071,
-31911,
-31910,
-31978,
-32190,
-32415,
-32573,
-32602,
-32513,
-32380,
-32263,
-32268,
-32284,
-32407,
-32481,
-32571,
-32641,
-32658,
-32672,
-32605,
-32536,
-32452,
-32416,
-32460,
-32569,
-32708,
-32811,
-32842,
-32774,
-32647,
-32503,
-32396,
-32311,
-32303,
-32269,
-32288,
-32252,
-32210,
-32107,
-31983,
-31836,
-31706,
-31613,
-31572,
-31548,
-31532,
-31522,
-31495,
-31495,
-31483,
+33575,
+33039,
+32979,
+31435,
+30556,
+31214,
+31185,
+31166,
+32069,
+31757,
+32001,
+31769,
+30999,
+31444,
+30427,
+29759,
+30716,
+31701,
+31968,
+32043,
+33002,
+32977,
+33314,
+33996,
+33298,
+34883,
+35001,
+34052,
+35318,
+35333,
+35718,
+35315,
+35032,
+35807,
+35137,
+34755,
+34565,
+34528,
+34285,
+33586,
+32993,
+32654,
+32361,
+31712,
+31663,
+31588,
+31645,
 31426,
-31314,
-31148,
-30991,
-30915,
-30907,
-31009,
-31088,
-31120,
-31078,
-30960,
+31076,
+31536,
+30633,
+30468,
+31044,
+31027,
+30970,
+31856,
+32153,
+32019,
+33024,
+32625,
+32389,
+33074,
+32949,
+33062,
+34372,
+34640,
+34283,
+34213,
+34354,
+35164,
+34952,
+35449,
+35237,
+35035,
+35789,
+34991,
+35571,
+35101,
+34605,
+34561,
+34583,
+35022,
+35056,
+34930,
+34532,
+34098,
+33635,
+33468,
+33451,
+33305,
+32860,
+32776,
+32753,
+32616,
+32283,
+32213,
+31761,
+31172,
+31090,
+30917,
+31396,
+31099,
+31286,
+31429,
+30798,
+31699,
+30905,
+31551,
+32233,
+31852,
+32862,
+32073,
+32442,
+32661,
+32772,
+33058,
+32561,
+33054,
+32895,
+33054,
+33342,
+32643,
+33071,
+33068,
+32861,
+33932,
+34023,
+33736,
+33330,
+33219,
+32802,
+32599,
+32388,
+31957,
+32218,
+31775,
+32019,
+31917,
+31625,
+31481,
+30458,
+30539,
+30461,
+30808,
+30856,
+30311,
+30564,
+30283,
+31112,
+31387,
+31680,
+32340,
+31611,
+31822,
+32055,
+32415,
+32917,
+33468,
+34025,
+34421,
+34868,
+34594,
+34429,
+34292,
+33877,
+34310,
+34131,
+34460,
+34418,
+34174,
+34407,
+33255,
+32833,
+32109,
+31852,
+31677,
+31181,
+31475,
+31254,
+31149,
+31422,
+31318,
+31126,
+31650,
+31583,
+31477,
+31956,
+31796,
+31928,
+31933,
+31937,
+32447,
+32428,
+33123,
+33491,
+33677,
+33902,
+33848,
+34188,
+34759,
+34467,
+34626,
+35302,
+35376,
+35399,
+35467,
+35607,
+35303,
+34928,
+34688,
+34419,
+33929,
+33595,
+33012,
+32733,
+32224,
+31836,
+31583,
+31383,
+31378,
 30887,
-30843,
-30916,
-30992,
-31108,
-31128,
-31084,
-30973,
-30817,
-30698,
-30656,
-30690,
-30756,
-30822,
-30801,
-30741,
-30637,
-30589,
-30596,
-30654,
-30741,
-30734,
-30692,
-30608,
-30549,
-30605,
-30703,
-30831,
-30905,
-30828,
-30716,
-30518,
-30443,
-30450,
-30572,
-30728,
-30849,
-30932,
-30945,
-30937,
-30897,
-30830,
-30779,
-30693,
-30711,
-30782,
-30920,
-31091,
-31105,
-31056,
+30473,
+30761,
+31043,
+30966,
+31226,
+31619,
+31566,
+31820,
+32527,
+32810,
+32863,
+32973,
+32477,
+32563,
+33051,
+33203,
+33276,
+33204,
+33495,
+33180,
+33288,
+33130,
+32578,
+32464,
+31858,
+31857,
+31850,
+31351,
+31369,
+31127,
+30718,
+30238,
+30239,
+30312,
+29919,
+30202,
+30061,
+30123,
+30428,
 30810,
-30598,
-30467,
-30538,
-30788,
-31073,
-31259,
-31272,
-31092,
-30869,
-30674,
-30610,
-30667,
-30760,
-30855,
-30892,
-30862,
-30820,
-30760,
-30739,
-30721,
-30778,
-30823,
-30893,
-30913,
-30889,
-30842,
-30781,
-30773,
-30820,
-30872,
-30952,
-30910,
-30824,
-30630,
-30478,
-30368,
-30435,
-30576,
-30786,
-30918,
-30943,
-30850,
-30647,
-30492,
-30369,
-30384,
-30477,
-30612,
-30750,
-30823,
-30843,
-30818,
-30790,
-30780,
-30847,
-30923,
-31119,
-31305,
-31573,
-31833,
-32050,
-32237,
-32304,
+31315,
+31460,
+32400,
+32116,
+32161,
+32473,
+32643,
+33643,
+34282,
+35103,
+35415,
+35601,
+35397,
+35377,
+35769,
+35612,
+36081,
+36581,
+36734,
+36848,
+36951,
+36891,
+36849,
+36982,
+36586,
+36287,
+36236,
+36116,
+35734,
+35257,
+34846,
+34099,
+33786,
+33631,
+33136,
+32879,
+32341,
+31804,
+31124,
+30039,
+29606,
+29249,
+29075,
+29271,
+29159,
+29192,
+29262,
+29372,
+29944,
+30690,
+30813,
+31179,
+32055,
+32442,
+33057,
+33761,
+33989,
+34107,
+34518,
+34880,
+35266,
+35499,
+35563,
+35780,
+35371,
+35183,
+34836,
+34203,
+33996,
+33396,
+33124,
+32707,
+32272,
+31947,
+31581,
+31349,
+30593,
+30592,
+30138,
+29855,
+29993,
+29714,
+29764,
+29581,
+29560,
+29466,
+29304,
+29776,
+29732,
+29902,
+30239,
+30277,
+30775,
+30723,
+30934,
+31353,
+31648,
+32215,
+32325,
+32665,
+32826,
+32573,
+32748,
+32343,
+32083,
+32651,
+32290,
+32107,
+32469,
 32379,
-32401,
-32502,
-32627,
-32805,
-32964,
-33108,
-33247,
-33368,
-33529,
-33615,
-33716,
-33704,
-33725,
-33733,
-33818,
-33968,
-34076,
-34187,
-34219,
-34237,
-34295,
-34407,
-34589,
-34755,
-34886,
-34933,
-34938,
-35009,
-35125,
-35363,
-35582,
-35792,
-35898,
-35999,
-36125,
-36303,
-36514,
-36665,
-36757,
-36782,
-36841,
-36922,
-37055,
-37163,
-37215,
-37212,
-37210,
-37212,
-37238,
-37230,
-37156,
-37049,
-36936,
-36909,
-36926,
-36994,
-37033,
-36989,
-36886,
-36751,
-36613,
-36541,
-36517,
-36546,
-36582,
-36605,
-36538,
-36454,
-36281,
-36152,
-36040,
-36038,
-36072,
-36159,
-36151,
-36119,
-35931,
-35751,
-35515,
-35381,
-35297,
-35286,
-35325,
-35318,
-35342,
-35271,
-35178,
-34994,
-34783,
-34576,
-34450,
-34437,
-34550,
-34695,
-34764,
-34721,
-34474,
-34220,
-33916,
-33812,
-33785,
+32138,
+31903,
+31835,
+31064,
+31262,
+31406,
+31043,
+31657,
+31816,
+32096,
+32441,
+32508,
+32653,
+33242,
+33653,
+34182,
+34954,
+35870,
+36188,
+36567,
+37607,
+37741,
+38018,
+38303,
+38144,
+38169,
+38224,
+38054,
+37761,
+37790,
+37376,
+36648,
+36207,
+35376,
+34547,
 33906,
-34014,
-34076,
-34041,
-33953,
-33799,
-33677,
+33079,
+32721,
+32355,
+32030,
+31629,
+31099,
+31262,
+30618,
+30041,
+30111,
+30125,
+30153,
+30246,
+30865,
+31379,
+32222,
+32389,
+31676,
+32317,
+33009,
+33139,
+33556,
+34107,
+34820,
+34807,
+34959,
+35373,
+35384,
+35420,
+34561,
+34378,
+34703,
+34053,
 33541,
-33436,
-33388,
-33375,
-33436,
-33514,
-33587,
-33569,
-33454,
-33281,
-33078,
-32993,
-32977,
-33077,
-33149,
-33214,
-33159,
-33067,
-32946,
-32864,
-32821,
-32806,
-32811,
-32837,
-32869,
-32931,
-33008,
-33026,
-33001,
-32872,
-32727,
-32658,
-32642,
-32776,
-32928,
-33044,
-33096,
-33023,
-32903,
-32775,
-32643,
-32606,
-32609,
-32686,
-32806,
-32936,
-33029,
-33075,
-33057,
-32976,
-32909,
-32864,
-32901,
-33000,
-33164,
-33306,
-33426,
-33432,
-33395,
-33298,
-33233,
-33218,
-33336,
-33468,
-33687,
-33818,
-33899,
-33878,
-33820,
-33743,
-33735,
-33813,
-33941,
-34145,
-34295,
-34408,
-34426,
-34375,
-34304,
-34209,
-34151,
-34121,
-34134,
-34209,
-34317,
+33134,
+32982,
+32351,
+31290,
+31107,
+30843,
+30520,
+29933,
+29952,
+30056,
+29826,
+29725,
+29587,
+29909,
+29893,
+30515,
+31031,
+31375,
+31972,
+31995,
+32697,
+32664,
+32767,
+33210,
+32890,
+33335,
+33413,
+33836,
+33531,
+32947,
+33168,
+32214,
+32249,
+31853,
+31175,
+31542,
+31109,
+31037,
+30716,
+30347,
+30090,
+29688,
+29836,
+29856,
+29774,
+29661,
+29692,
+30275,
+30834,
+31119,
+31442,
+31812,
+32116,
+32401,
+32685,
+33097,
+33065,
+33299,
+33908,
+34466,
+34816,
+35135,
+35636,
+35748,
+35649,
+35642,
+35607,
+35050,
+34825,
+34923,
+34501,
+34480,
+34720,
 34435,
-34545,
-34531,
-34469,
-34297,
-34123,
-34030,
-33982,
-34073,
-34115,
-34151,
-34074,
-33970,
-33815,
-33718,
-33613,
-33607,
+34044,
 33557,
-33596,
-33594,
-33629,
-33622,
-33560,
-33437,
-33247,
-33054,
-32884,
+32945,
+32589,
+32095,
+31936,
+32194,
+32128,
+32303,
+32474,
+32612,
+32500,
+32443,
+32526,
+32911,
+33003,
+32907,
+33456,
+33643,
+34028,
+34333,
+34338,
+34216,
+34176,
+34221,
+34196,
+34409,
+34337,
+34356,
+34272,
+34353,
+34192,
+33897,
+33652,
+33398,
+33413,
+32907,
+32996,
+32831,
+32611,
+32579,
+32194,
+32262,
+31923,
+31407,
+31369,
+31421,
+31174,
+31321,
+31682,
+31818,
+32010,
+32217,
+31905,
+31728,
+31917,
+31863,
+32398,
+32794,
+33020,
+33295,
+33261,
+33206,
+33334,
+33258,
+32962,
+33478,
+33177,
+33044,
+33517,
+33073,
+32902,
+32880,
+32847,
+32904,
+32684,
+32808,
 32819,
-32793,
-32852,
-32844,
-32797,
-32642,
-32404,
-32159,
-31925,
-31771,
-31706,
-31730,
-31805,
-31879,
-31848,
-31740,
-31496,
-31216,
-30989,
-30853,
-30821,
-30879,
-30922,
-30920,
-30854,
-30685,
-30556,
-30380,
-30319,
-30268,
-30310,
-30339,
-30410,
-30429,
-30396,
-30300,
-30108,
-29967,
-29813,
-29804,
-29856,
-29955,
-30028,
-30033,
-29934,
-29843,
-29758,
-29769,
-29821,
-29920,
-29971,
-29974,
-29941,
-29883,
-29876,
-29874,
-29930,
-29980,
-30049,
-30105,
-30186,
-30237,
-30315,
-30339,
-30364,
-30382,
-30418,
-30493,
-30583,
-30675,
-30694,
-30656,
-30560,
-30454,
-30370,
-30336,
-30306,
-30301,
-30252,
-30226,
-30195,
-30231,
-30261,
-30277,
-30249,
-30143,
-30060,
-30031,
-30052,
-30109,
-30098,
-29993,
-29802,
-29589,
-29462,
-29437,
-29503,
-29579,
-29598,
-29510,
-29390,
-29210,
-29131,
-29048,
-29016,
-28949,
-28847,
-28701,
-28554,
-28418,
-28271,
-28144,
-27957,
-27815,
-27679,
-27582,
-27552,
-27497,
-27517,
-27481,
-27553,
-27554,
-27602,
-27523,
-27430,
-27289,
-27227,
-27268,
-27369,
-27514,
-27574,
-27585,
-27614,
-27747,
-28134,
-28705,
-29415,
-30083,
-30573,
-30871,
-30973,
-31038,
-31125,
-31271,
-31457,
-31661,
-31808,
-31980,
-32107,
-32257,
-32345,
-32361,
-32331,
-32232,
-32199,
-32210,
-32382,
-32702,
-33188,
-33780,
-34379,
-34850,
-35127,
-35156,
-35033,
-34889,
-34845,
-35023,
-35419,
-36036,
-36773,
-37565,
-38281,
-38782,
-39058,
-39044,
-38916,
-38732,
-38688,
-38772,
-39021,
-39344,
-39663,
-39893,
-39902,
-39683,
-39213,
-38596,
-38013,
-37562,
-37380,
-37435,
-37596,
-37851,
-38032,
-38207,
-38290,
-38334,
-38244,
-38133,
-37933,
-37817,
-37772,
-37808,
-37846,
-37839,
-37691,
-37452,
-37154,
-36904,
-36704,
-36625,
-36525,
-36402,
-36178,
-35840,
-35453,
-35010,
-34614,
-34278,
-34039,
-33873,
-33760,
-33625,
-33371,
-33007,
+32534,
+32624,
+32727,
+32647,
+32665,
+32891,
+32534,
 32470,
-31943,
-31440,
-31148,
-31073,
-31158,
-31374,
+32313,
+31863,
+31923,
+31810,
+31923,
+31883,
+31961,
+31963,
+31746,
+31767,
+31674,
 31539,
-31673,
-31733,
-31753,
-31772,
-31760,
-31731,
-31593,
-31432,
-31215,
-31081,
-31025,
-31056,
-31110,
-31149,
-31112,
-31047,
-30926,
-30806,
-30701,
-30585,
-30556,
-30582,
-30708,
-30936,
-31181,
-31420,
-31547,
-31589,
-31566,
-31597,
-31697,
-31896,
-32165,
-32383,
-32590,
-32763,
-32940,
-33199,
-33486,
-33805,
-34099,
-34311,
-34491,
-34596,
-34715,
-34769,
-34811,
-34791,
-34772,
-34775,
-34789,
-34884,
-34957,
-35029,
-35114,
-35112,
-35189,
-35230,
-35342,
-35477,
-35600,
-35750,
-35849,
-35981,
-36085,
-36221,
-36314,
-36395,
-36438,
-36386,
-36351,
-36243,
-36176,
-36115,
-36070,
-36054,
-36024,
-36012,
-35943,
-35861,
-35693,
-35492,
-35262,
-35043,
-34866,
-34742,
-34652,
-34589,
-34476,
-34391,
-34239,
-34146,
-34018,
-33956,
-33908,
-33882,
-33922,
-33934,
-34013,
-34028,
-34066,
-34073,
-34087,
-34038,
-33936,
-33754,
-33508,
-33312,
-33165,
-33135,
-33147,
-33109,
-32981,
-32703,
-32400,
-32068,
-31891,
-31792,
-31845,
-31904,
-31962,
-31944,
-31846,
-31690,
-31532,
-31407,
-31391,
-31440,
-31588,
-31691,
-31803,
-31807,
-31783,
-31726,
-31668,
-31676,
-31711,
-31805,
-31893,
-31964,
-31945,
-31862,
-31700,
-31517,
-31354,
-31231,
-31147,
-31085,
-31019,
-30955,
-30898,
-30857,
-30809,
-30748,
-30664,
-30547,
-30470,
-30432,
-30484,
-30611,
-30758,
-30898,
-30963,
-30942,
-30874,
-30749,
-30678,
-30660,
-30725,
-30857,
-30989,
-31132,
-31205,
-31227,
-31182,
-31083,
-30947,
-30813,
-30725,
-30718,
-30816,
-30955,
-31083,
-31133,
-31060,
-30929,
-30780,
-30724,
-30814,
-31025,
-31322,
-31606,
-31835,
-31960,
-32015,
-32025,
-32043,
-32150,
-32301,
-32555,
-32806,
-33056,
+31710,
+31775,
+32136,
+32393,
+32425,
+32578,
+32779,
 33192,
-33256,
+32890,
+33029,
+32951,
+32697,
+32871,
+32617,
+32773,
+32594,
+32563,
+32818,
+32703,
+32758,
+32709,
+32425,
+32381,
+32524,
+32340,
+32286,
+32502,
+32892,
+32774,
+32586,
+33140,
+33304,
+32905,
+32920,
+32922,
+32530,
+32504,
+32528,
+32411,
+32396,
+32290,
+32359,
+32285,
+32250,
+32233,
+31791,
+32111,
+32217,
+32278,
+32689,
+32625,
+32852,
+32678,
+32822,
+33137,
+32963,
+32966,
+32913,
+33196,
+33105,
+33389,
+33361,
+33058,
+33683,
+33681,
+33734,
+33825,
+33635,
+33443,
+33061,
 33201,
 33119,
-33023,
-33016,
-33065,
-33207,
-33368,
-33466,
-33535,
-33466,
-33373,
-33244,
-33159,
-33149,
-33212,
-33308,
-33413,
-33441,
+32865,
+33175,
+32819,
+32887,
+32986,
+32803,
+32777,
+32544,
+32739,
+32501,
+32951,
+33102,
+32837,
+33146,
+33264,
+33300,
+33061,
+33388,
+33171,
+33056,
+33422,
+33417,
+33795,
+33782,
+34137,
+34026,
+33713,
+34035,
+33461,
+33610,
+33680,
 33436,
-33357,
-33294,
-33275,
-33315,
-33393,
-33492,
-33552,
-33606,
-33588,
-33593,
-33570,
-33561,
-33544,
-33534,
+33456,
+33190,
+33267,
+32994,
+32931,
+32936,
+32243,
+32302,
+32100,
+31728,
+31805,
+31595,
+31315,
+31211,
+32021,
+31774,
+31826,
+32432,
+32138,
+32551,
+32474,
+32364,
+32621,
+32654,
+32883,
+32918,
+33320,
+33487,
+33408,
+33589,
 33527,
+33308,
+33234,
+32938,
+32471,
+32665,
+32657,
+32414,
+32427,
+32415,
+32443,
+32163,
+32205,
+31665,
+31318,
+31561,
+31029,
+31436,
+31648,
+31488,
+31584,
+31487,
+31713,
+31406,
+31492,
+31963,
+31915,
+32492,
+32995,
+33277,
+33651,
 33548,
-33579,
-33631,
-33627,
-33588,
-33452,
-33291,
-33113,
-33007,
-32977,
-33042,
-33112,
-33172,
-33133,
-33024,
-32868,
-32748,
-32689,
-32734,
-32805,
-32924,
-32980,
-32978,
-32956,
-32891,
+33518,
+33693,
+33855,
+33758,
+33998,
+33974,
+33696,
+33863,
+33875,
+33975,
+33908,
+33639,
+33607,
+33546,
+33769,
+33358,
+32929,
 32870,
+32899,
+32715,
+32746,
+32747,
+32621,
+32666,
+32276,
+32098,
+32317,
+32260,
+31976,
+32494,
+32846,
+32623,
+32911,
+33084,
+32981,
+33206,
+32963,
+32716,
+32844,
+32873,
+33123,
+33252,
+33134,
+33491,
+33410,
+33292,
+33163,
+32955,
+32881,
+32569,
+32554,
+32528,
+32438,
+32391,
+32397,
+32486,
+32168,
+32087,
+32190,
+31882,
+31979,
+32083,
+31973,
+32081,
+32145,
+32367,
+32403,
+32137,
+32521,
+32448,
+32551,
+32444,
+32486,
+32682,
+32617,
+33083,
+32749,
+33049,
 32822,
-32813,
-32743,
-32710,
-32640,
+32630,
+32809,
+32746,
+32957,
+32501,
+32624,
+32323,
+32542,
+32648,
+32180,
+32689,
+32428,
+32527,
+32601,
+32533,
+32707,
+32444,
+32666,
+32547,
 32652,
-32676,
-32745,
-32762,
-32700,
-32594,
+32590,
+32606,
+32477,
+32732,
+33150,
+33032,
+33255,
+33211,
+33286,
+33409,
+33564,
+33744,
+33629,
+33731,
+33588,
+33717,
+34101,
+34011,
+34081,
+33917,
+33920,
+33868,
+33662,
+33600,
+33313,
+33542,
+33237,
+33229,
+33426,
+33170,
+33116,
+33070,
+33167,
+32660,
+32790,
+32875,
+32275,
+32510,
+32363,
+32338,
+32428,
+32554,
+32642,
+32474,
+32935,
+32773,
+32982,
+33117,
+32974,
+33269,
+33118,
+33343,
+33395,
+33197,
+33197,
+32937,
+33050,
+32905,
+33092,
+33269,
+32913,
+33017,
+32749,
+32464,
+32376,
+32203,
+32082,
+32166,
+32111,
+32112,
+32289,
+32136,
+31884,
+31632,
+31668,
+31612,
+31638,
+31673,
+31584,
+31658,
+31523,
+31564,
+31489,
+31556,
+31452,
+31403,
+31530,
+31458,
+31854,
+31826,
+31953,
+32058,
+31943,
+32292,
+32287,
+32288,
+32300,
+32209,
+32486,
+32467,
+32461,
+32579,
+32480,
+32336,
+32174,
+32465,
+32436,
+32300,
+32359,
+32561,
+32608,
+32255,
+32634,
+32322,
+32234,
+32210,
+31726,
+32294,
+32070,
+32340,
+32493,
+32258,
+32667,
+32292,
+32432,
+32484,
+32667,
+33298,
+33267,
+33646,
+33737,
+33980,
+34256,
+34181,
+34555,
+34447,
+34557,
+34555,
+34658,
+34806,
+34661,
+34597,
+34593,
+34513,
+34548,
+34406,
+34105,
+34198,
+34051,
+33691,
+33746,
+33792,
+33512,
+33728,
+33256,
+33161,
+33387,
+32755,
+32839,
+32757,
+32897,
+32793,
+33040,
+33436,
+32990,
+33453,
+33180,
+33484,
+33618,
+33357,
+34038,
+33835,
+34186,
+34211,
+34019,
+34171,
+33903,
+33827,
+33750,
+33863,
+33485,
+33274,
+33168,
+32822,
+32652,
+31970,
+31658,
+31627,
+31358,
+31275,
+31131,
+31159,
+31150,
+31205,
+31010,
+30908,
+31058,
+30789,
+31120,
+31210,
+31489,
+31966,
+31776,
+32293,
+32158,
+32298,
+32616,
+32276,
+32712,
+32549,
+32748,
+32769,
+32617,
+32941,
+32629,
+32754,
+32303,
+32208,
+32173,
+31776,
+31600,
+31291,
+31646,
+31578,
+31461,
+31577,
+31241,
+31447,
+31197,
+31128,
+31362,
+30961,
+31446,
+31318,
+31600,
+32262,
+31692,
+32222,
+31818,
+32043,
+32271,
+31949,
+32401,
+32451,
+32948,
+32793,
+33336,
+33567,
+33291,
+33608,
+33560,
+33472,
+33413,
+33532,
+33467,
+33538,
+33575,
+33521,
+33456,
+33631,
+33722,
+33230,
+33415,
+33087,
+32973,
+33103,
+33103,
+33320,
+33191,
+33383,
+33149,
+33401,
+33572,
+33393,
+33555,
+33302,
+33593,
+33805,
+33676,
+33986,
+33918,
+34046,
+34200,
+34069,
+33859,
+33957,
+33737,
+33796,
+34042,
+33699,
+33906,
+33698,
+33647,
+33584,
+33313,
+33385,
+32586,
+32591,
+32807,
 32438,
-32375,
-32370,
-32488,
-32606,
-32702,
-32669,
-32581,
-32434,
-32361,
-32331,
+32653,
 32417,
+32749,
+32588,
 32486,
-32575,
-32571,
-32586,
-32548,
-32619,
-32665,
-32778,
-32845,
-32870,
-32894,
-32878,
-32930,
-32967,
-33052,
-33078,
-33049,
-32959,
-32799,
-32647,
-32547,
-32499,
-32551,
-32629,
-32705,
-32705,
-32656,
-32549,
-32465,
-32418,
-32462,
-32533,
-32632,
-32649,
-32627,
-32533,
-32459,
-32394,
-32373,
-32363,
-32323,
-32298,
-32209,
-32189,
-32111,
-32110,
-32035,
-31955,
-31828,
-31709,
-31619,
-31579,
-31557,
-31525,
-31431,
-31269,
-31048,
-30847,
-30676,
-30575,
-30536,
-30499,
-30469,
-30400,
-30333,
-30252,
-30193,
-30161,
-30130,
-30150,
-30134,
-30183,
-30164,
-30188,
-30127,
-30111,
-30057,
-30076,
-30116,
-30210,
-30305,
-30344,
-30344,
-30256,
-30193,
-30141,
-30192,
-30301,
-30460,
-30578,
-30695,
-30716,
-30755,
-30771,
-30868,
-31009,
-31204,
-31428,
-31649,
+32762,
+32415,
+32807,
+32759,
+32645,
+33038,
+33166,
+33124,
+33247,
+33493,
+33615,
+33441,
+33622,
+33694,
+33870,
+34048,
+33756,
+34043,
+33918,
+33657,
+33723,
+33208,
+33344,
+33021,
+32769,
+32667,
+32174,
+32297,
 31838,
-32014,
-32154,
-32325,
-32509,
-32727,
-32990,
-33217,
-33426,
-33537,
+31776,
+31375,
+31058,
+31199,
+30718,
+30938,
+30653,
+30522,
+30515,
+30334,
+30631,
+30785,
+30811,
+30805,
+30980,
+31221,
+31315,
+31308,
+31392,
+31221,
+31607,
+31617,
+31553,
+32065,
+31820,
+31859,
+31939,
+31831,
+31823,
+32071,
+31986,
+32112,
+32188,
+31968,
+32098,
+32122,
+31971,
+32017,
+32281,
+32271,
+32488,
+32571,
+32862,
+32918,
+33071,
 33589,
-33602,
-33624,
-33728,
-33889,
-34127,
-34337,
-34534,
-34645,
-34697,
-34705,
-34694,
-34686,
-34732,
-34794,
-34939,
-35107,
-35277,
-35423,
-35485,
-35464,
-35409,
-35312,
-35290,
-35279,
-35356,
-35404,
-35463,
-35484,
-35468,
-35464,
-35432,
-35394,
-35347,
-35224,
-35145,
-35010,
-34926,
-34844,
-34777,
-34687,
-34637,
-34537,
-34508,
-34425,
-34358,
-34253,
-34132,
-34051,
-33970,
-33980,
-33982,
-33998,
-33977,
-33907,
-33788,
+33455,
+33666,
+33670,
+33764,
+33870,
+33819,
+33938,
+33888,
+34094,
+33962,
+33864,
+33948,
+33857,
+33638,
+33521,
+33250,
+33294,
+33265,
+32926,
+33356,
+33089,
+32914,
+33208,
+33018,
+33172,
+33063,
+32935,
+33101,
+32974,
+33252,
+33262,
+33319,
+33679,
+33530,
 33661,
-33519,
-33428,
-33343,
-33306,
-33246,
-33169,
-33039,
-32861,
-32692,
-32531,
-32452,
-32429,
-32450,
-32493,
-32501,
-32448,
-32363,
-32212,
+33705,
+33771,
+33637,
+33434,
+33513,
+33675,
+33870,
+33779,
+34060,
+34085,
+33795,
+33882,
+33752,
+33688,
+33549,
+33621,
+33676,
+33954,
+33952,
+34000,
+34210,
+33930,
+33970,
+33599,
+33584,
+33700,
+33459,
+33854,
+33855,
+33511,
+33651,
+33588,
+33588,
+33358,
+33208,
+33273,
+33256,
+33303,
+33029,
+33064,
+33062,
+32758,
+32712,
+32497,
+32291,
+32199,
+32029,
+32021,
+31922,
+31726,
+31409,
+31265,
+31091,
+30914,
+30828,
+30120,
+30226,
+30124,
+29663,
+30185,
+30361,
+30339,
+30433,
+30551,
+30663,
+30695,
+30901,
+31022,
+31194,
+31402,
+31531,
+31833,
 32091,
-31992,
-31957,
+32400,
+32465,
+32545,
+32639,
+32716,
+32714,
+32998,
+33263,
+33255,
+33250,
+33014,
+32965,
+33007,
+32877,
+32681,
+32657,
+32516,
+32512,
+32436,
+32251,
+32423,
+32011,
+31903,
+32124,
 32002,
-32116,
-32240,
-32367,
-32428,
-32466,
-32461,
-32438,
-32415,
-32415,
+32064,
+31937,
+32050,
+32055,
+32173,
+32252,
+32127,
+32516,
+32595,
+32793,
+32959,
+33158,
+33348,
+33057,
+33596,
+33580,
+33530,
+33806,
+33704,
+33786,
+33853,
+33915,
+33817,
+34012,
+33763,
+33554,
+33878,
+33604,
+33533,
+33631,
+33491,
+33314,
+33380,
+33493,
+33182,
+33417,
+33067,
+33250,
+33541,
+33260,
+33568,
+33435,
+33610,
+33571,
+33667,
+34186,
+33834,
+34106,
+34245,
+34280,
+34633,
+34511,
+34633,
+34450,
+34552,
+34515,
+34217,
+34439,
+33959,
+33653,
+33657,
+33252,
+32924,
+32884,
+32817,
+32518,
 32420,
-32520,
-32621,
-32794,
-32932,
+32288,
+32239,
+32128,
+31882,
+31817,
+31658,
+31795,
+31740,
+31470,
+31660,
+31462,
+31596,
+31649,
+31779,
+31927,
+31806,
+31993,
+31820,
+32093,
+32137,
+32133,
+32276,
+32299,
+32449,
+32422,
+32898,
+32688,
+32695,
+33007,
+32651,
+33037,
 33029,
-33041,
-32977,
-32875,
+32894,
+32839,
+32742,
+32781,
+32410,
+32533,
+32447,
+32233,
+32244,
+32172,
+32426,
+32027,
+31941,
+32225,
+32083,
+32251,
+31874,
+32179,
+32286,
+31856,
+32198,
+32140,
+32331,
+32214,
+32033,
+32489,
+32433,
+32479,
+32380,
+32745,
+32918,
+32793,
 32769,
-32739,
-32741,
-32823,
-32886,
-32989,
-33040,
-33109,
-33165,
-33185,
-33228,
-33194,
-33195,
-33186,
-33248,
-33383,
-33526,
-33683,
-33745,
-33748,
-33673,
-33632,
-33625,
-33735,
-33858,
-33985,
-34029,
-33992,
-33909,
-33831,
-33766,
-33769,
-33714,
-33702,
-33603,
-33544,
+32665,
+32963,
+32732,
+32615,
+32659,
+32414,
+32556,
+32133,
+32503,
+32599,
+32279,
+32411,
+32020,
+32380,
+32529,
+32130,
+32252,
+32643,
+32557,
+32599,
+32511,
+32638,
+33250,
+32731,
+32978,
+32931,
+33187,
+33013,
+32929,
+33372,
+32956,
+33146,
+33126,
+33365,
+33183,
+33566,
+33224,
+33246,
 33445,
-33387,
-33270,
-33189,
-33065,
+33246,
+33417,
+32867,
+33434,
+33335,
+33375,
+33709,
 32969,
-32920,
-32838,
-32799,
+33536,
+33339,
+32836,
+33501,
+32869,
+33021,
+33117,
+32988,
+33272,
+32984,
+33136,
+32603,
+32726,
+32955,
+32819,
+33274,
+32699,
+32884,
+33039,
+32947,
+32880,
+33043,
+33520,
+32529,
+33262,
+33134,
+33052,
+34189,
+33060,
+33277,
+33372,
+32877,
+33083,
+32610,
+33145,
+32905,
+32568,
+33062,
+32870,
+33508,
+32677,
+32737,
+33080,
+32464,
+32781,
+32585,
+32943,
+33107,
+32844,
+33612,
+33325,
+33012,
+33621,
+33579,
+33300,
+33314,
+33456,
+33048,
+32853,
+33354,
+33031,
+32833,
+33195,
+32675,
+32612,
 32671,
-32601,
-32516,
-32513,
-32530,
-32540,
+32551,
+31996,
+31774,
+32447,
+32102,
+31975,
+31849,
+31841,
+31912,
+31732,
+31744,
+31407,
+31750,
+31850,
+31754,
+31724,
+32063,
+32024,
+31876,
+32126,
+31925,
+32046,
+31958,
+32143,
+32259,
+32171,
+32210,
+32251,
+32425,
+32004,
+32473,
+32140,
+32449,
+32201,
+32160,
+32909,
+31987,
+32671,
+32384,
+32319,
 32493,
-32371,
-32191,
-32017,
-31882,
-31836,
-31842,
-31857,
-31848,
-31788,
-31683,
-31588,
-31468,
-31413,
-31357,
-31330,
-31304,
-31259,
-31212,
-31134,
-31067,
-30972,
-30943,
-30888,
-30868,
-30869,
-30821,
-30816,
-30769,
-30763,
-30763,
-30793,
-30782,
-30787,
-30733,
-30729,
-30752,
-30814,
-30912,
-30961,
-30941,
-30858,
-30763,
-30716,
-30813,
-30956,
-31156,
-31261,
-31284,
-31258,
-31222,
-31291,
-31399,
-31570,
-31698,
-31788,
-31852,
-31927,
-32002,
-32081,
-32133,
-32162,
-32212,
-32311,
-32438,
-32631,
-32783,
-32905,
-32956,
-32956,
-32948,
-32974,
-33058,
-33222,
-33398,
-33595,
-33725,
-33788,
-33802,
-33776,
-33807,
-33878,
-34043,
-34197,
-34367,
-34435,
-34475,
-34466,
-34478,
-34548,
-34639,
-34775,
-34843,
-34871,
-34840,
-34791,
-34815,
-34857,
-34968,
-35052,
-35117,
-35117,
-35102,
-35097,
-35129,
-35187,
-35247,
-35260,
-35237,
-35196,
-35177,
-35196,
-35215,
-35235,
-35218,
-35206,
-35200,
-35231,
-35219,
-35173,
-35062,
-34920,
-34837,
-34824,
-34857,
-34945,
-34939,
-34879,
-34739,
-34565,
-34417,
-34274,
-34194,
-34119,
-34121,
-34108,
-34125,
-34087,
-34020,
-33865,
-33714,
-33561,
-33483,
+32274,
+33033,
+31876,
+32728,
+32755,
+31912,
+32991,
+32387,
+32751,
+33139,
+32839,
+33057,
+33127,
+33490,
+33164,
+33136,
+32963,
+33329,
 33496,
+32902,
+33118,
+33219,
+33101,
+32903,
+32916,
+32880,
+32652,
+32685,
+32559,
+32453,
+32649,
+32292,
+32382,
+32597,
+32693,
+32786,
+32849,
+33066,
+32550,
+33002,
+33063,
+33497,
+33134,
+33508,
+33771,
+33727,
+33964,
+33545,
+34163,
+33701,
+33788,
+34234,
+34255,
+34267,
+34189,
+33752,
+33654,
+34483,
+34624,
+34110,
 33544,
-33607,
-33601,
-33527,
-33396,
-33259,
-33162,
-33151,
-33166,
-33226,
-33217,
-33203,
-33115,
-33051,
-32968,
-32921,
-32844,
-32783,
-32704,
-32657,
-32643,
-32676,
-32665,
-32650,
-32503,
-32345,
-32186,
-32073,
-32076,
-32137,
-32254,
-32341,
-32408,
+33513,
+33266,
+33297,
+33467,
+33071,
+32574,
+32167,
+32913,
+32823,
+32849,
+32598,
+31881,
+31856,
+31645,
+31998,
+31859,
+31507,
+31296,
+32229,
+32020,
+31598,
+32230,
+31763,
+32209,
+32414,
+32575,
+32703,
+31979,
+32651,
+32879,
+32088,
+33302,
+32848,
+32286,
+33390,
+32946,
+33126,
+31835,
+32352,
+32399,
+31946,
+32805,
+31963,
+32195,
+31979,
+31698,
+32518,
+31857,
+31446,
+31773,
+31838,
+32013,
+31422,
+32893,
+32091,
+32035,
+33557,
+32443,
+33092,
+32676,
+33895,
+33213,
+33468,
+34449,
+33037,
+34068,
+33357,
+34426,
+34206,
+33067,
+33987,
+33627,
+33019,
+32984,
+33468,
+32762,
+32957,
+33599,
+32170,
+32437,
+32579,
+31567,
+32214,
 32392,
-32341,
-32254,
-32163,
-32121,
-32104,
-32165,
-32233,
-32261,
-32289,
-32189,
-32130,
-32033,
-31984,
-32000,
-32006,
-32092,
-32095,
-32134,
-32099,
+32636,
+31188,
+31669,
+32046,
+32196,
+32569,
+31743,
+32577,
+32306,
+32476,
+32865,
+32702,
+32824,
+32691,
+32951,
+32520,
+33721,
+34300,
+32887,
+33638,
+33310,
+33449,
+32503,
+33652,
+34244,
+32762,
+33965,
+33356,
+33377,
+33696,
+33663,
+33271,
+32542,
+33249,
+32524,
+33027,
+33204,
+32743,
+33241,
+33036,
+32364,
+32560,
+32863,
+31959,
+32361,
 32080,
-32069,
-32115,
-32167,
-32289,
-32337,
-32400,
-32376,
-32347,
-32328,
-32309,
-32355,
-32386,
-32448,
-32490,
-32536,
-32540,
-32571,
-32543,
+32210,
+32599,
+32360,
+32695,
+32099,
+32306,
+32112,
+32692,
+32611,
+32285,
+32486,
+32323,
+32721,
+32316,
+32678,
+32893,
+32225,
+32255,
+31994,
+31969,
+32418,
+31635,
+31670,
+32532,
+31840,
+32799,
+32590,
+32281,
+32970,
+31445,
+32610,
+32918,
+31384,
+32237,
+33310,
+32368,
+33014,
+34151,
+32906,
+32030,
+32746,
+33632,
+33176,
+33935,
+34066,
+32833,
+34990,
+34085,
+33020,
+34520,
+33517,
+32678,
+33663,
+33588,
+33331,
+34122,
+33697,
+33533,
+32744,
+33685,
+33108,
+32042,
+33110,
+33252,
+32913,
+32926,
+33657,
+33319,
+32686,
+33007,
+31745,
+31743,
+33508,
+31910,
+31526,
+32594,
+32338,
+31892,
+32875,
 32541,
-32528,
-32529,
-32528,
-32521,
-32467,
-32397,
-32299,
-32252,
-32229,
-32277,
-32310,
-32340,
-32311,
-32270,
-32213,
-32170,
-32190,
-32213,
-32327,
-32427,
-32533,
-32608,
-32612,
-32548,
+31930,
+32785,
+32111,
 32425,
-32285,
-32182,
+33197,
+33203,
+33116,
+33123,
+33287,
+33142,
+33950,
+33544,
+33108,
+33598,
+32891,
+32739,
+33565,
+33304,
+32890,
+33148,
 32148,
-32170,
-32217,
+32343,
+33250,
+32525,
+31999,
+32390,
+32103,
+32091,
+32081,
+31821,
+31332,
+31267,
+32174,
+31509,
+31607,
 32232,
+31732,
+31870,
+31874,
+32536,
+31764,
+31706,
+32301,
+31970,
+32885,
+32536,
+32578,
+32786,
+32759,
+33367,
+33176,
+32770,
+32729,
+32350,
+32739,
+32667,
+32987,
+33280,
+32164,
+32496,
+32788,
+32674,
+31785,
+32198,
+32071,
+31048,
+32084,
+32491,
+32104,
+31912,
+32413,
+31807,
+32257,
+32767,
+31927,
+32623,
+32702,
+32462,
+33626,
+33374,
+33405,
+33970,
+33409,
+34029,
+33858,
+33956,
+34175,
+33659,
+33740,
+33905,
+34689,
+33701,
+33496,
+34998,
+33602,
+33923,
+34588,
+34002,
+33836,
+33872,
+34274,
+33331,
+33951,
+33320,
+32400,
+33609,
+33223,
+33418,
+33502,
+32411,
+33121,
+33557,
+33157,
+32878,
+33117,
+32743,
+32146,
+33067,
+33451,
+32618,
+32652,
+32690,
+32308,
+32744,
+33530,
+32698,
+31299,
+32086,
+32072,
+31848,
 32193,
-32047,
-31879,
-31695,
-31562,
-31481,
-31474,
-31466,
-31477,
-31418,
-31367,
-31265,
-31190,
-31096,
-31058,
-31016,
-31026,
-31040,
-31073,
-31120,
-31135,
-31173,
-31186,
-31237,
-31300,
-31365,
-31440,
-31470,
-31507,
-31519,
-31543,
-31577,
-31613,
-31635,
-31655,
-31647,
+31755,
+30991,
+30802,
+31218,
+30906,
+31162,
+31156,
+30174,
+30058,
+30544,
+31144,
+30892,
+30192,
+30425,
+30698,
+30550,
+31036,
+31688,
+31966,
+31612,
+31629,
+32523,
+32605,
+32825,
+32973,
+32622,
+33563,
+34527,
+34829,
+34353,
+34773,
+35329,
+34498,
+34552,
+34883,
+35367,
+35121,
+34931,
+35434,
+35616,
+35667,
+35379,
+35247,
+34686,
+34919,
+34992,
+34440,
+34181,
+34524,
+34812,
+34077,
+34460,
+35178,
+35039,
+34354,
+34107,
+33697,
+33029,
+32779,
+32677,
+32943,
+33270,
+33675,
+33607,
+32929,
+32551,
+32636,
+31688,
+31137,
+30829,
+31072,
+31204,
+30826,
+31322,
+30940,
+30737,
+30313,
+29708,
+30034,
+29727,
+29529,
+29658,
+29414,
+28964,
+29047,
+29360,
+29622,
+30082,
+30302,
+29686,
+29256,
+29410,
+28579,
+28494,
+28929,
+28657,
+29034,
+29448,
+31017,
+31261,
+31387,
+31968,
+31643,
+32141,
+31344,
+31269,
+31690,
+31619,
+32227,
+33391,
+34862,
+35286,
+35861,
+36195,
+35843,
+35550,
+34916,
+34768,
+35424,
+36776,
+37827,
+38613,
+39218,
+39260,
+38467,
+37774,
+37655,
+37508,
+37454,
+37283,
+37668,
+37770,
+37764,
+37569,
+36917,
+36073,
+34779,
+33768,
+32985,
+33019,
+33518,
+33731,
+33546,
+33211,
+32791,
+32381,
+32189,
 31685,
-31689,
-31725,
-31723,
-31686,
-31677,
-31659,
-31754,
-31845,
-31991,
-32106,
-32168,
-32237,
-32255,
-32313,
-32376,
-32441,
-32503,
-32562,
-32603,
-32715,
-32773,
-32888,
-32920,
-32944,
-32922,
-32889,
-32914,
-32945,
-33023,
-33053,
-33049,
-32988,
-32901,
-32814,
-32788,
-32744,
-32801,
-32760,
-32798,
-32781,
-32816,
+31322,
+31159,
+31199,
+31743,
+32465,
 32821,
-32849,
-32820,
-32798,
-32729,
-32727,
-32708,
-32772,
-32782,
-32789,
-32701,
-32535,
-32368,
-32185,
-32086,
-32006,
-31976,
-31880,
-31780,
-31599,
-31394,
-31211,
-31059,
-30945,
-30899,
-30805,
-30736,
-30630,
-30497,
-30394,
+32814,
+32409,
+32276,
+32762,
+33092,
+32811,
+33229,
+33604,
+33171,
+33229,
+33544,
+34058,
+33300,
+33239,
+33367,
+32325,
+31699,
+31300,
+31230,
+30972,
+30768,
+30725,
+30326,
+29653,
+29772,
+29787,
+28738,
+28067,
+27814,
+27446,
+26620,
+26888,
+27801,
+28037,
+28150,
+28159,
+28143,
+27181,
+26280,
+26133,
+26934,
+27800,
+28357,
+29908,
+30977,
+31285,
+31315,
+30871,
+30494,
 30280,
-30215,
-30141,
-30067,
-29942,
-29812,
-29668,
-29526,
-29434,
-29305,
-29178,
-28993,
-28712,
-28442,
-28189,
-27995,
-27923,
+30683,
+31549,
+32655,
+34246,
+35291,
+35951,
+36664,
+36381,
+35987,
+35580,
+35384,
+35980,
+36645,
+37468,
+37814,
+38431,
+38823,
+38550,
+38013,
+37479,
+37090,
+36264,
+35863,
+35571,
+35937,
+36457,
+36271,
+36147,
+35719,
+34831,
+33904,
+33189,
+32626,
+32107,
+32253,
+32558,
+32524,
+33296,
+33211,
+32494,
+32125,
+31382,
+30997,
+31275,
+31575,
+32034,
+33033,
+33412,
+33507,
+33540,
+33340,
+33407,
+33265,
+33280,
+33816,
+34235,
+34563,
+34984,
+35291,
+35237,
+35014,
+34868,
+34576,
+34339,
+34664,
+34878,
+34777,
+35303,
+35248,
+34615,
+34555,
+34207,
+33076,
+32289,
+32485,
+32307,
+31630,
+31359,
+31211,
+30814,
+29961,
+30043,
+30085,
+29133,
+28616,
 27835,
-27798,
-27748,
-27797,
-27975,
-28402,
-28980,
-29714,
-30378,
-30917,
-31288,
-31479,
-31633,
-31775,
-32006,
-32347,
-32741,
-33135,
-33431,
-33570,
-33562,
-33389,
-33161,
-32919,
-32732,
-32635,
-32720,
-32883,
-33247,
-33620,
-33991,
-34266,
-34378,
-34363,
-34281,
-34190,
-34193,
-34316,
-34606,
-35051,
-35641,
-36260,
-36857,
-37253,
-37454,
-37438,
-37288,
-37158,
-37094,
-37189,
-37415,
-37745,
-38099,
-38355,
-38450,
-38324,
-37987,
-37560,
-37128,
-36828,
-36721,
+27713,
+27214,
+26794,
+27132,
+26884,
+26654,
+26257,
+26316,
+26405,
+26689,
+27792,
+28574,
+29444,
+29950,
+29742,
+29257,
+29072,
+28889,
+29096,
+30594,
+31940,
+33362,
+34993,
+35843,
+35876,
+35576,
+34813,
+33960,
+33896,
+34475,
+35430,
 36777,
-36964,
-37166,
-37298,
-37359,
-37291,
+37765,
+38213,
+38063,
 37204,
-37091,
-37020,
-37013,
-37032,
-37051,
-37060,
-37000,
-36941,
-36850,
-36759,
-36682,
-36543,
-36463,
-36308,
-36208,
-36048,
-35867,
-35607,
-35294,
-34940,
-34648,
-34384,
-34214,
-34057,
-33915,
-33725,
-33521,
-33248,
-32968,
-32648,
-32355,
-32117,
-31999,
-32039,
-32145,
-32345,
-32462,
-32532,
-32488,
-32365,
-32194,
-31978,
-31827,
-31691,
-31664,
-31642,
-31640,
-31515,
-31325,
-31018,
-30648,
-30336,
-30013,
-29828,
-29656,
-29595,
-29539,
-29535,
-29525,
-29477,
-29409,
-29317,
-29249,
-29272,
-29391,
-29615,
-29907,
-30199,
-30451,
-30610,
-30737,
-30820,
-30965,
-31176,
-31470,
-31844,
-32226,
-32592,
-32855,
-33044,
-33091,
-33082,
-33006,
-32943,
-32926,
-32979,
-33083,
-33213,
-33286,
-33276,
-33179,
-33049,
-32935,
-32937,
-32982,
-33161,
-33309,
-33514,
-33672,
-33829,
-33953,
-34053,
-34117,
-34209,
-34289,
-34447,
-34567,
-34729,
-34812,
-34894,
-34918,
-34933,
-34944,
-34945,
-34934,
-34923,
-34872,
-34850,
-34803,
-34762,
-34694,
-34617,
-34454,
-34336,
-34136,
-34035,
-33917,
-33919,
-33932,
-34008,
+36299,
+35263,
+34624,
+34444,
+34635,
+35280,
+35858,
+36205,
+36243,
+35799,
+34865,
+33864,
+33203,
+33001,
+33137,
+33757,
+34275,
+34670,
+35250,
+35324,
+34823,
+34414,
+33935,
+33258,
+33312,
+33709,
+34108,
+34639,
+35139,
+35412,
+35243,
+35111,
+34704,
+34054,
+34042,
+34025,
 34051,
-34055,
-34024,
-33966,
+34569,
+34855,
+34998,
+34965,
+34790,
+34269,
+33541,
+33035,
+32705,
+32774,
+32812,
+32894,
+32801,
+32341,
+31888,
+31452,
+31050,
+30677,
+30380,
+30001,
+29643,
+29407,
+28829,
+28673,
+28941,
+28968,
+28857,
+28593,
+28168,
+27156,
+26651,
+26260,
+25738,
+25575,
+25240,
+25373,
+25896,
+26806,
+27733,
+28163,
+28472,
+28562,
+28092,
+27657,
+27409,
+27313,
+27878,
+29203,
+31108,
+33054,
+34808,
+35912,
+36133,
+35891,
+35418,
+34981,
+35133,
+35846,
+37194,
+39104,
+40609,
+41723,
+41929,
+41214,
+40155,
+38911,
+38245,
+37905,
+38010,
+38728,
+39300,
+39397,
+39257,
+38427,
+37108,
+35628,
+34108,
+33270,
+32614,
+32523,
+32864,
+33039,
+33302,
+33247,
+32767,
+32136,
+31292,
+30410,
+29973,
+29858,
+30189,
+31019,
+32098,
+33174,
+33851,
+34283,
+34269,
+33881,
+33506,
+33198,
+33229,
+33666,
+34518,
+35614,
+36609,
+36991,
+36835,
+36196,
+35034,
+34077,
+33351,
+33041,
+33096,
+33386,
+33824,
 33932,
-33930,
-33956,
-33985,
-34028,
-34000,
-33960,
-33856,
-33696,
-33516,
-33292,
-33098,
-32916,
-32781,
-32668,
-32561,
-32428,
-32243,
-32018,
-31804,
-31596,
-31490,
-31401,
-31395,
-31396,
-31393,
-31365,
-31314,
-31236,
-31153,
-31103,
-31069,
-31079,
-31118,
-31170,
-31229,
-31274,
-31273,
-31283,
-31210,
-31188,
-31078,
-31006,
-30899,
-30802,
-30713,
-30644,
-30626,
-30601,
-30596,
-30537,
-30466,
-30331,
-30229,
-30133,
-30115,
-30143,
-30244,
-30336,
-30479,
+33746,
+32902,
+31861,
+30657,
+29592,
+28843,
+28365,
+28434,
+28457,
+28697,
+28797,
+28549,
+28225,
+27693,
+26976,
+26316,
+26065,
+26157,
+26238,
+26244,
+26077,
+25912,
+25862,
+26096,
+26875,
+27812,
+28741,
+29571,
+29982,
+29894,
+29506,
+28974,
+28756,
+29032,
+30100,
+31884,
+34012,
+36055,
+37403,
+38166,
+37828,
+36987,
+36295,
+36025,
+36411,
+37472,
+39250,
+40809,
+41945,
+42445,
+41970,
+40652,
+39332,
+38408,
+37529,
+37292,
+37912,
+38393,
+38523,
+38477,
+37645,
+36277,
+34843,
+33421,
+32141,
+31162,
+30804,
+30677,
+30676,
+30773,
+30697,
+30490,
+29927,
+29300,
+28741,
+28184,
+27917,
+28000,
+28518,
+29486,
 30609,
-30727,
-30860,
-30938,
-31050,
-31128,
-31269,
-31424,
-31640,
-31839,
-32023,
-32142,
-32191,
-32227,
-32222,
-32287,
-32339,
-32427,
-32478,
-32487,
-32447,
-32389,
-32347,
-32346,
-32392,
-32474,
-32539,
-32592,
-32615,
-32633,
-32668,
-32750,
-32842,
-32993,
-33121,
-33241,
-33359,
-33450,
+31636,
+32567,
+33197,
+33351,
+33408,
+33382,
+33307,
+33840,
+34652,
+35646,
+36837,
+37777,
+38316,
+38141,
+37669,
+36993,
+36092,
+35572,
+35343,
+35423,
+35715,
+35874,
+35634,
+35005,
+34124,
+32818,
+31525,
+30497,
+29605,
+29009,
+28577,
+28333,
+28225,
+27998,
+27626,
+27191,
+26770,
+26340,
+25946,
+25462,
+25032,
+24688,
+24419,
+24429,
+24687,
+25429,
+26579,
+27656,
+28745,
+29618,
+29744,
+29549,
+29195,
+28534,
+28455,
+29232,
+30439,
+32377,
+34715,
+36717,
+38033,
+38811,
+38607,
+37864,
+37287,
+36725,
+37059,
+38018,
+39372,
+40992,
+42173,
+42734,
+42539,
+41834,
+40580,
+39285,
+38337,
+37683,
+37452,
+37585,
+37841,
+37742,
+37327,
+36479,
+35467,
+34150,
+32618,
+31561,
+30557,
+29718,
+29522,
+29559,
+29701,
+29983,
+29860,
+29622,
+29163,
+28315,
+27858,
+27545,
+27451,
+28350,
+29370,
+30520,
+31970,
+32905,
+33356,
+33483,
 33520,
-33619,
-33677,
-33794,
-33881,
-33982,
-34027,
-34051,
-34005,
-33986,
-33934,
-33975,
-33972,
-34014,
-33966,
-33884,
-33765,
-33635,
-33581,
-33535,
-33567,
-33553,
-33552,
-33472,
-33412,
-33325,
-33298,
-33264,
-33310,
-33301,
-33330,
-33306,
-33268,
-33240,
-33194,
+33465,
+33686,
+34281,
+35033,
+36013,
+36825,
+37311,
+37570,
+37403,
+37002,
+36522,
+35988,
+35658,
+35413,
+35320,
+35146,
+34821,
+34270,
+33434,
+32447,
+31197,
+30347,
+29675,
+28853,
+28368,
+28070,
+27573,
+27112,
+26898,
+26605,
+26285,
+26128,
+25984,
+25611,
+25182,
+24725,
+24263,
+24272,
+24640,
+25641,
+26910,
+28052,
+29260,
+29916,
+30112,
+29734,
+29216,
+28788,
+28699,
+29591,
+31040,
+33039,
+35143,
+36915,
+37997,
+38453,
+38334,
+37572,
+37003,
+36849,
+37139,
+37950,
+39240,
+40486,
+41463,
+42050,
+41933,
+41339,
+40402,
+39316,
+38338,
+37763,
+37496,
+37533,
+37804,
+37883,
+37759,
+37413,
+36679,
+35608,
+34391,
+33175,
+32086,
+31362,
+31016,
+31090,
+31447,
+31800,
+31920,
+31797,
+31463,
+30740,
+29903,
+29393,
+29215,
+29489,
+30276,
+31213,
+32328,
+33273,
+33831,
+34007,
+33895,
+33727,
+33668,
+33870,
+34194,
+34657,
+35143,
+35561,
+35677,
+35493,
+35292,
+34942,
+34518,
+34272,
+33952,
+33668,
+33284,
+32583,
+31864,
+31030,
+30230,
+29571,
+29120,
+28680,
+28094,
+27620,
+27125,
+26522,
+26162,
+26001,
+25804,
+25823,
+25992,
+26061,
+25917,
+25538,
+25216,
+24989,
+24970,
+25598,
+26669,
+27994,
+29329,
+30307,
+30828,
+30752,
+30320,
+29682,
+29493,
+30052,
+31082,
+32820,
+34807,
+36521,
+37784,
+38331,
+38134,
+37559,
+37071,
+36732,
+36777,
+37575,
+38671,
+39542,
+40282,
+40744,
+40640,
+40295,
+39522,
+38601,
+37931,
+37325,
+36945,
+36763,
+36857,
+36877,
+36718,
+36521,
+36000,
+35243,
+34438,
+33510,
+32554,
+31867,
+31494,
+31362,
+31456,
+31712,
+31921,
+31958,
+31769,
+31303,
+30757,
+30246,
+29930,
+30069,
+30590,
+31426,
+32366,
+33146,
+33815,
+34074,
+33967,
+33930,
+33877,
+33873,
+34125,
+34624,
+35089,
+35498,
+35792,
+35858,
+35754,
+35586,
+35336,
+35032,
+34870,
+34506,
+34075,
+33633,
+33152,
+32623,
+32102,
+31599,
+30920,
+30124,
+29324,
+28692,
+28076,
+27700,
+27420,
+27245,
+27242,
+27306,
+27382,
+27089,
+26602,
+26052,
+25389,
+24966,
+25041,
+25473,
+26582,
+27820,
+28869,
+29717,
+29876,
+29657,
+29082,
+28603,
+28595,
+29131,
+30192,
+31734,
+33568,
+35145,
+36123,
+36420,
+36346,
+36032,
+35731,
+35778,
+36084,
+36795,
+37763,
+38433,
+39087,
+39530,
+39530,
+39194,
+38585,
+38066,
+37615,
+37259,
+37042,
+37024,
+37114,
+37177,
+37063,
+36838,
+36469,
+35840,
+35055,
+34251,
+33548,
+33037,
+32797,
+32839,
+33034,
+33153,
+33275,
+33149,
+32632,
+32007,
+31393,
+30896,
+30737,
+30872,
+31189,
+31789,
+32271,
+32531,
+32609,
+32322,
+32027,
+31839,
+31921,
+32301,
+32808,
+33320,
+33754,
+34088,
+33954,
+33738,
+33468,
+33088,
+33141,
+33276,
+33357,
+33519,
+33513,
 33191,
-33151,
-33147,
-33103,
-33069,
-33005,
-32929,
-32829,
-32728,
-32629,
-32524,
-32495,
-32434,
-32447,
-32409,
-32378,
-32287,
-32183,
-32044,
-31947,
-31861,
-31846,
-31859,
-31881,
-31931,
-31883,
-31879,
-31772,
-31741,
-31697,
-31691,
-31705,
+32799,
+32352,
 31703,
-31695,
-31665,
-31613,
-31566,
-31481,
-31409,
-31319,
-31267,
-31256,
-31304,
-31350,
-31382,
-31328,
-31225,
-31089,
-30980,
-30921,
-30953,
-31004,
-31074,
-31127,
-31139,
-31146,
-31144,
-31152,
-31204,
-31246,
-31347,
+31073,
+30403,
+29798,
+29499,
+29293,
+29047,
+29030,
+29113,
+29024,
+28954,
+28833,
+28482,
+27966,
+27285,
+26517,
+26237,
+26346,
+26682,
+27513,
+28541,
+29417,
+30007,
+30026,
+29627,
+29312,
+28887,
+28593,
+29077,
+30158,
+31491,
+32944,
+34208,
+35089,
+35453,
+35428,
+35218,
+35142,
+35396,
+35794,
+36555,
+37523,
+38348,
+38957,
+39307,
+39398,
+39131,
+38744,
+38368,
+38020,
+37882,
+37825,
+37925,
+38177,
+38267,
+38110,
+37828,
+37445,
+36700,
+35846,
+35192,
+34550,
+34075,
+33983,
+34109,
+34268,
+34517,
+34540,
+34065,
+33500,
+32728,
+31830,
+31316,
+31136,
+31373,
+31870,
+32432,
+32922,
+33097,
+32886,
+32361,
+31831,
 31416,
-31539,
-31621,
-31760,
-31854,
-31975,
-32054,
-32109,
-32171,
-32185,
-32249,
-32272,
-32354,
-32392,
-32468,
-32504,
-32618,
-32685,
-32804,
-32881,
-32921,
-32980,
-32977,
-33038,
-33113,
-33202,
+31184,
+31357,
+31921,
+32541,
+33092,
+33525,
+33629,
 33337,
-33387,
-33433,
-33405,
-33380,
-33359,
-33384,
-33440,
-33549,
-33632,
-33703,
-33730,
-33706,
-33683,
-33656,
-33614,
-33599,
-33544,
-33538,
-33513,
-33579,
-33615,
-33678,
-33677,
-33613,
-33537,
-33441,
-33406,
-33421,
-33495,
-33559,
-33634,
-33657,
-33643,
-33627,
-33524,
-33444,
-33305,
-33210,
-33124,
-33128,
-33093,
-33147,
-33083,
-33043,
-32921,
-32800,
-32712,
-32660,
-32685,
-32765,
-32872,
-32998,
-33094,
-33180,
-33228,
-33286,
-33350,
-33462,
-33615,
-33800,
-34000,
-34166,
-34291,
-34345,
-34362,
-34363,
-34388,
-34469,
-34545,
-34658,
-34729,
-34766,
-34780,
+32842,
+32309,
+31747,
+31393,
+31435,
+31631,
+31901,
+32312,
+32499,
+32267,
+31663,
+30724,
+29687,
+28689,
+27963,
+27678,
+27674,
+27907,
+28353,
+28646,
+28671,
+28491,
+27877,
+26998,
+26172,
+25548,
+25345,
+25689,
+26445,
+27428,
+28507,
+29342,
+29608,
+29469,
+29187,
+28804,
+28611,
+28967,
+29888,
+31083,
+32366,
+33603,
+34539,
+35017,
+35151,
+35199,
+35331,
+35620,
+36153,
+36890,
+37744,
+38491,
+38873,
+39093,
+39155,
+39070,
+38852,
+38637,
+38559,
+38474,
+38366,
+38281,
+38254,
+38191,
+38053,
+37767,
+37490,
+37154,
+36580,
+36007,
+35548,
+35197,
+34891,
+34779,
+34790,
+34818,
 34753,
-34746,
-34738,
-34737,
-34767,
-34774,
-34847,
-34903,
-34995,
-35063,
-35099,
-35104,
-35110,
-35120,
-35180,
-35258,
-35374,
-35467,
-35549,
-35555,
-35541,
-35478,
-35450,
-35419,
-35496,
-35551,
-35656,
-35696,
-35696,
-35624,
-35514,
-35375,
-35233,
-35128,
-35025,
-34974,
-34926,
-34912,
-34848,
-34797,
-34648,
-34489,
-34284,
-34098,
-33969,
-33882,
-33854,
-33852,
-33803,
-33729,
-33588,
-33397,
-33219,
-33027,
-32915,
-32812,
-32776,
-32712,
-32653,
-32519,
-32345,
-32131,
-31921,
-31757,
-31634,
-31598,
-31557,
-31526,
-31440,
-31315,
-31129,
-30971,
-30818,
-30717,
-30698,
-30652,
-30679,
-30645,
-30650,
-30600,
-30585,
-30553,
-30547,
-30537,
-30581,
-30598,
-30647,
-30695,
+34508,
+34164,
+33655,
+33125,
+32706,
+32462,
+32388,
+32401,
+32552,
+32703,
+32699,
+32649,
+32418,
+32189,
+31998,
+31814,
+31857,
+31941,
+32211,
+32523,
+32619,
+32719,
+32725,
+32604,
+32390,
+32153,
+32051,
+32090,
+32211,
+32331,
+32440,
+32352,
+32059,
+31723,
+31257,
 30714,
-30734,
-30744,
-30737,
-30747,
-30754,
-30745,
-30756,
-30744,
-30760,
-30759,
-30810,
-30814,
-30855,
-30861,
-30870,
-30877,
-30901,
-30937,
-31025,
-31106,
-31223,
-31278,
-31354,
-31354,
-31416,
-31459,
-31565,
-31688,
-31835,
-31960,
-32065,
-32145,
-32207,
-32276,
-32358,
-32452,
-32556,
+30292,
+29966,
+29619,
+29343,
+29110,
+28690,
+28285,
+27965,
+27632,
+27541,
+27484,
+27229,
+27000,
+26703,
+26365,
+26175,
+26204,
+26539,
+27110,
+27667,
+28065,
+28365,
+28481,
+28611,
+28779,
+29098,
+29890,
+30691,
+31438,
+32257,
+32887,
+33298,
+33645,
+34100,
+34673,
+35401,
+36215,
+37013,
+37672,
+38068,
+38101,
+37873,
+37833,
+37947,
+38158,
+38590,
+39010,
+39295,
+39245,
+38893,
+38407,
+37813,
+37467,
+37359,
+37395,
+37539,
+37548,
+37386,
+37018,
+36453,
+35905,
+35417,
+35029,
+34951,
+34919,
+34895,
+34942,
+34737,
+34373,
+33920,
+33489,
+33028,
 32635,
-32675,
-32702,
-32678,
-32660,
-32628,
-32625,
-32610,
-32612,
-32598,
-32591,
-32566,
-32552,
-32544,
-32543,
-32561,
-32581,
-32599,
-32638,
-32661,
-32712,
-32734,
-32770,
-32752,
-32731,
-32680,
-32628,
-32618,
-32616,
-32678,
-32722,
-32762,
-32741,
-32671,
-32596,
-32523,
-32526,
-32573,
-32638,
-32707,
-32685,
-32653,
-32512,
-32444,
+32431,
+32320,
 32321,
-32297,
-32267,
-32290,
-32315,
-32373,
-32400,
-32452,
-32447,
-32448,
-32382,
-32359,
 32298,
-32335,
-32372,
-32450,
-32522,
-32515,
-32496,
-32380,
-32276,
-32154,
+32245,
+32157,
+32108,
+31858,
+31568,
+31420,
+31291,
+31368,
+31543,
+31756,
+32059,
+32214,
+32242,
+32177,
+31935,
+31733,
+31604,
+31588,
+31555,
+31592,
+31700,
+31684,
+31551,
+31256,
+30866,
+30297,
+29671,
+29191,
+29005,
+28970,
+28919,
+28906,
+28706,
+28295,
+27734,
+27077,
+26479,
+26150,
+26198,
+26502,
+27072,
+27604,
+27856,
+27914,
+27604,
+27157,
+27142,
+27520,
+28151,
+29320,
+30683,
+31690,
+32301,
+32526,
+32548,
+32581,
+32813,
+33546,
+34712,
+36037,
+37221,
+38042,
+38438,
+38393,
+38140,
+37972,
+38078,
+38399,
+38836,
+39313,
+39618,
+39684,
+39362,
+38788,
+38302,
+37916,
+37589,
+37356,
+37277,
+37139,
+36846,
+36526,
+36146,
+35802,
+35531,
+35121,
+34760,
+34538,
+34335,
+34243,
+34223,
+34211,
+34183,
+34097,
+33933,
+33614,
+33262,
+33047,
+32860,
+32846,
+32950,
+33155,
+33435,
+33440,
+33242,
+32922,
+32553,
+32323,
+32263,
+32459,
+32763,
+33009,
+33051,
+32897,
+32576,
+32116,
+31732,
+31580,
+31676,
+31781,
+31833,
+31710,
+31386,
+30953,
+30375,
+29786,
+29319,
+29005,
+28819,
+28769,
+28729,
+28505,
+28117,
+27561,
+26975,
+26472,
+26012,
+25652,
+25306,
+25178,
+25386,
+25804,
+26281,
+26669,
+26842,
+26671,
+26289,
+25947,
+26076,
+26798,
+27954,
+29325,
+30737,
+31834,
+32178,
+32084,
+32157,
+32539,
+33182,
+34322,
+35829,
+37185,
+38133,
+38604,
+38709,
+38573,
+38429,
+38663,
+39225,
+39793,
+40211,
+40294,
+40054,
+39680,
+39231,
+38847,
+38698,
+38672,
+38431,
+37943,
+37392,
+36746,
+36049,
+35534,
+35337,
+35382,
+35385,
+35242,
+34910,
+34387,
+33798,
+33322,
+33112,
+33186,
+33508,
+33806,
+33877,
+33738,
+33534,
+33263,
+33031,
+32951,
+32963,
+33169,
+33374,
+33484,
+33490,
+33322,
+33208,
+33175,
+33126,
+33217,
+33463,
+33544,
+33374,
+33244,
+33092,
+32877,
+32643,
+32415,
+32233,
+32130,
 32071,
-32020,
-32028,
-32039,
-32083,
-32124,
-32147,
-32152,
-32134,
-32107,
-32096,
-32121,
-32183,
-32272,
-32370,
-32440,
-32486,
-32487,
-32489,
-32479,
-32516,
-32588,
-32687,
-32783,
-32885,
-32933,
-32980,
-32984,
+31904,
+31700,
+31358,
+30900,
+30368,
+29761,
+29330,
+29063,
+28919,
+28918,
+28833,
+28559,
+28121,
+27441,
+26678,
+26011,
+25637,
+25470,
+25475,
+25950,
+26504,
+26929,
+27137,
+26913,
+26509,
+26176,
+26112,
+26499,
+27387,
+28538,
+29685,
+30601,
+31034,
+31169,
+31264,
+31593,
+32386,
+33497,
+34707,
+35785,
+36511,
+36865,
+37072,
+37314,
+37634,
+38099,
+38816,
+39536,
+39897,
+39928,
+39688,
+39340,
+39078,
+38934,
+38904,
+39005,
+39038,
+38649,
+37928,
+37190,
+36453,
+35854,
+35565,
+35529,
+35529,
+35353,
+34932,
+34344,
+33793,
+33348,
+33102,
 32974,
-32969,
-32956,
-32949,
-32946,
-32951,
-32957,
-32969,
-32990,
-32978,
-32981,
-32933,
-32894,
-32840,
-32799,
-32762,
-32798,
-32826,
-32911,
-32967,
-32986,
-32971,
-32895,
-32804,
-32735,
-32726,
-32765,
-32846,
-32896,
-32947,
-32906,
-32882,
-32814,
+33038,
+33196,
+33168,
+33066,
+32935,
 32801,
-32806,
-32825,
-32874,
-32872,
-32916,
-32903,
-32916,
-32857,
-32808,
-32707,
-32661,
-32627,
-32691,
-32778,
-32885,
-32932,
-32934,
-32870,
-32798,
-32756,
-32766,
-32850,
-32915,
-33007,
+32790,
+32789,
+32809,
+32980,
+33098,
+33157,
+33175,
+33105,
+33057,
 33036,
-33048,
-33025,
-32987,
-32931,
-32908,
-32876,
-32897,
-32926,
-32962,
-32981,
-32948,
-32929,
-32887,
-32901,
-32953,
-33004,
-33096,
-33097,
-33110,
-33103,
-33112,
-33203,
-33310,
-33420,
-33498,
-33537,
-33539,
-33559,
-33618,
-33683,
-33796,
-33855,
-33926,
-33981,
-34003,
-34077,
-34079,
-34110,
-34085,
-34093,
-34082,
+32975,
+33029,
+33280,
+33516,
+33627,
+33585,
+33426,
+33259,
+33003,
+32581,
+32242,
+32173,
+32101,
+32029,
+31948,
+31686,
+31316,
+30812,
+30266,
+29849,
+29541,
+29242,
+29060,
+28989,
+28986,
+28893,
+28482,
+27967,
+27483,
+27045,
+26664,
+26396,
+26138,
+25893,
+26010,
+26413,
+27054,
+27594,
+27541,
+27173,
+26763,
+26499,
+26791,
+27645,
+28828,
+30046,
+30939,
+31294,
+31353,
+31420,
+31851,
+32839,
 34155,
-34181,
-34267,
-34266,
-34259,
-34181,
-34141,
-34084,
-34067,
-34065,
-34032,
-34002,
-33926,
-33883,
-33786,
-33777,
-33691,
-33656,
-33572,
-33516,
-33450,
-33393,
-33343,
-33270,
-33221,
-33180,
-33115,
-33116,
-33047,
-33017,
-32961,
-32926,
-32897,
+35494,
+36482,
+37029,
+37165,
+37219,
+37539,
+38158,
+38972,
+39862,
+40560,
+40776,
+40544,
+40158,
+39883,
+39820,
+39892,
+40079,
+40148,
+39848,
+39115,
+38162,
+37414,
+36929,
+36665,
+36603,
+36545,
+36181,
+35491,
+34700,
+33982,
+33639,
+33601,
+33554,
+33454,
+33256,
 32911,
-32903,
-32906,
-32889,
-32830,
+32482,
+32177,
+32148,
+32260,
+32381,
+32395,
+32242,
+32170,
+32185,
+32153,
+32237,
+32335,
+32312,
+32245,
+32066,
+31943,
+31981,
+32221,
+32547,
+32629,
+32584,
+32370,
+31982,
+31485,
+31149,
+31211,
+31464,
+31651,
+31551,
+31192,
+30681,
+30161,
+29821,
+29733,
+29752,
+29760,
+29526,
+29117,
+28778,
+28523,
+28312,
+28072,
+27967,
+27863,
+27589,
+27159,
+26676,
+26185,
+25884,
+26175,
+27064,
+28113,
+28592,
+28256,
+27518,
+26968,
+26989,
+27705,
+28969,
+30371,
+31298,
+31470,
+31174,
+31056,
+31484,
+32529,
+34029,
+35592,
+36634,
+36752,
+36285,
+36172,
+36749,
+37674,
+38679,
+39560,
+40282,
+40363,
+39802,
+39327,
+39413,
+39754,
+39896,
+39849,
+39706,
+39369,
+38634,
+37813,
+37336,
+37240,
+37260,
+36957,
+36517,
+36048,
+35442,
+34869,
+34350,
+34141,
+34191,
+34023,
+33602,
+33179,
+32921,
+32829,
 32824,
-32763,
-32799,
-32762,
-32784,
-32731,
-32718,
-32682,
+32854,
+32938,
+32983,
+32883,
+32646,
+32465,
+32550,
+32815,
+33110,
+33230,
+33190,
+33119,
+32929,
 32679,
+32568,
 32713,
-32720,
-32746,
-32680,
-32634,
-32541,
-32501,
-32500,
-32503,
-32575,
-32557,
-32599,
-32551,
-32513,
-32456,
-32361,
-32327,
-32264,
-32288,
-32300,
-32356,
-32359,
-32351,
-32287,
-32214,
-32162,
-32110,
-32158,
+33061,
+33255,
+33117,
+32870,
+32574,
 32157,
-32240,
-32237,
-32291,
-32278,
-32294,
-32296,
-32308,
-32309,
-32322,
-32342,
-32398,
-32456,
-32531,
-32558,
-32586,
-32576,
-32561,
+31803,
+31585,
+31562,
+31612,
+31365,
+30886,
+30420,
+30099,
+29824,
+29558,
+29424,
+29402,
+29309,
+28835,
+28237,
+27912,
+27847,
+27873,
+27874,
+27897,
+27869,
+27644,
+27255,
+26927,
+26759,
+26597,
+26277,
+26282,
+27129,
+28364,
+29187,
+29008,
+28137,
+27558,
+27752,
+28515,
+29648,
+30885,
+31752,
+31850,
+31363,
+31314,
+32177,
+33498,
+34773,
+35671,
+36015,
+35685,
+35052,
+35175,
+36412,
+37920,
+38932,
+39300,
+39324,
+39124,
+38577,
+38188,
+38552,
+39327,
+39782,
+39584,
+39265,
+39072,
+38658,
+38069,
+37589,
+37530,
+37550,
+37259,
+36816,
+36596,
+36508,
+36138,
+35653,
+35207,
+34957,
+34706,
+34354,
+34107,
+34041,
+34084,
+33872,
+33397,
+32994,
+32952,
+33166,
+33257,
+33147,
+32931,
+32665,
+32383,
+32097,
+32022,
+32284,
+32575,
+32540,
+32195,
+31928,
+31877,
+31846,
+31739,
+31570,
+31339,
+31025,
+30736,
+30522,
+30557,
+30787,
+30841,
+30581,
+30178,
+29865,
+29683,
+29602,
+29539,
+29593,
+29748,
+29764,
+29637,
+29345,
+29061,
+28898,
+28734,
+28750,
+28883,
+29065,
+29090,
+28788,
+28412,
+28241,
+28232,
+28100,
+27760,
+27462,
+27680,
+28449,
+29413,
+29775,
+29188,
+28364,
+28251,
+29122,
+30309,
+31249,
+31750,
+31725,
+31363,
+31241,
+31905,
+33221,
+34480,
+35058,
+35280,
+35485,
+35472,
+35562,
+36263,
+37501,
+38253,
+38079,
+37791,
+38092,
+38646,
+38763,
+38708,
+38988,
+39160,
+38588,
+37803,
+37766,
+38188,
+38224,
+37730,
+37207,
+37019,
+36656,
+35959,
+35539,
+35556,
+35504,
+34969,
+34434,
+34275,
+34207,
+33953,
+33460,
+33194,
+33326,
+33419,
+33250,
+33014,
+32859,
+32651,
+32427,
+32378,
 32569,
-32565,
-32615,
-32619,
-32679,
+32952,
+33168,
+32929,
+32482,
+32163,
+32108,
+32287,
+32429,
+32409,
+32321,
+32069,
+31688,
+31393,
+31394,
+31631,
+31727,
+31453,
+31030,
+30775,
+30726,
+30727,
+30766,
+30928,
+31127,
+31066,
+30669,
+30300,
+30178,
+30197,
+30104,
+30070,
+30292,
+30391,
+30092,
+29545,
+29240,
+29285,
+29431,
+29579,
+29695,
+29694,
+29424,
+28996,
+28753,
+28792,
+28794,
+28551,
+28189,
+28282,
+29181,
+30399,
+30893,
+30035,
+28812,
+28727,
+29838,
+31268,
+32218,
+32498,
+32350,
+31848,
+31530,
+32311,
+33969,
+35251,
+35490,
+35446,
+35652,
+35668,
+35698,
+36546,
+38041,
+38751,
+38157,
+37411,
+37743,
+38600,
+38859,
+38832,
+39252,
+39426,
+38574,
+37494,
+37417,
+38010,
+38073,
+37448,
+36913,
+36743,
+36195,
+35260,
+34754,
+34773,
+34628,
+34096,
+33500,
+33157,
+33050,
 32687,
-32712,
-32719,
-32726,
-32692,
-32703,
-32652,
-32670,
-32691,
-32746,
-32808,
-32849,
-32855,
-32834,
-32787,
-32756,
-32728,
-32740,
-32756,
-32797,
-32833,
-32867,
-32886,
-32883,
-32860,
-32820,
-32809,
-32803,
-32839,
-32899,
-32940,
-32986,
-32971,
-32957,
-32903,
-32870,
-32858,
-32848,
-32871,
-32887,
-32877,
-32893,
-32853,
+32044,
+31675,
+31693,
+31789,
+31602,
+31290,
+31132,
+31135,
+31130,
+30977,
+30981,
+31277,
+31564,
+31499,
+31169,
+31043,
+31217,
+31417,
+31504,
+31525,
+31677,
+31831,
+31769,
+31745,
+31921,
+32182,
+32331,
+32251,
+32222,
+32350,
+32599,
+32772,
 32838,
-32804,
-32750,
-32714,
-32652,
-32619,
-32588,
-32563,
-32535,
-32510,
-32424,
-32370,
-32245,
-32178,
-32110,
-32088,
-32077,
-32068,
-32036,
-31956,
-31851,
-31732,
-31615,
-31587,
-31518,
-31567,
-31516,
-31513,
+33001,
+33054,
+32807,
+32391,
+32145,
+32203,
+32307,
+32195,
+31992,
+31805,
+31471,
+30961,
+30531,
+30376,
+30301,
+30036,
+29700,
+29452,
+29145,
+28804,
+28699,
+28918,
+28993,
+28517,
+27922,
+27797,
+28136,
+28404,
+28526,
+28480,
+28186,
+28194,
+29288,
+30991,
+31613,
+30622,
+29794,
+30814,
+32606,
+33569,
+33660,
+33812,
+33948,
+33797,
+34453,
+36290,
+37607,
+37365,
+36905,
+37564,
+38385,
+38093,
+37835,
+39053,
+40392,
+39971,
+38854,
+39167,
+40156,
+39826,
+38860,
+39030,
+39826,
+39207,
+37534,
+36752,
+37131,
+37142,
+36220,
+35474,
+35175,
+34390,
+32994,
+32016,
+31922,
+32013,
+31602,
+30835,
+30106,
+29649,
+29354,
+28930,
+28431,
+28285,
+28570,
+28723,
+28306,
+27876,
+28112,
+28810,
+29206,
+29159,
+29399,
+29884,
+29975,
+29754,
+29997,
+30973,
+31922,
+32235,
+32267,
+32683,
+33319,
+33553,
+33531,
+33714,
+34212,
+34711,
+34889,
+34968,
+35241,
+35488,
+35489,
+35370,
+35288,
+35274,
+35136,
+34746,
+34393,
+34361,
+34341,
+34071,
+33665,
+33305,
+32938,
+32441,
+31839,
 31418,
-31337,
-31215,
-31138,
-31071,
-31026,
+31142,
+30825,
+30569,
+30353,
+30029,
+29616,
+29319,
+29243,
+29222,
+29041,
+28918,
+29233,
+29678,
+29718,
+29400,
+29159,
+29212,
+29442,
+29867,
+30321,
+30302,
+29828,
+29644,
+30847,
+32918,
+33314,
+31386,
+29904,
 30997,
-30947,
-30887,
-30809,
-30737,
-30633,
-30567,
-30463,
-30394,
-30298,
-30209,
-30141,
-30062,
-30044,
-30016,
-30023,
-30014,
-30015,
-30001,
-30007,
-30032,
-30079,
-30161,
-30232,
-30324,
-30391,
-30470,
-30542,
-30638,
-30755,
-30895,
-31020,
-31160,
-31262,
-31367,
-31438,
-31512,
-31561,
-31620,
-31642,
-31688,
-31724,
-31786,
-31851,
-31924,
-31961,
-32035,
-32063,
-32146,
-32208,
-32375,
-32501,
-32737,
+33227,
+34172,
+33556,
+33145,
+33218,
 32873,
-33073,
-33183,
-33305,
-33450,
-33569,
-33759,
-33920,
-34070,
-34205,
-34288,
-34372,
-34458,
-34590,
-34766,
-34960,
-35162,
-35312,
-35430,
-35511,
-35574,
-35647,
-35745,
-35860,
-35990,
-36111,
-36222,
-36267,
-36327,
-36332,
-36362,
-36382,
-36431,
-36486,
-36554,
-36613,
-36640,
-36665,
-36657,
-36652,
-36654,
-36649,
-36653,
-36617,
-36593,
-36498,
+33233,
+35286,
+36619,
+35373,
+34124,
+35213,
+36738,
 36431,
-36328,
-36245,
-36165,
-36098,
-36034,
-35967,
-35898,
-35819,
-35705,
-35591,
-35456,
-35347,
-35230,
-35147,
-35051,
-34949,
-34831,
-34644,
-34491,
+35650,
+36792,
+38490,
+37757,
+35806,
+36080,
+37829,
+37840,
+36730,
+37132,
+38104,
+37221,
+35229,
+34618,
+35513,
+35744,
+34916,
+34304,
+33950,
+32969,
+31772,
+31480,
+31634,
+31543,
+31347,
+30841,
+29871,
+29150,
+29307,
+29639,
+29349,
+29061,
+29673,
+30318,
+29774,
+28850,
+29119,
+30176,
+30502,
+30242,
+30445,
+31012,
+31138,
+30977,
+31267,
+32002,
+32305,
+32058,
+32026,
+32400,
+32911,
+33302,
+33516,
+33655,
+33909,
+34210,
+34439,
+34574,
+34783,
+35172,
+35564,
+35841,
+36068,
+36297,
+36394,
+36443,
+36707,
+37043,
+37247,
+37276,
+37097,
+36815,
+36629,
+36695,
+36933,
+36810,
+36194,
+35538,
+35186,
+35001,
+34653,
+34192,
+33849,
+33441,
+32642,
+31743,
+31336,
+31345,
+31101,
+30414,
+29690,
+29258,
+29124,
+29063,
+28723,
+28195,
+27944,
+28023,
+28023,
+27987,
+27848,
+27172,
+26204,
+25888,
+27468,
+30322,
+30746,
+27478,
+25033,
+26604,
+29823,
+30984,
+29949,
+29434,
+29662,
+29000,
+29095,
+31953,
+34077,
+32264,
+30517,
+32455,
+34753,
+34047,
+32668,
 34272,
-34145,
-33991,
-33892,
-33755,
-33608,
-33417,
-33185,
-32967,
-32744,
-32585,
-32453,
-32350,
-32249,
-32126,
-31966,
-31769,
-31545,
-31340,
-31157,
-31061,
-30981,
+37295,
+37214,
+35010,
+35457,
+37646,
+37531,
+36422,
+37327,
+38576,
+37883,
+36286,
+36100,
+37274,
+37659,
+36757,
+35998,
+35564,
+34770,
+34210,
+34210,
+34133,
+33928,
+33812,
+33058,
+31758,
+31111,
+31376,
+31542,
+31017,
+30530,
+30872,
+31038,
+30117,
+29147,
+29333,
+30152,
+30541,
+30512,
+30273,
+30003,
+29873,
+29964,
+30372,
 30962,
-30922,
-30871,
-30773,
-30645,
-30509,
-30406,
-30317,
-30298,
-30289,
-30318,
-30317,
-30321,
-30259,
-30228,
-30137,
-30098,
-30058,
-30060,
-30100,
-30115,
-30150,
-30118,
-30104,
-30030,
-30014,
-29986,
-30020,
-30080,
-30157,
-30219,
-30285,
-30290,
-30315,
-30307,
-30334,
-30397,
-30472,
-30581,
-30677,
-30762,
-30841,
-30918,
-30979,
-31078,
-31167,
-31267,
-31380,
-31469,
-31581,
-31703,
-31817,
-31988,
-32112,
-32259,
-32345,
-32422,
-32492,
-32539,
-32640,
-32710,
-32856,
-32926,
-33068,
-33116,
-33203,
-33245,
-33307,
-33387,
-33478,
-33612,
-33729,
-33878,
-33989,
-34096,
-34176,
-34238,
-34322,
-34403,
-34517,
-34621,
-34739,
-34818,
-34874,
-34916,
-34922,
-34959,
-34974,
-35030,
-35080,
-35139,
-35208,
-35238,
-35273,
-35261,
-35254,
-35235,
-35227,
-35226,
-35250,
-35261,
-35293,
-35281,
-35276,
-35251,
-35213,
-35184,
-35138,
-35116,
-35091,
+31541,
+32133,
+32496,
+32452,
+32427,
+32966,
+33703,
+34156,
+34690,
+35536,
+36220,
+36316,
+36252,
+36838,
+37849,
+38541,
+38741,
+38769,
+38852,
+39054,
+39333,
+39381,
+39226,
+39172,
+39124,
+38668,
+37868,
+37577,
+37947,
+37723,
+36369,
+35128,
+35006,
+35055,
+34241,
+33137,
+32616,
+32258,
+31120,
+29831,
+29558,
+29753,
+29148,
+27831,
+27078,
+27213,
+27282,
+26820,
+26167,
+25794,
+25810,
+26074,
+26449,
+26427,
+25828,
+25264,
+25255,
+25742,
+26527,
+26859,
+26106,
+24903,
+24580,
+26466,
+30000,
+30697,
+26706,
+23641,
+25832,
+30340,
+31490,
+29401,
+28581,
+29416,
+29060,
+29051,
+32496,
+35375,
+32805,
+30107,
+33012,
+36623,
+35265,
+32559,
+34647,
+39134,
+38841,
+35305,
+35782,
+38864,
+38640,
+36807,
+38007,
+39738,
+38582,
+36620,
+36914,
+38429,
+38355,
+37067,
+36626,
+36424,
+35685,
+35666,
+36030,
+35492,
+34854,
 35066,
-35049,
-35031,
-34976,
-34957,
-34867,
-34801,
-34706,
-34607,
-34541,
-34490,
-34436,
-34407,
-34347,
-34300,
-34237,
-34177,
-34128,
-34097,
-34097,
+34884,
+33708,
+33210,
 34098,
-34106,
-34124,
-34089,
-34062,
-34033,
-33974,
-33948,
-33900,
-33843,
-33817,
-33744,
-33704,
-33624,
-33577,
-33489,
-33427,
-33331,
-33258,
-33176,
-33106,
-33052,
-32997,
-32942,
-32887,
-32802,
-32725,
-32609,
-32536,
-32444,
-32393,
-32371,
-32348,
-32354,
-32334,
-32307,
-32280,
-32239,
-32247,
-32221,
-32259,
-32235,
-32273,
-32233,
-32250,
-32226,
-32217,
-32207,
+34642,
+33581,
+32479,
+33039,
+33742,
+33063,
+32257,
+32579,
+33245,
+33306,
+32813,
+32310,
 32125,
-32074,
-31959,
-31911,
-31854,
-31844,
-31827,
-31801,
-31751,
-31655,
-31561,
-31453,
-31394,
-31360,
-31354,
-31354,
-31298,
-31280,
-31193,
-31123,
-31055,
-30992,
-30966,
-30973,
-30958,
-30976,
-30944,
-30903,
-30831,
-30751,
-30671,
-30618,
-30574,
-30564,
-30516,
-30511,
-30428,
-30409,
-30314,
-30280,
-30194,
-30132,
-30075,
-30009,
-29997,
-29979,
-29986,
-29946,
-29919,
-29811,
-29744,
-29617,
-29546,
-29475,
-29423,
-29418,
-29363,
-29382,
-29351,
-29373,
-29383,
-29407,
-29452,
-29486,
-29537,
-29573,
-29599,
-29610,
-29609,
-29588,
-29568,
-29549,
-29522,
-29508,
-29451,
-29421,
-29346,
-29301,
-29236,
-29238,
-29192,
-29227,
-29183,
-29203,
-29175,
-29162,
-29165,
-29144,
-29173,
-29164,
-29220,
-29267,
-29378,
-29533,
-29772,
-30052,
-30424,
-30797,
-31244,
-31651,
-32050,
-32396,
-32649,
-32846,
-32966,
-33044,
-33089,
-33117,
-33126,
-33121,
-33066,
-32997,
-32886,
-32772,
-32683,
-32665,
-32720,
-32894,
-33118,
-33395,
-33686,
-33900,
-34105,
-34197,
-34293,
-34341,
-34406,
-34447,
-34498,
-34499,
-34505,
-34478,
-34446,
-34492,
-34537,
-34708,
-34903,
-35185,
-35471,
-35784,
-36013,
-36242,
-36383,
-36514,
-36615,
-36745,
-36857,
-36991,
-37082,
-37154,
-37120,
-37043,
-36878,
-36691,
-36514,
-36373,
-36332,
-36342,
-36468,
-36557,
-36645,
-36633,
-36543,
-36382,
-36176,
-36006,
-35875,
-35823,
-35816,
-35839,
-35868,
-35863,
-35835,
-35773,
-35693,
-35649,
-35610,
-35655,
-35707,
-35793,
-35869,
-35875,
-35849,
-35747,
-35637,
-35515,
-35399,
-35321,
-35213,
-35163,
-35007,
-34891,
-34682,
+32321,
+32811,
+33108,
+32874,
+32645,
+32777,
+32624,
+32133,
+32349,
+33469,
+34173,
+33770,
+33150,
+33356,
+33910,
+33887,
+33736,
+34342,
+35292,
+35429,
+34674,
+34113,
 34478,
-34285,
-34106,
-34003,
-33934,
-33932,
-33908,
-33863,
-33722,
-33502,
-33253,
-32958,
-32743,
-32564,
-32479,
-32480,
-32483,
-32533,
-32540,
-32519,
-32488,
-32431,
-32368,
-32357,
-32374,
-32473,
-32605,
-32779,
-32916,
-33008,
-33006,
-32933,
-32805,
-32656,
-32524,
-32410,
-32346,
-32268,
-32231,
-32129,
-32047,
-31936,
-31808,
-31739,
-31632,
-31585,
-31541,
-31474,
-31439,
-31342,
-31271,
-31177,
-31099,
-31049,
-31020,
-31016,
-31003,
-31013,
-31003,
-30998,
-31002,
-31002,
-31029,
-31072,
-31129,
-31252,
-31357,
-31529,
-31641,
-31750,
-31790,
-31768,
-31717,
-31629,
-31596,
-31544,
-31572,
-31558,
-31578,
-31545,
-31526,
-31472,
-31421,
-31358,
-31316,
+35211,
+35432,
+35250,
+35265,
+35414,
+35181,
+34458,
+33937,
+34233,
+34803,
+34686,
+33812,
+33014,
+32829,
+32677,
+32200,
+31928,
+32110,
+32080,
 31249,
-31226,
-31195,
-31192,
-31211,
-31227,
-31262,
-31283,
-31309,
-31331,
-31362,
-31408,
-31448,
-31510,
-31588,
-31671,
-31777,
-31884,
-31993,
-32132,
-32237,
-32334,
-32420,
-32459,
-32505,
-32518,
-32541,
-32529,
-32589,
-32587,
-32667,
-32693,
-32757,
-32758,
-32799,
-32805,
-32833,
-32879,
-32905,
-32976,
-32993,
-33037,
-33080,
-33096,
-33178,
-33202,
-33295,
-33321,
-33410,
-33422,
-33515,
-33572,
-33676,
-33794,
-33888,
-34032,
-34131,
-34269,
+30273,
+30092,
+30436,
+30355,
+29842,
+29550,
+29510,
+29362,
+29089,
+29011,
+29202,
+29495,
+29781,
+29927,
+29517,
+28932,
+29136,
+30004,
+30581,
+30400,
+29746,
+29116,
+28808,
+28843,
+29510,
+29866,
+28985,
+27722,
+27341,
+29183,
+32398,
+31794,
+26840,
+24485,
+28158,
+32609,
+31741,
+28433,
+28427,
+30311,
+29714,
+29643,
+33833,
+35525,
+30866,
+29184,
 34359,
-34490,
-34558,
-34648,
-34697,
-34725,
-34748,
-34761,
-34792,
-34812,
-34863,
-34875,
-34913,
-34916,
-34919,
-34914,
-34924,
-34917,
-34957,
-34937,
-34985,
-34945,
-34958,
-34931,
-34916,
-34905,
-34885,
-34868,
-34846,
-34799,
-34778,
-34713,
-34705,
-34677,
-34662,
-34655,
-34629,
-34585,
-34556,
-34489,
-34447,
-34371,
-34316,
-34209,
-34162,
-34040,
-34015,
+37813,
+34623,
+31950,
+36425,
+41048,
+38280,
+34690,
+37238,
+40343,
+39088,
+38730,
+41619,
+42104,
+39062,
+37481,
+39414,
+41241,
+40585,
+39903,
+39766,
+38207,
+36944,
+38007,
+38695,
+37083,
+35877,
+36468,
+36106,
+33867,
+32750,
+33800,
+33862,
+31596,
+30240,
+31273,
+31535,
+29559,
+27860,
+28050,
+28869,
+28844,
+27987,
+27069,
+26555,
+26624,
+26966,
+27022,
+26800,
+26930,
+27290,
+26975,
+26682,
+27618,
+28923,
+29083,
+28370,
+28657,
+30321,
+31538,
+31426,
+31305,
+32240,
+33386,
+33916,
+34216,
+34955,
+35941,
+36484,
+36359,
+36579,
+37669,
+38638,
+38686,
+38077,
+37979,
+38696,
+39231,
+38996,
+38549,
+38319,
+38178,
+38060,
+38006,
+38034,
+37754,
+36941,
+36119,
+35669,
+35596,
+35573,
+35124,
+34268,
+33335,
+32782,
+32827,
+32871,
+32312,
+31369,
+30874,
+30819,
+30467,
+30000,
+30047,
+30251,
+29807,
+28662,
+27957,
+28432,
+28980,
+28649,
+27682,
+26833,
+26753,
+27121,
+27240,
+27252,
+26614,
+25367,
+24621,
+25272,
+28359,
+31132,
+28588,
+23155,
+22524,
+27767,
+31845,
+30200,
+27534,
+27972,
+28971,
+28295,
+30055,
+34472,
+34138,
+29550,
+30124,
+35519,
+37031,
+33555,
+33118,
+37889,
+40005,
+36982,
+35819,
+38798,
+39825,
+38192,
+39243,
+41723,
+41046,
+38558,
+37781,
+38974,
+39690,
+39342,
+38995,
+37812,
+35632,
+35000,
+35838,
+35294,
+33638,
+33416,
+33410,
+31644,
+29574,
+29502,
+30547,
+29768,
+27706,
+27472,
+28874,
+28724,
+26909,
+25910,
+26696,
+27900,
+28050,
+27567,
+27631,
+28147,
+28388,
+28411,
+29049,
+30413,
+31479,
+31462,
+31086,
+31760,
+33180,
+33968,
 33929,
-33914,
-33858,
-33827,
-33763,
-33696,
-33624,
-33551,
-33507,
-33458,
-33463,
-33411,
-33401,
-33307,
-33235,
-33108,
-32999,
-32902,
-32816,
-32764,
-32693,
+34273,
+35565,
+36711,
+36674,
+36297,
+36848,
+38028,
+38790,
+39014,
+39258,
+39478,
+39545,
+39674,
+40123,
+40766,
+40812,
+40080,
+39420,
+39403,
+39826,
+40006,
+39496,
+38707,
+38035,
+37490,
+37090,
+36799,
+36409,
+35756,
+34951,
+34147,
+33536,
+33119,
 32641,
-32524,
-32432,
-32310,
-32199,
-32116,
-32021,
-31961,
-31872,
-31812,
-31685,
-31613,
-31485,
-31393,
-31293,
-31215,
-31153,
-31116,
-31096,
-31081,
-31066,
-31040,
-31002,
-30975,
-30948,
-30948,
-30957,
-30978,
-30995,
-31014,
-31020,
-31038,
+32181,
+31801,
+31267,
+30666,
+30246,
+29922,
+29457,
+28941,
+28687,
+28728,
+28686,
+28254,
+27761,
+27606,
+27445,
+27264,
+27594,
+28190,
+28187,
+27277,
+26319,
+26507,
+27626,
+28587,
+28535,
+27526,
+26240,
+25737,
+26500,
+27533,
+27522,
+26147,
+24718,
+24674,
+26777,
+30111,
+30215,
+25522,
+21825,
+24185,
+29699,
+31248,
+28650,
+27215,
+27683,
+27402,
+28194,
+32631,
+35227,
+31557,
+28785,
+32302,
+36382,
+35541,
+33704,
+36478,
+39969,
+38864,
+36967,
+38942,
+41131,
+40120,
+39682,
+41923,
+43047,
+41760,
+40243,
+40150,
+40679,
+40902,
+41276,
+40756,
+38445,
+36758,
+37358,
+37749,
+36506,
+35621,
+35720,
+34974,
+33059,
+32050,
+32742,
+32638,
+30734,
+29569,
+30490,
+31201,
+30015,
+28218,
+28015,
+29344,
+30092,
+29459,
+28715,
+28662,
+28999,
+29304,
+29816,
+30755,
+31415,
+31171,
+30659,
+31261,
+32823,
+33859,
+33683,
+33438,
+34185,
+35545,
+36309,
+36255,
+36167,
+36418,
+36966,
+37776,
+38712,
+38959,
+38169,
+37255,
+37264,
+38208,
+39053,
+38828,
+37593,
+36255,
+35734,
+36088,
+36405,
+35956,
+34968,
+33897,
+33107,
+32854,
+32831,
+32422,
+31404,
+30455,
+30249,
+30332,
+29933,
+29163,
+28545,
+28010,
+27710,
+28056,
+28628,
+28450,
+27396,
+26705,
+27175,
+28077,
+28434,
+28416,
+28531,
+28527,
+28378,
+28692,
+29634,
+30320,
+30087,
+29433,
+29445,
+30400,
+31460,
+31907,
+31696,
+31127,
+30668,
 31040,
-31045,
-31036,
-31030,
-31033,
-31032,
-31081,
-31091,
-31176,
-31183,
-31248,
-31231,
-31288,
-31293,
-31355,
-31403,
-31491,
-31565,
-31659,
-31755,
-31834,
-31949,
-32011,
-32103,
-32180,
-32250,
-32321,
-32386,
-32425,
-32488,
-32508,
-32530,
-32545,
-32554,
-32566,
-32577,
-32585,
-32596,
-32640,
-32676,
-32746,
-32765,
-32839,
-32826,
-32858,
-32869,
-32885,
-32933,
-32971,
-33025,
-33056,
-33083,
-33100,
-33135,
-33146,
-33189,
-33224,
-33267,
-33333,
-33391,
-33463,
-33500,
-33520,
-33499,
-33471,
-33423,
-33361,
-33328,
-33258,
-33237,
-33157,
-33112,
-33045,
-32978,
-32937,
-32856,
-32847,
-32799,
-32816,
-32811,
-32819,
-32834,
+31937,
+32515,
+32426,
+31613,
+30787,
+30506,
+30762,
+31229,
+30892,
+29847,
+29528,
+30806,
+32775,
+32849,
+30212,
+27591,
+28039,
+31325,
+33611,
 32793,
-32769,
-32714,
-32656,
-32631,
-32568,
-32556,
-32479,
-32456,
-32389,
-32363,
+30971,
+30022,
+30236,
+31492,
+33990,
+36150,
+35166,
+32892,
+33362,
+36034,
+37253,
+36465,
+36930,
+38886,
+39047,
+37706,
+37795,
+39435,
+39899,
+38907,
+38823,
+39620,
+39455,
+38110,
+36982,
+36702,
+36556,
+36397,
+36187,
+35148,
+33579,
+32440,
+31923,
+31537,
+31225,
+31298,
+31117,
+29997,
+28825,
+28680,
+29185,
+29187,
+28765,
+29126,
+29974,
+29930,
+29180,
+29170,
+30306,
+31349,
+31583,
+31625,
+31935,
 32337,
-32319,
-32311,
-32306,
-32282,
-32271,
-32266,
-32237,
-32241,
-32197,
-32168,
-32103,
-32053,
-31992,
-31944,
-31909,
-31835,
-31785,
-31722,
-31652,
-31631,
-31594,
-31611,
-31606,
-31602,
-31604,
-31582,
-31585,
-31563,
-31573,
-31550,
-31564,
-31536,
-31559,
-31539,
-31550,
-31530,
-31539,
-31540,
-31573,
-31620,
-31706,
-31804,
-31900,
-31987,
-32038,
-32095,
-32143,
-32174,
-32239,
-32268,
-32339,
-32387,
-32446,
-32507,
-32534,
-32569,
-32559,
-32558,
-32584,
-32615,
-32715,
-32824,
-32921,
-33034,
-33065,
-33113,
-33117,
-33130,
-33159,
-33198,
-33226,
-33273,
-33290,
-33326,
-33382,
-33402,
-33484,
+32502,
+32648,
+33132,
+33863,
+34447,
+34551,
+34266,
+34161,
+34605,
+34963,
+34860,
+34852,
+35388,
+35898,
+35565,
+34710,
+34409,
+34760,
+34958,
+34778,
+34621,
+34479,
+34092,
+33668,
+33519,
+33611,
 33517,
-33580,
-33647,
-33724,
-33815,
-33902,
-33977,
-34023,
-34057,
-34055,
-34067,
-34058,
-34080,
-34089,
-34108,
-34121,
-34128,
-34115,
-34087,
-34057,
-34009,
-33990,
-33962,
-33970,
-33966,
-33984,
-33931,
-33870,
-33793,
-33670,
-33598,
-33497,
-33411,
-33355,
-33284,
-33231,
-33204,
-33162,
-33169,
-33138,
-33121,
-33075,
-33006,
-32979,
-32897,
-32907,
-32828,
+33150,
+32758,
+32499,
+32262,
+31990,
+31854,
+31810,
+31647,
+31597,
+31674,
+31633,
+31509,
+31313,
+31194,
+31300,
+31643,
+32084,
+32492,
+32615,
+32336,
+32130,
+32392,
+33179,
+34076,
+34383,
+34150,
+34140,
+34606,
+35188,
+35636,
+35890,
+35872,
+35557,
+35353,
+35691,
+36154,
+35935,
+35063,
+34465,
+34543,
+34752,
+34357,
+33523,
 32836,
-32749,
-32700,
-32604,
-32530,
-32468,
-32393,
-32367,
-32298,
-32258,
-32198,
-32128,
-32087,
-32021,
-32028,
-31967,
-31964,
-31913,
-31853,
-31795,
-31715,
-31628,
-31559,
-31496,
-31440,
-31415,
-31359,
-31362,
-31316,
-31332,
-31303,
-31299,
-31275,
-31252,
-31212,
-31183,
-31147,
-31142,
-31135,
-31151,
-31145,
-31149,
-31128,
-31100,
-31092,
-31079,
-31110,
-31145,
-31174,
-31227,
-31244,
-31271,
-31316,
-31365,
-31428,
-31514,
-31552,
-31622,
-31637,
-31656,
-31686,
-31704,
-31774,
-31851,
-31938,
-32046,
-32106,
-32197,
-32240,
-32315,
-32358,
-32417,
-32480,
-32510,
-32588,
-32601,
-32668,
-32701,
-32748,
-32770,
-32807,
-32793,
-32817,
-32799,
-32831,
-32835,
-32887,
-32924,
-32980,
-33027,
-33086,
-33136,
-33207,
-33267,
-33333,
-33402,
-33444,
-33481,
-33520,
-33545,
-33607,
-33643,
-33716,
-33747,
-33796,
-33790,
-33800,
-33770,
-33781,
-33763,
-33788,
-33783,
-33830,
-33801,
-33854,
-33826,
-33835,
-33845,
-33828,
+32277,
+31762,
+31347,
+30936,
+30505,
+29985,
+29596,
+29520,
+29208,
+28263,
+27246,
+26760,
+27088,
+27553,
+27378,
+26448,
+25355,
+24822,
+25016,
+25801,
+26229,
+25740,
+25343,
+25893,
+27276,
+27800,
+26856,
+26212,
+27162,
+28746,
+29716,
+30316,
+31086,
+31218,
+30724,
+31485,
+34309,
+36233,
+35534,
+34887,
+36177,
+37597,
+37827,
+38235,
+39674,
+40538,
+39786,
+38942,
+39608,
+40754,
+40840,
+40190,
+39488,
+39058,
+38914,
+38716,
+38198,
+37529,
+36854,
+36181,
+35313,
+34347,
+33771,
+33540,
+32921,
+31995,
+31543,
+31526,
+31098,
+30206,
+29551,
+29577,
+29722,
+29339,
+28933,
+29105,
+29543,
+29609,
+29442,
+29532,
+30000,
+30563,
+30904,
+31149,
+31513,
+31852,
+32071,
+32413,
+33090,
 33854,
-33853,
-33849,
-33862,
-33835,
-33843,
-33836,
-33825,
-33850,
-33841,
-33863,
-33861,
-33867,
-33877,
-33875,
-33892,
-33893,
-33897,
-33904,
-33910,
-33922,
-33949,
-33972,
-34001,
-34017,
-34012,
-33994,
-33984,
-33952,
-33979,
-33970,
-34009,
-34003,
-34031,
+34276,
+34105,
+33860,
+34172,
+34800,
+35254,
+35484,
+35493,
+35324,
+35196,
+35238,
+35454,
+35566,
+35504,
+35347,
+35078,
+34809,
+34754,
+34898,
+34820,
+34467,
+34289,
+34431,
+34520,
+34340,
 34003,
-34033,
-34028,
-34041,
-34066,
-34069,
-34086,
-34078,
-34058,
-34052,
-34029,
-34031,
-34020,
-34032,
-34021,
-34029,
-34015,
-34014,
-33979,
-33989,
-33950,
-33970,
-33948,
-33992,
-33985,
-34021,
-33992,
-33993,
-33941,
-33902,
-33864,
-33822,
-33811,
-33789,
-33787,
-33775,
-33759,
-33753,
-33705,
-33677,
-33643,
-33600,
-33590,
-33557,
-33544,
-33525,
-33477,
-33434,
-33363,
-33292,
-33219,
-33168,
-33125,
-33073,
-33046,
-32980,
-32954,
-32881,
-32832,
-32743,
-32660,
-32576,
-32475,
-32433,
-32353,
-32334,
-32278,
-32235,
-32168,
-32107,
-32057,
-32018,
-32030,
-32039,
-32094,
-32128,
-32185,
-32209,
-32252,
-32247,
-32286,
-32251,
-32287,
-32265,
-32333,
-32358,
-32446,
-32491,
-32546,
-32569,
-32575,
-32588,
-32587,
-32651,
-32676,
-32769,
-32811,
-32880,
-32922,
-32923,
-32924,
-32905,
-32895,
-32905,
-32941,
-33013,
-33083,
-33168,
-33204,
-33243,
-33257,
-33263,
-33283,
-33315,
-33354,
-33411,
-33445,
-33458,
-33479,
-33453,
-33450,
-33405,
-33412,
-33380,
-33429,
-33440,
-33518,
-33569,
-33631,
-33658,
-33673,
-33687,
-33682,
-33709,
-33719,
-33749,
-33774,
-33794,
-33786,
-33785,
-33746,
-33699,
-33639,
-33574,
-33523,
-33501,
-33477,
-33504,
-33494,
-33479,
-33452,
-33373,
-33307,
+33653,
+33593,
+33839,
+34103,
+34131,
+33778,
+33352,
+33144,
 33229,
-33152,
-33110,
-33083,
-33047,
-33037,
-32987,
-32940,
-32879,
-32779,
-32738,
-32663,
-32659,
-32632,
-32654,
-32651,
-32665,
-32642,
-32615,
-32573,
-32533,
-32493,
-32484,
-32469,
-32467,
-32480,
-32460,
-32456,
-32396,
-32356,
-32283,
-32241,
-32209,
-32189,
-32221,
-32213,
-32231,
-32206,
-32181,
-32118,
-32054,
-32009,
-31981,
-31979,
-32028,
-32017,
-32080,
-32049,
-32058,
-32028,
-31999,
-31997,
-32010,
-32043,
-32092,
-32158,
-32181,
-32230,
-32211,
-32219,
-32190,
-32194,
-32177,
-32206,
-32194,
-32215,
-32200,
-32171,
-32132,
-32046,
-32007,
-31911,
-31906,
-31839,
-31841,
-31805,
-31774,
-31731,
-31664,
-31597,
-31522,
-31474,
-31423,
-31399,
-31363,
-31339,
-31272,
-31245,
-31129,
-31080,
-30978,
-30929,
-30861,
-30839,
-30770,
-30749,
-30677,
-30619,
+33566,
+33889,
+33845,
+33480,
+33104,
+33133,
+33460,
+33677,
+33618,
+33326,
+33116,
+33100,
+33139,
+33098,
+32850,
+32461,
+32363,
+32413,
+32335,
+31961,
+31515,
+31240,
+30903,
 30558,
-30493,
-30449,
-30411,
-30377,
-30380,
-30339,
-30354,
-30305,
-30292,
-30250,
-30225,
-30183,
-30185,
-30146,
-30153,
-30123,
-30095,
-30039,
-29972,
-29900,
-29817,
-29782,
-29713,
-29708,
-29676,
-29671,
-29666,
-29637,
-29623,
-29602,
-29572,
-29584,
-29565,
-29595,
-29577,
-29593,
-29563,
-29554,
-29518,
-29507,
-29509,
-29522,
-29575,
-29608,
-29691,
-29729,
-29801,
-29849,
-29910,
-29954,
-30023,
-30059,
-30122,
-30154,
-30203,
-30230,
-30269,
-30301,
-30355,
-30442,
-30572,
-30766,
-30993,
-31284,
-31594,
-31916,
-32232,
-32487,
-32723,
-32908,
-33042,
-33162,
-33212,
-33267,
-33258,
-33242,
-33167,
-33083,
-32977,
-32900,
-32833,
-32846,
-32883,
-33014,
-33143,
-33353,
-33522,
-33727,
-33879,
-34046,
-34160,
-34291,
-34377,
-34452,
-34505,
-34550,
-34549,
-34589,
-34582,
-34637,
-34710,
-34840,
-34991,
-35231,
-35437,
-35710,
-35918,
-36122,
-36283,
-36421,
-36539,
-36648,
-36750,
-36825,
-36904,
-36934,
+30437,
+30529,
+30260,
+29468,
+28898,
+28976,
+29214,
+29163,
+28746,
+28253,
+27903,
+27798,
+28098,
+28524,
+28452,
+27952,
+27512,
+27364,
+27574,
+28196,
+28683,
+28525,
+27848,
+27380,
+27970,
+28923,
+29001,
+28655,
+28706,
+29820,
+31860,
+32718,
+31656,
+30662,
+31059,
+32260,
+33712,
+35532,
 36933,
-36904,
-36821,
-36770,
-36664,
-36656,
-36600,
-36648,
-36685,
-36736,
-36789,
-36806,
-36808,
-36775,
-36742,
-36686,
-36687,
-36669,
-36698,
-36735,
-36778,
-36809,
-36855,
-36859,
-36908,
-36922,
-36969,
-37021,
-37059,
+36557,
+34963,
+35117,
+37912,
+39692,
+39130,
+39006,
+39771,
+39541,
+39073,
+39741,
+40845,
+40658,
+39216,
+38282,
+38473,
+38730,
+38617,
+37905,
+36146,
+34297,
+33697,
+33607,
+33126,
+32618,
+31772,
+30116,
+28358,
+27572,
+27704,
+27768,
+27098,
+26350,
+26132,
+26206,
+26202,
+26340,
+26743,
+27213,
+27383,
+27356,
+28202,
+29855,
+30954,
+31111,
+31219,
+32023,
+33176,
+34414,
+35545,
+36237,
+36619,
+36936,
+37598,
+38408,
+38967,
+39308,
+39352,
+39245,
+39385,
+39596,
+39457,
+38907,
+38478,
+38429,
+38466,
+38208,
+37565,
+36810,
+35983,
+35375,
+34993,
+34699,
+34408,
+33847,
+33356,
+33064,
+32821,
+32575,
+32275,
+32089,
+31898,
+31699,
+31629,
+31678,
+31824,
+31828,
+31750,
+31669,
+31679,
+31879,
+32002,
+32001,
+32032,
+32212,
+32327,
+32298,
+32458,
+32807,
+33089,
+33134,
+33056,
+33156,
+33332,
+33236,
+32992,
+33010,
+33313,
+33531,
+33441,
+33136,
+32762,
+32197,
+31736,
+31803,
+32126,
+32008,
+31370,
+30715,
+30188,
+29867,
+29707,
+29714,
+29635,
+29163,
+28712,
+28368,
+28030,
+27875,
+27849,
+27808,
+27674,
+27544,
+27487,
+27387,
+27085,
+26983,
+27179,
+27320,
+27464,
+27596,
+27298,
+27013,
+26886,
+26901,
+27338,
+27939,
+29527,
+31068,
+30542,
+29192,
+29048,
+30252,
+31151,
+31959,
+33851,
+34889,
+34450,
+33842,
+35161,
+37234,
+37236,
+37052,
+37820,
+38320,
+38400,
+38973,
+40080,
+40224,
+39310,
+38406,
+38133,
+38703,
+39389,
+39457,
+38397,
 37085,
-37088,
-37046,
-36983,
-36889,
-36774,
-36651,
-36541,
 36418,
-36318,
-36202,
-36068,
-35945,
-35791,
-35663,
-35514,
-35420,
-35323,
-35242,
-35185,
-35076,
-35007,
-34847,
-34713,
+35860,
+35345,
+35383,
+35358,
+34445,
+33354,
+32943,
+32751,
+32332,
+31900,
+31503,
+31156,
+31317,
+32005,
+32356,
+32120,
+31940,
+32012,
+32001,
+32192,
+32905,
+33718,
+34249,
+34518,
+34608,
+34666,
+34956,
+35263,
+35345,
+35488,
+36026,
+36458,
+36176,
+35727,
+35706,
+35778,
+35462,
+34969,
+34566,
+34344,
+34219,
+34087,
+33933,
+33508,
+32798,
+32034,
+31485,
+31351,
+31424,
+31314,
+30970,
+30476,
+30038,
+29782,
+29726,
+29861,
+29931,
+30074,
+30386,
+30592,
+30430,
+30146,
+30329,
+30859,
+31339,
+31710,
+32167,
+32592,
+32632,
+32495,
+32530,
+32940,
+33543,
+33860,
+34033,
+34252,
+34424,
+34631,
+34732,
+34793,
+34939,
+35113,
+35053,
+34718,
+34630,
+34617,
 34509,
-34332,
-34135,
-33974,
-33833,
-33705,
-33612,
-33500,
-33424,
-33312,
-33227,
-33118,
-33047,
-32989,
-32937,
-32936,
-32910,
-32928,
-32895,
-32881,
-32826,
-32767,
-32694,
-32613,
-32547,
-32475,
-32414,
-32343,
-32263,
-32158,
-32064,
-31930,
-31866,
-31743,
-31696,
-31619,
-31554,
-31499,
-31413,
-31326,
-31238,
-31139,
-31062,
-30996,
-30955,
-30922,
-30913,
-30883,
-30868,
-30824,
-30784,
-30744,
-30724,
-30716,
-30748,
-30796,
-30853,
-30913,
-30973,
-30992,
-31021,
-31016,
-31013,
-31022,
-31028,
-31051,
-31079,
-31095,
-31102,
-31083,
-31046,
-30996,
-30943,
-30881,
-30842,
-30817,
-30786,
-30798,
-30754,
-30750,
-30696,
-30684,
-30632,
-30652,
-30645,
-30690,
-30739,
-30813,
-30860,
-30944,
-30972,
-31048,
-31076,
-31147,
-31205,
-31288,
-31355,
-31427,
-31473,
-31506,
-31515,
-31498,
-31480,
-31463,
-31450,
-31455,
-31466,
-31486,
-31519,
-31524,
-31551,
-31554,
-31562,
-31599,
-31613,
-31681,
-31748,
-31841,
-31927,
-32021,
-32101,
-32166,
+34430,
+34160,
+33890,
+33422,
+32684,
 32234,
-32294,
-32359,
-32449,
-32513,
-32642,
-32711,
-32838,
-32901,
+32195,
+32152,
+31693,
+30965,
+30348,
+29785,
+29271,
+29025,
+29094,
+29117,
+28709,
+28102,
+27674,
+27496,
+27535,
+27739,
+27864,
+27876,
+27887,
+27944,
+27907,
+27889,
+28173,
+28389,
+28477,
+28572,
+28496,
+28241,
+28497,
+29014,
+28944,
+29081,
+29407,
+29683,
+30130,
+30380,
+30611,
+30807,
+31134,
+31821,
+32545,
+33355,
+33820,
+34359,
+34847,
+35295,
+36134,
+36779,
+37274,
+37840,
+38410,
+39093,
+39539,
+39740,
+39756,
+39836,
+39961,
+39957,
+39974,
+40016,
+39806,
+39131,
+38390,
+37955,
+37786,
+37476,
+36844,
+36203,
+35427,
+34496,
+33757,
+33164,
+32582,
+31973,
+31436,
+30947,
+30446,
+30140,
+30018,
+29729,
+29355,
+29106,
+29088,
+29249,
+29362,
+29547,
+29636,
+29637,
+29772,
+30103,
+30617,
+31078,
+31320,
+31470,
+31828,
+32383,
+32810,
 32997,
-33051,
-33122,
-33174,
-33245,
-33316,
-33386,
-33460,
-33530,
-33585,
-33647,
-33682,
-33714,
-33761,
-33777,
-33845,
-33868,
-33929,
-33977,
-34008,
-34068,
-34079,
-34122,
-34146,
-34168,
-34207,
-34236,
-34297,
-34324,
-34399,
-34403,
-34456,
-34451,
-34454,
-34469,
-34441,
-34457,
-34434,
-34426,
-34418,
-34369,
-34356,
-34274,
-34231,
-34152,
-34088,
-34032,
-33979,
-33933,
-33888,
-33845,
-33797,
-33732,
-33673,
-33589,
-33505,
-33418,
-33337,
-33228,
-33154,
-33034,
-32931,
-32819,
-32687,
-32563,
-32429,
-32300,
-32179,
-32078,
-31958,
-31860,
-31756,
-31662,
-31552,
-31464,
-31345,
-31270,
-31163,
-31083,
-30999,
-30928,
-30841,
-30775,
-30690,
-30629,
+33297,
+33784,
+34102,
+34352,
+34722,
+35072,
+35178,
+35170,
+35422,
+35793,
+36028,
+36101,
+36084,
+35925,
+35954,
+36082,
+36085,
+36781,
+37027,
+36159,
+35961,
+36051,
+35829,
+35936,
+35895,
+35664,
+35380,
+34941,
+34765,
+35132,
+34783,
+33753,
+33557,
+33437,
+32925,
+32876,
+32664,
+32082,
+31746,
+31517,
+31301,
+31316,
+31230,
+30800,
+30461,
+30254,
+29981,
+29915,
+30003,
+29824,
+29455,
+29183,
+29104,
+29069,
+28923,
+28753,
+28722,
+28751,
+28638,
+28713,
+28868,
+28832,
+28680,
+28427,
+28414,
+28516,
+28283,
+27996,
+27932,
+27976,
+27870,
+27508,
+27155,
+26836,
+26521,
+26706,
+27481,
+28833,
+30277,
 30568,
-30512,
-30475,
-30442,
-30418,
-30406,
-30381,
-30387,
-30356,
-30378,
-30365,
-30376,
-30407,
-30421,
-30459,
-30498,
-30537,
-30570,
-30634,
-30674,
-30749,
-30804,
-30873,
-30939,
-31009,
-31080,
-31139,
-31224,
-31280,
-31360,
-31453,
-31521,
-31627,
-31714,
-31806,
-31918,
-32009,
-32118,
-32224,
-32348,
-32458,
-32592,
-32707,
-32838,
-32935,
-33058,
-33130,
-33236,
-33318,
-33414,
-33505,
-33599,
-33699,
-33790,
-33896,
-33983,
-34071,
-34170,
-34239,
-34348,
-34412,
-34532,
-34599,
-34694,
-34756,
-34824,
-34867,
-34909,
-34929,
-34966,
-34987,
-35041,
-35052,
-35103,
-35119,
-35142,
-35151,
-35155,
-35150,
-35156,
-35144,
-35144,
-35136,
-35127,
-35090,
-35083,
-35016,
-34983,
-34918,
-34872,
-34831,
-34780,
-34753,
-34704,
-34691,
-34634,
-34611,
-34558,
-34501,
-34459,
+30048,
+29745,
+29807,
+29958,
+30302,
+31053,
+32177,
+33188,
+34143,
+35508,
+36775,
+36935,
+36261,
+35977,
+36403,
+37256,
+38434,
+39659,
+40681,
+41160,
+40903,
+40280,
+39912,
+39886,
+39708,
+39601,
+39757,
+39630,
+39117,
+38530,
+37936,
+36988,
+35633,
+34462,
+33601,
+32809,
+32323,
+32114,
+31700,
+30844,
+29912,
+29311,
+28854,
+28564,
+28329,
+28062,
+28129,
+28514,
+28925,
+29223,
+29547,
+29833,
+30093,
+30673,
+31554,
+32434,
+33015,
+33435,
+34034,
+34696,
+35359,
+35914,
+36342,
+36604,
+36493,
+36323,
+36453,
+36801,
+36946,
+36660,
+36243,
+35996,
+35756,
+35263,
+34610,
+34123,
+33762,
+33323,
+32810,
+32356,
+32054,
+31660,
+31073,
+30517,
+30275,
+30299,
+30227,
+30179,
+30145,
+30012,
+29930,
+30071,
+30513,
+30977,
+31371,
+31673,
+31818,
+32041,
+32524,
+33108,
+33580,
+33993,
+34331,
 34390,
-34346,
-34288,
-34241,
-34183,
-34139,
-34069,
-34023,
-33928,
-33892,
-33811,
-33761,
-33734,
+34418,
+34600,
+34762,
+34951,
+35132,
+35230,
+35226,
+35188,
+35102,
+34844,
+34701,
+34623,
+34314,
+33995,
+33713,
+33494,
+33178,
+32680,
+32301,
+31953,
+31610,
+31410,
+31104,
+30602,
+30367,
+30185,
+30237,
+30906,
+30953,
+30606,
+30577,
+30362,
+30685,
+31165,
+31094,
+31268,
+31335,
+31327,
+31977,
+32661,
+32738,
+32728,
+32952,
+32983,
+33276,
+33812,
+33812,
 33690,
-33680,
-33667,
-33631,
-33612,
-33561,
-33522,
-33459,
-33403,
-33368,
-33288,
-33267,
-33188,
-33131,
-33050,
-32956,
-32869,
-32767,
-32691,
-32597,
-32548,
-32480,
-32436,
-32394,
-32355,
-32291,
-32250,
-32183,
-32127,
-32083,
-32027,
-32010,
-31980,
-31950,
-31937,
-31907,
-31875,
-31850,
-31817,
-31801,
-31786,
-31784,
-31784,
-31790,
-31793,
-31774,
-31754,
-31710,
-31688,
-31629,
-31615,
-31566,
-31567,
-31534,
-31525,
-31497,
-31476,
-31437,
-31407,
-31381,
-31356,
-31356,
-31326,
-31337,
-31306,
-31291,
-31245,
-31197,
-31150,
-31087,
-31040,
-31007,
-30973,
-30962,
-30959,
-30934,
-30954,
-30927,
-30947,
-30935,
-30949,
+33956,
+34102,
+34260,
+34618,
+34647,
+34325,
+33977,
+33734,
+33528,
+33384,
+33165,
+32929,
+32728,
+32149,
+31637,
+31569,
+31366,
 30963,
-30983,
-31018,
-31045,
-31082,
-31080,
-31112,
-31109,
-31114,
-31111,
-31120,
-31114,
-31162,
-31145,
-31191,
-31202,
-31214,
-31241,
-31230,
-31251,
-31238,
-31256,
-31240,
-31242,
-31241,
-31202,
-31213,
-31181,
-31161,
-31160,
-31126,
+30494,
+30000,
+29804,
+29607,
+29379,
+29306,
+29200,
+29037,
+28910,
+28840,
+28726,
+28671,
+28594,
+28736,
+28933,
+28878,
+29023,
+29193,
+29136,
+29292,
+29575,
+29804,
+30127,
+30345,
+30414,
+30483,
+30738,
+31013,
+31602,
+32513,
+33207,
+33650,
+33848,
+33855,
+33968,
+34088,
+34308,
+34660,
+34899,
+35181,
+35839,
+36506,
+36806,
+36978,
+37026,
+37009,
+36964,
+36930,
+37164,
+37561,
+37747,
+37732,
+37633,
+37516,
+37415,
+37149,
+36766,
+36342,
+35923,
+35542,
+35254,
+35252,
+35252,
+35004,
+34614,
+34076,
+33585,
+33222,
+32935,
+32911,
+32900,
+32786,
+32809,
+32966,
+33090,
+33080,
+32873,
+32588,
+32485,
+32599,
+32849,
+33076,
+33030,
+32846,
+32685,
+32580,
+32679,
+32917,
+32973,
+32735,
+32503,
+32617,
+32836,
+32908,
+32954,
+32912,
+32930,
+32944,
+32833,
+32847,
+32729,
+32506,
+32438,
+32475,
+32606,
+32728,
+32676,
+32455,
+32338,
+32307,
+32292,
+32297,
+32201,
+31987,
+31831,
+31931,
+32000,
+31972,
+32106,
+32028,
+31746,
+31411,
 31135,
-31128,
-31133,
-31150,
-31162,
-31187,
-31204,
-31235,
-31235,
-31263,
-31272,
-31271,
-31308,
-31284,
-31318,
-31313,
-31308,
-31309,
-31291,
-31272,
-31266,
-31231,
+31390,
+31470,
+31175,
+31236,
 31232,
-31208,
-31204,
-31201,
-31199,
-31194,
-31188,
-31190,
-31196,
-31212,
-31259,
-31295,
-31387,
-31457,
-31574,
-31675,
-31795,
-31889,
-31990,
-32076,
-32143,
-32220,
-32264,
-32332,
-32366,
-32395,
-32426,
-32423,
-32442,
-32434,
-32442,
-32449,
-32469,
-32508,
-32567,
-32621,
-32710,
-32758,
-32839,
-32883,
-32955,
-33000,
-33080,
+31028,
+30908,
+30601,
+30375,
+30479,
+30378,
+30207,
+30211,
+30087,
+29777,
+29724,
+29965,
+30057,
+30061,
+29940,
+29658,
+29732,
+30138,
+30534,
+31050,
+31062,
+31052,
+31430,
+31397,
+31545,
+32079,
+32323,
+32335,
+32515,
+32763,
+33137,
+33355,
+33458,
+33856,
+33820,
+33841,
+34339,
+34022,
+34215,
+34793,
+34723,
+34880,
+34624,
+34446,
+34408,
+34256,
+34345,
+34128,
+33864,
+33822,
+33742,
+33685,
+33736,
+33425,
+33262,
 33124,
-33215,
-33266,
-33350,
-33412,
-33477,
-33569,
-33622,
-33740,
-33819,
-33944,
-34068,
-34185,
-34328,
-34413,
-34544,
-34619,
-34703,
-34799,
-34869,
-34959,
-35036,
-35101,
-35183,
-35228,
-35273,
-35303,
-35336,
-35340,
-35395,
-35397,
-35453,
-35487,
-35531,
-35570,
-35602,
-35634,
-35651,
-35692,
-35712,
-35769,
-35789,
-35869,
-35883,
-35960,
-35975,
-36025,
-36034,
-36063,
-36051,
-36064,
-36046,
-36047,
-36007,
-36006,
-35944,
-35936,
-35868,
-35848,
-35783,
-35760,
-35702,
-35664,
-35599,
-35547,
-35465,
-35407,
-35301,
-35234,
-35130,
-35044,
-34951,
-34847,
-34749,
-34649,
-34554,
-34449,
-34364,
-34265,
-34202,
-34109,
-34049,
-33976,
-33899,
-33836,
-33751,
-33676,
-33598,
-33511,
-33443,
-33342,
-33297,
-33200,
-33150,
-33080,
-33024,
-32991,
-32918,
-32912,
-32841,
-32828,
-32768,
+33132,
+33260,
+32763,
+33202,
+33100,
+32726,
+33172,
+33433,
+33264,
+32819,
+32963,
+33318,
+32790,
+32948,
+33077,
+32648,
+32780,
 32712,
-32658,
-32560,
-32500,
-32404,
-32324,
-32246,
-32168,
-32091,
-32027,
-31944,
-31873,
-31826,
-31753,
-31725,
-31692,
-31675,
-31654,
-31654,
-31626,
-31629,
-31584,
-31580,
-31520,
-31516,
-31466,
-31467,
+32300,
+32706,
+32461,
+31633,
+31832,
+31639,
+31383,
+32063,
+32142,
+31496,
+31886,
+31983,
+31345,
 31441,
-31442,
-31432,
-31457,
-31457,
-31477,
-31494,
-31508,
-31543,
-31570,
-31609,
-31634,
-31675,
-31693,
-31712,
-31729,
-31719,
-31744,
-31719,
-31760,
-31757,
-31787,
+32227,
+31772,
+31632,
+32526,
+32896,
+33338,
+33949,
+34166,
+34326,
+34634,
+34980,
+35368,
+35894,
+36426,
+36729,
+37050,
+37344,
+37588,
+37728,
+37743,
+37730,
+37554,
+37303,
+36928,
+36830,
+36788,
+36191,
+35838,
+35493,
+35029,
+34382,
+33968,
+33633,
+32764,
+32381,
+31748,
+31293,
+31452,
+31013,
+30699,
+30188,
+29840,
+29537,
+28836,
+29401,
+29298,
+28892,
+29322,
+29067,
+29171,
+29526,
+29497,
+29600,
+29760,
+29829,
+29848,
+30356,
+30362,
+30303,
+30924,
+31022,
+31033,
+31467,
+31459,
+31466,
+31726,
+31701,
+31628,
+31972,
+32300,
+31973,
+32204,
+32309,
+32286,
+32417,
+32720,
+32912,
+32676,
+32940,
+32947,
+33118,
+33285,
+33002,
+33382,
+33379,
+33036,
+33493,
+33620,
+33146,
+32991,
+32983,
+32780,
+32898,
+32702,
+33054,
+33000,
+32176,
+32427,
+32375,
+32213,
+32305,
+31723,
+31747,
+31824,
+31478,
+31927,
+31647,
+31384,
+31539,
+31319,
+31400,
+31635,
+31231,
+31711,
+32154,
+31824,
+32626,
+32570,
+32501,
+32958,
+32529,
+33059,
+33822,
+33187,
+33869,
+34566,
+33959,
+34579,
+34791,
+34020,
+35213,
+34987,
+34574,
+35693,
+35199,
+35200,
+35732,
+35863,
+35383,
+35511,
+36560,
+34930,
+35208,
+36606,
+34716,
+35441,
+36252,
+35012,
+34681,
+35352,
+34711,
+34164,
+34950,
+34034,
+34153,
+33715,
+33665,
+33455,
+33170,
+33805,
+31860,
+33671,
+32764,
+31594,
+34050,
+31264,
+32570,
+32730,
+31081,
+32867,
+31860,
+31948,
 31811,
-31829,
-31870,
-31881,
-31917,
+31839,
+31616,
+31703,
+31906,
+31290,
+31913,
+31222,
+30935,
+31431,
+31036,
+30560,
+31468,
+30967,
+30478,
+31197,
+30782,
+30573,
+31141,
+30490,
+30185,
+31057,
+30696,
+29842,
+31755,
+30444,
+30843,
+31738,
+30156,
+31848,
+30898,
+31096,
+31980,
+31113,
+32542,
+32063,
+32086,
+33603,
+31782,
+33083,
+33445,
+32534,
+34100,
+33125,
+34085,
+33890,
+33582,
+34543,
+32943,
+34598,
+33854,
+32389,
+34936,
+32975,
+32484,
+34006,
+32588,
+32364,
+32333,
+32543,
+31364,
+31813,
+32164,
+30493,
+32134,
+30908,
+30327,
+31951,
+30533,
+30349,
+31884,
+31006,
+29846,
+32149,
+31470,
+30453,
+32849,
+31557,
+32409,
+32884,
+31946,
+33537,
+32911,
+33607,
+33373,
+34257,
+34722,
+33679,
+35173,
+34775,
+34389,
+35412,
+35032,
+35102,
+35937,
+35044,
+35822,
+35726,
+34761,
+35625,
+35172,
+34686,
+35082,
+34916,
+34258,
+34972,
+34609,
+33678,
+34056,
+33914,
+33990,
+32675,
+33137,
+34634,
+32239,
+33113,
+33750,
+32351,
+32954,
+33170,
+32142,
+32697,
+33632,
+31669,
+32844,
+33749,
 31958,
-31986,
+32884,
+33836,
+32361,
+32615,
+33611,
+32420,
+32584,
+33525,
+31905,
+33009,
+33492,
+31484,
+32690,
+33056,
+31928,
+31667,
+32586,
+32474,
+32074,
+31519,
+32664,
+32620,
+30982,
+32263,
+32353,
+31929,
+31906,
+32508,
 32055,
-32095,
+32893,
+32399,
+31562,
+33602,
+32484,
+31935,
+33076,
+32832,
+32460,
+32879,
+32193,
+33378,
+32875,
+31904,
+33447,
+33068,
+31290,
+33177,
+32925,
+31351,
+32691,
 32164,
-32219,
-32256,
-32335,
-32354,
+32428,
+31335,
+31369,
+32970,
+30700,
+31324,
+32284,
+31271,
+30873,
+31477,
+32076,
+30188,
+32044,
+31848,
+30481,
 32421,
-32478,
-32517,
-32613,
-32676,
-32756,
-32868,
-32920,
-33045,
-33091,
-33215,
-33271,
-33375,
-33445,
-33549,
-33620,
-33728,
-33803,
-33895,
-33980,
-34067,
-34127,
-34229,
-34293,
-34397,
-34487,
-34591,
-34674,
-34790,
-34851,
-34942,
-34995,
-35078,
-35117,
-35198,
-35232,
-35284,
-35312,
-35325,
-35354,
-35328,
-35342,
-35320,
-35310,
-35309,
-35279,
-35279,
-35251,
-35215,
-35199,
-35155,
-35136,
-35099,
-35065,
-35038,
-34994,
-34957,
-34917,
-34869,
-34838,
-34774,
-34724,
-34664,
-34603,
-34542,
-34465,
-34414,
-34307,
-34265,
-34144,
-34061,
-33957,
-33824,
-33732,
-33588,
-33485,
-33359,
-33226,
-33104,
-32958,
-32826,
-32678,
-32548,
-32420,
-32287,
-32180,
-32050,
-31959,
-31809,
-31732,
-31584,
-31494,
-31385,
-31281,
-31194,
-31072,
-30981,
-30878,
-30772,
-30686,
-30580,
-30512,
-30421,
-30367,
-30287,
-30235,
-30184,
-30127,
-30105,
-30049,
-30031,
-29983,
-29963,
-29919,
-29896,
-29856,
-29833,
-29802,
-29778,
-29760,
-29732,
-29719,
-29705,
-29686,
-29694,
-29695,
-29693,
-29717,
-29716,
-29733,
-29734,
-29738,
-29737,
-29747,
-29751,
-29779,
-29788,
-29822,
-29851,
-29892,
-29936,
-29996,
-30061,
+30713,
+31557,
+32022,
+30269,
+32758,
+31598,
+31236,
+31801,
+32681,
+31752,
+30486,
+33520,
+31739,
+30710,
+33069,
+32091,
+31815,
+32023,
+32707,
+32318,
+31491,
+32811,
+32715,
+31547,
+32553,
+33296,
+31891,
+32365,
+33299,
+33008,
+32045,
+32871,
+33726,
+32606,
+33213,
+33194,
+34259,
+33385,
+32853,
+35142,
+33128,
+33660,
+34833,
+33694,
+34024,
+34711,
+34500,
+34215,
+34617,
+34908,
+35057,
+33752,
+35504,
+35555,
+34089,
+35089,
+35783,
+34302,
+34820,
+34986,
+35352,
+34762,
+34157,
+35912,
+34178,
+33941,
+34656,
+34334,
+34054,
+33775,
+33519,
+33530,
+33593,
+31947,
+32994,
+33383,
+31212,
+32488,
+32239,
+31015,
+31186,
+32199,
+30665,
+30430,
+31677,
+31322,
 30127,
-30198,
-30275,
-30332,
-30399,
-30434,
-30493,
-30521,
-30552,
-30572,
-30581,
-30576,
-30582,
-30556,
-30567,
-30564,
-30577,
-30597,
-30634,
-30646,
-30688,
-30689,
-30720,
-30711,
-30750,
-30733,
-30765,
-30735,
-30742,
-30708,
-30675,
-30646,
-30576,
-30571,
-30520,
-30526,
-30501,
-30521,
-30503,
-30512,
-30476,
-30466,
-30407,
-30369,
-30312,
-30260,
-30212,
-30180,
-30131,
-30133,
-30119,
-30131,
-30179,
-30237,
-30350,
-30518,
-30694,
-30953,
-31175,
-31417,
-31662,
-31832,
-32001,
-32105,
-32173,
-32246,
-32245,
-32288,
-32246,
-32232,
-32168,
-32099,
-32030,
-31961,
-31945,
-31953,
+30839,
+32292,
+30339,
+31043,
+31899,
+31118,
+31358,
 32018,
-32123,
-32248,
-32398,
-32538,
-32669,
-32782,
-32867,
-32975,
-33059,
-33169,
-33281,
-33393,
-33504,
-33634,
-33715,
-33831,
-33933,
-34045,
-34222,
-34385,
-34600,
-34828,
-35039,
-35235,
-35391,
-35532,
-35607,
-35713,
-35738,
-35841,
-35905,
-35983,
-36057,
-36101,
-36127,
-36144,
-36114,
-36115,
-36120,
-36116,
-36173,
-36221,
-36269,
-36328,
-36336,
-36314,
-36312,
-36256,
-36254,
-36253,
-36295,
-36348,
-36431,
-36505,
-36582,
-36615,
-36684,
-36663,
-36720,
-36706,
-36757,
-36761,
-36798,
-36762,
-36736,
-36659,
-36539,
-36439,
-36294,
-36195,
-36087,
-36011,
-35951,
-35893,
-35806,
-35741,
-35610,
-35518,
-35397,
-35276,
-35189,
-35098,
-35018,
-34931,
-34834,
-34723,
-34582,
-34463,
-34320,
-34217,
+32183,
+31942,
+32079,
+34140,
+31767,
+32811,
+34967,
+32390,
+33748,
+34333,
+34260,
+34102,
+34274,
+35237,
+34662,
+35035,
+34317,
+35193,
+35566,
+33520,
+34922,
+35293,
+33842,
+33560,
+34886,
+33346,
+33095,
+33821,
+32393,
+32721,
+32511,
+32050,
+30948,
+32437,
+30970,
+30299,
+31447,
+30531,
+29640,
+30671,
+30145,
+28950,
+30252,
+29590,
+29110,
+29341,
+30018,
+29140,
+29433,
+30296,
+29648,
+30208,
+30207,
+30431,
+31047,
+30359,
+31229,
+31298,
+31468,
+31898,
+31252,
+32767,
+31977,
+32377,
+32207,
+33062,
+32989,
+31499,
+34712,
+32424,
+32357,
+34307,
+33321,
+32980,
+33209,
+34842,
+32996,
+33448,
+34493,
+33422,
+34311,
+33723,
+34208,
+34156,
+34189,
+34796,
+33287,
+35108,
+34517,
+33792,
+35077,
+34101,
+34982,
+34427,
+34783,
+34559,
+34637,
+34929,
+34190,
+34856,
+34009,
+34850,
+34350,
+33662,
+34763,
+34359,
+33364,
+34106,
+33972,
+33304,
+33233,
+33539,
+33424,
+32080,
+33392,
+32836,
+32110,
+32103,
+32518,
+32351,
+31332,
+31693,
+32430,
+31588,
+31451,
+31363,
+32544,
+31371,
+30706,
+32838,
+31267,
+31537,
+32283,
+31611,
+32480,
+32220,
+32399,
+32727,
+32717,
+32886,
+32499,
+33658,
+32921,
+32642,
+34179,
+33498,
+32629,
+34244,
+33801,
+32734,
+34267,
+33582,
+33047,
+33808,
+33864,
+32951,
+33259,
+33993,
+32833,
+32759,
+33321,
+32379,
+32884,
+32727,
+31937,
+33357,
+32316,
+31748,
+32560,
+32551,
+31586,
+31971,
+33068,
+31959,
+31935,
+32670,
+32343,
+31932,
+31916,
+32928,
+31580,
+31917,
+32786,
+31695,
+31898,
+31777,
+32287,
+31017,
+31087,
+32207,
+30174,
+31485,
+31048,
+30604,
+31234,
+30448,
+31427,
+29774,
+31305,
+31521,
+29722,
+31907,
+31538,
+31359,
+31525,
+32124,
+32723,
+31409,
+33317,
+33034,
+32904,
+33669,
+33253,
+34480,
+34029,
+33919,
+34925,
+34604,
+34548,
+35302,
+34704,
+34688,
+35449,
+35395,
+34155,
+34821,
+36002,
+34092,
+33942,
+35264,
+34652,
+33410,
+33965,
+34430,
+34090,
+32188,
+33534,
+34195,
+31254,
+32790,
+33025,
+32195,
+31587,
+31937,
+32725,
+31374,
+30926,
+32091,
+32126,
+30469,
+30539,
+32549,
+31344,
+30213,
+31757,
+32333,
+31412,
+30409,
+32940,
+32416,
+30457,
+32440,
+33164,
+31882,
+32278,
+33364,
+34020,
+32193,
+33459,
+34230,
+33203,
+33779,
+33304,
+34490,
+34150,
+33560,
+33979,
+34334,
+34301,
+33755,
+33635,
+33948,
+33726,
+33731,
+33410,
+32955,
 34123,
-34051,
-34013,
-33953,
-33915,
-33839,
-33775,
-33672,
-33594,
-33492,
-33428,
-33353,
-33313,
-33249,
-33205,
-33131,
-33064,
-32966,
-32888,
-32805,
+33197,
+32500,
+33757,
+32785,
+32758,
+33120,
+32905,
+32853,
+32346,
+33457,
+32734,
 32720,
-32662,
-32585,
+32386,
+33801,
+33255,
+30982,
+34348,
+34063,
+31483,
+33393,
+34382,
+32340,
+32462,
+34068,
+33079,
+32275,
+33155,
+33556,
+32086,
+32574,
+33094,
 32538,
-32465,
-32372,
-32290,
-32164,
+31956,
+32834,
+32595,
+31451,
+32563,
+32240,
+32252,
+31929,
+31756,
+32394,
+32140,
+31655,
+31908,
+32474,
+31791,
+31835,
+32480,
+31950,
+32592,
+32204,
+32170,
+33011,
+32037,
+32284,
+32805,
+32385,
+32178,
+32119,
+32794,
+32010,
+31993,
+32513,
+32488,
 32067,
-31927,
-31825,
-31724,
-31627,
-31536,
-31462,
-31370,
-31297,
-31199,
-31106,
-31030,
-30943,
-30888,
-30823,
-30777,
-30727,
-30674,
-30598,
-30540,
-30464,
-30412,
-30354,
-30321,
-30286,
-30287,
-30258,
-30269,
-30234,
-30241,
-30216,
-30203,
-30195,
-30174,
-30164,
-30150,
-30131,
-30086,
-30058,
-30000,
-29968,
-29901,
-29882,
-29812,
-29825,
-29770,
-29799,
-29764,
-29804,
-29798,
-29843,
-29856,
-29924,
-29954,
-30033,
-30082,
-30179,
-30239,
-30357,
-30411,
-30534,
-30625,
-30736,
-30841,
-30972,
-31066,
-31215,
-31306,
-31436,
-31529,
-31652,
-31757,
-31869,
-31974,
-32071,
-32181,
-32276,
-32381,
-32475,
-32590,
-32701,
-32817,
-32957,
+31613,
+32550,
+32151,
+31314,
+31832,
+32732,
+31826,
+31243,
+32416,
+32169,
+32081,
+31767,
+31645,
+33312,
+32525,
+30887,
+32619,
+33646,
+31817,
+31930,
+32996,
+32808,
+32286,
+32621,
+32608,
+33217,
+32384,
+32334,
+33436,
+32981,
+32014,
+33522,
+33800,
+31800,
+33130,
+34621,
+32695,
+32928,
+34260,
+33368,
+32781,
+33610,
+34821,
+32463,
+33742,
+34763,
+33327,
+33960,
+33427,
+35189,
+33898,
+32313,
+35049,
+34797,
+33312,
+33100,
+35238,
+34215,
+32729,
+33502,
+35133,
+33971,
+31496,
+34450,
+34575,
+33577,
+31684,
+34112,
+35166,
+31573,
+32656,
+33259,
+34862,
+31427,
+30883,
+34694,
+33180,
+31223,
+31629,
+34612,
+32693,
+30423,
+32773,
+33082,
+31982,
+31280,
+31641,
+33489,
+31965,
+31027,
+33010,
+32336,
+32385,
+31633,
+31940,
+33166,
+31622,
+31928,
+32518,
+32633,
+32563,
+31511,
+32648,
+33360,
+32136,
+31837,
+32956,
+33114,
+32421,
+31776,
+33355,
+33800,
+31756,
+32605,
+34182,
+32720,
+32085,
+33085,
+33998,
+32625,
+31814,
+34287,
+33131,
+32220,
+33325,
+33651,
+32524,
+32070,
+33730,
+33372,
+32163,
+31943,
+33485,
+33846,
+30681,
+30976,
+34765,
+32832,
+30235,
+32085,
+33519,
+31951,
+30549,
+31536,
+32725,
+32036,
+31173,
+31643,
+32123,
+31803,
+31290,
+31595,
+32037,
+31110,
+32112,
+32184,
+31193,
+31208,
+33193,
+32037,
+30788,
+32402,
+32798,
+32411,
+31528,
+32634,
+32755,
 33069,
-33236,
-33353,
+32546,
+32683,
+33231,
 33519,
-33657,
-33804,
-33964,
-34103,
-34260,
-34405,
-34538,
-34677,
-34791,
-34896,
-35004,
-35075,
-35175,
-35232,
-35317,
-35373,
-35445,
-35487,
-35539,
-35581,
-35605,
-35632,
-35651,
-35664,
-35686,
-35696,
-35693,
-35710,
-35692,
-35700,
-35677,
-35675,
-35650,
-35656,
-35652,
-35637,
-35660,
-35635,
-35636,
-35621,
-35599,
-35559,
-35552,
-35488,
-35468,
-35418,
-35351,
-35306,
-35203,
-35140,
-35031,
-34953,
-34841,
-34763,
-34662,
-34567,
-34479,
-34372,
-34291,
-34182,
-34107,
-33999,
-33929,
-33814,
-33754,
-33658,
-33592,
-33521,
-33464,
-33392,
-33350,
-33273,
-33235,
-33185,
-33150,
-33119,
-33101,
-33083,
-33052,
-33032,
-32995,
-32963,
-32928,
-32880,
-32843,
+32940,
+33259,
+33053,
+33505,
+34633,
+33028,
+33225,
+34048,
+34645,
+32948,
+33783,
+34645,
+33895,
+33241,
+34082,
+33968,
+33524,
+34019,
+33836,
+32989,
+33803,
+34380,
 32799,
-32766,
-32717,
-32683,
-32648,
-32598,
-32566,
-32509,
-32496,
-32452,
-32444,
-32429,
-32394,
-32407,
-32361,
-32369,
-32334,
-32330,
-32317,
-32317,
-32306,
-32312,
-32314,
-32329,
-32344,
-32362,
-32380,
-32387,
-32401,
-32414,
-32411,
-32427,
-32422,
-32435,
-32434,
-32422,
-32412,
-32383,
-32359,
+33190,
+33125,
+33714,
+32599,
+33109,
+33053,
 32340,
-32311,
-32309,
-32292,
-32300,
-32311,
-32301,
-32322,
-32304,
-32306,
-32305,
-32309,
-32301,
-32329,
-32297,
-32320,
-32280,
-32257,
-32226,
-32174,
-32153,
-32105,
-32092,
-32060,
-32056,
-32033,
-32024,
-31996,
-31988,
-31956,
-31946,
-31926,
-31910,
-31924,
-31897,
-31911,
-31896,
-31903,
-31887,
-31885,
-31880,
-31896,
-31910,
-31946,
-31961,
-32013,
-32028,
-32066,
-32063,
-32063,
-32059,
-32027,
-32029,
-32004,
-31998,
-31990,
-31966,
-31946,
-31925,
+33818,
+32702,
+32215,
+33439,
+33110,
+33161,
+32188,
+33166,
+33661,
+32851,
+32687,
+33192,
+34087,
+33411,
+31317,
+33609,
+35932,
+32010,
+32157,
+34169,
+34503,
+32546,
+32089,
+34131,
+33726,
+33082,
 31889,
-31890,
-31867,
-31904,
-31920,
-31970,
-32006,
-32049,
-32078,
-32109,
-32119,
-32127,
+32925,
+34294,
+32423,
+31499,
+32974,
+33204,
+31272,
+32216,
+32951,
+31679,
+32340,
+32037,
+32184,
+32195,
+31810,
+32050,
+31638,
 32125,
-32131,
-32133,
-32139,
-32128,
-32121,
-32105,
-32062,
-32056,
-32004,
-31994,
-31986,
-31974,
-31981,
-31980,
-31964,
-31965,
-31930,
+31774,
+32137,
+33264,
 31913,
+32102,
+33819,
+31663,
+32947,
+33218,
+32485,
+32959,
+32774,
+33232,
+32810,
+33765,
+32923,
+33519,
+33098,
+31677,
+34332,
+33642,
+31808,
+32764,
+33176,
+33286,
+31615,
+32512,
+33218,
 31871,
-31846,
-31794,
-31788,
-31752,
-31739,
-31736,
-31699,
-31704,
-31650,
-31657,
-31603,
-31620,
+32024,
+31424,
+32641,
+31970,
+30825,
+32647,
 31582,
-31612,
-31586,
-31619,
-31591,
-31593,
-31572,
-31547,
-31539,
-31518,
-31516,
-31525,
-31537,
-31561,
-31579,
-31603,
-31622,
-31644,
-31662,
-31698,
-31706,
-31766,
-31774,
-31818,
-31837,
-31848,
-31858,
-31867,
-31860,
-31878,
-31870,
-31898,
-31907,
-31930,
-31949,
-31975,
-31998,
-32019,
-32038,
-32048,
-32066,
-32087,
-32091,
-32124,
-32123,
-32150,
-32145,
+31166,
 32165,
-32148,
-32169,
-32169,
-32192,
-32211,
-32233,
-32261,
-32292,
-32320,
-32344,
-32366,
-32386,
-32398,
-32417,
-32432,
-32451,
-32471,
-32482,
-32495,
-32507,
-32500,
-32503,
-32504,
-32492,
-32518,
-32482,
-32509,
-32482,
-32468,
-32477,
-32414,
-32432,
-32363,
-32355,
-32305,
-32275,
-32242,
-32208,
-32194,
-32162,
-32136,
-32128,
-32075,
-32097,
-32051,
-32065,
+32331,
+31618,
+30940,
+32584,
+32508,
+30793,
+32223,
+32818,
+31730,
+32189,
+32053,
+32902,
+33202,
+31679,
+32705,
+33876,
+32253,
+31755,
+33199,
+33735,
+32215,
+32956,
+32785,
+32940,
+34028,
+32311,
+32754,
+32981,
+33013,
+33277,
+32091,
+33342,
+33981,
+32039,
+32149,
+33447,
+33698,
+32831,
+32241,
+33808,
+33079,
+32171,
+33236,
+33089,
+32768,
+32714,
+33772,
+32472,
+32422,
+33513,
+32630,
+32721,
+32996,
+32945,
+32337,
+32775,
+33568,
+32771,
+32337,
+33124,
+33236,
+33603,
+32994,
+32813,
+33908,
+33472,
+33363,
+33436,
+33187,
+33359,
+33610,
+33941,
+33199,
+33794,
+33872,
+33431,
+33611,
+33620,
+33891,
+33259,
+34390,
+33579,
+32869,
+34461,
+34182,
+33061,
+33021,
+33506,
+33749,
+33342,
+32957,
+33254,
+33541,
+33207,
+32384,
+33733,
+33407,
+32306,
+32372,
+31971,
+32769,
+32562,
+32568,
+32669,
+31756,
+32016,
 32046,
-32037,
-32027,
-32014,
-31984,
-31972,
-31949,
-31910,
-31897,
-31847,
-31841,
-31802,
-31795,
-31785,
-31767,
-31773,
-31767,
-31781,
-31801,
-31821,
-31854,
-31886,
-31904,
-31955,
-31983,
-32012,
-32067,
-32092,
+32289,
+32098,
+31073,
+31736,
+32246,
+31552,
+32528,
+32394,
+31193,
+31097,
+31976,
+32044,
+31877,
+31601,
+31605,
+31535,
+32079,
+32419,
+31766,
+32149,
+32184,
+31964,
 32137,
-32174,
-32201,
-32241,
-32280,
-32311,
-32357,
-32365,
-32415,
+31784,
+32056,
+32531,
+31914,
+32631,
+32196,
 32422,
-32451,
-32471,
-32473,
-32484,
-32474,
-32462,
-32466,
-32451,
-32471,
-32467,
-32500,
-32511,
-32542,
-32577,
-32633,
-32679,
-32770,
-32836,
-32938,
-33046,
-33139,
-33254,
-33342,
-33424,
-33492,
-33540,
-33575,
-33607,
-33614,
-33644,
-33615,
-33628,
-33568,
-33538,
-33470,
+32492,
+32661,
+33161,
+32340,
+32644,
+32436,
+32756,
+32993,
+32589,
+33310,
+33533,
+33233,
+32877,
+33279,
+33891,
+32909,
+33351,
+33187,
 33419,
-33370,
-33319,
-33301,
-33246,
-33254,
-33214,
-33216,
+33632,
+32915,
+33755,
+33299,
+33541,
+33569,
+32779,
+33143,
+33123,
+33831,
+32817,
+32786,
+33278,
+33178,
+33122,
+32315,
+33133,
+33026,
+32576,
+32758,
+32889,
+32326,
+32352,
+32434,
+32143,
+32682,
+32674,
+32747,
+32123,
+31909,
+32807,
+32200,
+32650,
+32452,
+31697,
+32047,
+32620,
+32176,
+32440,
+32651,
+32098,
+32569,
+32582,
+32270,
+32515,
+32664,
+32463,
+32963,
+32547,
+32534,
+33388,
+32929,
+32394,
+33015,
+32964,
+32791,
+32640,
+32754,
+33290,
+33076,
+33183,
 33175,
-33164,
-33145,
-33119,
-33121,
-33125,
-33148,
-33191,
-33202,
-33256,
-33263,
+33425,
+33277,
+32665,
+33396,
+33554,
+32728,
+33192,
+33897,
+33362,
+33384,
+33760,
+33085,
+33113,
+33433,
+33199,
+33400,
+32925,
+33622,
+33399,
+33317,
+33289,
+32721,
+33176,
+32853,
+32855,
+32783,
+33102,
+32812,
+32569,
+32962,
+32585,
+32512,
+32718,
+32722,
+32042,
+31919,
+32337,
+32161,
+32345,
+32065,
+32278,
+32556,
+32135,
+31786,
+31773,
+32255,
+32125,
+32052,
+32045,
+32045,
+32304,
+32014,
+32034,
+32530,
+32236,
+32487,
+31844,
+32192,
+33027,
+32206,
+32757,
+32969,
+32689,
+32872,
+32745,
+33129,
+32967,
+32986,
+33342,
+32674,
 33303,
-33344,
-33376,
-33444,
-33526,
-33578,
-33692,
-33741,
-33821,
-33877,
-33916,
-33959,
-33985,
-34027,
-34064,
-34102,
-34158,
-34190,
-34219,
-34222,
-34214,
-34208,
-34189,
-34193,
-34202,
-34223,
-34256,
-34281,
-34297,
-34327,
-34320,
-34350,
-34360,
-34404,
-34459,
-34520,
-34614,
-34685,
-34767,
-34834,
-34882,
-34940,
-34980,
-35030,
-35086,
-35136,
-35201,
-35234,
-35258,
-35262,
-35245,
-35231,
-35204,
-35187,
-35180,
-35173,
-35183,
-35176,
-35176,
-35156,
-35143,
-35106,
-35075,
-35062,
-35046,
-35057,
-35070,
-35063,
-35080,
-35022,
-35016,
-34954,
-34921,
-34883,
-34858,
-34818,
-34812,
-34776,
-34746,
-34699,
-34650,
-34572,
-34523,
-34437,
-34407,
-34357,
-34338,
-34321,
-34266,
-34240,
-34169,
-34118,
-34071,
-34011,
-33980,
-33936,
-33900,
-33871,
-33811,
-33770,
-33690,
-33630,
-33535,
-33468,
-33393,
-33339,
-33300,
+33202,
+33208,
+33345,
+33285,
+33474,
+33272,
+33179,
+33346,
+33749,
+33346,
+33454,
+33368,
+33419,
+33301,
 33257,
-33206,
-33163,
-33088,
+33485,
+33265,
+33111,
+33010,
+33156,
+33183,
+32958,
+32753,
+33118,
+33119,
+32433,
+33011,
+33060,
+32443,
+32297,
+32672,
+33015,
+32099,
+32592,
+32959,
+32502,
+32381,
+32444,
+32430,
+31796,
+32103,
+32500,
+32353,
+32176,
+32426,
+32512,
+32364,
+32189,
+32115,
+32309,
+32148,
+32325,
+32257,
+32613,
+32684,
+32313,
+32525,
+32627,
+32472,
+32298,
+32514,
+32759,
+32675,
+32683,
+32547,
+32776,
+33143,
+33108,
+33276,
+33035,
+33036,
+32904,
+33116,
+33162,
+32748,
+33405,
+33538,
+33265,
+33290,
+33228,
+33369,
+33284,
+33179,
+33239,
+33240,
+33394,
+33144,
+32922,
+33337,
+33668,
+33357,
+32832,
+32631,
 33047,
-32974,
-32947,
-32902,
-32883,
-32852,
-32846,
-32819,
-32796,
-32778,
-32729,
-32717,
-32666,
-32664,
+32844,
+32437,
+33016,
+33127,
+32670,
+32502,
+32531,
+32625,
+32716,
+32549,
+32483,
+32252,
+32345,
+32259,
+32350,
+32745,
+32299,
+32252,
+32295,
+32522,
+32330,
+32231,
+32558,
+32420,
+32241,
+32278,
+32600,
+32587,
+32462,
+32489,
+32396,
+32564,
+32627,
+32584,
+32557,
+32856,
+32935,
+32672,
+32754,
+32810,
+32519,
+32802,
+32827,
+32743,
+32898,
+32875,
+32786,
+32758,
+33025,
+32959,
+33022,
+32580,
+32771,
+32995,
+32816,
+32920,
+32869,
+32953,
+32959,
+32809,
+33051,
+33067,
+32793,
+32938,
+33029,
+32877,
+32913,
+33027,
+33008,
+33209,
+33086,
+32910,
+32853,
+32656,
+33019,
+33040,
+32818,
+32960,
+33045,
+33005,
+32944,
+32937,
+32937,
+32817,
+32579,
+32912,
+32987,
+32632,
+32593,
+32771,
+32753,
 32636,
-32652,
-32639,
-32661,
-32638,
-32642,
-32608,
-32598,
-32590,
+32733,
+33054,
+32609,
+32370,
+32653,
+32478,
+32761,
+32610,
 32572,
-32587,
-32590,
+32575,
+32651,
+33021,
+32608,
+32583,
+32768,
+32726,
+32667,
+32636,
+32602,
+32585,
+32734,
+32589,
+32866,
+32938,
+32354,
+32691,
+32807,
+32496,
+32774,
+32565,
+32160,
+32631,
+33097,
+32719,
+32530,
+32677,
+32809,
+32637,
+32493,
+32705,
+32737,
+32416,
+32212,
+32733,
+32807,
+32469,
+32786,
+33085,
+32594,
+32641,
+32809,
+32638,
+32663,
+32720,
+32797,
+32843,
+32689,
+33022,
+33253,
+32799,
+33204,
+32993,
+33099,
+33203,
+32662,
+32922,
+32876,
+33056,
+33004,
+32950,
+33348,
+32712,
+33023,
+33135,
+33327,
+33026,
+32737,
+33201,
 32598,
-32615,
-32606,
-32627,
+33091,
+32964,
+32872,
+32997,
+32521,
+33134,
+32927,
+32726,
+33004,
+32680,
+32781,
+32443,
+33005,
 32607,
-32635,
-32601,
-32646,
-32641,
-32682,
-32730,
-32749,
-32801,
-32806,
-32847,
-32857,
+32332,
+33050,
+32522,
+32680,
+32434,
+32354,
+32997,
+32524,
+32574,
+32530,
+32412,
+32487,
+32227,
+32460,
+32615,
+32616,
+32757,
+32548,
+32275,
+32419,
+32812,
+32666,
+32465,
+32659,
+32468,
+32660,
+32686,
+32944,
+32732,
+32396,
+32368,
+32557,
+32808,
 32886,
-32909,
+32738,
+32586,
+32744,
+32887,
+33073,
+32866,
+32703,
+32704,
+32704,
+32947,
+33168,
+32928,
+32971,
+32876,
+33014,
+33312,
+33020,
+33123,
+33201,
+33163,
+33076,
+32772,
+33317,
+33132,
+33178,
+33112,
+32843,
+33112,
+32760,
+32993,
+32969,
+33026,
+33033,
+32901,
+32978,
+32853,
+32813,
+32551,
+32821,
+32740,
+32415,
+32513,
+32617,
+32749,
+32690,
+32563,
+32421,
+32696,
+32470,
+32307,
+32438,
+32194,
+32338,
+32125,
+32293,
+32571,
+32454,
+32473,
+32303,
+32437,
+32334,
+32116,
+32259,
+32253,
+32389,
+32536,
+32453,
+32953,
+32750,
+32552,
+32635,
+32618,
+32848,
+32590,
+32792,
+32962,
+32871,
+33284,
 32952,
-32987,
-33028,
-33071,
+33086,
+33234,
+33195,
+33219,
+33043,
+33457,
+33235,
 33104,
-33137,
-33164,
-33187,
-33215,
-33241,
-33255,
-33302,
-33323,
-33361,
-33386,
-33388,
-33385,
-33366,
-33354,
-33346,
-33323,
-33317,
-33287,
-33276,
+33358,
+33367,
+33552,
+33397,
+33342,
+33246,
+33295,
+33422,
+33105,
 33232,
-33210,
-33159,
-33130,
-33085,
-33050,
-33020,
-33002,
-32979,
-32986,
-32964,
-32967,
-32940,
-32934,
-32911,
-32939,
-32919,
+33017,
+33005,
+33177,
+33177,
+33032,
+32723,
+33247,
+32818,
+32553,
+32894,
+32735,
+32666,
+32448,
+32460,
+32427,
+32484,
+32486,
+32418,
+32431,
+32660,
+32369,
+32295,
+32215,
+32155,
+32399,
+32197,
+32509,
+32261,
+31865,
+32242,
+32141,
+32383,
+32618,
+32389,
+32336,
+32106,
+32339,
+32666,
+32452,
+32118,
+32280,
+32408,
+32337,
+32835,
+32894,
+32845,
+32871,
+32595,
+32655,
+33017,
+32955,
+33070,
+32956,
+33028,
+33311,
+33102,
+33107,
+33417,
+33544,
+33249,
+33363,
+33112,
+33314,
+33254,
+33346,
+33750,
+33383,
+33376,
+33354,
+33245,
+33281,
+33267,
+33422,
+33205,
+32772,
+32831,
+32942,
+33139,
+33003,
+32860,
+32923,
+32584,
+32648,
+32585,
+32309,
+32407,
+32481,
+32243,
+32397,
+32429,
+32150,
+32390,
+32334,
+32094,
+32337,
+32317,
+32281,
+32158,
+32217,
+32351,
+32286,
+32200,
+32194,
+32209,
+32219,
+32257,
+32656,
+32699,
+32622,
+32413,
+32522,
+32691,
+32584,
+32699,
+32580,
+32853,
+32597,
+32974,
+32906,
+33000,
+33135,
+32779,
+33164,
+33092,
+33173,
+33167,
+33234,
+33129,
+33160,
+33137,
+32973,
+33275,
+33430,
+33270,
+33095,
+33099,
+33169,
+33261,
+33063,
+33107,
+33485,
+33094,
+32604,
 32957,
-32959,
+33119,
+32884,
+33194,
+32932,
+32795,
+32782,
+32575,
+32928,
+32784,
+32684,
+32395,
+32702,
+32718,
+32425,
+32489,
+32560,
+32507,
+32497,
+32516,
+32371,
+32380,
+32333,
+32284,
+32496,
+32716,
+32395,
+32339,
+32427,
+32662,
+32466,
+32330,
+32499,
+32564,
+32397,
+32556,
+32544,
+32712,
+32761,
+32675,
+32846,
+32640,
+32564,
+32674,
+33057,
 32974,
-32977,
-32973,
+32807,
+33118,
+32872,
+32855,
+33228,
+32880,
+32892,
+32902,
+33119,
+33017,
+33078,
+33179,
+32988,
+33131,
+32910,
+33073,
+33038,
+33004,
+32795,
+32859,
+33250,
+32734,
+33116,
+32986,
+32651,
+33030,
+33042,
 32957,
+32573,
+32773,
 32959,
-32932,
-32915,
-32896,
-32865,
-32850,
-32807,
-32766,
-32718,
-32635,
-32580,
-32469,
-32425,
-32329,
-32276,
-32205,
-32116,
-32043,
-31952,
-31861,
-31788,
-31693,
-31633,
-31556,
-31506,
-31443,
-31403,
-31334,
-31275,
-31213,
-31112,
-31073,
-30958,
-30935,
-30842,
-30809,
-30726,
-30658,
-30562,
-30475,
-30379,
-30302,
-30211,
-30144,
-30066,
-30001,
-29934,
-29852,
-29790,
-29693,
-29639,
-29537,
-29491,
-29412,
-29382,
-29334,
-29300,
-29235,
-29206,
-29118,
-29102,
-29027,
-29020,
-28997,
-28977,
-28966,
-28958,
-28940,
-28926,
-28915,
-28892,
-28891,
-28886,
-28899,
-28930,
-28947,
-28970,
-28989,
-28980,
-29006,
-28976,
-29033,
-29022,
-29075,
-29088,
-29117,
-29135,
-29158,
-29163,
-29188,
-29203,
-29213,
-29265,
-29276,
-29344,
-29381,
-29440,
-29500,
-29557,
-29607,
-29659,
-29739,
-29803,
-29923,
-29995,
-30099,
-30192,
-30277,
-30362,
-30448,
-30540,
-30629,
-30729,
-30806,
-30920,
-30994,
-31086,
-31150,
-31206,
-31274,
-31312,
-31375,
-31406,
-31481,
-31497,
-31564,
-31574,
-31608,
-31643,
-31662,
-31736,
-31770,
-31867,
-31930,
-32037,
-32109,
-32231,
-32315,
-32433,
-32551,
-32672,
-32799,
-32940,
-33040,
-33177,
-33246,
-33338,
-33378,
-33438,
-33475,
-33510,
-33552,
-33560,
-33587,
-33573,
-33566,
-33549,
-33530,
-33535,
-33529,
-33549,
-33577,
-33606,
-33652,
-33676,
-33721,
-33758,
-33792,
-33863,
-33920,
-34018,
-34109,
-34203,
-34302,
-34401,
-34470,
-34575,
-34635,
-34761,
-34832,
-34975,
-35068,
-35188,
-35286,
-35356,
-35442,
-35498,
-35548,
-35629,
-35676,
-35766,
-35838,
-35906,
-35956,
-36006,
-36023,
-36046,
-36063,
-36092,
-36128,
-36181,
-36244,
-36288,
-36347,
-36363,
-36400,
-36413,
-36435,
-36489,
-36525,
-36596,
-36667,
-36720,
-36778,
-36797,
-36810,
-36819,
-36814,
-36822,
-36815,
-36830,
-36815,
-36814,
-36768,
-36726,
-36647,
-36577,
-36487,
-36425,
-36361,
-36311,
-36259,
-36193,
-36134,
-36033,
-35960,
-35841,
-35768,
-35662,
-35593,
-35519,
-35446,
-35378,
-35286,
-35183,
-35075,
-34936,
-34844,
-34716,
-34644,
-34548,
-34477,
-34383,
-34292,
-34187,
-34076,
-33957,
-33859,
-33754,
-33686,
-33591,
-33529,
-33453,
-33379,
-33298,
-33183,
-33105,
-32984,
-32923,
-32835,
-32776,
-32727,
-32646,
+32704,
+32798,
+32855,
+32726,
+32845,
+32417,
+32717,
+32943,
+32539,
+32507,
+32673,
+32806,
+32577,
 32580,
-32488,
-32403,
-32315,
-32230,
-32162,
-32094,
-32061,
-31999,
-31969,
-31917,
-31858,
-31821,
-31743,
-31717,
-31664,
-31652,
-31628,
-31619,
-31592,
-31566,
-31535,
-31497,
-31458,
-31433,
-31398,
-31396,
-31389,
-31396,
-31395,
-31406,
-31395,
-31395,
-31381,
-31387,
-31376,
-31410,
-31410,
-31467,
-31473,
-31506,
-31500,
-31508,
-31501,
-31500,
-31514,
-31522,
-31555,
-31570,
-31586,
-31612,
-31597,
-31624,
-31608,
-31625,
-31642,
-31647,
-31690,
-31720,
-31754,
-31798,
-31819,
-31852,
-31873,
-31905,
-31952,
-31988,
-32056,
-32101,
-32151,
-32210,
-32242,
-32287,
-32309,
-32343,
-32363,
-32406,
-32436,
-32486,
-32520,
-32563,
-32587,
-32613,
-32628,
-32652,
-32682,
-32722,
+32753,
+32467,
+32651,
+32564,
+32507,
+32427,
+32498,
+32496,
+32761,
+32627,
+32338,
+32725,
+32465,
+32300,
+32568,
+32905,
+32540,
+32274,
+32408,
+32554,
+32678,
+32427,
+32621,
+32558,
+32448,
+32458,
+32562,
+32787,
+32604,
+32522,
 32778,
-32829,
-32886,
-32937,
-32993,
-33042,
-33102,
-33135,
+32742,
+32758,
+32734,
+32474,
+32697,
+32887,
+33028,
+32828,
+32717,
+32870,
+32926,
+33152,
+32944,
+33084,
+33281,
+33111,
+33007,
+33136,
+33343,
+33281,
+33068,
+33185,
+33432,
+33405,
+33355,
 33228,
-33256,
-33367,
-33427,
-33507,
-33599,
-33659,
-33727,
-33794,
-33840,
-33920,
-33970,
-34046,
-34115,
-34170,
-34229,
-34269,
-34302,
-34347,
-34366,
-34405,
-34418,
-34453,
-34468,
-34513,
-34521,
-34556,
-34558,
-34567,
-34575,
-34569,
-34579,
-34601,
-34601,
-34629,
-34632,
-34646,
-34653,
-34645,
-34663,
-34627,
-34660,
-34631,
-34659,
-34645,
-34661,
-34642,
-34641,
-34608,
-34582,
-34556,
-34520,
-34493,
-34460,
-34419,
-34383,
-34342,
-34295,
-34245,
-34196,
-34125,
-34088,
-34022,
-33991,
-33918,
-33887,
-33823,
-33785,
-33721,
-33661,
+33245,
+33306,
+33288,
+33282,
+33311,
+33184,
+33189,
+33375,
+33117,
+33276,
+32833,
+32760,
+32986,
+32818,
+33080,
+32966,
+32881,
+32673,
+32481,
+32519,
+32481,
+32486,
+32381,
+32567,
+32583,
+32492,
+32223,
+32129,
+32584,
+32210,
+32181,
+32330,
+31949,
+32243,
+32071,
+32310,
+32309,
+32152,
+32341,
+31981,
+31996,
+32214,
+32343,
+32267,
+32330,
+32214,
+32220,
+31984,
+32156,
+32477,
+32739,
+32375,
+32333,
+32422,
+32270,
+32665,
+32843,
+33069,
+32620,
+32880,
+32839,
+32692,
+33101,
+33045,
+33092,
+33117,
+33199,
+33495,
+33381,
 33593,
-33531,
-33473,
-33417,
-33349,
-33317,
-33244,
-33210,
-33141,
-33082,
-33022,
-32951,
-32902,
-32840,
-32795,
-32747,
-32691,
-32643,
-32575,
-32520,
-32469,
-32391,
-32361,
+33256,
+33212,
+33762,
+33458,
+33559,
+33520,
+33538,
+33606,
+33387,
+33651,
+33462,
+33416,
+33626,
+33355,
+33372,
+33300,
+33136,
+33276,
+33020,
+32875,
+32940,
+33117,
+32829,
+32640,
+32834,
+32542,
+32666,
+32493,
+32460,
+32542,
+32293,
+32342,
+32580,
+32401,
+32509,
+32346,
+31920,
+32529,
+32202,
+32349,
+32322,
+32154,
+32430,
+32197,
+32332,
+32553,
 32289,
-32270,
-32222,
-32199,
-32165,
-32134,
-32111,
-32065,
-32071,
-32021,
-32018,
-31997,
-31974,
-31978,
-31948,
-31942,
-31926,
-31898,
-31894,
-31861,
-31868,
-31834,
-31849,
-31842,
-31833,
-31849,
-31829,
-31843,
-31832,
-31835,
-31832,
-31843,
-31836,
-31863,
-31838,
-31857,
-31845,
-31844,
-31836,
-31827,
-31821,
-31816,
-31801,
-31815,
-31799,
-31810,
-31803,
-31788,
-31795,
-31780,
-31786,
-31793,
-31782,
-31801,
-31812,
-31809,
-31847,
-31839,
-31864,
-31871,
-31885,
-31903,
-31906,
-31927,
-31932,
-31932,
-31939,
-31933,
-31919,
-31902,
-31874,
-31854,
-31821,
-31805,
-31761,
-31769,
-31721,
-31722,
-31693,
-31668,
-31661,
-31649,
-31625,
-31662,
-31628,
-31661,
-31645,
-31668,
-31646,
-31667,
-31650,
-31652,
-31645,
-31638,
-31640,
-31630,
-31635,
-31604,
-31601,
-31563,
-31528,
-31506,
-31449,
-31444,
-31393,
-31388,
-31336,
-31308,
-31262,
-31209,
-31176,
-31116,
-31083,
-31050,
-31009,
-31011,
-30947,
-30947,
-30893,
-30866,
-30823,
-30785,
-30755,
-30716,
-30711,
-30679,
-30655,
-30626,
-30574,
-30537,
-30505,
-30449,
-30423,
-30396,
-30373,
-30349,
-30351,
-30325,
-30328,
-30307,
-30299,
-30313,
-30301,
-30329,
-30345,
-30368,
-30418,
-30412,
-30456,
-30448,
-30459,
-30464,
-30467,
-30482,
-30491,
-30520,
-30518,
-30544,
-30543,
-30566,
-30575,
-30579,
-30609,
-30626,
-30677,
-30716,
-30780,
-30831,
-30882,
-30936,
-30970,
-31015,
-31084,
-31110,
-31206,
-31253,
-31314,
-31394,
-31419,
-31490,
-31507,
-31568,
-31595,
-31649,
-31676,
-31748,
-31762,
-31855,
-31862,
-31944,
-31962,
-32014,
-32045,
-32115,
+32249,
+32353,
+32445,
+32426,
+32311,
+32591,
+32477,
+32517,
+32559,
+32580,
+32567,
+32489,
+32608,
+32610,
+32473,
+32790,
+32729,
+32693,
+33145,
+32780,
+32862,
+32924,
+32814,
+32974,
+32734,
+32921,
+33010,
+33183,
+33246,
+32808,
+33151,
+33066,
+33086,
+33305,
+32941,
+32940,
+32869,
+33062,
+33236,
+32982,
+33070,
+32983,
+32888,
+33124,
+33037,
+32798,
+32804,
+33039,
+32627,
+32637,
+32899,
+32743,
+32597,
+32531,
+32663,
+32698,
+32702,
+32582,
+32685,
+32613,
+32535,
+32546,
+32733,
+32875,
+32503,
+32703,
+32578,
+32747,
+32792,
+32622,
+32830,
+32552,
+32739,
+32913,
+32916,
+32894,
+32702,
+32784,
+32801,
+33003,
+32813,
+32894,
+33034,
+32856,
+33066,
+32913,
+32975,
+32966,
+32760,
+32906,
+32862,
+32908,
+32738,
+32780,
+33106,
+32755,
+32733,
+32931,
+32946,
+32752,
+32626,
+32646,
+32720,
+32617,
+32662,
+32759,
+32590,
+32621,
+32409,
+32529,
+32587,
+32483,
+32681,
+32297,
+32351,
+32264,
 32168,
-32254,
-32314,
-32407,
-32466,
-32532,
-32581,
-32628,
-32684,
-32699,
-32770,
-32774,
-32831,
-32843,
-32871,
-32879,
+32558,
+32425,
+32306,
+32307,
+32140,
+32409,
+32475,
+32355,
+32201,
+32067,
+32269,
+32228,
+32389,
+32319,
+32345,
+32229,
+32054,
+32556,
+32442,
+32357,
+32334,
+32484,
+32427,
+32510,
+32719,
+32529,
+32781,
+32420,
+32757,
+32649,
+32277,
+32920,
+32962,
+32810,
+33023,
+32980,
+32939,
+33045,
+33139,
+33107,
+33051,
+33024,
+33219,
+33387,
+33175,
+33534,
+33287,
+33307,
+33290,
+33146,
+33448,
+33480,
+33700,
+33478,
+33875,
+33729,
+33323,
+33760,
+33462,
+33570,
+33398,
+33404,
+33556,
+33376,
+33911,
+33629,
+33742,
+33681,
+33211,
+33580,
+33333,
+33516,
+33479,
+33303,
+33352,
+33110,
+33501,
+33401,
+33226,
+33363,
+32928,
+33059,
+32946,
+32912,
+32962,
+32974,
+33091,
+32794,
+32997,
+32641,
+32409,
+32565,
+32590,
+32510,
+32283,
+32395,
+32258,
+32483,
+32515,
+32363,
+32516,
+32116,
+32045,
+32011,
+31844,
+32019,
+32074,
+32130,
+31987,
+31976,
+32078,
+31965,
+31973,
+31927,
+31968,
+31948,
+31874,
+32250,
+31759,
+31986,
+32155,
+32108,
+32419,
+31693,
+32136,
+31980,
+32119,
+32374,
+31969,
+32141,
+32071,
+32379,
+32566,
+32536,
+32388,
+32196,
+32377,
+32632,
+32513,
+32368,
+32351,
+32364,
+32664,
+32925,
+32650,
+32695,
+32575,
+32766,
+32818,
+32882,
+32683,
+32687,
+32880,
+32691,
+32916,
+32812,
+33052,
+33169,
+33222,
+33213,
 32864,
-32859,
-32839,
-32838,
-32843,
-32837,
-32860,
-32869,
+33029,
 32881,
-32892,
-32904,
-32896,
-32918,
-32933,
-32947,
-32987,
-33017,
-33056,
-33087,
-33124,
-33130,
-33146,
-33148,
-33126,
-33146,
-33151,
-33152,
-33176,
-33163,
+33096,
+33108,
+33220,
+33057,
+32991,
+33352,
+32948,
+33443,
+33328,
+33089,
+33329,
+32840,
+33272,
+33391,
+33243,
+33249,
+32999,
+33314,
+33195,
+33161,
+33431,
+33041,
+33153,
+33311,
+33052,
+33331,
+33254,
+33107,
+33031,
+32895,
 33156,
+33135,
+33107,
+33116,
+32880,
+32901,
+33129,
 33133,
-33105,
-33069,
-33057,
-33023,
-33040,
-33021,
-33053,
-33038,
+32857,
+32863,
+32689,
+32760,
 33078,
-33060,
-33075,
-33076,
-33077,
-33115,
-33131,
-33201,
-33256,
-33323,
-33376,
-33420,
-33482,
-33507,
+32987,
+32883,
+32932,
+32815,
+32923,
+33074,
+33012,
+32757,
+32448,
+32747,
+32835,
+32955,
+32650,
+32866,
+32955,
+32629,
+32761,
+32934,
+32911,
+32934,
+32877,
+32879,
+32782,
+32663,
+33032,
+32991,
+32877,
+32915,
+32801,
+33053,
+32731,
+32777,
+33047,
+32763,
+32845,
+32767,
+32832,
+32732,
+32745,
+32582,
+32664,
+32536,
+32709,
+32650,
+32424,
+32663,
+32463,
+32549,
+32584,
+32542,
+32530,
+32348,
+32237,
+32111,
+32242,
+32314,
+32239,
+31980,
+32086,
+32215,
+31924,
+32393,
+32089,
+32084,
+32024,
+31894,
+32346,
+32053,
+31947,
+31996,
+32262,
+32291,
+32105,
+32303,
+32128,
+32228,
+32420,
+32367,
+32547,
+32270,
+32081,
+32596,
+32922,
+32872,
+32858,
+32655,
+32793,
+32965,
+33264,
+33114,
+32968,
+32914,
+33042,
+33113,
+33387,
 33575,
-33626,
-33725,
-33802,
-33900,
-33975,
-34065,
-34113,
-34190,
-34222,
-34285,
-34337,
-34402,
-34486,
-34558,
-34622,
-34681,
-34725,
-34758,
-34795,
-34831,
-34879,
-34947,
-35021,
-35114,
-35183,
-35268,
-35313,
-35383,
-35425,
-35511,
-35573,
-35677,
-35773,
-35874,
-35962,
-36050,
-36109,
-36154,
-36212,
-36241,
-36298,
-36352,
-36406,
-36448,
-36482,
-36481,
-36477,
-36453,
-36424,
-36425,
-36403,
-36422,
-36426,
-36413,
-36436,
-36384,
-36384,
-36325,
-36307,
-36272,
-36275,
-36257,
-36272,
-36260,
-36246,
-36215,
-36160,
-36104,
-36049,
-36001,
-35959,
-35935,
-35890,
-35858,
-35780,
-35704,
-35608,
-35524,
-35432,
-35366,
-35283,
-35235,
-35150,
-35107,
-35012,
-34933,
-34843,
-34733,
-34674,
-34578,
-34535,
-34484,
-34418,
-34381,
-34286,
-34216,
-34121,
-34030,
-33957,
-33882,
-33839,
-33783,
+33517,
+33829,
+33549,
+33581,
+33561,
+33644,
+33583,
+33210,
+33304,
+33228,
+33405,
+33772,
 33723,
-33672,
-33582,
-33516,
-33404,
-33337,
-33245,
-33193,
-33128,
-33087,
-33028,
-32976,
-32897,
-32821,
-32726,
-32653,
-32593,
-32553,
-32519,
-32499,
-32480,
-32431,
-32414,
-32343,
-32336,
-32279,
-32277,
-32260,
-32258,
-32267,
-32260,
-32254,
-32229,
-32196,
-32157,
-32106,
-32093,
-32060,
-32063,
-32045,
-32045,
-31999,
-31977,
-31909,
-31889,
-31833,
-31827,
-31816,
-31817,
-31835,
-31825,
-31850,
-31825,
-31846,
-31817,
-31855,
-31854,
-31910,
+33459,
+33322,
+33224,
+32970,
+33202,
+33411,
+32852,
+33094,
+33344,
+33033,
+33031,
+32959,
+32781,
+32549,
+32472,
+32523,
+32350,
+32670,
+32704,
+32177,
+32459,
+32389,
+32160,
+32212,
+32058,
+32020,
+32296,
+32244,
+32168,
+32645,
+32427,
+32109,
+32356,
+32214,
+32068,
+32062,
 31954,
-32008,
-32056,
-32089,
-32101,
-32137,
-32138,
-32156,
-32190,
-32196,
-32238,
-32238,
-32256,
 32267,
-32254,
-32245,
-32231,
-32205,
-32225,
-32208,
-32244,
-32252,
-32284,
-32292,
-32307,
-32318,
-32309,
-32354,
-32357,
-32407,
-32449,
-32493,
-32533,
-32581,
+32457,
+32393,
+32301,
+32762,
+32973,
+32760,
+33087,
+32684,
+32600,
+32753,
+32757,
+33265,
+33020,
+33156,
+33293,
+32998,
+33509,
+33146,
+33305,
+33308,
+33213,
+34765,
+34824,
+34776,
+34418,
+33399,
+32968,
+32424,
+32924,
+33117,
+33136,
+33456,
+33720,
+34484,
+34272,
+33905,
+33506,
+33063,
+32709,
+32446,
+32094,
+32010,
+32214,
+32233,
+33056,
+33297,
+33194,
+32502,
+32037,
+32007,
+31500,
+31280,
+30981,
+30843,
+30900,
+31316,
+32044,
 32607,
-32643,
+32619,
+32488,
+32320,
+32240,
+31827,
+31470,
+31519,
+31249,
+31237,
+31421,
+31825,
+32285,
+32520,
+32536,
+32611,
 32683,
+32594,
+32361,
+32159,
+32435,
+32516,
+32723,
+33267,
+33471,
+33468,
+33264,
+33295,
+33398,
+33380,
+33522,
+33534,
+33770,
+33786,
+33978,
+34100,
+33694,
+33445,
+33190,
+33263,
+33436,
+33474,
+33485,
+33363,
+33464,
+33678,
+33463,
+33240,
+33237,
+33169,
+33072,
+32968,
+32923,
+32763,
+32588,
+32584,
+32489,
+32462,
+32582,
+32732,
+32987,
+33043,
+32941,
+32797,
+32701,
+32645,
+32598,
+32636,
 32690,
-32739,
-32753,
-32813,
-32825,
-32879,
-32874,
-32906,
-32880,
-32880,
-32878,
-32864,
-32886,
-32864,
-32896,
-32859,
-32881,
-32859,
-32852,
+32877,
+32861,
+32816,
 32839,
-32831,
+32812,
+32824,
+32859,
+32948,
+32928,
+33063,
+33038,
+33007,
+32980,
 32813,
-32807,
-32800,
-32780,
-32797,
-32768,
-32770,
-32740,
-32713,
-32703,
-32681,
-32664,
-32663,
-32635,
-32630,
-32616,
-32590,
-32575,
-32548,
-32508,
-32491,
-32443,
-32413,
-32383,
-32338,
-32307,
+32767,
+32724,
+32777,
+32795,
+32886,
+32987,
+33033,
+32972,
+32998,
+32987,
+32995,
+33100,
+33050,
+33002,
+32871,
+32673,
+32512,
+32369,
+32211,
+32214,
+32318,
+32474,
+32568,
+32578,
+32401,
+32142,
+32000,
+31717,
+31581,
+31465,
+31324,
+31476,
+31609,
+31802,
+32091,
+32204,
+32408,
+32482,
+32364,
 32262,
-32221,
-32158,
-32129,
-32054,
-32029,
-31970,
-31942,
+32068,
+31944,
+31930,
 31888,
-31837,
-31807,
-31710,
-31722,
-31607,
-31595,
-31514,
-31460,
-31400,
-31343,
-31285,
-31232,
-31172,
-31117,
-31065,
-31001,
-30953,
-30898,
-30862,
-30816,
-30773,
-30730,
-30690,
-30640,
-30615,
-30549,
-30528,
-30475,
-30445,
-30393,
-30376,
-30327,
-30326,
-30270,
-30260,
-30224,
-30194,
-30171,
-30147,
-30099,
-30095,
-30051,
-30024,
-30002,
-29955,
-29955,
-29917,
-29909,
-29882,
-29873,
-29873,
-29879,
-29897,
-29910,
-29930,
-29961,
-29989,
-30017,
-30063,
-30082,
-30147,
-30157,
-30227,
-30237,
-30278,
-30310,
-30334,
-30367,
+31997,
+32320,
+32642,
+32961,
+33118,
+33161,
+33192,
+33209,
+33144,
+33054,
+32917,
+32890,
+32997,
+32966,
+33014,
+32967,
+33003,
+33133,
+33150,
+33200,
+33282,
+33374,
+33431,
+33483,
+33437,
+33423,
+33292,
+33070,
+32885,
+32678,
+32636,
+32666,
+32732,
+32887,
+33081,
+33228,
+33357,
+33399,
+33316,
+33266,
+33120,
+32925,
+32891,
+32862,
+32881,
+33036,
+33159,
+33281,
+33497,
+33601,
+33632,
+33757,
+33679,
+33665,
+33727,
+33633,
+33676,
+33682,
+33603,
+33610,
+33648,
+33614,
+33607,
+33576,
+33471,
+33378,
+33292,
+33027,
+32723,
+32379,
+31902,
+31589,
+31177,
+30900,
+30800,
+30732,
+30826,
+30790,
+30656,
 30394,
-30409,
-30441,
-30447,
-30467,
-30476,
-30500,
-30508,
-30504,
-30529,
-30491,
-30538,
-30498,
-30524,
-30503,
-30524,
-30529,
-30545,
-30573,
-30589,
-30633,
-30641,
-30690,
-30721,
-30765,
-30810,
-30860,
-30888,
-30934,
-30964,
-30993,
-31026,
-31050,
-31068,
-31084,
-31101,
-31114,
-31150,
-31165,
-31190,
-31219,
-31224,
-31261,
-31272,
-31301,
-31324,
-31361,
-31367,
-31408,
-31423,
-31434,
-31473,
-31471,
-31496,
-31514,
-31517,
-31551,
-31560,
-31607,
-31619,
-31663,
-31681,
-31708,
-31736,
-31758,
-31787,
-31822,
-31850,
-31893,
-31924,
-31982,
-31994,
-32054,
-32060,
-32107,
-32138,
-32176,
-32215,
-32261,
-32318,
-32339,
-32405,
-32418,
-32463,
-32473,
-32519,
-32530,
-32587,
-32610,
-32651,
-32698,
-32713,
-32767,
-32791,
-32828,
-32876,
+29979,
+29514,
+28952,
+28497,
+28185,
+27956,
+27858,
+27763,
+27866,
+28132,
+28619,
+29374,
+30265,
+31372,
+32435,
+33257,
+33764,
+33950,
+33836,
+33714,
+33588,
+33755,
+34390,
+35249,
+36460,
+37580,
+38589,
+39318,
+39627,
+39618,
+39248,
+38772,
+38160,
+37570,
+37064,
+36579,
+36182,
+35804,
+35458,
+35254,
+34989,
+34706,
+34361,
+33805,
+33227,
+32321,
+31311,
+30334,
+29396,
+28877,
+28539,
+28677,
+29212,
+29902,
+30759,
+31410,
+32051,
+32597,
+32927,
+33195,
+33323,
+33422,
+33708,
+33933,
+34216,
+34736,
+35223,
+35892,
+36529,
+37001,
+37427,
+37534,
+37273,
+36761,
+36004,
+35217,
+34539,
+33846,
+33399,
+33106,
 32904,
+32765,
+32476,
+32169,
+31750,
+31217,
+30598,
+29899,
+29227,
+28563,
+27914,
+27292,
+26809,
+26571,
+26550,
+26762,
+27177,
+27582,
+27914,
+28014,
+27772,
+27403,
+26846,
+26255,
+25823,
+25505,
+25387,
+25331,
+25234,
+25290,
+25715,
+26623,
+28105,
+30007,
+32127,
+34103,
+35531,
+36097,
+35709,
+34902,
+33911,
+33417,
+33780,
+34978,
+37240,
+39877,
+42395,
+44325,
+45208,
+45031,
+44112,
+42615,
+40914,
+39419,
+38054,
+37160,
+36540,
+36133,
+35985,
+35922,
+35962,
+35856,
+35402,
+34446,
 32983,
-33038,
-33115,
-33197,
-33269,
-33357,
-33421,
-33499,
-33563,
-33631,
-33708,
-33785,
-33848,
-33914,
-33965,
-34014,
-34037,
-34076,
-34076,
-34126,
+30992,
+28754,
+26549,
+24786,
+23900,
+23885,
+24726,
+26075,
+27579,
+28975,
+29958,
+30387,
+30491,
+30446,
+30441,
+30764,
+31296,
+32132,
+33198,
+34320,
+35474,
+36549,
+37557,
+38412,
+39137,
+39610,
+39780,
+39692,
+39241,
+38690,
+38146,
+37705,
+37450,
+37315,
+37212,
+37021,
+36696,
+35982,
+35094,
+34180,
+33283,
+32693,
+32244,
+31966,
+31864,
+31713,
+31460,
+31140,
+30790,
+30595,
+30646,
+30776,
+31050,
+31331,
+31485,
+31536,
+31339,
+31038,
+30775,
+30551,
+30368,
+30177,
+29893,
+29497,
+29060,
+28578,
+28223,
+28103,
+28117,
+28285,
+28426,
+28414,
+28211,
+27728,
+27010,
+26171,
+25342,
+24531,
+23937,
+23673,
+24013,
+25217,
+27134,
+29677,
+32356,
+34785,
+36458,
+37049,
+36623,
+35389,
 34121,
-34201,
-34192,
-34284,
-34275,
-34347,
-34347,
-34389,
-34411,
-34447,
-34499,
-34560,
-34612,
-34687,
-34735,
-34787,
-34839,
-34864,
-34931,
-34965,
-35019,
-35080,
-35124,
-35194,
-35222,
-35274,
-35279,
-35309,
-35299,
-35324,
-35330,
-35351,
-35386,
-35392,
-35423,
-35419,
-35436,
-35417,
-35421,
-35438,
-35438,
-35478,
-35491,
-35513,
-35553,
-35555,
-35560,
-35570,
-35547,
-35564,
-35563,
-35577,
-35595,
-35601,
-35608,
-35587,
-35588,
-35543,
-35529,
-35495,
-35470,
-35457,
-35435,
-35427,
-35377,
-35358,
-35283,
-35255,
-35161,
-35146,
-35062,
-35056,
-34997,
-34979,
-34913,
+33256,
+33327,
+34525,
+36643,
+39318,
+41878,
+43786,
+44523,
+44125,
+42733,
+40834,
+38908,
+37149,
+35864,
+35138,
 34882,
-34786,
-34752,
-34662,
-34625,
-34558,
-34526,
-34475,
-34448,
-34392,
-34340,
-34283,
-34214,
-34161,
-34095,
-34052,
-34004,
-33971,
-33922,
-33880,
-33810,
-33763,
-33681,
-33624,
-33577,
-33517,
-33490,
-33457,
-33420,
-33394,
-33360,
-33306,
-33283,
-33220,
-33232,
-33170,
-33205,
-33161,
-33181,
-33139,
-33129,
-33098,
-33065,
-33047,
-33022,
-33009,
-32990,
-32991,
-32968,
-32954,
-32923,
-32899,
-32867,
-32856,
-32827,
-32847,
-32832,
-32864,
-32859,
-32879,
-32871,
-32878,
-32888,
-32899,
-32920,
-32958,
-32980,
-33024,
-33053,
-33073,
-33104,
-33109,
-33125,
-33137,
-33170,
-33181,
-33219,
-33240,
-33248,
-33283,
-33252,
-33283,
-33257,
-33296,
-33301,
-33330,
-33362,
-33382,
-33418,
-33432,
-33466,
-33487,
-33503,
-33544,
-33580,
-33617,
-33676,
-33702,
-33742,
-33782,
-33792,
-33829,
-33863,
-33886,
-33953,
-33980,
-34029,
-34079,
-34097,
-34146,
-34161,
-34197,
-34232,
-34271,
-34303,
-34362,
-34400,
-34448,
-34479,
-34507,
-34531,
-34548,
-34573,
-34580,
-34615,
-34618,
-34647,
-34644,
-34643,
-34628,
-34613,
-34591,
-34588,
-34573,
-34559,
-34566,
-34538,
-34536,
-34518,
-34484,
-34475,
-34448,
-34429,
+34904,
+35069,
+35120,
+35079,
+34788,
+34009,
+32756,
+31057,
+29162,
+27323,
+25814,
+24813,
+24639,
+25248,
+26402,
+27832,
+29115,
+30169,
+30878,
+31270,
+31499,
+31819,
+32418,
+33308,
 34433,
-34403,
-34418,
-34392,
-34398,
-34352,
-34361,
-34298,
-34301,
-34254,
-34248,
-34212,
-34197,
-34148,
-34115,
-34060,
-34014,
-33949,
-33911,
-33829,
-33815,
-33720,
-33704,
-33616,
-33566,
+35608,
+36745,
+37708,
+38443,
+38966,
+39262,
+39413,
+39356,
+39067,
+38581,
+37823,
+36945,
+36082,
+35352,
+34894,
+34664,
+34519,
+34314,
+33952,
+33241,
+32325,
+31269,
+30263,
+29681,
+29476,
+29747,
+30315,
+30976,
+31662,
+32209,
+32511,
+32599,
+32666,
+32760,
+33016,
+33274,
 33498,
-33416,
-33358,
-33277,
-33219,
-33160,
-33088,
-33040,
-32944,
-32914,
-32809,
-32759,
-32672,
-32611,
-32540,
-32476,
-32387,
-32318,
-32231,
-32126,
-32056,
-31928,
-31862,
-31740,
-31670,
+33756,
+33933,
+34066,
+34073,
+34063,
+34053,
+33927,
+33484,
+32617,
+31402,
+29910,
+28338,
+26896,
+25944,
+25642,
+25871,
+26407,
+26901,
+27184,
+27076,
+26423,
+25363,
+24105,
+22899,
+22004,
+21524,
+21643,
+22819,
+25122,
+28369,
+32280,
+36010,
+39083,
+41013,
+41313,
+40211,
+38381,
+36745,
+36012,
+36751,
+38905,
+42055,
+45493,
+48108,
+49128,
+48331,
+45994,
+42579,
+38977,
+35883,
+33676,
+32549,
+32279,
+32498,
+32871,
+33152,
+32961,
+32325,
+31185,
+29439,
+27355,
+25190,
+23379,
+22357,
+22401,
+23517,
+25554,
+27996,
+30205,
+31728,
+32233,
+31894,
+31162,
+30607,
+30714,
+31748,
+33658,
+36020,
+38311,
+40029,
+40900,
+40883,
+40174,
+39033,
+37741,
+36539,
+35453,
+34530,
+33786,
+33214,
+32893,
+32791,
+32754,
+32630,
+32217,
+31392,
+30239,
+28852,
+27583,
+26967,
+27146,
+28142,
+29800,
+31675,
+33467,
+34754,
+35231,
+35161,
+34833,
+34429,
+34258,
+34474,
+35114,
+36120,
+37147,
+37975,
+38564,
+38786,
+38545,
+37815,
+36656,
+35225,
+33696,
+32220,
+30996,
+30162,
+29680,
+29399,
+29012,
+28337,
+27363,
+26043,
+24587,
+23424,
+22790,
+22887,
+23641,
+24597,
+25616,
+26482,
+26837,
+26794,
+26376,
+25726,
+25388,
+25296,
+25522,
+26715,
+28977,
+32211,
+36160,
+39786,
+42377,
+43782,
+43357,
+41119,
+38256,
+35625,
+34024,
+34317,
+36220,
+39158,
+42634,
+45117,
+45615,
+44483,
+41708,
+37649,
+33654,
+30460,
+28430,
+27951,
+28550,
+29750,
 31550,
-31493,
-31348,
-31298,
-31162,
-31088,
-30978,
-30900,
-30803,
-30736,
-30637,
-30586,
-30485,
-30424,
-30349,
-30270,
-30205,
-30150,
-30082,
-30037,
-29974,
-29924,
-29872,
-29809,
-29768,
-29700,
-29671,
-29593,
-29586,
-29504,
-29503,
-29425,
-29419,
-29346,
-29342,
-29288,
-29268,
-29248,
-29219,
-29198,
-29180,
-29153,
-29125,
-29110,
-29083,
-29074,
-29049,
-29042,
-29028,
-29037,
-29020,
-29034,
-29014,
-29041,
-29038,
-29054,
-29079,
-29084,
-29135,
-29129,
-29191,
-29188,
-29248,
-29269,
-29300,
-29360,
-29366,
-29442,
-29457,
-29510,
-29546,
-29586,
-29612,
-29660,
-29681,
-29725,
-29758,
-29774,
-29822,
-29827,
-29875,
-29886,
-29923,
-29946,
-29999,
-30019,
-30087,
-30117,
-30174,
-30240,
-30291,
-30365,
-30431,
-30497,
-30574,
-30646,
-30716,
-30798,
-30862,
-30937,
-30999,
-31062,
-31132,
+33181,
+33909,
+33915,
+33036,
+31105,
+28714,
+26335,
+24500,
+24029,
+25035,
+27214,
+30253,
+33308,
+35532,
+36570,
+36214,
+34737,
+33042,
+31860,
+31559,
+32451,
+34400,
+36794,
+39050,
+40563,
+40955,
+40383,
+38995,
+37017,
+35018,
+33313,
+31983,
 31188,
-31262,
-31306,
-31375,
-31431,
+30873,
+30956,
 31489,
-31538,
-31604,
-31639,
-31717,
-31746,
-31816,
-31857,
-31898,
-31961,
-31988,
-32052,
-32085,
-32137,
-32180,
-32232,
-32253,
-32323,
-32326,
-32396,
-32413,
-32460,
-32501,
-32521,
-32560,
-32575,
-32600,
-32611,
-32641,
-32649,
-32669,
-32692,
-32711,
-32739,
-32757,
-32788,
-32808,
-32841,
-32863,
-32903,
-32939,
-32960,
-33032,
-33029,
-33107,
-33108,
-33162,
-33180,
-33211,
-33237,
-33262,
-33281,
-33321,
-33324,
-33362,
-33352,
-33388,
-33356,
-33386,
-33369,
-33388,
-33374,
-33397,
-33376,
-33398,
-33379,
-33383,
-33384,
-33369,
-33379,
-33367,
-33395,
-33391,
-33432,
-33434,
-33467,
-33472,
-33497,
-33517,
-33536,
-33568,
-33589,
-33626,
-33645,
-33664,
-33689,
-33690,
-33720,
-33707,
-33741,
-33710,
-33759,
-33721,
-33764,
-33760,
-33761,
-33797,
-33767,
-33802,
-33778,
-33807,
-33802,
-33816,
-33802,
-33820,
-33796,
-33829,
-33788,
-33831,
-33787,
-33816,
-33806,
+32178,
+32716,
+32981,
+32733,
+32008,
+30999,
+29782,
+28877,
+28877,
+29831,
+31628,
+33928,
+36213,
+38122,
+39156,
+39039,
+38183,
+37094,
+36092,
+35489,
+35473,
+36067,
+37036,
+37923,
+38378,
+38285,
+37643,
+36447,
+34755,
+32725,
+30561,
+28526,
+26914,
+25890,
+25495,
+25716,
+26253,
+26588,
+26426,
+25666,
+24394,
+22970,
+21783,
+21228,
+21669,
+22913,
+24488,
+26162,
+27639,
+28708,
+29323,
+29323,
+28924,
+28565,
+28173,
+28010,
+28763,
+30770,
+34190,
+38446,
+42121,
+44481,
+45251,
+43873,
+40658,
+36868,
+33676,
+32163,
+32731,
+34857,
+38043,
+41372,
+43231,
+43099,
+41458,
+38438,
+34576,
+31016,
+28481,
+27334,
+27546,
+28615,
+30433,
+32777,
+34623,
+35393,
+35195,
 33796,
-33827,
-33802,
-33829,
-33818,
-33839,
-33820,
-33842,
-33817,
-33834,
-33833,
-33822,
-33833,
-33806,
-33819,
-33798,
-33802,
-33788,
-33787,
-33768,
-33767,
-33754,
-33735,
-33740,
-33719,
-33711,
-33711,
-33686,
+31336,
+28600,
+26307,
+25157,
+25639,
+27549,
+30352,
+33321,
+35558,
+36626,
+36508,
+35277,
+33479,
+32110,
+31581,
+31920,
+33164,
+35061,
+37101,
+38716,
+39395,
+39068,
+37967,
+36087,
+33753,
+31659,
+30160,
+29348,
+29345,
+30025,
+31114,
+32283,
+33073,
+33283,
+32934,
+32090,
+31144,
+30514,
+30266,
+30609,
+31826,
+33770,
+35998,
+38052,
+39602,
+40550,
+40700,
+39942,
+38793,
+37848,
+37264,
+37074,
+37308,
+37873,
+38481,
+38694,
+38260,
+37209,
+35651,
+33657,
+31374,
+29094,
+27116,
+25670,
+24879,
+24670,
+24871,
+25345,
+25740,
+25658,
+24998,
+23917,
+22768,
+21996,
+21764,
+22229,
+23568,
+25448,
+27331,
+28947,
+30069,
+30697,
+30897,
+30605,
+30064,
+29717,
+29510,
+29526,
+30331,
+32348,
+35802,
+40007,
+43302,
+44716,
+44319,
+42019,
+38220,
+34097,
+31037,
+30077,
+31262,
 33695,
-33687,
-33686,
-33701,
-33704,
-33723,
-33736,
-33758,
-33789,
-33802,
-33852,
-33864,
-33920,
-33942,
-33999,
-34041,
-34082,
-34144,
-34162,
-34225,
-34230,
-34279,
-34297,
-34324,
-34360,
-34372,
-34411,
-34423,
-34448,
-34473,
-34476,
-34511,
-34519,
-34563,
-34574,
-34633,
-34647,
-34713,
+36914,
+40141,
+41889,
+41590,
+39806,
+36842,
+33115,
+29597,
+27161,
+26363,
+27059,
+28760,
+31353,
+34355,
+36451,
+37079,
+36406,
+34430,
+31396,
+28238,
+25874,
+25077,
+26021,
+28287,
+31326,
+34327,
+36346,
+37147,
+36850,
+35509,
+33724,
+32348,
+31830,
+32225,
+33462,
+35345,
+37528,
+39270,
+39939,
+39521,
+38247,
+36254,
+33896,
+31828,
+30539,
+30111,
+30443,
+31374,
+32565,
+33593,
+34112,
+33958,
+33248,
+32215,
+31240,
+30814,
+31084,
+31938,
+33399,
+35281,
+37086,
+38373,
+38936,
+38841,
+38253,
+37204,
+36028,
+35269,
+35087,
+35269,
+35627,
+35980,
+36147,
+35858,
+34921,
+33474,
+31862,
+30271,
+28744,
+27383,
+26381,
+25906,
+25917,
+26268,
+26770,
+27331,
+27711,
+27660,
+27052,
+26091,
+25215,
+24827,
+25087,
+25953,
+27366,
+29066,
+30619,
+31643,
+32133,
+32141,
+31748,
+31031,
+30253,
+29567,
+29048,
+28595,
+28668,
+29895,
+32619,
+36429,
+39957,
+41819,
+41676,
+39852,
+36665,
+33076,
+30357,
+29619,
+30933,
+33510,
+36510,
+39560,
+41610,
+41946,
+40728,
+38447,
+35278,
+31924,
+29324,
+28158,
+28580,
+30196,
+32665,
+35411,
+37279,
+37381,
+35978,
+33493,
+30308,
+27101,
+24839,
+24057,
+24980,
+27127,
+29883,
+32563,
+34545,
+35412,
+35231,
+34178,
+32613,
+31399,
+31089,
+31814,
+33481,
+35921,
+38575,
+40757,
+41725,
+41239,
+39666,
+37422,
+34893,
+32730,
+31457,
+31152,
+31684,
+32750,
+33969,
+35012,
+35483,
+35129,
+34117,
+32776,
+31479,
+30698,
+30757,
+31656,
+33190,
+35054,
+36799,
+37974,
+38381,
+38007,
+37013,
+35686,
+34298,
+33241,
+32858,
+33051,
+33502,
+34088,
+34591,
+34711,
+34201,
+32991,
+31360,
+29828,
+28538,
+27467,
+26823,
+26745,
+27164,
+27785,
+28333,
+28815,
+29274,
+29382,
+28867,
+27906,
+26863,
+26200,
+26145,
+26821,
+28186,
+29893,
+31506,
+32559,
+32894,
+32714,
+32072,
+30989,
+29840,
+28940,
+28396,
+28191,
+27909,
+27759,
+28721,
+31123,
+34459,
+37352,
+38552,
+38121,
+36653,
+34183,
+31536,
+30091,
+30420,
+32028,
+34233,
+36577,
+38982,
+40598,
+40722,
+39731,
+38093,
+35614,
+32702,
+30621,
+29961,
+30675,
+32364,
+34551,
+36714,
+37916,
+37498,
+35893,
+33647,
+31107,
+28845,
+27540,
+27182,
+28015,
+29879,
+32242,
+34394,
+35850,
+36558,
+36491,
+35571,
+34005,
+32852,
+32583,
+33091,
+34200,
+35851,
+37734,
+39151,
+39490,
+38625,
+36900,
+34722,
+32483,
+30600,
+29421,
+29094,
+29527,
+30465,
+31420,
+32124,
+32483,
+32341,
+31774,
+31174,
+30908,
+31149,
+31942,
+33206,
+34741,
+36323,
+37739,
+38779,
+39315,
+39138,
+38183,
+36784,
+35333,
+34173,
+33729,
+34075,
 34724,
-34790,
-34789,
-34847,
+35247,
+35361,
+34898,
+33771,
+32071,
+30194,
+28764,
+27915,
+27398,
+27171,
+27362,
+27946,
+28709,
+29426,
+29991,
+30341,
+30327,
+29746,
+28795,
+27956,
+27776,
+28349,
+29424,
+30720,
+31921,
+32937,
+33466,
+33324,
+32753,
+31904,
+30535,
+29010,
+27814,
+27027,
+26571,
+26113,
+25668,
+26079,
+27728,
+30517,
+33674,
+35648,
+35864,
+35234,
+34168,
+32797,
+31780,
+31853,
+33112,
 34871,
-34912,
-34968,
-35003,
-35052,
-35101,
-35129,
-35166,
-35203,
-35228,
-35256,
-35290,
-35321,
-35349,
-35392,
-35412,
-35454,
-35473,
-35501,
-35517,
-35552,
-35568,
-35622,
-35639,
-35684,
-35709,
-35726,
-35757,
-35738,
-35782,
-35757,
-35797,
-35789,
-35804,
-35804,
-35815,
-35794,
+36521,
+38527,
+40808,
+42099,
+41983,
+40964,
+39168,
+36503,
+33939,
+32639,
+32846,
+33883,
+35018,
+36039,
+36582,
+35983,
+34507,
+32830,
+30983,
+28846,
+27030,
+25865,
+25611,
+26488,
+28409,
+30908,
+33096,
+34422,
+34929,
+34751,
+33840,
+32910,
+32642,
+33045,
+33833,
+34954,
+36470,
+37984,
+38811,
+38693,
+37868,
+36444,
+34539,
+32539,
+30900,
+29946,
+29670,
+29918,
+30434,
+30980,
+31448,
+31779,
+31846,
+31609,
+31315,
+31190,
+31211,
+31558,
+32398,
+33554,
+34868,
+36163,
+37052,
+37314,
+36883,
+35988,
+35176,
+34677,
+34385,
+34593,
+35225,
+35799,
+36146,
+36207,
 35787,
-35764,
-35737,
-35715,
-35695,
-35671,
-35664,
-35647,
-35619,
-35597,
-35553,
-35521,
-35470,
-35450,
-35404,
-35373,
-35346,
-35308,
-35283,
-35229,
-35198,
-35121,
-35090,
-35016,
-34976,
-34916,
-34860,
-34824,
-34747,
-34709,
-34610,
-34550,
-34464,
-34388,
-34322,
-34245,
-34177,
-34105,
-34031,
-33967,
-33892,
-33814,
-33737,
-33667,
-33580,
-33520,
-33439,
-33382,
-33314,
-33233,
-33178,
-33092,
-33030,
-32971,
-32902,
-32855,
-32796,
-32744,
-32687,
-32643,
-32576,
-32535,
-32467,
-32428,
-32360,
-32324,
-32263,
-32231,
-32176,
-32142,
-32076,
-32038,
-31974,
-31942,
-31881,
-31857,
-31818,
-31783,
-31751,
+34919,
+33671,
+32174,
+30837,
+29872,
+29335,
+29398,
+30038,
+30893,
 31711,
-31675,
-31638,
-31615,
-31571,
-31557,
-31517,
-31500,
-31474,
-31444,
-31418,
-31379,
-31346,
-31300,
-31260,
-31213,
-31192,
-31148,
-31129,
-31096,
-31049,
-31045,
-30986,
-30988,
-30944,
-30944,
-30922,
-30928,
-30919,
-30912,
-30924,
-30918,
-30909,
-30927,
-30892,
-30916,
-30916,
-30915,
-30947,
-30918,
-30940,
-30923,
-30905,
-30891,
-30865,
-30856,
-30829,
-30817,
-30796,
-30780,
-30770,
-30742,
-30739,
-30708,
-30691,
-30701,
-30680,
-30717,
-30718,
-30743,
-30780,
-30782,
-30830,
-30823,
-30874,
-30877,
-30915,
-30931,
-30963,
-30986,
-31015,
+32213,
+32154,
+31596,
+30698,
+29572,
+28573,
+28001,
+27941,
+28410,
+29352,
+30420,
+31365,
+31900,
+31706,
+30993,
+30171,
+29143,
+27875,
+26813,
+26126,
+25838,
+25825,
+25755,
+25754,
+26439,
+28049,
+30871,
+34254,
+36480,
+37028,
+36919,
+36463,
+35617,
+34998,
+35171,
+35925,
+36674,
+37327,
+38613,
+40564,
+41937,
+42366,
+42262,
+40900,
+37850,
+34653,
+32607,
+31750,
+31535,
+31619,
+32032,
+32489,
+32315,
+31814,
+31385,
+30370,
+28512,
+26541,
+24879,
+23981,
+24667,
+27025,
+30120,
+32897,
+34899,
+36218,
+36764,
+36327,
+35641,
+35411,
+35200,
+34814,
+35016,
+36034,
+37351,
+38407,
+38884,
+38671,
+37595,
+35556,
+33103,
+30842,
+29030,
+28074,
+28057,
+28474,
+29102,
+30101,
+31159,
+31704,
+31560,
+31021,
+30478,
+30100,
+30011,
+30800,
+32736,
+34974,
+36692,
+37892,
+38624,
+38840,
+38693,
+38327,
+37916,
+37497,
+37009,
+36742,
+37012,
+37473,
+37772,
+37717,
+37005,
+35607,
+33932,
+32268,
+30835,
+29885,
+29494,
+29471,
+29626,
+29836,
+30049,
+30150,
+30014,
+29628,
+29156,
+28639,
+28066,
+27634,
+27608,
+28076,
+28904,
+29707,
+30147,
+30325,
+30333,
+30145,
+30007,
+30009,
+29799,
+29427,
+29132,
+28917,
+28736,
+28370,
+27679,
+27309,
+27751,
+29533,
+32891,
+36166,
+37630,
+37937,
+37928,
+37304,
+36107,
+34928,
+34192,
+33621,
+32948,
+33320,
+35583,
+38141,
+39649,
+40583,
+40524,
+38189,
+34535,
+31688,
+30218,
+29209,
+28211,
+27988,
+28917,
+29935,
+30710,
+31774,
+32282,
+31106,
+28926,
+26951,
+25788,
+26080,
+28092,
+31051,
+33687,
+35525,
+37033,
+38249,
+38381,
+37629,
+36969,
+36228,
+34883,
+33872,
+34302,
+35792,
+37156,
+37796,
+37800,
+36983,
+34998,
+32394,
+30049,
+28218,
+27016,
+26678,
+26958,
+27536,
+28559,
+30202,
+31849,
+32739,
+32876,
+32824,
+32754,
+32531,
+32582,
+33645,
+35439,
+37015,
+38262,
+39604,
+40973,
+41893,
+42111,
+41730,
+40991,
+39909,
+38696,
+37733,
+36981,
+36202,
+35445,
+34670,
+33709,
+32786,
+32063,
+31284,
+30181,
+28890,
+27735,
+27008,
+26670,
+26676,
+27185,
+28037,
+28834,
+29334,
+29620,
+29634,
+29334,
+28779,
+28351,
+28269,
+28694,
+29340,
+30100,
 31029,
-31054,
-31049,
-31066,
-31069,
-31075,
-31097,
-31094,
-31125,
-31134,
-31148,
-31171,
-31177,
-31201,
-31202,
-31246,
-31252,
-31286,
-31320,
-31346,
-31385,
-31425,
-31448,
-31493,
-31520,
-31554,
-31590,
-31634,
-31657,
-31702,
-31719,
-31748,
-31769,
-31775,
-31801,
-31792,
-31811,
-31809,
-31804,
-31818,
-31803,
-31811,
-31802,
-31819,
-31813,
-31836,
-31820,
-31847,
-31840,
-31857,
-31842,
-31840,
-31851,
-31808,
-31856,
-31796,
-31831,
-31811,
-31797,
-31809,
-31771,
-31780,
-31737,
-31741,
-31703,
-31687,
-31669,
-31636,
-31615,
-31579,
-31545,
-31499,
-31464,
-31418,
-31402,
-31361,
-31355,
-31321,
+31790,
+32200,
+32583,
+32633,
+31941,
+30992,
+29951,
+29112,
+28509,
+27635,
+26642,
+26605,
+27596,
+30100,
+33733,
+36244,
+36571,
+35992,
+35007,
+33808,
+32738,
+31734,
+31188,
+31181,
+31487,
+33176,
+36688,
+39910,
+41835,
+42662,
+41725,
+38743,
+35323,
+32738,
+31329,
+30415,
+29549,
+29358,
+30226,
+31312,
+32482,
+33785,
+33932,
+32265,
+29801,
+27581,
+26170,
+26204,
+27589,
+29619,
+31398,
+32791,
+34456,
+36368,
+37533,
+37782,
+37527,
+36570,
+35010,
+33945,
+34288,
+35529,
+36556,
+36866,
+36677,
+36055,
+35094,
+34051,
+32996,
+31675,
+30181,
+28934,
+28151,
+27927,
+28550,
+29976,
+31360,
+31873,
+31654,
+31501,
+31629,
+31825,
+32231,
+33190,
+34615,
+36078,
+37310,
+38671,
+40320,
+41777,
+42482,
+42283,
+41325,
+40113,
+38908,
+37751,
+36784,
+36116,
+35638,
+35156,
+34441,
+33566,
+32769,
+31812,
+30426,
+28832,
+27593,
+27000,
+26996,
+27282,
+27857,
+28753,
+29725,
+30363,
+30641,
+30689,
+30472,
+29887,
+29026,
+28279,
+28251,
+29144,
+30255,
 31318,
-31278,
-31270,
+32310,
+33060,
+33468,
+33333,
+32345,
+31207,
+30160,
+28995,
+28127,
+27424,
+26325,
+25275,
+24863,
+25681,
+28214,
+30811,
+31885,
+32029,
+31991,
+31846,
+31904,
+31833,
+31588,
+31639,
+32017,
+33290,
+36313,
+39950,
+42703,
+44433,
+44834,
+43414,
+41003,
+38650,
+36728,
+35078,
+33140,
+31179,
+30383,
+30696,
+31553,
+32934,
+33811,
+33065,
+31065,
+28468,
+25929,
+24353,
+24006,
+24681,
+25989,
+27523,
+29577,
+32394,
+35081,
+36826,
+37548,
+37178,
+35811,
+34310,
+33548,
+33657,
+34169,
+34700,
+35239,
+35882,
+36423,
+36610,
+36293,
+35217,
+33373,
 31227,
-31209,
-31165,
-31143,
-31119,
-31090,
-31091,
-31076,
-31066,
-31070,
-31039,
-31029,
-31000,
-30958,
-30938,
-30883,
-30866,
-30834,
-30810,
-30793,
-30757,
-30751,
-30710,
-30706,
-30667,
-30660,
-30647,
-30650,
-30646,
-30669,
-30659,
-30674,
-30670,
-30660,
-30660,
+29256,
+27790,
+27247,
+27613,
+28449,
+29409,
+30438,
+31567,
+32699,
+33558,
+34202,
+34743,
+35068,
+35391,
+36201,
+37645,
+39354,
+40902,
+42138,
+42995,
+43318,
+43195,
+42778,
+42003,
+40695,
+38896,
+36987,
+35242,
+33697,
+32440,
+31483,
+30582,
+29516,
+28368,
+27394,
+26677,
+26145,
+25748,
+25503,
+25571,
+26003,
+26736,
+27719,
+28699,
+29449,
+30107,
 30644,
-30651,
-30668,
-30691,
-30755,
-30799,
-30878,
-30937,
 30995,
-31029,
-31056,
-31060,
-31055,
-31050,
-31052,
-31055,
-31073,
-31081,
-31112,
-31113,
-31165,
-31149,
-31212,
-31187,
-31246,
-31260,
-31308,
-31356,
-31398,
-31442,
-31472,
-31482,
-31508,
-31490,
-31526,
-31527,
-31573,
-31617,
-31700,
-31776,
-31872,
-31960,
-32019,
-32079,
-32097,
-32114,
-32137,
-32135,
-32183,
-32211,
+31299,
+31585,
+31991,
+32664,
+33542,
+34622,
+35750,
+36498,
+36824,
+36834,
+36361,
+35073,
+33105,
+30936,
+28632,
+26156,
+23811,
+21775,
+20229,
+19589,
+20331,
+22752,
+25397,
+26641,
+27209,
+28085,
+28804,
+29139,
+29521,
+30379,
+31643,
+33103,
+35648,
+39750,
+43862,
+46501,
+47995,
+48529,
+47353,
+44911,
+42673,
+41027,
+39216,
+36941,
+34931,
+33945,
+33539,
+33363,
+33527,
+33084,
+31298,
+28873,
+26630,
+24708,
+23333,
+22858,
+23063,
+23369,
+23892,
+25403,
+27793,
+29957,
+31324,
 32266,
-32352,
-32392,
-32481,
-32522,
-32589,
-32645,
-32700,
-32784,
-32862,
-32969,
-33083,
-33165,
+32789,
+32789,
+33029,
+34153,
+35758,
+37032,
+37805,
+38504,
+39377,
+40294,
+41099,
+41375,
+40728,
+39390,
+37939,
+36619,
+35390,
+34391,
+33686,
+33002,
+32216,
+31827,
+32183,
+32838,
+33213,
 33280,
-33325,
-33380,
-33403,
-33434,
-33447,
-33507,
-33556,
-33633,
-33714,
-33799,
-33872,
-33936,
-33981,
-34028,
-34059,
-34100,
-34141,
-34203,
-34268,
-34354,
-34405,
-34472,
-34502,
-34563,
-34612,
-34679,
-34747,
-34833,
-34912,
-35005,
-35084,
-35157,
-35224,
-35269,
-35317,
-35353,
-35378,
-35414,
-35441,
-35465,
-35502,
-35502,
-35528,
-35523,
-35561,
-35578,
-35615,
-35655,
-35668,
-35705,
-35699,
-35721,
-35703,
-35717,
-35695,
-35713,
-35699,
-35725,
-35725,
-35767,
-35770,
-35800,
-35800,
-35816,
-35830,
-35856,
-35896,
-35911,
-35960,
-35949,
-36001,
-35966,
-35984,
-35955,
-35931,
-35917,
-35860,
-35841,
-35809,
+33136,
+32753,
+32236,
+31994,
+32434,
+33281,
+34015,
+34596,
+35175,
 35787,
-35761,
-35728,
-35699,
-35640,
-35599,
-35532,
-35484,
-35422,
-35372,
-35312,
-35272,
-35225,
-35208,
-35161,
-35150,
-35099,
-35078,
-35018,
-34999,
-34962,
-34945,
-34939,
-34919,
-34925,
-34890,
-34886,
-34832,
-34803,
-34737,
-34682,
-34613,
-34558,
-34525,
-34482,
-34470,
-34425,
+36472,
+37056,
+37273,
+36922,
+35953,
+34638,
+33379,
+32419,
+31787,
+31449,
+31250,
+31029,
+30867,
+30841,
+30816,
+30743,
+30541,
+30241,
+30090,
+30153,
+30495,
+31204,
+32035,
+32734,
+33318,
+33826,
+34364,
+34897,
+35143,
+34938,
 34411,
-34357,
-34342,
-34301,
-34271,
-34253,
-34223,
-34221,
-34196,
-34202,
-34165,
-34176,
-34121,
-34112,
-34059,
-34035,
-33989,
-33986,
+33825,
+33525,
+33648,
+33808,
+33650,
+33130,
+32278,
+31181,
+30005,
+28645,
+27057,
+25272,
+23183,
+21189,
+19921,
+19206,
+18634,
+18624,
+19908,
+22737,
+25976,
+28207,
+29778,
+31334,
+32236,
+32466,
+32955,
 33954,
-33948,
-33926,
-33906,
-33884,
-33874,
-33848,
-33833,
-33807,
-33794,
-33772,
-33768,
-33753,
-33732,
-33727,
-33700,
-33683,
-33680,
-33651,
-33647,
-33633,
-33611,
-33598,
-33572,
-33541,
+35078,
+36108,
+37700,
+40381,
+43185,
+45015,
+46172,
+46623,
+45353,
+42638,
+39925,
+37789,
+35880,
+34051,
+32566,
+31801,
+31583,
+31738,
+32372,
+32707,
+32012,
+30672,
+29102,
+27338,
+25826,
+25072,
+24883,
+24789,
+24965,
+26080,
+28170,
+30424,
+32214,
+33579,
+34376,
+34516,
+34628,
+35217,
+36082,
+36781,
+37126,
+37296,
+37599,
+38152,
+38837,
+39217,
+38966,
+38268,
+37489,
+36672,
+35758,
+34999,
+34493,
+34065,
+33640,
+33409,
 33524,
-33484,
-33471,
-33426,
-33417,
-33380,
+33761,
+33762,
+33542,
+33182,
+32706,
+32261,
+31916,
+31786,
+31923,
+32218,
+32573,
+32901,
+33148,
+33429,
+33749,
+33976,
+34021,
+33870,
+33576,
+33216,
+32955,
+32850,
+32923,
+33145,
+33357,
+33591,
+33910,
+34222,
+34498,
+34567,
+34281,
+33863,
+33560,
+33551,
+33822,
+34161,
+34452,
+34569,
+34519,
+34339,
+34003,
+33511,
+32540,
+31046,
+29506,
+28196,
+27549,
+27609,
+27715,
+27740,
+27594,
+27263,
+27224,
+27210,
+26771,
+25995,
+24957,
+24000,
+23537,
+23554,
+23671,
+23722,
+24132,
+25491,
+28020,
+30690,
+32366,
+33536,
+34512,
+34932,
+35183,
+35367,
+35338,
+35091,
+34600,
+34828,
+36285,
+37824,
+38878,
+39791,
+40186,
+39504,
+38106,
+36896,
+36070,
+35120,
+33766,
+32590,
+32280,
+32670,
+33486,
+34594,
+35283,
+35077,
+34395,
+33522,
+32567,
+31799,
+31251,
+30783,
+30367,
+30218,
+30811,
+32078,
+33270,
+34031,
+34388,
+34201,
+33577,
+33009,
+32763,
+32639,
+32418,
+32243,
+32401,
+32987,
+33795,
+34531,
+35015,
+35100,
+34878,
+34620,
+34393,
+34256,
+34318,
+34457,
+34575,
+34793,
+35178,
+35674,
+36074,
+36188,
+35981,
+35470,
+34753,
+34077,
+33588,
+33230,
+33003,
+32998,
+33134,
+33258,
+33442,
+33703,
+33828,
+33637,
+33233,
+32904,
+32766,
+32727,
+32791,
+33038,
 33370,
-33342,
-33336,
-33310,
-33302,
-33295,
-33289,
-33293,
-33304,
-33311,
-33320,
-33334,
-33325,
-33337,
-33313,
-33302,
-33273,
-33246,
-33213,
-33171,
-33140,
-33085,
-33048,
-32988,
-32934,
-32881,
-32824,
-32762,
-32728,
-32662,
-32645,
-32586,
-32558,
-32531,
-32494,
-32487,
-32453,
+33679,
+34038,
+34452,
+34824,
+35080,
+35140,
+35060,
+34939,
+34866,
+34969,
+35171,
+35305,
+35399,
+35486,
+35521,
+35425,
+35137,
+34597,
+33784,
+32727,
+31534,
+30432,
+29496,
+28689,
+28109,
+27761,
+27649,
+27954,
+28476,
+28882,
+29002,
+28617,
+27871,
+27071,
+26212,
+25475,
+25050,
+24807,
+24670,
+24671,
+24760,
+24875,
+25223,
+25932,
+27081,
+28497,
+29368,
+29575,
+29885,
+30272,
+30626,
+31153,
+31616,
+31966,
+32200,
+32514,
+33538,
+35036,
+36080,
+36786,
+37572,
+37963,
+37528,
+36816,
+36384,
+36124,
+35747,
+35259,
+35200,
+35764,
+36444,
+37191,
+38136,
+38688,
+38591,
+38116,
+37284,
+36135,
+34945,
+33865,
+33019,
 32442,
-32415,
-32407,
-32400,
-32398,
-32393,
-32391,
-32382,
-32374,
-32363,
-32350,
-32339,
-32306,
-32280,
-32243,
-32205,
-32167,
-32116,
-32089,
-32052,
-32020,
-31989,
-31956,
-31942,
-31918,
-31895,
-31884,
-31868,
-31868,
-31858,
-31866,
-31852,
-31861,
-31840,
-31840,
-31819,
-31806,
-31804,
-31777,
-31784,
-31768,
-31756,
-31758,
-31747,
-31747,
-31721,
-31699,
-31657,
-31644,
-31608,
-31586,
-31577,
-31544,
-31550,
-31516,
-31504,
-31484,
-31459,
-31446,
-31439,
-31424,
-31428,
+32236,
+32596,
+33112,
+33239,
+33068,
+32797,
+32289,
+31578,
+30980,
+30653,
+30425,
+30149,
+30076,
+30547,
 31419,
-31428,
-31438,
-31433,
-31433,
-31416,
-31395,
-31382,
-31352,
-31363,
-31328,
-31356,
-31322,
-31341,
-31310,
-31311,
-31278,
-31269,
-31206,
-31213,
-31145,
-31173,
-31119,
-31129,
-31079,
-31056,
-30995,
-30951,
-30885,
-30834,
-30783,
-30747,
-30730,
-30701,
-30702,
-30681,
-30671,
-30668,
-30640,
-30627,
-30614,
-30580,
-30571,
-30541,
-30515,
-30498,
-30439,
-30420,
-30341,
-30307,
-30232,
-30179,
-30136,
-30067,
-30031,
-29972,
-29920,
-29874,
-29817,
-29752,
-29698,
-29641,
-29576,
-29544,
-29494,
-29472,
-29454,
-29448,
-29473,
-29494,
-29550,
-29594,
-29643,
-29694,
-29717,
-29746,
-29764,
-29773,
-29782,
-29776,
-29768,
-29758,
-29740,
-29708,
-29691,
-29642,
-29602,
-29570,
-29532,
-29527,
-29515,
-29531,
-29549,
-29569,
-29578,
-29571,
-29591,
-29570,
-29598,
-29606,
-29679,
-29725,
-29836,
-29906,
-30015,
-30092,
-30187,
-30259,
-30333,
-30397,
-30460,
-30513,
-30586,
-30627,
-30668,
-30701,
-30707,
-30724,
-30726,
-30747,
-30757,
-30816,
-30850,
-30947,
-31029,
-31130,
-31248,
-31326,
-31426,
-31500,
-31587,
-31676,
-31745,
-31861,
-31929,
-32038,
-32127,
-32213,
-32313,
-32390,
-32462,
-32535,
-32601,
-32661,
-32742,
-32788,
-32855,
-32898,
-32941,
-32959,
-33010,
-33001,
-33064,
-33087,
-33163,
-33234,
-33342,
-33440,
-33573,
-33678,
-33815,
-33928,
-34024,
-34143,
-34206,
-34310,
-34378,
-34443,
-34501,
-34529,
-34565,
-34592,
-34607,
-34630,
-34633,
-34671,
-34658,
+32315,
+33011,
+33418,
+33546,
+33538,
+33581,
+33635,
+33665,
+33741,
+33907,
+34182,
+34531,
+35015,
+35523,
+35705,
+35526,
+35217,
+34950,
+34798,
+34688,
+34594,
+34603,
+34634,
+34674,
+34743,
+34742,
 34702,
-34690,
-34727,
-34703,
-34718,
-34690,
-34697,
-34679,
-34689,
-34697,
-34703,
-34730,
-34754,
-34799,
-34853,
-34915,
-34974,
-35036,
-35090,
-35133,
-35193,
-35215,
-35261,
-35281,
-35285,
-35284,
-35266,
-35241,
-35224,
-35191,
-35174,
-35149,
-35147,
-35133,
-35147,
-35138,
-35133,
-35133,
-35105,
-35101,
-35085,
-35091,
-35104,
-35103,
-35131,
-35119,
-35143,
-35140,
-35148,
-35179,
-35182,
+34382,
+33784,
+33423,
+33380,
+33640,
+34094,
+34419,
+34646,
+34857,
+35040,
+35177,
 35226,
-35250,
-35276,
-35317,
-35309,
-35353,
-35301,
-35298,
-35248,
-35205,
-35169,
 35118,
-35094,
-35047,
-35033,
-34986,
-34982,
-34960,
-34963,
-34955,
-34967,
-34991,
-35010,
-35049,
-35066,
-35091,
-35104,
-35114,
-35114,
-35139,
-35135,
-35159,
-35159,
-35177,
-35179,
-35188,
-35195,
-35185,
-35192,
-35161,
-35135,
-35095,
-35051,
-35001,
-34958,
-34882,
-34859,
-34767,
-34755,
-34706,
-34708,
-34710,
-34726,
-34751,
-34786,
-34829,
-34862,
-34917,
-34926,
-34964,
-34963,
-34952,
-34958,
-34930,
-34927,
-34894,
-34883,
-34820,
-34809,
-34745,
-34741,
-34716,
-34691,
-34673,
-34634,
-34587,
-34550,
-34507,
-34472,
-34450,
-34417,
-34389,
-34371,
-34331,
-34321,
-34316,
-34317,
-34346,
-34376,
-34391,
-34430,
-34404,
-34421,
-34350,
-34326,
-34239,
-34195,
-34119,
-34074,
-34006,
-33951,
-33862,
-33814,
-33713,
-33701,
-33626,
-33635,
-33610,
-33625,
-33627,
-33643,
-33630,
-33633,
-33617,
-33601,
-33589,
-33584,
-33582,
-33607,
-33603,
-33613,
-33619,
-33597,
-33595,
-33562,
-33561,
-33524,
-33516,
-33476,
-33429,
-33384,
-33320,
-33257,
-33225,
-33147,
-33146,
-33097,
-33106,
-33084,
-33095,
-33106,
-33117,
-33129,
-33145,
-33154,
-33169,
-33170,
-33181,
-33152,
-33169,
-33107,
-33100,
-33044,
-33016,
-32962,
-32935,
-32870,
-32854,
-32800,
-32772,
-32736,
-32678,
-32648,
-32576,
-32546,
-32483,
-32471,
-32431,
-32415,
-32400,
-32370,
-32369,
-32323,
+34888,
+34727,
+34606,
+34582,
+34768,
+34929,
+34889,
+34642,
+34224,
+33743,
+33141,
 32321,
-32291,
-32275,
-32266,
-32250,
-32220,
-32207,
-32133,
-32103,
-32024,
-31977,
-31906,
-31854,
-31790,
+31431,
+30685,
+30237,
+30134,
+30232,
+30414,
+30637,
+30753,
+30589,
+30175,
+29719,
+29295,
+28845,
+28435,
+28240,
+28376,
+28731,
+29019,
+29081,
+28918,
+28691,
+28521,
+28118,
+27393,
+26616,
+25957,
+25689,
+25724,
+25819,
+25952,
+26005,
+26152,
+26795,
+27993,
+28998,
+29121,
+28911,
+28950,
+29175,
+29529,
+29960,
+30506,
+31073,
+31604,
+32581,
+34178,
+35673,
+36689,
+37619,
+38495,
+38976,
+39130,
+39281,
+39494,
+39764,
+39989,
+40117,
+40353,
+40478,
+40406,
+40341,
+40020,
+39440,
+38656,
+37439,
+35992,
+34805,
+34015,
+33436,
+33024,
+32721,
+32335,
+31829,
+31334,
+30976,
+30603,
+29988,
+29350,
+28964,
+28778,
+28846,
+29265,
+29778,
+30240,
+30763,
+31175,
+31363,
+31467,
+31613,
+31875,
+32101,
+32338,
+32766,
+33268,
+33745,
+34242,
+34842,
+35330,
+35590,
+35784,
+35921,
+36153,
+36494,
+36710,
+36843,
+36945,
+37014,
+37218,
+37489,
+37780,
+38056,
+37990,
+37904,
+37790,
+37264,
+36768,
+36205,
+35500,
+34952,
+34349,
+33725,
+33194,
+32700,
+32189,
 31731,
-31674,
-31598,
-31561,
-31475,
-31465,
-31389,
-31374,
-31336,
-31287,
-31287,
-31226,
-31228,
-31177,
-31158,
-31105,
-31080,
-31029,
-30990,
-30960,
-30895,
-30859,
-30769,
-30718,
-30613,
-30556,
-30448,
-30383,
-30296,
-30219,
-30153,
-30081,
-30022,
-29969,
-29907,
-29872,
-29830,
-29788,
-29787,
-29763,
-29788,
-29803,
-29811,
-29830,
-29815,
-29821,
-29813,
-29805,
-29794,
-29789,
-29759,
-29759,
-29717,
-29707,
-29651,
-29624,
-29574,
-29536,
-29500,
-29448,
-29424,
-29378,
-29377,
-29348,
-29361,
-29349,
-29364,
-29384,
-29410,
-29445,
-29478,
-29534,
-29583,
-29635,
-29701,
-29749,
-29806,
-29850,
-29872,
-29899,
-29912,
-29906,
-29912,
-29898,
-29904,
-29908,
-29916,
-29907,
-29945,
-29922,
-29987,
-29971,
-30040,
-30056,
-30127,
-30168,
-30250,
-30284,
-30386,
-30429,
-30520,
+31283,
+30654,
+30137,
+29814,
+29501,
+29395,
+29627,
+30096,
+30689,
+31326,
+31840,
+32315,
+32810,
+33066,
+33161,
+33207,
+33114,
+33015,
+33028,
+33164,
+33390,
+33463,
+33162,
+32648,
+32136,
+31457,
+30654,
+29839,
+28773,
+27621,
+26716,
+26049,
+25602,
+25178,
+24680,
+24330,
+24215,
+24278,
+24462,
+24659,
+24741,
+24894,
+25197,
+25533,
+26027,
+26613,
+27315,
+28327,
+29715,
+31494,
+33067,
+34236,
+35416,
+36476,
+37162,
+37387,
+37536,
+37763,
+37604,
+37522,
+38016,
+38470,
+38384,
+38074,
+38067,
+37995,
+37449,
+36781,
+36110,
+35393,
+34708,
+34225,
+34278,
+34772,
+35217,
+35474,
+35651,
+35730,
+35667,
+35431,
+34979,
+34361,
+33759,
+33329,
+32986,
+32810,
+32827,
+32751,
+32490,
+32119,
+31768,
+31386,
+30932,
 30595,
-30662,
-30751,
-30802,
-30892,
-30930,
-31013,
-31039,
+30426,
+30273,
+30120,
+30034,
+30113,
+30385,
+30676,
+30893,
+31041,
+31125,
+31301,
+31666,
+32312,
+33244,
+34180,
+35026,
+35922,
+36892,
+37686,
+38243,
+38463,
+38292,
+37893,
+37614,
+37501,
+37205,
+36896,
+36617,
+36162,
+35592,
+35155,
+34763,
+34152,
+33398,
+32671,
+31938,
+31311,
+30963,
+30806,
+30761,
+30826,
+30990,
+31217,
+31411,
+31677,
+32085,
+32250,
+32399,
+32730,
+32902,
+33103,
+33444,
+33588,
+33579,
+33686,
+33807,
+33820,
+33799,
+33644,
+33322,
+32959,
+32602,
+32263,
+31771,
+31023,
+30406,
+29700,
+29125,
+29031,
+28794,
+28304,
+27886,
+28097,
+28239,
+28255,
+28746,
+29225,
+29846,
+30348,
+30704,
+31722,
+31767,
+31791,
+33117,
+33438,
+33581,
+34066,
+34407,
+34358,
+34031,
+34332,
+34057,
+33591,
+33540,
+33075,
+32644,
+32035,
+31710,
+31210,
+30583,
+30519,
+30355,
+30483,
+30474,
+30345,
+30462,
+30310,
+30376,
+30550,
+30457,
+30637,
+30940,
+31345,
+31715,
+32179,
+32750,
+32768,
+32810,
+33238,
+33283,
+33084,
+33282,
+33695,
+33742,
+33742,
+34289,
+34629,
+34375,
+34390,
+34611,
+34431,
+34059,
+33980,
+33973,
+33796,
+34084,
+34607,
+34833,
+35008,
+35622,
+36071,
+35902,
+36200,
+36388,
+35857,
+35940,
+36289,
+36147,
+36412,
+36697,
+36588,
+36225,
+35970,
+35968,
+35155,
+34344,
+34006,
+33027,
+32116,
+31846,
+31725,
+31193,
+30705,
+31114,
 31106,
-31130,
-31183,
-31209,
-31239,
-31247,
-31252,
-31254,
-31243,
-31251,
-31261,
-31290,
-31340,
-31409,
-31470,
-31561,
-31630,
-31713,
-31774,
-31859,
-31923,
-32017,
-32110,
-32196,
-32298,
-32379,
-32446,
+30397,
+30284,
+30630,
+30110,
+29398,
+30018,
+30434,
+29906,
+30288,
+31272,
+31433,
+31625,
+32497,
+33075,
+32824,
+32564,
+32846,
+32713,
+32396,
+32531,
+32594,
+32654,
+32722,
+32806,
+32873,
+33126,
+32969,
+32069,
+31956,
+31871,
+31153,
+31149,
+31872,
+31994,
+31818,
+32971,
+33514,
+33382,
+34515,
+34796,
+34874,
+35036,
+34789,
+35323,
+34932,
+35188,
+35780,
+35477,
+35897,
+36073,
+35794,
+35585,
+35612,
+35245,
+35040,
+34647,
+34069,
+34576,
+33762,
+33281,
+33917,
+33173,
+33078,
+32778,
+32479,
+32646,
+31676,
+31808,
+32005,
+31237,
+31349,
+31617,
+31339,
+30965,
+30433,
+30621,
+29921,
+29066,
+29419,
+29002,
+27903,
+27848,
+28169,
+27484,
+27328,
+27767,
+27455,
+26757,
+27326,
+27274,
+27091,
+27549,
+27797,
+28394,
+28443,
+29058,
+30191,
+30378,
+31366,
+32448,
+32958,
+33708,
+34317,
+35392,
+36039,
+36130,
+36722,
+37194,
+36698,
+36766,
+37044,
+36896,
+36593,
+36508,
+36631,
+36112,
+35806,
+35370,
+34726,
+34502,
+34022,
+33268,
+32972,
+32909,
+32560,
+32485,
+32928,
+32979,
+32347,
+32289,
+32501,
+32214,
+32259,
+32658,
+32737,
 32507,
-32528,
-32554,
-32565,
-32592,
 32619,
-32665,
-32696,
-32742,
-32741,
-32771,
-32763,
-32767,
-32769,
-32772,
-32781,
-32796,
-32825,
-32862,
-32902,
-32947,
-33015,
-33062,
-33138,
-33189,
+33031,
+33146,
+32968,
+33267,
+33609,
+32576,
+32282,
+33024,
+31612,
+31581,
+32543,
+31482,
+31397,
+32266,
+32385,
+31728,
+32629,
+33395,
+32224,
+32847,
+33266,
+32737,
+33115,
+33703,
+33821,
+33780,
+34583,
+34685,
+34483,
+35303,
+35704,
+34783,
+34755,
+35157,
+34317,
+33631,
+34003,
+33843,
+33118,
+32789,
 33242,
-33292,
-33352,
-33372,
-33451,
-33473,
-33547,
-33576,
-33615,
-33659,
-33672,
-33699,
-33686,
-33688,
-33667,
-33665,
-33678,
-33704,
-33728,
-33750,
+33424,
+32428,
+33006,
+33424,
+32151,
+32710,
+33455,
+32843,
+33108,
+34029,
+34082,
+33739,
+35159,
+35013,
+34585,
+35956,
+35528,
+35542,
+35717,
+36016,
+35554,
+34985,
+35997,
+35181,
+34005,
+34298,
+33722,
+32258,
+31824,
+32224,
+30828,
+29609,
+30860,
+29540,
+28488,
+30208,
+28518,
+28248,
+29245,
+28304,
+28476,
+29719,
+29671,
+29044,
+32141,
+31412,
+31215,
+33415,
+33383,
+33734,
+33002,
+34728,
+34274,
+32734,
+34612,
+33511,
+34113,
+34293,
+33664,
+34167,
+33560,
+32908,
+32275,
+32422,
+30964,
+30556,
+31276,
+29801,
+30425,
+30365,
+29935,
+30436,
+30097,
+29800,
+30248,
+30256,
+28777,
+30205,
+30353,
+29443,
+30473,
+30590,
+30958,
+30575,
+31533,
+31627,
+30920,
+32639,
+31460,
+31237,
+32348,
+31660,
+31336,
+32183,
+32413,
+31567,
+32427,
+33055,
+31793,
+33229,
+33891,
+32423,
+33892,
+34732,
+33762,
+34157,
+35656,
+35156,
+34357,
+36006,
+35764,
+34811,
+35790,
+35757,
+35511,
+34806,
+35076,
+35318,
+33825,
+34418,
+34606,
+33434,
+33494,
+34256,
+33651,
+33132,
+34420,
+34248,
+33549,
+34844,
+34709,
+34682,
+35052,
+35162,
+34648,
+34590,
+35434,
+34091,
+34325,
+35521,
+34124,
 33759,
-33765,
-33763,
-33757,
-33753,
-33748,
-33745,
-33768,
-33775,
-33826,
-33853,
-33903,
-33916,
-33979,
-33957,
-34021,
-33982,
-34010,
-34008,
-34008,
-34052,
-34050,
-34081,
-34092,
-34084,
-34081,
-34063,
-34038,
-34010,
-33949,
-33907,
-33871,
-33858,
-33853,
-33870,
-33864,
-33853,
-33845,
-33809,
-33801,
-33787,
-33784,
-33809,
-33828,
-33865,
-33889,
-33917,
-33922,
-33942,
-33940,
-33950,
-33952,
-33930,
-33899,
-33870,
-33828,
-33835,
-33824,
-33836,
-33849,
-33821,
-33819,
-33770,
-33747,
-33693,
-33661,
-33606,
-33625,
-33615,
+35338,
+33624,
+33647,
+35318,
+32452,
+32920,
+34615,
+32400,
+31317,
+33022,
+32194,
+30310,
+32530,
+32007,
+31876,
+32974,
+31423,
+33048,
+34059,
+32724,
+33091,
+33844,
 33678,
-33716,
-33742,
-33774,
-33779,
-33802,
-33823,
-33848,
-33898,
-33913,
-33976,
-33980,
-34022,
-34013,
-34028,
-33996,
-34002,
-33973,
-33962,
-33936,
-33908,
-33877,
-33872,
-33874,
-33902,
-33941,
-33949,
-33983,
-33950,
-33963,
-33953,
-33954,
-33972,
-33989,
-34019,
-34060,
-34093,
-34115,
-34148,
-34169,
-34199,
-34249,
-34254,
-34277,
-34244,
-34229,
-34179,
-34163,
-34130,
-34137,
-34111,
-34106,
-34058,
-34058,
-34006,
-33998,
-33974,
-33958,
-33986,
-34015,
-34079,
-34130,
-34172,
-34199,
-34207,
-34215,
-34220,
-34244,
-34265,
-34299,
-34322,
+33451,
+33551,
+34461,
+35134,
+33127,
 34358,
-34370,
-34394,
-34416,
-34416,
-34429,
-34439,
-34413,
-34409,
-34377,
-34340,
-34332,
-34300,
-34292,
-34297,
-34283,
-34288,
-34286,
-34286,
-34293,
-34302,
-34299,
-34335,
-34347,
-34379,
-34412,
-34412,
-34448,
-34431,
-34445,
-34445,
-34435,
-34424,
-34401,
-34379,
-34364,
-34351,
-34355,
-34355,
-34342,
-34360,
-34313,
-34307,
-34258,
-34227,
-34198,
-34151,
-34127,
-34095,
-34071,
-34066,
-34035,
-34025,
-33988,
-33963,
-33916,
-33908,
-33859,
-33869,
-33832,
-33827,
-33810,
+36533,
+32872,
+33425,
+35602,
+32517,
+32402,
+33958,
+32785,
+32152,
+32650,
+31784,
+31389,
+31943,
+29972,
+31063,
+31641,
+29306,
+30960,
+30736,
+29847,
+30910,
+30414,
+30313,
+31059,
+30791,
+30501,
+31090,
+32018,
+30392,
+31109,
+32296,
+30925,
+31617,
+31406,
+31307,
+32142,
+30316,
+30183,
+32348,
+30308,
+29129,
+31661,
+30984,
+29117,
+30547,
+31477,
+29717,
+30370,
+31798,
+29817,
+30930,
+32811,
+30579,
+30602,
+33236,
+32207,
+30508,
+32683,
+33636,
+32031,
+32615,
+34239,
+33686,
 33775,
-33768,
-33718,
-33710,
-33672,
-33648,
-33622,
-33583,
-33564,
-33544,
-33519,
-33504,
-33478,
-33458,
-33426,
-33399,
-33351,
-33299,
-33248,
-33179,
-33105,
-33046,
-32973,
-32907,
-32871,
-32781,
-32750,
+34528,
+33577,
+34061,
+34031,
+32599,
+32793,
+33148,
+32024,
+31711,
+32565,
+31939,
+31742,
 32669,
-32611,
-32547,
-32478,
-32444,
-32386,
-32359,
-32305,
-32264,
-32234,
-32184,
-32176,
-32111,
-32119,
-32036,
-32045,
-31952,
-31961,
-31884,
-31891,
-31849,
-31831,
-31804,
+32216,
+32539,
+32845,
+32737,
+33333,
+33483,
+33491,
+34368,
+34784,
+34435,
+35686,
+36320,
+35855,
+36328,
+37379,
+36127,
+35980,
+37175,
+36059,
+35553,
+35960,
+36080,
+34509,
+34320,
+35282,
+33593,
+34417,
+34556,
 31775,
-31719,
-31679,
-31623,
-31567,
-31539,
-31484,
-31449,
-31410,
-31349,
-31344,
-31276,
-31295,
-31240,
-31246,
-31216,
-31192,
-31184,
-31153,
-31144,
-31147,
-31118,
-31148,
-31111,
-31135,
-31101,
-31096,
-31057,
-31053,
-31012,
-31015,
-30994,
-30986,
-30970,
-30953,
-30924,
-30915,
-30897,
-30873,
-30858,
-30847,
-30818,
-30832,
-30818,
-30833,
-30836,
-30841,
-30848,
-30867,
-30869,
-30888,
-30912,
-30916,
-30950,
-30939,
-30988,
-30973,
-31029,
-30999,
-31047,
-31019,
-31039,
-31027,
-31027,
-31024,
-31031,
-31011,
-31014,
-31009,
-31021,
-31035,
-31053,
-31080,
-31070,
-31114,
-31099,
-31144,
-31165,
-31213,
-31249,
-31285,
-31321,
-31334,
-31379,
-31399,
-31432,
-31462,
-31482,
-31493,
-31507,
-31526,
-31541,
-31568,
-31588,
+34456,
+34389,
+32122,
+32871,
+33521,
+33741,
+31814,
+32561,
+33761,
+33050,
+32499,
+32617,
+35115,
+33875,
+32465,
+34860,
+34758,
+32782,
+33475,
+35074,
+34039,
+33211,
+33879,
+34497,
+33549,
+32067,
+33278,
+32572,
 31589,
-31606,
-31587,
-31608,
+31487,
+30766,
+32157,
+30788,
+29897,
+31463,
+29946,
+29374,
+30112,
+30783,
+29707,
+30419,
+31525,
+29378,
+31804,
+32187,
+29493,
+31760,
+33177,
+31548,
+31835,
+33349,
+32689,
+31194,
+32513,
+33481,
+32549,
+31579,
+31432,
+33381,
+32039,
+31389,
+33601,
+31713,
+31775,
+31811,
+32120,
+32405,
+31181,
+32512,
+32291,
+32147,
+32480,
+32901,
+32644,
+31573,
+33559,
+33988,
 31585,
-31620,
-31614,
-31639,
-31660,
-31680,
-31710,
-31755,
-31757,
-31817,
-31801,
-31843,
-31847,
-31871,
-31896,
-31910,
-31938,
-31936,
-31955,
-31947,
-31960,
-31968,
-31976,
-31973,
-31967,
-31963,
-31961,
-31976,
-31992,
-32010,
-32020,
-32031,
-32017,
-32029,
-32011,
-32034,
-32021,
-32054,
-32041,
-32081,
-32052,
-32084,
-32057,
-32056,
-32059,
-32035,
-32052,
-32023,
-32006,
-31981,
-31929,
-31915,
-31895,
-31892,
-31914,
-31914,
-31930,
-31908,
-31901,
-31894,
-31884,
-31921,
-31917,
+33115,
+34228,
+32080,
+33045,
+34257,
+33305,
+32601,
+33712,
+33628,
+31831,
+32827,
+32622,
+31853,
+31647,
+30477,
+31186,
+30991,
+30351,
+30720,
+30265,
+31263,
+30334,
+30756,
+32284,
+30831,
+31487,
+31427,
+31765,
+32337,
+32143,
+32437,
+32479,
+33209,
+32980,
+34006,
+34572,
+33486,
+34494,
+34903,
+34308,
+34164,
+35338,
+35223,
+34307,
+35652,
+34838,
+34393,
+35005,
+34695,
+35277,
+34196,
+34113,
+35836,
+34696,
+33696,
+34453,
+35273,
+34314,
+33566,
+35227,
+34521,
+33815,
+35196,
+33895,
+34446,
+35170,
+32896,
+33501,
+34441,
+33302,
+32829,
+33264,
+32878,
+32137,
+33025,
+31724,
+31060,
+32561,
+31061,
+31243,
+30678,
+30311,
+31122,
+30924,
+30009,
+30986,
+31933,
+30613,
+30660,
+32137,
+32226,
+30611,
+31965,
+32105,
+31696,
+32082,
 31961,
-31968,
-31973,
-31979,
-31966,
-31982,
-31950,
-31964,
-31934,
-31923,
-31910,
-31884,
-31894,
-31877,
+32221,
+32589,
+32862,
+32612,
+32509,
+32699,
+32460,
+31782,
+32080,
+31237,
+31476,
+32012,
+31060,
+31738,
+32361,
+32106,
+32840,
+32510,
+32324,
+32908,
+32496,
+32471,
+32920,
+32663,
+33274,
+33818,
+33307,
+35120,
+33484,
+34083,
+36251,
+33846,
+34033,
+35459,
+35142,
+33413,
+34532,
+35829,
+33888,
+34131,
+34921,
+33180,
+34869,
+33826,
+31980,
+34050,
+32550,
+31704,
+32555,
+31858,
+31302,
+31210,
+32097,
+30785,
+30627,
+31963,
+30572,
+30837,
+31796,
+30806,
+30136,
+31829,
+31384,
+31200,
 31891,
-31881,
-31879,
-31867,
-31863,
-31843,
-31851,
-31836,
-31857,
-31853,
+32013,
+31977,
+32390,
+33016,
+33011,
+34062,
+33434,
+33336,
+34784,
+35220,
+34325,
+34911,
+35951,
+34653,
+35045,
+36679,
+35143,
+35070,
+35994,
+35451,
+34850,
+35176,
+35140,
+33822,
+33315,
+34108,
+33624,
+32129,
+32655,
+33523,
+31510,
+32277,
+32799,
+30026,
+32143,
 31896,
-31913,
-31962,
-31982,
-32035,
-32038,
-32102,
-32112,
-32171,
-32192,
-32224,
-32235,
-32268,
-32261,
-32307,
-32308,
-32344,
-32347,
-32344,
-32344,
-32320,
-32309,
-32325,
-32319,
-32373,
-32376,
-32418,
-32416,
-32441,
-32438,
-32470,
+28889,
+29706,
+32099,
+29167,
+27654,
+32832,
+29259,
+27951,
+32622,
+30514,
+29223,
+30765,
+31827,
+30469,
+30323,
 32479,
-32522,
-32544,
-32574,
-32587,
-32609,
-32636,
-32660,
-32705,
-32736,
-32772,
-32777,
-32796,
-32766,
-32783,
-32767,
-32789,
-32807,
-32823,
-32839,
-32857,
-32850,
-32865,
-32877,
-32891,
-32933,
-32944,
-33002,
-33021,
-33070,
-33097,
-33152,
-33176,
-33240,
-33278,
+31714,
+31935,
+32242,
+32128,
+33366,
+32239,
+31298,
+33000,
+32393,
+31161,
+32435,
+32811,
+31360,
+32232,
+33370,
+31874,
+32075,
+33051,
+32164,
+31590,
+32836,
+32470,
+32481,
+32951,
+32489,
 33312,
-33362,
-33361,
-33398,
-33409,
-33430,
-33465,
-33488,
-33536,
-33550,
-33585,
+33813,
+33715,
+33854,
+33750,
+33762,
+34084,
+33812,
+33875,
+33546,
+34080,
+33636,
+33524,
+34313,
+33801,
+33510,
+34105,
+33851,
+33303,
+33871,
+34064,
+33446,
+33214,
+33943,
+33496,
+33324,
+33833,
+33403,
+33490,
+33942,
 33570,
-33604,
-33588,
-33618,
-33626,
-33658,
-33697,
-33731,
-33763,
-33811,
-33836,
-33884,
-33902,
+33589,
+34354,
+32961,
+33844,
 33962,
-33966,
-34027,
-34040,
-34085,
-34098,
-34123,
-34124,
-34148,
-34138,
-34187,
+32081,
+33801,
+33602,
+32094,
+32480,
+33471,
+32213,
+31818,
+32751,
+31548,
+31367,
+31864,
+31097,
+31570,
+31908,
+31647,
+31615,
+32162,
+32105,
+32189,
+32442,
+32912,
+33033,
+32243,
+33928,
+34382,
 34161,
-34217,
-34179,
-34210,
-34165,
-34202,
-34180,
-34226,
-34250,
-34274,
-34325,
-34314,
-34365,
-34377,
-34417,
-34459,
-34512,
-34548,
-34620,
-34660,
-34731,
-34772,
-34822,
-34863,
-34889,
-34926,
-34939,
-34975,
-34990,
-34990,
-35006,
-34973,
-34981,
-34957,
-34954,
-34948,
-34928,
-34910,
-34870,
-34834,
-34806,
-34777,
-34772,
-34743,
-34752,
-34716,
-34722,
-34680,
-34684,
-34642,
-34640,
-34622,
-34600,
-34621,
-34597,
-34623,
-34597,
-34589,
-34549,
-34539,
-34500,
-34495,
-34461,
-34446,
-34398,
-34366,
-34301,
-34278,
+34567,
+34496,
+36338,
+34943,
+34917,
+36779,
+36180,
+35368,
+35219,
+36901,
+35756,
+34489,
+36133,
+35001,
+33685,
+34648,
+33685,
+32573,
+32441,
+32842,
+31089,
+30086,
+32408,
+30243,
+29100,
+30755,
+30137,
+29749,
+28979,
+29822,
+30057,
+28839,
+30139,
+29078,
+30322,
+30685,
+28843,
+31338,
+30505,
+30904,
+31586,
+29677,
+32093,
+32242,
+30690,
+30741,
+32055,
+32237,
+30354,
+31315,
+31726,
+31237,
+31519,
+30984,
+31557,
+32338,
+31134,
+31042,
+32540,
+31937,
+31191,
+32480,
+32595,
+31493,
+32876,
+33395,
+32058,
+32522,
+33820,
+33366,
+32510,
+33719,
+33785,
+33553,
+34146,
+33642,
+33969,
+34055,
+33781,
+34009,
+34233,
+33785,
+33942,
+34647,
+33932,
+34007,
+35072,
+34724,
+33645,
 34243,
-34221,
-34200,
-34171,
-34131,
-34108,
-34057,
-34056,
-34015,
-34028,
-34005,
-34020,
-34000,
-34021,
-33996,
-34006,
-33984,
-33959,
-33954,
-33937,
-33941,
-33934,
-33940,
+35018,
+33869,
+33350,
+34354,
+34133,
+33442,
+33953,
+34677,
+33953,
+33316,
+34101,
+33968,
+32482,
+32909,
+33911,
+32213,
+31999,
+33687,
+33179,
+31941,
+33085,
+33555,
+31543,
+32388,
+33309,
+31832,
+32324,
+33258,
+32667,
+32164,
+33308,
+33750,
+32864,
+33019,
+33860,
+33896,
+33625,
+34186,
+35011,
+34812,
+34628,
+35400,
+35369,
+35218,
+35563,
+35341,
+35213,
+35075,
+35146,
+34989,
+34790,
+34868,
+34309,
+34308,
+33943,
+33530,
+33400,
+32711,
+32377,
+32185,
+32011,
+31881,
+31384,
+31401,
+31598,
+30838,
+31077,
+31426,
+30688,
+30306,
+30697,
+30866,
+30097,
+30439,
+30923,
+30238,
+30331,
+30930,
+30792,
+30777,
+31413,
+31110,
+30636,
+31337,
+31391,
+31052,
+31546,
+31553,
+31480,
+31586,
+31777,
+32401,
+31794,
+31755,
+32681,
+32124,
+31671,
+32384,
+32931,
+32423,
+32270,
+33037,
+33029,
+32555,
+32732,
+32976,
+32649,
+32476,
+32547,
+32584,
+32587,
+32682,
+32727,
+32416,
+32667,
+32462,
+32145,
+32523,
+32686,
+32118,
+31987,
+32809,
+32318,
+32033,
+32734,
+32640,
+32229,
+32438,
+32164,
+32049,
+32601,
+32387,
+31973,
+32160,
+32594,
+32402,
+32445,
+32962,
+32660,
+32398,
+32940,
+32834,
+32576,
+33168,
+33442,
+32779,
+32939,
+33830,
+33417,
+33012,
+33197,
+33342,
+33062,
+32730,
+33376,
+33528,
+32921,
+33283,
+33849,
+33303,
+33390,
+34022,
+33368,
+33215,
+34204,
 33907,
-33912,
-33861,
-33864,
-33834,
-33838,
-33827,
-33808,
-33802,
-33786,
-33777,
-33786,
-33780,
-33811,
-33824,
-33831,
-33852,
-33837,
-33868,
-33834,
-33864,
-33841,
+33477,
+34256,
+34631,
+33904,
+33835,
+35047,
+34755,
 33859,
-33851,
-33861,
-33831,
-33827,
-33776,
-33749,
-33690,
-33670,
-33631,
-33611,
-33575,
-33533,
-33499,
-33451,
-33447,
-33400,
-33407,
-33379,
-33363,
-33338,
-33305,
-33295,
-33275,
-33271,
-33268,
-33248,
-33237,
-33206,
-33186,
-33168,
-33133,
-33101,
-33072,
-33025,
-33009,
-32972,
-32954,
-32919,
-32901,
-32852,
-32832,
-32775,
-32767,
-32729,
-32724,
-32695,
-32662,
+34451,
+34972,
+34261,
+34007,
+34878,
+34566,
+33937,
+34609,
+34618,
+33959,
+34244,
+34563,
+34283,
+34001,
+34233,
+34345,
+33689,
+33818,
+33936,
+33486,
+33391,
+33415,
+33405,
+32856,
+33005,
+33223,
+32501,
+32514,
+32560,
+32069,
+32159,
+32110,
+31918,
+31971,
+31961,
+32160,
+32131,
+32070,
+32176,
+32294,
+32039,
+32006,
+32550,
+32400,
+32282,
+32587,
 32653,
-32615,
-32595,
+32455,
 32571,
-32532,
-32505,
-32460,
-32426,
-32386,
-32348,
-32300,
-32253,
-32202,
-32167,
-32124,
-32082,
-32055,
-32004,
-31953,
-31921,
-31851,
-31854,
-31806,
-31800,
-31781,
-31741,
-31733,
-31677,
-31674,
-31647,
-31623,
-31634,
-31574,
-31600,
-31540,
-31557,
-31527,
-31509,
-31496,
-31455,
-31434,
-31421,
-31393,
-31381,
-31351,
-31330,
-31294,
-31288,
-31233,
-31249,
-31197,
-31212,
-31162,
+32833,
+32515,
+32277,
+32273,
+31964,
+31635,
+31514,
+31515,
+31293,
+30924,
+31075,
+30984,
+30891,
 31147,
-31111,
+30806,
+30699,
+30797,
+30592,
+30726,
+30602,
+30717,
+30827,
+30456,
+30703,
+30967,
+30825,
+30707,
+31080,
+30807,
+30565,
+31236,
+30890,
+30637,
+30908,
+30749,
+30777,
+30911,
+30783,
+30891,
+30806,
+30388,
+30774,
+30844,
+30376,
+30617,
+30842,
+30789,
 31097,
-31074,
-31065,
-31047,
-31042,
-31015,
-31010,
-30986,
-30983,
-30961,
-30958,
-30943,
-30941,
-30944,
-30934,
-30947,
-30930,
-30929,
-30905,
-30923,
-30901,
-30921,
-30912,
-30918,
-30921,
-30915,
-30923,
-30939,
-30943,
-30972,
-30987,
-30993,
-31040,
-31034,
-31084,
-31099,
-31131,
-31171,
-31196,
-31250,
-31262,
-31320,
-31316,
-31354,
-31360,
-31375,
-31417,
-31424,
-31473,
-31455,
-31486,
-31468,
-31492,
-31478,
-31507,
-31515,
-31532,
-31550,
-31556,
-31587,
-31603,
-31626,
-31659,
-31690,
-31727,
-31751,
-31790,
-31815,
-31841,
-31869,
-31871,
-31920,
-31923,
-31980,
-31965,
-31978,
-31961,
-31947,
-31932,
-31940,
-31926,
-31928,
-31923,
-31899,
-31891,
-31872,
-31873,
-31867,
-31889,
-31867,
-31908,
-31871,
-31923,
-31895,
-31938,
-31913,
-31951,
-31936,
-31958,
-31963,
-31951,
-31958,
-31926,
-31914,
-31895,
-31873,
-31863,
-31835,
-31825,
-31769,
-31749,
-31698,
-31680,
-31661,
-31652,
-31638,
-31625,
-31604,
-31589,
-31598,
-31568,
-31611,
-31587,
-31618,
-31622,
-31618,
-31638,
-31633,
-31637,
-31649,
-31638,
-31659,
-31663,
-31661,
-31663,
-31659,
-31631,
-31651,
-31640,
-31661,
-31676,
-31683,
-31695,
-31703,
-31715,
-31740,
-31773,
-31814,
-31841,
-31889,
-31919,
-31969,
-31999,
-32053,
-32087,
-32143,
-32182,
-32225,
-32267,
-32302,
-32357,
-32376,
-32418,
-32452,
-32473,
-32514,
-32556,
-32568,
-32621,
-32629,
-32658,
-32688,
-32726,
-32763,
-32809,
-32845,
-32866,
-32918,
-32929,
-32993,
-33015,
-33077,
-33112,
-33169,
-33208,
-33254,
-33303,
-33353,
-33381,
-33443,
-33469,
-33531,
-33563,
-33615,
-33650,
-33691,
-33721,
-33752,
+31839,
+32303,
+32516,
+32941,
+33403,
+33676,
+33759,
+34076,
+34242,
+34593,
+34911,
+35167,
+35742,
+36170,
+36620,
+36882,
+37117,
+37246,
+37194,
+36969,
+36974,
+36902,
+36528,
+36590,
+36439,
+36048,
+36150,
+35939,
+35387,
+35297,
+35298,
+34764,
+34458,
+34759,
+34206,
 33798,
-33821,
-33865,
-33899,
-33912,
-33957,
-33971,
-34007,
-34029,
-34069,
-34091,
-34136,
-34160,
-34190,
-34205,
-34232,
-34249,
-34281,
-34295,
-34333,
-34347,
-34377,
-34399,
-34388,
-34430,
-34400,
-34443,
-34426,
-34444,
+34067,
+33822,
+33425,
+33450,
+33554,
+33102,
+33062,
+33162,
+32872,
+32798,
+32954,
+32970,
+32664,
+32908,
+33043,
+32644,
+32693,
+33030,
+32982,
+32899,
+33311,
+33391,
+33227,
+33675,
+33881,
+33735,
+34137,
+34422,
+34219,
+34128,
+34454,
 34444,
-34431,
-34437,
-34415,
-34421,
-34420,
-34420,
-34430,
-34425,
-34420,
-34409,
-34404,
-34403,
-34407,
-34414,
-34427,
-34433,
-34450,
-34449,
-34457,
-34464,
-34461,
-34488,
-34468,
-34508,
-34482,
-34504,
-34495,
-34481,
-34486,
-34470,
-34474,
-34455,
-34455,
-34418,
-34407,
-34383,
-34365,
-34363,
-34336,
-34341,
-34295,
-34322,
-34257,
-34298,
-34228,
-34254,
-34211,
-34213,
-34193,
-34182,
-34177,
-34153,
-34155,
-34127,
-34126,
-34103,
-34098,
-34077,
-34097,
-34051,
-34078,
-34027,
-34044,
-34027,
-34028,
-34032,
-34030,
 34034,
-34022,
-34017,
-34009,
-33991,
-34000,
-33982,
-34000,
-33979,
-33973,
-33955,
-33931,
-33912,
-33904,
-33880,
-33887,
-33852,
-33841,
-33814,
-33791,
-33761,
-33756,
-33736,
-33755,
+34109,
+33975,
+33619,
+33587,
+33621,
+33245,
+32817,
+32842,
+32424,
+31755,
+31821,
+31718,
+30995,
+30868,
+30845,
+30400,
+30291,
+30442,
+30112,
+29810,
+30018,
+29845,
+29824,
+29975,
+29873,
+29974,
+30190,
+30333,
+30428,
+30665,
+30558,
+30341,
+30241,
+30248,
+30213,
+30053,
+30077,
+29611,
+29493,
+29519,
+29125,
+28934,
+28578,
+28103,
+27709,
+27480,
+27563,
+27509,
+27246,
+27496,
+27608,
+28719,
+30563,
+31059,
+31436,
+31997,
+32318,
+32268,
+32357,
+33800,
+35102,
+34906,
+35401,
+37588,
+39023,
+38769,
+38990,
+39915,
+39180,
+37602,
+37577,
+38229,
+38233,
+37833,
+37841,
+37452,
+36722,
+36390,
+35458,
+34263,
+33776,
+32984,
+31455,
+31169,
+31665,
+31782,
+31584,
+31100,
+31092,
+31057,
+30681,
+30583,
+31195,
+31573,
+31717,
+32372,
+32968,
+33788,
+34499,
+34763,
+34780,
+34871,
+35092,
+35245,
+35603,
+35979,
+36317,
+36403,
+36174,
+36047,
+35955,
+35486,
+34873,
+34571,
+34263,
+33939,
+33925,
+34018,
+34099,
+33730,
+33189,
+33097,
+32400,
+31793,
+31969,
+31685,
+31390,
+31700,
+31786,
+31663,
+31905,
+31849,
+31363,
+31074,
+30907,
+30743,
+30469,
+30605,
+30965,
+30754,
+30729,
+31121,
+31190,
+30804,
+30822,
+31120,
+30790,
+31020,
+31838,
+32020,
+32311,
+33047,
+33205,
+33011,
+33357,
+33479,
+33156,
+33317,
+33421,
+33280,
+33484,
+33602,
+33558,
+33529,
+33625,
+33457,
+33005,
+33120,
+33021,
+32693,
+32916,
+32947,
+32837,
+32689,
+32694,
+32697,
+32373,
+32607,
+32576,
+32344,
+32558,
+32574,
+32762,
+32892,
+32970,
+33059,
+32644,
+32552,
+32710,
+32458,
+32545,
+32614,
+32405,
+32324,
+32179,
+32034,
+31714,
+31558,
+31264,
+30683,
+30496,
+30337,
+30149,
+30154,
+30171,
+30064,
+30215,
+30329,
+30155,
+30446,
+30731,
+30860,
+31429,
+32010,
+32504,
+33231,
+33580,
+33732,
+34336,
+34707,
+34684,
+34940,
+35416,
+35400,
+35295,
+35454,
+35468,
+35323,
+35031,
+34760,
+34565,
+34345,
+34048,
+33980,
+33910,
+33522,
+33304,
+33034,
+32539,
+32451,
+32458,
+32081,
+32013,
+32351,
+32469,
+32400,
+32638,
+33025,
+32873,
+32751,
+32973,
+33166,
+33197,
+33257,
+33674,
+33677,
 33734,
-33743,
-33706,
-33709,
-33690,
-33683,
-33690,
-33689,
-33700,
-33683,
-33678,
-33661,
-33645,
-33640,
-33623,
-33612,
-33592,
-33579,
+34016,
+33845,
+33710,
+33558,
+33260,
+32999,
+32762,
+32539,
+32531,
+32197,
+31834,
+31844,
+31583,
+31352,
+31272,
+31049,
+30904,
+30826,
+30768,
+30790,
+30721,
+30919,
+30839,
+30825,
+31237,
+31260,
+31535,
+31882,
+32057,
+32230,
+32612,
+32962,
+32970,
+33406,
+33792,
+33798,
+34212,
+34464,
+34549,
+34841,
+34806,
+34962,
+35114,
+35141,
+35242,
+35203,
+35203,
+35236,
+35142,
+34861,
+34910,
+34756,
+34268,
+34116,
+34094,
+33703,
+33497,
+33597,
+33263,
+33172,
+33191,
+32981,
+32768,
+32660,
+32619,
+32195,
+32128,
+32412,
+32244,
+32120,
+32269,
+32123,
+31985,
+32114,
+32076,
+32185,
+32383,
+32328,
+32384,
+32539,
+32540,
+32540,
+32458,
+32258,
+32303,
+32276,
+32173,
+32432,
+32612,
+32285,
+32173,
+32180,
+31701,
+31464,
+31433,
+31179,
+31022,
+31079,
+31160,
+31305,
+31467,
+31556,
+31623,
+31689,
+31704,
+31688,
+31978,
+32231,
+32374,
+32554,
+32796,
+32930,
+32916,
+33048,
+32907,
+32761,
+32786,
+32831,
+32785,
+32727,
+32777,
+32365,
+32008,
+31776,
+31206,
+30885,
+30625,
+30287,
+30064,
+29658,
+29326,
+28709,
+28023,
+27777,
+27998,
+29689,
+31292,
+31767,
+32750,
+33569,
+33167,
+32637,
+33244,
+34246,
+34293,
+34300,
+35653,
+37243,
+37313,
+37171,
+38105,
+38312,
+37135,
+36779,
+37309,
+37193,
+37015,
+37044,
+36861,
+36550,
+36212,
+35591,
+34656,
+34043,
+33531,
+32633,
+32022,
+32314,
+32506,
+31974,
+31670,
+31515,
+30673,
+29804,
+29553,
+29477,
+29255,
+29618,
+30443,
+30829,
+31473,
+32585,
+33103,
+32936,
+33097,
+33263,
+32958,
+33128,
+33692,
+34035,
+34312,
+34709,
+34925,
+34941,
+34884,
+34759,
+34476,
+34013,
+33948,
+34050,
+33939,
+33986,
+33963,
+33504,
+32921,
+32559,
+32024,
+31476,
+31395,
+31313,
+31096,
+31119,
+31267,
+31230,
+31002,
+30709,
+30611,
+30452,
+30145,
+30226,
+30612,
+30945,
+31265,
+31843,
+32196,
+32278,
+32476,
+32391,
+32394,
+32590,
+32674,
+32979,
+33363,
+33598,
+33895,
+34036,
+33956,
+33998,
+33763,
+33546,
 33541,
-33537,
-33506,
-33495,
-33482,
-33465,
-33463,
-33449,
-33464,
-33448,
-33464,
-33449,
-33454,
-33463,
-33469,
-33488,
-33506,
-33522,
-33532,
-33534,
-33528,
-33527,
-33520,
-33519,
-33505,
-33511,
-33483,
-33471,
-33449,
-33417,
-33395,
-33379,
-33352,
-33345,
-33325,
-33301,
-33304,
-33262,
-33260,
-33261,
-33258,
-33276,
-33283,
-33294,
-33295,
-33294,
-33280,
-33278,
-33290,
-33286,
-33286,
-33276,
-33253,
-33233,
-33207,
-33170,
-33172,
-33121,
-33125,
-33064,
-33047,
+33333,
+33293,
+33307,
+33202,
+33140,
 33006,
+32726,
+32479,
+32416,
+32179,
+31864,
+31895,
+31852,
+31705,
+31697,
+31628,
+31392,
+31270,
+31367,
+31096,
+30941,
+31126,
+31142,
+31257,
+31526,
+31865,
+32114,
+32240,
+32395,
+32605,
+32877,
+32990,
+33215,
+33426,
+33358,
+33545,
+33720,
+33658,
+33544,
+33576,
+33663,
+33456,
+33478,
+33666,
+33531,
+33209,
+33115,
+33031,
+32710,
+32759,
+33101,
+33281,
+33615,
+34170,
+34358,
+34462,
+34725,
+34765,
+34735,
+34844,
+35054,
+35113,
+35258,
+35546,
+35480,
+35484,
+35697,
+35515,
+35118,
+34934,
+34783,
+34286,
+33887,
+33808,
+33406,
+32902,
+32724,
+32342,
+31753,
+31563,
+31307,
+30822,
+30665,
+30641,
+30552,
+30571,
+30687,
+30741,
+30749,
+30750,
+30795,
+30865,
+30896,
+31116,
+31338,
+31466,
+31831,
+32144,
+32358,
+32633,
+32682,
+32619,
+32603,
+32550,
+32560,
+32632,
+32741,
+32729,
+32607,
+32731,
+32670,
+32528,
+32692,
+32538,
+32283,
+32321,
+32445,
+32391,
+32328,
+32508,
+32393,
+32068,
+32045,
+32148,
+32107,
+32184,
+32442,
+32483,
+32586,
+32878,
 32984,
-32957,
-32960,
-32909,
-32935,
-32897,
-32910,
-32906,
-32894,
+32955,
+32952,
+32981,
+32943,
+32792,
+32836,
+32994,
+32802,
+32771,
+32929,
+32830,
+32823,
 32912,
-32884,
-32913,
-32890,
+32862,
+32653,
+32783,
+32925,
+32765,
 32914,
-32916,
-32915,
-32911,
-32905,
-32867,
+33059,
+32926,
+32904,
+32969,
+32895,
+33020,
+33100,
+33207,
+33487,
+33574,
+33771,
+33984,
+34083,
+34088,
+34199,
+34246,
+34095,
+34030,
+33878,
+33694,
+33523,
+33327,
+33179,
+33053,
+32926,
+32908,
+32842,
+32783,
+32737,
+32692,
+32723,
+32558,
+32509,
+32590,
+32443,
+32279,
+32348,
+32286,
+32131,
+32215,
+32292,
+32298,
+32353,
+32518,
+32579,
+32574,
+32665,
+32725,
+32679,
+32699,
+32842,
+32796,
+32731,
+32838,
+32880,
+32804,
+32894,
+32978,
 32872,
-32832,
-32813,
-32791,
-32757,
-32736,
-32690,
-32663,
-32621,
-32593,
-32564,
-32533,
-32503,
-32474,
-32459,
-32425,
-32417,
-32393,
-32376,
-32372,
-32354,
-32352,
-32352,
-32327,
-32330,
-32290,
-32283,
-32262,
-32244,
-32232,
-32205,
-32178,
-32140,
-32124,
-32080,
+32867,
+32882,
+32799,
+32659,
+32563,
+32439,
+32172,
 32079,
-32033,
-32028,
-31985,
-31982,
-31936,
-31942,
-31927,
-31920,
-31933,
-31891,
-31911,
-31884,
-31895,
-31891,
-31880,
-31880,
-31864,
-31850,
+31958,
+31628,
+31542,
+31427,
+31135,
+30992,
+30813,
+30557,
+30300,
+30072,
+30019,
+30003,
+30083,
+30319,
+30544,
+30889,
+31267,
+31510,
+31648,
+31785,
+31975,
+32132,
+32525,
+33055,
+33437,
+33922,
+34289,
+34593,
+35154,
+35512,
+35741,
+36114,
+36318,
+36384,
+36555,
+36658,
+36654,
+36624,
+36426,
+36163,
+35971,
+35708,
+35340,
+35056,
+34655,
+34134,
+33758,
+33193,
+32579,
+32252,
+31765,
+31166,
+30957,
+30772,
+30400,
+30294,
+30313,
+30145,
+30066,
+30139,
+30044,
+30018,
+30227,
+30304,
+30393,
+30676,
+30912,
+31169,
+31473,
 31832,
-31812,
-31795,
-31760,
-31749,
-31695,
-31669,
-31621,
-31580,
-31541,
-31513,
-31467,
-31441,
-31414,
-31377,
-31369,
-31329,
-31333,
-31288,
-31309,
-31269,
-31290,
+32248,
+32487,
+32724,
+33049,
+33249,
+33482,
+33873,
+34172,
+34408,
+34732,
+34912,
+34979,
+35145,
+35265,
+35235,
+35246,
+35287,
+35216,
+35114,
+35048,
+34943,
+34703,
+34484,
+34355,
+34175,
+34094,
+34111,
+34026,
+33897,
+33753,
+33567,
+33338,
+33108,
+32944,
+32718,
+32446,
+32358,
+32306,
+32237,
+32250,
+32243,
+32191,
+31975,
+31840,
+31746,
+31462,
+31348,
 31271,
-31259,
-31252,
-31237,
-31227,
-31230,
-31210,
-31203,
-31177,
-31164,
-31125,
-31114,
-31067,
-31080,
-31025,
-31037,
-30979,
-30975,
-30953,
-30927,
-30939,
-30916,
-30922,
-30932,
-30927,
-30953,
-30941,
-30970,
-30965,
-31005,
-30988,
-31032,
-31030,
-31040,
-31056,
-31034,
-31059,
-31034,
-31051,
-31050,
-31062,
 31047,
-31057,
-31036,
-31046,
-31050,
-31063,
-31079,
-31106,
-31119,
-31151,
-31157,
-31198,
-31233,
-31272,
-31315,
-31346,
-31387,
-31403,
-31439,
-31456,
-31484,
-31516,
-31536,
-31569,
-31583,
-31599,
-31607,
-31620,
-31632,
-31656,
-31674,
-31694,
-31707,
-31737,
-31750,
-31775,
-31803,
-31861,
-31879,
-31945,
-31951,
-32004,
-32038,
-32068,
-32126,
-32161,
-32214,
-32240,
-32278,
-32297,
-32329,
-32357,
-32378,
-32401,
-32426,
-32419,
-32459,
-32453,
-32499,
-32505,
-32537,
-32549,
-32585,
-32603,
-32631,
-32665,
-32691,
-32728,
-32756,
-32791,
-32819,
-32862,
-32880,
-32915,
-32936,
-32941,
-32981,
-32985,
-33003,
-33028,
-33011,
-33042,
-33020,
-33041,
-33040,
-33056,
-33056,
-33055,
-33056,
-33052,
-33063,
+30965,
+30948,
+30749,
+30580,
+30492,
+30334,
+30128,
+29996,
+29953,
+29731,
+29474,
+29382,
+29367,
+29447,
+29575,
+29604,
+29549,
+29461,
+29295,
+29210,
+29192,
+29157,
+29176,
+29378,
+30058,
+31236,
+32387,
+32969,
+33116,
 33073,
-33080,
-33100,
-33105,
-33125,
-33133,
-33141,
-33151,
-33157,
-33170,
-33179,
-33184,
-33185,
-33201,
-33190,
-33192,
-33185,
-33168,
-33176,
-33173,
-33147,
-33161,
-33123,
-33120,
-33096,
-33092,
-33082,
-33094,
-33091,
-33082,
-33068,
+32772,
+32726,
+33401,
+34088,
+34348,
+34489,
+34477,
+34548,
+35183,
+36025,
+36512,
+36862,
+37143,
+36883,
+36375,
+36455,
+36635,
+36184,
+35817,
+35868,
+35770,
+35620,
+35796,
+35842,
+35514,
+35228,
+34878,
+34276,
+33944,
+33854,
+33244,
+32568,
+32492,
+32528,
+32372,
+32471,
+32917,
+32935,
+32521,
+32279,
+32044,
+31721,
+31536,
+31350,
+31103,
+31010,
+31004,
+31007,
+31137,
+31518,
+31786,
+31642,
+31556,
+31556,
+31419,
+31258,
+31195,
+31257,
+31334,
+31450,
+31673,
+32003,
+32336,
+32502,
+32544,
+32656,
+32770,
+32836,
+32961,
 33072,
-33045,
-33071,
-33053,
-33070,
-33068,
-33066,
-33054,
-33050,
-33039,
-33045,
-33028,
-33037,
-33014,
-33016,
-33003,
-32986,
-32982,
-32964,
-32960,
-32959,
-32937,
-32952,
-32931,
-32943,
-32919,
-32927,
-32908,
-32933,
-32922,
-32946,
-32942,
-32947,
-32948,
-32941,
-32943,
-32953,
-32955,
-32963,
-32980,
-32954,
-32985,
-32953,
-32977,
-32966,
-32984,
-32982,
-32994,
-33009,
-32991,
-33017,
-32983,
-33025,
-33017,
-33044,
-33063,
-33080,
-33086,
-33099,
-33101,
-33124,
-33128,
-33160,
-33161,
-33188,
-33188,
-33187,
-33196,
-33188,
-33210,
-33213,
 33219,
-33231,
-33212,
-33226,
-33209,
-33215,
-33224,
-33229,
-33245,
-33248,
-33260,
-33263,
-33287,
-33306,
-33337,
-33363,
-33403,
-33409,
-33446,
-33462,
-33495,
-33523,
-33554,
-33570,
-33594,
-33601,
-33615,
-33618,
-33637,
-33653,
-33647,
-33669,
-33644,
-33646,
-33647,
-33646,
-33659,
-33657,
-33663,
-33654,
-33666,
-33666,
-33676,
-33695,
-33706,
-33738,
-33728,
-33773,
-33748,
-33799,
-33780,
-33800,
-33811,
-33802,
-33837,
-33815,
-33824,
-33808,
-33794,
-33788,
-33770,
-33786,
-33762,
-33765,
-33749,
-33743,
-33728,
-33743,
-33731,
-33762,
-33751,
-33777,
-33766,
-33782,
-33784,
-33798,
-33807,
-33813,
-33819,
-33817,
-33827,
-33816,
-33832,
-33803,
-33825,
-33785,
-33792,
-33772,
-33759,
-33754,
-33736,
-33714,
-33712,
-33680,
-33706,
-33672,
-33705,
-33683,
-33682,
-33673,
-33666,
-33670,
-33666,
-33688,
-33675,
-33687,
-33684,
-33663,
-33691,
-33656,
-33685,
-33658,
-33646,
-33636,
-33595,
-33599,
-33552,
-33548,
-33531,
-33504,
-33500,
-33478,
-33446,
-33451,
-33403,
-33406,
-33386,
-33361,
-33374,
+33389,
+33580,
+33901,
+34258,
+34569,
+34727,
+34787,
+34885,
+34918,
+34927,
+34964,
+34933,
+34888,
+34805,
+34698,
+34650,
+34549,
+34376,
+34142,
+33943,
+33822,
+33622,
+33468,
+33388,
+33111,
+32823,
+32627,
+32312,
+32027,
+31797,
+31494,
+31213,
+31097,
+31036,
+30954,
+30974,
+31027,
+31041,
+31030,
+31110,
+31229,
+31304,
+31483,
+31753,
+32019,
+32253,
+32435,
+32531,
+32565,
+32603,
+32735,
+32839,
+32893,
+33017,
+33109,
+33181,
 33334,
-33344,
-33290,
-33299,
-33247,
-33258,
-33219,
-33219,
-33175,
-33159,
-33111,
-33085,
-33057,
-33020,
-33016,
-32952,
-32955,
-32880,
-32857,
-32810,
-32789,
-32752,
-32747,
-32703,
-32690,
-32647,
-32630,
-32592,
-32576,
-32539,
-32522,
-32481,
-32464,
-32420,
-32393,
-32373,
+33499,
+33470,
+33318,
+33167,
+32984,
+32831,
+32817,
+32800,
+32667,
+32538,
+32399,
 32321,
-32324,
-32267,
-32267,
-32220,
-32187,
-32157,
-32103,
-32092,
-32028,
-32031,
-31969,
-31973,
-31920,
-31889,
-31873,
-31824,
-31828,
-31792,
-31776,
-31749,
-31715,
-31686,
-31673,
-31636,
-31639,
-31586,
-31573,
-31529,
-31521,
-31478,
-31484,
-31448,
-31442,
-31420,
-31401,
-31389,
-31384,
-31376,
-31378,
-31373,
-31367,
-31373,
-31375,
-31379,
-31395,
-31407,
-31424,
-31447,
-31443,
-31465,
-31461,
-31485,
-31494,
-31515,
-31521,
-31557,
-31548,
-31578,
-31569,
-31594,
-31619,
-31636,
-31666,
-31682,
-31696,
-31721,
-31727,
-31756,
-31791,
-31812,
-31850,
-31879,
-31893,
-31923,
-31938,
-31963,
+32286,
+32249,
+32159,
 31998,
-32015,
-32049,
-32053,
-32076,
-32074,
-32092,
-32108,
-32128,
-32143,
-32153,
-32172,
-32154,
-32190,
-32170,
-32205,
-32211,
+31841,
+31663,
+31601,
+31601,
+31570,
+31553,
+31548,
+31532,
+31628,
+31896,
+32098,
 32226,
-32244,
-32252,
-32277,
-32265,
-32311,
-32325,
-32351,
-32398,
-32409,
-32447,
-32468,
-32488,
-32535,
-32545,
-32591,
-32606,
-32620,
-32645,
-32651,
-32658,
-32682,
-32678,
-32706,
-32698,
-32715,
-32709,
-32721,
-32713,
-32722,
-32711,
-32723,
-32716,
-32729,
-32725,
-32735,
+32391,
+32542,
+32560,
+32712,
+33018,
+33121,
+33191,
+33298,
+33416,
+33580,
+33815,
+34025,
+34064,
+34088,
+34129,
+34050,
+33970,
+33968,
+33785,
+33497,
+33285,
+33175,
+33115,
+32964,
+32852,
+32692,
+32460,
+32308,
+32134,
+32006,
+31916,
+31711,
+31496,
+31372,
+31319,
+31278,
+31178,
+31139,
+31145,
+31087,
+31142,
+31247,
+31365,
+31566,
+31658,
+31771,
+32035,
+32250,
+32418,
+32571,
+32704,
+32797,
+32809,
+32881,
+33029,
+33203,
+33396,
+33516,
+33652,
+33786,
+33781,
+33779,
+33826,
+33835,
+33847,
+33852,
+33833,
+33849,
+33868,
+33888,
+33902,
+33948,
+34014,
+33978,
+33980,
+34019,
+34029,
+34076,
+34063,
+34026,
+34027,
+34007,
+33961,
+33980,
+34004,
+33903,
+33804,
+33777,
+33712,
+33606,
+33546,
+33428,
+33226,
+33076,
+32946,
 32746,
-32742,
+32487,
+32325,
+32170,
+32025,
+32086,
+32218,
+32266,
+32285,
+32435,
+32568,
+32601,
 32754,
-32753,
-32773,
-32792,
-32780,
-32810,
-32784,
-32808,
-32796,
-32791,
-32811,
-32786,
-32798,
-32777,
-32763,
-32761,
-32726,
-32745,
-32699,
-32723,
-32681,
-32691,
-32680,
-32667,
-32667,
-32659,
-32663,
-32672,
-32673,
-32688,
-32695,
-32708,
-32697,
-32717,
-32710,
-32730,
-32744,
-32748,
-32739,
-32758,
-32725,
-32749,
-32727,
-32730,
-32739,
-32718,
-32716,
-32703,
-32693,
-32687,
-32681,
-32684,
-32673,
-32688,
-32654,
-32683,
-32652,
-32682,
-32670,
-32677,
-32675,
-32686,
-32688,
-32702,
-32711,
-32714,
-32724,
-32714,
-32719,
-32717,
-32716,
-32718,
-32713,
-32704,
-32693,
-32672,
-32669,
-32666,
-32663,
-32676,
-32654,
-32672,
-32643,
-32652,
-32641,
-32650,
-32642,
-32665,
-32649,
-32659,
-32656,
-32651,
-32651,
-32664,
-32652,
-32666,
-32669,
-32652,
-32685,
-32647,
+32917,
+32903,
+32946,
+33158,
+33255,
+33315,
+33442,
+33462,
+33397,
+33456,
+33623,
+33684,
+33722,
+33791,
+33748,
+33575,
+33488,
+33483,
+33304,
+33108,
+33031,
+32869,
 32675,
+32648,
 32644,
-32663,
-32644,
-32671,
-32647,
-32679,
-32644,
-32667,
-32651,
-32656,
-32675,
-32674,
-32694,
+32532,
+32470,
+32468,
+32349,
+32207,
+32222,
+32174,
+32008,
+32009,
+32065,
+32003,
+32045,
+32192,
+32212,
+32185,
+32211,
+32123,
+31931,
+31832,
+31728,
+31527,
+31394,
+31287,
+31066,
+30870,
+30737,
+30556,
+30409,
+30355,
+30287,
+30192,
+30146,
+30040,
+29827,
+29698,
+29660,
+29598,
+29576,
+29585,
+29522,
+29527,
+29678,
+29852,
+30014,
+30161,
+30264,
+30443,
+30998,
+31917,
+32723,
+33151,
+33266,
+33081,
+32840,
+33003,
+33532,
+34039,
+34378,
+34542,
+34593,
+34833,
+35454,
+36120,
+36540,
+36832,
+36935,
+36754,
+36619,
+36739,
+36806,
+36698,
+36697,
+36814,
+36897,
+37017,
+37085,
+36886,
+36537,
+36199,
+35796,
+35414,
+35174,
+34860,
+34326,
+33829,
+33510,
+33219,
+32984,
+32920,
+32877,
+32691,
+32479,
+32259,
+31948,
+31685,
+31493,
+31234,
+30997,
+30908,
+30826,
+30721,
+30794,
+30967,
+31017,
+31031,
+31096,
+31048,
+30884,
+30797,
+30740,
+30647,
+30688,
+30871,
+31035,
+31209,
+31425,
+31512,
+31462,
+31467,
+31532,
+31567,
+31677,
+31930,
+32170,
+32361,
+32626,
+32912,
+33118,
+33313,
+33529,
+33682,
+33790,
+33925,
+34057,
+34143,
+34243,
+34382,
+34457,
+34452,
+34429,
+34340,
+34156,
+33978,
+33845,
+33668,
+33420,
+33143,
+32815,
+32430,
+32069,
+31759,
+31456,
+31168,
+30923,
+30696,
+30514,
+30419,
+30377,
+30369,
+30427,
+30534,
+30682,
+30873,
+31077,
+31287,
+31530,
+31812,
+32117,
+32464,
+32831,
+33141,
+33411,
+33698,
+33984,
+34249,
+34518,
+34762,
+34904,
+34994,
+35096,
+35151,
+35151,
+35136,
+35068,
+34924,
+34784,
+34680,
+34558,
+34397,
+34239,
+34075,
+33878,
+33726,
+33661,
+33566,
+33407,
+33253,
+33049,
+32772,
+32539,
+32394,
+32244,
+32078,
+31978,
+31907,
+31819,
+31784,
+31788,
+31718,
+31604,
+31540,
+31471,
+31380,
+31338,
+31286,
+31144,
+31004,
+30952,
+30939,
+30947,
+31016,
+31093,
+31112,
+31126,
+31183,
+31231,
+31247,
+31241,
+31202,
+31150,
+31129,
+31165,
+31227,
+31270,
+31301,
+31312,
+31276,
+31224,
+31201,
+31190,
+31216,
+31377,
+31679,
+31988,
+32215,
+32366,
+32432,
+32439,
+32510,
 32698,
-32682,
-32695,
-32675,
-32696,
-32703,
-32713,
-32716,
-32723,
-32715,
-32718,
-32725,
-32720,
-32757,
-32734,
-32761,
-32748,
-32747,
-32745,
-32750,
-32741,
+32891,
+33069,
+33274,
+33483,
+33726,
+34066,
+34428,
+34709,
+34955,
+35175,
+35305,
+35378,
+35489,
+35602,
+35686,
+35803,
+35946,
+36040,
+36059,
+36019,
+35921,
+35794,
+35659,
+35472,
+35226,
+34947,
+34650,
+34360,
+34117,
+33904,
+33676,
+33435,
+33210,
+33028,
+32895,
+32771,
+32573,
+32324,
+32094,
+31878,
+31721,
+31659,
+31618,
+31535,
+31457,
+31441,
+31475,
+31540,
+31639,
+31713,
+31731,
+31763,
+31835,
+31917,
+32046,
+32216,
+32367,
+32532,
 32764,
-32755,
-32775,
-32763,
-32779,
-32763,
-32763,
-32763,
-32757,
-32765,
-32762,
-32756,
-32747,
-32737,
-32728,
-32726,
-32731,
-32730,
-32745,
-32752,
-32740,
-32768,
-32742,
-32792,
-32777,
-32815,
-32828,
-32825,
-32863,
-32859,
-32899,
-32909,
-32937,
-32944,
-32962,
-32973,
-32993,
-33017,
 33026,
-33043,
-33045,
-33041,
-33066,
-33060,
-33087,
-33093,
-33104,
-33100,
-33115,
-33101,
-33130,
-33131,
-33158,
-33180,
-33177,
-33198,
-33194,
-33207,
-33223,
-33235,
-33261,
-33267,
-33272,
-33270,
-33270,
-33264,
-33272,
-33266,
-33276,
-33268,
-33267,
-33253,
-33244,
-33239,
-33223,
-33236,
-33226,
-33229,
-33232,
-33217,
+33282,
+33540,
+33808,
+34060,
+34302,
+34587,
+34860,
+35068,
+35238,
+35333,
+35333,
+35302,
+35249,
+35162,
+35068,
+34958,
+34828,
+34666,
+34471,
+34246,
+33950,
+33600,
+33231,
+32822,
+32416,
+32059,
+31712,
+31385,
+31082,
+30775,
+30505,
+30293,
+30135,
+30024,
+29924,
+29830,
+29756,
+29703,
+29692,
+29722,
+29737,
+29756,
+29820,
+29938,
+30129,
+30335,
+30487,
+30571,
+30574,
+30564,
+30627,
+30697,
+30736,
+30748,
+30676,
+30557,
+30511,
+30504,
+30415,
+30260,
+30143,
+30133,
+30354,
+30936,
+31650,
+32105,
+32261,
+32225,
+32026,
+31955,
+32253,
+32667,
+32969,
+33278,
+33622,
+33931,
+34392,
+35040,
+35523,
+35761,
+35984,
+36131,
+36112,
+36168,
+36318,
+36299,
+36255,
+36429,
+36628,
+36702,
+36771,
+36732,
+36427,
+36091,
+35887,
+35625,
+35283,
+35018,
+34719,
+34326,
+34056,
+33909,
+33679,
+33423,
+33255,
+33058,
+32801,
+32594,
+32379,
+32055,
+31720,
+31459,
+31200,
+30948,
+30777,
+30605,
+30407,
+30294,
+30258,
+30218,
+30178,
+30125,
+30007,
+29868,
+29788,
+29790,
+29868,
+30024,
+30251,
+30525,
+30846,
+31199,
+31539,
+31866,
+32178,
+32480,
+32821,
+33222,
+33659,
+34108,
+34542,
+34900,
+35165,
+35378,
+35539,
+35631,
+35682,
+35703,
+35681,
+35651,
+35647,
+35619,
+35537,
+35416,
+35216,
+34945,
+34663,
+34378,
+34099,
+33828,
+33590,
+33399,
 33230,
-33201,
-33227,
-33204,
+33122,
+33056,
+32963,
+32842,
+32723,
+32601,
+32487,
+32423,
+32375,
+32328,
+32309,
+32328,
+32378,
+32409,
+32428,
+32424,
+32361,
+32302,
+32306,
+32310,
+32306,
+32314,
+32258,
+32144,
+32067,
+32020,
+31961,
+31917,
+31906,
+31889,
+31893,
+31971,
+32058,
+32052,
+32009,
+31969,
+31896,
+31895,
+32008,
+32105,
+32128,
+32135,
+32100,
+32014,
+31978,
+31971,
+31908,
+31806,
+31741,
+31690,
+31619,
+31598,
+31600,
+31551,
+31517,
+31559,
+31623,
+31690,
+31785,
+31851,
+31866,
+31892,
+31951,
+32018,
+32066,
+32116,
+32151,
+32164,
+32209,
+32291,
+32366,
+32416,
+32469,
+32502,
+32502,
+32500,
+32475,
+32411,
+32308,
+32214,
+32139,
+32078,
+32048,
+32010,
+31945,
+31858,
+31793,
+31768,
+31799,
+31882,
+31983,
+32097,
+32206,
+32314,
+32405,
+32467,
+32474,
+32458,
+32492,
+32580,
+32759,
+33040,
+33344,
+33540,
+33623,
+33612,
+33476,
+33323,
 33242,
-33224,
-33264,
-33233,
-33271,
-33237,
-33279,
-33264,
-33283,
-33278,
-33288,
-33285,
-33274,
-33276,
-33263,
-33253,
-33270,
-33235,
-33264,
-33245,
-33236,
-33241,
-33214,
-33216,
-33212,
-33196,
-33211,
-33202,
-33213,
-33188,
-33204,
-33169,
-33209,
-33187,
-33217,
-33214,
-33209,
-33215,
-33189,
-33203,
-33201,
-33211,
-33217,
-33214,
-33201,
-33195,
-33179,
-33171,
-33172,
-33170,
-33168,
-33161,
-33157,
-33139,
-33147,
-33133,
-33149,
-33143,
-33149,
-33155,
-33146,
-33162,
-33161,
-33182,
-33186,
-33196,
-33209,
-33209,
-33224,
-33221,
-33226,
-33229,
-33235,
-33240,
-33248,
-33237,
-33253,
-33223,
+33185,
+33123,
+33151,
 33244,
-33224,
-33238,
-33229,
-33224,
-33216,
-33198,
-33196,
-33189,
-33187,
-33172,
-33178,
-33141,
-33160,
-33124,
+33337,
+33515,
+33752,
+33919,
+34023,
+34153,
+34224,
+34192,
+34225,
+34303,
+34343,
+34457,
+34689,
+34887,
+35030,
+35195,
+35261,
+35205,
+35176,
+35175,
+35106,
+35052,
+35071,
+35004,
+34882,
+34805,
+34702,
+34510,
+34365,
+34276,
+34120,
+33974,
+33865,
+33697,
+33464,
+33297,
+33156,
+32984,
+32879,
+32822,
+32739,
+32655,
+32648,
+32633,
+32585,
+32590,
+32616,
+32617,
+32652,
+32758,
+32839,
+32913,
+33029,
 33138,
-33121,
-33116,
-33111,
-33089,
-33089,
-33080,
-33070,
-33057,
+33211,
+33296,
+33380,
+33371,
+33327,
+33269,
+33166,
 33049,
-33034,
-33015,
-33008,
-32977,
+32987,
+32958,
+32923,
+32947,
 32976,
-32955,
-32942,
-32921,
-32899,
-32889,
-32872,
-32868,
-32833,
-32837,
-32805,
-32789,
-32785,
-32752,
-32768,
-32720,
-32736,
-32687,
-32708,
-32665,
-32685,
-32644,
-32660,
-32628,
-32628,
-32616,
-32605,
-32594,
-32583,
-32569,
-32558,
-32553,
-32531,
-32526,
-32510,
-32493,
-32476,
-32466,
-32440,
-32440,
+32951,
+32894,
+32811,
+32642,
 32412,
-32411,
-32372,
-32376,
-32336,
-32335,
-32322,
-32304,
-32283,
-32286,
-32247,
-32259,
-32231,
-32246,
-32226,
-32226,
-32209,
-32191,
-32203,
-32183,
-32194,
-32172,
-32173,
-32143,
-32161,
-32132,
-32145,
-32126,
-32107,
-32104,
-32077,
-32069,
-32064,
-32060,
-32047,
-32058,
-32026,
-32026,
-32026,
-32029,
-32047,
-32060,
-32061,
-32068,
-32061,
-32080,
-32080,
+32199,
+31953,
+31700,
+31503,
+31339,
+31127,
+30917,
+30730,
+30474,
+30215,
+30000,
+29783,
+29548,
+29378,
+29245,
+29085,
+28992,
+28957,
+28910,
+28889,
+28950,
+28989,
+29013,
+29092,
+29154,
+29201,
+29288,
+29443,
+29606,
+29815,
+30098,
+30364,
+30629,
+30912,
+31151,
+31318,
+31467,
+31581,
+31674,
+31856,
 32122,
-32127,
-32144,
-32151,
-32160,
-32163,
-32173,
-32193,
-32210,
-32197,
-32224,
-32191,
-32214,
-32213,
-32212,
-32225,
-32224,
-32216,
-32226,
-32220,
-32224,
-32247,
-32237,
-32249,
-32251,
-32245,
-32267,
-32276,
-32283,
-32309,
-32302,
-32307,
-32315,
-32311,
-32342,
-32334,
-32346,
-32344,
-32336,
-32340,
-32336,
-32343,
-32349,
-32352,
-32356,
-32356,
-32357,
-32354,
-32367,
-32378,
-32407,
-32396,
-32426,
-32420,
-32443,
-32464,
-32473,
-32507,
-32516,
-32537,
-32554,
-32560,
-32582,
-32594,
-32620,
-32630,
-32643,
-32636,
-32661,
-32637,
-32689,
-32662,
-32709,
-32692,
-32710,
-32713,
-32717,
-32748,
-32753,
-32776,
+32431,
+32802,
+33164,
+33386,
+33513,
+33579,
+33549,
+33532,
+33610,
+33717,
+33856,
+34108,
+34394,
+34650,
+34962,
+35282,
+35496,
+35687,
+35905,
+36027,
+36090,
+36239,
+36372,
+36440,
+36597,
+36771,
+36817,
+36820,
+36808,
+36650,
+36423,
+36257,
+36044,
+35756,
+35519,
+35287,
+34948,
+34636,
+34387,
+34074,
+33759,
+33528,
+33290,
+32998,
+32778,
+32577,
+32313,
+32101,
+31964,
+31808,
+31672,
+31614,
+31534,
+31428,
+31390,
+31402,
+31384,
+31400,
+31481,
+31505,
+31511,
+31571,
+31610,
+31622,
+31686,
+31792,
+31876,
+31994,
+32156,
+32282,
+32368,
+32482,
+32589,
+32652,
+32774,
+32940,
+33094,
+33277,
+33513,
+33728,
+33911,
+34111,
+34270,
+34370,
+34449,
+34529,
+34568,
+34581,
+34623,
+34651,
+34645,
+34649,
+34648,
+34584,
+34490,
+34384,
+34244,
+34081,
+33929,
+33778,
+33596,
+33412,
+33256,
+33082,
+32898,
+32744,
+32581,
+32402,
+32262,
+32165,
+32079,
+32013,
+31968,
+31923,
+31870,
+31842,
+31840,
+31834,
+31839,
+31851,
+31843,
+31820,
+31807,
+31800,
+31786,
+31790,
+31820,
+31860,
+31899,
+31931,
+31932,
+31877,
+31798,
+31734,
+31673,
+31641,
+31650,
+31659,
+31650,
+31637,
+31614,
+31531,
+31432,
+31343,
+31215,
+31082,
+30992,
+30901,
+30785,
+30703,
+30621,
+30496,
+30394,
+30343,
+30311,
+30308,
+30375,
+30444,
+30463,
+30495,
+30539,
+30571,
+30632,
+30776,
+30931,
+31070,
+31258,
+31432,
+31560,
+31686,
+31834,
+31968,
+32108,
+32323,
+32531,
+32673,
 32789,
-32787,
-32810,
-32809,
-32828,
-32865,
-32860,
-32899,
-32879,
-32914,
-32903,
-32938,
-32939,
-32958,
-32960,
-32971,
-32968,
-32982,
-32975,
-32997,
-33003,
-33002,
-33017,
-33002,
-33025,
-33036,
-33050,
-33065,
-33076,
+32868,
+32857,
+32836,
+32870,
+32898,
+32930,
+33018,
+33119,
+33141,
+33148,
+33167,
+33104,
+33033,
+33042,
+33069,
 33083,
-33090,
-33118,
-33121,
-33156,
-33159,
-33172,
-33193,
-33192,
-33224,
-33219,
-33259,
-33251,
-33262,
-33280,
-33267,
-33296,
-33291,
-33311,
-33304,
-33305,
-33314,
-33302,
-33329,
-33325,
-33337,
-33340,
-33339,
-33334,
-33343,
-33349,
-33352,
-33368,
-33344,
-33354,
-33337,
-33337,
-33340,
-33338,
-33329,
-33320,
-33292,
-33293,
-33262,
-33276,
-33255,
-33260,
-33237,
-33225,
 33195,
-33189,
-33161,
-33174,
-33153,
-33152,
-33136,
-33119,
-33111,
-33105,
-33095,
-33098,
-33087,
-33081,
-33077,
-33065,
-33052,
-33036,
-33036,
-33022,
-33019,
-33014,
-32986,
-32998,
-32949,
-32976,
-32925,
-32952,
-32921,
-32937,
-32912,
-32911,
-32900,
-32893,
+33377,
+33516,
+33716,
+33982,
+34178,
+34340,
+34556,
+34726,
+34830,
+35025,
+35259,
+35434,
+35673,
+35967,
+36159,
+36297,
+36450,
+36474,
+36416,
+36423,
+36400,
+36302,
+36265,
+36247,
+36104,
+35963,
+35848,
+35613,
+35358,
+35164,
+34931,
+34661,
+34480,
+34296,
+34032,
+33833,
+33665,
+33416,
+33186,
+33033,
+32815,
+32593,
+32499,
+32402,
+32290,
+32261,
+32253,
+32153,
+32067,
+32035,
+31922,
+31822,
+31829,
+31836,
+31841,
+31956,
+32087,
+32143,
+32204,
+32258,
+32243,
+32212,
+32258,
+32305,
+32340,
+32447,
+32577,
+32672,
+32764,
+32867,
 32888,
-32895,
-32871,
-32885,
-32862,
-32861,
-32858,
-32850,
-32841,
-32843,
-32822,
-32817,
+32872,
+32879,
+32863,
+32827,
 32798,
-32790,
-32782,
-32779,
-32763,
-32745,
-32735,
-32702,
-32713,
-32694,
-32706,
-32677,
-32693,
-32648,
-32651,
-32634,
-32649,
-32647,
-32655,
-32646,
-32638,
-32634,
-32631,
-32628,
-32642,
-32646,
-32634,
-32642,
-32611,
-32624,
-32608,
-32624,
-32610,
-32623,
-32609,
-32607,
-32617,
-32605,
-32621,
-32618,
-32618,
+32776,
+32720,
+32667,
 32629,
-32642,
-32646,
-32677,
-32665,
-32692,
-32680,
-32708,
-32715,
-32738,
-32766,
-32760,
-32789,
-32774,
-32797,
-32795,
-32821,
-32832,
-32837,
-32848,
-32828,
-32841,
+32572,
+32483,
+32378,
+32263,
+32116,
+31978,
+31842,
+31688,
+31520,
+31342,
+31174,
+31004,
+30858,
+30731,
+30604,
+30478,
+30369,
+30282,
+30197,
+30113,
+30024,
+29944,
+29886,
+29879,
+29934,
+30020,
+30134,
+30245,
+30338,
+30414,
+30467,
+30504,
+30516,
+30511,
+30531,
+30594,
+30685,
+30810,
+30931,
+31024,
+31084,
+31143,
+31213,
+31276,
+31352,
+31423,
+31478,
+31525,
+31597,
+31684,
+31759,
+31853,
+31970,
+32072,
+32175,
+32309,
+32426,
+32510,
+32614,
+32725,
 32829,
-32855,
-32848,
-32871,
-32864,
-32866,
-32854,
-32872,
-32858,
-32896,
-32881,
-32899,
-32897,
-32895,
-32901,
-32915,
-32911,
-32931,
-32914,
-32929,
-32925,
-32929,
-32935,
-32939,
-32929,
-32937,
-32921,
-32927,
-32924,
-32937,
-32933,
-32927,
-32938,
-32912,
-32938,
-32924,
-32948,
-32955,
-32961,
 32974,
-32960,
-32979,
-32967,
-33005,
-33000,
-33034,
-33005,
-33037,
-33004,
-33028,
-33030,
-33012,
-33056,
-33025,
-33037,
-33029,
-33013,
+33195,
+33425,
+33635,
+33850,
+34010,
+34088,
+34177,
+34298,
+34383,
+34499,
+34680,
+34833,
+34968,
+35132,
+35265,
+35308,
+35354,
+35417,
+35424,
+35445,
+35522,
+35562,
+35559,
+35592,
+35597,
+35523,
+35455,
+35388,
+35238,
+35081,
+34969,
+34804,
+34615,
+34482,
+34341,
+34155,
+34007,
+33875,
+33688,
+33524,
+33426,
+33313,
+33210,
+33177,
+33126,
+33043,
+32996,
+32951,
+32870,
+32836,
+32865,
+32879,
+32922,
 33021,
-33018,
-33020,
+33097,
+33141,
+33216,
+33265,
+33273,
+33330,
+33414,
+33483,
+33580,
+33708,
+33800,
+33897,
+34031,
+34138,
+34230,
+34357,
+34480,
+34549,
+34608,
+34646,
+34612,
+34572,
+34547,
+34492,
+34433,
+34409,
+34367,
+34289,
+34217,
+34112,
+33955,
+33794,
+33627,
+33423,
+33218,
 33030,
-33016,
-33027,
-33015,
+32822,
+32610,
+32395,
+32136,
+31848,
+31565,
+31276,
+30984,
+30728,
+30496,
+30274,
+30087,
+29924,
+29761,
+29611,
+29483,
+29363,
+29268,
+29199,
+29130,
+29068,
+29034,
+29025,
+29041,
+29095,
+29174,
+29271,
+29385,
+29507,
+29619,
+29721,
+29812,
+29891,
+29990,
+30123,
+30296,
+30500,
+30720,
+30934,
+31129,
+31314,
+31487,
+31651,
+31808,
+31951,
+32090,
+32225,
+32344,
+32459,
+32555,
+32616,
+32670,
+32736,
+32811,
+32900,
 33012,
-33011,
-32999,
-33014,
-33013,
+33123,
+33210,
+33287,
+33352,
+33374,
+33380,
+33388,
+33383,
+33372,
+33402,
+33460,
+33515,
+33594,
+33667,
+33710,
+33730,
+33752,
+33778,
+33793,
+33809,
+33811,
+33808,
+33805,
+33816,
+33829,
+33830,
+33827,
+33811,
+33791,
+33763,
+33732,
+33703,
+33688,
+33707,
+33759,
+33841,
+33950,
+34088,
+34211,
+34299,
+34380,
+34448,
+34504,
+34585,
+34700,
+34805,
+34916,
+35053,
+35168,
+35258,
+35353,
+35449,
+35521,
+35611,
+35709,
+35756,
+35784,
+35808,
+35785,
+35714,
+35661,
+35593,
+35478,
+35375,
+35277,
+35135,
+34969,
+34815,
+34621,
+34391,
+34175,
+33964,
+33738,
+33515,
+33310,
+33099,
+32907,
+32744,
+32583,
+32420,
+32270,
+32134,
+31981,
+31853,
+31749,
+31641,
+31550,
+31473,
+31382,
+31259,
+31154,
+31062,
+30975,
+30928,
+30919,
+30915,
+30910,
+30931,
+30923,
+30870,
+30814,
+30766,
+30711,
+30693,
+30746,
+30817,
+30884,
+30962,
+31032,
+31063,
+31089,
+31135,
+31180,
+31234,
+31317,
+31420,
+31521,
+31628,
+31724,
+31781,
+31806,
+31809,
+31809,
+31825,
+31846,
+31843,
+31826,
+31812,
+31784,
+31729,
+31665,
+31580,
+31461,
+31368,
+31309,
+31233,
+31141,
+31085,
+31062,
+30997,
+30893,
+30810,
+30743,
+30674,
+30647,
+30667,
+30663,
+30650,
+30745,
+30939,
+31052,
+31052,
+31068,
+31128,
+31187,
+31267,
+31400,
+31489,
+31513,
+31623,
+31871,
+32073,
+32128,
+32216,
+32405,
+32586,
+32778,
+33076,
+33332,
+33428,
+33558,
+33797,
+33985,
+34096,
+34274,
+34464,
+34613,
+34830,
+35085,
+35273,
+35382,
+35470,
+35520,
+35582,
+35676,
+35713,
+35703,
+35719,
+35776,
+35816,
+35888,
+35968,
+35975,
+35903,
+35811,
+35730,
+35595,
+35423,
+35270,
+35171,
+35068,
+34965,
+34925,
+34878,
+34738,
+34563,
+34460,
+34370,
+34273,
+34215,
+34180,
+34101,
+34001,
+33942,
+33889,
+33829,
+33778,
+33736,
+33687,
+33645,
+33595,
+33518,
+33435,
+33366,
+33314,
+33291,
+33312,
+33333,
+33300,
+33211,
+33091,
+32935,
+32770,
+32631,
+32529,
+32456,
+32408,
+32393,
+32375,
+32333,
+32244,
+32123,
+32019,
+31938,
+31882,
+31862,
+31854,
+31822,
+31786,
+31762,
+31740,
+31667,
+31588,
+31539,
+31482,
+31434,
+31425,
+31435,
+31398,
+31350,
+31336,
+31305,
+31224,
+31151,
+31089,
+30945,
+30785,
+30707,
+30674,
+30627,
+30566,
+30489,
+30354,
+30181,
+30025,
+29871,
+29696,
+29537,
+29453,
+29501,
+29645,
+29747,
+29778,
+29757,
+29682,
+29567,
+29519,
+29567,
+29578,
+29618,
+29822,
+30100,
+30330,
+30522,
+30668,
+30722,
+30764,
+30940,
+31236,
+31506,
+31756,
+32034,
+32307,
+32534,
+32732,
+32900,
+32993,
+33096,
+33335,
+33689,
+34031,
+34305,
+34494,
+34590,
+34640,
+34691,
+34713,
+34691,
+34693,
+34758,
+34913,
+35089,
+35225,
+35287,
+35245,
+35170,
+35140,
+35136,
+35098,
+35099,
+35129,
+35153,
+35219,
+35309,
+35317,
+35208,
+35086,
+34998,
+34956,
+34989,
+35069,
+35113,
+35142,
+35173,
+35193,
+35163,
+35052,
+34894,
+34744,
+34708,
+34787,
+34907,
+34962,
+34939,
+34869,
+34761,
+34694,
+34592,
+34474,
+34392,
+34320,
+34343,
+34419,
+34364,
+34188,
+34008,
+33801,
+33642,
+33622,
+33637,
+33601,
+33588,
+33615,
+33588,
+33533,
+33433,
+33263,
+33131,
+33092,
+33116,
+33157,
+33174,
+33123,
 33010,
-33005,
-32999,
-32989,
-32981,
-32981,
-32975,
-32972,
-32961,
-32951,
-32938,
-32919,
-32912,
-32886,
-32895,
-32870,
-32876,
-32860,
-32845,
-32848,
-32817,
-32848,
-32807,
-32841,
-32809,
-32822,
-32811,
-32813,
-32814,
+32883,
+32770,
+32637,
+32494,
+32415,
+32357,
+32293,
+32249,
+32148,
+31971,
+31792,
+31607,
+31446,
+31332,
+31243,
+31150,
+31033,
+30904,
+30707,
+30459,
+30221,
+30022,
+29867,
+29778,
+29799,
+29824,
+29803,
+29770,
+29695,
+29579,
+29453,
+29368,
+29355,
+29409,
+29530,
+29697,
+29847,
+29908,
+29904,
+29911,
+29943,
+30025,
+30175,
+30370,
+30592,
+30814,
+30999,
+31140,
+31235,
+31251,
+31261,
+31404,
+31633,
+31853,
+32105,
+32381,
+32531,
+32591,
+32699,
+32764,
+32766,
 32800,
-32804,
-32798,
-32795,
-32805,
-32783,
-32801,
-32775,
-32774,
-32761,
-32747,
-32752,
-32728,
-32747,
-32707,
-32716,
-32677,
+32901,
+33071,
+33243,
+33390,
+33533,
+33656,
+33689,
+33670,
+33725,
+33767,
+33749,
+33764,
+33854,
+33963,
+33997,
+34022,
+34075,
+34084,
+33998,
+33875,
+33861,
+33842,
+33783,
+33835,
+33909,
+33949,
+33927,
+33842,
+33832,
+33816,
+33691,
+33616,
+33708,
+33788,
+33848,
+33966,
+34017,
+33997,
+33932,
+33872,
+33931,
+33969,
+33952,
+34026,
+34115,
+34208,
+34265,
+34189,
+34124,
+34077,
+33987,
+33984,
+34128,
+34210,
+34240,
+34327,
+34393,
+34431,
+34402,
+34323,
+34289,
+34288,
+34296,
+34354,
+34422,
+34445,
+34421,
+34364,
+34353,
+34326,
+34228,
+34123,
+34059,
+33991,
+33896,
+33841,
+33783,
+33703,
+33618,
+33541,
+33481,
+33394,
+33244,
+33040,
+32856,
 32674,
-32660,
-32663,
-32651,
-32642,
-32638,
-32599,
-32609,
-32555,
-32578,
-32550,
-32540,
-32534,
-32503,
-32479,
-32468,
-32430,
-32431,
-32395,
-32395,
-32355,
-32351,
-32310,
-32289,
-32267,
-32243,
-32237,
-32212,
-32194,
-32170,
-32144,
-32135,
-32126,
-32115,
-32105,
-32110,
-32080,
-32097,
-32051,
-32081,
-32056,
-32081,
-32053,
-32060,
-32047,
-32031,
-32045,
-32026,
-32046,
-32037,
-32022,
-32032,
-31999,
+32487,
+32350,
+32229,
+32129,
 32020,
-32005,
-32019,
-32019,
-32016,
-32015,
-31998,
-32019,
-32002,
-32035,
-32025,
-32039,
-32040,
-32023,
-32046,
-32043,
-32065,
-32056,
-32065,
-32050,
-32055,
-32063,
-32059,
-32070,
-32067,
-32070,
-32074,
-32067,
-32093,
-32067,
-32104,
-32095,
-32084,
-32110,
-32090,
-32115,
-32126,
-32138,
-32144,
-32152,
-32162,
-32163,
-32186,
-32212,
-32206,
-32243,
-32225,
-32235,
-32245,
-32245,
-32270,
-32283,
-32276,
-32297,
-32274,
-32306,
-32293,
-32321,
-32324,
-32329,
-32342,
-32346,
-32345,
-32373,
-32365,
-32395,
-32389,
-32413,
-32417,
-32447,
-32437,
-32482,
-32466,
-32511,
-32499,
-32535,
-32530,
-32561,
-32554,
-32583,
-32575,
-32601,
-32606,
-32624,
-32640,
-32644,
-32664,
-32663,
-32677,
-32697,
-32694,
-32729,
-32729,
-32742,
-32762,
-32772,
-32802,
-32816,
-32849,
-32858,
-32883,
-32895,
-32909,
-32940,
-32965,
-32976,
-33008,
-33001,
-33025,
-33038,
-33049,
-33087,
-33093,
-33127,
-33116,
-33144,
-33146,
-33177,
-33201,
-33217,
-33242,
-33245,
-33273,
-33270,
-33317,
-33319,
-33372,
-33369,
-33405,
-33406,
-33437,
-33444,
-33473,
-33490,
-33505,
-33504,
-33524,
-33523,
-33540,
-33555,
-33562,
-33586,
-33565,
-33593,
-33573,
-33598,
-33598,
-33608,
-33608,
-33612,
-33597,
-33603,
-33598,
-33607,
-33618,
-33612,
-33620,
-33604,
-33601,
-33601,
-33599,
-33605,
-33597,
-33588,
-33579,
-33553,
-33555,
-33539,
-33527,
-33534,
-33513,
-33508,
-33492,
-33480,
-33476,
-33471,
-33454,
-33452,
-33435,
-33418,
-33414,
-33403,
-33389,
-33381,
-33369,
-33355,
-33345,
-33364,
-33324,
-33358,
-33308,
-33319,
-33282,
-33279,
-33264,
-33259,
-33246,
-33227,
-33204,
-33196,
-33165,
-33176,
-33142,
-33170,
-33118,
-33132,
-33093,
-33075,
-33063,
-33046,
-33042,
-33027,
-33005,
-32982,
-32964,
-32952,
-32947,
-32942,
-32927,
-32914,
-32894,
-32879,
-32863,
-32848,
-32840,
-32830,
-32807,
-32789,
-32784,
-32754,
-32770,
-32743,
-32749,
-32731,
-32727,
-32703,
-32715,
-32685,
-32698,
-32668,
-32669,
-32646,
-32645,
-32640,
-32636,
-32632,
-32630,
-32625,
-32619,
-32618,
-32616,
-32615,
-32606,
-32605,
-32595,
-32596,
-32588,
-32593,
+31903,
+31833,
+31724,
+31575,
+31446,
+31327,
+31254,
+31198,
+31144,
+31132,
+31108,
+31043,
+30996,
+30951,
+30894,
+30841,
+30824,
+30842,
+30875,
+30922,
+30973,
+31020,
+31031,
+31027,
+31011,
+31036,
+31084,
+31137,
+31249,
+31344,
+31433,
+31495,
+31545,
+31594,
+31597,
+31619,
+31684,
+31773,
+31834,
+31894,
+31941,
+31961,
+31971,
+31966,
+32007,
+32027,
+32022,
+32056,
+32068,
+32052,
+32029,
+31938,
+31898,
+31921,
+31892,
+31930,
+31976,
+31969,
+31939,
+31893,
+31884,
+31870,
+31842,
+31864,
+31955,
+32054,
+32162,
+32241,
+32295,
+32349,
+32322,
+32333,
+32409,
+32445,
+32517,
 32590,
-32601,
-32596,
-32598,
-32613,
-32603,
-32626,
-32609,
-32647,
-32614,
-32647,
-32626,
-32643,
-32651,
-32657,
-32658,
-32683,
-32683,
-32704,
-32711,
-32732,
-32731,
-32765,
-32751,
+32664,
+32768,
+32779,
 32786,
-32772,
-32804,
-32799,
-32829,
-32828,
-32852,
-32859,
-32883,
-32894,
-32918,
-32924,
-32944,
-32944,
-32961,
-32977,
-32981,
-32999,
-33008,
-33005,
-33022,
-33019,
-33039,
-33050,
-33069,
-33063,
-33082,
-33056,
-33080,
-33070,
-33084,
-33105,
-33082,
-33097,
-33067,
-33073,
-33080,
-33081,
-33106,
-33095,
-33096,
-33080,
-33059,
-33072,
-33050,
-33092,
-33063,
-33084,
-33042,
-33039,
-33018,
-33032,
+32841,
+32863,
+32923,
+33029,
+33143,
+33279,
+33373,
+33432,
+33529,
+33585,
+33610,
+33693,
+33806,
+33912,
+34016,
+34102,
+34139,
+34184,
+34191,
+34196,
+34280,
+34356,
+34457,
+34613,
+34776,
+34892,
+34971,
+34993,
+34963,
+34929,
+34837,
+34763,
+34728,
+34672,
+34618,
+34612,
+34582,
+34509,
+34439,
+34313,
+34220,
+34137,
+34043,
+34012,
+34012,
+33981,
+33942,
+33931,
+33876,
+33832,
+33800,
+33780,
+33821,
+33851,
+33849,
+33857,
+33816,
+33701,
+33606,
+33496,
+33414,
+33360,
+33292,
+33262,
+33213,
+33133,
 33034,
-33042,
-33044,
-33010,
-33012,
-32980,
-32997,
-32977,
-33007,
-32981,
-32996,
-32965,
-32966,
-32950,
-32976,
-32955,
+32951,
+32858,
+32760,
+32693,
+32622,
+32534,
+32428,
+32299,
+32164,
+32048,
+31910,
+31816,
+31749,
+31668,
+31613,
+31562,
+31509,
+31438,
+31376,
+31300,
+31233,
+31170,
+31094,
+31049,
+31007,
+30963,
+30943,
+30938,
+30917,
+30913,
+30918,
+30934,
+30985,
+31049,
+31132,
+31242,
+31326,
+31384,
+31455,
+31479,
+31500,
+31548,
+31603,
+31690,
+31789,
+31860,
+31940,
+31972,
+31938,
+31926,
+31889,
+31871,
+31889,
+31911,
+31938,
+31960,
+31931,
+31877,
+31813,
+31706,
+31648,
+31608,
+31585,
+31612,
+31631,
+31641,
+31663,
+31651,
+31648,
+31684,
+31718,
+31808,
+31924,
+32048,
+32182,
+32309,
+32415,
+32515,
+32607,
+32690,
+32804,
+32908,
+33023,
+33165,
+33302,
+33434,
+33569,
+33688,
+33792,
+33894,
+33976,
+34064,
+34161,
+34230,
+34301,
+34375,
+34411,
+34436,
+34437,
+34419,
+34426,
+34412,
+34405,
+34437,
+34456,
+34476,
+34496,
+34487,
+34470,
+34425,
+34369,
+34329,
+34284,
+34237,
+34195,
+34161,
+34119,
+34087,
+34058,
+34029,
+34033,
+34016,
+33993,
+33984,
+33933,
+33887,
+33840,
+33765,
+33745,
+33718,
+33686,
+33693,
+33662,
+33624,
+33573,
+33510,
+33468,
+33456,
+33454,
+33471,
+33521,
+33531,
+33516,
+33490,
+33420,
+33357,
+33309,
+33259,
+33274,
+33293,
+33283,
+33285,
+33231,
+33158,
+33076,
 32983,
-32959,
-32957,
-32950,
-32938,
-32955,
-32934,
-32953,
-32931,
-32938,
-32932,
-32926,
-32934,
-32931,
-32920,
-32922,
-32907,
-32917,
-32905,
-32911,
-32904,
+32929,
+32906,
 32899,
-32889,
+32903,
+32916,
 32881,
-32876,
-32884,
-32890,
-32886,
-32895,
-32870,
-32871,
-32864,
-32862,
-32884,
-32871,
-32880,
-32864,
-32858,
-32845,
-32852,
-32851,
-32869,
-32849,
-32866,
-32845,
-32833,
-32840,
-32813,
-32844,
-32818,
-32827,
-32808,
-32806,
-32787,
-32794,
-32773,
-32796,
-32769,
-32784,
-32763,
-32744,
-32750,
-32720,
-32725,
-32702,
-32702,
-32681,
-32664,
-32647,
-32626,
-32620,
-32586,
-32582,
-32548,
-32540,
-32505,
-32495,
-32450,
-32436,
-32407,
-32376,
-32366,
-32329,
-32315,
-32276,
-32262,
-32218,
-32202,
-32183,
-32149,
-32142,
-32107,
-32087,
-32050,
-32029,
-32000,
-31995,
-31969,
-31967,
-31931,
-31925,
-31893,
-31886,
-31869,
-31864,
-31854,
-31843,
-31828,
-31809,
-31793,
-31787,
-31787,
-31779,
-31797,
+32814,
+32729,
+32625,
+32531,
+32454,
+32393,
+32360,
+32334,
+32281,
+32228,
+32146,
+32067,
+31993,
+31937,
+31917,
+31894,
+31884,
+31850,
+31792,
+31704,
+31582,
+31472,
+31385,
+31319,
+31286,
+31261,
+31231,
+31200,
+31131,
+31062,
+30994,
+30935,
+30924,
+30942,
+30974,
+31021,
+31046,
+31045,
+31055,
+31044,
+31063,
+31123,
+31196,
+31313,
+31409,
+31484,
+31566,
+31608,
+31654,
+31712,
 31777,
-31791,
-31761,
-31771,
-31770,
+31891,
+31999,
+32121,
+32243,
+32329,
+32400,
+32448,
+32509,
+32580,
+32662,
+32757,
+32856,
+32932,
+32990,
+33024,
+33037,
+33055,
+33057,
+33082,
+33123,
+33150,
+33177,
+33195,
+33182,
+33168,
+33131,
+33091,
+33088,
+33064,
+33062,
+33064,
+33043,
+33029,
+33002,
+32967,
+32948,
+32932,
+32919,
+32939,
+32946,
+32949,
+32970,
+32967,
+32979,
+33001,
+33003,
+33043,
+33089,
+33117,
+33170,
+33190,
+33204,
+33224,
+33213,
+33232,
+33257,
+33308,
+33394,
+33466,
+33552,
+33602,
+33637,
+33655,
+33646,
+33658,
+33662,
+33692,
+33744,
+33779,
+33808,
+33823,
+33796,
+33774,
+33750,
+33735,
+33760,
+33780,
+33805,
+33821,
+33821,
+33798,
+33763,
+33718,
+33690,
+33687,
+33668,
+33678,
+33681,
+33673,
+33649,
+33584,
+33527,
+33477,
+33415,
+33373,
+33328,
+33263,
+33209,
+33117,
+33028,
+32934,
+32815,
+32736,
+32655,
+32569,
+32488,
+32393,
+32309,
+32224,
+32112,
+32016,
+31924,
+31840,
 31772,
-31788,
-31788,
-31786,
-31797,
-31773,
-31794,
-31790,
-31804,
-31824,
-31816,
-31829,
-31827,
-31828,
-31847,
-31855,
-31870,
-31870,
-31893,
-31870,
-31911,
-31882,
-31932,
-31927,
-31936,
-31968,
-31937,
-31973,
-31972,
-31986,
-32021,
-32008,
-32036,
-32018,
-32040,
-32048,
-32065,
-32087,
-32097,
-32101,
-32106,
-32107,
-32123,
-32129,
-32170,
-32152,
-32195,
-32163,
-32189,
-32182,
-32198,
-32216,
+31692,
+31622,
+31538,
+31471,
+31421,
+31381,
+31374,
+31373,
+31409,
+31451,
+31479,
+31531,
+31567,
+31615,
+31683,
+31732,
+31818,
+31898,
+31966,
+32043,
+32079,
+32126,
+32164,
+32183,
 32229,
-32246,
-32233,
-32247,
-32236,
-32256,
-32257,
-32293,
-32282,
-32305,
-32294,
-32293,
-32314,
-32296,
-32334,
-32330,
-32358,
-32348,
-32359,
-32354,
-32362,
-32359,
-32395,
-32381,
-32424,
-32406,
+32266,
+32327,
 32416,
-32411,
-32435,
-32424,
-32475,
-32455,
-32490,
-32476,
-32494,
-32499,
-32508,
-32516,
-32543,
-32555,
-32571,
-32596,
-32581,
-32615,
-32616,
-32652,
-32644,
-32697,
-32676,
-32719,
+32495,
+32583,
+32640,
+32675,
+32705,
 32716,
-32732,
-32767,
-32766,
-32805,
-32818,
-32840,
-32866,
-32869,
-32904,
-32919,
-32943,
-32968,
-32974,
-33018,
-33010,
-33066,
-33050,
+32717,
+32725,
+32740,
+32761,
+32791,
+32798,
+32798,
+32780,
+32739,
+32706,
+32678,
+32661,
+32678,
+32700,
+32718,
+32746,
+32740,
+32733,
+32714,
+32687,
+32678,
+32669,
+32672,
+32683,
+32710,
+32718,
+32718,
+32703,
+32668,
+32667,
+32653,
+32646,
+32657,
+32654,
+32659,
+32667,
+32659,
+32656,
+32662,
+32655,
+32681,
+32690,
+32692,
+32718,
+32718,
+32740,
+32752,
+32744,
+32763,
+32770,
+32761,
+32762,
+32736,
+32730,
+32746,
+32762,
+32807,
+32853,
+32912,
+32961,
+33013,
+33045,
+33068,
+33102,
 33111,
-33108,
-33147,
-33156,
-33180,
-33200,
-33226,
-33249,
+33157,
+33192,
+33221,
+33268,
+33268,
 33270,
-33284,
-33298,
-33314,
-33324,
-33347,
-33352,
-33391,
-33388,
-33419,
-33414,
-33424,
-33441,
-33449,
-33466,
-33483,
-33483,
-33497,
-33481,
-33492,
-33499,
-33508,
-33529,
-33535,
-33528,
-33542,
-33527,
-33541,
-33543,
-33550,
-33566,
-33550,
-33567,
-33526,
-33558,
-33529,
-33551,
-33551,
-33550,
-33554,
-33536,
-33549,
-33521,
-33557,
-33517,
-33549,
-33518,
-33528,
-33516,
-33510,
-33507,
-33498,
-33510,
-33495,
-33505,
-33485,
-33492,
-33482,
-33483,
-33469,
-33462,
-33463,
-33440,
-33453,
-33417,
-33429,
-33404,
-33410,
-33392,
-33400,
-33377,
-33390,
-33368,
-33359,
-33361,
-33331,
-33351,
-33315,
-33323,
-33302,
-33304,
-33279,
-33305,
-33271,
-33289,
-33264,
 33265,
-33249,
-33259,
+33235,
+33230,
+33224,
+33214,
+33238,
+33254,
+33270,
+33286,
+33271,
+33255,
+33248,
+33221,
+33206,
+33203,
+33188,
+33210,
+33206,
+33203,
+33213,
+33180,
+33170,
+33154,
+33140,
+33149,
+33158,
+33187,
+33214,
+33225,
+33242,
+33240,
+33234,
+33222,
+33196,
+33176,
+33146,
+33123,
+33097,
+33069,
+33033,
+32987,
+32938,
+32888,
+32843,
+32793,
+32750,
+32706,
+32669,
+32637,
+32605,
+32571,
+32537,
+32493,
+32448,
+32401,
+32348,
+32304,
+32260,
+32237,
+32210,
+32190,
+32166,
+32143,
+32112,
+32070,
+32053,
+32026,
+32045,
+32064,
+32091,
+32143,
+32166,
+32202,
+32208,
+32216,
+32221,
+32230,
+32246,
+32263,
+32299,
+32313,
+32339,
+32340,
+32342,
+32356,
+32358,
+32395,
+32428,
+32480,
+32536,
+32580,
+32630,
+32649,
+32681,
+32706,
+32741,
+32785,
+32816,
+32870,
+32904,
+32943,
+32968,
+32984,
+33005,
+33023,
+33063,
+33097,
+33146,
+33187,
 33231,
-33241,
-33211,
-33218,
-33175,
-33200,
-33148,
-33185,
-33156,
-33168,
+33264,
+33289,
+33306,
+33313,
+33335,
+33339,
+33355,
+33347,
+33338,
+33316,
+33273,
+33254,
+33201,
+33163,
 33137,
-33138,
-33118,
-33116,
-33111,
-33101,
 33102,
-33069,
-33077,
-33033,
-33053,
-33030,
+33090,
+33063,
+33032,
+33009,
+32967,
+32939,
+32918,
+32895,
+32882,
+32861,
+32846,
+32812,
+32785,
+32746,
+32706,
+32689,
+32647,
+32648,
+32640,
+32633,
+32639,
+32618,
+32615,
+32612,
+32613,
+32630,
+32665,
+32690,
+32739,
+32778,
+32803,
+32839,
+32835,
+32856,
+32864,
+32871,
+32894,
+32904,
+32921,
+32927,
+32935,
+32927,
+32931,
+32928,
+32933,
+32963,
+32971,
+33008,
+33022,
+33023,
 33037,
 33020,
+33021,
 33022,
+33007,
+33012,
 32998,
-33005,
-32988,
-32983,
-32976,
+32979,
 32963,
-32947,
-32946,
-32915,
-32942,
-32901,
+32921,
+32887,
+32859,
+32833,
+32823,
+32815,
+32805,
+32798,
+32790,
+32760,
+32740,
+32703,
+32663,
+32644,
+32592,
+32554,
+32507,
+32438,
+32387,
+32313,
+32249,
+32192,
+32133,
+32110,
+32079,
+32068,
+32055,
+32036,
+32036,
+32013,
+32016,
+32011,
+32016,
+32034,
+32041,
+32059,
+32057,
+32066,
+32072,
+32086,
+32094,
+32113,
+32145,
+32171,
+32218,
+32236,
+32265,
+32287,
+32302,
+32333,
+32353,
+32385,
+32423,
+32466,
+32511,
+32552,
+32584,
+32624,
+32658,
+32691,
+32731,
+32777,
+32843,
+32895,
+32962,
+33009,
+33057,
+33114,
+33154,
+33219,
+33265,
+33331,
+33397,
+33450,
+33502,
+33527,
+33566,
+33581,
+33600,
+33607,
+33602,
+33616,
+33603,
+33601,
+33575,
+33540,
+33516,
+33484,
+33458,
+33424,
+33390,
+33358,
+33344,
+33307,
+33266,
+33228,
+33174,
+33150,
+33097,
+33051,
+33004,
+32954,
+32928,
+32878,
+32839,
+32793,
+32758,
+32734,
+32704,
+32675,
+32644,
+32632,
+32621,
+32612,
+32598,
+32591,
+32598,
+32611,
+32628,
+32637,
+32656,
+32688,
+32728,
+32763,
+32796,
+32833,
+32881,
+32927,
+32961,
+32997,
+33015,
+33053,
+33069,
+33078,
+33092,
+33072,
+33098,
+33078,
+33068,
+33068,
+33026,
+33040,
+33004,
+32989,
+32985,
+32960,
+32969,
+32950,
+32943,
+32936,
+32930,
+32918,
 32910,
-32894,
-32882,
-32891,
+32897,
+32880,
+32890,
+32869,
 32874,
-32887,
-32879,
 32867,
-32866,
 32849,
-32844,
-32855,
-32853,
-32847,
-32851,
-32839,
-32825,
-32839,
-32836,
-32836,
-32867,
+32861,
 32837,
+32828,
+32813,
+32786,
+32781,
+32752,
+32718,
+32682,
+32629,
+32575,
+32511,
+32432,
+32359,
+32282,
+32200,
+32136,
+32053,
+31989,
+31940,
+31882,
+31855,
+31809,
+31784,
+31786,
+31767,
+31784,
+31786,
+31795,
+31822,
+31833,
+31868,
+31885,
+31918,
+31949,
+31977,
+32018,
+32036,
+32084,
+32105,
+32137,
+32177,
+32186,
+32230,
+32241,
+32264,
+32298,
+32300,
+32339,
+32355,
+32369,
+32407,
+32418,
+32455,
+32486,
+32506,
+32558,
+32595,
+32641,
+32694,
+32736,
+32799,
+32859,
+32921,
+32984,
+33047,
+33118,
+33180,
+33248,
+33299,
+33342,
+33398,
+33426,
+33468,
+33488,
+33499,
+33533,
+33534,
+33553,
+33553,
+33541,
+33552,
+33539,
+33536,
+33523,
+33506,
+33501,
+33489,
+33472,
+33449,
+33419,
+33398,
+33379,
+33354,
+33326,
+33299,
+33284,
+33262,
+33242,
+33205,
+33173,
+33156,
+33123,
+33103,
+33064,
+33035,
+33016,
+32991,
+32962,
+32931,
+32903,
+32884,
+32877,
 32853,
-32833,
-32840,
-32835,
-32847,
-32844,
 32852,
-32841,
-32858,
-32837,
-32871,
-32848,
+32838,
+32838,
+32849,
+32838,
+32845,
+32850,
+32859,
+32866,
 32871,
-32864,
-32855,
-32878,
-32861,
-32881,
-32861,
-32882,
-32856,
+32867,
 32878,
-32861,
-32884,
-32885,
 32877,
-32883,
-32864,
-32882,
-32860,
-32882,
-32871,
-32875,
-32860,
-32859,
-32824,
+32873,
 32870,
-32817,
-32868,
-32835,
-32830,
+32845,
+32846,
 32817,
 32808,
-32801,
-32812,
-32812,
-32795,
-32801,
-32764,
-32774,
-32764,
-32770,
-32765,
-32757,
-32751,
-32721,
-32726,
-32718,
+32789,
+32768,
+32756,
 32724,
-32730,
-32707,
-32709,
-32670,
-32691,
-32674,
-32691,
-32700,
-32673,
-32681,
-32641,
-32650,
-32649,
-32655,
+32722,
+32686,
+32689,
 32668,
-32661,
-32658,
-32630,
+32650,
+32661,
 32634,
+32656,
+32630,
 32628,
-32658,
-32657,
-32659,
 32636,
-32637,
-32608,
-32629,
 32622,
-32645,
 32636,
-32641,
-32619,
-32628,
-32612,
-32641,
-32624,
-32645,
-32628,
-32633,
-32619,
+32626,
 32631,
-32622,
-32634,
-32644,
-32624,
-32648,
-32625,
-32658,
-32638,
-32658,
-32637,
-32658,
-32650,
-32656,
-32660,
-32658,
-32657,
-32650,
-32660,
+32639,
+32645,
 32652,
-32669,
-32667,
-32670,
-32672,
-32665,
-32665,
-32674,
-32659,
-32676,
-32657,
-32674,
-32660,
 32657,
-32651,
-32652,
-32648,
-32659,
-32640,
+32655,
+32663,
+32671,
+32666,
+32668,
 32656,
-32624,
-32632,
-32610,
-32606,
-32596,
-32596,
-32572,
-32584,
-32548,
-32550,
+32651,
+32645,
+32613,
+32592,
+32557,
 32526,
-32531,
-32514,
-32524,
-32494,
-32494,
-32470,
-32456,
-32443,
-32444,
-32425,
+32503,
+32457,
 32432,
-32405,
-32405,
-32379,
-32385,
-32361,
-32380,
-32353,
-32373,
-32333,
-32351,
-32309,
-32329,
-32323,
-32311,
-32333,
-32297,
-32318,
-32299,
-32293,
-32317,
-32298,
+32398,
+32372,
+32358,
+32326,
 32320,
-32305,
+32306,
 32305,
 32310,
-32285,
-32322,
-32291,
-32335,
-32306,
-32319,
-32320,
-32312,
-32333,
-32332,
-32332,
-32344,
+32301,
+32315,
+32318,
 32331,
-32340,
-32330,
-32339,
+32338,
 32335,
-32345,
-32357,
-32346,
-32365,
-32360,
-32366,
-32371,
-32383,
-32372,
-32401,
-32372,
-32398,
-32387,
-32400,
-32399,
-32405,
-32415,
-32427,
+32351,
+32362,
+32378,
+32388,
+32395,
 32415,
-32449,
-32413,
-32460,
-32436,
-32460,
-32450,
-32470,
-32443,
-32476,
-32453,
-32477,
-32465,
-32488,
-32477,
-32498,
-32487,
-32504,
-32500,
-32506,
-32515,
-32517,
-32516,
-32534,
-32503,
-32541,
-32517,
-32552,
-32539,
-32564,
-32550,
-32564,
-32556,
+32431,
+32447,
+32459,
+32463,
+32480,
+32494,
+32508,
+32520,
+32525,
+32549,
+32559,
 32574,
-32562,
-32592,
-32580,
-32596,
-32585,
-32583,
-32597,
+32588,
 32590,
-32610,
-32608,
-32619,
-32619,
-32618,
-32631,
-32626,
-32651,
-32648,
+32612,
+32621,
+32644,
 32656,
-32661,
-32651,
-32660,
-32662,
-32673,
-32682,
-32684,
-32693,
-32687,
-32693,
-32706,
-32701,
-32722,
-32717,
-32717,
+32664,
+32686,
+32695,
+32713,
 32723,
-32724,
-32729,
-32748,
-32730,
-32752,
-32756,
-32758,
-32781,
-32765,
-32788,
-32789,
-32799,
-32808,
+32735,
+32757,
+32775,
+32801,
 32819,
-32815,
-32834,
-32829,
-32854,
-32858,
-32881,
-32891,
-32890,
-32910,
-32908,
-32943,
-32953,
-32973,
-32977,
-32997,
-32975,
-33017,
-33014,
-33051,
-33054,
-33076,
-33066,
-33092,
-33074,
-33111,
-33115,
-33143,
-33143,
-33152,
+32851,
+32886,
+32919,
+32970,
+32993,
+33043,
+33075,
+33103,
 33146,
-33145,
-33171,
-33156,
-33194,
-33188,
-33196,
-33193,
-33190,
-33205,
+33151,
+33182,
 33195,
-33227,
-33209,
-33232,
-33216,
-33223,
-33223,
-33220,
-33226,
-33228,
-33226,
-33237,
+33204,
 33224,
-33238,
 33220,
+33228,
 33231,
-33218,
-33236,
-33219,
-33238,
-33218,
-33219,
+33226,
 33228,
-33208,
 33222,
-33210,
-33220,
+33215,
 33220,
-33222,
-33221,
-33210,
-33225,
-33199,
-33226,
-33207,
-33216,
-33207,
-33209,
-33190,
-33200,
-33173,
-33197,
-33171,
-33192,
-33173,
-33173,
-33163,
-33147,
-33155,
-33152,
-33148,
-33156,
-33125,
-33122,
-33113,
-33101,
-33119,
-33096,
-33116,
-33082,
-33089,
-33061,
-33074,
-33060,
-33084,
-33058,
-33057,
-33039,
-33026,
-33017,
-33025,
-33017,
-33022,
-33004,
-32977,
-32985,
-32963,
-32981,
-32971,
-32973,
-32946,
-32952,
-32907,
-32937,
-32907,
-32931,
-32903,
-32905,
-32882,
-32879,
-32876,
+33217,
+33213,
+33211,
+33189,
+33185,
+33168,
+33153,
+33144,
+33112,
+33108,
+33079,
+33070,
+33053,
+33023,
+33013,
+32978,
+32972,
+32940,
+32918,
+32901,
+32872,
 32862,
-32880,
-32850,
-32861,
-32840,
-32824,
-32838,
-32795,
-32828,
-32788,
-32807,
-32778,
-32785,
-32762,
-32772,
-32747,
-32761,
-32729,
+32832,
+32808,
+32789,
 32760,
-32727,
-32751,
-32721,
-32716,
-32719,
-32706,
-32718,
-32716,
+32748,
+32734,
+32715,
 32714,
-32701,
-32706,
-32686,
-32709,
-32699,
-32712,
-32695,
-32708,
-32680,
-32685,
-32679,
-32687,
+32700,
+32704,
+32696,
+32683,
 32684,
-32692,
-32678,
-32663,
-32671,
-32652,
-32672,
-32671,
+32665,
 32667,
-32659,
-32649,
+32652,
 32637,
-32648,
-32639,
-32634,
-32631,
-32613,
-32630,
-32596,
-32619,
-32591,
-32616,
-32592,
-32602,
-32592,
-32590,
-32591,
-32594,
-32580,
-32582,
-32571,
-32579,
-32578,
-32579,
-32585,
-32576,
-32581,
-32579,
-32575,
-32601,
-32587,
-32608,
-32586,
+32623,
+32606,
 32600,
-32586,
-32607,
-32611,
+32593,
+32583,
+32577,
+32580,
+32581,
+32594,
+32595,
 32607,
-32621,
-32604,
-32619,
-32615,
-32627,
-32626,
-32643,
-32621,
-32640,
-32610,
-32643,
-32621,
-32640,
-32628,
+32613,
+32625,
+32631,
+32629,
 32630,
-32619,
-32622,
-32628,
-32617,
-32634,
-32615,
-32614,
+32623,
+32623,
 32609,
-32601,
-32608,
-32610,
-32600,
-32605,
-32568,
-32594,
-32564,
-32592,
+32606,
+32585,
+32581,
 32574,
-32590,
-32566,
-32576,
-32547,
-32567,
-32563,
-32568,
-32576,
-32563,
-32566,
-32544,
 32561,
-32556,
-32579,
-32570,
-32571,
-32563,
-32564,
-32550,
-32576,
-32558,
-32595,
 32570,
-32572,
-32572,
-32573,
+32555,
+32569,
+32565,
+32565,
 32577,
-32594,
-32583,
-32601,
+32573,
+32592,
+32588,
 32590,
-32579,
-32600,
+32588,
+32585,
+32583,
+32574,
 32572,
-32605,
-32586,
-32592,
-32586,
-32587,
-32578,
-32593,
-32581,
-32586,
-32587,
-32575,
-32573,
-32580,
-32569,
-32580,
-32570,
-32564,
-32565,
 32557,
-32561,
-32547,
-32571,
-32547,
-32564,
-32542,
-32547,
-32525,
-32550,
-32527,
-32553,
+32560,
+32546,
+32539,
 32535,
-32522,
-32530,
-32512,
-32522,
-32542,
-32524,
-32543,
-32515,
-32515,
-32509,
-32515,
 32521,
 32534,
-32530,
-32527,
-32507,
-32514,
 32514,
+32524,
 32523,
-32546,
-32533,
-32547,
-32523,
-32533,
-32517,
-32535,
-32548,
-32533,
-32551,
-32532,
-32529,
-32552,
-32530,
-32548,
-32550,
-32545,
-32568,
-32536,
-32574,
+32516,
+32541,
 32527,
-32561,
-32536,
-32565,
+32537,
+32541,
+32537,
 32555,
-32570,
-32564,
+32549,
 32551,
-32560,
-32550,
-32565,
-32572,
-32577,
-32577,
-32557,
-32557,
+32564,
 32554,
+32573,
 32561,
-32591,
-32582,
-32594,
-32575,
-32574,
-32575,
-32590,
-32606,
-32615,
-32608,
-32614,
-32601,
-32615,
-32626,
-32631,
-32657,
-32642,
-32657,
-32651,
-32663,
-32679,
-32690,
-32698,
-32713,
-32717,
-32720,
-32727,
-32741,
-32752,
-32755,
-32778,
-32765,
-32799,
-32782,
-32814,
-32793,
-32822,
-32817,
-32836,
-32840,
-32842,
-32852,
-32849,
-32855,
-32863,
-32872,
-32873,
-32885,
-32872,
+32568,
+32585,
+32580,
+32610,
+32610,
+32635,
+32654,
+32674,
+32711,
+32729,
+32760,
+32786,
+32806,
+32832,
+32848,
+32864,
+32878,
 32891,
-32885,
-32903,
-32900,
-32904,
-32912,
-32907,
-32919,
-32911,
-32936,
-32921,
-32944,
-32928,
-32941,
-32933,
-32959,
-32945,
-32965,
-32962,
+32905,
+32915,
+32930,
+32938,
 32953,
+32964,
 32983,
-32959,
-32998,
-32975,
-33008,
-32978,
+32993,
 33007,
-32988,
-33012,
-33019,
-33023,
-33035,
-33034,
-33043,
-33041,
-33068,
-33054,
-33085,
-33069,
-33088,
-33082,
-33082,
-33100,
-33089,
-33115,
-33100,
-33115,
+33032,
+33048,
+33073,
+33084,
+33098,
 33112,
-33119,
-33121,
-33121,
-33136,
-33126,
-33139,
-33127,
-33138,
-33127,
-33136,
-33126,
-33139,
-33129,
-33137,
-33137,
-33137,
-33132,
-33136,
-33138,
+33120,
 33132,
 33132,
 33132,
-33120,
-33130,
-33117,
-33125,
-33118,
-33120,
-33115,
-33115,
-33113,
+33135,
+33136,
+33134,
+33126,
+33122,
+33116,
 33114,
-33113,
-33109,
-33108,
-33095,
-33098,
-33087,
+33104,
 33092,
-33090,
-33096,
-33073,
-33088,
-33065,
-33082,
-33080,
-33070,
-33085,
-33060,
-33075,
-33044,
-33060,
-33044,
-33057,
+33087,
+33077,
+33077,
+33064,
+33049,
 33039,
-33041,
-33025,
-33036,
-33023,
-33018,
-33028,
-32997,
-33028,
-32988,
-33019,
-32977,
-33001,
-32967,
-32983,
-32970,
-32977,
-32973,
-32977,
-32960,
-32964,
+33024,
+33014,
+33000,
+32979,
+32975,
+32966,
 32955,
-32953,
-32959,
-32958,
-32943,
-32957,
-32931,
-32934,
+32952,
+32932,
 32931,
-32927,
 32926,
-32948,
-32912,
-32938,
-32913,
-32908,
-32921,
-32893,
-32918,
-32906,
-32900,
-32900,
-32873,
-32880,
-32863,
-32871,
-32894,
-32867,
-32891,
+32907,
+32909,
+32879,
+32876,
+32874,
+32845,
 32851,
-32856,
-32836,
-32853,
-32842,
-32862,
-32842,
-32829,
-32815,
-32807,
-32811,
 32817,
-32824,
-32818,
-32829,
-32789,
-32799,
+32816,
+32816,
 32790,
-32793,
 32799,
-32798,
-32793,
-32788,
-32773,
-32772,
-32770,
-32788,
-32785,
-32799,
-32786,
-32785,
-32784,
-32767,
-32790,
 32775,
-32785,
+32782,
 32791,
-32768,
-32777,
-32768,
-32766,
-32783,
-32772,
-32796,
-32780,
-32781,
-32785,
-32753,
 32776,
+32785,
+32772,
+32775,
+32787,
+32767,
+32766,
 32751,
-32779,
-32752,
-32770,
-32746,
-32745,
-32739,
-32745,
-32747,
-32757,
-32746,
-32757,
-32727,
-32738,
-32720,
-32725,
-32724,
-32727,
-32717,
-32703,
-32700,
-32691,
-32702,
-32701,
-32710,
-32709,
-32693,
-32692,
-32673,
-32683,
-32672,
-32688,
-32653,
-32678,
-32636,
-32656,
-32648,
-32646,
-32657,
+32743,
+32753,
+32729,
+32726,
+32706,
+32699,
+32705,
+32682,
+32674,
+32654,
 32648,
-32638,
-32646,
-32636,
-32623,
-32634,
-32608,
-32614,
-32605,
-32603,
-32595,
-32596,
-32585,
-32583,
+32647,
+32628,
+32612,
+32597,
+32582,
 32579,
-32578,
-32573,
-32589,
-32557,
-32565,
-32546,
-32537,
-32548,
-32524,
+32558,
 32537,
 32527,
-32522,
-32513,
-32497,
-32502,
-32505,
+32504,
 32505,
-32507,
-32495,
-32492,
-32466,
-32489,
-32459,
-32477,
-32467,
-32457,
-32459,
-32438,
-32450,
-32436,
-32456,
-32443,
-32452,
+32488,
+32471,
+32461,
 32443,
+32449,
 32437,
-32427,
-32438,
-32419,
-32444,
-32425,
-32428,
-32417,
+32431,
+32426,
 32424,
-32425,
-32428,
-32433,
-32447,
-32425,
-32450,
-32438,
-32445,
-32447,
-32449,
-32444,
-32449,
-32442,
+32437,
+32443,
+32446,
 32448,
-32457,
 32455,
-32461,
-32458,
-32473,
-32471,
-32484,
-32489,
-32487,
-32496,
-32485,
-32502,
-32502,
-32495,
-32520,
-32491,
-32520,
-32491,
-32526,
-32508,
-32553,
-32531,
+32470,
+32486,
+32494,
+32504,
+32504,
+32525,
 32541,
-32542,
-32539,
-32553,
-32554,
-32568,
-32564,
-32569,
-32564,
-32559,
+32549,
 32567,
-32584,
-32579,
-32605,
-32594,
-32609,
-32593,
-32615,
-32608,
-32621,
-32640,
-32617,
-32647,
-32611,
-32646,
-32625,
-32657,
-32653,
-32662,
-32661,
-32663,
-32673,
-32665,
-32688,
-32681,
-32702,
+32563,
+32588,
+32601,
+32614,
+32631,
+32632,
+32656,
+32664,
 32682,
-32696,
-32668,
-32697,
-32683,
-32696,
+32689,
+32686,
+32692,
 32693,
-32695,
-32681,
 32699,
 32689,
-32701,
-32708,
-32691,
-32693,
-32688,
-32679,
-32698,
-32675,
-32690,
-32671,
-32666,
+32684,
+32670,
 32673,
-32660,
-32683,
-32674,
-32667,
-32668,
-32654,
-32660,
-32666,
-32658,
-32664,
-32648,
-32645,
-32639,
-32635,
-32640,
-32649,
-32634,
-32654,
-32631,
-32632,
+32665,
+32661,
+32652,
 32637,
-32631,
 32645,
-32652,
-32638,
-32659,
-32620,
+32632,
 32644,
-32629,
-32648,
-32651,
-32652,
-32659,
-32651,
-32650,
-32664,
-32666,
-32680,
-32704,
-32673,
-32699,
-32681,
-32688,
-32704,
-32708,
-32725,
-32718,
+32642,
+32637,
+32654,
+32653,
+32682,
+32687,
+32701,
 32719,
-32715,
-32732,
-32740,
-32764,
-32770,
-32783,
-32779,
-32777,
-32794,
-32788,
-32820,
-32811,
-32818,
-32818,
-32819,
-32838,
-32835,
-32854,
-32855,
-32870,
-32867,
-32882,
-32881,
-32898,
-32891,
-32897,
+32730,
+32771,
+32784,
+32806,
+32821,
+32839,
+32866,
+32886,
 32894,
-32895,
 32904,
-32908,
-32916,
-32912,
-32912,
-32918,
-32908,
-32941,
-32926,
-32951,
-32942,
-32937,
-32926,
-32931,
-32934,
-32933,
+32913,
+32920,
 32943,
-32941,
-32927,
 32931,
-32915,
-32932,
-32941,
-32946,
-32954,
-32942,
-32947,
-32914,
-32948,
-32916,
-32961,
-32932,
-32945,
-32923,
-32923,
-32923,
-32935,
+32938,
+32931,
+32930,
+32950,
+32931,
 32942,
-32954,
+32928,
+32934,
 32949,
+32938,
 32948,
-32932,
-32937,
-32944,
 32940,
-32965,
-32933,
-32952,
-32925,
-32952,
-32941,
-32961,
-32954,
-32966,
-32964,
+32953,
 32964,
-32965,
-32982,
-32968,
-32985,
 32973,
 32976,
-32975,
-32983,
-32990,
-33010,
-32993,
-33022,
-32994,
-33034,
-33012,
-33057,
-33042,
-33066,
-33043,
+32984,
+33004,
+33020,
+33049,
 33056,
-33061,
-33064,
-33094,
-33081,
-33101,
-33102,
-33112,
-33114,
-33134,
-33134,
-33147,
-33158,
-33168,
-33170,
-33189,
-33168,
-33191,
-33190,
-33209,
-33223,
-33238,
-33236,
-33250,
-33230,
-33267,
-33260,
-33293,
-33290,
-33283,
-33282,
-33277,
-33284,
-33306,
-33313,
-33330,
-33316,
-33331,
-33316,
-33338,
-33332,
-33353,
-33347,
-33350,
-33336,
-33337,
-33337,
-33348,
-33344,
-33354,
-33339,
-33350,
-33343,
-33361,
-33351,
-33357,
-33341,
-33335,
-33333,
-33332,
-33333,
-33334,
-33312,
-33317,
-33298,
-33307,
-33304,
-33309,
-33303,
-33304,
-33267,
-33279,
-33248,
-33264,
-33244,
-33241,
-33213,
-33218,
+33079,
+33106,
+33125,
+33161,
 33175,
-33194,
-33164,
-33174,
-33173,
-33132,
-33148,
-33101,
-33108,
-33080,
-33078,
-33050,
-33041,
-33010,
-33009,
-32971,
-32967,
-32945,
-32940,
-32922,
-32915,
-32884,
-32870,
-32857,
-32832,
-32810,
-32800,
-32765,
-32770,
-32721,
-32726,
-32684,
-32681,
-32654,
-32644,
-32629,
-32616,
-32599,
-32574,
-32559,
-32532,
-32522,
-32503,
-32493,
-32464,
-32465,
-32420,
-32427,
-32396,
-32399,
-32389,
-32387,
-32353,
-32358,
-32325,
-32331,
-32311,
-32311,
-32295,
-32285,
-32267,
-32263,
-32239,
-32260,
-32231,
-32256,
-32227,
-32229,
-32221,
-32211,
-32216,
-32197,
-32209,
-32195,
-32187,
-32194,
-32173,
-32195,
-32165,
-32191,
-32155,
-32193,
-32163,
-32186,
+33197,
+33232,
+33247,
+33282,
+33281,
+33301,
+33325,
+33331,
+33348,
+33340,
+33344,
+33349,
+33353,
+33339,
+33331,
+33311,
+33306,
+33294,
+33260,
+33236,
+33191,
+33170,
+33133,
+33084,
+33038,
+32979,
+32937,
+32891,
+32832,
+32776,
+32714,
+32658,
+32615,
+32555,
+32505,
+32452,
+32406,
+32378,
+32335,
+32307,
+32270,
+32246,
+32236,
+32214,
+32201,
+32188,
+32177,
+32177,
 32173,
-32166,
-32159,
-32154,
-32162,
-32142,
-32174,
-32143,
-32152,
-32140,
-32138,
-32131,
-32143,
-32145,
-32150,
-32136,
-32136,
-32120,
-32128,
-32128,
-32140,
-32131,
-32141,
-32112,
-32127,
-32118,
-32131,
-32137,
-32131,
+32156,
+32157,
 32140,
+32142,
+32139,
 32127,
 32134,
-32127,
-32143,
-32141,
-32150,
-32149,
-32154,
-32147,
-32171,
-32156,
-32177,
+32122,
+32133,
+32133,
+32137,
+32151,
+32159,
 32175,
-32170,
-32193,
 32191,
-32189,
-32220,
-32187,
-32238,
-32199,
-32243,
-32221,
-32254,
-32249,
-32269,
-32260,
-32275,
-32276,
-32282,
-32301,
-32312,
-32319,
-32329,
-32336,
-32328,
-32355,
-32344,
-32390,
-32374,
-32405,
-32386,
-32406,
-32405,
-32420,
-32441,
-32446,
-32464,
-32471,
-32478,
-32483,
-32501,
-32520,
-32521,
-32548,
-32536,
-32556,
-32563,
-32566,
-32594,
-32598,
-32620,
-32619,
-32638,
-32641,
-32666,
-32668,
-32689,
-32692,
-32711,
-32711,
-32735,
-32729,
-32748,
-32752,
-32756,
-32788,
-32781,
-32819,
-32808,
-32834,
-32815,
-32834,
-32839,
-32857,
-32865,
-32867,
-32877,
+32209,
+32226,
+32255,
+32270,
+32299,
+32327,
+32346,
+32385,
+32401,
+32436,
+32470,
+32500,
+32538,
+32562,
+32601,
+32636,
+32671,
+32709,
+32734,
+32764,
+32807,
+32826,
+32853,
 32874,
-32883,
-32897,
-32903,
-32916,
-32915,
-32931,
-32915,
-32949,
-32925,
-32959,
-32946,
-32957,
+32894,
+32920,
+32933,
+32952,
 32954,
-32958,
-32949,
-32966,
-32962,
-32971,
-32995,
-32959,
-33001,
-32965,
-33000,
+32967,
 32981,
-33000,
-32980,
-32997,
-32992,
-32996,
+32986,
+32990,
+32998,
 33008,
-32999,
-33013,
-33007,
 33012,
-33006,
-33021,
-33006,
-33033,
-33010,
-33016,
-33011,
-33000,
-33028,
-32999,
-33038,
-33005,
-33029,
-33003,
-33023,
-33015,
-33031,
-33023,
-33024,
+33019,
 33010,
-33008,
-33004,
-33007,
 33017,
-33026,
-33014,
-33018,
-33004,
-33008,
-33019,
+33016,
+33022,
 33020,
+33006,
+33019,
+33011,
 33018,
-33012,
-33012,
-32990,
-33009,
-32978,
-33018,
-32998,
-33004,
-33002,
-32989,
+33007,
+32997,
 33004,
-32991,
-33002,
-32994,
-32986,
-32992,
-32976,
-32971,
-32987,
-32958,
-32993,
-32960,
-32998,
-32971,
-32990,
-32976,
-32974,
-32979,
-32971,
-32990,
-32976,
-32971,
-32966,
-32953,
-32966,
+32996,
+32995,
+32980,
+32973,
+32983,
+32977,
+32981,
 32970,
-32979,
-32978,
-32987,
-32971,
-32971,
-32972,
+32964,
+32981,
 32972,
-32990,
-32976,
-32985,
-32962,
-32971,
-32956,
-32994,
-32967,
-33011,
+32981,
+32970,
 32976,
-32994,
-32983,
-32989,
-32996,
-33000,
-32993,
-32988,
-32992,
-32972,
-32998,
-32972,
-33001,
-32987,
-32989,
-32992,
-33001,
-32987,
-33009,
-32991,
-32986,
-32991,
-32975,
-32982,
 32990,
-32987,
-32987,
-32986,
+32990,
+32995,
 32984,
-32991,
+32988,
+32994,
+32997,
+32985,
+32984,
+32987,
 32993,
-33005,
-32986,
-33015,
-32977,
-33003,
-32978,
-32992,
-32976,
+32999,
 32986,
-32987,
-32978,
-33003,
-32974,
-33002,
-32990,
+32984,
+32988,
+32994,
+32996,
 32988,
-33011,
 32986,
-33002,
 32986,
-32988,
-32984,
-32993,
-32980,
-32990,
-32983,
-32985,
-32993,
-32985,
-32994,
-32991,
 32992,
 32986,
-32982,
-32979,
-32980,
-32966,
-32983,
-32963,
-32972,
-32955,
-32960,
+32977,
+32969,
 32959,
-32964,
-32971,
-32960,
-32958,
-32943,
-32933,
-32940,
-32927,
-32943,
-32931,
-32936,
-32919,
-32924,
-32907,
-32925,
-32928,
-32905,
+32966,
 32945,
-32886,
-32924,
-32892,
-32908,
-32903,
-32896,
-32905,
-32875,
-32890,
-32879,
+32935,
+32930,
+32917,
+32922,
+32907,
+32902,
+32889,
 32882,
-32886,
-32896,
-32869,
-32899,
-32867,
-32883,
-32862,
-32865,
-32866,
-32856,
-32864,
-32851,
-32856,
-32851,
+32887,
+32872,
+32863,
+32855,
+32847,
 32838,
-32854,
-32830,
-32851,
-32825,
-32833,
-32813,
-32820,
-32811,
-32819,
 32820,
-32798,
-32797,
-32788,
-32777,
-32788,
-32777,
-32773,
-32771,
-32765,
-32742,
-32757,
-32732,
-32751,
-32726,
-32739,
-32714,
-32716,
-32711,
-32712,
-32706,
-32713,
-32694,
-32690,
-32675,
-32678,
+32816,
+32796,
+32781,
+32769,
+32747,
+32735,
+32715,
+32710,
+32689,
+32671,
 32668,
-32673,
-32669,
-32669,
-32660,
-32660,
-32643,
-32660,
+32651,
+32648,
 32635,
-32660,
-32637,
-32647,
-32629,
-32639,
-32614,
-32632,
-32622,
+32625,
 32615,
-32631,
-32591,
-32631,
-32585,
-32636,
-32599,
-32631,
-32599,
-32604,
-32580,
-32592,
-32573,
-32592,
+32611,
+32615,
+32589,
+32582,
+32575,
 32572,
-32585,
-32577,
-32564,
-32581,
-32557,
-32592,
-32559,
-32585,
-32545,
-32562,
-32541,
-32536,
+32569,
 32544,
-32523,
-32538,
-32523,
-32522,
-32516,
-32530,
-32507,
-32534,
-32508,
 32533,
-32498,
-32505,
+32522,
+32521,
+32517,
 32494,
-32481,
-32503,
-32473,
-32492,
-32484,
-32476,
-32500,
-32472,
-32497,
-32479,
-32493,
-32476,
-32480,
-32478,
-32478,
-32467,
-32483,
-32465,
-32481,
-32472,
-32481,
-32475,
-32498,
-32473,
-32512,
-32479,
-32505,
-32483,
-32484,
-32478,
+32486,
+32485,
+32487,
 32482,
 32475,
-32482,
 32474,
-32495,
-32482,
-32488,
-32489,
-32491,
-32500,
-32485,
-32505,
-32479,
-32490,
-32473,
 32478,
-32474,
-32475,
-32486,
-32481,
 32490,
-32488,
-32481,
+32493,
+32479,
+32480,
+32486,
+32492,
+32493,
+32478,
+32478,
 32487,
 32485,
-32488,
-32488,
-32484,
-32480,
-32481,
-32475,
-32491,
-32469,
-32503,
-32484,
-32504,
-32499,
+32487,
+32479,
+32485,
 32497,
 32505,
-32513,
-32507,
-32522,
-32508,
-32514,
-32504,
-32499,
-32523,
-32511,
-32538,
-32527,
-32530,
-32536,
-32538,
-32542,
-32553,
-32554,
-32568,
-32547,
-32571,
-32540,
-32570,
+32515,
+32506,
+32521,
+32533,
+32544,
 32560,
-32575,
-32570,
-32579,
-32566,
-32579,
-32574,
-32593,
-32589,
-32611,
-32596,
-32602,
-32599,
-32600,
-32592,
-32615,
-32596,
-32630,
-32609,
-32623,
-32628,
-32617,
-32652,
-32617,
+32556,
+32571,
+32573,
+32587,
+32603,
+32597,
+32610,
+32622,
+32632,
+32644,
 32658,
-32623,
-32668,
-32640,
-32666,
-32661,
-32661,
-32665,
-32669,
-32662,
-32680,
-32672,
-32694,
+32664,
+32673,
 32696,
-32697,
-32711,
-32706,
-32706,
-32720,
-32710,
-32733,
-32719,
-32730,
-32736,
-32732,
-32750,
-32741,
-32765,
-32755,
-32763,
-32760,
-32775,
-32770,
-32783,
-32787,
-32784,
-32797,
-32784,
+32708,
+32718,
+32729,
+32744,
+32759,
+32769,
+32786,
+32790,
 32799,
-32782,
-32814,
-32793,
-32821,
-32822,
-32816,
-32837,
-32829,
-32835,
-32834,
-32825,
-32838,
-32836,
+32820,
+32832,
+32832,
 32844,
-32852,
-32852,
-32869,
-32863,
-32860,
-32866,
-32865,
-32880,
-32882,
-32903,
-32892,
-32917,
-32894,
+32862,
+32864,
+32887,
+32904,
 32905,
-32907,
-32908,
-32914,
-32927,
-32920,
-32946,
-32935,
-32948,
-32949,
+32922,
+32941,
+32956,
 32962,
-32954,
-32960,
-32968,
-32954,
-32977,
-32970,
-32983,
-32986,
-32996,
-32984,
-33011,
-32990,
-33009,
-33019,
-32996,
-33037,
-33006,
-33029,
-33028,
-33018,
-33036,
+32975,
+32991,
+33001,
 33014,
-33037,
-33027,
-33051,
-33037,
-33071,
-33041,
-33077,
+33024,
+33025,
+33034,
 33055,
-33056,
-33063,
-33053,
-33050,
-33074,
-33041,
-33078,
 33061,
-33065,
-33071,
-33064,
-33063,
-33078,
-33068,
-33072,
-33073,
-33067,
-33071,
-33062,
-33078,
-33047,
-33086,
-33033,
-33085,
-33039,
-33079,
+33055,
 33061,
-33081,
+33066,
+33068,
 33072,
-33071,
-33067,
-33049,
-33074,
-33037,
-33076,
-33046,
+33069,
 33065,
-33063,
+33059,
+33070,
+33071,
 33056,
+33060,
+33059,
 33064,
-33055,
-33063,
-33072,
-33063,
-33071,
 33068,
-33059,
-33079,
-33055,
-33081,
-33050,
 33068,
-33049,
-33050,
-33058,
-33051,
 33063,
-33069,
-33061,
-33069,
-33047,
-33060,
-33045,
-33055,
-33044,
-33041,
+33051,
+33062,
+33062,
+33050,
 33043,
-33023,
-33031,
-33019,
-33016,
-33018,
-33013,
-33010,
+33025,
+33015,
 33009,
-33007,
-33005,
-33005,
-32988,
-32989,
-32981,
-32965,
-32965,
-32950,
-32950,
-32948,
-32947,
-32937,
-32952,
-32928,
+33001,
+32978,
+32954,
 32945,
-32932,
-32933,
+32940,
 32933,
-32920,
-32922,
-32919,
-32909,
-32918,
-32897,
-32914,
-32893,
-32908,
-32883,
-32917,
-32879,
-32917,
-32891,
-32905,
-32890,
+32921,
+32910,
+32901,
+32898,
+32901,
 32887,
-32882,
-32864,
-32874,
-32861,
-32857,
 32866,
-32852,
-32864,
-32844,
+32861,
 32851,
-32846,
-32836,
-32850,
-32834,
-32839,
-32826,
-32811,
-32809,
-32794,
-32790,
+32843,
+32835,
+32805,
 32786,
-32787,
-32770,
-32783,
-32764,
-32761,
-32763,
-32755,
-32752,
-32756,
-32738,
-32745,
-32730,
-32728,
-32718,
-32713,
-32719,
-32704,
-32715,
-32692,
-32703,
-32692,
-32704,
-32688,
-32699,
-32674,
-32690,
-32668,
-32670,
-32671,
-32656,
-32673,
-32641,
-32664,
-32634,
-32659,
-32644,
-32657,
-32644,
-32643,
-32627,
-32633,
-32612,
-32638,
-32615,
-32627,
-32602,
-32606,
-32586,
-32586,
-32598,
-32589,
-32610,
-32583,
-32593,
-32575,
-32574,
+32774,
+32759,
+32751,
+32732,
+32717,
+32705,
+32698,
+32691,
+32674,
+32664,
+32650,
+32651,
+32639,
+32625,
+32619,
+32591,
+32596,
+32587,
+32570,
 32567,
-32576,
-32561,
-32577,
-32552,
-32558,
-32554,
-32541,
-32555,
-32543,
-32548,
-32544,
-32544,
-32528,
+32550,
 32548,
-32521,
-32539,
-32526,
-32523,
-32522,
-32505,
-32516,
-32507,
+32541,
+32533,
+32524,
+32509,
 32512,
-32505,
-32523,
-32506,
-32511,
-32514,
-32484,
-32515,
-32481,
-32504,
-32482,
-32494,
-32489,
-32483,
-32493,
-32472,
+32510,
+32497,
+32491,
 32488,
-32462,
-32478,
-32465,
-32480,
-32473,
-32475,
-32475,
-32466,
+32477,
 32471,
-32457,
-32463,
-32460,
-32454,
-32479,
-32445,
 32476,
-32445,
-32467,
-32446,
-32463,
-32442,
-32456,
-32445,
+32465,
+32461,
+32462,
+32457,
+32451,
 32449,
+32461,
 32450,
-32458,
-32463,
-32464,
-32450,
-32452,
-32452,
-32446,
-32474,
 32463,
-32474,
-32476,
+32470,
 32461,
-32457,
-32466,
-32467,
-32471,
-32497,
-32480,
-32480,
+32485,
+32479,
 32488,
-32470,
-32482,
 32494,
-32483,
-32503,
-32497,
-32480,
-32502,
-32483,
-32511,
-32512,
-32519,
-32525,
-32510,
+32495,
 32519,
-32510,
-32534,
-32517,
-32552,
-32529,
-32544,
-32542,
-32529,
-32536,
-32549,
-32544,
-32568,
-32569,
+32515,
+32531,
+32540,
+32537,
 32561,
-32586,
-32565,
-32585,
-32572,
-32585,
-32576,
-32587,
+32574,
+32578,
 32583,
-32589,
-32600,
-32590,
-32605,
-32602,
-32609,
-32611,
-32625,
-32618,
-32634,
-32611,
-32632,
-32606,
-32627,
-32627,
-32633,
-32636,
-32637,
+32594,
+32603,
+32621,
+32622,
+32622,
 32635,
-32638,
-32653,
-32650,
-32681,
-32660,
-32686,
-32664,
-32669,
-32666,
-32659,
-32684,
-32677,
-32702,
-32699,
-32700,
-32711,
-32697,
-32739,
-32716,
-32772,
-32730,
-32779,
-32730,
-32768,
-32739,
-32762,
-32770,
-32767,
-32791,
-32770,
-32799,
-32781,
-32810,
-32814,
-32816,
-32830,
-32820,
-32824,
-32835,
+32640,
+32668,
+32671,
+32667,
+32695,
+32704,
+32736,
+32755,
+32752,
+32774,
+32787,
 32812,
+32827,
+32823,
 32836,
-32818,
-32843,
-32841,
-32841,
-32850,
-32849,
-32859,
-32860,
-32870,
-32869,
+32847,
+32863,
 32872,
-32878,
-32864,
-32878,
-32860,
-32885,
-32870,
-32875,
-32884,
-32865,
-32907,
-32890,
-32901,
+32872,
+32874,
+32883,
+32904,
+32911,
 32923,
-32896,
-32918,
-32910,
-32912,
 32935,
-32918,
-32946,
-32917,
-32947,
-32934,
-32951,
-32948,
-32961,
-32965,
-32976,
-32983,
-32978,
-32984,
-32981,
-32988,
-32993,
-33007,
-32997,
-33014,
-32998,
-33013,
-33002,
-33029,
-33025,
-33044,
-33044,
-33029,
-33048,
-33033,
-33036,
-33053,
-33038,
-33070,
-33043,
-33056,
-33042,
-33048,
-33056,
-33053,
+32944,
+32969,
+32980,
+32989,
+33005,
+33006,
+33031,
+33040,
+33039,
+33054,
+33047,
+33057,
+33062,
 33061,
 33067,
-33055,
 33069,
-33054,
-33061,
-33070,
-33052,
-33084,
-33050,
+33076,
+33073,
 33085,
-33053,
 33082,
-33065,
-33088,
-33066,
-33083,
-33064,
-33083,
-33071,
-33094,
+33086,
+33091,
 33082,
-33084,
-33089,
-33073,
-33085,
-33079,
 33099,
-33085,
-33104,
-33081,
-33080,
-33078,
 33091,
-33087,
-33108,
-33101,
+33090,
 33094,
-33088,
-33086,
-33089,
-33093,
-33098,
-33092,
-33089,
-33091,
-33075,
-33093,
-33066,
-33091,
-33070,
-33097,
-33086,
-33084,
-33089,
-33069,
-33077,
-33065,
 33078,
-33080,
+33085,
+33086,
 33073,
-33070,
-33057,
-33054,
-33063,
-33055,
-33064,
+33076,
+33061,
 33060,
-33051,
-33049,
-33037,
-33038,
-33040,
-33036,
-33045,
-33021,
-33017,
-33014,
-33001,
-33029,
-33014,
-33024,
-33007,
-33001,
-32998,
-32995,
+33052,
+33039,
+33034,
+33013,
+33019,
+33004,
 32993,
-32996,
-32988,
-32981,
-32973,
-32958,
-32964,
-32952,
-32955,
-32964,
-32940,
+32982,
+32957,
 32956,
-32929,
-32932,
-32937,
-32912,
 32938,
-32909,
-32913,
-32911,
-32880,
-32896,
-32865,
-32889,
-32865,
-32881,
-32868,
-32862,
-32854,
-32845,
-32832,
-32840,
-32829,
-32833,
-32805,
-32821,
-32791,
-32804,
+32926,
+32912,
+32883,
+32876,
+32861,
+32839,
+32824,
+32803,
 32788,
-32793,
-32787,
-32778,
-32784,
-32777,
-32775,
-32772,
-32758,
-32745,
-32744,
-32728,
+32782,
+32767,
 32741,
-32732,
 32733,
-32712,
-32715,
-32704,
-32703,
+32711,
 32708,
-32714,
-32697,
-32706,
-32674,
-32680,
-32669,
-32676,
-32674,
+32694,
 32675,
-32644,
-32655,
-32625,
-32656,
-32636,
-32652,
-32638,
-32639,
-32622,
-32619,
-32620,
-32598,
-32628,
-32586,
-32613,
-32583,
-32586,
-32594,
-32586,
-32594,
-32582,
-32571,
-32568,
-32565,
-32558,
-32572,
-32546,
-32550,
-32529,
-32521,
-32535,
-32515,
-32549,
-32516,
-32534,
-32506,
-32513,
-32501,
-32511,
-32495,
-32512,
-32483,
-32492,
+32665,
+32641,
+32645,
+32627,
+32612,
+32597,
+32590,
+32581,
+32565,
+32553,
+32527,
+32531,
+32516,
+32504,
+32494,
 32470,
-32471,
-32474,
-32467,
-32482,
-32475,
-32475,
-32473,
+32477,
+32469,
 32457,
-32465,
-32450,
-32465,
+32457,
+32441,
+32448,
 32456,
-32459,
-32451,
+32439,
 32445,
-32446,
-32433,
-32448,
-32447,
-32452,
-32462,
-32448,
-32455,
-32446,
-32432,
-32452,
-32428,
-32451,
-32441,
-32442,
-32434,
-32434,
-32428,
-32434,
-32452,
-32450,
-32455,
-32442,
-32437,
-32436,
-32428,
-32444,
-32443,
-32440,
 32434,
-32421,
-32429,
-32424,
 32439,
-32438,
-32449,
+32450,
+32435,
+32441,
 32427,
-32445,
-32416,
-32449,
-32418,
-32451,
-32424,
-32433,
-32425,
-32419,
-32430,
-32438,
-32431,
-32456,
-32431,
-32453,
+32435,
+32439,
+32432,
 32434,
-32451,
+32424,
 32440,
+32442,
+32449,
 32458,
-32465,
-32445,
-32474,
-32440,
-32459,
-32468,
-32465,
-32480,
-32484,
-32484,
-32490,
-32493,
-32486,
-32514,
-32491,
-32537,
-32489,
-32532,
+32456,
+32478,
+32488,
 32502,
-32528,
-32526,
-32534,
-32547,
-32539,
-32562,
-32544,
-32570,
-32558,
-32570,
+32514,
+32520,
+32543,
+32554,
+32572,
 32585,
-32574,
-32599,
-32573,
-32599,
-32582,
-32604,
-32609,
+32591,
 32620,
-32625,
-32628,
-32618,
-32624,
-32625,
-32655,
-32648,
-32675,
-32648,
-32662,
-32646,
-32668,
-32654,
-32701,
-32671,
-32720,
-32676,
-32703,
-32686,
-32710,
-32715,
-32727,
-32734,
-32735,
-32742,
-32733,
-32743,
-32749,
-32752,
+32621,
+32645,
+32660,
+32658,
+32692,
+32694,
+32714,
+32739,
+32739,
 32766,
-32768,
-32790,
-32781,
-32790,
-32782,
-32798,
-32787,
-32824,
-32817,
-32838,
-32827,
-32838,
-32812,
-32852,
-32832,
-32861,
-32863,
-32866,
-32880,
-32877,
-32881,
+32784,
+32792,
+32823,
+32831,
+32842,
 32873,
-32892,
-32892,
-32915,
-32916,
-32918,
-32925,
-32913,
-32921,
-32925,
-32940,
-32952,
-32956,
-32967,
-32952,
-32967,
+32876,
+32899,
+32920,
+32920,
+32951,
 32960,
-32986,
-32979,
-32999,
-32981,
+32977,
+32990,
 32996,
-32989,
-32994,
-32999,
-33021,
-33005,
-33030,
-33011,
-33017,
-33032,
-33038,
-33051,
-33062,
-33044,
-33052,
-33039,
+33016,
+33020,
 33051,
-33056,
-33078,
-33078,
-33070,
-33070,
-33045,
-33074,
+33046,
 33061,
-33104,
-33101,
-33106,
+33072,
+33062,
+33105,
+33083,
+33089,
 33102,
-33075,
-33079,
-33074,
-33096,
-33096,
-33112,
-33096,
-33096,
-33077,
-33088,
 33082,
-33110,
-33110,
-33113,
-33114,
-33093,
-33104,
-33081,
-33099,
-33090,
-33094,
-33103,
-33089,
-33107,
-33093,
-33099,
+33111,
 33102,
 33090,
-33110,
-33101,
-33108,
-33103,
-33101,
-33087,
-33086,
-33081,
-33072,
-33093,
+33098,
+33098,
+33099,
+33107,
+33089,
+33082,
+33095,
+33082,
 33088,
-33104,
-33090,
-33090,
-33075,
-33079,
-33094,
-33080,
-33097,
 33069,
-33076,
-33052,
-33063,
+33055,
+33061,
 33045,
-33068,
-33054,
-33069,
-33051,
-33052,
 33041,
-33044,
-33044,
-33044,
-33030,
-33035,
-33007,
-33017,
-32997,
-33016,
-32999,
-33012,
-32997,
-33008,
-32997,
-33007,
-32984,
-32995,
-32984,
-32962,
+33018,
+33005,
+33005,
+32998,
 32981,
-32941,
-32967,
-32948,
-32945,
-32951,
-32937,
-32936,
-32936,
-32942,
-32923,
-32934,
-32908,
-32918,
-32898,
-32902,
-32886,
-32879,
-32885,
-32854,
-32881,
-32848,
-32872,
-32854,
-32858,
-32845,
-32835,
-32831,
-32814,
-32828,
-32796,
-32814,
-32786,
-32791,
-32791,
-32776,
-32784,
-32770,
-32776,
-32761,
-32762,
+32959,
+32947,
+32939,
+32930,
+32911,
+32889,
+32869,
+32862,
+32846,
+32821,
+32802,
+32785,
+32775,
 32760,
-32737,
-32758,
-32721,
-32741,
-32712,
-32719,
-32707,
-32711,
-32708,
-32706,
+32743,
+32720,
 32710,
-32685,
-32700,
-32676,
-32695,
-32675,
-32678,
-32671,
-32649,
-32653,
-32647,
-32649,
-32652,
-32641,
-32632,
-32629,
-32617,
-32608,
-32618,
-32617,
-32613,
-32598,
-32594,
-32570,
-32584,
-32560,
-32582,
-32564,
-32566,
-32549,
+32701,
+32688,
+32674,
+32651,
+32648,
+32624,
+32615,
+32601,
+32573,
+32569,
 32544,
-32538,
-32534,
-32538,
-32531,
-32529,
+32535,
 32521,
-32517,
-32497,
-32513,
-32502,
-32502,
-32508,
-32476,
-32495,
-32481,
-32477,
-32490,
-32480,
-32487,
-32474,
-32475,
-32470,
-32477,
-32466,
-32484,
-32460,
-32475,
-32460,
-32456,
-32470,
-32460,
-32478,
-32463,
-32480,
-32455,
-32472,
-32466,
-32467,
-32480,
-32467,
+32506,
+32498,
+32482,
 32484,
-32460,
+32474,
+32473,
 32467,
-32459,
-32462,
-32477,
+32463,
 32471,
+32465,
 32475,
-32470,
-32467,
-32463,
-32478,
 32467,
-32494,
-32474,
-32475,
-32475,
-32450,
-32476,
-32473,
-32473,
-32503,
-32472,
-32490,
-32477,
-32478,
-32496,
-32492,
-32512,
-32501,
+32466,
+32473,
+32467,
+32482,
+32467,
+32474,
+32485,
+32483,
 32504,
-32494,
-32502,
-32501,
-32505,
-32521,
-32506,
-32527,
-32511,
-32538,
-32522,
-32548,
-32538,
-32546,
-32546,
+32499,
+32507,
+32519,
+32533,
+32545,
 32553,
-32543,
-32567,
-32559,
-32571,
-32576,
-32560,
-32593,
-32565,
-32603,
-32594,
-32604,
-32609,
-32600,
-32611,
-32619,
-32612,
-32639,
-32619,
-32646,
-32618,
-32652,
-32623,
-32665,
-32645,
-32679,
-32666,
-32679,
-32663,
-32690,
-32660,
-32704,
-32677,
+32568,
+32577,
+32598,
+32607,
+32621,
+32633,
+32640,
+32668,
+32672,
+32687,
+32701,
 32714,
-32695,
-32707,
-32704,
-32708,
-32724,
 32736,
-32732,
-32747,
-32731,
-32744,
-32753,
-32751,
-32775,
+32743,
 32766,
 32769,
-32777,
-32757,
-32793,
-32775,
-32817,
-32791,
-32816,
-32802,
-32810,
-32816,
-32826,
-32832,
-32833,
-32832,
-32825,
-32845,
-32826,
-32876,
-32842,
-32880,
-32849,
-32856,
-32861,
-32876,
-32893,
-32877,
-32906,
-32867,
-32899,
-32885,
+32790,
+32806,
+32818,
+32831,
+32837,
+32859,
+32860,
+32883,
+32888,
 32899,
-32913,
-32908,
-32920,
-32911,
-32911,
-32925,
-32930,
-32945,
-32935,
-32957,
-32928,
-32963,
-32934,
-32962,
+32914,
+32922,
+32943,
+32946,
 32957,
-32962,
-32968,
-32963,
+32970,
 32976,
-32969,
-32985,
-32977,
-32980,
-32982,
-32979,
-32998,
 32984,
-32995,
-32982,
+32989,
 32987,
-32983,
-32998,
-32982,
-33006,
-32979,
-32998,
-32974,
-33000,
-32977,
-32999,
-32979,
-32981,
-32985,
-32977,
-32976,
-32985,
-32965,
-32993,
-32960,
+32991,
+32989,
 32987,
-32967,
-32986,
-32976,
-32965,
-32974,
-32958,
+32983,
+32978,
 32976,
+32978,
 32970,
-32972,
 32970,
-32964,
-32963,
-32956,
-32971,
-32964,
-32981,
-32969,
-32962,
-32949,
-32951,
-32960,
-32963,
 32968,
+32963,
+32972,
 32955,
+32962,
 32949,
-32939,
-32941,
 32948,
-32955,
-32961,
-32951,
-32940,
-32930,
-32920,
-32921,
-32925,
-32929,
-32925,
+32952,
+32923,
+32924,
 32906,
-32909,
-32893,
-32892,
-32901,
-32887,
+32890,
 32886,
-32885,
-32873,
-32882,
-32860,
 32863,
-32839,
-32853,
-32836,
-32857,
-32841,
-32856,
-32832,
-32824,
-32827,
-32814,
-32832,
-32822,
+32846,
+32848,
 32828,
-32805,
-32811,
-32785,
-32806,
+32825,
+32812,
+32798,
+32804,
+32795,
 32798,
-32809,
-32799,
-32809,
-32785,
-32807,
-32781,
-32808,
-32796,
-32799,
-32793,
-32791,
-32782,
-32794,
-32780,
-32792,
-32788,
-32781,
-32788,
-32785,
-32779,
 32790,
-32766,
-32785,
-32761,
-32753,
-32759,
-32743,
-32761,
-32739,
-32752,
-32733,
-32735,
-32738,
-32715,
-32745,
-32706,
-32713,
-32702,
-32689,
-32702,
-32690,
-32688,
-32677,
-32660,
-32677,
-32649,
-32687,
-32646,
-32683,
-32649,
-32641,
-32644,
-32628,
-32644,
-32641,
-32639,
-32633,
+32786,
+32786,
+32784,
+32772,
+32754,
+32747,
+32736,
+32724,
+32703,
+32691,
+32669,
+32667,
+32655,
 32635,
+32641,
 32623,
-32621,
-32627,
-32628,
-32642,
 32633,
-32631,
-32624,
-32608,
-32616,
-32617,
-32625,
-32632,
-32609,
-32625,
-32598,
-32621,
-32601,
 32628,
-32602,
-32621,
-32594,
-32618,
-32591,
-32620,
-32591,
-32611,
-32578,
-32602,
-32585,
-32603,
-32609,
-32596,
-32600,
-32596,
-32571,
-32607,
-32573,
-32618,
-32589,
-32621,
-32590,
-32610,
-32589,
 32615,
-32602,
-32629,
-32609,
-32616,
+32623,
+32612,
+32613,
+32608,
+32604,
+32593,
+32599,
+32597,
+32588,
+32604,
+32600,
 32611,
-32618,
-32629,
+32615,
 32624,
-32643,
-32642,
-32633,
-32660,
-32632,
-32678,
+32640,
 32653,
-32676,
-32671,
-32670,
-32675,
-32683,
+32667,
+32679,
 32693,
-32699,
-32694,
 32700,
-32684,
-32720,
-32702,
+32723,
+32724,
+32736,
 32741,
-32720,
-32729,
-32721,
-32720,
-32727,
-32744,
-32740,
-32745,
-32742,
-32735,
-32745,
-32750,
-32758,
-32768,
-32750,
-32769,
-32734,
-32775,
 32751,
-32786,
-32767,
-32790,
-32761,
+32759,
+32758,
 32777,
-32760,
-32782,
-32779,
-32790,
+32770,
 32779,
-32797,
-32775,
-32806,
-32783,
-32803,
+32789,
+32793,
 32798,
-32794,
-32801,
-32803,
-32804,
-32811,
-32813,
-32809,
-32820,
-32800,
-32831,
+32806,
 32811,
-32845,
-32821,
-32843,
-32823,
-32839,
-32836,
-32834,
-32865,
+32819,
+32832,
 32834,
-32863,
-32836,
-32856,
-32860,
-32868,
-32872,
-32881,
-32877,
-32880,
-32880,
-32891,
-32888,
-32909,
-32886,
-32903,
-32886,
-32909,
-32911,
-32922,
-32920,
-32920,
-32910,
-32921,
-32925,
-32931,
-32951,
-32933,
-32940,
-32921,
-32921,
-32930,
-32934,
-32943,
-32948,
-32934,
-32935,
-32930,
-32935,
-32945,
+32847,
+32849,
+32867,
+32878,
+32889,
+32895,
+32905,
+32919,
+32919,
 32941,
-32939,
 32926,
-32924,
-32918,
-32924,
+32937,
+32937,
+32940,
+32932,
 32927,
-32918,
-32931
+32911
 };
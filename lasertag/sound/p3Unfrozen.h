@@ -1,5 +1,5 @@
-// This file was generated by executing this statement: wav2c p3Unfrozen.wav
-extern uint16_t p3Unfrozen_wav[];
-#define P3UNFROZEN_WAV_SAMPLE_RATE 480000
+// This file was generated by executing this statement: wav2c -rate 16000 p3Unfrozen.wav
+extern const uint16_t p3Unfrozen_wav[];
+#define P3UNFROZEN_WAV_SAMPLE_RATE 16000
 #define P3UNFROZEN_WAV_BITS_PER_SAMPLE 16
-#define P3UNFROZEN_WAV_NUMBER_OF_SAMPLES 98508
+#define P3UNFROZEN_WAV_NUMBER_OF_SAMPLES 32836
@@ -1,62182 +1,20732 @@
-// This file was generated by executing this statement: wav2c p4Frozen.wav
+// This file was generated by executing this statement: wav2c -rate 16000 p4Frozen.wav
 
 #include <stdint.h>
 
-uint16_t p4Frozen_wav[62176] = {
-31956,
-31780,
-31800,
-31627,
-31620,
-31452,
-31397,
-31452,
-31399,
-31450,
-31445,
-31426,
-31468,
-31470,
-31491,
-31691,
-31690,
-31912,
-31802,
-31845,
-31824,
-31757,
-31845,
-31736,
-31844,
-31759,
-31844,
-31825,
-31955,
-32023,
-32134,
-32046,
-32065,
-31981,
-31998,
-32136,
-32154,
-32312,
-32243,
-32246,
+const uint16_t p4Frozen_wav[20726] = {
 32199,
-32201,
-32243,
-32289,
-32333,
-32289,
-32355,
-32222,
-32266,
-32134,
-32089,
-32001,
-31978,
-31869,
-32000,
-31846,
-32066,
-31935,
-32002,
-31799,
-31849,
+31587,
+31465,
+31420,
+31446,
+31645,
+31844,
+31807,
 31775,
-31783,
+31881,
+32069,
+32019,
+32179,
+32252,
+32230,
+32330,
+32224,
+32003,
 31932,
-31824,
-31891,
-31866,
-31714,
-31801,
-31734,
-31782,
-31798,
-31760,
-31754,
-31737,
-31690,
-31536,
-31558,
-31446,
-31558,
-31579,
-31803,
-31801,
-31934,
-31912,
-31956,
-32112,
-32245,
-32486,
-32601,
-32708,
-32666,
-32665,
-32643,
-32752,
-32846,
-33082,
-33090,
-33260,
-33265,
-33263,
-33284,
-33354,
-33438,
-33531,
-33661,
-33595,
-33686,
-33681,
-33731,
-33815,
-33928,
-33996,
-34014,
-34151,
-34082,
-34304,
-34348,
-34439,
-34589,
-34485,
-34656,
-34638,
-34901,
-34925,
-35101,
-35124,
-35191,
-35167,
-35169,
-35167,
-35257,
-35168,
-35346,
-35255,
-35303,
-35343,
-35280,
-35345,
-35323,
-35412,
-35389,
-35568,
-35432,
-35591,
-35543,
-35589,
-35635,
-35608,
-35659,
-35608,
-35613,
-35544,
-35566,
-35590,
-35455,
-35502,
-35277,
-35324,
-35211,
-35215,
-35209,
-35349,
-35186,
-35238,
-35011,
-34947,
-34770,
-34834,
-34595,
-34745,
-34460,
-34504,
-34370,
-34282,
-34195,
-34169,
-33996,
-34038,
-33860,
-33907,
-33861,
-33794,
-33730,
-33593,
-33442,
-33417,
-33287,
-33351,
-33285,
-33176,
-33039,
-32846,
-32905,
-32868,
-33040,
-32997,
-32932,
-32775,
-32688,
-32665,
-32643,
-32863,
-32756,
-32907,
-32644,
-32665,
-32576,
-32533,
-32665,
-32598,
-32578,
-32508,
-32357,
-32420,
-32313,
-32441,
-32380,
-32374,
-32269,
-32243,
-32201,
-32155,
-32312,
-32066,
-32267,
-31978,
-32113,
-31976,
-32137,
-32086,
-32136,
-32065,
-32025,
-31888,
-31848,
-31777,
-31824,
-31802,
-31867,
-31781,
+31970,
 31821,
-31693,
-31666,
-31605,
-31577,
-31516,
-31379,
-31204,
-31026,
-30826,
-30851,
-30670,
-30850,
-30582,
-30672,
-30407,
-30516,
-30362,
-30427,
-30252,
-30206,
-30029,
-29897,
-29787,
-29694,
-29635,
-29627,
-29477,
-29521,
-29385,
-29411,
-29365,
-29319,
-29234,
-29097,
-29035,
-28831,
-28924,
-28832,
-28944,
-28945,
-28921,
-28945,
-28855,
-28900,
-28877,
-28901,
-28987,
-28990,
-29009,
-29012,
-28920,
-28925,
-28851,
-28772,
-28740,
-28615,
-28677,
-28612,
-28745,
-28700,
-28856,
-28788,
-28879,
-28810,
-28812,
-28877,
-28723,
-28922,
-28833,
-28967,
-29009,
-28946,
-29009,
-28791,
-28920,
-28768,
-28944,
-28921,
-28990,
-28986,
-29014,
-28963,
-29057,
-29031,
-29188,
-29078,
-29187,
-29056,
-29097,
-29101,
-29165,
-29231,
-29390,
-29317,
-29501,
-29318,
-29434,
-29494,
-29613,
-29760,
-29900,
-29915,
-29966,
-29960,
-30011,
-30025,
-30189,
-30269,
-30431,
-30471,
-30583,
-30628,
-30760,
-30849,
-30960,
-31115,
-31136,
-31248,
-31225,
-31337,
-31314,
-31513,
-31470,
-31689,
-31692,
-31955,
-32025,
-32221,
-32399,
-32489,
+31845,
+31843,
+31742,
+31793,
+31655,
+31488,
+31748,
+31921,
+32272,
+32683,
 32664,
-32710,
-32843,
-32974,
-33176,
-33351,
-33462,
-33707,
-33661,
-33885,
-34014,
-34219,
-34499,
-34641,
-34699,
-34906,
-34899,
-35237,
-35344,
-35656,
-35699,
-35789,
-35831,
-35790,
-36075,
-36121,
-36431,
-36518,
-36586,
-36697,
-36607,
-36763,
-36697,
-36806,
-36853,
-36894,
-37008,
-37027,
-37075,
-37182,
-37229,
-37271,
-37318,
-37272,
-37205,
-37230,
-37225,
-37320,
-37269,
-37275,
-37093,
-37008,
-36895,
-36962,
-37051,
-37073,
-37184,
-37028,
-37074,
-37071,
-37031,
-37159,
-36964,
-36983,
-36743,
-36627,
-36588,
-36495,
-36476,
-36408,
-36187,
-36121,
-35809,
-35835,
-35630,
-35724,
-35633,
-35632,
-35546,
-35566,
-35523,
-35566,
-35501,
-35455,
-35347,
-35145,
+33024,
+33258,
+33355,
+33607,
+33691,
+33906,
+34099,
+34357,
+34564,
+34824,
+35150,
+35170,
+35241,
+35310,
+35318,
+35441,
+35537,
+35623,
+35612,
+35571,
+35433,
+35227,
+35269,
 35057,
-34925,
-34923,
-34971,
-34923,
-35036,
-34857,
-35013,
-34792,
-35057,
-35014,
-35189,
-35302,
-35277,
-35304,
-35186,
-35194,
-35033,
-35191,
-35058,
-35343,
-35348,
-35520,
-35568,
-35633,
-35677,
-35723,
-35787,
-35810,
-35945,
-35852,
-35946,
-35831,
-35921,
-35855,
-35988,
-35920,
-35990,
-35873,
-35925,
-35697,
-35857,
-35698,
-35921,
-35812,
-35898,
-35921,
-35811,
-35897,
-35859,
-35916,
-35903,
-35896,
-35878,
-35856,
-35698,
-35722,
-35523,
-35655,
-35478,
-35590,
-35455,
-35501,
-35277,
-35392,
-35233,
-35324,
-35233,
-35280,
-34990,
-34993,
-34589,
-34639,
-34435,
-34418,
-34301,
-34108,
-34013,
-33798,
-33616,
-33485,
-33198,
-33039,
+34749,
+34550,
+34298,
+34032,
+33906,
+33691,
+33403,
+33255,
+32919,
+32976,
 32801,
-32618,
-32424,
-32221,
-31979,
-31846,
-31623,
-31580,
-31470,
-31424,
-31425,
-31315,
-31246,
-31072,
-31003,
-30738,
-30762,
-30448,
-30586,
-30292,
-30387,
-30182,
-30296,
-30163,
-30227,
-30187,
-30093,
-30186,
-30006,
-30008,
-29919,
-29851,
-29832,
-29738,
-29656,
-29585,
-29521,
-29563,
-29476,
-29542,
-29388,
-29386,
-29299,
-29165,
-29210,
-29077,
-29188,
-28966,
-28989,
-28788,
-28679,
-28722,
-28569,
-28810,
-28612,
-28812,
-28611,
-28634,
-28569,
-28565,
-28637,
-28698,
-28791,
-28876,
-28900,
-29034,
-28964,
-29124,
-29008,
-29168,
-29075,
-29078,
-29077,
-29098,
-29146,
-29208,
-29211,
-29341,
-29323,
-29318,
-29456,
-29386,
-29519,
-29477,
-29475,
-29365,
-29410,
-29275,
-29388,
-29342,
-29410,
-29343,
-29430,
-29323,
-29495,
-29500,
-29564,
-29518,
-29590,
-29383,
-29480,
-29472,
-29456,
-29562,
-29389,
-29430,
-29367,
-29251,
-29346,
-29162,
-29214,
-29073,
-29036,
-29052,
-28990,
-29188,
-29230,
-29346,
-29428,
-29368,
-29517,
+32700,
+32803,
+32588,
+32603,
+32423,
+32381,
+32301,
+32195,
+32146,
+32041,
+32125,
+31905,
+31805,
+31818,
+31665,
+31499,
+31023,
+30754,
+30593,
+30409,
+30179,
+29788,
+29580,
 29433,
-29609,
-29518,
-29590,
+29311,
+28995,
+28875,
+28944,
+28872,
+28962,
+28997,
+28842,
+28666,
+28690,
+28839,
+28818,
+28843,
+28988,
+28878,
+28889,
+28993,
+29028,
+29142,
+29079,
+29258,
+29397,
+29494,
+29874,
+29965,
+30164,
+30494,
+30742,
+31083,
+31260,
+31443,
+31751,
+32231,
+32616,
+33001,
+33489,
+33868,
+34448,
+34852,
+35395,
+35781,
+35998,
+36527,
+36671,
+36794,
+36968,
+37177,
+37279,
+37234,
+37283,
+37005,
+37022,
+37097,
+37078,
+36916,
+36569,
+36371,
+35896,
+35663,
+35581,
+35539,
+35327,
+34949,
+34965,
+34915,
+35059,
+35315,
+35139,
+35165,
+35497,
+35674,
+35846,
+35893,
+35904,
+35954,
+35797,
+35825,
+35890,
+35866,
+35919,
+35734,
+35577,
+35490,
+35318,
+35270,
+34895,
+34465,
+34156,
+33625,
+33027,
+32415,
+31815,
+31482,
+31332,
+30953,
+30562,
+30313,
+30210,
+30152,
+29989,
+29807,
+29589,
 29516,
-29456,
-29474,
-29389,
-29519,
-29476,
-29675,
-29630,
-29853,
-29830,
-29963,
-30052,
-30028,
-30142,
-30071,
-30032,
-30139,
-30007,
-30274,
-30139,
-30473,
-30362,
-30648,
-30585,
-30738,
-30715,
-30895,
-30935,
-31073,
-31291,
-31359,
-31645,
-31581,
-31801,
-31779,
-31936,
-32019,
-32049,
-32285,
-32247,
-32377,
-32420,
-32467,
-32620,
+29360,
+29169,
+29035,
+28711,
+28694,
+28673,
+28574,
+28791,
+28980,
+29089,
+29080,
+29145,
+29288,
+29408,
+29477,
+29366,
+29358,
+29382,
+29509,
+29512,
+29467,
+29454,
+29313,
+29160,
+29024,
+29241,
+29436,
+29535,
+29527,
+29434,
+29610,
+29877,
+30070,
+30075,
+30158,
+30472,
+30699,
+30953,
+31417,
+31745,
+32008,
+32290,
+32496,
+32871,
+33330,
+33731,
+33876,
+34034,
+34269,
+34391,
+34793,
+35070,
+35315,
+35620,
+35852,
+36254,
+36433,
+36745,
+37350,
+37680,
+37817,
+37789,
+37703,
+37814,
+37885,
+37907,
+37769,
+37312,
+37140,
+37086,
+36801,
+36657,
+36518,
+36206,
+36099,
+36006,
+36079,
+36328,
+36132,
+35749,
+35319,
+35208,
+35286,
+35155,
+34927,
+34481,
+34171,
+34004,
+33742,
+33451,
+33160,
+33073,
+32943,
+32627,
+32539,
+32793,
+32935,
+32887,
+32752,
+32747,
 32732,
-32865,
-32997,
-33219,
-33307,
-33508,
-33594,
-33707,
-33839,
-33839,
-33905,
-33884,
-33972,
-33993,
-34151,
-34192,
-34304,
-34306,
-34302,
-34417,
-34458,
-34660,
-34789,
-34950,
-34988,
-35081,
-35124,
-35166,
-35371,
-35386,
-35591,
-35610,
-35656,
-35766,
-35833,
-36008,
-36123,
-36274,
-36298,
-36430,
-36410,
-36517,
-36566,
-36760,
-36920,
-37183,
-37339,
-37515,
-37583,
-37693,
-37738,
-37758,
-37850,
-37824,
-37806,
-37824,
-37672,
-37803,
-37627,
-37782,
-37737,
-37826,
-37826,
-37915,
-37825,
-37960,
-37869,
-37916,
-37892,
-37825,
-37805,
-37626,
-37516,
-37251,
-37182,
-37185,
-37116,
-37185,
-37138,
-37031,
-37069,
-36812,
-36846,
-36746,
-36669,
-36679,
-36604,
-36566,
-36540,
-36431,
-36298,
-36252,
-36057,
-36160,
-36060,
-36115,
-36058,
-35986,
-36009,
-35989,
-36053,
-36209,
-36255,
-36384,
-36278,
-36251,
-36122,
-35987,
-35921,
-35701,
-35698,
-35368,
-35367,
-35169,
-35233,
-35192,
-35299,
-35214,
-35322,
-35235,
-35234,
-35147,
-35078,
-35058,
-34903,
-34813,
-34615,
-34503,
-34348,
-34239,
-34149,
-34127,
-34061,
-34037,
-33930,
-33792,
-33754,
-33658,
-33509,
-33552,
-33260,
-33312,
-33081,
-33112,
-33150,
-32999,
-33151,
-32932,
-32998,
-32774,
-32778,
-32597,
-32621,
-32468,
-32552,
-32600,
-32643,
-32864,
-32820,
-33021,
-32818,
-33022,
-32774,
-33021,
-32797,
-32821,
-32774,
-32646,
-32795,
-32668,
-32841,
-32753,
-32711,
-32708,
-32710,
-32710,
-32842,
-32643,
-32777,
-32508,
-32424,
-32287,
-32089,
-32202,
-31933,
-32067,
-31847,
-31799,
-31714,
-31558,
-31491,
-31425,
-31248,
-31223,
-30920,
-30843,
-30655,
-30491,
-30540,
-30385,
-30470,
-30297,
-30250,
-30052,
-30051,
-29786,
-29830,
-29631,
-29653,
-29519,
-29499,
-29386,
-29387,
-29278,
-29252,
-29168,
-29053,
-29011,
-28789,
-28723,
-28545,
-28369,
-28301,
-28125,
-28235,
-28081,
-28190,
-27970,
-28058,
-27903,
-28037,
-28057,
-28081,
-28234,
-27994,
-28100,
-27861,
-27858,
-27813,
-27751,
-27701,
-27639,
-27504,
-27393,
-27372,
-27195,
-27391,
-27242,
-27590,
-27594,
-28059,
-28144,
-28372,
-28387,
-28458,
-28391,
-28521,
-28483,
-28652,
-28726,
-28808,
-28814,
-28920,
-28857,
-29097,
-29035,
-29230,
-29168,
-29362,
-29389,
-29674,
-29920,
-30117,
-30318,
-30338,
-30275,
-30316,
-30208,
-30249,
-30186,
-30073,
-29963,
-30031,
-30026,
-30476,
-30713,
-31073,
-31136,
-31091,
-30940,
-30980,
-31027,
-31336,
-31469,
-31557,
-31515,
-31312,
-31228,
-31135,
-31204,
-31225,
-31315,
-31513,
-31624,
-32023,
-32155,
-32401,
-32487,
-32533,
-32576,
-32643,
-32799,
-32841,
-32955,
-32841,
-32843,
-32665,
-32577,
-32553,
-32601,
-32773,
-33067,
-33328,
-33351,
-33355,
-33148,
-33023,
-32930,
-32842,
-32954,
-32952,
-33086,
-33220,
-33240,
-33330,
-33219,
-32952,
-32778,
-32641,
-32712,
-32905,
-33069,
-33280,
-33401,
-33592,
-33774,
-34039,
-33993,
-34173,
-33882,
-33951,
-33904,
-34062,
-34238,
-34259,
-34505,
-34568,
-34837,
-34968,
-35036,
-35123,
-35014,
-35101,
-35167,
-35391,
-35633,
-35589,
-35545,
-35211,
-35103,
-34989,
-35282,
-35498,
-35900,
-35921,
-35986,
-35702,
-35698,
-35590,
-35611,
-35633,
-35567,
-35566,
-35656,
-35700,
-35766,
-35611,
-35478,
-35235,
-35235,
-35411,
-35567,
-35766,
-35611,
+32736,
+32682,
+32270,
+32038,
+31797,
+31492,
+31154,
+30651,
+30444,
+30231,
+29859,
+29612,
+29419,
+29231,
+28979,
+28524,
+28209,
+28095,
+27980,
+28113,
+28022,
+27793,
+27624,
+27327,
+27340,
+27971,
+28405,
+28476,
+28714,
+28888,
+29094,
+29302,
+29921,
+30314,
+30279,
+30045,
+30151,
+31001,
+31006,
+31264,
+31508,
+31147,
+31333,
+31952,
+32482,
+32662,
+32918,
+32676,
+32623,
+33264,
+33206,
+32847,
+33115,
+33267,
+32804,
+32845,
+33453,
+33949,
+34000,
+34028,
+34467,
+34973,
+35031,
+35435,
+35455,
+35095,
+35773,
+35856,
+35525,
+35667,
+35661,
+35334,
 35545,
-35212,
-35433,
-35215,
-35408,
-35083,
-34943,
-34949,
-35168,
-35765,
-36232,
-36452,
-36253,
-35812,
-35056,
-34792,
-34304,
-34481,
-34482,
-34703,
-34836,
-34946,
-35124,
-35013,
-35013,
-34637,
-34348,
-34060,
-34062,
-34191,
-34507,
-34544,
-34663,
-34344,
-34308,
-34036,
-34194,
-34151,
-34213,
-34196,
-34036,
-34041,
-34014,
-34041,
-34124,
-34108,
-33991,
-33798,
-33504,
-33155,
-32818,
-32645,
-32598,
-32708,
-32890,
-32883,
-32890,
-32619,
-32510,
-32732,
-33086,
-34040,
-34611,
-35105,
-34810,
-34152,
-33018,
-32157,
-31491,
-31491,
-31668,
-32045,
-32112,
-32001,
-31734,
-31559,
-31578,
-31626,
-31711,
-31337,
+35519,
+35312,
+34948,
+35746,
+36234,
+34718,
+34458,
+35042,
+34882,
+34144,
+34407,
+34457,
+34103,
+34178,
+34011,
+34093,
+33517,
+32607,
+32894,
+32622,
+33191,
+35068,
+33025,
+31523,
+32032,
+31680,
+31516,
+31100,
+32496,
+31208,
+30353,
+32520,
+32574,
+33121,
+33345,
+32936,
+31861,
+30866,
+32180,
+32812,
+32582,
+31640,
+30645,
+30586,
+30959,
+31633,
+31402,
+30509,
+29858,
+30250,
+30927,
+31657,
+31445,
+29322,
+28077,
+28140,
+29391,
+29152,
+29199,
+30855,
 31115,
-30982,
-31313,
-31980,
-32597,
-32667,
-32176,
-31094,
-30317,
-29940,
-30430,
-31177,
-32072,
-32440,
-32689,
-32555,
-32618,
-32646,
-32929,
-33087,
-33307,
-33375,
-33350,
-33266,
-33082,
-32935,
-32640,
-32380,
-31909,
-31362,
-30977,
-30788,
-31066,
-31605,
-32287,
-32621,
-32887,
-32687,
-32666,
-32641,
-32646,
-32529,
-32092,
-31601,
-31069,
-30808,
-30668,
-30698,
-30601,
+31327,
+31502,
+34211,
+35385,
+33737,
+33835,
+35359,
+38471,
+38730,
+37480,
+38998,
+39010,
+39386,
+40508,
+39817,
+38917,
+38309,
+37730,
+37417,
+37708,
+37282,
+36109,
+36309,
+36346,
+34447,
+34102,
+34483,
+32976,
+30677,
+30103,
+30544,
+32447,
+33181,
+31127,
+33105,
+33336,
+34170,
+36270,
+35577,
+36544,
+35877,
+34364,
+36748,
+39796,
+37975,
+33925,
+34992,
+37592,
+36150,
+33082,
+33502,
+35391,
+33569,
+31637,
+33154,
+31414,
+28555,
+28621,
+27265,
+28107,
+25937,
+22739,
+24913,
+27803,
+27146,
+22543,
+22439,
+27932,
+28526,
+20017,
+19832,
+28720,
+26218,
+20360,
+24724,
+31426,
+30053,
+25648,
+29181,
+34797,
+32653,
+28386,
+32108,
+36196,
+32584,
+29006,
+32715,
+37155,
+32200,
+30007,
+34170,
+36272,
+34400,
+29997,
+33623,
+35188,
+27331,
+27628,
+34491,
+36428,
+27815,
+28386,
+40153,
+37241,
+31670,
+33258,
+39922,
+37156,
+29105,
+32398,
+35891,
+33513,
+27439,
+34654,
+42810,
+35443,
+33540,
+40443,
+43891,
+36353,
+35431,
+41884,
+37350,
+32887,
+33027,
+35969,
+35182,
+31587,
+33141,
+35594,
+32479,
+28119,
+33478,
+35441,
+30149,
+30543,
+32077,
+32292,
+29721,
+31256,
+34296,
+30408,
+29149,
+27612,
+28129,
+31363,
+28514,
+24561,
+27014,
+31694,
+29500,
+27123,
+33685,
+31763,
+30386,
+34692,
+33397,
+32364,
+27886,
+26453,
+30174,
+29429,
+29335,
+27805,
+27791,
+33406,
+33312,
+34625,
+37616,
+38138,
+35343,
+32712,
+34727,
+37423,
+36963,
+33671,
+34748,
+38449,
+35814,
+33411,
+39571,
+42322,
+35908,
+37602,
+47456,
+47287,
+40432,
+41621,
+43753,
+41809,
+40598,
+39429,
+41388,
+40689,
+37285,
+36947,
+41592,
+41297,
+37247,
+43619,
+43176,
+36341,
+35079,
+32174,
+32756,
+30457,
+30303,
+30783,
+24163,
+26801,
 30587,
-30514,
-30717,
-30961,
-31334,
-31471,
-31667,
+30740,
+30210,
+30732,
+31226,
+26109,
+29554,
+32612,
+28574,
+29210,
+28287,
+27981,
+29354,
+30585,
+28778,
+29180,
+33031,
+29084,
+29486,
+28922,
+25910,
+29435,
+30807,
+31283,
+30292,
+27619,
+26642,
+28140,
+31504,
+25982,
+23010,
+29072,
+28081,
+23217,
+25483,
+31200,
+25552,
+20658,
+26243,
+27512,
+23919,
+21660,
+24797,
+25677,
+22540,
+25609,
+27900,
+23719,
+26820,
+32742,
+32235,
+31879,
+34025,
+37590,
+36699,
+38653,
+40104,
+39361,
+39812,
+33733,
+31705,
+35978,
+34872,
+32671,
+34733,
+36709,
+36490,
+36031,
+38189,
+40713,
+37096,
+32657,
+36610,
+39112,
+35499,
+36894,
+38752,
+36638,
+34663,
+36569,
+37457,
+33406,
+35118,
+37255,
+38364,
+39050,
+38751,
+40714,
+36067,
+35635,
+40652,
+37784,
+35428,
+36241,
+38169,
+36167,
+34834,
+37158,
+34941,
+32005,
+31137,
+30016,
+29799,
+30775,
+28183,
+27120,
+30571,
+32345,
+30874,
+29896,
+30771,
+31360,
+33437,
+31900,
+29909,
+31529,
+31114,
+31631,
+30387,
+28400,
+31627,
+33182,
+29418,
+27673,
+31489,
+28925,
+23578,
+27640,
+30600,
+27033,
+23239,
+25494,
+29700,
+29514,
+28206,
+28449,
+30332,
+31740,
+31754,
+32467,
+33046,
+30917,
+29205,
+29608,
+29968,
 31536,
-31624,
-31381,
-31224,
-30829,
-30492,
-30165,
-29960,
-29876,
-29963,
-30029,
-30163,
-30471,
-30673,
-31048,
-31181,
-31425,
 31579,
-31736,
-31756,
-31515,
-30936,
-30140,
-29256,
-28587,
-28216,
-28167,
-28059,
-28146,
-27992,
-28479,
-28767,
-29454,
-29652,
-29587,
-29231,
-28746,
-28788,
-29057,
-29893,
-30475,
-31002,
-31006,
-31070,
-30959,
-31159,
-31336,
+31127,
+32816,
+35386,
+35768,
+33085,
+35207,
+34928,
+32277,
+35204,
+36409,
+35242,
+36133,
+38068,
+38868,
+38404,
+38614,
+37540,
+35814,
+36695,
+35382,
+36097,
+36792,
+35579,
+36158,
+37664,
+38836,
+37303,
+35811,
+35896,
+33553,
+32422,
+33662,
+31100,
+30350,
+33686,
+35361,
+36753,
+36657,
+37132,
+37948,
+34695,
+33905,
+33965,
+34204,
+34040,
+30873,
+30965,
+33225,
+33063,
+32810,
+32660,
+31591,
+32510,
+33735,
+32442,
+31626,
+31673,
+29865,
+29914,
+32037,
+30489,
+28898,
+29000,
+26218,
+27086,
+27887,
+25107,
+25097,
+25454,
+27354,
+27352,
+28250,
+31317,
+27008,
+28065,
+33031,
+31723,
+32115,
+33803,
+34185,
+33454,
+34472,
+35085,
+33545,
+32238,
+31684,
+31100,
+31118,
+32716,
+32157,
+31950,
+31924,
+33371,
+35601,
+33737,
+32899,
+33273,
+33724,
+33789,
+33140,
+32363,
+31293,
+34055,
+34740,
+32152,
+32969,
+34710,
+33744,
+33089,
+35331,
+35598,
+31644,
+29967,
+32202,
+32561,
+32212,
+32873,
+33837,
+33325,
+33930,
+37752,
+38368,
+36484,
+35809,
+36668,
+36448,
+35045,
+35429,
+34843,
+32395,
+29920,
+32531,
+33278,
+30215,
+31445,
+32175,
 31425,
-31404,
-31246,
-31381,
-32024,
-33083,
-34286,
-35275,
-35504,
-35364,
-34684,
-34190,
-33820,
-33594,
-33750,
-33685,
-34127,
-34569,
-35458,
-36384,
-37517,
-38403,
-38998,
-39112,
-38844,
-38136,
-37628,
-37426,
-37672,
-38422,
-39091,
-39374,
-39312,
-38911,
-38732,
-38915,
-39483,
-40045,
-40392,
-40442,
-40284,
-40062,
-39910,
-39573,
-39291,
-38865,
-38580,
-38379,
-38380,
-38181,
-38046,
-37718,
-37445,
-37367,
-37421,
-37565,
-37668,
-37717,
-37671,
-37470,
-37318,
-36917,
-36453,
-36188,
-35852,
-36101,
-36252,
-36586,
-36652,
-36297,
-35833,
-35036,
-34502,
-34018,
-33993,
-33971,
-34418,
-34522,
-34530,
-34300,
-33532,
-32929,
-32092,
-31422,
-30829,
-30338,
-30008,
-29898,
-30071,
-30363,
-30850,
-31113,
-31626,
-32066,
-32997,
-33419,
-33529,
-32754,
-31534,
-30896,
-30912,
-32159,
-33349,
-34107,
-33838,
-33042,
-32666,
-33216,
-34374,
-35654,
-36165,
-36076,
-35678,
-35521,
-35791,
-36073,
-36390,
-36360,
-36323,
-36318,
-35944,
-35568,
-34701,
-34239,
-34347,
-35391,
-36873,
-38424,
-39289,
-39596,
-39533,
-38977,
-38225,
-36741,
-35145,
-33708,
-33283,
-33797,
-35278,
-36385,
-37364,
-37335,
-37231,
-36872,
-36276,
-35456,
-34105,
-32930,
-32357,
-32663,
-33598,
-34678,
-35326,
-35254,
-34949,
-34213,
-33709,
-32796,
-32135,
-31624,
-31667,
-32401,
-33107,
-33441,
-32777,
-31533,
-29854,
-28921,
-28436,
-28655,
-28811,
-28723,
-28191,
-27527,
-27238,
-27238,
-27816,
-28079,
-28148,
-27260,
-25931,
-24427,
-23140,
-22720,
-23009,
-23826,
-25069,
-26065,
-26971,
-27684,
-28055,
-28040,
-27322,
-25871,
-24044,
-22369,
-21456,
-21502,
-22676,
-24182,
-26132,
-27746,
-29080,
-29450,
-28681,
-26374,
-23163,
-19952,
-17868,
-17915,
-19839,
-23210,
-26349,
-28748,
-29274,
-28369,
-26287,
-23671,
-21502,
-20330,
-20524,
-22302,
-24712,
-27616,
-29786,
-31401,
-31847,
-31424,
-30119,
-28389,
-26598,
-25575,
-25624,
-27126,
-29144,
-31823,
-33509,
-34811,
-34816,
-34125,
-32688,
-30938,
-29320,
-28369,
-28589,
-29897,
-32088,
-34283,
-35810,
-36299,
-35564,
-34263,
-32418,
-30941,
-29606,
-29167,
-29386,
-30651,
-32597,
-34815,
-36651,
-37207,
-36519,
-34437,
-32133,
-30273,
-29565,
-30096,
-31314,
-32842,
-34104,
-35170,
-35787,
-36386,
-36255,
-35741,
-34308,
-32618,
-30982,
-30032,
-30335,
-31518,
-33526,
-35391,
-36031,
-35347,
-32906,
-30010,
-27193,
-25887,
-26066,
-27614,
-30074,
-32312,
-34611,
-36014,
-36825,
-36279,
-34413,
-31403,
-28015,
-25731,
-25555,
-28081,
-32532,
-37228,
-40551,
-41192,
-39642,
-36941,
-34236,
-32755,
-31890,
-31890,
-32133,
-33020,
-34946,
-37450,
-40086,
-41169,
-40108,
-37184,
-33373,
-30430,
-28964,
-29434,
-30758,
-32600,
-33971,
-35124,
-35678,
-35921,
-35190,
-33706,
+31281,
+33957,
+35900,
+32748,
+32810,
+34888,
+32766,
+33402,
+34700,
+33467,
+32566,
+31713,
+32083,
+31291,
+32212,
+32324,
+31295,
 31203,
-28878,
-27326,
-27861,
-30426,
-34660,
-39065,
-42058,
-42941,
-41261,
-38467,
-35257,
-33374,
-32688,
-33705,
-35501,
-37870,
-40395,
-42545,
-43828,
-43938,
-42324,
-39596,
-36433,
-34169,
-33642,
-35366,
-37981,
-40840,
-42076,
-41617,
-39506,
-37187,
-34898,
-33866,
-33082,
+30841,
+32605,
+31672,
+31073,
+31711,
+32169,
+32849,
+32865,
+33182,
+32762,
+33294,
+33302,
+34188,
+34934,
+35560,
+35753,
+35515,
+37293,
+35598,
+34788,
+34137,
+32735,
+33698,
+32429,
+32521,
+32368,
+31725,
+32802,
+33345,
 32911,
-32599,
-32751,
-33555,
-34832,
-36168,
-36828,
-36408,
-35014,
-33439,
-32135,
-31712,
-31779,
-32378,
-33107,
-33973,
-34968,
-35634,
-35478,
-34524,
-32358,
-30292,
-28615,
-28145,
-29054,
-31139,
-33328,
-35368,
-36121,
-35499,
-33862,
-31668,
-30075,
-29385,
-29788,
-30581,
-31470,
-31868,
-32044,
-32136,
-32263,
-32270,
+31144,
+31448,
+33498,
+33177,
+31904,
+33396,
+33951,
+32238,
+33667,
+33515,
 31820,
-30986,
-29716,
-29300,
-29542,
-31158,
-32933,
-34391,
-34505,
-33439,
-31670,
-30116,
+31494,
+30900,
+31195,
+32243,
+32838,
+31182,
+32063,
+33211,
+31692,
+32100,
+32629,
+31233,
+31024,
+32070,
+32307,
+33874,
+34622,
+33203,
+32148,
+34261,
+35591,
+32571,
+32665,
+34668,
+33434,
+34674,
+34882,
+33120,
+35326,
+34709,
+34270,
+34733,
+32856,
+31982,
+29217,
+29783,
+30745,
+28726,
+28166,
+28339,
+29198,
+29460,
+31157,
+31411,
+29438,
+30007,
+31589,
+32159,
+31710,
+31533,
+32865,
+32444,
+32724,
+35407,
+35844,
+36188,
+35937,
+35650,
+37756,
+39076,
+37936,
+37379,
+38477,
+37689,
+37799,
+38652,
+37784,
+37252,
+35187,
+33575,
+34297,
+33936,
+33382,
+32118,
+32051,
+32029,
+31561,
+33830,
+33062,
+32108,
+32048,
+32219,
+33961,
+33849,
+33792,
+32909,
+32766,
+33808,
+33119,
+33106,
+31960,
 29368,
-29339,
-29501,
-29118,
-28305,
-27214,
-26864,
-27281,
-28502,
-29808,
-30694,
-30959,
-30783,
-30028,
-28991,
-27214,
-25424,
-24092,
-24115,
-25359,
-27523,
-29390,
-30735,
-31184,
-31291,
-30850,
-30027,
-28459,
-26993,
-26754,
-28078,
-31271,
-34015,
-35257,
-34017,
-31424,
-29367,
-29052,
-30607,
-32841,
-34240,
-34590,
-33974,
-33571,
-33464,
-33595,
-33307,
-32290,
-30892,
-29254,
-27881,
-26840,
-26376,
-26439,
-27484,
-28743,
-30098,
-30670,
-30363,
-29607,
-28902,
-28743,
-29144,
-29388,
-29097,
-28083,
-26927,
-26574,
-27417,
-29651,
-31914,
-33838,
-34195,
-33748,
-32934,
-32773,
-33686,
-34924,
-36319,
-36875,
-37316,
-37582,
-38115,
-38400,
-38160,
-36807,
-35101,
-33575,
-32773,
-32978,
-33417,
-33971,
-34595,
-35298,
-36499,
-37559,
-38137,
-37891,
-36831,
-35521,
-34438,
-33773,
-33617,
-33905,
-34549,
-35988,
-37337,
-38715,
-38575,
-37653,
-35586,
-33974,
-33084,
-33598,
-35032,
-37165,
-39439,
-41373,
-42542,
-42522,
-40862,
-38355,
-35768,
-34436,
-35213,
-37671,
-41347,
-44694,
-47437,
-48636,
-48657,
-47327,
-45071,
-42564,
-40396,
-39599,
-40061,
-41528,
-43182,
-43899,
-43959,
-43032,
-42234,
-41657,
-41370,
-41260,
-40793,
-40086,
-39420,
-39222,
-39709,
-40638,
-41637,
-41855,
-41617,
-40458,
-39381,
-38197,
-37455,
-36780,
-36567,
-36828,
-37981,
-39776,
-41678,
-42789,
-42698,
-41216,
-39220,
-37583,
-37361,
-38600,
-40974,
-43515,
-45094,
-45000,
-43364,
-40618,
-37979,
-36123,
-35498,
-35412,
-35281,
-34456,
-33178,
-31953,
-31715,
-32133,
-32887,
-32953,
-31912,
-30427,
-29256,
-29187,
-30317,
-31537,
-32020,
-30830,
-28498,
-25824,
-24091,
-23741,
-25045,
-26861,
-28746,
-30028,
-30429,
-30739,
-30627,
-30781,
-30762,
-30626,
-30208,
-30007,
-30006,
-30695,
-31469,
-31824,
-31379,
-29633,
-27656,
-26046,
-25820,
-27216,
-29609,
-31800,
-32977,
-32665,
-31137,
-29652,
-28457,
-28391,
-28788,
-29256,
-29340,
-28902,
-28278,
-27727,
-27660,
-27967,
-28437,
-29097,
-29411,
-29808,
-30205,
-30275,
-30515,
-29809,
-29120,
-28171,
-27944,
-28904,
-30601,
-32536,
-33415,
-32623,
-30715,
-28768,
-27814,
-28545,
-29763,
-30652,
-30247,
-28572,
-26970,
-25910,
-26177,
-27125,
-28259,
-29233,
-29962,
-30494,
-31028,
-31244,
-31230,
-31112,
+27738,
+27482,
+27938,
+24633,
+21397,
+20498,
+18087,
+18689,
+17229,
+16064,
+17461,
+15412,
+16799,
+18296,
+16885,
+16631,
+17208,
+17580,
+19084,
+18562,
+18739,
+19784,
+16816,
+19453,
+20541,
+20168,
+22106,
+19666,
+22269,
+25622,
+26021,
+27268,
+29575,
+32173,
+32706,
+34486,
+40238,
+44162,
+42649,
+46784,
+49433,
+50823,
+55309,
+54961,
+57613,
+57335,
+58343,
+62768,
+62225,
+63123,
+64120,
+65161,
+65530,
+65390,
+65534,
+65493,
+65534,
+65468,
+65534,
+65280,
+65534,
+62072,
+59215,
+59574,
+55383,
+53361,
+47828,
+44733,
+44603,
+40869,
+39608,
+35741,
+33591,
+33187,
+29491,
+27320,
+25137,
+22882,
+20650,
+17401,
+17129,
+17702,
+15065,
+13176,
+12853,
+13295,
+15243,
+14146,
+12129,
+10247,
+11457,
+12694,
+9148,
+8983,
+7515,
+5941,
+7289,
+5636,
+6475,
+7155,
+5122,
+4767,
+4806,
+5197,
+5035,
+3353,
+2093,
+2224,
+1921,
+849,
+31,
+65535,
+4,
+14,
+65535,
+56,
+65535,
+95,
+65535,
+948,
+5770,
+5332,
+8408,
+19172,
+23290,
 30916,
-30893,
-30451,
-29762,
-28504,
-27413,
-26709,
-26638,
-26864,
-27128,
-27304,
-27992,
-29032,
-30782,
-31627,
-31222,
-29013,
-25775,
-23298,
-22053,
-23210,
-25154,
-27507,
-29031,
-29565,
-29187,
-28126,
-26439,
-24716,
-23161,
-22744,
-23494,
-25511,
-28016,
-30158,
-31165,
-30555,
-28528,
-25707,
-22721,
-20883,
-20481,
-21792,
-24180,
-26397,
-27883,
-27989,
-27263,
-26261,
-25115,
-24247,
-22964,
-22057,
-21365,
-21906,
-23158,
-25072,
-26216,
-26466,
-25510,
-24071,
-23098,
-22563,
-23208,
-24094,
-25621,
-26841,
-27835,
-27905,
-26948,
-25337,
-23803,
-23253,
-24336,
-26664,
-29519,
-31802,
-32930,
-33020,
-32467,
-31933,
-31891,
-31911,
-32178,
-32422,
-32777,
-33725,
-35195,
-36758,
-37896,
-38002,
-37249,
-36477,
-36295,
-37364,
-38842,
-40131,
-40439,
-39974,
-39201,
-39087,
-39422,
-40150,
-40441,
-39707,
-38183,
-35942,
-33795,
-32066,
-31360,
-31688,
-32913,
-34654,
-35970,
-36537,
-36035,
-34811,
-33620,
-32796,
-32712,
-33194,
-33819,
-34701,
-35480,
-36252,
-36764,
-36961,
-36785,
-36455,
-36073,
-35946,
-36074,
-36543,
-37161,
-38158,
-39200,
-40283,
-40751,
-40461,
-39067,
-37006,
-34858,
-33330,
-32709,
-33353,
-34635,
-36542,
-38180,
-39244,
-39156,
-38245,
-36675,
-35434,
-35056,
-35614,
-36959,
-38116,
-38910,
-38735,
-38180,
-37339,
-36563,
-35833,
-35278,
-34726,
-34835,
-35280,
-36429,
-37539,
-38047,
-37693,
-36188,
-34546,
-33199,
-33039,
-33886,
-35255,
-36497,
-36985,
-37161,
-37206,
-37694,
-38466,
-39114,
-39351,
-38936,
-38533,
-38292,
-38846,
-39751,
-40464,
-40658,
-39734,
-38156,
-36189,
-34746,
-34436,
-35414,
-37559,
-39531,
-40951,
-40635,
-39381,
-37513,
-36188,
-35633,
-35678,
-35854,
-35877,
-36009,
-36499,
-37558,
-38293,
-38577,
-37496,
-36075,
-34636,
-34349,
-34902,
-36032,
-36919,
-37116,
-36652,
-35966,
-34857,
-33973,
-32931,
-32022,
-31426,
-31179,
-31074,
-30978,
-30564,
-30116,
-29543,
-29542,
-29698,
-30338,
-30718,
-30802,
-30276,
-29362,
-28172,
-27280,
-26775,
-27084,
-27946,
-29387,
-30629,
-31710,
-32071,
-32330,
-31846,
-31714,
-30913,
-30476,
-29915,
-29700,
-30005,
-30452,
-30914,
-31160,
-31025,
-31315,
-31712,
-32688,
-33595,
-33706,
-33153,
-31801,
-30561,
-29830,
-30008,
-30515,
-31250,
-31400,
-31538,
-31180,
-31225,
-31159,
-31470,
-31557,
-31536,
-31226,
-30448,
-29457,
-28652,
-28261,
-28897,
-30165,
-31689,
-32998,
-33373,
-33153,
-32067,
-30916,
-29431,
-28368,
-27527,
-27636,
-28570,
-30071,
-31538,
-31954,
-31095,
-28942,
-26355,
-24356,
-23476,
-24202,
-25668,
-27791,
-29299,
-30450,
-30451,
-29961,
-28681,
-27103,
-25447,
-23937,
-23251,
-23164,
-24093,
-25467,
-27261,
-28678,
-29741,
-30008,
-29963,
-29519,
-28968,
-28544,
-28213,
-28126,
-28100,
-28482,
-28831,
-29699,
-30316,
-31048,
-31472,
-31708,
-31763,
-31796,
-31739,
-31909,
-32070,
-32485,
-32845,
-33084,
-32999,
-32664,
-31825,
-30980,
-30008,
-29497,
-29123,
-29319,
-29344,
-29695,
-29632,
-29875,
-29940,
-30384,
-30915,
-31492,
-31844,
-31981,
-31600,
-31315,
-30938,
-30981,
-31468,
-32159,
-32972,
-33732,
-34477,
-35194,
-35918,
-36235,
-35897,
-35011,
-33755,
-32970,
-32981,
-34012,
-35325,
-36143,
-36007,
-34818,
-33435,
-32427,
-32307,
-33021,
-34105,
-35234,
-35965,
-36388,
-36317,
-36102,
-35741,
-35237,
-35321,
-35280,
-36120,
-36741,
-37693,
-38180,
-38580,
-38645,
-38645,
-38736,
-38642,
-38694,
-38464,
-38384,
-38377,
-38336,
-38336,
-37802,
-37009,
-36030,
-35457,
-35743,
-36365,
-37073,
-36873,
-36078,
-35054,
-34706,
-35300,
-36431,
-37139,
-37228,
-36474,
-35857,
-35632,
-35788,
-36055,
-36096,
-35924,
-36186,
-36762,
-37850,
-38664,
-38983,
-38640,
-38273,
-37735,
-37516,
-36854,
-36295,
-35723,
-35477,
-35789,
-35966,
-35744,
-34836,
-33439,
-32356,
-32133,
-32445,
-33284,
-33685,
-33550,
-32999,
-32043,
-31183,
-30448,
-30098,
-30293,
-31118,
-32373,
-33777,
-34633,
-35214,
-35301,
-35655,
-36054,
-36808,
-37049,
-37163,
-36674,
-36385,
-36433,
-37091,
-37831,
-38264,
-38096,
-37003,
-35814,
-34566,
-33998,
-33747,
-34063,
-34060,
-34149,
-33861,
-33818,
-33881,
-34263,
-34545,
-34550,
-34038,
-33040,
-31870,
-30825,
-30363,
-30427,
-31005,
-31823,
-32598,
-33199,
-33393,
-33355,
-33129,
-32863,
-32757,
-32729,
-32822,
-32930,
-32687,
-32378,
-31846,
-31513,
-31535,
-31912,
-32644,
-33151,
-33642,
-33638,
-33418,
-33043,
-32509,
-32068,
-31646,
-31558,
-31579,
-31847,
-31734,
-31403,
-30561,
-29741,
-29276,
-29389,
-30048,
-30897,
-31599,
-31870,
-31822,
-31337,
-30604,
-29853,
-29056,
-28786,
-28859,
-29118,
-29123,
-28479,
-27282,
-26132,
-25621,
-26066,
-27170,
-28149,
-28410,
-27839,
-26750,
-25755,
-25156,
-24979,
-25002,
-25046,
-25067,
-25202,
-25532,
-26043,
-26685,
-27260,
-27616,
-27725,
-27416,
-27261,
-27304,
-28149,
-29494,
-30854,
-31419,
-30721,
-28918,
-26910,
-25840,
-26289,
-28122,
-30429,
-32246,
-33039,
-32800,
-32265,
-31647,
-31581,
-31710,
-32226,
-32638,
-33269,
-33678,
-34155,
-34343,
-34198,
-34058,
-33530,
-33463,
-33461,
-33884,
-34526,
-34990,
-35303,
-35055,
-34682,
-33993,
-33530,
-32997,
-32710,
-32332,
-32001,
-31713,
-31558,
-31468,
-31448,
-31247,
-30959,
-30874,
-30889,
-31584,
-32219,
-32889,
-32951,
-32579,
-32087,
-31626,
-31845,
-31934,
-32334,
-32022,
-31935,
-31799,
-32403,
-33394,
-34571,
-35390,
-35587,
-35147,
-34549,
-33682,
-33288,
+39796,
+47055,
+54183,
+58415,
+64817,
+65534,
+65310,
+65534,
+65394,
+65534,
+65477,
+65534,
+65521,
+65534,
+65534,
+65529,
+65534,
+65513,
+65534,
+65482,
+65534,
+65450,
+65534,
+64468,
+59303,
+54940,
+48839,
+43821,
+41340,
+35250,
+31401,
+26947,
+24787,
+25714,
+24731,
+26975,
+30984,
+34185,
+36809,
+41255,
+47017,
+51748,
+53472,
+53277,
+54198,
+55308,
+55508,
+53098,
+49758,
+47234,
+44992,
+43296,
+40923,
+37885,
+35013,
 32884,
-32866,
-32997,
-33130,
-33353,
-33438,
-33509,
-33661,
-33794,
-33908,
-33946,
-33600,
-33370,
-32978,
-32863,
-32754,
-32488,
-32023,
-31402,
-31138,
-31601,
-32776,
-34238,
-35101,
-35369,
-34591,
-33596,
-32710,
-32220,
-32226,
-32439,
-32913,
-33526,
-34196,
-34789,
-34816,
-34479,
-33731,
-33061,
-32800,
-33063,
-33818,
-34547,
-35413,
-35808,
-35945,
-35610,
-34548,
-33288,
-31643,
-30474,
-29762,
-29943,
-30603,
-31473,
-32262,
-32668,
-32686,
-32510,
-32312,
-32221,
-32245,
-32377,
-32599,
-32819,
-33243,
-33505,
-33907,
-33838,
-33752,
-33284,
-33088,
-33238,
-33909,
-35098,
-36523,
-37779,
-38469,
-38802,
-38311,
-37761,
-37072,
-36342,
-36167,
-35807,
-35968,
-35963,
-36234,
-36583,
-36766,
-36980,
-36522,
-36032,
-35255,
-34904,
-34879,
-35300,
-35525,
-35697,
-35237,
-34767,
-33952,
-33372,
-32489,
-31535,
-30451,
-29851,
-30009,
-31068,
-32600,
-33728,
-34039,
-33263,
-31956,
-30805,
-30162,
-30317,
-30850,
-31467,
-31981,
-32132,
-32134,
-31935,
-31756,
-31447,
-31314,
-31027,
-31291,
-31692,
-32796,
-33995,
-35191,
-35898,
-35811,
-35168,
-33905,
-32776,
-32113,
-32065,
-32844,
-33772,
-34613,
-34883,
-34479,
-33641,
-32797,
-32401,
-32596,
-33378,
-34123,
-34817,
-34723,
-34460,
-33773,
-33373,
-33065,
-32952,
-32688,
-32333,
-31800,
-31604,
-31644,
-31914,
-32288,
-32023,
-31756,
-31116,
-31157,
-31539,
-32219,
-32845,
-32752,
-32422,
-31624,
-31315,
-31157,
-31495,
-31443,
-31384,
-30823,
-30653,
-30669,
-31339,
-32109,
-32756,
-32795,
-32270,
-31599,
-30939,
-31005,
-31045,
-31561,
-31645,
-31689,
-31694,
-31753,
-32182,
-32507,
-32932,
-32864,
-32865,
-32688,
-32708,
-32999,
-33261,
-33288,
-33195,
-32754,
-32689,
-32662,
-33090,
-33370,
-33598,
-33395,
-33219,
-33219,
-33662,
-34193,
-34792,
-34946,
-34925,
-34946,
-35013,
-35611,
-35877,
-36099,
-35787,
-35413,
-35210,
-35436,
-36141,
-36853,
-37404,
-37183,
-36433,
-35652,
-34794,
-34746,
-34658,
-35015,
-34746,
-34171,
-33486,
-32664,
-32710,
-32975,
-33508,
-33882,
-33552,
-32975,
-32288,
-31981,
-32241,
-32668,
-32884,
-32778,
-32199,
-31824,
-31602,
-31779,
-32266,
-32467,
-32752,
-32911,
-33129,
-33418,
-33487,
-33348,
-32869,
-32240,
-31672,
-31112,
-31028,
-30981,
-31425,
-32045,
-32931,
-33506,
-33907,
-33572,
-33153,
-32444,
-32110,
-32003,
-32219,
-32713,
-33260,
-33886,
-34147,
-34084,
-33462,
-32710,
-32111,
-32200,
-32887,
-33728,
-34304,
-34150,
-33417,
-32711,
-31977,
-31891,
-31778,
-31781,
-31512,
-31160,
-30959,
-30805,
-30960,
-31114,
-31248,
-31492,
-31689,
-32180,
-32618,
-33022,
-32841,
-32511,
-31668,
-31159,
-30959,
-31315,
-32110,
-32845,
-33305,
-33242,
-32687,
-32111,
-31647,
-31558,
-31800,
-32202,
-32420,
-32710,
-32445,
-32309,
-31803,
-31334,
-31006,
-30649,
-31027,
-31201,
-31915,
-32175,
-32291,
-32176,
-32180,
-32508,
-33198,
-34017,
-34523,
-34795,
-34412,
-34218,
-33660,
-33354,
-32773,
-32335,
-32067,
-32310,
-33154,
-34325,
-35412,
-35743,
-35635,
-34546,
-33665,
-32528,
-32160,
-32063,
-32647,
-33504,
-34196,
-34745,
-34505,
-33993,
-33441,
-33330,
-33794,
-34682,
-35343,
-35502,
-34857,
-33995,
-33218,
-33154,
-33637,
-34530,
-35296,
-35616,
-35341,
-34795,
-34147,
-34040,
-34104,
-34680,
-34971,
-34811,
-34307,
-33349,
-32734,
-32420,
-32312,
-32199,
-31337,
-30250,
-29056,
-28611,
-28923,
-29918,
-30716,
-31092,
-30717,
-29874,
-29254,
-28657,
-28566,
-28391,
-28192,
-27990,
-28104,
-28212,
-28745,
-29033,
-29276,
-29321,
-29187,
-29410,
-29851,
-30451,
-31270,
-31667,
-31781,
-31356,
-30675,
-29960,
-29478,
-29318,
-29589,
-29894,
-30631,
-31089,
-31582,
-31977,
-32112,
-32134,
-32112,
-31867,
-31735,
-31492,
-31467,
-31494,
-31955,
-32355,
-32866,
-32995,
-32911,
-32398,
-32267,
-32066,
-32734,
-33549,
-34682,
-35411,
-35920,
-35880,
-35785,
-35813,
-35919,
-36254,
-36365,
-36252,
-35945,
-35499,
-35479,
-35611,
-36253,
-36941,
-37825,
-38425,
-38866,
-39045,
-38867,
-38601,
-37892,
-37583,
-37161,
-37361,
-37715,
-38180,
-38580,
-38469,
-38111,
-37652,
-37336,
-37452,
-37869,
-38291,
-38602,
-38667,
-38292,
-38157,
-37761,
-37692,
-37472,
-37228,
-36719,
-36053,
-35235,
-34416,
-33814,
-33490,
-33699,
-33956,
-34367,
-34395,
-34259,
-33927,
-33641,
-33461,
-33399,
-33126,
-32669,
 32198,
-31713,
-31803,
-31931,
-32291,
-32422,
-32109,
-31649,
-31312,
-31426,
-32178,
-33152,
-33928,
-34148,
-33709,
-32950,
-32402,
-32043,
-32200,
-32268,
-32287,
-32025,
-31777,
-31802,
-32223,
-32863,
-33620,
-33925,
-34130,
-33903,
-33907,
-33661,
-33929,
-33728,
-33728,
-33263,
-32931,
-32577,
-32488,
-32798,
-33152,
-33684,
-33796,
-33749,
-33353,
-33130,
-32930,
-33043,
-33152,
-33064,
-32643,
-31912,
-31026,
-30184,
-29411,
-28809,
-28082,
-27768,
-27285,
-27414,
-27529,
-27879,
-28014,
-27815,
-27238,
-26153,
-24738,
-23248,
-22060,
-21254,
-21062,
-20857,
-20618,
-19840,
-18865,
-18027,
-17754,
-18119,
-18750,
-18892,
-18398,
-17185,
-16229,
-15566,
-16076,
-16783,
-17539,
-17556,
-16920,
-15962,
-15281,
-15252,
-15945,
-16960,
-17803,
-18225,
-18155,
-17805,
-17315,
-17071,
-16653,
-16649,
-16543,
-16693,
-16963,
-17182,
-17448,
-17472,
-17668,
-17893,
-18423,
-18998,
-19333,
-19129,
-18737,
-18154,
-18160,
-18531,
-19489,
-19949,
-20021,
-18885,
-17717,
-16649,
-16829,
-17893,
-19505,
-20753,
-21033,
-20596,
-19752,
-19618,
-20041,
-21213,
-22034,
-22255,
-21457,
-20351,
-19553,
-19595,
-20796,
-22341,
-24027,
-25026,
-25530,
-25691,
-25730,
-26132,
-26396,
-26952,
-27237,
-27838,
-28432,
-29502,
-30622,
-31674,
-32328,
-32557,
-32488,
-32531,
-32800,
-33616,
-34614,
-36255,
-37936,
-40085,
-42080,
-43583,
-44406,
-43894,
-43231,
-42499,
-43032,
-44580,
-46799,
-48698,
-49503,
-49538,
-49149,
-49473,
-50698,
-52641,
-54418,
-55500,
-55435,
-55126,
-54725,
-55434,
-56367,
-57846,
-58229,
-58179,
-57230,
-56742,
-56961,
-58317,
-60194,
-61972,
-62918,
-62879,
-62412,
-62012,
-62170,
-62743,
-63363,
-63765,
-63740,
-63828,
-64165,
-64911,
-65534,
-65533,
-65534,
-65248,
-65246,
+30814,
+26934,
+23572,
+20832,
+18052,
+15019,
+11755,
+8917,
+4793,
+636,
+65535,
+91,
+65535,
+41,
+65535,
+16,
+65535,
+1,
+1,
+65535,
+6,
+65535,
+8,
+65535,
+1,
+17,
+65535,
+106,
+65535,
+278,
+65535,
+619,
+65535,
+1449,
+14228,
+24225,
+37039,
+45988,
+54627,
+60789,
+56294,
+58216,
+61406,
 65534,
+61160,
+55565,
+59969,
+62207,
+65165,
 65534,
+65321,
 65534,
+65371,
 65534,
+65415,
 65534,
+65492,
+65481,
 65534,
-65533,
+61164,
+56765,
+47977,
+36699,
+28076,
+23527,
+24933,
+20503,
+17683,
+14855,
+12816,
+15434,
+13113,
+10938,
+9432,
+9928,
+7521,
+7053,
+15696,
+17922,
+21067,
+27110,
+30396,
+40221,
+51091,
+56738,
+60349,
+63991,
 65534,
-65533,
+65494,
 65534,
+65446,
 65534,
+62980,
+58649,
+54312,
+52225,
+48749,
+43261,
+42926,
+41663,
+45467,
+46475,
+40844,
+39759,
+36892,
+34018,
+30412,
+25019,
+16376,
+10938,
+10181,
+2706,
+12,
+1605,
+26,
+15,
+12,
+65535,
+36,
+65535,
+26,
+65535,
+19,
+65535,
+54,
+65535,
+119,
+65535,
+148,
+65535,
+65535,
+338,
+65535,
+8810,
+20227,
+41740,
+63614,
+65043,
 65534,
+65391,
 65534,
+65320,
 65534,
+64719,
+61393,
+65095,
 65534,
+65250,
 65534,
+65319,
 65534,
+65392,
 65534,
+65502,
+65428,
 65534,
+57186,
+40137,
+24372,
+15296,
+5255,
+65535,
+590,
+65535,
+1702,
+2081,
+6749,
+11855,
+9342,
+15274,
+18687,
+14605,
+13541,
+18124,
+15700,
+14363,
+28319,
+37637,
+45976,
+57630,
+63540,
 65534,
+65467,
+65526,
 65534,
+65435,
 65534,
-65533,
+65325,
 65534,
-64648,
-62257,
-60065,
-58933,
-59068,
-59731,
-60242,
-59754,
-58402,
-56676,
-55101,
-54506,
-53951,
-53617,
-52180,
-50206,
-47661,
-45801,
-44691,
-44847,
-45159,
-45332,
-44585,
-43294,
-41881,
-40772,
-40371,
-40066,
-39728,
-38692,
-37293,
-35613,
-34434,
-33710,
-33702,
-33755,
-33747,
-33089,
-32130,
-30720,
-29539,
-28547,
-27859,
-27303,
-26710,
-25973,
-25202,
-24249,
-23517,
-22853,
-22277,
-21612,
-20683,
-19508,
-18379,
-17293,
-16874,
-16782,
-17294,
-17583,
-17800,
-17585,
-17002,
-16210,
-15190,
-14258,
-13439,
-13042,
-12884,
-12998,
-12997,
-12949,
-12934,
-13104,
-13796,
-14679,
-15367,
-15519,
-14950,
-14055,
-13155,
-12575,
-12264,
-11625,
-11023,
-10164,
-9916,
-10407,
-11442,
-12647,
-13037,
-12755,
-11490,
-10227,
-9121,
-8722,
-8743,
-8988,
-8943,
-8434,
-7569,
-6509,
-5994,
-5823,
-6460,
-7019,
-7324,
-7106,
-6240,
-5665,
-5223,
-5798,
-6484,
-7282,
-7481,
-7105,
-6396,
-5622,
-5153,
-4892,
-4866,
-4692,
-4845,
-4558,
-4910,
-4804,
-5198,
-5224,
-5287,
-5222,
-4868,
-4714,
-3980,
-3496,
-2740,
-2276,
-2034,
-1965,
-2210,
-2277,
-2385,
-2056,
-1789,
-1544,
-1237,
-1123,
-504,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-65535,
-1,
-65535,
-3,
-65535,
-0,
-65535,
+65048,
+63559,
+57228,
+48190,
+48389,
+46125,
+45080,
+44928,
+42065,
+41387,
+43659,
+47762,
+39816,
+34803,
+32112,
+26805,
+26666,
+23172,
+18073,
+15797,
+15971,
+11535,
+7177,
+9155,
+6094,
+593,
 65535,
-1,
+12,
 65535,
+21,
 65535,
+18,
 65535,
+7,
 65535,
+17,
 65535,
+61,
 65535,
+113,
 65535,
-0,
+68,
+51,
 65535,
-305,
-2697,
-4734,
-5777,
-6152,
-5797,
-5424,
-5307,
-6112,
-8341,
-11694,
-15783,
-19225,
-21564,
-22614,
-23203,
-24650,
-27126,
-30961,
-34614,
-37781,
-39953,
-41746,
-43896,
-46840,
-49875,
-52911,
-54503,
-55635,
-56255,
-57758,
-60333,
-63804,
+882,
+2204,
+25708,
+46286,
+50549,
+55848,
+49740,
+50642,
+57747,
+64269,
 65534,
-65533,
+65119,
 65534,
+65376,
 65534,
 65534,
+65442,
 65534,
-65533,
+65310,
 65534,
+65224,
 65534,
+64701,
+49713,
+33904,
+23707,
+23969,
+25147,
+21815,
+18522,
+17055,
+21492,
+19148,
+17971,
+15379,
+7895,
+6225,
+7374,
+9945,
+15054,
+30200,
+37860,
+41441,
+59335,
 65534,
+65057,
 65534,
+65331,
 65534,
-65532,
+65475,
 65534,
-65533,
+65520,
 65534,
+65491,
 65534,
+65456,
 65534,
+65489,
+65511,
 65534,
+58574,
+53062,
+48043,
+38475,
+32777,
+27906,
+25881,
+29877,
+32082,
+30393,
+31140,
+31240,
+28466,
+24427,
+17063,
+9705,
+2573,
+65535,
+208,
+65535,
+55,
+65535,
+65535,
+11,
+65535,
+11,
+65535,
+65535,
+23,
+65535,
+74,
+65535,
+96,
+65535,
+65535,
+270,
+65535,
+1212,
+65535,
+10036,
+24241,
+38018,
+64175,
 65534,
+64730,
 65534,
-65532,
+60301,
+57008,
+63653,
 65534,
-65533,
+65105,
 65534,
+65410,
 65534,
 65534,
+65339,
 65534,
+65234,
 65534,
-65532,
+65068,
+55459,
+50463,
+39649,
+23319,
+15703,
+16047,
+20751,
+27172,
+23195,
+14522,
+14765,
+5498,
+65535,
+346,
+65535,
+103,
+498,
+9627,
+20886,
+42269,
+64107,
 65534,
-65533,
+65335,
 65534,
+65370,
 65534,
 65534,
+65027,
+59673,
+50790,
+45637,
+41046,
+40825,
+47823,
+52413,
+62066,
+64764,
+62429,
 65534,
+54408,
+42287,
+41714,
+29429,
+21406,
+20598,
+17692,
+23426,
+40778,
+44942,
+45667,
+54307,
+49963,
+44870,
+40791,
+25186,
+11428,
+3941,
+65535,
+59,
+65535,
+65535,
+36,
+65535,
+31,
+65535,
+9,
+65535,
+9,
+65535,
+70,
+65535,
+195,
+65535,
+304,
+65535,
+233,
+65535,
+1299,
+29630,
+48288,
+54683,
 65534,
+65338,
+65294,
 65534,
+62738,
+62518,
 65534,
+65452,
 65534,
 65534,
+65512,
 65534,
+65514,
 65534,
-65531,
+65436,
 65534,
-65530,
+52282,
+24991,
+11448,
+22906,
+35692,
+36043,
+35225,
+34747,
+32294,
+25692,
+9171,
+65535,
+410,
+65535,
+297,
+65535,
+3382,
+24868,
+48809,
+61033,
 65534,
-65531,
 65534,
-65532,
+65353,
 65534,
-65533,
-65534,
-65532,
+61765,
+54699,
+48628,
+46137,
+48566,
+58170,
 65534,
-65531,
-65516,
-64581,
-62900,
-61193,
-59311,
-57716,
-56232,
-54861,
-53282,
-51254,
-48962,
-46644,
-44847,
-43650,
-43100,
-42519,
-41527,
-39685,
-37407,
-35011,
-33465,
-32242,
-31670,
-30340,
-28810,
-26796,
-25334,
-24625,
-24889,
-25382,
-25838,
-25693,
-25241,
-24783,
-24689,
-25092,
-25998,
-26971,
-28371,
-29473,
-30962,
-32132,
-33353,
-34281,
-35059,
-35786,
-36743,
-37957,
-39488,
-41393,
-43095,
-45249,
-46926,
-48772,
-50358,
-51762,
-52751,
-53400,
-53395,
-53443,
-53196,
-53288,
-53484,
-53775,
-54238,
-54615,
-54949,
-55344,
-55460,
-55741,
-55461,
-55054,
-54221,
-53061,
-51937,
-50718,
-49740,
-48880,
-48103,
-47216,
-46489,
-45599,
-44958,
-44383,
-43894,
-43363,
-42656,
-41857,
-40771,
-39932,
-38886,
-38007,
-36959,
-35901,
-34924,
-34060,
-33463,
-32997,
-32622,
-32353,
-32026,
-31908,
-31561,
-30936,
-29852,
-28392,
-26749,
-25513,
-24468,
-23696,
-22919,
-21768,
-20726,
-19642,
-18931,
-18182,
-17379,
-16123,
-14898,
-13598,
-12793,
-11848,
-11156,
-9874,
-8790,
-7434,
-6331,
-5045,
-3515,
-1725,
-81,
-1,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-3,
+64636,
+61394,
+54482,
+48044,
+40500,
+26939,
+10393,
+4365,
+14912,
+35783,
+46813,
+48852,
+60891,
+63393,
+64184,
+64520,
+57832,
+51457,
+39698,
+36295,
+41197,
+52246,
+61358,
+61050,
+56379,
+51488,
+49569,
+38248,
+23321,
+8489,
 65535,
-4,
+249,
 65535,
-1,
+10,
+34,
 65535,
-0,
+54,
 65535,
-1,
+43,
 65535,
-0,
+40,
 65535,
+31,
 0,
 65535,
+222,
 65535,
+2391,
+15015,
+42976,
+61996,
+63905,
+65534,
+65386,
+65534,
+65534,
+65458,
+65534,
+65466,
+65534,
+65461,
+65534,
+65398,
+65534,
+65230,
+65534,
+63571,
+44420,
+16174,
+454,
 65535,
+11277,
+28642,
+35232,
+36427,
+27158,
+12181,
+2512,
 65535,
+308,
 65535,
-2,
-65535,
-5,
-65535,
-2,
+125,
 65535,
+875,
+24625,
+56748,
+65534,
+65318,
+65534,
+65499,
+65499,
+65534,
+64575,
+59894,
+54983,
+56914,
+64460,
+65534,
+65322,
+65534,
+54174,
+40185,
+29608,
+21695,
+13050,
+645,
+5123,
+28501,
+54321,
+65534,
+65440,
+65214,
+65534,
+57112,
+52893,
+56043,
+44609,
+41755,
+46767,
+55905,
+65534,
+65156,
+65534,
+63403,
+48789,
+27689,
+9487,
+877,
 65535,
+75,
 65535,
-0,
+29,
 65535,
 65535,
+18,
 65535,
-0,
+49,
 65535,
-2,
+14,
+64,
 65535,
-3,
+423,
 65535,
-1,
+1240,
 65535,
-2,
+10541,
+41186,
+57308,
+65534,
+61546,
+62564,
+65534,
+64887,
+65534,
+65313,
+65534,
+65421,
+65534,
+65292,
+65534,
+65024,
+65534,
+62112,
+42409,
+29267,
+23609,
+21542,
+9879,
 65535,
-1,
+14298,
+26691,
+31469,
+25319,
+5301,
+65535,
+223,
+154,
+65535,
+6033,
+20294,
+19990,
+23574,
+39527,
+52905,
+61989,
+61558,
+49722,
+49079,
+62389,
+65534,
+65199,
+65534,
+65399,
+65534,
+65525,
+65322,
+61078,
+48979,
+32222,
+18719,
+14750,
+23776,
+33360,
+32057,
+26412,
+22404,
+30119,
+40863,
+37192,
+42777,
+48125,
+39661,
+51207,
+63148,
+62704,
+65534,
+63562,
+61118,
+64942,
+65534,
+64159,
+55218,
+38997,
+22770,
+17127,
+12183,
+5455,
+1817,
 65535,
+132,
 65535,
-0,
 65535,
-0,
+44,
 65535,
-0,
+88,
 65535,
-2,
+102,
 65535,
-3,
-147,
-1281,
 65535,
+155,
 65535,
-1,
+913,
 65535,
-4182,
-10050,
-15122,
-18757,
-21057,
-23542,
-27281,
-32178,
-37605,
-41569,
-44316,
-45668,
-47592,
-50518,
-54794,
-58488,
-60910,
-60881,
-59201,
-57295,
-56054,
-56233,
-57318,
-58380,
-59467,
-59996,
-61260,
-62790,
-64935,
-65534,
-65534,
-64515,
-61395,
-57936,
-55591,
-55389,
-56566,
-58755,
-60377,
-61125,
-61283,
-61482,
-62720,
-65271,
+13447,
+42540,
+59660,
 65534,
+65179,
 65534,
 65534,
-65532,
+65479,
+65534,
+65511,
+65529,
 65534,
 65534,
+65465,
 65534,
+65147,
+65534,
+49546,
+21813,
+13038,
+18444,
+26863,
+25489,
+23333,
+26544,
+28467,
+28577,
+15594,
+1851,
+65535,
+389,
+65535,
+1287,
+23140,
+42369,
+44761,
+43611,
+41448,
+44009,
+49969,
+51028,
+44865,
+42497,
+52112,
+64117,
 65534,
-65533,
 65534,
+65285,
 65534,
+60125,
+45616,
+41497,
+41955,
+37874,
+30293,
+24283,
+22526,
+27287,
+31597,
+26101,
+24300,
+15856,
+13492,
+45879,
 65534,
+64964,
 65534,
-65533,
+65364,
 65534,
+65517,
 65533,
+65521,
 65534,
+65464,
 65534,
+65464,
 65534,
+65237,
+48986,
+20961,
+2488,
+65535,
+291,
+65535,
+112,
+65535,
+21,
+15,
+65535,
+83,
+65535,
+117,
+65535,
+65535,
+217,
+65535,
+1122,
+65535,
+13723,
+30405,
+32077,
+41444,
+39387,
+44485,
+57822,
+64787,
 65534,
+65192,
 65534,
-65533,
+65419,
+65524,
 65534,
-65533,
+65108,
 65534,
-65533,
+58926,
+45470,
+45088,
+57750,
 65534,
-65533,
 65534,
-65533,
+61280,
+40381,
+21072,
+9958,
+1283,
+65535,
+65535,
+400,
+65535,
+7636,
+27766,
+38212,
+36155,
+20147,
+4304,
+3056,
+14083,
+32419,
+48115,
+58215,
+64649,
 65534,
-65533,
-63698,
-60794,
-58802,
-57805,
-57006,
-55260,
-52154,
-47906,
-43429,
-39686,
-36654,
-34058,
-31227,
-28146,
-25512,
-23649,
-23409,
-24067,
-24896,
-25130,
-24118,
-22387,
-20349,
-18891,
-18088,
-17739,
-17313,
-16321,
-14833,
-13464,
-12485,
-12821,
-13682,
-14945,
-15523,
-15299,
-14238,
-12995,
-11979,
-11356,
-11138,
-10536,
-9986,
-9318,
-9211,
-9472,
-9964,
-9896,
-9141,
-7528,
-6171,
-5668,
-7015,
-9630,
-13019,
-15742,
-17495,
-17867,
-17850,
-18044,
-19155,
-21169,
-23430,
-25687,
-26997,
-28077,
-28880,
-30404,
-32844,
-36252,
-40242,
-44292,
-48038,
-51048,
-53443,
-55300,
-56765,
-58003,
-59179,
-60374,
-61547,
-62812,
-63849,
-65050,
-65533,
+65342,
 65534,
-65533,
+65234,
 65534,
-65533,
+62797,
+54978,
+53634,
+59988,
 65534,
+62409,
+51483,
+38262,
+30070,
+23394,
+21974,
+19884,
+23002,
+41079,
+46260,
+56712,
 65534,
+64087,
 65534,
+65377,
+64917,
 65534,
-65532,
+65403,
 65534,
-65531,
+65319,
 65534,
-65533,
+65187,
 65534,
-64715,
-62922,
-61214,
-59911,
-58535,
-57450,
-55857,
-54413,
-53201,
-52376,
-52136,
-51602,
-50739,
-48924,
-46640,
-44517,
-43007,
-42723,
-42785,
-43189,
-42718,
-42148,
-41501,
-41969,
-43362,
-45535,
-47173,
-47638,
-46553,
-44360,
-42255,
-40707,
-40150,
-40087,
-39906,
-39245,
-38046,
-36720,
-35632,
-34837,
-34192,
-33176,
-32022,
-30229,
-28700,
-26885,
-25067,
-22676,
-19708,
-16340,
-13574,
-11467,
-10937,
-10914,
-11092,
-10295,
-8300,
-5467,
-2584,
-485,
-65535,
-2,
-789,
-1482,
-1654,
-1280,
+62206,
+42111,
+26560,
+19297,
+12443,
+9371,
+4713,
 238,
 65535,
-1,
+54,
 65535,
-2,
+44,
 65535,
-2,
+29,
 65535,
-0,
-0,
 65535,
-2,
+28,
 65535,
-0,
+125,
 65535,
+324,
 65535,
-0,
-65535,
-65535,
-2,
-65535,
-3,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-5,
-65535,
-4,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-65535,
-0,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-614,
-9964,
-15652,
-17739,
-19152,
-23474,
-31602,
-42565,
-52667,
-59799,
-62719,
-63988,
-65532,
+1490,
+11715,
+26869,
+34956,
+33904,
+37734,
+45796,
+60519,
 65534,
+64936,
 65534,
+65314,
 65534,
+65464,
 65534,
+65468,
 65534,
+64319,
+62976,
+65499,
+65511,
 65534,
+64287,
+43753,
+18773,
+8402,
+2410,
+738,
+1693,
+2457,
+4596,
+9174,
+15927,
+16034,
+7912,
+108,
+483,
+65535,
+7885,
+33773,
+53762,
+64403,
 65534,
+65303,
 65534,
-65532,
+65384,
 65534,
-65532,
+65452,
 65534,
+65521,
+65497,
 65534,
+65333,
 65534,
+56366,
+40024,
+31592,
+25720,
+24273,
+24431,
+30137,
+42310,
+38834,
+42764,
+55910,
+53096,
+58519,
+65182,
+63094,
+65289,
 65534,
-65533,
 65534,
-65532,
+65461,
 65534,
-65245,
-60352,
-59422,
-62101,
+65343,
 65534,
+63142,
+45088,
+33724,
+30308,
+19896,
+15214,
+9494,
+563,
+65535,
+126,
+65535,
+120,
+65535,
+95,
+65535,
+67,
+65535,
+0,
+79,
+65535,
+479,
+65535,
+6551,
+20755,
+29307,
+28747,
+24466,
+28034,
+39579,
+58818,
 65534,
-65532,
+65052,
 65534,
-65532,
+65361,
 65534,
+65510,
+65508,
 65534,
-65533,
+65427,
 65534,
+65329,
 65534,
-65533,
+65195,
 65534,
-65531,
+62704,
+38655,
+13930,
+2971,
+2121,
+8063,
+8166,
+2966,
+65535,
+15,
+16,
+65535,
+137,
+65535,
+505,
+65535,
+11047,
+38784,
+58482,
 65534,
-65533,
+62354,
+56766,
+59275,
+65083,
 65534,
+65423,
 65534,
+65433,
 65534,
+65366,
 65534,
+61832,
+49079,
+33755,
+24289,
+19925,
+19761,
+20707,
+14764,
+12628,
+10639,
+14133,
+33765,
+48622,
+60809,
+64388,
+61351,
+65427,
+65534,
+65352,
 65534,
+65293,
 65534,
-65533,
+65261,
 65534,
+64751,
+57502,
+45389,
+32531,
+25102,
+16817,
+13189,
+9080,
+597,
+65535,
+102,
+65535,
+132,
+65535,
+128,
+65535,
+109,
+65535,
+65535,
+174,
+65535,
+5241,
+11694,
+13702,
+6674,
+6232,
+22723,
+46259,
+64755,
 65534,
+65316,
 65534,
+65327,
 65534,
-65533,
+65422,
 65534,
 65534,
+65474,
 65534,
+65342,
 65534,
-65533,
+65133,
 65534,
-63231,
-55923,
-50427,
-46002,
-40991,
-35235,
-29078,
-23804,
-19952,
-17693,
-15631,
-13219,
-9296,
-4958,
-725,
+61090,
+33039,
+6869,
 65535,
-1,
+19,
+3409,
+2784,
 65535,
-0,
-0,
+81,
 65535,
-3,
+37,
 65535,
-4,
+146,
 65535,
-374,
-3095,
-3183,
-2389,
-1941,
-3498,
-6504,
-9898,
-11953,
-12178,
-10737,
-9431,
-8965,
-10405,
-12796,
-15612,
-17646,
-18558,
-18422,
-17470,
-16210,
-14833,
-13618,
-13173,
-13329,
-14724,
-16541,
-18156,
-18735,
-17801,
-15678,
-13682,
-12777,
-14412,
-17937,
-23207,
-28257,
-32755,
-35566,
-37693,
-39532,
-42190,
-45886,
-50255,
-54546,
-57829,
-60019,
-61526,
-63275,
-65534,
-65534,
+490,
+65535,
+6764,
+31372,
+50495,
+56271,
+54848,
+52217,
+55863,
+64283,
 65534,
+65281,
 65534,
+65429,
 65534,
 65534,
+64028,
+58543,
+48679,
+36747,
+26882,
+21843,
+17927,
+12630,
+8200,
+2901,
+2041,
+7407,
+20666,
+35004,
+44997,
+57818,
+64662,
+65300,
+65534,
+65439,
+65534,
+65498,
+65534,
+65505,
+65534,
+65450,
+65534,
+63555,
+54780,
+46403,
+38796,
+27045,
+20015,
+11183,
+658,
+65535,
+114,
+65535,
+119,
+65535,
+87,
+65535,
+54,
+65535,
+6,
+61,
+65535,
+2837,
+7626,
+5472,
+65535,
+7670,
+25489,
+50602,
 65534,
+65156,
 65534,
 65534,
+65449,
 65534,
+65408,
 65534,
-65533,
+65428,
 65534,
-65532,
+65502,
+65489,
 65534,
-65533,
+65156,
 65534,
-65533,
+51238,
+23888,
+7965,
+2360,
+2707,
+1026,
+65535,
+227,
+65535,
+89,
+65535,
+65535,
+128,
+65535,
+437,
+65535,
+7221,
+28586,
+42956,
+49589,
+52512,
+56507,
+63883,
 65534,
-65533,
+65335,
 65534,
+65437,
 65534,
+65524,
+65492,
 65534,
+61991,
+56514,
+52664,
+46533,
+39009,
+30909,
+22420,
+14852,
+6076,
+4632,
+9725,
+15781,
+28904,
+38303,
+43482,
+50037,
+51081,
+54178,
+62623,
 65534,
+65350,
 65534,
 65534,
+65418,
 65534,
-65358,
-63540,
-62768,
-62255,
-60819,
-57715,
-53796,
-50075,
-47769,
-47264,
-47969,
-48635,
-48636,
-47503,
-45957,
-44802,
-44582,
-45046,
-45800,
-45800,
-45113,
-43718,
-42478,
-41789,
-41682,
-41811,
-41726,
-41701,
-41947,
-43207,
-45425,
-47348,
-48260,
-46729,
-43387,
-39419,
-36476,
-35078,
-35192,
-34990,
-34105,
-31868,
-29475,
-27660,
-26884,
-26974,
-26949,
-26663,
-25711,
-24580,
-23164,
-21590,
-19862,
-18047,
-16741,
-15875,
-15831,
-15988,
-16184,
-15989,
-15055,
-13639,
-11535,
-9519,
-7770,
-7125,
-7416,
-8478,
-9253,
-9166,
-7945,
-5974,
-3918,
-2052,
-396,
+60593,
+56049,
+55814,
+50186,
+45617,
+40687,
+32268,
+20545,
+4997,
 65535,
+299,
 65535,
-3,
+84,
 65535,
-5,
 65535,
-4,
+112,
 65535,
-2,
+189,
 65535,
-0,
+153,
 65535,
 65535,
+13850,
+23241,
+16346,
+6604,
+8136,
+20795,
+42329,
+63431,
+65534,
+65203,
+65534,
+65311,
+65534,
+65413,
+65534,
+65507,
+65501,
+65534,
+65317,
+65534,
+64920,
+65534,
+57909,
+30690,
+9549,
+558,
 65535,
+187,
 65535,
+130,
 65535,
+81,
 65535,
+39,
 65535,
-0,
 65535,
-1,
+169,
+65535,
+8933,
+28071,
+43838,
+52008,
+55670,
+57128,
+56102,
+60451,
+65534,
+65500,
+65503,
+65534,
+65464,
+65534,
+65499,
+61600,
+55712,
+51703,
+47362,
+41467,
+37100,
+32194,
+26292,
+22488,
+21644,
+25189,
+31583,
+42289,
+53641,
+59012,
+60053,
+55996,
+50090,
+48196,
+48228,
+50210,
+54709,
+56787,
+57957,
+58515,
+55470,
+51619,
+47012,
+40808,
+35145,
+29167,
+21372,
+12587,
+6208,
+1927,
 65535,
+74,
 65535,
 65535,
+10,
+7,
 65535,
-0,
+104,
 65535,
-2,
+335,
 65535,
-3,
+4115,
+17892,
+22298,
+15504,
+7920,
+6853,
+16914,
+30528,
+48699,
+64264,
+65534,
+65389,
+65534,
+65390,
+65534,
+65218,
+65278,
+65534,
+65534,
+65381,
+65534,
+65124,
+65534,
+61226,
+41406,
+23138,
+11557,
+6549,
+11486,
+16080,
+16394,
+11434,
+1817,
 65535,
-0,
+148,
 65535,
-0,
 65535,
-2,
+571,
+8259,
+20029,
+30073,
+34734,
+35064,
+32092,
+28423,
+28509,
+31910,
+39271,
+49815,
+59009,
+63881,
+64375,
+60244,
+53620,
+48686,
+46372,
+45942,
+48084,
+52782,
+57083,
+58029,
+53710,
+46719,
+43831,
+46143,
+54867,
+64445,
+65534,
+65534,
+63755,
+58140,
+55364,
+52238,
+45676,
+39541,
+36556,
+36887,
+41366,
+45368,
+42888,
+35434,
+28823,
+21071,
+11545,
+6541,
+4054,
+2682,
+4326,
+4195,
+3800,
+4678,
+2628,
+126,
+22,
+65535,
+109,
+65535,
+140,
 65535,
-2,
-65535,
-3,
-65535,
-1,
-65535,
-65535,
-2,
-65535,
-4,
-65535,
-3,
-65535,
-3,
-65535,
-1,
-65535,
-65535,
-2,
-65535,
-1261,
-1964,
-2432,
-6262,
-14282,
-25423,
-36053,
-43475,
-46950,
-47374,
-47948,
-49631,
-53065,
-56077,
-56853,
-54991,
-51382,
-48480,
-47903,
-49522,
-52134,
-53907,
-54792,
-55945,
-58844,
-64053,
+638,
+14558,
+29674,
+32183,
+24461,
+11499,
+1931,
+653,
+7676,
+22556,
+41640,
+60216,
 65534,
+65336,
+63129,
+58766,
+54253,
+52836,
+56408,
+61835,
 65534,
+65267,
 65534,
+65311,
 65534,
-65533,
+64242,
+51810,
+40209,
+31881,
+30440,
+34703,
+36569,
+35827,
+30834,
+24165,
+16906,
+11557,
+10314,
+11710,
+13120,
+13750,
+14814,
+13355,
+9507,
+5326,
+3357,
+5311,
+9176,
+15897,
+24929,
+33383,
+38505,
+41955,
+44320,
+46323,
+49242,
+50651,
+54374,
+60374,
+64459,
 65534,
-65532,
+65451,
+65534,
+65520,
 65534,
 65534,
+65529,
 65533,
 65534,
-65530,
 65534,
-65530,
+65345,
+63125,
+59351,
+53224,
+44105,
+39035,
+35072,
+28189,
+20193,
+11136,
+4036,
+1131,
+1200,
+3935,
+6503,
+7805,
+6428,
+2559,
+284,
+55,
+65535,
+2042,
+11170,
+18307,
+17262,
+15096,
+10466,
+1650,
+65535,
+211,
+65535,
+417,
+65535,
+14478,
+37326,
+42819,
+34202,
+13862,
+65535,
+65535,
+392,
+65535,
+12857,
+40808,
+59912,
+65431,
 65534,
-65533,
+64532,
+55641,
+49936,
+53552,
+62089,
 65534,
+65241,
 65534,
+65415,
 65534,
-65533,
+65362,
 65534,
-65533,
+61480,
+53080,
+51824,
+55310,
+59009,
+59136,
+54725,
+44725,
+29286,
+13529,
+2067,
+65535,
+189,
+65535,
+90,
+65535,
+41,
+65535,
+16,
+65535,
+60,
+2655,
+7784,
+15234,
+25624,
+37886,
+50526,
+61423,
 65534,
+65433,
 65534,
+65519,
 65533,
 65534,
-65531,
+65527,
 65534,
-65533,
 65534,
+65520,
 65534,
-65533,
+65508,
 65534,
-65533,
+65521,
+63695,
+59885,
+55249,
+47027,
+33183,
+18170,
+4478,
+65535,
+271,
+65535,
+99,
+65535,
+60,
+65535,
+94,
+65535,
+1293,
+10544,
+23320,
+33624,
+38897,
+39739,
+38992,
+38015,
+35255,
+31208,
+27656,
+25767,
+22525,
+16529,
+8445,
+610,
+65535,
+102,
+65535,
+75,
+226,
+7087,
+8780,
+1198,
+65535,
+73,
+65535,
+236,
+65535,
+17300,
+41262,
+56889,
 65534,
+65456,
+65523,
 65534,
+65453,
 65534,
-65533,
+65466,
 65534,
-65531,
-63501,
-55167,
-48126,
-42898,
-38890,
-34922,
-30520,
-26239,
-22943,
-21901,
-22608,
-24449,
-25797,
-25912,
-24910,
-23499,
-22428,
-21926,
-21324,
-20238,
-18558,
-16936,
-16278,
-17004,
-18600,
-20595,
-21500,
-21548,
-20438,
-19065,
-18135,
-17760,
-17978,
-17982,
-17315,
-15455,
-12841,
-9897,
-7766,
-6533,
-6216,
-6508,
-6573,
-6859,
-7130,
-7900,
-9011,
-10137,
-11182,
-12530,
-14925,
-18953,
-24494,
-30204,
-34906,
-37357,
-37828,
-37760,
-38467,
-41483,
-46395,
-52867,
-59377,
-65225,
+65502,
 65534,
 65534,
+65471,
+65534,
+65297,
 65534,
+62313,
+54366,
+49898,
+46448,
+42004,
+34737,
+22414,
+6140,
+65535,
+329,
+65535,
+86,
+65535,
+16,
+65535,
+17,
+65535,
+33,
+65535,
+237,
+4225,
+11141,
+21991,
+35319,
+52128,
+64898,
 65534,
+65419,
 65534,
-65533,
+65424,
 65534,
-65533,
+65464,
 65534,
+65509,
 65533,
 65534,
-65533,
+65466,
 65534,
+65322,
 65534,
-65533,
+61979,
+50705,
+40625,
+31435,
+18253,
+3982,
+65535,
+174,
+65535,
+65535,
+2787,
+12579,
+18517,
+17971,
+15012,
+13453,
+14597,
+18312,
+28252,
+39432,
+48375,
+53446,
+53087,
+49423,
+43622,
+35576,
+26820,
+21215,
+16195,
+8550,
+1599,
+65535,
+79,
+65535,
+65535,
+33,
+65535,
+14,
+1707,
+906,
+65535,
+332,
+65535,
+358,
+65535,
+2657,
+28808,
+57994,
 65534,
+65364,
 65534,
+65494,
 65534,
+65521,
 65534,
+65520,
 65534,
-65532,
+65511,
+65534,
+65533,
+65497,
 65534,
+65302,
 65534,
+56903,
+37352,
+23320,
+15014,
+9791,
+7149,
+2465,
+65535,
+164,
+65535,
+83,
+65535,
+55,
+65535,
+65535,
+99,
+65535,
+8395,
+18108,
+20290,
+20334,
+22685,
+29889,
+42983,
+60454,
 65534,
+65114,
 65534,
+65388,
 65534,
+65505,
 65533,
 65534,
-65532,
+65497,
 65534,
-65532,
+65451,
 65534,
-65533,
+65343,
 65534,
-65533,
+63352,
+52635,
+40199,
+28835,
+14547,
+1879,
+65535,
+221,
+65535,
+201,
+65535,
+5062,
+12867,
+15639,
+16105,
+15060,
+12453,
+11858,
+17187,
+25983,
+34843,
+42110,
+48292,
+51996,
+49496,
+41943,
+32436,
+23475,
+15744,
+10023,
+5807,
+1715,
+65535,
+60,
+65535,
+16,
+65535,
+8,
+65535,
+8,
+1,
+65535,
+61,
+65535,
+282,
+65535,
+5596,
+29029,
+56390,
 65534,
-65532,
+65175,
 65534,
-65531,
+65465,
 65534,
 65534,
+65515,
 65534,
 65534,
-65532,
+65478,
 65534,
+65419,
 65534,
+65419,
 65534,
-65379,
-61371,
-58004,
-55501,
-54283,
-53375,
-52378,
-50474,
-47836,
-44694,
-41390,
-38625,
-36231,
-34370,
-32732,
-31136,
-29522,
-27901,
-26598,
-25841,
-25889,
-26751,
-28235,
-29830,
-31315,
-31977,
-32047,
-31622,
-30894,
-30495,
-30295,
-30561,
-31071,
-31489,
-31693,
-31357,
-30539,
-29499,
-28322,
-27262,
-26042,
-24602,
-22434,
-19839,
-16918,
-14258,
-11867,
-9808,
-7635,
-5201,
-2386,
+64775,
+50396,
+31987,
+14185,
+733,
 65535,
-0,
+96,
 65535,
+107,
 65535,
-0,
+36,
+22,
 65535,
+164,
 65535,
-0,
+363,
 65535,
-2,
+2901,
+20786,
+38291,
+50028,
+57533,
+59727,
+60870,
+64143,
+65534,
+65407,
+65534,
+65518,
+65521,
+65534,
+65516,
+65524,
+65534,
+65375,
+65534,
+59964,
+49300,
+40858,
+35307,
+37326,
+39103,
+33142,
+23786,
+8869,
 65535,
-2,
+258,
 65535,
-2,
+291,
 65535,
-2,
+7018,
+23114,
+34533,
+39811,
+35090,
+25746,
+18383,
+14418,
+16662,
+25243,
+39070,
+55197,
+64979,
+65471,
+60916,
+49989,
+34013,
+17397,
+3669,
 65535,
-0,
+218,
 65535,
-0,
+65,
 65535,
-0,
+10,
+6,
 65535,
-0,
+25,
 65535,
-2,
+54,
 65535,
-1,
+93,
 65535,
+108,
 65535,
-0,
+738,
+11442,
+29353,
+52372,
+65534,
+65320,
+65534,
+65534,
+65478,
+65534,
+65484,
+65534,
+65522,
+65534,
+65521,
+65534,
+65409,
+65534,
+65101,
+65534,
+59996,
+42072,
+20062,
+1865,
 65535,
+322,
 65535,
-0,
+179,
 65535,
-1,
+44,
+4,
 65535,
+35,
 65535,
-0,
 65535,
-1,
+216,
 65535,
-0,
-0,
-65535,
-65535,
-65535,
-65535,
-1,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-2,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-6129,
-18846,
-25154,
-25845,
-25200,
-27770,
-36166,
-48324,
-61016,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-62679,
-60972,
-59178,
-56985,
-55568,
-56807,
-62192,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65532,
-65534,
-65533,
-65534,
+10915,
+32056,
+51242,
+64194,
 65534,
+65371,
 65534,
+65421,
 65534,
+65467,
 65534,
+65497,
 65534,
+65523,
+65518,
 65534,
-65533,
+65389,
 65534,
-65290,
-58093,
-53751,
-52158,
-52044,
-51494,
-49231,
-44716,
-38910,
-32932,
-27902,
-23895,
-20460,
-17604,
-15344,
-14326,
-14856,
-16121,
-17978,
-19268,
-20834,
-22502,
-24865,
-27042,
-27901,
-26731,
-23427,
-19288,
-15876,
-14258,
-14305,
-15143,
-14991,
-13262,
-9608,
-5222,
-1324,
+59911,
+49411,
+44163,
+41595,
+39963,
+39998,
+37619,
+31029,
+23036,
+14414,
+5808,
+925,
+372,
+3594,
+9918,
+16521,
+22140,
+25355,
+24512,
+19956,
+16574,
+16249,
+18678,
+25232,
+33417,
+41131,
+46607,
+47513,
+43687,
+36469,
+26236,
+16017,
+7193,
+814,
 65535,
-0,
+92,
 65535,
-1,
+53,
 65535,
-0,
+27,
 65535,
+16,
 65535,
-3,
+20,
 65535,
-1,
+11,
+281,
+174,
 65535,
+164,
 65535,
-2,
-2695,
-5953,
-9565,
-13061,
-17074,
-21212,
-26553,
-33175,
-41502,
-50873,
-59907,
-65534,
-65533,
-65534,
-65531,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
+1159,
+18053,
+49261,
 65534,
+65332,
 65534,
 65534,
-65533,
+65476,
 65534,
-65532,
-63986,
-61548,
-59266,
-57054,
-54059,
-51050,
-48325,
-46508,
-45447,
-44359,
-43142,
-41193,
-39863,
-39377,
-40594,
-42988,
-45754,
-48106,
-49472,
-50722,
-52130,
-54818,
-58512,
-62323,
-65027,
+65477,
 65534,
-64450,
-62765,
-61771,
-63186,
+65499,
 65534,
+65476,
 65534,
+65365,
 65534,
+65123,
 65534,
-62743,
-54771,
-47460,
-43187,
-42057,
-42720,
-43343,
-42010,
-38602,
-33862,
-29032,
-25313,
-23007,
-21767,
-21303,
-20727,
-20195,
-19464,
-18690,
-18022,
-18160,
-19594,
-23187,
-28590,
-35102,
-40992,
-44649,
-45842,
-44783,
-43651,
-43651,
-45690,
-49054,
-52402,
-54370,
-54262,
-52489,
-49852,
-47463,
-45864,
-44982,
-44380,
-43122,
-40593,
-36631,
-31291,
-25467,
-19619,
-14813,
-11047,
-8633,
-6507,
-4469,
-1634,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-2,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-3,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-1,
-65535,
-0,
-0,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-0,
-65535,
-1,
-65535,
-0,
-0,
-65535,
-0,
-0,
+62003,
+42701,
+18441,
+1591,
 65535,
-1,
+306,
 65535,
+263,
 65535,
-1,
+3630,
+5709,
+1555,
 65535,
+278,
 65535,
-2,
+228,
 65535,
-2,
-6572,
-17957,
-30120,
-40304,
-46335,
-48365,
-48528,
-49783,
-54041,
-61173,
-65532,
-65534,
-65531,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65533,
-63632,
-61104,
-60242,
-61880,
-65534,
-65534,
-65532,
-65534,
-65532,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65532,
-65534,
+696,
+17182,
+42098,
+60969,
 65534,
+65154,
 65534,
+65421,
 65534,
+65527,
+65520,
 65534,
+65525,
+65521,
 65534,
+65449,
 65534,
-65533,
+65311,
 65534,
-65533,
-65115,
-58536,
-51514,
-43452,
-34393,
-25377,
-17694,
-12684,
-11227,
-13060,
-17519,
-23048,
-28615,
-32752,
-35634,
-36585,
-36809,
-36117,
-35616,
-35141,
-35150,
-35143,
-35148,
-34878,
-34173,
-33329,
-32201,
-30869,
-28880,
-25640,
-21174,
-15474,
-9277,
-3693,
-0,
-65535,
-2,
-65535,
-4,
-65535,
-3,
+63197,
+52974,
+44229,
+39314,
+35838,
+31808,
+25613,
+16894,
+6743,
+505,
 65535,
-1,
+48,
 65535,
-0,
+21,
 65535,
-2,
+12,
 65535,
-1,
+57,
 65535,
-2386,
-9257,
-16624,
-24784,
-33481,
-41927,
-48964,
-54375,
-58001,
-60619,
-62967,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-61327,
-58314,
-56587,
-54991,
-53198,
-50806,
-48480,
-46750,
-45959,
-46193,
-46692,
-47677,
-48660,
-50627,
-53664,
-57804,
-62523,
-65534,
-65534,
-65534,
-65533,
-65071,
-63607,
-62546,
-61480,
-59801,
-57137,
-54351,
-51647,
-49809,
-48259,
-46419,
-43829,
-40306,
-36321,
-31801,
-27060,
-21593,
-15962,
-10363,
-6284,
-3959,
-4293,
-6350,
-10186,
-15165,
-21370,
-28235,
-35478,
-41459,
-45667,
-47216,
-47220,
-47015,
-48438,
-51889,
-56809,
-61281,
-63898,
-64093,
-63056,
-62255,
-62900,
-64648,
-65534,
-65533,
-64894,
-62167,
-59555,
-57584,
-56253,
-54462,
-51756,
-47706,
-43319,
-39420,
-37008,
-36141,
-36498,
-37560,
-39044,
-41082,
-43984,
-47814,
-52225,
-56475,
-59709,
-61504,
-61947,
-61547,
-60797,
-59841,
-58558,
-56721,
-54501,
-52382,
-51156,
-50655,
-50825,
-49876,
-47504,
-43232,
-37935,
-32580,
-27965,
-23477,
-18997,
-13772,
-8479,
-3692,
-196,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-65535,
-0,
-65535,
-3,
-65535,
-1,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-3,
-65535,
-4,
-65535,
-0,
-0,
-65535,
-3,
-65535,
-6421,
-11400,
-15367,
-21481,
-31024,
-42944,
-53462,
-60087,
-61969,
-61393,
-62012,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-60351,
-51139,
-42675,
-34682,
-26685,
-18267,
-9099,
-65535,
-65535,
-0,
-0,
-65535,
-5,
-3532,
-11785,
-18816,
-24541,
-28409,
-31449,
-33461,
-35236,
-36407,
-36986,
-36584,
-34704,
-31534,
-26998,
-21897,
-16765,
-12352,
-8545,
-5378,
-2054,
-0,
-65535,
-65535,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-1,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-3714,
-14926,
-25952,
-36543,
-46751,
-56056,
-63827,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-64891,
-63123,
-61546,
-59977,
-57981,
-56255,
-55013,
-54617,
-55300,
-56766,
-59064,
-62083,
-65532,
-65534,
-65532,
-65534,
-65531,
-65534,
-65532,
-65534,
-65534,
-65534,
-65048,
-58845,
-53509,
-48656,
-44449,
-40463,
-36628,
-32999,
-29496,
-26465,
-23849,
-21703,
-19482,
-16767,
-13103,
-8747,
-3936,
-371,
-0,
-281,
-4848,
-11909,
-20131,
-28897,
-37252,
-45488,
-53798,
-61635,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65532,
-65534,
-62741,
-56767,
-52796,
-51804,
-52910,
-55300,
-56589,
-56119,
-53178,
-48899,
-44516,
-41701,
-40774,
-41700,
-43564,
-45378,
-47063,
-48701,
-51183,
-55123,
-61063,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-64339,
-59487,
-54352,
-48831,
-42325,
-35077,
-27617,
-20504,
-14482,
-9606,
-5953,
-2810,
-147,
-1,
-65535,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-0,
-0,
-65535,
-2,
-65535,
-0,
-0,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-2,
-65535,
-2,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-2,
-65535,
-2,
-65535,
-65535,
-0,
-65535,
-65535,
-6463,
-22587,
-34947,
-42587,
-47087,
-50957,
-56236,
-62586,
-65534,
-65534,
-65534,
-65534,
-60619,
-58268,
-60044,
-65400,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65531,
-65534,
-64559,
-56299,
-48524,
-41769,
-36363,
-32512,
-29806,
-27373,
-25044,
-23231,
-22189,
-22231,
-21836,
-19994,
-15677,
-9587,
-3691,
-2,
-65535,
-2943,
-8233,
-14082,
-19486,
-23674,
-26927,
-29078,
-30582,
-31271,
-30914,
-29279,
-25552,
-19910,
-12463,
-3871,
-0,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-0,
-5908,
-12331,
-17385,
-20236,
-21150,
-20814,
-19907,
-19820,
-20725,
-23674,
-28034,
-33685,
-39555,
-44756,
-49237,
-52861,
-56169,
-59442,
-62036,
-63653,
-63541,
-61348,
-57872,
-53662,
-49899,
-47614,
-46998,
-48809,
-52359,
-57737,
-63918,
-65534,
-65534,
-65532,
-65534,
-65531,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-64625,
-63122,
-60993,
-57983,
-53951,
-49033,
-43519,
-37758,
-32180,
-27016,
-22500,
-18753,
-16011,
-14611,
-14727,
-16494,
-19731,
-23783,
-27925,
-31314,
-33285,
-33995,
-33418,
-32068,
-30360,
-28347,
-26440,
-24472,
-22962,
-22412,
-23271,
-26045,
-30182,
-34817,
-38709,
-40796,
-40594,
-39088,
-37318,
-37027,
-39001,
-42500,
-46595,
-48682,
-48411,
-45336,
-41747,
-39396,
-40465,
-44955,
-51296,
-57736,
-61615,
-63077,
-62432,
-62016,
-62831,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-62171,
-60016,
-59890,
-61944,
-65028,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-62057,
-58470,
-54592,
-50409,
-45398,
-39423,
-33129,
-27041,
-22408,
-19488,
-18090,
-17382,
-16474,
-14592,
-12042,
-9191,
-7055,
-5448,
-4600,
-3450,
-1590,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-3,
-65535,
-4,
-65535,
-4,
-65535,
-4,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-0,
-0,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-3,
-65535,
-2,
-65535,
-0,
-65535,
-1,
-12507,
-27085,
-36562,
-42125,
-46573,
-52867,
-61503,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65532,
-58096,
-48677,
-39334,
-30028,
-22078,
-16208,
-13573,
-13063,
-14191,
-15967,
-18199,
-21239,
-24400,
-27109,
-28144,
-27329,
-25200,
-23473,
-22743,
-23606,
-24845,
-25868,
-26328,
-26642,
-27504,
-28655,
-29832,
-29829,
-28258,
-25178,
-20860,
-16119,
-10915,
-5465,
-0,
-65535,
-65535,
-2,
-65535,
-3,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-4649,
-14568,
-24314,
-32335,
-38221,
-41684,
-43693,
-44628,
-45178,
-45136,
-44426,
-43430,
-42278,
-41614,
-41546,
-41948,
-42806,
-44054,
-45730,
-47752,
-49850,
-51406,
-51933,
-51228,
-49410,
-47018,
-44625,
-42878,
-42075,
-42858,
-44712,
-47883,
-51624,
-56101,
-61036,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-60330,
-54194,
-49322,
-45756,
-43296,
-41991,
-41391,
-41614,
-41835,
-42012,
-41392,
-39931,
-37914,
-35300,
-32845,
-30292,
-28039,
-25973,
-24206,
-23030,
-22454,
-22521,
-23539,
-25024,
-27305,
-29498,
-31203,
-31536,
-30560,
-28326,
-26216,
-24741,
-24265,
-24253,
-23093,
-20309,
-16006,
-11825,
-10359,
-13440,
-21502,
-33131,
-45621,
-56632,
-65003,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65532,
-65534,
-65531,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65531,
-65534,
-63670,
-56700,
-48146,
-39044,
-29987,
-21633,
-14083,
-7059,
-571,
-0,
-65535,
-0,
-65535,
-2,
-65535,
-3,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-0,
-65535,
-2,
-65535,
-3,
-65535,
-1,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-1,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-3,
-65535,
-2,
-65535,
-3,
-65535,
-3,
-65535,
-1,
-65535,
-65535,
-238,
-13817,
-24269,
-29500,
-30648,
-29587,
-29365,
-31424,
-35635,
-39928,
-42413,
-42033,
-39975,
-38203,
-38687,
-41529,
-45884,
-49924,
-53150,
-56034,
-59909,
-65291,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-59311,
-52355,
-47949,
-45557,
-44580,
-44139,
-45136,
-47726,
-52202,
-57583,
-62300,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-61860,
-55212,
-47683,
-40217,
-33220,
-26729,
-21103,
-16541,
-12929,
-10051,
-7171,
-4005,
-369,
-1,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-2,
-767,
-7772,
-14877,
-21968,
-27771,
-32441,
-35858,
-38044,
-39114,
-38642,
-36301,
-32219,
-26356,
-20038,
-13572,
-8347,
-4466,
-2346,
-1853,
-2875,
-5400,
-9296,
-14194,
-20016,
-26045,
-32308,
-38228,
-43537,
-48327,
-52068,
-55323,
-58027,
-60529,
-62966,
-65379,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-63410,
-59642,
-56920,
-54836,
-53640,
-53310,
-53750,
-55193,
-57182,
-59780,
-62429,
-64920,
-65530,
-65534,
-64889,
-62327,
-59197,
-55503,
-51513,
-47174,
-42588,
-38291,
-34791,
-31957,
-29941,
-27859,
-25843,
-23672,
-22145,
-21434,
-21549,
-21786,
-21484,
-20391,
-19266,
-19642,
-22363,
-28239,
-35166,
-41570,
-45335,
-46197,
-45956,
-46619,
-50451,
-57075,
-64847,
-65534,
-65534,
-65534,
-65534,
-64802,
-63921,
-65531,
-65534,
-65532,
-65534,
-65534,
-65534,
-64961,
-64404,
-65248,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-63454,
-56895,
-49214,
-41477,
-35260,
-30381,
-27018,
-24206,
-21543,
-18979,
-16429,
-14413,
-12756,
-11442,
-10298,
-9006,
-7794,
-6594,
-5245,
-3450,
-393,
-65535,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-0,
-0,
-65535,
-3,
-65535,
-2,
-65535,
-65535,
-65535,
-0,
-65535,
-3,
-65535,
-2,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-2941,
-9032,
-13040,
-16542,
-20791,
-25867,
-30981,
-34571,
-35898,
-35124,
-33663,
-32929,
-33953,
-36206,
-38669,
-40638,
-42258,
-44845,
-49235,
-55367,
-61947,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65114,
-64362,
-63739,
-62923,
-62345,
-63497,
-65534,
-65532,
-65534,
-65531,
-65534,
-65531,
-65534,
-65533,
-65534,
-65534,
-65534,
-60221,
-52043,
-43344,
-34391,
-25977,
-18955,
-13727,
-10515,
-8303,
-6570,
-4450,
-2451,
-861,
-458,
-660,
-1411,
-1724,
-1721,
-1637,
-1763,
-2389,
-3205,
-4027,
-4691,
-5597,
-6952,
-9029,
-11560,
-14123,
-16054,
-17140,
-17091,
-15769,
-13879,
-11116,
-8211,
-4912,
-1435,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-0,
-65535,
-0,
-7724,
-16629,
-25535,
-33902,
-41352,
-47900,
-53510,
-58159,
-62212,
-65269,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65531,
-65534,
-65532,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-60993,
-55968,
-50405,
-45181,
-40062,
-36498,
-33485,
-31556,
-29566,
-27592,
-25844,
-24446,
-24140,
-24135,
-24561,
-24535,
-24492,
-24914,
-26660,
-30144,
-34699,
-39336,
-42253,
-42922,
-41236,
-38934,
-37538,
-38801,
-42653,
-48106,
-53127,
-56060,
-56228,
-54640,
-52930,
-52889,
-55124,
-58536,
-62346,
-64382,
-65181,
-64472,
-63608,
-62966,
-63364,
-64648,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65533,
-64362,
-58557,
-51583,
-44513,
-39112,
-35764,
-34107,
-33330,
-32021,
-29919,
-26884,
-23518,
-20329,
-17712,
-15922,
-14612,
-13862,
-12486,
-10427,
-6619,
-1587,
-2,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-2,
-65535,
-2,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-1,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-5689,
-13371,
-17849,
-20481,
-23277,
-26283,
-29433,
-31026,
-30871,
-28722,
-26443,
-24644,
-24341,
-25064,
-26355,
-28279,
-30605,
-34482,
-39441,
-45737,
-52175,
-58804,
-64935,
-65534,
-65534,
-65534,
-65532,
-65534,
-65532,
-65534,
-65531,
-65534,
-65530,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65531,
-65534,
-65530,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65157,
-56434,
-47303,
-38204,
-29299,
-21079,
-14129,
-8719,
-5268,
-2852,
-1855,
-1235,
-2099,
-3628,
-6240,
-8235,
-9430,
-8988,
-7769,
-6374,
-5021,
-3586,
-1232,
-2,
-65535,
-1,
-65535,
-0,
-65535,
-0,
-65535,
-2,
-65535,
-2,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-3,
-65535,
-4,
-65535,
-3,
-2340,
-11338,
-20879,
-30053,
-38601,
-46397,
-52956,
-58489,
-62458,
-65180,
-65534,
-65534,
-64296,
-62123,
-59953,
-58183,
-57115,
-56833,
-57272,
-58712,
-61040,
-64427,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-64583,
-61835,
-58337,
-53796,
-49033,
-43851,
-38646,
-33926,
-29722,
-26461,
-24227,
-22344,
-21235,
-20020,
-19351,
-19222,
-19552,
-20527,
-21016,
-20836,
-19354,
-17072,
-14746,
-13063,
-12576,
-12575,
-12643,
-11844,
-10693,
-9896,
-10803,
-14083,
-19751,
-26664,
-33792,
-39823,
-44756,
-48747,
-52488,
-56587,
-60441,
-63939,
-65248,
-64957,
-62791,
-61014,
-60553,
-62322,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65530,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-63721,
-60152,
-56719,
-53709,
-50049,
-45980,
-40991,
-36256,
-32043,
-29299,
-27239,
-25465,
-22944,
-19728,
-16608,
-14325,
-13395,
-13351,
-12996,
-11669,
-9074,
-5911,
-2584,
-0,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-65535,
-1,
-65535,
-3,
-65535,
-2,
-65535,
-2,
-65535,
-2,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-1,
-5951,
-9786,
-10869,
-10893,
-11712,
-13107,
-14126,
-13395,
-10406,
-6505,
-3651,
-3294,
-6263,
-10916,
-17004,
-23009,
-29786,
-37116,
-45513,
-53972,
-62346,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-63409,
-53220,
-42787,
-32578,
-22851,
-14239,
-7258,
-2056,
-65535,
-0,
-65535,
-0,
-65535,
-2,
-2251,
-3807,
-4334,
-3673,
-2585,
-1502,
-282,
-65535,
-0,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-0,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-0,
-65535,
-0,
-65535,
-2,
-65535,
-1,
-65535,
-6018,
-14904,
-23425,
-31562,
-38886,
-45270,
-50163,
-53861,
-55813,
-56673,
-56302,
-55475,
-54398,
-53592,
-52958,
-52774,
-52801,
-53484,
-55148,
-58048,
-62368,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65530,
-65534,
-65531,
-65534,
-65534,
-65534,
-65533,
-65534,
-65528,
-63925,
-62362,
-60510,
-58668,
-55944,
-52688,
-48636,
-44491,
-40441,
-36741,
-33195,
-29988,
-26881,
-24538,
-22875,
-21723,
-20904,
-19597,
-18046,
-16099,
-14125,
-12620,
-11069,
-9918,
-8191,
-6461,
-4538,
-2870,
-1837,
-1476,
-2034,
-3185,
-4977,
-7504,
-10937,
-15232,
-20574,
-25974,
-31050,
-35233,
-38448,
-41457,
-44693,
-48922,
-53598,
-58135,
-61550,
-63407,
-64295,
-64739,
-65533,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-63623,
-60845,
-58001,
-54772,
-51824,
-48834,
-46442,
-44006,
-41769,
-38689,
-35279,
-30961,
-27236,
-23809,
-21630,
-19823,
-17933,
-15213,
-11645,
-7149,
-2564,
-65535,
-0,
-65535,
-2,
-65535,
-2,
-65535,
-2,
-65535,
-2,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-1,
-65535,
-65535,
-1,
-65535,
-4,
-65535,
-2,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-2,
-65535,
-3,
-65535,
-2,
-3161,
-5864,
-6796,
-7037,
-7128,
-6992,
-5933,
-3803,
-1103,
-65535,
-65535,
-2765,
-7767,
-13552,
-19530,
-25622,
-32642,
-40818,
-49917,
-59424,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-59663,
-50476,
-41257,
-32467,
-24138,
-17181,
-11780,
-7989,
-5224,
-3338,
-2211,
-1899,
-2453,
-2986,
-3006,
-2033,
-216,
-1,
-65535,
-1,
-65535,
-0,
-0,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-4,
-65535,
-3,
-65535,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-3,
-65535,
-1,
-237,
-7526,
-14835,
-21812,
-28368,
-34194,
-39176,
-43076,
-46021,
-48016,
-49497,
-50607,
-51670,
-52619,
-53600,
-54812,
-56277,
-58559,
-61324,
-64784,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65531,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-63626,
-61773,
-59973,
-58117,
-56629,
-55236,
-54039,
-52535,
-51002,
-48838,
-46636,
-44034,
-41543,
-38957,
-36432,
-33724,
-30966,
-27941,
-25184,
-22362,
-19998,
-17426,
-14789,
-11935,
-8788,
-6218,
-4293,
-3759,
-4579,
-6133,
-8120,
-9877,
-11311,
-13108,
-15654,
-19420,
-24094,
-29054,
-33198,
-36273,
-38228,
-39684,
-41328,
-43582,
-46024,
-48389,
-50032,
-50760,
-51049,
-51030,
-51488,
-52514,
-54237,
-56587,
-59423,
-62653,
-65534,
-65534,
-65534,
-65533,
-65534,
-65531,
-65534,
-65530,
-65534,
-65531,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65177,
-63123,
-60484,
-58293,
-56497,
-56056,
-56097,
-56368,
-55897,
-54507,
-52355,
-50140,
-48127,
-46840,
-45645,
-44515,
-42766,
-40660,
-38048,
-35301,
-32399,
-28878,
-25113,
-20348,
-15457,
-10204,
-5157,
-393,
-65535,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-0,
-0,
-65535,
-3,
-65535,
-2,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-2,
-65535,
-3,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-65535,
-3,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-8390,
-15477,
-19996,
-21856,
-22344,
-21590,
-19709,
-16915,
-13154,
-9339,
-6376,
-4999,
-5799,
-8123,
-11734,
-15986,
-21039,
-26858,
-33955,
-41763,
-50190,
-58357,
-65533,
-65534,
-65531,
-65534,
-65533,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65531,
-65534,
-65531,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65531,
-65534,
-65532,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-58823,
-48903,
-39306,
-30432,
-22429,
-15612,
-9962,
-5509,
-1657,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-3696,
-9517,
-15501,
-21546,
-27769,
-33751,
-39421,
-44006,
-47659,
-50010,
-51888,
-53268,
-54679,
-55790,
-56653,
-57028,
-56944,
-56672,
-56345,
-56364,
-56852,
-58028,
-59951,
-62701,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65531,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-63273,
-61107,
-59354,
-57607,
-56008,
-54375,
-52840,
-51472,
-50340,
-48989,
-47595,
-45510,
-43542,
-41258,
-39688,
-38267,
-37230,
-35853,
-34194,
-32135,
-30004,
-27973,
-26394,
-24826,
-23629,
-22430,
-21659,
-21390,
-21657,
-22522,
-23649,
-25135,
-26928,
-29077,
-31603,
-34768,
-38182,
-42253,
-46357,
-50359,
-53732,
-56253,
-57850,
-58889,
-59644,
-60130,
-60197,
-59467,
-57935,
-55925,
-53594,
-51737,
-50185,
-49211,
-48457,
-48060,
-47947,
-48082,
-48414,
-48612,
-49300,
-50008,
-51514,
-53132,
-54857,
-55993,
-56515,
-56657,
-56894,
-57318,
-58094,
-58668,
-58734,
-58471,
-57604,
-56698,
-55524,
-54392,
-52934,
-51513,
-50120,
-48656,
-47151,
-45181,
-43030,
-40683,
-38646,
-36829,
-35235,
-33529,
-31380,
-29165,
-26553,
-24071,
-21414,
-18576,
-15612,
-12553,
-9917,
-7749,
-6150,
-4892,
-3537,
-2033,
-305,
-65535,
-0,
-65535,
-1,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-1,
-2917,
-9544,
-14389,
-17960,
-20260,
-21990,
-22344,
-21346,
-18734,
-15409,
-12158,
-9714,
-8040,
-6924,
-6264,
-6751,
-8742,
-12445,
-17004,
-21702,
-25998,
-30472,
-35656,
-41945,
-48636,
-55058,
-60506,
-65491,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65533,
-65072,
-64646,
-65493,
-65533,
-65534,
-65533,
-65534,
-65534,
-65531,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-63009,
-54948,
-47549,
-41015,
-35036,
-29033,
-23405,
-18271,
-14322,
-11404,
-9185,
-7549,
-6662,
-7103,
-8767,
-11423,
-13751,
-15521,
-16184,
-16388,
-16405,
-16234,
-15673,
-14062,
-11644,
-8346,
-4735,
-1034,
-1,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-2,
-65535,
-0,
-65535,
-1,
-65535,
-2101,
-5330,
-8436,
-12020,
-15879,
-19882,
-23851,
-27260,
-30228,
-32247,
-33814,
-34573,
-35231,
-35304,
-35122,
-34461,
-33438,
-32070,
-30624,
-29324,
-28410,
-28038,
-28034,
-28547,
-29296,
-30387,
-31931,
-33798,
-36339,
-39312,
-42609,
-46287,
-49678,
-53328,
-56256,
-59111,
-61148,
-62791,
-63828,
-64538,
-64628,
-64469,
-63456,
-62189,
-60197,
-58071,
-55766,
-53663,
-51627,
-50094,
-48638,
-47658,
-46908,
-46353,
-46066,
-45866,
-45934,
-46285,
-47041,
-48037,
-49542,
-51051,
-52775,
-54461,
-55834,
-57139,
-57850,
-58269,
-58050,
-57183,
-55747,
-53638,
-51340,
-48898,
-46755,
-45177,
-44074,
-43806,
-43961,
-44803,
-46221,
-48434,
-51273,
-54680,
-58404,
-61968,
-65202,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65023,
-63655,
-61988,
-59978,
-58136,
-56830,
-55790,
-55500,
-54749,
-53796,
-52133,
-50209,
-47925,
-45890,
-43473,
-41348,
-39420,
-37960,
-37140,
-36739,
-36432,
-36430,
-36696,
-37783,
-39419,
-41527,
-43428,
-44627,
-45268,
-45067,
-44452,
-43005,
-40909,
-38199,
-35236,
-32820,
-30671,
-29012,
-26882,
-24229,
-20901,
-17517,
-14303,
-11733,
-9498,
-7768,
-6375,
-5465,
-4736,
-4268,
-3474,
-2939,
-2476,
-2809,
-3581,
-4471,
-4976,
-4626,
-4068,
-3476,
-3535,
-3984,
-4489,
-4692,
-4468,
-4006,
-3580,
-2920,
-2010,
-261,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-2342,
-8879,
-15497,
-21238,
-25686,
-29012,
-31292,
-32731,
-32800,
-31177,
-28085,
-23713,
-19733,
-15763,
-12157,
-8320,
-4296,
-1186,
-3,
-65535,
-1147,
-2919,
-4624,
-7059,
-10939,
-16671,
-23208,
-29632,
-35321,
-40951,
-47283,
-54282,
-61151,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65224,
-62700,
-60684,
-59577,
-59200,
-58226,
-56276,
-53973,
-52157,
-52201,
-53020,
-54549,
-55302,
-56233,
-57316,
-59556,
-62056,
-64252,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65317,
-61367,
-56502,
-51422,
-46888,
-43295,
-40595,
-37695,
-34677,
-31495,
-29717,
-29433,
-30671,
-32488,
-33661,
-34572,
-35033,
-35813,
-36761,
-37185,
-36916,
-35680,
-34169,
-32468,
-30958,
-29078,
-26751,
-24050,
-21479,
-18977,
-17071,
-15014,
-13105,
-11472,
-10357,
-10186,
-10403,
-10938,
-11246,
-11580,
-12020,
-12600,
-13282,
-13618,
-13661,
-13638,
-13773,
-14391,
-14945,
-15035,
-14480,
-13197,
-11910,
-10694,
-9584,
-8368,
-6884,
-5221,
-4027,
-3316,
-3407,
-3870,
-4581,
-5265,
-6242,
-7480,
-9189,
-11222,
-13398,
-15895,
-18625,
-21722,
-24958,
-28124,
-30893,
-33397,
-35278,
-37184,
-38491,
-39906,
-40819,
-41921,
-42767,
-43717,
-44383,
-45045,
-45514,
-46196,
-47198,
-48279,
-49388,
-50030,
-50231,
-50648,
-51119,
-52597,
-54373,
-56697,
-58601,
-60309,
-61725,
-63142,
-64739,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-64783,
-63917,
-63121,
-62168,
-60994,
-59134,
-57562,
-55500,
-53464,
-50517,
-47174,
-43983,
-41326,
-40062,
-39223,
-38378,
-36986,
-34811,
-32624,
-30448,
-28392,
-26085,
-23163,
-20020,
-16782,
-13972,
-11290,
-8833,
-6086,
-3894,
-2164,
-1546,
-1301,
-1258,
-1101,
-993,
-1501,
-2607,
-4116,
-5332,
-6085,
-6354,
-6681,
-7240,
-7967,
-8103,
-7635,
-6308,
-4824,
-3625,
-2567,
-1986,
-904,
-0,
-65535,
-3,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-1633,
-4892,
-8076,
-11228,
-14168,
-16586,
-18335,
-18753,
-18403,
-17204,
-16341,
-15523,
-15143,
-14215,
-12820,
-10493,
-7703,
-4425,
-924,
-1,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-3,
-65535,
-2,
-65535,
-65535,
-1,
-65535,
-6441,
-15344,
-23783,
-31093,
-36741,
-40771,
-42988,
-43318,
-41747,
-38313,
-33552,
-27902,
-21724,
-15078,
-7703,
-0,
-65535,
-1,
-65535,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-4781,
-13017,
-22411,
-31823,
-41149,
-48678,
-54838,
-59266,
-63077,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-62412,
-58913,
-55213,
-52355,
-50674,
-50184,
-50762,
-51737,
-53372,
-55571,
-58666,
-62480,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-64428,
-61193,
-58293,
-55434,
-53176,
-51691,
-51427,
-51668,
-52977,
-53907,
-55388,
-56546,
-57912,
-59003,
-59754,
-59685,
-59160,
-58067,
-56522,
-54770,
-52156,
-48945,
-44738,
-39973,
-34660,
-29252,
-23719,
-18554,
-13641,
-9163,
-5245,
-1434,
-0,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-1,
-65535,
-0,
-0,
-65535,
-3,
-65535,
-2,
-326,
-1456,
-2787,
-4224,
-5910,
-7636,
-9938,
-12357,
-15275,
-18492,
-21921,
-25623,
-29474,
-33641,
-37825,
-42256,
-46399,
-50649,
-54461,
-58071,
-61280,
-63988,
-65531,
-65534,
-65531,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65531,
-65534,
-65530,
-65534,
-65533,
-65534,
-65534,
-65531,
-65534,
-65530,
-65534,
-65532,
-65534,
-65532,
-65534,
-65533,
-65534,
-65532,
-65534,
-65532,
-64607,
-63495,
-62281,
-61303,
-60064,
-58758,
-56941,
-55057,
-52823,
-50449,
-47218,
-43210,
-38266,
-32979,
-27744,
-23034,
-18331,
-13664,
-8830,
-4227,
-725,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-65535,
-0,
-947,
-3494,
-6752,
-10690,
-14882,
-19129,
-23188,
-27082,
-30606,
-33772,
-36165,
-37781,
-38802,
-39331,
-39732,
-39774,
-39798,
-39332,
-38933,
-38536,
-38289,
-38094,
-37536,
-36565,
-35256,
-33773,
-32377,
-31225,
-29964,
-28920,
-27707,
-26793,
-26110,
-25622,
-25089,
-24205,
-22676,
-20836,
-18469,
-16296,
-13926,
-11670,
-8851,
-5846,
-1830,
-1,
-65535,
-2,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-2,
-65535,
-0,
-1102,
-4845,
-7549,
-9009,
-9342,
-8721,
-6840,
-4114,
-106,
-65535,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-2,
-65535,
-2,
-65535,
-1,
-65535,
-770,
-9454,
-18221,
-26533,
-34235,
-40973,
-46795,
-52158,
-56829,
-60996,
-64580,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65532,
-65534,
-65532,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-62298,
-59091,
-56586,
-54372,
-52645,
-51224,
-49878,
-48809,
-47619,
-46353,
-45089,
-43654,
-42099,
-40042,
-37847,
-34638,
-31179,
-26954,
-22252,
-17317,
-11955,
-6374,
-726,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-3,
-65535,
-4,
-65535,
-3,
-65535,
-65535,
-1,
-65535,
-4,
-65535,
-4,
-65535,
-3,
-65535,
-1,
-65535,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-65535,
-0,
-990,
-2565,
-4181,
-6329,
-8567,
-11180,
-14282,
-17801,
-21859,
-26172,
-30851,
-35545,
-40726,
-45890,
-51602,
-57229,
-63098,
-65534,
-65531,
-65534,
-65529,
-65534,
-65532,
-65534,
-65532,
-65534,
-65531,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65134,
-61883,
-58489,
-54461,
-50762,
-46950,
-43719,
-40682,
-37782,
-34793,
-31401,
-27461,
-23095,
-18181,
-13306,
-8501,
-4136,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-4,
-65535,
-4,
-65535,
-65535,
-1,
-65535,
-636,
-2833,
-5795,
-9033,
-12620,
-15454,
-17583,
-18444,
-18779,
-18465,
-17961,
-17224,
-16166,
-15033,
-14060,
-13418,
-13460,
-13685,
-14213,
-14636,
-15302,
-16360,
-18271,
-20946,
-24493,
-28302,
-32244,
-35877,
-39420,
-42590,
-45664,
-48416,
-50693,
-52468,
-53374,
-53885,
-53573,
-53089,
-52198,
-50920,
-49494,
-47688,
-45706,
-43633,
-41146,
-38557,
-35635,
-32531,
-29564,
-26708,
-24556,
-22657,
-21256,
-19864,
-18200,
-16254,
-13682,
-11159,
-8500,
-6173,
-3786,
-1297,
-3,
-65535,
-2,
-65535,
-65535,
-0,
-65535,
-3,
-65535,
-0,
-0,
-65535,
-1,
-65535,
-65535,
-2,
-65535,
-3,
-65535,
-1,
-65535,
-65535,
-860,
-2251,
-2368,
-1675,
-2,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-8924,
-19150,
-29679,
-39794,
-49103,
-57337,
-64430,
-65531,
-65534,
-65529,
-65534,
-65531,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65531,
-65534,
-65531,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-62679,
-56253,
-50075,
-43740,
-37692,
-32069,
-27105,
-23118,
-19975,
-17358,
-15147,
-13017,
-11292,
-9674,
-8744,
-7835,
-7172,
-6063,
-4492,
-2586,
-282,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-1,
-65535,
-65535,
-2,
-65535,
-4,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-4,
-65535,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-4,
-4685,
-8926,
-12793,
-15634,
-17892,
-19286,
-20040,
-20418,
-20325,
-20398,
-20236,
-20796,
-21255,
-22723,
-24357,
-26886,
-30028,
-33619,
-38112,
-42834,
-48367,
-54417,
-61149,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65531,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65533,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-63917,
-60242,
-56630,
-52335,
-48435,
-44228,
-40417,
-36540,
-32712,
-28587,
-24318,
-19616,
-14837,
-10005,
-5223,
-791,
-0,
-65535,
-1,
-65535,
-2,
-65535,
-2,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-2520,
-5267,
-8056,
-10629,
-12838,
-14351,
-15164,
-15679,
-15786,
-16075,
-16166,
-16028,
-15746,
-14876,
-14262,
-13194,
-12665,
-11823,
-11622,
-11668,
-12864,
-14679,
-17317,
-20128,
-23007,
-25911,
-28833,
-31955,
-34839,
-37711,
-39934,
-42122,
-44026,
-46223,
-48323,
-50165,
-51469,
-51957,
-51803,
-50916,
-49521,
-47462,
-44933,
-41972,
-38730,
-35548,
-32441,
-29368,
-26437,
-23477,
-20702,
-18070,
-15698,
-13639,
-11711,
-10162,
-8412,
-7193,
-5620,
-4514,
-3095,
-1944,
-373,
-65535,
-2,
-65535,
-65535,
-1,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-65535,
-0,
-65535,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-3,
-65535,
-1,
-65535,
-65535,
-1,
-65535,
-65535,
-3,
-65535,
-1,
-0,
-65535,
-4,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-5403,
-12640,
-20373,
-29144,
-38245,
-47486,
-56052,
-63965,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-62390,
-56143,
-50053,
-43674,
-37936,
-32089,
-26242,
-20417,
-14324,
-8702,
-3226,
-1,
-65535,
-2,
-65535,
-5,
-65535,
-2,
-65535,
-65535,
-0,
-0,
-65535,
-1,
-65535,
-0,
-65535,
-0,
-65535,
-1,
-65535,
-0,
-0,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-2,
-65535,
-2,
-65535,
-65535,
-2,
-65535,
-3,
-65535,
-995,
-7900,
-14836,
-21258,
-27371,
-32798,
-37937,
-42566,
-46752,
-50342,
-53283,
-55505,
-57358,
-58451,
-59464,
-59910,
-60195,
-60376,
-60705,
-61462,
-62719,
-64496,
-65533,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65532,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-63608,
-59576,
-55923,
-52532,
-49544,
-46508,
-43630,
-40749,
-38226,
-36318,
-35369,
-35299,
-36145,
-37314,
-38604,
-39108,
-39068,
-37825,
-35944,
-33351,
-30340,
-27039,
-23451,
-19399,
-14700,
-9564,
-3716,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-3,
-65535,
-0,
-0,
-65535,
-1,
-65535,
-1791,
-7368,
-12977,
-18022,
-22965,
-27217,
-31290,
-34595,
-37335,
-39091,
-39819,
-39243,
-37628,
-35056,
-32023,
-28856,
-25754,
-22986,
-20550,
-18311,
-16653,
-15055,
-14503,
-14326,
-15210,
-16698,
-18885,
-21727,
-25130,
-29347,
-33947,
-39246,
-44534,
-49990,
-54965,
-59471,
-63138,
-65534,
-65532,
-65534,
-65534,
-64935,
-63101,
-60726,
-57895,
-54372,
-50029,
-45136,
-39664,
-34039,
-28213,
-22720,
-17293,
-12422,
-7878,
-3807,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-2,
-65535,
-4,
-65535,
-1,
-65535,
-65535,
-2,
-65535,
-1,
-65535,
-0,
-65535,
-0,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-1,
-65535,
-3074,
-6794,
-11537,
-16802,
-22902,
-29626,
-36701,
-44224,
-51693,
-58911,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65530,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65531,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65426,
-60150,
-54309,
-48299,
-41748,
-34992,
-27989,
-20642,
-13281,
-6021,
-65535,
-65535,
-0,
-65535,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-1,
-65535,
-4,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-2,
-65535,
-2,
-65535,
-1,
-65535,
-0,
-5132,
-11448,
-18111,
-24936,
-31935,
-38643,
-45271,
-51113,
-56544,
-61037,
-65160,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65531,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-63541,
-59423,
-55810,
-52557,
-49718,
-47175,
-45378,
-43962,
-43142,
-42365,
-41727,
-40946,
-40265,
-39951,
-39797,
-39932,
-40083,
-39755,
-38998,
-37584,
-35676,
-33509,
-31068,
-28459,
-25819,
-22921,
-20305,
-17272,
-14502,
-11402,
-8499,
-5844,
-3493,
-2013,
-877,
-419,
-213,
-352,
-990,
-2011,
-3539,
-5576,
-7637,
-10028,
-12110,
-14349,
-16539,
-18491,
-20526,
-22145,
-23561,
-24670,
-25333,
-25556,
-25355,
-24470,
-23275,
-21677,
-19910,
-18465,
-17272,
-16542,
-16272,
-16078,
-16316,
-16631,
-17404,
-18644,
-20462,
-22631,
-25355,
-27904,
-30737,
-33354,
-36051,
-38650,
-41209,
-43368,
-45243,
-46555,
-47460,
-47682,
-47639,
-46640,
-45514,
-43650,
-41592,
-39199,
-36452,
-33331,
-29896,
-26309,
-22631,
-19220,
-15899,
-12908,
-10093,
-7308,
-4730,
-2391,
-324,
-1,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-2,
-65535,
-2,
-65535,
-65535,
-2,
-65535,
-2,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-504,
-658,
-1,
-65535,
-0,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-3762,
-10892,
-19132,
-28169,
-37913,
-47951,
-58001,
-65534,
-65530,
-65534,
-65530,
-65534,
-65530,
-65534,
-65532,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65532,
-65534,
-65531,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65531,
-65534,
-65534,
-65534,
-65534,
-63718,
-56676,
-49564,
-42036,
-34524,
-26707,
-19222,
-11843,
-5023,
-1,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-2,
-65535,
-1,
-65535,
-1810,
-3872,
-5111,
-5797,
-5645,
-4888,
-3385,
-1123,
-0,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-65535,
-2,
-65535,
-3,
-65535,
-0,
-2520,
-10272,
-18091,
-26086,
-33862,
-41635,
-48791,
-55633,
-61637,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65531,
-65534,
-65532,
-65534,
-65534,
-65531,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-64031,
-59906,
-56170,
-52861,
-49658,
-46969,
-44254,
-42319,
-40397,
-39288,
-38068,
-37097,
-35920,
-34725,
-33197,
-31780,
-29916,
-27995,
-25752,
-23031,
-20107,
-16783,
-13328,
-10053,
-6814,
-4250,
-1788,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-4,
-65535,
-4,
-65535,
-3,
-65535,
-1,
-65535,
-65535,
-2,
-65535,
-3,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-1567,
-3297,
-5285,
-7286,
-9295,
-11535,
-13906,
-16449,
-19201,
-21722,
-24315,
-26397,
-28324,
-29874,
-31226,
-32222,
-32997,
-33751,
-34260,
-35056,
-35569,
-36229,
-36566,
-36539,
-36143,
-35413,
-34480,
-33464,
-32421,
-31335,
-30209,
-28963,
-27618,
-26064,
-24292,
-22477,
-20349,
-18646,
-16761,
-15279,
-13814,
-12356,
-10936,
-9630,
-8610,
-7748,
-6927,
-5643,
-3983,
-1476,
-2,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-65535,
-3,
-65535,
-4,
-65535,
-2,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-3297,
-7390,
-10363,
-11910,
-12532,
-11911,
-10715,
-8810,
-6441,
-3648,
-616,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-65535,
-2,
-65535,
-6644,
-15186,
-24448,
-34616,
-45112,
-55922,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65531,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65531,
-65534,
-65534,
-65534,
-60110,
-53018,
-45668,
-38247,
-30671,
-23607,
-16650,
-10561,
-4999,
-64,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-2,
-390,
-508,
-103,
-0,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-4404,
-10738,
-17580,
-24760,
-32063,
-39513,
-46617,
-53377,
-59554,
-65069,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65532,
-65534,
-65532,
-65534,
-65532,
-65534,
-61789,
-56677,
-51602,
-46553,
-41592,
-36984,
-32665,
-28856,
-25399,
-22522,
-20040,
-18201,
-16741,
-15984,
-15281,
-14877,
-14039,
-13106,
-11823,
-10472,
-9009,
-7549,
-5996,
-4225,
-2389,
-257,
-3,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-1,
-65535,
-3,
-65535,
-2,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-1018,
-2384,
-3784,
-4867,
-6462,
-7858,
-9630,
-11602,
-13682,
-16032,
-18444,
-20882,
-23474,
-25842,
-28502,
-31092,
-33795,
-36607,
-39179,
-41876,
-43832,
-45797,
-47308,
-48545,
-49720,
-50452,
-51138,
-51182,
-51048,
-50320,
-49342,
-48061,
-46463,
-44692,
-42589,
-40306,
-37871,
-35255,
-32822,
-30095,
-27504,
-24627,
-21852,
-19357,
-16981,
-15081,
-13106,
-11335,
-9474,
-7926,
-6528,
-5178,
-3583,
-1234,
-1,
-65535,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-1,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-1368,
-4336,
-5997,
-6817,
-6994,
-6507,
-5575,
-4073,
-2185,
-151,
-65535,
-65535,
-3,
-65535,
-3,
-65535,
-65535,
-1,
-4090,
-10984,
-19129,
-28570,
-38355,
-48659,
-58889,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65531,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65531,
-65534,
-65531,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-59840,
-54331,
-48409,
-42525,
-36340,
-30098,
-23826,
-17760,
-11975,
-6642,
-1477,
-1,
-65535,
-1,
-65535,
-65535,
-1,
-65535,
-4,
-65535,
-3,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-0,
-657,
-2633,
-4157,
-5201,
-5777,
-6083,
-5955,
-5664,
-5046,
-4535,
-4203,
-4536,
-5287,
-6730,
-8566,
-10803,
-13618,
-16650,
-20417,
-24382,
-28920,
-33775,
-38865,
-44317,
-49941,
-55613,
-61502,
-65534,
-65531,
-65534,
-65533,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65530,
-65534,
-65531,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-64608,
-60526,
-56545,
-52466,
-48435,
-44915,
-41301,
-38206,
-34855,
-32004,
-28984,
-26556,
-24001,
-21971,
-19793,
-17916,
-16118,
-14436,
-13153,
-11665,
-10231,
-8543,
-6218,
-3916,
-880,
-0,
-65535,
-65535,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-2,
-65535,
-0,
-2077,
-5332,
-8302,
-11267,
-13863,
-16249,
-18117,
-19482,
-20509,
-21322,
-22035,
-22785,
-23475,
-24136,
-24826,
-25731,
-26751,
-28258,
-29765,
-31710,
-33887,
-36426,
-39468,
-42699,
-46175,
-49567,
-52863,
-55991,
-58866,
-61593,
-63853,
-65532,
-65534,
-65531,
-65534,
-65533,
-65534,
-64538,
-62390,
-59775,
-57009,
-53684,
-50429,
-46509,
-42498,
-38072,
-33550,
-28989,
-24490,
-20109,
-15808,
-11624,
-7548,
-3825,
-129,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-2,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-3,
-65535,
-3,
-65535,
-65535,
-0,
-65535,
-65535,
-2,
-65535,
-3,
-65535,
-2,
-65535,
-4,
-65535,
-3,
-65535,
-0,
-65535,
-1,
-65535,
-4,
-2007,
-6508,
-10583,
-14167,
-16899,
-18642,
-19621,
-20105,
-20285,
-20503,
-20441,
-20393,
-20506,
-20992,
-22476,
-24958,
-28522,
-33131,
-38601,
-44759,
-51581,
-58713,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65532,
-65534,
-65532,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65530,
-65534,
-65531,
-65534,
-65534,
-65533,
-65534,
-65531,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-63032,
-58580,
-54393,
-49877,
-45687,
-41594,
-37668,
-33864,
-29894,
-25978,
-22077,
-18467,
-15102,
-11953,
-8770,
-5395,
-1969,
-65535,
-0,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-3,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-2543,
-7060,
-11534,
-15501,
-19461,
-23078,
-26571,
-29633,
-32399,
-34768,
-37052,
-39332,
-41413,
-43520,
-45156,
-46665,
-47792,
-48880,
-49718,
-50653,
-51490,
-52380,
-53440,
-54505,
-55901,
-57426,
-59335,
-61548,
-64293,
-65534,
-65533,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-64894,
-60418,
-55966,
-51449,
-46928,
-42279,
-37692,
-33264,
-29321,
-25555,
-22365,
-19443,
-16738,
-14705,
-12950,
-12067,
-11446,
-11445,
-11381,
-11689,
-11800,
-12245,
-12485,
-12776,
-12841,
-12908,
-12687,
-12576,
-11887,
-11094,
-9428,
-7350,
-4580,
-1655,
-0,
-65535,
-2,
-65535,
-2,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-3,
-65535,
-2,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-2365,
-7280,
-12312,
-17402,
-22234,
-27063,
-31178,
-35171,
-38310,
-41130,
-43116,
-44852,
-45706,
-46401,
-46353,
-46175,
-45470,
-44713,
-43761,
-42812,
-41944,
-41171,
-40573,
-40262,
-40107,
-40242,
-40658,
-41108,
-41965,
-42766,
-43763,
-44801,
-45758,
-46817,
-47639,
-48413,
-48834,
-49189,
-48945,
-48635,
-47860,
-46795,
-45713,
-44270,
-42944,
-41214,
-39421,
-37294,
-34748,
-31955,
-28791,
-25421,
-22079,
-18376,
-15082,
-11487,
-8127,
-4755,
-1213,
-65535,
-0,
-65535,
-2,
-65535,
-1,
-65535,
-2,
-65535,
-1,
-65535,
-0,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-3,
-65535,
-2,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-0,
-438,
-5863,
-10783,
-15498,
-19797,
-23894,
-27992,
-31756,
-35369,
-38511,
-41326,
-44007,
-46618,
-49166,
-51826,
-54280,
-56790,
-59197,
-61749,
-64360,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-64782,
-63430,
-62214,
-61147,
-59933,
-58778,
-57097,
-55368,
-53153,
-50895,
-48523,
-45823,
-43363,
-40329,
-37361,
-34170,
-30895,
-27725,
-24647,
-21636,
-18886,
-16189,
-13658,
-11427,
-9471,
-7950,
-6703,
-5911,
-5377,
-5110,
-5356,
-5753,
-6684,
-7793,
-9251,
-10894,
-12773,
-14572,
-16648,
-18603,
-20813,
-23098,
-25488,
-27881,
-30096,
-32067,
-33662,
-34969,
-36031,
-36919,
-37824,
-38427,
-39174,
-39446,
-39927,
-40088,
-40260,
-40552,
-40594,
-40817,
-40859,
-41150,
-41435,
-42013,
-42655,
-43584,
-44316,
-45247,
-45776,
-46555,
-47083,
-47837,
-48416,
-49363,
-50032,
-51160,
-52045,
-53021,
-54040,
-54502,
-54974,
-54987,
-54708,
-54456,
-53911,
-53416,
-52756,
-51847,
-50869,
-49547,
-48079,
-46487,
-44915,
-43294,
-41704,
-39929,
-38293,
-36474,
-34902,
-33174,
-31780,
-30185,
-28854,
-27529,
-26592,
-25671,
-25152,
-24474,
-24001,
-23520,
-23250,
-23253,
-23583,
-23895,
-24490,
-24694,
-25243,
-25335,
-25754,
-25798,
-26089,
-26018,
-26067,
-25796,
-25557,
-24957,
-24159,
-23165,
-22053,
-20949,
-19975,
-18886,
-17960,
-16937,
-15899,
-15124,
-14390,
-14062,
-13902,
-13973,
-14148,
-14657,
-15212,
-16252,
-17448,
-18979,
-20657,
-22479,
-24380,
-26397,
-28480,
-30670,
-32865,
-34949,
-36826,
-38561,
-39880,
-41198,
-42164,
-42768,
-43206,
-42989,
-42851,
-42149,
-41543,
-40554,
-39661,
-38428,
-37136,
-35812,
-34437,
-33263,
-32001,
-30915,
-29919,
-29188,
-28788,
-28658,
-28609,
-28526,
-28256,
-27837,
-27349,
-26995,
-26485,
-26043,
-25289,
-24271,
-23118,
-21635,
-20151,
-18378,
-16387,
-14323,
-12046,
-9894,
-7993,
-6084,
-4492,
-2807,
-1213,
-1,
-65535,
-2,
-65535,
-2,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-2,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-1,
-65535,
-3,
-65535,
-1,
-0,
-65535,
-3,
-65535,
-2,
-65535,
-65535,
-2,
-1231,
-3277,
-5330,
-7194,
-9211,
-11155,
-13574,
-15854,
-18643,
-21372,
-24268,
-27417,
-30494,
-33705,
-36766,
-39705,
-42503,
-45244,
-47727,
-50363,
-52532,
-54638,
-56388,
-57716,
-58800,
-59534,
-60018,
-60553,
-60773,
-61391,
-61662,
-62363,
-62771,
-63405,
-63987,
-64758,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65531,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-64871,
-63740,
-62590,
-61679,
-60775,
-60062,
-59468,
-58600,
-58028,
-57183,
-56565,
-55988,
-55457,
-54771,
-54083,
-53109,
-52046,
-50850,
-49476,
-48127,
-46772,
-45492,
-44293,
-43097,
-41946,
-40727,
-39776,
-38977,
-38470,
-38355,
-38360,
-38688,
-38934,
-39421,
-39864,
-40528,
-41060,
-41657,
-42213,
-42388,
-42655,
-42388,
-42168,
-41547,
-40661,
-39310,
-37670,
-35768,
-33727,
-31868,
-29808,
-27991,
-26155,
-24446,
-22943,
-21545,
-20239,
-19112,
-17867,
-16963,
-16184,
-15878,
-15896,
-16233,
-16670,
-17052,
-17559,
-18113,
-18976,
-20174,
-21612,
-23274,
-24781,
-26151,
-27174,
-27946,
-28680,
-29297,
-29920,
-30626,
-31071,
-31535,
-31780,
-31956,
-32023,
-32134,
-31999,
-32047,
-31733,
-31692,
-31469,
-31534,
-31826,
-32198,
-32910,
-33462,
-34282,
-34791,
-35657,
-36053,
-36896,
-37450,
-38179,
-38979,
-39730,
-40574,
-41434,
-42193,
-43182,
-43965,
-45044,
-45956,
-47217,
-48215,
-49564,
-50474,
-51292,
-51803,
-52024,
-52223,
-52444,
-52601,
-52863,
-52802,
-52686,
-52025,
-51381,
-50363,
-49342,
-47996,
-46593,
-45116,
-43783,
-42433,
-41238,
-39707,
-38204,
-36740,
-35301,
-34416,
-33526,
-32980,
-32483,
-32160,
-32086,
-32113,
-32223,
-32330,
-32225,
-32464,
-32754,
-33509,
-34256,
-34729,
-34766,
-34263,
-33549,
-32865,
-32245,
-31535,
-30694,
-29388,
-27900,
-26356,
-24822,
-23408,
-21923,
-20326,
-18668,
-16785,
-15231,
-13642,
-12617,
-11647,
-11069,
-10272,
-9607,
-8833,
-8213,
-8033,
-8170,
-8786,
-9410,
-10050,
-10339,
-10471,
-10515,
-10341,
-10248,
-9609,
-8831,
-7548,
-6264,
-5000,
-4027,
-3360,
-2853,
-2586,
-2255,
-1986,
-1925,
-1764,
-1880,
-1986,
-2455,
-2894,
-3918,
-4711,
-6020,
-6972,
-8101,
-9098,
-10073,
-11203,
-12198,
-13486,
-14545,
-15722,
-16584,
-17581,
-18314,
-19374,
-20330,
-21278,
-22035,
-22409,
-22521,
-22367,
-21987,
-21659,
-21278,
-20951,
-20924,
-20861,
-21058,
-21324,
-21415,
-21677,
-21771,
-22251,
-22968,
-24001,
-24893,
-25620,
-25756,
-25732,
-25511,
-25555,
-25799,
-26042,
-26375,
-26375,
-26507,
-26375,
-26641,
-26640,
-27040,
-27215,
-27594,
-27680,
-27663,
-27058,
-26510,
-25797,
-25733,
-25910,
-26817,
-27329,
-27989,
-28150,
-28497,
-28815,
-29495,
-30031,
-30738,
-31446,
-32269,
-33304,
-34108,
-34789,
-34572,
-34171,
-33285,
-32688,
-32287,
-32556,
-32775,
-33597,
-33993,
-34702,
-35037,
-35476,
-35769,
-36295,
-36809,
-37736,
-38536,
-39641,
-40463,
-41413,
-42258,
-43073,
-43808,
-44249,
-44469,
-44673,
-44490,
-44540,
-44314,
-43895,
-43298,
-42454,
-41748,
-41146,
-40642,
-40569,
-40333,
-40392,
-40376,
-40547,
-41041,
-41788,
-42789,
-44073,
-45442,
-46912,
-48409,
-49945,
-51423,
-52978,
-54393,
-55723,
-56918,
-57784,
-58489,
-58915,
-59154,
-59135,
-58778,
-58072,
-56962,
-55634,
-54219,
-52840,
-51473,
-50404,
-49125,
-48079,
-47064,
-46242,
-45644,
-45491,
-45401,
-45688,
-46067,
-46506,
-46955,
-47458,
-47730,
-47968,
-48038,
-47770,
-47241,
-46330,
-44937,
-43407,
-41459,
-39663,
-37718,
-35851,
-34086,
-32131,
-30386,
-28765,
-27329,
-26551,
-25954,
-25887,
-25977,
-26263,
-26709,
-27036,
-27530,
-27855,
-28106,
-28344,
-28390,
-28702,
-29031,
-29566,
-30050,
-30584,
-30937,
-31336,
-31737,
-32440,
-33290,
-34432,
-35416,
-36273,
-36742,
-37205,
-37583,
-37936,
-38424,
-38780,
-39108,
-39512,
-39884,
-40330,
-40970,
-41393,
-42056,
-42610,
-43653,
-44712,
-45845,
-46620,
-46750,
-46400,
-45643,
-44737,
-44139,
-43497,
-43272,
-42946,
-42828,
-42724,
-42410,
-42322,
-42013,
-42011,
-42280,
-42674,
-43233,
-43605,
-43674,
-43697,
-43406,
-43209,
-42632,
-42012,
-41150,
-40416,
-39798,
-39265,
-38691,
-37558,
-36346,
-34743,
-33754,
-33105,
-32823,
-32686,
-32334,
-32022,
-31779,
-31692,
-31445,
-30718,
-29740,
-28457,
-27660,
-27348,
-27373,
-27503,
-27106,
-26309,
-25421,
-24826,
-24602,
-24691,
-24604,
-24247,
-23784,
-23274,
-23428,
-23851,
-24779,
-25489,
-25998,
-25975,
-26001,
-25796,
-25979,
-25951,
-26110,
-25866,
-25997,
-26111,
-27081,
-28260,
-29584,
-30408,
-30515,
-30008,
-29010,
-28059,
-27083,
-26374,
-25645,
-24624,
-23717,
-22654,
-21967,
-21435,
-21038,
-20746,
-20508,
-20747,
-21570,
-22985,
-24601,
-26046,
-26659,
-26865,
-26373,
-26065,
-25600,
-25578,
-25398,
-25668,
-26107,
-27041,
-28213,
-29364,
-30362,
-30827,
-30870,
-30363,
-29542,
-28433,
-27218,
-26307,
-25579,
-25044,
-24228,
-23205,
-21748,
-20636,
-19798,
-19773,
-19863,
-19908,
-19773,
-19355,
-19551,
-20351,
-21678,
-23342,
-24424,
-25180,
-25288,
-25445,
-25578,
-25821,
-26130,
-26442,
-26773,
-27616,
-28523,
-30139,
-31471,
-32795,
-33267,
-33282,
-32490,
-31469,
-30426,
-29811,
-29561,
-29766,
-30028,
-30362,
-30761,
-31268,
-31981,
-32706,
-33378,
-33370,
-33289,
-32729,
-32622,
-32643,
-32930,
-32955,
-32995,
-32667,
-32798,
-33107,
-33906,
-34725,
-35191,
-35300,
-35014,
-35233,
-35922,
-37605,
-39819,
-42123,
-44027,
-45048,
-45312,
-45091,
-44626,
-44292,
-44008,
-44315,
-44626,
-45600,
-46420,
-47284,
-47705,
-47793,
-47572,
-47395,
-47305,
-47351,
-47438,
-47418,
-47194,
-47085,
-46862,
-46753,
-46310,
-45576,
-44385,
-43094,
-41794,
-40836,
-39954,
-39109,
-37783,
-36342,
-34436,
-33043,
-31778,
-30938,
-30274,
-29319,
-28347,
-27261,
-26683,
-26444,
-26705,
-26929,
-27239,
-27415,
-27660,
-28191,
-28456,
-28569,
-28035,
-26951,
-25754,
-24669,
-24116,
-23784,
-23561,
-22920,
-21856,
-20592,
-19424,
-18727,
-18630,
-18748,
-18850,
-18817,
-18227,
-17601,
-16698,
-15785,
-14792,
-14170,
-13704,
-14217,
-14899,
-16432,
-17358,
-18756,
-19708,
-21213,
-22920,
-24692,
-26440,
-27639,
-28765,
-29786,
-30784,
-31955,
-32489,
-33019,
-33107,
-33709,
-34501,
-35745,
-36852,
-37691,
-38538,
-39284,
-40287,
-41258,
-41992,
-42453,
-42855,
-43385,
-43807,
-43651,
-42566,
-40837,
-39424,
-38909,
-39710,
-40992,
-41769,
-41548,
-40705,
-39952,
-40130,
-40771,
-41637,
-41900,
-41991,
-42056,
-42744,
-43406,
-43897,
-43493,
-42725,
-42208,
-42148,
-42630,
-43144,
-42874,
-42589,
-41880,
-41635,
-41349,
-40792,
-39842,
-38847,
-37978,
-37452,
-36828,
-35279,
-33108,
-30473,
-28433,
-27263,
-26617,
-25887,
-24582,
-23139,
-21947,
-21433,
-21306,
-20899,
-20111,
-19062,
-18447,
-18534,
-18820,
-18868,
-18356,
-17426,
-17140,
-17113,
-17717,
-17558,
-16851,
-15833,
-15319,
-16101,
-17577,
-19380,
-20413,
-20929,
-21057,
-21481,
-21988,
-22566,
-22740,
-22857,
-23602,
-24784,
-27212,
-29458,
-31443,
-32580,
-32839,
-33266,
-33616,
-34704,
-35987,
-37294,
-38314,
-39199,
-39642,
-40108,
-40217,
-40286,
-39862,
-39401,
-38732,
-38425,
-38291,
-38712,
-39132,
-39600,
-39862,
-39931,
-39886,
-39906,
-39956,
-40015,
-40022,
-39839,
-39666,
-39486,
-39445,
-39594,
-39581,
-39615,
-39181,
-38732,
-38247,
-37982,
-37958,
-38181,
-38179,
-37851,
-36826,
-35370,
-33572,
-31690,
-29920,
-27991,
-26242,
-24271,
-22719,
-21348,
-20615,
-20084,
-19864,
-19619,
-19485,
-19466,
-19418,
-19465,
-19243,
-18932,
-18578,
-18291,
-18311,
-18158,
-17914,
-17404,
-16784,
-16518,
-16607,
-17160,
-17737,
-18202,
-18533,
-18668,
-18909,
-19132,
-19465,
-19640,
-19998,
-20082,
-20329,
-20195,
-20062,
-19840,
-20196,
-21191,
-22943,
-24801,
-26220,
-27149,
-27218,
-27879,
-28836,
-30869,
-33131,
-35168,
-36231,
-36697,
-36895,
-38026,
-40240,
-43408,
-46552,
-48791,
-49875,
-50053,
-50383,
-51029,
-52287,
-53511,
-54480,
-55347,
-56387,
-57826,
-59534,
-61081,
-62325,
-63208,
-64273,
-65379,
-65534,
-65533,
-65534,
-65532,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65531,
-65534,
-65530,
-65534,
-65353,
-64275,
-63075,
-61682,
-59996,
-57741,
-55099,
-52980,
-51555,
-51251,
-50827,
-49654,
-47216,
-44251,
-41390,
-39135,
-36806,
-33860,
-29965,
-26064,
-23206,
-22213,
-22386,
-22810,
-22387,
-21280,
-20263,
-20060,
-20907,
-21875,
-22479,
-21877,
-20926,
-19709,
-18931,
-18624,
-18377,
-18558,
-18421,
-18625,
-18022,
-17406,
-16073,
-15280,
-14989,
-15434,
-16207,
-16607,
-16386,
-15985,
-15347,
-15452,
-15480,
-15587,
-15520,
-15479,
-15897,
-16630,
-17448,
-17914,
-17957,
-18269,
-19398,
-21656,
-24360,
-26707,
-27858,
-28037,
-27969,
-28346,
-29476,
-31159,
-32775,
-34085,
-35055,
-35635,
-35986,
-35989,
-35788,
-35677,
-36166,
-37138,
-38691,
-39996,
-41037,
-41748,
-42188,
-42500,
-42588,
-42433,
-42455,
-42987,
-44515,
-46397,
-48061,
-48477,
-47752,
-46683,
-46068,
-46130,
-46266,
-45711,
-44050,
-42344,
-41239,
-41455,
-42194,
-42450,
-41596,
-40082,
-39156,
-39400,
-40791,
-42237,
-42408,
-41194,
-39023,
-37071,
-35922,
-35546,
-35210,
-34418,
-32950,
-31250,
-29541,
-28590,
-27948,
-27724,
-27484,
-26728,
-25445,
-23828,
-22120,
-20774,
-19948,
-19201,
-18422,
-17271,
-15877,
-14834,
-14369,
-14526,
-14989,
-14747,
-14148,
-12775,
-11777,
-11249,
-11510,
-11979,
-12177,
-11711,
-10694,
-9851,
-9518,
-10008,
-10691,
-11049,
-10625,
-9809,
-9273,
-9654,
-11134,
-13087,
-14834,
-15965,
-16983,
-17892,
-19375,
-20373,
-21059,
-20769,
-20531,
-20634,
-21550,
-22561,
-23144,
-22741,
-22056,
-21657,
-22054,
-22435,
-22540,
-21527,
-20392,
-19598,
-19863,
-20593,
-21148,
-21103,
-20971,
-21456,
-22988,
-25109,
-26401,
-26836,
-26068,
-25552,
-25889,
-26951,
-28257,
-28988,
-29277,
-29054,
-29099,
-28834,
-28101,
-27019,
-25509,
-24892,
-24668,
-25357,
-25399,
-25269,
-24556,
-24296,
-24445,
-25203,
-25508,
-25404,
-24666,
-24140,
-24336,
-25178,
-26353,
-26885,
-26904,
-26334,
-25883,
-25914,
-26238,
-26865,
-26749,
-26333,
-25309,
-24450,
-23958,
-23875,
-24245,
-24319,
-24332,
-23943,
-23426,
-23031,
-22477,
-22254,
-22122,
-22655,
-23804,
-25224,
-26618,
-27282,
-27461,
-27593,
-28103,
-29319,
-30430,
-31157,
-30895,
-30583,
-30471,
-31160,
-32289,
-33195,
-33753,
-34213,
-35082,
-36738,
-38692,
-40283,
-41061,
-41658,
-42409,
-44164,
-46394,
-48705,
-50382,
-51471,
-52423,
-53462,
-54706,
-55632,
-56212,
-56562,
-57297,
-58757,
-60927,
-63101,
-64712,
-65534,
-65532,
-65534,
-65533,
-65292,
-64871,
-64293,
-64031,
-64181,
-64563,
-65068,
-65027,
-64226,
-62902,
-61412,
-60466,
-60216,
-60620,
-60994,
-61192,
-60908,
-60660,
-60730,
-61260,
-61791,
-61991,
-61505,
-60395,
-59423,
-58578,
-58272,
-58135,
-57719,
-57093,
-56013,
-55035,
-53685,
-52335,
-50382,
-48372,
-46042,
-44139,
-42367,
-41014,
-39667,
-38466,
-36897,
-35500,
-33684,
-32157,
-30736,
-29788,
-29496,
-29389,
-29717,
-29633,
-29517,
-29258,
-29140,
-29389,
-29696,
-29964,
-29675,
-29187,
-28480,
-28101,
-28059,
-28391,
-28898,
-29101,
-28965,
-28546,
-28080,
-27682,
-27459,
-27196,
-26794,
-26332,
-25953,
-25865,
-26066,
-26373,
-26664,
-26597,
-26483,
-26266,
-26484,
-26797,
-27548,
-28059,
-28566,
-28813,
-29008,
-28925,
-28898,
-28568,
-28391,
-28256,
-28170,
-28168,
-27948,
-27681,
-27261,
-27083,
-27239,
-27903,
-28678,
-29277,
-29431,
-29076,
-28570,
-28122,
-28592,
-29452,
-31226,
-32842,
-34150,
-34679,
-34639,
-34590,
-34925,
-35789,
-36784,
-37162,
-36674,
-35478,
-34371,
-33751,
-34192,
-34417,
-34612,
-33532,
-32330,
-31206,
-31157,
-31714,
-32576,
-32355,
-31470,
-29542,
-27880,
-26907,
-26640,
-27217,
-27460,
-27681,
-27394,
-27128,
-26884,
-26928,
-26619,
-26153,
-25068,
-23872,
-22786,
-22146,
-21831,
-21616,
-21056,
-20019,
-18624,
-17268,
-16256,
-15784,
-15613,
-15320,
-14947,
-14081,
-13462,
-13041,
-13084,
-13574,
-13992,
-14037,
-13685,
-12773,
-12068,
-11290,
-11201,
-10895,
-10846,
-10452,
-10246,
-10453,
-11177,
-12180,
-12972,
-13308,
-13195,
-13439,
-14371,
-16185,
-18357,
-20085,
-21212,
-22147,
-23138,
-25402,
-27881,
-30671,
-32113,
-32552,
-31804,
-30912,
-30300,
-30401,
-30986,
-31864,
-32557,
-33284,
-33553,
-33925,
-34107,
-34569,
-35035,
-35457,
-35477,
-35257,
-35014,
-35254,
-36235,
-37556,
-38628,
-39129,
-38714,
-38711,
-39199,
-40884,
-42609,
-43941,
-44002,
-43280,
-42671,
-42372,
-43359,
-43943,
-44689,
-43941,
-43075,
-41524,
-40332,
-39173,
-38493,
-37958,
-37959,
-37871,
-37691,
-37164,
-36096,
-35126,
-34369,
-33818,
-33350,
-32158,
-30669,
-28969,
-28035,
-27658,
-28038,
-28079,
-27926,
-27350,
-27170,
-27307,
-27591,
-27639,
-26905,
-25910,
-25003,
-24666,
-24894,
-25419,
-25580,
-25533,
-25310,
-25181,
-25287,
-25358,
-25465,
-25468,
-25887,
-26219,
-26864,
-27037,
-27217,
-27084,
-27370,
-27817,
-28166,
-28171,
-27657,
-27085,
-27062,
-27680,
-29079,
-30426,
-31581,
-32243,
-32845,
-33726,
-35059,
-36695,
-38269,
-39643,
-40461,
-41481,
-42101,
-42986,
-43764,
-44380,
-45114,
-45801,
-46993,
-48417,
-50227,
-52158,
-53840,
-55279,
-56144,
-56763,
-57209,
-57491,
-57831,
-58045,
-58206,
-58113,
-57961,
-57361,
-56876,
-56141,
-55748,
-55520,
-55371,
-55080,
-54481,
-53842,
-53351,
-53597,
-54283,
-55235,
-55812,
-55722,
-55236,
-54393,
-54084,
-53906,
-54040,
-53884,
-53574,
-53154,
-53196,
-53798,
-54902,
-55922,
-56499,
-56030,
-55062,
-53195,
-51781,
-50253,
-49119,
-47908,
-46239,
-44163,
-41790,
-39642,
-38048,
-37271,
-36941,
-36896,
-36386,
-35500,
-34194,
-33018,
-32203,
-32064,
-32225,
-32308,
-31760,
-30536,
-29146,
-28167,
-28037,
-28501,
-28877,
-28679,
-27903,
-27149,
-27041,
-27569,
-28060,
-27680,
-26242,
-24050,
-22276,
-21215,
-20970,
-20593,
-19709,
-18200,
-16851,
-16032,
-16073,
-16455,
-16913,
-17164,
-17690,
-18269,
-19109,
-19620,
-19641,
-19442,
-18933,
-19065,
-19264,
-19754,
-20037,
-20043,
-19861,
-19820,
-19484,
-19533,
-19462,
-19975,
-21014,
-22321,
-23674,
-24313,
-24493,
-24314,
-24316,
-24690,
-25025,
-25221,
-24871,
-24667,
-24449,
-25023,
-25600,
-26065,
-26196,
-26221,
-26574,
-27614,
-28769,
-29827,
-29921,
-29586,
-28810,
-28480,
-28589,
-28834,
-28922,
-28456,
-27749,
-26972,
-26707,
-26486,
-26485,
-25866,
-24757,
-23318,
-21968,
-21212,
-21040,
-21055,
-21084,
-20392,
-19533,
-18332,
-17629,
-17157,
-17030,
-16672,
-16165,
-15454,
-14991,
-14968,
-15409,
-16299,
-17048,
-17537,
-17385,
-16980,
-16299,
-16162,
-16343,
-16870,
-17497,
-17333,
-17010,
-16116,
-15900,
-16074,
-17028,
-17738,
-17911,
-16941,
-15720,
-14458,
-14327,
-14745,
-15810,
-16629,
-17183,
-17470,
-17871,
-18598,
-19798,
-21014,
-22543,
-23628,
-24958,
-26063,
-27174,
-28521,
-29743,
-31292,
-32642,
-33841,
-34612,
-34948,
-35279,
-35522,
-36187,
-36852,
-37559,
-38027,
-38135,
-38291,
-38203,
-38357,
-38579,
-38867,
-39311,
-40017,
-40729,
-41790,
-42588,
-43342,
-43894,
-44405,
-44648,
-44936,
-45046,
-45181,
-45443,
-45913,
-46529,
-47240,
-47572,
-47815,
-47572,
-47549,
-47351,
-47394,
-47062,
-46798,
-46130,
-45625,
-45155,
-44783,
-44668,
-44251,
-44028,
-43362,
-42678,
-41878,
-41083,
-40439,
-40153,
-40039,
-40220,
-40217,
-39908,
-39266,
-38136,
-37163,
-35896,
-35062,
-34033,
-33356,
-32774,
-32555,
-32599,
-32864,
-32997,
-33044,
-33038,
-33134,
-33083,
-32955,
-32509,
-31869,
-31689,
-31649,
-32152,
-32470,
-32263,
-32069,
-31380,
-31867,
-32203,
-33126,
-33046,
-32240,
-30875,
-29629,
-29231,
-29567,
-30292,
-30697,
-30825,
-30383,
-30165,
-29716,
-29612,
-29361,
-29501,
-29806,
-30585,
-31467,
-32113,
-32597,
-32667,
-33174,
-33639,
-34683,
-35608,
-36677,
-37713,
-39157,
-40526,
-42303,
-43471,
-44540,
-45156,
-45844,
-46487,
-47084,
-47239,
-47064,
-46551,
-46222,
-45932,
-46088,
-46021,
-46022,
-45909,
-46002,
-46351,
-46665,
-46862,
-46598,
-46287,
-46110,
-46553,
-47283,
-48260,
-48744,
-48924,
-48589,
-48282,
-48081,
-48147,
-48503,
-49031,
-49679,
-50160,
-50499,
-50448,
-49966,
-49387,
-48701,
-48149,
-47415,
-46554,
-45312,
-43939,
-42435,
-41234,
-39955,
-38954,
-37782,
-36719,
-35678,
-34989,
-34462,
-34146,
-33820,
-33261,
-32888,
-32731,
-32775,
-33442,
-33771,
-33908,
-33460,
-32535,
-31709,
-31318,
-31444,
-31692,
-31869,
-31245,
-30342,
-29230,
-28568,
-28236,
-28212,
-27838,
-27237,
-26132,
-25200,
-24338,
-24070,
-23985,
-23801,
-23611,
-22827,
-22103,
-21345,
-20859,
-20795,
-20769,
-20995,
-20834,
-20730,
-20657,
-21106,
-22010,
-23473,
-24891,
-26086,
-26731,
-27170,
-27197,
-27413,
-27350,
-27173,
-26817,
-26420,
-26551,
-26973,
-28169,
-29165,
-30252,
-30803,
-31161,
-31224,
-31359,
-31225,
-31071,
-30848,
-30496,
-30516,
-30295,
-30384,
-30250,
-30518,
-30738,
-31357,
-31736,
-32177,
-32090,
-31734,
-31315,
-30670,
-30297,
-29696,
-29011,
-28191,
-27083,
-26286,
-25646,
-25286,
-25249,
-25020,
-24717,
-24223,
-23630,
-23207,
-22853,
-22433,
-21633,
-20662,
-19020,
-17759,
-16563,
-15964,
-15898,
-15877,
-15941,
-15678,
-15276,
-14882,
-14544,
-14262,
-13901,
-13420,
-12908,
-12442,
-12376,
-12355,
-12485,
-12181,
-11796,
-11094,
-10959,
-11024,
-11669,
-12597,
-13394,
-14482,
-15257,
-16095,
-16587,
-16826,
-16607,
-16588,
-16669,
-17541,
-18774,
-20175,
-21168,
-21637,
-21788,
-22012,
-22875,
-24447,
-26199,
-27968,
-28812,
-29299,
-29473,
-30056,
-31177,
-32580,
-33903,
-34770,
-35435,
-36164,
-37406,
-39065,
-41127,
-42920,
-44494,
-45754,
-46776,
-47925,
-49122,
-50319,
-51801,
-52934,
-53971,
-54151,
-54061,
-53464,
-53552,
-54128,
-55346,
-56387,
-56654,
-56519,
-55990,
-56430,
-57075,
-58026,
-58070,
-57407,
-56474,
-56478,
-57250,
-58692,
-59331,
-58848,
-57425,
-55971,
-55076,
-54618,
-54282,
-53397,
-52401,
-51691,
-51514,
-51359,
-50674,
-48700,
-46088,
-43298,
-41301,
-39867,
-38864,
-37672,
-36498,
-35609,
-35082,
-34678,
-33975,
-32840,
-31692,
-30959,
-31158,
-31561,
-31797,
-31319,
-30422,
-29593,
-29049,
-28838,
-28297,
-27531,
-26282,
-25604,
-25219,
-25513,
-25510,
-25113,
-24269,
-23432,
-23138,
-23297,
-23718,
-23824,
-23567,
-23025,
-22791,
-22983,
-23496,
-24293,
-24758,
-25023,
-25225,
-25529,
-26358,
-27278,
-28660,
-29717,
-30761,
-31712,
-32556,
-33727,
-34748,
-35810,
-36895,
-37827,
-39000,
-40151,
-41393,
-42387,
-43189,
-44025,
-44806,
-45598,
-46111,
-46132,
-45888,
-45778,
-45977,
-46730,
-47527,
-47749,
-47506,
-46595,
-46202,
-46106,
-46733,
-47194,
-47373,
-46907,
-46287,
-45822,
-45556,
-45667,
-45513,
-45155,
-44562,
-43849,
-43452,
-43254,
-43205,
-43390,
-43160,
-43100,
-42522,
-42164,
-41818,
-41786,
-41905,
-41700,
-40995,
-39463,
-37784,
-36184,
-35305,
-34722,
-34018,
-32553,
-30429,
-28123,
-26532,
-25754,
-25576,
-25291,
-24403,
-23317,
-22435,
-22163,
-22146,
-22056,
-21125,
-20040,
-18954,
-18601,
-18889,
-19374,
-19576,
-19308,
-18800,
-18424,
-18378,
-18622,
-18602,
-18421,
-17937,
-17537,
-17382,
-17537,
-17582,
-17403,
-16719,
-16073,
-15746,
-16206,
-17140,
-18223,
-19020,
-19399,
-19818,
-20527,
-21747,
-23050,
-24007,
-24467,
-24606,
-24910,
-25890,
-26971,
-28259,
-28898,
-29434,
-29849,
-30587,
-31399,
-32004,
-32198,
-32156,
-31935,
-32110,
-32202,
-32199,
-32089,
-31802,
-31978,
-32333,
-33131,
-33505,
-33776,
-33659,
-33863,
-34103,
-34549,
-34614,
-34328,
-33925,
-33753,
-33970,
-34283,
-34083,
-33307,
-32067,
-31094,
-30626,
-30517,
-30318,
-29496,
-28172,
-26549,
-25380,
-24578,
-24009,
-23358,
-22148,
-20835,
-19353,
-18514,
-18044,
-18226,
-18090,
-18024,
-17206,
-16406,
-15655,
-14946,
-14813,
-14568,
-14461,
-13989,
-13421,
-12640,
-12222,
-11779,
-11644,
-11380,
-11026,
-10647,
-10119,
-9673,
-9407,
-9256,
-9317,
-9300,
-9207,
-9099,
-9231,
-9475,
-10228,
-11113,
-11956,
-12864,
-13261,
-13884,
-14457,
-15190,
-16098,
-16937,
-17650,
-18422,
-18977,
-19863,
-20859,
-22211,
-23717,
-25179,
-26639,
-28082,
-29342,
-30782,
-31981,
-33459,
-34882,
-36453,
-38047,
-39465,
-40839,
-41833,
-42878,
-43828,
-45112,
-46688,
-48300,
-50033,
-51379,
-52756,
-54039,
-55590,
-57118,
-58293,
-59088,
-59423,
-59686,
-60420,
-61303,
-62214,
-62721,
-62522,
-62413,
-62544,
-63054,
-63831,
-64026,
-63722,
-63184,
-62879,
-63230,
-63897,
-64316,
-64162,
-63453,
-62810,
-62523,
-62500,
-62368,
-61725,
-60795,
-59578,
-58667,
-57961,
-57073,
-56299,
-55058,
-54019,
-52996,
-52092,
-50981,
-49700,
-48323,
-47086,
-45976,
-44737,
-43141,
-41349,
-39597,
-38690,
-38204,
-37912,
-37208,
-35875,
-34483,
-33573,
-33440,
-33774,
-33969,
-33600,
-32661,
-31981,
-31513,
-31557,
-31470,
-31048,
-30339,
-29875,
-29675,
-30073,
-30207,
-30207,
-29829,
-29456,
-29316,
-29570,
-29824,
-30146,
-30490,
-31051,
-31755,
-32446,
-32773,
-32801,
-32796,
-32954,
-33596,
-34192,
-34660,
-34769,
-35079,
-35657,
-36827,
-37651,
-37845,
-37276,
-36273,
-36100,
-36385,
-37272,
-37739,
-37514,
-36986,
-36783,
-37163,
-38048,
-38533,
-38381,
-37892,
-37383,
-37560,
-38093,
-38355,
-38228,
-37579,
-37009,
-37094,
-37516,
-37826,
-37759,
-36897,
-36187,
-35477,
-35279,
-35125,
-34746,
-34373,
-33924,
-34019,
-34369,
-34794,
-35100,
-34858,
-34614,
-34083,
-33840,
-33771,
-33708,
-34082,
-34192,
-34750,
-35098,
-35305,
-35320,
-34682,
-33838,
-32800,
-31667,
-30939,
-30116,
-29632,
-28811,
-28103,
-27193,
-26509,
-25908,
-25402,
-24779,
-24049,
-23119,
-22498,
-22146,
-22452,
-23275,
-23916,
-24580,
-24427,
-24314,
-23871,
-24051,
-24468,
-25335,
-25931,
-26420,
-26396,
-26486,
-26507,
-26819,
-27216,
-27327,
-27216,
-26708,
-26152,
-25801,
-25664,
-26154,
-26707,
-27636,
-28237,
-28588,
-28703,
-28388,
-28325,
-28257,
-28522,
-28880,
-29275,
-29388,
-29497,
-29277,
-29429,
-29768,
-30357,
-30986,
-31244,
-31316,
-31070,
-31159,
-31513,
-32068,
-32465,
-32134,
-31403,
-30404,
-30099,
-30182,
-30894,
-31115,
-30981,
-29986,
-29010,
-28391,
-28256,
-28525,
-28588,
-27993,
-27128,
-25886,
-25048,
-24534,
-24383,
-24182,
-23693,
-22966,
-21832,
-21016,
-20261,
-20129,
-19972,
-19687,
-18777,
-17582,
-16252,
-15677,
-15720,
-16320,
-16518,
-15830,
-14395,
-12883,
-12158,
-12594,
-13442,
-14191,
-14105,
-13307,
-12775,
-12374,
-12934,
-13059,
-13087,
-12487,
-11999,
-11868,
-12442,
-12996,
-13440,
-13329,
-12929,
-12776,
-12598,
-13128,
-13641,
-14389,
-15369,
-15964,
-16850,
-16984,
-17116,
-17028,
-17270,
-17849,
-18843,
-19818,
-20685,
-21121,
-21506,
-21654,
-22234,
-22854,
-23714,
-24628,
-25354,
-26154,
-26708,
-27368,
-28195,
-29185,
-30519,
-31822,
-32886,
-33574,
-33928,
-34238,
-34902,
-35789,
-37071,
-38161,
-39263,
-40220,
-41414,
-42787,
-44384,
-45575,
-46556,
-47082,
-47463,
-48124,
-48747,
-49563,
-50343,
-51069,
-51892,
-52445,
-52731,
-52536,
-51931,
-51585,
-51577,
-52071,
-52532,
-52511,
-52047,
-51291,
-51073,
-51202,
-51783,
-51955,
-51561,
-50604,
-49566,
-49078,
-48988,
-49346,
-49276,
-49210,
-48682,
-48520,
-48417,
-48589,
-48391,
-47950,
-47060,
-46378,
-45864,
-46023,
-46242,
-46420,
-46043,
-45246,
-44405,
-43806,
-43673,
-43630,
-43583,
-43188,
-42787,
-42454,
-42458,
-42407,
-42016,
-41412,
-40485,
-40129,
-40107,
-40640,
-40993,
-41125,
-40907,
-40791,
-40821,
-41099,
-41241,
-41300,
-41351,
-41832,
-42503,
-43559,
-44165,
-44467,
-44451,
-44602,
-45115,
-45843,
-46421,
-46353,
-46021,
-45446,
-45135,
-45135,
-45003,
-44759,
-43849,
-42945,
-41988,
-41592,
-41326,
-41192,
-40684,
-39908,
-38955,
-38270,
-38003,
-38268,
-38492,
-38444,
-37895,
-37271,
-36652,
-36763,
-36984,
-37361,
-37295,
-36916,
-36299,
-35810,
-35678,
-35433,
-35258,
-34589,
-33909,
-33106,
-32378,
-31802,
-31025,
-30385,
-29563,
-28746,
-27990,
-27307,
-26683,
-26576,
-26506,
-26841,
-27016,
-27129,
-27105,
-27305,
-27815,
-28633,
-29433,
-29851,
-29720,
-29409,
-28922,
-29254,
-29476,
-30206,
-29986,
-29652,
-28347,
-27481,
-26686,
-26440,
-26420,
-26042,
-25400,
-24626,
-24026,
-24138,
-24448,
-24934,
-24714,
-24161,
-23294,
-22899,
-23095,
-23718,
-24425,
-24891,
-25068,
-25333,
-25866,
-26640,
-27372,
-27991,
-28392,
-29008,
-29765,
-30560,
-31315,
-31669,
-32044,
-32467,
-33305,
-34108,
-34900,
-35126,
-35143,
-34994,
-35165,
-35547,
-36054,
-36472,
-36390,
-36316,
-35990,
-35988,
-36185,
-36300,
-36494,
-36145,
-36031,
-35788,
-36033,
-36363,
-36630,
-36697,
-36296,
-36079,
-35874,
-36012,
-35963,
-35569,
-34923,
-34327,
-34327,
-34458,
-34571,
-33793,
-32490,
-30914,
-30164,
-30116,
-30628,
-30584,
-29939,
-28593,
-27722,
-27153,
-27303,
-26951,
-26088,
-24623,
-23232,
-22496,
-22212,
-22121,
-21636,
-20770,
-19952,
-19375,
-19087,
-18846,
-18177,
-17317,
-16429,
-15876,
-16032,
-16184,
-16454,
-16316,
-15902,
-15650,
-15482,
-15539,
-15547,
-15276,
-14791,
-14348,
-14037,
-14237,
-14703,
-15430,
-16035,
-16537,
-16985,
-17559,
-18378,
-19134,
-19816,
-20375,
-20679,
-21217,
-21721,
-22345,
-22809,
-23185,
-23384,
-23805,
-24272,
-24490,
-24540,
-24156,
-24029,
-24381,
-25178,
-26264,
-26863,
-26949,
-26887,
-26837,
-27639,
-28456,
-29565,
-30206,
-30872,
-31512,
-32556,
-33461,
-34218,
-34522,
-34797,
-35493,
-36482,
-37710,
-38228,
-38267,
-37961,
-37934,
-38471,
-38998,
-39333,
-38955,
-38580,
-38467,
-39157,
-39884,
-40351,
-40197,
-39708,
-39664,
-40286,
-41214,
-41635,
-41372,
-40547,
-40022,
-40173,
-40749,
-41238,
-40948,
-40307,
-39687,
-39376,
-39731,
-39863,
-39643,
-39088,
-38358,
-38224,
-38136,
-38270,
-37758,
-37097,
-36340,
-36166,
-36607,
-37228,
-37738,
-37405,
-36918,
-36053,
-35989,
-36163,
-36987,
-37225,
-37098,
-36295,
-35370,
-35077,
-35148,
-35898,
-36231,
-36387,
-36053,
-35789,
-35788,
-35922,
-36119,
-36166,
-36230,
-36454,
-36850,
-37141,
-37005,
-36587,
-36076,
-36318,
-37076,
-38221,
-38982,
-39173,
-39246,
-39443,
-40394,
-41283,
-41966,
-41526,
-40993,
-40507,
-40992,
-42301,
-43695,
-44604,
-44936,
-44627,
-44845,
-45094,
-45951,
-46556,
-47061,
-47174,
-47150,
-47130,
-47059,
-47045,
-46859,
-46643,
-46443,
-46284,
-46247,
-45907,
-45513,
-44716,
-43980,
-43323,
-42851,
-42456,
-41881,
-41034,
-39957,
-39150,
-38694,
-38843,
-39066,
-38868,
-38312,
-37008,
-36075,
-35412,
-35345,
-35368,
-35168,
-34238,
-33085,
-31891,
-31202,
-31094,
-30959,
-30761,
-29608,
-28236,
-26749,
-25736,
-25330,
-25226,
-25066,
-24692,
-23939,
-23450,
-23185,
-23209,
-23271,
-23211,
-22628,
-22347,
-21853,
-21792,
-21833,
-21902,
-22253,
-22412,
-22828,
-22679,
-22474,
-21969,
-21899,
-22389,
-23339,
-24228,
-24534,
-24230,
-23823,
-23942,
-24844,
-26154,
-27196,
-27546,
-27417,
-27394,
-27813,
-28924,
-29984,
-30848,
-31161,
-31291,
-31491,
-32178,
-32798,
-33706,
-34239,
-34746,
-35235,
-35567,
-35854,
-35966,
-36098,
-36386,
-36919,
-37426,
-37760,
-37648,
-37274,
-36827,
-37009,
-37424,
-38605,
-39417,
-39779,
-39705,
-39048,
-39108,
-39200,
-40152,
-40683,
-41016,
-40684,
-40504,
-40508,
-41169,
-41593,
-41413,
-40419,
-38954,
-37938,
-37648,
-37871,
-38003,
-37383,
-36209,
-34769,
-33818,
-33152,
-32819,
-32268,
-31667,
-30872,
-30362,
-29762,
-29056,
-28412,
-27460,
-27261,
-27127,
-27151,
-26817,
-26132,
-25399,
-24980,
-25023,
-25069,
-24868,
-23916,
-22875,
-22055,
-21969,
-22564,
-22897,
-22876,
-21965,
-20862,
-20260,
-20462,
-21323,
-22323,
-22630,
-22257,
-21456,
-21147,
-21548,
-22673,
-23499,
-23602,
-22901,
-22053,
-21968,
-22875,
-24248,
-25223,
-25203,
-24754,
-24186,
-24533,
-25313,
-26243,
-26905,
-27482,
-28059,
-29209,
-29787,
-30272,
-29632,
-29362,
-29569,
-30688,
-32096,
-32681,
-32405,
-31686,
-31428,
-32442,
-33773,
-34792,
-34769,
-33906,
-33506,
-33662,
-34837,
-35920,
-36365,
-36097,
-35612,
-35433,
-35657,
-36052,
-36144,
-36097,
-36055,
-36165,
-36141,
-35812,
-35013,
-34480,
-34352,
-35008,
-35549,
-35630,
-34794,
-33904,
-33354,
-33702,
-34419,
-34723,
-34349,
-33684,
-33330,
-33793,
-34707,
-35053,
-34883,
-34169,
-33841,
-34215,
-34924,
-35325,
-35032,
-34440,
-34104,
-34325,
-34661,
-34479,
-33620,
-32642,
-32333,
-32886,
-33663,
-33683,
-32667,
-31334,
-30674,
-31157,
-32246,
-32975,
-32353,
-31539,
-30557,
-31031,
-31731,
-32290,
-32134,
-31335,
-31050,
-31490,
-32378,
-32908,
-32422,
-31669,
-31024,
-31783,
-32926,
-34243,
-34388,
-34220,
-33836,
-34217,
-35279,
-36119,
-36786,
-36785,
-36917,
-37252,
-37957,
-38291,
-38447,
-38335,
-38645,
-39378,
-40194,
-40485,
-40131,
-39528,
-39358,
-40104,
-41085,
-41745,
-41547,
-40662,
-40017,
-39756,
-40282,
-40596,
-40660,
-40086,
-39553,
-39532,
-39908,
-40440,
-40704,
-40441,
-39884,
-39357,
-38953,
-38759,
-38554,
-38405,
-38376,
-38184,
-38023,
-37296,
-36408,
-35610,
-35125,
-35079,
-35124,
-34835,
-34040,
-32928,
-32071,
-31333,
-31249,
-30849,
-30228,
-29100,
-27814,
-26685,
-25953,
-25380,
-24844,
-24251,
-23382,
-22854,
-22299,
-22100,
-21878,
-21171,
-20458,
-19201,
-18665,
-18402,
-18777,
-19309,
-19354,
-19175,
-18779,
-18821,
-19331,
-20174,
-20703,
-21082,
-21236,
-21767,
-22610,
-23496,
-24025,
-24051,
-24269,
-24737,
-26130,
-27283,
-27970,
-27703,
-26863,
-26440,
-26618,
-27396,
-28210,
-28504,
-28521,
-28723,
-29300,
-30425,
-31230,
-31598,
-31449,
-31402,
-32067,
-33419,
-35057,
-36409,
-37137,
-37497,
-37822,
-38695,
-39903,
-41152,
-42165,
-42500,
-42788,
-42942,
-43608,
-44359,
-44914,
-45025,
-44515,
-44228,
-44203,
-44672,
-45377,
-45448,
-45156,
-44271,
-43564,
-43117,
-42968,
-42808,
-42278,
-41791,
-41147,
-41173,
-40926,
-41016,
-40593,
-40575,
-40747,
-41462,
-42098,
-42235,
-41524,
-40507,
-39597,
-39467,
-39750,
-40043,
-39907,
-39112,
-38246,
-37361,
-36740,
-36144,
-35543,
-34528,
-33815,
-32909,
-32466,
-31735,
-31026,
-30163,
-29364,
-28811,
-28214,
-27747,
-27018,
-26640,
-26198,
-26108,
-25932,
-25534,
-25111,
-24737,
-25023,
-25710,
-26574,
-27018,
-26927,
-26554,
-26240,
-26420,
-26773,
-27150,
-27350,
-27437,
-27792,
-28281,
-28787,
-28925,
-28608,
-28193,
-28257,
-28812,
-29785,
-30628,
-30914,
-31050,
-31025,
-31692,
-32574,
-33555,
-34100,
-34088,
-34056,
-34042,
-34456,
-35060,
-35476,
-35502,
-35189,
-34925,
-34991,
-35567,
-36164,
-36763,
-36586,
-36186,
-35790,
-35566,
-36053,
-36321,
-36606,
-36411,
-36273,
-36366,
-36606,
-36964,
-36739,
-36433,
-36117,
-36478,
-37204,
-37915,
-37627,
-36674,
-35322,
-34904,
-35188,
-36056,
-36207,
-35413,
-34038,
-32908,
-32778,
-33415,
-34042,
-34146,
-33621,
-33037,
-32914,
-32949,
-33134,
-32684,
-32158,
-31666,
-31561,
-31732,
-31649,
-31333,
-31028,
-31092,
-31602,
-31935,
-31644,
-30807,
-29873,
-29742,
-30318,
-30979,
-30874,
-29806,
-28326,
-27680,
-27993,
-28963,
-29613,
-28940,
-27951,
-26882,
-27172,
-27993,
-29209,
-29432,
-28788,
-27837,
-27084,
-27083,
-27593,
-27793,
-27945,
-27575,
-27433,
-27332,
-27810,
-28107,
-28629,
-29126,
-29361,
-30032,
-30384,
-30935,
-31295,
-31665,
-32048,
-32597,
-33176,
-33837,
-34307,
-34611,
-34884,
-35231,
-35680,
-36362,
-36654,
-36983,
-36962,
-37451,
-38111,
-39270,
-39970,
-40177,
-39796,
-39133,
-39333,
-39773,
-40952,
-41523,
-41459,
-40729,
-39994,
-39711,
-40283,
-41126,
-41705,
-41897,
-41552,
-41099,
-41131,
-41168,
-41481,
-40994,
-40195,
-38956,
-38115,
-37868,
-37940,
-37867,
-36965,
-35631,
-34061,
-33552,
-33506,
-34084,
-33993,
-33042,
-31779,
-30539,
-30296,
-30404,
-30497,
-29783,
-28703,
-27503,
-26951,
-26906,
-26996,
-26594,
-26068,
-25086,
-24851,
-24400,
-24383,
-23761,
-23317,
-22722,
-22496,
-22414,
-22051,
-21595,
-20877,
-20553,
-20282,
-20151,
-19509,
-18687,
-17960,
-18001,
-18667,
-19908,
-20414,
-20598,
-20101,
-20045,
-20413,
-21438,
-22254,
-22941,
-23274,
-23849,
-24649,
-25532,
-26043,
-25931,
-25666,
-25621,
-26200,
-26992,
-27441,
-27324,
-26798,
-26484,
-26819,
-27725,
-28612,
-29232,
-29276,
-29411,
-29717,
-30319,
-31025,
-31514,
-32045,
-32732,
-33817,
-35233,
-36632,
-37646,
-38316,
-38623,
-39131,
-39644,
-40327,
-40730,
-40835,
-40798,
-40414,
-40375,
-40174,
-40127,
-40200,
-40125,
-40200,
-40038,
-39732,
-39266,
-38821,
-38205,
-37890,
-37452,
-37292,
-37340,
-37781,
-38513,
-39111,
-39309,
-38846,
-38046,
-37539,
-37583,
-38422,
-39246,
-39596,
-39244,
-38225,
-37450,
-37027,
-37119,
-37470,
-37162,
-36697,
-35566,
-34991,
-34748,
-34902,
-35123,
-35102,
-34593,
-34081,
-33665,
-33636,
-34019,
-34302,
-34395,
-34103,
-33353,
-32842,
-32310,
-32290,
-32265,
-32444,
-32201,
-31955,
-31559,
-31158,
-30938,
-30627,
-30518,
-30249,
-30031,
-29630,
-29232,
-28922,
-28878,
-28988,
-29232,
-29520,
-29630,
-29721,
-30050,
-30319,
-30980,
-31249,
-31469,
-31402,
-31735,
-32313,
-33348,
-34154,
-34432,
-34242,
-33682,
-33486,
-33550,
-33839,
-33885,
-33660,
-33399,
-33437,
-33775,
-34104,
-34016,
-33509,
-33016,
-33067,
-33705,
-34436,
-34816,
-34368,
-34107,
-34104,
-35278,
-36499,
-37402,
-37431,
-36715,
-36411,
-36628,
-37252,
-37625,
-37230,
-36495,
-36011,
-36230,
-36720,
-36961,
-36431,
-35412,
-34502,
-34196,
-34191,
-34328,
-33927,
-33573,
-33242,
-33661,
-34084,
-34236,
-33687,
-32728,
-32225,
-32221,
-32997,
-33486,
-33683,
-33331,
-32929,
-32911,
-33106,
-33309,
-33263,
-32754,
-32398,
-32247,
-32685,
-33220,
-33440,
-33375,
-32686,
-32024,
-31445,
-31206,
-31090,
-31272,
-30980,
-30917,
-30537,
-30540,
-30670,
-30963,
-31311,
-31582,
-31932,
-32334,
-32710,
-32930,
-32887,
-32821,
-32863,
-33376,
-34191,
-34927,
-35298,
-35171,
-34967,
-35080,
-35368,
-36053,
-36055,
-35987,
-35700,
-35766,
-36453,
-36895,
-37230,
-36648,
-36169,
-35764,
-36076,
-36477,
-36671,
-36322,
-36032,
-36119,
-36854,
-37447,
-37450,
-36543,
-35586,
-35282,
-35919,
-36852,
-37272,
-36608,
-35745,
-35321,
-35924,
-36870,
-37077,
-36273,
-34970,
-34127,
-34502,
-35370,
-35807,
-35194,
-33748,
-32711,
-32420,
-32954,
-32953,
-32421,
-31027,
-29984,
-29942,
-30449,
-31293,
-31113,
-30586,
-29561,
-29256,
-29009,
-29013,
-28520,
-28041,
-27543,
-27663,
-27813,
-27969,
-27550,
-27194,
-26751,
-27018,
-27171,
-27106,
-26596,
-25733,
-25511,
-25621,
-26375,
-26863,
-26639,
-26065,
-25090,
-24780,
-24914,
-25354,
-25778,
-25576,
-25402,
-24934,
-25024,
-25179,
-25443,
-25447,
-25265,
-24826,
-24890,
-25178,
-26111,
-26549,
-26910,
-26437,
-26112,
-25953,
-26374,
-27041,
-27591,
-27727,
-27814,
-27859,
-28169,
-28544,
-28459,
-28233,
-27817,
-28056,
-28658,
-29694,
-29989,
-29827,
-28814,
-28233,
-28082,
-28609,
-29391,
-29671,
-29679,
-29516,
-29790,
-30600,
-31873,
-32817,
-33464,
-33374,
-33328,
-33375,
-34017,
-34636,
-35057,
-34991,
-34459,
-34193,
-34395,
-35121,
-35701,
-35877,
-35189,
-34505,
-33860,
-34061,
-34283,
-34435,
-33842,
-33238,
-32823,
-33195,
-33706,
-33996,
-33549,
-33110,
-32664,
-33196,
-33731,
-34191,
-33951,
-33728,
-33794,
-34661,
-35564,
-36145,
-35764,
-35236,
-34923,
-35435,
-36253,
-36674,
-36408,
-35878,
-35742,
-36544,
-37580,
-38270,
-38003,
-37095,
-36365,
-36319,
-37117,
-37650,
-37823,
-37278,
-36756,
-36681,
-37155,
-37720,
-38068,
-37870,
-37717,
-37535,
-38007,
-38177,
-38272,
-37646,
-36854,
-36119,
-36076,
-36277,
-36805,
-36809,
-36297,
-35632,
-35192,
-35411,
-36098,
-36499,
-36338,
-35570,
-34856,
-34926,
-35566,
-36298,
-36165,
-35233,
-33952,
-33438,
-33885,
-34881,
-35277,
-34771,
-33438,
-32756,
-32619,
-33510,
-33969,
-33708,
-32487,
-31292,
-30561,
-30872,
-31225,
-31359,
-30804,
-30050,
-29522,
-29652,
-30185,
-30716,
-31003,
-30983,
-30670,
-30850,
-30871,
-31469,
-31602,
-31845,
-31602,
-31138,
-30693,
-30340,
-30294,
-30651,
-31025,
-31537,
-31756,
-31802,
-31690,
-31558,
-31491,
-31580,
-31758,
-31933,
-32024,
-31933,
-31692,
-31711,
-31693,
-31955,
-32001,
-31978,
-31890,
-31846,
-32333,
-32953,
-33639,
-33928,
-33707,
-33483,
-33531,
-34148,
-35123,
-35857,
-36250,
-36168,
-35942,
-36252,
-36544,
-37247,
-37519,
-37713,
-37937,
-38403,
-39043,
-39666,
-39928,
-39821,
-39509,
-39310,
-39398,
-39731,
-40129,
-40374,
-40396,
-40327,
-40043,
-39995,
-39908,
-40154,
-40326,
-40532,
-40502,
-40355,
-40147,
-40268,
-40545,
-40886,
-40948,
-40328,
-39666,
-38954,
-38979,
-39553,
-40063,
-40307,
-39554,
-38512,
-37539,
-37270,
-37519,
-37978,
-38029,
-37579,
-36742,
-36120,
-35788,
-35745,
-36009,
-35856,
-35874,
-35370,
-34789,
-34218,
-33528,
-33352,
-33197,
-33351,
-33020,
-32511,
-31468,
-30850,
-30471,
-30496,
-30515,
-29722,
-28808,
-27728,
-27548,
-28124,
-28856,
-29166,
-28433,
-27307,
-26463,
-26484,
-27263,
-28033,
-28238,
-27659,
-26794,
-26377,
-26461,
-27085,
-27527,
-27679,
-27242,
-26837,
-26465,
-26419,
-26484,
-26488,
-26328,
-26133,
-26085,
-26200,
-26461,
-26731,
-26816,
-26776,
-26704,
-26798,
-26904,
-27218,
-27217,
-27038,
-26773,
-26443,
-26571,
-26800,
-27234,
-27596,
-27835,
-27793,
-27859,
-27814,
-27925,
-28214,
-28544,
-29123,
-29452,
-29433,
-28920,
-28370,
-28057,
-28701,
-29564,
-30450,
-30362,
-29565,
-28521,
-28105,
-28565,
-29456,
-30006,
-29963,
-29298,
-29188,
-29277,
-29940,
-30008,
-29608,
-29010,
-28857,
-29451,
-30076,
-30250,
-29321,
-28058,
-27193,
-27374,
-28366,
-29101,
-29274,
-28437,
-27724,
-27307,
-27658,
-27991,
-28149,
-27656,
-27331,
-27102,
-27374,
-27680,
-27660,
-27394,
-26928,
-26707,
-26574,
-26685,
-26685,
-26729,
-26928,
-27240,
-27702,
-27971,
-28079,
-28058,
-28060,
-28322,
-28724,
-29053,
-29278,
-28987,
-28769,
-28676,
-29056,
-29918,
-30760,
-31293,
-31335,
-31160,
-31159,
-31711,
-32579,
-33216,
-33222,
-32596,
-32092,
-31976,
-33066,
-34148,
-35058,
-35056,
-34506,
-34124,
-34485,
-35409,
-36432,
-36894,
-36654,
-36119,
-35878,
-36098,
-36894,
-37518,
-38047,
-38157,
-38249,
-38355,
-38558,
-38801,
-38645,
-38646,
-38091,
-37959,
-37671,
-37694,
-37780,
-38005,
-38111,
-38362,
-38309,
-38272,
-38023,
-37872,
-37604,
-37604,
-37760,
-37849,
-37869,
-37406,
-36873,
-36408,
-36521,
-36717,
-37207,
-36916,
-36300,
-35520,
-35038,
-35010,
-35126,
-34835,
-34193,
-33508,
-33019,
-33152,
-33198,
-33039,
-32204,
-31576,
-31206,
-31756,
-32421,
-32446,
-31776,
-30364,
-29452,
-29411,
-29984,
-30627,
-30606,
-29896,
-29233,
-29032,
-29453,
-30230,
-30647,
-30676,
-30358,
-30253,
-30317,
-30670,
-30918,
-31378,
-31627,
-32108,
-32248,
-32351,
-31739,
-31466,
-31028,
-31312,
-31804,
-32264,
-32667,
-32553,
-32555,
-32754,
-33175,
-33926,
-34527,
-34879,
-35103,
-35257,
-35587,
-36210,
-36697,
-37116,
-37140,
-37007,
-37116,
-37429,
-38068,
-38780,
-38997,
-39005,
-38705,
-38830,
-39216,
-40044,
-40816,
-41125,
-41038,
-40684,
-40173,
-40131,
-40128,
-40684,
-41192,
-42013,
-42455,
-42611,
-42321,
-41925,
-41833,
-42325,
-42962,
-43455,
-43050,
-42059,
-40925,
-40419,
-40793,
-41260,
-41501,
-40686,
-39573,
-38626,
-38444,
-38846,
-39243,
-39090,
-38377,
-37541,
-37114,
-37121,
-37513,
-37518,
-37447,
-36765,
-36297,
-35721,
-35347,
-35033,
-34794,
-34745,
-34860,
-34989,
-34814,
-34483,
-33749,
-33198,
-32665,
-32708,
-32667,
-32687,
-32088,
-31360,
-30627,
-30427,
-30740,
-31179,
-31249,
-30517,
-29475,
-28678,
-28856,
-29741,
-30673,
-30759,
-29720,
-28368,
-27481,
-27662,
-28388,
-28946,
-28699,
-27970,
-27416,
-27526,
-28347,
-28988,
-29010,
-28591,
-27835,
-27816,
-27946,
-28480,
-28655,
-28790,
-28987,
-29500,
-30005,
-30452,
-30338,
-30074,
-29942,
-30072,
-30430,
-30603,
-30386,
-30205,
-30097,
-30671,
-31137,
-31601,
-31338,
-30693,
-30163,
-29873,
-30364,
-30822,
-31475,
-31863,
-32137,
-32398,
-32443,
-32356,
-31956,
-31580,
-31469,
-31624,
-32001,
-32311,
-32288,
-32201,
-32088,
-32312,
-32597,
-32978,
-32795,
-32623,
-32066,
-31780,
-31579,
-31626,
-31444,
-31472,
-31135,
-31381,
-31359,
-31713,
-31623,
-31271,
-30692,
-30076,
-29851,
-30163,
-30494,
-30694,
-30273,
-29542,
-29100,
-29209,
-29919,
-30406,
-30139,
-29189,
-28014,
-27526,
-27837,
-28567,
-28966,
-28458,
-27459,
-26818,
-26774,
-27548,
-28058,
-27970,
-27393,
-26796,
-26906,
-27661,
-28764,
-29435,
-29538,
-29280,
-29008,
-29167,
-29586,
-29918,
-30031,
-29850,
-29566,
-29674,
-29875,
-30472,
-30827,
-31114,
-31071,
-31314,
-31492,
-32065,
-32291,
-32243,
-31934,
-31781,
-31976,
-32690,
-33416,
-33663,
-33595,
-33219,
-33242,
-33704,
-34195,
-34438,
-34279,
-34087,
-34433,
-35459,
-36739,
-37495,
-37204,
-36212,
-34922,
-34637,
-34904,
-35851,
-36456,
-36451,
-35855,
-35103,
-34413,
-34239,
-34326,
-34547,
-34904,
-34878,
-34639,
-33882,
-33241,
-32710,
-32841,
-33043,
-33219,
-32642,
-31758,
-30715,
-30274,
-30472,
-30561,
-30495,
-29408,
-28415,
-27745,
-28083,
-28721,
-29276,
-28857,
-27813,
-26487,
-25930,
-25756,
-26351,
-26621,
-26859,
-26644,
-26460,
-25978,
-25555,
-24912,
-24604,
-24402,
-24959,
-25310,
-25734,
-25641,
-25491,
-25466,
-25688,
-26043,
-26240,
-26244,
-26263,
-26619,
-27438,
-28367,
-29166,
-29189,
-28876,
-28237,
-28146,
-28389,
-28969,
-29650,
-29877,
-30271,
-30274,
-30738,
-31182,
-31999,
-32844,
-33595,
-34059,
-34242,
-33989,
-33776,
-33816,
-34215,
-35214,
-35965,
-36585,
-36430,
-36100,
-35742,
-35923,
-36541,
-37470,
-38271,
-38533,
-38448,
-38201,
-38204,
-38666,
-39311,
-39820,
-40062,
-39865,
-39774,
-39864,
-40329,
-41016,
-41324,
-41395,
-41144,
-40821,
-41233,
-41661,
-42651,
-43168,
-43095,
-42633,
-41770,
-41212,
-41151,
-41236,
-41546,
-41284,
-40747,
-39799,
-39065,
-38469,
-38358,
-38291,
-38091,
-37739,
-37049,
-36587,
-36341,
-36498,
-36629,
-36653,
-36230,
-35701,
-35432,
-35525,
-36073,
-36168,
-35941,
-34947,
-33996,
-33393,
-33399,
-33882,
-33971,
-33687,
-32884,
-32158,
-31843,
-32114,
-32331,
-32446,
-31732,
-30962,
-29961,
-29566,
-29253,
-29409,
-29145,
-28986,
-28481,
-28300,
-28192,
-28523,
-28722,
-29056,
-28898,
-28791,
-28477,
-28436,
-28589,
-29033,
-29541,
-29898,
-30206,
-30007,
-29898,
-29318,
-29123,
-28922,
-29165,
-29721,
-30137,
-30476,
-30580,
-30475,
-30781,
-30938,
-31469,
-31713,
-31823,
-31779,
-31781,
-32108,
-32515,
-32948,
-33178,
-33350,
-33441,
-33751,
-33949,
-34282,
-34149,
-34084,
-33772,
-33772,
-34039,
-34459,
-34992,
-35344,
-35456,
-35590,
-35388,
-35480,
-35388,
-35634,
-35766,
-36032,
-36119,
-36145,
-35852,
-35637,
-35186,
-35127,
-34966,
-35236,
-35301,
-35566,
-35456,
-35346,
-35034,
-34527,
-34347,
-34195,
-34458,
-34704,
-34791,
-34681,
-34260,
-34083,
-33971,
-34195,
-34104,
-33773,
-32953,
-32576,
-32489,
-33108,
-33639,
-33862,
-33417,
-32600,
-32111,
-32001,
-32399,
-32554,
-32290,
-31822,
-31272,
-31444,
-31538,
-31733,
-31471,
-30914,
-30716,
-30827,
-31669,
-32398,
-32955,
-32951,
-32866,
-32864,
-33197,
-33595,
-34172,
-34526,
-34835,
-35346,
-35565,
-35968,
-35786,
-35326,
-34987,
-34640,
-34789,
-35214,
-35611,
-36009,
-35810,
-35590,
-35122,
-34927,
-35034,
-35101,
-35412,
-35434,
-35522,
-35634,
-35833,
-36097,
-36166,
-36230,
-36121,
-36055,
-36186,
-36099,
-36075,
-35767,
-35523,
-35565,
-35591,
-35786,
-35437,
-35075,
-34597,
-34432,
-34752,
-35010,
-35015,
-34590,
-34040,
-33662,
-33882,
-34041,
-34169,
-33840,
-33308,
-33306,
-33287,
-33794,
-33706,
-33287,
-32684,
-32182,
-32063,
-31960,
-31400,
-30519,
-29628,
-29457,
-29981,
-30719,
-30981,
-30250,
-29079,
-28167,
-27992,
-28547,
-29008,
-28969,
-28211,
-27394,
-27018,
-27260,
-27904,
-28167,
-27772,
-27038,
-26243,
-26152,
-26730,
-27703,
-28391,
-28346,
-27548,
-26575,
-25953,
-26021,
-26574,
-27150,
-27548,
-27727,
-27880,
-28080,
-28369,
-28389,
-28370,
-28411,
-28767,
-29654,
-30382,
-30806,
-31047,
-31005,
-31979,
-32974,
-34062,
-34214,
-33508,
-32753,
-32821,
-33595,
-34660,
-35032,
-34219,
-33150,
-32644,
-33199,
-34543,
-35329,
-35052,
-34042,
-33283,
-33465,
-34523,
-35592,
-35852,
-35545,
-34926,
-34944,
-35481,
-36029,
-36211,
-35765,
-35258,
-34945,
-35125,
-35388,
-35413,
-35301,
-34901,
-34948,
-35167,
-35523,
-35854,
-35568,
-35211,
-34571,
-34104,
-33729,
-33263,
-32777,
-31999,
-31581,
-31424,
-31824,
-32422,
-32510,
-32200,
-31136,
-30518,
-30294,
-30850,
-31491,
-31335,
-30896,
-29871,
-29656,
-29982,
-30630,
-31003,
-30406,
-29653,
-28722,
-28856,
-29210,
-29697,
-29563,
-29012,
-28478,
-28435,
-28967,
-29540,
-29811,
-29295,
-28703,
-28013,
-28324,
-28457,
-29098,
-28879,
-28523,
-28058,
-28191,
-28855,
-29741,
-30097,
-29608,
-28545,
-27904,
-27813,
-28790,
-29430,
-29278,
-28411,
-27329,
-27325,
-28259,
-29674,
-30273,
-29676,
-28523,
-27836,
-28501,
-29720,
-30914,
-30918,
-30558,
-30097,
-30805,
-31978,
-33064,
-33286,
-32641,
-32114,
-31932,
-32468,
-32885,
-33043,
-32930,
-32976,
-33418,
-33949,
-34128,
-33506,
-32799,
-32155,
-32577,
-33019,
-33595,
-33309,
-32686,
-32334,
-32443,
-33196,
-33797,
-33837,
-33354,
-32863,
-32621,
-33043,
-33594,
-33951,
-33950,
-33815,
-33710,
-34057,
-34440,
-34855,
-34816,
-34546,
-34129,
-33727,
-33551,
-33553,
-33260,
-33377,
-32929,
-33198,
-33064,
-33328,
-33199,
-32752,
-32400,
-32068,
-32486,
-33000,
-33526,
-33620,
-33173,
-32688,
-32665,
-32931,
-33639,
-33863,
-33550,
-32975,
-32422,
-32443,
-32688,
-32999,
-32927,
-32603,
-32440,
-32513,
-32951,
-33509,
-33747,
-33777,
-33614,
-33619,
-33597,
-33791,
-34087,
-34345,
-35059,
-35546,
-35940,
-35747,
-35211,
-34591,
-34618,
-35253,
-36233,
-37117,
-37249,
-36942,
-36540,
-36365,
-36718,
-37006,
-37140,
-36585,
-35944,
-35323,
-35389,
-35789,
-36474,
-36520,
-36252,
-35613,
-35100,
-35346,
-35877,
-36740,
-36985,
-36741,
-35919,
-35171,
-35121,
-35503,
-36251,
-36521,
-36163,
-35258,
-34437,
-34215,
-34858,
-36011,
-37070,
-37520,
-37091,
-36434,
-35808,
-35923,
-36407,
-37030,
-37204,
-36722,
-36094,
-35549,
-36006,
-36943,
-38090,
-38558,
-38202,
-36941,
-35853,
-35148,
-35609,
-36433,
-37292,
-37429,
-36562,
-35547,
-34589,
-34574,
-35319,
-36301,
-36871,
-36743,
-35897,
-34948,
-34526,
-34723,
-35326,
-35829,
-35769,
-35013,
-34302,
-33621,
-33857,
-34596,
-35520,
-36145,
-36162,
-35924,
-35475,
-35503,
-35676,
-36011,
-35964,
-35324,
-34281,
-33265,
-32774,
-32933,
-33748,
-34351,
-34546,
-33819,
-32862,
-32003,
-31977,
-32534,
-33571,
-34174,
-34368,
-33953,
-33681,
-33553,
-33971,
-34393,
-34859,
-35056,
-35036,
-35057,
-34813,
-34593,
-34194,
-34169,
-34286,
-34720,
-34841,
-34633,
-33951,
-33375,
-33305,
-33797,
-34481,
-34569,
-33951,
-32930,
-32179,
-32088,
-32489,
-32819,
-32511,
-31846,
-30892,
-30674,
-30824,
-31361,
-31754,
-31760,
-31667,
-31270,
-31160,
-30936,
-30872,
-30915,
-31049,
-31291,
-31226,
-30849,
-30074,
-29476,
-29231,
-29587,
-30029,
-30163,
-29940,
-29189,
-28854,
-28812,
-29475,
-29830,
-29942,
-29142,
-27970,
-26973,
-26485,
-26752,
-27482,
-28036,
-28346,
-27970,
-27570,
-26951,
-26841,
-26771,
-27042,
-27148,
-27084,
-26995,
-26884,
-26928,
-27062,
-27261,
-27082,
-27020,
-26437,
-26179,
-26151,
-26221,
-26795,
-26929,
-27172,
-26862,
-26619,
-26130,
-26131,
-26155,
-26550,
-26819,
-26862,
-26728,
-26353,
-26043,
-26041,
-26134,
-26505,
-26730,
-26751,
-26529,
-26089,
-25553,
-25291,
-25222,
-25378,
-25733,
-25975,
-26309,
-26353,
-26507,
-26485,
-26686,
-26772,
-27085,
-27237,
-27573,
-27701,
-27928,
-28188,
-28570,
-28987,
-29299,
-29210,
-28877,
-28524,
-28456,
-29144,
-29985,
-30982,
-31270,
-30914,
-30431,
-29981,
-30278,
-30733,
-31230,
-31310,
-31095,
-30871,
-31114,
-31447,
-31956,
-32178,
-32068,
-32111,
-32244,
-32621,
-33108,
-33131,
-33041,
-32709,
-32490,
-32728,
-33179,
-33791,
-34218,
-34391,
-34350,
-34126,
-34217,
-34302,
-34551,
-34766,
-34773,
-34788,
-34771,
-34859,
-35299,
-35680,
-36095,
-36256,
-36031,
-35832,
-35413,
-35366,
-35214,
-35300,
-35101,
-34947,
-34638,
-34390,
-34462,
-34568,
-35013,
-35126,
-34943,
-34530,
-33680,
-33310,
-33130,
-33550,
-34085,
-34281,
-34171,
-33618,
-33242,
-33150,
-33355,
-33814,
-33907,
-33729,
-33239,
-32689,
-32398,
-32556,
-32775,
-33220,
-33128,
-32933,
-32532,
-32244,
-32268,
-32485,
-32867,
-32930,
-32997,
-32755,
-32818,
-33022,
-33527,
-33885,
-34502,
-34549,
-34769,
-34592,
-34615,
-34569,
-34904,
-35211,
-35723,
-35964,
-35944,
-35744,
-35545,
-35699,
-36055,
-36761,
-37207,
-37406,
-37271,
-36785,
-36608,
-36763,
-37272,
-38116,
-38575,
-38805,
-38531,
-38117,
-37891,
-38069,
-38559,
-39086,
-39623,
-39816,
-40066,
-40171,
-40199,
-40062,
-39819,
-39443,
-39332,
-39221,
-39179,
-38975,
-38516,
-38044,
-37628,
-37560,
-37472,
-37361,
-36851,
-36541,
-36121,
-36364,
-36386,
-36475,
-36232,
-35876,
-35745,
-35742,
-35879,
-35588,
-35145,
-34639,
-34367,
-34574,
-34789,
-34770,
-34548,
-33950,
-33949,
-34150,
-34836,
-35012,
-34815,
-34192,
-33420,
-33350,
-33508,
-34017,
-34390,
-34264,
-34123,
-33643,
-33373,
-32930,
-32688,
-32577,
-32797,
-33177,
-33482,
-33508,
-33152,
-32843,
-32842,
-33264,
-33970,
-34505,
-34879,
-34771,
-35012,
-35213,
-35942,
-36455,
-36760,
-36345,
-36007,
-35592,
-35984,
-36877,
-37868,
-38647,
-38622,
-38248,
-37868,
-37807,
-38333,
-38691,
-38734,
-38246,
-37539,
-37272,
-37582,
-38202,
-38536,
-38290,
-37562,
-36982,
-36986,
-37536,
-38227,
-38621,
-38492,
-38269,
-38003,
-38113,
-38270,
-38267,
-38029,
-37424,
-37075,
-36695,
-36741,
-36763,
-36763,
-36806,
-36499,
-36252,
-35854,
-35391,
-34945,
-34394,
-33862,
-33482,
-32956,
-32818,
-32600,
-32643,
-32510,
-32399,
-31802,
-31268,
-30408,
-29807,
-29432,
-29253,
-29321,
-29276,
-29145,
-28942,
-28525,
-28256,
-27949,
-27835,
-27705,
-27503,
-27241,
-26638,
-26221,
-25643,
-25512,
-25510,
-25733,
-25754,
-25621,
-25203,
-24844,
-24693,
-24691,
-24691,
-24625,
-24094,
-23761,
-23495,
-23607,
-24092,
-24294,
-24491,
-24250,
-24069,
-24008,
-23978,
-24231,
-24355,
-24783,
-25221,
-25845,
-26195,
-26156,
-25752,
-25358,
-25354,
-25934,
-26637,
-27176,
-27258,
-26997,
-26927,
-27083,
-27683,
-28123,
-28171,
-27923,
-27617,
-27658,
-28502,
-29275,
-30098,
-29827,
-29236,
-28120,
-27708,
-27945,
-29011,
-30295,
-31115,
-31490,
-31117,
-31068,
-31050,
-31601,
-32246,
-32618,
-32624,
-32286,
-32269,
-32354,
-33086,
-33441,
-33638,
-33089,
-32463,
-31847,
-31978,
-32488,
-32886,
-33021,
-32419,
-31937,
-31555,
-31804,
-31976,
-31914,
-31246,
-30451,
-29919,
-30006,
-30519,
-30801,
-30631,
-29916,
-29212,
-29009,
-29388,
-30072,
-30386,
-30006,
-29055,
-27970,
-27459,
-27639,
-28234,
-28790,
-28921,
-28657,
-28434,
-28591,
-29141,
-29788,
-29984,
-29586,
-28879,
-28389,
-28435,
-29099,
-29587,
-29984,
-29478,
-28986,
-28502,
-28501,
-28921,
-29456,
-29783,
-29854,
-29674,
-29719,
-29787,
-30139,
-30340,
-30384,
-30316,
-30475,
-30780,
-31448,
-32046,
-32220,
-32313,
-32132,
-32356,
-33153,
-34103,
-35081,
-35478,
-35344,
-34861,
-34499,
-34485,
-34902,
-35300,
-35745,
-35765,
-35877,
-36033,
-36363,
-36808,
-37183,
-37051,
-36807,
-36209,
-35988,
-36030,
-36434,
-36959,
-37230,
-37161,
-36829,
-36452,
-36234,
-36382,
-36613,
-36958,
-37207,
-37208,
-37201,
-37034,
-37002,
-37075,
-37207,
-37358,
-37407,
-37183,
-36985,
-36364,
-36142,
-35922,
-36230,
-36632,
-37049,
-36896,
-36542,
-35610,
-35258,
-34990,
-35589,
-36055,
-36451,
-36144,
-35677,
-35147,
-34989,
-35148,
-35432,
-35413,
-35278,
-34947,
-34747,
-34770,
-34945,
-35148,
-35343,
-35348,
-35475,
-35480,
-35522,
-35722,
-36077,
-36629,
-37206,
-37316,
-37140,
-36741,
-36475,
-36939,
-37739,
-38222,
-38338,
-37271,
-36498,
-36008,
-36433,
-37447,
-37894,
-38092,
-37581,
-37362,
-37472,
-37890,
-37895,
-37648,
-36939,
-36809,
-36894,
-37317,
-37361,
-37029,
-36540,
-36633,
-37157,
-38007,
-38001,
-37318,
-36164,
-35478,
-35611,
-36321,
-36650,
-36212,
-35319,
-34464,
-34411,
-34662,
-34899,
-34330,
-33415,
-32513,
-32441,
-33132,
-34016,
-34702,
-34594,
-34190,
-33534,
-33192,
-32824,
-32573,
-32093,
-31821,
-31515,
-31469,
-31334,
-31340,
-31177,
-31185,
-31068,
-30894,
-30317,
-29786,
-29010,
-28901,
-29142,
-29499,
-29896,
-29475,
-28879,
-27968,
-27262,
-27172,
-27304,
-27749,
-28035,
-28259,
-28278,
-28458,
-28522,
-28857,
-29076,
-29499,
-29673,
-29788,
-29585,
-29188,
-28790,
-28434,
-28501,
-28723,
-29253,
-29476,
-29744,
-29737,
-29613,
-29670,
-29636,
-29959,
-30232,
-30447,
-30585,
-30693,
-30850,
-31380,
-32001,
-32798,
-33063,
-32821,
-32178,
-31469,
-31624,
-32290,
-33614,
-34397,
-34323,
-33443,
-32531,
-32245,
-33151,
-34350,
-35434,
-35366,
-34550,
-33394,
-32999,
-33173,
-34150,
-34835,
-35104,
-34833,
-34418,
-34123,
-34218,
-34437,
-34592,
-34570,
-34283,
-34213,
-34064,
-34323,
-34417,
-34415,
-34081,
-33399,
-32729,
-32313,
-32155,
-32442,
-32735,
-32905,
-32758,
-32219,
-31625,
-30961,
-30647,
-30453,
-30559,
-30761,
-30850,
-31002,
-30828,
-30538,
-30075,
-29586,
-29121,
-28988,
-28834,
-29032,
-29056,
-29208,
-29079,
-29009,
-28701,
-28523,
-28124,
-27904,
-27548,
-27461,
-27436,
-27529,
-27700,
-27663,
-27702,
-27637,
-27683,
-27900,
-28173,
-28496,
-28639,
-28630,
-28349,
-28057,
-27968,
-28149,
-28744,
-29519,
-30054,
-30292,
-29922,
-29429,
-29122,
-29343,
-29852,
-30583,
-30827,
-30671,
-30384,
-30075,
-30559,
-31160,
-32023,
-32310,
-32201,
-31713,
-31400,
-31451,
-31997,
-32690,
-33439,
-33795,
-34106,
-33947,
-34242,
-34189,
-34575,
-34653,
-34886,
-34985,
-35307,
-35606,
-36124,
-36450,
-36544,
-36340,
-36055,
-35589,
-35566,
-35656,
-36209,
-36763,
-37205,
-37451,
-37225,
-36833,
-36383,
-36145,
-36252,
-36386,
-36543,
-36229,
-36034,
-35699,
-35943,
-36099,
-36695,
-36455,
-36406,
-35525,
-35277,
-34970,
-35322,
-35347,
-35454,
-35125,
-34681,
-34502,
-34484,
-34812,
-34991,
-34947,
-34481,
-33906,
-33684,
-33507,
-34060,
-34194,
-34348,
-34239,
-34014,
-34174,
-34412,
-34595,
-34414,
-33838,
-33198,
-32930,
-33131,
-33463,
-33772,
-33595,
-33465,
-33436,
-33844,
-34300,
-34440,
-34082,
-33506,
-33221,
-33526,
-34219,
-34811,
-35058,
-34992,
-35034,
-35479,
-36031,
-36586,
-36564,
-36452,
-36321,
-36628,
-37142,
-37402,
-37409,
-36914,
-36522,
-36408,
-36450,
-36656,
-36471,
-36213,
-35962,
-35879,
-36030,
-36078,
-36098,
-35943,
-35921,
-35877,
-35855,
-35589,
-35190,
-35080,
-35277,
-36035,
-36472,
-36565,
-35832,
-34880,
-34239,
-34170,
-34571,
-34945,
-34660,
-33995,
-32973,
-32513,
-32507,
-32978,
-33261,
-33177,
-32596,
-31893,
-31489,
-31404,
-31734,
-32134,
-32089,
-31846,
-30938,
-30116,
-29302,
-28873,
-28904,
-29008,
-29077,
-28835,
-28566,
-28324,
-28370,
-28432,
-28281,
-27837,
-26994,
-26354,
-26086,
-26197,
-26354,
-26218,
-25447,
-24756,
-24161,
-24313,
-24760,
-25177,
-25402,
-25353,
-25425,
-25885,
-26467,
-26991,
-27152,
-27083,
-27193,
-27440,
-27924,
-28147,
-27992,
-27836,
-27571,
-27948,
-28367,
-28901,
-29098,
-29056,
-29143,
-29542,
-30208,
-31001,
-31495,
-31642,
-31805,
-31777,
-32135,
-32310,
-32577,
-32752,
-32822,
-32996,
-33111,
-33348,
-33643,
-34168,
-34861,
-35786,
-36388,
-36805,
-36765,
-36739,
-36986,
-37558,
-38182,
-38601,
-38600,
-38404,
-38222,
-38449,
-38666,
-38955,
-38781,
-38487,
-38318,
-38397,
-38936,
-39243,
-39465,
-39090,
-38511,
-37937,
-37561,
-37337,
-37340,
-37295,
-37093,
-36966,
-36514,
-36124,
-35676,
-35368,
-35323,
-35278,
-35280,
-34989,
-34484,
-33969,
-33420,
-33175,
-32929,
-32646,
-32307,
-31871,
-31622,
-31515,
-31490,
-31514,
-31136,
-30961,
-30405,
-30383,
-30341,
-30383,
-30451,
-30029,
-29629,
-29147,
-28875,
-28924,
-29120,
-29298,
-29411,
-29231,
-29055,
-29034,
-28985,
-29213,
-29097,
-28924,
-28655,
-28235,
-28102,
-28103,
-28303,
-28543,
-28857,
-28876,
-28924,
-28721,
-28658,
-28543,
-28880,
-29053,
-29610,
-29985,
-30338,
-30674,
-30825,
-31072,
-31290,
-31383,
-31422,
-31228,
-31245,
-31250,
-31778,
-32267,
-32798,
-33152,
-33153,
-33042,
-32952,
-33109,
-33419,
-33860,
-34062,
-34103,
-33929,
-33928,
-34016,
-34436,
-34816,
-34855,
-34618,
-34058,
-33529,
-33353,
-33506,
-34083,
-34549,
-35099,
-35060,
-35188,
-34926,
-35056,
-35059,
-35343,
-35480,
-35655,
-35587,
-35393,
-35253,
-35081,
-35169,
-35233,
-35080,
-34747,
-34127,
-33508,
-33129,
-32976,
-32930,
-32844,
-32508,
-32181,
-31909,
-31693,
-31778,
-31491,
-31514,
-31159,
-31314,
-31248,
-31424,
-31093,
-30627,
-30296,
-30116,
-30476,
-30711,
-30876,
-30490,
-30276,
-30073,
-30539,
-31091,
-31427,
-31401,
-31049,
-30982,
-31025,
-31581,
-31801,
-32001,
-31890,
-32000,
-32178,
-32377,
-32290,
-31911,
-31736,
-31999,
-32910,
-33839,
-34503,
-34394,
-34324,
-34441,
-35186,
-36102,
-36539,
-36099,
-35346,
-34790,
-35147,
-36298,
-37227,
-37827,
-37271,
-36631,
-36120,
-36365,
-37027,
-37739,
-38090,
-38006,
-37845,
-37762,
-38200,
-38759,
-39551,
-39867,
-39949,
-39334,
-38424,
-37493,
-36830,
-36897,
-37159,
-37917,
-38024,
-38157,
-37674,
-37337,
-37161,
-37053,
-37003,
-36832,
-36363,
-36143,
-35944,
-36053,
-36232,
-36142,
-35679,
-34834,
-33863,
-32974,
-32378,
-31890,
-31359,
-30603,
-29856,
-29117,
-28882,
-28808,
-28791,
-28434,
-27748,
-26973,
-26484,
-26555,
-26837,
-27152,
-27105,
-26595,
-26177,
-25555,
-25466,
-25180,
-25110,
-24915,
-24845,
-25025,
-25200,
-25400,
-25511,
-25621,
-25934,
-26194,
-26467,
-26349,
-26267,
-26285,
-26884,
-27660,
-28323,
-28347,
-27991,
-27705,
-28255,
-29412,
-30735,
-31229,
-30802,
-29876,
-29519,
-30030,
-31225,
-32245,
-32488,
-32443,
-32400,
-33419,
-34923,
-36498,
-37360,
-37317,
-36963,
-36740,
-37028,
-37384,
-37670,
-37561,
-37338,
-37228,
-37206,
-37472,
-37558,
-38007,
-38353,
-39204,
-39594,
-39910,
-39686,
-39465,
-39444,
-39685,
-39843,
-39841,
-39243,
-38979,
-38865,
-39600,
-40461,
-41171,
-41370,
-41125,
-40972,
-41016,
-41281,
-41281,
-40529,
-39486,
-38204,
-37514,
-37341,
-37602,
-37674,
-37402,
-36721,
-35941,
-35680,
-35675,
-35879,
-35854,
-35012,
-33974,
-32463,
-31561,
-30935,
-30873,
-30914,
-30805,
-30650,
-30405,
-30186,
-29939,
-29521,
-28856,
-28322,
-28105,
-28432,
-28989,
-29654,
-29541,
-29056,
-28012,
-27328,
-27150,
-27615,
-28391,
-28855,
-28854,
-28238,
-27701,
-27397,
-27500,
-27708,
-27522,
-27421,
-27146,
-27683,
-28168,
-28679,
-28346,
-27505,
-26860,
-26909,
-28121,
-29303,
-29914,
-29391,
-28498,
-28127,
-29054,
-30827,
-32288,
-32887,
-32222,
-31093,
-30473,
-30050,
-30208,
-30449,
-30961,
-32022,
-33728,
-35192,
-36251,
-35858,
-35209,
-34151,
-34060,
-34172,
-34593,
-34435,
-34240,
-33880,
-34264,
-34656,
-35257,
-35325,
-35276,
-35193,
-35697,
-36410,
-37050,
-37118,
-36231,
-34969,
-33816,
-33242,
-33572,
-34195,
-34613,
-34727,
-34147,
-33729,
-33375,
-33372,
-33421,
-33193,
-32934,
-32863,
-33398,
-34148,
-34702,
-34217,
-32775,
-30851,
-29474,
-28945,
-29187,
-29254,
-29122,
-28457,
-28279,
-28458,
-29164,
-29653,
-29765,
-29430,
-29255,
-29188,
-29053,
-28393,
-27059,
-25623,
-24890,
-25046,
-25843,
-26619,
-26861,
-26797,
-26926,
-27329,
-27726,
-27746,
-27108,
-26749,
-27041,
-28500,
-30274,
-31312,
-31295,
-30227,
-29275,
-29058,
-29627,
-30388,
-30891,
-30893,
-30937,
-31271,
-31845,
-32423,
-32641,
-32688,
-33108,
-33818,
-34968,
-35678,
-35942,
-35546,
-35345,
-35522,
-36409,
-37516,
-38312,
-38449,
-38176,
-38052,
-38399,
-39466,
-40462,
-41036,
-40664,
-39950,
-39400,
-39796,
-40618,
-41347,
-41038,
-39643,
-37912,
-36878,
-37200,
-38563,
-39969,
-40666,
-40147,
-39380,
-38510,
-38603,
-39044,
-39840,
-40309,
-40504,
-40352,
-39709,
-38843,
-37607,
-36450,
-35703,
-35386,
-35304,
-35409,
-35126,
-34878,
-34683,
-34414,
-34061,
-33263,
-32000,
-30628,
-29477,
-29030,
-29058,
-29074,
-28703,
-27458,
-26000,
-24468,
-23852,
-24158,
-24869,
-25800,
-25973,
-25804,
-25306,
-24984,
-24954,
-24914,
-24691,
-24138,
-23584,
-23385,
-23650,
-24114,
-24406,
-24335,
-24095,
-23915,
-24270,
-24671,
-25178,
-25311,
-25534,
-25598,
-25956,
-25864,
-25378,
-24604,
-23959,
-24139,
-25067,
-26376,
-27193,
-27218,
-26926,
-26488,
-27171,
-28014,
-29254,
-29786,
-29985,
-29852,
-30185,
-30781,
-31692,
-32310,
-32599,
-32577,
-32687,
-32864,
-33596,
-34348,
-35324,
-36186,
-36720,
-36760,
-36566,
-36075,
-36276,
-36763,
-37693,
-38113,
-38049,
-37381,
-37296,
-37892,
-39443,
-40728,
-41170,
-40350,
-39091,
-38399,
-38759,
-39707,
-40463,
-40173,
-39266,
-38357,
-38225,
-38581,
-39130,
-39135,
-38887,
-38580,
-38603,
-38842,
-38825,
-38510,
-37851,
-37580,
-37652,
-37733,
-37431,
-36450,
-35304,
-34655,
-34884,
-35409,
-35833,
-35413,
-34722,
-34020,
-33792,
-33708,
-33527,
-32999,
-32709,
-32909,
-33706,
-34238,
-33773,
-32266,
-30274,
-29032,
-29077,
-29853,
-30848,
-31005,
-31225,
-31225,
-32023,
-32511,
-32354,
-31161,
-29672,
-28880,
-29275,
-30473,
-31381,
-31380,
-30517,
-29852,
-29741,
-30894,
-31934,
-32931,
-32775,
-32356,
-31756,
-31582,
-31688,
-31604,
-31622,
-31161,
-30870,
-30584,
-30228,
-30362,
-30450,
-31138,
-31999,
-33154,
-34103,
-34617,
-34634,
-34350,
-34524,
-35214,
-36541,
-38004,
-38643,
-38649,
-37755,
-37034,
-36959,
-37429,
-38112,
-38004,
-37694,
-36850,
-37142,
-37910,
-39226,
-39772,
-39466,
-38292,
-37248,
-36877,
-36649,
-36675,
-35900,
-35233,
-34772,
-35188,
-35855,
-36453,
-36342,
-35921,
-35745,
-35808,
-36101,
-35653,
-34726,
-33507,
-32798,
-32976,
-33240,
-33530,
-32619,
-31959,
-31290,
-31736,
-32045,
-32044,
-30783,
-29210,
-28014,
-28013,
-28769,
-29627,
-29635,
-28940,
-28039,
-27857,
-28192,
-29143,
-29542,
-29542,
-29122,
-28810,
-29012,
-29363,
-29766,
-29562,
-28770,
-28098,
-27552,
-27724,
-28259,
-28567,
-28656,
-28278,
-28060,
-28433,
-29256,
-30073,
-30493,
-29855,
-29273,
-28593,
-29009,
-29741,
-30629,
-30980,
-30651,
-30406,
-30250,
-30917,
-31711,
-32689,
-33306,
-33819,
-34213,
-34773,
-35275,
-35747,
-35920,
-35965,
-35834,
-35520,
-35326,
-34945,
-35014,
-35079,
-35233,
-35128,
-34654,
-34064,
-33704,
-34128,
-34814,
-36098,
-36562,
-37031,
-36960,
-37297,
-37756,
-38272,
-38466,
-38182,
-37848,
-38002,
-38426,
-39419,
-39709,
-39775,
-39178,
-38755,
-38648,
-38885,
-39004,
-38730,
-38007,
-37424,
-36944,
-37113,
-37054,
-36960,
-36254,
-35502,
-34745,
-34373,
-34280,
-34217,
-34193,
-33906,
-33640,
-33306,
-33110,
-32951,
-32801,
-32796,
-32710,
-32798,
-32754,
-32709,
-32467,
-32154,
-31781,
-31357,
-30960,
-30739,
-30581,
-30585,
-30672,
-30669,
-30609,
-30180,
-29745,
-29054,
-28589,
-28125,
-27925,
-27836,
-27795,
-27811,
-27862,
-27767,
-27817,
-27614,
-27528,
-27391,
-27330,
-27523,
-27752,
-27900,
-27972,
-27746,
-27462,
-27325,
-27462,
-27746,
-28083,
-28432,
-28503,
-29010,
-29320,
-30186,
-30758,
-31139,
-31312,
-31228,
-31511,
-31981,
-32552,
-32978,
-32905,
-32536,
-32286,
-32224,
-32731,
-33351,
-33863,
-34014,
-33731,
-33305,
-33088,
-33018,
-33220,
-33219,
-32974,
-32446,
-31776,
-31405,
-31003,
-30916,
-30494,
-30052,
-29386,
-28878,
-28591,
-28322,
-28060,
-27459,
-26883,
-26445,
-26347,
-26447,
-26349,
-26022,
-25355,
-24736,
-24271,
-23938,
-23717,
-23207,
-22986,
-22477,
-22631,
-22632,
-22675,
-22721,
-22210,
-22101,
-21678,
-21769,
-21544,
-21615,
-21168,
-21104,
-20594,
-20438,
-20062,
-19797,
-19707,
-19377,
-19507,
-19265,
-19154,
-18911,
-18444,
-18247,
-17846,
-17805,
-17690,
-17583,
-17358,
-17141,
-16938,
-17205,
-17581,
-18180,
-18622,
-18757,
-18621,
-18467,
-18491,
-18864,
-19401,
-19904,
-20352,
-20725,
-21525,
-22409,
-23786,
-24798,
-25825,
-26504,
-27219,
-28057,
-29210,
-30296,
-31601,
-32621,
-33818,
-35122,
-36411,
-37978,
-39268,
-40594,
-41945,
-43209,
-44803,
-46154,
-47550,
-48679,
-49697,
-50520,
-51467,
-52426,
-53371,
-54353,
-55255,
-55946,
-56740,
-57253,
-58002,
-58582,
-59154,
-59623,
-60040,
-60309,
-60816,
-61062,
-61613,
-62037,
-62587,
-63077,
-63542,
-63584,
-63722,
-63449,
-63567,
-63782,
-64385,
-65069,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65493,
-65067,
-64806,
-64604,
-64405,
-63963,
-63164,
-62412,
-61903,
-61725,
-61991,
-61947,
-61702,
-60818,
-59598,
-58360,
-57250,
-56233,
-55345,
-54239,
-53043,
-51714,
-50473,
-49344,
-48147,
-46908,
-45488,
-44008,
-42874,
-41793,
-41036,
-40196,
-39023,
-37669,
-36256,
-35144,
-34394,
-33838,
-33109,
-32243,
-31029,
-30027,
-29233,
-28544,
-28016,
-27103,
-26224,
-25329,
-24629,
-24422,
-24273,
-24336,
-24271,
-24249,
-24114,
-24095,
-23737,
-23364,
-22741,
-22278,
-21968,
-21876,
-21947,
-22075,
-22125,
-22210,
-22232,
-22278,
-22431,
-22388,
-22633,
-22917,
-23188,
-23360,
-23341,
-22942,
-22653,
-22211,
-21945,
-21700,
-21326,
-20881,
-20439,
-19973,
-19820,
-19440,
-19178,
-18488,
-17826,
-17027,
-16541,
-16208,
-16164,
-15876,
-15544,
-14678,
-13907,
-12840,
-12023,
-11201,
-10628,
-9983,
-9343,
-8720,
-7948,
-7214,
-6531,
-5795,
-5225,
-4378,
-3829,
-2850,
-2189,
-1211,
-440,
-65535,
-1,
-65535,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-2,
-65535,
-3,
-65535,
-2,
-65535,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-65535,
-1,
-65535,
-2,
-1455,
-3672,
-5621,
-7547,
-9608,
-11469,
-13461,
-15123,
-17094,
-19043,
-21282,
-23404,
-25514,
-27480,
-29610,
-32110,
-35059,
-38444,
-41816,
-45176,
-48084,
-50516,
-52401,
-53819,
-55012,
-56321,
-57784,
-59708,
-61794,
-63961,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65532,
-65534,
-65531,
-65534,
-65531,
-65534,
-65531,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65270,
-63542,
-61657,
-60443,
-59376,
-58669,
-58026,
-56719,
-55081,
-52667,
-50228,
-47729,
-45598,
-43741,
-41837,
-40038,
-38160,
-36563,
-35278,
-34040,
-32864,
-31424,
-29898,
-28410,
-27286,
-26061,
-24983,
-23802,
-22479,
-21545,
-20794,
-20326,
-20086,
-19375,
-18467,
-17162,
-15874,
-14681,
-13904,
-13285,
-13063,
-12885,
-12865,
-12994,
-13397,
-13816,
-14458,
-14968,
-15300,
-15609,
-15789,
-16030,
-16629,
-17249,
-18202,
-19242,
-20175,
-21520,
-22680,
-24223,
-25845,
-27571,
-29185,
-30653,
-32065,
-33507,
-35258,
-37181,
-39446,
-41678,
-43829,
-45712,
-47149,
-48505,
-49540,
-50942,
-52507,
-54619,
-56739,
-58803,
-60484,
-61704,
-62897,
-64098,
-65532,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65202,
-64339,
-63121,
-61548,
-60041,
-58117,
-56362,
-54374,
-52444,
-50428,
-48348,
-46486,
-44426,
-42744,
-40705,
-38933,
-36964,
-35210,
-33376,
-31711,
-30098,
-28345,
-26640,
-24737,
-22874,
-21192,
-19398,
-17825,
-15964,
-14127,
-12043,
-10295,
-8566,
-7393,
-6087,
-4821,
-3519,
-1964,
-970,
-18,
-65535,
-1,
-65535,
-1,
-65535,
-3,
-65535,
-3,
-65535,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-2,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-3,
-65535,
-0,
-0,
-65535,
-1,
-65535,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-3829,
-8430,
-12247,
-15497,
-18291,
-21370,
-24667,
-28060,
-31246,
-33818,
-36253,
-38646,
-41701,
-45160,
-48742,
-52204,
-55255,
-58626,
-62279,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65531,
-65534,
-65531,
-65534,
-65533,
-65534,
-65533,
-65534,
-65532,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65531,
-65534,
-65533,
-65534,
-65067,
-63722,
-62408,
-61043,
-59883,
-58295,
-56696,
-54925,
-53685,
-52778,
-52399,
-51782,
-50825,
-49478,
-48103,
-47285,
-47171,
-47707,
-48101,
-48039,
-46728,
-44850,
-42453,
-40464,
-38953,
-37806,
-36761,
-35436,
-33882,
-32355,
-31138,
-30116,
-29611,
-28765,
-27970,
-26729,
-25422,
-24095,
-22851,
-21658,
-20637,
-19509,
-18667,
-17825,
-17182,
-16253,
-15256,
-13638,
-12068,
-10535,
-9411,
-9052,
-8945,
-9186,
-9076,
-8898,
-8435,
-8123,
-8036,
-8189,
-8456,
-8788,
-9032,
-9541,
-10073,
-11091,
-12134,
-13437,
-14506,
-15895,
-17251,
-19331,
-21611,
-24163,
-26837,
-28879,
-30870,
-32334,
-34127,
-36253,
-38624,
-41147,
-43209,
-44738,
-46151,
-47487,
-49628,
-52292,
-55368,
-58181,
-60506,
-61993,
-63406,
-64696,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65531,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-64558,
-62214,
-59975,
-57804,
-55635,
-53618,
-51648,
-49653,
-47927,
-46175,
-44628,
-42962,
-41283,
-39398,
-37338,
-35215,
-33039,
-31028,
-28987,
-27150,
-25335,
-23826,
-22545,
-21544,
-20595,
-19552,
-18313,
-16850,
-15499,
-14327,
-13438,
-12820,
-11956,
-11089,
-9767,
-8563,
-7373,
-6350,
-5555,
-4579,
-3828,
-2784,
-1923,
-1035,
-217,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-3,
-65535,
-3,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-1,
-65535,
-2,
-65535,
-1,
-65535,
-1,
-65535,
-2,
-65535,
-3,
-65535,
-707,
-3714,
-7216,
-11004,
-15077,
-19110,
-23119,
-26995,
-30894,
-34746,
-38513,
-42455,
-46642,
-51359,
-56254,
-61105,
-65248,
-65534,
-65534,
-65533,
-65534,
-65531,
-65534,
-65530,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65531,
-65534,
-65533,
-65534,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65356,
-63985,
-62302,
-60549,
-58383,
-56208,
-54041,
-52045,
-50297,
-48855,
-47661,
-46974,
-46330,
-45825,
-44866,
-43654,
-42165,
-40884,
-40063,
-40196,
-40683,
-41636,
-41990,
-41923,
-40862,
-39596,
-37961,
-36828,
-35788,
-35368,
-34836,
-34480,
-34108,
-33636,
-33399,
-33151,
-32843,
-32509,
-31804,
-30757,
-29545,
-28056,
-26797,
-25777,
-25089,
-24714,
-24093,
-23474,
-22077,
-20662,
-18841,
-17185,
-15874,
-14771,
-14057,
-13419,
-12686,
-11977,
-10872,
-9892,
-8880,
-8010,
-7352,
-6813,
-6510,
-6370,
-6488,
-6948,
-7658,
-8591,
-9361,
-10010,
-10468,
-10917,
-11798,
-13198,
-15233,
-17537,
-19995,
-22167,
-24226,
-26065,
-28014,
-29829,
-31847,
-33417,
-35368,
-37117,
-39665,
-42587,
-45912,
-49253,
-52137,
-54524,
-56810,
-59021,
-61750,
-64669,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65531,
-65534,
-65531,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-63654,
-61613,
-59290,
-56740,
-54418,
-51999,
-50010,
-47970,
-45843,
-43388,
-40680,
-38117,
-35608,
-33222,
-31024,
-28591,
-26484,
-24804,
-23582,
-22944,
-22230,
-21459,
-20329,
-19395,
-18337,
-17913,
-17424,
-17276,
-16868,
-16566,
-16073,
-15877,
-15609,
-15568,
-15608,
-15700,
-15897,
-15988,
-16229,
-16475,
-16827,
-17472,
-17869,
-18489,
-18734,
-18843,
-18956,
-18953,
-18934,
-18510,
-17672,
-16163,
-14702,
-13107,
-12110,
-11137,
-10250,
-8832,
-6905,
-4625,
-2363,
-374,
-65535,
-0,
-65535,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-3,
-65535,
-2,
-65535,
-65535,
-1,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-1743,
-5336,
-8962,
-12579,
-15896,
-19242,
-22545,
-26373,
-30916,
-35900,
-41080,
-45536,
-49165,
-51980,
-54306,
-56784,
-59336,
-62142,
-64942,
-65530,
-65534,
-65532,
-65534,
-65534,
-65533,
-65534,
-65531,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65139,
-63737,
-61929,
-59551,
-57143,
-54989,
-53489,
-52351,
-51521,
-50422,
-49438,
-48366,
-47617,
-46841,
-45865,
-44517,
-42830,
-41394,
-40349,
-40197,
-40484,
-41147,
-41660,
-41766,
-41416,
-40483,
-39245,
-37890,
-36720,
-35921,
-35411,
-35259,
-35032,
-34838,
-34325,
-33951,
-33262,
-32689,
-31622,
-30475,
-28942,
-27550,
-26329,
-25600,
-25003,
-24733,
-24097,
-23380,
-22104,
-20502,
-18824,
-17071,
-15720,
-14572,
-13856,
-13244,
-12641,
-11688,
-10651,
-9163,
-7925,
-6573,
-5755,
-4997,
-4806,
-4709,
-4958,
-5310,
-5865,
-6329,
-6707,
-6749,
-6418,
-5999,
-5663,
-5911,
-6815,
-8611,
-10915,
-13527,
-16033,
-18089,
-19776,
-20946,
-22234,
-23495,
-25090,
-26752,
-28544,
-30274,
-32244,
-34459,
-37029,
-39620,
-41701,
-43365,
-44337,
-46111,
-48390,
-52158,
-56429,
-60289,
-62985,
-64142,
-64314,
-64075,
-64271,
-65049,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65531,
-65534,
-65531,
-65534,
-65532,
-65534,
-65534,
-65534,
-64761,
-62609,
-60310,
-58379,
-56409,
-55327,
-54545,
-54176,
-53571,
-52225,
-49786,
-46752,
-43386,
-40484,
-38224,
-36542,
-35411,
-34460,
-33839,
-33263,
-32731,
-31914,
-30869,
-29500,
-28234,
-27305,
-26995,
-27129,
-27503,
-27749,
-27593,
-26949,
-26090,
-24954,
-24117,
-23385,
-23140,
-22964,
-23053,
-23073,
-23099,
-23271,
-23387,
-23759,
-24096,
-24423,
-24405,
-24159,
-23429,
-22654,
-21480,
-20548,
-19377,
-18355,
-17251,
-15853,
-14281,
-12443,
-10714,
-9277,
-8167,
-7636,
-6906,
-6130,
-4269,
-1879,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-2,
-65535,
-2,
-65535,
-1,
-65535,
-0,
-65535,
-173,
-3094,
-5778,
-7811,
-9743,
-11865,
-14704,
-18377,
-22765,
-27393,
-31736,
-35367,
-38270,
-40725,
-42768,
-45243,
-47554,
-50248,
-52912,
-55632,
-58537,
-61571,
-64869,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65532,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65531,
-65534,
-65532,
-65534,
-65534,
-65533,
-65534,
-65531,
-65534,
-65465,
-63567,
-61257,
-58892,
-56852,
-55346,
-54240,
-53572,
-52734,
-51691,
-50231,
-48146,
-45779,
-43163,
-40862,
-39442,
-38557,
-38623,
-38491,
-38314,
-37360,
-35943,
-34061,
-32178,
-30384,
-28656,
-27260,
-25778,
-24668,
-23585,
-22807,
-22280,
-21808,
-21374,
-20566,
-19535,
-17956,
-16275,
-14547,
-13239,
-12289,
-11822,
-11557,
-11136,
-10470,
-9366,
-7945,
-6707,
-5487,
-5002,
-4711,
-4913,
-5200,
-5420,
-5579,
-5441,
-5224,
-4866,
-4404,
-4113,
-4094,
-4313,
-5067,
-6042,
-7370,
-8877,
-10427,
-11822,
-12909,
-13660,
-14259,
-15079,
-16252,
-18202,
-20615,
-23253,
-25842,
-28103,
-30074,
-32044,
-33973,
-35987,
-37849,
-39420,
-40861,
-42211,
-44294,
-46752,
-49787,
-52644,
-54970,
-56741,
-58158,
-59912,
-62054,
-64741,
-65532,
-65534,
-65534,
-65533,
-65534,
-65531,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65531,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-64428,
-62302,
-59752,
-57142,
-54946,
-53443,
-51956,
-50453,
-48056,
-45670,
-43051,
-41217,
-39397,
-37606,
-35454,
-33088,
-30980,
-29456,
-28587,
-27795,
-27126,
-25888,
-24935,
-23983,
-23605,
-23364,
-23096,
-22764,
-22101,
-21678,
-20970,
-20618,
-20037,
-19689,
-19329,
-19111,
-18931,
-18735,
-18687,
-18691,
-19175,
-19752,
-20462,
-21035,
-21039,
-20835,
-20175,
-19573,
-18692,
-17843,
-16855,
-15850,
-15081,
-14280,
-13706,
-12951,
-12134,
-11289,
-10695,
-10138,
-9896,
-8966,
-7723,
-5512,
-3205,
-705,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-65535,
-1,
-65535,
-4,
-65535,
-2,
-65535,
-65535,
-0,
-65535,
-65535,
-3,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-1,
-700,
-2434,
-4047,
-5731,
-7727,
-9916,
-12708,
-15767,
-18931,
-21902,
-24182,
-26196,
-28038,
-30116,
-32512,
-35123,
-37295,
-39441,
-41195,
-43606,
-46287,
-49366,
-52400,
-54704,
-56631,
-57915,
-59024,
-59952,
-60597,
-61258,
-61527,
-62324,
-63030,
-64098,
-64912,
-65381,
-65491,
-65401,
-65315,
-65224,
-65025,
-64627,
-63963,
-63430,
-62855,
-62656,
-62477,
-62104,
-61590,
-60641,
-59710,
-58800,
-58206,
-57913,
-58006,
-58047,
-58116,
-57738,
-57162,
-56122,
-54947,
-53774,
-52799,
-52200,
-51915,
-51888,
-51894,
-51667,
-51161,
-50340,
-49433,
-48302,
-47151,
-45490,
-44004,
-42083,
-40767,
-39446,
-38666,
-37981,
-37208,
-36362,
-35057,
-33443,
-31443,
-29148,
-26836,
-24893,
-23384,
-22454,
-21724,
-20836,
-19577,
-18000,
-16388,
-14876,
-13553,
-12330,
-11270,
-10361,
-9762,
-9520,
-9185,
-8923,
-8188,
-7306,
-6595,
-5996,
-5955,
-5839,
-6156,
-6371,
-7084,
-8035,
-9252,
-10319,
-11288,
-11670,
-12286,
-12843,
-13925,
-15390,
-17071,
-18868,
-20768,
-22524,
-24466,
-26158,
-27743,
-29015,
-30314,
-31383,
-33040,
-34637,
-36852,
-38954,
-41040,
-42873,
-44718,
-46461,
-48704,
-50914,
-53199,
-55169,
-56785,
-58005,
-59178,
-60573,
-62103,
-64049,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65530,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-63806,
-62369,
-61016,
-59731,
-58293,
-56032,
-53642,
-50870,
-48504,
-46330,
-44383,
-42521,
-40507,
-38711,
-36962,
-35369,
-33792,
-32226,
-30469,
-29102,
-27590,
-26798,
-25598,
-24958,
-23739,
-22697,
-21659,
-20502,
-19666,
-18621,
-17848,
-16961,
-16230,
-15499,
-14814,
-14281,
-13771,
-13551,
-13460,
-13663,
-13792,
-14040,
-13858,
-13507,
-12863,
-11933,
-11248,
-10293,
-9586,
-8677,
-7748,
-6683,
-5577,
-4513,
-3228,
-2255,
-1324,
-1079,
-1193,
-1321,
-926,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-65535,
-1,
-65535,
-3,
-65535,
-2,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-1059,
-3979,
-7042,
-10312,
-13245,
-15517,
-17187,
-18685,
-20442,
-23294,
-26885,
-31269,
-35258,
-38776,
-41440,
-43936,
-46156,
-48967,
-51380,
-54041,
-56055,
-58114,
-60264,
-62655,
-65534,
-65534,
-65534,
-65532,
-65534,
-65529,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65002,
-64097,
-62786,
-61108,
-58909,
-57076,
-55257,
-54261,
-53463,
-52866,
-52466,
-51892,
-51291,
-50187,
-48611,
-46466,
-44470,
-42832,
-41902,
-41567,
-41240,
-40814,
-40087,
-39331,
-38668,
-37981,
-37161,
-35789,
-34082,
-32223,
-30648,
-29411,
-28721,
-28215,
-27879,
-27505,
-26884,
-25733,
-24137,
-22101,
-19861,
-18005,
-16603,
-15880,
-15452,
-15058,
-14480,
-13506,
-12487,
-11381,
-10247,
-9522,
-8587,
-8125,
-7480,
-7394,
-7214,
-7306,
-7214,
-6995,
-6616,
-6332,
-6172,
-6464,
-6838,
-7570,
-8346,
-9385,
-10716,
-12132,
-13706,
-14967,
-15876,
-16585,
-17072,
-17936,
-18976,
-20594,
-22322,
-24668,
-26841,
-29342,
-31204,
-32842,
-33861,
-34858,
-35921,
-37206,
-38912,
-40615,
-42480,
-44535,
-46686,
-48924,
-51025,
-52603,
-53991,
-55283,
-56984,
-59221,
-61441,
-63559,
-64740,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65532,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65531,
-65534,
-65066,
-63700,
-61945,
-60353,
-58556,
-57053,
-55168,
-53598,
-51779,
-50097,
-48258,
-46265,
-44205,
-41902,
-39884,
-37829,
-36206,
-34860,
-33506,
-32465,
-31271,
-30317,
-29408,
-28525,
-27746,
-26863,
-26021,
-25022,
-24295,
-23515,
-23098,
-22609,
-22255,
-21812,
-21369,
-21014,
-20639,
-20261,
-19774,
-19331,
-18866,
-18667,
-18689,
-18866,
-18866,
-18777,
-18468,
-17891,
-17382,
-16653,
-15873,
-14904,
-13703,
-12467,
-11134,
-9987,
-8629,
-7220,
-5551,
-3829,
-2385,
-1126,
-193,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-2,
-65535,
-0,
-65535,
-2,
-65535,
-2,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-0,
-0,
-65535,
-3,
-65535,
-0,
-65535,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-349,
-2873,
-5247,
-8187,
-12069,
-16649,
-21481,
-26086,
-30141,
-33594,
-37253,
-40834,
-44697,
-48387,
-51584,
-54458,
-57141,
-60130,
-63520,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-64648,
-62723,
-60506,
-58360,
-56541,
-55037,
-53927,
-53244,
-52289,
-51602,
-50697,
-49783,
-48816,
-47503,
-45890,
-43761,
-41525,
-39443,
-37582,
-36254,
-34880,
-33861,
-32466,
-31314,
-29741,
-27971,
-25907,
-23454,
-21212,
-19310,
-18091,
-17204,
-16519,
-15388,
-14083,
-12242,
-10428,
-8611,
-6904,
-5313,
-3736,
-2167,
-1101,
-107,
-65535,
-2,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-4,
-65535,
-197,
-879,
-1391,
-2120,
-3031,
-4645,
-6463,
-8810,
-11291,
-13882,
-16497,
-18821,
-20860,
-22698,
-24248,
-26042,
-27927,
-30027,
-32336,
-35054,
-38006,
-41500,
-44651,
-47614,
-49678,
-51445,
-53356,
-56229,
-59801,
-63917,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65530,
-65534,
-65531,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65532,
-65534,
-65534,
-65534,
-65533,
-65534,
-64291,
-62393,
-60550,
-59044,
-57208,
-55235,
-52578,
-49809,
-46951,
-44293,
-41769,
-39444,
-37138,
-35192,
-33659,
-32491,
-31510,
-30387,
-28964,
-27174,
-25621,
-24026,
-23163,
-22389,
-21833,
-21349,
-20636,
-20041,
-19219,
-18514,
-17557,
-16676,
-15608,
-14747,
-14059,
-13662,
-13439,
-13617,
-13594,
-13839,
-13482,
-13132,
-12329,
-11493,
-10491,
-9388,
-8079,
-6616,
-5114,
-3757,
-2544,
-1324,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-2,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-2565,
-5864,
-9276,
-13616,
-18424,
-23450,
-28104,
-32243,
-36010,
-39665,
-43894,
-48149,
-52731,
-56566,
-59995,
-62925,
-65531,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65532,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-64780,
-62569,
-60395,
-58248,
-56565,
-55035,
-53776,
-52442,
-50941,
-49585,
-48281,
-47219,
-46085,
-44607,
-42562,
-40156,
-37711,
-35592,
-33947,
-32447,
-31112,
-29743,
-28279,
-26751,
-25092,
-23094,
-20994,
-18644,
-16541,
-14857,
-13704,
-12732,
-12021,
-10739,
-9450,
-7616,
-6019,
-4313,
-2921,
-1520,
-130,
-65535,
-1,
-65535,
-2,
-65535,
-3,
-65535,
-2,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-3,
-65535,
-1,
-193,
-970,
-1721,
-2190,
-3093,
-4095,
-5796,
-7704,
-10117,
-12619,
-15214,
-17489,
-19468,
-21055,
-22591,
-24047,
-25755,
-27416,
-29364,
-31205,
-33417,
-35767,
-38489,
-41283,
-44026,
-46467,
-48565,
-50809,
-53150,
-56147,
-59263,
-62503,
-65113,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65531,
-65534,
-65531,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-64428,
-62633,
-61261,
-59309,
-57098,
-54149,
-51027,
-48127,
-45709,
-43807,
-42168,
-40372,
-38691,
-36961,
-35434,
-33994,
-32356,
-30515,
-28570,
-26637,
-25183,
-23890,
-22834,
-21633,
-20240,
-18645,
-16960,
-15102,
-13284,
-11357,
-9542,
-8012,
-6972,
-6397,
-6129,
-5932,
-5530,
-4825,
-3982,
-2784,
-1858,
-611,
-3,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-65535,
-0,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-3,
-65535,
-2,
-65535,
-1,
-65535,
-3,
-65535,
-3,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-0,
-65535,
-0,
-65535,
-1104,
-5377,
-9142,
-12887,
-16339,
-20285,
-25045,
-30074,
-35679,
-40415,
-44739,
-48478,
-52335,
-56720,
-61568,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65532,
-62989,
-59820,
-56498,
-53264,
-49943,
-46816,
-43920,
-40902,
-38160,
-35234,
-32510,
-30007,
-27571,
-25178,
-22278,
-19175,
-15634,
-12551,
-9921,
-7965,
-6355,
-4754,
-2965,
-969,
-65535,
-1,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-2,
-65535,
-2,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-1,
-1099,
-3299,
-5373,
-7130,
-8853,
-10694,
-12708,
-15189,
-17981,
-21058,
-24404,
-27549,
-30803,
-33775,
-36628,
-39201,
-41767,
-44095,
-46574,
-49035,
-51669,
-54416,
-57383,
-60508,
-63717,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65531,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65531,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65335,
-62391,
-59308,
-56258,
-53194,
-49879,
-46638,
-43189,
-39950,
-36787,
-33837,
-31161,
-28500,
-25777,
-23052,
-20129,
-17514,
-15124,
-12885,
-11092,
-9143,
-7325,
-5289,
-3118,
-903,
-0,
-65535,
-3,
-65535,
-3,
-65535,
-0,
-0,
-65535,
-2,
-65535,
-3,
-65535,
-1,
-65535,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-65535,
-0,
-65535,
-3,
-65535,
-2,
-65535,
-65535,
-65535,
-1,
-65535,
-3,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-2943,
-6682,
-10341,
-14256,
-18049,
-22054,
-26264,
-30895,
-35787,
-40706,
-45158,
-49164,
-52803,
-56294,
-60268,
-64291,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-64360,
-61616,
-59110,
-56632,
-54282,
-51626,
-48700,
-45602,
-43030,
-40750,
-39112,
-37115,
-34926,
-32354,
-29986,
-27903,
-26154,
-24202,
-21814,
-19130,
-16410,
-14235,
-12621,
-11533,
-10474,
-9318,
-7948,
-6616,
-5288,
-3962,
-2561,
-773,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-1170,
-3205,
-5400,
-7415,
-9142,
-10671,
-12377,
-14524,
-17160,
-19731,
-22586,
-25135,
-28259,
-31378,
-34748,
-37672,
-40282,
-42614,
-45043,
-47952,
-50957,
-54064,
-57006,
-59776,
-62768,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-64937,
-62323,
-59333,
-56676,
-53772,
-51184,
-48234,
-45093,
-41723,
-38336,
-35412,
-32975,
-31003,
-29322,
-27481,
-25357,
-23162,
-20816,
-19064,
-17384,
-16052,
-14547,
-13108,
-11733,
-10605,
-9697,
-8764,
-7617,
-6104,
-4474,
-2980,
-1860,
-1009,
-286,
-65535,
-0,
-65535,
-1,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-1,
-65535,
-0,
-65535,
-2,
-65535,
-3,
-65535,
-0,
-65535,
-0,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-329,
-4645,
-9120,
-13507,
-18488,
-23297,
-28279,
-33043,
-37692,
-42833,
-47946,
-53621,
-58534,
-63100,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-63940,
-61151,
-58068,
-55238,
-52552,
-50189,
-48013,
-45910,
-43764,
-41544,
-39468,
-37403,
-35569,
-33770,
-31560,
-29429,
-26909,
-24844,
-22943,
-21346,
-19641,
-17427,
-14946,
-12242,
-9919,
-8078,
-6463,
-4978,
-3074,
-1190,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-3,
-65535,
-4,
-65535,
-4,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-65535,
-2,
-65535,
-4,
-65535,
-2,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-2941,
-6793,
-10652,
-14300,
-18249,
-22074,
-26400,
-30670,
-34992,
-39021,
-42966,
-46640,
-50630,
-54614,
-58735,
-62746,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65531,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65111,
-61752,
-58154,
-54442,
-50980,
-47729,
-44801,
-41926,
-39219,
-36432,
-33994,
-31534,
-29478,
-27281,
-25047,
-22742,
-20305,
-18026,
-15874,
-13840,
-11821,
-9831,
-7922,
-5978,
-4466,
-2699,
-1345,
-65535,
-0,
-65535,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-3,
-65535,
-3,
-65535,
-0,
-0,
-65535,
-3,
-65535,
-3,
-65535,
-3,
-65535,
-3,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-65535,
-1,
-65535,
-6,
-65535,
-3,
-65535,
-1,
-65535,
-0,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-65535,
-65535,
-415,
-4737,
-9250,
-13908,
-18995,
-24517,
-30317,
-36076,
-41237,
-45954,
-50253,
-55013,
-60309,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65534,
-63454,
-60306,
-57252,
-54483,
-52044,
-49656,
-47526,
-45224,
-43209,
-40926,
-38824,
-36695,
-34771,
-33084,
-31449,
-29850,
-27905,
-26019,
-24139,
-22697,
-21436,
-20084,
-18223,
-15833,
-13216,
-10917,
-8941,
-7350,
-5685,
-3785,
-1741,
-3,
-65535,
-1,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-2,
-65535,
-2,
-65535,
-3,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-1,
-65535,
-2,
-1277,
-5645,
-9961,
-14812,
-19576,
-24646,
-29699,
-34612,
-39577,
-43939,
-48523,
-52735,
-57337,
-62015,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-62589,
-59245,
-56453,
-53552,
-51117,
-48788,
-46599,
-44182,
-41503,
-38446,
-35236,
-32331,
-29477,
-27371,
-25311,
-23741,
-22363,
-20995,
-19639,
-17982,
-16295,
-14149,
-12288,
-10161,
-8722,
-7369,
-6442,
-5687,
-5066,
-4360,
-3868,
-2966,
-2186,
-1081,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-3,
-65535,
-3,
-65535,
-5,
-65535,
-5,
-65535,
-5,
-65535,
-5,
-65535,
-3,
-65535,
-2,
-65535,
-65535,
-65535,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-3,
-65535,
-1,
-65535,
-65535,
-4384,
-8807,
-13155,
-17801,
-22786,
-27949,
-33326,
-38961,
-44178,
-49259,
-53615,
-57564,
-61701,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65531,
-65534,
-65530,
-65534,
-65530,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65531,
-64564,
-62918,
-61284,
-59886,
-58382,
-57005,
-55504,
-54125,
-52890,
-51779,
-51050,
-50162,
-49500,
-48478,
-47330,
-46021,
-44603,
-43519,
-42322,
-41458,
-40219,
-38955,
-37229,
-35388,
-33332,
-30935,
-28680,
-25842,
-23209,
-20104,
-17385,
-14478,
-11957,
-9186,
-6418,
-3339,
-284,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-3,
-65535,
-4,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-2,
-65535,
-1259,
-6129,
-11556,
-16720,
-22496,
-28194,
-34257,
-39888,
-45776,
-51295,
-57072,
-62899,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65531,
-65534,
-65530,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65531,
-65534,
-65531,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65531,
-63768,
-60856,
-57920,
-55232,
-52602,
-50118,
-47727,
-45446,
-43339,
-41440,
-39705,
-38094,
-36585,
-35123,
-33642,
-32374,
-30807,
-29497,
-27836,
-26509,
-25266,
-24205,
-23428,
-22477,
-21502,
-20483,
-19552,
-18779,
-18178,
-17760,
-17403,
-17360,
-17382,
-17605,
-17779,
-17804,
-17603,
-17315,
-17184,
-17115,
-16985,
-16672,
-15855,
-15143,
-14239,
-13969,
-13708,
-13658,
-13442,
-12840,
-12200,
-11290,
-10605,
-9607,
-8700,
-7615,
-6505,
-5379,
-4180,
-2808,
-1213,
-65535,
-65535,
-0,
-65535,
-65535,
-2,
-65535,
-3,
-65535,
-65535,
-1,
-65535,
-0,
-0,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-1,
-65535,
-2,
-1345,
-4580,
-7990,
-11071,
-14300,
-17298,
-20413,
-23475,
-26286,
-28877,
-31359,
-33883,
-36852,
-39774,
-42545,
-44714,
-46308,
-47907,
-49828,
-51914,
-53907,
-54901,
-55527,
-55742,
-56854,
-58468,
-60220,
-61281,
-61218,
-60859,
-60775,
-61613,
-62878,
-63740,
-63741,
-62899,
-62236,
-62277,
-62990,
-63783,
-64119,
-63652,
-63208,
-62923,
-63230,
-63697,
-64163,
-64203,
-64409,
-64667,
-65318,
-65531,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65533,
-65534,
-65531,
-65534,
-65532,
-65534,
-65532,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-63675,
-61547,
-59267,
-56254,
-53175,
-50076,
-47150,
-44316,
-41015,
-37250,
-32843,
-28501,
-24248,
-20351,
-16384,
-12045,
-7503,
-2675,
-65535,
-65535,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-65535,
-1,
-65535,
-3,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-3,
-65535,
-2,
-65535,
-2565,
-7525,
-12666,
-18045,
-23208,
-28612,
-33683,
-38956,
-43941,
-49120,
-54085,
-59045,
-63806,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65531,
-65534,
-65529,
-65534,
-65532,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65532,
-65534,
-65534,
-65533,
-65534,
-63984,
-61414,
-58228,
-55256,
-52710,
-50962,
-49674,
-48371,
-46818,
-44868,
-42680,
-40878,
-39382,
-38330,
-37320,
-36009,
-34237,
-32290,
-30493,
-29145,
-28123,
-27462,
-26239,
-24894,
-23205,
-21481,
-20371,
-19289,
-18553,
-17429,
-16140,
-14592,
-13086,
-11864,
-10918,
-10179,
-9259,
-8074,
-6799,
-5595,
-4848,
-4423,
-4537,
-4822,
-5245,
-5687,
-6218,
-6685,
-7325,
-7704,
-8145,
-8722,
-9475,
-10582,
-11512,
-12421,
-12820,
-13349,
-13908,
-14876,
-16165,
-17140,
-17999,
-18294,
-18486,
-18780,
-19308,
-19907,
-20639,
-20924,
-20950,
-20570,
-19887,
-19174,
-18337,
-17600,
-16854,
-16316,
-15658,
-15008,
-13974,
-12551,
-10762,
-8986,
-7149,
-5732,
-3804,
-1811,
-0,
-65535,
-2,
-65535,
-3,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-2,
-65535,
-2,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-3249,
-6575,
-9143,
-11665,
-14328,
-17535,
-21171,
-24647,
-27747,
-30031,
-32088,
-34260,
-37006,
-39976,
-43051,
-45426,
-47458,
-49346,
-51735,
-54482,
-57452,
-59596,
-61308,
-62121,
-63454,
-64849,
-65533,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65531,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-64362,
-62035,
-59665,
-57163,
-54969,
-52578,
-50339,
-47951,
-45331,
-42747,
-39794,
-36876,
-33638,
-30230,
-26838,
-23276,
-19684,
-15966,
-12065,
-8035,
-3960,
-65535,
-65535,
-65535,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-1,
-65535,
-0,
-0,
-65535,
-3,
-2715,
-8060,
-13705,
-19684,
-25712,
-31778,
-37782,
-43874,
-49917,
-55792,
-61458,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65532,
-65534,
-63383,
-58935,
-54661,
-50450,
-45977,
-41283,
-36716,
-32667,
-29320,
-26419,
-23584,
-20506,
-17159,
-14039,
-11445,
-9875,
-8852,
-8348,
-7589,
-6841,
-5731,
-4889,
-4138,
-3782,
-3670,
-3563,
-3581,
-3408,
-3382,
-3495,
-3893,
-4512,
-5225,
-5840,
-6353,
-6793,
-7439,
-8166,
-9321,
-10583,
-11842,
-13000,
-13724,
-14350,
-14701,
-15145,
-15500,
-16229,
-16786,
-17779,
-18667,
-19531,
-20549,
-21569,
-22764,
-24137,
-25623,
-27082,
-28391,
-29609,
-30537,
-31759,
-32775,
-34304,
-35700,
-37006,
-37892,
-38138,
-38200,
-37939,
-37869,
-37914,
-38072,
-37912,
-37474,
-36628,
-35678,
-34969,
-34415,
-34016,
-33442,
-32507,
-30918,
-29097,
-27174,
-25289,
-23760,
-21747,
-19706,
-16963,
-14280,
-11623,
-9055,
-6639,
-3937,
-1169,
-0,
-65535,
-2,
-65535,
-3,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-0,
-0,
-1720,
-4648,
-7657,
-11470,
-15830,
-20086,
-23604,
-26044,
-27815,
-29585,
-32157,
-35300,
-38558,
-41037,
-42323,
-43074,
-43565,
-44801,
-46200,
-47858,
-48681,
-49320,
-49700,
-50294,
-51006,
-51559,
-51558,
-51360,
-50982,
-51115,
-51494,
-51778,
-51871,
-51468,
-51006,
-50982,
-51404,
-52445,
-53440,
-54152,
-54657,
-55039,
-56186,
-57850,
-60352,
-62610,
-64518,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65530,
-65534,
-65532,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-64806,
-60993,
-56653,
-52424,
-48035,
-43940,
-39354,
-34792,
-29607,
-24717,
-19858,
-15504,
-10999,
-6377,
-1500,
-65535,
-1,
-65535,
-3,
-65535,
-1,
-65535,
-0,
-0,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-2,
-1986,
-7129,
-12507,
-17915,
-23406,
-28923,
-34436,
-40286,
-46020,
-51979,
-57475,
-62896,
-65534,
-65533,
-65534,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-64780,
-60354,
-55743,
-51759,
-47615,
-43764,
-39706,
-35902,
-32131,
-28835,
-25798,
-23053,
-20438,
-17826,
-15388,
-13196,
-11336,
-10138,
-9188,
-8875,
-8657,
-8787,
-8832,
-9366,
-9915,
-11138,
-12353,
-13727,
-15080,
-16384,
-18158,
-20327,
-23009,
-26086,
-28923,
-31601,
-33928,
-36186,
-38780,
-41569,
-44713,
-47729,
-50471,
-53022,
-55257,
-57628,
-59797,
-62082,
-63826,
-65339,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65072,
-63604,
-62328,
-60524,
-58895,
-56781,
-54841,
-52552,
-50321,
-47658,
-44981,
-41946,
-38889,
-35833,
-32886,
-30118,
-27682,
-25356,
-23384,
-21591,
-19928,
-18292,
-16716,
-14881,
-13459,
-11892,
-10911,
-9922,
-9205,
-8636,
-8011,
-7659,
-7349,
-7370,
-7348,
-7549,
-7413,
-7549,
-7215,
-7503,
-7549,
-8321,
-9012,
-9738,
-10230,
-10271,
-10118,
-9894,
-9808,
-9852,
-9784,
-9409,
-8565,
-7261,
-6042,
-4801,
-3759,
-2521,
-769,
-0,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-65535,
-1,
-65535,
-3,
-65535,
-0,
-65535,
-2054,
-7216,
-11159,
-14147,
-17227,
-21170,
-26220,
-31601,
-36123,
-39041,
-40730,
-42032,
-44185,
-47438,
-51138,
-54261,
-55921,
-56256,
-56164,
-56256,
-57227,
-58471,
-59509,
-60286,
-60396,
-61016,
-61594,
-63008,
-64207,
-65269,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65533,
-65534,
-65531,
-65534,
-65532,
-65534,
-65532,
-65534,
-65534,
-65533,
-65250,
-62120,
-59692,
-58310,
-57010,
-55256,
-52601,
-49232,
-45691,
-42319,
-39335,
-36340,
-32911,
-29164,
-24914,
-21146,
-17516,
-14724,
-12000,
-9430,
-6906,
-4446,
-2542,
-1014,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-196,
-991,
-1456,
-1923,
-2496,
-4293,
-6462,
-9276,
-11645,
-13728,
-15542,
-17606,
-20238,
-23385,
-26663,
-29409,
-31690,
-33353,
-35211,
-37517,
-40284,
-42965,
-45135,
-46177,
-46507,
-46577,
-46705,
-47442,
-48079,
-48481,
-48236,
-47326,
-46157,
-45044,
-43964,
-43118,
-41946,
-40551,
-38976,
-37031,
-35542,
-33887,
-32417,
-30986,
-29295,
-27950,
-26728,
-25599,
-24493,
-23185,
-21745,
-20639,
-19817,
-19953,
-20305,
-21059,
-21480,
-22055,
-22810,
-24180,
-26155,
-28544,
-30939,
-33218,
-35213,
-37559,
-40131,
-43406,
-46887,
-50405,
-53509,
-56187,
-58647,
-61127,
-63917,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65531,
-65534,
-65530,
-65534,
-65532,
-65534,
-65534,
-65534,
-63783,
-61618,
-59307,
-56634,
-53638,
-50520,
-47593,
-45069,
-43363,
-41946,
-41148,
-39976,
-38798,
-37320,
-35718,
-34351,
-32820,
-31623,
-29942,
-28345,
-26574,
-25113,
-24004,
-23363,
-22831,
-21855,
-20706,
-18909,
-17516,
-16185,
-15500,
-14834,
-14195,
-13104,
-11737,
-10402,
-9145,
-8476,
-7771,
-7215,
-6218,
-4980,
-3869,
-2943,
-2673,
-2897,
-3406,
-3915,
-4293,
-4400,
-4649,
-5241,
-6134,
-7589,
-9166,
-10913,
-12622,
-14235,
-15967,
-17645,
-19444,
-21125,
-22586,
-23519,
-24313,
-24561,
-24911,
-25112,
-25511,
-25999,
-26307,
-26311,
-25618,
-24384,
-22829,
-21393,
-20370,
-19600,
-18708,
-17074,
-14767,
-11823,
-8967,
-6460,
-4205,
-2031,
-0,
-65535,
-1,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-0,
-0,
-65535,
-1,
-65535,
-0,
-65535,
-0,
-65535,
-1,
-65535,
-0,
-0,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-4292,
-12287,
-19598,
-25931,
-30583,
-34526,
-38823,
-43961,
-49941,
-55858,
-60925,
-64430,
-65533,
-65534,
-65534,
-65534,
-65532,
-65534,
-65530,
-65534,
-65533,
-65534,
-65534,
-65531,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65531,
-65534,
-65532,
-65534,
-65533,
-65534,
-65531,
-65534,
-65531,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65534,
-65533,
-63987,
-60859,
-57075,
-52136,
-46749,
-41086,
-36071,
-31674,
-27588,
-23521,
-18887,
-14015,
-8944,
-4092,
-65535,
-0,
-65535,
-1,
-65535,
-2,
-65535,
-2,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-2,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-0,
-2652,
-5865,
-8300,
-10517,
-12641,
-15301,
-18577,
-21791,
-25134,
-27371,
-29388,
-30981,
-32689,
-34965,
-37410,
-39992,
-41971,
-43518,
-44402,
-45206,
-46238,
-47354,
-48987,
-50275,
-51559,
-52333,
-52977,
-53707,
-54704,
-55987,
-57763,
-59441,
-61352,
-63007,
-64717,
-65534,
-65534,
-65534,
-65532,
-65534,
-65531,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65531,
-65534,
-60283,
-54328,
-48435,
-42678,
-37271,
-31848,
-26682,
-21348,
-15965,
-10670,
-5755,
-1168,
-65535,
-1,
-65535,
-2,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-3,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-0,
-281,
-1878,
-3119,
-4667,
-6619,
-9428,
-12002,
-14102,
-15169,
-15587,
-15721,
-16474,
-17537,
-19287,
-20727,
-22011,
-22897,
-23717,
-24758,
-26065,
-27481,
-28790,
-29940,
-30695,
-31579,
-32466,
-33794,
-35346,
-37073,
-38756,
-40240,
-41503,
-42587,
-43608,
-44692,
-45844,
-46973,
-47927,
-48656,
-49146,
-49275,
-49413,
-49274,
-49281,
-49029,
-48706,
-48012,
-46930,
-45269,
-43450,
-41217,
-39331,
-37117,
-35014,
-32309,
-29235,
-25773,
-22724,
-20014,
-18160,
-16339,
-14438,
-12021,
-9453,
-7193,
-5642,
-4825,
-4202,
-3473,
-2453,
-1124,
-284,
-65535,
-1,
-38,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-3,
-65535,
-4,
-65535,
-1,
-65535,
-0,
-65535,
-3,
-65535,
-6,
-65535,
-4,
-65535,
-65535,
-2,
-65535,
-3,
-65535,
-1,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-0,
-2320,
-8810,
-14016,
-17713,
-20153,
-22297,
-25447,
-29695,
-34882,
-39883,
-43743,
-46639,
-48880,
-51781,
-55499,
-60198,
-64361,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65531,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-61149,
-57674,
-55763,
-53978,
-52130,
-48993,
-45642,
-42324,
-40040,
-38579,
-37162,
-35433,
-32866,
-29961,
-27662,
-26150,
-26178,
-26772,
-27395,
-27524,
-26711,
-25684,
-24672,
-24469,
-25134,
-26597,
-28568,
-30360,
-31758,
-32555,
-32708,
-32645,
-32642,
-33041,
-33795,
-34593,
-34856,
-34574,
-33502,
-32736,
-31997,
-32026,
-31533,
-30341,
-27948,
-24734,
-21792,
-19705,
-18846,
-18821,
-18401,
-17449,
-15565,
-13551,
-11955,
-11313,
-11336,
-11755,
-11824,
-11821,
-11580,
-12177,
-13306,
-15146,
-17093,
-18756,
-20172,
-21637,
-23604,
-26509,
-30227,
-34461,
-38844,
-43054,
-47173,
-51269,
-55482,
-59905,
-64498,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-61725,
-57761,
-53817,
-49456,
-44868,
-39710,
-35057,
-30450,
-26330,
-22123,
-18023,
-13729,
-9761,
-6154,
-3116,
-550,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-683,
-2563,
-4093,
-5687,
-6973,
-8121,
-8923,
-9474,
-9740,
-9742,
-9474,
-8920,
-8014,
-6839,
-5487,
-4072,
-2850,
-1701,
-638,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-2,
-65535,
-4,
-1452,
-4139,
-7703,
-11622,
-15213,
-18289,
-21237,
-24691,
-29675,
-35633,
-42655,
-49122,
-55192,
-60262,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65531,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65334,
-64629,
-62920,
-60064,
-57052,
-53994,
-51960,
-50315,
-49191,
-48147,
-46906,
-45736,
-44689,
-43920,
-43605,
-43498,
-43428,
-42899,
-41880,
-40017,
-37674,
-34988,
-32356,
-29764,
-27127,
-23585,
-19286,
-13683,
-7637,
-1479,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-2,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-65535,
-2,
-65535,
-3,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-194,
-12046,
-23581,
-33421,
-41522,
-48970,
-56562,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65531,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65532,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-58140,
-48366,
-39180,
-31334,
-24848,
-18821,
-12665,
-5819,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-2,
-65535,
-4,
-65535,
-3,
-65535,
-0,
-65535,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-2,
-65535,
-2,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-65535,
-3827,
-9231,
-15278,
-21922,
-28701,
-35300,
-41638,
-47923,
-54441,
-61413,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65137,
-59088,
-53732,
-48986,
-45293,
-41767,
-39045,
-36032,
-33772,
-31425,
-29565,
-28035,
-26730,
-25932,
-25488,
-25201,
-25334,
-25267,
-25312,
-25289,
-25135,
-25265,
-25448,
-25684,
-25958,
-25818,
-25757,
-25552,
-25692,
-25750,
-25782,
-25218,
-23921,
-22184,
-20066,
-18242,
-16588,
-15032,
-13110,
-10801,
-7859,
-4934,
-2120,
-1,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-1300,
-5269,
-9539,
-13928,
-18378,
-22897,
-27595,
-32419,
-37252,
-42078,
-46972,
-51917,
-57181,
-62081,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65533,
-64386,
-60747,
-57388,
-54811,
-52469,
-50560,
-48083,
-45511,
-42610,
-40219,
-38401,
-37694,
-37582,
-37892,
-38203,
-38335,
-38624,
-39021,
-39888,
-41013,
-42391,
-43627,
-44739,
-45576,
-46112,
-46462,
-46688,
-46640,
-46377,
-45622,
-43982,
-41904,
-38975,
-36235,
-33436,
-31230,
-28740,
-26158,
-22738,
-18869,
-14855,
-10872,
-7457,
-4118,
-788,
-2,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-3,
-65535,
-4,
-65535,
-2,
-65535,
-65535,
-2,
-65535,
-2,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-3,
-65535,
-3,
-170,
-7437,
-16896,
-28522,
-41259,
-52778,
-62146,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65532,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-61614,
-55348,
-49142,
-44117,
-40506,
-37871,
-35920,
-34661,
-33923,
-34222,
-34807,
-36060,
-37157,
-38448,
-39909,
-41279,
-42813,
-43979,
-45139,
-46373,
-48062,
-49939,
-51848,
-52754,
-51891,
-49433,
-45578,
-41878,
-38892,
-36692,
-34399,
-30887,
-25849,
-19857,
-14175,
-9782,
-6707,
-4426,
-1631,
-2,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-572,
-3626,
-5753,
-8037,
-10515,
-13616,
-16964,
-20766,
-24629,
-29229,
-33865,
-38775,
-43122,
-47193,
-51095,
-55347,
-59884,
-64320,
-65533,
-65534,
-65534,
-65532,
-65534,
-65534,
-65531,
-65534,
-65531,
-65534,
-65534,
-65534,
-64074,
-62656,
-61214,
-58493,
-55301,
-51714,
-49056,
-47615,
-47174,
-47416,
-47351,
-47107,
-46706,
-46600,
-47324,
-48419,
-49826,
-50831,
-51557,
-51802,
-52224,
-52776,
-53553,
-54681,
-55280,
-55767,
-55213,
-54373,
-52687,
-51182,
-49500,
-48433,
-47664,
-47104,
-46332,
-44937,
-42607,
-39957,
-36847,
-34396,
-31866,
-29498,
-26509,
-22851,
-18824,
-15010,
-11625,
-8742,
-5689,
-2231,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-0,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-65535,
-1,
-390,
-2347,
-4177,
-5867,
-7635,
-9386,
-11070,
-12642,
-14281,
-16053,
-18047,
-20173,
-22121,
-23808,
-25308,
-26777,
-28654,
-30738,
-33044,
-35275,
-37299,
-38995,
-40931,
-42718,
-45004,
-47217,
-49499,
-51402,
-53045,
-54347,
-55791,
-57252,
-59241,
-61175,
-63516,
-65534,
-65533,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-64981,
-62545,
-60506,
-58582,
-57050,
-55458,
-53884,
-52288,
-50542,
-48766,
-47352,
-45998,
-45423,
-44693,
-44249,
-43319,
-42168,
-41192,
-40152,
-39775,
-39088,
-38381,
-37072,
-35590,
-34413,
-33397,
-33042,
-32354,
-31449,
-30004,
-28151,
-26304,
-24340,
-22475,
-20351,
-18002,
-15322,
-12221,
-9121,
-5665,
-2409,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-3,
-65535,
-4,
-65535,
-1,
-65535,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-286,
-523,
-508,
-544,
-420,
-65535,
-2,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-0,
-0,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-65535,
-1,
-65535,
-4,
-65535,
-2,
-65535,
-1,
-6838,
-13594,
-20951,
-29583,
-39268,
-48876,
-57165,
-63761,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-62612,
-59641,
-56900,
-53858,
-49813,
-45730,
-43365,
-43740,
-46928,
-51184,
-54790,
-56545,
-57403,
-58383,
-61104,
-65048,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65530,
-65534,
-65533,
-65534,
-65534,
-65534,
-65533,
-65534,
-62055,
-52758,
-43072,
-33288,
-22940,
-12554,
-2188,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-1,
-65535,
-2,
-65535,
-6642,
-13770,
-19333,
-23627,
-26596,
-29033,
-31137,
-32620,
-33288,
-32374,
-30585,
-27836,
-24934,
-21792,
-18111,
-13950,
-9408,
-4712,
-814,
-0,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-65535,
-5821,
-12905,
-20863,
-29561,
-39026,
-48875,
-58892,
-65533,
-65534,
-65532,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65380,
-64361,
-63630,
-62655,
-61682,
-60019,
-58137,
-55634,
-53131,
-50186,
-47261,
-43740,
-40174,
-36253,
-32644,
-29142,
-25822,
-22343,
-18334,
-13752,
-8763,
-3541,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-3,
-65535,
-4,
-65535,
-1,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-1679,
-6284,
-10429,
-14058,
-17029,
-19529,
-21658,
-23561,
-25268,
-26485,
-27284,
-27237,
-26841,
-25843,
-24912,
-24139,
-23472,
-23208,
-22942,
-23118,
-23672,
-24626,
-26108,
-27948,
-29808,
-32044,
-34460,
-37405,
-41016,
-44936,
-49187,
-53311,
-57292,
-60888,
-64711,
-65534,
-65531,
-65534,
-65532,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-61791,
-54771,
-48081,
-42056,
-36786,
-31911,
-27240,
-22674,
-18225,
-14325,
-11468,
-9697,
-9407,
-9941,
-11157,
-12865,
-14678,
-17052,
-19484,
-22191,
-24711,
-26621,
-28011,
-28659,
-29119,
-29345,
-29451,
-29235,
-28453,
-26954,
-24822,
-22234,
-19619,
-16761,
-14016,
-10981,
-8101,
-5155,
-2499,
-82,
-0,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-65535,
-85,
-2053,
-4137,
-5821,
-7303,
-8479,
-9607,
-10870,
-11912,
-13195,
-13972,
-14767,
-15280,
-15586,
-15833,
-15699,
-15232,
-14461,
-13392,
-12599,
-11735,
-11157,
-10429,
-9516,
-8502,
-7370,
-6219,
-5089,
-3738,
-2298,
-705,
-65535,
-1,
-65535,
-3,
-65535,
-3,
-65535,
-2,
-65535,
-2,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-4536,
-10737,
-16983,
-23275,
-28788,
-33286,
-37028,
-40285,
-43917,
-47528,
-50715,
-52071,
-50780,
-46999,
-41368,
-35545,
-30008,
-25067,
-19664,
-13394,
-6243,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-351,
-10314,
-20486,
-29827,
-38359,
-46819,
-56187,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65531,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65533,
-65534,
-65533,
-65534,
-65532,
-65534,
-65533,
-65534,
-65533,
-65534,
-65531,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65531,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-56277,
-46441,
-35945,
-25110,
-13553,
-1741,
-4,
-65535,
-3,
-65535,
-1,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-3,
-65535,
-4,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-5598,
-13574,
-20547,
-26244,
-30627,
-34059,
-36743,
-39153,
-41082,
-42280,
-42165,
-40663,
-37780,
-34084,
-29984,
-25734,
-21545,
-17382,
-13529,
-10027,
-7040,
-4468,
-1855,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-2,
-65535,
-2,
-65535,
-1,
-1633,
-5510,
-9653,
-14080,
-18935,
-24468,
-30340,
-36675,
-42785,
-49016,
-54765,
-60378,
-65533,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-62874,
-57608,
-52687,
-48081,
-43897,
-40038,
-36522,
-33527,
-31337,
-29808,
-29364,
-29699,
-31024,
-33464,
-36873,
-41281,
-46332,
-51558,
-57073,
-62524,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65533,
-65534,
-64029,
-58688,
-52781,
-46638,
-40242,
-34348,
-28833,
-24072,
-19994,
-16321,
-13504,
-10916,
-9120,
-7746,
-6642,
-6194,
-5799,
-6153,
-7102,
-8837,
-11308,
-14219,
-17291,
-20306,
-23297,
-26373,
-29633,
-33084,
-36300,
-39440,
-41816,
-43870,
-45447,
-46353,
-46775,
-46043,
-44161,
-41347,
-37627,
-33729,
-29519,
-24958,
-19862,
-13927,
-7659,
-1168,
-65535,
-0,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-65535,
-65535,
-1,
-65535,
-4581,
-11623,
-19530,
-27351,
-35564,
-43410,
-51070,
-57938,
-63697,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65531,
-65534,
-65530,
-65534,
-65531,
-65027,
-61703,
-58424,
-55481,
-52620,
-50231,
-47747,
-45868,
-44116,
-42743,
-41503,
-40018,
-38470,
-37004,
-35592,
-34944,
-34261,
-33994,
-33373,
-32889,
-32397,
-32357,
-32796,
-33442,
-34282,
-34969,
-35831,
-36699,
-37778,
-39071,
-40479,
-41884,
-43293,
-44451,
-45466,
-46221,
-46731,
-47039,
-47196,
-47084,
-46951,
-46134,
-45199,
-43388,
-41347,
-38733,
-36056,
-33084,
-30141,
-27173,
-24335,
-21770,
-19640,
-17891,
-16674,
-15499,
-14657,
-13442,
-12928,
-12333,
-12530,
-12775,
-13153,
-13218,
-12819,
-11932,
-10739,
-9273,
-7507,
-5219,
-2123,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-3,
-65535,
-1,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-0,
-65535,
-2,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-2564,
-15255,
-26953,
-38155,
-48836,
-59288,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-64490,
-59271,
-53438,
-46511,
-38822,
-31269,
-24958,
-20483,
-17381,
-15369,
-13724,
-13310,
-15009,
-20043,
-28587,
-39843,
-52378,
-64848,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-64895,
-54480,
-44671,
-34571,
-24180,
-14461,
-6415,
-529,
-65535,
-0,
-65535,
-65535,
-65535,
-1,
-65535,
-1,
-1942,
-7483,
-13261,
-19243,
-25733,
-32576,
-39798,
-46818,
-53530,
-59112,
-63385,
-65534,
-65531,
-65534,
-65532,
-63742,
-58780,
-52244,
-44715,
-36984,
-28412,
-19177,
-8368,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-0,
-3251,
-13926,
-23807,
-33039,
-41173,
-47769,
-52802,
-55831,
-57629,
-58380,
-58602,
-58292,
-57253,
-54900,
-51673,
-47368,
-43257,
-39018,
-35593,
-32373,
-29966,
-28433,
-28148,
-29408,
-31647,
-34481,
-37561,
-40550,
-43961,
-47639,
-51735,
-55878,
-59909,
-63984,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65531,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-63498,
-58932,
-54331,
-50160,
-46179,
-42562,
-39270,
-36449,
-34219,
-32685,
-31868,
-32024,
-32620,
-34083,
-35855,
-38046,
-40464,
-42763,
-45248,
-47349,
-49565,
-51339,
-53151,
-54440,
-55345,
-55502,
-54924,
-53223,
-50580,
-46601,
-41832,
-36078,
-30139,
-24293,
-18734,
-14102,
-9943,
-6614,
-3453,
-900,
-2,
-65535,
-2,
-65535,
-2,
-1077,
-4184,
-8364,
-13154,
-18710,
-24405,
-30138,
-35281,
-40061,
-44162,
-47904,
-50827,
-53088,
-54260,
-54394,
-53486,
-51580,
-48769,
-45023,
-40618,
-35787,
-30895,
-26130,
-21391,
-16785,
-12463,
-8746,
-5885,
-4049,
-2896,
-2519,
-2544,
-3381,
-5269,
-8055,
-11735,
-15521,
-19287,
-22853,
-26486,
-30471,
-34705,
-39130,
-43189,
-46883,
-49898,
-52423,
-54526,
-56056,
-57249,
-57917,
-58269,
-58027,
-57185,
-55433,
-52778,
-49521,
-45732,
-41704,
-37404,
-32931,
-28280,
-23982,
-19774,
-16099,
-12286,
-8346,
-4403,
-613,
-1,
-65535,
-65535,
-0,
-65535,
-1990,
-5398,
-9919,
-14943,
-20641,
-26394,
-32380,
-38755,
-45268,
-51758,
-57672,
-62656,
-65534,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65532,
-64298,
-60171,
-55903,
-51268,
-46623,
-42164,
-38316,
-35475,
-33665,
-32929,
-32977,
-33771,
-35126,
-37048,
-39755,
-43074,
-47107,
-51471,
-55810,
-60043,
-63851,
-65534,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-61176,
-56006,
-50587,
-45112,
-39686,
-34350,
-29209,
-24049,
-19177,
-14391,
-9830,
-5575,
-1945,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-1,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-9805,
-21948,
-31399,
-38006,
-41303,
-41746,
-40151,
-36476,
-31402,
-25001,
-17828,
-10357,
-3076,
-65535,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-1,
-65535,
-2654,
-16342,
-31556,
-46821,
-62364,
-65534,
-65531,
-65534,
-65533,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65532,
-65534,
-65529,
-65534,
-65529,
-65534,
-65533,
-65534,
-65534,
-65532,
-65534,
-65532,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-63433,
-58688,
-52314,
-44934,
-36853,
-29208,
-22080,
-14634,
-6109,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-260,
-8943,
-17051,
-24071,
-30427,
-35634,
-39088,
-40373,
-39268,
-36405,
-32536,
-28077,
-23386,
-18025,
-12175,
-5667,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-1,
-65535,
-8391,
-18046,
-27681,
-37339,
-46642,
-55722,
-64450,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65531,
-65534,
-65534,
-65534,
-65534,
-65534,
-65357,
-62768,
-60550,
-58624,
-56876,
-55544,
-54550,
-53817,
-53153,
-52491,
-51711,
-51163,
-50581,
-50342,
-50052,
-49676,
-49144,
-48259,
-47593,
-46797,
-46664,
-46928,
-47861,
-49254,
-50762,
-52178,
-53177,
-53617,
-53554,
-53062,
-52092,
-50915,
-49125,
-47192,
-44385,
-41256,
-37009,
-32022,
-25755,
-18445,
-10228,
-1346,
-65535,
-1,
-65535,
-65535,
-1,
-65535,
-3,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-4004,
-8633,
-12331,
-14814,
-16428,
-17097,
-17091,
-16123,
-14521,
-12003,
-8940,
-5646,
-2119,
-1,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-65535,
-65535,
-3338,
-8436,
-14192,
-19972,
-26333,
-32685,
-39422,
-46000,
-52442,
-58450,
-64004,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-63852,
-60973,
-58179,
-55704,
-53261,
-51406,
-49563,
-47905,
-46354,
-44670,
-43562,
-42590,
-42364,
-42457,
-42898,
-43384,
-43809,
-43914,
-43876,
-43117,
-42192,
-40369,
-38561,
-36228,
-34197,
-32175,
-30496,
-28787,
-26997,
-25200,
-23429,
-21812,
-20482,
-19399,
-18777,
-18711,
-19486,
-21369,
-24226,
-28082,
-32154,
-36697,
-40949,
-45600,
-49876,
-54195,
-57847,
-60931,
-63516,
-65471,
-65534,
-65534,
-65534,
-65532,
-65534,
-64470,
-61993,
-59287,
-56101,
-52554,
-48502,
-44671,
-40572,
-37184,
-33772,
-30917,
-28431,
-26312,
-25110,
-24338,
-24515,
-25000,
-25976,
-27084,
-28346,
-29808,
-31248,
-32554,
-33573,
-33884,
-33905,
-33065,
-32177,
-30782,
-29079,
-26948,
-24428,
-21412,
-18335,
-14746,
-11091,
-7084,
-3139,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-65535,
-2,
-65535,
-3,
-65535,
-2,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-1,
-65535,
-1,
-65535,
-2,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-370,
-6863,
-13350,
-19332,
-24426,
-28655,
-32466,
-35324,
-36762,
-35922,
-33218,
-29079,
-25397,
-22081,
-19328,
-16367,
-13082,
-10407,
-9319,
-10139,
-12621,
-15365,
-18402,
-22188,
-28236,
-37028,
-48436,
-61038,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65533,
-65534,
-65530,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-63875,
-61193,
-58005,
-54504,
-50184,
-45093,
-39065,
-32511,
-25378,
-18222,
-10873,
-3713,
-1,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-0,
-65535,
-2,
-65535,
-3,
-65535,
-65535,
-2,
-65535,
-1,
-65535,
-1701,
-3693,
-4736,
-4533,
-3032,
-503,
-65535,
-0,
-65535,
-0,
-0,
-65535,
-3,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-0,
-65535,
-1,
-65535,
-0,
-9076,
-20151,
-30760,
-40262,
-48370,
-55168,
-60176,
-63541,
-65534,
-65534,
-65534,
-65533,
-65534,
-65135,
-63630,
-61416,
-58291,
-54506,
-50383,
-46421,
-43053,
-40594,
-39268,
-39263,
-40286,
-42565,
-45401,
-49168,
-53153,
-57737,
-62325,
-65533,
-65534,
-65532,
-65534,
-65531,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65531,
-65534,
-65530,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65533,
-65183,
-62476,
-59866,
-57539,
-55323,
-53509,
-51802,
-50451,
-48857,
-47327,
-45712,
-44272,
-43296,
-42656,
-42697,
-42613,
-43029,
-42832,
-42855,
-42454,
-41813,
-40619,
-38797,
-36345,
-33506,
-30492,
-27420,
-24244,
-20709,
-16625,
-11626,
-6217,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-0,
-65535,
-1,
-65535,
-2,
-65535,
-2,
-3050,
-7901,
-12180,
-15939,
-19135,
-21765,
-23586,
-25044,
-25778,
-26308,
-26684,
-26975,
-27635,
-28413,
-29632,
-31112,
-32713,
-34943,
-37341,
-40904,
-44714,
-49278,
-53994,
-58891,
-63940,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65531,
-65534,
-65534,
-65534,
-65534,
-65531,
-65534,
-64468,
-59978,
-55433,
-50585,
-46044,
-42055,
-38359,
-35787,
-33264,
-31624,
-30406,
-29963,
-30117,
-30541,
-31023,
-31207,
-31178,
-30984,
-30692,
-30296,
-29475,
-28325,
-26728,
-24848,
-22762,
-20130,
-16961,
-13262,
-8811,
-4469,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-1,
-65535,
-2,
-65535,
-2,
-65535,
-1,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-3,
-65535,
-0,
-284,
-678,
-664,
-566,
-486,
-191,
-1,
-65535,
-0,
-65535,
-2,
-65535,
-3653,
-8831,
-15232,
-22945,
-31332,
-39314,
-46151,
-51206,
-54992,
-58135,
-60665,
-62498,
-63166,
-62035,
-60064,
-56808,
-52910,
-47417,
-39774,
-30363,
-19728,
-9676,
-880,
-65535,
-0,
-65535,
-1,
-65535,
-1,
-65535,
-2,
-65535,
-3,
-3756,
-13288,
-24689,
-37163,
-49564,
-61106,
-65534,
-65534,
-65532,
-65534,
-65532,
-65534,
-65534,
-65533,
-65534,
-65532,
-60620,
-53883,
-46510,
-38822,
-30871,
-22742,
-14990,
-7879,
-2456,
-65535,
-0,
-2187,
-8079,
-15721,
-25003,
-34812,
-44826,
-54638,
-63783,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-62193,
-57447,
-53400,
-50073,
-46952,
-44338,
-41658,
-39331,
-37142,
-35607,
-35283,
-36515,
-39624,
-43980,
-48926,
-53483,
-57164,
-59952,
-62369,
-64515,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-62368,
-56298,
-49301,
-41811,
-33197,
-24427,
-15254,
-6553,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-1,
-3581,
-11759,
-18973,
-26312,
-33393,
-40088,
-46129,
-50477,
-52884,
-53068,
-51002,
-47086,
-41037,
-33596,
-24824,
-15876,
-7481,
-283,
-65535,
-1,
-65535,
-65535,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-5802,
-15761,
-26755,
-37735,
-48746,
-58781,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-62214,
-55810,
-50120,
-45356,
-41947,
-39951,
-39289,
-39553,
-40595,
-42145,
-44404,
-47151,
-50607,
-54216,
-58337,
-62477,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-63338,
-58562,
-53771,
-48503,
-43276,
-38022,
-33090,
-28852,
-25048,
-22099,
-19376,
-17204,
-15345,
-13816,
-12841,
-12267,
-12219,
-12489,
-13238,
-14306,
-15741,
-17583,
-19617,
-21548,
-23229,
-24337,
-24869,
-24956,
-24294,
-23362,
-21701,
-19862,
-17628,
-15276,
-13152,
-10849,
-8675,
-6133,
-3027,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-4294,
-8941,
-13862,
-18533,
-23362,
-28192,
-32886,
-37428,
-41413,
-44849,
-47503,
-49414,
-50469,
-50919,
-50428,
-49388,
-47617,
-45378,
-42854,
-39975,
-37339,
-34458,
-32024,
-29563,
-27595,
-25953,
-25001,
-24736,
-25533,
-27350,
-30294,
-34373,
-39350,
-44920,
-51021,
-56812,
-62809,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65531,
-65534,
-65531,
-65534,
-65531,
-63921,
-60948,
-58516,
-55919,
-54087,
-52485,
-51673,
-51224,
-51338,
-51493,
-51514,
-51181,
-50387,
-49406,
-48130,
-47415,
-46663,
-46908,
-47106,
-47970,
-48482,
-48877,
-48546,
-47728,
-46064,
-43830,
-40860,
-37649,
-34016,
-30473,
-26750,
-23187,
-19684,
-16298,
-13018,
-9873,
-6663,
-3470,
-241,
-65535,
-0,
-65535,
-1,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-65535,
-3,
-65535,
-3,
-65535,
-1,
-65535,
-1,
-65535,
-3,
-65535,
-6,
-65535,
-3,
-65535,
-0,
-65535,
-2,
-65535,
-2,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-1,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-0,
-83,
-5466,
-11445,
-18048,
-24778,
-31715,
-38024,
-44073,
-49009,
-53223,
-56118,
-58008,
-58665,
-58360,
-57029,
-55037,
-52001,
-48546,
-44228,
-39486,
-34639,
-29938,
-25999,
-23098,
-21588,
-21506,
-22893,
-25448,
-29450,
-34241,
-40216,
-46908,
-54505,
-62720,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65531,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-62898,
-59334,
-56630,
-55124,
-54949,
-56276,
-59156,
-63364,
-65534,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-64757,
-57807,
-50538,
-43364,
-36497,
-30075,
-24444,
-19492,
-15427,
-11872,
-9028,
-6331,
-4115,
-1876,
-1,
-65535,
-65535,
-1,
-65535,
-461,
-2985,
-5598,
-8346,
-10980,
-13085,
-14858,
-15697,
-15746,
-15053,
-13774,
-12198,
-10294,
-7882,
-5087,
-1547,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-3,
-65535,
-2,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-3383,
-10561,
-17183,
-22940,
-27507,
-30979,
-33089,
-34257,
-34173,
-33174,
-31160,
-28478,
-25025,
-21278,
-17030,
-12773,
-8502,
-4601,
-1457,
-65535,
-65535,
-65535,
-2543,
-6859,
-12423,
-19240,
-26865,
-35077,
-43653,
-52267,
-60971,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65531,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-61104,
-56278,
-51379,
-46001,
-40905,
-35521,
-30341,
-25155,
-20130,
-15498,
-11159,
-7370,
-3872,
-658,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-1,
-147,
-307,
-65535,
-2,
-65535,
-2,
-65535,
-3,
-65535,
-1,
-65535,
-65535,
-2,
-65535,
-0,
-1,
-65535,
-3,
-65535,
-3,
-65535,
-3,
-65535,
-2,
-65535,
-3165,
-9872,
-16673,
-23186,
-29452,
-35059,
-40018,
-44028,
-47195,
-49366,
-50628,
-51228,
-51157,
-50787,
-50226,
-49480,
-48987,
-48414,
-48059,
-47727,
-47682,
-47860,
-48568,
-49742,
-51561,
-53948,
-56831,
-60265,
-64025,
-65534,
-65529,
-65534,
-65530,
-65534,
-65529,
-65534,
-65529,
-65534,
-65531,
-65534,
-65531,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65532,
-65534,
-65532,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65178,
-64675,
-63471,
-62459,
-60506,
-58180,
-55038,
-51336,
-47350,
-43033,
-38821,
-34260,
-29787,
-24999,
-20553,
-16161,
-12688,
-9563,
-7347,
-5468,
-4134,
-2899,
-2008,
-1037,
-83,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-1504,
-4422,
-7240,
-10003,
-12601,
-15430,
-17828,
-20259,
-22190,
-24004,
-25444,
-26753,
-27789,
-28638,
-29295,
-29899,
-30604,
-31514,
-32753,
-34106,
-35743,
-37384,
-39066,
-40484,
-41901,
-43099,
-44159,
-45248,
-46174,
-47286,
-48080,
-49034,
-49366,
-49897,
-49654,
-49255,
-48258,
-46753,
-45001,
-42790,
-40724,
-38361,
-36339,
-34417,
-32776,
-31622,
-30431,
-29650,
-28548,
-27348,
-25732,
-23851,
-21589,
-19177,
-16364,
-13415,
-10143,
-6569,
-2966,
-65535,
-0,
-0,
-65535,
-3,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-65535,
-65535,
-0,
-305,
-7769,
-15146,
-21832,
-27816,
-32620,
-36432,
-38622,
-39289,
-38179,
-35701,
-31889,
-27284,
-21744,
-15656,
-9142,
-2497,
-0,
-65535,
-0,
-65535,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-1523,
-9166,
-17248,
-26086,
-34994,
-43868,
-52251,
-59750,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-64848,
-61815,
-59043,
-56567,
-54768,
-53133,
-52467,
-52242,
-53225,
-54676,
-57255,
-60241,
-63782,
-65534,
-65530,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-63875,
-58026,
-52688,
-47262,
-42389,
-38002,
-34062,
-31157,
-28636,
-26927,
-25556,
-24801,
-24560,
-24955,
-25801,
-27192,
-28658,
-30294,
-31869,
-33262,
-34415,
-35147,
-35123,
-34680,
-33244,
-31199,
-28394,
-24713,
-20659,
-15833,
-11134,
-5977,
-1058,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-2986,
-6816,
-10449,
-13617,
-16407,
-18446,
-20018,
-21102,
-21592,
-21744,
-21303,
-20572,
-19796,
-18866,
-18247,
-17624,
-17450,
-17492,
-18114,
-19198,
-20947,
-23010,
-25731,
-28569,
-31977,
-35502,
-39286,
-43056,
-46772,
-50341,
-53553,
-56629,
-58982,
-61146,
-62414,
-63407,
-63764,
-63873,
-63675,
-63275,
-62700,
-62102,
-61460,
-60793,
-60067,
-59264,
-58448,
-57805,
-57361,
-57208,
-57162,
-57228,
-57275,
-57359,
-57741,
-58157,
-58803,
-59267,
-59597,
-59755,
-59909,
-60130,
-60375,
-60572,
-60264,
-59665,
-58558,
-57141,
-55654,
-53888,
-52086,
-49924,
-47390,
-44608,
-41366,
-38295,
-34854,
-31827,
-28499,
-25578,
-22565,
-19906,
-17717,
-15762,
-14727,
-13924,
-13818,
-14037,
-14658,
-15588,
-16806,
-18312,
-19841,
-21369,
-22831,
-24227,
-25487,
-26709,
-27568,
-28327,
-28498,
-28415,
-27902,
-27061,
-25976,
-24581,
-22941,
-21348,
-19574,
-18268,
-17050,
-16518,
-16165,
-16407,
-16917,
-17869,
-19332,
-21168,
-23454,
-25995,
-28614,
-31358,
-34193,
-36984,
-39954,
-42541,
-45027,
-46796,
-48080,
-48659,
-48766,
-48436,
-47706,
-46529,
-45181,
-43385,
-41569,
-39577,
-37625,
-35724,
-33948,
-32113,
-30582,
-29143,
-27971,
-27170,
-26578,
-26480,
-26601,
-27035,
-27574,
-28279,
-28810,
-29500,
-29805,
-30187,
-30382,
-30562,
-30716,
-30827,
-30737,
-30408,
-30070,
-29259,
-28651,
-27776,
-26990,
-25934,
-24668,
-23363,
-21791,
-20769,
-19754,
-19395,
-19379,
-19726,
-20663,
-21855,
-23740,
-26041,
-28724,
-31467,
-34374,
-36715,
-39202,
-41124,
-42878,
-44359,
-45491,
-46484,
-47154,
-47634,
-47953,
-48077,
-48084,
-47969,
-47528,
-47106,
-46487,
-46065,
-45623,
-45512,
-45644,
-46133,
-46884,
-48039,
-49185,
-50588,
-51688,
-53090,
-54325,
-55924,
-57692,
-59578,
-61835,
-63919,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-64849,
-63142,
-61083,
-58958,
-57005,
-55083,
-53617,
-51957,
-50364,
-48544,
-46268,
-43892,
-41150,
-38291,
-35699,
-32954,
-30759,
-28701,
-26862,
-25269,
-23514,
-21815,
-19639,
-17273,
-14435,
-11337,
-8188,
-5224,
-2474,
-172,
-1,
-65535,
-2,
-65535,
-4,
-65535,
-4,
-65535,
-3,
-65535,
-1,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-65535,
-1,
-65535,
-3,
-65535,
-2,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-1,
-65535,
-3,
-65535,
-2,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-1279,
-6042,
-9762,
-12199,
-13396,
-13461,
-12288,
-10339,
-7613,
-4537,
-1300,
-0,
-65535,
-65535,
-1,
-65535,
-3,
-65535,
-0,
-65535,
-65535,
-2,
-65535,
-1,
-65535,
-639,
-5753,
-10715,
-15610,
-20328,
-25201,
-29631,
-34170,
-38448,
-42697,
-46887,
-50473,
-53440,
-55393,
-56627,
-57211,
-57492,
-57695,
-57672,
-57959,
-58182,
-59112,
-60173,
-61616,
-62876,
-63963,
-64760,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-64205,
-60708,
-56672,
-52227,
-47170,
-42059,
-36672,
-31493,
-26595,
-21968,
-17757,
-13796,
-10292,
-7196,
-4688,
-2677,
-1078,
-63,
-65535,
-0,
-150,
-1034,
-1813,
-2408,
-2520,
-2366,
-1808,
-973,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-3,
-65535,
-1,
-65535,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-0,
-4911,
-10029,
-14946,
-19995,
-24537,
-28900,
-32708,
-36034,
-38976,
-41016,
-42677,
-43363,
-43629,
-43165,
-42475,
-41373,
-40193,
-38803,
-37315,
-36121,
-34969,
-34259,
-34129,
-34413,
-35613,
-37270,
-39821,
-43008,
-46798,
-51114,
-55702,
-60616,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-64206,
-62500,
-60530,
-58667,
-56367,
-53905,
-51138,
-47993,
-44958,
-41681,
-38577,
-35280,
-31867,
-28435,
-24759,
-21323,
-17826,
-14657,
-11446,
-8656,
-5886,
-3694,
-1744,
-394,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-1,
-65535,
-664,
-1386,
-2280,
-3093,
-3916,
-4691,
-5177,
-5289,
-5089,
-4513,
-3783,
-2852,
-1811,
-769,
-0,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-16,
-1990,
-4047,
-6353,
-8831,
-11379,
-13973,
-16339,
-18271,
-19992,
-21240,
-22295,
-23433,
-24223,
-25203,
-25820,
-26685,
-27505,
-28544,
-29477,
-30471,
-31315,
-32045,
-33107,
-34173,
-35875,
-37628,
-39531,
-41525,
-43474,
-45490,
-47660,
-49720,
-51870,
-53772,
-55481,
-57027,
-58671,
-60283,
-62348,
-64337,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65531,
-65534,
-65532,
-65534,
-65534,
-64384,
-61480,
-58361,
-54877,
-51408,
-47790,
-44252,
-40880,
-37761,
-35013,
-32820,
-30937,
-29454,
-28213,
-26884,
-25689,
-24336,
-22897,
-21680,
-20128,
-18666,
-16941,
-15076,
-12888,
-10581,
-7858,
-4889,
-1569,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-1,
-65535,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-2,
-65535,
-4,
-65535,
-132,
-1010,
-1460,
-1764,
-1901,
-2320,
-2697,
-3717,
-4534,
-5821,
-6573,
-7303,
-7483,
-7458,
-7150,
-6749,
-6464,
-6416,
-7130,
-8430,
-10785,
-13725,
-17494,
-21457,
-25776,
-30009,
-34170,
-37894,
-41080,
-43630,
-45335,
-46530,
-46798,
-46573,
-45447,
-43740,
-41479,
-39068,
-36562,
-34393,
-32158,
-30358,
-28615,
-27215,
-26241,
-25580,
-25463,
-25648,
-26128,
-26930,
-27836,
-28856,
-30051,
-31271,
-32797,
-34548,
-36563,
-38714,
-41168,
-43322,
-45840,
-47863,
-49896,
-51449,
-52510,
-53021,
-53042,
-52667,
-52288,
-51716,
-51357,
-50963,
-50892,
-51094,
-51670,
-52621,
-53797,
-55234,
-56498,
-57938,
-59201,
-60683,
-62125,
-63828,
-65513,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65314,
-63319,
-61328,
-59509,
-57651,
-55920,
-53886,
-51757,
-49233,
-46420,
-43319,
-40218,
-36962,
-34018,
-31244,
-28794,
-26524,
-24409,
-22140,
-19933,
-17445,
-14927,
-12418,
-10074,
-7880,
-6284,
-4958,
-4534,
-4315,
-4734,
-5178,
-5399,
-5333,
-4711,
-3741,
-2362,
-773,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-1,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-2,
-65535,
-2,
-65535,
-0,
-65535,
-903,
-4800,
-8945,
-12950,
-17052,
-21080,
-24691,
-28016,
-30402,
-32403,
-33682,
-34593,
-35191,
-35676,
-35966,
-36342,
-36829,
-37228,
-37916,
-38289,
-38957,
-39619,
-40617,
-42191,
-43893,
-46111,
-48457,
-51138,
-54194,
-57740,
-61435,
-65382,
-65533,
-65534,
-65532,
-65534,
-65531,
-65534,
-65531,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65531,
-65534,
-65532,
-65534,
-65534,
-65533,
-65492,
-63807,
-62079,
-60109,
-58137,
-55832,
-53709,
-51181,
-48990,
-46596,
-44516,
-42299,
-40220,
-37781,
-35300,
-32467,
-29697,
-26772,
-24163,
-21564,
-19513,
-17555,
-16301,
-15185,
-14506,
-13947,
-13263,
-12487,
-11468,
-10272,
-9277,
-8319,
-7974,
-7719,
-7997,
-8384,
-8881,
-9338,
-9566,
-9561,
-9123,
-8520,
-7528,
-6703,
-5645,
-4956,
-4290,
-4185,
-4265,
-4672,
-5020,
-5379,
-5576,
-6041,
-6928,
-8433,
-10627,
-13506,
-16607,
-20083,
-23343,
-26703,
-29502,
-32086,
-34107,
-35655,
-37249,
-38581,
-40238,
-42192,
-44336,
-46753,
-49189,
-51424,
-53466,
-54923,
-55858,
-56363,
-56454,
-56543,
-56652,
-57053,
-57627,
-58202,
-58870,
-59022,
-59466,
-59268,
-59286,
-58959,
-58579,
-58226,
-58070,
-58580,
-59401,
-60815,
-62105,
-63183,
-63810,
-63872,
-63698,
-63253,
-62811,
-62255,
-61794,
-61368,
-61241,
-61213,
-61240,
-61059,
-60420,
-59066,
-57230,
-54814,
-52511,
-50031,
-48125,
-46353,
-45070,
-44204,
-43497,
-43031,
-42454,
-41638,
-40791,
-39557,
-38753,
-37717,
-37183,
-36409,
-35832,
-35081,
-34257,
-33288,
-31954,
-30275,
-28191,
-25488,
-22786,
-19842,
-17336,
-14904,
-12883,
-11050,
-9494,
-8126,
-6838,
-5842,
-4891,
-4157,
-3696,
-3515,
-3782,
-4671,
-5551,
-7019,
-7944,
-8900,
-9320,
-9519,
-9341,
-9033,
-8476,
-8060,
-7567,
-7528,
-7591,
-7923,
-8237,
-8298,
-7993,
-7236,
-5976,
-4557,
-2896,
-1391,
-237,
-1,
-65535,
-65535,
-1,
-65535,
-3,
-65535,
-3,
-65535,
-2,
-65535,
-0,
-65535,
-0,
-65535,
-1,
-989,
-1768,
-2098,
-2167,
-2452,
-2964,
-4068,
-5469,
-6924,
-8503,
-9827,
-10850,
-11422,
-11027,
-9649,
-7242,
-4044,
-552,
-65535,
-1,
-65535,
-2,
-65535,
-2,
-65535,
-1,
-65535,
-0,
-65535,
-0,
-65535,
-1857,
-4201,
-5955,
-7368,
-9101,
-11023,
-13243,
-15430,
-17428,
-19264,
-21014,
-22502,
-24088,
-24853,
-25526,
-25495,
-25462,
-25403,
-25288,
-25179,
-24559,
-23605,
-22079,
-20305,
-18091,
-15965,
-13726,
-12178,
-11447,
-11932,
-13639,
-16608,
-20325,
-24585,
-28607,
-32027,
-34212,
-35038,
-34790,
-33883,
-33288,
-33525,
-35149,
-37758,
-40994,
-43985,
-46195,
-47309,
-47349,
-46553,
-45423,
-44206,
-43428,
-43322,
-44025,
-45779,
-48191,
-51029,
-53705,
-55569,
-56830,
-57007,
-56875,
-56499,
-56717,
-57674,
-60064,
-63429,
-65534,
-65532,
-65534,
-65532,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65531,
-65534,
-65531,
-65534,
-65532,
-65534,
-65534,
-63451,
-61262,
-60018,
-59511,
-59488,
-59555,
-59266,
-58270,
-56277,
-53507,
-50209,
-46772,
-44030,
-42033,
-41548,
-42057,
-43427,
-44896,
-45685,
-45360,
-43560,
-40420,
-36561,
-32491,
-28986,
-26420,
-24891,
-24291,
-24384,
-24778,
-25068,
-24892,
-24025,
-22391,
-20103,
-17539,
-15078,
-13241,
-11999,
-11956,
-12353,
-13597,
-14721,
-15746,
-16161,
-15967,
-15454,
-14702,
-14392,
-14569,
-15588,
-17515,
-20018,
-23075,
-25997,
-28436,
-29784,
-29988,
-29229,
-27773,
-26704,
-25780,
-26040,
-26974,
-28567,
-30583,
-32422,
-34149,
-35411,
-36321,
-36718,
-37006,
-37096,
-37315,
-37849,
-39133,
-41015,
-43852,
-46861,
-50098,
-52643,
-54506,
-55699,
-56234,
-56872,
-57387,
-58400,
-59690,
-61280,
-63100,
-64736,
-65534,
-65534,
-65534,
-65335,
-64118,
-63098,
-62236,
-62011,
-62103,
-62744,
-63763,
-64759,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65136,
-64138,
-63101,
-61788,
-60400,
-58666,
-57008,
-55259,
-53572,
-52069,
-50629,
-49320,
-48283,
-47037,
-46024,
-44624,
-43387,
-41923,
-40749,
-39621,
-38845,
-37848,
-36762,
-35148,
-33061,
-30852,
-28433,
-26286,
-24095,
-21965,
-19754,
-17424,
-15148,
-12950,
-11093,
-9473,
-8236,
-7193,
-6373,
-6088,
-6016,
-6643,
-7346,
-8457,
-9430,
-10494,
-11357,
-11999,
-12488,
-12486,
-12290,
-11775,
-11206,
-10778,
-10563,
-10691,
-10916,
-11202,
-11534,
-11691,
-11954,
-11935,
-12109,
-12333,
-12818,
-13818,
-15032,
-16520,
-18112,
-19598,
-21124,
-22743,
-24492,
-26175,
-27727,
-28810,
-29455,
-29717,
-29899,
-30160,
-30717,
-31448,
-31932,
-32203,
-32263,
-31783,
-31886,
-31561,
-31866,
-32112,
-32621,
-33307,
-34305,
-35545,
-36939,
-38181,
-39264,
-39844,
-40350,
-40617,
-40972,
-41456,
-41882,
-42631,
-43430,
-44671,
-45976,
-47550,
-48946,
-50249,
-51274,
-51889,
-52312,
-52269,
-52198,
-51894,
-51778,
-51737,
-51980,
-52066,
-51938,
-51046,
-49745,
-47880,
-46200,
-44869,
-44072,
-43650,
-43453,
-43274,
-43166,
-43185,
-43185,
-43077,
-42608,
-41661,
-40659,
-39864,
-39732,
-40150,
-41149,
-42190,
-43540,
-44648,
-46000,
-46927,
-47818,
-48036,
-48126,
-47882,
-47680,
-47420,
-46927,
-46245,
-45311,
-44338,
-43275,
-42322,
-40839,
-39021,
-36166,
-33218,
-30405,
-28836,
-28365,
-28947,
-29407,
-29498,
-28791,
-28189,
-27905,
-28144,
-28393,
-27591,
-26110,
-24050,
-22762,
-22922,
-24180,
-25910,
-26908,
-26550,
-25290,
-23208,
-21412,
-19599,
-18487,
-17451,
-17047,
-16788,
-16624,
-16190,
-14987,
-13353,
-11179,
-9364,
-7969,
-7371,
-7037,
-7039,
-6906,
-7103,
-7485,
-8185,
-8594,
-7963,
-6334,
-4356,
-2985,
-3607,
-5684,
-8258,
-9763,
-9585,
-8014,
-6483,
-5489,
-5110,
-4559,
-3161,
-1414,
-60,
-217,
-1810,
-4204,
-6152,
-6973,
-6483,
-4802,
-2741,
-327,
-0,
-65535,
-352,
-3092,
-6000,
-7546,
-7859,
-6773,
-5619,
-4581,
-3516,
-2276,
-461,
-65535,
-1,
-282,
-2209,
-3739,
-3759,
-2499,
-858,
-61,
-947,
-3384,
-6728,
-10472,
-13993,
-17293,
-20150,
-22479,
-24377,
-25782,
-27079,
-28393,
-29674,
-31004,
-32045,
-32865,
-33328,
-33708,
-33793,
-33665,
-32927,
-31582,
-29542,
-27392,
-25492,
-24001,
-23122,
-22009,
-20862,
-18885,
-17141,
-15344,
-14280,
-13597,
-13370,
-13663,
-14722,
-17052,
-20504,
-24493,
-28257,
-31291,
-33308,
-35102,
-36297,
-37584,
-38510,
-39336,
-40436,
-41948,
-43894,
-45511,
-46157,
-45465,
-43498,
-41280,
-39111,
-37627,
-36363,
-35590,
-34791,
-34836,
-35124,
-36031,
-36675,
-36718,
-36166,
-35078,
-34283,
-33817,
-34303,
-35459,
-37557,
-40286,
-43829,
-47415,
-50986,
-53704,
-55658,
-56497,
-56831,
-56675,
-56852,
-57030,
-57893,
-58758,
-59863,
-60664,
-60992,
-60775,
-59797,
-58358,
-56411,
-54636,
-53066,
-52133,
-51825,
-51980,
-52444,
-53043,
-53463,
-53487,
-53262,
-52402,
-51468,
-50166,
-49275,
-48460,
-48366,
-48793,
-49851,
-51494,
-53262,
-55172,
-56494,
-57300,
-57402,
-56900,
-56319,
-55745,
-55436,
-55322,
-55393,
-55345,
-55125,
-54725,
-53885,
-52887,
-51627,
-50138,
-48527,
-46883,
-45026,
-43163,
-41459,
-39930,
-39134,
-38467,
-38247,
-37627,
-36961,
-35835,
-34899,
-34020,
-33569,
-33355,
-33505,
-33995,
-34748,
-35919,
-36942,
-37847,
-38313,
-38470,
-38378,
-38358,
-38425,
-38422,
-38470,
-38224,
-37915,
-37493,
-37007,
-36342,
-35898,
-35325,
-35077,
-35038,
-35166,
-35456,
-35568,
-35699,
-35634,
-35744,
-35831,
-36078,
-36275,
-36474,
-36654,
-36916,
-37230,
-37669,
-38181,
-38711,
-39290,
-39662,
-40131,
-40461,
-40861,
-41347,
-42124,
-43118,
-44318,
-45643,
-46576,
-47350,
-47439,
-47306,
-46730,
-46398,
-45954,
-45957,
-46085,
-46556,
-47060,
-47595,
-48035,
-48261,
-48212,
-47995,
-47436,
-46931,
-46375,
-46132,
-45978,
-45910,
-45555,
-44673,
-43449,
-41770,
-40352,
-39197,
-38160,
-37649,
-36827,
-36501,
-36204,
-36103,
-36029,
-35479,
-34570,
-33307,
-31957,
-31027,
-30249,
-29742,
-29099,
-28479,
-27594,
-26927,
-26066,
-25332,
-24560,
-23761,
-23317,
-23098,
-23450,
-24028,
-25001,
-25710,
-26397,
-26552,
-26331,
-26042,
-25577,
-25667,
-25975,
-26884,
-27772,
-28587,
-28991,
-29230,
-29056,
-29231,
-29211,
-29541,
-29653,
-29455,
-29097,
-28502,
-28147,
-28234,
-28503,
-29075,
-29411,
-29806,
-30187,
-30868,
-31804,
-32907,
-33752,
-34834,
-35812,
-37626,
-39531,
-41549,
-42784,
-42947,
-42274,
-41040,
-40195,
-39576,
-39688,
-39795,
-40242,
-40328,
-40395,
-39688,
-38732,
-37253,
-36250,
-35770,
-36293,
-37453,
-38510,
-39534,
-39795,
-39843,
-39420,
-38690,
-37405,
-36342,
-35545,
-36075,
-37585,
-39728,
-41638,
-42542,
-42102,
-40749,
-38912,
-37250,
-36076,
-35412,
-35455,
-35812,
-36274,
-36210,
-35390,
-33682,
-31383,
-29208,
-27660,
-27305,
-27748,
-28811,
-29742,
-30205,
-30098,
-29429,
-28349,
-27258,
-25911,
-25135,
-24844,
-25759,
-27454,
-29460,
-30689,
-30586,
-29363,
-28038,
-27702,
-28612,
-30562,
-31910,
-32756,
-32399,
-31866,
-31294,
-30537,
-29566,
-27901,
-26289,
-25286,
-25116,
-25929,
-26553,
-26862,
-26374,
-25557,
-24623,
-23652,
-22807,
-22168,
-22275,
-23631,
-25973,
-28703,
-30383,
-30206,
-28036,
-24936,
-22718,
-22170,
-24334,
-27262,
-30183,
-31383,
-30824,
-29369,
-27699,
-26622,
-25774,
-24827,
-24002,
-23410,
-24001,
-24982,
-25886,
-25157,
-23097,
-20149,
-18138,
-17490,
-17960,
-18377,
-18092,
-17426,
-17117,
-17558,
-18447,
-18509,
-17762,
-16449,
-15701,
-15963,
-16585,
-16496,
-15101,
-12642,
-10228,
-8721,
-7770,
-6927,
-5377,
-3473,
-1943,
-1347,
-1367,
-1170,
-148,
-2,
-65535,
-0,
-0,
-65535,
-2,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-1,
-65535,
-3,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-2,
-81,
-65535,
-1,
-65535,
-2,
-65535,
-65535,
-0,
-65535,
-4003,
-7061,
-9651,
-11336,
-12599,
-13038,
-13243,
-13769,
-15855,
-19664,
-24690,
-28879,
-30759,
-29897,
-27482,
-25843,
-26265,
-29054,
-32909,
-36319,
-38536,
-39597,
-39909,
-40040,
-39797,
-39555,
-39530,
-40396,
-42034,
-44227,
-46111,
-47127,
-47462,
-47417,
-47438,
-47727,
-48214,
-49033,
-50829,
-53330,
-56564,
-59377,
-60774,
-60616,
-59424,
-58423,
-58270,
-58736,
-59045,
-58512,
-57210,
-55585,
-54598,
-54479,
-54971,
-55766,
-56367,
-56694,
-56391,
-55476,
-53442,
-50851,
-48057,
-46001,
-45202,
-45465,
-46289,
-46995,
-47130,
-46707,
-46022,
-45045,
-44428,
-43673,
-43629,
-43940,
-45024,
-46597,
-48170,
-49410,
-50119,
-50163,
-50075,
-49986,
-50052,
-50496,
-51115,
-51648,
-52135,
-52044,
-51892,
-51338,
-50981,
-50697,
-50604,
-50719,
-50227,
-49634,
-48169,
-46486,
-44672,
-43294,
-42479,
-42300,
-42477,
-42877,
-43562,
-44604,
-46220,
-48104,
-49808,
-50874,
-51202,
-50874,
-50671,
-50718,
-51314,
-52113,
-52799,
-53308,
-53465,
-53305,
-52737,
-51687,
-50256,
-48875,
-47463,
-46309,
-44802,
-43188,
-41524,
-40793,
-41283,
-42786,
-44405,
-45003,
-44292,
-42788,
-41570,
-41036,
-41395,
-41610,
-42081,
-42409,
-43564,
-44803,
-45756,
-45134,
-42921,
-39820,
-37337,
-36367,
-37093,
-38291,
-39400,
-39684,
-39867,
-39840,
-39997,
-39796,
-39112,
-38401,
-38026,
-38403,
-39196,
-39779,
-39794,
-39201,
-38447,
-38045,
-37652,
-37291,
-35990,
-34238,
-32110,
-30075,
-28766,
-27947,
-27838,
-28301,
-28723,
-29053,
-28349,
-26747,
-24719,
-23290,
-23345,
-25242,
-28126,
-31071,
-32773,
-33599,
-33216,
-32646,
-31555,
-30298,
-28520,
-27352,
-26816,
-28147,
-30341,
-32951,
-34261,
-33706,
-31292,
-28124,
-25666,
-25024,
-26418,
-29213,
-32241,
-34594,
-35565,
-35523,
-34594,
-33349,
-32092,
-31178,
-30564,
-30758,
-31471,
-32553,
-33640,
-34172,
-33860,
-32689,
-30958,
-28768,
-26684,
-24736,
-23186,
-22253,
-22346,
-23095,
-24604,
-25421,
-25158,
-23605,
-21547,
-20460,
-20616,
-22101,
-22807,
-22633,
-21234,
-20884,
-22519,
-26132,
-29807,
-30673,
-28390,
-23672,
-19863,
-18445,
-20063,
-22453,
-24516,
-25022,
-24825,
-24492,
-23871,
-22633,
-20791,
-19134,
-18776,
-20241,
-22209,
-23961,
-24469,
-24937,
-25930,
-27682,
-28879,
-28454,
-26732,
-25530,
-26887,
-30803,
-35147,
-37359,
-36411,
-34213,
-33422,
-35230,
-38251,
-39816,
-38604,
-35699,
-34103,
-35105,
-38465,
-40952,
-41611,
-39954,
-39088,
-40129,
-43586,
-47038,
-48970,
-48412,
-47173,
-46442,
-47306,
-49255,
-51250,
-53107,
-54683,
-56431,
-57937,
-58471,
-57382,
-55059,
-52290,
-50693,
-50632,
-52440,
-54841,
-57425,
-58981,
-59576,
-58735,
-56654,
-53484,
-49677,
-46309,
-44271,
-44472,
-46973,
-50628,
-54283,
-55790,
-55145,
-51871,
-47393,
-42478,
-38158,
-35212,
-34637,
-36808,
-41656,
-47064,
-50693,
-50275,
-45778,
-39198,
-33154,
-29652,
-28523,
-29321,
-31115,
-34326,
-38380,
-42124,
-42785,
-38914,
-31158,
-22941,
-17892,
-17338,
-19551,
-21461,
-21498,
-20485,
-20284,
-21477,
-21993,
-19660,
-13907,
-7547,
-4047,
-5534,
-9561,
-13243,
-13216,
-10938,
-8476,
-8324,
-9452,
-9765,
-7191,
-2987,
-65535,
-773,
-5618,
-11516,
-15031,
-13663,
-8831,
-2654,
-65535,
-0,
-193,
-3894,
-7503,
-9763,
-10560,
-9541,
-7194,
-3581,
-1,
-65535,
-65535,
-2,
-1231,
-5647,
-8941,
-9653,
-8366,
-6729,
-5665,
-6019,
-6685,
-6927,
-6219,
-4956,
-4313,
-5202,
-7899,
-12291,
-17203,
-21369,
-23187,
-21632,
-17296,
-12020,
-8458,
-9185,
-13951,
-21522,
-28769,
-33882,
-36010,
-35633,
-33595,
-30342,
-26748,
-24184,
-24446,
-29034,
-37249,
-46665,
-53462,
-55192,
-51580,
-45402,
-39973,
-38094,
-40017,
-44339,
-48523,
-51183,
-51824,
-51582,
-51025,
-50697,
-50073,
-48857,
-47019,
-45554,
-45248,
-46574,
-48679,
-50673,
-51471,
-51534,
-50986,
-50735,
-50322,
-49341,
-47574,
-45267,
-43629,
-43364,
-44779,
-47242,
-49431,
-51093,
-51095,
-50183,
-47752,
-44579,
-40617,
-36765,
-33903,
-32800,
-33550,
-35567,
-37450,
-38313,
-37250,
-34326,
-30319,
-26416,
-23809,
-23270,
-24274,
-26151,
-27372,
-26930,
-25108,
-22105,
-19239,
-16919,
-15299,
-14481,
-14236,
-14926,
-16559,
-18625,
-20193,
-20109,
-17934,
-14282,
-10980,
-9475,
-10870,
-14526,
-18865,
-22034,
-23051,
-22212,
-20482,
-19178,
-18377,
-18069,
-17847,
-17936,
-19220,
-22035,
-26085,
-29742,
-31137,
-29475,
-25601,
-21833,
-20394,
-22234,
-26085,
-30054,
-31911,
-31424,
-29831,
-28877,
-30008,
-32487,
-34794,
-35585,
-34508,
-33193,
-33155,
-35123,
-38601,
-41326,
-42588,
-41990,
-41371,
-42276,
-45049,
-49009,
-51606,
-51933,
-49234,
-45400,
-42345,
-41902,
-44271,
-48613,
-52887,
-55745,
-56321,
-55081,
-52665,
-49876,
-47283,
-44627,
-42543,
-41083,
-40703,
-41661,
-43428,
-45778,
-47196,
-47592,
-46023,
-43097,
-39775,
-37052,
-36495,
-38005,
-41147,
-44472,
-46840,
-47728,
-47680,
-46844,
-45974,
-44540,
-42830,
-40861,
-39709,
-40018,
-41947,
-44336,
-45625,
-44446,
-40996,
-36406,
-32822,
-31468,
-32045,
-33153,
-32997,
-31093,
-28767,
-27547,
-29057,
-31977,
-34482,
-34282,
-31713,
-28390,
-27305,
-28701,
-31623,
-33309,
-32929,
-31161,
-30182,
-31162,
-33150,
-34195,
-33174,
-31003,
-29743,
-30826,
-33374,
-35812,
-36516,
-35969,
-35342,
-35481,
-36295,
-36521,
-36651,
-37162,
-39842,
-43894,
-47351,
-47637,
-44339,
-39597,
-37296,
-38931,
-44186,
-49452,
-52379,
-52024,
-50539,
-49943,
-51336,
-53376,
-54015,
-52248,
-48699,
-45536,
-44889,
-47021,
-51134,
-54620,
-55807,
-54286,
-51225,
-48414,
-47084,
-47551,
-48743,
-50610,
-51886,
-53314,
-53902,
-53422,
-51291,
-48037,
-44649,
-42544,
-41657,
-41415,
-40770,
-39668,
-39129,
-40133,
-42364,
-44472,
-44073,
-40571,
-34815,
-29430,
-26442,
-26464,
-28478,
-30850,
-32797,
-33928,
-35234,
-35656,
-34460,
-29740,
-21791,
-13549,
-10294,
-15502,
-28874,
-43411,
-50980,
-46023,
-31314,
-15631,
-8103,
-11799,
-21614,
-29431,
-30184,
-25799,
-21723,
-21902,
-24623,
-26023,
-23072,
-18912,
-17248,
-20861,
-26086,
-28014,
-24581,
-18776,
-16920,
-21475,
-29171,
-34188,
-32404,
-27191,
-24051,
-27193,
-34593,
-40372,
-41040,
-36981,
-33821,
-34433,
-38782,
-42431,
-42832,
-40395,
-38648,
-39638,
-42106,
-42539,
-39468,
-34326,
-31313,
-32667,
-36761,
-40219,
-40086,
-37647,
-36322,
-38378,
-43298,
-46862,
-45845,
-40173,
-33220,
-29719,
-31867,
-38137,
-44625,
-47484,
-45976,
-42146,
-39377,
-39662,
-42215,
-44245,
-43766,
-40703,
-37672,
-37382,
-39954,
-43273,
-43808,
-40217,
-34260,
-29254,
-27705,
-29010,
-30937,
-31314,
-30185,
-28700,
-27992,
-27550,
-26283,
-24606,
-23648,
-25313,
-28391,
-30625,
-29013,
-24180,
-19953,
-20439,
-26616,
-34684,
-38952,
-36412,
-28631,
-20928,
-17625,
-19265,
-23163,
-25510,
-25689,
-24780,
-25156,
-27284,
-29164,
-28546,
-24470,
-18113,
-12797,
-10449,
-12510,
-17403,
-23629,
-29121,
-32509,
-33421,
-31312,
-26862,
-20861,
-15519,
-13530,
-16496,
-24557,
-34684,
-42496,
-44871,
-40549,
-32934,
-25507,
-22127,
-22847,
-26070,
-29317,
-31206,
-31888,
-32444,
-33020,
-33174,
-31825,
-28853,
-25026,
-21743,
-20552,
-21699,
-24893,
-28765,
-32112,
-33441,
-32310,
-28901,
-24292,
-20240,
-17867,
-17740,
-19350,
-21815,
-24667,
-27306,
-29143,
-29255,
-26395,
-20817,
-14081,
-9209,
-8700,
-13217,
-20595,
-27658,
-31470,
-31424,
-28435,
-24780,
-21414,
-18864,
-17252,
-16426,
-17916,
-21989,
-28124,
-34548,
-37716,
-35941,
-28659,
-19174,
-10650,
-7591,
-9875,
-16493,
-23366,
-27457,
-27528,
-24315,
-19752,
-15986,
-13662,
-13105,
-13708,
-15032,
-16654,
-18486,
-20642,
-23446,
-26735,
-30090,
-31695,
-30980,
-27061,
-22699,
-19774,
-20769,
-25027,
-29982,
-32667,
-31623,
-28214,
-25333,
-24914,
-26728,
-28524,
-27769,
-24295,
-20171,
-18601,
-21591,
-28012,
-34285,
-36516,
-33022,
-25553,
-18403,
-15720,
-19220,
-26642,
-33859,
-36455,
-33528,
-27172,
-21924,
-21344,
-25780,
-32242,
-36543,
-36362,
-32712,
-29229,
-28460,
-30602,
-32934,
-32485,
-29722,
-26860,
-27904,
-32887,
-38778,
-40505,
-35612,
-26064,
-17206,
-14280,
-18048,
-25862,
-32625,
-35164,
-32979,
-28233,
-23341,
-20129,
-19109,
-20639,
-23805,
-28389,
-32270,
-34588,
-34928,
-33814,
-32977,
-33041,
-33907,
-35210,
-36344,
-38001,
-39777,
-41591,
-41413,
-39201,
-35388,
-32379,
-31888,
-33707,
-35855,
-36319,
-35148,
-34213,
-35790,
-38845,
-41390,
-40155,
-35983,
-31984,
-31930,
-36300,
-41745,
-44073,
-42233,
-39001,
-38733,
-42433,
-46754,
-46994,
-41393,
-33861,
-30361,
-33950,
-42280,
-48808,
-49061,
-43358,
-36258,
-32485,
-32954,
-35035,
-36077,
-35233,
-35015,
-36938,
-40907,
-44269,
-44694,
-42322,
-39220,
-37763,
-38885,
-41462,
-44048,
-45800,
-46819,
-47483,
-47351,
-46176,
-44050,
-42056,
-41790,
-43166,
-45577,
-46310,
-44647,
-40751,
-37270,
-36322,
-39309,
-44714,
-49744,
-51646,
-48901,
-43385,
-37583,
-35122,
-37164,
-42698,
-49099,
-52624,
-52464,
-48925,
-44935,
-43010,
-43893,
-46444,
-48523,
-48569,
-47284,
-46153,
-46842,
-48723,
-50362,
-49501,
-46394,
-42637,
-40634,
-40909,
-42541,
-42922,
-41457,
-39135,
-37846,
-39378,
-41878,
-43763,
-42721,
-39377,
-35964,
-34660,
-36186,
-39488,
-42455,
-43961,
-43607,
-42345,
-40439,
-38181,
-35700,
-33284,
-32267,
-33396,
-36785,
-40884,
-43405,
-42391,
-38666,
-34150,
-32510,
-34083,
-37050,
-37850,
-34523,
-29588,
-27393,
-31403,
-39465,
-45690,
-44158,
-34728,
-23338,
-17826,
-21591,
-31136,
-39266,
-40640,
-36273,
-30785,
-28434,
-29055,
-28877,
-25556,
-19928,
-16630,
-18313,
-24401,
-30121,
-31399,
-27242,
-20834,
-15946,
-15009,
-17229,
-20637,
-23694,
-26066,
-27548,
-28236,
-27194,
-25068,
-22851,
-22324,
-24136,
-27550,
-30560,
-31690,
-30939,
-29120,
-28126,
-28166,
-29745,
-31488,
-33067,
-33726,
-33285,
-32004,
-30180,
-28705,
-28364,
-29257,
-31291,
-33352,
-34880,
-35854,
-36831,
-38400,
-40065,
-41678,
-41216,
-39930,
-37870,
-38159,
-41524,
-47927,
-54659,
-58293,
-56762,
-51007,
-44668,
-41904,
-44911,
-51650,
-58046,
-60176,
-57317,
-52688,
-50186,
-52400,
-57849,
-63098,
-64584,
-61923,
-56986,
-52578,
-50759,
-51562,
-54812,
-59556,
-65047,
-65534,
-65534,
-65534,
-60771,
-54218,
-51004,
-52621,
-56855,
-60614,
-61751,
-60593,
-59312,
-59091,
-58975,
-56878,
-51490,
-43874,
-37516,
-34746,
-36741,
-41260,
-45577,
-47285,
-45689,
-41434,
-36057,
-31135,
-28104,
-27725,
-29453,
-31779,
-32513,
-30977,
-27488,
-24531,
-23122,
-23782,
-24094,
-22875,
-19220,
-15810,
-14635,
-18003,
-23186,
-27303,
-25624,
-18177,
-7550,
-65535,
-65535,
-5200,
-15743,
-23762,
-24224,
-16565,
-4622,
-1,
-65535,
-65535,
-2543,
-8766,
-11136,
-9120,
-5267,
-2207,
-1350,
-2162,
-3607,
-3604,
-2166,
-65535,
-1,
-65535,
-3098,
-11046,
-17627,
-18776,
-12821,
-3425,
-3,
-65535,
-5445,
-14192,
-18246,
-15433,
-9830,
-6970,
-9077,
-13064,
-13814,
-9212,
-2981,
-817,
-6063,
-15366,
-21924,
-20658,
-12533,
-3450,
-65535,
-2257,
-8741,
-14350,
-16870,
-16875,
-16006,
-15260,
-13502,
-10962,
-8541,
-9233,
-13926,
-21525,
-28766,
-32555,
-32354,
-29521,
-26352,
-24382,
-24225,
-26022,
-29717,
-34706,
-38798,
-39688,
-36297,
-30450,
-26265,
-27149,
-32866,
-39595,
-42237,
-38466,
-30850,
-24714,
-24313,
-30319,
-38025,
-42565,
-40730,
-33681,
-25868,
-21588,
-23122,
-29008,
-36011,
-40373,
-40372,
-36744,
-31686,
-28440,
-28075,
-30963,
-34857,
-38224,
-39357,
-37956,
-35081,
-31822,
-29744,
-29185,
-30033,
-31088,
-31518,
-31111,
-30276,
-30493,
-31934,
-34084,
-35255,
-34174,
-30514,
-26045,
-22673,
-22323,
-24558,
-27860,
-29740,
-29322,
-27059,
-25026,
-24934,
-26574,
-27815,
-26064,
-20838,
-14702,
-12464,
-16808,
-26749,
-36676,
-40439,
-35079,
-23763,
-12728,
-8591,
-12773,
-22834,
-33083,
-39379,
-40038,
-36012,
-29896,
-23850,
-20328,
-20438,
-24780,
-31536,
-38336,
-42011,
-41348,
-37118,
-31977,
-28104,
-27194,
-28234,
-30209,
-31976,
-33043,
-34326,
-36032,
-38336,
-40372,
-40840,
-38755,
-34370,
-28991,
-24976,
-24451,
-27989,
-34550,
-40881,
-44827,
-44535,
-41593,
-38025,
-36430,
-37251,
-39442,
-41039,
-41412,
-40863,
-41412,
-43321,
-46263,
-48038,
-47527,
-45047,
-42189,
-40883,
-41148,
-42656,
-43781,
-44186,
-43716,
-42367,
-40198,
-37512,
-35837,
-36426,
-39426,
-42272,
-42019,
-37466,
-31805,
-30338,
-35743,
-45049,
-50981,
-47574,
-36782,
-26775,
-27062,
-39220,
-55637,
-64933,
-60731,
-46818,
-33175,
-28390,
-32709,
-40419,
-44380,
-43542,
-41059,
-41614,
-45180,
-48391,
-47084,
-41215,
-34283,
-30714,
-32491,
-36981,
-41284,
-42521,
-41546,
-40131,
-39885,
-40484,
-41061,
-40438,
-39266,
-39001,
-40548,
-43766,
-46261,
-45735,
-41569,
-35588,
-32114,
-33481,
-40155,
-47857,
-52491,
-51713,
-46885,
-41547,
-38469,
-37669,
-38139,
-38333,
-39268,
-41744,
-45912,
-49587,
-50783,
-49101,
-46839,
-46355,
-48192,
-49542,
-47816,
-42587,
-37607,
-36893,
-42347,
-50692,
-57342,
-58933,
-56809,
-53905,
-52602,
-51512,
-47949,
-41416,
-34877,
-33045,
-38155,
-47264,
-55168,
-57008,
-53153,
-46485,
-40686,
-36760,
-34041,
-32463,
-33333,
-37645,
-44297,
-48743,
-48017,
-42144,
-36742,
-36827,
-43521,
-51733,
-54619,
-49273,
-39646,
-32352,
-32003,
-36673,
-41458,
-42479,
-41213,
-41260,
-44604,
-48856,
-49100,
-43719,
-35254,
-28991,
-27171,
-28146,
-28060,
-26483,
-26864,
-33129,
-44029,
-52332,
-50475,
-37227,
-20372,
-10761,
-13482,
-24559,
-34216,
-36296,
-32690,
-30604,
-34636,
-42346,
-46329,
-41594,
-30139,
-19487,
-15631,
-19178,
-25774,
-31473,
-35940,
-40951,
-46596,
-48746,
-43762,
-31558,
-18822,
-13904,
-19575,
-31802,
-41303,
-42788,
-37647,
-32446,
-32087,
-35924,
-38178,
-34770,
-26730,
-20038,
-20308,
-28610,
-39865,
-48102,
-49323,
-44226,
-36409,
-29432,
-25885,
-26710,
-31776,
-39402,
-46152,
-48547,
-44915,
-37490,
-31474,
-30711,
-35660,
-42209,
-45047,
-42943,
-37914,
-35434,
-37716,
-42852,
-45558,
-41635,
-31557,
-21216,
-17202,
-23143,
-35899,
-47615,
-51050,
-43674,
-30692,
-19843,
-17779,
-23430,
-31380,
-34459,
-30894,
-24336,
-21393,
-24712,
-31868,
-36076,
-33242,
-24247,
-14749,
-10601,
-12999,
-18731,
-22722,
-22829,
-20375,
-19461,
-21415,
-25842,
-28436,
-26639,
-20152,
-11932,
-6264,
-5997,
-10539,
-17624,
-23652,
-26794,
-27484,
-26262,
-24317,
-20946,
-16521,
-11842,
-9389,
-10778,
-15480,
-20592,
-23209,
-22453,
-20484,
-19817,
-20706,
-21368,
-18933,
-14370,
-11046,
-12732,
-19507,
-26465,
-29076,
-25445,
-19551,
-16676,
-18199,
-21371,
-21367,
-17472,
-13793,
-15235,
-22497,
-30053,
-31445,
-25225,
-16805,
-14060,
-19376,
-27903,
-31468,
-26643,
-17955,
-14106,
-19242,
-29565,
-36075,
-32999,
-22850,
-14196,
-13836,
-21835,
-31402,
-35723,
-32996,
-27284,
-23605,
-24049,
-26907,
-28745,
-28921,
-28015,
-27325,
-26864,
-25576,
-24604,
-25576,
-29987,
-35897,
-38691,
-34969,
-25930,
-17651,
-16005,
-22059,
-30337,
-34306,
-31246,
-25335,
-22586,
-25336,
-29517,
-29034,
-22145,
-13614,
-11118,
-17511,
-28636,
-35789,
-35121,
-27973,
-22008,
-20197,
-21701,
-21501,
-18557,
-16583,
-20663,
-31001,
-40796,
-42033,
-32489,
-19132,
-12044,
-16473,
-27948,
-36897,
-36938,
-29854,
-23450,
-23451,
-28989,
-33839,
-32686,
-26266,
-19928,
-18623,
-22477,
-27104,
-28592,
-26571,
-24473,
-25198,
-28393,
-30825,
-29521,
-25112,
-21036,
-20639,
-24647,
-30694,
-36274,
-39535,
-40745,
-39536,
-36185,
-31180,
-26997,
-26882,
-32068,
-39976,
-45509,
-44407,
-38377,
-32402,
-32508,
-38359,
-44735,
-44960,
-37381,
-27507,
-23137,
-28527,
-40193,
-49989,
-51511,
-44718,
-35696,
-30918,
-32508,
-37364,
-40458,
-39380,
-35963,
-34349,
-36963,
-42498,
-46644,
-45798,
-39797,
-32378,
-28256,
-30010,
-35653,
-40729,
-41634,
-38381,
-34746,
-34218,
-37092,
-39489,
-37272,
-30206,
-22722,
-21056,
-27263,
-37625,
-44982,
-44934,
-38670,
-31865,
-28881,
-29938,
-31448,
-30849,
-28699,
-28149,
-30603,
-34439,
-36229,
-34705,
-32465,
-32421,
-34992,
-36496,
-33441,
-26796,
-22254,
-25777,
-36409,
-47194,
-48593,
-39330,
-25356,
-18048,
-21965,
-33510,
-42253,
-41548,
-32954,
-25066,
-25204,
-33304,
-42104,
-43714,
-36080,
-24489,
-17407,
-19439,
-28991,
-39440,
-44940,
-43359,
-37498,
-31930,
-29501,
-30603,
-32468,
-33107,
-31779,
-30229,
-30915,
-34881,
-41016,
-46484,
-48527,
-46262,
-41019,
-34833,
-30496,
-29608,
-33419,
-41701,
-51848,
-59619,
-60620,
-53972,
-42987,
-34614,
-33617,
-40087,
-48633,
-53111,
-51823,
-47948,
-47109,
-50914,
-56345,
-57801,
-53269,
-45707,
-41817,
-44800,
-53309,
-61106,
-63762,
-61105,
-57119,
-55477,
-56413,
-57469,
-55946,
-52688,
-49985,
-50652,
-53683,
-56810,
-57427,
-55990,
-54458,
-54838,
-56453,
-57296,
-55258,
-51092,
-47108,
-45865,
-47772,
-51314,
-54418,
-55763,
-55727,
-54546,
-52712,
-49543,
-45333,
-41039,
-38159,
-37890,
-40067,
-43358,
-46293,
-47943,
-47775,
-46174,
-43098,
-39157,
-35364,
-32381,
-31221,
-30365,
-29364,
-27282,
-25712,
-26528,
-30207,
-34903,
-37027,
-34284,
-27858,
-21945,
-19952,
-22452,
-25979,
-27569,
-27174,
-28233,
-34129,
-42830,
-48925,
-45731,
-33221,
-18066,
-9190,
-11842,
-22345,
-33219,
-37980,
-36587,
-33838,
-33086,
-34172,
-32289,
-25510,
-15611,
-9296,
-10717,
-19640,
-30784,
-38178,
-39999,
-37159,
-33089,
-28653,
-24717,
-21764,
-21705,
-25507,
-31583,
-35631,
-34971,
-30581,
-27639,
-30803,
-39267,
-47194,
-47795,
-39308,
-27617,
-20237,
-21947,
-29541,
-36143,
-37339,
-33794,
-31670,
-34324,
-40797,
-44822,
-41993,
-32309,
-22167,
-18201,
-23164,
-33839,
-43561,
-47176,
-43604,
-36300,
-29674,
-27172,
-28967,
-33241,
-36851,
-37782,
-35346,
-31047,
-27484,
-26793,
-29723,
-34632,
-38584,
-39416,
-36390,
-31289,
-26665,
-24690,
-25289,
-27396,
-28940,
-29170,
-28696,
-28682,
-29939,
-31846,
-32289,
-30095,
-24714,
-19199,
-16118,
-18559,
-25529,
-33866,
-39106,
-38118,
-31732,
-23231,
-17890,
-18159,
-23892,
-31228,
-36429,
-37272,
-34814,
-31801,
-30162,
-29788,
-28830,
-26046,
-22495,
-20840,
-23272,
-28724,
-33529,
-34170,
-29743,
-23781,
-20109,
-20570,
-23164,
-24358,
-22146,
-18996,
-18051,
-21541,
-27664,
-32108,
-32534,
-29454,
-26263,
-25467,
-26684,
-27328,
-25644,
-22520,
-20905,
-22562,
-27154,
-31665,
-33731,
-33217,
-30894,
-28523,
-25444,
-21680,
-17934,
-16321,
-18865,
-24093,
-28436,
-27701,
-21549,
-13881,
-10140,
-12952,
-20018,
-25909,
-26464,
-21590,
-15522,
-12222,
-13771,
-18290,
-23273,
-26421,
-27547,
-26841,
-24314,
-20593,
-16609,
-14722,
-16408,
-20883,
-25508,
-26932,
-24578,
-20484,
-17891,
-18291,
-20638,
-21922,
-20817,
-18353,
-17298,
-19726,
-24318,
-27746,
-26465,
-20215,
-12267,
-7659,
-10071,
-18603,
-28764,
-34838,
-33771,
-27373,
-20415,
-17671,
-20062,
-24846,
-28104,
-27834,
-25601,
-24513,
-25756,
-28324,
-29474,
-28458,
-27171,
-28236,
-32467,
-37026,
-38139,
-34500,
-28194,
-24225,
-24891,
-29632,
-34368,
-36522,
-36650,
-36896,
-39954,
-43759,
-46025,
-43737,
-37673,
-30913,
-26797,
-27061,
-30739,
-36652,
-42963,
-48637,
-51733,
-50433,
-43470,
-32868,
-22230,
-16697,
-17935,
-25201,
-34128,
-41413,
-45003,
-45335,
-43584,
-40109,
-35011,
-28459,
-22208,
-18737,
-20257,
-26800,
-35741,
-43121,
-45423,
-41680,
-34082,
-26311,
-21609,
-21305,
-23982,
-27547,
-30366,
-32239,
-33290,
-33813,
-32403,
-29140,
-24142,
-19946,
-17431,
-16737,
-15921,
-13972,
-12175,
-13419,
-19175,
-27062,
-31668,
-28702,
-18930,
-8636,
-4488,
-8702,
-17204,
-23650,
-24847,
-23119,
-23295,
-27329,
-32064,
-32203,
-25509,
-15988,
-10649,
-14013,
-24029,
-34149,
-38711,
-36499,
-31622,
-27838,
-26817,
-26442,
-24823,
-22035,
-20615,
-22410,
-27483,
-32752,
-36167,
-36451,
-35280,
-33728,
-33019,
-32401,
-32220,
-32335,
-33726,
-35370,
-37181,
-37917,
-38954,
-41414,
-46776,
-52841,
-57253,
-56453,
-50650,
-43098,
-37826,
-38092,
-43208,
-50008,
-55391,
-57339,
-56831,
-55257,
-53862,
-52534,
-50605,
-48126,
-45844,
-45357,
-47792,
-52269,
-57471,
-60841,
-61325,
-59533,
-56719,
-54948,
-54085,
-53904,
-53444,
-52597,
-52757,
-54215,
-56897,
-58913,
-58978,
-57141,
-55434,
-55302,
-56809,
-57958,
-56124,
-51822,
-47242,
-46240,
-49834,
-55941,
-60156,
-60105,
-55925,
-51401,
-49412,
-50805,
-53552,
-54837,
-53419,
-50318,
-47683,
-46951,
-48259,
-49919,
-50894,
-50651,
-49653,
-48724,
-47484,
-45554,
-42257,
-38513,
-36362,
-37808,
-42407,
-48127,
-50385,
-47836,
-41394,
-35920,
-34504,
-37693,
-41215,
-41746,
-38513,
-35190,
-36187,
-41326,
-47438,
-48281,
-43320,
-35631,
-31804,
-33880,
-38982,
-40989,
-36790,
-29471,
-24960,
-27768,
-35768,
-43229,
-45070,
-41081,
-35367,
-31692,
-30781,
-30473,
-29033,
-27680,
-28238,
-31621,
-34816,
-34679,
-30584,
-25910,
-25400,
-30006,
-36564,
-39221,
-36166,
-29852,
-25952,
-27329,
-31734,
-34371,
-31803,
-26415,
-22858,
-25240,
-31983,
-38177,
-38914,
-33749,
-26398,
-21722,
-21990,
-25688,
-29697,
-31757,
-31935,
-32088,
-33044,
-34988,
-36078,
-35211,
-32224,
-28123,
-24781,
-23605,
-25246,
-29209,
-34172,
-38224,
-40042,
-38667,
-34968,
-29987,
-25797,
-23209,
-22941,
-24358,
-27041,
-29806,
-32247,
-33416,
-33330,
-32090,
-30183,
-28547,
-27216,
-26418,
-25667,
-25377,
-26264,
-28813,
-33039,
-37098,
-38709,
-36875,
-32002,
-27169,
-25293,
-27124,
-31384,
-34767,
-35502,
-33306,
-30474,
-28632,
-28437,
-28720,
-28304,
-27171,
-26419,
-27615,
-30495,
-33927,
-35523,
-34437,
-31002,
-26932,
-24156,
-23787,
-25972,
-29634,
-33040,
-34704,
-33749,
-30828,
-28123,
-27440,
-29674,
-33263,
-35478,
-34415,
-30229,
-25844,
-23892,
-25557,
-29275,
-32024,
-31957,
-29429,
-26354,
-24868,
-25335,
-26772,
-27639,
-27435,
-26887,
-26882,
-27838,
-29254,
-29763,
-29255,
-27681,
-26729,
-26840,
-28302,
-29786,
-30073,
-29078,
-27836,
-27925,
-30096,
-33042,
-34392,
-32867,
-29185,
-26309,
-26376,
-29428,
-32426,
-32661,
-29103,
-24777,
-22655,
-24447,
-27726,
-29011,
-26508,
-22033,
-19818,
-22322,
-28590,
-34393,
-36053,
-32865,
-27726,
-24537,
-24491,
-27062,
-28544,
-27883,
-25177,
-23009,
-23628,
-26994,
-31182,
-33174,
-31448,
-26530,
-21124,
-17936,
-18091,
-20617,
-24003,
-26444,
-28431,
-29766,
-30516,
-29099,
-24847,
-18378,
-12665,
-10339,
-12729,
-17517,
-21943,
-23651,
-23165,
-22761,
-23344,
-24733,
-24338,
-21635,
-17005,
-13352,
-12065,
-13263,
-15388,
-16896,
-17779,
-18513,
-19065,
-19265,
-17515,
-15300,
-13483,
-14261,
-17335,
-20353,
-20901,
-17673,
-13038,
-9985,
-11026,
-15497,
-20686,
-23403,
-22899,
-20151,
-18000,
-17474,
-18620,
-19531,
-19576,
-18399,
-17805,
-18621,
-21370,
-24624,
-26797,
-26396,
-23518,
-19729,
-16475,
-15654,
-17050,
-19908,
-22740,
-24650,
-25640,
-26268,
-27457,
-28481,
-28899,
-27527,
-24579,
-21947,
-21035,
-23452,
-27349,
-31027,
-32110,
-30939,
-29496,
-30119,
-33086,
-37050,
-39223,
-38467,
-36321,
-34104,
-34126,
-34882,
-35144,
-33599,
-31310,
-30076,
-31645,
-34969,
-38159,
-39354,
-37958,
-35634,
-33352,
-31999,
-31096,
-30579,
-30675,
-32176,
-34682,
-37294,
-38180,
-37029,
-34724,
-33155,
-33239,
-34858,
-36410,
-37535,
-37852,
-38775,
-40287,
-42211,
-43074,
-42302,
-40128,
-37761,
-36231,
-35499,
-35347,
-35189,
-35545,
-36608,
-38202,
-39554,
-39332,
-37738,
-35478,
-34503,
-35478,
-37982,
-40328,
-41128,
-39728,
-37541,
-35387,
-34839,
-35386,
-36677,
-38090,
-39289,
-40882,
-42944,
-45177,
-47308,
-48390,
-48236,
-47264,
-45996,
-45581,
-46041,
-47107,
-47972,
-48014,
-46840,
-45470,
-44068,
-43900,
-44445,
-45780,
-47126,
-48040,
-48167,
-47619,
-46882,
-46975,
-48281,
-50672,
-52666,
-52821,
-50872,
-48392,
-47814,
-50431,
-54813,
-58116,
-57539,
-54148,
-50631,
-50848,
-54750,
-59487,
-60840,
-57582,
-52290,
-49853,
-52179,
-58138,
-62343,
-61574,
-55607,
-48285,
-44246,
-45115,
-49610,
-54281,
-56567,
-56052,
-53643,
-50916,
-48612,
-47417,
-47307,
-48544,
-50432,
-52088,
-52512,
-51559,
-50051,
-48992,
-48675,
-48551,
-47634,
-45625,
-43762,
-42741,
-44076,
-46105,
-48107,
-47902,
-45624,
-42410,
-39687,
-38756,
-38977,
-39156,
-38114,
-35898,
-33775,
-33503,
-35481,
-38490,
-40217,
-38891,
-34436,
-29519,
-26466,
-27258,
-30807,
-34679,
-36365,
-35345,
-32465,
-30208,
-29453,
-30273,
-31026,
-30738,
-29187,
-27794,
-27526,
-29098,
-31161,
-32419,
-31360,
-28501,
-25023,
-22965,
-23117,
-25047,
-27083,
-28081,
-27304,
-25600,
-24049,
-23318,
-23540,
-24093,
-24580,
-25070,
-25840,
-27308,
-28830,
-29701,
-28940,
-26712,
-24287,
-23146,
-24333,
-27263,
-30273,
-31535,
-30627,
-28458,
-26595,
-26398,
-27282,
-28523,
-28635,
-27637,
-26042,
-24537,
-23694,
-23363,
-23562,
-24314,
-25644,
-27439,
-28787,
-29167,
-28612,
-27680,
-27373,
-27613,
-28016,
-27569,
-26798,
-26150,
-27263,
-29829,
-32843,
-34482,
-33527,
-31094,
-28125,
-26705,
-26621,
-27258,
-27440,
-27127,
-26418,
-26399,
-26794,
-27284,
-27459,
-27018,
-26838,
-26888,
-27633,
-28106,
-28587,
-28547,
-28898,
-29811,
-31155,
-32470,
-32861,
-32335,
-31047,
-29853,
-29253,
-29676,
-30695,
-32109,
-32911,
-33129,
-32222,
-31072,
-29983,
-29877,
-30580,
-31561,
-32087,
-31691,
-30938,
-30605,
-31248,
-32466,
-32930,
-32178,
-30584,
-29476,
-30315,
-32669,
-34698,
-35040,
-32639,
-29900,
-28675,
-30609,
-34611,
-37806,
-38179,
-35213,
-30960,
-28279,
-28545,
-31537,
-35122,
-36942,
-36140,
-33266,
-30115,
-28460,
-28764,
-30629,
-32688,
-34147,
-34261,
-33663,
-32287,
-30585,
-28699,
-27306,
-26971,
-28238,
-30182,
-31582,
-31047,
-28700,
-25711,
-24093,
-24315,
-25887,
-27195,
-27304,
-26796,
-26707,
-27416,
-28390,
-28213,
-26286,
-23873,
-22253,
-22834,
-24864,
-26623,
-27058,
-25757,
-24269,
-23097,
-22831,
-22520,
-21969,
-21478,
-21680,
-22785,
-24096,
-24489,
-23610,
-22029,
-20841,
-21013,
-21524,
-22167,
-21413,
-20505,
-19686,
-20416,
-21902,
-23404,
-23721,
-22626,
-21330,
-20657,
-21747,
-23605,
-25312,
-25533,
-23983,
-21236,
-18778,
-17690,
-18869,
-21831,
-25093,
-27149,
-26640,
-24183,
-21478,
-20794,
-22632,
-25976,
-27858,
-27173,
-24136,
-22014,
-22563,
-26175,
-29632,
-29984,
-26199,
-20925,
-17802,
-19555,
-24312,
-29102,
-30270,
-27950,
-24269,
-22522,
-23627,
-26729,
-29478,
-30645,
-30324,
-29512,
-29084,
-29516,
-30384,
-31781,
-32885,
-33441,
-32422,
-30028,
-27461,
-26553,
-28366,
-32091,
-35278,
-36077,
-34059,
-31693,
-30780,
-32424,
-34280,
-34416,
-32023,
-28988,
-28146,
-30519,
-34456,
-37231,
-37049,
-35012,
-33799,
-34896,
-37811,
-39835,
-39404,
-36626,
-34329,
-34081,
-36476,
-39177,
-40218,
-38690,
-35854,
-33463,
-33020,
-33971,
-35811,
-36985,
-37492,
-36921,
-35872,
-34708,
-34013,
-34394,
-35568,
-36849,
-36942,
-35544,
-33085,
-31671,
-32263,
-35216,
-38576,
-40441,
-39288,
-36253,
-32865,
-31403,
-32353,
-34596,
-36869,
-37543,
-36892,
-35414,
-34258,
-33752,
-33993,
-34349,
-34305,
-33638,
-32246,
-31158,
-30805,
-31802,
-33594,
-35036,
-34615,
-32464,
-29323,
-27524,
-28281,
-31558,
-35433,
-37560,
-36698,
-33593,
-30187,
-28942,
-30297,
-33306,
-35723,
-36031,
-34238,
-32111,
-31803,
-33793,
-37406,
-39952,
-39907,
-37319,
-34126,
-32553,
-33376,
-35720,
-37362,
-37672,
-36561,
-36100,
-36740,
-38291,
-39488,
-39021,
-37760,
-36962,
-37473,
-39685,
-41681,
-42720,
-42522,
-41725,
-41613,
-41857,
-42013,
-41568,
-40507,
-39774,
-40065,
-41478,
-43189,
-44513,
-44959,
-44914,
-44603,
-44361,
-43983,
-43164,
-42500,
-41901,
-42035,
-42543,
-43275,
-44028,
-44825,
-45512,
-45756,
-44956,
-43322,
-41367,
-40841,
-42231,
-45337,
-48234,
-49103,
-47457,
-44674,
-42652,
-43098,
-44761,
-46704,
-46468,
-44623,
-42213,
-41016,
-41701,
-43652,
-45378,
-45734,
-44493,
-42278,
-40108,
-38821,
-39201,
-40837,
-43209,
-45025,
-45067,
-43321,
-40815,
-39112,
-39375,
-41104,
-42611,
-42787,
-41305,
-40194,
-40485,
-42477,
-44383,
-44226,
-41814,
-38800,
-37494,
-39177,
-42146,
-44181,
-43499,
-40437,
-37517,
-36055,
-36584,
-37517,
-37649,
-36939,
-36365,
-36940,
-38312,
-39289,
-38889,
-36940,
-35101,
-34527,
-35896,
-38229,
-39771,
-39645,
-37581,
-35257,
-33685,
-33838,
-34836,
-35788,
-35613,
-34833,
-34463,
-35274,
-37121,
-38267,
-37584,
-34812,
-31492,
-29763,
-30539,
-32866,
-35033,
-35258,
-34149,
-32487,
-31891,
-32399,
-32776,
-32644,
-31356,
-30297,
-30117,
-31026,
-32224,
-33216,
-33200,
-33061,
-32800,
-32930,
-32600,
-31756,
-30251,
-28790,
-28300,
-28570,
-29784,
-30406,
-30739,
-29939,
-29212,
-28743,
-28945,
-29254,
-29276,
-28391,
-27326,
-26886,
-27458,
-29080,
-30137,
-29877,
-28256,
-26286,
-25668,
-26505,
-28060,
-28899,
-28346,
-27371,
-26886,
-27458,
-28237,
-28034,
-26775,
-25686,
-25979,
-27813,
-29564,
-29189,
-26726,
-23477,
-22296,
-24008,
-27125,
-29477,
-29143,
-27128,
-25555,
-25888,
-27481,
-29101,
-28743,
-27595,
-26748,
-27308,
-28899,
-29629,
-28815,
-26636,
-25204,
-25376,
-27262,
-29077,
-29741,
-29188,
-28588,
-28703,
-29828,
-30652,
-30624,
-29501,
-28233,
-27550,
-27615,
-27769,
-27417,
-26574,
-25864,
-25735,
-26704,
-27994,
-29275,
-29830,
-29810,
-29074,
-28304,
-27215,
-26398,
-25931,
-25888,
-26374,
-27085,
-27436,
-27528,
-26971,
-26222,
-25709,
-25533,
-25843,
-26376,
-26594,
-26665,
-26085,
-25645,
-25179,
-25133,
-25291,
-25354,
-25203,
-24557,
-23763,
-23050,
-22611,
-22564,
-22500,
-22187,
-21747,
-21456,
-21924,
-23096,
-24604,
-25376,
-25070,
-23714,
-22192,
-21543,
-21572,
-22162,
-22170,
-21787,
-21283,
-21610,
-22745,
-24468,
-25246,
-25023,
-23584,
-22233,
-21347,
-21302,
-21436,
-21501,
-21547,
-21900,
-22985,
-24406,
-25509,
-25821,
-24980,
-23848,
-23033,
-22984,
-23696,
-24712,
-25424,
-25797,
-25668,
-25199,
-24804,
-24424,
-24449,
-24846,
-25178,
-25601,
-25665,
-25466,
-25646,
-26195,
-27462,
-28877,
-30029,
-30140,
-29411,
-28033,
-26666,
-25995,
-25933,
-26442,
-27126,
-27839,
-28189,
-28701,
-28834,
-29252,
-29412,
-29451,
-29235,
-28763,
-28571,
-28675,
-29523,
-30493,
-31513,
-31625,
-30982,
-29541,
-28083,
-27301,
-27663,
-28919,
-30895,
-32111,
-32865,
-32178,
-31579,
-31114,
-31957,
-33197,
-34503,
-34682,
-33948,
-32489,
-31890,
-32088,
-33221,
-34147,
-34129,
-33351,
-32355,
-32200,
-33131,
-34636,
-35722,
-35389,
-34173,
-32751,
-32625,
-34056,
-36169,
-37557,
-37053,
-34901,
-32754,
-32223,
-33882,
-36786,
-39266,
-40062,
-39532,
-38534,
-38469,
-39111,
-40041,
-40062,
-39466,
-38312,
-37761,
-37737,
-38114,
-38224,
-38048,
-37626,
-37295,
-37095,
-36852,
-36318,
-35724,
-35055,
-34838,
-34945,
-35590,
-36518,
-37982,
-39398,
-40396,
-40439,
-39244,
-37405,
-35987,
-35635,
-36916,
-38691,
-40329,
-40771,
-40019,
-38735,
-37825,
-37848,
-38537,
-39128,
-38695,
-37313,
-35303,
-34149,
-34303,
-35900,
-37847,
-39001,
-38712,
-37382,
-36011,
-35388,
-35612,
-36098,
-36010,
-35411,
-34328,
-34258,
-35059,
-37049,
-38891,
-39729,
-39180,
-37667,
-36168,
-35675,
-36145,
-37492,
-38425,
-39021,
-38891,
-38865,
-39157,
-39684,
-40376,
-40991,
-41461,
-41965,
-42215,
-41986,
-41019,
-39839,
-39135,
-39553,
-41037,
-42521,
-43055,
-42388,
-40993,
-40419,
-40836,
-42302,
-43474,
-43561,
-42767,
-41747,
-41966,
-43322,
-45508,
-47155,
-47435,
-46357,
-44711,
-43278,
-43074,
-43563,
-44625,
-45269,
-45532,
-45382,
-45443,
-45912,
-46751,
-47417,
-47527,
-46731,
-45467,
-44360,
-43984,
-44249,
-45002,
-45490,
-45335,
-44426,
-43253,
-42078,
-41968,
-42722,
-44138,
-45224,
-45245,
-44140,
-42542,
-42060,
-42628,
-44364,
-45243,
-44473,
-42121,
-39710,
-38756,
-39708,
-41594,
-42384,
-41929,
-40036,
-38915,
-38799,
-39265,
-39268,
-37646,
-35304,
-33615,
-33664,
-35477,
-37605,
-38446,
-37826,
-35921,
-34394,
-33771,
-34261,
-35279,
-36031,
-36543,
-36207,
-35745,
-34659,
-33573,
-32445,
-31821,
-31560,
-31910,
-32202,
-32420,
-32180,
-31644,
-31027,
-30429,
-30159,
-29658,
-29360,
-28504,
-28012,
-27396,
-27192,
-27086,
-26659,
-26068,
-25354,
-25246,
-26375,
-28212,
-30496,
-31622,
-31383,
-29761,
-27639,
-25776,
-24891,
-24758,
-25311,
-26397,
-27681,
-29056,
-29629,
-29545,
-28166,
-26731,
-25156,
-24535,
-24317,
-24580,
-24979,
-25689,
-26705,
-27684,
-27968,
-27084,
-25289,
-23650,
-23386,
-24867,
-27528,
-29740,
-30273,
-29013,
-26836,
-25337,
-25222,
-26307,
-27640,
-28100,
-27505,
-26531,
-25819,
-26576,
-27858,
-29365,
-29830,
-28967,
-27436,
-26001,
-25486,
-25823,
-26751,
-27991,
-29165,
-30408,
-30802,
-30453,
-28565,
-26620,
-25266,
-26067,
-28299,
-30806,
-31713,
-30693,
-28769,
-27479,
-27928,
-29141,
-30165,
-29783,
-28769,
-27946,
-28812,
-30361,
-32001,
-32156,
-31159,
-29786,
-29010,
-29077,
-29565,
-29586,
-29232,
-28966,
-29055,
-29874,
-30428,
-30407,
-29606,
-28526,
-28056,
-28458,
-29830,
-30827,
-31512,
-31227,
-30893,
-31225,
-32180,
-33504,
-33797,
-32729,
-30431,
-28455,
-27793,
-28966,
-30981,
-32179,
-32067,
-30626,
-29279,
-28587,
-29034,
-29542,
-29852,
-29610,
-29562,
-29942,
-30604,
-30851,
-30184,
-28810,
-27483,
-26972,
-27483,
-28590,
-29674,
-30407,
-30471,
-30253,
-29407,
-28392,
-27193,
-26619,
-26929,
-28146,
-29742,
-30649,
-30739,
-29917,
-28880,
-28232,
-27907,
-27656,
-27396,
-26883,
-26662,
-26865,
-27257,
-27929,
-28055,
-27861,
-27458,
-26687,
-26306,
-25668,
-25776,
-25975,
-26951,
-28148,
-29429,
-30165,
-29983,
-29166,
-27992,
-27283,
-27283,
-27925,
-28744,
-28879,
-28278,
-27130,
-26218,
-26198,
-26951,
-28101,
-28725,
-28521,
-27794,
-26949,
-26619,
-26707,
-27040,
-27170,
-27220,
-27190,
-27530,
-28033,
-28525,
-28523,
-27837,
-27216,
-26884,
-27770,
-29277,
-30693,
-31117,
-30093,
-28592,
-27879,
-28591,
-30715,
-32290,
-32354,
-30694,
-28457,
-27614,
-28503,
-30228,
-31158,
-30075,
-28012,
-26000,
-26042,
-27061,
-28679,
-29010,
-28346,
-27593,
-27882,
-29430,
-31404,
-32775,
-32975,
-32202,
-31422,
-30829,
-30715,
-30827,
-31093,
-31491,
-31978,
-32356,
-32376,
-32114,
-31953,
-32181,
-32796,
-33331,
-33352,
-32730,
-32157,
-31889,
-32378,
-32888,
-32950,
-32491,
-31621,
-31360,
-31669,
-32420,
-32778,
-32574,
-31803,
-31534,
-32069,
-33594,
-34859,
-35500,
-34769,
-33595,
-32601,
-32818,
-34107,
-36008,
-37450,
-37915,
-37140,
-35853,
-34594,
-34059,
-34372,
-35234,
-36231,
-36719,
-36895,
-36564,
-36298,
-36141,
-36279,
-36271,
-36346,
-36096,
-35987,
-36034,
-36473,
-37208,
-37845,
-37918,
-37224,
-35903,
-34811,
-34172,
-34903,
-36030,
-37496,
-38312,
-38624,
-38667,
-38933,
-39511,
-39995,
-39710,
-38666,
-36919,
-35633,
-35523,
-36739,
-38891,
-40505,
-40905,
-39931,
-38289,
-37120,
-37137,
-38137,
-39532,
-40128,
-39954,
-38866,
-38048,
-37715,
-38202,
-38868,
-39553,
-39555,
-39530,
-39266,
-39399,
-39708,
-40042,
-40106,
-39910,
-39729,
-39355,
-39509,
-39488,
-39663,
-39844,
-39728,
-39667,
-39308,
-38846,
-38247,
-37471,
-37140,
-37183,
-38047,
-39223,
-40305,
-40796,
-40482,
-39799,
-39241,
-39290,
-40217,
-41172,
-41745,
-41283,
-39928,
-38603,
-38180,
-38866,
-40464,
-41324,
-41238,
-39774,
-38270,
-37427,
-37692,
-38249,
-38443,
-37475,
-36495,
-35900,
-36629,
-37870,
-38646,
-38491,
-37649,
-36872,
-36986,
-37094,
-37317,
-36785,
-36652,
-37140,
-38600,
-39865,
-39797,
-38555,
-36878,
-36403,
-37255,
-38686,
-38891,
-37516,
-35477,
-34417,
-35032,
-36833,
-37822,
-37365,
-35762,
-34462,
-34879,
-36231,
-37584,
-37491,
-36079,
-34501,
-34086,
-34988,
-36476,
-37051,
-36231,
-34526,
-33020,
-32841,
-33840,
-35302,
-36029,
-35548,
-34346,
-33265,
-33262,
-34217,
-35409,
-35992,
-35296,
-34176,
-33238,
-33330,
-34350,
-35277,
-35612,
-34947,
-34060,
-33684,
-34304,
-35589,
-36829,
-37052,
-36252,
-34416,
-32598,
-31181,
-31116,
-32043,
-33708,
-34879,
-34859,
-33528,
-31625,
-30250,
-30318,
-31402,
-32888,
-33261,
-32757,
-31753,
-31473,
-32108,
-33443,
-34214,
-33862,
-32753,
-31692,
-31778,
-32953,
-34261,
-34834,
-33863,
-32266,
-30803,
-30741,
-31998,
-33908,
-35032,
-34972,
-33637,
-32003,
-31025,
-30937,
-31359,
-31581,
-31090,
-30099,
-29429,
-29232,
-29921,
-30646,
-30964,
-30801,
-30142,
-29940,
-30030,
-30716,
-31624,
-32289,
-32863,
-32645,
-32088,
-30872,
-30029,
-29453,
-30074,
-30672,
-31114,
-30562,
-29541,
-29145,
-29762,
-31536,
-33064,
-33329,
-32268,
-30338,
-29167,
-28854,
-28967,
-28633,
-27461,
-26330,
-26287,
-27746,
-29788,
-31179,
-30762,
-29275,
-27860,
-27769,
-28945,
-30383,
-31027,
-30626,
-29588,
-29032,
-29010,
-29522,
-29671,
-29214,
-28476,
-27484,
-27260,
-27261,
-27704,
-28034,
-28260,
-28344,
-28437,
-28433,
-28147,
-27526,
-26530,
-25689,
-25443,
-25845,
-26549,
-26755,
-26127,
-25183,
-24776,
-25802,
-27679,
-29611,
-29961,
-28834,
-26929,
-25821,
-26219,
-27682,
-28766,
-28613,
-27061,
-25555,
-25045,
-25734,
-27038,
-27704,
-27305,
-26043,
-24979,
-24603,
-25266,
-25911,
-26308,
-25644,
-24847,
-24202,
-24539,
-25663,
-26842,
-27527,
-27015,
-25979,
-24777,
-24472,
-24933,
-26001,
-26837,
-27131,
-26904,
-26442,
-26330,
-26641,
-27106,
-27437,
-27240,
-26594,
-25868,
-25443,
-25488,
-25978,
-26461,
-26865,
-26948,
-26952,
-26795,
-26663,
-26374,
-26155,
-26018,
-26067,
-26483,
-26909,
-27347,
-27662,
-27855,
-28262,
-28741,
-29035,
-29186,
-28768,
-28434,
-28015,
-28190,
-28302,
-28634,
-28523,
-28435,
-28213,
-28236,
-28366,
-28615,
-29007,
-29323,
-29830,
-30160,
-30122,
-29648,
-28860,
-28298,
-28459,
-29432,
-30847,
-31870,
-32109,
-31027,
-29942,
-28810,
-29033,
-29874,
-30981,
-31450,
-31134,
-30274,
-30095,
-30672,
-32002,
-33019,
-32841,
-31626,
-30183,
-29610,
-30538,
-32310,
-33841,
-34169,
-33554,
-32308,
-31759,
-31600,
-31937,
-32264,
-32689,
-33151,
-33862,
-34238,
-34149,
-33308,
-32287,
-31915,
-32285,
-33466,
-34235,
-34262,
-33152,
-31845,
-31160,
-31689,
-32977,
-34524,
-35082,
-34921,
-34130,
-33793,
-34283,
-35169,
-35896,
-35548,
-34478,
-33511,
-33392,
-34484,
-35810,
-36252,
-35592,
-34100,
-33134,
-33306,
-34505,
-35920,
-36763,
-36674,
-36276,
-35921,
-35677,
-35678,
-35146,
-35168,
-35168,
-36231,
-37029,
-37582,
-37384,
-36650,
-36411,
-36362,
-36986,
-36983,
-36652,
-35989,
-35675,
-36146,
-36959,
-37673,
-37648,
-37559,
-37320,
-37622,
-37721,
-37178,
-35992,
-34744,
-34461,
-35699,
-37871,
-39996,
-40949,
-40484,
-39266,
-37959,
-37316,
-36963,
-37315,
-37673,
-38533,
-39333,
-39798,
-39574,
-38759,
-37845,
-37518,
-37715,
-38312,
-38559,
-38665,
-38693,
-39196,
-39822,
-40084,
-39199,
-37694,
-36386,
-36452,
-38115,
-40151,
-41480,
-41217,
-40016,
-39069,
-39175,
-40064,
-40728,
-40505,
-39533,
-38733,
-38734,
-39466,
-40128,
-40353,
-39884,
-39577,
-39531,
-39553,
-39466,
-38822,
-38446,
-38758,
-39772,
-40886,
-40857,
-39912,
-38243,
-37497,
-38000,
-39534,
-40615,
-40929,
-39817,
-38980,
-38465,
-39070,
-39683,
-39912,
-39173,
-38272,
-37647,
-38070,
-38978,
-40041,
-40373,
-39975,
-39220,
-38713,
-38822,
-39467,
-39861,
-39933,
-39462,
-39025,
-39198,
-39642,
-40219,
-39774,
-38647,
-36894,
-35791,
-35607,
-36102,
-36716,
-36786,
-36520,
-36318,
-36454,
-36917,
-36940,
-36764,
-35963,
-35680,
-35654,
-36032,
-36254,
-36163,
-36345,
-36782,
-37918,
-38509,
-38317,
-36626,
-34795,
-33549,
-33752,
-35101,
-36097,
-36344,
-35277,
-33929,
-33064,
-32929,
-33376,
-33462,
-33263,
-32599,
-32334,
-32330,
-32780,
-33061,
-32998,
-32622,
-32221,
-32223,
-32399,
-32753,
-32689,
-32376,
-31891,
-31756,
-32023,
-32666,
-32974,
-32733,
-31800,
-30341,
-29386,
-28900,
-29299,
-29829,
-30297,
-30226,
-29943,
-29608,
-29409,
-29609,
-29519,
-29432,
-28877,
-28524,
-28456,
-29055,
-30008,
-31024,
-31361,
-30780,
-29255,
-27550,
-26482,
-26600,
-27990,
-29719,
-30938,
-30694,
-29408,
-27795,
-26859,
-26953,
-27724,
-28237,
-28367,
-27681,
-27440,
-27303,
-27771,
-28058,
-27813,
-27352,
-26750,
-26684,
-26753,
-26926,
-26887,
-27037,
-27196,
-27990,
-27949,
-27835,
-26730,
-26131,
-26264,
-27084,
-28323,
-28391,
-28014,
-27127,
-27239,
-28169,
-29209,
-29322,
-28146,
-26508,
-25732,
-26397,
-28146,
-29367,
-29495,
-28394,
-27390,
-26997,
-27569,
-27816,
-27636,
-26576,
-25774,
-25668,
-26462,
-27239,
-27748,
-27261,
-26617,
-26045,
-26151,
-26332,
-26661,
-26531,
-26440,
-26686,
-27305,
-28412,
-29277,
-29784,
-29766,
-29252,
-28703,
-28211,
-27992,
-28237,
-28255,
-28503,
-28212,
-27926,
-27481,
-27573,
-27611,
-28196,
-28165,
-28171,
-27703,
-27482,
-27593,
-27793,
-28124,
-27859,
-27371,
-26796,
-26751,
-27484,
-28830,
-29878,
-30291,
-29302,
-28035,
-26994,
-27263,
-28830,
-30607,
-31735,
-31048,
-29565,
-28013,
-27903,
-29166,
-30649,
-31426,
-30758,
-29479,
-28764,
-29167,
-30273,
-31003,
-30695,
-29586,
-28700,
-28546,
-29254,
-30140,
-30428,
-30651,
-30691,
-31495,
-32085,
-32248,
-31334,
-29876,
-28854,
-28967,
-30095,
-31603,
-32310,
-31935,
-31003,
-30119,
-30272,
-31094,
-32354,
-33064,
-33242,
-32908,
-32599,
-32931,
-33241,
-33706,
-33176,
-32265,
-31071,
-30695,
-31156,
-32514,
-33570,
-33930,
-33108,
-31999,
-31249,
-31446,
-32754,
-33795,
-34415,
-33706,
-32554,
-31757,
-32067,
-33220,
-34525,
-34969,
-34126,
-32778,
-31644,
-31649,
-32619,
-33818,
-34526,
-34458,
-33973,
-33595,
-33641,
-33838,
-34039,
-33728,
-33462,
-33309,
-33727,
-34572,
-35232,
-35548,
-34965,
-34418,
-33727,
-33861,
-34129,
-34612,
-34461,
-34038,
-33551,
-33529,
-34282,
-35102,
-35655,
-35235,
-34459,
-33528,
-33243,
-33217,
-33486,
-33439,
-33376,
-33527,
-33951,
-34681,
-35077,
-35438,
-35496,
-36080,
-36604,
-36878,
-36293,
-35040,
-34012,
-33908,
-34725,
-35854,
-36188,
-35676,
-34882,
-34767,
-35459,
-36471,
-36345,
-35189,
-33530,
-32752,
-33575,
-35343,
-36898,
-37139,
-36163,
-34994,
-34500,
-35104,
-35876,
-36364,
-36209,
-35855,
-36120,
-36808,
-37670,
-37981,
-37339,
-36209,
-35080,
-34659,
-35033,
-35769,
-36383,
-36367,
-35942,
-35390,
-35212,
-35811,
-36983,
-38093,
-38733,
-38358,
-37273,
-36075,
-35302,
-35455,
-36232,
-37383,
-37935,
-38029,
-37400,
-36769,
-36093,
-35902,
-35832,
-36296,
-36655,
-37425,
-37760,
-37804,
-37361,
-36520,
-36119,
-36166,
-36850,
-37473,
-37716,
-37358,
-36966,
-36803,
-37143,
-37314,
-37097,
-36341,
-35766,
-36144,
-37359,
-38691,
-39310,
-38402,
-37383,
-36431,
-36851,
-37781,
-38470,
-38489,
-37584,
-37249,
-37206,
-37759,
-38026,
-37471,
-36831,
-36340,
-36498,
-37006,
-36940,
-36410,
-35808,
-35790,
-36695,
-37738,
-37804,
-36984,
-35412,
-34835,
-35280,
-36717,
-37695,
-37492,
-36698,
-35808,
-35990,
-36607,
-37293,
-37209,
-36980,
-36966,
-37846,
-38867,
-39489,
-38798,
-37496,
-36252,
-35789,
-36186,
-36542,
-36276,
-35410,
-34595,
-34346,
-34903,
-35567,
-35766,
-35234,
-34328,
-33483,
-33220,
-33661,
-34305,
-34901,
-35192,
-35122,
-34860,
-34479,
-34240,
-34236,
-34460,
-34814,
-35212,
-35235,
-35056,
-34572,
-34147,
-34173,
-34747,
-35787,
-36433,
-36384,
-35081,
-33351,
-31890,
-31469,
-32069,
-32795,
-33089,
-32308,
-31272,
-30803,
-31027,
-32154,
-32580,
-32506,
-31583,
-30825,
-30849,
-31537,
-32419,
-32757,
-32241,
-31383,
-30605,
-30448,
-30720,
-31354,
-31761,
-32020,
-32025,
-31755,
-31449,
-30848,
-30562,
-30249,
-30497,
-30713,
-30897,
-30779,
-30298,
-29917,
-29520,
-29454,
-29542,
-29541,
-29478,
-29340,
-29211,
-29344,
-29694,
-29833,
-29851,
-29254,
-28656,
-28214,
-28389,
-28880,
-29429,
-29455,
-29120,
-28747,
-28631,
-29168,
-29563,
-29919,
-29366,
-28965,
-28368,
-28790,
-29031,
-29301,
-28764,
-27861,
-27104,
-27129,
-27992,
-29097,
-29832,
-29739,
-28859,
-28033,
-27772,
-28323,
-29342,
-29920,
-29696,
-28679,
-27659,
-27106,
-27681,
-28457,
-29454,
-29342,
-28900,
-27993,
-27524,
-27795,
-28233,
-28879,
-28789,
-28323,
-27970,
-27705,
-28387,
-28793,
-29207,
-28790,
-27904,
-27347,
-27241,
-27967,
-28903,
-29384,
-29345,
-28854,
-28611,
-28881,
-29361,
-29834,
-29472,
-29034,
-28347,
-28300,
-28658,
-29097,
-29189,
-29033,
-28589,
-28479,
-28346,
-28301,
-28016,
-27636,
-27526,
-27661,
-28300,
-28813,
-29297,
-29366,
-29298,
-29144,
-28966,
-28833,
-28634,
-28679,
-28633,
-29278,
-29672,
-30564,
-30713,
-30896,
-30316,
-29874,
-29277,
-29142,
-29034,
-29122,
-29297,
-29321,
-29741,
-29941,
-30075,
-29917,
-29321,
-28790,
-28654,
-29146,
-30138,
-31072,
-31335,
-30961,
-30161,
-29566,
-29828,
-30474,
-31512,
-31979,
-31847,
-31490,
-30982,
-31248,
-31778,
-32578,
-33042,
-32819,
-32179,
-31335,
-30872,
-30893,
-31247,
-31692,
-31778,
-31602,
-31115,
-30893,
-31092,
-31582,
-32130,
-32314,
-31999,
-31691,
-31536,
-32111,
-33085,
-34129,
-34591,
-34393,
-33796,
-33305,
-33199,
-33395,
-33728,
-33708,
-33748,
-33686,
-33838,
-33950,
-33861,
-33331,
-32818,
-32402,
-32442,
-33042,
-33419,
-33727,
-33642,
-33306,
-33285,
-33331,
-33461,
-33841,
-33772,
-34037,
-34195,
-34303,
-34373,
-34036,
-33531,
-33129,
-32931,
-33397,
-33861,
-34481,
-34394,
-34060,
-33418,
-33175,
-33374,
-33993,
-34351,
-34235,
-33531,
-32952,
-32887,
-33618,
-34680,
-35146,
-35058,
-33838,
-32999,
-32509,
-33175,
-34105,
-34946,
-34770,
-33905,
-32755,
-32043,
-32312,
-33042,
-34015,
-34173,
-33837,
-32910,
-32355,
-32245,
-32575,
-33109,
-33130,
-33263,
-33087,
-33152,
-33041,
-32865,
-32422,
-32465,
-32733,
-33749,
-34460,
-34548,
-33949,
-32932,
-32354,
-32622,
-32931,
-33484,
-33174,
-33177,
-33305,
-33819,
-34502,
-34195,
-33063,
-31580,
-30495,
-30737,
-31847,
-33085,
-33729,
-33529,
-33130,
-32665,
-32953,
-33042,
-33175,
-32775,
-32334,
-31955,
-31979,
-32200,
-32555,
-32754,
-33018,
-33243,
-33482,
-33754,
-33504,
-33199,
-32641,
-32378,
-32511,
-33151,
-33995,
-34592,
-34569,
-34129,
-33395,
-32953,
-33021,
-33371,
-33798,
-34059,
-33928,
-33619,
-33415,
-33157,
-33192,
-33002,
-33126,
-33000,
-33418,
-33417,
-33818,
-33816,
-33994,
-34217,
-34546,
-34970,
-35212,
-35056,
-34683,
-34125,
-33885,
-34148,
-34770,
-35589,
-35986,
-36079,
-35497,
-34972,
-34767,
-34903,
-35633,
-36032,
-36209,
-35678,
-35034,
-34416,
-34592,
-34879,
-35680,
-35763,
-35680,
-35166,
-34882,
-35012,
-35612,
-36096,
-36433,
-36252,
-36033,
-36275,
-36961,
-37894,
-38489,
-38426,
-37536,
-36543,
-35676,
-35679,
-36008,
-36698,
-37182,
-37142,
-37114,
-36544,
-36362,
-36011,
-36099,
-36008,
-36233,
-36163,
-36322,
-36473,
-36810,
-37225,
-37318,
-36939,
-36211,
-35299,
-35237,
-35851,
-37275,
-38335,
-38755,
-37762,
-36671,
-35547,
-35721,
-36429,
-37497,
-37933,
-37940,
-37492,
-37273,
-37094,
-37186,
-36715,
-36214,
-35628,
-35349,
-35720,
-36210,
-36608,
-36518,
-35922,
-35412,
-34945,
-35104,
-35209,
-35171,
-34724,
-34193,
-33974,
-34500,
-35504,
-36272,
-36434,
-35631,
-34659,
-34305,
-34790,
-36012,
-37181,
-37474,
-37249,
-36453,
-35966,
-35765,
-35723,
-35787,
-35591,
-35697,
-35591,
-35477,
-35079,
-34439,
-33970,
-33752,
-34059,
-34173,
-33882,
-33199,
-32242,
-32201,
-32665,
-33684,
-34438,
-34436,
-33950,
-33551,
-33308,
-33794,
-34151,
-34389,
-34464,
-34278,
-34573,
-34768,
-35079,
-35214,
-34835,
-34614,
-34173,
-33990,
-33845,
-33568,
-33688,
-33682,
-33994,
-34106,
-33883,
-33329,
-32644,
-32177,
-32090,
-32421,
-32577,
-32687,
-32355,
-32090,
-31689,
-31737,
-31667,
-32068,
-32111,
-32466,
-32311,
-32354,
-31892,
-31776,
-31606,
-32019,
-32646,
-33150,
-33443,
-32994,
-32404,
-31664,
-31517,
-31687,
-32203,
-32397,
-32070,
-31223,
-30274,
-29764,
-29896,
-30472,
-31005,
-31003,
-30318,
-29321,
-28522,
-28392,
-28809,
-29677,
-30161,
-30362,
-30030,
-29696,
-29388,
-29365,
-29452,
-29411,
-29386,
-29298,
-29411,
-29650,
-29855,
-29895,
-29497,
-29013,
-28343,
-28083,
-27990,
-28324,
-28480,
-28699,
-28569,
-28501,
-28278,
-28281,
-28079,
-27926,
-27528,
-27324,
-27197,
-27458,
-28037,
-28412,
-28613,
-28190,
-27616,
-27171,
-27195,
-27636,
-28193,
-28367,
-28346,
-28147,
-28389,
-28858,
-29186,
-29143,
-28502,
-27813,
-27595,
-27858,
-28235,
-28146,
-27571,
-27040,
-27282,
-28259,
-29517,
-29855,
-29230,
-27794,
-26906,
-27104,
-28216,
-29362,
-29633,
-29209,
-27991,
-27705,
-27747,
-28524,
-29231,
-29344,
-29452,
-29255,
-29631,
-30161,
-30607,
-30582,
-29941,
-29298,
-28834,
-29188,
-29718,
-30231,
-29938,
-29345,
-28766,
-28745,
-29586,
-30141,
-30295,
-29497,
-28746,
-28521,
-29457,
-30714,
-31624,
-31537,
-30646,
-29879,
-29782,
-30187,
-30759,
-30649,
-30341,
-30160,
-30409,
-31223,
-31603,
-31602,
-30715,
-30142,
-29585,
-30008,
-30538,
-31161,
-31599,
-31782,
-31866,
-31559,
-31115,
-30338,
-29854,
-29806,
-30297,
-31003,
-31337,
-31358,
-31004,
-31136,
-31404,
-32088,
-32246,
-32021,
-31471,
-30847,
-31006,
-31424,
-32199,
-32623,
-32552,
-32070,
-31467,
-31071,
-30893,
-30915,
-30851,
-30934,
-30919,
-31266,
-31561,
-32243,
-32465,
-32755,
-32420,
-32291,
-31865,
-31693,
-31533,
-31450,
-31556,
-31801,
-32378,
-32975,
-33463,
-33418,
-32975,
-32178,
-31491,
-31072,
-31090,
-31449,
-31645,
-31890,
-31891,
-31889,
-31868,
-32000,
-31958,
-31954,
-31849,
-31820,
-32159,
-32485,
-33066,
-33085,
-32865,
-32444,
-32044,
-32356,
-32575,
-33177,
-32884,
-32534,
-31956,
-32132,
-32712,
-33482,
-33465,
-32819,
-31490,
-30896,
-30956,
-32137,
-33328,
-33972,
-33596,
-32776,
-32021,
-31849,
-32352,
-32933,
-33174,
-33041,
-32534,
-32176,
-32113,
-32420,
-32933,
-33216,
-33312,
-32947,
-32761,
-32725,
-33223,
-33904,
-34437,
-34638,
-34170,
-33640,
-33020,
-32907,
-33089,
-33327,
-33442,
-33263,
-32996,
-32889,
-33262,
-33817,
-34503,
-34682,
-34480,
-34040,
-33638,
-33752,
-34126,
-34548,
-34814,
-34392,
-33996,
-33593,
-33863,
-34436,
-35036,
-35279,
-34834,
-34395,
-33992,
-34307,
-34943,
-35592,
-35986,
-35744,
-35590,
-35432,
-35547,
-35786,
-35768,
-35588,
-35345,
-35214,
-35520,
-35989,
-36497,
-36718,
-36498,
-36120,
-35699,
-35324,
-35366,
-35480,
-35832,
-36142,
-36608,
-36852,
-37049,
-37009,
-36606,
-36099,
-35833,
-35677,
-36186,
-36677,
-37136,
-37586,
-37690,
-37806,
-37868,
-37452,
-37027,
-36564,
-36608,
-37360,
-38337,
-38954,
-38690,
-37606,
-36739,
-36764,
-37914,
-39354,
-39975,
-39177,
-37427,
-35833,
-35390,
-36229,
-37496,
-38489,
-38381,
-37848,
-36938,
-36765,
-36960,
-37608,
-38376,
-38781,
-38931,
-38470,
-38003,
-37715,
-38247,
-39443,
-40704,
-41195,
-40349,
-38846,
-37539,
-37601,
-38783,
-40214,
-40376,
-39419,
-37717,
-37071,
-37739,
-39198,
-40240,
-39777,
-38156,
-36655,
-36338,
-37409,
-39218,
-40065,
-40108,
-38842,
-38052,
-37645,
-38514,
-39333,
-40039,
-39888,
-39198,
-38513,
-38224,
-38381,
-39043,
-39466,
-39885,
-39864,
-39730,
-39600,
-39419,
-39045,
-38778,
-38290,
-38183,
-38067,
-38094,
-38023,
-37961,
-38089,
-38538,
-39130,
-39622,
-39287,
-38490,
-37295,
-36674,
-36719,
-37670,
-38536,
-38954,
-38292,
-37096,
-36119,
-36011,
-37006,
-38025,
-38314,
-37338,
-35789,
-34835,
-35612,
-37403,
-39047,
-39108,
-37585,
-35631,
-35059,
-35698,
-36920,
-36827,
-35369,
-33617,
-33330,
-34659,
-36496,
-36520,
-34746,
-32091,
-31245,
-32557,
-34901,
-36010,
-34725,
-32533,
-31312,
-32380,
-34324,
-35147,
-33375,
-30403,
-28616,
-29295,
-32179,
-34305,
-34435,
-32601,
-30316,
-29565,
-29719,
-30229,
-29940,
-29432,
-29697,
-31092,
-32733,
-32952,
-31358,
-28791,
-27147,
-27374,
-28655,
-29320,
-28525,
-26483,
-25336,
-25753,
-27771,
-29410,
-29429,
-27683,
-25555,
-24713,
-25512,
-27238,
-28523,
-28346,
-27085,
-25642,
-24847,
-25180,
-26107,
-26819,
-27017,
-26130,
-25159,
-24068,
-24118,
-24690,
-25976,
-26820,
-26614,
-25649,
-24177,
-23433,
-23559,
-24670,
-25424,
-25574,
-24384,
-22829,
-21791,
-22012,
-23449,
-25003,
-25953,
-25422,
-24117,
-22874,
-22521,
-23496,
-24734,
-25645,
-25334,
-24270,
-23185,
-23008,
-23850,
-25024,
-25687,
-25180,
-23781,
-22612,
-22254,
-23428,
-24892,
-26307,
-26066,
-25112,
-23451,
-23074,
-23473,
-24959,
-25618,
-25250,
-23889,
-22679,
-22874,
-24557,
-26909,
-28433,
-28191,
-26663,
-24779,
-23829,
-23915,
-24782,
-25264,
-25825,
-25928,
-26466,
-27237,
-27793,
-28036,
-27748,
-27127,
-26642,
-26262,
-26000,
-25997,
-26420,
-27215,
-28459,
-28941,
-28748,
-27590,
-26443,
-26197,
-27017,
-28546,
-29496,
-29767,
-29316,
-28927,
-29294,
-29767,
-30471,
-30206,
-29809,
-29276,
-29187,
-29478,
-29627,
-29590,
-29495,
-29633,
-30249,
-30961,
-31136,
-30850,
-30006,
-29854,
-30093,
-31163,
-31753,
-31870,
-31093,
-30315,
-30254,
-30912,
-32357,
-33286,
-33571,
-32734,
-31577,
-30698,
-30667,
-31319,
-32239,
-32848,
-32683,
-32114,
-31556,
-31426,
-32111,
-32909,
-33684,
-33772,
-33088,
-32551,
-31960,
-32308,
-32866,
-33374,
-33461,
-32955,
-32420,
-32024,
-32466,
-32995,
-33599,
-33326,
-32780,
-31775,
-31716,
-32197,
-33554,
-34811,
-35082,
-34479,
-33021,
-31735,
-31423,
-31981,
-33239,
-33973,
-34260,
-33573,
-33130,
-32689,
-32950,
-33134,
-33437,
-33554,
-33748,
-34084,
-34415,
-34105,
-33661,
-32755,
-32197,
-32249,
-32439,
-32847,
-32772,
-32623,
-32332,
-32311,
-32400,
-32399,
-32532,
-32754,
-33663,
-34611,
-35372,
-35031,
-34019,
-32842,
-32376,
-32976,
-33884,
-34413,
-34041,
-33217,
-32755,
-33040,
-33908,
-34478,
-34352,
-33681,
-33243,
-33351,
-33883,
-34394,
-34081,
-33464,
-32619,
-32446,
-32730,
-33242,
-33595,
-33839,
-33950,
-34415,
-34792,
-34990,
-34814,
-34305,
-34103,
-34351,
-35122,
-35656,
-35877,
-35477,
-34948,
-34901,
-35103,
-35920,
-36187,
-36122,
-35342,
-34729,
-34367,
-34993,
-35876,
-36653,
-36851,
-36121,
-35498,
-34971,
-35433,
-36210,
-37028,
-37316,
-37096,
-36585,
-36431,
-36364,
-36806,
-37032,
-37489,
-37653,
-37956,
-37872,
-37649,
-37226,
-37030,
-37383,
-38180,
-39045,
-39464,
-39310,
-39046,
-38732,
-38913,
-38999,
-38845,
-38226,
-37602,
-37186,
-37869,
-38756,
-39999,
-40413,
-40356,
-39683,
-39090,
-38800,
-38889,
-39266,
-39753,
-40086,
-40305,
-39866,
-39462,
-38693,
-38665,
-39002,
-39951,
-40906,
-41369,
-41148,
-40508,
-39905,
-39823,
-40237,
-40708,
-40947,
-40575,
-40061,
-39554,
-39665,
-40150,
-40796,
-41059,
-40616,
-39998,
-39220,
-39245,
-39619,
-40175,
-40304,
-39713,
-38951,
-38251,
-38643,
-39400,
-40704,
-41083,
-40771,
-39643,
-38557,
-38268,
-38780,
-39884,
-40685,
-40792,
-40109,
-39199,
-38490,
-38425,
-38644,
-38824,
-38423,
-37628,
-36805,
-36367,
-37026,
-38005,
-39066,
-39353,
-38536,
-37339,
-36098,
-35766,
-36165,
-37071,
-37652,
-37735,
-37141,
-36739,
-36542,
-37074,
-37558,
-37873,
-37536,
-37007,
-36165,
-35899,
-35566,
-35635,
-35432,
-35213,
-34791,
-34438,
-34192,
-34107,
-34080,
-34218,
-34015,
-33862,
-33218,
-33020,
-33263,
-34194,
-35146,
-35233,
-34262,
-32486,
-31205,
-31158,
-32533,
-34214,
-34971,
-34590,
-33155,
-32352,
-32291,
-32708,
-32866,
-32177,
-31358,
-31004,
-31603,
-32243,
-32267,
-31093,
-29453,
-28634,
-28966,
-30406,
-31293,
-31180,
-30075,
-29008,
-28969,
-29540,
-30452,
-30361,
-29608,
-28613,
-28145,
-28680,
-29541,
-30119,
-29828,
-29014,
-28009,
-27753,
-28077,
-28812,
-29055,
-28855,
-27970,
-27527,
-27370,
-27704,
-27815,
-27283,
-26086,
-25225,
-24954,
-25891,
-26880,
-27309,
-26704,
-25846,
-25575,
-26221,
-27415,
-28102,
-27528,
-26262,
-25004,
-24644,
-25160,
-25662,
-25737,
-25329,
-24696,
-24997,
-25338,
-26194,
-26422,
-26284,
-26110,
-25865,
-26042,
-25712,
-25419,
-24651,
-24311,
-24118,
-24093,
-24048,
-23586,
-23604,
-23806,
-24759,
-25576,
-25999,
-25733,
-25176,
-24939,
-25308,
-25912,
-26351,
-25976,
-25357,
-24690,
-24671,
-25088,
-25557,
-25730,
-25470,
-25264,
-25402,
-25755,
-26306,
-26289,
-26195,
-25645,
-25555,
-25732,
-26110,
-26418,
-26309,
-25952,
-25491,
-25398,
-25825,
-26458,
-27288,
-27654,
-27931,
-28030,
-28264,
-28584,
-28572,
-28254,
-27418,
-26684,
-26464,
-26795,
-27616,
-28101,
-28237,
-27857,
-27683,
-27968,
-28724,
-29563,
-29898,
-29606,
-28969,
-28521,
-28635,
-29409,
-29985,
-30185,
-29430,
-28459,
-27723,
-27839,
-28788,
-29985,
-30871,
-31138,
-30848,
-30870,
-31118,
-31753,
-32115,
-31645,
-30714,
-29545,
-28987,
-29100,
-29807,
-30739,
-31313,
-31802,
-31713,
-31534,
-31140,
-30779,
-30896,
-31223,
-32025,
-32353,
-32336,
-31820,
-31406,
-31444,
-31714,
-31890,
-31226,
-30450,
-29874,
-30672,
-32575,
-34772,
-35985,
-35790,
-34304,
-33151,
-32402,
-32707,
-32800,
-32729,
-32026,
-31732,
-31606,
-32063,
-32114,
-31644,
-30762,
-30119,
-30448,
-31692,
-33151,
-34261,
-34038,
-33419,
-32354,
-32157,
-32509,
-33219,
-33707,
-33483,
-33000,
-32707,
-33176,
-34393,
-35454,
-36013,
-35386,
-34462,
-33771,
-33641,
-34126,
-34173,
-33615,
-32623,
-31756,
-31691,
-32311,
-32953,
-33174,
-32799,
-32421,
-32444,
-33019,
-33752,
-34258,
-34549,
-34371,
-34436,
-34350,
-34281,
-34083,
-33817,
-33817,
-34038,
-34327,
-34526,
-34657,
-34860,
-35609,
-36299,
-37073,
-36761,
-36012,
-34745,
-34173,
-33994,
-34525,
-34615,
-34459,
-33994,
-33884,
-34104,
-34660,
-34679,
-34527,
-34060,
-34326,
-34925,
-35899,
-36209,
-35966,
-35521,
-35369,
-36118,
-36922,
-37379,
-37164,
-36540,
-36497,
-37007,
-37848,
-38024,
-37563,
-36715,
-36434,
-37004,
-37937,
-38492,
-38090,
-37052,
-36099,
-36096,
-36743,
-37647,
-37805,
-37228,
-36275,
-35899,
-36276,
-37337,
-38317,
-38397,
-37897,
-36848,
-36610,
-37204,
-38559,
-39950,
-40464,
-40171,
-39114,
-38465,
-38228,
-38754,
-39155,
-39289,
-38910,
-38493,
-38244,
-38249,
-38399,
-38516,
-38555,
-38625,
-38798,
-39002,
-39065,
-38957,
-38955,
-38977,
-39379,
-39705,
-39735,
-39528,
-39090,
-39045,
-39397,
-40020,
-40638,
-40683,
-40486,
-40061,
-39976,
-40216,
-40663,
-40682,
-40485,
-39597,
-39067,
-38623,
-38735,
-38798,
-38626,
-37935,
-37252,
-36939,
-37472,
-38556,
-39400,
-39486,
-38735,
-37693,
-37427,
-37959,
-39354,
-40263,
-40505,
-39711,
-38753,
-38316,
-38490,
-39220,
-39689,
-39861,
-39379,
-38798,
-38005,
-37581,
-37363,
-37780,
-38402,
-39200,
-39286,
-38581,
-37205,
-35832,
-34993,
-35098,
-35437,
-35742,
-35324,
-34814,
-34524,
-35236,
-36475,
-37825,
-38204,
-37581,
-36143,
-35190,
-35103,
-36229,
-37230,
-37492,
-36210,
-34149,
-32533,
-32065,
-33089,
-34279,
-34750,
-33903,
-32379,
-31314,
-31557,
-33042,
-34680,
-35678,
-35368,
-34437,
-33240,
-32644,
-32243,
-32047,
-31577,
-30941,
-30381,
-29986,
-29896,
-29964,
-30293,
-30808,
-31333,
-31759,
-31757,
-31424,
-30849,
-30606,
-30516,
-30938,
-31115,
-31357,
-31050,
-30804,
-30250,
-29787,
-29076,
-28324,
-27506,
-27059,
-27063,
-27570,
-28501,
-28812,
-28810,
-28037,
-27261,
-26971,
-27219,
-27922,
-28062,
-27612,
-26819,
-26707,
-27814,
-29676,
-31025,
-30916,
-29099,
-26840,
-25556,
-25752,
-27065,
-27810,
-27443,
-26127,
-25049,
-25066,
-26220,
-27172,
-27239,
-25711,
-23716,
-22255,
-22233,
-23495,
-25047,
-26129,
-26089,
-25686,
-25136,
-25422,
-25931,
-26730,
-26883,
-26907,
-26775,
-26903,
-27397,
-27369,
-27041,
-25842,
-25290,
-25156,
-26109,
-26664,
-26417,
-24804,
-22984,
-21946,
-22764,
-24647,
-26574,
-27349,
-26530,
-25113,
-23738,
-23274,
-23163,
-23451,
-23562,
-24004,
-24936,
-25954,
-27083,
-27239,
-27127,
-26087,
-25490,
-24624,
-24448,
-24647,
-25488,
-26753,
-27791,
-27505,
-25998,
-23539,
-21901,
-21768,
-23029,
-24384,
-24622,
-23830,
-23404,
-25093,
-28942,
-33819,
-36961,
-37206,
-34637,
-31202,
-28326,
-26926,
-26001,
-25398,
-24582,
-24447,
-24912,
-25757,
-26040,
-25624,
-25066,
-25246,
-26220,
-27304,
-27417,
-26728,
-26088,
-26729,
-28766,
-30872,
-31380,
-29941,
-27616,
-26572,
-27751,
-30071,
-32225,
-32596,
-32290,
-32267,
-33484,
-35434,
-36387,
-35854,
-34194,
-32843,
-32663,
-33133,
-32862,
-31206,
-28853,
-27529,
-28366,
-31271,
-34016,
-35322,
-33952,
-31533,
-29544,
-29498,
-31002,
-32711,
-33218,
-32134,
-30784,
-30337,
-32157,
-34858,
-37250,
-37561,
-35920,
-34127,
-33662,
-35390,
-37803,
-39024,
-37978,
-35060,
-32619,
-31957,
-33663,
-36096,
-37741,
-37733,
-36546,
-35363,
-34795,
-35210,
-35745,
-36409,
-36629,
-36785,
-36852,
-36783,
-36832,
-36805,
-37074,
-37427,
-37582,
-37472,
-36918,
-36385,
-36145,
-36339,
-36523,
-36626,
-36035,
-35764,
-35568,
-36408,
-37383,
-38424,
-38601,
-38181,
-37095,
-36142,
-34992,
-34303,
-33375,
-32841,
-32578,
-32708,
-33442,
-34480,
-36144,
-38445,
-41437,
-44647,
-47640,
-49253,
-49589,
-48434,
-46732,
-45022,
-43432,
-41723,
-38956,
-35057,
-30583,
-26818,
-25157,
-25798,
-27704,
-29321,
-29297,
-28703,
-28875,
-31692,
-36718,
-42078,
-44959,
-44493,
-41458,
-38469,
-37071,
-37341,
-37934,
-37386,
-35786,
-34062,
-33262,
-33730,
-35033,
-36986,
-39819,
-43297,
-46487,
-47637,
-45512,
-41371,
-37360,
-35767,
-36474,
-36896,
-34459,
-28857,
-22651,
-20087,
-22364,
-28258,
-33462,
-35213,
-33750,
-31603,
-31600,
-34040,
-37160,
-38404,
-37181,
-34529,
-32662,
-32712,
-34324,
-36410,
-37648,
-38004,
-37383,
-36519,
-35788,
-35389,
-36210,
-37604,
-39533,
-40482,
-39821,
-37536,
-34617,
-32508,
-31847,
-32333,
-32863,
-32357,
-31136,
-29808,
-29675,
-31070,
-33241,
-34970,
-34946,
-33351,
-30717,
-28943,
-28635,
-29874,
-32001,
-33463,
-34435,
-34771,
-35589,
-37183,
-39378,
-41279,
-42234,
-41837,
-40681,
-39267,
-38291,
-37492,
-37010,
-36117,
-35303,
-34680,
-34437,
-35036,
-35699,
-36364,
-36498,
-36363,
-36209,
-36121,
-36474,
-36455,
-36339,
-35768,
-35322,
-35191,
-35633,
-36098,
-36342,
-36011,
-35366,
-34815,
-34856,
-35280,
-36165,
-37006,
-38003,
-39045,
-40328,
-41215,
-41747,
-41656,
-41306,
-41035,
-40287,
-39131,
-37096,
-34857,
-33530,
-33772,
-35457,
-37493,
-38047,
-37362,
-35720,
-35059,
-35899,
-37912,
-39647,
-40014,
-38826,
-37249,
-36119,
-36212,
-36473,
-36653,
-35567,
-34325,
-32910,
-32488,
-32797,
-33840,
-35124,
-36606,
-37608,
-38353,
-38317,
-37824,
-37096,
-36363,
-35812,
-35144,
-33974,
-32509,
-30849,
-29763,
-29655,
-30115,
-31296,
-31996,
-32692,
-32772,
-32845,
-32620,
-32510,
-32245,
-32044,
-31537,
-30891,
-29567,
-28121,
-26600,
-25995,
-26178,
-27014,
-27308,
-26992,
-26089,
-26152,
-27904,
-31579,
-35435,
-38068,
-38115,
-36431,
-34126,
-32955,
-32752,
-33064,
-32400,
-30583,
-28191,
-26020,
-25090,
-24935,
-25224,
-24933,
-24118,
-22695,
-21416,
-20591,
-20530,
-20990,
-21903,
-22364,
-22698,
-22256,
-22254,
-22432,
-23940,
-25287,
-26709,
-26750,
-26220,
-25689,
-26064,
-27615,
-29786,
-31403,
-32089,
-31690,
-31182,
-30826,
-31027,
-30937,
-30494,
-29321,
-28191,
-27128,
-26574,
-25776,
-24958,
-23473,
-22365,
-21636,
-21922,
-22454,
-22876,
-22475,
-21525,
-20351,
-19860,
-20000,
-20965,
-21884,
-22626,
-23147,
-24088,
-25448,
-27502,
-29233,
-30274,
-30228,
-29919,
-29785,
-30805,
-32355,
-33884,
-34503,
-33994,
-32710,
-31580,
-31092,
-31137,
-31513,
-31159,
-30341,
-28787,
-27329,
-26129,
-25513,
-25066,
-24782,
-24313,
-24006,
-23937,
-24139,
-24646,
-25070,
-25464,
-25911,
-26485,
-27128,
-27815,
-28367,
-28790,
-29608,
-30562,
-31911,
-32732,
-32776,
-32000,
-30829,
-30293,
-30209,
-30824,
-31050,
-31004,
-30604,
-30498,
-30667,
-31296,
-31399,
-31318,
-30800,
-30721,
-30978,
-31338,
-31491,
-30781,
-30142,
-29608,
-29852,
-30627,
-31137,
-31270,
-30916,
-30449,
-30429,
-30515,
-30630,
-30515,
-29942,
-29807,
-29564,
-29941,
-29853,
-29718,
-29344,
-28921,
-29077,
-29366,
-30028,
-30540,
-31180,
-31936,
-32730,
-33398,
-33837,
-33752,
-33528,
-33441,
-33507,
-33861,
-33906,
-33750,
-33351,
-32955,
-32929,
-32866,
-32709,
-32243,
-31560,
-31069,
-31093,
-31246,
-31759,
-31822,
-31781,
-31557,
-31468,
-31470,
-31690,
-31803,
-32199,
-32509,
-32933,
-33239,
-33265,
-33174,
-33063,
-33397,
-34304,
-35499,
-36809,
-37492,
-37961,
-37647,
-37694,
-37869,
-38403,
-39466,
-40061,
-40664,
-40480,
-40133,
-39308,
-38669,
-38003,
-37427,
-36984,
-36365,
-35876,
-35368,
-35057,
-35079,
-35059,
-35587,
-35812,
-36451,
-36919,
-37670,
-38403,
-38978,
-39353,
-39733,
-40126,
-40842,
-41677,
-42303,
-42719,
-42723,
-42630,
-42811,
-43163,
-43520,
-43672,
-43254,
-42940,
-42481,
-42939,
-43477,
-44336,
-44494,
-44249,
-43165,
-42054,
-40753,
-39972,
-39134,
-38690,
-38090,
-37851,
-37846,
-38336,
-38823,
-39309,
-39201,
-38888,
-38380,
-38513,
-38888,
-39998,
-40682,
-41038,
-40662,
-39907,
-39222,
-38690,
-38732,
-38893,
-39283,
-39758,
-40303,
-40840,
-41369,
-41459,
-41458,
-40973,
-40371,
-39776,
-39044,
-38269,
-37296,
-36118,
-34616,
-33218,
-31779,
-30652,
-30047,
-29747,
-30024,
-30632,
-31332,
-32293,
-32861,
-33289,
-33127,
-32512,
-31513,
-30650,
-30029,
-30029,
-30097,
-30050,
-29345,
-28520,
-27905,
-27991,
-28923,
-29607,
-30009,
-29363,
-28724,
-28146,
-28767,
-29388,
-30117,
-30008,
-29142,
-28458,
-27637,
-27438,
-26883,
-26156,
-25064,
-24208,
-23603,
-23586,
-23517,
-23561,
-23584,
-23829,
-24290,
-24695,
-24865,
-24539,
-24357,
-24360,
-24892,
-25331,
-25337,
-24865,
-24472,
-24757,
-25933,
-27458,
-28680,
-28987,
-28590,
-28546,
-28744,
-29919,
-30894,
-31755,
-32246,
-32620,
-33065,
-33196,
-32799,
-31667,
-30230,
-29009,
-28105,
-27480,
-26642,
-25775,
-25113,
-25511,
-26530,
-28035,
-29123,
-29362,
-29568,
-29893,
-31051,
-32376,
-33374,
-33440,
-32976,
-32444,
-32421,
-32954,
-33394,
-33708,
-33550,
-33597,
-34303,
-35456,
-37029,
-38070,
-38468,
-38136,
-37649,
-37294,
-37229,
-37515,
-37272,
-37030,
-36118,
-35326,
-34767,
-34261,
-33884,
-33106,
-32091,
-30871,
-30139,
-29876,
-30028,
-30384,
-30607,
-30824,
-31183,
-31734,
-32245,
-32576,
-32356,
-32066,
-31758,
-32000,
-32533,
-33130,
-33573,
-33663,
-33704,
-33864,
-34346,
-35037,
-35499,
-35656,
-35257,
-34657,
-34040,
-33838,
-33974,
-34545,
-35193,
-35985,
-36389,
-36894,
-37074,
-37138,
-37273,
-37073,
-37051,
-36851,
-36807,
-36829,
-37140,
-37692,
-38537,
-39506,
-40310,
-40969,
-41017,
-41302,
-41128,
-41568,
-41968,
-42545,
-42962,
-43124,
-42961,
-42723,
-42454,
-42566,
-42611,
-43076,
-43273,
-43388,
-43737,
-43896,
-44737,
-45556,
-46664,
-47505,
-48413,
-49034,
-49786,
-50453,
-51069,
-51539,
-51867,
-52023,
-52092,
-51846,
-51492,
-50761,
-50185,
-49831,
-50097,
-50762,
-51689,
-52270,
-52487,
-52313,
-52068,
-52111,
-52136,
-52510,
-52224,
-52311,
-51781,
-51846,
-51758,
-51958,
-52111,
-52246,
-52335,
-52288,
-51914,
-51137,
-50008,
-48703,
-47526,
-46487,
-45423,
-44072,
-42456,
-40815,
-39533,
-38732,
-38271,
-37824,
-37186,
-36473,
-35922,
-35677,
-35655,
-35368,
-35036,
-34458,
-34217,
-34303,
-34460,
-34504,
-33727,
-32423,
-30627,
-29078,
-27591,
-26797,
-25775,
-24915,
-23605,
-22411,
-21079,
-20043,
-19128,
-18294,
-17468,
-16453,
-15412,
-14300,
-13488,
-12793,
-12489,
-12289,
-12528,
-12735,
-13125,
-13309,
-13351,
-13372,
-13596,
-13859,
-14282,
-14258,
-13685,
-12773,
-11647,
-11001,
-10607,
-10270,
-9764,
-8743,
-7836,
-7037,
-6730,
-6195,
-5401,
-3959,
-2607,
-1768,
-1589,
-1922,
-2033,
-1832,
-1502,
-1435,
-2120,
-3052,
-3915,
-4336,
-4513,
-4803,
-5729,
-6797,
-7767,
-8436,
-8609,
-9188,
-9850,
-10739,
-11246,
-11070,
-10249,
-9231,
-8390,
-7681,
-7127,
-6151,
-5046,
-3892,
-2964,
-2165,
-1589,
-726,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-0,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-39,
-1392,
-3071,
-5047,
-7945,
-11624,
-15455,
-18954,
-22034,
-24647,
-27593,
-30561,
-33729,
-36274,
-37850,
-38488,
-38472,
-38464,
-38538,
-38999,
-39087,
-38849,
-38064,
-36767,
-35742,
-34371,
-33862,
-32975,
-32753,
-32400,
-32598,
-33287,
-34812,
-37140,
-40152,
-43407,
-46798,
-49940,
-53353,
-56809,
-60861,
-64981,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65533,
-65534,
-65534,
-65532,
-65534,
-65532,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-64319,
-61878,
-59711,
-57561,
-55679,
-53418,
-50630,
-47436,
-43942,
-40394,
-37051,
-33685,
-30715,
-27660,
-24779,
-21657,
-18403,
-15186,
-12225,
-9958,
-8127,
-6814,
-5247,
-3846,
-2722,
-2340,
-2809,
-3606,
-4468,
-4935,
-5464,
-6043,
-7171,
-8345,
-9519,
-10316,
-11248,
-12219,
-13398,
-14256,
-14505,
-14103,
-13949,
-14281,
-15634,
-17046,
-17873,
-17756,
-17030,
-16694,
-17183,
-18644,
-20108,
-21079,
-21238,
-21256,
-21681,
-23029,
-24981,
-27125,
-28704,
-30069,
-31187,
-33035,
-35330,
-38175,
-40687,
-42918,
-44604,
-46532,
-48966,
-51936,
-55102,
-57761,
-60085,
-62325,
-65134,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65533,
-65534,
-65529,
-65534,
-65533,
-65468,
-64076,
-63404,
-62792,
-62876,
-62920,
-63367,
-63405,
-63811,
-64225,
-65184,
-65531,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65532,
-65139,
-63274,
-60330,
-57850,
-55301,
-52910,
-49898,
-46087,
-42079,
-38535,
-35611,
-33507,
-30982,
-28323,
-25335,
-23073,
-21681,
-20836,
-20174,
-18821,
-17227,
-15633,
-14678,
-14307,
-13923,
-13176,
-12154,
-10958,
-10362,
-9939,
-9786,
-9275,
-8522,
-7415,
-6529,
-5665,
-4780,
-3692,
-2211,
-437,
-65535,
-1,
-65535,
-3,
-65535,
-0,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-3,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-65535,
-0,
-65535,
-3,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-3,
-65535,
-2,
-65535,
-65535,
-1,
-5397,
-10739,
-15875,
-20926,
-25866,
-31047,
-35147,
-38602,
-40193,
-40865,
-40457,
-39291,
-37604,
-35344,
-32579,
-29672,
-26599,
-23450,
-20349,
-17296,
-14322,
-11937,
-10026,
-9033,
-8920,
-9785,
-11846,
-15232,
-20019,
-25975,
-32665,
-39489,
-46085,
-52426,
-58753,
-65472,
-65532,
-65534,
-65532,
-65534,
-65532,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-63404,
-60335,
-57955,
-56590,
-55611,
-54880,
-53930,
-53064,
-52799,
-53110,
-54127,
-55102,
-56057,
-56828,
-58139,
-59620,
-61525,
-62791,
-63739,
-63940,
-64252,
-64247,
-64299,
-63581,
-62438,
-61014,
-59578,
-58159,
-56230,
-52980,
-48698,
-43477,
-38355,
-33641,
-28767,
-23495,
-17228,
-10913,
-4691,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-65535,
-1725,
-5728,
-9145,
-11556,
-13483,
-15058,
-16672,
-17759,
-18290,
-17914,
-16917,
-15720,
-14748,
-13969,
-13463,
-12797,
-11845,
-11003,
-10316,
-10139,
-10716,
-11357,
-12398,
-13440,
-15012,
-17338,
-20505,
-24293,
-28168,
-32135,
-35853,
-39887,
-44006,
-48258,
-52423,
-55966,
-59288,
-62391,
-65400,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65533,
-65534,
-65532,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65532,
-65534,
-65400,
-63254,
-60840,
-58269,
-55635,
-52710,
-49743,
-46375,
-42942,
-39643,
-36452,
-33752,
-31179,
-28924,
-26660,
-24738,
-23008,
-21854,
-21261,
-20724,
-20552,
-19816,
-19179,
-18176,
-17629,
-17136,
-17007,
-16717,
-16253,
-15432,
-14260,
-13306,
-12243,
-11625,
-11000,
-10431,
-9870,
-9255,
-8500,
-7834,
-7196,
-6837,
-6641,
-6528,
-6218,
-5756,
-4998,
-4295,
-3712,
-3520,
-3381,
-3275,
-2851,
-2166,
-1301,
-571,
-62,
-65535,
-2,
-65535,
-2,
-65535,
-65535,
-85,
-812,
-1371,
-2229,
-2654,
-3274,
-3558,
-3919,
-3801,
-3895,
-3428,
-3427,
-2809,
-2386,
-1192,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-3,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-1855,
-7459,
-12975,
-18178,
-23209,
-27945,
-32536,
-36869,
-40865,
-44134,
-46623,
-48190,
-48791,
-48478,
-47153,
-45000,
-42325,
-39087,
-35944,
-32575,
-29433,
-26329,
-23674,
-21346,
-19974,
-19220,
-19642,
-20947,
-23342,
-26815,
-31605,
-37381,
-44184,
-51757,
-59511,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65530,
-65534,
-65532,
-65534,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65046,
-59711,
-54791,
-50741,
-47149,
-44761,
-42896,
-42213,
-41856,
-42213,
-42785,
-43942,
-45465,
-47418,
-49632,
-51801,
-54129,
-56342,
-58802,
-61194,
-63209,
-64759,
-65270,
-64981,
-63895,
-62170,
-59664,
-56631,
-52689,
-48590,
-43872,
-38958,
-33416,
-27018,
-20040,
-12797,
-5532,
-0,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-4,
-65535,
-4,
-65535,
-3,
-65535,
-2,
-65535,
-2,
-65535,
-65535,
-0,
-1500,
-6729,
-11335,
-15388,
-18911,
-22033,
-24825,
-26684,
-28036,
-28414,
-28410,
-28016,
-27104,
-25733,
-23740,
-21522,
-19444,
-17668,
-16432,
-15563,
-14904,
-14722,
-14881,
-15742,
-17139,
-18778,
-20814,
-22876,
-25710,
-28878,
-32799,
-37160,
-41593,
-46196,
-50742,
-55367,
-60020,
-64471,
-65534,
-65534,
-65532,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65334,
-64231,
-63382,
-63037,
-62362,
-61864,
-61322,
-60931,
-61081,
-61216,
-61460,
-61548,
-61171,
-60818,
-60085,
-59556,
-58600,
-57475,
-55765,
-53665,
-51069,
-48282,
-45201,
-42013,
-38601,
-35190,
-31602,
-27925,
-24315,
-20638,
-17205,
-13882,
-10938,
-8099,
-5800,
-3737,
-2143,
-1237,
-591,
-571,
-660,
-1056,
-1704,
-2670,
-3898,
-5373,
-6864,
-8210,
-9432,
-10448,
-11514,
-12397,
-13263,
-13617,
-13704,
-13131,
-12418,
-11427,
-10713,
-9875,
-9296,
-8434,
-7792,
-7060,
-6640,
-6351,
-6242,
-6217,
-6287,
-6661,
-7304,
-8257,
-9275,
-10006,
-10806,
-11598,
-12844,
-14412,
-16276,
-17714,
-18910,
-19598,
-20259,
-21018,
-22075,
-23032,
-23694,
-24137,
-23918,
-23670,
-23100,
-22473,
-21770,
-20926,
-20060,
-18980,
-17490,
-15523,
-13062,
-10518,
-8119,
-5981,
-3999,
-1880,
-65535,
-65535,
-4,
-65535,
-3,
-65535,
-0,
-0,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-2,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-3,
-65535,
-2,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-1502,
-7989,
-14660,
-21367,
-28037,
-34127,
-39641,
-43830,
-47416,
-49564,
-51538,
-52311,
-52800,
-52377,
-51514,
-50164,
-48744,
-47553,
-46572,
-46001,
-45598,
-45625,
-45998,
-47483,
-49876,
-53706,
-58648,
-64293,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-63121,
-60350,
-58228,
-56674,
-55568,
-54615,
-53973,
-53507,
-53355,
-53527,
-53710,
-53926,
-53974,
-53974,
-54126,
-54396,
-54813,
-55036,
-54728,
-53682,
-51672,
-48899,
-45513,
-41458,
-37183,
-32179,
-26904,
-21240,
-15097,
-9034,
-2652,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-4245,
-9390,
-14233,
-18669,
-22741,
-25845,
-28499,
-30165,
-31421,
-32204,
-32906,
-33375,
-33972,
-34481,
-34992,
-35433,
-35987,
-36365,
-36851,
-37295,
-37826,
-38778,
-40107,
-41903,
-44292,
-46732,
-49629,
-52336,
-55101,
-57829,
-60328,
-62922,
-65114,
-65534,
-65534,
-65533,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65532,
-65534,
-65531,
-65534,
-65533,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65533,
-65534,
-63539,
-60310,
-57027,
-54263,
-51691,
-49919,
-48813,
-48368,
-48481,
-48545,
-48903,
-48876,
-49390,
-49630,
-50541,
-51026,
-51604,
-51248,
-50562,
-49211,
-47727,
-46065,
-44360,
-42014,
-38997,
-35216,
-30846,
-26464,
-22367,
-18577,
-15278,
-11978,
-9031,
-6175,
-3849,
-1877,
-283,
-65535,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-65535,
-949,
-2583,
-4361,
-5885,
-7282,
-8390,
-9785,
-11112,
-12822,
-14212,
-15590,
-16628,
-17892,
-18865,
-20220,
-21166,
-21904,
-22385,
-22501,
-22740,
-23010,
-23227,
-23675,
-23605,
-23607,
-23140,
-22653,
-22079,
-21678,
-21238,
-21368,
-21346,
-21702,
-22033,
-22411,
-23118,
-23894,
-25023,
-26044,
-27104,
-27839,
-28698,
-29498,
-30585,
-31866,
-33132,
-34104,
-34658,
-34572,
-34058,
-32823,
-31267,
-29124,
-26838,
-24050,
-21147,
-17891,
-14482,
-10957,
-7660,
-4379,
-1436,
-65535,
-2,
-65535,
-3,
-65535,
-0,
-0,
-65535,
-65535,
-2,
-65535,
-4,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-1,
-65535,
-2,
-65535,
-2,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-65535,
-2964,
-11975,
-20664,
-28918,
-36877,
-44357,
-51384,
-57582,
-62633,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65531,
-65534,
-65531,
-65534,
-65531,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-61193,
-55082,
-48833,
-43010,
-37559,
-33065,
-29298,
-26708,
-24557,
-23319,
-22077,
-21349,
-20503,
-20019,
-19640,
-19864,
-20327,
-21304,
-22409,
-23539,
-24670,
-25422,
-25910,
-25711,
-24623,
-22744,
-19662,
-16342,
-12598,
-8788,
-5110,
-949,
-65535,
-1,
-65535,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-4,
-65535,
-3,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-61,
-5135,
-10380,
-15768,
-21146,
-26685,
-31669,
-36739,
-40775,
-44888,
-48106,
-51225,
-53796,
-56078,
-57981,
-59466,
-60530,
-61326,
-61747,
-62081,
-62278,
-62367,
-62192,
-61834,
-61262,
-60882,
-60619,
-60992,
-61662,
-62763,
-64010,
-65222,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65531,
-65534,
-65532,
-65534,
-65534,
-65534,
-65025,
-59933,
-54768,
-49568,
-44712,
-40330,
-36497,
-33307,
-30539,
-28347,
-26505,
-25382,
-24710,
-24760,
-25355,
-26286,
-27527,
-28877,
-30141,
-31601,
-32976,
-34525,
-36144,
-37537,
-39001,
-39818,
-40507,
-40616,
-40530,
-39751,
-38890,
-37228,
-35522,
-33241,
-30983,
-28411,
-25888,
-23185,
-20483,
-18002,
-15634,
-13814,
-12022,
-10628,
-9207,
-8148,
-7325,
-7016,
-7305,
-8035,
-9407,
-11049,
-12974,
-15277,
-17738,
-20526,
-23673,
-27017,
-30650,
-34348,
-38004,
-41413,
-44517,
-47016,
-49368,
-51047,
-52535,
-53506,
-54064,
-53771,
-53112,
-51578,
-50143,
-48412,
-46841,
-45336,
-43450,
-41483,
-39108,
-36920,
-34967,
-33553,
-32686,
-32377,
-32312,
-32664,
-33087,
-33883,
-34746,
-35768,
-36628,
-37363,
-37647,
-37938,
-37713,
-37784,
-37338,
-37183,
-36543,
-35875,
-34836,
-33398,
-31555,
-28969,
-26107,
-22587,
-18891,
-15097,
-11118,
-7344,
-3365,
-65535,
-1,
-65535,
-3,
-65535,
-3,
-65535,
-1,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-2,
-65535,
-1,
-4469,
-15830,
-27263,
-37891,
-48258,
-57740,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65531,
-65534,
-65531,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65531,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-63850,
-54971,
-46043,
-36651,
-27528,
-18444,
-10207,
-2453,
-65535,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-2984,
-7017,
-10914,
-14547,
-17715,
-20637,
-22854,
-24424,
-24981,
-24270,
-22365,
-19510,
-16095,
-12446,
-8651,
-4739,
-568,
-0,
-65535,
-65535,
-3,
-65535,
-2,
-65535,
-65535,
-3,
-65535,
-1,
-65535,
-65535,
-65535,
-1,
-65535,
-4937,
-11001,
-17340,
-23626,
-29722,
-35740,
-41662,
-47724,
-53399,
-58934,
-63562,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65533,
-65534,
-65533,
-64650,
-61371,
-58004,
-54527,
-51115,
-48060,
-45245,
-43165,
-41524,
-40707,
-40372,
-40905,
-41814,
-43581,
-45761,
-48165,
-50964,
-53551,
-56342,
-59002,
-61503,
-64007,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-63761,
-60709,
-57026,
-52714,
-47989,
-42768,
-37294,
-31623,
-25867,
-20393,
-15211,
-10517,
-6218,
-2233,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-65535,
-65535,
-65535,
-0,
-1543,
-6487,
-11731,
-17518,
-23028,
-28369,
-33374,
-38069,
-42390,
-46397,
-49698,
-52533,
-54461,
-56120,
-56810,
-57183,
-56366,
-54769,
-52158,
-48833,
-45314,
-41568,
-38025,
-34306,
-30736,
-27063,
-23894,
-21146,
-19356,
-18131,
-17652,
-17534,
-17961,
-19041,
-20750,
-23538,
-27041,
-31424,
-36452,
-41793,
-47524,
-53090,
-58844,
-64140,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65046,
-59954,
-55081,
-50360,
-45892,
-41832,
-38182,
-35212,
-32909,
-31247,
-30119,
-29696,
-29897,
-30716,
-32156,
-34016,
-36055,
-38223,
-40021,
-41744,
-43011,
-44093,
-44915,
-45334,
-45445,
-44737,
-43606,
-41638,
-38997,
-35635,
-31447,
-26506,
-20818,
-14344,
-7596,
-479,
-1,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-3,
-65535,
-1,
-65535,
-65535,
-2,
-65535,
-0,
-0,
-65535,
-1,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-4,
-9823,
-21641,
-33368,
-45118,
-56516,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65531,
-65534,
-65529,
-65534,
-65530,
-65534,
-65530,
-65534,
-65531,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-62874,
-52515,
-42562,
-32890,
-23472,
-14081,
-5202,
-65535,
-1,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-65535,
-0,
-65535,
-3,
-65535,
-1,
-65535,
-3760,
-8722,
-13395,
-17715,
-21036,
-23585,
-25355,
-26464,
-26994,
-26665,
-25684,
-23744,
-21232,
-18005,
-14545,
-10716,
-6705,
-3032,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-3183,
-8080,
-13129,
-18778,
-24890,
-31337,
-38002,
-44362,
-50538,
-56166,
-61393,
-65534,
-65533,
-65534,
-65531,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-63765,
-60172,
-56746,
-53215,
-49879,
-46638,
-43632,
-41280,
-39599,
-38555,
-38271,
-38223,
-38758,
-39420,
-40772,
-42389,
-44469,
-46622,
-48632,
-50543,
-52265,
-53796,
-55037,
-55965,
-56389,
-56430,
-56121,
-55282,
-54280,
-52338,
-49782,
-46401,
-42277,
-37782,
-33175,
-28389,
-23585,
-18512,
-13394,
-8214,
-3536,
-2,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-65535,
-1,
-3912,
-9301,
-15408,
-21813,
-28125,
-33972,
-39198,
-43787,
-48076,
-51831,
-55296,
-58076,
-60214,
-61618,
-62366,
-62546,
-61989,
-60820,
-58466,
-55615,
-51888,
-48172,
-44536,
-41017,
-37780,
-34482,
-31713,
-29143,
-27504,
-26376,
-25996,
-26046,
-26659,
-27640,
-29628,
-32092,
-35498,
-39445,
-43871,
-48747,
-53817,
-59068,
-64294,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65533,
-65534,
-65531,
-65534,
-65531,
-63346,
-57913,
-52245,
-46489,
-40591,
-35038,
-29674,
-25111,
-20973,
-17667,
-15081,
-13216,
-12179,
-11643,
-11648,
-12152,
-13110,
-14412,
-16342,
-18335,
-20703,
-22656,
-24667,
-25823,
-26949,
-27350,
-27593,
-27416,
-26707,
-25422,
-23362,
-20617,
-17048,
-12844,
-7899,
-2280,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-65535,
-0,
-65535,
-3,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-1,
-65535,
-4,
-65535,
-2,
-65535,
-65535,
-2,
-65535,
-1,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-4,
-65535,
-4,
-65535,
-1,
-10404,
-22521,
-34681,
-47128,
-59357,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65531,
-65534,
-65532,
-65534,
-65534,
-65532,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65531,
-65534,
-65531,
-65534,
-65531,
-65534,
-64891,
-55590,
-45336,
-34768,
-24226,
-14238,
-4822,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-4,
-65535,
-5096,
-10909,
-16300,
-21057,
-25335,
-28699,
-31359,
-33131,
-33926,
-34085,
-33327,
-31981,
-29916,
-27419,
-24533,
-21859,
-19240,
-17318,
-15498,
-14193,
-12841,
-12066,
-11624,
-12288,
-13770,
-16343,
-19640,
-23584,
-27904,
-32730,
-38048,
-43874,
-50161,
-56700,
-63030,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-64914,
-60065,
-55168,
-50540,
-45800,
-41702,
-37804,
-34526,
-31735,
-29452,
-27573,
-26328,
-25668,
-25576,
-26266,
-27235,
-28793,
-30424,
-32115,
-34081,
-35944,
-37848,
-39597,
-41083,
-42189,
-43053,
-43277,
-42983,
-41927,
-39972,
-37340,
-33928,
-30316,
-26398,
-22453,
-18424,
-14016,
-9584,
-5069,
-944,
-3,
-65535,
-0,
-0,
-65535,
-3,
-65535,
-0,
-65535,
-65535,
-240,
-5642,
-11469,
-18089,
-25203,
-32597,
-40087,
-47194,
-53952,
-60040,
-65534,
-65533,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65531,
-65534,
-65530,
-65534,
-65532,
-62968,
-58555,
-55017,
-51578,
-49036,
-46750,
-44805,
-43207,
-42013,
-41348,
-41701,
-42545,
-44360,
-46331,
-48768,
-51226,
-53974,
-56674,
-59578,
-62144,
-64585,
-65533,
-65534,
-65534,
-65533,
-65534,
-65532,
-64828,
-62212,
-58978,
-55080,
-50675,
-45930,
-40951,
-35987,
-30981,
-26021,
-21037,
-16273,
-11647,
-7636,
-4070,
-1346,
-65535,
-65535,
-0,
-65535,
-65535,
-65535,
-1,
-65535,
-0,
-571,
-2474,
-4228,
-6039,
-7595,
-8918,
-9831,
-10582,
-10737,
-10694,
-9894,
-8413,
-6484,
-3627,
-594,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-2,
-65535,
-2,
-65535,
-65535,
-3,
-65535,
-5,
-65535,
-3,
-65535,
-1,
-65535,
-0,
-65535,
-3008,
-12331,
-22942,
-34084,
-45000,
-55681,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-63318,
-60909,
-59352,
-58893,
-58954,
-59756,
-61303,
-63144,
-65356,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-62034,
-55967,
-49476,
-42323,
-34415,
-26485,
-18357,
-11002,
-4117,
-65535,
-1,
-65535,
-0,
-65535,
-1,
-65535,
-2,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-3075,
-9098,
-15100,
-21060,
-26396,
-31248,
-35500,
-39001,
-41989,
-44118,
-45443,
-45780,
-45044,
-43190,
-40413,
-37077,
-33482,
-29963,
-26775,
-23671,
-20927,
-18223,
-16054,
-14235,
-13375,
-13085,
-13725,
-14994,
-16890,
-19447,
-22383,
-25980,
-29671,
-34021,
-38442,
-43300,
-48256,
-52734,
-56808,
-59775,
-62214,
-63938,
-65494,
-65531,
-65534,
-65533,
-65534,
-65534,
-64890,
-62591,
-59686,
-56720,
-52889,
-48876,
-44163,
-39685,
-35345,
-31539,
-27987,
-24783,
-21390,
-18488,
-15947,
-14077,
-13089,
-12306,
-12069,
-11822,
-12331,
-13464,
-15562,
-18250,
-21410,
-24228,
-26950,
-29298,
-31736,
-34303,
-36830,
-39287,
-41039,
-42299,
-42788,
-42832,
-42632,
-41791,
-40816,
-38889,
-37029,
-34437,
-32289,
-29829,
-27616,
-25046,
-22674,
-20220,
-18199,
-16719,
-15699,
-15165,
-14948,
-14966,
-15678,
-17093,
-19664,
-23317,
-27706,
-32751,
-38029,
-43825,
-49965,
-56876,
-63872,
-65534,
-65534,
-65533,
-65534,
-65531,
-65534,
-65532,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-63672,
-57852,
-52309,
-46754,
-41968,
-37713,
-34661,
-32242,
-30586,
-29429,
-28613,
-28456,
-28745,
-29786,
-31424,
-33442,
-35743,
-38114,
-40329,
-42587,
-44450,
-45999,
-47129,
-47638,
-47660,
-47128,
-45846,
-44092,
-41285,
-37999,
-33887,
-29804,
-25559,
-21632,
-17761,
-13571,
-9430,
-4714,
-503,
-0,
-65535,
-0,
-65535,
-1,
-65535,
-0,
-65535,
-1,
-65535,
-3,
-65535,
-4,
-833,
-3629,
-6218,
-8810,
-11093,
-13350,
-15234,
-17027,
-18336,
-19329,
-19844,
-19638,
-19089,
-17649,
-15962,
-13708,
-11156,
-8125,
-4623,
-704,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-65535,
-1,
-65535,
-2,
-325,
-2676,
-4778,
-5887,
-5842,
-5046,
-3427,
-1944,
-128,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-284,
-9053,
-19088,
-29653,
-40506,
-51537,
-62366,
-65534,
-65532,
-65534,
-65532,
-65534,
-65534,
-65532,
-65534,
-65531,
-65534,
-65533,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-63740,
-58160,
-53154,
-49652,
-47375,
-46394,
-46469,
-47434,
-49659,
-52839,
-57055,
-61434,
-65534,
-65533,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-63207,
-57144,
-50558,
-43632,
-36739,
-30406,
-24626,
-19441,
-14370,
-9187,
-3827,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-2,
-65535,
-4,
-65535,
-3076,
-9096,
-15656,
-22631,
-29387,
-35657,
-40990,
-45583,
-49006,
-51851,
-53417,
-53951,
-53177,
-51357,
-48549,
-45066,
-41084,
-36916,
-32468,
-28278,
-24117,
-20702,
-17517,
-15188,
-12887,
-11157,
-9454,
-8431,
-7817,
-7877,
-8414,
-9163,
-10295,
-11446,
-13372,
-15811,
-19041,
-22833,
-26728,
-30517,
-33839,
-36962,
-39863,
-42900,
-45887,
-48857,
-51337,
-53241,
-54219,
-54679,
-54307,
-53640,
-52067,
-49900,
-46749,
-42968,
-38687,
-34461,
-30361,
-26552,
-23186,
-19884,
-17205,
-14747,
-12974,
-11557,
-10604,
-9896,
-9628,
-9988,
-11021,
-12756,
-15188,
-17625,
-20529,
-23295,
-26330,
-29411,
-32551,
-35594,
-38353,
-40774,
-42832,
-44447,
-45935,
-46949,
-47684,
-47859,
-47639,
-46995,
-45933,
-44670,
-43009,
-41038,
-38533,
-35680,
-32464,
-29300,
-26285,
-23739,
-21546,
-19842,
-18421,
-17827,
-18000,
-19578,
-22031,
-25623,
-29496,
-33841,
-38379,
-43475,
-49121,
-55435,
-61991,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65532,
-65534,
-65532,
-65534,
-65532,
-65534,
-65532,
-65534,
-65534,
-65534,
-63940,
-58559,
-52620,
-46533,
-40105,
-33708,
-27614,
-22189,
-17581,
-13928,
-11045,
-8902,
-7411,
-6688,
-6879,
-7928,
-9737,
-12114,
-14876,
-17961,
-20989,
-24407,
-27457,
-30630,
-33283,
-35591,
-37448,
-38868,
-39398,
-39244,
-38046,
-35923,
-33484,
-30450,
-27617,
-24643,
-21727,
-18532,
-15235,
-11777,
-8546,
-5662,
-3388,
-1784,
-531,
-65535,
-1,
-0,
-65535,
-2,
-945,
-2720,
-5200,
-7792,
-10757,
-13798,
-16890,
-20066,
-22961,
-25601,
-27969,
-30030,
-32088,
-33995,
-35743,
-37051,
-37783,
-37603,
-36941,
-35543,
-33731,
-31510,
-28681,
-25422,
-21810,
-17673,
-13813,
-9743,
-6417,
-3251,
-991,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-328,
-548,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-2,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-2,
-5130,
-15347,
-25422,
-35388,
-45293,
-54878,
-64297,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-62633,
-56986,
-51559,
-47017,
-43564,
-41169,
-40175,
-40240,
-41370,
-43873,
-47173,
-51646,
-56678,
-62076,
-65534,
-65531,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65531,
-65534,
-65532,
-65534,
-62457,
-55854,
-49146,
-42565,
-36564,
-30339,
-24249,
-17447,
-10362,
-3162,
-65535,
-65535,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-2,
-65535,
-4,
-4950,
-12804,
-20544,
-27818,
-34257,
-39932,
-44382,
-48102,
-50343,
-51643,
-51342,
-50137,
-47884,
-45090,
-42013,
-38468,
-34925,
-31092,
-27305,
-23629,
-20083,
-16918,
-13639,
-10693,
-7569,
-4868,
-2454,
-592,
-65535,
-0,
-65535,
-1,
-1721,
-4425,
-8256,
-12732,
-17558,
-22809,
-27948,
-33506,
-39133,
-45092,
-50981,
-56766,
-61679,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-64161,
-60531,
-57359,
-54108,
-51159,
-48392,
-45909,
-43653,
-41856,
-40196,
-38647,
-37314,
-35901,
-34835,
-33927,
-33641,
-33639,
-34105,
-34903,
-35964,
-37584,
-39463,
-41838,
-44180,
-46578,
-48743,
-50696,
-52755,
-54748,
-56808,
-58713,
-60108,
-61039,
-61105,
-60662,
-59687,
-58094,
-56009,
-53066,
-49476,
-45335,
-40882,
-36653,
-32797,
-29321,
-26464,
-23782,
-21857,
-20328,
-19995,
-20240,
-21547,
-23205,
-25293,
-27523,
-30120,
-33241,
-36984,
-41591,
-46531,
-51781,
-56673,
-61307,
-65067,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-63274,
-59291,
-54747,
-49632,
-44116,
-38115,
-32353,
-26688,
-21609,
-17186,
-13326,
-10230,
-7812,
-6109,
-5399,
-5310,
-6242,
-7547,
-9431,
-11489,
-13973,
-16604,
-19601,
-22738,
-25957,
-29053,
-32133,
-35060,
-37911,
-40554,
-42829,
-44295,
-45246,
-45223,
-44870,
-44007,
-42895,
-41574,
-39770,
-37564,
-34789,
-31759,
-28544,
-25446,
-22474,
-19600,
-16892,
-14394,
-12198,
-10781,
-9853,
-9983,
-10604,
-11846,
-13526,
-15413,
-17890,
-20351,
-23140,
-25955,
-28455,
-30896,
-32929,
-34636,
-36167,
-37225,
-38206,
-38709,
-38957,
-38734,
-38180,
-37184,
-35854,
-33972,
-31692,
-28831,
-25380,
-21655,
-17495,
-13482,
-9520,
-5731,
-2166,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-65535,
-0,
-65535,
-2,
-65535,
-2,
-65535,
-65535,
-2565,
-13328,
-23850,
-33639,
-42524,
-50735,
-58895,
-65531,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65532,
-65534,
-65531,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-60770,
-54751,
-49740,
-46067,
-43673,
-42942,
-43010,
-44802,
-47240,
-51093,
-55368,
-59822,
-64137,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65532,
-65534,
-65534,
-61106,
-55323,
-48525,
-41369,
-34260,
-27395,
-20547,
-13309,
-5420,
-65535,
-0,
-65535,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-2,
-3624,
-12468,
-20481,
-27637,
-33707,
-38711,
-42767,
-45821,
-47726,
-48348,
-47836,
-46267,
-43894,
-41214,
-38072,
-34810,
-31384,
-27767,
-24340,
-20946,
-17893,
-14745,
-11735,
-8500,
-5510,
-2696,
-617,
-65535,
-1,
-65535,
-0,
-0,
-1920,
-5711,
-11046,
-17205,
-23895,
-30737,
-37539,
-44603,
-51581,
-58690,
-65293,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-61990,
-57983,
-54149,
-50451,
-46843,
-43693,
-40596,
-38004,
-35386,
-32892,
-30357,
-27862,
-25841,
-24184,
-23227,
-22833,
-22785,
-23298,
-23980,
-25470,
-27434,
-30077,
-33306,
-36541,
-39843,
-42875,
-45578,
-48216,
-50381,
-52516,
-53991,
-55016,
-55258,
-54723,
-53690,
-51819,
-49481,
-46418,
-42876,
-39089,
-34968,
-31314,
-27572,
-24558,
-21434,
-18979,
-16672,
-15100,
-14395,
-14410,
-15502,
-16805,
-18800,
-20705,
-23208,
-26239,
-30033,
-34875,
-40290,
-46040,
-51694,
-56783,
-61484,
-65532,
-65534,
-65531,
-65534,
-65531,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-63895,
-59047,
-53750,
-47904,
-42080,
-36407,
-31426,
-26950,
-23185,
-20019,
-17315,
-15411,
-14081,
-13706,
-14170,
-15323,
-17249,
-19463,
-22190,
-25066,
-28259,
-31669,
-35232,
-38870,
-42585,
-46180,
-49872,
-53400,
-56649,
-59537,
-61545,
-63034,
-63473,
-63521,
-62743,
-61659,
-59909,
-57516,
-54462,
-50715,
-46620,
-42433,
-38490,
-34681,
-31404,
-28078,
-25425,
-22850,
-21260,
-20196,
-20082,
-20574,
-21589,
-23007,
-24694,
-26705,
-28923,
-31424,
-34039,
-36608,
-39022,
-41015,
-42743,
-43985,
-44891,
-45622,
-46000,
-46308,
-46156,
-45820,
-44782,
-43341,
-40994,
-38289,
-34838,
-30936,
-26597,
-21592,
-15939,
-10010,
-3668,
-2,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-2,
-65535,
-2,
-65535,
-65535,
-0,
-65535,
-65535,
-1,
-1675,
-10918,
-20192,
-29367,
-37848,
-46063,
-54177,
-62074,
-65534,
-65531,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65533,
-65534,
-63207,
-56742,
-50851,
-45754,
-41969,
-39598,
-38954,
-39754,
-41725,
-44470,
-47816,
-51204,
-54836,
-57961,
-61126,
-63653,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65486,
-62571,
-59574,
-56146,
-52220,
-47553,
-42141,
-36192,
-29914,
-23610,
-17113,
-10230,
-3007,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-1,
-65535,
-0,
-65535,
-5310,
-12068,
-18133,
-23232,
-27547,
-31004,
-33685,
-35654,
-36698,
-37005,
-36475,
-35280,
-33770,
-31850,
-30047,
-27950,
-26108,
-24027,
-22277,
-20174,
-18400,
-16186,
-14170,
-12023,
-10227,
-8700,
-7857,
-7372,
-7612,
-8393,
-10201,
-13177,
-17381,
-22631,
-28613,
-34924,
-41369,
-47816,
-54261,
-60528,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65532,
-65534,
-65533,
-64073,
-60885,
-57736,
-54441,
-51068,
-47641,
-44137,
-40262,
-36633,
-32838,
-29590,
-26749,
-24582,
-23029,
-22102,
-21787,
-22169,
-23250,
-25179,
-27593,
-30606,
-33661,
-36520,
-39354,
-41546,
-43676,
-45199,
-46444,
-47039,
-46952,
-46399,
-45155,
-43697,
-41990,
-39995,
-37984,
-35564,
-33133,
-30337,
-27883,
-25154,
-22789,
-20238,
-17693,
-14967,
-12244,
-9563,
-7260,
-5465,
-4182,
-3538,
-3406,
-4026,
-5399,
-7858,
-11402,
-16142,
-21545,
-27417,
-33151,
-38757,
-44072,
-49323,
-54458,
-59312,
-63718,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-62921,
-59578,
-55677,
-51914,
-47970,
-44315,
-40685,
-37470,
-34261,
-31712,
-29299,
-27615,
-26463,
-25977,
-26041,
-26863,
-28213,
-30272,
-32733,
-35854,
-39177,
-43032,
-46839,
-50852,
-54945,
-58760,
-62654,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-63010,
-59355,
-55701,
-52200,
-48967,
-45890,
-43096,
-40264,
-37714,
-35478,
-33596,
-32311,
-31468,
-30939,
-30870,
-30827,
-31359,
-32000,
-33174,
-34461,
-35808,
-37165,
-38000,
-38802,
-38999,
-39200,
-38978,
-38491,
-37470,
-36033,
-34061,
-31667,
-29013,
-25973,
-22855,
-19265,
-15388,
-11269,
-6794,
-2387,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-2,
-65535,
-0,
-2,
-65535,
-4,
-65535,
-3,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-2,
-65535,
-2,
-65535,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-6597,
-17690,
-28592,
-38576,
-47398,
-55432,
-63167,
-65533,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65205,
-56607,
-48813,
-41745,
-35834,
-30804,
-27039,
-24559,
-23362,
-23827,
-25424,
-28322,
-31913,
-36121,
-40527,
-45137,
-49586,
-53841,
-57914,
-61395,
-64426,
-65534,
-65533,
-65534,
-65534,
-65534,
-64382,
-62280,
-59729,
-56591,
-52330,
-47264,
-41148,
-34835,
-28169,
-21392,
-14037,
-6107,
-2,
-65535,
-0,
-1,
-65535,
-2,
-65535,
-65535,
-3,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-0,
-4292,
-12198,
-19754,
-26949,
-32998,
-38269,
-42367,
-46020,
-48903,
-51357,
-53133,
-54060,
-54329,
-53926,
-53245,
-52265,
-51162,
-49652,
-47728,
-45112,
-42101,
-38580,
-35035,
-31336,
-27836,
-24714,
-22034,
-20106,
-19110,
-18932,
-20085,
-22078,
-25421,
-29832,
-35166,
-41283,
-47682,
-54193,
-60576,
-65533,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-63277,
-58314,
-52931,
-47286,
-41256,
-35349,
-29516,
-24120,
-19349,
-15481,
-12551,
-10694,
-9829,
-9917,
-10938,
-12840,
-15390,
-18487,
-21949,
-25263,
-28527,
-31466,
-33840,
-36210,
-37826,
-39220,
-39955,
-39660,
-38961,
-37223,
-35394,
-33414,
-31140,
-29053,
-26487,
-23760,
-21015,
-18135,
-15698,
-13264,
-11023,
-8304,
-5329,
-1638,
-65535,
-2,
-65535,
-0,
-0,
-65535,
-1,
-65535,
-2,
-65535,
-1591,
-8056,
-15567,
-22784,
-29988,
-36694,
-43343,
-49787,
-56008,
-61617,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65531,
-63191,
-60394,
-56919,
-53576,
-49518,
-45559,
-41523,
-37960,
-34946,
-32510,
-30606,
-29319,
-28637,
-28940,
-30366,
-32817,
-36609,
-40905,
-45799,
-50718,
-55700,
-60508,
-65245,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65530,
-65534,
-65531,
-65534,
-65533,
-65534,
-65534,
-65534,
-64716,
-61258,
-57918,
-54303,
-50520,
-46329,
-42059,
-37757,
-33796,
-30096,
-26883,
-24073,
-21545,
-19774,
-18335,
-17802,
-17739,
-18353,
-19202,
-20612,
-21881,
-23407,
-24490,
-25491,
-25708,
-25601,
-24647,
-23383,
-21615,
-19616,
-17319,
-14855,
-11912,
-8987,
-5798,
-3073,
-550,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-1,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-3,
-65535,
-2,
-65535,
-1,
-65535,
-0,
-65535,
-6573,
-16895,
-27017,
-36164,
-44494,
-52135,
-59886,
-65534,
-65534,
-65531,
-65534,
-65532,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-63826,
-54996,
-46218,
-38291,
-31095,
-25174,
-20090,
-16424,
-13976,
-13148,
-13663,
-15498,
-18158,
-21524,
-25156,
-29322,
-33881,
-38715,
-43870,
-48636,
-53110,
-56873,
-59844,
-62145,
-63630,
-64384,
-64493,
-63808,
-62412,
-60373,
-57363,
-53728,
-49301,
-44492,
-39133,
-33705,
-27484,
-20969,
-13684,
-6197,
-65535,
-2,
-65535,
-2,
-65535,
-2,
-65535,
-2,
-65535,
-65535,
-0,
-65535,
-1,
-2763,
-10094,
-17738,
-25398,
-33199,
-40526,
-47574,
-53816,
-59622,
-64560,
-65534,
-65534,
-65533,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65532,
-65534,
-65530,
-65534,
-65531,
-62747,
-58733,
-54616,
-50185,
-46000,
-42321,
-39467,
-37579,
-36701,
-36802,
-37875,
-39838,
-42568,
-45932,
-49742,
-53752,
-57982,
-62101,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-63981,
-60289,
-56052,
-51362,
-46174,
-40840,
-35056,
-29300,
-23383,
-17582,
-12311,
-7413,
-3430,
-303,
-0,
-65535,
-65535,
-65535,
-65535,
-284,
-2784,
-5756,
-8476,
-11270,
-13859,
-16430,
-19044,
-21435,
-23673,
-25311,
-26597,
-27215,
-27684,
-27812,
-27883,
-27525,
-27041,
-25841,
-24560,
-22853,
-21057,
-19402,
-17509,
-15925,
-14080,
-12044,
-9675,
-6949,
-4070,
-1192,
-65535,
-65535,
-0,
-65535,
-2,
-412,
-3276,
-7457,
-12665,
-19155,
-26285,
-33596,
-40550,
-46908,
-52664,
-58119,
-63115,
-65534,
-65528,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-63895,
-61572,
-59044,
-56321,
-53331,
-50871,
-48459,
-46929,
-45534,
-44582,
-43761,
-43697,
-44269,
-46069,
-48831,
-52426,
-56450,
-60510,
-64491,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-64583,
-61282,
-57604,
-53532,
-49120,
-44805,
-40815,
-36941,
-33572,
-30141,
-26817,
-23673,
-20616,
-18068,
-16010,
-14457,
-13286,
-12309,
-11446,
-10826,
-10627,
-10958,
-12112,
-13570,
-15435,
-17093,
-18712,
-19995,
-21258,
-22079,
-22651,
-22325,
-21255,
-19067,
-16297,
-12974,
-9385,
-5646,
-1762,
-4,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-1,
-65535,
-4,
-65535,
-4,
-65535,
-1,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-2,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-65535,
-638,
-1721,
-2456,
-2849,
-3232,
-3424,
-3121,
-2252,
-595,
-65535,
-1,
-65535,
-3,
-65535,
-3,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-1790,
-10801,
-19999,
-28986,
-36808,
-43785,
-49807,
-55703,
-61346,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-60507,
-53573,
-46199,
-38868,
-31953,
-26048,
-21010,
-16941,
-13928,
-11841,
-11184,
-12064,
-14658,
-18801,
-23981,
-29653,
-35591,
-41366,
-47355,
-53460,
-59778,
-65533,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65532,
-65534,
-65532,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-61967,
-55680,
-48922,
-42212,
-36054,
-30428,
-25532,
-21194,
-17534,
-14838,
-13437,
-13596,
-15433,
-18643,
-22965,
-27769,
-32999,
-38291,
-43982,
-49656,
-55477,
-60707,
-65425,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-63804,
-59358,
-54236,
-48328,
-42164,
-35857,
-29651,
-23673,
-17605,
-11932,
-6419,
-1810,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-1633,
-4979,
-8987,
-13395,
-17959,
-22454,
-26485,
-29986,
-33173,
-35745,
-38203,
-40284,
-42035,
-43517,
-44716,
-45533,
-46465,
-46951,
-47660,
-47617,
-47461,
-46441,
-45004,
-42963,
-40597,
-38001,
-34970,
-31800,
-28303,
-24736,
-21390,
-18469,
-16338,
-14971,
-14435,
-14768,
-15744,
-17602,
-20263,
-23782,
-28081,
-32643,
-37537,
-41793,
-46018,
-49435,
-52885,
-55836,
-58734,
-61326,
-63278,
-64889,
-65534,
-65533,
-65534,
-65533,
-65534,
-65333,
-64341,
-62876,
-60840,
-58335,
-55592,
-52286,
-48862,
-45063,
-40821,
-36472,
-31713,
-27062,
-22632,
-18511,
-15190,
-12551,
-10829,
-9782,
-9522,
-9761,
-10891,
-12468,
-14987,
-18049,
-21721,
-25579,
-29519,
-33197,
-36608,
-39797,
-42654,
-45669,
-48144,
-50544,
-52396,
-53755,
-54768,
-55392,
-55744,
-55922,
-55567,
-54972,
-53704,
-52093,
-50205,
-48039,
-45998,
-43873,
-41901,
-40019,
-38248,
-36650,
-35414,
-34257,
-33931,
-33792,
-34594,
-35853,
-37850,
-40460,
-43343,
-46750,
-49988,
-53506,
-56876,
-60217,
-63301,
-65531,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65532,
-65534,
-63896,
-61413,
-59048,
-56606,
-54351,
-51935,
-49609,
-47152,
-44801,
-42502,
-40415,
-38581,
-37028,
-35588,
-34506,
-33282,
-32557,
-31711,
-31360,
-31003,
-30783,
-30626,
-30053,
-29453,
-28413,
-27149,
-25556,
-23628,
-21236,
-18601,
-15387,
-11980,
-8032,
-4073,
-65535,
-65535,
-0,
-65535,
-3,
-65535,
-4,
-65535,
-4,
-65535,
-0,
-0,
-65535,
-3,
-65535,
-3,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-1,
-65535,
-3,
-65535,
-4,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-3,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-2409,
-8189,
-14548,
-21901,
-29740,
-38337,
-46972,
-54860,
-61681,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65533,
-64873,
-61168,
-57498,
-53285,
-48613,
-43939,
-39730,
-36698,
-34990,
-34747,
-35568,
-37336,
-39845,
-43317,
-47661,
-52953,
-58692,
-64382,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-64779,
-60155,
-55168,
-49942,
-44537,
-38800,
-33153,
-28125,
-23717,
-20614,
-18425,
-17226,
-16939,
-17362,
-19062,
-21749,
-25708,
-30606,
-35855,
-41148,
-45977,
-50119,
-53884,
-56919,
-59821,
-61790,
-63255,
-63763,
-63695,
-63234,
-62520,
-62037,
-60950,
-59797,
-57629,
-54813,
-51339,
-47415,
-43453,
-39487,
-35235,
-30781,
-25757,
-20502,
-14926,
-9563,
-4578,
-42,
-65535,
-3,
-65535,
-0,
-0,
-65535,
-2,
-65535,
-2,
-65535,
-2697,
-6597,
-10713,
-14658,
-18579,
-22187,
-25558,
-28322,
-30893,
-32799,
-34635,
-35945,
-37227,
-38336,
-39243,
-40085,
-40551,
-40882,
-40796,
-40437,
-39710,
-38469,
-37093,
-35194,
-33259,
-31118,
-29097,
-27084,
-25268,
-23804,
-22545,
-21965,
-22012,
-22742,
-24425,
-26731,
-29628,
-33133,
-36827,
-41017,
-45312,
-49787,
-53949,
-57941,
-61101,
-63812,
-65531,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-63852,
-60639,
-57119,
-52865,
-48458,
-43872,
-39223,
-34723,
-30297,
-25909,
-21900,
-17937,
-14545,
-11625,
-9452,
-8123,
-7836,
-8324,
-9894,
-11935,
-14656,
-17604,
-20817,
-24313,
-27948,
-31713,
-35500,
-39001,
-42144,
-44649,
-46949,
-48860,
-50935,
-52980,
-54988,
-56788,
-58114,
-58891,
-59200,
-59244,
-58779,
-58404,
-57338,
-56035,
-54126,
-51848,
-49342,
-46931,
-44670,
-42920,
-41415,
-40305,
-39533,
-38977,
-38979,
-39264,
-40242,
-41633,
-43787,
-46241,
-49256,
-52179,
-55323,
-58182,
-60661,
-63056,
-64736,
-65534,
-65533,
-65534,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65533,
-65534,
-65290,
-63432,
-61326,
-58470,
-55589,
-52401,
-49099,
-45867,
-42522,
-39376,
-36320,
-33551,
-30916,
-28788,
-26818,
-25290,
-24137,
-23031,
-22254,
-21413,
-20839,
-20216,
-19841,
-19442,
-19043,
-18557,
-17536,
-16342,
-14479,
-12379,
-9959,
-7218,
-4357,
-1213,
-65535,
-0,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-2,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-3,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-1,
-65535,
-0,
-0,
-65535,
-2,
-65535,
-0,
-0,
-65535,
-2,
-1543,
-3541,
-5619,
-7925,
-10515,
-13419,
-16583,
-19576,
-22630,
-25070,
-27657,
-30098,
-32952,
-36320,
-39996,
-44228,
-48590,
-53419,
-58160,
-63408,
-65534,
-65534,
-65533,
-65534,
-65534,
-65533,
-65534,
-65531,
-65534,
-65532,
-65534,
-65532,
-65534,
-65534,
-65532,
-65534,
-65532,
-65534,
-64314,
-61927,
-59464,
-57274,
-55081,
-53175,
-51182,
-49433,
-47704,
-46464,
-45602,
-45510,
-46177,
-47617,
-49785,
-52446,
-55545,
-58734,
-61883,
-64712,
-65534,
-65532,
-65534,
-65532,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-63455,
-60792,
-58339,
-55477,
-52757,
-49607,
-46777,
-43825,
-41086,
-38820,
-36698,
-35411,
-34370,
-34151,
-34347,
-35014,
-36209,
-37627,
-39530,
-41793,
-44113,
-46823,
-49252,
-51715,
-53574,
-55101,
-55991,
-56408,
-56210,
-55680,
-54568,
-53223,
-51378,
-49259,
-46616,
-43720,
-40238,
-36610,
-32663,
-28769,
-24911,
-21348,
-17847,
-14680,
-11666,
-8570,
-5949,
-3010,
-658,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-747,
-3494,
-6619,
-9583,
-12711,
-15608,
-18492,
-21056,
-23520,
-25686,
-27727,
-29432,
-31002,
-32335,
-33616,
-34725,
-35879,
-36960,
-38204,
-39354,
-40615,
-41727,
-42808,
-43653,
-44292,
-44604,
-44781,
-44782,
-44579,
-44541,
-44245,
-44230,
-44049,
-44160,
-44317,
-44936,
-45776,
-47064,
-48633,
-50276,
-52133,
-53731,
-55299,
-56612,
-57668,
-58429,
-58975,
-59070,
-59265,
-59046,
-59133,
-58846,
-58846,
-58380,
-58094,
-57316,
-56345,
-55188,
-53643,
-52111,
-50186,
-48370,
-46241,
-44383,
-42212,
-40173,
-37982,
-35610,
-33441,
-31159,
-29078,
-27347,
-25647,
-24643,
-23655,
-23359,
-23342,
-23871,
-24890,
-26155,
-27570,
-28922,
-30228,
-31404,
-32619,
-33775,
-34900,
-35855,
-36631,
-36961,
-37163,
-37160,
-37207,
-37271,
-37429,
-37247,
-36989,
-36382,
-35548,
-34900,
-34061,
-33397,
-32553,
-31581,
-30604,
-29411,
-28478,
-27593,
-26951,
-26329,
-25823,
-25398,
-25293,
-25374,
-26179,
-27146,
-28881,
-30625,
-32889,
-35055,
-37518,
-39929,
-42323,
-44360,
-46176,
-47417,
-48392,
-49144,
-49632,
-50162,
-50453,
-50693,
-50586,
-50273,
-49697,
-48880,
-47970,
-46951,
-45668,
-44381,
-42699,
-40794,
-38868,
-36584,
-34571,
-32289,
-30028,
-27750,
-25287,
-22855,
-20504,
-18357,
-16564,
-15075,
-13908,
-12995,
-12199,
-11691,
-11200,
-11094,
-11024,
-11047,
-10894,
-10491,
-9854,
-8920,
-8056,
-6974,
-6106,
-5201,
-4314,
-3516,
-2609,
-2076,
-1413,
-1080,
-659,
-39,
-0,
-65535,
-1,
-65535,
-65535,
-65535,
-65535,
-65535,
-2,
-65535,
-1,
-65535,
-3,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-0,
-461,
-1964,
-3541,
-5264,
-6863,
-8632,
-10383,
-12244,
-14303,
-16363,
-18667,
-20703,
-22856,
-24423,
-26155,
-27480,
-28858,
-30270,
-31340,
-32551,
-33155,
-33904,
-34193,
-34860,
-35254,
-36013,
-36317,
-36498,
-36232,
-35719,
-35327,
-35187,
-35591,
-36296,
-36764,
-37028,
-36365,
-35433,
-34106,
-33239,
-32624,
-32839,
-33355,
-34590,
-36409,
-39199,
-42743,
-46864,
-51004,
-54328,
-56607,
-57585,
-57649,
-57362,
-57140,
-57029,
-57119,
-56984,
-56611,
-56075,
-55369,
-54615,
-53951,
-52777,
-51449,
-49540,
-47486,
-45755,
-44115,
-43055,
-41745,
-40019,
-37539,
-34304,
-30781,
-27839,
-25575,
-24715,
-24802,
-25754,
-27328,
-29164,
-31360,
-33727,
-36277,
-38645,
-40882,
-42744,
-44536,
-46267,
-48301,
-50519,
-52930,
-54860,
-56210,
-56675,
-56188,
-55191,
-53817,
-52446,
-51557,
-50918,
-50716,
-50629,
-50340,
-49808,
-48924,
-47726,
-46554,
-45333,
-44317,
-43385,
-42499,
-41947,
-41589,
-41705,
-41988,
-42369,
-42916,
-43545,
-44622,
-46467,
-48834,
-52088,
-55504,
-58910,
-61837,
-64140,
-65533,
-65534,
-65534,
-65534,
-65534,
-64603,
-63055,
-61504,
-59709,
-57761,
-55435,
-52532,
-49190,
-45511,
-41835,
-38513,
-35722,
-33594,
-31848,
-30337,
-28813,
-26861,
-24847,
-22343,
-19930,
-17448,
-15345,
-13505,
-12555,
-11975,
-12446,
-13259,
-14704,
-16163,
-17870,
-19530,
-21103,
-22897,
-24470,
-26331,
-27814,
-29343,
-30405,
-31227,
-31556,
-31294,
-30382,
-29056,
-27281,
-25669,
-24201,
-23077,
-22386,
-21790,
-21481,
-21280,
-21124,
-21038,
-20925,
-20728,
-20461,
-20171,
-19599,
-19418,
-18757,
-18600,
-18222,
-18227,
-18597,
-19445,
-20746,
-22833,
-25066,
-28038,
-30980,
-34283,
-37427,
-40462,
-43253,
-45400,
-47284,
-48326,
-49120,
-49502,
-49517,
-49546,
-48966,
-48502,
-47528,
-46619,
-45667,
-44715,
-44137,
-43388,
-43184,
-42723,
-42786,
-42766,
-42986,
-43298,
-43451,
-43452,
-43387,
-43050,
-42968,
-43007,
-43408,
-44139,
-45180,
-46617,
-48261,
-50428,
-52799,
-55568,
-58180,
-60685,
-62589,
-64051,
-65025,
-65534,
-65534,
-65534,
-64759,
-63586,
-61992,
-60195,
-58316,
-56320,
-54349,
-52158,
-49962,
-47462,
-45003,
-42587,
-40196,
-38071,
-35719,
-33555,
-31111,
-28769,
-26330,
-24071,
-21834,
-19819,
-17936,
-16362,
-15102,
-14236,
-13904,
-13908,
-14365,
-14994,
-15872,
-16743,
-17668,
-18469,
-18998,
-19420,
-19620,
-19572,
-19579,
-19372,
-19112,
-18888,
-18332,
-17961,
-17357,
-16809,
-16162,
-15456,
-14524,
-13528,
-12421,
-11291,
-10095,
-9098,
-7924,
-7039,
-6129,
-5533,
-5022,
-4868,
-4978,
-5289,
-6151,
-7106,
-8699,
-10449,
-12510,
-14679,
-16895,
-19133,
-21477,
-23809,
-26305,
-28592,
-30825,
-32711,
-34237,
-35811,
-36983,
-38425,
-39443,
-40395,
-41060,
-41237,
-41436,
-41238,
-41102,
-40863,
-40304,
-39845,
-39018,
-38162,
-37534,
-36589,
-36318,
-35612,
-35455,
-35125,
-35012,
-35103,
-35144,
-35436,
-35587,
-35990,
-36251,
-36787,
-37226,
-37761,
-38135,
-38225,
-38115,
-37735,
-37142,
-36561,
-35902,
-35231,
-34772,
-34059,
-33707,
-32998,
-32598,
-31956,
-31271,
-30405,
-29298,
-28059,
-26663,
-25066,
-23498,
-21921,
-20682,
-19666,
-19172,
-18604,
-18554,
-18003,
-18047,
-17869,
-18444,
-19089,
-20239,
-21324,
-22212,
-22941,
-23316,
-23720,
-24179,
-24605,
-25045,
-24935,
-24824,
-23961,
-23516,
-22633,
-22055,
-21259,
-20172,
-18845,
-17336,
-15546,
-13836,
-11758,
-9319,
-6506,
-3053,
-65535,
-1,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-1,
-1854,
-6042,
-9762,
-12155,
-14149,
-15543,
-17251,
-19306,
-21549,
-24090,
-26223,
-28367,
-30162,
-31935,
-33593,
-34972,
-36074,
-36719,
-36941,
-37026,
-37076,
-36872,
-36762,
-35724,
-34279,
-31738,
-28787,
-25223,
-22057,
-19174,
-17429,
-16848,
-17717,
-19859,
-23190,
-27101,
-31296,
-35320,
-39047,
-42585,
-46047,
-49738,
-53668,
-58198,
-62616,
-65531,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-63475,
-60352,
-57628,
-55079,
-52846,
-50514,
-48638,
-47172,
-46707,
-47042,
-48123,
-49590,
-51047,
-52114,
-52710,
-52732,
-52335,
-51646,
-50828,
-50031,
-49476,
-48923,
-48702,
-48346,
-47971,
-47172,
-45935,
-44203,
-42103,
-39795,
-37605,
-35480,
-33748,
-31936,
-30073,
-28035,
-25313,
-22475,
-19066,
-15832,
-12575,
-9941,
-7745,
-6641,
-6241,
-6706,
-7858,
-9186,
-10605,
-11756,
-12775,
-13462,
-14302,
-15147,
-16294,
-17584,
-19174,
-20596,
-21987,
-22943,
-23649,
-23828,
-23873,
-23449,
-23388,
-23092,
-23256,
-23403,
-23764,
-24159,
-24624,
-25070,
-25530,
-25869,
-26128,
-26045,
-25885,
-25624,
-25376,
-25403,
-25485,
-25980,
-26438,
-27240,
-28125,
-29253,
-30761,
-32377,
-34415,
-36165,
-38158,
-39598,
-41126,
-42123,
-42965,
-43717,
-44118,
-44690,
-45271,
-45841,
-46733,
-47238,
-47792,
-47885,
-47790,
-47287,
-46839,
-46176,
-45734,
-45113,
-44670,
-43984,
-43740,
-43451,
-43498,
-43693,
-43808,
-43695,
-43385,
-42590,
-41856,
-40993,
-40440,
-40129,
-40086,
-40130,
-40284,
-40372,
-40354,
-40081,
-39824,
-39063,
-38514,
-37582,
-36940,
-36253,
-35745,
-35321,
-34883,
-34590,
-34305,
-34216,
-34126,
-34040,
-33750,
-33395,
-32689,
-31999,
-31339,
-30890,
-30807,
-30847,
-31028,
-31180,
-31160,
-31135,
-31028,
-31070,
-31181,
-31535,
-31758,
-32132,
-32358,
-32640,
-32999,
-33262,
-33797,
-34257,
-34684,
-35165,
-35258,
-35391,
-35077,
-34859,
-34438,
-34125,
-33864,
-33815,
-33795,
-34061,
-34149,
-34437,
-34659,
-35035,
-35478,
-36099,
-36696,
-37339,
-37980,
-38558,
-39242,
-39977,
-40681,
-41637,
-42366,
-43496,
-44294,
-45424,
-46019,
-46822,
-47058,
-47444,
-47588,
-47998,
-48144,
-48636,
-48591,
-48744,
-48305,
-47946,
-47219,
-46397,
-45223,
-43853,
-42099,
-40285,
-38403,
-36804,
-35350,
-34210,
-33026,
-31884,
-30676,
-29275,
-27946,
-26532,
-25399,
-24448,
-23672,
-23209,
-22873,
-22745,
-22540,
-22434,
-22342,
-22256,
-22411,
-22230,
-22303,
-21852,
-21660,
-21346,
-21280,
-21370,
-21367,
-21194,
-20570,
-19599,
-18376,
-17097,
-16073,
-15147,
-14368,
-13374,
-12177,
-10781,
-9232,
-7901,
-6463,
-5467,
-4400,
-3740,
-3140,
-3205,
-3541,
-4488,
-5557,
-6749,
-7793,
-8697,
-9477,
-10159,
-11072,
-12109,
-13639,
-15102,
-16825,
-18095,
-19305,
-19977,
-20791,
-21414,
-22476,
-23384,
-24449,
-24979,
-25156,
-24891,
-24581,
-24226,
-24094,
-23893,
-23540,
-22699,
-21611,
-20375,
-19327,
-18804,
-18619,
-18824,
-19132,
-19262,
-19357,
-19150,
-19004,
-18617,
-18295,
-17843,
-17451,
-17050,
-16583,
-16143,
-15611,
-15231,
-15326,
-16093,
-18094,
-20725,
-24116,
-26952,
-29141,
-29987,
-29806,
-29056,
-27992,
-27393,
-26884,
-26974,
-26904,
-26997,
-26928,
-26795,
-26553,
-26219,
-25422,
-24538,
-23072,
-21659,
-20194,
-19044,
-18379,
-18024,
-17957,
-18048,
-18001,
-17694,
-17203,
-16409,
-16007,
-15789,
-16650,
-18114,
-20749,
-23604,
-26753,
-29231,
-31271,
-32398,
-33398,
-34278,
-35573,
-37443,
-39713,
-42320,
-44715,
-46709,
-48256,
-49125,
-49629,
-49878,
-49894,
-49834,
-49608,
-49079,
-48302,
-47372,
-46243,
-45424,
-44758,
-44471,
-44692,
-45114,
-45998,
-47218,
-48879,
-50738,
-53132,
-55058,
-57029,
-58471,
-59531,
-60662,
-61991,
-63764,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-62345,
-58823,
-55746,
-53042,
-50872,
-48901,
-47305,
-45557,
-43917,
-42123,
-40351,
-38534,
-36808,
-35211,
-33730,
-32575,
-31560,
-30868,
-30431,
-29938,
-29500,
-28655,
-27682,
-26463,
-25423,
-24204,
-23450,
-22411,
-21523,
-20130,
-18488,
-16519,
-14237,
-12021,
-9720,
-7634,
-5799,
-3960,
-2629,
-1060,
-65535,
-65535,
-2,
-65535,
-5,
-65535,
-2,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-1061,
-2560,
-4274,
-5772,
-7395,
-9076,
-10780,
-12710,
-14281,
-16051,
-17386,
-18862,
-20265,
-21632,
-23121,
-24424,
-25822,
-26972,
-28303,
-29430,
-30850,
-32111,
-33572,
-34950,
-36493,
-38117,
-39641,
-41369,
-42679,
-44048,
-45225,
-46264,
-47484,
-48611,
-49835,
-51133,
-52248,
-53462,
-54372,
-55347,
-55966,
-56542,
-56807,
-57142,
-57272,
-57517,
-57784,
-57980,
-58049,
-57872,
-57449,
-56721,
-56054,
-55191,
-54483,
-53906,
-53131,
-52601,
-51911,
-51494,
-50915,
-50717,
-50430,
-50273,
-50297,
-50317,
-50630,
-51091,
-51628,
-52043,
-52314,
-52177,
-51892,
-51426,
-50936,
-50433,
-49936,
-49416,
-49008,
-48415,
-47969,
-47262,
-46465,
-45400,
-44052,
-42475,
-40929,
-39330,
-38204,
-37249,
-36786,
-36320,
-36009,
-35478,
-34815,
-33993,
-33175,
-32532,
-32267,
-32156,
-32531,
-32800,
-33194,
-33466,
-33460,
-33552,
-33462,
-33463,
-33419,
-33439,
-33354,
-33216,
-33045,
-32684,
-32248,
-31533,
-30806,
-29896,
-29076,
-28105,
-27479,
-26577,
-26173,
-25335,
-24869,
-24179,
-23698,
-23161,
-22677,
-22277,
-22164,
-22147,
-22719,
-23295,
-24428,
-25353,
-26399,
-27127,
-27881,
-28500,
-29257,
-30048,
-31007,
-32176,
-33352,
-34504,
-35589,
-36076,
-36519,
-36187,
-36076,
-35368,
-35079,
-34194,
-33595,
-32488,
-31381,
-30161,
-28790,
-27461,
-26041,
-24648,
-23361,
-22145,
-21303,
-20616,
-20437,
-20529,
-20925,
-21591,
-22321,
-23451,
-24380,
-25891,
-27235,
-29013,
-30825,
-32688,
-34481,
-36121,
-37582,
-38890,
-39973,
-40862,
-41589,
-42171,
-42495,
-42925,
-43160,
-43455,
-43716,
-43984,
-44161,
-44161,
-43806,
-43252,
-42323,
-41391,
-40332,
-39438,
-38673,
-37821,
-37298,
-36517,
-35812,
-35034,
-34084,
-33217,
-32313,
-31778,
-31513,
-31603,
-31689,
-31560,
-30891,
-29832,
-28476,
-27021,
-25795,
-24428,
-23229,
-21678,
-20042,
-18222,
-16498,
-14722,
-13043,
-11001,
-8966,
-6397,
-3959,
-1345,
-1,
-65535,
-4,
-65535,
-2,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-1,
-65535,
-2939,
-5757,
-8120,
-10008,
-11091,
-12045,
-12663,
-13708,
-14831,
-16056,
-17137,
-17693,
-17803,
-17492,
-16874,
-16340,
-15920,
-16076,
-16894,
-18578,
-21282,
-24645,
-28568,
-32023,
-35212,
-37295,
-38867,
-40040,
-41459,
-43475,
-46240,
-49857,
-53460,
-57253,
-60219,
-62610,
-64141,
-65446,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65532,
-65534,
-65534,
-63518,
-61615,
-60507,
-60108,
-60330,
-60906,
-61238,
-61437,
-60995,
-60217,
-59335,
-58735,
-58424,
-58958,
-59796,
-61173,
-62590,
-63938,
-64939,
-65511,
-65534,
-65534,
-65444,
-65338,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65092,
-62479,
-59177,
-55922,
-52978,
-50404,
-48394,
-46550,
-44851,
-42939,
-40553,
-38112,
-35036,
-32444,
-29852,
-27836,
-26465,
-25243,
-24693,
-23938,
-23605,
-23232,
-23005,
-22701,
-22518,
-22522,
-22764,
-23629,
-24646,
-26088,
-27436,
-28547,
-29143,
-29431,
-29078,
-28721,
-27993,
-27283,
-26506,
-25757,
-24977,
-24250,
-23540,
-22894,
-22038,
-21232,
-20087,
-18976,
-17780,
-16675,
-15718,
-14905,
-14122,
-13267,
-12351,
-11469,
-10782,
-10448,
-10585,
-11044,
-11892,
-12684,
-13640,
-14349,
-15120,
-15790,
-16272,
-16963,
-17382,
-17870,
-18244,
-18425,
-18599,
-18668,
-18909,
-19222,
-19816,
-20398,
-21188,
-21793,
-22585,
-23031,
-23695,
-24137,
-24559,
-24935,
-25156,
-25467,
-25644,
-26020,
-26065,
-26286,
-26175,
-26308,
-26487,
-27126,
-28127,
-29584,
-31271,
-32886,
-34593,
-35943,
-37515,
-38891,
-40326,
-41617,
-42607,
-43410,
-43894,
-44515,
-45135,
-46133,
-47305,
-48836,
-50205,
-51561,
-52731,
-53663,
-54727,
-55544,
-56433,
-56962,
-57318,
-57118,
-56675,
-56188,
-55545,
-55192,
-54770,
-54548,
-54063,
-53684,
-53065,
-52644,
-52311,
-52180,
-52223,
-52334,
-52488,
-52489,
-52379,
-52245,
-52179,
-52334,
-52444,
-52778,
-52864,
-53088,
-53308,
-53597,
-54215,
-54751,
-55365,
-55681,
-55943,
-56077,
-56321,
-56587,
-56830,
-56807,
-56610,
-55943,
-55325,
-54505,
-53972,
-53396,
-52867,
-52377,
-51781,
-51228,
-50690,
-50102,
-49407,
-48369,
-46954,
-45310,
-43519,
-41947,
-40747,
-39778,
-39441,
-39178,
-39265,
-39444,
-39552,
-39622,
-39552,
-39422,
-39398,
-39377,
-39419,
-39291,
-38974,
-38605,
-38110,
-37764,
-37711,
-37674,
-37757,
-37651,
-37227,
-36896,
-36608,
-36562,
-36809,
-36939,
-36696,
-36321,
-35499,
-34727,
-34080,
-33134,
-32417,
-31097,
-30026,
-28792,
-28144,
-27485,
-27124,
-26645,
-26283,
-26221,
-26353,
-26728,
-27017,
-26975,
-26460,
-25624,
-24536,
-23517,
-22432,
-21281,
-19995,
-18733,
-17650,
-17179,
-17276,
-17821,
-18515,
-18841,
-19135,
-19040,
-19269,
-19327,
-19467,
-19019,
-18292,
-17138,
-16495,
-16033,
-16427,
-16764,
-17381,
-17604,
-17958,
-18335,
-18930,
-19822,
-20834,
-22125,
-23825,
-25669,
-27544,
-28861,
-29294,
-28814,
-27725,
-26463,
-25645,
-25442,
-25846,
-26572,
-26952,
-26906,
-26041,
-24583,
-23050,
-21681,
-20991,
-20883,
-21014,
-20992,
-20351,
-19219,
-17451,
-15652,
-14084,
-12861,
-12334,
-12066,
-12198,
-12046,
-11621,
-10716,
-9521,
-8187,
-7218,
-6217,
-5577,
-4470,
-3515,
-2344,
-1610,
-949,
-481,
-0,
-65535,
-65535,
-0,
-65535,
-3,
-65535,
-3,
-65535,
-65535,
-0,
-1434,
-3782,
-4846,
-4712,
-3384,
-1989,
-1079,
-1457,
-2763,
-4646,
-6309,
-7745,
-8612,
-9586,
-10425,
-11360,
-12064,
-12356,
-12507,
-12733,
-13172,
-13927,
-14725,
-15143,
-15192,
-14810,
-14173,
-13658,
-13354,
-13548,
-14127,
-15300,
-16718,
-18377,
-20043,
-21476,
-22901,
-24113,
-25313,
-26418,
-27416,
-28301,
-29366,
-30494,
-32069,
-33526,
-35237,
-36251,
-37230,
-37604,
-38291,
-39112,
-40437,
-41948,
-43428,
-44451,
-44735,
-44206,
-43340,
-42146,
-41392,
-40905,
-40926,
-41305,
-41656,
-42235,
-42743,
-43496,
-44494,
-45310,
-46445,
-47214,
-48019,
-48853,
-49855,
-51203,
-52755,
-54460,
-56011,
-57428,
-58514,
-59333,
-59930,
-60442,
-61037,
-61837,
-62899,
-64095,
-65226,
-65533,
-65534,
-65533,
-65050,
-63961,
-62811,
-61792,
-60772,
-59710,
-58758,
-57715,
-57074,
-56343,
-55833,
-55015,
-54194,
-53086,
-52357,
-51691,
-51537,
-51337,
-51115,
-50607,
-49942,
-49210,
-48635,
-48236,
-47948,
-47595,
-47106,
-46509,
-45932,
-45601,
-45312,
-45378,
-45227,
-45154,
-44696,
-44179,
-43498,
-42522,
-41435,
-40375,
-39330,
-38691,
-38181,
-37670,
-36984,
-36121,
-35279,
-34636,
-34283,
-33727,
-32976,
-31647,
-30227,
-29123,
-28146,
-27725,
-26865,
-25860,
-24520,
-23202,
-22503,
-22164,
-22211,
-22167,
-21810,
-21172,
-20460,
-19907,
-19465,
-19263,
-18978,
-18689,
-18512,
-18644,
-19243,
-19995,
-20926,
-21437,
-21765,
-21793,
-21897,
-22325,
-23072,
-23962,
-25089,
-26088,
-27016,
-27794,
-28190,
-28279,
-28059,
-27503,
-27263,
-27215,
-27815,
-28522,
-29588,
-30161,
-30850,
-31048,
-31602,
-32023,
-32709,
-33130,
-33552,
-33572,
-33664,
-33704,
-34106,
-34813,
-35789,
-36917,
-38027,
-39330,
-40553,
-41877,
-43187,
-44361,
-45576,
-46423,
-47193,
-47350,
-47441,
-46882,
-46511,
-46043,
-45887,
-45869,
-45907,
-45825,
-45665,
-45380,
-45157,
-44869,
-44672,
-44247,
-43653,
-43052,
-42500,
-42345,
-42432,
-42723,
-42674,
-42303,
-41677,
-40996,
-41102,
-41638,
-43007,
-44449,
-45845,
-47216,
-48437,
-49986,
-51270,
-52467,
-52999,
-52996,
-52759,
-52506,
-52671,
-53060,
-53534,
-53571,
-53332,
-52821,
-52732,
-52955,
-54105,
-55059,
-56232,
-56520,
-56431,
-55923,
-55213,
-54549,
-53973,
-53352,
-53288,
-53350,
-54020,
-54857,
-55857,
-56763,
-57804,
-58847,
-60129,
-61086,
-61410,
-61154,
-60038,
-58938,
-58091,
-57893,
-58005,
-58114,
-57650,
-56698,
-55434,
-54195,
-53109,
-51690,
-49413,
-46483,
-43145,
-40880,
-39998,
-39908,
-39420,
-37007,
-32864,
-28214,
-24447,
-22633,
-21810,
-21082,
-19797,
-18045,
-16986,
-16427,
-16011,
-14524,
-12265,
-10007,
-9408,
-10494,
-12000,
-12243,
-9917,
-6574,
-3627,
-3473,
-5177,
-7902,
-8589,
-7392,
-4516,
-2271,
-1684,
-3091,
-4805,
-5618,
-4559,
-2474,
-374,
-65535,
-1,
-82,
-0,
-65535,
-0,
-65535,
-684,
-3248,
-5202,
-4933,
-3893,
-3318,
-4734,
-8390,
-13129,
-17582,
-20947,
-22966,
-23980,
-24317,
-24424,
-24825,
-26530,
-29962,
-34572,
-39086,
-41505,
-41367,
-39069,
-36740,
-35632,
-36942,
-39374,
-42170,
-43737,
-43898,
-42895,
-40952,
-38777,
-36319,
-33863,
-32242,
-31361,
-32265,
-33728,
-35546,
-35853,
-34305,
-30916,
-26994,
-24028,
-23206,
-24559,
-27460,
-30805,
-33551,
-35123,
-35058,
-33374,
-30471,
-27329,
-24912,
-24049,
-24537,
-25465,
-25867,
-25178,
-23784,
-22519,
-21083,
-19661,
-16964,
-13814,
-10761,
-9362,
-9588,
-10823,
-10895,
-9251,
-5733,
-1966,
-65535,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-3,
-65535,
-1,
-65535,
-0,
-65535,
-2,
-1055,
-1769,
-2407,
-2854,
-3161,
-3118,
-2920,
-2982,
-3653,
-5219,
-7439,
-9606,
-11492,
-12464,
-12886,
-13107,
-13727,
-15433,
-18380,
-22098,
-25978,
-29075,
-30895,
-31867,
-32621,
-34061,
-36718,
-39953,
-43584,
-46465,
-48346,
-49611,
-50051,
-50540,
-50917,
-51712,
-52956,
-55079,
-57850,
-60949,
-63785,
-65534,
-65534,
-65534,
-65379,
-65180,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65530,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65532,
-65534,
-65136,
-64006,
-62856,
-61325,
-59445,
-56874,
-54416,
-52422,
-51117,
-50605,
-49943,
-48921,
-47218,
-45025,
-43031,
-41149,
-39530,
-37695,
-35830,
-33842,
-32596,
-31982,
-31820,
-31428,
-29894,
-27240,
-23783,
-20727,
-18665,
-18116,
-18155,
-18047,
-16985,
-14787,
-12048,
-9339,
-6996,
-5397,
-4139,
-3802,
-4139,
-5486,
-7040,
-7878,
-7305,
-5223,
-2916,
-1571,
-2494,
-5313,
-8720,
-11359,
-11955,
-11003,
-8921,
-7459,
-6971,
-8525,
-11177,
-14550,
-17114,
-17981,
-16939,
-14746,
-12863,
-12843,
-14812,
-18400,
-21858,
-24135,
-24761,
-24357,
-23894,
-23939,
-24802,
-25665,
-26686,
-27325,
-28703,
-30913,
-34284,
-38178,
-41173,
-42941,
-42699,
-41747,
-41104,
-41924,
-44515,
-48324,
-52246,
-55346,
-56964,
-57294,
-56632,
-55500,
-54351,
-53328,
-53090,
-53638,
-55704,
-58289,
-61239,
-62567,
-62168,
-59666,
-56521,
-53837,
-52602,
-52710,
-53507,
-54528,
-55456,
-56121,
-56566,
-55898,
-54218,
-51314,
-48658,
-47040,
-47105,
-48616,
-50138,
-51450,
-51691,
-51645,
-50744,
-49095,
-45937,
-42320,
-39221,
-38559,
-40437,
-43986,
-46994,
-47883,
-45888,
-42344,
-38226,
-35188,
-33531,
-33506,
-35013,
-37427,
-39865,
-40770,
-39202,
-35364,
-30630,
-26949,
-25866,
-27305,
-30318,
-33572,
-35989,
-36850,
-35856,
-32730,
-28282,
-24090,
-22237,
-24090,
-28946,
-34393,
-37425,
-36810,
-33239,
-29189,
-26862,
-27038,
-29256,
-32287,
-35480,
-38400,
-40950,
-41968,
-41303,
-38557,
-35523,
-33506,
-33929,
-36606,
-40043,
-43139,
-44696,
-44844,
-43698,
-41480,
-38800,
-36299,
-35388,
-36675,
-40064,
-44093,
-46110,
-44893,
-40260,
-34108,
-29562,
-28369,
-30871,
-35101,
-38027,
-38245,
-35303,
-31201,
-27550,
-25688,
-25090,
-25733,
-26750,
-28989,
-31935,
-34081,
-33487,
-28277,
-20131,
-12265,
-10072,
-15389,
-26508,
-37316,
-41260,
-34968,
-21547,
-8056,
-2721,
-8542,
-22213,
-35410,
-40685,
-35499,
-24049,
-13640,
-9717,
-12798,
-19265,
-24845,
-27484,
-28101,
-27749,
-26994,
-24936,
-21523,
-18048,
-17027,
-19374,
-24096,
-28454,
-30032,
-28766,
-25687,
-22611,
-20149,
-18890,
-19175,
-22278,
-28013,
-34504,
-37649,
-34703,
-25998,
-16053,
-11203,
-15165,
-26091,
-37954,
-42637,
-37113,
-24119,
-11642,
-7751,
-14543,
-27774,
-38354,
-39579,
-31356,
-19886,
-13174,
-14945,
-22166,
-28591,
-29762,
-26199,
-22365,
-21657,
-23783,
-25401,
-23251,
-18600,
-14482,
-14722,
-18846,
-24380,
-27571,
-27683,
-25043,
-21151,
-16492,
-11671,
-8587,
-9896,
-16785,
-26505,
-33422,
-32395,
-24076,
-13568,
-8901,
-12554,
-22143,
-30185,
-32510,
-28966,
-24847,
-24026,
-27394,
-31402,
-32865,
-31271,
-29296,
-30320,
-34788,
-40354,
-43849,
-43165,
-39597,
-35966,
-34414,
-36322,
-40104,
-44496,
-47415,
-47882,
-45801,
-41878,
-37894,
-35432,
-35701,
-38247,
-41634,
-44252,
-44800,
-43920,
-42121,
-40950,
-40196,
-40039,
-39579,
-39063,
-38803,
-39752,
-41679,
-44452,
-45950,
-45849,
-43049,
-39224,
-35921,
-34923,
-36986,
-40727,
-44293,
-45624,
-43627,
-39556,
-35012,
-32466,
-32466,
-34813,
-37384,
-38578,
-37008,
-33416,
-28969,
-25708,
-24228,
-24712,
-25534,
-25467,
-24070,
-21813,
-20106,
-19775,
-20460,
-21015,
-20349,
-18137,
-15941,
-14748,
-15608,
-17494,
-18821,
-18402,
-16075,
-13306,
-11314,
-11333,
-12557,
-14411,
-15812,
-16184,
-16009,
-15057,
-13994,
-12840,
-11603,
-11001,
-10406,
-10494,
-10781,
-11047,
-11514,
-11444,
-10695,
-8896,
-6443,
-4201,
-3629,
-5199,
-8677,
-12399,
-14480,
-13906,
-11223,
-8280,
-7081,
-9099,
-13550,
-19000,
-23029,
-24515,
-23494,
-21326,
-19862,
-20461,
-23341,
-27702,
-32181,
-35607,
-37098,
-37006,
-35787,
-34483,
-34436,
-35833,
-38912,
-42432,
-45158,
-45999,
-44959,
-42808,
-40995,
-40571,
-41460,
-43118,
-44738,
-45467,
-45666,
-45403,
-45111,
-45070,
-45135,
-45800,
-46973,
-48858,
-51202,
-53244,
-54658,
-54749,
-54039,
-52777,
-51935,
-51847,
-53043,
-54858,
-57185,
-58823,
-59688,
-59400,
-58380,
-57251,
-56232,
-55812,
-55500,
-55592,
-55432,
-55636,
-55478,
-55236,
-54395,
-52886,
-51160,
-49942,
-49366,
-49389,
-49142,
-47841,
-45950,
-43966,
-43472,
-44381,
-46512,
-47966,
-48173,
-46618,
-44515,
-42855,
-42520,
-43143,
-44160,
-44760,
-45134,
-45557,
-46619,
-47970,
-49013,
-48810,
-47064,
-44625,
-42632,
-42368,
-43805,
-45889,
-47395,
-47172,
-45624,
-43738,
-42900,
-43207,
-43940,
-43452,
-41081,
-37362,
-34081,
-33398,
-35854,
-39929,
-43277,
-42851,
-39224,
-33417,
-29100,
-27702,
-29811,
-33038,
-35282,
-35011,
-32888,
-30494,
-29365,
-29653,
-30538,
-30562,
-29475,
-28103,
-27703,
-29410,
-31933,
-33951,
-33351,
-30650,
-27172,
-25511,
-26530,
-29209,
-31315,
-30715,
-27549,
-23497,
-21145,
-21970,
-25019,
-28417,
-29761,
-28326,
-25465,
-22587,
-21768,
-22632,
-24492,
-25754,
-26242,
-26065,
-26573,
-27795,
-29050,
-29371,
-27432,
-24298,
-21476,
-21061,
-24270,
-29496,
-35194,
-38221,
-37874,
-34900,
-31092,
-28924,
-28898,
-30895,
-33306,
-35346,
-36497,
-37338,
-37915,
-38402,
-37804,
-35699,
-32444,
-29144,
-28234,
-30143,
-34854,
-39623,
-41989,
-40484,
-36166,
-31578,
-28990,
-29053,
-30253,
-31289,
-31805,
-33238,
-36233,
-40106,
-41659,
-39132,
-32666,
-26750,
-25135,
-29719,
-37451,
-43205,
-44187,
-40568,
-36347,
-34455,
-35171,
-36938,
-37251,
-36741,
-36407,
-37562,
-39507,
-40199,
-38886,
-36455,
-34967,
-35834,
-37804,
-38600,
-36321,
-31978,
-27948,
-27415,
-30606,
-35809,
-40265,
-41722,
-40174,
-36719,
-33285,
-31116,
-30959,
-32598,
-35435,
-38800,
-41326,
-42898,
-42810,
-42012,
-40771,
-39910,
-39706,
-39778,
-40215,
-40443,
-41124,
-42168,
-44205,
-45954,
-46622,
-44623,
-40420,
-35719,
-33000,
-33638,
-36631,
-39087,
-38980,
-36273,
-33442,
-32797,
-34083,
-35102,
-33109,
-28543,
-24605,
-24955,
-30143,
-36716,
-39755,
-37358,
-31716,
-27502,
-27528,
-30627,
-33107,
-32800,
-30581,
-30232,
-33703,
-39667,
-44069,
-43277,
-38026,
-31800,
-28901,
-31046,
-36277,
-41215,
-43386,
-42477,
-39664,
-36563,
-33552,
-31003,
-28658,
-27148,
-26863,
-28479,
-31468,
-35170,
-37913,
-38735,
-36563,
-32112,
-26486,
-22343,
-21524,
-24713,
-31072,
-37248,
-40775,
-39063,
-33088,
-25466,
-20815,
-21724,
-28013,
-35367,
-39157,
-36716,
-30608,
-25729,
-26400,
-31799,
-36809,
-36296,
-28924,
-19706,
-14814,
-17624,
-25291,
-31447,
-31757,
-26352,
-20130,
-17069,
-18006,
-19948,
-19822,
-17158,
-14349,
-13859,
-15921,
-18135,
-18335,
-15698,
-12332,
-10251,
-10469,
-12513,
-14632,
-16255,
-16827,
-16673,
-15168,
-13063,
-10670,
-10118,
-12065,
-15700,
-18732,
-18624,
-15276,
-10540,
-7723,
-8479,
-12177,
-16141,
-17893,
-16959,
-14659,
-12974,
-12819,
-13396,
-13526,
-12180,
-10358,
-9544,
-10911,
-14262,
-17336,
-18225,
-15964,
-11933,
-8833,
-8854,
-12045,
-16494,
-19245,
-18820,
-15987,
-13197,
-12596,
-14792,
-18068,
-20195,
-19907,
-17671,
-15498,
-15213,
-17248,
-20949,
-23959,
-25579,
-24801,
-23186,
-21989,
-22255,
-24469,
-27151,
-28921,
-28768,
-26396,
-24028,
-23118,
-25156,
-29078,
-32886,
-34593,
-33861,
-32067,
-31292,
-32310,
-34416,
-36031,
-36210,
-35589,
-35654,
-37451,
-39972,
-42236,
-41944,
-40265,
-38178,
-37938,
-39974,
-43252,
-45957,
-46949,
-46178,
-44980,
-44582,
-45401,
-47283,
-48924,
-49718,
-49369,
-48234,
-47728,
-48169,
-50185,
-52534,
-53994,
-53243,
-50672,
-47638,
-46310,
-47681,
-50852,
-53771,
-54197,
-51910,
-48571,
-46441,
-47128,
-49700,
-52022,
-51781,
-48656,
-44162,
-41080,
-41041,
-43892,
-47351,
-49344,
-48435,
-46066,
-43629,
-42832,
-43007,
-42835,
-40968,
-38249,
-36630,
-38267,
-42790,
-47680,
-49302,
-46174,
-39467,
-33527,
-31471,
-34835,
-40993,
-46288,
-47260,
-43586,
-36896,
-30803,
-28105,
-30137,
-35591,
-42056,
-45778,
-44913,
-38956,
-30450,
-23141,
-20417,
-24292,
-32777,
-42388,
-47949,
-46463,
-38159,
-26330,
-16741,
-13239,
-17317,
-26195,
-35502,
-41282,
-41545,
-37496,
-30781,
-24426,
-19509,
-17515,
-18732,
-23076,
-29297,
-35324,
-38491,
-37802,
-32999,
-26794,
-21238,
-18820,
-19908,
-24026,
-29632,
-35190,
-39465,
-41015,
-39842,
-35389,
-29521,
-24181,
-21990,
-24381,
-30605,
-37804,
-42521,
-42744,
-38734,
-33662,
-29874,
-29122,
-30337,
-32403,
-34855,
-38050,
-42830,
-47307,
-49298,
-46112,
-38843,
-31094,
-27748,
-31069,
-39290,
-47990,
-53133,
-53286,
-50207,
-45978,
-42631,
-40396,
-39797,
-41259,
-45380,
-50738,
-55169,
-55989,
-52555,
-47262,
-42677,
-41126,
-41547,
-42124,
-41789,
-41328,
-42918,
-47042,
-51846,
-53906,
-50142,
-41723,
-31825,
-25797,
-25912,
-31644,
-39244,
-44361,
-44758,
-40440,
-34039,
-28410,
-25514,
-25641,
-27906,
-30935,
-34085,
-36450,
-38051,
-37511,
-35218,
-30711,
-26223,
-23140,
-23649,
-27285,
-32885,
-37494,
-39267,
-37381,
-32733,
-27548,
-24072,
-23937,
-27617,
-33327,
-38848,
-41433,
-39535,
-33859,
-26464,
-20949,
-19506,
-23167,
-29959,
-37121,
-41367,
-41394,
-38046,
-33530,
-30716,
-30406,
-32266,
-34637,
-35788,
-36098,
-35856,
-36716,
-38405,
-40614,
-41749,
-41479,
-39997,
-38733,
-38825,
-40571,
-43232,
-45555,
-46574,
-46135,
-44822,
-43389,
-42053,
-40686,
-38599,
-36344,
-34436,
-34526,
-36896,
-41324,
-45337,
-47216,
-45180,
-39908,
-33596,
-29319,
-28791,
-32663,
-37982,
-42479,
-42741,
-38957,
-32309,
-26287,
-23673,
-25643,
-31249,
-37648,
-41658,
-41657,
-38004,
-33550,
-31007,
-32595,
-36921,
-41278,
-41750,
-37845,
-30895,
-25644,
-24601,
-28126,
-33065,
-35830,
-35082,
-32442,
-30516,
-31428,
-33216,
-34018,
-31424,
-27128,
-24048,
-24848,
-29054,
-33684,
-34881,
-31113,
-24183,
-18047,
-16229,
-19554,
-26241,
-31979,
-34016,
-30960,
-24580,
-18137,
-15341,
-16965,
-22850,
-29101,
-33086,
-32552,
-28350,
-22251,
-17585,
-15341,
-16431,
-19133,
-22342,
-24693,
-26196,
-26751,
-26864,
-26218,
-24161,
-20704,
-16297,
-13306,
-13285,
-17559,
-23850,
-29365,
-30450,
-26330,
-18889,
-12089,
-9295,
-11892,
-17601,
-23497,
-26219,
-24957,
-20683,
-15587,
-11979,
-10891,
-12089,
-14702,
-17337,
-18934,
-19241,
-18159,
-16295,
-13995,
-12109,
-10738,
-10715,
-11689,
-13773,
-16362,
-18911,
-20504,
-20573,
-18466,
-14770,
-10536,
-7992,
-8676,
-12999,
-19261,
-24430,
-26017,
-23165,
-17802,
-13196,
-12155,
-15610,
-21570,
-26880,
-28662,
-26457,
-22083,
-18530,
-18470,
-21811,
-27017,
-31381,
-33328,
-32667,
-31003,
-29078,
-28124,
-27992,
-28898,
-31582,
-35389,
-39797,
-42345,
-41745,
-38226,
-34082,
-32223,
-33771,
-37805,
-41237,
-42654,
-41836,
-40837,
-40950,
-42211,
-42987,
-42300,
-40529,
-39310,
-40217,
-42988,
-46087,
-47639,
-46818,
-44472,
-41545,
-39445,
-38866,
-40461,
-44097,
-48720,
-51539,
-50361,
-44915,
-37980,
-34593,
-37382,
-45447,
-53285,
-55479,
-50186,
-40970,
-33730,
-32731,
-36962,
-42610,
-44981,
-43495,
-40286,
-38734,
-39619,
-41106,
-40349,
-35967,
-29763,
-25267,
-25025,
-29495,
-35903,
-40657,
-40997,
-36295,
-28790,
-21768,
-18489,
-20285,
-25775,
-31780,
-35412,
-34946,
-31957,
-28567,
-26995,
-27150,
-27704,
-26729,
-24403,
-22256,
-22253,
-25313,
-29719,
-32621,
-32089,
-27926,
-22718,
-19622,
-20060,
-23962,
-28013,
-30095,
-28614,
-25022,
-21547,
-20416,
-21879,
-24337,
-26042,
-25822,
-24534,
-23632,
-24600,
-27018,
-29830,
-31624,
-31713,
-30693,
-29057,
-27767,
-27065,
-27877,
-30298,
-34281,
-38004,
-39353,
-37207,
-32465,
-28081,
-26883,
-29233,
-33329,
-36365,
-37139,
-36895,
-37562,
-39285,
-40354,
-38289,
-33110,
-27968,
-26885,
-31646,
-39996,
-46710,
-48256,
-43985,
-37516,
-32574,
-31474,
-33656,
-37809,
-42407,
-46689,
-49762,
-49765,
-46621,
-40813,
-36014,
-34609,
-37610,
-42407,
-46135,
-46594,
-44938,
-42765,
-41525,
-40350,
-38669,
-36540,
-35923,
-38776,
-44206,
-49122,
-49942,
-45424,
-38600,
-33906,
-34570,
-39466,
-44912,
-46600,
-43604,
-38692,
-35766,
-37625,
-42923,
-48167,
-49678,
-46928,
-42412,
-40041,
-41479,
-45182,
-47215,
-45292,
-40772,
-37891,
-40861,
-48525,
-55987,
-56367,
-47903,
-34325,
-24340,
-23891,
-33487,
-47039,
-56963,
-58537,
-52045,
-41636,
-31933,
-26067,
-25752,
-30453,
-38355,
-46155,
-49478,
-47015,
-39734,
-33039,
-30385,
-33219,
-37980,
-41017,
-40704,
-39223,
-39462,
-42016,
-43958,
-42435,
-37272,
-32887,
-33683,
-40773,
-49564,
-53730,
-49744,
-40814,
-33021,
-32110,
-37496,
-44778,
-48395,
-46727,
-42057,
-38448,
-38023,
-40043,
-41988,
-42059,
-40503,
-38473,
-37311,
-37366,
-37756,
-38381,
-38181,
-37049,
-35059,
-32510,
-31202,
-31559,
-34458,
-37739,
-39286,
-37451,
-32398,
-26929,
-24138,
-25799,
-31091,
-37009,
-40238,
-39155,
-34793,
-30049,
-27707,
-28565,
-30916,
-32001,
-30272,
-26995,
-24804,
-26018,
-29833,
-33149,
-32822,
-28634,
-23406,
-21150,
-23005,
-26997,
-28787,
-26110,
-20373,
-15520,
-14948,
-18597,
-23498,
-25797,
-24560,
-20725,
-17406,
-16096,
-17183,
-19420,
-21856,
-23452,
-23871,
-22654,
-20371,
-17938,
-17536,
-19708,
-24028,
-27945,
-28923,
-26332,
-21675,
-18096,
-17975,
-21484,
-26283,
-29854,
-29740,
-27041,
-23183,
-21040,
-21055,
-22236,
-22763,
-21768,
-20506,
-21079,
-24605,
-29052,
-31385,
-28607,
-22082,
-15806,
-14615,
-19774,
-28191,
-34327,
-34747,
-29874,
-24138,
-21435,
-23141,
-27439,
-31291,
-33220,
-33350,
-33353,
-33351,
-33973,
-34039,
-34324,
-34551,
-34567,
-34085,
-32244,
-30715,
-30739,
-33573,
-37960,
-41036,
-39932,
-35011,
-29101,
-26396,
-28657,
-34503,
-39820,
-41568,
-39046,
-34702,
-31824,
-31779,
-34149,
-36430,
-36919,
-35632,
-33863,
-33616,
-35014,
-37315,
-38470,
-37781,
-35900,
-35056,
-36299,
-39441,
-41594,
-40969,
-36874,
-32555,
-30627,
-33086,
-38071,
-42031,
-42348,
-38953,
-34018,
-30582,
-29344,
-30071,
-31628,
-33680,
-35659,
-37114,
-36100,
-32421,
-27105,
-23497,
-24180,
-28879,
-34015,
-35812,
-32907,
-28015,
-25355,
-26752,
-30848,
-33287,
-32131,
-28039,
-25043,
-25689,
-29698,
-34259,
-35989,
-34723,
-32113,
-30183,
-30009,
-29940,
-29343,
-28147,
-27680,
-29079,
-31755,
-33952,
-34171,
-32420,
-29921,
-28189,
-27793,
-27660,
-27570,
-27084,
-26862,
-27371,
-28125,
-28478,
-27860,
-27038,
-26309,
-26728,
-27218,
-27348,
-26243,
-24823,
-23961,
-24780,
-26797,
-28964,
-30076,
-29694,
-28306,
-26703,
-25714,
-25441,
-26465,
-28148,
-30602,
-32204,
-32195,
-30012,
-26704,
-24294,
-24292,
-26707,
-29498,
-31380,
-31049,
-30406,
-29962,
-30208,
-29164,
-26398,
-22299,
-20460,
-22766,
-28611,
-33994,
-34659,
-30317,
-24204,
-21458,
-23251,
-27661,
-29584,
-27795,
-23957,
-22634,
-25201,
-29208,
-30209,
-26306,
-20439,
-17672,
-20879,
-28104,
-33640,
-33926,
-28991,
-23448,
-21016,
-22410,
-24957,
-25999,
-25421,
-25069,
-27369,
-31296,
-34454,
-33979,
-29690,
-24431,
-21454,
-22699,
-27174,
-32042,
-34817,
-34545,
-32401,
-30516,
-30229,
-31912,
-33906,
-34747,
-33086,
-29586,
-26508,
-25820,
-29322,
-34836,
-40283,
-41970,
-39218,
-33710,
-28587,
-26975,
-29451,
-33754,
-37534,
-38251,
-36870,
-35103,
-35015,
-36981,
-39557,
-40437,
-38869,
-35477,
-33086,
-33595,
-37916,
-43939,
-48988,
-50032,
-46617,
-40243,
-34700,
-33111,
-36650,
-44007,
-50915,
-54307,
-52575,
-47663,
-42940,
-41261,
-42565,
-45180,
-46088,
-45445,
-44383,
-45577,
-49277,
-53466,
-54657,
-50985,
-43915,
-37517,
-35832,
-40042,
-47725,
-54506,
-56764,
-53529,
-46997,
-40327,
-36964,
-38047,
-42654,
-48281,
-51381,
-50318,
-45558,
-40237,
-37984,
-39928,
-44383,
-46996,
-45401,
-40240,
-36165,
-36541,
-42279,
-48722,
-50874,
-46395,
-37785,
-30713,
-29168,
-33261,
-39201,
-43208,
-43739,
-42168,
-40040,
-38072,
-35586,
-32823,
-31023,
-31959,
-35278,
-38999,
-40219,
-39022,
-36785,
-36297,
-36941,
-36385,
-32645,
-27347,
-25247,
-29806,
-39446,
-46882,
-45847,
-35741,
-24094,
-20086,
-27192,
-40442,
-49475,
-48235,
-38096,
-27587,
-23900,
-28187,
-35546,
-39864,
-39177,
-35965,
-33618,
-33419,
-34036,
-33843,
-33414,
-34640,
-37868,
-40995,
-40770,
-35857,
-28941,
-24318,
-25221,
-30229,
-36121,
-39154,
-39377,
-38557,
-38379,
-38536,
-37359,
-33863,
-29762,
-27904,
-30274,
-35852,
-41661,
-44135,
-43035,
-39064,
-34682,
-31269,
-29188,
-29165,
-30940,
-34411,
-37475,
-37912,
-34506,
-29252,
-25668,
-27236,
-32933,
-38556,
-39266,
-33418,
-24670,
-18710,
-19598,
-26351,
-34262,
-38466,
-37009,
-32132,
-26951,
-23961,
-23494,
-24338,
-26264,
-28146,
-30141,
-30516,
-29099,
-25822,
-22963,
-21989,
-23297,
-25110,
-25602,
-24070,
-22188,
-22058,
-24178,
-26933,
-27412,
-24649,
-20061,
-17228,
-18200,
-22878,
-27700,
-29812,
-27877,
-23410,
-19660,
-18537,
-20238,
-22987,
-25067,
-25445,
-24712,
-24073,
-24359,
-25665,
-27372,
-28081,
-27546,
-25715,
-23556,
-22370,
-22939,
-25224,
-28923,
-32087,
-34018,
-32996,
-29742,
-25578,
-23473,
-25355,
-30961,
-37936,
-41547,
-40418,
-34924,
-29676,
-28300,
-31693,
-36738,
-39623,
-38400,
-35234,
-33486,
-35190,
-38623,
-40507,
-38710,
-34572,
-31823,
-32929,
-37497,
-42097,
-43876,
-42011,
-38910,
-36566,
-36251,
-36853,
-37294,
-37072,
-37385,
-38422,
-40087,
-41081,
-40174,
-38602,
-36894,
-36876,
-37846,
-38956,
-38803,
-37490,
-35615,
-34611,
-34460,
-35413,
-36252,
-37074,
-37205,
-37228,
-36741,
-35921,
-34592,
-32931,
-31492,
-30538,
-30163,
-30206,
-30162,
-29942,
-30007,
-30936,
-32689,
-34634,
-34685,
-31864,
-26488,
-21432,
-19757,
-23290,
-29572,
-34915,
-35111,
-30264,
-23769,
-20034,
-21617,
-26195,
-30162,
-29965,
-26440,
-22476,
-21504,
-23913,
-27663,
-29938,
-29189,
-26574,
-23760,
-22057,
-22077,
-22942,
-24891,
-26927,
-28458,
-28279,
-25866,
-22985,
-21791,
-23805,
-28035,
-31094,
-30359,
-26223,
-21899,
-21170,
-24491,
-28990,
-30868,
-28882,
-25861,
-25226,
-28566,
-32909,
-34305,
-31091,
-25668,
-22497,
-23385,
-26930,
-28985,
-28549,
-27170,
-28546,
-33219,
-37339,
-36473,
-29146,
-19684,
-14968,
-18534,
-28302,
-37293,
-40397,
-36673,
-30297,
-25309,
-23320,
-23095,
-23187,
-23937,
-26797,
-31556,
-35811,
-36165,
-31956,
-25888,
-22654,
-24557,
-30074,
-34682,
-34945,
-31072,
-26041,
-23695,
-24869,
-27969,
-30429,
-30959,
-30051,
-29233,
-28922,
-29098,
-28769,
-28100,
-27418,
-27769,
-28722,
-29787,
-29607,
-28415,
-26594,
-25999,
-26574,
-28589,
-30230,
-30849,
-29896,
-28456,
-27528,
-28079,
-29676,
-31470,
-31998,
-31073,
-29253,
-27814,
-28392,
-30537,
-33265,
-34591,
-33352,
-30317,
-27770,
-28015,
-31624,
-36762,
-39997,
-38910,
-34196,
-28588,
-26775,
-30160,
-37540,
-44204,
-45934,
-41457,
-33707,
-28058,
-28457,
-35457,
-44735,
-50607,
-49254,
-41593,
-32598,
-28369,
-31645,
-40927,
-50253,
-54458,
-51118,
-43163,
-35611,
-33242,
-36628,
-43298,
-48568,
-49788,
-47083,
-43674,
-42389,
-44670,
-48768,
-51248,
-50164,
-45091,
-39731,
-37737,
-41015,
-48414,
-54594,
-55743,
-49966,
-41256,
-35016,
-35963,
-43055,
-51757,
-55989,
-53906,
-47948,
-42965,
-42079,
-44648,
-47395,
-48435,
-47926,
-47727,
-48569,
-48435,
-45867,
-41258,
-38358,
-40351,
-47262,
-53795,
-54771,
-48591,
-39774,
-34859,
-37028,
-43430,
-48060,
-47238,
-42369,
-38774,
-38917,
-42006,
-42815,
-39461,
-33422,
-30048,
-32269,
-38422,
-43741,
-44227,
-40241,
-35100,
-32645,
-32309,
-32998,
-31979,
-30738,
-30937,
-34084,
-38045,
-39601,
-36384,
-29898,
-24181,
-22920,
-26839,
-32977,
-37713,
-38204,
-34990,
-29676,
-25133,
-22655,
-23118,
-25799,
-29277,
-31622,
-30896,
-27236,
-21770,
-17956,
-17693,
-20993,
-25598,
-27971,
-27059,
-23322,
-19571,
-17784,
-18465,
-20395,
-22145,
-23207,
-24026,
-24582,
-24979,
-23739,
-20992,
-17604,
-15853,
-17495,
-22629,
-29057,
-33859,
-34838,
-31401,
-25511,
-19953,
-17712,
-20087,
-26239,
-33420,
-37714,
-37185,
-31602,
-24889,
-20729,
-22119,
-27884,
-34635,
-37937,
-36386,
-31381,
-26596,
-25024,
-26928,
-30938,
-34038,
-35767,
-35500,
-34858,
-33772,
-32599,
-31004,
-29587,
-29498,
-31246,
-34793,
-38489,
-40818,
-40793,
-38668,
-35433,
-32467,
-30958,
-31539,
-34432,
-38274,
-41300,
-41505,
-38201,
-33065,
-28633,
-27682,
-30207,
-34613,
-37783,
-38424,
-36451,
-33687,
-30911,
-28749,
-26549,
-25490,
-25999,
-29274,
-33642,
-36496,
-35035,
-29565,
-22609,
-18843,
-20131,
-25841,
-31847,
-35079,
-34060,
-30585,
-27325,
-25823,
-26129,
-26975,
-27282,
-27393,
-27815,
-29209,
-31448,
-33175,
-33726,
-32203,
-29539,
-26532,
-25023,
-25355,
-27683,
-30870,
-33595,
-34904,
-34125,
-31759,
-28322,
-25446,
-23872,
-24933,
-27905,
-31999,
-34860,
-35455,
-33507,
-30472,
-28390,
-28060,
-29805,
-31982,
-33835,
-34707,
-35187,
-35347,
-35522,
-34747,
-33063,
-30852,
-29493,
-30610,
-34345,
-39512,
-43361,
-43698,
-39706,
-33421,
-27591,
-25645,
-27813,
-32999,
-37715,
-39752,
-38160,
-33881,
-29034,
-24913,
-22764,
-22920,
-24824,
-28257,
-31004,
-32156,
-30583,
-27461,
-24446,
-23231,
-23737,
-24273,
-23782,
-21989,
-20639,
-21567,
-24271,
-27018,
-27236,
-24518,
-21300,
-20351,
-23496,
-28432,
-32048,
-31201,
-26576,
-21501,
-19487,
-22032,
-27395,
-32376,
-34483,
-33062,
-29589,
-26017,
-24007,
-24314,
-26618,
-30253,
-33948,
-36651,
-37497,
-36581,
-34774,
-32596,
-31115,
-30030,
-30118,
-31579,
-34992,
-39685,
-43719,
-45046,
-42479,
-37580,
-33421,
-32950,
-36743,
-42631,
-46908,
-47572,
-44404,
-40218,
-37538,
-37472,
-39819,
-42766,
-45179,
-46354,
-45954,
-43808,
-40527,
-37317,
-36010,
-37736,
-41615,
-45445,
-46686,
-44824,
-41461,
-38731,
-37917,
-38069,
-37647,
-36145,
-34547,
-34924,
-37185,
-40460,
-41947,
-41059,
-38757,
-36895,
-36431,
-36188,
-34568,
-31515,
-28921,
-29210,
-33131,
-38202,
-40927,
-39266,
-33971,
-28170,
-24601,
-24052,
-25242,
-27397,
-29959,
-33311,
-36805,
-38580,
-36275,
-30075,
-22364,
-17473,
-18310,
-24515,
-32511,
-37891,
-37806,
-33172,
-26908,
-22742,
-22476,
-25710,
-30163,
-33439,
-34019,
-32529,
-30120,
-28943,
-29011,
-30207,
-31159,
-31158,
-30607,
-30292,
-31007,
-32819,
-34681,
-35789,
-35143,
-33333,
-31134,
-30343,
-31753,
-35327,
-39461,
-41950,
-40836,
-36741,
-31845,
-29853,
-32355,
-38424,
-44670,
-47616,
-46132,
-42078,
-38338,
-37179,
-38163,
-39505,
-40378,
-40479,
-41685,
-43667,
-45960,
-45687,
-42478,
-36984,
-32288,
-31271,
-33993,
-39222,
-43762,
-45356,
-43631,
-39309,
-34259,
-30319,
-28411,
-29278,
-32398,
-36631,
-40083,
-40886,
-38443,
-33332,
-28145,
-24848,
-25598,
-29454,
-34660,
-38222,
-38450,
-35475,
-31160,
-27904,
-26861,
-27793,
-29586,
-30982,
-32200,
-32997,
-33818,
-33417,
-31537,
-28323,
-25400,
-24714,
-26640,
-30363,
-33439,
-34438,
-33351,
-31092,
-29080,
-27212,
-25958,
-25264,
-26244,
-29232,
-33328,
-36167,
-35786,
-32158,
-27569,
-25291,
-26462,
-30340,
-33485,
-34392,
-32755,
-30627,
-30382,
-31782,
-34235,
-35592,
-35675,
-34727,
-33948,
-33331,
-32820,
-31978,
-31315,
-31801,
-33551,
-36165,
-37892,
-37605,
-35368,
-32221,
-29987,
-29539,
-30808,
-32907,
-34526,
-35191,
-34259,
-32488,
-30362,
-28678,
-28236,
-28611,
-29587,
-30117,
-29655,
-28787,
-27882,
-28191,
-29075,
-30144,
-30247,
-29280,
-27656,
-26621,
-26394,
-27219,
-28234,
-28634,
-28546,
-27659,
-26972,
-26354,
-26262,
-26620,
-27504,
-28810,
-30120,
-30869,
-30452,
-29010,
-27083,
-25667,
-25354,
-26599,
-28343,
-30320,
-30936,
-30827,
-29609,
-28500,
-27682,
-27527,
-27726,
-28212,
-28679,
-29542,
-30517,
-31470,
-31711,
-31094,
-29718,
-28591,
-28235,
-29010,
-30185,
-31246,
-31539,
-31930,
-32558,
-33681,
-34439,
-34193,
-32710,
-31224,
-30629,
-31844,
-33929,
-35677,
-36409,
-35942,
-35547,
-35342,
-35482,
-35054,
-34129,
-33241,
-33617,
-35279,
-37517,
-38710,
-38226,
-36453,
-34635,
-33553,
-33394,
-33021,
-32709,
-32178,
-32821,
-34390,
-36081,
-36779,
-35595,
-33524,
-31649,
-31380,
-32288,
-33685,
-34371,
-34258,
-34041,
-34014,
-34593,
-35014,
-35056,
-34593,
-34149,
-34127,
-34570,
-35213,
-35764,
-36456,
-37534,
-38960,
-40170,
-40464,
-39465,
-37625,
-35945,
-35388,
-36189,
-37891,
-39354,
-40064,
-39663,
-38891,
-38446,
-38533,
-39091,
-39263,
-38648,
-37625,
-36675,
-37029,
-38158,
-39797,
-40484,
-39664,
-38093,
-36673,
-36720,
-38289,
-39932,
-40926,
-39975,
-38180,
-36564,
-36429,
-38404,
-41324,
-44250,
-45246,
-43806,
-40263,
-36208,
-33819,
-34412,
-38139,
-42897,
-46530,
-46820,
-44049,
-39665,
-36032,
-34768,
-35701,
-37980,
-40353,
-42098,
-43167,
-43139,
-41948,
-38755,
-34659,
-30561,
-29365,
-31845,
-37982,
-44314,
-47397,
-44335,
-36168,
-26571,
-21083,
-22608,
-30806,
-40793,
-47373,
-46863,
-39973,
-30586,
-23336,
-21152,
-23979,
-29743,
-35501,
-39242,
-39798,
-36963,
-31777,
-25757,
-21678,
-21236,
-25290,
-32022,
-38247,
-41060,
-38602,
-31999,
-23829,
-17624,
-15833,
-19485,
-26709,
-34701,
-39200,
-38115,
-31555,
-22856,
-16494,
-15478,
-20129,
-27105,
-32799,
-34457,
-32691,
-29117,
-26047,
-23979,
-22922,
-22740,
-24029,
-27016,
-30827,
-33065,
-31888,
-27373,
-22099,
-19531,
-21303,
-26063,
-30607,
-32288,
-30561,
-27238,
-24271,
-22410,
-21834,
-21746,
-22652,
-24671,
-27437,
-29166,
-28058,
-24270,
-19465,
-17026,
-18249,
-22605,
-27443,
-30201,
-30145,
-27789,
-24670,
-21636,
-19196,
-18160,
-19218,
-22810,
-27704,
-31623,
-32313,
-29184,
-24186,
-19838,
-18204,
-19108,
-21502,
-24005,
-26419,
-28679,
-30316,
-30318,
-27726,
-23317,
-19577,
-18619,
-21506,
-25928,
-29457,
-29738,
-27751,
-25575,
-25158,
-26928,
-29055,
-29897,
-29120,
-27329,
-26660,
-27109,
-28918,
-30100,
-30447,
-29677,
-29230,
-29832,
-31711,
-33908,
-34943,
-34307,
-31889,
-29364,
-27817,
-28608,
-31296,
-34922,
-38248,
-40150,
-40375,
-38955,
-36542,
-33706,
-32066,
-32135,
-34569,
-38292,
-41546,
-42833,
-41546,
-38912,
-36563,
-35966,
-37117,
-38999,
-40309,
-40681,
-40154,
-39640,
-39157,
-39042,
-38825,
-38755,
-38822,
-39268,
-39772,
-40244,
-40104,
-39799,
-39331,
-39489,
-39818,
-40618,
-40859,
-41082,
-40685,
-40282,
-39490,
-38909,
-38248,
-38136,
-38490,
-39466,
-40482,
-41107,
-40813,
-39689,
-38313,
-37270,
-37231,
-38088,
-39469,
-40792,
-41215,
-40904,
-39887,
-38711,
-38027,
-37559,
-37626,
-37628,
-37870,
-37892,
-38070,
-37959,
-37869,
-37275,
-36826,
-36301,
-36073,
-35968,
-35564,
-34662,
-33371,
-31849,
-30956,
-30719,
-31334,
-32180,
-32907,
-32711,
-32154,
-30830,
-29892,
-29192,
-29228,
-29745,
-30360,
-30982,
-31314,
-31513,
-31736,
-31978,
-32089,
-31757,
-31070,
-29965,
-29384,
-29324,
-30248,
-31338,
-32111,
-31956,
-31071,
-29697,
-28545,
-27883,
-27612,
-27684,
-27746,
-27816,
-27526,
-26930,
-25840,
-24650,
-23714,
-23476,
-24092,
-25068,
-25998,
-26331,
-26153,
-25866,
-25620,
-25557,
-25531,
-25315,
-25152,
-25140,
-25771,
-26976,
-28367,
-29431,
-29698,
-29121,
-28013,
-26973,
-26464,
-26595,
-27505,
-28545,
-29587,
-29984,
-29898,
-29231,
-28523,
-27705,
-27303,
-27019,
-27127,
-27681,
-28437,
-29362,
-29854,
-29541,
-28524,
-27327,
-26907,
-27946,
-30030,
-32267,
-33396,
-33151,
-31937,
-30713,
-30364,
-30715,
-31492,
-32109,
-32647,
-33414,
-34175,
-35011,
-35013,
-34660,
-34147,
-34240,
-35122,
-36034,
-36273,
-35459,
-34101,
-33444,
-34037,
-35876,
-37872,
-38887,
-38647,
-37405,
-35987,
-35235,
-34968,
-35678,
-36430,
-37318,
-37824,
-37562,
-36850,
-35524,
-34945,
-34815,
-35986,
-36875,
-37670,
-37362,
-36696,
-35920,
-35724,
-35631,
-35568,
-35346,
-35144,
-35568,
-36365,
-37314,
-37629,
-36961,
-35987,
-34970,
-34923,
-35413,
-36230,
-36830,
-37338,
-37782,
-38380,
-38579,
-38246,
-36897,
-35543,
-34572,
-34546,
-35635,
-36606,
-37361,
-37186,
-36471,
-35439,
-34365,
-33490,
-33082,
-33531,
-34836,
-36717,
-38338,
-38599,
-37384,
-35057,
-32953,
-32046,
-33063,
-35124,
-37715,
-39133,
-39376,
-37982,
-36297,
-34571,
-34126,
-34748,
-36318,
-37918,
-38798,
-38535,
-37251,
-35765,
-34461,
-34037,
-34061,
-34458,
-34704,
-34703,
-34547,
-34195,
-33771,
-33086,
-32378,
-31403,
-30936,
-30762,
-31335,
-32089,
-32867,
-32971,
-32514,
-31622,
-30451,
-30029,
-29808,
-30317,
-30828,
-31158,
-31136,
-30984,
-30670,
-30585,
-30559,
-30451,
-30118,
-29543,
-28943,
-28524,
-28611,
-28833,
-29145,
-29252,
-28881,
-28431,
-27861,
-27259,
-26975,
-26506,
-26863,
-27415,
-28768,
-30051,
-30538,
-30053,
-28189,
-26489,
-25351,
-25870,
-27522,
-29502,
-31156,
-31648,
-31490,
-30894,
-30317,
-30097,
-30095,
-30449,
-31295,
-32285,
-33599,
-34391,
-34857,
-34750,
-34456,
-34396,
-34590,
-35235,
-35878,
-36583,
-37232,
-37800,
-38560,
-39352,
-40087,
-40748,
-40862,
-40749,
-40307,
-39952,
-40064,
-40526,
-41639,
-42695,
-43743,
-44092,
-44053,
-43471,
-43055,
-42721,
-43339,
-43988,
-45286,
-45847,
-46219,
-46067,
-45643,
-45647,
-45730,
-45891,
-46021,
-45689,
-45489,
-45601,
-46131,
-46842,
-47283,
-46974,
-46177,
-45245,
-44604,
-44869,
-45445,
-46466,
-47016,
-47042,
-46374,
-45136,
-43873,
-43009,
-43030,
-44008,
-45375,
-46314,
-46416,
-45161,
-43714,
-42060,
-41477,
-41086,
-41321,
-41175,
-41079,
-40862,
-40616,
-39974,
-38713,
-37005,
-35546,
-34702,
-34903,
-35189,
-35059,
-33947,
-32358,
-31046,
-30519,
-30536,
-30630,
-30027,
-28880,
-27547,
-26508,
-26043,
-25820,
-25512,
-25289,
-24823,
-24671,
-24114,
-23186,
-21791,
-20259,
-19532,
-19530,
-20660,
-21525,
-21967,
-21257,
-19687,
-18112,
-16828,
-16343,
-16405,
-16631,
-16650,
-16164,
-15345,
-14325,
-13351,
-12908,
-12598,
-12730,
-12643,
-12509,
-11822,
-11181,
-10360,
-9874,
-9474,
-9432,
-9406,
-9565,
-9474,
-9321,
-9030,
-8657,
-8697,
-9167,
-10027,
-11292,
-12088,
-12376,
-11845,
-10869,
-10185,
-10227,
-11269,
-13152,
-14767,
-15966,
-15787,
-14723,
-13463,
-12508,
-12998,
-14302,
-16542,
-18243,
-19401,
-19329,
-18801,
-18024,
-17869,
-17936,
-18667,
-19242,
-20086,
-20990,
-22102,
-23117,
-23475,
-22985,
-21857,
-20968,
-21372,
-23028,
-26066,
-28479,
-30027,
-29767,
-28632,
-27349,
-26709,
-27081,
-28015,
-29432,
-30537,
-31670,
-32466,
-33151,
-33463,
-33818,
-33816,
-33994,
-34261,
-34479,
-34995,
-35164,
-35437,
-35586,
-35901,
-36364,
-36474,
-36454,
-35521,
-34660,
-33749,
-33598,
-34013,
-34617,
-34945,
-34969,
-34771,
-34922,
-35435,
-35700,
-35565,
-34617,
-33483,
-32909,
-33286,
-34723,
-36013,
-37247,
-37187,
-36937,
-36144,
-35855,
-35898,
-36786,
-38136,
-40195,
-41725,
-42588,
-41724,
-40064,
-38113,
-37516,
-38225,
-40107,
-41658,
-42301,
-41545,
-40242,
-39287,
-38978,
-39488,
-40084,
-40330,
-40483,
-40329,
-40906,
-41657,
-42677,
-43452,
-43496,
-43297,
-42965,
-43318,
-44140,
-45401,
-46264,
-46554,
-46352,
-45823,
-45689,
-45867,
-46441,
-47175,
-47569,
-47972,
-47705,
-47416,
-46576,
-45865,
-45335,
-45269,
-45578,
-45622,
-45268,
-44250,
-43031,
-42323,
-42166,
-42699,
-43099,
-42941,
-42235,
-41036,
-40308,
-39797,
-40218,
-40595,
-41258,
-41460,
-41214,
-40462,
-39377,
-38224,
-37515,
-37408,
-37912,
-38735,
-38957,
-38420,
-36967,
-35010,
-33729,
-33131,
-33948,
-34949,
-35897,
-35768,
-34634,
-33089,
-31644,
-31049,
-31248,
-31955,
-32735,
-33082,
-33111,
-32818,
-32246,
-31823,
-31403,
-31557,
-32046,
-32996,
-33996,
-34568,
-34704,
-34150,
-33505,
-33088,
-33040,
-33729,
-34548,
-35301,
-35943,
-35988,
-36075,
-35945,
-35764,
-35835,
-35786,
-36078,
-36894,
-38048,
-39598,
-40816,
-41260,
-41036,
-40330,
-39841,
-40174,
-41171,
-42742,
-44051,
-44824,
-44871,
-44491,
-43787,
-43538,
-43365,
-44027,
-44669,
-45670,
-46085,
-46222,
-45778,
-45378,
-44871,
-44602,
-44406,
-44181,
-44007,
-44139,
-44624,
-45537,
-46128,
-46202,
-45510,
-44361,
-43716,
-43720,
-44868,
-46244,
-47217,
-47481,
-46511,
-45621,
-44450,
-44205,
-44425,
-45092,
-45755,
-46044,
-45888,
-45314,
-44845,
-44473,
-44646,
-44849,
-45002,
-44671,
-44159,
-43475,
-43318,
-43387,
-43939,
-44271,
-44228,
-44070,
-43521,
-43384,
-43165,
-43119,
-43142,
-43208,
-43719,
-44049,
-44538,
-44403,
-43963,
-43140,
-42457,
-42166,
-42390,
-42831,
-43097,
-42877,
-42189,
-40927,
-39886,
-38623,
-38180,
-37916,
-38400,
-38869,
-39131,
-38713,
-37404,
-35790,
-34104,
-33197,
-33085,
-33597,
-34369,
-34661,
-34346,
-33243,
-31933,
-30451,
-29475,
-28790,
-28388,
-28416,
-28342,
-28416,
-27945,
-27262,
-25798,
-24382,
-22831,
-21944,
-21436,
-21480,
-21257,
-20685,
-19461,
-18004,
-16872,
-16474,
-16807,
-17491,
-17627,
-17050,
-15565,
-13928,
-12973,
-12532,
-13352,
-13814,
-14372,
-14058,
-13352,
-12354,
-11246,
-10450,
-9850,
-10009,
-10646,
-11736,
-12441,
-12443,
-11314,
-9762,
-8502,
-8120,
-8925,
-10180,
-11382,
-11866,
-11734,
-11135,
-10562,
-10448,
-10738,
-11445,
-12465,
-13417,
-14305,
-14634,
-14814,
-14301,
-13818,
-13173,
-12708,
-12578,
-12550,
-12778,
-12929,
-13107,
-13152,
-13284,
-13152,
-13019,
-12686,
-12420,
-12134,
-12265,
-12420,
-12687,
-12531,
-11801,
-10648,
-9188,
-8231,
-7863,
-8229,
-8814,
-9185,
-8833,
-7902,
-6773,
-5818,
-5756,
-5951,
-6597,
-6838,
-6685,
-6194,
-5602,
-5241,
-5425,
-6082,
-7263,
-8941,
-10739,
-12640,
-14217,
-15209,
-15857,
-15762,
-15524,
-15098,
-14971,
-15364,
-16144,
-17624,
-18845,
-19972,
-20065,
-19416,
-18272,
-17356,
-17230,
-18466,
-20705,
-23694,
-26398,
-28322,
-29367,
-29473,
-29479,
-29606,
-30319,
-31601,
-33240,
-35082,
-36938,
-38890,
-40727,
-42722,
-44557,
-46247,
-47612,
-48637,
-49100,
-49276,
-49101,
-49146,
-49363,
-50121,
-51070,
-52269,
-53152,
-53731,
-53682,
-53312,
-52663,
-52314,
-52399,
-53308,
-54817,
-56561,
-58051,
-59221,
-60087,
-61171,
-62479,
-63828,
-64473,
-64006,
-62745,
-61214,
-60687,
-61079,
-62372,
-63405,
-63764,
-63232,
-62433,
-61661,
-61058,
-60044,
-58422,
-56080,
-53728,
-51936,
-51159,
-51182,
-51226,
-50785,
-49320,
-47373,
-45223,
-43475,
-42212,
-41346,
-40663,
-40105,
-39822,
-39884,
-40198,
-40526,
-40198,
-39485,
-38204,
-36962,
-35965,
-34770,
-33551,
-31778,
-29964,
-28434,
-27504,
-27307,
-27303,
-26907,
-25909,
-24360,
-22564,
-21149,
-20282,
-19775,
-19907,
-19818,
-19886,
-19883,
-19644,
-19594,
-19002,
-18820,
-18445,
-18979,
-19727,
-20972,
-21657,
-21900,
-21259,
-20925,
-21169,
-22501,
-24246,
-25846,
-26437,
-26202,
-25373,
-24719,
-24133,
-24119,
-23981,
-24314,
-24826,
-25642,
-26687,
-27237,
-27726,
-27838,
-28432,
-29214,
-30357,
-31273,
-31711,
-32002,
-32354,
-33176,
-34435,
-35813,
-36827,
-37296,
-37272,
-36961,
-36632,
-36628,
-36853,
-37759,
-38889,
-40351,
-41171,
-41392,
-40705,
-39798,
-38888,
-38913,
-39242,
-40352,
-41015,
-41813,
-42145,
-42544,
-42876,
-43275,
-43872,
-44605,
-45576,
-46844,
-47591,
-48349,
-48324,
-48346,
-48660,
-49362,
-50588,
-51599,
-52094,
-51667,
-50741,
-49607,
-48946,
-48835,
-49387,
-50076,
-50560,
-50829,
-50406,
-49921,
-49320,
-48880,
-48744,
-48725,
-48922,
-48947,
-49097,
-49037,
-49251,
-49281,
-49651,
-49768,
-50182,
-50343,
-50272,
-50452,
-50097,
-50252,
-49875,
-49653,
-48947,
-48322,
-47708,
-47236,
-46954,
-46352,
-45579,
-44449,
-43341,
-42588,
-42145,
-41834,
-41482,
-40794,
-40196,
-39841,
-39841,
-40109,
-40061,
-39645,
-38819,
-37986,
-37621,
-37388,
-37468,
-37053,
-36563,
-35677,
-35124,
-34614,
-34615,
-34436,
-34106,
-33462,
-32399,
-31514,
-30560,
-29809,
-29098,
-28192,
-27438,
-26550,
-26001,
-25752,
-25668,
-25599,
-25134,
-24359,
-23429,
-22765,
-22897,
-23717,
-25001,
-26064,
-26398,
-26042,
-25201,
-24735,
-24626,
-25355,
-26065,
-26817,
-26885,
-26619,
-26086,
-25489,
-25266,
-25180,
-25555,
-25932,
-26352,
-26530,
-26086,
-25468,
-24601,
-24183,
-24293,
-24912,
-25645,
-25974,
-25955,
-25378,
-25046,
-25200,
-25977,
-26994,
-27726,
-27860,
-27369,
-27064,
-27259,
-28169,
-29278,
-30026,
-29966,
-29452,
-28944,
-28858,
-29161,
-29568,
-29562,
-29300,
-29010,
-29166,
-29719,
-30493,
-30873,
-30804,
-30296,
-29785,
-29675,
-29962,
-30629,
-31181,
-31557,
-31492,
-31269,
-30982,
-31072,
-31445,
-32068,
-32709,
-32931,
-32799,
-32443,
-31956,
-32134,
-32377,
-32931,
-33109,
-32952,
-32554,
-32312,
-32110,
-32402,
-32286,
-32312,
-32022,
-31736,
-31933,
-32247,
-32927,
-33467,
-33813,
-33952,
-33728,
-33595,
-33087,
-33107,
-32909,
-33242,
-33349,
-33201,
-32750,
-31694,
-31001,
-30562,
-30717,
-31158,
-31204,
-31047,
-30185,
-29654,
-28965,
-28945,
-28544,
-28347,
-27747,
-27351,
-26905,
-26487,
-26041,
-25489,
-25179,
-25090,
-25423,
-25665,
-25644,
-25024,
-24115,
-23341,
-22919,
-22897,
-22765,
-22697,
-22388,
-22255,
-22278,
-22343,
-22121,
-21770,
-21210,
-21108,
-21741,
-23144,
-24801,
-26109,
-26620,
-25972,
-25072,
-23847,
-23409,
-23560,
-24316,
-25266,
-25977,
-26353,
-26152,
-25667,
-24935,
-24159,
-23872,
-23784,
-24623,
-25603,
-26947,
-27750,
-28457,
-28521,
-28882,
-29116,
-29481,
-29382,
-29214,
-28476,
-28370,
-28611,
-29875,
-31646,
-33484,
-34881,
-35255,
-34950,
-34013,
-32933,
-31999,
-31359,
-31116,
-31379,
-32289,
-33440,
-34859,
-35677,
-35589,
-34481,
-32887,
-31292,
-30716,
-31092,
-32555,
-34149,
-35744,
-36386,
-36630,
-35988,
-35477,
-34838,
-34701,
-34703,
-34948,
-34900,
-34617,
-33881,
-33331,
-32665,
-32576,
-32378,
-32376,
-32091,
-31800,
-31403,
-30716,
-29852,
-28303,
-26816,
-25446,
-25066,
-25446,
-26373,
-27109,
-27013,
-25980,
-24466,
-22833,
-21945,
-21478,
-21659,
-21854,
-21969,
-22076,
-22014,
-22229,
-22192,
-22075,
-21437,
-20305,
-18867,
-17381,
-16431,
-16051,
-16454,
-17136,
-17872,
-18045,
-17626,
-16585,
-15433,
-14435,
-14151,
-14478,
-15435,
-16383,
-17119,
-17201,
-16901,
-16356,
-16170,
-16492,
-17274,
-18266,
-18912,
-19042,
-18579,
-17826,
-17512,
-17497,
-18353,
-19377,
-20418,
-21100,
-21217,
-21102,
-20614,
-20221,
-20036,
-20176,
-20570,
-21169,
-21770,
-22252,
-22723,
-22984,
-23385,
-23651,
-23760,
-23673,
-23518,
-23561,
-23917,
-24712,
-25336,
-25729,
-25603,
-25310,
-25222,
-25447,
-25906,
-25980,
-25906,
-25248,
-25154,
-25269,
-26397,
-27503,
-28857,
-29585,
-30186,
-30405,
-31004,
-31779,
-33131,
-34592,
-36475,
-38091,
-39644,
-40747,
-41395,
-42054,
-42457,
-43429,
-44427,
-45733,
-46796,
-47463,
-47546,
-47576,
-47258,
-47685,
-48168,
-49169,
-50005,
-50631,
-50782,
-50673,
-50252,
-49986,
-49741,
-49811,
-50205,
-51030,
-52198,
-53466,
-54568,
-55128,
-55166,
-54861,
-54593,
-54813,
-55703,
-56983,
-58382,
-59377,
-59687,
-59644,
-59266,
-59201,
-59465,
-59954,
-60595,
-61061,
-61261,
-61325,
-61217,
-61259,
-61084,
-61303,
-61263,
-61610,
-61884,
-62188,
-62391,
-62301,
-62057,
-61614,
-61328,
-61213,
-61264,
-61412,
-61394,
-60995,
-60416,
-59580,
-58976,
-58781,
-58645,
-58559,
-57937,
-56742,
-55169,
-53707,
-52665,
-52314,
-52110,
-51960,
-51069,
-50098,
-48612,
-47750,
-46818,
-46619,
-46244,
-46153,
-45822,
-45468,
-45157,
-44383,
-43738,
-42636,
-41808,
-41021,
-40567,
-40333,
-40017,
-39466,
-38556,
-37384,
-35986,
-34860,
-33860,
-33219,
-32821,
-32132,
-31515,
-30272,
-29056,
-27547,
-26354,
-25377,
-24869,
-24714,
-24646,
-24671,
-24401,
-23985,
-23559,
-23343,
-23384,
-23693,
-24140,
-24533,
-24761,
-24867,
-24913,
-24914,
-25066,
-25025,
-25178,
-25201,
-25157,
-25222,
-25136,
-25132,
-25181,
-25088,
-25225,
-25310,
-25423,
-25400,
-25223,
-24891,
-24580,
-24648,
-24846,
-25555,
-25998,
-26375,
-26374,
-26288,
-26594,
-27063,
-28101,
-28923,
-29652,
-29920,
-30073,
-30184,
-30605,
-31205,
-31867,
-32532,
-32644,
-33017,
-32957,
-33349,
-33641,
-33927,
-34171,
-34151,
-34413,
-34594,
-35210,
-35857,
-36362,
-36853,
-36918,
-37183,
-37117,
-37516,
-37493,
-37916,
-38158,
-38712,
-39508,
-40087,
-40615,
-40419,
-39996,
-39377,
-38933,
-39066,
-39399,
-39952,
-40175,
-39862,
-39157,
-38112,
-37096,
-36321,
-35984,
-35904,
-36116,
-36101,
-35876,
-35257,
-34304,
-33440,
-32577,
-32222,
-32090,
-32199,
-32245,
-32221,
-31936,
-31534,
-31116,
-30714,
-30254,
-29737,
-29038,
-28297,
-27707,
-27281,
-27062,
-26950,
-26664,
-26196,
-25402,
-24467,
-23653,
-23006,
-22877,
-22764,
-22874,
-22788,
-22519,
-22147,
-21521,
-21062,
-20634,
-20466,
-20567,
-20708,
-20989,
-21039,
-20859,
-20439,
-20239,
-20194,
-20639,
-21215,
-21633,
-21923,
-21613,
-21523,
-21349,
-21721,
-22367,
-22963,
-23474,
-23451,
-23339,
-23076,
-23273,
-23673,
-24470,
-25023,
-25577,
-25690,
-25841,
-25889,
-26219,
-26419,
-26995,
-27151,
-27458,
-27485,
-27568,
-27639,
-27726,
-27813,
-28149,
-28454,
-28991,
-29540,
-29942,
-30339,
-30273,
-30096,
-29697,
-29454,
-29408,
-29854,
-30558,
-31318,
-31864,
-31849,
-31400,
-30673,
-30163,
-29894,
-30409,
-30934,
-31694,
-31866,
-31779,
-31204,
-30582,
-29986,
-29720,
-29607,
-29543,
-29586,
-29299,
-29032,
-28524,
-27881,
-27193,
-26509,
-26064,
-25888,
-26020,
-26109,
-26020,
-25755,
-25091,
-24578,
-23875,
-23405,
-22852,
-22280,
-21787,
-21259,
-21083,
-20966,
-20865,
-20633,
-20066,
-19439,
-18647,
-18000,
-17429,
-17002,
-16832,
-16737,
-16875,
-17003,
-17074,
-16981,
-16588,
-16095,
-15478,
-15389,
-15454,
-15944,
-16384,
-16519,
-16540,
-16142,
-15920,
-15854,
-16054,
-16428,
-16675,
-16760,
-16631,
-16451,
-16074,
-15879,
-15451,
-15548,
-15540,
-15856,
-16118,
-15988,
-15809,
-15167,
-14790,
-14725,
-15123,
-15831,
-16430,
-16650,
-16386,
-15855,
-15476,
-15499,
-16121,
-16649,
-17319,
-17091,
-16874,
-16253,
-15985,
-15767,
-15853,
-15986,
-16343,
-16936,
-17363,
-17889,
-17938,
-17690,
-17651,
-17976,
-19358,
-21631,
-24428,
-27238,
-29475,
-30961,
-31910,
-32425,
-32949,
-33666,
-34477,
-35836,
-37292,
-38848,
-40392,
-41217,
-41568,
-40994,
-39952,
-38757,
-38135,
-38204,
-39220,
-40884,
-42586,
-44163,
-45090,
-45645,
-45711,
-45667,
-45511,
-45669,
-45731,
-46445,
-47259,
-48769,
-50628,
-52666,
-54484,
-55986,
-56500,
-56740,
-56189,
-56010,
-56056,
-56762,
-57873,
-59243,
-60419,
-61372,
-61789,
-62016,
-62100,
-61991,
-61948,
-61746,
-61394,
-61149,
-61171,
-61637,
-62567,
-63940,
-65247,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-64337,
-63720,
-63098,
-63142,
-63787,
-64426,
-65534,
-65534,
-65534,
-64336,
-62836,
-60946,
-59293,
-58222,
-57587,
-57712,
-57853,
-58200,
-58029,
-57449,
-56565,
-55146,
-53907,
-52645,
-51622,
-51009,
-50337,
-50053,
-49701,
-49671,
-49792,
-49916,
-49986,
-49501,
-48344,
-46624,
-44421,
-42393,
-40658,
-39578,
-38844,
-38270,
-37536,
-36477,
-35211,
-33729,
-32112,
-30582,
-28745,
-27306,
-25864,
-25114,
-24469,
-24337,
-23916,
-23628,
-22942,
-22543,
-22188,
-22167,
-22387,
-22388,
-22300,
-21833,
-21259,
-21015,
-21124,
-21925,
-22740,
-23608,
-23693,
-23342,
-22475,
-21548,
-20924,
-20440,
-20305,
-20019,
-19640,
-19221,
-18933,
-18887,
-19133,
-19397,
-19398,
-19420,
-18999,
-19108,
-19245,
-19883,
-20861,
-21789,
-22809,
-23606,
-24315,
-25001,
-25688,
-26376,
-27015,
-27662,
-28366,
-29167,
-30050,
-31005,
-31624,
-32156,
-32288,
-32467,
-32862,
-33399,
-34369,
-35169,
-35921,
-36075,
-36012,
-35697,
-35524,
-35810,
-36497,
-37583,
-38866,
-39975,
-40926,
-41571,
-41900,
-42146,
-42256,
-42521,
-42943,
-43674,
-44603,
-45689,
-46575,
-46864,
-46640,
-45691,
-44557,
-43631,
-43207,
-43254,
-43783,
-44095,
-44050,
-43495,
-42501,
-41214,
-40262,
-39555,
-39463,
-39711,
-39972,
-40110,
-39573,
-38737,
-37623,
-36811,
-36473,
-36652,
-37118,
-37470,
-37517,
-37007,
-36120,
-35212,
-34304,
-33774,
-33350,
-33043,
-32775,
-32356,
-31756,
-30895,
-29738,
-28350,
-26926,
-25534,
-24713,
-24403,
-24582,
-24912,
-25024,
-24603,
-23805,
-22564,
-21704,
-20923,
-21150,
-21257,
-21989,
-22168,
-22408,
-22168,
-21988,
-21701,
-21526,
-21410,
-21329,
-21276,
-21372,
-21323,
-21502,
-21592,
-21588,
-21592,
-21413,
-21390,
-21261,
-21410,
-21326,
-21502,
-21412,
-21571,
-21721,
-22101,
-22586,
-23010,
-23471,
-23764,
-24201,
-24428,
-24933,
-25225,
-25643,
-26020,
-26375,
-26817,
-27195,
-27593,
-27902,
-28281,
-28610,
-29079,
-29607,
-30051,
-30342,
-30491,
-30543,
-30602,
-30806,
-31314,
-31912,
-32510,
-32910,
-33018,
-33021,
-33041,
-33197,
-33574,
-34081,
-34373,
-34789,
-34750,
-34900,
-35037,
-35144,
-35414,
-35409,
-35459,
-35166,
-35102,
-34726,
-34745,
-34374,
-34278,
-33843,
-33571,
-33108,
-32866,
-32574,
-32269,
-32066,
-31691,
-31557,
-31204,
-31158,
-30850,
-30848,
-30717,
-30627,
-30604,
-30342,
-30359,
-29965,
-30007,
-29806,
-29966,
-29761,
-29565,
-28923,
-28255,
-27419,
-26926,
-26531,
-26396,
-25999,
-25489,
-24557,
-23675,
-23005,
-22834,
-22740,
-22743,
-22188,
-21370,
-20372,
-19730,
-19685,
-20261,
-20906,
-21168,
-20794,
-19862,
-18911,
-18312,
-18512,
-19110,
-20062,
-20704,
-20905,
-20748,
-20283,
-20019,
-19907,
-20062,
-20394,
-20838,
-21256,
-21572,
-21654,
-21592,
-21191,
-21104,
-20991,
-21592,
-22187,
-22987,
-23385,
-23383,
-23210,
-22805,
-22857,
-22959,
-23544,
-24069,
-24604,
-24867,
-25202,
-25355,
-25844,
-26375,
-27104,
-27772,
-28368,
-28810,
-29566,
-30559,
-32091,
-33883,
-35877,
-37493,
-38779,
-39376,
-39532,
-39686,
-39865,
-40548,
-41394,
-42344,
-43163,
-43609,
-43760,
-43631,
-43450,
-43055,
-42697,
-42369,
-42143,
-42412,
-42875,
-43675,
-44514,
-45069,
-45379,
-45467,
-45403,
-45465,
-45669,
-45864,
-46068,
-46042,
-46021,
-45934,
-46307,
-46755,
-47658,
-48260,
-48744,
-48482,
-47990,
-47086,
-46554,
-46351,
-46755,
-47458,
-48260,
-48944,
-49124,
-49209,
-48702,
-48303,
-47549,
-46907,
-46288,
-45843,
-45645,
-45668,
-45798,
-46045,
-46064,
-46044,
-45623,
-44957,
-44163,
-42917,
-41838,
-40593,
-39732,
-39265,
-39487,
-39954,
-40548,
-40863,
-40393,
-39599,
-38159,
-37049,
-36144,
-36142,
-36629,
-37607,
-38488,
-39068,
-38998,
-38426,
-37626,
-36696,
-36254,
-35898,
-35922,
-35877,
-35678,
-35365,
-34927,
-34546,
-34217,
-33928,
-33549,
-33067,
-32373,
-31673,
-30934,
-30253,
-29586,
-29054,
-28458,
-28146,
-27792,
-27639,
-27391,
-26976,
-26327,
-25581,
-24887,
-24562,
-24400,
-24849,
-25044,
-25557,
-25820,
-25953,
-26332,
-26417,
-26532,
-26330,
-25974,
-25559,
-25351,
-25272,
-25619,
-26021,
-26552,
-26817,
-26842,
-26616,
-26044,
-25422,
-24846,
-24471,
-24535,
-24869,
-25356,
-25755,
-25842,
-25512,
-24957,
-24425,
-24205,
-24381,
-24824,
-25312,
-25777,
-25776,
-26132,
-26087,
-26484,
-26842,
-27236,
-27684,
-28145,
-28569,
-29032,
-29431,
-29586,
-29653,
-29653,
-29587,
-29895,
-30276,
-30822,
-31407,
-31820,
-31937,
-31999,
-31980,
-31999,
-32313,
-32419,
-32911,
-33018,
-33485,
-33708,
-34102,
-34308,
-34477,
-34529,
-34391,
-34439,
-34546,
-34794,
-35342,
-35791,
-36230,
-36497,
-36542,
-36408,
-36209,
-35988,
-35699,
-35656,
-35522,
-35611,
-35568,
-35498,
-35214,
-34769,
-34260,
-33840,
-33682,
-33753,
-34212,
-34663,
-34965,
-35127,
-34767,
-34615,
-34237,
-34305,
-34504,
-35079,
-35500,
-35943,
-35900,
-35676,
-35148,
-34634,
-34306,
-34281,
-34571,
-34990,
-35457,
-35477,
-35523,
-35013,
-34792,
-34304,
-34304,
-34127,
-34194,
-34192,
-34086,
-34124,
-34017,
-33884,
-33661,
-33464,
-33262,
-33286,
-33285,
-33551,
-33751,
-33883,
-34061,
-34083,
-34391,
-34617,
-35188,
-35502,
-35743,
-35743,
-35569,
-35409,
-35414,
-35587,
-35834,
-36385,
-36564,
-36985,
-36916,
-37120,
-36892,
-37032,
-36850,
-37117,
-37096,
-37471,
-37493,
-37717,
-37668,
-37763,
-37602,
-37606,
-37536,
-37430,
-37601,
-37542,
-37557,
-37340,
-37007,
-36672,
-36412,
-36561,
-36896,
-37583,
-37869,
-37893,
-37274,
-36317,
-35547,
-35122,
-35301,
-35812,
-36319,
-36298,
-35854,
-35035,
-34372,
-33816,
-33885,
-33637,
-33708,
-33218,
-32777,
-32310,
-32067,
-31868,
-31801,
-31537,
-31201,
-30674,
-30249,
-29787,
-29564,
-29032,
-28835,
-28255,
-28016,
-27768,
-27639,
-27504,
-27305,
-26972,
-26751,
-26554,
-26528,
-26531,
-26329,
-26065,
-25623,
-25244,
-25156,
-25313,
-25643,
-25777,
-25621,
-25179,
-24493,
-23916,
-23760,
-23807,
-24356,
-24784,
-24888,
-24937,
-24403,
-24180,
-23874,
-24069,
-24318,
-24822,
-25091,
-25199,
-25182,
-24909,
-24939,
-24932,
-25224,
-25511,
-25777,
-26019,
-26001,
-26239,
-26399,
-26683,
-27085,
-27349,
-27571,
-27726,
-27814,
-27948,
-28256,
-28503,
-28987,
-29211,
-29541,
-29610,
-29761,
-29789,
-29850,
-30029,
-30320,
-30691,
-31073,
-31223,
-31360,
-31225,
-31181,
-31182,
-31246,
-31404,
-31536,
-31533,
-31760,
-31755,
-32134,
-32313,
-32483,
-32560,
-32351,
-32357,
-32422,
-32818,
-33398,
-33927,
-34370,
-34416,
-34458,
-34460,
-34526,
-34813,
-34859,
-34967,
-34926,
-34856,
-35126,
-35344,
-35700,
-35832,
-35611,
-35389,
-34926,
-35012,
-35057,
-35701,
-36051,
-36457,
-36493,
-36235,
-36051,
-35879,
-36009,
-36496,
-36986,
-37669,
-38028,
-38200,
-38050,
-37712,
-37409,
-37313,
-37585,
-38091,
-38644,
-38914,
-38975,
-38715,
-38355,
-38160,
-38134,
-38205,
-38289,
-38227,
-38001,
-37871,
-37672,
-37824,
-37784,
-37957,
-37739,
-37647,
-37275,
-37069,
-36988,
-36850,
-37139,
-37030,
-37359,
-37207,
-37382,
-37030,
-36984,
-36585,
-36409,
-36363,
-36299,
-36519,
-36541,
-36475,
-36364,
-36165,
-36077,
-36163,
-36167,
-36427,
-36280,
-36472,
-36255,
-36318,
-36343,
-36408,
-36542,
-36542,
-36495,
-36366,
-36208,
-36010,
-35833,
-35677,
-35568,
-35521,
-35457,
-35433,
-35412,
-35435,
-35343,
-35437,
-35408,
-35548,
-35520,
-35546,
-35522,
-35523,
-35676,
-35613,
-35853,
-35590,
-35721,
-35545,
-35699,
-35768,
-35808,
-35724,
-35387,
-35082,
-34768,
-34660,
-34901,
-35014,
-35188,
-35149,
-34789,
-34573,
-34234,
-33997,
-33881,
-33798,
-33526,
-33664,
-33461,
-33618,
-33552,
-33417,
-32976,
-32466,
-31911,
-31714,
-31689,
-31869,
-31846,
-31667,
-31182,
-30671,
-30273,
-30208,
-30116,
-30253,
-30005,
-29633,
-29185,
-28615,
-28343,
-28128,
-27855,
-27641,
-27146,
-26821,
-26395,
-26176,
-25999,
-25841,
-25602,
-25221,
-24958,
-24758,
-24736,
-24801,
-24738,
-24577,
-24274,
-23781,
-23497,
-23228,
-23164,
-22986,
-22808,
-22344,
-21878,
-21480,
-21192,
-21236,
-21213,
-21260,
-21123,
-20862,
-20570,
-20395,
-20328,
-20417,
-20326,
-20220,
-19928,
-19729,
-19622,
-19748,
-20044,
-20369,
-20774,
-21123,
-21480,
-22234,
-22962,
-23985,
-25022,
-25864,
-26843,
-27457,
-28216,
-28787,
-29300,
-29628,
-29657,
-29648,
-29481,
-29494,
-29455,
-29608,
-29520,
-29543,
-29452,
-29478,
-29783,
-30209,
-30780,
-31449,
-31978,
-32510,
-32866,
-33083,
-33354,
-33506,
-33795,
-34061,
-34525,
-34814,
-35190,
-35390,
-35522,
-35744,
-36054,
-36608,
-37427,
-38358,
-39287,
-40219,
-40926,
-41615,
-42099,
-42590,
-42941,
-43320,
-43562,
-43719,
-43871,
-43852,
-43762,
-43517,
-43278,
-43049,
-43057,
-42961,
-43013,
-42850,
-42526,
-42186,
-41771,
-41545,
-41504,
-41392,
-41259,
-40795,
-40327,
-39710,
-39309,
-39134,
-39132,
-39310,
-39355,
-39419,
-39203,
-39261,
-39181,
-39573,
-39866,
-40306,
-40639,
-40549,
-40464,
-39817,
-39380,
-38796,
-38472,
-38444,
-38225,
-38249,
-37623,
-37098,
-36163,
-35502,
-34878,
-34572,
-34303,
-33950,
-33464,
-32840,
-32224,
-31645,
-31137,
-30585,
-29961,
-29255,
-28567,
-28013,
-27750,
-27503,
-27550,
-27436,
-27462,
-27392,
-27462,
-27590,
-27840,
-27988,
-28039,
-28167,
-28059,
-28478,
-28391,
-28721,
-28326,
-28256,
-27572,
-27525,
-27284,
-27526,
-27660,
-27726,
-27592,
-27084,
-26685,
-26220,
-26041,
-26089,
-26129,
-26200,
-26173,
-25933,
-25665,
-25335,
-24868,
-24669,
-24426,
-24690,
-25159,
-25641,
-26200,
-26307,
-26396,
-26267,
-26481,
-26867,
-27588,
-28351,
-28762,
-29147,
-28920,
-28966,
-28901,
-29276,
-29697,
-29962,
-30209,
-30025,
-30080,
-30090,
-30477,
-30867,
-31273,
-31378,
-31450,
-31134,
-31138,
-31159,
-31491,
-31890,
-32245,
-32287,
-32225,
-31797,
-31540,
-31266,
-31494,
-31712,
-32376,
-32667,
-32996,
-32954,
-32665,
-32598,
-32334,
-32642,
-32866,
-33306,
-33530,
-33506,
-33397,
-33019,
-32842,
-32710,
-32731,
-32865,
-33064,
-33218,
-33419,
-33463,
-33439,
-33398,
-33438,
-33509,
-33816,
-33973,
-34303,
-34238,
-34260,
-34039,
-33904,
-33907,
-34037,
-33996,
-34237,
-33904,
-33930,
-33704,
-33797,
-33971,
-34237,
-34417,
-34479,
-34395,
-34436,
-34415,
-34527,
-34767,
-34750,
-34944,
-35016,
-35209,
-35547,
-35565,
-35723,
-35500,
-35278,
-35258,
-35211,
-35701,
-36030,
-36455,
-36450,
-36167,
-35765,
-35368,
-35191,
-35410,
-35811,
-36297,
-36521,
-36584,
-36344,
-36095,
-35880,
-35875,
-36033,
-36431,
-36783,
-37053,
-37226,
-37096,
-36875,
-36672,
-36411,
-36449,
-36566,
-36784,
-37097,
-37225,
-37231,
-37113,
-36701,
-36538,
-36188,
-36255,
-36227,
-36414,
-36403,
-36236,
-35962,
-35457,
-35146,
-34769,
-34704,
-34547,
-34504,
-34347,
-34329,
-34146,
-34175,
-34145,
-34198,
-34145,
-34041,
-33816,
-33706,
-33707,
-33728,
-33949,
-33840,
-33928,
-33616,
-33310,
-33017,
-32844,
-32798,
-32952,
-33087,
-33152,
-33175,
-32975,
-32665,
-32443,
-32246,
-32154,
-32136,
-32264,
-32113,
-32265,
-31958,
-32022,
-31913,
-32044,
-32245,
-32620,
-32865,
-33374,
-33618,
-34281,
-34615,
-35323,
-35611,
-36144,
-36207,
-36542,
-36498,
-36850,
-36920,
-37381,
-37539,
-37670,
-37761,
-37603,
-37517,
-37515,
-37539,
-37891,
-38270,
-38600,
-38980,
-38909,
-38847,
-38687,
-38603,
-38757,
-38998,
-39223,
-39441,
-39512,
-39374,
-39334,
-39353,
-39487,
-39976,
-40327,
-40885,
-41191,
-41480,
-41704,
-41944,
-42214,
-42608,
-43009,
-43276,
-43473,
-43365,
-43250,
-43034,
-42939,
-42946,
-43029,
-43054,
-43009,
-42720,
-42412,
-42012,
-41702,
-41591,
-41393,
-41413,
-41039,
-40794,
-40194,
-39689,
-39286,
-38934,
-38758,
-38532,
-38249,
-38023,
-37629,
-37581,
-37318,
-37447,
-37386,
-37469,
-37318,
-37228,
-36895,
-36697,
-36430,
-36187,
-36010,
-35589,
-35323,
-34679,
-34263,
-33659,
-33244,
-32795,
-32491,
-32042,
-31759,
-31270,
-31068,
-30654,
-30468,
-30054,
-29629,
-29035,
-28566,
-28147,
-28081,
-27879,
-27994,
-27458,
-27108,
-26328,
-25956,
-25731,
-25931,
-26244,
-26572,
-26576,
-26462,
-26198,
-26042,
-26110,
-26108,
-26331,
-26219,
-26177,
-26086,
-25976,
-26021,
-25953,
-25800,
-25488,
-25135,
-24846,
-24846,
-24937,
-25220,
-25182,
-25065,
-24560,
-24159,
-23762,
-23716,
-23740,
-23871,
-23872,
-23872,
-23672,
-23674,
-23361,
-23342,
-23250,
-23408,
-23783,
-24225,
-24760,
-25154,
-25292,
-25221,
-25025,
-25088,
-25292,
-25841,
-26309,
-26687,
-26680,
-26491,
-26216,
-26066,
-26198,
-26462,
-26864,
-27126,
-27240,
-27281,
-27108,
-27059,
-26887,
-27059,
-26952,
-27238,
-27260,
-27417,
-27327,
-27150,
-26884,
-26706,
-26532,
-26726,
-26954,
-27191,
-27441,
-27347,
-27285,
-27125,
-27109,
-27192,
-27284,
-27415,
-27395,
-27171,
-27084,
-26839,
-26775,
-26683,
-26510,
-26482,
-26312,
-26349,
-26313,
-26347,
-26424,
-26260,
-26222,
-26109,
-25975,
-26132,
-25998,
-26019,
-25823,
-25554,
-25290,
-25179,
-24955,
-24982,
-24800,
-24628,
-24533,
-24317,
-24358,
-24249,
-24293,
-24092,
-23940,
-23694,
-23473,
-23385,
-23184,
-23099,
-22805,
-22481,
-22073,
-21860,
-21588,
-21681,
-21500,
-21548,
-21256,
-21260,
-20926,
-21146,
-20950,
-21102,
-21082,
-21058,
-21059,
-21059,
-20992,
-20994,
-21012,
-20951,
-21189,
-21415,
-21723,
-22277,
-22565,
-23052,
-23230,
-23562,
-23982,
-24316,
-25088,
-25335,
-25909,
-26043,
-25953,
-26111,
-25907,
-26088,
-26286,
-26396,
-26709,
-26683,
-26797,
-26683,
-26730,
-26775,
-26969,
-27443,
-27654,
-28196,
-28364,
-28637,
-28721,
-28878,
-28834,
-29187,
-29387,
-29897,
-30405,
-30894,
-31558,
-31934,
-32487,
-32998,
-33640,
-34503,
-35524,
-36428,
-37540,
-38224,
-39044,
-39510,
-40217,
-40707,
-41324,
-41836,
-42211,
-42433,
-42700,
-42764,
-43054,
-43274,
-43364,
-43629,
-43606,
-43831,
-43958,
-44297,
-44446,
-44870,
-44848,
-45135,
-45202,
-45445,
-45667,
-45977,
-46154,
-46421,
-46617,
-46954,
-47504,
-47949,
-48635,
-49011,
-49454,
-49788,
-50161,
-50698,
-51157,
-51739,
-52086,
-52470,
-52598,
-52734,
-52642,
-52558,
-52375,
-52049,
-51999,
-51715,
-51802,
-51736,
-51559,
-51336,
-50806,
-50274,
-49853,
-49521,
-49455,
-49497,
-49324,
-49341,
-48769,
-48459,
-47812,
-47532,
-47234,
-47201,
-47256,
-47288,
-47303,
-47109,
-46995,
-46707,
-46576,
-46508,
-46444,
-46529,
-46486,
-46444,
-46307,
-46046,
-45819,
-45404,
-45110,
-44585,
-44312,
-43898,
-43693,
-43344,
-43051,
-42567,
-42189,
-41591,
-41149,
-40684,
-40305,
-39954,
-39574,
-39135,
-38577,
-38227,
-37780,
-37472,
-37162,
-36807,
-36363,
-36056,
-35521,
-35457,
-35189,
-35302,
-35211,
-35125,
-35035,
-34724,
-34550,
-34325,
-34193,
-34284,
-34279,
-34485,
-34434,
-34439,
-34193,
-33861,
-33663,
-33461,
-33552,
-33617,
-33773,
-33752,
-33682,
-33375,
-33152,
-32953,
-32755,
-32797,
-32732,
-32621,
-32621,
-32443,
-32467,
-32354,
-32357,
-32220,
-32245,
-32156,
-32245,
-32421,
-32599,
-32819,
-32977,
-32930,
-32932,
-32707,
-32802,
-32727,
-33024,
-33150,
-33307,
-33243,
-33106,
-32822,
-32731,
-32555,
-32642,
-32799,
-32863,
-33000,
-32818,
-32579,
-32374,
-32092,
-32132,
-32201,
-32511,
-32552,
-32600,
-32312,
-32110,
-31846,
-31979,
-32154,
-32557,
-32907,
-33042,
-33175,
-33019,
-32954,
-33040,
-33177,
-33549,
-33796,
-34060,
-34237,
-34196,
-34212,
-33998,
-33814,
-33730,
-33684,
-33948,
-34129,
-34392,
-34416,
-34303,
-33928,
-33662,
-33595,
-33597,
-34058,
-34285,
-34522,
-34508,
-34211,
-33976,
-33770,
-33751,
-34062,
-34102,
-34529,
-34456,
-34639,
-34569,
-34548,
-34481,
-34459,
-34394,
-34458,
-34527,
-34635,
-34771,
-34701,
-34573,
-34256,
-33887,
-33659,
-33510,
-33505,
-33551,
-33353,
-33306,
-32866,
-32731,
-32310,
-32201,
-31867,
-31715,
-31443,
-31140,
-30891,
-30562,
-30340,
-29962,
-29586,
-29079,
-28632,
-28192,
-27858,
-27704,
-27527,
-27438,
-27193,
-26885,
-26597,
-26130,
-25888,
-25599,
-25334,
-25201,
-24914,
-24711,
-24251,
-23847,
-23299,
-22762,
-22256,
-21812,
-21457,
-21192,
-20815,
-20549,
-20041,
-19664,
-19108,
-18712,
-18378,
-18070,
-17758,
-17493,
-17227,
-17005,
-16829,
-16652,
-16406,
-16098,
-15721,
-15477,
-15212,
-15410,
-15412,
-15785,
-15680,
-15562,
-15104,
-14766,
-14460,
-14546,
-14724,
-14990,
-15080,
-14767,
-14526,
-14013,
-13863,
-13836,
-14063,
-14344,
-14439,
-14456,
-14172,
-14059,
-13683,
-13795,
-13593,
-13795,
-13771,
-13683,
-13551,
-13240,
-12863,
-12687,
-12399,
-12463,
-12556,
-12617,
-12622,
-12488,
-12109,
-11956,
-11645,
-11734,
-11779,
-11977,
-12156,
-12175,
-12223,
-12242,
-12310,
+3182,
+9393,
+16452,
+24242,
+29920,
+32997,
+35018,
+36503,
+35475,
+32344,
+29057,
+24227,
+18648,
+13702,
+9746,
+6794,
+1910,
+65535,
+226,
+65535,
+112,
+65535,
+7,
+84,
+65535,
+6722,
+12867,
+8483,
+1485,
+65535,
+241,
+65535,
+13819,
+46736,
+65534,
+65348,
+65534,
+65534,
+65463,
+65534,
+65453,
+65534,
+65463,
+65534,
+65460,
+65534,
+65474,
+65534,
+65534,
+65307,
+65534,
+53596,
+30660,
+10157,
+65535,
+147,
+65535,
+65535,
+25,
+20,
+297,
+43,
+65535,
+153,
+65535,
+240,
+65535,
+1296,
+17048,
+39705,
+59493,
+65534,
+65134,
+65534,
+65416,
+65534,
+65509,
+65534,
+65518,
+65534,
+65521,
+65524,
+65534,
+65376,
+65534,
+57231,
+41344,
+28995,
+19945,
+16020,
+13997,
+10553,
+5844,
+866,
+65535,
+104,
+65535,
+40,
+65535,
+14,
+65535,
+35,
+65535,
+2222,
+6464,
+11515,
+18474,
+25892,
+33826,
+41742,
+47297,
+50521,
+50986,
+48069,
+42559,
+35382,
+27349,
+19444,
+12957,
+8183,
+3118,
+65535,
+45,
+65535,
+7,
+65535,
+34,
+65535,
+86,
+65535,
+551,
+5539,
+6843,
+1913,
+65535,
+65535,
+1154,
+18302,
+49842,
+65534,
+65277,
+65534,
+65534,
+65485,
+65534,
+65464,
+65534,
+65480,
+65534,
+65513,
+65523,
+65534,
+65410,
+65534,
+65161,
+65534,
+60121,
+42343,
+23989,
+6335,
+65535,
+313,
+65535,
+135,
+65535,
+114,
+65535,
+1101,
+5122,
+6051,
+4433,
+5437,
+10683,
+20573,
+33435,
+50452,
+64314,
+65534,
+65343,
+65534,
+65394,
+65534,
+65434,
+65534,
+65462,
+65534,
+65510,
+65515,
+65403,
+56896,
+44669,
+35019,
+26445,
+19839,
+14486,
+10311,
+3608,
+65535,
+143,
+65535,
+65535,
+59,
+65535,
+105,
+65535,
+626,
+8053,
+16368,
+20440,
+22801,
+24841,
+28176,
+33882,
+42754,
+52767,
+61779,
+65534,
+65534,
+62437,
+53798,
+42413,
+29035,
+15806,
+3698,
+65535,
+237,
+65535,
+64,
+65535,
+5,
+65535,
+21,
+65535,
+110,
+65535,
+285,
+65535,
+2829,
+13920,
+19853,
+20235,
+20650,
+24849,
+38559,
+58768,
+65534,
+65084,
+65534,
+65407,
+65534,
+65520,
+65529,
+65534,
+65534,
+65522,
+65534,
+65532,
+65502,
+65534,
+65333,
+65534,
+58962,
+45602,
+33784,
+22195,
+11801,
+2443,
+65535,
+182,
+65535,
+65535,
+214,
+65535,
+3127,
+15433,
+26655,
+34692,
+41546,
+46579,
+49774,
+52444,
+55738,
+61870,
+65534,
+65440,
+65534,
+65531,
+65534,
+65499,
+65534,
+65323,
+65534,
+60693,
+46744,
+33379,
+22319,
+14632,
+11538,
+11566,
+12598,
 12732,
-13261,
-14149,
-15167,
-16273,
-17253,
-18153,
-18959,
-19704,
-20375,
-21301,
-21879,
-22853,
-23096,
-23542,
-23470,
-23586,
-23472,
-23541,
-23428,
-23496,
-23427,
-23631,
-23936,
-24405,
-25067,
-25555,
-26021,
-26286,
-26529,
-26907,
-27416,
-28190,
-28856,
-29587,
-30050,
-30452,
-30759,
-31160,
-31711,
-32623,
-33594,
-34969,
-36299,
-37712,
-39093,
-40036,
-41176,
-41896,
-42970,
-44002,
-45248,
-46441,
-47329,
-48059,
-48214,
-48369,
-48302,
-48459,
-48789,
-49234,
-49719,
-50208,
-50473,
-50740,
-50871,
-51028,
-51203,
-51471,
-51957,
-52267,
-52933,
-53307,
-53753,
-53861,
-54127,
-54286,
-54679,
-55238,
-55897,
-56589,
-57161,
-57673,
-58026,
-58490,
-58803,
-59311,
-59664,
-59889,
-60039,
-59933,
-59931,
-59731,
-59688,
-59377,
-59245,
-58668,
-58359,
-57715,
-57341,
-56963,
-56497,
-56300,
-55787,
-55460,
-55033,
-54507,
-54148,
-53443,
-52976,
-52399,
-51915,
-51534,
-51251,
-50958,
-50654,
-50181,
-49703,
-49205,
-48884,
-48698,
-48725,
-48613,
-48700,
-48327,
-48124,
-47528,
-47217,
-46886,
-46596,
-46311,
-45953,
-45358,
-44758,
-43917,
-43231,
-42411,
-41768,
-40950,
-40371,
-39401,
-38865,
-37939,
-37359,
-36564,
-35965,
-35324,
-34657,
-34107,
-33439,
-32998,
-32466,
-32088,
+12180,
+6952,
+509,
+65535,
+90,
+65535,
+65535,
+154,
+65535,
+6898,
+22484,
+35016,
+43212,
+46344,
+45483,
+42848,
+40568,
+40270,
+41903,
+44782,
+47666,
+49097,
+47878,
+44282,
+39480,
+31856,
+22082,
+11414,
+1900,
+65535,
+181,
+65535,
+83,
+65535,
+42,
+65535,
+20,
+65535,
+65535,
+74,
+65535,
+297,
+65535,
+5505,
+19983,
+31696,
+41398,
+49177,
+56800,
+63977,
+65534,
+65422,
+65534,
+65489,
+65534,
+65522,
+65534,
+65534,
+65523,
+65534,
+65519,
+65534,
+65523,
+65534,
+65534,
+65483,
+65534,
+63567,
+59927,
+55334,
+48466,
+40382,
+30932,
+21659,
+13692,
+7912,
+5373,
+5792,
+9256,
+14629,
+20796,
+27885,
+33655,
+36964,
+39072,
+40116,
+40633,
+41114,
+42706,
+45153,
+47138,
+49256,
+52090,
+54580,
+54768,
+53407,
+50818,
+46533,
+41635,
+36554,
+31677,
+27603,
+25064,
+23543,
+23521,
+24811,
+25675,
+26058,
+25535,
+23139,
+19954,
+16896,
+14458,
+13935,
+15282,
+18962,
+24381,
+30687,
+36818,
+41202,
+43089,
+42251,
+39559,
+35852,
+31966,
+29250,
+28574,
+27870,
+26512,
+24297,
+20147,
+14222,
+8041,
+2636,
+65535,
+33,
+65535,
+65535,
+18,
+65535,
+19,
+65535,
+7,
+4,
+65535,
+42,
+65535,
+122,
+65535,
+1476,
+7168,
+13537,
+21322,
+30573,
+39674,
+47822,
+54626,
+58775,
+60498,
+61729,
+63446,
+65265,
+65534,
+65493,
+65534,
+65521,
+65533,
+65534,
+65511,
+65534,
+65501,
+65534,
+65345,
+62739,
+60014,
+57995,
+55954,
+54077,
+50805,
+46787,
+43096,
+39751,
+38333,
+38961,
+40498,
+42126,
+42498,
+40597,
+35801,
+29828,
+24480,
+20266,
+16918,
+15923,
+17071,
+18986,
+23242,
+27176,
+29298,
+31110,
+31954,
+32064,
 31626,
-31158,
-30760,
-30340,
-29962,
-29567,
-29250,
-28882,
-28629,
-28240,
-28033,
-27750,
-27414,
-27152,
-26660,
-26333,
-25820,
-25489,
-25045,
-24804,
-24267,
-23921,
-23335,
-22946,
-22407,
-21991,
-21656,
-21259,
-21013,
-20706,
-20393,
-20197,
-19840,
-19684,
-19511,
-19394,
-19424,
-19395,
-19509,
-19619,
-19598,
-19795,
-19775,
-20129,
-20193,
-20730,
-20901,
-21504,
-21678,
-22055,
-22213,
-22340,
-22658,
-22739,
-23098,
-23252,
-23427,
-23520,
-23582,
-23474,
-23561,
-23452,
-23628,
-23693,
-23963,
-24113,
-24406,
-24646,
-24800,
-25227,
-25374,
-25913,
-26152,
-26684,
-27151,
-27547,
-28149,
-28499,
-29145,
-29519,
-30008,
-30427,
-30917,
-31533,
-32137,
-32994,
-33666,
-34366,
-34818,
-35209,
-35569,
-35964,
-36565,
-36915,
-37564,
-37690,
-38006,
-38001,
-38137,
-38312,
-38582,
-38819,
-39027,
-39061,
-39270,
-39262,
-39734,
-39928,
-40464,
-40525,
-40709,
-40702,
-40642,
-40902,
-41084,
-41546,
-41813,
-42013,
-41989,
-41991,
-41946,
-42099,
-42413,
-42675,
-42966,
-43098,
-43183,
-43168,
-43116,
-42990,
-42918,
-42722,
-42588,
-42455,
-42279,
-42143,
-41970,
-41590,
-41282,
-40750,
-40395,
-40128,
-39844,
-39773,
-39622,
-39354,
-39042,
-38693,
-38243,
-38052,
-37667,
-37496,
-37250,
-36938,
-36677,
-36385,
-35964,
-35792,
-35341,
-35105,
-34900,
-34727,
-34546,
-34417,
-34124,
-33842,
-33483,
-32999,
-32729,
-32402,
-32175,
-31937,
-31556,
-31115,
-30606,
-30051,
-29630,
-29234,
-28942,
-28680,
-28456,
-28124,
-27927,
-27547,
-27262,
-26972,
-26640,
-26464,
-26352,
-26265,
-26219,
-26176,
-25953,
-25777,
-25599,
-25401,
-25533,
-25688,
-25932,
-26241,
-26287,
-26397,
-26351,
-26355,
-26461,
-26554,
-26839,
-26994,
-27263,
-27302,
-27464,
-27412,
-27484,
-27416,
-27481,
-27462,
-27812,
-27905,
-28344,
-28459,
-28743,
-28702,
-28787,
-28946,
-29119,
-29478,
-29740,
-30029,
-30209,
-30270,
-30431,
-30447,
-30763,
-30914,
-31160,
-31336,
-31557,
-31891,
-32199,
-32622,
-32908,
-33176,
-33328,
-33574,
-33750,
-34039,
-34393,
-34681,
-34680,
-34902,
-34616,
-34656,
-34551,
-34611,
-34662,
-34678,
-34616,
-34568,
-34505,
-34349,
-34369,
-34151,
-34258,
-34062,
-34127,
-33993,
-33929,
-33838,
-33641,
-33506,
-33219,
-33153,
-32886,
-32954,
-32730,
-32623,
-32374,
-32028,
-31818,
-31495,
-31401,
-31158,
-31207,
-30889,
-30874,
-30582,
-30360,
-30188,
-29893,
-29678,
-29584,
-29411,
-29474,
-29367,
-29208,
-29101,
-28765,
-28481,
-28233,
-28038,
-27968,
-27926,
-27792,
-27660,
-27348,
-27062,
-26796,
-26529,
-26399,
-26304,
-26269,
-26171,
-26202,
-25972,
-25956,
-25599,
-25422,
-25201,
-25046,
-24979,
-25113,
-25066,
-25270,
-25065,
-25071,
-24777,
-24782,
-24712,
-24959,
-25089,
-25466,
-25601,
-25708,
-25691,
-25753,
-25688,
-26043,
-26064,
-26442,
-26574,
-26640,
-26841,
-26816,
-27019,
-27148,
-27285,
-27546,
-27530,
-27854,
-27864,
-28186,
-28284,
-28587,
-28568,
-28568,
-28655,
-28503,
-28655,
-28701,
-28810,
-28967,
-29055,
-29076,
-29190,
-29228,
-29414,
-29537,
-29768,
-29872,
-29986,
-30096,
-30094,
-30165,
-30204,
-30033,
-30136,
-29900,
-29872,
-29721,
-29629,
-29721,
-29718,
-29853,
-29963,
-30117,
-30163,
-30340,
-30316,
-30518,
-30605,
-30716,
-30782,
-30716,
-30628,
-30273,
-30096,
-29719,
-29453,
-29299,
-29032,
-28990,
-28720,
-28571,
-28520,
-28391,
-28547,
+31791,
+33525,
+35533,
+37486,
+39739,
+42269,
+44957,
+48351,
+51249,
+52270,
+52777,
+52151,
+49229,
+45215,
+41085,
+36783,
+33482,
+32250,
+32172,
+32449,
+34224,
+34279,
+32243,
+29390,
+24852,
+20332,
+15163,
+11713,
+9560,
+8030,
+9408,
+10510,
+10156,
+7590,
+4036,
+2527,
+1896,
+2001,
+3834,
+7015,
+10099,
+13447,
+16606,
+19377,
+21964,
+22406,
+21206,
+20966,
+21401,
+22309,
+24860,
+25763,
+25707,
+26495,
+26482,
+27337,
+27529,
+25922,
+26635,
+28266,
+29380,
+31474,
+34147,
+34120,
+32345,
+33481,
+35077,
+36256,
+38592,
+41417,
+43755,
+44609,
+44292,
+42504,
+40713,
+40341,
+41033,
+44053,
+48414,
+52957,
+56879,
+58937,
+58770,
+55650,
+51525,
+48070,
+45684,
+45675,
+46988,
+47965,
+47257,
+43327,
+37758,
+32151,
+27428,
+25842,
+26673,
+27862,
 28433,
-28480,
-28391,
-28255,
-28149,
-27858,
-27771,
-27414,
-27130,
-26704,
-26223,
-25687,
-25156,
-24648,
-24246,
-23809,
-23536,
-23278,
-22982,
-22855,
-22477,
-22275,
-21858,
-21568,
-21302,
-21038,
-20991,
-20727,
-20727,
-20594,
-20593,
-20683,
-20947,
-21437,
-22121,
-22986,
-23806,
-24735,
-25422,
-26089,
-26549,
-26777,
-26991,
-26931,
-26884,
-26751,
-26441,
-26154,
-25753,
-25358,
-24867,
-24647,
-24227,
-24403,
-24338,
-24978,
-25290,
-26131,
-26640,
-27219,
-27766,
-28018,
-28497,
-28660,
-29096,
-29500,
-29872,
-30564,
-30890,
-31582,
-32000,
-32797,
-33598,
-34744,
-35924,
-37403,
-38736,
-40172,
-41282,
-42390,
-43139,
-43920,
-44424,
-45137,
-45445,
-46065,
-46332,
-46729,
-46908,
-46973,
-46931,
-46950,
-46908,
-47239,
-47638,
-48237,
-48967,
-49454,
-50075,
-50296,
-50606,
-50872,
-51161,
-51468,
-51982,
-52331,
-52980,
-53570,
-54154,
-54878,
-55437,
-56009,
-56589,
-57182,
-57763,
-58533,
-58981,
-59642,
-59755,
-59908,
-59666,
-59399,
-59068,
-58778,
-58426,
-58225,
-57805,
-57517,
-56897,
-56474,
-55770,
-55409,
-54774,
-54414,
-54084,
-53751,
-53487,
-53062,
-52626,
-51908,
-51320,
-50336,
-49856,
-49032,
-48835,
-48435,
-48326,
-48101,
-47862,
-47615,
-47262,
-46952,
-46574,
-46288,
-45999,
-45777,
-45468,
-45091,
-44625,
-43964,
-43249,
-42457,
-41613,
-40816,
-40065,
-39263,
-38559,
-37647,
-36875,
-35899,
-34946,
-34106,
-33172,
-32558,
-31799,
-31205,
-30516,
-29829,
-29100,
-28391,
-27680,
-27064,
-26527,
-26111,
-25841,
-25513,
-25311,
-25067,
-24804,
-24445,
-24163,
-23737,
-23607,
-23207,
-23206,
-22989,
-22916,
-22746,
-22539,
-22280,
-22098,
-21791,
+29569,
+30912,
+32478,
+35354,
+37267,
+38323,
+39541,
+40856,
+42728,
+45799,
+46424,
+44034,
+43035,
+42426,
+42095,
+43119,
+43770,
+42536,
+40554,
+38478,
+34996,
+32681,
+32163,
+31314,
+28561,
+27412,
+26277,
+24707,
+24153,
+23499,
+25385,
+26038,
+25953,
+25923,
+28306,
+30472,
+28118,
+25467,
+22839,
+20915,
+20861,
+24524,
+26873,
+25604,
+25700,
+28123,
+30932,
+29421,
+26410,
+24142,
+20694,
+19787,
+19486,
 21700,
-21525,
-21368,
-21215,
-21146,
-20905,
-20859,
-20638,
-20682,
-20505,
-20528,
-20438,
-20462,
-20525,
-20463,
-20592,
-20551,
-20748,
-20793,
-21148,
-21413,
-21790,
-22144,
-22544,
+25126,
+25597,
+26389,
+28652,
+32727,
+32481,
+29848,
+29958,
+31365,
+33210,
+32888,
+32839,
+32744,
+33939,
+35187,
+36051,
+42029,
+45452,
+44132,
+44824,
+47186,
+47634,
+47356,
+47206,
+46785,
+44309,
+40939,
+37698,
+33122,
+30090,
+27427,
+26579,
+27455,
+28516,
+26921,
+24181,
+22799,
+19576,
+18595,
+18449,
+15607,
+13950,
+16113,
+19941,
+24580,
+28905,
+31686,
+33381,
+35480,
+38759,
+40945,
+43207,
+43284,
+39737,
+40635,
+41008,
+40520,
+42220,
+43215,
+42977,
+42430,
+42720,
+41093,
+39073,
+36485,
+30806,
+26300,
+23446,
+20957,
+19392,
+18545,
+17769,
+17397,
+15998,
+17500,
+20969,
+22017,
 22851,
-23343,
-23625,
-24163,
-24645,
-25092,
-25642,
-25999,
-26486,
-26772,
-27130,
-27414,
-27704,
-27993,
-28256,
-28524,
-28767,
-29187,
-29366,
-29940,
-30339,
-30829,
-31555,
-31959,
-32862,
-33242,
-33972,
-34195,
-34679,
-34903,
-35167,
-35435,
-35656,
-35920,
-36077,
-36385,
-36542,
-36786,
-37049,
-37362,
-37715,
-38135,
-38559,
-38954,
-39399,
-39643,
-39973,
-40020,
-40129,
-40085,
-40041,
-39997,
-40041,
-39974,
-40152,
-40063,
-40173,
-40198,
-40349,
-40463,
-40794,
-40926,
-41327,
-41479,
-41548,
-41680,
-41547,
-41502,
-41238,
-41148,
-40794,
-40750,
-40483,
-40308,
-40195,
-39821,
-39707,
-39333,
-39066,
-38934,
-38579,
-38557,
-38358,
-38068,
-37872,
-37448,
-37141,
-36696,
-36408,
-36009,
-35857,
-35652,
-35527,
-35385,
-35325,
-35147,
-35033,
-34838,
-34635,
-34504,
-34260,
-34105,
-33706,
-33507,
-32975,
-32533,
-31999,
-31493,
-31025,
-30651,
-30316,
-30029,
-29721,
-29495,
-29103,
-28720,
-28435,
-27927,
-27744,
-27288,
-27101,
-26755,
-26418,
-26085,
-25602,
-25287,
-24826,
-24537,
-24246,
-24096,
-23914,
-23895,
-23828,
-23671,
-23741,
-23471,
-23453,
-23361,
-23252,
-23252,
-23229,
-23164,
-23096,
-22964,
-22830,
-22632,
-22454,
-22367,
-22275,
-22213,
-22230,
-22080,
-22077,
-21900,
-21791,
-21590,
-21457,
-21260,
-21189,
-21061,
-21037,
-20901,
-20864,
-20699,
-20554,
-20481,
-20261,
-20308,
-20169,
-20288,
-20303,
-20330,
-20415,
-20394,
-20330,
-20348,
-20197,
-20304,
-20063,
-20284,
-20128,
-20306,
-20261,
-20284,
-20439,
-20261,
-20550,
-20437,
-20729,
-20791,
-20927,
-21170,
-21123,
-21195,
-21123,
-20905,
-20992,
-20661,
-20791,
-20509,
-20589,
-20509,
-20503,
-20484,
-20461,
-20327,
-20395,
-20261,
-20462,
-20371,
-20439,
-20550,
-20416,
-20439,
-20173,
-20017,
-19708,
-19643,
-19306,
+27215,
+32389,
+33840,
+37138,
+39813,
+40138,
+38829,
+38638,
+39855,
+39919,
+39977,
+39508,
+39635,
+38702,
+38035,
+37745,
+33666,
+27941,
+22782,
+20001,
+19597,
 19335,
-19150,
-19246,
-19152,
-19265,
-19155,
-19197,
-19245,
-19217,
-19468,
-19416,
-19821,
-19796,
-20105,
-20154,
-20390,
-20598,
-20900,
-21306,
-21898,
-22456,
-23273,
-24005,
-24802,
-25511,
-26176,
-26683,
-27264,
-27589,
-27929,
-28210,
-28238,
-28387,
-28261,
-28078,
-27971,
-27592,
-27570,
-27395,
-27592,
-27794,
-28100,
-28591,
-29033,
-29651,
-30143,
-30847,
-31292,
-31979,
-32487,
-33154,
-33639,
-34304,
-34791,
-35435,
-35832,
-36630,
-37139,
-38159,
-38865,
-40044,
-40902,
-42059,
-42940,
-43964,
-44800,
-45604,
-46283,
-46934,
-47479,
-47863,
-48433,
-48615,
-49031,
-49191,
-49254,
-49476,
-49478,
-49741,
-49876,
-50296,
-50495,
-50961,
-51204,
-51514,
-51847,
-52090,
-52378,
-52600,
-52798,
-53110,
-53396,
-53775,
-54149,
-54505,
-55036,
-55346,
-55944,
-56366,
-56940,
-57429,
-57960,
-58335,
-58737,
-58822,
-59046,
-58935,
-58977,
-58671,
-58578,
-58226,
-58072,
-57736,
-57452,
-57140,
-56719,
-56322,
-55899,
-55412,
-55082,
-54592,
-54107,
-53661,
-52890,
-52353,
-51473,
-50782,
-50008,
-49278,
-48723,
-48125,
-47794,
-47350,
-47218,
-46905,
-46777,
-46551,
-46265,
-46200,
-45886,
-45713,
-45401,
-44912,
-44495,
-43850,
-43142,
-42433,
-41701,
-40950,
-40330,
-39552,
-38978,
-38292,
-37669,
-37142,
-36362,
-35856,
-34990,
-34416,
-33661,
-33086,
-32356,
-31645,
-30895,
-30050,
-29388,
-28589,
-28014,
-27527,
-27039,
-26729,
-26441,
-26220,
-26087,
-25865,
-25754,
-25468,
-25332,
-25048,
-24932,
-24760,
-24624,
-24493,
-24204,
-24159,
-23806,
-23827,
-23651,
-23628,
-23695,
-23627,
-23741,
-23692,
-23719,
-23694,
-23649,
-23542,
-23449,
-23297,
-23208,
-23161,
-23121,
-23118,
-23140,
-23209,
-23206,
-23496,
-23540,
-24004,
-24271,
-24647,
-25111,
-25425,
-25774,
-26201,
-26327,
-26863,
-26863,
-27282,
-27328,
-27747,
-27837,
-28258,
-28412,
-28656,
-28855,
-29034,
-29231,
-29454,
-29719,
-29941,
-30317,
-30539,
-30826,
-31138,
-31380,
-31691,
-31978,
-32222,
-32554,
-32843,
-33130,
-33508,
-33771,
-34128,
-34303,
-34594,
-34790,
-34925,
-35169,
-35365,
-35504,
-35873,
-35836,
-36184,
-36189,
-36429,
-36521,
-36673,
-36830,
-36917,
-37118,
-37228,
-37405,
-37471,
-37605,
-37582,
-37628,
-37580,
-37629,
-37602,
-37695,
-37715,
-37848,
-37914,
-37938,
+18661,
+18089,
+16913,
+17027,
+18613,
+19052,
+20015,
+20180,
+20185,
+24848,
+27227,
+31024,
+36028,
+38281,
+46245,
+50408,
+51965,
+55623,
+59250,
+63571,
+65419,
+65534,
+65502,
+65534,
+65478,
+65534,
+65476,
+64546,
+59634,
+53319,
+50426,
+44639,
+36463,
+26354,
+22181,
+21443,
+20770,
+22025,
+18886,
+18548,
+18020,
+15403,
+15981,
+16136,
+15256,
+15752,
+17220,
+18459,
+24215,
+28185,
+29385,
+34201,
+35858,
+35871,
+38400,
+42036,
+42201,
+43460,
+47546,
+47161,
+45833,
+42671,
+41923,
+40265,
+40774,
+41119,
+36039,
+34295,
+29703,
+27702,
+25457,
+20849,
+18338,
+14890,
+14875,
+12802,
+11624,
+11464,
+9866,
+10643,
+9706,
+12600,
+17416,
+19958,
+20978,
+22119,
+22502,
+22075,
+20755,
+20231,
+21288,
+24731,
+26395,
+26719,
+29437,
+28636,
+25770,
+25105,
+24681,
+25115,
+24650,
+25297,
+26731,
+26074,
+26597,
+24695,
+23904,
+24240,
+22221,
+22983,
+26236,
+27924,
+30107,
+30891,
+31926,
+34503,
+38406,
+41840,
+46238,
+51617,
+54604,
+56584,
+60949,
+65391,
+65534,
+64197,
+64792,
+64022,
+60695,
+60796,
+60873,
+61640,
+60580,
+58196,
+57098,
+53719,
+48325,
+42384,
+38422,
+33726,
+29842,
+29624,
+29253,
+29734,
+29122,
+28138,
+29002,
+28186,
+27068,
+26068,
+26307,
+26513,
+26824,
+28569,
+28978,
+28358,
+28181,
+27240,
+27886,
+29469,
+28103,
+31325,
+34464,
+35175,
+36923,
+34555,
+34374,
+32368,
+31757,
+31312,
+26990,
+27382,
+27262,
+26553,
+23943,
+21819,
+19995,
+16319,
+15328,
+13435,
+13595,
+13528,
+11561,
+10557,
+10707,
+12724,
+13649,
+18143,
+22183,
+27915,
+32546,
+30286,
+31881,
+33512,
+34705,
+35290,
+35516,
+38397,
+38907,
+42422,
+43513,
+43038,
+44234,
+40144,
+38160,
+37558,
+35292,
+33080,
+29233,
+27757,
+27605,
+27442,
+26046,
+24797,
+25638,
+25152,
+25644,
+26688,
+27252,
+28088,
+27175,
+29002,
+32249,
+35099,
+39520,
+42246,
+44331,
+47037,
+52048,
+56266,
+57415,
+58296,
+57313,
+55860,
+54961,
+53483,
+55169,
+55187,
+53970,
+53501,
+53862,
+56405,
+53369,
+49084,
+44199,
+38000,
+36951,
+34057,
+32277,
+31453,
+28530,
+28500,
+27545,
+27698,
+24392,
+20699,
+18407,
+15932,
+17296,
+19028,
+19411,
+19246,
+20139,
+19440,
+20150,
+23420,
+24543,
+24838,
+24778,
+25455,
+26316,
+28783,
+29488,
+28666,
+28335,
+26804,
+25718,
+22131,
+21001,
+19535,
+17147,
+16182,
+14911,
+17131,
+16839,
+16466,
+17293,
+15975,
+17628,
+15783,
+14701,
+17235,
+18591,
+22456,
+26055,
+29810,
+33816,
+35252,
+36845,
+38227,
+38312,
+39373,
+41678,
+43966,
+44867,
+45485,
+47151,
+47691,
+47282,
+46220,
+44790,
+43989,
+41830,
+40168,
+40157,
+38293,
+34876,
+32923,
+32656,
+33269,
+32702,
+31851,
+32207,
+31776,
+32833,
+31020,
+29441,
+30874,
+29695,
+29532,
+31372,
+32836,
+34534,
+37859,
+42095,
+45305,
+46941,
+46686,
+45935,
+45995,
+46635,
+46310,
+47291,
+48911,
+48054,
+49058,
+50469,
+49393,
+47428,
+43908,
+40048,
+36626,
+34582,
+33198,
+32993,
+33785,
+31819,
+31673,
+30348,
+28256,
+27178,
+24422,
+23845,
+22080,
+20780,
+20813,
+21163,
+24804,
+27210,
+27272,
+26547,
+28010,
+30876,
+31274,
+30838,
+30344,
+30454,
+31829,
+31726,
+30300,
+28073,
+25701,
+24989,
+23696,
+22405,
+19104,
+16049,
+15817,
+14996,
+13768,
+12625,
+12299,
+11299,
+11587,
+14450,
+16622,
+16454,
+18902,
+21495,
+23053,
+27710,
+29662,
+32428,
+35570,
+38966,
+44644,
+47723,
+51970,
+53930,
+53853,
+55953,
+56538,
+57525,
+56971,
+58227,
+57807,
+54337,
+52681,
+51152,
+46269,
+39691,
+36716,
+34476,
+31867,
+31393,
+30592,
+28681,
+26439,
+25428,
+24245,
+23382,
+23441,
+23093,
+24615,
+25732,
+28416,
+31851,
+34589,
 38046,
-38071,
+41176,
+44190,
+45913,
+45893,
+47372,
+46772,
+46634,
+46950,
+45615,
+45153,
+43408,
+43379,
+42454,
+41993,
+40700,
+36517,
+33689,
+28464,
+25294,
+23545,
+22017,
+20080,
+18890,
+19214,
+18567,
+18177,
+17671,
+17065,
+16084,
+17925,
+20086,
+22791,
+24830,
+26836,
+29590,
+31222,
+32277,
+32045,
+32012,
+32890,
+33883,
+34360,
+34062,
+34145,
+32165,
+30507,
+28111,
+24644,
+22103,
+18581,
+18078,
+16492,
+14696,
+14034,
+12153,
+11396,
+10104,
+9313,
+9184,
+9564,
+11968,
+13897,
+16043,
+18375,
+20894,
+25176,
+29430,
+33365,
 38114,
-38201,
-38248,
-38313,
-38446,
-38535,
-38579,
-38689,
-38670,
-38597,
-38606,
-38442,
-38450,
-38378,
-38357,
-38358,
-38335,
-38382,
-38244,
-38272,
-38000,
-38071,
-37827,
-37869,
-37827,
-37737,
-37781,
-37650,
-37559,
-37429,
-37248,
-37074,
-36896,
-36717,
-36566,
-36428,
-36366,
-36140,
-36035,
-35807,
-35571,
-35496,
-35171,
-35210,
-35148,
+41750,
+45279,
+49777,
+54314,
+58061,
+60018,
+61933,
+62671,
+63521,
+63387,
+63698,
+63642,
+62352,
+60875,
+57785,
+55246,
+51906,
+48529,
+44504,
+39918,
+37666,
+34717,
+33572,
+32905,
+31381,
+30500,
+29881,
+29949,
+29390,
+30671,
+32220,
+33018,
+33925,
+35363,
+37332,
+36711,
+36920,
+37290,
+37750,
+38049,
+37907,
+37671,
+37444,
+37003,
+35270,
+34292,
+34415,
+34858,
+33918,
+33888,
+35191,
+34651,
+31788,
+29526,
+27237,
+25415,
+23111,
+22542,
+24421,
+24011,
+25219,
+26502,
+26798,
+27209,
+25758,
+26765,
+28652,
+28212,
+28992,
+29290,
+29926,
+31111,
+31309,
+32269,
+30587,
+30760,
+30044,
+28311,
+28022,
+25050,
+24202,
+21808,
+20244,
+18589,
+15912,
+16208,
+13190,
+13219,
+13585,
+12666,
+12593,
+12349,
+13331,
+12725,
+14389,
+16772,
+17018,
+18840,
+21155,
+22172,
+24630,
+26675,
+29297,
+32800,
+34366,
+36910,
+40363,
+44186,
+47232,
+48600,
+51291,
+52525,
+51760,
+52334,
+51491,
+51653,
+50631,
+49061,
+49041,
+48610,
+47719,
+46148,
+46145,
+44652,
+43411,
+43002,
+42176,
+40750,
+40418,
+41099,
+40921,
+41506,
+43408,
+44517,
+45831,
+45953,
+45185,
+43778,
+41701,
+40535,
+38428,
+38342,
+37348,
+36930,
+36951,
+35586,
+34667,
+32369,
+30394,
+27924,
+26573,
+26963,
+27350,
+29410,
+29310,
+29689,
+29371,
+26913,
+25832,
+24328,
+24617,
+23566,
+23518,
+25262,
+26479,
+28547,
+30510,
+32066,
+34146,
+35083,
+35633,
+36335,
+36157,
+36195,
+36096,
+36356,
+36368,
+35594,
+34746,
+34158,
+31312,
+30269,
+28930,
+27024,
+24771,
+22150,
+20822,
+19136,
+17217,
+16074,
+16156,
+15655,
+15123,
+14226,
+15245,
+17164,
+18975,
+20904,
+22155,
+23623,
+24322,
+24251,
+25986,
+27078,
+28274,
+31104,
+33214,
+35116,
+37326,
+38295,
+38707,
+38879,
+39598,
+40025,
+40916,
+40797,
+40585,
+40417,
+39630,
+39023,
+38291,
+36912,
+36783,
+37253,
+36172,
+37006,
+35716,
+35523,
+36364,
+35653,
+36504,
+36867,
+36386,
+37965,
+39399,
+41186,
+41028,
+42227,
+44856,
+45230,
+46927,
+47264,
+46686,
+46503,
+45278,
+43491,
+41741,
+39219,
+39001,
+37080,
+35412,
+34152,
+31391,
+30473,
+26950,
+25041,
+24170,
+23049,
+22907,
+21594,
+22384,
+22532,
+22117,
+24000,
+24033,
+25964,
+27573,
+28774,
+31226,
+32081,
+34250,
+35635,
+36012,
+37575,
+37069,
+37768,
+39546,
+39272,
+40435,
+40760,
+41312,
+39247,
+37653,
+36386,
+33006,
+31790,
+29607,
+27740,
+26997,
+25501,
+25058,
+22815,
+22620,
+21760,
+20761,
+22265,
+21563,
+23050,
+22544,
+23771,
+25148,
+24878,
+27861,
+29518,
+29688,
+31696,
+31988,
+33506,
+34239,
+34584,
+36308,
+35465,
+36323,
+35900,
+34725,
+35261,
+34204,
+34032,
+34045,
+34237,
+34606,
+34489,
+34882,
+34197,
+33116,
+33174,
+31795,
+31817,
+31831,
+31374,
+31722,
+32092,
+31846,
+32764,
+34368,
+35000,
+37019,
+37699,
+38566,
+39985,
+39710,
+40934,
+40838,
+40128,
+40173,
+39860,
+40487,
+38920,
+38483,
+37883,
+35665,
 35055,
-35127,
-34832,
-34840,
-34565,
-34376,
-34078,
-33888,
-33569,
-33488,
-33150,
-33088,
-32863,
-32644,
-32443,
-32046,
-31933,
-31559,
-31556,
-31316,
-31357,
-31115,
-31204,
-30803,
-30785,
-30426,
-30274,
-30162,
-29919,
-29940,
-29765,
-29829,
-29631,
-29720,
-29430,
-29543,
-29165,
-29322,
-29074,
-29213,
-29207,
-29169,
-29184,
-28991,
+32996,
+31180,
+29053,
+26024,
+24052,
+22549,
+21012,
+18868,
+18945,
+19134,
+19782,
+21614,
+23152,
+24525,
+27037,
+27147,
+27239,
+28626,
+30363,
+31387,
+33550,
+36942,
+38931,
+41818,
+43314,
+44599,
+44505,
+45011,
+44573,
+42729,
+41944,
+40833,
+40697,
+41957,
+40607,
+39648,
+39243,
+36676,
+34669,
+32325,
+30255,
+28133,
+26710,
+25753,
+24977,
+26341,
+26762,
+26562,
+27669,
+28608,
+28361,
+29697,
+31013,
+32626,
+34050,
+34620,
+35281,
+35275,
+36367,
+36099,
+35990,
+36684,
+36481,
+36566,
+37451,
+35780,
+35656,
+34336,
+33110,
+33902,
+32734,
+32427,
+31376,
+31387,
+31548,
+30298,
+30607,
+28702,
+28721,
+28051,
+27985,
+28831,
+27153,
+27783,
+27546,
+28469,
+30118,
+31113,
+32783,
+34084,
+35454,
+36478,
+37626,
+39800,
+39386,
+40804,
+40717,
+40369,
+41651,
+41365,
+40685,
+38533,
+37414,
+34556,
+33675,
+32017,
+30180,
+28858,
+26752,
+26104,
+24373,
+23396,
+22208,
+21127,
+19878,
+18224,
+19548,
+20415,
+21128,
+23538,
+25317,
+25843,
+26816,
+26926,
+27609,
+29389,
+30296,
+32030,
+35263,
+38235,
+39725,
+40829,
+40314,
+40184,
+39965,
+38886,
+37325,
+37972,
+39105,
+37684,
+39118,
+38354,
+37152,
+36543,
+34818,
+34957,
+33784,
+34218,
+33516,
+32178,
+32304,
+31132,
+30546,
+29556,
+28957,
+29353,
+30165,
+31067,
+31953,
+33857,
+34044,
+33480,
+33765,
+33727,
+33402,
+34087,
+34391,
+36189,
+37117,
+36943,
+36795,
+36466,
+35655,
+34030,
+33685,
+33957,
+32892,
+32847,
+33365,
+33130,
+32733,
+32751,
+33201,
+31588,
+31011,
+30780,
+30766,
+32150,
+32691,
+33134,
+34661,
+35275,
+35620,
+36056,
+36594,
+36520,
+36046,
+36492,
+36965,
+36096,
+36352,
+36221,
+36358,
+35383,
+34991,
+34118,
+32609,
+31271,
+30353,
+30661,
+28921,
+28124,
+27731,
+27228,
+27101,
+25867,
+26341,
+25937,
+25017,
+25502,
+25178,
+25219,
+25119,
+26347,
+26379,
+26744,
+28043,
+28267,
+28046,
+29499,
 28942,
-28724,
-28568,
-28499,
-28416,
-28430,
-28483,
-28388,
-28390,
-28349,
-28210,
-28192,
-28103,
-28123,
-28081,
-28171,
-28187,
-28283,
-28299,
-28238,
-28211,
-28082,
-28057,
-27969,
-27994,
-27966,
-28017,
-27990,
-27948,
-27903,
-27858,
-27904,
-27791,
-28016,
-27923,
-28214,
-28235,
-28324,
-28435,
-28412,
-28435,
-28390,
-28368,
-28325,
-28367,
-28324,
-28348,
-28277,
-28237,
-28057,
-28080,
-27860,
-27902,
-27704,
-27792,
-27659,
-27727,
-27526,
-27570,
-27307,
-27369,
-27108,
-27038,
-26951,
-26796,
-26884,
-26685,
-26640,
-26552,
-26443,
-26327,
-26201,
-26106,
-25934,
+28674,
+29538,
+30830,
+33131,
+33755,
+34699,
+34574,
+35344,
+34821,
+33946,
+33584,
+33338,
+33398,
+33399,
+34065,
+35241,
+35539,
+35920,
+36150,
+37372,
+37264,
+36942,
+37320,
+37202,
+37765,
+38147,
+37362,
+36396,
+36358,
+35701,
+35999,
+35412,
+35778,
+34414,
+34493,
+33795,
+33288,
+32575,
+30829,
+30734,
+29764,
+30860,
+30880,
+31579,
+31257,
+30243,
+31575,
+31619,
+31666,
+31894,
+31796,
+31874,
+32060,
+33469,
+33615,
+34978,
+36224,
+36592,
+37731,
+39068,
+39792,
+39415,
+40384,
+40043,
+40203,
+40378,
+40405,
+40723,
+39165,
+39982,
+38615,
+37443,
+37638,
+35695,
+36065,
+34676,
+33476,
+32844,
+31064,
+30151,
+28046,
+28664,
+27464,
+27168,
+27660,
+26562,
+27506,
+26646,
+26303,
+26238,
+26573,
+26836,
+27067,
+26835,
+26709,
+27931,
+27655,
+28824,
+29132,
+28468,
+30023,
+28939,
+29031,
+29799,
+29481,
+29360,
+29824,
+28276,
+28153,
+28613,
+27553,
+27755,
+27359,
+27366,
+26637,
+26693,
+27755,
+27930,
+28884,
+28818,
+29345,
+30995,
+31493,
+32910,
+32303,
+33982,
+34670,
+35340,
+36668,
+36189,
+37926,
+38477,
+38613,
+38021,
+37656,
+38447,
+37899,
+37798,
+37594,
+36714,
+36807,
+35850,
+34744,
+33810,
+32917,
+31789,
+32152,
+30605,
+29870,
+30022,
+29435,
+30676,
+30330,
+31303,
+32337,
+31321,
+31848,
+32519,
+33324,
+34774,
+35760,
+36937,
+37226,
+38581,
+38898,
+39895,
+41201,
+39880,
+41472,
+42360,
+42113,
+43143,
+41208,
+41069,
+39768,
+38687,
+38484,
+37103,
+37364,
+35788,
+34713,
+35104,
+33584,
+32924,
+31800,
+30801,
+30808,
+29131,
+30245,
+28750,
+28052,
+28253,
+28076,
+28709,
+27863,
+28906,
+29948,
+30176,
+30326,
+30254,
+31118,
+30802,
+30200,
+31937,
+32401,
+31648,
+31965,
+32199,
+32641,
+32509,
+31703,
+31227,
+31661,
+31010,
+30212,
+30288,
+29484,
+30004,
+28389,
+28289,
+27713,
+27352,
+27428,
+27721,
+29432,
+29339,
+29798,
+29877,
+30566,
+31560,
+31978,
+32076,
+33085,
+33523,
+33984,
+34262,
+36620,
+36224,
+34917,
+36496,
+34399,
+34687,
+34449,
+32949,
+32950,
+30986,
+30403,
+28606,
+28574,
+27941,
+25714,
+26922,
+25933,
+24626,
+25283,
+25584,
 25953,
-25709,
-25735,
-25486,
-25513,
-25288,
-25289,
-25136,
-25178,
-25134,
-25201,
-25134,
-25245,
-25224,
-25200,
-25201,
-25091,
-25088,
-24916,
-24888,
-24715,
-24669,
-24536,
-24338,
-24292,
-24093,
-23962,
-23870,
-23718,
-23628,
-23517,
-23452,
-23251,
-23207,
-22876,
-22764,
-22454,
-22211,
-21856,
-21657,
-21325,
-21059,
-20903,
-20616,
-20595,
-20414,
-20420,
-20391,
-20419,
-20547,
-20596,
-20725,
-20838,
-20883,
-20967,
-20930,
-20944,
-20842,
-20789,
-20663,
-20614,
-20484,
-20417,
-20460,
-20328,
-20484,
-20438,
-20504,
-20575,
-20700,
-20797,
-20947,
-20925,
-20971,
-20860,
-20835,
-20531,
-20481,
-20172,
-20021,
-19881,
-19710,
-19686,
-19595,
-19711,
-19771,
-20019,
-20152,
-20503,
-20817,
-21124,
-21503,
-21833,
-22101,
-22365,
-22587,
-22699,
-22984,
-23076,
-23384,
-23606,
-24049,
-24382,
-24889,
-25402,
-25952,
-26642,
-27261,
-27990,
-28658,
-29274,
-29944,
-30381,
-30895,
-31225,
-31623,
-31782,
-32130,
-32336,
-32708,
-33041,
-33487,
-33859,
-34417,
-34857,
-35521,
-36078,
-36851,
-37472,
-38246,
-38935,
-39484,
-40178,
-40701,
-41219,
-41788,
-42213,
-42853,
-43364,
-44071,
-44738,
-45422,
-46200,
-46905,
-47707,
-48323,
-49234,
-49787,
-50627,
-51249,
-51849,
-52352,
-52803,
-53084,
-53443,
-53729,
-54039,
-54438,
-54683,
-55101,
-55325,
-55766,
-55923,
-56299,
-56320,
-56652,
-56721,
-56940,
-57074,
-57075,
-57137,
-57056,
-56938,
-56810,
-56718,
-56630,
-56678,
-56717,
-56766,
-56894,
-56898,
-56940,
-56942,
-56830,
-56740,
-56567,
-56339,
-56171,
-55828,
-55551,
-55119,
-54731,
-54146,
-53711,
-53194,
-52802,
-52487,
-52069,
-51868,
-51383,
-51091,
-50565,
-50093,
-49525,
-48986,
-48349,
-47836,
-47197,
-46639,
-46024,
-45354,
-44828,
-44137,
-43585,
-43053,
-42544,
-42212,
-41769,
-41369,
-40928,
-40327,
-39821,
-39132,
-38535,
-37915,
-37316,
-36741,
-36186,
-35679,
-35166,
-34683,
-34215,
-33794,
-33374,
-33109,
-32731,
-32600,
-32176,
-32069,
-31533,
-31230,
-30667,
-30188,
-29740,
-29253,
-28837,
-28475,
-28128,
-27723,
-27484,
-27082,
-26908,
-26640,
-26484,
-26355,
-26239,
-26177,
-26042,
-25954,
-25733,
-25643,
-25289,
-25201,
-24980,
-24802,
-24846,
-24669,
-24736,
-24647,
-24693,
-24645,
-24736,
-24781,
-24890,
-25002,
-25090,
-25244,
-25225,
-25421,
-25334,
-25467,
-25465,
-25403,
-25597,
-25469,
-25819,
-25778,
-26108,
-26155,
-26417,
-26532,
-26838,
-26974,
-27304,
-27572,
-27835,
-28104,
-28345,
-28502,
-28810,
-29012,
-29186,
-29477,
-29653,
+26335,
+28353,
+28864,
+28360,
+30005,
+30647,
+32857,
+34189,
+33793,
+36044,
+36030,
+36640,
+38442,
+38349,
+39727,
+39840,
+40912,
+41116,
+41805,
+43077,
+41305,
+41430,
+39853,
+38376,
+37582,
+36528,
+36411,
+35648,
+36014,
+34160,
+33691,
+32962,
+32058,
+31771,
+29572,
+29123,
+28361,
+28684,
+28836,
+28526,
+30016,
+29729,
+29035,
+30085,
+30632,
+31358,
+31833,
+32470,
+33362,
+33998,
+34012,
+34044,
+35308,
+35486,
+35563,
+36152,
+35587,
+34996,
+35582,
+34872,
+34401,
+34612,
+34273,
+33872,
+32777,
+33429,
+32855,
+32166,
+31936,
+31479,
+31026,
+31593,
+32970,
+33211,
+34452,
+35754,
+35291,
+34890,
+35823,
+35276,
+35042,
+35650,
+35933,
+36271,
+35987,
+35737,
+35512,
+34814,
+34777,
+34289,
+33804,
+33682,
+33410,
+32957,
+31653,
 29895,
-30208,
-30340,
-30736,
-30807,
-31179,
-31272,
-31534,
-31802,
-31890,
-32243,
-32292,
-32594,
-32626,
-32882,
-32890,
-33151,
-33219,
-33419,
-33551,
-33771,
-33908,
-34125,
-34328,
-34525,
-34747,
-34925,
-35212,
-35345,
-35723,
-35875,
-36078,
-36274,
-36343,
-36586,
-36585,
-36741,
-36806,
-36853,
-36939,
-36963,
-36984,
-36962,
-37028,
-36920,
-37070,
-36899,
-37025,
-36966,
-36959,
-36921,
-36870,
-36699,
-36652,
-36451,
-36345,
-36250,
-36122,
-36055,
-35986,
-35834,
-35875,
-35657,
-35721,
-35545,
-35633,
-35522,
-35546,
-35455,
-35412,
-35279,
-35123,
-34948,
-34657,
-34506,
-34213,
-34107,
-33815,
-33707,
-33419,
-33284,
-32976,
-32821,
-32486,
-32424,
-32109,
-32002,
-31802,
-31557,
-31492,
-31158,
-30982,
-30695,
-30472,
-30184,
-30008,
-29783,
-29657,
-29450,
-29302,
-29052,
-28768,
-28677,
-28304,
-28256,
-28014,
-27881,
-27814,
-27549,
-27505,
-27260,
-27149,
-26865,
-26769,
-26512,
-26438,
-26222,
-26196,
+30553,
+29187,
+28505,
+28159,
+27442,
+27598,
+26402,
+28087,
+26897,
+26218,
+28070,
+27976,
+28786,
+29975,
+31601,
+33550,
+33262,
+34225,
+33531,
+34164,
+34315,
+34332,
+35597,
+35431,
+35753,
+35200,
+35096,
+35363,
+35396,
+34384,
+32403,
+31807,
+32188,
+30849,
+31041,
+30301,
+30380,
+29752,
+29148,
+29004,
+29077,
+29108,
+28519,
+28493,
+28702,
+29505,
+28445,
+28814,
+27967,
+29109,
+28997,
+29352,
+30825,
+31705,
+32943,
+32210,
+33109,
+33805,
+32867,
+33001,
+32790,
+33136,
+33366,
+33078,
+33861,
+34160,
+34667,
+33958,
+33152,
+33309,
+32917,
+32406,
+33288,
+32940,
+33383,
+33130,
+32553,
+32768,
+32851,
+33881,
+33525,
+34526,
+35838,
+34685,
+36253,
+36903,
+36782,
+36483,
+35529,
+36418,
+35286,
+36615,
+35933,
+35582,
+36080,
+34311,
+37001,
+36431,
+36443,
+36690,
+36047,
+38500,
+35853,
+36447,
+36618,
+34624,
+36829,
+35037,
+35295,
+35091,
+33857,
+36101,
+35544,
+36009,
+34241,
+33067,
+34361,
+32199,
+33337,
+34202,
+33720,
+35255,
+34627,
+34342,
+34667,
+33571,
+34264,
+33099,
+32350,
+31898,
+30745,
+31890,
+31032,
+30979,
+31173,
+29514,
+29997,
+29248,
+29434,
+29091,
+26584,
+27990,
+27580,
+26773,
+27144,
+26914,
+27169,
+26193,
+26674,
+26929,
 26066,
-25930,
-25823,
-25620,
-25401,
-25290,
-25088,
-24983,
-24909,
-24760,
-24691,
-24513,
-24473,
-24157,
-24138,
-23873,
-23870,
-23675,
-23671,
-23607,
-23539,
-23539,
-23496,
-23363,
-23472,
-23276,
-23426,
-23364,
-23451,
-23539,
-23584,
-23696,
-23648,
-23719,
-23604,
-23652,
-23627,
-23629,
-23650,
-23650,
-23629,
-23583,
-23563,
-23428,
-23450,
-23343,
-23404,
-23387,
-23383,
-23629,
-23560,
-23830,
-23781,
-23851,
-23983,
-23915,
-24094,
-24115,
-24227,
-24314,
-24339,
-24534,
-24450,
-24667,
-24626,
-24869,
-24845,
-25159,
-25220,
-25447,
-25686,
-25756,
-25997,
-25933,
-26131,
-26042,
-26219,
-26154,
+26805,
+26371,
+26161,
+26770,
+25600,
+25371,
+26300,
+26466,
+27136,
+27596,
+28731,
+29046,
+28695,
+30746,
+30549,
+30619,
+31190,
+31438,
+32125,
+32682,
+32953,
+32776,
+34151,
+34253,
+34508,
+34793,
+35245,
+36227,
+35469,
+35269,
+34596,
+34683,
+34928,
+33297,
+34012,
+33679,
+33397,
+33698,
+32470,
+33082,
+32586,
+32459,
+32982,
+32993,
+34431,
+34615,
+34870,
+35956,
+35555,
+36749,
+37164,
+36821,
+38538,
+38225,
+38429,
+39985,
+40077,
+39611,
+39056,
+38159,
+37341,
+36635,
+36257,
+36088,
+35637,
+34802,
+34635,
+34171,
+34641,
+34249,
+33453,
+34422,
+33233,
+32671,
+33423,
+32881,
+33961,
+34786,
+36028,
+36243,
+36203,
+38333,
+38121,
+38458,
+37789,
+38015,
+37696,
+37471,
+38536,
+38134,
+37927,
+36814,
+36743,
+36293,
+34877,
+33443,
+32627,
+32340,
+30453,
+29263,
+29194,
+28186,
+27757,
+26635,
+25572,
+25671,
+24969,
+24597,
+23853,
+23881,
+24432,
+23877,
+24892,
+26062,
+25470,
+26583,
+27033,
+27706,
+27795,
+28562,
+29758,
+27818,
+30148,
+31268,
+31629,
+32490,
+32628,
+33340,
+32199,
+32635,
+32159,
+31788,
+30571,
+30453,
+29861,
+29552,
+29791,
+27714,
+28525,
+28673,
+29585,
+29005,
+28994,
+29526,
+28609,
+29636,
+29855,
+30150,
+30600,
+31883,
+32234,
+34116,
+35307,
+34568,
+35600,
+36112,
+37050,
+36329,
+36404,
+37183,
+36266,
+36931,
+37219,
+36990,
+37488,
+36335,
+36328,
+36841,
+35267,
+35994,
+35751,
+35066,
+35342,
+34673,
+35429,
+35322,
+36286,
+37117,
+36817,
+37990,
+36771,
+36995,
+37988,
+37482,
+37377,
+36959,
+36892,
+37637,
+36436,
+36064,
+35462,
+34580,
+33449,
+33083,
+34629,
+33172,
+32130,
+31444,
+31215,
+30854,
+29109,
+29549,
+28838,
+27132,
+28032,
+28438,
+29089,
+29810,
+28725,
+28777,
+29738,
+29553,
+30326,
+30517,
+32259,
+32583,
+31811,
+34152,
+32716,
+34264,
+34594,
+33247,
+35044,
+34246,
+34481,
+34255,
+34359,
+33475,
+32168,
+32900,
+31626,
+30437,
+30945,
+30495,
+29190,
+28967,
+29122,
+28479,
+27585,
+27543,
+27692,
+27852,
+28710,
+27991,
+28843,
+30144,
+29232,
+30458,
+30375,
+31200,
+32172,
+31496,
+33353,
+34125,
+34440,
+35069,
+36049,
+36414,
+35461,
+36830,
+37155,
+36271,
+36373,
+35862,
+36487,
+35699,
+35229,
+35057,
+34637,
+34751,
+33807,
+34020,
+34322,
+34333,
+33476,
+33248,
+33667,
+34086,
+33703,
+34037,
+35147,
+35941,
+36534,
+37012,
+37040,
+36391,
+36326,
+35876,
+36105,
+35692,
+35184,
+36417,
+34959,
+34562,
+33916,
+32585,
+33096,
+31513,
+32059,
+30983,
+28980,
+28922,
+28522,
+28095,
+26577,
+26136,
+24922,
+24549,
+25533,
+26327,
+27239,
+27797,
+27838,
+28357,
+29110,
+30201,
+31726,
+32022,
+32791,
+33054,
+34252,
+36320,
+36869,
+38080,
+38484,
+38639,
+38549,
+38841,
+39124,
+37528,
+37291,
+36522,
+35427,
+35211,
+33983,
+32886,
+31919,
+31508,
+30837,
+30385,
+30029,
+28954,
+29254,
+29143,
+29080,
+28661,
+28060,
+28844,
+28722,
+28809,
+29981,
+30868,
+31397,
+31184,
+32312,
+33117,
+33155,
+34016,
+33950,
+34738,
+34097,
+33510,
+35029,
+34986,
+35338,
+35539,
+35190,
+35018,
+33635,
+32807,
+32320,
+31532,
+31426,
+31166,
+30442,
+30558,
+30407,
+30863,
+31319,
+31267,
+32178,
+32112,
+31971,
+33636,
+34475,
+35950,
+35404,
+36200,
+37323,
+36400,
+38014,
+37870,
+39446,
+39369,
+36875,
+37794,
+37728,
+37084,
+36386,
+36142,
+35562,
+33136,
+31187,
+29330,
+28622,
+27120,
+26729,
+26779,
+25260,
+25071,
+25022,
+25882,
+26142,
+26648,
+27951,
+28095,
+30369,
+30208,
+30970,
+32562,
+34823,
+37415,
+36940,
+37624,
+37183,
+38031,
+39535,
+39618,
+39723,
+39046,
+40362,
+41211,
+41270,
+39381,
+37478,
+37216,
+35836,
+35581,
+32741,
+30699,
+30754,
+29880,
+28300,
+29139,
+28825,
+27401,
+28554,
+28069,
+27229,
+27698,
+28184,
+27257,
+28935,
+28837,
+30475,
+32501,
+29877,
+31164,
+35109,
+35219,
+34150,
+34208,
+34744,
+35152,
+36582,
+36039,
+33574,
+34334,
+34049,
+33009,
+33272,
+34300,
+31239,
+28795,
+28850,
+28831,
+29774,
+28746,
+25969,
+25531,
+27142,
+27429,
+27006,
+29973,
+30487,
+29432,
+31048,
+31795,
+32722,
+35006,
+35419,
+36667,
+38127,
+38820,
+40597,
+39840,
+40980,
+38202,
+38326,
+40380,
+38443,
+40397,
+39706,
+36505,
+35331,
+34894,
+34085,
+30535,
+29162,
+27346,
+24072,
+25479,
+25583,
+24644,
+23876,
+23832,
+24348,
+24437,
+25736,
+25645,
+24183,
+26187,
+26961,
+28015,
+29998,
+30767,
+32659,
+32818,
+35500,
+36546,
+36534,
+37773,
+37655,
+40340,
+39507,
+39357,
+39599,
+38308,
+39134,
+38582,
+38142,
+37493,
+35604,
+35118,
+35062,
+33331,
+33106,
+33807,
+30719,
+29493,
+31483,
+32216,
+29932,
+30275,
+30660,
+30754,
+32812,
+31655,
+31427,
+30694,
+30293,
+33410,
+34299,
+35583,
+38334,
+37463,
+37619,
+37404,
+38766,
+38716,
+36369,
+35553,
+35534,
+36305,
+35680,
+33858,
+33012,
+32147,
+31875,
+29364,
+28715,
+28909,
+28389,
+29315,
+29262,
+29199,
+27946,
+28274,
+28400,
+29847,
+29365,
+29648,
+30789,
+30824,
+33338,
+34739,
+35985,
+35478,
+35098,
+34940,
+33964,
+35712,
+37278,
+38031,
+38095,
+39138,
+39327,
+38807,
+38072,
+37050,
+36252,
+34433,
+34087,
+33399,
+32765,
+32817,
+32452,
+31371,
+30577,
+30699,
+29691,
+28169,
+27772,
+27873,
+27428,
+27603,
+27823,
+27464,
+27973,
+29023,
+30670,
+31352,
+32540,
+32552,
+32766,
+33893,
+33191,
+33078,
+31976,
+30712,
+29539,
+28228,
+26984,
 26330,
+25450,
+23901,
+22918,
+22625,
+22344,
+21670,
+21291,
+20384,
+19599,
+19360,
+18453,
+17855,
+17267,
+17261,
+18506,
+18572,
+19287,
+20870,
+23629,
+26559,
+29143,
+32663,
+36496,
+40574,
+44771,
+48650,
+51495,
+54313,
+56718,
+58540,
+60075,
+61061,
+62662,
+63581,
+63617,
+64932,
+65534,
+65496,
+65172,
+64331,
+62445,
+61931,
+60774,
+57313,
+54137,
+50622,
+46739,
+42964,
+40022,
+36402,
+33705,
+31164,
+28524,
 26243,
-26395,
-26288,
-26417,
-26421,
-26440,
-26551,
-26577,
-26681,
-26756,
-26923,
-26933,
-27013,
-27066,
-26880,
-26931,
-26705,
-26641,
-26465,
-26373,
-26154,
-26042,
-25843,
-25734,
-25553,
-25447,
-25375,
-25159,
-25311,
-25067,
-25290,
-25157,
-25288,
-25225,
-25243,
-25136,
-25177,
-24959,
-25067,
-24824,
-24847,
-24691,
-24602,
-24539,
-24400,
-24340,
-24157,
-24162,
-24047,
-24008,
-24045,
-23876,
-24023,
-23764,
-23826,
-23518,
-23518,
-23207,
-23096,
-22832,
-22696,
-22412,
-22321,
-22055,
-21923,
-21724,
-21543,
-21418,
-21321,
-21260,
-21325,
-21234,
-21327,
-21235,
-21325,
-21324,
-21349,
-21388,
-21439,
-21609,
-21682,
-21987,
-22235,
-22563,
-23010,
-23382,
-23919,
-24490,
-25070,
-25863,
-26421,
-27171,
-27704,
-28347,
-28742,
-29235,
-29518,
-29809,
-30029,
-30207,
-30382,
-30608,
-30802,
-31095,
-31422,
-31738,
-32220,
-32688,
-33286,
-33859,
-34462,
-35100,
-35611,
-36211,
-36716,
-37209,
-37689,
-38118,
-38554,
-39113,
-39596,
-40308,
-40860,
-41680,
-42323,
-43229,
-44074,
-44956,
-45912,
-46729,
-47617,
-48280,
-49011,
-49611,
-50138,
-50589,
-51066,
-51253,
-51732,
-51894,
-52377,
-52644,
-53020,
-53375,
-53752,
-54106,
-54593,
-54924,
-55437,
-55742,
-56081,
-56451,
-56653,
-57009,
-57183,
-57385,
-57605,
-57783,
-57915,
-58226,
-58270,
-58623,
-58693,
-58911,
-58934,
-59069,
-59131,
-59181,
-59043,
-59002,
-58668,
-58447,
-58071,
-57760,
-57319,
-56916,
-56567,
-56031,
-55790,
-55324,
-55125,
-54747,
-54462,
-54059,
-53798,
-53417,
-53133,
-52710,
+24358,
+24291,
+24037,
+22777,
+21869,
+22164,
+22264,
+22673,
+23316,
+22653,
+21639,
+20444,
+19488,
+17783,
+16260,
+15460,
+12905,
+10562,
+8723,
+6470,
+4521,
+2025,
+112,
+65535,
+9,
+65535,
+2,
+4,
+65535,
+3,
+6,
+65535,
+65,
+65535,
+3357,
+9703,
+15122,
+21278,
+27483,
+35069,
+45158,
+52417,
+56214,
+61975,
+65534,
+65452,
+65534,
+65534,
+65514,
+65534,
+65507,
+65534,
+65534,
+65496,
+65534,
+65377,
+65534,
+63445,
+59465,
+56689,
+50305,
+43579,
+38303,
+33973,
+29972,
+26065,
+22543,
+20400,
+18412,
+14747,
+12991,
+13051,
+14411,
+15592,
+16570,
+19192,
+22739,
+27537,
+32090,
+37168,
+43893,
+48354,
+52679,
+58622,
+63164,
+65499,
+65534,
+65481,
+65534,
+65452,
+65534,
+64297,
+59976,
+54389,
+48403,
+42648,
+36986,
+31757,
+26550,
+21198,
+15938,
+10297,
+6066,
+2078,
+65535,
+67,
+65535,
+11,
+1,
+65535,
+6,
+65535,
+1,
+65535,
+9,
+65535,
+49,
+65535,
+126,
+65535,
+247,
+65535,
+1380,
+11613,
+21861,
+30729,
+39190,
+48196,
+59354,
+65534,
+65534,
+65503,
+65534,
+65485,
+65534,
+65490,
+65534,
+65501,
+65534,
+65533,
+65493,
+65534,
+63789,
+59795,
+54951,
+52417,
+49368,
+47319,
+47828,
+42625,
+37717,
+33962,
+30174,
+27897,
+24153,
+20505,
+17942,
+15109,
+10566,
+8977,
+8847,
+8070,
+8716,
+10177,
+13345,
+17335,
+24263,
+30693,
+36353,
+43051,
+47719,
+55158,
+62331,
+65160,
+65534,
+65450,
+65534,
+65509,
+65529,
+65534,
+65434,
+65534,
+62404,
+55592,
+49713,
+44624,
+39337,
+33140,
+27039,
+22632,
+19489,
+15539,
+12728,
+9851,
+6347,
+3788,
+992,
+65535,
+51,
+65535,
+21,
+65535,
+5,
+65535,
+65535,
+6,
+65535,
+28,
+65535,
+77,
+65535,
+164,
+65535,
+1397,
+10787,
+23306,
+34544,
+46803,
+60976,
+65534,
+65226,
+65534,
+65442,
+65534,
+65518,
+65534,
+65518,
+65534,
+65460,
+65534,
+64011,
+58380,
+52057,
+47706,
+45788,
+42150,
+40156,
+42019,
+39562,
+35835,
+34510,
+33353,
+32496,
+29486,
+25787,
+24158,
+20610,
+15816,
+13434,
+10897,
+8050,
+6468,
+6966,
+9380,
+10918,
+15269,
+22094,
+28121,
+33342,
+39829,
+48998,
+57028,
+63896,
+65534,
+65342,
+65534,
+65468,
+65534,
+65505,
+65534,
+65456,
+65534,
+61755,
+54298,
+47975,
+40762,
+33220,
+26533,
+22861,
+20412,
+17827,
+16913,
+15811,
+15627,
+15989,
+16910,
+18391,
+18970,
+18506,
+14623,
+11229,
+6807,
+794,
+65535,
+82,
+65535,
+42,
+65535,
+22,
+65535,
+59,
+65535,
+207,
+65535,
+5140,
+16003,
+26375,
+41046,
+51890,
+59595,
+65503,
+65492,
+65531,
+65534,
+65516,
+65532,
+65534,
+65459,
+65534,
+63753,
+57180,
+52321,
+49457,
+46794,
+42901,
+40127,
+41669,
+40488,
+36721,
+35234,
+34384,
+32626,
+28972,
+25553,
+24158,
+20545,
+15660,
+13271,
+10573,
+6642,
+4757,
+5336,
+6685,
+6012,
+6791,
+13612,
+19619,
+23657,
+28363,
+34638,
+41603,
+46079,
+56365,
+64124,
+64415,
+65534,
+65534,
+65487,
+65534,
+65495,
+65534,
+65391,
+60552,
+55203,
+53576,
+46728,
+38193,
+34494,
+32728,
+29483,
+27016,
+27702,
+26078,
+23407,
+23034,
+23235,
+24079,
+24185,
+21470,
+18456,
+14171,
+9320,
+6923,
+2178,
+65535,
+219,
+65535,
+101,
+65535,
+69,
+65535,
+41,
+65535,
+4,
+5269,
+12085,
+22692,
+35343,
+43001,
+49969,
+58997,
+65328,
+65534,
+65446,
+65534,
+65461,
+65534,
+65527,
+65479,
+65534,
+61430,
+55239,
+52794,
+48163,
+40918,
+38540,
+37367,
+32194,
+27182,
+23621,
+21809,
+19507,
+14558,
+11841,
+10434,
+6662,
+4727,
+5474,
+5180,
+4164,
+4988,
+8908,
+12903,
+15009,
+20685,
+27972,
+34156,
+39224,
+44470,
 52377,
-51760,
-51268,
-50676,
-50137,
-49635,
-49032,
-48546,
-47818,
-47346,
-46734,
-46195,
-45669,
-45024,
-44427,
-43740,
-43119,
-42411,
-41901,
-41128,
-40616,
-39820,
-39331,
-38646,
-38181,
-37758,
-37231,
-37025,
-36411,
-36230,
-35678,
-35456,
-34903,
-34568,
-33908,
-33482,
-32735,
-32308,
-31671,
-31112,
-30518,
-29918,
-29322,
-28766,
-28279,
-27749,
-27392,
-26974,
-26597,
-26261,
-25958,
-25685,
-25401,
-25202,
-24822,
-24738,
-24380,
-24403,
-24183,
-24203,
-24139,
-24136,
-24095,
-24136,
-24162,
-24180,
-24294,
-24314,
-24404,
-24470,
-24536,
-24559,
-24625,
-24557,
-24650,
-24489,
-24627,
-24602,
-24802,
-24891,
-25024,
-25199,
-25381,
-25597,
-25845,
-26063,
-26376,
-26728,
-27018,
-27416,
-27814,
-28103,
-28456,
-28833,
-29012,
+58490,
+63963,
+65534,
+65319,
+65534,
+65429,
+65534,
+65438,
+65534,
+65379,
+65534,
+64148,
+57332,
+51836,
+45753,
+39286,
+33185,
+28496,
+25989,
+23581,
+22711,
+21055,
+19673,
+18900,
+18779,
+20433,
+20850,
+18674,
+15913,
+13679,
+11260,
+9909,
+5361,
+104,
+7,
+22,
+65535,
+54,
+65535,
+75,
+65535,
+140,
+65535,
+1086,
+5606,
+12851,
+21666,
+28214,
+34884,
+41448,
+49255,
+56688,
+59866,
+61667,
+64059,
+65486,
+65243,
+63971,
+62681,
+61501,
+58852,
+57913,
+57838,
+54896,
+52238,
+51826,
+50429,
+47010,
+42261,
+38573,
+36403,
+31346,
+24955,
+21622,
+18114,
+13451,
+10451,
+9184,
+7389,
+5846,
+6433,
+9251,
+11718,
+13988,
+18815,
+24495,
+28997,
+32975,
+38957,
+44646,
+50997,
+56647,
+60729,
+65041,
+65534,
+65445,
+65534,
+65462,
+65534,
+65416,
+65534,
+63905,
+59719,
+53607,
+46326,
+40549,
+35389,
+30514,
+26690,
+23776,
+20594,
+17785,
+15521,
+13773,
+13654,
+13858,
+12061,
+9477,
+6802,
+3134,
+1271,
+742,
+65535,
+36,
+65535,
+12,
+65535,
+2,
+15,
+65535,
+77,
+99,
+6975,
+15506,
+20555,
+31127,
+41545,
+48838,
+56042,
+62840,
+65534,
+65380,
+65534,
+65526,
+65510,
+65534,
+65472,
+65534,
+64107,
+59033,
+54138,
+52514,
+50104,
+44535,
+41451,
+40161,
+37958,
+34114,
+29422,
+27896,
+25780,
+19859,
+15908,
+14396,
+11417,
+8591,
+7407,
+7134,
+6396,
+6802,
+9468,
+13608,
+16619,
+18932,
+24678,
+31155,
+34957,
+38742,
+44634,
+50866,
+55409,
+61400,
+65513,
+65466,
+65534,
+65532,
+65508,
+65534,
+65444,
+65534,
+63669,
+58612,
+53539,
+48270,
+41931,
+36253,
+32365,
+29437,
+26829,
+24302,
+22578,
+21446,
+20202,
+18926,
+18801,
+18445,
+16685,
+13692,
+9973,
+5535,
+1125,
+65535,
+61,
+65535,
+27,
+65535,
+4,
+3,
+65535,
+15,
+65535,
+38,
+65535,
+880,
+8288,
+21399,
+33777,
+44610,
+54523,
+63062,
+65534,
+65335,
+65534,
+65472,
+65534,
+65524,
+65528,
+65534,
+65491,
+65534,
+65406,
+65534,
+62720,
+56539,
+53077,
+50791,
+47425,
+41640,
+36091,
+32636,
+27933,
+21231,
+17221,
+14004,
+8661,
+3640,
+322,
+65535,
+29,
+65535,
+2,
+61,
+1345,
+4571,
+11356,
+18710,
+24480,
+29789,
+38354,
+47223,
+53800,
+62953,
+65534,
+65218,
+65534,
+65394,
+65534,
+65479,
+65534,
+65534,
+65493,
+65534,
+62620,
+57082,
+49933,
+41687,
+35264,
+31474,
+27247,
+23105,
+21285,
+19291,
+16603,
+14075,
+13539,
+13557,
+11488,
+8073,
+3727,
+401,
+65535,
+43,
+65535,
+23,
+65535,
+14,
+65535,
+21,
+65535,
+38,
+65535,
+71,
+65535,
+726,
+9218,
+23451,
+36026,
+48105,
+60319,
+65534,
+65471,
+65534,
+65532,
+65523,
+65534,
+65529,
+65524,
+65534,
+65471,
+65534,
+65388,
+65534,
+64303,
+58465,
+53612,
+49690,
+45972,
+40248,
+33833,
+29769,
+25066,
+18637,
+13716,
+10755,
+6059,
+1397,
+65535,
+64,
+65535,
+25,
+65535,
+58,
+1544,
+4195,
+10097,
+17483,
+22576,
+27480,
+33335,
+41387,
+48473,
+56313,
+64489,
+65534,
+65399,
+65534,
+65444,
+65534,
+65492,
+65534,
+65534,
+65479,
+65534,
+64302,
+59298,
+51106,
+43752,
+38708,
+33940,
+28560,
+23913,
+20233,
+15153,
+9525,
+6401,
+5541,
+2807,
+155,
+65535,
+9,
+65535,
+10,
+65535,
+2,
+2,
+65535,
+65535,
+21,
+65535,
+103,
+65535,
+294,
+65535,
+2310,
+12313,
+25471,
+39901,
+53089,
+64078,
+65534,
+65247,
+65534,
+65389,
+65534,
+65471,
+65534,
+65492,
+65534,
+65470,
+65534,
+65441,
+65534,
+64826,
+56701,
+46805,
+38061,
+30084,
+22194,
+12682,
+6177,
+1387,
+65535,
+155,
+65535,
+38,
+0,
+65535,
+51,
+65535,
+68,
+65535,
+327,
+5085,
+10798,
+17904,
+27665,
+36547,
+44220,
+51508,
+60786,
+65534,
+65403,
+65534,
+65518,
+65526,
+65534,
+65507,
+65534,
+65492,
+65534,
+65455,
+65534,
+65385,
+65534,
+64466,
+56481,
+46474,
+36861,
+28454,
+20194,
+12974,
+7232,
+1298,
+65535,
+131,
+65535,
+59,
+65535,
+17,
+65535,
+0,
+2,
+65535,
+2,
+65535,
+10,
+65535,
+44,
+65535,
+99,
+65535,
+162,
+65535,
+908,
+10113,
+22168,
+35775,
+49058,
+60463,
+65534,
+65338,
+65534,
+65523,
+65507,
+65534,
+65482,
+65534,
+65491,
+65534,
+65534,
+65467,
+65534,
+61915,
+54083,
+45791,
+38930,
+32459,
+26078,
+19135,
+12641,
+9292,
+5301,
+1052,
+65535,
+47,
+65535,
+65535,
+45,
+65535,
+66,
+65535,
+319,
+5183,
+10838,
+16939,
+25393,
+34526,
+42825,
+50692,
+60294,
+65534,
+65490,
+65534,
+65534,
+65508,
+65534,
+65499,
+65534,
+65490,
+65534,
+65485,
+65534,
+65516,
+65512,
+65489,
+59669,
+51042,
+41713,
+33021,
+27377,
+21032,
+15863,
+11881,
+8631,
+4617,
+853,
+1,
+65535,
+65535,
+5,
+65535,
+6,
+65535,
+4,
+65535,
+65535,
+8,
+65535,
+35,
+65535,
+76,
+65535,
+142,
+65535,
+1480,
+13433,
+28346,
+42630,
+58856,
+65534,
+65353,
+65534,
+65493,
+65534,
+65533,
+65534,
+65520,
+65534,
+65490,
+65534,
+65482,
+65534,
+65158,
+58316,
+50129,
+43730,
+37530,
+31501,
+24977,
+19418,
+12461,
+6304,
+1519,
+65535,
+156,
+65535,
+55,
+65535,
+7,
+13,
+65535,
+88,
+65535,
+266,
+65535,
+3227,
+14236,
+26517,
+38876,
+50751,
+62386,
+65534,
+65259,
+65534,
+65433,
+65534,
+65509,
+65534,
+65529,
+65534,
+65534,
+65524,
+65534,
+65467,
+65534,
+65310,
+65534,
+61794,
+50983,
+41882,
+34031,
+27184,
+20442,
+13708,
+8032,
+2581,
+65535,
+23,
+65535,
+65535,
+9,
+65535,
+12,
+65535,
+5,
+0,
+65535,
+12,
+65535,
+28,
+65535,
+34,
+65535,
+24,
+65535,
+97,
+8480,
+25120,
+40591,
+55985,
+65534,
+65504,
+65497,
+65534,
+65464,
+65534,
+65485,
+65534,
+65495,
+65534,
+65458,
+65534,
+65347,
+65534,
+63177,
+54524,
+47486,
+40924,
+34862,
+29687,
+24317,
+19908,
+13406,
+7196,
+1914,
+65535,
+161,
+65535,
+32,
+2,
+65535,
+44,
+65535,
+67,
+65535,
+73,
+65535,
+361,
+9471,
+25047,
+39065,
+53347,
+64384,
+65534,
+65356,
+65534,
+65435,
+65534,
+65485,
+65534,
+65513,
+65534,
+65531,
+65522,
+65534,
+65464,
+65534,
+65321,
+65534,
+62556,
+53557,
+46576,
+38481,
 29519,
-29654,
-30116,
-30431,
-30756,
-31253,
-31487,
-31892,
-32134,
-32419,
-32624,
-32907,
-33020,
-33286,
-33439,
-33640,
-33752,
-33948,
-34084,
-34304,
-34436,
-34682,
-34925,
-35188,
-35525,
-35785,
-36080,
-36339,
-36588,
-36671,
-36921,
-36894,
-37163,
-37116,
-37250,
-37339,
-37450,
-37626,
-37738,
-37958,
-38070,
-38314,
-38444,
-38693,
-38907,
-39027,
-39172,
-39226,
-39218,
-39157,
-39088,
-38911,
-38889,
-38691,
-38688,
-38581,
-38622,
-38691,
-38666,
-38824,
-38843,
-38959,
-39040,
-39071,
-39239,
-39225,
-39241,
-39200,
-39134,
-39021,
-38913,
-38687,
-38736,
-38467,
-38558,
-38358,
-38533,
-38448,
-38511,
-38536,
-38401,
-38469,
-38202,
-38204,
-37934,
-37718,
-37536,
-37163,
-36917,
-36519,
-36210,
-35942,
-35568,
-35411,
-35123,
-34949,
-34855,
-34640,
-34610,
-34420,
-34233,
-34131,
-33814,
-33642,
-33283,
-33067,
-32684,
-32424,
-32044,
-31734,
-31450,
-31110,
-30920,
+23794,
+19581,
+14244,
+8657,
+5670,
+3817,
+1057,
+65535,
+67,
+65535,
+18,
+65535,
+3,
+2,
+4,
+65535,
+10,
+65535,
+13,
+65535,
+65535,
+53,
+65535,
+234,
+65535,
+4190,
+17914,
+33429,
+49013,
+61855,
+65534,
+65355,
+65534,
+65496,
+65534,
+65532,
+65530,
+65532,
+65534,
+65531,
+65529,
+65534,
+65471,
+65534,
+63048,
+58350,
+54139,
+50995,
+48465,
+44698,
+41365,
+37261,
+31084,
+22983,
+14779,
+5957,
+9,
+7,
+28,
+65535,
+25,
+5,
+65535,
+87,
+65535,
+190,
+65535,
+2201,
+16788,
+33971,
+51868,
+64883,
+65534,
+65452,
+65534,
+65449,
+65534,
+65491,
+65534,
+65534,
+65528,
+65526,
+65534,
+65432,
+65534,
+61107,
+52461,
+45533,
+39653,
+35145,
+30854,
+26521,
+23328,
+20550,
+18115,
+17394,
+17711,
+17415,
+16928,
+15132,
+13682,
+12950,
+10451,
+7722,
+4002,
+397,
+65535,
+59,
+65535,
+29,
+65535,
+65535,
+22,
+65535,
+57,
+65535,
+82,
+65535,
+418,
+7446,
+17699,
+25935,
+34304,
+42141,
+48327,
+53419,
+56229,
+59856,
+61146,
+62620,
+63118,
+62869,
+63781,
+63190,
+64272,
+65173,
+65534,
+65534,
+65506,
+65534,
+65527,
+65514,
+65534,
+65444,
+65534,
+61779,
+53113,
+44319,
+32820,
+20493,
+7108,
+65535,
+209,
+65535,
+47,
+65535,
+25,
+65535,
+35,
+65535,
+639,
+12242,
+28839,
+43707,
+59423,
+65534,
+65328,
+65534,
+65481,
+65534,
+65534,
+65483,
+65534,
+65436,
+65534,
+65378,
+65534,
+63791,
+55309,
+49623,
+44827,
+39454,
+35913,
 30580,
-30474,
-30207,
-30071,
-29833,
-29696,
-29387,
-29210,
-28833,
-28479,
-28103,
-27637,
-27304,
-26908,
-26439,
-26156,
-25641,
-25469,
-25089,
-24846,
-24604,
-24380,
-24095,
-23982,
-23649,
-23542,
-23271,
-23055,
-22808,
-22475,
-22257,
-21943,
-21725,
-21479,
-21302,
-21060,
-20992,
-20705,
-20771,
-20592,
-20530,
-20437,
-20240,
-20196,
-20016,
-19930,
-19885,
-19641,
-19621,
-19395,
-19289,
-19108,
-19022,
-18845,
-18819,
-18582,
-18464,
-18381,
-18245,
-18268,
-18158,
-18024,
-18046,
-17848,
-17935,
-17893,
-17956,
-18004,
-17956,
-18026,
-17979,
-18025,
-18090,
-18092,
-18178,
-18181,
-18288,
-18403,
-18599,
-18667,
-18978,
-19063,
-19245,
-19440,
-19532,
-19774,
-19929,
-20129,
-20217,
-20284,
-20328,
-20350,
-20350,
-20439,
-20372,
+27288,
+23229,
+19329,
+16103,
+11932,
+9145,
+5733,
+4400,
+5812,
+7155,
+8804,
+11482,
+13363,
+16061,
+18334,
+19280,
+20941,
+19949,
+17533,
+15761,
+12456,
+7331,
+1835,
+65535,
+120,
+65535,
+17,
+19,
+65535,
+103,
+65535,
+236,
+65535,
+1269,
+8671,
+17975,
+27286,
+34682,
+42597,
+49761,
+56976,
+62713,
+65135,
+65534,
+65445,
+65534,
+65505,
+65534,
+65522,
+65534,
+65511,
+65534,
+65493,
+65534,
+65475,
+65534,
+65195,
+59898,
+52441,
+45528,
+36724,
+26868,
+15979,
+3873,
+65535,
+218,
+65535,
+65535,
+56,
+65535,
+70,
+65535,
+590,
+13433,
+31753,
+50199,
+64455,
+65534,
+65391,
+65534,
+65420,
+65534,
+65458,
+65534,
+65450,
+65534,
+65327,
+65534,
+62734,
+50513,
+36659,
+26503,
+17079,
+9924,
+7562,
+4917,
+3597,
+3460,
+3886,
+5838,
+7407,
+10560,
+13795,
+15080,
+16897,
+19570,
+22755,
+27109,
+30565,
+34303,
+37821,
+37976,
+38047,
+36594,
+34497,
+32337,
+27334,
+21592,
+14577,
+6154,
+409,
+65535,
+87,
+65535,
+48,
+65535,
+15,
+65535,
+65535,
+17,
+65535,
+1720,
+11786,
+23296,
+29908,
+38280,
+43241,
+46097,
+49412,
+50962,
+51290,
+51551,
+51329,
+51632,
+53976,
+56320,
+62490,
+65534,
+65350,
+65534,
+65440,
+65534,
+65433,
+65534,
+65330,
+65534,
+63790,
+52809,
+39000,
+25195,
+10257,
+473,
+65535,
+57,
+65535,
+26,
+65535,
+45,
+352,
+12094,
+29037,
+46071,
+62279,
+65534,
+65295,
+65534,
+65481,
+65500,
+65534,
+65308,
+65534,
+63561,
+52006,
+39530,
+28983,
+20303,
+13244,
+9237,
+8699,
+10059,
+13672,
+18170,
+26014,
+33915,
+41643,
+50442,
+57649,
+63798,
+65534,
+65359,
+65534,
+64778,
+60657,
+54769,
+47718,
+38894,
+30133,
+23391,
+18300,
+13377,
+9953,
+8041,
+7335,
+7506,
+7357,
+9066,
+10221,
+9917,
+9245,
+6233,
+2158,
+65535,
+13,
+20,
+65535,
+77,
+65535,
+171,
+65535,
+304,
+65535,
+1006,
+10011,
+21981,
+35486,
+42527,
+50823,
+56472,
+57126,
+60154,
+61843,
+65005,
+65534,
+65414,
+65534,
+65465,
+65534,
+65492,
+65534,
+65446,
+65534,
+65294,
+65534,
+64045,
+58672,
+52279,
+42648,
+32675,
+21295,
+11841,
+4577,
+190,
+65535,
+526,
+1676,
+6724,
+13511,
 20462,
-20481,
-20529,
-20725,
-20816,
-21060,
-21079,
-21283,
-21233,
-21394,
-21367,
-21480,
-21415,
-21411,
-21349,
-21168,
-21191,
-21085,
-21164,
-21153,
-21342,
-21395,
-21655,
-21879,
-22166,
-22454,
-22700,
-22872,
-23099,
-23161,
-23320,
-23428,
-23496,
-23516,
-23475,
-23359,
-23411,
-23382,
-23475,
-23582,
-23718,
-23959,
-24074,
-24511,
-24673,
-24997,
-25205,
-25352,
-25448,
-25531,
-25600,
-25644,
-25666,
-25643,
-25623,
-25576,
-25578,
-25667,
-25753,
-25955,
-26020,
-26218,
-26401,
-26613,
-26824,
-27121,
-27134,
-27411,
-27353,
-27546,
-27616,
-27749,
-27923,
-27927,
-28124,
-28102,
-28480,
-28676,
-29146,
-29584,
-30032,
-30780,
-31382,
-32200,
-32953,
-33684,
-34415,
-34969,
-35522,
-36077,
-36496,
+29243,
+35397,
+42861,
+46589,
+47376,
+48162,
+45117,
+41824,
+37309,
+32258,
+28098,
+24359,
+20652,
+20339,
+22005,
+26251,
+33030,
+40385,
+50113,
+59054,
+64933,
+65534,
+65405,
+65534,
+65445,
+65534,
+65411,
+65534,
+63762,
+56614,
+47547,
+42096,
+38700,
+34374,
+29922,
+25167,
+22734,
+19022,
+15472,
+13066,
+9271,
+7103,
+3879,
+2856,
+4272,
+5200,
+9175,
+14292,
+19396,
+23657,
+24772,
+26096,
+25488,
+21577,
+18461,
+12142,
+3769,
+25,
+65535,
+41,
+65535,
+5,
+46,
+65535,
+231,
+65535,
+581,
+65535,
+5590,
+25350,
+39203,
+55624,
+65534,
+65206,
+65534,
+65438,
+65534,
+65534,
+65504,
+65534,
+65510,
+65534,
+65530,
+65527,
+65534,
+65523,
+65534,
+65528,
+65534,
+65532,
+65534,
+65192,
+57214,
+41000,
+27781,
+13692,
+1172,
+65535,
+196,
+65535,
+168,
+65535,
+82,
+5,
+65535,
+5310,
+12933,
+21765,
+29390,
+34953,
+41949,
+45307,
+48822,
+52423,
+54627,
+59544,
+64496,
+65534,
+65457,
+65534,
+65484,
+65534,
+65478,
+65534,
+65497,
+65530,
+65534,
+65335,
+65534,
+54963,
+36908,
+21559,
+5482,
+65535,
+262,
+65535,
+101,
+65535,
+12,
+35,
+65535,
+685,
+4630,
+12016,
+15546,
+17663,
+21925,
+24837,
+28732,
+31613,
+35287,
+40284,
+43603,
+46944,
+49160,
+49248,
+48804,
+45190,
+39381,
+32184,
+22797,
+16260,
+9531,
+4758,
+2393,
+65535,
+42,
+12,
+65535,
+70,
+65535,
+93,
+65535,
+49,
+27,
+65535,
+399,
+65535,
+8508,
+20096,
+30001,
+43340,
+52362,
+63180,
+65534,
+65150,
+65534,
+65374,
+65534,
+65517,
+65526,
+65525,
+65534,
+65306,
+65534,
+61398,
+53855,
+45668,
+38557,
+32754,
+26416,
+27217,
+25866,
+24913,
+30591,
+32522,
+33222,
+34750,
+32739,
+31542,
+24736,
+18977,
+17275,
+12128,
+11572,
+11772,
+15104,
+20126,
+26623,
+38640,
+51547,
+63347,
+65534,
+65294,
+65534,
+65448,
+65534,
+65464,
+65534,
+58381,
+44463,
+30644,
+17952,
+6011,
+65535,
+69,
+65535,
+75,
+65535,
+2326,
+7089,
+9420,
+9513,
+6813,
+2824,
+84,
+96,
+65535,
+1663,
+11433,
+21436,
+35393,
+55782,
+65534,
+65457,
+65534,
+65534,
+65521,
+65534,
+65534,
+65499,
+65534,
+65423,
+65534,
+62682,
+54251,
+49047,
+45886,
+43417,
+43153,
+37392,
+30119,
+18783,
+2950,
+65535,
+347,
+65535,
+184,
+65535,
+73,
+65535,
+65535,
+89,
+65535,
+266,
+65535,
+596,
+65535,
+4266,
+31890,
+58001,
+65534,
+65412,
+65527,
+65534,
+65478,
+65534,
+65495,
+65534,
+65502,
+65534,
+65477,
+65534,
+65422,
+65534,
+65400,
+65534,
+65534,
+65298,
+65534,
+49331,
+24350,
+6325,
+65535,
+450,
+65535,
+64,
+9,
+65535,
+52,
+65535,
+22,
+2,
+65535,
+65,
+65535,
+122,
+65535,
+139,
+65535,
+921,
+15181,
+35073,
+55094,
+65534,
+65260,
+65534,
+65476,
+65534,
+65439,
+65534,
+65256,
+65534,
+63249,
+49530,
+38583,
+31729,
+26557,
+25444,
+25170,
+25345,
+25829,
+25619,
+25779,
+22085,
+16666,
+10680,
+2245,
+65535,
+118,
+26,
+65535,
+4966,
+18575,
+32269,
+47074,
+61719,
+65534,
+65167,
+65534,
+65189,
+65534,
+63453,
+55045,
+47931,
+40350,
+37452,
+38491,
+39779,
+43724,
+46052,
+46745,
+43968,
+36294,
+28644,
+19124,
+6975,
+218,
+65535,
+38,
+65535,
+35,
+65535,
+35,
+65535,
+40,
+65535,
+20,
+12,
+65535,
+152,
+65535,
+445,
+65535,
+16513,
+53003,
+65534,
+65019,
+65534,
+65295,
+65534,
+65332,
+65534,
+65136,
+65534,
+60836,
+44513,
+35612,
+34468,
+36851,
+41687,
+44766,
+50383,
+51531,
+42296,
+33935,
+20339,
+6139,
+825,
+65535,
+172,
+65535,
+190,
+5494,
+13610,
+24834,
+38489,
+51470,
+63273,
+65534,
+65261,
+65534,
+64977,
+61151,
+51763,
+47238,
+47043,
+47346,
+50773,
+52304,
+54457,
+55457,
+50926,
+47860,
+44680,
+37205,
+29180,
+19207,
+8162,
+858,
+65535,
+172,
+65535,
+77,
+65535,
+103,
+3899,
+9501,
+14204,
+20200,
+25266,
+30765,
+37264,
+42774,
+49509,
+54320,
+59299,
+64928,
+65534,
+65464,
+65534,
+65513,
+65532,
+65534,
+65518,
+65534,
+65420,
+60735,
+55373,
+50540,
+46147,
+44104,
+41210,
+39047,
+35735,
+32851,
+30099,
+24247,
+18156,
+8787,
+673,
+65535,
+76,
+65535,
+52,
+65535,
+24,
+65535,
+13,
+65535,
+457,
+348,
+65535,
+30,
+65535,
+20,
+65535,
+40,
+65535,
+70,
+65535,
+78,
+65535,
+33,
+12388,
+39987,
+62469,
+65534,
+65293,
+65534,
+65442,
+65534,
+63033,
+53126,
+44028,
+50520,
+58087,
+63360,
+65534,
+65180,
+65534,
+65385,
+65534,
+65294,
+65534,
+53940,
+21527,
+377,
+105,
+65535,
+65535,
+178,
+65535,
+12691,
+27146,
+32382,
+30621,
+21836,
+9008,
+33,
+65535,
+120,
+65535,
+299,
+65535,
+1939,
+19886,
+50120,
+65534,
+65322,
+65534,
+65534,
+65471,
+65534,
+65475,
+65534,
+65511,
+65534,
+65513,
+65534,
+64526,
+61549,
+55698,
+47257,
+36157,
+26083,
+13292,
+1058,
+65535,
+223,
+65535,
+213,
+65535,
+156,
+65535,
+469,
+9904,
+19785,
+25104,
+27349,
+24937,
+23084,
+23743,
+27762,
+34643,
+44730,
+57679,
+65345,
+65534,
+65456,
+65534,
+65317,
+65534,
+65060,
+65534,
+60749,
+42349,
+27052,
+14506,
+9240,
+12878,
+19512,
+26638,
+29123,
+29227,
+24794,
+16873,
+7899,
+799,
+65535,
+223,
+65535,
+811,
+5564,
+9842,
+12936,
+15407,
+15580,
+13566,
+11036,
+8574,
+4973,
+1000,
+65535,
+142,
+65535,
+188,
+65535,
+343,
+65535,
+4687,
+23439,
+36723,
+47930,
+50347,
+36093,
+18864,
+1963,
+65535,
+65535,
+3250,
+28841,
+56840,
+65534,
+65192,
+65534,
+65505,
+65513,
+65534,
+65485,
+65534,
+65498,
+65534,
+65534,
+65490,
+65534,
+65397,
+65534,
+65203,
+65534,
+57272,
+23421,
+204,
+155,
+65535,
+149,
+65535,
+465,
+65535,
+6329,
+26092,
 36964,
-37314,
-37562,
-37848,
-37935,
-38272,
-38399,
-38647,
-38977,
-39178,
-39641,
-39909,
-40439,
-40795,
-41413,
-41704,
-42231,
-42591,
-43051,
-43432,
-43783,
-44182,
-44472,
-44847,
-45268,
-45602,
-46239,
-46668,
-47280,
-47951,
-48545,
-49255,
-49877,
-50493,
-51051,
-51425,
-51980,
-52266,
-52757,
-53018,
-53421,
-53552,
-53927,
-54041,
-54260,
-54460,
-54639,
-54813,
-55103,
-55236,
-55632,
-55904,
-56228,
-56435,
-56717,
+42028,
+38039,
+25505,
+13773,
+4053,
+65535,
+60,
+65535,
+357,
+9296,
+24613,
+42693,
+60540,
+65534,
+65321,
+65488,
+65534,
+58107,
+43679,
+33620,
+29335,
+33400,
+46348,
+61915,
+65534,
+65273,
+65534,
+65383,
+65387,
+53254,
+34102,
+20053,
+10921,
+6774,
+6080,
+11383,
+20196,
+29797,
+39172,
+45612,
+45837,
+37833,
+24933,
+7500,
+65535,
+360,
+65535,
+65535,
+11117,
+35709,
+57970,
+65534,
+65346,
+65481,
+65534,
+61879,
+52576,
+45857,
+41445,
+36939,
+34356,
+32828,
+32784,
+35001,
+37808,
+41877,
+45499,
+46998,
+46915,
+43394,
+36080,
+27096,
+19705,
+15464,
+12901,
+12742,
+12831,
+9302,
+2429,
+65535,
+121,
+65535,
+65535,
+59,
+65535,
+65535,
+101,
+416,
+25538,
+59091,
+65534,
+65088,
+54227,
+30705,
+18002,
+12630,
+29526,
+61214,
+65534,
+64924,
+65534,
+65061,
+65534,
+64920,
+65534,
+55407,
+23593,
+1698,
+62,
+65535,
+2970,
+19012,
+40006,
+58815,
+65534,
+62345,
+46039,
+17284,
+65535,
+65535,
+245,
+65535,
+620,
+65535,
+5529,
+32641,
+52950,
+58247,
+57276,
+47433,
+35530,
+28415,
+31659,
+40577,
+51784,
+63303,
+65534,
+65280,
+65534,
+65349,
+65534,
+65401,
+65534,
+64975,
+54900,
+42272,
+34392,
+31822,
+35963,
+42767,
+49548,
+54413,
+54934,
+46632,
+30134,
+14109,
+3379,
+65535,
+239,
+8045,
+24541,
+40017,
+50823,
+54481,
+48636,
+35933,
+21255,
+8869,
+2833,
+3491,
+11625,
+22905,
+34692,
+46887,
+54442,
+58027,
+57031,
+49697,
+37142,
+24267,
+11821,
+1784,
+65535,
+2379,
+14839,
+32488,
+51841,
+65096,
+65374,
+65534,
+63577,
+51356,
+38325,
+32894,
+35172,
+42959,
+56186,
+65086,
+65534,
+65228,
+65534,
+61117,
+45086,
+29179,
+14348,
+2252,
+65535,
+135,
+65535,
+78,
+65535,
+64,
+65535,
+22,
+37,
+65535,
+292,
+65535,
+888,
+65535,
+10693,
+37799,
+40355,
+24582,
+4515,
+65535,
+1179,
+65535,
+31951,
+65534,
+65160,
+65534,
+65534,
+65346,
+65534,
+65340,
+65534,
+65421,
+65534,
+65485,
+65534,
+65534,
+65466,
+65534,
+65224,
+65534,
+58407,
+37552,
+13330,
+65535,
+197,
+65535,
+65535,
+180,
+65535,
+15690,
+36354,
+38709,
+28686,
+11316,
+65535,
+522,
+65535,
+8105,
+37930,
+62137,
+65534,
+65177,
+65534,
+65258,
+65534,
+62927,
 56831,
-57096,
-57229,
-57473,
-57715,
-57829,
-58112,
-58184,
-58423,
-58691,
-58714,
-59111,
-58978,
-59334,
-59266,
-59400,
-59466,
-59266,
-59246,
-58910,
-58605,
-58355,
-57942,
-57756,
-57322,
-57092,
-56677,
-56410,
-55964,
-55681,
-55255,
-54883,
-54525,
-54109,
-53858,
-53555,
-53241,
-52931,
-52425,
-52043,
-51450,
-51048,
-50453,
-50116,
-49545,
-49209,
-48704,
-48257,
-47904,
-47261,
-46797,
-46132,
-45424,
-44846,
-44051,
-43517,
-42811,
-42212,
-41523,
-40929,
-40371,
-39821,
-39376,
-39001,
-38577,
-38338,
-37822,
-37565,
-37047,
-36633,
-36162,
-35480,
-35123,
-34349,
-33993,
-33309,
-32796,
-32226,
+53824,
+51772,
+50273,
+49173,
+46772,
+47977,
+52053,
+53674,
+50787,
+44450,
+32173,
+9767,
+65535,
+471,
+65535,
+65535,
+323,
+65535,
+4311,
+14794,
+17117,
+11946,
+2471,
+65535,
+127,
+663,
+13929,
+32665,
+52844,
+65380,
+65445,
+65534,
+65509,
+65534,
+65427,
+65534,
+63556,
+55670,
+49546,
+44793,
+42310,
+43387,
+43830,
+40425,
+34226,
+28696,
+23495,
+19361,
+19541,
+27981,
+41080,
+54098,
+63511,
+65534,
+65158,
+59568,
+48416,
+37205,
+28300,
+24487,
+25872,
+29883,
+33412,
+33311,
+28883,
+21735,
+10668,
+967,
+65535,
+144,
+65535,
+73,
+65535,
+65535,
+50,
+65535,
+112,
+65535,
+106,
+65535,
+65,
+12241,
+29546,
+35994,
+29852,
+18756,
+10837,
+12327,
+22136,
+48985,
+65534,
+64831,
+65534,
+65443,
+65499,
+65534,
+65426,
+65534,
+65462,
+65534,
+65527,
+65505,
+65534,
+65417,
+65534,
+61425,
+49929,
+32847,
+10253,
+65535,
+233,
+65535,
+7,
+1,
+63,
+65535,
+3534,
+2911,
+65535,
+93,
+14,
+65535,
+65535,
+245,
+65535,
+18843,
+49156,
+63112,
+65534,
+64789,
+58436,
+46299,
+39449,
+42256,
+53650,
+64581,
+65534,
+65362,
+65534,
+65369,
+65534,
+65360,
+65534,
+64461,
+57607,
+51835,
+47306,
+43279,
+42718,
+42798,
+40699,
+33310,
+24634,
+10876,
+65535,
+103,
+65535,
+29,
+65535,
+206,
+65535,
+3524,
+15934,
+23681,
+26276,
+27610,
+31074,
+37434,
+49371,
+62961,
+65534,
+65293,
+65534,
+65416,
+65534,
+65480,
+65534,
+65519,
+65529,
+65534,
+65457,
+65534,
+65268,
+65534,
+60174,
+46050,
+35575,
+30544,
+30442,
+31265,
+30231,
+26683,
+20342,
+8406,
+65535,
+108,
+65535,
+65535,
+53,
+65535,
+46,
+65535,
+22,
+65535,
+14,
+65535,
+30,
+65535,
+60,
+65535,
+165,
+626,
+234,
+65535,
+765,
+15224,
+39204,
+55232,
+62317,
+60085,
+47458,
+19220,
+65535,
+180,
+147,
+314,
+24519,
+59481,
+65534,
+64832,
+65534,
+54153,
+30809,
+7847,
+65535,
+15258,
+45843,
+65407,
+65383,
+65534,
+65464,
+65534,
+64591,
+53787,
+44165,
+37162,
+36589,
+48819,
+60185,
+65338,
+65422,
+65534,
+64518,
+50261,
+23439,
+1969,
+65535,
+99,
+127,
+65535,
+4733,
+26241,
+46144,
+52892,
+41414,
+15194,
+65535,
+230,
+65535,
+1323,
+26015,
+58586,
+65534,
+65355,
+65439,
+65534,
+61427,
+45433,
+39196,
+42276,
+50426,
+62336,
+65534,
+65413,
+65484,
+65534,
+59055,
+43020,
+28915,
+19368,
+13862,
+12205,
+14267,
+19650,
+24267,
+24469,
+19656,
+13335,
+5652,
+65535,
+314,
+65535,
+4230,
+18637,
+32899,
+44816,
+50547,
+49339,
+42807,
+34569,
+27499,
+24867,
+30188,
+45131,
+61940,
+65534,
+65221,
+65534,
+65353,
+65534,
+65339,
+65534,
+63553,
+56056,
+51590,
+51528,
+50381,
+47323,
+47195,
+48861,
+46038,
+37687,
+26648,
+16514,
+6253,
+65535,
+30,
+13,
+65535,
+43,
+65535,
+32,
+65535,
+15,
+65535,
+1,
+6,
+65535,
+25,
+65535,
+46,
+65535,
+43,
+65535,
+65535,
+146,
+65535,
+10882,
+31920,
+48907,
+58094,
+56991,
+48539,
+34593,
+23070,
+23005,
+33951,
+55162,
+65534,
+65155,
+65534,
+65418,
+65534,
+65361,
+65534,
+59741,
+54805,
+62691,
+65534,
+65140,
+65534,
+65015,
+65534,
+58032,
+36311,
+19588,
+8969,
+1904,
+65535,
+1050,
+8264,
+14810,
+15100,
+10151,
+2240,
+65535,
+223,
+65535,
+65535,
+279,
+65535,
+9984,
+27803,
+34106,
+31217,
+21233,
+8489,
+65535,
+3012,
+18730,
+44498,
+64247,
+65534,
+65333,
+65534,
+65382,
+65534,
+65441,
+65534,
+65464,
+65534,
+65432,
+65534,
+65350,
+65534,
+64170,
+51671,
+35262,
+20477,
+6888,
+173,
+65535,
+57,
+65535,
+77,
+98,
+14,
+19,
+65535,
+133,
+65535,
+357,
+65535,
+4174,
+22987,
+40185,
+49184,
+51324,
+49443,
+48074,
+47919,
+51409,
+60568,
+65534,
+65360,
+65534,
+65503,
+65534,
+65534,
+65515,
+65534,
+65501,
+65534,
+64574,
+60556,
+51366,
+38759,
+25059,
+12591,
+5538,
+1863,
+65535,
+0,
+24,
+65535,
+62,
+65535,
+82,
+65535,
+452,
+6911,
+15526,
+22115,
+26820,
+29244,
 31553,
-30920,
-30202,
-29590,
-28898,
-28435,
-27903,
-27417,
-27148,
-26665,
-26395,
-26043,
-25600,
-25288,
-24738,
-24402,
-24027,
-23650,
-23495,
-23231,
-23095,
-22965,
-22763,
-22744,
-22541,
-22479,
-22318,
-22258,
-22164,
-22036,
-21987,
-21990,
-21768,
-21855,
-21503,
-21612,
-21236,
-21215,
-21146,
-21037,
-21170,
-21169,
-21305,
-21431,
-21662,
-21784,
-22105,
-22230,
-22543,
-22612,
-23004,
-23056,
-23359,
+35726,
+40530,
+44188,
+47209,
+49516,
+49212,
+44953,
+38449,
+32755,
+29697,
+25593,
+19348,
+9797,
+865,
+65535,
+65535,
+319,
+65535,
+7386,
+28082,
+38436,
+35852,
+21517,
+3731,
+65535,
+626,
+65535,
+8861,
+35125,
+59546,
+65534,
+65018,
+65534,
+61834,
+54739,
+52135,
+57621,
+64958,
+65534,
+65347,
+65534,
+65384,
+65534,
+65101,
+53265,
+37613,
+28888,
+24665,
+25937,
+30203,
+34508,
+34500,
+28486,
+15727,
+2163,
+65535,
+124,
+65535,
+65535,
+845,
+10126,
+18661,
+21487,
+20717,
+18118,
+17568,
+20871,
+28650,
+39259,
+50330,
+59050,
+63391,
+63631,
+62147,
+60010,
+57845,
+57136,
+57428,
+58756,
+59765,
+60403,
+59625,
+55636,
+49893,
+41467,
+31720,
+22597,
+15872,
+13779,
+15619,
+19810,
+24240,
+27610,
+28406,
+25965,
+21268,
+17146,
+16342,
+19342,
+25944,
+34186,
+42597,
+48055,
+48431,
+45122,
+39600,
+33887,
+29156,
+26618,
+27014,
+28891,
+30140,
+30750,
+30434,
+28633,
+25906,
+21910,
+19366,
+20597,
+26051,
+34260,
+41159,
+45516,
+47645,
+48093,
+47071,
+45668,
+46092,
+49263,
+53001,
+57685,
+63810,
+65534,
+65400,
+65534,
+65470,
+65534,
+65482,
+65534,
+65455,
+65534,
+64594,
+59064,
+53475,
+48554,
+41110,
+33053,
+26899,
+21723,
+14527,
+4970,
+65535,
+62,
+65535,
+65535,
+17,
+65535,
+24,
+65535,
+19,
+65535,
+65535,
+27,
+65535,
+102,
+65535,
+270,
+65535,
+2534,
+11897,
+12643,
+4120,
+65535,
+20,
+1,
+36,
+52,
+10087,
+25405,
+38320,
+50551,
+56613,
+57607,
+58333,
+61503,
+64879,
+65534,
+65513,
+65534,
+65523,
+65534,
+65531,
+65534,
+65531,
+65534,
+65511,
+65534,
+65469,
+65534,
+65386,
+65534,
+63666,
+52303,
+36606,
+22057,
+10234,
+2667,
+65535,
+1054,
+2577,
+937,
+65535,
+84,
+65535,
+120,
+65535,
+319,
+65535,
+4784,
+20010,
+32709,
+41065,
+43627,
+41342,
+37461,
+34165,
+35726,
+42689,
+56380,
+65534,
+65442,
+65534,
+65534,
+65463,
+65534,
+65469,
+65534,
+65519,
+65503,
+65534,
+62633,
+56317,
+48095,
+38529,
+28381,
+17875,
+8596,
+1765,
+65535,
+48,
+133,
+2235,
+4658,
+5122,
+2746,
+247,
+65535,
+127,
+65535,
+1901,
+8867,
+16288,
+21260,
+24280,
+26657,
+29533,
+32061,
+35870,
+41442,
+47696,
+53682,
+58723,
+64054,
+65534,
+65393,
+65534,
+65487,
+65534,
+65534,
+65507,
+65534,
+65486,
+65534,
+65490,
+65534,
+65269,
+58599,
+47645,
+37854,
+30904,
+26942,
+23003,
+18558,
+13104,
+4550,
+65535,
+127,
+65535,
+11,
+11,
+65535,
+24,
+65535,
+13,
+65535,
+65535,
+22,
+65535,
+64,
+65535,
+432,
+1685,
+2843,
+5664,
+7573,
+6695,
+7126,
+13740,
+25787,
+37872,
+45407,
+46513,
+41512,
+34310,
+28639,
+25602,
+26171,
+28858,
+32810,
+38744,
+45750,
+51447,
+53018,
+51778,
+50840,
+52684,
+56455,
+60789,
+64955,
+65534,
+65442,
+65534,
+65484,
+65534,
+65496,
+65534,
+65480,
+65534,
+65434,
+65534,
+64743,
+59624,
+53833,
+46490,
+36945,
+28825,
+22171,
+14940,
+7937,
+4425,
+5177,
+4700,
+1034,
+65535,
+124,
+65535,
+125,
+65535,
+195,
+65535,
+1790,
+12798,
+24836,
+32318,
+35217,
+36374,
+37792,
+39672,
+43927,
+51107,
+61581,
+65534,
+65282,
+65534,
+65478,
+65534,
+65534,
+65502,
+65534,
+65518,
+65516,
+65534,
+62251,
+55816,
+48966,
+42331,
+35260,
+26832,
+19422,
+15247,
+13265,
+10337,
+7868,
+8416,
+9549,
+8512,
+5657,
+4192,
+5002,
+6072,
+10630,
+20045,
+29552,
+35726,
+40266,
+46715,
+53470,
+56293,
+56724,
+58188,
+59385,
+58927,
+58147,
+60761,
+63771,
+63304,
+61733,
+61268,
+60335,
+54942,
+47997,
+44226,
+42393,
+39696,
+37074,
+35102,
+31982,
+25538,
+17297,
+11044,
+6911,
+4128,
+3862,
+6863,
+9385,
+8970,
+7661,
+7884,
+8041,
+4448,
+440,
+65535,
+65535,
+25,
+65535,
+58,
+1458,
+2631,
+5272,
+9936,
+11026,
+3965,
+65535,
+172,
+11,
+65535,
+1986,
+7500,
+13193,
+19279,
+23976,
+25534,
+25330,
 23586,
-23672,
-23961,
-23960,
-24271,
-24381,
-24691,
-24936,
-25288,
-25491,
-25863,
-26066,
-26441,
-26662,
-26929,
-27128,
-27303,
-27486,
-27744,
-27950,
-28234,
-28458,
-28654,
-29036,
-29205,
-29681,
-29891,
-30344,
-30469,
-30807,
-30936,
-31137,
-31271,
-31379,
-31559,
-31690,
-31933,
-32136,
-32374,
-32713,
-32928,
-33199,
-33372,
-33531,
-33858,
-33954,
-34322,
-34419,
-34722,
-34771,
-35034,
-35036,
-35168,
-35234,
-35235,
-35322,
-35391,
-35500,
-35743,
-36033,
-36252,
-36565,
-36784,
-37030,
-37247,
-37387,
-37535,
-37651,
-37670,
-37736,
-37784,
-37758,
-37783,
-37825,
-37781,
-37828,
-37912,
-37851,
-38023,
-38027,
-38024,
-38071,
-38001,
-37874,
-37866,
-37630,
-37492,
-37206,
-36875,
-36672,
-36321,
-35988,
-35720,
-35371,
-35097,
-34884,
-34546,
-34482,
-34171,
-34149,
-33861,
-33863,
-33571,
-33443,
-33194,
-32911,
-32664,
-32290,
-32044,
-31602,
-31469,
-31071,
-30849,
-30627,
-30317,
-30073,
-29743,
-29475,
-29121,
-28856,
-28611,
-28191,
-28082,
-27591,
-27351,
-26949,
-26487,
-26152,
-25668,
-25265,
-24914,
-24558,
-24293,
-24072,
-23782,
-23650,
-23386,
-23206,
-23009,
-22742,
-22520,
-22367,
-21965,
-21881,
-21455,
-21283,
-20990,
-20574,
-20413,
-19955,
-19816,
-19488,
-19397,
-19176,
-19154,
-18978,
-18997,
-18846,
-18843,
-18666,
-18647,
-18465,
-18447,
-18244,
-18336,
-18090,
-18181,
-18022,
-17915,
-17847,
-17670,
-17471,
-17359,
-16983,
-16919,
-16583,
-16431,
-16206,
-16055,
-15919,
-15944,
-15741,
-16011,
-15763,
-16078,
-15962,
-16098,
-16120,
-16164,
-16208,
-16275,
-16318,
-16453,
-16539,
-16630,
-16739,
-16740,
-16962,
-16915,
-17185,
-17114,
-17406,
-17359,
-17604,
-17647,
-17693,
-17780,
-17649,
-17669,
-17604,
-17538,
-17579,
-17474,
-17556,
-17605,
-17671,
-17757,
-17915,
-17980,
-18244,
-18426,
-18642,
-19023,
-19176,
-19574,
-19797,
-20173,
-20437,
-20729,
-21058,
-21368,
-21791,
-22231,
-22678,
-23139,
-23608,
-23935,
-24252,
-24489,
-24584,
-24710,
-24738,
-24845,
-24848,
-25067,
-25023,
-25379,
-25465,
-25824,
-26062,
-26487,
-26794,
-27417,
-27836,
-28479,
-28989,
-29564,
-29984,
-30430,
-30692,
-30961,
-31136,
-31426,
-31578,
-32070,
-32308,
-32932,
-33352,
-33971,
-34505,
-35013,
-35477,
-35988,
-36253,
-36763,
-36896,
-37383,
-37493,
-37784,
-37956,
-38072,
-38333,
-38471,
-38710,
-39024,
-39264,
-39644,
-40039,
-40397,
-40881,
-41260,
-41725,
-42122,
-42611,
-43053,
-43473,
-43941,
-44359,
-44715,
-45180,
-45377,
-45847,
-46018,
-46535,
-46680,
-47112,
-47258,
-47463,
-47439,
-47569,
-47199,
-47236,
-46844,
-46683,
-46687,
-46553,
-46884,
-46954,
-47413,
-47532,
-47988,
-48129,
-48477,
-48792,
-49077,
-49588,
+18132,
+12177,
+13658,
+24556,
+34222,
+33883,
+35137,
+43969,
+47359,
+44203,
+44101,
+50940,
+56920,
+56253,
+60507,
+65534,
+65433,
+65534,
+65534,
+65497,
+65528,
+65534,
+61719,
+59274,
+58355,
+50136,
+42114,
+43439,
+45326,
+36567,
+26378,
+24414,
+24877,
+20126,
+13170,
+12459,
+15707,
+15431,
+14569,
+20066,
+28401,
+29201,
+25866,
+28602,
+34129,
+36781,
+37285,
+41098,
 50007,
-50673,
-51161,
-51778,
-52093,
-52419,
-52426,
-52442,
-52269,
-52089,
-52047,
-51890,
-52025,
-52088,
-52138,
-52219,
-52160,
-51977,
-51782,
-51358,
-51184,
-50803,
-50719,
-50672,
-50605,
-50875,
-50758,
-51051,
-50895,
-51002,
-50920,
-50846,
-50854,
-50845,
-50833,
-50845,
-50921,
-50868,
-50919,
-50760,
-50562,
-50342,
-49916,
-49504,
-48961,
-48353,
-47788,
-47198,
-46775,
-46461,
-46423,
-46529,
-46863,
-47219,
-47636,
-47728,
-47837,
-47417,
-47018,
-46220,
-45557,
-44868,
-44385,
-44002,
-43855,
-43580,
-43501,
-43116,
-42679,
-42056,
-41369,
-40774,
-40259,
-39956,
-39750,
-39778,
-39728,
-39622,
-39419,
-38780,
-38157,
-37141,
-36318,
-35457,
-34902,
-34548,
-34459,
-34659,
-34857,
-35125,
-35123,
-35013,
-34504,
-34059,
-33244,
-32729,
-32113,
-31866,
-31759,
-31933,
-32024,
-32310,
-32111,
-32002,
-31380,
-30782,
-30074,
-29454,
-29076,
-28990,
+55703,
+57366,
+61423,
+65437,
+65058,
+62296,
+62835,
+65331,
+65534,
+65470,
+65534,
+64214,
+60322,
+55277,
+50606,
+47137,
+43295,
+39710,
+36694,
+30842,
+24090,
+17434,
+11099,
+7141,
+6128,
+8364,
+11399,
+12474,
+11261,
+10614,
+11556,
+11948,
+12881,
+16532,
+21120,
+26229,
+29397,
+30254,
+31887,
+32009,
+31752,
+33365,
+36892,
+39909,
+40982,
+42582,
+46038,
+50206,
+52333,
+51832,
+52053,
+50987,
+46313,
+43539,
+43290,
+42970,
+40744,
+40101,
+43516,
+46996,
+48040,
+47504,
+45143,
+42515,
+35936,
 29119,
-29478,
-29828,
-30053,
-30095,
-29763,
-29367,
-28764,
-28216,
-27834,
-27750,
-27791,
-28324,
-28635,
-29253,
-29388,
-29564,
-29431,
-29188,
-29011,
-28744,
-28834,
-28899,
-29277,
-29587,
-29851,
-30096,
-29919,
-29918,
-29477,
-29297,
-29034,
-29032,
-29232,
-29587,
-30072,
-30542,
-30979,
-31249,
-31358,
-31314,
-31203,
-30983,
-30980,
-30984,
-31201,
-31560,
-31909,
-32403,
-32684,
-32934,
-32952,
-32863,
-32645,
-32442,
-32224,
-32199,
-32311,
-32444,
-32797,
-33043,
-33218,
-33464,
-33240,
-33330,
-33041,
-32998,
-32954,
-33040,
-33332,
-33570,
-34108,
-34301,
-34662,
-34723,
-34681,
-34549,
-34368,
-34241,
-34169,
-34217,
-34371,
-34479,
-34751,
-34787,
-34818,
-34701,
-34414,
-34151,
-33749,
-33486,
-33197,
-33063,
-33041,
-32910,
-32996,
-32778,
-32731,
-32398,
-32091,
-31667,
-31337,
-30938,
-30648,
-30408,
-30250,
-30096,
-29963,
-29895,
-29744,
-29628,
-29435,
-29272,
-29169,
-28986,
-28812,
-28613,
-28389,
-28236,
-27881,
-27681,
-27283,
-26908,
-26594,
-26111,
-25863,
-25380,
-25266,
-24825,
-24846,
-24492,
-24515,
-24225,
-24183,
-23981,
-23829,
-23561,
-23319,
-23073,
+29118,
+28471,
+28047,
+24284,
+24085,
+26657,
+21373,
+17387,
+16853,
+12998,
+8372,
+6567,
+7987,
+7507,
+3529,
+7827,
+8426,
+4833,
+1598,
+1671,
+7088,
+2637,
+65535,
+5677,
+7065,
+3325,
+65535,
+2302,
+2457,
+1005,
+10350,
+20264,
+25657,
+29870,
+32658,
+34020,
+31335,
+25686,
+21853,
+17306,
+13360,
+15000,
+24251,
+33625,
+37341,
+40596,
+45381,
+43652,
+37516,
+34913,
+36004,
+36100,
+33917,
+37463,
+47529,
+55547,
+56800,
+57774,
+60698,
+59787,
+54635,
+51775,
+53054,
+53182,
+50262,
+48322,
+51475,
+56506,
+56967,
+55397,
+55386,
+53881,
+50196,
+44976,
+40068,
+38111,
+35953,
+33487,
+34026,
+36931,
+38475,
+38383,
+38255,
+36977,
+35346,
+35206,
+35646,
+35870,
+36457,
+37253,
+38704,
+40131,
+41342,
+44360,
+47283,
+46805,
+45937,
+47035,
+48306,
+47405,
+46187,
+45453,
+41923,
+38159,
+36538,
+35923,
+33336,
+30238,
+28453,
+26092,
+23806,
+23412,
+25773,
+26379,
+25594,
+27818,
+29106,
+29376,
+29370,
+28316,
+28869,
+30366,
+32687,
+36073,
+41376,
+42376,
+39506,
+40315,
+39621,
+36334,
+37258,
+39989,
+38504,
+35734,
+39651,
+42188,
+37218,
+35431,
+36285,
+31282,
+27429,
+29520,
+29698,
+25649,
+26101,
+30290,
+28448,
+30061,
+32813,
+30279,
+26540,
+25685,
+26479,
+23693,
+22162,
+28936,
+27659,
 22788,
-22719,
-22389,
-22387,
-22056,
-22165,
-21837,
-21854,
-21593,
-21454,
-21195,
-21101,
-20839,
-20881,
-20704,
-20795,
-20569,
-20619,
-20236,
-20153,
-19841,
-19506,
-19402,
-19016,
-19026,
-18840,
-19024,
-19041,
-19289,
-19419,
-19530,
-19687,
-19572,
-19711,
-19551,
-19665,
-19441,
-19507,
-19401,
-19371,
-19403,
-19305,
-19422,
-19375,
-19375,
-19398,
-19331,
-19354,
-19331,
-19287,
-19331,
-19198,
-19354,
-19176,
-19419,
-19333,
-19595,
-19554,
-19752,
-19640,
-19754,
-19772,
-19864,
-20063,
-20149,
-20462,
-20616,
-20968,
-21240,
-21476,
-21770,
-21878,
-22077,
-22145,
-22277,
-22231,
-22347,
-22207,
-22192,
-22053,
-21946,
-21856,
-21768,
-21834,
-21945,
-22144,
-22322,
-22586,
-22766,
-22984,
-23098,
+29571,
+29953,
+25102,
+24146,
+25179,
+20815,
+17378,
+17934,
+17919,
+16863,
+16233,
+12953,
+7524,
+3783,
+941,
+242,
+65535,
+41,
+65535,
+30,
+65535,
+48,
+65535,
+87,
+65535,
+1114,
+9638,
+12849,
+16112,
+28583,
+27825,
+28773,
+38783,
+39776,
+39767,
+44017,
+47660,
+47492,
+50979,
+59135,
+59652,
+58546,
+57321,
+54350,
+56451,
+55387,
+48075,
+45478,
+47108,
+45160,
+43524,
+46614,
+50042,
+49994,
+51050,
+52171,
+50880,
+50706,
+48103,
+43409,
+42333,
+44782,
+49645,
+51096,
+51100,
+53533,
+52447,
+49161,
+44461,
+41196,
+43945,
+43266,
+40864,
+42896,
+45369,
+40123,
+36804,
+39931,
+39839,
+38486,
+39104,
+39273,
+37625,
+34346,
+28561,
+28419,
+28178,
+23445,
+28018,
+33590,
+31596,
+27178,
+30550,
+33502,
+25890,
+28993,
+35793,
+33236,
+30645,
+32659,
+33651,
+29164,
+22672,
+23840,
+24382,
+21263,
+22010,
+21731,
+28875,
+24550,
+19215,
+25797,
+23102,
+19973,
+21332,
+25963,
+27722,
+26770,
+33936,
+35386,
+37216,
+36595,
+37725,
+40469,
+43337,
+48503,
+47441,
+52839,
+58230,
+54685,
+51049,
+56988,
+59149,
+49267,
+44981,
+53616,
+52587,
+37366,
+37778,
+49597,
+40414,
+27185,
+35803,
+41187,
+24638,
+17839,
+22122,
+20523,
+8795,
+8674,
+11547,
+9165,
+2961,
+5935,
+13175,
+188,
+3663,
+10835,
+3616,
+65535,
+5673,
+8527,
+5869,
+6342,
+4938,
+17573,
+21210,
+9068,
+20912,
+36516,
+29973,
+24662,
+46679,
+51361,
+38530,
+47950,
+52206,
+49426,
+46144,
+48205,
+51836,
+50100,
+45384,
+44801,
+50911,
+47932,
+36672,
+33599,
+38345,
+30199,
+23393,
+27122,
+22349,
+15197,
+14960,
+20307,
+14054,
+11274,
+21540,
+21023,
+17653,
+19437,
+29705,
+25397,
+22623,
+31331,
+29592,
+34198,
+33662,
+38224,
+42114,
+45205,
+51629,
+42653,
+48275,
+56617,
+49690,
+42722,
+41429,
+47502,
+42863,
+36756,
+44158,
+47868,
+44459,
+39633,
+44652,
+40373,
+32303,
+31913,
+28865,
+33116,
+29819,
+30272,
+32396,
+31987,
+32098,
+32383,
+36914,
+35367,
+37981,
+46762,
+40029,
+44033,
+51884,
+51754,
+51591,
+45635,
+53711,
+52183,
+46513,
+52945,
+52493,
+45547,
+40674,
+39654,
+44231,
+34595,
+27274,
+31259,
+37888,
+18972,
+18913,
+47228,
+19514,
+17726,
+29543,
+21192,
+21981,
 23252,
-23294,
-23498,
-23670,
-23984,
-24381,
-24757,
-25180,
-25466,
-25777,
-26041,
-26244,
-26528,
-26775,
-27238,
-27504,
-28147,
-28346,
-28766,
-28924,
-28810,
-28700,
-28236,
-27857,
-27440,
-27126,
-26908,
-26972,
-26862,
+21367,
+26998,
+29146,
+32736,
+38702,
+37309,
+41619,
+41125,
+34987,
+36578,
+37468,
+43904,
+39046,
+33346,
+45707,
+41375,
+42224,
+39743,
+41284,
+36126,
+27224,
+31906,
+25810,
+25362,
+29030,
+21320,
+33546,
+29438,
+18913,
+25608,
+27665,
+23672,
+11529,
+22474,
+34588,
+19684,
+17606,
+41690,
+33501,
+22435,
+31395,
+32972,
+28840,
+20531,
+28875,
+32098,
+20589,
+18825,
+27874,
+25864,
+9652,
+20349,
+31420,
+21620,
+16114,
+28746,
+35246,
+11446,
+15825,
+28125,
+15340,
+14331,
+17842,
+27431,
+30244,
+20294,
+29747,
+28219,
+27043,
+23783,
+22164,
+36058,
+18554,
+26970,
+32687,
+22656,
+34850,
+31061,
+31033,
+28566,
+37497,
+26893,
+17644,
+35283,
+23382,
+20512,
+32212,
+34210,
+33265,
+38992,
+40048,
+34196,
+33702,
+36702,
+38702,
+34675,
+39090,
+41517,
+44551,
+35734,
+40773,
+44385,
+32255,
+35669,
+40756,
+42296,
+39014,
+45561,
+47678,
+41726,
+45908,
+40361,
+39675,
+51314,
+37681,
+43004,
+51844,
+43851,
+47373,
+47463,
+48972,
+43922,
+41365,
+39956,
+41377,
+39668,
+36311,
+43411,
+41402,
+31872,
+38749,
+40002,
+35328,
+34628,
+30733,
+42443,
+26304,
+28632,
+38229,
+27592,
+20871,
+23964,
+27326,
+15174,
+23424,
+28473,
+22602,
+27687,
+30847,
+28190,
+33207,
+31786,
+28489,
+33293,
+36700,
+41919,
+37286,
+48915,
+55563,
+43293,
+56667,
+53958,
+56702,
+62920,
+49936,
+59933,
+65534,
+54723,
+56395,
+61008,
+58657,
+44252,
+36375,
+47660,
+35619,
+28174,
+32137,
+24747,
+24119,
+15465,
+23879,
+17267,
+405,
+21998,
+8229,
+65535,
+11187,
+1635,
+4402,
+65535,
+6207,
+15790,
+1480,
+11556,
+12629,
+10525,
+5047,
+13766,
+13654,
+1790,
+17124,
+15058,
+8773,
+21242,
+32845,
+23684,
+30594,
+38820,
+27037,
+39060,
+31083,
+30298,
+40365,
+22159,
+35334,
+37381,
+27481,
+38820,
+34515,
+29637,
+31245,
+30567,
+35428,
+25541,
+25375,
+28193,
+26281,
+24590,
+13868,
+35396,
+24739,
+12114,
+39766,
+29750,
+20368,
+38562,
+36840,
+27403,
+31738,
+36082,
+40957,
+28677,
+28499,
+44177,
+38685,
+38760,
+41636,
+45426,
+46027,
+39885,
+45998,
+37784,
+39443,
+38461,
+34190,
+46965,
+30601,
+52338,
+49419,
+30985,
+44407,
+45099,
+40604,
+33546,
+41008,
+41653,
+38496,
+42620,
+43716,
+34043,
+45887,
+48864,
+35778,
+41202,
+47636,
+48791,
+47606,
+39501,
+48838,
+58603,
+49675,
+36695,
+45460,
+55085,
+34616,
+35606,
+46339,
+39334,
+48950,
+42501,
+33686,
+44345,
+45495,
+38729,
+24554,
+30507,
+48732,
+23921,
+21162,
+35875,
+39394,
+32907,
+16636,
+38270,
+46715,
+20712,
+30216,
+38824,
+35014,
+27351,
+28026,
+49865,
+28761,
+32632,
+47598,
+32257,
+41636,
+37910,
+43706,
+29922,
+25593,
+47994,
+23151,
+28263,
+26987,
+29949,
+25193,
+12950,
+22061,
+22880,
+24847,
+8355,
+15399,
+29663,
+18701,
+11766,
+18081,
+23235,
+18259,
+14405,
+22885,
+23545,
+17204,
+17961,
+25974,
+20649,
+24530,
+20819,
+27324,
+24555,
+20565,
+34048,
+23068,
+30143,
+25113,
+27783,
+35969,
+20857,
+26751,
+29241,
+25423,
+17801,
+24382,
+32240,
+17643,
+20388,
+37272,
+22280,
+25251,
+32033,
+27418,
+27317,
+21798,
+27011,
+28011,
+25723,
+23615,
+41102,
+34134,
+29365,
+42655,
+35310,
+42168,
+29492,
+38968,
+45024,
+33236,
+37689,
+39467,
+42713,
+31725,
+37176,
+38235,
+36171,
+25817,
+34747,
+41452,
+27128,
+31662,
+31245,
+35863,
+32925,
+25829,
+43870,
+28075,
+31677,
+33788,
+33461,
+35013,
+21168,
+42797,
+34164,
+30243,
+32414,
+38940,
+48386,
+28268,
+44053,
+58072,
+37336,
+45762,
+50781,
+53761,
+47989,
+51474,
+62469,
+55513,
+53187,
+53446,
+56037,
+56552,
+50940,
+47943,
+55638,
+52763,
+41052,
+39808,
+48445,
+42161,
+33905,
+27364,
+28941,
+34124,
+25141,
+22579,
+31731,
+45605,
+20920,
+19919,
+38675,
+32408,
+17153,
+18240,
+41488,
+26827,
+23931,
+33154,
+30332,
+44616,
+29806,
+27781,
+34963,
+40371,
+32100,
+23886,
+46201,
+30681,
+32353,
+36009,
+26348,
+38979,
+30948,
+25717,
+28730,
+30462,
+29561,
+16452,
+33988,
+31105,
+19280,
+34830,
+33791,
+26530,
+23300,
+31142,
+26018,
+21150,
+20694,
+26098,
+30762,
+25490,
+23680,
+25978,
+34330,
+24234,
+17643,
+27162,
+15064,
+18931,
+22648,
+12793,
+27347,
+23493,
+15548,
+24767,
+20950,
+20487,
+17980,
+25226,
+18776,
+11977,
+32503,
+22979,
+22265,
+28158,
+25978,
+29189,
+35298,
+29673,
+28433,
+37500,
+43078,
+38346,
+26411,
+43515,
+49935,
+22643,
+24961,
+44955,
+40425,
+21621,
+27637,
+44279,
+27685,
+22309,
+34176,
+30192,
+22477,
+13016,
+16551,
+28397,
+11900,
+14100,
+25914,
+29732,
+17828,
+22689,
+37435,
+26277,
+22349,
+27180,
+36796,
+32532,
+32982,
+36412,
+42242,
+56495,
+43549,
+42904,
+57347,
+54221,
+47406,
+48702,
+59608,
+58208,
+52369,
+54292,
+57338,
+56877,
+56569,
+48355,
+55130,
+56371,
+50844,
+52953,
+47926,
+49508,
+50501,
+40019,
+40341,
+47557,
+38983,
+38048,
+38452,
+44258,
+38529,
+36420,
+31701,
+33719,
+43041,
+28892,
+29507,
+32936,
+27811,
+34750,
+31386,
+30604,
+27099,
+31713,
+33604,
+22469,
+31005,
+33951,
+34405,
+25477,
+28705,
+40282,
+29995,
+22723,
+30247,
+32750,
+29244,
+24848,
+29738,
+37923,
+27948,
+30760,
+33741,
+28226,
 27217,
-27170,
-27596,
-27547,
-27859,
-27882,
-28055,
+30515,
+34511,
+23937,
+30005,
+33136,
+28223,
+34637,
+26654,
+28531,
+29891,
+25176,
+27271,
+28441,
+28229,
 28195,
-28520,
-28791,
-29497,
-29941,
-30715,
-31293,
-31823,
-32333,
-32643,
-32931,
-33152,
-33264,
-33351,
-33484,
-33508,
-33640,
-33705,
-33774,
-33837,
-33753,
-33571,
-33377,
-32949,
-32825,
-32484,
-32468,
-32510,
-32708,
-33154,
-33661,
-34260,
-34969,
-35345,
-35988,
-36053,
-36343,
-36341,
-36475,
-36764,
-37027,
-37562,
-38068,
-38580,
-39087,
-39291,
-39572,
-39424,
-39352,
-38935,
-38777,
-38492,
-38467,
-38535,
-38758,
-38930,
-39092,
-39152,
-38958,
-38887,
-38625,
-38623,
-38800,
-39090,
-39883,
-40642,
-41722,
-42723,
-43627,
-44474,
-44910,
-45382,
-45400,
-45710,
-45692,
-46085,
-46421,
-46864,
-47393,
-47683,
-48060,
-48035,
-48127,
-47859,
-47837,
-47595,
-47726,
-47728,
-47946,
-48260,
-48523,
-48814,
-48965,
-48991,
-49076,
-48902,
-49078,
-49055,
-49521,
-49986,
-50628,
-51316,
-51912,
-52379,
-52687,
-52889,
-52843,
-52798,
-52645,
-52378,
-52267,
-51915,
-51865,
-51584,
-51380,
-51116,
-50763,
-50492,
-50078,
-50005,
-49745,
-49919,
-50008,
-50120,
-50272,
-50298,
-50250,
-50166,
-50005,
-49745,
-49497,
-49057,
-48789,
-48369,
-48060,
-47814,
-47441,
-47281,
-46932,
-46706,
-46356,
-46173,
-45692,
-45576,
-45027,
-44712,
-44162,
-43606,
-43143,
-42654,
-42322,
-41946,
-41614,
-41347,
-40994,
-40683,
-40306,
-39954,
-39574,
-39311,
-38911,
-38712,
-38379,
-38204,
-37957,
-37739,
-37404,
-37163,
-36717,
-36498,
-36076,
-35853,
-35548,
-35498,
-35146,
-35125,
-34724,
-34548,
-34150,
-33948,
-33531,
-33329,
-32953,
-32643,
-32333,
-31911,
-31692,
-31225,
-31136,
-30763,
-30845,
-30675,
-30891,
-31050,
-31335,
-31625,
-31779,
-31956,
-32001,
-31912,
-31868,
-31800,
-31672,
-31685,
-31564,
-31530,
-31428,
-31402,
-31203,
-31115,
-30805,
-30648,
-30408,
-30206,
-30073,
-30008,
-30006,
-30053,
-30139,
-30252,
-30360,
-30475,
-30579,
-30610,
-30888,
-30899,
-31287,
-31362,
-31665,
-31849,
-32020,
-32203,
-32286,
-32312,
-32244,
-32155,
-31825,
-31689,
-31294,
-31112,
-30896,
-30713,
-30653,
-30491,
-30498,
-30358,
-30542,
-30381,
-30652,
-30471,
-30650,
-30649,
-30716,
-30939,
-30958,
-31205,
-31224,
-31226,
-31226,
-31136,
-31027,
-31069,
-30829,
-30869,
-30717,
-30583,
-30539,
-30449,
-30364,
-30270,
-30033,
-29716,
-29456,
-29074,
-28859,
-28653,
-28504,
-28366,
-28435,
-28281,
-28565,
-28393,
-28676,
-28503,
-28633,
-28457,
-28368,
+28489,
+29788,
+32455,
+28238,
+30651,
+26276,
+26557,
+22775,
+28387,
+32544,
+25410,
+26652,
+25065,
+31575,
+22812,
+19030,
+29924,
+27707,
+13895,
+16428,
+24270,
+23662,
+18014,
+12368,
+18637,
+18354,
+14159,
+19950,
+13212,
+15572,
+22533,
+18015,
+18905,
+19255,
+26289,
+19900,
+17123,
+24243,
+28116,
+26482,
+22351,
+29673,
+30822,
+35784,
+37266,
+34010,
+32022,
+34370,
+38532,
+31545,
+31104,
+36857,
+35155,
+34380,
+38336,
+41773,
+40529,
+35169,
+35826,
+39304,
+35618,
+37994,
+39683,
+34988,
+37789,
+43164,
+48128,
+46302,
+46847,
+47257,
+43344,
+47834,
+46622,
+49597,
+51253,
+49581,
+56229,
+52446,
+57923,
+53583,
+57192,
+56092,
+44933,
+56605,
+50971,
+47239,
+52154,
+50001,
+48620,
+43489,
+46549,
+45138,
+39404,
+37334,
+34278,
+39541,
+29936,
+30587,
+35201,
+29849,
+30157,
+28215,
+31754,
+25556,
+24702,
+27389,
+23518,
+24184,
+27847,
+28268,
+23859,
+29570,
+29067,
+26766,
+28162,
+23203,
+24762,
 28323,
-28259,
-28301,
-28347,
-28388,
-28305,
-28364,
-28263,
-28208,
-28173,
-28010,
-27928,
-27792,
-27725,
-27661,
-27702,
+28185,
+27501,
+26658,
+32455,
+31314,
+26403,
+27196,
+26756,
+27041,
+27651,
+28471,
+31281,
+32278,
+29210,
+32262,
+31899,
+30408,
+31372,
+31410,
+32148,
+30270,
+34191,
+30212,
+34441,
+35076,
+28948,
+36387,
+30853,
+29820,
+35153,
+29744,
+27823,
+30788,
+26497,
+25176,
+27462,
 27771,
-27793,
-27857,
-27883,
-27746,
-27883,
-27592,
-27769,
-27640,
-27678,
-27796,
-27768,
-28013,
-28127,
-28256,
-28435,
-28524,
-28543,
-28614,
-28544,
-28591,
-28544,
-28724,
-28677,
-29055,
-29055,
-29387,
-29453,
-29677,
-29606,
-29743,
-29630,
-29741,
-29676,
-29741,
-29764,
-29851,
-29987,
-30026,
-30233,
-30137,
-30275,
-30050,
-30053,
-29938,
-29879,
-29913,
-29946,
-29937,
-30076,
-29939,
-30097,
-30028,
-30098,
-30027,
-29988,
-29915,
-29811,
-29716,
-29768,
-29737,
-29834,
-29715,
-29657,
-29428,
-29258,
-29095,
-28882,
-28851,
-28571,
-28522,
-28214,
-28190,
-27948,
-27924,
-27772,
-27680,
-27506,
-27325,
-27263,
-27170,
-27262,
-27305,
-27282,
-27329,
-27126,
-26974,
-26728,
-26442,
-26219,
-25978,
-25730,
-25424,
-25222,
-24935,
-24803,
-24469,
-24139,
-23760,
-23297,
-23006,
-22677,
-22566,
-22563,
-22590,
-22739,
-22900,
-22961,
-23056,
-23004,
-22967,
-22763,
-22587,
-22345,
-22254,
-22144,
-22211,
-22189,
-22297,
-22236,
-22163,
-21947,
-21723,
-21568,
-21280,
-21104,
-20991,
-20928,
-20925,
-20970,
-21038,
-21058,
-21125,
-20972,
-20968,
-20817,
-20903,
-20882,
-21125,
-21369,
-21591,
-21966,
-22145,
-22453,
-22477,
-22522,
-22430,
-22301,
-22187,
-22145,
-22211,
-22321,
-22564,
-22877,
-23073,
-23496,
-23541,
+24368,
+24326,
+26285,
+22382,
+21812,
 23824,
-23921,
-24066,
-24275,
-24445,
-24803,
-24981,
-25331,
-25513,
-25776,
-25976,
-26154,
-26263,
-26508,
-26619,
+22180,
+21577,
+20374,
+22032,
+22579,
+21695,
+25702,
+18329,
+22504,
+25668,
+21979,
+26578,
+23288,
+28417,
+21914,
+23612,
+28454,
+23280,
+30972,
+28745,
+32257,
+31667,
+27546,
+34126,
+32937,
+32986,
+30246,
+33442,
+35828,
+37259,
+36981,
+36331,
+38704,
+32975,
+37066,
+35774,
+34542,
+36746,
+31855,
+38388,
+36370,
+32168,
+37714,
+34074,
+34565,
+32031,
+32118,
+34381,
+27698,
+35407,
+33331,
+30802,
+35273,
+32678,
+38918,
+35186,
+34688,
+37474,
+37681,
+38223,
+39320,
+42617,
+41812,
+40509,
+41457,
+45030,
+44220,
+42694,
+42179,
+45269,
+44497,
+41288,
+47777,
+45010,
+44607,
+44818,
+41533,
+45959,
+39759,
+41351,
+44400,
+40001,
+41637,
+41234,
+43277,
+39765,
+41361,
+41108,
+36218,
+37004,
+38512,
+36536,
+36571,
+38749,
+34676,
+34746,
+35432,
+37388,
+32309,
+32257,
+34543,
+32039,
+31543,
+31019,
+33114,
+33135,
+29890,
+29105,
+30085,
+29402,
+28481,
+27674,
+29242,
+27332,
+27000,
+28444,
+27089,
+26788,
+28437,
+24551,
+26250,
+27983,
+26863,
+28140,
+28420,
+27004,
+27018,
+29317,
+29749,
+29481,
+27676,
+26485,
+26780,
+29725,
+28371,
+25769,
+27168,
 26861,
-27262,
-27459,
-27992,
-28192,
-28521,
-28592,
-28698,
-28592,
-28699,
-28613,
-28943,
-28967,
-29409,
-29586,
-30075,
-30382,
-30895,
-31114,
+25636,
+26612,
+25582,
+25367,
+24397,
+22915,
+21841,
+22344,
+24924,
+22732,
+21638,
+21716,
+24051,
+23892,
+21108,
+21609,
+24391,
+24987,
+23045,
+25409,
+25281,
+24425,
+25610,
+25572,
+28934,
+29364,
+25982,
+27139,
+28611,
+29429,
+28818,
+29423,
+31758,
+27949,
+29182,
+32508,
 31425,
-31513,
-31646,
-31802,
-31957,
-32375,
-32646,
-33083,
-33287,
-33617,
-33618,
-33950,
-33950,
-34281,
-34415,
-34726,
-35080,
-35543,
-36056,
-36693,
-37122,
-37578,
-37719,
+34298,
+32649,
+33276,
+33081,
+33553,
+34887,
+33270,
+36875,
+33391,
+36248,
+39909,
+38858,
+39574,
+37658,
+38090,
+37045,
+35751,
+34881,
+38031,
+40353,
+35954,
+38818,
+39849,
+38084,
+38460,
+34378,
+37634,
+37515,
+35615,
+35200,
+35380,
+39398,
+36597,
+36968,
+39404,
+39238,
+41929,
+41558,
+39480,
+42260,
+41220,
+42229,
+42664,
+43502,
+47249,
+43558,
+44386,
+45560,
+46621,
+46841,
+43809,
+45704,
+42856,
+43198,
+44651,
+42669,
+44492,
+40463,
+40824,
+40726,
+38890,
+35570,
+35363,
+37734,
+33902,
+35916,
+35883,
+32253,
+32091,
+31952,
+30710,
+29020,
+27679,
+26452,
+25538,
+30172,
+30017,
+24597,
+26649,
+29427,
+26915,
+24078,
+25922,
+27804,
+23720,
+27565,
+28822,
+25508,
+27711,
+26409,
+28780,
+28052,
+25154,
+29905,
+29662,
+26024,
+30113,
+29356,
+28676,
+29108,
+30159,
+31290,
+29124,
+29086,
+30120,
+29165,
+29047,
+30849,
+31808,
+33202,
+29005,
+30410,
+31090,
+28657,
+29873,
+30439,
+28921,
+27395,
+30439,
+29376,
+26689,
+29598,
+30016,
+27798,
+26994,
+27277,
+27903,
+26238,
+25934,
+29577,
+28933,
+27534,
+28628,
+26501,
+27854,
+27905,
+26713,
+27038,
+28378,
+27410,
+28362,
+30344,
+28627,
+31547,
+29222,
+29648,
+28384,
+26871,
+28519,
+29350,
+32967,
+30833,
+31133,
+32244,
+32115,
+33115,
+32355,
+32667,
+31844,
+32307,
+31855,
+33579,
+34705,
+32940,
+37318,
+35963,
+34267,
+36851,
+36217,
+36412,
+35848,
+37361,
+37034,
+34447,
+37303,
+38766,
+39962,
+36857,
+36967,
+40675,
+37391,
+39229,
+39136,
+38028,
+39684,
+39423,
+40019,
+39587,
+39532,
+39778,
+38094,
+37269,
+40364,
+39616,
+40448,
+40862,
+38646,
+40837,
+38847,
+37664,
+37075,
+37179,
+38319,
+36485,
+37324,
+39101,
+37616,
+37983,
+36043,
+36350,
+35990,
+36222,
+35935,
+35334,
+35791,
+33350,
+35482,
+33784,
+35024,
+34439,
+34109,
+35088,
+34211,
+37202,
+32373,
+32326,
+34563,
+30614,
+32480,
+32040,
+33266,
+32729,
+33065,
+33652,
+31090,
+34681,
+32409,
+31023,
+30427,
+29653,
+30956,
+29840,
+32631,
+31668,
+30021,
+30522,
+29713,
+32411,
+31046,
+28396,
+26823,
+29453,
+29497,
+28829,
+30572,
+29188,
+29018,
+27520,
+27631,
+28914,
+26957,
+26018,
+26152,
+25364,
+29082,
+27289,
+27460,
+27163,
+25863,
+27052,
+24972,
+25889,
+24550,
+26629,
+26088,
+24898,
+27108,
+26436,
+27270,
+26047,
+25770,
+27139,
+26492,
+26130,
+26811,
+28010,
+28957,
+28506,
+28227,
+28536,
+28258,
+29441,
+30120,
+28235,
+31002,
+30876,
+29330,
+31031,
+30520,
+32508,
+30630,
+31887,
+33846,
+31349,
+32830,
+34222,
+32252,
+33602,
+32877,
+32050,
+34667,
+34331,
+35307,
+34016,
+35289,
+34557,
+34157,
+37005,
+35478,
+35291,
+36842,
+36966,
+36639,
+36240,
+36715,
+37732,
+37487,
+34942,
+37713,
+40683,
+37044,
+37984,
+39495,
+38236,
 37845,
-37828,
-37847,
-37982,
-38202,
-38491,
-38933,
-39244,
-39708,
+39193,
+39538,
+36907,
+39690,
+40491,
+39615,
 39953,
-40307,
-40482,
-40598,
-40657,
-40731,
-40881,
-41170,
-41505,
-42010,
-42301,
-42676,
-42833,
-42874,
-43123,
-43072,
-43410,
-43473,
-43828,
-44185,
-44624,
-45202,
-45535,
-46109,
-46155,
-46353,
-46131,
-46046,
-45775,
-45736,
-45575,
-45692,
-45709,
-46133,
-46243,
-46796,
-47085,
-47417,
-47615,
-47728,
-47704,
-47837,
-47839,
-47947,
-48060,
-48148,
-48168,
-48304,
-48235,
-48326,
-48169,
-48016,
-47835,
-47663,
-47548,
-47594,
-47684,
-47790,
-47886,
-47878,
-47730,
-47636,
-47328,
-47131,
-46727,
-46401,
-46063,
-45823,
-45712,
-45710,
-45778,
-45844,
-45933,
-45778,
-45755,
-45511,
-45381,
-45111,
-44805,
-44558,
-44204,
-44075,
-43848,
-43853,
-43716,
-43584,
-43300,
-42895,
-42569,
-42054,
-41836,
-41392,
-41238,
-40903,
-40795,
-40639,
-40505,
-40419,
-40172,
-39821,
-39442,
-38890,
-38511,
-38182,
-38002,
-38005,
-37935,
-38048,
-38092,
-38113,
-38205,
-38088,
-38074,
-37799,
-37631,
-37269,
+39063,
+40299,
+39257,
+38756,
+40565,
+38494,
+39364,
+39936,
+39132,
+38993,
+38342,
+39983,
+39164,
+39447,
+39510,
+39723,
+37350,
+35741,
+36878,
+36528,
+36371,
+35709,
+36568,
+38329,
+34937,
+34915,
+35323,
+33036,
+33060,
+32593,
+32726,
+32471,
+32446,
+31965,
+32844,
+30507,
+29217,
+30254,
+29486,
+29368,
+28433,
+31110,
+29103,
+26857,
+30605,
+28116,
+27361,
+28120,
+27409,
+27666,
+26386,
+27402,
+27629,
+26612,
+27676,
+27727,
+28715,
+26954,
+27734,
+28699,
+27331,
+26675,
+26448,
+27198,
+26245,
+26395,
+27489,
+29701,
+28714,
+28169,
+28179,
+27588,
+28151,
+27552,
+28086,
+26663,
+29056,
+28989,
+27787,
+31064,
+28700,
+30056,
+30093,
+29746,
+30025,
+28970,
+30736,
+32090,
+29810,
+30322,
+31690,
+30547,
+32779,
+32945,
+33411,
+31204,
+32503,
+32986,
+31789,
+33999,
+32133,
+34193,
+32999,
+32456,
+34492,
+33712,
+33584,
+34013,
+35161,
+34139,
+34223,
+33864,
+34821,
+34730,
+32945,
+33727,
+34247,
+36016,
+36367,
+34538,
+35291,
+35396,
+35945,
+33893,
+35117,
+36291,
+35054,
+36096,
+36993,
+37158,
+34875,
+36187,
+35488,
+36906,
+38348,
+35404,
+37168,
+37654,
+35608,
 37031,
-36673,
-36408,
-36144,
-35809,
+37482,
+36451,
+37084,
+37377,
+36884,
+36269,
+38243,
+37743,
+37321,
+38151,
+37307,
+37229,
+36510,
+36220,
+37265,
+35904,
+36288,
+37001,
+36330,
+37193,
+38731,
+37583,
+36125,
+35406,
+34941,
+35151,
+33386,
+34751,
+35023,
+34013,
+35430,
+34265,
+35113,
+35966,
+32261,
+32497,
+31596,
+31797,
+31766,
+31460,
+32296,
+30447,
+31728,
+31866,
+30406,
+30824,
+30236,
+29597,
+29302,
+29576,
+29535,
+28517,
+29121,
+28965,
+29453,
+28966,
+29085,
+27780,
+28134,
+29475,
+28041,
+29672,
+27826,
+28440,
+28841,
+27836,
+28605,
+28095,
+28840,
+27616,
+28571,
+29139,
+29190,
+29112,
+28540,
+29061,
+28336,
+27675,
+28254,
+29358,
+29026,
+28526,
+29903,
+30661,
+29501,
+28947,
+29861,
+29701,
+28798,
+30943,
+30205,
+30539,
+31848,
+31254,
+32945,
+31404,
+31265,
+31497,
+31197,
+32128,
+31768,
+33890,
+34020,
+33219,
+33877,
+33829,
+32864,
+32918,
+33615,
+33361,
+33781,
+34478,
+33366,
+33542,
+34218,
+33388,
+34169,
+33074,
+34575,
+33917,
+33242,
+34609,
+32331,
+33657,
+33279,
+32269,
+33539,
+32723,
+32727,
+34125,
+33292,
+32714,
+33399,
+34192,
+31715,
+31720,
+33617,
+32870,
+32737,
+32079,
+32638,
+33682,
+32997,
+32691,
+34413,
+33553,
+33265,
+34012,
+33159,
+33063,
+33548,
+33933,
+35039,
+34571,
+34198,
+36000,
+34978,
+35611,
+35609,
+34641,
+35674,
+35054,
+35984,
+36200,
+37802,
+37624,
+35590,
+37163,
+36593,
+36108,
+36088,
+37006,
+36740,
+35417,
+38167,
+36763,
+36334,
+37959,
+37196,
+36064,
+35890,
+36227,
+35329,
+34831,
+34331,
+35993,
+34970,
+35760,
+37419,
+35541,
+35870,
+35289,
+34122,
+34006,
+32515,
+33522,
+34118,
+33616,
+34488,
+34749,
+34961,
+33940,
+33650,
+34052,
+32696,
+32304,
+32463,
+31606,
+32244,
+32242,
+31658,
+33238,
+32278,
+31831,
+31938,
+29889,
+30896,
+29393,
+28824,
+30311,
+29476,
+29338,
+29520,
+29761,
+28471,
+28221,
+28603,
+28293,
+27450,
+27665,
+28325,
+27471,
+27816,
+28577,
+28814,
+28236,
+27838,
+27397,
+29206,
+28012,
+28136,
+29050,
+27963,
+29169,
+29967,
+30132,
+29360,
+29687,
+29234,
+29745,
+29113,
+30396,
+30948,
+30007,
+30506,
+31031,
+30916,
+29854,
+31678,
+31507,
+29943,
+30870,
+31171,
+31951,
+31448,
+31485,
+32494,
+31157,
+30777,
+31340,
+32405,
+32348,
+31412,
+31920,
+33375,
+32209,
+31138,
+31789,
+32032,
+31749,
+32336,
+32865,
+32390,
+32798,
+32242,
+33271,
+31665,
+32096,
+33574,
+31977,
+33097,
+32255,
+32852,
+33014,
+33226,
+34546,
+33117,
+33305,
+32991,
+33900,
+34390,
+33864,
+34564,
+33833,
+34871,
+34483,
+34846,
+35865,
+35562,
 35546,
-35122,
-34794,
-34369,
-34106,
-33661,
-33396,
-33086,
-32866,
-32818,
-32779,
-32794,
-32935,
-32883,
-33067,
-32862,
-33022,
-32818,
-32976,
-32909,
-32975,
-33109,
-33085,
-33219,
-33263,
-33219,
-33241,
-33064,
-32843,
-32598,
-32244,
-31913,
-31601,
-31426,
+35579,
+36594,
+35781,
+35369,
+36713,
+36791,
+35992,
+36414,
+38027,
+37181,
+36963,
+38637,
+37011,
+39116,
+37612,
+36050,
+38591,
+36537,
+38572,
+38203,
+38630,
+40719,
+38047,
+39702,
+38161,
+38972,
+38291,
+37479,
+39846,
+37994,
+39704,
+38831,
+38665,
+40164,
+39133,
+38565,
+37933,
+38160,
+39593,
+37172,
+37942,
+37813,
+36726,
+37466,
+35887,
+37918,
+36910,
+35602,
+34929,
+35153,
+33387,
+33765,
+33545,
+33411,
 31269,
-31159,
-31137,
-30960,
-31025,
-31027,
-30959,
-31182,
-31136,
-31337,
-31313,
-31470,
-31624,
-31668,
-31958,
-31909,
-32182,
-32152,
-32313,
-32421,
-32421,
-32643,
-32490,
-32595,
-32425,
-32442,
-32266,
-32380,
-32241,
-32269,
-32176,
-32068,
-31912,
-31913,
-31778,
-31913,
-31823,
-31912,
-31934,
-32002,
-32177,
-32333,
-32532,
-32776,
-32865,
-33041,
-33021,
+31309,
+33251,
+29143,
+29997,
+32220,
+29189,
+28379,
+26686,
+27735,
+27569,
+25713,
+28137,
+25096,
+26707,
+25148,
+24777,
+26607,
+23471,
+25463,
+22799,
+23528,
+25252,
+22834,
+25348,
+23401,
+24957,
+23754,
+23570,
+25797,
+23442,
+25143,
+23207,
+26448,
+27016,
+23647,
+25960,
+27008,
+27896,
+26061,
+26613,
+28753,
+26748,
+28172,
+29620,
+29576,
+30023,
+29239,
+29621,
+30856,
+30100,
+31151,
+30994,
+31140,
+33355,
+30854,
+32157,
+32145,
+32083,
+33648,
+32153,
+33311,
+32408,
+33078,
+32588,
+32432,
+34921,
+32025,
+32902,
+33932,
+32644,
+33774,
+34134,
+32990,
+32276,
+32835,
+32092,
+33142,
+34967,
 33194,
-33222,
-33416,
-33531,
-33682,
+33553,
+33546,
+33603,
+33949,
+33730,
+33541,
+32644,
+33829,
+34833,
+34256,
+35192,
+35314,
+35406,
+35836,
+34696,
+36416,
+35664,
+36001,
+37288,
+36240,
+37608,
+37728,
+37221,
+38856,
+39150,
+38875,
+37665,
+38736,
+40408,
+38707,
+39819,
+39895,
+38627,
+40907,
+40448,
+40312,
+40477,
+39804,
+40868,
+39430,
+40096,
+38899,
+39568,
+40615,
+38390,
+40554,
+39276,
+38627,
+37580,
+37062,
+39167,
+36291,
+36911,
+37304,
+36945,
+37633,
+35762,
+35536,
+34310,
+34337,
+33436,
+33727,
+34744,
+31761,
+33585,
+33871,
+32127,
+31884,
+31827,
+29831,
+30106,
+30184,
+29639,
+29439,
+28934,
+29470,
+28204,
+28565,
+28029,
+27250,
+25698,
+26395,
+26278,
+27065,
+26516,
+24901,
+25440,
+25316,
+26439,
+25812,
+24880,
+23939,
+23721,
+25400,
+25370,
+25780,
+25434,
+25023,
+25497,
+25857,
+25988,
+25896,
+26110,
+25655,
+26975,
+28280,
+28408,
+26835,
+27508,
+27866,
+28843,
+29420,
+28923,
+29858,
+27996,
+29756,
+31115,
+31577,
+30835,
+28961,
+31546,
+31309,
+31106,
+32065,
+31802,
+31412,
+30341,
+34368,
+34736,
+32381,
+32235,
+32011,
+30630,
+31904,
 33818,
-33972,
-34038,
-34261,
-34369,
-34439,
-34435,
-34395,
-34325,
-34194,
-34083,
-34061,
-33970,
-33864,
-33881,
-33642,
-33749,
-33486,
-33571,
-33421,
-33461,
-33418,
+32498,
+33256,
+33137,
+35114,
+34794,
+33798,
+32803,
+32145,
+32927,
+32916,
+34561,
+34271,
+33977,
+34153,
+35129,
+36715,
+35116,
+34114,
+34376,
+34215,
+34525,
+35442,
+35886,
+36549,
+36958,
+37484,
+36973,
+37818,
+37048,
+36883,
+37008,
+36586,
+38116,
+36934,
+39573,
+39491,
+38431,
+39166,
+38074,
+38693,
+38884,
+38988,
+39646,
+39132,
+40093,
+40338,
+40411,
+40155,
+38958,
+38280,
+37287,
+39105,
+38004,
+39059,
+39925,
+38352,
+39976,
+37903,
+37878,
+39187,
+35872,
+35499,
+34658,
+36747,
+37190,
+35592,
+36978,
+32952,
+33893,
+32700,
+32786,
+35541,
+32545,
+31576,
+30019,
+30271,
+31762,
+30877,
+30898,
+31048,
+29892,
+27300,
+27960,
+28320,
+27478,
+27481,
+27339,
+30479,
+27327,
+26665,
+26307,
+26175,
+25561,
+22583,
+25619,
+25752,
+26073,
+27353,
+26895,
+25680,
+26318,
+23247,
+24463,
+26707,
+23116,
+23708,
+25858,
+27260,
+24335,
+26004,
+26950,
+22562,
+23662,
+24143,
+33080,
+35311,
+26240,
+25240,
+25104,
+25750,
+26561,
+26840,
+30073,
+28450,
+29362,
+32935,
+34836,
+34542,
+32987,
+28726,
+31593,
+33373,
+30319,
+32237,
+31430,
+36260,
+34925,
+37147,
+35574,
+33360,
+37844,
+34842,
+36297,
+36903,
+36791,
+37613,
+36433,
+36477,
+35798,
+37292,
+38288,
+34949,
+32921,
 33376,
-33393,
-33399,
-33417,
-33551,
-33596,
-33683,
-33620,
-33482,
-33332,
-32973,
-32778,
+38367,
+47790,
+48087,
+44001,
+34382,
+25950,
+28373,
+29835,
+41093,
+42453,
+36375,
+36817,
+32609,
+40975,
+46374,
+38559,
+35798,
+23684,
+27469,
+34232,
+33788,
+37240,
+32738,
+37591,
+36646,
+36011,
+40602,
+34507,
+32505,
+30864,
+31363,
+34628,
+29290,
+31552,
+35092,
+39179,
+41922,
+38307,
+36007,
+34749,
+36059,
+36458,
+36235,
+35576,
+35855,
+35638,
+35014,
+38342,
+40837,
+41802,
+38631,
+33967,
+36985,
+36111,
+37665,
+38996,
+36087,
+35664,
+32496,
+35109,
+38365,
+37050,
+35103,
+30939,
+30074,
+32824,
+32400,
+32336,
+29229,
+26390,
+26937,
+26503,
+35183,
+36575,
+32716,
+30610,
+25089,
+24925,
+21420,
+21095,
+22453,
+22802,
+26313,
+25978,
+29475,
+31944,
+30848,
+29390,
+26616,
+23334,
+22166,
+22158,
+20176,
+21537,
+24346,
+29019,
+30006,
+32326,
+33918,
+31205,
+31028,
+27549,
+24830,
+24279,
+24335,
+26185,
+27532,
+29831,
+32452,
+31187,
+30461,
+30907,
+30950,
+31099,
+31159,
+30266,
+30417,
+31028,
+30430,
+30133,
+29752,
+29382,
+29328,
+31275,
+33345,
+33625,
+33730,
+33422,
+32799,
+31650,
+31257,
+31823,
+31451,
+32174,
+33225,
+33067,
+35557,
+37809,
+37899,
+40116,
+40095,
+37996,
+36378,
+35132,
+35392,
+37095,
+38827,
+40302,
+42205,
+42771,
+43469,
+42866,
+43568,
+44113,
+40938,
+38484,
+38023,
+39132,
+38545,
+39843,
+40697,
+38752,
+39249,
+40918,
+41339,
+39800,
+37265,
+33176,
+30042,
+30503,
+33069,
+32284,
+30333,
+29707,
+28213,
+29380,
+28927,
+29216,
+29469,
+27155,
+25293,
+23332,
+23791,
+24496,
+24556,
+25075,
+24728,
+27227,
+28929,
+29565,
+32513,
+32930,
+30533,
+27163,
+25463,
+27760,
+29739,
+32216,
+33064,
+32887,
+33517,
+35636,
+38270,
+37509,
+37137,
+35585,
+33632,
+31123,
+29879,
+30955,
+32192,
+32061,
 32532,
-32309,
-32202,
-32044,
-31847,
-31600,
-31448,
-31158,
-30918,
-30624,
-30254,
-29827,
-29522,
-29165,
-28988,
-28834,
-28722,
-28723,
-28522,
-28481,
-28167,
-27971,
-27680,
-27373,
-27149,
-26863,
-26596,
-26329,
-26200,
-25885,
-25779,
-25288,
-25002,
-24536,
-24071,
-23629,
-23361,
-23010,
-22917,
-22678,
-22607,
-22435,
-22253,
-22123,
-21855,
-21725,
-21478,
-21128,
-20968,
-20572,
-20417,
-20282,
-20242,
-20304,
-20307,
-20304,
-20174,
-20039,
-19821,
-19706,
-19641,
-19531,
-19530,
-19443,
-19442,
-19441,
-19398,
-19465,
-19374,
-19288,
-18999,
-18821,
-18491,
-18310,
-18248,
-18134,
-18357,
-18357,
-18599,
-18624,
-18821,
-18822,
-19043,
-18911,
-19153,
-19066,
-19464,
-19553,
-20084,
-20439,
-20859,
-21258,
-21414,
-21612,
-21681,
-21610,
-21770,
-21589,
-21768,
-21636,
-21678,
+33634,
+34422,
+35556,
+34142,
+34452,
+36534,
+37125,
+37067,
+36793,
+38581,
+40868,
+41255,
+42544,
+42955,
+42537,
+43207,
+44091,
+46510,
+49191,
+50947,
+52156,
+51333,
+49955,
+51561,
+52403,
+52131,
+52253,
+51704,
+52354,
+51804,
+48839,
+45278,
+40957,
+38145,
+36581,
+35527,
+34539,
+34495,
+32374,
+27739,
+24786,
+21191,
+18216,
+15499,
+12686,
+12634,
+13123,
+13765,
+14017,
+11962,
+10013,
+8099,
+5933,
+2902,
+1620,
+1725,
+2848,
+4683,
+6650,
+8817,
+10643,
+10331,
+7662,
+5109,
+2121,
+254,
+65535,
+18,
+65535,
+8,
+65535,
+15,
+65535,
+65535,
+351,
+5113,
+15388,
+24744,
+33707,
+38438,
+38662,
+38775,
+35661,
+33093,
+32513,
+37309,
+46451,
+57456,
+65447,
+65534,
+65476,
+65534,
+65460,
+65534,
+65492,
+65534,
+65520,
+65534,
+65519,
+65534,
+65476,
+65534,
+65377,
+65534,
+63914,
+57737,
+50595,
+40425,
+30705,
 21569,
-21634,
-21635,
-21724,
-21767,
-21636,
-21610,
-21483,
-21432,
-21661,
-21918,
-22503,
-23072,
-23606,
-24227,
-24491,
-25026,
-25243,
-25601,
-25974,
-26044,
-26374,
-26354,
-26528,
-26753,
-27015,
-27240,
-27415,
-27417,
-27302,
-26999,
-26924,
-26578,
-26594,
-26530,
-26708,
-26772,
-27129,
-27305,
-27725,
-28059,
-28234,
-28481,
-28367,
-28612,
-28590,
-28944,
-29254,
-29742,
-30183,
-30496,
-30760,
-30960,
-31047,
-31226,
-31225,
+12401,
+6532,
+2985,
+3339,
+5733,
+8043,
+11533,
+13958,
+14150,
+16859,
+17152,
+18601,
+21179,
+23190,
+28511,
+33284,
+40392,
+46918,
+54599,
+62891,
+65534,
+65498,
+65534,
+65534,
+65496,
+65534,
+65425,
+65534,
+64918,
+63081,
+63020,
+64564,
+65492,
+65534,
+65482,
+60801,
+52572,
+42381,
+33154,
+25608,
+20722,
+17310,
+14203,
+12142,
+9995,
+8417,
+5773,
+2038,
+65535,
+54,
+65535,
+65535,
+17,
+65535,
+15,
+65535,
+10,
+65535,
+6,
+65535,
+1,
+7,
+65535,
+45,
+65535,
+123,
+65535,
+256,
+65535,
+1768,
+15396,
+31211,
+40093,
+39440,
+32561,
+23471,
+14429,
+8916,
+12008,
+25756,
+46470,
+63390,
+65534,
+65290,
+65534,
+65435,
+65534,
+65429,
+65534,
+60786,
+55306,
+53383,
+53817,
+57157,
+61175,
+64282,
+63961,
+61247,
+55965,
+43656,
+28784,
+10551,
+65535,
+214,
+65535,
+65535,
+316,
+65535,
+2679,
+11240,
+16912,
+17638,
+14985,
+12519,
+10553,
+11197,
+15229,
+24054,
+36130,
+48003,
+59754,
+65534,
+65506,
+65533,
+65534,
+65511,
+65534,
+65510,
+65534,
+65513,
+65534,
+65508,
+65534,
+65505,
+65534,
+65534,
+65490,
+65534,
+61069,
+52667,
+42991,
+33729,
+26651,
+21934,
+20391,
+18314,
+16924,
+15444,
+12269,
+10490,
+8485,
+6861,
+6227,
+4289,
+3406,
+2144,
+123,
+14,
+4,
+1365,
+3308,
+3804,
+3409,
+1155,
+65535,
+49,
+65535,
+65535,
+65535,
+44,
+65535,
+263,
+65535,
+7098,
+23363,
+36838,
+46601,
+48529,
+42157,
+32757,
+23465,
+19440,
+23201,
+37493,
+59077,
+65534,
+64992,
+65534,
+65292,
+65534,
+65479,
+65485,
+65534,
+55507,
+44399,
+42009,
+43926,
+49525,
+56503,
+63130,
+65098,
+59643,
+48481,
+33596,
+12136,
+65535,
+183,
+23,
+65535,
+313,
+65535,
+2752,
+15115,
+24897,
+28370,
+27161,
+21536,
+16403,
+14721,
+17065,
+22984,
+32832,
+46072,
+60209,
+65534,
+65305,
+65534,
+65494,
+65528,
+65534,
+65461,
+65534,
+64984,
+62979,
+61282,
+61269,
+61204,
+59520,
+55760,
+48277,
+38632,
+27948,
+17196,
+8141,
+2214,
+506,
+1711,
+5380,
+9383,
+12485,
+13577,
+11581,
+9117,
+7214,
+6112,
+6773,
+9112,
+11716,
+16135,
+19675,
+21986,
+24112,
+23052,
+21036,
+17360,
+10726,
+3627,
+65535,
+15,
+16,
+65535,
+50,
+65535,
+75,
+65535,
+84,
+65535,
+42,
+2,
+269,
+13901,
+34581,
+47008,
+52607,
+51340,
+47610,
+45623,
+47279,
+58940,
+65534,
+65191,
+65534,
+65474,
+65517,
+65534,
+65422,
+65534,
+65352,
+65534,
+64657,
+58589,
+54423,
+53531,
+53807,
+54173,
+54990,
+51738,
+41424,
+27126,
+8506,
+65535,
+241,
+65535,
+65535,
+304,
+65535,
+4421,
+18721,
+28460,
+32182,
+34003,
+35428,
+36871,
+38707,
+44299,
+52229,
+60640,
+65511,
+65503,
+65534,
+65526,
+65534,
+65507,
+65534,
+65479,
+65534,
+64978,
+57407,
+49729,
+48551,
+48880,
+50535,
+51235,
+47800,
+41950,
+30952,
+18532,
+9093,
+1750,
+65535,
+22,
+206,
+4197,
+8541,
+12682,
+16743,
+20119,
+22353,
+22976,
+23687,
+22644,
+21347,
+21653,
+23103,
+26051,
+28671,
+31854,
+34634,
+32896,
+26713,
+18022,
+7346,
+358,
+65535,
+52,
+65535,
+56,
+65535,
+39,
+65535,
+65535,
+48,
+65535,
+199,
+65535,
+509,
+65535,
+4939,
+28352,
+51995,
+64645,
+65534,
+65324,
+65534,
+65410,
+65534,
+65491,
+65534,
+65528,
+65534,
+65507,
+65534,
+65411,
+65534,
+65187,
+65534,
+60798,
+43032,
+29281,
+23328,
+20446,
+19903,
+22321,
+25550,
+24539,
+16504,
+4672,
+65535,
+136,
+5,
+65535,
+300,
+65535,
+4981,
+21273,
+36600,
+48127,
+56149,
+60491,
+62128,
+62179,
+60830,
+61728,
+64973,
+65534,
+65503,
+65526,
+65534,
+65435,
+65534,
+65312,
+65534,
+63646,
+49904,
+36312,
+28465,
+24625,
+26392,
+30129,
+34573,
+38875,
+40694,
+38763,
+33326,
+25827,
+17996,
+12048,
+8135,
+7274,
+11032,
+17768,
+27005,
+38038,
+47055,
+52562,
+53806,
+50101,
+45260,
+39159,
+33559,
+32326,
+33895,
+36592,
+37926,
+37348,
+35981,
+31354,
+22811,
+10858,
+1050,
+65535,
+153,
+65535,
+78,
+65535,
+14,
+11,
+65535,
+28,
+65535,
+65535,
+104,
+65535,
+424,
+65535,
+14639,
+49557,
+65534,
+65300,
+65534,
+65469,
+65534,
+65534,
+65505,
+65534,
+65483,
+65534,
+65459,
+65534,
+65434,
+65534,
+65437,
+65534,
+65093,
+47333,
+17271,
+822,
+65535,
+364,
+65535,
+3336,
+14379,
+23055,
+24054,
+16374,
+4385,
+65535,
+318,
+65535,
+441,
+65535,
+5147,
+23545,
+41756,
+58887,
+65534,
+65080,
+65534,
+63897,
+54676,
+45243,
+40665,
+41922,
+48185,
+56352,
+63818,
+65534,
+65534,
+60984,
+47809,
+31701,
+15129,
+2693,
+65535,
+445,
+65535,
+6353,
+23023,
+38141,
+49633,
+56132,
+56329,
+48927,
+37971,
+27069,
+19395,
+17430,
+20958,
 31249,
-31158,
-30982,
-30915,
-30871,
-31049,
-31226,
-31534,
-31471,
-31489,
-31206,
-30980,
-30850,
-30826,
-31049,
-31225,
-31514,
-31691,
-32087,
-32181,
-32729,
-32800,
-33063,
-32975,
-32909,
-32732,
-32798,
-32952,
-33376,
-33726,
-34107,
-34280,
-34461,
-34547,
-34638,
-34767,
-34749,
-34679,
-34439,
-34326,
-34193,
-34504,
-34658,
-35035,
-35058,
-34880,
-34526,
-34259,
-34106,
-34259,
-34393,
-34726,
-34790,
-35059,
-35168,
-35388,
-35768,
-35897,
-36189,
-35987,
-36076,
-35855,
-36142,
-36343,
-36828,
-37097,
-37425,
-37540,
-37626,
-37604,
-37539,
-37493,
-37295,
-37072,
-36941,
-36717,
-36855,
-36936,
-37053,
-37249,
-37028,
-37032,
-36737,
-36676,
-36630,
-36694,
-36922,
-37068,
-37322,
-37622,
-37807,
-38288,
-38450,
-38886,
-39046,
-39287,
-39420,
-39578,
+47728,
+63023,
+65534,
+65320,
+65534,
+65376,
+65534,
+55683,
+41496,
+33080,
+29602,
+32171,
+38216,
+42922,
+45540,
+43333,
+35943,
+20284,
+2587,
+65535,
+348,
+65535,
+170,
+65535,
+52,
+65535,
+9,
+65535,
+72,
+65535,
+239,
+65535,
+568,
+65535,
+9518,
+46301,
+65534,
+65069,
+65534,
+65408,
+65534,
+65534,
+65487,
+65534,
+65465,
+65534,
+65448,
+65534,
+65421,
+65534,
+65398,
+65534,
+64722,
+44202,
+12747,
+65535,
+116,
+65535,
+152,
+65535,
+8203,
+21283,
+26392,
+25616,
+18219,
+6396,
+65535,
+65535,
+188,
+65535,
+7658,
+25027,
+44332,
+61306,
+65534,
+65286,
+65534,
+65534,
+60608,
+49638,
+41398,
+38152,
+39512,
+44453,
+50524,
+55104,
+56345,
+54314,
+46216,
+33322,
+18346,
+3858,
+65535,
+399,
+65535,
+1103,
+15050,
+34117,
+47984,
+58073,
+62433,
+60657,
+52045,
+40938,
+31734,
+26341,
+26628,
+32200,
+43709,
+59427,
+65534,
+65446,
+65396,
+65534,
+62467,
+46647,
+29592,
+17792,
+12039,
+12207,
+16274,
+22693,
+26992,
+27176,
+23740,
+12149,
+678,
+65535,
+124,
+65535,
+94,
+65535,
+39,
+65535,
+20,
+65535,
+95,
+65535,
+287,
+65535,
+658,
+65535,
+10051,
+48123,
+65534,
+64899,
+65534,
+65323,
+65534,
+65511,
+65512,
+65534,
+65474,
+65534,
+65442,
+65534,
+65390,
+65534,
+65288,
+65534,
+62518,
+35197,
+5505,
+65535,
+159,
+65535,
+65535,
+166,
+65535,
+1594,
+15769,
+29053,
+33734,
+32152,
+24442,
+17330,
+12887,
+12175,
+19819,
+32407,
+50828,
+64917,
+65534,
+65331,
+65534,
+65206,
+65534,
+63560,
+50767,
+37647,
+29549,
+25562,
+27360,
+32137,
+37885,
+42178,
+43073,
+37157,
+26631,
+13718,
+2020,
+65535,
+604,
+65535,
+5704,
+24979,
+47617,
+63935,
+65534,
+65396,
+65534,
+65534,
+64831,
+55268,
+46565,
+42084,
+42601,
+48702,
+56810,
+64205,
+65534,
+65329,
+59269,
+45754,
+31066,
+16222,
+4061,
+65535,
+241,
+65535,
+2386,
+7615,
+10496,
+9978,
+3517,
+65535,
+194,
+65535,
+45,
+65535,
+1,
+65535,
+13,
+65535,
+38,
+65535,
+23,
+13,
+65535,
+113,
+462,
+21949,
+56336,
+65534,
+65070,
+65534,
+65380,
+65534,
+65492,
+65534,
+65459,
+65534,
+61325,
+58761,
+63268,
+65534,
+65212,
+65534,
+64408,
+50124,
+25989,
+4895,
+65535,
+401,
+65535,
+21,
+185,
+65535,
+8638,
+26628,
+38954,
+45482,
+43183,
+33481,
+23711,
+16016,
+13102,
+16948,
+25848,
+38575,
+52661,
+62415,
+65471,
+65534,
+62673,
+52870,
 39707,
-39865,
-40039,
-40221,
-40281,
-40266,
-40105,
-39843,
-39442,
-39133,
-38823,
-38711,
-38691,
-38754,
-38937,
-39173,
-39358,
-39617,
-39776,
-39976,
-40128,
-40351,
-40529,
-40971,
-41369,
-41926,
-42452,
-42901,
-43207,
-43408,
-43407,
-43408,
-43319,
-43097,
-42966,
-42741,
-42545,
-42477,
-42367,
-42366,
-42146,
-42033,
-41637,
-41347,
-41148,
-40928,
-41126,
-41436,
-41946,
-42609,
-43255,
-43849,
-44450,
-44734,
-45161,
-45198,
-45361,
-45486,
-45403,
-45733,
-45667,
-45933,
-45931,
-45869,
-45752,
-45339,
-45109,
-44474,
-44225,
-43630,
-43497,
-43229,
-43321,
-43427,
-43565,
-43784,
-43850,
-43896,
-43827,
-43763,
-43940,
-43982,
-44428,
-44713,
-45292,
-45644,
-46043,
-46221,
-46176,
-45999,
-45623,
-45202,
-44692,
-44294,
-43872,
-43585,
-43409,
-43251,
-43188,
-43117,
-42901,
-42697,
-42368,
-42012,
-41723,
-41571,
-41412,
-41661,
-41743,
-42149,
-42230,
-42435,
-42411,
-42343,
-42192,
-41942,
-41773,
-41521,
-41395,
-41279,
-41106,
-41103,
-40794,
-40751,
-40349,
-39999,
-39574,
-39111,
-38558,
-38312,
-37783,
-37781,
-37649,
-37693,
-37737,
-37649,
-37539,
-37293,
-37052,
-36762,
-36607,
-36521,
-36451,
-36432,
-36408,
-36320,
-36363,
-36211,
-36163,
-35945,
-35743,
-35300,
-35015,
-34635,
-34349,
-34216,
-33971,
-33951,
-33838,
-33729,
-33596,
-33394,
-33089,
-32817,
-32424,
-32110,
-31980,
-31755,
-31759,
-31711,
-31581,
-31625,
-31312,
-31338,
-31113,
-30983,
-30894,
-30670,
-30451,
-30339,
-30052,
-30251,
-30029,
-30296,
-30139,
-30097,
-29807,
-29454,
-29099,
-28855,
-28591,
-28543,
-28416,
-28452,
-28351,
-28387,
-28171,
-28145,
-27882,
-27681,
-27461,
-27172,
-26972,
-26840,
-26686,
-26661,
-26664,
-26618,
-26795,
-26730,
-26862,
-26684,
-26597,
-26331,
-26063,
-26000,
-25886,
-26022,
-26019,
-26087,
-25932,
-25843,
-25555,
-25357,
-25176,
-24982,
-24868,
-24734,
-24540,
-24531,
-24431,
-24421,
-24475,
-24332,
-24408,
-24067,
-24030,
-23627,
-23628,
-23364,
-23515,
-23497,
-23672,
-23916,
-24094,
-24203,
-24272,
-24091,
-23897,
-23691,
-23455,
-23271,
-23275,
-23074,
-23186,
-22918,
-23076,
-22741,
-22965,
-22630,
-22788,
-22453,
-22300,
-22034,
-21854,
-21770,
-21767,
-21789,
-21925,
-21875,
-21970,
-21832,
-21946,
-21790,
-21944,
-21769,
-22031,
-21881,
-22208,
-22081,
-22318,
-22147,
-22076,
-21923,
-21657,
-21502,
-21413,
-21193,
-21211,
-21084,
-21057,
-20993,
-21061,
-21032,
-21043,
-20964,
-20664,
-20549,
-20193,
-20199,
-20080,
-20264,
-20437,
-20662,
-20970,
-21235,
-21525,
-21766,
-21925,
-21987,
-22058,
-21898,
-21924,
-21790,
-21855,
-21836,
-21833,
-21811,
-21770,
-21699,
-21724,
-21680,
-21656,
-21568,
-21437,
-21389,
-21326,
-21348,
-21431,
-21553,
-21694,
-21819,
-21961,
-22038,
-22340,
-22502,
-22983,
-23187,
-23738,
-23939,
-24447,
-24736,
-25068,
-25378,
-25445,
-25531,
-25447,
-25309,
-25204,
-24954,
-24915,
-24712,
-24692,
-24648,
+28013,
+18431,
+13068,
+11812,
+15648,
+24157,
+31860,
+39126,
+42888,
+41829,
+36894,
+29949,
+22494,
+16892,
+14660,
+17434,
+27368,
+44274,
+62124,
+65534,
+65221,
+65534,
+65534,
+65353,
+65534,
+62561,
+47010,
+34473,
+29496,
+28718,
+33474,
+40389,
+46012,
+47636,
+44101,
+33789,
+21927,
+8745,
+18,
+65535,
+70,
+65535,
+268,
+5896,
+13467,
+18336,
+19611,
+16178,
+7592,
+152,
+65535,
+4,
+10,
+65535,
+84,
+65535,
+986,
+5734,
+3490,
+65535,
+175,
+65535,
+271,
+65535,
+17746,
+52630,
+65534,
+65079,
+65534,
+65384,
+65534,
+65534,
+65236,
+65534,
+58387,
+47358,
+47256,
+57576,
+65534,
+65534,
+65227,
+65534,
+62261,
+43703,
 24801,
-24868,
-25225,
-25309,
-25624,
-25797,
-25999,
-26331,
-26662,
-27039,
-27416,
-27792,
-28125,
-28479,
-28766,
-29078,
-29386,
-29654,
-29918,
-30074,
-30184,
-30251,
-30340,
-30493,
-30564,
-30602,
-30718,
-30538,
-30560,
-30297,
-30184,
-30007,
-30007,
-30052,
-30339,
-30584,
-31180,
-31626,
-32374,
-32891,
-33635,
-34176,
-34611,
-35037,
-35078,
-35368,
-35235,
-35390,
-35411,
-35566,
-35767,
-35876,
-36100,
-36075,
-36120,
-36032,
-35878,
-35853,
-35724,
-35764,
-35811,
-35967,
-36140,
-36233,
-36387,
-36428,
+8699,
+65535,
+149,
+65535,
+65535,
+741,
+15205,
+35871,
+48980,
+53986,
+48535,
+36866,
+24200,
+15097,
+9505,
+7908,
+10184,
+15860,
+26719,
+36945,
+45938,
+53152,
+54443,
+49793,
+38794,
+26525,
+17190,
+11553,
+9646,
+12810,
+20443,
+29449,
+38327,
+44521,
+47660,
+46936,
+43098,
+35561,
+26420,
+19692,
+18123,
+25586,
+38210,
+55895,
+65534,
+65262,
+65534,
+65534,
+65259,
+65534,
+58784,
+39961,
+22247,
+11021,
+6717,
+9736,
+17895,
+27549,
+35597,
+39456,
+35993,
+27594,
+18540,
+8556,
+1681,
+65535,
+220,
+4978,
+13896,
+22894,
+30109,
+35714,
+37678,
+33748,
+25419,
+13770,
+3241,
+65535,
+94,
+65535,
+29,
+65535,
+133,
+230,
+65535,
+32,
+20,
+65535,
+233,
+65535,
+13918,
+46780,
+65310,
+65466,
+65534,
+65417,
+65534,
+65213,
+65534,
+61817,
+47156,
+40136,
+43617,
+57176,
+65534,
+65445,
+65478,
+65534,
+64758,
+49711,
+30298,
+10105,
+65535,
+446,
+65535,
+359,
+65535,
+12107,
+34627,
+47886,
+51420,
+45170,
+34806,
+23687,
+13675,
+4785,
+9,
+388,
+8071,
+22873,
+38988,
+57019,
+65534,
+65199,
+65534,
+60900,
+50981,
+43811,
+38626,
+34818,
+33664,
+35979,
+41839,
+48670,
+54817,
+60097,
+60711,
+55945,
+45317,
+32782,
+23818,
+19955,
+23151,
+30250,
+41319,
+57168,
+65534,
+65534,
+65382,
+65534,
+62895,
+49750,
+32205,
+17257,
+7699,
+5472,
+9321,
+16695,
+25889,
+35099,
+42768,
+45278,
+42944,
+37504,
+28601,
+19577,
+12270,
+9919,
+13492,
+20408,
+28495,
+34684,
+38153,
+38749,
+35854,
+28734,
+17710,
+5418,
+65535,
+117,
+65535,
+21,
+65535,
+15,
+65535,
+29,
+65535,
+65535,
+64,
+65535,
+413,
+65535,
+12437,
+43406,
+63443,
+65534,
+65397,
+65534,
+65500,
+65534,
+65328,
+65534,
+55417,
+43533,
+44595,
+55777,
+65146,
+65534,
+65231,
+65534,
+64192,
+49037,
+27056,
+6347,
+65535,
+736,
+65535,
+673,
+65535,
+5325,
+27229,
+43096,
+48085,
+44184,
+34639,
+24385,
+14850,
+5206,
+307,
+65535,
+6023,
+23464,
+45222,
+63151,
+65534,
+65019,
+65534,
+64244,
+54582,
+43364,
+35587,
+27783,
+23318,
+23165,
+27494,
+36544,
+45638,
+52462,
+55228,
+51887,
+42855,
+31278,
+21463,
+15182,
+15352,
+20808,
+30086,
+45968,
+61598,
+65534,
+65437,
+65423,
+65534,
+59339,
+41943,
+26999,
+17370,
+13677,
+17232,
+25054,
+35255,
+46196,
+56698,
+62941,
+62823,
+57506,
+46642,
+34733,
+25322,
+20254,
+21565,
+26731,
+33978,
+41112,
+44870,
+46284,
+44858,
+38123,
+26818,
+9418,
+65535,
+247,
+65535,
+19,
+29,
+65535,
+76,
+65535,
+108,
+65535,
+148,
+65535,
+162,
+65535,
+495,
+18686,
+47512,
+64299,
+65534,
+65390,
+65534,
+65534,
+65278,
+65534,
+61985,
+45986,
+38789,
+44650,
+54605,
+63730,
+65534,
+65534,
+62946,
+51836,
+36677,
+16221,
+878,
+65535,
+274,
+65535,
+554,
+65535,
+5794,
+23160,
+33835,
+36828,
+33901,
+27839,
+22356,
+16089,
+10353,
+7261,
+10334,
+22551,
+41399,
+60320,
+65534,
+65148,
+65534,
+65278,
+65534,
+61119,
+50997,
+40385,
+29552,
+23027,
+22167,
+27641,
 36590,
-36845,
-37124,
-37533,
-38029,
-38356,
-38955,
-39311,
-39952,
-40461,
-40907,
-41256,
-41285,
-41145,
-40774,
-40482,
-40221,
-40171,
-40154,
-40261,
-40373,
-40398,
-40459,
-40573,
-40485,
-40681,
-40465,
-40548,
-40507,
-40595,
-40881,
-41062,
-41522,
-41728,
-42098,
-42412,
-42722,
-43140,
-43365,
-43628,
-43696,
-43874,
-43982,
-44384,
-44668,
-45071,
+43625,
+47018,
+45202,
+40040,
+33080,
+25214,
+17706,
+9548,
+4236,
+3962,
+11468,
+27383,
+44038,
+59466,
+65534,
+65181,
+65534,
+59715,
+47912,
+37449,
+29335,
+25954,
+28221,
+35864,
+46731,
+59170,
+65534,
+65474,
+65433,
+65534,
+59636,
+48851,
+40317,
+33637,
+30954,
+31328,
+34436,
+38105,
+39116,
+37581,
+31542,
+23031,
+10797,
+650,
+65535,
+100,
+65535,
+81,
+65535,
+48,
+65535,
+43,
+65535,
+93,
+65535,
+176,
+65535,
+276,
+65535,
+2018,
+27141,
+56720,
+65534,
+65534,
+65427,
+65534,
+65479,
+65468,
+65534,
+49958,
+30271,
+23712,
+28171,
+40554,
+53989,
+63942,
+65534,
+64238,
+56388,
+41553,
+20658,
+1890,
+65535,
+348,
+65535,
+527,
+65535,
+11653,
+33258,
+45903,
+53101,
+53983,
+51107,
 45178,
-45159,
-44758,
-44471,
-44094,
-43806,
-43741,
-43561,
-43543,
-43471,
-43500,
-43647,
-43810,
-44114,
-44184,
-44227,
-44227,
-44205,
-44338,
-44581,
-44803,
-45115,
-45287,
-45538,
-45796,
-46157,
-46440,
-46599,
-46706,
-46466,
-46397,
-46265,
-46376,
-46552,
-46732,
-46706,
-46466,
-46131,
-45777,
-45515,
-45331,
-45160,
-44979,
-44781,
-44538,
-44603,
-44759,
-45024,
-45336,
-45576,
-45670,
-45775,
-45735,
-45820,
-45913,
-45953,
-46089,
-46042,
-46155,
-46264,
-46400,
-46483,
-46534,
-46262,
-46068,
-45754,
-45534,
-45379,
-45313,
-45091,
-44980,
-44737,
-44514,
+34964,
+24725,
+18995,
+22281,
+34881,
+54859,
+65534,
+65403,
+65524,
+65534,
+65414,
+65534,
+64928,
+53444,
+35064,
+19517,
+10606,
+10975,
+18519,
+28496,
+36134,
+39871,
+37295,
+31270,
+23704,
+15818,
+7994,
+445,
+65535,
+148,
+55,
+14919,
+36873,
+56205,
+65534,
+65312,
+65534,
+65534,
+60603,
+49400,
+38105,
+30482,
+29088,
+36350,
+51028,
+63924,
+65534,
+65381,
+65534,
+65468,
+65395,
+58277,
+46140,
+33909,
+23936,
+18457,
+18286,
+21936,
+25451,
+24661,
+19645,
+11960,
+2992,
+65535,
+149,
+65535,
+45,
+65535,
+1,
+9,
+65535,
+3,
+15,
+65535,
+85,
+65535,
+192,
+65535,
+339,
+65535,
+2157,
+25478,
+53736,
+65472,
+65534,
+65215,
+65534,
+64981,
+65534,
+61496,
+38881,
+19700,
+13473,
+17893,
+29557,
+43599,
+57045,
+63446,
+64002,
+57218,
+44606,
+27465,
+6489,
+65535,
+306,
+99,
+65535,
+9710,
+33137,
+54305,
+65482,
+65475,
+65534,
+65428,
+65534,
+62596,
+50210,
+39387,
+36951,
+42365,
+54120,
+64512,
+65534,
+65408,
+65534,
+65458,
+65270,
+56351,
+40570,
+23636,
+7036,
+69,
+65535,
+2809,
+11242,
+19064,
+25272,
+27758,
+27461,
+24665,
+19130,
+14343,
+6548,
+444,
+65535,
+3291,
+19228,
+40372,
+58423,
+65534,
+65305,
+65534,
+65445,
+65534,
+61839,
+53294,
+46896,
+43881,
+45870,
+56853,
+65318,
+65534,
+65401,
+65534,
+63956,
+53639,
+40653,
+30243,
+20564,
+14533,
+11383,
+11088,
+15293,
+20162,
+22438,
+19359,
+8954,
+503,
+65535,
+78,
+65535,
+63,
+65535,
+34,
+65535,
+0,
+22,
+65535,
+1478,
+3445,
+1975,
+65535,
+23,
+112,
+65535,
+592,
+65535,
+10713,
+36621,
+56281,
+65534,
+65343,
+65534,
+65252,
+65534,
+60290,
+38791,
+21075,
+11760,
+14855,
+29384,
+47884,
+63661,
+65534,
+65093,
+65534,
+65025,
+65534,
+61242,
+42435,
+25409,
+14895,
+15400,
+27808,
+43893,
+60829,
+65534,
+65346,
+65534,
+65534,
+63322,
+48317,
+29851,
+11468,
+395,
+65535,
+1992,
+13273,
+26593,
+35694,
+42148,
+45532,
+47597,
+46445,
+40636,
+31766,
+21382,
+14972,
+15766,
+23793,
+37450,
+49498,
+58783,
+64714,
+65534,
+65138,
+60929,
+52285,
+40913,
+27046,
+15177,
+9802,
+10810,
+18082,
+29491,
+39772,
+48206,
+53773,
+55788,
+54893,
+50204,
+43855,
+38282,
+34348,
+34520,
+40485,
+49911,
+60495,
+65534,
+65523,
+65423,
+65534,
+63662,
+56712,
+49513,
+42582,
+36927,
+33445,
+31242,
+30610,
+28398,
+23604,
+15496,
+3935,
+65535,
+263,
+65535,
+77,
+65535,
+5,
+8,
+65535,
+12,
+65535,
+8,
+65535,
+16,
+65535,
+50,
+65535,
+103,
+65535,
+157,
+65535,
+716,
+13892,
+38839,
+60897,
+65534,
+65129,
+65534,
+65359,
+65534,
+65304,
+57999,
+43566,
+35350,
+36953,
+48159,
+62912,
+65534,
+65234,
+65534,
+65496,
+65401,
+65534,
+60369,
 44361,
-44160,
-43940,
-43673,
-43497,
-43251,
-43166,
-43095,
-43233,
-43272,
-43567,
-43558,
-43854,
-43848,
-43986,
-43849,
-43852,
-43561,
-43476,
-43228,
-43233,
-43096,
-43120,
-42833,
-42630,
-42236,
-41922,
-41570,
-41303,
-41017,
-40703,
-40375,
-40129,
-39929,
-39844,
-39751,
-39687,
-39466,
-39308,
-39002,
-38821,
-38647,
-38623,
+28087,
+18470,
+17360,
+25801,
+41054,
+53900,
+61786,
+63740,
+61889,
+57686,
+47436,
+35264,
+20486,
+4530,
+65535,
+491,
+65535,
+3065,
+14582,
+25586,
+32799,
+37285,
+39997,
+40851,
 38511,
-38582,
-38510,
-38448,
-38578,
-38469,
-38624,
-38379,
-38158,
-37827,
-37381,
-36988,
-36625,
-36170,
-35894,
-35417,
-35052,
-34729,
-34324,
-34173,
-33860,
-33729,
-33507,
-33329,
-33153,
-33019,
-32998,
-32842,
-32798,
-32621,
-32422,
-32332,
-32068,
-31956,
-31756,
-31561,
-31332,
-31118,
-30936,
-30783,
-30605,
-30406,
-30162,
-29875,
-29542,
-29164,
-28880,
-28454,
-28260,
-27879,
-27771,
-27460,
-27393,
-27283,
-27106,
-27194,
-26908,
-26970,
-26798,
-26793,
-26710,
-26594,
-26421,
-26284,
-26066,
-25976,
-25843,
-25799,
-25621,
-25512,
-25266,
-25069,
-24846,
-24691,
-24581,
-24558,
-24470,
-24359,
-24316,
-24091,
-24140,
-23870,
-23917,
-23673,
-23672,
-23496,
-23318,
-23272,
-23078,
-23138,
-23098,
-23097,
-23183,
-23167,
-23204,
-23099,
-23028,
-22788,
-22809,
-22630,
-22656,
-22739,
-22569,
-22805,
-22523,
-22786,
-22475,
-22634,
-22518,
-22546,
-22474,
-22456,
-22341,
-22346,
-22297,
-22347,
-22407,
-22367,
-22499,
-22319,
-22480,
-22186,
-22344,
-22146,
-22297,
+33249,
+27082,
+22605,
+22771,
+29691,
+40954,
+54053,
+63663,
+65534,
+65382,
+65534,
+65092,
+57280,
+43737,
+30336,
+17952,
+9462,
+8382,
+14627,
+24283,
+35508,
+44680,
+50934,
+56755,
+59239,
+58297,
+54143,
+46900,
+41431,
+39024,
+40202,
+46295,
+55265,
+63025,
+65534,
+65469,
+65530,
+65534,
+61384,
+52318,
+42595,
+33488,
+26867,
+23066,
+20791,
+19485,
+17531,
+12523,
+4064,
+65535,
+132,
+65535,
+18,
+3,
+65535,
+17,
+65535,
+10,
+65535,
+7,
+65535,
+16,
+65535,
+35,
+65535,
+71,
+65535,
+503,
+5399,
+13626,
 22323,
-22476,
-22541,
-22679,
-22584,
-22634,
-22386,
-22412,
-22253,
-22278,
-22277,
-22232,
-22324,
-22229,
-22392,
-22317,
-22547,
-22495,
-22590,
-22519,
-22522,
-22498,
-22476,
-22499,
-22720,
-22698,
-23009,
-22962,
-23054,
-23073,
-22965,
-22985,
-22875,
-22877,
-22939,
-22966,
-23161,
-23209,
-23295,
-23341,
-23317,
-23431,
-23316,
-23387,
-23249,
-23320,
-23118,
-23297,
-23295,
-23496,
-23671,
-23785,
-23981,
-23962,
-23937,
-23983,
-23783,
-23917,
-23759,
-23809,
-23802,
-23874,
-23871,
-24026,
-23874,
-23980,
-23919,
-23914,
-24072,
-24182,
-24535,
-24693,
-24979,
-25178,
-25291,
-25553,
-25557,
-25687,
-25645,
-25620,
-25358,
-25376,
-25158,
-25356,
-25376,
-25602,
-25553,
-25690,
-25443,
-25423,
-25245,
-25200,
-25269,
-25243,
-25379,
-25423,
-25686,
-25868,
-26262,
-26531,
-26883,
-27218,
-27479,
-27797,
-28143,
-28437,
-28899,
-29164,
-29522,
-29607,
-29744,
-29562,
-29454,
-29165,
-28945,
-28523,
-28368,
-28036,
-27969,
-28036,
-28016,
-28297,
-28352,
-28518,
-28593,
-28654,
-28946,
-29009,
-29521,
-29852,
-30383,
-30872,
-31446,
-31846,
-32466,
-32732,
-33262,
-33442,
-33704,
-33796,
-33907,
-33925,
-33975,
-34080,
-33951,
-33995,
-33661,
-33419,
-32930,
-32644,
-32266,
-32222,
-32157,
-32420,
-32644,
-33130,
-33617,
-34063,
-34699,
-35151,
-35694,
-36037,
-36582,
-36721,
-37316,
-37581,
-38159,
-38513,
-38911,
-39134,
-39308,
-39333,
-39309,
-39158,
-39018,
-38849,
-38664,
-38515,
-38379,
-38203,
-38224,
-38070,
-38091,
-37961,
-37934,
-37962,
-38044,
-38448,
-38889,
-39421,
-40085,
-40505,
-41216,
-41458,
-42080,
-42188,
-42633,
-42632,
-42921,
-42787,
-43009,
-42987,
-43120,
-43274,
-43297,
-43253,
-43075,
-42788,
-42433,
-42188,
-41927,
-41853,
-41751,
-41830,
-41795,
-41899,
-42014,
-42166,
-42389,
-42565,
-42767,
-42897,
-43120,
-43320,
-43538,
-43965,
-44091,
-44406,
-44493,
-44470,
-44539,
-44359,
-44404,
-44162,
-44136,
-43899,
-43824,
-43633,
-43559,
-43455,
-43295,
-43077,
-42786,
-42501,
-42210,
-42191,
-42099,
-42258,
-42299,
-42434,
-42476,
-42611,
-42698,
-42810,
-42833,
-42896,
-42812,
-42784,
-42680,
-42741,
-42678,
-42877,
-42784,
-42792,
-42606,
-42392,
-42254,
-41970,
-41832,
-41618,
-41476,
-41285,
-41124,
-41083,
-40948,
-40863,
-40746,
-40488,
-40347,
-40043,
-40064,
-39971,
-40068,
-40102,
-40200,
-40150,
-40196,
-40197,
-40217,
-40285,
-40174,
-40041,
-39841,
-39732,
-39530,
-39578,
-39462,
-39512,
-39352,
-39179,
-38888,
-38734,
-38536,
-38400,
-38271,
-38245,
-37938,
-38069,
-37738,
-37848,
-37692,
-37629,
-37580,
-37274,
-37183,
-37029,
-36895,
-36986,
-36938,
-36986,
-37050,
-36962,
-36918,
-36830,
-36806,
-36586,
-36519,
-36208,
-36079,
-35807,
-35725,
-35631,
-35611,
-35657,
-35454,
-35458,
-35189,
-35213,
-34946,
-35057,
-34904,
-34922,
+30388,
+39682,
+53946,
+64895,
+65534,
+65365,
+65534,
+65294,
+65534,
+63892,
+57385,
+51104,
+46514,
+46117,
+52477,
+61920,
+65534,
+65321,
+65534,
+65403,
+65534,
+64893,
+58451,
+49603,
+41198,
+35279,
+34374,
+37649,
+44191,
+51652,
+55999,
+55655,
+51377,
+43698,
+32655,
+21320,
+11629,
+3056,
+65535,
+155,
+65535,
+153,
+6243,
+15789,
+23430,
+29484,
+33578,
+36995,
+40595,
+43649,
+44777,
+44476,
+44085,
+44904,
+48604,
+53764,
+57672,
+59141,
+59047,
+58473,
+56377,
+52040,
+46329,
+40151,
+33383,
+27291,
+23707,
+23908,
+27554,
+31417,
+34920,
+36967,
+37237,
+37266,
+35640,
+33353,
+30552,
+27620,
+25809,
+25454,
+28788,
+35116,
+42284,
+47453,
+49664,
+50665,
+49683,
+46920,
+42702,
+36665,
+30063,
+22844,
+16564,
+12968,
+11263,
+11025,
+9836,
+7034,
+4296,
+2059,
+537,
+65535,
+2,
+12,
+65535,
+24,
+65535,
+11,
+65535,
+84,
+3412,
+8694,
+14218,
+20805,
+26059,
+30216,
+33246,
+34755,
+36401,
+35689,
+35640,
+36905,
+34198,
+32756,
+36434,
+46911,
+56540,
+57419,
+57049,
+56070,
+53884,
+49526,
+44226,
+39990,
+30872,
+24652,
+27299,
+33761,
+40833,
+46321,
+52832,
+56700,
+53759,
+50978,
+50338,
+47771,
+44292,
+41937,
+41958,
+43589,
+48848,
+59022,
+65189,
+65534,
+63177,
+57741,
+49175,
+38532,
+31834,
+26951,
+19887,
+13576,
+12395,
+16194,
+21180,
+26225,
+30473,
+31256,
+27350,
+23089,
+21489,
+21039,
+20455,
+19305,
+18241,
+19436,
+25151,
+34243,
+43211,
+48373,
+49597,
+48411,
+45653,
+43484,
+42716,
+43276,
+43316,
+43033,
+45181,
+50407,
+58210,
+64047,
+65534,
+63562,
+58314,
+52175,
+45028,
+37985,
+31158,
+24044,
+17941,
+14276,
+14319,
+16791,
+19013,
+19637,
+19132,
+17923,
+16167,
+13527,
+10146,
+6993,
+5071,
+5322,
+8680,
+14656,
+21467,
+28627,
+34298,
+38355,
+40989,
+41307,
+40357,
+38237,
+36153,
+35159,
+35184,
+35930,
+37271,
+38230,
+37190,
+35256,
+33634,
+31944,
+29343,
+25070,
+20657,
+18731,
+17901,
+19202,
+22185,
+23781,
+24941,
+24112,
+22063,
+18772,
+13958,
+6100,
+65535,
+373,
+65535,
+2730,
+12016,
+17427,
+23862,
+30312,
+34905,
+37024,
+36937,
+34224,
+25293,
+17439,
+19818,
+31421,
+42335,
+54185,
+64688,
+65534,
+65425,
+65534,
+65534,
+65418,
+65534,
+63173,
+55158,
+48551,
+47105,
+50964,
+52802,
+50782,
+49005,
+47930,
+44212,
+37573,
+31955,
+25389,
+15789,
+7807,
+6751,
+10576,
+13524,
+16266,
+20631,
+23619,
+23547,
+23219,
+24149,
+25547,
+26055,
+25418,
+25915,
+28125,
+32442,
+38062,
+42165,
+44155,
+45930,
+47751,
+47336,
+45692,
+44068,
+43520,
+43712,
+41825,
+40118,
+40287,
+40140,
+38416,
+36286,
+34890,
+34208,
+33787,
+31987,
+30780,
+31156,
+31052,
+31469,
+32392,
+33312,
 34728,
-34656,
-34504,
-34505,
-34347,
-34483,
-34215,
-34214,
-33886,
-33748,
-33642,
-33505,
-33574,
-33375,
-33460,
-33200,
-33171,
-33000,
-32842,
-32797,
-32623,
-32574,
-32269,
-32242,
-32002,
-32089,
-32133,
-32091,
-32176,
-32002,
-31978,
-31890,
-31801,
-31713,
-31625,
-31446,
-31248,
-31093,
-30958,
-30918,
-30913,
-30850,
-30761,
-30670,
-30496,
-30427,
-30384,
-30252,
-30294,
-30052,
-30029,
-29853,
-29807,
-29765,
-29718,
-29586,
-29522,
-29253,
-29165,
-29034,
-28920,
-28925,
-28830,
-28703,
-28610,
-28480,
-28346,
-28213,
-28169,
-27947,
-27948,
-27614,
-27683,
-27459,
-27660,
-27571,
-27725,
-27683,
-27768,
-27661,
-27704,
-27525,
-27507,
-27257,
-27153,
-26926,
-26732,
-26616,
-26465,
-26307,
-26220,
-25932,
-25799,
-25555,
-25335,
-25220,
-25049,
-24932,
-24916,
-24756,
-24869,
-24802,
-24846,
-24981,
-24933,
-25115,
-25042,
-25138,
-25133,
-25289,
-25291,
-25531,
-25490,
-25644,
-25532,
-25402,
-25243,
-24981,
-24779,
-24447,
-24207,
-23869,
-23630,
-23318,
-23161,
-22945,
-22850,
-22722,
-22653,
-22565,
-22477,
-22410,
-22497,
-22523,
-22763,
-22898,
-23096,
-23275,
-23493,
-23587,
-23803,
-23850,
-23962,
-23936,
-23985,
-23891,
-23964,
-23846,
-23809,
-23715,
-23406,
-23364,
-22940,
-22788,
-22432,
-22188,
-21878,
-21813,
-21545,
-21614,
-21500,
-21725,
-21766,
-22125,
-22251,
-22591,
-22783,
-22988,
-23273,
-23474,
-23804,
-24029,
+35331,
+34438,
+33811,
+34169,
+35052,
+36680,
+38608,
+40706,
+43424,
+46115,
+47398,
+48251,
+48630,
+47267,
+43793,
+38464,
+34139,
+30675,
+26554,
+23708,
+22699,
+22333,
+22333,
+21594,
+21375,
+20551,
+17160,
+14307,
+10796,
+6522,
+3683,
+3593,
+6730,
+9472,
+12134,
+16801,
+19998,
+22457,
+24955,
+24581,
+23894,
+21595,
+18792,
+19063,
+19250,
+18214,
+17088,
+15577,
+16172,
+24032,
+29991,
+28072,
+26869,
+26959,
+26146,
+23139,
+19066,
+17977,
+17722,
+15916,
+18219,
+26673,
+32481,
+35575,
+42285,
+48230,
+49831,
+49623,
+47289,
+44814,
+45084,
+48899,
+55111,
+59585,
+63686,
+65534,
+65356,
+65534,
+65518,
+65453,
+65534,
+59280,
+50638,
+45695,
+40290,
+35213,
+31582,
+29964,
+27690,
 24268,
-24383,
-24514,
-24513,
-24605,
-24600,
-24649,
-24668,
-24559,
-24492,
-24227,
-24181,
-24005,
-23938,
-23873,
-23738,
-23651,
-23540,
-23516,
-23498,
-23735,
-23898,
-24223,
-24429,
-24821,
+21494,
+16451,
+9807,
+3932,
+357,
+65535,
+104,
+65535,
+352,
+4018,
+9195,
+14272,
+18912,
+23045,
+27042,
+30791,
+34974,
+39720,
+44016,
+47460,
+51074,
+54443,
+56500,
+57297,
+57991,
+57415,
+55243,
+53174,
+51441,
+50427,
+50357,
+51614,
+52204,
+50932,
+49441,
+47935,
+45382,
+40892,
+37282,
+36000,
+33981,
+32226,
+32838,
+33520,
+33450,
+33356,
+32702,
+30778,
+28188,
+26026,
+24250,
+22659,
+22226,
+24343,
+27184,
+29215,
+32161,
+35513,
+36307,
+34950,
+32528,
+28815,
+24655,
+21263,
+20520,
+22391,
+25788,
+30825,
+36128,
+39963,
+42150,
+43151,
+44014,
+43805,
+41392,
+38593,
+36574,
+34095,
+31766,
+31704,
+29805,
+25770,
+21670,
+16487,
+11111,
+3762,
+65535,
+111,
+65535,
+65535,
+90,
+65535,
+172,
+65535,
+967,
+7903,
+12124,
+14743,
+17764,
+16880,
+16054,
+21285,
+32088,
+38874,
+43452,
+53555,
+62636,
+65534,
+65519,
+65494,
+65534,
+61968,
+60181,
+61466,
+59332,
+58861,
+62683,
+65349,
+65534,
+65307,
+65534,
+62366,
+52981,
+46542,
+40670,
+32324,
+26422,
+23993,
+22987,
+22491,
+24710,
+28516,
+29164,
+27276,
 24981,
-25510,
-25756,
-26241,
+22860,
+20119,
+16689,
+14101,
+11480,
+10559,
+12733,
+15104,
+16898,
+18226,
+18682,
+19792,
+21832,
+23677,
+24885,
+25715,
+26213,
 26508,
-26817,
-26974,
-27171,
+29588,
+34518,
+38921,
+42622,
+44473,
+47359,
+51551,
+54676,
+56996,
+56719,
+55139,
+54129,
+52611,
+52248,
+52450,
+52231,
+52696,
+53302,
+54777,
+55920,
+56609,
+56526,
+54600,
+52845,
+51272,
+49350,
+45329,
+40671,
+39230,
+39565,
+39428,
+39433,
+38512,
+37754,
+37514,
+36713,
+36799,
+35634,
+33150,
+30024,
+27488,
+26314,
+26766,
+26392,
+23614,
+19864,
+17321,
+18317,
+19251,
+19293,
+17317,
+16277,
+17687,
+18943,
+22144,
+27548,
+28799,
+25656,
+26516,
+26035,
+21721,
+20984,
+19220,
+13985,
+12199,
+11529,
+8332,
+5391,
+2477,
+466,
+65535,
+270,
+65535,
+2033,
+4404,
+1375,
+4380,
+8874,
+11191,
+12635,
+13853,
+15233,
+13627,
+14160,
+18390,
+22860,
+26426,
+29314,
+33634,
+37126,
+39139,
+43433,
+44248,
+41358,
+41236,
+42802,
+45385,
+48038,
+51177,
+56046,
+59324,
+61040,
+64072,
+65534,
+63968,
+60736,
+57797,
+55786,
+53138,
+51521,
+50572,
+48698,
+47514,
+46043,
+45217,
+44860,
+42399,
+39518,
+37527,
+35417,
+33646,
+30348,
+27590,
+24505,
+22223,
+21736,
+19988,
+18852,
+18785,
+20770,
+21888,
+22980,
+26125,
+28218,
+27528,
+27809,
+30187,
+31605,
+33123,
+33677,
+34763,
+38120,
+41833,
+45555,
+47423,
+46455,
+45902,
+45593,
+44993,
+43567,
+42445,
+42586,
+41159,
+42902,
+47200,
+51349,
+52941,
+52774,
+53458,
+52827,
+55011,
+56584,
+54414,
+53317,
+54817,
+57768,
+61159,
+59895,
+58170,
+57253,
+54759,
+48800,
+41635,
+38543,
+29036,
+20987,
+18884,
+15306,
+10546,
+11756,
+6526,
+5498,
+6916,
+2323,
+4881,
+1264,
+65535,
+2,
+2942,
+4278,
+8041,
+21181,
+24158,
+26628,
+39016,
+39062,
+36992,
+43544,
+41281,
+33609,
+32516,
+35498,
 27395,
-27525,
-27727,
-27770,
-27836,
-27748,
-27837,
-27725,
-27882,
-27792,
-27902,
-27793,
-27770,
-27748,
-27726,
-27880,
-27993,
-28189,
-28349,
-28520,
-28681,
-28986,
-29279,
-29650,
-30010,
-30249,
-30539,
-30740,
-31045,
-31274,
-31576,
-31782,
-31932,
-32158,
+24145,
+34004,
+32920,
+25394,
+24998,
+24316,
+19103,
+11201,
+10425,
+5988,
+65535,
+317,
+65535,
+29,
+24,
+65535,
+36,
+65535,
+65535,
+857,
+2989,
+2877,
+5222,
+11504,
+12989,
+18479,
+28902,
+32775,
+39895,
+48526,
+50432,
+52999,
+61027,
+65534,
+65254,
+65534,
+65529,
+65516,
+65534,
+65505,
+65534,
+65503,
+65534,
+65488,
+65534,
+65493,
+64297,
+59110,
+52636,
+49778,
+45213,
+39449,
+33863,
+31980,
+26981,
+19028,
+17692,
+12418,
+4980,
+4505,
+7624,
+3090,
+5106,
+12171,
+7249,
+11332,
+17927,
+12915,
+18409,
+24663,
+24145,
+26401,
+31139,
+41093,
+41839,
+44511,
+55221,
+56843,
+53064,
+55990,
+62210,
+56963,
+52220,
+55894,
+55502,
+49059,
+48127,
+52161,
+48656,
+39612,
+43667,
+46246,
+34869,
+35314,
+40405,
+31034,
+26817,
+36514,
 32176,
-32446,
-32330,
-32601,
-32376,
-32600,
-32398,
-32578,
-32508,
-32734,
-32730,
-32932,
-33041,
-33175,
-33440,
-33618,
-33773,
-34016,
-34061,
-34303,
-34461,
-34612,
-34972,
-35055,
-35280,
-35477,
-35502,
-35853,
-35900,
-36120,
-36320,
-36299,
-36495,
-36520,
-36674,
-36829,
-36920,
-37047,
-37055,
-37069,
-37097,
-37206,
-37270,
-37476,
-37555,
-37675,
-37801,
-37872,
-38047,
-38202,
-38403,
-38467,
-38581,
-38510,
-38560,
-38621,
-38690,
-38914,
-38951,
-39160,
-39129,
-39267,
-39288,
-39532,
-39552,
-39755,
-39684,
-39756,
-39705,
-39824,
-39793,
-40066,
-39973,
-40241,
-40084,
-40220,
-40128,
-40308,
-40305,
-40463,
-40461,
-40530,
-40548,
-40597,
-40614,
-40752,
-40749,
-40838,
-40751,
-40726,
-40618,
-40593,
-40530,
-40482,
-40530,
-40373,
-40460,
-40310,
-40435,
-40378,
-40480,
-40465,
-40526,
-40463,
-40572,
-40483,
-40596,
-40726,
-40707,
-40904,
-40817,
-40947,
-40929,
-40925,
-41040,
-40947,
-40995,
-40992,
-40817,
-40883,
-40704,
-40684,
-40529,
-40350,
-40108,
-39908,
-39641,
-39533,
-39265,
-39288,
-39155,
-39221,
-39222,
-39265,
-39377,
-39531,
-39598,
-39642,
-39709,
-39664,
-39687,
-39731,
-39708,
-39798,
-39841,
-39842,
-39908,
-39864,
-39907,
-39800,
-39816,
-39534,
-39463,
-39201,
-39021,
-38867,
-38668,
-38512,
-38336,
-38137,
-37912,
-37851,
-37757,
-37827,
-37806,
-37910,
-37875,
-38065,
-38073,
-38313,
-38400,
-38448,
-38511,
-38336,
-38292,
-38201,
-38248,
-38158,
-38357,
-38203,
-38335,
-38203,
-38247,
-38246,
-38159,
-38114,
-37848,
-37693,
-37406,
-37248,
-37120,
-37049,
-36984,
-37009,
-36848,
-36965,
-36783,
-36962,
-36876,
-36959,
-36899,
-36893,
-36742,
-36807,
-36741,
-36850,
-36898,
-36938,
-36941,
-36830,
-36872,
-36852,
-36874,
-36917,
-36852,
-36852,
-36717,
-36609,
-36542,
-36384,
-36389,
-36251,
-36056,
-35964,
-35745,
-35721,
-35678,
-35589,
-35676,
-35524,
-35522,
-35323,
-35235,
-35100,
+22835,
+33794,
+33781,
+26583,
+35881,
+41679,
+35756,
+36357,
+44812,
+41577,
+35079,
+44524,
+39490,
+29323,
+37074,
+32152,
+24386,
+29405,
+33507,
+11706,
+27713,
+33364,
+4644,
+33385,
+26064,
+10967,
+29123,
+25635,
+19214,
+23175,
+29451,
+19741,
+22322,
+38142,
+14987,
+27920,
+34772,
+10438,
+35387,
+22836,
+19443,
+28619,
+21758,
+20325,
+17240,
+29261,
+14808,
+11635,
+31662,
+15249,
+20740,
+29975,
+26839,
+31361,
 34993,
-34900,
-34728,
-34700,
-34440,
-34566,
-34464,
-34455,
-34553,
-34342,
-34421,
-34166,
-34088,
-33924,
-33774,
-33595,
-33441,
-33240,
-33132,
-32907,
-32888,
-32709,
-32687,
-32488,
-32400,
-32222,
-32045,
-31845,
-31757,
-31515,
-31489,
-31139,
-31113,
-30805,
-30761,
-30605,
-30449,
-30364,
-30204,
-30120,
-30029,
-29895,
+42755,
+35015,
+43977,
+46194,
+35146,
+41890,
+43677,
+40414,
+38892,
+41905,
+45625,
+36001,
+40691,
+43732,
+32344,
+37545,
+33173,
+24611,
+25084,
+20579,
+20565,
+16289,
+17161,
+16328,
+11129,
+15839,
+15061,
+11742,
+10405,
+11560,
+8811,
+3657,
+12380,
+11160,
+9196,
+22835,
+21588,
+23048,
+35861,
+35490,
+36114,
+44965,
+42952,
+41389,
+45541,
+45153,
+45719,
+51228,
+54751,
+51912,
+54972,
+59542,
+57413,
+55290,
+55883,
+54003,
+50253,
+48820,
+44199,
+46412,
+46517,
+42767,
+44429,
+46973,
+48468,
+42850,
+45936,
+45383,
+43628,
+40570,
+33924,
+42732,
+33706,
 29833,
-29715,
-29569,
-29428,
-29189,
-29033,
-28766,
-28590,
-28369,
-28212,
-28081,
-27903,
-27837,
-27703,
-27637,
-27594,
-27415,
-27416,
-27150,
-27128,
-26950,
-26886,
-26771,
-26686,
-26553,
-26461,
-26377,
-26286,
-26196,
-26044,
-25931,
-25755,
-25599,
-25467,
-25245,
-25223,
-24913,
-25001,
-24581,
-24691,
-24382,
-24446,
-24295,
-24358,
-24227,
-24358,
-24316,
-24446,
-24539,
-24579,
-24714,
-24647,
-24734,
-24695,
-24688,
-24694,
-24645,
-24603,
-24537,
-24426,
-24403,
-24315,
-24271,
-24136,
-24117,
-23961,
+34677,
+29939,
+29836,
+28543,
+33220,
+27655,
+29075,
+27374,
+22329,
+29180,
+23264,
 23937,
-23763,
-23825,
-23741,
-23871,
-23873,
-23893,
-24005,
-24071,
-24138,
-24426,
-24381,
-24757,
-24715,
-24912,
-25113,
-25134,
-25421,
-25358,
-25487,
-25513,
-25509,
-25601,
-25553,
-25668,
-25621,
-25710,
-25733,
-25776,
-25910,
-25976,
-26152,
-26222,
-26372,
-26400,
-26528,
-26707,
-26751,
-27018,
-27037,
-27177,
-27321,
-27355,
-27522,
-27618,
-27659,
-27856,
-27731,
-27964,
-27909,
-27986,
-28151,
-28033,
-28281,
-28214,
-28322,
-28525,
-28610,
-28902,
-29052,
-29302,
-29449,
-29791,
-29959,
-30297,
-30428,
-30604,
-30740,
-30760,
-30959,
-30894,
-31136,
-31026,
-31160,
-31092,
-31115,
-31070,
-31137,
-31159,
-31070,
-31159,
-30961,
-31068,
-31029,
-31112,
-31227,
-31269,
-31491,
-31492,
-31757,
-31911,
-32179,
-32398,
-32644,
-32776,
-33041,
-33131,
-33374,
-33506,
-33575,
-33659,
-33577,
-33614,
-33554,
-33505,
-33552,
-33440,
-33374,
-33374,
-33197,
-33330,
-33129,
-33264,
-33131,
-33129,
-33065,
-33041,
-33130,
-33198,
-33284,
-33486,
-33461,
-33730,
-33794,
-34017,
-34215,
-34327,
-34546,
-34485,
-34722,
-34638,
-34726,
-34810,
-34642,
-34763,
-34532,
-34543,
-34308,
-34346,
-34107,
-34236,
-33928,
-34062,
-33881,
-33886,
-33904,
-33905,
-33974,
-33969,
-34064,
-34080,
-34218,
-34302,
-34483,
-34569,
+26468,
+29010,
+24143,
+24474,
+37834,
+31544,
+30602,
+36519,
+38716,
+31665,
+31310,
+40544,
+33258,
+28418,
+35115,
+39854,
+28415,
+35846,
+41931,
+34201,
+37450,
+38974,
+36675,
+37778,
+31817,
+30793,
+41485,
+33581,
+32235,
+41815,
+41442,
+40352,
+39573,
+45335,
+43129,
 34837,
-34835,
-35125,
-35100,
-35368,
-35412,
-35477,
-35481,
-35386,
-35326,
-35143,
-35061,
-34855,
-34727,
-34525,
-34348,
+37029,
+35710,
+32769,
+26829,
+34673,
+33403,
+29344,
+31438,
+39310,
+38018,
+31279,
+42989,
+36978,
+28214,
+28910,
+37455,
+32695,
+20591,
+38630,
+31305,
+23911,
+36654,
+28377,
 34284,
-34080,
-34197,
-34057,
-34130,
-34124,
-34130,
-34235,
-34351,
-34435,
-34616,
-34746,
-34947,
+21992,
+23345,
+27832,
+17053,
+17707,
+15623,
+15880,
+10396,
+16416,
+14960,
+10467,
+18367,
+10769,
+12183,
+16672,
+13362,
+11416,
+11882,
+17279,
+9654,
+15867,
+16348,
+14660,
+19832,
+15317,
+23976,
+23120,
+24682,
+28187,
+23833,
+32131,
+32828,
+33806,
+36020,
+39886,
+40200,
+40101,
+46740,
+44683,
+48953,
+48122,
+50513,
+52798,
+46799,
+53368,
+48684,
+49885,
+48123,
+41880,
+48234,
+44816,
+41697,
+37610,
+46950,
+39967,
+34640,
+47234,
+31064,
+35236,
+45386,
+22510,
+33465,
+45848,
+17320,
+25610,
+42112,
+23970,
+18966,
+35227,
+32946,
+19151,
+29049,
+41926,
+28463,
+25622,
+41136,
+35103,
+28802,
+39659,
+47775,
+32467,
+38052,
+54450,
+41592,
+42191,
+54413,
+47758,
+41200,
+41442,
+52093,
+41181,
+26596,
+43621,
+34842,
+24907,
+34641,
+37190,
+26396,
+27244,
+39245,
+27656,
+27344,
+41697,
+26176,
+23483,
+41027,
+33867,
+32115,
+36057,
+38574,
+41210,
+39130,
+45234,
+45111,
+40423,
+34605,
+41203,
+45151,
+29351,
+37929,
+39180,
+23205,
+38289,
+37135,
+33694,
+40527,
+26938,
+31804,
+33380,
+32672,
+27407,
+29141,
+30801,
+16653,
+31591,
+24945,
+16814,
+33247,
+22174,
+16569,
+24459,
+27240,
+20215,
+13813,
+28955,
+19137,
+11722,
+26190,
+15800,
+11832,
+19318,
+15871,
+11223,
+13356,
+20908,
+14426,
+8885,
+24423,
+17627,
+15996,
+28057,
+19401,
+26048,
+33780,
+27045,
+32488,
+41468,
+34853,
+37100,
+42400,
+41678,
+41067,
+42296,
+47789,
+38258,
+45533,
+48848,
+36044,
+51957,
+41977,
+36432,
+43629,
+39829,
+35539,
+25548,
+40308,
+28894,
+20427,
+34953,
+29117,
+27124,
+22612,
+29557,
+27784,
+20600,
+29377,
+22394,
+23466,
+25449,
+26070,
+32756,
+26641,
+31533,
+38065,
+29502,
+31891,
+38330,
+39008,
+29148,
+38893,
+44979,
+30533,
+43358,
+48810,
+37146,
+41150,
+46258,
+39125,
+37019,
+48506,
+38666,
+40092,
+42381,
+39449,
+47387,
+42568,
+44692,
+40299,
+53940,
+36003,
+32180,
+59612,
+30804,
+31715,
+48003,
+34832,
+35845,
+41525,
+41743,
+34845,
+47995,
+41838,
+36934,
+46891,
+38147,
+41848,
+37571,
+38171,
+35082,
+31599,
+39483,
+26549,
+31798,
+38076,
+29149,
+30287,
+26647,
+31366,
+25027,
+25656,
+21363,
+17907,
+24975,
+15808,
+22028,
+22582,
+17459,
+28131,
+21210,
+22250,
+28666,
+22519,
+21005,
+22959,
+29518,
+17465,
+26769,
+31063,
+22244,
+33948,
+32750,
+34996,
+33249,
+31475,
+40347,
+29566,
+34328,
+38814,
+32457,
+35952,
+34830,
+37044,
+36522,
+40153,
+33905,
+36680,
+40246,
+28019,
 35012,
-35303,
-35321,
-35635,
-35633,
+34739,
+24951,
+32618,
+29363,
+29621,
+29029,
+29054,
+35178,
+29663,
+28242,
+31717,
+32392,
+27708,
+27103,
+28075,
+27038,
+27154,
+24953,
+26552,
+30063,
+25138,
+28985,
+31160,
+25631,
+27934,
+32297,
+27010,
+22874,
+31372,
+26860,
+25069,
+26309,
+27210,
+22029,
+26894,
+29718,
+22172,
+25177,
+31845,
+29025,
+23453,
+34143,
+30928,
+33791,
+29505,
+29520,
+41536,
+29073,
+33488,
+37052,
+36942,
+38804,
+33615,
+49138,
+39868,
+37396,
+53399,
+43939,
+44133,
+45222,
+52863,
+44319,
+39736,
+57090,
+39843,
+43527,
+49122,
+39446,
+45304,
+37915,
+46905,
+39568,
+31534,
+45498,
+36173,
+33192,
+36450,
+39719,
+33233,
+28537,
+43661,
+27123,
+37755,
+40277,
+26567,
+40399,
+32582,
+34077,
+40509,
+29355,
+29858,
+39843,
+38040,
+30348,
+35163,
+43856,
+30165,
+32184,
+36600,
+27055,
+37321,
+25782,
+25374,
+37897,
+23247,
+26850,
+29914,
+23603,
+24509,
+22742,
+26496,
+20313,
+22807,
+27623,
+18934,
+24523,
+24677,
+26589,
+26538,
+21908,
+33392,
+28285,
+26944,
+39899,
+31505,
+34972,
+36842,
+37270,
+35666,
+36719,
+42540,
+36007,
+37202,
+40134,
+38416,
+37971,
+37347,
+34686,
+36753,
+37171,
+32349,
+31047,
+28840,
+34093,
+30327,
+21387,
+33349,
+25074,
+25130,
+27332,
+23151,
+29954,
+21327,
+25827,
+26929,
+23414,
+29116,
+24197,
+26513,
+28409,
+30292,
+28265,
+24416,
+29475,
+35320,
+21550,
+26626,
+38125,
+22134,
+24953,
+34995,
+26497,
+29680,
+31188,
+24908,
+30704,
+29390,
+27485,
+29430,
+27683,
+27251,
+30384,
+27744,
+31512,
+28866,
+31095,
+32751,
+28530,
+39698,
+28634,
+37901,
+40816,
+29270,
+49894,
+33096,
+40729,
+50978,
+33587,
+48159,
+43844,
+48912,
+44428,
+42435,
+53770,
+37428,
+49034,
+50787,
+41680,
+50846,
+45609,
+41104,
+51150,
+42312,
+41085,
+44556,
+40074,
+34991,
+37257,
+41057,
+31900,
+30971,
+37982,
+29887,
+26838,
+38273,
+24969,
+26040,
+30588,
+18400,
+25036,
+23777,
+18143,
+23410,
+24845,
+17622,
+22545,
+34973,
+19621,
+26812,
+36373,
+21584,
+33766,
+32123,
+26405,
+36071,
+33570,
+29758,
+34630,
+41023,
+32089,
+34977,
+40683,
+29675,
+33425,
+37707,
+27494,
+27122,
+35611,
+23279,
+25454,
+34120,
+26032,
+26964,
+29728,
+33127,
+27168,
+27112,
+35411,
+27884,
+25312,
+34536,
+30755,
+29649,
+34660,
+35730,
+30395,
+34939,
+42996,
+28418,
+32136,
+39000,
+24010,
+25935,
+31020,
+25619,
+23182,
+21772,
+26077,
+21945,
+28075,
+26779,
+22037,
+34333,
+26157,
+26594,
+36481,
+35085,
+29499,
+35743,
+44173,
+34288,
+41751,
+45254,
+36757,
+45971,
+43010,
+36927,
+44416,
+42545,
+36864,
 35875,
-35901,
-36009,
-35987,
-36012,
-35918,
-35880,
-35718,
+39087,
+40038,
+34918,
+30075,
+37164,
+34823,
+23377,
+30312,
+38443,
+22203,
+24888,
+37354,
+23249,
+29699,
+32865,
+28749,
+31449,
+30739,
+36133,
+30617,
+36100,
+39899,
+30941,
+43499,
+43163,
+37149,
+41328,
+45358,
+37230,
+34045,
+45206,
+34659,
+28774,
+40650,
+32725,
+26273,
+37438,
+32008,
+26966,
+32994,
+32591,
+26296,
+29447,
+34216,
+26382,
+27112,
+35354,
+28331,
+29648,
+33183,
+31568,
+35778,
+33354,
+31261,
+36270,
+35205,
+29630,
+34553,
+32417,
+28317,
+29857,
+28251,
+29818,
+28000,
+26956,
+28669,
+26243,
+27572,
+30857,
+26992,
+26704,
+30796,
+28789,
+27360,
+29964,
+31235,
+29091,
+29660,
+32466,
+33880,
+31743,
+33359,
+36551,
+34914,
+33800,
+36989,
+36921,
+32893,
+32638,
+35783,
+33761,
+32095,
+34473,
+34437,
+34662,
+34568,
+36402,
+40318,
+37399,
+36504,
+39674,
+38785,
+38910,
+37024,
+39581,
+38157,
+38141,
+40106,
+36357,
+44414,
+39943,
+34840,
+46066,
+40025,
+35504,
+42102,
+42172,
+30071,
+38721,
+43443,
+21977,
+39993,
+40647,
+20699,
+35756,
+36917,
+21633,
+31969,
+38779,
+17261,
+27341,
+37314,
+17431,
+26033,
+33823,
+22802,
+25166,
+32020,
+23064,
+25221,
+31326,
+21828,
+23222,
+28578,
+20078,
+22046,
+30706,
+20968,
+19948,
+30843,
+25004,
+18269,
+27256,
+29518,
+20177,
+25521,
+28006,
+26854,
+28865,
+27592,
+29868,
+30446,
+34370,
+29915,
+30712,
+40690,
+36020,
+32574,
+41233,
+39157,
+36910,
+40797,
+39111,
+38776,
+39815,
+39729,
+39924,
+40979,
+39613,
+38034,
+40589,
+39602,
+37326,
+40618,
+39998,
+37505,
+37879,
+37996,
+36760,
+35989,
+33272,
+30799,
+32803,
+30916,
+29265,
+30884,
+31850,
+31645,
+29486,
+31187,
+31196,
+27717,
+27898,
+26809,
+23785,
+25042,
+26198,
+25584,
+25070,
+27028,
+29640,
+27003,
+27485,
+29933,
+28627,
+26813,
+28759,
+29200,
+27335,
+31822,
+32340,
+30338,
+33035,
+34628,
+34402,
+35851,
+34276,
+35759,
+38731,
+35065,
+36581,
+37470,
+35033,
+36757,
+36919,
+35379,
+35455,
+37041,
+36164,
+35203,
+37522,
+38435,
+35662,
+35411,
+37312,
+34291,
+33551,
+38282,
+35073,
+33006,
+39195,
+36200,
+34795,
+38752,
+35773,
+34047,
+34745,
+33757,
+31442,
+31348,
+32954,
+30597,
+30269,
+31146,
+30647,
+29996,
+28729,
+28950,
+28647,
+26635,
+27725,
+30386,
+26592,
+27376,
+31770,
+30319,
+30466,
+33570,
+34693,
+34683,
+36530,
+38594,
+40648,
+40364,
+40521,
+43763,
+43424,
+43325,
+45823,
+45831,
+45826,
+45598,
+46753,
+46267,
+44699,
+47152,
+45009,
+43231,
+46134,
+43870,
+40904,
+41364,
+39660,
+35799,
+34949,
+32599,
+30381,
+29008,
+25942,
+25268,
+24131,
+20277,
+20627,
+21159,
+16930,
+16561,
+15388,
+12813,
+12689,
+11165,
+9467,
+9559,
+8970,
+9153,
+12131,
+10885,
+11306,
+15918,
+13342,
+14489,
+19189,
+18276,
+18369,
+21228,
+23281,
+21151,
+25849,
+29838,
+26768,
+29261,
+32628,
+33565,
+34433,
+34971,
+36172,
+36092,
+34052,
+34352,
+35054,
+35508,
+33721,
+34412,
+37509,
 35616,
-35362,
-35262,
-34986,
-34906,
+38391,
+42361,
+38281,
+40029,
+41523,
+39130,
+40219,
+41041,
+43172,
+43246,
+45136,
+46508,
+45717,
+47786,
+47218,
+45454,
+45561,
+43148,
+42602,
+42239,
+39868,
+41206,
+40521,
+37405,
+38802,
+36790,
+33377,
+35703,
+33201,
+31126,
+33210,
+32226,
+31534,
+34001,
+34113,
+33206,
+35228,
+36163,
+35640,
+36970,
+40690,
+40410,
+41140,
+44893,
+43780,
+44028,
+46034,
+45421,
+44307,
+44202,
+46104,
+44431,
+44826,
+47380,
+44540,
+45105,
+45839,
+44582,
+44893,
+43625,
+43785,
+44111,
+43072,
+43361,
+44420,
+43182,
+42370,
+42895,
+39786,
+37968,
+39167,
+35692,
+33146,
+34589,
+31982,
+28675,
+28464,
+27161,
+22850,
+21513,
+19336,
+16637,
+17475,
+14169,
+13009,
+14261,
+11143,
+10077,
+12410,
+9790,
+8898,
+11855,
+10654,
+11390,
+14340,
+14285,
+12809,
+12692,
+13228,
+12999,
+12156,
+12721,
+10530,
+7961,
+9078,
+6823,
+5949,
+6751,
+5228,
+7309,
+12612,
+15792,
+15131,
+16194,
+19933,
+18247,
+18471,
+26357,
+29553,
+30299,
+35093,
+40761,
+46255,
+49105,
+49155,
+51032,
+53826,
+52510,
+53538,
+57803,
+61445,
+64189,
+61508,
+62171,
+63338,
+61038,
+55998,
+51351,
+50507,
+45495,
+41081,
+40058,
+40269,
+38380,
+34746,
+29974,
+27347,
+25809,
+21298,
+19617,
+20073,
+18865,
+19147,
+21471,
+21127,
+24064,
+26367,
+24057,
+24401,
+26514,
+27982,
+30275,
+32042,
+34390,
+37355,
+36598,
+37784,
+41139,
+39817,
+39275,
+41820,
+42820,
+44649,
+47691,
+48347,
+50588,
+51657,
+48973,
+50018,
+50509,
+48853,
+48918,
+49055,
+49636,
+50229,
+50348,
+49449,
+47850,
+46234,
+43518,
+41719,
+40295,
+40011,
+38846,
+37458,
+36460,
+34760,
+34031,
+31535,
+29031,
+26569,
+25734,
+24268,
+22987,
+25929,
+25367,
+25188,
+26995,
+25494,
+25502,
+26535,
+24526,
+25062,
+25695,
+25429,
+27494,
+27275,
+29090,
+29595,
+29099,
+29315,
+29758,
+30745,
+29708,
+31171,
+31259,
+31467,
+32903,
+32124,
+32801,
+32671,
+32212,
+32081,
+32214,
+33909,
+33418,
+33099,
+33127,
+31081,
+30973,
+30423,
+28684,
+27953,
+26361,
+25275,
+25578,
+24227,
+22773,
+22450,
+22325,
+21179,
+23212,
+26456,
+24044,
+24178,
+26460,
+24800,
+23972,
+26809,
+28649,
+29436,
+28535,
+29941,
 34723,
-34681,
-34572,
-34656,
-34571,
-34814,
-34768,
-35060,
-35077,
-35346,
-35478,
-35655,
-35901,
+34135,
+31237,
+32334,
+35595,
+32902,
+31090,
+35708,
 36029,
-36256,
-36429,
-36563,
-36744,
-36891,
-36966,
-37026,
-37075,
-36982,
-37032,
-36914,
-36744,
-36827,
-36454,
-36629,
-36344,
-36406,
-36300,
-36252,
-36254,
-36276,
-36251,
-36368,
-36315,
-36569,
-36536,
-36811,
-36848,
-37187,
-37269,
+34724,
+34837,
+33356,
+32315,
+31910,
+29685,
+25561,
+26355,
+25990,
+21927,
+21790,
+22144,
+21992,
+18903,
+16040,
+17863,
+16610,
+14108,
+16439,
+16838,
+16520,
+18889,
+17923,
+18261,
+21139,
+20561,
+20244,
+21671,
+23141,
+23637,
+23678,
+25241,
+25431,
+25774,
+25400,
+26279,
+29628,
+31004,
+34600,
+39693,
+41897,
+44552,
+47373,
+47429,
+49098,
+50817,
+49962,
+50181,
+53526,
+55107,
+54883,
+58325,
+59630,
+59434,
+61035,
+61284,
+61172,
+61922,
+62302,
+61308,
+61455,
+60295,
+58826,
+57830,
+53796,
+52064,
+50074,
+46883,
+46108,
+45093,
+42666,
+40624,
+39427,
+36071,
+33202,
+31470,
+27558,
+24896,
+24613,
+23589,
+23692,
+24765,
+24959,
+25118,
+25235,
+25059,
+25397,
+25131,
+24665,
+25983,
+26368,
+28033,
+29915,
+30650,
+32360,
+33151,
+33844,
+34437,
+35753,
+37048,
+37361,
+38204,
+40155,
+39956,
+39055,
+40117,
+38156,
+35920,
+36165,
+34305,
+32227,
+32246,
+31561,
+30255,
+28317,
+27083,
+26152,
+23676,
+22752,
+22596,
+20986,
+20574,
+21004,
+20213,
+21211,
+21664,
+21764,
+23374,
+23182,
+24359,
+25772,
+26136,
+27223,
+27570,
+27857,
+28975,
+30291,
+29704,
+29847,
+31840,
+30682,
+30351,
+31887,
+30609,
+29538,
+29415,
+27819,
+26132,
+26049,
+25196,
+23357,
+21754,
+20974,
+20082,
+18018,
+16755,
+17073,
+16520,
+15409,
+16295,
+16236,
+16023,
+16792,
+16105,
+15449,
+16123,
+15134,
+15231,
+16530,
+15602,
+16609,
+16935,
+15686,
+16431,
+17815,
+17592,
+21659,
+29413,
+32511,
+34485,
+38945,
+41487,
+38818,
+39220,
+44129,
+45728,
+45579,
+47331,
+52638,
+56616,
+55946,
+57926,
+61276,
+62123,
+61664,
+61201,
+63888,
+65534,
+65455,
+63796,
+63628,
+65534,
+62782,
+58164,
+57931,
+57485,
+53855,
+50964,
+49702,
+49999,
+48317,
+42409,
+38818,
+36512,
+32155,
+27221,
+24570,
+23528,
+22225,
+22430,
+21272,
+21901,
+23698,
+21617,
+20228,
+19250,
+19106,
+19323,
+19296,
+21796,
+24362,
+26334,
+28381,
+30955,
+32310,
+33465,
+35854,
+35707,
+36502,
+39991,
+41944,
+42479,
+44664,
+46869,
+44606,
+43270,
+44095,
+41248,
+39460,
+40061,
+37631,
+36676,
+37457,
+35220,
+33316,
+32378,
+29740,
+25569,
+24595,
+24610,
+21645,
+21359,
+22365,
+21707,
+21323,
+21404,
+21578,
+21390,
+21358,
+21576,
+22530,
+23828,
+24863,
+26007,
+27219,
+28229,
+29618,
+30466,
+30861,
+32483,
+33032,
+33581,
+34685,
+35033,
+35423,
+35058,
+34420,
+33562,
+32523,
+31785,
+31053,
+30734,
+30429,
+29908,
+29857,
+28150,
+26641,
+25362,
+23104,
+22650,
+20387,
+20259,
+20741,
+18410,
+19959,
+20798,
+19833,
+20886,
+21646,
+21034,
+22245,
+23402,
+22803,
+24071,
+25155,
+26396,
+28341,
+30564,
+35865,
+39339,
+39942,
+42326,
+43785,
+43055,
+42202,
+43684,
+45376,
+45486,
+46033,
+45994,
+47603,
+48523,
+46547,
+47442,
+49211,
+48226,
+46290,
+45667,
+46088,
+45020,
+41747,
+39338,
+40532,
+39548,
+36180,
+37608,
+38992,
+36769,
+35897,
+35352,
+34235,
+33020,
+30973,
+28970,
+27880,
+26917,
+24951,
+24713,
+25815,
+26446,
+25975,
+25331,
+26485,
+26634,
+24781,
+24919,
+25778,
+24478,
+24791,
+25919,
+26446,
+27674,
+29060,
+29624,
+29885,
+31368,
+32011,
+32219,
+33118,
+34075,
+34480,
+34551,
+35787,
+36558,
+35946,
+35570,
+35489,
+34253,
+33811,
+34976,
+34556,
+34524,
+35919,
+35132,
+34304,
+35383,
+35110,
+34223,
+34165,
+34025,
+33436,
+33358,
+33881,
+34369,
+35495,
+35602,
+35550,
+36666,
+37011,
+36960,
+37363,
+37738,
 37564,
-37734,
-37916,
-38137,
-38245,
-38337,
-38490,
-38446,
-38602,
-38445,
-38580,
-38379,
-38403,
-38313,
-38223,
-38249,
-38134,
-38117,
-38089,
-38071,
-38135,
-38071,
-38157,
-38093,
-38090,
-38072,
-38157,
-38114,
-38269,
-38313,
-38447,
-38601,
-38778,
-38956,
-39155,
-39354,
-39421,
-39598,
-39554,
-39552,
-39535,
-39372,
-39359,
-39173,
-39047,
-38932,
-38669,
-38733,
-38469,
-38534,
-38447,
-38424,
-38357,
-38380,
-38357,
-38381,
-38468,
-38446,
-38513,
-38489,
-38492,
-38490,
-38579,
-38603,
-38621,
-38691,
-38601,
-38623,
-38647,
-38467,
-38602,
-38246,
-38226,
-37913,
-37694,
-37472,
-37249,
-37052,
-36895,
-36674,
-36520,
-36407,
-36365,
-36343,
-36407,
+37536,
+37366,
+36398,
+37575,
+37202,
+35201,
+36218,
+35113,
+33740,
+33263,
+32062,
+31505,
+30296,
+29058,
+28059,
+27449,
+26766,
+26489,
+25613,
+25335,
+25624,
+23957,
+24296,
+24861,
+23911,
+24795,
+25124,
+24976,
+25778,
+26210,
+27037,
+27728,
+28202,
+29273,
+29720,
+30040,
+31043,
+31242,
+31288,
+31552,
+32128,
+32452,
+32497,
+33896,
+34487,
+34730,
+34910,
+35393,
+35633,
+34958,
+36069,
+36324,
+35984,
+37672,
+38008,
+37354,
+38610,
+38701,
+38143,
+38188,
+37764,
+37853,
+37351,
+36900,
+37287,
+37110,
+36426,
+36468,
 36343,
-36406,
-36323,
-36363,
-36364,
-36364,
-36342,
-36275,
-36167,
-36096,
-35857,
-35808,
+36127,
+36377,
+36314,
+36497,
+36394,
+35809,
+35529,
+35389,
+35439,
+35498,
 35590,
+35699,
+35637,
+35803,
+35050,
+34859,
+35073,
+34283,
+33689,
+33601,
+33342,
+31989,
+31822,
+31185,
+30181,
+29990,
+28713,
+27850,
+26804,
+25996,
+25249,
+24750,
+24561,
+23490,
+23003,
+21883,
+21200,
+21094,
+20427,
+20319,
+19743,
+20018,
+21108,
+23010,
+25908,
+28225,
+29560,
+29554,
+29516,
+29488,
+30183,
+32023,
+33113,
+33771,
+34867,
 35522,
-35346,
-35080,
-35011,
-34771,
-34703,
-34568,
-34418,
-34234,
-34042,
-33837,
-33641,
-33461,
-33375,
-33241,
-33107,
-33022,
-32950,
-32889,
-32974,
-32909,
-32998,
-32908,
-32954,
-32797,
-32821,
-32687,
-32621,
-32510,
-32333,
-32156,
-31978,
-31869,
-31667,
-31626,
-31312,
-31316,
-31002,
-30873,
-30715,
-30495,
-30428,
-30206,
-30052,
-29897,
-29718,
-29655,
-29628,
-29523,
-29717,
-29521,
-29786,
-29697,
-29896,
-29920,
-30049,
-30010,
-30139,
-29985,
-30096,
-29896,
-29986,
-29763,
-29786,
-29630,
-29477,
-29386,
-29188,
-29078,
-28942,
-28748,
-28563,
-28439,
-28255,
-28192,
-28103,
-28056,
-28104,
+36646,
+39283,
+41616,
+42936,
+43776,
+43718,
+43101,
+42981,
+42150,
+41484,
+40825,
+39327,
+39261,
+39298,
+39475,
+40625,
+39866,
+38525,
+38131,
+36214,
+34575,
+33434,
+31687,
+29912,
 28080,
-28169,
-28213,
-28280,
+27465,
+27438,
+27794,
+28111,
+28528,
+28093,
+27388,
+27692,
+26689,
+26013,
+26180,
+25284,
+24492,
+25706,
+26320,
+26933,
+28799,
+28941,
+29638,
+30115,
+30436,
+31424,
+31108,
+31871,
+32199,
+31299,
+32313,
+32918,
+32445,
+33262,
+33368,
+32689,
+33069,
+33454,
+33412,
+34054,
+34182,
+33943,
+34073,
+33784,
+34196,
+34454,
+34546,
+34903,
+35486,
+35498,
+35319,
+36389,
+35763,
+35394,
+36549,
+36087,
+36054,
+37083,
+36887,
+36426,
+37071,
+37067,
+36251,
+36391,
+35915,
+34829,
+34480,
+34193,
+34179,
+33853,
+33756,
+33861,
+33019,
+32925,
+33152,
+32422,
+32170,
+32147,
+31947,
+32564,
+33721,
+35225,
+36300,
+36764,
+37554,
+37635,
+37580,
+38658,
+38832,
+38742,
+39434,
+39326,
+39904,
+41223,
+41921,
+43002,
+43392,
+42939,
+43070,
+42385,
+41556,
+41105,
+39712,
+38725,
+37993,
+37383,
+37444,
+36928,
+36215,
+35241,
+33690,
+32460,
+31317,
+30457,
+29021,
+28064,
+27520,
+25949,
+26239,
+26450,
+26076,
+26232,
+26052,
+25746,
+24915,
+25135,
+24622,
+23682,
+23887,
+23608,
+23237,
+24292,
+25238,
+25103,
+26296,
+26507,
+26173,
+27124,
+27159,
+26932,
+27343,
+27121,
+26611,
+27207,
+27273,
+27187,
+27348,
+26903,
+26523,
+26346,
+26340,
+26119,
+26039,
+25573,
+25019,
+24642,
+24334,
+24098,
+23521,
+23042,
+22125,
+21586,
+21339,
+21016,
+21074,
+21051,
+20961,
+21420,
+22618,
+23575,
+24949,
+26023,
+25988,
+26460,
+26751,
+26792,
+27741,
+28623,
+28920,
+29870,
+31492,
+32988,
+35492,
+38274,
+40176,
+41804,
+42665,
+43231,
+43666,
+44258,
+44922,
+45460,
+46148,
+47013,
+48538,
+49817,
+51171,
+52445,
+52677,
+52101,
+51776,
+51274,
+49846,
+49436,
+48880,
+47472,
+47255,
+47146,
+46576,
+46495,
+46301,
+45436,
+44270,
+43368,
+42127,
+40707,
+39544,
+38200,
+37141,
+35991,
+35256,
+35157,
+34523,
+34228,
+34496,
+33879,
+33532,
+33760,
+33155,
+32744,
+32587,
+32373,
+32203,
+32402,
+32949,
+32778,
+32969,
+33265,
+32666,
+32779,
+32841,
+32125,
+32467,
+32335,
+31945,
+32877,
+33052,
+33201,
+34070,
+34170,
+33696,
+34179,
+34247,
+33566,
+34312,
+34249,
+33792,
+34412,
+34598,
+34420,
+34551,
+34708,
+33924,
+33497,
+33233,
+32378,
+31684,
+30882,
+29967,
+28623,
+27678,
+27201,
+26191,
+25360,
+24674,
+23296,
+21822,
+20861,
+19604,
+18378,
+17474,
+16842,
+16085,
+15283,
+15705,
+15124,
+14541,
+15018,
+14084,
+14044,
+14442,
+13767,
+13749,
+13529,
+12610,
+12553,
+12440,
+11721,
+11965,
+12229,
+12668,
+15191,
+18146,
+20445,
+22691,
+23552,
+23496,
+23457,
+24457,
+25973,
+26930,
+28863,
+30467,
+31720,
+34939,
+39018,
+41963,
+45255,
+47978,
+48354,
+49211,
+50526,
+51005,
+51888,
+53345,
+54078,
+55245,
+57158,
+58460,
+59642,
+59990,
+59635,
+58752,
+57334,
+56203,
+55031,
+53506,
+51924,
+50968,
+49691,
+48713,
+48615,
+47610,
+46599,
+45395,
+43192,
+41008,
+38762,
+36612,
+34675,
+32973,
+31614,
+30346,
+29230,
+28295,
+27441,
+26286,
+25093,
+23877,
+22427,
+21292,
+20424,
+19664,
+19394,
+19580,
+19851,
+20632,
+21740,
+22398,
+23041,
+23532,
+23494,
+23732,
+24384,
+25141,
+26233,
+27585,
+29091,
+30421,
+32205,
+34325,
+35575,
+37017,
+37929,
+38338,
+38985,
+39376,
+40357,
+40678,
+41148,
+41980,
+41992,
+42667,
+43198,
+43000,
+42591,
+42151,
+41223,
+40102,
+39587,
+38684,
+37705,
+36973,
+36030,
+35109,
+34574,
+33821,
+32712,
+31904,
+30605,
+29234,
 28433,
-28504,
-28653,
-28770,
-28830,
+27581,
+26660,
+26287,
+25974,
+25466,
+25948,
+26375,
+26439,
+27017,
+27441,
+27416,
+27737,
+28510,
+28804,
+29452,
+30181,
+30540,
+31119,
+31891,
+32902,
+33548,
+34371,
+34783,
+34584,
+34661,
+34488,
+34227,
+34083,
+33817,
+33267,
+32881,
+32355,
+31543,
+31100,
+30623,
+29893,
+29474,
+29251,
+28482,
+27969,
+27628,
+26783,
+26296,
+26155,
+25651,
+25048,
+25142,
+25004,
+24750,
+25422,
+25706,
+25938,
+26564,
+26874,
+27312,
+27769,
+28342,
+28610,
+28612,
 28948,
-29029,
-29013,
-29142,
-29011,
-29100,
-28965,
-28923,
-28855,
-28744,
-28702,
-28632,
-28503,
-28412,
-28256,
-28193,
-28145,
-28059,
-28081,
-28012,
-28016,
-28078,
-28016,
-28234,
-28213,
-28414,
-28455,
-28569,
-28678,
-28655,
-28835,
-28832,
-28901,
-28943,
-28856,
-28856,
-28810,
-28791,
-28675,
-28704,
-28476,
-28571,
-28364,
-28461,
+29169,
+29556,
+30003,
+30149,
+30058,
+29729,
+29736,
+30099,
+30371,
+30725,
+30579,
+29741,
+29084,
+28596,
+28462,
+28393,
+27925,
+27114,
+25697,
+24208,
+23269,
+22526,
+21569,
+20919,
+20607,
+20957,
+22951,
+25464,
+26809,
+26886,
+26146,
+24917,
+24291,
+25401,
+27248,
+28407,
+29485,
+30973,
+32760,
+35972,
+40122,
+43189,
+45027,
+46400,
+46967,
+46966,
+48258,
+49993,
+50869,
+51908,
+53566,
+55438,
+57176,
+59071,
+59858,
+59070,
+58179,
+56966,
+55309,
+54070,
+53090,
+51220,
+49163,
+48285,
+47608,
+46583,
+45763,
+44604,
+42447,
+40045,
+37706,
+34965,
+32502,
+30525,
+28378,
+26537,
+25543,
+24789,
+23797,
+23147,
+22740,
+22063,
+21514,
+21096,
+20704,
+20494,
+20487,
+20594,
+21109,
+22154,
+23276,
+24627,
+26046,
+27121,
+27982,
+28805,
+29869,
+31467,
+33336,
+34635,
+35418,
+36126,
+36786,
+37723,
+38975,
+39926,
+40084,
+40012,
+40110,
+40328,
+41003,
+41602,
+41458,
+40877,
+40331,
+39637,
+38864,
+38331,
+37491,
+36363,
+35653,
+35298,
+34841,
+34282,
+33436,
+32002,
+30640,
+29752,
+28750,
+27666,
+26760,
+25652,
+24520,
+23951,
+23739,
+23433,
+23244,
+23096,
+22635,
+22275,
+22132,
+21771,
+21288,
+21008,
+20713,
+20318,
+20253,
+20389,
+20311,
+20180,
+20246,
+20347,
+20528,
+20974,
+21167,
+20881,
+20600,
+20504,
+20383,
+20363,
+20497,
+20212,
+19551,
+19215,
+19202,
+19215,
+19532,
+20044,
+20595,
+21858,
+24018,
+26166,
+27611,
+28309,
+28106,
+27514,
+27776,
+29073,
+30771,
+32523,
+34267,
+35924,
+38055,
+40972,
+43938,
+46298,
+47934,
+48977,
+49414,
+49935,
+50895,
+51834,
+52587,
+53410,
+54544,
+55892,
+57448,
+58682,
+58993,
+58522,
+57759,
+56731,
+55460,
+54131,
+52280,
+50003,
+48162,
+47164,
+46535,
+45932,
+44969,
+43160,
+40974,
+38945,
+37078,
+35067,
+33046,
+30877,
+28635,
+27057,
+26243,
+25706,
+25095,
+24617,
+24078,
+23676,
+23673,
+23721,
+23545,
+23217,
+23120,
+23266,
+23935,
+25063,
+26140,
+26965,
+27666,
+28434,
+29039,
+29704,
+30556,
+31400,
+32246,
+33156,
+34090,
+34770,
+35357,
+35941,
+36396,
+36807,
+37247,
+37571,
+37603,
+37673,
+37903,
+38075,
+38250,
+38528,
+38666,
+38488,
+38358,
+38342,
+38091,
+37842,
+37737,
+37425,
+36885,
+36448,
+36009,
+35412,
+35129,
+34937,
+34355,
+33618,
+33055,
+32395,
+31639,
+31296,
+30910,
+30278,
+29885,
+29711,
+29411,
+29169,
+29195,
+28895,
+28485,
+28436,
+28326,
+28114,
+28156,
+28283,
+28108,
+27977,
+27988,
+27869,
+27927,
+28254,
 28430,
-28483,
-28521,
-28479,
-28591,
-28500,
-28678,
-28701,
-28766,
-28878,
-28879,
-28941,
-28948,
-29051,
-29081,
-29184,
-29168,
-29186,
-29168,
-29119,
-29079,
-29030,
-28969,
-28876,
+28364,
+28343,
+28214,
+27914,
+27739,
+27596,
+27273,
+26939,
+26724,
+26441,
+26090,
+25779,
+25443,
+25184,
+25163,
+25224,
+25122,
+24857,
+24519,
+24109,
+23731,
+23422,
+22948,
+22191,
+21335,
+20678,
+20399,
+20516,
+20824,
+20953,
+20776,
+20500,
+20403,
+20508,
+20807,
+20959,
+20604,
+20023,
+19654,
+19796,
+20484,
+21493,
+22363,
+22921,
+23651,
+24874,
+26614,
+28652,
+30427,
+31562,
+32374,
+33455,
+34902,
+36805,
+38905,
+40703,
+42266,
+44043,
+46185,
+48397,
+50589,
+52353,
+53435,
+54381,
+55399,
+56207,
+56767,
+57116,
+56939,
+56656,
+56785,
+56946,
+56724,
+56136,
+55139,
+53687,
+52447,
+51450,
+50080,
+48385,
+46625,
+44774,
+43049,
+41781,
+40371,
+38529,
+36741,
+35169,
+33784,
+32785,
+31970,
+30696,
+29262,
+28107,
+27135,
+26481,
+26161,
+25772,
+25154,
+24775,
+24674,
+24718,
+24995,
+25289,
+25427,
+25508,
+25863,
+26384,
+27024,
+27837,
+28558,
+29216,
+29914,
+30652,
+31323,
+31964,
+32530,
+32959,
+33401,
+33933,
+34523,
+35179,
+35884,
+36399,
+36721,
+36925,
+36988,
+36980,
+36980,
+36846,
+36476,
+36136,
+35885,
+35661,
+35551,
+35404,
+34920,
+34257,
+33666,
+33011,
+32349,
+31796,
+31204,
+30448,
+29808,
+29272,
+28594,
+28039,
+27616,
+27108,
+26547,
+26169,
+25797,
+25258,
+24882,
+24549,
+24075,
+23720,
+23561,
+23430,
+23358,
+23533,
+23680,
+23633,
+23644,
+23593,
+23413,
+23389,
+23647,
+23876,
+24050,
+24304,
+24530,
+24792,
+25267,
+25804,
+26065,
+26212,
+26332,
+26418,
+26590,
+26884,
+27009,
+26752,
+26335,
+25868,
+25440,
+25200,
+25222,
+25223,
+25046,
+24804,
+24517,
+24207,
+24022,
+23920,
+23610,
+23058,
+22468,
+21899,
+21420,
+21268,
+21294,
+21344,
+21568,
+22242,
+23409,
+25118,
+27131,
 28790,
-28677,
-28613,
-28545,
-28546,
-28455,
-28481,
-28367,
-28434,
-28371,
-28520,
-28459,
-28699,
-28701,
-28745,
-28877,
-28879,
-28964,
-29057,
-29120,
-29099,
-29233,
-29209,
-29232,
-29322,
-29297,
-29300,
-29252,
-29212,
-29076,
-29166,
-29011,
-29098,
-28989,
-28944,
-28966,
-28878,
-28900,
-28943,
-28945,
-29054,
-28989,
-29077,
-29099,
-29142,
-29346,
-29383,
-29591,
-29560,
-29767,
-29694,
-29944,
-29827,
-30077,
-29982,
-30120,
-29983,
-30121,
-30026,
-30166,
-30069,
-30255,
-30115,
-30276,
-30115,
-30231,
-30205,
-30296,
-30207,
-30249,
-30231,
-30227,
-30341,
-30272,
-30428,
-30473,
-30538,
-30607,
-30714,
-30783,
-30939,
-31068,
-31117,
-31336,
-31290,
-31537,
-31447,
-31624,
+29801,
+30398,
+31082,
+32209,
+33858,
+35652,
+37205,
+38585,
+40248,
+42383,
+44979,
+47570,
+49612,
+50991,
+51985,
+53009,
+54145,
+55375,
+56421,
+57192,
+57772,
+58361,
+58862,
+59137,
+58937,
+58102,
+56917,
+55741,
+54749,
+53779,
+52734,
+51262,
+49601,
+47897,
+46200,
+44409,
+42466,
+40538,
+38698,
+37298,
+36149,
+34960,
+33412,
+31680,
+29919,
+28257,
+26966,
+25967,
+25145,
+24473,
+24174,
+24121,
+24200,
+24402,
+24578,
+24575,
+24650,
+25039,
+25592,
+26379,
+27414,
+28467,
+29411,
+30434,
 31536,
-31668,
-31646,
-31824,
-31824,
-32000,
-32022,
-32069,
-32175,
-32094,
-32173,
-32204,
-32130,
-32291,
-32176,
-32247,
-32220,
-32179,
-32243,
-32223,
-32311,
-32355,
-32400,
-32552,
-32624,
-32706,
-32890,
-32885,
-33042,
-33131,
-33217,
-33309,
-33396,
-33484,
-33509,
-33659,
-33665,
-33748,
-33930,
-33792,
-34086,
-33991,
-34196,
-34281,
-34215,
-34416,
-34391,
-34440,
-34545,
-34418,
-34589,
-34572,
-34658,
-34725,
-34792,
-34858,
-34946,
-35058,
-35123,
-35168,
-35191,
-35279,
-35101,
-35390,
-35145,
-35391,
-35366,
-35324,
-35500,
-35368,
-35500,
-35499,
-35635,
-35721,
-35811,
-35921,
-35920,
-36055,
-35943,
-36099,
-36053,
-36143,
-36142,
-36255,
-36297,
-36430,
-36498,
-36673,
-36676,
-36873,
-36806,
-36986,
-37006,
-37006,
-37074,
-37005,
-36985,
-36873,
-36853,
-36738,
-36765,
-36718,
-36651,
-36764,
-36541,
-36739,
-36523,
-36647,
-36613,
-36559,
-36656,
-36494,
-36698,
-36607,
-36697,
-36762,
-36720,
-36916,
-36786,
-36940,
-36896,
-36916,
-36965,
-36826,
-36854,
-36673,
-36674,
-36609,
-36562,
-36520,
-36453,
-36407,
-36366,
-36362,
-36300,
-36296,
-36254,
-36232,
-36185,
-36056,
-36075,
-35944,
-35988,
-35876,
-35898,
-35858,
-35828,
-35838,
-35761,
-35857,
-35766,
-35765,
-35746,
-35653,
-35679,
-35587,
-35614,
-35564,
-35591,
-35543,
-35501,
-35567,
-35455,
-35567,
-35346,
-35478,
-35168,
-35189,
-35036,
-34858,
-34858,
-34592,
-34593,
-34325,
-34261,
-34127,
-33993,
-33973,
-33928,
-33860,
-33819,
-33770,
-33686,
-33704,
-33576,
-33616,
-33574,
-33572,
-33597,
-33616,
-33708,
-33638,
-33751,
-33685,
-33660,
-33709,
-33592,
-33598,
-33528,
-33352,
-33286,
-33041,
-33042,
-32842,
-32732,
-32688,
-32487,
-32533,
-32288,
-32310,
-32248,
-32196,
-32269,
-32088,
-32155,
-32026,
-32085,
-32138,
-32129,
-32293,
-32264,
-32377,
-32402,
-32439,
-32516,
-32549,
-32560,
-32571,
-32514,
-32441,
-32357,
-32310,
-32156,
-32088,
-31936,
-31755,
-31670,
-31380,
-31469,
-31160,
-31180,
-30939,
-30847,
-30740,
-30537,
-30541,
-30449,
-30494,
-30496,
-30625,
-30630,
-30891,
-30916,
-31115,
-31203,
-31270,
-31424,
-31404,
-31622,
-31516,
-31711,
-31581,
-31602,
-31468,
-31470,
-31380,
-31293,
-31268,
-31095,
-31067,
-30809,
-30711,
-30543,
-30536,
-30363,
-30451,
-30205,
-30385,
-30250,
-30428,
-30562,
-30605,
-30871,
-30871,
-31092,
-31116,
-31224,
-31272,
-31312,
-31359,
-31315,
-31401,
-31249,
-31336,
-31203,
-31182,
-31069,
-31005,
-30848,
-30805,
-30651,
-30492,
-30431,
-30248,
-30141,
-30075,
-29895,
-30009,
-29918,
-30050,
-30120,
-30227,
-30320,
-30493,
+32411,
+33068,
+33618,
+34099,
+34675,
+35501,
+36337,
+36868,
+37154,
+37466,
+37923,
+38483,
+39047,
+39221,
+38952,
+38654,
+38655,
+38864,
+39118,
+39243,
+39021,
+38639,
+38455,
+38504,
+38393,
+37959,
+37200,
+36218,
+35362,
+34817,
+34429,
+33856,
+33030,
+32062,
+31141,
+30424,
+29866,
+29161,
+28091,
+26875,
+25734,
+24845,
+24137,
+23507,
+22784,
+21968,
+21273,
+20808,
+20518,
+20164,
+19828,
+19420,
+19009,
+18606,
+18293,
+18060,
+17904,
+17970,
+18013,
+18102,
+18291,
+18736,
+19246,
+19763,
+20214,
+20359,
+20402,
+20573,
+20999,
+21298,
+21440,
+21318,
+21120,
+21284,
+21896,
+22684,
+23206,
+23481,
+23418,
+23459,
+23923,
+24719,
+25347,
+25606,
+25635,
+25607,
+25891,
+26416,
+27040,
+27430,
+27752,
+28069,
+28715,
+30101,
+32184,
+34373,
+36059,
+37293,
+38016,
+38656,
+39584,
+40851,
+42206,
+43424,
+44496,
+45673,
+47287,
+49247,
+51011,
+52332,
+53357,
+54078,
+54627,
+55315,
+56199,
+56877,
+57467,
+58058,
+58626,
+59112,
+59402,
+59172,
+58322,
+57366,
+56378,
+55257,
+54161,
+53241,
+52005,
+50510,
+49162,
+47833,
+46127,
+44124,
+42184,
+40355,
+38979,
+37902,
+36620,
+35015,
+33358,
+31568,
+29566,
+27895,
+26727,
+25637,
+24383,
+23448,
+22947,
+22572,
+22240,
+21997,
+21754,
+21326,
+21091,
+21299,
+21838,
+22481,
+23134,
+23722,
+24218,
+24946,
+25832,
+26671,
+27316,
+27961,
+28703,
+29613,
 30539,
-30693,
-30828,
-30871,
-31092,
-31094,
-31267,
-31295,
-31334,
-31337,
-31249,
-31223,
-31272,
-31157,
-31205,
-31047,
-30916,
-30783,
-30582,
-30386,
-30248,
-30120,
-29962,
-30008,
-29852,
-29941,
-29896,
-29897,
-29985,
-30007,
-30162,
-30252,
-30448,
-30542,
-30735,
-30807,
-30914,
-31027,
-31047,
-31161,
-31289,
-31207,
-31421,
-31317,
-31335,
-31314,
+31124,
+31538,
+32148,
+32935,
+33585,
+34249,
+34838,
+35159,
+35303,
+35741,
+36548,
+37234,
+37627,
+37765,
+37792,
+37872,
+38022,
+38004,
+37657,
+36931,
+36005,
+35106,
+34409,
+33939,
+33423,
+32635,
+31681,
+30856,
+30056,
+29149,
+28278,
+27320,
+26105,
+24903,
+24043,
+23410,
+22766,
+22052,
+21252,
+20331,
+19534,
+19110,
+18883,
+18606,
+18317,
+18114,
+17822,
+17294,
+16621,
+16058,
+15851,
+15968,
+16120,
+16270,
+16532,
+16806,
+17089,
+17445,
+17709,
+17657,
+17525,
+17599,
+17881,
+18430,
+19238,
+20141,
+21047,
+22219,
+23585,
+24465,
+24759,
+24988,
+25520,
+26448,
+27880,
+29545,
+30705,
+31384,
+32389,
+33952,
+35497,
+36680,
+37543,
+38118,
+38718,
+39642,
+40848,
+42148,
+43493,
+44746,
+45781,
+46758,
+47445,
+47322,
+46712,
+46792,
+47624,
+48461,
+49547,
+51205,
+52383,
+52272,
+51953,
+52167,
+51995,
+51113,
+50645,
+50870,
+50962,
+50839,
+50867,
+50871,
+50312,
+48956,
+47212,
+46405,
+47237,
+47771,
+46267,
+44367,
+43652,
+42661,
+40764,
+39782,
+39645,
+38095,
+35474,
+34490,
+35088,
+34576,
+32661,
+31784,
+32223,
+31433,
+29459,
+29142,
+30057,
+29344,
+27836,
+28243,
+29452,
+29208,
+28786,
+29587,
+30013,
+29251,
+29222,
+30556,
+31358,
+31029,
+31200,
+32367,
+32962,
+32423,
+32279,
+33047,
+33352,
+32977,
+33295,
+34375,
+34687,
+34233,
+34348,
+34813,
+34442,
+33460,
+32997,
+32847,
+32080,
+30949,
+30236,
+29872,
+29456,
+28979,
+28417,
+27634,
+26548,
+25463,
+24736,
+24302,
+23795,
+23076,
+22453,
+22055,
+21622,
+21047,
+20768,
+20519,
+19839,
+19095,
+18964,
+19421,
+19656,
+19572,
+19415,
+19367,
+19383,
+19344,
+19286,
+19277,
+19522,
+19706,
+19875,
+20416,
+21230,
+21916,
+22239,
+22253,
+21939,
+21831,
+22340,
+22973,
+23324,
+23995,
+25151,
+26026,
+26812,
+28032,
+28898,
+28274,
+27126,
+26959,
+27481,
+27911,
+28481,
+30017,
+31848,
+32934,
+33371,
+33621,
+33816,
+33331,
+32535,
+32734,
+34283,
+35871,
+36373,
+37070,
+38594,
+39510,
+39005,
+38460,
+38947,
+39015,
+38612,
+39819,
+42720,
+44971,
+45614,
+46423,
+47744,
+48055,
+47670,
+47960,
+48796,
+49013,
+49141,
+50635,
+52385,
+52877,
+52418,
+51803,
+51108,
+50137,
+49877,
+50251,
+50167,
+49456,
+48393,
+47500,
+46679,
+45804,
+44658,
+43132,
+41946,
+41010,
+39951,
+38955,
+38186,
+37441,
+36429,
+35607,
+35031,
+34202,
+33283,
+32307,
+31313,
+30745,
+31070,
+31811,
+31945,
+31702,
+31529,
+31232,
+30631,
+30073,
+30055,
+30362,
+30671,
+31198,
+31849,
+32289,
+32109,
+31346,
+30734,
+30459,
+30489,
+30598,
+30884,
 31226,
-31203,
-31182,
-31069,
-31094,
+31145,
+30907,
+30613,
+30374,
+29745,
+28847,
+28403,
+28441,
+28593,
+28383,
+28297,
+28358,
+28219,
+27914,
+27681,
+27811,
+27824,
+27678,
+27748,
+28122,
+28517,
+28573,
+28650,
+29147,
+29605,
+29697,
+29720,
+29965,
+30211,
+30019,
+29906,
+29997,
+30068,
+29981,
+29754,
+29783,
+29454,
+28927,
+28457,
+28004,
+27654,
+27244,
+27291,
+27156,
+26473,
+25700,
+24990,
+24135,
+22974,
+22538,
+22876,
+23031,
+22569,
+22170,
+22263,
+21973,
+21294,
+20925,
+21037,
+21015,
+20856,
+21341,
+22201,
+22506,
+22199,
+22332,
+23145,
+23780,
+24263,
+25021,
+25772,
+26301,
+26882,
+27923,
+28610,
+28653,
+29043,
+30039,
+31155,
+31642,
+32326,
+33324,
+33872,
+34433,
+35547,
+37157,
+37825,
+37977,
+38883,
+40015,
+40583,
+40897,
+41952,
+42831,
+43157,
+43812,
+45151,
+46226,
+46019,
+45608,
+46030,
+47104,
+47710,
+47864,
+48125,
+48304,
+48010,
+47582,
+47786,
+47779,
+47079,
+46067,
+45715,
+45872,
+45566,
+44813,
+44043,
+43722,
+42935,
+41762,
+40948,
+40537,
+39829,
+38510,
+37949,
+38099,
+38126,
+37596,
+36698,
+35828,
+34787,
+33692,
+32898,
+32819,
+32975,
+32905,
+32994,
+33197,
+33209,
+32569,
+31632,
+31162,
+30997,
+31105,
+31364,
+31731,
+32104,
+32400,
+32567,
+32394,
+32290,
+32058,
+31841,
+31890,
+32159,
+32740,
+33077,
+33389,
+33818,
+34234,
+34449,
+34203,
+33964,
+33737,
+33506,
+33418,
+33389,
+33618,
+33497,
+32758,
+32182,
+31641,
 30913,
-31007,
-30936,
-30938,
-31025,
-30939,
-31091,
-31050,
-31114,
-31203,
-31226,
-31336,
-31359,
-31468,
-31515,
-31557,
-31668,
-31692,
-31710,
-31827,
-31732,
-31915,
-31821,
-32024,
-31933,
-32069,
-31999,
-32003,
-31910,
-31934,
-31892,
-31976,
-32026,
-32087,
-32156,
-32289,
-32266,
-32445,
-32420,
-32578,
-32663,
-32778,
-32886,
-32996,
-33134,
-33170,
-33223,
-33238,
-33264,
-33286,
-33395,
-33376,
-33483,
+29864,
+28967,
+28680,
+28208,
+27400,
+26599,
+25940,
+24976,
+23654,
+22872,
+22432,
+21904,
+21189,
+20400,
+20293,
+20178,
+19714,
+19501,
+19430,
+19384,
+18781,
+18208,
+18408,
+18789,
+19002,
+19356,
+20456,
+21460,
+21671,
+21695,
+21606,
+21716,
+21579,
+21617,
+23067,
+24575,
+25624,
+26274,
+26754,
+27400,
+27069,
+26558,
+26822,
+27714,
+28408,
+28649,
+29735,
+30759,
+31196,
+31136,
+30900,
+31464,
+31216,
+30867,
+31478,
+32315,
+33008,
+32765,
+33349,
+34291,
+34683,
+34625,
+34290,
+34966,
+34563,
+34214,
+34846,
+35446,
+36065,
+35984,
+36746,
+37571,
+37557,
+37085,
+36822,
+37152,
+36798,
+36702,
+37339,
+38191,
+39086,
+39562,
+40046,
+40271,
+39462,
+38701,
+38935,
+39604,
+40126,
+40938,
+42444,
+43391,
+43292,
+42737,
+42393,
+41977,
+41095,
+41434,
+43256,
+44806,
+45351,
+45628,
+45931,
+45419,
+44114,
+43288,
+43596,
+43873,
+43867,
+44776,
+46028,
+45987,
+44717,
+43589,
+43189,
+42684,
+41721,
+41596,
+42283,
+42342,
+41744,
+41263,
+40879,
+40013,
+38614,
+37722,
+37718,
+37294,
+36616,
+36419,
+36323,
+35954,
+34995,
+34157,
+33842,
+33387,
+32438,
+31804,
+31631,
+31272,
+30857,
+30282,
+30158,
+30059,
+29122,
+28500,
+28394,
+28093,
+27434,
+26823,
+26632,
+26803,
+26549,
+25970,
+26040,
+25805,
+25163,
+24712,
+24447,
+24401,
+23947,
+23439,
+23694,
+24222,
+23905,
+23311,
+23087,
+22889,
+22664,
+22051,
+21758,
+21917,
+21881,
+21866,
+22105,
+22186,
+21696,
+21253,
+21042,
+21060,
+20722,
+20143,
+20424,
+21251,
+21925,
+21950,
+21831,
+21802,
+21711,
+21560,
+21330,
+21556,
+21938,
+22570,
+23641,
+24765,
+25472,
+25333,
+24854,
+24681,
+25142,
+25799,
+26655,
+27793,
+28771,
+29667,
+30184,
+30455,
+30664,
+30330,
+29991,
+30649,
+32305,
+34176,
+35170,
+35352,
+35738,
+36118,
+35913,
+35749,
+36125,
+36446,
+37155,
+38412,
+39925,
+41226,
+40807,
+40148,
+40338,
+40544,
+40524,
+40644,
+41429,
+42425,
+43386,
+43838,
+44725,
+45089,
+44117,
+43567,
+43532,
+44043,
+44220,
+44565,
+45289,
+46165,
+46612,
+46327,
+46678,
+46159,
+45314,
+44755,
+44756,
+45548,
+45793,
+45950,
+46177,
+46476,
+46062,
+45379,
+44954,
+44348,
+43693,
+43162,
+43311,
+43801,
+43899,
+43428,
+43146,
+42592,
+41602,
+40682,
+39955,
+39650,
+39035,
+38587,
+38508,
+38554,
+38159,
+36997,
+35830,
+34702,
+33896,
+33327,
+32955,
+32624,
+32114,
+31546,
+30946,
+30402,
+29543,
+28505,
+27704,
+27267,
+26993,
+26784,
+26431,
+25964,
+25649,
+25058,
+24595,
+24385,
+24050,
+23742,
+23356,
+23087,
+23172,
+23104,
+22747,
+22665,
+22664,
+22572,
+22484,
+22332,
+22375,
+22419,
+22238,
+22345,
+22635,
+22460,
+22264,
+22272,
+22397,
+22561,
+22482,
+22645,
+23017,
+22999,
+22884,
+23117,
+23335,
+23371,
+23238,
+23332,
+23818,
+23972,
+23824,
+23818,
+23949,
+23912,
+24236,
+24960,
+25492,
+25657,
+25300,
+25417,
+25605,
+25276,
+25264,
+25657,
+26551,
+27498,
+28479,
+29482,
+29612,
+28893,
+28086,
+28085,
+28502,
+28856,
+29884,
+31406,
+32819,
+33687,
+33938,
+34026,
 33374,
-33397,
+32313,
+32380,
+33588,
+35184,
+36472,
+37656,
+38896,
+39336,
+39024,
+38498,
+38183,
+37972,
+38104,
+39438,
+41115,
+42291,
+42823,
+43018,
+43308,
+42780,
+41954,
+41781,
+42018,
+42568,
+43100,
+43886,
+44480,
+44428,
+44080,
+43668,
+43291,
+42492,
+42140,
+42415,
+42702,
+42868,
+42711,
+42804,
+42618,
+42008,
+41447,
+41060,
+40711,
+40119,
+40051,
+40176,
+40243,
+40038,
+39585,
+39464,
+38939,
+38397,
+38056,
+37782,
+37511,
+37017,
+36965,
+36979,
+36761,
+36254,
+35711,
+35595,
+35254,
+34994,
+34759,
+34468,
+34288,
+33756,
+33503,
 33262,
-33264,
-33109,
-33129,
-33065,
-33108,
-33085,
-33175,
-33131,
-33306,
-33265,
-33505,
-33486,
-33639,
-33728,
-33796,
-33927,
-33994,
-33995,
-34148,
-33994,
-34130,
-34101,
-34064,
-34079,
-34153,
-34013,
-34152,
-33926,
-34039,
-33883,
-33951,
-33836,
-33910,
-33813,
-33931,
-33858,
-33975,
-33969,
-34040,
-34128,
-34102,
-34264,
-34255,
-34353,
-34455,
+32888,
+32493,
+32096,
+32118,
+31977,
+31718,
+31257,
+30924,
+30761,
+30437,
+30210,
+29891,
+29698,
+29308,
+28949,
+28725,
+28353,
+27995,
+27609,
+27618,
+27735,
+27571,
+27121,
+26601,
+26170,
+25558,
+25054,
+24824,
+24869,
+25049,
+25162,
+25468,
+25543,
+25001,
+24187,
+23344,
+22843,
+22548,
+22471,
+22902,
+23470,
+23868,
+23962,
+23869,
+23503,
+22728,
+21939,
+21543,
+21838,
+22551,
+23246,
+24043,
+24485,
+24627,
+24572,
+24144,
+23854,
+23539,
+23702,
+24459,
+25441,
+26517,
+27193,
+27693,
+27798,
+27821,
+27812,
+27768,
+28167,
+28721,
+29635,
+30534,
+31287,
+31965,
+32356,
+32489,
+32523,
+32765,
+33226,
+33791,
+34279,
+34889,
+35433,
+35954,
+36358,
+36680,
+37017,
+37112,
+37440,
+37776,
+38221,
+38532,
+38619,
+38992,
+39249,
+39596,
+39735,
+39863,
+40135,
+40196,
+40422,
+40551,
+40717,
+40775,
+40577,
+40473,
+40378,
+40453,
+40503,
+40599,
+40833,
+40936,
+40993,
+40891,
+40656,
+40128,
+39477,
+39190,
+39292,
+39596,
+39688,
+39741,
+39858,
+39888,
+39596,
+39033,
+38507,
+37951,
+37792,
+37925,
+38282,
+38449,
+38227,
+38256,
+38261,
+38177,
+37663,
+37118,
+36959,
+36875,
+36934,
+36794,
+36838,
+36914,
+36856,
+36881,
+36620,
+36346,
+35932,
+35656,
+35567,
+35231,
+34874,
+34547,
+34483,
+34344,
+33922,
+33432,
+32957,
+32646,
+32215,
+31721,
+31224,
+30726,
+30346,
+30012,
+29713,
+29215,
+28579,
+28056,
+27728,
+27458,
+27095,
+26768,
+26471,
+26181,
+25762,
+25298,
+24861,
+24475,
+24297,
+24360,
+24605,
+24707,
+24681,
+24529,
+24320,
+24083,
+23821,
+23822,
+23986,
+24333,
+24783,
+25207,
+25472,
+25565,
+25654,
+25799,
+26123,
+26435,
+26807,
+27185,
+27505,
+27769,
+27951,
+28126,
+28354,
+28851,
+29508,
+30244,
+30718,
+30979,
+31108,
+31114,
+31111,
+31031,
+31199,
+31561,
+32164,
+32815,
+33355,
+33622,
+33566,
+33450,
+33280,
+33192,
+33075,
+33195,
+33541,
+34011,
+34483,
+34692,
+34732,
 34486,
-34566,
-34640,
-34610,
-34708,
-34653,
-34775,
-34721,
-34749,
-34747,
-34702,
-34771,
-34679,
-34772,
-34678,
-34660,
-34703,
-34525,
-34616,
-34567,
-34507,
+34194,
+33974,
+33894,
+33990,
+34200,
 34611,
-34441,
-34500,
-34351,
-34369,
-34261,
-34282,
-34325,
-34351,
-34368,
-34396,
-34389,
-34396,
-34391,
-34505,
-34436,
-34549,
-34458,
-34527,
-34525,
-34460,
-34547,
-34505,
-34502,
-34526,
-34461,
-34457,
-34462,
-34390,
-34395,
-34281,
-34261,
-34148,
-34150,
-34082,
-34106,
-34037,
-34084,
-34015,
-34062,
-34015,
-34173,
-34080,
-34242,
-34189,
-34219,
-34259,
+35050,
+35419,
+35408,
+35033,
+34528,
+34160,
+34103,
+34229,
+34603,
+35073,
+35554,
+35927,
+35993,
+35737,
+35217,
+34742,
+34607,
+34844,
+35310,
+35865,
+36421,
+36872,
+37054,
+36906,
+36603,
+36358,
+36253,
+36323,
+36604,
+37113,
+37744,
+38247,
+38507,
+38491,
+38318,
+38149,
+38092,
+38113,
+38095,
+38231,
+38598,
+39158,
+39548,
+39505,
+39191,
+38751,
+38496,
+38376,
+38401,
+38484,
+38522,
+38631,
+38629,
+38478,
+37936,
+37259,
+36679,
+36367,
+36371,
+36360,
+36337,
+36052,
+35635,
+35137,
+34688,
 34237,
+33649,
+33226,
+32954,
+32945,
+32908,
+32711,
+32335,
+31844,
+31402,
+30868,
+30382,
+29886,
+29599,
+29641,
+29854,
+30061,
+30021,
+29835,
+29499,
+29072,
+28583,
+28170,
+28079,
+28214,
+28525,
+28854,
+29059,
+29044,
+28846,
+28611,
+28285,
+28082,
+28022,
+28167,
+28474,
+28722,
+28892,
+28859,
+28709,
+28485,
+28446,
+28516,
+28634,
+28845,
+28978,
+29151,
+29164,
+29029,
+28781,
+28559,
+28442,
+28414,
+28626,
+28842,
+29039,
+29186,
+29295,
+29249,
+29100,
+29008,
+28903,
+28970,
+29054,
+29297,
+29625,
+29851,
+30036,
+30063,
+30143,
+30192,
+30223,
+30241,
+30282,
+30468,
+30706,
+31041,
+31377,
+31554,
+31693,
+31961,
+32124,
+32176,
+32225,
+32210,
+32287,
+32528,
+32832,
+33128,
+33392,
+33620,
+33838,
+34071,
 34306,
-34348,
-34413,
-34375,
-34455,
-34374,
-34369,
-34370,
-34285,
-34300,
-34264,
-34124,
-34151,
-34015,
-33973,
-34037,
-33863,
-34015,
-33795,
-33928,
-33706,
-33840,
-33637,
+34445,
+34546,
+34714,
+34958,
+35174,
+35224,
+35319,
+35411,
+35529,
+35819,
+35994,
+36077,
+36234,
+36524,
+36807,
+37001,
+37020,
+36828,
+36714,
+36652,
+36606,
+36589,
+36648,
+36782,
+36897,
+36914,
+36729,
+36556,
+36414,
+36315,
+36222,
+36036,
+35911,
+35834,
+35805,
+35726,
+35618,
+35562,
+35524,
+35441,
+35147,
+34789,
+34378,
+34026,
+33867,
+33714,
+33586,
+33601,
+33690,
 33687,
-33549,
-33464,
-33374,
-33196,
-33241,
-32998,
-33196,
-32998,
-33153,
-33041,
-33131,
-33129,
-33131,
-33197,
-33174,
-33131,
-33153,
-32996,
-33087,
-33042,
-33018,
-33110,
-32997,
-33108,
-33042,
-33108,
-33019,
-33153,
-33020,
-33084,
-32956,
-32928,
-32801,
-32751,
-32734,
-32663,
-32689,
-32752,
-32734,
-32885,
-32887,
-32953,
-32865,
-32908,
-32777,
-32797,
-32666,
-32643,
-32509,
-32534,
-32310,
-32421,
-32202,
-32285,
-32204,
-32242,
-32245,
-32245,
-32265,
-32201,
-32267,
-32110,
-32068,
-32001,
-31845,
-31890,
-31714,
-31821,
-31694,
-31753,
-31672,
-31688,
-31649,
-31688,
-31648,
-31779,
-31645,
-31737,
-31645,
-31623,
-31673,
-31551,
-31697,
-31553,
-31672,
-31511,
-31581,
-31424,
-31514,
-31359,
-31379,
-31294,
-31289,
-31184,
-31135,
-31093,
-30983,
-30913,
-30851,
-30738,
-30715,
-30718,
-30624,
-30697,
-30582,
-30606,
-30515,
-30585,
-30492,
-30631,
-30469,
-30607,
-30450,
-30449,
-30408,
-30294,
-30450,
-30363,
-30470,
-30475,
-30448,
-30518,
-30516,
-30539,
-30672,
+33584,
+33247,
+32863,
+32543,
+32294,
+32192,
+32076,
+32171,
+32357,
+32506,
+32556,
+32372,
+32066,
+31624,
+31238,
+30842,
+30509,
+30512,
+30828,
+31198,
+31468,
+31633,
+31507,
+31319,
+30998,
 30583,
-30693,
-30563,
-30536,
-30497,
-30360,
-30429,
-30296,
-30404,
-30275,
-30315,
-30208,
-30185,
+30354,
+30328,
+30661,
+31049,
+31272,
+31352,
+31282,
+31083,
+30770,
+30397,
+30037,
+29963,
 30227,
-30165,
-30248,
-30164,
-30206,
-30162,
-30141,
-30117,
-30075,
+30573,
+30916,
+31245,
+31309,
+31227,
+31066,
+30582,
+30103,
+29915,
+29917,
 30139,
-30030,
-30184,
-30029,
-30208,
-30161,
-30208,
-30293,
-30320,
-30314,
-30343,
-30338,
-30428,
-30384,
-30517,
-30472,
-30605,
-30584,
-30715,
-30718,
-30781,
-30915,
-30805,
-30982,
-30827,
+30573,
 30916,
-30781,
-30827,
-30717,
-30693,
-30561,
-30628,
-30449,
-30652,
-30448,
-30673,
-30560,
-30739,
-30627,
-30783,
-30737,
-30873,
-30803,
-30938,
-30805,
-30981,
-30894,
-30982,
-30981,
-30984,
-31001,
-30962,
-31024,
-30919,
-31044,
-30942,
-30955,
-30897,
-30824,
-30807,
-30714,
-30740,
-30714,
-30695,
-30783,
-30670,
-30852,
-30691,
-30895,
-30847,
-30984,
-31025,
-31071,
-31180,
-31205,
-31311,
-31363,
-31464,
-31584,
-31688,
-31735,
-31826,
-31798,
-31959,
+31161,
+31339,
+31299,
+31152,
+30992,
+30954,
+31036,
+31181,
+31381,
+31582,
+31736,
 31843,
-32003,
-31889,
-31979,
-31889,
+32000,
+31981,
+31918,
+32095,
+32320,
+32554,
+32899,
+33175,
+33268,
+33409,
+33370,
+33149,
+33087,
+33185,
+33429,
+33725,
+33983,
+34082,
+34090,
+34085,
+33975,
+33878,
+33877,
+33990,
+34152,
+34359,
+34564,
+34677,
+34740,
+34733,
+34722,
+34638,
+34561,
+34509,
+34325,
+34315,
+34385,
+34422,
+34499,
+34506,
+34513,
+34484,
+34411,
+34238,
+34101,
+34049,
+34064,
+34188,
+34237,
+34349,
+34414,
+34347,
+34235,
+34043,
+33947,
+33842,
+33706,
+33463,
+33163,
+33079,
+33108,
+33173,
+33108,
+33038,
+33062,
+33073,
+33074,
+32908,
+32702,
+32729,
+32898,
+32873,
+32690,
+32471,
+32276,
+32229,
+32255,
+32147,
 31891,
-31733,
-31782,
-31600,
-31669,
-31580,
-31579,
-31604,
-31533,
-31560,
-31556,
-31514,
-31647,
-31557,
-31757,
-31780,
-31889,
-32002,
-31999,
-32113,
-32088,
-32268,
-32221,
-32466,
-32444,
-32643,
-32621,
-32731,
-32709,
-32799,
-32887,
-32974,
-33110,
-33171,
-33134,
-33217,
-33219,
-33353,
-33416,
-33554,
-33615,
-33664,
-33748,
-33731,
-33881,
-33996,
-34149,
-34302,
-34441,
-34566,
-34728,
-34879,
-35035,
-35169,
-35410,
-35414,
-35609,
-35612,
-35788,
-35854,
-35989,
-36074,
-36123,
-36141,
-36187,
-36255,
-36317,
-36412,
-36383,
-36499,
-36341,
-36432,
-36473,
-36543,
-36716,
-36811,
-36936,
-37055,
-37157,
-37254,
-37512,
-37631,
-37866,
-38007,
-38089,
-38182,
-38268,
-38357,
-38537,
-38554,
-38737,
-38621,
-38824,
-38778,
-38867,
-39089,
-39022,
-39353,
-39246,
-39374,
-39400,
-39443,
-39574,
-39535,
-39726,
-39581,
-39727,
-39644,
-39665,
-39862,
-39777,
-40018,
-39974,
-40065,
-40061,
-40109,
+31760,
+31692,
+31674,
+31708,
+31640,
+31623,
+31572,
+31445,
+31311,
+31144,
+30910,
+30718,
+30647,
+30552,
+30558,
+30488,
+30367,
+30443,
+30494,
+30614,
+30599,
+30409,
+30343,
+30234,
+30196,
+30190,
+30114,
+30093,
+30144,
+30272,
+30343,
+30425,
+30567,
+30741,
+30885,
+30870,
+30730,
+30564,
+30559,
+30661,
+30782,
+30872,
+30937,
+30990,
+30983,
+30972,
+30839,
+30719,
+30732,
+30785,
+30957,
+31156,
+31377,
+31672,
+31850,
+31937,
+31910,
+31720,
+31598,
+31564,
+31550,
+31708,
+31975,
+32130,
+32405,
+32650,
+32800,
+33083,
+33199,
+33433,
+33673,
+33867,
+34298,
+34719,
+35203,
+35561,
+35878,
+36113,
+36256,
+36421,
+36416,
+36692,
+37040,
+37472,
+37991,
+38275,
+38594,
+38751,
+39012,
+39308,
+39462,
+39643,
+39670,
+39866,
+40046,
 40151,
-40173,
-40264,
-40238,
-40221,
-40194,
-40087,
-40216,
-40109,
-40283,
-40131,
-40284,
-40174,
-40330,
+40239,
+40154,
+40193,
 40238,
-40352,
-40350,
-40398,
-40371,
-40375,
-40349,
-40352,
-40396,
-40416,
-40465,
-40457,
-40467,
-40502,
-40486,
-40617,
-40549,
-40618,
-40572,
-40418,
-40417,
-40262,
-40242,
-40128,
-40042,
-39952,
-39818,
-39711,
-39686,
-39531,
-39665,
-39463,
-39578,
-39442,
-39465,
-39333,
-39308,
-39201,
-39088,
-39066,
-38934,
+40331,
+40377,
+40365,
+40445,
+40493,
+40592,
+40473,
+40213,
+39940,
+39648,
+39547,
+39433,
+39195,
 38977,
-38779,
-38778,
-38669,
-38554,
-38604,
-38423,
-38423,
-38293,
-38268,
-38024,
-38051,
-37712,
-37761,
-37516,
-37470,
-37297,
-37248,
-37052,
-36984,
-36873,
-36720,
-36694,
-36522,
-36451,
-36409,
-36120,
-36165,
-35766,
-35878,
-35455,
-35477,
-35237,
-35077,
-34948,
-34702,
-34593,
-34347,
-34174,
-33992,
-33839,
-33641,
-33483,
-33220,
-33109,
-32818,
-32645,
-32486,
-32268,
-32221,
-31958,
-31911,
-31690,
-31536,
-31359,
-31179,
-31074,
-31000,
-30764,
-30713,
-30430,
-30294,
-30052,
-29919,
-29697,
-29586,
-29366,
-29208,
-29035,
-28787,
-28657,
-28435,
-28256,
-28193,
-27879,
-27838,
-27503,
-27438,
-27218,
-27103,
-26866
+38751,
+38532,
+38321,
+37957,
+37559,
+37210,
+36856,
+36559,
+36211,
+35734,
+35253,
+34741,
+34176,
+33651,
+33054,
+32470,
+32014,
+31538,
+31062,
+30669,
+30078,
+29527,
+29092,
+28299,
+28224,
+26866,
+29004
 };
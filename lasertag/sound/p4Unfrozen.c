@@ -1,73977 +1,24663 @@
-// This file was generated by executing this statement: wav2c p4Unfrozen.wav
+// This file was generated by executing this statement: wav2c -rate 16000 p4Unfrozen.wav
 
 #include <stdint.h>
 
-uint16_t p4Unfrozen_wav[73971] = {
-31843,
-31843,
-31737,
-31922,
-31712,
-31814,
-31635,
-31523,
-31396,
-31314,
-31341,
-31315,
-31500,
-31367,
-31633,
-31418,
-31739,
-31605,
-31841,
-31583,
-31600,
-31346,
-31363,
-31450,
-31577,
-31553,
-31580,
-31338,
-31398,
-31337,
-31345,
-31575,
-31345,
-31575,
-31397,
-31576,
-31607,
-31711,
-31684,
-31604,
-31502,
-31443,
-31478,
-31337,
+const uint16_t p4Unfrozen_wav[24657] = {
+32142,
+31753,
+31673,
+31329,
+31400,
+31587,
+31692,
+31445,
 31502,
-31129,
-31235,
-31000,
-31153,
-31212,
-31392,
-31422,
-31446,
-31368,
-31420,
-31446,
-31606,
-31553,
-31577,
-31054,
-31099,
-30605,
-30864,
-30841,
-30970,
-30998,
-30894,
-30810,
-30922,
-30863,
-31210,
-31025,
-31181,
-31185,
-31233,
-31501,
-31394,
-31339,
-31133,
-30863,
-30842,
-30837,
-31000,
-31022,
-31184,
-30998,
-31076,
-31000,
-31048,
+31457,
+31373,
+31481,
+31626,
+31595,
+31460,
+31222,
+31159,
+31386,
+31453,
+31544,
+30983,
+30827,
+30942,
+30934,
+31163,
+31399,
+31115,
+30862,
+31088,
+31044,
+31127,
+31469,
+31586,
+31346,
+31085,
+30951,
+31177,
+31244,
+31332,
+31468,
+31559,
+31852,
+32498,
+32449,
+32247,
+32262,
+32040,
+31849,
+31729,
+32064,
+32329,
+32243,
+31733,
+32019,
+32306,
+32552,
+32846,
+32772,
+32636,
+32764,
+33140,
+33220,
+33054,
+33057,
+33299,
+33291,
+32854,
+33205,
+33728,
+33556,
+33661,
+32991,
+34147,
+33271,
+34518,
+35121,
+33420,
+34030,
+35332,
+37525,
+34512,
+36635,
+39258,
+37852,
+35983,
+33741,
+36024,
+36448,
+35581,
+35146,
+36434,
+37032,
+35827,
+38878,
+39976,
+37638,
+35238,
+34914,
+34686,
+34212,
+34398,
+34149,
+33995,
+33263,
+35471,
+38093,
+36285,
+33909,
+34378,
+34917,
+34033,
+32948,
+33072,
+32094,
+31317,
+31933,
+33214,
+35221,
+33639,
+31426,
+32158,
+32823,
+31254,
+31095,
+35191,
+33359,
+31070,
+34532,
+35753,
+34569,
+34040,
+34254,
+32567,
+32009,
+32114,
+33438,
+35375,
+33437,
+32330,
+35270,
+35973,
+33044,
+33481,
+34318,
+31964,
+31970,
+34383,
+34345,
+32484,
+33181,
+33878,
+32646,
+32419,
+32821,
+32587,
+31505,
+30381,
+31016,
+32691,
+31884,
+30390,
+30754,
+30730,
+29400,
+29728,
+30884,
+30460,
+29165,
+28833,
+29241,
+28503,
+28505,
+28044,
+27173,
+26607,
+27304,
+29211,
+29081,
+27802,
+27733,
+28488,
+28239,
+28724,
+28072,
+27570,
+28551,
+28542,
+29823,
+30779,
+30042,
+30118,
+30904,
+30941,
+30726,
+33232,
+34277,
+30033,
 31105,
+33245,
+32091,
 31156,
-31236,
-31314,
-31420,
-31553,
-31631,
-31633,
-31551,
-31395,
-31367,
-31104,
-31287,
-31078,
-31104,
-30918,
-30894,
-30942,
-31079,
-31262,
-31287,
-31264,
-31181,
-31157,
-31289,
-31340,
-31552,
-31369,
-31525,
-31315,
-31527,
-31576,
-31714,
-31787,
-31792,
-31975,
-32185,
-32610,
-32608,
-32713,
-32347,
-32316,
-32109,
-32344,
-32212,
-32477,
-32238,
-32162,
-32025,
-31978,
-32052,
-31949,
-31975,
-31684,
-31738,
-31578,
-31844,
-31947,
-32188,
+30245,
+31304,
+30296,
+30657,
+32368,
+31833,
+33230,
+31675,
+31322,
+35147,
+32931,
+30348,
+32412,
+33653,
+30529,
+31265,
+34116,
+32107,
+33275,
+34919,
+34323,
+33715,
+32632,
+34377,
+32931,
+33955,
+33713,
+30421,
+32602,
+32847,
+32544,
+34802,
+33617,
+32463,
+34199,
+34425,
+35719,
+33923,
+34130,
+36723,
+35295,
+35598,
+36914,
+35987,
+34778,
+34723,
+33564,
+35617,
+36506,
+33358,
+35853,
+36438,
+35533,
+38484,
+36931,
+36582,
+36055,
+35409,
+35988,
+34896,
+37923,
+34823,
+34427,
+36835,
+34403,
+34947,
+35339,
+36703,
+34258,
+34283,
+34932,
+35188,
+37035,
+33400,
+34371,
+36020,
+34708,
+35792,
+36564,
+35826,
+33744,
+33879,
+36093,
+33732,
+33749,
+36177,
+34933,
+35147,
+36144,
+35314,
+34399,
 32184,
-32240,
-32239,
-32292,
-32371,
+31802,
+33691,
+34469,
+34182,
+32673,
+34250,
+34893,
+34508,
+35480,
+32845,
+31273,
+30706,
+30113,
+30842,
+31279,
+32203,
+30514,
+30470,
+33467,
+33271,
+31017,
+29623,
+29174,
+28706,
+27638,
+27676,
+28644,
+27529,
+28538,
+28367,
+29077,
+32232,
+29275,
+28532,
+29081,
+28584,
+30044,
+29927,
+29251,
+28568,
+29114,
+30499,
+30983,
+29985,
+29964,
+29081,
+29623,
+31145,
+29621,
+30847,
+31628,
+30041,
+30000,
+30481,
+32311,
+31778,
+29286,
+29106,
+29882,
+31257,
+29910,
+29166,
+31431,
+31146,
+30714,
+31233,
+33038,
+33316,
+32138,
+32075,
+30862,
+31955,
+31889,
+30577,
+30963,
+31277,
+32098,
+31808,
+33887,
+33551,
+33402,
+35390,
+32565,
+32766,
+34444,
+33962,
+32602,
+32158,
+34798,
+34986,
+36239,
+38405,
+36379,
+37227,
+36814,
+35386,
+38086,
+36531,
+33726,
+33854,
+32084,
+33563,
+34902,
+35561,
+36422,
+33908,
+35920,
+36844,
+36078,
+37199,
+35629,
+35218,
+35143,
+35468,
+36029,
+35415,
+36037,
+34147,
+34231,
+37554,
+36892,
+35663,
+35731,
+35015,
+34784,
+35983,
+35426,
+32784,
+33054,
+33223,
+32393,
+33453,
+33285,
+34110,
+35378,
+32962,
+33313,
+35304,
+34614,
 32370,
-32082,
-31894,
-31633,
-31683,
-31765,
-32133,
-32239,
-32318,
-32265,
-32239,
-32346,
-32633,
-32717,
-32950,
-32794,
-32714,
-32795,
-32711,
-32877,
-32711,
-32663,
-32582,
-32529,
-32767,
-32953,
-33110,
-33189,
-33138,
-33214,
-33114,
-33159,
-33273,
-33080,
-33086,
-32873,
-32978,
-33031,
-33401,
-33347,
-33534,
-33164,
-33214,
-32901,
-33188,
-33007,
-33055,
-32876,
-32922,
-33246,
-33715,
-34063,
-33902,
-33638,
-33139,
-33397,
-33590,
-34005,
-33773,
-33267,
-32690,
-32870,
-33457,
-34375,
-34565,
-34034,
-33243,
-32740,
-33243,
-34563,
-35486,
-36096,
-35142,
-34221,
-33242,
-33189,
-33613,
-34166,
-34352,
-34325,
-34246,
-34985,
-36175,
-37440,
-37891,
-37230,
-35539,
-34195,
-33847,
-34962,
-36964,
-38604,
-39316,
-39026,
-38470,
-37971,
-38074,
-37733,
-37229,
-35884,
-34641,
-33719,
-33796,
-34352,
-35330,
-36039,
-36388,
-36620,
-36413,
-36252,
-35806,
-35589,
-35280,
-35194,
-35224,
-35488,
-35696,
-36307,
-36860,
-37283,
-37310,
-36594,
-35938,
-35512,
-36227,
-37548,
-39130,
-40162,
-40293,
-39738,
-38948,
-38391,
-37865,
-37149,
-36122,
-34985,
-34510,
-34511,
-35116,
-35356,
-35249,
-34537,
-34061,
-33928,
-34248,
-34693,
-34644,
-34403,
-34008,
-33904,
-34192,
-34326,
-34457,
-33982,
-33532,
-33165,
-33188,
-33745,
-34458,
-35617,
-36493,
-37545,
-37971,
-38075,
-37335,
-36437,
-35146,
-34322,
-33828,
-33793,
-34142,
-34457,
-34694,
-34908,
-34746,
-34801,
-34431,
-34114,
-33691,
-33085,
-32950,
-32796,
-33029,
-33113,
-33055,
-32558,
-32131,
-31476,
-31392,
-31263,
-31604,
-31686,
-31973,
-32057,
-32632,
-33219,
-34058,
-34803,
-35143,
-35065,
-34694,
-33639,
-32767,
-31737,
-31342,
-31340,
-31764,
-32293,
-32659,
-32822,
-32661,
-32370,
-31977,
-31418,
-30842,
-30520,
-30999,
-32106,
-33930,
-35276,
-35750,
-34908,
-33319,
-31661,
-30836,
-31081,
-32129,
-33511,
-34532,
-35280,
-35563,
-35727,
-35486,
-35224,
-34667,
-34195,
-33848,
-33931,
-34191,
-34380,
-34508,
-33746,
-33347,
-32292,
-32134,
-31920,
-32110,
-32209,
-32137,
-32051,
-32162,
-32607,
-33481,
-34430,
-35145,
-35354,
-35065,
-34273,
-33478,
-32612,
-32289,
-32319,
-33006,
-34111,
-35201,
-36196,
-36309,
-36092,
-34960,
-33982,
-33031,
-32610,
-32923,
-33457,
-34163,
-34461,
-34349,
-33666,
-32768,
-31973,
-31448,
-31525,
-31975,
-32795,
-33637,
-34378,
-34722,
-34799,
-34327,
-33770,
-32872,
-32610,
-32211,
-32742,
-33110,
-33771,
-33955,
-33903,
-33454,
-33084,
-32608,
-32399,
-32395,
-32401,
-32631,
-32665,
-32765,
-32847,
-32768,
-32660,
-32319,
-31948,
-31421,
-31024,
-30629,
-30494,
-30340,
-30573,
-30947,
-31551,
-32320,
-32686,
-32901,
-32422,
-31897,
-31077,
-30706,
-30393,
-30493,
-30499,
-30811,
-30734,
-30999,
-30626,
-30525,
-29781,
-29494,
-29069,
-29282,
-29757,
-30205,
-30813,
-30814,
-30943,
-30683,
-30363,
-30127,
-29624,
-29230,
-28909,
-28650,
-28804,
-28913,
-29333,
-29283,
-29174,
-28728,
-28409,
-28331,
-28383,
-28570,
-28619,
-28386,
-27959,
-27671,
-27275,
-27247,
-27011,
-26879,
-26612,
-26511,
-26718,
-27275,
-28014,
-28778,
-29284,
-29437,
-29284,
-29041,
-28597,
-28223,
-27937,
-27589,
-27539,
-27672,
-27879,
-28414,
-28510,
-28600,
-28352,
-28151,
-28221,
-28439,
-28804,
-28807,
-28621,
-28013,
-27620,
-27298,
-27619,
-27961,
-28382,
-28624,
-28487,
-28543,
-28408,
-28808,
-29333,
-29837,
-30416,
-30681,
-30602,
-30680,
-30260,
-30230,
-29917,
-29940,
-29943,
-30309,
-30684,
-31101,
-31131,
-31077,
-30707,
-30628,
-30629,
-30892,
-31445,
-32110,
-33001,
-34065,
-34586,
-34486,
-33294,
-31500,
-29862,
-29229,
-29836,
-31209,
-32661,
-33164,
-33268,
-32584,
-32343,
-32082,
-32105,
-31686,
-31208,
-30444,
-30153,
-30231,
-30682,
-31129,
-31315,
-31157,
-30732,
-30234,
-30099,
-30126,
-30735,
-31339,
-32030,
-32370,
-32213,
-32080,
-31842,
-32109,
-32660,
-33085,
-33320,
-32717,
-31840,
-30842,
-30521,
-31156,
-32610,
-34271,
-35330,
-35380,
-34222,
-32737,
-31319,
-30624,
-30631,
-30944,
-31446,
-32215,
-32922,
-33747,
-33902,
-33162,
-31819,
-30229,
-29705,
-30022,
-31550,
-32928,
-33874,
-33877,
-33375,
-32713,
-32452,
-32185,
-32529,
-32900,
-33823,
-34748,
-35197,
-35301,
-34432,
-34035,
-33637,
-34063,
-34112,
-33720,
-32897,
-32136,
-32526,
-33537,
-34876,
-34935,
-34008,
-32554,
-31952,
-32685,
-34247,
-35408,
-34985,
-33560,
-31605,
-30495,
-30630,
-31260,
-32110,
-32552,
-32638,
-32845,
-32794,
-32820,
-32688,
-32555,
-33033,
-33663,
-34749,
-35169,
-34801,
-33772,
-32580,
-32056,
-32342,
-33087,
-34006,
-34301,
-34323,
-34168,
-34298,
-34827,
-35409,
-35802,
-35622,
-34850,
-33879,
-33240,
-33271,
-34139,
-35329,
-36385,
-36754,
-36518,
-35803,
-35198,
-34984,
-35223,
-35673,
-36331,
-36545,
-36832,
-36730,
-36462,
-36229,
-35485,
-35067,
-34639,
-34592,
-34772,
-34854,
-34485,
-34033,
-33428,
-33612,
-34351,
-35700,
-36780,
-37072,
-36517,
-35090,
-34089,
-33348,
-33769,
-34592,
-35774,
-36653,
-36910,
-36492,
-35857,
-35249,
-35514,
-36331,
-37575,
-38575,
-38578,
-38049,
-36911,
-36177,
-36143,
-36469,
-36936,
-36810,
-36197,
-35385,
-35036,
-35171,
-35884,
-36329,
-36178,
-35510,
-34776,
-34694,
-35566,
-36994,
-38046,
-38025,
-36699,
-34723,
-33401,
-33189,
-34405,
-35988,
-37019,
-37046,
-35935,
-34907,
-34086,
-34248,
-34878,
-35172,
-35353,
-34960,
-35091,
-35487,
-36438,
-36966,
-36727,
-35463,
-34059,
-33191,
-33479,
-34326,
-35381,
-35409,
-34957,
-34247,
-34247,
-35088,
-36469,
-37251,
-37208,
-36012,
-34433,
-33215,
-32900,
-33507,
-34586,
-35518,
-35932,
-35781,
-35459,
-35011,
-34935,
-34983,
-35251,
-35591,
-36018,
-36540,
-36679,
-36752,
-36253,
-35622,
-35008,
-34407,
-33928,
-33559,
-33350,
-33689,
-34565,
-35564,
-36334,
-36015,
-34932,
-33586,
-32661,
-32952,
-33877,
-35196,
-35778,
-36147,
-35619,
-35408,
-35038,
-34933,
-34906,
-35038,
-35382,
-35856,
-36227,
-36253,
-35830,
-35250,
-34774,
-34642,
-34405,
-34007,
-33191,
-32158,
-31476,
-31259,
-31793,
-32579,
-33298,
-33716,
-33957,
-34139,
-34485,
-34588,
-34643,
-34219,
-33533,
-32978,
-32662,
-32820,
-33506,
-34194,
-34905,
-35091,
-34907,
-34563,
-34323,
-34462,
-34953,
-35387,
-35536,
-35040,
-33981,
-32821,
-31842,
-31395,
-31287,
-31342,
-31050,
-30760,
-30181,
-30071,
-30103,
-30361,
-30735,
-30867,
-30890,
-31052,
-31183,
-31709,
-32030,
-32264,
-31975,
-31289,
-30496,
-29914,
-29865,
-30519,
-31450,
-32659,
-33535,
-33769,
-33825,
-33109,
-32610,
-31789,
-31078,
-30496,
-29835,
-29547,
-29332,
-29311,
-29304,
-29205,
-28856,
-28597,
-28251,
-28013,
-27750,
-27591,
-27379,
-27620,
-27932,
-28439,
-28750,
-28545,
-28038,
-27461,
-27405,
-27777,
-28568,
-29017,
-28965,
-28383,
-27962,
-27960,
-29097,
-30443,
-31817,
-32291,
-31817,
-30549,
-29202,
-28332,
-28170,
-28622,
-29018,
-29305,
-29075,
-28668,
-28415,
-28565,
-28966,
-29756,
-30101,
-30283,
-30049,
-29756,
-29625,
-29519,
-29467,
-29120,
-28731,
-28328,
-28384,
-28728,
-29332,
-29838,
-30072,
-30338,
-30497,
-31023,
-31104,
-31050,
-30444,
-29783,
-29571,
-29758,
-30072,
-30181,
-29649,
-28992,
-28542,
-28911,
-29626,
-30732,
-31105,
-31155,
-30497,
-29967,
-29732,
-29702,
-30286,
-30707,
-31420,
-31659,
-31736,
-31264,
-30519,
-30052,
-29620,
-29840,
-30097,
-30206,
-30392,
-30309,
-30896,
-31494,
-32455,
-32738,
-32609,
-31687,
-30676,
-29788,
-29384,
-29177,
-29017,
-29122,
-29018,
-29520,
-29940,
-30550,
-30971,
-31156,
-31025,
-30654,
-30047,
-29362,
-28937,
-29017,
-29704,
-30734,
-31579,
-31869,
-31579,
-30997,
-30603,
-30601,
-30840,
-31050,
-31103,
-31131,
-31419,
-32294,
-33002,
-33826,
-33716,
-33296,
-32635,
-32159,
-32188,
-32316,
-32321,
-32051,
-31555,
-31102,
-30892,
-31105,
-31313,
-31950,
-32212,
-32292,
-32027,
-31395,
-30811,
-30393,
-30521,
-30734,
-31210,
-31207,
-31158,
-31050,
-31368,
-31815,
-32347,
-32263,
-31951,
-31603,
-32003,
-32845,
-33983,
-34642,
-34325,
-33560,
-32661,
-32661,
-33376,
-34562,
-35407,
-35462,
-34588,
-33561,
-32422,
-32108,
-32265,
-32793,
-33614,
-33980,
-34432,
-34405,
-34297,
-34063,
-33585,
-33110,
-32530,
-32133,
-31897,
-32237,
-32928,
-33820,
-34803,
-35170,
-35354,
-34988,
-35008,
-35227,
-36170,
-37286,
-38257,
-38501,
-38019,
-37075,
-36196,
-36151,
-36540,
-37392,
-37807,
-37472,
-36724,
-35675,
-35353,
-35541,
-36279,
-37283,
-37916,
-38102,
-37706,
-36595,
-35488,
-34193,
-33664,
-33482,
-33848,
-33930,
-33639,
-32712,
-32111,
-31733,
-32559,
-33557,
-34591,
-35037,
-34908,
-34693,
-34881,
-35460,
-36412,
-36728,
-36518,
-35565,
-34378,
-33957,
-33901,
-34934,
-35935,
-36861,
-37045,
-36860,
-36253,
-36016,
-36120,
-36465,
-37123,
-37100,
-37017,
-36201,
-35672,
-35169,
-35094,
-35246,
-35331,
-35301,
-35171,
-35012,
-35116,
-35489,
-35775,
-36177,
-36039,
-35779,
-35487,
-35328,
-35567,
-35962,
-36069,
-35830,
-34986,
-34086,
-33507,
-33508,
-34244,
-35516,
-36673,
-37549,
-37730,
-37522,
-36912,
-36333,
-35804,
-35619,
-35672,
-35725,
-35804,
-35618,
-35251,
-35037,
-34643,
-34774,
-34800,
-35171,
-35566,
-35856,
-36149,
-36014,
-35542,
-34612,
-33510,
-32659,
-32373,
-32660,
-33190,
-33533,
-33454,
-33164,
-32527,
-32558,
-32476,
-32845,
-33114,
-33238,
-33431,
-33425,
-33534,
-33401,
-33611,
-33798,
-34668,
-35223,
-35725,
-34985,
-34035,
-32661,
-32239,
-32503,
-33506,
-34565,
-34983,
-35172,
-34983,
-35015,
-34639,
-34329,
-33107,
-32372,
-31871,
-32157,
-33060,
-33663,
-33614,
-32898,
-31790,
-31421,
-31472,
-32425,
-33137,
-33689,
-33589,
-33240,
-32768,
-32609,
-32714,
-32925,
-33192,
-33213,
-33086,
-32978,
-32792,
-33009,
-33053,
-33430,
-33374,
-33557,
-33352,
-33398,
-33323,
-33401,
-33505,
-33560,
-33692,
-33770,
-33798,
-33742,
-33615,
-33266,
-32823,
-32290,
-31790,
-31553,
-31631,
-32028,
-32399,
-32739,
-32503,
-32002,
-31366,
-30895,
-30943,
-31420,
-31977,
-32394,
-32428,
-31918,
-31344,
-30468,
-30075,
-29490,
-29549,
-29303,
-29471,
-29436,
-29759,
-29808,
-29810,
-29519,
-29308,
-29070,
-29413,
-29810,
-30680,
-31157,
-31711,
-31843,
-32079,
-32242,
-32261,
-32138,
-31708,
-31078,
-30654,
-30391,
-30496,
-30628,
-31051,
-31288,
-31868,
-32295,
-32578,
-32323,
-31363,
-29892,
-28382,
-27354,
-26957,
-27486,
-28119,
-28886,
-28858,
-28701,
-28066,
-27881,
-27831,
-28328,
-28571,
-28910,
-28252,
-27723,
-26851,
-26511,
-26717,
-27357,
-28063,
-28650,
-28805,
-28991,
-29255,
-29730,
-30179,
-30313,
-30018,
-29574,
-29227,
-29652,
-30391,
-31656,
-32426,
-32765,
-32294,
-31736,
-30893,
-30732,
-30604,
-30969,
-31053,
-31313,
-31131,
-31260,
-31106,
-31418,
-31158,
-31182,
-30548,
-30181,
-29570,
-29494,
-29412,
-29705,
-29703,
-29889,
-29625,
-29730,
-29678,
-30152,
-30417,
-30945,
-31026,
-31206,
-31028,
-31205,
-31186,
-31524,
-31342,
-31208,
-30314,
-29700,
-29126,
-29068,
-29203,
-29387,
-28991,
-28436,
-27485,
-26933,
-26638,
-26564,
-26480,
-25824,
-25186,
-24240,
-23944,
-23580,
-23839,
-23342,
-22968,
-22021,
-21542,
-21572,
-22388,
-23392,
-24346,
-24682,
-24586,
-24496,
-24664,
-25582,
-26563,
-27485,
-27723,
-27459,
-26984,
-26931,
-27196,
-28013,
-28516,
-29016,
-29203,
-29572,
-30047,
-30945,
-31631,
-32187,
-32132,
-31634,
-31128,
-30602,
-30576,
-30627,
-30946,
-30918,
-30840,
-30733,
-30788,
-31128,
-31553,
-32107,
-32477,
-32582,
-32847,
-32819,
-33242,
-33350,
-33399,
-33165,
-32818,
-32663,
-32872,
-33481,
-34324,
-35118,
-35434,
-35672,
-35619,
-36043,
-36620,
-37735,
-38521,
-39185,
-39318,
-39314,
-39450,
-39711,
-40241,
-40584,
-40742,
-40558,
-40292,
-40401,
-40766,
-41405,
-41875,
-41748,
-41137,
-40162,
-39316,
-38787,
-38658,
-38653,
-38369,
-37967,
-37126,
-36357,
-35964,
-35670,
-36017,
-36199,
-36492,
-36279,
-35987,
-35411,
-35483,
-35545,
-36275,
-36652,
-36780,
-36622,
-36175,
-36145,
-36493,
-37124,
-37809,
-38157,
-38125,
-38078,
-38020,
-38631,
-39183,
-39898,
-40029,
-39924,
-39368,
-38948,
-38628,
-38789,
-39052,
-39315,
-39662,
-39525,
-39925,
-39976,
-40531,
-40848,
-40980,
-40821,
-40136,
-39499,
-38976,
-38838,
-39080,
-39528,
-39921,
-40112,
-40052,
-39926,
-39817,
-39924,
-40161,
-40452,
-40742,
-40980,
-41218,
-41375,
-41853,
-41903,
-42327,
-42090,
-42113,
-41669,
-41902,
-41879,
-42643,
-43120,
-43857,
-44361,
-44782,
-44968,
-45125,
-45101,
-45177,
-45208,
-45254,
-45395,
-45305,
-45236,
-44781,
-44491,
-44179,
-44091,
-44205,
-44385,
-44440,
-44492,
-44439,
-44360,
-44360,
-44282,
-43989,
-43357,
-42406,
-41376,
-40452,
-40161,
-40187,
-40796,
-41349,
-41773,
-41798,
-41772,
-41402,
-41272,
-41004,
-40798,
-40529,
-40240,
-40005,
-39921,
-39953,
-39789,
-39556,
-38733,
-37972,
-37149,
-36941,
-37043,
-37576,
-37756,
-37601,
-37046,
-35959,
-35385,
-34825,
-34669,
-34537,
-34060,
-33164,
-31842,
-30418,
-29122,
-28384,
-28305,
-28460,
-29259,
-29488,
-29972,
-29728,
-29361,
-28781,
-27906,
-27064,
-26086,
-25214,
-24608,
-24290,
-24184,
-24371,
-24342,
-24422,
-24107,
-23971,
-23923,
-24025,
-24291,
-24316,
-23948,
-23180,
-22020,
-20831,
-19985,
-19512,
-19510,
-19510,
-19247,
-18638,
-17479,
-16261,
-15154,
-14572,
-14492,
-14496,
-14648,
-14417,
-13725,
-13042,
-12011,
-11534,
-10824,
-10689,
-9979,
-9554,
-8788,
-8527,
-8364,
-8897,
-9315,
-10005,
-10083,
-10214,
-9873,
-9871,
-9634,
-9530,
-9077,
-8342,
-7494,
-6889,
-6807,
-7364,
-7996,
-8578,
-8288,
-7521,
-6306,
-5594,
-5435,
-5806,
-6544,
-6782,
-6465,
-5592,
-4620,
-4138,
-4171,
-4773,
-5356,
-5753,
-5620,
-5435,
-5092,
-5382,
-5648,
-6464,
-7074,
-8021,
-8632,
-9502,
-9819,
-10056,
-9767,
-9685,
-9769,
-11005,
-12804,
-15100,
-16737,
-17453,
-16973,
-16185,
-15469,
-15892,
-16898,
-18532,
-19617,
-20118,
-20117,
-20092,
-20751,
-21862,
-23312,
-24424,
-25081,
-25347,
-25874,
-26774,
-28303,
-29838,
-31179,
-32005,
-32948,
-34039,
-36171,
-38446,
-40899,
-41959,
-42298,
-41484,
-41296,
-42167,
-44468,
-47606,
-50726,
-52888,
-54265,
-54789,
-55770,
-56771,
-58408,
-59599,
-60071,
-59861,
-59204,
-59092,
-59917,
-61655,
-64008,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65170,
-64904,
-65065,
-65533,
-65534,
-65534,
-65534,
-65533,
-65534,
-65531,
-65534,
-65531,
-65534,
-65529,
-65534,
-65529,
-65534,
-65530,
-65534,
-65533,
-65534,
-65534,
-65534,
-65532,
-65534,
-65531,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-64695,
-62844,
-61475,
-60968,
-60866,
-60839,
-60307,
-59258,
-57931,
-56509,
-55716,
-54973,
-54372,
-53072,
-51043,
-48452,
-45654,
-43622,
-42352,
-42142,
-42671,
-43222,
-43782,
-43725,
-43329,
-42355,
-41084,
-39740,
-38523,
-37733,
-37598,
-37944,
-38629,
-39291,
-39605,
-39398,
-38627,
-37812,
-37099,
-37176,
-37811,
-38552,
-39314,
-39001,
-38444,
-37389,
-36859,
-36731,
-36989,
-36863,
-36357,
-34986,
-33480,
-32187,
-31287,
-31131,
-31103,
-31208,
-31186,
-31099,
-31055,
-31100,
-31185,
-30971,
-30654,
-29915,
-29098,
-28513,
-27832,
-27774,
-27512,
-27751,
-28012,
-28782,
-29913,
-31289,
-32424,
-32951,
-32479,
-31418,
-30023,
-29385,
-29520,
-30733,
-31976,
-32926,
-32792,
-31791,
-30548,
-29494,
-29174,
-29336,
-29755,
-30154,
-30099,
-29942,
-29571,
-29177,
-28699,
-27883,
-26851,
-25479,
-24210,
-22866,
-21964,
-20913,
-20168,
-18747,
-17607,
-16318,
-15731,
-15737,
-16366,
-16950,
-16949,
-16289,
-14624,
-12936,
-11403,
-10241,
-9371,
-8366,
-7178,
-6175,
-5461,
-5647,
-6307,
-6967,
-7231,
-6464,
-5332,
-3584,
-2190,
-1023,
-287,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-2,
-65535,
-0,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-3,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-3271,
-6015,
-6757,
-6491,
-7020,
-9423,
-13831,
-18774,
-23099,
-25957,
-28303,
-31525,
-36465,
-43594,
-50592,
-56641,
-59676,
-60573,
-60602,
-61233,
-63930,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65531,
-65534,
-65531,
-65534,
-65534,
-65534,
-65534,
-65531,
-65534,
-65532,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65531,
-65534,
-65534,
-65534,
-65534,
-65534,
-64722,
-60335,
-57355,
-55395,
-53817,
-50960,
-47188,
-43063,
-39953,
-38627,
-38500,
-38892,
-38551,
-37072,
-34641,
-31765,
-29174,
-27011,
-25611,
-24580,
-24054,
-23866,
-23843,
-24157,
-24581,
-25162,
-25399,
-25770,
-25795,
-26403,
-27274,
-28463,
-29360,
-28992,
-27564,
-25268,
-23471,
-23288,
-24659,
-27169,
-29255,
-29783,
-29256,
-27801,
-27012,
-27114,
-28068,
-29360,
-30126,
-30682,
-30760,
-31235,
-32133,
-33533,
-35198,
-36569,
-37415,
-37784,
-37732,
-38155,
-39342,
-41587,
-44678,
-47713,
-50540,
-52625,
-54554,
-56375,
-58331,
-60177,
-61314,
-62028,
-62342,
-62900,
-63742,
-64615,
-65064,
-64905,
-64615,
-64668,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65168,
-62663,
-60624,
-59204,
-58486,
-58252,
-58144,
-57669,
-56457,
-54604,
-52257,
-49879,
-47845,
-46368,
-45312,
-44964,
-44707,
-44673,
-44284,
-43329,
-41693,
-39685,
-37891,
-36728,
-36121,
-35540,
-34457,
-32714,
-30735,
-29280,
-28939,
-29598,
-30654,
-31395,
-31366,
-30577,
-29254,
-27697,
-26113,
-24579,
-23605,
-22891,
-22651,
-22630,
-22016,
-21334,
-19907,
-18717,
-17742,
-17267,
-17105,
-16794,
-16285,
-15024,
-13461,
-11432,
-9553,
-8077,
-7231,
-6913,
-6836,
-6464,
-5515,
-4009,
-2346,
-1105,
-601,
-948,
-1392,
-1794,
-1420,
-708,
-1,
-65535,
-1,
-65535,
-759,
-1345,
-1736,
-1422,
-762,
-65535,
-4,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-65535,
-65535,
-2,
-65535,
-3,
-65535,
-3,
-65535,
-0,
-0,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-2,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-3,
-65535,
-2,
-65535,
-65535,
-1214,
-7280,
-11485,
-13806,
-16050,
-19221,
-24765,
-31817,
-39553,
-46368,
-51146,
-54343,
-56137,
-57802,
-59835,
-62053,
-63929,
-64983,
-64801,
-63716,
-62424,
-61339,
-60997,
-61658,
-63372,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65531,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65530,
-65534,
-65006,
-61000,
-56875,
-51887,
-46105,
-40501,
-36204,
-33873,
-32822,
-32476,
-31472,
-29547,
-26217,
-21888,
-16790,
-11852,
-7865,
-5488,
-4432,
-4142,
-3691,
-2505,
-1315,
-259,
-631,
-1922,
-3877,
-5435,
-6149,
-5725,
-4221,
-2266,
-74,
-1,
-65535,
-1,
-734,
-2742,
-3771,
-3719,
-2847,
-1686,
-1184,
-1447,
-2451,
-3773,
-5274,
-6838,
-8418,
-10109,
-11801,
-13303,
-14731,
-15920,
-16763,
-17425,
-17979,
-19114,
-21385,
-25374,
-30759,
-36914,
-43066,
-48057,
-52229,
-55558,
-58460,
-61158,
-63450,
-65436,
-65532,
-65534,
-65532,
-65534,
-65532,
-65534,
-65530,
-65534,
-65530,
-65534,
-65533,
-65534,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65532,
-65534,
-65534,
-65533,
-65534,
-65534,
-63901,
-60549,
-57484,
-55847,
-55055,
-54527,
-53948,
-52729,
-51359,
-50301,
-49616,
-49483,
-49510,
-49138,
-48509,
-46865,
-45131,
-42902,
-40826,
-38996,
-37206,
-35802,
-34301,
-32949,
-31899,
-30810,
-30499,
-29833,
-29205,
-27825,
-25431,
-22490,
-18959,
-15574,
-12434,
-9528,
-7311,
-5381,
-4275,
-3454,
-3349,
-2953,
-2795,
-2107,
-1343,
-286,
-65535,
-65535,
-65535,
-65535,
-1,
-65535,
-3,
-65535,
-4,
-65535,
-1,
-65535,
-0,
-65535,
-1,
-65535,
-2,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-3,
-65535,
-2,
-65535,
-0,
-0,
-65535,
-2,
-65535,
-65535,
-2,
-65535,
-2,
-65535,
-0,
-65535,
-1,
-65535,
-2,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-4,
-65535,
-1241,
-6198,
-9847,
-12194,
-15049,
-19616,
-26693,
-35302,
-43701,
-50247,
-54186,
-56400,
-58225,
-60892,
-64559,
-65534,
-65533,
-65534,
-65534,
-65533,
-65534,
-63845,
-62426,
-61655,
-61868,
-63693,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-63137,
-57827,
-52601,
-47765,
-42485,
-36704,
-30466,
-24454,
-19848,
-17033,
-16101,
-16264,
-16526,
-16367,
-15366,
-13673,
-11853,
-10030,
-8499,
-7046,
-5858,
-4404,
-3113,
-1816,
-948,
-364,
-576,
-1026,
-2450,
-3931,
-5700,
-6939,
-7311,
-6650,
-5223,
-3747,
-3031,
-3454,
-4750,
-6173,
-6942,
-6703,
-5908,
-5227,
-5407,
-6228,
-7654,
-8894,
-9924,
-11221,
-13037,
-16293,
-20166,
-24691,
-28354,
-31078,
-32636,
-33584,
-34670,
-36674,
-39186,
-42827,
-46289,
-50169,
-53787,
-57856,
-62263,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-62870,
-61183,
-59755,
-58568,
-56745,
-54052,
-50433,
-46527,
-42800,
-40005,
-38442,
-38025,
-38205,
-38499,
-37995,
-36729,
-34192,
-31104,
-27723,
-24634,
-22918,
-22202,
-23183,
-24104,
-25058,
-24527,
-23127,
-21309,
-19693,
-19274,
-19273,
-19456,
-18932,
-17343,
-15709,
-14149,
-13754,
-14256,
-15258,
-16078,
-16104,
-15285,
-13754,
-11905,
-9845,
-7787,
-5512,
-3617,
-2076,
-1321,
-1179,
-1161,
-522,
-65535,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-3,
-65535,
-1,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-2,
-65535,
-1,
-65535,
-3612,
-8104,
-13487,
-19883,
-27537,
-35804,
-43674,
-50829,
-56720,
-62183,
-65534,
-65532,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65531,
-65534,
-65530,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65531,
-65534,
-62921,
-56907,
-51197,
-45788,
-40609,
-35276,
-29679,
-24341,
-19592,
-15969,
-13571,
-12167,
-11407,
-11242,
-11379,
-11824,
-12566,
-13410,
-14098,
-14730,
-15153,
-15365,
-15496,
-15180,
-14599,
-13594,
-12435,
-11560,
-10983,
-11059,
-11377,
-11721,
-11534,
-11036,
-10002,
-9002,
-8258,
-7525,
-7148,
-6628,
-5880,
-4857,
-3375,
-1842,
-526,
-65535,
-129,
-1235,
-3060,
-5275,
-8448,
-12088,
-17425,
-23076,
-29386,
-35066,
-39790,
-43833,
-47555,
-51146,
-55241,
-58857,
-62925,
-65534,
-65533,
-65534,
-65532,
-65534,
-65531,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65531,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-64162,
-62849,
-61600,
-60922,
-59725,
-58545,
-57059,
-55876,
-55476,
-55505,
-56243,
-56217,
-56298,
-55528,
-55876,
-57456,
-61105,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65532,
-65534,
-65531,
-65534,
-65534,
-65532,
-64327,
-60546,
-57513,
-55264,
-53500,
-51725,
-49670,
-47080,
-44358,
-41352,
-38523,
-35488,
-32344,
-28805,
-25349,
-22069,
-19647,
-17895,
-16741,
-15865,
-15232,
-15103,
-15889,
-17824,
-20591,
-23499,
-25717,
-26903,
-27249,
-27300,
-27751,
-28409,
-29176,
-29466,
-29017,
-27909,
-26376,
-24686,
-23024,
-21410,
-19883,
-18371,
-16927,
-15228,
-13150,
-10530,
-7125,
-3325,
-65535,
-2,
-65535,
-65535,
-4,
-65535,
-3,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-2,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-4698,
-12590,
-18904,
-24687,
-30388,
-37551,
-45676,
-54267,
-61997,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65533,
-65534,
-65531,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65533,
-65534,
-65530,
-65534,
-65530,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65531,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-58539,
-51070,
-45202,
-40244,
-35062,
-29626,
-24263,
-20040,
-17423,
-16079,
-14702,
-13096,
-10608,
-8925,
-8072,
-8898,
-10450,
-11986,
-13013,
-13465,
-13989,
-14839,
-16313,
-17768,
-19327,
-19984,
-20094,
-19350,
-18217,
-16658,
-14969,
-12962,
-10611,
-8154,
-5225,
-2688,
-287,
-65535,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-1077,
-4248,
-7706,
-11641,
-16210,
-21199,
-26273,
-32053,
-37706,
-44255,
-50564,
-56721,
-62078,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65531,
-65534,
-65531,
-65534,
-65533,
-65534,
-65533,
-65534,
-65530,
-65534,
-65529,
-65534,
-65507,
-62586,
-60333,
-58147,
-56718,
-55794,
-55188,
-55399,
-55819,
-56563,
-57006,
-57144,
-56982,
-57379,
-58594,
-61049,
-64140,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65532,
-65534,
-65532,
-65534,
-65532,
-65534,
-65534,
-65534,
-65247,
-62584,
-59303,
-56274,
-53784,
-51756,
-50487,
-49165,
-48138,
-46735,
-45470,
-44201,
-43331,
-42723,
-42379,
-42115,
-41879,
-41612,
-41748,
-41981,
-42434,
-42299,
-41773,
-40873,
-40216,
-40582,
-41456,
-42485,
-42379,
-41007,
-38550,
-36175,
-34375,
-33775,
-33634,
-33642,
-33108,
-32373,
-30970,
-29521,
-27509,
-25270,
-22862,
-20860,
-19219,
-18294,
-17322,
-16548,
-15186,
-13959,
-12332,
-11083,
-9663,
-8761,
-7761,
-7097,
-5806,
-3930,
-1130,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-65535,
-2,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-2,
-65535,
-4,
-65535,
-2,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-3,
-65535,
-2,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-65535,
-65535,
-65535,
-2162,
-12431,
-21546,
-29069,
-35777,
-42355,
-49586,
-57276,
-65247,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65530,
-65534,
-65530,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65531,
-65534,
-65531,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65532,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-63557,
-54107,
-45678,
-38632,
-33451,
-28940,
-25055,
-21017,
-17291,
-14706,
-13065,
-12725,
-12222,
-11614,
-10084,
-8815,
-7706,
-8023,
-8817,
-10292,
-11300,
-11903,
-11696,
-11322,
-10957,
-10977,
-11593,
-12165,
-12727,
-12009,
-10849,
-8604,
-6624,
-4986,
-3931,
-3032,
-1948,
-1,
-65535,
-1,
-65535,
-65535,
-65535,
-0,
-65535,
-975,
-4113,
-7470,
-11508,
-15470,
-19406,
-22679,
-25769,
-28542,
-31526,
-34959,
-38524,
-42458,
-46368,
-50143,
-54263,
-57960,
-61762,
-64774,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65532,
-65534,
-65532,
-65534,
-65533,
-65534,
-65532,
-65534,
-65531,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65485,
-64695,
-63636,
-62477,
-60759,
-59676,
-59149,
-59570,
-61023,
-61922,
-61974,
-59808,
-56138,
-51543,
-47898,
-45655,
-45416,
-45786,
-46685,
-46445,
-46341,
-45971,
-46710,
-48401,
-50672,
-53100,
-54766,
-55397,
-55530,
-55217,
-55473,
-55905,
-56610,
-57010,
-57011,
-56505,
-55955,
-55477,
-55345,
-55057,
-54472,
-53209,
-51567,
-49775,
-48506,
-47185,
-46184,
-44146,
-41511,
-38362,
-34911,
-32761,
-31004,
-30359,
-29681,
-28803,
-27567,
-26559,
-26062,
-26586,
-27645,
-28938,
-29703,
-29890,
-29492,
-28938,
-28172,
-27381,
-26217,
-25005,
-23866,
-23551,
-23525,
-24000,
-23365,
-22205,
-19404,
-16818,
-13938,
-12143,
-10267,
-8077,
-4827,
-314,
-65535,
-1,
-65535,
-0,
-0,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-11509,
-26535,
-39582,
-50114,
-58492,
-65530,
-65534,
-65531,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65530,
-65534,
-65531,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-63424,
-56008,
-47368,
-38420,
-29940,
-23104,
-18453,
-15550,
-13277,
-11088,
-9025,
-7656,
-7995,
-9767,
-12723,
-15947,
-18716,
-21098,
-22597,
-23870,
-24422,
-24421,
-24187,
-23020,
-21440,
-18243,
-13726,
-7972,
-1868,
-1,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-2770,
-9870,
-16661,
-22439,
-28068,
-33479,
-39871,
-46765,
-54446,
-61657,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65533,
-65534,
-62448,
-58093,
-53417,
-49035,
-44676,
-41958,
-40372,
-41245,
-43487,
-47056,
-51037,
-55483,
-60542,
-65534,
-65530,
-65534,
-65531,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65531,
-65534,
-65530,
-65534,
-65532,
-60524,
-52253,
-42964,
-33477,
-24425,
-16630,
-10083,
-4803,
-65535,
-0,
-65535,
-65535,
-1,
-1473,
-6334,
-11059,
-15102,
-19877,
-26091,
-33950,
-42807,
-51116,
-58175,
-63449,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-61922,
-54684,
-47426,
-40343,
-33642,
-27376,
-21865,
-17976,
-16053,
-16868,
-19908,
-24870,
-30181,
-35459,
-39423,
-42511,
-45232,
-47951,
-51410,
-55164,
-58695,
-61661,
-63477,
-64853,
-65434,
-65534,
-65513,
-64324,
-62027,
-59043,
-55636,
-51727,
-47371,
-41746,
-35354,
-28147,
-20989,
-14492,
-8157,
-2080,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-1,
-65535,
-3,
-65535,
-2,
-65535,
-65535,
-3,
-65535,
-4,
-65535,
-2,
-65535,
-1,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-1,
-65535,
-65535,
-2,
-65535,
-3,
-15572,
-34090,
-49904,
-61606,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65532,
-65462,
-59253,
-53630,
-48849,
-44968,
-41242,
-37445,
-33555,
-29629,
-26320,
-23368,
-20699,
-18057,
-15127,
-12672,
-11164,
-11406,
-13672,
-17214,
-21490,
-25164,
-28170,
-30128,
-31790,
-32659,
-32956,
-31601,
-28519,
-23127,
-16288,
-8579,
-998,
-65535,
-0,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-65535,
-5725,
-14600,
-23417,
-31765,
-38814,
-45178,
-50832,
-56610,
-62084,
-65530,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-63321,
-59202,
-54922,
-50858,
-47606,
-45603,
-45495,
-47000,
-49644,
-52913,
-56695,
-60916,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65530,
-65534,
-65531,
-65534,
-65533,
-65534,
-65534,
-63454,
-57906,
-52838,
-47686,
-42355,
-36963,
-31847,
-27191,
-23369,
-19694,
-15787,
-11721,
-7336,
-3455,
-180,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-1635,
-6462,
-13757,
-23785,
-34011,
-42906,
-48454,
-51966,
-55000,
-59679,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-64586,
-60787,
-58911,
-58777,
-59178,
-58775,
-57011,
-54738,
-53101,
-52758,
-53497,
-54790,
-55770,
-56585,
-57750,
-59834,
-63612,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65532,
-65534,
-65534,
-64826,
-57407,
-51964,
-47370,
-42276,
-35590,
-28122,
-21172,
-16344,
-13011,
-10853,
-7912,
-4649,
-1549,
-2,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-3,
-65535,
-2,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-2,
-65535,
-0,
-65535,
-0,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-0,
-0,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-0,
-0,
-65535,
-1,
-65535,
-1,
-1077,
-19960,
-39078,
-55821,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65531,
-65534,
-65532,
-65534,
-65534,
-65533,
-65534,
-63292,
-60815,
-58407,
-56349,
-55056,
-56453,
-60736,
-65532,
-65534,
-65532,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-59389,
-51831,
-45867,
-41190,
-38049,
-36147,
-35461,
-35883,
-37124,
-38656,
-40241,
-41904,
-44307,
-47450,
-51252,
-54369,
-56032,
-56059,
-54922,
-54212,
-53628,
-53286,
-51516,
-48137,
-42986,
-37152,
-31181,
-24847,
-18109,
-9848,
-1206,
-3,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-2,
-7466,
-18113,
-28857,
-38974,
-48109,
-55901,
-62872,
-65533,
-65534,
-65529,
-65534,
-65529,
-65534,
-65534,
-65533,
-65534,
-61866,
-56824,
-52178,
-47925,
-43858,
-40373,
-37308,
-35620,
-35011,
-36202,
-38469,
-41853,
-45811,
-50408,
-55373,
-60890,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65531,
-65534,
-65533,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-63533,
-55161,
-46657,
-38763,
-31974,
-26508,
-22152,
-18771,
-16210,
-15126,
-15524,
-17792,
-20965,
-24765,
-28250,
-31846,
-35272,
-38897,
-41849,
-43991,
-44625,
-44412,
-43648,
-43382,
-43410,
-43171,
-42486,
-40557,
-39158,
-38814,
-41455,
-46659,
-53258,
-59308,
-63055,
-64114,
-63797,
-63054,
-63510,
-64636,
-65490,
-65533,
-64351,
-63454,
-63425,
-65513,
-65534,
-65534,
-65534,
-65532,
-65534,
-65531,
-65534,
-65533,
-65534,
-65532,
-65534,
-65531,
-65534,
-65532,
-62160,
-59148,
-56534,
-53551,
-50644,
-48426,
-47715,
-48770,
-51094,
-53445,
-54525,
-54107,
-52094,
-49620,
-46996,
-44285,
-41056,
-36862,
-32450,
-27881,
-24714,
-22546,
-21545,
-20857,
-20012,
-18956,
-17847,
-16949,
-15867,
-14439,
-11906,
-8366,
-3719,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-2,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-3,
-65535,
-3,
-65535,
-0,
-0,
-65535,
-0,
-0,
-65535,
-65535,
-0,
-65535,
-3,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-3,
-65535,
-13307,
-29332,
-46395,
-62211,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-64771,
-63797,
-64272,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65431,
-59627,
-54999,
-51282,
-48952,
-48640,
-50988,
-54871,
-59490,
-63059,
-65532,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-61155,
-55609,
-49933,
-44861,
-40030,
-35197,
-29465,
-22997,
-15655,
-8683,
-2214,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-1,
-65535,
-1504,
-8232,
-15181,
-22230,
-28673,
-34644,
-39737,
-43886,
-46392,
-47610,
-47105,
-46448,
-45335,
-44494,
-43223,
-40823,
-37915,
-34855,
-32950,
-32690,
-33636,
-35227,
-36988,
-38606,
-41322,
-44413,
-48559,
-52441,
-56295,
-60286,
-64798,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-62794,
-59517,
-56244,
-53285,
-50013,
-47738,
-46027,
-45835,
-46133,
-46944,
-47850,
-48872,
-50596,
-52543,
-55322,
-58116,
-61131,
-63584,
-64984,
-64536,
-61498,
-56482,
-49799,
-43542,
-38550,
-35593,
-33717,
-31659,
-28250,
-23975,
-20672,
-21225,
-26459,
-35985,
-45922,
-53547,
-56694,
-57457,
-58436,
-64086,
-65534,
-65533,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65531,
-65534,
-62922,
-58858,
-54080,
-50431,
-48958,
-50009,
-51649,
-52363,
-51065,
-48800,
-47367,
-48429,
-52467,
-58514,
-64773,
-65534,
-65534,
-65534,
-64694,
-61074,
-60023,
-60941,
-62901,
-62474,
-58225,
-49852,
-39608,
-29966,
-22022,
-15229,
-7948,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-65535,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-3,
-65535,
-3,
-65535,
-3,
-65535,
-2,
-65535,
-1,
-65535,
-3,
-65535,
-2,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-2,
-65535,
-1,
-65535,
-18983,
-38894,
-56375,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65531,
-65534,
-65532,
-65534,
-64215,
-64143,
-64373,
-65306,
-65531,
-65534,
-65532,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65533,
-65534,
-65530,
-65534,
-65533,
-65534,
-65534,
-65531,
-65534,
-65531,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-62902,
-57296,
-54318,
-53232,
-54316,
-56983,
-60732,
-65302,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-59385,
-50990,
-43514,
-37785,
-32794,
-28250,
-23077,
-17450,
-11324,
-5622,
-72,
-1,
-65535,
-1,
-65535,
-2,
-65535,
-3,
-65535,
-2,
-65535,
-65535,
-1,
-65535,
-65535,
-1,
-3637,
-8924,
-13514,
-17294,
-20089,
-22233,
-23390,
-23448,
-21833,
-19405,
-16501,
-14675,
-14102,
-14382,
-14841,
-14753,
-14523,
-15178,
-17267,
-21147,
-26085,
-31502,
-37096,
-42750,
-48744,
-54658,
-60496,
-65534,
-65532,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-64985,
-64904,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65531,
-65534,
-65531,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-64562,
-59385,
-54555,
-51013,
-49114,
-48375,
-47422,
-44678,
-39501,
-32925,
-27460,
-26085,
-30392,
-39711,
-51359,
-61974,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-63163,
-58806,
-56717,
-55532,
-54315,
-52018,
-50012,
-49668,
-51965,
-56034,
-59858,
-61264,
-60123,
-57222,
-54791,
-54209,
-55769,
-58805,
-62106,
-64772,
-65534,
-64876,
-62162,
-58670,
-55216,
-52597,
-49723,
-45652,
-38975,
-30811,
-22522,
-16236,
-12433,
-9608,
-6809,
-3111,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-3,
-4085,
-6468,
-4826,
-629,
-1,
-65535,
-3,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-65535,
-65535,
-1,
-65535,
-4,
-65535,
-3,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-3,
-65535,
-2,
-65535,
-65535,
-1,
-65535,
-0,
-0,
-65535,
-5,
-65535,
-4,
-65535,
-3,
-65535,
-5,
-65535,
-3,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-6017,
-19959,
-34536,
-47926,
-57773,
-63086,
-64849,
-64803,
-64718,
-64404,
-63215,
-60284,
-56614,
-53100,
-50962,
-50329,
-50037,
-50831,
-52519,
-56745,
-62636,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65531,
-65534,
-65531,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65532,
-65534,
-65531,
-65534,
-63846,
-62291,
-62371,
-64350,
-65534,
-65534,
-65531,
-65534,
-65531,
-65534,
-65531,
-65534,
-65531,
-65534,
-65534,
-65534,
-65534,
-64375,
-54819,
-45628,
-37598,
-30657,
-24631,
-18852,
-13410,
-8314,
-4642,
-2558,
-2080,
-2110,
-1419,
-1,
-65535,
-1,
-65535,
-65535,
-2,
-65535,
-5,
-65535,
-2,
-65535,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-3,
-65535,
-1,
-65535,
-0,
-65535,
-1,
-65535,
-1,
-65535,
-1395,
-3376,
-6015,
-9873,
-15391,
-22519,
-30024,
-37728,
-44099,
-49878,
-54184,
-57881,
-60441,
-62318,
-63216,
-63822,
-64007,
-64324,
-64985,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65530,
-65534,
-65532,
-65534,
-65248,
-58777,
-52232,
-46470,
-42330,
-39313,
-37655,
-36911,
-38103,
-42194,
-49457,
-59597,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-62817,
-57302,
-51778,
-46872,
-43671,
-42777,
-44253,
-46475,
-48556,
-49302,
-49506,
-49433,
-49720,
-49880,
-49139,
-47371,
-45310,
-44230,
-45626,
-49009,
-53654,
-57749,
-59730,
-59676,
-57194,
-53445,
-49059,
-44468,
-40713,
-36652,
-32897,
-27382,
-20855,
-13545,
-7016,
-2746,
-467,
-2,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-2082,
-6174,
-10612,
-13226,
-13382,
-9715,
-3216,
-65535,
-0,
-65535,
-0,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-2,
-65535,
-3,
-65535,
-4,
-65535,
-0,
-65535,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-65535,
-1,
-65535,
-3,
-65535,
-2,
-65535,
-2,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-3217,
-16580,
-28039,
-37469,
-44808,
-49536,
-51438,
-50328,
-46235,
-40663,
-34800,
-30761,
-29809,
-31712,
-36198,
-40982,
-44992,
-47899,
-50118,
-53417,
-58409,
-65038,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65533,
-65534,
-65531,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65531,
-65534,
-65532,
-65534,
-65533,
-65534,
-65532,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65532,
-65534,
-57219,
-47925,
-39476,
-32791,
-27463,
-23336,
-19830,
-16816,
-14625,
-12909,
-11641,
-10532,
-8894,
-6915,
-4378,
-1502,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-1,
-65535,
-4,
-65535,
-3,
-65535,
-1,
-65535,
-0,
-65535,
-0,
-65535,
-524,
-4484,
-9291,
-15152,
-21837,
-28829,
-35412,
-41240,
-45709,
-49404,
-52148,
-54081,
-55846,
-56401,
-57275,
-57667,
-58545,
-59752,
-61553,
-63743,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-64244,
-61445,
-59652,
-59437,
-61738,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65533,
-62899,
-58991,
-54525,
-50594,
-47528,
-45813,
-45310,
-45524,
-45810,
-45814,
-45073,
-44254,
-43330,
-42485,
-41693,
-40214,
-38498,
-36226,
-34881,
-34165,
-35542,
-37702,
-41089,
-44147,
-46236,
-46392,
-43992,
-39156,
-32266,
-24634,
-17370,
-11195,
-7017,
-3693,
-1211,
-65535,
-0,
-65535,
-65535,
-2,
-65535,
-0,
-65535,
-1367,
-2822,
-4353,
-5276,
-6704,
-8523,
-10613,
-12299,
-13175,
-12035,
-9029,
-3796,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-2,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-3,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-3,
-65535,
-2,
-65535,
-1,
-11271,
-21544,
-28410,
-32529,
-34352,
-35090,
-34009,
-31764,
-27511,
-22497,
-17183,
-13150,
-10686,
-10405,
-11769,
-14786,
-18770,
-24448,
-30815,
-38628,
-46315,
-53919,
-60285,
-65533,
-65534,
-65532,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65531,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65533,
-59625,
-50618,
-43119,
-36702,
-30707,
-24978,
-19535,
-14495,
-10715,
-7735,
-6014,
-4697,
-3612,
-2188,
-444,
-0,
-65535,
-0,
-65535,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-1,
-65535,
-1,
-3267,
-9347,
-14359,
-19168,
-23260,
-27803,
-31896,
-36121,
-39315,
-41905,
-43436,
-44730,
-45865,
-47634,
-49617,
-52201,
-54687,
-57431,
-60178,
-63639,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-60177,
-53368,
-47235,
-42304,
-38653,
-36598,
-35724,
-36015,
-36834,
-37680,
-38840,
-39792,
-41111,
-42196,
-42801,
-42644,
-41270,
-39237,
-36914,
-35170,
-34113,
-33640,
-32951,
-31369,
-28407,
-24372,
-19695,
-15100,
-11115,
-7333,
-4117,
-629,
-65535,
-0,
-65535,
-65535,
-3,
-65535,
-1,
-65535,
-65535,
-3,
-65535,
-2,
-178,
-2136,
-4140,
-6149,
-8524,
-10480,
-12090,
-12565,
-11748,
-9630,
-6206,
-1735,
-0,
-1,
-65535,
-5,
-65535,
-5,
-65535,
-5,
-65535,
-2,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-2,
-65535,
-2,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-2,
-65535,
-3,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-0,
-1816,
-14389,
-24605,
-31767,
-36170,
-37550,
-36726,
-33878,
-29755,
-24794,
-19562,
-14863,
-10401,
-7440,
-4671,
-3613,
-3322,
-5146,
-8550,
-14203,
-21095,
-29043,
-37073,
-45019,
-52864,
-61050,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65532,
-65534,
-65532,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-61314,
-52230,
-44676,
-38552,
-32554,
-27144,
-21331,
-16316,
-11852,
-8896,
-7255,
-6970,
-7280,
-7684,
-7651,
-7337,
-6730,
-6543,
-6520,
-6410,
-5728,
-3691,
-788,
-65535,
-65535,
-65535,
-2,
-65535,
-3,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-5570,
-10451,
-14704,
-18404,
-22043,
-26061,
-29915,
-33585,
-36175,
-37651,
-38050,
-37890,
-37705,
-37838,
-38470,
-39423,
-41059,
-42986,
-46104,
-50195,
-55743,
-62633,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65532,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65250,
-61628,
-58201,
-54551,
-51703,
-49667,
-48242,
-47397,
-46738,
-46418,
-46395,
-46762,
-46685,
-46128,
-44626,
-42351,
-39899,
-37414,
-35064,
-32795,
-30257,
-27803,
-25216,
-23020,
-20463,
-17794,
-14650,
-11565,
-8706,
-6388,
-4167,
-2029,
-65535,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-919,
-2239,
-3245,
-4325,
-5488,
-7047,
-8313,
-8842,
-7970,
-5912,
-2870,
-4,
-65535,
-3,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-1,
-65535,
-2,
-65535,
-3,
-65535,
-0,
-0,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-3429,
-17846,
-29072,
-37041,
-41196,
-42085,
-40138,
-36304,
-31077,
-25216,
-18637,
-11987,
-5274,
-1,
-65535,
-0,
-65535,
-2,
-65535,
-2,
-3346,
-10428,
-18454,
-27247,
-36651,
-46893,
-57407,
-65534,
-65533,
-65534,
-65532,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65531,
-65534,
-65532,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65531,
-65534,
-65533,
-65534,
-55137,
-44912,
-35463,
-26270,
-18004,
-10508,
-4560,
-290,
-65535,
-1,
-65535,
-50,
-2396,
-4303,
-6648,
-8419,
-10111,
-11111,
-11378,
-10876,
-9499,
-7579,
-5298,
-3063,
-758,
-1,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-2,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-65535,
-2688,
-9609,
-15679,
-21126,
-25605,
-29629,
-33108,
-36227,
-39239,
-41690,
-43913,
-45336,
-46235,
-46607,
-46549,
-46712,
-46921,
-47766,
-49301,
-51593,
-54899,
-59199,
-64379,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65531,
-65534,
-65530,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65531,
-65534,
-65530,
-65534,
-65531,
-65534,
-65531,
-65534,
-65531,
-65534,
-65533,
-65534,
-64932,
-59649,
-54501,
-49906,
-46023,
-43596,
-42008,
-41536,
-41242,
-41140,
-41059,
-40953,
-40901,
-40583,
-39792,
-38182,
-35748,
-32983,
-30121,
-27780,
-25741,
-24026,
-22285,
-20142,
-17743,
-14730,
-11641,
-8156,
-4853,
-1792,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-0,
-1605,
-3562,
-4483,
-4222,
-2476,
-65535,
-1,
-65535,
-2,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-1,
-65535,
-3,
-65535,
-5,
-65535,
-6,
-65535,
-4,
-65535,
-3,
-65535,
-4,
-65535,
-0,
-0,
-65535,
-3,
-65535,
-0,
-0,
-65535,
-9744,
-21435,
-30524,
-36226,
-38841,
-38762,
-36042,
-31842,
-26719,
-21309,
-16233,
-11538,
-6965,
-2769,
-65535,
-1,
-65535,
-3,
-65535,
-2958,
-9155,
-16977,
-26165,
-36411,
-48005,
-59835,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65533,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-64960,
-52834,
-40190,
-28197,
-16818,
-6755,
-0,
-65535,
-0,
-65535,
-1,
-65535,
-65535,
-1,
-65535,
-2508,
-6251,
-9081,
-11218,
-12513,
-13357,
-12883,
-11190,
-7841,
-3347,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-1,
-65535,
-0,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-5067,
-11006,
-17002,
-22574,
-27882,
-32952,
-37731,
-42064,
-46023,
-48849,
-50752,
-51409,
-51255,
-50405,
-49433,
-48530,
-48058,
-48190,
-49191,
-50910,
-53260,
-56347,
-59705,
-63610,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65531,
-65534,
-65533,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65532,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-60575,
-52520,
-44358,
-37552,
-32418,
-28917,
-26794,
-25271,
-24763,
-25059,
-26612,
-28781,
-30653,
-31315,
-30233,
-28198,
-26034,
-25267,
-25556,
-26803,
-27640,
-27700,
-26401,
-24080,
-21226,
-17928,
-14702,
-11960,
-9422,
-8181,
-7206,
-7123,
-6759,
-5934,
-4539,
-1843,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-75,
-2082,
-3454,
-3825,
-2609,
-418,
-65535,
-0,
-65535,
-0,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-3,
-65535,
-2,
-65535,
-2,
-65535,
-3,
-65535,
-2,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-9793,
-20197,
-27986,
-32770,
-35749,
-36861,
-37152,
-36249,
-34620,
-32131,
-28913,
-25108,
-20724,
-16423,
-12960,
-11325,
-12196,
-15626,
-20834,
-27088,
-33850,
-41165,
-49378,
-58592,
-65534,
-65534,
-65534,
-65534,
-65531,
-65534,
-65533,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65531,
-65534,
-65530,
-65534,
-65533,
-65534,
-65534,
-65533,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-60601,
-51014,
-40663,
-29678,
-18902,
-8950,
-600,
-0,
-65535,
-0,
-0,
-65535,
-65535,
-65535,
-65535,
-1,
-65535,
-65535,
-2,
-65535,
-3,
-65535,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-3,
-65535,
-0,
-65535,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-3,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-0,
-3560,
-11641,
-20066,
-28620,
-37205,
-45283,
-52600,
-58857,
-63613,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65531,
-65534,
-65534,
-65534,
-65534,
-65534,
-63373,
-60284,
-57802,
-57062,
-58566,
-62585,
-65530,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65063,
-56482,
-47714,
-39132,
-31393,
-24608,
-18743,
-14099,
-10108,
-7417,
-5435,
-4853,
-5041,
-6014,
-7049,
-7730,
-8131,
-8575,
-10245,
-13196,
-17797,
-22862,
-27301,
-30470,
-31791,
-32132,
-31158,
-29490,
-26696,
-23152,
-19593,
-16655,
-14522,
-13330,
-11667,
-9926,
-7124,
-4406,
-1157,
-65535,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-1,
-2977,
-7683,
-11770,
-14469,
-15970,
-16527,
-16448,
-15311,
-13094,
-9344,
-4853,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-65535,
-1,
-65535,
-0,
-0,
-65535,
-3,
-65535,
-2,
-65535,
-1,
-65535,
-3,
-65535,
-3,
-65535,
-2,
-65535,
-65535,
-65535,
-65535,
-65535,
-2,
-65535,
-4,
-65535,
-3,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-7495,
-20565,
-32083,
-41560,
-48558,
-53050,
-55316,
-55904,
-55159,
-53101,
-49615,
-44545,
-38682,
-32743,
-27825,
-24558,
-22967,
-22708,
-23417,
-25215,
-28490,
-33875,
-41220,
-50668,
-60762,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65532,
-61978,
-55738,
-48323,
-40188,
-31234,
-22523,
-13937,
-6228,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-3,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-1,
-65535,
-1,
-575,
-7786,
-15496,
-23684,
-32106,
-40981,
-49562,
-58224,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65487,
-61736,
-58751,
-55929,
-53494,
-51335,
-49480,
-48483,
-48740,
-50490,
-53575,
-57352,
-61236,
-64350,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65533,
-62267,
-58010,
-53236,
-48318,
-42858,
-37280,
-31026,
-24977,
-19297,
-14523,
-10819,
-7629,
-4696,
-1790,
-65535,
-0,
-65535,
-2,
-125,
-1818,
-3455,
-5117,
-7181,
-9974,
-13229,
-16892,
-20122,
-22939,
-24692,
-25763,
-26039,
-25579,
-24901,
-23575,
-22629,
-21410,
-20753,
-19984,
-19301,
-18400,
-16925,
-15203,
-13202,
-11216,
-9741,
-8472,
-7813,
-7228,
-6971,
-6778,
-6997,
-7545,
-8659,
-10028,
-11697,
-13223,
-14679,
-15470,
-15945,
-15445,
-14597,
-13016,
-11481,
-10084,
-8789,
-7653,
-6202,
-4272,
-1924,
-65535,
-65535,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-2,
-65535,
-1,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-2,
-65535,
-4,
-65535,
-1,
-65535,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-0,
-13172,
-25427,
-35301,
-43596,
-49560,
-54397,
-57061,
-58251,
-57380,
-55424,
-52281,
-48403,
-43434,
-37416,
-30443,
-23471,
-17372,
-12989,
-10424,
-9769,
-10871,
-14312,
-20328,
-29176,
-40082,
-52308,
-64879,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-60918,
-57140,
-54873,
-54472,
-55214,
-57538,
-61049,
-65513,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65531,
-65534,
-65533,
-65534,
-65534,
-65534,
-65115,
-56325,
-45678,
-33746,
-21727,
-10059,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-4245,
-10720,
-16445,
-20858,
-24211,
-26191,
-27328,
-27565,
-26560,
-24794,
-21251,
-16660,
-10902,
-4562,
-1,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-0,
-65535,
-2,
-4851,
-13176,
-22967,
-34169,
-46471,
-59255,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65531,
-65534,
-65532,
-65534,
-65532,
-65534,
-65530,
-65534,
-65531,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65531,
-65534,
-65531,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65534,
-65534,
-59441,
-51223,
-43121,
-35222,
-27830,
-21120,
-15789,
-11796,
-9637,
-8735,
-9264,
-10613,
-13276,
-16687,
-21780,
-27645,
-34879,
-42090,
-49193,
-55185,
-59547,
-61946,
-61974,
-59757,
-55529,
-49642,
-42750,
-35406,
-27990,
-20881,
-14047,
-7677,
-1767,
-65535,
-0,
-0,
-65535,
-1,
-65535,
-0,
-0,
-65535,
-1,
-65535,
-5329,
-11749,
-18081,
-23978,
-29567,
-34884,
-39761,
-44126,
-47843,
-50358,
-52252,
-52392,
-51143,
-47849,
-42615,
-36334,
-29464,
-23289,
-17766,
-13437,
-9634,
-6676,
-3852,
-1605,
-0,
-65535,
-65535,
-0,
-971,
-3642,
-7440,
-11510,
-16157,
-20908,
-25826,
-30809,
-35357,
-39132,
-41558,
-42304,
-41611,
-39608,
-36965,
-34115,
-31367,
-29097,
-26825,
-24555,
-21543,
-17610,
-12618,
-6809,
-761,
-65535,
-2,
-65535,
-3,
-65535,
-1,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-1,
-65535,
-65535,
-1,
-65535,
-3,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-65535,
-1,
-65535,
-3,
-65535,
-5,
-65535,
-4,
-65535,
-0,
-14494,
-28196,
-39927,
-48794,
-55374,
-59516,
-61817,
-63057,
-63108,
-62372,
-60149,
-56299,
-50433,
-43039,
-34669,
-26376,
-18931,
-12933,
-9107,
-7601,
-9104,
-13335,
-20510,
-30208,
-41745,
-54764,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65532,
-65534,
-65530,
-65534,
-65530,
-65534,
-65531,
-65534,
-65532,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-59547,
-54867,
-52180,
-51039,
-51094,
-51783,
-52833,
-53844,
-54974,
-55901,
-56956,
-57907,
-58990,
-60125,
-61527,
-62975,
-64485,
-65533,
-65534,
-65170,
-62421,
-57725,
-51276,
-43306,
-34957,
-26220,
-18056,
-9980,
-2264,
-0,
-65535,
-0,
-65535,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-2,
-65535,
-4,
-65535,
-3,
-65535,
-0,
-0,
-4165,
-12992,
-21170,
-28967,
-35275,
-40820,
-44574,
-47158,
-48163,
-48215,
-47081,
-45335,
-42753,
-39656,
-36017,
-31948,
-27644,
-23234,
-19115,
-15627,
-13464,
-12672,
-14437,
-17930,
-24261,
-31924,
-41296,
-51252,
-61500,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65532,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65530,
-65534,
-65529,
-65534,
-65531,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-62397,
-53286,
-43779,
-34113,
-24689,
-15756,
-7184,
-65535,
-2,
-65535,
-65535,
-3,
-65535,
-3,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-1921,
-12885,
-23443,
-32928,
-41004,
-47135,
-51593,
-54081,
-54974,
-54263,
-51966,
-48321,
-43012,
-36361,
-28591,
-19726,
-10502,
-1133,
-65535,
-2,
-65535,
-4,
-65535,
-5,
-65535,
-0,
-0,
-65535,
-1,
-1367,
-9766,
-18165,
-26956,
-35806,
-44806,
-53157,
-60413,
-65534,
-65532,
-65534,
-65533,
-65534,
-62979,
-57325,
-51385,
-46103,
-41375,
-37575,
-33584,
-29970,
-26163,
-22813,
-20381,
-19141,
-19300,
-20909,
-23420,
-27115,
-31182,
-36229,
-41611,
-47768,
-54131,
-60362,
-65534,
-65534,
-65533,
-65534,
-65531,
-65534,
-65534,
-62318,
-57405,
-51782,
-45598,
-38555,
-31336,
-23872,
-16576,
-9795,
-3638,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-3,
-65535,
-4,
-65535,
-1,
-65535,
-0,
-65535,
-2,
-65535,
-2,
-65535,
-65535,
-1,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-3,
-65535,
-1,
-65535,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-5171,
-22916,
-39238,
-53708,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-59334,
-53261,
-48688,
-46264,
-46472,
-48742,
-53316,
-59091,
-65534,
-65532,
-65534,
-65532,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65532,
-65534,
-65534,
-65534,
-60655,
-48029,
-37258,
-28382,
-21465,
-16263,
-13067,
-11218,
-11404,
-12564,
-15075,
-17926,
-21042,
-24106,
-27352,
-30973,
-35459,
-40216,
-45336,
-49246,
-51859,
-52257,
-50828,
-47954,
-43724,
-39133,
-33374,
-27484,
-20623,
-13328,
-5490,
-65535,
-0,
-65535,
-2,
-65535,
-3,
-65535,
-0,
-65535,
-65535,
-65535,
-0,
-65535,
-3,
-65535,
-3,
-65535,
-0,
-260,
-13065,
-26353,
-39023,
-51307,
-62211,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-59626,
-50643,
-41774,
-34588,
-29334,
-26826,
-26799,
-29070,
-33243,
-38998,
-46342,
-55001,
-64932,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65531,
-65534,
-65532,
-65534,
-65534,
-65533,
-65534,
-65533,
-59652,
-50327,
-42406,
-35911,
-31153,
-28097,
-27033,
-27119,
-28565,
-30711,
-33768,
-37574,
-42195,
-47079,
-51941,
-55873,
-59227,
-61341,
-62211,
-61816,
-59333,
-55241,
-49429,
-42355,
-34587,
-26377,
-17663,
-9025,
-24,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-0,
-65535,
-1,
-65535,
-0,
-5964,
-16023,
-24556,
-31657,
-37548,
-42088,
-46157,
-48689,
-50409,
-50248,
-48533,
-45364,
-40820,
-35463,
-29199,
-22313,
-15203,
-8052,
-1922,
-0,
-65535,
-65535,
-0,
-65535,
-445,
-7415,
-16157,
-25083,
-34510,
-43620,
-52942,
-62583,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-61789,
-54817,
-48402,
-42958,
-38923,
-36541,
-35277,
-35144,
-35275,
-36174,
-37653,
-40028,
-43385,
-47474,
-51677,
-55556,
-58329,
-59757,
-59490,
-57830,
-54631,
-50567,
-45389,
-39528,
-32952,
-25585,
-17766,
-9530,
-918,
-0,
-0,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-2,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-2,
-65535,
-1,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-2,
-65535,
-2,
-65535,
-0,
-65535,
-2,
-65535,
-5,
-65535,
-4,
-65535,
-3,
-65535,
-1,
-65535,
-1,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-8527,
-26374,
-44204,
-60520,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65531,
-65534,
-65531,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-64906,
-64535,
-65485,
-65534,
-65532,
-65534,
-65534,
-65533,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-62953,
-52068,
-42699,
-34534,
-27674,
-22332,
-18538,
-16363,
-14973,
-14067,
-12779,
-11402,
-10164,
-9631,
-10615,
-12879,
-16740,
-21648,
-27195,
-32689,
-37520,
-40980,
-43118,
-44440,
-45178,
-46236,
-47053,
-48005,
-48346,
-48323,
-47553,
-46080,
-43617,
-39954,
-35007,
-29101,
-22676,
-16133,
-9711,
-3456,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-0,
-3639,
-11932,
-21253,
-31050,
-41167,
-51328,
-60922,
-65531,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65531,
-65534,
-65532,
-62953,
-52994,
-43463,
-35382,
-28277,
-22521,
-17715,
-13939,
-11455,
-10481,
-11454,
-14415,
-19274,
-25977,
-34303,
-43723,
-54476,
-65116,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-54978,
-44490,
-34274,
-24924,
-16156,
-8711,
-2000,
-2,
-65535,
-0,
-65535,
-65535,
-65535,
-0,
-65535,
-0,
-3084,
-8129,
-13225,
-18139,
-22492,
-26405,
-29491,
-32029,
-34035,
-35591,
-36360,
-36358,
-35224,
-33057,
-30021,
-26269,
-21759,
-16786,
-11275,
-5723,
-393,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-3,
-65535,
-4275,
-12009,
-21149,
-30443,
-39793,
-48478,
-56323,
-63162,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65014,
-59832,
-54450,
-48769,
-43384,
-37942,
-33138,
-29174,
-26669,
-25583,
-25823,
-27353,
-29387,
-32635,
-36201,
-40926,
-45814,
-51039,
-56273,
-61258,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65531,
-65534,
-65299,
-59306,
-52628,
-45414,
-38024,
-30892,
-24078,
-18297,
-13039,
-8712,
-4879,
-1634,
-65535,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-1396,
-3295,
-5146,
-6200,
-6678,
-6199,
-4935,
-2741,
-0,
-65535,
-2,
-65535,
-4,
-65535,
-1,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-2,
-65535,
-2,
-65535,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-65535,
-2,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-1,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-65535,
-4592,
-14887,
-27145,
-40264,
-53157,
-65192,
-65534,
-65532,
-65534,
-65533,
-65534,
-65532,
-65534,
-65532,
-65534,
-65534,
-65532,
-65534,
-65530,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-63559,
-60891,
-58621,
-56479,
-55613,
-55686,
-57724,
-61049,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65531,
-65534,
-63026,
-52842,
-43616,
-35675,
-29992,
-25850,
-23525,
-21515,
-19963,
-18266,
-16740,
-15865,
-16025,
-18006,
-21913,
-27592,
-34218,
-40322,
-44913,
-47556,
-48612,
-49165,
-49696,
-50617,
-51281,
-51356,
-50329,
-48269,
-45150,
-40772,
-35511,
-29098,
-22546,
-15735,
-9555,
-3085,
-65535,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-1,
-65535,
-2613,
-10238,
-17427,
-24025,
-30259,
-36596,
-42933,
-48746,
-53679,
-56300,
-57217,
-55665,
-52677,
-48085,
-42827,
-36808,
-31077,
-25532,
-20619,
-16131,
-12009,
-8157,
-5091,
-2796,
-1868,
-2084,
-3214,
-5597,
-9157,
-14361,
-21519,
-30072,
-39818,
-49775,
-59464,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-64641,
-56958,
-49508,
-42327,
-36069,
-30258,
-25742,
-21889,
-19587,
-18352,
-18768,
-20121,
-22835,
-25771,
-29465,
-32980,
-36885,
-40427,
-44068,
-46949,
-49272,
-50883,
-51752,
-52233,
-52014,
-51495,
-50588,
-49301,
-47791,
-45920,
-43329,
-40347,
-36304,
-32188,
-27828,
-23868,
-20540,
-17609,
-15418,
-13515,
-12118,
-10899,
-9637,
-8152,
-6415,
-4694,
-3351,
-2661,
-2742,
-3481,
-4670,
-6280,
-7997,
-9792,
-11298,
-12644,
-13517,
-14175,
-14652,
-15128,
-15705,
-16213,
-16840,
-17426,
-18402,
-19746,
-21151,
-22888,
-24264,
-25534,
-26611,
-27489,
-28645,
-29969,
-31288,
-32662,
-33639,
-34403,
-34670,
-34747,
-34509,
-34407,
-34455,
-34748,
-35251,
-35987,
-36492,
-36992,
-37098,
-36832,
-36652,
-36198,
-36466,
-37282,
-38945,
-41379,
-44066,
-46768,
-48976,
-50676,
-52148,
-53128,
-54289,
-55003,
-55740,
-56220,
-56874,
-57329,
-58274,
-58913,
-59596,
-60020,
-59756,
-59386,
-58038,
-56404,
-53812,
-50805,
-47027,
-43435,
-39898,
-37071,
-34537,
-32398,
-30204,
-27672,
-24844,
-21993,
-18983,
-16368,
-13831,
-11433,
-9287,
-7314,
-5618,
-4405,
-3377,
-2767,
-2266,
-1952,
-1286,
-420,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-2,
-65535,
-5,
-65535,
-2,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-0,
-65535,
-0,
-65535,
-0,
-0,
-65535,
-0,
-65535,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-0,
-0,
-65535,
-1,
-65535,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-12012,
-24790,
-37470,
-49163,
-59866,
-65530,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-61261,
-56825,
-52810,
-49695,
-47343,
-46157,
-46313,
-49010,
-54235,
-62106,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-59309,
-48292,
-36916,
-25686,
-15448,
-6621,
-0,
-65535,
-65535,
-0,
-0,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-0,
-1448,
-5988,
-9267,
-11955,
-13782,
-15839,
-18006,
-20567,
-23206,
-25559,
-26983,
-27513,
-26719,
-25347,
-23709,
-22126,
-20988,
-19880,
-18720,
-16973,
-14734,
-11903,
-9133,
-6624,
-4747,
-3509,
-2662,
-2055,
-1422,
-866,
-867,
-1316,
-3084,
-5463,
-8630,
-12196,
-15576,
-19140,
-22707,
-26428,
-30973,
-35750,
-41324,
-46683,
-52019,
-56613,
-60257,
-62873,
-64376,
-65065,
-64771,
-64061,
-62555,
-60812,
-58357,
-55581,
-51941,
-47792,
-43119,
-38473,
-34401,
-31529,
-29517,
-29045,
-28938,
-29915,
-31605,
-34326,
-38417,
-43384,
-48876,
-54553,
-59809,
-64931,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-59440,
-53101,
-46287,
-39873,
-32870,
-25691,
-18244,
-10899,
-4303,
-65535,
-1,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-893,
-3850,
-6889,
-9765,
-12460,
-14521,
-15915,
-16479,
-16204,
-15291,
-13353,
-10878,
-7308,
-3350,
-0,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-1,
-65535,
-0,
-3244,
-7942,
-12462,
-17264,
-21466,
-25715,
-29388,
-32635,
-35434,
-37574,
-39236,
-40427,
-41348,
-42408,
-43407,
-44811,
-46207,
-47636,
-49245,
-50909,
-53417,
-56324,
-60415,
-64774,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65533,
-65534,
-64907,
-64664,
-64619,
-65139,
-65534,
-65530,
-65534,
-65530,
-65534,
-65531,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-61976,
-57641,
-52494,
-47002,
-40898,
-34620,
-28274,
-21915,
-15496,
-9133,
-2926,
-0,
-65535,
-0,
-0,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-0,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-0,
-65535,
-3,
-65535,
-2,
-65535,
-65535,
-1,
-65535,
-3,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-48,
-1843,
-3561,
-5224,
-6572,
-7704,
-8422,
-8680,
-8554,
-8682,
-8473,
-8736,
-8604,
-8445,
-8262,
-8181,
-8763,
-10188,
-12672,
-15785,
-19645,
-23655,
-28067,
-32662,
-37493,
-42987,
-48718,
-55002,
-61341,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65059,
-58677,
-51751,
-45050,
-38098,
-31529,
-25264,
-19963,
-15230,
-11722,
-8973,
-7574,
-7998,
-10425,
-15128,
-21358,
-28622,
-35987,
-43043,
-49849,
-56142,
-62392,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-61075,
-55057,
-48662,
-42143,
-35567,
-29807,
-24903,
-21009,
-18090,
-16022,
-14890,
-14942,
-15787,
-17503,
-19327,
-21516,
-23790,
-26877,
-30417,
-34563,
-38629,
-41958,
-44703,
-46763,
-48189,
-49510,
-50327,
-51281,
-52121,
-53262,
-54024,
-54818,
-54633,
-54472,
-53816,
-53735,
-53812,
-53817,
-53256,
-51809,
-49668,
-47580,
-45446,
-44120,
-42486,
-40848,
-38655,
-35884,
-33138,
-29912,
-26989,
-23518,
-20705,
-17709,
-15660,
-13803,
-12488,
-11323,
-10585,
-10295,
-10742,
-11722,
-13170,
-14576,
-15915,
-17085,
-17791,
-18561,
-18850,
-19168,
-19509,
-19803,
-20591,
-21123,
-21728,
-21412,
-20514,
-18402,
-16156,
-13279,
-11165,
-8869,
-7124,
-5200,
-3532,
-2029,
-1396,
-1578,
-2770,
-4325,
-5937,
-7283,
-8448,
-9500,
-10823,
-12513,
-14518,
-16687,
-18796,
-20778,
-22654,
-24422,
-26113,
-27643,
-28860,
-29649,
-30182,
-30442,
-30627,
-30947,
-31048,
-31503,
-31681,
-32216,
-32816,
-33775,
-35193,
-36836,
-39078,
-41192,
-43540,
-45656,
-47632,
-49459,
-51357,
-53127,
-54845,
-56111,
-56850,
-57038,
-56583,
-56141,
-55318,
-54765,
-53761,
-52731,
-51094,
-49457,
-47635,
-46154,
-44943,
-44359,
-43964,
-44203,
-44832,
-45975,
-47949,
-50329,
-53260,
-56585,
-59916,
-63293,
-65534,
-65532,
-65534,
-65530,
-65534,
-65530,
-65534,
-65529,
-65534,
-65531,
-65534,
-65533,
-65534,
-65533,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65533,
-65534,
-65274,
-65197,
-65533,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65533,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-63716,
-60733,
-57300,
-53788,
-50434,
-47238,
-44703,
-42486,
-41006,
-39792,
-39210,
-38946,
-39291,
-39949,
-41245,
-42643,
-44016,
-45259,
-46076,
-46473,
-46974,
-47001,
-47292,
-47317,
-46975,
-46365,
-45076,
-43434,
-41350,
-39000,
-36356,
-33326,
-30016,
-26353,
-22572,
-18587,
-14599,
-10453,
-6251,
-1954,
-65535,
-3,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-2,
-309,
-526,
-231,
-0,
-65535,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-5039,
-9873,
-13804,
-16952,
-19218,
-20832,
-22097,
-23131,
-23679,
-23899,
-23203,
-21969,
-20038,
-18032,
-16156,
-14573,
-13357,
-12460,
-11906,
-11798,
-12408,
-13621,
-16130,
-19169,
-23417,
-28015,
-33348,
-38919,
-44705,
-50274,
-55928,
-60917,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-61950,
-56293,
-50885,
-45073,
-39631,
-34064,
-29121,
-25268,
-22573,
-21493,
-21409,
-22207,
-23734,
-25505,
-28227,
-31101,
-34961,
-38839,
-43358,
-47793,
-52309,
-56269,
-59571,
-62001,
-63716,
-64722,
-65035,
-64854,
-63558,
-61682,
-58835,
-55631,
-52261,
-49082,
-46055,
-43379,
-40508,
-37914,
-35013,
-32476,
-29968,
-27962,
-26270,
-25110,
-24288,
-24108,
-24447,
-25242,
-26614,
-28303,
-30102,
-32210,
-34381,
-36963,
-39477,
-42458,
-45099,
-47873,
-50090,
-51939,
-53128,
-53920,
-54130,
-54132,
-53812,
-53314,
-52334,
-50911,
-48741,
-45948,
-42824,
-39294,
-36118,
-32821,
-29890,
-26981,
-24082,
-21330,
-18562,
-16208,
-14019,
-12617,
-11431,
-11059,
-10850,
-11402,
-12276,
-14096,
-16369,
-19404,
-22654,
-26217,
-29440,
-32741,
-35302,
-37838,
-39579,
-41114,
-42113,
-43121,
-43884,
-44861,
-45286,
-45468,
-44863,
-44016,
-42775,
-41747,
-40899,
-40269,
-40371,
-40452,
-41640,
-42697,
-44596,
-46291,
-48000,
-49593,
-51117,
-52654,
-54183,
-55611,
-56610,
-57436,
-57876,
-58202,
-58565,
-58990,
-59255,
-59332,
-58806,
-58091,
-57089,
-56324,
-55819,
-55849,
-56110,
-56693,
-57327,
-58144,
-59096,
-60231,
-61366,
-62556,
-63637,
-64588,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65248,
-63504,
-61659,
-59437,
-57090,
-54923,
-52836,
-51332,
-50117,
-49140,
-48559,
-47978,
-47977,
-48375,
-49245,
-50804,
-52520,
-54579,
-56773,
-59041,
-61659,
-64112,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65382,
-63135,
-60468,
-57751,
-54524,
-51942,
-48899,
-46635,
-44145,
-42382,
-40530,
-39396,
-38498,
-38232,
-38578,
-39158,
-40082,
-41138,
-42116,
-43328,
-44285,
-45386,
-46184,
-46948,
-47343,
-47609,
-47741,
-47527,
-47056,
-46418,
-45101,
-43831,
-42011,
-40054,
-37786,
-35302,
-32634,
-29996,
-27405,
-24951,
-22891,
-21094,
-19696,
-18561,
-17526,
-16664,
-15729,
-14630,
-13459,
-12013,
-10531,
-8764,
-7045,
-4961,
-3215,
-1238,
-65535,
-65535,
-2,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-1184,
-3270,
-5171,
-6492,
-7282,
-7393,
-6777,
-5757,
-4323,
-2848,
-1238,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-1765,
-3955,
-6230,
-8125,
-10088,
-11715,
-13284,
-14620,
-15605,
-16340,
-16606,
-16316,
-15761,
-14676,
-13307,
-11744,
-10085,
-8393,
-6912,
-5464,
-4484,
-3532,
-3248,
-2921,
-3432,
-3955,
-5329,
-6731,
-8735,
-10586,
-12749,
-14731,
-16896,
-19035,
-21413,
-23630,
-26032,
-28120,
-30206,
-32000,
-33429,
-34719,
-35383,
-35804,
-35725,
-35354,
-34642,
-33956,
-32925,
-32055,
-31077,
-30179,
-29412,
-28861,
-28513,
-28307,
-28091,
-28014,
-27724,
-27880,
-27990,
-28486,
-29390,
-30361,
-31529,
-32579,
-33563,
-34586,
-35516,
-36594,
-37654,
-38761,
-40030,
-41191,
-42432,
-43462,
-44598,
-45389,
-46369,
-47026,
-47556,
-47924,
-48058,
-48083,
-47846,
-47610,
-46971,
-46529,
-45704,
-45128,
-44571,
-44200,
-44099,
-44118,
-44074,
-44410,
-44942,
-45866,
-47343,
-49087,
-51068,
-53233,
-55477,
-57751,
-60175,
-62452,
-64877,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65008,
-62188,
-58962,
-55504,
-51807,
-48164,
-44940,
-42063,
-39897,
-37864,
-36465,
-35090,
-34510,
-34009,
-34483,
-35197,
-36728,
-38392,
-40715,
-42989,
-45783,
-48350,
-51173,
-53574,
-56088,
-58090,
-60232,
-61974,
-63558,
-64773,
-65513,
-65534,
-65534,
-65303,
-64719,
-63612,
-62238,
-60494,
-58463,
-56269,
-54185,
-52202,
-50778,
-49667,
-49430,
-49670,
-50589,
-52023,
-53466,
-55244,
-56873,
-58941,
-61047,
-63640,
-65533,
-65534,
-65534,
-65534,
-65532,
-65534,
-65531,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-64538,
-61126,
-57592,
-54052,
-50591,
-47346,
-44253,
-41376,
-38737,
-36540,
-34778,
-33688,
-32903,
-32843,
-32874,
-33479,
-34221,
-35380,
-36916,
-38573,
-40243,
-42009,
-43356,
-44546,
-45283,
-45734,
-45866,
-45917,
-45576,
-45309,
-44493,
-43542,
-42115,
-40426,
-38655,
-36835,
-35116,
-33614,
-32000,
-30682,
-29386,
-28622,
-28382,
-28807,
-29757,
-31023,
-32479,
-33900,
-35488,
-37046,
-38628,
-40189,
-41481,
-42749,
-43754,
-44754,
-45497,
-45997,
-45970,
-45525,
-44382,
-43203,
-41345,
-39874,
-37889,
-36306,
-34457,
-32926,
-31551,
-30340,
-29781,
-29361,
-29440,
-29836,
-30021,
-30812,
-31184,
-32263,
-33087,
-34613,
-35938,
-37599,
-38788,
-39950,
-40267,
-40505,
-39949,
-39371,
-38257,
-37180,
-35802,
-34511,
-33111,
-31656,
-30182,
-28723,
-27437,
-26240,
-25140,
-24154,
-22999,
-22124,
-20831,
-19827,
-18534,
-17213,
-16077,
-14600,
-13646,
-12382,
-11377,
-10029,
-8659,
-7150,
-5568,
-4458,
-3348,
-2744,
-1947,
-1054,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-2,
-65535,
-3,
-65535,
-2,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-0,
-65535,
-2,
-65535,
-0,
-999,
-2292,
-3271,
-3954,
-4330,
-4613,
-4593,
-4958,
-4960,
-5357,
-5435,
-5937,
-6518,
-7838,
-9686,
-12092,
-14861,
-17901,
-21121,
-24685,
-28385,
-32582,
-36833,
-41298,
-45547,
-49405,
-53021,
-55928,
-58433,
-60524,
-62025,
-63295,
-64007,
-64457,
-64482,
-64007,
-63243,
-61972,
-60550,
-59093,
-57197,
-55449,
-53235,
-51040,
-48981,
-47266,
-46023,
-45020,
-44097,
-43145,
-42141,
-41244,
-40505,
-39817,
-39133,
-38444,
-37863,
-37680,
-37915,
-38499,
-39079,
-39738,
-39739,
-39765,
-39501,
-38947,
-38497,
-37389,
-36305,
-34882,
-33319,
-31792,
-29939,
-28149,
-25899,
-23631,
-20963,
-18374,
-15525,
-12960,
-10453,
-8418,
-6705,
-5513,
-4803,
-4484,
-4933,
-5646,
-7180,
-8786,
-10694,
-12563,
-14493,
-16554,
-18611,
-20885,
-22837,
-24713,
-26060,
-27353,
-28279,
-29332,
-30076,
-30943,
-31528,
-32238,
-32714,
-33375,
-34141,
-35010,
-36282,
-37597,
-39477,
-41321,
-43729,
-46152,
-49039,
-51618,
-54609,
-57061,
-59728,
-61924,
-64163,
-65534,
-65532,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65532,
-65534,
-65532,
-63984,
-61971,
-60312,
-58673,
-57140,
-55823,
-54763,
-53789,
-53258,
-52864,
-52836,
-52971,
-53336,
-53632,
-54127,
-54504,
-54948,
-55292,
-55585,
-55872,
-55769,
-55981,
-55713,
-55849,
-55661,
-55532,
-55265,
-54820,
-54392,
-53736,
-53260,
-52624,
-52153,
-51540,
-51043,
-50328,
-49931,
-49142,
-48768,
-47768,
-47027,
-45785,
-44811,
-43513,
-42513,
-41534,
-40636,
-39898,
-39237,
-38734,
-38526,
-38654,
-39107,
-39869,
-41008,
-42061,
-43384,
-44544,
-45549,
-46737,
-47555,
-48480,
-49166,
-49720,
-50093,
-50298,
-50491,
-50298,
-49987,
-49061,
-47950,
-46422,
-45071,
-43700,
-42699,
-42085,
-41512,
-41478,
-41643,
-42245,
-43332,
-44438,
-45945,
-47213,
-48557,
-49855,
-51092,
-52389,
-53392,
-54209,
-54555,
-54737,
-54606,
-54792,
-54658,
-54659,
-54159,
-53469,
-52785,
-52123,
-52071,
-52045,
-52178,
-52042,
-51599,
-50906,
-50172,
-49377,
-48901,
-48270,
-47846,
-47422,
-46950,
-46655,
-45973,
-45283,
-44151,
-42905,
-41749,
-40421,
-39373,
-38099,
-36782,
-35302,
-33612,
-31711,
-29915,
-27723,
-25373,
-22785,
-19748,
-16923,
-14202,
-12065,
-10451,
-9292,
-8603,
-7892,
-7627,
-7258,
-7176,
-6811,
-6252,
-5225,
-3692,
-2108,
-365,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-2,
-65535,
-2,
-65535,
-1,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-1,
-759,
-2400,
-4404,
-6255,
-8234,
-9767,
-11297,
-12539,
-14044,
-15708,
-17504,
-19246,
-20805,
-22388,
-24001,
-26322,
-28544,
-31629,
-34249,
-37280,
-39873,
-42509,
-45049,
-47290,
-49563,
-51516,
-53603,
-55425,
-57220,
-58673,
-59545,
-60125,
-60259,
-60360,
-60709,
-61075,
-61499,
-61657,
-61340,
-61024,
-60785,
-61102,
-61737,
-62634,
-62951,
-62687,
-61788,
-60708,
-59702,
-59043,
-58382,
-57775,
-56561,
-55161,
-53258,
-51650,
-50037,
-48770,
-47715,
-46841,
-46182,
-45656,
-45308,
-45103,
-44964,
-44917,
-44596,
-44255,
-43754,
-43275,
-42594,
-41979,
-40905,
-39550,
-37814,
-35855,
-33930,
-32345,
-30891,
-29652,
-28092,
-26377,
-24106,
-21992,
-19775,
-18138,
-16761,
-15739,
-14805,
-13784,
-13039,
-12274,
-12013,
-11929,
-12171,
-12644,
-13437,
-14599,
-16129,
-18271,
-20486,
-23051,
-25292,
-27487,
-29148,
-30814,
-32107,
-33346,
-34513,
-35300,
-36096,
-36542,
-36994,
-37439,
-38052,
-38573,
-39213,
-39395,
-39263,
-38762,
-37943,
-37387,
-36943,
-36829,
-36733,
-36328,
-35781,
-35089,
-34457,
-34168,
-34060,
-34194,
-34430,
-35039,
-35908,
-37101,
-38072,
-38711,
-38760,
-38920,
-38948,
-39342,
-39527,
-39317,
-38682,
-38180,
-37866,
-38469,
-38895,
-38893,
-38182,
-36779,
-35674,
-35063,
-35038,
-35146,
-34930,
-34512,
-33849,
-33771,
-33585,
-33878,
-33609,
-33643,
-33186,
-33113,
-32317,
-31341,
-29441,
-27325,
-25482,
-23838,
-22788,
-21330,
-19856,
-18135,
-16609,
-15466,
-14259,
-12985,
-11299,
-9608,
-8366,
-7918,
-8181,
-8789,
-9160,
-9447,
-9453,
-9814,
-10220,
-10791,
-11355,
-12086,
-13019,
-14329,
-15977,
-17341,
-18456,
-18903,
-18877,
-18770,
-18562,
-18742,
-18800,
-19032,
-19118,
-19243,
-19804,
-20565,
-21887,
-23393,
-24633,
-25982,
-26743,
-27701,
-28511,
-29549,
-30388,
-31474,
-32451,
-33611,
-34960,
-36067,
-37415,
-38181,
-38894,
-39738,
-40558,
-42141,
-43700,
-45549,
-47080,
-48505,
-49274,
-49982,
-49988,
-50167,
-49749,
-49615,
-49218,
-48877,
-48584,
-48454,
-48347,
-48454,
-48135,
-47821,
-47027,
-46154,
-45313,
-44754,
-44230,
-43646,
-42802,
-41615,
-40660,
-39770,
-39469,
-39295,
-38996,
-38394,
-37783,
-37152,
-36834,
-36728,
-36121,
-35355,
-33929,
-32424,
-31104,
-29571,
-28225,
-26378,
-24261,
-21943,
-19614,
-17241,
-15100,
-12803,
-10847,
-9004,
-7781,
-6813,
-6277,
-6018,
-5698,
-5595,
-5380,
-5095,
-4667,
-4408,
-4191,
-4673,
-5299,
-6469,
-7362,
-8364,
-8820,
-9233,
-9348,
-9156,
-8737,
-7918,
-6966,
-6176,
-5328,
-4962,
-4087,
-3482,
-2451,
-1659,
-1263,
-1183,
-1792,
-2503,
-3668,
-4746,
-6150,
-7468,
-9079,
-10534,
-12273,
-13860,
-15602,
-17213,
-18771,
-20278,
-21648,
-23420,
-24843,
-26800,
-28437,
-30548,
-32556,
-34934,
-37016,
-39107,
-40371,
-41905,
-43119,
-45205,
-47476,
-49774,
-51754,
-53154,
-54552,
-56194,
-58458,
-60921,
-63291,
-65092,
-65534,
-65534,
-65534,
-65532,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65534,
-65533,
-65534,
-65531,
-65534,
-65532,
-65534,
-65533,
-65534,
-65531,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65531,
-65534,
-65532,
-65534,
-65530,
-65534,
-65530,
-65534,
-65534,
-64482,
-62582,
-60812,
-59544,
-58092,
-56747,
-54736,
-52442,
-49588,
-46949,
-44492,
-42828,
-41799,
-41375,
-41616,
-42033,
-42832,
-43484,
-43890,
-44171,
-44019,
-43963,
-43885,
-43964,
-44097,
-43698,
-43067,
-41667,
-40265,
-38870,
-37756,
-36756,
-35143,
-33058,
-30469,
-28068,
-26506,
-25587,
-25108,
-24132,
-22732,
-21042,
-19774,
-19170,
-18980,
-18455,
-17583,
-16393,
-16053,
-16366,
-17665,
-18926,
-19778,
-20300,
-20594,
-21281,
-22229,
-23076,
-24000,
-24607,
-25823,
-26772,
-27722,
-27672,
-26983,
-26087,
-25769,
-26428,
-27539,
-28648,
-28779,
-28833,
-28752,
-29547,
-30837,
-32136,
-33610,
-34458,
-35858,
-37386,
-39398,
-41295,
-42697,
-43621,
-44518,
-45444,
-46893,
-48166,
-49268,
-49778,
-50034,
-50040,
-50486,
-50962,
-51807,
-52440,
-53076,
-53416,
-53288,
-53073,
-51992,
-50911,
-49243,
-47821,
-46499,
-45362,
-44152,
-42509,
-40479,
-38155,
-36119,
-34776,
-34113,
-33796,
-33377,
-32817,
-32136,
-32052,
-32345,
-33058,
-33374,
-33376,
-32844,
-32664,
-32950,
-33799,
-34798,
-34989,
-34559,
-33008,
-31762,
-30259,
-29572,
-28805,
-27804,
-26348,
-24372,
-22281,
-20516,
-19033,
-17822,
-16368,
-14756,
-12963,
-11454,
-10323,
-9817,
-9716,
-10052,
-10723,
-11794,
-13308,
-14730,
-16049,
-17006,
-17843,
-18853,
-19825,
-20728,
-21145,
-20913,
-20722,
-20306,
-20169,
-19695,
-18694,
-17078,
-15631,
-14597,
-14627,
-14624,
-14362,
-13355,
-11882,
-11031,
-10957,
-11851,
-13040,
-14046,
-15019,
-15974,
-17502,
-18957,
-20355,
-21148,
-21702,
-22468,
-23605,
-24922,
-26061,
-26324,
-26427,
-26064,
-26186,
-25933,
-25369,
-24134,
-22732,
-21517,
-20936,
-20886,
-20695,
-20334,
-19639,
-19194,
-19354,
-19983,
-20543,
-20723,
-20489,
-19749,
-19376,
-18562,
-18241,
-17426,
-16737,
-16210,
-15733,
-15578,
-15124,
-14707,
-14015,
-13493,
-13116,
-12728,
-12111,
-11039,
-9525,
-8130,
-6730,
-5856,
-5226,
-4931,
-5147,
-5540,
-6386,
-6941,
-7335,
-7100,
-6492,
-5963,
-5515,
-5540,
-5304,
-4774,
-3377,
-1631,
-0,
-0,
-65535,
-3,
-65535,
-869,
-1950,
-3215,
-4566,
-6120,
-7971,
-9714,
-11271,
-12881,
-14337,
-16206,
-17957,
-19823,
-21653,
-23628,
-26008,
-28488,
-30920,
-32553,
-33669,
-34137,
-34828,
-35621,
-36486,
-37156,
-37411,
-37681,
-37996,
-38681,
-39080,
-39263,
-38999,
-38947,
-40002,
-41826,
-44650,
-47028,
-48875,
-50011,
-51120,
-52443,
-54155,
-55532,
-56401,
-56613,
-56693,
-57036,
-57773,
-58914,
-60122,
-61026,
-62025,
-62398,
-62526,
-61793,
-60464,
-59073,
-57668,
-56929,
-56220,
-55448,
-54740,
-54052,
-53997,
-54213,
-54365,
-53791,
-52596,
-51573,
-51301,
-52708,
-54764,
-57220,
-58753,
-59570,
-59703,
-59703,
-59361,
-58882,
-57698,
-56717,
-55848,
-55663,
-55529,
-55295,
-54419,
-53341,
-52148,
-51227,
-50222,
-48930,
-47158,
-45285,
-43753,
-42642,
-41880,
-40873,
-39475,
-38287,
-37334,
-37391,
-37571,
-37760,
-37281,
-36968,
-36991,
-37997,
-39605,
-40928,
-41772,
-41931,
-41958,
-42165,
-42647,
-42561,
-41959,
-40505,
-38892,
-37708,
-36963,
-36519,
-35776,
-34565,
-32712,
-31053,
-29939,
-29627,
-30310,
-31262,
-32450,
-33455,
-34164,
-34857,
-35510,
-36123,
-36940,
-37386,
-37920,
-38468,
-39186,
-40504,
-41772,
-43252,
-43910,
-43885,
-43331,
-42510,
-42118,
-41848,
-41670,
-41373,
-40665,
-40213,
-40004,
-39949,
-39792,
-38708,
-36783,
-34508,
-32928,
-32289,
-32875,
-34007,
-34986,
-35857,
-36701,
-37654,
-38734,
-39740,
-39763,
-39424,
-38575,
-38157,
-38547,
-39847,
-41770,
-43913,
-45891,
-47132,
-48112,
-48134,
-48297,
-48081,
-47955,
-47711,
-46845,
-45704,
-44203,
-43118,
-42566,
-42749,
-42801,
-42460,
-41400,
-39900,
-38813,
-38234,
-38550,
-39422,
-40372,
-41694,
-42748,
-44229,
-45495,
-46208,
-46711,
-46393,
-46104,
-45943,
-45735,
-45810,
-45630,
-45758,
-45735,
-45838,
-45469,
-44546,
-43143,
-41643,
-40449,
-39768,
-39076,
-37997,
-36332,
-34033,
-32269,
-30967,
-30791,
-30967,
-31212,
-30706,
-30048,
-28832,
-28172,
-27486,
-27273,
-26907,
-26532,
-25931,
-25633,
-25297,
-25291,
-25112,
-24684,
-23948,
-22917,
-21808,
-20699,
-19562,
-18271,
-16790,
-15365,
-13911,
-13306,
-13118,
-13677,
-14437,
-15183,
-15864,
-16317,
-16604,
-16818,
-17001,
-16923,
-17003,
-16498,
-16105,
-15311,
-14547,
-13858,
-13386,
-13381,
-13624,
-14176,
-14703,
-14758,
-14705,
-13884,
-13123,
-11954,
-11195,
-10398,
-10084,
-9845,
-9766,
-9793,
-9818,
-10005,
-10424,
-11275,
-12482,
-14153,
-15706,
-17135,
-18164,
-18981,
-19881,
-21095,
-22442,
-23735,
-24635,
-24790,
-24715,
-24579,
-24582,
-24553,
-24319,
-23468,
-22552,
-21725,
-21414,
-21464,
-21701,
-21573,
-21304,
-20700,
-20461,
-20487,
-20779,
-21491,
-21992,
-22864,
-23632,
-24842,
-26038,
-27770,
-29446,
-30938,
-32219,
-32578,
-32532,
-32292,
-32077,
-32799,
-33527,
-34542,
-34717,
-34751,
-34243,
-34592,
-34877,
-35912,
-36436,
-36677,
-36621,
-36809,
-37176,
-37944,
-38391,
-38314,
-38021,
-37654,
-37493,
-37837,
-38076,
-38312,
-38578,
-38813,
-39370,
-39527,
-39395,
-38525,
-37335,
-36333,
-35565,
-35093,
-34586,
-33827,
-33108,
-32504,
-32160,
-31709,
-30815,
-29465,
-28041,
-27326,
-27540,
-28513,
-29628,
-30414,
-30656,
-30813,
-30786,
-31078,
-31103,
-31183,
-30865,
-30973,
-31101,
-31607,
-32055,
-32025,
-31582,
-30678,
-29863,
-29124,
-28831,
-28860,
-28938,
-29279,
-29365,
-29408,
-29366,
-29224,
-29257,
-29598,
-30179,
-31157,
-32106,
-32874,
-33108,
-32875,
-32529,
-32133,
-32530,
-33347,
-34537,
-35804,
-36597,
-37229,
-37706,
-38682,
-40135,
-42142,
-43964,
-45707,
-46525,
-47266,
-47897,
-48878,
-50194,
-51255,
-51883,
-52049,
-51802,
-51943,
-51858,
-51807,
-50752,
-49112,
-47054,
-45338,
-44543,
-44204,
-44279,
-43674,
-42565,
-41216,
-39795,
-38863,
-38131,
-37545,
-37045,
-36651,
-36304,
-36412,
-36253,
-36570,
-36675,
-37257,
-37942,
-38577,
-39238,
-39448,
-39606,
-39713,
-39711,
-39740,
-39368,
-38499,
-37387,
-35725,
-34353,
-32686,
-31290,
-29571,
-27987,
-26166,
-24951,
-23998,
-23790,
-23736,
-23998,
-23792,
-23652,
-23238,
-23152,
-23500,
-24184,
-25188,
-25902,
-26270,
-26139,
-26112,
-26299,
-27299,
-28649,
-30073,
-31209,
-31526,
-31606,
-31234,
-31000,
-30574,
-30100,
-29440,
-28859,
-28699,
-28518,
-28539,
-27646,
-26456,
-24631,
-23370,
-22861,
-23262,
-24422,
-25452,
-26324,
-26641,
-27115,
-27698,
-28963,
-30392,
-32000,
-33507,
-34590,
-35671,
-36438,
-37204,
-37626,
-37758,
-37627,
-37387,
-37257,
-37204,
-36940,
-36278,
-35251,
-34032,
-33298,
-32687,
-32793,
-32557,
-32581,
-32503,
-32478,
-32660,
-32320,
-31551,
-30232,
-29044,
-28647,
-29204,
-30362,
-31448,
-32027,
-32081,
-32344,
-32768,
-33532,
-34114,
-34142,
-33900,
-33905,
-34085,
-35199,
-36013,
-37206,
-37677,
-38288,
-38549,
-38683,
-38444,
-37680,
-36808,
-36066,
-35965,
-36462,
-37178,
-37918,
-38415,
-38502,
-38573,
-38369,
-38125,
-37575,
-36753,
-35779,
-34932,
-34458,
-34245,
-34511,
-34508,
-34670,
-34589,
-34722,
-35222,
-35831,
-36332,
-36622,
-36598,
-36620,
-37074,
-37731,
-38418,
-38419,
-37651,
-36281,
-35063,
-33852,
-33056,
-31896,
-30444,
-28909,
-27595,
-27166,
-27540,
-28277,
-28622,
-28408,
-27436,
-26452,
-25878,
-25661,
-26325,
-26720,
-27220,
-27197,
-27009,
-26826,
-26667,
-26851,
-27091,
-27563,
-27937,
-28592,
-29415,
-30575,
-32186,
-33560,
-35143,
-36042,
-36782,
-37122,
-37340,
-37384,
-37391,
-37177,
-36965,
-36571,
-36489,
-36493,
-37016,
-37655,
-38284,
-38499,
-38287,
-38020,
-37998,
-38574,
-39267,
-39789,
-39424,
-38520,
-37393,
-36963,
-37258,
-38260,
-38839,
-39081,
-38865,
-38499,
-38418,
-38445,
-38207,
-37705,
-36967,
-36463,
-36201,
-35935,
-35066,
-33611,
-31818,
-30177,
-29336,
-28672,
-28201,
-27061,
-25770,
-24395,
-23737,
-23576,
-23869,
-24237,
-24606,
-24952,
-25583,
-25876,
-26164,
-25903,
-25556,
-25665,
-25927,
-26798,
-27435,
-27827,
-27725,
-27775,
-27855,
-28649,
-29491,
-30366,
-30969,
-31317,
-31446,
-31816,
-31922,
-32425,
-32290,
-32453,
-32130,
-32506,
-32659,
-33402,
-33533,
-33453,
-32874,
-32265,
-31921,
-31897,
-32238,
-32344,
-32532,
-32395,
-32346,
-32475,
-32531,
-32555,
-32346,
-32211,
-32478,
-32818,
-33510,
-33555,
-33379,
-32896,
-32636,
-32821,
-33399,
-33535,
-33241,
-31764,
-30337,
-28992,
-28700,
-29096,
-29837,
-30071,
-29443,
-28196,
-26695,
-25795,
-25347,
-24950,
-24503,
-23627,
-22815,
-22729,
-23184,
-24025,
-24607,
-24872,
-24658,
-25323,
-25899,
-27196,
-27671,
-27696,
-27116,
-27037,
-27512,
-29123,
-30707,
-32160,
-32767,
-33349,
-33822,
-34855,
-35828,
-36863,
-37176,
-37362,
-37046,
-37361,
-37600,
-38340,
-38840,
-39079,
-38973,
-38761,
-38420,
-38522,
-38235,
-38153,
-37443,
-37017,
-36703,
-36648,
-37205,
-37598,
-38315,
-38918,
-39739,
-40797,
-42164,
-43652,
-44885,
-46052,
-46788,
-47530,
-48162,
-48613,
-48900,
-48852,
-48503,
-48351,
-48318,
-48773,
-49005,
-48905,
-48159,
-46926,
-45862,
-45339,
-45257,
-45258,
-44862,
-43885,
-43197,
-42910,
-43274,
-43810,
-43483,
-42649,
-41371,
-40879,
-40976,
-41695,
-41772,
-41085,
-39580,
-38261,
-37307,
-36969,
-36251,
-35382,
-34061,
-33375,
-32792,
-32612,
-31363,
-29470,
-27114,
-25162,
-24397,
-24024,
-23764,
-22810,
-21413,
-20039,
-19271,
-18668,
-17844,
-16502,
-14889,
-13858,
-13756,
-14306,
-15075,
-14889,
-14255,
-12988,
-11932,
-10901,
-9898,
-8631,
-7601,
-6569,
-6362,
-6225,
-6441,
-6437,
-6704,
-7335,
-8528,
-9605,
-10665,
-10955,
-11375,
-11855,
-12801,
-13912,
-14548,
-14781,
-14918,
-15467,
-17163,
-19404,
-21728,
-23579,
-24315,
-25189,
-25981,
-27511,
-29546,
-31869,
-34009,
-36041,
-37521,
-38709,
-39500,
-40137,
-40978,
-42064,
-43593,
-45047,
-46421,
-47713,
-48823,
-50513,
-51966,
-53470,
-54238,
-54948,
-55425,
-56773,
-58513,
-59969,
-60810,
-60205,
-59309,
-58590,
-58783,
-59646,
-60577,
-61023,
-61022,
-60576,
-60308,
-59916,
-58962,
-57724,
-55845,
-54503,
-53548,
-53340,
-52941,
-52336,
-51015,
-49430,
-47635,
-45786,
-43831,
-42064,
-40662,
-40082,
-40004,
-40266,
-39712,
-39106,
-37731,
-36834,
-35778,
-34430,
-32266,
-29150,
-25979,
-23288,
-21886,
-21202,
-20592,
-19511,
-17689,
-15917,
-14602,
-13539,
-12885,
-11744,
-10613,
-9713,
-9502,
-10215,
-11640,
-12884,
-14069,
-14521,
-14914,
-15181,
-15495,
-16238,
-16947,
-18006,
-18983,
-19800,
-20488,
-20963,
-21596,
-22231,
-23181,
-23894,
-24158,
-24344,
-24078,
-24555,
-25161,
-26667,
-27962,
-29649,
-30922,
-32367,
-33641,
-35143,
-36252,
-37312,
-38071,
-38845,
-40000,
-41193,
-42985,
-44230,
-45335,
-45895,
-46073,
-46423,
-46681,
-46898,
-46946,
-46315,
-45549,
-44649,
-44389,
-44700,
-45684,
-46734,
-47346,
-47501,
-47239,
-46975,
-47211,
-47530,
-48321,
-48637,
-49036,
-49085,
-49326,
-49801,
-50220,
-50516,
-49692,
-48323,
-46102,
-44308,
-43013,
-42511,
-42355,
-41638,
-39926,
-37069,
-33904,
-30945,
-29281,
-28199,
-27697,
-26508,
-24898,
-22865,
-21093,
-19988,
-19272,
-18718,
-17716,
-16499,
-15470,
-14969,
-15312,
-15548,
-16079,
-15417,
-14730,
-13174,
-11850,
-10640,
-9950,
-10030,
-10427,
-11138,
-11114,
-10532,
-9211,
-8314,
-7996,
-8869,
-9952,
-10661,
-10510,
-9549,
-8742,
-8679,
-9637,
-11032,
-12065,
-12009,
-11035,
-9818,
-8896,
-9130,
-10007,
-11320,
-12702,
-13855,
-15288,
-17026,
-19142,
-21333,
-22916,
-23868,
-24317,
-25028,
-26670,
-29173,
-32372,
-35434,
-37969,
-39476,
-40635,
-41324,
-42327,
-43513,
-44918,
-46390,
-47532,
-48213,
-48561,
-48505,
-48586,
-48981,
-49641,
-50594,
-51356,
-51677,
-51568,
-50988,
-50514,
-49958,
-49721,
-49668,
-49615,
-49825,
-49988,
-50484,
-51175,
-52229,
-53232,
-53869,
-54156,
-53577,
-52996,
-52253,
-52181,
-52622,
-53289,
-53495,
-52864,
-51411,
-49826,
-48718,
-48504,
-48959,
-49400,
-49090,
-48055,
-46473,
-45101,
-44305,
-43967,
-43907,
-43572,
-42561,
-41299,
-39499,
-38156,
-36859,
-36175,
-35539,
-34933,
-34192,
-33139,
-31946,
-30763,
-29622,
-28728,
-27909,
-27326,
-26536,
-25848,
-25029,
-24186,
-23682,
-23208,
-23209,
-23099,
-23343,
-23099,
-23395,
-23259,
-23551,
-23577,
-23710,
-23762,
-23894,
-24185,
-24475,
-24527,
-24239,
-23550,
-22917,
-22521,
-22495,
-22572,
-22630,
-22307,
-22019,
-21678,
-21805,
-22049,
-22704,
-23048,
-23660,
-24312,
-25431,
-27111,
-28652,
-30228,
-31053,
-31605,
-32053,
-32848,
-34323,
-36202,
-38127,
-39766,
-40742,
-41375,
-41747,
-42220,
-42724,
-43383,
-43989,
-44785,
-45519,
-46185,
-46338,
-46079,
-45599,
-45366,
-46074,
-47055,
-48163,
-48425,
-47716,
-46842,
-46075,
-46211,
-46496,
-46740,
-46233,
-45708,
-45256,
-45577,
-45890,
-46104,
-45072,
-43912,
-42643,
-42459,
-42986,
-43648,
-43541,
-42432,
-40347,
-38443,
-37048,
-36620,
-36439,
-35909,
-34669,
-32926,
-31181,
-29944,
-29279,
-28782,
-27986,
-26455,
-24767,
-23180,
-22443,
-22019,
-21992,
-21122,
-20011,
-18456,
-17370,
-17241,
-17766,
-19010,
-20011,
-20727,
-20777,
-20355,
-20305,
-20247,
-21441,
-22703,
-24134,
-25134,
-25163,
-25240,
-25214,
-26166,
-27643,
-29045,
-30205,
-30074,
-29993,
-29784,
-30337,
-31130,
-31765,
-31894,
-31711,
-31976,
-33135,
-35383,
-38101,
-40372,
-41588,
-41930,
-41878,
-42538,
-44281,
-46948,
-49720,
-51808,
-52731,
-52546,
-51782,
-51065,
-50675,
-50932,
-51255,
-51937,
-51994,
-51910,
-51045,
-49796,
-48271,
-46868,
-45706,
-44811,
-43857,
-42511,
-41246,
-40027,
-39556,
-39340,
-39135,
-38309,
-36784,
-35327,
-34219,
-33879,
-33900,
-33455,
-32450,
-30865,
-29546,
-28965,
-28621,
-28224,
-26880,
-24737,
-22365,
-20194,
-18616,
-17659,
-16503,
-15838,
-14783,
-14230,
-13463,
-12407,
-10902,
-8867,
-6784,
-5327,
-4303,
-4139,
-3905,
-3903,
-3427,
-3326,
-3292,
-3512,
-3820,
-3432,
-2871,
-1925,
-1789,
-2215,
-3427,
-3906,
-3981,
-2769,
-1975,
-1818,
-2900,
-4537,
-5278,
-5197,
-4115,
-3692,
-3903,
-5173,
-6278,
-6944,
-7173,
-7500,
-8549,
-9977,
-11380,
-12218,
-12410,
-13012,
-13438,
-14573,
-15284,
-15815,
-16656,
-17876,
-19667,
-21598,
-22573,
-23235,
-23391,
-24503,
-26297,
-28621,
-30100,
-30627,
-29944,
-29542,
-29603,
-30649,
-31636,
-32184,
-32028,
-31686,
-31813,
-32824,
-34110,
-35253,
-35353,
-34431,
-33454,
-32846,
-33428,
-34774,
-36093,
-37100,
-37334,
-37733,
-39026,
-41109,
-43731,
-45940,
-46977,
-47238,
-47053,
-47583,
-48585,
-50247,
-51388,
-52252,
-52313,
-52278,
-52180,
-52070,
-51965,
-51491,
-50934,
-50330,
-49483,
-48796,
-47977,
-47530,
-47212,
-47081,
-46867,
-46237,
-45519,
-44707,
-44279,
-44307,
-44678,
-45072,
-45180,
-45547,
-45788,
-46814,
-47742,
-48822,
-49245,
-49564,
-49296,
-49142,
-48953,
-48587,
-48478,
-48111,
-48030,
-47687,
-47135,
-46100,
-45076,
-44226,
-44281,
-44678,
-45019,
-44574,
-43380,
-42275,
-41666,
-42301,
-43092,
-43675,
-43248,
-42356,
-41453,
-41193,
-41268,
-41326,
-41110,
-40717,
-40821,
-41508,
-42669,
-43359,
-43512,
-43122,
-42800,
-43067,
-43250,
-43543,
-42747,
-41933,
-40792,
-40561,
-40554,
-40771,
-40345,
-39686,
-38763,
-38337,
-38578,
-38947,
-39368,
-39054,
-38443,
-37547,
-37100,
-36832,
-36887,
-36465,
-35776,
-34670,
-34061,
-34007,
-34591,
-35327,
-35620,
-35672,
-35777,
-36465,
-37388,
-38128,
-37997,
-37175,
-36598,
-36859,
-38182,
-39422,
-39474,
-38154,
-36148,
-35038,
-35434,
-36914,
-38100,
-38051,
-36436,
-34880,
-33982,
-34932,
-36360,
-37625,
-37679,
-36623,
-35750,
-35780,
-37043,
-38868,
-39738,
-39582,
-38153,
-37442,
-37678,
-39606,
-41379,
-42428,
-41697,
-40765,
-40190,
-41164,
-42379,
-43145,
-42381,
-40952,
-39767,
-39605,
-39818,
-39555,
-38550,
-37229,
-37101,
-37728,
-38791,
-38285,
-36833,
-35041,
-34640,
-36015,
-37548,
-38021,
-36414,
-34666,
-34115,
-35750,
-37706,
-38024,
-35722,
-32505,
-30600,
-31475,
-33822,
-35514,
-34932,
-32900,
-31288,
-31579,
-33321,
-34405,
-33585,
-30972,
-28278,
-27089,
-27223,
-27906,
-27645,
-27011,
-26454,
-26908,
-28115,
-28704,
-28592,
-27383,
-26717,
-26932,
-27961,
-28647,
-28596,
-27379,
-26773,
-26878,
-28489,
-30154,
-30916,
-30130,
-28168,
-26591,
-26059,
-27010,
-28463,
-29227,
-28596,
-27222,
-26086,
-26323,
-27671,
-28857,
-28889,
-27244,
-25218,
-24234,
-25085,
-27405,
-29255,
-29943,
-28830,
-27223,
-26165,
-26007,
-26455,
-26642,
-26004,
-25034,
-23758,
-22683,
-21804,
-21073,
-20536,
-20360,
-20273,
-19934,
-19036,
-17713,
-16449,
-16077,
-16474,
-17344,
-17611,
-17369,
-16582,
-16525,
-17055,
-18533,
-19907,
-20672,
-20911,
-20963,
-21383,
-22340,
-23336,
-23923,
-24131,
-23788,
-23526,
-22916,
-22310,
-21781,
-21861,
-22205,
-22969,
-22494,
-21229,
-19190,
-18010,
-18820,
-20834,
-23046,
-23316,
-22150,
-20435,
-20515,
-22123,
-24291,
-24845,
-23393,
-21411,
-20832,
-22467,
-25030,
-26219,
-25134,
-23156,
-21754,
-22812,
-24159,
-24579,
-22180,
-18795,
-16660,
-17608,
-21044,
-24341,
-25163,
-23154,
-19986,
-18032,
-18374,
-20172,
-21938,
-21943,
-20775,
-19249,
-18953,
-20121,
-21832,
-22892,
-22231,
-21146,
-20146,
-21068,
-22969,
-24926,
-25555,
-24874,
-24156,
-24847,
-27193,
-29547,
-30627,
-29810,
-28621,
-29018,
-31393,
-34458,
-36225,
-35780,
-34718,
-35122,
-38307,
-42597,
-45860,
-45922,
-43908,
-42012,
-42088,
-44441,
-47183,
-48851,
-49351,
-49086,
-49618,
-49875,
-50306,
-49242,
-48667,
-48716,
-50513,
-52494,
-53286,
-52070,
-49484,
-47476,
-46948,
-47846,
-48716,
-48402,
-46948,
-45547,
-44996,
-45625,
-46185,
-46049,
-44939,
-43308,
-42032,
-41010,
-40343,
-39609,
-39235,
-39108,
-39549,
-39612,
-39022,
-37707,
-36227,
-35696,
-35912,
-36411,
-36014,
-34379,
-32292,
-30759,
-30656,
-31577,
-32426,
-32474,
-31582,
-30678,
-30260,
-30813,
-31367,
-31895,
-31818,
-31710,
-31738,
-31735,
-31661,
-31101,
-30498,
-30179,
-30204,
-30551,
-30601,
-30337,
-29995,
-29994,
-30813,
-31976,
-33320,
-33825,
-34085,
-34011,
-34271,
-34880,
-35435,
-35882,
-35884,
-36095,
-36383,
-37470,
-38655,
-39924,
-40689,
-40901,
-40715,
-40215,
-39845,
-39684,
-40006,
-40606,
-41327,
-41558,
-41748,
-41428,
-41746,
-42220,
-43200,
-43803,
-43782,
-43327,
-42673,
-42774,
-43594,
-44784,
-45836,
-46001,
-45703,
-45024,
-44779,
-44681,
-44884,
-45076,
-45310,
-45627,
-45893,
-45679,
-45126,
-44125,
-43274,
-43175,
-43274,
-43781,
-43410,
-42642,
-41826,
-41719,
-42511,
-43491,
-43749,
-42805,
-41137,
-39844,
-39425,
-40182,
-40907,
-41054,
-40112,
-38653,
-37417,
-36886,
-36967,
-37122,
-36916,
-35907,
-34723,
-33295,
-32291,
-31844,
-31657,
-31659,
-31472,
-30576,
-29308,
-27774,
-26539,
-26161,
-26143,
-26320,
-26326,
-25689,
-25030,
-24237,
-24186,
-24421,
-24819,
-25004,
-24790,
-24319,
-23839,
-23791,
-23945,
-24610,
-24947,
-25244,
-25186,
-25216,
-25268,
-25529,
-25508,
-25133,
-24160,
-22837,
-21597,
-20936,
-20832,
-21332,
-21543,
-21705,
-21541,
-21283,
-21329,
-21731,
-21966,
-22310,
-21941,
-21780,
-22072,
-22918,
-24132,
-24923,
-24742,
-24022,
-23450,
-23996,
-25613,
-27379,
-28568,
-28385,
-27800,
-27489,
-28379,
-30078,
-31812,
-32533,
-32422,
-31949,
-31579,
-31920,
-32057,
-32185,
-31921,
-31581,
-31973,
-32399,
-33348,
-33584,
-33508,
-32873,
-32159,
-31870,
-31762,
-31792,
-31762,
-31527,
-31447,
-31789,
-32187,
-33110,
-33295,
-33217,
-32370,
-31632,
-30973,
-30757,
-30684,
-30017,
-29418,
-28564,
-28441,
-28987,
-29864,
-30443,
-30284,
-29388,
-28622,
-27985,
-27937,
-27959,
-27830,
-27908,
-28092,
-28807,
-29334,
-29677,
-29256,
-28884,
-28463,
-28753,
-28939,
-29121,
-28651,
-28458,
-28493,
-29491,
-30496,
-31157,
-30891,
-30207,
-29517,
-29363,
-29411,
-29336,
-28805,
-28383,
-28464,
-29464,
-30632,
-31495,
-31557,
-31046,
-30632,
-30704,
-31134,
-31390,
-31186,
-30757,
-30762,
-31578,
-33112,
-34666,
-35780,
-36251,
-36360,
-36701,
-37178,
-37757,
-37840,
-37358,
-36733,
-36143,
-36547,
-37386,
-38790,
-39869,
-40215,
-39870,
-38974,
-38179,
-37919,
-38125,
-38606,
-39050,
-38948,
-38760,
-38023,
-37416,
-36726,
-36124,
-35669,
-35250,
-35198,
-35274,
-35621,
-35696,
-35754,
-35538,
-35620,
-36121,
-37308,
-38631,
-39554,
-39818,
-39448,
-39262,
-39689,
-40316,
-40984,
-40422,
-39344,
-37943,
-37573,
-37812,
-38152,
-37312,
-35194,
-32717,
-31101,
-30946,
-31553,
-31604,
-30340,
-28116,
-26116,
-25053,
-24847,
-25029,
-24713,
-24608,
-24685,
-25744,
-26719,
-27300,
-26907,
-26506,
-26854,
-28832,
-31181,
-33351,
-33952,
-33484,
-33080,
-33458,
-34718,
-35991,
-36173,
-35248,
-33614,
-32424,
-32185,
-32742,
-33637,
-34036,
-34007,
-33272,
-32709,
-32297,
-32394,
-32900,
-33482,
-34085,
-34458,
-34696,
-34877,
-35544,
-36328,
-37709,
-38918,
-40029,
-41008,
-42087,
-43359,
-44965,
-46527,
-47475,
-48059,
-47606,
-47346,
-46920,
-47002,
-47185,
-47317,
-47161,
-46472,
-45363,
-44150,
-42747,
-41880,
-41058,
-40690,
-40160,
-39477,
-38442,
-37258,
-36491,
-36198,
-36415,
-36724,
-36838,
-36539,
-36232,
-36089,
-36125,
-36303,
-35727,
-34878,
-33719,
-32846,
-32924,
-33643,
-34504,
-35018,
-34214,
-32718,
-30785,
-29176,
-28437,
-28383,
-28673,
-28940,
-28671,
-28096,
-27326,
-26904,
-26748,
-27113,
-27463,
-27799,
-27753,
-27562,
-27144,
-26692,
-26510,
-26296,
-26537,
-26453,
-26616,
-26217,
-26034,
-25558,
-25135,
-24897,
-24477,
-24394,
-24186,
-24553,
-24767,
-25531,
-25452,
-25347,
-24315,
-23738,
-23074,
-23182,
-23339,
-23551,
-23498,
-23366,
-23366,
-23392,
-23683,
-23736,
-24159,
-24896,
-26431,
-28302,
-29917,
-30496,
-30469,
-29968,
-30444,
-31340,
-32901,
-33557,
-33852,
-33400,
-33612,
-34141,
-34984,
-34961,
-33928,
-32318,
-31341,
-31579,
-32688,
-33930,
-33980,
-32875,
-31470,
-30289,
-30439,
-31160,
-32024,
-32295,
-32000,
-31446,
-31396,
-31813,
-32903,
-33662,
-34248,
-33927,
-33324,
-32580,
-32003,
-31815,
-31632,
-31421,
-30812,
-30127,
-29387,
-28805,
-28543,
-28277,
-27909,
-27406,
-26719,
-26219,
-25848,
-25769,
-25902,
-25846,
-25850,
-25479,
-25372,
-25507,
-25871,
-26724,
-27481,
-28415,
-29198,
-29601,
-29808,
-29494,
-29358,
-29548,
-30362,
-31317,
-32210,
-31952,
-31521,
-30580,
-30546,
-30920,
-31368,
-31313,
-30471,
-29809,
-29810,
-31288,
-32925,
-34221,
-34244,
-33430,
-32896,
-33245,
-34668,
-36198,
-37630,
-38150,
-39056,
-39631,
-40794,
-41591,
-42137,
-42621,
-43434,
-44915,
-46315,
-47343,
-47133,
-46209,
-45232,
-44570,
-44573,
-44702,
-44282,
-43408,
-42433,
-41773,
-42035,
-42539,
-43196,
-43201,
-42747,
-42091,
-41691,
-42037,
-42697,
-43382,
-43384,
-42986,
-42116,
-41772,
-41931,
-42748,
-43542,
-44228,
-44255,
-44332,
-44178,
-44013,
-43915,
-43141,
-42410,
-40950,
-39504,
-37571,
-35435,
-33349,
-31762,
-30867,
-31076,
-31262,
-31236,
-30285,
-28541,
-26800,
-25504,
-25083,
-25242,
-25450,
-25190,
-24501,
-23629,
-23342,
-23706,
-24425,
-25108,
-24977,
-24448,
-24001,
-24051,
-24821,
-25529,
-25560,
-24605,
-23341,
-22336,
-22362,
-22706,
-23077,
-22782,
-22075,
-21674,
-21624,
-21914,
-22151,
-22045,
-22126,
-22651,
-23791,
-24791,
-25109,
-24634,
-24130,
-24504,
-25952,
-27883,
-29070,
-29148,
-28781,
-28911,
-30654,
-33112,
-35802,
-37048,
-37650,
-37364,
-37809,
-38499,
-39554,
-40082,
-40293,
-40346,
-40690,
-41481,
-42116,
-42591,
-42537,
-42275,
-42114,
-41906,
-41824,
-41561,
-41244,
-41111,
-41035,
-40845,
-40454,
-39631,
-38711,
-38232,
-38077,
-38469,
-38842,
-39025,
-38894,
-38552,
-38390,
-37997,
-37810,
-37336,
-36993,
-36675,
-36650,
-36357,
-35938,
-34930,
-33800,
-32870,
-32452,
-32476,
-32767,
-32399,
-31734,
-30209,
-29068,
-28093,
-27936,
-27879,
-27648,
-26691,
-25796,
-24844,
-24925,
-25188,
-25506,
-25002,
-23815,
-22601,
-22097,
-22602,
-23496,
-23817,
-23206,
-21756,
-20620,
-20407,
-21255,
-22361,
-23130,
-22969,
-22521,
-21967,
-21938,
-22208,
-22754,
-23396,
-23759,
-24109,
-23732,
-23317,
-22755,
-22946,
-23973,
-25397,
-26566,
-26662,
-26091,
-25606,
-26089,
-27616,
-29546,
-30602,
-30601,
-29784,
-29756,
-30971,
-33323,
-35221,
-35964,
-34510,
-32740,
-31342,
-31869,
-34113,
-36782,
-38498,
-38654,
-37364,
-35724,
-35091,
-35435,
-37097,
-38471,
-39159,
-38549,
-37259,
-35879,
-35254,
-35668,
-36468,
-37306,
-37497,
-37147,
-36918,
-37094,
-37707,
-38762,
-39024,
-38816,
-37520,
-36412,
-35750,
-35805,
-36304,
-36677,
-36253,
-35275,
-33797,
-32636,
-32000,
-31738,
-31869,
-31684,
-31501,
-31261,
-31024,
-30918,
-30340,
-29569,
-28597,
-28065,
-28198,
-28809,
-29173,
-28912,
-27698,
-26797,
-26326,
-27273,
-28305,
-29122,
-29071,
-28462,
-28226,
-28541,
-29334,
-29783,
-29493,
-28806,
-28093,
-27987,
-27855,
-27723,
-26984,
-26694,
-26957,
-28146,
-29492,
-30153,
-29835,
-29177,
-28937,
-29599,
-30469,
-30972,
-30733,
-30682,
-31445,
-33270,
-35329,
-36067,
-35621,
-34244,
-33719,
-34746,
-36572,
-38365,
-38920,
-38868,
-38997,
-40005,
-41481,
-42776,
-42881,
-42644,
-42536,
-43042,
-43910,
-44334,
-43779,
-43039,
-42697,
-43305,
-44569,
-45048,
-44756,
-43594,
-42750,
-42722,
-43172,
-43462,
-42830,
-41742,
-40984,
-41056,
-42065,
-42748,
-42696,
-41297,
-39660,
-38761,
-39317,
-40953,
-42379,
-42276,
-40686,
-37999,
-36251,
-36017,
-37308,
-38603,
-38446,
-36674,
-34248,
-32713,
-32766,
-34169,
-34957,
-34775,
-32926,
-31287,
-30312,
-30575,
-30866,
-30496,
-29122,
-27250,
-26057,
-25508,
-25925,
-26193,
-26534,
-26510,
-26533,
-26696,
-26690,
-26511,
-25953,
-25532,
-25029,
-24978,
-24816,
-24770,
-25103,
-25538,
-26661,
-27570,
-28459,
-28570,
-28278,
-28013,
-27935,
-28886,
-30283,
-31687,
-32712,
-32689,
-31975,
-31208,
-31000,
-31339,
-32425,
-33241,
-33879,
-34216,
-34541,
-35139,
-35808,
-36514,
-36758,
-37359,
-37866,
-39103,
-40295,
-41481,
-41931,
-42088,
-41879,
-41877,
-42300,
-42829,
-43408,
-43835,
-43987,
-44073,
-43987,
-43808,
-43513,
-43226,
-43118,
-43147,
-43381,
-43306,
-43142,
-42410,
-41873,
-41090,
-41056,
-41035,
-41401,
-41535,
-41455,
-41165,
-40794,
-40586,
-40343,
-39849,
-39337,
-38449,
-38019,
-37735,
-38074,
-38020,
-37867,
-36805,
-35727,
-34482,
-34035,
-33877,
-33954,
-33694,
-32711,
-31450,
-29807,
-28966,
-28303,
-28464,
-28646,
-28254,
-27562,
-25824,
-24130,
-22654,
-21966,
-22205,
-22968,
-23237,
-23363,
-22576,
-21991,
-21571,
-21412,
-21122,
-20249,
-18983,
-17979,
-17714,
-18401,
-19196,
-19639,
-19092,
-18689,
-18376,
-19035,
-19590,
-19800,
-19485,
-18982,
-19484,
-20646,
-21914,
-22361,
-21493,
-20408,
-20038,
-20726,
-21727,
-21943,
-20961,
-19697,
-19429,
-20832,
-22918,
-24553,
-24582,
-23470,
-22602,
-22757,
-24107,
-25478,
-26165,
-26033,
-26087,
-26665,
-28175,
-29596,
-30101,
-30020,
-29123,
-28938,
-29362,
-30309,
-31263,
-31500,
-31154,
-30632,
-30360,
-30526,
-30916,
-30788,
-30205,
-29387,
-29282,
-30152,
-31844,
-33611,
-34010,
-33953,
-33059,
-33322,
-34378,
-35989,
-36886,
-36754,
-35806,
-35432,
-35728,
-37095,
-37734,
-37809,
-36518,
-35514,
-35249,
-36279,
-37839,
-38759,
-38685,
-37677,
-36491,
-36148,
-36860,
-38049,
-39157,
-39132,
-38338,
-37046,
-36279,
-36438,
-37389,
-38575,
-39187,
-38784,
-37895,
-36725,
-36280,
-36201,
-36596,
-36622,
-36413,
-35511,
-34724,
-34007,
-33928,
-34566,
-35245,
-35888,
-35747,
-35041,
-34403,
-34221,
-35248,
-36702,
-38314,
-38918,
-38843,
-38205,
-37918,
-38181,
-38893,
-39474,
-39529,
-38865,
-37999,
-37650,
-37706,
-38419,
-38497,
-38365,
-37231,
-36569,
-35857,
-36439,
-36700,
-37046,
-36226,
-34908,
-33583,
-32876,
-33081,
-33799,
-34325,
-34509,
-34379,
-34219,
-34484,
-34801,
-34984,
-34565,
-34006,
-33429,
-33611,
-34299,
-35303,
-35856,
-35752,
-34721,
-33585,
-32372,
-32080,
-32160,
-32872,
-33429,
-33504,
-33272,
-32422,
-31922,
-31738,
-32053,
-32557,
-32661,
-32319,
-31525,
-30655,
-30364,
-30443,
-31209,
-31923,
-32608,
-33111,
-33506,
-34298,
-35040,
-36041,
-36041,
-35409,
-33927,
-32849,
-33004,
-34404,
-36332,
-37230,
-36306,
-34695,
-33612,
-34774,
-37151,
-38973,
-38391,
-35620,
-32926,
-32660,
-35410,
-39050,
-40665,
-39024,
-35436,
-33003,
-33561,
-36014,
-38261,
-37916,
-35567,
-33374,
-33031,
-34880,
-36887,
-37731,
-36809,
-35697,
-35091,
-35594,
-35564,
-35146,
-33875,
-33586,
-33982,
-35039,
-35221,
-34434,
-33344,
-33220,
-34296,
-35093,
-34720,
-32293,
-29992,
-29021,
-30465,
-32640,
-33846,
-33218,
-31737,
-31367,
-32452,
-34058,
-34249,
-32447,
-30104,
-29383,
-31159,
-33875,
-35486,
-34513,
-32870,
-32108,
-34009,
-36779,
-38263,
-36963,
-33984,
-31629,
-31768,
-33343,
-34541,
-34031,
-32082,
-31078,
-31287,
-32662,
-32926,
-31815,
-29917,
-29438,
-30577,
-32343,
-32689,
-30998,
-28963,
-28650,
-31286,
-34907,
-37337,
-36725,
-34462,
-33026,
-33775,
-36646,
-38764,
-38997,
-37232,
-35406,
-35145,
-36623,
-37995,
-37943,
-35488,
-32343,
-30076,
-29913,
-31606,
-33031,
-33322,
-31499,
-29071,
-27326,
-27248,
-28570,
-29965,
-30394,
-29568,
-28387,
-27773,
-28096,
-28513,
-28438,
-27194,
-26245,
-26245,
-27881,
-30126,
-31422,
-31154,
-29600,
-28330,
-28067,
-28779,
-29308,
-28806,
-27696,
-26669,
-26507,
-26984,
-27170,
-26639,
-25506,
-24607,
-24476,
-24791,
-25030,
-24291,
-23153,
-22127,
-22230,
-23312,
-24662,
-25581,
-25562,
-25290,
-25059,
-25477,
-26297,
-26853,
-26851,
-26297,
-25638,
-25346,
-25795,
-26378,
-26666,
-26166,
-25029,
-24053,
-23867,
-24846,
-26270,
-27567,
-27773,
-27250,
-26270,
-25768,
-25508,
-25582,
-25716,
-25718,
-26085,
-26613,
-27383,
-27852,
-28015,
-27699,
-27429,
-27332,
-27612,
-27755,
-28036,
-28175,
-28567,
-29070,
-29652,
-29571,
-29097,
-27748,
-26643,
-26057,
-26511,
-27537,
-28674,
-28912,
-28542,
-27326,
-26589,
-26666,
-27804,
-29597,
-31025,
-31499,
-31050,
-29996,
-29650,
-30312,
-32239,
-34245,
-35858,
-35776,
-34856,
-33636,
-32954,
-33822,
-34801,
-36332,
-36650,
-36727,
-36306,
-36412,
-36833,
-37575,
-37994,
-38182,
-37994,
-37866,
-38047,
-38234,
-38683,
-38813,
-39027,
-38656,
-38628,
-38262,
-38390,
-38526,
-39288,
-40004,
-40820,
-41114,
-40503,
-39449,
-37890,
-37071,
-37310,
-38655,
-40162,
-40689,
-39739,
-37917,
-36516,
-36570,
-37865,
-39024,
-38895,
-36913,
-34852,
-33615,
-34613,
-36202,
-37149,
-36228,
-34113,
-32346,
-32237,
-33640,
-35275,
-36121,
-35541,
-34878,
-34222,
-34322,
-34276,
-34084,
-33906,
-34270,
-35436,
-36595,
-36966,
-35990,
-34482,
-33192,
-33345,
-33984,
-34985,
-35064,
-34908,
-34877,
-35674,
-36648,
-37363,
-36701,
-35382,
-34166,
-33877,
-34906,
-36359,
-37493,
-37522,
-37069,
-36283,
-36434,
-36969,
-38073,
-38710,
-38760,
-38790,
-38760,
-39555,
-40478,
-41111,
-41297,
-40770,
-40820,
-41403,
-42618,
-43407,
-42858,
-41611,
-40110,
-40319,
-41561,
-43437,
-43883,
-42936,
-41136,
-40110,
-40558,
-41928,
-42806,
-42613,
-41459,
-40844,
-41062,
-41666,
-41691,
-40377,
-38994,
-38026,
-38998,
-40213,
-41299,
-40899,
-40004,
-39712,
-40107,
-40929,
-40398,
-39052,
-37469,
-37466,
-39054,
-40926,
-41243,
-39265,
-36410,
-34512,
-35089,
-36994,
-38152,
-37233,
-34348,
-31742,
-30913,
-32192,
-34030,
-34777,
-33374,
-31156,
-28938,
-28543,
-29068,
-29785,
-29412,
-27355,
-24791,
-22495,
-21886,
-22892,
-24923,
-26563,
-27299,
-26852,
-25718,
-24472,
-23158,
-22414,
-22150,
-23052,
-24604,
-26009,
-26139,
-24446,
-22287,
-21276,
-22789,
-26057,
-28278,
-28095,
-25026,
-22393,
-22360,
-25690,
-29890,
-31471,
-29099,
-24315,
-20937,
-21438,
-25268,
-29359,
-30868,
-28909,
-25719,
-24130,
-25480,
-29544,
-33138,
-35090,
-34352,
-32345,
-31103,
-31236,
-32978,
-35011,
-36335,
-36777,
-36707,
-36934,
-37684,
-38362,
-38658,
-38260,
-37994,
-38500,
-39578,
-40347,
-39977,
-38787,
-37627,
-38259,
-39792,
-41032,
-40348,
-37888,
-35701,
-35827,
-38421,
-41348,
-41800,
-38972,
-34642,
-31922,
-32556,
-35144,
-37176,
-36651,
-34164,
-32190,
-32261,
-34144,
-35590,
-35357,
-33189,
-31578,
-31052,
-32369,
-33430,
-33135,
-31737,
-30022,
-29703,
-30074,
-30681,
-29967,
-28702,
-27220,
-27038,
-27458,
-28252,
-28067,
-27379,
-26430,
-25822,
-25636,
-25270,
-24471,
-23661,
-23124,
-23343,
-23761,
-23655,
-22735,
-21119,
-20067,
-19826,
-21042,
-22390,
-23577,
-23631,
-23021,
-22707,
-22864,
-24132,
-25162,
-25795,
-25533,
-25106,
-25165,
-26426,
-27805,
-28779,
-27908,
-26138,
-24397,
-24316,
-26377,
-28991,
-31155,
-31343,
-30257,
-29150,
-29018,
-30178,
-31527,
-32343,
-31976,
-31368,
-31182,
-32002,
-33162,
-34326,
-34510,
-34034,
-33270,
-32688,
-32422,
-32267,
-32080,
-31737,
-31818,
-32263,
-33482,
-34561,
-35226,
-34559,
-32929,
-30943,
-29203,
-28462,
-28279,
-28302,
-28439,
-28487,
-29072,
-29808,
-30550,
-30442,
-29467,
-28332,
-27721,
-28307,
-29648,
-30815,
-31182,
-30338,
-28991,
-27802,
-27037,
-26825,
-26641,
-26508,
-26324,
-26139,
-26060,
-25874,
-25743,
-25585,
-25846,
-26406,
-27272,
-27883,
-28093,
-27670,
-26772,
-25930,
-25000,
-24927,
-25081,
-25954,
-26880,
-27721,
-27936,
-27697,
-26982,
-26696,
-27087,
-28676,
-30944,
-33190,
-34589,
-34246,
-32740,
-30366,
-28804,
-28464,
-29491,
-31132,
-32528,
-32952,
-32689,
-32580,
-32929,
-34559,
-36414,
-38260,
-39129,
-39320,
-38784,
-38395,
-38522,
-38815,
-39766,
-40293,
-40716,
-40477,
-40083,
-39474,
-38974,
-38734,
-38499,
-38549,
-38419,
-38577,
-38840,
-39635,
-40264,
-40666,
-40397,
-39555,
-38365,
-37811,
-37362,
-38023,
-38312,
-38999,
-39238,
-39447,
-39370,
-38841,
-38021,
-37258,
-36859,
-37812,
-39105,
-40953,
-41508,
-41007,
-39553,
-37997,
-37626,
-38180,
-39396,
-40161,
-39659,
-38420,
-36647,
-35568,
-35486,
-36015,
-36757,
-36777,
-36310,
-35694,
-35333,
-35616,
-35885,
-35935,
-35567,
-35038,
-34959,
-35407,
-35832,
-36067,
-35435,
-34853,
-34351,
-34459,
-34772,
-34670,
-34192,
-33375,
-33244,
-33504,
-34406,
-34668,
-34140,
-32901,
-31628,
-31346,
-32155,
-33563,
-34640,
-34695,
-33587,
-32370,
-31527,
-31868,
-32663,
-33267,
-33006,
-31869,
-30971,
-30655,
-31183,
-31841,
-31793,
-31337,
-31266,
-32315,
-34513,
-36250,
-36414,
-34191,
-31184,
-29176,
-29148,
-30973,
-32792,
-33191,
-32343,
-30894,
-30468,
-30947,
-31972,
-32454,
-32050,
-31293,
-30993,
-31609,
-33108,
-34274,
-34880,
-34429,
-34011,
-33926,
-34882,
-35987,
-36784,
-36329,
-35464,
-34612,
-35463,
-37071,
-39210,
-39846,
-39314,
-37787,
-36884,
-36836,
-37546,
-37653,
-37124,
-36095,
-35936,
-36542,
-37708,
-38072,
-37418,
-36752,
-36994,
-38972,
-41825,
-43621,
-44043,
-42670,
-41640,
-41481,
-42539,
-43751,
-44151,
-43882,
-43095,
-43065,
-43435,
-44046,
-44198,
-44152,
-43961,
-44125,
-44173,
-43596,
-42432,
-41005,
-40321,
-40503,
-41509,
-42036,
-42116,
-41216,
-40612,
-40238,
-40191,
-40210,
-39559,
-39047,
-38555,
-38758,
-39002,
-39024,
-38684,
-38180,
-38497,
-38869,
-39367,
-38764,
-37625,
-36490,
-36254,
-36886,
-37046,
-36358,
-34300,
-33002,
-33378,
-35643,
-38341,
-39235,
-37654,
-34773,
-32531,
-32159,
-33374,
-33982,
-33454,
-31526,
-30338,
-30337,
-31896,
-33084,
-32872,
-31448,
-29096,
-27775,
-26828,
-26506,
-26299,
-26349,
-27169,
-28410,
-29071,
-28435,
-26747,
-24845,
-24659,
-25427,
-26508,
-25953,
-24135,
-22041,
-22182,
-24022,
-26777,
-27693,
-26353,
-23761,
-22256,
-22734,
-24342,
-24924,
-23684,
-21332,
-19906,
-20648,
-22360,
-23685,
-22969,
-21227,
-20198,
-20644,
-22313,
-22966,
-22208,
-20405,
-19539,
-20276,
-22151,
-23313,
-23102,
-21993,
-21702,
-22469,
-23788,
-23603,
-21968,
-19905,
-19458,
-21281,
-23602,
-24662,
-23047,
-20595,
-19139,
-20251,
-22547,
-24369,
-23844,
-22464,
-21389,
-22413,
-24212,
-25505,
-24898,
-23998,
-23686,
-25845,
-28571,
-30046,
-29148,
-26485,
-24657,
-25350,
-28169,
-31158,
-31948,
-29968,
-27248,
-25319,
-26273,
-28751,
-30974,
-31154,
-29018,
-26403,
-25398,
-27119,
-30625,
-33588,
-34166,
-31921,
-28992,
-27248,
-28302,
-30896,
-33450,
-34197,
-33291,
-32190,
-31707,
-32744,
-33716,
-34352,
-34167,
-34087,
-34325,
-35171,
-35698,
-35461,
-34879,
-34088,
-34431,
-34695,
-35407,
-35092,
-34852,
-34433,
-34772,
-35462,
-36146,
-36465,
-36728,
-36967,
-37756,
-38500,
-38759,
-38183,
-36569,
-35169,
-34486,
-35352,
-37207,
-38997,
-39317,
-38207,
-36147,
-34881,
-35221,
-36678,
-37808,
-37497,
-35538,
-33744,
-33350,
-34719,
-36520,
-36778,
-34802,
-31790,
-29518,
-29574,
-30942,
-32190,
-31601,
-29391,
-27113,
-25956,
-26665,
-28095,
-29465,
-30179,
-30446,
-30544,
-30184,
-29304,
-27990,
-27273,
-27698,
-29464,
-30895,
-31338,
-29971,
-28091,
-27116,
-27672,
-28856,
-29760,
-29304,
-28519,
-28565,
-29681,
-31469,
-32085,
-30994,
-28756,
-26823,
-26511,
-27510,
-28886,
-29334,
-28911,
-28200,
-28198,
-29043,
-30259,
-31235,
-32028,
-32556,
-33401,
-33928,
-34010,
-33373,
-32557,
-32185,
-33085,
-34456,
-36044,
-36619,
-36416,
-35562,
-34778,
-34137,
-33799,
-33373,
-33086,
-33030,
-33217,
-33821,
-34302,
-34850,
-35015,
-35194,
-35146,
-35037,
-34722,
-34404,
-34325,
-34907,
-35830,
-36913,
-37601,
-37386,
-36943,
-36091,
-35939,
-36013,
-36545,
-36938,
-36783,
-36542,
-36121,
-36333,
-37044,
-37547,
-37787,
-36908,
-35705,
-34847,
-34991,
-35959,
-36992,
-37233,
-36540,
-35702,
-35511,
-36306,
-37442,
-37890,
-37335,
-36175,
-35485,
-35886,
-36726,
-37601,
-37599,
-37600,
-37600,
-38576,
-39133,
-39128,
-38000,
-36461,
-35886,
-36066,
-36994,
-36727,
-35990,
-34747,
-35038,
-36783,
-39314,
-40876,
-40847,
-39448,
-38419,
-38206,
-39001,
-39183,
-38287,
-36992,
-36093,
-37128,
-39048,
-41116,
-41425,
-40402,
-38443,
-37389,
-37362,
-38234,
-38946,
-39237,
-38946,
-39027,
-39210,
-40056,
-40477,
-40717,
-40424,
-39979,
-39710,
-39502,
-39765,
-40187,
-40718,
-41321,
-41562,
-41876,
-41722,
-42087,
-42144,
-42641,
-42566,
-42432,
-41666,
-41271,
-41191,
-41639,
-42435,
-42851,
-42990,
-42377,
-41748,
-40926,
-40557,
-40162,
-40160,
-40163,
-40372,
-40557,
-40426,
-39844,
-39078,
-38261,
-38233,
-38629,
-39529,
-39737,
-39819,
-39158,
-38390,
-37629,
-36303,
-34776,
-32950,
-32056,
-32423,
-34167,
-35884,
-36937,
-36044,
-34773,
-33322,
-33482,
-34401,
-35437,
-35777,
-34984,
-33853,
-32657,
-31742,
-31021,
-30075,
-29572,
-29069,
-29230,
-28937,
-28410,
-27169,
-26403,
-26244,
-27143,
-27960,
-27777,
-26376,
-23973,
-22099,
-20910,
-20831,
-20857,
-20567,
-20092,
-19747,
-20067,
-21040,
-21862,
-21992,
-21492,
-20566,
-20146,
-20590,
-21547,
-22835,
-23580,
-23708,
-23313,
-22839,
-22624,
-22789,
-23284,
-23499,
-23471,
-23235,
-22678,
-22708,
-22756,
-23474,
-23920,
-24343,
-24290,
-24078,
-23871,
-23996,
-24163,
-24628,
-25113,
-25741,
-26772,
-27911,
-29251,
-30129,
-30416,
-30074,
-29650,
-29679,
-30493,
-31688,
-33294,
-34166,
-34933,
-35038,
-35064,
-34961,
-34666,
-34300,
-33665,
-33295,
-33296,
-33505,
-33957,
-33796,
-33164,
-32186,
-31421,
-31656,
-32584,
-33848,
-34591,
-34325,
-33401,
-32634,
-32636,
-33717,
-34775,
-35328,
-34643,
-33427,
-32423,
-32187,
-32635,
-33004,
-33086,
-32500,
-32083,
-31788,
-31872,
-31814,
-31290,
-30283,
-29150,
-28279,
-27642,
-27040,
-26187,
-25324,
-24499,
-24477,
-24685,
-25586,
-26005,
-26615,
-26588,
-26613,
-26457,
-26323,
-25954,
-25796,
-25504,
-25322,
-24948,
-24425,
-23759,
-23132,
-23151,
-23501,
-24394,
-25242,
-26139,
-26613,
-27433,
-27724,
-27934,
-27327,
-26377,
-25267,
-24872,
-24844,
-25584,
-25664,
-25636,
-25032,
-24552,
-24107,
-23893,
-23630,
-23763,
-24713,
-26613,
-29098,
-30864,
-30921,
-29728,
-28201,
-28011,
-29469,
-31630,
-32794,
-32635,
-30945,
-30152,
-30314,
-32024,
-33616,
-34586,
-34486,
-34667,
-35330,
-36700,
-37893,
-37835,
-37073,
-35593,
-35063,
-35251,
-36225,
-37179,
-37704,
-37839,
-37229,
-36437,
-35436,
-34719,
-34778,
-35561,
-36971,
-38018,
-38342,
-37626,
-36594,
-36097,
-36330,
-37179,
-37995,
-37916,
-37284,
-35961,
-35093,
-34535,
-34722,
-35302,
-36067,
-36888,
-37124,
-36808,
-35725,
-34298,
-33665,
-33534,
-34456,
-34986,
-34880,
-34007,
-33112,
-33083,
-33745,
-34668,
-34431,
-33135,
-31344,
-30467,
-31291,
-33293,
-35250,
-35646,
-34246,
-31974,
-29679,
-28672,
-28359,
-29148,
-29652,
-30311,
-30838,
-31423,
-32077,
-32824,
-33238,
-33590,
-33160,
-32321,
-30626,
-29176,
-28384,
-28832,
-30286,
-31974,
-32952,
-33032,
-32527,
-32321,
-32844,
-34169,
-35433,
-36279,
-36280,
-35962,
-35699,
-35936,
-36490,
-37362,
-37812,
-38365,
-38419,
-38549,
-38605,
-38601,
-38817,
-39130,
-39738,
-40560,
-41611,
-42512,
-43253,
-43776,
-43808,
-43990,
-43619,
-43386,
-42720,
-42091,
-42062,
-42643,
-44441,
-46761,
-48588,
-49718,
-49143,
-47921,
-46767,
-46127,
-46289,
-46578,
-46737,
-46392,
-46238,
-45994,
-46581,
-46946,
-47108,
-46604,
-45364,
-44227,
-43040,
-42486,
-42115,
-41983,
-41825,
-41877,
-42064,
-42696,
-43567,
-44230,
-44357,
-43439,
-41638,
-39159,
-37045,
-35593,
-35512,
-36493,
-37888,
-39187,
-39261,
-38498,
-36623,
-34827,
-33375,
-32819,
-32768,
-33294,
-33508,
-33796,
-33983,
-33901,
-33931,
-33214,
-32373,
-31101,
-30710,
-30917,
-31976,
-32740,
-32608,
-31263,
-29361,
-27986,
-27461,
-28038,
-28517,
-28938,
-28911,
-28833,
-28937,
-28755,
-27933,
-26351,
-24580,
-23420,
-23338,
-23843,
-24659,
-24898,
-24872,
-24896,
-25268,
-25928,
-26297,
-26298,
-26217,
-26192,
-26904,
-27593,
-27959,
-27884,
-27430,
-27408,
-27882,
-28831,
-29204,
-29042,
-27777,
-26508,
-25691,
-25872,
-27014,
-28671,
-30340,
-31577,
-32054,
-31606,
-30285,
-28700,
-27486,
-27247,
-28410,
-30577,
-32870,
-34646,
-35140,
-34539,
-33108,
-31688,
-30678,
-30392,
-30918,
-31789,
-32744,
-33608,
-34064,
-34324,
-34536,
-34881,
-35116,
-35383,
-35196,
-34932,
-34221,
-33822,
-33270,
-33137,
-32845,
-32584,
-31789,
-30945,
-30047,
-29387,
-29440,
-29281,
-29414,
-29068,
-28862,
-29146,
-29839,
-31154,
-31791,
-31685,
-30548,
-29150,
-28225,
-28277,
-28675,
-29175,
-28780,
-28014,
-27353,
-27459,
-28385,
-29596,
-30366,
-30152,
-29413,
-28385,
-27985,
-28227,
-29069,
-29625,
-29704,
-29412,
-28755,
-28699,
-28675,
-28858,
-28569,
-27907,
-27276,
-27114,
-27963,
-29147,
-30419,
-31207,
-31317,
-31365,
-31555,
-31998,
-32850,
-33265,
-33880,
-33979,
-34353,
-34457,
-34668,
-34511,
-34429,
-34196,
-34322,
-34566,
-34929,
-35253,
-35537,
-35648,
-35829,
-35831,
-35618,
-35251,
-34350,
-33614,
-33162,
-33428,
-34219,
-35144,
-35461,
-35091,
-34246,
-33850,
-34245,
-35251,
-36172,
-35912,
-35009,
-33720,
-33532,
-33981,
-34750,
-34719,
-33455,
-32318,
-31499,
-32399,
-33266,
-33668,
-32553,
-30921,
-29729,
-29942,
-30813,
-31684,
-31368,
-30786,
-30233,
-30601,
-31104,
-30892,
-29809,
-28041,
-27221,
-27274,
-28041,
-28013,
-26457,
-24130,
-22179,
-21702,
-22600,
-23552,
-23655,
-22470,
-20908,
-20199,
-20724,
-22337,
-23867,
-24529,
-24473,
-23924,
-23943,
-24716,
-25978,
-27170,
-27617,
-27223,
-26347,
-26011,
-26478,
-28228,
-30126,
-31735,
-31899,
-31206,
-30154,
-29810,
-30257,
-31132,
-31049,
-29995,
-27775,
-26351,
-26192,
-28092,
-30287,
-31787,
-31714,
-30756,
-30157,
-30810,
-32108,
-33534,
-33715,
-33510,
-33266,
-33904,
-35382,
-36805,
-37736,
-38202,
-38475,
-39130,
-39685,
-39635,
-39077,
-37970,
-37811,
-38497,
-40400,
-41983,
-42987,
-42670,
-41824,
-40955,
-40398,
-40268,
-40107,
-39977,
-39738,
-39767,
-39368,
-39237,
-38049,
-37255,
-35886,
-35458,
-35093,
-35513,
-35671,
-35991,
-35828,
-35594,
-35249,
-35065,
-35144,
-35592,
-36016,
-36173,
-35329,
-33770,
-31765,
-30284,
-30153,
-31024,
-32634,
-33350,
-33559,
-32845,
-32136,
-31575,
-30843,
-29649,
-28304,
-27356,
-27456,
-28730,
-29781,
-30179,
-29309,
-28461,
-28492,
-30017,
-31661,
-32712,
-31686,
-30442,
-29151,
-29859,
-31081,
-32368,
-32398,
-31554,
-30942,
-31265,
-32395,
-33534,
-33428,
-32660,
-31606,
-31711,
-33083,
-34987,
-36991,
-37891,
-37943,
-37044,
-35251,
-33320,
-31317,
-30362,
-30682,
-31842,
-33613,
-34350,
-34724,
-34560,
-35094,
-36092,
-37257,
-37416,
-36727,
-35384,
-34745,
-35014,
-36251,
-37047,
-36965,
-35883,
-34485,
-33954,
-34168,
-34958,
-35461,
-35144,
-34404,
-33349,
-32661,
-32424,
-32609,
-33056,
-33694,
-33900,
-34116,
-33558,
-33349,
-33162,
-34063,
-35353,
-36598,
-36991,
-36254,
-35011,
-33850,
-33639,
-34061,
-34669,
-34720,
-34009,
-32900,
-32105,
-32004,
-32659,
-33164,
-32953,
-31974,
-30205,
-29204,
-28882,
-30157,
-31548,
-32850,
-32870,
-32004,
-30837,
-30234,
-30864,
-31976,
-33349,
-33636,
-33273,
-32261,
-31820,
-32184,
-33428,
-34537,
-35064,
-34219,
-33138,
-32107,
-31920,
-32664,
-33373,
-34194,
-34537,
-34983,
-36018,
-37519,
-39370,
-41006,
-41824,
-42222,
-41614,
-40768,
-39528,
-38576,
-38313,
-38789,
-39975,
-40796,
-41086,
-40370,
-39559,
-38729,
-38529,
-38099,
-37362,
-35754,
-34348,
-33060,
-32871,
-32795,
-32793,
-32424,
-32238,
-32979,
-34484,
-36331,
-37522,
-37492,
-36757,
-36040,
-36227,
-37415,
-38840,
-39951,
-40478,
-40319,
-40452,
-40214,
-40082,
-39580,
-38868,
-38707,
-39134,
-40290,
-41591,
-41979,
-41406,
-39156,
-36306,
-33217,
-30970,
-29863,
-29836,
-30443,
-31183,
-31183,
-30891,
-30075,
-29703,
-29915,
-30762,
-31681,
-32163,
-32132,
-31420,
-31026,
-30441,
-30604,
-30573,
-30762,
-30917,
-31184,
-31341,
-31208,
-30444,
-29413,
-28384,
-28014,
-28515,
-29307,
-29916,
-29624,
-28675,
-27221,
-25928,
-24711,
-23685,
-22916,
-22416,
-22679,
-23499,
-24791,
-25796,
-26457,
-26241,
-26063,
-26190,
-26587,
-27727,
-28484,
-29470,
-29754,
-29969,
-29758,
-29675,
-29574,
-29966,
-30497,
-31421,
-31974,
-32318,
-32028,
-31738,
-31446,
-31764,
-32450,
-33374,
-34247,
-34958,
-35435,
-35592,
-35409,
-34667,
-33772,
-32740,
-32212,
-32531,
-33558,
-35144,
-36783,
-37834,
-38501,
-38865,
-38921,
-39237,
-39237,
-38972,
-38368,
-37200,
-36152,
-35455,
-35097,
-35429,
-35413,
-35482,
-35042,
-34587,
-34722,
-35171,
-36305,
-37230,
-37494,
-37019,
-35539,
-34037,
-32659,
-32109,
-31867,
-32214,
-31922,
-31975,
-31288,
-31209,
-31156,
-31554,
-32025,
-32348,
-32367,
-32243,
-31919,
-31369,
-30919,
-29676,
-28543,
-26693,
-25372,
-24213,
-23866,
-23922,
-24078,
-24132,
-23604,
-23023,
-22282,
-22047,
-21991,
-22391,
-22546,
-22787,
-22756,
-22972,
-23417,
-24028,
-24870,
-25268,
-25532,
-25344,
-25192,
-25026,
-24900,
-24738,
-24423,
-24210,
-24159,
-24396,
-24870,
-25243,
-25293,
-24870,
-24213,
-23627,
-23581,
-23944,
-24610,
-25317,
-25824,
-26243,
-26590,
-27324,
-28202,
-29410,
-30367,
-31049,
-31290,
-31497,
-31899,
-32843,
-34143,
-35354,
-36279,
-36412,
-36095,
-35749,
-35701,
-36357,
-37204,
-38313,
-38682,
-38815,
-38339,
-38155,
-38259,
-38841,
-39529,
-39894,
-39954,
-39682,
-39769,
-39920,
-40693,
-41082,
-41353,
-41056,
-40507,
-40556,
-40901,
-41985,
-42694,
-42963,
-42271,
-41088,
-39896,
-38974,
-38760,
-38816,
-38761,
-38630,
-38048,
-37970,
-38075,
-38498,
-38867,
-38629,
-37944,
-36992,
-36121,
-35592,
-35304,
-34534,
-33667,
-32264,
-31209,
-30577,
-30098,
-29917,
-29543,
-29177,
-29044,
-29042,
-29020,
-28671,
-28016,
-27405,
-27169,
-27460,
-27906,
-28175,
-27668,
-27144,
-26429,
-26614,
-26745,
-27303,
-26955,
-26776,
-26136,
-26298,
-26351,
-27061,
-27066,
-26981,
-26590,
-26190,
-26325,
-26534,
-26852,
-26958,
-26851,
-26827,
-27193,
-28043,
-29013,
-29894,
-30095,
-29972,
-30097,
-30656,
-32028,
-33531,
-34433,
-34904,
-34459,
-34404,
-34536,
-35012,
-35514,
-35565,
-35251,
-35142,
-35120,
-35697,
-36173,
-36546,
-36539,
-36416,
-36356,
-36518,
-36940,
-37440,
-37997,
-38655,
-39133,
-39314,
-39265,
-38762,
-38628,
-38473,
-38707,
-38684,
-38364,
-37469,
-36781,
-36278,
-36441,
-36591,
-36311,
-35299,
-33983,
-32900,
-32606,
-32956,
-33528,
-33722,
-33425,
-32663,
-32106,
-31499,
-31290,
-31154,
-30975,
-31020,
-31054,
-31338,
-31662,
-31812,
-32112,
-32260,
-32639,
-33082,
-33534,
-33718,
-33954,
-33746,
-33664,
-33348,
-32927,
-32316,
-31950,
-31474,
-31286,
-31053,
-30811,
-30418,
-30470,
-30363,
-30840,
-30971,
-31024,
-30893,
-30734,
-30969,
-31185,
-31763,
-31763,
-31634,
-31363,
-31478,
-32077,
-33086,
-33902,
-34219,
-34220,
-33904,
-34138,
-34433,
-35248,
-35698,
-36096,
-36147,
-36226,
-36518,
-36912,
-37309,
-37628,
-37545,
-37680,
-37706,
-37968,
-38525,
-38841,
-39289,
-39370,
-39606,
-39659,
-39979,
-40264,
-40348,
-40529,
-40427,
-40610,
-40874,
-41086,
-41085,
-40822,
-40292,
-40005,
-39763,
-40006,
-40289,
-40561,
-40660,
-40586,
-40424,
-40241,
-40003,
-39738,
-39397,
-39049,
-38818,
-38680,
-38631,
-38656,
-38550,
-38603,
-38498,
-38656,
-38736,
-38997,
-39003,
-39048,
-38607,
-38310,
-37864,
-37680,
-37810,
-37943,
-37891,
-37413,
-36467,
-35352,
-34776,
-34377,
-34933,
-35092,
-35274,
-34696,
-33955,
-33216,
-32848,
-32474,
-32321,
-31708,
-31423,
-30995,
-31477,
-31521,
-32060,
-31679,
-31397,
-30918,
-30891,
-31027,
-31047,
-31028,
-30625,
-30525,
-30627,
-31102,
-31715,
-32260,
-32429,
-32341,
-32214,
-31870,
-31815,
-31579,
-31474,
-31393,
-31342,
-31340,
-31131,
-30838,
-30471,
-30178,
-30127,
-30179,
-30153,
-30258,
-29915,
-29809,
-29521,
-29675,
-30102,
-30573,
-31238,
-31471,
-31792,
-31762,
-31843,
-32029,
-32237,
-32664,
-33187,
-33641,
-34165,
-34590,
-34721,
-34669,
-34351,
-33824,
-33506,
-33137,
-33058,
-33057,
-33058,
-32978,
-32900,
-32634,
-32583,
-32318,
-32345,
-32292,
-32397,
-32476,
-32451,
-32319,
-32078,
-31794,
-31389,
-31188,
-30728,
-30316,
-29647,
-29153,
-28830,
-28675,
-28937,
-29071,
-29202,
-28937,
-28518,
-27799,
-27119,
-26269,
-25426,
-24450,
-23523,
-22468,
-21836,
-21330,
-20993,
-20642,
-19989,
-19086,
-18323,
-17531,
-17289,
-16821,
-16550,
-15789,
-15152,
-14625,
-14335,
-14203,
-13885,
-13280,
-12642,
-11933,
-11720,
-11297,
-11141,
-10451,
-9847,
-9316,
-9133,
-9316,
-9451,
-9395,
-9081,
-8708,
-8500,
-8472,
-8709,
-8632,
-8787,
-8474,
-8576,
-8501,
-8681,
-9056,
-9076,
-9637,
-9553,
-10058,
-10029,
-10349,
-10028,
-10006,
-9474,
-9344,
-8948,
-8709,
-8578,
-8420,
-8762,
-9529,
-10795,
-12461,
-13858,
-14865,
-15256,
-15420,
-15758,
-16714,
-18004,
-19642,
-21070,
-22360,
-23607,
-25054,
-27011,
-29070,
-31393,
-33375,
-35303,
-36913,
-38524,
-40187,
-41957,
-43806,
-45653,
-47452,
-49163,
-50754,
-52464,
-53923,
-55526,
-56830,
-58034,
-59126,
-60228,
-61633,
-63029,
-64668,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65382,
-64770,
-64117,
-63290,
-62506,
-61707,
-61184,
-60625,
-60550,
-60335,
-60496,
-60443,
-60229,
-59864,
-59251,
-58755,
-58433,
-58359,
-58432,
-58782,
-58643,
-58624,
-58326,
-58123,
-58113,
-58203,
-58114,
-57937,
-57377,
-56773,
-56004,
-55295,
-54261,
-53394,
-52253,
-51281,
-50142,
-49325,
-48164,
-47237,
-46157,
-45310,
-44491,
-43571,
-42376,
-40930,
-39288,
-37759,
-36385,
-35329,
-34165,
-33007,
-31472,
-30048,
-28911,
-28145,
-27883,
-27511,
-27091,
-26110,
-24953,
-23733,
-22788,
-22228,
-21915,
-21675,
-21334,
-20961,
-20569,
-20618,
-20673,
-21095,
-21438,
-21966,
-22390,
-22995,
-23368,
-23945,
-24397,
-25214,
-26270,
-27673,
-28724,
-30023,
-30416,
-31314,
-31843,
-32662,
-33136,
-33323,
-32872,
-32635,
-32319,
-32765,
-33087,
-33345,
-33008,
-32502,
-31841,
-31899,
-31813,
-31951,
-31234,
-29758,
-27827,
-25877,
-24288,
-23368,
-22361,
-21413,
-19826,
-17954,
-16077,
-14414,
-13146,
-11932,
-10742,
-9029,
-7440,
-5516,
-4246,
-2900,
-1924,
-497,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-2,
-65535,
-2,
-1656,
-5068,
-8788,
-12300,
-15896,
-19189,
-22605,
-25977,
-29600,
-33242,
-36675,
-39872,
-42642,
-45233,
-47819,
-50565,
-53842,
-57377,
-61158,
-64771,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65531,
-65534,
-65531,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65531,
-65534,
-65533,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65530,
-65534,
-65530,
-65534,
-65404,
-62478,
-60070,
-58095,
-56082,
-54055,
-51435,
-48613,
-45653,
-42935,
-40424,
-37945,
-35538,
-32901,
-30389,
-28014,
-26007,
-24369,
-22865,
-21358,
-19565,
-17554,
-15420,
-13064,
-10930,
-8525,
-6332,
-4091,
-2183,
-686,
-65535,
-1,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-0,
-1051,
-2847,
-5092,
-7839,
-10901,
-13834,
-16868,
-19062,
-21677,
-23815,
-26797,
-29628,
-32842,
-35359,
-37730,
-39659,
-41616,
-44198,
-47322,
-50799,
-54663,
-57825,
-61236,
-63743,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65531,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65532,
-65534,
-65533,
-65534,
-64615,
-62713,
-61208,
-59650,
-58224,
-56799,
-55239,
-53762,
-52229,
-50486,
-48561,
-45995,
-43676,
-40925,
-38604,
-36121,
-33454,
-30839,
-28040,
-25637,
-23683,
-21861,
-20594,
-18928,
-17372,
-15761,
-13779,
-11959,
-9660,
-7126,
-4272,
-1186,
-65535,
-2,
-65535,
-0,
-65535,
-1,
-65535,
-3,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-3,
-65535,
-3,
-65535,
-1767,
-6623,
-11403,
-16396,
-21198,
-26272,
-31448,
-36515,
-41616,
-46524,
-50987,
-55086,
-58641,
-61715,
-64585,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65534,
-65533,
-65534,
-65531,
-65534,
-65532,
-64511,
-63346,
-62529,
-61630,
-60575,
-59253,
-57327,
-55371,
-53393,
-51726,
-50330,
-49111,
-47426,
-45705,
-43358,
-41322,
-39343,
-37573,
-35884,
-33981,
-32028,
-30152,
-28676,
-27351,
-26432,
-25106,
-23633,
-21647,
-19328,
-16789,
-13913,
-11007,
-7997,
-5249,
-2903,
-916,
-3,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-65535,
-1,
-65535,
-0,
-0,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-1,
-65535,
-578,
-3400,
-6255,
-9714,
-13198,
-16897,
-20170,
-22996,
-25638,
-28357,
-31658,
-35644,
-40112,
-44645,
-48750,
-52409,
-55746,
-59039,
-62558,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65220,
-63243,
-61499,
-59966,
-58621,
-57300,
-55740,
-53711,
-51382,
-48799,
-46366,
-44306,
-42619,
-41110,
-39556,
-37995,
-36094,
-34748,
-33453,
-33006,
-32924,
-32928,
-32817,
-32427,
-31259,
-30207,
-28621,
-27195,
-25822,
-24053,
-22520,
-20488,
-18746,
-16709,
-15050,
-13303,
-11800,
-10453,
-9185,
-8102,
-6969,
-5590,
-4065,
-2185,
-473,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-4,
-65535,
-3,
-65535,
-0,
-0,
-65535,
-2,
-65535,
-0,
-0,
-65535,
-2,
-65535,
-0,
-0,
-65535,
-4300,
-9925,
-15257,
-20781,
-25845,
-30922,
-35590,
-40006,
-43933,
-47771,
-51513,
-55533,
-60020,
-64797,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65531,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-63850,
-62342,
-61262,
-60098,
-59177,
-57693,
-56510,
-54973,
-53579,
-51938,
-50090,
-48085,
-45705,
-43543,
-41058,
-38814,
-36414,
-34031,
-31556,
-29093,
-26326,
-23471,
-20065,
-16552,
-12567,
-8734,
-4988,
-1553,
-65535,
-1,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-65535,
-65535,
-0,
-0,
-65535,
-2,
-65535,
-1,
-0,
-65535,
-3,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-65535,
-1,
-996,
-5173,
-9740,
-15047,
-20409,
-25716,
-30944,
-36070,
-41137,
-46421,
-51303,
-56352,
-60968,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65529,
-65534,
-65529,
-65534,
-65531,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-64246,
-61156,
-57800,
-54503,
-51197,
-48190,
-45233,
-42483,
-39873,
-37281,
-35144,
-32900,
-31419,
-29759,
-28591,
-27358,
-26372,
-25589,
-24867,
-24345,
-23709,
-22970,
-22047,
-21066,
-19935,
-18927,
-17876,
-17053,
-16131,
-15444,
-14861,
-14363,
-13989,
-13334,
-12642,
-11565,
-10608,
-9636,
-8656,
-7812,
-6783,
-5540,
-4248,
-2582,
-1184,
-65535,
-0,
-65535,
-3,
-65535,
-2,
-65535,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-0,
-3190,
-8367,
-13411,
-18585,
-23710,
-29070,
-34325,
-39158,
-43410,
-47211,
-50937,
-54974,
-59572,
-64510,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-63665,
-61391,
-58966,
-56400,
-54317,
-52572,
-51305,
-50435,
-49086,
-47714,
-45602,
-43619,
-41405,
-39472,
-37179,
-35064,
-32318,
-29942,
-27406,
-25189,
-22943,
-20513,
-17690,
-14439,
-10823,
-7126,
-3531,
-158,
-65535,
-3,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-3,
-65535,
-4,
-65535,
-0,
-0,
-65535,
-0,
-65535,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-1367,
-5491,
-10106,
-14998,
-20169,
-25637,
-31210,
-37044,
-42803,
-48532,
-53868,
-59093,
-63878,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65532,
-62901,
-59490,
-56112,
-52757,
-49537,
-46261,
-43382,
-40532,
-38075,
-35618,
-33351,
-31179,
-29257,
-27486,
-25900,
-24398,
-23020,
-21440,
-20197,
-18666,
-17582,
-16395,
-15680,
-14996,
-14440,
-13939,
-13357,
-12961,
-12460,
-12170,
-11798,
-11564,
-11295,
-11036,
-10716,
-10347,
-9740,
-8946,
-7919,
-6649,
-5436,
-4009,
-2926,
-1606,
-445,
-65535,
-0,
-65535,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-3,
-65535,
-0,
-0,
-65535,
-1,
-65535,
-1,
-65535,
-2,
-65535,
-1,
-65535,
-2,
-65535,
-2,
-65535,
-0,
-65535,
-0,
-65535,
-1,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-65535,
-0,
-65535,
-1370,
-6121,
-10532,
-14440,
-18138,
-22071,
-26088,
-30678,
-35332,
-40132,
-44732,
-49350,
-53735,
-58303,
-62398,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65530,
-65534,
-65531,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65532,
-65040,
-63979,
-63191,
-61945,
-60656,
-59014,
-57354,
-55742,
-54208,
-52735,
-51486,
-50332,
-49455,
-48770,
-48111,
-47316,
-46369,
-45125,
-43990,
-42538,
-41139,
-39289,
-37311,
-35247,
-33270,
-31446,
-29547,
-27537,
-25057,
-22468,
-19536,
-16845,
-14386,
-12143,
-10322,
-8708,
-7364,
-6254,
-5065,
-3799,
-2080,
-287,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-65535,
-0,
-65535,
-2,
-65535,
-2,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-3,
-65535,
-76,
-2558,
-5142,
-8185,
-11296,
-14546,
-17874,
-21305,
-25612,
-30310,
-35832,
-41136,
-46422,
-50907,
-55427,
-59859,
-64750,
-65531,
-65534,
-65532,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65530,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-64322,
-60788,
-57642,
-54473,
-51599,
-49003,
-46636,
-44832,
-42803,
-41007,
-38866,
-36677,
-34667,
-32583,
-31129,
-29573,
-28251,
-26641,
-25214,
-23737,
-22730,
-21943,
-21356,
-20860,
-20037,
-19353,
-18507,
-18032,
-17767,
-17530,
-17636,
-17345,
-17266,
-16976,
-16605,
-16209,
-15577,
-14730,
-14097,
-13173,
-12592,
-11693,
-10797,
-9396,
-8102,
-6413,
-5224,
-3903,
-3244,
-2002,
-946,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-0,
-0,
-65535,
-3,
-65535,
-2,
-65535,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-65535,
-2,
-970,
-6334,
-11774,
-16921,
-21598,
-26428,
-31184,
-36595,
-41906,
-47316,
-52230,
-57221,
-62000,
-65534,
-65533,
-65534,
-65533,
-65534,
-65532,
-65534,
-65531,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-64507,
-62981,
-61336,
-59680,
-57720,
-55822,
-53655,
-51437,
-49378,
-47688,
-46551,
-45628,
-45152,
-44149,
-43515,
-42196,
-41135,
-39532,
-37727,
-35571,
-32895,
-30473,
-27878,
-25800,
-23864,
-22233,
-20354,
-18559,
-16424,
-14331,
-12066,
-9817,
-7628,
-5594,
-3691,
-1925,
-151,
-2,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-2,
-65535,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-3,
-65535,
-1,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-65535,
-65535,
-1,
-1737,
-6175,
-10716,
-15392,
-20091,
-24766,
-29467,
-34112,
-38922,
-43751,
-48825,
-53680,
-58331,
-63030,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65531,
-65534,
-65534,
-65533,
-65534,
-65530,
-65534,
-65530,
-65534,
-65532,
-65534,
-65534,
-65534,
-63744,
-59622,
-56008,
-52861,
-50013,
-47264,
-44598,
-42115,
-39740,
-37651,
-35251,
-32766,
-30073,
-27488,
-25316,
-23610,
-22434,
-21341,
-20533,
-19595,
-18820,
-18219,
-17636,
-17422,
-17032,
-17023,
-16927,
-16973,
-17003,
-16949,
-16975,
-16922,
-17161,
-17319,
-17687,
-18034,
-18452,
-18588,
-18718,
-18505,
-18272,
-17951,
-17425,
-17082,
-16313,
-15445,
-14070,
-12592,
-11033,
-9478,
-8257,
-6734,
-5272,
-3247,
-917,
-1,
-65535,
-0,
-65535,
-1,
-65535,
-65535,
-1,
-65535,
-3,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-0,
-65535,
-1,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-3,
-65535,
-0,
-65535,
-65535,
-65535,
-0,
-65535,
-3,
-65535,
-5,
-65535,
-3776,
-10926,
-17424,
-23843,
-29966,
-36122,
-42697,
-49270,
-56034,
-62659,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65531,
-65534,
-65532,
-65534,
-65534,
-65531,
-65534,
-65531,
-65534,
-65531,
-65534,
-65531,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-63875,
-62212,
-60547,
-58912,
-57035,
-54844,
-52626,
-50697,
-48719,
-47105,
-45286,
-43433,
-41934,
-40475,
-39768,
-39077,
-38392,
-37310,
-36146,
-34670,
-33558,
-32346,
-31154,
-29706,
-28012,
-26114,
-24421,
-22627,
-20910,
-18956,
-16580,
-13964,
-11139,
-8315,
-5487,
-3032,
-499,
-65535,
-1,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-2,
-65535,
-2,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-1394,
-6150,
-10952,
-15869,
-20828,
-26010,
-31232,
-37022,
-42720,
-48693,
-54500,
-60310,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65531,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-62873,
-57088,
-51727,
-46130,
-41243,
-36731,
-32448,
-28517,
-24474,
-20831,
-17294,
-14174,
-11327,
-8390,
-5623,
-2792,
-473,
-65535,
-0,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-738,
-2000,
-3192,
-4458,
-5778,
-7178,
-8605,
-10029,
-11379,
-12669,
-13940,
-15126,
-16210,
-17081,
-17424,
-17662,
-17134,
-16844,
-16155,
-15922,
-15413,
-14972,
-14174,
-12963,
-11694,
-9896,
-8210,
-6068,
-3719,
-1105,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-2,
-65535,
-2,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-65535,
-2,
-65535,
-2,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-65535,
-0,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-4328,
-10874,
-17716,
-24130,
-30419,
-36251,
-41959,
-47581,
-53127,
-58726,
-64034,
-65534,
-65534,
-65534,
-65532,
-65534,
-65531,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-64218,
-62740,
-61630,
-60866,
-60389,
-59966,
-59440,
-58619,
-57407,
-55819,
-53974,
-52097,
-50328,
-49194,
-48345,
-48008,
-48001,
-47717,
-47473,
-46607,
-45442,
-43911,
-42169,
-40240,
-38603,
-36887,
-35672,
-34377,
-33086,
-31446,
-29201,
-26457,
-23179,
-19672,
-15970,
-12646,
-9315,
-6757,
-4088,
-2082,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-4,
-65535,
-5,
-65535,
-3669,
-7652,
-11906,
-16341,
-21280,
-26536,
-32475,
-38446,
-44650,
-50618,
-56509,
-62448,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-60653,
-56033,
-51041,
-46551,
-41747,
-37070,
-32108,
-27037,
-22124,
-17215,
-13011,
-9109,
-5829,
-2929,
-257,
-0,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-65535,
-2,
-65535,
-0,
-1,
-1365,
-3115,
-5380,
-7416,
-9636,
-11771,
-13702,
-15601,
-17215,
-18715,
-20281,
-21750,
-23397,
-24920,
-26512,
-27561,
-28520,
-28644,
-28596,
-27935,
-27299,
-26484,
-25662,
-25083,
-24026,
-23156,
-21700,
-19935,
-18083,
-15630,
-13833,
-11429,
-9555,
-6730,
-4141,
-629,
-65535,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-1,
-65535,
-3,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-2,
-65535,
-3,
-65535,
-2,
-65535,
-65535,
-0,
-65535,
-2057,
-6913,
-11589,
-16421,
-21199,
-25851,
-29860,
-33402,
-36623,
-39790,
-43333,
-47023,
-50809,
-54416,
-57859,
-61126,
-64378,
-65534,
-65533,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-64641,
-64193,
-63822,
-63954,
-63771,
-63688,
-63456,
-63423,
-63851,
-64455,
-65381,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65489,
-64296,
-63242,
-63005,
-62606,
-62846,
-62503,
-62236,
-61291,
-60306,
-58730,
-57084,
-55297,
-53547,
-52020,
-50433,
-48850,
-47053,
-45021,
-42537,
-39713,
-36279,
-32504,
-28276,
-24214,
-20166,
-16875,
-13909,
-11536,
-9451,
-7439,
-5544,
-3506,
-1343,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-3,
-65535,
-1,
-1737,
-5752,
-9345,
-13038,
-16425,
-19795,
-23320,
-26846,
-30685,
-34772,
-39263,
-44203,
-49246,
-54155,
-58808,
-62922,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65141,
-60813,
-56269,
-52019,
-48056,
-44652,
-41349,
-38313,
-35117,
-32556,
-30337,
-28701,
-27512,
-25980,
-24185,
-21993,
-19536,
-17716,
-16129,
-15260,
-14625,
-14255,
-14045,
-14042,
-14206,
-14489,
-14787,
-14967,
-15416,
-15975,
-17104,
-18720,
-20726,
-22994,
-25349,
-27194,
-29069,
-30182,
-31575,
-32639,
-33926,
-35198,
-36517,
-37652,
-38922,
-40026,
-41221,
-42588,
-43808,
-45098,
-45892,
-46842,
-47345,
-48030,
-48296,
-48399,
-48058,
-47528,
-46395,
-44913,
-42989,
-40528,
-37946,
-35142,
-32742,
-30363,
-28199,
-25847,
-23052,
-20168,
-16950,
-13859,
-10743,
-7417,
-4008,
-153,
-1,
-65535,
-1,
-65535,
-0,
-0,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-0,
-65535,
-0,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-2,
-65535,
-3,
-65535,
-0,
-0,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-1054,
-6357,
-11247,
-16050,
-20224,
-24369,
-28279,
-32395,
-36547,
-40950,
-45181,
-49641,
-53866,
-58305,
-62395,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65222,
-61632,
-57906,
-53974,
-49904,
-45840,
-42062,
-38313,
-35039,
-31551,
-28041,
-24000,
-19483,
-14521,
-9263,
-4116,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-3,
-65535,
-0,
-65535,
-0,
-65535,
-2,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-2374,
-7202,
-11776,
-16286,
-20728,
-25370,
-30446,
-35749,
-41351,
-46578,
-51621,
-56219,
-60678,
-64802,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65531,
-65534,
-65532,
-62320,
-58671,
-55082,
-51596,
-48665,
-46103,
-44359,
-42935,
-41667,
-40319,
-38657,
-37017,
-35542,
-34562,
-33665,
-33164,
-32342,
-31900,
-31600,
-31610,
-31998,
-32241,
-32528,
-32425,
-32528,
-32558,
-33214,
-33666,
-34537,
-35195,
-36096,
-37018,
-38233,
-39451,
-40685,
-41776,
-42641,
-43172,
-43596,
-43724,
-43834,
-43857,
-43674,
-43382,
-42698,
-41877,
-40531,
-39581,
-38258,
-37708,
-36885,
-36201,
-35408,
-34086,
-32796,
-30889,
-28730,
-25951,
-22946,
-19404,
-16103,
-12620,
-9051,
-5542,
-1553,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-0,
-1,
-65535,
-3,
-65535,
-2,
-65535,
-65535,
-3,
-65535,
-3,
-65535,
-1,
-65535,
-3,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-4,
-65535,
-3,
-2950,
-7576,
-11746,
-16158,
-20063,
-24319,
-28513,
-33034,
-37624,
-42170,
-46524,
-50461,
-54052,
-57299,
-60259,
-63319,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65531,
-65534,
-65530,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65531,
-65534,
-64451,
-60184,
-55948,
-51758,
-48028,
-44388,
-40794,
-37310,
-33559,
-29809,
-25796,
-21781,
-17267,
-12933,
-8528,
-4534,
-1028,
-65535,
-0,
-65535,
-65535,
-65535,
-1,
-65535,
-3,
-65535,
-2,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-1951,
-7176,
-12726,
-18478,
-24478,
-30203,
-35622,
-40582,
-45126,
-49351,
-53576,
-57645,
-61946,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65531,
-65534,
-65534,
-65532,
-65534,
-65531,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-63398,
-60551,
-58010,
-56007,
-54580,
-53892,
-53262,
-52253,
-50990,
-49139,
-47530,
-46103,
-45257,
-44651,
-44149,
-43568,
-42960,
-42723,
-42723,
-43013,
-43173,
-42668,
-41880,
-40449,
-39056,
-37727,
-36733,
-36011,
-35569,
-35222,
-35039,
-34879,
-34696,
-34085,
-33193,
-31787,
-30076,
-28277,
-26454,
-24928,
-23519,
-22447,
-21250,
-20013,
-18324,
-16365,
-14100,
-11718,
-9450,
-7074,
-5142,
-2929,
-1103,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-3,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-2,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-3,
-65535,
-3,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-2266,
-6044,
-9685,
-13808,
-17689,
-21727,
-25612,
-29439,
-33296,
-37309,
-41694,
-46260,
-50830,
-55400,
-59252,
-62900,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65532,
-65534,
-65532,
-65534,
-65532,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-62345,
-58672,
-55056,
-51173,
-47528,
-43833,
-40556,
-37179,
-34086,
-30365,
-26614,
-22019,
-17107,
-11801,
-6436,
-1479,
-65535,
-4,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-3,
-65535,
-1,
-2661,
-6414,
-10082,
-14018,
-17900,
-22361,
-26749,
-31656,
-36439,
-41164,
-45680,
-49828,
-53521,
-57013,
-60411,
-63695,
-65531,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65532,
-65534,
-65531,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65531,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65531,
-64486,
-63002,
-61816,
-60628,
-59913,
-59227,
-59098,
-58829,
-58913,
-58485,
-58280,
-57878,
-57673,
-57851,
-57988,
-58514,
-58752,
-58833,
-58539,
-57777,
-57006,
-55878,
-55315,
-54531,
-54445,
-54027,
-53918,
-53578,
-53125,
-52760,
-51991,
-51306,
-50037,
-48796,
-47134,
-45415,
-43490,
-41534,
-39395,
-37046,
-34482,
-31713,
-28910,
-26139,
-23340,
-20619,
-17663,
-14783,
-11799,
-9106,
-6625,
-4297,
-2349,
-177,
-1,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-3,
-65535,
-1,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-3165,
-7440,
-11670,
-16234,
-20912,
-26085,
-31393,
-36836,
-42245,
-47320,
-52334,
-57008,
-61422,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65531,
-65534,
-65531,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-62951,
-60549,
-57958,
-55322,
-52570,
-49934,
-47132,
-44546,
-41771,
-39027,
-36331,
-33640,
-31286,
-28941,
-26849,
-24346,
-21779,
-18483,
-15124,
-11275,
-7676,
-4355,
-1395,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-2,
-65535,
-3,
-65535,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-65535,
-2,
-65535,
-3,
-65535,
-3,
-65535,
-3,
-1523,
-4435,
-7546,
-10480,
-13463,
-16104,
-18797,
-21359,
-23763,
-26349,
-28992,
-31816,
-34957,
-38159,
-41449,
-44630,
-47392,
-49962,
-52070,
-53972,
-55716,
-57404,
-59388,
-61576,
-64061,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-63980,
-61288,
-58621,
-55740,
-52812,
-49641,
-46367,
-43278,
-39870,
-36649,
-32980,
-29464,
-25718,
-22124,
-18692,
-15181,
-11982,
-8607,
-5353,
-2190,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-3,
-65535,
-2,
-65535,
-2,
-65535,
-4,
-65535,
-3,
-521,
-3060,
-5223,
-7285,
-9051,
-10560,
-12169,
-13515,
-14944,
-16155,
-17240,
-18111,
-18771,
-19326,
-19378,
-19485,
-18929,
-18744,
-18139,
-17792,
-17426,
-17080,
-16791,
-16473,
-15920,
-15232,
-14150,
-12697,
-11193,
-9315,
-7736,
-5828,
-4250,
-2185,
-339,
-0,
-65535,
-0,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-1,
-65535,
-0,
-65535,
-2,
-65535,
-4,
-65535,
-3,
-65535,
-1,
-4536,
-9609,
-14465,
-19328,
-23865,
-28729,
-33135,
-37919,
-42167,
-46499,
-50566,
-54447,
-58304,
-61631,
-64746,
-65534,
-65533,
-65534,
-65532,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65532,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65533,
-65534,
-65531,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-63716,
-61235,
-58725,
-56060,
-53073,
-49987,
-46655,
-43332,
-40107,
-37311,
-34877,
-32639,
-30598,
-28121,
-25400,
-22203,
-18719,
-14942,
-11561,
-8024,
-5542,
-3453,
-2241,
-1738,
-1342,
-1237,
-1025,
-549,
-182,
-65535,
-1,
-65535,
-1,
-65535,
-288,
-1603,
-2930,
-4350,
-5807,
-7071,
-8551,
-10085,
-11560,
-13254,
-14727,
-16583,
-18161,
-20093,
-21491,
-23075,
-24317,
-25663,
-27117,
-28830,
-30658,
-32764,
-35014,
-37282,
-39368,
-41484,
-42905,
-44336,
-45072,
-45918,
-46527,
-47553,
-48560,
-50118,
-51699,
-53606,
-55686,
-57591,
-59704,
-61391,
-62953,
-64165,
-65353,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65533,
-65534,
-65531,
-65534,
-65533,
-65534,
-65534,
-65532,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65532,
-65041,
-62156,
-59308,
-56428,
-53312,
-50171,
-46630,
-42934,
-39052,
-35013,
-30865,
-26640,
-22469,
-18268,
-14416,
-10504,
-6862,
-2953,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-2,
-65535,
-4,
-65535,
-5,
-65535,
-0,
-1,
-65535,
-4,
-65535,
-921,
-4247,
-7336,
-10770,
-14045,
-17739,
-21334,
-25082,
-28542,
-31949,
-34879,
-37785,
-40293,
-42802,
-45021,
-47105,
-48983,
-50697,
-52071,
-53182,
-53758,
-53949,
-53786,
-53576,
-53129,
-52967,
-52574,
-52177,
-51964,
-51359,
-51121,
-50247,
-49407,
-48027,
-46449,
-44834,
-43041,
-41296,
-39475,
-37361,
-35541,
-33507,
-31789,
-29996,
-28222,
-26248,
-24287,
-22287,
-20299,
-18748,
-16814,
-15287,
-13463,
-11957,
-10533,
-9185,
-8049,
-6677,
-5065,
-3402,
-1607,
-65535,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-2,
-65535,
-2,
-65535,
-2427,
-7150,
-12540,
-17689,
-22572,
-27091,
-31234,
-35568,
-39711,
-43860,
-47632,
-51123,
-54129,
-57143,
-59861,
-63056,
-65534,
-65534,
-65534,
-65533,
-65534,
-65531,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65531,
-65534,
-65531,
-65534,
-65533,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65531,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-61556,
-57611,
-53424,
-49425,
-45156,
-41136,
-37231,
-33560,
-30124,
-26486,
-22702,
-18405,
-14199,
-9663,
-5909,
-2188,
-65535,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-0,
-65535,
-1,
-65535,
-3,
-65535,
-1,
-65535,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-65535,
-2,
-65535,
-2,
-2979,
-6436,
-9718,
-12640,
-15579,
-18215,
-20937,
-23551,
-26296,
-28993,
-31866,
-34753,
-37779,
-40799,
-43460,
-46024,
-48138,
-49957,
-51887,
-53418,
-55238,
-56854,
-58643,
-60315,
-62022,
-63614,
-64772,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65533,
-65534,
-65531,
-65534,
-65532,
-65534,
-65300,
-65064,
-65355,
-65533,
-65534,
-65531,
-65534,
-65533,
-65534,
-65534,
-65534,
-65328,
-64192,
-62978,
-61919,
-61581,
-61363,
-61766,
-61892,
-62161,
-61841,
-61551,
-60760,
-59993,
-58911,
-57802,
-56586,
-55320,
-54289,
-53232,
-52258,
-51039,
-49538,
-47633,
-45576,
-43302,
-41193,
-39024,
-37020,
-34986,
-32924,
-30946,
-28726,
-26879,
-24818,
-23103,
-21463,
-19987,
-18427,
-16870,
-15417,
-13992,
-13119,
-12250,
-11691,
-10957,
-10081,
-8975,
-7680,
-6650,
-5936,
-5806,
-5963,
-6571,
-7283,
-8262,
-9132,
-10321,
-11033,
-11931,
-12250,
-12591,
-12803,
-13358,
-14122,
-15551,
-16842,
-18403,
-19429,
-20596,
-21040,
-21808,
-22338,
-22809,
-23421,
-23735,
-23998,
-24082,
-24367,
-24504,
-24791,
-25109,
-25373,
-25821,
-26114,
-26481,
-26642,
-26877,
-26799,
-26720,
-26641,
-26428,
-26537,
-26294,
-26354,
-26215,
-26458,
-26691,
-27329,
-27907,
-28596,
-29201,
-29651,
-30022,
-30310,
-30339,
-30363,
-29968,
-29414,
-28727,
-27802,
-27328,
-26534,
-25901,
-24873,
-23601,
-21731,
-19799,
-17373,
-15206,
-12696,
-10375,
-7784,
-5331,
-2820,
-418,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-4168,
-13171,
-21916,
-30177,
-37998,
-45546,
-53077,
-60599,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65301,
-62264,
-58911,
-55003,
-51038,
-46847,
-42534,
-38210,
-33610,
-29071,
-24422,
-19774,
-15287,
-10715,
-6202,
-1712,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-2,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-2,
-65535,
-3,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-3,
-65535,
-4,
-65535,
-2850,
-8287,
-13752,
-19195,
-24659,
-29836,
-35092,
-40293,
-45600,
-51122,
-56506,
-62080,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65530,
-65534,
-65531,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65531,
-65534,
-65530,
-65534,
-65531,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-61947,
-55794,
-49933,
-44174,
-38763,
-33241,
-28201,
-23231,
-18748,
-14701,
-11010,
-7784,
-4856,
-2343,
-157,
-65535,
-3,
-65535,
-0,
-0,
-65535,
-1,
-65535,
-0,
-0,
-65535,
-3,
-65535,
-3,
-65535,
-2,
-65535,
-0,
-0,
-65535,
-2,
-65535,
-1,
-65535,
-0,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-65535,
-3881,
-8072,
-12278,
-16709,
-21281,
-25901,
-30708,
-35432,
-40191,
-44832,
-49248,
-53443,
-57380,
-60811,
-64351,
-65534,
-65534,
-65534,
-65532,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65532,
-65534,
-65531,
-65534,
-65533,
-65534,
-65534,
-65534,
-64746,
-61975,
-58883,
-55558,
-52598,
-49432,
-46841,
-43859,
-40769,
-37624,
-34223,
-31127,
-28147,
-25373,
-22652,
-19934,
-17293,
-14702,
-12515,
-10240,
-8076,
-5701,
-2977,
-129,
-65535,
-65535,
-0,
-65535,
-65535,
-3,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-2,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-0,
-4801,
-16368,
-28490,
-40952,
-52230,
-62371,
-65533,
-65534,
-65530,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65531,
-65534,
-65531,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-64061,
-60864,
-57459,
-53841,
-49957,
-45919,
-41534,
-37520,
-33271,
-29834,
-26033,
-22655,
-18768,
-14787,
-10397,
-5886,
-1579,
-65535,
-0,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-65535,
-65535,
-65535,
-1,
-65535,
-0,
-0,
-65535,
-1,
-65535,
-1,
-65535,
-2,
-65535,
-3,
-65535,
-0,
-3746,
-9025,
-14125,
-18691,
-22996,
-26933,
-30757,
-34170,
-37650,
-40665,
-43488,
-45997,
-48163,
-49641,
-50884,
-51119,
-51175,
-50405,
-49723,
-48558,
-47554,
-46581,
-45730,
-45526,
-45545,
-46184,
-46920,
-47267,
-47501,
-47081,
-46789,
-46525,
-46765,
-47341,
-48352,
-49875,
-51520,
-53627,
-55451,
-57513,
-59067,
-60973,
-62631,
-65119,
-65532,
-65534,
-65531,
-65534,
-65533,
-65534,
-65534,
-65533,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-61392,
-56694,
-52229,
-47555,
-42882,
-38021,
-33296,
-28675,
-24342,
-20145,
-16288,
-12645,
-9317,
-6333,
-3878,
-1552,
-0,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-65535,
-0,
-1869,
-4645,
-7414,
-10295,
-13410,
-16447,
-19669,
-22627,
-25240,
-27910,
-30071,
-32505,
-34456,
-36227,
-37151,
-37704,
-37338,
-37069,
-36494,
-36038,
-35912,
-35486,
-35567,
-35566,
-36069,
-36752,
-37604,
-38598,
-39638,
-40949,
-42489,
-44436,
-46739,
-49456,
-52362,
-55688,
-59097,
-63028,
-65534,
-65533,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-61285,
-55506,
-49112,
-42777,
-36093,
-29652,
-23128,
-16843,
-10638,
-4670,
-65535,
-0,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-1,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-4,
-65535,
-4,
-65535,
-1,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-3,
-65535,
-4,
-65535,
-1,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-1,
-65535,
-2,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-2,
-65535,
-65535,
-2823,
-11241,
-20149,
-28802,
-37788,
-47077,
-57197,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65531,
-65534,
-65530,
-65534,
-65533,
-65534,
-65532,
-65534,
-65531,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65532,
-65534,
-65531,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-64455,
-59995,
-55132,
-49698,
-43960,
-38131,
-32528,
-27273,
-22657,
-18291,
-14154,
-9869,
-5595,
-1051,
-0,
-65535,
-2,
-65535,
-1,
-65535,
-0,
-65535,
-0,
-65535,
-2,
-65535,
-2,
-65535,
-65535,
-3,
-65535,
-3,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-1526,
-5384,
-8708,
-11431,
-13805,
-15551,
-17370,
-18773,
-20301,
-21333,
-22442,
-23180,
-23817,
-24527,
-24791,
-25191,
-24841,
-24505,
-23655,
-23075,
-22602,
-22942,
-23948,
-25954,
-28937,
-32346,
-36305,
-40030,
-43461,
-46500,
-49008,
-51596,
-54209,
-57327,
-60759,
-64351,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65533,
-62846,
-60443,
-58329,
-56402,
-54448,
-52520,
-50539,
-48798,
-47105,
-45497,
-43963,
-42432,
-41219,
-40107,
-39106,
-37679,
-35855,
-33219,
-30176,
-26855,
-23284,
-19856,
-16102,
-12831,
-9184,
-6229,
-2898,
-1,
-65535,
-1,
-65535,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-2663,
-5936,
-9265,
-12353,
-15393,
-18215,
-21148,
-24158,
-27511,
-31000,
-34772,
-38130,
-41479,
-44416,
-47129,
-49803,
-52071,
-54208,
-56089,
-57638,
-59364,
-60862,
-62451,
-63848,
-64985,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65531,
-65534,
-65532,
-65534,
-65534,
-65533,
-65534,
-64587,
-63321,
-62027,
-60811,
-59520,
-58090,
-56431,
-54260,
-51862,
-48927,
-46130,
-43067,
-40292,
-37310,
-34483,
-31499,
-28490,
-25584,
-22600,
-19934,
-17080,
-14493,
-11561,
-9029,
-6146,
-3668,
-1183,
-65535,
-4,
-65535,
-4,
-65535,
-0,
-0,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-0,
-65535,
-1,
-65535,
-65535,
-65535,
-365,
-2029,
-4141,
-5990,
-7573,
-8343,
-8337,
-7946,
-7098,
-6439,
-5410,
-4562,
-3192,
-1895,
-367,
-65535,
-65535,
-2,
-65535,
-2,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-7181,
-16869,
-27168,
-37284,
-47659,
-57619,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-64931,
-59253,
-53895,
-49824,
-47110,
-46073,
-46713,
-48425,
-50699,
-52468,
-53811,
-54213,
-54841,
-55851,
-58327,
-62001,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-62080,
-54580,
-45389,
-36070,
-26110,
-17083,
-9185,
-2713,
-3,
-65535,
-2,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-3222,
-9577,
-15553,
-21066,
-26404,
-31394,
-36068,
-39924,
-42880,
-44757,
-45892,
-45918,
-45468,
-43913,
-41875,
-39056,
-36117,
-32980,
-30048,
-26983,
-23842,
-20566,
-17002,
-13542,
-9980,
-6303,
-2665,
-65535,
-0,
-65535,
-3,
-65535,
-6,
-65535,
-3,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-65535,
-762,
-7019,
-14362,
-21779,
-28993,
-35935,
-42170,
-48266,
-54107,
-59937,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65531,
-65534,
-65531,
-65534,
-65534,
-65534,
-63984,
-61626,
-59231,
-57220,
-55027,
-52656,
-50639,
-48935,
-48052,
-47903,
-48291,
-49011,
-49718,
-50517,
-50957,
-51151,
-50985,
-50384,
-49826,
-49138,
-48877,
-48268,
-47846,
-46580,
-45255,
-43095,
-41056,
-38529,
-36143,
-33720,
-31578,
-29835,
-28465,
-27141,
-25822,
-24158,
-22099,
-20038,
-17320,
-14650,
-11299,
-7732,
-4062,
-736,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-0,
-2927,
-6940,
-10955,
-15179,
-19987,
-25450,
-31371,
-37253,
-42858,
-47843,
-52099,
-56164,
-59386,
-62529,
-64878,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-64877,
-64880,
-64535,
-65222,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65531,
-65534,
-65533,
-65534,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-64692,
-58358,
-51620,
-44995,
-38578,
-32237,
-26537,
-21119,
-16528,
-12169,
-8261,
-4220,
-287,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-0,
-0,
-65535,
-65535,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-3,
-65535,
-3,
-65535,
-0,
-0,
-65535,
-2,
-65535,
-1,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-2,
-65535,
-2,
-65535,
-65535,
-1,
-65535,
-130,
-3928,
-7918,
-11537,
-15046,
-18059,
-20804,
-23154,
-25163,
-26772,
-28014,
-28964,
-29652,
-30045,
-30102,
-29439,
-28093,
-25558,
-22230,
-17979,
-13543,
-8603,
-3985,
-65535,
-0,
-65535,
-0,
-65535,
-1,
-65535,
-2,
-2634,
-8843,
-14994,
-21518,
-28145,
-35753,
-43671,
-52259,
-61046,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65142,
-58278,
-51621,
-45048,
-38391,
-31738,
-25028,
-18299,
-12059,
-6602,
-2606,
-393,
-366,
-2000,
-5174,
-8364,
-11378,
-13674,
-15577,
-18030,
-21387,
-26455,
-32503,
-39845,
-47080,
-54446,
-60920,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-62607,
-56615,
-49560,
-42435,
-35564,
-30049,
-25768,
-23076,
-21358,
-20252,
-19244,
-18192,
-17106,
-16633,
-16975,
-18983,
-22493,
-27751,
-33849,
-40479,
-46605,
-52203,
-56770,
-60788,
-64138,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-62266,
-56954,
-50859,
-44093,
-37074,
-29861,
-22918,
-16129,
-10059,
-4455,
-3,
-65535,
-2,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-2660,
-6257,
-10846,
-15525,
-20407,
-24714,
-28410,
-31499,
-33929,
-36094,
-37813,
-39604,
-40983,
-42455,
-43360,
-44014,
-44230,
-43672,
-42777,
-41032,
-39026,
-36648,
-33904,
-31314,
-28701,
-26508,
-25241,
-24554,
-24925,
-25927,
-27327,
-29123,
-30997,
-33297,
-35961,
-39475,
-43463,
-48372,
-53526,
-58749,
-64010,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65277,
-61180,
-56483,
-52255,
-48056,
-44283,
-41083,
-38104,
-35961,
-34008,
-32901,
-32025,
-31792,
-31763,
-31948,
-32478,
-33268,
-34615,
-36625,
-39260,
-42383,
-45862,
-49143,
-52465,
-55294,
-57933,
-60363,
-62845,
-65488,
-65532,
-65534,
-65531,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-64270,
-62028,
-60522,
-59147,
-57777,
-55686,
-52999,
-49928,
-46557,
-43668,
-41328,
-39577,
-38763,
-38260,
-38522,
-39214,
-40343,
-41933,
-43672,
-45601,
-47424,
-49457,
-51542,
-53552,
-55818,
-57936,
-60309,
-62635,
-64931,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-64374,
-61791,
-59121,
-56269,
-53631,
-50961,
-47794,
-43989,
-38947,
-33057,
-26695,
-20327,
-14839,
-10001,
-6256,
-2952,
-127,
-1,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-1211,
-5857,
-10770,
-15788,
-20750,
-25401,
-29385,
-32795,
-35328,
-37521,
-39368,
-41193,
-42879,
-44230,
-44834,
-44466,
-42723,
-39660,
-35565,
-30656,
-25425,
-20382,
-15366,
-10819,
-6100,
-1495,
-5,
-65535,
-3,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-0,
-65535,
-0,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-2239,
-6307,
-10003,
-13596,
-16605,
-19274,
-21463,
-23024,
-24210,
-24766,
-25347,
-25663,
-26139,
-26139,
-25610,
-24265,
-22255,
-19803,
-17212,
-14758,
-12300,
-10216,
-8180,
-6441,
-5038,
-3666,
-2319,
-973,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-3,
-65535,
-1,
-65535,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-2,
-65535,
-1,
-65535,
-0,
-65535,
-4145,
-8916,
-13335,
-17556,
-21488,
-25378,
-28960,
-32585,
-35672,
-38364,
-40110,
-40794,
-40294,
-38736,
-36251,
-33218,
-29941,
-26693,
-23842,
-21543,
-19907,
-18931,
-18452,
-18271,
-18242,
-18561,
-19218,
-21256,
-24261,
-29258,
-35485,
-43014,
-50935,
-58938,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65531,
-65534,
-65530,
-65534,
-65531,
-65534,
-65532,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-63344,
-59600,
-55925,
-52917,
-51279,
-50962,
-52149,
-54027,
-55925,
-57592,
-58012,
-57960,
-57009,
-56006,
-54976,
-54211,
-53839,
-53578,
-53495,
-53208,
-52493,
-51254,
-49085,
-46183,
-42195,
-37545,
-32111,
-26239,
-20070,
-13856,
-7787,
-1949,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-2,
-65535,
-2798,
-7571,
-12726,
-18057,
-23049,
-27540,
-30811,
-33059,
-33955,
-34008,
-33217,
-32159,
-30733,
-29521,
-28434,
-27725,
-27274,
-26930,
-26748,
-26427,
-26274,
-26056,
-26301,
-26954,
-28360,
-30600,
-33560,
-37573,
-41983,
-47134,
-52387,
-57538,
-62264,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65533,
-65534,
-64797,
-61924,
-58934,
-56721,
-54738,
-53285,
-52309,
-51333,
-50880,
-50279,
-50008,
-50198,
-50618,
-51807,
-53075,
-54790,
-56272,
-57905,
-59388,
-60836,
-62082,
-63028,
-63720,
-63925,
-64061,
-63770,
-63135,
-62240,
-60282,
-58092,
-54819,
-51461,
-47454,
-43643,
-39424,
-35725,
-31921,
-28569,
-25162,
-22177,
-19036,
-16341,
-13490,
-11244,
-8896,
-7150,
-5675,
-4747,
-4697,
-5488,
-7203,
-9768,
-12670,
-15735,
-18638,
-21071,
-23415,
-25298,
-27112,
-28704,
-30045,
-31209,
-32188,
-32818,
-33191,
-32951,
-32082,
-30441,
-28096,
-25238,
-22206,
-19008,
-15946,
-12934,
-9979,
-7308,
-4936,
-3294,
-2267,
-2189,
-2421,
-3512,
-4533,
-6258,
-7941,
-10508,
-13276,
-16819,
-20538,
-24689,
-28673,
-32397,
-35699,
-38153,
-40347,
-41719,
-42987,
-43780,
-44067,
-43914,
-42614,
-40930,
-38152,
-35199,
-31471,
-27566,
-23339,
-18982,
-14785,
-10716,
-6913,
-3484,
-308,
-3,
-65535,
-65535,
-2,
-65535,
-3,
-65535,
-65535,
-65535,
-65535,
-2240,
-5357,
-8973,
-12380,
-15841,
-18796,
-21599,
-24024,
-26193,
-28383,
-30100,
-31975,
-33058,
-34191,
-34514,
-34770,
-34408,
-33689,
-32662,
-30946,
-29333,
-27196,
-25373,
-23445,
-21571,
-20012,
-18427,
-17373,
-16445,
-16080,
-15866,
-16235,
-16659,
-17714,
-18903,
-20463,
-22281,
-24239,
-26560,
-29071,
-32054,
-34773,
-37919,
-40422,
-42990,
-45097,
-46950,
-48610,
-49855,
-50775,
-51174,
-51280,
-51012,
-50384,
-49429,
-48241,
-46555,
-44673,
-42119,
-39261,
-35647,
-31842,
-27408,
-23205,
-18588,
-14519,
-9845,
-5938,
-1368,
-65535,
-1,
-65535,
-2,
-65535,
-1,
-65535,
-0,
-65535,
-0,
-0,
-65535,
-0,
-65535,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-0,
-416,
-5596,
-10266,
-14493,
-18192,
-21225,
-23657,
-25005,
-25079,
-23450,
-20034,
-14998,
-8946,
-2346,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-1,
-65535,
-7627,
-17478,
-28883,
-41484,
-54446,
-65534,
-65532,
-65534,
-65531,
-65534,
-65532,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65531,
-65534,
-65531,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65533,
-60336,
-51096,
-41798,
-32978,
-24847,
-17208,
-10670,
-4612,
-2,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-1,
-1023,
-6177,
-11269,
-16371,
-21118,
-25085,
-28541,
-31156,
-33349,
-34720,
-35462,
-35380,
-33826,
-31364,
-27119,
-22096,
-15974,
-9607,
-3269,
-65535,
-0,
-65535,
-1,
-65535,
-3,
-65535,
-1,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-1,
-2898,
-9795,
-16841,
-23422,
-29594,
-34936,
-39473,
-43199,
-46181,
-48534,
-50590,
-52153,
-53918,
-55055,
-56192,
-56585,
-56351,
-55371,
-53866,
-51703,
-49640,
-47161,
-45178,
-42986,
-41378,
-39736,
-38474,
-37519,
-36569,
-35965,
-35273,
-34934,
-34432,
-34376,
-34195,
-34481,
-34829,
-35698,
-36887,
-38551,
-40344,
-42329,
-44174,
-45865,
-47530,
-48849,
-50328,
-51385,
-52124,
-52572,
-52362,
-51966,
-50803,
-49378,
-47397,
-44993,
-42380,
-39555,
-36753,
-34010,
-31366,
-28437,
-25717,
-22547,
-19721,
-17135,
-15046,
-13545,
-12641,
-12225,
-12379,
-12987,
-14099,
-15627,
-17345,
-19169,
-20855,
-22206,
-23285,
-23897,
-24286,
-24375,
-24127,
-23845,
-23179,
-22548,
-21940,
-21359,
-21042,
-20831,
-20910,
-21016,
-21518,
-21885,
-22814,
-23469,
-24873,
-26060,
-27748,
-29415,
-31313,
-33349,
-35382,
-37651,
-39688,
-41639,
-43303,
-44547,
-45704,
-46528,
-47607,
-48427,
-49562,
-50461,
-51463,
-52335,
-53208,
-54340,
-55295,
-56268,
-56984,
-57352,
-57538,
-57380,
-57483,
-57511,
-57750,
-58011,
-57989,
-57720,
-56931,
-55742,
-54210,
-52440,
-50673,
-48821,
-47188,
-45889,
-44811,
-44280,
-43858,
-43886,
-43751,
-44150,
-44122,
-44650,
-44863,
-45416,
-46076,
-46818,
-47763,
-48590,
-49400,
-49882,
-50036,
-49906,
-49193,
-48400,
-46975,
-45469,
-43620,
-41561,
-39448,
-37205,
-34984,
-32663,
-30309,
-27752,
-25134,
-22495,
-19854,
-17582,
-15551,
-14175,
-13093,
-12619,
-12274,
-12197,
-12274,
-12196,
-12326,
-12224,
-12248,
-12274,
-12277,
-12324,
-12490,
-12747,
-13333,
-14122,
-14916,
-15920,
-16683,
-17453,
-18293,
-18905,
-19932,
-20541,
-21439,
-22176,
-22945,
-23734,
-24503,
-25188,
-25743,
-26005,
-26142,
-25818,
-25430,
-24577,
-23712,
-22598,
-21415,
-20326,
-19089,
-18191,
-17027,
-16132,
-15098,
-14205,
-13117,
-12016,
-10473,
-8820,
-6700,
-4539,
-2081,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-2,
-65535,
-2,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-1,
-65535,
-3,
-65535,
-2,
-601,
-6598,
-12195,
-17530,
-22310,
-26852,
-30522,
-33771,
-36042,
-37625,
-37970,
-36649,
-33666,
-28752,
-22548,
-15786,
-8816,
-2822,
-65535,
-65535,
-1,
-65535,
-3,
-65535,
-0,
-2953,
-8365,
-13995,
-20352,
-27751,
-36465,
-46629,
-57594,
-65531,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65531,
-65534,
-65531,
-65534,
-63370,
-61660,
-60836,
-61633,
-62843,
-64828,
-65533,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65531,
-65534,
-65531,
-65534,
-65534,
-62448,
-55690,
-48716,
-41008,
-33611,
-26246,
-19614,
-13570,
-8366,
-4010,
-418,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-232,
-4116,
-8841,
-13516,
-18165,
-21859,
-24530,
-25689,
-25531,
-24133,
-21674,
-18826,
-15205,
-11825,
-7708,
-3797,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-65535,
-65535,
-5699,
-12144,
-18664,
-25163,
-31419,
-37469,
-43065,
-47926,
-52149,
-55215,
-57325,
-58305,
-58301,
-57540,
-56108,
-54531,
-52886,
-51336,
-50165,
-48932,
-47632,
-46132,
-43936,
-41772,
-39000,
-36569,
-34088,
-32240,
-30705,
-29944,
-29517,
-29732,
-29967,
-30576,
-31128,
-32003,
-32820,
-33823,
-34853,
-35990,
-37281,
-38948,
-40874,
-43356,
-45866,
-48559,
-51093,
-53420,
-55343,
-56773,
-57617,
-57722,
-57406,
-56401,
-55135,
-53576,
-51702,
-49482,
-46817,
-43884,
-40716,
-37574,
-34746,
-32241,
-30257,
-28754,
-27723,
-27037,
-26850,
-26934,
-27589,
-28516,
-29890,
-31760,
-34013,
-36856,
-39716,
-43010,
-45974,
-48978,
-51494,
-53653,
-55188,
-56217,
-56507,
-56351,
-55819,
-55136,
-54525,
-53948,
-53575,
-52733,
-52096,
-50936,
-50301,
-49907,
-50222,
-51095,
-52281,
-53577,
-54580,
-55715,
-56693,
-57854,
-58963,
-59943,
-60623,
-61001,
-61100,
-60970,
-60735,
-60492,
-60208,
-59806,
-59175,
-58410,
-57509,
-56642,
-55952,
-55504,
-55319,
-55558,
-55897,
-56619,
-57557,
-58600,
-59461,
-60100,
-59889,
-59384,
-58279,
-57378,
-56639,
-56640,
-56641,
-56795,
-56089,
-54602,
-52048,
-48636,
-45127,
-41454,
-38526,
-35696,
-33324,
-31207,
-29124,
-27301,
-25346,
-23604,
-21623,
-19643,
-17502,
-15235,
-13276,
-11695,
-10875,
-11085,
-12225,
-14437,
-17084,
-20194,
-22999,
-25582,
-27699,
-29412,
-30946,
-32475,
-34248,
-36198,
-38632,
-41005,
-43515,
-45470,
-46815,
-47160,
-46499,
-45074,
-43064,
-41194,
-39075,
-37340,
-35510,
-33562,
-31788,
-29784,
-28014,
-26111,
-24002,
-21516,
-18929,
-16186,
-14198,
-12438,
-11664,
-11115,
-11218,
-11218,
-11536,
-11640,
-11749,
-11956,
-12197,
-12775,
-13596,
-14836,
-16236,
-17821,
-19377,
-20806,
-22230,
-23523,
-24636,
-25687,
-26538,
-27141,
-27643,
-27962,
-27935,
-27695,
-26645,
-24970,
-22659,
-19850,
-16873,
-13830,
-10772,
-7651,
-4460,
-1104,
-65535,
-65535,
-65535,
-1,
-65535,
-3,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-65535,
-65535,
-65535,
-65535,
-4010,
-7996,
-10876,
-13303,
-14390,
-14860,
-14258,
-13145,
-10796,
-8023,
-4485,
-1024,
-2,
-65535,
-3,
-65535,
-3,
-3689,
-9215,
-15414,
-22893,
-30600,
-39028,
-47579,
-56696,
-65531,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65531,
-65534,
-65532,
-65534,
-65534,
-65531,
-65534,
-65530,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-61155,
-55820,
-50435,
-45152,
-39924,
-34826,
-29229,
-23655,
-17427,
-11190,
-4935,
-65535,
-65535,
-65535,
-2,
-65535,
-4,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-1,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-1,
-65535,
-65535,
-2,
-65535,
-3,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-1448,
-7493,
-13598,
-19455,
-24900,
-30178,
-34642,
-39105,
-42723,
-46209,
-49033,
-51386,
-53390,
-54687,
-56058,
-57061,
-58331,
-59570,
-61156,
-62634,
-64534,
-65534,
-65531,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65531,
-65534,
-65531,
-65534,
-65534,
-65534,
-65533,
-65534,
-65531,
-65534,
-65532,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-64878,
-62634,
-60312,
-58274,
-56010,
-54046,
-51786,
-49929,
-48006,
-46234,
-44202,
-42088,
-39265,
-36410,
-32900,
-29466,
-25663,
-21809,
-17818,
-13836,
-9975,
-6149,
-2558,
-65535,
-1,
-65535,
-1,
-65535,
-2,
-65535,
-2,
-65535,
-2,
-65535,
-2,
-65535,
-157,
-5063,
-10242,
-15102,
-19692,
-23660,
-26849,
-29653,
-31367,
-32819,
-33244,
-33187,
-32560,
-31311,
-30049,
-28146,
-26428,
-24292,
-22467,
-20699,
-19168,
-18268,
-17743,
-18135,
-19460,
-21780,
-25188,
-29256,
-34086,
-38895,
-44306,
-49326,
-54816,
-59784,
-64745,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65531,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65531,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65533,
-64511,
-61550,
-58515,
-55082,
-51648,
-47714,
-43726,
-39501,
-35488,
-31498,
-27647,
-24048,
-20519,
-17553,
-14759,
-12644,
-10822,
-9317,
-8183,
-7071,
-6334,
-5884,
-5645,
-5755,
-5908,
-6071,
-6041,
-5806,
-5092,
-4273,
-2901,
-1578,
-1,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-1,
-65535,
-4,
-65535,
-3,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-3,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-0,
-65535,
-1,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-1,
-65535,
-4,
-65535,
-3,
-65535,
-2,
-65535,
-4,
-65535,
-3,
-4957,
-12832,
-19958,
-26324,
-31632,
-35645,
-38472,
-40002,
-40109,
-39264,
-37229,
-34854,
-31815,
-28835,
-25449,
-22023,
-18371,
-14576,
-10977,
-7710,
-5142,
-3641,
-3401,
-4907,
-7495,
-11642,
-16156,
-21623,
-27353,
-33561,
-39947,
-46002,
-51696,
-56538,
-61338,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65530,
-65534,
-65533,
-65534,
-65534,
-65534,
-64350,
-62399,
-60413,
-58094,
-55899,
-53682,
-51754,
-50462,
-49956,
-50384,
-52041,
-54108,
-56742,
-59337,
-61734,
-63717,
-65382,
-65532,
-65534,
-65531,
-65534,
-65532,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65531,
-63984,
-61444,
-58965,
-56374,
-53261,
-50406,
-47715,
-45416,
-43462,
-41693,
-39845,
-38444,
-37336,
-36993,
-37228,
-37683,
-38229,
-38528,
-38441,
-38316,
-37597,
-36864,
-35747,
-34752,
-33872,
-33062,
-32314,
-31029,
-29250,
-26856,
-24102,
-21309,
-18691,
-16130,
-14071,
-12353,
-11273,
-10953,
-11352,
-12194,
-13597,
-15126,
-17265,
-19407,
-21990,
-24373,
-26980,
-29232,
-31682,
-34010,
-36252,
-38391,
-39927,
-41108,
-41512,
-41530,
-40799,
-39842,
-38367,
-36991,
-35462,
-34218,
-32927,
-31604,
-30206,
-28702,
-27192,
-25984,
-24842,
-24318,
-24212,
-24631,
-25772,
-27220,
-29308,
-31474,
-33848,
-36545,
-39236,
-42354,
-45284,
-48242,
-50961,
-53684,
-56135,
-58888,
-61178,
-63271,
-64639,
-65408,
-65485,
-65013,
-64031,
-62584,
-60863,
-58726,
-56746,
-54737,
-53077,
-51566,
-50252,
-49005,
-47875,
-46867,
-46078,
-45626,
-45497,
-45786,
-46313,
-47319,
-48426,
-49985,
-51571,
-53283,
-54873,
-56321,
-57538,
-58621,
-59279,
-59519,
-59227,
-58515,
-57510,
-56510,
-55210,
-54002,
-52439,
-50646,
-48664,
-46896,
-45125,
-43859,
-42511,
-41430,
-40582,
-39741,
-39367,
-38869,
-38417,
-37944,
-37203,
-36835,
-36437,
-36438,
-36543,
-36623,
-36702,
-36570,
-36781,
-37124,
-37969,
-39211,
-40531,
-41773,
-42827,
-43385,
-44014,
-44072,
-44411,
-44309,
-44228,
-43910,
-43437,
-43064,
-42567,
-42404,
-42381,
-42695,
-43357,
-44122,
-45470,
-46657,
-48560,
-50273,
-52338,
-54365,
-56459,
-58405,
-60234,
-61734,
-62847,
-63690,
-64059,
-64062,
-63979,
-63376,
-63266,
-62873,
-62844,
-62662,
-62395,
-61897,
-60968,
-59969,
-58962,
-58436,
-58330,
-58804,
-59493,
-60310,
-61234,
-62134,
-62816,
-63377,
-63424,
-63032,
-62025,
-60734,
-59122,
-57721,
-56219,
-55237,
-54134,
-53416,
-52442,
-51304,
-49642,
-47582,
-44809,
-42062,
-38789,
-35829,
-33007,
-30467,
-28333,
-26480,
-24768,
-22995,
-21148,
-18878,
-16603,
-14100,
-12035,
-10348,
-9291,
-8735,
-8420,
-8341,
-8285,
-8316,
-8496,
-8421,
-8156,
-7492,
-6205,
-4903,
-3379,
-1999,
-553,
-65535,
-0,
-65535,
-65535,
-3,
-65535,
-4,
-65535,
-1,
-65535,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-3,
-65535,
-3,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-3,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-3,
-65535,
-2,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-3,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-65535,
-2,
-1921,
-7761,
-12775,
-17029,
-20381,
-23024,
-24843,
-25692,
-25899,
-25507,
-24922,
-24186,
-23577,
-22916,
-22470,
-21938,
-21546,
-21093,
-20647,
-20488,
-20723,
-21759,
-23942,
-26724,
-30732,
-34774,
-39555,
-44252,
-49143,
-53838,
-58463,
-62423,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65531,
-65534,
-65531,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65531,
-65534,
-65533,
-65534,
-65533,
-65534,
-65532,
-65534,
-64666,
-61182,
-57801,
-54765,
-51913,
-49588,
-47716,
-45809,
-44469,
-43037,
-42117,
-41535,
-41294,
-41090,
-40842,
-39982,
-38652,
-36889,
-34720,
-32477,
-30206,
-27934,
-26008,
-24156,
-22391,
-20565,
-18140,
-15256,
-11961,
-8363,
-5015,
-1658,
-0,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-4,
-65535,
-4,
-65535,
-2,
-65535,
-2,
-65535,
-2,
-362,
-1741,
-3056,
-4012,
-4667,
-4777,
-4747,
-4327,
-4009,
-3614,
-3216,
-3033,
-2688,
-2504,
-2505,
-2503,
-3033,
-3692,
-5117,
-7022,
-9817,
-13253,
-17424,
-21728,
-26351,
-30522,
-34774,
-38392,
-42063,
-45284,
-48400,
-51174,
-53708,
-56085,
-58199,
-60255,
-61871,
-63372,
-64087,
-64351,
-63927,
-63190,
-62053,
-60970,
-59624,
-58724,
-57884,
-57482,
-57407,
-57351,
-57434,
-57298,
-57248,
-57167,
-57431,
-57541,
-58062,
-58463,
-59122,
-59860,
-60867,
-61920,
-62872,
-63558,
-63982,
-64190,
-64274,
-64270,
-64060,
-63533,
-62818,
-61684,
-60627,
-59280,
-57987,
-56508,
-54816,
-52892,
-50879,
-48775,
-46891,
-45234,
-43832,
-42694,
-41801,
-41111,
-40689,
-40506,
-40582,
-40875,
-41376,
-42089,
-42988,
-43988,
-45048,
-46076,
-47028,
-47899,
-48689,
-49353,
-49719,
-49907,
-49510,
-48795,
-47768,
-46393,
-44835,
-42855,
-40902,
-38548,
-36678,
-34904,
-33772,
-33057,
-32610,
-32421,
-32163,
-31919,
-31423,
-30865,
-29967,
-28913,
-27616,
-26062,
-24605,
-23051,
-21938,
-20912,
-20434,
-20065,
-20119,
-20274,
-20516,
-20804,
-21068,
-21413,
-21832,
-22339,
-23020,
-23791,
-24712,
-25424,
-26274,
-26691,
-27091,
-27142,
-26956,
-26590,
-26348,
-25904,
-26003,
-25983,
-26164,
-26508,
-26722,
-27166,
-27488,
-28091,
-28781,
-29491,
-30710,
-31760,
-33457,
-35036,
-36809,
-38576,
-40030,
-41454,
-42486,
-43198,
-43621,
-43804,
-43730,
-43456,
-43231,
-42771,
-42460,
-41854,
-41213,
-40350,
-39260,
-38025,
-36620,
-35121,
-33371,
-31686,
-29730,
-27987,
-26218,
-24898,
-23578,
-22572,
-21413,
-20540,
-19589,
-19143,
-18848,
-19195,
-19800,
-20673,
-21728,
-22628,
-23708,
-24582,
-25504,
-26165,
-26905,
-27274,
-27540,
-27668,
-27488,
-27299,
-27064,
-26641,
-26348,
-25877,
-25504,
-25162,
-24793,
-24711,
-24292,
-24130,
-23447,
-22599,
-21308,
-19482,
-17293,
-14573,
-11455,
-8052,
-4322,
-396,
-65535,
-3,
-65535,
-2,
-65535,
-3,
-65535,
-3,
-65535,
-2,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-3,
-65535,
-2,
-65535,
-1,
-65535,
-1,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-65535,
-65535,
-65535,
-1,
-65535,
-65535,
-65535,
-1,
-65535,
-3,
-123,
-2904,
-5089,
-6757,
-7997,
-8999,
-9557,
-9949,
-9978,
-10374,
-11245,
-13014,
-15470,
-18402,
-21648,
-24873,
-28673,
-32662,
-37468,
-42589,
-47901,
-53363,
-58728,
-64191,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65532,
-65534,
-65530,
-65534,
-65531,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-64720,
-60073,
-55107,
-50356,
-46207,
-42222,
-38735,
-35065,
-31472,
-27936,
-24685,
-22126,
-20064,
-18614,
-17317,
-15973,
-14202,
-11958,
-8948,
-5488,
-1341,
-0,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-0,
-65535,
-0,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-76,
-4535,
-8581,
-13328,
-18035,
-22965,
-28045,
-32658,
-37287,
-41583,
-45816,
-49850,
-53578,
-56877,
-59677,
-62237,
-64616,
-65532,
-65534,
-65531,
-65534,
-65531,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-63348,
-61602,
-60154,
-58908,
-58017,
-56556,
-55666,
-54101,
-53078,
-52068,
-51308,
-51012,
-50568,
-50697,
-50487,
-50961,
-51095,
-51516,
-51465,
-51304,
-50434,
-49562,
-47953,
-46471,
-44335,
-42246,
-39899,
-37519,
-35171,
-32767,
-30231,
-27937,
-25292,
-23234,
-21149,
-19693,
-18431,
-17738,
-16952,
-16814,
-16449,
-16632,
-16816,
-17214,
-17635,
-17926,
-18191,
-18295,
-18454,
-18640,
-18691,
-18745,
-18587,
-18321,
-17821,
-17398,
-16685,
-15998,
-15260,
-14623,
-14205,
-14095,
-14178,
-14545,
-14968,
-15577,
-16366,
-17295,
-18557,
-20015,
-21806,
-23631,
-25690,
-27828,
-29996,
-32211,
-34168,
-35882,
-37099,
-37889,
-38261,
-38471,
-38365,
-38577,
-38418,
-38815,
-38762,
-39078,
-39105,
-39131,
-39317,
-39184,
-39396,
-39341,
-39766,
-40002,
-40902,
-41507,
-42671,
-43540,
-44546,
-45204,
-45628,
-45522,
-44889,
-43883,
-42250,
-40686,
-38792,
-37227,
-35753,
-34535,
-33403,
-32474,
-31502,
-30654,
-29624,
-28675,
-27510,
-26484,
-25345,
-24267,
-23282,
-21972,
-20720,
-18960,
-17104,
-15024,
-12933,
-10824,
-8788,
-6465,
-4327,
-2001,
-288,
-65535,
-4,
-65535,
-3,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-65535,
-2,
-65535,
-0,
-0,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-65535,
-2,
-65535,
-1,
-65535,
-1,
-65535,
-2,
-65535,
-0,
-5991,
-13514,
-19170,
-23733,
-27118,
-30283,
-32452,
-33637,
-33456,
-32474,
-31634,
-31365,
-31740,
-32316,
-33059,
-33954,
-35621,
-37941,
-40983,
-43274,
-45577,
-46709,
-48770,
-50726,
-53390,
-55505,
-56850,
-57748,
-58305,
-59754,
-61421,
-63795,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65533,
-65534,
-65531,
-65534,
-65533,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-63691,
-61577,
-59758,
-58194,
-56775,
-55370,
-53920,
-52283,
-50566,
-48953,
-47348,
-46152,
-45180,
-44124,
-42851,
-41276,
-39047,
-36758,
-33953,
-31317,
-28566,
-25984,
-23784,
-21839,
-20194,
-18825,
-17187,
-15812,
-14179,
-12879,
-11538,
-10214,
-8603,
-6785,
-4929,
-3354,
-1867,
-604,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-0,
-1710,
-4697,
-7706,
-10901,
-14363,
-17845,
-21412,
-24423,
-27221,
-29757,
-32530,
-35618,
-39186,
-42589,
-46369,
-49851,
-53894,
-57722,
-61764,
-65379,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65533,
-65534,
-65530,
-65534,
-65531,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65531,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-61710,
-57986,
-53787,
-49801,
-45469,
-41614,
-37783,
-34592,
-31707,
-29022,
-26531,
-23870,
-21042,
-18215,
-15208,
-12379,
-9635,
-7046,
-4748,
-2505,
-364,
-1,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-4,
-65535,
-3,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-1475,
-3559,
-5174,
-6725,
-8529,
-10264,
-12675,
-14913,
-17267,
-19483,
-21518,
-23656,
-25956,
-28381,
-30868,
-33108,
-35226,
-36857,
-38659,
-40107,
-41878,
-43383,
-45259,
-46972,
-49195,
-51225,
-53312,
-54898,
-55899,
-56428,
-56668,
-57059,
-57726,
-58458,
-58967,
-59119,
-58807,
-58276,
-57590,
-56694,
-55449,
-53816,
-52096,
-50277,
-48821,
-47240,
-45705,
-43570,
-41480,
-38895,
-36806,
-34564,
-32608,
-30444,
-28462,
-26562,
-24923,
-23923,
-22809,
-22047,
-21042,
-19932,
-18852,
-17528,
-16396,
-14914,
-13571,
-11770,
-10086,
-8233,
-6464,
-4779,
-2789,
-873,
-65535,
-4,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-2,
-65535,
-0,
-0,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-0,
-65535,
-1,
-1446,
-2821,
-4302,
-5854,
-7367,
-8759,
-9822,
-10609,
-11352,
-11851,
-12699,
-13224,
-13939,
-14255,
-14732,
-15100,
-16262,
-17556,
-19907,
-22626,
-25824,
-29596,
-33772,
-38391,
-43172,
-47687,
-51254,
-54181,
-55772,
-57084,
-57119,
-56716,
-55083,
-53048,
-50698,
-48797,
-47237,
-46369,
-45151,
-44281,
-43279,
-42931,
-42885,
-42746,
-42593,
-41638,
-41245,
-40928,
-41533,
-42302,
-42721,
-42750,
-42644,
-43145,
-44466,
-46472,
-48190,
-49800,
-50802,
-52523,
-54391,
-57040,
-58591,
-59334,
-58356,
-56534,
-54500,
-52521,
-50829,
-49483,
-48032,
-47580,
-47372,
-48372,
-49617,
-51146,
-52177,
-52837,
-52968,
-53235,
-53495,
-54053,
-54632,
-55188,
-56110,
-57302,
-58909,
-60681,
-61736,
-62106,
-61629,
-61026,
-60889,
-61659,
-62871,
-64059,
-64801,
-65379,
-65534,
-65534,
-65534,
-65533,
-65534,
-65247,
-64114,
-63321,
-63030,
-62845,
-62291,
-61630,
-60575,
-59888,
-59095,
-58304,
-56770,
-55030,
-52572,
-50645,
-48428,
-46920,
-45233,
-43962,
-42830,
-42062,
-41403,
-40531,
-39209,
-37470,
-35248,
-33059,
-30680,
-28621,
-26588,
-25003,
-23710,
-22678,
-21784,
-20696,
-19433,
-17872,
-16448,
-14889,
-13886,
-13066,
-12857,
-13251,
-14150,
-15418,
-16631,
-17425,
-18005,
-18084,
-18482,
-18770,
-19142,
-19376,
-19276,
-19032,
-18906,
-18796,
-18719,
-18347,
-17717,
-16682,
-15950,
-15042,
-14393,
-13459,
-12013,
-10294,
-8392,
-6810,
-5672,
-5013,
-4906,
-5067,
-5725,
-6730,
-7970,
-9475,
-11087,
-12486,
-13965,
-15338,
-16949,
-18719,
-20777,
-22839,
-24923,
-26615,
-28224,
-29309,
-30495,
-31527,
-32661,
-33690,
-34750,
-35406,
-36070,
-36463,
-36781,
-36966,
-37151,
-37072,
-37151,
-37256,
-37626,
-38234,
-38998,
-39742,
-40342,
-40904,
-41295,
-42089,
-42961,
-44334,
-45732,
-47320,
-48741,
-49987,
-51093,
-51887,
-52439,
-52787,
-52887,
-52971,
-53206,
-53416,
-54028,
-54182,
-54713,
-54420,
-54343,
-53787,
-52996,
-52098,
-50591,
-49431,
-48136,
-47634,
-47399,
-47316,
-47266,
-46631,
-46286,
-45736,
-45916,
-46158,
-46576,
-46740,
-46785,
-46847,
-46944,
-47083,
-47052,
-46791,
-46418,
-46158,
-46048,
-45999,
-45732,
-45154,
-44252,
-43386,
-42535,
-41801,
-41084,
-40241,
-39527,
-38868,
-38391,
-37944,
-37468,
-36541,
-35966,
-35299,
-35515,
-35884,
-36805,
-37366,
-37938,
-38185,
-38151,
-37972,
-37281,
-36492,
-35564,
-34804,
-34217,
-33719,
-33163,
-32080,
-30867,
-29360,
-27802,
-26405,
-25053,
-23844,
-23285,
-23130,
-24024,
-25587,
-27510,
-29388,
-30521,
-31476,
-31892,
-33247,
-34771,
-37177,
-39081,
-40555,
-41351,
-41957,
-42775,
-43833,
-44384,
-44363,
-43407,
-42462,
-41716,
-41483,
-40689,
-39132,
-36069,
-33187,
-30578,
-29675,
-29336,
-29096,
-28198,
-26984,
-26220,
-26188,
-26539,
-26504,
-25192,
-23496,
-21968,
-22334,
-24186,
-27142,
-29149,
-29783,
-28542,
-27143,
-26349,
-26906,
-27907,
-28463,
-27830,
-26903,
-26827,
-28515,
-30865,
-32029,
-30284,
-26192,
-22099,
-20565,
-22602,
-26402,
-28938,
-28542,
-25505,
-22309,
-20833,
-21647,
-23210,
-24499,
-24820,
-25083,
-26006,
-27433,
-28541,
-28807,
-28252,
-28224,
-29203,
-31049,
-33297,
-34483,
-35303,
-35459,
-35674,
-35407,
-34326,
-32687,
-30972,
-30785,
-31924,
-34219,
-35592,
-35674,
-34085,
-32320,
-31657,
-32583,
-34721,
-36333,
-36832,
-35410,
-33664,
-31922,
-31580,
-32026,
-32266,
-32029,
-30309,
-28861,
-27775,
-28225,
-29361,
-30496,
-30522,
-29414,
-27485,
-25347,
-23340,
-21702,
-20197,
-19115,
-18427,
-18349,
-18349,
-18136,
-17585,
-16497,
-16054,
-15732,
-16158,
-16710,
-17294,
-18003,
-18774,
-19798,
-20648,
-20513,
-19776,
-17740,
-15973,
-14360,
-13675,
-13727,
-14150,
-14863,
-15734,
-16659,
-17951,
-19168,
-20858,
-22256,
-23789,
-24529,
-24552,
-23580,
-22016,
-20597,
-19639,
-18934,
-18052,
-16162,
-13301,
-10455,
-8128,
-7654,
-8286,
-9609,
-10451,
-10375,
-9397,
-8127,
-6810,
-5936,
-5462,
-5436,
-5671,
-6495,
-7201,
-7683,
-7809,
-7180,
-6544,
-6333,
-6968,
-9210,
-12487,
-16605,
-20489,
-23444,
-24714,
-24341,
-22391,
-19589,
-17001,
-14997,
-14358,
-14918,
-16315,
-17977,
-19328,
-20354,
-20964,
-21490,
-21889,
-22017,
-22100,
-22099,
-22756,
-24320,
-26981,
-30049,
-32951,
-34934,
-35775,
-36071,
-36250,
-37206,
-38735,
-41031,
-43570,
-46444,
-49247,
-52362,
-55158,
-57568,
-58933,
-59389,
-58778,
-58010,
-57278,
-56952,
-56829,
-56530,
-55982,
-55344,
-55056,
-55346,
-56137,
-57248,
-58012,
-58568,
-58487,
-58226,
-57324,
-56299,
-55026,
-54265,
-54288,
-55267,
-57062,
-58911,
-60151,
-60629,
-59912,
-59017,
-57987,
-57536,
-57566,
-58249,
-58805,
-59440,
-59305,
-58596,
-56955,
-54976,
-52388,
-50092,
-48002,
-46396,
-45441,
-44809,
-44626,
-44596,
-44889,
-45311,
-45917,
-46527,
-46841,
-47108,
-46841,
-46500,
-46050,
-45521,
-45206,
-45047,
-44966,
-45023,
-45150,
-44941,
-44890,
-44330,
-44127,
-43643,
-43281,
-43009,
-42146,
-41266,
-39770,
-38256,
-36836,
-35697,
-35093,
-34666,
-34434,
-33846,
-33194,
-32208,
-31504,
-31125,
-31240,
-31973,
-32819,
-33825,
-34455,
-34671,
-34166,
-33031,
-31287,
-29125,
-27193,
-25640,
-25080,
-25533,
-26613,
-28041,
-28779,
-28807,
-27670,
-26192,
-24396,
-23602,
-23342,
-24474,
-25769,
-27355,
-27985,
-27673,
-26137,
-24423,
-22943,
-22891,
-23842,
-25662,
-27382,
-28434,
-29019,
-29228,
-29783,
-30443,
-31420,
-31923,
-32292,
-32054,
-31552,
-30787,
-29782,
-28570,
-27643,
-26905,
-26800,
-27299,
-27751,
-28329,
-27857,
-27010,
-25266,
-23949,
-22809,
-22972,
-23868,
-25635,
-27434,
-28780,
-29491,
-29416,
-28750,
-28465,
-28752,
-30602,
-33322,
-36200,
-38391,
-38737,
-38072,
-36679,
-36408,
-37207,
-38838,
-40348,
-40293,
-39182,
-36758,
-34560,
-32902,
-32132,
-32292,
-32846,
-33903,
-34774,
-35567,
-35777,
-35672,
-35434,
-35250,
-35117,
-35092,
-34984,
-35093,
-36013,
-38103,
-41033,
-43963,
-45629,
-45257,
-43093,
-40530,
-38975,
-40159,
-43411,
-48294,
-52863,
-55399,
-55795,
-53365,
-50407,
-47845,
-47160,
-48401,
-50276,
-51410,
-50830,
-48505,
-45894,
-43989,
-43595,
-43964,
-44385,
-44099,
-43802,
-43386,
-43566,
-42618,
-40663,
-36912,
-33297,
-31313,
-31950,
-34958,
-38551,
-41243,
-42091,
-41083,
-38289,
-34217,
-29521,
-25715,
-24503,
-26902,
-31793,
-36753,
-38946,
-36863,
-32129,
-26592,
-23496,
-22520,
-23026,
-22834,
-21335,
-19536,
-19114,
-21255,
-25134,
-28067,
-27617,
-23393,
-17503,
-13622,
-13648,
-16844,
-19668,
-19934,
-17291,
-15682,
-18217,
-25055,
-32453,
-35298,
-31002,
-22491,
-14548,
-12407,
-15944,
-22707,
-28488,
-32135,
-33768,
-34831,
-34981,
-33535,
-29705,
-25423,
-22947,
-24392,
-29285,
-35379,
-40559,
-43461,
-44413,
-43516,
-40900,
-36940,
-33110,
-31791,
-34402,
-40086,
-45148,
-46635,
-43408,
-38232,
-34856,
-35563,
-38923,
-41797,
-41008,
-37306,
-32559,
-30257,
-30734,
-33058,
-35223,
-36304,
-36917,
-37807,
-39399,
-40528,
-40507,
-38970,
-37207,
-36382,
-37417,
-40319,
-43541,
-46579,
-47105,
-44943,
-39579,
-32742,
-26956,
-24898,
-27380,
-32530,
-36648,
-36492,
-31577,
-24345,
-18400,
-16105,
-17344,
-19644,
-21780,
-22285,
-23021,
-23791,
-24314,
-23104,
-19087,
-13595,
-9319,
-8892,
-13228,
-19852,
-25215,
-25823,
-21067,
-13015,
-5593,
-2214,
-3931,
-9236,
-14918,
-18107,
-17402,
-13672,
-8210,
-3506,
-365,
-22,
-2161,
-6148,
-10030,
-12064,
-10980,
-7602,
-3691,
-1686,
-2504,
-5118,
-8129,
-9794,
-10450,
-10244,
-9896,
-8737,
-6862,
-4642,
-3878,
-6016,
-11033,
-16263,
-19167,
-17266,
-12249,
-6544,
-3850,
-5411,
-10635,
-16766,
-21886,
-23921,
-23050,
-19615,
-15075,
-11296,
-10137,
-12592,
-18295,
-25427,
-31075,
-33719,
-32636,
-29754,
-27198,
-27219,
-30023,
-35010,
-39818,
-43225,
-44095,
-43332,
-41744,
-40822,
-41006,
-42142,
-43726,
-45258,
-46342,
-46840,
-46713,
-45598,
-43914,
-42034,
-40455,
-40395,
-41300,
-43328,
-45048,
-45681,
-45124,
-43649,
-42669,
-42802,
-44413,
-46605,
-48691,
-49694,
-50144,
-50274,
-50964,
-52307,
-53788,
-55030,
-55502,
-55454,
-55343,
-55294,
-55821,
-56085,
-56560,
-56349,
-55901,
-55160,
-54422,
-54420,
-54793,
-55713,
-56246,
-55818,
-54055,
-51540,
-49037,
-47633,
-47872,
-48825,
-50272,
-50332,
-49586,
-47795,
-46180,
-45260,
-45308,
-46186,
-46970,
-48035,
-48397,
-48693,
-48373,
-47291,
-45313,
-42853,
-40901,
-40610,
-42433,
-45548,
-47847,
-48293,
-45866,
-42380,
-39290,
-37757,
-37891,
-38339,
-38867,
-39053,
-39500,
-39845,
-39236,
-36757,
-32157,
-27541,
-24367,
-24080,
-25981,
-28303,
-29706,
-29859,
-29470,
-29409,
-29497,
-29199,
-27805,
-25899,
-24213,
-23813,
-24583,
-26111,
-27486,
-28437,
-28461,
-27435,
-24843,
-21281,
-17714,
-16210,
-17398,
-20805,
-23813,
-23844,
-19904,
-13704,
-8734,
-7917,
-11828,
-17633,
-21468,
-20406,
-14203,
-7020,
-2266,
-3905,
-10715,
-19169,
-25133,
-25639,
-21940,
-16816,
-13808,
-14174,
-17294,
-21702,
-25345,
-28809,
-30916,
-33059,
-33849,
-34167,
-33217,
-32501,
-31978,
-32684,
-34514,
-37887,
-42170,
-46710,
-49483,
-48743,
-44573,
-38285,
-33851,
-33927,
-39054,
-46789,
-52547,
-52863,
-47133,
-38602,
-31660,
-30230,
-34512,
-41877,
-48030,
-49960,
-47474,
-42699,
-38706,
-36969,
-37359,
-38765,
-40158,
-42276,
-45045,
-48745,
-50961,
-50304,
-45597,
-38977,
-33742,
-33190,
-37865,
-45176,
-50754,
-51328,
-46345,
-38863,
-32771,
-31074,
-33535,
-37149,
-38842,
-37098,
-33137,
-29729,
-28650,
-29832,
-31372,
-31575,
-29997,
-28039,
-27090,
-28092,
-30127,
-32318,
-33614,
-33688,
-32454,
-29884,
-26909,
-24975,
-25980,
-30339,
-35881,
-39451,
-38442,
-33773,
-28751,
-27039,
-29042,
-32161,
-33399,
-31713,
-30416,
-32187,
-37704,
-43173,
-43804,
-38447,
-30494,
-26087,
-28410,
-36040,
-43095,
-45784,
-43278,
-39581,
-37678,
-38999,
-41113,
-42114,
-42012,
-41664,
-42725,
-44041,
-44626,
-43910,
-43701,
-45283,
-49061,
-51782,
-51303,
-47399,
-43646,
-43752,
-48587,
-54763,
-57803,
-55688,
-51016,
-48108,
-48772,
-51542,
-52678,
-51281,
-49718,
-51493,
-56849,
-61842,
-61578,
-54738,
-45946,
-41506,
-44335,
-51488,
-56564,
-56373,
-51913,
-48717,
-48822,
-50806,
-50301,
-45573,
-39688,
-38020,
-42514,
-50432,
-54845,
-52202,
-43912,
-36015,
-33084,
-35223,
-39343,
-41507,
-42091,
-42508,
-44127,
-44857,
-41460,
-32869,
-22523,
-16341,
-18533,
-27883,
-38312,
-42749,
-37917,
-26007,
-13252,
-5725,
-5991,
-12406,
-20329,
-25612,
-25821,
-22019,
-16950,
-13144,
-12225,
-13382,
-14970,
-15838,
-15366,
-14624,
-14362,
-15179,
-16580,
-17608,
-17400,
-15917,
-13702,
-12248,
-12328,
-14546,
-17292,
-19062,
-18084,
-14151,
-9527,
-6334,
-6596,
-9689,
-12880,
-14152,
-12405,
-9767,
-8156,
-9050,
-10932,
-11797,
-10427,
-7390,
-5381,
-5912,
-9159,
-13434,
-16874,
-18740,
-19383,
-19111,
-18351,
-16498,
-14601,
-13592,
-14787,
-18055,
-21864,
-24525,
-25560,
-25609,
-25928,
-26299,
-25397,
-22364,
-18084,
-15337,
-17163,
-23072,
-30368,
-33873,
-31132,
-23629,
-15365,
-11403,
-13147,
-18823,
-24555,
-27328,
-26189,
-22656,
-19218,
-17452,
-18348,
-21174,
-24819,
-27617,
-28596,
-27220,
-24371,
-21226,
-19643,
-19933,
-22124,
-25058,
-27272,
-28096,
-26954,
-24108,
-20592,
-17319,
-15814,
-16895,
-19908,
-24078,
-26984,
-27751,
-25636,
-22336,
-18614,
-16313,
-15605,
-16920,
-20225,
-25188,
-30627,
-34354,
-33873,
-28625,
-19955,
-12780,
-10557,
-15681,
-25268,
-34985,
-39395,
-36941,
-29464,
-21519,
-17291,
-18219,
-23258,
-29151,
-33664,
-35593,
-35752,
-35354,
-34961,
-34297,
-32794,
-30734,
-29386,
-30208,
-33742,
-38526,
-42378,
-43488,
-41062,
-36804,
-32005,
-28803,
-28306,
-30653,
-35938,
-42034,
-46475,
-46550,
-41721,
-34191,
-28386,
-27748,
-32530,
-39792,
-44649,
-44810,
-41087,
-36937,
-35621,
-37756,
-41299,
-43461,
-42935,
-40820,
-39660,
-40901,
-44307,
-47160,
-47501,
-44731,
-41058,
-39528,
-42274,
-48295,
-53867,
-55345,
-50856,
-42698,
-35617,
-34116,
-39632,
-49378,
-57617,
-59623,
-54078,
-44334,
-35830,
-32847,
-36280,
-43038,
-48719,
-50934,
-49352,
-46553,
-43882,
-42039,
-40185,
-38553,
-37782,
-39635,
-43699,
-48348,
-50593,
-48953,
-44309,
-39632,
-36466,
-36225,
-36967,
-38286,
-39632,
-41325,
-43328,
-43914,
-42114,
-37864,
-33242,
-31341,
-32609,
-36491,
-39395,
-40003,
-38022,
-35567,
-34060,
-33612,
-32875,
-31469,
-29287,
-28272,
-29101,
-31048,
-33059,
-33215,
-32028,
-30206,
-28384,
-27194,
-26298,
-26428,
-28782,
-32818,
-37627,
-39315,
-36809,
-31129,
-26324,
-26297,
-30759,
-36467,
-38706,
-36915,
-33241,
-32689,
-35672,
-39527,
-39422,
-34140,
-27090,
-24237,
-28094,
-36120,
-42195,
-42009,
-36571,
-30495,
-27646,
-29068,
-31500,
-33481,
-34641,
-36809,
-39816,
-41404,
-39104,
-33586,
-29308,
-30468,
-38316,
-46786,
-50410,
-45336,
-36173,
-29944,
-32237,
-41429,
-51439,
-55264,
-51545,
-44175,
-39394,
-40613,
-46469,
-52286,
-53996,
-51123,
-46339,
-44044,
-46024,
-51542,
-56377,
-57536,
-53656,
-47503,
-42961,
-43461,
-49168,
-56770,
-62080,
-61578,
-55847,
-47768,
-41956,
-41218,
-45521,
-52151,
-57036,
-57035,
-52046,
-44014,
-37445,
-35298,
-38528,
-44516,
-49484,
-49906,
-45811,
-39609,
-35273,
-35385,
-39208,
-44229,
-46711,
-45019,
-40242,
-34905,
-31922,
-32504,
-35327,
-38659,
-39999,
-39399,
-37096,
-34932,
-33324,
-32342,
-31555,
-30627,
-30099,
-30841,
-32053,
-33718,
-33270,
-31419,
-27830,
-25186,
-24319,
-26058,
-29362,
-32318,
-34112,
-34011,
-32817,
-30869,
-29384,
-28148,
-28540,
-29548,
-32158,
-34352,
-35989,
-34984,
-32189,
-27431,
-23526,
-21357,
-22787,
-26956,
-32688,
-36994,
-37915,
-34538,
-28329,
-22601,
-20778,
-24369,
-31553,
-38788,
-41666,
-39767,
-34560,
-29918,
-27800,
-28729,
-30969,
-33774,
-36619,
-39082,
-39604,
-36280,
-29098,
-21383,
-18906,
-24077,
-34748,
-43119,
-42327,
-32212,
-18852,
-11982,
-15445,
-26139,
-35486,
-36915,
-31313,
-23683,
-20991,
-23205,
-27224,
-27115,
-22203,
-15921,
-13673,
-18138,
-27089,
-34590,
-35619,
-28700,
-17082,
-6834,
-3190,
-8000,
-18688,
-29364,
-33688,
-28466,
-15863,
-2058,
-65535,
-0,
-7996,
-18851,
-24077,
-21257,
-14304,
-8318,
-6778,
-8580,
-10215,
-9844,
-8501,
-9473,
-13624,
-19403,
-22100,
-19906,
-13885,
-8791,
-7995,
-11906,
-17504,
-22097,
-24002,
-24314,
-23210,
-20829,
-17162,
-14307,
-14731,
-20514,
-28780,
-33928,
-31791,
-22573,
-13041,
-10507,
-17263,
-29073,
-37755,
-38079,
-31496,
-24399,
-22176,
-25664,
-30839,
-32953,
-31102,
-27963,
-27696,
-31287,
-36836,
-40160,
-39026,
-34088,
-28092,
-24159,
-23735,
-26483,
-30548,
-33930,
-34403,
-31237,
-25503,
-19223,
-16365,
-18430,
-25398,
-33349,
-37890,
-35620,
-27299,
-17189,
-11585,
-14391,
-25185,
-38236,
-46551,
-45284,
-36068,
-24581,
-18428,
-20751,
-29494,
-38760,
-43411,
-41639,
-36306,
-30972,
-28329,
-28624,
-30783,
-33484,
-36091,
-37576,
-37044,
-34299,
-30417,
-27749,
-28384,
-31870,
-35671,
-36597,
-34192,
-30312,
-29069,
-31792,
-37043,
-40506,
-38840,
-32081,
-23920,
-19300,
-20803,
-28016,
-36277,
-41854,
-41267,
-35622,
-27062,
-20409,
-18507,
-22600,
-30812,
-39002,
-43644,
-42647,
-37570,
-31898,
-28646,
-29336,
-32343,
-35831,
-37864,
-39025,
-39898,
-41376,
-42273,
-41536,
-38232,
-34088,
-31447,
-32634,
-37628,
-43778,
-47450,
-46340,
-40743,
-34377,
-30815,
-32368,
-37735,
-43222,
-45444,
-43568,
-39447,
-36412,
-35646,
-36649,
-36807,
-35303,
-33189,
-33031,
-35832,
-40555,
-43596,
-42590,
-37547,
-30945,
-26297,
-24951,
-27511,
-32187,
-37810,
-42038,
-42721,
-38182,
-29808,
-21572,
-19245,
-25084,
-35512,
-43781,
-42826,
-33773,
-22598,
-17876,
-22096,
-30814,
-35989,
-33295,
-25136,
-19140,
-20145,
-27300,
-33534,
-33241,
-25638,
-16289,
-12010,
-15524,
-24394,
-33192,
-37201,
-35437,
-29490,
-22708,
-17688,
-17080,
-20937,
-28278,
-34695,
-36571,
-32263,
-24794,
-19774,
-21544,
-28886,
-36673,
-38079,
-32393,
-23608,
-19507,
-24107,
-35144,
-45495,
-48084,
-41746,
-31208,
-24291,
-25532,
-33981,
-43991,
-48744,
-46207,
-38447,
-31497,
-29891,
-34720,
-42063,
-47556,
-47606,
-43174,
-37968,
-35144,
-36597,
-40451,
-44439,
-46580,
-46417,
-44759,
-42510,
-40928,
-41323,
-44676,
-50251,
-55555,
-56668,
-52835,
-45760,
-41456,
-43541,
-51148,
-59147,
-61578,
-57643,
-51835,
-49559,
-52815,
-57532,
-58468,
-54284,
-49116,
-49112,
-55584,
-64061,
-65534,
-62503,
-54156,
-49432,
-51884,
-58174,
-61285,
-58015,
-51752,
-48983,
-53839,
-61922,
-65534,
-60624,
-49223,
-40051,
-40060,
-49005,
-59730,
-64747,
-60733,
-51595,
-43277,
-40558,
-43383,
-49246,
-54844,
-57668,
-56720,
-51596,
-44279,
-38078,
-37069,
-42513,
-51516,
-58012,
-57090,
-48980,
-39106,
-33955,
-36252,
-42435,
-46655,
-44810,
-38788,
-33743,
-34116,
-38946,
-43672,
-42857,
-36065,
-27199,
-22201,
-24266,
-31920,
-39688,
-42853,
-39239,
-31445,
-23551,
-20225,
-22598,
-29469,
-36250,
-38949,
-35089,
-26721,
-18084,
-14493,
-17927,
-25583,
-32425,
-33453,
-28330,
-20727,
-15283,
-14839,
-17792,
-20515,
-20461,
-18136,
-16238,
-16842,
-19405,
-21255,
-20035,
-16108,
-11321,
-8633,
-8681,
-11010,
-14067,
-16715,
-18372,
-18034,
-14730,
-9475,
-4591,
-4193,
-9450,
-17953,
-23920,
-22838,
-15576,
-8208,
-7099,
-14175,
-24372,
-30255,
-27437,
-18661,
-11143,
-10740,
-17664,
-26402,
-30734,
-28648,
-22599,
-17900,
-17663,
-21384,
-26088,
-28830,
-28437,
-25928,
-22653,
-20673,
-20697,
-23289,
-27166,
-30051,
-29937,
-26064,
-20827,
-17956,
-19851,
-25771,
-31577,
-32901,
-28699,
-21887,
-17452,
-19008,
-25135,
-31871,
-34005,
-30315,
-23469,
-18139,
-18452,
-24081,
-31736,
-36809,
-36330,
-31634,
-25661,
-23078,
-25159,
-31001,
-36645,
-39163,
-37383,
-32957,
-29383,
-28412,
-31103,
-35064,
-37944,
-37837,
-34615,
-30181,
-26902,
-26802,
-29992,
-34723,
-37624,
-36203,
-30441,
-23394,
-19324,
-21518,
-28226,
-35698,
-38629,
-35566,
-28939,
-22943,
-21096,
-22995,
-26615,
-29888,
-32134,
-34115,
-34772,
-32769,
-27247,
-20672,
-17717,
-21752,
-31186,
-39683,
-41379,
-34956,
-26062,
-21384,
-23394,
-28699,
-31078,
-28884,
-25902,
-27460,
-34719,
-41643,
-41319,
-31583,
-19403,
-14202,
-21017,
-35010,
-45946,
-46843,
-38469,
-28676,
-24156,
-25534,
-29069,
-30812,
-31449,
-33846,
-38422,
-41955,
-39528,
-31474,
-23391,
-22549,
-30045,
-40612,
-45257,
-41879,
-34668,
-31684,
-35354,
-40481,
-39710,
-31687,
-23573,
-24796,
-37544,
-52971,
-58725,
-49166,
-31104,
-18269,
-19669,
-32977,
-47558,
-53811,
-51362,
-45861,
-43016,
-42194,
-39473,
-33141,
-28088,
-30764,
-42747,
-57169,
-63215,
-55689,
-39421,
-25665,
-22863,
-30841,
-41586,
-47951,
-47266,
-43673,
-40162,
-37282,
-32344,
-24952,
-18532,
-18693,
-26904,
-38788,
-46526,
-44676,
-34934,
-23576,
-17082,
-17266,
-21489,
-26406,
-30282,
-34143,
-37650,
-39080,
-35618,
-26695,
-16367,
-10003,
-11853,
-20566,
-31000,
-37122,
-35938,
-28539,
-19118,
-11031,
-7497,
-8681,
-14125,
-21439,
-27246,
-28148,
-23020,
-13332,
-3853,
-65535,
-2322,
-10899,
-20014,
-25056,
-23630,
-17529,
-10190,
-5567,
-5144,
-7998,
-12221,
-16209,
-19434,
-22333,
-24398,
-24025,
-20145,
-13278,
-7126,
-6280,
-12908,
-24661,
-35010,
-37787,
-31842,
-21252,
-13281,
-12404,
-17981,
-25848,
-31657,
-34036,
-34113,
-33112,
-31259,
-27911,
-24288,
-23235,
-27197,
-35642,
-43941,
-47077,
-42936,
-35037,
-28992,
-29676,
-36202,
-44226,
-49062,
-48663,
-45524,
-43037,
-43650,
-46074,
-48667,
-49032,
-48534,
-48927,
-52204,
-57618,
-62843,
-64168,
-61312,
-55637,
-51939,
-53048,
-59571,
-65534,
-65534,
-65534,
-65534,
-61551,
-58040,
-59834,
-64985,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65529,
-65534,
-61968,
-59443,
-61867,
-65534,
-65534,
-65534,
-64535,
-57143,
-55264,
-60049,
-65531,
-65534,
-65530,
-60156,
-55317,
-56191,
-60548,
-62502,
-58964,
-51595,
-46209,
-47160,
-53126,
-58913,
-59014,
-52679,
-43965,
-38100,
-37812,
-41640,
-45548,
-47186,
-45813,
-43355,
-41457,
-40424,
-38947,
-36280,
-32608,
-29572,
-29308,
-31235,
-34114,
-34379,
-31180,
-25641,
-21408,
-21337,
-25236,
-29418,
-29990,
-25429,
-18638,
-14044,
-14626,
-19166,
-23868,
-25426,
-23367,
-20275,
-18799,
-19614,
-20886,
-20591,
-18351,
-15865,
-15180,
-17081,
-20118,
-22071,
-21361,
-18163,
-14175,
-11248,
-10475,
-11353,
-13226,
-14781,
-15712,
-16020,
-15923,
-15414,
-14072,
-12593,
-11216,
-11856,
-14568,
-18483,
-21359,
-21227,
-18031,
-13993,
-11717,
-13045,
-17077,
-21705,
-24448,
-24977,
-23445,
-21306,
-18692,
-16052,
-14387,
-14863,
-18453,
-23975,
-29043,
-30232,
-27063,
-20831,
-15867,
-15284,
-19697,
-26401,
-31685,
-32109,
-28460,
-22919,
-20038,
-20988,
-25533,
-29888,
-31500,
-29809,
-26642,
-25290,
-26381,
-29013,
-30711,
-29860,
-28147,
-27379,
-29440,
-33138,
-36172,
-36413,
-34297,
-31501,
-30337,
-30682,
-32290,
-33693,
-35829,
-38526,
-41902,
-43887,
-42403,
-37127,
-30547,
-26881,
-29146,
-36968,
-45706,
-50223,
-46948,
-38128,
-29201,
-26193,
-30997,
-39686,
-45707,
-44175,
-36544,
-28568,
-26561,
-31210,
-38126,
-40904,
-37543,
-31451,
-28089,
-29839,
-33716,
-35039,
-31842,
-27619,
-27193,
-31715,
-37198,
-37711,
-32260,
-25034,
-23206,
-28752,
-36889,
-40317,
-34724,
-24923,
-18559,
-21386,
-30814,
-38628,
-37813,
-28302,
-16924,
-12222,
-16870,
-27327,
-34667,
-33853,
-25052,
-15184,
-11269,
-15787,
-25031,
-31234,
-30207,
-22810,
-15894,
-15020,
-20859,
-27669,
-29255,
-23842,
-16737,
-14151,
-19218,
-27356,
-32052,
-29969,
-24502,
-21489,
-23738,
-27748,
-27777,
-22495,
-16815,
-17585,
-26691,
-37840,
-41638,
-34459,
-20934,
-11881,
-13277,
-23129,
-32900,
-36039,
-32427,
-27720,
-26486,
-28564,
-29840,
-27957,
-24928,
-25554,
-31899,
-40079,
-44020,
-38785,
-28174,
-19061,
-19115,
-28436,
-41719,
-49774,
-48823,
-39818,
-29889,
-25266,
-27831,
-34482,
-39555,
-40239,
-37601,
-36754,
-40029,
-46395,
-49639,
-46132,
-36093,
-27802,
-27382,
-37360,
-50937,
-59122,
-57061,
-47424,
-38313,
-34958,
-37601,
-40795,
-41559,
-40190,
-41004,
-45154,
-49535,
-48850,
-40398,
-28648,
-20963,
-22230,
-31184,
-40529,
-44494,
-41164,
-34853,
-30075,
-28487,
-28967,
-27826,
-25535,
-23336,
-24742,
-29676,
-35461,
-37574,
-33347,
-24635,
-16286,
-13917,
-19029,
-27545,
-33660,
-31844,
-24160,
-16233,
-13731,
-18267,
-24264,
-26350,
-22363,
-16394,
-14653,
-18505,
-24107,
-24712,
-18164,
-9370,
-5699,
-11140,
-21676,
-29439,
-28622,
-21041,
-12487,
-9026,
-10481,
-13909,
-15790,
-17263,
-20226,
-25662,
-30022,
-29333,
-22575,
-14836,
-12221,
-18403,
-30019,
-39609,
-41955,
-37020,
-30152,
-27274,
-30523,
-36992,
-42169,
-43515,
-41639,
-40690,
-42195,
-47237,
-51520,
-53149,
-50121,
-45679,
-42985,
-45315,
-51300,
-57674,
-60229,
-57695,
-53288,
-50142,
-51569,
-55426,
-59226,
-59783,
-58119,
-56189,
-56404,
-58645,
-61446,
-63850,
-65533,
-65534,
-65534,
-65534,
-61446,
-54527,
-51490,
-55847,
-65534,
-65534,
-65534,
-65534,
-59781,
-52732,
-53709,
-60096,
-65534,
-65532,
-62847,
-59781,
-60205,
-62924,
-63322,
-58989,
-51359,
-45573,
-45260,
-49719,
-54159,
-54605,
-50196,
-44018,
-40107,
-39502,
-40979,
-42062,
-41115,
-39127,
-36521,
-34058,
-31449,
-28805,
-27406,
-27909,
-30152,
-31818,
-30336,
-25954,
-19934,
-16816,
-17610,
-21675,
-25717,
-26138,
-23368,
-18346,
-14759,
-13436,
-14625,
-16660,
-18293,
-18748,
-17158,
-13940,
-9897,
-7337,
-8419,
-12646,
-17396,
-18403,
-14385,
-8713,
-7043,
-12806,
-22940,
-29549,
-25977,
-13414,
-466,
-4,
-9075,
-27542,
-41242,
-41614,
-29572,
-14202,
-5384,
-7467,
-16977,
-27115,
-32819,
-33403,
-31049,
-28146,
-25296,
-22095,
-19038,
-17501,
-19591,
-25347,
-32925,
-38260,
-38576,
-33059,
-24605,
-17850,
-16074,
-20226,
-27247,
-33744,
-37178,
-37598,
-35965,
-32765,
-27488,
-21250,
-16424,
-17950,
-27197,
-41058,
-51569,
-51808,
-41270,
-26667,
-17319,
-18215,
-26827,
-36015,
-39765,
-38313,
-34906,
-33559,
-33401,
-31448,
-26058,
-19880,
-17637,
-22995,
-32953,
-41825,
-43011,
-35966,
-24471,
-15290,
-12534,
-16769,
-25290,
-34036,
-39924,
-40451,
-35118,
-25743,
-16313,
-12384,
-16602,
-27911,
-40133,
-46922,
-44519,
-35328,
-24846,
-18637,
-19117,
-24023,
-30183,
-34322,
-35832,
-34879,
-32371,
-29388,
-26639,
-25903,
-26955,
-29284,
-30546,
-29469,
-26532,
-24109,
-24577,
-28176,
-32051,
-33244,
-29810,
-23998,
-19566,
-19719,
-24478,
-30652,
-34300,
-33507,
-29623,
-25982,
-25319,
-27883,
-31287,
-33032,
-31525,
-28543,
-26667,
-28409,
-33296,
-38259,
-40109,
-36438,
-29651,
-23154,
-21835,
-26772,
-35910,
-44308,
-47501,
-43755,
-35431,
-27119,
-23311,
-26167,
-33269,
-40607,
-43255,
-39947,
-32980,
-27142,
-26931,
-32212,
-39793,
-43697,
-41089,
-33371,
-25747,
-23415,
-27515,
-34771,
-39926,
-40266,
-36438,
-32980,
-32183,
-34249,
-35617,
-34062,
-29626,
-26532,
-28650,
-37150,
-47846,
-54660,
-51857,
-40429,
-25554,
-15712,
-16443,
-27119,
-41585,
-51888,
-52360,
-43965,
-31710,
-22336,
-19459,
-23602,
-30762,
-38180,
-42061,
-42119,
-37939,
-31661,
-25452,
-22993,
-25194,
-31625,
-38529,
-42536,
-42352,
-38712,
-34374,
-30209,
-27245,
-25429,
-27192,
-33773,
-44385,
-53524,
-54422,
-43673,
-26164,
-11907,
-10953,
-23606,
-42456,
-54608,
-53840,
-42538,
-30258,
-25162,
-28885,
-36042,
-40347,
-39736,
-36837,
-36251,
-39185,
-43198,
-44439,
-40980,
-35250,
-30971,
-31579,
-36544,
-43354,
-47903,
-48052,
-43520,
-36646,
-30814,
-29175,
-32820,
-40374,
-47896,
-51520,
-48449,
-40244,
-30310,
-24422,
-25902,
-34219,
-45179,
-51727,
-49802,
-39789,
-28096,
-22254,
-26379,
-37069,
-46765,
-47819,
-40425,
-30470,
-26535,
-31340,
-40533,
-46233,
-43596,
-35036,
-27673,
-26559,
-31713,
-37783,
-40162,
-38312,
-35250,
-33956,
-34350,
-33799,
-31048,
-27647,
-26981,
-30208,
-35221,
-37469,
-35619,
-31314,
-29018,
-30786,
-34484,
-36702,
-34721,
-31156,
-29547,
-32395,
-37497,
-40554,
-38341,
-32398,
-26771,
-25824,
-29913,
-36386,
-41429,
-43065,
-41959,
-39499,
-36968,
-34641,
-32794,
-32502,
-34828,
-39369,
-44518,
-47055,
-45863,
-41061,
-36147,
-33902,
-36227,
-41825,
-48083,
-51306,
-50170,
-45098,
-38790,
-34904,
-35437,
-40528,
-47981,
-53996,
-56008,
-52572,
-45442,
-37601,
-33136,
-34431,
-41297,
-50434,
-56930,
-57511,
-51833,
-44572,
-40135,
-41825,
-46816,
-50433,
-48375,
-41877,
-36069,
-36041,
-42486,
-50141,
-52919,
-48187,
-40031,
-34931,
-37415,
-45020,
-51386,
-50564,
-42355,
-32184,
-26483,
-28886,
-36859,
-45549,
-49669,
-47843,
-40931,
-32604,
-25800,
-22888,
-25084,
-30891,
-37601,
-41322,
-39607,
-33534,
-25926,
-21149,
-20699,
-23497,
-26614,
-27724,
-26350,
-24316,
-22971,
-22520,
-22178,
-20699,
-18242,
-16158,
-15759,
-17426,
-19826,
-20753,
-18691,
-14387,
-10030,
-8368,
-9924,
-13331,
-15127,
-14148,
-10615,
-7967,
-8369,
-11798,
-15126,
-15261,
-11666,
-6862,
-4669,
-6888,
-10953,
-14179,
-13301,
-10430,
-8152,
-9187,
-13014,
-16526,
-17768,
-15813,
-13358,
-11694,
-11825,
-12488,
-13434,
-14523,
-16998,
-19884,
-22306,
-21837,
-19484,
-16947,
-17506,
-21225,
-26220,
-28699,
-27539,
-23973,
-21729,
-22680,
-26534,
-30260,
-31841,
-31237,
-30468,
-31079,
-32976,
-33642,
-31944,
-27517,
-24127,
-24056,
-29254,
-36675,
-43225,
-44386,
-40188,
-32768,
-26428,
-24846,
-28328,
-35570,
-42694,
-47530,
-48321,
-45732,
-40665,
-34825,
-29626,
-27670,
-29572,
-35883,
-43357,
-48082,
-46818,
-39262,
-29203,
-21597,
-20249,
-25241,
-33560,
-40768,
-44097,
-42775,
-38127,
-32161,
-26429,
-22599,
-21678,
-24235,
-29839,
-36171,
-41007,
-41534,
-37600,
-31158,
-25001,
-22972,
-25423,
-31291,
-36779,
-39424,
-37492,
-33060,
-27615,
-23659,
-20750,
-19749,
-20250,
-23761,
-29230,
-34642,
-36226,
-31896,
-23736,
-16552,
-15604,
-21488,
-30315,
-35748,
-34565,
-28383,
-22573,
-21333,
-24528,
-29176,
-30390,
-28199,
-23946,
-21650,
-22152,
-25135,
-27380,
-28409,
-27698,
-27247,
-27856,
-29335,
-31049,
-31554,
-30811,
-28887,
-26350,
-24553,
-24054,
-25979,
-30022,
-35302,
-39738,
-41772,
-40321,
-36251,
-31396,
-28354,
-28757,
-32552,
-38342,
-43118,
-45600,
-44310,
-41479,
-37469,
-34615,
-32425,
-31709,
-32664,
-35854,
-41114,
-46260,
-48586,
-46657,
-41059,
-35593,
-33481,
-35327,
-39397,
-41955,
-41774,
-40055,
-39184,
-40478,
-42459,
-42881,
-40823,
-38283,
-37682,
-40000,
-43122,
-44015,
-41482,
-37731,
-35963,
-37996,
-41984,
-44438,
-43410,
-40398,
-38076,
-39184,
-41746,
-43092,
-41323,
-37230,
-34906,
-36386,
-41401,
-46738,
-49086,
-47557,
-43301,
-39082,
-36038,
-34804,
-35405,
-37787,
-42219,
-47346,
-50881,
-50752,
-46841,
-41458,
-37570,
-37365,
-39420,
-41958,
-42511,
-41456,
-40371,
-41009,
-43116,
-44943,
-44518,
-40742,
-35883,
-31791,
-31445,
-34380,
-39183,
-43040,
-44492,
-42960,
-40479,
-38285,
-37971,
-38972,
-39897,
-39132,
-36463,
-32690,
-30361,
-30578,
-34059,
-38685,
-42112,
-42384,
-39020,
-33962,
-29619,
-28335,
-30097,
-33879,
-36990,
-37865,
-35883,
-32767,
-30022,
-29438,
-30682,
-32608,
-33506,
-32955,
-30597,
-28388,
-26716,
-26617,
-27960,
-29967,
-32452,
-34561,
-35885,
-35855,
-34116,
-30996,
-27619,
-25583,
-26008,
-29308,
-33558,
-37178,
-37652,
-35250,
-30945,
-27724,
-27246,
-30076,
-34165,
-37600,
-38128,
-36306,
-33295,
-31342,
-31604,
-33534,
-36516,
-38473,
-39314,
-38816,
-38021,
-36941,
-36305,
-35329,
-34827,
-34879,
-36703,
-39764,
-43833,
-46604,
-47186,
-44994,
-41587,
-38762,
-38418,
-40479,
-43858,
-46816,
-47767,
-47105,
-44838,
-42958,
-41880,
-42379,
-44385,
-46659,
-48980,
-49564,
-48241,
-44731,
-40343,
-36573,
-35617,
-37839,
-42538,
-47078,
-48930,
-47054,
-42563,
-38315,
-36461,
-37920,
-40555,
-42750,
-42486,
-41294,
-39927,
-39815,
-40110,
-39554,
-37493,
-34802,
-32871,
-32874,
-33929,
-34906,
-34351,
-32795,
-30917,
-30392,
-30601,
-31631,
-32003,
-32106,
-31605,
-30418,
-28065,
-24291,
-20224,
-17582,
-17927,
-21385,
-26032,
-29309,
-29386,
-26537,
-22651,
-19854,
-19247,
-20381,
-22180,
-23654,
-24424,
-24579,
-24214,
-23204,
-21944,
-20378,
-19408,
-18849,
-18850,
-18772,
-18242,
-17320,
-16103,
-15233,
-14387,
-13938,
-13755,
-14043,
-15128,
-16103,
-16554,
-15336,
-13017,
-10265,
-8924,
-9368,
-11774,
-14308,
-16394,
-16712,
-16447,
-15944,
-16291,
-17027,
-18163,
-18747,
-19137,
-18986,
-18690,
-18560,
-18402,
-18797,
-19510,
-20805,
-22178,
-23207,
-23552,
-22545,
-21071,
-18875,
-17690,
-17740,
-19670,
-23127,
-26827,
-29359,
-29917,
-28091,
-25612,
-23655,
-23738,
-25635,
-28279,
-30338,
-30970,
-30550,
-30047,
-30311,
-31580,
-33162,
-34537,
-35144,
-35301,
-35040,
-34640,
-33800,
-32685,
-31343,
-30521,
-30708,
-31922,
-33850,
-35328,
-35832,
-35221,
-33667,
-32501,
-31739,
-31683,
-31976,
-31975,
-32238,
-32821,
-34113,
-35779,
-36701,
-36411,
-34723,
-32923,
-32057,
-32870,
-34698,
-36355,
-36494,
-35616,
-33931,
-33401,
-33664,
-34695,
-35567,
-35328,
-34299,
-32451,
-30679,
-28993,
-28092,
-27723,
-28147,
-29069,
-29757,
-30523,
-30337,
-30365,
-29993,
-30286,
-30468,
-31000,
-31181,
-31289,
-31340,
-31501,
-32000,
-32082,
-31683,
-30101,
-28463,
-27378,
-28544,
-30970,
-33693,
-33928,
-31447,
-27010,
-23947,
-24027,
-27643,
-31659,
-33321,
-31078,
-26850,
-23870,
-24975,
-29071,
-34167,
-36596,
-35883,
-33137,
-31632,
-32159,
-35409,
-38206,
-39608,
-38338,
-36174,
-34616,
-34985,
-36755,
-38761,
-39185,
-37731,
-35277,
-33056,
-32425,
-33030,
-34009,
-34405,
-33559,
-32661,
-32054,
-33189,
-35198,
-37758,
-39712,
-40531,
-40584,
-40028,
-39925,
-40530,
-42143,
-44332,
-46475,
-47526,
-47663,
-46605,
-45678,
-45208,
-45309,
-45497,
-45388,
-44759,
-44435,
-44470,
-44543,
-43620,
-40903,
-36672,
-32876,
-30731,
-31317,
-33373,
-34960,
-34562,
-32319,
-29043,
-26932,
-26111,
-26774,
-28277,
-29863,
-31578,
-32583,
-32265,
-30152,
-26801,
-23284,
-21599,
-22150,
-24185,
-26297,
-26668,
-25476,
-23132,
-20801,
-18826,
-17662,
-16815,
-17084,
-18742,
-21493,
-24923,
-26931,
-26853,
-24236,
-20516,
-17475,
-16502,
-17845,
-20067,
-22202,
-22417,
-21543,
-19801,
-18666,
-18295,
-18402,
-18506,
-18112,
-18083,
-18377,
-19905,
-21307,
-22019,
-20857,
-18587,
-16077,
-15232,
-16555,
-19534,
-23131,
-25239,
-26139,
-25560,
-25608,
-26695,
-29676,
-33561,
-37308,
-40057,
-41268,
-41669,
-41611,
-41723,
-42191,
-42777,
-43991,
-45336,
-47398,
-49562,
-51463,
-52758,
-52891,
-52598,
-52151,
-52282,
-53206,
-54634,
-56031,
-57222,
-57747,
-57856,
-58037,
-58411,
-59384,
-60894,
-62817,
-64932,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-63983,
-61284,
-59179,
-57190,
-56009,
-54446,
-52626,
-50513,
-49035,
-48399,
-49142,
-50114,
-50675,
-50192,
-48695,
-46601,
-44865,
-43407,
-42698,
-41982,
-41272,
-40106,
-38844,
-37042,
-35094,
-32448,
-29837,
-26983,
-25216,
-23945,
-24082,
-24023,
-23870,
-22652,
-20963,
-19088,
-17742,
-16473,
-15761,
-14599,
-14017,
-13357,
-13360,
-13619,
-13676,
-13991,
-14255,
-15312,
-16659,
-18373,
-19222,
-19668,
-19353,
-19351,
-19353,
-19218,
-18801,
-17526,
-16689,
-16285,
-16926,
-17977,
-18401,
-18087,
-17077,
-16188,
-16337,
-17138,
-18397,
-19435,
-20010,
-20621,
-21147,
-21967,
-22387,
-22789,
-22833,
-23450,
-24551,
-26510,
-28463,
-30626,
-32004,
-33345,
-34250,
-34955,
-35437,
-35644,
-36121,
-36492,
-37466,
-37707,
-37729,
-36600,
-34955,
-33352,
-31971,
-31397,
-31180,
-31369,
-31895,
-32688,
-33243,
-33320,
-32347,
-31021,
-29707,
-29649,
-30338,
-32028,
-33005,
-33320,
-32691,
-31919,
-31607,
-31868,
-32426,
-33080,
-33380,
-33897,
-33961,
-34057,
-33351,
-31919,
-30420,
-28671,
-27437,
-26081,
-24796,
-23125,
-21837,
-21120,
-21043,
-21489,
-21151,
-20511,
-19169,
-18375,
-18135,
-18458,
-19085,
-19433,
-19880,
-20513,
-21016,
-21387,
-20749,
-19620,
-18556,
-18641,
-19854,
-21674,
-22921,
-22991,
-22394,
-21830,
-21733,
-21884,
-21784,
-20775,
-19910,
-19402,
-19778,
-20352,
-20174,
-19006,
-17189,
-16023,
-16079,
-17185,
-18693,
-19563,
-20356,
-20936,
-22574,
-24185,
-25663,
-26033,
-25348,
-24869,
-24821,
-26533,
-28754,
-31367,
-32873,
-33455,
-32843,
-32191,
-31494,
-31848,
-32341,
-33483,
-34032,
-34327,
-33770,
-32952,
-31975,
-30945,
-30127,
-29042,
-28095,
-27404,
-27276,
-28041,
-29041,
-29945,
-30228,
-29760,
-29227,
-29255,
-30127,
-31763,
-33402,
-34297,
-34354,
-33741,
-32823,
-32370,
-32133,
-32371,
-32715,
-33056,
-33192,
-32951,
-32080,
-31131,
-29808,
-29256,
-28833,
-29148,
-29176,
-28992,
-28038,
-26828,
-25291,
-24160,
-23683,
-23919,
-25006,
-26083,
-27276,
-27565,
-27642,
-27278,
-27298,
-27909,
-29255,
-30813,
-32160,
-33084,
-33215,
-33059,
-32502,
-32056,
-31603,
-31870,
-32662,
-34192,
-35620,
-36253,
-35750,
-34301,
-33082,
-32742,
-33981,
-35514,
-36834,
-36912,
-36097,
-35220,
-34830,
-34956,
-35436,
-35539,
-35752,
-35988,
-36782,
-37519,
-38050,
-37784,
-37283,
-37046,
-37492,
-38420,
-39343,
-39421,
-38974,
-38022,
-36991,
-36149,
-35301,
-34986,
-35303,
-36252,
-37705,
-37944,
-37413,
-35120,
-33424,
-32322,
-33450,
-34830,
-36014,
-35671,
-34538,
-33268,
-33164,
-33849,
-34484,
-34431,
-33162,
-31820,
-31072,
-31293,
-32446,
-33087,
-33506,
-32819,
-32320,
-31761,
-32056,
-32291,
-32530,
-32345,
-31472,
-30576,
-29729,
-29441,
-29731,
-30389,
-30735,
-30468,
-29493,
-28174,
-27325,
-27170,
-28250,
-29468,
-30732,
-30841,
-30257,
-29150,
-28542,
-28568,
-29757,
-31077,
-32556,
-33190,
-33189,
-32662,
-32212,
-32266,
-33085,
-34376,
-35937,
-36781,
-37230,
-37125,
-36886,
-37256,
-37839,
-38496,
-39054,
-38997,
-39001,
-39131,
-39448,
-39977,
-40134,
-40003,
-39977,
-40187,
-41191,
-42327,
-43382,
-43833,
-44228,
-44677,
-45864,
-47452,
-49058,
-50172,
-50750,
-51041,
-51596,
-52599,
-53894,
-54975,
-55663,
-55425,
-55292,
-54924,
-55345,
-55769,
-56454,
-56562,
-56373,
-55796,
-55108,
-54606,
-54026,
-53522,
-52785,
-52150,
-51570,
-51912,
-52362,
-53311,
-53578,
-53416,
-52337,
-51225,
-50381,
-50487,
-51305,
-52626,
-53390,
-53421,
-52516,
-51124,
-49771,
-48929,
-48561,
-48662,
-48481,
-48110,
-47079,
-45656,
-43935,
-42303,
-40581,
-39531,
-38494,
-37893,
-37440,
-36674,
-35808,
-34399,
-32851,
-31206,
-30234,
-29439,
-29254,
-29178,
-28644,
-27886,
-26611,
-25559,
-24740,
-24553,
-24556,
-24790,
-24451,
-23812,
-22736,
-21646,
-21044,
-20751,
-21016,
-21068,
-20938,
-20089,
-18773,
-17398,
-16128,
-15606,
-15519,
-15870,
-16312,
-16660,
-16527,
-16022,
-15053,
-13984,
-13339,
-13244,
-14077,
-15123,
-16027,
-16103,
-15575,
-14758,
-14440,
-14968,
-15973,
-17106,
-17716,
-18004,
-18086,
-18505,
-19117,
-19825,
-20331,
-20513,
-20726,
-21174,
-21781,
-22681,
-23073,
-23369,
-23311,
-23235,
-23339,
-23604,
-24210,
-24741,
-25530,
-26113,
-26878,
-27565,
-28172,
-29097,
-29809,
-30972,
-31789,
-32610,
-33347,
-34036,
-35037,
-35989,
-37125,
-37862,
-38342,
-38442,
-38474,
-38706,
-39477,
-40238,
-40956,
-40767,
-40030,
-38947,
-38443,
-38605,
-39394,
-39766,
-39290,
-38075,
-37150,
-37020,
-38152,
-39003,
-39233,
-37788,
-36224,
-35039,
-35382,
-36357,
-36969,
-36513,
-35227,
-34348,
-34301,
-35302,
-36041,
-35990,
-34879,
-33453,
-32479,
-32263,
-32426,
-32396,
-31974,
-30895,
-30019,
-28595,
-27512,
-26086,
-25030,
-24343,
-24237,
-23921,
-23339,
-22047,
-20803,
-19749,
-19615,
-19803,
-20062,
-19964,
-19691,
-19355,
-19324,
-19406,
-19140,
-18719,
-18084,
-18059,
-18718,
-19907,
-20856,
-21069,
-20330,
-19114,
-18111,
-17926,
-18533,
-19907,
-21200,
-22232,
-22598,
-22259,
-21489,
-20859,
-20725,
-21464,
-22812,
-24237,
-25163,
-25556,
-25585,
-26034,
-26824,
-28227,
-29385,
-30708,
-31130,
-32027,
-32373,
-33293,
-33772,
-34588,
-35329,
-36333,
-37440,
-38209,
-38654,
-38235,
-37942,
-37653,
-38392,
-39395,
-40744,
-41241,
-41326,
-40582,
-40108,
-39952,
-40502,
-41404,
-42142,
-42563,
-42486,
-42433,
-42404,
-42620,
-42641,
-42539,
-42168,
-42221,
-42565,
-43594,
-44069,
-44281,
-43224,
-42170,
-41031,
-40796,
-40795,
-40847,
-40057,
-38893,
-37520,
-36650,
-36411,
-36464,
-36122,
-35327,
-33851,
-32661,
-31844,
-31789,
-32028,
-31869,
-31263,
-29967,
-28939,
-28487,
-28703,
-29358,
-29654,
-29041,
-27909,
-26562,
-25662,
-25612,
-25690,
-25873,
-25349,
-24420,
-23368,
-22625,
-22259,
-22413,
-22471,
-22517,
-21971,
-21117,
-20201,
-19429,
-19484,
-19961,
-20855,
-21520,
-21648,
-21280,
-21016,
-20883,
-21334,
-21887,
-22177,
-22125,
-21941,
-21991,
-22656,
-23785,
-24927,
-25609,
-25717,
-25531,
-25558,
-26244,
-27434,
-28858,
-29942,
-30231,
-30207,
-29941,
-29967,
-30578,
-31020,
-31662,
-31947,
-32343,
-33087,
-33741,
-34380,
-34193,
-33901,
-33905,
-34824,
-36520,
-38153,
-38761,
-38447,
-37913,
-38237,
-39605,
-41324,
-42142,
-42009,
-41350,
-41666,
-42962,
-44860,
-45761,
-45416,
-44386,
-43991,
-45125,
-47001,
-48481,
-48398,
-47320,
-46022,
-46157,
-47132,
-48613,
-49005,
-48562,
-47369,
-47107,
-47239,
-48399,
-48849,
-48879,
-48079,
-47401,
-47024,
-47452,
-47871,
-48375,
-48030,
-47608,
-46923,
-46471,
-46526,
-46474,
-46708,
-46449,
-46233,
-45919,
-45786,
-45470,
-45230,
-44600,
-44147,
-43674,
-43595,
-43619,
-43570,
-43196,
-42512,
-41878,
-41429,
-41244,
-41217,
-41007,
-40661,
-40059,
-39684,
-39290,
-39475,
-39686,
-39897,
-40083,
-39685,
-39263,
-38499,
-37836,
-37469,
-37387,
-37495,
-37757,
-37812,
-37731,
-37363,
-36886,
-36411,
-35937,
-35538,
-35014,
-34800,
-34324,
-34248,
-33847,
-33403,
-32820,
-31973,
-31133,
-30519,
-30419,
-30706,
-31396,
-31523,
-31503,
-30466,
-29654,
-28911,
-28963,
-29600,
-30494,
-30973,
-31025,
-30309,
-29574,
-28830,
-28728,
-28992,
-29703,
-30258,
-30681,
-30602,
-30311,
-29758,
-29412,
-29175,
-29284,
-29436,
-29708,
-29832,
-30023,
-30073,
-30179,
-29995,
-29809,
-29413,
-29255,
-29414,
-29862,
-30523,
-31049,
-31106,
-30889,
-30315,
-29938,
-29838,
-30020,
-30470,
-30786,
-31026,
-30916,
-30788,
-30628,
-30601,
-30840,
-31024,
-31341,
-31237,
-31153,
-30975,
-31099,
-31505,
-32024,
-32030,
-31708,
-30631,
-29754,
-29258,
-29516,
-30049,
-30495,
-30312,
-29677,
-28647,
-27988,
-27380,
-27353,
-27354,
-27644,
-28092,
-28491,
-28698,
-28492,
-27747,
-27118,
-26665,
-26959,
-27512,
-28250,
-28861,
-29412,
-29994,
-30393,
-30412,
-29840,
-28698,
-28042,
-27934,
-28938,
-30230,
-30869,
-30520,
-29415,
-28093,
-27642,
-27753,
-28195,
-28757,
-28750,
-28966,
-29070,
-29385,
-29469,
-29253,
-28834,
-28619,
-28782,
-29517,
-30497,
-31209,
-31869,
-31711,
-31949,
-31762,
-31951,
-32131,
-32425,
-32899,
-33426,
-34169,
-34614,
-34985,
-34803,
-34559,
-34409,
-34426,
-34962,
-35539,
-36279,
-36492,
-36806,
-36755,
-37177,
-37521,
-37890,
-37863,
-37681,
-37517,
-37630,
-38204,
-38631,
-38815,
-38707,
-38130,
-38179,
-38287,
-38683,
-38522,
-37840,
-36567,
-35780,
-35538,
-36359,
-37389,
-37995,
-37653,
-35963,
-34245,
-32424,
-31923,
-32158,
-33324,
-34192,
-34377,
-33430,
-31602,
-29680,
-28329,
-27856,
-28411,
-28935,
-29152,
-28671,
-27569,
-26479,
-25506,
-25082,
-24897,
-24688,
-24553,
-24054,
-23892,
-23685,
-23497,
-23075,
-22259,
-21277,
-20516,
-20223,
-20513,
-20965,
-20988,
-20250,
-18930,
-17793,
-17294,
-17423,
-18112,
-17951,
-17400,
-16155,
-15391,
-15550,
-16632,
-17925,
-18588,
-18109,
-17081,
-16054,
-16204,
-17272,
-19268,
-20623,
-21146,
-20620,
-19563,
-19353,
-19827,
-21306,
-22732,
-23498,
-23313,
-22707,
-22150,
-22258,
-23021,
-24001,
-24792,
-24844,
-24873,
-24500,
-25031,
-25610,
-26773,
-27696,
-28173,
-28041,
-27722,
-27513,
-28145,
-29228,
-30525,
-31365,
-31078,
-30443,
-29466,
-29679,
-30573,
-32373,
-33531,
-34037,
-33214,
-32346,
-31419,
-31528,
-32105,
-32901,
-33531,
-33640,
-33427,
-33427,
-33269,
-33401,
-33295,
-33111,
-33058,
-33267,
-34142,
-35169,
-35859,
-35828,
-34909,
-33767,
-33166,
-33347,
-34325,
-35356,
-35645,
-35487,
-34748,
-34562,
-34643,
-35170,
-35619,
-35645,
-35303,
-35064,
-34854,
-35539,
-36201,
-37017,
-37312,
-37095,
-36440,
-35829,
-35699,
-36174,
-37256,
-38287,
-38734,
-38711,
-38126,
-37865,
-38180,
-39052,
-40163,
-40899,
-40954,
-40742,
-40689,
-41246,
-42535,
-44098,
-45231,
-45707,
-45391,
-44939,
-44863,
-45470,
-46682,
-47928,
-48766,
-48985,
-48715,
-48350,
-48213,
-48270,
-48743,
-49087,
-49485,
-50036,
-50276,
-50644,
-50542,
-50246,
-49856,
-49666,
-50012,
-50645,
-51516,
-51833,
-51677,
-50696,
-49880,
-49351,
-49693,
-50515,
-51251,
-51438,
-50804,
-49904,
-49062,
-48848,
-48798,
-48849,
-48612,
-48003,
-47583,
-47212,
-47027,
-46843,
-45997,
-45284,
-44256,
-43750,
-43730,
-43670,
-43675,
-43304,
-42695,
-42144,
-41770,
-41140,
-40714,
-39714,
-39025,
-38339,
-38182,
-38231,
-38316,
-37808,
-36784,
-35379,
-34353,
-33903,
-34245,
-34695,
-34854,
-34271,
-33192,
-32422,
-31843,
-32319,
-32528,
-32532,
-31946,
-30946,
-30048,
-29887,
-30024,
-30676,
-31002,
-30836,
-30421,
-29488,
-29154,
-28590,
-28968,
-28857,
-29282,
-28991,
-28911,
-28331,
-27935,
-27142,
-26641,
-25953,
-25876,
-25979,
-26405,
-27087,
-26987,
-26928,
-25877,
-25319,
-24766,
-25135,
-25981,
-26957,
-27512,
-27407,
-26745,
-25982,
-25582,
-25798,
-26454,
-27090,
-27301,
-26983,
-26404,
-26033,
-25927,
-26244,
-26088,
-25713,
-24823,
-24286,
-24134,
-24660,
-24844,
-24423,
-23208,
-22070,
-21574,
-22358,
-23608,
-24683,
-24636,
-23708,
-22654,
-22204,
-22704,
-23580,
-24315,
-24529,
-24263,
-23842,
-23682,
-23552,
-23894,
-24078,
-24555,
-25004,
-25450,
-25720,
-25633,
-25403,
-25212,
-25242,
-25584,
-26166,
-26613,
-26932,
-26982,
-26748,
-26826,
-26955,
-27542,
-28405,
-29339,
-30282,
-30788,
-31050,
-30997,
-31052,
-31262,
-31947,
-32822,
-33768,
-34248,
-34430,
-34061,
-33877,
-34140,
-34932,
-36148,
-36833,
-37046,
-36490,
-36016,
-36041,
-36807,
-37971,
-38812,
-39056,
-38784,
-38554,
-38573,
-38923,
-39316,
-39182,
-38817,
-38311,
-38287,
-38525,
-38944,
-39028,
-38417,
-37760,
-36937,
-36651,
-36833,
-37178,
-37441,
-37309,
-36754,
-36043,
-35302,
-34985,
-34564,
-34560,
-34328,
-34297,
-34169,
-34059,
-33640,
-32924,
-32002,
-30920,
-30468,
-30233,
-30496,
-30627,
-30472,
-29939,
-29336,
-28778,
-28517,
-28356,
-28252,
-28066,
-28015,
-27933,
-28042,
-28039,
-27776,
-27249,
-26666,
-26086,
-25929,
-26083,
-26407,
-26663,
-26511,
-26085,
-25346,
-24952,
-24501,
-24951,
-25133,
-25826,
-25976,
-25826,
-25555,
-24846,
-24501,
-24160,
-24261,
-24663,
-25265,
-25929,
-26429,
-26667,
-26587,
-26299,
-26111,
-26086,
-26509,
-26983,
-27461,
-27695,
-27381,
-27062,
-26615,
-26614,
-26983,
-27566,
-28065,
-28439,
-28618,
-28570,
-28726,
-28753,
-29019,
-29279,
-29415,
-29623,
-29521,
-29517,
-29468,
-29623,
-29863,
-29916,
-29860,
-29416,
-28830,
-28650,
-28513,
-29257,
-29596,
-30076,
-29754,
-29363,
-28672,
-28649,
-29016,
-29784,
-30311,
-30364,
-29730,
-28886,
-28198,
-28094,
-28462,
-28938,
-29149,
-28913,
-28435,
-28068,
-27801,
-27804,
-27325,
-26933,
-26006,
-25663,
-25401,
-25609,
-25558,
-25321,
-24659,
-24027,
-23788,
-23842,
-24053,
-24183,
-23870,
-23574,
-23291,
-23337,
-23684,
-24051,
-24240,
-24156,
-23922,
-23840,
-24080,
-24634,
-25266,
-25771,
-26004,
-26168,
-26402,
-26878,
-27565,
-28304,
-28912,
-29334,
-29704,
-30152,
-30788,
-31551,
-32161,
-32739,
-32953,
-33005,
-33295,
-33508,
-34454,
-35465,
-36803,
-37947,
-38759,
-39133,
-39209,
-39266,
-39630,
-40164,
-41215,
-42196,
-43251,
-44307,
-45020,
-45550,
-45836,
-45709,
-45785,
-46077,
-46975,
-48294,
-49695,
-50327,
-50408,
-49616,
-48927,
-48614,
-49032,
-49960,
-50935,
-51543,
-51516,
-51174,
-50407,
-50144,
-49721,
-49746,
-49775,
-49877,
-49961,
-50247,
-50093,
-49876,
-49196,
-48186,
-47558,
-47210,
-47478,
-47977,
-48190,
-47660,
-46817,
-45547,
-44758,
-44570,
-44810,
-45178,
-45074,
-44385,
-43305,
-42247,
-41482,
-41243,
-41193,
-41161,
-40774,
-40103,
-39399,
-38734,
-38497,
-38525,
-38445,
-38390,
-37761,
-37333,
-36809,
-36807,
-36755,
-37018,
-36835,
-36516,
-36042,
-35567,
-35486,
-35383,
-35459,
-35410,
-35168,
-34882,
-34693,
-34564,
-34642,
-34721,
-34695,
-34615,
-34459,
-34402,
-34328,
-34322,
-34169,
-33928,
-33823,
-33746,
-33926,
-34012,
-33953,
-33507,
-32900,
-32501,
-32294,
-32635,
-32925,
-33111,
-32871,
-32532,
-32290,
-32267,
-32581,
-32635,
-32504,
-32001,
-31631,
-31474,
-31894,
-32241,
-32766,
-32583,
-32369,
-31714,
-31469,
-31108,
-31206,
-31052,
-31156,
-30760,
-30733,
-30339,
-30126,
-29809,
-29203,
-28698,
-28043,
-27563,
-27566,
-27564,
-27696,
-27541,
-27245,
-26670,
-26216,
-25637,
-25295,
-25371,
-25825,
-26506,
-27250,
-27483,
-27277,
-26532,
-26195,
-26162,
-26960,
-28013,
-28568,
-28939,
-28461,
-28569,
-28728,
-29649,
-30446,
-30969,
-31078,
-30997,
-30973,
-31524,
-32161,
-32767,
-33057,
-32900,
-32820,
-32924,
-33534,
-34273,
-34747,
-34934,
-34402,
-34380,
-34482,
-35410,
-36489,
-37125,
-37177,
-36675,
-36069,
-36015,
-36411,
-37336,
-37995,
-38366,
-38498,
-38260,
-38444,
-38340,
-38629,
-38789,
-38998,
-39423,
-39500,
-39899,
-39631,
-39714,
-39262,
-38975,
-38654,
-38261,
-38074,
-37865,
-37943,
-37916,
-37891,
-37492,
-36837,
-36118,
-35411,
-35061,
-34988,
-35037,
-35012,
-34669,
-34113,
-33191,
-32501,
-31635,
-31258,
-30499,
-29966,
-29256,
-28753,
-28331,
-28224,
-27804,
-27404,
-26590,
-25714,
-25138,
-24816,
-24821,
-24921,
-24689,
-24183,
-23314,
-22653,
-22019,
-22019,
-22047,
-22308,
-22206,
-21965,
-21570,
-21044,
-20934,
-20887,
-21224,
-21466,
-21491,
-21254,
-20856,
-20674,
-20592,
-20831,
-20938,
-20935,
-20620,
-20409,
-20407,
-20780,
-21516,
-21968,
-22281,
-22206,
-22123,
-22365,
-23100,
-24160,
-25133,
-25744,
-25875,
-25795,
-25902,
-26482,
-27220,
-28148,
-28540,
-28886,
-28886,
-29385,
-30181,
-31234,
-32372,
-33031,
-33428,
-33743,
-33957,
-34482,
-34828,
-35224,
-35565,
-35936,
-36413,
-36936,
-37287,
-37306,
-36942,
-36673,
-36546,
-37254,
-38103,
-39421,
-40056,
-40452,
-39923,
-39370,
-38813,
-38816,
-39289,
-40055,
-40796,
-41138,
-41192,
-40609,
-39872,
-38892,
-38130,
-38047,
-38103,
-38998,
-39027,
-39104,
-38101,
-36968,
-35669,
-34831,
-34241,
-33959,
-33585,
-32924,
-32242,
-31391,
-30630,
-29862,
-28937,
-28200,
-27591,
-27432,
-27672,
-27906,
-28016,
-27247,
-26217,
-24794,
-23865,
-23739,
-24130,
-24766,
-24951,
-24156,
-23105,
-21727,
-21201,
-21254,
-21780,
-22232,
-21913,
-21148,
-19959,
-19169,
-18847,
-19277,
-19612,
-19884,
-19534,
-19170,
-18953,
-19012,
-19534,
-19909,
-20143,
-20092,
-20223,
-20541,
-21386,
-22018,
-22681,
-22546,
-22443,
-22256,
-22548,
-23603,
-24530,
-25608,
-25798,
-25767,
-25560,
-25846,
-26670,
-27667,
-28624,
-29042,
-29282,
-29414,
-29888,
-30576,
-31365,
-31847,
-32128,
-32166,
-32577,
-33061,
-33979,
-34777,
-35511,
-36070,
-36410,
-36940,
-37495,
-38047,
-38817,
-39154,
-39637,
-39894,
-40137,
-40319,
-40663,
-40821,
-41218,
-41534,
-41799,
-41957,
-41983,
-41931,
-41904,
-42115,
-42222,
-42642,
-42408,
-42194,
-41454,
-41061,
-40740,
-41272,
-41614,
-42166,
-41987,
-41503,
-40827,
-40315,
-40139,
-40290,
-40401,
-40609,
-40585,
-40345,
-40214,
-39634,
-39341,
-38633,
-38309,
-37972,
-38153,
-38312,
-38605,
-38311,
-37760,
-36754,
-35936,
-35618,
-35858,
-36490,
-37125,
-37230,
-36886,
-36148,
-35328,
-34908,
-35010,
-35462,
-36278,
-36835,
-37256,
-37204,
-36940,
-36542,
-36150,
-36170,
-36204,
-36699,
-37047,
-37283,
-37492,
-37074,
-37150,
-36648,
-36758,
-36855,
-37341,
-37808,
-38393,
-38603,
-38656,
-38497,
-38156,
-38127,
-38127,
-38578,
-38946,
-39369,
-39554,
-39554,
-39607,
-39527,
-39845,
-40081,
-40479,
-40637,
-40530,
-40584,
-40321,
-40370,
-40138,
-39894,
-39715,
-39157,
-39077,
-38791,
-38837,
-38845,
-38547,
-38236,
-37493,
-37283,
-36861,
-37228,
-37286,
-37332,
-37181,
-36488,
-36122,
-35619,
-35671,
-35832,
-35909,
-35672,
-35248,
-34486,
-34323,
-34170,
-34770,
-35016,
-35113,
-34646,
-33847,
-33324,
-33030,
-33481,
-33795,
-34011,
-33583,
-32771,
-31892,
-31581,
-31657,
-32319,
-32688,
-32767,
-32106,
-31396,
-30652,
-30630,
-30839,
-31419,
-31607,
-31578,
-31182,
-30788,
-30653,
-30840,
-31025,
-31419,
-31183,
-31210,
-30864,
-31132,
-31128,
-31633,
-31604,
-31765,
-31524,
-31422,
-31657,
-31791,
-32450,
-32713,
-33166,
-33265,
-33484,
-33689,
-33930,
-34220,
-34377,
-34775,
-35011,
-35568,
-35987,
-36308,
-36462,
-36254,
-36095,
-36146,
-36545,
-37202,
-37864,
-38209,
-37940,
-37576,
-36753,
-36543,
-36651,
-37096,
-37496,
-37703,
-37312,
-36937,
-36228,
-35936,
-35644,
-35647,
-35593,
-35433,
-35383,
-35037,
-35091,
-34775,
-34852,
-34565,
-34454,
-34329,
-34137,
-34300,
-34115,
-34190,
-33934,
-33580,
-33354,
-33078,
-32983,
-33002,
-32928,
-32897,
-32796,
-32553,
-32373,
-32054,
-31630,
-31292,
-30518,
-30210,
-29357,
-29257,
-28699,
-28648,
-28279,
-27879,
-27516,
-27005,
-26778,
-26451,
-26354,
-26110,
-26034,
-25744,
-25739,
-25721,
-25924,
-26062,
-26032,
-25743,
-25346,
-24898,
-24951,
-25187,
-25876,
-26217,
-26403,
-25901,
-25505,
-24766,
-25109,
-25241,
-26270,
-26747,
-27036,
-26801,
-26453,
-26327,
-26399,
-27278,
-27773,
-28624,
-28883,
-29097,
-29150,
-29517,
-29865,
-30467,
-30974,
-31180,
-31369,
-31315,
-31524,
-31635,
-32050,
-32243,
-32552,
-32639,
-32738,
-32874,
-33083,
-33507,
-33745,
-34271,
-34379,
-34668,
-34748,
-34774,
-34642,
-34510,
-34115,
-33902,
-33692,
-33611,
-33772,
-33929,
-33928,
-33799,
-33372,
-32875,
-32396,
-31976,
-31868,
-31818,
-31999,
-31925,
-31735,
-31078,
-30391,
-29517,
-28967,
-28777,
-28808,
-29122,
-29043,
-28728,
-28065,
-27302,
-26588,
-26349,
-26378,
-26533,
-26563,
-26164,
-25718,
-24844,
-24422,
-23789,
-23603,
-23209,
-23048,
-22786,
-22758,
-22970,
-23076,
-23233,
-23077,
-22546,
-22231,
-21597,
-21622,
-21572,
-21647,
-21731,
-21252,
-20990,
-20408,
-20224,
-20144,
-20488,
-20830,
-21175,
-21491,
-21438,
-21729,
-21729,
-22019,
-22284,
-22651,
-23051,
-23577,
-23789,
-24237,
-24291,
-24526,
-24848,
-25132,
-25773,
-26135,
-26591,
-26770,
-26985,
-27222,
-27590,
-28173,
-28727,
-29175,
-29493,
-29466,
-29677,
-29891,
-30203,
-30708,
-30945,
-31341,
-31580,
-32158,
-32874,
-33796,
-34511,
-35116,
-35251,
-35487,
-35538,
-36150,
-36778,
-37708,
-38286,
-38733,
-38871,
-39180,
-39346,
-39895,
-40215,
-40584,
-40689,
-40927,
-40954,
-41348,
-41458,
-41638,
-41351,
-40953,
-40504,
-40399,
-40480,
-40924,
-41063,
-40843,
-40219,
-39233,
-38580,
-38072,
-38157,
-38258,
-38288,
-37968,
-37337,
-36569,
-36042,
-35593,
-35275,
-35012,
-34431,
-34061,
-33376,
-33187,
-32795,
-32767,
-32317,
-31952,
-31416,
-31053,
-30946,
-30916,
-30842,
-30732,
-29968,
-29599,
-28806,
-28857,
-28677,
-29067,
-28967,
-28963,
-28753,
-28569,
-28780,
-28910,
-29258,
-29172,
-29073,
-28804,
-28754,
-29229,
-29782,
-30577,
-30996,
-31051,
-30841,
-30651,
-30818,
-31416,
-32162,
-33084,
-33400,
-33613,
-33321,
-33323,
-33241,
-33851,
-34483,
-35699,
-36727,
-37866,
-38547,
-39030,
-39232,
-39295,
-39522,
-40113,
-40951,
-42301,
-43330,
-44307,
-44862,
-45231,
-45549,
-46076,
-46632,
-47370,
-47978,
-48426,
-48772,
-49058,
-49274,
-49404,
-49587,
-49380,
-49349,
-49008,
-48930,
-48794,
-48826,
-48584,
-48479,
-48084,
-47687,
-47583,
-47290,
-47345,
-47290,
-47056,
-46919,
-46607,
-46498,
-46446,
-46289,
-46260,
-45866,
-45523,
-44966,
-44651,
-44201,
-44150,
-44015,
-44047,
-44065,
-43888,
-43698,
-43092,
-42383,
-41504,
-40534,
-39763,
-39238,
-38656,
-38550,
-37891,
-37572,
-36730,
-36119,
-35436,
-34984,
-34511,
-34193,
-33532,
-33059,
-32158,
-31897,
-31288,
-31314,
-31131,
-31261,
-31025,
-30997,
-30708,
-30364,
-30125,
-29496,
-29224,
-28705,
-28696,
-28730,
-29094,
-29496,
-29727,
-29707,
-29305,
-29044,
-28676,
-28883,
-29152,
-29596,
-29757,
-29440,
-28938,
-28436,
-28067,
-28594,
-29177,
-30177,
-30762,
-30891,
-30867,
-30627,
-30866,
-31157,
-31947,
-32426,
-32791,
-32690,
-32581,
-32636,
-32898,
-33587,
-34193,
-34799,
-35041,
-35298,
-35202,
-35508,
-35545,
-35853,
-36122,
-36280,
-36463,
-36598,
-36595,
-36570,
-36358,
-35805,
-35487,
-35037,
-34909,
-34955,
-34989,
-35036,
-34906,
-34750,
-34507,
-34329,
-34030,
-33854,
-33292,
-33007,
-32238,
-31790,
-31077,
-30602,
-30046,
-29494,
-29174,
-28888,
-28961,
-28941,
-28910,
-28358,
-27618,
-26533,
-25349,
-24342,
-23445,
-22707,
-22388,
-21913,
-22075,
-21856,
-22051,
-21751,
-21652,
-21147,
-21015,
-20779,
-20804,
-20831,
-20489,
-20194,
-19699,
-19507,
-20042,
-20670,
-21941,
-22680,
-23153,
-22814,
-22466,
-21835,
-22021,
-22201,
-23052,
-23575,
-24055,
-24182,
-24347,
-24443,
-24719,
-24892,
-25140,
-25159,
-25294,
-25480,
-25952,
-26617,
-27192,
-27831,
-28066,
-28172,
-28252,
-28384,
-28751,
-29204,
-29598,
-29993,
-29971,
-30017,
-29733,
-29623,
-29466,
-29415,
-29517,
-29628,
-29806,
-29997,
-30096,
-30105,
-29831,
-29498,
-29091,
-28836,
-28699,
-28911,
-28992,
-29518,
-29731,
-30020,
-30286,
-30310,
-30550,
-30575,
-30786,
-30893,
-30918,
-30945,
-30709,
-30731,
-30525,
-30758,
-30973,
-31684,
-32450,
-33189,
-33799,
-33953,
-33825,
-33480,
-33241,
-32902,
-32949,
-32610,
-32609,
-32212,
-32239,
-32161,
-32553,
-32982,
-33319,
-33561,
-33189,
-32899,
-32266,
-31949,
-31629,
-31556,
-31575,
-31608,
-31763,
-31683,
-31765,
-31393,
-30893,
-30258,
-29889,
-29704,
-29967,
-30153,
-30497,
-31155,
-32504,
-35302,
-39051,
-43437,
-46763,
-48294,
-47161,
-44411,
-40664,
-38048,
-36517,
-36809,
-37572,
-38340,
-38654,
-38896,
-39077,
-39660,
-39740,
-38679,
-36099,
-32077,
-27937,
-24763,
-23422,
-23310,
-23739,
-23258,
-21704,
-19193,
-16922,
-15867,
-16314,
-17902,
-19957,
-21599,
-23073,
-24503,
-26272,
-28487,
-30418,
-31869,
-32159,
-32004,
-31628,
-32243,
-33739,
-36311,
-39259,
-42039,
-44175,
-45889,
-46821,
-47576,
-47798,
-47922,
-47503,
-47425,
-47000,
-46948,
-46764,
-46286,
-45655,
-44889,
-44015,
-43386,
-42509,
-41589,
-40634,
-40005,
-40081,
-41087,
-42722,
-44358,
-45129,
-44516,
-42671,
-40136,
-37570,
-35781,
-34349,
-33455,
-32265,
-30945,
-29598,
-28543,
-28038,
-27964,
-27773,
-27488,
-26455,
-25478,
-23895,
-22626,
-20514,
-18588,
-15678,
-13467,
-11452,
-10879,
-11321,
-12462,
-13568,
-14202,
-14362,
-14492,
-15366,
-16710,
-18851,
-20276,
-21201,
-20619,
-19405,
-17663,
-16313,
-15130,
-14516,
-13994,
-14017,
-14308,
-15285,
-16263,
-16975,
-16897,
-15997,
-14916,
-14625,
-15840,
-18771,
-22389,
-25901,
-27564,
-27804,
-26507,
-25242,
-24607,
-25610,
-27751,
-31181,
-35172,
-39842,
-44917,
-50009,
-54820,
-58036,
-59996,
-59833,
-59229,
-58223,
-58198,
-58857,
-59995,
-60864,
-61077,
-60546,
-59626,
-58697,
-58015,
-57457,
-56693,
-55636,
-53893,
-52071,
-49906,
-47951,
-45787,
-43645,
-41062,
-38547,
-35993,
-34084,
-32663,
-32212,
-32213,
-32925,
-33719,
-34852,
-35673,
-36438,
-36621,
-36598,
-36199,
-35646,
-35224,
-34931,
-35171,
-35778,
-36912,
-38313,
-39607,
-40742,
-41377,
-41638,
-41404,
-41136,
-40271,
-39707,
-38741,
-38017,
-37497,
-37098,
-37096,
-36968,
-36780,
-36385,
-35779,
-35380,
-35012,
-35065,
-35196,
-35224,
-34880,
-34482,
-33798,
-33771,
-34087,
-34906,
-35778,
-36332,
-36200,
-35567,
-34641,
-33692,
-33322,
-33242,
-33692,
-34351,
-35171,
-35909,
-36781,
-37284,
-37519,
-37416,
-36463,
-35542,
-34164,
-33351,
-32949,
-32981,
-33399,
-33561,
-33479,
-33085,
-32688,
-32423,
-32688,
-33216,
-34009,
-34642,
-35329,
-35591,
-35965,
-36065,
-35913,
-35591,
-35143,
-34539,
-34586,
-34355,
-34877,
-34644,
-34429,
-33693,
-33083,
-33322,
-34088,
-35988,
-37337,
-38470,
-37864,
-36359,
-33955,
-31500,
-29599,
-28328,
-27885,
-28011,
-28728,
-29731,
-30758,
-31554,
-31869,
-31710,
-31316,
-30865,
-30813,
-30919,
-31420,
-31631,
-31712,
-31288,
-30470,
-29703,
-29203,
-29385,
-30552,
-32579,
-35094,
-37624,
-39370,
-40002,
-39422,
-37759,
-35829,
-34089,
-33003,
-32637,
-32423,
-32661,
-32583,
-32660,
-32638,
-32791,
-32821,
-33084,
-33373,
-33773,
-34297,
-34458,
-34298,
-33322,
-31870,
-30098,
-28572,
-27771,
-27993,
-28906,
-30527,
-32210,
-33878,
-35010,
-35700,
-35565,
-34722,
-33692,
-32659,
-32507,
-32973,
-33618,
-33767,
-32821,
-30946,
-29279,
-28149,
-28697,
-29813,
-30625,
-30684,
-29939,
-30180,
-32635,
-37970,
-44544,
-49959,
-51015,
-47422,
-40296,
-33318,
-29575,
-30283,
-34114,
-38472,
-41216,
-41985,
-42089,
-43091,
-45286,
-47316,
-47293,
-43699,
-37574,
-31208,
-27433,
-27487,
-30600,
-33931,
-35538,
-33824,
-30233,
-26638,
-24927,
-25476,
-27013,
-28249,
-28306,
-27906,
-28015,
-29889,
-32766,
-35885,
-37122,
-35964,
-32793,
-29070,
-26800,
-27061,
-29918,
-34269,
-39002,
-42430,
-44257,
-44200,
-42592,
-39843,
-36491,
-33216,
-30576,
-29122,
-28622,
-29122,
-29863,
-30548,
-30894,
-30335,
-29099,
-26718,
-23605,
-19932,
-16317,
-13434,
-11353,
-10610,
-10663,
-11486,
-12958,
-14733,
-16657,
-18719,
-19933,
-20805,
-20196,
-18694,
-16365,
-13836,
-12114,
-11827,
-13305,
-16129,
-19881,
-23076,
-25426,
-25952,
-24980,
-22703,
-19698,
-16920,
-14839,
-14095,
-14574,
-15521,
-16264,
-15522,
-13306,
-10002,
-6599,
-4351,
-3482,
-3983,
-4828,
-4907,
-3930,
-1923,
-0,
-65535,
-0,
-65535,
-2,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-65535,
-2,
-65535,
-3,
-65535,
-2,
-5353,
-15657,
-23127,
-27461,
-29148,
-29652,
-30494,
-32744,
-36882,
-43046,
-50982,
-60501,
-65530,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65529,
-65534,
-65529,
-63327,
-57664,
-52022,
-47183,
-43358,
-40425,
-38155,
-35777,
-33400,
-30314,
-27455,
-24268,
-21594,
-19247,
-17584,
-16868,
-17187,
-18772,
-21331,
-24582,
-27512,
-29729,
-30762,
-30652,
-29812,
-28857,
-28200,
-28303,
-28939,
-29967,
-31660,
-33055,
-35067,
-36673,
-38025,
-38601,
-38182,
-36806,
-34722,
-32292,
-30259,
-28672,
-28122,
-28301,
-29258,
-30996,
-33218,
-35854,
-38316,
-40316,
-41274,
-41215,
-40375,
-39049,
-38579,
-38497,
-39923,
-41959,
-44569,
-46896,
-48691,
-49510,
-49614,
-49168,
-48530,
-48297,
-48399,
-49062,
-49507,
-49908,
-49323,
-48190,
-46341,
-44253,
-42566,
-41454,
-41483,
-42114,
-43357,
-44256,
-44727,
-44231,
-42958,
-41246,
-39288,
-37470,
-36277,
-35357,
-35300,
-35304,
-35698,
-35513,
-35172,
-34243,
-33298,
-32845,
-33057,
-33904,
-34958,
-35408,
-34908,
-33081,
-30473,
-27403,
-25112,
-23601,
-23739,
-24974,
-27302,
-29995,
-32580,
-34302,
-35010,
-34166,
-32796,
-30783,
-29550,
-29146,
-29863,
-31606,
-33346,
-35253,
-36566,
-37523,
-38496,
-39159,
-40582,
-41827,
-43751,
-45418,
-46973,
-47979,
-48029,
-47611,
-46285,
-45207,
-44148,
-44096,
-44546,
-45837,
-46871,
-47764,
-47584,
-46551,
-44651,
-42142,
-39605,
-37391,
-35749,
-34591,
-33822,
-32794,
-31130,
-28939,
-26005,
-23552,
-21569,
-20728,
-21145,
-21863,
-23179,
-23869,
-24132,
-23525,
-22308,
-20806,
-19271,
-18429,
-18085,
-18824,
-20248,
-22153,
-24209,
-25825,
-27008,
-27513,
-27696,
-27671,
-27644,
-27803,
-27775,
-27804,
-27167,
-26510,
-25478,
-24685,
-24241,
-24260,
-24742,
-25452,
-26241,
-26937,
-27348,
-27569,
-27325,
-27037,
-26404,
-26058,
-25930,
-26664,
-27804,
-29889,
-31737,
-33665,
-34906,
-35724,
-36281,
-36753,
-37522,
-38470,
-39791,
-41299,
-42694,
-44071,
-44940,
-45364,
-45100,
-44597,
-43912,
-43435,
-43462,
-43410,
-43542,
-43012,
-42249,
-40952,
-39766,
-38788,
-37969,
-37310,
-36622,
-35277,
-34324,
-32900,
-32133,
-31341,
-30523,
-29703,
-28490,
-27379,
-26537,
-26479,
-27013,
-28144,
-29414,
-30603,
-31894,
-32927,
-34218,
-35488,
-36649,
-37493,
-37735,
-37569,
-37234,
-37331,
-38053,
-39604,
-41536,
-43620,
-45125,
-45972,
-45865,
-45232,
-44043,
-42801,
-41510,
-40475,
-39664,
-39128,
-39080,
-39211,
-39552,
-39794,
-39605,
-39079,
-37970,
-36806,
-35568,
-34957,
-35067,
-35855,
-37099,
-38418,
-39448,
-39897,
-40294,
-40160,
-40322,
-40265,
-40215,
-39976,
-39658,
-39452,
-39444,
-39927,
-40555,
-40981,
-41085,
-40241,
-38735,
-36727,
-34460,
-32605,
-31081,
-30176,
-29705,
-29387,
-29361,
-29043,
-28753,
-28278,
-27459,
-26668,
-25478,
-24660,
-24052,
-24106,
-24845,
-26218,
-27803,
-29517,
-30736,
-31657,
-32292,
-33005,
-33981,
-35276,
-36492,
-37466,
-37891,
-37705,
-37310,
-36490,
-36412,
-36278,
-36624,
-36781,
-36543,
-35831,
-34562,
-32663,
-30521,
-27882,
-25162,
-22388,
-19645,
-17396,
-15180,
-13542,
-11984,
-10771,
-9660,
-8894,
-8236,
-7572,
-6943,
-5988,
-5251,
-4563,
-4090,
-3744,
-3351,
-2950,
-2532,
-2345,
-2610,
-3430,
-4323,
-5121,
-5380,
-5042,
-4878,
-4566,
-4906,
-5488,
-5621,
-5354,
-4250,
-3003,
-1899,
-1471,
-1082,
-837,
-24,
-65535,
-1,
-65535,
-1158,
-3796,
-6045,
-6991,
-6019,
-4165,
-2374,
-1526,
-1843,
-1898,
-866,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-288,
-8787,
-17189,
-25081,
-31289,
-36041,
-38313,
-38340,
-36226,
-33796,
-32743,
-35406,
-42328,
-53418,
-65532,
-65534,
-65530,
-65534,
-65531,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-63375,
-56348,
-51068,
-48374,
-47793,
-48981,
-50515,
-51012,
-49326,
-44837,
-37491,
-28520,
-19399,
-12413,
-8889,
-9983,
-14621,
-21994,
-29784,
-36594,
-41088,
-43223,
-43225,
-41402,
-39000,
-35724,
-33111,
-30892,
-30470,
-31657,
-34696,
-38893,
-43489,
-47529,
-50618,
-52309,
-52943,
-52309,
-50882,
-48269,
-44834,
-40771,
-36277,
-32955,
-31153,
-31950,
-35672,
-41058,
-47398,
-52626,
-55345,
-55425,
-52494,
-48557,
-44786,
-42772,
-43281,
-45545,
-49169,
-52386,
-54529,
-55133,
-53999,
-51914,
-49164,
-46501,
-44359,
-43146,
-42749,
-43093,
-43434,
-43068,
-41454,
-38155,
-33691,
-28622,
-24104,
-21203,
-20062,
-20992,
-22519,
-24266,
-24711,
-24001,
-22124,
-20012,
-18403,
-17950,
-18457,
-19640,
-20595,
-21042,
-20381,
-19432,
-18349,
-18083,
-18933,
-21222,
-24322,
-28009,
-31107,
-32923,
-32769,
-30468,
-26404,
-21993,
-18241,
-16741,
-17632,
-21045,
-25794,
-30946,
-35037,
-37786,
-38576,
-37944,
-36252,
-34219,
-32558,
-31893,
-32613,
-34689,
-37684,
-40817,
-43493,
-45361,
-46632,
-47792,
-49352,
-51489,
-53842,
-55873,
-57009,
-56904,
-55583,
-53154,
-50460,
-47503,
-45522,
-43963,
-43886,
-44016,
-44862,
-44730,
-44122,
-41825,
-39054,
-35272,
-32006,
-28801,
-26434,
-24446,
-22627,
-21070,
-19402,
-17639,
-16128,
-14652,
-13834,
-13620,
-14389,
-15944,
-18165,
-20117,
-22152,
-22996,
-23762,
-24053,
-24344,
-25291,
-26644,
-28829,
-31873,
-35299,
-39239,
-42643,
-45522,
-47371,
-48479,
-49272,
-50170,
-51385,
-52757,
-53788,
-54157,
-53893,
-53207,
-52915,
-52970,
-53655,
-54422,
-54763,
-54792,
-54342,
-53787,
-53288,
-52886,
-52260,
-51645,
-50859,
-50591,
-50988,
-52364,
-54154,
-55983,
-56952,
-57014,
-56108,
-55005,
-54102,
-54080,
-54684,
-55823,
-56769,
-57329,
-57086,
-56140,
-54711,
-52810,
-50804,
-48797,
-46894,
-45366,
-44146,
-43332,
-42695,
-41774,
-40635,
-38657,
-36331,
-33719,
-31051,
-29200,
-27594,
-26954,
-26459,
-26454,
-26562,
-26666,
-26880,
-27140,
-27304,
-27429,
-27568,
-27563,
-27883,
-27907,
-28226,
-27986,
-28042,
-27775,
-27802,
-28121,
-28540,
-29151,
-29280,
-29124,
-28303,
-27276,
-26085,
-25161,
-24451,
-23945,
-23711,
-23576,
-23631,
-23497,
-23235,
-22230,
-21016,
-19246,
-17742,
-16446,
-15445,
-14651,
-13515,
-12435,
-10742,
-9239,
-7362,
-5620,
-3561,
-1316,
-65535,
-0,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-65535,
-1,
-65535,
-3,
-65535,
-1,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-2,
-65535,
-6601,
-21409,
-33006,
-40212,
-44205,
-47157,
-51755,
-57696,
-65194,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65531,
-65534,
-65530,
-65534,
-65531,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-61497,
-50461,
-39500,
-29890,
-22018,
-16528,
-12933,
-10613,
-8313,
-5514,
-1872,
-65535,
-5,
-65535,
-4,
-65535,
-1,
-65535,
-65535,
-4908,
-8814,
-11009,
-11640,
-11826,
-12988,
-15391,
-19246,
-23340,
-26561,
-28516,
-29413,
-30364,
-31975,
-34827,
-37996,
-40768,
-42327,
-42380,
-41561,
-40107,
-38843,
-37571,
-36651,
-36120,
-36385,
-38287,
-41718,
-46526,
-51755,
-55979,
-58488,
-58989,
-57724,
-55952,
-54397,
-53995,
-54927,
-57481,
-60841,
-64535,
-65534,
-65534,
-65533,
-64352,
-60863,
-57804,
-56082,
-55666,
-55845,
-55585,
-54023,
-51096,
-47396,
-43752,
-40455,
-38017,
-35783,
-33898,
-32111,
-30889,
-30076,
-29702,
-29177,
-27881,
-25980,
-23579,
-21516,
-20726,
-20962,
-22417,
-23733,
-24399,
-23918,
-22627,
-21070,
-20328,
-20567,
-22204,
-24501,
-27143,
-29386,
-30842,
-31284,
-30765,
-29647,
-28492,
-27880,
-28384,
-30100,
-32952,
-36121,
-39343,
-41719,
-43145,
-43594,
-43093,
-42406,
-41667,
-41612,
-42276,
-43935,
-46027,
-48582,
-50938,
-52783,
-54263,
-55162,
-56082,
-56722,
-57720,
-58279,
-59121,
-59253,
-59572,
-59305,
-59178,
-58485,
-58068,
-57218,
-56536,
-55767,
-54897,
-53999,
-52520,
-50618,
-47927,
-45017,
-41987,
-39260,
-37048,
-35090,
-33241,
-31318,
-28960,
-26539,
-23891,
-21573,
-19403,
-17531,
-16050,
-14891,
-14597,
-15102,
-16763,
-18957,
-21490,
-23446,
-24845,
-25425,
-25718,
-26242,
-27355,
-29281,
-31552,
-34485,
-37202,
-40506,
-43619,
-47002,
-50011,
-51860,
-53048,
-52520,
-51359,
-49799,
-48559,
-47872,
-47926,
-48162,
-48746,
-48978,
-49169,
-49032,
-48614,
-47792,
-46579,
-44992,
-43544,
-42351,
-42197,
-42878,
-44628,
-46574,
-48722,
-50218,
-51520,
-51937,
-52547,
-52837,
-53524,
-54394,
-55610,
-57010,
-58487,
-59836,
-60785,
-61339,
-61554,
-61285,
-60708,
-59648,
-57936,
-55713,
-52997,
-49905,
-47081,
-44359,
-42117,
-40106,
-37972,
-35855,
-33271,
-30758,
-27857,
-24870,
-21517,
-18034,
-14516,
-11619,
-9551,
-8790,
-8869,
-9632,
-10033,
-10186,
-9556,
-8789,
-8207,
-8026,
-8415,
-8979,
-9602,
-10088,
-10688,
-11536,
-12645,
-13964,
-15391,
-16211,
-17078,
-17138,
-17341,
-17191,
-16786,
-15790,
-13937,
-11404,
-8314,
-5329,
-2820,
-1292,
-626,
-183,
-72,
-0,
-65535,
-0,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-0,
-0,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-65535,
-1,
-65535,
-3,
-65535,
-2,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-2,
-65535,
-3,
-65535,
-4,
-65535,
-1,
-65535,
-65535,
-7655,
-16261,
-23976,
-30413,
-35755,
-40871,
-45946,
-52098,
-59199,
-65534,
-65532,
-65534,
-65531,
-65534,
-65529,
-65534,
-65528,
-65534,
-65532,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-64375,
-53711,
-44146,
-35992,
-29991,
-25852,
-22755,
-19461,
-14913,
-8791,
-1657,
-2,
-65535,
-3,
-65535,
-1,
-443,
-7549,
-13171,
-17347,
-18928,
-18667,
-17133,
-15285,
-14573,
-15152,
-17769,
-21702,
-26376,
-31130,
-35145,
-38046,
-39795,
-39999,
-39346,
-37439,
-35330,
-33162,
-31633,
-30574,
-29864,
-29385,
-28834,
-28989,
-30156,
-32895,
-36891,
-41583,
-45631,
-48425,
-49273,
-48716,
-47345,
-46340,
-46288,
-47873,
-50908,
-55030,
-59650,
-63742,
-65534,
-65532,
-65534,
-65534,
-63558,
-62134,
-61706,
-62244,
-63367,
-63881,
-63739,
-62083,
-59515,
-56088,
-52411,
-48720,
-45653,
-43383,
-42194,
-42038,
-42245,
-42355,
-41454,
-39290,
-35911,
-31789,
-27988,
-24923,
-23341,
-22520,
-22285,
-21674,
-20727,
-19429,
-18484,
-18265,
-19066,
-20537,
-21942,
-22916,
-22654,
-21490,
-19776,
-18030,
-17056,
-16921,
-17797,
-19876,
-22525,
-25871,
-29126,
-32210,
-34249,
-35431,
-35358,
-34798,
-34089,
-34246,
-35354,
-37787,
-41215,
-45021,
-48850,
-52360,
-55110,
-57562,
-59309,
-60704,
-61607,
-62367,
-62979,
-63717,
-64640,
-65462,
-65532,
-65534,
-65534,
-65534,
-64535,
-63929,
-62765,
-61289,
-59041,
-55901,
-52414,
-48691,
-45575,
-42406,
-39475,
-36093,
-32532,
-29410,
-26803,
-25713,
-25268,
-25216,
-24605,
-23343,
-21408,
-19857,
-18979,
-19197,
-20354,
-21703,
-23286,
-24687,
-26534,
-28676,
-31444,
-34143,
-36752,
-38738,
-40660,
-42621,
-45200,
-48141,
-51064,
-53289,
-54419,
-54318,
-53283,
-51704,
-49930,
-48719,
-47527,
-47321,
-46971,
-47056,
-46814,
-46236,
-45047,
-43541,
-41587,
-39871,
-37917,
-36595,
-35094,
-34400,
-34013,
-34321,
-35569,
-37230,
-39526,
-41774,
-43989,
-46262,
-48585,
-51226,
-53840,
-56140,
-57535,
-58067,
-57694,
-57197,
-57112,
-57831,
-59384,
-61103,
-62555,
-63057,
-62369,
-60603,
-57879,
-54659,
-51016,
-47000,
-42748,
-38448,
-34347,
-30765,
-27798,
-25006,
-22414,
-19353,
-16183,
-12828,
-9821,
-7414,
-5067,
-3058,
-338,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-1,
-65535,
-0,
-65535,
-2,
-65535,
-3,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-2,
-65535,
-2,
-7545,
-17796,
-27141,
-34538,
-39631,
-42910,
-45758,
-49907,
-56585,
-65534,
-65533,
-65534,
-65534,
-65533,
-65534,
-65531,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-59859,
-51467,
-44515,
-38316,
-32580,
-26351,
-19510,
-11589,
-3268,
-1,
-65535,
-65535,
-0,
-65535,
-1,
-5646,
-12934,
-18456,
-21145,
-21072,
-18610,
-15207,
-12196,
-11084,
-12279,
-15941,
-21231,
-27219,
-33085,
-38022,
-41639,
-43332,
-42696,
-39659,
-34695,
-28700,
-22759,
-18190,
-15180,
-14123,
-14625,
-16396,
-19085,
-22762,
-26875,
-31027,
-34535,
-36412,
-36622,
-35277,
-33320,
-31686,
-31155,
-32346,
-35168,
-39609,
-44913,
-50303,
-54975,
-58357,
-59543,
-59625,
-58356,
-57193,
-56430,
-56321,
-56614,
-56905,
-56479,
-55691,
-53864,
-52232,
-49852,
-48085,
-46048,
-44969,
-44597,
-45363,
-47109,
-49005,
-50118,
-49854,
-47896,
-44654,
-41003,
-37523,
-34957,
-33218,
-32237,
-31898,
-31762,
-32081,
-32424,
-32766,
-33086,
-32793,
-32132,
-30551,
-28116,
-24876,
-21143,
-17165,
-13854,
-11356,
-10474,
-11091,
-13064,
-15921,
-18928,
-21730,
-23471,
-23763,
-22520,
-19590,
-16236,
-12829,
-10956,
-11032,
-13359,
-17503,
-22783,
-28309,
-33370,
-37470,
-40479,
-42112,
-43044,
-43115,
-43465,
-43645,
-44785,
-45889,
-47716,
-49481,
-51387,
-53521,
-55638,
-57933,
-59887,
-61315,
-61788,
-61393,
-60259,
-58539,
-56589,
-54313,
-52101,
-50430,
-49671,
-50221,
-51940,
-53998,
-55690,
-56057,
-55322,
-53467,
-51811,
-50535,
-50279,
-50907,
-52019,
-53631,
-55527,
-57619,
-59675,
-61367,
-62320,
-62313,
-61529,
-60280,
-59442,
-58936,
-59174,
-59414,
-59569,
-59045,
-58037,
-56271,
-53972,
-51095,
-47370,
-43488,
-38869,
-35009,
-31106,
-28409,
-26086,
-24396,
-22996,
-21755,
-20831,
-19828,
-19061,
-17899,
-16528,
-15073,
-13965,
-14071,
-15390,
-18244,
-22257,
-26930,
-32055,
-37256,
-42591,
-47609,
-52228,
-55690,
-58355,
-60100,
-61922,
-64296,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-63422,
-59521,
-56004,
-52047,
-47844,
-43146,
-38392,
-33928,
-29891,
-26296,
-22626,
-18614,
-14254,
-9476,
-5226,
-1259,
-2,
-65535,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-65535,
-1,
-65535,
-3,
-65535,
-2,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-65535,
-1,
-5618,
-19934,
-31922,
-40028,
-45551,
-49375,
-53895,
-60625,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65531,
-65534,
-65532,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-57616,
-49986,
-43513,
-38210,
-33055,
-27567,
-20934,
-13360,
-5433,
-2,
-65535,
-1,
-65535,
-4090,
-12301,
-20118,
-25980,
-29308,
-29413,
-27566,
-24183,
-20885,
-18691,
-17742,
-18982,
-21253,
-25215,
-29703,
-34538,
-38496,
-40637,
-40162,
-37096,
-32004,
-26321,
-20912,
-16817,
-13937,
-12435,
-11904,
-12935,
-15445,
-19509,
-24846,
-30390,
-35514,
-39131,
-41111,
-41484,
-40977,
-40270,
-40660,
-42223,
-45679,
-50568,
-56372,
-62295,
-65531,
-65534,
-65531,
-65534,
-65534,
-65534,
-65534,
-65532,
-65461,
-65534,
-64823,
-63378,
-60439,
-57090,
-53021,
-49350,
-45868,
-43090,
-41166,
-40188,
-40054,
-40295,
-40213,
-39263,
-37153,
-34112,
-30603,
-27036,
-24317,
-22019,
-20990,
-20222,
-20172,
-19774,
-19458,
-18877,
-18506,
-18561,
-18638,
-18639,
-17795,
-15760,
-13015,
-9396,
-6490,
-4303,
-3873,
-4991,
-7729,
-11616,
-15999,
-20301,
-23526,
-25294,
-25160,
-23422,
-20748,
-18008,
-16367,
-16395,
-18903,
-23418,
-29494,
-36224,
-42278,
-47234,
-50252,
-51780,
-51857,
-51389,
-50614,
-49751,
-49323,
-48506,
-48269,
-47951,
-48110,
-48770,
-49775,
-51066,
-52205,
-52650,
-52257,
-50592,
-47847,
-44042,
-39713,
-35513,
-31870,
-29466,
-28435,
-29047,
-31311,
-34856,
-38866,
-42696,
-45259,
-46419,
-46447,
-46287,
-47292,
-50011,
-54737,
-60154,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-63399,
-55584,
-48611,
-42882,
-39237,
-36119,
-33483,
-29595,
-25271,
-20405,
-16053,
-12828,
-10480,
-9107,
-7968,
-7154,
-6675,
-6862,
-7865,
-9712,
-11907,
-14227,
-16952,
-19771,
-23976,
-28937,
-34933,
-41191,
-46658,
-51093,
-53709,
-54950,
-55081,
-54951,
-55079,
-56141,
-58168,
-61079,
-64297,
-65534,
-65534,
-65533,
-64379,
-61101,
-57618,
-53918,
-50277,
-46181,
-42090,
-38365,
-35275,
-33455,
-32370,
-31791,
-31129,
-29783,
-28199,
-26165,
-24159,
-22124,
-19511,
-16527,
-12828,
-9477,
-7072,
-6465,
-7893,
-10609,
-13939,
-15973,
-16630,
-14892,
-11744,
-7471,
-2792,
-1,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-65535,
-1,
-65535,
-3,
-65535,
-2,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-3,
-65535,
-3,
-65535,
-1,
-5566,
-21703,
-34377,
-42962,
-49060,
-54131,
-59571,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65532,
-65534,
-65531,
-65534,
-65532,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-62927,
-55449,
-50304,
-45811,
-40902,
-34297,
-25533,
-15787,
-6517,
-0,
-65535,
-0,
-3639,
-10585,
-17265,
-22575,
-25452,
-25953,
-25084,
-22968,
-21018,
-19086,
-17690,
-17185,
-17584,
-19273,
-21807,
-24847,
-27508,
-29101,
-29357,
-28281,
-25978,
-23288,
-19721,
-16369,
-13066,
-10243,
-8760,
-8422,
-10372,
-14230,
-20143,
-27328,
-34668,
-41086,
-45389,
-47636,
-48320,
-48402,
-49349,
-51729,
-55900,
-61947,
-65534,
-65530,
-65534,
-65531,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-62368,
-58438,
-54498,
-50093,
-45890,
-41747,
-37994,
-34301,
-30758,
-27092,
-23733,
-20886,
-18928,
-18270,
-18084,
-18904,
-18717,
-18377,
-16577,
-14654,
-12510,
-11511,
-11349,
-12778,
-14677,
-16764,
-18376,
-18901,
-18351,
-17000,
-14995,
-13675,
-12961,
-14044,
-16554,
-20010,
-23923,
-27061,
-28993,
-29359,
-27935,
-25268,
-21833,
-18509,
-16076,
-15471,
-16737,
-19986,
-24660,
-29626,
-34455,
-38236,
-40765,
-41961,
-41928,
-41061,
-39685,
-38127,
-36677,
-35433,
-34565,
-34270,
-34697,
-36304,
-38710,
-41877,
-44757,
-46524,
-46792,
-44727,
-41457,
-36411,
-31499,
-26509,
-22495,
-19746,
-18325,
-18796,
-20963,
-24925,
-29781,
-34749,
-38551,
-40662,
-41219,
-41083,
-42065,
-44702,
-49537,
-55134,
-60415,
-64537,
-65534,
-65534,
-65533,
-65534,
-65531,
-65534,
-65530,
-65534,
-65531,
-65534,
-65534,
-65534,
-65534,
-63426,
-57194,
-50011,
-42934,
-36545,
-31260,
-27011,
-23103,
-19164,
-15052,
-10951,
-7603,
-5302,
-4591,
-4880,
-6070,
-7362,
-8578,
-9688,
-10635,
-11776,
-13038,
-14733,
-16895,
-20012,
-24317,
-29916,
-36806,
-44203,
-51435,
-57303,
-60809,
-61793,
-60385,
-58068,
-55714,
-54977,
-55980,
-58487,
-61340,
-63321,
-63638,
-62158,
-58965,
-54895,
-50356,
-45733,
-41323,
-37098,
-33400,
-30181,
-27668,
-25878,
-24446,
-23394,
-22070,
-21044,
-19562,
-18773,
-17396,
-16342,
-14309,
-11666,
-8342,
-5170,
-2926,
-2611,
-3981,
-6784,
-9924,
-12406,
-13465,
-12774,
-10138,
-5567,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-2,
-65535,
-3,
-65535,
-0,
-65535,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-2,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-8554,
-21276,
-30474,
-36803,
-41458,
-45337,
-49403,
-55452,
-64668,
-65533,
-65534,
-65532,
-65534,
-65534,
-65533,
-65534,
-65531,
-65534,
-65534,
-65532,
-65534,
-65528,
-65534,
-65531,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-63979,
-63032,
-62157,
-60048,
-55555,
-49775,
-43146,
-37729,
-35043,
-35719,
-40034,
-46047,
-52390,
-56771,
-58963,
-58700,
-57274,
-55582,
-54026,
-52625,
-50830,
-48165,
-44726,
-40799,
-36645,
-32823,
-29174,
-25876,
-22678,
-19618,
-16974,
-14494,
-12406,
-9846,
-6993,
-2927,
-65535,
-65535,
-1,
-65535,
-0,
-3270,
-11165,
-18799,
-25134,
-29413,
-32426,
-34666,
-37074,
-40476,
-45233,
-51594,
-59204,
-65532,
-65534,
-65532,
-65534,
-65534,
-65534,
-65532,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-63713,
-59734,
-55078,
-50806,
-46840,
-43412,
-39789,
-35992,
-31893,
-28675,
-26773,
-26851,
-28305,
-30126,
-31156,
-30258,
-27751,
-23681,
-19513,
-15811,
-13624,
-13091,
-13967,
-16050,
-18322,
-20436,
-21701,
-21889,
-20960,
-19646,
-18292,
-17877,
-18689,
-20754,
-23522,
-26273,
-28251,
-29175,
-29019,
-28249,
-27276,
-26615,
-26585,
-27437,
-29170,
-31980,
-35246,
-39028,
-42325,
-44995,
-46260,
-46606,
-45443,
-44173,
-42039,
-40608,
-38869,
-37730,
-36466,
-35590,
-34804,
-34798,
-35277,
-36543,
-37758,
-38446,
-37968,
-35726,
-32370,
-27962,
-23999,
-21043,
-19403,
-19565,
-21121,
-24052,
-28385,
-33583,
-39478,
-45149,
-49697,
-52545,
-53788,
-54132,
-55132,
-57540,
-62024,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-62448,
-59150,
-55080,
-49853,
-43226,
-35723,
-27804,
-20116,
-13174,
-7177,
-2110,
-65535,
-2,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-2056,
-5276,
-8314,
-11510,
-14253,
-17269,
-19930,
-23209,
-26852,
-31445,
-36837,
-42772,
-48562,
-53283,
-56510,
-57800,
-57459,
-56217,
-54790,
-54133,
-54075,
-54690,
-55235,
-55245,
-54470,
-52866,
-50644,
-48348,
-45680,
-43332,
-40740,
-38710,
-36807,
-35566,
-34564,
-33585,
-32477,
-30945,
-29360,
-27830,
-26640,
-25689,
-24662,
-23021,
-20595,
-17159,
-13517,
-9896,
-7445,
-6120,
-6335,
-7202,
-8395,
-8735,
-7655,
-4905,
-209,
-65535,
-2,
-65535,
-2,
-65535,
-3,
-65535,
-3,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-1,
-65535,
-2,
-65535,
-2,
-65535,
-2,
-65535,
-2,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-0,
-65535,
-0,
-65535,
-1,
-65535,
-5,
-65535,
-4,
-10317,
-25850,
-37599,
-45867,
-52201,
-56694,
-59939,
-62398,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65533,
-63614,
-60969,
-61313,
-63191,
-65087,
-65410,
-63450,
-59784,
-55477,
-51939,
-50355,
-51332,
-54869,
-61131,
-65533,
-65534,
-65534,
-65532,
-65534,
-65531,
-65534,
-65532,
-65534,
-65534,
-59570,
-51598,
-43461,
-36227,
-30100,
-24474,
-18904,
-13463,
-9185,
-6070,
-4351,
-2268,
-65535,
-1,
-65535,
-2,
-65535,
-3,
-65535,
-1,
-3955,
-12671,
-20171,
-26430,
-30786,
-34404,
-37705,
-42063,
-47979,
-55687,
-64881,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-61263,
-54181,
-46898,
-40264,
-35410,
-31631,
-28303,
-25508,
-23336,
-23238,
-25316,
-29523,
-34374,
-38659,
-40556,
-39739,
-36095,
-30865,
-25267,
-20594,
-17846,
-17452,
-19087,
-22522,
-26532,
-30368,
-33028,
-33641,
-32211,
-29308,
-25532,
-22891,
-21596,
-22785,
-25321,
-28779,
-31632,
-33454,
-33981,
-33217,
-32212,
-31103,
-30735,
-31472,
-33059,
-35749,
-38737,
-42062,
-44994,
-47635,
-49350,
-50330,
-49903,
-48457,
-45729,
-42489,
-38733,
-34801,
-30814,
-27009,
-23921,
-22337,
-22862,
-25165,
-28592,
-31712,
-33164,
-32475,
-29468,
-25266,
-20541,
-16791,
-14307,
-14204,
-16288,
-21201,
-27881,
-36095,
-44096,
-51067,
-56323,
-59281,
-60943,
-61499,
-62185,
-63241,
-64696,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-64377,
-59782,
-55926,
-53155,
-51013,
-49406,
-47712,
-45708,
-42987,
-39235,
-34513,
-28697,
-22419,
-16206,
-10878,
-7388,
-6149,
-7125,
-10295,
-14386,
-19116,
-23075,
-26032,
-27383,
-27613,
-26699,
-25421,
-24003,
-23100,
-22970,
-24292,
-27008,
-31159,
-36118,
-41008,
-45099,
-47608,
-48349,
-47262,
-44865,
-41479,
-37972,
-34720,
-32291,
-31105,
-31075,
-32057,
-33557,
-34723,
-35379,
-34989,
-33634,
-31822,
-29540,
-27410,
-25688,
-24264,
-23816,
-23972,
-24952,
-26295,
-27488,
-28250,
-28172,
-27249,
-25583,
-23658,
-21569,
-19749,
-18374,
-17188,
-16737,
-16527,
-16764,
-17187,
-17450,
-17028,
-15789,
-13197,
-9584,
-5326,
-500,
-65535,
-0,
-65535,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-2,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-0,
-0,
-65535,
-1,
-864,
-14574,
-26536,
-37201,
-45525,
-51065,
-53921,
-55741,
-58991,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-63108,
-62054,
-65275,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-61548,
-52102,
-42006,
-31976,
-22047,
-13065,
-5489,
-65535,
-65535,
-65535,
-2,
-65535,
-4,
-65535,
-2,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-7761,
-15600,
-22285,
-28171,
-33243,
-38154,
-43278,
-49376,
-56563,
-64638,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-64564,
-62474,
-61738,
-61760,
-62558,
-63873,
-65534,
-65534,
-65534,
-63848,
-59256,
-53997,
-48667,
-44806,
-41458,
-39181,
-36811,
-35193,
-34672,
-36171,
-39450,
-43990,
-48108,
-50885,
-50935,
-48744,
-44598,
-39526,
-34380,
-29438,
-25639,
-23126,
-22867,
-24658,
-28120,
-31975,
-34772,
-35174,
-33318,
-29416,
-25768,
-23101,
-22602,
-24156,
-26801,
-30126,
-33321,
-36096,
-38653,
-40296,
-41427,
-41933,
-42272,
-43040,
-44413,
-46208,
-48111,
-49931,
-51386,
-52598,
-53366,
-53258,
-52179,
-49771,
-46528,
-42641,
-38606,
-34323,
-29600,
-24816,
-20173,
-16763,
-15127,
-15391,
-17027,
-19011,
-20486,
-20594,
-19483,
-17134,
-14283,
-11719,
-9900,
-9869,
-11643,
-15548,
-21044,
-27352,
-33957,
-39789,
-44759,
-48715,
-51756,
-54183,
-55953,
-57300,
-58198,
-59041,
-59864,
-60889,
-61922,
-62529,
-62686,
-62107,
-61075,
-59756,
-58435,
-57063,
-55847,
-54131,
-52467,
-50143,
-47503,
-44836,
-41824,
-39291,
-36542,
-33956,
-31263,
-28408,
-25956,
-23893,
-22944,
-23234,
-24765,
-27169,
-29969,
-32449,
-34510,
-35620,
-36199,
-36175,
-35725,
-35457,
-34832,
-34796,
-34832,
-35640,
-37156,
-39337,
-41883,
-44039,
-45181,
-44836,
-43433,
-41274,
-39391,
-37657,
-36302,
-34672,
-32737,
-30737,
-29121,
-28358,
-28066,
-28225,
-28014,
-27618,
-27142,
-26587,
-26246,
-25821,
-25188,
-24318,
-23575,
-22867,
-23100,
-23394,
-24262,
-24635,
-24792,
-24132,
-23180,
-21599,
-19930,
-17876,
-16049,
-14309,
-13305,
-12724,
-12723,
-12804,
-12589,
-11856,
-10502,
-8739,
-6702,
-4457,
-2031,
-65535,
-2,
-65535,
-3,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-65535,
-65535,
-2,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-2,
-65535,
-2,
-65535,
-65535,
-65535,
-0,
-7836,
-20780,
-33268,
-43146,
-49536,
-51886,
-51675,
-51147,
-52996,
-58882,
-65534,
-65530,
-65534,
-65531,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-63927,
-55452,
-49377,
-47715,
-51040,
-58252,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-57010,
-46578,
-36068,
-26271,
-17926,
-10902,
-5250,
-233,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-4,
-65535,
-4,
-65535,
-923,
-5882,
-9372,
-12168,
-14679,
-18320,
-22867,
-29174,
-35858,
-43118,
-49351,
-54132,
-56269,
-55690,
-52783,
-48507,
-44597,
-41509,
-40081,
-39925,
-40794,
-42750,
-45362,
-48298,
-50430,
-51336,
-50587,
-48907,
-47447,
-46527,
-46630,
-46895,
-46685,
-46393,
-45812,
-46367,
-47582,
-50145,
-52913,
-55639,
-57693,
-58755,
-58408,
-56850,
-53947,
-50433,
-46896,
-43936,
-42381,
-41982,
-42962,
-44807,
-46765,
-48293,
-48323,
-46762,
-43700,
-40373,
-37626,
-36939,
-38341,
-41874,
-46662,
-51750,
-56221,
-59700,
-61368,
-61946,
-60893,
-59780,
-58148,
-57403,
-56957,
-57300,
-57986,
-58832,
-59545,
-59702,
-58911,
-56982,
-54239,
-50774,
-47480,
-43827,
-39954,
-35485,
-30260,
-25213,
-20753,
-17581,
-15816,
-15283,
-15630,
-16658,
-18111,
-19564,
-20434,
-20304,
-19297,
-17876,
-17290,
-18085,
-20358,
-24127,
-28309,
-32869,
-37233,
-40819,
-43570,
-44965,
-45181,
-44860,
-44521,
-44700,
-45499,
-46259,
-46896,
-46843,
-46233,
-45156,
-43405,
-41089,
-38363,
-35410,
-32819,
-30760,
-29414,
-28594,
-28252,
-28093,
-28330,
-28569,
-29044,
-29201,
-29335,
-29148,
-28808,
-28276,
-27223,
-25873,
-24451,
-23601,
-23951,
-25685,
-28599,
-31761,
-34670,
-36359,
-37096,
-36678,
-35722,
-34090,
-32265,
-30178,
-28200,
-27008,
-26538,
-27193,
-28331,
-29466,
-30047,
-29942,
-29097,
-28170,
-27435,
-27299,
-27514,
-28170,
-28596,
-29228,
-29677,
-30181,
-31022,
-31739,
-32791,
-33615,
-34349,
-35147,
-35510,
-35674,
-35434,
-34748,
-34061,
-33321,
-33058,
-33137,
-33559,
-33825,
-33741,
-32718,
-30994,
-28360,
-24975,
-21255,
-17185,
-13385,
-10373,
-8235,
-7521,
-7839,
-8682,
-9662,
-9950,
-9741,
-8735,
-7470,
-5512,
-2929,
-65535,
-0,
-65535,
-0,
-65535,
-2,
-65535,
-2,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-2,
-65535,
-4,
-65535,
-3,
-65535,
-0,
-65535,
-0,
-10662,
-22762,
-35852,
-48432,
-57770,
-62376,
-61968,
-59681,
-58512,
-60707,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65168,
-58885,
-53472,
-51064,
-52578,
-57743,
-64593,
-65531,
-65534,
-65533,
-65534,
-65532,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-61684,
-55423,
-49116,
-43196,
-37998,
-33530,
-29628,
-25052,
-20070,
-13908,
-8369,
-3691,
-1290,
-233,
-471,
-786,
-1370,
-2371,
-4354,
-7072,
-10293,
-13148,
-15468,
-17163,
-18954,
-21202,
-24341,
-28122,
-32131,
-35515,
-37811,
-38338,
-37204,
-34854,
-31684,
-28753,
-25981,
-23946,
-22733,
-22178,
-23233,
-24792,
-27488,
-29727,
-31264,
-31711,
-30969,
-30051,
-29094,
-28806,
-28623,
-28778,
-28992,
-29518,
-31209,
-33825,
-37625,
-42037,
-45943,
-49087,
-50806,
-51250,
-50726,
-49614,
-47898,
-45867,
-43778,
-42090,
-41507,
-42142,
-44387,
-47212,
-50592,
-53523,
-55663,
-56878,
-57035,
-56587,
-56032,
-56084,
-57355,
-59912,
-63506,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-64353,
-59200,
-54448,
-49800,
-45892,
-42379,
-39396,
-36648,
-34379,
-32239,
-30627,
-29231,
-28301,
-27541,
-27115,
-26799,
-26719,
-26643,
-26822,
-27173,
-28168,
-29549,
-31813,
-34513,
-37598,
-40425,
-42778,
-44171,
-44576,
-44250,
-42938,
-41426,
-39476,
-37599,
-35830,
-34248,
-32950,
-31712,
-30152,
-28331,
-25822,
-22970,
-20091,
-17161,
-15099,
-13545,
-13011,
-12938,
-13355,
-13676,
-13990,
-14310,
-14703,
-15630,
-16788,
-17902,
-18981,
-19591,
-20355,
-21279,
-22945,
-25213,
-27751,
-30178,
-32056,
-33557,
-34301,
-35088,
-35041,
-34852,
-33771,
-32106,
-30102,
-28117,
-26828,
-26242,
-26483,
-26615,
-26877,
-26034,
-25031,
-23152,
-21441,
-19666,
-18272,
-17608,
-17398,
-17795,
-18611,
-19380,
-20618,
-21678,
-23047,
-24425,
-25476,
-26272,
-26456,
-26587,
-26826,
-27565,
-28700,
-29861,
-30868,
-31391,
-31714,
-31894,
-31948,
-31950,
-31524,
-30578,
-28856,
-26617,
-23996,
-21416,
-19191,
-17637,
-16658,
-16420,
-16421,
-16686,
-17027,
-17451,
-17874,
-17924,
-17559,
-16313,
-14706,
-12723,
-11007,
-9608,
-8790,
-8100,
-7868,
-7439,
-7445,
-7256,
-6887,
-5939,
-3901,
-1346,
-65535,
-3,
-65535,
-0,
-65535,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-3,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-1421,
-11193,
-20803,
-29124,
-35170,
-38655,
-40771,
-41823,
-43251,
-44784,
-46443,
-48168,
-49822,
-52152,
-54923,
-58646,
-61975,
-64562,
-65246,
-64328,
-62683,
-61053,
-60493,
-60311,
-60204,
-58832,
-56402,
-52731,
-49457,
-47106,
-46710,
-47900,
-49851,
-52152,
-53945,
-55927,
-58039,
-60865,
-63954,
-65534,
-65534,
-65534,
-65329,
-63795,
-63375,
-64244,
-65534,
-65534,
-65534,
-65534,
-65534,
-65531,
-65534,
-65532,
-65534,
-65534,
-65534,
-62025,
-56984,
-51886,
-47450,
-43622,
-40370,
-37522,
-34536,
-32002,
-29492,
-28278,
-27776,
-28516,
-29651,
-30602,
-31288,
-31446,
-31633,
-32131,
-32559,
-33504,
-33852,
-34772,
-35489,
-37122,
-39688,
-43039,
-46948,
-51015,
-54184,
-56692,
-57537,
-57090,
-55503,
-53260,
-50883,
-48874,
-47055,
-45867,
-44726,
-44232,
-43750,
-43832,
-43886,
-44068,
-43728,
-43330,
-42061,
-40797,
-38839,
-36757,
-34588,
-32714,
-31316,
-30680,
-30391,
-30523,
-30521,
-30234,
-30045,
-29415,
-29253,
-28862,
-28617,
-28362,
-28140,
-28152,
-28456,
-29446,
-30703,
-32532,
-34325,
-36198,
-37629,
-39075,
-40403,
-41875,
-43648,
-45549,
-47501,
-49194,
-50724,
-51859,
-53076,
-54103,
-55188,
-55979,
-56588,
-56638,
-56614,
-55979,
-55373,
-54421,
-53444,
-52494,
-51649,
-50856,
-50117,
-49087,
-47819,
-46025,
-44042,
-41826,
-40055,
-38287,
-36991,
-35331,
-33979,
-32479,
-31525,
-31368,
-32001,
-33216,
-34747,
-35990,
-37256,
-38207,
-39317,
-40345,
-41165,
-41983,
-42301,
-42854,
-43332,
-44172,
-45076,
-46339,
-47370,
-48694,
-49532,
-50278,
-50195,
-49669,
-48268,
-46948,
-44941,
-43435,
-41642,
-39948,
-38394,
-36832,
-35647,
-34799,
-34300,
-34193,
-34404,
-34616,
-35064,
-35303,
-35672,
-35963,
-36569,
-37494,
-38788,
-40347,
-41851,
-43384,
-44490,
-45497,
-46314,
-47001,
-47873,
-48398,
-48852,
-48663,
-48349,
-47634,
-47237,
-46897,
-46816,
-46736,
-46288,
-45628,
-44412,
-43253,
-41875,
-40797,
-39764,
-38763,
-38232,
-37231,
-37018,
-36544,
-36701,
-37046,
-37600,
-38074,
-38234,
-38048,
-37786,
-37651,
-38235,
-39209,
-40374,
-41402,
-41798,
-42010,
-42009,
-42117,
-42272,
-42435,
-42350,
-42118,
-41981,
-41827,
-41982,
-41694,
-41269,
-40057,
-38603,
-36885,
-35332,
-34030,
-33116,
-32234,
-31635,
-30942,
-30261,
-29728,
-29153,
-28934,
-28650,
-28752,
-28673,
-28755,
-28647,
-28330,
-27936,
-27193,
-26140,
-25056,
-23604,
-22574,
-21674,
-21309,
-21304,
-21334,
-21253,
-20408,
-18877,
-16659,
-13990,
-11273,
-8497,
-5912,
-3427,
-1080,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-3,
-65535,
-1,
-65535,
-65535,
-65535,
-2,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-65535,
-708,
-2716,
-4749,
-7018,
-8949,
-11192,
-13277,
-15816,
-18213,
-20069,
-21673,
-22126,
-22705,
-22997,
-24079,
-25320,
-26878,
-28066,
-28781,
-29306,
-29758,
-30918,
-32556,
-34431,
-36438,
-37652,
-38577,
-39105,
-39606,
-40269,
-40820,
-41428,
-42065,
-42931,
-44389,
-46049,
-48136,
-49749,
-50748,
-51124,
-50799,
-50385,
-49850,
-49802,
-49535,
-49985,
-50143,
-50646,
-50882,
-51041,
-50724,
-50144,
-49404,
-48744,
-48769,
-49194,
-50485,
-51888,
-53443,
-54950,
-56192,
-57508,
-58518,
-59568,
-60577,
-61523,
-62713,
-64168,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65531,
-65534,
-65533,
-65534,
-65534,
-65532,
-65534,
-65531,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-64747,
-63320,
-61420,
-59280,
-57407,
-55554,
-54001,
-52703,
-51360,
-50249,
-49350,
-48400,
-47399,
-45915,
-44074,
-41768,
-39504,
-37122,
-34909,
-32500,
-30076,
-27485,
-25292,
-23369,
-21964,
-20674,
-19483,
-17953,
-16315,
-14493,
-12830,
-11270,
-10031,
-9317,
-8683,
-8843,
-8815,
-9422,
-9900,
-10424,
-11141,
-11693,
-12381,
-12961,
-13703,
-14410,
-15368,
-16604,
-17925,
-19831,
-21328,
-22894,
-23867,
-24448,
-24846,
-24896,
-25057,
-24818,
-24370,
-23604,
-22757,
-22100,
-21859,
-21995,
-22308,
-22575,
-22652,
-22547,
-22390,
-22309,
-22364,
-22519,
-22866,
-23179,
-23924,
-24656,
-25746,
-26717,
-27593,
-28410,
-28831,
-29388,
-29782,
-30470,
-31105,
-31761,
-32268,
-32554,
-32662,
-32663,
-32765,
-32769,
-33029,
-33113,
-33345,
-33457,
-33583,
-33666,
-33586,
-33347,
-32953,
-32450,
-32053,
-31950,
-32318,
-33135,
-34276,
-35509,
-36733,
-37755,
-38631,
-39422,
-40160,
-40955,
-41851,
-42881,
-43805,
-45048,
-45811,
-46844,
-47263,
-47820,
-48217,
-48716,
-49404,
-50012,
-50749,
-51176,
-51302,
-51229,
-50617,
-49933,
-48848,
-47609,
-46314,
-45153,
-44308,
-43856,
-43781,
-43857,
-43859,
-43991,
-43831,
-43780,
-43725,
-43648,
-43593,
-43569,
-43382,
-43226,
-42457,
-41509,
-40002,
-38472,
-37044,
-35938,
-35062,
-34433,
-33849,
-33321,
-32768,
-32134,
-31127,
-29867,
-27797,
-25642,
-23151,
-21044,
-18982,
-17187,
-15576,
-13937,
-12540,
-11191,
-9848,
-8522,
-6890,
-5460,
-3958,
-2847,
-1368,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-1,
-65535,
-2,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-1737,
-3797,
-5992,
-7915,
-9742,
-11375,
-13386,
-15495,
-18535,
-21384,
-24845,
-28121,
-31365,
-34751,
-37649,
-40561,
-42667,
-44521,
-45996,
-47635,
-49668,
-52176,
-55189,
-58143,
-60919,
-63188,
-64746,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-64274,
-62737,
-61659,
-60970,
-60732,
-60444,
-59992,
-58858,
-57169,
-54895,
-52310,
-49879,
-47634,
-45418,
-43434,
-41060,
-38920,
-36649,
-34616,
-32687,
-30629,
-28436,
-26007,
-23604,
-21384,
-19301,
-17344,
-15074,
-12725,
-10081,
-7972,
-5963,
-4959,
-3667,
-2741,
-1501,
-285,
-0,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-49,
-549,
-1237,
-2028,
-2769,
-3956,
-5224,
-6755,
-8262,
-9395,
-10348,
-11166,
-11930,
-12751,
-13332,
-13831,
-13993,
-14413,
-15047,
-16185,
-17951,
-19828,
-22019,
-24080,
-25925,
-27964,
-29544,
-31499,
-33112,
-34930,
-36652,
-38522,
-40480,
-42536,
-44360,
-45946,
-47105,
-48006,
-48637,
-49298,
-49747,
-50409,
-50696,
-50911,
-50749,
-50461,
-49774,
-49060,
-47926,
-47000,
-46024,
-45205,
-44783,
-44123,
-43805,
-43040,
-42510,
-41695,
-41322,
-40849,
-40953,
-41216,
-41748,
-42510,
-43146,
-43779,
-44228,
-44702,
-44918,
-45307,
-45631,
-46233,
-46790,
-47424,
-47950,
-48403,
-48319,
-48216,
-47529,
-47001,
-46288,
-45628,
-45072,
-44281,
-43621,
-42565,
-41480,
-39979,
-38389,
-36757,
-34852,
-33639,
-32160,
-31711,
-31102,
-31133,
-30835,
-30712,
-30070,
-29521,
-29043,
-28753,
-28754,
-29095,
-29256,
-29598,
-29519,
-29493,
-29227,
-28782,
-28249,
-27251,
-26215,
-25006,
-23812,
-22735,
-21780,
-20911,
-19933,
-18849,
-17664,
-16418,
-15263,
-14224,
-13362,
-12641,
-12066,
-11350,
-10532,
-9449,
-8181,
-6703,
-5384,
-4245,
-3536,
-3215,
-2928,
-2661,
-1951,
-1130,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-65535,
-2,
-65535,
-3,
-65535,
-1,
-65535,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-65535,
-1,
-65535,
-3,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-154,
-1632,
-3507,
-5753,
-7706,
-9951,
-11931,
-14388,
-16790,
-19405,
-21941,
-24684,
-27621,
-30994,
-34830,
-38812,
-42831,
-46523,
-49987,
-53337,
-56534,
-59466,
-62186,
-64427,
-65534,
-65531,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65531,
-65534,
-65531,
-65534,
-65533,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65355,
-63849,
-62132,
-60786,
-59464,
-58622,
-57774,
-56930,
-55796,
-54182,
-52548,
-50697,
-48902,
-47265,
-45285,
-43593,
-41405,
-39471,
-37313,
-35088,
-32822,
-30126,
-27670,
-24766,
-22284,
-19747,
-17636,
-15497,
-13568,
-11669,
-9712,
-7997,
-6043,
-4378,
-2479,
-681,
-65535,
-0,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-0,
-65535,
-1,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-470,
-1158,
-2134,
-2715,
-3587,
-4590,
-5700,
-7231,
-8788,
-10797,
-12908,
-15233,
-17662,
-20170,
-22681,
-25292,
-27910,
-30600,
-33428,
-35963,
-38549,
-40506,
-42326,
-43885,
-45099,
-46367,
-47424,
-48215,
-49220,
-49640,
-50224,
-50539,
-50539,
-50567,
-50089,
-49564,
-48874,
-48217,
-47343,
-46790,
-46051,
-45494,
-45180,
-44834,
-44890,
-45071,
-45260,
-45811,
-46235,
-46949,
-47555,
-48294,
-48692,
-49006,
-49222,
-49164,
-49379,
-49482,
-49668,
-49854,
-49694,
-49218,
-48481,
-47529,
-46471,
-45367,
-44170,
-42887,
-41582,
-39901,
-38496,
-36623,
-35065,
-33030,
-31184,
-29095,
-27329,
-25609,
-24371,
-23576,
-23102,
-22944,
-22812,
-22467,
-22100,
-21410,
-20727,
-20354,
-19909,
-19956,
-20069,
-20193,
-20438,
-20459,
-20383,
-19986,
-19403,
-18509,
-17476,
-16209,
-15050,
-13645,
-12568,
-11376,
-10346,
-9319,
-8180,
-7047,
-5859,
-4640,
-3750,
-2921,
-2587,
-2185,
-1792,
-1237,
-232,
-0,
-65535,
-0,
-65535,
-1,
-65535,
-1,
-65535,
-2,
-65535,
-4,
-65535,
-4,
-65535,
-2,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-2,
-65535,
-3,
-65535,
-1,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-0,
-0,
-72,
-183,
-415,
-948,
-1289,
-1791,
-1895,
-1847,
-2078,
-2112,
-3134,
-3959,
-5724,
-7391,
-9607,
-11826,
-14149,
-16500,
-18879,
-21303,
-23818,
-26585,
-29388,
-32636,
-35909,
-39447,
-43121,
-46893,
-50620,
-54106,
-57191,
-59758,
-61920,
-63901,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65531,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65531,
-65534,
-65531,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65530,
-65534,
-65532,
-65534,
-65534,
-65532,
-65534,
-65531,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65531,
-65534,
-65530,
-65534,
-65533,
-65534,
-65534,
-65532,
-65534,
-65532,
-65534,
-65533,
-65534,
-65064,
-63873,
-63086,
-62025,
-61526,
-60521,
-59835,
-58673,
-57617,
-56427,
-55084,
-53627,
-52100,
-50431,
-48772,
-46946,
-45049,
-43065,
-40901,
-38762,
-36462,
-34433,
-32212,
-30179,
-27988,
-25767,
-23554,
-21409,
-19382,
-17393,
-15475,
-13485,
-11540,
-9446,
-7629,
-5592,
-3984,
-2292,
-709,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-3,
-65535,
-2,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-1449,
-3217,
-5593,
-7681,
-9950,
-12169,
-14151,
-16393,
-18377,
-20803,
-23023,
-25425,
-27619,
-29729,
-31396,
-33135,
-34458,
-35829,
-37048,
-38231,
-39423,
-40741,
-41852,
-43094,
-44042,
-44677,
-45442,
-45707,
-46262,
-46843,
-47553,
-48456,
-49481,
-50461,
-51675,
-52704,
-53815,
-54712,
-55556,
-56218,
-56981,
-57329,
-58090,
-58278,
-58858,
-58883,
-58938,
-58725,
-58516,
-58302,
-57988,
-57774,
-57220,
-56773,
-55767,
-54792,
-53207,
-51727,
-49826,
-48190,
-46446,
-44940,
-43544,
-42297,
-41062,
-39895,
-38657,
-37230,
-35962,
-34379,
-33162,
-31738,
-30812,
-29864,
-29279,
-28730,
-28433,
-27936,
-27645,
-27114,
-26563,
-26269,
-25639,
-25477,
-25005,
-24817,
-24371,
-23839,
-23078,
-22096,
-21071,
-19695,
-18558,
-17189,
-16023,
-14837,
-13648,
-12724,
-11641,
-10875,
-10004,
-9342,
-8476,
-7781,
-7024,
-6276,
-5518,
-4747,
-3930,
-3087,
-2236,
-1531,
-732,
-287,
-0,
-65535,
-3,
-65535,
-2,
-65535,
-65535,
-1,
-65535,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-4,
-65535,
-2,
-65535,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-3,
-65535,
-3,
-65535,
-2,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-65535,
-339,
-1579,
-3403,
-4669,
-6571,
-8129,
-10003,
-11933,
-14333,
-17083,
-20459,
-24214,
-28327,
-32481,
-36328,
-40006,
-42906,
-45786,
-47953,
-50273,
-52312,
-54655,
-56882,
-59487,
-61765,
-64350,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65533,
-65534,
-65531,
-65534,
-65531,
-65534,
-65529,
-65534,
-65530,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-64851,
-63772,
-62711,
-61792,
-61153,
-60232,
-59597,
-58620,
-57750,
-56691,
-55584,
-54263,
-53021,
-51518,
-50433,
-48981,
-48084,
-46842,
-45786,
-44493,
-42987,
-41374,
-39398,
-37439,
-35172,
-33110,
-30865,
-28887,
-26770,
-24979,
-23021,
-21308,
-19536,
-17794,
-16130,
-14387,
-12752,
-11005,
-9425,
-7757,
-6255,
-4907,
-3640,
-2582,
-1714,
-891,
-313,
-0,
-65535,
-1,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-3,
-65535,
-713,
-1840,
-3273,
-4746,
-6679,
-8708,
-10903,
-13382,
-15525,
-17951,
-19935,
-22017,
-24002,
-25873,
-27883,
-29888,
-31975,
-34036,
-35961,
-37838,
-39606,
-41139,
-42618,
-43883,
-45101,
-46208,
-47159,
-48243,
-49191,
-50224,
-51305,
-52281,
-53394,
-54498,
-55506,
-56744,
-57828,
-59043,
-60285,
-61391,
-62583,
-63451,
-64378,
-65012,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65063,
-64114,
-63003,
-61948,
-60521,
-59069,
-57354,
-55344,
-53472,
-51092,
-48984,
-46708,
-44468,
-42378,
-40188,
-38207,
-36280,
-34455,
-32718,
-31074,
-29546,
-28094,
-26744,
-25534,
-24395,
-23549,
-22577,
-21883,
-21073,
-20432,
-19801,
-19513,
-19216,
-19198,
-19296,
-19195,
-19378,
-19010,
-18716,
-18061,
-17210,
-16265,
-15311,
-14202,
-13358,
-12168,
-11564,
-10610,
-10163,
-9580,
-9345,
-9052,
-8895,
-8658,
-8128,
-7627,
-6809,
-5936,
-4882,
-3877,
-2979,
-2213,
-1766,
-1499,
-1528,
-1870,
-2002,
-2504,
-2399,
-2450,
-1898,
-1368,
-523,
-0,
-65535,
-2,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-1,
-65535,
-2,
-65535,
-2,
-65535,
-65535,
-0,
-65535,
-0,
-0,
-65535,
-2,
-65535,
-5,
-65535,
-3,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-1,
-65535,
-1,
-549,
-1367,
-2321,
-3242,
-4328,
-5169,
-6336,
-7333,
-8581,
-10160,
-11775,
-14070,
-16446,
-19327,
-22071,
-25295,
-27960,
-30998,
-33586,
-36146,
-38579,
-40872,
-43226,
-45628,
-48186,
-50941,
-53676,
-56646,
-59089,
-61609,
-63398,
-64852,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65530,
-65534,
-65530,
-65534,
-65531,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-64029,
-62876,
-61628,
-60892,
-60127,
-59490,
-58911,
-58119,
-57193,
-56299,
-54920,
-54055,
-52701,
-51837,
-50723,
-49852,
-48825,
-47817,
-46633,
-45363,
-44043,
-42565,
-40978,
-39372,
-37517,
-35544,
-33529,
-31238,
-29201,
-26906,
-24896,
-22865,
-21016,
-19166,
-17506,
-15838,
-14203,
-12618,
-10901,
-9345,
-7705,
-6282,
-5010,
-3933,
-3294,
-2559,
-2291,
-1844,
-1423,
-996,
-553,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-2,
-65535,
-65535,
-0,
-65535,
-102,
-655,
-945,
-1845,
-2531,
-3928,
-5253,
-7175,
-9240,
-11351,
-13804,
-15843,
-18135,
-20092,
-22019,
-24000,
-25822,
-27987,
-29995,
-32264,
-34565,
-36858,
-38974,
-40874,
-42459,
-43885,
-45072,
-46104,
-47052,
-47953,
-48902,
-49798,
-50834,
-51775,
-52842,
-53968,
-54901,
-56134,
-57091,
-58328,
-59229,
-60415,
-61315,
-62130,
-63271,
-63898,
-65015,
-65532,
-65534,
-65533,
-65534,
-65532,
-65534,
-65531,
-65534,
-65533,
-65534,
-65534,
-65534,
-65532,
-64671,
-63027,
-61343,
-59252,
-57196,
-54895,
-52468,
-50090,
-47583,
-45045,
-42618,
-39951,
-37385,
-34806,
-31995,
-29577,
-27033,
-24768,
-22943,
-20963,
-19589,
-18032,
-16870,
-15682,
-14598,
-13596,
-12722,
-11828,
-11455,
-10902,
-10928,
-10875,
-11033,
-11300,
-11348,
-11405,
-11165,
-10690,
-10190,
-9501,
-8815,
-8341,
-7785,
-7469,
-7310,
-7125,
-7100,
-6965,
-6970,
-6699,
-6626,
-6307,
-5882,
-5571,
-5035,
-4593,
-4220,
-3876,
-3853,
-3769,
-4064,
-4246,
-4775,
-5198,
-5884,
-6413,
-7123,
-7603,
-8233,
-8606,
-8999,
-9344,
-9554,
-9926,
-10056,
-10373,
-10401,
-10689,
-10771,
-10954,
-11244,
-11326,
-11506,
-11486,
-11375,
-11087,
-10612,
-9896,
-9213,
-8208,
-7574,
-6623,
-5939,
-5301,
-4433,
-3930,
-3057,
-2559,
-1869,
-1422,
-1025,
-761,
-497,
-418,
-312,
-285,
-288,
-125,
-129,
-47,
-74,
-393,
-786,
-1660,
-2742,
-4087,
-5569,
-7282,
-8711,
-10320,
-11378,
-12512,
-13225,
-13939,
-14440,
-14968,
-15656,
-16421,
-17660,
-18933,
-20880,
-22656,
-24789,
-26644,
-28486,
-30023,
-31445,
-32636,
-33823,
-34906,
-36148,
-37361,
-38869,
-40450,
-42143,
-43990,
-45733,
-47530,
-48980,
-50593,
-51860,
-53154,
-54262,
-55320,
-56427,
-57486,
-58409,
-59411,
-60232,
-61075,
-61843,
-62660,
-63505,
-64563,
-65485,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65171,
-64508,
-64114,
-63610,
-63190,
-62686,
-62080,
-61473,
-60466,
-59468,
-58170,
-56587,
-55003,
-53152,
-51413,
-49719,
-48033,
-46470,
-44996,
-43382,
-41931,
-40346,
-38841,
-37309,
-35672,
-34246,
-32530,
-31103,
-29519,
-28119,
-26747,
-25504,
-24266,
-23310,
-22313,
-21515,
-20753,
-20117,
-19432,
-19061,
-18349,
-17953,
-17423,
-16791,
-16237,
-15548,
-14679,
-14070,
-13041,
-12354,
-11350,
-10427,
-9608,
-8604,
-7944,
-7045,
-6255,
-5542,
-4588,
-3800,
-2871,
-1980,
-1233,
-631,
-284,
-208,
-497,
-946,
-1738,
-2583,
-3561,
-4800,
-6071,
-7494,
-9106,
-10638,
-12590,
-14285,
-16206,
-18062,
-19823,
-21601,
-23151,
-24557,
-25874,
-26957,
-28095,
-29145,
-30210,
-31391,
-32452,
-33849,
-34933,
-36411,
-37520,
-38895,
-40027,
-41247,
-42404,
-43462,
-44626,
-45652,
-46976,
-48108,
-49644,
-51093,
-52573,
-54210,
-55425,
-56772,
-57748,
-58516,
-59278,
-59600,
-60044,
-60233,
-60335,
-60418,
-60281,
-59970,
-59674,
-58886,
-58223,
-57089,
-56059,
-54764,
-53498,
-52044,
-50619,
-48928,
-47504,
-45599,
-44126,
-42164,
-40720,
-38890,
-37629,
-36145,
-35040,
-33823,
-32740,
-31659,
-30601,
-29545,
-28544,
-27509,
-26749,
-25873,
-25347,
-24713,
-24316,
-23921,
-23551,
-23154,
-22760,
-22149,
-21731,
-21014,
-20331,
-19641,
-18745,
-18005,
-17083,
-16286,
-15525,
-14888,
-14415,
-14096,
-13807,
-13726,
-13650,
-13594,
-13516,
-13385,
-13170,
-12965,
-12747,
-12726,
-12617,
-12829,
-13068,
-13409,
-13941,
-14332,
-14918,
-15203,
-15710,
-15787,
-16051,
-15945,
-16131,
-15997,
-16158,
-16077,
-16078,
-16130,
-16078,
-16103,
-16078,
-15919,
-15840,
-15338,
-15022,
-14227,
-13730,
-12721,
-12013,
-10899,
-10007,
-8812,
-7895,
-6594,
-5596,
-4139,
-2955,
-1420,
-65535,
-0,
-65535,
-2,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-3,
-65535,
-1,
-65535,
-65535,
-1,
-65535,
-65535,
-897,
-3108,
-5490,
-7839,
-10291,
-12437,
-14649,
-16237,
-18137,
-19405,
-20989,
-22258,
-23709,
-25055,
-26378,
-27721,
-28862,
-30256,
-31158,
-32502,
-33163,
-34194,
-34879,
-35752,
-36543,
-37415,
-38312,
-39238,
-40319,
-41271,
-42564,
-43778,
-45339,
-46895,
-48610,
-50410,
-52464,
-54398,
-56480,
-58435,
-60232,
-61919,
-63219,
-64452,
-65437,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-64771,
-63137,
-61340,
-59755,
-58277,
-56852,
-55607,
-54426,
-53307,
-52155,
-51196,
-49960,
-49035,
-47870,
-46793,
-45757,
-44678,
-43885,
-43012,
-42487,
-41850,
-41377,
-40926,
-40505,
-40215,
-39790,
-39555,
-39130,
-38869,
-38443,
-37999,
-37437,
-36864,
-36119,
-35328,
-34539,
-33609,
-32823,
-31920,
-31052,
-30019,
-29203,
-28199,
-27432,
-26641,
-25795,
-25136,
-24317,
-23470,
-22655,
-21700,
-20781,
-19904,
-18906,
-18186,
-17455,
-16972,
-16661,
-16551,
-16712,
-16816,
-17295,
-17526,
-17956,
-18213,
-18616,
-18849,
-19193,
-19486,
-19797,
-20229,
-20588,
-20967,
-21462,
-21836,
-22546,
-23130,
-24024,
-24900,
-25953,
-26958,
-28040,
-28991,
-30020,
-31000,
-31788,
-32715,
-33323,
-34164,
-34778,
-35562,
-36310,
-37199,
-38026,
-38997,
-39899,
-40926,
-41746,
-42854,
-43569,
-44333,
-44969,
-45097,
-45392,
-45125,
-44835,
-44362,
-43856,
-43359,
-42905,
-42567,
-42272,
-42011,
-41825,
-41401,
-41061,
-40503,
-39714,
-39077,
-38050,
-37228,
-36308,
-35590,
-34777,
-34349,
-33773,
-33452,
-33031,
-32742,
-32343,
-31924,
-31578,
-31024,
-30708,
-30099,
-29704,
-29229,
-28833,
-28567,
-28173,
-28146,
-27827,
-27754,
-27480,
-27121,
-26848,
-26379,
-25926,
-25559,
-24897,
-24687,
-24263,
-24106,
-24052,
-24107,
-24236,
-24397,
-24659,
-24714,
-24949,
-24953,
-25133,
-25110,
-25400,
-25345,
-25798,
-26031,
-26483,
-27010,
-27460,
-28092,
-28569,
-29070,
-29359,
-29627,
-29755,
-29757,
-29837,
-29702,
-29785,
-29781,
-29890,
-29995,
-30177,
-30129,
-30282,
-30076,
-29941,
-29571,
-29176,
-28568,
-28015,
-27246,
-26696,
-25819,
-25217,
-24288,
-23421,
-22466,
-21414,
-20275,
-18930,
-17662,
-16024,
-14574,
-12880,
-11247,
-9474,
-7866,
-5962,
-4434,
-2607,
-1027,
-65535,
-65535,
-2,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-0,
-0,
-65535,
-1267,
-2315,
-3748,
-4932,
-6175,
-7416,
-8525,
-9845,
-10849,
-12090,
-13225,
-14283,
-15495,
-16554,
-17687,
-18851,
-19801,
-20964,
-21859,
-23024,
-23972,
-25163,
-26297,
-27380,
-28753,
-29862,
-31343,
-32764,
-34143,
-35617,
-36836,
-38047,
-39080,
-39975,
-40716,
-41484,
-42085,
-42912,
-43644,
-44625,
-45602,
-46551,
-47530,
-48427,
-49086,
-49747,
-50092,
-50511,
-50728,
-51037,
-51361,
-51752,
-52310,
-52917,
-53679,
-54266,
-55052,
-55745,
-56453,
-57168,
-57854,
-58489,
-59095,
-59677,
-60283,
-60866,
-61472,
-62106,
-62554,
-63190,
-63610,
-64115,
-64533,
-64828,
-65273,
-65488,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65354,
-65143,
-64615,
-64508,
-64063,
-63819,
-63455,
-63082,
-62634,
-62292,
-61655,
-61236,
-60495,
-59886,
-59098,
-58353,
-57408,
-56506,
-55451,
-54450,
-53336,
-52363,
-51121,
-50140,
-48829,
-47681,
-46425,
-45175,
-43967,
-42958,
-41827,
-41084,
-40136,
-39368,
-38657,
-37889,
-37231,
-36597,
-35829,
-35276,
-34617,
-34059,
-33483,
-33055,
-32478,
-32186,
-31658,
-31368,
-30970,
-30577,
-30337,
-30020,
-29864,
-29622,
-29469,
-29227,
-28886,
-28726,
-28199,
-28040,
-27591,
-27566,
-27326,
-27513,
-27484,
-27831,
-27906,
-28360,
-28539,
-29045,
-29334,
-29783,
-30127,
-30601,
-30998,
-31473,
-31976,
-32289,
-32876,
-33160,
-33694,
-34166,
-34482,
-35067,
-35353,
-35594,
-35777,
-35672,
-35434,
-35013,
-34455,
-33721,
-33028,
-32268,
-31629,
-31052,
-30470,
-30126,
-29545,
-29309,
-28804,
-28517,
-28146,
-27695,
-27330,
-26850,
-26456,
-26060,
-25610,
-25373,
-25057,
-24871,
-24712,
-24662,
-24420,
-24556,
-24183,
-24292,
-23999,
-23843,
-23680,
-23554,
-23416,
-23395,
-23312,
-23471,
-23447,
-23681,
-23738,
-23891,
-23897,
-24025,
-23973,
-24213,
-24208,
-24610,
-24921,
-25535,
-26109,
-26908,
-27800,
-28648,
-29810,
-30627,
-31766,
-32632,
-33562,
-34561,
-35356,
-36359,
-37150,
-38075,
-38895,
-39684,
-40401,
-41190,
-41719,
-42328,
-42774,
-42988,
-43383,
-43276,
-43491,
-43327,
-43413,
-43274,
-43385,
-43382,
-43489,
-43410,
-43224,
-42881,
-42432,
-41773,
-41059,
-40214,
-39395,
-38577,
-37943,
-37099,
-36648,
-35910,
-35355,
-34510,
-33612,
-32504,
-31234,
-29917,
-28224,
-26719,
-24979,
-23417,
-21703,
-20277,
-18533,
-17080,
-15288,
-13723,
-11804,
-10001,
-7945,
-5990,
-3955,
-2189,
-468,
-2,
-65535,
-2,
-65535,
-2,
-65535,
-2,
-65535,
-2,
-65535,
-2,
-65535,
-0,
-65535,
-0,
-65535,
-1,
-65535,
-0,
-65535,
-0,
-0,
-65535,
-1,
-65535,
-3,
-65535,
-1,
-65535,
-65535,
-2,
-65535,
-3,
-65535,
-0,
-0,
-65535,
-1,
-65535,
-0,
-65535,
-0,
-65535,
-575,
-1266,
-2395,
-3141,
-4218,
-5173,
-6305,
-7603,
-8813,
-10348,
-11589,
-13250,
-14469,
-15997,
-17107,
-18376,
-19403,
-20543,
-21647,
-22656,
-23917,
-24821,
-26085,
-26878,
-27909,
-28621,
-29439,
-29917,
-30493,
-30790,
-31233,
-31449,
-31894,
-32159,
-32717,
-33160,
-33933,
-34612,
-35595,
-36410,
-37548,
-38523,
-39661,
-40820,
-42038,
-43276,
-44545,
-45681,
-46974,
-48005,
-49192,
-50091,
-51120,
-51913,
-52810,
-53524,
-54342,
-55135,
-55951,
-56670,
-57532,
-58019,
-58615,
-58887,
-59122,
-59147,
-59123,
-58937,
-58804,
-58780,
-58646,
-58805,
-58858,
-59095,
-59387,
-59834,
-60126,
-60627,
-60918,
-61340,
-61630,
-62002,
-62421,
-62900,
-63425,
-63929,
-64561,
-64932,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65356,
-64823,
-63985,
-63132,
-62479,
-61495,
-60868,
-59885,
-59231,
-58194,
-57355,
-56268,
-55110,
-54050,
-52732,
-51648,
-50594,
-49560,
-48746,
-47896,
-47241,
-46499,
-45916,
-45102,
-44569,
-43729,
-43090,
-42354,
-41614,
-41059,
-40479,
-40001,
-39529,
-39209,
-38791,
-38547,
-38183,
-37942,
-37758,
-37363,
-37308,
-36861,
-36702,
-36411,
-36121,
-35830,
-35541,
-35221,
-34909,
-34666,
-34432,
-34140,
-34061,
-33771,
-33770,
-33587,
-33505,
-33243,
-33217,
-32791,
-32718,
-32368,
-32160,
-31951,
-31760,
-31635,
-31498,
-31287,
-31186,
-30942,
-30921,
-30731,
-30631,
-30653,
-30681,
-30920,
-31154,
-31422,
-31790,
-31974,
-32267,
-32105,
-32082,
-31763,
-31500,
-31183,
-30943,
-30815,
-30786,
-30866,
-30997,
-31078,
-31181,
-31000,
-30785,
-30444,
-29941,
-29467,
-28937,
-28464,
-28038,
-27726,
-27616,
-27486,
-27513,
-27404,
-27382,
-27221,
-27010,
-26852,
-26747,
-26507,
-26404,
-26297,
-26350,
-26403,
-26641,
-26930,
-27197,
-27721,
-28122,
-28750,
-29574,
-30126,
-30944,
-31501,
-32237,
-32901,
-33480,
-34086,
-34458,
-34854,
-35195,
-35463,
-35934,
-36096,
-36648,
-36808,
-37256,
-37626,
-37971,
-38363,
-38500,
-38733,
-38711,
-38945,
-38842,
-39024,
-38922,
-38866,
-38895,
-38734,
-38737,
-38469,
-38341,
-38047,
-37654,
-37468,
-37150,
-36939,
-36756,
-36357,
-35912,
-35405,
-34619,
-33741,
-32664,
-31392,
-30022,
-28567,
-27197,
-25793,
-24610,
-23363,
-22127,
-20803,
-19406,
-17925,
-16395,
-14757,
-13199,
-11325,
-9976,
-8288,
-7047,
-5856,
-4777,
-4034,
-3245,
-2978,
-2400,
-2555,
-2188,
-2451,
-2399,
-2873,
-3245,
-4007,
-4803,
-5434,
-6573,
-7334,
-8607,
-9446,
-10588,
-11163,
-11906,
-12408,
-13011,
-13626,
-14225,
-14839,
-15336,
-15894,
-16394,
-16738,
-17318,
-17425,
-17767,
-18032,
-18270,
-18796,
-19142,
-19643,
-20037,
-20595,
-20830,
-21412,
-21545,
-21939,
-22125,
-22364,
-22624,
-22867,
-23179,
-23367,
-23657,
-23814,
-24053,
-24369,
-24608,
-25054,
-25271,
-25581,
-25904,
-26083,
-26458,
-26666,
-27010,
-27355,
-27642,
-28069,
-28540,
-28939,
-29386,
-29678,
-29994,
-30180,
-30442,
-30604,
-30889,
-31053,
-31287,
-31447,
-31791,
-32132,
-32689,
-33294,
-34010,
-34878,
-35753,
-36779,
-37628,
-38417,
-38895,
-39289,
-39422,
-39607,
-39632,
-39846,
-39764,
-40030,
-39977,
-40265,
-40216,
-40371,
-40137,
-39947,
-39689,
-39393,
-39318,
-38972,
-38920,
-38551,
-38417,
-38077,
-37995,
-37468,
-37387,
-36810,
-36673,
-36335,
-36145,
-35911,
-35750,
-35516,
-35298,
-35254,
-35035,
-35013,
-34775,
-34560,
-34382,
-34057,
-34011,
-33796,
-33666,
-33691,
-33770,
-34088,
-34536,
-34828,
-35381,
-35513,
-35884,
-35856,
-36069,
-35909,
-36042,
-36014,
-36018,
-36303,
-36308,
-36648,
-36648,
-36994,
-37018,
-37468,
-37680,
-38205,
-38657,
-39263,
-39766,
-40346,
-40768,
-41218,
-41481,
-41826,
-42009,
-42485,
-42698,
-43275,
-43729,
-44331,
-44969,
-45549,
-46155,
-46869,
-47370,
-47899,
-48374,
-48639,
-48953,
-49063,
-49111,
-49036,
-48928,
-48743,
-48587,
-48452,
-48216,
-48137,
-47845,
-47741,
-47318,
-47078,
-46792,
-46392,
-46183,
-45707,
-45520,
-45101,
-44782,
-44440,
-43937,
-43620,
-43094,
-42694,
-42409,
-42112,
-42092,
-41929,
-42037,
-41957,
-42088,
-41985,
-41955,
-41828,
-41611,
-41377,
-41113,
-40845,
-40640,
-40475,
-40216,
-40161,
-39791,
-39925,
-39472,
-39557,
-39155,
-39002,
-38522,
-38367,
-37704,
-37707,
-37096,
-36942,
-36462,
-36149,
-35829,
-35620,
-35382,
-35090,
-34854,
-34325,
-34272,
-33851,
-33848,
-33456,
-33214,
-32768,
-32662,
-32212,
-32187,
-31762,
-31369,
-30944,
-30708,
-30443,
-30469,
-30339,
-30256,
-30102,
-30125,
-30127,
-30233,
-30255,
-30210,
-30096,
-30236,
-30413,
-30921,
-31207,
-31634,
-31815,
-32213,
-32634,
-32953,
-33348,
-33560,
-33637,
-34035,
-34299,
-35066,
-35379,
-36071,
-36091,
-36652,
-36832,
-37337,
-37599,
-37943,
-37944,
-38232,
-38288,
-38735,
-38787,
-39186,
-39077,
-39264,
-39238,
-39393,
-39425,
-39446,
-39343,
-39053,
-38945,
-38658,
-38654,
-38473,
-38391,
-38207,
-37997,
-37967,
-37629,
-37545,
-37152,
-36701,
-36279,
-35779,
-35380,
-35119,
-34799,
-34406,
-33953,
-33404,
-32896,
-32374,
-31973,
-31184,
-30864,
-29917,
-29650,
-28965,
-28647,
-28147,
-27590,
-27063,
-26563,
-26162,
-25879,
-25607,
-25323,
-25001,
-24714,
-24475,
-24395,
-24108,
-23944,
-23685,
-23497,
-23499,
-23498,
-23523,
-23605,
-23523,
-23501,
-23522,
-23499,
-23551,
-23576,
-23553,
-23523,
-23471,
-23527,
-23548,
-23554,
-23521,
-23396,
-23284,
-23183,
-22916,
-22812,
-22468,
-22179,
-21858,
-21495,
-21275,
-20994,
-20934,
-20672,
-20517,
-20352,
-19962,
-19932,
-19431,
-19194,
-18798,
-18321,
-18112,
-17766,
-17663,
-17345,
-17187,
-16949,
-16684,
-16659,
-16447,
-16474,
-16448,
-16445,
-16740,
-17001,
-17476,
-17955,
-18319,
-18826,
-19114,
-19536,
-19882,
-20221,
-20569,
-20777,
-21174,
-21545,
-22018,
-22522,
-23023,
-23497,
-24106,
-24581,
-25161,
-25823,
-26270,
-26931,
-27381,
-28039,
-28516,
-29256,
-29755,
-30444,
-30893,
-31550,
-31978,
-32633,
-33033,
-33636,
-34012,
-34505,
-35149,
-35536,
-36335,
-36648,
-37468,
-37810,
-38446,
-38866,
-39291,
-39844,
-40082,
-40609,
-40929,
-41321,
-41694,
-41984,
-42378,
-42645,
-43092,
-43223,
-43729,
-43856,
-44336,
-44623,
-44887,
-45261,
-45386,
-45711,
-45836,
-46025,
-46209,
-46233,
-46369,
-46287,
-46315,
-46313,
-46289,
-46154,
-45921,
-45679,
-45336,
-45312,
-44836,
-44754,
-44152,
-43749,
-43360,
-42826,
-42540,
-41955,
-41298,
-40715,
-39977,
-39316,
-38841,
-38074,
-37443,
-36621,
-35964,
-35327,
-34906,
-34380,
-33769,
-33271,
-32843,
-32480,
-32395,
-32161,
-32002,
-31814,
-31766,
-31816,
-31974,
-32161,
-32132,
-32214,
-32211,
-32321,
-32605,
-32639,
-32949,
-32927,
-33110,
-33270,
-33452,
-33588,
-33689,
-33535,
-33505,
-33402,
-33242,
-33137,
-32609,
-32476,
-31658,
-31421,
-30628,
-30205,
-29441,
-28856,
-28096,
-27590,
-27037,
-26508,
-25954,
-25425,
-24820,
-24527,
-24000,
-23710,
-23154,
-22811,
-22338,
-22017,
-21651,
-21412,
-21067,
-20886,
-20697,
-20620,
-20726,
-20672,
-20751,
-20673,
-20725,
-20805,
-20884,
-20909,
-21017,
-20908,
-21071,
-21173,
-21306,
-21519,
-21383,
-21520,
-21436,
-21625,
-21700,
-21864,
-21989,
-22023,
-22307,
-22496,
-22837,
-23155,
-23393,
-23682,
-24239,
-24685,
-25505,
-26140,
-26797,
-27541,
-28170,
-29098,
-29755,
-30762,
-31260,
-32161,
-32714,
-33664,
-34485,
-35407,
-36253,
-37072,
-37758,
-38735,
-39502,
-40397,
-41113,
-41773,
-42457,
-43147,
-43856,
-44652,
-45126,
-45707,
-46023,
-46552,
-46868,
-47266,
-47424,
-47607,
-47742,
-47922,
-48034,
-48372,
-48375,
-48744,
-48716,
-48956,
-48902,
-48850,
-48584,
-48270,
-47923,
-47742,
-47581,
-47318,
-47213,
-46762,
-46657,
-46343,
-46126,
-45737,
-45255,
-44678,
-44096,
-43541,
-43093,
-42722,
-42116,
-41693,
-41006,
-40637,
-40161,
-39712,
-39184,
-38498,
-37996,
-37309,
-36940,
-36358,
-36095,
-35565,
-35304,
-34904,
-34645,
-34402,
-34037,
-33715,
-33112,
-32687,
-32108,
-31895,
-31580,
-31497,
-31185,
-31050,
-30733,
-30762,
-30625,
-30658,
-30467,
-30419,
-30124,
-30472,
-30600,
-30973,
-31181,
-31157,
-31156,
-31316,
-31445,
-31871,
-31788,
-31765,
-31315,
-31261,
-31342,
-31472,
-31580,
-31208,
-30867,
-30521,
-30523,
-30550,
-30362,
-30049,
-29438,
-28913,
-28726,
-28437,
-28224,
-27697,
-27064,
-26507,
-26299,
-26006,
-25927,
-25400,
-24977,
-24739,
-24607,
-24899,
-24948,
-24847,
-24765,
-24475,
-24766,
-24870,
-25216,
-25029,
-25030,
-24898,
-25239,
-25692,
-26138,
-26508,
-26537,
-26795,
-26988,
-27482,
-27832,
-28065,
-28199,
-28463,
-28620,
-29177,
-29255,
-29597,
-29494,
-29676,
-29864,
-30151,
-30524,
-30627,
-30998,
-31079,
-31601,
-31848,
-32287,
-32428,
-32712,
-32900,
-33375,
-33848,
-34275,
-34534,
-34723,
-34853,
-35117,
-35461,
-35671,
-35910,
-36042,
-36358,
-36703,
-37228,
-37549,
-37730,
-37892,
-37836,
-38181,
-38261,
-38575,
-38659,
-38626,
-38739,
-38706,
-38922,
-38866,
-38974,
-38840,
-39106,
-39131,
-39606,
-39767,
-39973,
-40245,
-40341,
-40853,
-41081,
-41643,
-41824,
-42141,
-42381,
-42695,
-43093,
-43357,
-43515,
-43673,
-43648,
-43830,
-43993,
-44279,
-44229,
-44333,
-44070,
-43990,
-43833,
-43671,
-43571,
-43301,
-43042,
-42748,
-42432,
-42222,
-41771,
-41403,
-40822,
-40213,
-39687,
-39209,
-38684,
-38365,
-37943,
-37547,
-37255,
-36969,
-36883,
-36732,
-36435,
-35964,
-35539,
-35223,
-34933,
-34747,
-34353,
-34059,
-33536,
-33318,
-32982,
-32975,
-32638,
-32263,
-31819,
-31445,
-31262,
-31078,
-30865,
-30443,
-29995,
-29703,
-29520,
-29571,
-29388,
-29174,
-28702,
-28514,
-28226,
-28331,
-28250,
-28042,
-28012,
-27645,
-27882,
-27828,
-27935,
-27803,
-27564,
-27222,
-27090,
-26903,
-26695,
-26613,
-26219,
-26191,
-26008,
-26110,
-26089,
-26004,
-25824,
-25504,
-25558,
-25215,
-25320,
-24872,
-24659,
-24238,
-23920,
-23763,
-23577,
-23446,
-23233,
-22944,
-22759,
-22678,
-22444,
-22545,
-22154,
-22149,
-21757,
-21595,
-21387,
-21200,
-21016,
-20989,
-20726,
-20750,
-20543,
-20564,
-20569,
-20618,
-20726,
-20884,
-20988,
-21229,
-21357,
-21730,
-21992,
-22310,
-22706,
-22838,
-23472,
-23813,
-24610,
-25185,
-25640,
-26137,
-26324,
-26932,
-27378,
-28043,
-28460,
-28914,
-29200,
-29573,
-30231,
-30710,
-31390,
-31608,
-31815,
-31843,
-32083,
-32183,
-32796,
-32738,
-33192,
-33215,
-33481,
-33850,
-34166,
-34696,
-34983,
-35306,
-35430,
-35623,
-35774,
-35966,
-36119,
-36306,
-36279,
-36279,
-36254,
-36147,
-36200,
-36042,
-35935,
-35700,
-35274,
-35067,
-34745,
-34697,
-34667,
-34643,
-34326,
-34058,
-33431,
-33291,
-32851,
-32737,
-32268,
-31735,
-31157,
-30603,
-30335,
-30235,
-29992,
-29837,
-29308,
-29148,
-28834,
-28989,
-28834,
-28964,
-28594,
-28410,
-28199,
-27828,
-28068,
-27643,
-28067,
-27802,
-28015,
-27854,
-27724,
-27565,
-27537,
-27700,
-28010,
-28361,
-28564,
-28651,
-28699,
-28779,
-29045,
-29148,
-29204,
-29042,
-28674,
-28701,
-28568,
-29071,
-29069,
-29439,
-29230,
-29413,
-29281,
-29572,
-29704,
-29861,
-29997,
-29727,
-29681,
-29331,
-29152,
-28750,
-28677,
-28540,
-28701,
-28648,
-28673,
-28411,
-28091,
-27937,
-27721,
-27726,
-27589,
-27381,
-27273,
-27197,
-27273,
-27539,
-27671,
-27775,
-27776,
-27725,
-27958,
-28229,
-28591,
-28993,
-29200,
-29522,
-29648,
-30181,
-30442,
-30999,
-31207,
-31503,
-31786,
-32243,
-32631,
-33220,
-33688,
-34143,
-34693,
-35250,
-35990,
-36753,
-37126,
-37545,
-37470,
-37703,
-38024,
-38655,
-39423,
-40133,
-40638,
-40927,
-41428,
-42012,
-42852,
-43781,
-44280,
-44784,
-45045,
-45286,
-45706,
-45865,
-46210,
-46392,
-46765,
-47052,
-47424,
-47450,
-47607,
-47610,
-47949,
-48403,
-48953,
-49247,
-49456,
-49535,
-49907,
-50406,
-50990,
-51173,
-51093,
-50805,
-50828,
-51202,
-51936,
-52602,
-52888,
-52996,
-53075,
-53258,
-53894,
-54289,
-54633,
-54447,
-54133,
-53944,
-53655,
-53763,
-53469,
-53420,
-52968,
-52731,
-52493,
-52283,
-52177,
-51700,
-51388,
-50587,
-50123,
-49636,
-49276,
-48874,
-48400,
-47636,
-47000,
-46262,
-45891,
-45496,
-45205,
-44889,
-44226,
-43677,
-43035,
-42464,
-41952,
-41406,
-40820,
-40293,
-39714,
-39288,
-38736,
-38287,
-37625,
-37310,
-36701,
-36544,
-36201,
-35855,
-35488,
-34801,
-34192,
-33429,
-32792,
-32133,
-31608,
-30995,
-30604,
-30124,
-29679,
-29360,
-28939,
-28488,
-28120,
-27616,
-27356,
-27061,
-27012,
-26798,
-26720,
-26429,
-26166,
-25795,
-25478,
-25164,
-24948,
-24662,
-24315,
-24054,
-23734,
-23554,
-23547,
-23369,
-23522,
-23368,
-23418,
-23419,
-23471,
-23446,
-23366,
-23154,
-22997,
-22785,
-22837,
-22945,
-23074,
-23076,
-22997,
-22810,
-22786,
-23076,
-23286,
-23763,
-23655,
-23526,
-22969,
-22601,
-22389,
-22493,
-22707,
-22548,
-22598,
-22049,
-22095,
-21916,
-22176,
-22179,
-22230,
-22178,
-22520,
-22733,
-23286,
-23130,
-23154,
-23021,
-23316,
-24261,
-24953,
-25741,
-25796,
-25849,
-25979,
-26590,
-27324,
-27963,
-28119,
-28093,
-28119,
-28727,
-29439,
-30286,
-30548,
-30602,
-30179,
-30390,
-30340,
-30863,
-30763,
-30783,
-30315,
-30202,
-29998,
-30256,
-30285,
-30577,
-30466,
-30474,
-30228,
-30050,
-29914,
-29703,
-29970,
-29860,
-30339,
-30153,
-30230,
-30050,
-29886,
-30023,
-29886,
-29971,
-29727,
-29496,
-29200,
-28938,
-28543,
-28249,
-27806,
-27615,
-27382,
-27458,
-27035,
-26776,
-25872,
-25349,
-24817,
-24792,
-24528,
-24265,
-23629,
-22918,
-22838,
-22704,
-23184,
-23179,
-22760,
-22177,
-21518,
-21438,
-21649,
-22021,
-22042,
-21891,
-21383,
-21308,
-21147,
-21490,
-21546,
-21753,
-21810,
-21780,
-21888,
-21782,
-21834,
-21914,
-22044,
-22417,
-22574,
-22732,
-22521,
-22335,
-22311,
-22415,
-23023,
-23208,
-23602,
-23473,
-23287,
-23312,
-23261,
-23789,
-24104,
-24372,
-24499,
-24239,
-24342,
-24239,
-24553,
-24792,
-24793,
-24923,
-24609,
-24684,
-24820,
-24976,
-25242,
-25134,
-25031,
-24711,
-24584,
-24551,
-24504,
-24712,
-24765,
-25137,
-25266,
-25769,
-25612,
-25873,
-25957,
-26241,
-26802,
-27060,
-27118,
-27009,
-26774,
-27221,
-27565,
-28251,
-28198,
-28041,
-27908,
-28305,
-29254,
-30126,
-30787,
-30550,
-30547,
-30525,
-31311,
-31925,
-32132,
-31792,
-31312,
-31660,
-32555,
-33665,
-33929,
-33613,
-33030,
-34009,
-35963,
-38997,
-41247,
-42166,
-41985,
-41401,
-41298,
-41454,
-41193,
-40609,
-39766,
-39711,
-40611,
-41746,
-42405,
-42196,
-41692,
-41614,
-42829,
-44068,
-45021,
-44836,
-44360,
-44413,
-45760,
-47421,
-48642,
-48476,
-47611,
-46815,
-47185,
-48138,
-49058,
-49170,
-48582,
-48508,
-49298,
-51198,
-53342,
-54471,
-54608,
-53681,
-52679,
-52071,
-51516,
-51517,
-51120,
-51095,
-51278,
-51648,
-52416,
-52385,
-52207,
-51171,
-50170,
-49669,
-49454,
-49908,
-50037,
-50011,
-49299,
-48981,
-48664,
-49114,
-49509,
-49536,
-49114,
-48136,
-47318,
-46842,
-46500,
-46260,
-45576,
-44861,
-44308,
-44122,
-44122,
-43938,
-43225,
-42300,
-41481,
-41033,
-41243,
-41300,
-41451,
-41063,
-40448,
-39953,
-39288,
-38736,
-38101,
-37257,
-36780,
-36201,
-35829,
-35278,
-34692,
-34012,
-33635,
-33589,
-33609,
-33720,
-33506,
-33164,
-32661,
-32477,
-32079,
-32084,
-31734,
-31819,
-31656,
-31765,
-31314,
-30708,
-29704,
-29096,
-28885,
-29308,
-29651,
-29941,
-29309,
-28962,
-28519,
-28723,
-29152,
-29201,
-29017,
-28463,
-28543,
-28962,
-30130,
-30544,
-30660,
-29698,
-28996,
-28406,
-28862,
-29595,
-30315,
-30703,
-30633,
-30332,
-30185,
-30016,
-30156,
-30178,
-30073,
-29995,
-29624,
-29414,
-29095,
-28940,
-28963,
-29334,
-29574,
-30176,
-30367,
-30309,
-30260,
-29834,
-29865,
-29807,
-30234,
-30732,
-31289,
-31975,
-32450,
-32979,
-33399,
-33616,
-33555,
-33378,
-33108,
-33059,
-33558,
-34301,
-35379,
-35912,
-35988,
-35539,
-34855,
-34852,
-35357,
-36303,
-36758,
-36408,
-35332,
-34481,
-34221,
-35012,
-35803,
-36043,
-35274,
-33957,
-32925,
-32742,
-33002,
-33431,
-33159,
-32771,
-32448,
-32926,
-33903,
-34641,
-34907,
-34167,
-33533,
-33109,
-33350,
-33635,
-33618,
-32813,
-31981,
-31284,
-31661,
-32502,
-33400,
-33297,
-32000,
-30233,
-28885,
-28779,
-29758,
-30680,
-30760,
-29678,
-28330,
-27856,
-28356,
-29442,
-29516,
-28598,
-26901,
-25799,
-25819,
-26512,
-27085,
-26407,
-25370,
-24451,
-24606,
-25479,
-26217,
-26088,
-25371,
-24635,
-24580,
-24818,
-24978,
-24422,
-23735,
-23446,
-24078,
-25030,
-25691,
-25187,
-23974,
-22758,
-22468,
-23024,
-23893,
-24396,
-24133,
-23496,
-22866,
-22731,
-22733,
-23181,
-23261,
-23602,
-23712,
-23574,
-23053,
-22227,
-21440,
-21121,
-21412,
-21992,
-22603,
-22807,
-22763,
-22782,
-22892,
-23261,
-23337,
-23106,
-22623,
-21838,
-21830,
-21891,
-22650,
-23343,
-23785,
-23765,
-23575,
-23104,
-23022,
-22653,
-22758,
-22707,
-23259,
-23975,
-24976,
-25637,
-25373,
-24396,
-23286,
-22867,
-23970,
-25692,
-26982,
-26828,
-25238,
-23898,
-23573,
-25271,
-26770,
-27751,
-27037,
-26138,
-26430,
-27802,
-29440,
-29520,
-28118,
-26562,
-26800,
-29225,
-31849,
-33077,
-31769,
-30018,
-29704,
-31581,
-33610,
-33983,
-31393,
-28647,
-28016,
-30627,
-34404,
-36280,
-34667,
-31474,
-30155,
-32235,
-36784,
-39790,
-39369,
-35859,
-32553,
-32242,
-34903,
-38791,
-40581,
-40269,
-38444,
-37257,
-37651,
-38870,
-39894,
-40323,
-40290,
-40613,
-41480,
-42328,
-42827,
-42724,
-42617,
-42696,
-43331,
-43752,
-43779,
-43066,
-42302,
-42166,
-43227,
-44701,
-45919,
-45073,
-43014,
-40531,
-40134,
-42275,
-45864,
-48217,
-47581,
-44598,
-42220,
-42857,
-46180,
-49538,
-49402,
-45946,
-41955,
-41193,
-44439,
-48585,
-49774,
-46790,
-42457,
-41062,
-43934,
-48166,
-49269,
-45657,
-40079,
-37523,
-40502,
-45841,
-49324,
-47106,
-42169,
-38259,
-39344,
-43382,
-46051,
-44888,
-40081,
-36915,
-37334,
-41193,
-44491,
-44333,
-41246,
-38126,
-37734,
-39525,
-41245,
-40637,
-38180,
-36069,
-36252,
-38182,
-39790,
-39424,
-37490,
-35914,
-36092,
-37627,
-38605,
-37648,
-35070,
-32710,
-31872,
-32898,
-34168,
-34931,
-34803,
-34665,
-35121,
-35723,
-35540,
-33850,
-31288,
-29281,
-29071,
-30232,
-32185,
-33006,
-32713,
-31527,
-30496,
-30179,
-30496,
-31050,
-31501,
-31762,
-31897,
-31790,
-31736,
-31448,
-31446,
-31791,
-32212,
-32662,
-32370,
-31606,
-30548,
-30207,
-30390,
-31526,
-32291,
-32107,
-30524,
-28435,
-26932,
-27696,
-30205,
-33086,
-34403,
-32688,
-29705,
-27008,
-27330,
-29675,
-32109,
-32185,
-29651,
-27064,
-26612,
-29338,
-32473,
-33719,
-31474,
-28038,
-26590,
-27933,
-31077,
-32504,
-31340,
-29230,
-28672,
-30842,
-33398,
-33456,
-30759,
-27249,
-27194,
-30550,
-34746,
-35252,
-31127,
-25534,
-23364,
-26747,
-32451,
-35829,
-33429,
-28118,
-24212,
-25426,
-30073,
-33771,
-33321,
-29282,
-25664,
-25478,
-28436,
-31394,
-31447,
-28859,
-26271,
-26059,
-28357,
-30814,
-31498,
-30181,
-28672,
-28465,
-29358,
-30366,
-29861,
-28912,
-28332,
-29331,
-30738,
-31231,
-29892,
-27590,
-26165,
-26773,
-28833,
-30627,
-30788,
-29306,
-27724,
-26878,
-27328,
-27803,
-28250,
-27829,
-28172,
-28596,
-29597,
-29891,
-29383,
-28731,
-28433,
-29204,
-29730,
-29518,
-28464,
-27088,
-27171,
-28301,
-29707,
-30071,
-28993,
-27484,
-27222,
-28252,
-29650,
-29995,
-28594,
-27011,
-26799,
-28805,
-31501,
-33003,
-31950,
-29360,
-27406,
-27408,
-29201,
-30945,
-31104,
-29860,
-28520,
-28564,
-30156,
-32236,
-33034,
-32289,
-30261,
-28752,
-28092,
-28888,
-29462,
-29841,
-28986,
-28387,
-27932,
-28887,
-30284,
-31764,
-32106,
-31078,
-29044,
-27141,
-26062,
-26532,
-27937,
-29360,
-30151,
-29760,
-28935,
-28175,
-28038,
-28621,
-29256,
-29386,
-28807,
-27907,
-27117,
-27273,
-28279,
-29756,
-30839,
-30999,
-30100,
-28857,
-28308,
-28273,
-29445,
-30069,
-30420,
-29649,
-29098,
-29043,
-30417,
-32371,
-34061,
-34246,
-32820,
-30232,
-28199,
-27275,
-28249,
-29866,
-31284,
-31900,
-31443,
-31160,
-31206,
-32214,
-33215,
-33825,
-33320,
-32189,
-31178,
-31055,
-31946,
-33455,
-34484,
-34825,
-34169,
-33134,
-32348,
-32157,
-32980,
-34377,
-35858,
-36806,
-36492,
-35512,
-34141,
-34141,
-35143,
-36993,
-37995,
-37415,
-35567,
-34008,
-33929,
-35909,
-38235,
-39578,
-38712,
-36936,
-35437,
-35988,
-38128,
-40293,
-41218,
-39817,
-37495,
-35619,
-35566,
-37442,
-39816,
-41325,
-41216,
-39661,
-37784,
-36754,
-36755,
-37468,
-38180,
-38446,
-38654,
-38922,
-39474,
-39844,
-39766,
-39473,
-39582,
-40451,
-41666,
-41827,
-40449,
-37629,
-35616,
-35463,
-38021,
-41324,
-43092,
-42380,
-39659,
-37415,
-37046,
-38602,
-40399,
-41113,
-40027,
-38580,
-37808,
-38685,
-40476,
-41800,
-42009,
-40610,
-39133,
-38020,
-38077,
-38840,
-39660,
-40055,
-39818,
-39528,
-39316,
-39184,
-38789,
-37756,
-36679,
-36249,
-36942,
-38471,
-39526,
-39504,
-38468,
-38130,
-39104,
-41534,
-43068,
-42325,
-39317,
-36227,
-35327,
-37523,
-40688,
-42248,
-41375,
-38975,
-37703,
-38606,
-40132,
-40533,
-38814,
-36490,
-35884,
-37679,
-40160,
-40506,
-38127,
-34563,
-33243,
-35037,
-38473,
-40106,
-38289,
-34191,
-31395,
-31764,
-34879,
-37362,
-37627,
-35248,
-33165,
-32687,
-34061,
-35171,
-34984,
-33165,
-32290,
-32109,
-33346,
-33641,
-32791,
-31555,
-31286,
-32584,
-33901,
-33562,
-31364,
-29152,
-29017,
-31286,
-33828,
-33951,
-31026,
-27381,
-26110,
-28809,
-32817,
-35332,
-33608,
-29630,
-26159,
-25669,
-27693,
-29495,
-29466,
-28065,
-27223,
-28251,
-30073,
-30498,
-28672,
-25849,
-24607,
-26060,
-29334,
-31262,
-30734,
-28171,
-26114,
-25953,
-27406,
-28148,
-27218,
-25377,
-24261,
-25770,
-28569,
-30705,
-30262,
-27377,
-24450,
-23128,
-24845,
-27274,
-29308,
-28673,
-26562,
-24158,
-23446,
-24711,
-26801,
-28170,
-27804,
-26482,
-25610,
-26087,
-27484,
-28279,
-27142,
-24951,
-23656,
-24871,
-28411,
-30600,
-30049,
-25900,
-21887,
-21043,
-24264,
-28646,
-30499,
-27905,
-23394,
-20937,
-22730,
-26987,
-30045,
-29255,
-25744,
-23048,
-23525,
-26745,
-29442,
-29252,
-26195,
-23153,
-22494,
-24688,
-27432,
-28727,
-27591,
-26007,
-24923,
-26061,
-27539,
-28935,
-28968,
-28513,
-28014,
-28253,
-28514,
-28172,
-27250,
-26030,
-26037,
-27535,
-30076,
-32210,
-32348,
-30414,
-27567,
-25503,
-26193,
-28356,
-31078,
-31737,
-30337,
-27857,
-26452,
-26539,
-28063,
-28810,
-28565,
-27936,
-28066,
-30391,
-33110,
-34960,
-33874,
-30657,
-27300,
-26165,
-28093,
-31895,
-35039,
-35805,
-33743,
-30259,
-27933,
-27329,
-29439,
-32054,
-33983,
-34033,
-32504,
-30338,
-29332,
-29443,
-30916,
-32294,
-33319,
-33034,
-32263,
-31053,
-30388,
-30208,
-30626,
-31528,
-31841,
-31738,
-30972,
-30363,
-30787,
-32265,
-33823,
-34221,
-32554,
-29917,
-28064,
-28862,
-31919,
-35252,
-36647,
-35145,
-32609,
-31075,
-31714,
-33503,
-34752,
-33951,
-32665,
-31708,
-32611,
-33612,
-33768,
-32507,
-31681,
-32875,
-35962,
-38338,
-37653,
-33745,
-29835,
-29019,
-32184,
-36175,
-37598,
-35358,
-32236,
-32215,
-35829,
-40293,
-40690,
-36095,
-29729,
-27223,
-31102,
-38683,
-44150,
-43513,
-38129,
-32397,
-30813,
-33164,
-36674,
-37945,
-36911,
-35700,
-36172,
-37945,
-39025,
-37679,
-35275,
-33746,
-34983,
-37709,
-39444,
-38501,
-35564,
-33244,
-33479,
-35858,
-38470,
-38842,
-37203,
-34880,
-34220,
-35723,
-38051,
-39499,
-38580,
-36117,
-33879,
-33452,
-35329,
-38261,
-40266,
-40293,
-38129,
-35512,
-33772,
-34007,
-35752,
-37626,
-38841,
-38814,
-38313,
-37916,
-37681,
-37518,
-36915,
-36119,
-35568,
-35565,
-36229,
-36777,
-37393,
-37199,
-37313,
-37544,
-38078,
-38653,
-38659,
-38231,
-37786,
-37917,
-38761,
-40108,
-40850,
-40527,
-39347,
-38019,
-38077,
-39633,
-41771,
-43200,
-42483,
-40533,
-38734,
-38815,
-40585,
-42509,
-42884,
-41611,
-40057,
-40135,
-41745,
-43278,
-42801,
-40004,
-37387,
-37099,
-39951,
-43327,
-44602,
-42322,
-38977,
-37386,
-39264,
-42776,
-44730,
-43408,
-40322,
-38336,
-39821,
-43223,
-45760,
-44651,
-40927,
-36938,
-35859,
-37809,
-40823,
-42353,
-41217,
-38814,
-36993,
-37283,
-38972,
-40638,
-40609,
-39106,
-36806,
-35436,
-35433,
-36069,
-36438,
-35591,
-34697,
-34694,
-36385,
-38682,
-39502,
-37387,
-33324,
-29860,
-29653,
-32660,
-36201,
-37072,
-34455,
-30236,
-28221,
-29707,
-33504,
-35832,
-34879,
-31077,
-27882,
-27353,
-29678,
-32371,
-33110,
-31421,
-29149,
-27669,
-28017,
-28723,
-28520,
-27402,
-25958,
-26002,
-27359,
-29355,
-30449,
-29857,
-28362,
-26556,
-26039,
-26397,
-27386,
-27903,
-27754,
-26954,
-26140,
-25717,
-25874,
-26298,
-26322,
-26114,
-25477,
-25481,
-26110,
-27276,
-28541,
-28728,
-28171,
-26535,
-25004,
-23841,
-23710,
-24581,
-26005,
-27541,
-28117,
-27513,
-25796,
-24263,
-23790,
-25398,
-27354,
-29122,
-28543,
-26852,
-25055,
-25005,
-26637,
-28679,
-29356,
-28176,
-26109,
-25138,
-25714,
-27514,
-28514,
-28358,
-27432,
-27169,
-28199,
-29518,
-29863,
-28489,
-26482,
-25558,
-26404,
-28196,
-29443,
-29015,
-27936,
-27696,
-29440,
-32318,
-34353,
-34270,
-32030,
-29517,
-28411,
-29150,
-30811,
-31713,
-31207,
-29441,
-27750,
-26878,
-27221,
-28040,
-28886,
-29280,
-29574,
-30097,
-31079,
-32186,
-32925,
-33190,
-32873,
-32898,
-33349,
-34035,
-34668,
-33876,
-32478,
-30282,
-29205,
-28805,
-29597,
-30419,
-30679,
-30709,
-30680,
-31394,
-32662,
-33664,
-33879,
-32473,
-30896,
-29542,
-30208,
-32026,
-33826,
-33768,
-31448,
-28277,
-26721,
-28146,
-31656,
-34380,
-34192,
-31341,
-28888,
-29303,
-32745,
-35959,
-35885,
-31949,
-27617,
-26561,
-30284,
-35066,
-37415,
-34351,
-29519,
-26667,
-28490,
-33030,
-35567,
-34140,
-29467,
-26271,
-26930,
-30550,
-33822,
-33720,
-31154,
-28861,
-29728,
-32902,
-35880,
-35807,
-32765,
-29230,
-27933,
-29680,
-32341,
-33933,
-32579,
-29837,
-27698,
-27932,
-30473,
-33608,
-35148,
-34242,
-31926,
-29780,
-29652,
-31262,
-33137,
-33928,
-32849,
-31153,
-30445,
-31263,
-33028,
-33616,
-32606,
-30022,
-28305,
-28302,
-30049,
-31948,
-32186,
-30761,
-28487,
-27515,
-28328,
-30656,
-33058,
-34191,
-33853,
-32289,
-30762,
-29651,
-29148,
-29442,
-29728,
-30444,
-31237,
-31735,
-32003,
-31234,
-29837,
-28356,
-27302,
-27881,
-29175,
-31370,
-32764,
-33271,
-32660,
-31659,
-31183,
-31208,
-31976,
-32238,
-31817,
-30734,
-29123,
-28541,
-28384,
-29414,
-30204,
-30869,
-30994,
-31264,
-31816,
-32845,
-33562,
-33821,
-33508,
-33031,
-33479,
-34353,
-35697,
-36043,
-35434,
-33824,
-32528,
-32003,
-32633,
-34116,
-35486,
-36756,
-37413,
-38024,
-38363,
-38421,
-37916,
-36832,
-35570,
-34928,
-35069,
-36673,
-37891,
-38787,
-38077,
-36726,
-35886,
-36383,
-37917,
-39238,
-39235,
-38209,
-37519,
-38420,
-40768,
-42642,
-42884,
-41003,
-39558,
-39682,
-41721,
-43092,
-41746,
-38208,
-34957,
-35489,
-39182,
-43307,
-43723,
-40084,
-36067,
-35329,
-39423,
-44200,
-45259,
-40979,
-34906,
-32478,
-35618,
-41350,
-43806,
-40794,
-34986,
-31817,
-34272,
-39606,
-42856,
-41111,
-36623,
-34432,
-36753,
-41324,
-43040,
-39394,
-33166,
-30097,
-32717,
-39209,
-43119,
-40927,
-34194,
-28171,
-27699,
-32289,
-37787,
-39869,
-37786,
-34297,
-32743,
-33637,
-35515,
-35803,
-34219,
-32319,
-31526,
-32397,
-33428,
-33796,
-33217,
-33004,
-33164,
-33479,
-32794,
-30998,
-29730,
-30365,
-33188,
-36518,
-37493,
-35120,
-30282,
-26088,
-25081,
-27407,
-31500,
-34483,
-35013,
-33637,
-31870,
-31447,
-32581,
-34354,
-35564,
-35119,
-33505,
-31026,
-29543,
-29072,
-30496,
-32212,
-33665,
-33533,
-31842,
-29891,
-28752,
-29492,
-31580,
-33584,
-33906,
-32420,
-29786,
-28170,
-28596,
-30814,
-33663,
-34855,
-34138,
-31581,
-29280,
-28622,
-29888,
-32557,
-34640,
-35383,
-34167,
-32660,
-31290,
-31683,
-32846,
-34486,
-34507,
-33245,
-30494,
-28570,
-28039,
-30153,
-33190,
-35671,
-36148,
-34062,
-31418,
-29601,
-30362,
-32927,
-35935,
-36782,
-35063,
-31000,
-27722,
-26589,
-28593,
-31686,
-33637,
-32795,
-30601,
-28939,
-30494,
-34090,
-37756,
-37997,
-35276,
-31181,
-29865,
-31470,
-35121,
-36750,
-35466,
-32102,
-29813,
-30177,
-32294,
-33372,
-32347,
-29938,
-28837,
-30123,
-32584,
-33691,
-32529,
-30629,
-30733,
-33243,
-36411,
-36703,
-33478,
-28914,
-26744,
-28649,
-32662,
-35248,
-34115,
-31077,
-29122,
-30102,
-32897,
-34010,
-32344,
-29123,
-27644,
-29835,
-33588,
-36436,
-35171,
-32080,
-29175,
-29521,
-31842,
-33665,
-32872,
-29943,
-27589,
-27832,
-30916,
-34115,
-35725,
-34879,
-33191,
-32157,
-32507,
-33106,
-33141,
-32025,
-30734,
-29995,
-30338,
-31208,
-32134,
-33004,
-33507,
-33560,
-32661,
-30522,
-28595,
-27644,
-29493,
-33031,
-36438,
-37573,
-35513,
-32082,
-29253,
-29099,
-30890,
-33164,
-34325,
-33666,
-32898,
-32372,
-33110,
-33902,
-34036,
-33136,
-31684,
-30868,
-30731,
-31290,
-31763,
-31632,
-31287,
-31106,
-31338,
-32321,
-33241,
-33902,
-34063,
-33636,
-33113,
-32237,
-31263,
-29914,
-28464,
-27855,
-28330,
-30364,
-32583,
-34007,
-33324,
-31313,
-29307,
-28861,
-30547,
-32716,
-34033,
-32927,
-31022,
-28836,
-28802,
-29681,
-31206,
-31634,
-31551,
-30866,
-30840,
-30706,
-30498,
-29861,
-29467,
-29624,
-30946,
-31842,
-32240,
-31313,
-30128,
-29783,
-30733,
-32424,
-33295,
-32821,
-30918,
-29492,
-29783,
-31897,
-34720,
-36149,
-35247,
-32478,
-29888,
-29625,
-32002,
-35724,
-37864,
-37203,
-33824,
-30787,
-29677,
-31817,
-34667,
-36705,
-36011,
-34066,
-32313,
-32085,
-32712,
-33031,
-32162,
-31285,
-31423,
-33241,
-35408,
-36254,
-35301,
-33799,
-33372,
-35198,
-36992,
-37943,
-36332,
-34828,
-34561,
-36783,
-38918,
-39159,
-35936,
-32345,
-30733,
-32688,
-36491,
-38391,
-37179,
-33610,
-31026,
-30997,
-32767,
-33691,
-32557,
-30390,
-29809,
-31553,
-34561,
-35569,
-34033,
-31051,
-30074,
-31762,
-35120,
-36435,
-34777,
-31153,
-29100,
-30335,
-33640,
-36226,
-35619,
-32846,
-30128,
-30019,
-31818,
-33769,
-33745,
-31975,
-29968,
-29387,
-29862,
-30760,
-30840,
-30918,
-31552,
-33085,
-34139,
-33455,
-31183,
-29174,
-29335,
-31843,
-34193,
-34405,
-31737,
-28884,
-28175,
-30598,
-33379,
-33740,
-30816,
-27193,
-26272,
-29519,
-34088,
-36252,
-33956,
-29017,
-25796,
-26588,
-30653,
-34433,
-35222,
-33454,
-31658,
-32081,
-34245,
-35832,
-34931,
-31976,
-29783,
-29994,
-33058,
-36252,
-37495,
-36094,
-33506,
-31924,
-32130,
-33219,
-33795,
-32901,
-31260,
-30101,
-30548,
-32055,
-33877,
-34270,
-33640,
-32053,
-31608,
-32314,
-34409,
-36380,
-36759,
-35432,
-32926,
-31131,
-31233,
-33536,
-36778,
-39081,
-39209,
-37047,
-34006,
-31845,
-31577,
-33033,
-35089,
-36070,
-35670,
-33932,
-32394,
-31819,
-32607,
-34062,
-35171,
-34640,
-33377,
-31153,
-30262,
-30256,
-31290,
-32422,
-32742,
-32502,
-32188,
-32447,
-33272,
-34244,
-34247,
-33612,
-32635,
-32238,
-32848,
-33743,
-34405,
-34351,
-33613,
-32924,
-32717,
-32605,
-32400,
-31525,
-30391,
-29677,
-29519,
-30179,
-30708,
-31156,
-31156,
-31474,
-31815,
-32426,
-32448,
-31924,
-31049,
-30366,
-30309,
-30630,
-31208,
-31315,
-31447,
-31632,
-32422,
-33483,
-34322,
-34909,
-34746,
-34854,
-35116,
-35517,
-35958,
-35571,
-34981,
-33932,
-33347,
-33005,
-32742,
-32421,
-31688,
-30994,
-30843,
-31497,
-32742,
-33929,
-34456,
-34116,
-33240,
-32585,
-32685,
-33641,
-34799,
-35488,
-35223,
-34060,
-32981,
-32499,
-33405,
-34850,
-36388,
-36858,
-36202,
-35009,
-34249,
-34535,
-35883,
-37205,
-38046,
-37629,
-36727,
-35803,
-35516,
-35800,
-36099,
-35959,
-35330,
-34511,
-33900,
-33641,
-33584,
-33561,
-33584,
-33720,
-33979,
-34169,
-34008,
-33584,
-33351,
-33530,
-34485,
-35329,
-35935,
-35382,
-34616,
-33717,
-33798,
-34483,
-35434,
-35831,
-35434,
-34432,
-33399,
-32821,
-32846,
-32978,
-33007,
-32501,
-32161,
-32053,
-32715,
-33665,
-34194,
-33981,
-33005,
-32213,
-32079,
-32822,
-33532,
-33506,
-32795,
-31946,
-32269,
-33265,
-34487,
-34428,
-33033,
-31287,
-30497,
-31526,
-33295,
-34589,
-34061,
-32715,
-30997,
-30920,
-31393,
-32001,
-31157,
-29651,
-27618,
-27116,
-27459,
-28647,
-29467,
-29677,
-29731,
-30284,
-31289,
-32845,
-34195,
-35169,
-35724,
-35595,
-34692,
-33350,
-31949,
-31946,
-33245,
-35460,
-36859,
-36466,
-34166,
-31842,
-30525,
-31312,
-32267,
-32397,
-30654,
-28332,
-27325,
-28095,
-29914,
-30734,
-29255,
-26111,
-23237,
-22069,
-22973,
-24736,
-25797,
-26193,
-26400,
-27252,
-29224,
-31107,
-32528,
-32529,
-32188,
-31788,
-32240,
-33269,
-34509,
-35541,
-35936,
-35724,
-34828,
-33295,
-31209,
-29043,
-26959,
-26084,
-25983,
-26902,
-27963,
-28356,
-28093,
-27090,
-26508,
-26456,
-26826,
-26904,
-26191,
-24979,
-24261,
-24768,
-26111,
-27513,
-27643,
-26562,
-25821,
-26193,
-28462,
-30972,
-32317,
-31870,
-30417,
-29783,
-30787,
-32977,
-34855,
-35089,
-34037,
-32740,
-32476,
-33508,
-34693,
-35066,
-34009,
-32158,
-30762,
-30442,
-31368,
-32714,
-33692,
-33664,
-33006,
-32000,
-31184,
-30494,
-29970,
-29149,
-29016,
-29309,
-30917,
-32479,
-33451,
-32929,
-31284,
-30368,
-30705,
-33270,
-36041,
-38128,
-38419,
-37810,
-37681,
-38759,
-40427,
-41296,
-40611,
-38470,
-36572,
-35775,
-36282,
-37228,
-37416,
-36860,
-35857,
-35329,
-35249,
-35250,
-34879,
-33798,
-32607,
-31660,
-31471,
-31686,
-32186,
-32581,
-32795,
-32872,
-32766,
-32427,
-32183,
-32029,
-32635,
-33560,
-35143,
-36413,
-37677,
-38499,
-38920,
-38972,
-38209,
-37175,
-36071,
-35721,
-36177,
-37149,
-37415,
-36756,
-35248,
-33825,
-33584,
-34300,
-35143,
-34775,
-33190,
-31076,
-30021,
-30549,
-31869,
-32846,
-32531,
-31154,
-30129,
-30362,
-31685,
-33612,
-34352,
-34298,
-33429,
-32923,
-32796,
-33399,
-34088,
-35039,
-36225,
-37549,
-39103,
-40056,
-40743,
-40636,
-40399,
-40031,
-39365,
-38502,
-37068,
-35569,
-34192,
-33586,
-33585,
-33930,
-34219,
-33613,
-32845,
-31818,
-31815,
-32874,
-34430,
-35620,
-35591,
-34249,
-33055,
-32477,
-33403,
-34665,
-35359,
-34957,
-33665,
-32978,
-33586,
-35330,
-37282,
-38419,
-37941,
-37100,
-35803,
-35699,
-35989,
-36543,
-36781,
-36148,
-35353,
-34196,
-33531,
-33190,
-33191,
-33345,
-33352,
-33345,
-33138,
-33428,
-33637,
-34643,
-35224,
-36066,
-36228,
-36120,
-35566,
-35066,
-34668,
-34641,
-35040,
-35246,
-35307,
-34876,
-33985,
-33609,
-33008,
-33239,
-32876,
-32712,
-31870,
-31791,
-32079,
-33216,
-34484,
-35038,
-35091,
-34538,
-34480,
-34593,
-35009,
-34960,
-34379,
-33795,
-33561,
-34219,
-35063,
-35570,
-35192,
-34355,
-33717,
-33743,
-34064,
-34216,
-33800,
-33135,
-32954,
-33319,
-34302,
-34586,
-34434,
-33240,
-32557,
-32160,
-32290,
-32479,
-31603,
-30472,
-28857,
-28332,
-28672,
-30155,
-31551,
-32319,
-32397,
-31737,
-31024,
-30788,
-30521,
-30365,
-30020,
-29361,
-29281,
-29704,
-30734,
-32000,
-32585,
-32606,
-32214,
-32001,
-32423,
-33139,
-33795,
-33745,
-33110,
-31897,
-30970,
-29995,
-29651,
-29412,
-29469,
-29912,
-29971,
-29886,
-28623,
-27035,
-25269,
-24447,
-24953,
-26427,
-28411,
-29650,
-30364,
-30102,
-29569,
-28888,
-28249,
-27777,
-27619,
-28011,
-28888,
-29887,
-30681,
-30867,
-30706,
-30312,
-30021,
-29782,
-29784,
-29307,
-29071,
-28277,
-27697,
-26958,
-26243,
-26062,
-26136,
-27066,
-27905,
-28519,
-27905,
-26775,
-25213,
-24238,
-24397,
-24975,
-26035,
-26585,
-26803,
-26716,
-26802,
-26981,
-27092,
-27246,
-27066,
-27455,
-28255,
-29676,
-31182,
-32109,
-31814,
-30789,
-29252,
-28255,
-28248,
-28597,
-29281,
-28989,
-28730,
-28195,
-28598,
-29305,
-30049,
-29993,
-29335,
-28833,
-29095,
-30444,
-31763,
-32056,
-31313,
-29942,
-29704,
-30681,
-32767,
-34564,
-35272,
-35360,
-35166,
-35993,
-36777,
-37549,
-37177,
-36146,
-35225,
-35010,
-35620,
-36226,
-36069,
-35143,
-34035,
-33506,
-34246,
-35514,
-36649,
-36676,
-35327,
-33508,
-31895,
-31606,
-32608,
-34114,
-35540,
-35962,
-35858,
-35539,
-35592,
-36017,
-36463,
-36438,
-36174,
-35830,
-35698,
-35753,
-35697,
-35171,
-34642,
-33823,
-33876,
-34275,
-35325,
-36415,
-37517,
-38051,
-38339,
-37546,
-36465,
-35037,
-34300,
-34325,
-34959,
-35144,
-34140,
-31922,
-29784,
-28489,
-29227,
-31106,
-33292,
-35068,
-35696,
-36280,
-36623,
-37150,
-37389,
-36887,
-36041,
-35171,
-34668,
-34669,
-34378,
-34192,
-33587,
-33638,
-33930,
-34932,
-35592,
-36279,
-36334,
-36806,
-37073,
-37650,
-37761,
-37386,
-36863,
-36330,
-36491,
-37179,
-37913,
-38318,
-37857,
-37211,
-36352,
-36443,
-37121,
-38446,
-40003,
-40952,
-41221,
-40712,
-39556,
-38207,
-36859,
-35833,
-35405,
-35647,
-36676,
-37968,
-39239,
-39974,
-40031,
-39790,
-39239,
-38918,
-38130,
-37307,
-35911,
-34905,
-34195,
-34561,
-35145,
-35855,
-35939,
-35458,
-34856,
-34243,
-34275,
-34534,
-35490,
-36752,
-38368,
-39711,
-40108,
-39264,
-37230,
-35196,
-33878,
-33451,
-33350,
-32792,
-31581,
-30203,
-29812,
-30442,
-31631,
-32690,
-32447,
-31873,
-31338,
-31556,
-32367,
-32954,
-32899,
-32239,
-31684,
-31923,
-32950,
-34486,
-35486,
-36014,
-36203,
-36065,
-36150,
-35934,
-35594,
-35037,
-34460,
-34216,
-33984,
-34008,
-33664,
-33351,
-32842,
-32586,
-32157,
-31872,
-30863,
-29706,
-28170,
-26933,
-26402,
-26508,
-27250,
-27958,
-28491,
-28514,
-28437,
-28596,
-28936,
-29943,
-30811,
-31898,
-32581,
-33163,
-33745,
-34113,
-34327,
-34508,
-34485,
-34614,
-34618,
-34324,
-33876,
-32979,
-32291,
-31712,
-31446,
-31078,
-30230,
-29151,
-27855,
-27089,
-26905,
-26931,
-27063,
-26614,
-26193,
-25687,
-25826,
-26081,
-26514,
-26583,
-26565,
-26691,
-27250,
-28196,
-29258,
-30176,
-30843,
-31681,
-32453,
-33611,
-34616,
-35592,
-36386,
-36964,
-37524,
-37649,
-37470,
-36780,
-35856,
-35040,
-34192,
-33665,
-32821,
-32131,
-31028,
-30308,
-29758,
-29862,
-29862,
-30101,
-29861,
-29546,
-29309,
-29147,
-29178,
-29489,
-29655,
-29939,
-30075,
-30284,
-30681,
-31156,
-31765,
-32421,
-32823,
-33188,
-33269,
-33191,
-33003,
-32637,
-32000,
-31315,
-30840,
-30416,
-30603,
-30416,
-30523,
-30126,
-29492,
-28859,
-28120,
-27643,
-27171,
-26901,
-26565,
-26478,
-26381,
-26399,
-26537,
-26429,
-26375,
-25957,
-25633,
-25298,
-25395,
-25589,
-25976,
-26327,
-26427,
-26431,
-26111,
-25823,
-25240,
-25057,
-24765,
-24845,
-24898,
-24923,
-24793,
-24924,
-25399,
-26350,
-27618,
-28435,
-28570,
-28119,
-27485,
-27645,
-27986,
-28648,
-28542,
-27777,
-26930,
-26535,
-27063,
-28013,
-28438,
-28356,
-27406,
-26774,
-26823,
-27383,
-28355,
-28622,
-28700,
-28437,
-28779,
-29546,
-30602,
-31260,
-31528,
-31023,
-30602,
-30286,
-30494,
-31000,
-31550,
-32135,
-32423,
-32584,
-32739,
-33031,
-33798,
-34668,
-35436,
-35537,
-34750,
-33610,
-32611,
-32449,
-33058,
-33849,
-34300,
-33901,
-33166,
-32368,
-32030,
-31736,
-31368,
-30655,
-30099,
-30048,
-30839,
-32001,
-32741,
-32952,
-32292,
-31896,
-31789,
-32134,
-32582,
-32741,
-32820,
-33084,
-33771,
-34747,
-35540,
-35884,
-35803,
-35541,
-35777,
-36120,
-36888,
-37336,
-37678,
-38049,
-38207,
-38523,
-38236,
-37703,
-36835,
-36042,
-35724,
-35673,
-35750,
-35435,
-34641,
-33615,
-33002,
-33007,
-33901,
-34880,
-35779,
-35986,
-36072,
-36302,
-37391,
-38708,
-39791,
-39924,
-39238,
-38653,
-38951,
-40025,
-41379,
-41532,
-41035,
-39525,
-39425,
-39868,
-41483,
-42247,
-42221,
-41535,
-41217,
-41984,
-43462,
-44492,
-44386,
-43067,
-41481,
-40611,
-40610,
-41084,
-41219,
-40900,
-40162,
-39686,
-39209,
-39054,
-38444,
-38180,
-37733,
-38179,
-38632,
-39368,
-39421,
-38868,
-38022,
-37045,
-36915,
-37095,
-37787,
-38205,
-38103,
-37678,
-37204,
-36860,
-36939,
-36756,
-36384,
-36094,
-36043,
-36964,
-38183,
-39394,
-39422,
-38524,
-37125,
-36199,
-36281,
-37017,
-37601,
-37362,
-36464,
-35222,
-34275,
-33688,
-32850,
-31893,
-30470,
-29310,
-28856,
-28835,
-29358,
-29467,
-29494,
-29227,
-29389,
-29701,
-30339,
-30761,
-31049,
-31158,
-31207,
-31395,
-31605,
-31817,
-32238,
-32557,
-33056,
-33720,
-34059,
-34539,
-34428,
-34142,
-33771,
-33295,
-33110,
-32847,
-32475,
-31924,
-30945,
-30230,
-29443,
-29251,
-29391,
-29515,
-29629,
-29409,
-29127,
-28882,
-28940,
-29175,
-29598,
-29942,
-30047,
-29915,
-29546,
-29228,
-29043,
-28914,
-29040,
-29101,
-29303,
-29233,
-29568,
-29707,
-30308,
-30658,
-30942,
-30737,
-30360,
-29733,
-29676,
-29811,
-30548,
-31289,
-31788,
-31818,
-31579,
-31023,
-30868,
-30757,
-30974,
-31076,
-30998,
-30866,
-30838,
-31132,
-31867,
-32664,
-33452,
-33771,
-33876,
-33851,
-33689,
-33959,
-34083,
-34435,
-34692,
-34856,
-34982,
-35173,
-35512,
-35805,
-36253,
-36437,
-36544,
-36438,
-36649,
-36807,
-37548,
-37995,
-38286,
-38209,
-37386,
-36809,
-36016,
-36066,
-36044,
-36409,
-36043,
-35540,
-34721,
-34220,
-34298,
-34748,
-35408,
-35831,
-35750,
-35515,
-35221,
-35146,
-35539,
-35805,
-36013,
-35859,
-35328,
-34747,
-34274,
-33822,
-33507,
-33191,
-32606,
-32506,
-32051,
-32243,
-31918,
-31582,
-30863,
-30313,
-29968,
-30020,
-30047,
-30048,
-29624,
-29572,
-29572,
-30020,
-30207,
-29914,
-29229,
-28542,
-28567,
-29257,
-30204,
-30497,
-30126,
-29202,
-28885,
-29124,
-30045,
-30710,
-30811,
-30497,
-30338,
-30521,
-31131,
-31368,
-31102,
-30498,
-30020,
-30020,
-30444,
-30575,
-30417,
-29704,
-29598,
-29414,
-30046,
-30075,
-30046,
-29255,
-28912,
-28806,
-29466,
-30128,
-30546,
-30181,
-29572,
-28963,
-28862,
-29435,
-30289,
-31366,
-31921,
-32242,
-31997,
-31609,
-31075,
-30629,
-30205,
-29862,
-29203,
-28780,
-28012,
-27725,
-27272,
-27225,
-26796,
-26405,
-25767,
-25270,
-25001,
-25137,
-25398,
-25743,
-25956,
-25977,
-26196,
-26187,
-26591,
-26692,
-26720,
-26536,
-26137,
-25850,
-25531,
-25505,
-25716,
-26059,
-26668,
-27274,
-27354,
-27327,
-26270,
-25453,
-24264,
-23602,
-23290,
-22861,
-22761,
-22018,
-21359,
-20805,
-20408,
-20541,
-20566,
-20462,
-20276,
-19616,
-19379,
-19141,
-19588,
-20068,
-20617,
-21071,
-21357,
-22047,
-22810,
-24081,
-25187,
-26033,
-26325,
-26295,
-26458,
-27009,
-28305,
-29466,
-30681,
-30787,
-30654,
-30205,
-30340,
-30757,
-31292,
-31206,
-30154,
-28701,
-27035,
-26115,
-25476,
-25296,
-24605,
-23632,
-22467,
-21386,
-20752,
-20381,
-20039,
-19643,
-19113,
-18931,
-18955,
-19616,
-20251,
-21040,
-21599,
-22149,
-22787,
-23708,
-24740,
-25716,
-26192,
-26244,
-25822,
-25162,
-24554,
-23737,
-22889,
-21783,
-20751,
-19933,
-19670,
-20064,
-20990,
-21967,
-23391,
-24345,
-25715,
-26957,
-28597,
-30308,
-32400,
-34536,
-36911,
-39583,
-42061,
-44730,
-46579,
-48268,
-49140,
-49931,
-50594,
-51251,
-51887,
-52072,
-52279,
-52023,
-51987,
-51785,
-51460,
-50516,
-49428,
-47847,
-46790,
-45838,
-45444,
-45177,
-45180,
-45522,
-46394,
-47977,
-49800,
-51781,
-53259,
-54555,
-55978,
-57406,
-59332,
-60998,
-62529,
-63875,
-64931,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-64956,
-64247,
-63372,
-62556,
-61683,
-61023,
-60151,
-59256,
-58169,
-56826,
-55584,
-54259,
-53107,
-51933,
-50834,
-49666,
-48981,
-48349,
-48161,
-47584,
-46999,
-45734,
-44861,
-43990,
-43676,
-43539,
-43463,
-43225,
-42933,
-42989,
-43037,
-43464,
-43408,
-43120,
-42617,
-42168,
-42089,
-42221,
-41982,
-41617,
-40501,
-39504,
-38284,
-37099,
-35909,
-34142,
-32474,
-30604,
-28911,
-27484,
-25877,
-24236,
-22468,
-20701,
-19270,
-18087,
-17238,
-16607,
-16155,
-16185,
-16498,
-17189,
-17819,
-18375,
-18535,
-18821,
-19117,
-20169,
-21439,
-23050,
-24500,
-25664,
-26429,
-27407,
-28146,
-29412,
-30234,
-31154,
-31369,
-31552,
-31684,
-32028,
-32556,
-33084,
-33216,
-33243,
-32950,
-33034,
-33267,
-33798,
-34114,
-34298,
-33798,
-33586,
-33083,
-33454,
-34061,
-34960,
-35882,
-36360,
-36911,
-37311,
-38127,
-39052,
-40136,
-41111,
-41878,
-42988,
-43803,
-45313,
-46392,
-47899,
-49035,
-50380,
-51438,
-52572,
-53207,
-53813,
-54028,
-54418,
-54662,
-55053,
-55003,
-54845,
-54341,
-53734,
-53051,
-52279,
-51229,
-50009,
-48270,
-46815,
-45021,
-43726,
-42141,
-40638,
-39077,
-37469,
-36411,
-35487,
-35196,
-34960,
-35037,
-34882,
-35010,
-35039,
-35540,
-36200,
-36966,
-37784,
-38261,
-38971,
-39320,
-40183,
-40614,
-40924,
-40849,
-40505,
-39659,
-38947,
-37811,
-36595,
-35278,
-33767,
-32482,
-31098,
-29814,
-28090,
-26536,
-24607,
-23340,
-22256,
-21335,
-20828,
-19592,
-18716,
-17664,
-17080,
-17082,
-17264,
-17664,
-17977,
-18060,
-18188,
-18430,
-18795,
-19301,
-19642,
-19932,
-19962,
-20194,
-20331,
-20831,
-21041,
-21360,
-21120,
-20859,
-20301,
-20068,
-19585,
-19727,
-19189,
-19092,
-18292,
-17771,
-17157,
-16661,
-16208,
-15815,
-15099,
-14283,
-13488,
-12672,
-12011,
-11534,
-10851,
-10265,
-9531,
-8841,
-8419,
-8314,
-8524,
-8923,
-9342,
-9661,
-9687,
-9739,
-9424,
-9263,
-8896,
-8709,
-8578,
-8472,
-8605,
-8655,
-8898,
-9050,
-9319,
-9423,
-9632,
-9505,
-9262,
-9107,
-8552,
-8417,
-8053,
-7624,
-7444,
-6728,
-6466,
-5831,
-5251,
-4641,
-3668,
-2555,
-1186,
-65535,
-2,
-65535,
-2,
-65535,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-4,
-65535,
-3,
-65535,
-1,
-65535,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-0,
-0,
-65535,
-2,
-65535,
-65535,
-1,
-65535,
-0,
-2003,
-6094,
-10612,
-15971,
-21202,
-26639,
-31765,
-37070,
-42433,
-47899,
-52547,
-56770,
-59705,
-62209,
-64194,
-65534,
-65534,
-65534,
-65534,
-63901,
-61499,
-58885,
-56269,
-53735,
-51121,
-48611,
-46077,
-43937,
-42432,
-41747,
-41903,
-43041,
-44703,
-47210,
-50147,
-53863,
-58016,
-62579,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65533,
-64035,
-60310,
-56982,
-54449,
-52731,
-51305,
-50091,
-48479,
-47239,
-46498,
-46606,
-47053,
-47582,
-47688,
-47686,
-48059,
-48768,
-49749,
-50459,
-50408,
-50170,
-49984,
-50223,
-50962,
-51331,
-51148,
-50328,
-48901,
-47531,
-46021,
-44152,
-41954,
-39160,
-36226,
-33452,
-30552,
-27825,
-24611,
-21199,
-17687,
-14258,
-11216,
-8526,
-6017,
-4034,
-2162,
-1078,
-364,
-181,
-417,
-921,
-1922,
-3244,
-5119,
-7334,
-9954,
-12668,
-15526,
-18214,
-21044,
-23601,
-26353,
-28962,
-31528,
-33664,
-35540,
-36570,
-37336,
-37652,
-38023,
-38339,
-38524,
-38286,
-38075,
-37309,
-37285,
-37147,
-37709,
-38415,
-38949,
-39633,
-40265,
-41113,
-42327,
-43409,
-44862,
-45891,
-47344,
-48745,
-50618,
-52598,
-54634,
-56533,
-58146,
-59755,
-60812,
-62422,
-63402,
-64876,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65093,
-63530,
-61395,
-59515,
-57355,
-55079,
-52735,
-50193,
-47689,
-45442,
-42960,
-40690,
-38102,
-35671,
-33375,
-31605,
-30178,
-29284,
-28355,
-27698,
-27142,
-27088,
-27542,
-28484,
-29578,
-30807,
-31610,
-32236,
-32689,
-33031,
-33481,
-33769,
-33772,
-33242,
-32582,
-31421,
-30443,
-29148,
-27752,
-25899,
-23869,
-21569,
-19381,
-17262,
-15396,
-13510,
-11752,
-10397,
-9238,
-8949,
-8998,
-9610,
-10319,
-10902,
-11668,
-12618,
-14150,
-15918,
-18006,
-19617,
-21568,
-23132,
-25553,
-27781,
-30307,
-31713,
-32951,
-33216,
-34063,
-34718,
-35728,
-35986,
-36017,
-35408,
-35434,
-35857,
-37282,
-38631,
-40080,
-40904,
-41795,
-42963,
-44359,
-46314,
-47899,
-49535,
-50594,
-51937,
-53208,
-55002,
-56692,
-58172,
-59332,
-59546,
-59702,
-58964,
-58594,
-57695,
-56932,
-55712,
-54504,
-52728,
-51362,
-49744,
-48561,
-47236,
-45735,
-43911,
-41799,
-39658,
-37813,
-36118,
-34962,
-33821,
-33033,
-32158,
-31765,
-31288,
-31182,
-30788,
-30230,
-29759,
-28989,
-28755,
-28355,
-28201,
-27959,
-27619,
-27221,
-26720,
-26112,
-25559,
-24816,
-24479,
-23996,
-23765,
-23232,
-22258,
-21121,
-19907,
-19167,
-18745,
-18611,
-18193,
-17553,
-16636,
-15890,
-15312,
-14891,
-14147,
-13254,
-12063,
-11298,
-10665,
-10476,
-10245,
-9446,
-8844,
-7812,
-7572,
-7445,
-7572,
-7497,
-7520,
-7126,
-7416,
-7468,
-7918,
-8024,
-7969,
-7707,
-7707,
-8100,
-8872,
-10000,
-11142,
-12116,
-13118,
-13914,
-15100,
-16394,
-17901,
-19350,
-20858,
-22231,
-23630,
-25241,
-26349,
-27620,
-27984,
-28255,
-27932,
-27328,
-26298,
-24818,
-22890,
-20727,
-18320,
-15948,
-13329,
-10692,
-7653,
-4353,
-1236,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-1,
-65535,
-2,
-65535,
-1,
-65535,
-1,
-65535,
-3,
-65535,
-3,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-65535,
-3166,
-6912,
-10640,
-15125,
-20673,
-26508,
-32425,
-37070,
-40269,
-42403,
-43492,
-44489,
-44785,
-44226,
-42460,
-39343,
-35882,
-32293,
-29095,
-26458,
-23521,
-20808,
-17871,
-15472,
-14069,
-14018,
-15232,
-17663,
-21017,
-25395,
-30950,
-37675,
-45445,
-53445,
-61389,
-65534,
-65533,
-65534,
-65534,
-65531,
-65534,
-65533,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65530,
-65534,
-65532,
-65534,
-65534,
-64058,
-60655,
-57166,
-53867,
-50910,
-48903,
-48452,
-48453,
-49061,
-49033,
-49486,
-50273,
-52310,
-54843,
-57564,
-59492,
-61102,
-62054,
-63347,
-64429,
-65118,
-65193,
-64961,
-64718,
-64987,
-65351,
-65225,
-64269,
-62055,
-59121,
-55795,
-51964,
-47901,
-43091,
-37970,
-32846,
-27750,
-23313,
-18665,
-14257,
-9605,
-4910,
-786,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-183,
-4270,
-8290,
-12458,
-16263,
-19880,
-23155,
-26006,
-28412,
-30467,
-31713,
-32792,
-33085,
-33295,
-32926,
-32318,
-30760,
-29097,
-26456,
-24315,
-22101,
-20696,
-19513,
-18559,
-17741,
-17081,
-17240,
-17951,
-19856,
-22123,
-25005,
-27748,
-30920,
-34060,
-37363,
-40847,
-44070,
-47582,
-50883,
-54262,
-57354,
-60150,
-62478,
-64692,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65531,
-65534,
-65457,
-64592,
-63079,
-61582,
-59936,
-58545,
-57271,
-56112,
-54844,
-53840,
-52626,
-51966,
-51040,
-50593,
-50117,
-49931,
-50039,
-50143,
-50750,
-51122,
-52069,
-52812,
-54130,
-55214,
-56428,
-57274,
-57695,
-57697,
-57272,
-56403,
-55293,
-53601,
-51784,
-49109,
-46450,
-43196,
-40135,
-36809,
-33768,
-30314,
-27139,
-23634,
-20326,
-17268,
-14704,
-12591,
-11218,
-10032,
-9553,
-9187,
-9501,
-10003,
-11325,
-12882,
-14968,
-17082,
-19351,
-21517,
-23579,
-25477,
-27117,
-28357,
-29438,
-30023,
-30336,
-30286,
-29836,
-29253,
-28439,
-27746,
-26672,
-25739,
-24292,
-23180,
-21783,
-20935,
-20279,
-19983,
-19882,
-19933,
-20090,
-20833,
-21754,
-23049,
-24582,
-25741,
-27355,
-28330,
-29889,
-31209,
-32767,
-34220,
-35698,
-37045,
-38525,
-39710,
-40877,
-41559,
-42169,
-42326,
-42565,
-42326,
-42222,
-41718,
-41377,
-41032,
-41139,
-41428,
-42196,
-42801,
-43462,
-44070,
-44624,
-45391,
-46366,
-47133,
-47845,
-48111,
-48506,
-49008,
-50063,
-51280,
-52676,
-53448,
-53995,
-53791,
-53863,
-53765,
-53890,
-53790,
-53205,
-52362,
-51252,
-50541,
-50168,
-50039,
-49930,
-49380,
-48478,
-47292,
-46367,
-45653,
-45391,
-45073,
-44597,
-44044,
-43383,
-43171,
-43252,
-43671,
-43915,
-44145,
-43914,
-43962,
-44255,
-44994,
-45839,
-46868,
-47424,
-48004,
-48375,
-48610,
-49301,
-49533,
-50040,
-49957,
-49907,
-49667,
-49220,
-48874,
-48217,
-47503,
-46444,
-45288,
-43854,
-42489,
-40872,
-39211,
-37494,
-35540,
-33666,
-31736,
-29890,
-28223,
-26509,
-24767,
-23047,
-20992,
-19086,
-16870,
-14493,
-12011,
-9238,
-6492,
-3797,
-1211,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-2,
-65535,
-2,
-65535,
-0,
-65535,
-0,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-2,
-65535,
-3,
-65535,
-3,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-65535,
-1,
-65535,
-3,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-4013,
-12244,
-19964,
-27799,
-36070,
-45046,
-53734,
-61500,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-62422,
-57009,
-52389,
-49271,
-46790,
-44016,
-40637,
-36887,
-34562,
-33983,
-35698,
-38629,
-42143,
-45995,
-50595,
-56374,
-63480,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65275,
-60205,
-55134,
-50408,
-46446,
-43066,
-40531,
-38207,
-35962,
-34406,
-33478,
-33984,
-35750,
-38021,
-40561,
-42585,
-44684,
-46704,
-49250,
-51461,
-53365,
-54688,
-55791,
-57225,
-58721,
-59891,
-59807,
-58014,
-54843,
-50593,
-46128,
-40690,
-34748,
-27538,
-20118,
-13041,
-6939,
-1767,
-65535,
-3,
-65535,
-5,
-65535,
-3,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-2001,
-7312,
-12537,
-17822,
-23047,
-27515,
-31179,
-33880,
-35801,
-37443,
-38787,
-39740,
-40238,
-40111,
-39552,
-39027,
-38630,
-38470,
-38365,
-38049,
-37389,
-36755,
-36279,
-36411,
-37125,
-38153,
-39212,
-40134,
-41324,
-42749,
-44968,
-47395,
-50040,
-52043,
-53841,
-55003,
-56454,
-58092,
-59809,
-61920,
-63507,
-65142,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-64191,
-61870,
-59518,
-56877,
-53920,
-50987,
-48111,
-45151,
-42461,
-39394,
-36676,
-34035,
-31894,
-30577,
-29597,
-29468,
-29359,
-29942,
-30839,
-32081,
-34035,
-35618,
-37759,
-39078,
-40664,
-41612,
-42698,
-43355,
-43965,
-44096,
-44043,
-43647,
-42907,
-41800,
-40132,
-37815,
-35299,
-32030,
-29147,
-25877,
-23047,
-20357,
-17952,
-15972,
-14625,
-13675,
-13435,
-13360,
-13540,
-13756,
-14174,
-14944,
-16129,
-17557,
-19273,
-20909,
-22972,
-25133,
-27858,
-30704,
-33458,
-36221,
-38477,
-40922,
-42885,
-44834,
-46207,
-47295,
-48105,
-48750,
-49608,
-50335,
-50956,
-51257,
-51039,
-50408,
-49641,
-48744,
-47951,
-46949,
-45811,
-44283,
-42694,
-41246,
-39922,
-39291,
-38443,
-37998,
-37387,
-36914,
-36939,
-37072,
-37810,
-38499,
-39209,
-40189,
-41059,
-42538,
-44016,
-45761,
-47078,
-48429,
-49138,
-50039,
-50275,
-50487,
-49932,
-49166,
-47713,
-46052,
-44121,
-42012,
-39604,
-37073,
-34325,
-31368,
-28673,
-26034,
-23815,
-21833,
-20332,
-19031,
-18326,
-18161,
-18588,
-19695,
-21067,
-22735,
-24445,
-26116,
-28038,
-29811,
-32053,
-34036,
-36065,
-37974,
-39444,
-40957,
-41849,
-42564,
-42858,
-42692,
-42147,
-41185,
-40115,
-39046,
-37922,
-37094,
-35911,
-35251,
-34085,
-33297,
-32529,
-31921,
-31475,
-31260,
-30842,
-30916,
-30947,
-31365,
-32216,
-33029,
-34458,
-35724,
-37177,
-38764,
-40185,
-41853,
-43329,
-45100,
-46817,
-48847,
-50753,
-52361,
-53761,
-54421,
-54924,
-55027,
-54872,
-54553,
-53761,
-52811,
-51516,
-50354,
-49167,
-48084,
-46894,
-45524,
-43987,
-42621,
-41347,
-40374,
-39421,
-38286,
-37098,
-35700,
-34481,
-33509,
-32659,
-32108,
-31528,
-31099,
-30580,
-29911,
-28862,
-27537,
-25637,
-23340,
-20778,
-17663,
-14782,
-11511,
-8628,
-5807,
-3058,
-497,
-0,
-65535,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-3,
-65535,
-2,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-1,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-65535,
-0,
-1841,
-12438,
-22569,
-32295,
-41004,
-49141,
-56799,
-64349,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-61947,
-56746,
-52467,
-48928,
-45787,
-43171,
-40690,
-39527,
-39396,
-41059,
-44042,
-47821,
-52307,
-57064,
-62448,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65531,
-65534,
-65531,
-65534,
-65534,
-65534,
-65534,
-65533,
-62900,
-56031,
-49221,
-42034,
-35014,
-28328,
-22920,
-18822,
-15629,
-13015,
-10425,
-8421,
-7256,
-7734,
-9395,
-12170,
-15444,
-18955,
-22945,
-27035,
-31184,
-34642,
-37281,
-39003,
-40077,
-41038,
-41821,
-42223,
-42063,
-40634,
-38343,
-35008,
-31001,
-26375,
-21306,
-15576,
-9793,
-3957,
-65535,
-2,
-65535,
-5,
-65535,
-3,
-65535,
-0,
-0,
-65535,
-3,
-65535,
-1,
-65535,
-2902,
-7942,
-13042,
-18322,
-23286,
-28068,
-32687,
-37018,
-40744,
-43857,
-46183,
-47950,
-49406,
-50511,
-51307,
-51648,
-51383,
-50700,
-49693,
-48560,
-47343,
-46209,
-44941,
-43990,
-43014,
-42406,
-42062,
-42036,
-42433,
-43329,
-44547,
-46365,
-48164,
-50565,
-52758,
-55637,
-58196,
-61183,
-63742,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65381,
-61602,
-58148,
-54497,
-51045,
-47870,
-44519,
-41508,
-38418,
-35672,
-32953,
-30732,
-28385,
-26534,
-24635,
-23417,
-22417,
-22254,
-22498,
-23073,
-24108,
-25160,
-26561,
-28305,
-29861,
-32003,
-33664,
-35620,
-36992,
-38418,
-39369,
-40135,
-40584,
-40637,
-40636,
-40161,
-39503,
-38204,
-36600,
-34612,
-32426,
-29941,
-27486,
-24766,
-22256,
-19934,
-18189,
-17055,
-16343,
-16128,
-16264,
-16526,
-17609,
-18666,
-20620,
-22387,
-24609,
-26560,
-28967,
-31364,
-34381,
-37360,
-40427,
-43303,
-45733,
-47951,
-49881,
-51568,
-53076,
-54022,
-54504,
-54367,
-53894,
-53338,
-52493,
-51359,
-49668,
-47450,
-45099,
-42776,
-40662,
-38869,
-36885,
-34935,
-32791,
-30867,
-29308,
-28171,
-27329,
-26507,
-25743,
-25057,
-24895,
-25113,
-26029,
-26961,
-28275,
-29309,
-30523,
-31920,
-33430,
-35142,
-36729,
-37969,
-38921,
-39446,
-39927,
-40236,
-40246,
-39892,
-38871,
-37464,
-35807,
-34140,
-32449,
-31025,
-29228,
-27539,
-25532,
-23682,
-22046,
-20646,
-19775,
-18876,
-18667,
-18399,
-19037,
-20038,
-21571,
-23550,
-25294,
-27221,
-28965,
-30867,
-32977,
-35302,
-37760,
-39894,
-41671,
-43010,
-43833,
-44809,
-45363,
-46024,
-45999,
-45677,
-44997,
-44173,
-43595,
-43278,
-42906,
-42513,
-41667,
-40792,
-40033,
-39710,
-39687,
-39976,
-40082,
-40187,
-40323,
-40553,
-41195,
-42086,
-42935,
-43754,
-44516,
-45208,
-46101,
-47292,
-48611,
-50091,
-51517,
-52625,
-53867,
-54817,
-55821,
-56799,
-57668,
-58621,
-59465,
-60390,
-61366,
-62396,
-63401,
-64086,
-64589,
-64324,
-64112,
-63427,
-62820,
-62394,
-61607,
-61021,
-59731,
-58303,
-56427,
-54291,
-52227,
-49856,
-47474,
-44915,
-42089,
-39475,
-36833,
-34669,
-32503,
-30760,
-28780,
-26957,
-25214,
-23579,
-22177,
-20724,
-18906,
-16760,
-14233,
-11454,
-8764,
-6067,
-3246,
-467,
-4,
-65535,
-1,
-65535,
-65535,
-2,
-65535,
-0,
-65535,
-0,
-65535,
-1,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-0,
-65535,
-4,
-65535,
-4,
-65535,
-2,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-3,
-65535,
-3,
-65535,
-1,
-65535,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-0,
-524,
-10663,
-21361,
-31445,
-40531,
-47742,
-53890,
-58941,
-63556,
-65534,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-61234,
-56138,
-51279,
-46419,
-42540,
-39130,
-36807,
-34697,
-32897,
-31105,
-29994,
-29651,
-31182,
-33640,
-37599,
-41587,
-46156,
-50936,
-56480,
-62451,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-63482,
-56662,
-49435,
-42560,
-35385,
-28196,
-21334,
-14757,
-9422,
-5199,
-2713,
-1609,
-1710,
-2399,
-3692,
-5330,
-7733,
-10743,
-14466,
-18403,
-22651,
-26987,
-31338,
-35647,
-39131,
-41930,
-43174,
-43961,
-43888,
-43987,
-43992,
-43277,
-42275,
-40028,
-37363,
-34060,
-30233,
-26139,
-21438,
-16790,
-12038,
-7890,
-4249,
-1261,
-0,
-65535,
-0,
-65535,
-0,
-65535,
-2423,
-5544,
-9208,
-13123,
-17316,
-21995,
-26877,
-32345,
-37944,
-43671,
-48906,
-53731,
-57804,
-61181,
-63928,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-64614,
-62923,
-61080,
-59169,
-57411,
-56240,
-55216,
-54709,
-53949,
-53362,
-52682,
-52359,
-52521,
-53100,
-54107,
-55263,
-56485,
-57639,
-58730,
-59699,
-60578,
-61285,
-61922,
-62503,
-63108,
-63797,
-64404,
-64824,
-64908,
-64744,
-64142,
-63530,
-62476,
-61235,
-59016,
-56402,
-52811,
-49429,
-45523,
-42248,
-38654,
-35384,
-31894,
-28621,
-25453,
-22363,
-19588,
-16740,
-14305,
-11988,
-10396,
-9137,
-8520,
-8318,
-8364,
-8974,
-9477,
-10584,
-11615,
-12961,
-14625,
-16290,
-18294,
-20146,
-21702,
-23286,
-24239,
-25424,
-26509,
-27593,
-28777,
-29759,
-30389,
-30892,
-30920,
-30785,
-30365,
-29968,
-29464,
-29259,
-29119,
-29020,
-29148,
-28884,
-29020,
-28830,
-29178,
-29517,
-30338,
-31237,
-32421,
-33642,
-35167,
-36704,
-38761,
-40901,
-43383,
-46155,
-48956,
-51700,
-54397,
-56480,
-58383,
-59544,
-60337,
-60811,
-61078,
-60995,
-60867,
-60150,
-59229,
-57826,
-56113,
-54236,
-52204,
-50143,
-48030,
-45892,
-43859,
-41823,
-39953,
-38283,
-36837,
-35775,
-34776,
-34376,
-33878,
-33902,
-33929,
-33956,
-34219,
-34246,
-34484,
-34615,
-35065,
-35302,
-35989,
-36200,
-36676,
-36569,
-36464,
-35752,
-34959,
-33823,
-32715,
-31498,
-30180,
-28570,
-26664,
-24557,
-22810,
-21253,
-20252,
-19112,
-17795,
-16183,
-14467,
-13436,
-12989,
-13435,
-14389,
-15522,
-17161,
-18955,
-21360,
-23630,
-26191,
-27935,
-30153,
-31947,
-34724,
-37545,
-40689,
-43517,
-45995,
-47795,
-49192,
-50038,
-50486,
-50725,
-50777,
-50909,
-51305,
-51649,
-51754,
-51675,
-50778,
-50009,
-48878,
-48082,
-47398,
-47106,
-47212,
-47688,
-48426,
-49035,
-49614,
-49987,
-50775,
-51862,
-53257,
-54767,
-55634,
-56404,
-57246,
-58805,
-61288,
-64084,
-65534,
-65531,
-65534,
-65534,
-65533,
-65534,
-65531,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-63663,
-61711,
-59596,
-58041,
-56849,
-55928,
-55054,
-54212,
-52781,
-51335,
-49217,
-47029,
-44992,
-42962,
-41507,
-39951,
-38313,
-36357,
-34063,
-31789,
-29440,
-27116,
-24738,
-22128,
-19851,
-17505,
-15653,
-13518,
-11165,
-8261,
-5093,
-2052,
-3,
-65535,
-1,
-65535,
-65535,
-2,
-65535,
-4,
-65535,
-2,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-2,
-65535,
-3,
-65535,
-1,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-1,
-65535,
-0,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-1,
-65535,
-2,
-1524,
-7575,
-13227,
-18134,
-22552,
-26478,
-30315,
-34031,
-37709,
-41161,
-43703,
-45546,
-45895,
-45624,
-44760,
-43854,
-43281,
-42721,
-42328,
-41534,
-40320,
-38814,
-36993,
-35170,
-33797,
-32530,
-32370,
-32663,
-34086,
-36254,
-39394,
-43015,
-47448,
-52020,
-56981,
-61976,
-65533,
-65534,
-65533,
-65534,
-65534,
-65532,
-65534,
-65529,
-65534,
-65531,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65532,
-65534,
-65534,
-63768,
-59336,
-55449,
-51624,
-48691,
-46364,
-44681,
-43776,
-42831,
-42008,
-40901,
-39581,
-38470,
-37654,
-37598,
-38182,
-39580,
-41481,
-43516,
-45653,
-47160,
-48109,
-48639,
-48533,
-48796,
-48744,
-48902,
-48558,
-47584,
-45625,
-43043,
-39419,
-35436,
-30654,
-25557,
-20172,
-14651,
-9343,
-4090,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-65535,
-1,
-65535,
-2,
-997,
-3693,
-6386,
-9423,
-12274,
-15867,
-19088,
-22679,
-25955,
-28779,
-31525,
-33693,
-35829,
-37706,
-39475,
-41058,
-42275,
-43197,
-43648,
-43831,
-43858,
-43781,
-43460,
-42989,
-41930,
-40767,
-39266,
-38125,
-37312,
-36991,
-37204,
-37759,
-38469,
-39556,
-40794,
-42538,
-44809,
-47608,
-50698,
-54448,
-57722,
-61524,
-64405,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-63506,
-60759,
-58462,
-56190,
-54159,
-52254,
-49934,
-47843,
-45235,
-42904,
-40640,
-38416,
-36544,
-34591,
-32897,
-31606,
-30523,
-29966,
-29865,
-30019,
-30602,
-31157,
-32027,
-32793,
-33641,
-34374,
-35016,
-35510,
-35886,
-36120,
-36173,
-35989,
-35566,
-34723,
-33663,
-32082,
-30231,
-28173,
-25953,
-23948,
-22071,
-20515,
-19140,
-18217,
-17266,
-16948,
-16739,
-17265,
-17953,
-18982,
-20118,
-21227,
-22125,
-22997,
-23734,
-24662,
-25952,
-27224,
-29014,
-30579,
-32341,
-33747,
-35090,
-36279,
-37442,
-38392,
-39421,
-40004,
-40872,
-41221,
-41768,
-42121,
-42241,
-42438,
-42296,
-42329,
-42036,
-41877,
-41377,
-40873,
-39978,
-39208,
-38422,
-38204,
-38287,
-39028,
-40078,
-41222,
-42720,
-43806,
-45418,
-46575,
-48245,
-49508,
-50857,
-51940,
-52782,
-53498,
-53840,
-54026,
-53867,
-53443,
-52891,
-51938,
-51148,
-50064,
-48848,
-47610,
-45837,
-43993,
-41981,
-39952,
-38153,
-36543,
-35120,
-33952,
-32770,
-31525,
-30415,
-29021,
-28247,
-27225,
-26982,
-26694,
-26799,
-26773,
-26797,
-26803,
-27031,
-27783,
-28852,
-30343,
-31787,
-33296,
-34907,
-36806,
-39449,
-42644,
-46525,
-50540,
-54236,
-57458,
-59492,
-60892,
-61022,
-60681,
-59675,
-58754,
-57668,
-56905,
-55978,
-55188,
-53946,
-52599,
-50646,
-48399,
-45972,
-43620,
-42063,
-41218,
-41376,
-41878,
-42484,
-42618,
-42512,
-42219,
-42331,
-42849,
-44023,
-45542,
-47244,
-49030,
-50728,
-52543,
-54239,
-55951,
-57592,
-58883,
-59678,
-59675,
-58885,
-57511,
-56084,
-54687,
-53707,
-52680,
-51172,
-48877,
-45521,
-41639,
-37181,
-32842,
-28519,
-24632,
-21147,
-18245,
-15944,
-13806,
-12065,
-10002,
-8316,
-6938,
-6230,
-6356,
-6919,
-8019,
-8897,
-9686,
-9845,
-9477,
-8762,
-7706,
-7099,
-7020,
-7522,
-8259,
-8871,
-8970,
-8715,
-7991,
-7500,
-6937,
-6678,
-6307,
-5936,
-5489,
-4933,
-4220,
-3297,
-2187,
-1051,
-23,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-1844,
-4114,
-6969,
-10079,
-13045,
-15810,
-17928,
-19590,
-20882,
-21440,
-21886,
-21466,
-21093,
-20411,
-19851,
-19302,
-18638,
-17741,
-16579,
-15313,
-13858,
-12646,
-11535,
-10584,
-10216,
-10056,
-10136,
-9951,
-9186,
-7546,
-5543,
-3188,
-1081,
-65535,
-3,
-65535,
-3,
-65535,
-1,
-65535,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-2,
-65535,
-3,
-65535,
-1,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-1,
-65535,
-0,
-0,
-5643,
-12544,
-18925,
-24558,
-30044,
-35198,
-40321,
-45203,
-49538,
-53020,
-55320,
-56322,
-56113,
-54736,
-52893,
-50695,
-48982,
-47689,
-46654,
-45790,
-44252,
-42301,
-39793,
-37650,
-36175,
-35857,
-36701,
-38499,
-41032,
-44148,
-47663,
-51594,
-55901,
-60627,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65532,
-63164,
-57378,
-51463,
-45656,
-39552,
-33825,
-28514,
-24239,
-20777,
-18217,
-16051,
-14202,
-12065,
-10081,
-7761,
-6306,
-5646,
-6335,
-8708,
-11721,
-15524,
-18848,
-22022,
-24447,
-27012,
-29200,
-31608,
-33820,
-35965,
-37731,
-38841,
-39000,
-37995,
-35724,
-32558,
-28539,
-24400,
-20139,
-16030,
-12376,
-8951,
-6331,
-4274,
-3005,
-2664,
-3004,
-4566,
-6806,
-10005,
-13410,
-16949,
-20330,
-23418,
-26667,
-29863,
-33347,
-37126,
-40740,
-44865,
-48687,
-52867,
-56742,
-60312,
-63479,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-64353,
-62184,
-60443,
-59069,
-57959,
-57433,
-57088,
-57300,
-57723,
-58671,
-60102,
-61944,
-64011,
-65532,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-64324,
-61630,
-58436,
-54369,
-50116,
-45523,
-41031,
-36835,
-32927,
-29305,
-26141,
-23127,
-20224,
-17346,
-14253,
-11089,
-8153,
-5438,
-3372,
-1874,
-995,
-765,
-916,
-1662,
-2898,
-4511,
-6810,
-9368,
-12250,
-15232,
-18136,
-21124,
-23918,
-26695,
-29334,
-31605,
-33797,
-35355,
-36992,
-37971,
-39104,
-39581,
-40027,
-39820,
-39395,
-38340,
-37228,
-35806,
-34614,
-33402,
-32609,
-32080,
-31843,
-32028,
-32237,
-32850,
-33371,
-34276,
-35220,
-36438,
-38104,
-39974,
-42699,
-45467,
-49087,
-52574,
-56481,
-60337,
-63901,
-65534,
-65533,
-65534,
-65531,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-63215,
-60311,
-57166,
-54186,
-51145,
-48270,
-45468,
-42855,
-40293,
-38420,
-36278,
-34907,
-33241,
-31844,
-30443,
-28992,
-27748,
-26431,
-25371,
-24213,
-23312,
-22495,
-21941,
-21674,
-21784,
-21884,
-22313,
-22598,
-22838,
-22866,
-22782,
-22683,
-22333,
-22074,
-21331,
-20595,
-19509,
-18297,
-17001,
-15603,
-14307,
-13015,
-11589,
-10266,
-8765,
-7493,
-6546,
-5856,
-5886,
-6199,
-6916,
-7970,
-9184,
-10745,
-12273,
-14256,
-16158,
-18241,
-20410,
-22546,
-24846,
-27141,
-29679,
-32080,
-34773,
-37047,
-39366,
-41460,
-43484,
-45605,
-47763,
-50014,
-52097,
-53972,
-55662,
-56906,
-58247,
-59153,
-60278,
-60923,
-61653,
-61792,
-61866,
-61817,
-61550,
-61658,
-61578,
-61761,
-61791,
-61761,
-61764,
-61762,
-61922,
-62343,
-62951,
-63691,
-64271,
-64747,
-64879,
-64826,
-64693,
-64379,
-64031,
-63455,
-62738,
-61685,
-60521,
-59095,
-57591,
-55846,
-54053,
-51965,
-49879,
-47689,
-45494,
-43436,
-41297,
-39131,
-36888,
-34429,
-31870,
-29361,
-26904,
-24872,
-22942,
-21439,
-19960,
-18639,
-17213,
-15892,
-14546,
-13359,
-12273,
-11511,
-10635,
-10218,
-9500,
-9159,
-8606,
-8257,
-7790,
-7439,
-6784,
-6464,
-5990,
-5806,
-5618,
-5544,
-5458,
-5254,
-4878,
-4327,
-3719,
-2978,
-2190,
-1470,
-502,
-65535,
-3,
-65535,
-1,
-65535,
-1,
-65535,
-2,
-65535,
-2,
-65535,
-1,
-1075,
-2217,
-3610,
-4989,
-6331,
-7761,
-8999,
-10163,
-11297,
-12011,
-12777,
-12856,
-13093,
-12697,
-12354,
-11484,
-10583,
-9346,
-7941,
-6732,
-5301,
-4355,
-3293,
-2640,
-1945,
-1346,
-680,
-65535,
-2,
-65535,
-2,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-0,
-0,
-65535,
-65535,
-2,
-65535,
-3,
-65535,
-0,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-3,
-65535,
-1,
-65535,
-0,
-65535,
-2,
-65535,
-6864,
-15442,
-23130,
-29780,
-35439,
-40394,
-45262,
-49982,
-55136,
-59702,
-64087,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65380,
-64695,
-63611,
-62237,
-60179,
-58117,
-55956,
-54418,
-53289,
-52992,
-53131,
-53864,
-55003,
-56429,
-58461,
-60840,
-64059,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65531,
-65171,
-60575,
-55370,
-49935,
-44225,
-39186,
-34984,
-32002,
-30232,
-29150,
-28356,
-27248,
-25717,
-23893,
-22284,
-21228,
-21463,
-22892,
-25293,
-28436,
-31606,
-34722,
-37465,
-39610,
-41558,
-43095,
-44808,
-46340,
-48032,
-48980,
-49246,
-48243,
-45916,
-42726,
-38600,
-34591,
-30495,
-26985,
-23972,
-21308,
-19112,
-17136,
-15469,
-14282,
-13622,
-13858,
-14785,
-16525,
-18640,
-21201,
-23813,
-26617,
-29463,
-32321,
-35353,
-38445,
-41932,
-45572,
-49777,
-53837,
-58253,
-61867,
-65513,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-64509,
-62053,
-60047,
-58117,
-56641,
-55450,
-54554,
-53815,
-53311,
-52917,
-52915,
-53023,
-53444,
-53973,
-54474,
-54816,
-54714,
-54340,
-53341,
-52122,
-50461,
-48875,
-47134,
-45705,
-44204,
-42721,
-41139,
-39132,
-36912,
-34431,
-31711,
-29335,
-26665,
-24742,
-22596,
-20808,
-18769,
-16422,
-13780,
-10901,
-7970,
-5225,
-2925,
-1001,
-65535,
-1,
-65535,
-3,
-65535,
-3,
-65535,
-1451,
-3531,
-6310,
-9473,
-12620,
-16129,
-19036,
-21887,
-24184,
-26088,
-27694,
-29021,
-30070,
-31053,
-31761,
-32480,
-32923,
-33376,
-33716,
-34195,
-34589,
-35169,
-35541,
-36225,
-36546,
-37202,
-37468,
-38207,
-38498,
-39342,
-39713,
-40530,
-41087,
-42088,
-43093,
-44412,
-45919,
-47528,
-49247,
-50828,
-52363,
-53867,
-55424,
-56957,
-58541,
-60150,
-61582,
-62788,
-63694,
-63899,
-63877,
-63082,
-62160,
-60758,
-59333,
-57725,
-56081,
-54478,
-52833,
-51310,
-49769,
-48299,
-46891,
-45631,
-44596,
-43436,
-42618,
-41349,
-40320,
-38761,
-37310,
-35671,
-34036,
-32423,
-30946,
-29359,
-27884,
-26294,
-24716,
-23259,
-21861,
-20779,
-19957,
-19197,
-18899,
-18539,
-18316,
-18116,
-17711,
-17585,
-17186,
-16896,
-16579,
-16079,
-15653,
-14891,
-14360,
-13463,
-12910,
-12062,
-11616,
-11007,
-10822,
-10505,
-10613,
-10715,
-10956,
-11296,
-11880,
-12537,
-13546,
-14885,
-16635,
-18743,
-21122,
-23710,
-26349,
-28992,
-31604,
-34089,
-36648,
-39184,
-41668,
-44068,
-46448,
-48610,
-50883,
-52943,
-55188,
-57377,
-59573,
-61760,
-63614,
-65221,
-65534,
-65534,
-65532,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-64692,
-63956,
-63003,
-62027,
-61314,
-60416,
-59808,
-58964,
-58091,
-57037,
-55925,
-54767,
-53786,
-52811,
-52018,
-51252,
-50382,
-49536,
-48585,
-47713,
-46791,
-45996,
-44995,
-43990,
-42696,
-41218,
-39395,
-37415,
-35329,
-33083,
-30920,
-28514,
-26219,
-23710,
-21277,
-18696,
-16443,
-14154,
-12377,
-10851,
-9527,
-8632,
-7758,
-6995,
-6358,
-5382,
-4804,
-3873,
-3301,
-2686,
-2161,
-1582,
-837,
-1,
-65535,
-0,
-65535,
-1,
-65535,
-4,
-65535,
-3,
-65535,
-1,
-65535,
-0,
-65535,
-2,
-784,
-1716,
-2764,
-3537,
-4377,
-5410,
-6359,
-7786,
-9026,
-10480,
-11904,
-13332,
-14916,
-16551,
-18246,
-20167,
-21838,
-23575,
-24872,
-26007,
-26693,
-27434,
-27563,
-28147,
-28224,
-28385,
-28383,
-28093,
-27748,
-27144,
-26639,
-26115,
-25766,
-25482,
-25369,
-25060,
-24894,
-24187,
-23418,
-22442,
-21149,
-20168,
-18959,
-18108,
-16872,
-15734,
-14069,
-12198,
-10028,
-7945,
-5857,
-4195,
-2608,
-1160,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-2,
-65535,
-1,
-65535,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-1395,
-5303,
-9924,
-14890,
-20197,
-25399,
-30232,
-34696,
-38311,
-41721,
-44517,
-47318,
-49986,
-52598,
-55110,
-57270,
-58941,
-60042,
-60684,
-61180,
-61497,
-62188,
-62817,
-63771,
-64377,
-64930,
-64933,
-64879,
-64613,
-64512,
-64664,
-65120,
-65532,
-65534,
-65532,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-63956,
-58514,
-53180,
-48612,
-44017,
-39897,
-35831,
-31973,
-28491,
-25557,
-23367,
-21676,
-21013,
-20360,
-20166,
-19805,
-19667,
-19511,
-19933,
-20752,
-22282,
-24478,
-26981,
-29653,
-32317,
-34378,
-36412,
-37679,
-38813,
-39556,
-40079,
-40324,
-40130,
-39373,
-38071,
-36046,
-33608,
-30606,
-27587,
-24347,
-21567,
-18430,
-15891,
-13227,
-10954,
-8973,
-7602,
-6701,
-6916,
-7520,
-9159,
-11061,
-13567,
-16212,
-19112,
-22126,
-25162,
-28514,
-31555,
-35220,
-38447,
-42299,
-45840,
-49640,
-53234,
-56586,
-59652,
-62209,
-64275,
-65530,
-65534,
-65532,
-65534,
-65534,
-65533,
-64511,
-62844,
-60813,
-58514,
-56059,
-53471,
-50777,
-48321,
-45891,
-43939,
-42325,
-41088,
-40238,
-39846,
-39527,
-39790,
-40032,
-40713,
-41511,
-42430,
-43516,
-44439,
-45205,
-45893,
-46312,
-46633,
-46868,
-47265,
-47477,
-48002,
-48113,
-48318,
-48141,
-47550,
-46662,
-45175,
-43597,
-41693,
-39790,
-37917,
-35831,
-34007,
-31713,
-29780,
-27330,
-25317,
-23106,
-21249,
-19752,
-18293,
-17293,
-16395,
-15734,
-15470,
-15260,
-15706,
-16263,
-17320,
-18506,
-19854,
-21332,
-22575,
-23972,
-25137,
-26480,
-27724,
-29124,
-30600,
-32028,
-33323,
-34455,
-35305,
-35854,
-36255,
-36463,
-36571,
-36728,
-36727,
-36730,
-36780,
-36623,
-36676,
-36700,
-36836,
-37255,
-37654,
-38390,
-39134,
-39973,
-40904,
-41928,
-43041,
-44466,
-45944,
-47819,
-49775,
-51858,
-53921,
-56111,
-58012,
-60180,
-61867,
-63823,
-65301,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65328,
-63558,
-61842,
-59572,
-57456,
-55005,
-52728,
-50253,
-47948,
-45735,
-43646,
-41747,
-40160,
-38552,
-37597,
-36494,
-35881,
-35277,
-35065,
-34877,
-34911,
-35086,
-35438,
-35776,
-36253,
-36386,
-36595,
-36306,
-35990,
-35222,
-34432,
-33320,
-32002,
-30391,
-28673,
-26537,
-24472,
-22154,
-20063,
-17980,
-16052,
-14306,
-12726,
-11270,
-10004,
-8948,
-8154,
-7682,
-7573,
-7732,
-8394,
-9132,
-10268,
-11615,
-13092,
-14943,
-16765,
-18796,
-20648,
-22518,
-24213,
-25849,
-27405,
-28940,
-30625,
-31950,
-33270,
-34192,
-34854,
-35038,
-35090,
-35066,
-34853,
-35038,
-34960,
-34957,
-34723,
-34139,
-33270,
-32291,
-31078,
-30231,
-29599,
-29280,
-29230,
-29175,
-29045,
-28671,
-28228,
-27457,
-27065,
-26746,
-26718,
-27012,
-27405,
-27752,
-28301,
-28783,
-29411,
-30206,
-31211,
-32288,
-33326,
-34111,
-34511,
-34642,
-34562,
-34380,
-34587,
-34618,
-35300,
-35436,
-35671,
-35197,
-34245,
-33060,
-31734,
-30605,
-29991,
-29469,
-29464,
-29310,
-28989,
-28517,
-27749,
-26957,
-26352,
-25951,
-25826,
-25896,
-25669,
-25500,
-24690,
-23812,
-22894,
-22015,
-21575,
-21461,
-21546,
-21596,
-21570,
-20937,
-20303,
-19326,
-18559,
-18085,
-17900,
-18190,
-18481,
-18770,
-18773,
-18346,
-17850,
-16972,
-16212,
-15522,
-14942,
-14361,
-13727,
-12909,
-11958,
-10901,
-10005,
-9052,
-8605,
-7997,
-7942,
-7657,
-7597,
-7314,
-7017,
-6862,
-6729,
-6783,
-6992,
-7523,
-8233,
-9291,
-10110,
-11192,
-11825,
-12435,
-12510,
-12436,
-12141,
-11826,
-11721,
-11667,
-12116,
-12778,
-13620,
-14600,
-15205,
-15893,
-16130,
-16184,
-16315,
-16262,
-16552,
-16687,
-16999,
-17296,
-17606,
-18059,
-18402,
-19035,
-19536,
-20357,
-21094,
-21993,
-22707,
-23574,
-24162,
-24842,
-25455,
-25740,
-26036,
-25792,
-25377,
-24419,
-23289,
-21939,
-20673,
-19536,
-18746,
-18057,
-17635,
-17110,
-16919,
-16504,
-16523,
-16449,
-16737,
-17214,
-17688,
-18270,
-18690,
-19038,
-19163,
-19040,
-18847,
-18641,
-18401,
-18399,
-18008,
-17739,
-16978,
-16023,
-14837,
-13462,
-12250,
-11111,
-10349,
-9712,
-9318,
-8920,
-8474,
-8020,
-7579,
-7358,
-7737,
-8733,
-10692,
-13305,
-16551,
-19857,
-23098,
-26064,
-28590,
-31055,
-33213,
-35542,
-37757,
-40162,
-42221,
-44096,
-45574,
-46554,
-47235,
-47772,
-48024,
-48724,
-49055,
-49699,
-49876,
-49881,
-49510,
-48847,
-48272,
-47869,
-47716,
-47767,
-47738,
-47558,
-47210,
-46791,
-46498,
-47082,
-48319,
-50963,
-54395,
-58488,
-62687,
-65534,
-65534,
-65533,
-65534,
-65531,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65532,
-65534,
-65533,
-65534,
-64878,
-62318,
-60309,
-58966,
-58194,
-57858,
-57455,
-57091,
-56296,
-55714,
-55109,
-55212,
-55691,
-56797,
-58383,
-59993,
-61497,
-62848,
-63820,
-64538,
-65167,
-65462,
-65531,
-65534,
-65165,
-63984,
-62105,
-59517,
-56430,
-52730,
-49061,
-44837,
-40819,
-36361,
-31946,
-27249,
-22523,
-17948,
-13733,
-10024,
-7078,
-4850,
-3326,
-2211,
-1660,
-1132,
-943,
-712,
-864,
-1237,
-2135,
-3189,
-4724,
-6226,
-7919,
-9501,
-11034,
-12644,
-14150,
-15814,
-17344,
-19063,
-20539,
-21730,
-22705,
-23076,
-23259,
-22973,
-22675,
-22051,
-21592,
-20966,
-20380,
-19802,
-19299,
-18983,
-18981,
-19301,
-20354,
-21598,
-23735,
-25875,
-28568,
-31341,
-34327,
-37439,
-40665,
-44120,
-47452,
-51119,
-54449,
-57853,
-61103,
-64061,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65533,
-65534,
-65532,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-63214,
-60998,
-58830,
-57063,
-55188,
-53813,
-52415,
-51304,
-50382,
-49510,
-48769,
-48085,
-47290,
-46684,
-45734,
-45125,
-44202,
-43621,
-42854,
-42063,
-41349,
-40241,
-39264,
-37757,
-36280,
-34483,
-32662,
-30576,
-28462,
-26166,
-23708,
-21255,
-18532,
-16000,
-13409,
-11088,
-8788,
-6915,
-5038,
-3455,
-2134,
-868,
-65535,
-0,
-65535,
-1,
-257,
-1293,
-2658,
-4198,
-5802,
-7444,
-9080,
-10556,
-12198,
-13699,
-15181,
-16473,
-17952,
-18878,
-20169,
-20913,
-21857,
-22656,
-23549,
-24344,
-25294,
-26006,
-27011,
-27722,
-28729,
-29464,
-30471,
-31393,
-32503,
-33507,
-34642,
-35672,
-36623,
-37625,
-38525,
-39553,
-40532,
-41665,
-42803,
-43991,
-45309,
-46369,
-47659,
-48613,
-49747,
-50698,
-51753,
-52575,
-53364,
-53813,
-54107,
-53995,
-53765,
-53230,
-52838,
-52283,
-51912,
-51463,
-51122,
-50590,
-50067,
-49243,
-48375,
-47450,
-46313,
-45498,
-44331,
-43517,
-42457,
-41325,
-40159,
-38844,
-37491,
-36229,
-34958,
-33875,
-32744,
-31680,
-30422,
-29224,
-27647,
-26322,
-24793,
-23498,
-22336,
-21306,
-20329,
-19458,
-18454,
-17319,
-16183,
-14862,
-13517,
-12169,
-10874,
-9635,
-8604,
-7547,
-6705,
-5934,
-5359,
-4930,
-4648,
-4399,
-4412,
-4453,
-4646,
-5065,
-5751,
-6546,
-7705,
-8763,
-9952,
-11164,
-12303,
-13673,
-14996,
-16631,
-18429,
-20565,
-22840,
-25160,
-27328,
-29386,
-31158,
-32818,
-34326,
-35778,
-37229,
-38842,
-40002,
-41587,
-42327,
-43094,
-43538,
-43546,
-43800,
-43678,
-43830,
-43910,
-44126,
-44381,
-44524,
-44672,
-44708,
-44779,
-44891,
-44939,
-45180,
-45257,
-45497,
-45309,
-45207,
-44569,
-44046,
-43117,
-42327,
-41298,
-40264,
-39161,
-37835,
-36678,
-35061,
-33775,
-32155,
-30632,
-29227,
-27644,
-26403,
-24844,
-23499,
-22046,
-20593,
-19194,
-17687,
-16316,
-14652,
-13119,
-11352,
-9580,
-7681,
-5883,
-4302,
-2950,
-1979,
-1207,
-684,
-365,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-0,
-65535,
-0,
-65535,
-0,
-232,
-656,
-1421,
-2055,
-2901,
-3480,
-4247,
-4669,
-5489,
-5989,
-6810,
-7599,
-8262,
-9184,
-9846,
-10559,
-11244,
-11986,
-12880,
-14045,
-15392,
-16920,
-18801,
-20511,
-22496,
-24449,
-26401,
-28386,
-30151,
-31844,
-33242,
-34510,
-35487,
-36333,
-37044,
-37760,
-38311,
-38842,
-39184,
-39316,
-39317,
-38998,
-38605,
-37994,
-37496,
-37095,
-36812,
-36855,
-36734,
-36987,
-36837,
-36965,
-36834,
-36703,
-36594,
-36229,
-35801,
-35226,
-34535,
-33770,
-33008,
-32102,
-31346,
-30069,
-28995,
-27324,
-25771,
-23761,
-22020,
-20144,
-18666,
-17502,
-16449,
-15786,
-14811,
-14043,
-13094,
-12486,
-12433,
-13147,
-14889,
-17450,
-20462,
-23682,
-26457,
-28753,
-30284,
-31421,
-32001,
-32820,
-33665,
-34828,
-36171,
-37471,
-38310,
-38816,
-38524,
-37994,
-37206,
-36384,
-35778,
-35195,
-34776,
-34244,
-33404,
-32685,
-31659,
-30840,
-30151,
-29575,
-29172,
-29179,
-29094,
-29864,
-31049,
-33139,
-36304,
-40215,
-45020,
-49932,
-54633,
-58752,
-61947,
-64563,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65531,
-65534,
-65532,
-65534,
-65534,
-65302,
-65142,
-65011,
-64826,
-64589,
-64640,
-65038,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-63342,
-59999,
-56423,
-53052,
-49587,
-45734,
-41983,
-37943,
-34299,
-30997,
-28438,
-26402,
-25055,
-23792,
-22965,
-21707,
-21039,
-19750,
-19325,
-18745,
-18823,
-19142,
-19404,
-19749,
-19748,
-19483,
-18958,
-18294,
-17505,
-16895,
-16078,
-15365,
-14229,
-13066,
-11405,
-9738,
-7813,
-6307,
-4589,
-3508,
-2320,
-1446,
-525,
-65535,
-65535,
-65535,
-0,
-839,
-2901,
-5276,
-8261,
-11483,
-14599,
-17951,
-20938,
-24052,
-27089,
-30365,
-33558,
-36941,
-39949,
-42988,
-45362,
-47583,
-49245,
-50829,
-51941,
-53126,
-53815,
-54579,
-54712,
-54738,
-54343,
-53734,
-52996,
-52124,
-51277,
-50727,
-49824,
-49564,
-48612,
-48266,
-47452,
-47211,
-46974,
-47108,
-47527,
-48218,
-49110,
-50121,
-51196,
-52417,
-53655,
-55213,
-56719,
-58410,
-60044,
-61449,
-62711,
-63665,
-64376,
-64749,
-65087,
-65173,
-65192,
-64961,
-64269,
-63269,
-61657,
-59835,
-57433,
-55211,
-52759,
-50512,
-48323,
-46022,
-43702,
-41242,
-38683,
-36016,
-33479,
-31184,
-29017,
-27458,
-25771,
-24580,
-23234,
-22072,
-20963,
-20012,
-19300,
-18744,
-18613,
-18322,
-18323,
-18056,
-17690,
-17107,
-16473,
-15630,
-14993,
-14045,
-13358,
-12326,
-11273,
-9923,
-8473,
-6889,
-5274,
-3722,
-2263,
-869,
-65535,
-65535,
-65535,
-1,
-65535,
-1,
-65535,
-0,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-840,
-3164,
-5595,
-8074,
-10561,
-12985,
-15392,
-17795,
-20196,
-22469,
-24659,
-26562,
-28251,
-29600,
-30626,
-31448,
-31947,
-32505,
-32713,
-33033,
-33187,
-33139,
-33240,
-32876,
-32711,
-32215,
-31947,
-31527,
-31420,
-31340,
-31448,
-31736,
-32055,
-32662,
-33162,
-33930,
-34615,
-35328,
-36361,
-36910,
-37920,
-38601,
-39159,
-39896,
-40162,
-40531,
-40741,
-40719,
-40764,
-40456,
-40316,
-39820,
-39579,
-39159,
-38708,
-38419,
-37889,
-37389,
-36782,
-35961,
-35277,
-34324,
-33613,
-32741,
-32080,
-31235,
-30681,
-29810,
-29228,
-28490,
-27880,
-27513,
-27222,
-27326,
-27540,
-27959,
-28280,
-28593,
-28781,
-28751,
-28676,
-28515,
-28305,
-28355,
-28200,
-28409,
-28437,
-28622,
-28593,
-28649,
-28540,
-28466,
-28458,
-28284,
-28139,
-27913,
-27431,
-27036,
-26404,
-25796,
-25292,
-24742,
-24365,
-24005,
-23572,
-23425,
-22937,
-22764,
-22385,
-22180,
-22018,
-22020,
-21913,
-22046,
-21992,
-22100,
-22177,
-22257,
-22415,
-22626,
-22759,
-23129,
-23181,
-23630,
-23683,
-24078,
-24318,
-24712,
-25189,
-25610,
-26192,
-26562,
-26930,
-27169,
-27327,
-27248,
-27302,
-26956,
-26826,
-26324,
-26006,
-25348,
-24975,
-24477,
-24183,
-24134,
-24104,
-24369,
-24767,
-25134,
-25770,
-26218,
-26930,
-27408,
-28250,
-28939,
-29782,
-30656,
-31419,
-32108,
-32635,
-33030,
-33192,
-33399,
-33269,
-33456,
-33187,
-33217,
-32979,
-32871,
-32876,
-32764,
-33007,
-33108,
-33509,
-33822,
-34142,
-34402,
-34750,
-34878,
-35197,
-35489,
-35853,
-36442,
-36990,
-37838,
-38630,
-39448,
-40213,
-40930,
-41532,
-42010,
-42382,
-42508,
-42647,
-42483,
-42353,
-42170,
-41822,
-41591,
-41241,
-40798,
-40528,
-39926,
-39684,
-39159,
-38762,
-38338,
-37865,
-37414,
-36940,
-36464,
-35988,
-35647,
-35143,
-34880,
-34405,
-34139,
-33824,
-33534,
-33426,
-33376,
-33505,
-33877,
-34088,
-34668,
-34642,
-35039,
-34482,
-34460,
-33714,
-33351,
-32765,
-32373,
-32053,
-31685,
-31499,
-31129,
-30842,
-30467,
-29944,
-29464,
-28834,
-27961,
-27035,
-25693,
-24233,
-22684,
-20907,
-19433,
-18004,
-16897,
-16182,
-15710,
-15653,
-16237,
-17054,
-18824,
-20831,
-23102,
-25373,
-27063,
-28226,
-28513,
-28254,
-27404,
-26669,
-25927,
-25794,
-26036,
-26505,
-27171,
-27433,
-27458,
-27117,
-26640,
-26112,
-26008,
-25874,
-26219,
-26323,
-26483,
-26033,
-25663,
-24819,
-24291,
-23760,
-23765,
-24077,
-25004,
-26218,
-28224,
-30418,
-33454,
-36647,
-40481,
-44119,
-47928,
-51014,
-53761,
-55742,
-57457,
-58913,
-60467,
-62292,
-64323,
-65534,
-65534,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65532,
-65277,
-62766,
-60070,
-57515,
-54682,
-51968,
-48927,
-46077,
-42933,
-40349,
-37597,
-35383,
-33320,
-31316,
-29519,
-27750,
-25874,
-24317,
-22731,
-21546,
-20776,
-20040,
-19959,
-19404,
-19248,
-18795,
-18114,
-17606,
-16688,
-15943,
-15102,
-13964,
-12856,
-11616,
-9923,
-8658,
-6887,
-5462,
-4116,
-2556,
-1421,
-65535,
-65535,
-65535,
-0,
-65535,
-65535,
-65535,
-65535,
-65535,
-65535,
-0,
-65535,
-1,
-65535,
-1,
-65535,
-156,
-1472,
-3165,
-4854,
-6571,
-8261,
-9925,
-11455,
-12936,
-14333,
-15684,
-16920,
-18140,
-19032,
-20015,
-20829,
-21651,
-22626,
-23498,
-24608,
-25689,
-26641,
-27882,
-28699,
-29891,
-30679,
-31896,
-32873,
-34220,
-35565,
-37021,
-38653,
-40190,
-41772,
-43382,
-44837,
-46603,
-48138,
-49799,
-51359,
-52599,
-53787,
-54845,
-55582,
-56351,
-56796,
-57301,
-57431,
-57433,
-56982,
-56403,
-55450,
-54316,
-53207,
-52018,
-51174,
-50406,
-49829,
-49347,
-48749,
-47946,
-47111,
-45942,
-44968,
-43753,
-42722,
-41536,
-40398,
-39104,
-37813,
-36409,
-34987,
-33454,
-32132,
-30629,
-29599,
-28434,
-27462,
-26506,
-25480,
-24475,
-23499,
-22466,
-21652,
-20723,
-19909,
-18901,
-17929,
-16786,
-15713,
-14726,
-13730,
-12883,
-12060,
-11276,
-10686,
-10086,
-9554,
-9158,
-8737,
-8419,
-8156,
-7837,
-7602,
-7388,
-7153,
-7020,
-7044,
-7260,
-7757,
-8394,
-9423,
-10267,
-11352,
-12273,
-13121,
-14202,
-15127,
-16395,
-17740,
-19062,
-20541,
-21675,
-22998,
-23945,
-24899,
-25663,
-26614,
-27460,
-28647,
-29757,
-30998,
-32185,
-33271,
-34243,
-35174,
-35906,
-36810,
-37467,
-38232,
-38843,
-39210,
-39606,
-39634,
-39737,
-39503,
-39367,
-38976,
-38784,
-38290,
-38151,
-37629,
-37307,
-36836,
-36118,
-35649,
-34691,
-33960,
-33001,
-31951,
-31076,
-29862,
-29124,
-28092,
-27512,
-26986,
-26453,
-26167,
-25716,
-25398,
-25138,
-24949,
-24871,
-24872,
-24897,
-25057,
-24923,
-25031,
-24606,
-24476,
-24079,
-23682,
-23604,
-23182,
-23365,
-23130,
-23337,
-23131,
-23232,
-23024,
-23023,
-23020,
-23133,
-23467,
-23528,
-23972,
-24131,
-24715,
-25159,
-26062,
-27141,
-28332,
-30124,
-31502,
-33478,
-35067,
-36700,
-38287,
-39685,
-41087,
-42458,
-43779,
-45179,
-46314,
-47450,
-48190,
-48794,
-49276,
-49584,
-50042,
-50536,
-50965,
-51541,
-51835,
-52253,
-52364,
-52546,
-52441,
-52467,
-52203,
-52097,
-51861,
-51622,
-51383,
-51149,
-50959,
-50887,
-50904,
-51099,
-51380,
-51837,
-52254,
-52706,
-53126,
-53577,
-53867,
-54183,
-54343,
-54369,
-54313,
-54002,
-53652,
-52920,
-52173,
-51177,
-50033,
-48933,
-47500,
-46289,
-44676,
-43252,
-41507,
-39898,
-38180,
-36386,
-34641,
-32821,
-30812,
-28833,
-26852,
-24870,
-23131,
-21673,
-20438,
-19639,
-18985,
-18611,
-18377,
-18293,
-18326,
-18529,
-18933,
-19509,
-20303,
-21254,
-22335,
-23341,
-24342,
-25057,
-25795,
-26429,
-27064,
-27670,
-28384,
-28831,
-29547,
-29966,
-30445,
-30865,
-31130,
-31500,
-31525,
-31923,
-31921,
-32241,
-32316,
-32452,
-32370,
-32451,
-32345,
-32475,
-32743,
-33055,
-33721,
-34322,
-35225,
-36067,
-36914,
-37969,
-38840,
-39846,
-40741,
-41746,
-42591,
-43647,
-44491,
-45445,
-46127,
-46739,
-47052,
-47212,
-47266,
-47158,
-47082,
-46734,
-46607,
-46102,
-45627,
-45023,
-44012,
-43230,
-42111,
-40824,
-39950,
-38574,
-37894,
-36751,
-36125,
-35245,
-34540,
-33979,
-33271,
-32792,
-32187,
-31420,
-30681,
-29784,
-28883,
-27963,
-27089,
-26297,
-25559,
-24896,
-24292,
-23734,
-23131,
-22624,
-21836,
-21094,
-20012,
-18984,
-17660,
-16291,
-14729,
-13068,
-11403,
-9502,
-7864,
-6044,
-4537,
-3032,
-2029,
-1341,
-1395,
-1925,
-3293,
-4911,
-7043,
-8764,
-10347,
-11324,
-11773,
-11959,
-11930,
-12144,
-12828,
-13994,
-15493,
-17349,
-18952,
-20491,
-21410,
-22495,
-22944,
-23946,
-24688,
-25742,
-26746,
-27698,
-28223,
-28464,
-28199,
-27590,
-26933,
-26347,
-25956,
-26032,
-26484,
-27456,
-28731,
-30676,
-32719,
-35431,
-38102,
-41114,
-43803,
-46263,
-48295,
-49798,
-51017,
-52070,
-53074,
-54476,
-55766,
-57434,
-58697,
-59916,
-60520,
-60681,
-60495,
-59914,
-59333,
-58541,
-57854,
-56958,
-56268,
-55190,
-54206,
-52999,
-51805,
-50514,
-49457,
-48478,
-47900,
-47450,
-47290,
-47346,
-47501,
-48163,
-48665,
-49826,
-50646,
-51806,
-52416,
-53019,
-53078,
-52887,
-52389,
-51756,
-51143,
-50518,
-50164,
-49620,
-49217,
-48401,
-47396,
-45973,
-44488,
-42517,
-40817,
-38764,
-37071,
-35275,
-33746,
-32317,
-30892,
-29732,
-28301,
-27306,
-26133,
-25404,
-24894,
-24583,
-24687,
-24684,
-25059,
-25185,
-25375,
-25663,
-25664,
-26085,
-26166,
-26588,
-26640,
-26721,
-26401,
-26087,
-25426,
-24845,
-24184,
-23578,
-23023,
-22467,
-21942,
-21251,
-20516,
-19431,
-18322,
-17240,
-16130,
-15364,
-14838,
-14702,
-14971,
-15547,
-16449,
-17397,
-18481,
-19352,
-20329,
-21121,
-22073,
-22916,
-23975,
-24895,
-25851,
-26559,
-27198,
-27377,
-27514,
-27352,
-27223,
-26957,
-26904,
-26403,
-26166,
-25583,
-25085,
-24499,
-24132,
-23605,
-23312,
-22654,
-22098,
-21412,
-20778,
-20356,
-19800,
-19591,
-19377,
-19380,
-19589,
-20012,
-20567,
-21201,
-21833,
-22470,
-23101,
-23656,
-24476,
-25002,
-25982,
-26402,
-27275,
-27775,
-28648,
-29414,
-30231,
-31105,
-31893,
-32638,
-33214,
-33931,
-34218,
-34800,
-34856,
-35220,
-35385,
-35853,
-36202,
-36570,
-36912,
-36810,
-36937,
-36650,
-36754,
-36888,
-37228,
-37735,
-38335,
-39003,
-39710,
-40426,
-41218,
-41876,
-42513,
-43250,
-43807,
-44860,
-45788,
-46972,
-48113,
-49032,
-49959,
-50698,
-51384,
-52126,
-52623,
-52997,
-53179,
-52970,
-52783,
-52389,
-51965,
-51490,
-50725,
-49905,
-48955,
-47873,
-46973,
-45868,
-44938,
-44020,
-43115,
-42198,
-41427,
-40665,
-40107,
-39607,
-39104,
-38736,
-38472,
-38153,
-38155,
-37864,
-37915,
-37628,
-37651,
-37363,
-37257,
-37017,
-36756,
-36490,
-36254,
-35962,
-35592,
-35039,
-34166,
-33243,
-32055,
-31101,
-29865,
-29095,
-28066,
-27460,
-26746,
-26244,
-25639,
-25212,
-24477,
-24052,
-23392,
-23209,
-22942,
-22891,
-22892,
-22652,
-22785,
-22363,
-22466,
-22181,
-22228,
-22154,
-22279,
-22525,
-22808,
-23422,
-23866,
-24316,
-24741,
-24790,
-25401,
-25557,
-26351,
-26798,
-27671,
-27986,
-28571,
-28671,
-29074,
-29303,
-29496,
-29914,
-30205,
-30655,
-31130,
-31472,
-31951,
-32078,
-32240,
-32265,
-32450,
-32531,
-32844,
-32717,
-33028,
-32850,
-33239,
-33193,
-33661,
-33906,
-34350,
-34776,
-35194,
-35700,
-36225,
-36756,
-37309,
-37731,
-38288,
-38865,
-39583,
-40475,
-41114,
-41904,
-42300,
-42697,
-42960,
-43357,
-43646,
-44018,
-44385,
-44468,
-44807,
-44969,
-45203,
-45259,
-45311,
-45099,
-44862,
-44625,
-44200,
-44282,
-43937,
-44175,
-44150,
-44412,
-44704,
-44861,
-45021,
-45099,
-44942,
-45045,
-44810,
-44862,
-44702,
-44680,
-44514,
-44417,
-44251,
-44072,
-43937,
-43567,
-43147,
-42642,
-42089,
-41563,
-41267,
-40745,
-40451,
-39711,
-39001,
-38180,
-37335,
-36254,
-35539,
-34220,
-33349,
-31841,
-30842,
-29410,
-28440,
-27430,
-26800,
-26325,
-25898,
-25297,
-24579,
-23736,
-22944,
-22361,
-22047,
-21649,
-21227,
-20383,
-19429,
-18589,
-17711,
-17191,
-16471,
-15920,
-15127,
-14677,
-14204,
-13990,
-13491,
-12908,
-11905,
-11035,
-10133,
-9664,
-9340,
-9057,
-8600,
-7895,
-7043,
-6150,
-5725,
-5462,
-5779,
-6174,
-6940,
-7471,
-8152,
-8741,
-9338,
-10167,
-10951,
-12120,
-13170,
-14520,
-15788,
-16869,
-17900,
-18534,
-19244,
-19804,
-20697,
-21915,
-23417,
-24899,
-26376,
-27169,
-27935,
-28012,
-28333,
-28593,
-29150,
-29836,
-30469,
-30841,
-30943,
-30735,
-30548,
-30497,
-30628,
-31367,
-32186,
-33560,
-34695,
-35856,
-36730,
-37201,
-37654,
-38129,
-39049,
-40270,
-41744,
-42960,
-43888,
-44038,
-43916,
-43697,
-43755,
-44305,
-44995,
-45971,
-46499,
-46896,
-46577,
-45998,
-45364,
-44517,
-44124,
-43408,
-43041,
-42379,
-41771,
-40929,
-40027,
-38896,
-37941,
-36968,
-36013,
-35648,
-35142,
-35198,
-34958,
-34775,
-34086,
-33324,
-32343,
-31579,
-31262,
-31077,
-31288,
-31369,
-31313,
-31052,
-30865,
-30602,
-30866,
-31077,
-31499,
-32055,
-32027,
-32160,
-31764,
-31446,
-30918,
-30498,
-29966,
-29467,
-29097,
-28540,
-28334,
-27931,
-27541,
-27378,
-26854,
-26851,
-26614,
-26772,
-27144,
-27590,
-28279,
-28804,
-29283,
-29439,
-29758,
-29886,
-30578,
-31207,
-32531,
-33559,
-34720,
-35647,
-36463,
-37258,
-38259,
-39264,
-40556,
-41747,
-42775,
-43463,
-43990,
-44096,
-44386,
-44414,
-44702,
-44889,
-45153,
-45151,
-45391,
-45310,
-45390,
-45443,
-45259,
-45177,
-45153,
-44968,
-45204,
-45233,
-45283,
-45390,
-44890,
-44622,
-44046,
-43750,
-43543,
-43487,
-43518,
-43407,
-43279,
-42986,
-42722,
-42513,
-42326,
-42036,
-41747,
-41295,
-40769,
-40242,
-39499,
-38710,
-37679,
-36675,
-35514,
-34616,
-33637,
-32770,
-31866,
-30895,
-29965,
-29178,
-28225,
-27537,
-26589,
-25689,
-24792,
-23975,
-23338,
-22733,
-22415,
-21940,
-21598,
-21252,
-20884,
-20673,
-20618,
-20648,
-20989,
-21383,
-21944,
-22358,
-22683,
-22652,
-22362,
-22099,
-21861,
-21939,
-22179,
-22415,
-22495,
-22203,
-21915,
-21489,
-21519,
-21676,
-22230,
-22838,
-23577,
-24369,
-25190,
-25952,
-26484,
-26956,
-27090,
-27671,
-28092,
-29097,
-29916,
-30864,
-31634,
-32104,
-32638,
-32950,
-33613,
-34167,
-35169,
-36308,
-37360,
-38524,
-39028,
-39181,
-39161,
-39049,
-39187,
-39604,
-39926,
-40397,
-40321,
-40186,
-39926,
-39498,
-39583,
-39684,
-40163,
-40899,
-41378,
-41769,
-41775,
-41428,
-41218,
-41006,
-41296,
-41720,
-42194,
-42408,
-42218,
-41774,
-41032,
-40478,
-40083,
-40028,
-40347,
-40556,
-40956,
-40765,
-40562,
-39787,
-39109,
-38204,
-37839,
-37283,
-37308,
-36914,
-36807,
-36175,
-35644,
-34907,
-34272,
-33849,
-33456,
-33452,
-33427,
-33772,
-33953,
-34223,
-34032,
-33720,
-33160,
-32690,
-32714,
-32872,
-33298,
-33397,
-33219,
-32660,
-32265,
-31845,
-32369,
-32662,
-33719,
-34270,
-34988,
-35380,
-35698,
-35911,
-35987,
-35964,
-36015,
-36068,
-36359,
-36832,
-37497,
-37888,
-38155,
-37918,
-37650,
-37232,
-37098,
-37175,
-37550,
-38151,
-39055,
-39843,
-40478,
-40505,
-39843,
-38923,
-37782,
-37443,
-37386,
-38025,
-38363,
-38368,
-37731,
-37044,
-36387,
-36303,
-36282,
-36595,
-36518,
-36330,
-35834,
-35430,
-35148,
-34982,
-34751,
-34612,
-34012,
-33556,
-32690,
-31976,
-31153,
-30368,
-29647,
-28968,
-28566,
-28042,
-27775,
-27327,
-26668,
-25742,
-24607,
-23366,
-22204,
-21307,
-20698,
-20304,
-19984,
-19565,
-18875,
-17928,
-16974,
-16263,
-16051,
-16262,
-16659,
-16843,
-16765,
-16102,
-15499,
-14861,
-14705,
-14996,
-15415,
-16026,
-16394,
-16580,
-16446,
-16185,
-15943,
-15947,
-16447,
-17318,
-18298,
-19191,
-19749,
-20144,
-20409,
-20726,
-21120,
-21624,
-22282,
-23104,
-23972,
-25004,
-25954,
-26772,
-27565,
-28489,
-29730,
-31184,
-32527,
-33456,
-33900,
-34011,
-34323,
-35119,
-36436,
-37654,
-38893,
-39237,
-39528,
-39262,
-39345,
-39498,
-40349,
-41559,
-43119,
-44440,
-45072,
-44758,
-43857,
-42855,
-42907,
-43807,
-45467,
-47109,
-47632,
-47690,
-46443,
-45342,
-44011,
-43177,
-42851,
-43306,
-44412,
-45999,
-47052,
-47054,
-45549,
-43223,
-40929,
-39500,
-39474,
-40137,
-41189,
-41562,
-41216,
-39926,
-38284,
-36387,
-35142,
-34379,
-34695,
-35091,
-35619,
-35143,
-34037,
-32474,
-31159,
-30652,
-30999,
-31605,
-32054,
-31501,
-30229,
-28493,
-26953,
-26143,
-26136,
-26641,
-27276,
-27457,
-26933,
-26032,
-24713,
-23841,
-23182,
-23287,
-23735,
-24291,
-24501,
-24000,
-23181,
-21940,
-21307,
-21384,
-22074,
-23206,
-23736,
-23577,
-22706,
-21491,
-20700,
-20671,
-21518,
-22864,
-24529,
-25741,
-26378,
-26059,
-25162,
-23815,
-23233,
-23368,
-24790,
-26801,
-28699,
-29862,
-29811,
-28857,
-27593,
-26772,
-26957,
-28015,
-29649,
-31344,
-32236,
-32480,
-31946,
-31316,
-30918,
-31236,
-31842,
-32875,
-33346,
-33851,
-33929,
-34455,
-35016,
-35562,
-35940,
-35933,
-36174,
-36651,
-37888,
-39450,
-41005,
-41983,
-42012,
-41664,
-41115,
-41134,
-41698,
-42876,
-44154,
-45253,
-45764,
-45228,
-44258,
-42693,
-41457,
-41165,
-41375,
-42540,
-43432,
-43942,
-43643,
-42673,
-41243,
-40107,
-39186,
-38972,
-39369,
-40003,
-40900,
-41192,
-41376,
-40477,
-39555,
-38101,
-37283,
-37098,
-37600,
-38814,
-39713,
-40345,
-40057,
-39157,
-37811,
-36386,
-35458,
-34593,
-34559,
-34593,
-34956,
-35120,
-34535,
-33057,
-30736,
-28037,
-26090,
-25078,
-25721,
-27085,
-28705,
-29409,
-28782,
-26745,
-24213,
-21753,
-20912,
-21912,
-24476,
-27749,
-29785,
-30123,
-28017,
-24948,
-22074,
-21173,
-22416,
-25425,
-28701,
-30998,
-31499,
-30022,
-27563,
-24740,
-23103,
-23021,
-24345,
-27062,
-29413,
-30814,
-30416,
-28172,
-25005,
-22176,
-20963,
-22126,
-24949,
-28278,
-30524,
-30626,
-28966,
-26271,
-24130,
-23341,
-24687,
-27352,
-30948,
-33899,
-35383,
-34537,
-32132,
-29046,
-27932,
-28939,
-32846,
-36940,
-40081,
-40084,
-37888,
-34802,
-32634,
-32503,
-34036,
-35856,
-37230,
-37205,
-36382,
-35332,
-34561,
-34590,
-34986,
-35512,
-35488,
-34960,
-34085,
-33853,
-34744,
-36784,
-39078,
-40029,
-39527,
-37707,
-36356,
-36837,
-38891,
-41326,
-42509,
-41906,
-40715,
-40372,
-41695,
-43802,
-45077,
-44621,
-43069,
-41638,
-41482,
-42222,
-42932,
-42726,
-41927,
-41062,
-40740,
-40295,
-39104,
-37151,
-35329,
-35037,
-36361,
-38098,
-38581,
-36778,
-33666,
-31342,
-31102,
-33270,
-35804,
-37308,
-36757,
-34851,
-33033,
-32290,
-32637,
-33505,
-33931,
-33821,
-33350,
-33030,
-33138,
-33347,
-33059,
-32369,
-30999,
-30179,
-29863,
-30284,
-30681,
-30391,
-29650,
-28596,
-28357,
-28779,
-29572,
-29836,
-29624,
-28967,
-29040,
-29707,
-30704,
-31001,
-30494,
-29653,
-29596,
-31052,
-33454,
-35855,
-36784,
-36435,
-34881,
-33850,
-33427,
-34247,
-35511,
-37021,
-38443,
-39979,
-41295,
-42195,
-41401,
-39318,
-35963,
-33530,
-33326,
-35984,
-40244,
-43487,
-44044,
-41243,
-37416,
-34324,
-33693,
-34984,
-36465,
-37573,
-38207,
-39158,
-40557,
-41112,
-39686,
-36543,
-33428,
-32793,
-35698,
-40294,
-44095,
-44335,
-41533,
-37390,
-34508,
-33853,
-35272,
-37630,
-39894,
-41853,
-42565,
-41585,
-38447,
-33927,
-29996,
-28542,
-30283,
-33878,
-37256,
-38206,
-36757,
-33742,
-30550,
-27776,
-25927,
-24634,
-25056,
-26774,
-30071,
-32929,
-33951,
-32216,
-28488,
-24529,
-22388,
-22469,
-24711,
-27566,
-30628,
-32556,
-33533,
-32318,
-29650,
-25876,
-22916,
-22232,
-24420,
-28334,
-32289,
-33983,
-32926,
-29253,
-24927,
-21198,
-19592,
-20354,
-23155,
-26826,
-29913,
-30842,
-29147,
-24795,
-19771,
-15764,
-14886,
-17506,
-22626,
-27749,
-30735,
-29782,
-25716,
-20067,
-15759,
-14230,
-16314,
-20700,
-26005,
-30235,
-32077,
-30895,
-26851,
-21331,
-16820,
-15308,
-18616,
-25054,
-32240,
-36490,
-36094,
-31448,
-24923,
-19485,
-16895,
-17821,
-21860,
-27487,
-33427,
-36859,
-36228,
-30864,
-22813,
-16024,
-13807,
-17952,
-25980,
-34220,
-38946,
-38367,
-34165,
-27751,
-22361,
-19380,
-20011,
-24951,
-32900,
-41136,
-46318,
-44990,
-38157,
-28593,
-21783,
-21410,
-27568,
-37543,
-46529,
-51065,
-49722,
-43435,
-34696,
-26930,
-23024,
-25345,
-33112,
-43671,
-51942,
-53970,
-48745,
-38550,
-28832,
-23868,
-26059,
-33772,
-43196,
-50832,
-53469,
-51279,
-45233,
-37704,
-31686,
-29226,
-31475,
-37837,
-45839,
-52389,
-54524,
-51018,
-43090,
-33641,
-26770,
-25270,
-30018,
-38870,
-47975,
-52840,
-51065,
-42830,
-31473,
-21861,
-17872,
-21652,
-30863,
-41721,
-48718,
-48873,
-41723,
-30651,
-20333,
-15519,
-17638,
-25530,
-35224,
-42300,
-44149,
-39924,
-31947,
-22972,
-16577,
-14918,
-18531,
-26035,
-34324,
-39687,
-39632,
-33243,
-23102,
-13014,
-7575,
-9342,
-17347,
-27774,
-35411,
-36117,
-29656,
-18898,
-8898,
-4404,
-6756,
-14890,
-24844,
-32397,
-35119,
-31841,
-24767,
-16341,
-10638,
-9766,
-15100,
-24397,
-34165,
-40296,
-39920,
-33405,
-23547,
-15263,
-12086,
-16371,
-26058,
-37784,
-45947,
-47077,
-39874,
-27826,
-16554,
-11774,
-16551,
-28412,
-42087,
-50594,
-50459,
-42434,
-30995,
-22102,
-19243,
-23634,
-32816,
-43545,
-52041,
-55534,
-53019,
-45313,
-35433,
-27882,
-26482,
-32899,
-45179,
-57459,
-64059,
-60707,
-49087,
-35090,
-26220,
-27510,
-37865,
-51279,
-59940,
-59492,
-50592,
-38867,
-30260,
-28143,
-32348,
-39550,
-46582,
-50352,
-50013,
-45231,
-37677,
-30024,
-25845,
-27621,
-35063,
-44676,
-51334,
-51118,
-44230,
-33795,
-25587,
-23310,
-28070,
-36989,
-45603,
-49800,
-47872,
-41085,
-32794,
-26904,
-25797,
-29861,
-36808,
-43251,
-46551,
-44493,
-38709,
-31024,
-25268,
-23919,
-27671,
-34616,
-41508,
-44519,
-42326,
-35777,
-28042,
-22967,
-22868,
-28142,
-36467,
-44517,
-48296,
-46207,
-38182,
-28091,
-20913,
-20803,
-29017,
-41244,
-51174,
-53312,
-46078,
-34190,
-23924,
-21013,
-26274,
-36250,
-45472,
-50087,
-48483,
-42298,
-34274,
-27406,
-24606,
-26959,
-34059,
-42593,
-48399,
-47767,
-40743,
-30283,
-21889,
-19482,
-23764,
-31974,
-39845,
-43831,
-42354,
-36120,
-27618,
-19591,
-15759,
-17346,
-24712,
-34379,
-41639,
-42593,
-35906,
-24981,
-14964,
-11355,
-15942,
-26247,
-37043,
-42593,
-40528,
-31740,
-21304,
-13967,
-13699,
-20225,
-30257,
-38894,
-41826,
-37757,
-28780,
-18957,
-13381,
-14445,
-22146,
-32692,
-40978,
-43278,
-37890,
-28252,
-19139,
-15288,
-18768,
-27409,
-36911,
-43358,
-44253,
-40427,
-34085,
-28202,
-25078,
-26223,
-31707,
-40005,
-47951,
-51833,
-49695,
-42062,
-33006,
-27695,
-29442,
-38099,
-49275,
-57508,
-58226,
-51780,
-41111,
-32241,
-29412,
-34272,
-44388,
-55080,
-61077,
-59941,
-52201,
-41802,
-33714,
-31582,
-36304,
-45523,
-54394,
-59070,
-56850,
-49298,
-39874,
-33264,
-32191,
-36988,
-44336,
-50540,
-52122,
-48535,
-41691,
-35408,
-32346,
-33768,
-38130,
-42485,
-44492,
-42801,
-38605,
-33636,
-30103,
-28646,
-29571,
-31659,
-34273,
-35882,
-35489,
-32024,
-26248,
-19879,
-16131,
-16737,
-21649,
-27698,
-31499,
-29916,
-24077,
-16292,
-10714,
-9451,
-12512,
-18031,
-23104,
-25582,
-24240,
-19693,
-13703,
-9342,
-8368,
-12115,
-17901,
-23047,
-24082,
-20379,
-14364,
-9314,
-8686,
-12431,
-18747,
-23866,
-25638,
-23181,
-18691,
-14311,
-12535,
-13757,
-17871,
-22655,
-27273,
-29678,
-29492,
-26641,
-21862,
-17633,
-16185,
-19325,
-26613,
-34672,
-39603,
-38368,
-31974,
-24395,
-20622,
-23231,
-30579,
-38441,
-42858,
-42061,
-38181,
-33691,
-31289,
-31843,
-34721,
-39264,
-43751,
-46818,
-46392,
-42698,
-37202,
-33851,
-34852,
-39741,
-45440,
-47770,
-45729,
-41301,
-37492,
-36465,
-36649,
-36727,
-35991,
-36356,
-39293,
-43327,
-45049,
-40767,
-32267,
-25028,
-24925,
-33137,
-43382,
-48586,
-44122,
-33955,
-25031,
-23180,
-27803,
-33770,
-36412,
-34958,
-32161,
-30997,
-30628,
-29309,
-25292,
-20938,
-19695,
-23075,
-28886,
-32371,
-30468,
-24266,
-18373,
-15974,
-18004,
-21518,
-23734,
-24029,
-23443,
-23051,
-22863,
-21306,
-18746,
-16261,
-16951,
-20617,
-26352,
-29571,
-28859,
-23974,
-18902,
-16659,
-18930,
-24317,
-29596,
-32559,
-31973,
-29203,
-25796,
-23469,
-23158,
-24843,
-28015,
-31895,
-35144,
-36570,
-35539,
-31950,
-27933,
-25718,
-27431,
-33139,
-39736,
-43941,
-42984,
-37628,
-32053,
-29467,
-32239,
-37731,
-42645,
-44280,
-42643,
-40163,
-38600,
-38871,
-39208,
-39635,
-40027,
-41537,
-44410,
-46740,
-46919,
-43886,
-39502,
-36647,
-37048,
-39921,
-43199,
-44361,
-43514,
-41482,
-39343,
-37519,
-35305,
-33714,
-33326,
-35536,
-38897,
-41057,
-39581,
-34775,
-29676,
-27566,
-29782,
-33772,
-35909,
-34194,
-29781,
-26273,
-25768,
-28040,
-30181,
-30204,
-28146,
-25796,
-25346,
-26139,
-27117,
-26189,
-24082,
-22148,
-22234,
-23944,
-26115,
-26690,
-25747,
-23599,
-22156,
-21540,
-21969,
-22414,
-23288,
-23972,
-25533,
-26428,
-26879,
-25980,
-24396,
-23393,
-23524,
-25135,
-27355,
-29068,
-29812,
-29754,
-29548,
-30255,
-31451,
-33080,
-33668,
-33584,
-33032,
-33374,
-35066,
-37782,
-40137,
-40689,
-39712,
-38076,
-37704,
-39212,
-41718,
-43754,
-44041,
-42726,
-41399,
-41406,
-43248,
-46025,
-48004,
-48322,
-46709,
-44574,
-42904,
-42806,
-44066,
-45921,
-47580,
-48243,
-47872,
-46842,
-45391,
-43988,
-42805,
-42218,
-42488,
-43723,
-45341,
-46548,
-46318,
-44384,
-41482,
-38736,
-37467,
-37812,
-39369,
-40979,
-41615,
-41136,
-39187,
-36779,
-34407,
-32896,
-33034,
-34006,
-34829,
-34007,
-31553,
-28832,
-28093,
-29968,
-32583,
-32606,
-28705,
-22014,
-17956,
-19086,
-25454,
-31683,
-32873,
-27618,
-20434,
-16738,
-19777,
-26240,
-30765,
-29514,
-23846,
-18927,
-18851,
-23445,
-28911,
-31237,
-29967,
-26984,
-25531,
-25796,
-26957,
-27116,
-26985,
-27457,
-29998,
-33185,
-34963,
-34614,
-32186,
-30867,
-31261,
-33375,
-34932,
-34855,
-33583,
-33430,
-35565,
-39607,
-42829,
-43541,
-40927,
-37547,
-35487,
-36939,
-40717,
-45363,
-47952,
-48056,
-45707,
-43067,
-41322,
-41642,
-43565,
-46106,
-48054,
-48563,
-47367,
-45364,
-43359,
-42587,
-43598,
-45995,
-48797,
-50090,
-48957,
-45017,
-40614,
-37622,
-38396,
-41953,
-46582,
-48874,
-47213,
-42352,
-36227,
-32424,
-31842,
-34407,
-38230,
-41247,
-42404,
-41351,
-38945,
-35436,
-31709,
-28412,
-26533,
-27566,
-31394,
-36912,
-40876,
-40529,
-34802,
-26561,
-20171,
-19748,
-25109,
-32582,
-36966,
-35857,
-30628,
-25400,
-23180,
-24476,
-26561,
-27908,
-27407,
-26851,
-26694,
-26482,
-25188,
-22891,
-21543,
-22971,
-26640,
-29784,
-29411,
-25667,
-21276,
-20728,
-23604,
-27773,
-28467,
-25105,
-21150,
-21148,
-26851,
-34352,
-37361,
-32848,
-23153,
-15420,
-15361,
-23342,
-34166,
-41218,
-40689,
-34167,
-25768,
-19909,
-18821,
-22286,
-28486,
-34910,
-38599,
-37815,
-32843,
-26616,
-23260,
-25029,
-30999,
-36702,
-38549,
-35700,
-31576,
-30104,
-32764,
-37232,
-39051,
-36622,
-31659,
-28675,
-30599,
-36574,
-42031,
-43414,
-39313,
-33113,
-29305,
-30446,
-35855,
-41773,
-44650,
-42670,
-37362,
-31685,
-28805,
-30154,
-34139,
-39001,
-41269,
-40927,
-37231,
-32608,
-28595,
-26774,
-28566,
-32822,
-38338,
-41481,
-40006,
-34084,
-26696,
-22889,
-24845,
-31501,
-37598,
-38630,
-33745,
-26903,
-23131,
-24948,
-29784,
-33058,
-31736,
-27118,
-23549,
-24079,
-28148,
-31787,
-31239,
-26347,
-20463,
-17819,
-20489,
-26402,
-31104,
-31816,
-27142,
-20858,
-15946,
-15785,
-19857,
-26082,
-30844,
-31733,
-28440,
-22783,
-17769,
-16102,
-18429,
-23974,
-29729,
-33244,
-32607,
-28278,
-22654,
-18401,
-18533,
-22496,
-29015,
-34353,
-35989,
-33109,
-27752,
-22730,
-21123,
-23734,
-28623,
-33135,
-34248,
-31974,
-28198,
-25797,
-26295,
-28624,
-30547,
-30075,
-28303,
-27723,
-30181,
-34825,
-37786,
-36093,
-30075,
-24210,
-23288,
-28673,
-36834,
-42116,
-41111,
-35304,
-29411,
-27356,
-29754,
-33562,
-36304,
-36835,
-36728,
-36622,
-36439,
-34535,
-31792,
-29517,
-30947,
-35327,
-40162,
-41138,
-37441,
-31316,
-27826,
-29206,
-34426,
-38872,
-39682,
-36704,
-33401,
-32343,
-34221,
-36833,
-37838,
-36913,
-34906,
-33850,
-33242,
-33375,
-33480,
-34695,
-37415,
-40346,
-41111,
-37865,
-31763,
-26721,
-27061,
-32901,
-40846,
-45233,
-42748,
-35462,
-27985,
-25508,
-29067,
-35306,
-40368,
-41010,
-37914,
-33773,
-30758,
-30551,
-31788,
-33746,
-35090,
-35830,
-36386,
-36675,
-36464,
-35250,
-33162,
-31132,
-30732,
-32637,
-35960,
-38896,
-39236,
-36808,
-33137,
-30575,
-30734,
-32926,
-35618,
-37126,
-37440,
-37099,
-36384,
-35276,
-33059,
-31127,
-30632,
-33238,
-37260,
-40106,
-38895,
-34563,
-30178,
-29547,
-32924,
-37442,
-38947,
-36621,
-33008,
-31840,
-34194,
-37151,
-37229,
-33588,
-29859,
-30447,
-36355,
-43281,
-45413,
-40270,
-31259,
-25191,
-26137,
-33138,
-40187,
-42722,
-39926,
-35615,
-33538,
-34373,
-35702,
-34799,
-31895,
-29282,
-30232,
-34510,
-39502,
-41401,
-38578,
-32608,
-27380,
-25876,
-29226,
-34856,
-39420,
-40216,
-36357,
-30655,
-26033,
-25743,
-29836,
-36253,
-41322,
-42566,
-39025,
-32687,
-26325,
-23206,
-24899,
-30892,
-38153,
-42961,
-41614,
-34774,
-25399,
-19220,
-20145,
-27246,
-36045,
-40659,
-38211,
-30678,
-23051,
-19588,
-21519,
-26270,
-30549,
-32425,
-31973,
-30683,
-29464,
-28016,
-26057,
-23977,
-23152,
-25084,
-29598,
-34852,
-37945,
-36886,
-32133,
-26219,
-22783,
-23870,
-28804,
-34671,
-37756,
-36967,
-32634,
-28622,
-26482,
-28225,
-31342,
-34350,
-35250,
-33930,
-31868,
-30181,
-30177,
-31263,
-32768,
-33479,
-32213,
-29994,
-27539,
-27406,
-30259,
-35486,
-40163,
-41401,
-37257,
-30153,
-23497,
-22470,
-28276,
-38631,
-47581,
-49748,
-43250,
-31527,
-21964,
-20280,
-27958,
-39741,
-47342,
-46024,
-36122,
-25424,
-21018,
-25714,
-35621,
-42722,
-42300,
-34854,
-26059,
-21571,
-23181,
-28199,
-33215,
-35198,
-34958,
-32662,
-29492,
-25111,
-21277,
-20015,
-23232,
-29546,
-35593,
-36887,
-33295,
-27749,
-24872,
-26508,
-30048,
-31552,
-28831,
-25138,
-23997,
-28756,
-36145,
-41086,
-39080,
-31048,
-22049,
-18108,
-21705,
-30202,
-38660,
-42614,
-40691,
-34960,
-28618,
-24953,
-25425,
-29650,
-35383,
-39659,
-40266,
-36730,
-31788,
-28570,
-30073,
-35224,
-40952,
-42935,
-39765,
-33401,
-28463,
-28938,
-35143,
-43886,
-49879,
-49983,
-44284,
-36752,
-32109,
-32819,
-38128,
-44228,
-47662,
-47104,
-44231,
-41876,
-42327,
-44334,
-45943,
-44098,
-39632,
-34881,
-33900,
-38473,
-46657,
-53867,
-55135,
-49112,
-38578,
-29280,
-26722,
-32236,
-42303,
-51567,
-54397,
-50248,
-42036,
-34695,
-32134,
-34773,
-39872,
-43963,
-44677,
-42539,
-39209,
-37601,
-38126,
-40165,
-41240,
-39979,
-35644,
-31157,
-28357,
-30021,
-35143,
-40981,
-43752,
-41006,
-33719,
-25715,
-20831,
-21994,
-27721,
-34672,
-39022,
-38475,
-34400,
-28995,
-25238,
-24134,
-25266,
-27196,
-28831,
-29838,
-30653,
-31501,
-32052,
-31554,
-29624,
-26535,
-23605,
-22149,
-22919,
-25953,
-29783,
-32899,
-34194,
-32476,
-28913,
-24129,
-20913,
-20432,
-23924,
-29173,
-34010,
-34825,
-31079,
-24368,
-18298,
-16867,
-20411,
-27297,
-33300,
-35271,
-32376,
-26716,
-21466,
-19353,
-21409,
-26354,
-32288,
-36415,
-36910,
-33377,
-27008,
-21387,
-19193,
-22416,
-29175,
-35805,
-38601,
-36441,
-31497,
-26906,
-24871,
-25108,
-26140,
-27380,
-29148,
-32162,
-34956,
-35173,
-30863,
-23686,
-17923,
-17665,
-22835,
-29389,
-32000,
-29361,
-24159,
-21860,
-23709,
-27566,
-28619,
-25376,
-21251,
-20648,
-25767,
-32478,
-35354,
-31184,
-23471,
-18507,
-20355,
-27540,
-33743,
-34431,
-29519,
-23524,
-21070,
-23734,
-28359,
-32236,
-33536,
-32739,
-31473,
-28913,
-25662,
-22495,
-22073,
-26454,
-34036,
-40240,
-40346,
-33533,
-23973,
-18218,
-19693,
-27172,
-34982,
-38949,
-38100,
-35488,
-34034,
-34537,
-35224,
-34112,
-31818,
-30442,
-32160,
-36888,
-42219,
-45312,
-45523,
-42799,
-39479,
-35773,
-33378,
-33266,
-36387,
-43092,
-49774,
-53338,
-50593,
-43012,
-35436,
-32687,
-36068,
-42750,
-47239,
-47210,
-43835,
-41029,
-41723,
-44992,
-47661,
-46975,
-43145,
-39871,
-39712,
-43542,
-48268,
-49933,
-47290,
-41535,
-37098,
-36887,
-41112,
-47054,
-50142,
-48904,
-43196,
-37259,
-33821,
-34538,
-38207,
-42114,
-44494,
-44728,
-43569,
-41561,
-38787,
-34880,
-30840,
-28304,
-29334,
-34194,
-40450,
-44363,
-43010,
-36255,
-27749,
-22178,
-22917,
-28991,
-36437,
-39924,
-37415,
-30971,
-25321,
-24501,
-27856,
-31577,
-31501,
-27380,
-23180,
-23104,
-28380,
-34303,
-35722,
-30735,
-22388,
-17662,
-19538,
-26243,
-32373,
-33715,
-30842,
-27272,
-25507,
-25002,
-23657,
-20883,
-19643,
-23234,
-31474,
-39262,
-40373,
-32503,
-20435,
-12619,
-14465,
-25189,
-36992,
-42829,
-39448,
-30760,
-22917,
-20514,
-24185,
-30417,
-35935,
-38182,
-37229,
-34168,
-30601,
-28119,
-27592,
-29940,
-34354,
-39023,
-42012,
-41348,
-37073,
-31234,
-26061,
-24685,
-27196,
-33454,
-40055,
-44519,
-43885,
-38470,
-30207,
-24157,
-22918,
-28277,
-36122,
-42088,
-42433,
-37652,
-31817,
-28884,
-30340,
-33451,
-34750,
-32845,
-29863,
-29229,
-32211,
-36360,
-38047,
-34909,
-29411,
-25136,
-25426,
-29043,
-33138,
-34483,
-33162,
-30895,
-29595,
-29205,
-28566,
-27039,
-25952,
-27065,
-30573,
-34327,
-34747,
-30496,
-23657,
-18718,
-19669,
-26324,
-34641,
-39290,
-36861,
-29123,
-20909,
-17531,
-21173,
-28543,
-34748,
-35486,
-30945,
-25295,
-23021,
-26035,
-31471,
-34961,
-33347,
-28067,
-23076,
-22968,
-27884,
-35275,
-40372,
-40480,
-35907,
-29865,
-25292,
-25347,
-29229,
-36093,
-42383,
-45359,
-43572,
-37676,
-31158,
-27802,
-30100,
-36781,
-43911,
-47213,
-44306,
-37496,
-30704,
-28519,
-32237,
-39212,
-45231,
-46392,
-42118,
-35458,
-30288,
-29727,
-33086,
-37890,
-40873,
-41034,
-39765,
-38893,
-39106,
-39263,
-37387,
-33667,
-29940,
-29256,
-33163,
-39818,
-45812,
-47635,
-44228,
-37653,
-30785,
-26590,
-25609,
-27751,
-31472,
-36359,
-40584,
-43224,
-41773,
-35962,
-26456,
-17794,
-14202,
-19089,
-30020,
-41404,
-45361,
-39239,
-26244,
-14677,
-12065,
-19562,
-31157,
-38551,
-36806,
-28437,
-20382,
-18692,
-24263,
-32029,
-36516,
-34563,
-28912,
-23497,
-22153,
-24869,
-29521,
-33426,
-35039,
-34378,
-32503,
-30073,
-28253,
-27088,
-27301,
-28860,
-31392,
-33931,
-34879,
-33849,
-31079,
-29173,
-29865,
-33505,
-37442,
-38471,
-35038,
-29783,
-27592,
-31579,
-40080,
-46766,
-46390,
-38528,
-29727,
-27461,
-34140,
-45151,
-51782,
-49430,
-40081,
-31554,
-29597,
-35012,
-42380,
-46762,
-46210,
-43303,
-41059,
-39872,
-38602,
-35831,
-33217,
-33372,
-37735,
-43750,
-47610,
-45548,
-39210,
-32266,
-29598,
-32160,
-38075,
-42696,
-43542,
-39975,
-34670,
-30416,
-29334,
-31765,
-36119,
-40531,
-42777,
-41928,
-38052,
-32396,
-27141,
-24399,
-25818,
-31292,
-38522,
-43858,
-43887,
-37703,
-27909,
-19670,
-17026,
-21573,
-29491,
-36491,
-38154,
-34722,
-28911,
-24344,
-22890,
-24158,
-25875,
-27460,
-27669,
-27830,
-27987,
-27485,
-26536,
-24528,
-23206,
-23818,
-26584,
-30711,
-33134,
-32003,
-27274,
-21650,
-19166,
-21994,
-28990,
-35884,
-38419,
-34930,
-28016,
-21913,
-19747,
-21599,
-25292,
-28436,
-30604,
-31971,
-32665,
-31418,
-27752,
-22809,
-20121,
-22095,
-28069,
-33823,
-35063,
-30710,
-24685,
-21729,
-24343,
-29651,
-33215,
-32295,
-28590,
-26381,
-27852,
-31528,
-33453,
-31711,
-27934,
-26483,
-29755,
-36229,
-41004,
-40638,
-35222,
-28516,
-24925,
-25794,
-29336,
-33029,
-35014,
-35485,
-35463,
-34852,
-33296,
-30654,
-27882,
-26534,
-27408,
-29439,
-31182,
-31131,
-29967,
-29335,
-30126,
-32608,
-34168,
-33267,
-29178,
-23522,
-19724,
-20037,
-25295,
-33136,
-40135,
-42433,
-39712,
-32767,
-25743,
-21253,
-21043,
-24844,
-30497,
-36463,
-40136,
-40477,
-36624,
-29966,
-23130,
-19826,
-21888,
-28120,
-34747,
-37573,
-35462,
-30336,
-26272,
-25611,
-27854,
-30656,
-31155,
-30128,
-28250,
-27803,
-27987,
-28251,
-27250,
-26400,
-26880,
-29809,
-33691,
-36175,
-35486,
-32002,
-28356,
-26483,
-27908,
-31235,
-35014,
-37861,
-39265,
-38972,
-36992,
-33535,
-30125,
-28647,
-30550,
-35354,
-40453,
-43145,
-41639,
-37681,
-33874,
-32955,
-35061,
-38501,
-41030,
-41510,
-40055,
-37415,
-34616,
-32581,
-32477,
-35699,
-41614,
-48084,
-51065,
-47980,
-39394,
-29838,
-24949,
-27829,
-37442,
-48874,
-56669,
-58010,
-52892,
-44199,
-35173,
-28936,
-27382,
-31709,
-40505,
-50989,
-58487,
-59493,
-53364,
-42935,
-33189,
-28436,
-30074,
-36305,
-43517,
-48477,
-49776,
-47949,
-44521,
-41110,
-38315,
-36620,
-35595,
-35142,
-35330,
-36067,
-37417,
-39287,
-40955,
-42274,
-42299,
-40718,
-37387,
-32951,
-28412,
-25688,
-26115,
-30335,
-36836,
-43249,
-46184,
-44385,
-37865,
-29334,
-22150,
-18826,
-20961,
-26906,
-34959,
-41190,
-43516,
-40162,
-32791,
-23791,
-17660,
-16317,
-20540,
-27537,
-34644,
-38442,
-38633,
-34956,
-29231,
-22809,
-17479,
-15310,
-17823,
-24736,
-33642,
-40078,
-40930,
-35037,
-25691,
-17264,
-14047,
-16866,
-23712,
-31234,
-36149,
-37388,
-35116,
-30339,
-25292,
-21124,
-20302,
-22705,
-27909,
-32924,
-35331,
-33267,
-28411,
-23312,
-22337,
-26006,
-33270,
-39051,
-39686,
-33851,
-24843,
-18350,
-18797,
-26747,
-38074,
-46500,
-48135,
-42646,
-33847,
-26274,
-22913,
-23581,
-27088,
-31499,
-36572,
-41504,
-45394,
-46576,
-43331,
-36333,
-27986,
-22363,
-22758,
-29123,
-38816,
-46683,
-48849,
-44730,
-36780,
-29864,
-27221,
-29518,
-34432,
-38682,
-40267,
-39369,
-37969,
-37495,
-38682,
-40055,
-40559,
-38944,
-36309,
-33689,
-33164,
-34853,
-38049,
-41085,
-41932,
-40609,
-37204,
-34246,
-32581,
-33060,
-34508,
-35753,
-36014,
-35673,
-35407,
-36306,
-37731,
-38526,
-37361,
-33851,
-29358,
-26431,
-27142,
-31869,
-38526,
-43274,
-43306,
-38101,
-30707,
-25611,
-25768,
-31078,
-37706,
-41428,
-40189,
-35405,
-30711,
-29224,
-31452,
-35139,
-37525,
-37200,
-34618,
-31788,
-29890,
-29862,
-31131,
-33557,
-36098,
-37674,
-37579,
-34822,
-31133,
-28197,
-27804,
-30521,
-34009,
-36675,
-37019,
-35646,
-34483,
-33560,
-33427,
-32001,
-29810,
-27750,
-27723,
-30919,
-35672,
-39790,
-40666,
-37650,
-32346,
-26746,
-23208,
-22810,
-25771,
-31525,
-37705,
-42064,
-41532,
-36230,
-28195,
-21970,
-20853,
-25246,
-32128,
-37103,
-37834,
-34881,
-31157,
-28830,
-28466,
-28698,
-28755,
-28910,
-29994,
-32268,
-34057,
-33829,
-30543,
-26723,
-24132,
-25424,
-28650,
-32210,
-33085,
-31421,
-28541,
-25955,
-24764,
-24133,
-24185,
-24870,
-27012,
-30388,
-33430,
-34429,
-32108,
-27802,
-23524,
-21756,
-23075,
-26614,
-30497,
-33267,
-34143,
-33319,
-31290,
-28885,
-26877,
-26378,
-27194,
-29494,
-31182,
-32239,
-31498,
-30367,
-29649,
-30393,
-31998,
-33456,
-33083,
-30893,
-27539,
-25555,
-25958,
-29251,
-32955,
-35221,
-34088,
-31025,
-28198,
-28172,
-30972,
-34272,
-35328,
-32848,
-28408,
-25586,
-26904,
-32000,
-38289,
-41690,
-40481,
-35300,
-28912,
-24714,
-24104,
-27408,
-32633,
-37759,
-40531,
-39818,
-36544,
-31974,
-29018,
-28436,
-29730,
-31368,
-31394,
-30575,
-30101,
-31842,
-35171,
-37784,
-37335,
-33086,
-27114,
-22999,
-22597,
-25640,
-29728,
-32425,
-32953,
-32475,
-31447,
-30497,
-28593,
-25878,
-23125,
-22233,
-24156,
-28174,
-32053,
-33507,
-31764,
-27696,
-23552,
-20908,
-20860,
-23099,
-27040,
-30679,
-32398,
-30707,
-25928,
-20619,
-17954,
-19746,
-25164,
-30415,
-32241,
-29622,
-25243,
-22124,
-22573,
-24424,
-25900,
-24767,
-22783,
-22285,
-24658,
-28307,
-30493,
-28914,
-24949,
-21386,
-21491,
-25082,
-29995,
-33162,
-32796,
-29965,
-26590,
-24474,
-24739,
-26827,
-30626,
-34565,
-37201,
-37127,
-33426,
-28066,
-23975,
-23496,
-28148,
-34851,
-41167,
-43539,
-42277,
-37992,
-33510,
-29701,
-27937,
-28779,
-32766,
-39396,
-45997,
-49881,
-47818,
-41720,
-34087,
-30311,
-31739,
-37465,
-43545,
-46759,
-46530,
-44250,
-42568,
-42007,
-42197,
-41850,
-41139,
-40768,
-42301,
-44940,
-47583,
-47607,
-44599,
-39738,
-36279,
-36755,
-41587,
-48454,
-53259,
-52678,
-46446,
-36968,
-29754,
-28572,
-34638,
-45129,
-53944,
-57116,
-52283,
-43329,
-34616,
-30602,
-32159,
-36175,
-40108,
-41348,
-41458,
-41717,
-43200,
-44226,
-42646,
-37623,
-31002,
-26821,
-27384,
-32923,
-39502,
-43303,
-42064,
-36911,
-31450,
-28723,
-29945,
-33213,
-35754,
-35352,
-31978,
-27985,
-25823,
-27169,
-31076,
-35461,
-37575,
-36435,
-32849,
-28698,
-25955,
-25480,
-26559,
-28702,
-30944,
-33216,
-35462,
-37149,
-37259,
-34823,
-30026,
-24469,
-21075,
-21697,
-26618,
-33901,
-39738,
-42092,
-39365,
-34039,
-27931,
-24213,
-23840,
-26694,
-31790,
-36835,
-39869,
-39502,
-35566,
-30443,
-26800,
-27274,
-31868,
-37840,
-42060,
-41800,
-37785,
-32342,
-28599,
-28643,
-31926,
-37411,
-42621,
-46073,
-46477,
-43378,
-37604,
-31523,
-27777,
-28727,
-34299,
-42009,
-48534,
-50484,
-47663,
-41403,
-34639,
-30209,
-29042,
-31605,
-36228,
-41532,
-44917,
-45442,
-42670,
-37679,
-33136,
-30815,
-32026,
-35831,
-40426,
-42906,
-42593,
-39050,
-34775,
-31605,
-31077,
-33295,
-36598,
-39444,
-40299,
-39390,
-36838,
-33927,
-31077,
-29468,
-29701,
-32480,
-36647,
-40082,
-40004,
-35433,
-28569,
-23551,
-23683,
-29439,
-36597,
-40637,
-38285,
-31079,
-23839,
-20780,
-23550,
-29651,
-34564,
-35801,
-32270,
-26900,
-22367,
-21223,
-23764,
-28595,
-33479,
-35885,
-34455,
-29785,
-23892,
-20014,
-20276,
-24580,
-31184,
-36145,
-37312,
-33531,
-26721,
-20276,
-16868,
-18669,
-24392,
-31794,
-37623,
-39450,
-36938,
-30762,
-23840,
-18297,
-16789,
-19828,
-27011,
-35196,
-41455,
-42142,
-37203,
-28596,
-20460,
-16896,
-19010,
-25530,
-32715,
-37415,
-38629,
-36624,
-33690,
-30919,
-29044,
-27986,
-27963,
-28435,
-30022,
-31471,
-32690,
-33082,
-32822,
-32924,
-33217,
-34352,
-34615,
-34087,
-32108,
-29517,
-27542,
-26638,
-27988,
-30786,
-34722,
-38206,
-39556,
-37967,
-33694,
-28671,
-25507,
-25768,
-28833,
-32767,
-34907,
-34720,
-33111,
-31869,
-32133,
-32927,
-33215,
-32186,
-30656,
-30257,
-30972,
-32265,
-31816,
-30101,
-27696,
-27778,
-30678,
-35543,
-39023,
-39212,
-35646,
-30389,
-25903,
-23682,
-24342,
-27092,
-31840,
-36678,
-40741,
-40954,
-37176,
-30313,
-24394,
-22338,
-25979,
-32108,
-37572,
-38366,
-35171,
-30256,
-27358,
-28457,
-32324,
-36802,
-38951,
-38046,
-34881,
-31208,
-28833,
-28225,
-29572,
-31816,
-34932,
-37707,
-40423,
-41246,
-40266,
-36702,
-31764,
-27458,
-25665,
-27590,
-32769,
-38891,
-43439,
-44753,
-42382,
-37757,
-32555,
-28941,
-27641,
-28886,
-32240,
-36066,
-39927,
-41689,
-41696,
-39023,
-35120,
-30759,
-27670,
-26799,
-28966,
-33293,
-38737,
-42485,
-43328,
-40111,
-34140,
-28065,
-24055,
-24737,
-28939,
-35329,
-40028,
-41194,
-37834,
-32083,
-26666,
-24184,
-25375,
-28698,
-32347,
-34112,
-34142,
-32290,
-30444,
-28172,
-26668,
-25900,
-26615,
-28937,
-32161,
-34534,
-34197,
-30783,
-25190,
-20778,
-19430,
-22814,
-28698,
-34801,
-37627,
-36226,
-31236,
-25213,
-20754,
-19324,
-20858,
-24845,
-29412,
-34247,
-37521,
-38285,
-35568,
-29438,
-22601,
-18164,
-18797,
-24450,
-31999,
-37655,
-38654,
-35436,
-30653,
-26800,
-25663,
-26245,
-28013,
-29969,
-32264,
-34300,
-35751,
-34984,
-32796,
-29623,
-27936,
-28699,
-31527,
-34826,
-37151,
-37232,
-35906,
-33484,
-31022,
-29070,
-28622,
-30310,
-33931,
-38337,
-40718,
-39842,
-35277,
-29969,
-26612,
-27567,
-31947,
-37203,
-39979,
-38996,
-34909,
-30414,
-27806,
-28300,
-31029,
-34400,
-36441,
-36806,
-35197,
-33058,
-31023,
-29811,
-29491,
-29891,
-30810,
-32136,
-33583,
-34803,
-34905,
-33850,
-31261,
-28333,
-25951,
-25428,
-26983,
-29862,
-32583,
-33798,
-33081,
-30685,
-28300,
-26724,
-26637,
-27621,
-28724,
-29441,
-29413,
-29202,
-28727,
-28912,
-29043,
-29466,
-29282,
-28805,
-27963,
-27483,
-27673,
-28989,
-30840,
-32266,
-32528,
-30973,
-28700,
-27062,
-27091,
-29386,
-32398,
-34589,
-35012,
-33242,
-30893,
-29096,
-28806,
-30073,
-31976,
-33769,
-35067,
-35458,
-35647,
-35090,
-34749,
-33981,
-33586,
-33480,
-33981,
-35198,
-36965,
-39000,
-40451,
-40770,
-39658,
-37574,
-35751,
-35090,
-36625,
-39499,
-42486,
-44202,
-43620,
-41640,
-39317,
-38180,
-38525,
-39949,
-41059,
-41086,
-40214,
-39317,
-39710,
-41352,
-43487,
-44307,
-42989,
-40184,
-37419,
-36752,
-38340,
-41085,
-42829,
-42485,
-40584,
-38472,
-37888,
-38791,
-40290,
-40772,
-39841,
-37894,
-36408,
-36387,
-37783,
-39555,
-40504,
-39897,
-38287,
-36437,
-35118,
-34879,
-34696,
-34641,
-34247,
-34007,
-34459,
-35459,
-35779,
-35407,
-33216,
-31210,
-29756,
-29994,
-31158,
-32289,
-32558,
-32001,
-31472,
-31158,
-31287,
-30893,
-30020,
-28807,
-28197,
-28703,
-29886,
-31396,
-31788,
-31845,
-31366,
-31237,
-31392,
-31052,
-30522,
-29202,
-28780,
-28833,
-30494,
-32162,
-33425,
-33165,
-31658,
-29624,
-28516,
-28805,
-30577,
-32686,
-34142,
-34007,
-33006,
-31393,
-30497,
-30548,
-31394,
-32636,
-34006,
-34592,
-34904,
-34142,
-33188,
-32029,
-31868,
-32636,
-34431,
-35988,
-36676,
-35936,
-34614,
-33827,
-34136,
-35439,
-36777,
-37206,
-36357,
-34986,
-33772,
-33636,
-34487,
-35773,
-36733,
-36910,
-36439,
-35620,
-35194,
-35015,
-35432,
-35779,
-36067,
-36017,
-35696,
-35226,
-34877,
-34300,
-34141,
-33637,
-33561,
-33664,
-34140,
-34854,
-35461,
-35381,
-34616,
-33083,
-31712,
-30654,
-31157,
-32132,
-33904,
-35038,
-35222,
-34433,
-32949,
-31661,
-30838,
-30865,
-31316,
-31948,
-32213,
-32608,
-32609,
-32872,
-33033,
-32871,
-32504,
-31684,
-30734,
-30231,
-30128,
-30785,
-31739,
-32765,
-33402,
-33532,
-32742,
-31816,
-30523,
-29887,
-29653,
-30282,
-31213,
-32104,
-32953,
-33085,
-33450,
-33142,
-33107,
-32795,
-32449,
-32213,
-32160,
-32372,
-33082,
-33667,
-34428,
-34540,
-34560,
-34221,
-34034,
-34009,
-33928,
-33799,
-33530,
-33219,
-33530,
-34170,
-35115,
-35594,
-35037,
-33534,
-31816,
-30787,
-31103,
-32714,
-34484,
-35804,
-35725,
-34589,
-32741,
-31049,
-30129,
-30256,
-31396,
-33267,
-34749,
-35777,
-35091,
-33692,
-31604,
-30154,
-29677,
-30231,
-31396,
-32448,
-32849,
-32844,
-32082,
-31102,
-29995,
-28860,
-28619,
-28544,
-29491,
-30101,
-30284,
-29678,
-27961,
-26666,
-25586,
-25900,
-26826,
-27987,
-28357,
-27750,
-26429,
-24872,
-24342,
-24476,
-25690,
-26771,
-27303,
-27114,
-26166,
-25268,
-24526,
-24478,
-24842,
-25692,
-26454,
-26986,
-26981,
-26353,
-25529,
-24794,
-24818,
-25371,
-26590,
-27379,
-27724,
-26983,
-25981,
-24950,
-24793,
-25398,
-26774,
-27854,
-28464,
-27881,
-26904,
-25850,
-25740,
-26459,
-27984,
-29443,
-30044,
-29838,
-28699,
-27910,
-27747,
-28598,
-29674,
-30631,
-30838,
-30338,
-30178,
-29785,
-30547,
-30948,
-31575,
-31793,
-31761,
-31766,
-31737,
-31762,
-31766,
-31867,
-31897,
-32318,
-32661,
-33111,
-33110,
-32742,
-32105,
-31606,
-31632,
-32239,
-33189,
-34036,
-34535,
-34378,
-34142,
-34006,
-34037,
-34351,
-34297,
-34697,
-34772,
-35753,
-36516,
-37019,
-36650,
-35407,
-34219,
-33956,
-34879,
-36677,
-38180,
-38681,
-38105,
-36856,
-35755,
-35220,
-35410,
-35934,
-37075,
-38256,
-39425,
-39974,
-39292,
-37993,
-36414,
-35907,
-36599,
-38100,
-39765,
-40426,
-40213,
-39529,
-38735,
-38496,
-38606,
-38864,
-39134,
-39474,
-39949,
-40611,
-41086,
-41269,
-40929,
-40529,
-40215,
-40479,
-41058,
-41720,
-42194,
-42142,
-41958,
-41718,
-41852,
-42248,
-42748,
-42671,
-42405,
-41668,
-41322,
-41245,
-41638,
-42038,
-42300,
-42115,
-41932,
-41399,
-40825,
-39922,
-39158,
-38763,
-38944,
-39583,
-39842,
-39345,
-38100,
-36728,
-36043,
-36383,
-36968,
-37308,
-36808,
-35619,
-34879,
-34643,
-35169,
-35437,
-35326,
-34406,
-33584,
-33192,
-33347,
-33797,
-33850,
-33188,
-32242,
-31365,
-31343,
-31921,
-32555,
-32451,
-31342,
-29596,
-28360,
-28090,
-29152,
-30309,
-30920,
-30020,
-28384,
-26482,
-25426,
-25135,
-25347,
-25690,
-26033,
-26402,
-26854,
-26638,
-25930,
-23867,
-21965,
-20517,
-20854,
-22735,
-24896,
-26562,
-25954,
-24106,
-21067,
-18904,
-18216,
-19564,
-22231,
-24922,
-26326,
-25714,
-23262,
-20462,
-18531,
-18800,
-20723,
-23104,
-24738,
-24397,
-22889,
-20832,
-19643,
-19562,
-20357,
-21358,
-22046,
-22204,
-21835,
-21331,
-20411,
-19641,
-19194,
-19458,
-20222,
-21731,
-22387,
-22656,
-21487,
-19963,
-18584,
-18058,
-18747,
-20221,
-21651,
-22468,
-22124,
-20832,
-19325,
-17847,
-17451,
-17530,
-18375,
-19088,
-19246,
-18745,
-17319,
-15945,
-14626,
-14572,
-15443,
-17346,
-19298,
-20700,
-21385,
-21359,
-21544,
-22283,
-23894,
-26140,
-28276,
-30075,
-30891,
-31210,
-31208,
-31528,
-32527,
-34194,
-36175,
-37861,
-38844,
-38601,
-37785,
-36650,
-36120,
-36517,
-37574,
-39052,
-40583,
-41615,
-42430,
-42356,
-41823,
-40743,
-39500,
-38947,
-39264,
-40900,
-43199,
-45494,
-47081,
-47793,
-47846,
-47766,
-48084,
-48612,
-49667,
-50250,
-51093,
-51622,
-52575,
-53679,
-54767,
-55529,
-55558,
-55028,
-54290,
-53761,
-53761,
-53894,
-53998,
-53999,
-54026,
-54552,
-55347,
-56454,
-56720,
-56347,
-54556,
-52913,
-51546,
-51858,
-53313,
-55319,
-56799,
-56716,
-55456,
-53307,
-51785,
-51144,
-51651,
-52676,
-53552,
-53786,
-53392,
-52126,
-50483,
-48271,
-46233,
-44547,
-43699,
-43859,
-44147,
-44177,
-42853,
-40481,
-37280,
-34512,
-32475,
-32135,
-32423,
-33190,
-33479,
-32927,
-31974,
-30788,
-30045,
-29653,
-29728,
-29469,
-28882,
-27648,
-26531,
-25904,
-26138,
-27036,
-27988,
-28279,
-27483,
-25852,
-23574,
-21730,
-20462,
-20011,
-20278,
-20802,
-21414,
-21516,
-20885,
-19721,
-17767,
-16581,
-15441,
-15975,
-16735,
-18086,
-18850,
-19008,
-18826,
-18425,
-18774,
-19455,
-21044,
-22599,
-24265,
-25399,
-26112,
-26245,
-26429,
-26773,
-27486,
-28541,
-29598,
-30313,
-30838,
-30735,
-30732,
-30999,
-31473,
-32476,
-33059,
-33268,
-32767,
-31897,
-31234,
-31289,
-31869,
-32715,
-33452,
-33906,
-34321,
-35042,
-35774,
-36124,
-35802,
-34775,
-34167,
-34508,
-36334,
-38814,
-40900,
-41616,
-41002,
-39691,
-38942,
-38976,
-40028,
-40822,
-41376,
-40980,
-40187,
-39502,
-38999,
-38920,
-38895,
-38865,
-38606,
-38310,
-37945,
-37730,
-37443,
-37202,
-36360,
-35539,
-34457,
-33798,
-33849,
-34431,
-35514,
-36015,
-36094,
-34881,
-33479,
-31949,
-31209,
-31262,
-31921,
-32558,
-32712,
-32188,
-31102,
-29732,
-28751,
-27910,
-27511,
-26904,
-26273,
-25054,
-24133,
-22863,
-22496,
-22255,
-22207,
-22201,
-21546,
-20803,
-19776,
-19166,
-19009,
-19432,
-20011,
-20516,
-20696,
-20279,
-19825,
-19064,
-18769,
-18825,
-19431,
-20487,
-21413,
-21991,
-21758,
-21250,
-20623,
-20564,
-20832,
-21572,
-21805,
-22075,
-21938,
-22257,
-22497,
-22940,
-22789,
-22253,
-21890,
-22018,
-22970,
-24239,
-25001,
-25586,
-25213,
-25559,
-25795,
-26774,
-27378,
-27699,
-27800,
-28148,
-29280,
-30840,
-32397,
-32795,
-32316,
-31290,
-30442,
-31024,
-32717,
-35062,
-37337,
-38258,
-37972,
-36726,
-35331,
-34877,
-35437,
-37228,
-39185,
-40716,
-41085,
-40294,
-38762,
-37492,
-36890,
-37993,
-39689,
-41847,
-43149,
-43117,
-42064,
-40663,
-39578,
-39952,
-40742,
-42405,
-43464,
-44146,
-44126,
-43722,
-42966,
-42214,
-41568,
-41582,
-41986,
-43251,
-44227,
-44783,
-44572,
-43382,
-42459,
-41483,
-41531,
-41803,
-42218,
-42407,
-42247,
-42142,
-42010,
-41983,
-41747,
-41084,
-40215,
-39422,
-39209,
-39821,
-41003,
-42198,
-42693,
-42567,
-41374,
-40585,
-39923,
-40214,
-40743,
-41375,
-41746,
-41746,
-41718,
-41696,
-42007,
-41958,
-41799,
-41085,
-40425,
-39925,
-40053,
-40508,
-41294,
-41273,
-41056,
-39847,
-38944,
-37972,
-37704,
-37626,
-37997,
-38391,
-38682,
-38736,
-38048,
-36835,
-35302,
-34034,
-33744,
-34221,
-35460,
-36173,
-36387,
-35167,
-33827,
-32369,
-31842,
-32005,
-32499,
-32875,
-32714,
-32290,
-31636,
-31416,
-31423,
-31498,
-31369,
-30839,
-30364,
-29782,
-29705,
-29703,
-29573,
-29571,
-29228,
-29071,
-29174,
-29152,
-29172,
-28889,
-28407,
-28280,
-28197,
-28516,
-28410,
-28304,
-27803,
-27327,
-27274,
-27089,
-27197,
-26717,
-25905,
-25053,
-24212,
-24159,
-24289,
-24873,
-24923,
-24607,
-23552,
-22097,
-20621,
-19747,
-19353,
-19933,
-20645,
-21414,
-21806,
-21386,
-20647,
-19694,
-19010,
-18903,
-19351,
-19960,
-20621,
-20723,
-20701,
-20248,
-20145,
-19960,
-19932,
-19803,
-19455,
-19143,
-18849,
-18428,
-17927,
-17160,
-16367,
-16237,
-16710,
-17848,
-18745,
-18744,
-17688,
-15947,
-14675,
-14444,
-15520,
-17056,
-18216,
-18322,
-17636,
-16553,
-15997,
-15921,
-16392,
-16608,
-16447,
-15786,
-15048,
-14599,
-14466,
-14494,
-14149,
-13331,
-12248,
-11378,
-11033,
-11430,
-12169,
-13410,
-14705,
-16448,
-18241,
-19962,
-21436,
-22337,
-23367,
-24659,
-26773,
-29413,
-32238,
-34697,
-36410,
-37627,
-38390,
-39028,
-39684,
-40031,
-40292,
-40215,
-40133,
-40218,
-40657,
-41540,
-42667,
-43542,
-44045,
-43512,
-42592,
-41298,
-40238,
-39953,
-40449,
-41193,
-42273,
-42697,
-43171,
-43410,
-44042,
-45049,
-46127,
-47240,
-47581,
-47714,
-47477,
-47687,
-48611,
-50277,
-52281,
-54132,
-55293,
-55793,
-55611,
-55107,
-54528,
-53945,
-53577,
-53523,
-53762,
-54340,
-55005,
-55685,
-56195,
-56373,
-56403,
-56111,
-55292,
-54132,
-52731,
-51674,
-51466,
-52016,
-53208,
-54104,
-54684,
-54081,
-53495,
-52495,
-51965,
-51489,
-51069,
-50380,
-49405,
-48505,
-47635,
-47344,
-47107,
-46947,
-46289,
-44992,
-43068,
-40768,
-38366,
-36410,
-34961,
-34006,
-33324,
-32845,
-32239,
-31843,
-31447,
-31287,
-30947,
-30441,
-29601,
-28433,
-27541,
-26665,
-26564,
-26717,
-26933,
-27220,
-26827,
-26217,
-25216,
-24050,
-23290,
-22545,
-22390,
-21650,
-20882,
-19117,
-17290,
-15577,
-14440,
-14519,
-14917,
-15626,
-15658,
-14781,
-13386,
-11720,
-10846,
-10668,
-11505,
-12570,
-13855,
-14865,
-16208,
-17558,
-19351,
-20857,
-22100,
-22334,
-22496,
-22283,
-22916,
-24055,
-25634,
-27463,
-28802,
-29813,
-30044,
-29891,
-29307,
-28938,
-28727,
-29281,
-29915,
-30998,
-31077,
-31156,
-30180,
-29729,
-29520,
-30205,
-31367,
-32478,
-33268,
-33269,
-33295,
-33427,
-34301,
-35881,
-37495,
-38946,
-39818,
-40427,
-41084,
-42142,
-43277,
-44414,
-45151,
-45603,
-46022,
-46500,
-46683,
-46818,
-46206,
-45657,
-45229,
-45418,
-45890,
-46528,
-46629,
-46342,
-45627,
-45073,
-44624,
-44441,
-44278,
-43993,
-43619,
-43410,
-43410,
-43646,
-44018,
-44147,
-44071,
-43593,
-43041,
-42300,
-42009,
-41825,
-42062,
-42117,
-42221,
-41824,
-41218,
-40345,
-39398,
-38390,
-37706,
-36808,
-36251,
-35464,
-34797,
-34117,
-33583,
-33113,
-32501,
-31712,
-30602,
-29094,
-28176,
-27350,
-27806,
-28432,
-29364,
-29543,
-28887,
-27353,
-25742,
-24528,
-24608,
-25583,
-27011,
-27803,
-28012,
-26986,
-26084,
-25216,
-25161,
-25743,
-26429,
-27011,
-27036,
-26668,
-26057,
-25588,
-25263,
-25352,
-25526,
-25774,
-26028,
-25906,
-25976,
-25773,
-25872,
-26087,
-26456,
-26931,
-27036,
-27143,
-27036,
-27064,
-27459,
-28330,
-29362,
-30494,
-31132,
-31471,
-31633,
-31737,
-32080,
-32398,
-32661,
-33137,
-33480,
-34749,
-35801,
-36969,
-37386,
-36863,
-36118,
-35306,
-35403,
-36205,
-37095,
-37812,
-37626,
-36834,
-35962,
-35172,
-35141,
-35384,
-36040,
-36491,
-36650,
-36357,
-35779,
-35064,
-34589,
-34353,
-34428,
-34698,
-34983,
-35383,
-35672,
-36014,
-35699,
-35223,
-33982,
-33058,
-32423,
-32979,
-33902,
-34881,
-34746,
-33428,
-31315,
-29678,
-29016,
-29916,
-31155,
-32215,
-31973,
-30656,
-28540,
-26906,
-26060,
-26534,
-27725,
-28988,
-30050,
-30072,
-29810,
-28964,
-28463,
-28541,
-29257,
-30600,
-32213,
-33137,
-33690,
-33140,
-32579,
-32162,
-32661,
-33954,
-35570,
-36618,
-37022,
-36357,
-35594,
-34773,
-34802,
-35115,
-35991,
-36674,
-37310,
-37600,
-37810,
-37628,
-37571,
-37312,
-37332,
-37551,
-38177,
-38607,
-38838,
-38578,
-37811,
-37229,
-37205,
-37836,
-39106,
-40161,
-40451,
-39899,
-38760,
-37838,
-37494,
-37811,
-38524,
-39080,
-39577,
-39769,
-39973,
-40005,
-39897,
-39552,
-39055,
-38785,
-38685,
-38787,
-38655,
-38632,
-38337,
-38499,
-39025,
-39659,
-40136,
-40054,
-39160,
-38231,
-37312,
-36911,
-37126,
-37545,
-38130,
-38391,
-38340,
-38048,
-37520,
-36809,
-36383,
-35701,
-35590,
-35357,
-35328,
-35302,
-35118,
-35038,
-34721,
-34536,
-34274,
-34086,
-33850,
-33402,
-32976,
-32294,
-31974,
-31526,
-31553,
-31446,
-31657,
-31608,
-31577,
-31183,
-30998,
-30337,
-30021,
-29679,
-29331,
-29522,
-29437,
-29706,
-29914,
-29704,
-29493,
-28937,
-28648,
-28358,
-28673,
-28780,
-29308,
-29201,
-29256,
-28990,
-29044,
-28992,
-29385,
-29784,
-30311,
-30971,
-31104,
-31394,
-31076,
-30972,
-30761,
-31049,
-31422,
-32000,
-32477,
-32768,
-32765,
-33007,
-32845,
-32979,
-32688,
-32555,
-32345,
-32688,
-33057,
-33720,
-34057,
-34119,
-33633,
-33353,
-33160,
-33244,
-33533,
-33663,
-33483,
-33478,
-33059,
-33189,
-33110,
-33296,
-33190,
-33083,
-32689,
-32450,
-32133,
-31817,
-31657,
-31342,
-31235,
-30919,
-30839,
-30418,
-29991,
-29259,
-28511,
-27861,
-27453,
-27016,
-26423,
-25379,
-23996,
-22840,
-21675,
-21464,
-20991,
-20856,
-19908,
-18717,
-17213,
-15761,
-14625,
-13702,
-13224,
-12751,
-12802,
-12567,
-12379,
-11510,
-10241,
-8842,
-7548,
-7020,
-6781,
-6889,
-6676,
-5936,
-4936,
-3531,
-2427,
-1394,
-444,
-65535,
-0,
-65535,
-1,
-65535,
-65535,
-1,
-65535,
-0,
-0,
-65535,
-1,
-65535,
-0,
-1132,
-3347,
-5490,
-7361,
-9080,
-10771,
-12405,
-14284,
-15943,
-17822,
-19986,
-22414,
-25111,
-27536,
-29151,
-29968,
-29808,
-29600,
-29306,
-29442,
-30072,
-30840,
-32238,
-33693,
-35248,
-36624,
-37229,
-37151,
-36413,
-35668,
-35413,
-35852,
-37340,
-39314,
-41771,
-44231,
-46364,
-47875,
-48875,
-49191,
-49617,
-50169,
-51384,
-53129,
-54948,
-57037,
-58778,
-60468,
-61896,
-62949,
-63535,
-63556,
-63533,
-63294,
-63583,
-63826,
-64136,
-64248,
-63952,
-63639,
-63293,
-63269,
-63242,
-63187,
-62662,
-61894,
-60864,
-59969,
-59120,
-58463,
-57616,
-56666,
-55821,
-55426,
-55925,
-56826,
-57562,
-57196,
-55556,
-52679,
-49852,
-47820,
-47107,
-47607,
-48349,
-48795,
-48191,
-46497,
-44151,
-41586,
-39395,
-38024,
-37228,
-36915,
-36331,
-35382,
-33901,
-32480,
-31391,
-31158,
-31314,
-31710,
-31343,
-30600,
-29045,
-27696,
-26430,
-25795,
-25637,
-25637,
-25901,
-25638,
-25293,
-24343,
-23182,
-21885,
-20675,
-19720,
-19354,
-19006,
-19065,
-18820,
-18405,
-17818,
-17267,
-16896,
-17239,
-17901,
-19297,
-20411,
-21436,
-21757,
-21860,
-22073,
-23073,
-24901,
-27615,
-30207,
-32689,
-34032,
-35067,
-35512,
-36332,
-37654,
-39315,
-41298,
-42933,
-44043,
-44837,
-45070,
-45368,
-45412,
-45790,
-46154,
-46947,
-47637,
-48318,
-48273,
-47868,
-46581,
-45811,
-45444,
-46207,
-47662,
-49114,
-49877,
-49619,
-48661,
-47530,
-47318,
-47819,
-49589,
-51121,
-52651,
-52996,
-52678,
-51992,
-51517,
-51859,
-52626,
-53840,
-54527,
-54634,
-54208,
-53209,
-52702,
-52047,
-51911,
-51703,
-51198,
-50674,
-49850,
-49116,
-48372,
-47530,
-46552,
-45627,
-44626,
-43934,
-43387,
-42719,
-42067,
-41028,
-39795,
-38759,
-37918,
-37495,
-37229,
-36886,
-36122,
-35143,
-33877,
-32820,
-31975,
-31261,
-30841,
-30204,
-29679,
-29147,
-28334,
-27879,
-26722,
-25952,
-24819,
-24318,
-23866,
-24002,
-23944,
-23765,
-23152,
-22234,
-21487,
-21019,
-21119,
-21520,
-22175,
-22708,
-22678,
-22548,
-21782,
-21279,
-20805,
-20884,
-21279,
-21967,
-22468,
-22548,
-21965,
-21097,
-20036,
-19329,
-19163,
-19409,
-19851,
-19961,
-19642,
-18797,
-17979,
-17372,
-17345,
-17952,
-18772,
-19668,
-20171,
-20356,
-20064,
-19829,
-19747,
-20356,
-21650,
-23285,
-25032,
-26295,
-26696,
-26638,
-26194,
-26215,
-26934,
-28355,
-30049,
-31392,
-31950,
-31657,
-30840,
-30153,
-30125,
-30867,
-32054,
-33215,
-33535,
-33372,
-32347,
-31472,
-30945,
-31051,
-31737,
-32317,
-32929,
-32895,
-32798,
-32472,
-32216,
-32025,
-32109,
-32080,
-32476,
-32689,
-33030,
-33085,
-32951,
-32715,
-32398,
-32212,
-32344,
-32451,
-32714,
-32793,
-32849,
-32631,
-32427,
-32053,
-31869,
-31765,
-32132,
-32372,
-32661,
-32583,
-32001,
-31473,
-30787,
-30680,
-30524,
-30758,
-30710,
-30652,
-30577,
-30443,
-30388,
-30183,
-29833,
-29573,
-29546,
-30415,
-31686,
-33771,
-35142,
-36281,
-36068,
-35565,
-34698,
-34743,
-35492,
-36988,
-38687,
-39919,
-40746,
-40687,
-40348,
-39553,
-38787,
-38077,
-37651,
-37416,
-37705,
-37837,
-38155,
-38179,
-37998,
-37835,
-37682,
-37386,
-37073,
-36331,
-35435,
-34431,
-33955,
-33771,
-34695,
-35750,
-37232,
-38179,
-38525,
-37916,
-36835,
-35274,
-34196,
-33873,
-34539,
-36198,
-38130,
-39895,
-40849,
-40795,
-39791,
-38499,
-37175,
-36598,
-36384,
-37099,
-38021,
-39079,
-40268,
-40767,
-41035,
-40423,
-39634,
-38709,
-38075,
-37943,
-37996,
-37996,
-37890,
-37573,
-37336,
-37441,
-37706,
-38022,
-37996,
-37309,
-36042,
-34722,
-33267,
-32663,
-32450,
-32846,
-33243,
-33426,
-33217,
-32450,
-31552,
-30630,
-30044,
-29627,
-29492,
-29202,
-28860,
-28381,
-27752,
-27536,
-27516,
-28036,
-28598,
-29173,
-29309,
-28939,
-27880,
-26642,
-25530,
-24767,
-24792,
-25109,
-25689,
-25954,
-25954,
-25215,
-24475,
-23393,
-22441,
-21492,
-20723,
-20094,
-19984,
-20041,
-20406,
-20727,
-20671,
-20384,
-19640,
-18984,
-18506,
-18297,
-18638,
-18904,
-19615,
-20040,
-20566,
-20804,
-21123,
-21305,
-21650,
-21887,
-22336,
-22548,
-23155,
-23708,
-24370,
-24977,
-25188,
-25109,
-24739,
-24422,
-24555,
-25003,
-25769,
-26376,
-26536,
-26375,
-26062,
-25582,
-25692,
-25503,
-25956,
-26137,
-26668,
-27116,
-27406,
-27407,
-26984,
-26455,
-25954,
-25901,
-26219,
-26771,
-27039,
-27061,
-26404,
-25901,
-25186,
-25059,
-24869,
-24742,
-24261,
-23315,
-22441,
-21570,
-21228,
-21068,
-21201,
-20805,
-20275,
-19168,
-17978,
-17004,
-16286,
-15948,
-16022,
-15815,
-15497,
-14782,
-13518,
-12378,
-11089,
-10345,
-9873,
-9237,
-8525,
-7312,
-5855,
-4487,
-3109,
-1977,
-1052,
-100,
-0,
-65535,
-0,
-65535,
-1,
-65535,
-1,
-65535,
-1108,
-2923,
-4964,
-7333,
-9267,
-11348,
-13201,
-15231,
-17426,
-19720,
-22312,
-24525,
-26722,
-28066,
-29016,
-29311,
-29726,
-30395,
-31521,
-33089,
-34479,
-35491,
-35854,
-35727,
-35379,
-35463,
-35855,
-37099,
-38576,
-40347,
-41718,
-42962,
-43488,
-44517,
-45419,
-47342,
-49379,
-51542,
-53418,
-54792,
-56163,
-57671,
-59569,
-61764,
-63717,
-65353,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-65532,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65532,
-65534,
-64744,
-63930,
-63108,
-62504,
-61839,
-61133,
-59830,
-58361,
-56318,
-54452,
-52728,
-51651,
-50696,
-49801,
-48427,
-46446,
-44492,
-42353,
-40954,
-39765,
-38999,
-37997,
-36700,
-35040,
-33135,
-31475,
-30019,
-28914,
-27905,
-26722,
-25425,
-23894,
-22338,
-20591,
-18957,
-17398,
-16262,
-15418,
-14863,
-14228,
-13200,
-11931,
-10559,
-9739,
-9634,
-9978,
-10610,
-11035,
-11059,
-11114,
-10926,
-11327,
-11823,
-12832,
-13910,
-15365,
-17082,
-18743,
-20411,
-21462,
-22206,
-22677,
-23315,
-24317,
-25901,
-27802,
-29466,
-30787,
-31261,
-31317,
-31127,
-31318,
-31839,
-32877,
-34110,
-35200,
-36119,
-36649,
-37047,
-37254,
-37681,
-38312,
-39368,
-40613,
-42033,
-43253,
-44228,
-45072,
-45682,
-46735,
-47662,
-49009,
-50221,
-51280,
-52202,
-52705,
-53340,
-53839,
-54555,
-55238,
-55981,
-56506,
-56747,
-56823,
-56482,
-56137,
-55426,
-55080,
-54556,
-54365,
-54214,
-53652,
-53103,
-52124,
-51040,
-50145,
-49218,
-48584,
-47690,
-46602,
-45525,
-44253,
-43408,
-42435,
-41716,
-40798,
-39763,
-38763,
-37757,
-36862,
-36145,
-35198,
-34484,
-33320,
-32348,
-31125,
-29920,
-28987,
-27965,
-27534,
-26777,
-26187,
-24955,
-23705,
-22182,
-20933,
-20121,
-19534,
-19170,
-18584,
-18139,
-17317,
-16845,
-16208,
-15736,
-15284,
-14809,
-14549,
-14304,
-14286,
-14067,
-13993,
-13886,
-13990,
-14020,
-14174,
-13834,
-13647,
-13226,
-13305,
-13807,
-14440,
-14994,
-15180,
-14704,
-14336,
-14044,
-14334,
-15101,
-15997,
-16846,
-17448,
-18008,
-18847,
-20148,
-22227,
-24478,
-26955,
-29018,
-30946,
-32581,
-34140,
-35568,
-37122,
-38342,
-39604,
-40691,
-42115,
-43278,
-44728,
-45287,
-45387,
-44495,
-43328,
-42011,
-41375,
-41325,
-41955,
-42883,
-43910,
-44862,
-45681,
-46181,
-46236,
-45655,
-44648,
-43650,
-43300,
-43730,
-45441,
-47239,
-49035,
-50008,
-50016,
-49374,
-48138,
-47000,
-46103,
-45628,
-45628,
-45971,
-46259,
-46582,
-46364,
-46025,
-45153,
-44095,
-42485,
-40612,
-38680,
-37047,
-36172,
-35964,
-36278,
-36571,
-36438,
-35749,
-34803,
-33611,
-32819,
-32110,
-31786,
-31345,
-31047,
-30605,
-30044,
-29707,
-29067,
-28967,
-28566,
-28465,
-27933,
-27327,
-26061,
-24923,
-23604,
-22811,
-22231,
-22256,
-22101,
-22254,
-21782,
-21493,
-20722,
-20016,
-18953,
-17901,
-16553,
-15232,
-14176,
-13701,
-13622,
-14334,
-14890,
-15285,
-15206,
-14388,
-13066,
-11589,
-10188,
-9371,
-9106,
-9527,
-10111,
-10583,
-10428,
-9791,
-8474,
-7493,
-6546,
-6227,
-6201,
-6201,
-6307,
-6069,
-6122,
-6280,
-6809,
-7626,
-8448,
-9261,
-9558,
-9790,
-9346,
-9236,
-8632,
-8761,
-8870,
-9370,
-10187,
-10561,
-10978,
-10428,
-9607,
-8209,
-6861,
-5725,
-4749,
-4378,
-3642,
-3083,
-1897,
-577,
-65535,
-0,
-65535,
-0,
-65535,
-65535,
-1,
-65535,
-2,
-65535,
-65535,
-1,
-65535,
-3,
-1523,
-4699,
-8311,
-11828,
-15178,
-18298,
-21435,
-24584,
-27800,
-31025,
-33771,
-36095,
-37650,
-38660,
-39365,
-39662,
-39924,
-39526,
-39026,
-38023,
-36965,
-36122,
-35672,
-35459,
-35806,
-36040,
-36360,
-36437,
-36148,
-35882,
-35806,
-36515,
-37971,
-40293,
-42933,
-45392,
-47659,
-49565,
-51487,
-53473,
-55317,
-57065,
-58539,
-59624,
-61314,
-63003,
-65534,
-65532,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65532,
-65534,
-65534,
-65532,
-65534,
-65532,
-65534,
-65534,
-65532,
-65332,
-64716,
-64117,
-63476,
-62530,
-61814,
-61158,
-60889,
-60681,
-60283,
-59544,
-58199,
-56612,
-54898,
-53390,
-51808,
-50142,
-48138,
-46181,
-44467,
-43592,
-43332,
-43541,
-43383,
-42512,
-40530,
-38075,
-35330,
-33161,
-31713,
-30732,
-30154,
-29149,
-28040,
-26350,
-24792,
-22970,
-21121,
-19064,
-16681,
-14286,
-11875,
-10086,
-8734,
-8078,
-7810,
-7471,
-7361,
-6546,
-5909,
-5093,
-4934,
-5302,
-6493,
-7785,
-9422,
-10798,
-12246,
-13597,
-15153,
-16605,
-18296,
-19722,
-21332,
-22839,
-24315,
-25532,
-26377,
-26719,
-26774,
-26824,
-27196,
-27880,
-28781,
-29387,
-29836,
-29677,
-29413,
-29282,
-29413,
-30100,
-30945,
-32002,
-33030,
-33877,
-34852,
-35701,
-36779,
-38156,
-39419,
-41221,
-42720,
-44653,
-46340,
-48108,
-49514,
-50772,
-51890,
-52994,
-54262,
-55639,
-56848,
-57777,
-58250,
-58144,
-57829,
-57458,
-57379,
-57353,
-57299,
-56826,
-55871,
-54795,
-53388,
-52601,
-51675,
-51304,
-50805,
-50327,
-49774,
-49114,
-48611,
-48084,
-47712,
-47347,
-46919,
-46582,
-46151,
-46028,
-45703,
-45446,
-45072,
-44492,
-43938,
-43144,
-42408,
-41479,
-40401,
-39052,
-37863,
-36491,
-35435,
-34218,
-33139,
-31603,
-30075,
-28224,
-26828,
-25766,
-25322,
-25028,
-24847,
-23998,
-23210,
-21753,
-20990,
-20251,
-20380,
-20728,
-21410,
-21994,
-22573,
-22627,
-22389,
-21807,
-20966,
-20351,
-19964,
-20061,
-20648,
-21122,
-21648,
-21386,
-20884,
-19827,
-18878,
-18293,
-18061,
-18373,
-18693,
-19035,
-19009,
-18981,
-18774,
-18872,
-19199,
-19876,
-20755,
-21674,
-22494,
-23368,
-24183,
-25110,
-26033,
-27115,
-28174,
-29385,
-30524,
-31657,
-32794,
-33744,
-34721,
-35541,
-36384,
-37099,
-37782,
-38290,
-38864,
-39108,
-39577,
-39689,
-40054,
-40162,
-40425,
-40530,
-40690,
-40690,
-40477,
-40268,
-40028,
-39898,
-39923,
-40030,
-40028,
-40056,
-40083,
-40028,
-40242,
-40291,
-40428,
-40370,
-40454,
-40529,
-40928,
-41350,
-41718,
-42091,
-42007,
-42093,
-42085,
-42197,
-42431,
-42459,
-42460,
-42220,
-42168,
-42011,
-42113,
-42066,
-41981,
-41535,
-40928,
-40266,
-39713,
-39474,
-39212,
-39076,
-38659,
-38020,
-37415,
-36652,
-36168,
-35811,
-35269,
-35017,
-34322,
-33930,
-33428,
-33189,
-33110,
-32795,
-32791,
-32163,
-32051,
-31449,
-31578,
-31498,
-31820,
-32023,
-32270,
-32236,
-32345,
-32161,
-32263,
-32348,
-32684,
-33035,
-33503,
-33827,
-34137,
-34329,
-34347,
-34514,
-34718,
-34725,
-35142,
-34826,
-34908,
-34349,
-34037,
-33902,
-33770,
-33956,
-33771,
-33506,
-32741,
-32000,
-31238,
-30863,
-30763,
-30890,
-31025,
-30840,
-30548,
-30022,
-29649,
-29469,
-29384,
-29548,
-29438,
-29573,
-29466,
-29518,
-29573,
-29571,
-29307,
-28941,
-28406,
-28148,
-28146,
-28276,
-28702,
-28594,
-28436,
-27750,
-27037,
-26481,
-26166,
-26218,
-26245,
-26375,
-26115,
-25844,
-25087,
-24710,
-24001,
-23868,
-23523,
-23473,
-23181,
-23022,
-22548,
-22177,
-21650,
-21386,
-20936,
-20752,
-20275,
-19829,
-19351,
-18983,
-18825,
-18900,
-18959,
-19033,
-18640,
-18085,
-17529,
-17134,
-17161,
-17529,
-17927,
-18294,
-18246,
-18081,
-17375,
-16973,
-16500,
-16317,
-16313,
-16317,
-16368,
-15996,
-15580,
-14883,
-14263,
-13720,
-13337,
-13300,
-13387,
-13646,
-13888,
-13910,
-13861,
-13672,
-13492,
-13621,
-14149,
-14864,
-15944,
-16581,
-17238,
-17241,
-17475,
-17347,
-17687,
-17954,
-18691,
-19299,
-20144,
-20542,
-20961,
-20939,
-20934,
-21069,
-21439,
-22124,
-22839,
-23417,
-23579,
-23682,
-23656,
-23975,
-24234,
-24664,
-24816,
-24925,
-24819,
-24763,
-24690,
-24657,
-24530,
-24369,
-23972,
-23764,
-23391,
-23050,
-22494,
-21730,
-20935,
-20250,
-19881,
-20222,
-20648,
-21384,
-21545,
-21595,
-21361,
-21595,
-22338,
-23734,
-25743,
-27909,
-30469,
-32900,
-35460,
-37625,
-39292,
-40477,
-41033,
-41772,
-42696,
-44176,
-45838,
-47424,
-48401,
-48769,
-48137,
-47105,
-45498,
-44014,
-42488,
-41691,
-40848,
-41140,
-40977,
-41511,
-41453,
-41351,
-40742,
-40161,
-39370,
-39209,
-39185,
-39845,
-40900,
-42221,
-43886,
-45679,
-47160,
-48744,
-49588,
-50302,
-50779,
-51222,
-52155,
-53388,
-55216,
-57166,
-59096,
-60548,
-61235,
-61340,
-60969,
-60365,
-60071,
-59731,
-59807,
-59518,
-59546,
-58961,
-58835,
-58326,
-57962,
-57300,
-56110,
-54899,
-53337,
-52335,
-51702,
-51622,
-51940,
-52018,
-52017,
-51491,
-51015,
-50407,
-50382,
-50273,
-50596,
-50509,
-50464,
-49955,
-49619,
-49110,
-49064,
-48951,
-49064,
-49032,
-48772,
-48030,
-47026,
-45683,
-44383,
-43307,
-42509,
-41828,
-41373,
-40851,
-40421,
-40034,
-39393,
-38709,
-37337,
-35881,
-34116,
-32687,
-31684,
-31157,
-30838,
-30367,
-29727,
-28465,
-27194,
-25346,
-23897,
-22042,
-20649,
-19455,
-18694,
-18638,
-18692,
-18983,
-18742,
-18221,
-17393,
-16795,
-16788,
-17610,
-18771,
-20250,
-21359,
-22072,
-22653,
-22996,
-23631,
-24342,
-25162,
-26086,
-26773,
-27539,
-28012,
-28226,
-28120,
-27827,
-27463,
-27190,
-27015,
-26900,
-26698,
-26610,
-26275,
-26319,
-25984,
-26057,
-25480,
-25427,
-24764,
-24977,
-25109,
-25981,
-26957,
-27936,
-28671,
-29311,
-29728,
-30498,
-31418,
-32479,
-33664,
-34721,
-36016,
-37546,
-39211,
-40822,
-41824,
-42460,
-42299,
-42459,
-42617,
-43411,
-44305,
-45155,
-45625,
-45576,
-45206,
-44437,
-43703,
-42984,
-42566,
-42405,
-42671,
-42933,
-43198,
-42988,
-42616,
-41985,
-41453,
-41378,
-41506,
-42303,
-42694,
-43384,
-43145,
-43225,
-42722,
-42645,
-42615,
-42752,
-42931,
-43016,
-42959,
-42776,
-42301,
-41850,
-41060,
-40346,
-39422,
-38841,
-38049,
-37784,
-37125,
-36648,
-35832,
-34878,
-33984,
-33294,
-32793,
-32690,
-32447,
-32243,
-31919,
-31448,
-31289,
-31101,
-31133,
-31418,
-31554,
-31657,
-31632,
-31236,
-30891,
-30313,
-30018,
-29733,
-29755,
-29704,
-29574,
-29251,
-28784,
-28194,
-27648,
-27219,
-26959,
-26693,
-26666,
-26616,
-26612,
-26590,
-26480,
-26378,
-26429,
-26402,
-26907,
-27271,
-27991,
-28353,
-28784,
-29014,
-29178,
-29596,
-30181,
-30997,
-31870,
-32581,
-33138,
-33480,
-33612,
-33823,
-34036,
-34376,
-34881,
-35303,
-35670,
-36017,
-36147,
-36041,
-35990,
-35697,
-35831,
-35857,
-36280,
-36701,
-37045,
-37178,
-36885,
-36599,
-36225,
-36147,
-36280,
-36595,
-36889,
-37017,
-37072,
-36808,
-36858,
-36600,
-36698,
-36652,
-36621,
-36754,
-36810,
-37095,
-37391,
-37757,
-37915,
-38211,
-38098,
-38394,
-38312,
-38734,
-38843,
-39263,
-39579,
-39899,
-40212,
-40268,
-40347,
-39922,
-39687,
-39263,
-38947,
-38787,
-38685,
-38493,
-38344,
-37887,
-37338,
-36858,
-36229,
-35721,
-35307,
-34954,
-34884,
-34878,
-35038,
-35013,
-34930,
-34724,
-34324,
-34141,
-33903,
-33927,
-34038,
-34374,
-34619,
-35010,
-34880,
-34881,
-34376,
-34010,
-33584,
-33403,
-33214,
-33166,
-32764,
-32426,
-31763,
-30971,
-30260,
-29200,
-28491,
-27404,
-26538,
-25608,
-24716,
-24049,
-23264,
-22570,
-21759,
-20802,
-20093,
-19457,
-18983,
-18823,
-18508,
-18268,
-17822,
-17291,
-16897,
-16579,
-16579,
-16579,
-16818,
-16736,
-16978,
-16655,
-16820,
-16418,
-16372,
-16047,
-15843,
-15705,
-15472,
-15495,
-15129,
-14993,
-14309,
-13885,
-13252,
-12830,
-12406,
-11907,
-11189,
-10641,
-9975,
-9662,
-9607,
-9528,
-9425,
-8970,
-8319,
-7516,
-6892,
-6542,
-6413,
-6677,
-6675,
-6678,
-6490,
-6124,
-6146,
-5965,
-6359,
-6438,
-6995,
-7230,
-7838,
-8447,
-9025,
-9794,
-10294,
-10795,
-11193,
-11640,
-12039,
-12668,
-13097,
-13697,
-13942,
-14358,
-14548,
-14967,
-15181,
-15495,
-15657,
-15811,
-15789,
-15972,
-15891,
-16107,
-16127,
-16186,
-16393,
-16342,
-16474,
-16447,
-16368,
-16447,
-16289,
-16421,
-16421,
-16684,
-16791,
-16922,
-16766,
-16867,
-16609,
-16865,
-17007,
-17209,
-17612,
-17581,
-17848,
-18109,
-18695,
-20089,
-21703,
-24212,
-26639,
-29362,
-31895,
-34431,
-37071,
-39687,
-42325,
-44678,
-46895,
-48718,
-50406,
-51862,
-52913,
-53606,
-53521,
-52812,
-51543,
-50037,
-48613,
-47395,
-46686,
-46127,
-45947,
-45810,
-45841,
-45811,
-45893,
-45811,
-45549,
-45310,
-45155,
-45545,
-46582,
-48184,
-50044,
-51801,
-53001,
-53835,
-54056,
-54340,
-54606,
-55373,
-56559,
-58146,
-59914,
-61630,
-63084,
-63954,
-64456,
-64378,
-63927,
-63349,
-62473,
-61765,
-60995,
-60523,
-60099,
-59913,
-59651,
-59306,
-58620,
-57539,
-56269,
-54844,
-53576,
-52970,
-52465,
-52840,
-53125,
-53710,
-54050,
-54159,
-53997,
-53789,
-53443,
-53313,
-53312,
-53444,
-53868,
-54287,
-54899,
-55529,
-55900,
-56325,
-56002,
-55509,
-54443,
-53290,
-52358,
-51335,
-50668,
-49751,
-48662,
-47477,
-46209,
-45204,
-44387,
-43701,
-43037,
-42039,
-40713,
-39319,
-37677,
-36597,
-35751,
-35566,
-35567,
-35672,
-35195,
-34461,
-32763,
-31292,
-29515,
-28387,
-27562,
-27278,
-27006,
-26829,
-26373,
-25904,
-25265,
-24794,
-24209,
-23659,
-23100,
-22522,
-22255,
-22207,
-22571,
-23317,
-23995,
-24665,
-24946,
-24901,
-24631,
-24398,
-24422,
-24474,
-24899,
-25213,
-25480,
-25478,
-25242,
-24631,
-24109,
-23310,
-22813,
-22283,
-21888,
-21726,
-21337,
-21275,
-20888,
-20828,
-20674,
-20856,
-21071,
-21435,
-21970,
-22623,
-23342,
-24157,
-24741,
-25450,
-25983,
-26876,
-27804,
-29228,
-30575,
-32055,
-33056,
-33773,
-34164,
-34407,
-34931,
-35408,
-36306,
-37018,
-37654,
-37942,
-37996,
-37706,
-37493,
-37416,
-37440,
-37733,
-37995,
-38313,
-38497,
-38631,
-38734,
-39211,
-39633,
-40426,
-41111,
-41853,
-42535,
-43121,
-43832,
-44412,
-45205,
-45946,
-46708,
-47478,
-48110,
-48689,
-49143,
-49322,
-49431,
-49458,
-49508,
-49537,
-49694,
-49694,
-49616,
-49377,
-48453,
-47899,
-46816,
-46314,
-45866,
-45785,
-45735,
-45731,
-45365,
-44914,
-44280,
-43570,
-43011,
-42777,
-42643,
-42987,
-43091,
-43359,
-43407,
-42989,
-42616,
-41798,
-41192,
-40689,
-40109,
-39818,
-39474,
-39132,
-38814,
-38393,
-37757,
-37047,
-36040,
-34960,
-34034,
-33164,
-32661,
-32450,
-32134,
-31974,
-31183,
-30550,
-29305,
-28519,
-27614,
-27225,
-27034,
-27038,
-26931,
-26719,
-26219,
-25531,
-25056,
-24370,
-24501,
-24343,
-24713,
-24739,
-24634,
-24131,
-23473,
-22756,
-22419,
-22121,
-22499,
-22648,
-22974,
-22861,
-22630,
-21990,
-21572,
-20988,
-20938,
-20830,
-21095,
-21253,
-21413,
-21516,
-21652,
-21541,
-21572,
-21491,
-21437,
-21519,
-21648,
-21889,
-22361,
-22786,
-23365,
-23736,
-24053,
-24158,
-24316,
-24345,
-24842,
-25138,
-25978,
-26536,
-27249,
-27589,
-27884,
-28196,
-28465,
-29095,
-29652,
-30337,
-30893,
-31076,
-31263,
-31129,
-31209,
-31263,
-31498,
-31845,
-32132,
-32292,
-32397,
-32214,
-32343,
-32109,
-32421,
-32532,
-32897,
-33297,
-33744,
-34271,
-34802,
-35327,
-35647,
-36094,
-36148,
-36621,
-36598,
-37334,
-37574,
-38366,
-38761,
-39184,
-39396,
-39394,
-39292,
-39287,
-39108,
-39128,
-38976,
-38865,
-38499,
-37995,
-37469,
-36568,
-35990,
-35117,
-34405,
-33664,
-32901,
-31999,
-31238,
-30282,
-29575,
-28882,
-28598,
-28169,
-28122,
-27748,
-27539,
-27143,
-26929,
-26748,
-26719,
-26852,
-26825,
-26826,
-26613,
-26431,
-26163,
-26115,
-25978,
-25929,
-25874,
-25505,
-25321,
-24634,
-24288,
-23738,
-23285,
-23051,
-22652,
-22442,
-22045,
-21545,
-20803,
-20067,
-19192,
-18587,
-18138,
-17871,
-17823,
-17660,
-17478,
-16870,
-16473,
-15708,
-15365,
-14941,
-14891,
-14834,
-14706,
-14678,
-14201,
-13941,
-13354,
-13072,
-12771,
-12835,
-12956,
-13361,
-13699,
-13941,
-14199,
-14101,
-14304,
-14391,
-14992,
-15578,
-16340,
-16870,
-17215,
-17131,
-17110,
-16841,
-17110,
-17316,
-17956,
-18451,
-18879,
-18954,
-18852,
-18612,
-18428,
-18507,
-18692,
-19008,
-19301,
-19297,
-19169,
-18638,
-18032,
-17345,
-16660,
-16207,
-15816,
-15784,
-15553,
-15388,
-14944,
-14412,
-13861,
-13489,
-13279,
-13408,
-13597,
-13938,
-14230,
-14439,
-14705,
-15363,
-16081,
-17447,
-18932,
-20829,
-22971,
-25321,
-27748,
-30207,
-32502,
-34669,
-36438,
-38417,
-40031,
-41718,
-42909,
-43831,
-43911,
-43595,
-42695,
-41721,
-40688,
-39767,
-38786,
-38051,
-37174,
-36679,
-36250,
-36282,
-36357,
-36729,
-36992,
-37310,
-37705,
-38154,
-38815,
-39448,
-40268,
-41031,
-42169,
-43357,
-44756,
-45997,
-47054,
-47846,
-48584,
-49380,
-50537,
-52125,
-53999,
-55873,
-57564,
-58515,
-59095,
-58964,
-58699,
-57986,
-57564,
-56983,
-56825,
-56560,
-56640,
-56269,
-56059,
-55293,
-54685,
-54026,
-53628,
-53339,
-53261,
-53151,
-53157,
-53361,
-53686,
-54260,
-54794,
-55263,
-55665,
-55793,
-55955,
-56057,
-56429,
-56930,
-57747,
-58729,
-59700,
-60656,
-61339,
-61604,
-61631,
-61392,
-60919,
-60416,
-59781,
-59176,
-58487,
-57908,
-57325,
-56799,
-56535,
-55977,
-55824,
-55237,
-54608,
-53867,
-52888,
-52074,
-51540,
-51150,
-51064,
-51017,
-50751,
-50142,
-49168,
-47950,
-46658,
-45469,
-44439,
-43727,
-43251,
-42749,
-42432,
-41957,
-41508,
-40928,
-40345,
-39792,
-39422,
-38999,
-38788,
-38367,
-38046,
-37708,
-37572,
-37573,
-37785,
-37944,
-38073,
-37999,
-37648,
-37181,
-36646,
-36178,
-35799,
-35464,
-35010,
-34511,
-33744,
-32900,
-31893,
-30870,
-29885,
-28914,
-28171,
-27592,
-26956,
-26696,
-26136,
-25930,
-25503,
-25426,
-25454,
-25688,
-26140,
-26297,
-26613,
-26352,
-26375,
-26060,
-26298,
-26455,
-27036,
-27408,
-27853,
-28017,
-27931,
-27621,
-27165,
-26697,
-26348,
-26165,
-26167,
-26189,
-25930,
-25399,
-24395,
-23314,
-22125,
-21384,
-20992,
-21041,
-21253,
-21413,
-21411,
-21121,
-20886,
-20776,
-20964,
-21490,
-22337,
-23181,
-24185,
-24819,
-25449,
-25642,
-25949,
-26196,
-26584,
-27145,
-27774,
-28306,
-28779,
-28990,
-29336,
-29438,
-29863,
-30074,
-30442,
-30550,
-30628,
-30627,
-30524,
-30653,
-30576,
-30866,
-30866,
-31023,
-31158,
-31181,
-31368,
-31502,
-31839,
-32323,
-32789,
-33589,
-34112,
-35013,
-35618,
-36333,
-37045,
-37520,
-38155,
-38575,
-38922,
-39288,
-39371,
-39604,
-39583,
-39736,
-39768,
-39815,
-39821,
-39603,
-39478,
-39024,
-38710,
-38312,
-37890,
-37732,
-37495,
-37387,
-37337,
-36938,
-36809,
-36225,
-35991,
-35537,
-35490,
-35433,
-35724,
-35912,
-36303,
-36519,
-36675,
-36912,
-36968,
-37307,
-37417,
-37756,
-37945,
-38074,
-38207,
-38155,
-38180,
-37969,
-37971,
-37625,
-37416,
-36965,
-36385,
-35830,
-35145,
-34536,
-34008,
-33507,
-33163,
-32635,
-32292,
-31684,
-31289,
-30760,
-30548,
-30260,
-30310,
-30207,
-30283,
-30313,
-30309,
-30552,
-30731,
-31000,
-31287,
-31605,
-31844,
-32105,
-32268,
-32422,
-32689,
-32898,
-33191,
-33584,
-33931,
-34033,
-34248,
-33874,
-33826,
-33451,
-33166,
-33055,
-32928,
-32844,
-32743,
-32448,
-32216,
-31759,
-31556,
-31154,
-30920,
-30707,
-30444,
-30336,
-30286,
-30074,
-29992,
-29681,
-29357,
-29178,
-28752,
-28834,
-28566,
-28756,
-28592,
-28675,
-28463,
-28489,
-28462,
-28544,
-28776,
-28942,
-29251,
-29390,
-29465,
-29334,
-29177,
-28857,
-28463,
-28121,
-27668,
-27303,
-27009,
-26430,
-26085,
-25374,
-24791,
-24053,
-23419,
-22732,
-22152,
-21437,
-20991,
-20459,
-20199,
-19826,
-19697,
-19350,
-19144,
-18634,
-18381,
-17920,
-17773,
-17605,
-17797,
-17871,
-18244,
-18428,
-18744,
-18878,
-18954,
-19036,
-19115,
-19246,
-19537,
-19722,
-20117,
-20251,
-20435,
-20460,
-20251,
-20118,
-19721,
-19565,
-19139,
-18956,
-18561,
-18374,
-18138,
-17926,
-17846,
-17662,
-17584,
-17502,
-17267,
-17318,
-17081,
-17213,
-17213,
-17584,
-17871,
-18325,
-18662,
-18960,
-19164,
-19380,
-19537,
-20012,
-20382,
-20937,
-21516,
-22074,
-22440,
-22708,
-22650,
-22710,
-22490,
-22419,
-22361,
-22204,
-22179,
-21858,
-21573,
-21226,
-20830,
-20595,
-20327,
-20013,
-19882,
-19402,
-19195,
-18719,
-18321,
-17848,
-17398,
-17105,
-16663,
-16363,
-15977,
-15466,
-15024,
-14412,
-14019,
-13516,
-13093,
-12725,
-12114,
-11749,
-11164,
-10877,
-10505,
-10505,
-10453,
-10822,
-11324,
-11986,
-13118,
-14283,
-15708,
-17396,
-19091,
-21040,
-23103,
-25003,
-26931,
-28331,
-29441,
-30070,
-30447,
-30493,
-30339,
-29969,
-29438,
-28965,
-28621,
-28304,
-28225,
-27988,
-27882,
-27854,
-27989,
-28461,
-29176,
-29890,
-30785,
-31527,
-32423,
-33375,
-34272,
-35197,
-36093,
-36784,
-37649,
-38685,
-39843,
-41377,
-42855,
-44649,
-46396,
-48476,
-50570,
-52701,
-54794,
-56427,
-58066,
-59095,
-60389,
-61235,
-62292,
-63134,
-63824,
-64455,
-64773,
-65091,
-65221,
-65145,
-64823,
-64380,
-63951,
-63588,
-63610,
-63533,
-63583,
-63375,
-62951,
-62713,
-62317,
-62240,
-62181,
-62269,
-62473,
-62924,
-63615,
-64503,
-65255,
-65529,
-65534,
-65531,
-65534,
-65532,
-65534,
-65531,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65512,
-64483,
-63585,
-62475,
-61499,
-60231,
-58858,
-57485,
-55926,
-54739,
-53416,
-52417,
-51568,
-50461,
-49800,
-48504,
-47585,
-46100,
-44943,
-43568,
-42562,
-41776,
-41134,
-40692,
-40266,
-39607,
-39079,
-38206,
-37654,
-36859,
-36439,
-35908,
-35515,
-35144,
-34640,
-34171,
-33581,
-33087,
-32608,
-32105,
-31609,
-31153,
-30524,
-29889,
-29068,
-28149,
-27298,
-26299,
-25425,
-24554,
-23816,
-23128,
-22441,
-21862,
-21120,
-20568,
-19827,
-19325,
-18878,
-18690,
-18694,
-18822,
-18905,
-19165,
-19222,
-19377,
-19564,
-19776,
-20062,
-20412,
-20721,
-20967,
-21040,
-21202,
-21094,
-21439,
-21622,
-22126,
-22415,
-22785,
-22706,
-22627,
-22335,
-21942,
-21858,
-21731,
-21912,
-22073,
-22072,
-22204,
-22045,
-22099,
-22098,
-22336,
-22574,
-23155,
-23366,
-23947,
-24105,
-24633,
-25085,
-25819,
-26591,
-27562,
-28332,
-29149,
-29599,
-30204,
-30471,
-31155,
-31527,
-32292,
-32740,
-33296,
-33770,
-34166,
-34644,
-34957,
-35278,
-35617,
-35727,
-36092,
-36150,
-36514,
-36678,
-37202,
-37469,
-38021,
-38234,
-38550,
-38657,
-38892,
-39107,
-39579,
-39897,
-40506,
-40819,
-41035,
-41270,
-41454,
-41774,
-42483,
-43016,
-43750,
-44336,
-44595,
-44785,
-44756,
-44807,
-44786,
-45069,
-45129,
-45468,
-45390,
-45443,
-45020,
-44756,
-44176,
-43858,
-43568,
-43382,
-43173,
-42854,
-42539,
-41982,
-41641,
-41270,
-40901,
-40848,
-40292,
-40005,
-39420,
-38868,
-38524,
-38128,
-38048,
-37997,
-37837,
-37758,
-37442,
-37334,
-37153,
-37202,
-37153,
-37412,
-37232,
-37282,
-36833,
-36309,
-35694,
-35043,
-34479,
-34143,
-33716,
-33430,
-32712,
-31977,
-30969,
-29995,
-29150,
-28515,
-28014,
-27697,
-27141,
-26853,
-26139,
-25794,
-25217,
-24947,
-24743,
-24657,
-24609,
-24791,
-24952,
-25160,
-25506,
-25795,
-26271,
-26800,
-27247,
-27592,
-27960,
-27803,
-28092,
-27857,
-28144,
-28095,
-28301,
-28176,
-27957,
-27622,
-27217,
-26749,
-26481,
-26325,
-26296,
-26324,
-26271,
-26270,
-26194,
-25925,
-25824,
-25398,
-25374,
-25109,
-25267,
-25109,
-25399,
-25163,
-25345,
-25164,
-25343,
-25298,
-25633,
-25746,
-26109,
-26459,
-26744,
-27170,
-27458,
-27882,
-28147,
-28566,
-28597,
-28856,
-28783,
-28936,
-28885,
-28887,
-28934,
-28891,
-28801,
-28757,
-28539,
-28253,
-28119,
-27697,
-27406,
-27037,
-26746,
-26430,
-26006,
-25637,
-25162,
-24766,
-24395,
-24081,
-23943,
-23767,
-23653,
-23420,
-23314,
-23126,
-23104,
-23075,
-23154,
-23130,
-23074,
-23077,
-22941,
-22894,
-22755,
-22736,
-22492,
-22443,
-22283,
-22124,
-22126,
-21860,
-21755,
-21439,
-21174,
-20671,
-20464,
-19929,
-19620,
-18901,
-18428,
-17690,
-17026,
-16475,
-15734,
-15417,
-14653,
-14464,
-13836,
-13698,
-13413,
-13144,
-13016,
-12722,
-12779,
-12510,
-12620,
-12406,
-12512,
-12355,
-12327,
-12169,
-12223,
-12089,
-12090,
-12170,
-12089,
-12434,
-12513,
-12828,
-13148,
-13277,
-13649,
-13647,
-13781,
-13674,
-13595,
-13438,
-13250,
-13095,
-12802,
-12540,
-12115,
-11696,
-11269,
-11008,
-10692,
-10583,
-10454,
-10372,
-10321,
-10085,
-9870,
-9503,
-9211,
-8788,
-8502,
-8310,
-8000,
-7993,
-7737,
-7861,
-7974,
-8364,
-9265,
-10479,
-12196,
-14123,
-16369,
-18506,
-20752,
-22547,
-24264,
-25585,
-26798,
-27883,
-28779,
-29703,
-30207,
-30706,
-30576,
-30470,
-30073,
-29889,
-29677,
-29888,
-30207,
-30839,
-31579,
-32450,
-33294,
-34036,
-34616,
-35248,
-35568,
-36384,
-36833,
-37734,
-38362,
-39162,
-39973,
-40930,
-42086,
-43200,
-44623,
-45892,
-47531,
-49083,
-51072,
-52648,
-54529,
-55874,
-57087,
-58120,
-58884,
-59782,
-60468,
-61342,
-61971,
-62663,
-63136,
-63662,
-63693,
-63873,
-63559,
-63480,
-63320,
-63321,
-63532,
-63610,
-63614,
-63450,
-63006,
-62844,
-62555,
-62662,
-62791,
-63216,
-63611,
-64403,
-65277,
-65532,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-64877,
-63955,
-63111,
-62024,
-61159,
-60148,
-59362,
-58566,
-57749,
-57089,
-56402,
-55793,
-55294,
-54870,
-54447,
-53975,
-53572,
-52947,
-52622,
-51968,
-51726,
-51175,
-50723,
-50038,
-49299,
-48531,
-47821,
-47079,
-46394,
-45760,
-45151,
-44810,
-44385,
-44284,
-43987,
-43729,
-43407,
-42961,
-42567,
-42111,
-41486,
-40871,
-40083,
-39317,
-38496,
-37601,
-36728,
-35803,
-34881,
-34061,
-33401,
-32819,
-32478,
-31921,
-31501,
-30759,
-30207,
-29464,
-29020,
-28328,
-28068,
-27406,
-26985,
-26269,
-25665,
-25082,
-24553,
-24161,
-23733,
-23606,
-23232,
-23288,
-23075,
-22970,
-22811,
-22548,
-22415,
-22020,
-21728,
-21359,
-20831,
-20461,
-19908,
-19614,
-19222,
-19007,
-18772,
-18640,
-18347,
-18165,
-18004,
-17768,
-17821,
-17635,
-17557,
-17450,
-17346,
-17291,
-17346,
-17345,
-17635,
-17874,
-18137,
-18665,
-19089,
-19694,
-20489,
-20962,
-21809,
-22229,
-22787,
-23152,
-23448,
-23655,
-23842,
-23921,
-24051,
-23896,
-23919,
-23526,
-23523,
-23342,
-23547,
-23872,
-24446,
-25004,
-25559,
-26111,
-26403,
-26932,
-27458,
-28147,
-28912,
-29781,
-30498,
-31155,
-31712,
-32239,
-32792,
-33324,
-34138,
-34724,
-35616,
-36204,
-36883,
-37286,
-37650,
-37865,
-38076,
-38259,
-38498,
-38496,
-38737,
-38603,
-38761,
-38763,
-38865,
-39080,
-39263,
-39634,
-39949,
-40373,
-40715,
-41192,
-41640,
-42010,
-42405,
-42723,
-43094,
-43276,
-43647,
-43674,
-44016,
-43966,
-44252,
-44283,
-44675,
-44889,
-45179,
-45258,
-45389,
-45206,
-45258,
-44966,
-44917,
-44622,
-44149,
-43834,
-42931,
-42462,
-41611,
-40981,
-40557,
-40030,
-39923,
-39528,
-39395,
-38840,
-38658,
-38126,
-37945,
-37730,
-37495,
-37467,
-37231,
-36991,
-36597,
-36148,
-35724,
-35382,
-35222,
-34986,
-34959,
-34854,
-34694,
-34748,
-34669,
-34721,
-34800,
-34880,
-34800,
-34854,
-34538,
-34402,
-34009,
-33744,
-33374,
-33165,
-32845,
-32661,
-32347,
-32131,
-31897,
-31842,
-31737,
-31817,
-31790,
-31764,
-31763,
-31580,
-31603,
-31316,
-31420,
-31050,
-31132,
-30837,
-30894,
-30758,
-30789,
-30599,
-30657,
-30521,
-30418,
-30627,
-30549,
-30841,
-30864,
-30867,
-30865,
-30707,
-30657,
-30467,
-30366,
-30151,
-30022,
-29861,
-29759,
-29595,
-29708,
-29515,
-29654,
-29728,
-29759,
-29992,
-29891,
-30019,
-29811,
-29570,
-29310,
-29093,
-28864,
-28696,
-28439,
-28091,
-27645,
-27195,
-26668,
-26402,
-26113,
-25900,
-25717,
-25505,
-25293,
-25058,
-24816,
-24557,
-24314,
-24107,
-23920,
-23657,
-23630,
-23393,
-23180,
-23024,
-22572,
-22575,
-22258,
-22254,
-22049,
-21857,
-21442,
-21119,
-20462,
-20091,
-19431,
-18983,
-18480,
-17848,
-17291,
-16500,
-16052,
-15204,
-14787,
-14200,
-13517,
-13146,
-12274,
-11986,
-11217,
-10929,
-10373,
-10083,
-9581,
-9265,
-8708,
-8343,
-7783,
-7524,
-7044,
-7099,
-6704,
-6808,
-6492,
-6491,
-6307,
-6148,
-6202,
-6041,
-6230,
-6251,
-6363,
-6357,
-6255,
-6175,
-5936,
-5938,
-5699,
-5699,
-5463,
-5222,
-4988,
-4484,
-4299,
-3958,
-3770,
-3668,
-3584,
-3589,
-3479,
-3616,
-3347,
-3482,
-3189,
-3219,
-3084,
-3244,
-3217,
-3718,
-3931,
-4695,
-5330,
-6281,
-7415,
-8843,
-10239,
-11987,
-13700,
-15391,
-17134,
-18691,
-19908,
-21147,
-21808,
-22733,
-23286,
-24026,
-24555,
-25002,
-25322,
-25556,
-25956,
-26374,
-27066,
-27852,
-28808,
-29967,
-31131,
-32423,
-33639,
-34615,
-35540,
-36254,
-37150,
-37838,
-39026,
-39896,
-40982,
-42140,
-43200,
-44596,
-46025,
-47423,
-49034,
-50593,
-52228,
-53921,
-55636,
-57405,
-58805,
-60364,
-61365,
-62583,
-63531,
-64536,
-65534,
-65534,
-65534,
-65532,
-65534,
-65532,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65531,
-65534,
-65532,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-64933,
-63506,
-62025,
-60683,
-59224,
-57989,
-56611,
-55427,
-54209,
-53181,
-52176,
-51227,
-50327,
-49458,
-48637,
-47820,
-46949,
-46127,
-44996,
-44016,
-42748,
-41696,
-40500,
-39585,
-38651,
-37975,
-37172,
-36732,
-36092,
-35805,
-35223,
-34722,
-34139,
-33560,
-33031,
-32477,
-31710,
-31026,
-29886,
-28994,
-27747,
-26854,
-25714,
-25032,
-24130,
-23712,
-23205,
-22759,
-22417,
-21938,
-21519,
-21095,
-20723,
-20596,
-20354,
-20251,
-20064,
-19697,
-19587,
-19144,
-19112,
-19090,
-19113,
-19485,
-19536,
-19934,
-20143,
-20516,
-20960,
-21362,
-21806,
-22205,
-22415,
-22627,
-22679,
-22837,
-22945,
-23207,
-23341,
-23787,
-23895,
-24315,
-24451,
-24870,
-25216,
-25635,
-26168,
-26610,
-26963,
-27269,
-27332,
-27561,
-27752,
-28092,
-28542,
-29097,
-29624,
-30100,
-30629,
-30970,
-31526,
-32161,
-32871,
-33667,
-34455,
-35013,
-35646,
-35881,
-36230,
-36276,
-36493,
-36595,
-36622,
-36730,
-36569,
-36676,
-36516,
-36675,
-36730,
-37149,
-37364,
-37756,
-37866,
-37993,
-38184,
-38178,
-38526,
-38497,
-38999,
-38814,
-39159,
-38839,
-39055,
-38812,
-39053,
-38973,
-39183,
-39054,
-39050,
-38684,
-38523,
-37997,
-37784,
-37335,
-37098,
-36755,
-36465,
-35988,
-35672,
-35065,
-34852,
-34592,
-34612,
-34751,
-34983,
-35145,
-35434,
-35487,
-35619,
-35672,
-35619,
-35672,
-35752,
-35618,
-35805,
-35671,
-35673,
-35513,
-35329,
-35117,
-35065,
-34801,
-35143,
-35012,
-35434,
-35329,
-35409,
-35221,
-34934,
-34853,
-34510,
-34511,
-34323,
-34248,
-34087,
-33796,
-33667,
-33398,
-33430,
-33214,
-33350,
-33188,
-33349,
-33163,
-33269,
-33057,
-33138,
-33003,
-33008,
-32922,
-33007,
-32925,
-33083,
-32954,
-33109,
-33110,
-33244,
-33321,
-33401,
-33375,
-33505,
-33481,
-33639,
-33558,
-33667,
-33399,
-33349,
-32978,
-32661,
-32266,
-31896,
-31578,
-31236,
-31130,
-30813,
-30548,
-30208,
-29779,
-29339,
-29013,
-28466,
-28223,
-27909,
-27459,
-27274,
-26667,
-26535,
-26034,
-25900,
-25585,
-25425,
-25215,
-24977,
-24766,
-24422,
-24369,
-23974,
-23893,
-23526,
-23286,
-23102,
-22812,
-22546,
-22126,
-21675,
-21282,
-20801,
-20492,
-20060,
-19779,
-19429,
-19248,
-18980,
-18853,
-18716,
-18456,
-18295,
-18084,
-17874,
-17741,
-17530,
-17583,
-17345,
-17504,
-17371,
-17477,
-17373,
-17370,
-17214,
-17186,
-17082,
-16895,
-16976,
-16737,
-16765,
-16605,
-16528,
-16470,
-16398,
-16392,
-16370,
-16235,
-16209,
-16052,
-16076,
-16212,
-16339,
-16635,
-16815,
-16922,
-17162,
-17133,
-17399,
-17423,
-17610,
-17660,
-17797,
-17818,
-17928,
-18003,
-18113,
-18082,
-18087,
-18083,
-18085,
-17979,
-18031,
-17795,
-17767,
-17451,
-17186,
-16923,
-16632,
-16475,
-16207,
-16159,
-15917,
-15789,
-15523,
-15310,
-14944,
-14649,
-14233,
-13881,
-13547,
-13142,
-12912,
-12563,
-12304,
-12008,
-11748,
-11536,
-11375,
-11221,
-11164,
-11140,
-10981,
-11086,
-10664,
-10691,
-10268,
-9976,
-9609,
-9105,
-8711,
-8127,
-7709,
-7175,
-6864,
-6702,
-6754,
-7127,
-7547,
-8340,
-8923,
-9922,
-10533,
-11403,
-12063,
-12594,
-13222,
-13547,
-14039,
-14498,
-14832,
-15394,
-15759,
-16290,
-16790,
-17266,
-17899,
-18588,
-19218,
-20146,
-20856,
-21862,
-22810,
-23843,
-24870,
-25823,
-26825,
-27644,
-28726,
-29653,
-30732,
-31949,
-33111,
-34694,
-36175,
-37941,
-39714,
-41639,
-43490,
-45547,
-47212,
-49088,
-50460,
-52045,
-53391,
-54791,
-56350,
-57827,
-59414,
-60889,
-62372,
-63584,
-64800,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65532,
-65534,
-65530,
-65534,
-65529,
-65534,
-65529,
-65534,
-65532,
-65534,
-65534,
-65534,
-64643,
-63372,
-61976,
-60678,
-59466,
-58145,
-57036,
-55794,
-54634,
-53469,
-52204,
-50962,
-49667,
-48138,
-46762,
-45126,
-43701,
-42219,
-40744,
-39447,
-37996,
-36756,
-35353,
-34196,
-32843,
-31661,
-30494,
-29335,
-28173,
-26982,
-25797,
-24580,
-23340,
-22310,
-21094,
-20330,
-19404,
-18799,
-18003,
-17426,
-16738,
-16102,
-15605,
-15019,
-14678,
-14363,
-13989,
-13755,
-13516,
-13251,
-13121,
-13014,
-12908,
-12989,
-12881,
-12936,
-12987,
-12936,
-13172,
-13199,
-13543,
-13726,
-13966,
-14096,
-14150,
-14018,
-14123,
-14018,
-14255,
-14361,
-14599,
-14863,
-15074,
-15391,
-15813,
-16236,
-16844,
-17423,
-18192,
-18769,
-19486,
-20090,
-20648,
-21436,
-21968,
-22757,
-23474,
-24156,
-24927,
-25475,
-26194,
-26745,
-27380,
-27962,
-28647,
-29150,
-29913,
-30366,
-31050,
-31499,
-31978,
-32471,
-32800,
-33289,
-33460,
-33738,
-33908,
-34137,
-34353,
-34537,
-34877,
-35042,
-35457,
-35543,
-35907,
-35965,
-36383,
-36439,
-36966,
-37255,
-37655,
-38152,
-38500,
-39024,
-39397,
-40001,
-40480,
-41164,
-41666,
-42302,
-42800,
-43253,
-43645,
-43991,
-44176,
-44386,
-44307,
-44334,
-44096,
-44015,
-43835,
-43777,
-43516,
-43488,
-43225,
-43277,
-43224,
-43280,
-43537,
-43546,
-43934,
-43913,
-44096,
-44121,
-44177,
-44148,
-44334,
-44228,
-44333,
-44255,
-44202,
-44228,
-44227,
-44494,
-44595,
-44838,
-44939,
-45075,
-45177,
-45127,
-45257,
-45074,
-45231,
-44968,
-44966,
-44679,
-44464,
-44229,
-44017,
-43830,
-43597,
-43618,
-43333,
-43407,
-43067,
-43013,
-42670,
-42434,
-42059,
-41882,
-41530,
-41433,
-41057,
-40874,
-40638,
-40291,
-40217,
-40000,
-40057,
-40082,
-40081,
-40137,
-39974,
-39846,
-39553,
-39211,
-38946,
-38419,
-37995,
-37258,
-36726,
-35885,
-35301,
-34616,
-34114,
-33455,
-33107,
-32508,
-32128,
-31794,
-31445,
-31183,
-30972,
-30653,
-30392,
-30019,
-29627,
-29121,
-28780,
-28120,
-27775,
-27197,
-26850,
-26510,
-26111,
-25798,
-25291,
-24899,
-24343,
-23894,
-23393,
-22996,
-22494,
-22073,
-21543,
-20964,
-20434,
-19722,
-19352,
-18798,
-18506,
-18138,
-17821,
-17581,
-17294,
-17080,
-16817,
-16633,
-16446,
-16105,
-15893,
-15363,
-15154,
-14600,
-14306,
-13836,
-13407,
-13068,
-12700,
-12535,
-12463,
-12458,
-12486,
-12514,
-12511,
-12460,
-12408,
-12326,
-12250,
-12115,
-11985,
-11720,
-11642,
-11322,
-11063,
-10767,
-10401,
-10136,
-9765,
-9662,
-9422,
-9476,
-9475,
-9582,
-9553,
-9691,
-9497,
-9612,
-9341,
-9344,
-9054,
-8920,
-8789,
-8473,
-8603,
-8394,
-8446,
-8471,
-8420,
-8524,
-8447,
-8657,
-8524,
-8844,
-8759,
-9005,
-8995,
-9057,
-9078,
-9080,
-9079,
-8974,
-9026,
-8816,
-8816,
-8550,
-8289,
-7995,
-7708,
-7388,
-7180,
-6886,
-6836,
-6411,
-6414,
-5883,
-5990,
-5727,
-5961,
-6310,
-6831,
-7735,
-8684,
-9764,
-10826,
-11926,
-12756,
-13723,
-14390,
-15152,
-15575,
-16238,
-16208,
-16686,
-16578,
-16792,
-16815,
-16977,
-17108,
-17263,
-17481,
-17553,
-18166,
-18347,
-19274,
-19668,
-20620,
-21148,
-22097,
-22629,
-23575,
-24133,
-25030,
-25873,
-26827,
-27907,
-29098,
-30389,
-31818,
-33293,
-34881,
-36465,
-38179,
-39688,
-41109,
-42540,
-43488,
-44889,
-45706,
-47027,
-48005,
-49140,
-50195,
-51202,
-52200,
-53077,
-54077,
-54818,
-55689,
-56481,
-57140,
-57989,
-58591,
-59442,
-59859,
-60548,
-61131,
-61680,
-62401,
-62894,
-63641,
-64163,
-65118,
-65534,
-65532,
-65534,
-65530,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-65533,
-65534,
-65531,
-65534,
-65531,
-65534,
-65534,
-65380,
-65091,
-64667,
-64324,
-63876,
-63478,
-62952,
-62476,
-61921,
-61287,
-60759,
-59968,
-59437,
-58544,
-57904,
-56906,
-56163,
-55055,
-54290,
-53233,
-52467,
-51595,
-50884,
-50036,
-49458,
-48532,
-48030,
-47214,
-46577,
-45892,
-44940,
-44177,
-43196,
-42435,
-41638,
-40928,
-40240,
-39554,
-38815,
-38075,
-37388,
-36544,
-35935,
-35093,
-34428,
-33615,
-33003,
-32267,
-31709,
-31157,
-30707,
-30206,
-29810,
-29439,
-28991,
-28833,
-28304,
-28065,
-27620,
-27325,
-26933,
-26640,
-26323,
-26113,
-25689,
-25454,
-24711,
-24319,
-23548,
-23158,
-22439,
-22179,
-21677,
-21409,
-21045,
-20697,
-20382,
-20093,
-19932,
-19510,
-19485,
-19060,
-19117,
-18795,
-18958,
-18927,
-19171,
-19454,
-19618,
-20064,
-20277,
-20620,
-20857,
-21121,
-21280,
-21570,
-21729,
-22019,
-22205,
-22335,
-22443,
-22361,
-22364,
-22256,
-22152,
-22178,
-22097,
-22153,
-22096,
-22049,
-22122,
-22206,
-22546,
-22786,
-23418,
-23710,
-24396,
-24580,
-25189,
-25531,
-26271,
-26932,
-27696,
-28700,
-29282,
-30337,
-30947,
-31735,
-32452,
-33214,
-33878,
-34615,
-35223,
-35805,
-36357,
-36756,
-37177,
-37492,
-37947,
-38283,
-38631,
-39026,
-39261,
-39558,
-39788,
-40058,
-40450,
-40848,
-41298,
-41850,
-42328,
-42748,
-43226,
-43592,
-43993,
-44543,
-44862,
-45471,
-45968,
-46475,
-46921,
-47423,
-47794,
-48319,
-48694,
-49242,
-49620,
-50085,
-50227,
-50431,
-50462,
-50538,
-50647,
-50669,
-50753,
-50775,
-50779,
-50591,
-50540,
-50275,
-50038,
-49879,
-49405,
-49322,
-48852,
-48636,
-48270,
-47899,
-47501,
-47161,
-46814,
-46581,
-46285,
-46027,
-45731,
-45417,
-45101,
-44912,
-44679,
-44359,
-44282,
-43725,
-43595,
-43040,
-42590,
-42195,
-41641,
-41241,
-40747,
-40130,
-39822,
-39154,
-38791,
-38179,
-37759,
-37071,
-36624,
-35749,
-35067,
-34296,
-33245,
-32528,
-31501,
-30759,
-29836,
-29044,
-28092,
-27329,
-26401,
-25796,
-25005,
-24472,
-24003,
-23443,
-23103,
-22494,
-22232,
-21674,
-21413,
-20990,
-20723,
-20280,
-20008,
-19408,
-19086,
-18587,
-18244,
-17950,
-17717,
-17397,
-17266,
-16818,
-16524,
-16027,
-15627,
-15314,
-14940,
-14758,
-14387,
-14044,
-13675,
-13120,
-12855,
-12513,
-12381,
-12273,
-12119,
-12008,
-11855,
-11691,
-11565,
-11506,
-11379,
-11376,
-11271,
-11062,
-10847,
-10401,
-9977,
-9686,
-9107,
-9079,
-8657,
-8552,
-8207,
-8050,
-7680,
-7574,
-7390,
-7415,
-7602,
-7547,
-7890,
-7788,
-7941,
-7895,
-7861,
-7920,
-7915,
-7921,
-7650,
-7630,
-7123,
-7100,
-6836,
-6621,
-6758,
-6516,
-6678,
-6597,
-6518,
-6570,
-6571,
-6623,
-6810,
-6939,
-7127,
-7309,
-7362,
-7472,
-7437,
-7554,
-7490,
-7472,
-7467,
-7390,
-7284,
-7309,
-7154,
-7228,
-7235,
-7095,
-7260,
-6939,
-7073,
-6862,
-7044,
-7260,
-7545,
-8185,
-8892,
-9688,
-10768,
-11802,
-12932,
-14259,
-15071,
-16396,
-16948,
-18007,
-18266,
-19013,
-19084,
-19407,
-19511,
-19429,
-19593,
-19401,
-19434,
-19324,
-19485,
-19564,
-20143,
-20620,
-21359,
-22230,
-22919,
-23787,
-24555,
-25372,
-26324,
-27117,
-28092,
-28807,
-29809,
-30627,
-31792,
-32845,
-34141,
-35329,
-36516,
-37733,
-38708,
-39924,
-40768,
-41720,
-42643,
-43463,
-44439,
-45310,
-46263,
-47026,
-47952,
-48585,
-49535,
-50252,
-51118,
-51861,
-52651,
-53286,
-54105,
-54765,
-55503,
-56113,
-56769,
-57224,
-57693,
-58173,
-58567,
-59174,
-59651,
-60310,
-60891,
-61763,
-62396,
-63321,
-64086,
-64880,
-65458,
-65534,
-65533,
-65534,
-65534,
-65534,
-65534,
-65531,
-65534,
-65534,
-65532,
-65534,
-65531,
-65534,
-65534,
-65534,
-65534,
-65534,
-65533,
-65534,
-64982,
-64697,
-64110,
-63983,
-63425,
-63321,
-62899,
-62554,
-62317,
-61949,
-61787,
-61501,
-61285,
-60893,
-60521,
-59914,
-59281,
-58566,
-57804,
-57007,
-56113,
-55371,
-54474,
-53709,
-53128,
-52307,
-51993,
-51357,
-50963,
-50538,
-49988,
-49558,
-48907,
-48396,
-47770,
-47210,
-46553,
-45866,
-45125,
-44387,
-43409,
-42854,
-41774,
-41269,
-40322,
-39630,
-38949,
-38204,
-37710,
-37041,
-36520,
-35828,
-35383,
-34667,
-34276,
-33659,
-33223,
-32734,
-32218,
-31839,
-31371,
-31233,
-30893,
-30840,
-30574,
-30418,
-30100,
-29862,
-29466,
-29282,
-28937,
-28727,
-28385,
-28249,
-27805,
-27800,
-27409,
-27377,
-27198,
-27087,
-26986,
-26903,
-26854,
-26822,
-26776,
-26717,
-26617,
-26559,
-26563,
-26613,
-26721,
-26797,
-26854,
-26902,
-26987,
-27140,
-27461,
-27853,
-28359,
-28857,
-29310,
-29728,
-29943,
-30311,
-30442,
-30763,
-30915,
-31001,
-31021,
-30948,
-30838,
-30707,
-30788,
-30547,
-30920,
-30839,
-31182,
-31210,
-31499,
-31473,
-31818,
-31920,
-32267,
-32555,
-32925,
-33244,
-33532,
-33824,
-34060,
-34353,
-34587,
-35120,
-35380,
-36121,
-36491,
-37124,
-37467,
-37919,
-38177,
-38607,
-38626,
-39029,
-38891,
-38975,
-38734,
-38551,
-38312,
-38129,
-38047,
-38077,
-38179,
-38393,
-38524,
-38840,
-39000,
-39237,
-39579,
-39689,
-40104,
-40297,
-40529,
-40743,
-40716,
-40740,
-40745,
-40635,
-40770,
-40767,
-40928,
-41112,
-41191,
-41508,
-41482,
-41904,
-41826,
-42273,
-42194,
-42381,
-42219,
-42038,
-41667,
-41295,
-40744,
-40423,
-39952,
-39764,
-39397,
-39209,
-38789,
-38682,
-38234,
-38207,
-37836,
-37840,
-37491,
-37287,
-36962,
-36625,
-36277,
-35912,
-35539,
-35197,
-34853,
-34537,
-34191,
-33959,
-33529,
-33325,
-32951,
-32713,
-32558,
-32210,
-31898,
-31578,
-30891,
-30524,
-29704,
-29174,
-28386,
-27799,
-27172,
-26612,
-26009,
-25528,
-25008,
-24496,
-24058,
-23547,
-23104,
-22679,
-22151,
-21703,
-21094,
-20568,
-19905,
-19407,
-18849,
-18322,
-17768,
-17346,
-16709,
-16424,
-15758,
-15471,
-15154,
-14941,
-14784,
-14678,
-14440,
-14414,
-14071,
-13911,
-13701,
-13490,
-13516,
-13331,
-13490,
-13330,
-13438,
-13515,
-13676,
-13883,
-14232,
-14359,
-14759,
-14756,
-14836,
-14705,
-14572,
-14309,
-14043,
-13861,
-13514,
-13280,
-12881,
-12434,
-12196,
-11772,
-11747,
-11668,
-11878,
-12012,
-12167,
-12303,
-12432,
-12409,
-12722,
-12671,
-12962,
-12828,
-12938,
-12721,
-12699,
-12591,
-12565,
-12619,
-12591,
-12777,
-12882,
-12882,
-13041,
-12882,
-12988,
-12987,
-12910,
-12880,
-12753,
-12510,
-12383,
-12035,
-11774,
-11562,
-11323,
-11195,
-11215,
-10984,
-11269,
-11061,
-11430,
-11508,
-11854,
-12115,
-12276,
-12617,
-12698,
-12883,
-12959,
-12885,
-12907,
-12672,
-12591,
-12354,
-12116,
-11960,
-11770,
-11644,
-11743,
-11778,
-12218,
-12461,
-13015,
-13513,
-14075,
-14859,
-15499,
-16314,
-16923,
-17688,
-18164,
-18851,
-19272,
-19828,
-20329,
-20804,
-21175,
-21701,
-22020,
-22575,
-22968,
-23474,
-23943,
-24559,
-24973,
-25667,
-26110,
-26615,
-27275,
-27537,
-28147,
-28726,
-29282,
-30152,
-30709,
-31708,
-32348,
-33477,
-34274,
-35514,
-36436,
-37550,
-38520,
-39478,
-40529,
-41377,
-42485,
-43276,
-44256,
-45204,
-45999,
-47157,
-47901,
-49111,
-49881,
-50936,
-51753,
-52600,
-53418,
-54262,
-54925,
-55739,
-56221,
-56874,
-57249,
-57853,
-58251,
-58726,
-59202,
-59648,
-60233,
-60810,
-61368,
-61974,
-62343,
-62925,
-63188,
-63796,
-64035,
-64323,
-64669,
-64639,
-64960,
-64930,
-65329,
-65300,
-65534,
-65534,
-65534,
-65534,
-65534,
-65170,
-64958,
-64562,
-64034,
-63611,
-62977,
-62529,
-61868,
-61287,
-60734,
-60177,
-59757,
-59306,
-58989,
-58675,
-58222,
-58015,
-57456,
-57037,
-56613,
-56085,
-55583,
-55109,
-54314,
-53763,
-52836,
-52229,
-51280,
-50645,
-49773,
-49114,
-48321,
-47528,
-46818,
-46021,
-45235,
-44567,
-43888,
-43196,
-42618,
-41958,
-41559,
-40928,
-40610,
-40108,
-39819,
-39447,
-39132,
-38815,
-38549,
-38104,
-37860,
-37366,
-36989,
-36520,
-36066,
-35594,
-35196,
-34617,
-34218,
-33613,
-33110,
-32583,
-32132,
-31713,
-31391,
-31054,
-30943,
-30654,
-30656,
-30627,
-30630,
-30811,
-30815,
-31021,
-31108,
-31258,
-31344,
-31339,
-31369,
-31287,
-31184,
-31209,
-31181,
-31212,
-31311,
-31239,
-31471,
-31448,
-31762,
-31924,
-32290,
-32557,
-32873,
-33108,
-33378,
-33478,
-33692,
-33771,
-34033,
-34090,
-34323,
-34538,
-34667,
-34907,
-35118,
-35300,
-35622,
-35960,
-36254,
-36623,
-36938,
-37100,
-37255,
-37310,
-37467,
-37626,
-37706,
-37969,
-38023,
-38075,
-38259,
-38287,
-38497,
-38869,
-38918,
-39451,
-39498,
-39873,
-39870,
-40134,
-40190,
-40317,
-40454,
-40503,
-40585,
-40583,
-40584,
-40532,
-40476,
-40481,
-40528,
-40639,
-40741,
-40848,
-40901,
-40874,
-40954,
-40874,
-41006,
-41032,
-41115,
-41108,
-41063,
-40950,
-40824,
-40741,
-40690,
-40636,
-40584,
-40399,
-40162,
-39869,
-39635,
-39209,
-39106,
-38762,
-38628,
-38315,
-38231,
-37893,
-37914,
-37655,
-37862,
-37627,
-37942,
-37813,
-37888,
-37866,
-37598,
-37547,
-37152,
-36965,
-36649,
-36333,
-36040,
-35463,
-35089,
-34432,
-34034,
-33718,
-33349,
-33162,
-32821,
-32503,
-32000,
-31739,
-31129,
-30918,
-30524,
-30099,
-29783,
-29176,
-28885,
-28410,
-28146,
-27855,
-27723,
-27486,
-27460,
-27114,
-27039,
-26665,
-26246,
-26032,
-25452,
-25163,
-24660,
-24183,
-23607,
-22939,
-22314,
-21647,
-21280,
-20832,
-20567,
-20221,
-19964,
-19690,
-19489,
-19295,
-19302,
-19192,
-19275,
-18953,
-18985,
-18398,
-18405,
-17791,
-17717,
-17160,
-17026,
-16529,
-16340,
-15947,
-15760,
-15390,
-15339,
-15100,
-15182,
-15097,
-15209,
-15203,
-15209,
-15311,
-15283,
-15527,
-15703,
-15950,
-16102,
-16261,
-16372,
-16494,
-16665,
-16732,
-17007,
-17025,
-17055,
-17056,
-16841,
-16794,
-16444,
-16291,
-15943,
-15685,
-15414,
-15155,
-15047,
-14810,
-14731,
-14810,
-14651,
-15128,
-15073,
-15550,
-15682,
-15917,
-16080,
-16234,
-16290,
-16500,
-16499,
-16528,
-16446,
-16237,
-16076,
-15921,
-15680,
-15497,
-15365,
-15047,
-15101,
-14652,
-14729,
-14442,
-14333,
-14231,
-14015,
-14021,
-13856,
-13836,
-13698,
-13624,
-13567,
-13464,
-13517,
-13541,
-13702,
-13859,
-13938,
-14098,
-14254,
-14310,
-14544,
-14495,
-14702,
-14469,
-14491,
-14125,
-14016,
-13545,
-13487,
-12911,
-12880,
-12382,
-12460,
-12194,
-12329,
-12326,
-12514,
-12803,
-13197,
-13651,
-14173,
-14627,
-15206,
-15654,
-16000,
-16499,
-16790,
-17214,
-17504,
-17740,
-17980,
-18189,
-18455,
-18745,
-19034,
-19512,
-19799,
-20332,
-20590,
-21283,
-21568,
-22126,
-22573,
-22971,
-23471,
-23894,
-24318,
-24922,
-25269,
-25954,
-26375,
-27065,
-27827,
-28517,
-29386,
-30206,
-31024,
-31974,
-32743,
-33715,
-34671,
-35563,
-36467,
-37308,
-38234,
-39052,
-39976,
-40795,
-41720,
-42511,
-43410,
-44148,
-44943,
-45704,
-46290,
-47106,
-47581,
-48270,
-48848,
-49431,
-49984,
-50673,
-51197,
-51890,
-52595,
-53237,
-54075,
-54687,
-55503,
-55980,
-56825,
-57114,
-57829,
-58222,
-58648,
-58964,
-59279,
-59441,
-59753,
-59863,
-60046,
-60335,
-60260,
-60546,
-60391,
-60600,
-60495,
-60495,
-60443,
-60336,
-60231,
-60127,
-60017,
-59891,
-59779,
-59652,
-59518,
-59384,
-59310,
-59092,
-59073,
-58854,
-58703,
-58484,
-58308,
-57955,
-57833,
-57375,
-57144,
-56691,
-56296,
-55822,
-55371,
-54792,
-54262,
-53736,
-53178,
-52549,
-52148,
-51492,
-51146,
-50697,
-50250,
-49879,
-49563,
-49192,
-48928,
-48691,
-48375,
-48135,
-47742,
-47526,
-46951,
-46761,
-46157,
-45707,
-45310,
-44625,
-44280,
-43569,
-43196,
-42621,
-42164,
-41750,
-41240,
-40982,
-40425,
-40188,
-39738,
-39395,
-39105,
-38737,
-38548,
-38209,
-38074,
-37784,
-37681,
-37492,
-37310,
-37178,
-36964,
-36810,
-36568,
-36306,
-36069,
-35855,
-35462,
-35408,
-34958,
-35040,
-34745,
-34750,
-34693,
-34697,
-34825,
-34856,
-35008,
-35095,
-35140,
-35280,
-35140,
-35279,
-35009,
-35119,
-34801,
-34851,
-34645,
-34586,
-34540,
-34506,
-34435,
-34612,
-34672,
-34825,
-35037,
-35147,
-35405,
-35516,
-35829,
-35962,
-36202,
-36436,
-36598,
-36806,
-37046,
-37203,
-37653,
-37811,
-38207,
-38418,
-38684,
-38970,
-39160,
-39315,
-39528,
-39475,
-39659,
-39527,
-39687,
-39553,
-39739,
-39633,
-39792,
-39870,
-40004,
-40186,
-40480,
-40608,
-40983,
-41135,
-41431,
-41719,
-41956,
-42170,
-42325,
-42407,
-42432,
-42486,
-42510,
-42539,
-42459,
-42484,
-42301,
-42327,
-42113,
-42199,
-41926,
-41986,
-41693,
-41612,
-41352,
-41294,
-40903,
-40952,
-40532,
-40478,
-40239,
-40137,
-39974,
-39952,
-39659,
-39553,
-39318,
-39024,
-38841,
-38420,
-38179,
-37654,
-37282,
-36780,
-36308,
-35933,
-35412,
-35061,
-34617,
-34167,
-33795,
-33378,
-33002,
-32610,
-32106,
-31738,
-31156,
-30654,
-30101,
-29439,
-28965,
-28278,
-27722,
-27091,
-26613,
-26219,
-25716,
-25478,
-24925,
-24765,
-24211,
-24080,
-23550,
-23313,
-22760,
-22387,
-21784,
-21410,
-20727,
-20406,
-19777,
-19324,
-18879,
-18399,
-18113,
-17792,
-17426,
-17239,
-16870,
-16710,
-16343,
-16183,
-15786,
-15551,
-15204,
-14839,
-14491,
-14151,
-13832,
-13675,
-13358,
-13251,
-13121,
-13039,
-13122,
-13066,
-13225,
-13279,
-13384,
-13489,
-13570,
-13621,
-13674,
-13702,
-13568,
-13674,
-13596,
-13780,
-13701,
-13966,
-13882,
-14233,
-14226,
-14575,
-14624,
-14889,
-14995,
-15021,
-15101,
-14941,
-14944,
-14808,
-14627,
-14649,
-14496,
-14570,
-14653,
-14810,
-15046,
-15366,
-15840,
-16262,
-16765,
-17291,
-17741,
-18112,
-18428,
-18532,
-18747,
-18689,
-18720,
-18745,
-18532,
-18561,
-18375,
-18294,
-18325,
-18346,
-18430,
-18637,
-18720,
-18823,
-19035,
-19142,
-19218,
-19301,
-19352,
-19351,
-19485,
-19457,
-19643,
-19643,
-19906,
-20012,
-20409,
-20699,
-21147,
-21571,
-21886,
-22285,
-22413,
-22682,
-22703,
-22788,
-22624,
-22575,
-22151,
-22046,
-21491,
-21333,
-21015,
-20832,
-20724,
-20568,
-20698,
-20700,
-20856,
-21201,
-21334,
-21725,
-21997,
-22359,
-22682,
-22995,
-23314,
-23470,
-23817,
-23866,
-24371,
-24448,
-24898,
-24976,
-25295,
-25398,
-25612,
-25822,
-25953,
-26245,
-26218,
-26403,
-26324,
-26456,
-26454,
-26617,
-26691,
-26801,
-27009,
-27090,
-27485,
-27645,
-28040,
-28357,
-28727,
-29202,
-29649,
-30130,
-30730,
-31106,
-31737,
-32185,
-32715,
-33427,
-33955,
-34775,
-35250,
-35987,
-36440,
-37122,
-37681,
-38312,
-38788,
-39343,
-39527,
-39977,
-40081,
-40480,
-40634,
-40850,
-41058,
-41349,
-41617,
-42031,
-42384,
-42852,
-43385,
-43884,
-44598,
-45258,
-45997,
-46631,
-47318,
-47846,
-48454,
-49006,
-49590,
-50011,
-50460,
-50725,
-51093,
-51253,
-51490,
-51702,
-51779,
-51862,
-51911,
-51860,
-51862,
-51724,
-51625,
-51489,
-51279,
-51174,
-51040,
-50910,
-50961,
-50779,
-50880,
-50912,
-51013,
-51253,
-51490,
-51596,
-51859,
-51782,
-51939,
-51964,
-51888,
-51938,
-51570,
-51410,
-50937,
-50669,
-50094,
-49823,
-49169,
-48899,
-48140,
-47895,
-47189,
-46893,
-46368,
-45997,
-45523,
-45230,
-44758,
-44596,
-44150,
-43857,
-43569,
-43119,
-43012,
-42697,
-42486,
-42404,
-42012,
-41928,
-41510,
-41296,
-41061,
-40686,
-40350,
-39920,
-39398,
-38998,
-38524,
-38155,
-37758,
-37389,
-36990,
-36678,
-36462,
-36149,
-36094,
-35646,
-35591,
-35173,
-35167,
-34882,
-34668,
-34563,
-34166,
-34194,
-33902,
-33982,
-34115,
-33980,
-34274,
-34192,
-34536,
-34618,
-34929,
-35121,
-35299,
-35410,
-35433,
-35435,
-35408,
-35355,
-35302,
-35091,
-35065,
-34879,
-34882,
-35008,
-35015,
-35248,
-35355,
-35568,
-35880,
-36203,
-36436,
-36835,
-36965,
-37284,
-37440,
-37760,
-37940,
-38316,
-38469,
-38710,
-38947,
-39129,
-39583,
-39711,
-40135,
-40267,
-40478,
-40584,
-40769,
-40821,
-40926,
-40929,
-40872,
-40850,
-40874,
-40872,
-40983,
-41029,
-41273,
-41376,
-41718,
-41906,
-42324,
-42646,
-42880,
-43305,
-43302,
-43649,
-43671,
-43861,
-43751,
-43807,
-43461,
-43595,
-43118,
-43358,
-42959,
-43041,
-42801,
-42751,
-42667,
-42515,
-42640,
-42356,
-42483,
-42275,
-42247,
-42116,
-42009,
-41905,
-41745,
-41692,
-41432,
-41398,
-41195,
-41136,
-40981,
-40874,
-40610,
-40478,
-40240,
-40057,
-39765,
-39446,
-39029,
-38653,
-38209,
-37758,
-37414,
-36888,
-36568,
-36044,
-35749,
-35251,
-35012,
-34640,
-34355,
-34031,
-33642,
-33372,
-32901,
-32687,
-32265,
-31897,
-31551,
-31052,
-30680,
-30258,
-29863,
-29492,
-29124,
-28726,
-28304,
-27935,
-27591,
-27248,
-27011,
-26534,
-26272,
-25795,
-25530,
-25111,
-24844,
-24449,
-24053,
-23734,
-23262,
-22995,
-22522,
-22362,
-21809,
-21595,
-21097,
-20828,
-20386,
-20325,
-19857,
-19879,
-19430,
-19303,
-19083,
-19040,
-18899,
-18906,
-18717,
-18745,
-18612,
-18614,
-18585,
-18534,
-18560,
-18506,
-18508,
-18455,
-18399,
-18457,
-18320,
-18271,
-18084,
-17978,
-17822,
-17607,
-17480,
-17105,
-17003,
-16605,
-16447,
-16263,
-16183,
-16157,
-16156,
-16343,
-16366,
-16687,
-17001,
-17292,
-17821,
-18058,
-18322,
-18613,
-18640,
-18821,
-18854,
-18794,
-18669,
-18637,
-18243,
-18376,
-17924,
-18115,
-17842,
-17931,
-17921,
-18010,
-18134,
-18218,
-18455,
-18425,
-18457,
-18505,
-18297,
-18481,
-18241,
-18245,
-18136,
-18005,
-18113,
-17976,
-18351,
-18400,
-18877,
-19061,
-19407,
-19744,
-19991,
-20378,
-20463,
-20672,
-20567,
-20593,
-20303,
-20171,
-19905,
-19619,
-19322,
-19039,
-18768,
-18668,
-18611,
-18508,
-18692,
-18585,
-18878,
-18956,
-19298,
-19566,
-19745,
-20067,
-20039,
-20433,
-20437,
-20908,
-20938,
-21227,
-21305,
-21466,
-21622,
-21783,
-21966,
-22177,
-22152,
-22308,
-22260,
-22334,
-22363,
-22363,
-22335,
-22284,
-22310,
-22257,
-22467,
-22522,
-22758,
-22891,
-23235,
-23311,
-23896,
-24025,
-24687,
-24845,
-25504,
-25770,
-26271,
-26798,
-27197,
-27854,
-28199,
-28752,
-29204,
-29703,
-30338,
-30734,
-31313,
-31713,
-32027,
-32449,
-32743,
-33108,
-33350,
-33480,
-33795,
-33853,
-34243,
-34380,
-34747,
-35090,
-35409,
-35909,
-36254,
-36939,
-37362,
-38100,
-38553,
-39182,
-39688,
-40318,
-40875,
-41561,
-42036,
-42696,
-43252,
-43751,
-44441,
-44702,
-45364,
-45601,
-46024,
-46314,
-46631,
-46817,
-46999,
-47002,
-47027,
-46895,
-46896,
-46788,
-46765,
-46629,
-46608,
-46549,
-46658,
-46843,
-47027,
-47344,
-47529,
-47926,
-48108,
-48483,
-48660,
-48853,
-49111,
-49142,
-49297,
-49352,
-49270,
-49380,
-49138,
-49061,
-48850,
-48611,
-48454,
-48163,
-47817,
-47532,
-47025,
-46766,
-46364,
-45999,
-45705,
-45181,
-44940,
-44386,
-44176,
-43698,
-43624,
-43353,
-43175,
-43036,
-42911,
-42826,
-42830,
-42644,
-42615,
-42356,
-42165,
-42065,
-41665,
-41668,
-41164,
-41086,
-40636,
-40399,
-40188,
-39870,
-39714,
-39368,
-39052,
-38788,
-38446,
-38257,
-38000,
-37806,
-37578,
-37279,
-37074,
-36885,
-36703,
-36675,
-36490,
-36439,
-36436,
-36334,
-36595,
-36597,
-36939,
-36914,
-37202,
-37178,
-37522,
-37465,
-37894,
-37753,
-38081,
-37858,
-38081,
-37964,
-38185,
-38045,
-38236,
-38101,
-38154,
-38155,
-38179,
-38341,
-38417,
-38499,
-38708,
-38788,
-39106,
-39315,
-39554,
-39899,
-40027,
-40347,
-40690,
-40899,
-41405,
-41585,
-41878,
-42117,
-42271,
-42515,
-42745,
-42859,
-42957,
-43069,
-43038,
-43145,
-43174,
-43300,
-43335,
-43431,
-43440,
-43459,
-43622,
-43727,
-43936,
-44045,
-44252,
-44363,
-44542,
-44733,
-44833,
-44942,
-44993,
-44995,
-44967,
-44940,
-44916,
-44887,
-44836,
-44730,
-44571,
-44518,
-44335,
-44226,
-44098,
-43805,
-43778,
-43359,
-43248,
-43068,
-42828,
-42616,
-42514,
-42218,
-42171,
-41928,
-41722,
-41585,
-41298,
-41164,
-40823,
-40793,
-40454,
-40265,
-40004,
-39500,
-39264,
-38682,
-38446,
-37783,
-37600,
-36887,
-36516,
-35965,
-35431,
-35015,
-34481,
-34088,
-33587,
-33162,
-32635,
-32215,
-31758,
-31269,
-30912,
-30449,
-30201,
-29707,
-29490,
-28940,
-28673,
-28199,
-27776,
-27459,
-27063,
-26799,
-26404,
-26032,
-25612,
-25318,
-24899,
-24661,
-24209,
-23923,
-23390,
-23129,
-22576,
-22253,
-21838,
-21409,
-21123,
-20673,
-20327,
-19909,
-19588,
-19194,
-18930,
-18691,
-18402,
-18348,
-18033,
-18029,
-17824,
-17737,
-17666,
-17659,
-17611,
-17741,
-17688,
-17688,
-17743,
-17659,
-17718,
-17793,
-17766,
-17903,
-17790,
-17744,
-17608,
-17583,
-17425,
-17396,
-17426,
-17265,
-17424,
-17214,
-17423,
-17162,
-17317,
-17003,
-17160,
-16975,
-17108,
-17081,
-17160,
-17241,
-17343,
-17557,
-17742,
-18110,
-18482,
-18716,
-19143,
-19404,
-19696,
-20248,
-20437,
-20961,
-20939,
-21092,
-21097,
-20989,
-20936,
-20832,
-20565,
-20595,
-20143,
-20278,
-19905,
-20225,
-20011,
-20330,
-20328,
-20569,
-20776,
-21043,
-21149,
-21462,
-21546,
-21780,
-22047,
-22389,
-22652,
-23103,
-23180,
-23472,
-23631,
-23866,
-24055,
-24420,
-24424,
-24659,
-24581,
-24502,
-24607,
-24395,
-24424,
-24156,
-23870,
-23629,
-23392,
-23341,
-23312,
-23471,
-23579,
-23787,
-24133,
-24422,
-24949,
-25217,
-25689,
-25927,
-26298,
-26507,
-26854,
-27010,
-27300,
-27354,
-27617,
-27725,
-28064,
-28333,
-28514,
-28780,
-28833,
-28963,
-29125,
-29279,
-29441,
-29625,
-29492,
-29466,
-29230,
-29306,
-29151,
-29333,
-29229,
-29333,
-29389,
-29570,
-29996,
-30310,
-30998,
-31368,
-31816,
-32293,
-32501,
-32928,
-33108,
-33377,
-33583,
-33905,
-34113,
-34483,
-34644,
-34956,
-35252,
-35460,
-35750,
-36150,
-36382,
-36784,
-36805,
-36941,
-36939,
-36914,
-37097,
-36993,
-37071,
-36992,
-36862,
-36831,
-36837,
-36989,
-37392,
-37623,
-38209,
-38496,
-39001,
-39394,
-39820,
-40290,
-40614,
-40871,
-41220,
-41269,
-41587,
-41589,
-41796,
-41880,
-42088,
-42062,
-42329,
-42191,
-42331,
-42137,
-42146,
-41928,
-42064,
-41930,
-42063,
-41904,
-41825,
-41666,
-41562,
-41560,
-41535,
-41640,
-41613,
-41747,
-41692,
-41904,
-41878,
-42301,
-42326,
-42670,
-42538,
-42696,
-42513,
-42589,
-42487,
-42456,
-42408,
-42299,
-42169,
-42142,
-41957,
-41982,
-41747,
-41639,
-41378,
-41242,
-41009,
-40896,
-40695,
-40526,
-40297,
-40133,
-39897,
-39873,
-39551,
-39371,
-39156,
-38816,
-38867,
-38735,
-38894,
-38892,
-39002,
-38865,
-39054,
-38918,
-39265,
-39209,
-39477,
-39314,
-39186,
-38997,
-38923,
-38811,
-38977,
-38784,
-38818,
-38547,
-38264,
-38150,
-37920,
-38046,
-37760,
-38021,
-37733,
-37995,
-37785,
-37890,
-37890,
-37917,
-37864,
-38128,
-38022,
-38418,
-38367,
-38628,
-38552,
-38760,
-38921,
-39238,
-39473,
-39740,
-39738,
-39764,
-39689,
-39762,
-39927,
-40157,
-40376,
-40450,
-40531,
-40506,
-40766,
-40798,
-41163,
-41191,
-41351,
-41348,
-41430,
-41402,
-41535,
-41533,
-41670,
-41688,
-41804,
-41794,
-41880,
-41930,
-41931,
-42062,
-42142,
-42380,
-42537,
-42829,
-42776,
-42959,
-42778,
-42905,
-42910,
-43065,
-43120,
-43222,
-43149,
-43273,
-42991,
-43274,
-43042,
-43302,
-43174,
-43089,
-43043,
-42748,
-42696,
-42327,
-42169,
-41928,
-41723,
-41505,
-41430,
-41087,
-41003,
-40587,
-40397,
-40135,
-39951,
-39737,
-39636,
-39525,
-39238,
-39210,
-38894,
-38789,
-38523,
-38338,
-38078,
-37913,
-37656,
-37386,
-37098,
-36863,
-36486,
-36232,
-35904,
-35518,
-35353,
-34748,
-34643,
-34059,
-33906,
-33503,
-33193,
-32949,
-32479,
-32184,
-31820,
-31495,
-31186,
-30864,
-30497,
-30153,
-29650,
-29308,
-28991,
-28622,
-28461,
-28227,
-27905,
-27860,
-27507,
-27438,
-27110,
-26963,
-26610,
-26459,
-26348,
-26166,
-26139,
-25769,
-25690,
-25215,
-25055,
-24767,
-24606,
-24423,
-24237,
-24000,
-23683,
-23497,
-23210,
-23098,
-22842,
-22729,
-22522,
-22284,
-22150,
-21995,
-21752,
-21626,
-21462,
-21362,
-21436,
-21361,
-21595,
-21492,
-21676,
-21464,
-21572,
-21594,
-21653,
-21646,
-21706,
-21356,
-21520,
-21119,
-21230,
-21013,
-20991,
-20779,
-20510,
-20229,
-20087,
-19830,
-19880,
-19588,
-19724,
-19509,
-19458,
-19379,
-19378,
-19458,
-19485,
-19640,
-19699,
-19850,
-19857,
-20036,
-19909,
-20117,
-20064,
-20305,
-20327,
-20437,
-20433,
-20251,
-20196,
-19987,
-20012,
-19879,
-19988,
-19851,
-19857,
-19719,
-19590,
-19539,
-19349,
-19488,
-19296,
-19328,
-19244,
-19250,
-19296,
-19381,
-19561,
-19855,
-20039,
-20435,
-20540,
-20963,
-21068,
-21491,
-21519,
-21806,
-21863,
-22044,
-22073,
-22283,
-22257,
-22546,
-22551,
-22833,
-23002,
-23096,
-23265,
-23284,
-23447,
-23603,
-23682,
-23974,
-23947,
-24184,
-24055,
-24208,
-24187,
-24262,
-24450,
-24660,
-25055,
-25533,
-25952,
-26537,
-26797,
-27329,
-27536,
-28149,
-28327,
-28888,
-28990,
-29227,
-29284,
-29412,
-29519,
-29704,
-30073,
-30312,
-30760,
-31078,
-31444,
-31687,
-32026,
-32134,
-32372,
-32448,
-32611,
-32791,
-32822,
-33004,
-33084,
-33164,
-33346,
-33404,
-33714,
-33907,
-34374,
-34592,
-35274,
-35540,
-36254,
-36516,
-36993,
-37124,
-37309,
-37469,
-37650,
-37734,
-38021,
-37997,
-38206,
-38076,
-38153,
-38235,
-38285,
-38605,
-38627,
-38844,
-38865,
-38868,
-38736,
-38813,
-38605,
-38787,
-38709,
-39000,
-39129,
-39320,
-39419,
-39397,
-39395,
-39473,
-39451,
-39605,
-39766,
-39923,
-40029,
-40029,
-40004,
-39949,
-39898,
-39870,
-39765,
-39739,
-39660,
-39579,
-39503,
-39473,
-39396,
-39342,
-39317,
-39078,
-39027,
-38812,
-38686,
-38625,
-38370,
-38283,
-37918,
-37759,
-37440,
-37230,
-36966,
-36887,
-36649,
-36650,
-36435,
-36282,
-36093,
-35858,
-35830,
-35671,
-35832,
-35881,
-36044,
-36094,
-35988,
-36043,
-35801,
-35914,
-35827,
-35859,
-35881,
-35647,
-35619,
-35276,
-35143,
-34854,
-34774,
-34590,
-34694,
-34510,
-34642,
-34538,
-34508,
-34301,
-34323,
-34009,
-34247,
-34218,
-34485,
-34721,
-34853,
-35012,
-35143,
-35198,
-35486,
-35489,
-35960,
-35858,
-36359,
-36173,
-36650,
-36516,
-36941,
-36938,
-37231,
-37362,
-37441,
-37495,
-37440,
-37601,
-37598,
-37893,
-38019,
-38263,
-38442,
-38499,
-38630,
-38787,
-38816,
-39050,
-39053,
-39185,
-39341,
-39450,
-39738,
-40108,
-40452,
-40900,
-41271,
-41483,
-41771,
-41825,
-41983,
-42142,
-42380,
-42670,
-42986,
-43253,
-43434,
-43516,
-43461,
-43622,
-43461,
-43861,
-43644,
-43914,
-43802,
-43677,
-43671,
-43543,
-43541,
-43568,
-43462,
-43436,
-43276,
-43200,
-43040,
-43064,
-43042,
-43090,
-43252,
-43279,
-43407,
-43385,
-43460,
-43384,
-43383,
-43171,
-43200,
-42906,
-42881,
-42645,
-42403,
-42278,
-41901,
-41827,
-41480,
-41272,
-40979,
-40769,
-40557,
-40373,
-40213,
-40085,
-39946,
-39822,
-39629,
-39504,
-39183,
-39105,
-38868,
-38760,
-38764,
-38548,
-38500,
-38151,
-38026,
-37675,
-37604,
-37358,
-37206,
-37071,
-36702,
-36517,
-36120,
-35779,
-35513,
-35065,
-34799,
-34301,
-34033,
-33561,
-33320,
-32953,
-32820,
-32529,
-32399,
-32236,
-32085,
-31891,
-31794,
-31496,
-31556,
-31075,
-31183,
-30629,
-30573,
-30182,
-29966,
-29705,
-29439,
-29150,
-28831,
-28465,
-28091,
-27751,
-27564,
-27169,
-26931,
-26562,
-26085,
-25690,
-25269,
-24895,
-24689,
-24472,
-24241,
-24129,
-23817,
+33009,
+32816,
+31624,
+33574,
+32888,
+32863,
+33174,
+32884,
+33498,
+33336,
+33501,
+33744,
+33619,
+32251,
+31662,
+32668,
+31356,
+31401,
+32369,
+30606,
+29353,
+29625,
+29676,
+29244,
+30492,
+31984,
+32215,
+31164,
+30438,
+31351,
+32602,
+29868,
+27054,
+28770,
+28137,
+28295,
+28325,
+26594,
+27998,
+29061,
+30118,
+29570,
+30475,
+32692,
+31034,
+30856,
+31246,
+31270,
+30640,
+29440,
+29775,
+29648,
+30524,
+31071,
+31369,
+30966,
+29275,
+29222,
+27613,
+26561,
+25075,
+23802,
+22731,
+21757,
+24166,
+24589,
+26520,
+27482,
+27268,
+28938,
+30172,
+32069,
+31150,
+30640,
+30856,
+31126,
+32396,
+32993,
+33330,
+32692,
+34331,
+35575,
+36761,
+39062,
+39505,
+40534,
+40390,
+41369,
+41145,
+38794,
+38431,
+36377,
+35981,
+36265,
+35433,
+36621,
+36263,
+37129,
+38136,
+38582,
+40045,
+38955,
+39014,
+39686,
+40473,
+40754,
+38991,
+39508,
+40072,
+39916,
+40732,
+41470,
+42170,
+41845,
+42483,
+44414,
+45072,
+45213,
+45349,
+44447,
+44227,
+44443,
+44399,
+43320,
+40522,
+40754,
+41838,
+41263,
+40473,
+39988,
+39425,
+37247,
+37483,
+36980,
+34846,
+34069,
+30399,
+28236,
+29625,
+29379,
+27028,
+24602,
+24327,
+24151,
+24058,
+23967,
+20852,
+19477,
+18607,
+15172,
+14577,
+13764,
+11460,
+10056,
+8465,
+9414,
+10094,
+9750,
+8269,
+6895,
+8466,
+6390,
+5887,
+6390,
+4204,
+5273,
+5476,
+5664,
+7947,
+9945,
+9492,
+13002,
+17270,
+15670,
+18383,
+20125,
+21934,
+24952,
+26962,
+30995,
+34253,
+40710,
+41580,
+44526,
+52814,
+55815,
+59449,
+59333,
+61703,
+65534,
+65392,
+65275,
+65287,
+65534,
+65522,
+65524,
+65534,
+65506,
+65534,
+65456,
+65534,
+65341,
+65534,
+64174,
+61163,
+60147,
+56728,
+54220,
+48488,
+42341,
+43284,
+43297,
+39731,
+37549,
+39354,
+38575,
+37251,
+39109,
+37524,
+36895,
+35038,
+31371,
+31150,
+31125,
+30967,
+29167,
+27679,
+28001,
+31348,
+32429,
+29417,
+31969,
+31856,
+29141,
+30082,
+29615,
+27884,
+24147,
+21052,
+17452,
+15875,
+16869,
+13060,
+9229,
+6216,
+6231,
+6584,
+2141,
+3,
+47,
+65535,
+34,
+65535,
+13,
+65535,
+6,
+65535,
+23,
+65535,
+58,
+65535,
+55,
+65535,
+65535,
+285,
+65535,
+3568,
+6352,
+14134,
+25468,
+37246,
+55710,
+61602,
+64329,
+65534,
+65143,
+65534,
+65375,
+65534,
+65504,
+65532,
+65534,
+65508,
+65534,
+65514,
+65534,
+65534,
+65442,
+65534,
+65202,
+65534,
+63160,
+55981,
+46770,
+38920,
+38254,
+32016,
+25432,
+23856,
+24684,
+25524,
+27499,
+28836,
+23697,
+26993,
+29269,
+27064,
+30217,
+31207,
+35196,
+37672,
+39461,
+47601,
+54732,
+59867,
+62668,
+64237,
+65118,
+65135,
+65534,
+62679,
+58542,
+57534,
+52419,
+46141,
+44956,
+43108,
+38103,
+35368,
+30876,
+29481,
+31449,
+27643,
+23568,
+22531,
+19982,
+17250,
+16259,
+11422,
+7254,
+6441,
+2366,
+886,
+1463,
+65535,
+883,
+1295,
+65535,
+27,
+65535,
+65535,
+14,
+65535,
+11,
+65535,
+3,
+65535,
+21,
+65535,
+86,
+65535,
+193,
+65535,
+274,
+65535,
+666,
+10144,
+20055,
+39059,
+54586,
+59617,
+65091,
+62236,
+62003,
+65534,
+65440,
+65534,
+65534,
+65505,
+65534,
+65496,
+65534,
+65522,
+65528,
+65534,
+65484,
+65534,
+65387,
+65534,
+61442,
+45896,
+33878,
+31537,
+21786,
+7972,
+4063,
+1280,
+1916,
+6138,
+2340,
+65535,
+2725,
+2808,
+1436,
+5314,
+10053,
+14803,
+17321,
+21484,
+36911,
+52222,
+61238,
+65534,
+65451,
+65534,
+65527,
+65534,
+65528,
+65534,
+65530,
+65509,
+65534,
+65333,
+65534,
+60641,
+54925,
+52773,
+49655,
+49175,
+45100,
+38916,
+34330,
+30949,
+29163,
+22473,
+12368,
+5433,
+3284,
+2030,
+76,
+65535,
+30,
+65535,
+27,
+65535,
+16,
+65535,
+4,
+65535,
+0,
+65535,
+0,
+65535,
+4,
+65535,
+2,
+9,
+65535,
+64,
+65535,
+177,
+65535,
+329,
+65535,
+866,
+8403,
+20689,
+42792,
+57299,
+62935,
+65534,
+64413,
+62301,
+64535,
+65534,
+65333,
+65534,
+65471,
+65534,
+65529,
+65533,
+65521,
+65534,
+65432,
+65534,
+65205,
+65534,
+62118,
+48049,
+30155,
+17315,
+16335,
+13891,
+8363,
+4482,
+947,
+1037,
+5821,
+6483,
+3181,
+6068,
+5950,
+6310,
+9854,
+16358,
+28216,
+33770,
+39168,
+50183,
+61888,
+65534,
+65257,
+65534,
+65472,
+65534,
+65534,
+65500,
+65534,
+65512,
+65527,
+65534,
+65386,
+65534,
+63141,
+58457,
+50460,
+40095,
+38094,
+36842,
+27493,
+22502,
+24824,
+21325,
+19311,
+17392,
+13848,
+15891,
+13990,
+7471,
+2406,
+709,
+122,
+65535,
+57,
+65535,
+23,
+65535,
+6,
+65535,
+1,
+0,
+0,
+65535,
+3,
+65535,
+8,
+65535,
+0,
+13,
+65535,
+75,
+65535,
+220,
+65535,
+3569,
+20065,
+43598,
+61871,
+65534,
+65291,
+65534,
+65439,
+65534,
+65506,
+65534,
+65528,
+65534,
+65529,
+65534,
+65534,
+65502,
+65534,
+65403,
+65534,
+65179,
+65534,
+61805,
+46141,
+29440,
+16234,
+11212,
+12051,
+13960,
+15531,
+14481,
+11588,
+11331,
+11047,
+8113,
+6716,
+3298,
+19,
+2939,
+12306,
+29329,
+43795,
+55302,
+64839,
+65534,
+65447,
+65534,
+65454,
+65534,
+65411,
+65534,
+64087,
+60907,
+56868,
+55947,
+55571,
+58457,
+65498,
+65534,
+65236,
+65534,
+60731,
+53463,
+47039,
+38655,
+28624,
+19862,
+15623,
+16126,
+23289,
+27399,
+28331,
+29053,
+24741,
+19729,
+15511,
+6640,
+65535,
+81,
+65535,
+65535,
+44,
+65535,
+40,
+65535,
+18,
+65535,
+7,
+65535,
+11,
+65535,
+28,
+65535,
+31,
+65535,
+65535,
+137,
+65535,
+553,
+65535,
+6029,
+24093,
+46465,
+64669,
+65534,
+65307,
+65534,
+65331,
+65534,
+65427,
+65534,
+65517,
+65519,
+65534,
+65490,
+65534,
+65534,
+65466,
+65534,
+65112,
+65534,
+58468,
+39942,
+24392,
+16013,
+10645,
+9006,
+12838,
+15005,
+19140,
+19434,
+14961,
+7957,
+846,
+65535,
+81,
+65535,
+256,
+7393,
+21311,
+37668,
+57042,
+65534,
+65313,
+65534,
+65458,
+65534,
+65430,
+65534,
+62962,
+56460,
+55584,
+56768,
+57645,
+63377,
+65534,
+65209,
+65534,
+65310,
+65534,
+64541,
+56495,
+50339,
+46757,
+43414,
+41945,
+41932,
+42098,
+40523,
+42217,
+38757,
+33620,
+33233,
+29454,
+22891,
+18226,
+15311,
+10899,
+8051,
+3565,
+65535,
+119,
+65535,
+0,
+21,
+65535,
+25,
+65535,
+19,
+65535,
+16,
+65535,
+22,
+65535,
+65535,
+48,
+65535,
+240,
+65535,
+670,
+65535,
+5262,
+27880,
+51050,
+65374,
+65534,
+65307,
+65534,
+65338,
+65534,
+65430,
+65534,
+65519,
+65507,
+65534,
+65413,
+65534,
+65330,
+65534,
+65345,
+65534,
+65046,
+46958,
+28301,
+17790,
+12379,
+10296,
+7872,
+11369,
+11260,
+11633,
+11980,
+6861,
+2626,
+117,
+65535,
+184,
+7317,
+19418,
+28551,
+38558,
+50250,
+61695,
+65534,
+65341,
+65534,
+65487,
+65534,
+65532,
+65534,
+65513,
+65534,
+65497,
+64870,
+60708,
+59794,
+61798,
+51670,
+45310,
+46569,
+46733,
+53029,
+55488,
+55941,
+56931,
+55603,
+54347,
+49918,
+46024,
+38235,
+31208,
+28611,
+26331,
+28643,
+29785,
+27108,
+24110,
 23788,
-23550,
-23736,
-23684,
-23866,
-23922,
-23894,
-23919,
-23791,
-23760,
-23552,
-23630,
-23286,
-23341,
-22890,
-22785,
-22310,
-22125,
-21675,
-21467,
-21118,
-20887,
-20512,
-20329,
-19856,
-19665,
-19224,
-19192,
-19034,
-18985,
-19137,
-19092,
-19297,
-19353,
-19456,
-19751,
-19983,
-20199,
-20407,
-20435,
-20515,
-20513,
-20541,
-20540,
-20540,
-20357,
-20116,
-19856,
-19508,
-19381,
-19060,
-18957,
-18744,
-18428,
-18374,
-18166,
-18055,
-18088,
-18028,
-18246,
-18478,
-18853,
-19269,
-19674,
-20112,
-20388,
-20984,
-21363,
-22149,
-22838,
-23473,
-23893,
-24212,
-24184,
-24370,
-24395,
-24503,
-24632,
-24476,
-24422,
-24106,
-24000,
-23760,
-23765,
-23601,
-23765,
-23813,
-24132,
-24186,
-24631,
-24664,
-24999,
-25245,
-25659,
-26434,
-27006,
-27992,
-28511,
-29073,
-29438,
-29758,
-29888,
-30364,
-30286,
-30626,
-30603,
-30522,
-30443,
-30154,
-29993,
-29546,
-29281,
-28885,
-28463,
-28436,
-28147,
-28251,
-28329,
-28385,
-28672,
-28862,
-29411,
-29864,
-30572,
-31081,
-31707,
-32163,
-32607,
-33057,
-33562,
-34031,
-34593,
-34930,
-35251,
-35433,
-35462,
-35301,
-35014,
-34507,
-34064,
-33662,
-33351,
-33294,
-33242,
-33217,
-33188,
-33112,
-32951,
-32980,
-33003,
-33296,
-33745,
-34244,
-34724,
-35195,
-35620,
-35936,
-36359,
-36832,
-37286,
-37914,
-38103,
-38418,
-38338,
-38289,
-38284,
-38182,
-38285,
-38102,
-38182,
-37888,
-37840,
-37438,
-37286,
-36832,
-36650,
-36622,
-36544,
-36912,
-37153,
-37597,
-37920,
-38309,
-38526,
-38814,
-39026,
-39238,
-39604,
-39874,
-40316,
-40694,
-41108,
-41352,
-41612,
-41589,
-41823,
-41748,
-41955,
-41983,
-41907,
-42033,
-41670,
-41716,
-41325,
-41190,
-40955,
-40873,
-40664,
-40742,
-40477,
-40401,
-40344,
-40136,
-40372,
-40584,
-40980,
-41535,
-41929,
-42302,
-42404,
-42671,
-42644,
-43118,
-43199,
-43620,
-43752,
-43833,
-43858,
-43726,
-43700,
-43541,
-43383,
-43173,
-42800,
-42672,
-42140,
-42117,
-41639,
-41589,
-41163,
-41112,
-40875,
-40742,
-40822,
-40716,
-41110,
-41220,
-41637,
-41829,
-41980,
-42197,
-42352,
-42722,
-42989,
-43169,
-43281,
-43009,
-42992,
-42532,
-42411,
-41954,
-41641,
-41324,
-40926,
-40663,
-40162,
+19520,
+12264,
+4417,
+65535,
+217,
+65535,
+6,
+29,
+65535,
+37,
+65535,
+13,
+65535,
+2,
+65535,
+45,
+65535,
+163,
+65535,
+326,
+65535,
+491,
+65535,
+3480,
+38340,
+64534,
+65267,
+65534,
+65443,
+65534,
+65534,
+65487,
+65534,
+65514,
+65534,
+65534,
+65534,
+65503,
+65534,
+65366,
+65534,
+65066,
+65534,
+56118,
+29951,
+15358,
+9228,
+9519,
+19070,
+23490,
+24436,
+17863,
+3166,
+65535,
+65535,
+320,
+65535,
+4338,
+21919,
+40390,
+60470,
+65534,
+65050,
+65534,
+65534,
+58506,
+44700,
+41063,
+51435,
+63860,
+65534,
+65275,
+65534,
+65534,
+65321,
+65534,
+52830,
+24149,
+4954,
+65535,
+2962,
+14692,
+34166,
+58194,
+65534,
+65351,
+65534,
+65534,
+64584,
+48166,
+26939,
+16338,
+24700,
+39439,
+48100,
+58588,
+64916,
+65220,
+59315,
+46999,
+28560,
+7591,
+65535,
+239,
+65535,
+58,
+65535,
+65535,
+18,
+65535,
+16,
+65535,
+65535,
+32,
+65535,
+68,
+65535,
+22,
+78,
+65535,
+517,
+65535,
+1529,
+65535,
+17050,
+59873,
+65534,
+64814,
+65534,
+65022,
+65534,
+65275,
+65534,
+65461,
+65534,
+65534,
+65464,
+65534,
+65351,
+65534,
+65144,
+65534,
+63254,
+49576,
+36978,
+26650,
+17756,
+11295,
+17262,
+28028,
+32876,
+28297,
+8712,
+65535,
+881,
+65535,
+1891,
+22477,
+45748,
+61242,
+65534,
+65100,
+65534,
+65224,
+65534,
+59373,
+47630,
+46662,
+57437,
+65526,
+65534,
+65255,
+65534,
+62419,
+47799,
+31771,
+19688,
+7302,
+65535,
+530,
+65535,
+6789,
+33514,
+52833,
+62967,
+65534,
+64774,
+65534,
+63022,
+59324,
+56589,
+53215,
+55175,
+60780,
+65534,
+65534,
+65122,
+65534,
+62383,
+47788,
+27909,
+13251,
+4567,
+65535,
+83,
+5,
+65535,
+57,
+65535,
+44,
+65535,
+23,
+65535,
+0,
+24,
+65535,
+124,
+65535,
+278,
+65535,
+334,
+65535,
+65535,
+493,
+65535,
+37492,
+65534,
+64232,
+65534,
+65298,
+65534,
+65534,
+65140,
+57958,
+57534,
+65534,
+65454,
+65534,
+65495,
+65534,
+65186,
+65534,
+59135,
+40974,
+35719,
+38364,
+44639,
+53929,
+55564,
+52588,
+43730,
+24031,
+3902,
+65535,
+393,
+65535,
+65535,
+16836,
+49070,
+64874,
+65399,
+65534,
+61593,
+47841,
+37398,
+36173,
+45775,
+60703,
+65534,
+65003,
+65534,
+64952,
+65534,
+61452,
+39430,
+21645,
+15510,
+20699,
+31974,
+41897,
+44191,
+43692,
+40249,
+41923,
+58771,
+64191,
+64166,
+64837,
+64330,
+65534,
+65337,
+65534,
+65534,
+62633,
+53146,
+48030,
+53179,
+52289,
+44229,
+32282,
+22776,
+19710,
+17338,
+11297,
+1357,
+65535,
+283,
+65535,
+155,
+65535,
+60,
+65535,
+11,
+65535,
+27,
+65535,
+101,
+65535,
+173,
+65535,
+79,
+105,
+65535,
+999,
+65535,
+29757,
+65534,
+65079,
+65534,
+65534,
+65423,
+64921,
+64713,
+65534,
+65350,
+65534,
+65472,
+65534,
+65418,
+65534,
+65166,
+65534,
+60077,
+48800,
+54892,
+65333,
+65253,
+65534,
+64305,
+50315,
+35150,
+15345,
+321,
+65535,
+86,
+65535,
+410,
+14252,
+35284,
+45948,
+46765,
+42794,
+35185,
+33369,
+39049,
+48066,
+60807,
+65534,
+65311,
+65534,
+65499,
+65472,
+65534,
+59916,
+49939,
+45838,
+47768,
+52736,
+60883,
+64871,
+49298,
+36342,
+27304,
+22258,
+44689,
+59240,
+63919,
+65534,
+65065,
+65534,
+65245,
+65344,
+53969,
+50157,
+50821,
+48847,
+63279,
+65312,
+60945,
+61487,
+40909,
+13318,
+285,
+65535,
+195,
+65535,
+120,
+65535,
+48,
+65535,
+12,
+65535,
+9,
+65535,
+44,
+65535,
+93,
+65535,
+65,
+35,
+65535,
+538,
+65535,
+1793,
+65535,
+20367,
+63604,
+65534,
+65126,
+65534,
+63919,
+65534,
+65342,
+65534,
+65528,
+65483,
+65534,
+65481,
+65524,
+65534,
+65219,
+65534,
+57942,
+54361,
+63801,
+65534,
+64639,
+65534,
+58337,
+38089,
+22860,
+5670,
+65535,
+482,
+65535,
+273,
+65535,
+8207,
+20625,
+22996,
+16860,
+14214,
+14651,
+21160,
+36865,
+55255,
+65534,
+65419,
+65534,
+65534,
+65500,
+65532,
+65534,
+65382,
+65280,
+65468,
+65534,
+65534,
+65279,
+65534,
+54735,
+48592,
+39122,
+26516,
+50907,
+65534,
+64576,
+65534,
+64982,
+65534,
+62271,
+55527,
+50118,
+55938,
+60178,
+54053,
+62367,
+64401,
+55828,
+44888,
+23354,
+8770,
+1264,
+65535,
+65535,
+1930,
+4016,
+65535,
+64,
+63,
+65535,
+126,
+65535,
+91,
+65535,
+38,
+4,
+65535,
+152,
+65535,
+422,
+65535,
+862,
+65535,
+8366,
+46970,
+65534,
+63466,
+57560,
+49117,
+54016,
+64276,
+65534,
+65317,
+65534,
+65418,
+65534,
+65421,
+65534,
+65305,
+65534,
+64478,
+63354,
+65239,
+65534,
+64863,
+65534,
+61373,
+38602,
+18048,
+5431,
+1151,
+458,
+65535,
+194,
+65535,
+62,
+65535,
+65535,
+45,
+65535,
+443,
+5824,
+22542,
+44131,
+57933,
+63147,
+64550,
+65511,
+65534,
+65518,
+65534,
+65534,
+65504,
+65534,
+65528,
+65474,
+65534,
+65094,
+65534,
+58563,
+42704,
+36134,
+50813,
+65534,
+65124,
+65534,
+65204,
+65534,
+57550,
+43691,
+46356,
+49680,
+49637,
+45487,
+48863,
+60028,
+53206,
+40888,
+27034,
+7634,
+65535,
+707,
+65535,
+3045,
+12635,
+5007,
+65535,
+646,
+65535,
+222,
+65535,
+25,
+28,
+65535,
+77,
+65535,
+88,
+65535,
+19,
+81,
+65535,
+605,
+65535,
+15455,
+45287,
+50196,
+34568,
+32391,
+44135,
+54840,
+65139,
+65534,
+65278,
+65534,
+65342,
+65534,
+65465,
+65534,
+65534,
+65440,
+65534,
+65415,
+65534,
+65534,
+65292,
+65534,
+48978,
+26962,
+17106,
+11677,
+6644,
+448,
+65535,
+117,
+65535,
+83,
+65535,
+58,
+65535,
+105,
+65535,
+8944,
+29003,
+45654,
+54317,
+57025,
+60011,
+64946,
+65534,
+65431,
+65534,
+65455,
+65534,
+65440,
+65534,
+65380,
+65534,
+65315,
+65534,
+64939,
+60341,
+63772,
+65534,
+65212,
+65534,
+65427,
+65038,
+54745,
+45753,
+45839,
+44271,
+41542,
+36452,
+35252,
+44316,
+43843,
+24832,
+6584,
+411,
+65535,
+65535,
+2700,
+6708,
+12646,
+8250,
+65535,
+179,
+65535,
+65535,
+83,
+65535,
+84,
+65535,
+42,
+65535,
+65535,
+113,
+65535,
+343,
+65535,
+727,
+65535,
+4177,
+27105,
+35847,
+26934,
+13563,
+11514,
+24421,
+46532,
+64266,
+65534,
+65388,
+65534,
+65404,
+65534,
+65468,
+65534,
+65534,
+65448,
+65534,
+65312,
+65534,
+65145,
+65534,
+63462,
+44291,
+24280,
+11148,
+4299,
+1148,
+65535,
+197,
+65535,
+51,
+2,
+65535,
+124,
+65535,
+369,
+65535,
+4192,
+18870,
+32202,
+41598,
+46228,
+51751,
+60827,
+65534,
+65494,
+65532,
+65534,
+65509,
+65534,
+65516,
+65534,
+65523,
+65534,
+65509,
+65534,
+65456,
+65534,
+65380,
+65534,
+65303,
+65534,
+63915,
+47852,
+36240,
+36988,
+39713,
+42978,
+39062,
+34311,
+31117,
+20029,
+6882,
+252,
+65535,
+176,
+65535,
+865,
+5922,
+12422,
+8983,
+576,
+65535,
+130,
+65535,
+98,
+65535,
+61,
+65535,
+73,
+65535,
+145,
+65535,
+220,
+65535,
+178,
+65535,
+462,
+22672,
+38608,
+29067,
+15250,
+4434,
+5448,
+20670,
+45847,
+64201,
+65534,
+65338,
+65534,
+65386,
+65534,
+65422,
+65534,
+65437,
+65534,
+65472,
+65533,
+65534,
+65185,
+65534,
+53237,
+32205,
+16379,
+7348,
+7485,
+7055,
+6077,
+1825,
+65535,
+347,
+65535,
+204,
+65535,
+100,
+65535,
+65535,
+9595,
+22525,
+33363,
+38031,
+38068,
+40508,
+51146,
+64557,
+65534,
+65301,
+65534,
+65366,
+65534,
+65453,
+65534,
+65513,
+65534,
+65526,
+65534,
+65494,
+65534,
+65428,
+65534,
+65338,
+65534,
+64207,
+54932,
+48009,
+46651,
+46525,
+42576,
+34909,
+27947,
+20284,
+11836,
+3786,
+65535,
+70,
+65535,
+1070,
+4233,
+8471,
+5532,
+65535,
+94,
+65535,
+65535,
+56,
+65535,
+68,
+65535,
+87,
+65535,
+101,
+65535,
+65535,
+150,
+65535,
+855,
+65535,
+16823,
+41493,
+36504,
+18008,
+1840,
+65535,
+1468,
+16940,
+48574,
+65534,
+65434,
+65519,
+65534,
+65442,
+65534,
+65420,
+65534,
+65403,
+65534,
+65402,
+65534,
+65502,
+65426,
+65534,
+46598,
+16932,
+1665,
+65535,
+4402,
+10041,
+10923,
+5158,
+113,
+38,
+65535,
+65535,
+75,
+65535,
+351,
+65535,
+9048,
+25861,
+36262,
+43745,
+46768,
+46706,
+51953,
+62949,
+65534,
+65215,
+65534,
+65402,
+65534,
+65496,
+65534,
+65528,
+65534,
+65513,
+65534,
+65481,
+65534,
+65470,
+65534,
+65534,
+65430,
+65534,
+55049,
+43325,
+41310,
+41004,
+39689,
+33071,
+25642,
+20293,
+11466,
+2099,
+65535,
+220,
+65535,
+311,
+65535,
+2110,
+3638,
+39,
+65535,
+85,
+65535,
+90,
+65535,
+70,
+65535,
+55,
+65535,
+19,
+40,
+65535,
+284,
+65535,
+860,
+65535,
+10480,
+36302,
+36079,
+21387,
+6825,
+65535,
+1085,
+15881,
+49176,
+65534,
+65078,
+65534,
+65456,
+65529,
+65534,
+65485,
+65534,
+65534,
+65436,
+65534,
+65295,
+65534,
+65154,
+65534,
+61776,
+28319,
+1176,
+238,
+65535,
+2817,
+11326,
+12762,
+3897,
+65535,
+393,
+65535,
+233,
+65535,
+242,
+65535,
+1531,
+16473,
+33203,
+45792,
+51522,
+49393,
+48203,
+53376,
+63015,
+65534,
+65302,
+65534,
+65443,
+65534,
+65508,
+65534,
+65525,
+65534,
+65523,
+65534,
+65534,
+65476,
+65534,
+65301,
+65534,
+64946,
+65534,
+59512,
+38046,
+26278,
+25500,
+30347,
+28374,
+25485,
+27663,
+21284,
+11644,
+7624,
+5519,
+867,
+65535,
+401,
+65535,
+1145,
+3026,
+370,
+65535,
+153,
+65535,
+94,
+65535,
+58,
+65535,
+51,
+65535,
+31,
+11,
+65535,
+227,
+65535,
+776,
+65535,
+10082,
+33088,
+36924,
+32299,
+20503,
+11703,
+20259,
+42187,
+63244,
+65534,
+65146,
+65534,
+65319,
+65534,
+65451,
+65534,
+65506,
+65534,
+65484,
+65534,
+65407,
+65534,
+65250,
+65534,
+59878,
+29329,
+2564,
+65535,
+175,
+65535,
+130,
+65535,
+99,
+65535,
+70,
+65535,
+21,
+35,
+65535,
+310,
+65535,
+11073,
+37407,
+58810,
+65534,
+65335,
+65534,
+65517,
+65523,
+65534,
+65519,
+65534,
+65529,
+65534,
+65492,
+65534,
+65363,
+65534,
+65114,
+65534,
+62647,
+57815,
+64344,
+65534,
+65496,
+65394,
+65534,
+62716,
+39666,
+18546,
+7450,
+5077,
+7644,
+10342,
+22632,
+32112,
+29233,
+19753,
+13134,
+7118,
+178,
+65535,
+164,
+65535,
+7264,
+16238,
+15232,
+4843,
+65535,
+329,
+65535,
+67,
+65535,
+3,
+65535,
+35,
+65535,
+86,
+65535,
+39,
+71,
+65535,
+609,
+65535,
+19418,
+49025,
+55747,
+49631,
+32656,
+23186,
+24736,
+42355,
+64285,
+65534,
+65296,
+65534,
+65305,
+65534,
+65408,
+65534,
+65519,
+65503,
+65534,
+65425,
+65534,
+65347,
+65534,
+64467,
+49120,
+21692,
+1908,
+65535,
+272,
+65535,
+133,
+65535,
+36,
+65535,
+65535,
+2,
+38,
+65535,
+306,
+65535,
+7491,
+32263,
+58099,
+65534,
+65104,
+65534,
+65436,
+65534,
+65534,
+65517,
+65534,
+65534,
+65510,
+65534,
+65467,
+65534,
+65472,
+65534,
+65534,
+59222,
+51080,
+48769,
+57566,
+65326,
+65534,
+64542,
+53753,
+36773,
+19721,
+7138,
+661,
+65535,
+3243,
+10057,
+20088,
+25825,
+24753,
+21521,
+19320,
+15155,
+9731,
+7192,
+7068,
+9949,
+14727,
+15415,
+11578,
+7565,
+2125,
+65535,
+180,
+65535,
+56,
+65535,
+24,
+65535,
+39,
+65535,
+38,
+65535,
+65535,
+206,
+65535,
+799,
+65535,
+12606,
+43946,
+56895,
+55461,
+43505,
+23268,
+10830,
+13580,
+41625,
+65534,
+65360,
+65460,
+65534,
+65227,
+65534,
+65186,
+65534,
+64026,
+55035,
+57979,
+65534,
+65235,
+65534,
+65089,
+65534,
+46476,
+9754,
+65535,
+738,
+65535,
+468,
+65535,
+1342,
+15783,
+26435,
+26771,
+16159,
+1362,
+65535,
+326,
+676,
+22973,
+57518,
+65534,
+64885,
+65534,
+65272,
+65534,
+65454,
+65534,
+65514,
+65534,
+65474,
+65534,
+65379,
+65534,
+65268,
+65534,
+63689,
+43854,
+20727,
+9897,
+10439,
+21875,
+41962,
+59747,
+59578,
+42993,
+20503,
+3061,
+65535,
+653,
+65535,
+5628,
+23926,
+39841,
+50413,
+51185,
+36204,
+17929,
+6408,
+475,
+16,
+7204,
+21000,
+35307,
+42397,
+36923,
+29031,
+21663,
+6611,
+65535,
+388,
+65535,
+106,
+65535,
+65535,
+37,
+65535,
+98,
+65535,
+172,
+65535,
+187,
+65535,
+65535,
+272,
+65535,
+26154,
+56397,
+62342,
+60603,
+42737,
+19086,
+7575,
+20496,
+54246,
+65534,
+64673,
+65534,
+65276,
+65534,
+65534,
+65114,
+65534,
+59796,
+50884,
+52814,
+56014,
+58875,
+63066,
+65534,
+57682,
+35125,
+9475,
+65535,
+227,
+33,
+65535,
+484,
+65535,
+5587,
+28505,
+44920,
+47894,
+43006,
+31787,
+19187,
+12862,
+23810,
+51945,
+65534,
+65051,
+65534,
+65446,
+65534,
+65534,
+65476,
+65534,
+65505,
+65524,
+65534,
+65428,
+65534,
+65224,
+65534,
+60782,
+34569,
+6927,
+65535,
+0,
+435,
+65535,
+12242,
+41328,
+53967,
+51971,
+36621,
+10074,
+65535,
+563,
+65535,
+503,
+16809,
+45906,
+63633,
+65534,
+57310,
+41472,
+29904,
+20307,
+21012,
+30961,
+48294,
+63918,
+65534,
+64479,
+52267,
+31164,
+9596,
+65535,
+320,
+65535,
+45,
+15,
+65535,
+41,
+65535,
+65535,
+83,
+65535,
+239,
+65535,
+328,
+65535,
+123,
+131,
+621,
+38455,
+65534,
+64662,
+65534,
+65534,
+63709,
+49064,
+48883,
+63734,
+65534,
+65298,
+65534,
+65365,
+65534,
+65534,
+65010,
+65534,
+49191,
+20897,
+11528,
+15008,
+24049,
+35447,
+49330,
+50712,
+39347,
+19877,
+1813,
+65535,
+586,
+65535,
+611,
+65535,
+3667,
+39314,
+65334,
+65511,
+65089,
+65534,
+58479,
+35178,
+26078,
 39950,
-39395,
-39132,
-38523,
-38340,
-37969,
-37997,
-37782,
-37841,
-37728,
-37709,
-37597,
-37653,
-37654,
-37730,
-37866,
-37914,
-37892,
-37862,
-37655,
-37492,
-37046,
-36861,
-36462,
-36414,
-36119,
-36042,
-35568,
-35352,
-34725,
-34453,
-34038,
-33980,
-33850,
-33904,
-33795,
-33640,
-33505,
-33191,
-33031,
-32926,
-32899,
-32951,
-33084,
-33111,
-33296,
-33268,
-33269,
+61643,
+65534,
+64980,
+65534,
+65243,
+65534,
+65094,
+65534,
+51355,
+30692,
+27327,
+33802,
+46907,
+59490,
+61308,
+49938,
+25546,
+2997,
+65535,
+647,
+65535,
+597,
+65535,
+2112,
+23224,
+43036,
+49731,
+45738,
+28978,
+8153,
+65535,
+345,
+14581,
+45164,
+64677,
+65534,
+65534,
+65219,
+65534,
+60864,
+43167,
+35122,
+36376,
+43175,
+55714,
+59414,
+50511,
+33093,
+9088,
+65535,
+497,
+65535,
+129,
+65535,
+65535,
+33,
+65535,
+36,
+65535,
+65535,
+93,
+65535,
+280,
+65535,
+461,
+65535,
+429,
+65535,
+1932,
+42976,
+65534,
+64089,
+65534,
+65144,
+65534,
+65534,
+65475,
+65201,
+65221,
+65534,
+65340,
+65534,
+65344,
+65534,
+65388,
+65534,
+64876,
+44046,
+21668,
+15381,
+11199,
+10623,
+21652,
+37425,
+44470,
+47027,
+48400,
+43467,
+29361,
+9224,
+65535,
+419,
+65535,
+4521,
+31222,
+59605,
+65534,
+64974,
+65534,
+64657,
+45124,
+21500,
+12233,
+13676,
+35105,
+61929,
+65534,
+65371,
+65413,
+65534,
+62314,
+35156,
+7943,
+65535,
+289,
+65535,
+7770,
+22666,
+32047,
+36312,
 33163,
-33110,
-33086,
-33108,
-33138,
-33084,
-33005,
-32820,
-32451,
-32157,
-31874,
-31784,
-31849,
-31891,
-31951,
-31842,
-31605,
-31315,
-31157,
-31181,
-31290,
-31604,
-31579,
-31686,
-31602,
-31582,
-31577,
-31579,
-31633,
-31682,
-31713,
-31814,
-31952,
-32209,
-32296,
-32419,
-32428,
-32394,
-32268,
-32212,
-32185,
-32188,
-32237,
-32162,
-31919,
-31899,
-31576,
-31581,
-31631,
-31630,
-31951,
-31894,
-32081,
-31923,
-31973,
-31951,
-32132,
-32265,
-32504,
-32555,
-32583,
-32424,
-32317,
-32108,
-32159,
-31923,
-32027,
-31764,
-31762,
-31528,
-31471,
-31132,
-31076,
-30627,
-30471,
-30152,
-29994,
-29785,
-29648,
-29363,
-29175,
-29070,
-28964,
-29019,
-28961,
-29075,
-28959,
-29021,
-28936,
-29124,
-29017,
-29308,
-29016,
-29230,
-28990,
-28913,
-28751,
-28624,
-28380,
-28440,
-28222,
-28280,
-28066,
-27933,
-27699,
-27537,
-27460,
-27486,
-27431,
-27515,
-27403,
-27489,
-27483,
-27407,
-27539,
-27405,
-27541,
-27482,
-27647,
-27615,
-27567,
-27432,
-27195,
-26984,
-26931,
-26747,
-26824,
-26589,
-26376,
-26113,
-25742,
-25479,
-25187,
-25031,
-25030,
-25001,
-25086,
-25263,
-25271,
-25398,
-25320,
-25374,
-25397,
-25587,
-25636,
-25742,
-25665,
-25741,
-25506,
-25478,
-25268,
-25108,
-24846,
-24685,
-24450,
-24183,
-24108,
-23601,
-23526,
-23234,
-23312,
-23447,
-23813,
-24054,
-24369,
-24396,
-24343,
-24342,
-24398,
-24711,
-25427,
-26086,
-26877,
-27408,
-27458,
-27512,
-27223,
-27246,
-27408,
-27379,
-27486,
-27010,
-26561,
-25981,
-25583,
-25612,
-25610,
-25795,
-25744,
-25504,
-25294,
-25030,
-25240,
-25534,
-26003,
-26698,
-27058,
-27675,
-28063,
-28650,
-29279,
-29943,
-30522,
-30813,
-31104,
-31102,
-31342,
-31631,
-31870,
-32239,
-32027,
-31685,
-31024,
-30311,
-29837,
-29491,
-29388,
-29148,
+21760,
+5666,
+65535,
+254,
+50,
+65535,
+11491,
+40256,
+61907,
+65534,
+65006,
+65534,
+59928,
+43284,
 29178,
-28961,
-29102,
-29301,
-29737,
-30330,
-31085,
-31625,
-32323,
-32712,
-33136,
-33509,
-33979,
-34486,
-35196,
-35829,
-36546,
-37200,
-37630,
-38019,
-38052,
-37967,
-37416,
-36992,
-36464,
-36200,
-36175,
-35908,
-35673,
-35038,
-34377,
-33878,
-33769,
-34114,
-34591,
-35273,
-35464,
-35801,
-35938,
-36410,
-37311,
-38284,
-39318,
-40002,
-40056,
-39977,
-39341,
-39054,
-38733,
-38685,
-38787,
-38577,
-38523,
-38209,
-37835,
-37417,
-36675,
-36040,
-35279,
-34533,
-34037,
-33638,
-33533,
-33586,
-33691,
-33955,
-34142,
-34455,
-34830,
-35299,
-35780,
-36384,
-36781,
-37283,
-37389,
-37862,
-37867,
-38335,
-38476,
-38678,
-38607,
-38203,
-37657,
-36831,
-36201,
-35646,
-35301,
-35198,
-35091,
-35196,
-34879,
-34803,
-34190,
-33827,
-33424,
-33191,
-33375,
-33743,
-34328,
-34876,
-35332,
-35748,
-36071,
-36463,
-36967,
-37651,
-38050,
-38602,
-38472,
-38550,
-38339,
-38235,
-38232,
-38392,
-38576,
-38684,
-38549,
-38184,
-37569,
-36889,
-36306,
-35961,
-35886,
-36117,
-36177,
-36462,
-36228,
-36384,
-36068,
-36280,
-36331,
-36650,
-37098,
-37441,
-37943,
-38392,
-38920,
-39422,
-39977,
-40319,
-40610,
-40822,
-40715,
-40902,
-40477,
-40373,
-39923,
-39581,
-39263,
-38868,
-38628,
-38263,
-37992,
-37392,
-36963,
-36308,
-35908,
-35568,
-35671,
-35752,
-36357,
-36650,
-37177,
-37257,
-37653,
-37677,
-38183,
-38680,
-39240,
-39841,
-40060,
-40315,
-40350,
-40344,
-40506,
-40265,
-40111,
-39630,
-39082,
-38733,
-38234,
-37759,
-37440,
-36729,
-36252,
-35700,
-35327,
-35304,
-35168,
-35436,
-35328,
-35408,
-35382,
-35539,
-35673,
-36278,
-36624,
-37230,
-37572,
-37708,
-37781,
-37735,
-37703,
-37734,
-37809,
-37628,
-37439,
-36863,
-36145,
-35568,
-34747,
-34351,
-33877,
-33428,
-33161,
-32611,
-32237,
-31739,
-31313,
-31078,
-30865,
+25946,
+32432,
+45920,
+61076,
+65534,
+65014,
+65534,
+63581,
+45805,
+24013,
+8628,
+222,
+99,
+65535,
+1406,
+6454,
+4463,
+65535,
+37,
+3,
+65535,
+33,
+65535,
+29,
+65535,
+6,
+8,
+65535,
+25,
+65535,
+65535,
+69,
+65535,
+268,
+65535,
+642,
+65535,
+14533,
+53492,
+65534,
+64674,
+65534,
+65145,
+65534,
+65357,
+65534,
+63648,
+56193,
+58360,
+65534,
+65372,
+65534,
+65420,
+65534,
+65472,
+65534,
+65016,
+44814,
+25269,
+20393,
+15515,
+22132,
+40195,
+48720,
+50547,
+50374,
+40809,
+22475,
+3885,
+65535,
+364,
+65535,
+470,
+65535,
+9689,
+30631,
+48631,
+57209,
+48139,
+30970,
+16241,
+4900,
+2181,
+9034,
+30215,
+58745,
+65534,
+65273,
+65484,
+65534,
+62606,
+42877,
+25294,
+18709,
+22483,
+33245,
+43846,
+50972,
+51976,
+49382,
+43362,
+32181,
+20438,
+13603,
+9582,
+4753,
+2687,
+6300,
+11323,
+14168,
+15683,
+17467,
+21237,
+25509,
+28674,
+32605,
+34703,
+34410,
+35261,
+36991,
+36516,
+37316,
+44061,
+50741,
+54200,
+56249,
+58215,
+59897,
+58190,
+50658,
+39996,
+32366,
+24900,
+16325,
+9274,
+4355,
+2297,
+611,
+65535,
+70,
+65535,
+28,
+65535,
+9,
+1,
+65535,
+47,
+65535,
+146,
+65535,
+265,
+65535,
+362,
+65535,
+3245,
+37283,
+64744,
+65290,
+65534,
+65462,
+65534,
+65534,
+65522,
+65523,
+57802,
+46348,
+50429,
+64090,
+65534,
+65026,
+65534,
+64888,
+65534,
+58356,
+25445,
+1607,
+65535,
+323,
+65535,
+2619,
+11597,
+18214,
+25364,
+26902,
+22061,
+18767,
+11899,
+4773,
+2024,
+799,
+5490,
+15650,
+26508,
+41242,
+56579,
+64440,
+63954,
+58463,
+47729,
+34467,
+28900,
+31596,
+43341,
+59921,
+65534,
+64899,
+65534,
+63414,
+47155,
+25137,
+5091,
+65535,
+665,
+65535,
+3930,
+12360,
+16520,
+13432,
+3496,
+65535,
+161,
+65535,
+65535,
+896,
+12209,
+25825,
+35357,
+40379,
+43594,
+47457,
+53652,
+63501,
+65534,
+65259,
+65534,
+65421,
+65534,
+65528,
+65499,
+65534,
+65422,
+64893,
+65204,
+65534,
+65382,
+65534,
+64655,
+52623,
+34822,
+14972,
+710,
+65535,
+104,
+65535,
+106,
+65535,
+67,
+65535,
+31,
+65535,
+17,
+65535,
+11,
+65535,
+65535,
+34,
+65535,
+3335,
+7826,
+8589,
+8651,
+8275,
+10088,
+19831,
+32247,
+49451,
+64173,
+65534,
+65097,
+65534,
+63191,
+45418,
+25110,
+11748,
+7956,
+21340,
+43211,
+61545,
+65534,
+64998,
+65534,
+55457,
+35504,
+21028,
+14982,
+17357,
+23968,
+34422,
+44855,
+49280,
+52315,
+54572,
+54020,
+53718,
+49804,
+43945,
+38657,
+29982,
+20580,
+13845,
+10552,
+11773,
+15885,
+18549,
+19377,
+21291,
+20340,
+13502,
+7016,
+2104,
+2721,
+7294,
+10858,
+16633,
+22697,
+27586,
+30211,
 30840,
-31077,
-31235,
-31712,
-31841,
-32267,
-32185,
-32635,
-32479,
-33027,
-32983,
-33159,
-33140,
-32897,
-32716,
-32422,
-32136,
-31892,
-31582,
-31076,
-30548,
-29705,
-29148,
-28306,
-27880,
-27435,
-27112,
-26988,
-26823,
-26562,
-26484,
-26188,
-26300,
-26323,
-26586,
-26777,
-27058,
-27225,
-27458,
-27617,
-27831,
-28116,
-28228,
-28328,
-28175,
-27986,
-27590,
-27303,
-27035,
-26747,
-26614,
-26376,
-26113,
-25770,
-25371,
-24952,
-24738,
-24530,
-24499,
-24478,
-24366,
-24478,
-24500,
-24767,
-25134,
-25532,
-25927,
-26245,
-26482,
-26720,
-26984,
-27194,
-27567,
-27642,
-27831,
-27722,
-27671,
-27512,
-27301,
-27142,
-26720,
-26561,
-25955,
-25768,
-25453,
-25399,
+31779,
+33760,
+39024,
+45622,
+51360,
+56092,
+56682,
+54661,
+51186,
+46103,
+44044,
+46015,
+53310,
+63054,
+65534,
+65359,
+65534,
+65476,
+65534,
+65532,
+65506,
+65342,
+65534,
+65501,
+65534,
+65492,
+65534,
+65087,
+57553,
+47151,
+41051,
+38889,
+41273,
+45172,
+46911,
+47259,
+45113,
+39026,
+29921,
+18786,
+5895,
+65535,
+176,
+65535,
+26,
+1,
+65535,
+30,
+65535,
+285,
+124,
+65535,
+65535,
+44,
+65535,
+69,
+65535,
+1,
+97,
+65535,
+9144,
+19524,
+22930,
+23318,
+18014,
+13359,
+11807,
+16034,
+28065,
+44662,
+60923,
+65534,
+64944,
+65534,
+61362,
+45281,
+29075,
+21505,
+23609,
+31250,
+43286,
+56286,
+63690,
+64789,
+58838,
+49089,
+40555,
+32457,
+26254,
+24128,
+26582,
+32209,
+39545,
+47828,
+53166,
+54109,
+52371,
+45969,
+36042,
+26976,
+18583,
+12566,
+10877,
+14079,
+22646,
+32699,
+39570,
+43144,
+45275,
+44022,
+40837,
+40617,
+44524,
+49570,
+54221,
+57363,
+58625,
+59231,
+57157,
+55774,
+57391,
+60138,
+63756,
+65534,
+65534,
+65461,
+65534,
+63635,
+57058,
+51364,
+48424,
+48444,
+52413,
+59339,
+65183,
+65534,
+65534,
+64862,
+57736,
+48991,
+42302,
+38518,
+39181,
+42182,
+45339,
+47379,
+47527,
+45219,
+40027,
+32674,
+24973,
+19686,
+16670,
+13399,
+8874,
+2979,
+65535,
+76,
+65535,
+19,
+65535,
+65535,
+15,
+65535,
+85,
+65535,
+3092,
+7379,
+5710,
+1294,
+65535,
+37,
+14,
+65535,
+78,
+65535,
+545,
+5950,
+11873,
+15554,
+16430,
+13285,
+8427,
+4426,
+3014,
+5262,
+10629,
+16896,
+23670,
+30191,
+34658,
+35720,
+33902,
+31054,
+28885,
+28107,
+27806,
+29345,
+32587,
+35531,
+38813,
+42378,
+45495,
+47546,
+48079,
+47045,
+45107,
+44089,
+44364,
+47362,
+53127,
+60368,
+65396,
+65534,
+65457,
+65534,
+59221,
+48100,
+39861,
+35164,
+34424,
+38443,
+45740,
+53599,
+60243,
+64658,
+65534,
+63576,
+58526,
+52178,
+49430,
+51929,
+56940,
+63470,
+65534,
+65416,
+65534,
+65497,
+65363,
+57940,
+47156,
+38862,
+33571,
+32956,
+35413,
+40280,
+44549,
+45859,
+45279,
+42073,
+36885,
+32007,
+28653,
+29718,
+33961,
+38628,
+42719,
+45517,
+45467,
+41486,
+36219,
+31516,
+29405,
+30163,
+32133,
+36014,
+39852,
+40025,
+37144,
+33080,
+28775,
+25119,
+22053,
+18518,
+14737,
+11321,
+7094,
+3479,
+996,
+65535,
+58,
+65535,
+7,
+2,
+65535,
+11,
+65535,
+21,
+65535,
+43,
+65535,
+67,
+65535,
+343,
+3130,
+4632,
+5009,
+5896,
+9674,
+17894,
+28454,
+41239,
+53000,
+60430,
+64103,
+63969,
+60658,
+55296,
+49064,
+44935,
+42224,
+39758,
+37926,
+38457,
+39836,
+39028,
+36276,
+31737,
+25954,
+18309,
+10497,
+5496,
+4875,
+8800,
+14516,
+20826,
+26115,
+29279,
+31556,
+33407,
+36183,
+41447,
+48878,
+57221,
+63929,
+65534,
+65341,
+65534,
+64987,
+60472,
+55732,
+53288,
+52945,
+54117,
+55303,
+55866,
+55785,
+55239,
+53799,
+52109,
+50419,
+48624,
+45878,
+42495,
+39886,
+38523,
+39915,
+43325,
+46682,
+49139,
+50365,
+49908,
+46482,
+42732,
+41415,
+43307,
+47181,
+51197,
+54098,
+54775,
+54521,
+52801,
+52034,
+51616,
+49445,
+47806,
+46631,
+44119,
+40533,
+36745,
+31816,
 25373,
-25531,
-25427,
-25662,
-25480,
-25531,
-25557,
-25717,
-26006,
-26351,
-26588,
-26851,
-26800,
-27008,
-27013,
-27220,
-27380,
-27566,
-27484,
+16881,
+10479,
+7905,
+7220,
+5067,
+802,
+65535,
+109,
+65535,
+58,
+65535,
+8,
+23,
+65535,
+105,
+65535,
+2402,
+8174,
+12615,
+17451,
+22407,
+28666,
+37200,
+45028,
+51515,
+57295,
+59983,
+60781,
+61511,
+60894,
+62507,
+61848,
+58996,
+56599,
+51622,
+47690,
+45668,
+44990,
+44241,
+42668,
+39528,
+33978,
+29608,
+24167,
+18134,
+14738,
+12369,
+12135,
+14609,
+20530,
+27441,
+32114,
+35383,
+36955,
+38687,
+39183,
+37462,
+36555,
+35241,
+33874,
+35243,
+37843,
+39090,
+39286,
+38337,
+38699,
+37019,
+34870,
+34611,
+33547,
+33663,
+32291,
+27495,
+22555,
+18273,
+14190,
+9692,
+8133,
+9428,
+10230,
+12028,
+15986,
+18810,
+18723,
+18894,
+19847,
+23245,
+26894,
+29431,
+32498,
+36172,
+38916,
+42062,
+47133,
+49873,
+49889,
+48817,
+48479,
+47662,
+45469,
+43509,
+40729,
+39150,
+37853,
+36558,
+34026,
+29606,
+24300,
+17266,
+10825,
+6814,
+5784,
+5040,
+4312,
+6351,
+8918,
+9148,
+7021,
+4821,
+2493,
+1239,
+3615,
+7501,
+12260,
+17153,
+21833,
+26573,
+32763,
+38830,
+43400,
+49646,
+54642,
+60913,
+65534,
+65431,
+65534,
+65533,
+65508,
+65534,
+65483,
+65534,
+65468,
+65534,
+65450,
+65534,
+65179,
+61140,
+56531,
+49741,
+42756,
+41563,
+43535,
+43934,
+44173,
+42751,
+39171,
+34872,
+28431,
+24732,
+21373,
+18633,
+16768,
+17356,
+20509,
+21950,
+24957,
 27434,
-26957,
-26772,
-26457,
-26375,
-26378,
-26243,
-26246,
-25821,
-25717,
-25213,
-25085,
-24948,
-24899,
-25268,
-25318,
-25799,
-25871,
-26089,
-26268,
-26353,
-26559,
-26880,
-27167,
-27567,
-27879,
-28228,
-28512,
-28784,
-28907,
-28968,
-29042,
-29096,
-28994,
-29039,
-28758,
-28722,
-28440,
-28302,
-28306,
-28330,
-28488,
-28569,
-28701,
-28805,
-28781,
-28856,
-28809,
-28961,
-29128,
-29672,
-30104,
-30810,
+26296,
+27387,
+28924,
+30678,
+34626,
+39377,
+43629,
+46897,
+49705,
+50552,
+52331,
+53557,
+50614,
+46719,
+42312,
+36342,
+33608,
+32325,
+32938,
+32899,
+33889,
+34346,
+30529,
+27641,
+22511,
+17576,
+13189,
+9602,
+10932,
+14533,
+18110,
+20456,
+20918,
+19414,
+15875,
+14385,
+12205,
+11598,
+15200,
+18805,
+21902,
+24779,
+26499,
+25815,
+22827,
+20744,
+19733,
+19873,
+20502,
+18646,
+16805,
+15472,
+14090,
+12678,
+9645,
+5767,
+5128,
+7003,
+6470,
+5603,
+3206,
+65535,
+270,
+3149,
+7875,
+12960,
+17804,
+23871,
+30623,
+34464,
+36224,
+37913,
+38885,
+39225,
+44385,
+50190,
+53978,
+56754,
+57680,
+61248,
+62307,
+59214,
+55981,
+54346,
+54077,
+51783,
+54592,
+59787,
+59185,
+56893,
+55339,
+53537,
+50001,
+45530,
+41616,
+38446,
+37403,
+37087,
+39436,
+41984,
+42592,
+40449,
+37082,
+34378,
+30040,
 31211,
-31498,
-31528,
-31444,
-31450,
-31707,
-32216,
-32845,
-33400,
-33851,
-33637,
-33667,
-33005,
-32924,
-32714,
-32927,
-32950,
-33167,
-32816,
+34234,
+36212,
+37814,
+40593,
+43702,
+42818,
+41436,
+40435,
+39543,
+34710,
+32775,
+35910,
+38778,
+39357,
+38549,
+43943,
+47942,
+48205,
+46768,
+43253,
+42657,
+40120,
+38397,
+41740,
+45303,
+46588,
+45651,
+45832,
+45358,
+41723,
+39043,
+34119,
+30809,
+30706,
+28202,
+26792,
+25705,
+24998,
+23007,
+19505,
+15311,
+13166,
+15199,
+16638,
+16975,
+16082,
+13816,
+13684,
+14816,
+13078,
+10404,
+9858,
+9899,
+12646,
+16986,
+20031,
+23614,
+24839,
+24471,
+22614,
+21432,
+21287,
+20430,
+22125,
+24688,
+29548,
+32471,
+32380,
+34236,
+34597,
+35612,
+36852,
+37713,
+38177,
+37609,
+38709,
+39413,
+37538,
+34923,
+33256,
+31553,
+28205,
+28399,
+30769,
+30992,
+30947,
+31646,
+31507,
+29222,
+28920,
+29506,
+29182,
+31209,
+33074,
+32215,
+34616,
+37093,
+40311,
+45407,
+48137,
+51024,
+52118,
+51521,
+47218,
+44160,
+42679,
+38784,
+37072,
+36293,
+36754,
+38631,
+39595,
+39737,
+37274,
 32796,
-32554,
-32636,
-33005,
-33453,
-33878,
-34111,
-34117,
-34058,
-33932,
-34006,
-34247,
-34748,
-35302,
-35856,
-36467,
-36723,
-37051,
-36883,
-36651,
-36438,
-36119,
-36334,
-36542,
-37073,
-37414,
-37468,
-37256,
-36782,
-36437,
-36306,
-36570,
-37176,
-37761,
-38310,
-38421,
-38495,
-38393,
-38392,
-38682,
-38816,
-39156,
-38974,
-38681,
-38077,
-37466,
-37232,
-37016,
-37391,
-37703,
-37945,
-38179,
-37893,
-37596,
-37023,
-36670,
-36311,
-36407,
-36548,
-36883,
-37364,
-37415,
-37650,
+27873,
+24067,
+23925,
+23224,
+24307,
+26120,
+26504,
+29933,
+31718,
+30444,
+29016,
+28369,
+24713,
+23349,
+26179,
+27885,
+31854,
+35813,
+37428,
+37618,
+36707,
+34327,
+32438,
+32722,
+32123,
+29281,
+30162,
+32314,
+33382,
+34046,
+34998,
+37798,
+38690,
+36757,
+36487,
+38286,
+38530,
+36588,
+34618,
+34365,
+34982,
+36139,
+36848,
+38221,
+36458,
+32941,
+28862,
+27595,
+28279,
+25911,
+26697,
+27101,
+26777,
+27997,
+30611,
+35061,
+37105,
+37436,
+36498,
+37172,
+38262,
+38289,
+39462,
+37724,
+37872,
+39113,
+38171,
+37207,
+35713,
+31954,
+28606,
+25831,
+23507,
+24652,
+25913,
+25623,
+26779,
+27721,
+28678,
+30850,
+31885,
+32224,
+32582,
+33376,
+32475,
+31989,
+32578,
+32412,
+32338,
+33384,
+32853,
+33465,
+31675,
+28934,
+29745,
+27115,
+24637,
+23221,
+23711,
+25054,
+26924,
+27250,
+29047,
+32784,
+34912,
+37086,
+37434,
+38661,
+38895,
+38174,
+37106,
+37049,
+38927,
+42223,
+45885,
+48320,
+48584,
+48668,
+48561,
+46255,
+44841,
+43579,
+43306,
+41848,
+41249,
+39992,
+36543,
+34474,
+32196,
+27372,
+23833,
+21610,
+18489,
+15076,
+14215,
+14336,
+10766,
+7661,
+6136,
+6860,
+9523,
+11469,
+13750,
+14979,
+19346,
+24518,
+27443,
+34137,
+38584,
+41110,
+44867,
+49168,
+53139,
+55807,
+59751,
+59555,
+59405,
+61165,
+59702,
+56081,
+53112,
+51227,
+45565,
+40923,
+39904,
+38088,
+34207,
+26129,
+21057,
+17831,
+13569,
+10608,
+10274,
+13962,
+15178,
+17001,
+19802,
+21596,
+23810,
+24244,
+26518,
+30969,
+35114,
+37994,
+41416,
+45197,
+46478,
+46812,
+44716,
+45686,
+47438,
+47199,
+48664,
+49366,
+50432,
+46116,
+42664,
+39723,
+31245,
+27395,
+23076,
+19116,
+16680,
+15052,
+15720,
+11678,
+10110,
+11055,
+8322,
+9952,
+9518,
+9759,
+11847,
+9172,
+11133,
+15453,
+21150,
+24436,
+29138,
+37927,
+41390,
+44903,
+48292,
+48549,
+50609,
+51535,
+49966,
+49714,
+50394,
+53305,
+53552,
+52296,
+53386,
+49898,
+48907,
+48051,
+44291,
+43492,
+39648,
+36062,
+34235,
+30683,
+28003,
+25769,
+23691,
+23093,
+23370,
+23500,
+24034,
+24409,
+23025,
+22515,
+22012,
+22130,
+23559,
+27127,
+30960,
+33043,
+37944,
+41596,
+42471,
+45066,
+46031,
+45772,
+47798,
+47090,
+46286,
+45824,
+45899,
+43798,
+43114,
+42163,
 37366,
-37280,
-37257,
-37337,
-37836,
-38233,
-38658,
+35630,
+31436,
+28582,
+24894,
+21996,
+20023,
+17117,
+20134,
+20331,
+21467,
+24883,
+25467,
+28970,
+30041,
+31066,
+31719,
+35480,
+41458,
+42735,
+49510,
+52766,
+50497,
+52056,
+50838,
+47104,
+43549,
+40361,
 38839,
-38789,
-38367,
-38151,
-37602,
-37573,
-37283,
-37176,
-36704,
-36250,
-35438,
-34877,
-34353,
-34324,
-34432,
-34905,
-35330,
-35565,
-35858,
-35750,
-35832,
-35908,
-36122,
-36569,
-37072,
-37786,
-38284,
-38790,
-38971,
-39054,
-38840,
-38736,
-38522,
-38553,
-38495,
-38448,
-38071,
-37630,
-36830,
-36257,
-35747,
-35491,
-35405,
-35410,
-35116,
-34880,
-34326,
-34060,
-33904,
-34270,
-34857,
-35589,
-36335,
-36647,
-36888,
-36727,
-36730,
-36594,
-36836,
-37097,
-37441,
-37654,
-37730,
-37601,
-37468,
-37043,
-36890,
-36408,
-36124,
-35776,
-35170,
-35012,
-34458,
-34430,
-34273,
-34298,
-34246,
-34300,
-34218,
-34195,
-34218,
-34247,
-34404,
-34536,
-34907,
-35117,
-35620,
-35987,
-36440,
-36753,
-36888,
-36754,
-36464,
-36148,
-35988,
-35884,
-36121,
-36042,
-36120,
-35752,
-35380,
-34882,
-34588,
-34220,
-34114,
-33955,
-33877,
-33902,
-33956,
-34220,
-34430,
-34668,
-34855,
-34746,
-34802,
-34615,
+35546,
+33637,
+31078,
+28527,
+24846,
+18641,
+15665,
+13584,
+8676,
+4635,
+3485,
+3688,
+3067,
+2202,
+3567,
+2364,
+4013,
+4617,
+4751,
+7489,
+9685,
+12828,
+14182,
+16896,
+21252,
+23668,
+28446,
+30049,
+30682,
+31826,
+33080,
+34959,
+33277,
+35775,
+38104,
+43488,
+47362,
+48555,
+52228,
+52162,
+51533,
+49510,
+47536,
+46780,
+44785,
+44574,
+45574,
+47648,
+49655,
+48699,
+48423,
+46823,
+44617,
+44642,
+42587,
+42774,
+42676,
+40970,
+40999,
+42403,
+43283,
+43262,
+41848,
+40647,
+39503,
+38734,
+38805,
+37428,
+36053,
+34554,
+34719,
+36393,
+37540,
+37076,
+39011,
+36416,
+36865,
+36355,
+35205,
+37091,
+36477,
+39027,
+38197,
+40577,
+41573,
+41547,
+41845,
+38884,
+38291,
+37653,
+36102,
+36543,
+35673,
+36691,
+33429,
+33011,
+33574,
+32721,
+31409,
+26951,
+27161,
+27968,
+27404,
+28123,
+27156,
+28917,
+29505,
+26765,
+28481,
+26828,
+28252,
+25753,
+26908,
+29166,
+25817,
+26224,
+22569,
+20676,
+19812,
+16632,
+17128,
+16828,
+18321,
+21114,
+22031,
+24482,
+22403,
+22478,
+21744,
+19069,
+21824,
+21749,
+23013,
+22593,
+23922,
+23932,
+23643,
+19104,
+21019,
+22842,
+18959,
+21137,
+20047,
+21573,
+21584,
+23559,
+25524,
+28292,
+29861,
+33384,
+35659,
+41827,
+44625,
+43796,
+49778,
+49623,
+48925,
+52193,
+49786,
+47619,
+47185,
+45357,
+45137,
+40808,
+39438,
+39362,
+36570,
+36104,
+32544,
+31309,
+31824,
+30557,
+31998,
+31651,
+30597,
+30462,
+30009,
+32024,
+34036,
+34863,
+35918,
+37418,
+40715,
+40163,
+40120,
+41480,
+41869,
+43572,
+42971,
+44546,
+45949,
+44402,
+45637,
+45418,
+43623,
+43405,
+42073,
+43294,
+41285,
+40079,
+40112,
+36930,
+36812,
+33368,
+31662,
+30607,
+26628,
+26338,
+24958,
+24438,
+24741,
+23819,
+24909,
+25257,
+25516,
+22784,
+21007,
+21476,
+21661,
+21798,
+22493,
+24422,
+23935,
+27023,
+28084,
+29858,
+32568,
+31789,
+31839,
+32641,
+33266,
+32086,
+31453,
+32003,
+33073,
+31877,
+30313,
+28873,
+29617,
+29700,
+27667,
+28117,
+29127,
+29077,
+28722,
+28678,
+30216,
+30491,
+29124,
+28648,
+30417,
+31234,
+31005,
+30825,
+33106,
+36157,
+37335,
+37237,
+36630,
+39703,
+39110,
+38045,
+39048,
+37455,
+35482,
+35550,
+35383,
+36576,
+39073,
+39830,
+40300,
+38631,
+37499,
+33320,
+30966,
+28670,
+24422,
+24926,
+26453,
+26702,
+31134,
+33574,
+34751,
+35138,
+32287,
+33951,
+32796,
+32780,
+34504,
+35466,
+38896,
+42112,
+46427,
+47790,
+46899,
+47223,
+43993,
+41232,
+39324,
+36615,
+36600,
+36332,
+36143,
+33707,
+33669,
+34209,
+29289,
+28615,
+28160,
+26720,
+27833,
+27079,
+26432,
+26453,
+25648,
+24429,
+24613,
+25368,
+23875,
+23075,
+23706,
+23249,
+25338,
+29449,
+30487,
+32409,
+33803,
+34713,
+32481,
+32719,
+32847,
+30541,
+32104,
+31570,
+33550,
+33464,
+31689,
+30891,
+28845,
+27879,
+26262,
+25760,
+25678,
+25737,
+28652,
+29454,
+29899,
+31726,
+31080,
+30982,
+30158,
+32613,
+33787,
+34349,
+38505,
+40592,
+42699,
+46351,
+46185,
+44697,
+43253,
+42175,
+42987,
+41989,
+43092,
+42411,
+42497,
+44527,
+43919,
+42419,
+37512,
+31733,
+31373,
+28448,
+25294,
+24911,
+23682,
+24649,
+24400,
+25083,
+23766,
+22290,
+22580,
+21483,
+22544,
+24382,
+24517,
+27516,
+29029,
+32970,
+37678,
+38464,
+40320,
+41414,
+42546,
+41935,
+41300,
+40832,
+38815,
+38383,
+38948,
+38021,
+36978,
+36459,
+33685,
+32712,
+31362,
+28493,
+27219,
+25322,
+25117,
+22922,
+23206,
+22012,
+21036,
+23218,
+21692,
+23605,
+23514,
+23266,
+26216,
+25859,
+29348,
+29905,
+33326,
+34481,
+32122,
+38295,
+35981,
+36877,
+38631,
+35316,
+37192,
+36992,
+38603,
+37622,
+35868,
+36147,
+32873,
+31489,
+31619,
+29967,
+28498,
+28759,
+27153,
+27916,
+28930,
+28882,
+29228,
+27444,
+27132,
+28968,
+29710,
+29922,
+31221,
+34705,
+34821,
+36104,
+39354,
+41063,
+43048,
+43541,
+43322,
+44239,
+43762,
+43184,
+41606,
+42327,
+40843,
+39942,
+41648,
+36927,
+37894,
 34826,
-34935,
-35141,
-35384,
-35380,
-35646,
-35646,
-35830,
-35936,
-35858,
+33630,
+33334,
+30344,
+29165,
+25599,
+26405,
+26780,
+25886,
+25030,
+24903,
+27786,
+28135,
+29035,
+32452,
+31439,
+32138,
+34401,
+35667,
+37387,
+40259,
+42081,
+42253,
+43795,
+44034,
+43170,
+43422,
+42376,
+41107,
+41389,
+40979,
+39770,
+38075,
+38027,
 35697,
-35303,
-34958,
-34617,
-34483,
-34404,
-34459,
-34348,
-34250,
-33873,
-33693,
-33322,
-33399,
-33166,
-33399,
-33216,
-33377,
-33502,
-33644,
-34083,
-34249,
-34719,
-34697,
-34851,
-34803,
-34746,
-34933,
-34906,
-35065,
-35170,
-35117,
-35040,
-34930,
-34565,
-34403,
-33956,
-33665,
-33270,
-33002,
-32691,
-32501,
-32161,
-31843,
-31472,
-31289,
-30997,
-31132,
-30890,
-31052,
-30839,
-30865,
-30867,
-30998,
-31418,
-31741,
-32314,
-32375,
-32633,
-32451,
-32555,
-32239,
-32346,
-32106,
-32055,
-31921,
-31606,
-31525,
-31053,
-30889,
-30314,
-29781,
-29388,
-28753,
-28648,
-28250,
-28279,
-28119,
-27988,
-28039,
-27936,
-28276,
-28437,
-28913,
-29200,
-29415,
-29412,
-29467,
-29439,
-29732,
-29966,
-30366,
-30468,
-30470,
-30206,
-29809,
-29441,
-29121,
-28914,
-28618,
-28599,
-28247,
-28044,
-27668,
-27328,
-26984,
-26904,
-26483,
-26587,
-26272,
-26454,
-26404,
-26640,
-26826,
-27195,
-27300,
-27697,
-27592,
-27749,
-27592,
-27510,
-27434,
-27381,
-27352,
-27407,
-27274,
-27168,
-27013,
-26796,
-26722,
-26506,
-26511,
-26269,
-26220,
-25951,
-25931,
-25765,
-26064,
-26004,
-26377,
-26193,
-26321,
-26062,
-26032,
-26034,
-26164,
-26379,
-26663,
-26962,
-27244,
-27515,
-27669,
-27934,
-27963,
-28143,
-28202,
-28275,
-28623,
-28672,
-29046,
-28935,
-28916,
-28776,
-28491,
-28461,
-28252,
-28358,
-28198,
-28199,
-28039,
-28014,
-28147,
-28330,
-28753,
-28965,
-29148,
-29178,
-29095,
+33874,
+32788,
+28800,
+28677,
+25747,
+22226,
+23051,
+22349,
+20644,
+18486,
+18648,
+19215,
+18987,
+19705,
+21287,
+21041,
+21148,
+20209,
+22553,
+23792,
+23917,
+26104,
+28254,
+29658,
+29725,
+31039,
+30913,
+30217,
+29847,
+32941,
+33654,
+35592,
+36102,
+36891,
+36545,
+36438,
+38453,
+36413,
+38853,
+37264,
+37271,
+38923,
+36155,
+36752,
+34568,
+34637,
+35581,
+34466,
+38083,
+38339,
+38875,
+38785,
+37955,
+38007,
+36323,
+36631,
+33876,
+33507,
+34541,
+34701,
+34013,
+34310,
+35698,
+32456,
+32862,
+33135,
+31806,
+32653,
+30664,
+31320,
+32745,
+35696,
+34555,
+33994,
+35980,
+35021,
+37597,
+34240,
+37832,
+36520,
+35206,
+36294,
+34260,
+37371,
+34981,
+34547,
+34334,
+34150,
+34256,
+30949,
+31549,
+32934,
+32884,
+31278,
+32769,
+33872,
+35739,
+35000,
+32328,
+33211,
+31572,
+30985,
+31385,
+29789,
+34246,
+35007,
+36268,
+37234,
+36855,
+35005,
+30717,
+32343,
+28297,
+28987,
+29331,
+27691,
+26961,
+29445,
+30172,
+28331,
+28010,
+26728,
+25637,
+24814,
+23037,
+23463,
+25365,
+25803,
+26505,
+25762,
+26293,
+24385,
+26009,
+27478,
+25327,
+25906,
+27282,
+27740,
+27581,
+28117,
+29715,
+27675,
+26607,
+28909,
+26593,
+29610,
+30883,
+30524,
+35538,
+33824,
+34743,
+36836,
+36730,
+38213,
+37995,
+38790,
+38718,
+38314,
+41205,
+38850,
+37953,
+39980,
+37272,
+38305,
+35467,
+35591,
+34668,
+33154,
+36040,
+33930,
+34185,
+36362,
+34640,
+33918,
+34974,
+36703,
+35289,
+35094,
+37252,
+36807,
+38132,
+39488,
+40445,
+41532,
+42570,
+41021,
+42568,
+41911,
+41158,
+42269,
+40928,
+39659,
+39516,
+40856,
+40023,
+38252,
+40304,
+36834,
+36689,
+34478,
+32305,
+33153,
+28921,
+28772,
+23230,
+24055,
+27800,
+22142,
+24223,
+24798,
+22658,
+27050,
+23514,
+28940,
+24949,
+25013,
+28803,
+26056,
+34287,
+31968,
+33938,
+37862,
+37196,
+39273,
+39047,
+39078,
+39678,
+37032,
+40079,
+35791,
+34182,
+35011,
+33477,
+33759,
+32009,
+31862,
+30016,
+28716,
+27455,
+27409,
+25585,
+23605,
+23848,
+20973,
+21293,
+23164,
+23536,
+25124,
+25914,
+28022,
+25012,
+28598,
+30589,
+30010,
+31991,
+32118,
+34244,
+33054,
+31637,
+32754,
+34741,
+31306,
+27905,
+28844,
+30260,
+28500,
+29502,
+30434,
+27030,
+26510,
+26056,
+25596,
+27263,
+27641,
+25140,
+25864,
+28056,
+26545,
+31084,
+34162,
 28911,
-29045,
-29070,
-29360,
-29705,
-30046,
-30311,
-30709,
-30864,
-31210,
-31157,
-31260,
-31053,
-31074,
-31054,
-31153,
-31265,
-31391,
-31212,
-31207,
-30894,
-30732,
-30735,
-30601,
-30840,
-30839,
-31077,
-31315,
-31632,
-32105,
-32453,
-32658,
-32797,
-32580,
-32531,
-32396,
-32372,
+31047,
+32795,
+34450,
+39181,
+38436,
+39664,
+40524,
+39031,
+38397,
+39055,
+40474,
+38674,
+37629,
+39499,
+38684,
+37068,
+40812,
+39438,
+38384,
+39479,
+35917,
+36301,
+36105,
+35464,
+35487,
+35509,
+35101,
+34538,
+33526,
+34394,
+32670,
 32502,
-32478,
-32687,
-32820,
-33084,
-33348,
-33719,
-33769,
-33930,
-33717,
-33665,
-33667,
-33847,
-34407,
-34956,
-35516,
-35909,
-36067,
-36229,
-36249,
-36257,
-36251,
-36147,
-36095,
-35725,
-35776,
-35543,
-35801,
-35780,
-35776,
-35461,
-34987,
-34507,
-34303,
-34242,
-34619,
-34878,
-35275,
-35384,
-35643,
-35727,
-36093,
-36306,
-36808,
+34164,
+32199,
+32554,
+31688,
+31037,
+31955,
+35694,
+31651,
+30671,
+32373,
+31098,
+31741,
+32147,
+34203,
+34693,
+35953,
+35536,
+38307,
+38596,
+36775,
+36802,
+37099,
+37180,
+41342,
+43096,
+42272,
+44002,
+43289,
+44266,
+43989,
+41213,
+41223,
+41574,
+39903,
+39405,
+38490,
+38907,
+38569,
+37293,
+36299,
+33785,
+37530,
+35462,
+32656,
+32177,
+31304,
+31868,
+26290,
+27057,
+28304,
+25856,
+25461,
+23209,
+25645,
+24842,
+23298,
+22292,
+21533,
+22121,
+21379,
+21292,
+21243,
+22953,
+22743,
+20930,
+22629,
+21567,
+21645,
+23246,
+23535,
+24367,
+28328,
+26450,
+28577,
+29392,
+27126,
+30047,
+26550,
+32484,
+29956,
+30074,
+34012,
+32137,
+34559,
+34912,
+34938,
+34759,
+34763,
+35547,
+36460,
+38872,
+36109,
+36041,
+38545,
+35807,
+36891,
+34629,
+35667,
+32483,
+30360,
+29955,
+26146,
+30637,
+29732,
+27750,
+30448,
+28665,
+28367,
+29059,
+30972,
+29105,
+27257,
+29088,
+28901,
+32058,
+33912,
+32555,
+34499,
+36424,
+34129,
+33136,
+33727,
+35099,
+34993,
+34365,
+36966,
+36737,
+36275,
+36535,
+36738,
+37234,
+35389,
+36411,
+36287,
+36819,
 36807,
-37124,
-37152,
-37467,
-37838,
-38391,
-38789,
-39078,
-39000,
-38708,
-38129,
-37545,
-36811,
-36143,
-35491,
-34717,
-34436,
-33871,
-34014,
-33844,
-34039,
-33979,
-33906,
-33925,
-34170,
-34720,
-35566,
-36598,
-37281,
-38181,
-38472,
-38945,
-39265,
-39553,
-39924,
-39817,
-39607,
-39211,
-38735,
-38471,
-38233,
-37892,
-37492,
-36625,
-35590,
-34407,
-33347,
-32767,
-32266,
-32106,
-31897,
-31843,
-31762,
-31950,
-32290,
-32875,
-33558,
-34114,
-34590,
-34930,
-35359,
-35747,
-36336,
-36858,
-37230,
-37416,
-37202,
-36784,
-36065,
-35357,
-34561,
-33853,
-33318,
-32797,
-32473,
-32083,
-31763,
-31262,
-30839,
-30363,
-30155,
-30018,
-30209,
-30520,
-30867,
-31393,
-31843,
-32398,
-32952,
-33402,
-33821,
-34116,
-34138,
-34275,
-34245,
-34219,
-34380,
-34137,
-34196,
-33742,
-33377,
-32792,
-32319,
-31789,
-31209,
-30788,
-30390,
-30257,
-30367,
-30519,
-30869,
-30942,
+36154,
+38138,
+38577,
+37156,
+36244,
+35413,
+38777,
+39919,
+38625,
+37095,
+39070,
+40274,
+37511,
+39021,
+39487,
+40528,
+39771,
+40116,
+41640,
+42010,
+42558,
+41361,
+42246,
+42595,
+40311,
+40397,
+40173,
+38617,
+39086,
+39538,
+35981,
+32414,
+35599,
+34997,
+34059,
+35361,
+31442,
+29795,
+28700,
+26634,
+27689,
+24248,
+20669,
+20106,
+21036,
+21360,
+20671,
+23442,
+22965,
+23130,
+23204,
+22877,
+24218,
+24041,
+24440,
+26904,
+29966,
+29802,
+31680,
+34873,
+35033,
+33527,
+33829,
+32822,
+31995,
+34168,
+33023,
+34439,
+33766,
+32338,
+32746,
+31756,
+30341,
+27620,
+25282,
+24786,
+26517,
+26453,
+25799,
+24887,
+23309,
+24208,
+26937,
+27610,
+25655,
+25045,
+25536,
+23337,
+25257,
+30255,
+28773,
 31106,
-30837,
-30868,
-30812,
-31024,
+31492,
+31658,
+34783,
+36577,
+37046,
+35220,
+37803,
+36358,
+34823,
+37945,
+36766,
+37025,
+37425,
+34306,
+36415,
+36421,
+33947,
+34622,
+33499,
+34297,
+31584,
+33157,
+34389,
+28524,
+29738,
+31394,
+33368,
+32132,
+28514,
+31818,
+32662,
+34036,
+36354,
+35915,
+37856,
+38637,
+38653,
+40760,
+43067,
+44108,
+42511,
+42909,
+48528,
+48073,
+46194,
+46461,
+46543,
+46479,
+43187,
+41881,
+42166,
+44190,
+41661,
+35565,
+38033,
+38288,
+33576,
+32972,
+34218,
+32949,
+31003,
+32380,
+29763,
+27594,
+29236,
+28449,
+24870,
+23660,
+25087,
+25702,
+26326,
+27452,
+27562,
+28701,
+27864,
+25869,
+30335,
+31611,
+27427,
+30580,
+35134,
+31687,
+30876,
+33581,
+34537,
+35385,
+34209,
+33242,
+31635,
+29724,
+29063,
+29374,
+31586,
+29341,
+28639,
+28021,
+28474,
+30027,
+28223,
+29347,
+29143,
+28553,
+27496,
+28995,
+31489,
+31980,
+33816,
+34520,
+34323,
+34669,
+35345,
+36076,
+34074,
+33830,
+34981,
+34407,
+35472,
+34474,
+34064,
+32868,
+32678,
+31519,
+30295,
+31226,
+30680,
+28419,
+27842,
+24167,
+22642,
+22286,
+21010,
+24319,
+24146,
+27061,
+26352,
+28365,
+31595,
+30274,
+30555,
+26891,
+29702,
+31337,
+31682,
+33865,
+35035,
+38388,
+39529,
+38123,
+40301,
+42683,
+40472,
+39905,
+39553,
+37070,
+35176,
+36007,
+35103,
+35805,
+35048,
+30741,
+32012,
+33451,
+30205,
+27994,
+29211,
+29037,
+31213,
+30737,
+30801,
+31840,
+32244,
+32741,
+32885,
+38104,
+35127,
+30590,
+33224,
+34895,
+36942,
+35640,
+36030,
+35962,
+34121,
+35251,
+32614,
+33125,
+33969,
+33290,
+36582,
+34942,
+34165,
+33859,
+32218,
+32831,
+29223,
+31586,
+31951,
+30921,
+33506,
+32044,
+34314,
+33348,
+32347,
+34738,
+37361,
+42104,
+40508,
+38542,
+40546,
+39833,
+37780,
+34618,
+32494,
+32582,
+36100,
+36883,
+37308,
+40423,
+40325,
+38856,
+40376,
+41255,
+33279,
+29857,
+31189,
+29824,
 31500,
-31843,
+31716,
+30294,
+31147,
+30980,
+28574,
+29170,
+28781,
+24618,
+22511,
+24732,
+26333,
+26656,
+29407,
+29771,
+29953,
+31981,
+31731,
+32413,
+34975,
+35398,
+32699,
+33663,
+37788,
+39076,
+38945,
+36187,
+35331,
+35001,
+35301,
+37476,
+34052,
+31921,
+31816,
+31221,
+32285,
+31957,
+29750,
+25328,
+23918,
+23616,
+22073,
+22508,
+23061,
+24715,
+25449,
+24866,
+24197,
+24901,
+24812,
+23611,
+25275,
+26640,
+29390,
+31276,
+32872,
+36207,
+35734,
+37313,
+38662,
+38391,
+39787,
+39807,
+41070,
+40628,
+41924,
+42216,
+39170,
+38599,
+38156,
+38581,
+37220,
+34987,
+32562,
+29932,
+29409,
+28823,
+27557,
+27804,
+27147,
+26817,
+26645,
+26581,
+26808,
+26481,
+26696,
+27473,
+29559,
+30316,
+33252,
+34759,
+34887,
+35422,
+35556,
+36633,
+36439,
+38142,
+39206,
+38706,
+38546,
+36887,
+36443,
+34094,
+32878,
+33449,
+31538,
+31000,
+31357,
+32044,
+33078,
+33908,
+33274,
+31984,
+30926,
+30508,
+30851,
+30904,
+31560,
+31461,
+33005,
+34183,
+34543,
+35988,
+36604,
+37452,
+37841,
+38785,
+39655,
+40136,
+40560,
+41027,
+40370,
+39973,
+40643,
+40263,
+39361,
+38707,
+38586,
+38600,
+39106,
+38170,
+37907,
+37245,
+34842,
+35006,
+34128,
+32378,
+31469,
+31578,
+31431,
+30940,
+30714,
+31103,
+32421,
+31968,
+31440,
+31341,
+30439,
+30193,
+29942,
+29728,
+31117,
+31840,
+32228,
+33708,
+34714,
+33902,
+33032,
+33020,
+32489,
 32343,
+32435,
+31782,
+30752,
+29140,
+28916,
+28917,
+27158,
+24371,
+21924,
+20481,
+18408,
+16759,
+15280,
+14064,
+12702,
+11319,
+9875,
+9268,
+9087,
+8522,
+8650,
+8598,
+9141,
+10040,
+10035,
+9371,
+8419,
+9620,
+13801,
+15478,
+18011,
+22360,
+26970,
+33402,
+38548,
+43795,
+49137,
+54035,
+57933,
+61751,
+65272,
+65534,
+65479,
+65534,
+65497,
+65534,
+65530,
+65514,
+65534,
+64795,
+62511,
+60660,
+60498,
+59786,
+58469,
+58623,
+58392,
+58106,
+57477,
+55168,
+52337,
+49196,
+46222,
+43557,
+39278,
+35342,
+31439,
+28257,
+26958,
+23830,
+21817,
+21048,
+20600,
+22062,
+23287,
+25356,
+28697,
+31359,
+33028,
+32652,
+33063,
+32457,
+31963,
+29685,
+24474,
+21195,
+16244,
+11783,
+7538,
+2713,
+244,
+65535,
+46,
+65535,
+14,
+65535,
+65535,
+12,
+65535,
+17,
+65535,
+65535,
+36,
+65535,
+166,
+65535,
+4886,
+15977,
+25923,
+36786,
+45108,
+54012,
+63936,
+65534,
+65365,
+65534,
+65443,
+65534,
+65494,
+65534,
+65517,
+65534,
+65504,
+65534,
+65477,
+65534,
+65470,
+65534,
+65457,
+60602,
+53696,
+45878,
+37856,
+30427,
+24357,
+19537,
+13200,
+6201,
+873,
+65535,
+68,
+65535,
+14,
+15,
+65535,
+1086,
+7895,
+16665,
+24023,
+32664,
+39726,
+47176,
+58203,
+65073,
+65534,
+65489,
+65534,
+65507,
+65534,
+65533,
+65512,
+65534,
+65448,
+65534,
+64351,
+59666,
+55296,
+50461,
+43623,
+36038,
+28129,
+21940,
+17369,
+11999,
+4043,
+65535,
+139,
+65535,
+16,
+7,
+65535,
+20,
+65535,
+9,
+65535,
+65535,
+3,
+65535,
+65535,
+28,
+65535,
+101,
+65535,
+252,
+65535,
+2697,
+16080,
+31617,
+46243,
+58995,
+65249,
+65534,
+65473,
+65534,
+65493,
+65534,
+65514,
+65534,
+65526,
+65534,
+65521,
+65534,
+65493,
+65534,
+65440,
+65534,
+65104,
+62689,
+59038,
+53523,
+48941,
+43520,
+37545,
+32040,
+27439,
+23565,
+16816,
+7944,
+1154,
+65535,
+84,
+65535,
+16,
+8,
+65535,
+52,
+65535,
+1092,
+9659,
+20115,
+28410,
+40091,
+52402,
+62442,
+65534,
+65318,
+65534,
+65471,
+65534,
+65510,
+65534,
+65509,
+65534,
+65518,
+65525,
+65496,
+61720,
+57202,
+51393,
+44305,
+39573,
+34662,
+32881,
+32324,
+28712,
+24093,
+18748,
+13223,
+9341,
+5455,
+897,
+65535,
+105,
+65535,
+50,
+65535,
+20,
+65535,
+65535,
+13,
+65535,
+49,
+65535,
+106,
+65535,
+197,
+65535,
+1380,
+14737,
+31387,
+43433,
+56349,
+65308,
+65534,
+65455,
+65534,
+65457,
+65534,
+65485,
+65534,
+65514,
+65534,
+65534,
+65520,
+65534,
+65492,
+65534,
+65439,
+65534,
+64924,
+61376,
+57695,
+53641,
+47957,
+41182,
+33989,
+26366,
+16557,
+4796,
+65535,
+156,
+65535,
+41,
+65535,
+27,
+65535,
+60,
+65535,
+124,
+65535,
+1776,
+14843,
+31079,
+46145,
+61225,
+65534,
+65283,
+65534,
+65458,
+65534,
+65534,
+65497,
+65534,
+65472,
+65534,
+65485,
+65534,
+65249,
+58106,
+48023,
+39903,
+33015,
+28523,
+25590,
+23678,
+21063,
+17901,
+15440,
+13955,
+11605,
+8720,
+5549,
+1233,
+65535,
+100,
+65535,
+40,
+65535,
+15,
+65535,
+7,
+65535,
+1,
+10,
+65535,
+66,
+65535,
+229,
+65535,
+3665,
+18472,
+34429,
+46992,
+59909,
+65534,
+65309,
+65534,
+65504,
+65527,
+65534,
+65502,
+65534,
+65504,
+65534,
+65514,
+65534,
+65534,
+65513,
+65534,
+65438,
+65534,
+61565,
+54213,
+50362,
+45689,
+39377,
+32477,
+25090,
+17852,
+6776,
+65535,
+104,
+65535,
+10,
+11,
+65535,
+30,
+65535,
+70,
+65535,
+193,
+65535,
+5241,
+20415,
+36755,
+54397,
+65202,
+65534,
+65512,
+65534,
+65490,
+65534,
+65501,
+65534,
+65506,
+65534,
+65468,
+65534,
+65344,
+65534,
+62764,
+52757,
+43331,
+35651,
+29211,
+24449,
+20069,
+16503,
+14410,
+12952,
+11792,
+11074,
+9698,
+6760,
+2708,
+119,
+65535,
+20,
+65535,
+17,
+65535,
+8,
+1,
+65535,
+19,
+65535,
+33,
+65535,
+15,
+19,
+65535,
+213,
+65535,
+5795,
+18325,
+30662,
+44581,
+58627,
+65534,
+65446,
+65534,
+65534,
+65491,
+65534,
+65501,
+65534,
+65526,
+65531,
+65534,
+65516,
+65534,
+65384,
+63179,
+59025,
+54175,
+50383,
+48054,
+45248,
+41007,
+35328,
+29490,
+22487,
+14273,
+8806,
+4952,
+813,
+65535,
+114,
+65535,
+113,
+65535,
+213,
+65535,
+2543,
+11216,
+21557,
+35542,
+51297,
+63386,
+65534,
+65277,
+65534,
+65427,
+65534,
+65492,
+65534,
+65520,
+65534,
+65534,
+65498,
+65534,
+65381,
+65534,
+61158,
+51418,
+44838,
+38813,
 32743,
-32923,
-33272,
-33398,
-33667,
-33585,
-33558,
-33245,
-33134,
-32903,
-32816,
-32929,
-32712,
-32820,
-32452,
-32185,
-32001,
-31554,
-31656,
-31342,
-31658,
-31552,
-32001,
-32135,
-32581,
-32899,
-33243,
-33374,
-33534,
-33532,
-33586,
-33824,
-34086,
-34540,
-34902,
-35173,
-35432,
-35411,
-35669,
-35516,
-35749,
-35646,
-35594,
-35565,
-35355,
-35330,
-35247,
-35041,
-35062,
-34698,
-34534,
-34010,
-33742,
-33403,
-33267,
-33166,
-33293,
-33455,
-33690,
-34088,
-34404,
-34882,
-35272,
-35782,
-36169,
-36653,
-36989,
-37524,
-37729,
-38341,
-38390,
-38763,
-38787,
-38817,
-38759,
-38605,
-38549,
-38393,
-38259,
-37972,
-37490,
-37102,
-36593,
-36175,
-35990,
-35537,
-35385,
-34904,
-34642,
-34300,
-34191,
-34169,
-34456,
-34643,
-35063,
-35384,
-35774,
-36098,
-36593,
-37048,
-37545,
-38104,
-38441,
-38713,
-38864,
-38685,
-38759,
-38553,
-38470,
-38339,
-38049,
-37757,
-37258,
-36701,
-36200,
-35540,
-35171,
-34588,
-34353,
-33927,
-33878,
-33559,
-33586,
-33480,
-33585,
-33745,
-33770,
-34114,
-34168,
-34507,
-34673,
-34848,
-35069,
-35194,
-35330,
-35434,
-35302,
-35409,
-34957,
-34908,
-34403,
-34010,
-33637,
-33297,
-33160,
-32982,
-32871,
-32636,
-32397,
-32106,
-31660,
-31656,
-31238,
-31392,
-31131,
-31156,
-30997,
-31000,
-31074,
-31159,
-31472,
-31578,
-31687,
-31681,
-31687,
-31683,
-31711,
-31632,
-31685,
-31392,
-31211,
-30732,
-30313,
-29940,
-29440,
-29176,
-28700,
-28490,
-28118,
-28015,
-27985,
-27913,
-28166,
-27888,
-28167,
-27805,
-27829,
-27669,
-27514,
-27511,
-27538,
-27512,
-27697,
-27670,
-27831,
-27721,
-27777,
-27617,
-27512,
-27355,
-27167,
-26986,
-26796,
-26617,
-26375,
-26086,
-25849,
-25425,
-25215,
-24925,
-24791,
-24739,
-24714,
-24711,
-24768,
-24685,
+28144,
+23830,
+21339,
+19330,
+17710,
+17422,
+16658,
+14763,
+12597,
+9378,
+5291,
+1871,
+65535,
+0,
+14,
+65535,
+19,
+65535,
+16,
+65535,
+27,
+65535,
+54,
+65535,
+74,
+65535,
+42,
+1,
+166,
+11007,
+26888,
+41422,
+57872,
+65534,
+65430,
+65534,
+65525,
+65522,
+65534,
+65505,
+65534,
+65502,
+65534,
+65492,
+65534,
+65474,
+65534,
+65218,
+61506,
+55693,
+49458,
+45646,
+43412,
+39565,
+32972,
+25806,
+20380,
+14314,
+7664,
+1834,
+65535,
+95,
+65535,
+2,
+28,
+65535,
+67,
+65535,
+75,
+65535,
+467,
+10205,
+25129,
+38571,
+54137,
+64807,
+65534,
+65439,
+65534,
+65472,
+65534,
+65501,
+65534,
+65503,
+65534,
+65450,
+65534,
+65303,
+65534,
+62985,
+53007,
+44493,
+37690,
+29977,
+23716,
+20415,
+18240,
+17069,
+16985,
+16954,
+17318,
+18453,
+18474,
+17590,
+15294,
+11122,
+6674,
+1439,
+65535,
+157,
+65535,
+55,
+65535,
+65535,
+33,
+65535,
+67,
+65535,
+45,
+16,
+65535,
+330,
+65535,
+10389,
+29945,
+49799,
+64865,
+65534,
+65386,
+65534,
+65382,
+65534,
+65442,
+65534,
+65499,
+65534,
+65533,
+65518,
+65534,
+65459,
+65534,
+63971,
+58788,
+52769,
+46972,
+41912,
+39032,
+36128,
+32326,
+28031,
+22617,
+16659,
+8199,
+1049,
+65535,
+79,
+65535,
+12,
+14,
+65535,
+41,
+65535,
+8,
+24,
+241,
+10495,
+26220,
+42539,
+60440,
+65534,
+65213,
+65534,
+65428,
+65534,
+65515,
+65534,
+65507,
+65534,
+65408,
+65534,
+65198,
+65534,
+61948,
+46461,
+32282,
+20963,
+11147,
+2927,
+65535,
+186,
+65535,
+74,
+65535,
+1828,
+5882,
+9950,
+13979,
+17023,
+17233,
+15884,
+14071,
+10130,
+3467,
+65535,
+101,
+65535,
+10,
+10,
+65535,
+43,
+65535,
+90,
+65535,
+149,
+65535,
+171,
+65535,
+1133,
+17222,
+36314,
+53522,
+65384,
+65471,
+65518,
+65534,
+65449,
+65534,
+65462,
+65534,
+65491,
+65534,
+65511,
+65534,
+65534,
+65496,
+65534,
+62970,
+60258,
+58694,
+53922,
+49156,
+47919,
+46636,
+42151,
+36940,
+33123,
+26395,
+16106,
+6505,
+605,
+65535,
+61,
+65535,
+16,
+65535,
+18,
+65535,
+101,
+65535,
+7150,
+21607,
+38087,
+57147,
+65534,
+65325,
+65534,
+65511,
+65509,
+65534,
+65456,
+65534,
+65449,
+65534,
+65513,
+65469,
+65534,
+56547,
+41495,
+27217,
+12931,
+2829,
+65535,
+102,
+65535,
+65535,
+100,
+65535,
+1435,
+7422,
+13772,
+18721,
+23394,
+27619,
+28575,
+26411,
+24249,
+19807,
+13939,
+6424,
+193,
+65535,
+64,
+65535,
+57,
+65535,
+9,
+19,
+65535,
+65,
+65535,
+75,
+65535,
+522,
+11188,
+25942,
+36611,
+46894,
+58189,
+65240,
+65534,
+65475,
+65534,
+65474,
+65534,
+65492,
+65534,
+65527,
+65505,
+65534,
+64743,
+63844,
+63443,
+64560,
+65534,
+65534,
+65054,
+62993,
+62503,
+60297,
+55246,
+50483,
+44964,
+36344,
+24111,
+13979,
+7428,
+1597,
+65535,
+142,
+65535,
+65535,
+138,
+65535,
+5375,
+16542,
+26879,
+39172,
+54480,
+64837,
+65534,
+65431,
+65534,
+65482,
+65534,
+65534,
+65430,
+65534,
+65293,
+65534,
+63863,
+52382,
+41108,
+32707,
+27302,
+22031,
+16137,
+14255,
+14236,
+14987,
+17123,
+23004,
+28954,
+32681,
+36466,
+40069,
+43791,
+46844,
+48222,
+47572,
+42837,
+35347,
+28018,
+20322,
+10425,
+1377,
+65535,
+189,
+65535,
+83,
+65535,
+23,
+65535,
+5,
+65535,
+36,
+65535,
+125,
+65535,
+293,
+65535,
+2465,
+15559,
+28680,
+40497,
+54432,
+64514,
+65534,
+65363,
+65534,
+65445,
+65534,
+65496,
+65534,
+65527,
+65531,
+65534,
+65520,
+65534,
+65522,
+65534,
+65534,
+65484,
+65534,
+65324,
+65534,
+61735,
+49934,
+38244,
+28265,
+14070,
+1235,
+65535,
+204,
+65535,
+163,
+65535,
+144,
+65535,
+145,
+65535,
+748,
+11177,
+25848,
+40822,
+56893,
+65355,
+65534,
+65496,
+65534,
+65512,
+65534,
+65534,
+65481,
+65534,
+65430,
+65534,
+64611,
+55270,
+46074,
+41718,
+37016,
+33709,
+31900,
+31934,
+32487,
+33100,
+35232,
+38211,
+41767,
+43564,
+43839,
+42707,
+39507,
+36829,
+34320,
+28503,
+19777,
+8632,
+474,
+65535,
+87,
+65535,
+68,
+65535,
+36,
+65535,
+1,
+16,
+65535,
+38,
+65535,
+30,
+65535,
+65535,
+169,
+65535,
+7099,
+20281,
+33029,
+46392,
+57543,
+64819,
+65534,
+65400,
+65534,
+65458,
+65534,
+65501,
+65534,
+65521,
+65534,
+65518,
+65534,
+65514,
+65534,
+65534,
+65482,
+65534,
+65287,
+65534,
+60340,
+47968,
+37187,
+25984,
+12681,
+1722,
+65535,
+174,
+65535,
+72,
+65535,
+26,
+65535,
+50,
+65535,
+194,
+65535,
+6737,
+24745,
+40310,
+53891,
+64428,
+65534,
+65393,
+65534,
+65460,
+65534,
+65517,
+65527,
+65534,
+65522,
+65519,
+65534,
+65384,
+65534,
+60743,
+54631,
+52261,
+47569,
+44573,
+43076,
+42949,
+41853,
+37733,
+35527,
+34919,
+33159,
+28252,
+23581,
+19944,
+14146,
+7107,
+1302,
+65535,
+105,
+65535,
+38,
+65535,
+9,
+65535,
+65535,
+5,
+65535,
+7,
+65535,
+7,
+65535,
+65535,
+17,
+65535,
+72,
+65535,
+202,
+65535,
+2630,
+13657,
+25680,
+37276,
+50919,
+62760,
+65534,
+65344,
+65534,
+65468,
+65534,
+65519,
+65534,
+65534,
+65523,
+65534,
+65514,
+65534,
+65501,
+65534,
+65495,
+65534,
+65534,
+65459,
+65534,
+59095,
+47363,
+37208,
+26742,
+11303,
+249,
+65535,
+55,
+65535,
+112,
+65535,
+138,
+65535,
+163,
+65535,
+828,
+9790,
+22431,
+36395,
+49720,
+60639,
+65534,
+65409,
+65534,
+65533,
+65516,
+65534,
+65525,
+65524,
+65534,
+65459,
+65534,
+64389,
+60667,
+59033,
+58580,
+57694,
+58481,
+58494,
+55998,
+54318,
+53578,
+52062,
+48735,
+43547,
+36992,
+28992,
+20470,
+11991,
+4080,
+27,
+1,
+15,
+65535,
+23,
+65535,
+16,
+65535,
+7,
+65535,
+2,
+65535,
+65535,
+0,
+0,
+1,
+65535,
+2,
+65535,
+65535,
+8,
+65535,
+32,
+65535,
+73,
+65535,
+136,
+65535,
+1000,
+11263,
+26411,
+41807,
+57608,
+65534,
+65482,
+65530,
+65534,
+65494,
+65534,
+65497,
+65534,
+65506,
+65534,
+65507,
+65534,
+65508,
+65534,
+65534,
+65491,
+65534,
+60825,
+52469,
+44561,
+36290,
+28969,
+21755,
+11249,
+1754,
+65535,
+159,
+65535,
+108,
+65535,
+79,
+65535,
+397,
+7233,
+16309,
+23713,
+31911,
+41388,
+50024,
+55551,
+61839,
+65534,
+65438,
+65534,
+65529,
+65520,
+65534,
+65511,
+65534,
+65518,
+65534,
+65532,
+65524,
+65534,
+65490,
+65534,
+65414,
+65534,
+63729,
+55773,
+46419,
+36609,
+25661,
+15406,
+5058,
+65535,
+93,
+65535,
+65535,
+29,
+65535,
+19,
+7,
+65535,
+125,
+65535,
+2854,
+9105,
+13527,
+17238,
+19260,
+19078,
+17750,
+16839,
+15147,
+11207,
+5789,
+852,
+65535,
+117,
+65535,
+57,
+65535,
+65535,
+78,
+65535,
+309,
+65535,
+4589,
+19259,
+33364,
+46270,
+58592,
+65361,
+65534,
+65481,
+65534,
+65482,
+65534,
+65502,
+65534,
+65522,
+65533,
+65534,
+65511,
+65534,
+65480,
+65534,
+65443,
+65534,
+64969,
+58945,
+49833,
+40240,
+32607,
+25444,
+15000,
+5448,
+1703,
+888,
+112,
+65535,
+1551,
+5749,
+10059,
+14802,
+19989,
+24332,
+28800,
+34990,
+41397,
+45141,
+47476,
+51753,
+57634,
+63032,
+65523,
+65517,
+65534,
+65529,
+65534,
+65532,
+65527,
+65534,
+65486,
+65534,
+65370,
+65534,
+62334,
+53253,
+43034,
+30737,
+18541,
+6356,
+65535,
+95,
+65535,
+65535,
+25,
+65535,
+65535,
+123,
+65535,
+3941,
+14245,
+24984,
+34962,
+42758,
+49004,
+53137,
+53837,
+52862,
+51912,
+50285,
+46526,
+41251,
+35495,
+30000,
+24251,
+18660,
+13458,
+9338,
+4955,
+502,
+65535,
+90,
+65535,
+69,
+65535,
+50,
+65535,
+2,
+48,
+65535,
+266,
+65535,
+7099,
+22542,
+35656,
+47435,
+57418,
+64653,
+65534,
+65361,
+65534,
+65447,
+65534,
+65498,
+65534,
+65512,
+65534,
+65499,
+65534,
+65490,
+65534,
+65531,
+65470,
+65534,
+58074,
+44967,
+33681,
+22686,
+9600,
+554,
+65535,
+107,
+65535,
+145,
+65535,
+183,
+65535,
+970,
+9351,
+18457,
+26106,
+34914,
+43407,
+50123,
+55105,
+60420,
+64689,
+65534,
+65469,
+65534,
+65534,
+65299,
+65461,
+65475,
+65534,
+64135,
+61533,
+61916,
+61537,
+58888,
+55405,
+52205,
+47690,
+41130,
+35007,
+28797,
+23114,
+18420,
+14070,
+11681,
+8914,
+5992,
+6518,
+9237,
+11827,
+12836,
+15456,
+19524,
+21776,
+23335,
+24185,
+24750,
+25805,
+26680,
+26734,
+26439,
+26267,
+27295,
+29167,
+30296,
+29979,
+27907,
+25904,
+21738,
+15214,
+7692,
+1016,
+65535,
+122,
+65535,
+54,
+65535,
+65535,
+74,
+65535,
+190,
+65535,
+309,
+65535,
+1428,
+20518,
+46815,
+63725,
+65534,
+65190,
+65534,
+65370,
+65534,
+65476,
+65534,
+65526,
+65529,
+65534,
+65515,
+65534,
+65502,
+65534,
+65496,
+65534,
+65526,
+65492,
+65534,
+59169,
+46717,
+33655,
+19940,
+5894,
+65535,
+190,
+65535,
+15,
+27,
+65535,
+77,
+65535,
+96,
+65535,
+71,
+65535,
+689,
+13342,
+30049,
+45549,
+61653,
+65534,
+65252,
+65534,
+65413,
+65534,
+65482,
+65534,
+65476,
+65534,
+65422,
+65534,
+65354,
+65534,
+64427,
+50589,
+32900,
+19079,
+7468,
+822,
+65535,
+105,
+65535,
+48,
+65535,
+32,
+65535,
+41,
+65535,
+47,
+65535,
+4,
+63,
+65535,
+7529,
+21491,
+35366,
+49220,
+61107,
+65534,
+65366,
+65534,
+65442,
+65534,
+65402,
+65534,
+64205,
+55772,
+46659,
+37597,
+28181,
+19833,
+12658,
+5255,
+65535,
+4,
+38,
+65535,
+60,
+65535,
+31,
+0,
+65535,
+105,
+65535,
+245,
+65535,
+440,
+65535,
+6175,
+41266,
+65368,
+65230,
+65534,
+65479,
+65517,
+65534,
+65467,
+65534,
+65481,
+65534,
+65489,
+65534,
+65472,
+65534,
+65458,
+65534,
+65145,
+57763,
+45744,
+33410,
+22731,
+9992,
+332,
+65535,
+108,
+65535,
+189,
+65535,
+233,
+65535,
+1179,
+13531,
+27284,
+37354,
+46170,
+50658,
+50593,
+47476,
+45507,
+46806,
+47214,
+46637,
+49945,
+55366,
+61186,
+65401,
+65534,
+65534,
+65528,
+65527,
+65534,
+65420,
+65534,
+57320,
+42594,
+28790,
+16282,
+6250,
+439,
+65535,
+53,
+3,
+65535,
+4269,
+13573,
+22458,
+30271,
+36096,
+37506,
+36045,
+35553,
+36680,
+39717,
+44392,
+52427,
+62628,
+65534,
+65244,
+65534,
+65323,
+65534,
+65342,
+65534,
+64405,
+49494,
+29644,
+10208,
+65535,
+235,
+65535,
+2,
+41,
+65535,
+53,
+65535,
+30,
+65535,
+7,
+65535,
+65535,
+2,
+65535,
+9,
+65535,
+22,
+65535,
+37,
+65535,
+35,
+65535,
+65535,
+158,
+65535,
+10299,
+38942,
+62766,
+65534,
+65167,
+65534,
+65362,
+65534,
+65469,
+65534,
+65524,
+65532,
+65534,
+65534,
+65509,
+65534,
+65469,
+65534,
+65393,
+65534,
+63582,
+49886,
+32349,
+18522,
+5216,
+65535,
+185,
+65535,
+19,
+4,
+9,
+65535,
+155,
+65535,
+5031,
+13892,
+18790,
+22368,
+24512,
 24845,
-24740,
-24950,
-25003,
-25057,
-25239,
-25085,
-25213,
-25084,
-25187,
-25241,
-25373,
-25532,
-25425,
-25533,
-25133,
-25191,
-24763,
-24662,
-24395,
-24264,
-24105,
-24080,
-24025,
-23975,
-23919,
-23789,
-23736,
-23762,
-23921,
-24263,
-24740,
-25135,
-25611,
-25742,
-25981,
-26085,
-26351,
+23115,
+23889,
+32465,
+43475,
+51483,
+60935,
+65534,
+65331,
+65534,
+65504,
+65516,
+65534,
+65452,
+65534,
+65389,
+65534,
+64622,
+58551,
+52357,
+47218,
+42375,
+39146,
+33203,
+23339,
+12748,
+2903,
+65535,
+219,
+65535,
+80,
+65535,
+65535,
+118,
+65535,
+5652,
+15492,
+24133,
+34685,
+44441,
+52082,
+57715,
+62482,
+65447,
+65534,
+65499,
+65534,
+65431,
+65534,
+64490,
+60830,
+56363,
+49044,
+40182,
+31559,
+22584,
+14527,
+6013,
+281,
+65535,
+65535,
+16,
+65535,
+47,
+65535,
+681,
+5970,
+8391,
+6400,
+3119,
+52,
+5,
+20,
+65535,
+65,
+65535,
+134,
+65535,
+339,
+65535,
+7214,
+38060,
+63345,
+65534,
+65399,
+65534,
+65445,
+65534,
+65371,
+65534,
+54704,
+45667,
+51013,
+53848,
+58999,
+65534,
+65513,
+65430,
+65534,
+65185,
+65534,
+61059,
+36341,
+8652,
+65535,
+65535,
+280,
+65535,
+4153,
+20933,
+36155,
+44707,
+45461,
+39065,
+29996,
+20611,
+9723,
+698,
+65535,
+67,
+65535,
+257,
+65535,
+13886,
+35803,
+54692,
+65534,
+65370,
+65534,
+65473,
+65534,
+63842,
+57112,
+50655,
+47854,
+49797,
+51126,
+49819,
+48317,
+45216,
+38497,
+31676,
+27100,
+22222,
+14570,
+4046,
+65535,
+263,
+65535,
+265,
+65535,
+3171,
+15178,
+31414,
+47674,
+59749,
+65409,
+65534,
+65437,
+65534,
+65200,
+64926,
+65499,
+65534,
+65532,
+65501,
+65534,
+65410,
+65534,
+65287,
+65534,
+63110,
+45304,
+26383,
+12138,
+1309,
+65535,
+130,
+65535,
+81,
+65535,
+37,
+65535,
+65535,
+18,
+65535,
+43,
+65535,
+46,
+65535,
+65535,
+64,
+65535,
+7338,
+18386,
+24920,
+29180,
+29850,
+25858,
+13082,
+1101,
+0,
+65535,
+8386,
+28191,
+52896,
+65534,
+65386,
+65352,
+65534,
+63068,
+45511,
+24696,
+6801,
+247,
+8382,
+15761,
+26113,
+47617,
+64363,
+65534,
+65534,
+65383,
+65534,
+61968,
+42572,
+25635,
+20426,
+16972,
+19095,
+33766,
+52247,
+63765,
+65534,
+65534,
+57217,
+37083,
+15889,
+1265,
+65535,
+195,
+65535,
+62,
+47,
+65535,
+6105,
+20451,
+31454,
+37866,
+42399,
+44139,
+41143,
+33899,
+26666,
+24797,
+29227,
+35838,
+48547,
+62977,
+65534,
+65445,
+65421,
+65534,
+61215,
+47984,
+38199,
+32855,
+31732,
+33272,
+39303,
+49115,
+58120,
+64583,
+65534,
+65283,
+65534,
+64950,
+60886,
+55471,
+46774,
+39519,
+38616,
+41789,
+47642,
+53370,
+60671,
+65256,
+65534,
+63941,
+56486,
+47690,
+33175,
+14723,
+2959,
+65535,
+188,
+65535,
+252,
+10254,
+25624,
+35255,
+41202,
+44938,
+39512,
+25771,
+10163,
+428,
+65535,
+103,
+65535,
+27,
+74,
+65535,
+5837,
+16868,
+22918,
+25392,
+26079,
+22318,
+14647,
+8280,
+3529,
+274,
+65535,
+65535,
+84,
+65535,
+186,
+65535,
+1312,
+12943,
+25576,
+35543,
+40923,
+36174,
 26747,
-27113,
-27621,
-27798,
-28019,
-27878,
-27804,
-27749,
-27750,
-27723,
-27750,
-27485,
-27223,
-26982,
-26457,
-26376,
-26032,
-26142,
-26109,
-26273,
-26429,
-26718,
-26987,
-27324,
-27620,
-28065,
-28437,
-29123,
-29756,
-30497,
-31182,
-31659,
-32026,
-32136,
-32420,
-32586,
-32977,
-33321,
-33508,
-33531,
-33244,
-32846,
-32502,
-32162,
-32025,
-31899,
-31840,
-31686,
-31551,
-31343,
-31472,
-31579,
-31870,
-32237,
-32531,
-32953,
-33345,
-33749,
-34346,
-34884,
-35353,
-35937,
-36121,
-36674,
-36915,
-37413,
-37760,
-38126,
-38262,
-38232,
-38129,
-37995,
-37838,
-37837,
-37601,
-37466,
-37020,
-36674,
-36123,
-35855,
-35569,
+19926,
+18177,
+19518,
+28810,
+51766,
+65534,
+65310,
+65534,
+65534,
+65496,
+65534,
+65534,
+65383,
+65534,
+59812,
+51142,
+54043,
+58096,
+56006,
+53752,
+53286,
+48998,
+37692,
+19814,
+3081,
+65535,
+378,
+65535,
+359,
+65535,
+3261,
+17947,
+30912,
+33937,
+30816,
+27667,
+26787,
+26002,
+28499,
+37287,
+52731,
+64659,
+65534,
+65441,
+65534,
+65492,
+65534,
+65533,
+65532,
+65523,
+65407,
+59400,
+53139,
+50879,
+50101,
+53135,
+57912,
+62046,
+64013,
+63174,
+57998,
+47519,
+35658,
+25238,
+16241,
+8997,
+4753,
+7265,
+15700,
+23396,
+28655,
+32180,
+32961,
+28086,
+19056,
+9968,
+3300,
+2493,
+6187,
+13301,
+24682,
+35613,
+41815,
+44084,
+40888,
+31431,
+19155,
+6631,
+65535,
+122,
+65535,
+566,
+8708,
+18937,
+26199,
+31866,
+34610,
+33699,
+29263,
+23396,
+18520,
+16006,
+16758,
+20449,
+26563,
+34882,
+42965,
+48554,
+51264,
+50307,
+46701,
+39094,
+27627,
+14194,
+2259,
+65535,
+137,
+65535,
+1,
+65535,
+70,
+65535,
+9740,
+21335,
+25314,
+14331,
+563,
+65535,
+50,
+65535,
+1546,
+29280,
+62584,
+65534,
+65224,
+65534,
+65287,
+65534,
+65399,
+65534,
+65507,
+65528,
+65534,
+65527,
+65506,
+65534,
+65343,
+65534,
+64964,
+65534,
+59025,
+33570,
+9779,
+65535,
+65535,
+238,
+10644,
+25490,
+33112,
+35306,
+27399,
+9163,
+65535,
+326,
+65535,
+358,
+65535,
+9349,
+29820,
+43092,
+50548,
+55182,
+56295,
+51852,
+45019,
+39824,
+36576,
+34892,
+34237,
 35694,
-35782,
-36144,
-36335,
-36648,
-36727,
-37021,
-37280,
-37603,
-38258,
-38814,
-39504,
-40025,
-40404,
-40684,
-40906,
-41054,
-41381,
-41477,
-41697,
-41690,
-41483,
-41297,
-40793,
-40376,
-40131,
-39663,
-39551,
-39055,
-38653,
-38131,
-37491,
-37180,
-36753,
-37045,
-37047,
-37729,
-37946,
-38469,
-38658,
-38970,
-39214,
-39736,
-40321,
-40928,
-41558,
-41854,
-42193,
-42301,
-42300,
-42326,
-42090,
-42035,
-41535,
-41139,
-40529,
-39899,
-39395,
-38787,
-38236,
-37834,
-37313,
-37173,
-36812,
-36619,
-36282,
-35907,
-35675,
-35457,
-35623,
-35960,
-36544,
-36993,
-37387,
-37496,
-37572,
-37574,
-37731,
-38076,
-38365,
-38551,
-38655,
-38392,
-38314,
-37968,
-37813,
-37492,
-37178,
-36675,
-36148,
-35566,
-35145,
-34745,
-34566,
-34137,
-33958,
-33664,
-33506,
-33429,
-33426,
-33348,
-33349,
-33110,
-33031,
-33032,
-33267,
-33694,
-34007,
-34246,
-34166,
-33825,
-33399,
-33008,
-32605,
-32505,
-32397,
-32319,
-32211,
-32056,
-31893,
-31688,
-31602,
-31343,
-31260,
-31052,
-30865,
-30788,
-30574,
-30708,
-30628,
-30918,
-30946,
-31077,
-31209,
-31235,
-31237,
-31339,
-31317,
+40371,
+45886,
+50280,
+52506,
+50885,
+44987,
+36794,
+28497,
+19737,
+13532,
+12376,
+15607,
+20836,
+23936,
+24167,
+22569,
+21008,
+21089,
+22676,
+26148,
+31297,
+37619,
+43258,
+46605,
+49507,
+52329,
+55326,
+57362,
+57443,
+57967,
+56950,
+52452,
+47215,
+44221,
+43870,
+44541,
+46054,
+48623,
+50054,
+48324,
+43604,
+37226,
+30280,
+22474,
+15592,
+12576,
+12215,
+12276,
+12257,
+12804,
+14950,
+17495,
+19801,
+22184,
+24506,
+26026,
+25400,
+22558,
+19208,
+16058,
+13178,
+8770,
+2169,
+65535,
+211,
+65535,
+124,
+65535,
+41,
+22,
+68,
+11373,
+27264,
+35728,
+37033,
+22213,
+3699,
+65535,
+102,
+7473,
+28281,
+56529,
+65534,
+64871,
+65534,
+65472,
+65414,
+65534,
+64581,
+61419,
+64142,
+65534,
+65227,
+65534,
+65329,
+65534,
+65423,
+65534,
+64856,
+49066,
+26176,
+8227,
+65535,
+261,
+65535,
+8314,
+22218,
+25203,
+19130,
+7180,
+65535,
+56,
+65535,
+133,
+65535,
+11370,
+31842,
+47756,
+57430,
+57460,
+52874,
+48954,
+44034,
+36509,
+30757,
+29652,
+31196,
+33804,
+37307,
+43290,
+51103,
+56784,
+57327,
+53595,
+46814,
+37619,
+30240,
+27079,
+27535,
+31752,
+39803,
+48917,
+55249,
+56307,
+54558,
+52805,
+50268,
+51087,
+54648,
+57839,
+60637,
+60964,
+60203,
+58403,
+55949,
+55494,
+57556,
+60029,
+58313,
+56572,
+56125,
+48710,
+38408,
+31201,
+25385,
+19637,
+13258,
+11049,
+17154,
+25556,
+30979,
+36208,
+43522,
+47102,
+43183,
+37267,
+31748,
+26085,
+18893,
+12512,
+11143,
+11664,
+12185,
+14861,
+19300,
+23580,
+26416,
+28060,
+26529,
+20009,
+10592,
+1816,
+65535,
+182,
+65535,
+78,
+65535,
+61,
+65535,
+112,
+65535,
+237,
+65535,
+1451,
+10475,
+15300,
+10294,
+2274,
+65535,
+4523,
+21967,
+49041,
+65534,
+65468,
+65476,
+65534,
+65403,
+65534,
+65430,
+65534,
+65500,
+65522,
+65534,
+65399,
+65534,
+65186,
+65534,
+61049,
+45039,
+29548,
+10651,
+65535,
+267,
+65535,
+31,
+23,
+65535,
+71,
+65535,
+91,
+65535,
+95,
+65535,
+58,
+65535,
+273,
+12863,
+30451,
+42577,
+51559,
+55914,
+59648,
+64292,
+65534,
+65449,
+65534,
+65506,
+65534,
+65525,
+65534,
+65521,
+65534,
+65487,
+65534,
+65413,
+65534,
+64362,
+58344,
+51777,
+46265,
+39345,
+29351,
+18015,
+5761,
+65535,
+65535,
+185,
+65535,
+1663,
+14721,
+27218,
+32495,
+32712,
+28073,
+22567,
+18104,
+19511,
+29292,
+44117,
+60019,
+65534,
+65258,
+65534,
+65465,
+65534,
+65534,
+65524,
+65534,
+65534,
+65488,
+65534,
+65400,
+65534,
+63971,
+55275,
+43607,
+31562,
+20519,
+12667,
+8070,
+5918,
+5837,
+5883,
+2755,
+65535,
+23,
+0,
+65535,
+19,
+65535,
+16,
+65535,
+5,
+6,
+65535,
+33,
+65535,
+60,
+65535,
+42,
+7,
+65535,
+277,
+65535,
+11997,
+31985,
+39779,
+37375,
+28771,
+18322,
+7738,
+3452,
+11495,
+27462,
+45866,
+61463,
+65534,
+65301,
+65534,
+65409,
+65534,
+62596,
+55772,
+50514,
+51877,
+59425,
+65015,
+65534,
+65530,
+65517,
+65534,
+65111,
+59149,
+50344,
+43470,
+38412,
+37169,
+38543,
+37620,
+34785,
+32234,
+26885,
+18612,
+12376,
+11300,
+15220,
+21920,
+29301,
+36279,
+41077,
+40837,
+36964,
+32897,
+28732,
+24867,
+24705,
+29213,
+36532,
+45274,
+53655,
+61198,
+65412,
+64031,
+58769,
+53079,
+48983,
+46127,
+45710,
+48539,
+53204,
+57645,
+59438,
+57605,
+53914,
+48760,
+43739,
+40551,
+38885,
+37268,
+36458,
+36622,
+37186,
+40496,
+43501,
+44306,
+43921,
+42601,
+42705,
+45370,
+50304,
+56467,
+61700,
+64084,
+63486,
+62832,
+61824,
+59033,
+58729,
+61268,
+63328,
+62069,
+57642,
+54219,
+51283,
+44905,
+35824,
+28314,
+23055,
+16506,
+10406,
+8397,
+8391,
+8122,
+4894,
+749,
+65535,
+52,
+65535,
+25,
+65535,
+12,
+65535,
+1,
+1,
+65535,
+2,
+65535,
+2,
+1,
+65535,
+21,
+65535,
+62,
+65535,
+105,
+65535,
+116,
+65535,
+557,
+12041,
+23408,
+25663,
+24340,
+22351,
+21145,
+20670,
+26934,
+39344,
+54159,
+64686,
+65534,
+65418,
+65534,
+65453,
+65534,
+65496,
+65534,
+65532,
+65523,
+65534,
+65517,
+65534,
+65534,
+65485,
+65534,
+65329,
+65534,
+61350,
+51900,
+45898,
+42150,
+41089,
+38705,
+32450,
+25975,
+20524,
+11896,
+2053,
+65535,
+184,
+65535,
+163,
+65535,
+1731,
+4636,
+4386,
+3247,
+2547,
+2948,
+7062,
+17371,
+30597,
+42035,
+51146,
+58261,
+63256,
+64013,
+60840,
+57963,
+57339,
+57272,
+57594,
+59113,
+61908,
+63979,
+64271,
+62754,
+59343,
+54781,
+48835,
+43796,
+41155,
+40543,
+42122,
+45023,
+47920,
+49752,
+48817,
+44799,
+38632,
+33773,
+32387,
 31471,
-31528,
-31551,
-31527,
-31499,
-31367,
+28890,
+24578,
+20943,
+20120,
+20783,
+21828,
+23801,
+26219,
+27117,
+26283,
+25988,
+26774,
+28069,
+30606,
+35063,
+40087,
+43220,
+43702,
+42841,
+41194,
+38035,
+33416,
+27948,
+23618,
+20483,
+18913,
+20679,
+23674,
+26229,
+27548,
+27316,
+26313,
+25110,
+24460,
+22459,
+17514,
+7531,
+16,
+25,
+23,
+65535,
+52,
+65535,
+38,
+65535,
+19,
+65535,
+23,
+65535,
+60,
+65535,
+138,
+65535,
+1031,
+6603,
+9654,
+10346,
+15413,
+25086,
+37155,
+53942,
+65272,
+65534,
+65493,
+65534,
+65467,
+65534,
+65487,
+65534,
+65509,
+65534,
+65507,
+65534,
+65482,
+65534,
+65469,
+65534,
+65515,
+65494,
+65478,
+55678,
+41973,
+31681,
+21926,
+17463,
+11766,
+2225,
+65535,
+210,
+65535,
+88,
+65535,
+19,
+6,
+65535,
+43,
+65535,
+49,
+65535,
+65535,
+69,
+65535,
+8213,
+23217,
+37195,
+49794,
+59924,
+65299,
+65534,
+65488,
+65534,
+65497,
+65534,
+65516,
+65534,
+65525,
+65534,
+65513,
+65534,
+65474,
+65534,
+65404,
+65534,
+64758,
+60344,
+56598,
+53146,
+50824,
+50709,
+51394,
+50576,
+46339,
+39915,
+32753,
+25386,
+19675,
+17038,
+16621,
+17580,
+18357,
+18686,
+18328,
+16687,
+14641,
+14195,
+15577,
+18561,
+23640,
+30035,
+35849,
+38292,
+38464,
+38854,
+39199,
+39297,
+40134,
+42570,
+45249,
+44905,
+40620,
+35752,
+32450,
+29678,
+26406,
+23288,
+18902,
+13062,
+6347,
+721,
+65535,
+92,
+65535,
+51,
+65535,
+21,
+65535,
+65535,
+11,
+65535,
+27,
+65535,
+23,
+65535,
+65535,
+116,
+65535,
+445,
+65535,
+6426,
+23814,
+32351,
+32631,
+31617,
+34064,
+40778,
+46969,
+53313,
+57630,
+61688,
+65534,
+65464,
+65533,
+65534,
+65486,
+65534,
+65498,
+65534,
+65524,
+65530,
+65534,
+65512,
+65534,
+65509,
+65534,
+65534,
+65476,
+65534,
+61855,
+56654,
+52335,
+47402,
+44092,
+39181,
 31210,
-30997,
-30708,
+23824,
+18684,
+14304,
+10124,
+5018,
+712,
+65535,
+45,
+65535,
+19,
+65535,
+65535,
+33,
+65535,
+110,
+65535,
+1951,
+10969,
+21275,
+29850,
+39038,
+49973,
+61755,
+65534,
+65295,
+65534,
+65466,
+65534,
+65525,
+65533,
+65534,
+65532,
+65534,
+65524,
+65534,
+65472,
+65534,
+65322,
+65534,
+61916,
+49646,
+37843,
+29114,
+20981,
+12515,
+4444,
+73,
+65535,
+19,
+65535,
+21,
+65535,
+19,
+65535,
+42,
+65535,
+129,
+65535,
+1675,
+6741,
+12648,
+19366,
+26058,
+33016,
+38713,
+43318,
+49252,
+54765,
+56810,
+58327,
+58929,
+56589,
+52133,
+47234,
+41408,
+34598,
+28429,
+23838,
+21011,
+17647,
+13399,
+8395,
+2632,
+65535,
+70,
+65535,
+14,
+65535,
+65535,
+9,
+65535,
+30,
+65535,
+2637,
+7489,
+10549,
+12702,
+14211,
+16246,
+22477,
+33941,
+47439,
+56127,
+56388,
+50984,
+45965,
+43649,
+42525,
+41416,
+42009,
+42890,
+46225,
+51032,
+56833,
+58376,
+52605,
+48036,
+48493,
+51968,
+53460,
+54335,
+57576,
+61541,
+61238,
+62676,
+65410,
+65534,
+64914,
+63123,
+61484,
+59200,
+54872,
+48593,
+43904,
+41399,
+37446,
+30705,
+25030,
+21710,
+17991,
+13739,
+13342,
+16497,
+18285,
+19049,
+19158,
+18630,
+16816,
+14352,
+10283,
+5673,
+5077,
+8033,
+12490,
+16959,
+22854,
+28143,
+31561,
+34660,
+36500,
+37068,
+37286,
+38982,
+40853,
+43031,
+47257,
+51129,
+52689,
+53252,
+54219,
+54400,
+51874,
+48354,
+47236,
+46305,
+46068,
+46908,
+46976,
+46521,
+45906,
+44361,
+41734,
+39566,
+37908,
+35926,
+35901,
+37981,
+37863,
+35603,
+33731,
+30814,
+26456,
+23063,
+25800,
 30311,
-29995,
-29597,
-29546,
-29810,
-30126,
+33487,
+38686,
+42460,
+43913,
+42949,
+40266,
+33476,
+29067,
+27135,
+26642,
+23102,
+24816,
+28906,
+27364,
+27307,
+28046,
+30843,
+23142,
+25446,
+26287,
+21011,
+25266,
+27115,
+28536,
+30965,
+35337,
+35362,
+31013,
+34259,
+33864,
+32967,
+36328,
+32460,
+31908,
+29192,
+29011,
+29718,
+23146,
+19253,
+18247,
+16700,
+16081,
+18009,
+20537,
+17919,
+13603,
+14975,
+17749,
+22502,
+24349,
+20780,
+17846,
+10506,
+8229,
+10408,
+6846,
+5349,
+7282,
+7134,
+7147,
+16467,
+24875,
+19514,
+14493,
+17816,
+21117,
+21953,
+22807,
+30068,
+35756,
+37252,
+43458,
+52494,
+58780,
+58176,
+56632,
+55509,
+56048,
+58602,
+57331,
+54260,
+57067,
+60500,
+58064,
+58114,
+59396,
+54837,
+48043,
+44789,
+44911,
+46460,
+46908,
+45536,
+44994,
+45024,
+44026,
+42930,
+39784,
+35749,
+34371,
+32262,
+31275,
+33790,
+34209,
+29131,
+25141,
+27908,
+27825,
+23383,
+25983,
+27491,
+23145,
+25532,
+29082,
+30425,
+32279,
+30775,
+27553,
+27305,
+27844,
+23978,
+23754,
+29021,
+28583,
+30780,
+38089,
+36994,
+38674,
+39260,
+32739,
+33024,
+35430,
+35485,
+35040,
+36042,
+43950,
+43148,
+39951,
+52991,
+53217,
+47547,
+50982,
+46388,
+43380,
+44374,
+42053,
+33989,
+34239,
+42755,
+33668,
+24880,
+36685,
+31735,
+23274,
+20224,
+22823,
+25766,
+15652,
+17662,
+17662,
+30713,
+23842,
+14856,
+32972,
+34310,
+26038,
+28581,
+44255,
+40058,
+32682,
+44340,
+38980,
+38369,
+37608,
+30545,
+36401,
+39306,
+39132,
+37179,
+46931,
+38936,
+25693,
+35812,
+25072,
+16737,
+22688,
+24390,
+13254,
+13764,
+25094,
+6441,
+8362,
+18306,
+2600,
+2989,
+11272,
+4468,
+4436,
+11095,
+8162,
+4408,
+15935,
+12452,
+5314,
+21810,
+19725,
+9906,
+25656,
+32360,
+27490,
+39587,
+43507,
+40847,
+45290,
+46721,
+41823,
+41601,
+45465,
+42895,
+46422,
+50269,
+52154,
+55604,
+55279,
+56570,
+55038,
+54933,
+55729,
+49079,
+48978,
+49393,
+45515,
+46711,
+49172,
+44702,
+41324,
+47201,
+43102,
+37116,
+39727,
+38667,
+27998,
+25497,
+30277,
+29092,
+26294,
+24199,
+28753,
+24660,
+16190,
+24015,
+13277,
+12431,
+19526,
+3275,
+18356,
+22719,
+13461,
+26106,
+32421,
+33756,
+32282,
+42496,
+48697,
+33725,
+47146,
+46536,
+31070,
+47029,
+43715,
+36557,
+42705,
+50932,
+38643,
+38536,
+50365,
+33874,
+36062,
+34219,
+28839,
+30967,
+27043,
+34775,
+28510,
+27679,
+37485,
+30915,
+29987,
+32527,
+41100,
+32343,
+34365,
+44750,
+37633,
+43235,
+42656,
+45256,
+49939,
+45801,
+52351,
+53684,
+48713,
+52587,
+58993,
+48759,
+48737,
+54572,
+48470,
+41783,
+48611,
+45339,
+34343,
+42522,
+44833,
+22109,
+28639,
+36922,
+6772,
+19367,
+22906,
+11525,
+16310,
+13957,
+18013,
+13240,
+15106,
+17250,
+7282,
+11951,
+10723,
+9969,
+8374,
+8268,
+19645,
+17346,
+14573,
+20862,
+26619,
+24530,
+16119,
+29808,
+23797,
+13130,
+27131,
+19449,
+20878,
+28833,
+21151,
+22110,
+28290,
+20145,
+17379,
+26350,
+22991,
+14889,
+25814,
+33487,
+12850,
+25484,
+36527,
+17883,
+28403,
+36665,
+33326,
+30375,
+37523,
+42175,
+27791,
+36902,
+45649,
+29094,
+39307,
+41141,
+38067,
+42294,
+41767,
+46658,
+40206,
+53613,
+42544,
+40300,
+58553,
+37148,
+41498,
+50956,
+40575,
+39111,
+47232,
+45335,
+35283,
+40346,
+43288,
+33946,
+35799,
+38644,
+32937,
+30089,
+30213,
+33214,
+25660,
+30493,
+37271,
+28721,
+33936,
+35890,
+36992,
+29581,
+33747,
+38867,
+26761,
+36728,
+39581,
 30707,
-30972,
-31209,
-30945,
-30734,
-30469,
-30338,
-30416,
-30525,
-30466,
-30632,
-30466,
-30658,
-30704,
-30975,
-31153,
-31396,
-31366,
-31501,
-31367,
-31579,
-31578,
+45934,
+36585,
+41638,
+50844,
+41724,
+52686,
+45366,
+55218,
+48419,
+48481,
+62035,
+41700,
+52335,
+51781,
+35524,
+49251,
+39713,
+39323,
+44811,
+32401,
+37978,
+37841,
+31698,
+30743,
+33131,
+28158,
+26039,
+33987,
+31101,
+28216,
+34561,
+32126,
+21139,
+33212,
+33605,
+22104,
+36923,
+36805,
+26075,
+39509,
+33233,
+21784,
+40436,
+21044,
+24716,
+31833,
+23379,
+21660,
+18941,
+34910,
+7174,
+18931,
+27569,
+65535,
+17511,
+16092,
+6593,
+10481,
+17456,
+15769,
+9978,
+26071,
+18715,
+16976,
+31904,
+14970,
+27503,
+32660,
+25038,
+31269,
+31513,
+38603,
+24777,
+29836,
+32176,
+15273,
+34557,
+25923,
+15922,
+44910,
+26248,
+27942,
+43124,
+27080,
+34568,
+36237,
+28398,
+35232,
+30595,
+36989,
+32023,
+20962,
+41767,
+26993,
+22945,
+43120,
+32394,
 31923,
-32027,
-32213,
-32213,
-32212,
-32002,
-31789,
-31580,
-31287,
-31264,
-31233,
+39250,
+42358,
+33628,
+38436,
+45145,
+32192,
+41780,
+40915,
+35236,
+34530,
+39137,
+39085,
+23171,
+40017,
+35652,
+22039,
+40827,
+25274,
+28586,
+26909,
+26017,
+26469,
+14895,
+37861,
+21838,
+22072,
+35337,
+21030,
+35559,
+24212,
+35208,
+41061,
+26752,
+47204,
+33308,
+40271,
+45061,
+34755,
+48387,
+40518,
+46966,
+54046,
+44630,
+55474,
+55737,
+53408,
+53285,
+59773,
+57288,
+55410,
+53800,
+60373,
+50153,
+48358,
+61245,
+39984,
+55571,
+50593,
+38338,
+56608,
+40402,
+41460,
+39362,
+38869,
+35798,
+24771,
+42363,
+23817,
+29599,
+34522,
+15555,
+31057,
+22124,
+16310,
+19577,
+17974,
+17512,
+7115,
+18565,
+12758,
+6325,
+21718,
+10161,
+22763,
+19855,
+16911,
+28958,
+17502,
+28924,
+22500,
+23643,
+29394,
+18465,
+31127,
+22053,
+25330,
+29897,
+19088,
+35961,
+26537,
+30226,
+37964,
+27988,
+38481,
+29511,
+30913,
+35017,
+20954,
+33742,
+31154,
+20392,
+35193,
+29419,
+21369,
+35840,
+30107,
+24541,
+29888,
+37848,
+22993,
 31528,
-31814,
-32216,
-32448,
-32557,
-32582,
-32554,
-32373,
-32503,
-32292,
-32529,
-32450,
-32609,
-32740,
-32927,
-33082,
-33193,
-33239,
-33166,
-33082,
-32926,
-33007,
-32896,
-33061,
-33001,
-32982,
-32923,
-32848,
-32714,
-32502,
-32320,
-31762,
-31632,
-31210,
-31235,
-31367,
-31553,
-32027,
+41878,
+22165,
+35067,
+37999,
+27668,
+35924,
+39528,
+35532,
+28479,
+48295,
+35496,
+29022,
+54884,
+39070,
+30825,
+54706,
+41580,
+28886,
+49035,
+35812,
+19817,
+37783,
+35730,
+16627,
+30804,
+38767,
+16540,
+20404,
+36069,
+10992,
+14199,
+28256,
+3714,
+11504,
+22707,
+6951,
+10447,
+24471,
+17738,
+8783,
+32421,
+23780,
+15671,
+36123,
+29453,
+24616,
+43010,
+35421,
+36288,
+48061,
+44697,
+47577,
+54001,
+62251,
+54130,
+62917,
+64460,
+60572,
+65534,
+65534,
+64729,
+62094,
+65119,
+59545,
+62973,
+60788,
+59500,
+52180,
+53123,
+52162,
+38906,
+45570,
+43425,
+34073,
+31496,
 32187,
-32529,
-32636,
-32765,
-32928,
-32976,
-33271,
-33268,
-33559,
-33640,
-33821,
-33985,
-34005,
-33985,
-33847,
-33694,
-33398,
-33193,
-32949,
-32663,
-32398,
-32130,
-31953,
-31839,
-31820,
-31787,
+23488,
+27653,
+20032,
+18201,
+23883,
+19519,
+18062,
+17675,
+20512,
+12252,
+12127,
+17140,
+13030,
+12935,
+20278,
+14956,
+16207,
+25658,
+18152,
+15100,
+29117,
+20361,
+20554,
+30996,
+21374,
+28329,
+28338,
+27486,
+29475,
+32000,
+35102,
+30319,
+35675,
+44540,
+29227,
+38932,
+44313,
+29520,
+41848,
+32803,
+33682,
+35894,
+29416,
 31660,
-31392,
-31159,
-30599,
-30552,
-30281,
-30526,
-30758,
-30920,
-31209,
-31181,
-31318,
-31363,
-31478,
-31680,
-31899,
-32132,
-32186,
-32319,
-32159,
-32239,
-32134,
-32027,
+33615,
+27931,
+35019,
+25735,
+31095,
+26772,
+19651,
+30096,
+15740,
+26296,
+21154,
+22342,
+21862,
+22408,
+29133,
+23394,
+20750,
+34223,
+24195,
+20422,
+34557,
+27117,
+25576,
+40442,
+26878,
+30676,
+45707,
+28985,
+35322,
+41238,
+45115,
 32107,
-31685,
-31816,
-31315,
-31182,
+46821,
+51107,
+34465,
+42680,
+47837,
+29705,
+30779,
+40813,
+29813,
+23432,
+32424,
+30013,
+17817,
+29275,
+20530,
+19989,
+20624,
+20205,
+12839,
+18598,
+23650,
+8279,
+19018,
+28713,
+15534,
+29780,
+36551,
+31544,
+41863,
+44353,
+50807,
+45356,
+55398,
+55297,
+53504,
+59981,
+56808,
+65534,
+62693,
+54974,
+65534,
+59008,
+58891,
+63766,
+61916,
+52129,
+49131,
+50532,
+39300,
+41357,
+33936,
+27501,
+31574,
+20370,
+21243,
+24012,
+12284,
+20072,
+11578,
+11241,
+15100,
+10529,
+26120,
+3934,
+25662,
 30788,
-30546,
-30342,
-30148,
-30130,
-30019,
-30101,
-29967,
-29783,
-29704,
-29308,
-29388,
-29227,
-29519,
-29678,
-30047,
-30180,
-30336,
-30391,
-30417,
-30497,
-30707,
-30864,
-31132,
-31154,
-31265,
-30995,
-30947,
-30759,
-30629,
-30759,
-30524,
+7104,
+32343,
+29350,
+17233,
+27584,
+36019,
+20565,
+24305,
+40725,
+24357,
+21096,
+48498,
+29439,
+24480,
+40086,
+32032,
+20710,
+32506,
+36230,
+12316,
+34326,
+34800,
+12788,
+39594,
+35984,
+18295,
+35176,
+31592,
+26583,
+29929,
+24540,
+31970,
+23804,
+24980,
+32762,
+26189,
+32123,
+27421,
+37832,
+29849,
+26595,
+47728,
+26624,
+34156,
+38739,
+28378,
+42044,
+27351,
+33531,
+37197,
+34221,
+28971,
+38350,
+50380,
+17427,
+40023,
+45380,
+18305,
+39240,
+36691,
+24521,
+36446,
+41395,
+24073,
+37182,
+50958,
+15172,
+39704,
+44475,
+27730,
+40081,
+39407,
+40404,
+32370,
+46991,
+37678,
+31650,
+52920,
+28500,
+36641,
+46935,
+25491,
+43252,
+33958,
+37313,
+37993,
+29168,
+40421,
+32522,
+29220,
+33758,
+32593,
+33454,
+32069,
+36750,
+32885,
+29641,
+43164,
+37086,
+32278,
+44776,
+40781,
+36563,
+50939,
+39382,
+39800,
+57058,
+36114,
+43261,
+55057,
+42896,
+47621,
+38672,
+47907,
+41731,
+43866,
+43046,
+28554,
+49759,
+32609,
+25072,
+41142,
+26192,
+23332,
+26428,
+22821,
+17607,
+18525,
+17236,
+10124,
+13248,
+9974,
+13170,
+8672,
+9505,
+11750,
+11747,
+17024,
+10718,
+15634,
+21179,
+17989,
+25303,
+24680,
+26116,
+31277,
+33254,
+26940,
+30135,
+43218,
+27861,
+34076,
+49725,
+33511,
 30759,
-30417,
-30524,
-30071,
-30024,
-29780,
-29653,
-29624,
-29519,
-29546,
-29625,
-29623,
+47231,
+29810,
+24908,
+44155,
+32327,
+21182,
+37040,
+36568,
+24264,
+35224,
+34832,
+18840,
+25739,
+34236,
+18338,
+28856,
+29453,
+24017,
+28322,
+22362,
+27980,
+28273,
+31105,
+26913,
+25465,
+40298,
+35624,
+29471,
+42305,
+42445,
+31145,
+37424,
+46960,
+37390,
+37490,
+41890,
+40633,
+40005,
+41506,
+39144,
+40711,
+41367,
+40882,
+38070,
+40787,
+48033,
+35595,
+38222,
+50574,
+41603,
+39487,
+41290,
+43443,
+40423,
+31846,
+42678,
+40698,
+38804,
+36459,
+30684,
+42091,
+33945,
+30248,
+37605,
+30375,
+32256,
+30999,
+26473,
+32435,
+36010,
+27309,
+29632,
+37287,
+28075,
+33984,
+36343,
+31647,
+38238,
+38370,
+34911,
+37101,
+46232,
+41869,
+40313,
+47864,
+43090,
+43884,
+50195,
+39545,
+38751,
+47976,
+39270,
+39657,
+42144,
+39247,
+35532,
+33318,
+33297,
+30194,
+32534,
+27648,
+17886,
+25797,
+26720,
+19111,
+23729,
+24130,
+20490,
+18769,
+17401,
+14281,
+14270,
+16343,
+10430,
+11646,
+16781,
+16294,
+18727,
+18832,
+18688,
+22183,
+22735,
+17459,
+23361,
+29520,
+24033,
+27972,
+30813,
+31383,
+35230,
+34695,
+31148,
+32287,
+35431,
+32916,
+31417,
+33296,
+36327,
+33221,
+34478,
+35671,
+33593,
+35429,
+30622,
+27709,
+29985,
+30031,
+30921,
+30713,
+32712,
+29220,
+29508,
+32937,
+24849,
+30951,
+27293,
+29058,
+35610,
+32819,
+38845,
+35358,
+38032,
+35799,
+32632,
+33888,
+32969,
+39784,
+39954,
+42335,
+47305,
+46078,
+45010,
+44981,
+43027,
+33355,
+32849,
+32696,
+25726,
+30284,
+31967,
+23590,
+24053,
+25541,
+18923,
+16930,
+25139,
+23842,
+16998,
+21596,
+20300,
+18069,
+18203,
+21298,
+18442,
+16747,
+25062,
+25830,
+33282,
+41535,
+41598,
+43955,
+49583,
+52885,
+52372,
+56024,
+57928,
+59403,
+64525,
+65534,
+65471,
+65534,
+65502,
+65534,
+65413,
+65534,
+61515,
+55898,
+50505,
+49197,
+50015,
+45028,
+41743,
+39068,
+32249,
+25359,
+23841,
+21214,
+16308,
+14171,
+13287,
+14598,
+17980,
+19736,
+18988,
+16880,
+17695,
+17248,
+17020,
+20168,
+21828,
+22946,
+26392,
+32151,
+34879,
+36146,
+37687,
+35162,
+31145,
+32147,
+33027,
+30011,
+31704,
+32912,
+31655,
+33660,
+33790,
+30548,
+25911,
+22068,
+21092,
+19568,
+18138,
+20272,
+20918,
+19020,
+21214,
+22838,
+21492,
+20238,
+20026,
+17447,
+17082,
+20304,
+24283,
+25342,
+26547,
+32810,
+32202,
+32406,
+34242,
+32038,
+28939,
+27486,
+29793,
+29379,
+31642,
+34435,
+32270,
+32738,
+32913,
+29910,
+29075,
+28118,
+24117,
+25008,
+27543,
+27455,
+30594,
+33529,
+31690,
+33046,
+35920,
+33388,
+35245,
+36427,
+34730,
+35946,
+37335,
+37522,
+38173,
+39264,
+35752,
+35651,
+37739,
+33602,
+34641,
+34651,
+33758,
+33196,
+31450,
+33261,
+32002,
+32423,
+30628,
 29705,
-29809,
-29836,
-30102,
-30070,
-30367,
-30414,
-30604,
-30733,
-30601,
-30735,
-30494,
-30551,
-30442,
-30417,
-30417,
-30337,
-30312,
-30179,
-30073,
-30102,
-30123,
-30342,
-30491,
-30765,
+30489,
+27278,
+29536,
+30261,
+28596,
+32560,
+32588,
+33189,
+36696,
+37159,
+38324,
+39215,
+39728,
+40102,
+42226,
+44232,
+47472,
+50651,
+52735,
+55411,
+55184,
+56256,
+55878,
+54027,
+52084,
+52490,
+53288,
+50478,
+52503,
+52559,
+48902,
+48517,
+45692,
+40639,
+37949,
+35741,
+31294,
+29283,
+27810,
+24790,
+24709,
+22734,
+20823,
+20843,
+17452,
+15388,
+16794,
+14873,
+13481,
+15824,
+14931,
+15866,
+18072,
+19079,
+20554,
+21840,
+23335,
+23342,
+24777,
+26866,
+29004,
+31846,
+33999,
+37234,
+38194,
+39759,
+40378,
+38915,
+39212,
+37671,
+38556,
+36623,
+35955,
+35574,
+35035,
+35021,
+32167,
+31986,
+28635,
+25115,
+23847,
+20871,
+19692,
+19763,
+19288,
+18178,
+19853,
+20352,
+17880,
+21267,
+22191,
+20838,
+24093,
+25786,
+28004,
+31443,
+33051,
+35429,
+38232,
+37831,
+39555,
+41091,
+40192,
+41895,
+42702,
+42370,
+42440,
+43969,
+42216,
+40799,
+38808,
+36548,
+35075,
+32100,
+31688,
+29121,
+29203,
+27979,
+25489,
+25394,
+22573,
+22571,
+21062,
+19522,
+21396,
+21063,
+21792,
+21954,
+23818,
+25603,
+26418,
+29619,
+30306,
+30665,
+32885,
+33728,
+34526,
+37464,
+38594,
+40632,
+42009,
+44290,
+44783,
+46746,
+47386,
+47210,
+48361,
+47591,
+48550,
+47392,
+47970,
+47204,
+46323,
+46410,
+45391,
+44176,
+43589,
+42548,
+41263,
+40619,
+39392,
+39926,
+39224,
+37447,
+37748,
+37351,
+35963,
+34683,
+33920,
+31909,
+30468,
+31571,
+29631,
+29579,
+30987,
+28868,
+29664,
+30622,
+29400,
+29432,
+30030,
+30004,
+29280,
+30506,
+30866,
+29800,
+30850,
+30716,
 30889,
-31105,
-31129,
-31209,
-31158,
-31207,
-31316,
-31419,
-31633,
-31737,
-31869,
-31922,
-31843,
-31790,
-31632,
-31578,
-31500,
-31421,
-31366,
-31211,
-31154,
-31079,
-31050,
-31077,
-31157,
-31286,
-31344,
-31577,
-31633,
-31921,
-32054,
+31171,
+31240,
+31950,
+29894,
+29903,
+29801,
+27286,
+27819,
+28521,
+27279,
+27306,
+29654,
+30184,
+28184,
+29996,
+29534,
+27624,
+28907,
+29335,
+28835,
+29565,
+31665,
+31925,
 32318,
-32584,
-32818,
-33059,
-33162,
-33454,
-33508,
-33741,
-33801,
-33872,
-33854,
-33714,
-33774,
-33477,
-33614,
-33401,
-33478,
-33272,
-33107,
-32797,
-32606,
-32320,
-32263,
-32401,
-32447,
-32744,
-32790,
-32928,
-32845,
-32953,
-33164,
-33398,
-33853,
-34138,
-34379,
-34458,
-34428,
-34328,
-34456,
-34642,
-34986,
-35275,
-35435,
-35461,
-35275,
-35170,
-35066,
-35011,
-34960,
-34878,
-34643,
-34403,
-34196,
-33953,
-34010,
-33795,
-33878,
-33584,
-33561,
-33294,
-33455,
-33425,
-33827,
-33925,
-34197,
-34163,
-34328,
-34350,
-34670,
-34983,
-35253,
-35562,
-35598,
-35640,
-35729,
-35934,
-36174,
-36651,
-36725,
-36917,
-36619,
-36282,
-35881,
-35305,
-35273,
-34803,
-34904,
-34617,
-34589,
-34352,
-34192,
-33957,
-33874,
-33748,
-33793,
-33828,
-34109,
-34196,
-34483,
-34695,
-34959,
-35249,
-35513,
-35858,
-36041,
-36358,
-36386,
-36489,
-36519,
-36648,
-36675,
-36809,
-36753,
-36729,
-36518,
-36303,
-35808,
-35510,
-34909,
-34613,
-34090,
-33874,
-33667,
-33532,
-33453,
-33244,
-32977,
-32795,
-32502,
+34259,
+34686,
+34644,
+36006,
+37055,
+37652,
+37694,
+38514,
+38339,
+38595,
+36645,
+36348,
+37544,
 32529,
-32610,
-32819,
-33138,
-33215,
-33428,
-33426,
-33799,
-34007,
-34537,
-34748,
-35143,
-35038,
-35092,
-34958,
-34906,
-34987,
-34956,
-34936,
-34718,
-34302,
-33926,
-33377,
-33135,
-32716,
-32422,
-32004,
-31708,
-31317,
-31261,
-31050,
-31237,
-31075,
-31186,
-31100,
-31159,
-31338,
-31529,
-31841,
-32003,
-32317,
-32345,
-32740,
-32901,
-33399,
-33614,
-33769,
-33613,
-33375,
-32951,
-32795,
-32553,
-32506,
-32422,
-32134,
-31896,
-31447,
-31181,
-30974,
-30837,
-30814,
-30734,
-30654,
-30523,
-30628,
-30469,
-31025,
-30944,
-31528,
-31497,
-31766,
-31814,
-32004,
-32104,
-32321,
-32528,
-32556,
-32794,
-32740,
-32846,
-32928,
-32817,
-32822,
-32450,
-32317,
-32030,
-31892,
-31846,
-31709,
-31713,
-31444,
-31396,
-31022,
-31132,
-30944,
-31130,
-31130,
-31368,
-31419,
-31581,
-31787,
+33280,
+33387,
+28354,
+28918,
+27612,
+25113,
+24367,
+23854,
+22058,
+20468,
+20754,
+17950,
+17905,
+16190,
+16715,
+17999,
+16334,
+20482,
+19819,
+21169,
+23411,
+22242,
+24739,
+24615,
+26803,
+27971,
+28212,
+31180,
+29678,
+32217,
+33316,
+31560,
+33340,
+33556,
+33069,
+33546,
+35686,
+33923,
+34249,
+35440,
+34687,
+35609,
+35003,
+36990,
+36416,
+36275,
+38706,
+37936,
+40103,
+40747,
+42580,
+45588,
+44985,
+47787,
+48852,
+48230,
+49577,
+50611,
+49766,
+50834,
+51415,
+49602,
+51037,
+50095,
+48653,
+48182,
+46992,
+45188,
+43723,
+43170,
+41858,
+39612,
+38376,
+37620,
+34496,
+34595,
+33309,
+32196,
+31878,
+29891,
+30894,
+29700,
+28734,
+29132,
+27858,
+25998,
+26526,
+26725,
+24859,
+26967,
+26659,
+25967,
+27058,
+26311,
+25810,
+24595,
+24537,
+22305,
+23443,
+23851,
+22609,
+24529,
+23668,
+24058,
+25531,
+25339,
+25657,
+26872,
+26819,
+28335,
+30894,
+30909,
+32993,
+34179,
+34348,
+36661,
+36221,
+37764,
+38936,
+38884,
+38792,
+38611,
+38397,
+36795,
+37279,
+36196,
+34484,
+34415,
+33538,
+31085,
+30421,
+29978,
+28512,
+28059,
+28084,
+27208,
+25985,
+26585,
+25445,
+24792,
+25982,
+24946,
+24227,
+25969,
+26534,
+26160,
+27446,
+27034,
+26943,
+28477,
+28625,
+29308,
+29500,
+29674,
+29789,
+28567,
+29726,
+29207,
+29150,
+30190,
+28391,
+28753,
+28626,
+27577,
+26213,
+25515,
+24665,
+23892,
+23834,
+23459,
+24116,
+23961,
+25166,
+26238,
+27520,
+29365,
+30772,
+32714,
+33183,
+35544,
+38695,
+39363,
+41061,
+44348,
+45701,
+46149,
+49602,
+49656,
+49085,
+51437,
+50634,
+49597,
+50136,
+49757,
+47560,
+47947,
+46716,
+44611,
+45002,
+42292,
+41170,
+40128,
+38527,
+38250,
+36931,
+36881,
+36085,
+35385,
+35178,
+34629,
+34626,
+34497,
+34030,
+33921,
+33783,
+32588,
+32838,
+32602,
+32496,
 32031,
-32263,
-32425,
-32449,
-32584,
-32554,
-32532,
-32526,
+31856,
+32606,
+31459,
+31048,
+30729,
+29673,
+28144,
+27466,
+27369,
+25490,
+25960,
+27359,
+26250,
+27857,
+28635,
+29614,
+30990,
+31622,
+32839,
+33162,
+34582,
+34468,
+36304,
+36759,
+36405,
+38415,
+38332,
+38784,
+39620,
+39589,
+38634,
+37896,
+37876,
+36061,
+35026,
+34629,
 32507,
-32473,
-32427,
-32343,
-32159,
-32242,
-31918,
-31873,
-31497,
-31184,
-30891,
-30524,
-30468,
-30233,
-30337,
-30312,
-30232,
-30363,
-30155,
-30466,
-30474,
-30915,
-31158,
-31685,
-31868,
-32345,
-32424,
-32793,
-32741,
-33058,
-32924,
-32929,
-32869,
-32690,
-32528,
-32530,
-32108,
-32265,
-31816,
-31737,
-31368,
-30997,
-30709,
-30337,
-30152,
-29969,
+30493,
+28799,
+27822,
+25782,
+24823,
+24164,
+22084,
+22273,
+21493,
+20994,
+21423,
+20699,
+20909,
+20414,
+21471,
+22141,
+23207,
+25594,
+26081,
+27927,
+29093,
+31159,
+33528,
+34388,
+35544,
+36988,
+36899,
+37257,
+40050,
+39443,
+39171,
+41305,
+39711,
+38054,
+39113,
+36968,
+34276,
+32926,
+30704,
+28072,
+27762,
+27220,
+23967,
+24727,
+23004,
+21331,
+21856,
+19275,
+19523,
+19271,
+19439,
+20118,
+21384,
+22505,
+22778,
+25332,
+25767,
+27545,
+29361,
+30534,
+32113,
+33132,
+35463,
+36986,
+38640,
+39982,
+40508,
+41619,
+41890,
+42146,
+42424,
+41050,
+41666,
+41523,
+40154,
+40544,
+40192,
+38623,
+38192,
+38281,
+36017,
+36450,
+36909,
+34905,
+36222,
+37238,
+36184,
+36656,
+37384,
+36759,
+37307,
+38646,
+38187,
+38556,
+39518,
+39634,
+40400,
+40536,
+40159,
+39243,
+38878,
+38109,
+37040,
+37343,
+36027,
+35849,
+35126,
+34355,
+35020,
+33328,
+33815,
+32755,
+31756,
+32649,
+30793,
+31296,
+31231,
+30790,
+31276,
+31053,
+31641,
+31531,
+32292,
+33351,
+33915,
+34699,
+36037,
+36219,
+36605,
+38123,
+36898,
+37047,
+37408,
+35887,
+35559,
+35166,
+34728,
+34326,
+34184,
+33637,
+32992,
+32888,
+32363,
+31187,
+29532,
+28574,
+27464,
+26513,
+25945,
+25775,
+26018,
+24948,
+25829,
+25945,
+24967,
+26744,
+26494,
+27108,
+28922,
+29471,
+30911,
+31398,
+31968,
+32663,
+33106,
+34169,
+34765,
+34437,
+33707,
+33877,
+33425,
+31973,
+31979,
+31121,
+28963,
+29077,
+28026,
+26388,
+26480,
+24994,
+23498,
+22839,
+23114,
+22622,
+21570,
+21606,
+20491,
+20421,
+21453,
+21755,
+22668,
+23882,
+24507,
+25738,
+26745,
+27672,
+29123,
+29702,
+30613,
+31636,
+33777,
+35266,
+36159,
+38238,
+39183,
+40199,
+40880,
+41531,
+40905,
+40593,
+40787,
+38583,
+38226,
+37357,
+35599,
+34474,
+33163,
+32305,
+31129,
+30842,
+29480,
+28804,
+28893,
+28780,
+29153,
+28866,
+30494,
+30872,
+31381,
+33455,
+33274,
+34522,
+37869,
+39153,
+40142,
+43332,
+45258,
+46656,
+48433,
+49292,
+49420,
+48943,
+48617,
+47779,
+47297,
+46889,
+46411,
+45899,
+44603,
+44017,
+43958,
+42358,
+39781,
+38421,
+36782,
+34982,
+33575,
+31775,
+31183,
+30955,
+30038,
+28769,
+29115,
+29666,
+28746,
+29596,
+28901,
+28538,
+30702,
+30716,
+31867,
+32728,
+32952,
+34741,
+35337,
+35804,
+36506,
+36519,
+35454,
+34916,
+34921,
+34323,
+33358,
+31775,
 29966,
-29943,
-30073,
-30127,
-30310,
-30418,
-30679,
-30921,
-31286,
-31581,
-32000,
-32239,
-32742,
-32898,
-33322,
-33323,
-33345,
-33247,
-32921,
-32692,
-32368,
-32134,
-31923,
-31736,
-31448,
-31235,
-30998,
-30733,
-30470,
-30232,
-30047,
-29943,
-29912,
-30051,
-30228,
-30552,
-30811,
-31078,
-31289,
-31524,
-31897,
-32186,
-32529,
-32848,
-33082,
-33402,
-33480,
-33823,
-33745,
-33929,
-33665,
-33480,
-33110,
-32741,
-32398,
-32133,
-32028,
-31632,
-31630,
-31264,
-31207,
-31052,
-31077,
-31076,
-31105,
-31101,
-31160,
-31152,
-31529,
-31789,
-32396,
-32797,
-33186,
-33456,
-33638,
-33823,
-34062,
-34192,
-34459,
-34376,
-34380,
-34034,
-33796,
-33456,
-33161,
-32875,
-32607,
-32373,
-32130,
-32005,
-31709,
-31710,
-31555,
-31550,
-31764,
-31871,
-32236,
-32401,
-32711,
-32875,
-33030,
-33322,
-33507,
-34087,
-34352,
-34748,
-34878,
-34829,
-34773,
-34511,
-34536,
-34377,
-34512,
-34218,
-33982,
-33456,
-33186,
-32718,
-32684,
-32507,
-32527,
-32504,
-32397,
-32397,
-32531,
-32555,
-33084,
-33137,
-33665,
-33691,
-34062,
-34139,
-34565,
-34666,
-35120,
-35220,
-35543,
-35432,
-35620,
-35435,
-35380,
-35146,
-34903,
-34539,
-34270,
-33852,
+29004,
+28793,
+26577,
+23400,
+22048,
+21972,
+21192,
+20865,
+20080,
+19988,
+22686,
+22406,
+22301,
+24016,
+24491,
+25063,
+25541,
+27216,
+28207,
+28726,
+29935,
+29793,
+29414,
+29839,
+30046,
+29126,
+28823,
+29768,
+30380,
+30748,
+30927,
+30554,
+31689,
+33736,
+33527,
+32844,
+32274,
+32580,
+33403,
+32422,
+31441,
+31831,
+31304,
+29920,
+30178,
+32496,
+43505,
+47069,
+38114,
+37427,
+38928,
+39734,
+32024,
+23514,
+23115,
+17133,
+17758,
+23169,
+28409,
+32168,
+32298,
+39092,
+46000,
+47669,
+47464,
+46617,
+44918,
+42532,
+39932,
+42847,
+44391,
+37774,
+33268,
+29684,
+27883,
+26534,
+22573,
+15706,
+11007,
+13431,
+14639,
+18703,
+20639,
+16358,
+13896,
+15399,
+16739,
+14717,
+22424,
+27703,
+24765,
+30999,
+45045,
+58021,
+59216,
+58830,
+61058,
+58762,
+56641,
+52100,
+45752,
+38568,
+32674,
+32898,
+35704,
+36592,
+35181,
+35816,
+39630,
+41613,
+40406,
+37995,
+37087,
+36327,
+35094,
+35176,
+33902,
+34905,
+36212,
 33769,
-33429,
-33373,
-33032,
-32977,
-32663,
-32687,
-32689,
-32740,
-32978,
-33084,
-33190,
-33480,
-33612,
-34009,
-34402,
-34566,
-34983,
-34908,
-34957,
-34907,
-34906,
+33667,
+35967,
+37572,
+35405,
+32979,
+33525,
+32700,
+33213,
+35247,
+36092,
 35013,
-35143,
-35143,
-35172,
-34825,
-34697,
-34245,
-34166,
-33851,
-33717,
-33534,
-33242,
-32951,
-32610,
-32449,
-32320,
-32501,
-32479,
-32712,
-32769,
-32898,
-33058,
-33137,
-33480,
-33692,
-33981,
-34220,
-34457,
-34511,
-34747,
-34668,
-34775,
-34957,
-34778,
-35061,
-34829,
-34957,
-34802,
-34615,
-34432,
-34192,
-33955,
-33851,
-33585,
-33612,
-33271,
-33187,
-32848,
-32740,
-32662,
-32660,
-32770,
-32922,
-33087,
-33268,
-33453,
-33666,
-33901,
-34168,
-34378,
-34510,
-34668,
-34643,
-34719,
-34936,
-35114,
-35279,
-35564,
-35436,
-35670,
-35410,
-35328,
-35064,
-34855,
-34534,
-34380,
-34007,
-33878,
-33531,
-33482,
-33082,
-33033,
-32660,
-32663,
-32450,
-32475,
-32374,
-32288,
-32427,
-32264,
-32397,
-32504,
-32450,
-32819,
-32717,
-33080,
-33035,
-33346,
-33402,
-33797,
-33876,
-34219,
-34274,
-34323,
+34632,
 34248,
-34034,
-33875,
-33562,
-33425,
-33084,
-32981,
-32658,
-32453,
-32211,
-31922,
-31792,
-31364,
-31504,
-31046,
-31292,
-31048,
-31158,
-31077,
-31023,
-31000,
-31022,
-31078,
-31262,
-31552,
-31844,
-32158,
-32294,
-32499,
-32456,
-32523,
-32403,
-32368,
-32319,
-32133,
-32160,
-31842,
-31819,
-31470,
-31449,
-31128,
-31131,
-30998,
-30865,
-30919,
-30655,
-30653,
-30604,
-30546,
-30789,
-30813,
-31127,
-31345,
-31364,
-31503,
-31365,
-31421,
-31367,
-31501,
-31657,
-31897,
-31893,
-32004,
-31761,
-31530,
-31283,
-31135,
-31047,
-31078,
-31079,
-31047,
-30923,
-30861,
-30659,
-30599,
-30682,
-30655,
-30811,
-30868,
-30812,
-30919,
-30839,
-31052,
-31101,
-31343,
-31525,
-31737,
-31898,
-31998,
-31925,
-31788,
-31685,
-31394,
-31368,
-31235,
-31263,
-31233,
-31212,
-30943,
-30840,
-30418,
-30362,
-30207,
-30206,
-30204,
-29970,
-29940,
-29731,
-29624,
-29785,
-29648,
-30157,
-30016,
-30448,
-30412,
-30686,
-30782,
-31028,
-31285,
-31449,
-31815,
-31924,
-32290,
-32267,
-32395,
-32215,
-32000,
-31686,
-31498,
-31343,
-31338,
-31371,
-31153,
-31212,
-30732,
-30549,
-30179,
-29995,
-29888,
-29784,
+33346,
+37382,
+36395,
+29524,
+28055,
+30773,
+31688,
+30817,
+31625,
+30572,
+29337,
+35183,
+39946,
+35891,
+32498,
+32685,
+32709,
+33364,
+34558,
+31734,
+27970,
+30278,
+35296,
+34545,
+32623,
+33741,
+29025,
+30104,
+29536,
+38457,
+50591,
+33721,
+33911,
+41962,
+45529,
+43310,
+27922,
+33556,
+30572,
+25243,
+28352,
+29955,
+36899,
+29389,
+29616,
+42685,
+42439,
+33287,
+28654,
+30544,
+29113,
+19872,
+11469,
+11498,
+16705,
+20739,
+16268,
+11909,
+19713,
+26075,
+19667,
+14127,
+16225,
+9906,
+3678,
+4656,
+683,
+65535,
+251,
+65535,
+623,
+65535,
+14512,
+29915,
+32003,
+52049,
+65534,
+65075,
+65534,
+65534,
+65231,
+65534,
+57814,
+43323,
+35773,
+27455,
+19162,
+17266,
+24487,
+30770,
+28854,
+28902,
+33213,
+38013,
+36794,
+30241,
+28251,
+33282,
+40259,
+40345,
+38594,
+44540,
+49548,
+48564,
+48983,
+49406,
+44251,
+41467,
+44260,
+43031,
+37488,
+35243,
+35593,
+33310,
+33952,
+34829,
+27545,
+23614,
+30077,
+34882,
+30890,
+29907,
+35191,
+38419,
+41900,
+47020,
+47469,
+44269,
+45706,
+47657,
+42134,
+35745,
+32776,
+26101,
+20788,
+23094,
+23537,
+19318,
+18813,
+24169,
+27537,
+27676,
+27710,
+25504,
+24278,
+26223,
+27566,
+26400,
+26640,
+31769,
+35772,
+37476,
+41244,
+45000,
+44504,
+43458,
+43000,
+39828,
+37287,
+34209,
+31331,
+28476,
+26492,
+29366,
+33003,
+36646,
+37564,
+38071,
+43576,
+45927,
+42757,
+39673,
+39202,
+39675,
+36714,
+35080,
+38387,
+40211,
+40279,
+39657,
+39913,
+41018,
+36707,
+31088,
+29456,
+28745,
+26599,
+24045,
+26215,
+30734,
+33029,
+36503,
+37721,
+36342,
+36716,
+34590,
+27844,
+19774,
+13437,
+9746,
+7575,
+5222,
+3790,
+2424,
+3521,
+5212,
+4774,
+5565,
+3066,
+1107,
+65535,
+1881,
+6331,
+3087,
+921,
+599,
+65535,
+8410,
+31706,
+38121,
+32756,
+53303,
+65534,
+64403,
+65534,
+64819,
+65534,
+61546,
+48713,
+50215,
+45054,
+19215,
+10070,
+29664,
+43333,
+38814,
+31011,
+34688,
+47537,
+52924,
+48276,
+36427,
+31977,
+47407,
+55266,
+44831,
+45605,
+54566,
+51880,
+44373,
+43083,
+41422,
+28626,
+20135,
+24205,
+22113,
+17950,
+20598,
+19427,
+18929,
+28002,
+32753,
+21929,
+17719,
+30818,
+38696,
+34124,
+32700,
+40761,
+46665,
+51465,
+56998,
+53256,
+45334,
+44225,
+43915,
+35471,
+26335,
+21099,
+16035,
+13659,
+18092,
+23095,
+24485,
+28765,
+39279,
+47254,
+50287,
+53694,
+53318,
+53624,
+54746,
+53357,
+51519,
+51099,
+55878,
+56183,
+54023,
+56804,
+56173,
+50794,
+45354,
+42659,
+38696,
+31173,
+26849,
+26540,
+27118,
+27513,
+28025,
+27907,
+28157,
+29251,
+27341,
+24340,
+23693,
+23083,
+19381,
+15400,
+12386,
+7385,
+1599,
+65535,
+129,
+65535,
+25,
+30,
+65535,
+204,
+65535,
+460,
+65535,
+729,
+65535,
+2659,
+30130,
+49440,
+61750,
+65534,
+64933,
+65534,
+65534,
+65041,
+65534,
+59482,
+30153,
+12998,
+5101,
+65535,
+65535,
+1850,
+10312,
+13419,
+22928,
+29697,
+34656,
+42307,
+40244,
+36496,
+38394,
+51577,
+59039,
+54324,
+57572,
+65534,
+63324,
+56548,
+55232,
+47644,
+37829,
+32194,
+29726,
+25864,
+20761,
+23631,
+22702,
+20538,
+27181,
+31270,
+28461,
+30162,
+39257,
+43599,
+41652,
+43916,
+50879,
+55233,
+57615,
+59359,
+59100,
+57233,
+54985,
+50535,
+42002,
+35104,
+28971,
+21583,
+15972,
+15174,
+21440,
+25403,
+27418,
+34324,
+43749,
+51974,
+51370,
+47896,
+48664,
+49070,
+46520,
+42447,
+44522,
+50322,
+52468,
+54378,
+58533,
+61313,
+60755,
+55663,
+47064,
+40051,
+33340,
+24878,
+14496,
+8811,
+10052,
+8835,
+8375,
+10108,
+12680,
+16282,
+17355,
+15735,
+8338,
+1300,
+101,
+65535,
+65535,
+24,
+65535,
+67,
+65535,
+122,
+65535,
+131,
+65535,
+65535,
+291,
+65535,
+15520,
+35783,
+52883,
+65534,
+65350,
+65534,
+65397,
+65534,
+64769,
+65534,
+53809,
+30398,
+18575,
+4160,
+65535,
+3332,
+16280,
+17713,
+14836,
+26620,
+37999,
+39240,
+33256,
 29834,
-29653,
-29755,
-29812,
-29860,
-30285,
-30365,
-30759,
-31025,
-31368,
-31736,
-32055,
-32424,
-32528,
-32769,
-32845,
-32901,
-32976,
-32954,
-32819,
-32609,
-32160,
-31763,
-31315,
-31130,
-30971,
+29019,
+36888,
+48402,
+47366,
+47864,
+59559,
+65534,
+63307,
+62446,
+63520,
+56228,
+45535,
+42066,
+41441,
+31823,
+23295,
+21684,
+18490,
+20500,
+22672,
+18091,
+17844,
+25840,
+34305,
+34756,
+35408,
+44997,
+55240,
+60620,
+63059,
+65253,
+65518,
+64013,
+58857,
+48898,
+39353,
+29335,
+25342,
+23198,
+19126,
+21597,
+26644,
+34056,
+40722,
+48085,
+54435,
+51703,
+47604,
+47105,
+44999,
+39849,
+35161,
+34399,
+39482,
+46214,
+53889,
+57982,
+57153,
+61109,
+62364,
+54714,
+42650,
+30928,
+22165,
+13125,
+4696,
+190,
+65535,
+65,
+65535,
+42,
+65535,
+18,
+65535,
+6,
+65535,
+18,
+65535,
+64,
+65535,
+119,
+65535,
+82,
+25,
+65535,
+579,
+65535,
+17418,
+39151,
+51410,
+65534,
+65534,
+65437,
+65534,
+65421,
+65534,
+65270,
+65534,
+52492,
+32323,
+11190,
+65535,
+65535,
+12006,
+21424,
+12124,
+15911,
+33128,
+43268,
+34699,
+18171,
+14543,
+22829,
+34379,
+35385,
+31121,
+39590,
+55062,
+59433,
+56533,
+56731,
+54125,
+47855,
+44669,
+48943,
+47893,
+37589,
+32207,
+32111,
+32950,
+30624,
+21029,
+11482,
+12982,
+21778,
+22396,
+12930,
+13327,
+28305,
+40451,
+43156,
+44740,
+49374,
+55808,
+61150,
+60376,
+54214,
+49740,
+54009,
+55217,
+50641,
+51945,
+57721,
+62212,
+60425,
+59072,
+59095,
+54020,
+43280,
+31343,
+24264,
+20912,
+17780,
+14139,
+18168,
+32078,
+47641,
+58289,
+63891,
+65534,
+65422,
+65520,
+65534,
+60086,
+47565,
+34019,
+22660,
+9331,
+151,
+35,
+12,
+65535,
+53,
+65535,
+42,
+65535,
+7,
+12,
+65535,
+39,
+65535,
+4,
+64,
+65535,
+367,
+65535,
+1053,
+65535,
+9181,
+38636,
+55807,
+65373,
+65534,
+65216,
+65534,
+65168,
+65534,
+64857,
+65534,
+57541,
+38368,
+20264,
+1581,
+498,
+19712,
+29549,
+21021,
+18677,
+29924,
+40481,
+32145,
+16740,
+11961,
+19608,
+35335,
+41719,
+40227,
+51164,
+64658,
+65534,
+65339,
+65534,
+60432,
+49382,
+41101,
+40320,
+37157,
+27101,
+20920,
+19800,
+18574,
+18588,
+12916,
+4359,
+7716,
+20290,
+25139,
+18052,
+18836,
+36198,
+50270,
+51395,
+49154,
+48019,
+49736,
+52769,
+47711,
+35600,
+28349,
+34853,
+45330,
+46142,
+55095,
+65534,
+65059,
+65534,
+65010,
+65534,
+61449,
+43596,
+32921,
+20746,
+10302,
+7275,
+7859,
+14247,
+23971,
+41016,
+53873,
+54772,
+58416,
+65534,
+63733,
+54204,
+41936,
+33555,
+30937,
+26315,
+19453,
+9571,
+7730,
+16263,
+11353,
+710,
+65535,
+63,
+65535,
+60,
+65535,
+19,
+4,
+65535,
+65535,
+64,
+65535,
+343,
+65535,
+1006,
+65535,
+9535,
+41981,
+60411,
+65534,
+65534,
+65368,
+65534,
+65244,
+65534,
+64969,
+65534,
+61023,
+46235,
+25124,
+1062,
+4272,
+22433,
+25030,
+19038,
+17670,
+24780,
+29414,
+23120,
+13039,
+8570,
+20016,
+41253,
+47922,
+52421,
+64372,
+65534,
+65381,
+65534,
+65529,
+64761,
+54556,
+41709,
+30790,
+20808,
+18325,
+18170,
+12653,
+12638,
+18401,
+16879,
+13099,
+20019,
+29056,
+25235,
+16134,
+20005,
+34435,
+41955,
+39659,
+35465,
+34715,
+41853,
+46722,
+36504,
+22599,
+18655,
+29927,
+40550,
+42074,
+55200,
+65534,
+65324,
+65534,
+65394,
+65303,
+50521,
+31062,
+19280,
+7543,
+4901,
+8651,
+11687,
+16989,
+29876,
+51482,
+61735,
+55778,
+58482,
+63651,
+54912,
+41270,
+30220,
+24455,
+20948,
+17539,
+11622,
+3049,
+6643,
+13743,
+5301,
+65535,
+376,
+65535,
+105,
+65535,
+17,
+65535,
+48,
+65535,
+146,
+65535,
+194,
+65535,
+65535,
+359,
+65535,
+19596,
+41813,
+56151,
+65534,
+64994,
+65534,
+65496,
+65478,
+65534,
+65389,
+65534,
+64206,
+59769,
+43207,
+35845,
+52239,
+58795,
+54022,
+48142,
+36830,
+25561,
+17421,
+9101,
+1586,
+65535,
+10969,
+29712,
+36715,
+52391,
+65534,
+65108,
+65534,
+65449,
+65510,
+65282,
+55351,
+43327,
+31927,
+26908,
+31008,
+23833,
+13545,
+16044,
+21681,
+19583,
+18734,
+26211,
+29084,
+26570,
+29248,
+38948,
+46369,
+43994,
+38972,
+35547,
+35280,
+38570,
+32122,
+21182,
+20895,
+33847,
+49493,
+54347,
+61368,
+65534,
+65194,
+65534,
+65534,
+62747,
+49612,
+27984,
+6909,
+65535,
+330,
+65535,
+4986,
+14482,
+23077,
+36879,
+53334,
+57423,
+54132,
+55177,
+52910,
+45707,
+38683,
+34519,
 30999,
-30864,
-30709,
-30337,
-30020,
-29706,
-29701,
-29811,
-30180,
-30494,
-30868,
-31102,
-31394,
-31633,
-31920,
-32452,
-32739,
-33298,
-33582,
-33774,
-33980,
-34034,
-34117,
-34004,
-33933,
-33688,
-33483,
-33135,
-32900,
-32503,
-32186,
-31869,
-31474,
-31366,
-31078,
-31342,
-31155,
-31579,
-31341,
-31473,
-31395,
-31499,
-31790,
-32265,
-32847,
-33348,
-33850,
-34061,
-34352,
-34509,
-34802,
-35115,
-35358,
-35538,
-35462,
-35143,
-34905,
-34512,
-34218,
-34063,
-33716,
-33613,
-33241,
-32928,
-32712,
+26625,
+23039,
+13495,
+6063,
+8597,
+4426,
+65535,
+302,
+65535,
+64,
+65535,
+2,
+65535,
+19,
+65535,
+10,
+46,
+65535,
+335,
+65535,
+1066,
+65535,
+12265,
+45796,
+60403,
+65313,
+65534,
+65342,
+65534,
+65444,
+65534,
+65432,
+65534,
+61886,
+64580,
+60096,
+50157,
+60409,
+65534,
+64822,
+65534,
+52174,
+29550,
+14164,
+3358,
+333,
+65535,
+972,
+19580,
+34266,
+48933,
+65534,
+65385,
+65431,
+65534,
+64952,
+65534,
+54202,
+35525,
+25251,
+25525,
+38430,
+36278,
+20501,
+19190,
+30382,
+32211,
+22851,
+25301,
+33554,
+32060,
+31505,
+38689,
+47694,
+49834,
+42573,
+30711,
+22430,
+28573,
+32408,
+20672,
+14046,
+28058,
+51024,
+60937,
+63188,
+65534,
+65146,
+65534,
+63151,
+53382,
+47561,
+39401,
+22296,
+7460,
+10172,
+23116,
+27580,
+23999,
+24280,
+36093,
+47609,
+44865,
+34666,
+31139,
+34731,
+33723,
+27405,
+23794,
+26240,
+28207,
+23561,
+18405,
+16395,
+17635,
+12893,
+1896,
+65535,
+252,
+65535,
+130,
+65535,
+66,
+65535,
+82,
+65535,
+166,
+65535,
+215,
+65535,
+35,
+221,
+65535,
+25329,
+51024,
+59826,
+65534,
+65265,
+65523,
+65534,
+65251,
+65534,
+64969,
+63862,
+65473,
+65534,
+65514,
+65489,
+65534,
+65250,
+65534,
+60225,
+32148,
+5392,
+65535,
+65535,
+610,
+65535,
+7955,
+27899,
+43895,
+62142,
+65534,
+65086,
+63422,
+61956,
+65534,
+58864,
+45010,
+36578,
+36365,
+48007,
+48822,
+34290,
+23137,
+28252,
+35035,
+25924,
+23846,
+33547,
+40112,
+42509,
+46028,
+51540,
+53202,
+46556,
+34273,
+20188,
+15439,
+20374,
+17242,
+9845,
+15646,
+33801,
+48788,
+55902,
+59068,
+61852,
+62139,
+58407,
+54243,
+47554,
+39200,
+31240,
+23916,
+24750,
 32532,
-32580,
-32610,
-32792,
-32769,
-33162,
-33190,
-33666,
-33980,
-34274,
-34694,
-34853,
-35119,
-35326,
-35729,
-36089,
-36311,
-36618,
-36521,
-36620,
-36360,
-36384,
-36122,
-36040,
-35754,
-35378,
-35067,
-34641,
-34299,
-34062,
-34007,
-33930,
-33927,
-34064,
-34033,
+36107,
+35449,
+34744,
+39512,
+44985,
+41498,
+36118,
+30864,
+28031,
+27679,
+26249,
+24288,
+23077,
+24587,
+23247,
+17801,
+13387,
+12640,
+10727,
+4100,
+65535,
+48,
+65535,
+65535,
+22,
+65535,
+65535,
+54,
+65535,
+187,
+65535,
+300,
+65535,
+252,
+65535,
+1793,
+32558,
+51638,
+54286,
+65534,
+65447,
+65292,
+65534,
+64519,
+65534,
+54984,
+52124,
+65534,
+65297,
+65534,
+65527,
+65534,
+65373,
+65534,
+62997,
+37112,
+9848,
+322,
+65535,
+425,
+65535,
+2427,
+11880,
+23070,
+43041,
+56230,
+48688,
+39917,
+42894,
+50326,
+49070,
+46518,
+46349,
+47670,
+55639,
+58467,
+50416,
+42316,
+44797,
+48313,
+40353,
+38324,
+51792,
+61399,
+59731,
+56898,
+58976,
+58743,
+51041,
+39772,
+25380,
+15634,
+16841,
+20272,
+18074,
+20292,
+32988,
+43455,
+44914,
+45380,
+46919,
+43343,
+35499,
+29338,
+28201,
+28922,
+29223,
+27197,
+23624,
+28586,
+36355,
+35760,
+30064,
+26681,
+29394,
+29172,
+27250,
+28663,
+30274,
+32668,
+35151,
+35346,
+33402,
+33505,
+32789,
+25022,
+13383,
+7585,
+9478,
+9006,
+2741,
+65535,
+158,
+65535,
+27,
+10,
+65535,
+68,
+65535,
+76,
+65535,
+65535,
+185,
+65535,
+711,
+65535,
+22322,
+57427,
+60610,
+62903,
+65534,
+64585,
+65534,
+64616,
+65534,
+62499,
+52519,
+61858,
+65534,
+64842,
+65534,
+65135,
+65534,
+65090,
+65534,
+55771,
+37910,
+25119,
+8377,
+203,
+1453,
+7039,
+15475,
+21194,
+32140,
+38296,
+31822,
+23883,
+23153,
+29714,
+31038,
+28772,
+28888,
+33965,
+45865,
+51423,
+47723,
+42303,
+44097,
+53710,
+56853,
+56315,
+62825,
+65534,
+65278,
+65534,
+65534,
+65305,
+65534,
+59523,
+45760,
+36696,
+30643,
+27491,
+26762,
+27152,
+31842,
+40405,
+44656,
+41353,
+35839,
+31645,
+25891,
+17193,
+13027,
+13643,
+14809,
+17922,
+20311,
+25220,
+32060,
+35023,
+33711,
+28229,
+26317,
+26245,
+21303,
+17632,
+18489,
+21767,
+25489,
+26591,
+28663,
+31434,
+31965,
+30567,
+23968,
+17666,
+16344,
+17580,
+17370,
+12892,
+8592,
+7674,
+6732,
+1881,
+65535,
+166,
+65535,
+16,
+7,
+12,
+65535,
+203,
+65535,
+733,
+65535,
+11147,
+35005,
+42133,
+46239,
+52255,
+61944,
+64386,
+60463,
+58832,
+49475,
+47804,
+54006,
+60939,
+65534,
+64030,
+64857,
+65534,
+65123,
+65534,
+57195,
+43565,
+34585,
+28259,
+29513,
+31587,
+32578,
+34702,
+39606,
+50959,
+57528,
+53290,
+47088,
+44175,
+43898,
+43245,
+38847,
+32709,
+30447,
+30295,
+29185,
+28347,
+28506,
+32506,
+37666,
+41922,
+47449,
+51948,
+55133,
+56725,
+55337,
+52459,
+50157,
+45957,
+40089,
+35329,
+31642,
+33152,
+37279,
+40268,
+42415,
+44117,
+47464,
+50212,
+48383,
+43355,
+38347,
+34788,
 34352,
-34405,
-34745,
-34857,
-35194,
-35436,
-35776,
-36149,
-36515,
-36783,
-37044,
-37152,
-37202,
-37311,
-37334,
-37336,
-37365,
-37013,
-36920,
-36431,
-36311,
-35828,
-35910,
-35461,
-35514,
-35036,
-34963,
-34558,
-34620,
-34454,
-34617,
-34722,
-34904,
-35120,
 35353,
-35620,
-35857,
-36199,
-36281,
-36516,
-36597,
-36727,
-36888,
-37045,
-37177,
-37257,
-37254,
-37154,
-36990,
-36863,
-36593,
-36414,
-36145,
-35885,
-35671,
-35409,
-35328,
-35196,
-35145,
-35090,
-34933,
-34987,
-34771,
-34989,
-34798,
-34987,
-34932,
-35143,
-35198,
-35512,
-35701,
-35881,
-36069,
-36015,
-36042,
-36041,
-36096,
-36172,
-36360,
-36279,
-36358,
-36175,
-36067,
-36068,
-35885,
-35933,
-35754,
-35618,
-35407,
-35252,
-35009,
-35093,
-34985,
-35010,
-34909,
-34798,
-34670,
-34590,
-34481,
-34566,
-34455,
-34776,
-34640,
-35014,
-35037,
-35197,
-35356,
-35380,
-35488,
-35514,
-35565,
-35621,
-35644,
-35567,
-35487,
-35302,
-35119,
-34983,
-34909,
-34744,
-34645,
-34377,
-33929,
-33746,
-33319,
-33244,
-33163,
-33004,
-33086,
-32659,
-32690,
-32290,
-32294,
-32289,
-32427,
-32738,
-32848,
-33163,
-33241,
-33429,
-33585,
-33666,
-33901,
-33984,
-34059,
-34141,
-34009,
-33928,
-33771,
-33508,
-33372,
-33192,
-33082,
-32954,
-32766,
-32504,
-32212,
-31868,
-31766,
-31524,
-31529,
-31442,
-31346,
-31177,
-31003,
-30889,
-30868,
-30970,
-31130,
-31341,
-31526,
-31686,
-31814,
-31925,
-31997,
-32007,
-32049,
-31847,
-31786,
-31503,
-31392,
-31210,
-31077,
-30944,
-30814,
-30708,
-30573,
-30420,
-30228,
-30157,
-29911,
-29867,
-29752,
-29707,
-29755,
-29625,
-29705,
-29702,
-29732,
-29913,
-29944,
-30204,
-30232,
-30391,
-30311,
-30390,
-30286,
-30415,
-30339,
-30364,
-30258,
-30047,
-29757,
-29492,
-29283,
-29174,
-29151,
-29174,
-29176,
-29124,
-29016,
-28913,
-28726,
-28674,
-28701,
-28672,
-28915,
-28934,
-28943,
-29144,
-28916,
-29225,
+36552,
+40342,
+44500,
+47091,
+48761,
+47723,
+46797,
+45603,
+41883,
+38914,
+36814,
+37138,
+38136,
+37811,
+40299,
+42068,
+42239,
+42167,
+41903,
+40090,
+35355,
+32261,
+30312,
+28855,
+28738,
+28357,
+26218,
+22474,
+21365,
+20310,
+14177,
+5642,
+307,
+65535,
+56,
+65535,
+40,
+65535,
+21,
+65535,
+15,
+65535,
+26,
+65535,
+45,
+65535,
+37,
+65535,
+132,
+4652,
+11162,
+18186,
+22174,
+24114,
+27939,
+29940,
+34405,
+38628,
+40192,
+42050,
+46175,
+50706,
+50444,
+49578,
+50702,
+50648,
+48889,
+50326,
+55018,
+58445,
+61708,
+65056,
+65534,
+65461,
+65534,
+65496,
+65534,
+65518,
+65534,
+65534,
+65519,
+65534,
+65492,
+65534,
+65449,
+65534,
+64599,
+59451,
+53927,
+50367,
+47293,
+41873,
+34837,
+27562,
+21928,
+17976,
+12813,
+9208,
+8971,
+10434,
+12407,
+14371,
+18100,
+22781,
+24854,
+24794,
+22786,
+21979,
+22640,
+22337,
+22783,
+24743,
+27603,
+29360,
+31106,
+32549,
+32735,
+33133,
+33610,
+33338,
+32063,
+33126,
+36717,
+39426,
+41827,
+44981,
+47299,
+48767,
+50678,
+51207,
+48813,
+45191,
+43723,
+43972,
+43659,
+43603,
+42462,
+38530,
+35025,
+33362,
+31143,
+25623,
+18964,
+14013,
+9809,
+5525,
+1306,
+65535,
+76,
+65535,
+19,
+65535,
+65535,
+2,
+3,
+65535,
+24,
+65535,
+55,
+65535,
+84,
+65535,
+509,
+5794,
+11517,
+18326,
+28143,
+37738,
+44484,
+49670,
+58164,
+64688,
+65534,
+65508,
+65534,
+65516,
+65534,
+65522,
+65534,
+65530,
+65534,
+65534,
+65531,
+65534,
+65534,
+65529,
+65534,
+65509,
+65534,
+65481,
+65534,
+65454,
+65534,
+65118,
+61790,
+60419,
+57145,
+49927,
+43268,
+36777,
+30531,
+23716,
+17224,
+10208,
+4787,
+1499,
+65535,
+72,
+65535,
+25,
+65535,
+572,
+2840,
+6765,
+10348,
+12742,
+14013,
+16269,
+21939,
+27914,
+33104,
+38579,
+44327,
+48020,
+49807,
+50891,
+49820,
+46955,
+44700,
+43113,
+41233,
+41222,
+43161,
+44647,
+45669,
+47444,
+48375,
+46978,
+45010,
+42609,
+38412,
+33462,
+31230,
+30593,
+29045,
+29009,
+29590,
+28809,
+26198,
+22762,
+19902,
+16469,
+13317,
+11412,
+8112,
+4296,
+2943,
+1088,
+65535,
+89,
+65535,
+21,
+65535,
+65535,
+5,
+65535,
+65535,
+15,
+65535,
+45,
+65535,
+84,
+65535,
+550,
+5478,
+12166,
+19266,
+27699,
+38800,
+49991,
+59620,
+65315,
+65534,
+65507,
+65534,
+65498,
+65534,
+65510,
+65534,
+65525,
+65534,
+65531,
+65533,
+65532,
+65534,
+65534,
+65529,
+65534,
+65512,
+65534,
+65484,
+65534,
+65448,
+65534,
+64933,
+60840,
+57729,
+54293,
+48909,
+43490,
+37337,
+30184,
+22300,
+15430,
+9900,
+4095,
+186,
+65535,
+30,
+65535,
+24,
+65535,
+17,
+65535,
+32,
+65535,
+1161,
+3649,
+7131,
+12937,
+20148,
+27923,
+36025,
+42339,
+46334,
+49090,
+50520,
+50106,
+48180,
+46048,
+44924,
+45301,
+46938,
+48713,
+49233,
+49709,
+49225,
+46482,
+42893,
+38413,
+33087,
+27275,
+23556,
+22786,
+21429,
+19971,
+20251,
+20345,
+18539,
+14970,
+11402,
+8219,
+4646,
+2595,
+1078,
+65535,
+41,
+65535,
+0,
+9,
+65535,
+8,
+65535,
+3,
+0,
+65535,
+65535,
+6,
+65535,
+23,
+18,
+922,
+1863,
+2295,
+5601,
+11836,
+18866,
+26553,
+35902,
+46931,
+57117,
+63919,
+65534,
+65443,
+65534,
+65510,
+65534,
+65531,
+65530,
+65534,
+65530,
+65534,
+65532,
+65534,
+65530,
+65534,
+65528,
+65534,
+65525,
+65534,
+65527,
+65531,
+65534,
+65491,
+65534,
+64052,
+61335,
+58778,
+55053,
+50469,
+45056,
+38724,
+32265,
+25764,
+19386,
+13467,
+7615,
+2159,
+65535,
+51,
+65535,
+65535,
+14,
+65535,
+12,
+3,
+65535,
+69,
+65535,
+3195,
+10022,
+16282,
+23080,
+29667,
+34503,
+38234,
+41922,
+44757,
+46265,
+48434,
+51645,
+54719,
+56886,
+58418,
+58908,
+58277,
+57299,
+54706,
+49898,
+44934,
+41084,
+37293,
+33077,
+29898,
+28376,
+27126,
+25735,
+24778,
+23078,
+19774,
+16000,
+12657,
+10041,
+7773,
+5518,
+3097,
+780,
+65535,
+26,
+65535,
+7,
+65535,
+1,
+2,
+65535,
+3,
+65535,
+6,
+65535,
+14,
+65535,
+14,
+65535,
+65535,
+16,
+27,
+3082,
+8251,
+14249,
+24284,
+36322,
+45761,
+52245,
+59621,
+65210,
+65534,
+65484,
+65534,
+65491,
+65534,
+65508,
+65534,
+65527,
+65534,
+65534,
+65530,
+65534,
+65533,
+65529,
+65534,
+65509,
+65534,
+65463,
+65534,
+64715,
+61881,
+59493,
+56732,
+52935,
+49130,
+45741,
+41348,
+35223,
+28839,
+23066,
+17815,
+12723,
+7774,
+3667,
+896,
+65535,
+30,
+65535,
+7,
+2,
+65535,
+39,
+65535,
+1781,
+6680,
+13272,
+20001,
+25902,
+31962,
+37854,
+42598,
+46181,
+49210,
+52321,
+55563,
+59050,
+62529,
+65010,
+65534,
+65466,
+65534,
+64158,
+60537,
+55434,
+48948,
+42324,
+36280,
+31082,
+26744,
+23489,
+21090,
+19460,
+19240,
+19087,
+17229,
+14253,
+11446,
+9632,
+8879,
+7608,
+4884,
+2250,
+1526,
+2437,
+1877,
+167,
+65535,
+28,
+65535,
+20,
+65535,
+8,
+65535,
+0,
+4,
+65535,
+2,
+2,
+65535,
+30,
+65535,
+1320,
+4291,
+7347,
+11877,
+19246,
+28101,
+36137,
+43236,
+50888,
+59234,
+64731,
+65534,
+65485,
+65534,
+65511,
+65534,
+65525,
+65534,
+65529,
+65534,
+65527,
+65534,
+65518,
+65534,
+65514,
+65534,
+65529,
+65515,
+65534,
+62996,
+60038,
+58183,
+55039,
+51770,
+48844,
+45376,
+41017,
+35560,
 29126,
-29332,
-29546,
-29519,
-29730,
-29546,
-29333,
-29283,
-28963,
-29150,
-28885,
-29122,
-28888,
-28829,
-28518,
-28170,
-28095,
-27802,
-27908,
-27934,
-27961,
-28147,
-27986,
-28068,
-27986,
-27988,
-28146,
-28119,
-28516,
-28435,
-28755,
-28725,
-28887,
-28910,
-28965,
-29150,
-29148,
-29414,
-29361,
-29307,
-29361,
-28965,
-29016,
-28754,
-28727,
-28699,
-28570,
-28515,
-28303,
-28175,
-27958,
-27910,
-27854,
-28015,
-27986,
-28307,
-28248,
-28544,
-28489,
-28619,
-28625,
-28643,
-28811,
-28775,
-29127,
-29145,
-29417,
-29463,
-29628,
-29728,
-29864,
-29887,
-30101,
-30073,
-30153,
-30022,
-29808,
-29785,
-29517,
-29625,
+22876,
+17493,
+12582,
+7735,
+3967,
+2254,
+945,
+65535,
+17,
+65535,
+15,
+65535,
+203,
+1725,
+5341,
+11421,
+18084,
+23946,
+30042,
+36831,
+42505,
+46091,
+48888,
+51810,
+54968,
+58279,
+61252,
+64141,
+65534,
+65534,
+65465,
+65534,
+64489,
+59355,
+52463,
+45120,
+37357,
+29526,
+22812,
+18119,
+14590,
+11929,
+10850,
+11262,
+11152,
+9505,
+7816,
+7153,
+6909,
+6301,
+5049,
+3927,
+3998,
+5246,
+7079,
+8623,
+9613,
+10299,
+10805,
+11355,
+11388,
+9925,
+7480,
+5229,
+3145,
+1416,
+529,
+289,
+97,
+345,
+2727,
+7225,
+11451,
+13911,
+15616,
+19046,
+24728,
+30051,
+33794,
+37410,
+42168,
+47467,
+51894,
+55336,
+58488,
+60988,
+63683,
+65534,
+65521,
+65531,
+65534,
+65520,
+65534,
+65524,
+65534,
+65530,
+65534,
+65531,
+65534,
+65523,
+65534,
+65499,
+65534,
+65085,
+63628,
+62104,
+59460,
+54940,
+49707,
+44937,
+40380,
+35722,
+31062,
+26741,
+23274,
+20758,
+18954,
+17402,
+15516,
+13140,
+10458,
+7862,
+5485,
+2870,
+626,
+475,
+2580,
+6071,
+10733,
+16194,
+21571,
+25845,
+29139,
+32531,
+36312,
+40064,
+43490,
+46898,
+51092,
+55506,
+58568,
+60005,
+60387,
+59589,
+57158,
+53463,
+49024,
+43996,
+39014,
+34983,
+31667,
+28521,
+25930,
+24309,
+23158,
+21663,
+19602,
+17102,
+14902,
+13839,
+13601,
+13175,
+12671,
+13061,
+14387,
+15618,
+16038,
+16087,
+16093,
+16081,
+15391,
+13662,
+10910,
+7879,
+4122,
+463,
+65535,
+72,
+65535,
+54,
+65535,
+62,
+65535,
+109,
+65535,
+1249,
+7800,
+14599,
+19457,
+23724,
+27658,
+31312,
+34119,
+36554,
+39253,
+42530,
+46869,
+52440,
+58380,
+63369,
+65534,
+65518,
+65534,
+65534,
+65526,
+65534,
+65527,
+65534,
+65534,
+65529,
+65534,
+65525,
+65534,
+65534,
+65520,
+65534,
+65453,
+65534,
+63196,
+58199,
+54437,
+51125,
+47872,
+44747,
+42407,
+40947,
+39820,
+38842,
+37461,
+35336,
+32803,
+30078,
+27408,
+25094,
+22630,
+19855,
+17471,
+16569,
+17215,
+18263,
+19168,
+20203,
+21414,
+23179,
+25928,
+29035,
+31837,
+34107,
+36330,
+38975,
+41836,
+44342,
+45303,
+44367,
+42915,
+42030,
+41033,
+38987,
+36331,
+34283,
+33065,
+31951,
+30630,
+29234,
+28265,
+27702,
+26815,
+25469,
+24298,
+24100,
+24608,
+25000,
+25293,
+26058,
+27514,
+29036,
+29749,
+29753,
+29891,
+30199,
+29926,
+28587,
+26631,
+24310,
+21413,
+17599,
+12869,
+7859,
+2514,
+65535,
+59,
+65535,
+65535,
+17,
+65535,
+39,
+65535,
+58,
+65535,
+375,
+3594,
+7450,
+10881,
+14354,
+17685,
+20906,
+24031,
+27438,
+31323,
+35564,
+39083,
+41435,
+43695,
+46574,
+49127,
+50472,
+51353,
+52933,
+55033,
+57168,
+59093,
+60877,
+62618,
+64094,
+65224,
+65534,
+65516,
+65534,
+65532,
+65529,
+65534,
+65515,
+65534,
+65329,
+64433,
+63443,
+62234,
+60538,
+58322,
+55471,
+52299,
+48884,
+45178,
+41907,
+39382,
+37224,
+35248,
+33504,
+32121,
+30959,
+30049,
+29450,
+28630,
+27677,
+27435,
+27993,
+28981,
+30159,
+31472,
+32798,
+34121,
+35361,
+35689,
+34428,
+32293,
+30510,
+29240,
+28118,
+26878,
+25657,
+24870,
+24521,
+24185,
+23688,
+23364,
+23512,
+23864,
+24033,
+24565,
+26136,
+28723,
+31697,
+34508,
+37189,
+39688,
+41761,
+43072,
+43404,
+43338,
+43445,
+42909,
+41034,
+38602,
+36581,
+34522,
+31271,
+26650,
+21800,
+16970,
+11908,
+5885,
+806,
+65535,
+76,
+65535,
+38,
+65535,
+17,
+65535,
+8,
+65535,
+2,
+5,
+65535,
+31,
+65535,
+1311,
+4208,
+7532,
+11709,
+15908,
+19441,
+22726,
+25969,
+28677,
+30444,
+31506,
+32661,
+34664,
+37484,
+40829,
+44512,
+48060,
+51079,
+53556,
+55935,
+58083,
+59105,
+58967,
+58695,
+59109,
+60174,
+61315,
+62409,
+63981,
+65372,
+65534,
+65519,
+65534,
+65514,
+65533,
+64061,
+61548,
+59164,
+56262,
+52794,
+49591,
+47207,
+45190,
+43053,
+41038,
+39556,
+38510,
+37697,
+36946,
+36122,
+35228,
+34403,
+33848,
+33473,
+32892,
+32159,
+31620,
+31163,
+30732,
+30714,
+31455,
+32172,
+31796,
+30940,
+30874,
+31122,
+30434,
+28925,
+27764,
+27470,
+27225,
+26680,
+26330,
+26619,
+27670,
 29467,
-29651,
-29571,
-29679,
-29517,
-29627,
-29490,
-29679,
-29598,
-29889,
-29836,
-30179,
-30098,
-30210,
-30095,
-30104,
-30071,
-30286,
-30311,
-30602,
-30759,
-30868,
-31048,
-31106,
-31127,
-31371,
-31233,
-31527,
-31446,
-31421,
-31473,
-31289,
-31287,
-31263,
-31287,
-31342,
-31420,
-31474,
-31525,
-31447,
-31341,
-31342,
-31260,
-31344,
-31497,
-31633,
-31843,
-31974,
+31573,
+33491,
+34863,
+35843,
+36888,
+37987,
+38695,
+38917,
+38903,
+38686,
+38013,
+37187,
+36367,
+34654,
+31383,
+27187,
+23345,
+19431,
+14753,
+9878,
+5815,
+3346,
+2370,
+2510,
+3952,
+6479,
+9527,
+11885,
+13602,
+15376,
+16814,
+17755,
+18724,
+20082,
+21307,
+22130,
+22892,
+23609,
+24354,
+25290,
+26149,
+26985,
+28094,
+29346,
+30218,
+30842,
+31499,
+32650,
+34878,
+37632,
+39273,
+39666,
+39956,
+40280,
+39956,
+39226,
+38627,
+37873,
+36932,
+36126,
+35525,
+35082,
+34583,
+33939,
+33683,
+34470,
+35608,
+35977,
+36014,
+36383,
+36910,
+37733,
+39235,
+40793,
+41791,
+42778,
+44325,
+46201,
+47902,
+48933,
+49040,
+48590,
+48091,
+47386,
+46433,
+45464,
+44407,
+43115,
+42158,
+41984,
+42026,
+41608,
+40875,
+40245,
+39786,
+39206,
+38262,
+37182,
+36180,
+35337,
+34494,
+33701,
+32900,
+32038,
+31028,
+30366,
+30191,
+30172,
+30189,
+30801,
+31923,
+32959,
+33736,
+34923,
+36267,
+37278,
+38028,
+38640,
+39150,
+39392,
+39282,
+38757,
+38329,
+37927,
+37115,
+35833,
+34744,
+33464,
+31842,
+30120,
+28575,
+27085,
+25851,
+25022,
+24318,
+23702,
+23492,
+23544,
+23526,
+23536,
+23531,
+23492,
+23161,
+22476,
+21539,
+20852,
+20326,
+19490,
+18410,
+17580,
+16956,
+16482,
+16516,
+17451,
+18783,
+19880,
+20830,
+22012,
+23531,
+25187,
+26873,
+28591,
+30379,
+32050,
+33564,
+35076,
+36785,
+38401,
+39758,
+40944,
+42024,
+42998,
+43964,
+44912,
+45679,
+46159,
+46347,
+46241,
+45702,
+44914,
+43800,
+42431,
+40702,
+38730,
+36686,
+34826,
+33304,
+32306,
+31861,
 31949,
-32187,
-32105,
-32426,
-32501,
-32848,
-32925,
-33189,
-33217,
-33321,
-33428,
-33427,
-33480,
-33480,
-33508,
-33320,
-33375,
-33111,
-33135,
-33035,
-32868,
-32931,
+32214,
+32512,
+32995,
+33441,
+33602,
+33253,
+32325,
+30723,
+28816,
+27019,
+25420,
+24033,
+22794,
+21657,
+20880,
+20652,
+20733,
+20849,
+21005,
+21298,
+21499,
+21685,
+22118,
+22793,
+23764,
+25411,
+27532,
+29825,
+32085,
+34490,
+37053,
+39528,
+41795,
+43878,
+45674,
+46882,
+47625,
+48070,
+48663,
+48914,
+48285,
+47528,
+46884,
+46086,
+44688,
+43101,
+41629,
+40164,
+38549,
+36889,
+35597,
+34692,
+33607,
+32243,
+31361,
+30897,
+30520,
+30368,
+30848,
+31289,
+31662,
+31521,
+31373,
+30979,
+30403,
+29563,
+28376,
+27168,
+25984,
+25072,
+24766,
+24754,
+24880,
+25028,
+25635,
+26646,
+27400,
+28268,
+29025,
+29602,
+30128,
+30952,
+31868,
 32708,
-32905,
-32789,
+33802,
+34752,
+35382,
+36112,
+37146,
+37879,
+38290,
+38710,
+38820,
+38956,
+39490,
+40210,
+41152,
+42136,
+43059,
+43620,
+44030,
+44244,
+43854,
+43279,
+42505,
+41322,
+39728,
+38277,
+37302,
+36629,
+35638,
+34631,
+33668,
 32823,
-32924,
-32742,
-32951,
-32952,
-33163,
-33428,
-33691,
-33904,
-34190,
-34223,
-34454,
-34593,
-34771,
-35013,
-35144,
-35249,
-35408,
-35356,
-35459,
-35410,
-35460,
-35222,
-35224,
-34827,
-34800,
-34565,
-34427,
-34434,
-34377,
-34351,
-34432,
-34455,
-34592,
-34771,
-34857,
-35034,
-35120,
-35302,
-35512,
-35701,
-35987,
-36253,
-36411,
-36703,
-36701,
-36889,
-36936,
-37047,
-37098,
-37123,
-37075,
-37041,
-36942,
-36833,
-36676,
-36516,
-36255,
-36145,
-35859,
-35855,
-35725,
-35753,
-35828,
-35938,
-36146,
-36227,
-36439,
-36620,
-36810,
-36964,
-37126,
-37282,
-37284,
-37624,
-37470,
-37967,
-37919,
-38205,
-38288,
-38285,
-38261,
-38047,
-37919,
-37755,
-37629,
-37545,
-37390,
-37360,
-37127,
-37095,
-36785,
-36803,
-36654,
-36670,
-36787,
-36855,
-36944,
-37200,
-37074,
-37413,
-37389,
-37575,
-37781,
-37815,
-38097,
-38053,
-38231,
-38050,
-38206,
-38128,
-38261,
-38259,
-38366,
-38260,
-38127,
-37812,
-37572,
-37152,
-37071,
-36781,
-36887,
-36832,
-36784,
-36753,
-36597,
-36490,
-36358,
-36386,
-36385,
-36517,
-36517,
-36702,
-36569,
-36676,
-36518,
-36568,
-36599,
-36699,
-36729,
-36809,
-36700,
-36625,
-36356,
-36281,
-36067,
-36043,
-36067,
-35963,
-35989,
-35829,
-35568,
-35406,
-35199,
-35274,
-35251,
-35459,
-35461,
-35488,
-35460,
-35225,
-35140,
-34963,
-34850,
-34883,
-34771,
-34749,
-34696,
-34613,
-34541,
-34425,
-34382,
-34271,
-34352,
-34219,
-34274,
-34058,
-33854,
-33714,
-33350,
-33454,
-33268,
-33401,
-33428,
-33426,
-33217,
-33270,
-32922,
-33008,
-32792,
-32925,
-32822,
-32845,
-32607,
-32560,
-32233,
-32166,
-31918,
-31951,
-31762,
-31923,
-31631,
-31922,
-31606,
-31764,
-31630,
-31660,
-31655,
-31740,
-31657,
-31738,
-31604,
-31580,
-31446,
-31579,
-31473,
-31791,
-31710,
-31843,
-31816,
-31633,
-31603,
-31397,
-31442,
-31267,
-31284,
-31081,
-31048,
-30814,
-30681,
-30575,
-30470,
-30443,
-30443,
-30312,
-30417,
-30284,
-30364,
-30259,
-30284,
-30312,
-30258,
-30416,
-30287,
-30441,
-30366,
-30362,
-30366,
-30284,
-30364,
-30311,
-30444,
-30363,
-30365,
-30179,
-30178,
-29917,
-29966,
-29732,
-29808,
-29653,
-29596,
-29441,
-29361,
-29201,
-29177,
-29201,
-29176,
-29202,
-29255,
-29176,
-29281,
-29203,
-29200,
-29230,
-29202,
-29334,
-29308,
-29492,
-29386,
-29521,
+31901,
+31010,
+30084,
+29455,
+28823,
+28224,
+27952,
+27840,
+27578,
+26879,
+26310,
+26083,
+25799,
+25345,
+24599,
+23760,
+23195,
+22647,
+22254,
+21591,
+21051,
+20677,
+20575,
+20837,
+21451,
+22276,
+23422,
+25116,
+26478,
+27953,
+29243,
+30763,
+31799,
+32305,
+33079,
+33830,
+34992,
+35625,
+36137,
+36273,
+36175,
+35627,
+34835,
+34544,
+33610,
+32615,
+31185,
+30150,
+29434,
+28867,
+28702,
+27926,
+27927,
+27825,
+27592,
+28289,
+28754,
+29122,
+28803,
+28890,
+29374,
 29491,
-29468,
+29942,
+29344,
+28666,
+28662,
+28168,
+27653,
+27279,
+27489,
+27759,
+28245,
+29199,
+30151,
+31173,
+32273,
+33601,
+35374,
+37116,
+37750,
+39357,
+41040,
+42800,
+44838,
+45545,
+46525,
+47262,
+47761,
+48805,
+49686,
+50843,
+50920,
+51859,
+53024,
+53830,
+54446,
+53782,
+53270,
+52563,
+51700,
+50176,
+48817,
+47006,
+45488,
+44302,
+42466,
+40831,
+39268,
+37685,
+36510,
+35409,
+33478,
+31555,
+30136,
+28929,
+27661,
+26967,
+26437,
+25501,
+24619,
+23786,
+23428,
+23423,
+23454,
+22938,
+22989,
+22904,
+23104,
+23620,
+22719,
+22492,
+22348,
+21934,
+22433,
+22958,
+23229,
+24874,
+25977,
+27223,
+28163,
 29438,
-29414,
-29229,
-29359,
-29047,
-29224,
-28784,
-28961,
-28519,
-28618,
-28412,
-28461,
-28332,
+30541,
+30469,
+30681,
+30095,
+30472,
+30277,
+29786,
+30167,
+30092,
+29886,
+29594,
 28463,
-28223,
-28360,
+27710,
+27000,
+25444,
+24442,
+23132,
+23008,
+22212,
+21601,
+21882,
+21199,
+21752,
+21827,
+21889,
+22632,
+22318,
+22942,
+23440,
+23431,
+24316,
+24327,
+24680,
+24776,
+24941,
+25078,
+24420,
+24943,
+25463,
+26151,
+26837,
+27167,
+27797,
+28311,
+29753,
+30915,
+31450,
+31880,
+33107,
+33672,
+38435,
+42455,
+40915,
+40294,
+41281,
+42113,
+43707,
+44726,
+47134,
+47820,
+48005,
+48705,
+51253,
+54441,
+52178,
+50944,
+52026,
+51802,
+49902,
+49786,
+49164,
+49249,
+48387,
+46364,
+45005,
+44013,
+42375,
+41110,
+41098,
+39296,
+37374,
+35763,
+34106,
+33558,
+33264,
+32011,
+31930,
+31153,
+29285,
+29506,
+29065,
+28940,
+28656,
+29923,
+29819,
+28832,
+30637,
+30217,
+30071,
+29778,
+28850,
+29764,
+30305,
+29824,
+30716,
+32448,
+33698,
+32942,
+34591,
+35681,
+35187,
+36352,
+34849,
+35438,
+34292,
+32818,
+32846,
+33879,
+34102,
+33607,
+32466,
+32138,
+32676,
+29551,
+30027,
+29023,
+28739,
+27484,
+26071,
+25730,
+25143,
+25621,
+24648,
+23868,
+24974,
+24021,
+22989,
+24162,
+22669,
+23364,
+23549,
+21482,
+21985,
+22799,
+23233,
+22491,
+22101,
+23557,
+23497,
+22256,
+24555,
+24725,
+23751,
+26028,
+24919,
+25675,
+27528,
+27953,
 28116,
-28149,
-28197,
-28198,
-28385,
-28435,
-28622,
-28542,
-28700,
-28489,
-28647,
-28543,
-28620,
-28649,
-28672,
-28676,
-28672,
-28516,
-28543,
-28329,
-28332,
-28172,
-28091,
-28123,
-27853,
-27987,
-27699,
-27721,
-27672,
-27697,
-27748,
-27884,
-27986,
-28067,
-28119,
-28172,
-28253,
-28381,
-28597,
-28752,
-29017,
-29045,
-29173,
-28994,
-29015,
-28728,
-28937,
-28596,
-28910,
-28570,
-28699,
-28437,
-28384,
-28277,
-28146,
-28226,
-28171,
-28332,
-28250,
-28253,
-28224,
-28199,
-28199,
-28277,
-28332,
-28646,
-28675,
-29070,
-28990,
-29282,
-29176,
-29413,
-29440,
-29730,
-29782,
-29996,
-29888,
-29889,
-29677,
-29704,
-29467,
-29702,
-29627,
-29860,
-29864,
-29782,
-29837,
-29596,
-29708,
-29673,
-29839,
-29940,
-30126,
-30181,
-30230,
-30234,
-30151,
-30260,
+30337,
+31593,
+32163,
+30018,
+33197,
+32515,
+35948,
+36365,
+34739,
+40233,
+37772,
+39981,
+41896,
+42153,
+44069,
+42071,
+44452,
+43597,
+41988,
+46035,
+44653,
+46842,
+44703,
+45842,
+45158,
+45639,
+42382,
+43932,
+43775,
+41903,
+41414,
+40259,
+41935,
+39024,
+38567,
+37871,
+37737,
+37427,
+35236,
+32737,
+34853,
+35728,
+31282,
+30357,
+32650,
+30216,
+31454,
+31926,
+31298,
+32887,
+30156,
+32155,
+29610,
+28850,
+32865,
+28801,
+30235,
+29013,
+30449,
+30292,
+28730,
+31514,
+31039,
+29676,
+32480,
+27610,
+30668,
+29638,
+28765,
 30309,
-30578,
-30757,
-31028,
-31126,
-31239,
-31206,
-31317,
-31287,
-31527,
-31657,
+27704,
+29394,
+27961,
+30481,
+29191,
+29081,
+30529,
+27837,
+28564,
+29662,
+26905,
+28389,
+29049,
+29289,
+29051,
+27992,
+28865,
+28423,
+28836,
+27750,
+30917,
+29814,
+28977,
+29856,
+30367,
+31909,
+28593,
+29327,
+28378,
+31479,
+29223,
+26465,
+30095,
+28193,
+29235,
+27819,
+28394,
+30822,
+28345,
+30063,
+29068,
+32447,
+32627,
+27582,
+31060,
+31359,
+33014,
+32420,
 31738,
-31842,
-31659,
-31764,
-31524,
-31740,
-31761,
-32030,
-32237,
-32373,
-32527,
-32427,
-32474,
-32320,
-32423,
-32476,
-32769,
-32818,
-33218,
-33108,
-33350,
-33189,
-33348,
-33217,
-33425,
-33562,
-33664,
-33902,
-33825,
-33795,
-33851,
-33692,
-33901,
-33879,
-34057,
-34091,
-34059,
-34089,
-33876,
-33928,
-34009,
-34194,
-34456,
-34775,
-34800,
-34985,
-34829,
-34850,
-34910,
-34955,
-35279,
-35327,
-35725,
-35672,
-35883,
-35911,
-35828,
-35912,
-35722,
-35780,
-35776,
-35621,
-35855,
-35514,
-35672,
-35409,
-35484,
-35440,
-35586,
-35809,
-35855,
-36094,
-36016,
-36148,
-36224,
-36389,
-36697,
-36865,
-37147,
-37286,
-37360,
-37363,
-37361,
-37363,
-37363,
-37413,
-37416,
-37573,
-37493,
-37444,
-37386,
-37099,
-37124,
-36808,
-36860,
-36834,
-36833,
-36941,
-36859,
-36994,
-36964,
-37205,
-37361,
-37574,
-37784,
-37969,
-38077,
-38257,
-38264,
-38360,
-38555,
-38574,
-38790,
-38814,
-38893,
-38974,
-38840,
-38867,
-38684,
-38628,
-38631,
-38549,
-38684,
-38575,
-38553,
-38362,
-38290,
-38151,
-38157,
-38233,
-38259,
-38392,
-38498,
-38523,
-38711,
-38786,
+35060,
+31992,
+34784,
+36054,
+34610,
+37439,
+34470,
+37894,
+37070,
+38096,
+39647,
+36029,
+40760,
+38539,
+36648,
+39503,
 38947,
-39106,
-39182,
-39345,
-39262,
-39448,
-39371,
-39392,
-39347,
-39312,
-39373,
-39365,
-39398,
-39394,
-39238,
-39158,
-38919,
-38815,
-38656,
-38603,
-38419,
-38498,
-38285,
-38446,
-38286,
-38260,
-38340,
-38127,
-38208,
-38180,
-38075,
-38129,
-37994,
-37972,
-37941,
-37944,
-37995,
-37917,
-37970,
-37704,
-37760,
-37360,
-37284,
-37072,
-37017,
-36889,
-36806,
-36675,
-36703,
-36410,
-36651,
+40449,
+41078,
+36196,
+40770,
+40056,
+38432,
+40007,
+38965,
+41459,
+38666,
+38914,
+40400,
+37742,
+37368,
+38308,
+39421,
+41630,
+37732,
+39081,
+40607,
+38604,
+38004,
+38714,
+35904,
+37321,
+35257,
+33878,
+36196,
+33174,
+34224,
+32274,
+32632,
+32660,
+30471,
+32442,
+28759,
+31550,
+30884,
+26429,
+29177,
+29024,
+26757,
+28484,
+28797,
+26925,
+25486,
+28669,
+27055,
+25408,
+27723,
+24798,
+26515,
+27447,
+26202,
+25792,
+28596,
+23927,
+26801,
+25058,
+25663,
+26778,
+26064,
+26547,
+24622,
+27453,
+26395,
+28334,
+29073,
+26200,
+28611,
+31262,
+26723,
+29976,
+28767,
+27318,
+28238,
+33088,
+30521,
+28425,
+35337,
+28274,
+31620,
+32880,
+29120,
+33606,
+30702,
+31195,
+31063,
+31589,
+33217,
+29237,
+33981,
+34028,
+31972,
+34293,
+31751,
+33768,
+36109,
+32156,
+33821,
+34612,
+38035,
+31723,
+36958,
+39504,
+32077,
+37776,
+37375,
+35575,
+37568,
+35499,
 36198,
-36334,
-36040,
-35858,
-35804,
-35618,
-35647,
-35592,
-35566,
-35514,
-35460,
-35489,
-35247,
-35304,
-34931,
-34854,
-34670,
-34534,
-34539,
-34454,
-34408,
-34428,
-34353,
-34220,
-34297,
-33931,
-34059,
-33614,
-33558,
-33297,
-33214,
-33191,
-33109,
-33165,
-33082,
-33060,
+36668,
+36342,
+37832,
+34293,
+39498,
+36208,
+35092,
+39322,
+37383,
+36291,
+36178,
+37126,
+38445,
+37734,
+39491,
+39661,
+39156,
+41839,
+40242,
+40875,
+41819,
+41520,
+39085,
+41746,
+40381,
+41578,
+41141,
+42749,
+40986,
+38075,
+40613,
+38235,
+39387,
+36968,
+34666,
+36509,
+37660,
+31638,
+34592,
+31664,
+32358,
+31913,
+29229,
+31608,
+28115,
+26994,
+27852,
+29390,
+26513,
+27452,
+26529,
+25923,
+25834,
+27052,
+28400,
+23482,
+26542,
+26850,
+24666,
+28088,
+26068,
+27646,
+27187,
+26444,
+28361,
+28721,
+27187,
+27715,
+28252,
+32147,
+32014,
+29372,
+30815,
+27391,
+28295,
+30713,
+32365,
+33397,
+34140,
+30657,
+29560,
+30386,
+33244,
+31605,
+31516,
+32039,
+28776,
+32067,
+31346,
+33448,
+30053,
+32902,
+31498,
+31253,
+30848,
+29736,
+31520,
 32976,
-32901,
+32330,
+30393,
+31593,
+29158,
+33852,
+31086,
+32069,
+32087,
+32294,
+30510,
+29931,
+30610,
+28621,
+33807,
+31208,
+28864,
+31628,
+30907,
+27637,
+31195,
+32608,
+31469,
+31558,
+28778,
+29843,
+31667,
+33205,
+33448,
+35377,
+34010,
 32687,
-32582,
-32319,
-32159,
-32055,
-31922,
-31974,
-31897,
-31868,
-31792,
-31577,
+36515,
+38726,
+36290,
+35945,
+37736,
+37096,
+37759,
+39251,
+40706,
+41749,
+40569,
+37766,
+40355,
+38986,
+41181,
+37966,
+38328,
+37782,
+37039,
+38964,
+39352,
+34832,
+37878,
+35063,
+31671,
+38182,
+33453,
+34404,
+32219,
+33425,
+33333,
+29808,
+36446,
+30240,
+27600,
+34833,
+31656,
+35358,
+31210,
+30401,
+33424,
+28885,
+33462,
+29878,
+30911,
+33963,
+28703,
+34589,
+32566,
+33010,
+33040,
+28237,
+35741,
+31099,
+33544,
+34058,
+27883,
+32071,
+30763,
+35804,
+33193,
+33166,
+33903,
+30526,
 31633,
-31314,
-31447,
-31288,
-31184,
-31287,
-31026,
-31286,
-31131,
-31315,
-31209,
-31262,
-31156,
-30971,
-30920,
-30652,
-30578,
-30468,
-30469,
-30579,
-30623,
-30580,
-30730,
-30419,
-30548,
-30180,
-30152,
-30048,
-29861,
-29996,
-29860,
-29997,
-29913,
-30101,
-30074,
-30257,
-30234,
-30283,
-30365,
-30153,
-30204,
-30049,
-29993,
-30128,
-30019,
-30233,
-30126,
-30258,
-30074,
-29995,
-29755,
-29679,
-29545,
-29518,
-29547,
-29543,
-29628,
-29541,
-29524,
-29461,
-29391,
-29358,
-29177,
-29281,
-29203,
-29253,
-29256,
+30916,
+32313,
+34715,
+30526,
+31115,
+32540,
+31470,
+30295,
+32758,
+32687,
+31338,
+30279,
+30653,
+34995,
+32387,
+32176,
+30095,
+33297,
+32185,
+28225,
+35973,
+32459,
+30582,
+33973,
+33033,
+32995,
+31019,
+31299,
+31879,
+33356,
+33699,
 29203,
-29253,
-29311,
-29357,
-29442,
-29465,
-29441,
-29333,
-29097,
-29096,
-28834,
-28777,
-28755,
-28699,
-28727,
-28781,
-28514,
-28542,
-28226,
-28223,
-27989,
-28067,
-27906,
-27990,
-27931,
-27911,
-27854,
-27935,
-27829,
-27934,
-27855,
-27856,
-27907,
-27857,
-27828,
-27802,
-27645,
-27669,
-27620,
-27483,
-27594,
-27430,
-27435,
-27272,
-26987,
-26875,
-26618,
-26636,
-26538,
-26665,
-26564,
-26637,
-26486,
-26557,
-26460,
-26532,
-26431,
-26639,
-26537,
+29109,
+33220,
+30017,
+32059,
+31549,
+29124,
+32044,
+30248,
+29794,
+31730,
+30151,
+32607,
+30498,
+32650,
+34256,
+30783,
+36593,
+32078,
+33363,
+35427,
+31368,
+32589,
+34061,
+35114,
+35745,
+36157,
+37542,
+33765,
+34914,
+35127,
+31297,
+31808,
+33175,
+32323,
+33963,
+32144,
+32837,
+33566,
+31101,
+32772,
+29006,
+31970,
+32836,
+30682,
+32572,
+30616,
+31591,
+28911,
+32533,
+30415,
+29597,
+34170,
+33860,
+32103,
+33238,
+35603,
+32755,
+32171,
+31258,
+33673,
+32060,
+35971,
+33113,
+33550,
+39050,
+32018,
+34884,
+34045,
+32699,
+34537,
+30530,
+31912,
+32704,
+33636,
+33141,
+33333,
+33987,
+32352,
+30663,
+29916,
+31388,
+32225,
+31176,
+30577,
+31483,
+33426,
+34820,
+35648,
+34772,
+33179,
+31467,
+31710,
+34285,
+32690,
+34796,
+34010,
+33523,
+36594,
+34555,
+36938,
+37016,
+35500,
+35582,
+33422,
+33757,
+34018,
+33406,
+35374,
+34490,
+34636,
+35191,
+33192,
+32500,
+32646,
+33581,
+32881,
+32809,
+32721,
+33807,
+31817,
+32882,
+32915,
+31224,
+29689,
+27379,
+29873,
+31075,
+35589,
+34189,
+32544,
+36148,
+32530,
+31587,
+29053,
+29379,
+26515,
+22767,
+26242,
+29226,
+32438,
+32468,
+35201,
+35212,
+28527,
+26561,
+27783,
+27190,
+26124,
+25078,
+26664,
+26501,
+30326,
+30936,
+32677,
+34128,
+33561,
+33734,
+30895,
+33084,
+32692,
+29139,
+30205,
+32646,
+30997,
+35457,
+38376,
+39991,
+38817,
+36133,
+36893,
+35268,
+33752,
+31515,
+32530,
+32726,
+32205,
+34827,
+38838,
+37811,
+36237,
+36893,
+34444,
+34552,
+31607,
+31493,
+31492,
+31565,
+34379,
+32801,
+35021,
+39116,
+40534,
+39623,
+35254,
+33941,
+33294,
+32264,
+35171,
+33377,
+34357,
+33928,
+35238,
+38065,
+35702,
+36592,
+34397,
+33057,
+33432,
+33640,
+36124,
+35450,
+34862,
+35061,
+33735,
+32678,
+32061,
+34041,
+35009,
+34598,
+34121,
+34740,
+34670,
+33818,
+33349,
+34105,
+33380,
+32423,
+30190,
+28996,
+32074,
+31414,
+30043,
+29561,
+31644,
+32468,
+32936,
+33252,
+29923,
+29649,
+29680,
+25381,
+26394,
+30370,
+28823,
+27701,
+29818,
+30787,
+29722,
+29105,
 26770,
-26670,
-26744,
-26694,
-26615,
-26744,
-26643,
-26851,
-26745,
-26854,
-26717,
-26564,
-26560,
-26271,
-26430,
-26216,
-26300,
-26162,
-26169,
-26135,
-26089,
-26058,
-26086,
-26008,
-26216,
-26220,
-26455,
-26482,
-26694,
-26613,
-26748,
-26639,
-26878,
-26748,
-27034,
-26881,
-27062,
-26904,
-26932,
-26798,
-26932,
-26877,
-27039,
-26982,
-26984,
-27012,
-26876,
-26854,
-26823,
-26722,
-26876,
-26881,
-27035,
-27089,
-27276,
-27272,
-27383,
-27482,
-27569,
-27746,
-27964,
-28011,
-28280,
-28197,
-28306,
-28276,
-28332,
-28409,
-28464,
-28646,
-28727,
-28807,
-28884,
-28914,
-29014,
-29152,
-29252,
-29337,
-29491,
-29519,
-29678,
-29598,
+26403,
+28257,
+25379,
+24958,
+26803,
+27038,
+26968,
+29972,
+31490,
+28775,
+28603,
+28883,
+29395,
+29419,
+31165,
+30519,
+32348,
+35562,
+36741,
+36141,
+35753,
+34894,
+34521,
+36288,
+32293,
+33828,
+36128,
+35775,
+36373,
+35574,
+34705,
+34129,
+37690,
+37360,
+34580,
+34804,
+30037,
+30814,
+36051,
+36945,
+36208,
+34452,
+33771,
+34789,
+36462,
+37626,
+36748,
+37254,
+37806,
+36518,
+39785,
+40873,
+36669,
+35864,
+39044,
+39934,
+38019,
+35036,
+34970,
+35748,
+33909,
+37117,
+39742,
+35604,
+32949,
+30638,
+31362,
+32114,
+32155,
+32351,
+32941,
+36048,
+36139,
+34952,
+34145,
+33192,
+32370,
+29517,
+26511,
+27846,
+28592,
 29730,
-29757,
+32740,
+33953,
+34692,
+34204,
+32433,
+30874,
+28063,
+26827,
+26269,
+26011,
+26657,
+28119,
+30954,
+33518,
+36403,
+37653,
+35893,
+33616,
+31054,
+29822,
+29841,
+29193,
+29642,
+30353,
+31744,
+33177,
+33004,
+31331,
+30499,
+30087,
+28194,
+26828,
+26423,
+26445,
+25659,
+25527,
+26571,
+25604,
+25016,
+24648,
+25692,
+28109,
+27913,
+28268,
+27188,
+27747,
+27598,
+27391,
+28638,
+29589,
+31409,
+30339,
+31615,
+32491,
+33930,
+35286,
+32901,
+33575,
+33445,
+31469,
+30339,
+31746,
+32562,
+31992,
+32933,
+34658,
+35823,
+36177,
+37685,
+38525,
+36682,
+35921,
+34327,
+33441,
+35262,
+36905,
+39190,
+39261,
+40732,
+40222,
+40944,
+41850,
+43212,
+43194,
+40579,
+40839,
+39376,
+37903,
+38939,
+38618,
+37162,
+37820,
+37571,
+36366,
+36487,
+38977,
+37427,
+36760,
+36616,
+33523,
+30537,
+28913,
+29401,
+29805,
+30964,
+31467,
+32084,
+33746,
+34361,
+33420,
+32439,
+30178,
+29329,
+29437,
+28908,
+29942,
+29565,
+28963,
+29214,
 29810,
-30125,
-30128,
-30573,
-30605,
-30941,
-30949,
-31127,
-31026,
-31445,
-31264,
-31734,
-31662,
-31866,
-31898,
-31974,
-32107,
-32423,
-32584,
-32924,
-33164,
-33322,
-33611,
-33640,
-33927,
-34064,
-34296,
-34433,
-34640,
-34801,
-34934,
-35090,
-35144,
-35276,
-35327,
-35491,
-35561,
-35784,
-35982,
-36127,
-36249,
-36333,
-36439,
-36594,
-36626,
-36963,
-36915,
-37228,
-37284,
-37362,
-37600,
-37678,
-38023,
-38285,
-38605,
-38893,
-39051,
-39160,
+30907,
+29802,
+30556,
+31795,
+30875,
+30996,
+30904,
+32631,
+33925,
+33850,
+34703,
+35155,
+36256,
+36440,
+37528,
+38044,
+36206,
+36232,
+34785,
+34760,
+35755,
+35277,
+35893,
+34915,
+33321,
+32595,
+31716,
+30577,
+29772,
+29830,
+29874,
+28903,
+29834,
+29587,
+29723,
+30765,
+30877,
+30654,
+30284,
+29888,
+29924,
+29308,
+29504,
+30142,
+28961,
+31231,
+32072,
+30608,
+29278,
+27680,
+26795,
+25329,
+25347,
+26092,
+26467,
+26564,
+25531,
+26109,
+27467,
+25305,
+23284,
+21989,
+20560,
+20443,
+19345,
+20074,
+21369,
+24154,
+26159,
+27254,
+30353,
+30462,
+31103,
+28768,
+25494,
+23628,
+20818,
+19501,
+19162,
+20864,
+22948,
+25560,
+25914,
+23705,
+20753,
+20076,
+23220,
+27077,
+32251,
+39640,
+46544,
+50067,
+51684,
+52237,
+51266,
+48069,
+45304,
+45610,
+49756,
+54683,
+59158,
+63961,
+65534,
+65450,
+65534,
+64208,
+61787,
+59171,
+55660,
+51805,
+49073,
+47493,
+44949,
+43400,
+43117,
+43264,
+42712,
+42067,
+40663,
+37087,
+32455,
+27424,
+22435,
+18142,
+16129,
+17255,
+18471,
+20221,
+24383,
+27409,
+30261,
+31574,
+32570,
+33144,
+33362,
+34124,
+33302,
+34875,
+36961,
+38980,
+42042,
+45109,
+49150,
+52462,
+54118,
+54956,
+54363,
+52269,
+48353,
+43673,
+38996,
+35603,
+34903,
+35185,
+36893,
+38975,
+40537,
+40532,
+37753,
+33885,
+29698,
+24745,
+21443,
+18621,
+17072,
+17881,
+18492,
+19597,
+20196,
+21082,
+20826,
+19739,
+18925,
+17186,
+15718,
+13495,
+11453,
+9531,
+8312,
+9334,
+9690,
+8916,
+8534,
+8839,
+9513,
+9269,
+8405,
+7240,
+5956,
+3539,
+401,
+65535,
+65,
+65535,
+43,
+65535,
+49,
+65535,
+96,
+65535,
+196,
+65535,
+2449,
+15783,
+31892,
+47701,
+59918,
+65219,
+65151,
+59073,
+51046,
+43982,
+41998,
+46973,
+58451,
+65534,
+65325,
+65534,
+65437,
+65534,
+65430,
+65534,
+65045,
+57573,
+50944,
+47570,
+46792,
+47958,
+49568,
+50286,
+50813,
+50325,
+45981,
+39165,
+30655,
+21158,
+11269,
+3907,
+411,
+930,
+5107,
+12701,
+20947,
+29025,
+35400,
+37760,
+38429,
+37497,
+37682,
+39600,
+42286,
+45929,
+50660,
+56454,
+61046,
+64631,
+65534,
+65480,
+65511,
+65534,
+63494,
+57316,
+50207,
+43056,
+35599,
+30296,
+27591,
+27620,
+30673,
+32743,
+33697,
+32549,
+29165,
+23809,
+17364,
+11680,
+9048,
+10079,
+12882,
+17673,
+23507,
+29949,
+33547,
+35502,
+35577,
+37175,
+40928,
+44501,
+49364,
+53368,
+58144,
+59606,
+57744,
+54382,
+49868,
+45669,
+39754,
+34838,
+32303,
+31044,
+29749,
+28314,
+27721,
+26030,
+24528,
+23061,
+20093,
+18421,
+16808,
+14722,
+12221,
+10414,
+8739,
+7466,
+7364,
+7632,
+7845,
+8190,
+11011,
+14100,
+17758,
+22357,
+26366,
+28296,
+26240,
+20708,
+13449,
+4256,
+65535,
+169,
+65535,
+39,
+65535,
+65535,
+28,
+65535,
+128,
+65535,
+3069,
+15379,
+32240,
+42359,
+44841,
 39314,
-39344,
-39581,
-39658,
-39766,
-39924,
-39948,
-40059,
-40079,
-40243,
-40291,
-40480,
-40583,
-40662,
-40745,
-40766,
-40690,
-40770,
-40581,
-40720,
-40685,
-40824,
-40874,
-41111,
-41167,
-41452,
-41564,
-41612,
-41983,
-41879,
-42299,
-42301,
-42565,
-42536,
-42619,
-42563,
-42618,
-42643,
-42724,
-42641,
-42726,
-42562,
-42486,
-42407,
-42377,
-42381,
-42405,
-42433,
-42432,
-42380,
-42432,
-42273,
-42249,
-42114,
-42011,
-42036,
+29308,
+20571,
+14231,
+17571,
+30859,
+53889,
+65534,
+65124,
+65534,
+65389,
+65534,
+65344,
+65534,
+60851,
+50890,
+48433,
+49591,
+54684,
+61188,
+64256,
+65056,
+65261,
+62102,
+52066,
+37856,
+23472,
+9060,
+138,
+65535,
+298,
+65535,
+4208,
+16235,
+26127,
+31658,
+33402,
+30748,
+24338,
+19420,
+17206,
+19748,
+27851,
+37389,
+47524,
+57384,
+64368,
+65534,
+65429,
+65534,
+65432,
+65534,
+63167,
+58534,
+54900,
+51858,
+50126,
+50249,
+51943,
+55296,
+57685,
+56455,
+51654,
+43281,
+33670,
+23653,
+14691,
+10101,
+9440,
+12901,
+19371,
+25428,
+29444,
+30208,
+28543,
+25605,
+21902,
+19937,
+20212,
+23034,
+27219,
+31228,
+35688,
+39753,
+42100,
+42449,
+41272,
+41584,
+43352,
+45549,
+47664,
+49152,
+52531,
+53933,
+53885,
+52271,
+50246,
+49271,
+46469,
+44942,
+43532,
+43564,
+44014,
+44954,
+47470,
+48771,
+49885,
+49680,
+48214,
+45279,
+40889,
+35558,
+29943,
+24774,
+19035,
+12027,
+3632,
+65535,
+119,
+65535,
+23,
+65535,
+65535,
+12,
+65535,
+8,
+65535,
+2,
+65535,
+12,
+65535,
+58,
+65535,
+158,
+65535,
+322,
+65535,
+1542,
+18586,
+46172,
+64297,
+65534,
+65534,
+57861,
+46065,
+37564,
+35173,
+46505,
+61654,
+65534,
+65156,
+65534,
+65471,
+65471,
+65534,
+65137,
+65534,
+60176,
+46543,
+37906,
+33852,
+37722,
+44979,
+51182,
+56078,
+59701,
+54919,
+40735,
+20099,
+2452,
+65535,
+74,
+83,
+65535,
+6757,
+23288,
+33684,
+38892,
+39998,
+38729,
+37931,
+36392,
+38061,
+41335,
+47415,
+53759,
+58049,
+63591,
+65534,
+65390,
+65534,
+65140,
+59667,
+50939,
+42379,
+34044,
+29667,
+29921,
+33894,
+39195,
+42674,
+44084,
+42978,
+37827,
+29101,
+20262,
+14659,
+13294,
+14276,
+17493,
+22999,
+30609,
+38625,
+44759,
+48072,
+50391,
+50961,
+48863,
+45674,
+41310,
+38433,
+37051,
+37689,
+40144,
+44047,
+48336,
+50373,
+49068,
+44160,
+37023,
+28665,
+21846,
+18329,
+19657,
+24416,
+29926,
+36065,
+40877,
+42845,
+41211,
+37978,
+35091,
+32550,
+31137,
+31017,
+33094,
+37261,
+41730,
+46941,
+52350,
+54958,
+54461,
+51597,
+48052,
+44035,
+40363,
+37044,
+33506,
+31517,
+29951,
+25577,
+17858,
+8467,
+1119,
+65535,
+120,
+65535,
+56,
+65535,
+24,
+65535,
+13,
+65535,
+7,
+3,
+65535,
+63,
+65535,
+194,
+65535,
+464,
+65535,
+4617,
+31411,
+57626,
+65534,
+65430,
+65419,
+65534,
+57478,
+45392,
+39803,
+43584,
+57742,
+65534,
+65286,
+65534,
+65428,
+65534,
+65507,
+65534,
+64974,
+49744,
+28180,
+15714,
+8397,
+9396,
+19022,
+31173,
+38888,
+41993,
+40415,
+31396,
+15027,
+1211,
+65535,
+123,
+29,
+65535,
+7456,
+23500,
+36897,
+46209,
+50539,
+51363,
+48587,
+44973,
+42426,
+42411,
+46347,
+52755,
+61365,
+65534,
+65534,
+65396,
+65534,
+64229,
+54813,
+44375,
+35794,
+28332,
+23436,
+22406,
+25251,
+29963,
+35544,
+39370,
+40737,
+39393,
+34672,
+27386,
+20002,
+16347,
+16635,
+20535,
+26588,
+34384,
+43176,
+49986,
+53916,
+54060,
+51227,
+45169,
+38770,
+32811,
+28208,
+25665,
+25245,
+28106,
+31985,
+36628,
+39555,
+40222,
+37482,
+32531,
+27442,
+22082,
+18920,
+19024,
+23450,
+28954,
+35381,
+41586,
+44832,
+45939,
+44293,
+42869,
+40842,
+39695,
+40183,
+41232,
+43725,
+46168,
+50037,
+53847,
+56762,
+59472,
+62417,
+64482,
+63462,
+61715,
+58256,
+52199,
+44825,
+36951,
+30594,
+25315,
+20531,
+14444,
+5634,
+100,
+65535,
+25,
+65535,
+34,
+65535,
+24,
+65535,
+7,
+8,
+65535,
+51,
+65535,
+116,
+65535,
+143,
+65535,
+6,
+189,
+65535,
+20146,
+48414,
+62707,
+65534,
+65502,
+64451,
+51380,
+39216,
+32740,
+30035,
+37009,
+51798,
+64476,
+65534,
+65173,
+65534,
+65038,
+65534,
+61935,
+42921,
+20952,
+5527,
+1419,
+5588,
+14239,
+27113,
+39124,
+43899,
+43877,
+40117,
+30262,
+16792,
+4090,
+65535,
+65535,
+5275,
+17463,
+32334,
+48828,
+61436,
+65534,
+65534,
+64481,
+59177,
+55273,
+53326,
+52511,
+55237,
+58777,
+61228,
+63194,
+64753,
+64258,
+61090,
+52985,
+42107,
+31959,
+22397,
+14258,
+9162,
+8439,
+10500,
+14575,
+20113,
+24342,
+27621,
+30457,
+30756,
+29517,
+29077,
+28909,
+29581,
+32379,
+36795,
+43390,
+51764,
+58292,
+60835,
+60786,
+57831,
+52204,
+45918,
+39958,
+35707,
+33978,
+33999,
+34480,
+35355,
+36665,
+35707,
+32823,
+28424,
+22905,
+18986,
+14668,
+13302,
+17212,
+23653,
+30054,
+37544,
+45981,
+50025,
+50801,
+51594,
+50978,
+47913,
+47392,
+48845,
+50991,
+54408,
+57561,
+63490,
+65534,
+65377,
+65534,
+65534,
+63710,
+58025,
+55103,
+51224,
+44962,
+39905,
+34172,
+27052,
+19816,
+13567,
+4967,
+65535,
+143,
+65535,
+12,
+13,
+65535,
+25,
+65535,
+14,
+65535,
+4,
+65535,
+65535,
+1,
+4,
+65535,
+25,
+65535,
+68,
+65535,
+106,
+65535,
+84,
+65535,
+341,
+12452,
+26854,
+37554,
+45507,
+44766,
+42709,
+40451,
+35106,
+32380,
+36210,
+47421,
+61665,
+65534,
+65307,
+65534,
+65511,
+65513,
+65534,
+65076,
+55801,
+46121,
+43003,
+39554,
+37591,
+41445,
+47185,
+48624,
+48913,
+45641,
+35415,
+20131,
+4305,
+65535,
+351,
+65535,
+367,
+6083,
+15901,
+25826,
+33768,
+39493,
+43131,
+43913,
+42875,
+39374,
+36974,
+38523,
+42577,
+50700,
+61541,
+65534,
+65474,
+65496,
+65534,
+64881,
+58677,
+52001,
+45436,
+38380,
+32998,
+29948,
+30555,
+32819,
+35002,
+36125,
+35539,
+32102,
+25985,
+20503,
+17343,
+17194,
+20135,
+22952,
+25879,
+30635,
+35105,
+38423,
+40767,
+42088,
+42347,
+41856,
+39996,
+38175,
+40032,
+43949,
+48137,
+51939,
+53870,
+53456,
+51109,
+47504,
+41997,
+36501,
+32792,
+29110,
+26939,
+26755,
+27102,
+30272,
+34914,
+42663,
+54297,
+60779,
+59767,
+56812,
+54056,
+48351,
+42066,
+41858,
+42531,
+42837,
+47295,
+52459,
+57630,
+59617,
+56090,
+52614,
+45633,
+32752,
+21201,
+13835,
+8342,
+6262,
+8999,
+9449,
+7155,
+8211,
+8714,
+6929,
+5999,
+4159,
+1121,
+65535,
+189,
+65535,
+1856,
+10012,
+18003,
+21476,
+21105,
+19241,
+16636,
+12596,
+10179,
+9981,
+5390,
+187,
+29,
+65535,
+35,
+65535,
+38,
+65535,
+65535,
+176,
+65535,
+11663,
+30474,
+44924,
+55473,
+54724,
+48940,
+45816,
+39702,
+36055,
+40777,
+52010,
+63889,
+65534,
+65273,
+65534,
+65505,
+65386,
+65534,
+57852,
+39353,
+24287,
+16092,
+9927,
+5705,
+11743,
+22014,
+29183,
+36022,
+38955,
+32550,
+20094,
+9050,
+2996,
+4529,
+13430,
+23449,
+33428,
+44665,
+56924,
+65036,
+65534,
+65534,
+65438,
+65534,
+64027,
+59107,
+57039,
+58805,
+63740,
+65534,
+65261,
+65534,
+63980,
+54530,
+41003,
+29376,
+20232,
+11130,
+3355,
+726,
+2861,
+9380,
+18173,
+26705,
+33706,
+38087,
+39955,
+38413,
+34553,
+32063,
+32329,
+34163,
+38169,
+45387,
+56825,
+65167,
+65532,
+65534,
+65417,
+65534,
+63148,
+54164,
+45427,
+38323,
+33238,
+29078,
+25284,
+22525,
+21702,
+22612,
+22810,
+21988,
+19521,
+15635,
+11628,
+7505,
+5833,
+7961,
+12345,
+18262,
+24809,
+32177,
+39333,
+45611,
+52091,
+56985,
+60197,
+61848,
+61628,
+61732,
+61737,
+62352,
+64286,
+64857,
+64008,
+61718,
+57568,
+51997,
+45523,
+39149,
+31883,
+24816,
+19987,
+15866,
+12319,
+10104,
+8674,
+7336,
+6053,
+5529,
+4901,
+2953,
+657,
+65535,
+90,
+65535,
+318,
+3506,
+7765,
+11219,
+12983,
+12284,
+9336,
+5380,
+2619,
+662,
+65535,
+39,
+65535,
+65535,
+23,
+65535,
+10,
+31,
+65535,
+210,
+65535,
+614,
+65535,
+7385,
+29686,
+45312,
+59737,
+65534,
+65155,
+65018,
+60006,
+54513,
+53075,
+56530,
+63507,
+65534,
+65385,
+65534,
+65481,
+65534,
+65424,
+65534,
+55917,
+38906,
+30362,
+27167,
+22289,
+22837,
+31670,
+39640,
+44773,
+49019,
+45980,
+34504,
+23947,
+17134,
+13646,
+16521,
+23783,
+32434,
+41756,
+54153,
+64519,
+65534,
+65489,
+65498,
+65534,
+64122,
+58196,
+54487,
+53014,
+53394,
+54827,
+53358,
+48840,
+44214,
+39161,
+31782,
+24653,
+18711,
+10975,
+2748,
+65535,
+65535,
+1474,
+9390,
+19142,
+26075,
+30129,
+32410,
+33769,
+35104,
+36631,
+38090,
+39808,
 42036,
-42248,
-42247,
-42538,
-42460,
-42642,
-42539,
-42616,
-42565,
-42539,
-42457,
-42170,
-42061,
-41878,
-41747,
-41823,
-41694,
-41878,
-41613,
-41720,
-41561,
-41507,
-41483,
-41242,
-41194,
-41031,
-40953,
-40956,
-40950,
-41009,
-40741,
-40742,
-40347,
-40372,
-40135,
-40187,
-40084,
-39921,
-39794,
-39631,
-39608,
-39421,
-39449,
-39158,
-39051,
-38789,
-38549,
-38367,
-38206,
-38049,
-37996,
-37810,
-37814,
-37674,
-37657,
-37649,
-37418,
-37308,
-36965,
-36704,
-36593,
-36336,
-36302,
-36045,
-35934,
-35620,
-35513,
-35197,
-35143,
-34828,
-34747,
-34458,
-34299,
-34060,
-33876,
-33667,
-33477,
-33352,
-33080,
-33035,
-32711,
-32611,
-32422,
-32266,
-32161,
-31946,
-32057,
-31734,
-31872,
-31604,
-31526,
-31342,
-31101,
-30921,
-30627,
-30444,
-30205,
-30048,
-29887,
-29680,
-29543,
-29441,
-29149,
-29229,
-28912,
-28805,
-28727,
-28541,
-28518,
-28382,
-28330,
-28147,
-28038,
-27884,
-27803,
-27799,
-27701,
-27693,
-27567,
-27511,
-27408,
-27404,
-27303,
-27246,
-27170,
-26958,
-26850,
-26669,
-26613,
-26483,
-26455,
-26271,
-26244,
-26114,
-26164,
-26033,
-26192,
-25901,
-25954,
-25743,
-25768,
-25797,
-25900,
-25928,
-25981,
-25847,
-26008,
-25875,
-26083,
-26144,
-26133,
-26224,
-26134,
-26274,
-26269,
-26351,
-26350,
-26350,
-26324,
-26139,
-26218,
-26059,
-26087,
-26032,
-25876,
-25875,
-25847,
-25876,
-26059,
-26060,
-26165,
-26245,
-26111,
-26405,
-26269,
-26642,
-26666,
-26905,
-26958,
-27115,
-27196,
+45917,
+50830,
+55396,
+60137,
+63628,
+63154,
+59302,
+54471,
+49757,
+45657,
+42519,
+38830,
+34037,
+29390,
+24737,
+20763,
+18862,
+18061,
+17223,
+16114,
+14281,
+12140,
+10747,
+10709,
+11836,
+14901,
+21120,
+29005,
+36633,
+44103,
+50820,
+57373,
+63658,
+65534,
+65470,
+65534,
+65534,
+64781,
+62075,
+59757,
+57050,
+53746,
+51232,
+48603,
+45951,
+42711,
+37429,
+30866,
+23735,
+16387,
+10793,
+7810,
+5436,
+3364,
+1409,
+8,
+65535,
+8,
+13,
+65535,
+1644,
+4476,
+7665,
+11918,
+16530,
+21895,
+25978,
+27716,
+28390,
+27716,
+26119,
+25332,
+24249,
+21216,
+18057,
+14031,
+8008,
+2420,
+65535,
+21,
+65535,
+3,
+65535,
+20,
+65535,
+38,
+65535,
+22,
+65535,
+248,
+9550,
+25561,
+38301,
+47346,
+55083,
+60059,
+61538,
+63733,
+64946,
+64599,
+65343,
+65534,
+65436,
+65534,
+65414,
+65534,
+65433,
+65534,
+65137,
+53969,
+39519,
+28705,
+21677,
+20178,
+19543,
+22305,
+29692,
+36301,
+39580,
+40112,
+36081,
+27550,
+18551,
+10936,
+6810,
+9065,
+16261,
+25174,
+35128,
+45842,
+56676,
+64123,
+65534,
+65194,
+60990,
+53343,
+46004,
+41055,
+39629,
+40682,
+43479,
+45867,
+46908,
+47901,
+48133,
+45231,
+39798,
+33913,
+27431,
+21285,
+17259,
+15401,
+16302,
+19881,
+23928,
+27745,
+32023,
+35289,
+36467,
+36735,
+36686,
+36860,
+38368,
+40904,
+44407,
+49798,
+55993,
+62106,
+65534,
+65439,
+65534,
+64908,
+59735,
+52620,
+45759,
+40071,
+36568,
+35011,
+35105,
+36190,
+36357,
+34408,
+30426,
+24427,
+17969,
+12721,
+8942,
+7561,
+9166,
+13146,
+18755,
+24216,
+28987,
+33259,
+35071,
+34948,
+34957,
+33293,
+30213,
+29215,
+28691,
+27030,
+26984,
+28277,
+30213,
+33317,
+34640,
+34479,
+35544,
+34281,
+30640,
+29420,
+28488,
+26334,
+25842,
+24738,
+22049,
+21541,
+21024,
+18552,
+18156,
+18753,
+16998,
+14935,
+12912,
+9947,
+8112,
+7533,
+6849,
+7013,
+9201,
+11885,
+12439,
+11648,
+12786,
+15290,
+16236,
+16475,
+17308,
+18442,
+20327,
+22756,
+24845,
+25989,
+24438,
+20677,
+18067,
+16849,
+16493,
+17708,
+19032,
+18849,
+18308,
+17001,
+13499,
+10307,
+8933,
+7557,
+8778,
+16503,
+26048,
+33243,
+40105,
+45553,
+47703,
+49164,
+49836,
+48333,
+47648,
+47339,
+46794,
+54755,
+64765,
+65534,
+65471,
+65534,
+65511,
+65534,
+65533,
+65368,
+60663,
+57639,
+56473,
+55087,
+58362,
+62837,
+65064,
+65534,
+62103,
+52818,
+40744,
+27254,
+13713,
+4848,
+1615,
+747,
+2082,
+6260,
+11071,
+15768,
+20526,
+23131,
+22608,
+20988,
+19286,
+19375,
+23620,
+31340,
+40736,
+50921,
+61295,
+65534,
+65439,
+65534,
+65534,
+65530,
+65507,
+65534,
+61305,
+55104,
+51405,
+48730,
+46613,
+44289,
+42099,
+39190,
+34495,
+28469,
+21183,
+13442,
+6864,
+2036,
+65535,
+486,
+4111,
+9090,
+13663,
+17855,
+20974,
+23518,
+26096,
+28638,
+31432,
+34612,
+37612,
+40544,
+44029,
+47578,
+50736,
+53338,
+54020,
+52790,
+51494,
+50024,
+47402,
+44429,
+41352,
+37507,
+33850,
+30465,
+26259,
+22326,
+19432,
+16157,
+12170,
+8560,
+5951,
+4627,
+4438,
+5731,
+8778,
+12356,
+16610,
+22831,
+29377,
+34309,
+38751,
+42407,
+43655,
+43793,
+44354,
+44729,
+44976,
+45423,
+44649,
+42281,
+39133,
+35169,
+30661,
+26308,
+22052,
+17715,
+13110,
+7671,
+2992,
+662,
+2,
+65535,
+2,
+2,
+29,
+1337,
+3553,
+5384,
+7558,
+9864,
+11986,
+15396,
+20560,
+26425,
+31824,
+35493,
+37728,
+39185,
+39017,
+37493,
+36787,
+36918,
+36744,
+35793,
+33792,
+31226,
+27423,
+21934,
+17474,
+14877,
+12488,
+14886,
+23641,
+30330,
+32764,
+36186,
+38742,
+37190,
+35238,
+33476,
+30847,
+29219,
+29797,
+36277,
+49879,
+62114,
+65534,
+65438,
+65534,
+65508,
+65534,
+65534,
+65525,
+65498,
+64927,
+64781,
+65534,
+65527,
+65517,
+65534,
+65403,
+65534,
+60242,
+49367,
+38063,
+28381,
+23867,
+20866,
+18803,
+19479,
+19465,
+17564,
+15311,
+11431,
+6231,
+2281,
+166,
+108,
+5242,
+14717,
+24018,
+33604,
+42909,
+49295,
+53059,
+54769,
+53737,
+51337,
+49374,
+47573,
+47102,
+49106,
+52395,
+56746,
+61487,
+64334,
+65208,
+64305,
+59753,
+52796,
+46045,
+38657,
+31149,
+25853,
+22075,
+19271,
+18412,
+17669,
+15702,
+13281,
+9962,
+5258,
+999,
+65535,
+122,
+65535,
+142,
+65535,
+1267,
+7974,
+15474,
+22424,
+28287,
+31392,
+32784,
+33208,
+32647,
+31584,
+31450,
+32614,
+34617,
+37048,
+39243,
+40529,
+40702,
+39900,
+38767,
+37383,
+35219,
+32772,
+30606,
+28489,
 27273,
-27434,
-27381,
-27457,
-27329,
+27917,
+28767,
+28498,
+28283,
+28575,
+28564,
+28307,
+27490,
+25821,
+24345,
+23335,
+22412,
+21971,
+22036,
+22270,
+22814,
+23524,
+24338,
+25655,
+26934,
+27308,
+26760,
+25422,
+24206,
+24367,
+25715,
+27489,
+29793,
+32109,
+33229,
+33344,
+33017,
+32827,
+33473,
+34442,
+35172,
+36404,
+38620,
+40932,
+42355,
+42522,
+41868,
+40848,
+39608,
+38326,
+36936,
+35591,
+34464,
+33555,
+33529,
+34546,
+34675,
+33290,
+32022,
+31167,
+29982,
+28007,
+24247,
+19395,
+16142,
+16149,
+20829,
+27103,
+28213,
+25976,
+26557,
+27448,
+26172,
+26157,
+26135,
+24234,
+24094,
+28168,
+36667,
+47935,
+55647,
+60723,
+65148,
+65534,
+65463,
+65534,
+65489,
+65534,
+65518,
+65534,
+65528,
+65534,
+65496,
+65534,
+65385,
+65534,
+62833,
+54687,
+46002,
+37688,
+31333,
+25964,
+21538,
+19834,
+18741,
+16774,
+14019,
+10057,
+5494,
+1291,
+65535,
+105,
+65535,
+109,
+65535,
+1515,
+6592,
+11456,
+15680,
+19097,
+21670,
+24589,
+27779,
+30779,
+34182,
+38621,
+43336,
+48183,
+52646,
+55622,
+57250,
+57046,
+54326,
+51148,
+49321,
+47064,
+43795,
+40375,
+36417,
+32053,
+28467,
+25483,
+22524,
+19863,
+16823,
+13735,
+11325,
+9571,
+8422,
+7612,
+7022,
+7742,
+10327,
+13181,
+16382,
+20477,
+23964,
+26566,
+29780,
+33268,
+35968,
+38208,
+39563,
+39543,
+38715,
+37696,
+36213,
+33925,
+30978,
+28186,
+26498,
+25413,
+24860,
+24998,
+24717,
+23742,
+23252,
+23213,
+23016,
+23366,
+24219,
+26035,
+29970,
+35099,
+39689,
+43819,
+47394,
+49248,
+50498,
+51902,
+52495,
+52261,
+51626,
+50962,
+51098,
+52250,
+53553,
+54331,
+54043,
+52144,
+48872,
+44742,
+39877,
+34638,
+28837,
+23141,
+19598,
+18388,
+18524,
+20317,
+23347,
+25801,
+27684,
+29485,
+30844,
+31628,
+32195,
+32421,
+32476,
+33671,
+36056,
+38873,
+41699,
+44541,
+46704,
+47259,
+46811,
+45634,
+43150,
+39810,
+36857,
+34570,
+32763,
+30665,
+27968,
+25552,
+23737,
+21866,
+18955,
+14729,
+9582,
+4481,
+1377,
+3243,
+8820,
+11801,
+12164,
+15544,
+20419,
+23086,
+25732,
+28261,
+27622,
+25979,
+27425,
+32799,
+41060,
+48274,
+52048,
+55845,
+59862,
+60477,
+58556,
+56196,
+53004,
+49438,
+47455,
+47577,
+49710,
+52500,
+52875,
+51121,
+49683,
+47377,
+42614,
+37011,
+32302,
+28390,
+25396,
+24617,
+25214,
+25763,
+26515,
+26459,
+24825,
+23021,
+21271,
+18350,
+15337,
+14971,
+17413,
+20306,
+22945,
+25852,
 27405,
-27407,
-27407,
-27432,
-27301,
-27328,
-27141,
-27196,
-27089,
-27090,
-27063,
-27037,
-27009,
-27038,
-27036,
-27196,
-27379,
-27565,
-27750,
-27828,
-28095,
-28038,
-28385,
-28303,
-28490,
-28542,
-28620,
-28675,
-28726,
-28754,
-28806,
-28595,
-28646,
-28359,
-28329,
-28226,
-28147,
-28038,
-28016,
-27879,
-27884,
-27828,
-27803,
-27907,
-27857,
-28012,
-27883,
-28197,
-28016,
-28461,
-28410,
-28701,
+27223,
+26491,
+25071,
+23665,
+22082,
+20287,
+19373,
+20021,
+21821,
+23740,
+25809,
+27887,
+30236,
+32630,
+34319,
+35164,
+36231,
+36886,
+36748,
+37705,
+39739,
+41860,
+43924,
+46956,
+49934,
+52095,
+53110,
+52427,
+50731,
+47941,
+44929,
+42234,
+40079,
+38760,
+38051,
+37727,
+37218,
+36517,
+35570,
+33227,
+29948,
+27415,
+25687,
+23969,
+22977,
+22748,
+22384,
+22150,
+22908,
+24296,
+25275,
+26885,
+28501,
+29259,
+30242,
+31534,
+32219,
+32584,
+32902,
+33321,
+34314,
+35732,
+37240,
+38910,
+41162,
+42706,
+43658,
+44566,
+45170,
+45122,
+44324,
+44069,
+44680,
+45044,
+44898,
+44630,
+44278,
+43564,
+42109,
+40795,
+39044,
+36329,
+33257,
+29434,
+26866,
+25249,
+23018,
+21619,
+19517,
+17094,
+15210,
+13943,
+11937,
+9679,
+8563,
+6245,
+5706,
+7536,
+9369,
+12045,
+15775,
+18573,
+20716,
+24941,
+27819,
+28634,
+30427,
+30801,
+30653,
+33506,
+36675,
+38163,
+41729,
+44056,
+43783,
+45912,
+46603,
+44605,
+42991,
+40933,
+37911,
+35535,
+35026,
+33266,
+31220,
+31347,
+30834,
+31099,
+32142,
+31413,
+29972,
+28634,
+27596,
+26757,
+27101,
 28832,
-28885,
-29071,
-29147,
-29125,
-29333,
-29019,
-29225,
-28863,
-28960,
-28731,
-28776,
-28597,
-28647,
-28356,
-28411,
-28119,
-28172,
-28121,
-28223,
-28173,
+29674,
+31340,
+34702,
+37278,
+40543,
+43489,
+44323,
+44892,
+45324,
+45376,
+45081,
+45273,
+44969,
+43759,
+43463,
+43033,
+42270,
+41329,
+39499,
+36650,
+33649,
+30912,
 28304,
-28226,
-28382,
-28464,
-28515,
-28779,
-28808,
-28909,
-29152,
-29067,
-29443,
-29411,
-29652,
-29705,
-29754,
-29812,
+25682,
+23330,
+21945,
+20944,
+20634,
+21979,
+22585,
+21939,
+22366,
+21916,
+21667,
+23616,
+25906,
+27214,
+28997,
+31614,
+33000,
+35169,
+38417,
+39158,
+39535,
+40400,
+39566,
+40215,
+41744,
+41176,
+41715,
+42251,
+40450,
+40284,
+40864,
+39024,
+37423,
+36675,
+34974,
+33441,
+33787,
+34012,
+32797,
+33225,
+32716,
+32211,
+34320,
+35752,
+35921,
+36452,
+37823,
+37726,
+37059,
+39122,
+40409,
+37924,
+37940,
+37783,
+36250,
+36513,
+35488,
+34748,
+33531,
+31108,
+29041,
+27725,
+25777,
+22187,
+20337,
+18830,
+16312,
+16614,
+16191,
+14684,
+16042,
+16407,
+16034,
+18229,
+20220,
+21035,
+23162,
+25854,
+28592,
+32437,
+34120,
+36272,
+39463,
+39149,
+41720,
+44919,
+43091,
+45322,
+47691,
+43917,
+43394,
+46981,
+43289,
+39365,
+41628,
+38212,
+34463,
+35551,
+32435,
+31020,
+31473,
+27038,
+26580,
+27076,
+23658,
+23850,
+23962,
+21386,
+23063,
+22746,
+20618,
+24527,
+26065,
+23169,
+26790,
+29820,
+26771,
 29729,
-29836,
-29678,
-29677,
-29572,
-29466,
-29255,
-29308,
-29149,
-29228,
-29230,
-29174,
-29310,
-29252,
-29441,
-29440,
-29678,
-29756,
-29942,
-30125,
-30233,
-30550,
-30547,
-30920,
-30865,
-31103,
-31184,
-31156,
-31287,
-31317,
-31258,
-31346,
-31284,
-31187,
-31231,
-31107,
-31234,
-31183,
-31235,
-31290,
-31312,
-31450,
-31549,
-31713,
-31895,
-32108,
-32237,
-32479,
-32632,
-32850,
-33054,
-33299,
-33478,
-33639,
-33903,
-33981,
-34299,
-34300,
-34509,
-34431,
-34617,
-34401,
-34619,
-34429,
-34538,
-34456,
-34510,
-34484,
-34536,
-34590,
-34721,
-34905,
-35014,
-35220,
-35384,
-35644,
-35805,
-36120,
-36306,
-36596,
-36808,
-37018,
-37205,
-37413,
-37575,
-37836,
-37891,
-38128,
-38154,
-38260,
-38313,
-38443,
-38368,
-38469,
-38341,
-38390,
-38341,
-38311,
-38393,
-38287,
-38548,
-38395,
-38680,
-38658,
-38893,
-39025,
-39185,
-39421,
-39503,
-39762,
-39953,
-40159,
-40374,
-40663,
-40741,
-41034,
-41058,
-41245,
-41348,
-41405,
-41479,
-41431,
-41427,
-41377,
-41323,
-41350,
-41243,
-41219,
-41111,
-41006,
-41007,
-40953,
-40980,
-40927,
-40953,
-40928,
-40953,
-41085,
-41219,
-41321,
-41537,
-41560,
-41877,
-41827,
-42139,
-42225,
-42375,
-42542,
-42482,
-42461,
-42537,
-42300,
-42460,
-42166,
-42197,
-41928,
-41749,
-41584,
-41432,
-41241,
-41140,
-40953,
-40822,
-40716,
-40635,
-40560,
-40555,
-40374,
-40531,
-40319,
-40532,
-40425,
-40558,
-40608,
-40640,
-40792,
-40692,
-40846,
-40638,
-40582,
-40401,
-40292,
-40083,
-39843,
-39661,
-39235,
-39240,
-38839,
-38814,
-38684,
-38390,
-38368,
-38073,
-37970,
-37917,
-37731,
-37759,
-37520,
-37414,
-37311,
-37176,
-37257,
-37045,
-37177,
-36835,
-36780,
-36622,
-36440,
-36489,
-36280,
-36253,
-35935,
-35832,
-35540,
-35512,
-35303,
-35144,
-34879,
-34566,
-34294,
-34171,
-33952,
-33957,
-33719,
-33557,
-33403,
-33188,
-33218,
-33108,
-32981,
-32923,
-32637,
-32582,
-32422,
-32294,
-32237,
-32136,
-31945,
-31793,
-31549,
-31450,
-31365,
-31212,
-31205,
-30870,
+32380,
+31044,
+32666,
+34139,
+35470,
+36203,
+39420,
+42098,
+41086,
+44193,
+45306,
+41519,
+42468,
+43627,
+40072,
+39287,
+41373,
+39361,
+37160,
+39695,
+39216,
+35288,
+34704,
+34486,
+28159,
+25596,
+29486,
+24054,
+21964,
+29823,
+24928,
+22432,
+30981,
+27561,
+22846,
+29604,
+27989,
+21233,
+28017,
+29216,
+23115,
+31189,
+34334,
+27990,
+36926,
+37974,
+32434,
+37268,
+35138,
+35275,
+34532,
+35293,
+39449,
+37155,
+40509,
+41538,
+42962,
+43816,
+41536,
+42502,
+39798,
+35737,
+37885,
+33783,
+33272,
+36520,
+32642,
+33473,
+33614,
+32509,
+30750,
+30054,
+29210,
+29058,
+29428,
+30387,
+29805,
+33487,
+36173,
+33864,
+36431,
+42096,
+38339,
+34333,
+42476,
+38410,
+33878,
+39165,
+40247,
+34158,
+39744,
+42024,
+33444,
+40333,
+41227,
+30326,
+33587,
+37084,
+27516,
+25244,
+32687,
+28696,
+22320,
+30715,
+32266,
+23011,
+28341,
+32862,
+21291,
+23017,
+31095,
+19442,
+17854,
+30276,
+20577,
+15762,
+30775,
+26268,
+16024,
+31569,
+32106,
+16208,
+28279,
+35497,
+16666,
+25322,
+39143,
+21725,
+25481,
+45690,
+29095,
+27184,
+51451,
+34397,
+25539,
+51789,
+38659,
+26084,
+50610,
+45368,
+29023,
+46056,
+50868,
+26891,
+38767,
+51179,
+21656,
+31105,
+48640,
+20599,
+25346,
+44205,
+22992,
+18413,
+40000,
+22682,
+9743,
+34936,
+19253,
+6522,
+32654,
+24575,
+9947,
+34068,
+33595,
+11814,
+38231,
+39324,
+12469,
+41445,
+42847,
+19113,
+43391,
+53532,
+26974,
+46269,
+59406,
+27638,
+49940,
+51771,
+27304,
+47078,
+45009,
+25823,
+44893,
+43803,
+23782,
+45149,
+41501,
+25468,
+43648,
+38328,
+24246,
+41047,
+36288,
+22227,
+45265,
+37296,
+21884,
+50226,
+35062,
+25430,
+50766,
+33631,
+27505,
+47927,
+30691,
+23425,
+44076,
+27384,
+17495,
+41726,
+24758,
+16185,
+42307,
+21608,
+19797,
+42300,
+18491,
+22702,
+42530,
+19778,
+26725,
+44865,
+27710,
+32038,
+51743,
+32986,
+38258,
+58050,
+32530,
+44081,
+60238,
+33408,
+45675,
+56768,
+33253,
+44491,
+48270,
+32751,
+42029,
+39172,
+28046,
+34915,
+31426,
+16668,
+27267,
+24443,
+9046,
+23477,
+19357,
+8742,
+22842,
+14332,
+12632,
+25196,
+14945,
+16951,
+30684,
+20842,
+20468,
+38477,
+25439,
+29585,
+43120,
+30285,
+40404,
+45022,
+35557,
+43319,
+43637,
+34057,
+39181,
+42102,
+27795,
+40894,
+36220,
+25797,
+36592,
+29365,
+22014,
+28041,
+25016,
+17432,
+24441,
+22509,
+16505,
+26259,
+23833,
+19373,
+31871,
+26632,
+23793,
+36357,
+30654,
+28917,
+42447,
+33363,
+36414,
+43896,
+37645,
+41009,
+45877,
+40451,
+39000,
+44560,
+36283,
+34641,
+39766,
 30888,
-30553,
-30599,
-30471,
+32626,
+30815,
+27207,
+28677,
+25859,
+24240,
+23943,
+25596,
+21742,
+22955,
+26820,
+24076,
+25604,
+29249,
+30828,
+33067,
+34005,
+39513,
+38555,
+41471,
+42839,
+43349,
+48050,
+43255,
+45598,
+48235,
+43688,
+42737,
+46316,
+41733,
+37417,
+42336,
+35739,
+34411,
+32173,
+30323,
+30197,
+20417,
+29183,
+22682,
+24282,
+25483,
+22200,
+30803,
+25252,
+27290,
+32939,
+32396,
+33388,
+33472,
+39817,
+40622,
+37341,
+47459,
+43623,
+42930,
+49164,
+42744,
+46625,
+48343,
+38112,
+46323,
+42227,
+32177,
+40618,
+39862,
+27120,
+32909,
+38848,
+21947,
+30779,
+32439,
+22570,
+29374,
+24508,
+23613,
+27713,
+23391,
+25917,
+22614,
+33145,
+24028,
+22716,
+41277,
+19335,
+29258,
+36850,
+24392,
+35477,
+32768,
+36171,
+32317,
+36285,
+39123,
+31053,
+43720,
+32854,
+32869,
+42350,
+26796,
+34849,
+37987,
+24887,
+35643,
+28588,
+28496,
+27951,
+27868,
+26132,
+21085,
+30812,
+16980,
+25119,
+29280,
+15359,
 30284,
-30259,
-29994,
-29837,
-29781,
-29548,
-29701,
-29337,
-29464,
-29124,
-29202,
-29096,
-29018,
-28990,
-28727,
-28754,
-28488,
-28489,
-28305,
-28277,
-28121,
-27986,
-27987,
-27803,
-27935,
-27723,
-27856,
-27775,
-27671,
-27776,
-27645,
-27668,
-27700,
-27588,
-27542,
-27509,
-27408,
-27405,
-27329,
-27351,
-27225,
-27219,
-27117,
-27142,
-26983,
-27092,
-26876,
-26960,
-26743,
-26854,
-26666,
-26800,
-26746,
-26745,
-26775,
-26690,
-26802,
-26718,
-26879,
-26826,
-26877,
-26906,
-26956,
-26933,
-27087,
-26987,
-27139,
-27225,
-27113,
-27249,
-27116,
-27247,
-27250,
-27218,
-27305,
-27217,
-27279,
-27243,
-27252,
-27272,
-27275,
-27249,
-27298,
-27146,
-27192,
-27144,
-27221,
-27168,
-27276,
-27273,
-27275,
-27380,
-27405,
-27435,
-27642,
-27488,
-27800,
-27646,
+28013,
+18459,
+34623,
+27056,
+24726,
+32823,
+27626,
+28376,
+30004,
+35438,
+26499,
+34713,
+37224,
+27998,
+38387,
+35032,
+30823,
+39023,
+32387,
+33387,
+37734,
+33217,
+37905,
+32238,
+35827,
+40071,
+27669,
+40229,
+35672,
+29059,
+40589,
+31603,
+32720,
+37499,
+34041,
+31960,
+37631,
+34389,
+31582,
+38972,
+33443,
+32743,
+37739,
+32752,
+34685,
+35777,
+34489,
+32318,
+41207,
+32871,
+32067,
+40400,
+34448,
+31313,
+35358,
+37563,
+27000,
+38427,
+31579,
+28868,
+43523,
+25292,
+31993,
+40542,
+20430,
+35022,
+31466,
+21067,
+32408,
+29814,
+23269,
+30507,
+35919,
+23743,
+33770,
+33475,
+27497,
+35726,
+29786,
+33188,
+29635,
+30304,
+41650,
+22781,
+39918,
+41406,
+22543,
+45003,
 27880,
-27936,
-27987,
-28119,
-28094,
-28170,
-28228,
-28169,
-28228,
-28170,
-28227,
-28224,
-28145,
-28121,
-28064,
-27912,
-28090,
-27884,
-28064,
-27989,
-27855,
-28040,
-27803,
-28092,
-28041,
-28146,
-28304,
-28277,
-28464,
-28515,
+33139,
+37077,
+21138,
+37103,
+27762,
+21572,
+34087,
+29028,
+28993,
+25793,
+35668,
+31283,
+21583,
+42576,
 28673,
-28783,
-28959,
-28918,
-29037,
-28997,
-29145,
-29126,
-29332,
-29150,
-29281,
-29149,
-29150,
-29176,
-29095,
-29203,
-28964,
-28991,
+29612,
+40243,
+28556,
+41153,
+32959,
+35813,
+49160,
+32881,
+43600,
+44548,
+44437,
+39203,
+39092,
+54420,
+30028,
+41873,
+50550,
+32067,
+43907,
+39351,
+40147,
+35653,
+30239,
+43393,
+25927,
+27547,
+38573,
+25393,
+26844,
+31156,
+30980,
+24221,
+25270,
+34748,
+23567,
+24446,
+34262,
+18990,
+26691,
+33006,
+18710,
+33052,
+32360,
+20465,
+34289,
+33316,
+22926,
+31644,
+32449,
+20788,
+26459,
+27102,
+24846,
+23610,
+30415,
+25276,
+25942,
+30838,
+22410,
+34656,
+27815,
+23289,
+39112,
+25050,
+26189,
+38915,
+33860,
+32464,
+36131,
+46340,
+34701,
+37835,
+51841,
+36853,
+41437,
+44684,
+44640,
+43036,
+44290,
+45980,
+38450,
+48530,
+38901,
+36707,
+45787,
+38252,
+28161,
+41309,
+34737,
+25039,
+37270,
+28420,
+28296,
+26466,
+31075,
+25581,
+23435,
+33363,
+22931,
+21294,
+38129,
+21102,
+24980,
+39181,
+21230,
+35026,
+35106,
+26829,
+39644,
+36970,
+24250,
+40968,
+37083,
+24782,
+40081,
+33941,
+31253,
+32004,
+34443,
+31058,
+27705,
+34144,
+28656,
+26012,
+34760,
+22647,
+27761,
+35114,
+19571,
+32780,
+27031,
+30050,
+29113,
+27159,
+40991,
+25092,
+36242,
+43445,
+27784,
+44205,
+36895,
+33032,
+45221,
+31721,
+36348,
+41248,
+37907,
+30893,
+39378,
+44151,
+27292,
+30177,
+45095,
+24138,
+21671,
+42727,
+17198,
+29088,
+29956,
+23326,
+34898,
+22483,
+32521,
+33828,
+25305,
+33633,
+31175,
+32808,
+35277,
+30868,
+43548,
+32815,
+42387,
+42361,
+33279,
+47343,
+39334,
+33346,
+44057,
+38654,
+32938,
+42611,
+31418,
+35043,
+43128,
+25871,
+32514,
+42727,
+20598,
+28854,
+35128,
+22896,
+26914,
+28712,
+23415,
+28133,
+30310,
+20999,
+33959,
+30035,
+19525,
+32741,
+29218,
+22361,
+31606,
+26796,
+27699,
+30371,
+30060,
+29066,
+35402,
+35675,
+25527,
+35018,
+34991,
+27616,
+29879,
+29480,
+33144,
+28407,
+20915,
+39085,
+33921,
+19946,
+37592,
+35410,
+21074,
+33507,
+31495,
+26902,
+30869,
+27370,
+26898,
+33265,
+32418,
+27519,
+38238,
+36541,
+29133,
+39938,
+38300,
+34310,
+42324,
+33762,
+36511,
+50242,
+30636,
+36742,
+58546,
+34759,
+31928,
+58373,
+42890,
+30258,
+48186,
+44905,
+36190,
+35720,
+38844,
+42637,
+32616,
+26417,
+42922,
+38164,
+18571,
+35304,
+39696,
+18230,
+26882,
+39355,
+21941,
+18634,
+39405,
+26238,
+16459,
+36328,
+30580,
+19733,
+33779,
+27230,
+27367,
+38360,
+19508,
+37108,
+43187,
+22766,
+31243,
+46091,
+35433,
+23617,
+45866,
+37405,
+29214,
+40315,
+37659,
+40307,
+33922,
+38015,
+40451,
+32738,
+35684,
+35417,
+38802,
 28859,
-28858,
-28887,
-28857,
-28887,
-28856,
-28730,
-28856,
-28730,
-29041,
-28939,
-29228,
-29097,
-29308,
-29360,
-29520,
-29781,
-29785,
-29967,
-29916,
-29940,
-30049,
-29913,
-30102,
-29834,
-29970,
-29781,
-29811,
-29729,
-29679,
-29649,
-29628,
-29540,
-29657,
-29567,
-29681,
-29622,
-29679,
-29834,
-29838,
-30046,
-30048,
-30284,
-30232,
-30576,
-30548,
-30788,
-30891,
-30919,
-30998,
-31182,
-31051,
-31369,
-31153,
-31318,
-31285,
-31212,
-31393,
-31208,
-31343,
-31155,
-31262,
-31184,
-31233,
-31318,
+32650,
+42329,
+26620,
+36675,
+36330,
+30625,
+37858,
+29347,
+34060,
+36956,
+28693,
+33535,
+36295,
+32724,
+28327,
+35075,
+38420,
+22377,
+32394,
+40552,
+23076,
+30935,
+36066,
+27337,
+29868,
+33269,
+27271,
+28239,
+31829,
+24403,
+25102,
+33306,
+27887,
+22987,
+33307,
+31304,
+26194,
+31588,
+29881,
+32673,
+30035,
+26918,
+34239,
+29055,
+33615,
+28958,
+31695,
+40747,
+24383,
+33033,
+39371,
+29686,
+30418,
+31114,
+36861,
+28036,
+24940,
+33568,
+30073,
+23424,
+27886,
+32142,
+20317,
+27835,
+29602,
+19192,
+29068,
+26538,
+23310,
+23814,
+27570,
+25442,
+24743,
+33092,
+24278,
+30895,
+36594,
+24487,
+34186,
+43099,
+28716,
+33808,
+48809,
+34924,
+37019,
+46588,
+42243,
+40617,
+45639,
+43959,
+37163,
+53166,
+36718,
+35439,
+55895,
+35894,
+35047,
+42449,
+43546,
+31313,
+33030,
+41534,
+29466,
+35002,
+28590,
+30721,
+36554,
+26165,
+28252,
+36058,
+34145,
+21721,
+33181,
+40083,
+23653,
+32250,
+38979,
+27285,
+37458,
+38172,
+28197,
+42984,
+43071,
+28044,
+41867,
+47796,
+30020,
+36345,
+45489,
+32918,
+36202,
+41991,
+32282,
+35736,
+40386,
+29943,
+33648,
+38846,
+24477,
+35943,
+31597,
+23325,
+35720,
+22517,
+28428,
+34703,
+19783,
+31352,
+33248,
+17316,
+31344,
+37414,
+17715,
+27616,
+41539,
+21112,
+24991,
+38927,
+30666,
+28004,
+31464,
+32933,
+34116,
+32343,
+26342,
+35299,
+37208,
+26405,
+31742,
+34109,
+31961,
+31674,
 31259,
-31502,
-31471,
-31660,
-31762,
-32002,
-32107,
-32344,
-32400,
-32632,
-32716,
+28643,
+34702,
+36379,
+23063,
+32304,
+40563,
+24613,
+32126,
+35000,
+28716,
+38477,
+31823,
+28900,
+38385,
+39779,
+27702,
+32599,
+44757,
+32655,
+28863,
+39847,
+39069,
+27660,
+33312,
+43410,
+27706,
+29416,
+40644,
+27246,
+28164,
+34572,
+27841,
+26832,
+34529,
+25025,
+23209,
+36940,
+26124,
+19928,
+35230,
+34464,
+19124,
+31189,
+36171,
+24992,
+30486,
+35226,
+30062,
+31147,
+37674,
+30660,
+30567,
+40612,
+29960,
+32064,
+38754,
+28126,
+34032,
+35547,
+29601,
+30924,
+34751,
+31221,
+25578,
+32428,
+30902,
+26506,
+29561,
+28680,
+29550,
+27804,
+29185,
+32246,
+27218,
+32220,
+33415,
+28767,
+33839,
+35503,
+34106,
+33885,
+39089,
+39559,
+35198,
+42584,
+41401,
+38938,
+40576,
+40301,
+43667,
+38041,
+40614,
+40777,
+38812,
+39576,
+36819,
+39911,
+37063,
+34086,
+34714,
+35281,
+31680,
+30699,
+32407,
+30967,
+28983,
+29904,
+31739,
+31441,
+29133,
+30666,
+32853,
+28833,
+32339,
+33283,
+30191,
+34202,
+33968,
+32010,
+35888,
+34712,
+35444,
+36329,
+33749,
+36588,
+35800,
+35278,
+36078,
+34782,
+33704,
+34171,
+35395,
+31628,
+32270,
+35192,
+31697,
+31243,
+32597,
+32936,
+31719,
+30122,
+32803,
+32798,
+29846,
+31181,
+33216,
+33099,
+32124,
+33135,
+34445,
+34229,
+33598,
+33674,
+35393,
+31963,
+32522,
+35871,
+30963,
+31508,
+35585,
+31711,
+30197,
+32960,
+31083,
+28456,
+30213,
+27988,
+25991,
+28224,
+25110,
+25493,
+27191,
+24478,
+25696,
+26962,
+24800,
+26563,
+27011,
+24769,
+27937,
+26804,
+26601,
+29952,
+28052,
+29555,
+30588,
+30291,
+31826,
+31759,
+31728,
+32862,
+32536,
+31866,
+33788,
+34439,
+33964,
+35222,
+36727,
+34516,
+36391,
+38312,
+35035,
+37202,
+39764,
+36589,
+38081,
+40257,
+38529,
+39048,
+40722,
+40797,
+40637,
+41966,
+41943,
+42458,
+41963,
+41368,
+42460,
+40482,
+39070,
+39546,
+37012,
+36793,
+35826,
+35087,
+34366,
+33587,
 32898,
-32979,
-33190,
-33163,
-33322,
-33241,
-33430,
-33345,
-33483,
-33372,
-33483,
-33398,
-33536,
-33451,
-33640,
-33586,
-33770,
-33744,
-33957,
-33953,
-34302,
-34216,
-34513,
-34508,
-34749,
-34906,
-35063,
-35331,
+31727,
+32017,
+28750,
+29962,
+28665,
+24886,
+26174,
+26681,
+21874,
+22695,
+26084,
+18822,
+22313,
+25545,
+18771,
+22968,
+23011,
+19425,
+22117,
+21246,
+19153,
+21679,
+21425,
+18219,
+21542,
+21001,
+17247,
+19170,
+17322,
+14580,
+19236,
+21449,
+23859,
+30074,
+31149,
+34269,
+38687,
+36803,
+37451,
+41805,
+41732,
+38932,
+43219,
+47702,
+48181,
+50171,
+52753,
+55317,
+54447,
+53792,
+54073,
+56452,
+54520,
+52018,
+56522,
+53605,
+51450,
+53966,
+50350,
+44564,
+44226,
+40394,
+32643,
+33129,
+31957,
+29738,
+28758,
+26001,
+27873,
+25901,
+20353,
+20923,
+20871,
+16429,
+16817,
+19045,
+18690,
+22648,
+26086,
+26710,
+29686,
+30628,
+31760,
+32995,
+31564,
+32418,
+34650,
+35889,
+34310,
+38725,
+40990,
+39094,
+41218,
+39579,
+38809,
+38365,
+37445,
+35496,
+33822,
+36092,
+33439,
+31258,
+32729,
+29792,
+27462,
+25151,
+22438,
+22092,
+19863,
+19327,
+20762,
+18977,
+19639,
+21732,
+20898,
+21211,
+22289,
+22605,
+22121,
+23984,
+25500,
+26657,
+27765,
+30947,
+32210,
+31107,
+37121,
+36849,
+35352,
+40847,
+38643,
+38028,
+42975,
+40768,
+40714,
+44274,
+42870,
+41579,
+44252,
+43444,
+41578,
+42237,
+42198,
+40939,
+39361,
+42081,
+41550,
+40167,
+41653,
+41880,
+41593,
+40123,
+40997,
+40146,
+37482,
+38515,
+37994,
+34088,
 35432,
-35673,
-35726,
-35960,
-36044,
-36224,
-36255,
-36252,
-36307,
-36251,
-36307,
-36358,
-36200,
+35179,
+31965,
+32688,
+31886,
+31290,
+30496,
+29503,
+29390,
+29103,
+28535,
+28403,
+27800,
+27215,
+25896,
+24131,
+24934,
+22145,
+19369,
+21510,
+20538,
+19026,
+20419,
+20508,
+19727,
+19353,
+17715,
+16345,
+18660,
+15976,
+15578,
+18202,
+16161,
+16394,
+15301,
+14233,
+12469,
+11219,
+14874,
+19920,
+23361,
+29426,
+36427,
+39075,
+40247,
+40217,
+42641,
+43593,
+40272,
+41288,
+43088,
+45073,
+47580,
+47789,
+52174,
+55894,
+54387,
+53620,
+54927,
+56494,
+55247,
+51741,
+53149,
+54206,
+51957,
+50333,
+47736,
+46894,
+43087,
+36407,
+33333,
+31845,
+30927,
+28539,
+26473,
+27191,
+25141,
+22677,
+20770,
+15512,
+15049,
+14723,
+10917,
+12470,
+16285,
+20774,
+22513,
+23939,
+28918,
+29839,
+28759,
+30919,
+30192,
+30350,
+33022,
+33652,
+37317,
+40628,
+43123,
+45771,
+46664,
+45687,
+45923,
+46285,
+44698,
+43917,
+43478,
+44111,
+43038,
+41820,
+42215,
+40304,
+37650,
+35478,
+33573,
+31735,
+27995,
+28565,
+28788,
+24682,
+26873,
+27163,
+25137,
+26996,
+26096,
+25275,
+26035,
+25727,
+26585,
+26994,
+27613,
+30290,
+31766,
+32251,
+33743,
+36868,
+36090,
+36142,
+37632,
+35232,
+36026,
+36319,
+34655,
+34561,
+35858,
+34989,
+32633,
+34746,
+31411,
+29838,
+31947,
+26968,
+27560,
+30328,
+28305,
+30786,
+33458,
+32303,
+35441,
 36466,
-36197,
-36440,
-36278,
-36465,
-36437,
-36545,
-36568,
-36729,
-36782,
-37043,
-37048,
-37307,
-37363,
-37521,
-37651,
-37788,
-37806,
-38133,
-37939,
-38316,
-38178,
-38420,
-38470,
-38553,
-38627,
-38737,
-38654,
-38763,
-38656,
-38550,
-38551,
-38391,
-38419,
-38259,
-38261,
-38180,
-38234,
-38154,
-38339,
-38207,
-38393,
-38364,
-38420,
-38443,
-38525,
-38551,
-38787,
-38815,
-39026,
-38998,
-39185,
-39159,
-39340,
-39320,
-39444,
-39320,
-39287,
-39239,
-39130,
-39185,
-39078,
-38894,
-38841,
-38602,
-38526,
-38416,
-38341,
-38180,
-38101,
-37891,
-37810,
-37838,
-37732,
-37890,
-37758,
-37759,
-37756,
-37787,
-37809,
-37998,
-37889,
-38102,
+34732,
+36655,
+37854,
+37194,
+38289,
+38342,
+37372,
+39949,
+38970,
+37659,
+39676,
+39921,
+39156,
+38707,
+38400,
+39697,
+39210,
+36976,
+38045,
+38091,
+36225,
+35427,
+35132,
+34541,
+33802,
+32382,
+31485,
+31621,
+30909,
+29604,
+29562,
+29721,
+28637,
+28842,
+29267,
+28988,
+30424,
+31224,
+30898,
+31918,
+32936,
+32821,
+32476,
+33658,
+33731,
+33270,
+33546,
+33157,
+33150,
+32509,
+31509,
+31107,
+29828,
+28016,
+26269,
+22866,
+21004,
+18797,
+14526,
+12899,
+12275,
+8839,
+6799,
+6010,
+2336,
+107,
+4,
+65535,
+74,
+65535,
+3131,
+9250,
+14075,
+20075,
+27413,
+29967,
+29398,
+32229,
+36544,
+36477,
+35858,
+41820,
+47861,
+49625,
+53019,
+58853,
+62924,
+63455,
+63900,
+63889,
+63371,
+62542,
+60101,
+57462,
+55614,
+57431,
+52816,
+47066,
+48817,
+44108,
+38005,
+36350,
+32452,
+31361,
+30523,
+26467,
+25687,
+25261,
+21856,
+19277,
+18841,
+17213,
+18018,
+21363,
+22106,
+27558,
+34083,
+36418,
+41155,
+44899,
+45364,
+46977,
+48299,
+45754,
+47658,
+49604,
+47259,
+51233,
+52659,
+51843,
+54493,
+53387,
+51829,
+50676,
+48332,
+45574,
+43396,
+40937,
+38030,
+36757,
+34010,
+31228,
+29741,
+27693,
+24921,
+23956,
+23110,
+21064,
+22135,
+22506,
+20782,
+22006,
+21962,
+19377,
+19795,
+18863,
+17347,
+19657,
+20102,
+20338,
+25061,
+26555,
+26956,
+31391,
+30831,
+30893,
+33579,
+31512,
+31614,
+33022,
+32154,
+32208,
+32962,
+32721,
+32259,
+32866,
+32340,
+31881,
+32601,
+31446,
+30588,
+30643,
+30429,
+29461,
+31896,
+36062,
+34905,
+36875,
+40779,
+39514,
+37660,
 37889,
-38103,
-37994,
-38157,
-38125,
-38104,
-38020,
-37866,
-37624,
-37549,
-37282,
-37151,
-36966,
-36622,
-36491,
-36281,
-36065,
-35966,
-35801,
-35647,
-35460,
-35303,
-35275,
-35172,
-35247,
-35145,
-35223,
-35170,
-35197,
-35170,
-35171,
-35089,
-35094,
-34876,
-34910,
-34587,
-34642,
-34459,
-34429,
-34353,
-34271,
-34115,
-33875,
-33746,
-33584,
-33428,
-33243,
-33057,
-32714,
-32583,
-32450,
-32292,
-32344,
-32160,
-32134,
-31895,
-31871,
-31708,
-31714,
-31655,
-31608,
-31550,
-31555,
-31497,
+38029,
+37444,
+35396,
+33909,
+37148,
+38014,
+34134,
+36223,
+40776,
+38546,
+36391,
+39228,
+40889,
+38760,
+37950,
+37584,
+37732,
+37290,
+33382,
+32789,
+33201,
+30641,
+29458,
+28348,
+27527,
+29211,
+27868,
+24861,
+25635,
+25333,
+22402,
+20158,
+20407,
+20331,
+18488,
+19009,
+20493,
+21384,
+22197,
+23790,
+25127,
+24535,
+25678,
+26445,
+25520,
+26211,
+27437,
+26380,
+26300,
+26913,
+25349,
+24652,
+22463,
+21065,
+20270,
+16924,
+15990,
+14673,
+11231,
+9199,
+5997,
+1865,
+0,
+64,
+65535,
+2827,
+9383,
+15201,
+22254,
+28101,
+29730,
+33023,
+35897,
+35338,
+38693,
+42770,
+45630,
+51478,
+56188,
+61754,
+65534,
+65437,
+65534,
+65529,
+65521,
+65534,
+65529,
+65517,
+65534,
+65451,
+65534,
+64699,
+62525,
+59880,
+54426,
+50736,
+46501,
+40939,
+37938,
+33267,
+28797,
+25542,
+20491,
+16348,
+14118,
+10666,
+9965,
+11122,
+11297,
+13893,
+18856,
+22133,
+24412,
+29448,
+31354,
+31822,
+35252,
+37000,
+38332,
+42021,
+45011,
+47754,
+51275,
+53338,
+55217,
+56838,
+56006,
+54676,
+53684,
+51121,
+48486,
+45511,
+42456,
+39821,
+36853,
+34432,
+31084,
+28119,
+26055,
+22258,
+19485,
+18123,
+16167,
+14907,
+14163,
+13958,
+14072,
+13277,
+14488,
+14728,
+14409,
+16761,
+18905,
+24460,
+30956,
+35644,
+39512,
+43480,
+45230,
+42175,
+41833,
+44964,
+46150,
+43706,
+45306,
+50024,
+48154,
+45661,
+46280,
+46022,
+42453,
+37113,
+36234,
+35809,
+32754,
+31400,
+30106,
+28850,
+28015,
+24831,
+22331,
+22103,
+20811,
+17815,
+14239,
+14199,
+15219,
+11531,
+9162,
+10550,
+8575,
+6230,
+6208,
+6324,
+8440,
+9730,
+8750,
+9412,
+10908,
+8166,
+4968,
+2794,
+186,
+65535,
+65535,
+134,
+65535,
+4616,
+15209,
+24600,
+33759,
+38756,
+39758,
+38115,
+35526,
+36197,
+36049,
+36624,
+42741,
+49765,
+55164,
+59993,
+64606,
+65534,
+65385,
+65534,
+65476,
+65534,
+65524,
+65526,
+65534,
+65524,
+65293,
+63341,
+61255,
+60266,
+56615,
+51835,
+46118,
+43418,
+42410,
+35430,
+30725,
+28020,
+22951,
+16735,
+10017,
+7801,
+6586,
+4970,
+7787,
+12280,
+16616,
+21338,
+25537,
+26760,
+27917,
+29734,
+29306,
+30932,
+33942,
+36811,
+41088,
+46421,
+50731,
+54303,
+57764,
+57833,
+57366,
+55906,
+52509,
+50785,
+49184,
+47672,
+46577,
+45721,
+44512,
+42427,
+39073,
+35435,
 31608,
-31681,
-31636,
-31601,
-31424,
-31311,
-31212,
-31023,
-30945,
-30709,
-30652,
-30418,
-30338,
-30310,
-30181,
-30230,
-30049,
-30019,
-29705,
+26844,
+25038,
+23090,
+20339,
+21375,
+22680,
+20973,
+20119,
+21552,
+19862,
+18103,
+18995,
+18812,
+19868,
+22542,
+25070,
+28217,
+31666,
+34710,
+37095,
+38817,
+39739,
+40429,
+40620,
+40074,
+39955,
+40085,
+40295,
+40432,
+41355,
+42052,
+42260,
+42385,
+42099,
+41905,
+40300,
+39234,
+38065,
+36178,
+34894,
+33492,
+32868,
+31934,
+31536,
+32245,
+32218,
+32647,
+33881,
+34363,
+34886,
+34734,
+33878,
+33809,
+31965,
+30798,
+30835,
+29698,
+29433,
+29536,
+29514,
+28464,
+28342,
+28365,
+26495,
+26261,
+25793,
+24077,
+23460,
+22553,
+21350,
+20286,
+18987,
+19005,
+18095,
+17172,
+18265,
+17479,
+16312,
+16302,
+14922,
+13348,
+13669,
+13818,
+13670,
+15810,
+17405,
+17555,
+19421,
+20846,
+21109,
+22794,
+23694,
+24254,
+24889,
+24741,
+24258,
+23500,
+21649,
+20051,
+21197,
+21505,
+23683,
+30460,
+37614,
+41087,
+44177,
+48405,
+47096,
+42525,
+40978,
+41484,
+40112,
+39224,
+42269,
+47250,
+50312,
+52086,
+57220,
+61239,
+60439,
+59711,
+59091,
+57961,
+54793,
+51744,
+52031,
+51004,
+50312,
+50445,
+49137,
+49109,
+48008,
+44457,
+41803,
+40480,
+38598,
+34156,
+31159,
+29627,
+25539,
+20527,
+18678,
+18679,
+16894,
+18749,
+22172,
+23570,
+26052,
+28007,
+27811,
+27045,
+26497,
+26166,
+25169,
+25293,
+27820,
+29898,
+32392,
+36117,
+40714,
+42449,
+43355,
+45615,
+44493,
+42509,
+43005,
+42543,
+41369,
+42781,
+43123,
+42601,
+43017,
+42371,
+40272,
+38193,
+36575,
+34021,
+32596,
+31924,
+31082,
+31595,
+31271,
+29995,
+29690,
+28782,
+27215,
+26651,
+26582,
+26350,
+27362,
+28739,
+29610,
+31829,
+33472,
+34040,
+35296,
+36141,
+35751,
+36304,
+37097,
+36280,
+36564,
+37035,
+36677,
+36650,
+37104,
+37945,
+38319,
+38875,
+39950,
+40230,
+39286,
+38650,
+37914,
+36228,
+35005,
+34979,
+34712,
+33904,
+34361,
+34969,
+33988,
+33247,
+32378,
+30196,
+27439,
+24783,
+22530,
+20076,
+18773,
+17800,
+16633,
+16715,
+16835,
+16273,
+15699,
+15200,
+13841,
+12391,
+10565,
+9595,
+8959,
+6909,
+6581,
+6476,
+6061,
+6889,
+8434,
+10293,
+11642,
+13124,
+14338,
+15197,
+15791,
+15965,
+16225,
+16456,
+16355,
+16497,
+16871,
+16715,
+17291,
+17779,
+20021,
+26661,
+34489,
+42275,
+48749,
+52966,
+52782,
+48629,
+46130,
+45848,
+45768,
+45197,
+48169,
+53052,
+54298,
+56545,
+61654,
+64409,
+63313,
+61018,
+59904,
+58601,
+54855,
+52563,
+53705,
+54004,
+53324,
+53802,
+55520,
+56040,
+53364,
+50594,
+47477,
+44369,
+42050,
+37747,
+35542,
+35276,
+31177,
+27618,
+26776,
+25327,
+23648,
+22230,
+23269,
+24935,
+24428,
+24853,
+25497,
+24024,
+22310,
+21395,
+20811,
+21036,
+22646,
+24776,
+26823,
+30632,
+33764,
+34862,
+37039,
+37956,
+37378,
+38033,
+38608,
+39693,
+41848,
+43793,
+45935,
+48143,
+49338,
+49483,
+49741,
+48594,
+46276,
+45741,
+44930,
+43016,
+42911,
+43333,
+41879,
+40156,
+39157,
+37794,
+34982,
+32690,
+31867,
+29428,
+27200,
+26962,
+25575,
+24354,
+24770,
+23461,
+22229,
+22927,
+22058,
+20865,
+21258,
+21589,
+21496,
+21639,
+22824,
+24041,
+24414,
+25914,
+27606,
+28524,
+30333,
+31215,
+31272,
+32127,
+32299,
+32337,
+33291,
+34802,
+36016,
+36769,
+38276,
+39376,
+39231,
+39006,
+38031,
+35899,
+33671,
+31169,
+28946,
+28040,
+27173,
+26752,
+26790,
+26216,
+25931,
+25226,
+23730,
+22714,
+21525,
+19227,
+17910,
+17407,
+15794,
+14855,
+14599,
+13414,
+12790,
+13710,
+14160,
+14946,
+16884,
+17039,
+17383,
+18850,
+18621,
+18691,
+19343,
+18026,
+16178,
+15601,
+14402,
+13321,
+13907,
+14784,
+17362,
+22981,
+30206,
+36518,
+41702,
+43915,
+41762,
+38792,
+36674,
+36374,
+37338,
+38777,
+41083,
+44746,
+47834,
+50584,
+55851,
+59104,
+58016,
+56807,
+56328,
+54690,
+53339,
+53193,
+54219,
+55635,
+56087,
+57738,
+60648,
+61635,
+60393,
+58521,
+56827,
+55750,
+53800,
+51508,
+50990,
+49188,
+45446,
+43201,
+41994,
+40330,
+39063,
+38019,
+37598,
+38064,
+37186,
+35792,
+34487,
+31907,
+28934,
+27058,
+25828,
+25486,
+26357,
+26300,
+26499,
+27849,
+27622,
+26333,
+26180,
+24411,
+21385,
+21229,
+21177,
+20940,
+23255,
+25369,
+26200,
+27758,
+29040,
 29809,
-29439,
-29759,
-29331,
-29654,
-29305,
-29469,
-29411,
-29389,
-29543,
-29495,
-29491,
-29573,
-29386,
-29493,
-29519,
-29465,
-29575,
-29462,
-29496,
-29464,
-29440,
-29389,
-29332,
-29255,
-29203,
-29016,
-29151,
-28910,
-29125,
-28908,
-29101,
-28881,
-29074,
-28856,
-29098,
-28911,
-29150,
-28963,
-29178,
-29121,
-29309,
-29333,
-29440,
-29599,
-29492,
-29757,
-29597,
-29732,
-29755,
-29758,
-29756,
-29757,
-29756,
-29783,
-29837,
-29835,
-29969,
-29887,
-30022,
-29914,
-30023,
-29991,
-30103,
-30045,
-30208,
-30150,
-30313,
-30336,
-30472,
-30388,
-30604,
-30389,
-30681,
-30471,
-30784,
-30657,
-30890,
-30816,
-30968,
-31053,
-31155,
-31289,
-31314,
-31421,
-31446,
-31500,
-31579,
+30565,
+30582,
+30772,
+31132,
 31525,
-31713,
-31523,
-31766,
-31604,
-31763,
-31661,
-31839,
-31714,
-31946,
-31713,
-32025,
-31793,
-31999,
-32003,
-31973,
-32135,
-32053,
-32266,
-32266,
-32369,
-32400,
-32422,
+32851,
+34937,
+36988,
+38582,
+39421,
+39714,
+39784,
+39083,
+37939,
+37404,
+36714,
+35596,
+35677,
+36515,
+37034,
+37722,
+38182,
+38034,
+37386,
+35796,
+34001,
+32692,
+31239,
+30323,
+30257,
+30518,
+31292,
+32093,
+32639,
+33584,
+34132,
+33454,
+32938,
 32478,
-32529,
-32582,
-32715,
-32660,
-32796,
-32765,
-32821,
-32978,
-32872,
-32979,
-32873,
-32899,
-32951,
-32954,
-33028,
-32903,
-32949,
-32821,
-32925,
-32900,
-32899,
-32899,
-32767,
-32820,
-32715,
-32871,
-32770,
-32843,
-32955,
-32871,
-33217,
-33030,
-33376,
-33266,
-33404,
-33346,
-33429,
-33294,
-33401,
-33190,
-33294,
-33112,
-33268,
-33137,
-33243,
-33136,
-33005,
-33084,
-32872,
-33033,
-32925,
-32819,
-32795,
-32686,
-32742,
-32768,
-32765,
-32717,
-32685,
-32716,
-32608,
-32741,
-32767,
-32715,
-32818,
-32664,
-32738,
-32822,
-32846,
-32898,
-32954,
-32844,
-32875,
-32739,
-32741,
-32741,
-32582,
-32715,
-32370,
-32451,
-32370,
-32266,
-32371,
-32239,
-32161,
-32184,
-31923,
-32028,
-31921,
-32057,
-31972,
-32108,
-32028,
-32158,
-32136,
-32210,
-32294,
-32395,
-32294,
-32369,
-32135,
-32344,
-32159,
-32400,
-32208,
-32270,
-32183,
-32162,
-32185,
-32108,
-32210,
-32084,
-32078,
-32003,
-31868,
-31949,
-31843,
-31922,
-31870,
-31736,
-31897,
-31683,
-31897,
-31842,
-32002,
-32001,
-32107,
-32027,
-32267,
-32237,
-32400,
-32421,
-32425,
-32424,
-32397,
-32399,
-32368,
-32427,
-32368,
-32452,
-32318,
-32291,
-32266,
-32265,
-32292,
-32318,
-32213,
-32291,
-32187,
-32344,
-32346,
-32475,
-32557,
-32635,
+31500,
+30666,
+30249,
+29688,
+28868,
+28662,
+28533,
+28554,
+29223,
+29374,
+28471,
+27335,
+25997,
+24095,
+22093,
+20505,
+19644,
+18711,
+17734,
+17929,
+18713,
+19030,
+19493,
+20297,
+20296,
+19492,
+18617,
+17947,
+17586,
+17223,
+17283,
+18297,
+19177,
+19932,
+21537,
+22663,
+22531,
+22250,
+21577,
+20561,
+19806,
+18733,
+17435,
+16354,
+14980,
+13540,
+12177,
+10840,
+10495,
+12080,
+15703,
+21085,
+26832,
+30143,
+30279,
+29021,
+28132,
+27875,
+29111,
+31580,
+34293,
+36812,
+39908,
+44573,
+50616,
+56454,
+60344,
+63070,
+64876,
+65072,
+63989,
+63528,
+63057,
+62191,
+62490,
+64472,
+65534,
+65494,
+65534,
+65520,
+65534,
+63684,
+60153,
+56058,
+52384,
+49689,
+46173,
+42571,
+40685,
+39015,
+36925,
+35530,
+34149,
 32582,
-32741,
-32715,
-32924,
-32953,
-33005,
-33031,
-32979,
-33110,
-32978,
-33137,
-33085,
-33083,
-33191,
-33056,
-33269,
-33165,
-33345,
-33299,
-33424,
-33404,
-33371,
-33509,
-33294,
-33613,
-33296,
-33610,
-33351,
-33582,
-33405,
-33610,
-33586,
-33692,
-33902,
-33744,
-33984,
-33795,
-33982,
-33957,
-34164,
-34091,
-34243,
-34195,
-34297,
-34353,
-34457,
-34430,
-34432,
-34350,
-34301,
-34270,
-34301,
-34270,
-34406,
-34325,
-34430,
-34380,
-34454,
-34434,
-34587,
-34511,
-34642,
-34563,
-34615,
-34617,
-34692,
-34778,
-34718,
-34855,
-34695,
-34878,
-34776,
-34879,
-34931,
-34910,
-34954,
-34938,
+31130,
+29068,
+26319,
+23806,
+21831,
+19859,
+18699,
+18957,
+19382,
+20074,
+20952,
+21195,
+22075,
+22770,
+22000,
+21885,
+22153,
+22108,
+23061,
+24187,
+25799,
+28369,
+30132,
+31610,
+33306,
+34590,
+35582,
+36205,
+37132,
+38281,
+38864,
+39994,
+41052,
+41845,
+43738,
+44781,
+44822,
+45410,
+45075,
+43859,
+43162,
+42039,
+40986,
+39947,
+38476,
+37950,
+37519,
+37136,
+37358,
+36306,
+34520,
+33353,
+30981,
+28508,
+27224,
+25727,
+24712,
+24787,
+25447,
+26794,
+27840,
+27991,
+28231,
+27622,
+26482,
+26297,
+26167,
+25485,
+25184,
+25272,
+25274,
+25802,
+26775,
+27861,
+28672,
+28885,
+28905,
+28723,
+28032,
+27071,
+26030,
+24750,
+23928,
+23446,
+23103,
+23119,
+22978,
+22663,
+22294,
+21910,
+21132,
+19985,
+18374,
+16419,
+14780,
+13652,
+12970,
+12599,
+12439,
+12234,
+12090,
+12346,
+13099,
+13704,
+13583,
+13075,
+12121,
+10964,
+10466,
+10114,
+9165,
+8269,
+7807,
+8424,
+12148,
+18580,
+24213,
+27874,
+30261,
+30449,
+29712,
+30837,
+33280,
+35175,
+36934,
+39150,
+42050,
+45940,
+50976,
+55878,
+58966,
+61247,
+63228,
+63739,
+63372,
+63570,
+63152,
+62535,
+63824,
+65435,
+65534,
+65495,
+65534,
+65471,
+65534,
+64835,
+62079,
+59341,
+57065,
+55304,
+53993,
+52540,
+51195,
+49334,
+47058,
+45211,
+44209,
+43402,
+42070,
+40108,
+37626,
 34875,
-35041,
-34930,
-35042,
-35008,
-35042,
-34955,
-34988,
-34958,
-34959,
-35039,
-34984,
-35014,
-34929,
-34989,
-34850,
-35014,
-34880,
-34904,
-34909,
-34876,
-34910,
+32874,
+31429,
+29527,
+27957,
+26317,
+24546,
+23536,
+23090,
+22597,
+21727,
+20404,
+19258,
+18581,
+17989,
+17649,
+17358,
+17405,
+18194,
+19724,
+21718,
+23150,
+23829,
+23969,
+23437,
+23901,
+25566,
+26919,
+28925,
+31169,
+32764,
+34809,
+36842,
+37880,
+38441,
+38687,
+38880,
+39602,
+40765,
+42016,
+43060,
+43763,
+44182,
+44903,
+45338,
+45041,
+44230,
+42356,
+40495,
+39591,
+38567,
+37697,
+37253,
+36152,
+35173,
+34840,
+34685,
+34855,
+34607,
+33714,
+32881,
+32116,
+31778,
+31774,
+31542,
+31151,
+30857,
+30660,
+30503,
+30761,
+30852,
+30481,
+30014,
+29660,
+29619,
+29933,
+29797,
+29096,
+28422,
+27183,
+26096,
+25521,
+24809,
+24089,
+23584,
+22937,
+22335,
+21831,
+20542,
+18977,
+17248,
+15316,
+13602,
+11854,
+10426,
+9215,
+7838,
+6957,
+6588,
+6181,
+6193,
+6343,
+6002,
+5645,
+4926,
+3969,
+3593,
+3519,
+3263,
+3177,
+4022,
+6310,
+10280,
+15459,
+19945,
+22688,
+24524,
+25626,
+27007,
+29972,
+33578,
+36318,
+38898,
+42099,
+45987,
+50571,
+55698,
+60192,
+63681,
+65534,
+65524,
+65527,
+65534,
+65519,
+65534,
+65526,
+65534,
+65534,
+65522,
+65534,
+65509,
+65534,
+65505,
+65534,
+65372,
+62216,
+57845,
+54304,
+51185,
+48662,
+46050,
+42811,
+39550,
+37248,
+35716,
+34156,
+32434,
+29986,
+26765,
+24227,
+22799,
+21497,
+20550,
+20032,
+19234,
+19181,
+19883,
+20931,
+22177,
+22713,
+23161,
+23980,
+24825,
+26157,
+27222,
+27754,
+29085,
+30572,
+32146,
+34426,
+35934,
+36466,
+36684,
+36560,
+37094,
+37892,
+38253,
+38832,
+38985,
+38959,
+39114,
+38436,
+37382,
+36437,
+35148,
+34610,
+35190,
+35609,
+35669,
+35730,
+35519,
 34982,
-35015,
-35220,
-35120,
-35247,
-35094,
-35220,
-35040,
-35222,
-34960,
-35090,
-34882,
-34902,
-34884,
-34902,
-34937,
-34929,
-34881,
-34775,
+35156,
+35366,
 34772,
-34618,
-34745,
-34592,
-34614,
-34511,
-34536,
-34483,
-34565,
-34481,
-34539,
-34534,
-34354,
-34482,
 34352,
-34353,
-34401,
-34356,
-34400,
-34328,
-34404,
-34271,
-34432,
-34246,
-34350,
-34143,
-34138,
-34035,
-33957,
-33980,
-33878,
-33875,
-33797,
-33692,
-33665,
-33533,
-33560,
-33451,
-33325,
-33372,
-33139,
-33215,
-33242,
-33138,
-33321,
-33137,
-33216,
-33163,
-33085,
-33135,
-33060,
-33056,
-33005,
-32847,
-32898,
-32768,
-32872,
-32663,
-32712,
-32479,
-32475,
-32292,
-32372,
-32238,
-32186,
-32082,
-31947,
-31976,
-31737,
-31921,
-31554,
-31789,
-31500,
-31605,
-31500,
-31604,
-31528,
-31576,
-31608,
-31524,
-31660,
-31471,
-31581,
-31339,
-31502,
-31180,
-31397,
-31021,
-31159,
-30918,
-30891,
-30868,
-30730,
-30791,
-30625,
-30577,
-30521,
-30418,
-30416,
-30339,
-30362,
-30313,
-30362,
-30313,
-30363,
-30417,
-30313,
-30414,
-30261,
-30362,
-30259,
-30260,
-30309,
-30128,
-30231,
-29968,
-30101,
-29914,
-29968,
-29916,
-29861,
-29890,
-29915,
-29782,
-29944,
-29754,
-29890,
-29783,
-29809,
-29679,
-29649,
-29652,
-29545,
-29678,
-29599,
-29702,
-29758,
-29729,
-29890,
-29757,
-29940,
-29890,
-29967,
-29916,
-29967,
-29889,
-30021,
-29915,
-29995,
-30046,
-29995,
-30021,
-29967,
-29917,
-29939,
-29996,
-29863,
-30018,
-29893,
-30016,
-30076,
-30127,
-30256,
-30262,
-30228,
-30340,
-30364,
-30415,
-30551,
-30469,
-30627,
-30525,
-30651,
-30684,
-30758,
+33851,
+33339,
+33278,
+33191,
+33025,
+32966,
+33025,
+33229,
+33426,
+33578,
+33490,
+32649,
+31566,
+30833,
+29789,
+28554,
+27525,
+26435,
+25616,
+24983,
+24273,
+23568,
+22815,
+21710,
+20440,
+19467,
+18841,
+18291,
+17715,
+17442,
+17433,
+17250,
+16978,
+16710,
+16468,
+16339,
+16090,
+16373,
+16969,
+17338,
+17676,
+17937,
+18095,
+18063,
+17864,
+17200,
+16433,
+15951,
+15282,
+14252,
+13189,
+12290,
+11535,
+11162,
+10962,
+10306,
+9154,
+7655,
+6708,
+7593,
+9826,
+12044,
+13608,
+14891,
+16270,
+17900,
+20060,
+22827,
+25836,
+28670,
+31909,
+36198,
+41634,
+47278,
+52011,
+56293,
+60927,
+64707,
+65534,
+65478,
+65534,
+65514,
+65534,
+65529,
+65534,
+65531,
+65534,
+65522,
+65534,
+65507,
+65534,
+65492,
+65534,
+65278,
+62123,
+58125,
+54681,
+50935,
+46721,
+42195,
+38047,
+34129,
+30484,
+26998,
+23369,
+20268,
+18055,
+16124,
+14664,
+13753,
+13106,
+12933,
+12947,
+13271,
+13962,
+14087,
+14198,
+14841,
+15780,
+17466,
+19459,
+21350,
+23465,
+25533,
+27366,
+29227,
+30989,
+32450,
+33497,
+34124,
+34834,
+35620,
+36275,
+37274,
+38536,
+39963,
+41709,
+43258,
+44210,
+44277,
+43857,
+43430,
+43224,
+43657,
+44063,
+44214,
+44286,
+44218,
+44616,
+45082,
+45183,
+45046,
+44474,
+43809,
+43429,
+42952,
+42108,
+41357,
+40597,
+40052,
+40113,
+39816,
+38894,
+37325,
+35274,
+33525,
+32136,
+31192,
+30376,
+29174,
+27705,
+26486,
+25336,
+23875,
+22529,
+20973,
+19288,
+18143,
+17298,
+16641,
+15818,
+14676,
+13415,
+12543,
+12481,
+12476,
+12230,
+11791,
+11065,
+10098,
+9482,
+9547,
+9595,
+9271,
+8736,
+8447,
+8461,
+8562,
+8843,
+9066,
+9051,
+8893,
+8297,
+7409,
+6735,
+6048,
+5925,
+7708,
+10842,
+13672,
+15663,
+16549,
+16852,
+17249,
+18035,
+19781,
+22007,
+24203,
+26841,
+30390,
+34881,
+39694,
+43632,
+46934,
+50194,
+53117,
+55680,
+57929,
+59969,
+61678,
+63663,
+65381,
+65534,
+65506,
+65534,
+65514,
+65534,
+65521,
+65534,
+65527,
+65534,
+65502,
+64727,
+63436,
+61922,
+60037,
+57839,
+55135,
+52442,
+50086,
+47958,
+45818,
+43253,
+40924,
+38828,
+36608,
+34391,
+32301,
+30675,
+29423,
+28382,
+27288,
+26356,
+25338,
+23630,
+22108,
+21037,
+20113,
+19379,
+18901,
+19153,
+20009,
+20862,
+21536,
+22203,
+22402,
+22183,
+22120,
+22101,
+22874,
+24261,
+25614,
+27739,
+30232,
+32456,
+34597,
+36325,
+37536,
+38656,
+39541,
+40427,
+41825,
+43204,
+44456,
+45971,
+47384,
+48749,
+50011,
+50495,
+50682,
+50750,
+50292,
+49517,
+48609,
+47511,
+46561,
+45720,
+44886,
+44168,
+43073,
+41680,
+40228,
+38727,
+37149,
+35057,
+32451,
+29860,
+27285,
+25054,
+23492,
+22147,
+21024,
+19931,
+18607,
+17698,
+16869,
+15639,
+14715,
+13621,
+12544,
+12138,
+11700,
+11413,
+11091,
+10001,
+8962,
+8260,
+7526,
+7528,
+7859,
+7902,
+7862,
+7266,
+6697,
+6619,
+6539,
+6787,
+7279,
+7485,
+7491,
+7312,
+7206,
+7133,
+6946,
+7603,
+9735,
+12975,
+16235,
+18432,
+19366,
+19515,
+19352,
+20076,
+22155,
+24579,
+27147,
+29761,
+32879,
+36544,
+39828,
+42615,
+45332,
+47877,
+50294,
+52611,
+54792,
+56722,
+58151,
+59684,
+61656,
+64160,
+65534,
+65522,
+65527,
+65534,
+65502,
+65534,
+65357,
+64256,
+63207,
+62293,
+61508,
+60493,
+58562,
+56160,
+53735,
+51888,
+50513,
+48945,
+47197,
+45119,
+42724,
+40366,
+38274,
+36475,
+34750,
+33205,
+31804,
+30957,
+30388,
+29527,
+28695,
+27918,
+27336,
+26984,
+26824,
+26620,
+26623,
+26853,
+27154,
+28355,
+29692,
+30502,
+31010,
 30841,
-30706,
-30868,
-30730,
-30922,
-30890,
-30973,
-30944,
-31051,
-31024,
-31236,
-31129,
-31342,
-31182,
-31367,
-31343,
-31497,
-31475,
-31552,
-31630,
-31582,
-31787,
-31739,
-31947,
-31950,
-31921,
-32081,
-31975,
-32186,
-32107,
-32265,
-32265,
-32372,
-32397,
-32530,
-32528,
-32583,
-32609,
-32608,
-32636,
-32714,
-32739,
-32823,
-32791,
-32927,
-32873,
-33056,
-33033,
-33003,
-33060,
-33082,
-33138,
-33268,
-33321,
-33324,
-33346,
-33323,
-33400,
-33506,
-33456,
-33662,
-33483,
-33715,
-33562,
-33769,
-33746,
-33820,
-33827,
-33821,
-33772,
-33903,
-33822,
-33956,
-33877,
-33927,
-33906,
-33926,
-33957,
-34008,
-33955,
-34062,
-33955,
-34166,
-33878,
-34192,
-33850,
-34061,
-33903,
-33982,
-33902,
-34036,
-34059,
+30697,
+31107,
+31569,
+32243,
+33247,
 34063,
-34166,
-34061,
-34193,
-33956,
-34218,
-33985,
-34110,
-34118,
-34111,
-34167,
+35031,
+36558,
+37894,
+38750,
+38921,
+38312,
+38069,
+38577,
+39253,
+40056,
+40688,
+40713,
+40795,
+41253,
+41773,
+42283,
+42028,
+40796,
+39710,
+38868,
+38120,
+37532,
+36634,
+35538,
+34542,
+33575,
+32743,
+31912,
+30424,
+28433,
+26593,
+25003,
+23568,
+22179,
+20541,
+18835,
+17301,
+15843,
+14937,
+14513,
+13891,
+13452,
+13395,
+13672,
+14448,
+14823,
+14310,
+13561,
+12480,
+11708,
+12010,
+12403,
+12754,
+12878,
+12587,
+12662,
+12922,
+12969,
+12868,
+12322,
+11543,
+11130,
+11205,
+11813,
+12569,
+12926,
+12734,
+12136,
+11678,
+12133,
+13515,
+15535,
+17627,
+19321,
+20774,
+22089,
+23458,
+25056,
+26653,
+28144,
+30045,
+32462,
+35421,
+38528,
+41448,
+44245,
+47049,
+49955,
+52619,
+54967,
+56836,
+58248,
+59698,
+61366,
+62873,
+64055,
+64745,
+65204,
+65534,
+65438,
+64543,
+63031,
+61298,
+59729,
+58649,
+57498,
+56108,
+54398,
+52138,
+49829,
+47556,
+45272,
+43213,
+41482,
+40155,
+39135,
+38172,
+36968,
+35617,
+34163,
+32596,
+31371,
+30723,
+30660,
+30998,
+31332,
+31282,
+31190,
+31314,
+31711,
+32569,
+33344,
+33809,
+34324,
+34891,
+35611,
+36629,
+37239,
+37603,
+38025,
+38334,
+39047,
+39795,
+40201,
+40525,
+40570,
+40481,
+40749,
+40901,
+40980,
+41109,
+40836,
+40640,
+40174,
+39292,
+38584,
+37980,
+37725,
+37887,
+37666,
+36948,
+35976,
+34497,
+33392,
+32473,
+31243,
+30123,
+28840,
+27864,
+27399,
+26657,
+25541,
+24172,
+22297,
+20853,
+19955,
+19339,
+19177,
+18579,
+17581,
+16621,
+15692,
+15171,
+15174,
+15263,
+15710,
+16258,
+16642,
+17035,
+16912,
+16233,
+15427,
+14832,
+14807,
+15462,
+16079,
+16454,
+16426,
+15889,
+15318,
+14800,
+14326,
+13980,
+13714,
+13494,
+13687,
+14099,
+14484,
+14550,
+13948,
+13032,
+12361,
+12341,
+13193,
+14671,
+16057,
+17184,
+17978,
+18739,
+19844,
+21172,
+22552,
+23904,
+25337,
+27079,
+29362,
+31919,
+34639,
+37343,
+39946,
+42545,
+44942,
+47016,
+48845,
+50614,
+52573,
+54739,
+56686,
+58233,
+59253,
+59898,
+60359,
+60527,
+60428,
+60129,
+59772,
+59398,
+59020,
+58499,
+57749,
+56715,
+55339,
+53716,
+52074,
+50675,
+49537,
+48663,
+47795,
+46650,
+45236,
+43656,
+42168,
+40898,
+39759,
+38775,
+38031,
+37487,
+36985,
+36327,
+35544,
+34924,
+34701,
+34881,
+35176,
+35182,
+34901,
+34586,
+34501,
+34835,
+35368,
+35995,
+36603,
+37284,
+38156,
+38952,
+39463,
+39610,
+39649,
+39872,
+40425,
+41175,
+41959,
+42402,
+42511,
+42432,
+42194,
+41892,
+41407,
+40814,
+40273,
+39870,
+39315,
+38473,
+37255,
+35888,
+34607,
+33391,
+32152,
+30651,
+28897,
+27138,
+25764,
+24672,
+23624,
+22343,
+20825,
+19321,
+18086,
+17191,
+16397,
+15527,
+14494,
+13605,
+13128,
+13111,
+13391,
+13632,
+13641,
+13699,
+13994,
+14497,
+14985,
+15003,
+14677,
+14559,
+15054,
+16274,
+17741,
+18582,
+18733,
+18495,
+18308,
+18579,
+19016,
+19288,
+19446,
+19691,
+20369,
+21547,
+22473,
+22751,
+22242,
+21291,
+20687,
+20737,
+21381,
+22365,
+23265,
+23996,
+24802,
+25432,
+25999,
+26346,
+26490,
+26815,
+27414,
+28352,
+29665,
+31164,
+32769,
+34675,
+36514,
+38279,
+39627,
+40401,
+41084,
+41995,
+43356,
+45274,
+47278,
+49025,
+50429,
+51295,
+51784,
+51896,
+51608,
+51172,
+50872,
+50920,
+51449,
+51870,
+51930,
+51362,
+50175,
+48773,
+47299,
+45956,
+44852,
+43842,
+42955,
+42308,
+41589,
+40694,
+39452,
+38128,
+37024,
+36196,
+35514,
+34895,
+34266,
+33981,
+34169,
+34678,
+35284,
+35458,
+35245,
+34941,
+35042,
+35611,
+36475,
+37252,
+37992,
+38707,
+39494,
+40286,
+40750,
+40907,
+40864,
+41061,
+41678,
+42621,
+43420,
+43794,
+43595,
+43181,
+42849,
+42582,
+42399,
+42128,
+41762,
+41366,
+40977,
+40472,
+39758,
+38641,
+37363,
+36092,
+34979,
+34011,
+32981,
+31904,
+30672,
+29490,
+28320,
+27269,
+26222,
+25151,
+24072,
+22955,
+21890,
+20796,
+19966,
+19300,
+18913,
+18712,
+18572,
+18515,
+18444,
+18239,
+17817,
+17178,
+16437,
+16150,
+16431,
+17358,
+18352,
+18802,
+18696,
+18225,
+17911,
+18017,
+18375,
+18456,
+18300,
+18049,
+18255,
+19091,
+20047,
+20610,
+20380,
+19599,
+18822,
+18551,
+18826,
+19533,
+20161,
+20783,
+21330,
+21799,
+22206,
+22339,
+22321,
+22329,
+22717,
+23447,
+24546,
+25832,
+27260,
+28730,
+30272,
+31693,
+32771,
+33536,
 34169,
-34110,
-34066,
-34005,
-34088,
-33825,
-33979,
-33827,
-33820,
-33800,
-33715,
-33694,
-33795,
-33639,
-33771,
-33690,
-33694,
-33794,
-33614,
-33770,
-33744,
-33825,
-33847,
-33853,
-33847,
-33799,
-33823,
-33850,
-33770,
-33851,
+35062,
+36343,
+38009,
+39735,
+41485,
+43259,
+44813,
+46016,
+46828,
+47005,
+46799,
+46593,
+46815,
+47589,
+48432,
+49051,
+49341,
+49178,
+48660,
+47828,
+46736,
+45642,
+44466,
+43549,
+43040,
+42776,
+42389,
+41779,
+40979,
+40166,
+39367,
+38493,
+37780,
+37086,
+36609,
+36403,
+36668,
+37131,
+37596,
+37940,
+38053,
+38140,
+38173,
+38392,
+38863,
+39565,
+40361,
+41306,
+42105,
+42708,
+43033,
+43201,
+43393,
+43609,
+44059,
+44559,
+44932,
+44981,
+44874,
+44617,
+44215,
+43675,
+43029,
+42463,
+41942,
+41324,
+40718,
+39944,
+38771,
+37456,
+35970,
+34508,
+33146,
+31734,
+30501,
+29411,
+28200,
+27099,
+26028,
+24941,
+23874,
+22632,
+21450,
+20316,
+19217,
+18458,
+17969,
+17669,
+17686,
+17696,
+17769,
+17810,
+17545,
+17357,
+17339,
+17186,
+17059,
+17144,
+17545,
+18428,
+19423,
+20524,
+21095,
+20922,
+20460,
+20077,
+20221,
+20799,
+21376,
+22072,
+22988,
+23655,
+24323,
+24604,
+24468,
+23892,
+23325,
+23579,
+24488,
+25621,
+26572,
+27217,
+27805,
+28533,
+28986,
+29451,
+29437,
+29220,
+29310,
+29945,
+31391,
+32587,
+33353,
+34165,
+34937,
+35798,
+36684,
+36953,
+37046,
+36884,
+37021,
+38121,
+39417,
+40602,
+41362,
+41758,
+42164,
+42243,
+42027,
+41985,
+41682,
+41559,
+41688,
+42002,
+42549,
+42602,
+42440,
+42216,
+41901,
+41423,
+40868,
+40309,
+39799,
+39097,
+38809,
+38926,
+39054,
+39361,
+39037,
+38868,
+38564,
+37977,
+37883,
+37881,
+37871,
+38185,
+38507,
+38974,
+39666,
+39738,
+40131,
+40533,
+40862,
+41339,
+41437,
+41634,
+41842,
+41936,
+42384,
+42834,
+42885,
+43126,
+43178,
+43160,
+43133,
+42606,
+41928,
+41362,
+40651,
+39934,
+39477,
+38951,
+38324,
+37654,
+36818,
+35907,
+34871,
+33848,
+32875,
+31831,
+30854,
+29707,
+28663,
+27991,
+27375,
+26662,
+26208,
+25586,
+24796,
+24212,
+23484,
+22860,
+22345,
+21764,
+21400,
+21507,
+21559,
+21644,
+21503,
+21159,
+20757,
+20053,
+19696,
+19467,
+19411,
+19742,
+19940,
+20143,
+20419,
+20161,
+19934,
+19829,
+19505,
+19347,
+19248,
+19575,
+20362,
+21146,
+21767,
+22111,
+22471,
+22974,
+23333,
+23732,
+24109,
+24186,
+24692,
+25992,
+27258,
+28435,
+29207,
+29526,
+30357,
+31437,
+32165,
+32624,
+32973,
+33310,
+33943,
+35167,
+36586,
+37321,
+37795,
+38117,
+38220,
+38681,
+38867,
+38671,
+38968,
+39393,
+39424,
+39767,
+40039,
+39899,
+39727,
+39516,
+39348,
+38993,
+38564,
+37995,
+37200,
+36718,
+36280,
+35764,
+35917,
+36038,
+35859,
+35822,
+35338,
+34729,
+34607,
+34473,
+34142,
+34470,
+35017,
+35402,
+36021,
+36486,
+37026,
+37437,
+37546,
+38049,
+38538,
+38865,
+39194,
+39736,
+40889,
+41725,
+42135,
+42997,
+43489,
+43606,
+43822,
+43640,
+43523,
+43305,
+43027,
+43214,
+43424,
+43336,
+42987,
+42439,
+41751,
+41007,
+40363,
+39962,
+39445,
+38904,
+38593,
+37976,
+37380,
+36769,
+35802,
+34746,
 33610,
-33642,
-33424,
-33403,
-33294,
-33322,
-33243,
-33400,
-33244,
-33373,
-33269,
-33243,
-33321,
-33165,
-33319,
-33246,
-33371,
-33298,
-33399,
-33323,
-33453,
-33401,
-33455,
-33478,
-33456,
-33425,
-33323,
-33427,
-33243,
-33347,
-33244,
-33268,
-33189,
-33323,
-33161,
-33298,
-33293,
-33245,
-33345,
-33351,
-33372,
-33376,
-33348,
-33321,
-33375,
-33374,
-33401,
-33559,
-33508,
-33583,
-33536,
-33503,
-33615,
-33664,
-33744,
-33798,
-33795,
-33747,
-33715,
-33773,
-33743,
-33930,
-33901,
-33958,
-33978,
-33907,
-34005,
-34037,
-34033,
-34115,
-34140,
-34140,
-34220,
-34272,
-34272,
-34460,
-34427,
-34565,
-34615,
-34563,
-34801,
-34615,
-34854,
-34799,
-34855,
-34959,
-34905,
-35014,
-35009,
-35066,
-35065,
-35143,
-35118,
-35250,
-35247,
-35279,
-35379,
-35357,
-35434,
-35432,
-35491,
-35536,
-35676,
-35642,
-35806,
-35724,
-35831,
-35856,
-35910,
-35962,
+32763,
+32236,
+31747,
+31239,
+30486,
+29711,
+28813,
+27787,
+26911,
+25672,
+24670,
+24072,
+23644,
+23835,
+23894,
+23624,
+23226,
+22386,
+21424,
+20576,
+19584,
+19046,
+19142,
+19522,
+20198,
+20509,
+20550,
+20127,
+19323,
+18706,
+18189,
+18057,
+18876,
+20044,
+21478,
+23437,
+24286,
+24496,
+24392,
+23788,
+23720,
+24306,
+24935,
+26371,
+28537,
+29746,
+30407,
+30559,
+29929,
+28865,
+28236,
+28413,
+29373,
+31114,
+32626,
+34045,
+35271,
+35297,
+34065,
+33257,
+33195,
+32932,
+33733,
+35192,
+36364,
+37814,
+38384,
+38209,
+38118,
+37497,
+36664,
+36848,
+37947,
+38798,
+39554,
+40718,
+41555,
+41827,
+41976,
+41615,
+40965,
+40661,
+40262,
+40603,
+41933,
+42607,
+43280,
+43852,
+43666,
+43154,
+42264,
+41499,
+40873,
+40837,
+41568,
+42193,
+42965,
+43129,
+42310,
+41304,
+40255,
+39023,
+38054,
+37789,
+37649,
+37730,
+37936,
+37411,
+36551,
+35961,
+34806,
+33938,
+33803,
+33231,
+32891,
+33174,
+33251,
+33077,
+33127,
+32455,
+31807,
+31928,
+31343,
+31316,
+31671,
+31564,
+31665,
+31978,
+32419,
+32283,
+32202,
+32003,
+31555,
+31870,
+31967,
+32115,
+32561,
+32313,
+31989,
+31736,
+31196,
+30445,
+29784,
+29203,
+28977,
+29009,
+29040,
+29179,
+28896,
+28465,
+28209,
+27725,
+27434,
+27482,
+27450,
+27502,
+27619,
+27212,
+26808,
+26400,
+25447,
+24991,
+25224,
+25350,
+25541,
+25722,
+25445,
+24872,
+24239,
+23455,
+23456,
+24349,
+24287,
+25392,
+27335,
+27308,
+27449,
+26532,
+25555,
+25725,
+25109,
+26049,
+27608,
+29300,
+30839,
+31347,
+32129,
+31040,
+29485,
+29121,
+29287,
+31045,
+32719,
+33987,
+35827,
+37703,
+37868,
+36517,
+35960,
+34372,
+34110,
+35513,
+36478,
+39275,
+39909,
+38747,
+38662,
+37845,
 36016,
-36068,
-36120,
-36122,
-36225,
-36149,
-36252,
+34016,
+33561,
+34172,
+35279,
+36832,
+37730,
+38527,
+38217,
+36193,
+35158,
+35001,
+33774,
+33375,
+34862,
+36080,
+37578,
+38602,
+38216,
+38585,
+38173,
+36304,
+36058,
+36348,
+36208,
+37040,
+38417,
+39921,
+40793,
+40571,
+39598,
+38594,
+37476,
+35857,
+35873,
+37075,
+37793,
+39251,
+40293,
+40414,
+39637,
+38248,
+36784,
+35382,
+35324,
+35407,
 36174,
-36280,
-36278,
-36280,
-36306,
-36306,
-36331,
-36334,
-36488,
-36388,
-36488,
-36360,
-36437,
-36306,
-36570,
-36332,
-36648,
-36440,
-36514,
-36467,
-36462,
-36466,
-36568,
-36466,
-36542,
-36465,
-36490,
-36464,
-36412,
-36464,
-36253,
-36411,
-36148,
-36331,
-36175,
-36252,
-36095,
-36122,
-36039,
-35965,
-35961,
-35778,
-35804,
-35672,
-35698,
-35594,
-35591,
-35436,
-35405,
-35305,
-35302,
-35222,
-35251,
-35141,
-35093,
-34959,
-34932,
-34827,
-34722,
-34720,
-34458,
-34484,
-34245,
-34247,
-34140,
-34033,
-34012,
-33740,
-33669,
-33477,
-33323,
-33296,
-33135,
-33112,
-32977,
-32848,
-32819,
-32609,
-32608,
-32504,
-32265,
-32318,
-31976,
-32079,
-31897,
-31816,
-31684,
-31527,
-31314,
-31236,
-31024,
-30944,
-30815,
-30626,
-30552,
-30308,
-30181,
-30072,
-29810,
-29863,
-29546,
-29597,
-29414,
-29359,
-29257,
-29122,
-28991,
-28754,
-28752,
-28489,
-28543,
-28382,
-28332,
-28146,
-28092,
-27961,
-27803,
-27802,
-27539,
-27539,
-27272,
-27225,
-27086,
-27040,
-26928,
-26880,
-26720,
-26639,
-26616,
-26508,
-26481,
-26326,
-26295,
-26193,
-26217,
-26167,
-26137,
-25982,
-25927,
-25769,
-25796,
-25794,
-25824,
-25768,
-25744,
-25503,
-25480,
-25425,
-25321,
-25426,
-25266,
-25347,
-25137,
-25238,
-25165,
-25290,
-25270,
-25319,
-25163,
-25318,
-25111,
+37562,
+37727,
+37772,
+36868,
+34840,
+33474,
+32219,
+31019,
+31046,
+31911,
+32490,
+33049,
+32944,
+32157,
+31101,
+29057,
+27429,
+26796,
+26275,
+26555,
+27246,
+27852,
+28308,
+27623,
+26788,
+26108,
+24992,
+24482,
+24429,
+25127,
+26234,
+26977,
+27687,
+27666,
+27087,
+26068,
 25370,
-25271,
-25475,
-25403,
-25502,
-25402,
-25529,
-25480,
-25637,
-25558,
-25716,
-25584,
-25823,
-25715,
-25902,
-25875,
-25899,
-25958,
-25924,
-26167,
-26111,
-26351,
-26377,
-26482,
-26534,
-26642,
-26638,
-26881,
-26824,
-27170,
-27009,
-27355,
-27273,
-27539,
-27591,
-27777,
-27854,
-28016,
-28143,
-28200,
-28463,
-28515,
-28674,
-28886,
-28883,
-29099,
-29122,
-29202,
-29361,
-29466,
-29625,
-29782,
-29916,
-30020,
-30206,
-30233,
-30414,
-30578,
-30706,
-30893,
-31076,
-31131,
-31497,
-31477,
-31813,
-31846,
-32025,
-32161,
+25548,
+25500,
+26018,
+26785,
+27049,
+27531,
+27050,
+26367,
+26174,
+25286,
+24981,
+25697,
+26232,
+26846,
+27908,
+28739,
+29056,
+28962,
+28472,
+28334,
+28711,
+28819,
+29173,
+30770,
+31514,
+31704,
+33439,
+33490,
+32791,
+33037,
+32598,
+33436,
+34142,
+34007,
+35279,
+36822,
+36650,
+36285,
+37395,
+36805,
+36592,
+38257,
+38401,
+38892,
+38652,
+37154,
+37690,
+37953,
+36616,
+36575,
+37510,
+37271,
+37779,
+38843,
+38049,
+37337,
+36184,
+34400,
+34873,
+35786,
+35895,
+37106,
+38776,
+38864,
+38540,
+38099,
+36238,
+35416,
+34822,
+33946,
+35611,
+36845,
+36651,
+37429,
+37628,
+36809,
+35709,
+34568,
+34280,
+34226,
+34270,
+34830,
+36029,
+36860,
+36164,
+36042,
+35774,
+34553,
+33942,
+34004,
+34665,
+34746,
+34941,
+35458,
+35838,
+35657,
+34647,
+34422,
+33932,
+33298,
+33297,
+33711,
+34599,
+34818,
+34942,
+35145,
+34642,
+33624,
+32741,
+31816,
+31100,
+30949,
+30871,
+31799,
+32569,
+32351,
+32031,
+31456,
+30329,
+28868,
+28219,
+27968,
+28520,
+29377,
+29508,
+30303,
+30218,
+29104,
+28528,
+27673,
+26788,
+26392,
+26608,
+27400,
+27684,
+27427,
+27364,
+26993,
+26572,
+26151,
+25873,
+26243,
+26125,
+26153,
+26958,
+27724,
+28085,
+28558,
+28984,
+28551,
+28291,
+28053,
+28383,
+29142,
+28993,
+29350,
+30366,
+31127,
+31108,
+31168,
+31270,
+30781,
+30736,
+31335,
+32435,
+32650,
+32394,
+32645,
+33394,
+33847,
+33668,
+34954,
+36107,
+36280,
+35989,
+35681,
+35720,
+34554,
+34550,
+35435,
+36064,
+36890,
+37474,
+38793,
+38697,
+36839,
+34795,
+33928,
+33948,
+34193,
+36512,
+38542,
+39622,
+39586,
+38474,
+37424,
+34434,
+32280,
+31819,
 32318,
-32396,
-32691,
-32685,
-32981,
-32923,
+34103,
+35350,
+36829,
+37241,
+35319,
+33291,
+32114,
+30803,
+30069,
+30884,
+32411,
+33809,
+34237,
+34294,
+33774,
+32321,
+30740,
+30355,
+30981,
+30829,
+31428,
+32695,
+33457,
+33506,
+32932,
+32811,
+32222,
+31519,
+31669,
+32562,
+33402,
+33619,
+34506,
+35391,
+35622,
+35617,
+35305,
+34980,
+34086,
+33235,
+33459,
+34429,
+35757,
+37033,
+38209,
+38803,
+38643,
+38231,
+37069,
+35902,
+34963,
+34175,
+34693,
+35754,
+37050,
+38467,
+38778,
+38469,
+37730,
+36153,
+34659,
+33782,
+33525,
+33849,
+34457,
+35058,
+35384,
+35109,
+34003,
+33139,
+32652,
+31766,
+31279,
+31022,
+31221,
+31675,
+31684,
+31616,
+30769,
+29490,
+28431,
+27956,
+28053,
+27786,
+27498,
+27647,
+27776,
+27510,
+26986,
+26379,
+25476,
+24794,
+24727,
+24761,
+25014,
+25158,
+25175,
+25468,
+25282,
+24612,
+24133,
+23983,
+23726,
+24276,
+25545,
+26106,
+27164,
+27946,
+27757,
+27686,
+26904,
+26121,
+26256,
+27002,
+28012,
+29786,
+31661,
+32376,
+33309,
+33253,
+32188,
+31814,
+31422,
+31865,
+32933,
+34324,
+35839,
+36980,
+38088,
+38142,
+37768,
+37078,
+35804,
+35827,
+36606,
+37250,
+38853,
+40412,
+41096,
+41673,
+41224,
+40054,
+39111,
+37541,
+36910,
+38044,
+38933,
+40319,
+41909,
+42334,
+41930,
+40556,
+38772,
+37405,
+36599,
+35616,
+36005,
+37342,
+37613,
+38344,
+38478,
+37785,
+36668,
+35156,
+34183,
+33527,
+33370,
+33031,
+33654,
+34160,
+32978,
+32380,
+32075,
+31537,
+31070,
+30637,
+30841,
+31183,
+31297,
+31529,
+31463,
+31021,
+29916,
+29781,
+31005,
+30735,
+30383,
+30556,
+30742,
+31338,
+31456,
+31840,
+32256,
+31787,
+31224,
+31841,
+32569,
+32458,
+32420,
+32758,
+33190,
+33072,
+32962,
+32986,
+32725,
+31869,
+31226,
+31935,
+32662,
+33027,
+33508,
+33959,
+33850,
+33200,
+32380,
+31858,
+31658,
+30712,
+30489,
+31149,
+31359,
+31904,
+32265,
+32132,
+31857,
+31125,
+30316,
+30078,
+29823,
+29291,
+29724,
+30331,
+30513,
+31093,
+31072,
+30676,
+30632,
+30184,
+29661,
+29559,
+29709,
+30009,
+30467,
+30687,
+30504,
+30403,
+30183,
+30149,
+30739,
+31150,
+31213,
+31608,
+31899,
+31665,
+31422,
+31148,
+31079,
+31391,
+31866,
+32577,
+33221,
+33705,
+33847,
+33582,
+33420,
+32829,
+32275,
+32701,
+32887,
+33441,
+34383,
+34363,
+34982,
+35426,
+35071,
+34847,
+34179,
+33876,
+33486,
+33524,
+34128,
+34416,
+35279,
+35660,
+36221,
+36850,
+35837,
+34921,
+34560,
+33976,
+33786,
+34240,
+34955,
+35838,
+36405,
+36626,
+36778,
+36261,
+34975,
+33856,
+33433,
+32730,
+32637,
+33241,
+33741,
+34822,
+35050,
+34966,
+34683,
+33474,
+32376,
+31394,
+31127,
+31127,
+31555,
+32228,
+33003,
+33728,
+33024,
+32492,
+31856,
+30963,
+30732,
+30544,
+31109,
+31731,
+32138,
+32613,
+32868,
+32727,
+32063,
+31744,
+31316,
+31016,
+31301,
+31805,
+32401,
+32558,
+32504,
+32333,
+32003,
+31194,
+30396,
+30295,
+30278,
+30851,
+31959,
+32704,
+32975,
+32710,
+32268,
+31682,
+30671,
+29994,
+30042,
+30450,
+31256,
+32314,
+33237,
+33201,
+32394,
+31695,
+30997,
+30228,
+29932,
+30526,
+31304,
+32193,
+33108,
+33737,
+33712,
+32744,
+31942,
+31325,
+31072,
+31090,
+31481,
+32794,
+33660,
+34234,
+34325,
+33460,
+32607,
+31961,
+31564,
+31926,
+32681,
+33272,
+34417,
+34837,
+34506,
+34240,
+33125,
+32538,
+32429,
+32666,
+33544,
+34220,
+35040,
+35537,
+35359,
+34555,
+33699,
+33094,
+32662,
+32927,
+33420,
+34354,
+34954,
+34929,
+35171,
+34625,
+33894,
 33244,
-33189,
-33454,
-33507,
-33638,
-33824,
-33955,
-33982,
-34273,
-34297,
-34486,
-34614,
-34643,
-34774,
-34931,
-34961,
-35275,
-35276,
-35514,
-35538,
-35674,
-35777,
-35909,
-36043,
-36225,
-36280,
-36332,
-36439,
-36541,
-36679,
-36804,
-36888,
-36967,
-36911,
-37047,
-37018,
-37177,
-37257,
-37229,
-37390,
-37281,
-37390,
-37414,
-37468,
-37494,
-37547,
-37521,
-37678,
-37654,
-37835,
-37814,
-37887,
-37867,
-37861,
-37892,
-37970,
-38046,
-38078,
-38178,
-38050,
-38128,
-37995,
-38130,
-38045,
-38158,
-38045,
-37999,
-37915,
-37917,
-37784,
-37996,
-37680,
-37941,
-37682,
-37675,
-37736,
-37543,
-37735,
-37518,
-37681,
-37573,
-37598,
-37629,
-37412,
-37601,
-37284,
-37465,
-37286,
-37412,
-37338,
-37333,
-37286,
-37121,
-37048,
-36990,
-36862,
-36912,
-36755,
-36728,
-36543,
-36598,
-36304,
-36439,
-36226,
-36200,
-36174,
-36122,
-36092,
-36098,
-35985,
-35939,
-36013,
-35965,
-35986,
-36044,
-35829,
-35936,
-35673,
-35777,
-35619,
-35699,
-35592,
-35540,
-35356,
-35249,
-35090,
-35093,
-34983,
-34988,
-34824,
-34883,
-34718,
+32439,
+32536,
+32903,
+33428,
+34232,
+34666,
+34847,
+34948,
+34627,
+33983,
+33517,
+32903,
+32669,
+33086,
+33672,
+34372,
+34679,
+35097,
+35571,
+35299,
+34572,
+33835,
+33159,
+32605,
+32379,
+32339,
+32562,
+32972,
+33480,
+34164,
+34235,
+33605,
+32920,
+32204,
+31497,
+31161,
+31081,
+31003,
+31543,
+32339,
+32480,
+32289,
+31926,
+31362,
+30997,
+30730,
+30597,
+31110,
+31452,
+31388,
+31858,
+31775,
+31127,
+31078,
+30811,
+30637,
+30837,
+30911,
+31316,
+31907,
+31809,
+31321,
+31251,
+30746,
+30242,
+30036,
+29673,
+29970,
+30495,
+31017,
+31753,
+32347,
+31976,
+31372,
+31252,
+30505,
+29872,
+29727,
+29950,
+30720,
+31737,
+32584,
+32920,
+32838,
+31735,
+31006,
+30678,
+29744,
+30144,
+31128,
+31969,
+33234,
+33971,
+34030,
+33458,
+32536,
+31514,
+31221,
+31442,
+31510,
+32830,
+34102,
 34804,
-34719,
-34748,
-34696,
-34613,
-34592,
-34562,
-34721,
-34669,
-34773,
-34643,
-34562,
-34563,
-34405,
+35506,
+34864,
+34014,
+33242,
+32577,
+32723,
+33305,
+34317,
+35115,
+36053,
+36601,
+36316,
+35747,
+34647,
+33962,
+34016,
+34466,
+35156,
+36155,
+37009,
+37301,
+37281,
+36517,
+35770,
+35135,
 34536,
-34458,
-34562,
-34273,
-34482,
-34037,
-34322,
-34145,
-34136,
-34170,
-34005,
-33985,
-33952,
-33960,
-33978,
-34011,
-34006,
-33983,
-34061,
-33877,
-34087,
-33902,
-34088,
-34088,
-34034,
-34167,
-34088,
-34192,
-34169,
-34165,
-34166,
-34169,
-34059,
-34274,
-34087,
-34219,
-34115,
-34113,
-34062,
-34060,
-33982,
-33983,
-33981,
-34036,
-34059,
-34115,
-34113,
-34009,
+34721,
+35362,
+36129,
+36611,
+37043,
+37243,
+36836,
+36137,
+35460,
+35125,
+34927,
+34882,
+35089,
+35715,
+36039,
+36109,
+36329,
+36104,
+35877,
+35412,
+35029,
+34915,
+34575,
+34548,
+34926,
+35320,
+35521,
+35637,
+35293,
+34898,
+34338,
+33396,
+33069,
+32574,
+32294,
+32909,
+33426,
+33852,
 34114,
-34008,
-34220,
-34218,
-34274,
-34324,
-34220,
-34380,
-34242,
-34435,
-34374,
-34407,
-34351,
-34351,
-34247,
-34350,
-34300,
-34325,
-34325,
-34193,
-34273,
-34112,
-34250,
-34189,
-34223,
-34269,
-34196,
-34350,
-34194,
-34431,
-34245,
-34326,
-34272,
-34192,
-34276,
-34215,
-34356,
-34241,
-34356,
-34164,
-34168,
-34140,
-34167,
-34086,
-34196,
-33978,
-34065,
-33927,
-33956,
-33849,
-33983,
-33822,
-33825,
-33796,
-33692,
-33691,
-33638,
-33588,
-33608,
-33512,
-33475,
-33405,
-33320,
-33268,
-33244,
-33215,
+33727,
+33217,
+32753,
+31921,
+31508,
+31177,
+30875,
+31331,
+31823,
+32023,
+31744,
+31204,
+30829,
+30419,
+29954,
+29726,
+29676,
+29866,
+30273,
+30346,
+30380,
+30039,
+29286,
+29166,
+29029,
+28669,
+28847,
+29035,
+29189,
+29617,
+29385,
+29018,
+28951,
+28238,
+27864,
+28064,
+27997,
+28218,
+28687,
+28907,
+29231,
+29354,
+28929,
+28669,
+28327,
+27895,
+28067,
+28466,
+28622,
+28875,
+29367,
+29722,
+30056,
+30013,
+29598,
+29580,
+29602,
+29582,
+29961,
+30154,
+30119,
+30565,
+31018,
+31267,
+31470,
+31340,
+31277,
+31491,
+31367,
+31351,
+31820,
+32097,
+32561,
 33138,
-33163,
-33004,
-33111,
-32978,
-32953,
-32819,
-32769,
-32738,
-32637,
-32660,
-32611,
-32501,
-32452,
-32369,
-32214,
-32212,
-32161,
-31973,
-32135,
-31788,
-31897,
-31633,
-31708,
-31502,
-31656,
-31369,
+33397,
+33484,
+33304,
+32997,
+32825,
+32838,
+32879,
+33421,
+34122,
+34604,
+35144,
+35413,
+35393,
+34934,
+34463,
+34371,
+34601,
+35009,
+35494,
+36232,
+36764,
+37033,
+37096,
+36826,
+36297,
+35798,
+35833,
+36261,
+36803,
+37251,
+37637,
+38178,
+38225,
+37754,
+37430,
+37021,
+36679,
+36863,
+37207,
+37574,
+38029,
+38143,
+38227,
+38280,
+37520,
+36871,
+36806,
+36480,
+36399,
+36634,
+36565,
+36679,
+36730,
+36222,
+36040,
+35800,
+35253,
+35404,
+35420,
+34971,
+34793,
+34622,
+34355,
+34286,
+33869,
+33356,
+33414,
+33165,
+32874,
+32796,
+32297,
+31881,
+31796,
+31682,
+31677,
+31688,
 31499,
-31183,
-31235,
-31130,
-31052,
-30995,
-30949,
-30782,
-30817,
-30679,
-30628,
-30550,
-30388,
-30367,
-30282,
-30314,
-30230,
-30233,
-30020,
-29994,
-29785,
-29807,
-29759,
-29702,
-29652,
-29545,
-29361,
-29307,
-29176,
-29202,
-29149,
-29098,
-29095,
-28886,
-28964,
-28806,
-28886,
-28832,
-28780,
-28805,
-28728,
-28752,
-28675,
+31686,
+31781,
+31457,
+31238,
+30840,
+30482,
+30384,
+30311,
+30287,
+30372,
+30362,
+30334,
+30387,
+30110,
+29814,
+29578,
+29237,
+29184,
+29236,
+29205,
+29293,
+29463,
+29473,
+29317,
+29073,
+28654,
+28418,
+28326,
+28145,
+28353,
+28610,
+28574,
 28647,
-28621,
-28463,
-28568,
-28410,
+28645,
+28379,
+28121,
+27870,
+27667,
+27876,
+28122,
+28386,
+28978,
+29049,
+28787,
+28700,
+28361,
+28188,
+28282,
+28190,
+28388,
+28958,
+29257,
+29673,
+29939,
+29616,
+29707,
+29836,
+29650,
+29967,
+30227,
+30221,
+30790,
+31209,
+31358,
+31756,
+31670,
+31799,
+32406,
+32416,
+32509,
+33105,
+33259,
+33400,
+33823,
+33784,
+33926,
+34090,
+33910,
+34476,
+34907,
+34888,
+35411,
+35864,
+35827,
+35749,
+35643,
+35442,
+35758,
+36076,
+36408,
+37128,
+37380,
+37357,
+37519,
+37333,
+36900,
+36852,
+36952,
+37357,
+37965,
+38298,
+38614,
+38921,
+38800,
+38612,
+38595,
+38272,
+38197,
+38478,
+38804,
+39204,
+39387,
+39346,
+39385,
+39267,
+38803,
+38477,
+38359,
+38245,
+38162,
+38014,
+37954,
+37908,
+37446,
+36982,
+36714,
+36467,
+36060,
+35670,
+35555,
+35434,
+35006,
+34569,
+34425,
+34292,
+33897,
+33344,
+33129,
+33068,
+32718,
+32166,
+31936,
+31767,
+31436,
+31233,
+31175,
+31260,
+31022,
+30554,
+30544,
+30629,
+30267,
+29944,
+29939,
+30121,
+30305,
+30148,
+30043,
+30208,
+29962,
+29557,
+29564,
+29532,
+29308,
+29233,
+29234,
+29369,
+29430,
+29007,
+28740,
+28698,
+28303,
+27996,
+27933,
+27883,
+27878,
+27868,
+27699,
+27559,
+27394,
+26837,
+26574,
+26602,
+26475,
+26567,
+26716,
+26666,
+26779,
+26720,
+26391,
+26239,
+26133,
+26044,
+26277,
+26620,
+26725,
+26929,
+26945,
+26876,
+27012,
+26909,
+26782,
+27019,
+27302,
+27592,
+28082,
+28278,
+28398,
+28722,
+28944,
+29239,
+29561,
+29691,
+30027,
+30698,
+31064,
+31440,
+31823,
+32145,
+32898,
+33549,
+34072,
+34639,
+35066,
+35344,
+35781,
+36250,
+36554,
+37025,
+37396,
+37999,
+38862,
+39291,
+39661,
+39975,
+40203,
+40584,
+40749,
+40670,
+40788,
+41238,
+41690,
+42210,
+42561,
+42620,
+42692,
+42499,
+42370,
+42438,
+42311,
+42032,
+42195,
+42521,
+42613,
+42390,
+41896,
+41748,
+41680,
+41409,
+41046,
+40964,
+40644,
+40211,
+39932,
+39571,
+39210,
+38575,
+38056,
+37782,
+37589,
+37001,
+36379,
+35896,
+35257,
+34698,
+34071,
+33489,
+32960,
+32419,
+32027,
+31771,
+31331,
+30657,
+30034,
+29552,
+29105,
+28693,
+28403,
+28024,
+27770,
+27581,
+27386,
+27120,
+26716,
+26390,
+26173,
+26054,
+25811,
+25863,
+25937,
+26034,
+26185,
+26290,
+26332,
+26171,
+25980,
+25868,
+26083,
+26231,
+26541,
+26993,
+27304,
+27407,
+27404,
+27345,
+27151,
+27059,
+27019,
+27363,
+27888,
+28266,
 28542,
-28463,
-28383,
-28279,
-28197,
-28095,
-28249,
-28122,
-28223,
-28200,
-28013,
-28146,
-27829,
-28119,
-27935,
-28093,
-28119,
-28067,
-28172,
+28741,
+28669,
+28318,
+28058,
+27860,
+27862,
+27988,
+28328,
+28807,
+29138,
+29164,
+28878,
+28657,
+28311,
 28145,
-28148,
-28143,
-28201,
-28170,
-28358,
-28305,
-28277,
-28358,
-28224,
-28278,
-28226,
-28303,
-28411,
+28248,
+28453,
+28827,
+29195,
+29609,
+29790,
+29728,
+29441,
+29203,
+29226,
+29387,
+29778,
+30286,
+30813,
+31150,
+31299,
+31268,
+31175,
+31231,
+31433,
+31894,
+32457,
+33061,
+33672,
+34220,
+34504,
+34511,
+34486,
+34532,
+34870,
+35403,
+36088,
+36803,
+37412,
+37941,
+38268,
+38414,
+38365,
+38344,
+38500,
+38868,
+39371,
+39951,
+40605,
+41115,
+41413,
+41421,
+41313,
+41111,
+40969,
+40928,
+41075,
+41490,
+41927,
+42385,
+42503,
+42343,
+41958,
+41412,
+40968,
+40628,
+40466,
+40436,
+40608,
+40765,
+40576,
+40076,
+39348,
+38786,
+38283,
+37890,
+37539,
+37244,
+37033,
+36632,
+36306,
+35808,
+35303,
+34592,
+34000,
+33561,
+33174,
+32861,
+32431,
+32098,
+31609,
+31227,
+30815,
+30437,
+30033,
+29636,
+29350,
+29093,
+28812,
+28446,
+28123,
+27881,
+27788,
+27714,
+27647,
+27493,
+27348,
+27201,
+27055,
+26883,
+26753,
+26750,
+26754,
+26851,
+26934,
+27073,
+27178,
+27211,
+27261,
+27251,
+27275,
+27203,
+27180,
+27274,
+27409,
+27611,
+27833,
+28087,
+28182,
+28218,
+28157,
+28006,
+27983,
+27928,
+28072,
 28330,
-28490,
-28329,
-28597,
-28406,
-28679,
-28537,
-28783,
-28698,
-28729,
-28857,
-28807,
-28964,
-28991,
-29044,
-29202,
-29280,
-29337,
-29489,
-29522,
-29544,
-29572,
-29757,
-29781,
-30024,
-29992,
-30127,
-29969,
-30150,
-30025,
-30307,
-30314,
-30468,
-30471,
-30602,
-30574,
-30735,
-30812,
-30866,
-30999,
-30970,
-31210,
+28678,
+28953,
+29122,
+29228,
+29175,
+29093,
+28901,
+28867,
+28800,
+28923,
+29190,
+29543,
+29918,
+29985,
+29947,
+29782,
+29642,
+29599,
+29656,
+29883,
+30215,
+30618,
+30954,
+31169,
+31273,
+31291,
 31235,
-31499,
-31528,
-31735,
-31739,
-31841,
-31923,
-32028,
-32107,
-32239,
-32238,
-32451,
-32318,
-32714,
-32478,
-32845,
-32610,
-32897,
-32770,
-33055,
-32954,
-33294,
-33111,
-33480,
-33323,
-33583,
+31234,
+31414,
+31799,
+32294,
+32745,
+33120,
+33327,
+33412,
 33456,
-33716,
-33561,
-33770,
-33797,
-33876,
-34061,
-34168,
+33568,
+33806,
+34173,
+34575,
+35091,
+35629,
+36072,
+36281,
+36293,
+36320,
+36368,
+36518,
+36831,
+37255,
+37647,
+37992,
+38278,
+38561,
+38720,
+38588,
+38365,
+38202,
+38256,
+38372,
+38518,
+38847,
+39145,
+39352,
+39297,
+39130,
+38793,
+38423,
+38051,
+37806,
+37778,
+37797,
+37959,
+38032,
+38128,
+37861,
+37318,
+36692,
+36100,
+35629,
+35247,
+35193,
+35183,
+35123,
+34806,
+34505,
+34233,
+33760,
+33221,
+32586,
+32268,
+31961,
+31688,
+31556,
+31604,
+31573,
+31189,
+30747,
+30354,
+30169,
+29817,
+29552,
+29439,
+29442,
+29512,
+29478,
+29509,
+29470,
+29327,
+29102,
+29011,
+28984,
+28987,
+29066,
+29263,
+29531,
+29684,
+29753,
+29765,
+29868,
+29963,
+30017,
+30149,
+30359,
+30492,
+30607,
+30804,
+31057,
+31339,
+31507,
+31614,
+31682,
+31761,
+31860,
+31941,
+32076,
+32282,
+32442,
+32590,
+32762,
+32892,
+32922,
+32956,
+32922,
+32889,
+32833,
+32775,
+32914,
+33164,
+33378,
+33350,
+33230,
+33191,
+33075,
+32944,
+32784,
+32741,
+32699,
+32712,
+32739,
+32798,
+32910,
+32788,
+32648,
+32415,
+32300,
+32101,
+31971,
+32051,
+32167,
+32332,
+32267,
+32271,
+32206,
+32157,
+32056,
+31902,
+31848,
+31796,
+31954,
+32124,
+32365,
+32421,
+32396,
+32380,
+32282,
+32272,
+32257,
+32462,
+32648,
+32866,
+33030,
+33050,
+33116,
+33180,
+33349,
+33411,
+33451,
+33463,
+33553,
+33793,
+33903,
+34075,
 34245,
-34404,
-34300,
-34535,
-34380,
-34667,
-34668,
-34802,
-34932,
-34853,
-34960,
-34879,
-34905,
-35068,
-34927,
-35151,
-35032,
-35121,
-35194,
-35225,
-35301,
-35436,
-35248,
-35355,
-35277,
-35353,
-35438,
-35457,
-35517,
-35509,
-35545,
-35535,
-35624,
-35721,
-35700,
-35725,
-35723,
-35675,
-35854,
-35779,
-35962,
-35857,
-35910,
-35645,
-35724,
-35541,
-35804,
-35593,
-35856,
-35541,
-35696,
-35386,
-35640,
-35387,
-35615,
-35384,
-35460,
-35249,
-35355,
-35304,
-35352,
-35358,
-35327,
-35303,
-35249,
-35223,
-35196,
-35145,
-35170,
-35012,
-35038,
+34418,
+34365,
+34280,
+34372,
+34439,
+34560,
+34613,
+34733,
+34790,
+34869,
+34935,
+34959,
+35022,
+34971,
+34998,
+34966,
+34929,
+34884,
 34984,
-34829,
-34878,
-34670,
-34695,
-34534,
-34565,
-34483,
-34482,
-34513,
-34376,
-34431,
-34299,
-34298,
-34194,
-34168,
-34138,
-34063,
-34059,
+35172,
+35160,
+35053,
+34903,
+34919,
+34812,
+34654,
+34549,
+34517,
+34489,
+34381,
+34373,
+34359,
+34320,
+34115,
+33944,
+33787,
+33583,
+33362,
+33204,
+33216,
+33160,
+33071,
+32918,
+32782,
+32542,
+32301,
+32090,
+31833,
+31653,
+31541,
+31577,
+31572,
+31447,
+31241,
+30972,
+30781,
+30583,
+30392,
+30332,
+30364,
+30350,
+30292,
+30202,
+30015,
+29913,
+29868,
+29847,
+29768,
+29614,
+29649,
+29773,
+29888,
+29939,
+29953,
+30010,
+29978,
+29929,
+29964,
+30143,
+30287,
+30429,
+30563,
+30691,
+30796,
+30853,
+30987,
+31144,
+31284,
+31441,
+31598,
+31804,
+31986,
+32100,
+32294,
+32489,
+32604,
+32690,
+32843,
+32986,
+33055,
+33237,
+33346,
+33457,
+33593,
+33712,
+33817,
+33846,
+33908,
+33934,
+33996,
+34043,
+33995,
+33943,
+34049,
+34124,
+34071,
+34112,
+34148,
+34032,
+33903,
+33773,
+33715,
+33720,
+33706,
+33812,
+33839,
+33823,
+33694,
+33371,
+33301,
+33317,
+33247,
+33292,
+33357,
+33432,
+33450,
+33347,
+33267,
+33243,
+33265,
+33361,
+33344,
+33390,
+33535,
+33551,
+33741,
+33758,
+33796,
+33954,
+33979,
+34100,
+34205,
+34397,
+34597,
+34728,
+34872,
+34988,
+35082,
+35208,
+35346,
+35446,
+35626,
+35784,
+35901,
+36076,
+36168,
+36236,
+36279,
+36342,
+36434,
+36397,
+36476,
+36498,
+36481,
+36515,
+36456,
+36352,
+36240,
+36156,
+35975,
+35770,
+35614,
+35390,
+35252,
+35076,
+34835,
+34530,
+34224,
+33940,
+33489,
+33161,
+32883,
+32569,
+32219,
+31912,
+31521,
+31056,
+30658,
+30188,
+29750,
+29455,
+29110,
+28688,
+28391,
+28080,
+27722,
+27339,
+27010,
+26760,
+26512,
+26285,
+26168,
+25894,
+25803,
+25683,
+25411,
+25312,
+25207,
+25267,
+25231,
+25334,
+25465,
+25521,
+25649,
+25793,
+25906,
+26080,
+26395,
+26616,
+26918,
+27251,
+27614,
+28006,
+28394,
+28834,
+29131,
+29477,
+29913,
+30281,
+30715,
+31223,
+31731,
+32161,
+32609,
+33023,
+33400,
+33788,
+34211,
+34574,
+34901,
+35333,
+35670,
+36056,
+36356,
+36677,
+36933,
+37073,
+37277,
+37385,
+37484,
+37638,
+37836,
+37874,
+38040,
+38105,
+38078,
+38060,
+37891,
+37830,
+37710,
+37614,
+37620,
+37515,
+37377,
+37357,
+37159,
+36901,
+36709,
+36410,
+36215,
+36093,
+35978,
+35999,
+35835,
+35690,
+35499,
+35143,
+34931,
+34796,
+34712,
+34605,
+34704,
+34589,
+34485,
+34402,
+34197,
+34107,
 33958,
-33901,
-33877,
-33743,
+33997,
+33996,
+33997,
+34096,
+34155,
+34164,
+34152,
+34154,
+34019,
+34004,
+34084,
+34067,
+34221,
+34297,
+34367,
+34363,
+34309,
+34289,
+34196,
+34217,
+34284,
+34310,
+34240,
+34291,
+34224,
+34135,
+34068,
+33927,
+33870,
 33719,
-33638,
-33586,
-33559,
-33427,
-33401,
-33323,
-33240,
-33271,
-33189,
-33216,
-33084,
-33031,
-32951,
-32849,
-32896,
-32876,
-32764,
+33610,
+33468,
+33279,
+33158,
+33050,
+32844,
+32676,
+32526,
+32262,
+32068,
+31807,
+31588,
+31389,
+31122,
+30919,
+30704,
+30419,
+30295,
+30061,
+29793,
+29630,
+29294,
+29138,
+28980,
+28829,
+28793,
+28685,
+28533,
+28489,
+28282,
+28161,
+28163,
+27986,
+28055,
+28145,
+28147,
+28291,
+28291,
+28269,
+28386,
+28478,
+28630,
+28776,
+28908,
+29186,
+29443,
+29622,
+29952,
+30062,
+30223,
+30510,
+30710,
+30954,
+31295,
+31679,
+31934,
+32197,
+32468,
+32684,
 32874,
-32556,
-32713,
-32426,
-32581,
-32371,
-32530,
-32317,
-32426,
-32184,
-32268,
-32104,
-32030,
-32001,
-31868,
-31977,
-31841,
-31950,
-31816,
-31762,
-31740,
-31708
+33156,
+33431,
+33603,
+33798,
+34170,
+34381,
+34597,
+34870,
+34926,
+35011,
+35132,
+35305,
+35319,
+35410,
+35514,
+35634,
+35707,
+35796,
+35883,
+35675,
+35700,
+35601,
+35495,
+35402,
+35311,
+35339,
+35221,
+35119,
+34959,
+34723,
+34535,
+34464,
+34333,
+34163,
+34039,
+33835,
+33655,
+33451,
+33278,
+33168,
+32952,
+32843,
+32698,
+32472,
+32413,
+32190,
+31974,
+31919,
+31724
 };
@@ -1,5 +1,5 @@
-// This file was generated by executing this statement: wav2c p4Unfrozen.wav
-extern uint16_t p4Unfrozen_wav[];
-#define P4UNFROZEN_WAV_SAMPLE_RATE 480000
+// This file was generated by executing this statement: wav2c -rate 16000 p4Unfrozen.wav
+extern const uint16_t p4Unfrozen_wav[];
+#define P4UNFROZEN_WAV_SAMPLE_RATE 16000
 #define P4UNFROZEN_WAV_BITS_PER_SAMPLE 16
-#define P4UNFROZEN_WAV_NUMBER_OF_SAMPLES 73971
+#define P4UNFROZEN_WAV_NUMBER_OF_SAMPLES 24657
@@ -2,7 +2,7 @@
 
 #include <stdint.h>
 
-uint16_t pacmanDeath_wav[82712] = {
+const uint16_t pacmanDeath_wav[82712] = {
 32761,
 32765,
 32782,
@@ -2,7 +2,7 @@
 
 #include <stdint.h>
 
-uint16_t powerUp48k_wav[60480] = {
+const uint16_t powerUp48k_wav[60480] = {
 32766,
 32768,
 32763,
@@ -2,7 +2,7 @@
 
 #include <stdint.h>
 
-uint16_t screamAndDie48k_wav[86158] = {
+const uint16_t screamAndDie48k_wav[86158] = {
 32531,
 32464,
 32508,
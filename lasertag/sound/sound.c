@@ -7,8 +7,13 @@ source code for personal or educational use.
 For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 */
 
+#include <stdint.h>
 #include <stdio.h>
+#include <string.h>
 
+// Define SOUND_USE_PACK to take all sounds from the sound pack linked into the
+// executable (see soundPack.h) instead of compiling in the generated C arrays.
+#ifndef SOUND_USE_PACK
 #include "bcfire01_48k.wav.h"
 #include "gameBoyStartup.wav.h"
 #include "gameOver48k.wav.h"
@@ -16,18 +21,19 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 #include "ouch48k.wav.h"
 #include "p1Frozen.h"
 #include "p1Unfrozen.h"
-#include "pacmanDeath.wav.h"
-#include "powerUp48k.wav.h"
-#include "screamAndDie48k.wav.h"
-#include "sound.h"
-#include "p1Frozen.h"
-#include "p1Unfrozen.h"
 #include "p2Frozen.h"
 #include "p2Unfrozen.h"
 #include "p3Frozen.h"
 #include "p3Unfrozen.h"
 #include "p4Frozen.h"
 #include "p4Unfrozen.h"
+#include "pacmanDeath.wav.h"
+#include "powerUp48k.wav.h"
+#include "screamAndDie48k.wav.h"
+#endif
+#include "sound.h"
+#include "soundMixer.h"
+#include "soundPack.h"
 #include "timer_ps.h"
 #include "xiicps.h"
 #include "xil_printf.h"
@@ -62,34 +68,147 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 #define SOUND_MULTIPLIER INT16_MAX / 3 // Primitive volume control.
 
 #define NO_SOUND 0 // A zero generates no sound.
-#define ONE_SECOND_OF_SOUND_ARRAY_SIZE                                         \
+#define NO_SOUND_SELECTED SOUND_SOUND_COUNT // sound_setSound() not called.
+#define ONE_SECOND_OF_SOUND_SAMPLE_COUNT                                       \
   48000 // The sample rate is 48k so that is 1 second's worth.
-uint16_t soundOfSilence[ONE_SECOND_OF_SOUND_ARRAY_SIZE];
 
 // Declared below the sound state-machine code.
 static int AudioInitialize(u16 timerID, u16 iicID, u32 i2sAddr);
 
+/****************************************************************
+ *                     sound asset table                        *
+ ****************************************************************/
+// Where the samples for each sound come from.
+typedef struct {
+  const char *name;       // Name of the sound in the sound pack.
+  uint8_t priority;       // Mixer priority, see SOUND_PRIORITY_*.
+  const uint16_t *array;  // Sample data, NULL if not available.
+  uint32_t sampleCount;   // Number of samples in array.
+  uint32_t sampleRate;    // Rate the samples were stored at, see wav2c -rate.
+} sound_asset_t;
+
+// Built-in arrays are only compiled in when not using the sound pack.
+#ifdef SOUND_USE_PACK
+#define SOUND_BUILTIN(array, sampleCount, sampleRate) NULL, 0, 0
+#else
+#define SOUND_BUILTIN(array, sampleCount, sampleRate)                          \
+  array, sampleCount, sampleRate
+#endif
+
+// Indexed by sound_sounds_t. Silence has no data, it is generated on the fly.
+static sound_asset_t sound_assets[SOUND_SOUND_COUNT] = {
+    [sound_gameStart_e] = {"gameBoyStartup", SOUND_PRIORITY_HIGH,
+        SOUND_BUILTIN(gameBoyStartup_wav, GAMEBOYSTARTUP_WAV_NUMBER_OF_SAMPLES,
+                      GAMEBOYSTARTUP_WAV_SAMPLE_RATE)},
+    [sound_gunFire_e] = {"bcfire01_48k", SOUND_PRIORITY_NORMAL,
+        SOUND_BUILTIN(bcfire01_48k_wav, BCFIRE01_48K_WAV_NUMBER_OF_SAMPLES,
+                      BCFIRE01_48K_WAV_SAMPLE_RATE)},
+    [sound_hit_e] = {"ouch48k", SOUND_PRIORITY_NORMAL,
+        SOUND_BUILTIN(ouch48k_wav, OUCH48K_WAV_NUMBER_OF_SAMPLES,
+                      OUCH48K_WAV_SAMPLE_RATE)},
+    [sound_gunClick_e] = {"gunEmpty48k", SOUND_PRIORITY_LOW,
+        SOUND_BUILTIN(gunEmpty48k_wav, GUNEMPTY48K_WAV_NUMBER_OF_SAMPLES,
+                      GUNEMPTY48K_WAV_SAMPLE_RATE)},
+    [sound_gunReload_e] = {"powerUp48k", SOUND_PRIORITY_LOW,
+        SOUND_BUILTIN(powerUp48k_wav, POWERUP48K_WAV_NUMBER_OF_SAMPLES,
+                      POWERUP48K_WAV_SAMPLE_RATE)},
+    [sound_loseLife_e] = {"screamAndDie48k", SOUND_PRIORITY_HIGH,
+        SOUND_BUILTIN(screamAndDie48k_wav,
+                      SCREAMANDDIE48K_WAV_NUMBER_OF_SAMPLES,
+                      SCREAMANDDIE48K_WAV_SAMPLE_RATE)},
+    [sound_gameOver_e] = {"pacmanDeath", SOUND_PRIORITY_HIGH,
+        SOUND_BUILTIN(pacmanDeath_wav, PACMANDEATH_WAV_NUMBER_OF_SAMPLES,
+                      PACMANDEATH_WAV_SAMPLE_RATE)},
+    [sound_returnToBase_e] = {"gameOver48k", SOUND_PRIORITY_HIGH,
+        SOUND_BUILTIN(gameOver48k_wav, GAMEOVER48K_WAV_NUMBER_OF_SAMPLES,
+                      GAMEOVER48K_WAV_SAMPLE_RATE)},
+    [sound_oneSecondSilence_e] = {NULL, SOUND_PRIORITY_NORMAL, NULL,
+        ONE_SECOND_OF_SOUND_SAMPLE_COUNT, SOUND_MIXER_SAMPLE_RATE},
+    [sound_p1Frozen] = {"p1Frozen", SOUND_PRIORITY_HIGH,
+        SOUND_BUILTIN(p1Frozen_wav, P1FROZEN_WAV_NUMBER_OF_SAMPLES,
+                      P1FROZEN_WAV_SAMPLE_RATE)},
+    [sound_p1Unfrozen] = {"p1Unfrozen", SOUND_PRIORITY_HIGH,
+        SOUND_BUILTIN(p1Unfrozen_wav, P1UNFROZEN_WAV_NUMBER_OF_SAMPLES,
+                      P1UNFROZEN_WAV_SAMPLE_RATE)},
+    [sound_p2Frozen] = {"p2Frozen", SOUND_PRIORITY_HIGH,
+        SOUND_BUILTIN(p2Frozen_wav, P2FROZEN_WAV_NUMBER_OF_SAMPLES,
+                      P2FROZEN_WAV_SAMPLE_RATE)},
+    [sound_p2Unfrozen] = {"p2Unfrozen", SOUND_PRIORITY_HIGH,
+        SOUND_BUILTIN(p2Unfrozen_wav, P2UNFROZEN_WAV_NUMBER_OF_SAMPLES,
+                      P2UNFROZEN_WAV_SAMPLE_RATE)},
+    [sound_p3Frozen] = {"p3Frozen", SOUND_PRIORITY_HIGH,
+        SOUND_BUILTIN(p3Frozen_wav, P3FROZEN_WAV_NUMBER_OF_SAMPLES,
+                      P3FROZEN_WAV_SAMPLE_RATE)},
+    [sound_p3Unfrozen] = {"p3Unfrozen", SOUND_PRIORITY_HIGH,
+        SOUND_BUILTIN(p3Unfrozen_wav, P3UNFROZEN_WAV_NUMBER_OF_SAMPLES,
+                      P3UNFROZEN_WAV_SAMPLE_RATE)},
+    [sound_p4Frozen] = {"p4Frozen", SOUND_PRIORITY_HIGH,
+        SOUND_BUILTIN(p4Frozen_wav, P4FROZEN_WAV_NUMBER_OF_SAMPLES,
+                      P4FROZEN_WAV_SAMPLE_RATE)},
+    [sound_p4Unfrozen] = {"p4Unfrozen", SOUND_PRIORITY_HIGH,
+        SOUND_BUILTIN(p4Unfrozen_wav, P4UNFROZEN_WAV_NUMBER_OF_SAMPLES,
+                      P4UNFROZEN_WAV_SAMPLE_RATE)}};
+
+// sound_assets[] as it was before the first sound_usePack(), so that
+// sound_usePack(NULL) can go back to it.
+static sound_asset_t sound_builtinAssets[SOUND_SOUND_COUNT];
+static bool sound_builtinAssetsSaved = false;
+
 /****************************************************************
  *                 sound state machine code                     *
  ****************************************************************/
 // True if sound_init() has been called, false otherwise.
 volatile static bool sound_initFlag = false;
 
-// True if a sound should be played, false otherwise.
-// Note that the state-machine sets this back to false once it has completed
-// playing a sound.
-volatile static bool sound_playSoundFlag = false;
-
-// Keep track of the base pointer to the sound array with current sample-rate
-// and sample count.
-volatile static uint16_t *sound_array; // Base pointer to the sound array.
-
-// static uint32_t sound_sampleRate;  // Sample rate for this sound.
-volatile static uint32_t sound_sampleCount; // Number of samples in this sound.
+// The sound picked by sound_setSound(). sound_startSound() plays it on a
+// mixer voice. The sound data are read-only and live in flash/rodata.
+volatile static uint16_t sound_selectedSound = NO_SOUND_SELECTED;
 
 // Keep track of the current volume setting.
 volatile static sound_volume_t sound_currentVolume = sound_minimumVolume_e;
 
+/****************************************************************
+ *                 sound command queue                          *
+ ****************************************************************/
+// Commands are posted by the game code and the ISRs (trigger) and are run by
+// sound_tick(). Only sound_tick() touches the mixer and the playlists, so
+// nothing needs to be locked against it.
+typedef enum {
+  sound_playCommand_e,     // Play one sound.
+  sound_playlistCommand_e, // Queue up a playlist.
+  sound_stopCommand_e      // Stop everything.
+} sound_commandType_t;
+
+// A playlist, also used as the payload of all commands.
+typedef struct {
+  sound_sounds_t sounds[SOUND_PLAYLIST_MAX_LENGTH];
+  uint8_t length;            // Number of valid entries in sounds.
+  uint16_t loopCount;        // Times to play the list, 0 is forever.
+  sound_callback_t callback; // Called when the list is done, may be NULL.
+  void *context;             // Passed to callback.
+} sound_playlist_t;
+
+typedef struct {
+  sound_commandType_t type;
+  sound_playlist_t playlist; // Sound(s) to play, unused by stop.
+} sound_command_t;
+
+// Multi-producer, single-consumer ring. A producer claims a slot by bumping
+// the write index, fills it and then marks it ready. sound_tick() consumes
+// ready slots in order.
+static sound_command_t sound_commands[SOUND_COMMAND_QUEUE_SIZE];
+volatile static bool sound_commandReady[SOUND_COMMAND_QUEUE_SIZE];
+volatile static uint32_t sound_commandWriteIndex = 0;
+volatile static uint32_t sound_commandReadIndex = 0;
+
+// Playlists waiting to be played, owned by sound_tick(). The first one plays.
+static sound_playlist_t sound_playlists[SOUND_PLAYLIST_QUEUE_SIZE];
+volatile static uint16_t sound_playlistHead = 0;
+volatile static uint16_t sound_playlistCount = 0;
+static uint8_t sound_playlistPosition = 0; // Sound being played.
+static uint16_t sound_playlistLoops = 0;   // Completed passes.
+static soundMixer_voice_t sound_playlistVoice = SOUND_MIXER_NO_VOICE;
+
 // Sound state-machine states.
 typedef enum {
   sound_init_st, // Waiting for sound_init() to be invoked.
@@ -128,9 +247,13 @@ sound_status_t sound_init() {
   // Setup the audio CODEC.
   AudioInitialize(SCU_TIMER_ID, AUDIO_IIC_ID, AUDIO_CTRL_BASEADDR);
   sound_initFlag = true;
-  // Initialize the silence array.
-  for (uint32_t i = 0; i < ONE_SECOND_OF_SOUND_ARRAY_SIZE; i++)
-    soundOfSilence[i] = NO_SOUND;
+  soundMixer_init();
+#ifdef SOUND_USE_PACK
+  soundPack_t linkedPack;
+  if (!soundPack_openLinked(&linkedPack) ||
+      sound_usePack(&linkedPack) != SOUND_STATUS_OK)
+    printf("sound_init(): no sound pack was linked.\n");
+#endif
   sound_setVolume(sound_minimumVolume_e); // Init the volume level.
   return SOUND_STATUS_OK;
 }
@@ -164,10 +287,139 @@ static void debugStatePrint() {
   }
 }
 
+// Copies command into the ring. Returns false if the ring is full.
+static bool sound_postCommand(const sound_command_t *command) {
+  uint32_t slot = __atomic_load_n(&sound_commandWriteIndex, __ATOMIC_RELAXED);
+  do {
+    if (slot - __atomic_load_n(&sound_commandReadIndex, __ATOMIC_ACQUIRE) >=
+        SOUND_COMMAND_QUEUE_SIZE) {
+      printf("sound_postCommand(): command queue is full.\n");
+      return false;
+    }
+  } while (!__atomic_compare_exchange_n(&sound_commandWriteIndex, &slot,
+                                        slot + 1, true, __ATOMIC_ACQ_REL,
+                                        __ATOMIC_RELAXED));
+  sound_commands[slot % SOUND_COMMAND_QUEUE_SIZE] = *command;
+  __atomic_store_n(&sound_commandReady[slot % SOUND_COMMAND_QUEUE_SIZE], true,
+                   __ATOMIC_RELEASE);
+  return true;
+}
+
+// Returns true if the asset table has something to play for soundId.
+// Silence is the only sound without a name; the mixer generates it.
+static bool sound_isPlayable(uint16_t soundId) {
+  if (soundId >= SOUND_SOUND_COUNT) {
+    printf("sound_setSoundById(): bogus sound value(%d)\n", soundId);
+    return false;
+  }
+  if (sound_assets[soundId].array == NULL && sound_assets[soundId].name) {
+    printf("sound_setSoundById(): no data for sound(%d)\n", soundId);
+    return false;
+  }
+  return true;
+}
+
+// Plays sound on its own mixer voice at its default priority and full
+// volume. Only called from sound_tick(), which owns the mixer.
+static soundMixer_voice_t sound_playAsset(sound_sounds_t sound) {
+  if (!sound_isPlayable(sound))
+    return SOUND_MIXER_NO_VOICE;
+  return soundMixer_play(sound, sound_assets[sound].array,
+                         sound_assets[sound].sampleCount,
+                         sound_assets[sound].sampleRate,
+                         sound_assets[sound].priority, SOUND_MIXER_UNITY_GAIN);
+}
+
+// Stops all voices and drops all playlists.
+static void sound_stopAll() {
+  soundMixer_stopAll();
+  sound_playlistCount = 0;
+  sound_playlistPosition = 0;
+  sound_playlistLoops = 0;
+  sound_playlistVoice = SOUND_MIXER_NO_VOICE;
+}
+
+// Runs one command taken from the ring.
+static void sound_runCommand(const sound_command_t *command) {
+  switch (command->type) {
+  case sound_playCommand_e:
+    sound_playAsset(command->playlist.sounds[0]);
+    break;
+  case sound_playlistCommand_e:
+    if (sound_playlistCount == SOUND_PLAYLIST_QUEUE_SIZE) {
+      printf("sound_runCommand(): too many playlists, dropped one.\n");
+      break;
+    }
+    sound_playlists[(sound_playlistHead + sound_playlistCount) %
+                    SOUND_PLAYLIST_QUEUE_SIZE] = command->playlist;
+    sound_playlistCount++;
+    break;
+  case sound_stopCommand_e:
+    sound_stopAll();
+    break;
+  }
+}
+
+// Runs all of the commands that have been posted.
+static void sound_runCommands() {
+  uint32_t slot = sound_commandReadIndex;
+  while (__atomic_load_n(&sound_commandReady[slot % SOUND_COMMAND_QUEUE_SIZE],
+                         __ATOMIC_ACQUIRE)) {
+    sound_runCommand(&sound_commands[slot % SOUND_COMMAND_QUEUE_SIZE]);
+    sound_commandReady[slot % SOUND_COMMAND_QUEUE_SIZE] = false;
+    slot++;
+    __atomic_store_n(&sound_commandReadIndex, slot, __ATOMIC_RELEASE);
+  }
+}
+
+// Starts the next sound of the current playlist once the previous one is done.
+// Must run before new commands are started so that a finished playlist voice
+// is noticed before someone else gets it.
+static void sound_servicePlaylists() {
+  if (sound_playlistCount == 0)
+    return;
+  sound_playlist_t *playlist = &sound_playlists[sound_playlistHead];
+  if (sound_playlistVoice != SOUND_MIXER_NO_VOICE) {
+    if (soundMixer_voiceActive(sound_playlistVoice))
+      return; // Still playing.
+    sound_playlistVoice = SOUND_MIXER_NO_VOICE;
+    if (++sound_playlistPosition == playlist->length) { // End of a pass.
+      sound_playlistPosition = 0;
+      sound_playlistLoops++;
+      if (playlist->loopCount != SOUND_PLAYLIST_LOOP_FOREVER &&
+          sound_playlistLoops == playlist->loopCount) { // All done.
+        sound_playlistLoops = 0;
+        sound_playlistHead =
+            (sound_playlistHead + 1) % SOUND_PLAYLIST_QUEUE_SIZE;
+        sound_playlistCount--;
+        if (playlist->callback)
+          playlist->callback(playlist->context);
+        return; // The next playlist starts on the next tick.
+      }
+    }
+  }
+  // If all voices are taken by more important sounds, try again next tick.
+  sound_playlistVoice =
+      sound_playAsset(playlist->sounds[sound_playlistPosition]);
+}
+
+// Converts a mixed (signed) sample to the offset-unsigned value the CODEC
+// expects and applies the master volume.
+static uint32_t sound_toCodecSample(int16_t mixedSample) {
+  int32_t value = (int32_t)mixedSample + SOUND_MIXER_SAMPLE_OFFSET;
+  return (value < 0 ? 0 : value) * sound_currentVolume;
+}
+
 // Standard tick function.
 void sound_tick() {
   //  debugStatePrint();
-  static uint32_t arrayIndex = 0;
+  // Mixed samples waiting to go to the FIFO. The mixer works a block at a time.
+  static int16_t mixedBlock[SOUND_MIXER_BLOCK_SIZE];
+  static uint32_t mixedIndex = SOUND_MIXER_BLOCK_SIZE; // Block is used up.
+  if (currentState != sound_init_st) {
+    sound_servicePlaylists(); // Before the commands, see above.
+    sound_runCommands();
+  }
   // Action switch statement.
   switch (currentState) {
   case sound_init_st:
@@ -188,8 +440,8 @@ void sound_tick() {
     }
     break;
   case sound_wait_st:
-    if (sound_playSoundFlag) {
-      arrayIndex = 0;
+    if (soundMixer_activeVoiceCount()) {
+      mixedIndex = SOUND_MIXER_BLOCK_SIZE; // Start with a fresh block.
       currentState = sound_play_st;
       sound_resetTxFifo();  // Reset the TX FIFO.
       sound_enableTxFifo(); // Enable the TX FIFO, disable mute.
@@ -198,24 +450,22 @@ void sound_tick() {
   case sound_play_st:
     // Each time you enter this state, add as many samples as will fit in the
     // FIFO.
-    if (sound_array == NULL) {
-      printf("ERROR, sound_tick: sound array has not been set.\n");
-      return;
-    }
     // This while-loop continues to load sound-data into the FIFOs until it is
-    // full or the sound data are exhausted.
+    // full or all voices are done.
     while (!(Xil_In32(AUDIO_CTRL_BASEADDR + I2S_FIFO_STS_REG) &
              0b0010)) { // while room in FIFO.
-      uint32_t sampleValue =
-          sound_array[arrayIndex] * sound_currentVolume; // Scale by volume.
-      sound_sendDataToBothChannels(
-          sampleValue); // Send the sound data to the left and right channels.
-      arrayIndex++;     // Go to next sample.
-      if (arrayIndex == sound_sampleCount) { // All done?
-        sound_playSoundFlag = false;         // Yes.
-        sound_disableTxFifo();               // Disable the TX FIFO.
-        currentState = sound_wait_st;        // Go back to the wait state.
+      if (mixedIndex == SOUND_MIXER_BLOCK_SIZE) { // Need another block?
+        if (!soundMixer_activeVoiceCount()) {     // All done?
+          sound_disableTxFifo();                  // Disable the TX FIFO.
+          currentState = sound_wait_st;           // Go back to the wait state.
+          break;
+        }
+        soundMixer_mix(mixedBlock, SOUND_MIXER_BLOCK_SIZE);
+        mixedIndex = 0;
       }
+      // Send the sound data to the left and right channels.
+      sound_sendDataToBothChannels(sound_toCodecSample(mixedBlock[mixedIndex]));
+      mixedIndex++; // Go to next sample.
     }
     break;
   }
@@ -227,111 +477,121 @@ void sound_playSound(sound_sounds_t sound) {
   sound_startSound();    // Start playing the sound.
 }
 
-// Returns true if the sound is still playing.
+// Returns true if a sound is still playing or waiting to be played.
 bool sound_isBusy() {
-  return (sound_playSoundFlag); // Busy if NOT in the wait state.
+  return soundMixer_activeVoiceCount() != 0 || sound_playlistCount != 0 ||
+         sound_commandReadIndex != sound_commandWriteIndex;
 }
 
 // Returns true if the sound has finished playing.
 bool sound_isSoundComplete() { return (!sound_isBusy()); }
 
 // Use this to set the base address for the array containing sound data.
-// Allow sounds to be interrupted.
-void sound_setSound(sound_sounds_t sound) {
-  if (sound_isBusy()) { // You are currently playing some sound.
-    sound_stopSound(); // Stop the sound and reset the state-machine, FIFO, etc.
+// Sounds that are already playing keep playing, the new sound is mixed in.
+void sound_setSound(sound_sounds_t sound) { sound_setSoundById(sound); }
+
+// Looks up the sound in the asset table and makes it the current sound.
+// Returns false if the id is bogus or the sound data are not available.
+bool sound_setSoundById(uint16_t soundId) {
+  if (!sound_isPlayable(soundId)) {
+    sound_selectedSound = NO_SOUND_SELECTED;
+    return false;
   }
-  sound_array =
-      NULL; // Set the pointer to NULL so you can detect it never being set.
-  switch (sound) {
-  case sound_gameStart_e:
-    sound_array = gameBoyStartup_wav; // Set the array holding the data.
-    sound_sampleCount =
-        GAMEBOYSTARTUP_WAV_NUMBER_OF_SAMPLES; // Size of the array.
-    break;
-  case sound_gunFire_e:
-    sound_array = bcfire01_48k_wav; // Set the array holding the data.
-    sound_sampleCount =
-        BCFIRE01_48K_WAV_NUMBER_OF_SAMPLES; // Size of the array.
-    break;
-  case sound_hit_e:
-    sound_array = ouch48k_wav; // You get the idea...
-    sound_sampleCount = OUCH48K_WAV_NUMBER_OF_SAMPLES;
-    break;
-  case sound_gunClick_e:
-    sound_array = gunEmpty48k_wav;
-    sound_sampleCount = GUNEMPTY48K_WAV_NUMBER_OF_SAMPLES;
-    break;
-  case sound_gunReload_e:
-    sound_array = powerUp48k_wav;
-    sound_sampleCount = POWERUP48K_WAV_NUMBER_OF_SAMPLES;
-    break;
-  case sound_loseLife_e:
-    sound_array = screamAndDie48k_wav;
-    sound_sampleCount = SCREAMANDDIE48K_WAV_NUMBER_OF_SAMPLES;
-    break;
-  case sound_gameOver_e:
-    sound_array = pacmanDeath_wav;
-    sound_sampleCount = PACMANDEATH_WAV_NUMBER_OF_SAMPLES;
-    break;
-  case sound_returnToBase_e:
-    sound_array = gameOver48k_wav;
-    sound_sampleCount = GAMEOVER48K_WAV_NUMBER_OF_SAMPLES;
-    break;
-  case sound_oneSecondSilence_e:
-    sound_array = soundOfSilence;
-    sound_sampleCount = ONE_SECOND_OF_SOUND_ARRAY_SIZE;
-    break;
-  case sound_p1Frozen:
-    sound_array = p1Frozen_wav;
-    sound_sampleCount = P1FROZENN_WAV_NUMBER_OF_SAMPLES;
-    break;
-  case sound_p1Unfrozen:
-    sound_array = p1Unfrozen_wav;
-    sound_sampleCount = P1UNFROZEN_WAV_NUMBER_OF_SAMPLES;
-    break;
-  case sound_p2Frozen:
-    sound_array = p2Frozen_wav;
-    sound_sampleCount = P2FROZEN_WAV_NUMBER_OF_SAMPLES;
-    break;
-  case sound_p2Unfrozen:
-    sound_array = p2Unfrozen_wav;
-    sound_sampleCount = P2UNFROZEN_WAV_NUMBER_OF_SAMPLES;
-    break;
-  case sound_p3Frozen:
-    sound_array = p3Frozen_wav;
-    sound_sampleCount = P3FROZEN_WAV_NUMBER_OF_SAMPLES;
-    break;
-  case sound_p3Unfrozen:
-    sound_array = p3Unfrozen_wav;
-    sound_sampleCount = P3UNFROZEN_WAV_NUMBER_OF_SAMPLES;
-    break;
-  case sound_p4Frozen:
-    sound_array = p4Frozen_wav;
-    sound_sampleCount = P4FROZEN_WAV_NUMBER_OF_SAMPLES;
-    break;
-  case sound_p4Unfrozen:
-    sound_array = p4Unfrozen_wav;
-    sound_sampleCount = P4UNFROZEN_WAV_NUMBER_OF_SAMPLES;
-    break;
-  default:
-    printf("sound_setSound(): bogus sound value(%d)\n", sound);
+  sound_selectedSound = soundId;
+  return true;
+}
+
+// Takes the sound data from pack for every sound found in it (by name).
+// Sounds missing from the pack keep their current data.
+sound_status_t sound_usePack(const soundPack_t *pack) {
+  if (!sound_builtinAssetsSaved) {
+    memcpy(sound_builtinAssets, sound_assets, sizeof(sound_assets));
+    sound_builtinAssetsSaved = true;
+  }
+  if (pack == NULL) {
+    memcpy(sound_assets, sound_builtinAssets, sizeof(sound_assets));
+    return SOUND_STATUS_OK;
+  }
+  if (pack->entryCount == 0)
+    return SOUND_STATUS_FAIL;
+  for (uint16_t i = 0; i < SOUND_SOUND_COUNT; i++) {
+    if (sound_assets[i].name == NULL)
+      continue;
+    const soundPack_entry_t *entry =
+        soundPack_findEntry(pack, sound_assets[i].name);
+    if (entry == NULL) {
+      printf("sound_usePack(): %s is not in the pack.\n", sound_assets[i].name);
+      continue;
+    }
+    sound_assets[i].array = soundPack_getSamples(pack, entry);
+    sound_assets[i].sampleCount = entry->sampleCount;
+    sound_assets[i].sampleRate = entry->sampleRate;
   }
+  return SOUND_STATUS_OK;
+}
+
+// Returns the samples of a sound and their count and rate, NULL if it has none.
+const uint16_t *sound_getSamples(sound_sounds_t sound, uint32_t *sampleCount,
+                                 uint32_t *sampleRate) {
+  if (sound >= SOUND_SOUND_COUNT)
+    return NULL;
+  *sampleCount = sound_assets[sound].sampleCount;
+  *sampleRate = sound_assets[sound].sampleRate;
+  return sound_assets[sound].array;
 }
 
 // Used to set the volume. Use one of the provided values.
 void sound_setVolume(sound_volume_t volume) { sound_currentVolume = volume; }
 
 // Tell the state machine to start playing the sound.
-void sound_startSound() { sound_playSoundFlag = true; }
+// The sound gets its own voice at its default priority and full volume.
+void sound_startSound() {
+  uint16_t sound = sound_selectedSound;
+  if (sound == NO_SOUND_SELECTED)
+    return;
+  sound_enqueue(sound);
+}
 
-// Stops playing the sound and resets the state-machine to the wait state.
+// Stops playing all sounds, drops all playlists and lets the state-machine
+// go back to the wait state. Takes effect at the next sound_tick().
 void sound_stopSound() {
-  sound_playSoundFlag = false; // disable the state-machine.
-  currentState =
-      sound_wait_st; // Force the state-machine back to the wait state.
+  sound_command_t command = {.type = sound_stopCommand_e};
+  sound_postCommand(&command);
+}
+
+// Posts a command to play sound once, mixed with whatever is playing.
+bool sound_enqueue(sound_sounds_t sound) {
+  if (!sound_isPlayable(sound))
+    return false;
+  sound_command_t command = {.type = sound_playCommand_e,
+                             .playlist = {.sounds = {sound}, .length = 1}};
+  return sound_postCommand(&command);
+}
+
+// Posts a playlist. See sound.h.
+bool sound_enqueuePlaylist(const sound_sounds_t sounds[], uint8_t length,
+                           uint16_t loopCount, sound_callback_t callback,
+                           void *context) {
+  if (length == 0 || length > SOUND_PLAYLIST_MAX_LENGTH) {
+    printf("sound_enqueuePlaylist(): bad playlist length(%d)\n", length);
+    return false;
+  }
+  sound_command_t command = {.type = sound_playlistCommand_e,
+                             .playlist = {.length = length,
+                                          .loopCount = loopCount,
+                                          .callback = callback,
+                                          .context = context}};
+  for (uint8_t i = 0; i < length; i++) {
+    if (!sound_isPlayable(sounds[i]))
+      return false;
+    command.playlist.sounds[i] = sounds[i];
+  }
+  return sound_postCommand(&command);
 }
 
+// Used by sound_runTest() to see the playlist callback.
+static void sound_testCallback(void *context) { *(bool *)context = true; }
+
 // Plays several sounds.
 // To invoke, just place this in your main.
 // Completely stand alone, doesn't require interrupts, etc.
@@ -380,6 +640,18 @@ void sound_runTest() {
     if (!sound_isBusy())
       break;
   }
+  static const sound_sounds_t playlist[] = {sound_gunFire_e,
+                                            sound_oneSecondSilence_e};
+  bool playlistDone = false;
+  printf("playing gunFire_e, oneSecondSilence_e twice\n");
+  sound_enqueuePlaylist(playlist, 2, 2, sound_testCallback, &playlistDone);
+  while (1) {
+    sound_tick();
+    if (!sound_isBusy())
+      break;
+  }
+  printf(playlistDone ? "playlist callback ran.\n"
+                      : "ERROR: playlist callback did not run.\n");
   printf("done.\n");
 }
 
@@ -13,6 +13,9 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "soundMixer.h"
+#include "soundPack.h"
+
 typedef uint32_t sound_status_t;
 #define SOUND_STATUS_OK 0
 #define SOUND_STATUS_FAIL 1
@@ -44,6 +47,28 @@ typedef enum {
   sound_p4Unfrozen
 } sound_sounds_t;
 
+// Number of sounds in sound_sounds_t.
+#define SOUND_SOUND_COUNT (sound_p4Unfrozen + 1)
+
+// Mixer priorities. When all mixer voices are busy, a sound can only take the
+// voice of a sound with the same or a lower priority.
+#define SOUND_PRIORITY_LOW 0    // Clicks and reloads.
+#define SOUND_PRIORITY_NORMAL 1 // Gunfire and hits.
+#define SOUND_PRIORITY_HIGH 2   // Announcements and game-state changes.
+
+// Sound command queue and playlists.
+// Any code, including ISR code, can post commands with sound_enqueue*(). The
+// sound state machine runs them in sound_tick(), so callers never have to poll
+// for a sound to finish before starting the next one.
+#define SOUND_COMMAND_QUEUE_SIZE 16  // Must be a power of 2.
+#define SOUND_PLAYLIST_MAX_LENGTH 4  // Sounds per playlist.
+#define SOUND_PLAYLIST_QUEUE_SIZE 4  // Playlists waiting to be played.
+#define SOUND_PLAYLIST_LOOP_FOREVER 0 // Loop until sound_stopSound().
+
+// Called when a playlist finishes. Runs inside of sound_tick() (the ISR), so
+// keep it short, e.g., set a flag or enqueue the next playlist.
+typedef void (*sound_callback_t)(void *context);
+
 // Just provide 4 volume settings.
 // sound_lowVolume_e will be the default.
 typedef enum {
@@ -62,25 +87,57 @@ void sound_tick();
 // Sets the sound and starts playing it immediately.
 void sound_playSound(sound_sounds_t sound);
 
-// Returns true if the sound is still playing.
+// Returns true if a sound is still playing or waiting to be played.
 bool sound_isBusy();
 
 // Returns true if the sound has finished playing.
 bool sound_isSoundComplete();
 
 // Use this to set the base address for the array containing sound data.
-// Allow sounds to be interrupted.
+// Sounds that are already playing keep playing, the new sound is mixed in.
 void sound_setSound(sound_sounds_t sound);
 
+// Table lookup behind sound_setSound(). soundId is a sound_sounds_t value.
+// Returns false if the id is bogus or the sound data are not available.
+bool sound_setSoundById(uint16_t soundId);
+
+// Plays sounds from pack instead of the built-in arrays. Sounds are matched by
+// name and sounds missing from the pack keep their current data. The pack must
+// stay mapped for as long as sounds are played. NULL goes back to the data
+// from before the first call.
+sound_status_t sound_usePack(const soundPack_t *pack);
+
+// Returns the samples a sound plays, with their count and rate, or NULL if
+// the sound has no data (silence, or a sound missing from the pack).
+const uint16_t *sound_getSamples(sound_sounds_t sound, uint32_t *sampleCount,
+                                 uint32_t *sampleRate);
+
 // Used to set the volume. Use one of the provided values.
 void sound_setVolume(sound_volume_t);
 
 // Tell the state machine to start playing the sound.
+// The sound gets its own mixer voice at its default priority.
 void sound_startSound();
 
-// Stops playing the sound and resets the state-machine to the wait state.
+// Stops playing all sounds, drops all playlists and lets the state-machine
+// go back to the wait state. Takes effect at the next sound_tick().
 void sound_stopSound();
 
+// Posts a command to play sound once, mixed with whatever is playing.
+// Safe to call from an ISR. Returns false if the command queue is full or the
+// sound is bogus.
+bool sound_enqueue(sound_sounds_t sound);
+
+// Posts a playlist: length sounds played back to back, loopCount times
+// (SOUND_PLAYLIST_LOOP_FOREVER loops until sound_stopSound()). Playlists are
+// played one after another in the order they were posted. callback (may be
+// NULL) is called with context when the playlist finishes, but not if it is
+// stopped. Safe to call from an ISR. Returns false if the command queue is
+// full or the playlist is bogus.
+bool sound_enqueuePlaylist(const sound_sounds_t sounds[], uint8_t length,
+                           uint16_t loopCount, sound_callback_t callback,
+                           void *context);
+
 // Plays several sounds.
 // To invoke, just place this in your main.
 // Completely stand alone, doesn't require interrupts, etc.
@@ -0,0 +1,271 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#include <stddef.h>
+#include <string.h>
+
+#include "soundMixer.h"
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define SOUND_MIXER_NEON
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define SOUND_MIXER_SSE2
+#endif
+
+#define SOUND_MIXER_SIMD_LANES 8 // 16-bit lanes in a 128-bit register.
+#define Q15_SHIFT 15
+#define INTERPOLATOR_TAPS 8 // Taps per polyphase branch.
+// Input samples the interpolator looks ahead, centers the filter on the clip.
+#define INTERPOLATOR_LOOKAHEAD (INTERPOLATOR_TAPS / 2)
+
+// Polyphase branches of the interpolation filters, Q15. Each prototype is a
+// Blackman-windowed sinc with its cutoff at 90% of the clip's Nyquist
+// frequency; every branch is scaled to unity DC gain.
+// Branch p computes output sample m * factor + p from clip samples
+// m + INTERPOLATOR_LOOKAHEAD down to m + INTERPOLATOR_LOOKAHEAD - 7.
+static const int16_t interpolatorBy2[2][INTERPOLATOR_TAPS] = {
+    {-9, 422, -2571, 10272, 26667, -2130, 90, 26},
+    {26, 90, -2130, 26667, 10272, -2571, 422, -9}};
+static const int16_t interpolatorBy3[3][INTERPOLATOR_TAPS] = {
+    {-4, 345, -2068, 7411, 28211, -984, -209, 66},
+    {-20, 508, -3436, 19332, 19332, -3436, 508, -20},
+    {66, -209, -984, 28211, 7411, -2068, 345, -4}};
+static const int16_t interpolatorBy4[4][INTERPOLATOR_TAPS] = {
+    {-2, 304, -1806, 6067, 28766, -263, -390, 91},
+    {-17, 505, -3178, 14816, 23413, -3147, 383, -9},
+    {-9, 383, -3147, 23413, 14816, -3178, 505, -17},
+    {91, -390, -263, 28766, 6067, -1806, 304, -2}};
+
+// Indexed by upsample factor. Factor 1 needs no interpolation.
+static const int16_t *const interpolators[SOUND_MIXER_MAX_UPSAMPLE + 1] = {
+    NULL, NULL, &interpolatorBy2[0][0], &interpolatorBy3[0][0],
+    &interpolatorBy4[0][0]};
+
+// Everything the mixer knows about one voice.
+// Voices are written by the callers and read by the mix loop (from the ISR),
+// so a voice is always deactivated before it is rewritten.
+typedef struct {
+  const uint16_t *samples; // Offset-unsigned samples, NULL for silence.
+  uint32_t sampleCount;    // Number of samples in the clip.
+  uint32_t outputCount;    // Number of 48 kHz samples the clip plays for.
+  uint32_t position;       // Next (48 kHz) sample to mix.
+  uint8_t upsampleFactor;  // SOUND_MIXER_SAMPLE_RATE / clip sample rate.
+  uint32_t startOrder;     // Used to find the oldest voice when stealing.
+  uint16_t soundId;        // What is playing (informational).
+  int16_t volume;          // Q15 gain.
+  uint8_t priority;        // Higher values are more important.
+  bool active;             // True while the voice is playing.
+} soundMixer_voiceState_t;
+
+static volatile soundMixer_voiceState_t voices[SOUND_MIXER_VOICE_COUNT];
+static uint32_t startCount; // Incremented each time a voice is started.
+
+// Clears all voices.
+void soundMixer_init(void) {
+  for (soundMixer_voice_t v = 0; v < SOUND_MIXER_VOICE_COUNT; v++) {
+    voices[v].active = false;
+    voices[v].samples = NULL;
+    voices[v].sampleCount = 0;
+    voices[v].outputCount = 0;
+    voices[v].position = 0;
+    voices[v].upsampleFactor = 1;
+  }
+  startCount = 0;
+}
+
+// Starts playing sampleCount samples on a free or stolen voice.
+// Returns the voice used or SOUND_MIXER_NO_VOICE.
+soundMixer_voice_t soundMixer_play(uint16_t soundId, const uint16_t *samples,
+                                   uint32_t sampleCount, uint32_t sampleRate,
+                                   uint8_t priority, int16_t volume) {
+  soundMixer_voice_t chosen = SOUND_MIXER_NO_VOICE;
+  if (sampleCount == 0 || sampleRate == 0 ||
+      SOUND_MIXER_SAMPLE_RATE % sampleRate ||
+      SOUND_MIXER_SAMPLE_RATE / sampleRate > SOUND_MIXER_MAX_UPSAMPLE)
+    return SOUND_MIXER_NO_VOICE;
+  uint8_t upsampleFactor = SOUND_MIXER_SAMPLE_RATE / sampleRate;
+  // Take the first free voice.
+  for (soundMixer_voice_t v = 0; v < SOUND_MIXER_VOICE_COUNT; v++) {
+    if (!voices[v].active) {
+      chosen = v;
+      break;
+    }
+  }
+  // None free: steal the lowest-priority voice, oldest first, but never one
+  // that is more important than the new sound.
+  if (chosen == SOUND_MIXER_NO_VOICE) {
+    for (soundMixer_voice_t v = 0; v < SOUND_MIXER_VOICE_COUNT; v++) {
+      if (voices[v].priority > priority)
+        continue;
+      if (chosen == SOUND_MIXER_NO_VOICE ||
+          voices[v].priority < voices[chosen].priority ||
+          (voices[v].priority == voices[chosen].priority &&
+           voices[v].startOrder - voices[chosen].startOrder > UINT32_MAX / 2))
+        chosen = v;
+    }
+    if (chosen == SOUND_MIXER_NO_VOICE)
+      return SOUND_MIXER_NO_VOICE;
+  }
+  voices[chosen].active = false; // Keep the mix loop off while rewriting.
+  voices[chosen].samples = samples;
+  voices[chosen].sampleCount = sampleCount;
+  voices[chosen].outputCount = sampleCount * upsampleFactor;
+  voices[chosen].position = 0;
+  voices[chosen].upsampleFactor = upsampleFactor;
+  voices[chosen].startOrder = startCount++;
+  voices[chosen].soundId = soundId;
+  voices[chosen].volume = volume;
+  voices[chosen].priority = priority;
+  voices[chosen].active = true;
+  return chosen;
+}
+
+// Stops a single voice.
+void soundMixer_stop(soundMixer_voice_t voice) {
+  if (voice >= 0 && voice < SOUND_MIXER_VOICE_COUNT)
+    voices[voice].active = false;
+}
+
+// Stops all voices.
+void soundMixer_stopAll(void) {
+  for (soundMixer_voice_t v = 0; v < SOUND_MIXER_VOICE_COUNT; v++)
+    voices[v].active = false;
+}
+
+// Changes the volume (Q15 gain) of a playing voice.
+void soundMixer_setVolume(soundMixer_voice_t voice, int16_t volume) {
+  if (voice >= 0 && voice < SOUND_MIXER_VOICE_COUNT)
+    voices[voice].volume = volume;
+}
+
+// Returns true if the voice is playing.
+bool soundMixer_voiceActive(soundMixer_voice_t voice) {
+  return (voice >= 0 && voice < SOUND_MIXER_VOICE_COUNT) &&
+         voices[voice].active;
+}
+
+// Returns the number of voices that are playing.
+uint16_t soundMixer_activeVoiceCount(void) {
+  uint16_t count = 0;
+  for (soundMixer_voice_t v = 0; v < SOUND_MIXER_VOICE_COUNT; v++)
+    count += voices[v].active;
+  return count;
+}
+
+// Converts offset-unsigned samples to signed and applies a Q15 gain.
+// (in - offset) is in [-32767, 32768], so only unity gain can overflow.
+static void soundMixer_scale(int16_t out[], const uint16_t in[],
+                             uint32_t count, int16_t volume) {
+  if (volume == SOUND_MIXER_UNITY_GAIN) {
+    for (uint32_t i = 0; i < count; i++) {
+      int32_t value = (int32_t)in[i] - SOUND_MIXER_SAMPLE_OFFSET;
+      out[i] = value > INT16_MAX ? INT16_MAX : value;
+    }
+  } else {
+    for (uint32_t i = 0; i < count; i++)
+      out[i] = (((int32_t)in[i] - SOUND_MIXER_SAMPLE_OFFSET) * volume) >>
+               Q15_SHIFT;
+  }
+}
+
+// Returns clip sample i as a signed sample, silence outside of the clip.
+static inline int32_t soundMixer_clipSample(const uint16_t in[],
+                                            uint32_t sampleCount, int32_t i) {
+  return (i >= 0 && (uint32_t)i < sampleCount)
+             ? (int32_t)in[i] - SOUND_MIXER_SAMPLE_OFFSET
+             : 0;
+}
+
+// Produces count output samples of a clip stored at 1/factor of the output
+// rate, starting at output sample position, and applies a Q15 gain.
+static void soundMixer_upsample(int16_t out[], const uint16_t in[],
+                                uint32_t sampleCount, uint32_t position,
+                                uint32_t count, uint8_t factor,
+                                int16_t volume) {
+  const int16_t *branches = interpolators[factor];
+  int32_t m = position / factor; // Current clip sample.
+  uint8_t phase = position % factor;
+  for (uint32_t i = 0; i < count; i++) {
+    const int16_t *taps = &branches[phase * INTERPOLATOR_TAPS];
+    int32_t newest = m + INTERPOLATOR_LOOKAHEAD;
+    int32_t sum = 0;
+    if (newest - INTERPOLATOR_TAPS + 1 >= 0 && newest < (int32_t)sampleCount) {
+      // Whole window is inside of the clip (almost always).
+      const uint16_t *x = &in[newest];
+      for (int32_t k = 0; k < INTERPOLATOR_TAPS; k++)
+        sum += taps[k] * ((int32_t)x[-k] - SOUND_MIXER_SAMPLE_OFFSET);
+    } else {
+      for (int32_t k = 0; k < INTERPOLATOR_TAPS; k++)
+        sum += taps[k] * soundMixer_clipSample(in, sampleCount, newest - k);
+    }
+    int32_t value = sum >> Q15_SHIFT;
+    if (volume != SOUND_MIXER_UNITY_GAIN)
+      value = (value * volume) >> Q15_SHIFT;
+    out[i] = value > INT16_MAX ? INT16_MAX
+                               : (value < INT16_MIN ? INT16_MIN : value);
+    if (++phase == factor) {
+      phase = 0;
+      m++;
+    }
+  }
+}
+
+// acc[i] = saturate(acc[i] + in[i]), eight lanes at a time when possible.
+static void soundMixer_addSaturate(int16_t acc[], const int16_t in[],
+                                   uint32_t count) {
+  uint32_t i = 0;
+#if defined(SOUND_MIXER_NEON)
+  for (; i + SOUND_MIXER_SIMD_LANES <= count; i += SOUND_MIXER_SIMD_LANES)
+    vst1q_s16(&acc[i], vqaddq_s16(vld1q_s16(&acc[i]), vld1q_s16(&in[i])));
+#elif defined(SOUND_MIXER_SSE2)
+  for (; i + SOUND_MIXER_SIMD_LANES <= count; i += SOUND_MIXER_SIMD_LANES) {
+    __m128i a = _mm_loadu_si128((const __m128i *)&acc[i]);
+    __m128i b = _mm_loadu_si128((const __m128i *)&in[i]);
+    _mm_storeu_si128((__m128i *)&acc[i], _mm_adds_epi16(a, b));
+  }
+#endif
+  // Scalar tail (or everything if there is no SIMD).
+  for (; i < count; i++) {
+    int32_t sum = (int32_t)acc[i] + in[i];
+    acc[i] = sum > INT16_MAX ? INT16_MAX : (sum < INT16_MIN ? INT16_MIN : sum);
+  }
+}
+
+// Mixes the next count samples of all active voices into out.
+// Voices that run out of samples are released.
+void soundMixer_mix(int16_t out[], uint32_t count) {
+  int16_t voiceBlock[SOUND_MIXER_BLOCK_SIZE]; // One voice, scaled.
+  if (count > SOUND_MIXER_BLOCK_SIZE)
+    count = SOUND_MIXER_BLOCK_SIZE;
+  memset(out, 0, count * sizeof(out[0]));
+  for (soundMixer_voice_t v = 0; v < SOUND_MIXER_VOICE_COUNT; v++) {
+    if (!voices[v].active)
+      continue;
+    uint32_t position = voices[v].position;
+    uint32_t remaining = voices[v].outputCount - position;
+    uint32_t mixCount = remaining < count ? remaining : count;
+    const uint16_t *samples = voices[v].samples;
+    uint8_t factor = voices[v].upsampleFactor;
+    // Silence only takes up time, there is nothing to add.
+    if (samples != NULL) {
+      if (factor == 1)
+        soundMixer_scale(voiceBlock, &samples[position], mixCount,
+                         voices[v].volume);
+      else
+        soundMixer_upsample(voiceBlock, samples, voices[v].sampleCount,
+                            position, mixCount, factor, voices[v].volume);
+      soundMixer_addSaturate(out, voiceBlock, mixCount);
+    }
+    voices[v].position = position + mixCount;
+    if (mixCount == remaining)
+      voices[v].active = false; // All done, free the voice.
+  }
+}
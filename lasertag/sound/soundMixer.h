@@ -0,0 +1,73 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef SOUNDMIXER_H_
+#define SOUNDMIXER_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Mixes up to SOUND_MIXER_VOICE_COUNT clips at once so that, e.g., a gunshot
+// does not cut off a "player 2 frozen" announcement. Each voice has its own
+// volume and priority. When all voices are busy, a new sound steals the
+// lowest-priority voice (the oldest one if there is a tie), but never a voice
+// with a higher priority than its own.
+//
+// Mixing is done a block at a time in 16-bit fixed point with saturating
+// adds, using NEON (Zynq) or SSE2 (host) when available.
+//
+// Clips stored at a fraction of the output rate (e.g., 16 kHz speech) are
+// upsampled on the fly with an 8-tap-per-phase polyphase interpolator.
+//
+// Pure C, no hardware access: sound.c feeds the mixed blocks to the I2S FIFO.
+
+#define SOUND_MIXER_VOICE_COUNT 4
+#define SOUND_MIXER_BLOCK_SIZE 32 // Samples mixed per call to the mix loop.
+#define SOUND_MIXER_NO_VOICE (-1) // Returned when a sound could not be played.
+#define SOUND_MIXER_UNITY_GAIN INT16_MAX // Q15 gain of 1.0.
+#define SOUND_MIXER_SAMPLE_OFFSET INT16_MAX // Clips are offset to unsigned.
+#define SOUND_MIXER_SAMPLE_RATE 48000 // Output rate, same as the CODEC.
+#define SOUND_MIXER_MAX_UPSAMPLE 4 // Clips can be as slow as 48 kHz / this.
+
+typedef int16_t soundMixer_voice_t; // Voice index or SOUND_MIXER_NO_VOICE.
+
+// Clears all voices.
+void soundMixer_init(void);
+
+// Starts playing sampleCount samples (offset-unsigned, as generated by wav2c)
+// on a free or stolen voice. A NULL samples pointer plays silence for
+// sampleCount samples. sampleRate must be SOUND_MIXER_SAMPLE_RATE divided by
+// 1 to SOUND_MIXER_MAX_UPSAMPLE. volume is a Q15 gain. soundId is only stored
+// so that callers can tell what a voice is playing. Returns the voice used or
+// SOUND_MIXER_NO_VOICE.
+soundMixer_voice_t soundMixer_play(uint16_t soundId, const uint16_t *samples,
+                                   uint32_t sampleCount, uint32_t sampleRate,
+                                   uint8_t priority, int16_t volume);
+
+// Stops a single voice.
+void soundMixer_stop(soundMixer_voice_t voice);
+
+// Stops all voices.
+void soundMixer_stopAll(void);
+
+// Changes the volume (Q15 gain) of a playing voice.
+void soundMixer_setVolume(soundMixer_voice_t voice, int16_t volume);
+
+// Returns true if the voice is playing.
+bool soundMixer_voiceActive(soundMixer_voice_t voice);
+
+// Returns the number of voices that are playing.
+uint16_t soundMixer_activeVoiceCount(void);
+
+// Mixes the next count samples of all active voices into out as signed
+// 16-bit samples (silence is 0). Voices that run out of samples are released.
+// count must not exceed SOUND_MIXER_BLOCK_SIZE.
+void soundMixer_mix(int16_t out[], uint32_t count);
+
+#endif /* SOUNDMIXER_H_ */
@@ -0,0 +1,148 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "soundPack.h"
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Link the pack into .rodata when the build provides one.
+// SOUND_PACK_INCBIN_FILE is a quoted path, e.g. -DSOUND_PACK_INCBIN_FILE="x".
+#ifdef SOUND_PACK_INCBIN_FILE
+__asm__(".section .rodata\n"
+        ".balign 4\n"
+        ".global soundPack_linkedStart\n"
+        "soundPack_linkedStart:\n"
+        ".incbin \"" SOUND_PACK_INCBIN_FILE "\"\n"
+        ".global soundPack_linkedEnd\n"
+        "soundPack_linkedEnd:\n"
+        ".previous\n");
+extern const uint8_t soundPack_linkedStart[];
+extern const uint8_t soundPack_linkedEnd[];
+#endif
+
+// Validates the pack found at base and fills in pack.
+// Returns false (and leaves pack empty) if the blob is not a valid pack.
+bool soundPack_open(soundPack_t *pack, const void *base, uint32_t size) {
+  pack->base = NULL;
+  pack->size = 0;
+  pack->entries = NULL;
+  pack->entryCount = 0;
+  if (base == NULL || size < sizeof(soundPack_header_t))
+    return false;
+  const soundPack_header_t *header = base;
+  if (header->magic != SOUND_PACK_MAGIC) {
+    printf("soundPack_open(): bad magic number (0x%08lx)\n",
+           (unsigned long)header->magic);
+    return false;
+  }
+  if (header->version != SOUND_PACK_VERSION) {
+    printf("soundPack_open(): unsupported version (%d)\n", header->version);
+    return false;
+  }
+  // Every size is checked against what is left of the pack, by division,
+  // so that a corrupt count or offset cannot wrap around in uint32_t.
+  if (header->packSize > size ||
+      header->packSize < sizeof(soundPack_header_t) ||
+      header->entryCount >
+          (header->packSize - sizeof(soundPack_header_t)) /
+              sizeof(soundPack_entry_t)) {
+    printf("soundPack_open(): pack is truncated\n");
+    return false;
+  }
+  uint32_t indexEnd = sizeof(soundPack_header_t) +
+                      header->entryCount * sizeof(soundPack_entry_t);
+  const soundPack_entry_t *entries =
+      (const soundPack_entry_t *)((const uint8_t *)base +
+                                  sizeof(soundPack_header_t));
+  // Make sure every clip lies completely inside of the pack.
+  for (uint16_t i = 0; i < header->entryCount; i++) {
+    if (entries[i].encoding != soundPack_pcm16Unsigned_e ||
+        entries[i].offset % SOUND_PACK_DATA_ALIGNMENT ||
+        entries[i].offset < indexEnd ||
+        entries[i].offset > header->packSize ||
+        entries[i].sampleCount >
+            (header->packSize - entries[i].offset) / sizeof(uint16_t)) {
+      printf("soundPack_open(): bad index entry (%d)\n", i);
+      return false;
+    }
+  }
+  pack->base = base;
+  pack->size = header->packSize;
+  pack->entries = entries;
+  pack->entryCount = header->entryCount;
+  return true;
+}
+
+// Opens the pack linked into the executable with .incbin.
+// Returns false if no pack was linked (SOUND_PACK_INCBIN_FILE not defined).
+bool soundPack_openLinked(soundPack_t *pack) {
+#ifdef SOUND_PACK_INCBIN_FILE
+  return soundPack_open(pack, soundPack_linkedStart,
+                        soundPack_linkedEnd - soundPack_linkedStart);
+#else
+  return soundPack_open(pack, NULL, 0);
+#endif
+}
+
+// Maps the pack file at path into memory and opens it. Host builds only,
+// returns false on the board or if the file cannot be mapped.
+// The mapping is kept for the life of the program.
+bool soundPack_mapFile(soundPack_t *pack, const char *path) {
+#if defined(__linux__)
+  int fd = open(path, O_RDONLY);
+  if (fd < 0) {
+    printf("soundPack_mapFile(): unable to open %s\n", path);
+    return soundPack_open(pack, NULL, 0);
+  }
+  struct stat fileStat;
+  void *base = MAP_FAILED;
+  // soundPack_open() takes a uint32_t size, larger files are not packs.
+  if (fstat(fd, &fileStat) == 0 && fileStat.st_size > 0 &&
+      fileStat.st_size <= UINT32_MAX)
+    base = mmap(NULL, fileStat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd); // The mapping stays valid after the file is closed.
+  if (base == MAP_FAILED) {
+    printf("soundPack_mapFile(): unable to map %s\n", path);
+    return soundPack_open(pack, NULL, 0);
+  }
+  if (!soundPack_open(pack, base, fileStat.st_size)) {
+    munmap(base, fileStat.st_size);
+    return false;
+  }
+  return true;
+#else
+  (void)path;
+  return soundPack_open(pack, NULL, 0);
+#endif
+}
+
+// Returns the entry with the given name, or NULL if it is not in the pack.
+const soundPack_entry_t *soundPack_findEntry(const soundPack_t *pack,
+                                             const char *name) {
+  for (uint16_t i = 0; i < pack->entryCount; i++) {
+    if (!strncmp(pack->entries[i].name, name, SOUND_PACK_NAME_SIZE))
+      return &pack->entries[i];
+  }
+  return NULL;
+}
+
+// Returns a pointer to the samples of an entry.
+const uint16_t *soundPack_getSamples(const soundPack_t *pack,
+                                     const soundPack_entry_t *entry) {
+  return (const uint16_t *)(pack->base + entry->offset);
+}
@@ -0,0 +1,84 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef SOUNDPACK_H_
+#define SOUNDPACK_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// A sound pack is a single binary blob holding every sound clip, generated by
+// "wav2c -pack". It replaces the one-C-array-per-sound files so that sounds
+// can be added without regenerating and recompiling code. The blob can be
+// linked into the executable (.incbin), loaded from storage into memory, or
+// mmap()ed directly on the host.
+//
+// Layout (all fields little-endian, same as the Zynq and x86 hosts):
+//   soundPack_header_t
+//   soundPack_entry_t[entryCount]   (the index)
+//   sample data, each clip starting on a SOUND_PACK_DATA_ALIGNMENT boundary.
+
+#define SOUND_PACK_MAGIC 0x4B505354 // "TSPK" when read as bytes.
+#define SOUND_PACK_VERSION 1
+#define SOUND_PACK_NAME_SIZE 24 // Includes the terminating NULL.
+#define SOUND_PACK_DATA_ALIGNMENT 4 // Clip data offsets are multiples of this.
+
+// How the samples of a clip are stored.
+typedef enum {
+  // 16-bit samples offset to unsigned for the CODEC (same as wav2c arrays).
+  soundPack_pcm16Unsigned_e = 0
+} soundPack_encoding_t;
+
+// Found at offset 0 of the pack.
+typedef struct {
+  uint32_t magic;      // SOUND_PACK_MAGIC.
+  uint16_t version;    // SOUND_PACK_VERSION.
+  uint16_t entryCount; // Number of index entries that follow the header.
+  uint32_t packSize;   // Total size of the pack in bytes.
+} soundPack_header_t;
+
+// One index entry per clip.
+typedef struct {
+  char name[SOUND_PACK_NAME_SIZE]; // Wave file-name without path or suffix.
+  uint32_t sampleRate;             // Samples per second.
+  uint32_t sampleCount;            // Number of samples in the clip.
+  uint16_t encoding;               // One of soundPack_encoding_t.
+  uint16_t bitsPerSample;          // Always 16 for now.
+  uint32_t offset; // Byte offset of the sample data from the start of the pack.
+} soundPack_entry_t;
+
+// An opened pack. Just points into memory owned by someone else.
+typedef struct {
+  const uint8_t *base;              // Start of the pack.
+  uint32_t size;                    // Size of the pack in bytes.
+  const soundPack_entry_t *entries; // The index.
+  uint16_t entryCount;              // Number of entries in the index.
+} soundPack_t;
+
+// Validates the pack found at base and fills in pack.
+// Returns false (and leaves pack empty) if the blob is not a valid pack.
+bool soundPack_open(soundPack_t *pack, const void *base, uint32_t size);
+
+// Opens the pack linked into the executable with .incbin.
+// Returns false if no pack was linked (SOUND_PACK_INCBIN_FILE not defined).
+bool soundPack_openLinked(soundPack_t *pack);
+
+// Maps the pack file at path into memory and opens it. Host builds only,
+// returns false on the board or if the file cannot be mapped.
+bool soundPack_mapFile(soundPack_t *pack, const char *path);
+
+// Returns the entry with the given name, or NULL if it is not in the pack.
+const soundPack_entry_t *soundPack_findEntry(const soundPack_t *pack,
+                                             const char *name);
+
+// Returns a pointer to the samples of an entry.
+const uint16_t *soundPack_getSamples(const soundPack_t *pack,
+                                     const soundPack_entry_t *entry);
+
+#endif /* SOUNDPACK_H_ */
@@ -4,7 +4,9 @@
 #include <stdlib.h>
 #include <string.h>
 #include <ctype.h>
+#include <math.h>
 
+#include "soundPack.h"  // Binary sound-pack format shared with the firmware.
 
 // Leave the following line uncommented unless you want to generate a simple tone.
 //#define GENERATE_TONE
@@ -14,8 +16,17 @@
 #define H_FILE_SUFFIX ".h"      // .h files have this suffix.
 #define C_FILE_SUFFIX ".c"      // .c files have this suffix.
 #define EXTERN_STATEMENT "extern"  // Just the C extern statement.
-#define C_DATA_TYPE "uint16_t"  // Type for data in the .c file
+#define C_DATA_TYPE "const uint16_t"  // Type for data in the .c file. const keeps the table in flash/rodata.
 #define SUPPORTED_WAVE_DATA_BIT_SIZE 16  // Program can only handle this size of data for now.
+#define PACK_OPTION "-pack"     // wav2c -pack output.pak file1.wav file2.wav ...
+#define PACK_MIN_ARG_COUNT 4    // wav2c, -pack, output file and at least one .wav file.
+#define RATE_OPTION "-rate"     // wav2c -rate 16000 file.wav resamples to 16 kHz.
+#define KEEP_SAMPLE_RATE 0      // No -rate option: keep the rate of the .wav file.
+// Anti-alias filter used when resampling. A Blackman-windowed sinc with this
+// many taps per unit of decimation (plus one) stops about 74 dB below the
+// passband, which ends at ANTI_ALIAS_PASSBAND of the new Nyquist frequency.
+#define ANTI_ALIAS_TAPS_PER_FACTOR 32
+#define ANTI_ALIAS_PASSBAND 0.9
 
 // Header-specific defines. All sizes are numbered in bytes.
 #define CHUNKID "RIFF"          // String
@@ -124,10 +135,201 @@ const char *get_filename_extension(const char* fileName) {
   return dot + 1;                            // Advance to the string that follows "."
 }
 
+// Opens a .wav file and reads its header. Exits with an error message if the
+// file is missing or is not a mono, 16-bit PCM file. The returned file is
+// positioned at the first sample.
+FILE* openWaveFile(const char* fileName, waveFileHeader_t* header) {
+  if (strncmp(get_filename_extension(fileName), WAV_SUFFIX, MAX_FILENAME_LENGTH)) {
+    fprintf(stderr, "ERROR: input file-name \"%s\" does not have a %s suffix.\n", fileName, WAV_SUFFIX);
+    exit(-1);
+  }
+  FILE* fp = fopen(fileName, "rb");
+  if (fp == NULL) {
+    fprintf(stderr, "unable to find file:%s\n", fileName);
+    exit(-1);
+  }
+  readWaveFileHeader(fp, header);
+  if (!waveFileHeaderOk(stderr, header)) {
+    fprintf(stderr, "ERROR: Input file (%s) contains errors. Maybe not a .wav file? See proceeding messages for details.\n", fileName);
+    printWaveFileHeader(stderr, header);
+    exit(-1);
+  }
+  if (header->numChannels > 1 || header->bitsPerSample != SUPPORTED_WAVE_DATA_BIT_SIZE) {
+    fprintf(stderr, "ERROR: %s must contain monophonic %d-bit data. Exiting...\n", fileName, SUPPORTED_WAVE_DATA_BIT_SIZE);
+    exit(-1);
+  }
+  return fp;
+}
+
+// Reads all of the (signed 16-bit) samples that follow the header.
+// Returns a malloc()ed buffer and the number of samples in sampleCount.
+int16_t* readWaveSamples(FILE* wavFp, waveFileHeader_t* header, uint32_t* sampleCount) {
+  *sampleCount = header->subchunk2Size / 2;  // Wave file is counted in bytes.
+  int16_t* samples = malloc(*sampleCount * sizeof(int16_t) + 1);
+  if (!samples) {
+    fprintf(stderr, "ERROR: out of memory.\n");
+    exit(-1);
+  }
+  *sampleCount = fread(samples, sizeof(int16_t), *sampleCount, wavFp);
+  return samples;
+}
+
+// Low-pass filters the samples and keeps every (inRate/outRate)th one.
+// Speech does not need 48 kHz, and lower rates save a lot of flash. The
+// firmware interpolates back up to 48 kHz when it plays the sound.
+// Only integer decimation factors are supported. Replaces samples and
+// sampleCount with the resampled data.
+void resampleWave(int16_t** samples, uint32_t* sampleCount, uint32_t inRate, uint32_t outRate) {
+  if (outRate == KEEP_SAMPLE_RATE || outRate == inRate)
+    return;
+  if (outRate > inRate || inRate % outRate) {
+    fprintf(stderr, "ERROR: can only resample %d Hz to an integer fraction of it, not %d Hz.\n", inRate, outRate);
+    exit(-1);
+  }
+  uint32_t factor = inRate / outRate;
+  int32_t tapCount = ANTI_ALIAS_TAPS_PER_FACTOR * factor + 1;
+  int32_t center = tapCount / 2;
+  double cutoff = ANTI_ALIAS_PASSBAND * 0.5 / factor;  // Cycles per input sample.
+  double* taps = malloc(tapCount * sizeof(double));
+  uint32_t outCount = (*sampleCount + factor - 1) / factor;
+  int16_t* out = malloc(outCount * sizeof(int16_t) + 1);
+  if (!taps || !out) {
+    fprintf(stderr, "ERROR: out of memory.\n");
+    exit(-1);
+  }
+  // Windowed sinc, normalized for unity gain at DC.
+  double tapSum = 0.0;
+  for (int32_t k = 0; k < tapCount; k++) {
+    int32_t n = k - center;
+    double sinc = n ? sin(2.0 * M_PI * cutoff * n) / (M_PI * n) : 2.0 * cutoff;
+    double window = 0.42 - 0.5 * cos(2.0 * M_PI * k / (tapCount - 1)) + 0.08 * cos(4.0 * M_PI * k / (tapCount - 1));
+    taps[k] = sinc * window;
+    tapSum += taps[k];
+  }
+  // The filter is centered on each kept sample so the clip is not delayed.
+  // Samples outside of the clip are treated as silence.
+  for (uint32_t m = 0; m < outCount; m++) {
+    double sum = 0.0;
+    for (int32_t k = 0; k < tapCount; k++) {
+      int64_t index = (int64_t)m * factor + center - k;
+      if (index >= 0 && index < *sampleCount)
+        sum += taps[k] * (*samples)[index];
+    }
+    sum = round(sum / tapSum);
+    out[m] = sum > INT16_MAX ? INT16_MAX : (sum < INT16_MIN ? INT16_MIN : sum);
+  }
+  free(taps);
+  free(*samples);
+  *samples = out;
+  *sampleCount = outCount;
+}
+
+// The pack entry name is the file-name without any path or suffix.
+void packEntryName(const char* fileName, char name[SOUND_PACK_NAME_SIZE]) {
+  const char* slash = strrchr(fileName, '/');
+  const char* base = slash ? slash + 1 : fileName;
+  size_t length = strcspn(base, ".");
+  if (length >= SOUND_PACK_NAME_SIZE) {
+    fprintf(stderr, "ERROR: \"%s\" is too long for a pack entry name (max %d chars).\n", base, SOUND_PACK_NAME_SIZE - 1);
+    exit(-1);
+  }
+  memset(name, 0, SOUND_PACK_NAME_SIZE);  // Keeps the pack contents deterministic.
+  memcpy(name, base, length);
+}
+
+// Packs all of the .wav files into a single binary sound pack (see soundPack.h).
+// Samples are stored exactly as the generated .c arrays store them.
+// "-rate N" in the list resamples the files that follow it to N Hz
+// ("-rate 0" goes back to keeping the original rate).
+int writeSoundPack(const char* packFileName, int argCount, char* args[]) {
+  soundPack_entry_t* entries = calloc(argCount, sizeof(soundPack_entry_t));
+  int16_t** samples = calloc(argCount, sizeof(int16_t*));
+  if (!entries || !samples) {
+    fprintf(stderr, "ERROR: out of memory.\n");
+    exit(-1);
+  }
+  // Pull out the -rate options, remembering the rate for each file.
+  char** wavFileNames = calloc(argCount, sizeof(char*));
+  uint32_t* rates = calloc(argCount, sizeof(uint32_t));
+  uint32_t rate = KEEP_SAMPLE_RATE;
+  int wavFileCount = 0;
+  for (int i = 0; i < argCount; i++) {
+    if (!strcmp(args[i], RATE_OPTION) && i + 1 < argCount) {
+      rate = strtoul(args[++i], NULL, 10);
+      continue;
+    }
+    rates[wavFileCount] = rate;
+    wavFileNames[wavFileCount++] = args[i];
+  }
+  soundPack_header_t header = {SOUND_PACK_MAGIC, SOUND_PACK_VERSION, wavFileCount, 0};
+  // Clip data start right after the index.
+  uint32_t offset = sizeof(soundPack_header_t) + wavFileCount * sizeof(soundPack_entry_t);
+  for (int i = 0; i < wavFileCount; i++) {
+    waveFileHeader_t waveHeader;
+    FILE* wavFp = openWaveFile(wavFileNames[i], &waveHeader);
+    packEntryName(wavFileNames[i], entries[i].name);
+    for (int j = 0; j < i; j++) {
+      if (!strncmp(entries[j].name, entries[i].name, SOUND_PACK_NAME_SIZE)) {
+        fprintf(stderr, "ERROR: %s appears twice in the pack.\n", entries[i].name);
+        exit(-1);
+      }
+    }
+    uint32_t sampleCount;
+    samples[i] = readWaveSamples(wavFp, &waveHeader, &sampleCount);
+    fclose(wavFp);
+    resampleWave(&samples[i], &sampleCount, waveHeader.sampleRate, rates[i]);
+    uint32_t sampleRate = rates[i] == KEEP_SAMPLE_RATE ? waveHeader.sampleRate : rates[i];
+    offset = (offset + SOUND_PACK_DATA_ALIGNMENT - 1) & ~(SOUND_PACK_DATA_ALIGNMENT - 1);
+    entries[i].sampleRate = sampleRate;
+    entries[i].sampleCount = sampleCount;
+    entries[i].encoding = soundPack_pcm16Unsigned_e;
+    entries[i].bitsPerSample = waveHeader.bitsPerSample;
+    entries[i].offset = offset;
+    offset += sampleCount * sizeof(uint16_t);
+    fprintf(stderr, "%-24s %8d samples at %d Hz, offset %d\n", entries[i].name, sampleCount, sampleRate, entries[i].offset);
+  }
+  header.packSize = offset;
+  FILE* packFp = fopen(packFileName, "wb");
+  if (!packFp) {
+    fprintf(stderr, "Unable to open file: %s for writing.\n", packFileName);
+    exit(-1);
+  }
+  fwrite(&header, sizeof(header), 1, packFp);
+  fwrite(entries, sizeof(soundPack_entry_t), wavFileCount, packFp);
+  for (int i = 0; i < wavFileCount; i++) {
+    while (ftell(packFp) < entries[i].offset)  // Pad up to the aligned offset.
+      fputc(0, packFp);
+    for (uint32_t j = 0; j < entries[i].sampleCount; j++) {
+      uint16_t data = samples[i][j] + INT16_MAX;  // Offset to unsigned for the sound CODEC.
+      fwrite(&data, sizeof(data), 1, packFp);
+    }
+    free(samples[i]);
+  }
+  fclose(packFp);
+  fprintf(stderr, "Wrote %d sounds (%d bytes) to %s\n", wavFileCount, header.packSize, packFileName);
+  free(samples);
+  free(entries);
+  free(wavFileNames);
+  free(rates);
+  return 0;
+}
+
 int main(int argc, char* argv[]) {
+  // Pack mode bundles all of the .wav files into a single binary sound pack.
+  if (argc >= PACK_MIN_ARG_COUNT && !strcmp(argv[1], PACK_OPTION)) {
+    return writeSoundPack(argv[2], argc - 3, &argv[3]);
+  }
+  // Optionally resample to a lower rate, e.g., wav2c -rate 16000 speech.wav.
+  uint32_t outputRate = KEEP_SAMPLE_RATE;
+  if (argc == 4 && !strcmp(argv[1], RATE_OPTION)) {
+    outputRate = strtoul(argv[2], NULL, 10);
+    argc -= 2;
+    argv += 2;
+  }
   // Print a helpful error message and exit if a file-name was not provided on the command line.
   if (argc != 2) {
-    fprintf(stderr, "Usage: wav2c filename.wav\n");
+    fprintf(stderr, "Usage: wav2c [%s rate] filename.wav\n", RATE_OPTION);
+    fprintf(stderr, "       wav2c %s output.pak [%s rate] file1.wav [file2.wav ...]\n", PACK_OPTION, RATE_OPTION);
     exit(-1);
   }
   char inputFileName[MAX_FILENAME_LENGTH];         // Create a working buffer.
@@ -166,14 +368,23 @@ int main(int argc, char* argv[]) {
     exit(-1);
   }
   printWaveFileHeader(stderr, &header);
+  // Read all of the samples and resample them if asked to.
+  uint32_t sampleCount;
+  int16_t* samples = readWaveSamples(inputFileFp, &header, &sampleCount);
+  resampleWave(&samples, &sampleCount, header.sampleRate, outputRate);
+  uint32_t sampleRate = outputRate == KEEP_SAMPLE_RATE ? header.sampleRate : outputRate;
+  // Remember how wav2c was called so the comment in the generated files is accurate.
+  char commandLine[MAX_FILENAME_LENGTH];
+  if (outputRate == KEEP_SAMPLE_RATE)
+    snprintf(commandLine, MAX_FILENAME_LENGTH, "wav2c %s", inputFileName);
+  else
+    snprintf(commandLine, MAX_FILENAME_LENGTH, "wav2c %s %d %s", RATE_OPTION, outputRate, inputFileName);
   // Everything looks good. Go ahead and generate the .h and .c files. Exit with an error if either file already exists.
   // First, open the .h file and output the necessary declarations. Then, close the .h file.
   char hFileName[MAX_FILENAME_LENGTH];                     // .h file-name.
-  strncpy(hFileName, inputFileName, MAX_FILENAME_LENGTH);  // Basename is just the input-file-name.
-  strncat(hFileName, H_FILE_SUFFIX, MAX_FILENAME_LENGTH);  // Add the suffix.
+  snprintf(hFileName, MAX_FILENAME_LENGTH, "%s%s", inputFileName, H_FILE_SUFFIX);  // Input-file-name plus the suffix.
   char cFileName[MAX_FILENAME_LENGTH];                     // .c file-name. 
-  strncpy(cFileName, inputFileName, MAX_FILENAME_LENGTH);  // Basename is just the input-file-name.
-  strncat(cFileName, C_FILE_SUFFIX, MAX_FILENAME_LENGTH);  // Add the suffix.
+  snprintf(cFileName, MAX_FILENAME_LENGTH, "%s%s", inputFileName, C_FILE_SUFFIX);  // Input-file-name plus the suffix.
 
   FILE* hFileFp = fopen(hFileName, "r");
   FILE* cFileFp = fopen(cFileName, "r");
@@ -207,28 +418,25 @@ int main(int argc, char* argv[]) {
   arrayNameUpperCase[i+1] = '\0';  // Make sure to terminate the string.
  
   // .h file just needs a comment and an extern statement.
-  fprintf(hFileFp, "// This file was generated by executing this statement: wav2c %s\n", inputFileName);
-  fprintf(hFileFp, "%s uint16_t %s[];\n", EXTERN_STATEMENT, arrayName);
-  fprintf(hFileFp, "#define %s_SAMPLE_RATE %d\n", arrayNameUpperCase, header.sampleRate*10);
+  fprintf(hFileFp, "// This file was generated by executing this statement: %s\n", commandLine);
+  fprintf(hFileFp, "%s %s %s[];\n", EXTERN_STATEMENT, C_DATA_TYPE, arrayName);
+  fprintf(hFileFp, "#define %s_SAMPLE_RATE %d\n", arrayNameUpperCase, sampleRate);
   fprintf(hFileFp, "#define %s_BITS_PER_SAMPLE %d\n", arrayNameUpperCase, header.bitsPerSample);
-  fprintf(hFileFp, "#define %s_NUMBER_OF_SAMPLES %d\n", arrayNameUpperCase, header.subchunk2Size/2);
+  fprintf(hFileFp, "#define %s_NUMBER_OF_SAMPLES %d\n", arrayNameUpperCase, sampleCount);
   fclose(hFileFp);
   // .c file will contain the data in array form as follows.
-  uint32_t arraySize = header.subchunk2Size/2;  // Wave file is counted by bytes, output file is counted in 16-bit words.
   // Write some helpful comments to the .c file.
-  fprintf(cFileFp, "// This file was generated by executing this statement: wav2c %s\n", inputFileName);
+  fprintf(cFileFp, "// This file was generated by executing this statement: %s\n", commandLine);
   fprintf(cFileFp, "\n#include <stdint.h>\n\n");
-  fprintf(cFileFp, "%s %s[%d] = {\n", C_DATA_TYPE, arrayName, arraySize);
-  // File pointer to the input file should be pointing at the first value after the header is read, so just start from there.
-  for (i=0; i<header.subchunk2Size/2; i++) {
-    int16_t data;  // Program only handles 16-bit PCM data for now. PCM data is signed.
-    fread(&data, header.blockAlign, 1, inputFileFp);  // Read 2 bytes into a signed 16-bit variable.
-    uint16_t unsignedData = data + INT16_MAX;         // Offset to unsigned for the sound CODEC.
+  fprintf(cFileFp, "%s %s[%d] = {\n", C_DATA_TYPE, arrayName, sampleCount);
+  for (i=0; i<sampleCount; i++) {
+    uint16_t unsignedData = samples[i] + INT16_MAX;   // Offset to unsigned for the sound CODEC.
     fprintf(cFileFp, "%d", unsignedData);             // Write the unsiged data.
-    if (i != (header.subchunk2Size/2)-1)              // Don't place the last comma.
+    if (i != sampleCount-1)                           // Don't place the last comma.
       fprintf(cFileFp, ",\n");                        // Delimited data.
   }
   fprintf(cFileFp, "\n};\n");  // Close the array.
   fclose(cFileFp);             // Close the .h file.
   fclose(inputFileFp);         // Close the input file.
+  free(samples);
 }
@@ -0,0 +1,291 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "spectrum.h"
+
+#define PI 3.14159265358979323846
+#define RADIX_4 4
+#define HZ_PER_KHZ 1000.0
+// One side of the spectrum holds half the power of a real signal.
+#define ONE_SIDED 2.0
+
+// The ten user frequencies, in Hz.
+static double userFrequencyHz(uint16_t frequencyNumber) {
+  return FILTER_SAMPLE_FREQUENCY_IN_KHZ * HZ_PER_KHZ /
+         filter_frequencyTickTable[frequencyNumber];
+}
+
+// The bands of the ten user frequencies.
+static void setUserBands(spectrum_ctx_t *ctx) {
+  uint16_t halfWidth = (uint16_t)(SPECTRUM_BAND_HALF_WIDTH_HZ * ctx->size /
+                                      SPECTRUM_SAMPLE_RATE +
+                                  0.5);
+  if (halfWidth < 1)
+    halfWidth = 1;
+  for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++) {
+    uint16_t bin = spectrum_ctxGetBin(ctx, userFrequencyHz(i));
+    ctx->bands[i] = (spectrum_band_t){.firstBin = bin - halfWidth,
+                                      .lastBin = bin + halfWidth};
+    ctx->bandPowers[i] = 0;
+  }
+  ctx->bandCount = FILTER_FREQUENCY_COUNT;
+}
+
+// Fills the tables that do not change with the input: the window, the
+// bit-reversed order of the complex points, the twiddle factors of each
+// radix-2 pass (for the pass with half-length h, entries h to 2h - 1) and
+// those that split the real spectrum out of the complex one.
+static void makeTables(spectrum_ctx_t *ctx) {
+  uint16_t size = ctx->size;
+  uint16_t points = size / 2;
+  double windowSquares = 0;
+  for (uint16_t i = 0; i < size; i++) {
+    ctx->window[i] = 0.5 - 0.5 * cos(2 * PI * i / size);
+    ctx->input[i] = 0;
+    windowSquares += ctx->window[i] * ctx->window[i];
+  }
+  // The band's share of sum((window * x)^2), over the window's own mean
+  // square, is its power over size outputs; stretched to a pulse width.
+  ctx->scale = ONE_SIDED / windowSquares * FILTER_INPUT_PULSE_WIDTH / size;
+  uint16_t bits = 0;
+  while ((1u << bits) < points)
+    bits++;
+  for (uint16_t i = 0; i < points; i++) {
+    uint16_t reversed = 0;
+    for (uint16_t b = 0; b < bits; b++)
+      reversed |= ((i >> b) & 1) << (bits - 1 - b);
+    ctx->bitReverse[i] = reversed;
+    ctx->splitCos[i] = cos(2 * PI * i / size);
+    ctx->splitSin[i] = sin(2 * PI * i / size);
+  }
+  for (uint16_t half = 1; half < points; half *= 2) {
+    for (uint16_t j = 0; j < half; j++) {
+      ctx->passCos[half + j] = cos(PI * j / half);
+      ctx->passSin[half + j] = sin(PI * j / half);
+    }
+  }
+}
+
+// Sets up an FFT of size points every hop FIR outputs.
+bool spectrum_ctxInit(spectrum_ctx_t *ctx, uint16_t size, uint16_t hop) {
+  if (size < SPECTRUM_MIN_SIZE || size > SPECTRUM_MAX_SIZE ||
+      (size & (size - 1)) || hop < 1 || hop > size) {
+    printf("spectrum: size %u or hop %u out of range.\n", size, hop);
+    return false;
+  }
+  uint16_t points = size / 2;
+  ctx->size = size;
+  ctx->hop = hop;
+  ctx->sinceLast = 0;
+  ctx->inputIndex = 0;
+  ctx->fftCount = 0;
+  ctx->input = malloc(size * sizeof(double));
+  ctx->window = malloc(size * sizeof(double));
+  ctx->re = malloc(points * sizeof(double));
+  ctx->im = malloc(points * sizeof(double));
+  ctx->passCos = malloc(points * sizeof(double));
+  ctx->passSin = malloc(points * sizeof(double));
+  ctx->splitCos = malloc(points * sizeof(double));
+  ctx->splitSin = malloc(points * sizeof(double));
+  ctx->bitReverse = malloc(points * sizeof(uint16_t));
+  ctx->spectrum = calloc(points + 1, sizeof(double));
+  if (!ctx->input || !ctx->window || !ctx->re || !ctx->im || !ctx->passCos ||
+      !ctx->passSin || !ctx->splitCos || !ctx->splitSin || !ctx->bitReverse ||
+      !ctx->spectrum) {
+    printf("spectrum: unable to allocate an FFT of %u points.\n", size);
+    spectrum_ctxFree(ctx);
+    return false;
+  }
+  makeTables(ctx);
+  setUserBands(ctx);
+  return true;
+}
+
+// Frees the arrays allocated by spectrum_ctxInit().
+void spectrum_ctxFree(spectrum_ctx_t *ctx) {
+  free(ctx->input);
+  free(ctx->window);
+  free(ctx->re);
+  free(ctx->im);
+  free(ctx->passCos);
+  free(ctx->passSin);
+  free(ctx->splitCos);
+  free(ctx->splitSin);
+  free(ctx->bitReverse);
+  free(ctx->spectrum);
+  ctx->input = ctx->window = ctx->re = ctx->im = NULL;
+  ctx->passCos = ctx->passSin = ctx->splitCos = ctx->splitSin = NULL;
+  ctx->bitReverse = NULL;
+  ctx->spectrum = NULL;
+}
+
+// The first two passes at once: radix-4 butterflies on four points in
+// bit-reversed order, whose twiddle factors are 1 and -i.
+static void radix4Pass(double *restrict re, double *restrict im,
+                       uint16_t points) {
+  for (uint16_t a = 0; a < points; a += RADIX_4) {
+    double r0 = re[a] + re[a + 1], i0 = im[a] + im[a + 1];
+    double r1 = re[a] - re[a + 1], i1 = im[a] - im[a + 1];
+    double r2 = re[a + 2] + re[a + 3], i2 = im[a + 2] + im[a + 3];
+    double r3 = re[a + 2] - re[a + 3], i3 = im[a + 2] - im[a + 3];
+    re[a] = r0 + r2;
+    im[a] = i0 + i2;
+    re[a + 2] = r0 - r2;
+    im[a + 2] = i0 - i2;
+    // -i * (r3 + i i3) = i3 - i r3.
+    re[a + 1] = r1 + i3;
+    im[a + 1] = i1 - r3;
+    re[a + 3] = r1 - i3;
+    im[a + 3] = i1 + r3;
+  }
+}
+
+// One radix-2 pass joining transforms of half points into ones of 2 * half.
+// The twiddle factors for this pass are in order, so the inner loop reads
+// everything sequentially.
+static void radix2Pass(double *restrict re, double *restrict im,
+                       const double *restrict twiddleCos,
+                       const double *restrict twiddleSin, uint16_t points,
+                       uint16_t half) {
+  for (uint16_t start = 0; start < points; start += 2 * half) {
+    double *restrict re0 = re + start;
+    double *restrict im0 = im + start;
+    double *restrict re1 = re0 + half;
+    double *restrict im1 = im0 + half;
+    for (uint16_t j = 0; j < half; j++) {
+      // Times e^(-i pi j / half).
+      double tr = re1[j] * twiddleCos[j] + im1[j] * twiddleSin[j];
+      double ti = im1[j] * twiddleCos[j] - re1[j] * twiddleSin[j];
+      re1[j] = re0[j] - tr;
+      im1[j] = im0[j] - ti;
+      re0[j] += tr;
+      im0[j] += ti;
+    }
+  }
+}
+
+// Complex FFT of re[] and im[], in place. The points come in bit-reversed
+// order (see spectrum_ctxCompute()).
+static void fft(spectrum_ctx_t *ctx) {
+  uint16_t points = ctx->size / 2;
+  radix4Pass(ctx->re, ctx->im, points);
+  for (uint16_t half = RADIX_4; half < points; half *= 2)
+    radix2Pass(ctx->re, ctx->im, ctx->passCos + half, ctx->passSin + half,
+               points, half);
+}
+
+// Splits the real spectrum out of the complex one: with Z the FFT of the even
+// and odd inputs as real and imaginary parts, E = (Z[k] + conj(Z[n - k])) / 2
+// and O = (Z[k] - conj(Z[n - k])) / 2i are the FFTs of the even and of the odd
+// inputs, and X[k] = E + e^(-2 pi i k / size) O.
+static void splitSpectrum(spectrum_ctx_t *ctx) {
+  uint16_t points = ctx->size / 2;
+  const double *re = ctx->re;
+  const double *im = ctx->im;
+  double *spectrum = ctx->spectrum;
+  spectrum[0] = (re[0] + im[0]) * (re[0] + im[0]) * ctx->scale;
+  spectrum[points] = (re[0] - im[0]) * (re[0] - im[0]) * ctx->scale;
+  for (uint16_t k = 1; k < points; k++) {
+    uint16_t m = points - k;
+    double evr = (re[k] + re[m]) / 2, evi = (im[k] - im[m]) / 2;
+    double odr = (im[k] + im[m]) / 2, odi = (re[m] - re[k]) / 2;
+    double c = ctx->splitCos[k], s = ctx->splitSin[k];
+    double xr = evr + odr * c + odi * s;
+    double xi = evi + odi * c - odr * s;
+    spectrum[k] = (xr * xr + xi * xi) * ctx->scale;
+  }
+}
+
+// Runs the FFT on the newest size FIR outputs.
+void spectrum_ctxCompute(spectrum_ctx_t *ctx) {
+  uint16_t points = ctx->size / 2;
+  uint16_t mask = ctx->size - 1;
+  // Input i of the window is the (inputIndex + i)-th of the ring. The even
+  // ones are the real parts, the odd ones the imaginary parts.
+  for (uint16_t i = 0; i < points; i++) {
+    uint16_t n = 2 * ctx->bitReverse[i];
+    ctx->re[i] = ctx->input[(ctx->inputIndex + n) & mask] * ctx->window[n];
+    ctx->im[i] =
+        ctx->input[(ctx->inputIndex + n + 1) & mask] * ctx->window[n + 1];
+  }
+  fft(ctx);
+  splitSpectrum(ctx);
+  for (uint16_t b = 0; b < ctx->bandCount; b++) {
+    double power = 0;
+    for (uint16_t k = ctx->bands[b].firstBin; k <= ctx->bands[b].lastBin; k++)
+      power += ctx->spectrum[k];
+    ctx->bandPowers[b] = power;
+  }
+  ctx->fftCount++;
+}
+
+// Adds the newest FIR output, and runs the FFT every hop outputs.
+bool spectrum_ctxAddSample(spectrum_ctx_t *ctx, double firOutput) {
+  ctx->input[ctx->inputIndex] = firOutput;
+  ctx->inputIndex = (ctx->inputIndex + 1) & (ctx->size - 1);
+  if (++ctx->sinceLast < ctx->hop)
+    return false;
+  ctx->sinceLast = 0;
+  spectrum_ctxCompute(ctx);
+  return true;
+}
+
+// The bin nearest to a frequency.
+uint16_t spectrum_ctxGetBin(spectrum_ctx_t *ctx, double hz) {
+  double bin = hz * ctx->size / SPECTRUM_SAMPLE_RATE + 0.5;
+  return bin < 0 ? 0 : bin > ctx->size / 2 ? ctx->size / 2 : (uint16_t)bin;
+}
+
+// Replaces the bands.
+bool spectrum_ctxSetBands(spectrum_ctx_t *ctx, const spectrum_band_t bands[],
+                          uint16_t bandCount) {
+  if (bandCount > SPECTRUM_MAX_BANDS) {
+    printf("spectrum: at most %d bands.\n", SPECTRUM_MAX_BANDS);
+    return false;
+  }
+  for (uint16_t b = 0; b < bandCount; b++) {
+    if (bands[b].firstBin > bands[b].lastBin ||
+        bands[b].lastBin > ctx->size / 2) {
+      printf("spectrum: band %u is outside the spectrum.\n", b);
+      return false;
+    }
+  }
+  for (uint16_t b = 0; b < bandCount; b++) {
+    ctx->bands[b] = bands[b];
+    ctx->bandPowers[b] = 0;
+  }
+  ctx->bandCount = bandCount;
+  return true;
+}
+
+// Copies the power of every band into powers[].
+void spectrum_ctxGetBandPowers(spectrum_ctx_t *ctx, double powers[]) {
+  for (uint16_t b = 0; b < ctx->bandCount; b++)
+    powers[b] = ctx->bandPowers[b];
+}
+
+// Stores the power of the first ten bands in the filter context.
+void spectrum_ctxSetFilterPowers(spectrum_ctx_t *ctx, filter_ctx_t *filter) {
+  for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT && i < ctx->bandCount; i++)
+    filter_ctxSetCurrentPowerValue(filter, i, ctx->bandPowers[i]);
+}
+
+// The spectrum from the last FFT.
+const double *spectrum_ctxGetSpectrum(spectrum_ctx_t *ctx) {
+  return ctx->spectrum;
+}
+
+// Bins in the spectrum.
+uint16_t spectrum_ctxGetBinCount(spectrum_ctx_t *ctx) {
+  return ctx->size / 2 + 1;
+}
@@ -0,0 +1,112 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef SPECTRUM_H_
+#define SPECTRUM_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "filter.h"
+
+// A block-mode alternative to the IIR filter bank: every hop FIR outputs, a
+// Hann-windowed real FFT of the newest size FIR outputs (10 kHz, so 256
+// points are 25.6 ms and 4096 are 410 ms). It gives the power of any set of
+// bands, not just the ten user frequencies, and the whole spectrum, e.g. for
+// histogram_plotSpectrum(). The FFT is done in place on size / 2 complex
+// points (the even and odd inputs as real and imaginary parts): a radix-4
+// first pass, then radix-2 passes whose twiddle factors are stored pass by
+// pass so that the butterfly loops read memory in order and can be
+// vectorized by the compiler. No other library is needed.
+//
+// Powers are scaled to the units of filter_computePower(): the sum of the
+// squares of the band's part of the signal over a FILTER_INPUT_PULSE_WIDTH
+// window. Bands 0 to 9 start out as the ten user frequencies, so that
+// spectrum_ctxSetFilterPowers() can stand in for the IIR filters in front of
+// hit detection (see detector_ctxSetSpectrum()).
+
+#define SPECTRUM_MIN_SIZE 256
+#define SPECTRUM_MAX_SIZE 4096
+#define SPECTRUM_SAMPLE_RATE                                                   \
+  (FILTER_SAMPLE_FREQUENCY_IN_KHZ * 1000 / FILTER_FIR_DECIMATION_FACTOR)
+#define SPECTRUM_MAX_BANDS 32
+// The user frequency bands reach this far either side of the frequency, and
+// at least one bin.
+#define SPECTRUM_BAND_HALF_WIDTH_HZ 50
+
+// Bins firstBin to lastBin, both included, of the size / 2 + 1 in the
+// spectrum. Bin k is k * SPECTRUM_SAMPLE_RATE / size Hz.
+typedef struct {
+  uint16_t firstBin;
+  uint16_t lastBin;
+} spectrum_band_t;
+
+// Everything one FFT engine needs between samples. The arrays are allocated
+// by spectrum_ctxInit() for its size.
+typedef struct {
+  uint16_t size;      // FFT points, a power of two.
+  uint16_t hop;       // FIR outputs between FFTs.
+  uint16_t sinceLast; // FIR outputs since the last FFT.
+  uint16_t inputIndex; // Where the next FIR output goes in input[].
+  double scale;       // From |X[k]|^2 to power.
+  double *input;      // The newest size FIR outputs, a ring.
+  double *window;     // Hann window.
+  double *re;         // size / 2 complex points, in place.
+  double *im;
+  double *passCos;    // Twiddle factors of the radix-2 passes.
+  double *passSin;
+  double *splitCos;   // Twiddle factors that split the real spectrum.
+  double *splitSin;
+  uint16_t *bitReverse;
+  double *spectrum;   // size / 2 + 1 bins.
+  spectrum_band_t bands[SPECTRUM_MAX_BANDS];
+  double bandPowers[SPECTRUM_MAX_BANDS];
+  uint16_t bandCount;
+  uint32_t fftCount;
+} spectrum_ctx_t;
+
+// Allocates the arrays of a context for an FFT of size points (a power of
+// two from SPECTRUM_MIN_SIZE to SPECTRUM_MAX_SIZE) every hop FIR outputs
+// (1 to size), with the ten user frequency bands and the input all zeros.
+// Returns false if the size or hop is out of range or there is no memory.
+// Call spectrum_ctxFree() before initializing the same context again.
+bool spectrum_ctxInit(spectrum_ctx_t *ctx, uint16_t size, uint16_t hop);
+
+// Frees the arrays allocated by spectrum_ctxInit().
+void spectrum_ctxFree(spectrum_ctx_t *ctx);
+
+// Adds the newest FIR output. Every hop outputs it runs the FFT and updates
+// the spectrum and the band powers, and returns true.
+bool spectrum_ctxAddSample(spectrum_ctx_t *ctx, double firOutput);
+
+// Runs the FFT on the newest size FIR outputs now.
+void spectrum_ctxCompute(spectrum_ctx_t *ctx);
+
+// The bin nearest to a frequency in Hz.
+uint16_t spectrum_ctxGetBin(spectrum_ctx_t *ctx, double hz);
+
+// Replaces the bands. Returns false if there are more than
+// SPECTRUM_MAX_BANDS or a band is outside the spectrum.
+bool spectrum_ctxSetBands(spectrum_ctx_t *ctx, const spectrum_band_t bands[],
+                          uint16_t bandCount);
+
+// Copies the power of every band, from the last FFT, into powers[].
+void spectrum_ctxGetBandPowers(spectrum_ctx_t *ctx, double powers[]);
+
+// Stores the power of bands 0 to FILTER_FREQUENCY_COUNT - 1 as the current
+// power values of a filter context (filter_ctxSetCurrentPowerValue()), where
+// hit detection and filter_getCurrentPowerValues() find them.
+void spectrum_ctxSetFilterPowers(spectrum_ctx_t *ctx, filter_ctx_t *filter);
+
+// The spectrum from the last FFT, size / 2 + 1 powers from 0 Hz to
+// SPECTRUM_SAMPLE_RATE / 2, in the same units as the bands.
+const double *spectrum_ctxGetSpectrum(spectrum_ctx_t *ctx);
+uint16_t spectrum_ctxGetBinCount(spectrum_ctx_t *ctx);
+
+#endif /* SPECTRUM_H_ */
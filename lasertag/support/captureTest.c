@@ -0,0 +1,153 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "capture.h"
+#include "captureTest.h"
+
+#define TEST_BUFFER_SIZE 65536
+#define TEST_SAMPLE_COUNT 10000
+#define TEST_SAMPLE_MASK 0x0fff
+#define TEST_TRIGGER_AT 1000
+#define TEST_HIT_AT 5000
+#define TEST_FREQUENCY 4
+#define TEST_DROP_COUNT 100
+#define TEST_RESUME_COUNT 10
+
+static uint8_t testBuffer[TEST_BUFFER_SIZE];
+static uint32_t testBufferSize;
+
+// Capture sink, appends to testBuffer.
+static bool memorySink(const uint8_t *data, uint32_t size) {
+  if (testBufferSize + size > TEST_BUFFER_SIZE)
+    return false;
+  memcpy(testBuffer + testBufferSize, data, size);
+  testBufferSize += size;
+  return true;
+}
+
+static uint64_t getLittle(const uint8_t *bytes, uint8_t size) {
+  uint64_t value = 0;
+  for (uint8_t i = size; i > 0; i--)
+    value = value << 8 | bytes[i - 1];
+  return value;
+}
+
+// Unpacks sample number i of a samples chunk payload.
+static uint16_t getSample(const uint8_t *payload, uint32_t i) {
+  const uint8_t *pair = payload + i / 2 * 3;
+  return i % 2 ? (pair[1] >> 4 | pair[2] << 4)
+               : (pair[0] | (pair[1] & 0x0f) << 8);
+}
+
+// The sample the tests record at an index.
+static uint16_t testSample(uint32_t index) {
+  return (index * 7) & TEST_SAMPLE_MASK;
+}
+
+// Walks the chunks in testBuffer and checks every sample against
+// testSample(). Counts the samples and the markers of a type, and returns the
+// first index of the last samples chunk. Returns false on a bad capture.
+static bool readCapture(uint32_t *sampleCount, uint64_t *lastChunkFirst,
+                        capture_markerType_t markerType, uint64_t *markerAt) {
+  if (testBufferSize < CAPTURE_HEADER_SIZE ||
+      memcmp(testBuffer, "LTCP", 4) ||
+      getLittle(testBuffer + 4, 2) != CAPTURE_VERSION ||
+      getLittle(testBuffer + 8, 4) != CAPTURE_SAMPLE_RATE)
+    return false;
+  *sampleCount = 0;
+  for (uint32_t offset = CAPTURE_HEADER_SIZE; offset < testBufferSize;) {
+    const uint8_t *chunk = testBuffer + offset;
+    uint16_t count = getLittle(chunk + 2, 2);
+    uint32_t size = getLittle(chunk + 4, 4);
+    uint64_t first = getLittle(chunk + 8, 8);
+    const uint8_t *payload = chunk + CAPTURE_CHUNK_HEADER_SIZE;
+    if (chunk[0] == capture_samplesChunk_e) {
+      for (uint32_t i = 0; i < count; i++)
+        if (getSample(payload, i) != testSample(first + i))
+          return false;
+      *sampleCount += count;
+      *lastChunkFirst = first;
+    } else if (chunk[0] == capture_markersChunk_e) {
+      for (uint32_t i = 0; i < count; i++) {
+        const uint8_t *marker = payload + i * CAPTURE_MARKER_SIZE;
+        if (marker[8] == markerType && marker[9] == TEST_FREQUENCY)
+          *markerAt = getLittle(marker, 8);
+      }
+    }
+    offset += CAPTURE_CHUNK_HEADER_SIZE + size;
+  }
+  return true;
+}
+
+// Records samples and markers into memory and reads them back.
+bool capture_runTest(void) {
+  printf("****************** capture_runTest() ******************\n");
+  bool success = true;
+  uint32_t sampleCount;
+  uint64_t lastChunkFirst = 0;
+  uint64_t triggerAt = 0;
+  uint64_t hitAt = 0;
+
+  // Test 1: every sample and both kinds of markers come back, at the right
+  // sample index.
+  testBufferSize = 0;
+  capture_start(memorySink);
+  for (uint32_t i = 0; i < TEST_SAMPLE_COUNT; i++) {
+    if (i == TEST_TRIGGER_AT)
+      capture_isrMark(capture_triggerMarker_e, TEST_FREQUENCY);
+    if (i == TEST_HIT_AT)
+      capture_mark(capture_hitMarker_e, TEST_FREQUENCY);
+    capture_isrSample(testSample(i));
+    if (i % CAPTURE_CHUNK_SAMPLES == 0)
+      capture_poll();
+  }
+  capture_stop();
+  if (!readCapture(&sampleCount, &lastChunkFirst, capture_triggerMarker_e,
+                   &triggerAt) ||
+      sampleCount != TEST_SAMPLE_COUNT || triggerAt != TEST_TRIGGER_AT) {
+    printf("Test 1 failed. Samples or trigger marker did not come back.\n");
+    success = false;
+  }
+  readCapture(&sampleCount, &lastChunkFirst, capture_hitMarker_e, &hitAt);
+  if (hitAt != TEST_HIT_AT) {
+    printf("Test 1 failed. Hit marker at %lu, expected %d.\n",
+           (unsigned long)hitAt, TEST_HIT_AT);
+    success = false;
+  }
+
+  // Test 2: without capture_poll() the ring fills up. The samples after that
+  // are dropped, and recording resumes at the right index once it drains.
+  testBufferSize = 0;
+  capture_start(memorySink);
+  uint32_t index = 0;
+  for (; index < CAPTURE_RING_SIZE + TEST_DROP_COUNT; index++)
+    capture_isrSample(testSample(index));
+  capture_poll();
+  for (uint32_t i = 0; i < TEST_RESUME_COUNT; i++, index++)
+    capture_isrSample(testSample(index));
+  capture_stop();
+  if (!readCapture(&sampleCount, &lastChunkFirst, capture_hitMarker_e,
+                   &hitAt) ||
+      capture_getDroppedSamples() != TEST_DROP_COUNT ||
+      sampleCount != CAPTURE_RING_SIZE + TEST_RESUME_COUNT ||
+      lastChunkFirst != CAPTURE_RING_SIZE + TEST_DROP_COUNT) {
+    printf("Test 2 failed. Dropped %u samples, read back %u, resumed at "
+           "%lu.\n",
+           capture_getDroppedSamples(), sampleCount,
+           (unsigned long)lastChunkFirst);
+    success = false;
+  }
+
+  printf(success ? "capture_runTest() passed.\n"
+                 : "capture_runTest() failed.\n");
+  return success;
+}
@@ -0,0 +1,20 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef CAPTURETEST_H_
+#define CAPTURETEST_H_
+
+#include <stdbool.h>
+
+// Records samples and markers into memory and reads them back, including
+// samples dropped when the ring is full. Run it with interrupts off, it feeds
+// the capture in place of isr_function(). Returns true if all tests pass.
+bool capture_runTest(void);
+
+#endif /* CAPTURETEST_H_ */
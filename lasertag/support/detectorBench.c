@@ -0,0 +1,212 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "detector.h"
+#include "detectorBench.h"
+#include "filter.h"
+#include "intervalTimer.h"
+#include "signalGenerator.h"
+#include "xparameters.h"
+
+#define BENCH_TIMER INTERVAL_TIMER_TIMER_0
+#define BOARD_REPEATS 3
+#define NS_PER_SECOND 1e9
+#define PERCENT 100.0
+// The corpus: a shot every 600 ms (after the 500 ms lockout of the one before)
+// cycling through the frequencies, on noise, impulses and 60 Hz flicker.
+#define CORPUS_SEED 20240101
+#define CORPUS_NOISE_SIGMA 20.0
+#define CORPUS_IMPULSE_RATE 0.0001
+#define CORPUS_IMPULSE_AMPLITUDE 300.0
+#define CORPUS_MAINS_HZ 60.0
+#define CORPUS_FLICKER_AMPLITUDE 40.0
+#define CORPUS_FLICKER_HARMONICS 4
+#define CORPUS_SHOT_EVERY 60000
+#define CORPUS_SHOT_AMPLITUDE 600.0
+#define CORPUS_SHOT_RAMP 200
+#define CORPUS_MAX_SHOTS                                                       \
+  (DETECTORBENCH_CORPUS_SAMPLES / CORPUS_SHOT_EVERY + 1)
+
+static const char *const stageNames[DETECTORBENCH_STAGE_COUNT] = {
+    "fir",        "iir",         "power",   "hitDetect",
+    "cfarDetect", "earlyDetect", "detector"};
+
+// The pass whose time each stage's pass adds to, -1 for none.
+static const int16_t basePass[DETECTORBENCH_STAGE_COUNT] = {
+    -1, detectorBench_fir_e, detectorBench_iir_e, detectorBench_power_e,
+    detectorBench_power_e, detectorBench_power_e, -1};
+
+static uint32_t hits;
+
+// Generates the corpus into samples[].
+static bool makeCorpus(uint32_t samples[]) {
+  static const uint16_t frequencies[FILTER_FREQUENCY_COUNT] = {0, 1, 2, 3, 4,
+                                                               5, 6, 7, 8, 9};
+  static signalGenerator_burst_t shots[CORPUS_MAX_SHOTS];
+  static uint16_t block[SIGNALGENERATOR_BLOCK_SIZE];
+  static signalGenerator_t gen;
+  const signalGenerator_config_t config = {
+      .seed = CORPUS_SEED,
+      .noiseSigma = CORPUS_NOISE_SIGMA,
+      .impulseRate = CORPUS_IMPULSE_RATE,
+      .impulseAmplitude = CORPUS_IMPULSE_AMPLITUDE,
+      .mainsHz = CORPUS_MAINS_HZ,
+      .flickerAmplitude = CORPUS_FLICKER_AMPLITUDE,
+      .flickerHarmonics = CORPUS_FLICKER_HARMONICS};
+  uint32_t shotCount = signalGenerator_makeShots(
+      shots, CORPUS_MAX_SHOTS, DETECTORBENCH_CORPUS_SAMPLES, 0,
+      CORPUS_SHOT_EVERY, frequencies, FILTER_FREQUENCY_COUNT,
+      CORPUS_SHOT_AMPLITUDE, CORPUS_SHOT_RAMP);
+  if (!signalGenerator_init(&gen, &config) ||
+      !signalGenerator_setBursts(&gen, shots, shotCount))
+    return false;
+  for (uint32_t i = 0; i < DETECTORBENCH_CORPUS_SAMPLES;
+       i += SIGNALGENERATOR_BLOCK_SIZE) {
+    uint32_t n = DETECTORBENCH_CORPUS_SAMPLES - i < SIGNALGENERATOR_BLOCK_SIZE
+                     ? DETECTORBENCH_CORPUS_SAMPLES - i
+                     : SIGNALGENERATOR_BLOCK_SIZE;
+    signalGenerator_generate(&gen, block, n);
+    for (uint32_t j = 0; j < n; j++)
+      samples[i + j] = block[j];
+  }
+  return true;
+}
+
+// The pipeline of detector_ctxAddSample() up to and including the last stage.
+static void runStages(detector_ctx_t *detector, const uint32_t samples[],
+                      detectorBench_stage_t last) {
+  filter_ctx_t *filter = detector->filter;
+  uint16_t sampleCnt = 0;
+  for (uint32_t i = 0; i < DETECTORBENCH_CORPUS_SAMPLES; i++) {
+    filter_ctxAddNewInput(filter, samples[i] / DETECTOR_SCALED_ADC_FACTOR -
+                                      DETECTOR_SCALED_ADC_RANGE);
+    if (++sampleCnt < FILTER_FIR_DECIMATION_FACTOR)
+      continue;
+    sampleCnt = 0;
+    filter_ctxFirFilter(filter);
+    if (last >= detectorBench_iir_e)
+      for (uint16_t f = 0; f < FILTER_FREQUENCY_COUNT; f++)
+        filter_ctxIirFilter(filter, f);
+    if (last >= detectorBench_power_e)
+      for (uint16_t f = 0; f < FILTER_FREQUENCY_COUNT; f++)
+        filter_ctxComputePower(filter, f, false, false);
+    if (last >= detectorBench_hitDetect_e)
+      detector_ctxDetectHit(detector);
+  }
+}
+
+// Seconds for one run of a pass, on fresh contexts.
+static double timePass(const uint32_t samples[], detectorBench_stage_t stage) {
+  static filter_ctx_t filter;
+  static detector_ctx_t detector;
+  filter_ctxInit(&filter);
+  detector_ctxInit(&detector, &filter, NULL);
+  // The detector never freezes, so each shot takes the same path through hit
+  // detection.
+  detector_ctxSetFreezeOnHit(&detector, false);
+  if (stage == detectorBench_cfarDetect_e) {
+    detector_ctxSetDecision(&detector, detector_cfarDecision_e);
+    detector_ctxSetThreshold(&detector, DETECTOR_CFAR_FUDGE_FACTOR,
+                             detector.thresholdFactor);
+    stage = detectorBench_hitDetect_e;
+  }
+  if (stage == detectorBench_earlyDetect_e) {
+    detector_ctxSetEarlyDetection(&detector, true);
+    stage = detectorBench_hitDetect_e;
+  }
+  intervalTimer_reset(BENCH_TIMER);
+  intervalTimer_start(BENCH_TIMER);
+  if (stage == detectorBench_detector_e)
+    detector_ctxRun(&detector, samples, DETECTORBENCH_CORPUS_SAMPLES);
+  else
+    runStages(&detector, samples, stage);
+  intervalTimer_stop(BENCH_TIMER);
+  detector_hitCount_t hitCounts[FILTER_FREQUENCY_COUNT];
+  detector_ctxGetHitCounts(&detector, hitCounts);
+  hits = 0;
+  for (uint16_t f = 0; f < FILTER_FREQUENCY_COUNT; f++)
+    hits += hitCounts[f];
+  filter_ctxFree(&filter);
+  return intervalTimer_getTotalDurationInSeconds(BENCH_TIMER);
+}
+
+// Generates the corpus and times every stage. The passes take turns, so
+// anything that slows the machine down for a while hits all of them alike.
+bool detectorBench_run(detectorBench_results_t *results, uint16_t repeats) {
+  uint32_t *samples = malloc(DETECTORBENCH_CORPUS_SAMPLES * sizeof(uint32_t));
+  if (!samples || !makeCorpus(samples)) {
+    printf("detectorBench: unable to make the corpus.\n");
+    free(samples);
+    return false;
+  }
+  intervalTimer_init(BENCH_TIMER);
+  results->repeats = repeats ? repeats : 1;
+  double fastest[DETECTORBENCH_STAGE_COUNT];
+  for (uint16_t r = 0; r < results->repeats; r++) {
+    for (uint16_t s = 0; s < DETECTORBENCH_STAGE_COUNT; s++) {
+      double seconds = timePass(samples, s);
+      if (r == 0 || seconds < fastest[s])
+        fastest[s] = seconds;
+    }
+  }
+  results->hits = hits; // Of the last pass, the whole detector.
+  for (uint16_t s = 0; s < DETECTORBENCH_STAGE_COUNT; s++) {
+    double seconds =
+        basePass[s] < 0 ? fastest[s] : fastest[s] - fastest[basePass[s]];
+    if (seconds < 0)
+      seconds = 0; // Lost in the noise of the timer.
+    results->nsPerSample[s] =
+        seconds * NS_PER_SECOND / DETECTORBENCH_CORPUS_SAMPLES;
+  }
+  free(samples);
+  return true;
+}
+
+// Name of a stage.
+const char *detectorBench_getStageName(detectorBench_stage_t stage) {
+  return stage < DETECTORBENCH_STAGE_COUNT ? stageNames[stage] : "";
+}
+
+// Prints the time of every stage against the real-time budget.
+void detectorBench_print(const detectorBench_results_t *results, double cpuHz) {
+  double budgetNs = NS_PER_SECOND / DETECTORBENCH_SAMPLE_RATE;
+  printf("detectorBench: %d samples, fastest of %u runs, %u hits",
+         DETECTORBENCH_CORPUS_SAMPLES, results->repeats, results->hits);
+  if (cpuHz > 0)
+    printf(", %.0f MHz", cpuHz / 1e6);
+  printf("\n%-11s %10s %14s %11s\n", "stage", "ns/sample", "cycles/sample",
+         "of budget");
+  for (uint16_t s = 0; s < DETECTORBENCH_STAGE_COUNT; s++) {
+    double ns = results->nsPerSample[s];
+    printf("%-11s %10.1f ", stageNames[s], ns);
+    if (cpuHz > 0)
+      printf("%14.1f ", ns * cpuHz / NS_PER_SECOND);
+    else
+      printf("%14s ", "-");
+    printf("%10.2f%%\n", ns / budgetNs * PERCENT);
+  }
+  double detectorNs = results->nsPerSample[detectorBench_detector_e];
+  if (detectorNs > 0)
+    printf("The detector uses %.2f%% of the %.0f ns per sample at %d Hz, "
+           "%.1f times real time.\n",
+           detectorNs / budgetNs * PERCENT, budgetNs,
+           DETECTORBENCH_SAMPLE_RATE, budgetNs / detectorNs);
+}
+
+// Runs and prints the benchmark at the board's CPU clock.
+bool detectorBench_report(void) {
+  detectorBench_results_t results;
+  if (!detectorBench_run(&results, BOARD_REPEATS))
+    return false;
+  detectorBench_print(&results, XPAR_CPU_CORTEXA9_0_CPU_CLK_FREQ_HZ);
+  return true;
+}
@@ -0,0 +1,72 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef DETECTORBENCH_H_
+#define DETECTORBENCH_H_
+
+// Measures how long filter.c and detector.c take per ADC sample, on a fixed
+// synthetic corpus (signalGenerator.h) so that the numbers of two builds, or
+// of the board and a PC, can be compared. The same code runs on the board
+// (detectorBench_report() from main.c) and on the host (lasertagBench).
+//
+// Each pass runs the corpus through a fresh filter context with one more
+// stage of the pipeline than the pass before, timed with interval timer 0:
+//   fir         scaling, filter_ctxAddNewInput() and the decimating FIR
+//   iir         + the ten IIR filters
+//   power       + the power of each IIR output
+//   hitDetect   + detector_ctxDetectHit()
+//   cfarDetect  the same as hitDetect with the CFAR decision
+//               (detector_cfarDecision_e) instead of the median
+//   earlyDetect the same as hitDetect with early detection
+//               (detector_ctxSetEarlyDetection()), which also keeps the
+//               power of the shorter windows
+// A stage's time is its pass's time less the time of the pass it adds to,
+// the power pass for cfarDetect and earlyDetect. The detector stage is the
+// whole path on its own, detector_ctxRun() as
+// detector() runs it, minus popping the ADC buffer. Every pass is repeated
+// and the fastest run is kept.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define DETECTORBENCH_SAMPLE_RATE 100000 // Real time is one sample per 10 us.
+#define DETECTORBENCH_CORPUS_SAMPLES 100000 // 1 s.
+#define DETECTORBENCH_STAGE_COUNT 7
+
+typedef enum {
+  detectorBench_fir_e,
+  detectorBench_iir_e,
+  detectorBench_power_e,
+  detectorBench_hitDetect_e,
+  detectorBench_cfarDetect_e,
+  detectorBench_earlyDetect_e,
+  detectorBench_detector_e,
+} detectorBench_stage_t;
+
+typedef struct {
+  double nsPerSample[DETECTORBENCH_STAGE_COUNT];
+  uint32_t hits;     // In the corpus, by the detector stage.
+  uint16_t repeats;  // Runs of each pass.
+} detectorBench_results_t;
+
+// Generates the corpus and times every stage, running each pass repeats
+// times. Returns false if the corpus could not be allocated.
+bool detectorBench_run(detectorBench_results_t *results, uint16_t repeats);
+
+// Name of a stage, as in the table above.
+const char *detectorBench_getStageName(detectorBench_stage_t stage);
+
+// Prints ns and CPU cycles per sample for every stage, and how much of the
+// real-time budget the detector uses. cpuHz may be 0 if it is not known.
+void detectorBench_print(const detectorBench_results_t *results, double cpuHz);
+
+// Runs and prints the benchmark at the board's CPU clock.
+bool detectorBench_report(void);
+
+#endif /* DETECTORBENCH_H_ */
@@ -0,0 +1,161 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#include <stdio.h>
+
+#include "detector.h"
+#include "detectorCtxTest.h"
+#include "filter.h"
+
+#define TEST_SHOT_FREQUENCY 3
+#define TEST_ADC_LOW 1024
+#define TEST_ADC_HIGH 3072
+#define TEST_ADC_IDLE 2048
+#define TEST_BLOCK_SIZE 1000
+#define TEST_SHOT_BLOCKS 20 // 200 ms of 100 kHz samples, one whole shot.
+#define TEST_POWER_RATIO 1e6 // Shot power over what silence leaves behind.
+#define TEST_STEADY_FREQUENCY 7
+#define TEST_STEADY_AMPLITUDE 256 // ADC counts, a quarter of the shot's.
+#define TEST_SHOT_AMPLITUDE 1024
+#define TEST_LEARN_BLOCKS 300 // 3 s for CFAR to learn the steady source.
+#define TEST_QUIET_BLOCKS 100 // The last second of it must have no hits.
+
+// Fills a block with the square wave of a frequency, continuing at *tick.
+static void shotBlock(uint32_t samples[], uint16_t frequency, uint32_t *tick) {
+  uint16_t period = filter_frequencyTickTable[frequency];
+  for (uint32_t i = 0; i < TEST_BLOCK_SIZE; i++, (*tick)++)
+    samples[i] = (*tick % period) < period / 2 ? TEST_ADC_HIGH : TEST_ADC_LOW;
+}
+
+// Adds the square wave of a frequency to a block, starting at tick.
+static void addSquareWave(uint32_t samples[], uint16_t frequency,
+                          uint32_t amplitude, uint32_t tick) {
+  uint16_t period = filter_frequencyTickTable[frequency];
+  for (uint32_t i = 0; i < TEST_BLOCK_SIZE; i++)
+    samples[i] += ((tick + i) % period) < period / 2 ? amplitude : -amplitude;
+}
+
+// Test 3: with the CFAR decision a steady source is learned and stops hitting,
+// and a shot on top of it is still one hit on the shot's frequency. The median
+// rule keeps hitting the steady source.
+static bool testCfar(filter_ctx_t *filter, detector_ctx_t *detector,
+                     detector_decision_t decision) {
+  uint32_t samples[TEST_BLOCK_SIZE];
+  uint32_t tick = 0;
+  detector_hitCount_t before[FILTER_FREQUENCY_COUNT];
+  detector_hitCount_t after[FILTER_FREQUENCY_COUNT];
+  filter_ctxInit(filter);
+  detector_ctxInit(detector, filter, NULL);
+  detector_ctxSetFreezeOnHit(detector, false); // Every hit counts.
+  detector_ctxSetDecision(detector, decision);
+  if (decision == detector_cfarDecision_e)
+    detector_ctxSetThreshold(detector, DETECTOR_CFAR_FUDGE_FACTOR,
+                             detector->thresholdFactor);
+  for (uint16_t block = 0; block < TEST_LEARN_BLOCKS + TEST_SHOT_BLOCKS;
+       block++, tick += TEST_BLOCK_SIZE) {
+    if (block == TEST_LEARN_BLOCKS - TEST_QUIET_BLOCKS)
+      detector_ctxGetHitCounts(detector, before);
+    if (block == TEST_LEARN_BLOCKS)
+      detector_ctxGetHitCounts(detector, after);
+    for (uint32_t i = 0; i < TEST_BLOCK_SIZE; i++)
+      samples[i] = TEST_ADC_IDLE;
+    addSquareWave(samples, TEST_STEADY_FREQUENCY, TEST_STEADY_AMPLITUDE, tick);
+    if (block >= TEST_LEARN_BLOCKS)
+      addSquareWave(samples, TEST_SHOT_FREQUENCY, TEST_SHOT_AMPLITUDE, tick);
+    detector_ctxRun(detector, samples, TEST_BLOCK_SIZE);
+  }
+  bool learned = after[TEST_STEADY_FREQUENCY] == before[TEST_STEADY_FREQUENCY];
+  detector_ctxGetHitCounts(detector, before);
+  filter_ctxFree(filter);
+  if (decision == detector_medianDecision_e) {
+    if (learned) {
+      printf("Test 3 failed. The median rule stopped hitting the steady "
+             "source.\n");
+      return false;
+    }
+    return true;
+  }
+  bool shotHit =
+      before[TEST_SHOT_FREQUENCY] == after[TEST_SHOT_FREQUENCY] + 1 &&
+      detector_ctxGetFrequencyNumberOfLastHit(detector) == TEST_SHOT_FREQUENCY;
+  if (!learned || !shotHit) {
+    printf("Test 3 failed. CFAR did not learn the steady source on frequency "
+           "%d or missed the shot on frequency %d.\n",
+           TEST_STEADY_FREQUENCY, TEST_SHOT_FREQUENCY);
+    return false;
+  }
+  return true;
+}
+
+// Runs two detector contexts side by side and checks that a shot fed to one
+// of them does not show up in the other.
+bool detectorCtx_runTest(void) {
+  printf("***************** detectorCtx_runTest() *****************\n");
+  bool success = true;
+  static filter_ctx_t filters[2];
+  static detector_ctx_t detectors[2];
+  uint32_t shot[TEST_BLOCK_SIZE];
+  uint32_t idle[TEST_BLOCK_SIZE];
+  uint32_t tick = 0;
+  for (uint32_t i = 0; i < TEST_BLOCK_SIZE; i++)
+    idle[i] = TEST_ADC_IDLE;
+  for (uint16_t d = 0; d < 2; d++) {
+    filter_ctxInit(&filters[d]);
+    detector_ctxInit(&detectors[d], &filters[d], NULL);
+  }
+
+  // Test 1: detector 0 sees a shot, detector 1 only sees silence.
+  for (uint16_t block = 0; block < TEST_SHOT_BLOCKS; block++) {
+    shotBlock(shot, TEST_SHOT_FREQUENCY, &tick);
+    detector_ctxRun(&detectors[0], shot, TEST_BLOCK_SIZE);
+    detector_ctxRun(&detectors[1], idle, TEST_BLOCK_SIZE);
+  }
+  detector_hitCount_t hitCounts[FILTER_FREQUENCY_COUNT];
+  detector_ctxGetHitCounts(&detectors[0], hitCounts);
+  if (!detector_ctxHitDetected(&detectors[0]) ||
+      detector_ctxGetFrequencyNumberOfLastHit(&detectors[0]) !=
+          TEST_SHOT_FREQUENCY ||
+      hitCounts[TEST_SHOT_FREQUENCY] != 1) {
+    printf("Test 1 failed. Detector 0 did not register exactly one hit on "
+           "frequency %d.\n",
+           TEST_SHOT_FREQUENCY);
+    success = false;
+  }
+  if (detector_ctxHitDetected(&detectors[1]) ||
+      detector_ctxGetLives(&detectors[1]) == 0) {
+    printf("Test 1 failed. Detector 1 registered a hit from silence.\n");
+    success = false;
+  }
+
+  // Test 2: the shot does not leak into the filters of detector 1, and
+  // detector 0 being frozen does not freeze detector 1.
+  double shotPower =
+      filter_ctxGetCurrentPowerValue(&filters[0], TEST_SHOT_FREQUENCY);
+  double idlePower =
+      filter_ctxGetCurrentPowerValue(&filters[1], TEST_SHOT_FREQUENCY);
+  if (idlePower * TEST_POWER_RATIO > shotPower) {
+    printf("Test 2 failed. Shot power %le leaked into detector 1 (%le).\n",
+           shotPower, idlePower);
+    success = false;
+  }
+  if (!detectors[0].frozen || detectors[1].frozen) {
+    printf("Test 2 failed. Frozen state leaked between detectors.\n");
+    success = false;
+  }
+
+  for (uint16_t d = 0; d < 2; d++)
+    filter_ctxFree(&filters[d]);
+  success = testCfar(&filters[0], &detectors[0], detector_medianDecision_e) &&
+            success;
+  success = testCfar(&filters[0], &detectors[0], detector_cfarDecision_e) &&
+            success;
+  printf(success ? "detectorCtx_runTest() passed.\n"
+                 : "detectorCtx_runTest() failed.\n");
+  return success;
+}
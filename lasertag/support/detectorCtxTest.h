@@ -0,0 +1,21 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef DETECTORCTXTEST_H_
+#define DETECTORCTXTEST_H_
+
+#include <stdbool.h>
+
+// Runs two detector contexts side by side and checks that a shot fed to one
+// of them does not show up in the other, then that the CFAR decision learns a
+// steady source that the median rule keeps hitting. Returns true if all tests
+// pass.
+bool detectorCtx_runTest(void);
+
+#endif /* DETECTORCTXTEST_H_ */
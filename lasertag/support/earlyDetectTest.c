@@ -0,0 +1,124 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#include <math.h>
+#include <stdio.h>
+
+#include "detector.h"
+#include "earlyDetectTest.h"
+#include "filter.h"
+#include "syntheticGame.h"
+
+#define TEST_SHOT_COUNT 10
+#define TEST_SHOT_EVERY 70000 // After the lockout of the shot before.
+// The incremental sums drift by rounding errors of the shots' power, which is
+// about 1, so the tolerance is absolute.
+#define TEST_POWER_TOLERANCE 1e-12
+#define SAMPLES_PER_MS SYNTHETICGAME_SAMPLES_PER_MS
+
+static const uint16_t shotFrequencies[TEST_SHOT_COUNT] = {0, 1, 2, 3, 4,
+                                                          5, 6, 7, 8, 9};
+static const double shotAmplitudes[TEST_SHOT_COUNT] = {70,  85,  100, 120, 150,
+                                                       200, 250, 350, 500, 1000};
+
+static const syntheticGame_t game = {.seed = 11,
+                                     .impulseRate = 0.00005, // Five a second.
+                                     .impulseAmplitude = 300.0,
+                                     .shotEvery = TEST_SHOT_EVERY,
+                                     .shotCount = TEST_SHOT_COUNT,
+                                     .frequencies = shotFrequencies,
+                                     .amplitudes = shotAmplitudes};
+
+// True if the incremental power of every window is its sum from scratch.
+static bool windowsMatch(filter_ctx_t *filter) {
+  double incremental[FILTER_POWER_WINDOW_COUNT][FILTER_IIR_FILTER_COUNT];
+  double scratch[FILTER_IIR_FILTER_COUNT];
+  for (uint16_t w = 0; w < FILTER_POWER_WINDOW_COUNT; w++)
+    filter_ctxGetWindowPowerValues(filter, w, incremental[w]);
+  for (uint16_t f = 0; f < FILTER_IIR_FILTER_COUNT; f++)
+    filter_ctxComputePower(filter, f, true, false);
+  for (uint16_t w = 0; w < FILTER_POWER_WINDOW_COUNT; w++) {
+    filter_ctxGetWindowPowerValues(filter, w, scratch);
+    for (uint16_t f = 0; f < FILTER_IIR_FILTER_COUNT; f++) {
+      if (fabs(incremental[w][f] - scratch[f]) > TEST_POWER_TOLERANCE) {
+        printf("Test 1 failed. Window %u of filter %u has power %le, %le "
+               "from scratch.\n",
+               w, f, incremental[w][f], scratch[f]);
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// Runs the game through a fresh detector, with or without early detection.
+// Returns false if the game could not be generated or, with early detection,
+// the power windows do not match their sums.
+static bool runGame(bool early, syntheticGame_hitLog_t *log) {
+  static filter_ctx_t filter;
+  static detector_ctx_t detector;
+  syntheticGame_initDetector(&detector, &filter);
+  detector_ctxSetEarlyDetection(&detector, early);
+  bool match = syntheticGame_run(&game, &detector, log) &&
+               (!early || windowsMatch(&filter));
+  filter_ctxFree(&filter);
+  return match;
+}
+
+// Runs all tests.
+bool earlyDetect_runTest(void) {
+  printf("***************** earlyDetect_runTest() *****************\n");
+  bool success = true;
+  syntheticGame_hitLog_t plain, early;
+  // Test 1 is in runGame(): the incremental window powers are their sums.
+  if (!runGame(false, &plain) || !runGame(true, &early))
+    return false;
+
+  // Test 2: every shot is one hit on its frequency, with and without early
+  // detection, and nothing else hits.
+  if (plain.hitCount != TEST_SHOT_COUNT || early.hitCount != TEST_SHOT_COUNT) {
+    printf("Test 2 failed. %u hits without early detection and %u with it, "
+           "expected %d.\n",
+           plain.hitCount, early.hitCount, TEST_SHOT_COUNT);
+    return false;
+  }
+
+  // Test 3: early detection hits no later, and sooner on average.
+  double plainTotal = 0;
+  double earlyTotal = 0;
+  for (uint16_t i = 0; i < TEST_SHOT_COUNT; i++) {
+    uint32_t start = syntheticGame_shotStart(&game, i);
+    double plainMs = (double)(plain.hitPositions[i] - start) / SAMPLES_PER_MS;
+    double earlyMs = (double)(early.hitPositions[i] - start) / SAMPLES_PER_MS;
+    printf("Shot %u (amplitude %.0f): hit after %.1f ms, %.1f ms with early "
+           "detection.\n",
+           i, shotAmplitudes[i], plainMs, earlyMs);
+    plainTotal += plainMs;
+    earlyTotal += earlyMs;
+    if (early.hitFrequencies[i] != plain.hitFrequencies[i] ||
+        early.hitPositions[i] > plain.hitPositions[i]) {
+      printf("Test 3 failed. Shot %u was hit on frequency %u after %.1f ms "
+             "with early detection, frequency %u after %.1f ms without.\n",
+             i, early.hitFrequencies[i], earlyMs, plain.hitFrequencies[i],
+             plainMs);
+      success = false;
+    }
+  }
+  printf("Mean latency %.1f ms, %.1f ms with early detection.\n",
+         plainTotal / TEST_SHOT_COUNT, earlyTotal / TEST_SHOT_COUNT);
+  if (earlyTotal > plainTotal * (1 - EARLYDETECTTEST_MIN_GAIN)) {
+    printf("Test 3 failed. Early detection cut the mean latency by less than "
+           "%.0f%%.\n",
+           EARLYDETECTTEST_MIN_GAIN * 100);
+    success = false;
+  }
+  printf(success ? "earlyDetect_runTest() passed.\n"
+                 : "earlyDetect_runTest() failed.\n");
+  return success;
+}
@@ -0,0 +1,25 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef EARLYDETECTTEST_H_
+#define EARLYDETECTTEST_H_
+
+#include <stdbool.h>
+
+// Runs a synthetic game (signalGenerator.h), shots of several strengths on
+// noise, impulses and lamp flicker, through a detector with early detection
+// and one without. Checks that the shorter power windows match their sums
+// from scratch, that every shot is one hit on its frequency either way and
+// nothing else hits, and that early detection hits no later and on average at
+// least EARLYDETECTTEST_MIN_GAIN sooner. Returns true if all tests pass.
+bool earlyDetect_runTest(void);
+
+#define EARLYDETECTTEST_MIN_GAIN 0.08
+
+#endif /* EARLYDETECTTEST_H_ */
@@ -0,0 +1,161 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#include <math.h>
+#include <stdio.h>
+
+#include "detector.h"
+#include "filter.h"
+#include "filterGateTest.h"
+#include "syntheticGame.h"
+
+#define TEST_SHOT_COUNT 6
+#define TEST_SHOT_EVERY 100000 // 1 s apart, the rest of each second is quiet.
+// The gate must skip at least this fraction of the FIR outputs. Each second
+// has 200 ms of shot and the 200 ms the gate waits before it closes.
+#define TEST_MIN_SKIPPED 0.4
+#define SAMPLES_PER_MS SYNTHETICGAME_SAMPLES_PER_MS
+#define TEST_BLOCK_SIZE 1000
+
+static const uint16_t shotFrequencies[TEST_SHOT_COUNT] = {0, 2, 4, 6, 8, 9};
+static const double shotAmplitudes[TEST_SHOT_COUNT] = {70,  100, 150,
+                                                       250, 500, 1000};
+
+static const syntheticGame_t game = {.seed = 7,
+                                     .impulseRate = 0.00001, // One a second.
+                                     .impulseAmplitude = 200.0,
+                                     .shotEvery = TEST_SHOT_EVERY,
+                                     .shotCount = TEST_SHOT_COUNT,
+                                     .frequencies = shotFrequencies,
+                                     .amplitudes = shotAmplitudes};
+
+// Runs the game through a fresh detector, with or without the gate. Returns
+// the fraction of FIR outputs the gate skipped, or -1 if the game could not
+// be generated.
+static double runGame(bool gate, syntheticGame_hitLog_t *log) {
+  static filter_ctx_t filter;
+  static detector_ctx_t detector;
+  syntheticGame_initDetector(&detector, &filter);
+  filter_ctxSetGate(&filter, gate);
+  if (!syntheticGame_run(&game, &detector, log)) {
+    filter_ctxFree(&filter);
+    return -1;
+  }
+  double skipped = (double)filter_ctxGetGateSkippedCount(&filter) *
+                   FILTER_FIR_DECIMATION_FACTOR /
+                   syntheticGame_sampleCount(&game);
+  filter_ctxFree(&filter);
+  return skipped;
+}
+
+// Test 3: runs the game through a detector with the gate and one without,
+// side by side, and checks that while the gate is open every power is within
+// FILTERGATETEST_POWER_TOLERANCE of the peak power of the shot it is in,
+// without the gate. Returns false if it is not or the game could not be
+// generated.
+static bool testWakePower(void) {
+  static filter_ctx_t filters[2];
+  static detector_ctx_t detectors[2];
+  syntheticGame_hitLog_t logs[2];
+  signalGenerator_t gen;
+  signalGenerator_burst_t shots[SYNTHETICGAME_MAX_SHOTS];
+  uint16_t block[TEST_BLOCK_SIZE];
+  double peak[TEST_SHOT_COUNT] = {0}, error[TEST_SHOT_COUNT] = {0};
+  uint32_t sampleCount = syntheticGame_sampleCount(&game);
+  bool success = true;
+
+  for (uint16_t d = 0; d < 2; d++) {
+    syntheticGame_initDetector(&detectors[d], &filters[d]);
+    logs[d] = (syntheticGame_hitLog_t){0};
+    detectors[d].user = &logs[d];
+  }
+  filter_ctxSetGate(&filters[1], true);
+  if (!syntheticGame_initGenerator(&game, &gen, shots))
+    success = false;
+  for (uint32_t position = 0; success && position < sampleCount;) {
+    signalGenerator_generate(&gen, block, TEST_BLOCK_SIZE);
+    for (uint32_t i = 0; i < TEST_BLOCK_SIZE; i++, position++) {
+      detector_ctxAddSample(&detectors[0], block[i]);
+      detector_ctxAddSample(&detectors[1], block[i]);
+      if (position < SYNTHETICGAME_FIRST_SHOT ||
+          !filter_ctxGateOpen(&filters[1]))
+        continue;
+      uint16_t shot = (position - SYNTHETICGAME_FIRST_SHOT) / TEST_SHOT_EVERY;
+      for (uint16_t f = 0; f < FILTER_IIR_FILTER_COUNT; f++) {
+        double plain = filter_ctxGetCurrentPowerValue(&filters[0], f);
+        double gated = filter_ctxGetCurrentPowerValue(&filters[1], f);
+        error[shot] = fmax(error[shot], fabs(gated - plain));
+        if (f == shotFrequencies[shot])
+          peak[shot] = fmax(peak[shot], plain);
+      }
+    }
+  }
+  for (uint16_t i = 0; success && i < TEST_SHOT_COUNT; i++) {
+    printf("Shot %u: power off by up to %.4f%% of its peak with the gate.\n",
+           i, error[i] / peak[i] * 100);
+    if (error[i] > peak[i] * FILTERGATETEST_POWER_TOLERANCE) {
+      printf("Test 3 failed. The power was off by more than %.2f%%.\n",
+             FILTERGATETEST_POWER_TOLERANCE * 100);
+      success = false;
+    }
+  }
+  for (uint16_t d = 0; d < 2; d++)
+    filter_ctxFree(&filters[d]);
+  return success;
+}
+
+// Runs all tests.
+bool filterGate_runTest(void) {
+  printf("***************** filterGate_runTest() *****************\n");
+  bool success = true;
+  syntheticGame_hitLog_t plain, gated;
+  runGame(false, &plain);
+  double skipped = runGame(true, &gated);
+  if (skipped < 0)
+    return false;
+
+  // Test 1: the gate closes during the quiet stretches.
+  printf("The gate skipped %.1f%% of the FIR outputs.\n", skipped * 100);
+  if (skipped < TEST_MIN_SKIPPED) {
+    printf("Test 1 failed. The gate skipped less than %.0f%%.\n",
+           TEST_MIN_SKIPPED * 100);
+    success = false;
+  }
+
+  // Test 2: every shot is one hit on its frequency, with and without the
+  // gate, and the gate does not delay it by more than the bound.
+  if (plain.hitCount != TEST_SHOT_COUNT || gated.hitCount != TEST_SHOT_COUNT) {
+    printf("Test 2 failed. %u hits without the gate and %u with it, expected "
+           "%d.\n",
+           plain.hitCount, gated.hitCount, TEST_SHOT_COUNT);
+    return false;
+  }
+  for (uint16_t i = 0; i < TEST_SHOT_COUNT; i++) {
+    int32_t delay = (int32_t)gated.hitPositions[i] - plain.hitPositions[i];
+    printf("Shot %u: hit after %.1f ms, %+.1f ms with the gate.\n", i,
+           (double)(plain.hitPositions[i] -
+                    syntheticGame_shotStart(&game, i)) /
+               SAMPLES_PER_MS,
+           (double)delay / SAMPLES_PER_MS);
+    if (gated.hitFrequencies[i] != plain.hitFrequencies[i] ||
+        delay > FILTERGATETEST_LATENCY_BOUND_MS * SAMPLES_PER_MS ||
+        delay < -FILTERGATETEST_LATENCY_BOUND_MS * SAMPLES_PER_MS) {
+      printf("Test 2 failed. Shot %u was hit on frequency %u after %+.1f ms "
+             "with the gate, frequency %u without it.\n",
+             i, gated.hitFrequencies[i], (double)delay / SAMPLES_PER_MS,
+             plain.hitFrequencies[i]);
+      success = false;
+    }
+  }
+
+  success = testWakePower() && success;
+  printf(success ? "filterGate_runTest() passed.\n"
+                 : "filterGate_runTest() failed.\n");
+  return success;
+}
@@ -0,0 +1,28 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef FILTERGATETEST_H_
+#define FILTERGATETEST_H_
+
+#include <stdbool.h>
+
+// Runs a synthetic game (signalGenerator.h), quiet stretches with shots of
+// several strengths, through a detector with the filter's energy gate and
+// one without. Checks that the gate skips most of the quiet stretches and
+// that every shot is still one hit on its frequency, no more than
+// FILTERGATETEST_LATENCY_BOUND_MS later than without the gate, and that after
+// the gate opens the power values stay within FILTERGATETEST_POWER_TOLERANCE
+// of the shot's peak power of those without it. Returns true if all tests
+// pass.
+bool filterGate_runTest(void);
+
+#define FILTERGATETEST_LATENCY_BOUND_MS 1
+#define FILTERGATETEST_POWER_TOLERANCE 0.0005 // Of the shot's peak power.
+
+#endif /* FILTERGATETEST_H_ */
@@ -0,0 +1,112 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "gameProtocol.h"
+#include "gameProtocolTest.h"
+
+#define TEST_PLAYER_COUNT 10
+#define TEST_STREAM_SIZE 200
+#define JUNK_BYTE 0x55
+#define CRC8_CHECK_VALUE 0xF4 // CRC-8 (poly 0x07) of "123456789".
+
+// Feeds size bytes to the parser and counts the good frames.
+// The last good frame is copied to lastFrame.
+static uint16_t parseAll(gameProtocol_parser_t *parser, const uint8_t data[],
+                         uint16_t size, gameProtocol_frame_t *lastFrame) {
+  uint16_t frameCount = 0;
+  for (uint16_t i = 0; i < size; i++) {
+    if (gameProtocol_parseByte(parser, data[i])) {
+      frameCount++;
+      *lastFrame = parser->frame;
+    }
+  }
+  return frameCount;
+}
+
+// Tests the frame encoder and the incremental parser of the game protocol.
+bool gameProtocol_runTest(void) {
+  printf("****************** gameProtocol_runTest() ******************\n");
+  bool success = true;
+  gameProtocol_parser_t parser;
+  gameProtocol_frame_t frame;
+  uint8_t stream[TEST_STREAM_SIZE];
+  uint16_t size = 0;
+
+  // Test 1: known CRC value.
+  if (gameProtocol_crc8((const uint8_t *)"123456789", 9) != CRC8_CHECK_VALUE) {
+    printf("Test 1 failed. Bad CRC-8 check value.\n");
+    success = false;
+  }
+
+  // Test 2: one frame per player event, all batched into one frame, preceded
+  // by junk and split across two calls.
+  uint8_t payload[TEST_PLAYER_COUNT];
+  for (uint8_t player = 0; player < TEST_PLAYER_COUNT; player++)
+    payload[player] = gameProtocol_packEvent(
+        player % 2 ? gameProtocol_frozen_e : gameProtocol_unfrozen_e, player);
+  stream[size++] = JUNK_BYTE;
+  stream[size++] = GAMEPROTOCOL_SYNC; // A lone SYNC with a bad length.
+  stream[size++] = GAMEPROTOCOL_MAX_PAYLOAD + 1;
+  size += gameProtocol_encode(gameProtocol_eventsFrame_e, 7, payload,
+                              TEST_PLAYER_COUNT, &stream[size]);
+  gameProtocol_parserInit(&parser);
+  uint16_t frameCount = parseAll(&parser, stream, size / 2, &frame);
+  frameCount += parseAll(&parser, &stream[size / 2], size - size / 2, &frame);
+  if (frameCount != 1 || frame.sequence != 7 ||
+      frame.length != TEST_PLAYER_COUNT ||
+      memcmp(frame.payload, payload, TEST_PLAYER_COUNT)) {
+    printf("Test 2 failed. Batched frame was not parsed correctly.\n");
+    success = false;
+  }
+  for (uint8_t player = 0; player < TEST_PLAYER_COUNT && success; player++) {
+    gameProtocol_event_t event =
+        gameProtocol_unpackEvent(frame.payload[player]);
+    if (event.player != player ||
+        event.type !=
+            (player % 2 ? gameProtocol_frozen_e : gameProtocol_unfrozen_e)) {
+      printf("Test 2 failed. Event %d did not survive packing.\n", player);
+      success = false;
+    }
+  }
+
+  // Test 3: a corrupted frame is dropped and the frame behind it still gets
+  // through.
+  size = gameProtocol_encode(gameProtocol_eventsFrame_e, 8, payload, 3, stream);
+  stream[GAMEPROTOCOL_HEADER_SIZE + 1] ^= 0x01; // Flip a payload bit.
+  size += gameProtocol_encode(gameProtocol_eventsFrame_e, 9, NULL, 0,
+                              &stream[size]);
+  gameProtocol_parserInit(&parser);
+  frameCount = parseAll(&parser, stream, size, &frame);
+  if (frameCount != 1 || frame.length != 0 ||
+      frame.sequence != 9 || parser.crcErrors != 1) {
+    printf("Test 3 failed. Corrupted frame was not dropped cleanly.\n");
+    success = false;
+  }
+
+  // Test 4: back-to-back frames in one buffer.
+  size = 0;
+  for (uint8_t i = 0; i < TEST_PLAYER_COUNT; i++)
+    size += gameProtocol_encode(gameProtocol_eventsFrame_e, i, &payload[i], 1,
+                                &stream[size]);
+  gameProtocol_parserInit(&parser);
+  frameCount = parseAll(&parser, stream, size, &frame);
+  if (frameCount != TEST_PLAYER_COUNT ||
+      frame.sequence != TEST_PLAYER_COUNT - 1) {
+    printf("Test 4 failed. Parsed %d of %d back-to-back frames.\n", frameCount,
+           TEST_PLAYER_COUNT);
+    success = false;
+  }
+
+  printf(success ? "gameProtocol_runTest() passed.\n"
+                 : "gameProtocol_runTest() failed.\n");
+  return success;
+}
@@ -0,0 +1,19 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef GAMEPROTOCOLTEST_H_
+#define GAMEPROTOCOLTEST_H_
+
+#include <stdbool.h>
+
+// Tests the frame encoder and the incremental parser of the game protocol.
+// Does not touch the bluetooth UART. Returns true if all tests pass.
+bool gameProtocol_runTest(void);
+
+#endif /* GAMEPROTOCOLTEST_H_ */
@@ -0,0 +1,87 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#include <stdio.h>
+
+#include "gameState.h"
+#include "gameStateTest.h"
+
+#define TEST_TEAM_COUNT 4
+
+// Tests the team bookkeeping and win condition of the game state.
+bool gameState_runTest(void) {
+  printf("****************** gameState_runTest() ******************\n");
+  bool success = true;
+
+  // Test 1: the four-player game. Players 1 and 3 are team 0, 2 and 4 are
+  // team 1. Freezing one player of each team does not end the game, freezing
+  // both players of a team does.
+  gameState_init();
+  for (uint8_t player = 1; player <= 4; player++)
+    gameState_addPlayer(player, (player - 1) % 2);
+  gameState_setFrozen(1, true);
+  gameState_setFrozen(2, true);
+  if (gameState_isOver() || gameState_getTeamsStanding() != 2) {
+    printf("Test 1 failed. Game over with one player of each team frozen.\n");
+    success = false;
+  }
+  gameState_setFrozen(3, true);
+  if (!gameState_isOver() || gameState_getFrozenCount(0) != 2 ||
+      gameState_getFrozenCount(1) != 1) {
+    printf("Test 1 failed. Game not over with team 0 frozen.\n");
+    success = false;
+  }
+  gameState_setFrozen(1, false);
+  if (gameState_isOver()) {
+    printf("Test 1 failed. Game still over after an unfreeze.\n");
+    success = false;
+  }
+
+  // Test 2: all player IDs, several teams. The game goes on until all but one
+  // team is frozen.
+  gameState_init();
+  for (uint8_t player = 0; player < GAMESTATE_MAX_PLAYERS; player++)
+    gameState_addPlayer(player, player % TEST_TEAM_COUNT);
+  if (gameState_getPlayers() != (gameState_players_t)~0 ||
+      gameState_getTeam(GAMESTATE_MAX_PLAYERS - 1) !=
+          (GAMESTATE_MAX_PLAYERS - 1) % TEST_TEAM_COUNT) {
+    printf("Test 2 failed. Players were not added to their teams.\n");
+    success = false;
+  }
+  for (uint8_t player = 0; player < GAMESTATE_MAX_PLAYERS; player++) {
+    if (player % TEST_TEAM_COUNT == 0)
+      continue; // Team 0 stays unfrozen.
+    gameState_setFrozen(player, true);
+    bool lastPlayer = player == GAMESTATE_MAX_PLAYERS - 1;
+    if (gameState_isOver() != lastPlayer) {
+      printf("Test 2 failed. Wrong game over after freezing player %d.\n",
+             player);
+      success = false;
+    }
+  }
+  if (gameState_getTeamsStanding() != 1 || gameState_getFrozenCount(0) != 0) {
+    printf("Test 2 failed. Team 0 should be the only team standing.\n");
+    success = false;
+  }
+
+  // Test 3: events for players that are not in the game are rejected.
+  gameState_init();
+  gameState_addPlayer(1, 0);
+  if (gameState_setFrozen(2, true) ||
+      gameState_setFrozen(GAMESTATE_MAX_PLAYERS, true) ||
+      gameState_addPlayer(GAMESTATE_MAX_PLAYERS, 0) ||
+      gameState_addPlayer(1, GAMESTATE_MAX_TEAMS) || gameState_isFrozen(2)) {
+    printf("Test 3 failed. Out-of-range player or team was accepted.\n");
+    success = false;
+  }
+
+  printf(success ? "gameState_runTest() passed.\n"
+                 : "gameState_runTest() failed.\n");
+  return success;
+}
@@ -0,0 +1,19 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef GAMESTATETEST_H_
+#define GAMESTATETEST_H_
+
+#include <stdbool.h>
+
+// Tests the team bookkeeping and win condition of the game state.
+// Returns true if all tests pass.
+bool gameState_runTest(void);
+
+#endif /* GAMESTATETEST_H_ */
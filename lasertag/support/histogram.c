@@ -446,6 +446,29 @@ void histogram_plotUserHits(uint16_t hitCounts[]) {
   }
 }
 
+// Plots a spectrum, binCount bins added up into histogram_barCount bars.
+void histogram_plotSpectrum(const double spectrum[], uint16_t binCount) {
+  double barPowers[HISTOGRAM_MAX_BAR_COUNT] = {0};
+  double maxPower = 0;
+  for (uint16_t bin = 0; bin < binCount; bin++)
+    barPowers[(uint32_t)bin * histogram_barCount / binCount] += spectrum[bin];
+  for (int i = 0; i < histogram_barCount; i++)
+    if (barPowers[i] > maxPower)
+      maxPower = barPowers[i];
+  for (int i = 0; i < histogram_barCount; i++) {
+    // All bars are empty while there is no signal at all.
+    double normalizedPower = maxPower > 0 ? barPowers[i] / maxPower : 0;
+    char label[HISTOGRAM_BAR_TOP_MAX_LABEL_WIDTH_IN_CHARS];
+    if (snprintf(label, HISTOGRAM_BAR_TOP_MAX_LABEL_WIDTH_IN_CHARS, "%0.0e",
+                 barPowers[i]) == -1)
+      printf("Error: snprintf encountered an error during conversion.\n");
+    trimLabel(label);
+    histogram_setBarData(i, normalizedPower * HISTOGRAM_MAX_BAR_DATA_IN_PIXELS,
+                         label);
+  }
+  histogram_updateDisplay();
+}
+
 // Normalizes the values in the array argument.
 void histogram_normalizeArrayValues(double *array, uint16_t size) {
   // Find the maximum value
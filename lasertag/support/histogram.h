@@ -92,6 +92,11 @@ void histogram_plotUserFrequencyPower(double powerValue[]);
 // Used to plot hits for frequencies 0-9.
 void histogram_plotUserHits(uint16_t hit[]);
 
+// Plots a spectrum of binCount bins from 0 Hz up, e.g. from
+// spectrum_ctxGetSpectrum(). The bins are added up into as many bars as
+// histogram_init() was given, low frequencies on the left.
+void histogram_plotSpectrum(const double spectrum[], uint16_t binCount);
+
 // Plots the FIR power (frequency response).
 // This plotting routine assumes that:
 // 1. The size of the array is FILTER_FIR_POWER_TEST_PERIOD_COUNT and it
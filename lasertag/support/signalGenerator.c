@@ -0,0 +1,221 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "filter.h"
+#include "signalGenerator.h"
+
+// Random numbers come from splitmix64 applied to key + index * GOLDEN, so
+// sample i gets its own random number without a state carried from sample
+// to sample.
+#define GOLDEN 0x9e3779b97f4a7c15ull
+#define MIX_1 0xbf58476d1ce4e5b9ull
+#define MIX_2 0x94d049bb133111ebull
+#define IMPULSE_SALT 0x5bd1e9955bd1e995ull
+// Gaussian noise is the sum of the four 16-bit quarters of a random number
+// (Irwin-Hall), which is close to normal out to its ends at +-3.46 sigma.
+#define QUARTER_MASK 0xffff
+#define QUARTER_SUM_MEAN (2.0 * QUARTER_MASK)
+#define QUARTER_SUM_SIGMA 37837.23 // sqrt((65536^2 - 1) / 3)
+#define PHASE_BITS 32
+#define FLICKER_INDEX_SHIFT (PHASE_BITS - 10) // 10 bits index the table.
+#if (1 << (PHASE_BITS - FLICKER_INDEX_SHIFT)) !=                              \
+    SIGNALGENERATOR_FLICKER_TABLE_SIZE
+#error "FLICKER_INDEX_SHIFT does not match SIGNALGENERATOR_FLICKER_TABLE_SIZE."
+#endif
+#define TWO_TO_32 4294967296.0
+#define PI 3.14159265358979323846
+
+static inline uint64_t mix(uint64_t z) {
+  z = (z ^ (z >> 30)) * MIX_1;
+  z = (z ^ (z >> 27)) * MIX_2;
+  return z ^ (z >> 31);
+}
+
+// Lamps on the mains flicker at twice the mains frequency with the harmonics
+// of a full-wave rectified sine, 3 / (4k^2 - 1) of the fundamental for the
+// k-th. One period goes in the table.
+static void makeFlickerTable(signalGenerator_t *gen) {
+  const signalGenerator_config_t *config = &gen->config;
+  for (uint32_t j = 0; j < SIGNALGENERATOR_FLICKER_TABLE_SIZE; j++) {
+    double value = 0;
+    for (uint16_t k = 1; k <= config->flickerHarmonics; k++)
+      value -= 3.0 / (4.0 * k * k - 1) *
+               cos(2 * PI * k * j / SIGNALGENERATOR_FLICKER_TABLE_SIZE);
+    gen->flicker[j] = value * config->flickerAmplitude;
+  }
+  double flickerHz = 2 * config->mainsHz;
+  gen->flickerStep =
+      (uint32_t)(flickerHz / SIGNALGENERATOR_SAMPLE_RATE * TWO_TO_32 + 0.5);
+}
+
+// Sets up a generator at sample 0, with no bursts.
+bool signalGenerator_init(signalGenerator_t *gen,
+                          const signalGenerator_config_t *config) {
+  if (config->noiseSigma < 0 || config->impulseRate < 0 ||
+      config->impulseRate > 1 || config->mainsHz < 0 ||
+      config->mainsHz >= SIGNALGENERATOR_SAMPLE_RATE / 4 ||
+      config->flickerHarmonics > SIGNALGENERATOR_MAX_HARMONICS) {
+    printf("signalGenerator: configuration out of range.\n");
+    return false;
+  }
+  memset(gen, 0, sizeof(*gen));
+  gen->config = *config;
+  gen->noiseKey = mix(config->seed);
+  gen->impulseKey = mix(config->seed ^ IMPULSE_SALT);
+  gen->impulseThreshold = (uint64_t)(config->impulseRate * TWO_TO_32);
+  makeFlickerTable(gen);
+  return true;
+}
+
+// Gives the generator its bursts, sorted by start.
+bool signalGenerator_setBursts(signalGenerator_t *gen,
+                               const signalGenerator_burst_t bursts[],
+                               uint32_t count) {
+  for (uint32_t i = 0; i < count; i++) {
+    if (bursts[i].frequencyNumber >= FILTER_FREQUENCY_COUNT ||
+        (i > 0 && bursts[i].start < bursts[i - 1].start)) {
+      printf("signalGenerator: burst %u is out of order or has no "
+             "frequency.\n",
+             i);
+      return false;
+    }
+  }
+  gen->bursts = bursts;
+  gen->burstCount = count;
+  gen->firstBurst = 0;
+  return true;
+}
+
+// Moves to a sample index.
+void signalGenerator_seek(signalGenerator_t *gen, uint64_t position) {
+  gen->position = position;
+  gen->firstBurst = 0; // generate() skips the bursts that have ended.
+}
+
+// Index of the next sample.
+uint64_t signalGenerator_getPosition(const signalGenerator_t *gen) {
+  return gen->position;
+}
+
+// Everything but the bursts: mid-scale, DC offset, noise, impulses and
+// flicker, for count samples from index first.
+static void addBackground(const signalGenerator_t *gen, double work[],
+                          uint64_t first, uint32_t count) {
+  const signalGenerator_config_t *config = &gen->config;
+  double base = SIGNALGENERATOR_ADC_MIDSCALE + config->dcOffset;
+  double noiseScale = config->noiseSigma / QUARTER_SUM_SIGMA;
+  double impulse = config->impulseAmplitude;
+  uint64_t threshold = gen->impulseThreshold;
+  uint64_t noiseKey = gen->noiseKey + first * GOLDEN;
+  uint64_t impulseKey = gen->impulseKey + first * GOLDEN;
+  uint32_t phase = (uint32_t)first * gen->flickerStep;
+  uint32_t step = gen->flickerStep;
+  const float *flicker = gen->flicker;
+  for (uint32_t i = 0; i < count; i++) {
+    uint64_t r = mix(noiseKey + i * GOLDEN);
+    uint32_t sum = (uint32_t)(r & QUARTER_MASK) +
+                   (uint32_t)(r >> 16 & QUARTER_MASK) +
+                   (uint32_t)(r >> 32 & QUARTER_MASK) + (uint32_t)(r >> 48);
+    uint64_t q = mix(impulseKey + i * GOLDEN);
+    double spike = (q >> PHASE_BITS) < threshold ? (q & 1 ? impulse : -impulse)
+                                                 : 0;
+    uint32_t p = phase + (uint32_t)i * step;
+    work[i] = base + (sum - QUARTER_SUM_MEAN) * noiseScale + spike +
+              flicker[p >> FLICKER_INDEX_SHIFT];
+  }
+}
+
+// Adds the part of a burst that falls on count samples from index first.
+// The square wave is high for the first half of each period; the samples are
+// added a half period at a time so the inner loop has no branches.
+static void addBurst(const signalGenerator_burst_t *burst, double work[],
+                     uint64_t first, uint32_t count) {
+  uint64_t end = burst->start + burst->length;
+  uint64_t from = burst->start > first ? burst->start : first;
+  uint64_t to = end < first + count ? end : first + count;
+  uint16_t period = filter_frequencyTickTable[burst->frequencyNumber];
+  uint16_t half = period / 2;
+  double ramp = burst->ramp ? burst->ramp : 1;
+  while (from < to) {
+    uint64_t t = from - burst->start; // Samples into the burst.
+    uint32_t inPeriod = t % period;
+    double sign = inPeriod < half ? 1 : -1;
+    uint64_t segmentEnd = from + (inPeriod < half ? half : period) - inPeriod;
+    if (segmentEnd > to)
+      segmentEnd = to;
+    double *out = work + (from - first);
+    uint32_t n = segmentEnd - from;
+    // The envelope is the distance to the nearer end of the burst over the
+    // ramp, at most 1.
+    double rise = t + 1.0;
+    double fall = (double)(end - from);
+    for (uint32_t i = 0; i < n; i++) {
+      double edge = fmin(rise + i, fall - i) / ramp;
+      out[i] += sign * burst->amplitude * fmin(edge, 1.0);
+    }
+    from = segmentEnd;
+  }
+}
+
+// Rounds to the nearest ADC code, clipping at the ends of the range.
+static void clip(const double work[], uint16_t samples[], uint32_t count) {
+  for (uint32_t i = 0; i < count; i++) {
+    double value = work[i] + 0.5;
+    value = value < 0 ? 0 : value;
+    value = value > SIGNALGENERATOR_ADC_MAX ? SIGNALGENERATOR_ADC_MAX : value;
+    samples[i] = (uint16_t)(int32_t)value;
+  }
+}
+
+// Writes the next count samples.
+void signalGenerator_generate(signalGenerator_t *gen, uint16_t samples[],
+                              uint32_t count) {
+  double work[SIGNALGENERATOR_BLOCK_SIZE];
+  while (count) {
+    uint32_t n =
+        count < SIGNALGENERATOR_BLOCK_SIZE ? count : SIGNALGENERATOR_BLOCK_SIZE;
+    uint64_t first = gen->position;
+    addBackground(gen, work, first, n);
+    while (gen->firstBurst < gen->burstCount &&
+           gen->bursts[gen->firstBurst].start +
+                   gen->bursts[gen->firstBurst].length <=
+               first)
+      gen->firstBurst++;
+    for (uint32_t b = gen->firstBurst;
+         b < gen->burstCount && gen->bursts[b].start < first + n; b++)
+      addBurst(&gen->bursts[b], work, first, n);
+    clip(work, samples, n);
+    gen->position += n;
+    samples += n;
+    count -= n;
+  }
+}
+
+// Fills bursts[] with one shot every period samples.
+uint32_t signalGenerator_makeShots(signalGenerator_burst_t bursts[],
+                                   uint32_t maxBursts, uint64_t sampleCount,
+                                   uint64_t first, uint64_t period,
+                                   const uint16_t frequencies[],
+                                   uint16_t frequencyCount, double amplitude,
+                                   uint32_t ramp) {
+  uint32_t count = 0;
+  for (uint64_t start = first; start < sampleCount && count < maxBursts;
+       start += period, count++)
+    bursts[count] = (signalGenerator_burst_t){
+        .start = start,
+        .length = SIGNALGENERATOR_SHOT_SAMPLES,
+        .ramp = ramp,
+        .frequencyNumber = frequencies[count % frequencyCount],
+        .amplitude = amplitude};
+  return count;
+}
@@ -0,0 +1,104 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef SIGNALGENERATOR_H_
+#define SIGNALGENERATOR_H_
+
+// Synthetic 12-bit ADC streams for tests and benchmarks: what the receiver
+// would see from any mix of the ten transmitter frequencies, with amplitude
+// envelopes, on top of Gaussian and impulsive noise, a DC offset and the
+// flicker of lamps on the mains, clipped to the ADC range.
+//
+// Every sample depends only on the seed and its index, never on how the
+// stream is split into calls, so the same configuration always gives the
+// same samples and a benchmark can regenerate any stretch of a stream. The
+// work is done in blocks of SIGNALGENERATOR_BLOCK_SIZE samples by loops with
+// no branches, which the compiler vectorizes.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define SIGNALGENERATOR_SAMPLE_RATE 100000 // Hz, one sample per ISR tick.
+#define SIGNALGENERATOR_ADC_MAX 4095
+#define SIGNALGENERATOR_ADC_MIDSCALE 2048
+#define SIGNALGENERATOR_BLOCK_SIZE 256
+#define SIGNALGENERATOR_SHOT_SAMPLES 20000 // 200 ms, one shot.
+#define SIGNALGENERATOR_FLICKER_TABLE_SIZE 1024 // One flicker period.
+#define SIGNALGENERATOR_MAX_HARMONICS 16
+
+// A tone: the square wave of one transmitter frequency, from the sample at
+// start for length samples. The amplitude (ADC counts, peak) rises linearly
+// over the first ramp samples and falls over the last ramp samples.
+typedef struct {
+  uint64_t start;
+  uint32_t length;
+  uint32_t ramp;
+  uint16_t frequencyNumber; // Index into filter_frequencyTickTable.
+  double amplitude;
+} signalGenerator_burst_t;
+
+typedef struct {
+  uint64_t seed;
+  double dcOffset;         // ADC counts from mid-scale.
+  double noiseSigma;       // Gaussian noise, ADC counts.
+  double impulseRate;      // Chance of an impulse at any sample, 0 .. 1.
+  double impulseAmplitude; // ADC counts, the sign is random.
+  double mainsHz;          // 50 or 60, lamps flicker at twice this.
+  double flickerAmplitude; // ADC counts, of the flicker fundamental.
+  uint16_t flickerHarmonics; // Up to SIGNALGENERATOR_MAX_HARMONICS.
+} signalGenerator_config_t;
+
+typedef struct {
+  signalGenerator_config_t config;
+  const signalGenerator_burst_t *bursts; // Sorted by start, see setBursts().
+  uint32_t burstCount;
+  uint32_t firstBurst; // Bursts before this one have ended.
+  uint64_t position;   // Index of the next sample.
+  uint32_t flickerStep; // Flicker phase per sample, 2^32 is a period.
+  uint64_t noiseKey;    // The noise and impulse streams are independent.
+  uint64_t impulseKey;
+  uint64_t impulseThreshold; // Impulse where a 32-bit random is below this.
+  float flicker[SIGNALGENERATOR_FLICKER_TABLE_SIZE];
+} signalGenerator_t;
+
+// Sets up a generator at sample 0, with no bursts. Returns false if the
+// configuration is out of range.
+bool signalGenerator_init(signalGenerator_t *gen,
+                          const signalGenerator_config_t *config);
+
+// Gives the generator its bursts, sorted by start; they may overlap. The
+// array is not copied and must live as long as the generator uses it.
+// Returns false if a burst has an unknown frequency or the array is not
+// sorted.
+bool signalGenerator_setBursts(signalGenerator_t *gen,
+                               const signalGenerator_burst_t bursts[],
+                               uint32_t count);
+
+// Moves to a sample index, generate() continues from there.
+void signalGenerator_seek(signalGenerator_t *gen, uint64_t position);
+
+// Index of the next sample.
+uint64_t signalGenerator_getPosition(const signalGenerator_t *gen);
+
+// Writes the next count samples, 0 .. SIGNALGENERATOR_ADC_MAX.
+void signalGenerator_generate(signalGenerator_t *gen, uint16_t samples[],
+                              uint32_t count);
+
+// Fills bursts[] with one shot (SIGNALGENERATOR_SHOT_SAMPLES long, with the
+// given ramp) every period samples, starting at sample first, cycling through
+// the frequency numbers in frequencies[] (frequencyCount of them). Returns the
+// number of bursts, at most maxBursts, that start before sampleCount.
+uint32_t signalGenerator_makeShots(signalGenerator_burst_t bursts[],
+                                   uint32_t maxBursts, uint64_t sampleCount,
+                                   uint64_t first, uint64_t period,
+                                   const uint16_t frequencies[],
+                                   uint16_t frequencyCount, double amplitude,
+                                   uint32_t ramp);
+
+#endif /* SIGNALGENERATOR_H_ */
@@ -0,0 +1,174 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#include <math.h>
+#include <stdio.h>
+
+#include "detector.h"
+#include "filter.h"
+#include "signalGenerator.h"
+#include "signalGeneratorTest.h"
+
+#define TEST_SEED 42
+#define TEST_SAMPLE_COUNT 30000
+#define TEST_SEEK_TO 12345
+#define TEST_DC_OFFSET 100.0
+#define TEST_NOISE_SIGMA 50.0
+#define TEST_MEAN_TOLERANCE 1.0    // ADC counts.
+#define TEST_SIGMA_TOLERANCE 0.03  // Of the sigma.
+#define TEST_IMPULSE_RATE 0.01
+#define TEST_IMPULSE_AMPLITUDE 1000.0
+#define TEST_IMPULSE_TOLERANCE 0.2 // Of the expected count.
+#define TEST_SHOT_FREQUENCY 6
+#define TEST_SHOT_START 5000
+#define TEST_SHOT_AMPLITUDE 800.0
+#define TEST_SHOT_RAMP 500
+#define TEST_FLICKER_AMPLITUDE 300.0
+#define TEST_MAINS_HZ 60.0
+#define TEST_FLICKER_HARMONICS 5
+#define TEST_RUN_SAMPLES 40000 // The shot and some silence after it.
+#define TEST_BLOCK_SIZE 1000
+
+static uint16_t samples[TEST_SAMPLE_COUNT];
+static uint16_t pieces[TEST_SAMPLE_COUNT];
+
+// A stream with a little of everything.
+static const signalGenerator_config_t busyConfig = {
+    .seed = TEST_SEED,
+    .dcOffset = TEST_DC_OFFSET,
+    .noiseSigma = TEST_NOISE_SIGMA,
+    .impulseRate = TEST_IMPULSE_RATE,
+    .impulseAmplitude = TEST_IMPULSE_AMPLITUDE,
+    .mainsHz = TEST_MAINS_HZ,
+    .flickerAmplitude = TEST_FLICKER_AMPLITUDE,
+    .flickerHarmonics = TEST_FLICKER_HARMONICS};
+
+static const signalGenerator_burst_t shot = {
+    .start = TEST_SHOT_START,
+    .length = SIGNALGENERATOR_SHOT_SAMPLES,
+    .ramp = TEST_SHOT_RAMP,
+    .frequencyNumber = TEST_SHOT_FREQUENCY,
+    .amplitude = TEST_SHOT_AMPLITUDE};
+
+// Test 1: the same stream in one call, in odd-sized pieces and after a seek.
+static bool testSplitting() {
+  static const uint32_t pieceSizes[] = {1, 7, 255, 256, 257, 1000, 4093};
+  signalGenerator_t gen;
+  if (!signalGenerator_init(&gen, &busyConfig) ||
+      !signalGenerator_setBursts(&gen, &shot, 1))
+    return false;
+  signalGenerator_generate(&gen, samples, TEST_SAMPLE_COUNT);
+  signalGenerator_seek(&gen, 0);
+  for (uint32_t i = 0, p = 0; i < TEST_SAMPLE_COUNT; p++) {
+    uint32_t size = pieceSizes[p % (sizeof(pieceSizes) / sizeof(uint32_t))];
+    if (size > TEST_SAMPLE_COUNT - i)
+      size = TEST_SAMPLE_COUNT - i;
+    signalGenerator_generate(&gen, pieces + i, size);
+    i += size;
+  }
+  signalGenerator_seek(&gen, TEST_SEEK_TO);
+  signalGenerator_generate(&gen, pieces, TEST_SAMPLE_COUNT - TEST_SEEK_TO);
+  for (uint32_t i = 0; i < TEST_SAMPLE_COUNT; i++) {
+    uint16_t expected = i < TEST_SAMPLE_COUNT - TEST_SEEK_TO
+                            ? samples[i + TEST_SEEK_TO]
+                            : samples[i];
+    if (pieces[i] != expected) {
+      printf("Test 1 failed. Sample %u is %u, %u in one call.\n", i,
+             pieces[i], expected);
+      return false;
+    }
+  }
+  return true;
+}
+
+// Test 2: mean and sigma of plain noise, then the share of impulses.
+static bool testNoise() {
+  signalGenerator_t gen;
+  signalGenerator_config_t config = {.seed = TEST_SEED,
+                                     .dcOffset = TEST_DC_OFFSET,
+                                     .noiseSigma = TEST_NOISE_SIGMA};
+  if (!signalGenerator_init(&gen, &config))
+    return false;
+  signalGenerator_generate(&gen, samples, TEST_SAMPLE_COUNT);
+  double sum = 0;
+  double squares = 0;
+  for (uint32_t i = 0; i < TEST_SAMPLE_COUNT; i++) {
+    sum += samples[i];
+    squares += (double)samples[i] * samples[i];
+  }
+  double mean = sum / TEST_SAMPLE_COUNT;
+  double sigma = sqrt(squares / TEST_SAMPLE_COUNT - mean * mean);
+  if (fabs(mean - SIGNALGENERATOR_ADC_MIDSCALE - TEST_DC_OFFSET) >
+          TEST_MEAN_TOLERANCE ||
+      fabs(sigma - TEST_NOISE_SIGMA) > TEST_SIGMA_TOLERANCE * TEST_NOISE_SIGMA) {
+    printf("Test 2 failed. Noise mean %.2f, sigma %.2f.\n", mean, sigma);
+    return false;
+  }
+
+  config = (signalGenerator_config_t){
+      .seed = TEST_SEED,
+      .impulseRate = TEST_IMPULSE_RATE,
+      .impulseAmplitude = TEST_IMPULSE_AMPLITUDE};
+  if (!signalGenerator_init(&gen, &config))
+    return false;
+  signalGenerator_generate(&gen, samples, TEST_SAMPLE_COUNT);
+  uint32_t impulses = 0;
+  for (uint32_t i = 0; i < TEST_SAMPLE_COUNT; i++)
+    impulses += samples[i] != SIGNALGENERATOR_ADC_MIDSCALE;
+  double expected = TEST_IMPULSE_RATE * TEST_SAMPLE_COUNT;
+  if (fabs(impulses - expected) > TEST_IMPULSE_TOLERANCE * expected) {
+    printf("Test 2 failed. %u impulses, expected about %.0f.\n", impulses,
+           expected);
+    return false;
+  }
+  return true;
+}
+
+// Test 3: the shot, on top of noise, impulses and flicker, is one hit on its
+// frequency.
+static bool testShot() {
+  static filter_ctx_t filter;
+  static detector_ctx_t detector;
+  uint16_t block[TEST_BLOCK_SIZE];
+  uint32_t wide[TEST_BLOCK_SIZE];
+  signalGenerator_t gen;
+  if (!signalGenerator_init(&gen, &busyConfig) ||
+      !signalGenerator_setBursts(&gen, &shot, 1))
+    return false;
+  filter_ctxInit(&filter);
+  detector_ctxInit(&detector, &filter, NULL);
+  for (uint32_t i = 0; i < TEST_RUN_SAMPLES; i += TEST_BLOCK_SIZE) {
+    signalGenerator_generate(&gen, block, TEST_BLOCK_SIZE);
+    for (uint32_t j = 0; j < TEST_BLOCK_SIZE; j++)
+      wide[j] = block[j];
+    detector_ctxRun(&detector, wide, TEST_BLOCK_SIZE);
+  }
+  detector_hitCount_t hitCounts[FILTER_FREQUENCY_COUNT];
+  detector_ctxGetHitCounts(&detector, hitCounts);
+  bool passed = detector_ctxHitDetected(&detector) &&
+                detector_ctxGetFrequencyNumberOfLastHit(&detector) ==
+                    TEST_SHOT_FREQUENCY &&
+                hitCounts[TEST_SHOT_FREQUENCY] == 1;
+  if (!passed)
+    printf("Test 3 failed. The shot on frequency %d was not exactly one hit.\n",
+           TEST_SHOT_FREQUENCY);
+  filter_ctxFree(&filter);
+  return passed;
+}
+
+// Runs all tests.
+bool signalGenerator_runTest(void) {
+  printf("***************** signalGenerator_runTest() *****************\n");
+  bool success = testSplitting();
+  success = testNoise() && success;
+  success = testShot() && success;
+  printf(success ? "signalGenerator_runTest() passed.\n"
+                 : "signalGenerator_runTest() failed.\n");
+  return success;
+}
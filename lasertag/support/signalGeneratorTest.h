@@ -0,0 +1,21 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef SIGNALGENERATORTEST_H_
+#define SIGNALGENERATORTEST_H_
+
+#include <stdbool.h>
+
+// Checks that generated streams do not depend on how they are split into
+// calls, that the noise has the configured statistics, and that a shot on
+// top of noise and flicker is detected on its frequency. Returns true if all
+// tests pass.
+bool signalGenerator_runTest(void);
+
+#endif /* SIGNALGENERATORTEST_H_ */
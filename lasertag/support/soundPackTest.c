@@ -0,0 +1,140 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "sound.h"
+#include "soundPack.h"
+#include "soundPackTest.h"
+
+#define TEST_ENTRY_COUNT 2
+#define TEST_SAMPLE_COUNT 4 // Per entry.
+#define TEST_SAMPLE_RATE 16000
+#define TEST_SOUND sound_gunClick_e // Named by entry 0.
+#define TEST_SOUND_NAME "gunEmpty48k"
+#define TEST_OTHER_NAME "notInTheGame"
+
+// A pack as wav2c -pack lays it out: header, index, then the samples.
+typedef struct {
+  soundPack_header_t header;
+  soundPack_entry_t entries[TEST_ENTRY_COUNT];
+  uint16_t samples[TEST_ENTRY_COUNT][TEST_SAMPLE_COUNT];
+} testPack_t;
+
+// Fills in a valid pack.
+static void makePack(testPack_t *pack) {
+  static const char *names[TEST_ENTRY_COUNT] = {TEST_SOUND_NAME,
+                                                TEST_OTHER_NAME};
+  memset(pack, 0, sizeof(*pack));
+  pack->header = (soundPack_header_t){.magic = SOUND_PACK_MAGIC,
+                                      .version = SOUND_PACK_VERSION,
+                                      .entryCount = TEST_ENTRY_COUNT,
+                                      .packSize = sizeof(*pack)};
+  for (uint16_t e = 0; e < TEST_ENTRY_COUNT; e++) {
+    soundPack_entry_t *entry = &pack->entries[e];
+    strncpy(entry->name, names[e], SOUND_PACK_NAME_SIZE - 1);
+    entry->sampleRate = TEST_SAMPLE_RATE;
+    entry->sampleCount = TEST_SAMPLE_COUNT;
+    entry->encoding = soundPack_pcm16Unsigned_e;
+    entry->bitsPerSample = 16;
+    entry->offset = offsetof(testPack_t, samples) +
+                    e * TEST_SAMPLE_COUNT * sizeof(uint16_t);
+    for (uint16_t i = 0; i < TEST_SAMPLE_COUNT; i++)
+      pack->samples[e][i] = 1000 * (e + 1) + i;
+  }
+}
+
+// Test 2: soundPack_open() turns down a pack with one thing wrong.
+static bool testBadPacks(void) {
+  static testPack_t pack;
+  soundPack_t opened;
+  bool success = true;
+  for (uint16_t bad = 0; bad < 4; bad++) {
+    makePack(&pack);
+    uint32_t size = sizeof(pack);
+    const char *what = "";
+    switch (bad) {
+    case 0:
+      pack.header.magic++;
+      what = "a bad magic number";
+      break;
+    case 1:
+      size--;
+      what = "a truncated pack";
+      break;
+    case 2:
+      pack.entries[1].sampleCount++;
+      what = "a clip past the end";
+      break;
+    case 3:
+      pack.entries[1].offset += 2;
+      what = "an unaligned clip";
+      break;
+    }
+    if (soundPack_open(&opened, &pack, size) || opened.entryCount != 0) {
+      printf("Test 2 failed. soundPack_open() took %s.\n", what);
+      success = false;
+    }
+  }
+  return success;
+}
+
+// Runs all tests.
+bool soundPack_runTest(void) {
+  printf("****************** soundPack_runTest() ******************\n");
+  static testPack_t pack;
+  soundPack_t opened;
+  bool success = true;
+
+  // Test 1: a good pack opens and its entries are found by name.
+  makePack(&pack);
+  if (!soundPack_open(&opened, &pack, sizeof(pack)) ||
+      opened.entryCount != TEST_ENTRY_COUNT) {
+    printf("Test 1 failed. soundPack_open() turned down a good pack.\n");
+    return false;
+  }
+  const soundPack_entry_t *entry =
+      soundPack_findEntry(&opened, TEST_OTHER_NAME);
+  if (entry != &pack.entries[1] ||
+      soundPack_getSamples(&opened, entry) != pack.samples[1] ||
+      soundPack_findEntry(&opened, "ouch48k") != NULL) {
+    printf("Test 1 failed. The entries were not found by name.\n");
+    success = false;
+  }
+
+  success = testBadPacks() && success;
+
+  // Test 3: sound_usePack() takes the sound the pack names, leaves the others
+  // alone, and sound_usePack(NULL) goes back.
+  uint32_t builtinCount, builtinRate, count, rate;
+  const uint16_t *builtin =
+      sound_getSamples(TEST_SOUND, &builtinCount, &builtinRate);
+  const uint16_t *other = sound_getSamples(sound_hit_e, &count, &rate);
+  if (sound_usePack(&opened) != SOUND_STATUS_OK ||
+      sound_getSamples(TEST_SOUND, &count, &rate) != pack.samples[0] ||
+      count != TEST_SAMPLE_COUNT || rate != TEST_SAMPLE_RATE ||
+      sound_getSamples(sound_hit_e, &count, &rate) != other) {
+    printf("Test 3 failed. sound_usePack() did not match the sounds by "
+           "name.\n");
+    success = false;
+  }
+  if (sound_usePack(NULL) != SOUND_STATUS_OK ||
+      sound_getSamples(TEST_SOUND, &count, &rate) != builtin ||
+      count != builtinCount || rate != builtinRate) {
+    printf("Test 3 failed. sound_usePack(NULL) did not go back to the "
+           "built-in sounds.\n");
+    success = false;
+  }
+
+  printf(success ? "soundPack_runTest() passed.\n"
+                 : "soundPack_runTest() failed.\n");
+  return success;
+}
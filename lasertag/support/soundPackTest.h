@@ -0,0 +1,20 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef SOUNDPACKTEST_H_
+#define SOUNDPACKTEST_H_
+
+#include <stdbool.h>
+
+// Builds a small sound pack in memory and checks that soundPack_open()
+// validates it and that sound_usePack() takes the sounds it names.
+// Returns true if all tests pass.
+bool soundPack_runTest(void);
+
+#endif /* SOUNDPACKTEST_H_ */
@@ -0,0 +1,108 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#include <math.h>
+#include <stdio.h>
+
+#include "detectorBench.h"
+#include "intervalTimer.h"
+#include "spectrum.h"
+#include "spectrumBench.h"
+#include "xparameters.h"
+
+#define BENCH_TIMER INTERVAL_TIMER_TIMER_0
+#define BOARD_REPEATS 3
+#define NS_PER_SECOND 1e9
+#define PERCENT 100.0
+#define MS_PER_SECOND 1000.0
+// The input, so that the FFT works on numbers that are neither 0 nor denormal.
+#define INPUT_STEP 0.37
+#define INPUT_AMPLITUDE 100.0
+
+// Seconds for SPECTRUMBENCH_POINTS points' worth of FFTs.
+static double timeSize(spectrum_ctx_t *ctx) {
+  uint32_t runs = SPECTRUMBENCH_POINTS / ctx->size;
+  intervalTimer_reset(BENCH_TIMER);
+  intervalTimer_start(BENCH_TIMER);
+  for (uint32_t i = 0; i < runs; i++)
+    spectrum_ctxCompute(ctx);
+  intervalTimer_stop(BENCH_TIMER);
+  return intervalTimer_getTotalDurationInSeconds(BENCH_TIMER) / runs;
+}
+
+// Times every size. The sizes take turns, as the passes of detectorBench do.
+bool spectrumBench_run(spectrumBench_results_t *results, uint16_t repeats) {
+  static spectrum_ctx_t ctxs[SPECTRUMBENCH_SIZE_COUNT];
+  double fastest[SPECTRUMBENCH_SIZE_COUNT];
+  uint16_t s;
+  for (s = 0; s < SPECTRUMBENCH_SIZE_COUNT; s++) {
+    results->sizes[s] = SPECTRUM_MIN_SIZE << s;
+    if (!spectrum_ctxInit(&ctxs[s], results->sizes[s], results->sizes[s]))
+      break;
+    for (uint16_t i = 0; i < results->sizes[s]; i++)
+      spectrum_ctxAddSample(&ctxs[s], INPUT_AMPLITUDE * sin(i * INPUT_STEP));
+  }
+  if (s < SPECTRUMBENCH_SIZE_COUNT) {
+    printf("spectrumBench: unable to allocate a %u-point FFT.\n",
+           results->sizes[s]);
+    while (s--)
+      spectrum_ctxFree(&ctxs[s]);
+    return false;
+  }
+  intervalTimer_init(BENCH_TIMER);
+  results->repeats = repeats ? repeats : 1;
+  for (uint16_t r = 0; r < results->repeats; r++) {
+    for (s = 0; s < SPECTRUMBENCH_SIZE_COUNT; s++) {
+      double seconds = timeSize(&ctxs[s]);
+      if (r == 0 || seconds < fastest[s])
+        fastest[s] = seconds;
+    }
+  }
+  for (s = 0; s < SPECTRUMBENCH_SIZE_COUNT; s++) {
+    uint32_t adcSamplesPerHop = (uint32_t)results->sizes[s] /
+                                SPECTRUMBENCH_HOP_DIVISOR *
+                                FILTER_FIR_DECIMATION_FACTOR;
+    results->nsPerFft[s] = fastest[s] * NS_PER_SECOND;
+    results->nsPerSample[s] = results->nsPerFft[s] / adcSamplesPerHop;
+    spectrum_ctxFree(&ctxs[s]);
+  }
+  return true;
+}
+
+// Prints the time of every size against the real-time budget.
+void spectrumBench_print(const spectrumBench_results_t *results, double cpuHz) {
+  double budgetNs = NS_PER_SECOND / DETECTORBENCH_SAMPLE_RATE;
+  printf("spectrumBench: fastest of %u runs, an FFT every size / %d FIR "
+         "outputs",
+         results->repeats, SPECTRUMBENCH_HOP_DIVISOR);
+  if (cpuHz > 0)
+    printf(", %.0f MHz", cpuHz / 1e6);
+  printf("\n%5s %9s %11s %13s %10s %10s\n", "size", "window", "ns/FFT",
+         "cycles/FFT", "ns/sample", "of budget");
+  for (uint16_t s = 0; s < SPECTRUMBENCH_SIZE_COUNT; s++) {
+    printf("%5u %6.1f ms %11.0f ", results->sizes[s],
+           results->sizes[s] * MS_PER_SECOND / SPECTRUM_SAMPLE_RATE,
+           results->nsPerFft[s]);
+    if (cpuHz > 0)
+      printf("%13.0f ", results->nsPerFft[s] * cpuHz / NS_PER_SECOND);
+    else
+      printf("%13s ", "-");
+    printf("%10.1f %9.2f%%\n", results->nsPerSample[s],
+           results->nsPerSample[s] / budgetNs * PERCENT);
+  }
+}
+
+// Runs and prints the benchmark at the board's CPU clock.
+bool spectrumBench_report(void) {
+  spectrumBench_results_t results;
+  if (!spectrumBench_run(&results, BOARD_REPEATS))
+    return false;
+  spectrumBench_print(&results, XPAR_CPU_CORTEXA9_0_CPU_CLK_FREQ_HZ);
+  return true;
+}
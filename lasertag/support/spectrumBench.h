@@ -0,0 +1,47 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef SPECTRUMBENCH_H_
+#define SPECTRUMBENCH_H_
+
+// Measures how long spectrum_ctxCompute() (spectrum.h) takes for every FFT
+// size from SPECTRUM_MIN_SIZE to SPECTRUM_MAX_SIZE, on the board
+// (spectrumBench_report() from main.c) and on the host (lasertagBench -fft).
+// Each size runs SPECTRUMBENCH_POINTS points' worth of FFTs, timed with
+// interval timer 0, and the fastest of the repeats is kept. The cost per ADC
+// sample is for an FFT every size / SPECTRUMBENCH_HOP_DIVISOR FIR outputs,
+// to compare with the iir and power stages of detectorBench.h that it
+// replaces.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define SPECTRUMBENCH_SIZE_COUNT 5 // 256 to 4096.
+#define SPECTRUMBENCH_POINTS 262144
+#define SPECTRUMBENCH_HOP_DIVISOR 4
+
+typedef struct {
+  uint16_t sizes[SPECTRUMBENCH_SIZE_COUNT];
+  double nsPerFft[SPECTRUMBENCH_SIZE_COUNT];
+  double nsPerSample[SPECTRUMBENCH_SIZE_COUNT]; // Per ADC sample.
+  uint16_t repeats;
+} spectrumBench_results_t;
+
+// Times every FFT size, repeats times. Returns false if a context could not
+// be allocated.
+bool spectrumBench_run(spectrumBench_results_t *results, uint16_t repeats);
+
+// Prints ns and CPU cycles per FFT and the cost per ADC sample for every
+// size. cpuHz may be 0 if it is not known.
+void spectrumBench_print(const spectrumBench_results_t *results, double cpuHz);
+
+// Runs and prints the benchmark at the board's CPU clock.
+bool spectrumBench_report(void);
+
+#endif /* SPECTRUMBENCH_H_ */
@@ -0,0 +1,166 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#include <math.h>
+#include <stdio.h>
+
+#include "detector.h"
+#include "filter.h"
+#include "spectrum.h"
+#include "spectrumTest.h"
+#include "syntheticGame.h"
+
+#define PI 3.14159265358979323846
+#define TEST_DFT_SIZE 512 // The plain DFT takes size^2 steps.
+#define TEST_DFT_TOLERANCE 1e-9 // Of the largest bin.
+#define TEST_TONE_SIZE 1024
+#define TEST_TONE_FREQUENCY 4
+#define TEST_TONE_AMPLITUDE 0.5
+#define TEST_TONE_TOLERANCE 0.05 // Of the tone's power.
+#define TEST_LEAK_RATIO 0.01 // Another band's power over the tone's.
+// The game: as in filterGateTest, a shot a second, run through a 1024-point
+// FFT every 256 FIR outputs.
+#define TEST_GAME_SIZE 1024
+#define TEST_GAME_HOP 256
+#define TEST_SHOT_COUNT 6
+#define SAMPLES_PER_MS SYNTHETICGAME_SAMPLES_PER_MS
+
+static const uint16_t shotFrequencies[TEST_SHOT_COUNT] = {1, 3, 5, 7, 8, 9};
+static const double shotAmplitudes[TEST_SHOT_COUNT] = {70,  100, 150,
+                                                       250, 500, 1000};
+
+static const syntheticGame_t game = {.seed = 7,
+                                     .impulseRate = 0.00001,
+                                     .impulseAmplitude = 200.0,
+                                     .shotEvery = 100000,
+                                     .shotCount = TEST_SHOT_COUNT,
+                                     .frequencies = shotFrequencies,
+                                     .amplitudes = shotAmplitudes};
+
+// A made-up signal for the DFT test: two tones off the bins and a ramp.
+static double testSignal(uint32_t n) {
+  return sin(2 * PI * 0.1234 * n) + 0.3 * cos(2 * PI * 0.3771 * n + 1) +
+         0.001 * n;
+}
+
+// Test 1: the spectrum is the power of the DFT of the windowed input.
+static bool testDft(void) {
+  static spectrum_ctx_t ctx;
+  if (!spectrum_ctxInit(&ctx, TEST_DFT_SIZE, TEST_DFT_SIZE))
+    return false;
+  // The first FFT comes after size inputs, with input 0 the oldest.
+  for (uint32_t n = 0; n < TEST_DFT_SIZE; n++)
+    spectrum_ctxAddSample(&ctx, testSignal(n));
+  const double *spectrum = spectrum_ctxGetSpectrum(&ctx);
+  double windowSquares = 0;
+  for (uint32_t n = 0; n < TEST_DFT_SIZE; n++)
+    windowSquares += ctx.window[n] * ctx.window[n];
+  double expected[TEST_DFT_SIZE / 2 + 1];
+  double largest = 0;
+  for (uint32_t k = 0; k <= TEST_DFT_SIZE / 2; k++) {
+    double re = 0, im = 0;
+    for (uint32_t n = 0; n < TEST_DFT_SIZE; n++) {
+      double x = testSignal(n) * ctx.window[n];
+      re += x * cos(2 * PI * k * n / TEST_DFT_SIZE);
+      im -= x * sin(2 * PI * k * n / TEST_DFT_SIZE);
+    }
+    expected[k] = (re * re + im * im) * 2 / windowSquares *
+                  FILTER_INPUT_PULSE_WIDTH / TEST_DFT_SIZE;
+    largest = expected[k] > largest ? expected[k] : largest;
+  }
+  bool success = true;
+  for (uint32_t k = 0; k <= TEST_DFT_SIZE / 2 && success; k++) {
+    if (fabs(spectrum[k] - expected[k]) > TEST_DFT_TOLERANCE * largest) {
+      printf("Test 1 failed. Bin %u is %le, the DFT gives %le.\n", k,
+             spectrum[k], expected[k]);
+      success = false;
+    }
+  }
+  spectrum_ctxFree(&ctx);
+  return success;
+}
+
+// Test 2: a tone on a user frequency has the power it would have in the IIR
+// filters' window (amplitude^2 / 2 per output), and the other bands little.
+static bool testTone(void) {
+  static spectrum_ctx_t ctx;
+  if (!spectrum_ctxInit(&ctx, TEST_TONE_SIZE, TEST_TONE_SIZE))
+    return false;
+  double hz = FILTER_SAMPLE_FREQUENCY_IN_KHZ * 1000.0 /
+              filter_frequencyTickTable[TEST_TONE_FREQUENCY];
+  for (uint32_t n = 0; n < TEST_TONE_SIZE; n++)
+    spectrum_ctxAddSample(&ctx, TEST_TONE_AMPLITUDE *
+                                    sin(2 * PI * hz * n / SPECTRUM_SAMPLE_RATE));
+  double powers[FILTER_FREQUENCY_COUNT];
+  spectrum_ctxGetBandPowers(&ctx, powers);
+  spectrum_ctxFree(&ctx);
+  double expected =
+      TEST_TONE_AMPLITUDE * TEST_TONE_AMPLITUDE / 2 * FILTER_INPUT_PULSE_WIDTH;
+  bool success = true;
+  for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++) {
+    if (i == TEST_TONE_FREQUENCY
+            ? fabs(powers[i] - expected) > TEST_TONE_TOLERANCE * expected
+            : powers[i] > TEST_LEAK_RATIO * expected) {
+      printf("Test 2 failed. Band %u has power %le for a tone of power %le "
+             "on frequency %d.\n",
+             i, powers[i], expected, TEST_TONE_FREQUENCY);
+      success = false;
+    }
+  }
+  return success;
+}
+
+// Test 3: a detector on the FFT engine hits every shot of a game once, on
+// its frequency.
+static bool testGame(void) {
+  static filter_ctx_t filter;
+  static detector_ctx_t detector;
+  static spectrum_ctx_t spectrum;
+  syntheticGame_hitLog_t log;
+
+  if (!spectrum_ctxInit(&spectrum, TEST_GAME_SIZE, TEST_GAME_HOP))
+    return false;
+  syntheticGame_initDetector(&detector, &filter);
+  detector_ctxSetSpectrum(&detector, &spectrum);
+  bool ran = syntheticGame_run(&game, &detector, &log);
+  filter_ctxFree(&filter);
+  spectrum_ctxFree(&spectrum);
+  if (!ran)
+    return false;
+
+  if (log.hitCount != TEST_SHOT_COUNT) {
+    printf("Test 3 failed. %u hits, expected %d.\n", log.hitCount,
+           TEST_SHOT_COUNT);
+    return false;
+  }
+  bool success = true;
+  for (uint16_t i = 0; i < TEST_SHOT_COUNT; i++) {
+    printf("Shot %u (amplitude %.0f): hit on frequency %u after %.1f ms.\n", i,
+           shotAmplitudes[i], log.hitFrequencies[i],
+           (double)(log.hitPositions[i] - syntheticGame_shotStart(&game, i)) /
+               SAMPLES_PER_MS);
+    if (log.hitFrequencies[i] != shotFrequencies[i]) {
+      printf("Test 3 failed. Shot %u was on frequency %u.\n", i,
+             shotFrequencies[i]);
+      success = false;
+    }
+  }
+  return success;
+}
+
+// Runs all tests.
+bool spectrum_runTest(void) {
+  printf("***************** spectrum_runTest() *****************\n");
+  bool success = testDft();
+  success = testTone() && success;
+  success = testGame() && success;
+  printf(success ? "spectrum_runTest() passed.\n"
+                 : "spectrum_runTest() failed.\n");
+  return success;
+}
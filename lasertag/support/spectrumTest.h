@@ -0,0 +1,22 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef SPECTRUMTEST_H_
+#define SPECTRUMTEST_H_
+
+#include <stdbool.h>
+
+// Checks the FFT engine (spectrum.h): its spectrum against a plain DFT, the
+// power of a tone against what the IIR filters' power would be, and a
+// detector running on it instead of the IIR filters through a synthetic game
+// (signalGenerator.h), one hit per shot on the shot's frequency. Returns true
+// if all tests pass.
+bool spectrum_runTest(void);
+
+#endif /* SPECTRUMTEST_H_ */
@@ -0,0 +1,87 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#include "filter.h"
+#include "syntheticGame.h"
+
+#define BLOCK_SIZE 1000
+
+// Logs every hit.
+static void logHit(detector_ctx_t *ctx) {
+  syntheticGame_hitLog_t *log = ctx->user;
+  if (log->hitCount < SYNTHETICGAME_MAX_SHOTS) {
+    log->hitPositions[log->hitCount] = log->position;
+    log->hitFrequencies[log->hitCount] = ctx->frequencyDetected;
+  }
+  log->hitCount++;
+}
+
+static const detector_hooks_t hooks = {.hitHandler = logHit};
+
+// Initializes filter and detector for a game.
+void syntheticGame_initDetector(detector_ctx_t *detector,
+                                filter_ctx_t *filter) {
+  filter_ctxInit(filter);
+  detector_ctxInit(detector, filter, &hooks);
+  detector_ctxSetFreezeOnHit(detector, false);
+}
+
+// Number of samples in the game.
+uint32_t syntheticGame_sampleCount(const syntheticGame_t *game) {
+  return SYNTHETICGAME_FIRST_SHOT + game->shotCount * game->shotEvery;
+}
+
+// First sample of shot i.
+uint32_t syntheticGame_shotStart(const syntheticGame_t *game, uint16_t i) {
+  return SYNTHETICGAME_FIRST_SHOT + i * game->shotEvery;
+}
+
+// Sets up a generator for the game.
+bool syntheticGame_initGenerator(const syntheticGame_t *game,
+                                 signalGenerator_t *gen,
+                                 signalGenerator_burst_t shots[]) {
+  const signalGenerator_config_t config = {
+      .seed = game->seed,
+      .noiseSigma = SYNTHETICGAME_NOISE_SIGMA,
+      .impulseRate = game->impulseRate,
+      .impulseAmplitude = game->impulseAmplitude,
+      .mainsHz = SYNTHETICGAME_MAINS_HZ,
+      .flickerAmplitude = SYNTHETICGAME_FLICKER_AMPLITUDE,
+      .flickerHarmonics = SYNTHETICGAME_FLICKER_HARMONICS};
+  if (game->shotCount > SYNTHETICGAME_MAX_SHOTS)
+    return false;
+  uint32_t count = signalGenerator_makeShots(
+      shots, game->shotCount, syntheticGame_sampleCount(game),
+      SYNTHETICGAME_FIRST_SHOT, game->shotEvery, game->frequencies,
+      game->shotCount, 0, SYNTHETICGAME_SHOT_RAMP);
+  for (uint32_t i = 0; i < count; i++)
+    shots[i].amplitude = game->amplitudes[i];
+  return signalGenerator_init(gen, &config) &&
+         signalGenerator_setBursts(gen, shots, count);
+}
+
+// Runs the whole game through the detector.
+bool syntheticGame_run(const syntheticGame_t *game, detector_ctx_t *detector,
+                       syntheticGame_hitLog_t *log) {
+  signalGenerator_t gen;
+  signalGenerator_burst_t shots[SYNTHETICGAME_MAX_SHOTS];
+  uint16_t block[BLOCK_SIZE];
+  uint32_t sampleCount = syntheticGame_sampleCount(game);
+
+  if (!syntheticGame_initGenerator(game, &gen, shots))
+    return false;
+  *log = (syntheticGame_hitLog_t){0};
+  detector->user = log;
+  for (log->position = 0; log->position < sampleCount;) {
+    signalGenerator_generate(&gen, block, BLOCK_SIZE);
+    for (uint32_t i = 0; i < BLOCK_SIZE; i++, log->position++)
+      detector_ctxAddSample(detector, block[i]);
+  }
+  return true;
+}
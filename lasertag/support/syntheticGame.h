@@ -0,0 +1,77 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef SYNTHETICGAME_H_
+#define SYNTHETICGAME_H_
+
+// A game for the detector tests: one shot every shotEvery samples after a
+// second of quiet, on the noise, impulses and lamp flicker of
+// signalGenerator.c, run through a detector that logs every hit. With
+// SYNTHETICGAME_NOISE_SIGMA of noise, shots from amplitude 70 up are 10 dB or
+// more over it.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "detector.h"
+#include "signalGenerator.h"
+
+#define SYNTHETICGAME_MAX_SHOTS 16
+#define SYNTHETICGAME_FIRST_SHOT 100000 // 1 s of quiet first.
+#define SYNTHETICGAME_SHOT_RAMP 200
+#define SYNTHETICGAME_NOISE_SIGMA 20.0
+#define SYNTHETICGAME_MAINS_HZ 60.0
+#define SYNTHETICGAME_FLICKER_AMPLITUDE 40.0
+#define SYNTHETICGAME_FLICKER_HARMONICS 4
+#define SYNTHETICGAME_SAMPLES_PER_MS (SIGNALGENERATOR_SAMPLE_RATE / 1000)
+
+typedef struct {
+  uint64_t seed;
+  double impulseRate;      // See signalGenerator_config_t.
+  double impulseAmplitude;
+  uint32_t shotEvery;      // Samples from one shot to the next.
+  uint16_t shotCount;      // Up to SYNTHETICGAME_MAX_SHOTS.
+  const uint16_t *frequencies; // Frequency number of each shot.
+  const double *amplitudes;    // ADC counts of each shot.
+} syntheticGame_t;
+
+// The hits of a game, in order. Hits past SYNTHETICGAME_MAX_SHOTS are only
+// counted.
+typedef struct {
+  uint32_t position; // Sample being run.
+  uint32_t hitCount;
+  uint32_t hitPositions[SYNTHETICGAME_MAX_SHOTS];
+  uint16_t hitFrequencies[SYNTHETICGAME_MAX_SHOTS];
+} syntheticGame_hitLog_t;
+
+// Initializes filter and detector for a game: the detector logs every hit
+// and never freezes. Set any other options before syntheticGame_run().
+void syntheticGame_initDetector(detector_ctx_t *detector,
+                                filter_ctx_t *filter);
+
+// Number of samples in the game, up to the end of the last shot's period.
+uint32_t syntheticGame_sampleCount(const syntheticGame_t *game);
+
+// First sample of shot i.
+uint32_t syntheticGame_shotStart(const syntheticGame_t *game, uint16_t i);
+
+// Sets up gen to generate the game from its first sample, with its shots in
+// shots[] (SYNTHETICGAME_MAX_SHOTS of them, which must live as long as gen is
+// used), for tests that run the samples themselves. Returns false if the game
+// could not be set up.
+bool syntheticGame_initGenerator(const syntheticGame_t *game,
+                                 signalGenerator_t *gen,
+                                 signalGenerator_burst_t shots[]);
+
+// Runs the whole game through the detector, logging its hits in log. Returns
+// false if the game could not be generated.
+bool syntheticGame_run(const syntheticGame_t *game, detector_ctx_t *detector,
+                       syntheticGame_hitLog_t *log);
+
+#endif /* SYNTHETICGAME_H_ */
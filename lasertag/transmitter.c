@@ -7,6 +7,7 @@
 #include "mio.h"
 #include "utils.h"
 #include "buttons.h"
+#include "idle.h"
 #include "switches.h"
 #include "sound.h"
 
@@ -261,6 +262,7 @@ void transmitter_runTestNoncontinuous()
         transmitter_run();                                               // Start the transmitter.
         while (transmitter_running())
         { // Keep ticking until it is done.
+            idle_run();
         }
         utils_msDelay(SHORT_DELAY);
     }
@@ -271,7 +273,7 @@ void transmitter_runTestNoncontinuous()
     } while (buttons_read());
     transmitter_setContinuousMode(false);
     transmitter_run();
-    while(transmitter_running()){}
+    while(transmitter_running()){idle_run();}
 }
 
 // Tests the transmitter in continuous mode.
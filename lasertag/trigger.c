@@ -4,7 +4,8 @@
 #include <stdint.h>
 #include "mio.h"
 #include "utils.h"
-#include "sound.c"
+#include "sound.h"
+#include "capture.h"
 #define TRIGGER_INPUT_PIN 10
 #define DEBOUNCE_TICKS 5000
 #define RELOAD_TICKS 300000
@@ -47,6 +48,9 @@ volatile static uint32_t reloadCount;
 volatile static bool disabled;
 volatile static bool reloadFlag;
 volatile static trigger_shotsRemaining_t remainingShots;
+volatile static bool reloadPressed;        // Trigger state at the last reload tick.
+volatile static bool reloadClicked;        // A click was played this reload.
+volatile static uint32_t reloadClickCount; // reloadCount at the last click.
 
 
 // Returns true if the button is pressed
@@ -98,6 +102,8 @@ void trigger_tick()
             else if (remainingShots == 0) {
                 triggerState = TRIGGER_RELOAD_ST;
                 reloadCount = 0;
+                reloadClicked = false;
+                reloadPressed = triggerPressed();
             }
             // If the trigger is pressed then start debouncing
             else if (triggerPressed())
@@ -118,14 +124,15 @@ void trigger_tick()
                 // Decrement remaining shots and play the gunFire sound when the trigger is pulled
                 if(remainingShots) {
                     remainingShots--;
-                    sound_setSound(sound_gunFire_e);
+                    sound_enqueue(sound_gunFire_e);
                     transmitter_run();
+                    capture_isrMark(capture_triggerMarker_e,
+                                    transmitter_getFrequencyNumber());
                 }
                 else {
-                    sound_setSound(sound_gunClick_e);
+                    sound_enqueue(sound_gunClick_e);
                 }
                 waitCount = 0;
-                sound_startSound();
                 DPCHAR('U');
                 DPCHAR('\n');
                 DPCHAR('D');
@@ -136,11 +143,9 @@ void trigger_tick()
             // When trigger is released go to next state
             if(reloadCount > RELOAD_TICKS) {
                 triggerState = TRIGGER_COUNT_2_ST;
-                sound_setSound(sound_gunReload_e);
                 // Reload the gun with a new clip when 10 shots have been shot
                 if(sound_isSoundComplete()){
-                  sound_setSound(sound_gunReload_e);
-                  sound_startSound();
+                  sound_enqueue(sound_gunReload_e);
                   }
                 remainingShots = SHOTS_PER_CLIP;
                 reloadCount = 0;
@@ -167,15 +172,24 @@ void trigger_tick()
         case TRIGGER_RELOAD_ST:
             // When you have shot 10 times reload the gun and play the reload sound
             if(reloadCount > RELOAD_TICKS){
-                sound_setSound(sound_gunReload_e);
+                sound_enqueue(sound_gunReload_e);
                 reloadCount = 0;
-                sound_startSound();
                 triggerState = TRIGGER_DISABLED_ST;
                 remainingShots = SHOTS_PER_CLIP;
             // If the trigger is pressed while reloading play the click sound
-            } else if(triggerPressed()){
-                sound_setSound(sound_gunClick_e);
-                sound_startSound();
+            // right away, once per press and not on every tick it is held.
+            // Bounces within DEBOUNCE_TICKS of the last click do not click
+            // again.
+            } else {
+                bool pressed = triggerPressed();
+                if (pressed && !reloadPressed &&
+                    (!reloadClicked ||
+                     reloadCount - reloadClickCount >= DEBOUNCE_TICKS)) {
+                    sound_enqueue(sound_gunClick_e);
+                    reloadClicked = true;
+                    reloadClickCount = reloadCount;
+                }
+                reloadPressed = pressed;
             }
 
     }